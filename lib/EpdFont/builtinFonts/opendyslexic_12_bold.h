@@ -2,4411 +2,3071 @@
  * generated by fontconvert.py
  * name: opendyslexic_12_bold
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_12_bold 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py opendyslexic_12_bold 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_boldBitmaps[59736] = {
-    0x00, 0x00, 0x02, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xF0,
-    0x07, 0xF0, 0x07, 0xF0, 0x0B, 0xF0, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x03, 0xF0, 0x00, 0xB0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x2F, 0xF4, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFC, 0xBF, 0xFC,
-    0x7F, 0xF8, 0x3F, 0xFC, 0x7F, 0xF4, 0x3F, 0xF8, 0x7F, 0xF0, 0x3F, 0xF0, 0x7F, 0xE0, 0x3F, 0xF0,
-    0x7F, 0xE0, 0x3F, 0xF0, 0x7F, 0xE0, 0x3F, 0xF0, 0x7F, 0xE0, 0x7F, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0,
-    0x6A, 0x90, 0x2A, 0xA0, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x05, 0x56, 0xFF, 0x57, 0xFE, 0x55, 0x50, 0x00, 0x02, 0xFE, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x15, 0x5F, 0xFD, 0x5F, 0xF9,
-    0x55, 0x40, 0x00, 0x0B, 0xFC, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0A,
-    0xA4, 0x1A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x03,
-    0xFF, 0xBF, 0x58, 0x00, 0x01, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0xBF, 0xC3, 0xF0, 0x00, 0x00, 0x1F,
-    0xF4, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xBF, 0xFF, 0xFD, 0x00, 0x00,
-    0x0F, 0xEF, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0xBF, 0xF4, 0x07, 0x40, 0xFC, 0x0F, 0xFD, 0x03, 0xFF,
-    0xBF, 0x0B, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x01, 0xAF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xE0, 0x03, 0xE0,
-    0xB8, 0x01, 0xFC, 0x00, 0x3C, 0x07, 0xC0, 0x3F, 0x40, 0x03, 0xC0, 0x3C, 0x0B, 0xF0, 0x00, 0x3D,
-    0x0B, 0xC1, 0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x3F, 0x80, 0x00, 0x1F, 0xFF, 0x07, 0xF0, 0x00, 0x00,
-    0x2F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC2, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0x2E, 0x0B, 0xC0, 0x00, 0x2F, 0xD3, 0xC0, 0x3C, 0x00, 0x03, 0xF8, 0x3C, 0x03,
-    0xC0, 0x00, 0xFF, 0x03, 0xE0, 0xBC, 0x00, 0x1F, 0xE0, 0x2F, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0xBF, 0x40, 0x02, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00,
-    0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0x2F,
-    0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x03, 0xFC, 0x3F,
-    0xD0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x94, 0x1F, 0xF2, 0xFD, 0x07, 0xF4, 0xBF, 0x41, 0xFD, 0x2F, 0xC3, 0xFC,
-    0x01, 0xFE, 0xFF, 0x0F, 0xF8, 0x01, 0xFF, 0xF4, 0x3F, 0xFE, 0x57, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0xB0, 0x00, 0x6F, 0xF9, 0x00, 0x00,
-    0x6A, 0xA6, 0xFF, 0xCB, 0xFF, 0x2F, 0xF8, 0xBF, 0xD2, 0xFF, 0x4B, 0xFD, 0x2F, 0xF4, 0xFF, 0xE0,
-    0x00, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x07, 0xF4,
-    0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0x0B, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE,
-    0x00, 0x07, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x0B,
-    0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00,
-    0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x0B,
-    0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x00,
-    0x07, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE,
-    0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFF,
-    0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x60, 0xFC, 0x1F, 0x03, 0xF6, 0xF6,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x3F, 0xEF, 0xAF, 0xC0, 0x78, 0xBE, 0x0D, 0x00, 0x42, 0xF8, 0x00, 0x00,
-    0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0xFE, 0x1F, 0xFD, 0x0F, 0xFC, 0x0F, 0xFC,
-    0x1F, 0xF8, 0x3F, 0xF0, 0x3F, 0xF0, 0xBF, 0xE0, 0x6A, 0x80, 0x7F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0x05, 0x42, 0xFD, 0x3F, 0xE3, 0xFE, 0x3F, 0xF7, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xE0,
-    0x03, 0xF8, 0x1F, 0xD0, 0x2F, 0xC0, 0x2F, 0xC0, 0xFE, 0x00, 0x3F, 0x47, 0xF4, 0xB0, 0xFE, 0x2F,
-    0xCB, 0xF3, 0xFC, 0xFF, 0x2F, 0xCB, 0xF3, 0xFC, 0xFF, 0x2F, 0xCF, 0xF2, 0xFC, 0xFF, 0x3F, 0xC7,
-    0xE3, 0xFC, 0xFF, 0x46, 0x0F, 0xF2, 0xFF, 0x00, 0xBF, 0xCB, 0xFE, 0x07, 0xFE, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x0B, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x3F, 0xFF, 0x00,
-    0x3D, 0xFF, 0x00, 0x20, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x15, 0x00,
-    0x01, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF0, 0x7E, 0x40, 0xBF, 0x86, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF8,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0x40, 0x0F, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xDF,
-    0xFF, 0xFF, 0xFE, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x03, 0x90, 0x07,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xFC, 0x01,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x40, 0x15, 0x6F, 0xFC, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x01, 0xFE, 0x1E, 0x40, 0x7F, 0xE2, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFE, 0xFC, 0x00,
-    0x0F, 0xDB, 0xF0, 0x00, 0xBE, 0x2F, 0xC0, 0x07, 0xF0, 0xFF, 0x00, 0x3F, 0x43, 0xFC, 0x02, 0xF8,
-    0x0F, 0xF0, 0x2F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xD5, 0x56, 0xAF,
-    0xFE, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x7F, 0xFF, 0x90, 0x07, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0x06, 0x95, 0x5F, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xFD, 0x10, 0x00, 0x3F, 0xD3, 0xE4, 0x1F, 0xFD, 0x3F, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x80, 0x1B, 0xFE, 0x80, 0x00, 0x00, 0x05,
-    0xA5, 0x40, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xD0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xCB, 0xF9, 0x00, 0xBF, 0xFF, 0xFE, 0x03,
-    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0x9B, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0xFF, 0x80, 0x0F, 0xF3, 0xFD,
-    0x00, 0x3F, 0xCB, 0xF8, 0x00, 0xFF, 0x1F, 0xF4, 0x0B, 0xFC, 0x3F, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x1B, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xBF, 0xE0, 0x0B, 0xF0, 0x0B, 0xF0, 0x0F,
-    0xE0, 0x03, 0xF4, 0x0F, 0xE0, 0x03, 0xF8, 0x0F, 0xF0, 0x07, 0xF4, 0x0B, 0xFE, 0x6F, 0xF0, 0x02,
-    0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x2F,
-    0xE0, 0x03, 0xFC, 0x3F, 0xD0, 0x02, 0xFD, 0x3F, 0xD0, 0x03, 0xFD, 0x3F, 0xF9, 0x5F, 0xFD, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFA, 0x00, 0x00,
-    0x6F, 0x90, 0x00, 0x1F, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xF0, 0x0F, 0xE0, 0x1F, 0xF0, 0x7E, 0x00,
-    0x1F, 0xC2, 0xF0, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0xBE, 0x3F, 0x00, 0x02, 0xFC, 0xBC, 0x00, 0x0F,
-    0xF2, 0xFC, 0x00, 0xBF, 0xC3, 0xFF, 0xBF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x02, 0xBF, 0xBF, 0xC0, 0x00, 0x00, 0xFE, 0x05, 0x00, 0x0B, 0xF4, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x0A, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0xFF, 0xC3, 0xFF, 0x0F, 0xFC, 0x7F, 0xF2, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x3F, 0xF0, 0xFF, 0xC3, 0xFF, 0x1F, 0xFC, 0xBF, 0xF4, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC, 0x07, 0xFF, 0x41, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0x03, 0xFF, 0xC0, 0xFF, 0xE0, 0x3F, 0xF4,
-    0x0F, 0xFC, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x01,
-    0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xBF,
-    0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0xA8, 0x03, 0xFF, 0xFF, 0xF4, 0x1F,
-    0xFF, 0xFF, 0xE0, 0xFF, 0xFE, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x6F, 0xFF, 0xFF, 0xFD,
-    0x6F, 0xFF, 0xFF, 0xF9, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xE4,
-    0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x02, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x2F, 0xF9, 0x5F, 0xF4, 0x0F, 0x80, 0x03, 0xFC,
-    0x01, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x1F, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x0B,
-    0xC0, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xC0, 0x07, 0xE0, 0x2E, 0xF0, 0x0F, 0x00, 0x3F, 0x03, 0xEF,
-    0xC0, 0x2D, 0x01, 0xF8, 0x1D, 0x0F, 0x40, 0xB8, 0x0B, 0xE0, 0xB0, 0x2D, 0x02, 0xE0, 0x3F, 0x43,
-    0x80, 0x74, 0x0B, 0x80, 0xFE, 0x0E, 0x01, 0xE0, 0x3D, 0x03, 0xF8, 0x2E, 0xAF, 0x82, 0xF0, 0x0F,
-    0xF0, 0x7F, 0xFF, 0x2F, 0x80, 0x3F, 0xD0, 0x7F, 0x7F, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0x80,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10, 0x00, 0x03, 0xFF, 0xF9, 0x6F,
-    0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00,
-    0x03, 0xF9, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00,
-    0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00,
-    0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x01,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD,
-    0x05, 0xFF, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x01, 0xFC, 0x0F, 0xF0, 0x00, 0xBF, 0x03,
-    0xFC, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFE, 0xAA, 0xFF, 0xF0, 0xFF, 0x00, 0x07, 0xFD, 0x3F, 0xC0, 0x00, 0xBF, 0x8F, 0xF0, 0x00,
-    0x3F, 0xF3, 0xFE, 0x55, 0xBF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFA, 0xFC, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x16, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1B, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x85, 0x6F, 0xFF, 0xC3, 0xFE, 0x00, 0x07, 0xFF,
-    0x4F, 0xF8, 0x00, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x0F, 0xF3, 0xFE,
-    0x00, 0x00, 0x3F, 0xCF, 0xF8, 0x00, 0x00, 0xBF, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00,
-    0x0F, 0xF3, 0xFE, 0x00, 0x00, 0xFF, 0xCF, 0xF8, 0x01, 0x6F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x2A, 0xAB, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFA, 0xA4, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0xEA, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF,
-    0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x3F, 0xFA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xAF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xAA, 0x54, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x07, 0xFD, 0x55,
-    0x40, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0x90, 0x15, 0xA0, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x29, 0x40, 0x03, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFC, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xEB, 0xFF, 0x00,
-    0x00, 0x7F, 0xF9, 0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x3F, 0xFF, 0x94, 0x5B, 0xFC, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD1, 0xFF, 0x00, 0x00,
-    0xFF, 0x47, 0xFC, 0x00, 0x03, 0xFD, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x3F, 0xE2,
-    0xFF, 0x00, 0x00, 0xFF, 0x8B, 0xFC, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0xBF, 0xC0,
-    0x00, 0x3F, 0xE2, 0xFF, 0x40, 0x00, 0xFF, 0x8B, 0xFD, 0x00, 0x07, 0xFF, 0x2F, 0xF9, 0x55, 0x6F,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x80, 0x02, 0xFF, 0xCF, 0xFE, 0x00,
-    0x0B, 0xFF, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0xFF, 0xE0, 0x00, 0xBF, 0xF0, 0xFF, 0x8B, 0xF8, 0xBF,
-    0x8B, 0xF8, 0xBF, 0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xFC, 0x7F, 0xC7,
-    0xFC, 0x7F, 0xCB, 0xFC, 0xBF, 0xCB, 0xFC, 0xFF, 0xDF, 0xFD, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x3E, 0x47, 0xFF, 0x41, 0xFF, 0xFF, 0xFC, 0x07, 0xFF,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF4, 0x01, 0xAF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x0F, 0xFC, 0x00, 0x3F, 0xD0, 0xBF, 0xE0, 0x00, 0xFF, 0x03, 0xFF, 0x00,
-    0x03, 0xFC, 0x2F, 0xF4, 0x00, 0x0F, 0xF1, 0xFF, 0x80, 0x00, 0x7F, 0xCF, 0xFC, 0x00, 0x01, 0xFE,
-    0x7F, 0xE0, 0x00, 0x07, 0xFB, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
-    0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xCF,
-    0xFF, 0xC0, 0x02, 0xFF, 0x1F, 0xFF, 0xD0, 0x0B, 0xFC, 0x1F, 0xFF, 0xD0, 0x3F, 0xF0, 0x2F, 0xFF,
-    0xE0, 0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0xBF, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF0,
-    0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xF4, 0x7F, 0xFF, 0x00, 0x2F, 0xFF,
-    0x47, 0xFF, 0xF4, 0x03, 0xFF, 0xF4, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x47, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xF4, 0x7F, 0xFF, 0xD0, 0xFF, 0xFF, 0x4B, 0xFB, 0xFF, 0x2F, 0xFF, 0xF8, 0xBF, 0xAF, 0xF7, 0xFE,
-    0xFF, 0x8B, 0xF9, 0xFF, 0xFF, 0xDF, 0xF8, 0xBF, 0xCF, 0xFF, 0xFC, 0xFF, 0x8B, 0xFC, 0xBF, 0xFF,
-    0x8F, 0xF8, 0xBF, 0xC3, 0xFF, 0xF5, 0xFF, 0xCF, 0xFC, 0x3F, 0xFF, 0x1F, 0xFC, 0xFF, 0xC1, 0xFF,
-    0xE1, 0xFF, 0xCF, 0xFC, 0x0F, 0xFD, 0x2F, 0xFC, 0xFF, 0xD0, 0xBF, 0xC2, 0xFF, 0xCF, 0xFD, 0x07,
-    0xFC, 0x3F, 0xFC, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFF, 0x40,
-    0x00, 0xFF, 0x1F, 0xFC, 0x00, 0x1F, 0xE1, 0xFF, 0xD0, 0x01, 0xFE, 0x2F, 0xFF, 0x00, 0x1F, 0xE2,
-    0xFF, 0xF4, 0x02, 0xFE, 0x2F, 0xFF, 0xC0, 0x2F, 0xD3, 0xFF, 0xFD, 0x02, 0xFD, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xD3, 0xFF, 0xFF, 0x43, 0xFD, 0x3F, 0xF7, 0xFC, 0x3F, 0xD3, 0xFF, 0x3F, 0xD3, 0xFC, 0x3F,
-    0xF2, 0xFE, 0x3F, 0xC7, 0xFF, 0x0F, 0xF7, 0xFC, 0x7F, 0xF0, 0xBF, 0xFF, 0xC7, 0xFF, 0x07, 0xFF,
-    0xFC, 0xBF, 0xF0, 0x3F, 0xFF, 0xCB, 0xFF, 0x01, 0xFF, 0xFC, 0xBF, 0xF0, 0x0F, 0xFF, 0xCF, 0xFF,
-    0x00, 0xBF, 0xFC, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x9B, 0xFF, 0xC0, 0x0F, 0xFD, 0x00,
-    0x2F, 0xF8, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x00, 0x00,
-    0x0F, 0xFC, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00,
-    0x0F, 0xF3, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x7F, 0xE0, 0x00, 0x00,
-    0x7F, 0xCF, 0xFC, 0x00, 0x00, 0x2F, 0xF2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0xBF, 0xFE, 0x51, 0x7F,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xF4, 0x3F, 0xC0, 0x1F, 0xF0, 0xFF, 0x00, 0x0F, 0xD3, 0xFC, 0x00, 0x3F,
-    0x8F, 0xF0, 0x01, 0xFF, 0x3F, 0xD5, 0xAF, 0xF8, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x90, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0x40, 0x7F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x7F,
-    0xD0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x00,
-    0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xC0,
-    0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0x50, 0x1F, 0xF0, 0x0F,
-    0xF8, 0x03, 0xF4, 0xBF, 0xC0, 0x3F, 0xFD, 0x5F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x0B, 0xE0, 0x0F, 0xE0, 0x02, 0xFC, 0x03, 0xF8,
-    0x00, 0xBF, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x2F, 0xE0, 0x0F, 0xFF, 0xFF, 0xF4, 0x07,
-    0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFD, 0x1F, 0xF4,
-    0x0B, 0xFD, 0x01, 0xFF, 0x02, 0xFF, 0x80, 0x7F, 0xD0, 0xBF, 0xE0, 0x1F, 0xF8, 0x2F, 0xF8, 0x07,
-    0xFF, 0x0F, 0xFE, 0x01, 0xFF, 0xD3, 0xFF, 0xC0, 0x7F, 0xF8, 0xFF, 0xF0, 0x1F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x01, 0xFF, 0xFA, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x10, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF,
-    0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x03,
-    0xE0, 0x00, 0x2F, 0xF8, 0x3F, 0xFD, 0x46, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF,
-    0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0,
-    0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC, 0x00, 0x07, 0xFC,
-    0xBF, 0xC0, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFF, 0xFA,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0xC0, 0x00,
-    0x2F, 0xF0, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xC0, 0x03,
-    0xFF, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xC0, 0x7F,
-    0xF0, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x07, 0xFF, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xDB, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x2F, 0xF4, 0x00, 0x69, 0x00, 0x2F, 0xF0, 0x2F, 0xF8, 0x00,
-    0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x02, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0xC0,
-    0x7F, 0xD0, 0x0F, 0xFD, 0x0B, 0xFF, 0xD0, 0xBF, 0xC0, 0x0B, 0xFE, 0x0F, 0xFF, 0xF0, 0xFF, 0xC0,
-    0x07, 0xFF, 0x3F, 0xFF, 0xF4, 0xFF, 0x80, 0x07, 0xFF, 0x7F, 0xFF, 0xFD, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x82, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0x0F, 0xF4,
-    0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00,
-    0xBF, 0xE7, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFE,
-    0x00, 0x01, 0xFF, 0xDB, 0xFF, 0x40, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x0B, 0xFF, 0x41, 0xFF, 0xE0,
-    0x1F, 0xFE, 0x00, 0xFF, 0xF4, 0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0xBF, 0xF8, 0x00, 0x2F, 0xFE, 0xBF,
-    0xC0, 0x00, 0x0F, 0xF8, 0xFF, 0x40, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x03, 0xFE, 0x07, 0xFD, 0x00,
-    0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x3F, 0xE0,
-    0x00, 0x7F, 0xE2, 0xFF, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xAB, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF,
-    0xF5, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xD0, 0xFF,
-    0xFD, 0x0F, 0xFF, 0xD0, 0xFE, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00,
-    0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x2F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x07,
-    0xF4, 0x00, 0x7F, 0x40, 0x07, 0xF4, 0x00, 0xBF, 0x00, 0x0B, 0xFF, 0xF4, 0xBF, 0xFF, 0x4B, 0xFF,
-    0xF4, 0xBF, 0xFF, 0x45, 0xA5, 0x50, 0x10, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x07, 0x80, 0x00,
-    0x7C, 0x00, 0x0B, 0xD0, 0x00, 0xBE, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x1F,
-    0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x02, 0xFD,
-    0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x2F, 0xD0,
-    0x01, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x06, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x0B, 0xFF, 0xF0, 0xBF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF,
-    0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x07, 0xF4, 0x00, 0x7F, 0x40,
-    0x07, 0xF4, 0x00, 0x3F, 0x40, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xFC,
-    0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x1F, 0xC2, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xD2, 0xFF, 0xFD, 0x2F, 0xFF, 0xD1, 0x55, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xD1, 0xFD, 0x02,
-    0xF8, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0xAA, 0xA0, 0x15, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F, 0xC0,
-    0x7E, 0x00, 0xBF, 0x43, 0xF0, 0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0xF4,
-    0x00, 0x2F, 0xC3, 0xD0, 0x00, 0xBF, 0x0F, 0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x81, 0x50, 0x00, 0x2F, 0xAF, 0xFD,
-    0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFD, 0x0B, 0xF0, 0x1F, 0xF4, 0x02,
-    0xF4, 0x1F, 0xF0, 0x01, 0xF8, 0x1F, 0xF0, 0x00, 0xFC, 0x0F, 0xF0, 0x01, 0xFC, 0x0F, 0xF0, 0x03,
-    0xFC, 0x0F, 0xFD, 0x5F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x2F, 0xFF, 0xD0, 0x1F, 0xFF, 0xF4, 0x0F, 0xF5, 0x18, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x1F, 0xFE, 0xB8, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF4, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xD2, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFA, 0xFF, 0xFC, 0x1F, 0xD0, 0x3F, 0xF8, 0x3F, 0x80, 0x1F, 0xF8, 0x3F, 0x40, 0x0F,
-    0xF8, 0x3F, 0x00, 0x0F, 0xF8, 0x3F, 0x00, 0x0F, 0xF4, 0x3F, 0x00, 0x0F, 0xF4, 0x3F, 0x80, 0x2F,
-    0xF8, 0x2F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xEB, 0xFC,
-    0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4F,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFF,
-    0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x00, 0x0A, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0xBF, 0xFC, 0x03, 0xF8, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x40, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD2, 0xBF, 0xEA, 0x00,
-    0xFE, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00,
-    0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F,
-    0xD3, 0xF8, 0x0B, 0xFF, 0xEF, 0xE0, 0xBF, 0xFF, 0xFF, 0x83, 0xF4, 0x7F, 0xFE, 0x2F, 0x40, 0x3F,
-    0xF4, 0xFC, 0x00, 0xBF, 0xD3, 0xE0, 0x01, 0xFF, 0x4F, 0x80, 0x03, 0xFD, 0x3E, 0x00, 0x0F, 0xF4,
-    0xFC, 0x00, 0x7F, 0xD3, 0xF4, 0x07, 0xFF, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0x1F, 0xF6, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x7F, 0x80, 0xF4, 0x07, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF4,
-    0x01, 0xAF, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE7, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x1F, 0xF9, 0x0B, 0xF0, 0x1F, 0xF0, 0x03,
-    0xF4, 0x1F, 0xE0, 0x02, 0xF8, 0x2F, 0xD0, 0x02, 0xF8, 0x2F, 0xD0, 0x02, 0xF8, 0x2F, 0xD0, 0x02,
-    0xF8, 0x3F, 0xD0, 0x03, 0xFC, 0x3F, 0xD0, 0x03, 0xFC, 0x3F, 0xE0, 0x03, 0xFC, 0x3F, 0xE0, 0x07,
-    0xFC, 0x3F, 0xF0, 0x0B, 0xFC, 0x3F, 0xF0, 0x0B, 0xFC, 0x3F, 0xC3, 0xFC, 0x7F, 0xCB, 0xFD, 0xBF,
-    0xD5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x3F, 0x83,
-    0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xD0, 0x00, 0x1F, 0x80, 0x02,
-    0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00,
-    0x3F, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x2F, 0xFE, 0x02, 0xFF, 0xD0, 0x3F, 0xFC, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC3, 0xFD, 0x00, 0x1F, 0xCF, 0xF4, 0x00, 0x1F, 0xEF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x40,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xDF, 0xFE, 0x00, 0x3F, 0xCB, 0xFF,
-    0xC0, 0x3F, 0xC2, 0xFF, 0xF0, 0x3F, 0xC0, 0xFF, 0xFC, 0x0F, 0xD0, 0x03, 0xF4, 0x01, 0xFC, 0x00,
-    0x7F, 0x00, 0x1F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x03,
-    0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
-    0xE5, 0x03, 0xFF, 0xE0, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF6, 0xFE, 0x00, 0xBE, 0x00, 0x0B, 0xFF, 0xFF, 0xD7, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFD, 0x0B, 0xFF, 0x43, 0xFC, 0x0F, 0xF8, 0x03, 0xFE, 0x01, 0xFC, 0x0F, 0xF0, 0x03,
-    0xFD, 0x00, 0xFD, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x1F,
-    0xF0, 0x03, 0xFC, 0x01, 0xFE, 0x2F, 0xF0, 0x07, 0xFC, 0x01, 0xFE, 0x2F, 0xE0, 0x0B, 0xF8, 0x02,
-    0xFE, 0x3F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x3F, 0xE0, 0x0F, 0xF4, 0x02, 0xFF, 0x3F, 0xD0, 0x0F,
-    0xF4, 0x03, 0xFF, 0x3F, 0xD0, 0x1F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xE4,
-    0x00, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF4, 0x1F, 0xF9, 0x1F, 0xF0, 0x7F, 0x80, 0x1F, 0xC1,
-    0xFC, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0xFD, 0x2F, 0xC0, 0x03, 0xF4, 0xBF, 0x00, 0x1F, 0xE3, 0xFD,
-    0x00, 0x7F, 0x8F, 0xF4, 0x02, 0xFE, 0x3F, 0xD0, 0x0B, 0xF8, 0xFF, 0x80, 0x2F, 0xF3, 0xFE, 0x00,
-    0xFF, 0xCF, 0xF8, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC,
-    0x03, 0xFD, 0x0B, 0xF8, 0x2F, 0xD0, 0x0F, 0xF0, 0xFF, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x3F, 0x8F,
-    0xE0, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xF8, 0xFF, 0x00, 0x1F, 0xD3, 0xFE, 0x01, 0xFF, 0x4B, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x1B, 0xFD,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0xFD, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
-    0x9B, 0xF4, 0x03, 0xFF, 0x40, 0x3F, 0x00, 0xFF, 0xC0, 0x0B, 0xC0, 0x3F, 0xE0, 0x01, 0xF4, 0x0F,
-    0xF8, 0x00, 0x7D, 0x03, 0xFE, 0x00, 0x1F, 0x80, 0xFF, 0xC0, 0x07, 0xD0, 0x3F, 0xF8, 0x07, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xC1, 0xA9, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x3F, 0x80, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0F, 0xD0, 0xBF, 0xF4, 0x02, 0xF4, 0x03, 0xFF, 0x40, 0x3F, 0x00,
-    0x1F, 0xF4, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0x3E, 0x00, 0x0F, 0xF0, 0x03, 0xE0, 0x00, 0xFF, 0x00,
-    0x3F, 0x00, 0x1F, 0xF0, 0x03, 0xF8, 0x07, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x6F, 0x9B, 0xE6, 0xD0,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0F,
-    0xFE, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF6, 0xF8, 0x0F, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xA8, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F,
-    0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0xFD, 0x56, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0x40, 0x10, 0x02, 0xFE, 0x03, 0xE4, 0x0F, 0xF8, 0x2F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x01, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xD0, 0x00,
-    0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF4, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F, 0xD0, 0x02, 0xFC,
-    0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0xFF, 0x4B, 0xE0, 0x03, 0xFD, 0x2F,
-    0xC0, 0x0F, 0xF4, 0xBF, 0x00, 0x3F, 0xD1, 0xFF, 0x43, 0xFF, 0x47, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x3F, 0xC0, 0x00,
-    0x1F, 0xE2, 0xFD, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0xBF, 0x40, 0x0B, 0xF4, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x2F, 0xD0, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0xBF,
-    0x80, 0x00, 0xBF, 0xCF, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x00, 0x1F, 0xE2, 0xFD, 0x00, 0x00, 0x0F,
-    0xF4, 0x7F, 0x80, 0x7C, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC1, 0xFE, 0x03, 0xFD, 0x2F, 0xF4, 0xBF,
-    0x40, 0x7F, 0x9F, 0xFF, 0x3F, 0xC0, 0x0F, 0xFF, 0xFF, 0xEF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0xC0,
-    0x00, 0xFF, 0xF1, 0xFF, 0xE0, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0xBF,
-    0x87, 0xFC, 0x00, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x07, 0xFF,
-    0xFF, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x0F, 0xFD, 0x02, 0xFF, 0x82,
-    0xFF, 0x80, 0x0F, 0xFD, 0x3F, 0xC0, 0x00, 0xBF, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x1F,
-    0xD0, 0x1F, 0xF0, 0x0B, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0xFE, 0x00, 0x0F, 0xF8,
-    0xBF, 0x00, 0x01, 0xFF, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x05, 0x6F, 0xFC, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xAA, 0x80, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFD, 0x01, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x02,
-    0xFE, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xF4,
-    0x00, 0xFF, 0xF0, 0x00, 0xBF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0xF4, 0x03, 0xFF, 0xF4, 0x01,
-    0xFF, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE2,
-    0xF8, 0xBE, 0x2F, 0x8B, 0xD2, 0xF4, 0xBD, 0x2F, 0x4B, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xC3, 0xF0,
-    0xFC, 0x3F, 0x0F, 0xC2, 0xA0, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0xBF, 0xFD, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0x80,
-    0x00, 0x7F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xFF, 0x00,
-    0x2F, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0x40, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x01, 0x43, 0xFC, 0x3D, 0x7F, 0xF3, 0xDB, 0xCF, 0xFC, 0xBC, 0x7F, 0xC6,
-    0x81, 0xA0, 0x7F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x2F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x02, 0xF0,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF0, 0x0B, 0xF0, 0x0B, 0xF0, 0x07, 0xF4, 0x07, 0xF4,
-    0x07, 0xF4, 0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF4, 0x02, 0xE0, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xD8, 0x0B,
-    0xF1, 0xE0, 0x03, 0xFC, 0x78, 0x00, 0xFE, 0x1E, 0x00, 0x3F, 0x87, 0x80, 0x0F, 0xF2, 0xE0, 0x03,
-    0xFC, 0xB8, 0x00, 0xFF, 0xAE, 0x00, 0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF4,
-    0x01, 0xBF, 0xE4, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x29, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xAA, 0xFF, 0xAA, 0x40, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFA, 0x40,
-    0xBF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0xAA, 0xAA, 0xAA, 0xA8, 0x01, 0x00, 0x02, 0x00,
-    0x2D, 0x00, 0x3E, 0x02, 0xFE, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xD2, 0xFE, 0x00, 0xFE, 0x03, 0xFC, 0x03, 0xF8, 0x0F, 0xF0, 0x0F, 0xF4, 0x7F, 0xC0, 0x3F, 0xFF,
-    0xFE, 0x02, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xF0, 0x7C, 0x04, 0x1F,
-    0x00, 0x40, 0x00, 0x10, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0xBF,
-    0xD0, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0xDF, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF,
-    0xFF, 0x50, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE1, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x2F,
-    0x2F, 0x2F, 0x2F, 0x3F, 0x3E, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x24, 0x00, 0x06, 0xA4, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x1F,
-    0x40, 0xBC, 0x02, 0xF0, 0x03, 0x40, 0x2F, 0xD0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xC0, 0x7F, 0x85, 0xFE, 0x0B, 0xD0, 0x0B, 0xE0, 0xBF, 0x95, 0xFE, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xD0,
-    0x10, 0x00, 0xFE, 0x07, 0xE0, 0x0F, 0xE0, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x40, 0xAF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x55, 0x0B, 0xF4, 0x3F, 0xC3, 0xFE, 0x0F, 0xF4, 0xFF,
-    0x83, 0xFD, 0x3F, 0xF1, 0xFF, 0x9F, 0xFC, 0xBF, 0xE0, 0x00, 0xBF, 0x40, 0x07, 0xFF, 0xF0, 0x0F,
-    0xD1, 0xFC, 0x2F, 0x3E, 0x3D, 0x3D, 0xE0, 0x2E, 0x3C, 0xD0, 0x1E, 0x3D, 0xE0, 0x2E, 0x2F, 0x7F,
-    0x3D, 0x0F, 0xD1, 0xFC, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFB, 0x41, 0xEB,
-    0xD0, 0xF0, 0xB8, 0x34, 0x0E, 0x0D, 0x03, 0x83, 0x96, 0xF0, 0xBF, 0xFC, 0x0B, 0xEB, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA0, 0x0C, 0x00, 0x3E, 0x07, 0xC0, 0x0F, 0xD1, 0xFC, 0x07, 0xFC, 0xBF,
-    0x41, 0xFE, 0x3F, 0xD0, 0x7F, 0x4B, 0xF0, 0x0B, 0xF4, 0xFF, 0x00, 0x7F, 0xEB, 0xFC, 0x01, 0xFF,
-    0xAF, 0xF0, 0x03, 0xFC, 0xBF, 0xC0, 0x0F, 0xC2, 0xF8, 0x00, 0x3C, 0x0B, 0x40, 0x00, 0x40, 0x10,
-    0x55, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x9B, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFE, 0x00, 0x15, 0x7F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xBC, 0x2E, 0x93, 0x3D, 0x3D, 0xA3, 0x1E, 0x3C, 0xBF, 0x2E, 0x2E, 0xB3, 0x7E,
-    0x1F, 0xF3, 0xFC, 0x0B, 0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFC, 0x2F, 0xD1, 0xFD, 0x3F, 0x80, 0xBE, 0x3F, 0xC0, 0xFE, 0x2F, 0xFF, 0xFD, 0x0F,
-    0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0x05, 0x50, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x1A, 0xAF, 0xFA, 0xA0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAB, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3E, 0xF4, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xF0, 0x0F, 0xD0,
-    0x2F, 0xFC, 0x3F, 0xFC, 0x01, 0x40, 0x1F, 0xF4, 0x10, 0x2C, 0x00, 0x1C, 0x02, 0xBC, 0x0B, 0xF8,
-    0x00, 0x3C, 0x19, 0x7D, 0x2F, 0xFC, 0x2F, 0xF4, 0x03, 0xF0, 0x1F, 0x80, 0xFD, 0x03, 0xF0, 0x2F,
-    0x80, 0x00, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x2F, 0xC0, 0x02, 0xFC, 0x2F, 0xC0, 0x02, 0xFC, 0x2F,
-    0xD0, 0x02, 0xFC, 0x2F, 0xD0, 0x02, 0xFC, 0x3F, 0xD0, 0x02, 0xFC, 0x3F, 0xE0, 0x03, 0xFD, 0x3F,
-    0xE0, 0x03, 0xFD, 0x3F, 0xF0, 0x03, 0xFD, 0x3F, 0xF0, 0x03, 0xFD, 0x3F, 0xFD, 0x0F, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
-    0x2F, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x4F, 0xD0, 0xFF, 0xF4, 0xFD, 0x2F, 0xFF, 0x4F, 0xD3, 0xFF, 0xF0, 0xFD, 0x7F, 0xFF, 0x0F,
-    0xD7, 0xFF, 0xF0, 0xFD, 0x3F, 0xFF, 0x0F, 0xD2, 0xFF, 0xF0, 0xFD, 0x0F, 0xFF, 0x0F, 0xD0, 0x2F,
-    0xF0, 0xFD, 0x03, 0xFE, 0x0B, 0xE0, 0x3F, 0xE0, 0xBE, 0x03, 0xFE, 0x0B, 0xE0, 0x7F, 0xD0, 0xBE,
-    0x0B, 0xFD, 0x0B, 0xE0, 0xFF, 0xD0, 0xBE, 0x0F, 0xFD, 0x0B, 0xE0, 0xFF, 0xC0, 0xBE, 0x1F, 0xFC,
-    0x0B, 0xE2, 0xFF, 0xC0, 0xBE, 0x3F, 0xFC, 0x0B, 0xE1, 0x55, 0x40, 0x15, 0x2F, 0xD3, 0xFD, 0x3F,
-    0xE3, 0xFE, 0x7F, 0xF1, 0x55, 0x2E, 0x00, 0xF4, 0x03, 0xF8, 0x2F, 0xF8, 0x52, 0xF1, 0xFF, 0x8B,
-    0xFC, 0x1A, 0x40, 0x0B, 0x80, 0x7E, 0x01, 0x78, 0x00, 0xE0, 0x03, 0x80, 0x1E, 0x00, 0x78, 0x0F,
-    0xFE, 0x3F, 0xF8, 0x07, 0xF4, 0x07, 0xEF, 0x43, 0xC0, 0xF0, 0xF0, 0x3C, 0x3C, 0x0F, 0x0F, 0xEF,
-    0xC1, 0xFF, 0xD0, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0x00, 0xA0, 0x00, 0x3D, 0x0B, 0x80, 0x03,
-    0xF4, 0xBF, 0x00, 0x1F, 0xE3, 0xFD, 0x00, 0x7F, 0xCB, 0xF4, 0x00, 0xFE, 0x2F, 0xD0, 0x0F, 0xF2,
-    0xFE, 0x03, 0xFE, 0xBF, 0xD1, 0xFF, 0xAF, 0xF0, 0x3F, 0xE7, 0xFC, 0x02, 0xF8, 0x3F, 0x00, 0x1D,
-    0x03, 0xC0, 0x00, 0x40, 0x20, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x09, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xD0, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x7D, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x07, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0x40, 0x07, 0xF0, 0x04, 0x0B,
-    0xFF, 0xF0, 0x3F, 0x80, 0xF4, 0x3F, 0xFF, 0xC2, 0xFC, 0x0F, 0xD0, 0xBF, 0xFF, 0x0F, 0xD0, 0xBF,
-    0x40, 0x00, 0x00, 0xFF, 0x07, 0xBD, 0x00, 0x00, 0x07, 0xF4, 0x3C, 0xF4, 0x00, 0x00, 0x3F, 0x83,
-    0xD3, 0xE0, 0x00, 0x02, 0xFC, 0x2E, 0x1F, 0x90, 0x00, 0x1F, 0xE1, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xC0, 0x03,
-    0xFD, 0x00, 0x00, 0x7F, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x05, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x9F, 0x40,
-    0x00, 0x0B, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x7D, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0xFE, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x3F, 0x87, 0xFF, 0x83,
-    0xFF, 0xFC, 0x2F, 0xC3, 0xFF, 0xF8, 0xBF, 0xFF, 0x1F, 0xD0, 0xE4, 0x2F, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x3F,
-    0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x01, 0x54, 0x01, 0x00, 0xB8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF0, 0x00,
-    0xBE, 0x00, 0x00, 0x0B, 0x80, 0x07, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0xF4,
-    0x02, 0xFC, 0x00, 0x00, 0x1B, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0xFE, 0x00, 0x00, 0xE5,
-    0xBF, 0x07, 0xF0, 0x18, 0x03, 0xFF, 0xFC, 0x3F, 0x81, 0xF4, 0x2F, 0xFF, 0xE2, 0xFC, 0x0F, 0xD0,
-    0x6F, 0xFD, 0x1F, 0xD0, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x0B, 0xBD, 0x00, 0x00, 0x07, 0xF4, 0x7C,
-    0xF8, 0x00, 0x00, 0x3F, 0x83, 0xC3, 0xE0, 0x00, 0x02, 0xFC, 0x3F, 0x5F, 0xE0, 0x00, 0x1F, 0xE1,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x10, 0x1F, 0xD0, 0x00, 0xF4, 0x0F, 0xF4, 0x0B, 0xFC, 0x07, 0xFF, 0xFF, 0xF8,
-    0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B, 0xF4,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xFD,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF,
-    0xEA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x1F,
-    0xFC, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B, 0xF4,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xFD,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF,
-    0xEA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x1F,
-    0xFC, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F,
-    0xE0, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0,
-    0x7F, 0x80, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC,
-    0x01, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF4, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x50, 0x14, 0x00, 0x00, 0x00, 0x2F, 0xD2, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x2E, 0x00, 0x00,
-    0x00, 0x3C, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x07,
-    0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0,
-    0x1F, 0xF0, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC,
-    0x00, 0x03, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x05, 0x50, 0x15, 0x40, 0x00, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x00,
-    0x01, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x8F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B,
-    0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0x83, 0xFF,
-    0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xFD, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xEA,
-    0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x1F, 0xFC,
-    0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x55, 0x2A, 0xAB, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xEA, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x4F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x0B, 0xF8, 0x07, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xFA, 0xAB, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0x90, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFA, 0xFC, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x2F, 0xFF, 0x90, 0x16, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x10, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xA4, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAB,
-    0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFA, 0xA4, 0x7F, 0x80, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0xEA, 0xFD, 0x02,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAB, 0xFF, 0xF5, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFA, 0xA4, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0xEA, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x3F, 0xFA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0xFF, 0x00,
-    0xFD, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA,
-    0xBF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xAA, 0x47, 0xF8, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xC0, 0x05, 0x50,
-    0x15, 0x40, 0x3F, 0xC0, 0xFF, 0x00, 0xFF, 0x47, 0xFC, 0x03, 0xFD, 0x1F, 0xF0, 0x1F, 0xF8, 0xBF,
-    0xD0, 0xBF, 0xE3, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xAA, 0xBF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xFF, 0xAA, 0x47, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x0B, 0xFE, 0xAF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x4F,
-    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0B,
-    0xF8, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x80, 0x02, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00,
-    0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00,
-    0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xF4,
-    0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x07, 0xD0, 0xFC, 0x1F, 0x83, 0xF4, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0x8B, 0xF8, 0xBF, 0x8B,
-    0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC,
-    0xBF, 0xCB, 0xFC, 0xBF, 0xCF, 0xFD, 0xFF, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFE, 0x0B, 0xF0, 0x3F, 0x40,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x15, 0x40, 0x55, 0x0B, 0xF4, 0x3F, 0xC3,
-    0xFD, 0x0F, 0xF4, 0xFF, 0x87, 0xFD, 0x7F, 0xE1, 0xFF, 0x9F, 0xFC, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0,
-    0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFC,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xE1, 0x5A, 0xFF, 0xF0, 0x00,
-    0x3F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x03,
-    0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x00,
-    0x3F, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xE0, 0x05, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x07, 0xE0, 0xF0, 0x00, 0x00, 0xFF, 0x8F, 0x40, 0x00, 0x1F, 0xBE, 0xF0, 0x00, 0x02, 0xF2, 0xFF,
-    0x00, 0x00, 0x1F, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFF, 0x40, 0x00, 0xFF, 0x1F, 0xFC, 0x00, 0x1F,
-    0xE1, 0xFF, 0xD0, 0x01, 0xFE, 0x2F, 0xFF, 0x00, 0x1F, 0xE2, 0xFF, 0xF4, 0x02, 0xFE, 0x2F, 0xFF,
-    0xC0, 0x2F, 0xD3, 0xFF, 0xFD, 0x02, 0xFD, 0x3F, 0xFF, 0xF0, 0x3F, 0xD3, 0xFF, 0xFF, 0x43, 0xFD,
-    0x3F, 0xF7, 0xFC, 0x3F, 0xD3, 0xFF, 0x3F, 0xD3, 0xFC, 0x3F, 0xF2, 0xFE, 0x3F, 0xC7, 0xFF, 0x0F,
-    0xF7, 0xFC, 0x7F, 0xF0, 0xBF, 0xFF, 0xC7, 0xFF, 0x07, 0xFF, 0xFC, 0xBF, 0xF0, 0x3F, 0xFF, 0xCB,
-    0xFF, 0x01, 0xFF, 0xFC, 0xBF, 0xF0, 0x0F, 0xFF, 0xCF, 0xFF, 0x00, 0xBF, 0xFC, 0xFF, 0xF0, 0x03,
-    0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFE, 0x6F, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0xBF,
-    0xE0, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x3F,
-    0xF2, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x3F,
-    0xCF, 0xF4, 0x00, 0x00, 0x0F, 0xF7, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xCB, 0xFE, 0x00, 0x00, 0x7F, 0xF2, 0xFF, 0xF9, 0x45, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFE, 0x6F, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x00, 0x01, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x3F, 0xF2, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xCF, 0xF4, 0x00, 0x00, 0x0F, 0xF7, 0xFE, 0x00,
-    0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xCB, 0xFE, 0x00,
-    0x00, 0x7F, 0xF2, 0xFF, 0xF9, 0x45, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x7F, 0x80, 0x00, 0x07, 0xF0, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xE6, 0xFF,
-    0xF0, 0x03, 0xFF, 0x40, 0x0B, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x1F,
-    0xF4, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x1F,
-    0xF3, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x3F,
-    0xDF, 0xF8, 0x00, 0x00, 0x1F, 0xF3, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0xBF, 0xE0, 0x00, 0x07, 0xFF,
-    0x2F, 0xFF, 0x94, 0x5F, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x50, 0x00,
-    0x00, 0x02, 0xFD, 0x2D, 0x00, 0x00, 0x00, 0xFF, 0xCB, 0x80, 0x00, 0x00, 0x7C, 0xFF, 0xD0, 0x00,
-    0x00, 0x1F, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x9B, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x2F, 0xF8, 0x0B,
-    0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0xBF,
-    0xC0, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x0F, 0xF3, 0xFD,
-    0x00, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xCF, 0xFC,
-    0x00, 0x00, 0x2F, 0xF2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0xBF, 0xFE, 0x51, 0x7F, 0xFF, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x55, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0x07, 0xFC,
-    0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x3F, 0xF4,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0x00, 0x07, 0xFF, 0xE6, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x0B, 0xFE, 0x02, 0xFF, 0x00, 0x00,
-    0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x2F, 0xF0, 0x00, 0x00,
-    0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x1F, 0xF3, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x00, 0x1F, 0xF3, 0xFF, 0x00, 0x00, 0x0B,
-    0xFC, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x2F, 0xFF, 0x94, 0x5F, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC2, 0xFE, 0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0xBF, 0xE0, 0x3F,
-    0xF4, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xE6, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x3F, 0xFA, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF,
-    0xD0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0xC0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0x43, 0xFF, 0x40, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x8B, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xDF, 0xFD, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF5, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF,
-    0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00,
-    0xBF, 0xDB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF,
-    0xC0, 0x00, 0x7F, 0xCB, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0xC7, 0xFE, 0x00, 0x0F,
-    0xFC, 0x7F, 0xFF, 0xAF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00,
-    0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xDB,
-    0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00,
-    0x7F, 0xCB, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0x7F,
-    0xFF, 0xAF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0B, 0xF4, 0x7F, 0x40, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0,
-    0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x0B, 0xFD,
-    0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC, 0x00,
-    0x07, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xCB, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0xC7,
-    0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0xAF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xF4, 0x00, 0x1F, 0xF0, 0xBF, 0x80, 0x02, 0xFF, 0x0F,
-    0xF8, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x15, 0x50, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD,
-    0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0xBF,
-    0xDB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0,
-    0x00, 0x7F, 0xDB, 0xFC, 0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x0B, 0xFC,
-    0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFF, 0xFA, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE,
-    0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x07, 0xFC, 0x03, 0xFF,
-    0x00, 0x3F, 0xE0, 0x07, 0xFD, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x1F, 0xF8, 0xBF,
-    0xC0, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0xBD,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xF0, 0xBE, 0x0B, 0xFC, 0xBD, 0x01, 0xFD, 0xBD, 0x00, 0xFD, 0xBD, 0x02, 0xFD,
-    0xBD, 0x0B, 0xFC, 0xBF, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0xBF, 0xFE, 0x00, 0xBF, 0x90, 0x00, 0xBD,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x0B,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x07, 0xF8, 0x0F, 0xE0, 0x2F, 0xC0, 0x0F, 0xC0, 0xFE, 0x01,
-    0xBF, 0x03, 0xF4, 0x1F, 0xFC, 0x0F, 0xD0, 0xFF, 0x90, 0x3F, 0x87, 0xF0, 0x00, 0xFE, 0x1F, 0x40,
-    0x03, 0xF8, 0x7E, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x7F, 0x82, 0xFF, 0x41, 0xFE, 0x03, 0xFF, 0x47,
-    0xFC, 0x07, 0xFF, 0x1F, 0xF0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFA, 0xFF, 0xE4, 0x1F, 0xEB, 0xFF,
-    0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0x00, 0xFD, 0x07, 0xFC, 0x07, 0xE0, 0x0B, 0xF4, 0x3F, 0x00, 0x0F, 0xD0, 0xFC,
-    0x00, 0x3F, 0x83, 0xE0, 0x00, 0xFE, 0x0F, 0x40, 0x02, 0xFC, 0x3D, 0x00, 0x0B, 0xF0, 0xF8, 0x00,
-    0x3F, 0xC3, 0xFE, 0xAF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0xFD, 0x07, 0xFC, 0x07, 0xE0, 0x0B,
-    0xF4, 0x3F, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x3F, 0x83, 0xE0, 0x00, 0xFE, 0x0F, 0x40, 0x02, 0xFC,
-    0x3D, 0x00, 0x0B, 0xF0, 0xF8, 0x00, 0x3F, 0xC3, 0xFE, 0xAF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xF0,
-    0xBF, 0x40, 0xFE, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40,
-    0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F, 0xC0, 0x7E, 0x00, 0xBF, 0x43,
-    0xF0, 0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0xF4, 0x00, 0x2F, 0xC3, 0xD0,
-    0x00, 0xBF, 0x0F, 0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0xBD, 0x0F, 0x00, 0x07, 0xFD, 0x3C,
-    0x00, 0x2F, 0xFE, 0xF0, 0x00, 0xF8, 0xFF, 0x80, 0x02, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0xFD,
-    0x07, 0xFC, 0x07, 0xE0, 0x0B, 0xF4, 0x3F, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x3F, 0x83, 0xE0, 0x00,
-    0xFE, 0x0F, 0x40, 0x02, 0xFC, 0x3D, 0x00, 0x0B, 0xF0, 0xF8, 0x00, 0x3F, 0xC3, 0xFE, 0xAF, 0xFF,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xF9, 0x00, 0x00,
-    0x01, 0x50, 0x15, 0x40, 0x2F, 0xD0, 0xFF, 0x40, 0xFF, 0x83, 0xFD, 0x03, 0xFE, 0x0F, 0xF8, 0x0F,
-    0xFC, 0x7F, 0xE0, 0x7F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F,
-    0xC0, 0x7E, 0x00, 0xBF, 0x43, 0xF0, 0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0,
-    0xF4, 0x00, 0x2F, 0xC3, 0xD0, 0x00, 0xBF, 0x0F, 0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xDF, 0x40, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F, 0xC0, 0x7E,
-    0x00, 0xBF, 0x43, 0xF0, 0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0xF4, 0x00,
-    0x2F, 0xC3, 0xD0, 0x00, 0xBF, 0x0F, 0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0xAF, 0x90, 0x00, 0x3F, 0xFF, 0xFD, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xAF, 0xE0, 0x0F, 0xD0, 0x7F, 0xFE, 0x00, 0xFC, 0x07, 0xE0, 0x0B, 0xFF, 0x05,
-    0x6F, 0x83, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3E, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0x02, 0xFE, 0x95, 0x00, 0x03, 0xD0, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xEA, 0xFF, 0xFF, 0x90, 0x1B, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0x90, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x2F, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xF4, 0x0F, 0xF5, 0x18, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xFE,
-    0xB8, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF4, 0x01, 0xFF, 0xE4, 0x00, 0x0F, 0x80, 0x00, 0x07,
-    0xFE, 0x00, 0x01, 0x9F, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x06, 0x90, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0,
-    0x3F, 0x80, 0x2F, 0x41, 0xFD, 0x15, 0x7F, 0x0B, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF4, 0xFF,
-    0xFF, 0xFF, 0xD3, 0xFA, 0x54, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xF5,
-    0x06, 0xD0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xAF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x01, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFA, 0xFF, 0x00, 0xFE, 0x00, 0xBD, 0x07, 0xF4, 0x55, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0x4F, 0xE9, 0x50, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0xD4, 0x1B, 0x43, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF4, 0x07, 0xFF,
-    0xFF, 0xC0, 0x02, 0xBF, 0xE4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFD, 0x2F, 0xC0, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xEB, 0xFC, 0x03, 0xF8,
-    0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x50, 0x6D,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0x90, 0x01,
-    0x50, 0x05, 0x40, 0x1F, 0xE0, 0xBF, 0x40, 0xBF, 0x83, 0xFE, 0x03, 0xFF, 0x0F, 0xF8, 0x0F, 0xFC,
-    0x3F, 0xF0, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00,
-    0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xEB, 0xFC, 0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0x90, 0x55, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x0B,
-    0xE0, 0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0,
-    0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x3E, 0x0B, 0xD0, 0xFC, 0x2F, 0x83, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x2F, 0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xFC,
-    0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFD, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x1F, 0xFF, 0xC0, 0x07, 0xF4, 0xBF, 0x41, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0x82, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC,
-    0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xFE, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xF1, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0xF8, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xE0, 0x7F, 0xF4, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F,
-    0x40, 0x0F, 0xF0, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0xFA,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x43, 0xC0, 0x00, 0xFF, 0x4F, 0x00, 0x0B,
-    0xEF, 0xBC, 0x00, 0x2E, 0x3F, 0xF0, 0x00, 0xBC, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xE4, 0x00, 0xFF, 0xFF, 0xF8,
-    0x07, 0xFF, 0xFF, 0xF4, 0x1F, 0xF9, 0x1F, 0xF0, 0x7F, 0x80, 0x1F, 0xC1, 0xFC, 0x00, 0x3F, 0x0B,
-    0xF0, 0x00, 0xFD, 0x2F, 0xC0, 0x03, 0xF4, 0xBF, 0x00, 0x1F, 0xE3, 0xFD, 0x00, 0x7F, 0x8F, 0xF4,
-    0x02, 0xFE, 0x3F, 0xD0, 0x0B, 0xF8, 0xFF, 0x80, 0x2F, 0xF3, 0xFE, 0x00, 0xFF, 0xCF, 0xF8, 0x03,
-    0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0x42, 0xFE, 0x0B, 0xF4, 0x03, 0xFC, 0x3F, 0xC0,
-    0x07, 0xF4, 0xFE, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0xFE, 0x3F, 0xC0, 0x07,
-    0xF4, 0xFF, 0x80, 0x7F, 0xD2, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0x42, 0xFE,
-    0x0B, 0xF4, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF4, 0xFE, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x3F, 0x8F,
-    0xE0, 0x00, 0xFE, 0x3F, 0xC0, 0x07, 0xF4, 0xFF, 0x80, 0x7F, 0xD2, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0x40, 0x0F, 0xF0, 0xBF, 0x40, 0xFE, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xF4, 0x2F, 0xE0, 0xBF,
-    0x40, 0x3F, 0xC3, 0xFC, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xF8, 0xFE, 0x00,
-    0x0F, 0xE3, 0xFC, 0x00, 0x7F, 0x4F, 0xF8, 0x07, 0xFD, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0x80, 0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x14, 0x05, 0x00,
-    0x03, 0xFC, 0x3C, 0x00, 0x1F, 0xF8, 0xF0, 0x00, 0xB9, 0xFF, 0xC0, 0x03, 0xE2, 0xFE, 0x00, 0x06,
-    0x41, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x03, 0xFD, 0x0B, 0xF8, 0x2F, 0xD0, 0x0F, 0xF0, 0xFF, 0x00, 0x1F,
-    0xD3, 0xF8, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xF8, 0xFF, 0x00, 0x1F, 0xD3,
-    0xFE, 0x01, 0xFF, 0x4B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFF, 0xF0, 0x00, 0x1B, 0xFD, 0x00, 0x01, 0x50, 0x15, 0x40, 0x2F, 0xD0, 0xBF, 0x40, 0xBF, 0x83,
-    0xFD, 0x03, 0xFF, 0x0F, 0xF8, 0x0F, 0xFC, 0x7F, 0xE0, 0x7F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xF4, 0x2F, 0xE0, 0xBF, 0x40, 0x3F, 0xC3, 0xFC, 0x00, 0x7F, 0x4F, 0xE0,
-    0x00, 0xFE, 0x3F, 0x80, 0x03, 0xF8, 0xFE, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x7F, 0x4F, 0xF8, 0x07,
-    0xFD, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0,
-    0x00, 0x6F, 0xF4, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x3F, 0xDF, 0xFF, 0x80, 0x2F, 0xD3, 0xFF, 0xF0, 0x0F,
-    0xF1, 0xFE, 0xFD, 0x03, 0xF8, 0xFF, 0x3F, 0x80, 0xFE, 0x3F, 0x8F, 0xE0, 0x3F, 0x9F, 0xD3, 0xF8,
-    0x0F, 0xFB, 0xF1, 0xFD, 0x03, 0xFF, 0xFD, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F, 0xD0,
-    0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0xFF, 0x4B, 0xE0, 0x03,
-    0xFD, 0x2F, 0xC0, 0x0F, 0xF4, 0xBF, 0x00, 0x3F, 0xD1, 0xFF, 0x43, 0xFF, 0x47, 0xFF, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xF0,
-    0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F, 0xD0, 0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD,
-    0x00, 0x2F, 0xC3, 0xF8, 0x00, 0xFF, 0x4B, 0xE0, 0x03, 0xFD, 0x2F, 0xC0, 0x0F, 0xF4, 0xBF, 0x00,
-    0x3F, 0xD1, 0xFF, 0x43, 0xFF, 0x47, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xC0, 0x02, 0xFD, 0x3F, 0xC0, 0x2F, 0xC0, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00,
-    0xBF, 0x0F, 0xC0, 0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0xBF,
-    0x0F, 0xE0, 0x03, 0xFD, 0x2F, 0x80, 0x0F, 0xF4, 0xBF, 0x00, 0x3F, 0xD2, 0xFC, 0x00, 0xFF, 0x47,
-    0xFD, 0x0F, 0xFD, 0x1F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0x80, 0xFF,
-    0xFF, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xF4, 0x2F, 0xD0, 0x2F, 0xE0, 0xFF, 0x40, 0xFF, 0xC3,
-    0xFE, 0x03, 0xFF, 0x0F, 0xF8, 0x0F, 0xFC, 0x7F, 0xF0, 0x15, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F,
-    0xC0, 0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0xBF, 0x0F, 0xE0,
-    0x03, 0xFD, 0x2F, 0x80, 0x0F, 0xF4, 0xBF, 0x00, 0x3F, 0xD2, 0xFC, 0x00, 0xFF, 0x47, 0xFD, 0x0F,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x1F, 0xE0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x7F,
-    0x40, 0x7F, 0xC0, 0x2F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x01, 0xFF, 0x03, 0xF8, 0x00, 0x3F, 0xE2,
-    0xFC, 0x00, 0x07, 0xFC, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x15, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xF4, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFE, 0x00, 0xBF,
-    0xFF, 0xC0, 0xBF, 0xBF, 0xF0, 0xBF, 0x0B, 0xF8, 0xBF, 0x02, 0xFD, 0xBF, 0x00, 0xFE, 0xBF, 0x00,
-    0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xFD, 0x7F, 0x02, 0xFC, 0x7F, 0x0B, 0xF8, 0x7F, 0x7F, 0xF0,
-    0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0x00, 0x7F, 0xE4, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x07, 0xF8, 0x00,
-    0x7F, 0xC1, 0xFE, 0x00, 0x1F, 0xF0, 0xBF, 0xC0, 0x0B, 0xFC, 0x3F, 0xF0, 0x03, 0xFF, 0x4F, 0xFC,
-    0x00, 0x55, 0x41, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0xBF, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x1F, 0xD0, 0x1F, 0xF0, 0x0B, 0xF0, 0x03,
-    0xFD, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0xFE, 0x00, 0x0F, 0xF8, 0xBF, 0x00, 0x01, 0xFF, 0x3F, 0xC0,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x05, 0x6F, 0xFC, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAA, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xAA, 0xA5, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0,
-    0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x00, 0x0F, 0xFE, 0xAA, 0xFF,
-    0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xC0, 0x00,
-    0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x55, 0x6A, 0x80, 0x3F, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xEA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x3F, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F, 0xC0, 0x7E, 0x00, 0xBF, 0x43, 0xF0, 0x00, 0xFD,
-    0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0xF4, 0x00, 0x2F, 0xC3, 0xD0, 0x00, 0xBF, 0x0F,
-    0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF,
-    0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x02, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B,
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03,
-    0xFD, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00,
-    0xFF, 0xEA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4,
-    0x1F, 0xFC, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x3F, 0x40, 0xBF, 0xEF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x01, 0xBF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40,
-    0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F, 0xC0, 0x7E, 0x00, 0xBF, 0x43,
-    0xF0, 0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0xF4, 0x00, 0x2F, 0xC3, 0xD0,
-    0x00, 0xBF, 0x0F, 0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00,
-    0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF0,
-    0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x58, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xD0, 0x7F, 0xC0, 0x07, 0xE0, 0x0B, 0xF4, 0x03, 0xF0, 0x00, 0xFD,
-    0x00, 0xFC, 0x00, 0x3F, 0x80, 0x3E, 0x00, 0x0F, 0xE0, 0x0F, 0x40, 0x02, 0xF8, 0x03, 0xD0, 0x00,
-    0xBF, 0x00, 0xF8, 0x00, 0x3F, 0xC0, 0x3F, 0xEA, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0x93, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFA, 0xFC, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x16, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1B, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x0B, 0xFF, 0xF4, 0x07,
-    0xFF, 0xFD, 0x03, 0xFD, 0x46, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F,
-    0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFF, 0xAE, 0x00,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFD, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x3F, 0xD3, 0xFC,
-    0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xAF, 0xC0, 0x3F, 0xFD,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x01, 0x6C, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFE, 0x0B, 0xF0, 0x3F,
-    0x40, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xD0, 0x0F, 0xF5, 0x18, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x1F, 0xFE, 0xB8, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0x90, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFA, 0xFC, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x16, 0xC1, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF4,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0x40, 0xFF, 0x51, 0x80, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0xEB, 0x80, 0x3F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x40, 0x1B,
-    0xFE, 0x40, 0x00, 0x54, 0x00, 0x05, 0x00, 0x0B, 0xF0, 0x07, 0xF0, 0x00, 0x2F, 0xD3, 0xFC, 0x00,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFA, 0xFC, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x16, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xC0, 0x2A, 0x00, 0x06, 0x91, 0xFD, 0x03, 0xF8, 0x07, 0xFE,
-    0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0xFF,
-    0xD0, 0x0F, 0xF5, 0x18, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0xB8,
-    0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0x90, 0x0A, 0x80, 0x02, 0xA4, 0x00,
-    0x0F, 0xE0, 0x7F, 0x80, 0x00, 0x0F, 0xFB, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x90, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xF8, 0x56,
-    0xFF, 0xFC, 0x3F, 0xE0, 0x00, 0x7F, 0xF4, 0xFF, 0x80, 0x00, 0x3F, 0xE3, 0xFE, 0x00, 0x00, 0x7F,
-    0xCF, 0xF8, 0x00, 0x00, 0xFF, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0x0B, 0xF3, 0xFE,
-    0x00, 0x00, 0x3F, 0xCF, 0xF8, 0x00, 0x00, 0xFF, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x16,
-    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00,
-    0x02, 0xFC, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0xFE, 0x00, 0x2F, 0xD2,
-    0xFC, 0xFE, 0x01, 0xFF, 0xFF, 0xFC, 0xA9, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFA, 0xFF, 0xFC,
-    0x00, 0x1F, 0xD0, 0x3F, 0xF8, 0x00, 0x3F, 0x80, 0x1F, 0xF8, 0x00, 0x3F, 0x40, 0x0F, 0xF8, 0x00,
-    0x3F, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xF4, 0x00, 0x3F,
-    0x80, 0x2F, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xE1, 0x5A, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x2F,
-    0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xE0,
-    0x00, 0x03, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x1F,
-    0xFC, 0x00, 0x3F, 0xE0, 0x05, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0x57, 0xFD, 0x54, 0x00, 0x2F, 0xD2, 0xFC, 0x00, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFA, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x3F,
-    0xF8, 0x00, 0x3F, 0x80, 0x1F, 0xF8, 0x00, 0x3F, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0x00, 0x0F, 0xF8,
-    0x00, 0x3F, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0x80, 0x2F, 0xF8, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x05, 0x5A, 0xAF, 0x80, 0x7F, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFD, 0x1F, 0xAA, 0xA9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xEA, 0x91, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFF, 0xAB, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFD, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0xFF, 0xEA, 0xAA, 0x93, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F,
-    0xEB, 0xFC, 0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x0B, 0xFF, 0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x00,
-    0x0A, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0xFF, 0xEF, 0xF8, 0x02, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xBF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xAA, 0x47, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF,
-    0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x03, 0xFF, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0x40,
-    0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xEB, 0xFC,
-    0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4F,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFF,
-    0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x00, 0x0A, 0xFF,
-    0x90, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xBF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xAA, 0x47, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFD, 0x02,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFF,
-    0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xEB, 0xFC, 0x03, 0xF8,
-    0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x50, 0x6D,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0x90, 0x2A,
-    0xAB, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFA, 0xA4, 0x7F, 0x80,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0xEA, 0xFD,
-    0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x3F, 0xEB, 0xFC, 0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x0B, 0xFF, 0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0x00, 0x0A, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x3F, 0x40, 0xBF, 0x47,
-    0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0xAB, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF,
-    0xFA, 0xA4, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0xBF, 0xEA, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40,
-    0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0xA4, 0xFF,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x05, 0x00, 0x01, 0x50, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0xC7, 0xF8, 0x00, 0x3F, 0xFF,
-    0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x3F, 0x80, 0x2F, 0x41, 0xFD, 0x15, 0x7F, 0x0B, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xF4, 0xFF, 0xFF, 0xFF, 0xD3, 0xFA, 0x54, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xBF, 0xF5, 0x06, 0xD0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xF0, 0x00,
-    0xAF, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF1, 0xFF, 0x00, 0x00, 0x0F, 0xE0,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0x90, 0x15, 0xA0, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x29, 0x40, 0x03, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFC, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xEB, 0xFF, 0x00, 0x00, 0x7F,
-    0xF9, 0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x3F, 0xFF, 0x94, 0x5B, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFD, 0x1F, 0xE0, 0x07, 0xF0,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD3, 0xF8, 0x02, 0xFF, 0xFB, 0xF8, 0x0B, 0xFF, 0xFF, 0xF8, 0x0F, 0xD1,
-    0xFF, 0xF8, 0x2F, 0x40, 0x3F, 0xF4, 0x3F, 0x00, 0x2F, 0xF4, 0x3E, 0x00, 0x1F, 0xF4, 0x3E, 0x00,
-    0x0F, 0xF4, 0x3E, 0x00, 0x0F, 0xF4, 0x3F, 0x00, 0x1F, 0xF4, 0x3F, 0x40, 0x7F, 0xF0, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xDB, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0x40, 0x7F, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFD, 0x00, 0x1A, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFA, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFE, 0x40,
-    0x56, 0x80, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xA5,
-    0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0xF3, 0xFF, 0x00, 0x0B, 0xFF, 0xFD, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xAF, 0xFC, 0x00, 0x01, 0xFF, 0xE7, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0xFF, 0xFE, 0x51, 0x6F,
-    0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x0B, 0xD0, 0x1F, 0xFA, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x3F, 0x80, 0xBF, 0xFE, 0xFE, 0x0B, 0xFF, 0xFF, 0xF8, 0x3F, 0x47, 0xFF,
-    0xE2, 0xF4, 0x03, 0xFF, 0x4F, 0xC0, 0x0B, 0xFD, 0x3E, 0x00, 0x1F, 0xF4, 0xF8, 0x00, 0x3F, 0xD3,
-    0xE0, 0x00, 0xFF, 0x4F, 0xC0, 0x07, 0xFD, 0x3F, 0x40, 0x7F, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x6F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0x40, 0x7F, 0xC0, 0x3F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xFF, 0x40, 0x1A, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFA, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFE, 0x40, 0x56, 0x80, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xA5, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xFF,
-    0xF3, 0xFF, 0x00, 0x0B, 0xFF, 0xFD, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xAF, 0xFC, 0x00, 0x01, 0xFF,
-    0xE7, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0xFF, 0xFE, 0x51, 0x6F, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x3F, 0x80,
-    0xBF, 0xFE, 0xFE, 0x0B, 0xFF, 0xFF, 0xF8, 0x3F, 0x47, 0xFF, 0xE2, 0xF4, 0x03, 0xFF, 0x4F, 0xC0,
-    0x0B, 0xFD, 0x3E, 0x00, 0x1F, 0xF4, 0xF8, 0x00, 0x3F, 0xD3, 0xE0, 0x00, 0xFF, 0x4F, 0xC0, 0x07,
-    0xFD, 0x3F, 0x40, 0x7F, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x6F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x0F,
-    0x40, 0x7F, 0xC0, 0x3F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x40, 0x1A, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0x90, 0x15, 0xA0,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x29, 0x40, 0x03,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xEB,
-    0xFF, 0x00, 0x00, 0x7F, 0xF9, 0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x3F, 0xFF, 0x94, 0x5B, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xFE, 0x02, 0xFF, 0xFB, 0xF8, 0x2F, 0xFF, 0xFF, 0xE0, 0xFD,
-    0x1F, 0xFF, 0x8B, 0xD0, 0x0F, 0xFD, 0x3F, 0x00, 0x2F, 0xF4, 0xF8, 0x00, 0x7F, 0xD3, 0xE0, 0x00,
-    0xFF, 0x4F, 0x80, 0x03, 0xFD, 0x3F, 0x00, 0x1F, 0xF4, 0xFD, 0x01, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xC0, 0x07, 0xFD, 0xBF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x3D, 0x01, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x07, 0xFF,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xFD, 0x00, 0x6B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x1F, 0xF0,
-    0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x3F, 0xD1, 0xFF, 0x00, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x03,
-    0xFE, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x3F, 0xE2, 0xFF, 0x00, 0x00, 0xFF, 0x8B,
-    0xFC, 0x00, 0x03, 0xFE, 0x2F, 0xF4, 0x00, 0x0F, 0xF8, 0xBF, 0xD0, 0x00, 0x7F, 0xF2, 0xFF, 0x95,
-    0x56, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0xFF,
-    0xE0, 0x00, 0xBF, 0xF3, 0xFF, 0x80, 0x02, 0xFF, 0xCF, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x00, 0x0F, 0xF4, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFE, 0x42, 0xFC, 0x00, 0x1F, 0xF0, 0x03, 0xF4, 0x00, 0x7F, 0x80,
-    0x0B, 0xE0, 0x02, 0xFD, 0x00, 0x2F, 0x80, 0x0B, 0xF4, 0x00, 0xBE, 0x00, 0x2F, 0xD0, 0x02, 0xF8,
-    0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x3F,
-    0xE0, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00,
-    0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0xEA, 0xAA, 0xBF, 0xF8, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xD0, 0x00, 0x7F, 0xE0, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0xBF, 0xE5, 0x55, 0xBF, 0xF0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0xF0,
-    0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0xF0, 0x0F, 0xFE, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x57, 0xFF, 0xD0, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF9,
-    0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0x90, 0xBF,
-    0x00, 0x07, 0xFC, 0x00, 0xFD, 0x00, 0x1F, 0xE0, 0x02, 0xF8, 0x00, 0xBF, 0x40, 0x0B, 0xE0, 0x02,
-    0xFD, 0x00, 0x2F, 0x80, 0x0B, 0xF4, 0x00, 0xBE, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0xFF, 0x40,
-    0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xF0, 0x0B, 0xFC,
-    0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x01, 0x40, 0x50, 0x3F, 0x87, 0xC2, 0xFF, 0x9F, 0x0F, 0xAF, 0xFC,
-    0x3E, 0x2F, 0xD0, 0x64, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0xBF,
-    0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07,
-    0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x1F, 0x83, 0xC3,
-    0xFE, 0x3D, 0x7E, 0xFB, 0xCB, 0xCB, 0xFC, 0x7C, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x05, 0x6A, 0xBF, 0x81, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xD3, 0xAA, 0xA9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x0B, 0xF8, 0x0B,
-    0xF8, 0x0B, 0xF8, 0x0B, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07,
-    0xF8, 0x07, 0xFC, 0x07, 0xFC, 0x07, 0xFC, 0x07, 0xFC, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFC, 0x0F,
-    0xFD, 0x0F, 0xFD, 0x0F, 0xFD, 0x0F, 0xD0, 0x2F, 0x40, 0x3F, 0x00, 0x3F, 0xF4, 0x2F, 0xF8, 0x06,
-    0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xF0, 0x2F, 0xF4, 0x2F, 0xF4, 0x15, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x0B, 0xE0, 0x0B, 0xE0, 0x0B, 0xE0, 0x0F,
-    0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
-    0xF4, 0x0B, 0xF0, 0x1F, 0xE0, 0x3F, 0x80, 0x7F, 0x00, 0x7F, 0xFC, 0x3F, 0xFC, 0x0B, 0xFC, 0x00,
-    0x10, 0x05, 0x40, 0x7F, 0x82, 0xFF, 0x0F, 0xFC, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x2F, 0xE0, 0xBF, 0x82, 0xFE, 0x0B, 0xF8, 0x1F, 0xE0, 0x7F,
-    0x81, 0xFE, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x81, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC2, 0xFF,
-    0x0B, 0xFC, 0x2F, 0xF0, 0xFF, 0xD3, 0xFF, 0x4F, 0xFD, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x2F,
-    0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFD, 0x7F, 0xC0,
-    0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x07, 0xFD, 0x3F, 0xC0, 0x00,
-    0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x0B,
-    0xFC, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x0F, 0xF8,
-    0x3F, 0xC0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x3F,
-    0xD0, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF0, 0x3F, 0xE0,
-    0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x7F, 0xF0, 0x00, 0x2F, 0xF0, 0x7F, 0xF0, 0x00,
-    0x2F, 0xE0, 0x7F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x0E, 0x40, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
-    0x06, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x1F,
-    0xC3, 0xFC, 0x00, 0x7F, 0x1F, 0xF0, 0x02, 0xFC, 0xBF, 0xD0, 0x0F, 0xF2, 0xFF, 0x40, 0x00, 0x05,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC2, 0xF8,
-    0x00, 0xBF, 0x0B, 0xE0, 0x02, 0xFC, 0x2F, 0x80, 0x0B, 0xE0, 0xBE, 0x00, 0x2F, 0x83, 0xF8, 0x00,
-    0xBE, 0x0F, 0xE0, 0x02, 0xF8, 0x3F, 0x80, 0x0F, 0xD0, 0xFE, 0x00, 0x3F, 0x43, 0xF8, 0x00, 0xFD,
-    0x0F, 0xF0, 0x03, 0xF4, 0x3F, 0xC0, 0x0F, 0xC0, 0xFF, 0x00, 0x3F, 0x03, 0xFC, 0x00, 0xFC, 0x0F,
-    0xF4, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x2F, 0xD1, 0xFE, 0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x03, 0xE4, 0x7F, 0xF4, 0x01, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x01, 0xAF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x01, 0xFE, 0x0F, 0xF0, 0x7F, 0x40, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0x42, 0xFF, 0x80, 0x03,
-    0xFC, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0xBF, 0xD0, 0x00, 0x3F, 0xC7, 0xFE, 0x00, 0x01, 0xFF, 0x3F,
-    0xF0, 0x00, 0x07, 0xF9, 0xFF, 0x80, 0x00, 0x1F, 0xEF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0x00, 0x01, 0xFF, 0x3F, 0xFF, 0x00, 0x0B, 0xFC, 0x7F, 0xFF, 0x40, 0x2F, 0xF0, 0x7F, 0xFF, 0x40,
-    0xFF, 0xC0, 0xBF, 0xFF, 0x83, 0xFF, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC3, 0xFD, 0x00, 0x1F, 0xCF,
-    0xF4, 0x00, 0x1F, 0xEF, 0xE0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xDF,
-    0xFE, 0x00, 0x3F, 0xCB, 0xFF, 0xC0, 0x3F, 0xC2, 0xFF, 0xF0, 0x3F, 0xC0, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0A, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x47, 0xE0, 0x0F, 0x4F, 0xC0, 0x1F, 0x2F, 0x80, 0x1F, 0x7F,
-    0x00, 0x2F, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00,
-    0x3F, 0xFF, 0x00, 0x3E, 0x7F, 0xC0, 0x7E, 0x2F, 0xF0, 0x7E, 0x0F, 0xFD, 0x03, 0xE0, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x2F, 0xFB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x07, 0xE0,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x0F, 0xD0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00,
-    0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03,
-    0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x94, 0x0F, 0xFF, 0x83, 0xFF, 0xF0, 0xFF, 0xFC, 0x0F, 0xFE, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xAA,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x07,
-    0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0,
-    0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00,
-    0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x50, 0x0F, 0xFF, 0x80, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA9, 0x00, 0xFF, 0xE0,
-    0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0xBF,
-    0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x1F, 0xC0, 0xFF, 0x00, 0x7F, 0x03, 0xFC, 0x02, 0xFC, 0x0F, 0xF0, 0x0B, 0xF0,
-    0x7F, 0xC0, 0x3F, 0xC1, 0xFF, 0x00, 0xFE, 0x07, 0xFC, 0x02, 0xA4, 0x1F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xEF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x0F, 0xD0, 0xFE,
-    0x0F, 0xD0, 0xFD, 0x1F, 0xC1, 0xFD, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x2F,
-    0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80,
-    0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00,
-    0x3F, 0x94, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xF4, 0x3F, 0xC0, 0x3F, 0xD0, 0xFF,
-    0x00, 0xFF, 0x83, 0xFC, 0x03, 0xFE, 0x0F, 0xF0, 0x1F, 0xFC, 0x7F, 0xC0, 0x15, 0x51, 0xFF, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF,
-    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xD0, 0x00, 0x0F, 0xD0,
-    0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC1, 0x54, 0x2F, 0xC3, 0xFC, 0x2F, 0xC3, 0xFD,
-    0x2F, 0xC3, 0xFD, 0x2F, 0xC7, 0xFE, 0x3F, 0xCB, 0xFE, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F,
-    0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x94,
-    0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xBF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xF3, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0x7E, 0x40, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x4F, 0xE0, 0x00,
-    0x06, 0x90, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x50, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xF4, 0x00, 0x0F, 0xF1, 0xFF, 0xC0, 0x01, 0xFE, 0x1F, 0xFD,
-    0x00, 0x1F, 0xE2, 0xFF, 0xF0, 0x01, 0xFE, 0x2F, 0xFF, 0x40, 0x2F, 0xE2, 0xFF, 0xFC, 0x02, 0xFD,
-    0x3F, 0xFF, 0xD0, 0x2F, 0xD3, 0xFF, 0xFF, 0x03, 0xFD, 0x3F, 0xFF, 0xF4, 0x3F, 0xD3, 0xFF, 0x7F,
-    0xC3, 0xFD, 0x3F, 0xF3, 0xFD, 0x3F, 0xC3, 0xFF, 0x2F, 0xE3, 0xFC, 0x7F, 0xF0, 0xFF, 0x7F, 0xC7,
-    0xFF, 0x0B, 0xFF, 0xFC, 0x7F, 0xF0, 0x7F, 0xFF, 0xCB, 0xFF, 0x03, 0xFF, 0xFC, 0xBF, 0xF0, 0x1F,
-    0xFF, 0xCB, 0xFF, 0x00, 0xFF, 0xFC, 0xFF, 0xF0, 0x0B, 0xFF, 0xCF, 0xFF, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x90, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xE4, 0x7F, 0xC1, 0xFE, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0xFC, 0x2F, 0xC0, 0x03, 0xF4, 0xBF,
-    0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x7F, 0x8F, 0xF4, 0x01, 0xFE, 0x3F, 0xD0, 0x0B, 0xF8, 0xFF, 0x40,
-    0x2F, 0xE3, 0xFE, 0x00, 0xBF, 0xCF, 0xF8, 0x03, 0xFF, 0x3F, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xF1, 0xFF, 0x40, 0x00, 0xFF, 0x1F, 0xFC, 0x00, 0x1F, 0xE1, 0xFF, 0xD0, 0x01, 0xFE, 0x2F,
-    0xFF, 0x00, 0x1F, 0xE2, 0xFF, 0xF4, 0x02, 0xFE, 0x2F, 0xFF, 0xC0, 0x2F, 0xD3, 0xFF, 0xFD, 0x02,
-    0xFD, 0x3F, 0xFF, 0xF0, 0x3F, 0xD3, 0xFF, 0xFF, 0x43, 0xFD, 0x3F, 0xF7, 0xFC, 0x3F, 0xD3, 0xFF,
-    0x3F, 0xD3, 0xFC, 0x3F, 0xF2, 0xFE, 0x3F, 0xC7, 0xFF, 0x0F, 0xF7, 0xFC, 0x7F, 0xF0, 0xBF, 0xFF,
-    0xC7, 0xFF, 0x07, 0xFF, 0xFC, 0xBF, 0xF0, 0x3F, 0xFF, 0xCB, 0xFF, 0x01, 0xFF, 0xFC, 0xBF, 0xF0,
-    0x0F, 0xFF, 0xCF, 0xFF, 0x00, 0xBF, 0xFC, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xE4,
-    0x00, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF4, 0x1F, 0xF9, 0x1F, 0xF0, 0x7F, 0x80, 0x1F, 0xC1,
-    0xFC, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0xFD, 0x2F, 0xC0, 0x03, 0xF4, 0xBF, 0x00, 0x1F, 0xE3, 0xFD,
-    0x00, 0x7F, 0x8F, 0xF4, 0x02, 0xFE, 0x3F, 0xD0, 0x0B, 0xF8, 0xFF, 0x80, 0x2F, 0xF3, 0xFE, 0x00,
-    0xFF, 0xCF, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x54, 0x00, 0x15, 0x00,
-    0x0B, 0xF0, 0x1F, 0xD0, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x1F, 0xF4, 0x00, 0x0F, 0xF1, 0xFF, 0xC0, 0x01, 0xFE, 0x1F, 0xFD, 0x00, 0x1F, 0xE2, 0xFF,
-    0xF0, 0x01, 0xFE, 0x2F, 0xFF, 0x40, 0x2F, 0xE2, 0xFF, 0xFC, 0x02, 0xFD, 0x3F, 0xFF, 0xD0, 0x2F,
-    0xD3, 0xFF, 0xFF, 0x03, 0xFD, 0x3F, 0xFF, 0xF4, 0x3F, 0xD3, 0xFF, 0x7F, 0xC3, 0xFD, 0x3F, 0xF3,
-    0xFD, 0x3F, 0xC3, 0xFF, 0x2F, 0xE3, 0xFC, 0x7F, 0xF0, 0xFF, 0x7F, 0xC7, 0xFF, 0x0B, 0xFF, 0xFC,
-    0x7F, 0xF0, 0x7F, 0xFF, 0xCB, 0xFF, 0x03, 0xFF, 0xFC, 0xBF, 0xF0, 0x1F, 0xFF, 0xCB, 0xFF, 0x00,
-    0xFF, 0xFC, 0xFF, 0xF0, 0x0B, 0xFF, 0xCF, 0xFF, 0x00, 0x3F, 0xF8, 0x06, 0xA0, 0x00, 0xA8, 0x02,
-    0xFD, 0x0B, 0xF4, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xF9, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xF9, 0x1F, 0xF0, 0x1F, 0xE0, 0x07, 0xF0, 0x1F,
-    0xC0, 0x03, 0xF0, 0x2F, 0xC0, 0x03, 0xF4, 0x2F, 0xC0, 0x03, 0xF4, 0x2F, 0xC0, 0x07, 0xF8, 0x3F,
-    0xD0, 0x07, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x3F, 0xE0, 0x0B, 0xFC, 0x3F,
-    0xE0, 0x0F, 0xFC, 0x3F, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF2, 0xFE, 0x40, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x41, 0xFF, 0x91, 0xFF, 0x07,
-    0xF8, 0x01, 0xFC, 0x1F, 0xC0, 0x03, 0xF0, 0xBF, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x3F, 0x4B, 0xF0,
-    0x01, 0xFE, 0x3F, 0xD0, 0x07, 0xF8, 0xFF, 0x40, 0x2F, 0xE3, 0xFD, 0x00, 0xBF, 0x8F, 0xF8, 0x02,
-    0xFF, 0x3F, 0xE0, 0x0F, 0xFC, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFF, 0x40,
-    0x00, 0xFF, 0x1F, 0xFC, 0x00, 0x1F, 0xE1, 0xFF, 0xD0, 0x01, 0xFE, 0x2F, 0xFF, 0x00, 0x1F, 0xE2,
-    0xFF, 0xF4, 0x02, 0xFE, 0x2F, 0xFF, 0xC0, 0x2F, 0xD3, 0xFF, 0xFD, 0x02, 0xFD, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xD3, 0xFF, 0xFF, 0x43, 0xFD, 0x3F, 0xF7, 0xFC, 0x3F, 0xD3, 0xFF, 0x3F, 0xD3, 0xFC, 0x3F,
-    0xF2, 0xFE, 0x3F, 0xC7, 0xFF, 0x0F, 0xF7, 0xFC, 0x7F, 0xF0, 0xBF, 0xFF, 0xC7, 0xFF, 0x07, 0xFF,
-    0xFC, 0xBF, 0xF0, 0x3F, 0xFF, 0xCB, 0xFF, 0x01, 0xFF, 0xFC, 0xBF, 0xF0, 0x0F, 0xFF, 0xCF, 0xFF,
-    0x00, 0xBF, 0xFC, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x57, 0xFF,
-    0x80, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xE4, 0x00, 0xFF, 0xFF, 0xF8, 0x07, 0xFF,
-    0xFF, 0xF4, 0x1F, 0xF9, 0x1F, 0xF0, 0x7F, 0x80, 0x1F, 0xC1, 0xFC, 0x00, 0x3F, 0x0B, 0xF0, 0x00,
-    0xFD, 0x2F, 0xC0, 0x03, 0xF4, 0xBF, 0x00, 0x1F, 0xE3, 0xFD, 0x00, 0x7F, 0x8F, 0xF4, 0x02, 0xFE,
-    0x3F, 0xD0, 0x0B, 0xF8, 0xFF, 0x80, 0x2F, 0xF3, 0xFE, 0x00, 0xFF, 0xCF, 0xF8, 0x03, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x01, 0x7F, 0xE0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x15, 0xAA, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x07, 0xAA, 0xA5, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x9B, 0xFF,
-    0xC0, 0x0F, 0xFD, 0x00, 0x2F, 0xF8, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F,
-    0xD1, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x7F,
-    0xCF, 0xF8, 0x00, 0x00, 0x0F, 0xF3, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xCF, 0xFC, 0x00, 0x00, 0x2F, 0xF2, 0xFF, 0x80, 0x00, 0x1F, 0xFC,
-    0xBF, 0xFE, 0x51, 0x7F, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xAA,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xF8, 0x2A, 0xAA, 0x55, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xF4, 0x2F, 0xE0, 0xBF, 0x40, 0x3F, 0xC3, 0xFC,
-    0x00, 0x7F, 0x4F, 0xE0, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xF8, 0xFE, 0x00, 0x0F, 0xE3, 0xFC, 0x00,
-    0x7F, 0x4F, 0xF8, 0x07, 0xFD, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x2F, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xE6, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x0B,
-    0xFE, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x7F, 0xC0, 0x00, 0x03,
-    0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x1F, 0xF3, 0xFE, 0x00, 0x00, 0x03,
-    0xFC, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x00, 0x1F,
-    0xF3, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x2F, 0xFF, 0x94, 0x5F, 0xFF,
-    0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0xBF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xF4, 0x2F, 0xE0, 0xBF, 0x40, 0x3F, 0xC3, 0xFC, 0x00, 0x7F, 0x4F, 0xE0,
-    0x00, 0xFE, 0x3F, 0x80, 0x03, 0xF8, 0xFE, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x7F, 0x4F, 0xF8, 0x07,
-    0xFD, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0,
-    0x00, 0x6F, 0xF4, 0x00, 0x00, 0x01, 0x54, 0x00, 0x05, 0x50, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40,
-    0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF9, 0xBF, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0xBF,
-    0xC0, 0x00, 0x3F, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-    0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x0F,
-    0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x00,
-    0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0xBF, 0xFE,
-    0x51, 0x7F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x05, 0x40, 0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00,
-    0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x02, 0xFD,
-    0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x3F,
-    0x80, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0x03,
-    0xFE, 0x01, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xD1, 0x55, 0x5A, 0xAA, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0x9B, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFD, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xEB, 0xF4, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x03,
-    0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xE0,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xA6, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xEA, 0xAA, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x01, 0xBF, 0x80, 0x00, 0x1F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xEA,
-    0xFC, 0x00, 0xFF, 0x42, 0xFF, 0xF0, 0x07, 0xE0, 0x2F, 0xD0, 0x0F, 0xFE, 0x15, 0x7F, 0x03, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC3, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x3F, 0x80, 0x03, 0xFE, 0x55, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F,
-    0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x42, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0xB8, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x80,
-    0x02, 0xFF, 0x40, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x0B, 0xE0, 0x0F, 0xE0, 0x02,
-    0xFC, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x2F, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFD, 0x1F, 0xF4, 0x0B, 0xFD, 0x01, 0xFF, 0x02, 0xFF, 0x80, 0x7F, 0xD0, 0xBF, 0xE0, 0x1F, 0xF8,
-    0x2F, 0xF8, 0x07, 0xFF, 0x0F, 0xFE, 0x01, 0xFF, 0xD3, 0xFF, 0xC0, 0x7F, 0xF8, 0xFF, 0xF0, 0x1F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF6, 0xF8, 0x0F, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xA8, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F,
-    0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0x80, 0x1F, 0xD0,
-    0x0F, 0xE0, 0x02, 0xF8, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x0F,
-    0xF0, 0x0F, 0xE0, 0x0B, 0xF8, 0x03, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF,
-    0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0x47, 0xFD, 0x02, 0xFF, 0x40, 0x7F, 0xC0, 0xBF,
-    0xE0, 0x1F, 0xF4, 0x2F, 0xF8, 0x07, 0xFE, 0x0B, 0xFE, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x7F, 0xF4,
-    0xFF, 0xF0, 0x1F, 0xFE, 0x3F, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x3F,
-    0xF4, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF6, 0xF8, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xA8, 0x0F, 0xF4, 0x00,
-    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F,
-    0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x69, 0x00,
-    0x0A, 0x80, 0x0B, 0xF0, 0x1F, 0xD0, 0x00, 0xBF, 0x6F, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xE0, 0x07, 0xF4, 0x03, 0xF8, 0x00, 0xBE, 0x00, 0xFE, 0x00,
-    0x2F, 0xC0, 0x3F, 0x80, 0x0B, 0xF0, 0x0F, 0xE0, 0x03, 0xFC, 0x03, 0xF8, 0x02, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xD1, 0xFF, 0x40, 0xBF, 0xD0, 0x1F, 0xF0, 0x2F, 0xF8, 0x07, 0xFD, 0x0B, 0xFE, 0x01, 0xFF,
-    0x82, 0xFF, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x1F, 0xFD, 0x3F, 0xFC, 0x07, 0xFF, 0x8F, 0xFF, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x05, 0x42, 0xFC, 0x02, 0xFC, 0x0B, 0xF5, 0xFF,
-    0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF6, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFA, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFA, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x10, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xE0, 0x00, 0x2F,
-    0xF8, 0x3F, 0xFD, 0x46, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0x80,
-    0x0F, 0xD5, 0x6C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x01, 0x00,
-    0x2F, 0xE0, 0x3E, 0x40, 0xFF, 0x82, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0x00, 0x1A, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00,
-    0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xEB, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xE4, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x0F,
-    0x80, 0x00, 0xBF, 0xE0, 0xFF, 0xF5, 0x1B, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xFD, 0x56, 0xC0, 0x03, 0xE0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x10, 0x02, 0xFE, 0x03, 0xE4, 0x0F, 0xF8, 0x2F,
-    0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0x01, 0xAF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFA, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x10, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF9,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x40, 0x00, 0x0B, 0xFE, 0x07, 0xE0,
-    0x00, 0x2F, 0xF8, 0x3F, 0xFD, 0x46, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x06, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x67, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0xFD, 0x56, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0x40, 0x10, 0x02, 0xFE, 0x03, 0xE4, 0x0F, 0xF8, 0x2F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xF9, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x01, 0x0F, 0x80, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xA9, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x55, 0x00, 0x07, 0xF4, 0x0B, 0xF0, 0x00, 0x07, 0xF9, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xAF, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F,
-    0xFF, 0xAF, 0xD0, 0x00, 0xBF, 0xD0, 0x01, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00,
-    0x06, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3E, 0x00, 0x02,
-    0xFF, 0x83, 0xFF, 0xD4, 0x6F, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x47,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80,
-    0x02, 0xA4, 0x1F, 0xD0, 0x7F, 0x80, 0x1F, 0xFB, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xF9, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xFD, 0x56, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x10, 0x02, 0xFE, 0x03, 0xE4, 0x0F, 0xF8, 0x2F, 0xFF, 0xFF,
-    0xD2, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0x01, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x3D, 0x00, 0x00, 0x00, 0x2A, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF4, 0x02, 0xFF, 0xFE, 0x00, 0xB8, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xAF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x0B, 0xFF,
-    0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x02, 0x40, 0x3F, 0x40, 0x0F, 0xD0, 0x1F,
-    0xD0, 0x07, 0xF4, 0x06, 0xA0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55,
-    0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x01, 0x40, 0x00, 0x03, 0xFC, 0x3D, 0x00, 0x00, 0x3F, 0xF3, 0xD0, 0x00, 0x07, 0xCF,
-    0xFC, 0x00, 0x00, 0xBC, 0x7F, 0xC0, 0x00, 0x02, 0x80, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF,
-    0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x0B,
-    0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC,
-    0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xCB, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0xBF,
-    0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0xAF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0F, 0x00, 0x03, 0xFD, 0x3C, 0x00, 0x2F, 0xBE, 0xF0,
-    0x00, 0xB8, 0xFF, 0xC0, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F, 0xC0,
-    0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0xBF, 0x0F, 0xE0, 0x03,
-    0xFD, 0x2F, 0x80, 0x0F, 0xF4, 0xBF, 0x00, 0x3F, 0xD2, 0xFC, 0x00, 0xFF, 0x47, 0xFD, 0x0F, 0xFD,
-    0x1F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x01, 0x56, 0xA0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xEA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00,
-    0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0xBF, 0xDB,
-    0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00,
-    0x7F, 0xDB, 0xFC, 0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x0B, 0xFC, 0x7F,
-    0xE0, 0x00, 0xFF, 0xC7, 0xFF, 0xFA, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F, 0xC0, 0x02, 0xFC,
-    0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0xBF, 0x0F, 0xE0, 0x03, 0xFD, 0x2F,
-    0x80, 0x0F, 0xF4, 0xBF, 0x00, 0x3F, 0xD2, 0xFC, 0x00, 0xFF, 0x47, 0xFD, 0x0F, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xE0,
-    0x00, 0x02, 0xF8, 0x02, 0xF4, 0x00, 0x1F, 0xFA, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFC, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE,
-    0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00,
-    0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB,
-    0xFC, 0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00,
-    0xFF, 0xC7, 0xFF, 0xFA, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF9, 0x4B, 0xD0, 0x2F, 0xC0, 0x7F, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xC0,
-    0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F, 0xC0, 0x02, 0xFC, 0x3F, 0x40,
-    0x0B, 0xF0, 0xFD, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0xBF, 0x0F, 0xE0, 0x03, 0xFD, 0x2F, 0x80, 0x0F,
-    0xF4, 0xBF, 0x00, 0x3F, 0xD2, 0xFC, 0x00, 0xFF, 0x47, 0xFD, 0x0F, 0xFD, 0x1F, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0x3D, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0xFF, 0xD0,
-    0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE,
-    0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00,
-    0x07, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC, 0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x7F, 0xC7,
-    0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFF, 0xFA, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x07, 0xDF, 0x00, 0x00, 0x1F, 0x3D, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x3F, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0xBF,
-    0x0F, 0xD0, 0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFE, 0x00, 0x3F, 0xD2, 0xF8, 0x00, 0xFF, 0x4B,
-    0xF0, 0x03, 0xFD, 0x2F, 0xC0, 0x0F, 0xF4, 0x7F, 0xD0, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0x43, 0xFF,
-    0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x2F, 0xD0, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0xBF,
-    0xC0, 0x02, 0xFF, 0x40, 0x15, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0x80,
-    0x3F, 0xF4, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x2F, 0xF8,
-    0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x00, 0x02, 0xFF,
-    0x40, 0x2F, 0xF0, 0x00, 0x1F, 0xF4, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x1F,
-    0xF0, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x80, 0x03,
-    0xFF, 0x00, 0x1F, 0xFF, 0xEB, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x05, 0x40, 0x01,
-    0xFE, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xC0, 0x1F,
-    0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0x80, 0x0F, 0xF4,
-    0x00, 0x02, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xC0, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x43, 0xFF,
-    0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF,
-    0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x0B,
-    0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC,
-    0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0xFF,
-    0xC7, 0xFF, 0xFA, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xF0, 0xFC,
-    0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F, 0xD0, 0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00,
-    0x2F, 0xC3, 0xF8, 0x00, 0xFF, 0x4F, 0xE0, 0x03, 0xFD, 0x2F, 0x80, 0x0F, 0xF4, 0xBF, 0x00, 0x3F,
-    0xD2, 0xFD, 0x01, 0xFF, 0x47, 0xFF, 0xAF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFB, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xF4, 0x00, 0x55, 0x00,
-    0x2F, 0xF0, 0x2F, 0xF8, 0x00, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x02, 0xFF, 0x40, 0x3F, 0xE0,
-    0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x7F, 0xD0, 0x0F, 0xFD, 0x0B, 0xFF, 0xD0, 0xBF, 0xC0, 0x0B, 0xFE,
-    0x0F, 0xFF, 0xF0, 0xFF, 0xC0, 0x07, 0xFF, 0x2F, 0xFF, 0xF4, 0xFF, 0x80, 0x07, 0xFF, 0x7F, 0xFF,
-    0xFD, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x82, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-    0x00, 0x0B, 0xF4, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x8B,
-    0xF4, 0x00, 0x00, 0x3F, 0xD1, 0xFE, 0x01, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x07, 0xF8, 0x0F,
-    0xF4, 0xBF, 0xD2, 0xFD, 0x01, 0xFE, 0x7F, 0xFC, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xBF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xBF, 0xFF, 0x00, 0x03, 0xFF, 0xC7, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0xFF, 0xD0, 0x00, 0x1F,
-    0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0x87, 0xF8,
-    0x00, 0x03, 0xF4, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0xFF, 0x40, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x03, 0xFE,
-    0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F,
-    0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE2, 0xFF, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x1F, 0xD1, 0xFE, 0x00,
-    0x2F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x2F, 0xC1, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xFC, 0x02, 0xFC, 0x00, 0xFF,
-    0x40, 0xFF, 0x00, 0x1F, 0xF0, 0x3F, 0x80, 0x03, 0xFE, 0x2F, 0xC0, 0x00, 0x7F, 0xCF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x01, 0x5B, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x1F, 0xF0,
-    0x00, 0x1F, 0xF0, 0xBF, 0xC0, 0x00, 0xBF, 0xD2, 0xFF, 0x00, 0x02, 0xFF, 0x4F, 0xFD, 0x00, 0x05,
-    0x55, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0xFF, 0x40, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x03, 0xFE, 0x07, 0xFD,
-    0x00, 0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x3F,
-    0xE0, 0x00, 0x7F, 0xE2, 0xFF, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xAB, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x1F, 0xFF, 0xAA, 0x80, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xAB, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
-    0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x1F, 0xFF, 0xAA, 0x80, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x47, 0xF4, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xAB, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF,
-    0xF5, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xE0, 0x01, 0xF8,
-    0x02, 0xFC, 0x0B, 0xF0, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xAA, 0x80, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x55, 0x00, 0x3F, 0xFD, 0x0F, 0xFF, 0xD1, 0xFF, 0xFD, 0x1F, 0xF4,
-    0x02, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD,
-    0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x6F, 0xF9, 0x00, 0x7E, 0x00,
-    0x7F, 0xFF, 0xFE, 0x0B, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xE6, 0xFF, 0xFF, 0x40,
-    0xFF, 0xD0, 0x02, 0xFF, 0xD0, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0,
-    0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x0F,
-    0xF4, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xE0, 0x00, 0x07,
-    0xFF, 0x0B, 0xFF, 0xE5, 0x17, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x29, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x02, 0xFF, 0x41, 0xF8, 0x0B, 0xFF, 0xFC, 0x7D, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0x82, 0xFD, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0x1F, 0xD0,
-    0x3F, 0x80, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x1F,
-    0xD0, 0x3F, 0xE0, 0x1F, 0xF4, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xF0, 0x07, 0xFC, 0x3F, 0xEF, 0xF0, 0x00, 0xFD, 0x3F, 0x4F, 0xF0, 0x00, 0xFE, 0x3F, 0x0F,
-    0xF0, 0x01, 0xFF, 0x3F, 0x0F, 0xF5, 0x6B, 0xFE, 0x1F, 0x1F, 0xFF, 0xFF, 0xFD, 0x0F, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x03, 0x1F, 0xFF, 0xFF, 0xF0, 0x01, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF9,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xF9, 0x04, 0x00, 0x02, 0xFD,
-    0xBF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x9B, 0xF4, 0x0B, 0xFF, 0x40, 0x3F, 0x02,
-    0xFF, 0xC0, 0x0B, 0xC0, 0xBF, 0xE0, 0x01, 0xF4, 0x2F, 0xF8, 0x00, 0x7D, 0x0B, 0xFE, 0x00, 0x1F,
-    0x82, 0xFF, 0xC0, 0x0B, 0xD0, 0xBF, 0xF9, 0x07, 0xF4, 0x2F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xC1, 0xA9, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xEB, 0xFF,
-    0xFF, 0xFA, 0xFF, 0xFF, 0xFE, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xAF,
-    0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFE, 0x05, 0x55, 0x55, 0x55, 0x55, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x47, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xE4, 0x00, 0x0F, 0xD0,
-    0x00, 0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF4, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x3F, 0xF4, 0x00, 0x3F, 0xFF, 0x4F, 0xFD, 0x00, 0x0F, 0xFF, 0x83,
-    0xFF, 0x40, 0x02, 0xFF, 0x80, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x3F, 0xF4, 0x00, 0x2F, 0xF8, 0x0F,
-    0xFD, 0x00, 0x0B, 0xFE, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0xBF, 0xD0, 0x2F,
-    0xF0, 0x00, 0x2F, 0xF4, 0x0B, 0xFC, 0x00, 0x07, 0xFD, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0xBF,
-    0xC0, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x01, 0xFF,
-    0x80, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0xAF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x80, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x0B, 0xFF, 0x83,
-    0xF0, 0x00, 0xBF, 0xF0, 0x3F, 0x00, 0x0B, 0xFD, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x0B,
-    0xF0, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x0F, 0xF4, 0x02, 0xF8, 0x00, 0xFF, 0x40, 0x2F,
-    0xC0, 0x0F, 0xF4, 0x02, 0xFC, 0x00, 0xFF, 0x40, 0x1F, 0xF4, 0x3F, 0xF4, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0xFD, 0x03, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xF1, 0xFE,
-    0x03, 0xF8, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x43, 0xFC, 0x3D, 0x7F, 0xF3, 0xDB,
-    0xCF, 0xFC, 0xBC, 0x7F, 0xC6, 0x81, 0xA0, 0x05, 0xAA, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF,
-    0xFF, 0xCA, 0xAA, 0x95, 0x54, 0x00, 0x00, 0x15, 0x56, 0x40, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE2, 0xAA, 0xAA, 0x95, 0x55, 0x2F, 0xE5, 0x2F, 0x4B, 0xF0, 0x0F, 0xC1, 0xFF, 0xFF,
-    0xF0, 0x2F, 0xFF, 0xF0, 0x01, 0xBF, 0xD0, 0x00, 0x05, 0x40, 0x7F, 0x82, 0xFE, 0x0F, 0xFC, 0x3F,
-    0xF0, 0xFF, 0xC0, 0x3F, 0x83, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F,
-    0xC7, 0xFC, 0x3E, 0x0F, 0xE0, 0x38, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xFF, 0x2F,
-    0x7C, 0xBF, 0xF0, 0xFF, 0x80, 0xA4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x05, 0x40, 0x01, 0xFF, 0x00,
-    0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x0F,
-    0xF1, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x2F,
-    0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xD0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0xA0, 0xBF, 0xF4, 0x3F, 0xF0, 0x3F, 0xF0, 0x2F, 0xF4, 0x1F, 0xF8, 0x0F, 0xFC,
-    0x0F, 0xFD, 0x0B, 0xFF, 0x0B, 0xFF, 0x42, 0xFF, 0xC0, 0xBF, 0xE0, 0x2F, 0xF4, 0x0F, 0xFC, 0x03,
-    0xFF, 0x02, 0xFF, 0x80, 0xFF, 0xD0, 0x2A, 0xA0, 0x00, 0x7F, 0xF8, 0x0F, 0xFE, 0x02, 0xFF, 0x80,
-    0x7F, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0xBF, 0xE0, 0x1F, 0xFC, 0x02, 0xAA, 0x00, 0x01, 0x40,
-    0x7D, 0x6F, 0xDB, 0xFD, 0xBF, 0xD0, 0x7D, 0x07, 0xD0, 0x54, 0x0B, 0xC0, 0xBE, 0x9B, 0xFD, 0xBF,
-    0xDB, 0xC0, 0xBC, 0x00, 0xBF, 0xA9, 0x50, 0xBF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x00, 0x01, 0xFC,
-    0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x07,
-    0xD0, 0xFC, 0x3F, 0xC3, 0xF0, 0x2C, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0xBC, 0xBE, 0x3F, 0x1F, 0x00,
-    0x01, 0x40, 0x3F, 0x00, 0xFC, 0x2F, 0xFE, 0xBF, 0xFA, 0xFF, 0xE0, 0xBF, 0xFA, 0xFF, 0xEB, 0xFF,
-    0x83, 0xF0, 0x0F, 0xC0, 0x15, 0x00, 0x03, 0x00, 0x30, 0x7F, 0xF1, 0x75, 0x03, 0x00, 0x00, 0x05,
-    0x6A, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0x0A, 0xAA, 0x95, 0x54, 0x1F, 0xD0,
-    0xBF, 0x83, 0xFE, 0x0F, 0xFC, 0x3F, 0xF0, 0x55, 0x40, 0x3F, 0x83, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F,
-    0xC3, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x00, 0x00, 0x7E, 0x07, 0xFF, 0x2F, 0x7C, 0xBF,
-    0xF0, 0xFF, 0x80, 0xA4, 0x00, 0x1F, 0xFE, 0x1F, 0xFD, 0x0F, 0xFC, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F,
-    0xF0, 0x3F, 0xF0, 0xBF, 0xE0, 0x6A, 0x80, 0x2E, 0x00, 0xF4, 0x03, 0xF8, 0x2F, 0xF8, 0x52, 0xF1,
-    0xFF, 0x8B, 0xFC, 0x1A, 0x40, 0x00, 0x50, 0x03, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x7F, 0x00, 0x7F,
-    0xFC, 0x3F, 0xFC, 0x0B, 0xFC, 0x00, 0x10, 0x00, 0x1F, 0xD7, 0xF6, 0xFD, 0xBF, 0x6F, 0xDF, 0xF7,
-    0xFD, 0xFF, 0x40, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x4F, 0xD1, 0xFD, 0x3F, 0x03,
-    0xF4, 0xFC, 0x0F, 0xD0, 0x3F, 0x80, 0x03, 0xFC, 0x0F, 0xF4, 0x1F, 0xF0, 0x03, 0xFE, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFE, 0xFF, 0x80, 0x0F, 0xF4, 0x1F, 0xF0, 0x3F, 0x80, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xF4, 0xFF, 0xD3, 0xE3, 0xFF, 0xCF, 0x9F, 0x6F, 0xFD, 0x7D,
-    0x3F, 0xF0, 0xF4, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xE1, 0xFE,
-    0xAA, 0xA4, 0x00, 0x55, 0xAA, 0x0B, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF9, 0xFF, 0xFA, 0xA9, 0x0B,
-    0xD0, 0xF4, 0xFF, 0xD3, 0xE3, 0xFF, 0xCF, 0x9F, 0x6F, 0xFD, 0x7D, 0x3F, 0xF0, 0xF4, 0x2F, 0x40,
-    0x7F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0x0F, 0xF0, 0xBC,
-    0xFF, 0x3F, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0x2A, 0xAA, 0xA3, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xF3, 0xE0, 0x3F, 0x3E, 0x03, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x2F,
-    0xBE, 0x1F, 0xFF, 0xEB, 0x6F, 0xBE, 0xD7, 0xCF, 0xF1, 0xF3, 0xFC, 0x7C, 0xF0, 0x00, 0x00, 0x2C,
-    0x34, 0x0F, 0xE0, 0x07, 0xC0, 0x0B, 0xD0, 0x2D, 0xF4, 0x28, 0x28, 0x05, 0x01, 0x43, 0xFC, 0x3D,
-    0x7F, 0xF3, 0xDB, 0xCF, 0xFC, 0xBC, 0x7F, 0xC6, 0x81, 0xA0, 0x00, 0x2D, 0x0B, 0xE2, 0xFC, 0x7F,
-    0x2F, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xF8,
-    0x3F, 0x83, 0xF8, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x3F, 0x03, 0xF4, 0xFC, 0x0F, 0xD3, 0xF0, 0x3F, 0x40,
-    0x05, 0x6A, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0x0A, 0xAA, 0x95, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x55, 0x00, 0x00, 0x00, 0x15, 0x01, 0x50, 0xFC, 0x0F, 0xC7, 0xF0, 0x3F, 0x1F, 0xC1,
-    0xFC, 0x7F, 0x07, 0xF2, 0xFC, 0x1F, 0xCB, 0xF0, 0x7F, 0x2F, 0xC2, 0xFC, 0x69, 0x55, 0x2F, 0xFF,
-    0xDB, 0xFF, 0xF6, 0xFF, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xE0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x78, 0x00, 0xBF, 0x3F, 0xF0, 0xBF, 0xFF, 0xBC, 0x3F, 0xFF, 0xEF, 0x0F, 0xCF,
-    0xFF, 0xC3, 0xF0, 0xFF, 0xE0, 0xFC, 0x7F, 0xF0, 0x00, 0x2E, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x07,
-    0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x03, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x02, 0xFF, 0xF8, 0x00, 0xBF, 0xE1, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0x3F, 0xFF,
-    0xFF, 0xF5, 0xFF, 0xE7, 0xFF, 0x47, 0xFF, 0xFF, 0xFD, 0xBF, 0xF4, 0x0B, 0xFF, 0xFF, 0x83, 0xFF,
-    0x8A, 0x4B, 0xFF, 0x90, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x3F, 0xFC, 0x0B, 0xE2, 0xFF, 0xFC, 0x2F,
-    0xCF, 0xF3, 0xFC, 0xBF, 0x3F, 0x83, 0xFF, 0xF4, 0x7F, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xA4, 0x00,
-    0x54, 0x00, 0x00, 0x0F, 0xFF, 0x02, 0xF8, 0xBF, 0xFF, 0x4B, 0xF3, 0xF8, 0xBF, 0xBF, 0x8F, 0xE0,
-    0xBF, 0xFC, 0x06, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x43, 0x90, 0x0B, 0xF2, 0xFC, 0x00, 0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0F,
-    0x42, 0xC0, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x7F, 0x00,
-    0x00, 0x00, 0x2F, 0xC1, 0xFE, 0x40, 0x00, 0x6F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x06,
-    0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFA, 0x55, 0x5B, 0xFE, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF8,
-    0xBC, 0x00, 0x00, 0x00, 0x07, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0x4F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x3F,
-    0xD0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x00, 0x0F,
-    0xFE, 0xAA, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x41,
-    0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xFF, 0xE4, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x05, 0xFF, 0x80, 0xFF, 0x00, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x01, 0xFC, 0x0F, 0xF0, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xAA, 0xFF, 0xF0, 0xFF, 0x00,
-    0x07, 0xFD, 0x3F, 0xC0, 0x00, 0xBF, 0x8F, 0xF0, 0x00, 0x3F, 0xF3, 0xFE, 0x55, 0xBF, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF,
-    0xFF, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x40,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xDB, 0xF8, 0x00, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x00,
-    0xFF, 0x83, 0xFE, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0x07, 0xFD,
-    0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x2F, 0xF4, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xAB, 0xFF, 0xF5, 0xFF,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFA, 0xA4, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0xEA, 0xFD, 0x02, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xAB,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x7F, 0xC0, 0x00, 0x3F, 0xD1, 0xFF, 0x00, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x03,
-    0xFD, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x3F, 0xE2, 0xFF, 0x00, 0x00, 0xFF, 0x8B,
-    0xFC, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x3F, 0xE2, 0xFF, 0x40,
-    0x00, 0xFF, 0x8B, 0xFD, 0x00, 0x07, 0xFF, 0x2F, 0xF9, 0x55, 0x6F, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x80, 0x02, 0xFF, 0xCF, 0xFE, 0x00, 0x0B, 0xFF, 0x3F, 0xF8, 0x00,
-    0x2F, 0xFC, 0xFF, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x9B, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x2F,
-    0xF8, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x00, 0x00, 0x0F,
-    0xFC, 0xBF, 0xC0, 0x01, 0x51, 0xFF, 0x3F, 0xE3, 0xFF, 0xFD, 0x7F, 0xCF, 0xF8, 0xFF, 0xFF, 0x8F,
-    0xF3, 0xFD, 0xBF, 0xFF, 0xF3, 0xFD, 0xFF, 0x95, 0x54, 0x00, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x7F,
-    0xCF, 0xFC, 0x00, 0x00, 0x2F, 0xF2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0xBF, 0xFE, 0x51, 0x7F, 0xFF,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x8B, 0xF8, 0xBF, 0x8B, 0xF8, 0xBF, 0x87, 0xF8, 0x7F, 0x87,
-    0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xCB, 0xFC, 0xBF, 0xCB, 0xFC,
-    0xFF, 0xDF, 0xFD, 0xFF, 0xD0, 0x0B, 0xF4, 0x0F, 0xFC, 0x00, 0x3F, 0xD0, 0xBF, 0xE0, 0x00, 0xFF,
-    0x03, 0xFF, 0x00, 0x03, 0xFC, 0x2F, 0xF4, 0x00, 0x0F, 0xF1, 0xFF, 0x80, 0x00, 0x7F, 0xCF, 0xFC,
-    0x00, 0x01, 0xFE, 0x7F, 0xE0, 0x00, 0x07, 0xFB, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x7F, 0xCF, 0xFF, 0xC0, 0x02, 0xFF, 0x1F, 0xFF, 0xD0, 0x0B, 0xFC, 0x1F, 0xFF, 0xD0, 0x3F,
-    0xF0, 0x2F, 0xFF, 0xE0, 0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xDB, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xD0, 0x00, 0x2F, 0xF8,
-    0x2F, 0xFC, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xD0, 0x02, 0xFF, 0x40,
-    0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xD0, 0x2F, 0xF0, 0x00,
-    0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD1, 0xFF, 0x00, 0x00,
-    0x0B, 0xF8, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x80,
-    0x00, 0x7F, 0xF0, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xF4, 0x7F, 0xFF,
-    0x00, 0x2F, 0xFF, 0x47, 0xFF, 0xF4, 0x03, 0xFF, 0xF4, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x47, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xF4, 0x7F, 0xFF, 0xD0, 0xFF, 0xFF, 0x4B, 0xFB, 0xFF, 0x2F, 0xFF, 0xF8, 0xBF,
-    0xAF, 0xF7, 0xFE, 0xFF, 0x8B, 0xF9, 0xFF, 0xFF, 0xDF, 0xF8, 0xBF, 0xCF, 0xFF, 0xFC, 0xFF, 0x8B,
-    0xFC, 0xBF, 0xFF, 0x8F, 0xF8, 0xBF, 0xC3, 0xFF, 0xF5, 0xFF, 0xCF, 0xFC, 0x3F, 0xFF, 0x1F, 0xFC,
-    0xFF, 0xC1, 0xFF, 0xE1, 0xFF, 0xCF, 0xFC, 0x0F, 0xFD, 0x2F, 0xFC, 0xFF, 0xD0, 0xBF, 0xC2, 0xFF,
-    0xCF, 0xFD, 0x07, 0xFC, 0x3F, 0xFC, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xF1, 0xFF, 0x40, 0x00, 0xFF, 0x1F, 0xFC, 0x00, 0x1F, 0xE1, 0xFF, 0xD0, 0x01, 0xFE, 0x2F, 0xFF,
-    0x00, 0x1F, 0xE2, 0xFF, 0xF4, 0x02, 0xFE, 0x2F, 0xFF, 0xC0, 0x2F, 0xD3, 0xFF, 0xFD, 0x02, 0xFD,
-    0x3F, 0xFF, 0xF0, 0x3F, 0xD3, 0xFF, 0xFF, 0x43, 0xFD, 0x3F, 0xF7, 0xFC, 0x3F, 0xD3, 0xFF, 0x3F,
-    0xD3, 0xFC, 0x3F, 0xF2, 0xFE, 0x3F, 0xC7, 0xFF, 0x0F, 0xF7, 0xFC, 0x7F, 0xF0, 0xBF, 0xFF, 0xC7,
-    0xFF, 0x07, 0xFF, 0xFC, 0xBF, 0xF0, 0x3F, 0xFF, 0xCB, 0xFF, 0x01, 0xFF, 0xFC, 0xBF, 0xF0, 0x0F,
-    0xFF, 0xCF, 0xFF, 0x00, 0xBF, 0xFC, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x15, 0x55, 0x55, 0x55, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x55,
-    0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0x9B, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x2F, 0xF8, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x03,
-    0xFE, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x3F,
-    0xE0, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x0F, 0xF3, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xCF, 0xFC, 0x00, 0x00, 0x2F, 0xF2, 0xFF,
-    0x80, 0x00, 0x1F, 0xFC, 0xBF, 0xFE, 0x51, 0x7F, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xDB, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xDB, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x1F, 0xDB,
-    0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x1F, 0xDB, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x1F, 0xDB, 0xF0, 0x01,
-    0xFD, 0xBF, 0x00, 0x1F, 0xDB, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x1F, 0xDB, 0xF0, 0x01, 0xFD, 0xBF,
-    0x00, 0x1F, 0xDB, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x1F, 0xDB, 0xF0, 0x01, 0xFD, 0xBE, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xC0, 0x1F, 0xF0, 0xFF, 0x00, 0x0F, 0xD3, 0xFC, 0x00, 0x3F, 0x8F, 0xF0, 0x01, 0xFF, 0x3F,
-    0xD5, 0xAF, 0xF8, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xFF, 0x01, 0xFF, 0xFF, 0x90, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0xBF,
-    0x80, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFB, 0xFF, 0xFF, 0xFE, 0x55, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x0F, 0xF8, 0xFF, 0x40, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x03, 0xFE, 0x07, 0xFD, 0x00, 0x1F,
-    0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00,
-    0x7F, 0xE2, 0xFF, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x17, 0xFE,
-    0x50, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xEF, 0xFF, 0xC0, 0x03, 0xFF, 0xC2, 0xFC, 0x1F, 0xFF, 0x00, 0xFF, 0xF0, 0x2F,
-    0xC0, 0x3F, 0xF8, 0x1F, 0xFC, 0x03, 0xFC, 0x01, 0xFF, 0xC2, 0xFF, 0x80, 0x3F, 0xC0, 0x0F, 0xFD,
-    0x3F, 0xF8, 0x03, 0xFC, 0x00, 0xFF, 0xE3, 0xFF, 0x40, 0x3F, 0xC0, 0x0B, 0xFE, 0x3F, 0xF4, 0x03,
-    0xFC, 0x00, 0xBF, 0xE3, 0xFF, 0x80, 0x3F, 0xC0, 0x0F, 0xFE, 0x3F, 0xFD, 0x03, 0xFC, 0x03, 0xFF,
-    0xD2, 0xFF, 0xFE, 0x7F, 0xDA, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x06, 0xBF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x00,
-    0x0F, 0xF4, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xC2, 0xFF,
-    0x40, 0x00, 0xBF, 0xE7, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xDB, 0xFF, 0x40, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x0B, 0xFF, 0x41,
-    0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0xFF, 0xF4, 0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0xBF, 0xF8, 0x00, 0x2F,
-    0xFE, 0x6A, 0x00, 0x2F, 0x46, 0xAB, 0xF0, 0x02, 0xF4, 0xBF, 0xBF, 0x00, 0x2F, 0x4B, 0xFB, 0xF0,
-    0x03, 0xF4, 0xBF, 0xBF, 0x00, 0x3F, 0x4B, 0xF7, 0xF0, 0x03, 0xF4, 0xFE, 0x7F, 0x40, 0x3F, 0x1F,
-    0xD3, 0xF8, 0x03, 0xF3, 0xFD, 0x3F, 0xE0, 0x3F, 0xBF, 0xC2, 0xFF, 0x93, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0x41,
-    0xFF, 0xD0, 0x0F, 0xF8, 0x00, 0x2F, 0xF0, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x07,
-    0xF8, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x03, 0xFC,
-    0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x2F,
-    0xE0, 0x00, 0x0F, 0xF8, 0x0F, 0xF0, 0x00, 0x2F, 0xF4, 0x07, 0xFD, 0x01, 0xFF, 0xE0, 0x7F, 0xFF,
-    0x83, 0xFF, 0xF8, 0xBF, 0xFF, 0x83, 0xFF, 0xFD, 0xBF, 0xFF, 0x83, 0xFF, 0xFD, 0x7F, 0xFF, 0x83,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0F, 0xD0, 0x7F, 0xC0, 0x01, 0xF8, 0x02,
-    0xFD, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x3E, 0x00, 0x0F, 0xE0, 0x03,
-    0xD0, 0x00, 0xBE, 0x00, 0x3D, 0x00, 0x0B, 0xF0, 0x03, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xEA, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x01, 0x0F, 0xFF, 0xFF, 0xFB, 0xD0, 0x7F, 0xFF, 0xFF, 0xFD, 0x00,
-    0xBF, 0x93, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF,
-    0xD7, 0xFE, 0x0B, 0xF8, 0x02, 0xFC, 0x2F, 0xC0, 0x03, 0xF0, 0xBF, 0x00, 0x0F, 0xC2, 0xFC, 0x16,
-    0xFF, 0x0B, 0xF2, 0xFF, 0xF0, 0x2F, 0xCB, 0xFF, 0xD0, 0xBF, 0x2F, 0xFF, 0xE2, 0xFC, 0x00, 0x7F,
-    0xDB, 0xF0, 0x00, 0x7F, 0xAF, 0xE0, 0x01, 0xFF, 0xBF, 0xFD, 0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 0xEB,
-    0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFC, 0xBF, 0xBF, 0xFF, 0xE2, 0xFC, 0x0B, 0xFE, 0x0B, 0xF0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x06, 0xA0, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x1F, 0xE0, 0x03, 0xFC, 0x0F, 0xF0, 0x02, 0xFC, 0x07, 0xF8,
-    0x02, 0xFC, 0x03, 0xFC, 0x02, 0xFC, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0xBF,
-    0x83, 0xFC, 0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x40, 0x00, 0x01, 0xBF,
-    0xF9, 0x40, 0x7F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xF5, 0x6F, 0xF0, 0x3F, 0xC0, 0x00,
-    0x40, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xC0, 0x7F, 0xD7, 0xFC, 0x00, 0xBF, 0xAF, 0xF0, 0x01, 0xFF, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0x40,
-    0x3F, 0xE3, 0xFF, 0xEB, 0xFF, 0x4B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC,
-    0x00, 0x06, 0xFF, 0x40, 0x00, 0x01, 0xB8, 0x00, 0x0F, 0xFF, 0x00, 0x3D, 0x07, 0x80, 0x3C, 0x02,
-    0x80, 0x3D, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x7C, 0x07, 0xD0,
-    0x7C, 0x03, 0xE0, 0x3F, 0x07, 0xE0, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x02, 0xFD, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xD0,
-    0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0xBF, 0xE2, 0xFE, 0x40, 0xBF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFE, 0x47, 0xFC, 0x0B, 0xF8, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0xFC, 0x0B, 0xF0, 0x00, 0xFD,
-    0x0B, 0xF0, 0x00, 0xFD, 0x0F, 0xF0, 0x01, 0xFD, 0x0F, 0xF0, 0x01, 0xFD, 0x0F, 0xF4, 0x01, 0xFE,
-    0x0F, 0xF4, 0x01, 0xFE, 0x0F, 0xF4, 0x01, 0xFE, 0x0F, 0xF8, 0x02, 0xFE, 0x0F, 0xF8, 0x02, 0xFE,
-    0x0A, 0xA4, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFC, 0x1F, 0xE0, 0x2F, 0xC0, 0x1F, 0xC0, 0xFE,
-    0x00, 0x3F, 0x83, 0xF4, 0x00, 0xBF, 0x1F, 0xD0, 0x02, 0xFC, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x6F, 0xE5, 0x57, 0xFC, 0xBF, 0x80, 0x0F, 0xF1, 0xFF, 0x00, 0x7F,
-    0xC7, 0xFE, 0x03, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x6F, 0xE0, 0x00, 0x15, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x40, 0x7F,
-    0x40, 0x7F, 0x80, 0xBF, 0x80, 0xBF, 0xC0, 0xBF, 0xE9, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xF9, 0x0B,
-    0xC1, 0xFC, 0x00, 0xFC, 0x3F, 0x80, 0x0F, 0xCB, 0xF0, 0x00, 0xFC, 0xFD, 0x00, 0x0F, 0xAF, 0x80,
-    0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x3F, 0xFF, 0x40, 0x03, 0xFB, 0xFD, 0x00, 0x3F, 0x2F, 0xF8, 0x03, 0xF0, 0xFF, 0xE0,
-    0x3F, 0x03, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x01, 0x6F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x0F, 0xFB, 0xFC, 0x00,
-    0x07, 0xFC, 0xBF, 0x00, 0x03, 0xFE, 0x1F, 0xD0, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0xBF,
-    0x00, 0x7F, 0xC0, 0x1F, 0xD0, 0x3F, 0xD0, 0x03, 0xF8, 0x1F, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x00,
-    0x1F, 0xD0, 0x2F, 0xC0, 0x02, 0xFC, 0x2F, 0xC0, 0x02, 0xFC, 0x2F, 0xC0, 0x02, 0xFC, 0x2F, 0xD0,
-    0x02, 0xFC, 0x2F, 0xD0, 0x02, 0xFC, 0x3F, 0xD0, 0x02, 0xFC, 0x3F, 0xE0, 0x03, 0xFD, 0x3F, 0xE0,
-    0x03, 0xFD, 0x3F, 0xF0, 0x03, 0xFD, 0x3F, 0xF0, 0x03, 0xFD, 0x3F, 0xFD, 0x0F, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0x2F,
-    0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x03, 0xFC, 0x1F, 0xE0, 0x03, 0xFC, 0x0F, 0xF0, 0x02, 0xFC, 0x07, 0xF8, 0x02, 0xFC, 0x03, 0xFC,
-    0x02, 0xFD, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0xBF, 0x83, 0xFC, 0x00, 0x3F,
-    0xCB, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xF8, 0xBF, 0xFF, 0xF8, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0xC0, 0x0B, 0xFF, 0xD0, 0x0F, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x07, 0xFD, 0x40, 0x0F,
-    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xFF, 0xD0, 0x07, 0xFF, 0xF8, 0x01, 0xFF, 0xFC, 0x00, 0x02,
-    0xFD, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x03, 0xFD,
-    0x0B, 0xF8, 0x2F, 0xD0, 0x0F, 0xF0, 0xFF, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x3F, 0x8F, 0xE0, 0x00,
-    0xFE, 0x3F, 0x80, 0x03, 0xF8, 0xFF, 0x00, 0x1F, 0xD3, 0xFE, 0x01, 0xFF, 0x4B, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x1B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0x03,
-    0xF4, 0x3F, 0xC0, 0x07, 0xF4, 0x3F, 0x80, 0x07, 0xF4, 0x3F, 0x80, 0x07, 0xF0, 0x3F, 0x40, 0x0B,
-    0xF0, 0x7F, 0x40, 0x0B, 0xF0, 0x7F, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x0F, 0xF0, 0xBF, 0x50, 0x0F,
-    0xF0, 0xFF, 0xF4, 0x0F, 0xE0, 0xFF, 0xF4, 0x0A, 0x90, 0x2F, 0xF0, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0xD7, 0xF8, 0x01, 0xFF, 0x00, 0xFC, 0x03,
-    0xFC, 0x00, 0x3E, 0x03, 0xFC, 0x00, 0x3E, 0x07, 0xFC, 0x00, 0x3F, 0x0B, 0xFC, 0x00, 0x3F, 0x0F,
-    0xFC, 0x00, 0x3E, 0x0F, 0xFF, 0x41, 0xFE, 0x0F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xD0, 0x3F, 0xE2, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0xE4, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x1F, 0xD0, 0x7F, 0x4B,
-    0xE0, 0x01, 0x42, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x3F, 0xD0, 0xBF, 0x80, 0x2F, 0xD0,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x01, 0xFD, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x0F, 0xE0, 0x3F,
-    0x80, 0x03, 0xF8, 0x0F, 0xF0, 0x01, 0xFD, 0x03, 0xFE, 0x01, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBE, 0x0B, 0xF0, 0x2F, 0x80, 0xFE,
-    0x0B, 0xE0, 0x1F, 0xC2, 0xFC, 0x03, 0xF4, 0x7F, 0x00, 0xBE, 0x1F, 0xC0, 0x1F, 0xC7, 0xF0, 0x07,
-    0xF1, 0xFC, 0x01, 0xFC, 0x3F, 0x00, 0x3F, 0x0F, 0xD0, 0x1F, 0xC3, 0xFD, 0x5F, 0xF0, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x80, 0x06, 0xFE, 0x40, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x1F,
-    0x8B, 0xFE, 0x03, 0xFF, 0x07, 0xE0, 0xBF, 0xC0, 0xFF, 0x42, 0xF8, 0x0F, 0xF8, 0x7F, 0xC0, 0xBE,
-    0x02, 0xFF, 0x2F, 0xE0, 0x2F, 0x80, 0x7F, 0xCF, 0xF8, 0x0B, 0xE0, 0x1F, 0xF3, 0xFD, 0x02, 0xF4,
-    0x03, 0xFD, 0xFF, 0x40, 0xBD, 0x00, 0xFF, 0x7F, 0xE0, 0x2F, 0x40, 0x3F, 0xCF, 0xFC, 0x0B, 0xD0,
-    0x1F, 0xF2, 0xFF, 0x82, 0xF4, 0x0F, 0xFC, 0xBF, 0xFD, 0xFE, 0x6F, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x0F, 0xFE, 0x00, 0x1F, 0xE0, 0x0F, 0xFF, 0xC0, 0x3F, 0xC0,
-    0x0F, 0xFF, 0xE0, 0xFF, 0x40, 0x01, 0xBF, 0xF6, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE7, 0xFE, 0x00, 0x01, 0xFF, 0xC3, 0xFF,
-    0xFD, 0x03, 0xFF, 0x42, 0xFF, 0xFD, 0x0F, 0xFE, 0x00, 0xFF, 0xFD, 0x2F, 0xFC, 0x00, 0x7F, 0xFD,
-    0x2A, 0xA4, 0x00, 0x06, 0xA8, 0x00, 0x14, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xF8, 0xF8, 0xFC, 0x0B, 0xE2, 0xF2, 0xF4, 0x2F,
-    0x8B, 0xC7, 0xF0, 0xBF, 0x2F, 0x0F, 0xC1, 0xFC, 0x7C, 0x3F, 0x47, 0xF1, 0xF0, 0xBE, 0x1F, 0xC7,
-    0xC2, 0xFC, 0x7F, 0x1F, 0x07, 0xF0, 0xFD, 0x3C, 0x1F, 0xC3, 0xF8, 0xF4, 0xBF, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x6A,
-    0x40, 0x2A, 0x80, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0B, 0xF4, 0x00,
-    0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xF4, 0x1F, 0xE0, 0x7C, 0x03, 0xF4, 0x2F, 0xD0, 0xBC, 0x03,
-    0xF8, 0x2F, 0xC0, 0xBC, 0x03, 0xF8, 0x2F, 0xC0, 0xBC, 0x03, 0xF4, 0x1F, 0xE0, 0xBE, 0x0F, 0xF0,
-    0x0F, 0xFE, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x7F, 0x87, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00,
-    0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF0,
-    0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xD0, 0x7F, 0xC0, 0x7E, 0x00, 0xBF, 0x43, 0xF0, 0x00, 0xFD, 0x0F, 0xC0, 0x03,
-    0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0xF4, 0x00, 0x2F, 0xC3, 0xD0, 0x00, 0xBF, 0x0F, 0x80, 0x03, 0xFC,
-    0x3F, 0xEA, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x00,
-    0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B, 0xF4,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xFD,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF,
-    0xEA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x1F,
-    0xFC, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x06, 0x80, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00,
-    0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F, 0xC0, 0x7E, 0x00, 0xBF, 0x43, 0xF0,
-    0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0xF4, 0x00, 0x2F, 0xC3, 0xD0, 0x00,
-    0xBF, 0x0F, 0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-    0x41, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x7F, 0x80, 0x00,
-    0x01, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0,
-    0x00, 0x00, 0x03, 0xF9, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xBF,
-    0x40, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x03,
-    0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x40, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0xF4,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xD2, 0xF8, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x02, 0xFD, 0x2F, 0xC0, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xD0, 0x7F, 0xC0, 0x1F, 0x80, 0x2F, 0xD0, 0x3F, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x0F, 0xE0,
-    0x3E, 0x00, 0x0F, 0xE0, 0x3D, 0x00, 0x0B, 0xF0, 0x3D, 0x00, 0x0B, 0xF0, 0x3E, 0x00, 0x0F, 0xF0,
-    0x3F, 0xEA, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0x90, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xBC, 0x00, 0x00, 0x00, 0x05, 0x51, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0x47, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x01, 0xFE, 0x07,
-    0xF8, 0x00, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x0B,
-    0xFC, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x03, 0xFF,
-    0x40, 0x00, 0x1F, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE4,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x41,
-    0xFF, 0x00, 0x00, 0x07, 0xE0, 0x0B, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0,
-    0x03, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0xF4,
-    0x00, 0x2F, 0xC0, 0x00, 0x0F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xAB, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xF8,
-    0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF4, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0x83,
-    0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x7C, 0x0F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0x3F, 0xC7, 0xF8, 0x00, 0x3F, 0x40, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF9, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xF4, 0x1F,
-    0xF0, 0x01, 0xF8, 0x02, 0xFD, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x0F, 0xE0, 0x0F, 0x80,
-    0x03, 0xF8, 0x03, 0xD0, 0x00, 0xBF, 0x00, 0xF4, 0x00, 0x2F, 0xC0, 0x3E, 0x00, 0x0F, 0xF0, 0x0F,
-    0xFA, 0xBF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF4,
-    0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x14, 0x00, 0x00, 0x00, 0x1F, 0xD2, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xC3, 0xFC, 0x00,
-    0x00, 0x00, 0x28, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B,
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03,
-    0xFD, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00,
-    0xFF, 0xEA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4,
-    0x1F, 0xFC, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0xBD, 0x0F, 0x00, 0x07,
-    0xFD, 0x3C, 0x00, 0x2F, 0xBE, 0xF0, 0x00, 0xB8, 0xFF, 0xC0, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x1F, 0xFF, 0xD0, 0x01, 0xFE, 0x2F, 0xD0, 0x1F, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0x41, 0xFF, 0x01, 0xF8,
-    0x02, 0xFD, 0x0F, 0xC0, 0x03, 0xF4, 0x3F, 0x00, 0x0F, 0xE0, 0xF8, 0x00, 0x3F, 0x83, 0xD0, 0x00,
-    0xBF, 0x0F, 0x40, 0x02, 0xFC, 0x3E, 0x00, 0x0F, 0xF0, 0xFF, 0xAB, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xF8, 0x00, 0x00, 0x1F, 0xC0,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00,
-    0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00,
-    0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xF0, 0xBF, 0x40, 0xFE,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x3F, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F, 0xC0, 0x7E, 0x00, 0xBF, 0x43, 0xF0, 0x00, 0xFD,
-    0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0xF4, 0x00, 0x2F, 0xC3, 0xD0, 0x00, 0xBF, 0x0F,
-    0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF,
-    0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x0B, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xFD, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xEA,
-    0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x1F, 0xFC,
-    0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0xBF,
-    0xEF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F, 0xC0, 0x7E, 0x00, 0xBF, 0x43, 0xF0, 0x00, 0xFD, 0x0F,
-    0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0xF4, 0x00, 0x2F, 0xC3, 0xD0, 0x00, 0xBF, 0x0F, 0x80,
-    0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF,
-    0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFA,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF4, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x1F, 0xFC, 0x00, 0x02, 0xFF,
-    0x83, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0xBF, 0xEF, 0xFC, 0x01,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xD0, 0x7F, 0xC0, 0x7E, 0x00, 0xBF, 0x43, 0xF0, 0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF8,
-    0x3E, 0x00, 0x0F, 0xE0, 0xF4, 0x00, 0x2F, 0xC3, 0xD0, 0x00, 0xBF, 0x0F, 0x80, 0x03, 0xFC, 0x3F,
-    0xEA, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x00, 0xBF,
-    0x90, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x2F, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x4F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x3F,
-    0xC0, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x00, 0x0F, 0xFE, 0xAA,
-    0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xC0,
-    0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0x5F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x2F, 0xFB, 0xFF, 0x00, 0xBF, 0xFF,
-    0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0xFD, 0x07, 0xFC, 0x07,
-    0xE0, 0x0B, 0xF4, 0x3F, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x3F, 0x83, 0xE0, 0x00, 0xFE, 0x0F, 0x40,
-    0x02, 0xFC, 0x3D, 0x00, 0x0B, 0xF0, 0xF8, 0x00, 0x3F, 0xC3, 0xFE, 0xAF, 0xFF, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x14, 0x00, 0x00, 0x00, 0x1F, 0xD2, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x3C,
-    0xFF, 0xD0, 0x00, 0x00, 0x07, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x28, 0x06, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0,
-    0x00, 0x00, 0x03, 0xF9, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xBF,
-    0x40, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x03,
-    0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x40, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0xF4,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x14, 0x05, 0x00, 0x03, 0xFC, 0x3C, 0x00, 0x1F, 0xF8, 0xF0, 0x00,
-    0xB9, 0xFF, 0xC0, 0x03, 0xE2, 0xFE, 0x00, 0x06, 0x41, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFD, 0x02, 0xFF, 0xBF,
-    0xF0, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x3F, 0x41, 0xFF, 0x01, 0xF8, 0x02, 0xFD, 0x0F, 0xC0, 0x03, 0xF4, 0x3F, 0x00,
-    0x0F, 0xE0, 0xF8, 0x00, 0x3F, 0x83, 0xD0, 0x00, 0xBF, 0x0F, 0x40, 0x02, 0xFC, 0x3E, 0x00, 0x0F,
-    0xF0, 0xFF, 0xAB, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF4,
-    0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x0B, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xFD, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xEA,
-    0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x1F, 0xFC,
-    0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0xBF, 0xEF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFF, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F,
-    0xC0, 0x7E, 0x00, 0xBF, 0x43, 0xF0, 0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0,
-    0xF4, 0x00, 0x2F, 0xC3, 0xD0, 0x00, 0xBF, 0x0F, 0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x2A, 0xAB, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFA, 0xA4, 0x7F,
-    0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0xEA,
-    0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xC0, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xEB, 0xFC,
-    0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4F,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFF,
-    0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x00, 0x0A, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xBF, 0xFF,
-    0x5F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xAA, 0x47, 0xF8, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xD0, 0x2F, 0xFF,
-    0xFF, 0x40, 0xBF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0x3F, 0xEB, 0xFC, 0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x0B, 0xFF, 0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF,
-    0xFF, 0x00, 0x0A, 0xFF, 0x90, 0x00, 0x14, 0x05, 0x00, 0x07, 0xF8, 0x7C, 0x00, 0x3F, 0xF5, 0xF0,
-    0x00, 0xF6, 0xFF, 0x80, 0x03, 0xD3, 0xFD, 0x00, 0x06, 0x41, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xBF, 0xFF, 0x5F, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xAA, 0x47, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40,
-    0xBF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7E, 0x0F, 0x00, 0x03, 0xFE,
-    0x3C, 0x00, 0x1F, 0xBE, 0xF0, 0x00, 0xB8, 0xFF, 0xC0, 0x01, 0xF0, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F,
-    0xEB, 0xFC, 0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x0B, 0xFF, 0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x00,
-    0x0A, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x29, 0x00, 0xFF, 0xFF, 0x02, 0xF0, 0x0F, 0xE0, 0xFF, 0x0F, 0xC0,
-    0xFD, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xAA, 0xBF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x01, 0xFF, 0xFF, 0xAA, 0x40, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x40, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0xBC, 0x00, 0x1F, 0xFC, 0x00, 0xFC, 0x00, 0x7F, 0xFF, 0x02, 0xF4, 0x02, 0xFD, 0x2F, 0xC3, 0xF0,
-    0x0B, 0xF0, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0xBF,
-    0xC0, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x00, 0x1F, 0xD1, 0x57, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xA5, 0x40, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x41, 0xB4, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2B,
-    0xFE, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xF4, 0x00, 0x00, 0x05, 0x50, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0xFD,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xAA, 0xBF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFA, 0xA4, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0xAF,
-    0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0xFA, 0xAA, 0xA4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x55, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0xF8, 0x00, 0x00, 0xFF, 0xCB, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07,
-    0xFF, 0xF0, 0x00, 0x00, 0xBF, 0x4B, 0xF0, 0x00, 0x0B, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x07, 0xF4, 0x55, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xE9, 0x50, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xD4,
-    0x1B, 0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x00, 0x02, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x07, 0xD1, 0xE0, 0x00, 0x0F, 0xF0, 0x40, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAB, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xEA, 0x90, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0xEA, 0xFD, 0x00, 0xBF, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0xEA, 0xAA, 0x90, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0xF9, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x05, 0xB8, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7D, 0x0B, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x3F, 0x40, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0F, 0xFA,
-    0xFF, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x07, 0xF4, 0x55, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xF4, 0x0F, 0xE9, 0x50, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFD, 0x41, 0xB4, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF,
-    0x40, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x2B, 0xFE, 0x40, 0x00, 0x00, 0xBC, 0x1E, 0x00, 0x0B, 0xFC,
-    0x7C, 0x00, 0x3E, 0xFF, 0xF0, 0x00, 0xF4, 0xFF, 0x40, 0x03, 0xD1, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x2F, 0xFF, 0xC0, 0x02, 0xFD, 0x2F, 0xC0, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0xAA, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE,
-    0xA9, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x2F, 0xFA, 0xBF, 0x40, 0xBF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x2F,
-    0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xA9, 0x3F, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x14, 0x05, 0x00, 0x03, 0xFC, 0x3C, 0x00, 0x2F, 0xFE, 0xF0, 0x00, 0xB8, 0xFF, 0xC0,
-    0x02, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x2F, 0xD2, 0xFC, 0x02, 0xFC, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0,
-    0x3F, 0x80, 0x2F, 0x41, 0xFD, 0x15, 0x7F, 0x0B, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF4, 0xFF,
-    0xFF, 0xFF, 0xD3, 0xFA, 0x54, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xF5,
-    0x06, 0xD0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xAF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xBF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xAA, 0x47, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFD, 0x02,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFF,
-    0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFD, 0x2F, 0xC0, 0x2F, 0xC0,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x3F, 0xEB, 0xFC, 0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x0B, 0xFF, 0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0x00, 0x0A, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1A, 0x02, 0xFC, 0x01, 0xC0, 0x7C,
-    0x1F, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0x8B, 0xF8, 0xBF,
-    0x8B, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7,
-    0xFC, 0xBF, 0xCB, 0xFC, 0xBF, 0xCF, 0xFD, 0xFF, 0xDF, 0xFD, 0x1F, 0x80, 0xFD, 0x00, 0xD0, 0x7C,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x3F,
-    0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xD0, 0x3F, 0xE0, 0xBF,
-    0x82, 0xFE, 0x0B, 0xF8, 0x2F, 0xE0, 0x7F, 0x81, 0xFE, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x81, 0xFE,
-    0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x0B, 0xFC, 0x2F, 0xF0, 0xBF, 0xC3, 0xFF, 0x4F, 0xFD,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0xFC, 0x1F, 0xF0,
-    0xBF, 0xC3, 0xFF, 0x45, 0x54, 0x3F, 0xC3, 0xFC, 0x7F, 0xCB, 0xFD, 0xBF, 0xD5, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xF8,
-    0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC3, 0xFC, 0x7F, 0xD7, 0xFD, 0xBF, 0xE5, 0x55, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x9B, 0xFF, 0xC0, 0x0F, 0xFD, 0x00,
-    0x2F, 0xF8, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x00, 0x00,
-    0x0F, 0xFC, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00,
-    0x0F, 0xF3, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x7F, 0xE0, 0x00, 0x00,
-    0x7F, 0xCF, 0xFC, 0x00, 0x00, 0x2F, 0xF2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0xBF, 0xFE, 0x51, 0x7F,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x03, 0xFD, 0x0B, 0xF8, 0x2F,
-    0xD0, 0x0F, 0xF0, 0xFF, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0xFE, 0x3F, 0x80,
-    0x03, 0xF8, 0xFF, 0x00, 0x1F, 0xD3, 0xFE, 0x01, 0xFF, 0x4B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x2F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x55,
-    0x50, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xE6, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x0B, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0xFF,
-    0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x7F,
-    0xCF, 0xF8, 0x00, 0x00, 0x1F, 0xF3, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x00, 0x1F, 0xF3, 0xFF, 0x00, 0x00, 0x0B, 0xFC,
-    0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x2F, 0xFF, 0x94, 0x5F, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xF4, 0x2F,
-    0xE0, 0xBF, 0x40, 0x3F, 0xC3, 0xFC, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xF8,
-    0xFE, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x7F, 0x4F, 0xF8, 0x07, 0xFD, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x68, 0x00, 0x07, 0xFF, 0xF8, 0x0F, 0xC0, 0x01, 0xFD, 0x1F, 0xE1, 0xF8, 0x00,
-    0x7F, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xE6, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0x0F, 0xFC,
-    0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x1F,
-    0xF0, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x0F, 0xFC, 0x00, 0x00,
-    0x2F, 0xF0, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x0B, 0xFF, 0xE5, 0x17, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x3E,
-    0x00, 0xFC, 0x00, 0x03, 0xFD, 0x07, 0xF0, 0x00, 0x3F, 0xFD, 0x3F, 0x80, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xD0, 0xBF, 0x80, 0x02, 0xFD, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xFD, 0x00,
-    0x3F, 0x80, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x0F, 0xF0,
-    0x01, 0xFD, 0x00, 0x3F, 0xE0, 0x1F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xF8, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x9B, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xE0,
-    0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x00, 0x00,
-    0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFE,
-    0x00, 0x00, 0x03, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD,
-    0x03, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x80, 0x00,
-    0x1F, 0xFC, 0x02, 0xFF, 0xF9, 0x45, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x03, 0xFD, 0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x01,
-    0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE,
-    0x00, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x0F, 0xF8, 0x07, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00,
-    0x1B, 0xFD, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0xBF, 0x00, 0x00, 0x1A, 0x40, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x1F, 0xFF, 0x9B, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x2F, 0xF8, 0x0B, 0xFC, 0x00, 0x03,
-    0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0xBF, 0xC0, 0x00, 0x01,
-    0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x0F, 0xF3, 0xFD, 0x00, 0x00, 0x03,
-    0xFD, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xCF, 0xFC, 0x00, 0x00, 0x2F,
-    0xF2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0xBF, 0xFE, 0x51, 0x7F, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x0F, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x7F,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFD, 0x0B, 0xF8, 0x02, 0xFD, 0x00, 0xFF,
-    0x00, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0xFE, 0x03, 0xF8, 0x00,
-    0x3F, 0x80, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0xE0, 0x1F, 0xF4, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0x90, 0x50, 0x00, 0x00, 0x02, 0xFE, 0x2E, 0x00, 0x00, 0x00, 0xFF, 0xDB, 0x80, 0x00,
-    0x00, 0x3C, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0x80, 0x60, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00,
-    0xFE, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xF9, 0xBF, 0xFC, 0x00, 0xFF,
-    0xD0, 0x02, 0xFF, 0x80, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x1F, 0xF0,
-    0x00, 0x00, 0xFF, 0xCB, 0xFC, 0x00, 0x00, 0x1F, 0xF3, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x00, 0x0F, 0xF7, 0xFE, 0x00,
-    0x00, 0x07, 0xFC, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xCB, 0xFF, 0xE5,
-    0x17, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0F, 0x00, 0x07, 0xFD, 0x3C, 0x00,
-    0x2F, 0xBE, 0xF0, 0x00, 0xB8, 0xFF, 0xC0, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFF,
-    0xD0, 0x01, 0xFE, 0x2F, 0xD0, 0x1F, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0xBF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xD0, 0xBF, 0x82, 0xFD, 0x00, 0xFF, 0x0F,
-    0xF0, 0x01, 0xFD, 0x3F, 0x80, 0x03, 0xF8, 0xFE, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x3F, 0x8F, 0xF0,
-    0x01, 0xFD, 0x3F, 0xE0, 0x1F, 0xF4, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x7F, 0x80, 0x00, 0x07, 0xF0, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xE6, 0xFF, 0xF0, 0x03, 0xFF, 0x40,
-    0x0B, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x7F, 0xC0, 0x00,
-    0x03, 0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x1F, 0xF3, 0xFE, 0x00, 0x00,
-    0x03, 0xFC, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x00,
-    0x1F, 0xF3, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x2F, 0xFF, 0x94, 0x5F,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0xFF, 0xFF, 0x40, 0x0F, 0xF0, 0xBF, 0x40, 0xFE, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xF4, 0x2F,
-    0xE0, 0xBF, 0x40, 0x3F, 0xC3, 0xFC, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xF8,
-    0xFE, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x7F, 0x4F, 0xF8, 0x07, 0xFD, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x6F, 0xF9, 0x00, 0x7E, 0x00, 0x7F, 0xFF, 0xFE, 0x0B,
-    0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xE6, 0xFF, 0xFF, 0x40, 0xFF, 0xD0, 0x02, 0xFF,
-    0xD0, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x7F, 0xC0, 0x00, 0x03,
-    0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x0F, 0xF8, 0x00, 0x00,
-    0x0F, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x0B, 0xFF, 0xE5,
-    0x17, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01,
-    0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0xF4, 0x1F,
-    0x80, 0xBF, 0xFF, 0xC7, 0xD0, 0xBF, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0xBF, 0xF8, 0x2F, 0xD0, 0x0F,
-    0xF8, 0x0F, 0xF0, 0x01, 0xFD, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x0F, 0xE0, 0x3F, 0x80,
-    0x03, 0xF8, 0x0F, 0xF0, 0x01, 0xFD, 0x03, 0xFE, 0x01, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xD0, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x6F, 0xF9, 0x00, 0x7E, 0x00, 0x7F, 0xFF, 0xFE, 0x0B, 0xD0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0xE6, 0xFF, 0xFF, 0x40, 0xFF, 0xD0, 0x02, 0xFF, 0xD0, 0x2F, 0xF0, 0x00,
-    0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x0B, 0xFC, 0x00,
-    0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x40,
-    0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x0F, 0xFC,
-    0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x0B, 0xFF, 0xE5, 0x17, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x0B, 0xFD, 0x07,
-    0xE0, 0x2F, 0xFF, 0xF1, 0xF4, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF4, 0x2F, 0xFE, 0x0B, 0xF4, 0x03,
-    0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x03, 0xF8, 0x0F, 0xE0,
-    0x00, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFF, 0x80, 0x7F, 0xD0, 0x2F, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x6F, 0xF9, 0x00, 0x7E, 0x00, 0x7F, 0xFF, 0xFE, 0x0B, 0xD0, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xE6, 0xFF, 0xFF, 0x40, 0xFF, 0xD0, 0x02, 0xFF, 0xD0, 0x2F, 0xF0,
-    0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x0B, 0xFC,
-    0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x0F,
-    0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x0B, 0xFF, 0xE5, 0x17, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xBF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x0B, 0xFD,
-    0x07, 0xE0, 0x2F, 0xFF, 0xF1, 0xF4, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF4, 0x2F, 0xFE, 0x0B, 0xF4,
-    0x03, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x03, 0xF8, 0x0F,
-    0xE0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFF, 0x80, 0x7F, 0xD0, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x7C, 0x00, 0x00, 0x00, 0x7F, 0xD3, 0xC0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0x82, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x6F, 0xF9, 0x00, 0x7E, 0x00, 0x7F, 0xFF, 0xFE, 0x0B, 0xD0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xE6, 0xFF, 0xFF, 0x40, 0xFF, 0xD0, 0x02, 0xFF, 0xD0, 0x2F,
-    0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x0B,
-    0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x0B, 0xFF, 0xE5, 0x17, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xBF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x05, 0x00, 0x00, 0x3F, 0xC3, 0xC0,
-    0x00, 0x1F, 0xFC, 0xF0, 0x00, 0x0B, 0x9F, 0xFC, 0x00, 0x03, 0xE2, 0xFE, 0x00, 0x00, 0x68, 0x19,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x0B,
-    0xFD, 0x07, 0xE0, 0x2F, 0xFF, 0xF1, 0xF4, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF4, 0x2F, 0xFE, 0x0B,
-    0xF4, 0x03, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x03, 0xF8,
-    0x0F, 0xE0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFF, 0x80, 0x7F, 0xD0, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x6F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x6F, 0xF9, 0x00, 0x7E, 0x00, 0x7F, 0xFF, 0xFE, 0x0B, 0xD0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xE6, 0xFF, 0xFF, 0x40, 0xFF, 0xD0, 0x02, 0xFF, 0xD0, 0x2F,
-    0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x0B,
-    0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x0B, 0xFF, 0xE5, 0x17, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xBF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x02, 0xFF, 0x41,
-    0xF8, 0x0B, 0xFF, 0xFC, 0x7D, 0x0B, 0xFF, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0x82, 0xFD, 0x00,
-    0xFF, 0x80, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0xFE, 0x03, 0xF8,
-    0x00, 0x3F, 0x80, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0xE0, 0x1F, 0xF4, 0x0B, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x50, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00,
-    0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF,
-    0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC, 0x00, 0x07,
-    0xFC, 0xBF, 0xC0, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFF,
-    0xFA, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0x00, 0x0B, 0xF0, 0xFC,
-    0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F, 0xD0, 0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00,
-    0x2F, 0xC3, 0xF8, 0x00, 0xFF, 0x4B, 0xE0, 0x03, 0xFD, 0x2F, 0xC0, 0x0F, 0xF4, 0xBF, 0x00, 0x3F,
-    0xD1, 0xFF, 0x43, 0xFF, 0x47, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xEF, 0xFD,
-    0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF,
-    0xEB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0,
-    0x00, 0x7F, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xCB, 0xFC, 0x00, 0x07, 0xFC,
-    0x7F, 0xC0, 0x00, 0xBF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0xAF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC3, 0xF0,
-    0x00, 0xBF, 0x0F, 0xC0, 0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00, 0x2F, 0xC3, 0xF4, 0x00,
-    0xBF, 0x0F, 0xE0, 0x03, 0xFD, 0x2F, 0x80, 0x0F, 0xF4, 0xBF, 0x00, 0x3F, 0xD2, 0xFC, 0x00, 0xFF,
-    0x47, 0xFD, 0x0F, 0xFD, 0x1F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0x80,
-    0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xFD, 0x00, 0x0F, 0xFF,
-    0xD3, 0xFF, 0x40, 0x03, 0xFF, 0xE0, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x3F, 0xF4, 0x00, 0x2F, 0xF8,
-    0x0F, 0xFD, 0x00, 0x0B, 0xFE, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0x80, 0xBF, 0xC0, 0x00, 0xBF, 0xD0,
-    0x2F, 0xF0, 0x00, 0x2F, 0xF4, 0x0B, 0xFC, 0x00, 0x0B, 0xFD, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x40,
-    0xBF, 0xC0, 0x00, 0x7F, 0xD0, 0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x07, 0xFC, 0x01,
-    0xFF, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x1F, 0xFF, 0xEB, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0xBF, 0xF8, 0x3F, 0x00, 0x0B, 0xFF,
-    0x03, 0xF0, 0x00, 0xBF, 0xD0, 0x3F, 0x40, 0x0B, 0xF0, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x3F, 0x40,
-    0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x40, 0x2F, 0x80, 0x0F, 0xF4, 0x02, 0xFC, 0x00, 0xFF, 0x40,
-    0x2F, 0xC0, 0x0F, 0xF4, 0x01, 0xFF, 0x43, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xCF, 0xFD, 0x00, 0x0F, 0xFF, 0xD3, 0xFF, 0x40, 0x03, 0xFF, 0xE0, 0xFF,
-    0xD0, 0x00, 0xBF, 0xE0, 0x3F, 0xF4, 0x00, 0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x0B, 0xFE, 0x03, 0xFF,
-    0x40, 0x02, 0xFF, 0x80, 0xBF, 0xC0, 0x00, 0xBF, 0xD0, 0x2F, 0xF0, 0x00, 0x2F, 0xF4, 0x0B, 0xFC,
-    0x00, 0x0B, 0xFD, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x7F, 0xD0, 0x2F, 0xF0,
-    0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xE0,
-    0x00, 0xFF, 0xC0, 0x1F, 0xFF, 0xEB, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F,
-    0xC3, 0xF0, 0x00, 0xBF, 0xF8, 0x3F, 0x00, 0x0B, 0xFF, 0x03, 0xF0, 0x00, 0xBF, 0xD0, 0x3F, 0x40,
-    0x0B, 0xF0, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x40,
-    0x2F, 0x80, 0x0F, 0xF4, 0x02, 0xFC, 0x00, 0xFF, 0x40, 0x2F, 0xC0, 0x0F, 0xF4, 0x01, 0xFF, 0x43,
-    0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xF3, 0xFF, 0x40, 0x03, 0xFF, 0xF4, 0xFF, 0xD0, 0x00, 0xFF, 0xF8, 0x3F, 0xF4, 0x00,
-    0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x0B, 0xFE, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0x80, 0xFF, 0xD0, 0x00,
-    0xBF, 0xE0, 0x2F, 0xF0, 0x00, 0x2F, 0xF4, 0x0B, 0xFC, 0x00, 0x0B, 0xFD, 0x02, 0xFF, 0x00, 0x02,
-    0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x7F, 0xD0, 0x2F, 0xF0, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x07,
-    0xFC, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x00, 0x3F,
-    0xF0, 0x07, 0xFF, 0xFA, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC3,
-    0xF0, 0x00, 0xBF, 0xF8, 0x3F, 0x00, 0x0B, 0xFF, 0x03, 0xF0, 0x00, 0xBF, 0xD0, 0x3F, 0x40, 0x0B,
-    0xF0, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x40, 0x2F,
-    0x80, 0x0F, 0xF4, 0x02, 0xFC, 0x00, 0xFF, 0x40, 0x2F, 0xC0, 0x0F, 0xF4, 0x01, 0xFF, 0x43, 0xFF,
-    0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00, 0x0F, 0xF0,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x3D, 0x00, 0x00, 0x01, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0xBC, 0x7F,
-    0xC0, 0x00, 0x00, 0x0A, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xF3, 0xFF, 0x40, 0x03, 0xFF, 0xF4, 0xFF, 0xD0, 0x00, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x2F,
-    0xF8, 0x0F, 0xFD, 0x00, 0x0B, 0xFE, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0x80, 0xFF, 0xD0, 0x00, 0xBF,
-    0xE0, 0x2F, 0xF0, 0x00, 0x2F, 0xF4, 0x0B, 0xFC, 0x00, 0x0B, 0xFD, 0x02, 0xFF, 0x00, 0x02, 0xFF,
-    0x40, 0xBF, 0xC0, 0x00, 0x7F, 0xD0, 0x2F, 0xF0, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x07, 0xFC,
-    0x02, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x07, 0xFF, 0xFA, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0F, 0x00, 0x00, 0x0F, 0xF4, 0xF0, 0x00, 0x02,
-    0xFB, 0xEF, 0x00, 0x00, 0x2E, 0x3F, 0xF0, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0xBF, 0xF8, 0x3F, 0x00, 0x0B, 0xFF, 0x03, 0xF0, 0x00, 0xBF, 0xD0, 0x3F, 0x40, 0x0B, 0xF0,
-    0x03, 0xF4, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x40, 0x2F, 0x80,
-    0x0F, 0xF4, 0x02, 0xFC, 0x00, 0xFF, 0x40, 0x2F, 0xC0, 0x0F, 0xF4, 0x01, 0xFF, 0x43, 0xFF, 0x40,
-    0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x3F, 0xF4, 0x00, 0x3F, 0xFF, 0x4F, 0xFD, 0x00, 0x0F, 0xFF, 0x83, 0xFF, 0x40, 0x02, 0xFF,
-    0x80, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x3F, 0xF4, 0x00, 0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x0B, 0xFE,
-    0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0xBF, 0xD0, 0x2F, 0xF0, 0x00, 0x2F, 0xF4,
-    0x0B, 0xFC, 0x00, 0x07, 0xFD, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x7F, 0xC0,
-    0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x7F, 0xFF, 0xAF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x80, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x0B, 0xFF,
-    0x83, 0xF0, 0x00, 0xBF, 0xF0, 0x3F, 0x00, 0x0B, 0xFD, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x3F, 0x40,
-    0x0B, 0xF0, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x0F, 0xF4, 0x02, 0xF8, 0x00, 0xFF, 0x40,
-    0x2F, 0xC0, 0x0F, 0xF4, 0x02, 0xFC, 0x00, 0xFF, 0x40, 0x1F, 0xF4, 0x3F, 0xF4, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x03, 0xFE, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x07,
-    0xFC, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFD, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00,
-    0x1F, 0xF8, 0xBF, 0xC0, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xFF,
-    0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x02, 0xFC, 0x1F, 0xE0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x7F, 0xC0,
-    0x2F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x01, 0xFF, 0x03, 0xF8, 0x00, 0x3F, 0xE2, 0xFC, 0x00, 0x07,
-    0xFC, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x15, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0xFF,
-    0x40, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x03, 0xFE, 0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x0F, 0xFC, 0x00,
-    0xFF, 0x80, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE2, 0xFF, 0x00,
-    0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF,
-    0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x1F, 0xD0, 0x01, 0xFF, 0x00, 0xBF, 0x00, 0x03,
-    0xFD, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x0F, 0xE0, 0x00, 0x0F, 0xF8, 0xBF, 0x00, 0x00, 0x1F, 0xF3,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x05, 0x6F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFD, 0x03, 0xFF, 0xF0, 0x0B, 0xF8, 0x0F, 0xF9, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0xFF, 0x40, 0x00, 0x7F,
-    0xC3, 0xFF, 0x00, 0x03, 0xFE, 0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x1F,
-    0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE2, 0xFF, 0x00, 0x00, 0xFF, 0xCF,
-    0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC1, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x07, 0xF4, 0x07,
-    0xFC, 0x02, 0xFC, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x1F, 0xF0, 0x3F, 0x80, 0x03, 0xFE, 0x2F, 0xC0,
-    0x00, 0x7F, 0xCF, 0xF0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x01, 0x5B, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x01, 0x01, 0x40,
-    0x00, 0x00, 0x7F, 0x4B, 0x80, 0x00, 0x03, 0xFF, 0x6E, 0x00, 0x00, 0x0F, 0x3F, 0xF4, 0x00, 0x00,
-    0x7C, 0x3F, 0xC0, 0x00, 0x00, 0xA0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE3, 0xFD,
-    0x00, 0x01, 0xFF, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x03,
-    0xFE, 0x00, 0x7F, 0xD0, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0x01, 0xFF, 0x8B, 0xFC, 0x00,
-    0x03, 0xFF, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x05,
-    0x01, 0x40, 0x00, 0x0B, 0xF4, 0xB8, 0x00, 0x03, 0xFF, 0x2D, 0x00, 0x01, 0xF3, 0xFF, 0x40, 0x00,
-    0x7C, 0x3F, 0xC0, 0x00, 0x0A, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC1, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x07, 0xF4, 0x07, 0xFC, 0x02, 0xFC, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x1F, 0xF0, 0x3F, 0x80, 0x03,
-    0xFE, 0x2F, 0xC0, 0x00, 0x7F, 0xCF, 0xF0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x01, 0x5B, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0x6A, 0xAA, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x1F, 0xC0, 0x3F,
-    0x07, 0xE0, 0x0F, 0xC1, 0xF8, 0x03, 0xF0, 0x7E, 0x00, 0xFC, 0x1F, 0x80, 0x3F, 0x07, 0xE0, 0x0F,
-    0xC2, 0xF8, 0x07, 0xF0, 0xBE, 0x01, 0xFC, 0x2F, 0x80, 0x7E, 0x0B, 0xD0, 0x1F, 0x82, 0xF4, 0x07,
-    0xE0, 0xBD, 0x01, 0xF8, 0x2F, 0x40, 0x7E, 0x0B, 0xD0, 0x1F, 0x83, 0xF4, 0x0B, 0xE0, 0xFD, 0x02,
-    0xF8, 0x3F, 0x40, 0xBD, 0x0F, 0xC0, 0x2F, 0x43, 0xF0, 0x0B, 0xD0, 0xFC, 0x02, 0xF4, 0x3F, 0x00,
-    0xBD, 0x0F, 0xC0, 0x2F, 0x42, 0xA0, 0x06, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x7F, 0xF8, 0x0F, 0xFE, 0x03, 0xFF, 0x80, 0xBF, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0x00,
-    0xBF, 0xE0, 0x1F, 0xFC, 0x02, 0xAA, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0xFF, 0xE0, 0x2F, 0xF4,
-    0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x2A, 0x90, 0x00, 0x1F, 0xFE, 0x1F, 0xFD,
-    0x0F, 0xFC, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x3F, 0xF0, 0xBF, 0xE0, 0x6A, 0x80, 0x7F, 0xF8,
-    0x0F, 0xFE, 0x03, 0xFF, 0x80, 0xBF, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0xBF, 0xE0, 0x1F, 0xFC,
-    0x02, 0xAA, 0x00, 0x7F, 0xF8, 0x3F, 0xFC, 0x0F, 0xFE, 0x0F, 0xFF, 0x03, 0xFF, 0x82, 0xFF, 0x80,
-    0xBF, 0xE0, 0x7F, 0xE0, 0x0F, 0xFC, 0x0F, 0xFC, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0xBF, 0xE0, 0x7F,
-    0xE0, 0x1F, 0xFC, 0x0F, 0xFC, 0x02, 0xAA, 0x01, 0xAA, 0x00, 0x0F, 0xFF, 0x0B, 0xFF, 0x43, 0xFF,
-    0xC2, 0xFF, 0xC0, 0xFF, 0xE0, 0xBF, 0xE0, 0x2F, 0xF4, 0x2F, 0xF4, 0x0F, 0xFC, 0x0F, 0xFC, 0x07,
-    0xFE, 0x03, 0xFF, 0x03, 0xFF, 0x42, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xD0, 0x2A, 0x90, 0x2A, 0xA0,
-    0x00, 0x1F, 0xFE, 0x1F, 0xFD, 0x0F, 0xFC, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x3F, 0xF0, 0xBF,
-    0xE0, 0x6A, 0x80, 0x7F, 0xF8, 0x3F, 0xFC, 0x0F, 0xFE, 0x0F, 0xFF, 0x03, 0xFF, 0x82, 0xFF, 0x80,
-    0xBF, 0xE0, 0x7F, 0xE0, 0x0F, 0xFC, 0x0F, 0xFC, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0xBF, 0xE0, 0x7F,
-    0xE0, 0x1F, 0xFC, 0x0F, 0xFC, 0x02, 0xAA, 0x01, 0xAA, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B,
-    0xF5, 0xA0, 0x0B, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFC, 0x15, 0x5B,
-    0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x55, 0xFF, 0xFE, 0x07,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE9, 0x50, 0x00, 0xFD, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xF9, 0x54,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFE, 0x00,
-    0xFF, 0xF8, 0x3F, 0xFF, 0x0F, 0xFF, 0x43, 0xFD, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x7F, 0x82, 0xFF, 0x0F, 0xFC, 0x3F, 0xF0, 0xFF, 0xC0, 0x05, 0x40, 0x7F, 0x82, 0xFF, 0x0F, 0xFC,
-    0x3F, 0xF0, 0xFF, 0xC0, 0x05, 0x40, 0x05, 0x50, 0x01, 0x50, 0x2F, 0xD0, 0x0F, 0xF0, 0x0B, 0xF4,
-    0x3F, 0xE0, 0x0F, 0xF4, 0x0F, 0xF8, 0x3F, 0xE0, 0x0F, 0xF4, 0x0F, 0xF8, 0x3F, 0xF0, 0x1F, 0xF8,
-    0x0F, 0xFC, 0x7F, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0xBD, 0xBD, 0xBD, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x0B, 0xE0, 0x03, 0x4C, 0x00, 0x3F, 0x00, 0x1E, 0xB4,
-    0x03, 0xF4, 0x00, 0x76, 0xE0, 0x1F, 0xC0, 0x01, 0xD3, 0x40, 0xFD, 0x00, 0x03, 0xFC, 0x0B, 0xF0,
-    0x00, 0x07, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xC1, 0x80, 0x60, 0x00, 0xFE, 0x18, 0xC6, 0x60, 0x0F, 0xF0, 0xAB, 0x2A,
-    0xC0, 0x7F, 0x82, 0xAC, 0xEB, 0x03, 0xFC, 0x0B, 0xF2, 0xFC, 0x2F, 0xD0, 0x0F, 0x43, 0xD0, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0xFF, 0xD0, 0x3F, 0xF0, 0x0F, 0xFC, 0x07,
-    0xFE, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x2A, 0x90, 0x00, 0x0F, 0xFF, 0x0B, 0xFF, 0x43, 0xFF, 0xC2,
-    0xFF, 0xC0, 0xFF, 0xD0, 0xBF, 0xE0, 0x3F, 0xF0, 0x2F, 0xF4, 0x0F, 0xFC, 0x0F, 0xFC, 0x07, 0xFE,
-    0x03, 0xFF, 0x03, 0xFF, 0x42, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xD0, 0x2A, 0x90, 0x2A, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0xBC, 0x03, 0xFC, 0x1F, 0xD0, 0xFE, 0x07,
-    0xF4, 0x3F, 0xC2, 0xFC, 0x0F, 0xE0, 0x7F, 0x07, 0xF4, 0x2F, 0xC0, 0xFD, 0x0F, 0xE0, 0x2E, 0x00,
-    0xF4, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xF0, 0x0F, 0xE0, 0x1F,
-    0xC0, 0x2F, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0B, 0xC0, 0x7F, 0x5F, 0xE0, 0x3F,
-    0xCF, 0xF0, 0x1F, 0xD3, 0xF8, 0x07, 0xF1, 0xFC, 0x02, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x01, 0xF4, 0x0B, 0xC0, 0x3F, 0xC3, 0xFC, 0x1F, 0xE0, 0x2F, 0xD1, 0xFE,
-    0x0F, 0xF0, 0x0F, 0xF0, 0xBF, 0x03, 0xF8, 0x03, 0xF4, 0x2F, 0x81, 0xFC, 0x00, 0xF4, 0x0B, 0x80,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xD0, 0x1F, 0xF4, 0xFF, 0x82, 0xA9, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x07, 0x00,
-    0x2F, 0x00, 0xBF, 0x03, 0xFD, 0x0F, 0xF0, 0x3F, 0x80, 0x7F, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC, 0x03,
-    0xFE, 0x00, 0xFD, 0x00, 0x2C, 0x00, 0x08, 0x00, 0x00, 0xA0, 0x00, 0x7C, 0x00, 0x7F, 0x00, 0x2F,
-    0xD0, 0x0B, 0xF8, 0x01, 0xFD, 0x01, 0xFF, 0x07, 0xFD, 0x2F, 0xF4, 0x3F, 0xD0, 0x3F, 0x40, 0x2C,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07,
-    0xFF, 0x41, 0xFF, 0xC0, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x55, 0x47, 0xFF, 0x40, 0x00, 0xBF, 0xF4,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x41, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xD7, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x0F, 0xF0, 0xBF, 0xFF, 0xFE, 0x07, 0xF4, 0x1F, 0xF0, 0x2F, 0xFF, 0xFC, 0x0B, 0xF8, 0x1F, 0xF0,
-    0x0F, 0xFF, 0xF0, 0x0F, 0xF8, 0x2F, 0xF0, 0x0F, 0xFF, 0xD0, 0x0F, 0xFC, 0x3F, 0xF4, 0x2F, 0xFF,
-    0xF0, 0x0F, 0xFC, 0x15, 0x50, 0xBF, 0xFF, 0xFC, 0x05, 0x54, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xDF, 0xFF, 0xE0, 0x00, 0x00,
-    0x3F, 0xFF, 0x83, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0xD0, 0x02, 0xF4, 0x02, 0xF8, 0x03, 0xF8, 0x03,
-    0xF4, 0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF4, 0x07, 0xF4, 0x07, 0xF4, 0x07, 0xF4, 0x0B, 0xF4, 0x0B,
-    0xF4, 0x0B, 0xF4, 0x0F, 0xF4, 0x02, 0xF0, 0x00, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x2F, 0xFC, 0x3F, 0xFC, 0x3F,
-    0xFD, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xDF, 0xFF, 0xF4, 0x0E,
-    0x0F, 0xF3, 0xF8, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x0F, 0xE2, 0xFC, 0x00,
-    0x0F, 0xE2, 0xFC, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x1F, 0xEB, 0xF8, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0x1A, 0x94,
-    0x1A, 0x4B, 0xF0, 0x0F, 0xC1, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xF0, 0x01, 0xBF, 0xD0, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x20, 0x00, 0x00, 0xF7, 0xDF, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xEF, 0x40, 0x00, 0x06,
-    0x3C, 0x21, 0x00, 0x00, 0xB3, 0xD1, 0xF0, 0x81, 0x1F, 0x1F, 0x9F, 0x7C, 0x3E, 0xFB, 0xFF, 0xFF,
-    0x47, 0xFF, 0xF5, 0xBF, 0xD0, 0x07, 0xFD, 0x1F, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0x7C, 0x3D, 0xF7,
-    0xE8, 0xF0, 0x00, 0x4F, 0x00, 0x0A, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xF0, 0x3F, 0xF9, 0x5F, 0xF0, 0xBF, 0xE5, 0x7F,
-    0xE0, 0x3D, 0x00, 0x1F, 0xE0, 0xF8, 0x00, 0x3F, 0xC0, 0x50, 0x00, 0x3F, 0xC0, 0x80, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xBF, 0xFC, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x80, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0E, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x01, 0xF8, 0x3F, 0xF5, 0x6F, 0xF0, 0x00, 0x1F, 0xC1, 0xF4, 0x00, 0xBF, 0x40,
-    0x01, 0xFC, 0x08, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0x80,
-    0x00, 0x1B, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0xE0,
-    0x00, 0x07, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x40, 0x00, 0x02, 0xF8,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x04, 0x00, 0x2F, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFD, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x7F,
-    0xF0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x90, 0x06, 0xFE, 0x40, 0x00, 0x2D, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xEF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFD, 0x5B, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xBF, 0x40, 0x3F, 0x60, 0x00, 0x0F, 0xE0,
-    0x0F, 0xD0, 0x00, 0x03, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xC0,
-    0x7F, 0x40, 0x00, 0x0F, 0xE0, 0x1F, 0xD0, 0x00, 0x07, 0xF8, 0x0B, 0xF4, 0x00, 0x07, 0xFC, 0x02,
-    0xFC, 0x00, 0x1F, 0xFE, 0x00, 0xBF, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xC0, 0x1F, 0xFE, 0x00, 0x0F,
-    0xF0, 0x07, 0xFD, 0x00, 0x00, 0xBC, 0x01, 0xFF, 0x00, 0x00, 0x07, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x40, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x01, 0x54, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xD0, 0x00, 0x2F, 0xFC,
-    0x0F, 0xF8, 0x00, 0x0F, 0xFF, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0xC2, 0xFF, 0xC0, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x55, 0x00, 0xBF, 0x00, 0x07, 0xF8, 0x03, 0xF8, 0x00, 0x2F, 0xF0, 0x0F, 0xD0,
-    0x00, 0xBF, 0xC0, 0xBF, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xFC, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x01,
-    0xFE, 0x01, 0xFF, 0x00, 0x0B, 0xF0, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0xFE, 0x00,
-    0xFF, 0xD0, 0x0B, 0xF4, 0x01, 0x55, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1E, 0x38, 0x2C, 0x1C, 0x3D, 0xDD, 0x3E, 0xDD, 0x3D, 0xDD,
-    0x3D, 0x3D, 0x2F, 0xFC, 0x0F, 0xF8, 0x02, 0x90, 0x00, 0x10, 0x00, 0xB4, 0x01, 0xF4, 0x03, 0xB8,
-    0x0E, 0x38, 0x2E, 0xBD, 0x3F, 0xFE, 0x00, 0x7C, 0x00, 0x7C, 0x5A, 0x92, 0xFF, 0xCB, 0x00, 0x2C,
-    0x00, 0xBF, 0x82, 0xAB, 0xC0, 0x0B, 0x58, 0x3D, 0xBF, 0xF3, 0xFF, 0x81, 0x50, 0x00, 0x06, 0xA0,
-    0xBF, 0xC7, 0x40, 0x2D, 0x90, 0xFF, 0xF3, 0xE2, 0xEF, 0x03, 0xBD, 0x1E, 0x7F, 0xF4, 0x6E, 0x40,
-    0x00, 0x03, 0xFF, 0xFA, 0xAF, 0x80, 0x1E, 0x00, 0xF4, 0x03, 0xC0, 0x1F, 0x00, 0xBC, 0x03, 0xF0,
-    0x0F, 0x80, 0x69, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x01, 0xD2, 0xD0, 0x78, 0xB4, 0x0B, 0xFC, 0x03,
-    0xEF, 0x43, 0xC0, 0xF0, 0xF4, 0x7C, 0x2F, 0xFE, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x0F,
-    0xF8, 0x2C, 0x1D, 0x34, 0x0F, 0x38, 0x0F, 0x2F, 0xFF, 0x07, 0xFF, 0x00, 0x0E, 0x2F, 0xFD, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xE4, 0x00, 0xFF, 0xFF, 0xF8, 0x07, 0xFF,
-    0xFF, 0xF4, 0x1F, 0xF9, 0x1F, 0xF0, 0x7F, 0x80, 0x1F, 0xC1, 0xFC, 0x00, 0x3F, 0x0B, 0xF0, 0x00,
-    0xFD, 0x2F, 0xC0, 0x03, 0xF4, 0xBF, 0x00, 0x1F, 0xE3, 0xFD, 0x00, 0x7F, 0x8F, 0xF4, 0x02, 0xFE,
-    0x3F, 0xD0, 0x0B, 0xF8, 0xFF, 0x80, 0x2F, 0xF3, 0xFE, 0x00, 0xFF, 0xCF, 0xF8, 0x03, 0xFF, 0x1F,
-    0xC0, 0xE2, 0xCB, 0x03, 0x7D, 0xCE, 0xF7, 0x7B, 0xDD, 0xEF, 0x4B, 0xAF, 0xFD, 0x3F, 0xF0, 0x7F,
-    0x00, 0x0A, 0x00, 0xFC, 0x07, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0xFF,
-    0xF7, 0xFF, 0xD0, 0x00, 0x00, 0x1A, 0x82, 0xFF, 0xC9, 0x0B, 0x40, 0x1E, 0x00, 0xB8, 0x07, 0xC0,
-    0xBE, 0x0F, 0xE0, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x41, 0xFF, 0xC0, 0x07, 0x40, 0x1D,
-    0x1F, 0xF0, 0x6F, 0xD0, 0x07, 0x9E, 0xBE, 0xBF, 0xF6, 0xFF, 0x80, 0x00, 0xE0, 0x02, 0xF0, 0x07,
-    0xF0, 0x0D, 0xF0, 0x3C, 0xF0, 0xB9, 0xF8, 0xFF, 0xFC, 0x55, 0xF4, 0x00, 0xF0, 0x00, 0xF0, 0x55,
-    0x52, 0xFF, 0xCB, 0x00, 0x2C, 0x00, 0xFF, 0x82, 0xAB, 0xC0, 0x0B, 0x69, 0xBC, 0xFF, 0xF2, 0xFE,
-    0x00, 0x06, 0xA4, 0xBF, 0xD7, 0x40, 0x2D, 0x90, 0xFF, 0xF3, 0xE1, 0xEF, 0x03, 0xED, 0x0F, 0x7F,
-    0xF8, 0x7F, 0x80, 0xAA, 0xAB, 0xFF, 0xF0, 0x07, 0x80, 0x2D, 0x00, 0xF4, 0x03, 0xC0, 0x2F, 0x00,
-    0xFC, 0x03, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x03, 0xDB, 0x41, 0xD0, 0xE0, 0x78, 0xB8,
-    0x0B, 0xFC, 0x03, 0xFF, 0x43, 0xD0, 0xF0, 0xF4, 0x7C, 0x2F, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x3F, 0xF0, 0xB0, 0x78, 0xE0, 0x3C, 0xE0, 0x3C, 0x7F, 0xFC, 0x1F, 0xFC, 0x00, 0x3C,
-    0xBF, 0xF4, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x1F,
-    0xD0, 0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x3F,
-    0xC0, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x0F,
-    0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00,
-    0xFF, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x80,
-    0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x3F,
-    0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x02,
-    0xFD, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80,
-    0x00, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
-    0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x0F,
-    0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F,
-    0xF0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC2, 0xE0, 0x00, 0x00, 0xBC,
-    0x3E, 0x00, 0x00, 0x0F, 0xC7, 0xD0, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x1F, 0x4B, 0xC0, 0x00,
-    0x01, 0xF0, 0xFC, 0x00, 0x00, 0x7F, 0xDF, 0xD0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xBF, 0xC0, 0x3F, 0xFF, 0xC3, 0xE4, 0x0B, 0xFF,
-    0xFC, 0x7D, 0x00, 0xFF, 0xDF, 0x8B, 0xC0, 0x1F, 0xFC, 0xF8, 0xBC, 0x02, 0xFF, 0x9F, 0x4F, 0xC0,
-    0x3F, 0xF6, 0xF0, 0xF8, 0x03, 0xFF, 0x7F, 0x1F, 0x40, 0x3F, 0xF7, 0xE1, 0xF0, 0x03, 0xFF, 0xFE,
-    0x2F, 0x00, 0x3F, 0xFF, 0xD3, 0xF0, 0x02, 0xFF, 0xFE, 0x7F, 0xBC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x1F, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00,
-    0x7D, 0x3F, 0x00, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x00, 0x68, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFA, 0xFC, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0xBE, 0xBC, 0x3F, 0xF4, 0x0B, 0xFF, 0xC3, 0xFF, 0x40, 0xBF, 0xE8, 0x3F, 0xFC, 0x0B, 0xE0,
-    0x03, 0xFF, 0xD0, 0xBC, 0x00, 0x2F, 0xFF, 0xDF, 0xD6, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x3E,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x02, 0xAB, 0xFE, 0xA9, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFA, 0x40, 0x2F, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x82, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0xD0, 0x01,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x2F, 0xE0, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFF, 0xFD, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xFF,
-    0xFC, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xAF, 0xFE, 0xBF, 0xEF, 0xFA, 0xA4, 0x00,
-    0x7F, 0xF0, 0xFF, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0xC2, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x1F, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0xD5, 0xAF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x7F, 0xE0, 0x0F, 0xC0, 0x7F,
-    0x00, 0x07, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0x5B, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xF4,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x7F,
-    0xFB, 0xF8, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x07, 0xF0, 0x00, 0x1F, 0xFD, 0x07, 0xF8, 0x0F, 0xD0,
-    0x00, 0x0F, 0xFD, 0x2F, 0xE0, 0x3F, 0x80, 0x00, 0x02, 0xF8, 0xBF, 0x80, 0xFF, 0x00, 0x04, 0x07,
-    0xF2, 0xFE, 0x03, 0xFC, 0x00, 0xB4, 0x2F, 0xCB, 0xF8, 0x0F, 0xF4, 0x07, 0xFF, 0xFF, 0x2F, 0xE0,
-    0x3F, 0xE0, 0x3F, 0xFF, 0xF4, 0xFF, 0xC1, 0xFF, 0x80, 0xFF, 0xFF, 0x81, 0x55, 0x01, 0x55, 0x00,
-    0x6F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x01,
-    0xF8, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x03,
-    0xF0, 0x00, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x41, 0xF0, 0x3F, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xFF, 0xBF, 0xFB, 0xFE, 0xA0, 0x0F,
-    0xCB, 0xFC, 0x7E, 0x00, 0x03, 0xF3, 0xFF, 0x6F, 0x40, 0x00, 0xFD, 0xFF, 0xEB, 0xD0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xBF, 0xFC, 0x00, 0x02, 0xFF, 0xDB, 0xFF, 0x00, 0x00, 0xBF,
-    0xF2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0xFF,
-    0x83, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xC0, 0x00, 0x3A, 0x94,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0x3F, 0xFF, 0xFF,
-    0x80, 0x7F, 0x3F, 0xD0, 0x1F, 0xD0, 0x7F, 0x3F, 0x00, 0x07, 0xE0, 0x7F, 0x3F, 0x00, 0x03, 0xF0,
-    0x7F, 0x3E, 0x19, 0x43, 0xF0, 0x7F, 0x3E, 0x1F, 0xC3, 0xF0, 0x7F, 0x3E, 0x1F, 0xC3, 0xF0, 0x7F,
-    0x3E, 0x1F, 0xC3, 0xF0, 0x7F, 0x3E, 0x1F, 0xC2, 0xB0, 0xBF, 0x3E, 0x0F, 0xC0, 0x00, 0xBF, 0x3E,
-    0x0F, 0xE0, 0x00, 0xBF, 0x3E, 0x0F, 0xF8, 0x00, 0xFF, 0x3E, 0x07, 0xFF, 0xEF, 0xFF, 0x3E, 0x02,
-    0xFF, 0xFF, 0xFF, 0x14, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x5A, 0xBE, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0x5F, 0xD5, 0x00, 0x00, 0x2F, 0xFF, 0xFD,
-    0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x07,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x02, 0xF4, 0x2F, 0xF0, 0x00, 0x0F, 0x80, 0x3F,
-    0xC0, 0x00, 0x3D, 0x00, 0xFE, 0x00, 0x00, 0xF4, 0x03, 0xF8, 0x00, 0x03, 0xE0, 0x0F, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x1B,
-    0xE3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x00, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00,
-    0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xF5, 0x40, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xF4, 0x10, 0x00, 0x00,
-    0x3F, 0xEB, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF,
-    0x80, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x01, 0xE7, 0xFE, 0x6C, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x01, 0xFF,
-    0xFF, 0x40, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x61, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xF5,
-    0x6B, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFB, 0xF4, 0x5A, 0x00, 0xFF,
-    0xF0, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0x00, 0x00, 0x2F, 0xF8, 0x0F, 0xC0, 0x00, 0x0B, 0xFD,
-    0x03, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0x00, 0x00, 0x3F, 0xF0,
-    0x0F, 0xFF, 0xE9, 0x4F, 0xFC, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0xD0,
-    0x3F, 0xBF, 0xFF, 0xAF, 0xFC, 0x0F, 0xC0, 0xFF, 0xA7, 0xFF, 0xC3, 0xF0, 0x3F, 0xC0, 0xFF, 0xFF,
-    0xFD, 0xBF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x69,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1D, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xC0, 0x00, 0x28, 0x00,
-    0x00, 0x1F, 0xF8, 0x01, 0xBF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x01, 0xFF, 0xE0, 0x02, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0x40, 0xFF, 0xFD, 0x80, 0xBF, 0x3F,
-    0x00, 0x3F, 0xCF, 0xC0, 0x0F, 0xE3, 0xF0, 0x03, 0xF8, 0xFC, 0x00, 0xFF, 0x3F, 0x00, 0x3F, 0xCF,
-    0xC0, 0x0F, 0xFB, 0xF4, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x40, 0x1B,
-    0xFE, 0x40, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x6A, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFB, 0xFF, 0xFF, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xFF, 0xD0, 0x0B, 0xFF, 0xE0, 0x02, 0xFF,
-    0xF8, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x2F, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x15, 0x54, 0x00,
-    0x02, 0xB8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC1, 0xD0, 0x00, 0xFF, 0xBF, 0x40, 0x03,
-    0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xF4, 0x0B, 0xFF, 0xF9, 0x00, 0x2F, 0xFF, 0x1F, 0x40, 0xBF, 0xFF,
-    0xFD, 0x01, 0x4F, 0xFF, 0xF4, 0x06, 0xFF, 0xFF, 0x9A, 0x6F, 0xFF, 0x90, 0xBF, 0xBF, 0xFC, 0x07,
-    0xFA, 0xE7, 0xF0, 0xBF, 0xC0, 0x0F, 0xEF, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x01, 0xFF, 0xF4, 0x00,
-    0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFB, 0xFC,
-    0x00, 0x3F, 0xEF, 0x6F, 0xD0, 0x03, 0xFA, 0xF8, 0xFD, 0x00, 0x7F, 0x6F, 0x8F, 0xE0, 0x07, 0xF2,
-    0xF8, 0xFE, 0x00, 0x7F, 0x1F, 0x8B, 0xE0, 0x03, 0xF1, 0xF8, 0xBE, 0x00, 0x3F, 0x1F, 0x8F, 0xE0,
-    0x03, 0xF1, 0xF8, 0xFE, 0x00, 0x3F, 0x1F, 0x8F, 0xE0, 0x03, 0xF5, 0xFC, 0xFD, 0x00, 0x3F, 0x9F,
-    0xCF, 0xD0, 0x03, 0xF9, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFC, 0x01,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x01,
-    0xFF, 0x00, 0x03, 0xFD, 0x5A, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x95, 0x55, 0x54, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xEF, 0xEF, 0xF4, 0x07, 0xFE, 0x3F, 0x5F, 0xF8, 0x2F, 0xD0,
-    0xFD, 0x0F, 0xD0, 0x2D, 0x03, 0xF4, 0x0D, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC2, 0xFF, 0xFF, 0xFF, 0xF8,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x7F, 0xD0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xC0, 0x3F, 0x40,
-    0x90, 0x2F, 0xD0, 0xFD, 0x0F, 0xD0, 0x7F, 0xD3, 0xF4, 0xFF, 0x80, 0x7F, 0xEF, 0xEF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
-    0x00, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0x02, 0xF8, 0x03, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x3F,
-    0x40, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFA, 0xAA, 0xAA, 0xFF, 0x01, 0xFC, 0x00, 0x00, 0xBF,
-    0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x40, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x3F, 0x80,
-    0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xF7, 0xDB, 0xF4, 0x2F, 0x83, 0xD1, 0xF8, 0x0A, 0x03, 0xD0, 0x60, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x03, 0xD0, 0xB0, 0x2F,
-    0xC3, 0xD2, 0xF8, 0x0F, 0xF7, 0xEF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x15, 0x80, 0x3F,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xA0, 0x1F, 0xFD, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0x02, 0xFF, 0xFD, 0x00, 0x0B, 0xE7, 0xFD, 0x00, 0x3F, 0x47, 0xFD, 0x00, 0xFD, 0x07, 0xFD,
-    0x03, 0xF4, 0x07, 0xFD, 0x0F, 0xC0, 0x07, 0xFD, 0x14, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x06, 0x00,
-    0x19, 0x50, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xC1, 0xBF, 0xFF, 0xFC, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x0B, 0xFC, 0xFD, 0x02, 0xFF, 0x0F, 0xD0,
-    0xBF, 0xC0, 0xBD, 0x2F, 0xF0, 0x0B, 0xEB, 0xFC, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x40, 0x80, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xE2, 0xFE, 0x00, 0xFD, 0x0F,
-    0xF8, 0x0F, 0xD0, 0x3F, 0xD0, 0xFC, 0x00, 0xFF, 0x4F, 0xC0, 0x03, 0xFE, 0xFC, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x7F, 0xF8, 0x3F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x3F, 0xDB, 0xE0, 0x0F, 0xF8,
-    0x7F, 0x02, 0xFE, 0x07, 0xF0, 0xBF, 0x80, 0x3F, 0x1F, 0xF0, 0x03, 0xFB, 0xFC, 0x00, 0x3F, 0xFF,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0xAA, 0xAA, 0xA8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0xAA, 0xA8, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0x00, 0x07, 0x8E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0x8F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x8F, 0xFF, 0x00, 0x01, 0xFF,
-    0xF8, 0xFF, 0xFC, 0x00, 0x3F, 0xEF, 0x8F, 0xEF, 0xF0, 0x0F, 0xF8, 0xF8, 0xFC, 0xBF, 0xC3, 0xFE,
-    0x0F, 0x8F, 0xC2, 0xFC, 0x0F, 0x80, 0xF8, 0xFC, 0x0B, 0x40, 0x60, 0x0F, 0x8F, 0xC0, 0x10, 0x00,
-    0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00,
-    0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x2A, 0xAA, 0xAA, 0xBF, 0xD0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x2A, 0xAA, 0xAA,
-    0xAF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00,
-    0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC0,
-    0x00, 0x06, 0x00, 0xF8, 0xFC, 0x01, 0x00, 0xF8, 0x0F, 0x8F, 0xC0, 0xF4, 0x3F, 0xE0, 0xF8, 0xFC,
-    0x2F, 0xD0, 0xFF, 0x8F, 0x8F, 0xCB, 0xFC, 0x03, 0xFE, 0xF8, 0xFE, 0xFF, 0x00, 0x0F, 0xFF, 0x8F,
-    0xFF, 0x80, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x8F, 0xF8, 0x00, 0x00, 0x07, 0xF8,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x78, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00,
-    0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xEA, 0xAA, 0xAF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD1, 0xFF, 0xAA, 0xAA,
-    0xAB, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0x00,
-    0x0B, 0x40, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x7F, 0xF3, 0xFF, 0xD0, 0x3F, 0xFE, 0x3F, 0xFF, 0xC3, 0xFF, 0xE3, 0xEB, 0xFC, 0x0B,
-    0xBE, 0x3D, 0x1F, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0x03, 0xE3, 0xD0,
-    0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0x13, 0xE3, 0xD0, 0x50, 0x1F, 0xFE, 0x3D, 0x3F, 0x83, 0xFF,
-    0xE3, 0xEF, 0xFC, 0x1F, 0xFE, 0x3F, 0xFF, 0x40, 0x2F, 0xF7, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0xAF, 0xD1, 0xF8,
-    0x1F, 0xFF, 0xEB, 0xE1, 0xFF, 0xFF, 0xFF, 0x4F, 0xFD, 0x7F, 0xFD, 0x7F, 0xC0, 0x3F, 0xF1, 0xFD,
-    0x00, 0x7F, 0xCB, 0xF0, 0x00, 0xFF, 0x2F, 0xC0, 0x03, 0xF8, 0x7F, 0x80, 0x2F, 0xC1, 0xFF, 0xEB,
-    0xFF, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x02, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x01, 0xF4, 0x00, 0x01,
-    0xFF, 0xFF, 0xF8, 0x7F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xAB, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x0F,
-    0xF8, 0x00, 0x1F, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xF0, 0x01, 0xFF,
-    0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x3F, 0xC0, 0x03,
-    0xFD, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0x3F, 0xD1, 0xFF, 0x40, 0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xD0,
-    0x07, 0xFC, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFC, 0x00,
-    0x2F, 0xFF, 0xD0, 0x5F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xCB, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x0C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xDB, 0xF8, 0x00, 0x00, 0x7F, 0xC7,
-    0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0xFF,
-    0x80, 0x07, 0xFD, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x1F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B,
-    0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x2F, 0xD0, 0x3F, 0xC0,
-    0x0B, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x2F, 0xD0, 0x3F,
-    0xC0, 0x0B, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x2F, 0xD0,
-    0x3F, 0xC0, 0x0B, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x1A,
-    0x80, 0x2A, 0x80, 0x07, 0xF4, 0x0B, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x00,
-    0x2F, 0xD0, 0x3F, 0xC0, 0x0B, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF,
-    0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x0B, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40,
-    0xFF, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x0B, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF,
-    0x40, 0xFF, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F,
-    0x80, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xEB, 0xFF,
-    0xFF, 0xFA, 0xFF, 0xFF, 0xFE, 0x00, 0x15, 0x6A, 0x80, 0x3F, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFE,
-    0x0F, 0xFF, 0xEA, 0xA8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x00, 0x07, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x34, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xDF, 0xF8, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF8, 0x3F, 0xFC, 0x01, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0x80, 0x7F, 0xE0, 0x7F, 0x1F, 0xC0, 0x03,
-    0xE0, 0x07, 0xDB, 0xE0, 0x00, 0xF4, 0x01, 0xF6, 0xF8, 0x00, 0x3D, 0x00, 0x7D, 0x7F, 0x00, 0x6F,
-    0xD0, 0x7F, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x07, 0xFF, 0xF0, 0xFF, 0xF8, 0x00, 0x16, 0x80, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xE4, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFD,
-    0x1C, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x02, 0x81, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x47, 0xFE, 0x1F, 0xF8, 0xBF, 0xF3, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xD1, 0xFF, 0x87, 0xFE, 0x2F, 0xFC,
-    0xFF, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x3F, 0xFC, 0x0B, 0xE2, 0xFF, 0xFC, 0x2F, 0xCF, 0xF3, 0xFC,
-    0xBF, 0x3F, 0x83, 0xFF, 0xF4, 0x7F, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xA4, 0x00, 0x54, 0x00, 0x00,
-    0x0F, 0xFF, 0x02, 0xF8, 0xBF, 0xFF, 0x4B, 0xF3, 0xF8, 0xBF, 0xBF, 0x8F, 0xE0, 0xBF, 0xFC, 0x06,
-    0x80, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x54, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x40, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x07, 0xFC, 0x05, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x07,
-    0xFF, 0xE4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFE, 0x40, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x03, 0xFE, 0x94, 0x00, 0x04, 0x02, 0xFF, 0xFF, 0xFF, 0xA5, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0x5A, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x05, 0xAB, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0x6B,
-    0xFF, 0xC0, 0x05, 0xAF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF,
-    0xE9, 0x40, 0x03, 0xE9, 0x50, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_12_boldBitmaps[38297] = {
+    0x72, 0xA6, 0xD5, 0xE4, 0xE4, 0xE4, 0xE3, 0x9E, 0x39, 0xE3, 0x9E, 0x3A, 0xE3, 0xAE, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x4E, 0x5A, 0xC6, 0x97, 0x77, 0x77, 0x29, 0xF9, 0x1A, 0xF9, 0x1F, 0xCA, 0x1F,
+    0xCA, 0x1F, 0xD0, 0x9F, 0xD0, 0xAF, 0xD0, 0x9F, 0xCA, 0x1F, 0xD0, 0x9F, 0xC9, 0x1F, 0xCA, 0x09,
+    0xFC, 0x2F, 0xC1, 0x9F, 0xA2, 0xFC, 0x19, 0xFA, 0x2F, 0xC1, 0x9F, 0xA2, 0xFC, 0x19, 0xFA, 0x19,
+    0xFC, 0x19, 0xFC, 0x19, 0xFC, 0x19, 0xAA, 0xAA, 0x92, 0xAA, 0xAA, 0xA1, 0x70, 0xE9, 0x2A, 0xE7,
+    0x70, 0xE9, 0x2A, 0xE7, 0x79, 0xE9, 0x2F, 0x77, 0x9E, 0x3E, 0xA7, 0x7A, 0xE3, 0xEA, 0x77, 0xF3,
+    0xEA, 0x71, 0xAF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xFF, 0x92, 0x99, 0x99,
+    0x9A, 0xF9, 0x99, 0xFA, 0x99, 0x99, 0x99, 0x70, 0xAE, 0xA2, 0xF7, 0x7A, 0xE9, 0x2F, 0x77, 0xF9,
+    0x2F, 0x77, 0xF9, 0x19, 0xF7, 0x2F, 0xFF, 0xFF, 0xF2, 0x9F, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF,
+    0xA2, 0x99, 0x99, 0x9F, 0xC9, 0x99, 0xFA, 0x99, 0x99, 0x99, 0x70, 0xAF, 0x2F, 0x97, 0x6F, 0xC2,
+    0xF9, 0x76, 0xFA, 0x2F, 0x77, 0xFA, 0x19, 0xF7, 0x7A, 0xAA, 0xA9, 0x19, 0xAA, 0xAA, 0x71, 0x77,
+    0x75, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xEA, 0x97, 0x39, 0xFF, 0xE7, 0xAF,
+    0xFE, 0x96, 0xAF, 0xFF, 0x7F, 0xCA, 0xE9, 0x9A, 0x79, 0xF9, 0x0E, 0x72, 0xAF, 0x1E, 0x72, 0x9F,
+    0x90, 0xE7, 0x29, 0xFC, 0xAE, 0x73, 0xFF, 0xDA, 0x97, 0x1F, 0xFF, 0x97, 0x0A, 0xFF, 0xF9, 0x70,
+    0x9A, 0xFF, 0xD9, 0x71, 0xEA, 0xFE, 0x71, 0xE1, 0xAF, 0xC9, 0x29, 0xC9, 0x2E, 0x2F, 0xC9, 0x2F,
+    0xCA, 0xE1, 0xAF, 0xC9, 0x1F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x2A, 0xFF, 0xFE, 0xA5, 0x9A, 0xAF,
+    0xFA, 0x97, 0x49, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9D, 0xA7, 0x77, 0x50, 0x77, 0x09,
+    0x97, 0x72, 0xE7, 0x71, 0xAD, 0xA5, 0xAD, 0xA7, 0xE4, 0x9F, 0xD5, 0xEA, 0x4D, 0xA1, 0xAC, 0xA3,
+    0x9E, 0x5D, 0x29, 0xD3, 0xE9, 0x5D, 0x3D, 0x2A, 0xE6, 0xD9, 0x1A, 0xD1, 0x9E, 0x7F, 0xEA, 0x1E,
+    0xA7, 0x9F, 0xD1, 0x9E, 0x72, 0xAD, 0xA2, 0xEA, 0x77, 0x0A, 0xE1, 0xAD, 0xA7, 0x29, 0xE9, 0x0F,
+    0xD7, 0x1F, 0x0A, 0xCA, 0x1A, 0xD7, 0xAE, 0x90, 0xD3, 0xD7, 0xEA, 0x1D, 0x3D, 0x6F, 0x2D, 0xA1,
+    0xAD, 0x59, 0xEA, 0x2A, 0xFD, 0xA5, 0xF4, 0xFD, 0x5A, 0xE9, 0x5A, 0xDA, 0x6F, 0x75, 0x39, 0xAD,
+    0xA9, 0x73, 0xFF, 0x97, 0x0E, 0x91, 0x9E, 0x79, 0xD5, 0xE6, 0xAD, 0x5A, 0xD6, 0xAD, 0x5A, 0xD6,
+    0x9E, 0x39, 0xE7, 0xF1, 0xF9, 0x70, 0xFF, 0xA7, 0x2F, 0xD9, 0x72, 0xAF, 0xC7, 0x3A, 0xFE, 0x4A,
+    0x99, 0x19, 0xF0, 0xAE, 0x91, 0x9E, 0x90, 0xAE, 0x91, 0x9E, 0x90, 0xAE, 0x1F, 0x39, 0xEA, 0xF1,
+    0xFA, 0x39, 0xFD, 0x91, 0xFD, 0xA9, 0x99, 0xFD, 0x2A, 0xFF, 0xFE, 0x92, 0xFF, 0xFF, 0x3F, 0xFD,
+    0xA0, 0xAC, 0x59, 0xAF, 0xA9, 0x60, 0x9A, 0xAA, 0xAA, 0x9A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFA, 0x0A,
+    0xF9, 0x0A, 0xF9, 0x0A, 0xF9, 0x0A, 0xF9, 0x0F, 0xCA, 0x00, 0x59, 0xDA, 0x6E, 0xA5, 0xAE, 0x59,
+    0xE9, 0x5F, 0x59, 0xE9, 0x5F, 0x59, 0xEA, 0x5A, 0xE6, 0xF5, 0x9E, 0x95, 0xAE, 0x6F, 0x6F, 0x6E,
+    0xA6, 0xEA, 0x59, 0xEA, 0x59, 0xEA, 0x59, 0xEA, 0x6E, 0xA6, 0xF6, 0xF6, 0xF9, 0x5A, 0xEA, 0x59,
+    0xF6, 0xF6, 0xFA, 0x59, 0xF6, 0xFA, 0x5A, 0xF6, 0xFA, 0x5A, 0xF9, 0x5F, 0xC5, 0xAF, 0x97, 0x20,
+    0x0A, 0xD9, 0x6A, 0xE7, 0xEA, 0x6A, 0xE9, 0x6F, 0x6A, 0xE9, 0x6F, 0x6A, 0xE7, 0xEA, 0x6F, 0x6A,
+    0xE6, 0x9E, 0x96, 0xF6, 0xF6, 0xF6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xF6, 0xF6, 0xF5, 0x9E,
+    0xA5, 0xAE, 0xA5, 0xF9, 0x49, 0xF5, 0xFA, 0x49, 0xF9, 0x4A, 0xF5, 0xFA, 0x4F, 0xC4, 0x9F, 0xA4,
+    0xFC, 0x4A, 0xF9, 0x77, 0x59, 0xAC, 0x73, 0xE3, 0x92, 0x9A, 0x1E, 0x19, 0xD2, 0xE9, 0xAD, 0x9A,
+    0xE1, 0xAF, 0xFF, 0x2A, 0xFF, 0xC9, 0x59, 0xFD, 0x69, 0xFF, 0xC9, 0x2F, 0xFF, 0xA1, 0xFA, 0xDA,
+    0xAE, 0x29, 0xCA, 0x0A, 0xDA, 0x1C, 0x93, 0x91, 0xAD, 0xA7, 0x2A, 0xCA, 0x97, 0x73, 0x77, 0x2A,
+    0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE4, 0xAF, 0xFF, 0x0A, 0xFF, 0xF0, 0xAF, 0xFF,
+    0x5A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x19, 0xDA, 0x40, 0x09, 0xFC, 0xA0, 0x9F, 0xC9,
+    0x1F, 0xC2, 0xFC, 0x19, 0xFA, 0x1F, 0xC2, 0xFC, 0x1A, 0xFA, 0x19, 0xAA, 0xAA, 0x20, 0x9F, 0xFF,
+    0x09, 0xFF, 0xF0, 0x9F, 0xFF, 0x00, 0x19, 0x99, 0x1A, 0xE9, 0x0F, 0xA0, 0xFA, 0x0F, 0xC9, 0xFC,
+    0x77, 0x76, 0xAC, 0x74, 0x9E, 0x74, 0xAD, 0xA7, 0x4E, 0x97, 0x39, 0xE7, 0x4A, 0xE7, 0x4E, 0xA7,
+    0x4E, 0x97, 0x3A, 0xE7, 0x4E, 0xA7, 0x4E, 0x97, 0x39, 0xE7, 0x4A, 0xE7, 0x4E, 0xA7, 0x39, 0xE9,
+    0x73, 0xAE, 0x74, 0xF7, 0x4E, 0xA7, 0x39, 0xE9, 0x73, 0xF7, 0x4E, 0xA7, 0x39, 0xE9, 0x73, 0xAE,
+    0x74, 0xF7, 0x39, 0xEA, 0x73, 0xAE, 0x97, 0x3F, 0x74, 0xF7, 0x39, 0xEA, 0x73, 0xF7, 0x4F, 0x73,
+    0x9E, 0xA7, 0x3A, 0xE9, 0x73, 0xF7, 0x39, 0xF7, 0x3A, 0xEA, 0x73, 0xF9, 0x73, 0xF7, 0x39, 0xE9,
+    0x73, 0xE7, 0x5C, 0xA7, 0x59, 0x97, 0x60, 0x69, 0x72, 0xFD, 0x95, 0x9F, 0xFA, 0x4E, 0xA1, 0x9E,
+    0x92, 0xAE, 0x3A, 0xE2, 0xEA, 0x4E, 0x90, 0x9E, 0x90, 0xAC, 0x1E, 0xA0, 0xAE, 0x0A, 0xE0, 0xF0,
+    0xF0, 0xAE, 0x0A, 0xE0, 0xF0, 0xF0, 0xAE, 0x0F, 0x0A, 0xE0, 0xF0, 0xF0, 0x9D, 0xA0, 0xF0, 0xF9,
+    0x09, 0xA1, 0xF0, 0xAF, 0x3A, 0xF0, 0xAF, 0xA1, 0x9F, 0xA0, 0x9F, 0xFF, 0xA1, 0xFF, 0xF2, 0xAF,
+    0xFE, 0x3F, 0xFD, 0x5F, 0xF9, 0x69, 0xFA, 0x40, 0x3A, 0xE5, 0xAF, 0xC4, 0xAF, 0xD4, 0xFE, 0x4D,
+    0x9F, 0x4A, 0x1F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0xAF, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x49, 0x99, 0x69, 0xAF, 0xE9, 0x29, 0xFF, 0xD9, 0x19, 0xFF, 0xE1,
+    0x9D, 0xA9, 0x2A, 0xEA, 0x09, 0xA6, 0xF7, 0x1A, 0xE7, 0x1F, 0x71, 0xF7, 0x0F, 0xA7, 0xAF, 0x96,
+    0xAF, 0xA5, 0x9F, 0xD5, 0xAF, 0xD9, 0x4F, 0xE9, 0x4A, 0xFE, 0x5F, 0xFF, 0x99, 0xFF, 0xF9, 0xAF,
+    0xFF, 0x9F, 0xFF, 0xCA, 0x19, 0xAF, 0xA9, 0x4A, 0xFF, 0xC9, 0x2F, 0xFE, 0x2C, 0xA9, 0x39, 0xF7,
+    0x2E, 0x72, 0xE7, 0x2E, 0x70, 0x9F, 0x39, 0xFF, 0x4A, 0xFE, 0x94, 0xFF, 0xC9, 0x39, 0x99, 0x9A,
+    0xFC, 0x71, 0xF9, 0x70, 0x9E, 0xA0, 0x9C, 0xA9, 0x29, 0xFA, 0x0A, 0xFF, 0xEA, 0x0F, 0xFF, 0x99,
+    0xFF, 0xF0, 0xAF, 0xFE, 0x29, 0xAF, 0xDA, 0x92, 0x79, 0xD9, 0x72, 0xEA, 0x71, 0xFA, 0x70, 0xAF,
+    0xA7, 0x9F, 0xCA, 0x7E, 0xAE, 0x6E, 0x9A, 0xE5, 0xAD, 0xA0, 0xAE, 0x49, 0xE1, 0xF4, 0xE9, 0x1F,
+    0x3A, 0xDA, 0x2F, 0x2A, 0xFF, 0xFC, 0x9F, 0xFF, 0xD9, 0xFF, 0xFD, 0x99, 0x99, 0x99, 0xAA, 0xAF,
+    0xCA, 0x97, 0xF9, 0x71, 0xF9, 0x71, 0xF9, 0x70, 0x9F, 0x97, 0x70, 0x76, 0xFF, 0xE2, 0xFF, 0xE2,
+    0xFF, 0xE2, 0xE7, 0x2E, 0x71, 0x9E, 0x71, 0x9E, 0x97, 0x09, 0xFE, 0xA9, 0x39, 0xFF, 0xD9, 0x19,
+    0xFF, 0xE1, 0x9A, 0xA9, 0x99, 0x99, 0xFC, 0x71, 0xF7, 0x1F, 0x90, 0x96, 0xF9, 0x0D, 0xA9, 0x19,
+    0xFC, 0x90, 0xFF, 0xF0, 0x9F, 0xFE, 0xA0, 0xAF, 0xFE, 0x1F, 0xFD, 0xA3, 0x9A, 0xFA, 0xA4, 0x59,
+    0x9A, 0xA9, 0x99, 0x5A, 0xFF, 0x4F, 0xFD, 0x3F, 0xFE, 0x29, 0xE9, 0x71, 0xE9, 0x72, 0xE7, 0x29,
+    0xE0, 0xAE, 0xA9, 0x3A, 0xFF, 0xDA, 0x2F, 0xFF, 0xA1, 0xFD, 0xA9, 0xAF, 0x1F, 0xC3, 0xAE, 0xA0,
+    0xFA, 0x4F, 0x0F, 0x94, 0xF0, 0xAE, 0xA4, 0xF0, 0x9F, 0x92, 0xAF, 0x1F, 0xFF, 0xA1, 0xAF, 0xFE,
+    0x3A, 0xFF, 0xC5, 0x9A, 0xFA, 0x93, 0x75, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x79, 0x9F,
+    0x70, 0x9E, 0xA7, 0x0A, 0xE9, 0x70, 0xF9, 0x70, 0xF7, 0x09, 0xF7, 0x0A, 0xF7, 0x0F, 0xA7, 0x9F,
+    0xA7, 0xAF, 0x97, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x7A, 0xFC, 0x7F, 0xCA, 0x69, 0xFC, 0x92, 0x49,
+    0xAE, 0xA9, 0x7F, 0xFC, 0x5F, 0xAA, 0xFA, 0x3A, 0xE3, 0xAE, 0x3E, 0xA4, 0xE9, 0x2E, 0xA4, 0xEA,
+    0x2F, 0x39, 0xE9, 0x2A, 0xFA, 0x9A, 0xF4, 0xAF, 0xFC, 0xA5, 0x9F, 0xEA, 0x5A, 0xFF, 0xD3, 0xF9,
+    0x2A, 0xEA, 0x1A, 0xEA, 0x4F, 0x1F, 0x94, 0xAE, 0x90, 0xF9, 0x4F, 0x90, 0xFC, 0xA9, 0x99, 0xFC,
+    0x90, 0x9F, 0xFF, 0xC2, 0xFF, 0xF9, 0x3F, 0xFD, 0x96, 0xAF, 0xAA, 0x30, 0x39, 0xAD, 0xA9, 0x69,
+    0xFF, 0x93, 0x9F, 0xFD, 0x3E, 0xA2, 0x9F, 0x19, 0xDA, 0x49, 0xE1, 0xAD, 0x6E, 0x90, 0xE6, 0xAD,
+    0xA0, 0xE6, 0xAE, 0x0A, 0xD6, 0xF0, 0xAE, 0x4A, 0xF1, 0xFC, 0xAF, 0xE1, 0xAF, 0xFF, 0x2A, 0xFF,
+    0xE4, 0xAA, 0xEA, 0xF7, 0x2E, 0xA1, 0x99, 0x5A, 0xE9, 0x1F, 0xFF, 0x2F, 0xFE, 0xA1, 0x9F, 0xFE,
+    0x3A, 0xAF, 0xDA, 0x97, 0x72, 0x0A, 0xEA, 0x1F, 0xC1, 0xFC, 0x1F, 0xC0, 0x9F, 0xC0, 0xAF, 0xC9,
+    0x77, 0x77, 0x3A, 0xEA, 0x1F, 0xC1, 0xFC, 0x1F, 0xC0, 0x9F, 0xC0, 0xAF, 0xC9, 0x72, 0xAE, 0xA3,
+    0xAF, 0x3F, 0xC3, 0xFC, 0x29, 0xFC, 0x91, 0x9F, 0xC9, 0x77, 0x77, 0x77, 0xAA, 0xAA, 0xAA, 0x2F,
+    0xD2, 0xFC, 0xA2, 0xFC, 0x92, 0xFC, 0x29, 0xFA, 0x2A, 0xF9, 0x2F, 0xC2, 0x9F, 0xC2, 0x77, 0x77,
+    0x4A, 0x97, 0x69, 0xEA, 0x74, 0x9F, 0xCA, 0x72, 0xAF, 0xE9, 0x70, 0xAF, 0xEA, 0x79, 0xFF, 0xA7,
+    0x9F, 0xF9, 0x70, 0xFF, 0x97, 0x2F, 0xE7, 0x4F, 0xFC, 0xA9, 0x79, 0xFF, 0xFC, 0x97, 0xAF, 0xFF,
+    0xCA, 0x79, 0xAF, 0xFD, 0x97, 0x19, 0xAF, 0xE9, 0x75, 0xAF, 0x97, 0x70, 0x9A, 0x90, 0x72, 0x99,
+    0x3A, 0xFF, 0xD3, 0xFF, 0xEA, 0x1A, 0xFF, 0xF1, 0x99, 0x99, 0x77, 0x75, 0x99, 0x99, 0xAA, 0xAA,
+    0x3F, 0xFE, 0x91, 0x9F, 0xFE, 0xA1, 0xFE, 0xAA, 0xAA, 0xAA, 0x00, 0x77, 0x3A, 0xA7, 0x70, 0xEA,
+    0x76, 0xFD, 0x97, 0x3A, 0xFE, 0x97, 0x3A, 0xFE, 0xA7, 0x3A, 0xFE, 0xA7, 0x3A, 0xFF, 0x97, 0x2A,
+    0xFE, 0xA7, 0x29, 0xFD, 0xA7, 0x9A, 0xFF, 0xA3, 0x9A, 0xFF, 0xFC, 0x99, 0xAF, 0xFF, 0xA9, 0x2A,
+    0xFF, 0xDA, 0x95, 0xAF, 0xEA, 0x71, 0xAE, 0xA9, 0x74, 0xAA, 0x97, 0x70, 0x77, 0x49, 0xFA, 0x7A,
+    0xFF, 0xA4, 0xFF, 0xEA, 0x2A, 0xFA, 0x99, 0x9F, 0x92, 0xDA, 0x5F, 0x39, 0x6A, 0xE9, 0x72, 0x9E,
+    0x97, 0x3E, 0x97, 0x3E, 0x97, 0x29, 0xE9, 0x72, 0xF7, 0x2A, 0xEA, 0x70, 0xAF, 0xC7, 0x9F, 0xD9,
+    0x7F, 0xD9, 0x70, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xE9, 0x73, 0xA9, 0x77, 0x77,
+    0x77, 0x75, 0x99, 0x99, 0x73, 0xF7, 0x29, 0xF7, 0x2A, 0xF7, 0x2F, 0xC7, 0x2F, 0xC9, 0x40, 0x75,
+    0x97, 0x71, 0xAF, 0xDA, 0x74, 0xAF, 0xFD, 0x97, 0x1F, 0x93, 0x9E, 0x97, 0xEA, 0x7A, 0xD6, 0xE9,
+    0x71, 0xAD, 0x49, 0xDA, 0x2A, 0xCA, 0xD3, 0xD4, 0xE2, 0xDA, 0xE3, 0xAC, 0x92, 0x9D, 0xA1, 0x9C,
+    0x91, 0xD9, 0x2A, 0xCA, 0x2A, 0xDA, 0x1A, 0xC2, 0xAC, 0x92, 0xAC, 0xA2, 0xE9, 0x1C, 0xA2, 0x9C,
+    0x92, 0xAC, 0xA2, 0xEA, 0x1C, 0xA2, 0x9C, 0xA2, 0xD9, 0x2E, 0xA1, 0xAC, 0xAA, 0xAD, 0xA1, 0xAD,
+    0x3F, 0x19, 0xFE, 0x0A, 0xDA, 0x3F, 0x91, 0x9E, 0x9F, 0xD4, 0x9F, 0x69, 0xEA, 0x6F, 0xA7, 0x71,
+    0xAF, 0xC7, 0x97, 0x0F, 0xEA, 0x99, 0xAE, 0x70, 0x9F, 0xFF, 0xC9, 0x70, 0x9F, 0xFF, 0xA7, 0x2A,
+    0xFF, 0xE7, 0x49, 0xAF, 0xCA, 0xA9, 0x77, 0x71, 0x70, 0xF7, 0x71, 0xFA, 0x77, 0xAF, 0xC7, 0x7F,
+    0xD9, 0x75, 0x9F, 0xDA, 0x75, 0xFA, 0xE7, 0x5E, 0xA9, 0xEA, 0x73, 0xAE, 0x90, 0xF7, 0x3F, 0x1A,
+    0xE9, 0x71, 0x9E, 0xA1, 0x9E, 0xA7, 0x1F, 0x92, 0xF7, 0x1F, 0x3F, 0xA7, 0xAF, 0x39, 0xF7, 0xFC,
+    0xAA, 0xAA, 0xAF, 0x95, 0x9F, 0xFF, 0xDA, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xFC,
+    0x3F, 0xC7, 0xFC, 0x91, 0x9F, 0xC7, 0xAF, 0xA1, 0xFC, 0x97, 0x9F, 0xC0, 0xFF, 0xCA, 0x95, 0xFF,
+    0xF4, 0xFF, 0xFC, 0x3F, 0x91, 0x99, 0xFA, 0x2F, 0x5F, 0x2F, 0x59, 0xE2, 0xF5, 0xAE, 0x2F, 0x49,
+    0xEA, 0x2F, 0xFF, 0xC3, 0xFF, 0xFA, 0x3F, 0xFF, 0xD2, 0xFA, 0xAA, 0xAA, 0xFD, 0x1F, 0x59, 0xF9,
+    0x0F, 0x6A, 0xEA, 0x0F, 0x6F, 0xC0, 0xFA, 0x99, 0x99, 0xAF, 0xD0, 0xFF, 0xFE, 0xA0, 0xFF, 0xFE,
+    0x90, 0xFF, 0xFE, 0x1F, 0xFF, 0xD2, 0xFF, 0xEA, 0x93, 0x77, 0x71, 0x9A, 0xFD, 0xA9, 0x59, 0xFF,
+    0xDA, 0x4F, 0xFF, 0x93, 0xFF, 0xFC, 0x3A, 0xFF, 0xAA, 0xE3, 0xFD, 0x97, 0x1A, 0xFC, 0x73, 0xFC,
+    0x73, 0x9F, 0xA7, 0x3A, 0xFA, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xD7, 0x3F,
+    0xD9, 0x72, 0xAF, 0xDA, 0x92, 0x99, 0xAC, 0x19, 0xFF, 0xFE, 0x2F, 0xFF, 0xE2, 0x9F, 0xFF, 0xD3,
+    0xAF, 0xFF, 0xC4, 0xAF, 0xFF, 0x59, 0xAF, 0xFD, 0x00, 0xFF, 0xDA, 0x96, 0xFF, 0xFC, 0xA4, 0xFF,
+    0xFE, 0x92, 0xFF, 0xFF, 0x2F, 0xA0, 0x99, 0x9A, 0xFE, 0x1F, 0xA5, 0x9F, 0xC9, 0x0F, 0xA7, 0xFA,
+    0x0F, 0xA7, 0x9F, 0x0F, 0xA7, 0x0F, 0x0F, 0xA7, 0x0F, 0x0F, 0xA7, 0x0A, 0xE0, 0xFA, 0x70, 0xF0,
+    0xFA, 0x70, 0xF0, 0xFA, 0x7F, 0xC0, 0xFA, 0x39, 0x9A, 0xFD, 0x0F, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF,
+    0xC9, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF2, 0xFF, 0xFD, 0xA3, 0xFF, 0xEA, 0x95, 0x0A, 0xAA, 0xAA,
+    0xAF, 0xE9, 0x9F, 0xFF, 0xC0, 0x9F, 0xFF, 0xC0, 0x9F, 0xFA, 0xAA, 0xA9, 0x09, 0xEA, 0x71, 0x9E,
+    0xA7, 0x19, 0xEA, 0x71, 0x9E, 0xA7, 0x1A, 0xFA, 0xAA, 0xE9, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9,
+    0x2A, 0xFF, 0xD9, 0x2A, 0xF7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7, 0x1F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA9,
+    0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x0F, 0xFF, 0xD9, 0xFF, 0xFD, 0xAF, 0xFF, 0xE0, 0x0A, 0xAA, 0xAA,
+    0xFE, 0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xCA, 0xAA, 0xA9, 0x99, 0x1F, 0x71, 0xF7, 0x1E, 0xA7, 0x1F,
+    0xFE, 0x2F, 0xFE, 0x19, 0xFF, 0xE1, 0x9F, 0xFE, 0x19, 0xF9, 0x99, 0x99, 0x92, 0x9F, 0x70, 0xAF,
+    0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC,
+    0x70, 0x59, 0xAF, 0xEA, 0xA7, 0xAF, 0xFF, 0xA5, 0xFF, 0xFD, 0xA4, 0xFF, 0xFF, 0x3A, 0xFD, 0xA9,
+    0x29, 0x99, 0xAA, 0x3F, 0xCA, 0x75, 0x9F, 0xC7, 0x6A, 0xF9, 0x76, 0xFC, 0x77, 0xFC, 0x77, 0xFC,
+    0x5A, 0xA9, 0x95, 0xFC, 0x5F, 0xFC, 0x0F, 0xC5, 0xAF, 0xF9, 0xFC, 0x94, 0x9F, 0xFA, 0xAF, 0xC7,
+    0x9F, 0xCA, 0x9F, 0xCA, 0x7F, 0x2F, 0xEA, 0x99, 0x09, 0x9A, 0xF2, 0xAF, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xFC, 0x4F, 0xFF, 0xF5, 0xAF, 0xFF, 0xC9, 0x79, 0xAF, 0xDA, 0x94, 0x9F, 0x7F, 0x90, 0x9F, 0x7F,
+    0x90, 0x9F, 0x7F, 0x90, 0x9F, 0x7F, 0x90, 0x9F, 0x7F, 0xA0, 0xAF, 0x7F, 0xA0, 0xAF, 0x7F, 0xA0,
+    0xAF, 0x7F, 0xA0, 0xAF, 0x7F, 0xA0, 0xAF, 0x96, 0xFA, 0x0A, 0xF9, 0x59, 0xFC, 0x0A, 0xFA, 0x99,
+    0x99, 0x99, 0xAF, 0xC0, 0xAF, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
+    0xD0, 0xFF, 0xFF, 0xD0, 0xFC, 0xA5, 0xAF, 0xC0, 0xFC, 0xA5, 0xAF, 0xC0, 0xFC, 0xA5, 0xAF, 0xC0,
+    0xFC, 0xA5, 0xAF, 0xC0, 0xFA, 0x0A, 0xEA, 0x0A, 0xEA, 0x0A, 0xEA, 0x0A, 0xEA, 0x09, 0xEA, 0x09,
+    0xEA, 0x09, 0xEA, 0x09, 0xEA, 0x09, 0xEA, 0x09, 0xEA, 0x09, 0xF0, 0x9F, 0x09, 0xF0, 0x9F, 0x0A,
+    0xF0, 0xAF, 0x0A, 0xF0, 0xFC, 0x9F, 0xC9, 0xFC, 0x90, 0x71, 0xFA, 0x71, 0xF9, 0x70, 0x9F, 0x97,
+    0x09, 0xF7, 0x19, 0xF7, 0x1A, 0xF7, 0x1A, 0xF7, 0x1A, 0xF7, 0x1F, 0xA7, 0x1F, 0xA7, 0x1F, 0x97,
+    0x1F, 0x97, 0x1F, 0x97, 0x09, 0xF7, 0x19, 0xF7, 0x1A, 0xF7, 0x1A, 0xF7, 0x1A, 0xEA, 0x71, 0xFA,
+    0x71, 0xFA, 0x2D, 0xA9, 0x09, 0xFC, 0x91, 0x9F, 0xFE, 0x29, 0xFF, 0xE2, 0xAF, 0xFD, 0x3F, 0xFD,
+    0x93, 0x9A, 0xAF, 0xCA, 0x77, 0x40, 0x1A, 0xE9, 0x2F, 0xC5, 0xF9, 0x1A, 0xFA, 0x5F, 0x2F, 0xC6,
+    0xF1, 0xAF, 0x96, 0xF0, 0x9F, 0xA6, 0x9F, 0x0F, 0xC7, 0x9E, 0xA9, 0xFA, 0x79, 0xEA, 0xFC, 0x70,
+    0xAF, 0xF9, 0x70, 0xAF, 0xEA, 0x71, 0xFF, 0x72, 0xFE, 0x97, 0x2F, 0xEA, 0x72, 0xFF, 0xA7, 0x09,
+    0xFF, 0xD7, 0x9F, 0xFE, 0x69, 0xF0, 0xFE, 0x5A, 0xF0, 0x9F, 0xE9, 0x3A, 0xF1, 0x9F, 0xE9, 0x2F,
+    0xC2, 0xAF, 0xEA, 0x1F, 0xC3, 0xAF, 0xEA, 0x00, 0x0F, 0x97, 0x1F, 0x97, 0x1F, 0x72, 0xF7, 0x2F,
+    0x72, 0xF7, 0x2F, 0x72, 0xF7, 0x19, 0xF7, 0x19, 0xF7, 0x19, 0xF7, 0x19, 0xF7, 0x19, 0xF7, 0x1A,
+    0xF7, 0x1A, 0xF7, 0x1A, 0xF7, 0x1A, 0xFA, 0xFF, 0x9F, 0xFF, 0xD9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9,
+    0xFF, 0xFD, 0x90, 0x0F, 0xC7, 0x0F, 0xC2, 0xFC, 0xA6, 0x9F, 0xC1, 0x9F, 0xD6, 0xFD, 0x19, 0xFD,
+    0x95, 0xFD, 0x90, 0x9F, 0xE4, 0xAF, 0xD9, 0x09, 0xFE, 0x93, 0xFE, 0x90, 0x9F, 0xEA, 0x29, 0xFE,
+    0x90, 0x9F, 0xF2, 0xFF, 0x90, 0x9F, 0xF9, 0x1F, 0xF9, 0x0A, 0xEA, 0xFC, 0x0A, 0xFF, 0xA0, 0xAE,
+    0xAA, 0xF9, 0xFA, 0xFA, 0x0A, 0xEA, 0x9F, 0xFC, 0x9F, 0xA0, 0xAF, 0x0F, 0xFC, 0x0F, 0xA0, 0xAF,
+    0x0A, 0xFE, 0xA0, 0xFA, 0x0A, 0xF1, 0xFE, 0x99, 0xFC, 0x0F, 0xC1, 0xFE, 0x09, 0xFC, 0x0F, 0xC1,
+    0x9F, 0xCA, 0x09, 0xFC, 0x0F, 0xC2, 0xFC, 0x90, 0xAF, 0xC0, 0xFC, 0x91, 0xAF, 0x1A, 0xFC, 0x0F,
+    0xC9, 0x19, 0xF1, 0xFD, 0x0F, 0xC9, 0x70, 0xFD, 0x00, 0x75, 0xF0, 0x9F, 0x96, 0xF0, 0x9F, 0xC5,
+    0x9E, 0xA0, 0x9F, 0xC9, 0x49, 0xEA, 0x0A, 0xFD, 0x49, 0xEA, 0x0A, 0xFD, 0x93, 0xAE, 0xA0, 0xAF,
+    0xE3, 0xAE, 0x90, 0xFF, 0x92, 0xAE, 0x90, 0xFF, 0xC2, 0xF9, 0x0F, 0xFC, 0x91, 0xF9, 0x0F, 0xC9,
+    0xF1, 0xF9, 0x0F, 0xC0, 0xF9, 0x0F, 0x1F, 0xC0, 0xAE, 0xA0, 0xF0, 0x9F, 0xC1, 0xF9, 0xF0, 0x9F,
+    0xC1, 0xAF, 0xF0, 0x9F, 0xC1, 0x9F, 0xF0, 0xAF, 0xC2, 0xFF, 0x0A, 0xFC, 0x29, 0xFE, 0x0A, 0xFC,
+    0x3F, 0xE0, 0xFD, 0x3A, 0xFD, 0x0F, 0xD4, 0xFC, 0xA0, 0x59, 0xAF, 0xA9, 0x72, 0x9F, 0xFD, 0xA7,
+    0x9F, 0xFF, 0xC5, 0x9F, 0xDA, 0x9A, 0xFD, 0x4F, 0xC9, 0x4A, 0xFA, 0x2A, 0xF7, 0xFC, 0x2F, 0xA7,
+    0x9F, 0x90, 0x9F, 0x71, 0xFC, 0x0A, 0xF7, 0x19, 0xF0, 0xFA, 0x71, 0x9F, 0x0F, 0xA7, 0x2F, 0x0F,
+    0x97, 0x2F, 0x9F, 0xA7, 0x2F, 0x9F, 0xA7, 0x19, 0xF0, 0xFC, 0x71, 0xAF, 0x0A, 0xFA, 0x79, 0xFC,
+    0x0A, 0xFD, 0xA9, 0x90, 0x99, 0xFE, 0x09, 0xFF, 0xFF, 0xDA, 0x1F, 0xFF, 0xFD, 0x91, 0x9F, 0xFF,
+    0xFC, 0x3A, 0xFF, 0xFE, 0x59, 0xFF, 0xFC, 0x70, 0x9A, 0xFE, 0xA9, 0x77, 0x71, 0x77, 0xFF, 0xCA,
+    0x4F, 0xFE, 0x92, 0xFF, 0xF9, 0x1F, 0x39, 0xF1, 0xF5, 0xE9, 0x0F, 0x5E, 0xA0, 0xF4, 0x9F, 0x0F,
+    0x99, 0x9A, 0xAF, 0xA0, 0xFF, 0xFC, 0x99, 0xFF, 0xFC, 0x09, 0xFF, 0xF1, 0x9F, 0xFE, 0x29, 0xFF,
+    0xA9, 0x3A, 0xF7, 0x1A, 0xF7, 0x1A, 0xF9, 0x70, 0xAF, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F,
+    0xCA, 0x70, 0xFC, 0xA7, 0x00, 0x79, 0xAA, 0xA9, 0x77, 0xFF, 0xC9, 0x72, 0xAF, 0xFE, 0xA7, 0x0A,
+    0xFF, 0xFC, 0xA6, 0x9F, 0xC9, 0x29, 0xFC, 0x95, 0xFC, 0x6F, 0xC4, 0x9F, 0x79, 0xF9, 0x3F, 0xC7,
+    0x0F, 0xA3, 0xF9, 0x70, 0x9F, 0x29, 0xF7, 0x19, 0xF2, 0x9F, 0x72, 0xF2, 0x9F, 0x72, 0xF2, 0x9F,
+    0x72, 0xF2, 0x9F, 0x72, 0xF2, 0x9F, 0x93, 0x99, 0x29, 0xF3, 0xFA, 0x3E, 0x90, 0xAF, 0x3F, 0xD9,
+    0x99, 0xFF, 0xCA, 0x3A, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 0xA5, 0x9F, 0xFF, 0xE7, 0xAF, 0xFF, 0xCA,
+    0x70, 0x9F, 0xFF, 0xC7, 0x29, 0xAF, 0xFE, 0x76, 0x9F, 0xF7, 0x6A, 0xFE, 0xA7, 0x6A, 0xFE, 0xA7,
+    0x77, 0x0A, 0xFE, 0xA9, 0x6A, 0xFF, 0xD5, 0xFF, 0xF4, 0xEA, 0x39, 0xE9, 0x3E, 0xA4, 0xAD, 0xA3,
+    0xEA, 0x4A, 0xE3, 0xEA, 0x4A, 0xE3, 0xEA, 0x4F, 0x3E, 0xA3, 0xAE, 0xA3, 0xFF, 0xF9, 0x29, 0xFF,
+    0xEA, 0x39, 0xFF, 0xE4, 0x9F, 0xFF, 0x39, 0xFC, 0x90, 0x9F, 0x92, 0xAF, 0x92, 0x9F, 0x2A, 0xFA,
+    0x29, 0xF9, 0x1A, 0xFA, 0x29, 0xFA, 0x1A, 0xFA, 0x29, 0xFC, 0x1F, 0xCA, 0x29, 0xFC, 0x90, 0xFD,
+    0x29, 0xFC, 0xA0, 0xFD, 0x29, 0xFD, 0x77, 0x10, 0x5A, 0xAF, 0xCA, 0x97, 0xAF, 0xFD, 0x95, 0xAF,
+    0xFE, 0x59, 0xFD, 0xAA, 0xE9, 0x5A, 0xF9, 0x49, 0x6F, 0x97, 0x5F, 0x76, 0xFA, 0x75, 0xAF, 0xC9,
+    0x73, 0x9F, 0xFA, 0x97, 0x0F, 0xFE, 0xA7, 0xAF, 0xFE, 0x97, 0xAF, 0xFD, 0x72, 0x9A, 0xFE, 0x74,
+    0xAF, 0xC9, 0x74, 0xAF, 0xA2, 0xDA, 0x6A, 0xFA, 0x1F, 0xD9, 0x90, 0x9A, 0xFC, 0x90, 0xAF, 0xFF,
+    0xF0, 0x9F, 0xFF, 0xF9, 0x09, 0xFF, 0xFD, 0xA5, 0x9A, 0xFE, 0xA9, 0x77, 0x70, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x9F,
+    0xFF, 0xFD, 0x96, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9,
+    0x75, 0xFA, 0x75, 0xFA, 0x75, 0xFA, 0x74, 0x9F, 0xA7, 0x49, 0xFA, 0x74, 0x9F, 0xA7, 0x49, 0xFA,
+    0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC6, 0xFC, 0x95, 0xFF, 0xE9, 0x5F, 0xCA, 0xFC, 0x95,
+    0xAF, 0xAF, 0xC9, 0x5A, 0xFA, 0xFC, 0x95, 0xAF, 0xAF, 0xC9, 0x5A, 0xFA, 0xAF, 0x6A, 0xF9, 0xAF,
+    0x6A, 0xF9, 0xAF, 0x6A, 0xF9, 0xAF, 0x69, 0xF9, 0xAF, 0x69, 0xF9, 0xAF, 0x69, 0xF0, 0xAF, 0x69,
+    0xF0, 0x9F, 0x6A, 0xF0, 0x9F, 0xA5, 0xFC, 0x09, 0xFE, 0xAA, 0xFE, 0x1F, 0xFF, 0xF1, 0xFF, 0xFE,
+    0xA1, 0xAF, 0xFF, 0xD3, 0xFF, 0xFC, 0xA4, 0xAF, 0xFD, 0x97, 0x74, 0xFA, 0x71, 0x9F, 0x09, 0xF7,
+    0x1A, 0xEA, 0x1F, 0x97, 0x0F, 0x91, 0xFC, 0x7A, 0xF2, 0xAF, 0x7F, 0xC3, 0xFA, 0x59, 0xF9, 0x3F,
+    0xC5, 0xFC, 0x4A, 0xF9, 0x39, 0xFC, 0x49, 0xFC, 0x3F, 0xC9, 0x5F, 0xC2, 0x9F, 0xC6, 0xAF, 0xA1,
+    0xAF, 0xC6, 0x9F, 0xC1, 0xFC, 0x97, 0xFC, 0x9A, 0xFC, 0x70, 0xAF, 0xFE, 0x70, 0x9F, 0xFD, 0x97,
+    0x1F, 0xFD, 0x72, 0xAF, 0xFC, 0x72, 0x9F, 0xF9, 0x73, 0xFF, 0x74, 0xFF, 0x74, 0x9F, 0xDA, 0x60,
+    0x77, 0x73, 0xFC, 0x97, 0x7A, 0xF9, 0xAF, 0xA7, 0x7F, 0xC0, 0x9F, 0xC7, 0x7F, 0xC1, 0xFC, 0x76,
+    0x9F, 0xA1, 0xFC, 0x76, 0x9F, 0x91, 0xAF, 0x94, 0x9A, 0xA9, 0x4A, 0xF2, 0xAF, 0xA4, 0xF4, 0xFC,
+    0x29, 0xFC, 0x3A, 0xFA, 0x3F, 0xA3, 0xFC, 0x3F, 0xD2, 0x9F, 0x93, 0xFC, 0x91, 0xAF, 0xD9, 0x1A,
+    0xF4, 0xAF, 0xA1, 0xFF, 0x1F, 0xC4, 0x9F, 0xC0, 0xFF, 0xC9, 0x0F, 0xA4, 0x9F, 0xC9, 0xFF, 0xD9,
+    0xF9, 0x5F, 0xFF, 0xFF, 0xC6, 0xFF, 0xD9, 0x9F, 0xFC, 0x6A, 0xFF, 0xC1, 0xFF, 0xC6, 0x9F, 0xFA,
+    0x1A, 0xFE, 0xA7, 0xFF, 0x29, 0xFE, 0x97, 0xFF, 0x3F, 0xE7, 0x0F, 0xE9, 0x3A, 0xFD, 0x70, 0xAF,
+    0xD4, 0x9F, 0xCA, 0x40, 0x0A, 0xEA, 0x79, 0xF2, 0xFA, 0x6F, 0x92, 0x9F, 0x94, 0xFA, 0x4F, 0xC3,
+    0xAF, 0x6F, 0xC1, 0xAF, 0x96, 0xAF, 0xA9, 0xFA, 0x70, 0xFF, 0xD7, 0x2F, 0xF9, 0x72, 0xAF, 0xDA,
+    0x74, 0xFD, 0x75, 0xFD, 0x74, 0xAF, 0xE7, 0x3F, 0xF9, 0x71, 0xFF, 0xD7, 0x0A, 0xFF, 0xDA, 0x69,
+    0xFC, 0x9A, 0xFC, 0x95, 0xFD, 0x1F, 0xD4, 0xAF, 0xC9, 0x19, 0xFC, 0xA2, 0x9F, 0xCA, 0x3F, 0xD9,
+    0x1F, 0xD4, 0x9F, 0xD0, 0xAF, 0xCA, 0x5A, 0xFC, 0xA0, 0xAF, 0x70, 0xFA, 0x0F, 0x96, 0x9F, 0x1F,
+    0xC6, 0xFA, 0x19, 0xF9, 0x49, 0xF3, 0xFC, 0x4F, 0xA3, 0x9F, 0x92, 0xAF, 0x5F, 0xC2, 0xFA, 0x59,
+    0xFA, 0x0A, 0xF7, 0xFC, 0x0F, 0xC7, 0x9F, 0xFC, 0x97, 0x0F, 0xFC, 0x71, 0xAF, 0xE9, 0x72, 0xFE,
+    0x73, 0xAF, 0xC9, 0x74, 0xFC, 0x75, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x4A,
+    0xFC, 0x74, 0xAF, 0xC6, 0x09, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xC2, 0x9F, 0xFF, 0xF3, 0xFF, 0xFF,
+    0x39, 0xAA, 0xAF, 0xFE, 0xA7, 0x29, 0xFE, 0x72, 0x9F, 0xE7, 0x29, 0xFE, 0x72, 0x9F, 0xE9, 0x71,
+    0x9F, 0xE9, 0x71, 0x9F, 0xEA, 0x71, 0x9F, 0xF7, 0x19, 0xFF, 0x71, 0x9F, 0xF7, 0x19, 0xFF, 0x97,
+    0x09, 0xFF, 0xC9, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xFC, 0x91, 0xFF, 0xFF, 0xCA, 0x1F, 0xFF, 0xFD,
+    0x1F, 0xFF, 0xFD, 0x90, 0xFF, 0xFF, 0xDA, 0x00, 0x1F, 0xE9, 0x1F, 0xE9, 0x1F, 0xE9, 0x1E, 0xA4,
+    0x9E, 0x94, 0x9E, 0x94, 0x9E, 0x94, 0x9E, 0x94, 0x9E, 0x5A, 0xE5, 0xAE, 0x5A, 0xE5, 0xAE, 0x5A,
+    0xE5, 0xAE, 0x5F, 0x5F, 0x5F, 0x5F, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xE9, 0x49,
+    0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x4A, 0xE5, 0xAF, 0xE9, 0x0A, 0xFE, 0x90,
+    0xAF, 0xE9, 0x0A, 0xFE, 0x90, 0x99, 0xAA, 0x99, 0x99, 0x10, 0x09, 0x70, 0xC7, 0x0C, 0x79, 0xCA,
+    0x69, 0xD6, 0xAD, 0x95, 0xAD, 0xA6, 0xE6, 0xE9, 0x5A, 0xE5, 0x9E, 0x6E, 0xA5, 0xAE, 0x59, 0xE9,
+    0x5E, 0xA5, 0xF5, 0xAE, 0x95, 0xEA, 0x5F, 0x5A, 0xE9, 0x49, 0xF5, 0xF5, 0xAE, 0x94, 0x9E, 0x6D,
+    0xA6, 0xD7, 0x9A, 0x70, 0x97, 0x30, 0xAF, 0xE1, 0xAF, 0xE1, 0xAF, 0xE5, 0xF5, 0xAE, 0x5A, 0xE5,
+    0xAE, 0x5A, 0xE5, 0x9E, 0x59, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x5E, 0x95,
+    0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5F, 0x5F, 0x5F, 0x5F, 0x5A, 0xE5, 0xAE, 0x5A, 0xE5,
+    0xAE, 0x5A, 0xE5, 0xAE, 0x59, 0xE1, 0xAF, 0xE9, 0x0A, 0xFE, 0x90, 0xAF, 0xE9, 0x0A, 0xFE, 0x90,
+    0x99, 0x99, 0x9A, 0x99, 0x00, 0x77, 0x4E, 0x72, 0xAE, 0xA7, 0x0A, 0xFC, 0x96, 0xAF, 0xE9, 0x4A,
+    0xE9, 0x09, 0xE9, 0x2A, 0xDA, 0x4E, 0xA0, 0x77, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF,
+    0xFC, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x09, 0x99, 0x7A, 0xE9, 0x6A,
+    0xEA, 0x6A, 0xF6, 0xAF, 0x97, 0x30, 0x77, 0x29, 0xEA, 0x97, 0xFF, 0xD3, 0xAF, 0xFD, 0x3E, 0x91,
+    0x9F, 0x29, 0xDA, 0x3A, 0xE9, 0x1E, 0x5E, 0x91, 0xE5, 0xEA, 0x1D, 0xA5, 0xEA, 0x1D, 0x95, 0xAE,
+    0x1D, 0x95, 0xAE, 0x1D, 0xA5, 0xF1, 0xFA, 0xAA, 0xFD, 0x1A, 0xFF, 0xF2, 0xFF, 0xF9, 0x19, 0xFF,
+    0xE9, 0x3A, 0xEA, 0x94, 0x77, 0x0E, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x3E,
+    0xA7, 0x3A, 0xDA, 0x19, 0x99, 0x6A, 0xDA, 0xAF, 0xC9, 0x4A, 0xFF, 0xDA, 0x3A, 0xFF, 0xE9, 0x29,
+    0xFC, 0x91, 0xAE, 0x29, 0xF9, 0x3A, 0xD9, 0x19, 0xF4, 0x9D, 0xA1, 0x9F, 0x5E, 0x2F, 0x49, 0xE2,
+    0xF4, 0xF2, 0xFC, 0x99, 0x9F, 0xC2, 0xFF, 0xFA, 0x2A, 0xFF, 0xE4, 0xFF, 0xD9, 0x49, 0xFE, 0xA7,
+    0x09, 0x99, 0x96, 0x77, 0x1A, 0xFA, 0x4A, 0xFE, 0x92, 0x9F, 0xF9, 0x2F, 0x99, 0x09, 0xA2, 0xAE,
+    0x70, 0xF7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0F, 0x70, 0xF7, 0x0F, 0xA7, 0x9F, 0xCA, 0xAC, 0xA3, 0xFF,
+    0xCA, 0x3F, 0xFC, 0x93, 0x9A, 0xFA, 0x90, 0x72, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0xAE, 0x73,
+    0xAE, 0x73, 0xAE, 0x5A, 0xE9, 0x0A, 0xE3, 0x9F, 0xFE, 0x29, 0xFF, 0xF2, 0xFA, 0xAF, 0xE1, 0x9E,
+    0x92, 0xFC, 0xA1, 0xEA, 0x39, 0xFA, 0x1E, 0x94, 0xFA, 0x1E, 0x5F, 0xA1, 0xE5, 0xF9, 0x1E, 0x5F,
+    0x91, 0xEA, 0x3A, 0xFA, 0x1A, 0xFF, 0xFA, 0x2F, 0xFF, 0xA2, 0xAF, 0xFE, 0xA3, 0xFF, 0xEA, 0x49,
+    0xAE, 0xA5, 0x4A, 0xEA, 0x96, 0x9F, 0xF5, 0xFA, 0xAF, 0x3E, 0xA3, 0xAD, 0x91, 0x9E, 0x90, 0x99,
+    0x99, 0xE1, 0xAF, 0xFF, 0x1F, 0xFF, 0xC9, 0x0F, 0xFF, 0xC9, 0x0E, 0xAA, 0x99, 0x96, 0xEA, 0x72,
+    0xF9, 0x71, 0xAF, 0xC9, 0x91, 0x9A, 0xC9, 0x1F, 0xFF, 0x91, 0x9F, 0xFE, 0x92, 0x9F, 0xFD, 0x5A,
+    0xAF, 0xA9, 0x10, 0x76, 0x9F, 0xC4, 0xFD, 0x3A, 0xFD, 0x3E, 0xA6, 0xE9, 0x6E, 0x94, 0xFF, 0xC9,
+    0x0F, 0xFC, 0x90, 0xFF, 0xC9, 0x0A, 0xAF, 0xAA, 0xA3, 0xEA, 0x59, 0xF5, 0x9F, 0x59, 0xF5, 0x9F,
+    0x59, 0xF5, 0x9F, 0x59, 0xF5, 0x9F, 0x5A, 0xF5, 0xAF, 0x30, 0x39, 0xF9, 0x0E, 0xA2, 0xAF, 0xDA,
+    0xEA, 0x1A, 0xFF, 0xEA, 0x1E, 0x90, 0x9F, 0xDA, 0x0A, 0xD9, 0x3F, 0xC9, 0x0E, 0x4A, 0xF9, 0x0D,
+    0xA4, 0x9F, 0x90, 0xDA, 0x5F, 0x90, 0xDA, 0x5F, 0x90, 0xE4, 0x9F, 0x90, 0xE9, 0x29, 0xFC, 0x1A,
+    0xFF, 0xF2, 0xFF, 0xF2, 0xAF, 0xFE, 0x3A, 0xFF, 0xD4, 0x9F, 0x9A, 0xE7, 0x2F, 0x71, 0x9E, 0xA2,
+    0xD9, 0x29, 0xF3, 0xFF, 0xE2, 0x9F, 0xFD, 0x92, 0xAF, 0xFC, 0x93, 0x9A, 0xAF, 0xCA, 0x40, 0x1A,
+    0xE7, 0x3F, 0x73, 0xF7, 0x3E, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x3E, 0xA9, 0xFA, 0x5F, 0xFE, 0x92,
+    0x9F, 0xFF, 0x29, 0xFA, 0x91, 0xAE, 0x29, 0xF4, 0xE9, 0x19, 0xEA, 0x4A, 0xDA, 0x1A, 0xE9, 0x4A,
+    0xDA, 0x1A, 0xE9, 0x4A, 0xDA, 0x1A, 0xE9, 0x4A, 0xDA, 0x1F, 0x94, 0xF1, 0xF9, 0x4F, 0x1F, 0xA4,
+    0xF1, 0xFA, 0x39, 0xF1, 0xFC, 0x3A, 0xF1, 0xFC, 0x3A, 0xF0, 0x0F, 0x1F, 0x09, 0xF0, 0xAF, 0x9A,
+    0xF9, 0x99, 0x99, 0x99, 0x77, 0x2A, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA, 0x1E,
+    0xA1, 0xEA, 0x1E, 0xA1, 0xEA, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x90, 0x49, 0xDA, 0x5A, 0xDA, 0x5F,
+    0x5F, 0x77, 0x77, 0x75, 0xAA, 0xAA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xE9, 0x5E, 0x95, 0xE9, 0x5E,
+    0x95, 0xE6, 0xE6, 0xE6, 0xE6, 0xE5, 0x9E, 0x5A, 0xE5, 0xEA, 0x2A, 0xFC, 0xA2, 0xAF, 0xC9, 0x2F,
+    0xD3, 0xFC, 0x97, 0x40, 0x1F, 0x73, 0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x73, 0xE9, 0x73, 0xE9, 0x73,
+    0xE9, 0x72, 0x9E, 0x73, 0x9E, 0x1F, 0x94, 0x9E, 0x0F, 0x95, 0x9E, 0xAE, 0xA6, 0xAF, 0xE7, 0xAF,
+    0xD7, 0x0A, 0xFC, 0x97, 0x0A, 0xFD, 0x97, 0xFF, 0x96, 0xFF, 0xCA, 0x5F, 0x9F, 0xCA, 0x4F, 0x0A,
+    0xFD, 0x3F, 0x1A, 0xFD, 0x2F, 0x2F, 0xE0, 0x1E, 0x94, 0xE9, 0x39, 0xE4, 0x9E, 0x49, 0xE4, 0xAE,
+    0x4A, 0xE4, 0xAE, 0x4A, 0xE4, 0xF4, 0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA,
+    0x4E, 0xA9, 0x92, 0xFD, 0xA1, 0xFE, 0x1F, 0xE0, 0x77, 0x71, 0x9E, 0x9A, 0xEA, 0x3A, 0xDA, 0x5A,
+    0xFF, 0xD9, 0x9F, 0xD9, 0x3A, 0xFF, 0xFF, 0xE3, 0xFC, 0x91, 0xAF, 0xC9, 0x1F, 0x2F, 0xA3, 0xFA,
+    0x29, 0xE2, 0xF4, 0xF9, 0x3E, 0x91, 0xF4, 0xF4, 0xEA, 0x09, 0xF4, 0xF4, 0xEA, 0x09, 0xF4, 0xF3,
+    0x9E, 0xA0, 0xAF, 0x39, 0xF3, 0x9E, 0xA0, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA0, 0xFA, 0x3A, 0xEA,
+    0x3A, 0xEA, 0x0F, 0xA3, 0xF9, 0x3A, 0xF0, 0xF9, 0x3F, 0x93, 0xFC, 0x0F, 0x92, 0x9F, 0x4F, 0xC0,
+    0x77, 0x0E, 0x0A, 0xEA, 0x94, 0xFF, 0xDA, 0x29, 0xFF, 0xE9, 0x19, 0xFA, 0x90, 0x9F, 0x19, 0xEA,
+    0x39, 0xE1, 0x9E, 0x5E, 0x1A, 0xE5, 0xE9, 0x0A, 0xE5, 0xE9, 0x0A, 0xE4, 0x9E, 0xA0, 0xF9, 0x39,
+    0xEA, 0x0F, 0x93, 0xAE, 0xA0, 0xF9, 0x3A, 0xEA, 0x0F, 0xA3, 0xAF, 0x0F, 0xA3, 0xFC, 0x0F, 0xA3,
+    0xFC, 0x4A, 0xF9, 0x6A, 0xFF, 0x4A, 0xFF, 0xD3, 0xF9, 0x1A, 0xEA, 0x1A, 0xE9, 0x3F, 0x1F, 0x49,
+    0xE9, 0x0E, 0xA5, 0xEA, 0x0E, 0xA5, 0xEA, 0x0E, 0xA5, 0xEA, 0x0F, 0x49, 0xE9, 0x0F, 0xA2, 0x9F,
+    0x90, 0xAF, 0xFF, 0x2F, 0xFE, 0xA2, 0xAF, 0xFD, 0x4A, 0xFF, 0x69, 0xAF, 0x93, 0x70, 0x99, 0x96,
+    0x9E, 0x9F, 0xD9, 0x49, 0xFF, 0xEA, 0x39, 0xFD, 0xA9, 0xAE, 0x93, 0xFC, 0x93, 0xE3, 0xFC, 0x4A,
+    0xD3, 0xFA, 0x49, 0xD9, 0x2F, 0xA4, 0x9D, 0x92, 0xFA, 0x49, 0xDA, 0x2F, 0xC4, 0x9D, 0x92, 0xFC,
+    0xA2, 0x9E, 0x92, 0xFF, 0xFC, 0x29, 0xFF, 0xFA, 0x2A, 0xFF, 0xF3, 0xFF, 0xEA, 0x4F, 0x19, 0xAA,
+    0xA9, 0x5F, 0x73, 0x9F, 0x73, 0xAF, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xF9, 0x77, 0x73, 0x77, 0x59,
+    0xAE, 0x90, 0xEA, 0x5A, 0xFF, 0xDA, 0x4A, 0xFF, 0xEA, 0x4E, 0x91, 0xAF, 0xC9, 0x3A, 0xD9, 0x3F,
+    0xC9, 0x3E, 0x49, 0xF9, 0x3E, 0x5F, 0x4D, 0xA5, 0xF4, 0xDA, 0x5F, 0x4E, 0x49, 0xF4, 0xEA, 0x29,
+    0xFC, 0x4A, 0xFF, 0xF5, 0xFF, 0xEA, 0x5A, 0xFF, 0xDA, 0x6A, 0xFF, 0xCA, 0x79, 0xAD, 0xA9, 0xAD,
+    0xA9, 0xAC, 0x97, 0x1A, 0xFD, 0x97, 0x1A, 0xFD, 0x97, 0x1A, 0xFD, 0x97, 0x1F, 0xCA, 0x97, 0x2D,
+    0xA7, 0x76, 0x1F, 0x9A, 0xDA, 0x2F, 0xFC, 0x2F, 0xFC, 0x2F, 0xDA, 0xAA, 0x2F, 0x96, 0xF7, 0xF7,
+    0xF7, 0xF6, 0x9F, 0x69, 0xF6, 0xAF, 0x6A, 0xF9, 0x5F, 0xC9, 0x5F, 0xCA, 0x40, 0x77, 0x29, 0xAF,
+    0xCA, 0x94, 0xAF, 0xFA, 0x4E, 0x99, 0x99, 0xAC, 0x5D, 0xA7, 0x3E, 0x73, 0xF9, 0x72, 0xFD, 0xA9,
+    0x69, 0xFE, 0xA7, 0x9F, 0xDA, 0x71, 0x9F, 0x93, 0x94, 0xAE, 0xA2, 0xDA, 0x92, 0xFA, 0x1A, 0xFF,
+    0xE9, 0x0A, 0xFF, 0xF1, 0xAF, 0xFE, 0x49, 0xAA, 0xFA, 0x97, 0x71, 0x77, 0x3A, 0x97, 0x0E, 0x97,
+    0x9E, 0x97, 0x9E, 0x97, 0x9E, 0x95, 0xFF, 0xD1, 0xAF, 0xFD, 0x90, 0xFF, 0xEA, 0x3A, 0xE7, 0x0A,
+    0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0F, 0x70, 0xFF, 0x4F, 0xF4, 0xAF, 0xE9,
+    0x39, 0xFE, 0xA7, 0x40, 0x0E, 0x5A, 0xE1, 0xE5, 0xAE, 0x1E, 0x5A, 0xE1, 0xE9, 0x4A, 0xE1, 0xE9,
+    0x4A, 0xE1, 0xE9, 0x4A, 0xE1, 0xEA, 0x4F, 0x90, 0xAD, 0xA4, 0xF9, 0x0A, 0xE4, 0xF9, 0x0A, 0xE4,
+    0xF9, 0x09, 0xF9, 0x1F, 0xC9, 0x09, 0xFF, 0xF9, 0x1F, 0xFF, 0x91, 0xAF, 0xFE, 0xA2, 0xFF, 0xEA,
+    0x3A, 0xFA, 0x40, 0x0F, 0x79, 0xEA, 0x0A, 0xE9, 0x6F, 0x2F, 0x6E, 0xA2, 0xAE, 0x94, 0xAE, 0x93,
+    0xF4, 0xF4, 0xF9, 0x2A, 0xE9, 0x49, 0xF2, 0xF6, 0xF9, 0x0A, 0xEA, 0x6A, 0xF0, 0xF7, 0x0F, 0xFA,
+    0x70, 0xAF, 0xE9, 0x71, 0xFE, 0x72, 0xFD, 0xA7, 0x2F, 0xDA, 0x72, 0xAF, 0xC9, 0x40, 0x0F, 0x73,
+    0xF0, 0xF7, 0x29, 0xEA, 0x0A, 0xE9, 0x71, 0xF9, 0x09, 0xEA, 0x29, 0xD3, 0xF2, 0xF2, 0xF1, 0x9E,
+    0xA2, 0xF9, 0x0A, 0xF9, 0x0A, 0xE9, 0x29, 0xEA, 0x9F, 0xD0, 0xF4, 0xFF, 0xEA, 0xF4, 0xFF, 0xFE,
+    0xA4, 0xAF, 0xFF, 0xD9, 0x49, 0xFF, 0xFD, 0x6F, 0xDA, 0xFE, 0x6F, 0xD0, 0x9F, 0xCA, 0x6A, 0xFA,
+    0x1F, 0xC9, 0x69, 0xF2, 0x9F, 0x77, 0x70, 0x2F, 0x4A, 0xEA, 0x39, 0xF2, 0x9E, 0xA5, 0xAE, 0xA0,
+    0x9F, 0x7F, 0xAF, 0x97, 0x9F, 0xE9, 0x71, 0xAF, 0xCA, 0x73, 0xFC, 0x73, 0xAF, 0xCA, 0x71, 0x9F,
+    0xE9, 0x79, 0xFF, 0xC7, 0xFC, 0x0F, 0xC5, 0xFC, 0x19, 0xFA, 0x3F, 0xC9, 0x2A, 0xFA, 0x1A, 0xFA,
+    0x4F, 0xC9, 0x0F, 0x6A, 0xE1, 0x9E, 0xA5, 0xF2, 0xF4, 0x9E, 0x92, 0x9F, 0x3A, 0xE4, 0xF9, 0x2F,
+    0x49, 0xF2, 0xEA, 0x5F, 0xA0, 0xAE, 0x69, 0xF0, 0xF7, 0xFF, 0xA7, 0x9F, 0xE7, 0x1F, 0xE7, 0x19,
+    0xFC, 0xA7, 0x2F, 0xC7, 0x3A, 0xF7, 0x39, 0xEA, 0x73, 0xF9, 0x69, 0x99, 0xAF, 0xC7, 0xFF, 0x97,
+    0xFF, 0x70, 0xFE, 0x71, 0xFA, 0x97, 0x00, 0x2F, 0xFE, 0xA3, 0xFF, 0xF3, 0xFF, 0xF7, 0x1A, 0xF9,
+    0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0xA7, 0x0A, 0xFA, 0x70, 0xAF, 0xA7, 0x0A, 0xFC, 0x70,
+    0xAF, 0xC7, 0x09, 0xFD, 0xAA, 0xAA, 0xA3, 0xAF, 0xFF, 0x2F, 0xFF, 0xC9, 0x1F, 0xFF, 0xD0, 0x77,
+    0x1A, 0xFA, 0x39, 0xFD, 0xA3, 0xFE, 0x92, 0x9F, 0x69, 0xEA, 0x6A, 0xEA, 0x6A, 0xEA, 0x6A, 0xE9,
+    0x6A, 0xE9, 0x6F, 0x93, 0xAF, 0xD4, 0xFD, 0x94, 0xFD, 0x5A, 0xFC, 0xA6, 0x9F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0xE9, 0x3F, 0xE9, 0x39, 0xFD, 0x95, 0xAF, 0x97, 0x40, 0x09, 0xE0, 0x9D, 0xA0,
+    0x9D, 0xA0, 0x9D, 0xA0, 0x9D, 0xA0, 0x9D, 0xA0, 0xAD, 0xA0, 0xAD, 0xA0, 0xAD, 0xA0, 0xAD, 0x90,
+    0xAD, 0x90, 0xAD, 0x90, 0xAD, 0x90, 0xAD, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x1A, 0xAA, 0x00, 0x73, 0xAF, 0xA9, 0x4A, 0xFD, 0x93, 0x9F, 0xE7, 0xF9, 0x6A, 0xE9, 0x6A,
+    0xEA, 0x6A, 0xEA, 0x69, 0xEA, 0x69, 0xEA, 0x69, 0xF7, 0xFD, 0xA4, 0x9F, 0xD5, 0xFD, 0x4A, 0xFC,
+    0xA4, 0xF9, 0x6F, 0x7F, 0x7F, 0x7F, 0x7F, 0x39, 0xFE, 0x39, 0xFE, 0x39, 0xFD, 0x93, 0x9F, 0xA7,
+    0x70, 0x19, 0x92, 0x99, 0x1F, 0x1D, 0x99, 0xFC, 0x0D, 0x9A, 0xD0, 0xFC, 0x0A, 0xD0, 0x9F, 0x09,
+    0xAA, 0x19, 0xAA, 0x10, 0x9F, 0xD1, 0xFD, 0x1F, 0xD1, 0xFD, 0x1A, 0xFC, 0x19, 0xFA, 0x19, 0xF9,
+    0x77, 0x77, 0x77, 0x49, 0xC4, 0xAD, 0x3F, 0x3F, 0x3F, 0x3A, 0xE3, 0xAE, 0x3A, 0xE3, 0x9E, 0x92,
+    0x9E, 0x92, 0x9E, 0x93, 0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE9, 0x3A, 0xCA, 0x4A, 0xA7, 0x20,
+    0x77, 0x3D, 0x72, 0xD7, 0x19, 0xD7, 0x19, 0xD7, 0x0A, 0xFA, 0x4A, 0xFE, 0x92, 0xAF, 0xF9, 0x2F,
+    0xE9, 0xA2, 0xAE, 0x09, 0xCA, 0x4F, 0x09, 0xCA, 0x4E, 0xA0, 0x9C, 0xA4, 0xEA, 0x09, 0xCA, 0x4F,
+    0x0A, 0xCA, 0x4F, 0x0A, 0xCA, 0x4F, 0xAA, 0xCA, 0x49, 0xFF, 0xA3, 0xFF, 0xCA, 0x3F, 0xFC, 0x93,
+    0x9A, 0xFA, 0x96, 0xAC, 0xA7, 0x1A, 0xC9, 0x71, 0xAC, 0x97, 0x1A, 0xA9, 0x30, 0x77, 0x77, 0x4A,
+    0xF9, 0x7A, 0xFF, 0x94, 0xFF, 0xE9, 0x3E, 0xA2, 0x9E, 0xA3, 0xDA, 0x74, 0xDA, 0x74, 0xE7, 0x4A,
+    0xD9, 0x73, 0x9E, 0x74, 0xE7, 0x1F, 0xFF, 0xA2, 0xFF, 0xFA, 0x2A, 0xAA, 0xAF, 0xAA, 0xAA, 0x96,
+    0xEA, 0x73, 0xEA, 0x72, 0xAE, 0xA7, 0x0A, 0xFC, 0x97, 0xAF, 0xFC, 0xAA, 0x92, 0xAF, 0xFF, 0xC1,
+    0xAF, 0xFF, 0xCA, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x29, 0x6A, 0x4A, 0xC9,
+    0x4D, 0xA2, 0xAE, 0xAF, 0xEA, 0x1F, 0xFF, 0xA1, 0x9F, 0xFE, 0x3F, 0x90, 0xAE, 0xA3, 0xEA, 0x2F,
+    0x3E, 0xA2, 0xF3, 0xF9, 0x09, 0xF3, 0xFF, 0xDA, 0x2A, 0xFF, 0xE9, 0x0A, 0xFF, 0xFC, 0x99, 0xFF,
+    0xFC, 0x19, 0xD2, 0x91, 0x9D, 0x39, 0x79, 0x20, 0x0F, 0x96, 0x9F, 0x19, 0xF9, 0x49, 0xF9, 0x2A,
+    0xF9, 0x3F, 0xA4, 0xFC, 0x2F, 0xC6, 0xFC, 0x9F, 0xC7, 0x9F, 0xFC, 0x97, 0x0F, 0xFA, 0x72, 0xFE,
+    0x73, 0x9F, 0xC7, 0x5F, 0xEA, 0x69, 0xFF, 0xE6, 0xFF, 0xF9, 0x49, 0xFF, 0xC9, 0x97, 0x3F, 0xA7,
+    0x5F, 0xA0, 0x97, 0x9F, 0xFD, 0xA6, 0xFF, 0xF6, 0xFF, 0xF9, 0x71, 0xFA, 0x75, 0xFA, 0x75, 0xF9,
+    0x77, 0x71, 0x09, 0xAC, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0E, 0x0D, 0xA0, 0xD9, 0x77, 0x09,
+    0xCA, 0x0D, 0xA0, 0xDA, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0A, 0x90, 0x59,
+    0xAA, 0xA9, 0x69, 0xFE, 0x5F, 0xFC, 0x39, 0xD9, 0x2A, 0xD3, 0xAD, 0x4C, 0x93, 0xAE, 0x97, 0x09,
+    0xFD, 0xA6, 0xFF, 0x93, 0xFF, 0xD2, 0x9E, 0xA0, 0x99, 0xEA, 0x1A, 0xD9, 0x3A, 0xDA, 0x1A, 0xEA,
+    0x99, 0x9E, 0xA1, 0xAF, 0xFD, 0xA2, 0xFF, 0xD3, 0x9F, 0xF9, 0x59, 0xFE, 0x70, 0x9F, 0x92, 0x95,
+    0xEA, 0x19, 0xDA, 0x3E, 0xA1, 0xFF, 0xE1, 0xAF, 0xFD, 0x92, 0xAA, 0xFD, 0x97, 0x70, 0x19, 0x99,
+    0x29, 0x99, 0x91, 0xAE, 0x91, 0xF1, 0xFA, 0x1F, 0x90, 0xFA, 0x1F, 0x90, 0xFC, 0x09, 0xFA, 0x9F,
+    0xC0, 0xAF, 0xA0, 0x3A, 0xE9, 0x49, 0xFE, 0x3E, 0x90, 0x9E, 0x1A, 0xD0, 0xDA, 0x0D, 0x90, 0xD9,
+    0xCA, 0x2A, 0xCA, 0x0D, 0x0C, 0x92, 0x9C, 0xA0, 0xD9, 0xCA, 0x2A, 0xCA, 0x0A, 0xD9, 0xE0, 0xD9,
+    0x1E, 0x90, 0x9E, 0x29, 0xFE, 0x5A, 0xEA, 0x20, 0x72, 0x9D, 0xAC, 0x91, 0x9C, 0xAA, 0xD9, 0x1D,
+    0x1A, 0xCA, 0x1C, 0x92, 0xCA, 0x1C, 0x92, 0xCA, 0x1C, 0xA9, 0x9A, 0xD1, 0xAF, 0xD2, 0xAD, 0xAA,
+    0xC0, 0x77, 0x3A, 0xA3, 0xC5, 0xDA, 0x19, 0xD4, 0xE9, 0x09, 0xE2, 0x9F, 0x0A, 0xE9, 0x19, 0xEA,
+    0x0F, 0x91, 0x9E, 0x90, 0xAE, 0x3A, 0xE9, 0x0F, 0x39, 0xFA, 0xAF, 0x39, 0xFA, 0xAF, 0x4F, 0x0A,
+    0xF4, 0xE1, 0xAD, 0xA5, 0xD2, 0xAC, 0x96, 0x93, 0x91, 0x99, 0x99, 0x70, 0xAF, 0xFC, 0xAA, 0x9A,
+    0xFF, 0xEA, 0xAF, 0xFE, 0xA4, 0x99, 0x99, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xF0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x77, 0xAE, 0xA4, 0x9F, 0xE3, 0xFD, 0xAD, 0x1A, 0xCA, 0xA9, 0x0C, 0x0D, 0x90,
+    0xD9, 0xAA, 0x0C, 0x09, 0xCA, 0x0D, 0x0A, 0xE0, 0xAC, 0xA0, 0xAC, 0xAA, 0xC0, 0xC9, 0xDA, 0x09,
+    0xF0, 0xF2, 0xAF, 0xE9, 0x39, 0xFA, 0x76, 0x73, 0xAF, 0xF0, 0x9F, 0xFC, 0x99, 0x99, 0x99, 0x99,
+    0x92, 0x77, 0xAE, 0xA4, 0x9F, 0xE3, 0xFF, 0xC1, 0xAE, 0x90, 0x9E, 0x90, 0xEA, 0x2A, 0xDA, 0x0F,
+    0x2E, 0xA0, 0xAF, 0xFC, 0x91, 0xFF, 0xC2, 0x9F, 0xE5, 0xAE, 0xA2, 0x59, 0x99, 0x97, 0x2A, 0xE7,
+    0x2A, 0xE7, 0x2A, 0xE5, 0x9A, 0xAA, 0xAF, 0xAA, 0xAA, 0x1A, 0xFF, 0xF1, 0xAF, 0xFF, 0x6A, 0xE7,
+    0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x75, 0x9A, 0xAA, 0xAF, 0xD3, 0xFF, 0xEA, 0x1A, 0xFF, 0xEA,
+    0x77, 0x09, 0xEA, 0x2D, 0xAD, 0x95, 0xD4, 0x9C, 0xA3, 0x9D, 0x3E, 0x92, 0xAF, 0xC1, 0xFD, 0x00,
+    0x29, 0x93, 0x9F, 0x91, 0x92, 0xAC, 0x59, 0xC3, 0xAA, 0xD2, 0xAE, 0xA5, 0xD1, 0x9A, 0x99, 0xD9,
+    0x0A, 0xFC, 0x1A, 0xF9, 0x00, 0x2E, 0x29, 0xDA, 0x2E, 0x92, 0xE2, 0xAD, 0xA7, 0x00, 0x0A, 0xE5,
+    0xAE, 0x1A, 0xE5, 0xAE, 0x1A, 0xE5, 0xAE, 0x1A, 0xE9, 0x4A, 0xE1, 0xAE, 0x94, 0xAE, 0x1F, 0x94,
+    0xAE, 0x1F, 0xA4, 0xF9, 0x0F, 0xA4, 0xF9, 0x0F, 0xC4, 0xF9, 0x0F, 0xC4, 0xF9, 0x0F, 0xD9, 0x1F,
+    0xC9, 0x0F, 0xFF, 0xD9, 0x0F, 0xFF, 0xD9, 0x0F, 0xFF, 0xDA, 0x0F, 0xFF, 0xDA, 0x0E, 0x0A, 0xFA,
+    0x5E, 0x74, 0xE7, 0x4A, 0xAA, 0x73, 0x2A, 0xF9, 0x0E, 0x91, 0xFD, 0x90, 0xE9, 0x0A, 0xFD, 0x90,
+    0xE9, 0x0F, 0xE1, 0xE9, 0x9F, 0xE1, 0xE9, 0x9F, 0xE1, 0xE9, 0x0F, 0xE1, 0xE9, 0x0A, 0xFD, 0x1E,
+    0x91, 0xFD, 0x1E, 0x92, 0xAF, 0x1E, 0x92, 0xFA, 0x1A, 0xDA, 0x2F, 0xA1, 0xAD, 0xA2, 0xFA, 0x1A,
+    0xDA, 0x19, 0xF9, 0x1A, 0xDA, 0x1A, 0xF9, 0x1A, 0xDA, 0x1F, 0xC9, 0x1A, 0xDA, 0x1F, 0xC9, 0x1A,
+    0xDA, 0x1F, 0xC2, 0xAD, 0xA0, 0x9F, 0xC2, 0xAD, 0xA0, 0xAF, 0xC2, 0xAD, 0xA0, 0xFD, 0x2A, 0xDA,
+    0x09, 0x99, 0x99, 0x93, 0x99, 0x90, 0x0A, 0xE9, 0x0F, 0x90, 0xFA, 0x0F, 0xA9, 0xFC, 0x09, 0x99,
+    0x99, 0x0A, 0xCA, 0x3D, 0x93, 0xEA, 0x1A, 0xFA, 0x09, 0x90, 0xAD, 0x09, 0xFA, 0x0A, 0xF1, 0x9A,
+    0xA9, 0x20, 0x1A, 0xCA, 0x29, 0xDA, 0x29, 0x9C, 0xA4, 0xCA, 0x4C, 0xA3, 0x9C, 0xA3, 0x9C, 0xA2,
+    0xFC, 0xA0, 0xFC, 0xA0, 0x19, 0xE9, 0x29, 0xDA, 0xD9, 0x1D, 0x2D, 0x1D, 0x2D, 0x1D, 0x2D, 0x1E,
+    0xAE, 0x19, 0xFC, 0x92, 0x9E, 0x91, 0x76, 0xC3, 0xAA, 0x6D, 0x91, 0xAC, 0xA5, 0xE9, 0x0A, 0xE4,
+    0x9E, 0xA0, 0xF9, 0x39, 0xF0, 0xAE, 0x94, 0xEA, 0x0A, 0xE9, 0x3F, 0x0A, 0xEA, 0x2F, 0xAA, 0xF9,
+    0x09, 0xFA, 0xAF, 0x2F, 0xA9, 0xF3, 0xAD, 0xA1, 0xE4, 0x9C, 0x92, 0xD6, 0x93, 0xA5, 0x19, 0xAC,
+    0x97, 0x71, 0xF9, 0x77, 0x1F, 0x97, 0x1E, 0x93, 0xA9, 0xD9, 0x70, 0xAD, 0xA6, 0xD9, 0x70, 0xE7,
+    0xD9, 0x7E, 0xA6, 0x9D, 0x96, 0x9E, 0x79, 0xD9, 0x6E, 0x97, 0x9D, 0x95, 0xAE, 0x70, 0x9D, 0x94,
+    0x9E, 0x39, 0x2A, 0xFE, 0x2E, 0xA2, 0xD9, 0x1F, 0xF1, 0xAE, 0x2E, 0x91, 0xAF, 0xE1, 0xE9, 0x1A,
+    0xE9, 0x72, 0xF1, 0x9C, 0xAD, 0x97, 0x19, 0xE9, 0x1D, 0x0D, 0x97, 0x1E, 0xA1, 0xD9, 0x0D, 0xA7,
+    0x0A, 0xE1, 0xAC, 0xA0, 0x9D, 0xA9, 0x69, 0xEA, 0x09, 0xFF, 0xC6, 0xF1, 0x9F, 0xFC, 0x5A, 0xE9,
+    0x7E, 0x6F, 0x70, 0xE5, 0xF9, 0x79, 0xE5, 0xAA, 0xAA, 0x76, 0x19, 0xAC, 0x97, 0x73, 0xF9, 0x72,
+    0x99, 0x6F, 0x97, 0x1E, 0x6A, 0x9D, 0x97, 0x0A, 0xDA, 0x70, 0xD9, 0x79, 0xE7, 0x1D, 0x97, 0xE9,
+    0x70, 0x9D, 0x96, 0xAE, 0x71, 0x9D, 0x96, 0xE9, 0x71, 0x9D, 0x95, 0xEA, 0x72, 0x9D, 0x94, 0x9E,
+    0x71, 0xAF, 0xE2, 0xEA, 0x09, 0xFC, 0xA1, 0xFF, 0x1A, 0xE1, 0xFE, 0xA0, 0xAF, 0xE0, 0x9E, 0x91,
+    0xCA, 0x91, 0xAD, 0x71, 0xF7, 0x0D, 0x97, 0xAE, 0x70, 0x9D, 0x97, 0xEA, 0x70, 0xE7, 0xF7, 0x0E,
+    0x96, 0x9E, 0x96, 0xAF, 0x7F, 0x6F, 0xC7, 0xAE, 0x95, 0xAF, 0xE9, 0x39, 0xEA, 0x6F, 0xFA, 0x3F,
+    0x7F, 0xFA, 0x39, 0x99, 0x97, 0x70, 0x09, 0xAE, 0xA7, 0x70, 0xFE, 0x79, 0x99, 0x93, 0x93, 0xAC,
+    0xA6, 0xE7, 0x2D, 0x5A, 0xDA, 0x71, 0xAC, 0xA4, 0x9E, 0x69, 0xFC, 0x5E, 0x96, 0xAF, 0xC9, 0x3A,
+    0xE7, 0x19, 0xAE, 0x3E, 0x74, 0xAD, 0x2E, 0xA7, 0xCA, 0x99, 0xAE, 0x19, 0xE2, 0x9A, 0x3F, 0xF1,
+    0xEA, 0x19, 0xD9, 0x1A, 0xFE, 0xA0, 0xAE, 0x2E, 0x91, 0x9A, 0xFC, 0x90, 0x9E, 0x91, 0xF9, 0x72,
+    0xF1, 0xAC, 0xAD, 0x97, 0x19, 0xE9, 0x09, 0xD0, 0xDA, 0x71, 0xEA, 0x1D, 0x1D, 0xA7, 0x0A, 0xE1,
+    0xE9, 0x9E, 0xA6, 0x9E, 0xA0, 0x9F, 0xFC, 0x6F, 0x19, 0xFF, 0xC5, 0xAE, 0x97, 0xE6, 0xF7, 0x0E,
+    0x5F, 0x97, 0x9E, 0x5A, 0xAA, 0xA7, 0x60, 0x5F, 0xC9, 0x71, 0xAF, 0x97, 0x1A, 0xF7, 0x29, 0xF7,
+    0x29, 0xEA, 0x73, 0x99, 0x99, 0x77, 0x77, 0x77, 0x75, 0x9A, 0x73, 0xAD, 0xA7, 0x19, 0xFA, 0x71,
+    0x9F, 0xA7, 0x19, 0xF9, 0x71, 0x9F, 0x97, 0x0A, 0xFC, 0x97, 0xAF, 0xD7, 0xAF, 0xC9, 0x70, 0xF9,
+    0x71, 0xAE, 0x97, 0x2F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x79, 0x29, 0xE9, 0x5D, 0x92, 0xF9,
+    0x2A, 0xF2, 0x9F, 0xFE, 0xA3, 0x9F, 0xFC, 0x96, 0xAF, 0xC9, 0x77, 0x77, 0x30, 0x5E, 0xA7, 0x72,
+    0xF7, 0x72, 0xF9, 0x77, 0x1F, 0xA7, 0x72, 0x99, 0x99, 0x77, 0x77, 0x77, 0x73, 0xF7, 0x71, 0xFA,
+    0x77, 0xAF, 0xC7, 0x7F, 0xD9, 0x75, 0x9F, 0xDA, 0x75, 0xFA, 0xE7, 0x5E, 0xA9, 0xEA, 0x73, 0xAE,
+    0x90, 0xF7, 0x3F, 0x1A, 0xE9, 0x71, 0x9E, 0xA1, 0x9E, 0xA7, 0x1F, 0x92, 0xF7, 0x1F, 0x3F, 0xA7,
+    0xAF, 0x39, 0xF7, 0xFC, 0xAA, 0xAA, 0xAF, 0x95, 0x9F, 0xFF, 0xDA, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF,
+    0xA3, 0xAF, 0xFF, 0xFC, 0x3F, 0xC7, 0xFC, 0x91, 0x9F, 0xC7, 0xAF, 0xA1, 0xFC, 0x97, 0x9F, 0xC0,
+    0x72, 0xAD, 0x77, 0x2D, 0xA7, 0x71, 0xAD, 0x97, 0x71, 0xE7, 0x71, 0xAD, 0xA7, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xF7, 0x71, 0xFA, 0x77, 0xAF, 0xC7, 0x7F, 0xD9, 0x75, 0x9F,
+    0xDA, 0x75, 0xFA, 0xE7, 0x5E, 0xA9, 0xEA, 0x73, 0xAE, 0x90, 0xF7, 0x3F, 0x1A, 0xE9, 0x71, 0x9E,
+    0xA1, 0x9E, 0xA7, 0x1F, 0x92, 0xF7, 0x1F, 0x3F, 0xA7, 0xAF, 0x39, 0xF7, 0xFC, 0xAA, 0xAA, 0xAF,
+    0x95, 0x9F, 0xFF, 0xDA, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xFC, 0x3F, 0xC7, 0xFC,
+    0x91, 0x9F, 0xC7, 0xAF, 0xA1, 0xFC, 0x97, 0x9F, 0xC0, 0x77, 0x77, 0xAD, 0x77, 0x19, 0xF7, 0x79,
+    0xFC, 0xA7, 0x59, 0xFE, 0xA7, 0x39, 0xE9, 0x09, 0xEA, 0x71, 0x9E, 0x4A, 0xDA, 0x77, 0x77, 0x77,
+    0x70, 0xF7, 0x71, 0xFA, 0x77, 0xAF, 0xC7, 0x7F, 0xD9, 0x75, 0x9F, 0xDA, 0x75, 0xFA, 0xE7, 0x5E,
+    0xA9, 0xEA, 0x73, 0xAE, 0x90, 0xF7, 0x3F, 0x1A, 0xE9, 0x71, 0x9E, 0xA1, 0x9E, 0xA7, 0x1F, 0x92,
+    0xF7, 0x1F, 0x3F, 0xA7, 0xAF, 0x39, 0xF7, 0xFC, 0xAA, 0xAA, 0xAF, 0x95, 0x9F, 0xFF, 0xDA, 0x5F,
+    0xFF, 0xF5, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xFC, 0x3F, 0xC7, 0xFC, 0x91, 0x9F, 0xC7, 0xAF, 0xA1,
+    0xFC, 0x97, 0x9F, 0xC0, 0x79, 0x92, 0x99, 0x75, 0xAE, 0x90, 0xAC, 0xA7, 0x4F, 0xC0, 0xAC, 0xA7,
+    0x4D, 0x0F, 0xCA, 0x73, 0x9D, 0x09, 0xF7, 0x5D, 0x90, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x3F, 0x77,
+    0x1F, 0xA7, 0x7A, 0xFC, 0x77, 0xFD, 0x97, 0x59, 0xFD, 0xA7, 0x5F, 0xAE, 0x75, 0xEA, 0x9E, 0xA7,
+    0x3A, 0xE9, 0x0F, 0x73, 0xF1, 0xAE, 0x97, 0x19, 0xEA, 0x19, 0xEA, 0x71, 0xF9, 0x2F, 0x71, 0xF3,
+    0xFA, 0x7A, 0xF3, 0x9F, 0x7F, 0xCA, 0xAA, 0xAA, 0xF9, 0x59, 0xFF, 0xFD, 0xA5, 0xFF, 0xFF, 0x5F,
+    0xFF, 0xFA, 0x3A, 0xFF, 0xFF, 0xC3, 0xFC, 0x7F, 0xC9, 0x19, 0xFC, 0x7A, 0xFA, 0x1F, 0xC9, 0x79,
+    0xFC, 0x00, 0x59, 0x99, 0x92, 0x99, 0x99, 0x72, 0xF1, 0x9F, 0x71, 0x9F, 0x19, 0xF7, 0x19, 0xF1,
+    0xAF, 0x71, 0xAF, 0x90, 0xFC, 0x71, 0xFC, 0xA0, 0xFC, 0x97, 0x77, 0x77, 0x77, 0x77, 0x6F, 0x77,
+    0x1F, 0xA7, 0x7A, 0xFC, 0x77, 0xFD, 0x97, 0x59, 0xFD, 0xA7, 0x5F, 0xAE, 0x75, 0xEA, 0x9E, 0xA7,
+    0x3A, 0xE9, 0x0F, 0x73, 0xF1, 0xAE, 0x97, 0x19, 0xEA, 0x19, 0xEA, 0x71, 0xF9, 0x2F, 0x71, 0xF3,
+    0xFA, 0x7A, 0xF3, 0x9F, 0x7F, 0xCA, 0xAA, 0xAA, 0xF9, 0x59, 0xFF, 0xFD, 0xA5, 0xFF, 0xFF, 0x5F,
+    0xFF, 0xFA, 0x3A, 0xFF, 0xFF, 0xC3, 0xFC, 0x7F, 0xC9, 0x19, 0xFC, 0x7A, 0xFA, 0x1F, 0xC9, 0x79,
+    0xFC, 0x00, 0x70, 0x9D, 0xA7, 0x71, 0xFA, 0x77, 0xAD, 0x9D, 0x77, 0xAC, 0xA0, 0xD7, 0x7A, 0xFC,
+    0x77, 0x0F, 0x97, 0x71, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x5F, 0x77, 0x1F, 0xA7, 0x7A, 0xFC, 0x77,
+    0xFD, 0x97, 0x59, 0xFD, 0xA7, 0x5F, 0xAE, 0x75, 0xEA, 0x9E, 0xA7, 0x3A, 0xE9, 0x0F, 0x73, 0xF1,
+    0xAE, 0x97, 0x19, 0xEA, 0x19, 0xEA, 0x71, 0xF9, 0x2F, 0x71, 0xF3, 0xFA, 0x7A, 0xF3, 0x9F, 0x7F,
+    0xCA, 0xAA, 0xAA, 0xF9, 0x59, 0xFF, 0xFD, 0xA5, 0xFF, 0xFF, 0x5F, 0xFF, 0xFA, 0x3A, 0xFF, 0xFF,
+    0xC3, 0xFC, 0x7F, 0xC9, 0x19, 0xFC, 0x7A, 0xFA, 0x1F, 0xC9, 0x79, 0xFC, 0x00, 0x73, 0x99, 0x99,
+    0x0A, 0xAA, 0xAA, 0xAF, 0xEA, 0x74, 0xF9, 0xFF, 0xFC, 0x97, 0x3A, 0xFA, 0xFF, 0xFC, 0x74, 0xFF,
+    0xFD, 0xAA, 0xAA, 0x97, 0x3A, 0xFF, 0xD7, 0x73, 0x9F, 0xFE, 0x77, 0x3F, 0x9F, 0xE7, 0x72, 0x9E,
+    0x90, 0xFE, 0x77, 0x2F, 0x1F, 0xFF, 0xCA, 0x72, 0xAE, 0xA1, 0xAF, 0xFF, 0xA7, 0x2F, 0x2A, 0xFF,
+    0xFA, 0x71, 0xAE, 0xA2, 0x9F, 0xFD, 0xAA, 0x97, 0x1F, 0x4F, 0xD7, 0x7F, 0xCA, 0xAA, 0xAA, 0xFD,
+    0x76, 0x9F, 0xFF, 0xF7, 0x6F, 0xFF, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x94, 0x9F, 0xFF, 0xFF, 0xFD,
+    0x4F, 0xFF, 0xFF, 0xFE, 0x92, 0xAF, 0x96, 0x9F, 0xFF, 0xD9, 0x2F, 0xC7, 0x9F, 0xFF, 0xDA, 0x1A,
+    0xFA, 0x70, 0xFF, 0xFE, 0x77, 0x77, 0x00, 0x77, 0x71, 0x9A, 0xFD, 0xA9, 0x59, 0xFF, 0xDA, 0x4F,
+    0xFF, 0x93, 0xFF, 0xFC, 0x3A, 0xFF, 0xAA, 0xE3, 0xFD, 0x97, 0x1A, 0xFC, 0x73, 0xFC, 0x73, 0x9F,
+    0xA7, 0x3A, 0xFA, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xD7, 0x3F, 0xD9, 0x72,
+    0xAF, 0xDA, 0x92, 0x99, 0xAC, 0x19, 0xFF, 0xFE, 0x2F, 0xFF, 0xE2, 0x9F, 0xFF, 0xD3, 0xAF, 0xFF,
+    0xC4, 0xAF, 0xFF, 0x59, 0xAF, 0xFD, 0x72, 0xD7, 0x6A, 0xE9, 0x74, 0xFC, 0x74, 0x91, 0xD9, 0x73,
+    0xAF, 0x97, 0x3F, 0xA7, 0x4A, 0xAA, 0x94, 0x1F, 0x73, 0xF9, 0x72, 0xFA, 0x72, 0xFC, 0x73, 0x99,
+    0x99, 0x77, 0x77, 0x77, 0x1A, 0xAA, 0xAA, 0xAF, 0xE9, 0x9F, 0xFF, 0xC0, 0x9F, 0xFF, 0xC0, 0x9F,
+    0xFA, 0xAA, 0xA9, 0x09, 0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0x9E, 0xA7, 0x1A, 0xFA, 0xAA,
+    0xE9, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9, 0x2A, 0xF7, 0x1A, 0xEA, 0x71, 0xAE,
+    0xA7, 0x1F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x0F, 0xFF, 0xD9, 0xFF,
+    0xFD, 0xAF, 0xFF, 0xE0, 0x69, 0xD7, 0x3E, 0x72, 0x9D, 0xA7, 0x2E, 0x72, 0x9E, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0xAA, 0xAA, 0xAA, 0xFE, 0x99, 0xFF, 0xFC, 0x09, 0xFF, 0xFC, 0x09, 0xFF,
+    0xAA, 0xAA, 0x90, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0xAF, 0xAA, 0xAE,
+    0x92, 0xAF, 0xFD, 0x92, 0xAF, 0xFD, 0x92, 0xAF, 0xFD, 0x92, 0xAF, 0x71, 0xAE, 0xA7, 0x1A, 0xEA,
+    0x71, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xFD, 0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x9F, 0xFF,
+    0xDA, 0xFF, 0xFE, 0x77, 0x49, 0xD9, 0x72, 0xF7, 0x1F, 0xD7, 0xFF, 0x5E, 0xA1, 0xF3, 0xE9, 0x39,
+    0xE7, 0x77, 0x77, 0x6A, 0xAA, 0xAA, 0xAF, 0xE9, 0x9F, 0xFF, 0xC0, 0x9F, 0xFF, 0xC0, 0x9F, 0xFA,
+    0xAA, 0xA9, 0x09, 0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0x9E, 0xA7, 0x1A, 0xFA, 0xAA, 0xE9,
+    0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9, 0x2A, 0xF7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7,
+    0x1F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x0F, 0xFF, 0xD9, 0xFF, 0xFD,
+    0xAF, 0xFF, 0xE0, 0x19, 0x99, 0x92, 0x99, 0x99, 0x3F, 0x2F, 0x3F, 0x90, 0x9F, 0x3F, 0x90, 0x9F,
+    0x29, 0xFA, 0x0A, 0xF9, 0x1A, 0xFA, 0x0F, 0xCA, 0x77, 0x77, 0x77, 0x75, 0xAA, 0xAA, 0xAA, 0xFE,
+    0x99, 0xFF, 0xFC, 0x09, 0xFF, 0xFC, 0x09, 0xFF, 0xAA, 0xAA, 0x90, 0x9E, 0xA7, 0x19, 0xEA, 0x71,
+    0x9E, 0xA7, 0x19, 0xEA, 0x71, 0xAF, 0xAA, 0xAE, 0x92, 0xAF, 0xFD, 0x92, 0xAF, 0xFD, 0x92, 0xAF,
+    0xFD, 0x92, 0xAF, 0x71, 0xAE, 0xA7, 0x1A, 0xEA, 0x71, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF,
+    0xFD, 0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x9F, 0xFF, 0xDA, 0xFF, 0xFE, 0x0F, 0x96, 0xAE, 0xA6, 0xAE,
+    0xA6, 0xAF, 0x70, 0x99, 0x97, 0x77, 0x77, 0x70, 0xFA, 0x5A, 0xEA, 0x5A, 0xEA, 0x5A, 0xEA, 0x5A,
+    0xEA, 0x59, 0xEA, 0x59, 0xEA, 0x59, 0xEA, 0x59, 0xEA, 0x59, 0xEA, 0x59, 0xEA, 0x59, 0xF5, 0x9F,
+    0x59, 0xF5, 0x9F, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x90, 0x19, 0xD9,
+    0x1E, 0x19, 0xDA, 0x1E, 0x90, 0x9E, 0x77, 0x77, 0x77, 0x1F, 0xA0, 0xAE, 0xA0, 0xAE, 0xA0, 0xAE,
+    0xA0, 0xAE, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9F,
+    0x09, 0xF0, 0x9F, 0x09, 0xF0, 0xAF, 0x0A, 0xF0, 0xAF, 0x0F, 0xC9, 0xFC, 0x9F, 0xC9, 0x77, 0x29,
+    0xDA, 0x71, 0xF7, 0x0F, 0xD6, 0xFF, 0x4E, 0xA1, 0xAE, 0x2E, 0x93, 0x9E, 0x77, 0x77, 0x77, 0x74,
+    0xFA, 0x70, 0xAE, 0xA7, 0x0A, 0xEA, 0x70, 0xAE, 0xA7, 0x0A, 0xEA, 0x70, 0x9E, 0xA7, 0x09, 0xEA,
+    0x70, 0x9E, 0xA7, 0x09, 0xEA, 0x70, 0x9E, 0xA7, 0x09, 0xEA, 0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F,
+    0x70, 0x9F, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xFC, 0x97, 0xFC, 0x97, 0xFC, 0x93, 0x09,
+    0x99, 0x92, 0x99, 0x99, 0x1A, 0xE9, 0x1F, 0x1F, 0x91, 0xF9, 0x0F, 0xA0, 0x9F, 0x99, 0xFA, 0x09,
+    0xFA, 0x9F, 0xC0, 0xAF, 0xA7, 0x77, 0x77, 0x77, 0x74, 0xFA, 0x7A, 0xEA, 0x7A, 0xEA, 0x7A, 0xEA,
+    0x7A, 0xEA, 0x79, 0xEA, 0x79, 0xEA, 0x79, 0xEA, 0x79, 0xEA, 0x79, 0xEA, 0x79, 0xEA, 0x79, 0xF7,
+    0x9F, 0x79, 0xF7, 0x9F, 0x7A, 0xF7, 0xAF, 0x7A, 0xF7, 0xFC, 0x96, 0xFC, 0x96, 0xFC, 0x92, 0x4F,
+    0xFD, 0xA9, 0x73, 0xFF, 0xFC, 0xA7, 0x1F, 0xFF, 0xE9, 0x7F, 0xFF, 0xF9, 0x6F, 0xA0, 0x99, 0x9A,
+    0xAF, 0xD6, 0xFA, 0x6A, 0xF9, 0x5F, 0xA7, 0xFA, 0x5F, 0xA7, 0x0F, 0x5F, 0xA7, 0x0F, 0x1F, 0xFF,
+    0x94, 0xAE, 0x1F, 0xFF, 0x94, 0xF1, 0xFF, 0xF9, 0x4F, 0x5F, 0xA7, 0x9F, 0x5F, 0xA6, 0x9F, 0xC5,
+    0xFA, 0x39, 0x9F, 0xE5, 0xFF, 0xFF, 0xCA, 0x5F, 0xFF, 0xFC, 0x6F, 0xFF, 0xFA, 0x6F, 0xFF, 0xF7,
+    0xFF, 0xFD, 0xA7, 0x0F, 0xFE, 0xA9, 0x50, 0x59, 0xDA, 0x1D, 0x71, 0xFA, 0x0D, 0x97, 0x9D, 0xAD,
+    0xAD, 0x70, 0xAD, 0x0A, 0xF7, 0x09, 0xD1, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0xF0, 0x9F, 0x96,
+    0xF0, 0x9F, 0xC5, 0x9E, 0xA0, 0x9F, 0xC9, 0x49, 0xEA, 0x0A, 0xFD, 0x49, 0xEA, 0x0A, 0xFD, 0x93,
+    0xAE, 0xA0, 0xAF, 0xE3, 0xAE, 0x90, 0xFF, 0x92, 0xAE, 0x90, 0xFF, 0xC2, 0xF9, 0x0F, 0xFC, 0x91,
+    0xF9, 0x0F, 0xC9, 0xF1, 0xF9, 0x0F, 0xC0, 0xF9, 0x0F, 0x1F, 0xC0, 0xAE, 0xA0, 0xF0, 0x9F, 0xC1,
+    0xF9, 0xF0, 0x9F, 0xC1, 0xAF, 0xF0, 0x9F, 0xC1, 0x9F, 0xF0, 0xAF, 0xC2, 0xFF, 0x0A, 0xFC, 0x29,
+    0xFE, 0x0A, 0xFC, 0x3F, 0xE0, 0xFD, 0x3A, 0xFD, 0x0F, 0xD4, 0xFC, 0xA0, 0x39, 0xEA, 0x77, 0x1F,
+    0x77, 0x1F, 0x97, 0x70, 0xFA, 0x77, 0x19, 0x99, 0x97, 0x77, 0x77, 0x76, 0x9A, 0xFA, 0x97, 0x29,
+    0xFF, 0xDA, 0x79, 0xFF, 0xFC, 0x59, 0xFD, 0xA9, 0xAF, 0xD4, 0xFC, 0x94, 0xAF, 0xA2, 0xAF, 0x7F,
+    0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF7, 0x1F, 0xC0, 0xAF, 0x71, 0x9F, 0x0F, 0xA7, 0x19, 0xF0, 0xFA,
+    0x72, 0xF0, 0xF9, 0x72, 0xF9, 0xFA, 0x72, 0xF9, 0xFA, 0x71, 0x9F, 0x0F, 0xC7, 0x1A, 0xF0, 0xAF,
+    0xA7, 0x9F, 0xC0, 0xAF, 0xDA, 0x99, 0x09, 0x9F, 0xE0, 0x9F, 0xFF, 0xFD, 0xA1, 0xFF, 0xFF, 0xD9,
+    0x19, 0xFF, 0xFF, 0xC3, 0xAF, 0xFF, 0xE5, 0x9F, 0xFF, 0xC7, 0x09, 0xAF, 0xEA, 0x97, 0x77, 0x10,
+    0x71, 0xAD, 0x77, 0x1D, 0xA7, 0x70, 0xAD, 0x97, 0x70, 0xE7, 0x70, 0xAD, 0xA7, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0xAF, 0xA9, 0x72, 0x9F, 0xFD, 0xA7, 0x9F, 0xFF, 0xC5, 0x9F,
+    0xDA, 0x9A, 0xFD, 0x4F, 0xC9, 0x4A, 0xFA, 0x2A, 0xF7, 0xFC, 0x2F, 0xA7, 0x9F, 0x90, 0x9F, 0x71,
+    0xFC, 0x0A, 0xF7, 0x19, 0xF0, 0xFA, 0x71, 0x9F, 0x0F, 0xA7, 0x2F, 0x0F, 0x97, 0x2F, 0x9F, 0xA7,
+    0x2F, 0x9F, 0xA7, 0x19, 0xF0, 0xFC, 0x71, 0xAF, 0x0A, 0xFA, 0x79, 0xFC, 0x0A, 0xFD, 0xA9, 0x90,
+    0x99, 0xFE, 0x09, 0xFF, 0xFF, 0xDA, 0x1F, 0xFF, 0xFD, 0x91, 0x9F, 0xFF, 0xFC, 0x3A, 0xFF, 0xFE,
+    0x59, 0xFF, 0xFC, 0x70, 0x9A, 0xFE, 0xA9, 0x77, 0x71, 0x77, 0x75, 0xAD, 0x77, 0x09, 0xEA, 0x76,
+    0x9F, 0xCA, 0x74, 0x9F, 0xEA, 0x72, 0x9E, 0x90, 0x9E, 0xA7, 0x09, 0xE4, 0xAD, 0xA7, 0x77, 0x77,
+    0x73, 0x9A, 0xFA, 0x97, 0x29, 0xFF, 0xDA, 0x79, 0xFF, 0xFC, 0x59, 0xFD, 0xA9, 0xAF, 0xD4, 0xFC,
+    0x94, 0xAF, 0xA2, 0xAF, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF7, 0x1F, 0xC0, 0xAF, 0x71, 0x9F,
+    0x0F, 0xA7, 0x19, 0xF0, 0xFA, 0x72, 0xF0, 0xF9, 0x72, 0xF9, 0xFA, 0x72, 0xF9, 0xFA, 0x71, 0x9F,
+    0x0F, 0xC7, 0x1A, 0xF0, 0xAF, 0xA7, 0x9F, 0xC0, 0xAF, 0xDA, 0x99, 0x09, 0x9F, 0xE0, 0x9F, 0xFF,
+    0xFD, 0xA1, 0xFF, 0xFF, 0xD9, 0x19, 0xFF, 0xFF, 0xC3, 0xAF, 0xFF, 0xE5, 0x9F, 0xFF, 0xC7, 0x09,
+    0xAF, 0xEA, 0x97, 0x77, 0x10, 0x69, 0x92, 0x99, 0x74, 0xAE, 0x90, 0xAC, 0x97, 0x3F, 0xC0, 0xAC,
+    0xA7, 0x29, 0xD0, 0xFC, 0x97, 0x29, 0xD0, 0x9F, 0x74, 0xD1, 0x9D, 0xA7, 0x77, 0x77, 0x76, 0x9A,
+    0xFA, 0x97, 0x29, 0xFF, 0xDA, 0x79, 0xFF, 0xFC, 0x59, 0xFD, 0xA9, 0xAF, 0xD4, 0xFC, 0x94, 0xAF,
+    0xA2, 0xAF, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF7, 0x1F, 0xC0, 0xAF, 0x71, 0x9F, 0x0F, 0xA7,
+    0x19, 0xF0, 0xFA, 0x72, 0xF0, 0xF9, 0x72, 0xF9, 0xFA, 0x72, 0xF9, 0xFA, 0x71, 0x9F, 0x0F, 0xC7,
+    0x1A, 0xF0, 0xAF, 0xA7, 0x9F, 0xC0, 0xAF, 0xDA, 0x99, 0x09, 0x9F, 0xE0, 0x9F, 0xFF, 0xFD, 0xA1,
+    0xFF, 0xFF, 0xD9, 0x19, 0xFF, 0xFF, 0xC3, 0xAF, 0xFF, 0xE5, 0x9F, 0xFF, 0xC7, 0x09, 0xAF, 0xEA,
+    0x97, 0x77, 0x10, 0x49, 0x99, 0x92, 0x99, 0x99, 0x71, 0xF1, 0x9E, 0xA7, 0x09, 0xF1, 0xAF, 0x70,
+    0x9F, 0x1A, 0xF7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0F, 0xC9, 0x0F, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x70,
+    0x9A, 0xFA, 0x97, 0x29, 0xFF, 0xDA, 0x79, 0xFF, 0xFC, 0x59, 0xFD, 0xA9, 0xAF, 0xD4, 0xFC, 0x94,
+    0xAF, 0xA2, 0xAF, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF7, 0x1F, 0xC0, 0xAF, 0x71, 0x9F, 0x0F,
+    0xA7, 0x19, 0xF0, 0xFA, 0x72, 0xF0, 0xF9, 0x72, 0xF9, 0xFA, 0x72, 0xF9, 0xFA, 0x71, 0x9F, 0x0F,
+    0xC7, 0x1A, 0xF0, 0xAF, 0xA7, 0x9F, 0xC0, 0xAF, 0xDA, 0x99, 0x09, 0x9F, 0xE0, 0x9F, 0xFF, 0xFD,
+    0xA1, 0xFF, 0xFF, 0xD9, 0x19, 0xFF, 0xFF, 0xC3, 0xAF, 0xFF, 0xE5, 0x9F, 0xFF, 0xC7, 0x09, 0xAF,
+    0xEA, 0x97, 0x77, 0x10, 0x77, 0x9F, 0x1A, 0xEA, 0x39, 0xFA, 0xEA, 0x59, 0xFE, 0x79, 0xFC, 0x70,
+    0xFD, 0xA6, 0xFF, 0xA4, 0xFC, 0xAF, 0xA2, 0xFC, 0x90, 0xAF, 0xC0, 0x77, 0x77, 0x99, 0xA7, 0x77,
+    0x6F, 0xA7, 0x77, 0x5A, 0xF7, 0x77, 0x59, 0xFA, 0x77, 0x75, 0xFC, 0x77, 0x75, 0xAF, 0x97, 0x77,
+    0x5F, 0xC7, 0x77, 0x5F, 0xC7, 0x77, 0x59, 0xFA, 0x77, 0x75, 0xFC, 0x77, 0x75, 0xAF, 0x97, 0x77,
+    0x5F, 0xC7, 0x77, 0x5F, 0xC7, 0x77, 0x59, 0xFA, 0x77, 0x59, 0xAF, 0xAA, 0xFC, 0x77, 0x49, 0xFF,
+    0xFC, 0x97, 0x73, 0x9F, 0xFF, 0xD7, 0x73, 0x9F, 0xDA, 0x9A, 0xFD, 0x77, 0x3F, 0xC9, 0x2A, 0xFD,
+    0xA7, 0x71, 0xAF, 0x4F, 0xF7, 0x71, 0xFA, 0x3A, 0xFF, 0xA7, 0x79, 0xF3, 0x9F, 0xFD, 0x77, 0xAF,
+    0x3F, 0xCA, 0xAF, 0x77, 0xFA, 0x29, 0xFC, 0x09, 0xF7, 0x7F, 0xA2, 0xFC, 0x91, 0xF7, 0x7F, 0x91,
+    0xAF, 0xC2, 0xF9, 0x76, 0xF9, 0x1F, 0xC9, 0x2F, 0x97, 0x6F, 0xA0, 0xAF, 0xC2, 0x9F, 0x77, 0xFC,
+    0x9F, 0xC9, 0x2A, 0xF7, 0x7A, 0xFF, 0xCA, 0x29, 0xFC, 0x77, 0xAF, 0xFC, 0x99, 0x9F, 0xE7, 0x79,
+    0xFF, 0xFF, 0xDA, 0x77, 0x0F, 0xFF, 0xFD, 0x97, 0x70, 0x9F, 0xFF, 0xFC, 0x77, 0x2F, 0xFF, 0xF7,
+    0x72, 0x9F, 0xFF, 0xE7, 0x73, 0xFF, 0xFC, 0xA9, 0x77, 0x3A, 0xFC, 0x97, 0x77, 0x39, 0xFC, 0xA7,
+    0x77, 0x4F, 0xD7, 0x77, 0x4A, 0xFC, 0x97, 0x77, 0x4F, 0xD7, 0x77, 0x4A, 0xFC, 0x97, 0x77, 0x39,
+    0xFC, 0xA7, 0x77, 0x4F, 0xD7, 0x77, 0x4A, 0xFC, 0x97, 0x77, 0x4F, 0xD7, 0x77, 0x4A, 0xEA, 0x97,
+    0x77, 0x49, 0xD9, 0x77, 0x77, 0xA9, 0x77, 0x77, 0x00, 0x29, 0x99, 0x97, 0x6F, 0x76, 0xF9, 0x75,
+    0xFA, 0x75, 0xFC, 0x77, 0x77, 0x77, 0x77, 0x75, 0xFC, 0x95, 0xFF, 0xE9, 0x5F, 0xCA, 0xFC, 0x95,
+    0xAF, 0xAF, 0xC9, 0x5A, 0xFA, 0xFC, 0x95, 0xAF, 0xAF, 0xC9, 0x5A, 0xFA, 0xAF, 0x6A, 0xF9, 0xAF,
+    0x6A, 0xF9, 0xAF, 0x6A, 0xF9, 0xAF, 0x69, 0xF9, 0xAF, 0x69, 0xF9, 0xAF, 0x69, 0xF0, 0xAF, 0x69,
+    0xF0, 0x9F, 0x6A, 0xF0, 0x9F, 0xA5, 0xFC, 0x09, 0xFE, 0xAA, 0xFE, 0x1F, 0xFF, 0xF1, 0xFF, 0xFE,
+    0xA1, 0xAF, 0xFF, 0xD3, 0xFF, 0xFC, 0xA4, 0xAF, 0xFD, 0x97, 0x74, 0x70, 0xDA, 0x75, 0x9D, 0x97,
+    0x5E, 0x75, 0x9E, 0x75, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6F, 0xC9,
+    0x5F, 0xFE, 0x95, 0xFC, 0xAF, 0xC9, 0x5A, 0xFA, 0xFC, 0x95, 0xAF, 0xAF, 0xC9, 0x5A, 0xFA, 0xFC,
+    0x95, 0xAF, 0xAA, 0xF6, 0xAF, 0x9A, 0xF6, 0xAF, 0x9A, 0xF6, 0xAF, 0x9A, 0xF6, 0x9F, 0x9A, 0xF6,
+    0x9F, 0x9A, 0xF6, 0x9F, 0x0A, 0xF6, 0x9F, 0x09, 0xF6, 0xAF, 0x09, 0xFA, 0x5F, 0xC0, 0x9F, 0xEA,
+    0xAF, 0xE1, 0xFF, 0xFF, 0x1F, 0xFF, 0xEA, 0x1A, 0xFF, 0xFD, 0x3F, 0xFF, 0xCA, 0x4A, 0xFF, 0xD9,
+    0x77, 0x40, 0x77, 0x71, 0xE7, 0x5A, 0xEA, 0x73, 0xAF, 0xC9, 0x71, 0xAF, 0xE9, 0x7A, 0xE9, 0x09,
+    0xE9, 0x5A, 0xDA, 0x4E, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x1F, 0xC9, 0x5F, 0xFE, 0x95, 0xFC, 0xAF,
+    0xC9, 0x5A, 0xFA, 0xFC, 0x95, 0xAF, 0xAF, 0xC9, 0x5A, 0xFA, 0xFC, 0x95, 0xAF, 0xAA, 0xF6, 0xAF,
+    0x9A, 0xF6, 0xAF, 0x9A, 0xF6, 0xAF, 0x9A, 0xF6, 0x9F, 0x9A, 0xF6, 0x9F, 0x9A, 0xF6, 0x9F, 0x0A,
+    0xF6, 0x9F, 0x09, 0xF6, 0xAF, 0x09, 0xFA, 0x5F, 0xC0, 0x9F, 0xEA, 0xAF, 0xE1, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xEA, 0x1A, 0xFF, 0xFD, 0x3F, 0xFF, 0xCA, 0x4A, 0xFF, 0xD9, 0x77, 0x40, 0x3E, 0xA1, 0x9E,
+    0x95, 0x9F, 0x1A, 0xEA, 0x5A, 0xF1, 0xFA, 0x5F, 0xC1, 0xFC, 0x5F, 0xC1, 0xFC, 0x59, 0x99, 0x99,
+    0x19, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x72, 0xFC, 0x95, 0xFF, 0xE9, 0x5F, 0xCA, 0xFC, 0x95,
+    0xAF, 0xAF, 0xC9, 0x5A, 0xFA, 0xFC, 0x95, 0xAF, 0xAF, 0xC9, 0x5A, 0xFA, 0xAF, 0x6A, 0xF9, 0xAF,
+    0x6A, 0xF9, 0xAF, 0x6A, 0xF9, 0xAF, 0x69, 0xF9, 0xAF, 0x69, 0xF9, 0xAF, 0x69, 0xF0, 0xAF, 0x69,
+    0xF0, 0x9F, 0x6A, 0xF0, 0x9F, 0xA5, 0xFC, 0x09, 0xFE, 0xAA, 0xFE, 0x1F, 0xFF, 0xF1, 0xFF, 0xFE,
+    0xA1, 0xAF, 0xFF, 0xD3, 0xFF, 0xFC, 0xA4, 0xAF, 0xFD, 0x97, 0x74, 0x77, 0x73, 0xE7, 0x69, 0xDA,
+    0x76, 0xE9, 0x76, 0xE7, 0x6A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x2A, 0xF7, 0x0F, 0xA0, 0xF9, 0x69, 0xF1, 0xFC, 0x6F, 0xA1, 0x9F, 0x94, 0x9F, 0x3F, 0xC4,
+    0xFA, 0x39, 0xF9, 0x2A, 0xF5, 0xFC, 0x2F, 0xA5, 0x9F, 0xA0, 0xAF, 0x7F, 0xC0, 0xFC, 0x79, 0xFF,
+    0xC9, 0x70, 0xFF, 0xC7, 0x1A, 0xFE, 0x97, 0x2F, 0xE7, 0x3A, 0xFC, 0x97, 0x4F, 0xC7, 0x5F, 0xC7,
+    0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0xAF, 0xC7, 0x4A, 0xFC, 0x60, 0xAD, 0x97, 0xAD,
+    0x97, 0xAD, 0x97, 0xAE, 0x96, 0xAF, 0xD9, 0x3A, 0xFF, 0x2A, 0xFF, 0xC1, 0xAD, 0xA1, 0xAF, 0x0A,
+    0xD9, 0x29, 0xE9, 0xAD, 0x93, 0xE9, 0xAD, 0x92, 0xAE, 0x9A, 0xD9, 0x1A, 0xF0, 0xAF, 0xFC, 0x90,
+    0xAF, 0xF9, 0x1A, 0xFD, 0xA3, 0xAE, 0xA9, 0x5A, 0xD9, 0x7A, 0xD9, 0x7A, 0xD9, 0x7A, 0xD9, 0x70,
+    0x49, 0xAA, 0xA9, 0x7A, 0xFE, 0x5A, 0xFF, 0xC3, 0x9E, 0xA2, 0xEA, 0x2A, 0xE4, 0xE2, 0xEA, 0x29,
+    0xAE, 0x2E, 0x91, 0x9F, 0xC2, 0xE9, 0x1F, 0xA9, 0x2E, 0xA0, 0x9E, 0x5E, 0xA0, 0x9D, 0x95, 0xEA,
+    0x09, 0xDA, 0x5E, 0xA1, 0xF3, 0x9E, 0xA1, 0xAF, 0x91, 0x9E, 0xA2, 0xFC, 0x90, 0x9F, 0x29, 0xFC,
+    0x09, 0xF4, 0xFA, 0x9F, 0x5E, 0xAA, 0xFC, 0xA9, 0x19, 0xEA, 0xAF, 0xFF, 0xC9, 0xAF, 0xFF, 0xC0,
+    0xAF, 0xFF, 0x96, 0xAF, 0xA2, 0x1A, 0xE9, 0x72, 0xAE, 0xA7, 0x2A, 0xF7, 0x2A, 0xF9, 0x73, 0x99,
+    0x97, 0x77, 0x75, 0x9E, 0xA9, 0x7F, 0xFD, 0x3A, 0xFF, 0xD3, 0xE9, 0x19, 0xF2, 0x9D, 0xA3, 0xAE,
+    0x91, 0xE5, 0xE9, 0x1E, 0x5E, 0xA1, 0xDA, 0x5E, 0xA1, 0xD9, 0x5A, 0xE1, 0xD9, 0x5A, 0xE1, 0xDA,
+    0x5F, 0x1F, 0xAA, 0xAF, 0xD1, 0xAF, 0xFF, 0x2F, 0xFF, 0x91, 0x9F, 0xFE, 0x93, 0xAE, 0xA9, 0x40,
+    0x7D, 0xA7, 0x2A, 0xD7, 0x3E, 0x72, 0xAD, 0xA7, 0x2E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39,
+    0xEA, 0x97, 0xFF, 0xD3, 0xAF, 0xFD, 0x3E, 0x91, 0x9F, 0x29, 0xDA, 0x3A, 0xE9, 0x1E, 0x5E, 0x91,
+    0xE5, 0xEA, 0x1D, 0xA5, 0xEA, 0x1D, 0x95, 0xAE, 0x1D, 0x95, 0xAE, 0x1D, 0xA5, 0xF1, 0xFA, 0xAA,
+    0xFD, 0x1A, 0xFF, 0xF2, 0xFF, 0xF9, 0x19, 0xFF, 0xE9, 0x3A, 0xEA, 0x94, 0x77, 0x5D, 0xA7, 0x2F,
+    0x97, 0x0F, 0xD9, 0x6F, 0xF9, 0x4F, 0x1A, 0xE9, 0x2E, 0xA3, 0x9E, 0x97, 0x77, 0x71, 0x9E, 0xA9,
+    0x7F, 0xFD, 0x3A, 0xFF, 0xD3, 0xE9, 0x19, 0xF2, 0x9D, 0xA3, 0xAE, 0x91, 0xE5, 0xE9, 0x1E, 0x5E,
+    0xA1, 0xDA, 0x5E, 0xA1, 0xD9, 0x5A, 0xE1, 0xD9, 0x5A, 0xE1, 0xDA, 0x5F, 0x1F, 0xAA, 0xAF, 0xD1,
+    0xAF, 0xFF, 0x2F, 0xFF, 0x91, 0x9F, 0xFE, 0x93, 0xAE, 0xA9, 0x40, 0x3A, 0xD9, 0x1D, 0x59, 0xF9,
+    0x0D, 0x5A, 0xFC, 0xAD, 0x5D, 0xA0, 0xFA, 0x5A, 0xCA, 0x1A, 0xD7, 0x77, 0x75, 0x9E, 0xA9, 0x7F,
+    0xFD, 0x3A, 0xFF, 0xD3, 0xE9, 0x19, 0xF2, 0x9D, 0xA3, 0xAE, 0x91, 0xE5, 0xE9, 0x1E, 0x5E, 0xA1,
+    0xDA, 0x5E, 0xA1, 0xD9, 0x5A, 0xE1, 0xD9, 0x5A, 0xE1, 0xDA, 0x5F, 0x1F, 0xAA, 0xAF, 0xD1, 0xAF,
+    0xFF, 0x2F, 0xFF, 0x91, 0x9F, 0xFE, 0x93, 0xAE, 0xA9, 0x40, 0x29, 0x99, 0x29, 0x99, 0x93, 0xAE,
+    0x91, 0xF9, 0x2F, 0xA1, 0xF9, 0x2F, 0xA1, 0xFA, 0x2F, 0xC0, 0x9F, 0xA1, 0x9F, 0xC0, 0x9F, 0xC7,
+    0x77, 0x77, 0x71, 0x9E, 0xA9, 0x7F, 0xFD, 0x3A, 0xFF, 0xD3, 0xE9, 0x19, 0xF2, 0x9D, 0xA3, 0xAE,
+    0x91, 0xE5, 0xE9, 0x1E, 0x5E, 0xA1, 0xDA, 0x5E, 0xA1, 0xD9, 0x5A, 0xE1, 0xD9, 0x5A, 0xE1, 0xDA,
+    0x5F, 0x1F, 0xAA, 0xAF, 0xD1, 0xAF, 0xFF, 0x2F, 0xFF, 0x91, 0x9F, 0xFE, 0x93, 0xAE, 0xA9, 0x40,
+    0x5A, 0xD9, 0x71, 0xAF, 0x71, 0xD9, 0xD9, 0x70, 0xD0, 0xAC, 0xA7, 0x0F, 0xC9, 0x70, 0xAF, 0x72,
+    0x9A, 0xA7, 0x77, 0x77, 0x9E, 0xA9, 0x7F, 0xFD, 0x3A, 0xFF, 0xD3, 0xE9, 0x19, 0xF2, 0x9D, 0xA3,
+    0xAE, 0x91, 0xE5, 0xE9, 0x1E, 0x5E, 0xA1, 0xDA, 0x5E, 0xA1, 0xD9, 0x5A, 0xE1, 0xD9, 0x5A, 0xE1,
+    0xDA, 0x5F, 0x1F, 0xAA, 0xAF, 0xD1, 0xAF, 0xFF, 0x2F, 0xFF, 0x91, 0x9F, 0xFE, 0x93, 0xAE, 0xA9,
+    0x40, 0x77, 0x74, 0x9E, 0xA9, 0x4A, 0xAD, 0xA9, 0x6F, 0xFD, 0x9F, 0xEA, 0x4A, 0xFF, 0xFD, 0xAA,
+    0xEA, 0x3E, 0x91, 0x9F, 0xDA, 0x3E, 0x29, 0xDA, 0x3A, 0xFC, 0x19, 0x99, 0xAD, 0xA1, 0xE5, 0xFF,
+    0xFD, 0x1E, 0x5F, 0xFF, 0xD1, 0xDA, 0x5F, 0xFF, 0xD9, 0x0D, 0x95, 0xAE, 0xAA, 0x99, 0x96, 0xD9,
+    0x5A, 0xE9, 0x72, 0xDA, 0x5F, 0xC7, 0x2F, 0xAA, 0xAF, 0xFA, 0x92, 0x9A, 0xC1, 0xAF, 0xFF, 0xFF,
+    0xD2, 0xFF, 0xFF, 0xFD, 0x29, 0xFF, 0xFF, 0xFC, 0x4A, 0xEA, 0x94, 0x9A, 0xFA, 0x91, 0x77, 0x1A,
+    0xFA, 0x4A, 0xFE, 0x92, 0x9F, 0xF9, 0x2F, 0x99, 0x09, 0xA2, 0xAE, 0x70, 0xF7, 0x0E, 0xA7, 0x0E,
+    0xA7, 0x0F, 0x70, 0xF7, 0x0F, 0xA7, 0x9F, 0xCA, 0xAC, 0xA3, 0xFF, 0xCA, 0x3F, 0xFC, 0x93, 0x9F,
+    0xCA, 0x96, 0xDA, 0x70, 0x9F, 0xA6, 0x9A, 0x9E, 0x69, 0xFC, 0x69, 0xF7, 0x9A, 0xA9, 0x30, 0x1A,
+    0xE9, 0x72, 0xAE, 0xA7, 0x29, 0xF7, 0x29, 0xF9, 0x73, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x73,
+    0xAE, 0xA9, 0x69, 0xFF, 0x5F, 0xAA, 0xF3, 0xEA, 0x3A, 0xD9, 0x19, 0xE9, 0x09, 0x99, 0x9E, 0x1A,
+    0xFF, 0xF1, 0xFF, 0xFC, 0x90, 0xFF, 0xFC, 0x90, 0xEA, 0xA9, 0x99, 0x6E, 0xA7, 0x2F, 0x97, 0x1A,
+    0xFC, 0x99, 0x19, 0xAC, 0x91, 0xFF, 0xF9, 0x19, 0xFF, 0xE9, 0x29, 0xFF, 0xD5, 0xAA, 0xFA, 0x91,
+    0x77, 0x6D, 0xA7, 0x2A, 0xD9, 0x72, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x0A, 0xEA, 0x96, 0x9F, 0xF5, 0xFA, 0xAF, 0x3E, 0xA3, 0xAD, 0x91, 0x9E,
+    0x90, 0x99, 0x99, 0xE1, 0xAF, 0xFF, 0x1F, 0xFF, 0xC9, 0x0F, 0xFF, 0xC9, 0x0E, 0xAA, 0x99, 0x96,
+    0xEA, 0x72, 0xF9, 0x71, 0xAF, 0xC9, 0x91, 0x9A, 0xC9, 0x1F, 0xFF, 0x91, 0x9F, 0xFE, 0x92, 0x9F,
+    0xFD, 0x5A, 0xAF, 0xA9, 0x10, 0x6D, 0xA7, 0x2A, 0xE9, 0x70, 0x9F, 0xC7, 0x9F, 0xE5, 0xAE, 0x90,
+    0xAE, 0x3A, 0xE3, 0x9E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xAE, 0xA9, 0x69, 0xFF, 0x5F, 0xAA,
+    0xF3, 0xEA, 0x3A, 0xD9, 0x19, 0xE9, 0x09, 0x99, 0x9E, 0x1A, 0xFF, 0xF1, 0xFF, 0xFC, 0x90, 0xFF,
+    0xFC, 0x90, 0xEA, 0xA9, 0x99, 0x6E, 0xA7, 0x2F, 0x97, 0x1A, 0xFC, 0x99, 0x19, 0xAC, 0x91, 0xFF,
+    0xF9, 0x19, 0xFF, 0xE9, 0x29, 0xFF, 0xD5, 0xAA, 0xFA, 0x91, 0x29, 0x99, 0x39, 0x99, 0x39, 0xEA,
+    0x1A, 0xE9, 0x2A, 0xEA, 0x1F, 0xA2, 0xFC, 0x1F, 0xA2, 0xFC, 0x1F, 0xC2, 0xFC, 0x09, 0xFC, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0xAE, 0xA9, 0x69, 0xFF, 0x5F, 0xAA, 0xF3, 0xEA, 0x3A, 0xD9, 0x19,
+    0xE9, 0x09, 0x99, 0x9E, 0x1A, 0xFF, 0xF1, 0xFF, 0xFC, 0x90, 0xFF, 0xFC, 0x90, 0xEA, 0xA9, 0x99,
+    0x6E, 0xA7, 0x2F, 0x97, 0x1A, 0xFC, 0x99, 0x19, 0xAC, 0x91, 0xFF, 0xF9, 0x19, 0xFF, 0xE9, 0x29,
+    0xFF, 0xD5, 0xAA, 0xFA, 0x91, 0x99, 0x99, 0x6F, 0x6F, 0x95, 0xFA, 0x5F, 0xC7, 0x77, 0x72, 0xAD,
+    0xA5, 0xAD, 0xA5, 0xAD, 0xA5, 0xAD, 0xA5, 0xAD, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xF5,
+    0xF5, 0xF5, 0xF5, 0xF9, 0x00, 0x70, 0xDA, 0x1A, 0xD9, 0x1E, 0x1A, 0xDA, 0x1E, 0x97, 0x77, 0x75,
+    0xAD, 0xA1, 0xAD, 0xA1, 0xAD, 0xA1, 0xAD, 0xA1, 0xAD, 0xA1, 0xEA, 0x1E, 0xA1, 0xEA, 0x1E, 0xA1,
+    0xF1, 0xF1, 0xF1, 0xF1, 0xF9, 0x5D, 0xA7, 0x1A, 0xE9, 0x79, 0xFC, 0x69, 0xFE, 0x49, 0xE9, 0x0A,
+    0xE9, 0x19, 0xE3, 0x9E, 0x97, 0x77, 0x77, 0x6A, 0xDA, 0x71, 0xAD, 0xA7, 0x1A, 0xDA, 0x71, 0xAD,
+    0xA7, 0x1A, 0xDA, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xF7, 0x1F, 0x71, 0xF7,
+    0x1F, 0x71, 0xF9, 0x30, 0x0A, 0xDA, 0x1A, 0xDA, 0x1F, 0x1F, 0x1F, 0x1F, 0x09, 0xF0, 0x9F, 0x09,
+    0xF0, 0x9F, 0x77, 0x77, 0x70, 0xAD, 0xA7, 0xAD, 0xA7, 0xAD, 0xA7, 0xAD, 0xA7, 0xEA, 0x7E, 0xA7,
+    0xEA, 0x7E, 0xA7, 0xEA, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x92, 0x77, 0x74, 0xAD, 0xA7, 0x7F, 0xC7,
+    0x5A, 0xFD, 0x77, 0xAE, 0x73, 0xFF, 0xFA, 0x6F, 0xFF, 0xA6, 0xFF, 0xFA, 0x69, 0x3E, 0x70, 0xFD,
+    0x09, 0xE6, 0xAF, 0xFA, 0xDA, 0x59, 0xFF, 0xFA, 0x5F, 0xA1, 0x9F, 0xC9, 0x5F, 0x39, 0xF5, 0x9E,
+    0x94, 0xF5, 0x9E, 0x94, 0xF6, 0xF3, 0x9E, 0xA6, 0xFC, 0xAA, 0xFC, 0x7A, 0xFF, 0xDA, 0x70, 0xFF,
+    0xD7, 0x2F, 0xF9, 0x73, 0x9A, 0xEA, 0x71, 0x49, 0xD9, 0x1D, 0x6F, 0x90, 0xD5, 0xAD, 0xAD, 0xAD,
+    0x5A, 0xCA, 0x0F, 0xC5, 0xAD, 0x1A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0xE0, 0xAE, 0xA9, 0x4F, 0xFD,
+    0xA2, 0x9F, 0xFE, 0x91, 0x9F, 0xA9, 0x09, 0xF1, 0x9E, 0xA3, 0x9E, 0x19, 0xE5, 0xE1, 0xAE, 0x5E,
+    0x90, 0xAE, 0x5E, 0x90, 0xAE, 0x49, 0xEA, 0x0F, 0x93, 0x9E, 0xA0, 0xF9, 0x3A, 0xEA, 0x0F, 0x93,
+    0xAE, 0xA0, 0xFA, 0x3A, 0xF0, 0xFA, 0x3F, 0xC0, 0xFA, 0x3F, 0xC0, 0x1A, 0xE9, 0x72, 0xAE, 0xA7,
+    0x2A, 0xF7, 0x2A, 0xF9, 0x73, 0x99, 0x97, 0x77, 0x76, 0xAF, 0x96, 0xAF, 0xF4, 0xAF, 0xFD, 0x3F,
+    0x91, 0xAE, 0xA1, 0xAE, 0x93, 0xF1, 0xF4, 0x9E, 0x90, 0xEA, 0x5E, 0xA0, 0xEA, 0x5E, 0xA0, 0xEA,
+    0x5E, 0xA0, 0xF4, 0x9E, 0x90, 0xFA, 0x29, 0xF9, 0x0A, 0xFF, 0xF2, 0xFF, 0xEA, 0x2A, 0xFF, 0xD4,
+    0xAF, 0xF6, 0x9A, 0xF9, 0x30, 0x7D, 0xA7, 0x2A, 0xD7, 0x3E, 0x72, 0xAD, 0xA7, 0x2E, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x4A, 0xF9, 0x6A, 0xFF, 0x4A, 0xFF, 0xD3, 0xF9, 0x1A, 0xEA, 0x1A, 0xE9,
+    0x3F, 0x1F, 0x49, 0xE9, 0x0E, 0xA5, 0xEA, 0x0E, 0xA5, 0xEA, 0x0E, 0xA5, 0xEA, 0x0F, 0x49, 0xE9,
+    0x0F, 0xA2, 0x9F, 0x90, 0xAF, 0xFF, 0x2F, 0xFE, 0xA2, 0xAF, 0xFD, 0x4A, 0xFF, 0x69, 0xAF, 0x93,
+    0x77, 0x5D, 0xA7, 0x2F, 0x97, 0x0F, 0xD9, 0x6F, 0xF9, 0x4F, 0x1A, 0xE9, 0x2E, 0xA3, 0x9E, 0x97,
+    0x77, 0x72, 0xAF, 0x96, 0xAF, 0xF4, 0xAF, 0xFD, 0x3F, 0x91, 0xAE, 0xA1, 0xAE, 0x93, 0xF1, 0xF4,
+    0x9E, 0x90, 0xEA, 0x5E, 0xA0, 0xEA, 0x5E, 0xA0, 0xEA, 0x5E, 0xA0, 0xF4, 0x9E, 0x90, 0xFA, 0x29,
+    0xF9, 0x0A, 0xFF, 0xF2, 0xFF, 0xEA, 0x2A, 0xFF, 0xD4, 0xAF, 0xF6, 0x9A, 0xF9, 0x30, 0x49, 0x92,
+    0x99, 0x6F, 0x1D, 0x59, 0xFA, 0x0D, 0x5A, 0xCA, 0x9F, 0xC5, 0xDA, 0x0A, 0xEA, 0x59, 0xA9, 0x19,
+    0xA9, 0x77, 0x77, 0x6A, 0xF9, 0x6A, 0xFF, 0x4A, 0xFF, 0xD3, 0xF9, 0x1A, 0xEA, 0x1A, 0xE9, 0x3F,
+    0x1F, 0x49, 0xE9, 0x0E, 0xA5, 0xEA, 0x0E, 0xA5, 0xEA, 0x0E, 0xA5, 0xEA, 0x0F, 0x49, 0xE9, 0x0F,
+    0xA2, 0x9F, 0x90, 0xAF, 0xFF, 0x2F, 0xFE, 0xA2, 0xAF, 0xFD, 0x4A, 0xFF, 0x69, 0xAF, 0x93, 0x29,
+    0x99, 0x29, 0x99, 0x93, 0xAE, 0x91, 0xAE, 0x92, 0xAE, 0xA1, 0xF9, 0x2F, 0xC1, 0xFA, 0x2F, 0xC0,
+    0x9F, 0xA1, 0x9F, 0xC0, 0x9F, 0xC7, 0x77, 0x77, 0x72, 0xAF, 0x96, 0xAF, 0xF4, 0xAF, 0xFD, 0x3F,
+    0x91, 0xAE, 0xA1, 0xAE, 0x93, 0xF1, 0xF4, 0x9E, 0x90, 0xEA, 0x5E, 0xA0, 0xEA, 0x5E, 0xA0, 0xEA,
+    0x5E, 0xA0, 0xF4, 0x9E, 0x90, 0xFA, 0x29, 0xF9, 0x0A, 0xFF, 0xF2, 0xFF, 0xEA, 0x2A, 0xFF, 0xD4,
+    0xAF, 0xF6, 0x9A, 0xF9, 0x30, 0x69, 0x99, 0x97, 0x59, 0xEA, 0x75, 0x9F, 0x75, 0xAF, 0x75, 0xFC,
+    0x75, 0xFC, 0x97, 0x77, 0x74, 0x99, 0x99, 0x94, 0xFF, 0xFE, 0x2A, 0xFF, 0xFE, 0x90, 0x9F, 0xFF,
+    0xFA, 0x77, 0x72, 0x99, 0x99, 0x75, 0x9E, 0xA7, 0x59, 0xF7, 0x5A, 0xF7, 0x5F, 0xC7, 0x5F, 0xC9,
+    0x60, 0x77, 0x77, 0xA9, 0x74, 0xAD, 0x74, 0x9E, 0x74, 0xEA, 0x74, 0xE9, 0x73, 0x9E, 0x74, 0xAE,
+    0x74, 0xEA, 0x73, 0x9E, 0x74, 0xAE, 0x74, 0xEA, 0x74, 0xE9, 0x73, 0x9E, 0x74, 0xF7, 0x1A, 0xFC,
+    0xA7, 0x9F, 0xF6, 0x9F, 0xFD, 0x5F, 0x9F, 0xDA, 0x3A, 0xE9, 0x0F, 0xE3, 0xF0, 0x9E, 0xAE, 0x92,
+    0xEA, 0x0F, 0x0E, 0xA2, 0xEA, 0x0E, 0xA0, 0xEA, 0x2E, 0xA9, 0xE9, 0x0E, 0xA2, 0xFA, 0xE0, 0x9E,
+    0x92, 0xFF, 0x9F, 0x92, 0xAF, 0xFF, 0x4F, 0xFE, 0xA4, 0xAF, 0xFD, 0x6A, 0xFF, 0x79, 0xFD, 0x97,
+    0x0A, 0xE9, 0x73, 0xF7, 0x39, 0xF7, 0x3A, 0xEA, 0x73, 0xF7, 0x4F, 0x73, 0x9E, 0xA7, 0x3F, 0x97,
+    0x3F, 0x73, 0x9E, 0x97, 0x3A, 0xD7, 0x5C, 0xA7, 0x69, 0x76, 0x19, 0x99, 0x97, 0x29, 0xF7, 0x29,
+    0xF7, 0x3F, 0x97, 0x2F, 0xA7, 0x77, 0x77, 0x71, 0xE5, 0xAE, 0x1E, 0x5A, 0xE1, 0xE5, 0xAE, 0x1E,
+    0x94, 0xAE, 0x1E, 0x94, 0xAE, 0x1E, 0x94, 0xAE, 0x1E, 0xA4, 0xF9, 0x0A, 0xDA, 0x4F, 0x90, 0xAE,
+    0x4F, 0x90, 0xAE, 0x4F, 0x90, 0x9F, 0x91, 0xFC, 0x90, 0x9F, 0xFF, 0x91, 0xFF, 0xF9, 0x1A, 0xFF,
+    0xEA, 0x2F, 0xFE, 0xA3, 0xAF, 0xA4, 0x77, 0x6D, 0xA7, 0x2A, 0xD7, 0x3E, 0x72, 0xAD, 0xA7, 0x2E,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0E, 0x5A, 0xE1, 0xE5, 0xAE, 0x1E, 0x5A, 0xE1, 0xE9, 0x4A,
+    0xE1, 0xE9, 0x4A, 0xE1, 0xE9, 0x4A, 0xE1, 0xEA, 0x4F, 0x90, 0xAD, 0xA4, 0xF9, 0x0A, 0xE4, 0xF9,
+    0x0A, 0xE4, 0xF9, 0x09, 0xF9, 0x1F, 0xC9, 0x09, 0xFF, 0xF9, 0x1F, 0xFF, 0x91, 0xAF, 0xFE, 0xA2,
+    0xFF, 0xEA, 0x3A, 0xFA, 0x40, 0x6D, 0xA7, 0x2A, 0xE7, 0x1A, 0xFC, 0x7A, 0xFE, 0x5A, 0xE9, 0x0F,
+    0x3A, 0xE3, 0x9E, 0x77, 0x77, 0x76, 0xE5, 0xAE, 0x1E, 0x5A, 0xE1, 0xE5, 0xAE, 0x1E, 0x94, 0xAE,
+    0x1E, 0x94, 0xAE, 0x1E, 0x94, 0xAE, 0x1E, 0xA4, 0xF9, 0x0A, 0xDA, 0x4F, 0x90, 0xAE, 0x4F, 0x90,
+    0xAE, 0x4F, 0x90, 0x9F, 0x91, 0xFC, 0x90, 0x9F, 0xFF, 0x91, 0xFF, 0xF9, 0x1A, 0xFF, 0xEA, 0x2F,
+    0xFE, 0xA3, 0xAF, 0xA4, 0x19, 0xE9, 0x1A, 0xE9, 0x2A, 0xEA, 0x1F, 0x92, 0xFC, 0x1F, 0xA2, 0xFC,
+    0x1F, 0xA2, 0xFC, 0x09, 0xFC, 0x29, 0x99, 0x99, 0x19, 0x99, 0x99, 0x77, 0x77, 0x76, 0xE5, 0xAE,
+    0x1E, 0x5A, 0xE1, 0xE5, 0xAE, 0x1E, 0x94, 0xAE, 0x1E, 0x94, 0xAE, 0x1E, 0x94, 0xAE, 0x1E, 0xA4,
+    0xF9, 0x0A, 0xDA, 0x4F, 0x90, 0xAE, 0x4F, 0x90, 0xAE, 0x4F, 0x90, 0x9F, 0x91, 0xFC, 0x90, 0x9F,
+    0xFF, 0x91, 0xFF, 0xF9, 0x1A, 0xFF, 0xEA, 0x2F, 0xFE, 0xA3, 0xAF, 0xA4, 0x70, 0xE7, 0x49, 0xDA,
+    0x74, 0xE7, 0x49, 0xE7, 0x4E, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x70, 0xF6, 0xAE, 0x19, 0xEA, 0x5F, 0x2F, 0x49, 0xE9, 0x29, 0xF3, 0xAE, 0x4F, 0x92, 0xF4, 0x9F,
+    0x2E, 0xA5, 0xFA, 0x0A, 0xE6, 0x9F, 0x0F, 0x7F, 0xFA, 0x79, 0xFE, 0x71, 0xFE, 0x71, 0x9F, 0xCA,
+    0x72, 0xFC, 0x73, 0xAF, 0x73, 0x9E, 0xA7, 0x3F, 0x96, 0x99, 0x9A, 0xFC, 0x7F, 0xF9, 0x7F, 0xF7,
+    0x0F, 0xE7, 0x1F, 0xA9, 0x70, 0xAD, 0xA7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xEA, 0x95, 0xAF, 0xDA,
+    0x3A, 0xFF, 0x2A, 0xEA, 0xFC, 0x1A, 0xE1, 0xAE, 0xA0, 0xAE, 0x2A, 0xE9, 0xAE, 0x3E, 0xAA, 0xE3,
+    0xAD, 0xA9, 0xE3, 0xAD, 0xA9, 0xE3, 0xE9, 0x9E, 0x2A, 0xE0, 0x9E, 0x1A, 0xEA, 0x09, 0xE9, 0xFC,
+    0x19, 0xFF, 0x91, 0x9F, 0xE3, 0x9F, 0xA9, 0x49, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E,
+    0x96, 0x3F, 0x19, 0xEA, 0x49, 0xF1, 0x9E, 0xA4, 0x9F, 0x1A, 0xF4, 0xAF, 0x1F, 0xC4, 0xFC, 0x90,
+    0xFC, 0x49, 0x99, 0x99, 0x19, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0xF6, 0xAE,
+    0x19, 0xEA, 0x5F, 0x2F, 0x49, 0xE9, 0x29, 0xF3, 0xAE, 0x4F, 0x92, 0xF4, 0x9F, 0x2E, 0xA5, 0xFA,
+    0x0A, 0xE6, 0x9F, 0x0F, 0x7F, 0xFA, 0x79, 0xFE, 0x71, 0xFE, 0x71, 0x9F, 0xCA, 0x72, 0xFC, 0x73,
+    0xAF, 0x73, 0x9E, 0xA7, 0x3F, 0x96, 0x99, 0x9A, 0xFC, 0x7F, 0xF9, 0x7F, 0xF7, 0x0F, 0xE7, 0x1F,
+    0xA9, 0x70, 0x59, 0x9A, 0xAA, 0xAF, 0x97, 0x1A, 0xFF, 0xE7, 0x1F, 0xFF, 0x70, 0x9A, 0xAA, 0xAA,
+    0xAA, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xF7, 0x71, 0xFA, 0x77, 0xAF, 0xC7,
+    0x7F, 0xD9, 0x75, 0x9F, 0xDA, 0x75, 0xFA, 0xE7, 0x5E, 0xA9, 0xEA, 0x73, 0xAE, 0x90, 0xF7, 0x3F,
+    0x1A, 0xE9, 0x71, 0x9E, 0xA1, 0x9E, 0xA7, 0x1F, 0x92, 0xF7, 0x1F, 0x3F, 0xA7, 0xAF, 0x39, 0xF7,
+    0xFC, 0xAA, 0xAA, 0xAF, 0x95, 0x9F, 0xFF, 0xDA, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF,
+    0xFC, 0x3F, 0xC7, 0xFC, 0x91, 0x9F, 0xC7, 0xAF, 0xA1, 0xFC, 0x97, 0x9F, 0xC0, 0x39, 0x99, 0x99,
+    0xAA, 0xAA, 0x3F, 0xFE, 0x2A, 0xFF, 0xEA, 0x1F, 0xEA, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x79, 0xEA, 0x97, 0xFF, 0xD3, 0xAF, 0xFD, 0x3E, 0x91, 0x9F, 0x29, 0xDA, 0x3A, 0xE9, 0x1E, 0x5E,
+    0x91, 0xE5, 0xEA, 0x1D, 0xA5, 0xEA, 0x1D, 0x95, 0xAE, 0x1D, 0x95, 0xAE, 0x1D, 0xA5, 0xF1, 0xFA,
+    0xAA, 0xFD, 0x1A, 0xFF, 0xF2, 0xFF, 0xF9, 0x19, 0xFF, 0xE9, 0x3A, 0xEA, 0x94, 0x77, 0x72, 0x9E,
+    0x92, 0xAE, 0x72, 0xFF, 0xDA, 0x72, 0xFF, 0xD7, 0x39, 0xFF, 0x97, 0x5A, 0xEA, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x72, 0xF7, 0x71, 0xFA, 0x77, 0xAF, 0xC7, 0x7F, 0xD9, 0x75, 0x9F, 0xDA, 0x75, 0xFA,
+    0xE7, 0x5E, 0xA9, 0xEA, 0x73, 0xAE, 0x90, 0xF7, 0x3F, 0x1A, 0xE9, 0x71, 0x9E, 0xA1, 0x9E, 0xA7,
+    0x1F, 0x92, 0xF7, 0x1F, 0x3F, 0xA7, 0xAF, 0x39, 0xF7, 0xFC, 0xAA, 0xAA, 0xAF, 0x95, 0x9F, 0xFF,
+    0xDA, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xFC, 0x3F, 0xC7, 0xFC, 0x91, 0x9F, 0xC7,
+    0xAF, 0xA1, 0xFC, 0x97, 0x9F, 0xC0, 0x77, 0x0E, 0xA3, 0xE9, 0x2A, 0xFA, 0xFC, 0x39, 0xFF, 0xCA,
+    0x4A, 0xFF, 0x69, 0xAE, 0xA9, 0x77, 0x77, 0x77, 0x49, 0xEA, 0x97, 0xFF, 0xD3, 0xAF, 0xFD, 0x3E,
+    0x91, 0x9F, 0x29, 0xDA, 0x3A, 0xE9, 0x1E, 0x5E, 0x91, 0xE5, 0xEA, 0x1D, 0xA5, 0xEA, 0x1D, 0x95,
+    0xAE, 0x1D, 0x95, 0xAE, 0x1D, 0xA5, 0xF1, 0xFA, 0xAA, 0xFD, 0x1A, 0xFF, 0xF2, 0xFF, 0xF9, 0x19,
+    0xFF, 0xE9, 0x3A, 0xEA, 0x94, 0x70, 0xF7, 0x71, 0xFA, 0x77, 0xAF, 0xC7, 0x7F, 0xD9, 0x75, 0x9F,
+    0xDA, 0x75, 0xFA, 0xE7, 0x5E, 0xA9, 0xEA, 0x73, 0xAE, 0x90, 0xF7, 0x3F, 0x1A, 0xE9, 0x71, 0x9E,
+    0xA1, 0x9E, 0xA7, 0x1F, 0x92, 0xF7, 0x1F, 0x3F, 0xA7, 0xAF, 0x39, 0xF7, 0xFC, 0xAA, 0xAA, 0xAF,
+    0x95, 0x9F, 0xFF, 0xDA, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xFC, 0x3F, 0xC7, 0xFC,
+    0x91, 0x9F, 0xC7, 0xAF, 0xA1, 0xFC, 0x97, 0x9F, 0xC7, 0x70, 0xE9, 0x77, 0x0E, 0xA7, 0x71, 0xE9,
+    0x9A, 0x77, 0xFD, 0x77, 0x9F, 0xC9, 0x77, 0x9A, 0xE7, 0x76, 0x77, 0x49, 0xEA, 0x97, 0x1F, 0xFD,
+    0x5A, 0xFF, 0xD5, 0xE9, 0x19, 0xF4, 0x9D, 0xA3, 0xAE, 0x93, 0xE5, 0xE9, 0x3E, 0x5E, 0xA3, 0xDA,
+    0x5E, 0xA3, 0xD9, 0x5A, 0xDA, 0x3D, 0x95, 0xAE, 0x3D, 0xA5, 0xF3, 0xFA, 0xAA, 0xFD, 0x3A, 0xFF,
+    0xF4, 0xFF, 0xF9, 0x39, 0xFF, 0xE9, 0x5A, 0xEA, 0x90, 0xF7, 0x3A, 0xE9, 0x73, 0xE9, 0x73, 0xAD,
+    0xA7, 0x4A, 0xFC, 0xA7, 0x19, 0xFD, 0x72, 0x9F, 0xC7, 0x69, 0x10, 0x77, 0x73, 0xDA, 0x75, 0x9D,
+    0x97, 0x5E, 0x75, 0x9E, 0x75, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x39, 0xAF, 0xDA, 0x95, 0x9F, 0xFD,
+    0xA4, 0xFF, 0xF9, 0x3F, 0xFF, 0xC3, 0xAF, 0xFA, 0xAE, 0x3F, 0xD9, 0x71, 0xAF, 0xC7, 0x3F, 0xC7,
+    0x39, 0xFA, 0x73, 0xAF, 0xA7, 0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFD, 0x73, 0xFD,
+    0x97, 0x2A, 0xFD, 0xA9, 0x29, 0x9A, 0xC1, 0x9F, 0xFF, 0xE2, 0xFF, 0xFE, 0x29, 0xFF, 0xFD, 0x3A,
+    0xFF, 0xFC, 0x4A, 0xFF, 0xF5, 0x9A, 0xFF, 0xD0, 0x6D, 0xA7, 0x09, 0xD9, 0x70, 0xE7, 0x09, 0xDA,
+    0x70, 0xE9, 0x77, 0x5A, 0xFA, 0x4A, 0xFE, 0x92, 0x9F, 0xF9, 0x2F, 0x99, 0x09, 0xA2, 0xAE, 0x70,
+    0xF7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0F, 0x70, 0xF7, 0x0F, 0xA7, 0x9F, 0xCA, 0xAC, 0xA3, 0xFF, 0xCA,
+    0x3F, 0xFC, 0x93, 0x9A, 0xFA, 0x90, 0x70, 0xD9, 0x75, 0xF7, 0x4A, 0xFC, 0x72, 0xAF, 0xE7, 0x0F,
+    0x90, 0xF6, 0xEA, 0x3A, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xFD, 0xA9, 0x59, 0xFF, 0xDA,
+    0x4F, 0xFF, 0x93, 0xFF, 0xFC, 0x3A, 0xFF, 0xAA, 0xE3, 0xFD, 0x97, 0x1A, 0xFC, 0x73, 0xFC, 0x73,
+    0x9F, 0xA7, 0x3A, 0xFA, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xD7, 0x3F, 0xD9,
+    0x72, 0xAF, 0xDA, 0x92, 0x99, 0xAC, 0x19, 0xFF, 0xFE, 0x2F, 0xFF, 0xE2, 0x9F, 0xFF, 0xD3, 0xAF,
+    0xFF, 0xC4, 0xAF, 0xFF, 0x59, 0xAF, 0xFD, 0x00, 0x77, 0x29, 0xD9, 0x71, 0xF7, 0x0F, 0xD6, 0xFF,
+    0x4E, 0xA1, 0xAE, 0x2E, 0x93, 0x9E, 0x77, 0x77, 0x1A, 0xFA, 0x5A, 0xFE, 0x93, 0x9F, 0xF9, 0x3F,
+    0x99, 0x09, 0xA3, 0xAE, 0x71, 0xF7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1F, 0x71, 0xF7, 0x1F, 0xA7, 0x09,
+    0xFC, 0xAA, 0xCA, 0x4F, 0xFC, 0xA4, 0xFF, 0xC9, 0x49, 0xAF, 0xA9, 0x10, 0x70, 0x99, 0x97, 0x5A,
+    0xE9, 0x74, 0xFA, 0x74, 0xFA, 0x74, 0xFC, 0x73, 0x9F, 0xC7, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xFD,
+    0xA9, 0x59, 0xFF, 0xDA, 0x4F, 0xFF, 0x93, 0xFF, 0xFC, 0x3A, 0xFF, 0xAA, 0xE3, 0xFD, 0x97, 0x1A,
+    0xFC, 0x73, 0xFC, 0x73, 0x9F, 0xA7, 0x3A, 0xFA, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0x97,
+    0x3F, 0xD7, 0x3F, 0xD9, 0x72, 0xAF, 0xDA, 0x92, 0x99, 0xAC, 0x19, 0xFF, 0xFE, 0x2F, 0xFF, 0xE2,
+    0x9F, 0xFF, 0xD3, 0xAF, 0xFF, 0xC4, 0xAF, 0xFF, 0x59, 0xAF, 0xFD, 0x00, 0x4A, 0xE7, 0x0F, 0x97,
+    0xFA, 0x7F, 0xA6, 0x9F, 0xC6, 0x99, 0x99, 0x99, 0x77, 0x4A, 0xFA, 0x4A, 0xFE, 0x92, 0x9F, 0xF9,
+    0x2F, 0x99, 0x09, 0xA2, 0xAE, 0x70, 0xF7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0F, 0x70, 0xF7, 0x0F, 0xA7,
+    0x9F, 0xCA, 0xAC, 0xA3, 0xFF, 0xCA, 0x3F, 0xFC, 0x93, 0x9A, 0xFA, 0x90, 0x39, 0x99, 0x69, 0x95,
+    0xAE, 0x39, 0xE6, 0xAE, 0x90, 0xF7, 0x09, 0xFE, 0x72, 0x9F, 0xC7, 0x4A, 0xE7, 0x6D, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x75, 0x9A, 0xFD, 0xA9, 0x59, 0xFF, 0xDA, 0x4F, 0xFF, 0x93, 0xFF, 0xFC, 0x3A,
+    0xFF, 0xAA, 0xE3, 0xFD, 0x97, 0x1A, 0xFC, 0x73, 0xFC, 0x73, 0x9F, 0xA7, 0x3A, 0xFA, 0x73, 0xFC,
+    0x97, 0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xD7, 0x3F, 0xD9, 0x72, 0xAF, 0xDA, 0x92, 0x99, 0xAC,
+    0x19, 0xFF, 0xFE, 0x2F, 0xFF, 0xE2, 0x9F, 0xFF, 0xD3, 0xAF, 0xFF, 0xC4, 0xAF, 0xFF, 0x59, 0xAF,
+    0xFD, 0x00, 0x0A, 0xAA, 0x59, 0xAA, 0x90, 0x9E, 0x92, 0xEA, 0x29, 0xFA, 0xEA, 0x49, 0xFD, 0xA6,
+    0x9F, 0xA7, 0x09, 0xE7, 0x2A, 0xA9, 0x77, 0x77, 0x5A, 0xFA, 0x5A, 0xFE, 0x93, 0x9F, 0xF9, 0x3F,
+    0x99, 0x09, 0xA3, 0xAE, 0x71, 0xF7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1F, 0x71, 0xF7, 0x1F, 0xA7, 0x09,
+    0xFC, 0xAA, 0xCA, 0x4F, 0xFC, 0xA4, 0xFF, 0xC9, 0x49, 0xAF, 0xA9, 0x10, 0x1A, 0xAA, 0x5A, 0xAA,
+    0x96, 0xEA, 0x19, 0xEA, 0x70, 0xFA, 0xEA, 0x72, 0xFD, 0xA7, 0x4F, 0xA7, 0x59, 0xE7, 0x79, 0xA7,
+    0x77, 0x77, 0x77, 0x72, 0xFF, 0xDA, 0x96, 0xFF, 0xFC, 0xA4, 0xFF, 0xFE, 0x92, 0xFF, 0xFF, 0x2F,
+    0xA0, 0x99, 0x9A, 0xFE, 0x1F, 0xA5, 0x9F, 0xC9, 0x0F, 0xA7, 0xFA, 0x0F, 0xA7, 0x9F, 0x0F, 0xA7,
+    0x0F, 0x0F, 0xA7, 0x0F, 0x0F, 0xA7, 0x0A, 0xE0, 0xFA, 0x70, 0xF0, 0xFA, 0x70, 0xF0, 0xFA, 0x7F,
+    0xC0, 0xFA, 0x39, 0x9A, 0xFD, 0x0F, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xC9, 0x0F, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xF2, 0xFF, 0xFD, 0xA3, 0xFF, 0xEA, 0x95, 0x72, 0x9E, 0x77, 0x9E, 0x09, 0xE7, 0x29, 0xE0,
+    0xAE, 0x72, 0xAE, 0x0A, 0xE7, 0x2A, 0xE0, 0xF7, 0x2A, 0xE0, 0xEA, 0x4A, 0xE9, 0x0A, 0xE0, 0xEA,
+    0x29, 0xFF, 0xE0, 0xAA, 0xA9, 0x19, 0xFF, 0xF6, 0xFA, 0xAF, 0xE5, 0x9E, 0x92, 0xFC, 0xA5, 0xEA,
+    0x39, 0xFA, 0x5E, 0x94, 0xFA, 0x5E, 0x5F, 0xA5, 0xE5, 0xF9, 0x5E, 0x5F, 0x95, 0xEA, 0x3A, 0xFA,
+    0x5A, 0xFF, 0xFA, 0x6F, 0xFF, 0xA6, 0xAF, 0xFE, 0xA7, 0xFF, 0xEA, 0x70, 0x9A, 0xEA, 0x71, 0x4F,
+    0xFD, 0xA9, 0x73, 0xFF, 0xFC, 0xA7, 0x1F, 0xFF, 0xE9, 0x7F, 0xFF, 0xF9, 0x6F, 0xA0, 0x99, 0x9A,
+    0xAF, 0xD6, 0xFA, 0x6A, 0xF9, 0x5F, 0xA7, 0xFA, 0x5F, 0xA7, 0x0F, 0x5F, 0xA7, 0x0F, 0x1F, 0xFF,
+    0x94, 0xAE, 0x1F, 0xFF, 0x94, 0xF1, 0xFF, 0xF9, 0x4F, 0x5F, 0xA7, 0x9F, 0x5F, 0xA6, 0x9F, 0xC5,
+    0xFA, 0x39, 0x9F, 0xE5, 0xFF, 0xFF, 0xCA, 0x5F, 0xFF, 0xFC, 0x6F, 0xFF, 0xFA, 0x6F, 0xFF, 0xF7,
+    0xFF, 0xFD, 0xA7, 0x0F, 0xFE, 0xA9, 0x50, 0x72, 0x9E, 0x77, 0x9E, 0x72, 0x9F, 0xFF, 0x69, 0xFF,
+    0xF6, 0x9F, 0xFF, 0x79, 0x99, 0x9F, 0x99, 0x99, 0x5A, 0xE9, 0x0A, 0xE7, 0x9F, 0xFE, 0x69, 0xFF,
+    0xF6, 0xFA, 0xAF, 0xE5, 0x9E, 0x92, 0xFC, 0xA5, 0xEA, 0x39, 0xFA, 0x5E, 0x94, 0xFA, 0x5E, 0x5F,
+    0xA5, 0xE5, 0xF9, 0x5E, 0x5F, 0x95, 0xEA, 0x3A, 0xFA, 0x5A, 0xFF, 0xFA, 0x6F, 0xFF, 0xA6, 0xAF,
+    0xFE, 0xA7, 0xFF, 0xEA, 0x70, 0x9A, 0xEA, 0x71, 0x19, 0x99, 0x9A, 0xAA, 0xAD, 0xA2, 0x9F, 0xFE,
+    0x2F, 0xFF, 0x90, 0x9D, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x77, 0x77, 0x77, 0x77, 0x75, 0xAA, 0xAA,
+    0xAA, 0xFE, 0x99, 0xFF, 0xFC, 0x09, 0xFF, 0xFC, 0x09, 0xFF, 0xAA, 0xAA, 0x90, 0x9E, 0xA7, 0x19,
+    0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0xAF, 0xAA, 0xAE, 0x92, 0xAF, 0xFD, 0x92, 0xAF, 0xFD,
+    0x92, 0xAF, 0xFD, 0x92, 0xAF, 0x71, 0xAE, 0xA7, 0x1A, 0xEA, 0x71, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x90, 0xFF, 0xFD, 0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x9F, 0xFF, 0xDA, 0xFF, 0xFE, 0x77, 0x0A, 0xAA,
+    0xFF, 0x3F, 0xFE, 0x91, 0xAF, 0xFF, 0x19, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x4A, 0xEA, 0x96, 0x9F, 0xF5, 0xFA, 0xAF, 0x3E, 0xA3, 0xAD, 0x91, 0x9E, 0x90, 0x99, 0x99,
+    0xE1, 0xAF, 0xFF, 0x1F, 0xFF, 0xC9, 0x0F, 0xFF, 0xC9, 0x0E, 0xAA, 0x99, 0x96, 0xEA, 0x72, 0xF9,
+    0x71, 0xAF, 0xC9, 0x91, 0x9A, 0xC9, 0x1F, 0xFF, 0x91, 0x9F, 0xFE, 0x92, 0x9F, 0xFD, 0x5A, 0xAF,
+    0xA9, 0x10, 0x77, 0x0E, 0x93, 0xE3, 0xFC, 0xAF, 0xA3, 0xAF, 0xFC, 0x94, 0xFF, 0xA6, 0x9A, 0xEA,
+    0x77, 0x77, 0x77, 0x77, 0x1A, 0xAA, 0xAA, 0xAF, 0xE9, 0x9F, 0xFF, 0xC0, 0x9F, 0xFF, 0xC0, 0x9F,
+    0xFA, 0xAA, 0xA9, 0x09, 0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0x9E, 0xA7, 0x1A, 0xFA, 0xAA,
+    0xE9, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9, 0x2A, 0xF7, 0x1A, 0xEA, 0x71, 0xAE,
+    0xA7, 0x1F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x0F, 0xFF, 0xD9, 0xFF,
+    0xFD, 0xAF, 0xFF, 0xE0, 0x77, 0x0A, 0xE3, 0xE9, 0x2A, 0xFF, 0xD3, 0x9F, 0xFC, 0xA4, 0xAF, 0xF7,
+    0xAE, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xEA, 0x96, 0x9F, 0xF5, 0xFA, 0xAF, 0x3E,
+    0xA3, 0xAD, 0x91, 0x9E, 0x90, 0x99, 0x99, 0xE1, 0xAF, 0xFF, 0x1F, 0xFF, 0xC9, 0x0F, 0xFF, 0xC9,
+    0x0E, 0xAA, 0x99, 0x96, 0xEA, 0x72, 0xF9, 0x71, 0xAF, 0xC9, 0x91, 0x9A, 0xC9, 0x1F, 0xFF, 0x91,
+    0x9F, 0xFE, 0x92, 0x9F, 0xFD, 0x5A, 0xAF, 0xA9, 0x10, 0x59, 0x99, 0x72, 0xAE, 0x97, 0x1F, 0xA7,
+    0x1F, 0xA7, 0x1F, 0xC7, 0x09, 0xFC, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xAA, 0xAA, 0xAF, 0xE9, 0x9F,
+    0xFF, 0xC0, 0x9F, 0xFF, 0xC0, 0x9F, 0xFA, 0xAA, 0xA9, 0x09, 0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xEA,
+    0x71, 0x9E, 0xA7, 0x1A, 0xFA, 0xAA, 0xE9, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9,
+    0x2A, 0xF7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7, 0x1F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xD0,
+    0xFF, 0xFD, 0x0F, 0xFF, 0xD9, 0xFF, 0xFD, 0xAF, 0xFF, 0xE0, 0x5F, 0x72, 0xF7, 0x19, 0xF7, 0x1A,
+    0xF7, 0x1F, 0xC9, 0x70, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAE, 0xA9, 0x69,
+    0xFF, 0x5F, 0xAA, 0xF3, 0xEA, 0x3A, 0xD9, 0x19, 0xE9, 0x09, 0x99, 0x9E, 0x1A, 0xFF, 0xF1, 0xFF,
+    0xFC, 0x90, 0xFF, 0xFC, 0x90, 0xEA, 0xA9, 0x99, 0x6E, 0xA7, 0x2F, 0x97, 0x1A, 0xFC, 0x99, 0x19,
+    0xAC, 0x91, 0xFF, 0xF9, 0x19, 0xFF, 0xE9, 0x29, 0xFF, 0xD5, 0xAA, 0xFA, 0x91, 0x0A, 0xAA, 0xAA,
+    0xAF, 0xE9, 0x9F, 0xFF, 0xC0, 0x9F, 0xFF, 0xC0, 0x9F, 0xFA, 0xAA, 0xA9, 0x09, 0xEA, 0x71, 0x9E,
+    0xA7, 0x19, 0xEA, 0x71, 0x9E, 0xA7, 0x1A, 0xFA, 0xAA, 0xE9, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9,
+    0x2A, 0xFF, 0xD9, 0x2A, 0xF7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7, 0x1F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA9,
+    0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x0F, 0xFF, 0xD9, 0xFF, 0xFD, 0xAF, 0xFF, 0xE3, 0xAD, 0xA7, 0x2E,
+    0x72, 0xAD, 0x73, 0xAF, 0xC7, 0x1F, 0xC7, 0x2A, 0xE7, 0x74, 0x4A, 0xEA, 0x96, 0x9F, 0xF5, 0xFA,
+    0xAF, 0x3E, 0xA3, 0xAD, 0x91, 0x9E, 0x90, 0x99, 0x99, 0xE1, 0xAF, 0xFF, 0x1F, 0xFF, 0xC9, 0x0F,
+    0xFF, 0xC9, 0x0E, 0xAA, 0x99, 0x96, 0xEA, 0x72, 0xF9, 0x71, 0xAF, 0xC9, 0x91, 0x9A, 0xC9, 0x1F,
+    0xFF, 0x91, 0x9F, 0xFE, 0x92, 0x9F, 0xFD, 0x5A, 0xAF, 0xA9, 0x77, 0x70, 0xAA, 0x72, 0x9E, 0x72,
+    0xE7, 0x2A, 0xD7, 0x3A, 0xFC, 0x70, 0x9F, 0xC7, 0x2A, 0xE7, 0x72, 0x77, 0xAD, 0xA4, 0xE9, 0x2A,
+    0xE9, 0x09, 0xE9, 0x4A, 0xFE, 0x96, 0xAF, 0xC9, 0x70, 0xAE, 0xA7, 0x2E, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x1A, 0xAA, 0xAA, 0xAF, 0xE9, 0x9F, 0xFF, 0xC0, 0x9F, 0xFF, 0xC0, 0x9F, 0xFA, 0xAA, 0xA9,
+    0x09, 0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0x9E, 0xA7, 0x1A, 0xFA, 0xAA, 0xE9, 0x2A, 0xFF,
+    0xD9, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9, 0x2A, 0xF7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7, 0x1F, 0xCA,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x0F, 0xFF, 0xD9, 0xFF, 0xFD, 0xAF, 0xFF,
+    0xE0, 0x19, 0x96, 0x99, 0x92, 0xEA, 0x3E, 0xA3, 0xF0, 0x9E, 0xA5, 0xFE, 0xA7, 0xFC, 0xA7, 0x1E,
+    0xA7, 0x29, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAE, 0xA9, 0x69, 0xFF, 0x5F, 0xAA,
+    0xF3, 0xEA, 0x3A, 0xD9, 0x19, 0xE9, 0x09, 0x99, 0x9E, 0x1A, 0xFF, 0xF1, 0xFF, 0xFC, 0x90, 0xFF,
+    0xFC, 0x90, 0xEA, 0xA9, 0x99, 0x6E, 0xA7, 0x2F, 0x97, 0x1A, 0xFC, 0x99, 0x19, 0xAC, 0x91, 0xFF,
+    0xF9, 0x19, 0xFF, 0xE9, 0x29, 0xFF, 0xD5, 0xAA, 0xFA, 0x91, 0x70, 0x9D, 0x97, 0x70, 0xF7, 0x7F,
+    0xCA, 0x75, 0xFF, 0x73, 0xF0, 0x9F, 0x71, 0xEA, 0x3A, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x9A, 0xFE, 0xAA, 0x7A, 0xFF, 0xFA, 0x5F, 0xFF, 0xDA, 0x4F, 0xFF, 0xF3, 0xAF, 0xDA,
+    0x92, 0x99, 0x9A, 0xA3, 0xFC, 0xA7, 0x59, 0xFC, 0x76, 0xAF, 0x97, 0x6F, 0xC7, 0x7F, 0xC7, 0x7F,
+    0xC5, 0xAA, 0x99, 0x5F, 0xC5, 0xFF, 0xC0, 0xFC, 0x5A, 0xFF, 0x9F, 0xC9, 0x49, 0xFF, 0xAA, 0xFC,
+    0x79, 0xFC, 0xA9, 0xFC, 0xA7, 0xF2, 0xFE, 0xA9, 0x90, 0x99, 0xAF, 0x2A, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0xC4, 0xFF, 0xFF, 0x5A, 0xFF, 0xFC, 0x97, 0x9A, 0xFD, 0xA9, 0x40, 0x77, 0x6A, 0xD7, 0x39,
+    0xEA, 0x71, 0x9F, 0xCA, 0x79, 0xFE, 0xA5, 0x9E, 0x90, 0x9E, 0xA3, 0x9E, 0x4A, 0xDA, 0x77, 0x77,
+    0x77, 0x77, 0x49, 0xF9, 0x0E, 0xA3, 0xAF, 0xDA, 0xEA, 0x2A, 0xFF, 0xEA, 0x2E, 0x90, 0x9F, 0xDA,
+    0x1A, 0xD9, 0x3F, 0xC9, 0x1E, 0x4A, 0xF9, 0x1D, 0xA4, 0x9F, 0x91, 0xDA, 0x5F, 0x91, 0xDA, 0x5F,
+    0x91, 0xE4, 0x9F, 0x91, 0xE9, 0x29, 0xFC, 0x2A, 0xFF, 0xF3, 0xFF, 0xF3, 0xAF, 0xFE, 0x4A, 0xFF,
+    0xD5, 0x9F, 0x9A, 0xE7, 0x3F, 0x72, 0x9E, 0xA3, 0xD9, 0x29, 0xF4, 0xFF, 0xE3, 0x9F, 0xFD, 0x93,
+    0xAF, 0xFC, 0x94, 0x9A, 0xAF, 0xCA, 0x50, 0x77, 0x71, 0x9E, 0x92, 0xAE, 0x71, 0xFF, 0xDA, 0x71,
+    0xFF, 0xD7, 0x3F, 0xF9, 0x74, 0xAF, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xFE,
+    0xAA, 0x7A, 0xFF, 0xFA, 0x5F, 0xFF, 0xDA, 0x4F, 0xFF, 0xF3, 0xAF, 0xDA, 0x92, 0x99, 0x9A, 0xA3,
+    0xFC, 0xA7, 0x59, 0xFC, 0x76, 0xAF, 0x97, 0x6F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC5, 0xAA, 0x99, 0x5F,
+    0xC5, 0xFF, 0xC0, 0xFC, 0x5A, 0xFF, 0x9F, 0xC9, 0x49, 0xFF, 0xAA, 0xFC, 0x79, 0xFC, 0xA9, 0xFC,
+    0xA7, 0xF2, 0xFE, 0xA9, 0x90, 0x99, 0xAF, 0x2A, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF,
+    0x5A, 0xFF, 0xFC, 0x97, 0x9A, 0xFD, 0xA9, 0x40, 0x77, 0x1A, 0xE3, 0xAD, 0x92, 0x9F, 0xAA, 0xF4,
+    0xFF, 0xD4, 0xAF, 0xF7, 0xAE, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x29, 0xF9, 0x0E, 0xA2, 0xAF, 0xDA,
+    0xEA, 0x1A, 0xFF, 0xEA, 0x1E, 0x90, 0x9F, 0xDA, 0x0A, 0xD9, 0x3F, 0xC9, 0x0E, 0x4A, 0xF9, 0x0D,
+    0xA4, 0x9F, 0x90, 0xDA, 0x5F, 0x90, 0xDA, 0x5F, 0x90, 0xE4, 0x9F, 0x90, 0xE9, 0x29, 0xFC, 0x1A,
+    0xFF, 0xF2, 0xFF, 0xF2, 0xAF, 0xFE, 0x3A, 0xFF, 0xD4, 0x9F, 0x9A, 0xE7, 0x2F, 0x71, 0x9E, 0xA2,
+    0xD9, 0x29, 0xF3, 0xFF, 0xE2, 0x9F, 0xFD, 0x92, 0xAF, 0xFC, 0x93, 0x9A, 0xAF, 0xCA, 0x40, 0x70,
+    0xAE, 0x77, 0x0F, 0x97, 0x7F, 0x97, 0x7F, 0xA7, 0x69, 0xFC, 0x76, 0x99, 0x99, 0x99, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xAF, 0xEA, 0xA7, 0xAF, 0xFF, 0xA5, 0xFF, 0xFD, 0xA4, 0xFF,
+    0xFF, 0x3A, 0xFD, 0xA9, 0x29, 0x99, 0xAA, 0x3F, 0xCA, 0x75, 0x9F, 0xC7, 0x6A, 0xF9, 0x76, 0xFC,
+    0x77, 0xFC, 0x77, 0xFC, 0x5A, 0xA9, 0x95, 0xFC, 0x5F, 0xFC, 0x0F, 0xC5, 0xAF, 0xF9, 0xFC, 0x94,
+    0x9F, 0xFA, 0xAF, 0xC7, 0x9F, 0xCA, 0x9F, 0xCA, 0x7F, 0x2F, 0xEA, 0x99, 0x09, 0x9A, 0xF2, 0xAF,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x4F, 0xFF, 0xF5, 0xAF, 0xFF, 0xC9, 0x79, 0xAF, 0xDA, 0x94, 0x69,
+    0x99, 0x97, 0x2F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0xAF, 0x97, 0x0F, 0xCA, 0x77, 0x77, 0x77, 0x77,
+    0x29, 0xF9, 0x0E, 0xA2, 0xAF, 0xDA, 0xEA, 0x1A, 0xFF, 0xEA, 0x1E, 0x90, 0x9F, 0xDA, 0x0A, 0xD9,
+    0x3F, 0xC9, 0x0E, 0x4A, 0xF9, 0x0D, 0xA4, 0x9F, 0x90, 0xDA, 0x5F, 0x90, 0xDA, 0x5F, 0x90, 0xE4,
+    0x9F, 0x90, 0xE9, 0x29, 0xFC, 0x1A, 0xFF, 0xF2, 0xFF, 0xF2, 0xAF, 0xFE, 0x3A, 0xFF, 0xD4, 0x9F,
+    0x9A, 0xE7, 0x2F, 0x71, 0x9E, 0xA2, 0xD9, 0x29, 0xF3, 0xFF, 0xE2, 0x9F, 0xFD, 0x92, 0xAF, 0xFC,
+    0x93, 0x9A, 0xAF, 0xCA, 0x40, 0x77, 0x74, 0xFD, 0x76, 0xFC, 0xA7, 0x6F, 0xC9, 0x76, 0xFC, 0x76,
+    0x9F, 0xA7, 0x6A, 0xF9, 0x76, 0xFC, 0x76, 0x9F, 0xC7, 0x69, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0xAF, 0xEA, 0xA7, 0xAF, 0xFF, 0xA5, 0xFF, 0xFD, 0xA4, 0xFF,
+    0xFF, 0x3A, 0xFD, 0xA9, 0x29, 0x99, 0xAA, 0x3F, 0xCA, 0x75, 0x9F, 0xC7, 0x6A, 0xF9, 0x76, 0xFC,
+    0x77, 0xFC, 0x77, 0xFC, 0x5A, 0xA9, 0x95, 0xFC, 0x5F, 0xFC, 0x0F, 0xC5, 0xAF, 0xF9, 0xFC, 0x94,
+    0x9F, 0xFA, 0xAF, 0xC7, 0x9F, 0xCA, 0x9F, 0xCA, 0x7F, 0x2F, 0xEA, 0x99, 0x09, 0x9A, 0xF2, 0xAF,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x4F, 0xFF, 0xF5, 0xAF, 0xFF, 0xC9, 0x79, 0xAF, 0xDA, 0x94, 0x59,
+    0x99, 0x99, 0x97, 0x0F, 0xD7, 0x0F, 0xCA, 0x70, 0xFC, 0x97, 0x0F, 0xC7, 0x1F, 0xC7, 0x0A, 0xFA,
+    0x70, 0xFC, 0x97, 0x9F, 0xC7, 0x77, 0x76, 0x9F, 0x90, 0xEA, 0x2A, 0xFD, 0xAE, 0xA1, 0xAF, 0xFE,
+    0xA1, 0xE9, 0x09, 0xFD, 0xA0, 0xAD, 0x93, 0xFC, 0x90, 0xE4, 0xAF, 0x90, 0xDA, 0x49, 0xF9, 0x0D,
+    0xA5, 0xF9, 0x0D, 0xA5, 0xF9, 0x0E, 0x49, 0xF9, 0x0E, 0x92, 0x9F, 0xC1, 0xAF, 0xFF, 0x2F, 0xFF,
+    0x2A, 0xFF, 0xE3, 0xAF, 0xFD, 0x49, 0xF9, 0xAE, 0x72, 0xF7, 0x19, 0xEA, 0x2D, 0x92, 0x9F, 0x3F,
+    0xFE, 0x29, 0xFF, 0xD9, 0x2A, 0xFF, 0xC9, 0x39, 0xAA, 0xFC, 0xA4, 0x77, 0x71, 0x9D, 0x97, 0x6F,
+    0x75, 0xFD, 0x73, 0xFF, 0x71, 0xEA, 0x1A, 0xE7, 0xE9, 0x39, 0xE7, 0x77, 0x77, 0x77, 0x49, 0xF7,
+    0xF9, 0x09, 0xF7, 0xF9, 0x09, 0xF7, 0xF9, 0x09, 0xF7, 0xF9, 0x09, 0xF7, 0xFA, 0x0A, 0xF7, 0xFA,
+    0x0A, 0xF7, 0xFA, 0x0A, 0xF7, 0xFA, 0x0A, 0xF7, 0xFA, 0x0A, 0xF9, 0x6F, 0xA0, 0xAF, 0x95, 0x9F,
+    0xC0, 0xAF, 0xA9, 0x99, 0x99, 0x9A, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xFD, 0x0F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x0F, 0xCA, 0x5A, 0xFC, 0x0F, 0xCA, 0x5A, 0xFC, 0x0F,
+    0xCA, 0x5A, 0xFC, 0x0F, 0xCA, 0x5A, 0xFC, 0x00, 0x5D, 0x97, 0x6F, 0x75, 0xAF, 0xC7, 0x3A, 0xFE,
+    0x71, 0xF9, 0x0F, 0x7E, 0xA3, 0xAE, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xE7, 0x6F, 0x76, 0xF7, 0x6E,
+    0xA7, 0x6E, 0xA7, 0x6E, 0xA7, 0x6E, 0xA9, 0xFA, 0x70, 0xFF, 0xE9, 0x59, 0xFF, 0xF5, 0x9F, 0xA9,
+    0x1A, 0xE5, 0x9F, 0x4E, 0x94, 0x9E, 0xA4, 0xAD, 0xA4, 0xAE, 0x94, 0xAD, 0xA4, 0xAE, 0x94, 0xAD,
+    0xA4, 0xAE, 0x94, 0xAD, 0xA4, 0xF9, 0x4F, 0x4F, 0x94, 0xF4, 0xFA, 0x4F, 0x4F, 0xA3, 0x9F, 0x4F,
+    0xC3, 0xAF, 0x4F, 0xC3, 0xAF, 0x00, 0x19, 0xF7, 0xF9, 0x39, 0xF7, 0xF9, 0x39, 0xF7, 0xF9, 0x39,
+    0xF7, 0xF9, 0x39, 0xF7, 0xF9, 0x29, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0xA1, 0xFF, 0xFF, 0xF1,
+    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF2, 0xAF, 0x95, 0x9F, 0xA3, 0xAF, 0x95, 0x9F, 0xC3, 0xAF, 0xA9,
+    0x99, 0x99, 0x9A, 0xFC, 0x3A, 0xFF, 0xFF, 0xC3, 0xAF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF,
+    0xFD, 0x3F, 0xFF, 0xFD, 0x3F, 0xCA, 0x5A, 0xFC, 0x3F, 0xCA, 0x5A, 0xFC, 0x3F, 0xCA, 0x5A, 0xFC,
+    0x3F, 0xCA, 0x5A, 0xFC, 0x10, 0x4A, 0xE7, 0x6F, 0x73, 0x99, 0x9F, 0xD9, 0x69, 0xFF, 0xD9, 0x69,
+    0xFF, 0xAA, 0x74, 0xEA, 0x76, 0xEA, 0x9F, 0xA7, 0x0F, 0xFE, 0x95, 0x9F, 0xFF, 0x59, 0xFA, 0x91,
+    0xAE, 0x59, 0xF4, 0xE9, 0x49, 0xEA, 0x4A, 0xDA, 0x4A, 0xE9, 0x4A, 0xDA, 0x4A, 0xE9, 0x4A, 0xDA,
+    0x4A, 0xE9, 0x4A, 0xDA, 0x4F, 0x94, 0xF4, 0xF9, 0x4F, 0x4F, 0xA4, 0xF4, 0xFA, 0x39, 0xF4, 0xFC,
+    0x3A, 0xF4, 0xFC, 0x3A, 0xF0, 0x29, 0x92, 0x99, 0x2E, 0xA0, 0x9D, 0x1A, 0xFA, 0x9D, 0x1D, 0xAA,
+    0xFC, 0x1D, 0xA0, 0xAE, 0x91, 0x9A, 0x91, 0x9A, 0x97, 0x77, 0x77, 0x77, 0x3F, 0xA5, 0xAE, 0xA5,
+    0xAE, 0xA5, 0xAE, 0xA5, 0xAE, 0xA5, 0x9E, 0xA5, 0x9E, 0xA5, 0x9E, 0xA5, 0x9E, 0xA5, 0x9E, 0xA5,
+    0x9E, 0xA5, 0x9F, 0x59, 0xF5, 0x9F, 0x59, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5F, 0xC9, 0x4F, 0xC9,
+    0x4F, 0xC9, 0x10, 0x09, 0xDA, 0x1D, 0x1F, 0xA0, 0xD9, 0x9D, 0xAD, 0xAD, 0x0A, 0xD0, 0xAF, 0x09,
+    0xD1, 0xAD, 0x97, 0x77, 0x77, 0x3A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5E,
+    0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x91, 0x19, 0x99, 0xAA, 0xAA, 0xEA,
+    0x19, 0xFF, 0xE1, 0xFF, 0xF9, 0x0C, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x1F, 0xA7, 0x0A, 0xEA, 0x70, 0xAE, 0xA7, 0x0A, 0xEA, 0x70, 0xAE, 0xA7, 0x09, 0xEA, 0x70,
+    0x9E, 0xA7, 0x09, 0xEA, 0x70, 0x9E, 0xA7, 0x09, 0xEA, 0x70, 0x9E, 0xA7, 0x09, 0xF7, 0x09, 0xF7,
+    0x09, 0xF7, 0x09, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0F, 0xC9, 0x7F, 0xC9, 0x7F, 0xC9,
+    0x20, 0x72, 0x99, 0x3A, 0xFF, 0xD3, 0xFF, 0xEA, 0x1A, 0xFF, 0xF1, 0x99, 0x99, 0x77, 0x77, 0x77,
+    0x77, 0x73, 0xAD, 0xA7, 0x2A, 0xDA, 0x72, 0xAD, 0xA7, 0x2A, 0xDA, 0x72, 0xAD, 0xA7, 0x2E, 0xA7,
+    0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2F, 0x72, 0xF7, 0x2F, 0x72, 0xF7, 0x2F, 0x93, 0x1F, 0xA2,
+    0xAE, 0xA2, 0xAE, 0xA2, 0xAE, 0xA2, 0xAE, 0xA2, 0x9E, 0xA2, 0x9E, 0xA2, 0x9E, 0xA2, 0x9E, 0xA2,
+    0x9E, 0xA2, 0x9E, 0xA2, 0x9F, 0x29, 0xF2, 0x9F, 0x29, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2F, 0xC9,
+    0x1F, 0xC9, 0x1F, 0xC9, 0x1E, 0x92, 0xAD, 0x93, 0xE4, 0xFC, 0x91, 0xAF, 0xA2, 0x9A, 0xD9, 0x70,
+    0x1F, 0x3F, 0x29, 0xF2, 0xAF, 0x91, 0xAF, 0x91, 0x99, 0x99, 0x99, 0x77, 0x72, 0xAD, 0xA3, 0xAD,
+    0xA3, 0xAD, 0xA3, 0xAD, 0xA3, 0xAD, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xF3, 0xF3, 0xF3,
+    0xF3, 0xF9, 0x2A, 0xE2, 0x9E, 0xA2, 0xEA, 0x29, 0xE3, 0x9F, 0xD1, 0xFD, 0x2A, 0xF5, 0x91, 0x19,
+    0x99, 0x29, 0xEA, 0x1A, 0xF1, 0xFC, 0x1F, 0xC1, 0xFC, 0x77, 0x77, 0x4F, 0xA1, 0xAE, 0xA1, 0xAE,
+    0xA1, 0xAE, 0xA1, 0xAE, 0xA1, 0x9E, 0xA1, 0x9E, 0xA1, 0x9E, 0xA1, 0x9E, 0xA1, 0x9E, 0xA1, 0x9E,
+    0xA1, 0x9F, 0x19, 0xF1, 0x9F, 0x19, 0xF1, 0xAF, 0x1A, 0xF1, 0xAF, 0x1F, 0xC9, 0x0F, 0xC9, 0x0F,
+    0xC9, 0x0A, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA, 0x1E, 0xA1, 0xEA, 0x1E, 0xA1,
+    0xEA, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x90, 0x9F, 0x71, 0xF9, 0x0F, 0x71, 0xF9, 0x0F, 0x70, 0x9F,
+    0x90, 0xF7, 0x09, 0xF1, 0xF7, 0x09, 0xF1, 0xF7, 0x0A, 0xF1, 0xF7, 0x0A, 0xF1, 0xF7, 0x0A, 0xF1,
+    0xF7, 0x0F, 0xA1, 0xF7, 0x0F, 0xA1, 0xF7, 0x0F, 0xA1, 0xF9, 0x7F, 0x91, 0xF9, 0x7F, 0x91, 0xF9,
+    0x7F, 0x91, 0xF9, 0x69, 0xF2, 0xFA, 0x69, 0xF2, 0xFA, 0x69, 0xF2, 0xFA, 0x6A, 0xF1, 0x9F, 0xC6,
+    0xAF, 0x19, 0xFC, 0x6A, 0xEA, 0x19, 0xFC, 0x6F, 0xA7, 0x6F, 0xA7, 0x59, 0xF9, 0x7C, 0xA9, 0x2F,
+    0xC9, 0x69, 0xFF, 0xE7, 0x9F, 0xFE, 0x7A, 0xFF, 0xD9, 0x7F, 0xFE, 0x70, 0xFF, 0xD7, 0x29, 0xAA,
+    0xEA, 0x97, 0x77, 0x10, 0x77, 0xF4, 0x9E, 0x1F, 0x49, 0xE0, 0x9F, 0x4A, 0xE0, 0xAF, 0x93, 0xF0,
+    0xAF, 0x97, 0x09, 0x99, 0x99, 0x97, 0x77, 0x77, 0x70, 0xAE, 0x1A, 0xDA, 0x4A, 0xE1, 0xAD, 0xA4,
+    0xAE, 0x1A, 0xDA, 0x4A, 0xDA, 0x1A, 0xDA, 0x4A, 0xDA, 0x1E, 0xA4, 0xAD, 0xA1, 0xEA, 0x4A, 0xDA,
+    0x1E, 0xA4, 0xE9, 0x1E, 0xA4, 0xE9, 0x1E, 0xA4, 0xE9, 0x1F, 0x4E, 0x91, 0xF4, 0xE2, 0xF4, 0xE2,
+    0xF4, 0xE2, 0xF9, 0x29, 0xE7, 0x2F, 0x79, 0xFD, 0x79, 0xFC, 0xA7, 0xAF, 0xC9, 0x7F, 0xCA, 0x77,
+    0x10, 0x77, 0x70, 0xE7, 0x4A, 0xEA, 0x72, 0x9F, 0xCA, 0x70, 0xAF, 0xEA, 0x6A, 0xE9, 0x09, 0xEA,
+    0x4A, 0xDA, 0x4A, 0xDA, 0x77, 0x77, 0x77, 0x75, 0xFA, 0x73, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF7,
+    0x39, 0xF7, 0x3A, 0xF7, 0x3A, 0xF7, 0x3A, 0xF7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0x97, 0x3F, 0x97,
+    0x3F, 0x97, 0x29, 0xF7, 0x39, 0xF7, 0x3A, 0xF7, 0x3A, 0xF7, 0x3A, 0xEA, 0x73, 0xFA, 0x73, 0xFA,
+    0x4D, 0xA9, 0x09, 0xFC, 0x93, 0x9F, 0xFE, 0x49, 0xFF, 0xE4, 0xAF, 0xFD, 0x5F, 0xFD, 0x95, 0x9A,
+    0xAF, 0xCA, 0x77, 0x70, 0x77, 0x2A, 0xD9, 0x70, 0x9F, 0x79, 0xFD, 0x59, 0xFF, 0x39, 0xEA, 0x1F,
+    0x19, 0xE9, 0x3A, 0xE7, 0x77, 0x77, 0x77, 0x5A, 0xDA, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xEA, 0x71,
+    0xE9, 0x71, 0xE9, 0x71, 0xE9, 0x71, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x71, 0x9E,
+    0x71, 0xAE, 0x71, 0xEA, 0x6A, 0xFC, 0xA6, 0xAF, 0xC9, 0x6F, 0xD7, 0xFC, 0x97, 0x74, 0x77, 0x7A,
+    0xFC, 0x97, 0x3A, 0xFC, 0x74, 0xAF, 0xA7, 0x4A, 0xF9, 0x74, 0xFC, 0x74, 0x9F, 0xC7, 0x4A, 0xFA,
+    0x74, 0xFC, 0x97, 0x49, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xE9, 0x2F, 0xC5, 0xF9, 0x1A,
+    0xFA, 0x5F, 0x2F, 0xC6, 0xF1, 0xAF, 0x96, 0xF0, 0x9F, 0xA6, 0x9F, 0x0F, 0xC7, 0x9E, 0xA9, 0xFA,
+    0x79, 0xEA, 0xFC, 0x70, 0xAF, 0xF9, 0x70, 0xAF, 0xEA, 0x71, 0xFF, 0x72, 0xFE, 0x97, 0x2F, 0xEA,
+    0x72, 0xFF, 0xA7, 0x09, 0xFF, 0xD7, 0x9F, 0xFE, 0x69, 0xF0, 0xFE, 0x5A, 0xF0, 0x9F, 0xE9, 0x3A,
+    0xF1, 0x9F, 0xE9, 0x2F, 0xC2, 0xAF, 0xEA, 0x1F, 0xC3, 0xAF, 0xEA, 0x00, 0x1F, 0x73, 0xEA, 0x73,
+    0xEA, 0x73, 0xEA, 0x73, 0xE9, 0x73, 0xE9, 0x73, 0xE9, 0x72, 0x9E, 0x73, 0x9E, 0x1F, 0x94, 0x9E,
+    0x0F, 0x95, 0x9E, 0xAE, 0xA6, 0xAF, 0xE7, 0xAF, 0xD7, 0x0A, 0xFC, 0x97, 0x0A, 0xFD, 0x97, 0xFF,
+    0x96, 0xFF, 0xCA, 0x5F, 0x9F, 0xCA, 0x4F, 0x0A, 0xFD, 0x3F, 0x1A, 0xFD, 0x2F, 0x2F, 0xE7, 0x77,
+    0x77, 0x77, 0x73, 0x9F, 0xCA, 0x70, 0x9F, 0xC9, 0x71, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x1F,
+    0xC9, 0x71, 0xFC, 0x71, 0xAF, 0xA7, 0x1A, 0xAA, 0xAA, 0x97, 0x75, 0xD9, 0x09, 0xDA, 0x3D, 0x90,
+    0xE3, 0x9D, 0x0A, 0xDA, 0x39, 0xD9, 0xE4, 0xAF, 0xC9, 0x4A, 0xFA, 0x5F, 0xC6, 0xFC, 0x6F, 0xCA,
+    0x5F, 0xE4, 0xDA, 0x9F, 0x29, 0xDA, 0x0A, 0xF1, 0x9D, 0xA1, 0xFC, 0x90, 0x2D, 0xA7, 0x2A, 0xD9,
+    0x72, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x77, 0x77, 0x70, 0xF9, 0x71, 0xF9, 0x71, 0xF7, 0x2F, 0x72,
+    0xF7, 0x2F, 0x72, 0xF7, 0x2F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71,
+    0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0xAF, 0xF9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9, 0xFF, 0xFD,
+    0x9F, 0xFF, 0xD9, 0x74, 0xDA, 0x4A, 0xD9, 0x4E, 0x49, 0xDA, 0x4E, 0x97, 0x77, 0x77, 0x71, 0xE9,
+    0x4E, 0x93, 0x9E, 0x49, 0xE4, 0x9E, 0x4A, 0xE4, 0xAE, 0x4A, 0xE4, 0xAE, 0x4F, 0x4E, 0xA4, 0xEA,
+    0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA, 0x99, 0x2F, 0xDA, 0x1F, 0xE1, 0xFE, 0x00,
+    0x1F, 0xCA, 0x72, 0xFC, 0xA7, 0x2F, 0xC9, 0x72, 0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xFC,
+    0x72, 0x9F, 0xC7, 0x2A, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x70, 0xF9, 0x73, 0xF9, 0x73, 0xF7,
+    0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x73, 0x9F, 0x73, 0x9F, 0x73, 0x9F, 0x73, 0x9F, 0x73,
+    0x9F, 0x73, 0xAF, 0x73, 0xAF, 0x73, 0xAF, 0x73, 0xAF, 0xAF, 0xF9, 0x1F, 0xFF, 0xD9, 0x1F, 0xFF,
+    0xD9, 0x1F, 0xFF, 0xD9, 0x1F, 0xFF, 0xD9, 0x2E, 0x95, 0xE9, 0x49, 0xE5, 0x9E, 0x59, 0xE5, 0xAE,
+    0x5A, 0xE5, 0xAE, 0x5A, 0xE5, 0xF5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA,
+    0x5E, 0xA9, 0x93, 0xFD, 0xA2, 0xFE, 0x2F, 0xE7, 0x77, 0x77, 0x74, 0xAA, 0xAA, 0xA9, 0x3F, 0xCA,
+    0x3F, 0xC9, 0x3F, 0xC4, 0xFA, 0x3A, 0xF9, 0x3F, 0xC3, 0x9F, 0xC3, 0xAF, 0xA3, 0x0F, 0x97, 0x1F,
+    0x97, 0x1F, 0x72, 0xF7, 0x2F, 0x39, 0xE2, 0xF3, 0x9E, 0x2F, 0x3A, 0xE2, 0xF3, 0xAE, 0x19, 0xF3,
+    0xF1, 0x9F, 0x3E, 0xA1, 0x9F, 0x3A, 0xAA, 0x91, 0x9F, 0x71, 0x9F, 0x71, 0xAF, 0x71, 0xAF, 0x71,
+    0xAF, 0x71, 0xAF, 0xAF, 0xF9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9, 0x7A,
+    0xDA, 0x7A, 0xDA, 0x7E, 0xA7, 0xEA, 0x1E, 0x91, 0xEA, 0x1E, 0x91, 0xE9, 0x09, 0xE1, 0x9E, 0x90,
+    0x9E, 0x79, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xF7, 0xEA, 0x7E, 0xA7, 0xEA, 0x7E, 0xA7,
+    0xEA, 0x7E, 0xA7, 0xEA, 0x7E, 0xA9, 0x95, 0xFD, 0xA4, 0xFE, 0x4F, 0xE3, 0x0F, 0x97, 0x1F, 0x97,
+    0x1F, 0x72, 0xF3, 0xAE, 0x91, 0xF3, 0xF9, 0x1F, 0x3F, 0xA1, 0xF3, 0xFA, 0x1F, 0x29, 0xFC, 0x09,
+    0xF3, 0x99, 0x99, 0x90, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0xAF, 0x71, 0xAF, 0x71,
+    0xAF, 0x71, 0xAF, 0xAF, 0xF9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9, 0x1E,
+    0x97, 0xE9, 0x69, 0xE7, 0x9E, 0x79, 0xE1, 0x99, 0x99, 0x1A, 0xE1, 0xF1, 0xAE, 0x1F, 0x90, 0xAE,
+    0x1F, 0x90, 0xAE, 0x09, 0xFA, 0x0F, 0x0A, 0xFA, 0x0E, 0xA7, 0xEA, 0x7E, 0xA7, 0xEA, 0x7E, 0xA7,
+    0xEA, 0x7E, 0xA7, 0xEA, 0x99, 0x5F, 0xDA, 0x4F, 0xE4, 0xFE, 0x30, 0x77, 0x79, 0xA9, 0x77, 0x5F,
+    0x77, 0x59, 0xE9, 0x77, 0x5E, 0xA7, 0x75, 0xAE, 0x77, 0x59, 0xEA, 0x77, 0x5F, 0x77, 0x5A, 0xE9,
+    0x77, 0xF9, 0x0F, 0x77, 0x0F, 0x9F, 0x77, 0x1F, 0xAE, 0xA7, 0x71, 0xFF, 0x77, 0x2F, 0xE9, 0x77,
+    0x2F, 0xE7, 0x73, 0xFD, 0x77, 0x4F, 0xCA, 0x77, 0x39, 0xFC, 0x77, 0x49, 0xF9, 0x77, 0x49, 0xF7,
+    0x75, 0xFC, 0x77, 0x4A, 0xFC, 0x77, 0x39, 0xFD, 0x77, 0x3F, 0xE7, 0x72, 0x9F, 0xE7, 0x72, 0xFF,
+    0xAF, 0xF9, 0x7A, 0xFF, 0xFF, 0xC9, 0x69, 0xFF, 0xFF, 0xD9, 0x6F, 0xAF, 0xFF, 0xD9, 0x5A, 0xF0,
+    0xFF, 0xFD, 0x95, 0xF9, 0x77, 0x4F, 0xC7, 0x74, 0x9F, 0x77, 0x5F, 0xA7, 0x74, 0xAF, 0x77, 0x49,
+    0xF9, 0x77, 0x4D, 0xA9, 0x77, 0x59, 0x97, 0x77, 0x00, 0x71, 0xE9, 0x76, 0xE9, 0x75, 0x9E, 0x76,
+    0x9E, 0x76, 0x9E, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xF9, 0xDA, 0x97, 0x1F,
+    0xEA, 0x72, 0xFC, 0xA7, 0x29, 0xFC, 0x72, 0xAF, 0xDA, 0x70, 0xAF, 0xFA, 0x6A, 0xFC, 0x90, 0xEA,
+    0x79, 0xAA, 0x92, 0xEA, 0x76, 0xEA, 0x99, 0x74, 0xFD, 0xA7, 0x3F, 0xE7, 0x3F, 0xE2, 0x70, 0x9D,
+    0x97, 0x5E, 0x75, 0x9D, 0xA7, 0x5E, 0x97, 0x49, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4F, 0x09,
+    0xF9, 0x6F, 0x09, 0xFC, 0x59, 0xEA, 0x09, 0xFC, 0x94, 0x9E, 0xA0, 0xAF, 0xD4, 0x9E, 0xA0, 0xAF,
+    0xD9, 0x3A, 0xEA, 0x0A, 0xFE, 0x3A, 0xE9, 0x0F, 0xF9, 0x2A, 0xE9, 0x0F, 0xFC, 0x2F, 0x90, 0xFF,
+    0xC9, 0x1F, 0x90, 0xFC, 0x9F, 0x1F, 0x90, 0xFC, 0x0F, 0x90, 0xF1, 0xFC, 0x0A, 0xEA, 0x0F, 0x09,
+    0xFC, 0x1F, 0x9F, 0x09, 0xFC, 0x1A, 0xFF, 0x09, 0xFC, 0x19, 0xFF, 0x0A, 0xFC, 0x2F, 0xF0, 0xAF,
+    0xC2, 0x9F, 0xE0, 0xAF, 0xC3, 0xFE, 0x0F, 0xD3, 0xAF, 0xD0, 0xFD, 0x4F, 0xCA, 0x00, 0x79, 0xD9,
+    0x72, 0xE7, 0x29, 0xDA, 0x72, 0xE9, 0x71, 0x9E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1E, 0x0A, 0xEA,
+    0x94, 0xFF, 0xDA, 0x29, 0xFF, 0xE9, 0x19, 0xFA, 0x90, 0x9F, 0x19, 0xEA, 0x39, 0xE1, 0x9E, 0x5E,
+    0x1A, 0xE5, 0xE9, 0x0A, 0xE5, 0xE9, 0x0A, 0xE4, 0x9E, 0xA0, 0xF9, 0x39, 0xEA, 0x0F, 0x93, 0xAE,
+    0xA0, 0xF9, 0x3A, 0xEA, 0x0F, 0xA3, 0xAF, 0x0F, 0xA3, 0xFC, 0x0F, 0xA3, 0xFC, 0x75, 0xF0, 0x9F,
+    0x96, 0xF0, 0x9F, 0xC5, 0x9E, 0xA0, 0x9F, 0xC9, 0x49, 0xEA, 0x0A, 0xFD, 0x49, 0xEA, 0x0A, 0xFD,
+    0x93, 0xAE, 0xA0, 0xAF, 0xE3, 0xAE, 0x90, 0xFF, 0x92, 0xAE, 0x90, 0xFF, 0xC2, 0xF9, 0x0F, 0xFC,
+    0x91, 0xF9, 0x0F, 0xC9, 0xF1, 0xF9, 0x0F, 0xC0, 0xF9, 0x0F, 0x1F, 0xC0, 0xAE, 0xA0, 0xF0, 0x9F,
+    0xC1, 0xF9, 0xF0, 0x9F, 0xC1, 0xAF, 0xF0, 0x9F, 0xC1, 0x9F, 0xF0, 0xAF, 0xC2, 0xFF, 0x0A, 0xFC,
+    0x29, 0xFE, 0x0A, 0xFC, 0x3F, 0xE0, 0xFD, 0x3A, 0xFD, 0x0F, 0xD4, 0xFC, 0xA7, 0x77, 0x0A, 0xFC,
+    0x73, 0xFD, 0x73, 0xAF, 0xA7, 0x3A, 0xF9, 0x73, 0xFC, 0x73, 0x9F, 0xC7, 0x3A, 0xF9, 0x73, 0xFC,
+    0x74, 0xAA, 0xAA, 0xA7, 0x77, 0x0E, 0x0A, 0xEA, 0x94, 0xFF, 0xDA, 0x29, 0xFF, 0xE9, 0x19, 0xFA,
+    0x90, 0x9F, 0x19, 0xEA, 0x39, 0xE1, 0x9E, 0x5E, 0x1A, 0xE5, 0xE9, 0x0A, 0xE5, 0xE9, 0x0A, 0xE4,
+    0x9E, 0xA0, 0xF9, 0x39, 0xEA, 0x0F, 0x93, 0xAE, 0xA0, 0xF9, 0x3A, 0xEA, 0x0F, 0xA3, 0xAF, 0x0F,
+    0xA3, 0xFC, 0x0F, 0xA3, 0xFC, 0x77, 0x3F, 0xD7, 0x0A, 0xFC, 0x70, 0xAF, 0xA7, 0x0A, 0xF9, 0x70,
+    0xFC, 0x70, 0x9F, 0xC7, 0x0A, 0xF9, 0x70, 0xFC, 0x71, 0xAA, 0xAA, 0xA5, 0x39, 0x99, 0x59, 0x99,
+    0x5A, 0xE2, 0x9E, 0x96, 0xAE, 0x9A, 0xE9, 0x70, 0xAF, 0xD9, 0x72, 0xAF, 0x97, 0x4E, 0xA7, 0x6A,
+    0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4F, 0x09, 0xF9, 0x6F, 0x09, 0xFC, 0x59, 0xEA, 0x09, 0xFC,
+    0x94, 0x9E, 0xA0, 0xAF, 0xD4, 0x9E, 0xA0, 0xAF, 0xD9, 0x3A, 0xEA, 0x0A, 0xFE, 0x3A, 0xE9, 0x0F,
+    0xF9, 0x2A, 0xE9, 0x0F, 0xFC, 0x2F, 0x90, 0xFF, 0xC9, 0x1F, 0x90, 0xFC, 0x9F, 0x1F, 0x90, 0xFC,
+    0x0F, 0x90, 0xF1, 0xFC, 0x0A, 0xEA, 0x0F, 0x09, 0xFC, 0x1F, 0x9F, 0x09, 0xFC, 0x1A, 0xFF, 0x09,
+    0xFC, 0x19, 0xFF, 0x0A, 0xFC, 0x2F, 0xF0, 0xAF, 0xC2, 0x9F, 0xE0, 0xAF, 0xC3, 0xFE, 0x0F, 0xD3,
+    0xAF, 0xD0, 0xFD, 0x4F, 0xCA, 0x00, 0x19, 0xAA, 0xA5, 0xAA, 0xA3, 0xAE, 0x91, 0xAE, 0x94, 0xAE,
+    0xAF, 0x7A, 0xFD, 0x71, 0xAF, 0x73, 0xE9, 0x74, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7E, 0x0A,
+    0xEA, 0x95, 0xFF, 0xDA, 0x39, 0xFF, 0xE9, 0x29, 0xFA, 0x90, 0x9F, 0x29, 0xEA, 0x39, 0xE2, 0x9E,
+    0x5E, 0x2A, 0xE5, 0xE9, 0x1A, 0xE5, 0xE9, 0x1A, 0xE4, 0x9E, 0xA1, 0xF9, 0x39, 0xEA, 0x1F, 0x93,
+    0xAE, 0xA1, 0xF9, 0x3A, 0xEA, 0x1F, 0xA3, 0xAF, 0x1F, 0xA3, 0xFC, 0x1F, 0xA3, 0xFC, 0x00, 0x70,
+    0xAA, 0xA9, 0x71, 0xF7, 0x1F, 0x71, 0xF9, 0x70, 0xFA, 0x70, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x2E, 0x0A, 0xEA, 0x94, 0xFF, 0xDA, 0x29, 0xFF, 0xE9, 0x19, 0xFA, 0x90, 0x9F, 0x19, 0xEA, 0x39,
+    0xE1, 0x9E, 0x5E, 0x1A, 0xE5, 0xE9, 0x0A, 0xE5, 0xE9, 0x0A, 0xE4, 0x9E, 0xA0, 0xF9, 0x39, 0xEA,
+    0x0F, 0x93, 0xAE, 0xA0, 0xF9, 0x3A, 0xEA, 0x0F, 0xA3, 0xAF, 0x0F, 0xA3, 0xFC, 0x0F, 0xA3, 0xFC,
+    0x75, 0xF0, 0x9F, 0x96, 0xF0, 0x9F, 0xC5, 0x9E, 0xA0, 0x9F, 0xC9, 0x49, 0xEA, 0x0A, 0xFD, 0x49,
+    0xEA, 0x0A, 0xFD, 0x93, 0xAE, 0xA0, 0xAF, 0xE3, 0xAE, 0x90, 0xFF, 0x92, 0xAE, 0x90, 0xFF, 0xC2,
+    0xF9, 0x0F, 0xFC, 0x91, 0xF9, 0x0F, 0xC9, 0xF1, 0xF9, 0x0F, 0xC0, 0xF9, 0x0F, 0x1F, 0xC0, 0xAE,
+    0xA0, 0xF0, 0x9F, 0xC1, 0xF9, 0xF0, 0x9F, 0xC1, 0xAF, 0xF0, 0x9F, 0xC1, 0x9F, 0xF0, 0xAF, 0xC2,
+    0xFF, 0x0A, 0xFC, 0x29, 0xFE, 0x0A, 0xFC, 0x3F, 0xE0, 0xFD, 0x3A, 0xFD, 0x0F, 0xD4, 0xFC, 0xA7,
+    0x3F, 0xCA, 0x70, 0x99, 0x9F, 0xCA, 0x70, 0xFF, 0x97, 0xAF, 0xF7, 0x0A, 0xFC, 0xA9, 0x77, 0x40,
+    0x77, 0x0E, 0x0A, 0xEA, 0x94, 0xFF, 0xDA, 0x29, 0xFF, 0xE9, 0x19, 0xFA, 0x90, 0x9F, 0x19, 0xEA,
+    0x39, 0xE1, 0x9E, 0x5E, 0x1A, 0xE5, 0xE9, 0x0A, 0xE5, 0xE9, 0x0A, 0xE4, 0x9E, 0xA0, 0xF9, 0x39,
+    0xEA, 0x0F, 0x93, 0xAE, 0xA0, 0xF9, 0x3A, 0xEA, 0x0F, 0xA3, 0xAF, 0x0F, 0xA3, 0xFC, 0x0F, 0xA3,
+    0xFC, 0x71, 0xFC, 0x79, 0x9F, 0xA6, 0xAF, 0xDA, 0x6F, 0xE7, 0x99, 0x99, 0x30, 0x49, 0x99, 0xAA,
+    0xAA, 0xE9, 0x70, 0xAF, 0xFD, 0xA7, 0x0F, 0xFF, 0x79, 0xCA, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xFA, 0x97, 0x29, 0xFF, 0xDA, 0x79, 0xFF, 0xFC, 0x59, 0xFD,
+    0xA9, 0xAF, 0xD4, 0xFC, 0x94, 0xAF, 0xA2, 0xAF, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF7, 0x1F,
+    0xC0, 0xAF, 0x71, 0x9F, 0x0F, 0xA7, 0x19, 0xF0, 0xFA, 0x72, 0xF0, 0xF9, 0x72, 0xF9, 0xFA, 0x72,
+    0xF9, 0xFA, 0x71, 0x9F, 0x0F, 0xC7, 0x1A, 0xF0, 0xAF, 0xA7, 0x9F, 0xC0, 0xAF, 0xDA, 0x99, 0x09,
+    0x9F, 0xE0, 0x9F, 0xFF, 0xFD, 0xA1, 0xFF, 0xFF, 0xD9, 0x19, 0xFF, 0xFF, 0xC3, 0xAF, 0xFF, 0xE5,
+    0x9F, 0xFF, 0xC7, 0x09, 0xAF, 0xEA, 0x97, 0x77, 0x10, 0x77, 0x09, 0x99, 0xAA, 0xAA, 0xF3, 0xFF,
+    0xE9, 0x1A, 0xFF, 0xEA, 0x1A, 0xAA, 0xAA, 0xAA, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x1A,
+    0xF9, 0x6A, 0xFF, 0x4A, 0xFF, 0xD3, 0xF9, 0x1A, 0xEA, 0x1A, 0xE9, 0x3F, 0x1F, 0x49, 0xE9, 0x0E,
+    0xA5, 0xEA, 0x0E, 0xA5, 0xEA, 0x0E, 0xA5, 0xEA, 0x0F, 0x49, 0xE9, 0x0F, 0xA2, 0x9F, 0x90, 0xAF,
+    0xFF, 0x2F, 0xFE, 0xA2, 0xAF, 0xFD, 0x4A, 0xFF, 0x69, 0xAF, 0x93, 0x77, 0x70, 0x9E, 0x92, 0xAD,
+    0xA7, 0x1F, 0xFD, 0x97, 0x1F, 0xFD, 0x72, 0x9F, 0xF9, 0x74, 0xAE, 0xAA, 0x77, 0x77, 0x77, 0x77,
+    0x74, 0x9A, 0xFA, 0x97, 0x29, 0xFF, 0xDA, 0x79, 0xFF, 0xFC, 0x59, 0xFD, 0xA9, 0xAF, 0xD4, 0xFC,
+    0x94, 0xAF, 0xA2, 0xAF, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF7, 0x1F, 0xC0, 0xAF, 0x71, 0x9F,
+    0x0F, 0xA7, 0x19, 0xF0, 0xFA, 0x72, 0xF0, 0xF9, 0x72, 0xF9, 0xFA, 0x72, 0xF9, 0xFA, 0x71, 0x9F,
+    0x0F, 0xC7, 0x1A, 0xF0, 0xAF, 0xA7, 0x9F, 0xC0, 0xAF, 0xDA, 0x99, 0x09, 0x9F, 0xE0, 0x9F, 0xFF,
+    0xFD, 0xA1, 0xFF, 0xFF, 0xD9, 0x19, 0xFF, 0xFF, 0xC3, 0xAF, 0xFF, 0xE5, 0x9F, 0xFF, 0xC7, 0x09,
+    0xAF, 0xEA, 0x97, 0x77, 0x10, 0x77, 0x0E, 0xA3, 0xE9, 0x2A, 0xFF, 0xD3, 0x9F, 0xFC, 0xA4, 0xAF,
+    0xF6, 0x9A, 0xEA, 0x97, 0x77, 0x77, 0x75, 0xAF, 0x96, 0xAF, 0xF4, 0xAF, 0xFD, 0x3F, 0x91, 0xAE,
+    0xA1, 0xAE, 0x93, 0xF1, 0xF4, 0x9E, 0x90, 0xEA, 0x5E, 0xA0, 0xEA, 0x5E, 0xA0, 0xEA, 0x5E, 0xA0,
+    0xF4, 0x9E, 0x90, 0xFA, 0x29, 0xF9, 0x0A, 0xFF, 0xF2, 0xFF, 0xEA, 0x2A, 0xFF, 0xD4, 0xAF, 0xF6,
+    0x9A, 0xF9, 0x30, 0x69, 0x99, 0x96, 0x99, 0x99, 0x6F, 0x6A, 0xE9, 0x49, 0xF6, 0xF9, 0x4A, 0xF5,
+    0x9F, 0x94, 0xFC, 0x5A, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x79, 0xAF, 0xA9, 0x74, 0x9F, 0xFD, 0xA7,
+    0x19, 0xFF, 0xFC, 0x79, 0xFD, 0xA9, 0xAF, 0xD6, 0xFC, 0x94, 0xAF, 0xA4, 0xAF, 0x7F, 0xC4, 0xFA,
+    0x79, 0xF9, 0x29, 0xF7, 0x1F, 0xC2, 0xAF, 0x71, 0x9F, 0x2F, 0xA7, 0x19, 0xF2, 0xFA, 0x72, 0xF2,
+    0xF9, 0x72, 0xF9, 0x1F, 0xA7, 0x2F, 0x91, 0xFA, 0x71, 0x9F, 0x2F, 0xC7, 0x1A, 0xF2, 0xAF, 0xA7,
+    0x9F, 0xC2, 0xAF, 0xDA, 0x99, 0x09, 0x9F, 0xE2, 0x9F, 0xFF, 0xFD, 0xA3, 0xFF, 0xFF, 0xD9, 0x39,
+    0xFF, 0xFF, 0xC5, 0xAF, 0xFF, 0xE7, 0x9F, 0xFF, 0xC7, 0x29, 0xAF, 0xEA, 0x97, 0x77, 0x50, 0x69,
+    0x99, 0x79, 0x99, 0x59, 0xEA, 0x59, 0xF4, 0xAE, 0xA5, 0xAF, 0x4F, 0xA5, 0xFA, 0x39, 0xFA, 0x49,
+    0xFA, 0x77, 0x77, 0x77, 0x77, 0x74, 0xAF, 0x97, 0x5A, 0xFF, 0x73, 0xAF, 0xFD, 0x72, 0xF9, 0x1A,
+    0xEA, 0x70, 0xAE, 0x93, 0xF7, 0x0F, 0x49, 0xE9, 0x7E, 0xA5, 0xEA, 0x7E, 0xA5, 0xEA, 0x7E, 0xA5,
+    0xEA, 0x7F, 0x49, 0xE9, 0x7F, 0xA2, 0x9F, 0x97, 0xAF, 0xFF, 0x71, 0xFF, 0xEA, 0x71, 0xAF, 0xFD,
+    0x73, 0xAF, 0xF7, 0x59, 0xAF, 0x97, 0x00, 0x59, 0xAF, 0xC9, 0x09, 0x99, 0x99, 0x99, 0xAA, 0xAA,
+    0xAA, 0x93, 0x9F, 0xFF, 0xFF, 0xE3, 0x9F, 0xFF, 0xFF, 0xF2, 0x9F, 0xDA, 0x9A, 0xFF, 0xFE, 0xA2,
+    0xFC, 0x94, 0xFD, 0x72, 0xAF, 0x7F, 0xC7, 0x2F, 0xA7, 0x9F, 0x97, 0x09, 0xF7, 0x09, 0xFC, 0x70,
+    0xAF, 0x70, 0x9F, 0xC7, 0x0F, 0xA7, 0x0A, 0xFC, 0xAA, 0xE9, 0x2F, 0xA7, 0x0A, 0xFF, 0xD9, 0x2F,
+    0x97, 0x0A, 0xFF, 0xD9, 0x2F, 0xA7, 0x0A, 0xFF, 0xD9, 0x2F, 0xA7, 0x0A, 0xFC, 0x97, 0xFC, 0x70,
+    0xAF, 0xC7, 0x0A, 0xFC, 0x7A, 0xFC, 0x70, 0xAF, 0xEA, 0xA9, 0xAA, 0xFE, 0x70, 0x9F, 0xFF, 0xFE,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x1F, 0xFF, 0xFF, 0xFE, 0x19, 0xFF, 0xFF, 0xFF, 0xD2, 0xAF, 0xFF, 0xFF,
+    0xFC, 0x92, 0x9F, 0xFF, 0xFF, 0xFA, 0x49, 0xAF, 0xFF, 0xFF, 0xD7, 0x77, 0x40, 0x4A, 0xFA, 0x39,
+    0xAE, 0xA7, 0x9F, 0xF9, 0x0A, 0xFE, 0x94, 0xAF, 0xFF, 0xDA, 0xAA, 0xE4, 0xF9, 0x1A, 0xFD, 0x39,
+    0xDA, 0x2A, 0xE9, 0x3F, 0xCA, 0x09, 0x99, 0x9E, 0x2F, 0x49, 0xFF, 0xFC, 0xA1, 0xEA, 0x5F, 0xFF,
+    0xD1, 0xEA, 0x5F, 0xFF, 0xD1, 0xEA, 0x5F, 0xA9, 0x99, 0x96, 0xF4, 0x9F, 0x73, 0xFA, 0x29, 0xFC,
+    0xA7, 0x91, 0xAF, 0xFF, 0xEA, 0x92, 0xAC, 0xA2, 0xFF, 0xFF, 0xFD, 0xA2, 0xAF, 0xFF, 0xFF, 0xCA,
+    0x3A, 0xFF, 0x09, 0xFF, 0xDA, 0x5A, 0xF9, 0x39, 0xAF, 0xA9, 0x20, 0x77, 0x69, 0xD9, 0x74, 0xE7,
+    0x49, 0xDA, 0x74, 0xE9, 0x73, 0x9E, 0x77, 0x77, 0x73, 0xAF, 0xEA, 0x96, 0xAF, 0xFD, 0x5F, 0xFF,
+    0x4E, 0xA3, 0x9E, 0x93, 0xEA, 0x4A, 0xDA, 0x3E, 0xA4, 0xAE, 0x3E, 0xA4, 0xAE, 0x3E, 0xA4, 0xF3,
+    0xEA, 0x3A, 0xEA, 0x3F, 0xFF, 0x92, 0x9F, 0xFE, 0xA3, 0x9F, 0xFE, 0x49, 0xFF, 0xF3, 0x9F, 0xC9,
+    0x09, 0xF9, 0x2A, 0xF9, 0x29, 0xF2, 0xAF, 0xA2, 0x9F, 0x91, 0xAF, 0xA2, 0x9F, 0xA1, 0xAF, 0xA2,
+    0x9F, 0xC1, 0xFC, 0xA2, 0x9F, 0xC9, 0x0F, 0xD2, 0x9F, 0xCA, 0x0F, 0xD2, 0x9F, 0xD7, 0x71, 0x77,
+    0x0D, 0xA7, 0xAD, 0x70, 0xE7, 0xAD, 0xA7, 0xE9, 0x77, 0x2F, 0x9A, 0xDA, 0x2F, 0xFC, 0x2F, 0xFC,
+    0x2F, 0xDA, 0xAA, 0x2F, 0x96, 0xF7, 0xF7, 0xF7, 0xF6, 0x9F, 0x69, 0xF6, 0xAF, 0x6A, 0xF9, 0x5F,
+    0xC9, 0x5F, 0xCA, 0x40, 0x77, 0x39, 0xFC, 0x97, 0x19, 0xFC, 0x72, 0x9F, 0xC7, 0x29, 0xFA, 0x72,
+    0xAF, 0x97, 0x2F, 0xC7, 0x29, 0xFA, 0x72, 0xFC, 0x97, 0x29, 0x99, 0x99, 0x77, 0x77, 0x77, 0x75,
+    0xAF, 0xEA, 0x96, 0xAF, 0xFD, 0x5F, 0xFF, 0x4E, 0xA3, 0x9E, 0x93, 0xEA, 0x4A, 0xDA, 0x3E, 0xA4,
+    0xAE, 0x3E, 0xA4, 0xAE, 0x3E, 0xA4, 0xF3, 0xEA, 0x3A, 0xEA, 0x3F, 0xFF, 0x92, 0x9F, 0xFE, 0xA3,
+    0x9F, 0xFE, 0x49, 0xFF, 0xF3, 0x9F, 0xC9, 0x09, 0xF9, 0x2A, 0xF9, 0x29, 0xF2, 0xAF, 0xA2, 0x9F,
+    0x91, 0xAF, 0xA2, 0x9F, 0xA1, 0xAF, 0xA2, 0x9F, 0xC1, 0xFC, 0xA2, 0x9F, 0xC9, 0x0F, 0xD2, 0x9F,
+    0xCA, 0x0F, 0xD2, 0x9F, 0xD7, 0x71, 0x75, 0xFC, 0xA5, 0xFC, 0x95, 0xFC, 0x6F, 0xC5, 0x9F, 0xA5,
+    0xFC, 0x95, 0xFC, 0x5A, 0xFA, 0x59, 0x99, 0x99, 0x77, 0x77, 0x0F, 0x9A, 0xDA, 0x2F, 0xFC, 0x2F,
+    0xFC, 0x2F, 0xDA, 0xAA, 0x2F, 0x96, 0xF7, 0xF7, 0xF7, 0xF6, 0x9F, 0x69, 0xF6, 0xAF, 0x6A, 0xF9,
+    0x5F, 0xC9, 0x5F, 0xCA, 0x40, 0x9A, 0xA9, 0x5A, 0xAA, 0x4A, 0xE2, 0x9E, 0x95, 0xAE, 0x9A, 0xE9,
+    0x7A, 0xFD, 0x97, 0x1A, 0xF9, 0x73, 0xEA, 0x75, 0xAA, 0x77, 0x77, 0x77, 0x74, 0xAF, 0xEA, 0x96,
+    0xAF, 0xFD, 0x5F, 0xFF, 0x4E, 0xA3, 0x9E, 0x93, 0xEA, 0x4A, 0xDA, 0x3E, 0xA4, 0xAE, 0x3E, 0xA4,
+    0xAE, 0x3E, 0xA4, 0xF3, 0xEA, 0x3A, 0xEA, 0x3F, 0xFF, 0x92, 0x9F, 0xFE, 0xA3, 0x9F, 0xFE, 0x49,
+    0xFF, 0xF3, 0x9F, 0xC9, 0x09, 0xF9, 0x2A, 0xF9, 0x29, 0xF2, 0xAF, 0xA2, 0x9F, 0x91, 0xAF, 0xA2,
+    0x9F, 0xA1, 0xAF, 0xA2, 0x9F, 0xC1, 0xFC, 0xA2, 0x9F, 0xC9, 0x0F, 0xD2, 0x9F, 0xCA, 0x0F, 0xD2,
+    0x9F, 0xD7, 0x71, 0x09, 0x99, 0x59, 0x99, 0x1A, 0xE3, 0xAE, 0x2A, 0xE9, 0x9F, 0x4A, 0xFE, 0x6A,
+    0xFC, 0x70, 0xAE, 0x72, 0xD9, 0x77, 0x77, 0x4F, 0x9A, 0xDA, 0x4F, 0xFC, 0x4F, 0xFC, 0x4F, 0xDA,
+    0xAA, 0x4F, 0x97, 0x0F, 0x71, 0xF7, 0x1F, 0x71, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x0A, 0xF7, 0x0A,
+    0xF9, 0x7F, 0xC9, 0x7F, 0xCA, 0x40, 0x77, 0x73, 0xDA, 0x76, 0x9D, 0x97, 0x6E, 0x76, 0x9E, 0x76,
+    0xE9, 0x77, 0x77, 0x77, 0x3A, 0xAF, 0xCA, 0x97, 0xAF, 0xFD, 0x95, 0xAF, 0xFE, 0x59, 0xFD, 0xAA,
+    0xE9, 0x5A, 0xF9, 0x49, 0x6F, 0x97, 0x5F, 0x76, 0xFA, 0x75, 0xAF, 0xC9, 0x73, 0x9F, 0xFA, 0x97,
+    0x0F, 0xFE, 0xA7, 0xAF, 0xFE, 0x97, 0xAF, 0xFD, 0x72, 0x9A, 0xFE, 0x74, 0xAF, 0xC9, 0x74, 0xAF,
+    0xA2, 0xDA, 0x6A, 0xFA, 0x1F, 0xD9, 0x90, 0x9A, 0xFC, 0x90, 0xAF, 0xFF, 0xF0, 0x9F, 0xFF, 0xF9,
+    0x09, 0xFF, 0xFD, 0xA5, 0x9A, 0xFE, 0xA9, 0x77, 0x70, 0x7D, 0xA7, 0x2A, 0xD9, 0x72, 0xE7, 0x29,
+    0xDA, 0x72, 0xE9, 0x77, 0x77, 0x69, 0xAF, 0xCA, 0x94, 0xAF, 0xFA, 0x4E, 0x99, 0x99, 0xAC, 0x5D,
+    0xA7, 0x3E, 0x73, 0xF9, 0x72, 0xFD, 0xA9, 0x69, 0xFE, 0xA7, 0x9F, 0xDA, 0x71, 0x9F, 0x93, 0x94,
+    0xAE, 0xA2, 0xDA, 0x92, 0xFA, 0x1A, 0xFF, 0xE9, 0x0A, 0xFF, 0xF1, 0xAF, 0xFE, 0x49, 0xAA, 0xFA,
+    0x97, 0x71, 0x7D, 0x97, 0x6F, 0x75, 0xAF, 0xC7, 0x3A, 0xFE, 0x71, 0xF9, 0x0F, 0x7E, 0xA3, 0xAE,
+    0x77, 0x77, 0x77, 0x77, 0x2A, 0xAF, 0xCA, 0x97, 0xAF, 0xFD, 0x95, 0xAF, 0xFE, 0x59, 0xFD, 0xAA,
+    0xE9, 0x5A, 0xF9, 0x49, 0x6F, 0x97, 0x5F, 0x76, 0xFA, 0x75, 0xAF, 0xC9, 0x73, 0x9F, 0xFA, 0x97,
+    0x0F, 0xFE, 0xA7, 0xAF, 0xFE, 0x97, 0xAF, 0xFD, 0x72, 0x9A, 0xFE, 0x74, 0xAF, 0xC9, 0x74, 0xAF,
+    0xA2, 0xDA, 0x6A, 0xFA, 0x1F, 0xD9, 0x90, 0x9A, 0xFC, 0x90, 0xAF, 0xFF, 0xF0, 0x9F, 0xFF, 0xF9,
+    0x09, 0xFF, 0xFD, 0xA5, 0x9A, 0xFE, 0xA9, 0x77, 0x70, 0x77, 0x49, 0xD9, 0x72, 0xF7, 0x1F, 0xD7,
+    0xFF, 0x5E, 0xA1, 0xF3, 0xE9, 0x39, 0xE7, 0x77, 0x72, 0x9A, 0xFC, 0xA9, 0x4A, 0xFF, 0xA4, 0xE9,
+    0x99, 0x9A, 0xC5, 0xDA, 0x73, 0xE7, 0x3F, 0x97, 0x2F, 0xDA, 0x96, 0x9F, 0xEA, 0x79, 0xFD, 0xA7,
+    0x19, 0xF9, 0x39, 0x4A, 0xEA, 0x2D, 0xA9, 0x2F, 0xA1, 0xAF, 0xFE, 0x90, 0xAF, 0xFF, 0x1A, 0xFF,
+    0xE4, 0x9A, 0xAF, 0xA9, 0x77, 0x10, 0x5A, 0xAF, 0xCA, 0x97, 0xAF, 0xFD, 0x95, 0xAF, 0xFE, 0x59,
+    0xFD, 0xAA, 0xE9, 0x5A, 0xF9, 0x49, 0x6F, 0x97, 0x5F, 0x76, 0xFA, 0x75, 0xAF, 0xC9, 0x73, 0x9F,
+    0xFA, 0x97, 0x0F, 0xFE, 0xA7, 0xAF, 0xFE, 0x97, 0xAF, 0xFD, 0x72, 0x9A, 0xFE, 0x74, 0xAF, 0xC9,
+    0x29, 0x70, 0xAF, 0xA1, 0x9D, 0xA6, 0xAF, 0xA1, 0xFD, 0x99, 0x09, 0xAF, 0xC9, 0x0F, 0xFF, 0xFC,
+    0x0A, 0xFF, 0xFF, 0x92, 0x9A, 0xFF, 0xEA, 0x7F, 0xEA, 0x97, 0x09, 0xDA, 0x76, 0xAF, 0x97, 0x49,
+    0xA9, 0xE7, 0x49, 0xFA, 0x74, 0xAF, 0x75, 0x9A, 0xA9, 0x72, 0x77, 0x29, 0xAF, 0xCA, 0x94, 0xAF,
+    0xFA, 0x4E, 0x99, 0x99, 0xAC, 0x5D, 0xA7, 0x3E, 0x73, 0xF9, 0x72, 0xFD, 0xA9, 0x69, 0xFE, 0xA7,
+    0x9F, 0xDA, 0x71, 0x9F, 0x93, 0x94, 0xAE, 0xA2, 0xDA, 0x92, 0xFA, 0x1A, 0xFF, 0xE9, 0x09, 0xFF,
+    0xF1, 0xFF, 0xF3, 0x9A, 0xFD, 0xA9, 0x6D, 0x73, 0x9E, 0xA7, 0x1A, 0xF9, 0x70, 0x91, 0xDA, 0x70,
+    0xAF, 0xA7, 0x0A, 0xF7, 0x1A, 0xAA, 0x97, 0x29, 0x99, 0x59, 0x99, 0x95, 0x9E, 0x92, 0xAE, 0x79,
+    0xEA, 0x9F, 0x71, 0x9F, 0xE7, 0x39, 0xFC, 0x75, 0x9E, 0x77, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x76,
+    0xAA, 0xFC, 0xA9, 0x7A, 0xFF, 0xD9, 0x5A, 0xFF, 0xE5, 0x9F, 0xDA, 0xAE, 0x95, 0xAF, 0x94, 0x96,
+    0xF9, 0x75, 0xF7, 0x6F, 0xA7, 0x5A, 0xFC, 0x97, 0x39, 0xFF, 0xA9, 0x70, 0xFF, 0xEA, 0x7A, 0xFF,
+    0xE9, 0x7A, 0xFF, 0xD7, 0x29, 0xAF, 0xE7, 0x4A, 0xFC, 0x97, 0x4A, 0xFA, 0x2D, 0xA6, 0xAF, 0xA1,
+    0xFD, 0x99, 0x09, 0xAF, 0xC9, 0x0A, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x90, 0x9F, 0xFF, 0xDA, 0x59,
+    0xAF, 0xEA, 0x97, 0x77, 0x1A, 0xAA, 0x5A, 0xAA, 0x91, 0x9E, 0x91, 0x9E, 0xA3, 0x9F, 0xAE, 0xA5,
+    0x9F, 0xDA, 0x70, 0xFA, 0x71, 0x9E, 0x73, 0x9A, 0x77, 0x77, 0x79, 0xAF, 0xCA, 0x94, 0xAF, 0xFA,
+    0x4E, 0x99, 0x99, 0xAC, 0x5D, 0xA7, 0x3E, 0x73, 0xF9, 0x72, 0xFD, 0xA9, 0x69, 0xFE, 0xA7, 0x9F,
+    0xDA, 0x71, 0x9F, 0x93, 0x94, 0xAE, 0xA2, 0xDA, 0x92, 0xFA, 0x1A, 0xFF, 0xE9, 0x0A, 0xFF, 0xF1,
+    0xAF, 0xFE, 0x49, 0xAA, 0xFA, 0x97, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x0F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x96, 0xF9, 0x75, 0xF9,
+    0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xFA, 0x75, 0xFA, 0x75, 0xFA,
+    0x74, 0x9F, 0xA7, 0x49, 0xFA, 0x74, 0x9F, 0xA7, 0x49, 0xFA, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74,
+    0x9F, 0xC7, 0x6D, 0x77, 0xAE, 0x76, 0xFC, 0x75, 0x91, 0xD9, 0x74, 0xAA, 0xAD, 0x97, 0x4F, 0xC7,
+    0x5E, 0xA7, 0x77, 0x3A, 0x97, 0x0E, 0x97, 0x9E, 0x97, 0x9E, 0x97, 0x9E, 0x95, 0xFF, 0xD1, 0xAF,
+    0xFD, 0x90, 0xFF, 0xEA, 0x3A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7,
+    0x0F, 0x70, 0xFF, 0x4F, 0xF4, 0xFF, 0x93, 0xAF, 0xEA, 0x3A, 0xCA, 0x71, 0xF9, 0x7F, 0xC7, 0xAA,
+    0xAD, 0x7F, 0xC6, 0x9E, 0xA4, 0x77, 0x5E, 0xA3, 0x9E, 0x7A, 0xE9, 0x0F, 0x71, 0xAF, 0xE7, 0x3A,
+    0xFC, 0x75, 0xF7, 0x7D, 0x97, 0x77, 0x77, 0x77, 0x70, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x0F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x96, 0xF9,
+    0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xFA, 0x75, 0xFA,
+    0x75, 0xFA, 0x74, 0x9F, 0xA7, 0x49, 0xFA, 0x74, 0x9F, 0xA7, 0x49, 0xFA, 0x74, 0x9F, 0xC7, 0x49,
+    0xFC, 0x74, 0x9F, 0xC6, 0x74, 0xAD, 0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x4E, 0x96, 0xA9, 0x3E, 0x94,
+    0xE9, 0x29, 0xE9, 0x39, 0xE9, 0x29, 0xAA, 0xA4, 0x9E, 0x97, 0x39, 0xE9, 0x71, 0xFF, 0xD5, 0xAF,
+    0xFD, 0x94, 0xFF, 0xEA, 0x7A, 0xE7, 0x4A, 0xE7, 0x4A, 0xE7, 0x4A, 0xE7, 0x4A, 0xE7, 0x4A, 0xE7,
+    0x4F, 0x74, 0xFF, 0x70, 0xFF, 0x70, 0xAF, 0xE9, 0x79, 0xFE, 0xA7, 0x74, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x9F, 0xFF,
+    0xFD, 0x96, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x70, 0x9F, 0xFF, 0x59, 0xFF,
+    0xF5, 0x9F, 0xFF, 0x72, 0xFA, 0x75, 0xFA, 0x74, 0x9F, 0xA7, 0x49, 0xFA, 0x74, 0x9F, 0xA7, 0x49,
+    0xFA, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC6, 0x77, 0x5A, 0x97, 0x1E, 0x97, 0x09, 0xE9,
+    0x70, 0x9E, 0x97, 0x09, 0xE9, 0x6F, 0xFD, 0x2A, 0xFF, 0xD9, 0x1F, 0xFE, 0xA4, 0xAE, 0x5F, 0xFF,
+    0xA0, 0xFF, 0xFA, 0x0F, 0xFF, 0xA4, 0xAE, 0x71, 0xF7, 0x1F, 0x71, 0xFF, 0x5F, 0xF5, 0xAF, 0xE9,
+    0x49, 0xFE, 0xA7, 0x50, 0x59, 0x92, 0x99, 0x71, 0xF1, 0xD9, 0x70, 0xFC, 0x0D, 0x97, 0x9D, 0x0F,
+    0xC7, 0x0A, 0xD0, 0x9F, 0x71, 0xAA, 0x2A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7F, 0xC9, 0x5F,
+    0xFE, 0x95, 0xFC, 0xAF, 0xC9, 0x5A, 0xFA, 0xFC, 0x95, 0xAF, 0xAF, 0xC9, 0x5A, 0xFA, 0xFC, 0x95,
+    0xAF, 0xAA, 0xF6, 0xAF, 0x9A, 0xF6, 0xAF, 0x9A, 0xF6, 0xAF, 0x9A, 0xF6, 0x9F, 0x9A, 0xF6, 0x9F,
+    0x9A, 0xF6, 0x9F, 0x0A, 0xF6, 0x9F, 0x09, 0xF6, 0xAF, 0x09, 0xFA, 0x5F, 0xC0, 0x9F, 0xEA, 0xAF,
+    0xE1, 0xFF, 0xFF, 0x1F, 0xFF, 0xEA, 0x1A, 0xFF, 0xFD, 0x3F, 0xFF, 0xCA, 0x4A, 0xFF, 0xD9, 0x77,
+    0x40, 0x39, 0xD9, 0x1D, 0x6F, 0x90, 0xD5, 0xAD, 0xAD, 0xAD, 0x5A, 0xCA, 0x0F, 0xC5, 0xAD, 0x1A,
+    0xD7, 0x77, 0x77, 0x77, 0x70, 0xE5, 0xAE, 0x1E, 0x5A, 0xE1, 0xE5, 0xAE, 0x1E, 0x94, 0xAE, 0x1E,
+    0x94, 0xAE, 0x1E, 0x94, 0xAE, 0x1E, 0xA4, 0xF9, 0x0A, 0xDA, 0x4F, 0x90, 0xAE, 0x4F, 0x90, 0xAE,
+    0x4F, 0x90, 0x9F, 0x91, 0xFC, 0x90, 0x9F, 0xFF, 0x91, 0xFF, 0xF9, 0x1A, 0xFF, 0xEA, 0x2F, 0xFE,
+    0xA3, 0xAF, 0xA4, 0x69, 0x99, 0x9A, 0xAA, 0x6F, 0xFE, 0x94, 0x9F, 0xFF, 0x4A, 0xFF, 0xAA, 0xAA,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xFC, 0x95, 0xFF, 0xE9, 0x5F, 0xCA, 0xFC, 0x95, 0xAF,
+    0xAF, 0xC9, 0x5A, 0xFA, 0xFC, 0x95, 0xAF, 0xAF, 0xC9, 0x5A, 0xFA, 0xAF, 0x6A, 0xF9, 0xAF, 0x6A,
+    0xF9, 0xAF, 0x6A, 0xF9, 0xAF, 0x69, 0xF9, 0xAF, 0x69, 0xF9, 0xAF, 0x69, 0xF0, 0xAF, 0x69, 0xF0,
+    0x9F, 0x6A, 0xF0, 0x9F, 0xA5, 0xFC, 0x09, 0xFE, 0xAA, 0xFE, 0x1F, 0xFF, 0xF1, 0xFF, 0xFE, 0xA1,
+    0xAF, 0xFF, 0xD3, 0xFF, 0xFC, 0xA4, 0xAF, 0xFD, 0x97, 0x74, 0x72, 0x99, 0x3A, 0xFF, 0xD2, 0x9F,
+    0xFE, 0x91, 0xAF, 0xFF, 0x19, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x5E, 0x5A, 0xE1, 0xE5, 0xAE,
+    0x1E, 0x5A, 0xE1, 0xE9, 0x4A, 0xE1, 0xE9, 0x4A, 0xE1, 0xE9, 0x4A, 0xE1, 0xEA, 0x4F, 0x90, 0xAD,
+    0xA4, 0xF9, 0x0A, 0xE4, 0xF9, 0x0A, 0xE4, 0xF9, 0x09, 0xF9, 0x1F, 0xC9, 0x09, 0xFF, 0xF9, 0x1F,
+    0xFF, 0x91, 0xAF, 0xFE, 0xA2, 0xFF, 0xEA, 0x3A, 0xFA, 0x40, 0x2A, 0xDA, 0x3A, 0xD9, 0x59, 0xFA,
+    0xAF, 0x96, 0xFF, 0xD7, 0xAF, 0xF7, 0x19, 0xAF, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7F, 0xC9,
+    0x5F, 0xFE, 0x95, 0xFC, 0xAF, 0xC9, 0x5A, 0xFA, 0xFC, 0x95, 0xAF, 0xAF, 0xC9, 0x5A, 0xFA, 0xFC,
+    0x95, 0xAF, 0xAA, 0xF6, 0xAF, 0x9A, 0xF6, 0xAF, 0x9A, 0xF6, 0xAF, 0x9A, 0xF6, 0x9F, 0x9A, 0xF6,
+    0x9F, 0x9A, 0xF6, 0x9F, 0x0A, 0xF6, 0x9F, 0x09, 0xF6, 0xAF, 0x09, 0xFA, 0x5F, 0xC0, 0x9F, 0xEA,
+    0xAF, 0xE1, 0xFF, 0xFF, 0x1F, 0xFF, 0xEA, 0x1A, 0xFF, 0xFD, 0x3F, 0xFF, 0xCA, 0x4A, 0xFF, 0xD9,
+    0x77, 0x40, 0x1A, 0xEA, 0x99, 0x0A, 0xD9, 0x2A, 0xE2, 0x9E, 0x39, 0xFF, 0xCA, 0x4A, 0xFF, 0x69,
+    0xAF, 0x97, 0x77, 0x77, 0x77, 0x70, 0xE5, 0xAE, 0x1E, 0x5A, 0xE1, 0xE5, 0xAE, 0x1E, 0x94, 0xAE,
+    0x1E, 0x94, 0xAE, 0x1E, 0x94, 0xAE, 0x1E, 0xA4, 0xF9, 0x0A, 0xDA, 0x4F, 0x90, 0xAE, 0x4F, 0x90,
+    0xAE, 0x4F, 0x90, 0x9F, 0x91, 0xFC, 0x90, 0x9F, 0xFF, 0x91, 0xFF, 0xF9, 0x1A, 0xFF, 0xEA, 0x2F,
+    0xFE, 0xA3, 0xAF, 0xA4, 0x6A, 0xD7, 0x5F, 0xC7, 0x4D, 0x0D, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0x75,
+    0xAD, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3F, 0xC9, 0x5F, 0xFE, 0x95, 0xFC, 0xAF, 0xC9,
+    0x5A, 0xFA, 0xFC, 0x95, 0xAF, 0xAF, 0xC9, 0x5A, 0xFA, 0xFC, 0x95, 0xAF, 0xAA, 0xF6, 0xAF, 0x9A,
+    0xF6, 0xAF, 0x9A, 0xF6, 0xAF, 0x9A, 0xF6, 0x9F, 0x9A, 0xF6, 0x9F, 0x9A, 0xF6, 0x9F, 0x0A, 0xF6,
+    0x9F, 0x09, 0xF6, 0xAF, 0x09, 0xFA, 0x5F, 0xC0, 0x9F, 0xEA, 0xAF, 0xE1, 0xFF, 0xFF, 0x1F, 0xFF,
+    0xEA, 0x1A, 0xFF, 0xFD, 0x3F, 0xFF, 0xCA, 0x4A, 0xFF, 0xD9, 0x77, 0x40, 0x5D, 0xA7, 0x2F, 0xC7,
+    0x09, 0xD9, 0xD7, 0x09, 0xD0, 0xD9, 0x79, 0xFC, 0x71, 0xFA, 0x72, 0xAA, 0x97, 0x77, 0x77, 0x77,
+    0x72, 0xE5, 0xAE, 0x1E, 0x5A, 0xE1, 0xE5, 0xAE, 0x1E, 0x94, 0xAE, 0x1E, 0x94, 0xAE, 0x1E, 0x94,
+    0xAE, 0x1E, 0xA4, 0xF9, 0x0A, 0xDA, 0x4F, 0x90, 0xAE, 0x4F, 0x90, 0xAE, 0x4F, 0x90, 0x9F, 0x91,
+    0xFC, 0x90, 0x9F, 0xFF, 0x91, 0xFF, 0xF9, 0x1A, 0xFF, 0xEA, 0x2F, 0xFE, 0xA3, 0xAF, 0xA4, 0x5A,
+    0xE9, 0x5A, 0xE9, 0x4F, 0x95, 0xF9, 0x39, 0xF5, 0x9F, 0x93, 0xAF, 0x5A, 0xF9, 0x39, 0x99, 0x96,
+    0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xFC, 0x95, 0xFD, 0x3F, 0xC9, 0x5F, 0xCA, 0x3F,
+    0xC9, 0x5A, 0xFA, 0x3F, 0xC9, 0x5A, 0xFA, 0x3F, 0xC9, 0x5A, 0xFA, 0x3F, 0xC9, 0x5A, 0xFA, 0x3A,
+    0xF6, 0xAF, 0x93, 0xAF, 0x6A, 0xF9, 0x3A, 0xF6, 0xAF, 0x93, 0xAF, 0x69, 0xF9, 0x3A, 0xF6, 0x9F,
+    0x93, 0xAF, 0x69, 0xF4, 0xAF, 0x69, 0xF4, 0x9F, 0x6A, 0xF4, 0x9F, 0xA5, 0xFC, 0x49, 0xFE, 0xAA,
+    0xFE, 0x5F, 0xFF, 0xF5, 0xFF, 0xFE, 0xA5, 0xAF, 0xFF, 0xD7, 0xFF, 0xFC, 0xA7, 0x0A, 0xFF, 0xD9,
+    0x77, 0x73, 0x69, 0x99, 0x79, 0x99, 0x59, 0xEA, 0x59, 0xF4, 0xAE, 0xA5, 0xAF, 0x4F, 0xA5, 0xAF,
+    0x39, 0xFA, 0x49, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x70, 0xE5, 0xAE, 0x70, 0xE5, 0xAE, 0x70, 0xE5,
+    0xAE, 0x70, 0xE9, 0x4A, 0xE7, 0x0E, 0x94, 0xAE, 0x70, 0xE9, 0x4A, 0xE7, 0x0E, 0xA4, 0xF9, 0x7A,
+    0xDA, 0x4F, 0x97, 0xAE, 0x4F, 0x97, 0xAE, 0x4F, 0x97, 0x9F, 0x91, 0xFC, 0x97, 0x9F, 0xFF, 0x97,
+    0x0F, 0xFF, 0x97, 0x0A, 0xFF, 0xEA, 0x71, 0xFF, 0xEA, 0x72, 0xAF, 0xA7, 0x10, 0xFC, 0x95, 0xFF,
+    0xE9, 0x5F, 0xCA, 0xFC, 0x95, 0xAF, 0xAF, 0xC9, 0x5A, 0xFA, 0xFC, 0x95, 0xAF, 0xAF, 0xC9, 0x5A,
+    0xFA, 0xAF, 0x6A, 0xF9, 0xAF, 0x6A, 0xF9, 0xAF, 0x6A, 0xF9, 0xAF, 0x69, 0xF9, 0xAF, 0x69, 0xF9,
+    0xAF, 0x69, 0xF0, 0xAF, 0x69, 0xF0, 0x9F, 0x6A, 0xF0, 0x9F, 0xA5, 0xFC, 0x09, 0xFE, 0xAA, 0xFE,
+    0x1F, 0xFF, 0xF1, 0xFF, 0xFE, 0xA1, 0xAF, 0xFF, 0xD3, 0xFF, 0xFC, 0xA4, 0xAF, 0xFD, 0x97, 0x39,
+    0xE7, 0x5E, 0x75, 0x9D, 0x97, 0x59, 0xFC, 0x74, 0xFC, 0x97, 0x49, 0xE7, 0x75, 0x0E, 0x5A, 0xE1,
+    0xE5, 0xAE, 0x1E, 0x5A, 0xE1, 0xE9, 0x4A, 0xE1, 0xE9, 0x4A, 0xE1, 0xE9, 0x4A, 0xE1, 0xEA, 0x4F,
+    0x90, 0xEA, 0x4F, 0x90, 0xAD, 0xA4, 0xF9, 0x0A, 0xE4, 0xF9, 0x0A, 0xE9, 0x29, 0xF9, 0x09, 0xFC,
+    0xAA, 0xFC, 0x91, 0xFF, 0xF9, 0x1F, 0xFF, 0xA2, 0xFF, 0xEA, 0x3A, 0xFA, 0xE7, 0x2E, 0xA7, 0x19,
+    0xDA, 0x72, 0xE7, 0x3F, 0xCA, 0x70, 0x9F, 0xC7, 0x19, 0xAD, 0xA7, 0x70, 0x74, 0xD9, 0x77, 0x7F,
+    0x77, 0x6A, 0xFC, 0x77, 0x4A, 0xFE, 0x77, 0x2A, 0xE9, 0x0F, 0x77, 0x0A, 0xDA, 0x3A, 0xE7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xFC, 0x97, 0x7A, 0xF9, 0xAF, 0xA7, 0x7F, 0xC0, 0x9F, 0xA7,
+    0x7F, 0xC1, 0xFC, 0x77, 0xFA, 0x1F, 0xC7, 0x69, 0xF9, 0x1F, 0xC9, 0x49, 0x99, 0x94, 0xAF, 0x2A,
+    0xFA, 0x4F, 0x4F, 0xC2, 0x9F, 0xC3, 0xAF, 0x93, 0xFA, 0x3F, 0xC3, 0xFD, 0x29, 0xF9, 0x3F, 0xC9,
+    0x1A, 0xFD, 0x91, 0xAF, 0x4A, 0xFA, 0x1F, 0xF1, 0xFC, 0x49, 0xFC, 0x0A, 0xFF, 0x90, 0xFA, 0x49,
+    0xFC, 0x9F, 0xFD, 0x9F, 0x95, 0xFF, 0xFF, 0xFC, 0x6F, 0xFD, 0x99, 0xFF, 0xC6, 0xAF, 0xFC, 0x1F,
+    0xFC, 0x69, 0xFF, 0xA1, 0xAF, 0xEA, 0x7F, 0xF2, 0x9F, 0xE9, 0x7F, 0xF3, 0xFE, 0x70, 0xFE, 0x93,
+    0xAF, 0xD7, 0x0A, 0xFD, 0x49, 0xFC, 0xA4, 0x71, 0xDA, 0x77, 0x0A, 0xE9, 0x76, 0x9F, 0xC7, 0x59,
+    0xFE, 0x73, 0xAE, 0x90, 0xAE, 0x71, 0xAE, 0x39, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5F,
+    0x73, 0xF0, 0xF7, 0x29, 0xEA, 0x0A, 0xE9, 0x71, 0xF9, 0x09, 0xEA, 0x29, 0xD3, 0xF2, 0xF2, 0xF1,
+    0x9E, 0xA2, 0xF9, 0x0A, 0xF9, 0x0A, 0xE9, 0x29, 0xEA, 0x9F, 0xD0, 0xF4, 0xFF, 0xEA, 0xF4, 0xFF,
+    0xFE, 0xA4, 0xAF, 0xFF, 0xD9, 0x49, 0xFF, 0xFD, 0x6F, 0xDA, 0xFE, 0x6F, 0xD0, 0x9F, 0xCA, 0x6A,
+    0xFA, 0x1F, 0xC9, 0x69, 0xF2, 0x9F, 0x77, 0x70, 0x7A, 0xD7, 0x7E, 0xA7, 0x5F, 0xCA, 0x73, 0xFE,
+    0xA7, 0x1E, 0xA0, 0x9E, 0xA7, 0xE9, 0x3E, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xAF,
+    0x70, 0xFA, 0x0F, 0x96, 0x9F, 0x1F, 0xC6, 0xFA, 0x19, 0xF9, 0x49, 0xF3, 0xFC, 0x4F, 0xA3, 0x9F,
+    0x92, 0xAF, 0x5F, 0xC2, 0xFA, 0x59, 0xFA, 0x0A, 0xF7, 0xFC, 0x0F, 0xC7, 0x9F, 0xFC, 0x97, 0x0F,
+    0xFC, 0x71, 0xAF, 0xE9, 0x72, 0xFE, 0x73, 0xAF, 0xC9, 0x74, 0xFC, 0x75, 0xFC, 0x74, 0x9F, 0xC7,
+    0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x4A, 0xFC, 0x74, 0xAF, 0xC6, 0x77, 0x70, 0xE7, 0x4A, 0xEA, 0x72,
+    0x9F, 0xCA, 0x70, 0x9F, 0xEA, 0x69, 0xE9, 0x09, 0xEA, 0x4A, 0xE4, 0xAD, 0xA7, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0xF6, 0xAE, 0x19, 0xEA, 0x5F, 0x2F, 0x49, 0xE9, 0x29, 0xF3, 0xAE, 0x4F, 0x92,
+    0xF4, 0x9F, 0x2E, 0xA5, 0xFA, 0x0A, 0xE6, 0x9F, 0x0F, 0x7F, 0xFA, 0x79, 0xFE, 0x71, 0xFE, 0x71,
+    0x9F, 0xCA, 0x72, 0xFC, 0x73, 0xAF, 0x73, 0x9E, 0xA7, 0x3F, 0x96, 0x99, 0x9A, 0xFC, 0x7F, 0xF9,
+    0x7F, 0xF7, 0x0F, 0xE7, 0x1F, 0xA9, 0x70, 0x3F, 0x2E, 0xA7, 0xF1, 0x9F, 0x69, 0xF1, 0xAF, 0x6A,
+    0xF9, 0x0A, 0xF6, 0xAF, 0x90, 0xFC, 0x95, 0x99, 0x99, 0x99, 0x09, 0x99, 0x99, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x5A, 0xF7, 0x0F, 0xA0, 0xF9, 0x69, 0xF1, 0xFC, 0x6F, 0xA1, 0x9F, 0x94,
+    0x9F, 0x3F, 0xC4, 0xFA, 0x39, 0xF9, 0x2A, 0xF5, 0xFC, 0x2F, 0xA5, 0x9F, 0xA0, 0xAF, 0x7F, 0xC0,
+    0xFC, 0x79, 0xFF, 0xC9, 0x70, 0xFF, 0xC7, 0x1A, 0xFE, 0x97, 0x2F, 0xE7, 0x3A, 0xFC, 0x97, 0x4F,
+    0xC7, 0x5F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0xAF, 0xC7, 0x4A, 0xFC, 0x60,
+    0x70, 0xE7, 0x79, 0xDA, 0x77, 0xAD, 0x97, 0x7E, 0x77, 0xAD, 0xA7, 0x77, 0x77, 0x71, 0x9F, 0xFF,
+    0xFC, 0x2F, 0xFF, 0xFC, 0x29, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0x9A, 0xAA, 0xFF, 0xEA, 0x72, 0x9F,
+    0xE7, 0x29, 0xFE, 0x72, 0x9F, 0xE7, 0x29, 0xFE, 0x97, 0x19, 0xFE, 0x97, 0x19, 0xFE, 0xA7, 0x19,
+    0xFF, 0x71, 0x9F, 0xF7, 0x19, 0xFF, 0x71, 0x9F, 0xF9, 0x70, 0x9F, 0xFC, 0x99, 0x99, 0x99, 0x92,
+    0xFF, 0xFF, 0xC9, 0x1F, 0xFF, 0xFC, 0xA1, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xD9, 0x0F, 0xFF, 0xFD,
+    0xA0, 0x7A, 0xD7, 0x4E, 0x73, 0xAD, 0x97, 0x3E, 0x73, 0xAE, 0x77, 0x77, 0x77, 0x77, 0x70, 0xFF,
+    0xEA, 0x3F, 0xFF, 0x3F, 0xFF, 0x71, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xFA, 0x70,
+    0xAF, 0xA7, 0x0A, 0xFA, 0x70, 0xAF, 0xC7, 0x0A, 0xFC, 0x70, 0x9F, 0xDA, 0xAA, 0xAA, 0x3A, 0xFF,
+    0xF2, 0xFF, 0xFC, 0x91, 0xFF, 0xFD, 0x00, 0x79, 0x99, 0x77, 0xAE, 0xA7, 0x6A, 0xEA, 0x76, 0xFC,
+    0x76, 0xFC, 0x76, 0xFC, 0x77, 0x77, 0x77, 0x09, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xC2, 0x9F, 0xFF,
+    0xF3, 0xFF, 0xFF, 0x39, 0xAA, 0xAF, 0xFE, 0xA7, 0x29, 0xFE, 0x72, 0x9F, 0xE7, 0x29, 0xFE, 0x72,
+    0x9F, 0xE9, 0x71, 0x9F, 0xE9, 0x71, 0x9F, 0xEA, 0x71, 0x9F, 0xF7, 0x19, 0xFF, 0x71, 0x9F, 0xF7,
+    0x19, 0xFF, 0x97, 0x09, 0xFF, 0xC9, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xFC, 0x91, 0xFF, 0xFF, 0xCA,
+    0x1F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x90, 0xFF, 0xFF, 0xDA, 0x00, 0x6E, 0xA7, 0x29, 0xF7, 0x2A,
+    0xF7, 0x2F, 0xC7, 0x2F, 0xC7, 0x29, 0x99, 0x99, 0x77, 0x77, 0x77, 0x7F, 0xFE, 0xA3, 0xFF, 0xF3,
+    0xFF, 0xF7, 0x1A, 0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0xA7, 0x0A, 0xFA, 0x70, 0xAF,
+    0xA7, 0x0A, 0xFC, 0x70, 0xAF, 0xC7, 0x09, 0xFD, 0xAA, 0xAA, 0xA3, 0xAF, 0xFF, 0x2F, 0xFF, 0xC9,
+    0x1F, 0xFF, 0xD0, 0x77, 0x6A, 0xDA, 0x4E, 0x97, 0xAE, 0x90, 0x9E, 0x97, 0x1A, 0xFE, 0x97, 0x3A,
+    0xFC, 0x97, 0x5A, 0xEA, 0x77, 0xE7, 0x77, 0x77, 0x77, 0x75, 0x9F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC,
+    0x29, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0x9A, 0xAA, 0xFF, 0xEA, 0x72, 0x9F, 0xE7, 0x29, 0xFE, 0x72,
+    0x9F, 0xE7, 0x29, 0xFE, 0x97, 0x19, 0xFE, 0x97, 0x19, 0xFE, 0xA7, 0x19, 0xFF, 0x71, 0x9F, 0xF7,
+    0x19, 0xFF, 0x71, 0x9F, 0xF9, 0x70, 0x9F, 0xFC, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFF, 0xC9, 0x1F,
+    0xFF, 0xFC, 0xA1, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xD9, 0x0F, 0xFF, 0xFD, 0xA0, 0x19, 0xDA, 0x49,
+    0xDA, 0x3A, 0xE2, 0xAE, 0x5A, 0xEA, 0xF7, 0xAF, 0xD7, 0x1A, 0xF7, 0x3E, 0x97, 0x49, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x0F, 0xFE, 0xA3, 0xFF, 0xF3, 0xFF, 0xF7, 0x1A, 0xF9, 0x70, 0xAF, 0x97, 0x0A,
+    0xF9, 0x70, 0xAF, 0xA7, 0x0A, 0xFA, 0x70, 0xAF, 0xA7, 0x0A, 0xFC, 0x70, 0xAF, 0xC7, 0x09, 0xFD,
+    0xAA, 0xAA, 0xA3, 0xAF, 0xFF, 0x2F, 0xFF, 0xC9, 0x1F, 0xFF, 0xD0, 0x39, 0x99, 0x94, 0xFD, 0x91,
+    0xFE, 0x90, 0x9F, 0xE9, 0x09, 0xF9, 0x3A, 0xE9, 0x4A, 0xE5, 0xAE, 0x5A, 0xE5, 0xAE, 0x5A, 0xE5,
+    0xF5, 0xF5, 0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0xA4, 0xFA, 0x4F, 0x93, 0x77, 0x77,
+    0x7A, 0xD9, 0x77, 0x19, 0xDA, 0x59, 0xAF, 0xA9, 0x39, 0xDA, 0x39, 0xFF, 0xDA, 0x1A, 0xD9, 0x29,
+    0xFF, 0xFF, 0xC2, 0x9F, 0xDA, 0x9A, 0xFF, 0x92, 0xFC, 0x94, 0xAF, 0xC9, 0x2A, 0xF7, 0xFC, 0x3F,
+    0xA7, 0x9F, 0x91, 0x9F, 0x71, 0xFC, 0x1A, 0xF7, 0x19, 0xF1, 0xFA, 0x71, 0x9F, 0x1F, 0xA7, 0x2F,
+    0x1F, 0x97, 0x2F, 0x90, 0xFA, 0x72, 0xF9, 0x0F, 0xA7, 0x19, 0xF1, 0xFC, 0x71, 0xAF, 0x1A, 0xFA,
+    0x79, 0xFC, 0x1A, 0xFD, 0xA9, 0x90, 0x99, 0xFE, 0x19, 0xFF, 0xFF, 0xDA, 0x2F, 0xFF, 0xFD, 0x92,
+    0x9F, 0xFF, 0xFC, 0x4A, 0xFF, 0xFE, 0x69, 0xFF, 0xFC, 0x71, 0x9A, 0xFE, 0xA9, 0x77, 0x73, 0x74,
+    0xAA, 0x97, 0x59, 0xD9, 0x4A, 0xF9, 0x19, 0xDA, 0x2A, 0xFF, 0x09, 0xD9, 0x1A, 0xFF, 0xFC, 0x2F,
+    0x91, 0xAF, 0xCA, 0x1A, 0xE9, 0x3F, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x5E, 0xA2, 0xEA, 0x5E, 0xA2,
+    0xEA, 0x5E, 0xA2, 0xF4, 0x9E, 0x92, 0xFA, 0x29, 0xF9, 0x2A, 0xFF, 0xF4, 0xFF, 0xEA, 0x4A, 0xFF,
+    0xD6, 0xAF, 0xF7, 0x09, 0xAF, 0x95, 0x77, 0x69, 0xFF, 0xEA, 0x5A, 0xFF, 0xFD, 0x92, 0x9F, 0xFF,
+    0xF9, 0x1F, 0xFC, 0x39, 0xF1, 0xFA, 0xF5, 0xE9, 0x0E, 0x90, 0xF5, 0xEA, 0x0E, 0x1F, 0x49, 0xF0,
+    0xE1, 0xF9, 0x99, 0xAA, 0xFA, 0x09, 0xD0, 0x9F, 0xFF, 0xC9, 0x1D, 0x09, 0xFF, 0xFC, 0x3C, 0x09,
+    0xFF, 0xF4, 0x90, 0x9F, 0xFE, 0x79, 0xFF, 0xA9, 0x70, 0xAF, 0x76, 0xAF, 0x76, 0xAF, 0x97, 0x5A,
+    0xF9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0xA7, 0x5F, 0xCA, 0x70, 0x77, 0x39, 0xAE, 0x73,
+    0xFC, 0x72, 0x9F, 0xC7, 0x29, 0xEA, 0x91, 0x97, 0xAE, 0x9A, 0xFC, 0x94, 0xAF, 0xFE, 0x93, 0xAF,
+    0xDA, 0x9A, 0xE9, 0x2A, 0xFC, 0x93, 0xE2, 0xAF, 0xC4, 0xAD, 0x2A, 0xFA, 0x49, 0xD9, 0x1A, 0xFA,
+    0x49, 0xD9, 0x1A, 0xFA, 0x49, 0xDA, 0x1A, 0xFC, 0x4A, 0xD9, 0x1A, 0xFC, 0xA9, 0x19, 0xE9, 0x1A,
+    0xFF, 0xFC, 0x29, 0xFF, 0xFA, 0x2A, 0xFF, 0xF3, 0xFF, 0xEA, 0x4F, 0x19, 0xAA, 0xA9, 0x5F, 0x73,
+    0x9F, 0x73, 0xAF, 0x73, 0xFA, 0x73, 0xF9, 0x73, 0xF9, 0x72, 0x74, 0xAF, 0xFE, 0xAA, 0xFF, 0xEA,
+    0xAF, 0xFE, 0xA9, 0xF7, 0x09, 0xF7, 0x0A, 0xF7, 0x0F, 0xA7, 0x0F, 0x97, 0x0F, 0x70, 0x9E, 0x71,
+    0xE7, 0x9E, 0xA6, 0x9E, 0xA6, 0xAF, 0x6F, 0xC6, 0xAF, 0xFE, 0xAA, 0xFF, 0xEA, 0xAF, 0xFE, 0xAA,
+    0xFF, 0xEA, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xFE, 0x9F,
+    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0xE9, 0x09, 0xC5, 0xF9, 0x70, 0x95, 0xF9, 0x77,
+    0xF9, 0x77, 0xF9, 0x77, 0xF9, 0x77, 0xF9, 0x77, 0xF9, 0x77, 0xFA, 0x77, 0xFA, 0x77, 0xFA, 0x76,
+    0x9F, 0xA7, 0x69, 0xFA, 0x76, 0x9F, 0xA7, 0x69, 0xFA, 0x76, 0x9F, 0xC7, 0x69, 0xFC, 0x76, 0x9F,
+    0xC6, 0x7A, 0xCA, 0x79, 0xF7, 0xFC, 0x6A, 0xFA, 0x6F, 0xA9, 0x6E, 0x97, 0x0E, 0x97, 0x9E, 0x97,
+    0x9E, 0x97, 0x9E, 0x95, 0xFF, 0xD1, 0xAF, 0xFD, 0x90, 0xFF, 0xEA, 0x3A, 0xE7, 0x0A, 0xE7, 0x0A,
+    0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0F, 0x70, 0xFF, 0x4F, 0xF4, 0xAF, 0xE9, 0x39, 0xFE,
+    0xA7, 0x40, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xFD, 0x9F, 0xFF,
+    0xFD, 0x9F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x96, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75,
+    0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xFA, 0x75, 0xFA, 0x75, 0xFA, 0x74, 0x9F, 0xA7, 0x49, 0xFA,
+    0x74, 0x9F, 0xA7, 0x49, 0xFA, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x97, 0x39, 0xFE, 0x73, 0xFE, 0x97,
+    0x3F, 0xD9, 0x74, 0xAF, 0x97, 0x69, 0x9A, 0x40, 0x77, 0x77, 0x5E, 0x77, 0x1E, 0x77, 0x1E, 0x77,
+    0x09, 0xE0, 0xFC, 0x95, 0xFE, 0x90, 0xFC, 0x95, 0xFD, 0xA1, 0xFC, 0x95, 0xAF, 0xA2, 0xFC, 0x95,
+    0xAF, 0xA2, 0xFC, 0x95, 0xAF, 0xA2, 0xFC, 0x95, 0xAF, 0xA2, 0xAF, 0x6A, 0xF9, 0x2A, 0xF6, 0xAF,
+    0x92, 0xAF, 0x6A, 0xF9, 0x2A, 0xF6, 0x9F, 0x92, 0xAF, 0x69, 0xF9, 0x2A, 0xF6, 0x9F, 0x3A, 0xF6,
+    0x9F, 0x39, 0xF6, 0xAF, 0x39, 0xFA, 0x5F, 0xC3, 0x9F, 0xEA, 0xAF, 0xE4, 0xFF, 0xFF, 0x4F, 0xFF,
+    0xEA, 0x4A, 0xFF, 0xFD, 0x6F, 0xFF, 0xCA, 0x7A, 0xFF, 0xD9, 0x77, 0x72, 0x75, 0xCA, 0xA7, 0x6E,
+    0x76, 0xAD, 0x76, 0xE1, 0xE5, 0xAF, 0xCA, 0x1E, 0x5A, 0xFC, 0x2E, 0x5A, 0xF9, 0x2E, 0x94, 0xAE,
+    0x4E, 0x94, 0xAE, 0x4E, 0x94, 0xAE, 0x4E, 0xA4, 0xF9, 0x3A, 0xDA, 0x4F, 0x93, 0xAE, 0x4F, 0x93,
+    0xAE, 0x4F, 0x93, 0x9F, 0x91, 0xFC, 0x93, 0x9F, 0xFF, 0x94, 0xFF, 0xF9, 0x4A, 0xFF, 0xEA, 0x5F,
+    0xFE, 0xA6, 0xAF, 0xA7, 0x09, 0x99, 0x7A, 0xE9, 0x6A, 0xEA, 0x6A, 0xF6, 0xAF, 0x97, 0x30, 0x2E,
+    0x29, 0xDA, 0x2E, 0x92, 0xE2, 0xAD, 0xA7, 0x00, 0x49, 0xD9, 0x71, 0xF7, 0x0F, 0xCA, 0x6F, 0xEA,
+    0x4F, 0x09, 0xEA, 0x2E, 0xA3, 0xAD, 0xA7, 0x60, 0x19, 0x92, 0x99, 0x1F, 0x1D, 0x99, 0xFC, 0x0D,
+    0x9A, 0xD0, 0xFC, 0x0A, 0xD0, 0x9F, 0x09, 0xAA, 0x19, 0xAA, 0x10, 0x19, 0x9A, 0xAA, 0xAF, 0x2F,
+    0xFE, 0xA0, 0x9F, 0xFF, 0x0A, 0xAA, 0xAA, 0xAA, 0x99, 0x99, 0x99, 0x00, 0x70, 0x99, 0x99, 0x99,
+    0xA9, 0x2F, 0xFF, 0xE1, 0xAF, 0xFF, 0xEA, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0x99,
+    0x0A, 0xEA, 0x99, 0x0A, 0xD9, 0x0A, 0xE3, 0xE1, 0x9F, 0xFD, 0x2A, 0xFF, 0x49, 0xAF, 0x92, 0x19,
+    0x99, 0x29, 0xEA, 0x1A, 0xEA, 0x1F, 0xC1, 0xFC, 0x1F, 0xC0, 0x0E, 0xA1, 0xEA, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x09, 0xF0, 0x9F, 0x09, 0xF0, 0x9F, 0x00, 0x0D, 0xA1, 0xEA, 0x2C, 0xA1, 0xD1, 0xD6, 0x79,
+    0xDA, 0x19, 0xFC, 0x0A, 0xD9, 0xD0, 0xAF, 0xC1, 0xFA, 0x2A, 0xA9, 0x10, 0x69, 0x99, 0x79, 0x99,
+    0x59, 0xF6, 0xF4, 0xAF, 0x59, 0xF4, 0xFA, 0x5A, 0xF3, 0x9F, 0xA5, 0xFA, 0x77, 0x71, 0x76, 0xEA,
+    0x3A, 0xE2, 0xF0, 0x9E, 0xA4, 0xFE, 0xA6, 0xFC, 0xA7, 0x0F, 0x71, 0x9D, 0x94, 0x09, 0x99, 0x79,
+    0x99, 0x7F, 0x95, 0xAE, 0x96, 0xFA, 0x5A, 0xEA, 0x6F, 0xC5, 0xAF, 0x6A, 0xF9, 0x4A, 0xF9, 0x77,
+    0x60, 0x9A, 0xAA, 0xAA, 0x1A, 0xFC, 0x91, 0xFC, 0x2F, 0xC2, 0xAF, 0x91, 0x9F, 0xA2, 0xFC, 0x2F,
+    0xC9, 0x1A, 0xFC, 0x1A, 0xFC, 0x91, 0xAF, 0xC2, 0xAF, 0xA2, 0xAF, 0x92, 0xFC, 0x3F, 0xC2, 0xAF,
+    0xA2, 0xFC, 0x92, 0xAA, 0xAA, 0xA2, 0x9F, 0xCA, 0x2F, 0xCA, 0x2A, 0xFA, 0x29, 0xFA, 0x3F, 0xC3,
+    0xFC, 0x3A, 0xFA, 0x29, 0xFC, 0x3A, 0xAA, 0xAA, 0x00, 0x29, 0x92, 0x9D, 0x99, 0xAE, 0x9A, 0xF9,
+    0xAF, 0x91, 0x9D, 0x91, 0x9D, 0x90, 0x99, 0x92, 0xAD, 0x2A, 0xDA, 0xA9, 0xAF, 0x9A, 0xF9, 0xAD,
+    0x2A, 0xD2, 0xAE, 0xAA, 0xA9, 0x99, 0x1A, 0xFF, 0xD0, 0xAF, 0xFD, 0x79, 0xE7, 0x9E, 0x79, 0xE7,
+    0x0E, 0x74, 0x1D, 0xA2, 0xAD, 0x91, 0x9D, 0x91, 0xE1, 0xF1, 0xE2, 0xAC, 0x70, 0x49, 0xD0, 0xEA,
+    0xD0, 0xAD, 0xA0, 0xE0, 0x9D, 0x30, 0x29, 0x93, 0xE3, 0xE1, 0xAF, 0xCA, 0xAF, 0xCA, 0xAF, 0xCA,
+    0xAF, 0xCA, 0xAF, 0xCA, 0xAF, 0xCA, 0x1E, 0x3E, 0x39, 0x99, 0x10, 0x2C, 0x4C, 0x19, 0xFC, 0x09,
+    0x9C, 0x99, 0x2C, 0x70, 0x19, 0x99, 0xAA, 0xAA, 0xF3, 0xFF, 0xE9, 0x1A, 0xFF, 0xF1, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x99, 0x99, 0x90, 0x09, 0xE9, 0x1A, 0xEA, 0x1F, 0xA1, 0xFC, 0x1F, 0xC1, 0x99, 0x99,
+    0x90, 0x0E, 0xA1, 0xEA, 0x1F, 0x1F, 0x1F, 0x1F, 0x09, 0xF0, 0x9F, 0x09, 0xF0, 0x9F, 0x00, 0x79,
+    0xDA, 0x19, 0xFC, 0x0A, 0xD9, 0xD0, 0xAF, 0xC1, 0xFA, 0x2A, 0xA9, 0x10, 0x09, 0xFC, 0xA0, 0x9F,
+    0xC9, 0x1F, 0xC2, 0xFC, 0x19, 0xFA, 0x1F, 0xC2, 0xFC, 0x1A, 0xFA, 0x19, 0xAA, 0xAA, 0x20, 0x0A,
+    0xCA, 0x3D, 0x93, 0xEA, 0x1A, 0xFA, 0x09, 0x90, 0xAD, 0x09, 0xFA, 0x0A, 0xF1, 0x9A, 0xA9, 0x20,
+    0x39, 0x94, 0xE3, 0xEA, 0x2E, 0xA2, 0x9E, 0x39, 0xFD, 0x1F, 0xD2, 0xAF, 0x59, 0x10, 0x49, 0xE9,
+    0x9E, 0x9A, 0xE9, 0xAE, 0x9A, 0xE9, 0xF9, 0xF9, 0xF9, 0x0F, 0xFC, 0x90, 0xFF, 0xC9, 0x0F, 0xFC,
+    0x90, 0xE9, 0x09, 0xE9, 0x0E, 0x2E, 0x90, 0xE2, 0xE9, 0x0E, 0xA5, 0xF2, 0xF9, 0x19, 0xF4, 0xFA,
+    0xFC, 0x6F, 0xF7, 0x0F, 0xD7, 0x2F, 0x73, 0x9D, 0x97, 0x75, 0x59, 0xD9, 0x73, 0xF7, 0x2F, 0xCA,
+    0x70, 0xFE, 0xA6, 0xFA, 0xFA, 0x4F, 0x91, 0x9F, 0x2E, 0xA5, 0xF7, 0x70, 0x1A, 0xD9, 0x1D, 0x90,
+    0xFC, 0x90, 0xDA, 0x0F, 0xD0, 0xDA, 0x9D, 0x9A, 0xFC, 0x99, 0xD9, 0x0F, 0xC1, 0xD9, 0x1A, 0xD9,
+    0x00, 0x75, 0x9F, 0xFC, 0x91, 0xFF, 0xDA, 0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0x90, 0x39, 0x99, 0x9A,
+    0xAA, 0xA1, 0xAF, 0xFD, 0x1F, 0xFE, 0xA9, 0xFD, 0xAA, 0xAA, 0xA9, 0x1A, 0xD9, 0x1D, 0x90, 0xFC,
+    0x90, 0xDA, 0x0F, 0xD0, 0xDA, 0x9D, 0x9A, 0xFC, 0x99, 0xD9, 0x0F, 0xC1, 0xD9, 0x1A, 0xD9, 0x00,
+    0x9F, 0xFF, 0x09, 0xFF, 0xF0, 0x9F, 0xFF, 0x00, 0x4E, 0x1F, 0x1A, 0xD0, 0xF0, 0xEA, 0x0D, 0xA6,
+    0x72, 0xF2, 0xFF, 0x2F, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0,
+    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFC, 0x0F, 0xFC, 0x0D, 0xA2, 0xE0, 0xDA, 0x2E, 0x0F, 0xFC,
+    0x0F, 0xFC, 0x0F, 0xFC, 0x0A, 0xDA, 0xDA, 0x09, 0xFE, 0xAA, 0xC9, 0xAD, 0xAD, 0xAC, 0x99, 0xD0,
+    0xF0, 0x9D, 0x0F, 0x09, 0xD0, 0xD7, 0x00, 0x0A, 0xC1, 0xC9, 0x2E, 0xA3, 0x9D, 0x4A, 0xD9, 0x2A,
+    0xC9, 0xD9, 0x1A, 0xA1, 0xAA, 0x00, 0x19, 0x92, 0x99, 0x1F, 0x1D, 0x99, 0xFC, 0x0D, 0x9A, 0xD0,
+    0xFC, 0x0A, 0xD0, 0x9F, 0x09, 0xAA, 0x19, 0xAA, 0x10, 0x4A, 0xC9, 0x1A, 0xDA, 0x0A, 0xE0, 0x9E,
+    0x0A, 0xDA, 0x09, 0x92, 0x77, 0x1D, 0xA7, 0xAD, 0x97, 0xE7, 0x9D, 0xA7, 0xE9, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x4E, 0xA1, 0xEA, 0x1E, 0xA1, 0xEA, 0x09, 0xF0, 0x9F, 0x09, 0xF0, 0x9F, 0x0A,
+    0xF0, 0xAF, 0x00, 0x73, 0xFF, 0xC9, 0x0F, 0xFC, 0x90, 0xFF, 0xC9, 0x0E, 0x2E, 0x90, 0xE2, 0xE9,
+    0x0E, 0x2E, 0x90, 0x19, 0x99, 0xAA, 0xAA, 0xF3, 0xFF, 0xE9, 0x1A, 0xFF, 0xF1, 0xAA, 0xAA, 0xAA,
+    0xA9, 0x99, 0x99, 0x97, 0x77, 0x29, 0x93, 0xAF, 0xFD, 0x3F, 0xFE, 0xA1, 0xAF, 0xFF, 0x19, 0x99,
+    0x97, 0x10, 0x09, 0x99, 0x29, 0x99, 0x1E, 0x2E, 0x09, 0xE2, 0xE0, 0x9E, 0x19, 0xE0, 0x9E, 0x19,
+    0xE0, 0xAE, 0x19, 0xE0, 0xAE, 0x19, 0xE0, 0xAE, 0x1A, 0xE0, 0x9A, 0xA9, 0x99, 0x99, 0x0A, 0xFE,
+    0x9A, 0xFE, 0x9A, 0xFE, 0x93, 0xAE, 0x93, 0xAE, 0xA3, 0xAE, 0xA7, 0x00, 0x79, 0xA7, 0x19, 0xCA,
+    0x4A, 0xE0, 0xFC, 0x1A, 0xFE, 0xAD, 0x1F, 0xFA, 0xD1, 0xE0, 0xFE, 0x1E, 0x1F, 0xCA, 0x1E, 0x09,
+    0xFC, 0x6A, 0xCA, 0x97, 0x0D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xD7,
+    0x1D, 0xA7, 0x1D, 0x71, 0xAA, 0x77, 0x50, 0x77, 0x77, 0xE7, 0x72, 0xE9, 0x77, 0x09, 0xEA, 0x77,
+    0x09, 0xEA, 0x77, 0x09, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x99, 0x99, 0x93, 0xAF,
+    0xDA, 0x4A, 0xFA, 0x09, 0xFF, 0xDA, 0x29, 0xFC, 0x0F, 0xFF, 0xC9, 0x9F, 0xCA, 0x9F, 0xC9, 0x09,
+    0xFF, 0xF9, 0xAF, 0xC9, 0x2A, 0xFF, 0xCA, 0x1F, 0xCA, 0x0A, 0xA9, 0x0A, 0xFC, 0xA9, 0x70, 0x9D,
+    0xA7, 0x71, 0xAE, 0x77, 0x1F, 0x72, 0x29, 0x99, 0x72, 0xFD, 0x2A, 0xDA, 0x0A, 0xFE, 0x1A, 0xE0,
+    0xF0, 0xF0, 0xAE, 0x0E, 0xA1, 0xFE, 0x90, 0x9E, 0x2F, 0xD7, 0x19, 0xAA, 0x94, 0x99, 0x97, 0x2F,
+    0xD2, 0xAD, 0xA0, 0xAF, 0xE9, 0x0A, 0xE0, 0xEA, 0x0A, 0xEA, 0xEA, 0x0E, 0xA1, 0xAF, 0xD2, 0x9A,
+    0xA2, 0x9F, 0x97, 0x70, 0x77, 0x59, 0xC9, 0x1C, 0xA9, 0x3A, 0xE0, 0xAE, 0x5A, 0x2A, 0x97, 0x76,
+    0x09, 0xA2, 0xD9, 0x1A, 0xC2, 0xAC, 0x10, 0x77, 0x29, 0x1A, 0xCA, 0x77, 0xD0, 0x9E, 0x74, 0xAE,
+    0x19, 0xEA, 0x96, 0x9A, 0xF4, 0xFF, 0xFE, 0xA6, 0x9A, 0xFF, 0xCA, 0x97, 0x77, 0x20, 0x49, 0xAF,
+    0xEA, 0x97, 0x0A, 0xFF, 0xFD, 0x94, 0xFA, 0xA9, 0x99, 0x99, 0x9A, 0xFA, 0x2E, 0x97, 0x3E, 0xA0,
+    0xAD, 0x76, 0x9D, 0x19, 0x77, 0x0A, 0x97, 0x76, 0x77, 0x2A, 0x77, 0x71, 0xDA, 0x4A, 0xFF, 0xFF,
+    0xFE, 0x91, 0xAF, 0xFF, 0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0xFE, 0x97, 0x74, 0xE9, 0x77, 0x6C, 0x97,
+    0x77, 0x70, 0x70, 0xF7, 0x71, 0xFA, 0x77, 0xAF, 0xC7, 0x7F, 0xD9, 0x75, 0x9F, 0xDA, 0x75, 0xFA,
+    0xE7, 0x5E, 0xA9, 0xEA, 0x73, 0xAE, 0x90, 0xF7, 0x3F, 0x1A, 0xE9, 0x71, 0x9E, 0xA1, 0x9E, 0xA7,
+    0x1F, 0x92, 0xF7, 0x1F, 0x3F, 0xA7, 0xAF, 0x39, 0xF7, 0xFC, 0xAA, 0xAA, 0xAF, 0x95, 0x9F, 0xFF,
+    0xDA, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xFC, 0x3F, 0xC7, 0xFC, 0x91, 0x9F, 0xC7,
+    0xAF, 0xA1, 0xFC, 0x97, 0x9F, 0xC0, 0xFF, 0xCA, 0x95, 0xFF, 0xF4, 0xFF, 0xFC, 0x3F, 0x91, 0x99,
+    0xFA, 0x2F, 0x5F, 0x2F, 0x59, 0xE2, 0xF5, 0xAE, 0x2F, 0x49, 0xEA, 0x2F, 0xFF, 0xC3, 0xFF, 0xFA,
+    0x3F, 0xFF, 0xD2, 0xFA, 0xAA, 0xAA, 0xFD, 0x1F, 0x59, 0xF9, 0x0F, 0x6A, 0xEA, 0x0F, 0x6F, 0xC0,
+    0xFA, 0x99, 0x99, 0xAF, 0xD0, 0xFF, 0xFE, 0xA0, 0xFF, 0xFE, 0x90, 0xFF, 0xFE, 0x1F, 0xFF, 0xD2,
+    0xFF, 0xEA, 0x93, 0xAF, 0xFE, 0xAF, 0xFE, 0xAF, 0xFE, 0xAF, 0xFE, 0xAD, 0xA7, 0xAD, 0xA7, 0xAD,
+    0xA7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7,
+    0xAE, 0x96, 0xAE, 0x96, 0xAE, 0x96, 0xAE, 0x97, 0x72, 0x79, 0x99, 0x97, 0x6A, 0xF9, 0x75, 0xFD,
+    0x74, 0xAF, 0xD9, 0x73, 0xFE, 0xA7, 0x29, 0xFF, 0x72, 0xF9, 0xAE, 0xA7, 0x09, 0xF0, 0x9F, 0x70,
+    0xFA, 0x1F, 0xA6, 0x9F, 0x2A, 0xF6, 0xFC, 0x3F, 0xA4, 0x9F, 0x93, 0xFC, 0x4F, 0xC4, 0x9F, 0x92,
+    0x9F, 0xA5, 0xFC, 0x2F, 0xC6, 0xAF, 0x90, 0x9F, 0xA7, 0xFC, 0x0A, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF,
+    0xFD, 0x0A, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF, 0xFD, 0x00, 0x0A, 0xAA, 0xAA, 0xAF, 0xE9, 0x9F, 0xFF,
+    0xC0, 0x9F, 0xFF, 0xC0, 0x9F, 0xFA, 0xAA, 0xA9, 0x09, 0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x71,
+    0x9E, 0xA7, 0x1A, 0xFA, 0xAA, 0xE9, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9, 0x2A,
+    0xF7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7, 0x1F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xD0, 0xFF,
+    0xFD, 0x0F, 0xFF, 0xD9, 0xFF, 0xFD, 0xAF, 0xFF, 0xE0, 0x09, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xC2,
+    0x9F, 0xFF, 0xF3, 0xFF, 0xFF, 0x39, 0xAA, 0xAF, 0xFE, 0xA7, 0x29, 0xFE, 0x72, 0x9F, 0xE7, 0x29,
+    0xFE, 0x72, 0x9F, 0xE9, 0x71, 0x9F, 0xE9, 0x71, 0x9F, 0xEA, 0x71, 0x9F, 0xF7, 0x19, 0xFF, 0x71,
+    0x9F, 0xF7, 0x19, 0xFF, 0x97, 0x09, 0xFF, 0xC9, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xFC, 0x91, 0xFF,
+    0xFF, 0xCA, 0x1F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x90, 0xFF, 0xFF, 0xDA, 0x00, 0x9F, 0x7F, 0x90,
+    0x9F, 0x7F, 0x90, 0x9F, 0x7F, 0x90, 0x9F, 0x7F, 0x90, 0x9F, 0x7F, 0xA0, 0xAF, 0x7F, 0xA0, 0xAF,
+    0x7F, 0xA0, 0xAF, 0x7F, 0xA0, 0xAF, 0x7F, 0xA0, 0xAF, 0x96, 0xFA, 0x0A, 0xF9, 0x59, 0xFC, 0x0A,
+    0xFA, 0x99, 0x99, 0x99, 0xAF, 0xC0, 0xAF, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xD0,
+    0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xD0, 0xFC, 0xA5, 0xAF, 0xC0, 0xFC, 0xA5, 0xAF, 0xC0, 0xFC, 0xA5,
+    0xAF, 0xC0, 0xFC, 0xA5, 0xAF, 0xC0, 0x59, 0xAF, 0xA9, 0x72, 0x9F, 0xFD, 0xA7, 0x9F, 0xFF, 0xC5,
+    0x9F, 0xDA, 0x9A, 0xFD, 0x4F, 0xC9, 0x4A, 0xFA, 0x2A, 0xF7, 0xFC, 0x2F, 0xA7, 0x9F, 0x90, 0x9F,
+    0x71, 0xFC, 0x0A, 0xF5, 0x99, 0x90, 0x9F, 0x0F, 0xA0, 0xFF, 0x99, 0xF0, 0xFA, 0x0F, 0xFA, 0x0F,
+    0x0F, 0x9A, 0xFF, 0xC0, 0xF9, 0xFA, 0x99, 0x99, 0x99, 0x4F, 0x9F, 0xA7, 0x19, 0xF0, 0xFC, 0x71,
+    0xAF, 0x0A, 0xFA, 0x79, 0xFC, 0x0A, 0xFD, 0xA9, 0x90, 0x99, 0xFE, 0x09, 0xFF, 0xFF, 0xDA, 0x1F,
+    0xFF, 0xFD, 0x91, 0x9F, 0xFF, 0xFC, 0x3A, 0xFF, 0xFE, 0x59, 0xFF, 0xFC, 0x70, 0x9A, 0xFE, 0xA9,
+    0x77, 0x71, 0xFA, 0x0A, 0xEA, 0x0A, 0xEA, 0x0A, 0xEA, 0x0A, 0xEA, 0x09, 0xEA, 0x09, 0xEA, 0x09,
+    0xEA, 0x09, 0xEA, 0x09, 0xEA, 0x09, 0xEA, 0x09, 0xF0, 0x9F, 0x09, 0xF0, 0x9F, 0x0A, 0xF0, 0xAF,
+    0x0A, 0xF0, 0xFC, 0x9F, 0xC9, 0xFC, 0x90, 0x1A, 0xE9, 0x2F, 0xC5, 0xF9, 0x1A, 0xFA, 0x5F, 0x2F,
+    0xC6, 0xF1, 0xAF, 0x96, 0xF0, 0x9F, 0xA6, 0x9F, 0x0F, 0xC7, 0x9E, 0xA9, 0xFA, 0x79, 0xEA, 0xFC,
+    0x70, 0xAF, 0xF9, 0x70, 0xAF, 0xEA, 0x71, 0xFF, 0x72, 0xFE, 0x97, 0x2F, 0xEA, 0x72, 0xFF, 0xA7,
+    0x09, 0xFF, 0xD7, 0x9F, 0xFE, 0x69, 0xF0, 0xFE, 0x5A, 0xF0, 0x9F, 0xE9, 0x3A, 0xF1, 0x9F, 0xE9,
+    0x2F, 0xC2, 0xAF, 0xEA, 0x1F, 0xC3, 0xAF, 0xEA, 0x00, 0x59, 0xFD, 0xA7, 0x4F, 0xF7, 0x4F, 0xF7,
+    0x39, 0xFF, 0x97, 0x2A, 0xFF, 0xC7, 0x2F, 0xFD, 0x71, 0x9F, 0xFD, 0x97, 0x0A, 0xFF, 0xE7, 0x0F,
+    0xC9, 0xAF, 0xC7, 0x9F, 0xC1, 0xFC, 0x96, 0xAF, 0xA1, 0xAF, 0xC6, 0xFC, 0x29, 0xFC, 0x59, 0xFC,
+    0x3F, 0xC9, 0x4A, 0xF9, 0x39, 0xFC, 0x4F, 0xC5, 0xFC, 0x4F, 0xA5, 0x9F, 0x92, 0xAF, 0x7F, 0xC2,
+    0xFC, 0x7A, 0xF2, 0xF9, 0x70, 0xF9, 0x09, 0xF7, 0x1A, 0xEA, 0x0F, 0xA7, 0x19, 0xF0, 0x0F, 0xC7,
+    0x0F, 0xC2, 0xFC, 0xA6, 0x9F, 0xC1, 0x9F, 0xD6, 0xFD, 0x19, 0xFD, 0x95, 0xFD, 0x90, 0x9F, 0xE4,
+    0xAF, 0xD9, 0x09, 0xFE, 0x93, 0xFE, 0x90, 0x9F, 0xEA, 0x29, 0xFE, 0x90, 0x9F, 0xF2, 0xFF, 0x90,
+    0x9F, 0xF9, 0x1F, 0xF9, 0x0A, 0xEA, 0xFC, 0x0A, 0xFF, 0xA0, 0xAE, 0xAA, 0xF9, 0xFA, 0xFA, 0x0A,
+    0xEA, 0x9F, 0xFC, 0x9F, 0xA0, 0xAF, 0x0F, 0xFC, 0x0F, 0xA0, 0xAF, 0x0A, 0xFE, 0xA0, 0xFA, 0x0A,
+    0xF1, 0xFE, 0x99, 0xFC, 0x0F, 0xC1, 0xFE, 0x09, 0xFC, 0x0F, 0xC1, 0x9F, 0xCA, 0x09, 0xFC, 0x0F,
+    0xC2, 0xFC, 0x90, 0xAF, 0xC0, 0xFC, 0x91, 0xAF, 0x1A, 0xFC, 0x0F, 0xC9, 0x19, 0xF1, 0xFD, 0x0F,
+    0xC9, 0x70, 0xFD, 0x00, 0x75, 0xF0, 0x9F, 0x96, 0xF0, 0x9F, 0xC5, 0x9E, 0xA0, 0x9F, 0xC9, 0x49,
+    0xEA, 0x0A, 0xFD, 0x49, 0xEA, 0x0A, 0xFD, 0x93, 0xAE, 0xA0, 0xAF, 0xE3, 0xAE, 0x90, 0xFF, 0x92,
+    0xAE, 0x90, 0xFF, 0xC2, 0xF9, 0x0F, 0xFC, 0x91, 0xF9, 0x0F, 0xC9, 0xF1, 0xF9, 0x0F, 0xC0, 0xF9,
+    0x0F, 0x1F, 0xC0, 0xAE, 0xA0, 0xF0, 0x9F, 0xC1, 0xF9, 0xF0, 0x9F, 0xC1, 0xAF, 0xF0, 0x9F, 0xC1,
+    0x9F, 0xF0, 0xAF, 0xC2, 0xFF, 0x0A, 0xFC, 0x29, 0xFE, 0x0A, 0xFC, 0x3F, 0xE0, 0xFD, 0x3A, 0xFD,
+    0x0F, 0xD4, 0xFC, 0xA0, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xFD, 0x1A,
+    0xFF, 0xFD, 0x1A, 0xFF, 0xFD, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9F, 0xFC, 0xA5, 0x9F, 0xFC,
+    0xA5, 0x9F, 0xFC, 0xA6, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x76, 0xAF, 0xFF, 0xEA, 0xAF,
+    0xFF, 0xEA, 0xAF, 0xFF, 0xEA, 0xAF, 0xFF, 0xEA, 0x59, 0xAF, 0xA9, 0x72, 0x9F, 0xFD, 0xA7, 0x9F,
+    0xFF, 0xC5, 0x9F, 0xDA, 0x9A, 0xFD, 0x4F, 0xC9, 0x4A, 0xFA, 0x2A, 0xF7, 0xFC, 0x2F, 0xA7, 0x9F,
+    0x90, 0x9F, 0x71, 0xFC, 0x0A, 0xF7, 0x19, 0xF0, 0xFA, 0x71, 0x9F, 0x0F, 0xA7, 0x2F, 0x0F, 0x97,
+    0x2F, 0x9F, 0xA7, 0x2F, 0x9F, 0xA7, 0x19, 0xF0, 0xFC, 0x71, 0xAF, 0x0A, 0xFA, 0x79, 0xFC, 0x0A,
+    0xFD, 0xA9, 0x90, 0x99, 0xFE, 0x09, 0xFF, 0xFF, 0xDA, 0x1F, 0xFF, 0xFD, 0x91, 0x9F, 0xFF, 0xFC,
+    0x3A, 0xFF, 0xFE, 0x59, 0xFF, 0xFC, 0x70, 0x9A, 0xFE, 0xA9, 0x77, 0x71, 0xAF, 0xFF, 0x9A, 0xFF,
+    0xF9, 0xAF, 0xFF, 0x9A, 0xE4, 0x9E, 0x9A, 0xE4, 0x9E, 0x9A, 0xE4, 0x9E, 0x9A, 0xE4, 0x9E, 0x9A,
+    0xE4, 0x9E, 0x9A, 0xE4, 0x9E, 0x9A, 0xE4, 0x9E, 0x9A, 0xE4, 0x9E, 0x9A, 0xE4, 0x9E, 0x9A, 0xE4,
+    0x9E, 0x9A, 0xE4, 0x9E, 0x9A, 0xE4, 0x9E, 0x9A, 0xE4, 0x9E, 0x9A, 0xE4, 0x9E, 0x9A, 0xE4, 0x9E,
+    0x9A, 0xDA, 0x5E, 0x00, 0x77, 0xFF, 0xCA, 0x4F, 0xFE, 0x92, 0xFF, 0xF9, 0x1F, 0x39, 0xF1, 0xF5,
+    0xE9, 0x0F, 0x5E, 0xA0, 0xF4, 0x9F, 0x0F, 0x99, 0x9A, 0xAF, 0xA0, 0xFF, 0xFC, 0x99, 0xFF, 0xFC,
+    0x09, 0xFF, 0xF1, 0x9F, 0xFE, 0x29, 0xFF, 0xA9, 0x3A, 0xF7, 0x1A, 0xF7, 0x1A, 0xF9, 0x70, 0xAF,
+    0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xCA, 0x70, 0xFC, 0xA7, 0x00, 0x74, 0xFF, 0xFA, 0xFF,
+    0xFA, 0xFF, 0xFA, 0x9F, 0x70, 0xAF, 0x70, 0xAE, 0xA7, 0x0F, 0xA7, 0x0F, 0x97, 0x0F, 0x70, 0x9E,
+    0x71, 0xE7, 0x9E, 0x96, 0xAE, 0xA6, 0xFA, 0x59, 0xFC, 0x6F, 0xFF, 0xAF, 0xFF, 0xAF, 0xFF, 0xAF,
+    0xFF, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xFD, 0x9F, 0xFF,
+    0xFD, 0x9F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x96, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75,
+    0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xFA, 0x75, 0xFA, 0x75, 0xFA, 0x74, 0x9F, 0xA7, 0x49, 0xFA,
+    0x74, 0x9F, 0xA7, 0x49, 0xFA, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC6, 0xAF, 0x70, 0xFA,
+    0x0F, 0x96, 0x9F, 0x1F, 0xC6, 0xFA, 0x19, 0xF9, 0x49, 0xF3, 0xFC, 0x4F, 0xA3, 0x9F, 0x92, 0xAF,
+    0x5F, 0xC2, 0xFA, 0x59, 0xFA, 0x0A, 0xF7, 0xFC, 0x0F, 0xC7, 0x9F, 0xFC, 0x97, 0x0F, 0xFC, 0x71,
+    0xAF, 0xE9, 0x72, 0xFE, 0x73, 0xAF, 0xC9, 0x74, 0xFC, 0x75, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC,
+    0x74, 0x9F, 0xC7, 0x4A, 0xFC, 0x74, 0xAF, 0xC6, 0x72, 0x9A, 0xAA, 0x77, 0x59, 0xE9, 0x77, 0x4A,
+    0xE9, 0x77, 0x4A, 0xE7, 0x73, 0x99, 0xFA, 0x99, 0x75, 0x9A, 0xFF, 0xEA, 0x97, 0x1F, 0xFF, 0xFA,
+    0x69, 0xFF, 0xEA, 0xFE, 0x5F, 0xD1, 0xAE, 0x19, 0xFD, 0x3F, 0xD2, 0xAE, 0x3F, 0xCA, 0x19, 0xFC,
+    0x3F, 0x39, 0xFC, 0x1A, 0xFA, 0x3F, 0x4F, 0xC9, 0x0F, 0xCA, 0x3F, 0x4F, 0xCA, 0x0F, 0xC9, 0x3F,
+    0x4A, 0xFA, 0x0F, 0xC9, 0x3F, 0x4A, 0xFA, 0x0F, 0xCA, 0x3F, 0x4F, 0xCA, 0x0F, 0xD9, 0x2F, 0x3F,
+    0xD9, 0x0A, 0xFE, 0xA9, 0xF9, 0xAA, 0xFE, 0x2F, 0xFF, 0xFF, 0xE2, 0xAF, 0xFF, 0xFF, 0xC9, 0x3F,
+    0xFF, 0xFF, 0xA5, 0x9F, 0xFF, 0xFC, 0x97, 0x09, 0xAA, 0xFF, 0xCA, 0xA7, 0x70, 0xEA, 0x77, 0x5E,
+    0xA7, 0x74, 0x9E, 0xA7, 0x74, 0x9E, 0xA7, 0x77, 0x74, 0x0A, 0xEA, 0x79, 0xF2, 0xFA, 0x6F, 0x92,
+    0x9F, 0x94, 0xFA, 0x4F, 0xC3, 0xAF, 0x6F, 0xC1, 0xAF, 0x96, 0xAF, 0xA9, 0xFA, 0x70, 0xFF, 0xD7,
+    0x2F, 0xF9, 0x72, 0xAF, 0xDA, 0x74, 0xFD, 0x75, 0xFD, 0x74, 0xAF, 0xE7, 0x3F, 0xF9, 0x71, 0xFF,
+    0xD7, 0x0A, 0xFF, 0xDA, 0x69, 0xFC, 0x9A, 0xFC, 0x95, 0xFD, 0x1F, 0xD4, 0xAF, 0xC9, 0x19, 0xFC,
+    0xA2, 0x9F, 0xCA, 0x3F, 0xD9, 0x1F, 0xD4, 0x9F, 0xD0, 0xAF, 0xCA, 0x5A, 0xFC, 0xA0, 0x9A, 0xAA,
+    0x4A, 0xD9, 0x09, 0xAA, 0xAA, 0xE4, 0xAD, 0x90, 0xAE, 0xAE, 0x4A, 0xD9, 0x0A, 0xEA, 0xE4, 0xE9,
+    0x0A, 0xEA, 0xE4, 0xE9, 0x0A, 0xE9, 0xE4, 0xE9, 0x0E, 0xA9, 0xE9, 0x3E, 0x09, 0xE9, 0x0E, 0xA3,
+    0xE0, 0xF9, 0x0F, 0xA2, 0xEA, 0xF1, 0xAF, 0xA9, 0x0F, 0xF2, 0xFF, 0xFD, 0x92, 0x9F, 0xFF, 0xA4,
+    0x9F, 0xFD, 0xA7, 0x9A, 0xFC, 0xA7, 0x5E, 0x76, 0xE7, 0x6E, 0x76, 0xE7, 0x6E, 0x75, 0x9E, 0x75,
+    0x9E, 0x75, 0x9E, 0x75, 0x9D, 0xA5, 0x77, 0x71, 0x9A, 0xFC, 0x97, 0x19, 0xFF, 0xD9, 0x69, 0xFF,
+    0xF9, 0x5F, 0xC9, 0x19, 0xFC, 0x93, 0xFA, 0x5A, 0xF2, 0x9F, 0x7F, 0x91, 0xAE, 0xA7, 0x9E, 0xA1,
+    0xF7, 0x1F, 0x1F, 0x71, 0xF1, 0xF7, 0x1F, 0x1F, 0x71, 0xF1, 0xF7, 0x1F, 0x1F, 0x70, 0x9F, 0x1A,
+    0xEA, 0x7F, 0xA2, 0xF6, 0xAF, 0x92, 0x9F, 0x92, 0x9F, 0xCA, 0x19, 0xFE, 0xA1, 0xFE, 0xA0, 0xAF,
+    0xEA, 0x1F, 0xF9, 0xAF, 0xEA, 0x1F, 0xF9, 0x9F, 0xEA, 0x1F, 0xF9, 0x77, 0x30, 0x77, 0x59, 0xEA,
+    0x97, 0x2F, 0xFD, 0x6A, 0xFF, 0xD6, 0xE9, 0x19, 0xF5, 0x9D, 0xA3, 0xAE, 0x94, 0xE5, 0xE9, 0x4E,
+    0x5E, 0xA4, 0xDA, 0x5E, 0xA4, 0xD9, 0x5A, 0xDA, 0x4D, 0x95, 0xAE, 0x4D, 0xA5, 0xF4, 0xFA, 0xAA,
+    0xFD, 0x4A, 0xFF, 0xF2, 0x91, 0xFF, 0xFA, 0xD9, 0x19, 0xFF, 0xFD, 0x93, 0xAE, 0xA9, 0x0F, 0xD9,
+    0x72, 0xAF, 0xC7, 0x72, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9E, 0xA7, 0x0A, 0xFD, 0xA5, 0x9F, 0xFC,
+    0x4F, 0xFE, 0x3F, 0xC9, 0x9F, 0xA1, 0xAE, 0xA3, 0xAE, 0x1A, 0xE5, 0xE1, 0xAE, 0x5E, 0x1A, 0xE1,
+    0x99, 0xAF, 0x1A, 0xE0, 0xAF, 0xD2, 0xAE, 0x0A, 0xFD, 0x91, 0xAE, 0x0A, 0xFE, 0xA0, 0xAE, 0x49,
+    0xF9, 0xAE, 0x59, 0xEA, 0xAE, 0xA4, 0x9F, 0xAF, 0xD9, 0x1F, 0xCA, 0xFF, 0xFC, 0xAA, 0xFF, 0xFC,
+    0x9A, 0xFF, 0xFC, 0x0A, 0xEA, 0xFF, 0xA0, 0xAE, 0x2A, 0xFA, 0x1A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7,
+    0x2A, 0xE7, 0x29, 0xAA, 0xA7, 0x20, 0x0F, 0x5F, 0x19, 0xEA, 0x4F, 0x2F, 0x4A, 0xE2, 0x9E, 0xA3,
+    0xAE, 0x3F, 0x3A, 0xE3, 0xAE, 0xA2, 0xF4, 0xF2, 0xF4, 0xAE, 0xA1, 0xF5, 0xF0, 0xAE, 0xA5, 0xFF,
+    0xC9, 0x59, 0xFF, 0x7F, 0xEA, 0x7F, 0xE7, 0x0A, 0xFC, 0xA7, 0x09, 0xFC, 0x71, 0x9F, 0xA7, 0x2F,
+    0xA7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2A, 0xF7, 0x2A, 0xF9, 0x71, 0x9F, 0x97, 0x29, 0x60, 0x29, 0xAF,
+    0xCA, 0x99, 0x29, 0xFF, 0xE2, 0xFF, 0xF2, 0xF9, 0x99, 0xAF, 0x2F, 0x69, 0x29, 0xF9, 0x71, 0xAF,
+    0xA7, 0x1A, 0xFC, 0x97, 0x0A, 0xFC, 0x97, 0x0F, 0xD9, 0x5F, 0xFC, 0x93, 0xFF, 0xE2, 0xFF, 0xFC,
+    0x09, 0xFC, 0x29, 0xF9, 0x9F, 0x4A, 0xEA, 0xAF, 0x49, 0xFA, 0xF4, 0x9F, 0x9F, 0x93, 0xFA, 0x0F,
+    0xDA, 0xAF, 0xC9, 0x0A, 0xFF, 0xF2, 0xFF, 0xE4, 0xAF, 0xF6, 0x9A, 0xF9, 0x30, 0x29, 0xAC, 0xA6,
+    0xFD, 0x4D, 0x91, 0x9C, 0xA3, 0xD3, 0xAA, 0x3D, 0x97, 0x1F, 0x95, 0x9F, 0x95, 0xE7, 0x9D, 0x29,
+    0xD9, 0x19, 0xD3, 0xDA, 0x2E, 0x19, 0xDA, 0x2F, 0xF9, 0x29, 0xFD, 0xA5, 0xAE, 0x93, 0x19, 0xFF,
+    0xD2, 0x9F, 0xFD, 0x29, 0xFF, 0xD5, 0xAF, 0xA6, 0x9F, 0x96, 0x9F, 0x70, 0xF7, 0x0A, 0xE9, 0x70,
+    0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1A, 0xE9, 0x70, 0x9F, 0xA9, 0x7A, 0xFF, 0x59, 0xFF, 0x6A,
+    0xFD, 0x97, 0x9F, 0x97, 0x0F, 0x97, 0xFC, 0x7A, 0xFA, 0x6A, 0xFC, 0x69, 0xFC, 0x77, 0x10, 0x9E,
+    0xA7, 0x2A, 0xFA, 0x0A, 0xEA, 0x92, 0xAF, 0xFF, 0xA3, 0xAF, 0xFE, 0x92, 0xAF, 0xA9, 0x09, 0xF2,
+    0xAE, 0xA3, 0x9E, 0x2A, 0xE5, 0xE2, 0xAE, 0x5E, 0x91, 0xAE, 0x5E, 0x91, 0xF4, 0x9E, 0x91, 0xF4,
+    0x9E, 0x91, 0xF9, 0x39, 0xEA, 0x1F, 0x93, 0x9E, 0xA1, 0xF9, 0x39, 0xEA, 0x1F, 0xA3, 0xAE, 0xA1,
+    0xFA, 0x3A, 0xEA, 0x1A, 0xAA, 0xA9, 0x3A, 0xEA, 0x72, 0xAE, 0xA7, 0x2A, 0xF7, 0x2F, 0xC7, 0x2F,
+    0xC7, 0x2F, 0xC7, 0x70, 0x69, 0x72, 0xAF, 0xCA, 0x6F, 0xFC, 0x4F, 0x19, 0xEA, 0x2A, 0xE3, 0x9E,
+    0x2E, 0xA4, 0xEA, 0x1E, 0x94, 0xAE, 0x09, 0xE9, 0x4A, 0xE0, 0xAF, 0xFF, 0xC0, 0xAF, 0xFF, 0xC0,
+    0xAF, 0xFF, 0xC9, 0xAE, 0xA9, 0x99, 0x99, 0xF0, 0xAE, 0xA4, 0xF0, 0x9F, 0x39, 0xF0, 0x9F, 0xA2,
+    0xFC, 0x1F, 0xFF, 0xA1, 0xFF, 0xF9, 0x19, 0xFF, 0xE3, 0xAF, 0xFC, 0x94, 0xAF, 0xE9, 0x69, 0xAE,
+    0xA4, 0x09, 0x99, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x39, 0xE3, 0x9E, 0x39, 0xE9, 0x29, 0xE9,
+    0x29, 0xEA, 0x2A, 0xEA, 0x2A, 0xF2, 0xAF, 0xAA, 0x9F, 0xE9, 0xFE, 0x9F, 0xDA, 0x90, 0x1A, 0xD1,
+    0x9E, 0x4E, 0x1E, 0xA4, 0xE0, 0xAE, 0x5E, 0x0E, 0x95, 0xDA, 0xAD, 0xA6, 0xFD, 0x69, 0xFC, 0xA6,
+    0x9F, 0xC7, 0xAF, 0xA7, 0xAF, 0xC9, 0x6F, 0xE9, 0x5E, 0xAF, 0x94, 0xE0, 0xAF, 0xA3, 0xE1, 0xFC,
+    0xA2, 0xE2, 0xFC, 0xA0, 0x1A, 0xF9, 0x72, 0xAF, 0xD7, 0x1A, 0xFE, 0x70, 0xAF, 0xEA, 0x70, 0x99,
+    0xAF, 0xC7, 0x4F, 0x97, 0x39, 0xEA, 0x73, 0x9F, 0x73, 0xAF, 0x97, 0x2F, 0xCA, 0x71, 0xAF, 0xD7,
+    0x1F, 0xE9, 0x7A, 0xFE, 0xA7, 0xFA, 0xF6, 0x9F, 0x0A, 0xE6, 0xFA, 0x09, 0xE9, 0x49, 0xF2, 0xF4,
+    0xF9, 0x2A, 0xE3, 0x9F, 0x39, 0xE9, 0x2F, 0x94, 0xEA, 0x19, 0xF5, 0xF1, 0xF6, 0x9E, 0x90, 0x0A,
+    0xE5, 0xAE, 0x1A, 0xE5, 0xAE, 0x1A, 0xE5, 0xAE, 0x1A, 0xE9, 0x4A, 0xE1, 0xAE, 0x94, 0xAE, 0x1F,
+    0x94, 0xAE, 0x1F, 0xA4, 0xF9, 0x0F, 0xA4, 0xF9, 0x0F, 0xC4, 0xF9, 0x0F, 0xC4, 0xF9, 0x0F, 0xD9,
+    0x1F, 0xC9, 0x0F, 0xFF, 0xD9, 0x0F, 0xFF, 0xD9, 0x0F, 0xFF, 0xDA, 0x0F, 0xFF, 0xDA, 0x0E, 0x0A,
+    0xFA, 0x5E, 0x74, 0xE7, 0x4A, 0xAA, 0x73, 0x0F, 0x5F, 0x19, 0xEA, 0x4F, 0x2F, 0x4A, 0xE2, 0x9E,
+    0xA3, 0xAE, 0x3F, 0x3A, 0xE9, 0x2A, 0xEA, 0x2F, 0x4F, 0x2F, 0x4A, 0xEA, 0x1F, 0x5F, 0x0A, 0xEA,
+    0x5F, 0xFC, 0x95, 0x9F, 0xF7, 0xFE, 0xA7, 0xFE, 0x70, 0xAF, 0xD7, 0x09, 0xFC, 0xA7, 0x72, 0xAF,
+    0xFC, 0xA0, 0xAF, 0xFC, 0xA0, 0xAF, 0xFC, 0xA3, 0xFD, 0x4A, 0xFD, 0x93, 0xFE, 0x93, 0xFE, 0xA3,
+    0xFE, 0xA3, 0x9F, 0xE4, 0xFD, 0xA3, 0x9F, 0x99, 0x4F, 0x7F, 0x7A, 0xFD, 0x93, 0x9F, 0xEA, 0x39,
+    0xFE, 0x7A, 0xE9, 0x69, 0xEA, 0x6F, 0x95, 0xFC, 0x5F, 0xC9, 0x5F, 0xA7, 0x50, 0x4A, 0xF9, 0x6A,
+    0xFF, 0x4A, 0xFF, 0xD3, 0xF9, 0x1A, 0xEA, 0x1A, 0xE9, 0x3F, 0x1F, 0x49, 0xE9, 0x0E, 0xA5, 0xEA,
+    0x0E, 0xA5, 0xEA, 0x0E, 0xA5, 0xEA, 0x0F, 0x49, 0xE9, 0x0F, 0xA2, 0x9F, 0x90, 0xAF, 0xFF, 0x2F,
+    0xFE, 0xA2, 0xAF, 0xFD, 0x4A, 0xFF, 0x69, 0xAF, 0x93, 0x77, 0xAF, 0xFF, 0xDA, 0xAF, 0xFF, 0xDA,
+    0xAF, 0xFF, 0xDA, 0x2E, 0x91, 0xF4, 0x9E, 0x91, 0xEA, 0x49, 0xE9, 0x1E, 0xA4, 0x9E, 0x2E, 0x94,
+    0xAE, 0x19, 0xE9, 0x4A, 0xE1, 0x9E, 0x5A, 0xE1, 0xAE, 0x5F, 0x1A, 0xE9, 0x93, 0xF1, 0xFD, 0x92,
+    0xEA, 0x1F, 0xD9, 0x2A, 0xAA, 0x92, 0xAF, 0x10, 0x79, 0x99, 0x72, 0xAF, 0xCA, 0x7F, 0xFC, 0x5F,
+    0xC9, 0x9E, 0xA3, 0x9F, 0x3E, 0x3F, 0x5D, 0xA2, 0xF5, 0xDA, 0x19, 0xF5, 0xE1, 0xAF, 0x5E, 0x1F,
+    0xC5, 0xDA, 0x1F, 0xD9, 0x19, 0xEA, 0x1F, 0xFF, 0xC9, 0x09, 0xFF, 0xFC, 0x1A, 0xFF, 0xF9, 0x1A,
+    0xFF, 0xE9, 0x2F, 0xA0, 0xAE, 0xA4, 0xF9, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0xAF, 0x72, 0xAE, 0xA7,
+    0x20, 0x77, 0x09, 0xAA, 0xCA, 0x95, 0xFE, 0xA3, 0xFF, 0xD1, 0x9E, 0x91, 0x9E, 0x90, 0xAD, 0xA4,
+    0x99, 0x1A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xE7, 0x09, 0xE9, 0x70, 0xFA, 0x70, 0xFC, 0x79, 0xFA,
+    0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x70, 0xAE, 0x72, 0x99, 0x30, 0x4A, 0xFF, 0xE2, 0x9F, 0xFF,
+    0xC1, 0xAF, 0xFF, 0xD1, 0xF9, 0x1A, 0xEA, 0x3A, 0xE9, 0x3F, 0x3F, 0x49, 0xE9, 0x2E, 0xA5, 0xEA,
+    0x2E, 0xA5, 0xEA, 0x2E, 0xA5, 0xEA, 0x2F, 0x49, 0xE9, 0x2F, 0xA2, 0x9F, 0x92, 0xAF, 0xFF, 0x4F,
+    0xFE, 0xA4, 0xAF, 0xFD, 0x6A, 0xFF, 0x70, 0x9A, 0xF9, 0x50, 0x76, 0xAF, 0xFF, 0xC0, 0xAF, 0xFF,
+    0xC0, 0xAF, 0xFF, 0xC5, 0x9E, 0x97, 0x19, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2F, 0x72, 0xEA, 0x72,
+    0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xFD, 0x79, 0xFD, 0x70, 0x9F, 0xA3, 0xAD, 0xA1, 0xAE, 0x2A, 0xDA,
+    0x2E, 0xA1, 0xAD, 0xA2, 0x9E, 0x1A, 0xE3, 0xE9, 0x09, 0xE3, 0xAD, 0xA0, 0x9E, 0x39, 0xE0, 0x9E,
+    0x39, 0xE0, 0x9E, 0x39, 0xE1, 0xE4, 0xE1, 0xE9, 0x29, 0xE1, 0xF9, 0x99, 0xF1, 0xFF, 0xE1, 0xAF,
+    0xFC, 0xA2, 0xFF, 0xC9, 0x2A, 0xFE, 0xA4, 0x9A, 0xEA, 0x92, 0x70, 0xDA, 0x77, 0x09, 0xE7, 0x70,
+    0x9E, 0x77, 0x09, 0xDA, 0x77, 0x09, 0xDA, 0x76, 0x9A, 0xFC, 0xA7, 0x29, 0xFF, 0xDA, 0x7A, 0xFF,
+    0xFC, 0x5A, 0xFF, 0xFE, 0x4F, 0xC0, 0x9D, 0xA0, 0xAF, 0xA2, 0xFC, 0x19, 0xDA, 0x1A, 0xF2, 0xF9,
+    0x1A, 0xDA, 0x2F, 0xA0, 0x9F, 0x2A, 0xDA, 0x2A, 0xF0, 0xAE, 0xA2, 0xAD, 0xA2, 0x9F, 0x0F, 0xA2,
+    0xAD, 0xA2, 0x9F, 0x0F, 0x92, 0xAD, 0x93, 0xF9, 0xF9, 0x2A, 0xD9, 0x3F, 0x9F, 0xA2, 0xAD, 0x93,
+    0xF0, 0xFC, 0x2A, 0xD9, 0x29, 0xF0, 0xAF, 0xA1, 0xAD, 0x92, 0xFC, 0x0A, 0xFD, 0x9E, 0xA9, 0xAF,
+    0xD0, 0x9F, 0xFF, 0xFD, 0xA1, 0xFF, 0xFF, 0xD9, 0x19, 0xFF, 0xFF, 0xC3, 0xAF, 0xFF, 0xE9, 0x4A,
+    0xFF, 0xFC, 0x70, 0x9A, 0xFE, 0xA9, 0x74, 0xE7, 0x71, 0xE7, 0x71, 0xE7, 0x71, 0xE7, 0x71, 0xE7,
+    0x77, 0x60, 0x77, 0x5E, 0xA7, 0xAE, 0x3F, 0xCA, 0x49, 0xEA, 0x3F, 0xE3, 0xF4, 0xFE, 0xA1, 0xF9,
+    0x59, 0xAF, 0xC9, 0xAE, 0xA7, 0x1F, 0xFC, 0x73, 0xFE, 0x97, 0x3A, 0xFD, 0x75, 0xFC, 0x76, 0xFC,
+    0x75, 0xFD, 0x97, 0x3A, 0xFE, 0x73, 0xFF, 0x97, 0x1F, 0xFD, 0x70, 0xAF, 0xA9, 0xFA, 0x69, 0xFC,
+    0x1F, 0xF9, 0x2F, 0xC9, 0x1A, 0xFE, 0x91, 0xFC, 0xA3, 0xFE, 0x90, 0xAF, 0xC4, 0x9F, 0xD9, 0x0A,
+    0xAA, 0xAA, 0x96, 0x9A, 0xAA, 0xA0, 0x49, 0x97, 0x4D, 0x97, 0x3D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA6,
+    0xAD, 0xA0, 0xDA, 0x0E, 0x2A, 0xDA, 0x0A, 0xD0, 0xAD, 0x91, 0xAD, 0xA0, 0xAD, 0x09, 0xE1, 0xAE,
+    0x0A, 0xD1, 0xE1, 0x9E, 0x09, 0xD1, 0xE9, 0x09, 0xE0, 0x9D, 0x1A, 0xDA, 0x09, 0xE0, 0x9D, 0x1A,
+    0xE0, 0x9E, 0x09, 0xD1, 0x9E, 0x1E, 0x90, 0xD1, 0x9E, 0x1E, 0xA0, 0xD9, 0x0A, 0xE1, 0xFF, 0xFC,
+    0x1A, 0xFF, 0xEA, 0x2F, 0xFE, 0x92, 0xAF, 0xFC, 0xA4, 0x9F, 0xE9, 0x70, 0xE7, 0x3A, 0xD7, 0x3A,
+    0xD7, 0x3A, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x4A, 0x95, 0x39, 0xAA, 0xA9, 0x3A, 0xAA,
+    0xA5, 0x9E, 0xA4, 0xAE, 0x94, 0xF6, 0xF3, 0xAE, 0x96, 0xAE, 0x3F, 0x70, 0xE9, 0x19, 0xEA, 0x19,
+    0xD3, 0xE9, 0x1A, 0xE9, 0x1A, 0xD3, 0xEA, 0x1A, 0xE2, 0xAD, 0x3E, 0xA1, 0xAE, 0x2A, 0xD3, 0xE9,
+    0x19, 0xEA, 0x1A, 0xDA, 0x1F, 0x3F, 0xCA, 0xFF, 0xD3, 0xAF, 0xFF, 0xD9, 0x4F, 0xFF, 0xCA, 0x69,
+    0xEA, 0x09, 0xEA, 0x97, 0x77, 0x70, 0xF7, 0x71, 0xFA, 0x77, 0xAF, 0xC7, 0x7F, 0xD9, 0x75, 0x9F,
+    0xDA, 0x75, 0xFA, 0xE7, 0x5E, 0xA9, 0xEA, 0x73, 0xAE, 0x90, 0xF7, 0x3F, 0x1A, 0xE9, 0x71, 0x9E,
+    0xA1, 0x9E, 0xA7, 0x1F, 0x92, 0xF7, 0x1F, 0x3F, 0xA7, 0xAF, 0x39, 0xF7, 0xFC, 0xAA, 0xAA, 0xAF,
+    0x95, 0x9F, 0xFF, 0xDA, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xFC, 0x3F, 0xC7, 0xFC,
+    0x91, 0x9F, 0xC7, 0xAF, 0xA1, 0xFC, 0x97, 0x9F, 0xC7, 0x77, 0x79, 0x99, 0x97, 0x71, 0xF7, 0x71,
+    0xF9, 0x77, 0x0F, 0x97, 0x79, 0xFA, 0x77, 0xAF, 0xA7, 0x77, 0x29, 0xEA, 0x97, 0xFF, 0xD3, 0xAF,
+    0xFD, 0x3E, 0x91, 0x9F, 0x29, 0xDA, 0x3A, 0xE9, 0x1E, 0x5E, 0x91, 0xE5, 0xEA, 0x1D, 0xA5, 0xEA,
+    0x1D, 0x95, 0xAE, 0x1D, 0x95, 0xAE, 0x1D, 0xA5, 0xF1, 0xFA, 0xAA, 0xFD, 0x1A, 0xFF, 0xF2, 0xFF,
+    0xF9, 0x19, 0xFF, 0xE9, 0x3A, 0xEA, 0x97, 0x77, 0x77, 0x77, 0x99, 0x97, 0x2A, 0xE9, 0x71, 0xFA,
+    0x71, 0xFA, 0x71, 0xFC, 0x70, 0x9F, 0xC4, 0x71, 0xAA, 0x97, 0x72, 0xEA, 0x77, 0x3A, 0xC7, 0x72,
+    0xAC, 0xA7, 0x71, 0xAC, 0xA7, 0x73, 0x97, 0x77, 0x77, 0x77, 0x77, 0x74, 0xF7, 0x71, 0xFA, 0x77,
+    0xAF, 0xC7, 0x7F, 0xD9, 0x75, 0x9F, 0xDA, 0x75, 0xFA, 0xE7, 0x5E, 0xA9, 0xEA, 0x73, 0xAE, 0x90,
+    0xF7, 0x3F, 0x1A, 0xE9, 0x71, 0x9E, 0xA1, 0x9E, 0xA7, 0x1F, 0x92, 0xF7, 0x1F, 0x3F, 0xA7, 0xAF,
+    0x39, 0xF7, 0xFC, 0xAA, 0xAA, 0xAF, 0x95, 0x9F, 0xFF, 0xDA, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xA3,
+    0xAF, 0xFF, 0xFC, 0x3F, 0xC7, 0xFC, 0x91, 0x9F, 0xC7, 0xAF, 0xA1, 0xFC, 0x97, 0x9F, 0xC0, 0x59,
+    0xAA, 0x73, 0x9E, 0x74, 0x9C, 0x97, 0x29, 0xD7, 0x3C, 0xA7, 0x77, 0x77, 0x77, 0x75, 0x9E, 0xA9,
+    0x7F, 0xFD, 0x3A, 0xFF, 0xD3, 0xE9, 0x19, 0xF2, 0x9D, 0xA3, 0xAE, 0x91, 0xE5, 0xE9, 0x1E, 0x5E,
+    0xA1, 0xDA, 0x5E, 0xA1, 0xD9, 0x5A, 0xE1, 0xD9, 0x5A, 0xE1, 0xDA, 0x5F, 0x1F, 0xAA, 0xAF, 0xD1,
+    0xAF, 0xFF, 0x2F, 0xFF, 0x91, 0x9F, 0xFE, 0x93, 0xAE, 0xA9, 0x40, 0x72, 0xDA, 0x77, 0x1A, 0xD9,
+    0x77, 0x1E, 0x77, 0x1A, 0xDA, 0x77, 0x1E, 0x97, 0x77, 0x77, 0x77, 0x77, 0x74, 0xAD, 0x77, 0x19,
+    0xF7, 0x79, 0xFC, 0xA7, 0x59, 0xFE, 0xA7, 0x39, 0xE9, 0x09, 0xEA, 0x71, 0x9E, 0x4A, 0xDA, 0x77,
+    0x77, 0x77, 0x70, 0xF7, 0x71, 0xFA, 0x77, 0xAF, 0xC7, 0x7F, 0xD9, 0x75, 0x9F, 0xDA, 0x75, 0xFA,
+    0xE7, 0x5E, 0xA9, 0xEA, 0x73, 0xAE, 0x90, 0xF7, 0x3F, 0x1A, 0xE9, 0x71, 0x9E, 0xA1, 0x9E, 0xA7,
+    0x1F, 0x92, 0xF7, 0x1F, 0x3F, 0xA7, 0xAF, 0x39, 0xF7, 0xFC, 0xAA, 0xAA, 0xAF, 0x95, 0x9F, 0xFF,
+    0xDA, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xFC, 0x3F, 0xC7, 0xFC, 0x91, 0x9F, 0xC7,
+    0xAF, 0xA1, 0xFC, 0x97, 0x9F, 0xC0, 0x74, 0xDA, 0x73, 0xAD, 0x74, 0xE7, 0xD9, 0x0A, 0xDA, 0x6A,
+    0xE9, 0xE6, 0xAF, 0xC7, 0x0A, 0xFE, 0x6A, 0xE9, 0x0A, 0xE4, 0xAD, 0xA3, 0x9E, 0x77, 0x77, 0x77,
+    0x59, 0xEA, 0x97, 0x0F, 0xFD, 0x4A, 0xFF, 0xD4, 0xE9, 0x19, 0xF3, 0x9D, 0xA3, 0xAE, 0x92, 0xE5,
+    0xE9, 0x2E, 0x5E, 0xA2, 0xDA, 0x5E, 0xA2, 0xD9, 0x5A, 0xE2, 0xD9, 0x5A, 0xE2, 0xDA, 0x5F, 0x2F,
+    0xAA, 0xAF, 0xD2, 0xAF, 0xFF, 0x3F, 0xFF, 0x92, 0x9F, 0xFE, 0x94, 0xAE, 0xA9, 0x50, 0x0F, 0x77,
+    0x4F, 0x97, 0x73, 0xF9, 0x77, 0x3F, 0xA2, 0xAD, 0x76, 0x99, 0x99, 0x09, 0xF7, 0x71, 0x9F, 0xCA,
+    0x77, 0x9F, 0xEA, 0x75, 0x9E, 0x90, 0x9E, 0xA7, 0x39, 0xE4, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x6F,
+    0x77, 0x3F, 0xA7, 0x71, 0xAF, 0xC7, 0x71, 0xFD, 0x97, 0x79, 0xFD, 0xA7, 0x7F, 0xAE, 0x77, 0xEA,
+    0x9E, 0xA7, 0x5A, 0xE9, 0x0F, 0x75, 0xF1, 0xAE, 0x97, 0x39, 0xEA, 0x19, 0xEA, 0x73, 0xF9, 0x2F,
+    0x73, 0xF3, 0xFA, 0x71, 0xAF, 0x39, 0xF7, 0x1F, 0xCA, 0xAA, 0xAA, 0xF9, 0x79, 0xFF, 0xFD, 0xA7,
+    0xFF, 0xFF, 0x7F, 0xFF, 0xFA, 0x5A, 0xFF, 0xFF, 0xC5, 0xFC, 0x7F, 0xC9, 0x39, 0xFC, 0x7A, 0xFA,
+    0x3F, 0xC9, 0x79, 0xFC, 0x00, 0x0A, 0xE9, 0x77, 0x1A, 0xEA, 0x77, 0x1A, 0xF7, 0x71, 0xAF, 0x97,
+    0x72, 0x99, 0x97, 0x77, 0x1D, 0xA7, 0x71, 0xF9, 0x77, 0xFD, 0x97, 0x5F, 0xF9, 0x73, 0xF1, 0xAE,
+    0x97, 0x1E, 0xA3, 0x9E, 0x97, 0x77, 0x77, 0x76, 0x9E, 0xA9, 0x76, 0xFF, 0xD7, 0x2A, 0xFF, 0xD7,
+    0x2E, 0x91, 0x9F, 0x71, 0x9D, 0xA3, 0xAE, 0x97, 0x0E, 0x5E, 0x97, 0x0E, 0x5E, 0xA7, 0x0D, 0xA5,
+    0xEA, 0x70, 0xD9, 0x5A, 0xE7, 0x0D, 0x95, 0xAE, 0x70, 0xDA, 0x5F, 0x70, 0xFA, 0xAA, 0xFD, 0x70,
+    0xAF, 0xFF, 0x71, 0xFF, 0xF9, 0x70, 0x9F, 0xFE, 0x97, 0x2A, 0xEA, 0x94, 0x71, 0xAA, 0x97, 0x72,
+    0xEA, 0x77, 0x3A, 0xC7, 0x72, 0x9C, 0xA7, 0x71, 0x9C, 0xA7, 0x72, 0x9A, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x5A, 0xD7, 0x71, 0x9F, 0x77, 0x9F, 0xCA, 0x75, 0x9F, 0xEA, 0x73, 0x9E, 0x90, 0x9E, 0xA7,
+    0x19, 0xE4, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x0F, 0x77, 0x1F, 0xA7, 0x7A, 0xFC, 0x77, 0xFD, 0x97,
+    0x59, 0xFD, 0xA7, 0x5F, 0xAE, 0x75, 0xEA, 0x9E, 0xA7, 0x3A, 0xE9, 0x0F, 0x73, 0xF1, 0xAE, 0x97,
+    0x19, 0xEA, 0x19, 0xEA, 0x71, 0xF9, 0x2F, 0x71, 0xF3, 0xFA, 0x7A, 0xF3, 0x9F, 0x7F, 0xCA, 0xAA,
+    0xAA, 0xF9, 0x59, 0xFF, 0xFD, 0xA5, 0xFF, 0xFF, 0x5F, 0xFF, 0xFA, 0x3A, 0xFF, 0xFF, 0xC3, 0xFC,
+    0x7F, 0xC9, 0x19, 0xFC, 0x7A, 0xFA, 0x1F, 0xC9, 0x79, 0xFC, 0x00, 0x77, 0x73, 0x9E, 0x97, 0x39,
+    0xF7, 0x69, 0xC9, 0x74, 0x9D, 0x74, 0xAD, 0x96, 0x9D, 0x2D, 0x97, 0xEA, 0x73, 0xFC, 0xA7, 0x1F,
+    0xEA, 0x7F, 0x09, 0xEA, 0x5E, 0x93, 0xEA, 0x77, 0x77, 0x70, 0x9E, 0xA9, 0x71, 0xFF, 0xD5, 0xAF,
+    0xFD, 0x5E, 0x91, 0x9F, 0x49, 0xDA, 0x3A, 0xE9, 0x3E, 0x5E, 0x93, 0xE5, 0xEA, 0x3D, 0xA5, 0xEA,
+    0x3D, 0x95, 0xAE, 0x3D, 0x95, 0xAE, 0x3D, 0xA5, 0xF3, 0xFA, 0xAA, 0xFD, 0x3A, 0xFF, 0xF4, 0xFF,
+    0xF9, 0x39, 0xFF, 0xE9, 0x5A, 0xEA, 0x96, 0x70, 0x92, 0x99, 0x75, 0x9E, 0x90, 0xAC, 0xA7, 0x4F,
+    0xC9, 0xAC, 0xA7, 0x4D, 0x0F, 0xC9, 0x73, 0x9D, 0x1F, 0x75, 0xAA, 0x29, 0xA7, 0x77, 0x77, 0x77,
+    0x49, 0xDA, 0x77, 0x1F, 0x77, 0x0F, 0xD7, 0x6F, 0xF7, 0x4F, 0x1A, 0xE7, 0x2E, 0x93, 0x9E, 0x77,
+    0x77, 0x3F, 0x77, 0x1F, 0xA7, 0x7A, 0xFC, 0x77, 0xFD, 0x97, 0x59, 0xFD, 0xA7, 0x5F, 0xAE, 0x75,
+    0xEA, 0x9E, 0xA7, 0x3A, 0xE9, 0x0F, 0x73, 0xF1, 0xAE, 0x97, 0x19, 0xEA, 0x19, 0xEA, 0x71, 0xF9,
+    0x2F, 0x71, 0xF3, 0xFA, 0x7A, 0xF3, 0x9F, 0x7F, 0xCA, 0xAA, 0xAA, 0xF9, 0x59, 0xFF, 0xFD, 0xA5,
+    0xFF, 0xFF, 0x5F, 0xFF, 0xFA, 0x3A, 0xFF, 0xFF, 0xC3, 0xFC, 0x7F, 0xC9, 0x19, 0xFC, 0x7A, 0xFA,
+    0x1F, 0xC9, 0x79, 0xFC, 0x00, 0x3A, 0xD9, 0x1D, 0x59, 0xF9, 0x0D, 0x5A, 0xDA, 0xDA, 0xD5, 0xAC,
+    0xA0, 0xFC, 0x5A, 0xD1, 0xAD, 0x77, 0x77, 0x7A, 0xD7, 0x29, 0xEA, 0x70, 0x9F, 0xC9, 0x69, 0xFE,
+    0x94, 0x9E, 0xA0, 0xAE, 0x92, 0x9E, 0x93, 0xE9, 0x77, 0x39, 0xEA, 0x97, 0xFF, 0xD3, 0xAF, 0xFD,
+    0x3E, 0x91, 0x9F, 0x29, 0xDA, 0x3A, 0xE9, 0x1E, 0x5E, 0x91, 0xE5, 0xEA, 0x1D, 0xA5, 0xEA, 0x1D,
+    0x95, 0xAE, 0x1D, 0x95, 0xAE, 0x1D, 0xA5, 0xF1, 0xFA, 0xAA, 0xFD, 0x1A, 0xFF, 0xF2, 0xFF, 0xF9,
+    0x19, 0xFF, 0xE9, 0x3A, 0xEA, 0x94, 0x77, 0x77, 0xAD, 0x77, 0x19, 0xF7, 0x79, 0xFC, 0xA7, 0x59,
+    0xFE, 0xA7, 0x39, 0xE9, 0x09, 0xEA, 0x71, 0x9E, 0x4A, 0xDA, 0x77, 0x77, 0x77, 0x70, 0xF7, 0x71,
+    0xFA, 0x77, 0xAF, 0xC7, 0x7F, 0xD9, 0x75, 0x9F, 0xDA, 0x75, 0xFA, 0xE7, 0x5E, 0xA9, 0xEA, 0x73,
+    0xAE, 0x90, 0xF7, 0x3F, 0x1A, 0xE9, 0x71, 0x9E, 0xA1, 0x9E, 0xA7, 0x1F, 0x92, 0xF7, 0x1F, 0x3F,
+    0xA7, 0xAF, 0x39, 0xF7, 0xFC, 0xAA, 0xAA, 0xAF, 0x95, 0x9F, 0xFF, 0xDA, 0x5F, 0xFF, 0xF5, 0xFF,
+    0xFF, 0xA3, 0xAF, 0xFF, 0xFC, 0x3F, 0xC7, 0xFC, 0x91, 0x9F, 0xC7, 0xAF, 0xA1, 0xFC, 0x97, 0x9F,
+    0xC7, 0x77, 0x79, 0x99, 0x97, 0x71, 0xF7, 0x71, 0xF9, 0x77, 0x0F, 0x97, 0x79, 0xFA, 0x77, 0xAF,
+    0xA7, 0x77, 0x5D, 0xA7, 0x2F, 0x97, 0x0F, 0xD9, 0x6F, 0xF9, 0x4F, 0x1A, 0xE9, 0x2E, 0xA3, 0x9E,
+    0x97, 0x77, 0x71, 0x9E, 0xA9, 0x7F, 0xFD, 0x3A, 0xFF, 0xD3, 0xE9, 0x19, 0xF2, 0x9D, 0xA3, 0xAE,
+    0x91, 0xE5, 0xE9, 0x1E, 0x5E, 0xA1, 0xDA, 0x5E, 0xA1, 0xD9, 0x5A, 0xE1, 0xD9, 0x5A, 0xE1, 0xDA,
+    0x5F, 0x1F, 0xAA, 0xAF, 0xD1, 0xAF, 0xFF, 0x2F, 0xFF, 0x91, 0x9F, 0xFE, 0x93, 0xAE, 0xA9, 0x77,
+    0x77, 0x77, 0x79, 0x99, 0x72, 0xAE, 0x97, 0x1F, 0xA7, 0x1F, 0xA7, 0x1F, 0xC7, 0x09, 0xFC, 0x40,
+    0x72, 0xDA, 0x77, 0x1A, 0xD9, 0x77, 0x1E, 0x77, 0x19, 0xDA, 0x77, 0x1E, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x75, 0x9E, 0x92, 0xAE, 0x72, 0xFF, 0xDA, 0x72, 0xFF, 0xD7, 0x39, 0xFF, 0x97, 0x5A,
+    0xEA, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x72, 0xF7, 0x71, 0xFA, 0x77, 0xAF, 0xC7, 0x7F, 0xD9, 0x75,
+    0x9F, 0xDA, 0x75, 0xFA, 0xE7, 0x5E, 0xA9, 0xEA, 0x73, 0xAE, 0x90, 0xF7, 0x3F, 0x1A, 0xE9, 0x71,
+    0x9E, 0xA1, 0x9E, 0xA7, 0x1F, 0x92, 0xF7, 0x1F, 0x3F, 0xA7, 0xAF, 0x39, 0xF7, 0xFC, 0xAA, 0xAA,
+    0xAF, 0x95, 0x9F, 0xFF, 0xDA, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xFC, 0x3F, 0xC7,
+    0xFC, 0x91, 0x9F, 0xC7, 0xAF, 0xA1, 0xFC, 0x97, 0x9F, 0xC0, 0x6A, 0xD7, 0x3E, 0x72, 0x9D, 0xA7,
+    0x2E, 0x72, 0x9E, 0x77, 0x77, 0x77, 0x77, 0x3E, 0x93, 0xE9, 0x2A, 0xFA, 0xFC, 0x39, 0xFF, 0xCA,
+    0x4A, 0xFF, 0x69, 0xAE, 0xA9, 0x77, 0x77, 0x77, 0x49, 0xEA, 0x97, 0xFF, 0xD3, 0xAF, 0xFD, 0x3E,
+    0x91, 0x9F, 0x29, 0xDA, 0x3A, 0xE9, 0x1E, 0x5E, 0x91, 0xE5, 0xEA, 0x1D, 0xA5, 0xEA, 0x1D, 0x95,
+    0xAE, 0x1D, 0x95, 0xAE, 0x1D, 0xA5, 0xF1, 0xFA, 0xAA, 0xFD, 0x1A, 0xFF, 0xF2, 0xFF, 0xF9, 0x19,
+    0xFF, 0xE9, 0x3A, 0xEA, 0x94, 0x59, 0xEA, 0x77, 0x19, 0xEA, 0x77, 0x19, 0xF7, 0x71, 0x9F, 0x97,
+    0x72, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9E, 0x92, 0xAE, 0x72, 0xFF, 0xDA, 0x72,
+    0xFF, 0xD7, 0x39, 0xFF, 0x97, 0x5A, 0xEA, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x72, 0xF7, 0x71, 0xFA,
+    0x77, 0xAF, 0xC7, 0x7F, 0xD9, 0x75, 0x9F, 0xDA, 0x75, 0xFA, 0xE7, 0x5E, 0xA9, 0xEA, 0x73, 0xAE,
+    0x90, 0xF7, 0x3F, 0x1A, 0xE9, 0x71, 0x9E, 0xA1, 0x9E, 0xA7, 0x1F, 0x92, 0xF7, 0x1F, 0x3F, 0xA7,
+    0xAF, 0x39, 0xF7, 0xFC, 0xAA, 0xAA, 0xAF, 0x95, 0x9F, 0xFF, 0xDA, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF,
+    0xA3, 0xAF, 0xFF, 0xFC, 0x3F, 0xC7, 0xFC, 0x91, 0x9F, 0xC7, 0xAF, 0xA1, 0xFC, 0x97, 0x9F, 0xC0,
+    0x2F, 0x73, 0xF9, 0x72, 0xFA, 0x72, 0xFC, 0x73, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x0E, 0xA3,
+    0xE9, 0x2A, 0xFA, 0xFC, 0x39, 0xFF, 0xCA, 0x4A, 0xFF, 0x69, 0xAE, 0xA9, 0x77, 0x77, 0x77, 0x49,
+    0xEA, 0x97, 0xFF, 0xD3, 0xAF, 0xFD, 0x3E, 0x91, 0x9F, 0x29, 0xDA, 0x3A, 0xE9, 0x1E, 0x5E, 0x91,
+    0xE5, 0xEA, 0x1D, 0xA5, 0xEA, 0x1D, 0x95, 0xAE, 0x1D, 0x95, 0xAE, 0x1D, 0xA5, 0xF1, 0xFA, 0xAA,
+    0xFD, 0x1A, 0xFF, 0xF2, 0xFF, 0xF9, 0x19, 0xFF, 0xE9, 0x3A, 0xEA, 0x94, 0x71, 0xAA, 0x97, 0x72,
+    0xEA, 0x77, 0x3A, 0xC7, 0x72, 0xAC, 0xA7, 0x71, 0xAC, 0xA7, 0x72, 0x9A, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x69, 0xE9, 0x2A, 0xE7, 0x2F, 0xFD, 0xA7, 0x2F, 0xFD, 0x73, 0x9F, 0xF9, 0x75, 0xAE,
+    0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2F, 0x77, 0x1F, 0xA7, 0x7A, 0xFC, 0x77, 0xFD, 0x97, 0x59,
+    0xFD, 0xA7, 0x5F, 0xAE, 0x75, 0xEA, 0x9E, 0xA7, 0x3A, 0xE9, 0x0F, 0x73, 0xF1, 0xAE, 0x97, 0x19,
+    0xEA, 0x19, 0xEA, 0x71, 0xF9, 0x2F, 0x71, 0xF3, 0xFA, 0x7A, 0xF3, 0x9F, 0x7F, 0xCA, 0xAA, 0xAA,
+    0xF9, 0x59, 0xFF, 0xFD, 0xA5, 0xFF, 0xFF, 0x5F, 0xFF, 0xFA, 0x3A, 0xFF, 0xFF, 0xC3, 0xFC, 0x7F,
+    0xC9, 0x19, 0xFC, 0x7A, 0xFA, 0x1F, 0xC9, 0x79, 0xFC, 0x00, 0x77, 0x4E, 0xA7, 0x2F, 0xC7, 0x19,
+    0x99, 0xD7, 0x39, 0xD7, 0x2A, 0xD7, 0x2A, 0xD9, 0x73, 0x97, 0x77, 0x77, 0x77, 0x74, 0xE9, 0x3E,
+    0x3A, 0xFA, 0xFC, 0x3A, 0xFF, 0xCA, 0x4F, 0xFC, 0x69, 0xFA, 0x97, 0x77, 0x75, 0x9E, 0xA9, 0x7F,
+    0xFD, 0x3A, 0xFF, 0xD3, 0xE9, 0x19, 0xF2, 0x9D, 0xA3, 0xAE, 0x91, 0xE5, 0xE9, 0x1E, 0x5E, 0xA1,
+    0xDA, 0x5E, 0xA1, 0xD9, 0x5A, 0xE1, 0xD9, 0x5A, 0xE1, 0xDA, 0x5F, 0x1F, 0xAA, 0xAF, 0xD1, 0xAF,
+    0xFF, 0x2F, 0xFF, 0x91, 0x9F, 0xFE, 0x93, 0xAE, 0xA9, 0x40, 0x70, 0x92, 0x99, 0x75, 0x9E, 0x90,
+    0xAC, 0xA7, 0x4F, 0xC9, 0xAC, 0xA7, 0x4D, 0x0F, 0xC9, 0x73, 0x9D, 0x1F, 0x75, 0xAA, 0x29, 0xA7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9E, 0x92, 0xAE, 0x72, 0xFF, 0xDA, 0x72, 0xFF, 0xD7, 0x39,
+    0xFF, 0x97, 0x5A, 0xEA, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x72, 0xF7, 0x71, 0xFA, 0x77, 0xAF, 0xC7,
+    0x7F, 0xD9, 0x75, 0x9F, 0xDA, 0x75, 0xFA, 0xE7, 0x5E, 0xA9, 0xEA, 0x73, 0xAE, 0x90, 0xF7, 0x3F,
+    0x1A, 0xE9, 0x71, 0x9E, 0xA1, 0x9E, 0xA7, 0x1F, 0x92, 0xF7, 0x1F, 0x3F, 0xA7, 0xAF, 0x39, 0xF7,
+    0xFC, 0xAA, 0xAA, 0xAF, 0x95, 0x9F, 0xFF, 0xDA, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF,
+    0xFC, 0x3F, 0xC7, 0xFC, 0x91, 0x9F, 0xC7, 0xAF, 0xA1, 0xFC, 0x97, 0x9F, 0xC0, 0x49, 0x92, 0x99,
+    0x6F, 0x1D, 0x59, 0xFA, 0x0D, 0x5A, 0xCA, 0x9F, 0xC5, 0xDA, 0x0A, 0xEA, 0x59, 0xA9, 0x19, 0xA9,
+    0x77, 0x77, 0x77, 0x77, 0x1E, 0xA3, 0xE9, 0x2A, 0xFA, 0xFC, 0x39, 0xFF, 0xCA, 0x4A, 0xFF, 0x69,
+    0xAE, 0xA9, 0x77, 0x77, 0x77, 0x49, 0xEA, 0x97, 0xFF, 0xD3, 0xAF, 0xFD, 0x3E, 0x91, 0x9F, 0x29,
+    0xDA, 0x3A, 0xE9, 0x1E, 0x5E, 0x91, 0xE5, 0xEA, 0x1D, 0xA5, 0xEA, 0x1D, 0x95, 0xAE, 0x1D, 0x95,
+    0xAE, 0x1D, 0xA5, 0xF1, 0xFA, 0xAA, 0xFD, 0x1A, 0xFF, 0xF2, 0xFF, 0xF9, 0x19, 0xFF, 0xE9, 0x3A,
+    0xEA, 0x94, 0x77, 0x72, 0x9E, 0x92, 0xAE, 0x72, 0xFF, 0xDA, 0x72, 0xFF, 0xD7, 0x39, 0xFF, 0x97,
+    0x5A, 0xEA, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x72, 0xF7, 0x71, 0xFA, 0x77, 0xAF, 0xC7, 0x7F, 0xD9,
+    0x75, 0x9F, 0xDA, 0x75, 0xFA, 0xE7, 0x5E, 0xA9, 0xEA, 0x73, 0xAE, 0x90, 0xF7, 0x3F, 0x1A, 0xE9,
+    0x71, 0x9E, 0xA1, 0x9E, 0xA7, 0x1F, 0x92, 0xF7, 0x1F, 0x3F, 0xA7, 0xAF, 0x39, 0xF7, 0xFC, 0xAA,
+    0xAA, 0xAF, 0x95, 0x9F, 0xFF, 0xDA, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xFC, 0x3F,
+    0xC7, 0xFC, 0x91, 0x9F, 0xC7, 0xAF, 0xA1, 0xFC, 0x97, 0x9F, 0xC7, 0x77, 0x79, 0x99, 0x97, 0x71,
+    0xF7, 0x71, 0xF9, 0x77, 0x0F, 0x97, 0x79, 0xFA, 0x77, 0xAF, 0xA7, 0x77, 0x0E, 0xA3, 0xE9, 0x2A,
+    0xFA, 0xFC, 0x39, 0xFF, 0xCA, 0x4A, 0xFF, 0x69, 0xAE, 0xA9, 0x77, 0x77, 0x77, 0x49, 0xEA, 0x97,
+    0xFF, 0xD3, 0xAF, 0xFD, 0x3E, 0x91, 0x9F, 0x29, 0xDA, 0x3A, 0xE9, 0x1E, 0x5E, 0x91, 0xE5, 0xEA,
+    0x1D, 0xA5, 0xEA, 0x1D, 0x95, 0xAE, 0x1D, 0x95, 0xAE, 0x1D, 0xA5, 0xF1, 0xFA, 0xAA, 0xFD, 0x1A,
+    0xFF, 0xF2, 0xFF, 0xF9, 0x19, 0xFF, 0xE9, 0x3A, 0xEA, 0x97, 0x77, 0x77, 0x77, 0x99, 0x97, 0x2A,
+    0xE9, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFC, 0x70, 0x9F, 0xC4, 0x0A, 0xAA, 0xAA, 0xAF, 0xE9, 0x9F,
+    0xFF, 0xC0, 0x9F, 0xFF, 0xC0, 0x9F, 0xFA, 0xAA, 0xA9, 0x09, 0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xEA,
+    0x71, 0x9E, 0xA7, 0x1A, 0xFA, 0xAA, 0xE9, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9,
+    0x2A, 0xF7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7, 0x1F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xD0,
+    0xFF, 0xFD, 0x0F, 0xFF, 0xD9, 0xFF, 0xFD, 0xAF, 0xFF, 0xE7, 0x77, 0x77, 0x77, 0x71, 0x99, 0x99,
+    0x71, 0x9E, 0xA7, 0x1A, 0xF7, 0x1A, 0xF7, 0x1F, 0xC7, 0x1F, 0xC4, 0x4A, 0xEA, 0x96, 0x9F, 0xF5,
+    0xFA, 0xAF, 0x3E, 0xA3, 0xAD, 0x91, 0x9E, 0x90, 0x99, 0x99, 0xE1, 0xAF, 0xFF, 0x1F, 0xFF, 0xC9,
+    0x0F, 0xFF, 0xC9, 0x0E, 0xAA, 0x99, 0x96, 0xEA, 0x72, 0xF9, 0x71, 0xAF, 0xC9, 0x91, 0x9A, 0xC9,
+    0x1F, 0xFF, 0x91, 0x9F, 0xFE, 0x92, 0x9F, 0xFD, 0x5A, 0xAF, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x49,
+    0x99, 0x72, 0x9E, 0xA7, 0x1A, 0xEA, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x30, 0x5A, 0xA9, 0x73,
+    0xF7, 0x49, 0xC7, 0x39, 0xCA, 0x72, 0x9D, 0x74, 0x97, 0x77, 0x77, 0x77, 0x73, 0xAA, 0xAA, 0xAA,
+    0xFE, 0x99, 0xFF, 0xFC, 0x09, 0xFF, 0xFC, 0x09, 0xFF, 0xAA, 0xAA, 0x90, 0x9E, 0xA7, 0x19, 0xEA,
+    0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0xAF, 0xAA, 0xAE, 0x92, 0xAF, 0xFD, 0x92, 0xAF, 0xFD, 0x92,
+    0xAF, 0xFD, 0x92, 0xAF, 0x71, 0xAE, 0xA7, 0x1A, 0xEA, 0x71, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x90,
+    0xFF, 0xFD, 0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x9F, 0xFF, 0xDA, 0xFF, 0xFE, 0x59, 0xD9, 0x72, 0x9E,
+    0x97, 0x4C, 0x97, 0x29, 0xD7, 0x3D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xEA, 0x96,
+    0x9F, 0xF5, 0xFA, 0xAF, 0x3E, 0xA3, 0xAD, 0x91, 0x9E, 0x90, 0x99, 0x99, 0xE1, 0xAF, 0xFF, 0x1F,
+    0xFF, 0xC9, 0x0F, 0xFF, 0xC9, 0x0E, 0xAA, 0x99, 0x96, 0xEA, 0x72, 0xF9, 0x71, 0xAF, 0xC9, 0x91,
+    0x9A, 0xC9, 0x1F, 0xFF, 0x91, 0x9F, 0xFE, 0x92, 0x9F, 0xFD, 0x5A, 0xAF, 0xA9, 0x10, 0x49, 0x92,
+    0x99, 0x59, 0xEA, 0x09, 0xD5, 0xFC, 0x99, 0xD5, 0xD9, 0xAF, 0xA5, 0xD9, 0x0F, 0x95, 0x9A, 0x91,
+    0x9A, 0x97, 0x77, 0x77, 0x77, 0x70, 0xAA, 0xAA, 0xAA, 0xFE, 0x99, 0xFF, 0xFC, 0x09, 0xFF, 0xFC,
+    0x09, 0xFF, 0xAA, 0xAA, 0x90, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0xAF,
+    0xAA, 0xAE, 0x92, 0xAF, 0xFD, 0x92, 0xAF, 0xFD, 0x92, 0xAF, 0xFD, 0x92, 0xAF, 0x71, 0xAE, 0xA7,
+    0x1A, 0xEA, 0x71, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xFD, 0x0F, 0xFF, 0xD0, 0xFF, 0xFD,
+    0x9F, 0xFF, 0xDA, 0xFF, 0xFE, 0x39, 0xDA, 0x1D, 0x6F, 0xA0, 0xD5, 0x9D, 0xAD, 0xAD, 0x5A, 0xCA,
+    0x0F, 0xC5, 0x9D, 0x1A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xEA, 0x96, 0x9F,
+    0xF5, 0xFA, 0xAF, 0x3E, 0xA3, 0xAD, 0x91, 0x9E, 0x90, 0x99, 0x99, 0xE1, 0xAF, 0xFF, 0x1F, 0xFF,
+    0xC9, 0x0F, 0xFF, 0xC9, 0x0E, 0xAA, 0x99, 0x96, 0xEA, 0x72, 0xF9, 0x71, 0xAF, 0xC9, 0x91, 0x9A,
+    0xC9, 0x1F, 0xFF, 0x91, 0x9F, 0xFE, 0x92, 0x9F, 0xFD, 0x5A, 0xAF, 0xA9, 0x10, 0x77, 0x70, 0x9D,
+    0x97, 0x6F, 0x75, 0xFD, 0x4A, 0xA9, 0x3F, 0xF2, 0xAD, 0x3E, 0xA1, 0xF1, 0xE2, 0xE9, 0x39, 0xEA,
+    0xDA, 0x76, 0xE7, 0x79, 0x99, 0x77, 0x5A, 0xAA, 0xAA, 0xAF, 0xE9, 0x39, 0xFF, 0xFC, 0x49, 0xFF,
+    0xFC, 0x49, 0xFF, 0xAA, 0xAA, 0x94, 0x9E, 0xA7, 0x59, 0xEA, 0x75, 0x9E, 0xA7, 0x59, 0xEA, 0x75,
+    0xAF, 0xAA, 0xAE, 0x96, 0xAF, 0xFD, 0x96, 0xAF, 0xFD, 0x96, 0xAF, 0xFD, 0x96, 0xAF, 0x75, 0xAE,
+    0xA7, 0x5A, 0xEA, 0x75, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x94, 0xFF, 0xFD, 0x4F, 0xFF, 0xD4, 0xFF,
+    0xFD, 0x93, 0xFF, 0xFD, 0xA3, 0xFF, 0xFE, 0x30, 0x6D, 0xA7, 0x7A, 0xE9, 0x4A, 0xD5, 0x9F, 0xC4,
+    0xE4, 0x9F, 0xE2, 0xAD, 0x93, 0xAE, 0x90, 0xAE, 0x1E, 0x3A, 0xE3, 0x9F, 0xE7, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x6A, 0xEA, 0x97, 0x39, 0xFF, 0x72, 0xFA, 0xAF, 0x70, 0xEA, 0x3A, 0xD9,
+    0x69, 0xE9, 0x09, 0x99, 0x9E, 0x6A, 0xFF, 0xF6, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0x95, 0xEA, 0xA9,
+    0x99, 0x73, 0xEA, 0x77, 0xF9, 0x76, 0xAF, 0xC9, 0x91, 0x9A, 0xC9, 0x6F, 0xFF, 0x96, 0x9F, 0xFE,
+    0x97, 0x9F, 0xFD, 0x72, 0xAA, 0xFA, 0x96, 0x0F, 0x77, 0x1F, 0x97, 0x70, 0xFA, 0x77, 0x0F, 0xC2,
+    0x9D, 0x97, 0x29, 0x99, 0x91, 0xF7, 0x7F, 0xD7, 0x5F, 0xF7, 0x3E, 0xA1, 0xF7, 0x1E, 0x93, 0x9E,
+    0x77, 0x77, 0x77, 0x77, 0x6A, 0xAA, 0xAA, 0xAF, 0xE9, 0x59, 0xFF, 0xFC, 0x69, 0xFF, 0xFC, 0x69,
+    0xFF, 0xAA, 0xAA, 0x96, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0xAF, 0xAA,
+    0xAE, 0x97, 0x0A, 0xFF, 0xD9, 0x70, 0xAF, 0xFD, 0x97, 0x0A, 0xFF, 0xD9, 0x70, 0xAF, 0x77, 0xAE,
+    0xA7, 0x7A, 0xEA, 0x77, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x96, 0xFF, 0xFD, 0x6F, 0xFF, 0xD6, 0xFF,
+    0xFD, 0x95, 0xFF, 0xFD, 0xA5, 0xFF, 0xFE, 0x99, 0x99, 0x77, 0xF7, 0x7F, 0x97, 0x6F, 0xA2, 0xDA,
+    0x70, 0xFC, 0x0A, 0xE9, 0x74, 0xAF, 0xC7, 0x39, 0xFE, 0x71, 0xAE, 0x90, 0xAE, 0x7A, 0xE3, 0x9E,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAE, 0xA9, 0x72, 0x9F, 0xF7, 0x1F, 0xAA, 0xF7,
+    0xEA, 0x3A, 0xD9, 0x59, 0xE9, 0x09, 0x99, 0x9E, 0x5A, 0xFF, 0xF5, 0xFF, 0xFC, 0x94, 0xFF, 0xFC,
+    0x94, 0xEA, 0xA9, 0x99, 0x72, 0xEA, 0x76, 0xF9, 0x75, 0xAF, 0xC9, 0x91, 0x9A, 0xC9, 0x5F, 0xFF,
+    0x95, 0x9F, 0xFE, 0x96, 0x9F, 0xFD, 0x71, 0xAA, 0xFA, 0x91, 0x72, 0xAD, 0x97, 0x3A, 0xE7, 0x59,
+    0xC7, 0x49, 0xCA, 0x69, 0xD9, 0x09, 0xCA, 0x7F, 0x19, 0x7F, 0xD7, 0x0F, 0xF6, 0xEA, 0x1F, 0x4E,
+    0x93, 0x9E, 0x77, 0x77, 0x77, 0x2A, 0xAA, 0xAA, 0xAF, 0xE9, 0x09, 0xFF, 0xFC, 0x19, 0xFF, 0xFC,
+    0x19, 0xFF, 0xAA, 0xAA, 0x91, 0x9E, 0xA7, 0x29, 0xEA, 0x72, 0x9E, 0xA7, 0x29, 0xEA, 0x72, 0xAF,
+    0xAA, 0xAE, 0x93, 0xAF, 0xFD, 0x93, 0xAF, 0xFD, 0x93, 0xAF, 0xFD, 0x93, 0xAF, 0x72, 0xAE, 0xA7,
+    0x2A, 0xEA, 0x72, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x91, 0xFF, 0xFD, 0x1F, 0xFF, 0xD1, 0xFF, 0xFD,
+    0x90, 0xFF, 0xFD, 0xA0, 0xFF, 0xFE, 0x00, 0x73, 0xDA, 0x97, 0x39, 0xF7, 0x49, 0x9A, 0xCA, 0x75,
+    0xAC, 0x97, 0x4E, 0x74, 0xE9, 0x69, 0xD9, 0x1A, 0xC7, 0x0F, 0x73, 0xFD, 0x71, 0xFF, 0x7E, 0xA1,
+    0xF5, 0xE9, 0x39, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xEA, 0x97, 0x09, 0xFF, 0x7F, 0xAA,
+    0xF5, 0xEA, 0x3A, 0xD9, 0x39, 0xE9, 0x09, 0x99, 0x9E, 0x3A, 0xFF, 0xF3, 0xFF, 0xFC, 0x92, 0xFF,
+    0xFC, 0x92, 0xEA, 0xA9, 0x99, 0x70, 0xEA, 0x74, 0xF9, 0x73, 0xAF, 0xC9, 0x91, 0x9A, 0xC9, 0x3F,
+    0xFF, 0x93, 0x9F, 0xFE, 0x94, 0x9F, 0xFD, 0x7A, 0xAF, 0xA9, 0x30, 0x3A, 0xD1, 0x9C, 0xA5, 0xAF,
+    0x09, 0xD5, 0xDA, 0xFD, 0x5D, 0x90, 0xF9, 0x5D, 0x90, 0x9D, 0xA7, 0x77, 0x77, 0xDA, 0x72, 0xAE,
+    0x97, 0x0A, 0xFC, 0x7A, 0xFE, 0x5A, 0xE9, 0x0A, 0xE3, 0xAE, 0x39, 0xE7, 0x77, 0x70, 0xAA, 0xAA,
+    0xAA, 0xFE, 0x99, 0xFF, 0xFC, 0x09, 0xFF, 0xFC, 0x09, 0xFF, 0xAA, 0xAA, 0x90, 0x9E, 0xA7, 0x19,
+    0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0xAF, 0xAA, 0xAE, 0x92, 0xAF, 0xFD, 0x92, 0xAF, 0xFD,
+    0x92, 0xAF, 0xFD, 0x92, 0xAF, 0x71, 0xAE, 0xA7, 0x1A, 0xEA, 0x71, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x90, 0xFF, 0xFD, 0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x9F, 0xFF, 0xDA, 0xFF, 0xFE, 0x49, 0x92, 0x99,
+    0x6F, 0x1D, 0x5A, 0xFC, 0xAD, 0x5A, 0xCA, 0x0F, 0xC5, 0xAC, 0xA1, 0xAD, 0x77, 0x71, 0xDA, 0x72,
+    0xAE, 0x97, 0x09, 0xFC, 0x79, 0xFE, 0x5A, 0xE9, 0x0A, 0xE3, 0xAE, 0x39, 0xE7, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x7A, 0xEA, 0x96, 0x9F, 0xF5, 0xFA, 0xAF, 0x3E, 0xA3, 0xAD, 0x91, 0x9E, 0x90, 0x99,
+    0x99, 0xE1, 0xAF, 0xFF, 0x1F, 0xFF, 0xC9, 0x0F, 0xFF, 0xC9, 0x0E, 0xAA, 0x99, 0x96, 0xEA, 0x72,
+    0xF9, 0x71, 0xAF, 0xC9, 0x91, 0x9A, 0xC9, 0x1F, 0xFF, 0x91, 0x9F, 0xFE, 0x92, 0x9F, 0xFD, 0x5A,
+    0xAF, 0xA9, 0x10, 0x77, 0x49, 0xD9, 0x72, 0xF7, 0x1F, 0xD7, 0xFF, 0x5E, 0xA1, 0xF3, 0xE9, 0x39,
+    0xE7, 0x77, 0x77, 0x6A, 0xAA, 0xAA, 0xAF, 0xE9, 0x9F, 0xFF, 0xC0, 0x9F, 0xFF, 0xC0, 0x9F, 0xFA,
+    0xAA, 0xA9, 0x09, 0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0x9E, 0xA7, 0x1A, 0xFA, 0xAA, 0xE9,
+    0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD9, 0x2A, 0xF7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7,
+    0x1F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x0F, 0xFF, 0xD9, 0xFF, 0xFD,
+    0xAF, 0xFF, 0xE7, 0x77, 0x77, 0x77, 0x71, 0x99, 0x99, 0x71, 0x9E, 0xA7, 0x1A, 0xF7, 0x1A, 0xF7,
+    0x1F, 0xC7, 0x1F, 0xC4, 0x6D, 0xA7, 0x2A, 0xE9, 0x70, 0x9F, 0xC7, 0x9F, 0xE5, 0xAE, 0x90, 0xAE,
+    0x3A, 0xE3, 0x9E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xAE, 0xA9, 0x69, 0xFF, 0x5F, 0xAA, 0xF3,
+    0xEA, 0x3A, 0xD9, 0x19, 0xE9, 0x09, 0x99, 0x9E, 0x1A, 0xFF, 0xF1, 0xFF, 0xFC, 0x90, 0xFF, 0xFC,
+    0x90, 0xEA, 0xA9, 0x99, 0x6E, 0xA7, 0x2F, 0x97, 0x1A, 0xFC, 0x99, 0x19, 0xAC, 0x91, 0xFF, 0xF9,
+    0x19, 0xFF, 0xE9, 0x29, 0xFF, 0xD5, 0xAA, 0xFA, 0x97, 0x77, 0x77, 0x77, 0x74, 0x99, 0x97, 0x29,
+    0xEA, 0x71, 0xAE, 0xA7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC3, 0x09, 0xAA, 0x2A, 0xE3, 0x9C, 0x29,
+    0xD1, 0x9D, 0x39, 0x77, 0x77, 0x0F, 0xA0, 0xAE, 0xA0, 0xAE, 0xA0, 0xAE, 0xA0, 0xAE, 0xA0, 0x9E,
+    0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9F, 0x09, 0xF0, 0x9F, 0x09,
+    0xF0, 0xAF, 0x0A, 0xF0, 0xAF, 0x0F, 0xC9, 0xFC, 0x9F, 0xC9, 0x09, 0xDA, 0x2E, 0x93, 0xC9, 0x19,
+    0xD2, 0xD7, 0x77, 0x2A, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA, 0x1E, 0xA1, 0xEA,
+    0x1E, 0xA1, 0xEA, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x90, 0x0F, 0xA1, 0xAE, 0xA1, 0xAE, 0xA1, 0xAE,
+    0xA1, 0xAE, 0xA1, 0x9E, 0xA1, 0x9E, 0xA1, 0x9E, 0xA1, 0x9E, 0xA1, 0x9E, 0xA1, 0x9E, 0xA1, 0x9F,
+    0x19, 0xF1, 0x9F, 0x19, 0xF1, 0xAF, 0x1A, 0xF1, 0xAF, 0x1F, 0xC9, 0x0F, 0xC9, 0x0F, 0xC9, 0x77,
+    0x77, 0x4F, 0x19, 0xF1, 0x9F, 0x1A, 0xF1, 0xFC, 0x90, 0x99, 0x99, 0x90, 0x0F, 0x1F, 0x09, 0xF0,
+    0xAF, 0x9A, 0xF9, 0x99, 0x99, 0x99, 0x77, 0x2A, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA, 0x1A,
+    0xDA, 0x1E, 0xA1, 0xEA, 0x1E, 0xA1, 0xEA, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x97, 0x77, 0x6F, 0x1F,
+    0x09, 0xF9, 0x9F, 0x9A, 0xFA, 0x99, 0x99, 0x99, 0x59, 0xAF, 0xA9, 0x72, 0x9F, 0xFD, 0xA7, 0x9F,
+    0xFF, 0xC5, 0x9F, 0xDA, 0x9A, 0xFD, 0x4F, 0xC9, 0x4A, 0xFA, 0x2A, 0xF7, 0xFC, 0x2F, 0xA7, 0x9F,
+    0x90, 0x9F, 0x71, 0xFC, 0x0A, 0xF7, 0x19, 0xF0, 0xFA, 0x71, 0x9F, 0x0F, 0xA7, 0x2F, 0x0F, 0x97,
+    0x2F, 0x9F, 0xA7, 0x2F, 0x9F, 0xA7, 0x19, 0xF0, 0xFC, 0x71, 0xAF, 0x0A, 0xFA, 0x79, 0xFC, 0x0A,
+    0xFD, 0xA9, 0x90, 0x99, 0xFE, 0x09, 0xFF, 0xFF, 0xDA, 0x1F, 0xFF, 0xFD, 0x91, 0x9F, 0xFF, 0xFC,
+    0x3A, 0xFF, 0xFE, 0x59, 0xFF, 0xFC, 0x70, 0x9A, 0xFE, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x72, 0xF7, 0x70, 0xF7, 0x70, 0xF9, 0x76, 0x9F, 0xA7, 0x6A, 0xFA, 0x76, 0x99, 0x99,
+    0x99, 0x70, 0x4A, 0xF9, 0x6A, 0xFF, 0x4A, 0xFF, 0xD3, 0xF9, 0x1A, 0xEA, 0x1A, 0xE9, 0x3F, 0x1F,
+    0x49, 0xE9, 0x0E, 0xA5, 0xEA, 0x0E, 0xA5, 0xEA, 0x0E, 0xA5, 0xEA, 0x0F, 0x49, 0xE9, 0x0F, 0xA2,
+    0x9F, 0x90, 0xAF, 0xFF, 0x2F, 0xFE, 0xA2, 0xAF, 0xFD, 0x4A, 0xFF, 0x69, 0xAF, 0x97, 0x77, 0x77,
+    0x77, 0x75, 0xF7, 0x2F, 0x72, 0xF9, 0x70, 0x9F, 0x97, 0x0A, 0xFA, 0x70, 0x99, 0x99, 0x99, 0x30,
+    0x70, 0xAA, 0x97, 0x71, 0xEA, 0x77, 0x2A, 0xC7, 0x71, 0xAC, 0x97, 0x70, 0xAC, 0xA7, 0x72, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x69, 0xAF, 0xA9, 0x72, 0x9F, 0xFD, 0xA7, 0x9F, 0xFF, 0xC5, 0x9F, 0xDA,
+    0x9A, 0xFD, 0x4F, 0xC9, 0x4A, 0xFA, 0x2A, 0xF7, 0xFC, 0x2F, 0xA7, 0x9F, 0x90, 0x9F, 0x71, 0xFC,
+    0x0A, 0xF7, 0x19, 0xF0, 0xFA, 0x71, 0x9F, 0x0F, 0xA7, 0x2F, 0x0F, 0x97, 0x2F, 0x9F, 0xA7, 0x2F,
+    0x9F, 0xA7, 0x19, 0xF0, 0xFC, 0x71, 0xAF, 0x0A, 0xFA, 0x79, 0xFC, 0x0A, 0xFD, 0xA9, 0x90, 0x99,
+    0xFE, 0x09, 0xFF, 0xFF, 0xDA, 0x1F, 0xFF, 0xFD, 0x91, 0x9F, 0xFF, 0xFC, 0x3A, 0xFF, 0xFE, 0x59,
+    0xFF, 0xFC, 0x70, 0x9A, 0xFE, 0xA9, 0x77, 0x71, 0x59, 0xAA, 0x73, 0x9E, 0x75, 0xC9, 0x73, 0xD7,
+    0x3D, 0x74, 0x97, 0x77, 0x77, 0x77, 0x0A, 0xF9, 0x6A, 0xFF, 0x4A, 0xFF, 0xD3, 0xF9, 0x1A, 0xEA,
+    0x1A, 0xE9, 0x3F, 0x1F, 0x49, 0xE9, 0x0E, 0xA5, 0xEA, 0x0E, 0xA5, 0xEA, 0x0E, 0xA5, 0xEA, 0x0F,
+    0x49, 0xE9, 0x0F, 0xA2, 0x9F, 0x90, 0xAF, 0xFF, 0x2F, 0xFE, 0xA2, 0xAF, 0xFD, 0x4A, 0xFF, 0x69,
+    0xAF, 0x93, 0x77, 0x76, 0xAD, 0x77, 0x19, 0xEA, 0x77, 0x9F, 0xCA, 0x39, 0xAA, 0x69, 0xFE, 0xA2,
+    0xE5, 0x9E, 0x90, 0x9E, 0xA0, 0x9D, 0xA4, 0x9E, 0x4A, 0xDA, 0xE7, 0x71, 0x9E, 0x77, 0x75, 0x9A,
+    0xFA, 0x97, 0x39, 0xFF, 0xDA, 0x70, 0x9F, 0xFF, 0xC6, 0x9F, 0xDA, 0x9A, 0xFD, 0x5F, 0xC9, 0x4A,
+    0xFA, 0x3A, 0xF7, 0xFC, 0x3F, 0xA7, 0x9F, 0x91, 0x9F, 0x71, 0xFC, 0x1A, 0xF7, 0x19, 0xF1, 0xFA,
+    0x71, 0x9F, 0x1F, 0xA7, 0x2F, 0x1F, 0x97, 0x2F, 0x90, 0xFA, 0x72, 0xF9, 0x0F, 0xA7, 0x19, 0xF1,
+    0xFC, 0x71, 0xAF, 0x1A, 0xFA, 0x79, 0xFC, 0x1A, 0xFD, 0xA9, 0x90, 0x99, 0xFE, 0x19, 0xFF, 0xFF,
+    0xDA, 0x2F, 0xFF, 0xFD, 0x92, 0x9F, 0xFF, 0xFC, 0x4A, 0xFF, 0xFE, 0x69, 0xFF, 0xFC, 0x71, 0x9A,
+    0xFE, 0xA9, 0x77, 0x73, 0x76, 0xE7, 0x69, 0xDA, 0x7D, 0xA3, 0xE7, 0xF9, 0x19, 0xE6, 0xFD, 0x90,
+    0xEA, 0x5F, 0xF9, 0x70, 0xF1, 0xAE, 0x96, 0xEA, 0x39, 0xE9, 0x77, 0x77, 0x76, 0xAF, 0x97, 0x2A,
+    0xFF, 0x70, 0xAF, 0xFD, 0x7F, 0x91, 0xAE, 0xA5, 0xAE, 0x93, 0xF5, 0xF4, 0x9E, 0x94, 0xEA, 0x5E,
+    0xA4, 0xEA, 0x5E, 0xA4, 0xEA, 0x5E, 0xA4, 0xF4, 0x9E, 0x94, 0xFA, 0x29, 0xF9, 0x4A, 0xFF, 0xF6,
+    0xFF, 0xEA, 0x6A, 0xFF, 0xD7, 0x0A, 0xFF, 0x72, 0x9A, 0xF9, 0x70, 0x09, 0x99, 0x77, 0x4F, 0x97,
+    0x73, 0xF9, 0x77, 0x3F, 0xA3, 0xAD, 0x74, 0xAF, 0x19, 0xEA, 0x77, 0x19, 0xFC, 0xA7, 0x79, 0xFE,
+    0xA7, 0x59, 0xE9, 0x09, 0xEA, 0x73, 0x9E, 0x4A, 0xDA, 0x77, 0x77, 0x77, 0x74, 0x9A, 0xFA, 0x97,
+    0x59, 0xFF, 0xDA, 0x72, 0x9F, 0xFF, 0xC7, 0x09, 0xFD, 0xA9, 0xAF, 0xD7, 0xFC, 0x94, 0xAF, 0xA5,
+    0xAF, 0x7F, 0xC5, 0xFA, 0x79, 0xF9, 0x39, 0xF7, 0x1F, 0xC3, 0xAF, 0x71, 0x9F, 0x3F, 0xA7, 0x19,
+    0xF3, 0xFA, 0x72, 0xF3, 0xF9, 0x72, 0xF9, 0x2F, 0xA7, 0x2F, 0x92, 0xFA, 0x71, 0x9F, 0x3F, 0xC7,
+    0x1A, 0xF3, 0xAF, 0xA7, 0x9F, 0xC3, 0xAF, 0xDA, 0x99, 0x09, 0x9F, 0xE3, 0x9F, 0xFF, 0xFD, 0xA4,
+    0xFF, 0xFF, 0xD9, 0x49, 0xFF, 0xFF, 0xC6, 0xAF, 0xFF, 0xE7, 0x09, 0xFF, 0xFC, 0x73, 0x9A, 0xFE,
+    0xA9, 0x77, 0x74, 0x09, 0x99, 0x77, 0x09, 0xEA, 0x77, 0x9F, 0x77, 0x9F, 0x97, 0x69, 0xFA, 0x77,
+    0x5D, 0xA7, 0x7F, 0x97, 0x5F, 0xD9, 0x73, 0xFF, 0x97, 0x1F, 0x1A, 0xE9, 0x7E, 0xA3, 0x9E, 0x97,
+    0x77, 0x77, 0x71, 0xAF, 0x97, 0x3A, 0xFF, 0x71, 0xAF, 0xFD, 0x70, 0xF9, 0x1A, 0xEA, 0x6A, 0xE9,
+    0x3F, 0x6F, 0x49, 0xE9, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5F, 0x49, 0xE9,
+    0x5F, 0xA2, 0x9F, 0x95, 0xAF, 0xFF, 0x7F, 0xFE, 0xA7, 0xAF, 0xFD, 0x71, 0xAF, 0xF7, 0x39, 0xAF,
+    0x93, 0x70, 0xAA, 0x97, 0x71, 0xEA, 0x77, 0x2A, 0xC7, 0x70, 0x9A, 0xCA, 0x77, 0x0E, 0x97, 0x7F,
+    0xC7, 0x6A, 0xFD, 0x74, 0xAE, 0x9F, 0x72, 0xF2, 0xAE, 0x70, 0x9A, 0xA9, 0x49, 0xAA, 0xA7, 0x77,
+    0x77, 0x73, 0x9A, 0xFA, 0x97, 0x29, 0xFF, 0xDA, 0x79, 0xFF, 0xFC, 0x59, 0xFD, 0xA9, 0xAF, 0xD4,
+    0xFC, 0x94, 0xAF, 0xA2, 0xAF, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF7, 0x1F, 0xC0, 0xAF, 0x71,
+    0x9F, 0x0F, 0xA7, 0x19, 0xF0, 0xFA, 0x72, 0xF0, 0xF9, 0x72, 0xF9, 0xFA, 0x72, 0xF9, 0xFA, 0x71,
+    0x9F, 0x0F, 0xC7, 0x1A, 0xF0, 0xAF, 0xA7, 0x9F, 0xC0, 0xAF, 0xDA, 0x99, 0x09, 0x9F, 0xE0, 0x9F,
+    0xFF, 0xFD, 0xA1, 0xFF, 0xFF, 0xD9, 0x19, 0xFF, 0xFF, 0xC3, 0xAF, 0xFF, 0xE5, 0x9F, 0xFF, 0xC7,
+    0x09, 0xAF, 0xEA, 0x97, 0x77, 0x10, 0x77, 0x73, 0x9E, 0x97, 0x39, 0xF9, 0x75, 0x9C, 0x97, 0x49,
+    0xD7, 0x4A, 0xD9, 0x6A, 0xD9, 0x1D, 0x79, 0xF7, 0x29, 0xFD, 0x70, 0x9F, 0xF6, 0x9E, 0xA1, 0xF4,
+    0x9E, 0x4A, 0xE7, 0x77, 0x77, 0x1A, 0xF9, 0x70, 0xAF, 0xF6, 0xAF, 0xFD, 0x5F, 0x91, 0xAE, 0xA3,
+    0xAE, 0x93, 0xF3, 0xF4, 0x9E, 0x92, 0xEA, 0x5E, 0xA2, 0xEA, 0x5E, 0xA2, 0xEA, 0x5E, 0xA2, 0xF4,
+    0x9E, 0x92, 0xFA, 0x29, 0xF9, 0x2A, 0xFF, 0xF4, 0xFF, 0xEA, 0x4A, 0xFF, 0xD6, 0xAF, 0xF7, 0x09,
+    0xAF, 0x95, 0x69, 0xA9, 0x19, 0x97, 0x4A, 0xEA, 0x0A, 0xCA, 0x73, 0xFC, 0x9A, 0xCA, 0x73, 0xD0,
+    0xFC, 0x97, 0x29, 0xD1, 0xF7, 0x4A, 0xA2, 0x9A, 0x77, 0x77, 0x5D, 0x97, 0x70, 0xF7, 0x7A, 0xFC,
+    0x75, 0xAF, 0xE7, 0x3F, 0x90, 0xF7, 0x1E, 0xA3, 0xAE, 0x77, 0x77, 0x9A, 0xFA, 0x97, 0x29, 0xFF,
+    0xDA, 0x79, 0xFF, 0xFC, 0x59, 0xFD, 0xA9, 0xAF, 0xD4, 0xFC, 0x94, 0xAF, 0xA2, 0xAF, 0x7F, 0xC2,
+    0xFA, 0x79, 0xF9, 0x09, 0xF7, 0x1F, 0xC0, 0xAF, 0x71, 0x9F, 0x0F, 0xA7, 0x19, 0xF0, 0xFA, 0x72,
+    0xF0, 0xF9, 0x72, 0xF9, 0xFA, 0x72, 0xF9, 0xFA, 0x71, 0x9F, 0x0F, 0xC7, 0x1A, 0xF0, 0xAF, 0xA7,
+    0x9F, 0xC0, 0xAF, 0xDA, 0x99, 0x09, 0x9F, 0xE0, 0x9F, 0xFF, 0xFD, 0xA1, 0xFF, 0xFF, 0xD9, 0x19,
+    0xFF, 0xFF, 0xC3, 0xAF, 0xFF, 0xE5, 0x9F, 0xFF, 0xC7, 0x09, 0xAF, 0xEA, 0x97, 0x77, 0x10, 0x39,
+    0xD9, 0x1D, 0x59, 0xF9, 0x0D, 0x5A, 0xDA, 0xDA, 0xD5, 0xAC, 0xA0, 0xFC, 0x5A, 0xD1, 0xAD, 0x77,
+    0x77, 0x7A, 0xD7, 0x29, 0xEA, 0x71, 0xFC, 0x97, 0xFE, 0x94, 0x9E, 0xA0, 0xAE, 0x92, 0x9E, 0x93,
+    0xE9, 0x77, 0x4A, 0xF9, 0x6A, 0xFF, 0x4A, 0xFF, 0xD3, 0xF9, 0x1A, 0xEA, 0x1A, 0xE9, 0x3F, 0x1F,
+    0x49, 0xE9, 0x0E, 0xA5, 0xEA, 0x0E, 0xA5, 0xEA, 0x0E, 0xA5, 0xEA, 0x0F, 0x49, 0xE9, 0x0F, 0xA2,
+    0x9F, 0x90, 0xAF, 0xFF, 0x2F, 0xFE, 0xA2, 0xAF, 0xFD, 0x4A, 0xFF, 0x69, 0xAF, 0x93, 0x77, 0x75,
+    0xAD, 0x77, 0x09, 0xEA, 0x76, 0x9F, 0xCA, 0x74, 0x9F, 0xEA, 0x72, 0x9E, 0x90, 0x9E, 0xA7, 0x09,
+    0xE4, 0xAD, 0xA7, 0x77, 0x77, 0x73, 0x9A, 0xFA, 0x97, 0x29, 0xFF, 0xDA, 0x79, 0xFF, 0xFC, 0x59,
+    0xFD, 0xA9, 0xAF, 0xD4, 0xFC, 0x94, 0xAF, 0xA2, 0xAF, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF7,
+    0x1F, 0xC0, 0xAF, 0x71, 0x9F, 0x0F, 0xA7, 0x19, 0xF0, 0xFA, 0x72, 0xF0, 0xF9, 0x72, 0xF9, 0xFA,
+    0x72, 0xF9, 0xFA, 0x71, 0x9F, 0x0F, 0xC7, 0x1A, 0xF0, 0xAF, 0xA7, 0x9F, 0xC0, 0xAF, 0xDA, 0x99,
+    0x09, 0x9F, 0xE0, 0x9F, 0xFF, 0xFD, 0xA1, 0xFF, 0xFF, 0xD9, 0x19, 0xFF, 0xFF, 0xC3, 0xAF, 0xFF,
+    0xE5, 0x9F, 0xFF, 0xC7, 0x09, 0xAF, 0xEA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x2F, 0x77, 0x0F, 0x77, 0x0F, 0x97, 0x69, 0xFA, 0x76, 0xAF, 0xA7, 0x69, 0x99, 0x99, 0x97, 0x77,
+    0x5D, 0xA7, 0x2F, 0x97, 0x0F, 0xD9, 0x6F, 0xF9, 0x4F, 0x1A, 0xE9, 0x2E, 0xA3, 0x9E, 0x97, 0x77,
+    0x72, 0xAF, 0x96, 0xAF, 0xF4, 0xAF, 0xFD, 0x3F, 0x91, 0xAE, 0xA1, 0xAE, 0x93, 0xF1, 0xF4, 0x9E,
+    0x90, 0xEA, 0x5E, 0xA0, 0xEA, 0x5E, 0xA0, 0xEA, 0x5E, 0xA0, 0xF4, 0x9E, 0x90, 0xFA, 0x29, 0xF9,
+    0x0A, 0xFF, 0xF2, 0xFF, 0xEA, 0x2A, 0xFF, 0xD4, 0xAF, 0xF6, 0x9A, 0xF9, 0x77, 0x77, 0x77, 0x77,
+    0x49, 0x99, 0x97, 0x2F, 0x72, 0xF7, 0x19, 0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xFA, 0x40, 0x77, 0x77,
+    0xAD, 0x77, 0x2D, 0xA7, 0x71, 0xAD, 0x97, 0x71, 0xE7, 0x71, 0xAD, 0xA7, 0x77, 0x77, 0x71, 0xAD,
+    0x97, 0x71, 0x9D, 0xA5, 0x9A, 0xFA, 0x93, 0x9D, 0xA3, 0x9F, 0xFD, 0xA1, 0xAD, 0x92, 0x9F, 0xFF,
+    0xFC, 0x29, 0xFD, 0xA9, 0xAF, 0xF9, 0x2F, 0xC9, 0x4A, 0xFC, 0x92, 0xAF, 0x7F, 0xC3, 0xFA, 0x79,
+    0xF9, 0x19, 0xF7, 0x1F, 0xC1, 0xAF, 0x71, 0x9F, 0x1F, 0xA7, 0x19, 0xF1, 0xFA, 0x72, 0xF1, 0xF9,
+    0x72, 0xF9, 0x0F, 0xA7, 0x2F, 0x90, 0xFA, 0x71, 0x9F, 0x1F, 0xC7, 0x1A, 0xF1, 0xAF, 0xA7, 0x9F,
+    0xC1, 0xAF, 0xDA, 0x99, 0x09, 0x9F, 0xE1, 0x9F, 0xFF, 0xFD, 0xA2, 0xFF, 0xFF, 0xD9, 0x29, 0xFF,
+    0xFF, 0xC4, 0xAF, 0xFF, 0xE6, 0x9F, 0xFF, 0xC7, 0x19, 0xAF, 0xEA, 0x97, 0x77, 0x30, 0x69, 0xD7,
+    0x5E, 0x74, 0x9D, 0xA7, 0x4E, 0x74, 0x9E, 0x77, 0x77, 0x59, 0xA9, 0x75, 0x9D, 0x94, 0xAF, 0x91,
+    0x9D, 0xA2, 0xAF, 0xF0, 0x9D, 0x91, 0xAF, 0xFF, 0xC2, 0xF9, 0x1A, 0xFC, 0xA1, 0xAE, 0x93, 0xFA,
+    0x2F, 0x49, 0xE9, 0x2E, 0xA5, 0xEA, 0x2E, 0xA5, 0xEA, 0x2E, 0xA5, 0xEA, 0x2F, 0x49, 0xE9, 0x2F,
+    0xA2, 0x9F, 0x92, 0xAF, 0xFF, 0x4F, 0xFE, 0xA4, 0xAF, 0xFD, 0x6A, 0xFF, 0x70, 0x9A, 0xF9, 0x50,
+    0x59, 0x99, 0x77, 0x2A, 0xE9, 0x77, 0x1A, 0xEA, 0x77, 0x1A, 0xF7, 0x71, 0xAF, 0x97, 0x77, 0x77,
+    0x77, 0x74, 0xAD, 0x97, 0x71, 0x9D, 0xA5, 0x9A, 0xFA, 0x93, 0x9D, 0xA3, 0x9F, 0xFD, 0xA1, 0xAD,
+    0x92, 0x9F, 0xFF, 0xFC, 0x29, 0xFD, 0xA9, 0xAF, 0xF9, 0x2F, 0xC9, 0x4A, 0xFC, 0x92, 0xAF, 0x7F,
+    0xC3, 0xFA, 0x79, 0xF9, 0x19, 0xF7, 0x1F, 0xC1, 0xAF, 0x71, 0x9F, 0x1F, 0xA7, 0x19, 0xF1, 0xFA,
+    0x72, 0xF1, 0xF9, 0x72, 0xF9, 0x0F, 0xA7, 0x2F, 0x90, 0xFA, 0x71, 0x9F, 0x1F, 0xC7, 0x1A, 0xF1,
+    0xAF, 0xA7, 0x9F, 0xC1, 0xAF, 0xDA, 0x99, 0x09, 0x9F, 0xE1, 0x9F, 0xFF, 0xFD, 0xA2, 0xFF, 0xFF,
+    0xD9, 0x29, 0xFF, 0xFF, 0xC4, 0xAF, 0xFF, 0xE6, 0x9F, 0xFF, 0xC7, 0x19, 0xAF, 0xEA, 0x97, 0x77,
+    0x30, 0x29, 0x99, 0x75, 0xAE, 0x97, 0x4A, 0xEA, 0x74, 0xAF, 0x74, 0x9F, 0x97, 0x77, 0x77, 0x73,
+    0xAA, 0x97, 0x59, 0xD9, 0x4A, 0xF9, 0x19, 0xDA, 0x2A, 0xFF, 0x09, 0xD9, 0x1A, 0xFF, 0xFC, 0x2F,
+    0x91, 0xAF, 0xCA, 0x1A, 0xE9, 0x3F, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x5E, 0xA2, 0xEA, 0x5E, 0xA2,
+    0xEA, 0x5E, 0xA2, 0xF4, 0x9E, 0x92, 0xFA, 0x29, 0xF9, 0x2A, 0xFF, 0xF4, 0xFF, 0xEA, 0x4A, 0xFF,
+    0xD6, 0xAF, 0xF7, 0x09, 0xAF, 0x95, 0x70, 0x9A, 0xA7, 0x72, 0xAE, 0x77, 0x39, 0xC7, 0x72, 0x9D,
+    0x77, 0x2D, 0x77, 0x39, 0x77, 0x77, 0x77, 0x2A, 0xD9, 0x77, 0x19, 0xDA, 0x59, 0xAF, 0xA9, 0x39,
+    0xDA, 0x39, 0xFF, 0xDA, 0x1A, 0xD9, 0x29, 0xFF, 0xFF, 0xC2, 0x9F, 0xDA, 0x9A, 0xFF, 0x92, 0xFC,
+    0x94, 0xAF, 0xC9, 0x2A, 0xF7, 0xFC, 0x3F, 0xA7, 0x9F, 0x91, 0x9F, 0x71, 0xFC, 0x1A, 0xF7, 0x19,
+    0xF1, 0xFA, 0x71, 0x9F, 0x1F, 0xA7, 0x2F, 0x1F, 0x97, 0x2F, 0x90, 0xFA, 0x72, 0xF9, 0x0F, 0xA7,
+    0x19, 0xF1, 0xFC, 0x71, 0xAF, 0x1A, 0xFA, 0x79, 0xFC, 0x1A, 0xFD, 0xA9, 0x90, 0x99, 0xFE, 0x19,
+    0xFF, 0xFF, 0xDA, 0x2F, 0xFF, 0xFD, 0x92, 0x9F, 0xFF, 0xFC, 0x4A, 0xFF, 0xFE, 0x69, 0xFF, 0xFC,
+    0x71, 0x9A, 0xFE, 0xA9, 0x77, 0x73, 0x59, 0xAA, 0x75, 0x9E, 0x77, 0xC9, 0x75, 0xD7, 0x5D, 0x76,
+    0x97, 0x77, 0x76, 0xAA, 0x97, 0x59, 0xD9, 0x4A, 0xF9, 0x19, 0xDA, 0x2A, 0xFF, 0x09, 0xD9, 0x1A,
+    0xFF, 0xFC, 0x2F, 0x91, 0xAF, 0xCA, 0x1A, 0xE9, 0x3F, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x5E, 0xA2,
+    0xEA, 0x5E, 0xA2, 0xEA, 0x5E, 0xA2, 0xF4, 0x9E, 0x92, 0xFA, 0x29, 0xF9, 0x2A, 0xFF, 0xF4, 0xFF,
+    0xEA, 0x4A, 0xFF, 0xD6, 0xAF, 0xF7, 0x09, 0xAF, 0x95, 0x6A, 0xD9, 0x09, 0xD7, 0x49, 0xF9, 0x0D,
+    0x74, 0xAF, 0xF7, 0x4D, 0xA0, 0xFA, 0x74, 0xAC, 0xA1, 0xAD, 0x77, 0x77, 0x77, 0x77, 0x5A, 0xD9,
+    0x77, 0x19, 0xDA, 0x59, 0xAF, 0xA9, 0x39, 0xDA, 0x39, 0xFF, 0xDA, 0x1A, 0xD9, 0x29, 0xFF, 0xFF,
+    0xC2, 0x9F, 0xDA, 0x9A, 0xFF, 0x92, 0xFC, 0x94, 0xAF, 0xC9, 0x2A, 0xF7, 0xFC, 0x3F, 0xA7, 0x9F,
+    0x91, 0x9F, 0x71, 0xFC, 0x1A, 0xF7, 0x19, 0xF1, 0xFA, 0x71, 0x9F, 0x1F, 0xA7, 0x2F, 0x1F, 0x97,
+    0x2F, 0x90, 0xFA, 0x72, 0xF9, 0x0F, 0xA7, 0x19, 0xF1, 0xFC, 0x71, 0xAF, 0x1A, 0xFA, 0x79, 0xFC,
+    0x1A, 0xFD, 0xA9, 0x90, 0x99, 0xFE, 0x19, 0xFF, 0xFF, 0xDA, 0x2F, 0xFF, 0xFD, 0x92, 0x9F, 0xFF,
+    0xFC, 0x4A, 0xFF, 0xFE, 0x69, 0xFF, 0xFC, 0x71, 0x9A, 0xFE, 0xA9, 0x77, 0x73, 0x49, 0xA2, 0x99,
+    0x70, 0xF1, 0xD7, 0x9F, 0xC0, 0xD7, 0xAC, 0xA9, 0xFC, 0x7D, 0xA0, 0xAE, 0xA7, 0x9A, 0xA1, 0x9A,
+    0x97, 0x77, 0x73, 0x99, 0x97, 0x59, 0xD9, 0x4A, 0xF9, 0x19, 0xDA, 0x2A, 0xFF, 0x09, 0xD9, 0x1A,
+    0xFF, 0xFC, 0x2F, 0x91, 0xAF, 0xCA, 0x1A, 0xE9, 0x3F, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x5E, 0xA2,
+    0xEA, 0x5E, 0xA2, 0xEA, 0x5E, 0xA2, 0xF4, 0x9E, 0x92, 0xFA, 0x29, 0xF9, 0x2A, 0xFF, 0xF4, 0xFF,
+    0xEA, 0x4A, 0xFF, 0xD6, 0xAF, 0xF7, 0x09, 0xAF, 0x95, 0x77, 0x77, 0x7A, 0xD9, 0x77, 0x19, 0xDA,
+    0x59, 0xAF, 0xA9, 0x39, 0xDA, 0x39, 0xFF, 0xDA, 0x1A, 0xD9, 0x29, 0xFF, 0xFF, 0xC2, 0x9F, 0xDA,
+    0x9A, 0xFF, 0x92, 0xFC, 0x94, 0xAF, 0xC9, 0x2A, 0xF7, 0xFC, 0x3F, 0xA7, 0x9F, 0x91, 0x9F, 0x71,
+    0xFC, 0x1A, 0xF7, 0x19, 0xF1, 0xFA, 0x71, 0x9F, 0x1F, 0xA7, 0x2F, 0x1F, 0x97, 0x2F, 0x90, 0xFA,
+    0x72, 0xF9, 0x0F, 0xA7, 0x19, 0xF1, 0xFC, 0x71, 0xAF, 0x1A, 0xFA, 0x79, 0xFC, 0x1A, 0xFD, 0xA9,
+    0x90, 0x99, 0xFE, 0x19, 0xFF, 0xFF, 0xDA, 0x2F, 0xFF, 0xFD, 0x92, 0x9F, 0xFF, 0xFC, 0x4A, 0xFF,
+    0xFE, 0x69, 0xFF, 0xFC, 0x71, 0x9A, 0xFE, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x1F, 0x77, 0x1F, 0x77, 0x1F, 0x97, 0x79, 0xFA, 0x77, 0xAF, 0xA7, 0x79, 0x99, 0x99, 0x97,
+    0x00, 0x74, 0xAA, 0x97, 0x59, 0xD9, 0x4A, 0xF9, 0x19, 0xDA, 0x2A, 0xFF, 0x09, 0xD9, 0x1A, 0xFF,
+    0xFC, 0x2F, 0x91, 0xAF, 0xCA, 0x1A, 0xE9, 0x3F, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x5E, 0xA2, 0xEA,
+    0x5E, 0xA2, 0xEA, 0x5E, 0xA2, 0xF4, 0x9E, 0x92, 0xFA, 0x29, 0xF9, 0x2A, 0xFF, 0xF4, 0xFF, 0xEA,
+    0x4A, 0xFF, 0xD6, 0xAF, 0xF7, 0x09, 0xAF, 0x97, 0x77, 0x77, 0x77, 0x77, 0x7F, 0x74, 0xF7, 0x4F,
+    0x97, 0x29, 0xF9, 0x72, 0xAF, 0xA7, 0x29, 0x99, 0x99, 0x95, 0xFC, 0x95, 0xFF, 0xE9, 0x5F, 0xCA,
+    0xFC, 0x95, 0xAF, 0xAF, 0xC9, 0x5A, 0xFA, 0xFC, 0x95, 0xAF, 0xAF, 0xC9, 0x5A, 0xFA, 0xAF, 0x6A,
+    0xF9, 0xAF, 0x6A, 0xF9, 0xAF, 0x6A, 0xF9, 0xAF, 0x69, 0xF9, 0xAF, 0x69, 0xF9, 0xAF, 0x69, 0xF0,
+    0xAF, 0x69, 0xF0, 0x9F, 0x6A, 0xF0, 0x9F, 0xA5, 0xFC, 0x09, 0xFE, 0xAA, 0xFE, 0x1F, 0xFF, 0xF1,
+    0xFF, 0xFE, 0xA1, 0xAF, 0xFF, 0xD3, 0xFF, 0xFC, 0xA4, 0xAF, 0xFD, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x73, 0x99, 0x99, 0x75, 0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4A, 0xF9, 0x73, 0xFC, 0x95, 0x0E,
+    0x5A, 0xE1, 0xE5, 0xAE, 0x1E, 0x5A, 0xE1, 0xE9, 0x4A, 0xE1, 0xE9, 0x4A, 0xE1, 0xE9, 0x4A, 0xE1,
+    0xEA, 0x4F, 0x90, 0xAD, 0xA4, 0xF9, 0x0A, 0xE4, 0xF9, 0x0A, 0xE4, 0xF9, 0x09, 0xF9, 0x1F, 0xC9,
+    0x09, 0xFF, 0xF9, 0x1F, 0xFF, 0x91, 0xAF, 0xFE, 0xA2, 0xFF, 0xEA, 0x3A, 0xFA, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x4E, 0xA7, 0x19, 0xF7, 0x1A, 0xF7, 0x1F, 0xC7, 0x1F, 0xC7, 0x19, 0x99, 0x99,
+    0x40, 0x7A, 0xA9, 0x76, 0xE9, 0x77, 0xCA, 0x76, 0xD9, 0x75, 0xD9, 0x76, 0x99, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x1F, 0xC9, 0x5F, 0xFE, 0x95, 0xFC, 0xAF, 0xC9, 0x5A, 0xFA, 0xFC, 0x95, 0xAF,
+    0xAF, 0xC9, 0x5A, 0xFA, 0xFC, 0x95, 0xAF, 0xAA, 0xF6, 0xAF, 0x9A, 0xF6, 0xAF, 0x9A, 0xF6, 0xAF,
+    0x9A, 0xF6, 0x9F, 0x9A, 0xF6, 0x9F, 0x9A, 0xF6, 0x9F, 0x0A, 0xF6, 0x9F, 0x09, 0xF6, 0xAF, 0x09,
+    0xFA, 0x5F, 0xC0, 0x9F, 0xEA, 0xAF, 0xE1, 0xFF, 0xFF, 0x1F, 0xFF, 0xEA, 0x1A, 0xFF, 0xFD, 0x3F,
+    0xFF, 0xCA, 0x4A, 0xFF, 0xD9, 0x77, 0x40, 0x59, 0xD9, 0x72, 0x9E, 0x97, 0x4C, 0x97, 0x29, 0xD7,
+    0x3D, 0x77, 0x77, 0x77, 0x77, 0x2E, 0x5A, 0xE1, 0xE5, 0xAE, 0x1E, 0x5A, 0xE1, 0xE9, 0x4A, 0xE1,
+    0xE9, 0x4A, 0xE1, 0xE9, 0x4A, 0xE1, 0xEA, 0x4F, 0x90, 0xAD, 0xA4, 0xF9, 0x0A, 0xE4, 0xF9, 0x0A,
+    0xE4, 0xF9, 0x09, 0xF9, 0x1F, 0xC9, 0x09, 0xFF, 0xF9, 0x1F, 0xFF, 0x91, 0xAF, 0xFE, 0xA2, 0xFF,
+    0xEA, 0x3A, 0xFA, 0x40, 0x79, 0xD9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70, 0xAD, 0x97, 0x70, 0xE7,
+    0x77, 0x39, 0x97, 0x72, 0xE7, 0x71, 0xAD, 0x77, 0x1E, 0x77, 0x09, 0xE0, 0xFC, 0x95, 0xFE, 0x90,
+    0xFC, 0x95, 0xFD, 0xA1, 0xFC, 0x95, 0xAF, 0xA2, 0xFC, 0x95, 0xAF, 0xA2, 0xFC, 0x95, 0xAF, 0xA2,
+    0xFC, 0x95, 0xAF, 0xA2, 0xAF, 0x6A, 0xF9, 0x2A, 0xF6, 0xAF, 0x92, 0xAF, 0x6A, 0xF9, 0x2A, 0xF6,
+    0x9F, 0x92, 0xAF, 0x69, 0xF9, 0x2A, 0xF6, 0x9F, 0x3A, 0xF6, 0x9F, 0x39, 0xF6, 0xAF, 0x39, 0xFA,
+    0x5F, 0xC3, 0x9F, 0xEA, 0xAF, 0xE4, 0xFF, 0xFF, 0x4F, 0xFF, 0xEA, 0x4A, 0xFF, 0xFD, 0x6F, 0xFF,
+    0xCA, 0x7A, 0xFF, 0xD9, 0x77, 0x72, 0x77, 0x70, 0xAD, 0x76, 0xE7, 0x5A, 0xDA, 0x75, 0xE7, 0x59,
+    0xE4, 0xAA, 0x97, 0x6E, 0x76, 0xAD, 0x76, 0xE1, 0xE5, 0xAF, 0xCA, 0x1E, 0x5A, 0xFC, 0x2E, 0x5A,
+    0xF9, 0x2E, 0x94, 0xAE, 0x4E, 0x94, 0xAE, 0x4E, 0x94, 0xAE, 0x4E, 0xA4, 0xF9, 0x3A, 0xDA, 0x4F,
+    0x93, 0xAE, 0x4F, 0x93, 0xAE, 0x4F, 0x93, 0x9F, 0x91, 0xFC, 0x93, 0x9F, 0xFF, 0x94, 0xFF, 0xF9,
+    0x4A, 0xFF, 0xEA, 0x5F, 0xFE, 0xA6, 0xAF, 0xA7, 0x3A, 0xE9, 0x77, 0x0A, 0xEA, 0x77, 0x0A, 0xF7,
+    0x70, 0xAF, 0x97, 0x71, 0x99, 0x97, 0x77, 0x09, 0x77, 0x3E, 0x77, 0x1E, 0x77, 0x1E, 0x77, 0x09,
+    0xE0, 0xFC, 0x95, 0xFE, 0x90, 0xFC, 0x95, 0xFD, 0xA1, 0xFC, 0x95, 0xAF, 0xA2, 0xFC, 0x95, 0xAF,
+    0xA2, 0xFC, 0x95, 0xAF, 0xA2, 0xFC, 0x95, 0xAF, 0xA2, 0xAF, 0x6A, 0xF9, 0x2A, 0xF6, 0xAF, 0x92,
+    0xAF, 0x6A, 0xF9, 0x2A, 0xF6, 0x9F, 0x92, 0xAF, 0x69, 0xF9, 0x2A, 0xF6, 0x9F, 0x3A, 0xF6, 0x9F,
+    0x39, 0xF6, 0xAF, 0x39, 0xFA, 0x5F, 0xC3, 0x9F, 0xEA, 0xAF, 0xE4, 0xFF, 0xFF, 0x4F, 0xFF, 0xEA,
+    0x4A, 0xFF, 0xFD, 0x6F, 0xFF, 0xCA, 0x7A, 0xFF, 0xD9, 0x77, 0x72, 0x29, 0x99, 0x76, 0xAE, 0xA7,
+    0x5A, 0xEA, 0x75, 0xAF, 0x97, 0x49, 0xF9, 0x77, 0x3A, 0x99, 0x76, 0xE7, 0x6A, 0xD7, 0x6E, 0x1E,
+    0x5A, 0xFC, 0xA1, 0xE5, 0xAF, 0xC2, 0xE5, 0xAF, 0x92, 0xE9, 0x4A, 0xE4, 0xE9, 0x4A, 0xE4, 0xE9,
+    0x4A, 0xE4, 0xEA, 0x4F, 0x93, 0xAD, 0xA4, 0xF9, 0x3A, 0xE4, 0xF9, 0x3A, 0xE4, 0xF9, 0x39, 0xF9,
+    0x1F, 0xC9, 0x39, 0xFF, 0xF9, 0x4F, 0xFF, 0x94, 0xAF, 0xFE, 0xA5, 0xFF, 0xEA, 0x6A, 0xFA, 0x70,
+    0x7A, 0xA9, 0x77, 0x1E, 0x97, 0x72, 0xCA, 0x77, 0x1D, 0x97, 0x70, 0xD9, 0x77, 0x19, 0x97, 0x77,
+    0x39, 0x77, 0x3E, 0x77, 0x1A, 0xD7, 0x71, 0xE7, 0x70, 0x9E, 0x0F, 0xC9, 0x5F, 0xE9, 0x0F, 0xC9,
+    0x5F, 0xDA, 0x1F, 0xC9, 0x5A, 0xFA, 0x2F, 0xC9, 0x5A, 0xFA, 0x2F, 0xC9, 0x5A, 0xFA, 0x2F, 0xC9,
+    0x5A, 0xFA, 0x2A, 0xF6, 0xAF, 0x92, 0xAF, 0x6A, 0xF9, 0x2A, 0xF6, 0xAF, 0x92, 0xAF, 0x69, 0xF9,
+    0x2A, 0xF6, 0x9F, 0x92, 0xAF, 0x69, 0xF3, 0xAF, 0x69, 0xF3, 0x9F, 0x6A, 0xF3, 0x9F, 0xA5, 0xFC,
+    0x39, 0xFE, 0xAA, 0xFE, 0x4F, 0xFF, 0xF4, 0xFF, 0xFE, 0xA4, 0xAF, 0xFF, 0xD6, 0xFF, 0xFC, 0xA7,
+    0xAF, 0xFD, 0x97, 0x77, 0x20, 0x59, 0xD9, 0x75, 0x9E, 0x97, 0x7C, 0x97, 0x59, 0xD7, 0x6D, 0x77,
+    0x6C, 0xAA, 0x76, 0xE7, 0x6A, 0xD7, 0x6E, 0x1E, 0x5A, 0xFC, 0xA1, 0xE5, 0xAF, 0xC2, 0xE5, 0xAF,
+    0x92, 0xE9, 0x4A, 0xE4, 0xE9, 0x4A, 0xE4, 0xE9, 0x4A, 0xE4, 0xEA, 0x4F, 0x93, 0xAD, 0xA4, 0xF9,
+    0x3A, 0xE4, 0xF9, 0x3A, 0xE4, 0xF9, 0x39, 0xF9, 0x1F, 0xC9, 0x39, 0xFF, 0xF9, 0x4F, 0xFF, 0x94,
+    0xAF, 0xFE, 0xA5, 0xFF, 0xEA, 0x6A, 0xFA, 0x70, 0x59, 0x92, 0x99, 0x74, 0xF1, 0xD9, 0x73, 0xFC,
+    0x0D, 0x97, 0x29, 0xD0, 0xFC, 0x73, 0xAD, 0x09, 0xF7, 0x4A, 0xA2, 0xA9, 0x77, 0x77, 0x76, 0xE7,
+    0x71, 0xE7, 0x71, 0xE7, 0x70, 0x9E, 0x0F, 0xC9, 0x5F, 0xE9, 0x0F, 0xC9, 0x5F, 0xDA, 0x1F, 0xC9,
+    0x5A, 0xFA, 0x2F, 0xC9, 0x5A, 0xFA, 0x2F, 0xC9, 0x5A, 0xFA, 0x2F, 0xC9, 0x5A, 0xFA, 0x2A, 0xF6,
+    0xAF, 0x92, 0xAF, 0x6A, 0xF9, 0x2A, 0xF6, 0xAF, 0x92, 0xAF, 0x69, 0xF9, 0x2A, 0xF6, 0x9F, 0x92,
+    0xAF, 0x69, 0xF3, 0xAF, 0x69, 0xF3, 0x9F, 0x6A, 0xF3, 0x9F, 0xA5, 0xFC, 0x39, 0xFE, 0xAA, 0xFE,
+    0x4F, 0xFF, 0xF4, 0xFF, 0xFE, 0xA4, 0xAF, 0xFF, 0xD6, 0xFF, 0xFC, 0xA7, 0xAF, 0xFD, 0x97, 0x77,
+    0x20, 0x39, 0xD9, 0x1D, 0x71, 0xF9, 0x0D, 0x70, 0xAD, 0xAD, 0xAD, 0x70, 0xAC, 0xA0, 0xFC, 0x70,
+    0xAD, 0x1A, 0xD7, 0x74, 0xCA, 0xA7, 0x6E, 0x76, 0xAD, 0x76, 0xE1, 0xE5, 0xAF, 0xCA, 0x1E, 0x5A,
+    0xFC, 0x2E, 0x5A, 0xF9, 0x2E, 0x94, 0xAE, 0x4E, 0x94, 0xAE, 0x4E, 0x94, 0xAE, 0x4E, 0xA4, 0xF9,
+    0x3A, 0xDA, 0x4F, 0x93, 0xAE, 0x4F, 0x93, 0xAE, 0x4F, 0x93, 0x9F, 0x91, 0xFC, 0x93, 0x9F, 0xFF,
+    0x94, 0xFF, 0xF9, 0x4A, 0xFF, 0xEA, 0x5F, 0xFE, 0xA6, 0xAF, 0xA7, 0x77, 0x77, 0x5E, 0x77, 0x1E,
+    0x77, 0x1E, 0x77, 0x09, 0xE0, 0xFC, 0x95, 0xFE, 0x90, 0xFC, 0x95, 0xFD, 0xA1, 0xFC, 0x95, 0xAF,
+    0xA2, 0xFC, 0x95, 0xAF, 0xA2, 0xFC, 0x95, 0xAF, 0xA2, 0xFC, 0x95, 0xAF, 0xA2, 0xAF, 0x6A, 0xF9,
+    0x2A, 0xF6, 0xAF, 0x92, 0xAF, 0x6A, 0xF9, 0x2A, 0xF6, 0x9F, 0x92, 0xAF, 0x69, 0xF9, 0x2A, 0xF6,
+    0x9F, 0x3A, 0xF6, 0x9F, 0x39, 0xF6, 0xAF, 0x39, 0xFA, 0x5F, 0xC3, 0x9F, 0xEA, 0xAF, 0xE4, 0xFF,
+    0xFF, 0x4F, 0xFF, 0xEA, 0x4A, 0xFF, 0xFD, 0x6F, 0xFF, 0xCA, 0x7A, 0xFF, 0xD9, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x59, 0x99, 0x97, 0x70, 0xF7, 0x79, 0xF7, 0x7A, 0xF7, 0x7A, 0xF9, 0x76,
+    0xFC, 0x97, 0x00, 0x75, 0xCA, 0xA7, 0x6E, 0x76, 0xAD, 0x76, 0xE1, 0xE5, 0xAF, 0xCA, 0x1E, 0x5A,
+    0xFC, 0x2E, 0x5A, 0xF9, 0x2E, 0x94, 0xAE, 0x4E, 0x94, 0xAE, 0x4E, 0x94, 0xAE, 0x4E, 0xA4, 0xF9,
+    0x3A, 0xDA, 0x4F, 0x93, 0xAE, 0x4F, 0x93, 0xAE, 0x4F, 0x93, 0x9F, 0x91, 0xFC, 0x93, 0x9F, 0xFF,
+    0x94, 0xFF, 0xF9, 0x4A, 0xFF, 0xEA, 0x5F, 0xFE, 0xA6, 0xAF, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x1E, 0xA7, 0x49, 0xF7, 0x4A, 0xF7, 0x4F, 0xC7, 0x4F, 0xC7, 0x49, 0x99, 0x99, 0x70,
+    0x39, 0x99, 0x77, 0xF9, 0x76, 0xAE, 0xA7, 0x6A, 0xF7, 0x6A, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x7A, 0xF7, 0x0F, 0xA0, 0xF9, 0x69, 0xF1, 0xFC, 0x6F, 0xA1, 0x9F, 0x94, 0x9F, 0x3F,
+    0xC4, 0xFA, 0x39, 0xF9, 0x2A, 0xF5, 0xFC, 0x2F, 0xA5, 0x9F, 0xA0, 0xAF, 0x7F, 0xC0, 0xFC, 0x79,
+    0xFF, 0xC9, 0x70, 0xFF, 0xC7, 0x1A, 0xFE, 0x97, 0x2F, 0xE7, 0x3A, 0xFC, 0x97, 0x4F, 0xC7, 0x5F,
+    0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0xAF, 0xC7, 0x4A, 0xFC, 0x60, 0x39, 0x99,
+    0x75, 0xF7, 0x5F, 0x97, 0x4F, 0xA7, 0x4A, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3F, 0x6A,
+    0xE1, 0x9E, 0xA5, 0xF2, 0xF4, 0x9E, 0x92, 0x9F, 0x3A, 0xE4, 0xF9, 0x2F, 0x49, 0xF2, 0xEA, 0x5F,
+    0xA0, 0xAE, 0x69, 0xF0, 0xF7, 0xFF, 0xA7, 0x9F, 0xE7, 0x1F, 0xE7, 0x19, 0xFC, 0xA7, 0x2F, 0xC7,
+    0x3A, 0xF7, 0x39, 0xEA, 0x73, 0xF9, 0x69, 0x99, 0xAF, 0xC7, 0xFF, 0x97, 0xFF, 0x70, 0xFE, 0x71,
+    0xFA, 0x97, 0x00, 0xAF, 0x70, 0xFA, 0x0F, 0x96, 0x9F, 0x1F, 0xC6, 0xFA, 0x19, 0xF9, 0x49, 0xF3,
+    0xFC, 0x4F, 0xA3, 0x9F, 0x92, 0xAF, 0x5F, 0xC2, 0xFA, 0x59, 0xFA, 0x0A, 0xF7, 0xFC, 0x0F, 0xC7,
+    0x9F, 0xFC, 0x97, 0x0F, 0xFC, 0x71, 0xAF, 0xE9, 0x72, 0xFE, 0x73, 0xAF, 0xC9, 0x74, 0xFC, 0x75,
+    0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x4A, 0xFC, 0x74, 0xAF, 0xC7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9E, 0x97, 0x5A, 0xEA, 0x75, 0xFA, 0x75, 0xFC, 0x75,
+    0xFC, 0x75, 0x99, 0x99, 0x96, 0x0F, 0x6A, 0xE3, 0x9E, 0xA5, 0xF4, 0xF4, 0x9E, 0x94, 0x9F, 0x3A,
+    0xE6, 0xF9, 0x2F, 0x69, 0xF2, 0xEA, 0x7F, 0xA0, 0xAE, 0x70, 0x9F, 0x0F, 0x71, 0xFF, 0xA7, 0x19,
+    0xFE, 0x73, 0xFE, 0x73, 0x9F, 0xCA, 0x74, 0xFC, 0x75, 0xAF, 0x75, 0x9E, 0xA7, 0x5F, 0x97, 0x09,
+    0x99, 0xAF, 0xC7, 0x1F, 0xF9, 0x71, 0xFF, 0x29, 0xE9, 0x2F, 0xE3, 0xAE, 0xA2, 0xFA, 0x94, 0xFA,
+    0x75, 0xFC, 0x75, 0xFC, 0x75, 0x99, 0x99, 0x90, 0x7D, 0xA7, 0x7E, 0xA7, 0x70, 0xAC, 0x77, 0xD9,
+    0x76, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xF7, 0x0F, 0xA0, 0xF9,
+    0x69, 0xF1, 0xFC, 0x6F, 0xA1, 0x9F, 0x94, 0x9F, 0x3F, 0xC4, 0xFA, 0x39, 0xF9, 0x2A, 0xF5, 0xFC,
+    0x2F, 0xA5, 0x9F, 0xA0, 0xAF, 0x7F, 0xC0, 0xFC, 0x79, 0xFF, 0xC9, 0x70, 0xFF, 0xC7, 0x1A, 0xFE,
+    0x97, 0x2F, 0xE7, 0x3A, 0xFC, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49,
+    0xFC, 0x74, 0xAF, 0xC7, 0x4A, 0xFC, 0x60, 0x7A, 0xA9, 0x75, 0xE9, 0x76, 0xAA, 0x75, 0xAC, 0x97,
+    0x4A, 0xCA, 0x75, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xF6, 0xAE, 0x19, 0xEA,
+    0x5F, 0x2F, 0x49, 0xE9, 0x29, 0xF3, 0xAE, 0x4F, 0x92, 0xF4, 0x9F, 0x2E, 0xA5, 0xFA, 0x0A, 0xE6,
+    0x9F, 0x0F, 0x7F, 0xFA, 0x79, 0xFE, 0x71, 0xFE, 0x71, 0x9F, 0xCA, 0x72, 0xFC, 0x73, 0xAF, 0x73,
+    0x9E, 0xA7, 0x3F, 0x96, 0x99, 0x9A, 0xFC, 0x7F, 0xF9, 0x7F, 0xF7, 0x0F, 0xE7, 0x1F, 0xA9, 0x70,
+    0x69, 0x29, 0x97, 0x29, 0xE9, 0x0A, 0xCA, 0x71, 0xFC, 0x9A, 0xCA, 0x71, 0xD0, 0xFC, 0x97, 0x09,
+    0xD1, 0xF7, 0x2A, 0xA2, 0x9A, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAF, 0x70,
+    0xFA, 0x0F, 0x96, 0x9F, 0x1F, 0xC6, 0xFA, 0x19, 0xF9, 0x49, 0xF3, 0xFC, 0x4F, 0xA3, 0x9F, 0x92,
+    0xAF, 0x5F, 0xC2, 0xFA, 0x59, 0xFA, 0x0A, 0xF7, 0xFC, 0x0F, 0xC7, 0x9F, 0xFC, 0x97, 0x0F, 0xFC,
+    0x71, 0xAF, 0xE9, 0x72, 0xFE, 0x73, 0xAF, 0xC9, 0x74, 0xFC, 0x75, 0xFC, 0x74, 0x9F, 0xC7, 0x49,
+    0xFC, 0x74, 0x9F, 0xC7, 0x4A, 0xFC, 0x74, 0xAF, 0xC6, 0x59, 0x92, 0x99, 0x70, 0xAE, 0x90, 0xAC,
+    0xA7, 0xFC, 0x0A, 0xC9, 0x69, 0xD0, 0xFC, 0x96, 0x9D, 0x1F, 0x70, 0xAA, 0x2A, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x4F, 0x6A, 0xE1, 0x9E, 0xA5, 0xF2, 0xF4, 0x9E, 0x92, 0x9F, 0x3A,
+    0xE4, 0xF9, 0x2F, 0x49, 0xF2, 0xEA, 0x5F, 0xA0, 0xAE, 0x69, 0xF0, 0xF7, 0xFF, 0xA7, 0x9F, 0xE7,
+    0x1F, 0xE7, 0x19, 0xFC, 0xA7, 0x2F, 0xC7, 0x3A, 0xF7, 0x39, 0xEA, 0x73, 0xF9, 0x69, 0x99, 0xAF,
+    0xC7, 0xFF, 0x97, 0xFF, 0x70, 0xFE, 0x71, 0xFA, 0x97, 0x00, 0x9F, 0xFF, 0x09, 0xFF, 0xF0, 0x9F,
+    0xFF, 0x00, 0x9F, 0xFF, 0x09, 0xFF, 0xF0, 0x9F, 0xFF, 0x00, 0xAF, 0xFF, 0xFD, 0x9A, 0xFF, 0xFF,
+    0xD9, 0xAF, 0xFF, 0xFD, 0x90, 0x77, 0x19, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0x9A, 0xFF, 0xFF, 0x99,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x77, 0x71, 0x9F, 0xFF, 0xFF, 0xFC, 0xAF,
+    0xFF, 0xFF, 0xFC, 0xAF, 0xFF, 0xFF, 0xFA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x71, 0x9F, 0xFF, 0xFF, 0xFC, 0xAF, 0xFF, 0xFF, 0xFC, 0xAF, 0xFF,
+    0xFF, 0xFA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x09,
+    0xE3, 0xE1, 0x9D, 0xA3, 0xE1, 0x9D, 0xA3, 0xE1, 0x9D, 0xA3, 0xE1, 0x9D, 0xA3, 0xE1, 0x9D, 0xA3,
+    0xE1, 0xAD, 0xA2, 0x9E, 0x1A, 0xDA, 0x29, 0xE1, 0xAD, 0xA2, 0x9D, 0xA1, 0xAD, 0x92, 0x9D, 0xA1,
+    0xAD, 0x92, 0x9D, 0xA1, 0xAD, 0x92, 0x9D, 0xA1, 0xAD, 0x92, 0x9D, 0xA1, 0xAD, 0x92, 0x9D, 0xA1,
+    0xE9, 0x2A, 0xDA, 0x1E, 0x92, 0xAD, 0xA1, 0xE9, 0x2A, 0xD9, 0x1E, 0x3A, 0xD9, 0x1E, 0x3A, 0xD9,
+    0x1E, 0x3A, 0xD9, 0x1E, 0x3A, 0xD9, 0x1E, 0x3A, 0xD9, 0x1A, 0xAA, 0x39, 0xAA, 0x10, 0x0F, 0xFF,
+    0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x77, 0x77, 0x72, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0,
+    0xFF, 0xFF, 0xF0, 0x9F, 0xCA, 0x2F, 0xCA, 0x2F, 0xCA, 0x2A, 0xFA, 0x3F, 0xC3, 0xFC, 0x3A, 0xFA,
+    0x29, 0xFC, 0x3A, 0xAA, 0xAA, 0x00, 0x1F, 0xD2, 0xFD, 0x2F, 0xCA, 0x2A, 0xF9, 0x2F, 0xC2, 0x9F,
+    0xA2, 0xFC, 0x92, 0xFC, 0x3A, 0xAA, 0xA9, 0x20, 0x09, 0xFC, 0xA0, 0x9F, 0xC9, 0x1F, 0xC2, 0xFC,
+    0x19, 0xFA, 0x1F, 0xC2, 0xFC, 0x1A, 0xFA, 0x19, 0xAA, 0xAA, 0x20, 0x9F, 0xCA, 0x2F, 0xCA, 0x2F,
+    0xCA, 0x2A, 0xFA, 0x3F, 0xC3, 0xFC, 0x3A, 0xFA, 0x29, 0xFC, 0x3A, 0xAA, 0xAA, 0x00, 0x9F, 0xCA,
+    0x1F, 0xD2, 0xFC, 0xA1, 0xFD, 0x2F, 0xCA, 0x1A, 0xFA, 0x2A, 0xFA, 0x19, 0xFA, 0x3F, 0xC2, 0xFC,
+    0x3F, 0xC2, 0xAF, 0x92, 0xAF, 0xA1, 0x9F, 0xA2, 0x9F, 0xC2, 0xFC, 0x3A, 0xAA, 0xAA, 0x29, 0xAA,
+    0xAA, 0x00, 0x1F, 0xD1, 0xAF, 0xC9, 0x1F, 0xD1, 0xAF, 0xC2, 0xFC, 0xA1, 0xAF, 0xA2, 0xAF, 0x91,
+    0xAF, 0x92, 0xFC, 0x2F, 0xC2, 0x9F, 0xA2, 0xFC, 0x2F, 0xC9, 0x1A, 0xFA, 0x2F, 0xC2, 0xFC, 0x92,
+    0xAA, 0xAA, 0x92, 0xAA, 0xAA, 0xA2, 0x09, 0xFC, 0xA0, 0x9F, 0xC9, 0x1F, 0xC2, 0xFC, 0x19, 0xFA,
+    0x1F, 0xC2, 0xFC, 0x1A, 0xFA, 0x19, 0xAA, 0xAA, 0x20, 0x9F, 0xCA, 0x1F, 0xD2, 0xFC, 0xA1, 0xFD,
+    0x2F, 0xCA, 0x1A, 0xFA, 0x2A, 0xFA, 0x19, 0xFA, 0x3F, 0xC2, 0xFC, 0x3F, 0xC2, 0xAF, 0x92, 0xAF,
+    0xA1, 0x9F, 0xA2, 0x9F, 0xC2, 0xFC, 0x3A, 0xAA, 0xAA, 0x29, 0xAA, 0xAA, 0x00, 0x6A, 0xAA, 0x73,
+    0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73,
+    0xAE, 0x99, 0xAA, 0x3A, 0xFF, 0xE9, 0x2F, 0xFF, 0xA1, 0xAF, 0xFF, 0xC1, 0x99, 0x99, 0x9A, 0xE7,
+    0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3F, 0x73, 0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x73,
+    0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x73, 0x9D, 0xA7,
+    0x4D, 0xA7, 0x5C, 0xA7, 0x5A, 0x97, 0x69, 0x77, 0x50, 0x77, 0x4A, 0xDA, 0x72, 0xEA, 0x72, 0xEA,
+    0x72, 0xEA, 0x72, 0xEA, 0x72, 0xEA, 0x72, 0xEA, 0x72, 0xEA, 0x72, 0xE9, 0x69, 0x99, 0x9F, 0xEA,
+    0x19, 0xFF, 0xF1, 0xAF, 0xFF, 0x90, 0xFF, 0xCA, 0xA9, 0x99, 0x5E, 0x97, 0x2E, 0x97, 0x2E, 0x97,
+    0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x19, 0xFE, 0x92, 0xFF, 0xEA, 0x1A, 0xFF, 0xF1, 0xFF, 0xA9,
+    0x99, 0x95, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x73, 0xAD, 0x74,
+    0xD7, 0x49, 0xC7, 0x5C, 0x77, 0x40, 0x3A, 0xFF, 0xF9, 0x5F, 0xFF, 0xC9, 0x5F, 0xFF, 0xCA, 0x49,
+    0xFF, 0xFC, 0xA4, 0x9F, 0xFF, 0xD4, 0xAF, 0xFF, 0xD4, 0xFF, 0xFE, 0x4F, 0xFF, 0xE4, 0xFF, 0xFE,
+    0x92, 0x9F, 0xFF, 0xEA, 0x2A, 0xFF, 0xFE, 0xA2, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF,
+    0xC1, 0x9F, 0xFF, 0xFC, 0x19, 0xFF, 0xFF, 0xC9, 0x0A, 0xFF, 0xFF, 0xC9, 0x0F, 0xFF, 0xFD, 0xA0,
+    0xFF, 0xFF, 0xDA, 0x71, 0xE9, 0x4F, 0xA3, 0xFD, 0xA1, 0xFE, 0x1F, 0xD9, 0x1F, 0x93, 0xAC, 0xA7,
+    0x50, 0x19, 0x99, 0x29, 0xEA, 0x1A, 0xF1, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x19, 0x99, 0x29, 0xEA,
+    0x1A, 0xF1, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x19, 0x99, 0x49, 0x99, 0x94, 0x99, 0x92, 0xAE, 0x93,
+    0xF3, 0xAE, 0x91, 0xFA, 0x3F, 0x92, 0xFA, 0x1F, 0xA3, 0xF9, 0x2F, 0xA1, 0xFC, 0x29, 0xFA, 0x2F,
+    0xC0, 0x9F, 0xC2, 0xAF, 0xA1, 0x9F, 0xC0, 0xAD, 0x9A, 0xD9, 0xAD, 0x90, 0x75, 0x99, 0x77, 0xE4,
+    0x9D, 0x95, 0xAD, 0xA4, 0xC9, 0x0C, 0x5E, 0x49, 0xCA, 0xAC, 0x93, 0xE9, 0x49, 0xC9, 0xAC, 0xA2,
+    0x9E, 0x59, 0xC9, 0x0C, 0x92, 0xE9, 0x6F, 0x2A, 0xE7, 0x9D, 0xA1, 0x9E, 0x76, 0xEA, 0x75, 0xAE,
+    0x76, 0xE9, 0x75, 0xF7, 0x59, 0xE9, 0x75, 0xF7, 0x5A, 0xE1, 0x9A, 0x29, 0xA5, 0xEA, 0x09, 0xA0,
+    0xC0, 0x9A, 0x9A, 0x3F, 0x1A, 0xAA, 0xC0, 0xAA, 0xAC, 0x29, 0xEA, 0x1A, 0xAA, 0xC0, 0xCA, 0xAC,
+    0x2F, 0x2A, 0xE0, 0xAE, 0x1A, 0xE9, 0x3D, 0x91, 0xD9, 0x1F, 0x75, 0x1F, 0xD2, 0xFD, 0x2F, 0xC9,
+    0x2F, 0xC3, 0xFC, 0x29, 0xFA, 0x2F, 0xC9, 0x2F, 0xC3, 0xAA, 0xAA, 0x92, 0x1F, 0xD1, 0xAF, 0xC9,
+    0x1F, 0xD1, 0xAF, 0xC2, 0xFC, 0x91, 0xAF, 0xA2, 0xFC, 0x2A, 0xF9, 0x2F, 0xC2, 0xFC, 0x29, 0xFA,
+    0x2F, 0xC2, 0xFC, 0x91, 0xAF, 0xA2, 0xFC, 0x2F, 0xC9, 0x2A, 0xAA, 0xA9, 0x2A, 0xAA, 0xAA, 0x20,
+    0x77, 0x69, 0xD9, 0x2E, 0x2A, 0xD3, 0xF1, 0x9E, 0x91, 0xEA, 0x19, 0xE9, 0x1F, 0x1A, 0xE2, 0xEA,
+    0x19, 0xE1, 0x9E, 0x91, 0xAE, 0x2E, 0x91, 0xEA, 0x2A, 0xCA, 0x3D, 0x92, 0xDA, 0x77, 0x60, 0x7D,
+    0xA2, 0xAE, 0x3E, 0xA2, 0x9E, 0x3A, 0xE3, 0xAD, 0x70, 0x74, 0xAC, 0xA1, 0xAD, 0x29, 0xE9, 0x9E,
+    0xA2, 0xF0, 0xF2, 0x9E, 0x90, 0xEA, 0x29, 0xE0, 0x9E, 0x3A, 0xD1, 0x9D, 0x74, 0x77, 0x49, 0xD2,
+    0x9D, 0x92, 0xAD, 0x3F, 0x1F, 0x19, 0xEA, 0x2A, 0xE9, 0x09, 0xEA, 0x1F, 0x3F, 0x1A, 0xE2, 0xEA,
+    0x3E, 0x91, 0xAD, 0xA1, 0x9E, 0x4D, 0x92, 0xAC, 0xA2, 0x9D, 0x77, 0x40, 0x5D, 0x97, 0x1F, 0x70,
+    0xFD, 0x6F, 0xF9, 0x29, 0xF9, 0x0F, 0xA1, 0xAA, 0xAA, 0x91, 0x9A, 0xAA, 0xA9, 0x75, 0x9C, 0x4A,
+    0xD3, 0xAE, 0x2F, 0x91, 0xF2, 0xEA, 0x29, 0xF3, 0xFC, 0x3F, 0xC3, 0xFA, 0x3E, 0x94, 0xAC, 0x6A,
+    0x00, 0x7A, 0xA5, 0x9D, 0x49, 0xE4, 0xAE, 0x93, 0xAE, 0xA3, 0x9E, 0x92, 0x9F, 0x19, 0xF9, 0x0A,
+    0xF9, 0x1F, 0x92, 0xE9, 0x3A, 0xC5, 0x95, 0x73, 0xAE, 0x77, 0x7F, 0x97, 0x76, 0xFA, 0x77, 0x6F,
+    0xA7, 0x49, 0xFC, 0x91, 0x9F, 0xC2, 0xFC, 0x59, 0xFC, 0x91, 0x99, 0x99, 0x90, 0x9F, 0xC9, 0x6A,
+    0xFC, 0x95, 0x9F, 0xCA, 0x70, 0xFD, 0x93, 0x9F, 0xD7, 0x2F, 0xD9, 0x19, 0xFD, 0x74, 0xFD, 0x99,
+    0xFD, 0x97, 0x49, 0xFF, 0xF9, 0x70, 0xF1, 0xAF, 0xFD, 0xA1, 0x9E, 0x91, 0x9F, 0x2A, 0xFF, 0xC2,
+    0xAE, 0xA1, 0x9F, 0x3F, 0xF3, 0xFA, 0x1A, 0xF3, 0xFE, 0x93, 0xFC, 0x1F, 0xC9, 0x1A, 0xFF, 0x3F,
+    0xC1, 0x99, 0x99, 0x91, 0xAF, 0xFD, 0x29, 0x99, 0x99, 0x79, 0xFF, 0xF7, 0x59, 0xFF, 0xFC, 0xA7,
+    0x4F, 0xE9, 0xFE, 0xA7, 0x2F, 0xEA, 0x1F, 0xEA, 0x70, 0xFF, 0x29, 0xFE, 0x96, 0xAF, 0xE4, 0xAF,
+    0xE9, 0x4A, 0xFE, 0x95, 0xFF, 0x39, 0xFE, 0x97, 0xFF, 0x77, 0x77, 0x70, 0x99, 0x99, 0x77, 0x7F,
+    0x77, 0x69, 0xF7, 0x76, 0xAF, 0x77, 0x6A, 0xF9, 0x77, 0x5F, 0xC9, 0x73, 0x72, 0x99, 0x5A, 0xC9,
+    0x4A, 0xD9, 0x3A, 0xDA, 0x3E, 0xA3, 0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0x92, 0x9E, 0x92, 0x9E, 0x92,
+    0x9E, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xF9, 0x3A, 0xD5, 0x9C, 0x69, 0x77, 0x77, 0x73,
+    0xFA, 0x19, 0xFA, 0x19, 0xFC, 0x1A, 0xFC, 0x1F, 0xD1, 0xFD, 0x90, 0xFD, 0x90, 0x77, 0x6A, 0x76,
+    0xC9, 0x74, 0x9D, 0x74, 0x9E, 0x73, 0x9E, 0x73, 0xAE, 0x70, 0x9F, 0xE9, 0x5A, 0xFF, 0xCA, 0x3F,
+    0xFF, 0xA2, 0xF9, 0xFF, 0x92, 0xCA, 0x1F, 0x0E, 0xA6, 0xF0, 0xF6, 0xEA, 0x0A, 0xE6, 0xEA, 0x0A,
+    0xE6, 0xEA, 0x0A, 0xE6, 0xEA, 0x0F, 0x59, 0xEA, 0xAE, 0xA5, 0x9F, 0xF6, 0x9F, 0xE9, 0x69, 0xFD,
+    0xA7, 0x9F, 0xC9, 0x70, 0x9F, 0x97, 0x19, 0xF9, 0x71, 0x9F, 0x97, 0x1A, 0xF9, 0x71, 0xAD, 0x97,
+    0x39, 0x77, 0x77, 0x77, 0x76, 0xAE, 0xA7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x19, 0xFC, 0x97,
+    0x09, 0xFC, 0x97, 0x0A, 0xFC, 0xA7, 0x0F, 0xDA, 0x70, 0xFE, 0x40, 0x9F, 0xFF, 0x09, 0xFF, 0xF0,
+    0x9F, 0xFF, 0x00, 0x09, 0xAA, 0xA9, 0x91, 0x9A, 0xA9, 0x0A, 0xE3, 0xE1, 0x9F, 0xFD, 0x2A, 0xFF,
+    0x49, 0xAF, 0x92, 0x6A, 0xA7, 0x7D, 0x1A, 0x71, 0xD9, 0xD9, 0xD7, 0x09, 0xFE, 0xA7, 0x29, 0xF9,
+    0x72, 0x9F, 0xE9, 0x70, 0xFC, 0xAD, 0x97, 0x09, 0xA0, 0xD1, 0xA0, 0x97, 0xAC, 0x0D, 0x90, 0x9D,
+    0x1A, 0x19, 0x09, 0xD0, 0x9D, 0xA9, 0xD9, 0xD1, 0xDA, 0xDA, 0xFF, 0xC9, 0x09, 0xFE, 0x99, 0xAF,
+    0x93, 0x9F, 0x90, 0x9F, 0xE9, 0x0A, 0xFF, 0xF9, 0xD1, 0xD9, 0xD9, 0xDA, 0xA0, 0xD5, 0x90, 0xD5,
+    0xAA, 0x7A, 0x97, 0x30, 0x75, 0x99, 0x75, 0xE7, 0x4A, 0xDA, 0x74, 0xE7, 0x4E, 0xA7, 0x39, 0xE7,
+    0x4E, 0x97, 0x3A, 0xE7, 0x4E, 0x97, 0x3E, 0xA7, 0x39, 0xE7, 0x4E, 0xA7, 0x3A, 0xE7, 0x39, 0xE9,
+    0x73, 0xF7, 0x3A, 0xE9, 0x73, 0xEA, 0x73, 0xF7, 0x39, 0xEA, 0x73, 0xF7, 0x3A, 0xE9, 0x73, 0xF7,
+    0x30, 0x77, 0x77, 0x3A, 0xF9, 0x70, 0x9F, 0xA7, 0xAF, 0xF9, 0x49, 0xFF, 0xA3, 0x9F, 0xFE, 0x92,
+    0xAF, 0xFE, 0x2F, 0xCA, 0x99, 0x9F, 0x1A, 0xFA, 0x99, 0x9F, 0xA2, 0xD9, 0x49, 0xEA, 0x1D, 0xA5,
+    0xF2, 0x99, 0x6F, 0x2A, 0x69, 0xE9, 0x72, 0xAE, 0x73, 0xEA, 0x72, 0x9E, 0x73, 0xEA, 0x72, 0x9E,
+    0x97, 0x2E, 0xA7, 0x2A, 0xE7, 0x3E, 0x97, 0x2F, 0x72, 0xAE, 0x97, 0x1F, 0x97, 0x1A, 0xF7, 0x0A,
+    0xFC, 0x70, 0x9F, 0xC9, 0x6A, 0xFD, 0x79, 0xFD, 0xA7, 0xFD, 0x70, 0xAF, 0xC9, 0x70, 0xFA, 0x71,
+    0xAF, 0x72, 0xFA, 0x71, 0xAF, 0x72, 0xFA, 0x71, 0xFC, 0x71, 0x9F, 0xA7, 0x1F, 0xC7, 0x19, 0xE9,
+    0x72, 0xEA, 0x72, 0x9A, 0x75, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x99, 0x97, 0x39,
+    0x99, 0x97, 0x29, 0xEA, 0x72, 0xF7, 0x2A, 0xEA, 0x72, 0xF7, 0x2F, 0xC7, 0x19, 0xF9, 0x71, 0xFC,
+    0x71, 0xAF, 0x97, 0x1F, 0xC7, 0x1F, 0xCA, 0x40, 0x77, 0x75, 0x9A, 0xEA, 0x97, 0x2A, 0x49, 0xFF,
+    0xC7, 0x1C, 0xA2, 0xAF, 0xFE, 0x79, 0xDA, 0x1F, 0xC9, 0x99, 0xAF, 0x69, 0xE1, 0x9D, 0x94, 0xAE,
+    0x95, 0x9E, 0x2A, 0x7F, 0x5A, 0xE7, 0x3F, 0x5A, 0xE7, 0x3A, 0xE5, 0xAE, 0x73, 0xAE, 0x5F, 0x73,
+    0xF5, 0xF7, 0x29, 0xEA, 0x5F, 0x71, 0x9F, 0x6E, 0xA7, 0x9A, 0xFA, 0x6E, 0xA6, 0xFE, 0x69, 0xEA,
+    0x59, 0xFC, 0xA7, 0x9E, 0xA5, 0x9F, 0x97, 0x09, 0xEA, 0x59, 0xF9, 0x71, 0xAD, 0xA5, 0x9F, 0x97,
+    0x29, 0xCA, 0x5A, 0xF9, 0x74, 0x95, 0xAD, 0xA9, 0x77, 0x4A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x75, 0x99, 0x99, 0x72, 0xAF, 0x5A, 0xE9, 0x71, 0xFC, 0x5F, 0x97, 0x1F, 0xC9, 0x4F, 0xA7, 0x09,
+    0xFC, 0x93, 0x9F, 0xA7, 0x09, 0xFC, 0xA3, 0x9F, 0xC7, 0x0A, 0xFC, 0xA7, 0x72, 0xFE, 0x77, 0x7A,
+    0x93, 0x9A, 0xEA, 0x97, 0xAC, 0x90, 0x9F, 0xFC, 0x6A, 0xDA, 0xFF, 0xE5, 0xFF, 0x99, 0x9A, 0xF4,
+    0xFD, 0x5A, 0xE9, 0x3E, 0x9A, 0x7E, 0xA3, 0xE9, 0x70, 0xF3, 0xE9, 0x70, 0xF2, 0x9E, 0x97, 0x0F,
+    0x29, 0xE9, 0x70, 0xEA, 0x29, 0xE9, 0x79, 0xEA, 0x2A, 0xE9, 0x69, 0xF3, 0xAE, 0x59, 0xFC, 0xA3,
+    0xAE, 0x4F, 0xDA, 0x4F, 0x39, 0xFC, 0xA5, 0xF3, 0x9F, 0x97, 0xAD, 0x39, 0xF7, 0x19, 0xC3, 0xAF,
+    0x72, 0x93, 0xAF, 0x77, 0xEA, 0x97, 0x7A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x1F, 0x92, 0x99, 0x99,
+    0x79, 0xFA, 0x2F, 0x7A, 0xFC, 0x2F, 0x96, 0xAF, 0xC2, 0xFA, 0x6F, 0xD1, 0x9F, 0xA6, 0xFD, 0x1A,
+    0xFC, 0x59, 0xFD, 0x97, 0x40, 0x77, 0x77, 0x1A, 0x97, 0x6A, 0xD7, 0x6A, 0xE7, 0x6E, 0xA7, 0x6E,
+    0x76, 0x9E, 0x76, 0xEA, 0x76, 0xE9, 0x75, 0x9E, 0x69, 0x99, 0x93, 0xAE, 0x59, 0xEA, 0x3E, 0xA5,
+    0xAF, 0x3E, 0x95, 0xAF, 0x2A, 0xE6, 0xFC, 0x2F, 0x6F, 0xC2, 0xEA, 0x75, 0x9E, 0x76, 0xAE, 0x76,
+    0xEA, 0x75, 0x9E, 0x97, 0x5A, 0xE7, 0x6F, 0x76, 0xEA, 0x75, 0x9E, 0x97, 0x5F, 0x76, 0xF3, 0xF5,
+    0x9E, 0xA2, 0x9F, 0x5A, 0xE3, 0x9F, 0x5F, 0x3A, 0xF5, 0xEA, 0x3F, 0xC9, 0x3A, 0xE9, 0x39, 0x99,
+    0x99, 0x4F, 0x76, 0xF7, 0x59, 0xEA, 0x75, 0xAE, 0x97, 0x5F, 0x75, 0x9F, 0x75, 0xAE, 0xA7, 0x5F,
+    0x76, 0xF7, 0x59, 0xE7, 0x6D, 0xA7, 0x7C, 0x97, 0x79, 0x77, 0x10, 0x19, 0xDA, 0x29, 0xCA, 0x0C,
+    0xA1, 0xAC, 0x19, 0xC1, 0xD9, 0xC9, 0xC9, 0x0D, 0xAC, 0x9C, 0x90, 0xD9, 0xC9, 0xC9, 0x0D, 0x90,
+    0xD9, 0x0A, 0xFC, 0x2F, 0xA3, 0xAA, 0x91, 0x49, 0x5A, 0xC9, 0x39, 0xD9, 0x3C, 0xAC, 0xA2, 0xCA,
+    0x0C, 0xA1, 0xAC, 0xAA, 0xD9, 0x0F, 0xDA, 0x39, 0xD4, 0x9D, 0x00, 0x99, 0xAA, 0xA9, 0x0A, 0xFC,
+    0x0A, 0xC4, 0xAC, 0x4A, 0xEA, 0x1A, 0xAA, 0xAD, 0x4A, 0xC9, 0x9A, 0x1D, 0x9A, 0xFC, 0x0F, 0xCA,
+    0x19, 0x99, 0x20, 0x19, 0xAA, 0xA1, 0xAF, 0x09, 0xC9, 0x3A, 0xC9, 0xA9, 0x1F, 0xD0, 0xDA, 0x0A,
+    0xCA, 0xD2, 0xCA, 0xD9, 0x09, 0xCA, 0x9F, 0xC9, 0x09, 0xAC, 0xA9, 0x00, 0x6F, 0xEA, 0xAA, 0xAD,
+    0xA3, 0x9C, 0xA3, 0xD9, 0x3D, 0x39, 0xD3, 0xAD, 0x3E, 0x3D, 0xA2, 0x9A, 0xA9, 0x00, 0x72, 0xAE,
+    0xA2, 0x9C, 0x90, 0xAC, 0x91, 0x9C, 0xA0, 0xAC, 0x92, 0xAF, 0x3D, 0xAD, 0x91, 0xD2, 0xD1, 0xD9,
+    0x09, 0xD1, 0xAF, 0xCA, 0x2A, 0xEA, 0x72, 0x29, 0x94, 0xFA, 0x1A, 0xC1, 0x9C, 0x90, 0xC9, 0x2D,
+    0x0C, 0xA2, 0xD0, 0xAF, 0xD1, 0x9F, 0xC5, 0xCA, 0x0A, 0xFC, 0x90, 0xAF, 0x97, 0x00, 0x77, 0x0E,
+    0x0A, 0xEA, 0x94, 0xFF, 0xDA, 0x29, 0xFF, 0xE9, 0x19, 0xFA, 0x90, 0x9F, 0x19, 0xEA, 0x39, 0xE1,
+    0x9E, 0x5E, 0x1A, 0xE5, 0xE9, 0x0A, 0xE5, 0xE9, 0x0A, 0xE4, 0x9E, 0xA0, 0xF9, 0x39, 0xEA, 0x0F,
+    0x93, 0xAE, 0xA0, 0xF9, 0x3A, 0xEA, 0x0F, 0xA3, 0xAF, 0x0F, 0xA3, 0xFC, 0x0F, 0xA3, 0xFC, 0x09,
+    0xE2, 0xCA, 0x0A, 0xC0, 0xAC, 0x2C, 0x9D, 0x9C, 0x0C, 0xAD, 0x9C, 0x9C, 0xAD, 0x9C, 0x9C, 0xAD,
+    0x90, 0xAC, 0xAA, 0xFC, 0x90, 0xFC, 0x19, 0xE1, 0x1A, 0xA3, 0xE2, 0x9E, 0x4D, 0x4D, 0x4D, 0x4D,
+    0x4D, 0x2F, 0xD9, 0xFD, 0x96, 0x09, 0xAA, 0xA1, 0xAF, 0xC0, 0xA9, 0x1A, 0xC9, 0x39, 0xCA, 0x3A,
+    0xCA, 0x29, 0xD2, 0xAD, 0xA1, 0xEA, 0x1A, 0xFF, 0xFC, 0x60, 0x19, 0x99, 0x19, 0xFC, 0x49, 0xC9,
+    0x39, 0xC9, 0x09, 0xF1, 0x9A, 0xE9, 0x39, 0xCA, 0x9C, 0xAA, 0xDA, 0xAF, 0xC9, 0xAF, 0xA0, 0x3C,
+    0xA4, 0xAD, 0x39, 0xE3, 0xC9, 0xD2, 0xD0, 0xD1, 0xAC, 0xA9, 0xDA, 0x0F, 0xE0, 0x99, 0x99, 0xD9,
+    0x4D, 0x5D, 0x10, 0x99, 0x99, 0x99, 0x0A, 0xFC, 0x0A, 0xC4, 0xAC, 0x4F, 0xA1, 0xAA, 0xAA, 0xD4,
+    0xAC, 0x9A, 0xA9, 0xAD, 0x0F, 0xD0, 0xAE, 0xA1, 0x19, 0xAA, 0xA9, 0x0A, 0xF9, 0x9C, 0x93, 0xAC,
+    0x9A, 0x91, 0xFD, 0x0D, 0xA0, 0x9C, 0xAD, 0x2D, 0xAC, 0x91, 0xD9, 0xFC, 0xA0, 0x9E, 0xA0, 0xAA,
+    0xAA, 0xAA, 0xAF, 0xE3, 0x9C, 0xA3, 0xAC, 0x93, 0xD9, 0x3D, 0x3A, 0xD3, 0xE3, 0xDA, 0x29, 0xDA,
+    0x70, 0x19, 0xEA, 0x3D, 0x9A, 0xC9, 0x19, 0xC9, 0x1C, 0xA1, 0x9C, 0xA0, 0xAC, 0xA2, 0xAF, 0x3F,
+    0xC9, 0x1D, 0x91, 0xD1, 0xD9, 0x09, 0xD1, 0xAF, 0xD2, 0xAE, 0xA7, 0x20, 0x19, 0x94, 0xFC, 0x1A,
+    0xC1, 0x9C, 0xA0, 0xCA, 0x2D, 0x0C, 0xA2, 0xD0, 0x9F, 0xD1, 0x9F, 0xC5, 0xD0, 0xAF, 0xC9, 0x0A,
+    0xFA, 0x71, 0x59, 0xDA, 0x6E, 0xA5, 0xAE, 0x59, 0xE9, 0x5F, 0x59, 0xE9, 0x5F, 0x59, 0xEA, 0x5A,
+    0xE6, 0xF5, 0x9E, 0x95, 0xAE, 0x6F, 0x6F, 0x6E, 0xA6, 0xEA, 0x59, 0xEA, 0x59, 0xEA, 0x59, 0xEA,
+    0x6E, 0xA6, 0xF6, 0xF6, 0xF9, 0x5A, 0xEA, 0x59, 0xF6, 0xF6, 0xFA, 0x59, 0xF6, 0xFA, 0x5A, 0xF6,
+    0xFA, 0x5A, 0xF9, 0x5F, 0xC5, 0xAF, 0x97, 0x20, 0x0A, 0xD9, 0x6A, 0xE7, 0xEA, 0x6A, 0xE9, 0x6F,
+    0x6A, 0xE9, 0x6F, 0x6A, 0xE7, 0xEA, 0x6F, 0x6A, 0xE6, 0x9E, 0x96, 0xF6, 0xF6, 0xF6, 0xAE, 0x6A,
+    0xE6, 0xAE, 0x6A, 0xE6, 0xF6, 0xF6, 0xF5, 0x9E, 0xA5, 0xAE, 0xA5, 0xF9, 0x49, 0xF5, 0xFA, 0x49,
+    0xF9, 0x4A, 0xF5, 0xFA, 0x4F, 0xC4, 0x9F, 0xA4, 0xFC, 0x4A, 0xF9, 0x77, 0x71, 0x9D, 0x1A, 0xCA,
+    0x71, 0xAD, 0x1D, 0xA7, 0x1E, 0x09, 0xD9, 0x71, 0xDA, 0x09, 0xD7, 0x19, 0xD9, 0x0A, 0xD7, 0x19,
+    0xD1, 0xE7, 0x09, 0xF9, 0xE9, 0x59, 0xFF, 0xDA, 0x4A, 0xFF, 0xE9, 0x3A, 0xFF, 0xF3, 0xAF, 0xFA,
+    0xF3, 0xFF, 0x1D, 0xA9, 0x2A, 0xFF, 0x09, 0xD9, 0x3F, 0xC9, 0xDA, 0x0A, 0xD3, 0x9F, 0xC0, 0xDA,
+    0x0A, 0xD3, 0xAF, 0xA9, 0xD9, 0x0E, 0x3F, 0xC9, 0xAD, 0x1D, 0xA3, 0xFC, 0x9E, 0x09, 0xD9, 0x3F,
+    0xC9, 0xDA, 0x09, 0xD4, 0xFF, 0xA0, 0xAD, 0x4F, 0xF9, 0x0E, 0x4A, 0xFE, 0xA9, 0xEA, 0xD2, 0xFF,
+    0xFE, 0x2F, 0xFF, 0xE2, 0x9F, 0xFF, 0xD3, 0xAF, 0xFF, 0xC4, 0xAF, 0xFF, 0x5A, 0xFF, 0xE5, 0xE0,
+    0x9D, 0x97, 0x1D, 0xA0, 0xAD, 0x71, 0x9D, 0x90, 0xE7, 0x19, 0xD1, 0xDA, 0x71, 0x9A, 0xA1, 0xAA,
+    0x95, 0x77, 0x71, 0x9A, 0xFD, 0xA9, 0x59, 0xFF, 0xDA, 0x4A, 0xFF, 0xE9, 0x3A, 0xFF, 0xF3, 0xAF,
+    0xFA, 0xAE, 0x3F, 0xD9, 0x71, 0xAF, 0xC7, 0x3F, 0xC7, 0x39, 0xFC, 0x73, 0xAF, 0xA7, 0x3A, 0xF9,
+    0x2A, 0xDA, 0xAD, 0x1F, 0xC9, 0x2A, 0xFD, 0x1F, 0xC9, 0x2A, 0xFA, 0xA1, 0xFD, 0x2A, 0xDA, 0x4F,
+    0xD9, 0x1A, 0xD5, 0xAF, 0xE9, 0xE9, 0x9A, 0xC1, 0x9F, 0xFF, 0xE2, 0xFF, 0xFE, 0x29, 0xFF, 0xFD,
+    0x3A, 0xFF, 0xFC, 0x4A, 0xFF, 0xF5, 0x9A, 0xFF, 0xD0, 0x77, 0x77, 0x7A, 0xF9, 0x70, 0xAF, 0xF9,
+    0x5A, 0xFF, 0xD9, 0x4E, 0x93, 0xEA, 0x4D, 0xA7, 0x29, 0xFF, 0xF3, 0x9F, 0xFF, 0x39, 0xFF, 0xF6,
+    0x9E, 0x75, 0xE7, 0x2F, 0xFF, 0xA3, 0xFF, 0xFA, 0x3A, 0xAA, 0xAF, 0xAA, 0xAA, 0x97, 0xEA, 0x74,
+    0xEA, 0x73, 0xAE, 0xA7, 0x1A, 0xFC, 0x97, 0x0A, 0xFF, 0xCA, 0xA9, 0x3A, 0xFF, 0xFC, 0x2A, 0xFF,
+    0xFC, 0xA1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x77, 0x2F, 0x71, 0x9F, 0x96, 0xF7,
+    0x19, 0xFC, 0x59, 0xEA, 0x71, 0x9F, 0xC9, 0x49, 0xEA, 0x71, 0xAF, 0xD4, 0x9E, 0xA7, 0x1A, 0xFD,
+    0x93, 0xAE, 0xA7, 0x1A, 0xFE, 0x3A, 0xE9, 0x71, 0xFF, 0x92, 0xAE, 0x97, 0x1F, 0xFC, 0x2F, 0x97,
+    0x1F, 0xFC, 0x91, 0xF9, 0x4F, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFD, 0x0A, 0xAA, 0xAA, 0xFC,
+    0xAA, 0xFA, 0xFA, 0xAA, 0xA9, 0x49, 0xFC, 0x1F, 0x9F, 0x71, 0x9F, 0xC1, 0xAF, 0xF7, 0x1A, 0xFC,
+    0x19, 0xFF, 0x71, 0xAF, 0xC2, 0xFF, 0x71, 0xAF, 0xC2, 0x9F, 0xE7, 0x1F, 0xD3, 0xFE, 0x71, 0xFD,
+    0x3A, 0xFD, 0x71, 0xFD, 0x4F, 0xCA, 0x40, 0x77, 0x72, 0xFF, 0xCA, 0x73, 0xFF, 0xE9, 0x71, 0xFF,
+    0xF9, 0x70, 0xF3, 0x9F, 0x4F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x4F, 0x49, 0xF7, 0xF9, 0x99,
+    0xAA, 0xFA, 0x7F, 0xFF, 0xC9, 0x69, 0xFF, 0xFC, 0x79, 0xFF, 0xF7, 0x09, 0xFF, 0xE7, 0x19, 0xFF,
+    0xA9, 0x72, 0xAF, 0x77, 0x0A, 0xF7, 0x70, 0xAF, 0x97, 0x7A, 0xF9, 0x77, 0xFC, 0x97, 0x7F, 0xC9,
+    0x77, 0xFC, 0xA7, 0x7F, 0xCA, 0x73, 0x0F, 0xDA, 0x97, 0x72, 0xFF, 0xA7, 0x71, 0xFF, 0xC9, 0x77,
+    0x0E, 0x3E, 0x77, 0x0E, 0x3A, 0xD7, 0x70, 0xE3, 0xAD, 0x77, 0x0E, 0x3A, 0xD6, 0x9F, 0xA3, 0xE2,
+    0x9E, 0x59, 0xFD, 0x92, 0xFF, 0xD5, 0xE9, 0x9A, 0xC3, 0xFF, 0xC9, 0x5D, 0x96, 0x9F, 0xFA, 0x6D,
+    0x96, 0x9F, 0xFC, 0x6A, 0xDA, 0x59, 0xFC, 0xAE, 0xA6, 0xFC, 0x39, 0xF1, 0x9E, 0x69, 0xFC, 0x91,
+    0x9E, 0xA2, 0xE9, 0x7F, 0xC9, 0x0A, 0xEA, 0x2E, 0xA7, 0x1A, 0xDA, 0x0A, 0xEA, 0x2F, 0x59, 0x29,
+    0xE0, 0xAE, 0xA2, 0xF4, 0xAC, 0x91, 0xAE, 0x0A, 0xEA, 0x2F, 0x92, 0x9F, 0xFC, 0x0A, 0xEA, 0x2F,
+    0xA2, 0xFF, 0xC9, 0x0F, 0xC1, 0x9F, 0xA2, 0xFF, 0xA1, 0x99, 0x99, 0x92, 0x99, 0x99, 0x93, 0x9A,
+    0xEA, 0x97, 0x77, 0x50, 0x19, 0xDA, 0x71, 0xE3, 0x9D, 0xA7, 0x1E, 0x39, 0xE7, 0x09, 0xDA, 0x4E,
+    0x70, 0x9D, 0xA4, 0xE7, 0x0A, 0xD9, 0x4E, 0x97, 0xAD, 0x5E, 0x91, 0x9D, 0x2E, 0x2F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFD, 0xAA, 0xAF, 0xAF, 0xCA, 0xFA, 0xAA, 0x3E, 0x0A, 0xF0, 0x9D, 0xA6, 0xE0, 0xFC,
+    0x9A, 0xD9, 0x6E, 0x9F, 0xCA, 0xAD, 0x96, 0xFF, 0xFC, 0x7F, 0xDA, 0xFD, 0x7A, 0xFC, 0x9A, 0xFC,
+    0x7A, 0xFC, 0x0A, 0xFA, 0x79, 0xFC, 0x09, 0xFA, 0x79, 0xFA, 0x1F, 0x97, 0x0F, 0xA1, 0xF9, 0x70,
+    0xF9, 0x1A, 0xE7, 0x1F, 0x29, 0xE4, 0x0C, 0xAA, 0xA9, 0x97, 0x5F, 0xFC, 0x97, 0x1F, 0xFE, 0x4E,
+    0x0F, 0xFE, 0xA2, 0x9E, 0x0F, 0x92, 0x9E, 0x91, 0x9E, 0x0E, 0x59, 0xDA, 0x19, 0xE0, 0xE6, 0xE1,
+    0x9E, 0x0D, 0xA0, 0x9A, 0x99, 0x1E, 0x19, 0xE0, 0xDA, 0x09, 0xE1, 0xE1, 0x9E, 0x0D, 0xA0, 0x9E,
+    0x1E, 0x19, 0xE0, 0xDA, 0x09, 0xE1, 0xE1, 0x9E, 0x0D, 0xA0, 0x9E, 0x1A, 0xAC, 0x1A, 0xE0, 0xDA,
+    0x1E, 0x6A, 0xE0, 0xDA, 0x1E, 0xA5, 0xAE, 0x0D, 0xA1, 0xFA, 0x4F, 0x0D, 0xA1, 0x9F, 0xDA, 0xFD,
+    0x0D, 0xA2, 0xAF, 0xFF, 0x09, 0x95, 0xAF, 0xFD, 0x73, 0x99, 0xAA, 0xAD, 0xA0, 0x74, 0x99, 0x77,
+    0xAD, 0x74, 0x99, 0x9E, 0x99, 0x97, 0x0A, 0xFF, 0xC9, 0x7A, 0xFF, 0xC9, 0x73, 0xE7, 0x2A, 0xDA,
+    0x9E, 0x70, 0x9F, 0xFC, 0x70, 0xFF, 0xD7, 0xAD, 0x91, 0xAF, 0x7D, 0xA3, 0xF7, 0xD9, 0x3E, 0xA7,
+    0xD9, 0x3E, 0xA7, 0xDA, 0x3E, 0xA7, 0xFF, 0xDA, 0x79, 0xFF, 0xD7, 0x0A, 0xFF, 0xC7, 0x19, 0xAD,
+    0xA0, 0xE7, 0x77, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x39, 0xFF, 0xFD, 0x39, 0xFF, 0xFD,
+    0x30, 0x77, 0x72, 0x9A, 0xFC, 0xA7, 0x9F, 0xFC, 0x96, 0xFF, 0xD9, 0x5A, 0xFF, 0xD6, 0xFA, 0x73,
+    0x9F, 0x99, 0x96, 0xFF, 0xE5, 0x9F, 0xFE, 0xA4, 0xAF, 0xFF, 0x70, 0xAE, 0x75, 0xAE, 0x75, 0xAF,
+    0xE6, 0xFF, 0xE9, 0x49, 0xFF, 0xF4, 0xFF, 0xC9, 0x97, 0x29, 0xF7, 0x5F, 0xCA, 0x73, 0xFF, 0xE9,
+    0x5A, 0xFF, 0xD9, 0x6F, 0xFD, 0x97, 0xAF, 0xF9, 0x71, 0x9A, 0xFC, 0x77, 0x20, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x9F,
+    0xFF, 0xFD, 0x96, 0xF9, 0x19, 0x72, 0xFA, 0xAD, 0x72, 0xFF, 0x71, 0x9F, 0xF7, 0xAF, 0xFA, 0x79,
+    0xFE, 0xA7, 0x19, 0xFE, 0xA7, 0x19, 0xCA, 0x9F, 0xA9, 0xAC, 0x72, 0xFF, 0x72, 0xFF, 0x70, 0xAF,
+    0xFA, 0x69, 0xFF, 0x97, 0x09, 0xFE, 0xA7, 0x19, 0xFE, 0xA7, 0x19, 0xA0, 0x9F, 0xC7, 0x49, 0xFC,
+    0x74, 0x9F, 0xC6, 0x77, 0x76, 0xFF, 0xC9, 0x76, 0xFF, 0xE7, 0x5F, 0xFF, 0x74, 0xF2, 0xAF, 0xC5,
+    0xAF, 0xFF, 0xFF, 0xE6, 0xF5, 0xEA, 0x4A, 0xFF, 0xFF, 0xFE, 0x6F, 0x99, 0x9A, 0xAF, 0xA7, 0x2F,
+    0xFF, 0xC9, 0x71, 0x9F, 0xFF, 0xC7, 0x29, 0xFF, 0xF7, 0x39, 0xFF, 0xE7, 0x49, 0xFF, 0xA9, 0x75,
+    0xAF, 0x77, 0x3A, 0xF7, 0x73, 0xAF, 0x97, 0x72, 0xAF, 0x97, 0x72, 0xFC, 0x97, 0x72, 0xFC, 0x97,
+    0x72, 0xFC, 0xA7, 0x72, 0xFC, 0xA7, 0x50, 0x77, 0x75, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xE9, 0x77,
+    0x0E, 0x97, 0x70, 0xE7, 0x69, 0xAF, 0xEA, 0xA7, 0xAF, 0xFF, 0xA5, 0xFF, 0xFD, 0xA4, 0xFF, 0xFF,
+    0x3A, 0xFD, 0xAE, 0x90, 0x99, 0xAA, 0x3F, 0xD1, 0xE7, 0x09, 0xFC, 0x2E, 0x70, 0xAF, 0xA2, 0xE7,
+    0x0A, 0xF9, 0x2E, 0x70, 0xAF, 0x3E, 0x70, 0xFC, 0x3E, 0x70, 0xFC, 0x3F, 0xEA, 0xA9, 0x90, 0xFC,
+    0x3F, 0xFE, 0x0F, 0xC3, 0xFF, 0xE9, 0xFC, 0x92, 0xEA, 0xFE, 0xAA, 0xFC, 0x2E, 0x2F, 0xAA, 0x9F,
+    0xD1, 0xE2, 0xF2, 0xFF, 0xE9, 0xAF, 0xC2, 0xAF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x4F, 0xFF, 0xF5,
+    0xAF, 0xFF, 0xC9, 0x7A, 0xFE, 0xA9, 0x74, 0x9D, 0xA7, 0x70, 0x9D, 0xA7, 0x70, 0x9D, 0xA7, 0x70,
+    0x9A, 0xA9, 0x70, 0x49, 0xAA, 0xFC, 0xA7, 0x79, 0xFF, 0xCA, 0x76, 0xFF, 0xD9, 0x75, 0x9C, 0x91,
+    0x9F, 0xC7, 0x74, 0xF9, 0x77, 0x39, 0xEA, 0x77, 0x4E, 0xA6, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xF9, 0xFF, 0xFF, 0xFF, 0x97, 0x77, 0x0F, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0xF9, 0x1A, 0xF7, 0xAA, 0x71, 0x9F, 0xA3, 0x9A, 0xE9, 0x71, 0xFF, 0xFE, 0x71, 0xAF, 0xFF, 0xE7,
+    0x19, 0xFF, 0xFC, 0xA7, 0x39, 0xAF, 0xEA, 0x97, 0x77, 0x70, 0x5A, 0xAA, 0x71, 0xE7, 0x1E, 0x79,
+    0xFC, 0xA4, 0xAF, 0xE9, 0x2A, 0xFF, 0x92, 0xFE, 0x9A, 0x2A, 0xE0, 0xE4, 0xF0, 0xE4, 0xEA, 0x0E,
+    0x4E, 0xA0, 0xE4, 0xF0, 0xE4, 0xF0, 0xE4, 0xFA, 0xE9, 0x39, 0xFF, 0xA3, 0xFF, 0xCA, 0x3F, 0xFC,
+    0x93, 0x9A, 0xFA, 0x96, 0xAD, 0x97, 0x0A, 0xD9, 0x20, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA9, 0xFF, 0xFF, 0xF7, 0x77, 0x77, 0x77, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA1, 0xFF, 0xFF, 0xD9, 0x0F, 0xFF, 0xFD, 0x90, 0xFF, 0xFF, 0xD9, 0x7F, 0x97, 0x6F,
+    0x97, 0x6F, 0x97, 0x6F, 0x97, 0x6F, 0x97, 0x6F, 0xA7, 0x6F, 0xA7, 0x6F, 0xA7, 0x59, 0xFA, 0x75,
+    0x9F, 0xA7, 0x59, 0xFA, 0x75, 0x9F, 0xA7, 0x59, 0xFC, 0x75, 0x9F, 0xC6, 0xAF, 0xFF, 0xAF, 0xFF,
+    0xAF, 0xFF, 0x4E, 0xA7, 0x09, 0xE3, 0x9F, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x3A, 0xF3, 0xAF, 0xE9,
+    0x3A, 0xFD, 0xA4, 0xAF, 0xDA, 0x4A, 0xFE, 0xA7, 0x9F, 0x70, 0xAE, 0x97, 0xAF, 0x7A, 0xF7, 0xFC,
+    0x96, 0xFC, 0xA6, 0xFD, 0x69, 0x99, 0x99, 0x91, 0x2A, 0xAC, 0xA7, 0x2F, 0x72, 0xF1, 0x9C, 0x95,
+    0xFA, 0xE9, 0x5F, 0xF9, 0x39, 0xAF, 0xF9, 0x2A, 0xFE, 0xA9, 0x4A, 0xFD, 0x09, 0xD9, 0x2A, 0xFF,
+    0xD9, 0x29, 0x90, 0xFF, 0x92, 0x9A, 0xFF, 0xA9, 0xAA, 0x9A, 0xFD, 0xA9, 0x1A, 0xEA, 0xFD, 0x29,
+    0xEA, 0xAC, 0xA9, 0xE1, 0xAF, 0x4E, 0xAF, 0xC4, 0x9F, 0xF5, 0x9F, 0xD9, 0x69, 0xEA, 0x97, 0x74,
+    0x77, 0x70, 0xE7, 0x6E, 0x97, 0x5E, 0x97, 0x49, 0xFA, 0x72, 0xFF, 0x97, 0xFF, 0xD9, 0x5A, 0xFF,
+    0xE5, 0xFE, 0xAF, 0x5F, 0xAD, 0x9A, 0xE9, 0x4E, 0xAA, 0xDA, 0x0E, 0x93, 0x9E, 0x9A, 0xDA, 0x0E,
+    0xA3, 0x9E, 0x0A, 0xDA, 0x0E, 0xA3, 0x9E, 0x09, 0xDA, 0x0A, 0xDA, 0x4E, 0x09, 0xDA, 0x0A, 0xDA,
+    0x4E, 0x09, 0xDA, 0x0E, 0xA4, 0xE0, 0x9D, 0xA0, 0xEA, 0x4E, 0x09, 0xDA, 0x0E, 0xA4, 0xE9, 0x9E,
+    0x0E, 0x94, 0xEA, 0x9E, 0x0E, 0x94, 0xEA, 0x9E, 0x0E, 0x91, 0x77, 0x73, 0xFF, 0xCA, 0x72, 0xFF,
+    0xE9, 0x70, 0xFF, 0xF9, 0x7F, 0x39, 0xF7, 0xF5, 0xE9, 0x6F, 0x5E, 0xA6, 0xF4, 0x9F, 0x6F, 0x99,
+    0x9A, 0xAF, 0xA2, 0xFF, 0xFF, 0xC9, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF4, 0xFF, 0xFE, 0x5F, 0xFF,
+    0xA9, 0x71, 0xAF, 0x71, 0xAF, 0xFF, 0xE4, 0xAF, 0xFF, 0xE4, 0xAF, 0xFF, 0xE7, 0x2F, 0xC9, 0x76,
+    0xFC, 0x97, 0x6F, 0xCA, 0x76, 0xFC, 0xA7, 0x00, 0x69, 0xA7, 0x59, 0xDA, 0x74, 0xF7, 0x3F, 0x73,
+    0xF9, 0x72, 0xAE, 0xA7, 0x2A, 0xEA, 0x72, 0x9F, 0xFF, 0xE9, 0xFF, 0xFF, 0x0F, 0xFF, 0xF1, 0xFA,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x2F, 0x75, 0xF7, 0x49, 0xF7, 0x49, 0xEA, 0x74, 0xAD, 0x97, 0x5A,
+    0x97, 0x77, 0x00, 0x77, 0x72, 0x9C, 0xA7, 0x69, 0xF7, 0x4A, 0xFD, 0x72, 0xAF, 0xF7, 0x0F, 0xFE,
+    0x95, 0xFA, 0xEA, 0xF9, 0x29, 0xFA, 0x0E, 0x99, 0xFA, 0x1A, 0xE9, 0x1E, 0x91, 0xE9, 0x2A, 0xC9,
+    0x2E, 0x92, 0xC9, 0x71, 0xE9, 0x76, 0xE9, 0x76, 0xE9, 0x76, 0xE9, 0x76, 0xE9, 0x76, 0xE9, 0x76,
+    0xE9, 0x77, 0x71, 0x79, 0xA7, 0x6D, 0xA7, 0x4A, 0xE9, 0x74, 0xF9, 0x74, 0xF7, 0x5F, 0x74, 0x9F,
+    0x1A, 0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xEA, 0xAF, 0xFF, 0xE1, 0x99, 0x99, 0x99, 0x99, 0x99, 0xF9,
+    0x72, 0xF9, 0x72, 0xAE, 0x97, 0x2A, 0xEA, 0x72, 0x9E, 0xA7, 0x4E, 0x76, 0xC7, 0x77, 0x7E, 0x97,
+    0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x0A, 0xC3, 0xE9, 0x2A,
+    0x92, 0xAE, 0x91, 0xE9, 0x1E, 0x91, 0x9F, 0x90, 0xE9, 0x0F, 0xA2, 0x9F, 0xAE, 0xAF, 0xA5, 0xFF,
+    0xE9, 0x7F, 0xFC, 0x97, 0x1A, 0xFD, 0x74, 0xAF, 0x76, 0x9C, 0xA7, 0x70, 0x97, 0x00, 0x69, 0x5A,
+    0x73, 0xD9, 0x3D, 0xA7, 0x1A, 0xDA, 0x3E, 0x97, 0xAE, 0x5E, 0x95, 0x9E, 0x69, 0xE4, 0x9E, 0x70,
+    0x9E, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFE, 0x91, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0x29, 0xE7,
+    0x0A, 0xE4, 0xAE, 0x69, 0xE9, 0x5A, 0xE5, 0xE9, 0x7E, 0xA3, 0xEA, 0x71, 0xD9, 0x3A, 0xD7, 0x29,
+    0x95, 0xA5, 0x69, 0xA7, 0x49, 0xE7, 0x2A, 0xFC, 0x70, 0xFF, 0x6F, 0xFD, 0x93, 0xF9, 0xD9, 0xAE,
+    0x91, 0xAD, 0xA1, 0xD9, 0x09, 0xDA, 0x2A, 0xA2, 0xD9, 0x19, 0xA7, 0x0D, 0x97, 0x4D, 0x97, 0x4D,
+    0x97, 0x4D, 0x97, 0xD2, 0xD9, 0x1A, 0xC2, 0xAE, 0x1D, 0x90, 0xAD, 0xA2, 0xF9, 0xDA, 0xF4, 0xAF,
+    0xFC, 0x6A, 0xFE, 0x70, 0x9F, 0xA7, 0x29, 0xDA, 0x75, 0x96, 0x70, 0x99, 0x9A, 0x3F, 0xFE, 0x29,
+    0xFF, 0xE2, 0x9F, 0xFC, 0xAA, 0x29, 0xFC, 0x97, 0xAF, 0xD9, 0x6A, 0xFE, 0x95, 0xAD, 0xA9, 0xF9,
+    0x4E, 0x90, 0x9F, 0x93, 0xE9, 0x19, 0xF9, 0x2E, 0x92, 0x9F, 0x91, 0xE4, 0x9F, 0x90, 0x99, 0x69,
+    0xDA, 0x73, 0x9A, 0x10, 0x09, 0xA9, 0x99, 0x70, 0xAF, 0xFD, 0xA1, 0xAF, 0xFE, 0x19, 0xAF, 0xFD,
+    0x7F, 0xD6, 0xAF, 0xD5, 0xAF, 0xE4, 0xAF, 0x0E, 0x92, 0xAF, 0x1E, 0x91, 0xAF, 0x2A, 0xD9, 0x0A,
+    0xF3, 0xAD, 0xAA, 0xF4, 0xAD, 0xA0, 0xE7, 0x92, 0xA7, 0x20, 0x1C, 0x72, 0x9E, 0x71, 0xAE, 0xA4,
+    0xAD, 0xA0, 0xAE, 0xA3, 0xE9, 0x1F, 0xA2, 0xE9, 0x2F, 0x91, 0xE4, 0xF9, 0x0E, 0x5F, 0xAE, 0x6F,
+    0xDA, 0x69, 0xFC, 0xA1, 0xFF, 0xE9, 0x1F, 0xFE, 0x2F, 0xFE, 0x77, 0x72, 0xC7, 0x3E, 0x0A, 0xD9,
+    0x4F, 0x9A, 0xDA, 0x3F, 0xA0, 0x9E, 0x2A, 0xEA, 0x19, 0xE1, 0xAE, 0xA3, 0xE0, 0x9F, 0x4E, 0xAF,
+    0x5F, 0xE6, 0xAF, 0xC7, 0xAF, 0xFD, 0xA1, 0x9F, 0xFE, 0x2F, 0xFE, 0x76, 0x77, 0x71, 0x9C, 0x97,
+    0x70, 0xE9, 0x76, 0xAE, 0x97, 0x6F, 0x76, 0xF7, 0x6F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A,
+    0xFF, 0xFF, 0x90, 0xAF, 0xFF, 0xFC, 0x90, 0xF9, 0x76, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA2, 0x9F, 0xFF, 0xF9, 0x2A, 0xFF, 0xFE, 0x93, 0xAF, 0x77, 0xF9, 0x77, 0xE7, 0x70, 0xAC, 0x97,
+    0x77, 0x60, 0x73, 0xA7, 0x70, 0x9C, 0xA0, 0xCA, 0x76, 0x9D, 0xA0, 0xDA, 0x74, 0x9E, 0xA0, 0xEA,
+    0x72, 0x9F, 0xA0, 0xFA, 0x70, 0x9F, 0xCA, 0x0F, 0xD6, 0x9F, 0xDA, 0x0F, 0xE5, 0xFA, 0xDA, 0x0E,
+    0xAF, 0x3F, 0xA0, 0xDA, 0x0E, 0x0A, 0xF1, 0xFA, 0x1D, 0xA0, 0xE1, 0xAE, 0x2D, 0xA2, 0xDA, 0x0E,
+    0x2A, 0xC9, 0x29, 0xA3, 0xDA, 0x0E, 0x39, 0x71, 0xDA, 0x0E, 0x76, 0xDA, 0x0E, 0x76, 0xDA, 0x0E,
+    0x76, 0xDA, 0x0E, 0x76, 0xDA, 0x0E, 0x76, 0xDA, 0x0E, 0x76, 0xDA, 0x0E, 0x76, 0xDA, 0x0E, 0x60,
+    0x77, 0x77, 0xD7, 0x70, 0xE9, 0x77, 0xF7, 0x79, 0xEA, 0x77, 0xAE, 0x93, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xF9, 0x2F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFD, 0x77, 0xF9, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xFC, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF7, 0x59, 0xF7, 0x6F, 0x97, 0x6E, 0xA7, 0x70,
+    0xD7, 0x77, 0x10, 0x7D, 0xA0, 0xE7, 0x6D, 0xA0, 0xE7, 0x6D, 0xA0, 0xE7, 0x6D, 0xA0, 0xE7, 0x6D,
+    0xA0, 0xE7, 0x6D, 0xA0, 0xE7, 0x6D, 0xA0, 0xE7, 0x6D, 0xA0, 0xE7, 0x09, 0xA3, 0xDA, 0x0E, 0x39,
+    0x3D, 0xA2, 0xDA, 0x0E, 0x2D, 0x91, 0xFA, 0x1D, 0xA0, 0xE1, 0xAE, 0x91, 0xFA, 0x0D, 0xA0, 0xE0,
+    0xAF, 0x3F, 0xAD, 0xA0, 0xEA, 0xF5, 0xFD, 0xA0, 0xFD, 0xA7, 0xFC, 0xA0, 0xFC, 0xA7, 0x09, 0xFA,
+    0x0F, 0xA7, 0x29, 0xEA, 0x0E, 0xA7, 0x49, 0xDA, 0x0D, 0xA7, 0x69, 0xCA, 0x0C, 0x97, 0x73, 0x97,
+    0x00, 0x77, 0x74, 0x9C, 0x95, 0xD7, 0x3E, 0x93, 0xE9, 0x71, 0xAE, 0x93, 0xF7, 0x1F, 0x49, 0xEA,
+    0x7F, 0x6A, 0xE9, 0x5F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0x4A, 0xFF, 0xFF, 0xD2, 0xAF, 0xFF, 0xFF,
+    0x1F, 0x97, 0x3F, 0x90, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC2, 0x9F, 0xFF, 0xFC, 0xA4,
+    0xAF, 0xFF, 0xF6, 0xAF, 0x49, 0xF7, 0x0F, 0x93, 0xF9, 0x71, 0xE4, 0xEA, 0x72, 0xAC, 0x95, 0xD7,
+    0x77, 0x40, 0x79, 0x77, 0xAD, 0x75, 0xAF, 0x73, 0xFE, 0x97, 0x0F, 0xFC, 0xA5, 0x9F, 0xC0, 0xFD,
+    0x92, 0xFD, 0xA0, 0xFF, 0x1F, 0xDA, 0x0D, 0xAA, 0xF2, 0xAC, 0xAD, 0xA0, 0xD9, 0x09, 0xD6, 0xDA,
+    0x0D, 0x97, 0x2D, 0xA0, 0xD9, 0x72, 0xDA, 0x0D, 0x97, 0x2D, 0xA0, 0xD9, 0x70, 0x90, 0xDA, 0x0D,
+    0x91, 0x99, 0x29, 0xFC, 0xA0, 0xD9, 0x0E, 0xA1, 0xFD, 0xA0, 0xDA, 0xFC, 0x19, 0xFC, 0xA0, 0xFE,
+    0x93, 0xAF, 0x9F, 0xCA, 0x69, 0xFF, 0x71, 0xAF, 0xCA, 0x73, 0x9E, 0xA7, 0x59, 0xCA, 0x70, 0x77,
+    0x7E, 0x97, 0x19, 0xFC, 0x70, 0xFD, 0xA7, 0x2F, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x3A, 0xAE,
+    0x90, 0x9D, 0xA1, 0x9F, 0xEA, 0xAD, 0xA0, 0x9F, 0xFF, 0x90, 0xFC, 0x99, 0xFD, 0x99, 0xF3, 0xFC,
+    0x09, 0xE9, 0x39, 0xF0, 0xAE, 0x5F, 0x0A, 0xE5, 0xEA, 0x09, 0xEA, 0x3A, 0xE1, 0x9F, 0xCA, 0xAF,
+    0xC2, 0xFF, 0xE9, 0x3F, 0xFD, 0x49, 0xFF, 0x7A, 0xAE, 0xA4, 0x77, 0x59, 0x97, 0x29, 0xAF, 0xA9,
+    0x39, 0xD9, 0x79, 0xFF, 0xDA, 0x09, 0xF6, 0x9F, 0xFF, 0xFC, 0x69, 0xFD, 0xAA, 0xAF, 0xF7, 0xFC,
+    0x94, 0xFD, 0x7A, 0xF6, 0xAF, 0xC7, 0xFA, 0x59, 0xFD, 0x95, 0x9F, 0x59, 0xFF, 0x5A, 0xF4, 0x9F,
+    0xAF, 0x5F, 0xA3, 0x9F, 0x09, 0xF5, 0xFA, 0x29, 0xF2, 0xF5, 0xF9, 0x19, 0xF3, 0xF9, 0x4F, 0x90,
+    0x9F, 0x93, 0xF9, 0x4F, 0xA9, 0xF9, 0x39, 0xF5, 0xFF, 0xC9, 0x4A, 0xF5, 0xAF, 0xE9, 0x49, 0xFC,
+    0x5A, 0xFE, 0x91, 0x99, 0xFE, 0x59, 0xFF, 0xFF, 0xDA, 0x59, 0xFF, 0xFF, 0xD9, 0x49, 0xFF, 0xFF,
+    0xE4, 0x9F, 0xFF, 0xFE, 0x49, 0xF0, 0xAF, 0xFF, 0xC6, 0xE3, 0x9A, 0xFE, 0xA9, 0x70, 0xC7, 0x77,
+    0x77, 0x70, 0x79, 0x99, 0x97, 0x6A, 0xF9, 0x75, 0xFD, 0x74, 0xAF, 0xD9, 0x73, 0xFE, 0xA7, 0x29,
+    0xFF, 0x72, 0xF9, 0xAE, 0xA7, 0x09, 0xF0, 0x9F, 0x70, 0xFA, 0x1F, 0xA6, 0x9F, 0x2A, 0xF6, 0xFC,
+    0x3F, 0xA4, 0x9F, 0x93, 0xFC, 0x4F, 0xC4, 0x9F, 0x92, 0x9F, 0xA5, 0xFC, 0x2F, 0xC6, 0xAF, 0x90,
+    0x9F, 0xA7, 0xFC, 0x0A, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF, 0xFD, 0x0A, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF,
+    0xFD, 0x00, 0x77, 0x0A, 0xFF, 0xFE, 0x0A, 0xFF, 0xFE, 0x0A, 0xFF, 0xFE, 0x2A, 0xE9, 0x2F, 0x4A,
+    0xE9, 0x2F, 0x4A, 0xE9, 0x2F, 0x4A, 0xE9, 0x2F, 0x4A, 0xE9, 0x2F, 0x4A, 0xE9, 0x2F, 0x4A, 0xE9,
+    0x2F, 0x4A, 0xE9, 0x2F, 0x4A, 0xE9, 0x2F, 0x4A, 0xE9, 0x2F, 0x4A, 0xE9, 0x2F, 0x4A, 0xE9, 0x2F,
+    0x4A, 0xE9, 0x2F, 0x4A, 0xE9, 0x2F, 0x4A, 0xE9, 0x2F, 0x49, 0xAA, 0xA3, 0xAA, 0xAA, 0x20, 0x19,
+    0xE9, 0x2A, 0xE4, 0xAE, 0x92, 0xF4, 0xAE, 0x92, 0xF4, 0xAE, 0x92, 0xF4, 0xAE, 0x92, 0xF4, 0xAE,
+    0x92, 0xF4, 0xAE, 0x92, 0xF4, 0xAE, 0x92, 0xF4, 0xAE, 0x92, 0xF4, 0xAE, 0x92, 0xF4, 0xAE, 0x92,
+    0xF4, 0xAE, 0x92, 0xF4, 0xAE, 0x92, 0xF4, 0xAE, 0x92, 0xF4, 0xAE, 0x92, 0xF4, 0xAE, 0x92, 0xF2,
+    0xAF, 0xFF, 0xE0, 0xAF, 0xFF, 0xE0, 0xAF, 0xFF, 0xE0, 0x74, 0xAF, 0xFE, 0xAA, 0xFF, 0xEA, 0xAF,
+    0xFE, 0xA9, 0xF7, 0x09, 0xF7, 0x0A, 0xF7, 0x0F, 0xA7, 0x0F, 0x97, 0x0F, 0x70, 0x9E, 0x71, 0xE7,
+    0x9E, 0xA6, 0x9E, 0xA6, 0xAF, 0x6F, 0xC6, 0xAF, 0xFE, 0xAA, 0xFF, 0xEA, 0xAF, 0xFE, 0xAA, 0xFF,
+    0xEA, 0x49, 0x99, 0x9A, 0xAA, 0xA3, 0xFF, 0xE9, 0x19, 0xFF, 0xEA, 0x1F, 0xEA, 0xAA, 0xAA, 0xA0,
+    0x72, 0xFF, 0xD7, 0x3F, 0xFC, 0x97, 0x29, 0xFE, 0xAA, 0x73, 0xEA, 0x77, 0x1E, 0x97, 0x70, 0x9E,
+    0x77, 0x1F, 0x77, 0x1E, 0xA7, 0x70, 0x9E, 0x97, 0x70, 0xF7, 0x71, 0xF7, 0x70, 0x9E, 0xA7, 0x70,
+    0xFA, 0x77, 0x0F, 0x97, 0x2C, 0x92, 0x9F, 0x73, 0xDA, 0x1F, 0xC7, 0x3F, 0x9F, 0xA7, 0x39, 0xFF,
+    0x97, 0x4F, 0xF7, 0x59, 0xFE, 0x76, 0xFD, 0xA7, 0x69, 0xFC, 0x97, 0x77, 0x71, 0x49, 0xA9, 0x49,
+    0xAA, 0x95, 0x9F, 0xDA, 0x1F, 0xD3, 0x9F, 0xFC, 0xAF, 0xE2, 0xFF, 0xFF, 0xDA, 0x09, 0xEA, 0x29,
+    0xFA, 0x19, 0xE0, 0x9E, 0x5D, 0xA3, 0x9D, 0x9A, 0xDA, 0x5D, 0x93, 0x9D, 0x9A, 0xDA, 0x5D, 0x93,
+    0x9D, 0x99, 0xE3, 0x9A, 0xE9, 0x19, 0xE9, 0x9F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x19, 0xFF, 0xFF,
+    0xC9, 0x29, 0xFE, 0x1F, 0xDA, 0x59, 0x9A, 0xA4, 0xAD, 0xA9, 0x20, 0x75, 0xAA, 0xCA, 0x97, 0x49,
+    0xFD, 0x74, 0xFE, 0x73, 0xF9, 0x09, 0xC7, 0x3E, 0xA7, 0x69, 0xE9, 0x76, 0xAE, 0x77, 0xAE, 0x77,
+    0xF7, 0x7E, 0xA7, 0x7E, 0xA7, 0x69, 0xE9, 0x76, 0x9E, 0x77, 0xAE, 0x77, 0xF7, 0x7F, 0x77, 0xEA,
+    0x77, 0xEA, 0x76, 0x9E, 0x97, 0x6A, 0xE7, 0x2A, 0xA1, 0x9F, 0x70, 0xAF, 0xFC, 0xA7, 0xAF, 0xFD,
+    0x97, 0x0F, 0xFD, 0x72, 0xFF, 0x74, 0x9A, 0xEA, 0x77, 0x76, 0x0F, 0x91, 0xF9, 0x09, 0xFA, 0x09,
+    0xFA, 0x0A, 0xFC, 0x0F, 0xD7, 0x77, 0x74, 0xF9, 0x1F, 0x90, 0x9F, 0xA0, 0x9F, 0xA0, 0xAF, 0xC0,
+    0xFD, 0x00, 0x29, 0x99, 0x72, 0xFD, 0x2A, 0xDA, 0x0A, 0xFE, 0x1A, 0xE0, 0xF0, 0xF0, 0xAE, 0x0E,
+    0xA1, 0xFE, 0x90, 0x9E, 0x2F, 0xD7, 0x19, 0xAA, 0x94, 0x99, 0x97, 0x2F, 0xD2, 0xAD, 0xA0, 0xAF,
+    0xE9, 0x0A, 0xE0, 0xEA, 0x0A, 0xEA, 0xEA, 0x0E, 0xA1, 0xAF, 0xD2, 0x9A, 0xA2, 0x9F, 0x97, 0x70,
+    0x75, 0x9A, 0xA9, 0x76, 0xE7, 0x6E, 0x97, 0x59, 0xE7, 0x6E, 0x97, 0x5A, 0xE7, 0x59, 0xE9, 0x99,
+    0x3F, 0xFF, 0xE2, 0xAF, 0xFF, 0xEA, 0x09, 0xFF, 0xFF, 0xC1, 0x99, 0x4A, 0xE7, 0x59, 0xE9, 0x74,
+    0x9F, 0x29, 0x99, 0x3F, 0xFF, 0xE2, 0xFF, 0xFF, 0xA0, 0x9F, 0xFF, 0xFC, 0x49, 0xEA, 0x75, 0xF7,
+    0x5A, 0xEA, 0x75, 0xF7, 0x5A, 0xE9, 0x75, 0xAA, 0xAA, 0x74, 0x77, 0x09, 0x77, 0x19, 0xD7, 0x7A,
+    0xF7, 0x5A, 0xFD, 0x72, 0x9F, 0xF9, 0x70, 0x9F, 0xF9, 0x70, 0xAF, 0xF9, 0x70, 0xAF, 0xF9, 0x71,
+    0x9F, 0xDA, 0x97, 0x39, 0xFD, 0xA9, 0x73, 0xAF, 0xFD, 0xA9, 0x79, 0xAF, 0xFF, 0xCA, 0x97, 0x9F,
+    0xFF, 0xC7, 0x19, 0xAF, 0xFC, 0x74, 0x9A, 0xFD, 0x77, 0x09, 0xE4, 0xFA, 0xA9, 0x96, 0x93, 0xAF,
+    0xFF, 0xAA, 0x99, 0x3F, 0xFF, 0xFC, 0xA4, 0x99, 0x9A, 0xAF, 0xFE, 0x76, 0x99, 0xAA, 0xAC, 0x90,
+    0x77, 0x70, 0x9D, 0x97, 0x71, 0x9F, 0x97, 0x7A, 0xFD, 0x97, 0x6A, 0xFE, 0xA7, 0x6A, 0xFE, 0xA7,
+    0x6A, 0xFF, 0x97, 0x5A, 0xFF, 0x97, 0x5A, 0xFE, 0x76, 0xAF, 0xD7, 0x29, 0xAF, 0xFC, 0x79, 0xFF,
+    0xFC, 0xA3, 0xAF, 0xFF, 0xCA, 0x94, 0x9F, 0xFE, 0xA7, 0x09, 0xFF, 0xA7, 0x39, 0xFC, 0x97, 0x69,
+    0xD9, 0x72, 0x99, 0x73, 0x99, 0xAA, 0xFD, 0x49, 0x9A, 0xAF, 0xFF, 0xC9, 0x3F, 0xFF, 0xFC, 0xA2,
+    0x9F, 0xFE, 0xAA, 0x99, 0x5D, 0xAA, 0x99, 0x97, 0x50,
 };
 
 static const EpdGlyph opendyslexic_12_boldGlyphs[] = {
     { 0, 0, 22, 0, 0, 0, 0 }, //  
-    { 8, 32, 9, 0, 28, 64, 0 }, // !
-    { 16, 9, 18, -2, 22, 36, 64 }, // "
-    { 28, 23, 28, -1, 21, 161, 100 }, // #
-    { 21, 30, 29, 4, 24, 158, 261 }, // $
-    { 22, 22, 27, 4, 20, 121, 419 }, // %
-    { 19, 21, 23, 2, 20, 100, 540 }, // &
-    { 7, 9, 9, 1, 20, 16, 640 }, // '
-    { 11, 35, 13, 1, 26, 97, 656 }, // (
-    { 11, 35, 11, -1, 26, 97, 753 }, // )
-    { 15, 14, 16, 0, 20, 53, 850 }, // *
-    { 14, 14, 16, 1, 14, 49, 903 }, // +
-    { 8, 9, 9, 0, 4, 18, 952 }, // ,
-    { 14, 3, 15, 0, 9, 11, 970 }, // -
-    { 6, 6, 7, 0, 6, 9, 981 }, // .
-    { 17, 43, 18, 0, 29, 183, 990 }, // /
-    { 15, 21, 18, 2, 20, 79, 1173 }, // 0
-    { 12, 19, 16, 2, 19, 57, 1252 }, // 1
-    { 14, 20, 18, 2, 20, 70, 1309 }, // 2
-    { 14, 20, 18, 2, 19, 70, 1379 }, // 3
-    { 15, 20, 19, 2, 19, 75, 1449 }, // 4
-    { 14, 21, 18, 2, 20, 74, 1524 }, // 5
-    { 15, 20, 18, 2, 19, 75, 1598 }, // 6
-    { 14, 20, 17, 2, 20, 70, 1673 }, // 7
-    { 16, 20, 19, 1, 19, 80, 1743 }, // 8
-    { 15, 21, 18, 2, 19, 79, 1823 }, // 9
-    { 7, 17, 8, 0, 17, 30, 1902 }, // :
-    { 9, 21, 10, 0, 16, 48, 1932 }, // ;
-    { 20, 17, 20, -1, 17, 85, 1980 }, // <
-    { 15, 10, 16, 0, 12, 38, 2065 }, // =
-    { 19, 17, 21, 1, 17, 81, 2103 }, // >
-    { 16, 31, 17, 0, 28, 124, 2184 }, // ?
-    { 23, 24, 26, 0, 21, 138, 2308 }, // @
-    { 22, 21, 24, 1, 21, 116, 2446 }, // A
-    { 17, 21, 24, 4, 21, 90, 2562 }, // B
-    { 18, 23, 25, 3, 23, 104, 2652 }, // C
-    { 19, 21, 26, 4, 21, 100, 2756 }, // D
-    { 15, 21, 23, 4, 21, 79, 2856 }, // E
-    { 14, 22, 21, 4, 22, 77, 2935 }, // F
-    { 21, 22, 29, 4, 21, 116, 3012 }, // G
-    { 19, 21, 26, 4, 21, 100, 3128 }, // H
-    { 6, 21, 14, 4, 21, 32, 3228 }, // I
-    { 15, 27, 23, 4, 21, 102, 3260 }, // J
-    { 19, 21, 26, 4, 21, 100, 3362 }, // K
-    { 15, 21, 22, 4, 21, 79, 3462 }, // L
-    { 22, 21, 29, 4, 21, 116, 3541 }, // M
-    { 18, 21, 26, 4, 21, 95, 3657 }, // N
-    { 21, 24, 28, 4, 22, 126, 3752 }, // O
-    { 15, 22, 23, 4, 22, 83, 3878 }, // P
-    { 23, 27, 27, 2, 22, 156, 3961 }, // Q
-    { 17, 22, 24, 4, 21, 94, 4117 }, // R
-    { 19, 23, 27, 4, 21, 110, 4211 }, // S
-    { 19, 22, 26, 4, 22, 105, 4321 }, // T
-    { 18, 22, 26, 4, 21, 99, 4426 }, // U
-    { 21, 21, 28, 4, 21, 111, 4525 }, // V
-    { 28, 22, 36, 4, 22, 154, 4636 }, // W
-    { 20, 21, 28, 4, 21, 105, 4790 }, // X
-    { 19, 21, 27, 4, 21, 100, 4895 }, // Y
-    { 20, 21, 27, 4, 21, 105, 4995 }, // Z
-    { 10, 36, 12, 1, 27, 90, 5100 }, // [
-    { 10, 29, 12, 1, 22, 73, 5190 }, // <backslash>
-    { 10, 36, 12, 1, 27, 90, 5263 }, // ]
-    { 15, 7, 16, 0, 25, 27, 5353 }, // ^
-    { 19, 5, 19, -1, -1, 24, 5380 }, // _
-    { 11, 6, 12, 0, 20, 17, 5404 }, // `
-    { 15, 17, 21, 3, 16, 64, 5421 }, // a
-    { 16, 23, 22, 3, 22, 92, 5485 }, // b
-    { 13, 16, 20, 3, 16, 52, 5577 }, // c
-    { 16, 22, 22, 3, 21, 88, 5629 }, // d
-    { 15, 16, 21, 3, 15, 60, 5717 }, // e
-    { 11, 22, 17, 3, 22, 61, 5777 }, // f
-    { 15, 23, 22, 3, 15, 87, 5838 }, // g
-    { 16, 21, 22, 3, 21, 84, 5925 }, // h
-    { 6, 23, 12, 3, 23, 35, 6009 }, // i
-    { 10, 29, 16, 3, 22, 73, 6044 }, // j
-    { 16, 21, 23, 3, 21, 84, 6117 }, // k
-    { 9, 21, 15, 3, 21, 48, 6201 }, // l
-    { 24, 16, 31, 3, 16, 96, 6249 }, // m
-    { 15, 16, 22, 3, 16, 60, 6345 }, // n
-    { 15, 16, 22, 3, 15, 60, 6405 }, // o
-    { 17, 23, 23, 3, 15, 98, 6465 }, // p
-    { 18, 23, 24, 3, 16, 104, 6563 }, // q
-    { 12, 15, 18, 3, 15, 45, 6667 }, // r
-    { 15, 18, 22, 3, 16, 68, 6712 }, // s
-    { 13, 21, 20, 3, 20, 69, 6780 }, // t
-    { 15, 16, 21, 3, 15, 60, 6849 }, // u
-    { 18, 15, 25, 3, 15, 68, 6909 }, // v
-    { 21, 16, 28, 3, 15, 84, 6977 }, // w
-    { 18, 14, 25, 3, 14, 63, 7061 }, // x
-    { 17, 21, 23, 3, 14, 90, 7124 }, // y
-    { 16, 15, 22, 3, 15, 60, 7214 }, // z
-    { 12, 26, 14, 1, 20, 78, 7274 }, // {
-    { 5, 23, 10, 2, 18, 29, 7352 }, // |
-    { 12, 26, 14, 1, 20, 78, 7381 }, // }
-    { 10, 6, 12, 1, 20, 15, 7459 }, // ~
-    { 0, 0, 22, 0, 0, 0, 7474 }, //  
-    { 8, 32, 19, 5, 28, 64, 7474 }, // ¡
-    { 13, 24, 20, 3, 20, 78, 7538 }, // ¢
-    { 16, 23, 18, 1, 22, 92, 7616 }, // £
-    { 15, 15, 17, 1, 17, 57, 7708 }, // ¤
-    { 19, 22, 20, 0, 19, 105, 7765 }, // ¥
-    { 4, 22, 10, 2, 18, 22, 7870 }, // ¦
-    { 14, 23, 19, 2, 20, 81, 7892 }, // §
-    { 13, 6, 14, 0, 21, 20, 7973 }, // ¨
-    { 12, 11, 17, 2, 24, 33, 7993 }, // ©
-    { 9, 9, 16, 5, 19, 21, 8026 }, // ª
-    { 14, 14, 15, 0, 13, 49, 8047 }, // «
-    { 13, 9, 15, 1, 10, 30, 8096 }, // ¬
-    { 13, 3, 15, 1, 9, 10, 8126 }, // ­
-    { 12, 12, 17, 2, 28, 36, 8136 }, // ®
-    { 11, 4, 13, 1, 19, 11, 8172 }, // ¯
-    { 12, 11, 17, 2, 19, 33, 8183 }, // °
-    { 15, 16, 16, 0, 14, 60, 8216 }, // ±
-    { 8, 8, 9, 0, 20, 16, 8276 }, // ²
-    { 8, 10, 9, 0, 21, 20, 8292 }, // ³
-    { 7, 6, 8, 0, 19, 11, 8312 }, // ´
-    { 16, 19, 21, 2, 15, 76, 8323 }, // µ
-    { 14, 22, 19, 2, 18, 77, 8399 }, // ¶
-    { 6, 6, 7, 0, 12, 9, 8476 }, // ·
-    { 7, 8, 9, 1, 1, 14, 8485 }, // ¸
-    { 7, 9, 8, 0, 21, 16, 8499 }, // ¹
-    { 9, 8, 17, 5, 18, 18, 8515 }, // º
-    { 14, 14, 19, 2, 13, 49, 8533 }, // »
-    { 23, 23, 31, 4, 21, 133, 8582 }, // ¼
-    { 25, 23, 31, 4, 21, 144, 8715 }, // ½
-    { 23, 23, 31, 4, 21, 133, 8859 }, // ¾
-    { 16, 32, 17, 0, 18, 128, 8992 }, // ¿
-    { 22, 28, 24, 1, 28, 154, 9120 }, // À
-    { 22, 32, 24, 1, 32, 176, 9274 }, // Á
-    { 22, 30, 24, 1, 30, 165, 9450 }, // Â
-    { 22, 29, 24, 1, 29, 160, 9615 }, // Ã
-    { 22, 30, 24, 1, 30, 165, 9775 }, // Ä
-    { 22, 30, 24, 1, 30, 165, 9940 }, // Å
-    { 32, 22, 34, 1, 21, 176, 10105 }, // Æ
-    { 18, 30, 25, 3, 23, 135, 10281 }, // Ç
-    { 15, 29, 23, 4, 29, 109, 10416 }, // È
-    { 15, 33, 23, 4, 33, 124, 10525 }, // É
-    { 15, 31, 23, 4, 31, 117, 10649 }, // Ê
-    { 15, 31, 23, 4, 31, 117, 10766 }, // Ë
-    { 11, 30, 14, 0, 30, 83, 10883 }, // Ì
-    { 6, 34, 14, 4, 34, 51, 10966 }, // Í
-    { 14, 32, 15, 0, 32, 112, 11017 }, // Î
-    { 13, 32, 14, 0, 32, 104, 11129 }, // Ï
-    { 24, 21, 26, -1, 21, 126, 11233 }, // Ð
-    { 18, 29, 26, 4, 29, 131, 11359 }, // Ñ
-    { 21, 31, 28, 4, 29, 163, 11490 }, // Ò
-    { 21, 35, 28, 4, 33, 184, 11653 }, // Ó
-    { 21, 33, 28, 4, 31, 174, 11837 }, // Ô
-    { 21, 32, 28, 4, 30, 168, 12011 }, // Õ
-    { 21, 33, 28, 4, 31, 174, 12179 }, // Ö
-    { 15, 9, 16, 0, 11, 34, 12353 }, // ×
-    { 36, 50, 33, -4, 36, 450, 12387 }, // Ø
-    { 18, 31, 26, 4, 30, 140, 12837 }, // Ù
-    { 18, 35, 26, 4, 34, 158, 12977 }, // Ú
-    { 18, 33, 26, 4, 32, 149, 13135 }, // Û
-    { 18, 32, 26, 4, 31, 144, 13284 }, // Ü
-    { 19, 36, 27, 4, 36, 171, 13428 }, // Ý
-    { 12, 20, 14, 1, 20, 60, 13599 }, // Þ
-    { 15, 22, 17, 1, 20, 83, 13659 }, // ß
-    { 15, 23, 21, 3, 22, 87, 13742 }, // à
-    { 15, 27, 21, 3, 26, 102, 13829 }, // á
-    { 15, 25, 21, 3, 24, 94, 13931 }, // â
-    { 15, 23, 21, 3, 22, 87, 14025 }, // ã
-    { 15, 25, 21, 3, 24, 94, 14112 }, // ä
-    { 15, 25, 21, 3, 24, 94, 14206 }, // å
-    { 25, 17, 31, 3, 16, 107, 14300 }, // æ
-    { 13, 22, 20, 3, 16, 72, 14407 }, // ç
-    { 15, 26, 21, 3, 25, 98, 14479 }, // è
-    { 15, 31, 21, 3, 30, 117, 14577 }, // é
-    { 15, 28, 21, 3, 27, 105, 14694 }, // ê
-    { 15, 28, 21, 3, 27, 105, 14799 }, // ë
-    { 10, 22, 12, 0, 22, 55, 14904 }, // ì
-    { 6, 26, 12, 3, 26, 39, 14959 }, // í
-    { 14, 23, 14, -1, 23, 81, 14998 }, // î
-    { 12, 22, 13, 0, 22, 66, 15079 }, // ï
-    { 20, 22, 20, -1, 21, 110, 15145 }, // ð
-    { 15, 24, 22, 3, 24, 90, 15255 }, // ñ
-    { 15, 23, 22, 3, 22, 87, 15345 }, // ò
-    { 15, 27, 22, 3, 26, 102, 15432 }, // ó
-    { 15, 25, 22, 3, 24, 94, 15534 }, // ô
-    { 15, 24, 22, 3, 23, 90, 15628 }, // õ
-    { 15, 25, 22, 3, 24, 94, 15718 }, // ö
-    { 19, 18, 22, 2, 17, 86, 15812 }, // ÷
-    { 17, 44, 22, 2, 30, 187, 15898 }, // ø
-    { 15, 24, 21, 3, 23, 90, 16085 }, // ù
-    { 15, 28, 21, 3, 27, 105, 16175 }, // ú
-    { 15, 25, 21, 3, 24, 94, 16280 }, // û
-    { 15, 25, 21, 3, 24, 94, 16374 }, // ü
-    { 17, 36, 23, 3, 29, 153, 16468 }, // ý
-    { 12, 26, 14, 1, 21, 78, 16621 }, // þ
-    { 17, 33, 23, 3, 26, 141, 16699 }, // ÿ
-    { 22, 29, 24, 1, 29, 160, 16840 }, // Ā
-    { 15, 25, 21, 3, 24, 94, 17000 }, // ā
-    { 22, 30, 24, 1, 30, 165, 17094 }, // Ă
-    { 15, 25, 21, 3, 24, 94, 17259 }, // ă
-    { 22, 28, 24, 1, 21, 154, 17353 }, // Ą
-    { 17, 24, 21, 3, 16, 102, 17507 }, // ą
-    { 18, 31, 25, 3, 31, 140, 17609 }, // Ć
-    { 13, 21, 20, 3, 21, 69, 17749 }, // ć
-    { 18, 32, 25, 3, 32, 144, 17818 }, // Ĉ
-    { 14, 24, 20, 3, 24, 84, 17962 }, // ĉ
-    { 18, 31, 25, 3, 31, 140, 18046 }, // Ċ
-    { 13, 22, 20, 3, 22, 72, 18186 }, // ċ
-    { 18, 33, 25, 3, 33, 149, 18258 }, // Č
-    { 14, 24, 20, 3, 24, 84, 18407 }, // č
-    { 19, 31, 26, 4, 31, 148, 18491 }, // Ď
-    { 20, 22, 24, 3, 21, 110, 18639 }, // ď
-    { 24, 21, 26, -1, 21, 126, 18749 }, // Đ
-    { 20, 22, 24, 3, 21, 110, 18875 }, // đ
-    { 15, 30, 23, 4, 30, 113, 18985 }, // Ē
-    { 15, 28, 21, 3, 27, 105, 19098 }, // ē
-    { 15, 31, 23, 4, 31, 117, 19203 }, // Ĕ
-    { 15, 28, 21, 3, 27, 105, 19320 }, // ĕ
-    { 15, 31, 23, 4, 31, 117, 19425 }, // Ė
-    { 15, 28, 21, 3, 27, 105, 19542 }, // ė
-    { 15, 28, 23, 4, 21, 105, 19647 }, // Ę
-    { 15, 25, 21, 3, 15, 94, 19752 }, // ę
-    { 15, 33, 23, 4, 33, 124, 19846 }, // Ě
-    { 15, 30, 21, 3, 29, 113, 19970 }, // ě
-    { 21, 34, 29, 4, 33, 179, 20083 }, // Ĝ
-    { 16, 34, 22, 3, 26, 136, 20262 }, // ĝ
-    { 21, 33, 29, 4, 32, 174, 20398 }, // Ğ
-    { 15, 33, 22, 3, 25, 124, 20572 }, // ğ
-    { 21, 33, 29, 4, 32, 174, 20696 }, // Ġ
-    { 15, 33, 22, 3, 25, 124, 20870 }, // ġ
-    { 21, 38, 29, 4, 37, 200, 20994 }, // Ģ
-    { 15, 34, 22, 3, 26, 128, 21194 }, // ģ
-    { 19, 31, 26, 4, 31, 148, 21322 }, // Ĥ
-    { 19, 30, 22, 0, 30, 143, 21470 }, // ĥ
-    { 22, 21, 26, 2, 21, 116, 21613 }, // Ħ
-    { 19, 21, 22, 0, 21, 100, 21729 }, // ħ
-    { 11, 32, 14, 1, 32, 88, 21829 }, // Ĩ
-    { 10, 23, 12, 1, 23, 58, 21917 }, // ĩ
-    { 14, 31, 14, -1, 31, 109, 21975 }, // Ī
-    { 15, 23, 14, -2, 23, 87, 22084 }, // ī
-    { 8, 28, 14, 2, 21, 56, 22171 }, // Į
-    { 8, 31, 12, 2, 23, 62, 22227 }, // į
-    { 7, 32, 14, 3, 32, 56, 22289 }, // İ
-    { 6, 14, 12, 3, 14, 21, 22345 }, // ı
-    { 20, 31, 40, 9, 21, 155, 22366 }, // Ĳ
-    { 15, 30, 19, 3, 24, 113, 22521 }, // ĳ
-    { 17, 37, 23, 4, 31, 158, 22634 }, // Ĵ
-    { 14, 32, 18, 3, 25, 112, 22792 }, // ĵ
-    { 19, 34, 26, 4, 34, 162, 22904 }, // Ķ
-    { 16, 34, 23, 3, 21, 136, 23066 }, // ķ
-    { 12, 14, 16, 2, 14, 42, 23202 }, // ĸ
-    { 15, 28, 22, 4, 28, 105, 23244 }, // Ĺ
-    { 9, 32, 15, 3, 32, 72, 23349 }, // ĺ
-    { 17, 33, 22, 2, 33, 141, 23421 }, // Ļ
-    { 10, 35, 15, 2, 21, 88, 23562 }, // ļ
-    { 15, 21, 22, 4, 21, 79, 23650 }, // Ľ
-    { 12, 25, 16, 3, 25, 75, 23729 }, // ľ
-    { 15, 21, 22, 4, 21, 79, 23804 }, // Ŀ
-    { 12, 21, 16, 3, 21, 63, 23883 }, // ŀ
-    { 27, 37, 22, -7, 29, 250, 23946 }, // Ł
-    { 19, 21, 15, -5, 21, 100, 24196 }, // ł
-    { 18, 30, 26, 4, 30, 135, 24296 }, // Ń
-    { 15, 25, 22, 3, 25, 94, 24431 }, // ń
-    { 18, 31, 26, 4, 21, 140, 24525 }, // Ņ
-    { 15, 26, 22, 3, 16, 98, 24665 }, // ņ
-    { 18, 32, 26, 4, 32, 144, 24763 }, // Ň
-    { 16, 27, 22, 3, 27, 108, 24907 }, // ň
-    { 15, 26, 22, 3, 26, 98, 25015 }, // ŉ
-    { 18, 27, 26, 4, 21, 122, 25113 }, // Ŋ
-    { 15, 21, 22, 3, 16, 79, 25235 }, // ŋ
-    { 21, 32, 28, 4, 30, 168, 25314 }, // Ō
-    { 15, 25, 22, 3, 24, 94, 25482 }, // ō
-    { 21, 33, 28, 4, 31, 174, 25576 }, // Ŏ
-    { 15, 25, 22, 3, 24, 94, 25750 }, // ŏ
-    { 23, 32, 28, 4, 30, 184, 25844 }, // Ő
-    { 22, 24, 24, 1, 23, 132, 26028 }, // ő
-    { 29, 24, 34, 4, 22, 174, 26160 }, // Œ
-    { 26, 16, 30, 3, 15, 104, 26334 }, // œ
-    { 17, 30, 24, 4, 29, 128, 26438 }, // Ŕ
-    { 12, 22, 18, 3, 22, 66, 26566 }, // ŕ
-    { 17, 35, 24, 4, 34, 149, 26632 }, // Ŗ
-    { 12, 27, 18, 3, 27, 81, 26781 }, // ŗ
-    { 17, 32, 24, 4, 31, 136, 26862 }, // Ř
-    { 14, 24, 18, 1, 24, 84, 26998 }, // ř
-    { 19, 31, 27, 4, 29, 148, 27082 }, // Ś
-    { 15, 24, 22, 3, 22, 90, 27230 }, // ś
-    { 19, 32, 27, 4, 30, 152, 27320 }, // Ŝ
-    { 15, 26, 22, 3, 24, 98, 27472 }, // ŝ
-    { 19, 28, 27, 4, 21, 133, 27570 }, // Ş
-    { 15, 24, 22, 3, 16, 90, 27703 }, // ş
-    { 19, 33, 27, 4, 31, 157, 27793 }, // Š
-    { 15, 26, 22, 3, 24, 98, 27950 }, // š
-    { 19, 29, 26, 4, 22, 138, 28048 }, // Ţ
-    { 13, 26, 20, 3, 20, 85, 28186 }, // ţ
-    { 19, 32, 26, 4, 32, 152, 28271 }, // Ť
-    { 17, 24, 21, 3, 23, 102, 28423 }, // ť
-    { 19, 22, 26, 4, 22, 105, 28525 }, // Ŧ
-    { 14, 21, 20, 2, 20, 74, 28630 }, // ŧ
-    { 18, 33, 26, 4, 32, 149, 28704 }, // Ũ
-    { 15, 25, 21, 3, 24, 94, 28853 }, // ũ
-    { 18, 32, 26, 4, 31, 144, 28947 }, // Ū
-    { 15, 25, 21, 3, 24, 94, 29091 }, // ū
-    { 18, 32, 26, 4, 31, 144, 29185 }, // Ŭ
-    { 15, 25, 21, 3, 24, 94, 29329 }, // ŭ
-    { 18, 34, 26, 4, 33, 153, 29423 }, // Ů
-    { 15, 27, 21, 3, 26, 102, 29576 }, // ů
-    { 22, 31, 26, 3, 30, 171, 29678 }, // Ű
-    { 22, 24, 24, 1, 23, 132, 29849 }, // ű
-    { 18, 28, 26, 4, 21, 126, 29981 }, // Ų
-    { 15, 23, 21, 3, 15, 87, 30107 }, // ų
-    { 28, 31, 36, 4, 31, 217, 30194 }, // Ŵ
-    { 21, 27, 28, 3, 26, 142, 30411 }, // ŵ
-    { 19, 33, 27, 4, 33, 157, 30553 }, // Ŷ
-    { 17, 34, 23, 3, 27, 145, 30710 }, // ŷ
-    { 19, 33, 27, 4, 33, 157, 30855 }, // Ÿ
-    { 20, 28, 27, 4, 28, 140, 31012 }, // Ź
-    { 16, 24, 22, 3, 24, 96, 31152 }, // ź
-    { 20, 29, 27, 4, 29, 145, 31248 }, // Ż
-    { 16, 24, 22, 3, 24, 96, 31393 }, // ż
-    { 20, 31, 27, 4, 31, 155, 31489 }, // Ž
-    { 16, 26, 22, 3, 26, 104, 31644 }, // ž
-    { 10, 21, 15, 2, 21, 53, 31748 }, // ſ
-    { 22, 27, 28, 4, 25, 149, 31801 }, // Ơ
-    { 17, 18, 22, 3, 17, 77, 31950 }, // ơ
-    { 20, 22, 23, -1, 22, 110, 32027 }, // Ƥ
-    { 17, 26, 23, 3, 19, 111, 32137 }, // ƥ
-    { 13, 20, 15, 1, 19, 65, 32248 }, // Ʃ
-    { 21, 22, 26, 2, 22, 116, 32313 }, // Ƭ
-    { 13, 25, 20, 3, 24, 82, 32429 }, // ƭ
-    { 19, 26, 26, 4, 22, 124, 32511 }, // Ʈ
-    { 21, 27, 26, 4, 26, 142, 32635 }, // Ư
-    { 18, 20, 22, 3, 19, 90, 32777 }, // ư
-    { 11, 6, 12, 0, 20, 17, 32867 }, // ̀
-    { 7, 6, 8, 0, 19, 11, 32884 }, // ́
-    { 14, 7, 15, 0, 1, 25, 32895 }, // ̂
-    { 10, 6, 12, 1, 20, 15, 32920 }, // ̃
-    { 14, 4, 16, 1, 17, 14, 32935 }, // ̄
-    { 18, 4, 19, 0, 23, 18, 32949 }, // ̅
-    { 13, 5, 14, 0, 18, 17, 32967 }, // ̆
-    { 7, 6, 11, 3, 21, 11, 32984 }, // ̇
-    { 12, 5, 13, 0, 18, 15, 32995 }, // ̈
-    { 5, 6, 11, 5, 16, 8, 33010 }, // ̉
-    { 7, 7, 9, 1, 20, 13, 33018 }, // ̊
-    { 22, 6, 23, 0, 20, 33, 33031 }, // ̋
-    { 14, 7, 15, 0, 20, 25, 33064 }, // ̌
-    { 22, 6, 17, -6, 20, 33, 33089 }, // ̏
-    { 8, 9, 9, 0, 20, 18, 33122 }, // ̒
-    { 9, 9, 10, 0, 19, 21, 33140 }, // ̓
-    { 9, 9, 9, -1, 19, 21, 33161 }, // ̔
-    { 6, 7, 8, 1, 0, 11, 33182 }, // ̘
-    { 6, 7, 8, 1, 0, 11, 33193 }, // ̙
-    { 12, 8, 14, 1, 21, 24, 33204 }, // ̚
-    { 6, 8, 7, 0, 17, 12, 33228 }, // ̛
-    { 4, 8, 6, 1, 0, 8, 33240 }, // ̜
-    { 7, 6, 9, 1, 4, 11, 33248 }, // ̝
-    { 7, 6, 9, 1, 0, 11, 33259 }, // ̞
-    { 6, 6, 8, 1, -2, 9, 33270 }, // ̟
-    { 15, 4, 16, 0, -3, 15, 33279 }, // ̠
-    { 7, 6, 8, 0, 2, 11, 33294 }, // ̣
-    { 12, 5, 13, 0, -2, 15, 33305 }, // ̤
-    { 7, 7, 9, 1, 20, 13, 33320 }, // ̥
-    { 8, 9, 9, 0, 4, 18, 33333 }, // ̦
-    { 7, 8, 9, 1, 1, 14, 33351 }, // ̧
-    { 8, 9, 10, 1, 1, 18, 33365 }, // ̨
-    { 5, 9, 7, 1, 0, 12, 33383 }, // ̩
-    { 11, 6, 12, 0, 0, 17, 33395 }, // ̪
-    { 16, 8, 16, -1, 1, 32, 33412 }, // ̬
-    { 16, 8, 16, -1, 1, 32, 33444 }, // ̭
-    { 11, 6, 13, 1, 21, 17, 33476 }, // ̰
-    { 13, 4, 15, 1, 21, 13, 33493 }, // ̱
-    { 13, 4, 14, 0, -1, 13, 33506 }, // ̲
-    { 11, 6, 13, 1, 21, 17, 33519 }, // ̴
-    { 14, 3, 15, 0, 9, 11, 33536 }, // ̵
-    { 5, 8, 7, 1, 0, 10, 33547 }, // ̹
-    { 11, 8, 12, 0, 1, 22, 33557 }, // ̺
-    { 10, 8, 11, 0, 1, 20, 33579 }, // ̻
-    { 9, 7, 11, 1, 1, 16, 33599 }, // ̼
-    { 8, 6, 11, 2, 19, 12, 33615 }, // ̽
-    { 10, 6, 12, 1, 20, 15, 33627 }, // ͂
-    { 5, 7, 12, 6, 22, 9, 33642 }, // ̓
-    { 12, 19, 14, 1, 32, 57, 33651 }, // ̈́
-    { 11, 7, 12, 0, 21, 20, 33708 }, // ͆
-    { 15, 10, 16, 0, 0, 38, 33728 }, // ͇
-    { 11, 8, 13, 1, 1, 22, 33766 }, // ͈
-    { 9, 8, 11, 1, -1, 18, 33788 }, // ͉
-    { 13, 19, 15, 1, 26, 62, 33806 }, // ͊
-    { 22, 19, 24, 1, 29, 105, 33868 }, // ͋
-    { 15, 14, 26, 10, 14, 53, 33973 }, // ͌
-    { 13, 6, 16, 2, -3, 20, 34026 }, // ͍
-    { 5, 4, 7, 1, 3, 5, 34046 }, // ͎
-    { 22, 7, 24, 1, 1, 39, 34051 }, // ͜
-    { 22, 7, 24, 1, 20, 39, 34090 }, // ͡
-    { 27, 8, 29, 1, -1, 54, 34129 }, // ͢
-    { 22, 21, 24, 1, 21, 116, 34183 }, // Α
-    { 17, 21, 24, 4, 21, 90, 34299 }, // Β
-    { 12, 22, 14, 1, 19, 66, 34389 }, // Γ
-    { 20, 20, 22, 1, 19, 100, 34455 }, // Δ
-    { 15, 21, 23, 4, 21, 79, 34555 }, // Ε
-    { 20, 21, 27, 4, 21, 105, 34634 }, // Ζ
-    { 19, 21, 26, 4, 21, 100, 34739 }, // Η
-    { 21, 24, 28, 4, 22, 126, 34839 }, // Θ
-    { 6, 21, 14, 4, 21, 32, 34965 }, // Ι
-    { 19, 21, 26, 4, 21, 100, 34997 }, // Κ
-    { 21, 21, 28, 4, 21, 111, 35097 }, // Λ
-    { 22, 21, 29, 4, 21, 116, 35208 }, // Μ
-    { 18, 21, 26, 4, 21, 95, 35324 }, // Ν
-    { 17, 20, 19, 1, 19, 85, 35419 }, // Ξ
-    { 21, 24, 28, 4, 22, 126, 35504 }, // Ο
-    { 14, 19, 16, 1, 18, 67, 35630 }, // Π
-    { 15, 22, 23, 4, 22, 83, 35697 }, // Ρ
-    { 13, 20, 15, 1, 19, 65, 35780 }, // Σ
-    { 19, 22, 26, 4, 22, 105, 35845 }, // Τ
-    { 19, 21, 27, 4, 21, 100, 35950 }, // Υ
-    { 26, 28, 35, 4, 22, 182, 36050 }, // Φ
-    { 20, 21, 28, 4, 21, 105, 36232 }, // Χ
-    { 18, 23, 20, 1, 20, 104, 36337 }, // Ψ
-    { 20, 22, 22, 1, 20, 110, 36441 }, // Ω
-    { 18, 19, 24, 3, 16, 86, 36551 }, // α
-    { 15, 31, 17, 1, 25, 117, 36637 }, // β
-    { 16, 23, 17, 0, 15, 92, 36754 }, // γ
-    { 15, 23, 17, 1, 22, 87, 36846 }, // δ
-    { 12, 14, 14, 1, 13, 42, 36933 }, // ε
-    { 14, 23, 15, 0, 19, 81, 36975 }, // ζ
-    { 16, 23, 18, 1, 16, 92, 37056 }, // η
-    { 15, 21, 17, 1, 20, 79, 37148 }, // θ
-    { 8, 18, 16, 4, 17, 36, 37227 }, // ι
-    { 14, 15, 18, 2, 15, 53, 37263 }, // κ
-    { 17, 22, 21, 2, 21, 94, 37316 }, // λ
-    { 16, 19, 21, 2, 15, 76, 37410 }, // μ
-    { 16, 16, 17, 0, 15, 64, 37486 }, // ν
-    { 12, 23, 14, 1, 19, 69, 37550 }, // ξ
-    { 15, 16, 22, 3, 15, 60, 37619 }, // ο
-    { 16, 15, 18, 1, 14, 60, 37679 }, // π
-    { 16, 21, 18, 1, 15, 84, 37739 }, // ρ
-    { 13, 19, 14, 0, 19, 62, 37823 }, // ς
-    { 17, 16, 24, 3, 15, 68, 37885 }, // σ
-    { 15, 15, 17, 1, 14, 57, 37953 }, // τ
-    { 13, 16, 15, 1, 15, 52, 38010 }, // υ
-    { 21, 33, 28, 4, 26, 174, 38062 }, // φ
-    { 20, 21, 21, 0, 15, 105, 38236 }, // χ
-    { 15, 28, 17, 1, 20, 105, 38341 }, // ψ
-    { 20, 15, 21, 0, 13, 75, 38446 }, // ω
-    { 22, 28, 24, 1, 21, 154, 38521 }, // Ạ
-    { 15, 26, 21, 3, 16, 98, 38675 }, // ạ
-    { 22, 30, 24, 1, 30, 165, 38773 }, // Ả
-    { 15, 25, 21, 3, 24, 94, 38938 }, // ả
-    { 22, 37, 24, 1, 37, 204, 39032 }, // Ấ
-    { 16, 28, 21, 3, 27, 112, 39236 }, // ấ
-    { 24, 32, 24, -1, 32, 192, 39348 }, // Ầ
-    { 22, 29, 21, -4, 28, 160, 39540 }, // ầ
-    { 22, 38, 24, 1, 38, 209, 39700 }, // Ẩ
-    { 17, 30, 21, 3, 29, 128, 39909 }, // ẩ
-    { 22, 36, 24, 1, 36, 198, 40037 }, // Ẫ
-    { 15, 30, 21, 3, 29, 113, 40235 }, // ẫ
-    { 22, 37, 24, 1, 30, 204, 40348 }, // Ậ
-    { 15, 34, 21, 3, 24, 128, 40552 }, // ậ
-    { 22, 38, 24, 1, 38, 209, 40680 }, // Ắ
-    { 15, 33, 21, 3, 32, 124, 40889 }, // ắ
-    { 22, 38, 24, 1, 38, 209, 41013 }, // Ằ
-    { 15, 33, 21, 3, 32, 124, 41222 }, // ằ
-    { 22, 39, 24, 1, 39, 215, 41346 }, // Ẳ
-    { 15, 35, 21, 3, 34, 132, 41561 }, // ẳ
-    { 22, 39, 24, 1, 39, 215, 41693 }, // Ẵ
-    { 15, 34, 21, 3, 33, 128, 41908 }, // ẵ
-    { 22, 37, 24, 1, 30, 204, 42036 }, // Ặ
-    { 15, 34, 21, 3, 24, 128, 42240 }, // ặ
-    { 15, 31, 23, 4, 21, 117, 42368 }, // Ẹ
-    { 15, 26, 21, 3, 15, 98, 42485 }, // ẹ
-    { 15, 31, 23, 4, 31, 117, 42583 }, // Ẻ
-    { 15, 28, 21, 3, 27, 105, 42700 }, // ẻ
-    { 15, 31, 23, 4, 31, 117, 42805 }, // Ẽ
-    { 15, 28, 21, 3, 27, 105, 42922 }, // ẽ
-    { 19, 31, 24, 4, 31, 148, 43027 }, // Ế
-    { 20, 28, 24, 3, 27, 140, 43175 }, // ế
-    { 21, 33, 23, -2, 33, 174, 43315 }, // Ề
-    { 19, 31, 21, -1, 30, 148, 43489 }, // ề
-    { 16, 34, 23, 4, 34, 136, 43637 }, // Ể
-    { 17, 33, 21, 3, 32, 141, 43773 }, // ể
-    { 15, 36, 23, 4, 36, 135, 43914 }, // Ễ
-    { 15, 34, 21, 3, 33, 128, 44049 }, // ễ
-    { 15, 41, 23, 4, 31, 154, 44177 }, // Ệ
-    { 15, 38, 21, 3, 27, 143, 44331 }, // ệ
-    { 6, 32, 14, 4, 32, 48, 44474 }, // Ỉ
-    { 6, 23, 12, 3, 23, 35, 44522 }, // ỉ
-    { 7, 32, 14, 3, 21, 56, 44557 }, // Ị
-    { 6, 34, 12, 3, 23, 51, 44613 }, // ị
-    { 21, 35, 28, 4, 22, 184, 44664 }, // Ọ
-    { 15, 26, 22, 3, 15, 98, 44848 }, // ọ
-    { 21, 33, 28, 4, 31, 174, 44946 }, // Ỏ
-    { 15, 25, 22, 3, 24, 94, 45120 }, // ỏ
-    { 22, 33, 28, 4, 31, 182, 45214 }, // Ố
-    { 19, 26, 23, 3, 25, 124, 45396 }, // ố
-    { 24, 35, 28, 1, 33, 210, 45520 }, // Ồ
-    { 20, 29, 22, -2, 28, 145, 45730 }, // ồ
-    { 21, 36, 28, 4, 34, 189, 45875 }, // Ổ
-    { 17, 30, 22, 3, 29, 128, 46064 }, // ổ
-    { 21, 38, 28, 4, 36, 200, 46192 }, // Ỗ
-    { 15, 30, 22, 3, 29, 113, 46392 }, // ỗ
-    { 21, 44, 28, 4, 31, 231, 46505 }, // Ộ
-    { 15, 35, 22, 3, 24, 132, 46736 }, // ộ
-    { 22, 33, 28, 4, 31, 182, 46868 }, // Ớ
-    { 17, 24, 22, 3, 23, 102, 47050 }, // ớ
-    { 22, 33, 28, 4, 31, 182, 47152 }, // Ờ
-    { 17, 25, 22, 3, 24, 107, 47334 }, // ờ
-    { 22, 33, 28, 4, 31, 182, 47441 }, // Ở
-    { 17, 25, 22, 3, 24, 107, 47623 }, // ở
-    { 22, 33, 28, 4, 31, 182, 47730 }, // Ỡ
-    { 17, 25, 22, 3, 24, 107, 47912 }, // ỡ
-    { 22, 38, 28, 4, 25, 209, 48019 }, // Ợ
-    { 17, 28, 22, 3, 17, 119, 48228 }, // ợ
-    { 18, 32, 26, 4, 21, 144, 48347 }, // Ụ
-    { 15, 28, 21, 3, 15, 105, 48491 }, // ụ
-    { 18, 33, 26, 4, 32, 149, 48596 }, // Ủ
-    { 15, 25, 21, 3, 24, 94, 48745 }, // ủ
-    { 21, 32, 26, 4, 31, 168, 48839 }, // Ứ
-    { 18, 25, 22, 3, 24, 113, 49007 }, // ứ
-    { 21, 32, 26, 4, 31, 168, 49120 }, // Ừ
-    { 18, 25, 22, 3, 24, 113, 49288 }, // ừ
-    { 21, 33, 26, 4, 32, 174, 49401 }, // Ử
-    { 18, 25, 22, 3, 24, 113, 49575 }, // ử
-    { 21, 33, 26, 4, 32, 174, 49688 }, // Ữ
-    { 18, 25, 22, 3, 24, 113, 49862 }, // ữ
-    { 21, 37, 26, 4, 26, 195, 49975 }, // Ự
-    { 18, 32, 22, 3, 19, 144, 50170 }, // ự
-    { 19, 32, 27, 4, 32, 152, 50314 }, // Ỳ
-    { 17, 32, 23, 3, 25, 136, 50466 }, // ỳ
-    { 19, 34, 27, 4, 21, 162, 50602 }, // Ỵ
-    { 19, 24, 23, 3, 14, 114, 50764 }, // ỵ
-    { 19, 33, 27, 4, 33, 157, 50878 }, // Ỷ
-    { 17, 34, 23, 3, 27, 145, 51035 }, // ỷ
-    { 19, 34, 27, 4, 34, 162, 51180 }, // Ỹ
-    { 17, 34, 23, 3, 27, 145, 51342 }, // ỹ
-    { 0, 0, 17, 0, 0, 0, 51487 }, //  
-    { 0, 0, 29, 0, 0, 0, 51487 }, //  
-    { 0, 0, 17, 0, 0, 0, 51487 }, //  
-    { 0, 0, 29, 0, 0, 0, 51487 }, //  
-    { 0, 0, 12, 0, 0, 0, 51487 }, //  
-    { 0, 0, 10, 0, 0, 0, 51487 }, //  
-    { 0, 0, 8, 0, 0, 0, 51487 }, //  
-    { 0, 0, 18, 0, 0, 0, 51487 }, //  
-    { 0, 0, 7, 0, 0, 0, 51487 }, //  
-    { 0, 0, 9, 0, 0, 0, 51487 }, //  
-    { 0, 0, 8, 0, 0, 0, 51487 }, //  
-    { 0, 0, 4, 0, 0, 0, 51487 }, // ​
-    { 0, 0, 1, 0, 0, 0, 51487 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 51487 }, // ‍
-    { 0, 0, 1, 0, 0, 0, 51487 }, // ‎
-    { 0, 0, 1, 0, 0, 0, 51487 }, // ‏
-    { 14, 3, 15, 0, 9, 11, 51487 }, // ‐
-    { 14, 3, 15, 0, 9, 11, 51498 }, // ‑
-    { 20, 3, 18, -3, 9, 15, 51509 }, // ‒
-    { 18, 5, 20, 1, 10, 23, 51524 }, // –
-    { 26, 5, 29, 1, 10, 33, 51547 }, // —
-    { 26, 5, 29, 1, 10, 33, 51580 }, // ―
-    { 13, 23, 16, 2, 18, 75, 51613 }, // ‖
-    { 21, 8, 18, -4, -2, 42, 51688 }, // ‗
-    { 9, 9, 11, 1, 22, 21, 51730 }, // ‘
-    { 9, 9, 11, 1, 22, 21, 51751 }, // ’
-    { 8, 9, 9, 0, 4, 18, 51772 }, // ‚
-    { 9, 9, 11, 1, 22, 21, 51790 }, // ‛
-    { 17, 9, 19, 1, 22, 39, 51811 }, // “
-    { 17, 9, 19, 1, 22, 39, 51850 }, // ”
-    { 8, 9, 9, 0, 4, 18, 51889 }, // „
-    { 17, 9, 19, 1, 22, 39, 51907 }, // ‟
-    { 16, 35, 20, 2, 26, 140, 51946 }, // †
-    { 15, 35, 22, 4, 26, 132, 52086 }, // ‡
-    { 20, 19, 17, -4, 22, 95, 52218 }, // •
-    { 9, 9, 15, 3, 11, 21, 52313 }, // ‣
-    { 7, 6, 15, 4, 6, 11, 52334 }, // ․
-    { 7, 6, 15, 4, 6, 11, 52345 }, // ‥
-    { 24, 6, 25, 0, 6, 36, 52356 }, // …
-    { 4, 3, 14, 5, 9, 3, 52392 }, // ‧
-    { 0, 0, 28, 0, 0, 0, 52395 }, //  
-    { 19, 22, 28, 5, 20, 105, 52395 }, // ‰
-    { 9, 9, 14, 4, 22, 21, 52500 }, // ′
-    { 17, 9, 22, 4, 22, 39, 52521 }, // ″
-    { 20, 8, 22, 1, 21, 40, 52560 }, // ‴
-    { 7, 8, 10, 2, 21, 14, 52600 }, // ‵
-    { 12, 8, 13, 0, 21, 24, 52614 }, // ‶
-    { 20, 8, 16, -5, 21, 40, 52638 }, // ‷
-    { 14, 6, 16, 1, 21, 21, 52678 }, // ‸
-    { 8, 14, 10, 1, 14, 28, 52699 }, // ‹
-    { 8, 14, 10, 1, 14, 28, 52727 }, // ›
-    { 28, 32, 34, 4, 25, 224, 52755 }, // ※
-    { 8, 32, 15, 3, 28, 64, 52979 }, // ‼
-    { 16, 40, 22, 2, 34, 160, 53043 }, // ‽
-    { 14, 3, 15, 0, 21, 11, 53203 }, // ‾
-    { 13, 5, 14, 0, 17, 17, 53214 }, // ‿
-    { 18, 17, 18, -1, 23, 77, 53231 }, // ⁂
-    { 17, 22, 31, 7, 20, 94, 53308 }, // ⁄
-    { 31, 31, 38, 3, 28, 241, 53402 }, // ⁇
-    { 26, 32, 30, 2, 28, 208, 53643 }, // ⁈
-    { 21, 32, 21, -1, 28, 168, 53851 }, // ⁉
-    { 19, 44, 23, 2, 30, 209, 54019 }, // ⁒
-    { 0, 0, 117, 0, 0, 0, 54228 }, //  
-    { 8, 10, 9, 0, 21, 20, 54228 }, // ⁰
-    { 8, 9, 9, 0, 21, 18, 54248 }, // ⁴
-    { 7, 11, 9, 1, 22, 20, 54266 }, // ⁵
-    { 7, 10, 9, 1, 21, 18, 54286 }, // ⁶
-    { 7, 11, 9, 1, 22, 20, 54304 }, // ⁷
-    { 9, 11, 10, 0, 21, 25, 54324 }, // ⁸
-    { 8, 11, 9, 0, 21, 22, 54349 }, // ⁹
-    { 15, 16, 22, 3, 16, 60, 54371 }, // ⁿ
-    { 7, 10, 9, 1, 6, 18, 54431 }, // ₀
-    { 7, 11, 9, 1, 6, 20, 54449 }, // ₁
-    { 7, 11, 9, 1, 6, 20, 54469 }, // ₂
-    { 7, 10, 9, 1, 6, 18, 54489 }, // ₃
-    { 8, 10, 10, 1, 6, 20, 54507 }, // ₄
-    { 7, 10, 9, 1, 6, 18, 54527 }, // ₅
-    { 7, 10, 9, 1, 6, 18, 54545 }, // ₆
-    { 7, 11, 9, 1, 6, 20, 54563 }, // ₇
-    { 9, 11, 10, 0, 6, 25, 54583 }, // ₈
-    { 8, 11, 10, 1, 6, 22, 54608 }, // ₉
-    { 11, 35, 13, 1, 26, 97, 54630 }, // ₍
-    { 11, 35, 11, -1, 26, 97, 54727 }, // ₎
-    { 18, 33, 25, 3, 28, 149, 54824 }, // ₡
-    { 18, 23, 25, 3, 23, 104, 54973 }, // ₢
-    { 17, 23, 18, 0, 22, 98, 55077 }, // ₤
-    { 27, 21, 27, -1, 21, 142, 55175 }, // ₦
-    { 22, 22, 23, 0, 22, 121, 55317 }, // ₧
-    { 27, 23, 33, 3, 21, 156, 55438 }, // ₨
-    { 21, 22, 22, 0, 22, 116, 55594 }, // ₩
-    { 20, 19, 27, 3, 19, 95, 55710 }, // ₪
-    { 19, 22, 18, -2, 21, 105, 55805 }, // ₫
-    { 18, 24, 19, 0, 20, 108, 55910 }, // €
-    { 19, 22, 26, 4, 22, 105, 56018 }, // ₮
-    { 25, 22, 25, -1, 22, 138, 56123 }, // ₱
-    { 21, 33, 29, 4, 28, 174, 56261 }, // ₲
-    { 25, 21, 31, 5, 19, 132, 56435 }, // ₴
-    { 13, 20, 17, 3, 18, 65, 56567 }, // ₵
-    { 20, 23, 26, 3, 23, 115, 56632 }, // ₸
-    { 13, 21, 17, 2, 20, 69, 56747 }, // ₹
-    { 15, 19, 17, 1, 17, 72, 56816 }, // ₺
-    { 18, 21, 20, 1, 20, 95, 56888 }, // ₼
-    { 21, 22, 23, -2, 22, 116, 56983 }, // ₽
-    { 17, 18, 18, 0, 15, 77, 57099 }, // ←
-    { 19, 18, 20, 0, 17, 86, 57176 }, // ↑
-    { 17, 18, 19, 1, 15, 77, 57262 }, // →
-    { 19, 17, 20, 0, 16, 81, 57339 }, // ↓
-    { 21, 15, 26, 2, 14, 79, 57420 }, // ↔
-    { 16, 20, 20, 2, 22, 80, 57499 }, // ↕
-    { 15, 14, 20, 2, 13, 53, 57579 }, // ↖
-    { 14, 14, 16, 1, 13, 49, 57632 }, // ↗
-    { 14, 14, 16, 1, 14, 49, 57681 }, // ↘
-    { 14, 14, 16, 1, 14, 49, 57730 }, // ↙
-    { 20, 18, 24, 2, 16, 90, 57779 }, // ⇐
-    { 22, 20, 27, 2, 19, 110, 57869 }, // ⇑
-    { 20, 18, 24, 2, 16, 90, 57979 }, // ⇒
-    { 22, 20, 27, 2, 18, 110, 58069 }, // ⇓
-    { 23, 18, 27, 2, 16, 104, 58179 }, // ⇔
-    { 18, 22, 22, 2, 13, 99, 58283 }, // ⇕
-    { 15, 22, 17, 1, 21, 83, 58382 }, // ∂
-    { 26, 26, 28, 1, 23, 169, 58465 }, // ∅
-    { 20, 20, 22, 1, 19, 100, 58634 }, // ∆
-    { 17, 20, 19, 1, 19, 85, 58734 }, // ∏
-    { 17, 19, 19, 1, 18, 81, 58819 }, // ∐
-    { 13, 20, 15, 1, 19, 65, 58900 }, // ∑
-    { 15, 4, 16, 0, 9, 15, 58965 }, // −
-    { 22, 23, 24, 1, 21, 127, 58980 }, // √
-    { 21, 14, 23, 1, 16, 74, 59107 }, // ∞
-    { 20, 27, 22, 1, 20, 135, 59181 }, // ∫
-    { 7, 17, 9, 1, 17, 30, 59316 }, // ∶
-    { 15, 14, 36, 10, 14, 53, 59346 }, // ≈
-    { 19, 22, 31, 6, 20, 105, 59399 }, // ≠
-    { 21, 21, 21, -1, 18, 111, 59504 }, // ≤
-    { 22, 22, 23, 0, 19, 121, 59615 }, // ≥
+    { 8, 32, 9, 0, 28, 39, 0 }, // !
+    { 16, 9, 18, -2, 22, 37, 39 }, // "
+    { 28, 23, 28, -1, 21, 99, 76 }, // #
+    { 21, 30, 29, 4, 24, 95, 175 }, // $
+    { 22, 22, 27, 4, 20, 80, 270 }, // %
+    { 19, 21, 23, 2, 20, 72, 350 }, // &
+    { 7, 9, 9, 1, 20, 20, 422 }, // '
+    { 11, 35, 13, 1, 26, 54, 442 }, // (
+    { 11, 35, 11, -1, 26, 52, 496 }, // )
+    { 15, 14, 16, 0, 20, 42, 548 }, // *
+    { 14, 14, 16, 1, 14, 29, 590 }, // +
+    { 8, 9, 9, 0, 4, 19, 619 }, // ,
+    { 14, 3, 15, 0, 9, 8, 638 }, // -
+    { 6, 6, 7, 0, 6, 10, 646 }, // .
+    { 17, 43, 18, 0, 29, 87, 656 }, // /
+    { 15, 21, 18, 2, 20, 65, 743 }, // 0
+    { 12, 19, 16, 2, 19, 29, 808 }, // 1
+    { 14, 20, 18, 2, 20, 47, 837 }, // 2
+    { 14, 20, 18, 2, 19, 52, 884 }, // 3
+    { 15, 20, 19, 2, 19, 51, 936 }, // 4
+    { 14, 21, 18, 2, 20, 52, 987 }, // 5
+    { 15, 20, 18, 2, 19, 55, 1039 }, // 6
+    { 14, 20, 17, 2, 20, 41, 1094 }, // 7
+    { 16, 20, 19, 1, 19, 61, 1135 }, // 8
+    { 15, 21, 18, 2, 19, 57, 1196 }, // 9
+    { 7, 17, 8, 0, 17, 24, 1253 }, // :
+    { 9, 21, 10, 0, 16, 33, 1277 }, // ;
+    { 20, 17, 20, -1, 17, 48, 1310 }, // <
+    { 15, 10, 16, 0, 12, 29, 1358 }, // =
+    { 19, 17, 21, 1, 17, 49, 1387 }, // >
+    { 16, 31, 17, 0, 28, 67, 1436 }, // ?
+    { 23, 24, 26, 0, 21, 105, 1503 }, // @
+    { 22, 21, 24, 1, 21, 68, 1608 }, // A
+    { 17, 21, 24, 4, 21, 61, 1676 }, // B
+    { 18, 23, 25, 3, 23, 64, 1737 }, // C
+    { 19, 21, 26, 4, 21, 68, 1801 }, // D
+    { 15, 21, 23, 4, 21, 64, 1869 }, // E
+    { 14, 22, 21, 4, 22, 52, 1933 }, // F
+    { 21, 22, 29, 4, 21, 74, 1985 }, // G
+    { 19, 21, 26, 4, 21, 73, 2059 }, // H
+    { 6, 21, 14, 4, 21, 37, 2132 }, // I
+    { 15, 27, 23, 4, 21, 61, 2169 }, // J
+    { 19, 21, 26, 4, 21, 66, 2230 }, // K
+    { 15, 21, 22, 4, 21, 43, 2296 }, // L
+    { 22, 21, 29, 4, 21, 102, 2339 }, // M
+    { 18, 21, 26, 4, 21, 80, 2441 }, // N
+    { 21, 24, 28, 4, 22, 84, 2521 }, // O
+    { 15, 22, 23, 4, 22, 56, 2605 }, // P
+    { 23, 27, 27, 2, 22, 92, 2661 }, // Q
+    { 17, 22, 24, 4, 21, 71, 2753 }, // R
+    { 19, 23, 27, 4, 21, 69, 2824 }, // S
+    { 19, 22, 26, 4, 22, 59, 2893 }, // T
+    { 18, 22, 26, 4, 21, 67, 2952 }, // U
+    { 21, 21, 28, 4, 21, 69, 3019 }, // V
+    { 28, 22, 36, 4, 22, 100, 3088 }, // W
+    { 20, 21, 28, 4, 21, 69, 3188 }, // X
+    { 19, 21, 27, 4, 21, 59, 3257 }, // Y
+    { 20, 21, 27, 4, 21, 68, 3316 }, // Z
+    { 10, 36, 12, 1, 27, 66, 3384 }, // [
+    { 10, 29, 12, 1, 22, 44, 3450 }, // <backslash>
+    { 10, 36, 12, 1, 27, 63, 3494 }, // ]
+    { 15, 7, 16, 0, 25, 18, 3557 }, // ^
+    { 19, 5, 19, -1, -1, 20, 3575 }, // _
+    { 11, 6, 12, 0, 20, 11, 3595 }, // `
+    { 15, 17, 21, 3, 16, 46, 3606 }, // a
+    { 16, 23, 22, 3, 22, 63, 3652 }, // b
+    { 13, 16, 20, 3, 16, 36, 3715 }, // c
+    { 16, 22, 22, 3, 21, 59, 3751 }, // d
+    { 15, 16, 21, 3, 15, 49, 3810 }, // e
+    { 11, 22, 17, 3, 22, 39, 3859 }, // f
+    { 15, 23, 22, 3, 15, 69, 3898 }, // g
+    { 16, 21, 22, 3, 21, 59, 3967 }, // h
+    { 6, 23, 12, 3, 23, 33, 4026 }, // i
+    { 10, 29, 16, 3, 22, 41, 4059 }, // j
+    { 16, 21, 23, 3, 21, 51, 4100 }, // k
+    { 9, 21, 15, 3, 21, 33, 4151 }, // l
+    { 24, 16, 31, 3, 16, 72, 4184 }, // m
+    { 15, 16, 22, 3, 16, 49, 4256 }, // n
+    { 15, 16, 22, 3, 15, 44, 4305 }, // o
+    { 17, 23, 23, 3, 15, 65, 4349 }, // p
+    { 18, 23, 24, 3, 16, 68, 4414 }, // q
+    { 12, 15, 18, 3, 15, 27, 4482 }, // r
+    { 15, 18, 22, 3, 16, 46, 4509 }, // s
+    { 13, 21, 20, 3, 20, 41, 4555 }, // t
+    { 15, 16, 21, 3, 15, 47, 4596 }, // u
+    { 18, 15, 25, 3, 15, 43, 4643 }, // v
+    { 21, 16, 28, 3, 15, 57, 4686 }, // w
+    { 18, 14, 25, 3, 14, 43, 4743 }, // x
+    { 17, 21, 23, 3, 14, 53, 4786 }, // y
+    { 16, 15, 22, 3, 15, 40, 4839 }, // z
+    { 12, 26, 14, 1, 20, 45, 4879 }, // {
+    { 5, 23, 10, 2, 18, 40, 4924 }, // |
+    { 12, 26, 14, 1, 20, 45, 4964 }, // }
+    { 10, 6, 12, 1, 20, 19, 5009 }, // ~
+    { 0, 0, 22, 0, 0, 0, 5028 }, //  
+    { 8, 32, 19, 5, 28, 44, 5028 }, // ¡
+    { 13, 24, 20, 3, 20, 61, 5072 }, // ¢
+    { 16, 23, 18, 1, 22, 63, 5133 }, // £
+    { 15, 15, 17, 1, 17, 44, 5196 }, // ¤
+    { 19, 22, 20, 0, 19, 58, 5240 }, // ¥
+    { 4, 22, 10, 2, 18, 29, 5298 }, // ¦
+    { 14, 23, 19, 2, 20, 63, 5327 }, // §
+    { 13, 6, 14, 0, 21, 21, 5390 }, // ¨
+    { 12, 11, 17, 2, 24, 37, 5411 }, // ©
+    { 9, 9, 16, 5, 19, 25, 5448 }, // ª
+    { 14, 14, 15, 0, 13, 40, 5473 }, // «
+    { 13, 9, 15, 1, 10, 21, 5513 }, // ¬
+    { 13, 3, 15, 1, 9, 5, 5534 }, // ­
+    { 12, 12, 17, 2, 28, 36, 5539 }, // ®
+    { 11, 4, 13, 1, 19, 10, 5575 }, // ¯
+    { 12, 11, 17, 2, 19, 26, 5585 }, // °
+    { 15, 16, 16, 0, 14, 38, 5611 }, // ±
+    { 8, 8, 9, 0, 20, 15, 5649 }, // ²
+    { 8, 10, 9, 0, 21, 21, 5664 }, // ³
+    { 7, 6, 8, 0, 19, 9, 5685 }, // ´
+    { 16, 19, 21, 2, 15, 56, 5694 }, // µ
+    { 14, 22, 19, 2, 18, 80, 5750 }, // ¶
+    { 6, 6, 7, 0, 12, 11, 5830 }, // ·
+    { 7, 8, 9, 1, 1, 17, 5841 }, // ¸
+    { 7, 9, 8, 0, 21, 18, 5858 }, // ¹
+    { 9, 8, 17, 5, 18, 18, 5876 }, // º
+    { 14, 14, 19, 2, 13, 40, 5894 }, // »
+    { 23, 23, 31, 4, 21, 92, 5934 }, // ¼
+    { 25, 23, 31, 4, 21, 92, 6026 }, // ½
+    { 23, 23, 31, 4, 21, 97, 6118 }, // ¾
+    { 16, 32, 17, 0, 18, 70, 6215 }, // ¿
+    { 22, 28, 24, 1, 28, 83, 6285 }, // À
+    { 22, 32, 24, 1, 32, 89, 6368 }, // Á
+    { 22, 30, 24, 1, 30, 91, 6457 }, // Â
+    { 22, 29, 24, 1, 29, 94, 6548 }, // Ã
+    { 22, 30, 24, 1, 30, 96, 6642 }, // Ä
+    { 22, 30, 24, 1, 30, 91, 6738 }, // Å
+    { 32, 22, 34, 1, 21, 106, 6829 }, // Æ
+    { 18, 30, 25, 3, 23, 80, 6935 }, // Ç
+    { 15, 29, 23, 4, 29, 77, 7015 }, // È
+    { 15, 33, 23, 4, 33, 79, 7092 }, // É
+    { 15, 31, 23, 4, 31, 80, 7171 }, // Ê
+    { 15, 31, 23, 4, 31, 88, 7251 }, // Ë
+    { 11, 30, 14, 0, 30, 51, 7339 }, // Ì
+    { 6, 34, 14, 4, 34, 48, 7390 }, // Í
+    { 14, 32, 15, 0, 32, 65, 7438 }, // Î
+    { 13, 32, 14, 0, 32, 64, 7503 }, // Ï
+    { 24, 21, 26, -1, 21, 72, 7567 }, // Ð
+    { 18, 29, 26, 4, 29, 101, 7639 }, // Ñ
+    { 21, 31, 28, 4, 29, 100, 7740 }, // Ò
+    { 21, 35, 28, 4, 33, 105, 7840 }, // Ó
+    { 21, 33, 28, 4, 31, 108, 7945 }, // Ô
+    { 21, 32, 28, 4, 30, 110, 8053 }, // Õ
+    { 21, 33, 28, 4, 31, 113, 8163 }, // Ö
+    { 15, 9, 16, 0, 11, 23, 8276 }, // ×
+    { 36, 50, 33, -4, 36, 206, 8299 }, // Ø
+    { 18, 31, 26, 4, 30, 82, 8505 }, // Ù
+    { 18, 35, 26, 4, 34, 87, 8587 }, // Ú
+    { 18, 33, 26, 4, 32, 91, 8674 }, // Û
+    { 18, 32, 26, 4, 31, 94, 8765 }, // Ü
+    { 19, 36, 27, 4, 36, 82, 8859 }, // Ý
+    { 12, 20, 14, 1, 20, 51, 8941 }, // Þ
+    { 15, 22, 17, 1, 20, 69, 8992 }, // ß
+    { 15, 23, 21, 3, 22, 59, 9061 }, // à
+    { 15, 27, 21, 3, 26, 60, 9120 }, // á
+    { 15, 25, 21, 3, 24, 63, 9180 }, // â
+    { 15, 23, 21, 3, 22, 63, 9243 }, // ã
+    { 15, 25, 21, 3, 24, 70, 9306 }, // ä
+    { 15, 25, 21, 3, 24, 65, 9376 }, // å
+    { 25, 17, 31, 3, 16, 77, 9441 }, // æ
+    { 13, 22, 20, 3, 16, 49, 9518 }, // ç
+    { 15, 26, 21, 3, 25, 65, 9567 }, // è
+    { 15, 31, 21, 3, 30, 69, 9632 }, // é
+    { 15, 28, 21, 3, 27, 69, 9701 }, // ê
+    { 15, 28, 21, 3, 27, 75, 9770 }, // ë
+    { 10, 22, 12, 0, 22, 32, 9845 }, // ì
+    { 6, 26, 12, 3, 26, 32, 9877 }, // í
+    { 14, 23, 14, -1, 23, 47, 9909 }, // î
+    { 12, 22, 13, 0, 22, 38, 9956 }, // ï
+    { 20, 22, 20, -1, 21, 61, 9994 }, // ð
+    { 15, 24, 22, 3, 24, 68, 10055 }, // ñ
+    { 15, 23, 22, 3, 22, 58, 10123 }, // ò
+    { 15, 27, 22, 3, 26, 59, 10181 }, // ó
+    { 15, 25, 22, 3, 24, 62, 10240 }, // ô
+    { 15, 24, 22, 3, 23, 65, 10302 }, // õ
+    { 15, 25, 22, 3, 24, 70, 10367 }, // ö
+    { 19, 18, 22, 2, 17, 44, 10437 }, // ÷
+    { 17, 44, 22, 2, 30, 105, 10481 }, // ø
+    { 15, 24, 21, 3, 23, 60, 10586 }, // ù
+    { 15, 28, 21, 3, 27, 63, 10646 }, // ú
+    { 15, 25, 21, 3, 24, 63, 10709 }, // û
+    { 15, 25, 21, 3, 24, 72, 10772 }, // ü
+    { 17, 36, 23, 3, 29, 73, 10844 }, // ý
+    { 12, 26, 14, 1, 21, 60, 10917 }, // þ
+    { 17, 33, 23, 3, 26, 81, 10977 }, // ÿ
+    { 22, 29, 24, 1, 29, 91, 11058 }, // Ā
+    { 15, 25, 21, 3, 24, 64, 11149 }, // ā
+    { 22, 30, 24, 1, 30, 89, 11213 }, // Ă
+    { 15, 25, 21, 3, 24, 63, 11302 }, // ă
+    { 22, 28, 24, 1, 21, 85, 11365 }, // Ą
+    { 17, 24, 21, 3, 16, 65, 11450 }, // ą
+    { 18, 31, 25, 3, 31, 77, 11515 }, // Ć
+    { 13, 21, 20, 3, 21, 46, 11592 }, // ć
+    { 18, 32, 25, 3, 32, 82, 11638 }, // Ĉ
+    { 14, 24, 20, 3, 24, 52, 11720 }, // ĉ
+    { 18, 31, 25, 3, 31, 80, 11772 }, // Ċ
+    { 13, 22, 20, 3, 22, 48, 11852 }, // ċ
+    { 18, 33, 25, 3, 33, 86, 11900 }, // Č
+    { 14, 24, 20, 3, 24, 58, 11986 }, // č
+    { 19, 31, 26, 4, 31, 92, 12044 }, // Ď
+    { 20, 22, 24, 3, 21, 71, 12136 }, // ď
+    { 24, 21, 26, -1, 21, 72, 12207 }, // Đ
+    { 20, 22, 24, 3, 21, 65, 12279 }, // đ
+    { 15, 30, 23, 4, 30, 85, 12344 }, // Ē
+    { 15, 28, 21, 3, 27, 69, 12429 }, // ē
+    { 15, 31, 23, 4, 31, 82, 12498 }, // Ĕ
+    { 15, 28, 21, 3, 27, 69, 12580 }, // ĕ
+    { 15, 31, 23, 4, 31, 81, 12649 }, // Ė
+    { 15, 28, 21, 3, 27, 67, 12730 }, // ė
+    { 15, 28, 23, 4, 21, 77, 12797 }, // Ę
+    { 15, 25, 21, 3, 15, 65, 12874 }, // ę
+    { 15, 33, 23, 4, 33, 86, 12939 }, // Ě
+    { 15, 30, 21, 3, 29, 73, 13025 }, // ě
+    { 21, 34, 29, 4, 33, 98, 13098 }, // Ĝ
+    { 16, 34, 22, 3, 26, 91, 13196 }, // ĝ
+    { 21, 33, 29, 4, 32, 97, 13287 }, // Ğ
+    { 15, 33, 22, 3, 25, 87, 13384 }, // ğ
+    { 21, 33, 29, 4, 32, 96, 13471 }, // Ġ
+    { 15, 33, 22, 3, 25, 86, 13567 }, // ġ
+    { 21, 38, 29, 4, 37, 106, 13653 }, // Ģ
+    { 15, 34, 22, 3, 26, 92, 13759 }, // ģ
+    { 19, 31, 26, 4, 31, 93, 13851 }, // Ĥ
+    { 19, 30, 22, 0, 30, 78, 13944 }, // ĥ
+    { 22, 21, 26, 2, 21, 79, 14022 }, // Ħ
+    { 19, 21, 22, 0, 21, 64, 14101 }, // ħ
+    { 11, 32, 14, 1, 32, 62, 14165 }, // Ĩ
+    { 10, 23, 12, 1, 23, 40, 14227 }, // ĩ
+    { 14, 31, 14, -1, 31, 70, 14267 }, // Ī
+    { 15, 23, 14, -2, 23, 45, 14337 }, // ī
+    { 8, 28, 14, 2, 21, 50, 14382 }, // Į
+    { 8, 31, 12, 2, 23, 47, 14432 }, // į
+    { 7, 32, 14, 3, 32, 50, 14479 }, // İ
+    { 6, 14, 12, 3, 14, 22, 14529 }, // ı
+    { 20, 31, 40, 9, 21, 93, 14551 }, // Ĳ
+    { 15, 30, 19, 3, 24, 77, 14644 }, // ĳ
+    { 17, 37, 23, 4, 31, 83, 14721 }, // Ĵ
+    { 14, 32, 18, 3, 25, 58, 14804 }, // ĵ
+    { 19, 34, 26, 4, 34, 94, 14862 }, // Ķ
+    { 16, 34, 23, 3, 21, 78, 14956 }, // ķ
+    { 12, 14, 16, 2, 14, 34, 15034 }, // ĸ
+    { 15, 28, 22, 4, 28, 55, 15068 }, // Ĺ
+    { 9, 32, 15, 3, 32, 45, 15123 }, // ĺ
+    { 17, 33, 22, 2, 33, 71, 15168 }, // Ļ
+    { 10, 35, 15, 2, 21, 54, 15239 }, // ļ
+    { 15, 21, 22, 4, 21, 50, 15293 }, // Ľ
+    { 12, 25, 16, 3, 25, 45, 15343 }, // ľ
+    { 15, 21, 22, 4, 21, 51, 15388 }, // Ŀ
+    { 12, 21, 16, 3, 21, 44, 15439 }, // ŀ
+    { 27, 37, 22, -7, 29, 110, 15483 }, // Ł
+    { 19, 21, 15, -5, 21, 53, 15593 }, // ł
+    { 18, 30, 26, 4, 30, 96, 15646 }, // Ń
+    { 15, 25, 22, 3, 25, 63, 15742 }, // ń
+    { 18, 31, 26, 4, 21, 103, 15805 }, // Ņ
+    { 15, 26, 22, 3, 16, 72, 15908 }, // ņ
+    { 18, 32, 26, 4, 32, 106, 15980 }, // Ň
+    { 16, 27, 22, 3, 27, 73, 16086 }, // ň
+    { 15, 26, 22, 3, 26, 65, 16159 }, // ŉ
+    { 18, 27, 26, 4, 21, 96, 16224 }, // Ŋ
+    { 15, 21, 22, 3, 16, 61, 16320 }, // ŋ
+    { 21, 32, 28, 4, 30, 108, 16381 }, // Ō
+    { 15, 25, 22, 3, 24, 66, 16489 }, // ō
+    { 21, 33, 28, 4, 31, 106, 16555 }, // Ŏ
+    { 15, 25, 22, 3, 24, 62, 16661 }, // ŏ
+    { 23, 32, 28, 4, 30, 108, 16723 }, // Ő
+    { 22, 24, 24, 1, 23, 72, 16831 }, // ő
+    { 29, 24, 34, 4, 22, 118, 16903 }, // Œ
+    { 26, 16, 30, 3, 15, 78, 17021 }, // œ
+    { 17, 30, 24, 4, 29, 84, 17099 }, // Ŕ
+    { 12, 22, 18, 3, 22, 37, 17183 }, // ŕ
+    { 17, 35, 24, 4, 34, 98, 17220 }, // Ŗ
+    { 12, 27, 18, 3, 27, 47, 17318 }, // ŗ
+    { 17, 32, 24, 4, 31, 94, 17365 }, // Ř
+    { 14, 24, 18, 1, 24, 51, 17459 }, // ř
+    { 19, 31, 27, 4, 29, 83, 17510 }, // Ś
+    { 15, 24, 22, 3, 22, 57, 17593 }, // ś
+    { 19, 32, 27, 4, 30, 87, 17650 }, // Ŝ
+    { 15, 26, 22, 3, 24, 61, 17737 }, // ŝ
+    { 19, 28, 27, 4, 21, 84, 17798 }, // Ş
+    { 15, 24, 22, 3, 16, 61, 17882 }, // ş
+    { 19, 33, 27, 4, 31, 93, 17943 }, // Š
+    { 15, 26, 22, 3, 24, 67, 18036 }, // š
+    { 19, 29, 26, 4, 22, 75, 18103 }, // Ţ
+    { 13, 26, 20, 3, 20, 51, 18178 }, // ţ
+    { 19, 32, 26, 4, 32, 79, 18229 }, // Ť
+    { 17, 24, 21, 3, 23, 56, 18308 }, // ť
+    { 19, 22, 26, 4, 22, 61, 18364 }, // Ŧ
+    { 14, 21, 20, 2, 20, 43, 18425 }, // ŧ
+    { 18, 33, 26, 4, 32, 93, 18468 }, // Ũ
+    { 15, 25, 21, 3, 24, 66, 18561 }, // ũ
+    { 18, 32, 26, 4, 31, 87, 18627 }, // Ū
+    { 15, 25, 21, 3, 24, 64, 18714 }, // ū
+    { 18, 32, 26, 4, 31, 88, 18778 }, // Ŭ
+    { 15, 25, 21, 3, 24, 66, 18866 }, // ŭ
+    { 18, 34, 26, 4, 33, 88, 18932 }, // Ů
+    { 15, 27, 21, 3, 26, 67, 19020 }, // ů
+    { 22, 31, 26, 3, 30, 99, 19087 }, // Ű
+    { 22, 24, 24, 1, 23, 75, 19186 }, // ű
+    { 18, 28, 26, 4, 21, 80, 19261 }, // Ų
+    { 15, 23, 21, 3, 15, 63, 19341 }, // ų
+    { 28, 31, 36, 4, 31, 123, 19404 }, // Ŵ
+    { 21, 27, 28, 3, 26, 81, 19527 }, // ŵ
+    { 19, 33, 27, 4, 33, 82, 19608 }, // Ŷ
+    { 17, 34, 23, 3, 27, 77, 19690 }, // ŷ
+    { 19, 33, 27, 4, 33, 89, 19767 }, // Ÿ
+    { 20, 28, 27, 4, 28, 81, 19856 }, // Ź
+    { 16, 24, 22, 3, 24, 54, 19937 }, // ź
+    { 20, 29, 27, 4, 29, 84, 19991 }, // Ż
+    { 16, 24, 22, 3, 24, 56, 20075 }, // ż
+    { 20, 31, 27, 4, 31, 90, 20131 }, // Ž
+    { 16, 26, 22, 3, 26, 62, 20221 }, // ž
+    { 10, 21, 15, 2, 21, 35, 20283 }, // ſ
+    { 22, 27, 28, 4, 25, 97, 20318 }, // Ơ
+    { 17, 18, 22, 3, 17, 55, 20415 }, // ơ
+    { 20, 22, 23, -1, 22, 70, 20470 }, // Ƥ
+    { 17, 26, 23, 3, 19, 78, 20540 }, // ƥ
+    { 13, 20, 15, 1, 19, 40, 20618 }, // Ʃ
+    { 21, 22, 26, 2, 22, 63, 20658 }, // Ƭ
+    { 13, 25, 20, 3, 24, 49, 20721 }, // ƭ
+    { 19, 26, 26, 4, 22, 70, 20770 }, // Ʈ
+    { 21, 27, 26, 4, 26, 84, 20840 }, // Ư
+    { 18, 20, 22, 3, 19, 56, 20924 }, // ư
+    { 11, 6, 12, 0, 20, 11, 20980 }, // ̀
+    { 7, 6, 8, 0, 19, 9, 20991 }, // ́
+    { 14, 7, 15, 0, 1, 16, 21000 }, // ̂
+    { 10, 6, 12, 1, 20, 19, 21016 }, // ̃
+    { 14, 4, 16, 1, 17, 17, 21035 }, // ̄
+    { 18, 4, 19, 0, 23, 20, 21052 }, // ̅
+    { 13, 5, 14, 0, 18, 15, 21072 }, // ̆
+    { 7, 6, 11, 3, 21, 11, 21087 }, // ̇
+    { 12, 5, 13, 0, 18, 14, 21098 }, // ̈
+    { 5, 6, 11, 5, 16, 7, 21112 }, // ̉
+    { 7, 7, 9, 1, 20, 13, 21119 }, // ̊
+    { 22, 6, 23, 0, 20, 18, 21132 }, // ̋
+    { 14, 7, 15, 0, 20, 15, 21150 }, // ̌
+    { 22, 6, 17, -6, 20, 20, 21165 }, // ̏
+    { 8, 9, 9, 0, 20, 18, 21185 }, // ̒
+    { 9, 9, 10, 0, 19, 19, 21203 }, // ̓
+    { 9, 9, 9, -1, 19, 19, 21222 }, // ̔
+    { 6, 7, 8, 1, 0, 13, 21241 }, // ̘
+    { 6, 7, 8, 1, 0, 12, 21254 }, // ̙
+    { 12, 8, 14, 1, 21, 16, 21266 }, // ̚
+    { 6, 8, 7, 0, 17, 11, 21282 }, // ̛
+    { 4, 8, 6, 1, 0, 9, 21293 }, // ̜
+    { 7, 6, 9, 1, 4, 10, 21302 }, // ̝
+    { 7, 6, 9, 1, 0, 11, 21312 }, // ̞
+    { 6, 6, 8, 1, -2, 9, 21323 }, // ̟
+    { 15, 4, 16, 0, -3, 17, 21332 }, // ̠
+    { 7, 6, 8, 0, 2, 12, 21349 }, // ̣
+    { 12, 5, 13, 0, -2, 14, 21361 }, // ̤
+    { 7, 7, 9, 1, 20, 13, 21375 }, // ̥
+    { 8, 9, 9, 0, 4, 19, 21388 }, // ̦
+    { 7, 8, 9, 1, 1, 17, 21407 }, // ̧
+    { 8, 9, 10, 1, 1, 14, 21424 }, // ̨
+    { 5, 9, 7, 1, 0, 11, 21438 }, // ̩
+    { 11, 6, 12, 0, 0, 16, 21449 }, // ̪
+    { 16, 8, 16, -1, 1, 17, 21465 }, // ̬
+    { 16, 8, 16, -1, 1, 18, 21482 }, // ̭
+    { 11, 6, 13, 1, 21, 21, 21500 }, // ̰
+    { 13, 4, 15, 1, 21, 12, 21521 }, // ̱
+    { 13, 4, 14, 0, -1, 14, 21533 }, // ̲
+    { 11, 6, 13, 1, 21, 21, 21547 }, // ̴
+    { 14, 3, 15, 0, 9, 8, 21568 }, // ̵
+    { 5, 8, 7, 1, 0, 8, 21576 }, // ̹
+    { 11, 8, 12, 0, 1, 16, 21584 }, // ̺
+    { 10, 8, 11, 0, 1, 20, 21600 }, // ̻
+    { 9, 7, 11, 1, 1, 19, 21620 }, // ̼
+    { 8, 6, 11, 2, 19, 15, 21639 }, // ̽
+    { 10, 6, 12, 1, 20, 19, 21654 }, // ͂
+    { 5, 7, 12, 6, 22, 11, 21673 }, // ̓
+    { 12, 19, 14, 1, 32, 31, 21684 }, // ̈́
+    { 11, 7, 12, 0, 21, 16, 21715 }, // ͆
+    { 15, 10, 16, 0, 0, 31, 21731 }, // ͇
+    { 11, 8, 13, 1, 1, 24, 21762 }, // ͈
+    { 9, 8, 11, 1, -1, 18, 21786 }, // ͉
+    { 13, 19, 15, 1, 26, 43, 21804 }, // ͊
+    { 22, 19, 24, 1, 29, 63, 21847 }, // ͋
+    { 15, 14, 26, 10, 14, 46, 21910 }, // ͌
+    { 13, 6, 16, 2, -3, 12, 21956 }, // ͍
+    { 5, 4, 7, 1, 3, 7, 21968 }, // ͎
+    { 22, 7, 24, 1, 1, 23, 21975 }, // ͜
+    { 22, 7, 24, 1, 20, 26, 21998 }, // ͡
+    { 27, 8, 29, 1, -1, 26, 22024 }, // ͢
+    { 22, 21, 24, 1, 21, 68, 22050 }, // Α
+    { 17, 21, 24, 4, 21, 61, 22118 }, // Β
+    { 12, 22, 14, 1, 19, 38, 22179 }, // Γ
+    { 20, 20, 22, 1, 19, 64, 22217 }, // Δ
+    { 15, 21, 23, 4, 21, 64, 22281 }, // Ε
+    { 20, 21, 27, 4, 21, 68, 22345 }, // Ζ
+    { 19, 21, 26, 4, 21, 73, 22413 }, // Η
+    { 21, 24, 28, 4, 22, 92, 22486 }, // Θ
+    { 6, 21, 14, 4, 21, 37, 22578 }, // Ι
+    { 19, 21, 26, 4, 21, 66, 22615 }, // Κ
+    { 21, 21, 28, 4, 21, 69, 22681 }, // Λ
+    { 22, 21, 29, 4, 21, 102, 22750 }, // Μ
+    { 18, 21, 26, 4, 21, 80, 22852 }, // Ν
+    { 17, 20, 19, 1, 19, 52, 22932 }, // Ξ
+    { 21, 24, 28, 4, 22, 84, 22984 }, // Ο
+    { 14, 19, 16, 1, 18, 56, 23068 }, // Π
+    { 15, 22, 23, 4, 22, 56, 23124 }, // Ρ
+    { 13, 20, 15, 1, 19, 38, 23180 }, // Σ
+    { 19, 22, 26, 4, 22, 59, 23218 }, // Τ
+    { 19, 21, 27, 4, 21, 59, 23277 }, // Υ
+    { 26, 28, 35, 4, 22, 113, 23336 }, // Φ
+    { 20, 21, 28, 4, 21, 69, 23449 }, // Χ
+    { 18, 23, 20, 1, 20, 72, 23518 }, // Ψ
+    { 20, 22, 22, 1, 20, 71, 23590 }, // Ω
+    { 18, 19, 24, 3, 16, 55, 23661 }, // α
+    { 15, 31, 17, 1, 25, 82, 23716 }, // β
+    { 16, 23, 17, 0, 15, 56, 23798 }, // γ
+    { 15, 23, 17, 1, 22, 63, 23854 }, // δ
+    { 12, 14, 14, 1, 13, 33, 23917 }, // ε
+    { 14, 23, 15, 0, 19, 49, 23950 }, // ζ
+    { 16, 23, 18, 1, 16, 69, 23999 }, // η
+    { 15, 21, 17, 1, 20, 61, 24068 }, // θ
+    { 8, 18, 16, 4, 17, 29, 24129 }, // ι
+    { 14, 15, 18, 2, 15, 38, 24158 }, // κ
+    { 17, 22, 21, 2, 21, 59, 24196 }, // λ
+    { 16, 19, 21, 2, 15, 56, 24255 }, // μ
+    { 16, 16, 17, 0, 15, 40, 24311 }, // ν
+    { 12, 23, 14, 1, 19, 46, 24351 }, // ξ
+    { 15, 16, 22, 3, 15, 44, 24397 }, // ο
+    { 16, 15, 18, 1, 14, 47, 24441 }, // π
+    { 16, 21, 18, 1, 15, 57, 24488 }, // ρ
+    { 13, 19, 14, 0, 19, 42, 24545 }, // ς
+    { 17, 16, 24, 3, 15, 47, 24587 }, // σ
+    { 15, 15, 17, 1, 14, 33, 24634 }, // τ
+    { 13, 16, 15, 1, 15, 47, 24667 }, // υ
+    { 21, 33, 28, 4, 26, 120, 24714 }, // φ
+    { 20, 21, 21, 0, 15, 68, 24834 }, // χ
+    { 15, 28, 17, 1, 20, 85, 24902 }, // ψ
+    { 20, 15, 21, 0, 13, 58, 24987 }, // ω
+    { 22, 28, 24, 1, 21, 84, 25045 }, // Ạ
+    { 15, 26, 21, 3, 16, 62, 25129 }, // ạ
+    { 22, 30, 24, 1, 30, 88, 25191 }, // Ả
+    { 15, 25, 21, 3, 24, 60, 25279 }, // ả
+    { 22, 37, 24, 1, 37, 107, 25339 }, // Ấ
+    { 16, 28, 21, 3, 27, 72, 25446 }, // ấ
+    { 24, 32, 24, -1, 32, 103, 25518 }, // Ầ
+    { 22, 29, 21, -4, 28, 87, 25621 }, // ầ
+    { 22, 38, 24, 1, 38, 111, 25708 }, // Ẩ
+    { 17, 30, 21, 3, 29, 76, 25819 }, // ẩ
+    { 22, 36, 24, 1, 36, 110, 25895 }, // Ẫ
+    { 15, 30, 21, 3, 29, 81, 26005 }, // ẫ
+    { 22, 37, 24, 1, 30, 107, 26086 }, // Ậ
+    { 15, 34, 21, 3, 24, 79, 26193 }, // ậ
+    { 22, 38, 24, 1, 38, 106, 26272 }, // Ắ
+    { 15, 33, 21, 3, 32, 75, 26378 }, // ắ
+    { 22, 38, 24, 1, 38, 107, 26453 }, // Ằ
+    { 15, 33, 21, 3, 32, 76, 26560 }, // ằ
+    { 22, 39, 24, 1, 39, 110, 26636 }, // Ẳ
+    { 15, 35, 21, 3, 34, 80, 26746 }, // ẳ
+    { 22, 39, 24, 1, 39, 115, 26826 }, // Ẵ
+    { 15, 34, 21, 3, 33, 85, 26941 }, // ẵ
+    { 22, 37, 24, 1, 30, 105, 27026 }, // Ặ
+    { 15, 34, 21, 3, 24, 79, 27131 }, // ặ
+    { 15, 31, 23, 4, 21, 81, 27210 }, // Ẹ
+    { 15, 26, 21, 3, 15, 66, 27291 }, // ẹ
+    { 15, 31, 23, 4, 31, 79, 27357 }, // Ẻ
+    { 15, 28, 21, 3, 27, 66, 27436 }, // ẻ
+    { 15, 31, 23, 4, 31, 87, 27502 }, // Ẽ
+    { 15, 28, 21, 3, 27, 72, 27589 }, // ẽ
+    { 19, 31, 24, 4, 31, 91, 27661 }, // Ế
+    { 20, 28, 24, 3, 27, 79, 27752 }, // ế
+    { 21, 33, 23, -2, 33, 96, 27831 }, // Ề
+    { 19, 31, 21, -1, 30, 83, 27927 }, // ề
+    { 16, 34, 23, 4, 34, 93, 28010 }, // Ể
+    { 17, 33, 21, 3, 32, 84, 28103 }, // ể
+    { 15, 36, 23, 4, 36, 98, 28187 }, // Ễ
+    { 15, 34, 21, 3, 33, 86, 28285 }, // ễ
+    { 15, 41, 23, 4, 31, 97, 28371 }, // Ệ
+    { 15, 38, 21, 3, 27, 86, 28468 }, // ệ
+    { 6, 32, 14, 4, 32, 48, 28554 }, // Ỉ
+    { 6, 23, 12, 3, 23, 31, 28602 }, // ỉ
+    { 7, 32, 14, 3, 21, 51, 28633 }, // Ị
+    { 6, 34, 12, 3, 23, 44, 28684 }, // ị
+    { 21, 35, 28, 4, 22, 106, 28728 }, // Ọ
+    { 15, 26, 22, 3, 15, 62, 28834 }, // ọ
+    { 21, 33, 28, 4, 31, 104, 28896 }, // Ỏ
+    { 15, 25, 22, 3, 24, 58, 29000 }, // ỏ
+    { 22, 33, 28, 4, 31, 114, 29058 }, // Ố
+    { 19, 26, 23, 3, 25, 71, 29172 }, // ố
+    { 24, 35, 28, 1, 33, 120, 29243 }, // Ồ
+    { 20, 29, 22, -2, 28, 78, 29363 }, // ồ
+    { 21, 36, 28, 4, 34, 117, 29441 }, // Ổ
+    { 17, 30, 22, 3, 29, 76, 29558 }, // ổ
+    { 21, 38, 28, 4, 36, 125, 29634 }, // Ỗ
+    { 15, 30, 22, 3, 29, 79, 29759 }, // ỗ
+    { 21, 44, 28, 4, 31, 129, 29838 }, // Ộ
+    { 15, 35, 22, 3, 24, 79, 29967 }, // ộ
+    { 22, 33, 28, 4, 31, 112, 30046 }, // Ớ
+    { 17, 24, 22, 3, 23, 66, 30158 }, // ớ
+    { 22, 33, 28, 4, 31, 113, 30224 }, // Ờ
+    { 17, 25, 22, 3, 24, 69, 30337 }, // ờ
+    { 22, 33, 28, 4, 31, 112, 30406 }, // Ở
+    { 17, 25, 22, 3, 24, 67, 30518 }, // ở
+    { 22, 33, 28, 4, 31, 116, 30585 }, // Ỡ
+    { 17, 25, 22, 3, 24, 76, 30701 }, // ỡ
+    { 22, 38, 28, 4, 25, 120, 30777 }, // Ợ
+    { 17, 28, 22, 3, 17, 73, 30897 }, // ợ
+    { 18, 32, 26, 4, 21, 85, 30970 }, // Ụ
+    { 15, 28, 21, 3, 15, 66, 31055 }, // ụ
+    { 18, 33, 26, 4, 32, 86, 31121 }, // Ủ
+    { 15, 25, 21, 3, 24, 61, 31207 }, // ủ
+    { 21, 32, 26, 4, 31, 98, 31268 }, // Ứ
+    { 18, 25, 22, 3, 24, 66, 31366 }, // ứ
+    { 21, 32, 26, 4, 31, 99, 31432 }, // Ừ
+    { 18, 25, 22, 3, 24, 69, 31531 }, // ừ
+    { 21, 33, 26, 4, 32, 101, 31600 }, // Ử
+    { 18, 25, 22, 3, 24, 67, 31701 }, // ử
+    { 21, 33, 26, 4, 32, 105, 31768 }, // Ữ
+    { 18, 25, 22, 3, 24, 74, 31873 }, // ữ
+    { 21, 37, 26, 4, 26, 104, 31947 }, // Ự
+    { 18, 32, 22, 3, 19, 77, 32051 }, // ự
+    { 19, 32, 27, 4, 32, 78, 32128 }, // Ỳ
+    { 17, 32, 23, 3, 25, 69, 32206 }, // ỳ
+    { 19, 34, 27, 4, 21, 82, 32275 }, // Ỵ
+    { 19, 24, 23, 3, 14, 67, 32357 }, // ỵ
+    { 19, 33, 27, 4, 33, 79, 32424 }, // Ỷ
+    { 17, 34, 23, 3, 27, 73, 32503 }, // ỷ
+    { 19, 34, 27, 4, 34, 89, 32576 }, // Ỹ
+    { 17, 34, 23, 3, 27, 81, 32665 }, // ỹ
+    { 0, 0, 17, 0, 0, 0, 32746 }, //  
+    { 0, 0, 29, 0, 0, 0, 32746 }, //  
+    { 0, 0, 17, 0, 0, 0, 32746 }, //  
+    { 0, 0, 29, 0, 0, 0, 32746 }, //  
+    { 0, 0, 12, 0, 0, 0, 32746 }, //  
+    { 0, 0, 10, 0, 0, 0, 32746 }, //  
+    { 0, 0, 8, 0, 0, 0, 32746 }, //  
+    { 0, 0, 18, 0, 0, 0, 32746 }, //  
+    { 0, 0, 7, 0, 0, 0, 32746 }, //  
+    { 0, 0, 9, 0, 0, 0, 32746 }, //  
+    { 0, 0, 8, 0, 0, 0, 32746 }, //  
+    { 0, 0, 4, 0, 0, 0, 32746 }, // ​
+    { 0, 0, 1, 0, 0, 0, 32746 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 32746 }, // ‍
+    { 0, 0, 1, 0, 0, 0, 32746 }, // ‎
+    { 0, 0, 1, 0, 0, 0, 32746 }, // ‏
+    { 14, 3, 15, 0, 9, 8, 32746 }, // ‐
+    { 14, 3, 15, 0, 9, 8, 32754 }, // ‑
+    { 20, 3, 18, -3, 9, 11, 32762 }, // ‒
+    { 18, 5, 20, 1, 10, 20, 32773 }, // –
+    { 26, 5, 29, 1, 10, 27, 32793 }, // —
+    { 26, 5, 29, 1, 10, 27, 32820 }, // ―
+    { 13, 23, 16, 2, 18, 79, 32847 }, // ‖
+    { 21, 8, 18, -4, -2, 21, 32926 }, // ‗
+    { 9, 9, 11, 1, 22, 19, 32947 }, // ‘
+    { 9, 9, 11, 1, 22, 18, 32966 }, // ’
+    { 8, 9, 9, 0, 4, 19, 32984 }, // ‚
+    { 9, 9, 11, 1, 22, 19, 33003 }, // ‛
+    { 17, 9, 19, 1, 22, 36, 33022 }, // “
+    { 17, 9, 19, 1, 22, 36, 33058 }, // ”
+    { 8, 9, 9, 0, 4, 19, 33094 }, // „
+    { 17, 9, 19, 1, 22, 36, 33113 }, // ‟
+    { 16, 35, 20, 2, 26, 76, 33149 }, // †
+    { 15, 35, 22, 4, 26, 77, 33225 }, // ‡
+    { 20, 19, 17, -4, 22, 61, 33302 }, // •
+    { 9, 9, 15, 3, 11, 14, 33363 }, // ‣
+    { 7, 6, 15, 4, 6, 11, 33377 }, // ․
+    { 7, 6, 15, 4, 6, 11, 33388 }, // ‥
+    { 24, 6, 25, 0, 6, 32, 33399 }, // …
+    { 4, 3, 14, 5, 9, 5, 33431 }, // ‧
+    { 0, 0, 28, 0, 0, 0, 33436 }, //  
+    { 19, 22, 28, 5, 20, 79, 33436 }, // ‰
+    { 9, 9, 14, 4, 22, 17, 33515 }, // ′
+    { 17, 9, 22, 4, 22, 36, 33532 }, // ″
+    { 20, 8, 22, 1, 21, 31, 33568 }, // ‴
+    { 7, 8, 10, 2, 21, 10, 33599 }, // ‵
+    { 12, 8, 13, 0, 21, 20, 33609 }, // ‶
+    { 20, 8, 16, -5, 21, 31, 33629 }, // ‷
+    { 14, 6, 16, 1, 21, 17, 33660 }, // ‸
+    { 8, 14, 10, 1, 14, 20, 33677 }, // ‹
+    { 8, 14, 10, 1, 14, 22, 33697 }, // ›
+    { 28, 32, 34, 4, 25, 133, 33719 }, // ※
+    { 8, 32, 15, 3, 28, 49, 33852 }, // ‼
+    { 16, 40, 22, 2, 34, 94, 33901 }, // ‽
+    { 14, 3, 15, 0, 21, 8, 33995 }, // ‾
+    { 13, 5, 14, 0, 17, 16, 34003 }, // ‿
+    { 18, 17, 18, -1, 23, 65, 34019 }, // ⁂
+    { 17, 22, 31, 7, 20, 45, 34084 }, // ⁄
+    { 31, 31, 38, 3, 28, 135, 34129 }, // ⁇
+    { 26, 32, 30, 2, 28, 118, 34264 }, // ⁈
+    { 21, 32, 21, -1, 28, 103, 34382 }, // ⁉
+    { 19, 44, 23, 2, 30, 102, 34485 }, // ⁒
+    { 0, 0, 117, 0, 0, 0, 34587 }, //  
+    { 8, 10, 9, 0, 21, 28, 34587 }, // ⁰
+    { 8, 9, 9, 0, 21, 20, 34615 }, // ⁴
+    { 7, 11, 9, 1, 22, 24, 34635 }, // ⁵
+    { 7, 10, 9, 1, 21, 25, 34659 }, // ⁶
+    { 7, 11, 9, 1, 22, 18, 34684 }, // ⁷
+    { 9, 11, 10, 0, 21, 25, 34702 }, // ⁸
+    { 8, 11, 9, 0, 21, 23, 34727 }, // ⁹
+    { 15, 16, 22, 3, 16, 49, 34750 }, // ⁿ
+    { 7, 10, 9, 1, 6, 25, 34799 }, // ₀
+    { 7, 11, 9, 1, 6, 13, 34824 }, // ₁
+    { 7, 11, 9, 1, 6, 21, 34837 }, // ₂
+    { 7, 10, 9, 1, 6, 21, 34858 }, // ₃
+    { 8, 10, 10, 1, 6, 20, 34879 }, // ₄
+    { 7, 10, 9, 1, 6, 21, 34899 }, // ₅
+    { 7, 10, 9, 1, 6, 23, 34920 }, // ₆
+    { 7, 11, 9, 1, 6, 18, 34943 }, // ₇
+    { 9, 11, 10, 0, 6, 27, 34961 }, // ₈
+    { 8, 11, 10, 1, 6, 22, 34988 }, // ₉
+    { 11, 35, 13, 1, 26, 54, 35010 }, // ₍
+    { 11, 35, 11, -1, 26, 52, 35064 }, // ₎
+    { 18, 33, 25, 3, 28, 117, 35116 }, // ₡
+    { 18, 23, 25, 3, 23, 72, 35233 }, // ₢
+    { 17, 23, 18, 0, 22, 65, 35305 }, // ₤
+    { 27, 21, 27, -1, 21, 93, 35370 }, // ₦
+    { 22, 22, 23, 0, 22, 63, 35463 }, // ₧
+    { 27, 23, 33, 3, 21, 110, 35526 }, // ₨
+    { 21, 22, 22, 0, 22, 82, 35636 }, // ₩
+    { 20, 19, 27, 3, 19, 87, 35718 }, // ₪
+    { 19, 22, 18, -2, 21, 68, 35805 }, // ₫
+    { 18, 24, 19, 0, 20, 60, 35873 }, // €
+    { 19, 22, 26, 4, 22, 70, 35933 }, // ₮
+    { 25, 22, 25, -1, 22, 68, 36003 }, // ₱
+    { 21, 33, 29, 4, 28, 108, 36071 }, // ₲
+    { 25, 21, 31, 5, 19, 71, 36179 }, // ₴
+    { 13, 20, 17, 3, 18, 47, 36250 }, // ₵
+    { 20, 23, 26, 3, 23, 67, 36297 }, // ₸
+    { 13, 21, 17, 2, 20, 44, 36364 }, // ₹
+    { 15, 19, 17, 1, 17, 56, 36408 }, // ₺
+    { 18, 21, 20, 1, 20, 74, 36464 }, // ₼
+    { 21, 22, 23, -2, 22, 62, 36538 }, // ₽
+    { 17, 18, 18, 0, 15, 43, 36600 }, // ←
+    { 19, 18, 20, 0, 17, 48, 36643 }, // ↑
+    { 17, 18, 19, 1, 15, 43, 36691 }, // →
+    { 19, 17, 20, 0, 16, 48, 36734 }, // ↓
+    { 21, 15, 26, 2, 14, 52, 36782 }, // ↔
+    { 16, 20, 20, 2, 22, 56, 36834 }, // ↕
+    { 15, 14, 20, 2, 13, 42, 36890 }, // ↖
+    { 14, 14, 16, 1, 13, 38, 36932 }, // ↗
+    { 14, 14, 16, 1, 14, 33, 36970 }, // ↘
+    { 14, 14, 16, 1, 14, 33, 37003 }, // ↙
+    { 20, 18, 24, 2, 16, 54, 37036 }, // ⇐
+    { 22, 20, 27, 2, 19, 78, 37090 }, // ⇑
+    { 20, 18, 24, 2, 16, 51, 37168 }, // ⇒
+    { 22, 20, 27, 2, 18, 78, 37219 }, // ⇓
+    { 23, 18, 27, 2, 16, 65, 37297 }, // ⇔
+    { 18, 22, 22, 2, 13, 77, 37362 }, // ⇕
+    { 15, 22, 17, 1, 21, 59, 37439 }, // ∂
+    { 26, 26, 28, 1, 23, 104, 37498 }, // ∅
+    { 20, 20, 22, 1, 19, 64, 37602 }, // ∆
+    { 17, 20, 19, 1, 19, 61, 37666 }, // ∏
+    { 17, 19, 19, 1, 18, 58, 37727 }, // ∐
+    { 13, 20, 15, 1, 19, 40, 37785 }, // ∑
+    { 15, 4, 16, 0, 9, 15, 37825 }, // −
+    { 22, 23, 24, 1, 21, 61, 37840 }, // √
+    { 21, 14, 23, 1, 16, 62, 37901 }, // ∞
+    { 20, 27, 22, 1, 20, 63, 37963 }, // ∫
+    { 7, 17, 9, 1, 17, 24, 38026 }, // ∶
+    { 15, 14, 36, 10, 14, 46, 38050 }, // ≈
+    { 19, 22, 31, 6, 20, 58, 38096 }, // ≠
+    { 21, 21, 21, -1, 18, 70, 38154 }, // ≤
+    { 22, 22, 23, 0, 19, 73, 38224 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_12_boldIntervals[] = {
@@ -4478,4 +3138,5 @@ static const EpdFontData opendyslexic_12_bold = {
     33,
     -13,
     true,
+    true,
 };
@@ -2,5268 +2,3268 @@
  * generated by fontconvert.py
  * name: opendyslexic_12_bolditalic
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_12_bolditalic 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py opendyslexic_12_bolditalic 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_bolditalicBitmaps[73453] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x7F, 0xF8, 0x3F, 0xFC, 0x0F, 0xFD, 0x0F, 0xFE, 0x03, 0xFF, 0x42, 0xFF, 0x80, 0xBF, 0xD0, 0x7F,
-    0xE0, 0x1F, 0xF8, 0x0F, 0xF8, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xD0, 0x2F, 0xF8,
-    0x2F, 0xF8, 0x06, 0xA9, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x55, 0xBF,
-    0xD5, 0xFF, 0x95, 0x54, 0x00, 0x00, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x55, 0x7F, 0xF5, 0xBF, 0xE5,
-    0x55, 0x00, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x42, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xA8, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xD3, 0xF9, 0x00, 0x00, 0x2F,
-    0xF4, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x7F, 0x00, 0x00, 0x03, 0xFD, 0x02, 0xF8, 0x00, 0x00,
-    0x1F, 0xFE, 0x4F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x28, 0x00, 0x1F, 0xFF, 0xF0, 0x02, 0xFF, 0x40,
-    0xBF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x01, 0xFF,
-    0xF0, 0x00, 0xFD, 0x00, 0x0F, 0x43, 0xD0, 0x0B, 0xE0, 0x00, 0xB8, 0x0F, 0x40, 0xBF, 0x00, 0x03,
-    0xC0, 0x3C, 0x07, 0xF0, 0x00, 0x0F, 0x42, 0xF0, 0x7F, 0x00, 0x00, 0x3F, 0xFF, 0x47, 0xF4, 0x00,
-    0x00, 0xBF, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0xBE, 0x43, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC6,
-    0xF8, 0x00, 0x00, 0x02, 0xFC, 0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xC7, 0xC0, 0xF0, 0x00, 0x02, 0xFD,
-    0x3D, 0x03, 0xC0, 0x00, 0x1F, 0xD0, 0xF0, 0x1F, 0x00, 0x01, 0xFE, 0x07, 0xC1, 0xF8, 0x00, 0x0F,
-    0xF0, 0x1F, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0x80, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x07, 0xF4, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x0B, 0xC0,
-    0x03, 0xF0, 0x00, 0x2F, 0x40, 0x3F, 0x80, 0x00, 0x3F, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0xA4, 0x1F,
-    0xF5, 0xFD, 0x03, 0xF4, 0xFF, 0x41, 0xFD, 0x2F, 0xC7, 0xFC, 0x02, 0xFE, 0xFE, 0x1F, 0xF0, 0x02,
-    0xFF, 0xF0, 0xBF, 0xF5, 0x6F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x07, 0xFF, 0xFF, 0xD7, 0x40, 0x02, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0xA4, 0x3F, 0xF8, 0x3F, 0xF4, 0x3F, 0xF4, 0x2F, 0xF4, 0x1F, 0xFC, 0x0F, 0xFC, 0x0F, 0xFD, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1B,
-    0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x20, 0x7F, 0x0B, 0x43,
-    0xF5, 0xF9, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xE1, 0xFE, 0xFD, 0xFE, 0x03, 0xD3, 0xF0, 0xA0, 0x04, 0x1F, 0xC0,
-    0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x02,
-    0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xFF,
-    0xD0, 0x0B, 0xFE, 0x00, 0x2A, 0xA0, 0x00, 0x3F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x01, 0x54, 0x1F, 0xE0, 0xFF, 0x47, 0xFD, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x03, 0xFD, 0x0B, 0xE0, 0x00, 0x2F, 0xC0, 0x0F, 0xC0, 0x01, 0xFD, 0x00,
-    0x3F, 0x00, 0x0F, 0xF1, 0xD0, 0xFC, 0x00, 0x7F, 0x9F, 0xC7, 0xF0, 0x02, 0xFC, 0xBF, 0x2F, 0xC0,
-    0x0F, 0xF3, 0xFC, 0xFF, 0x00, 0x7F, 0x8F, 0xE7, 0xF8, 0x02, 0xFD, 0x3F, 0x2F, 0xD0, 0x0F, 0xF4,
-    0x61, 0xFF, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x7F, 0xF8,
-    0x00, 0x1F, 0xFF, 0x40, 0x02, 0xFF, 0xF0, 0x00, 0x3D, 0xFE, 0x00, 0x05, 0x1F, 0xD0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7F,
-    0x40, 0xBF, 0x80, 0x0A, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x03, 0x90, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x01, 0x55, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0x40, 0x1F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0xFB, 0xF4, 0x00, 0x07, 0xE7, 0xF0, 0x00, 0x1F, 0x8B, 0xF0,
-    0x00, 0x7F, 0x0F, 0xF0, 0x01, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0x2F, 0xD0, 0x1F, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x15, 0x5A, 0xFF, 0xE4, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0A,
-    0x95, 0x6F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x40, 0x00, 0xFF, 0x80,
-    0x3D, 0x01, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x50, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x1F, 0xE4, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xF9, 0x00, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xD7, 0xFE, 0x00, 0xBF, 0xD0, 0x0F, 0xF0,
-    0x0F, 0xF8, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0xFF, 0x00,
-    0xBF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-    0x0B, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFE, 0x2F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x01, 0x7F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x0B, 0xFE, 0xBF, 0xC0, 0x01, 0xFE, 0x00,
-    0xFD, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x07, 0xF4, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x7F, 0xC0, 0x07,
-    0xFD, 0x6F, 0xF4, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xE0, 0x2F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x2F, 0xE0,
-    0x02, 0xFE, 0x02, 0xFF, 0x96, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x0A, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2B, 0xE4, 0x00, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x0B, 0xF0, 0x03,
-    0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xD0, 0x07, 0xFE, 0x00, 0x3F, 0xFB, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x01, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xFE, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0A, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x0B, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFC,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xAA, 0xA0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x0B,
-    0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x6F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x6A,
-    0x90, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFE, 0xAA, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x01, 0xBF, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x90, 0x7F, 0x80, 0x0B, 0x80,
-    0x02, 0xFC, 0x00, 0x10, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x6F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x3F, 0x0B, 0xEE, 0x00, 0x3C, 0x00, 0x0F, 0xE2, 0xFF, 0xE0, 0x03, 0xC0, 0x01, 0xFC,
-    0x78, 0x3D, 0x00, 0x7C, 0x00, 0x3F, 0x4F, 0x02, 0xC0, 0x0B, 0x80, 0x07, 0xF0, 0xD0, 0x3C, 0x00,
-    0xF4, 0x00, 0xBF, 0x1C, 0x03, 0xC0, 0x2F, 0x00, 0x0B, 0xF2, 0xEA, 0xFC, 0x0B, 0xD0, 0x00, 0xFF,
-    0x1F, 0xFF, 0x87, 0xF8, 0x00, 0x0F, 0xF0, 0xBF, 0xBF, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF,
-    0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x68, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0,
-    0x00, 0x00, 0x07, 0xF6, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD1, 0xFE,
-    0x00, 0x00, 0x07, 0xF8, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x1F,
-    0xF0, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x5F, 0xF0, 0x00, 0x2F, 0xE0, 0x01, 0xFD, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x01, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0xAA,
-    0xFF, 0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x01,
-    0xFF, 0x40, 0x2F, 0xF5, 0x5B, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFF, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE5, 0x5B, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xF0, 0x56, 0xFF, 0xF0, 0x00,
-    0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x0B,
-    0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x01, 0xFF, 0x00,
-    0x00, 0x0F, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x03,
-    0xFD, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFD, 0x01, 0x6F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00,
-    0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xFF, 0xFF, 0xAA, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xAA, 0x54, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x55, 0x54, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xD4, 0x01, 0x64, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xA5, 0x00,
-    0x01, 0xFF, 0x80, 0x07, 0xFF, 0xFD, 0x0B, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x3F, 0xF0, 0x00, 0x7F,
-    0xFF, 0xE0, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x43, 0xFF, 0x80, 0x00, 0x2F, 0xD0, 0x0F, 0xFF, 0xD4,
-    0x16, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFC, 0x00,
-    0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x1F,
-    0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0,
-    0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0x00,
-    0xBF, 0xD0, 0x01, 0xFF, 0xD5, 0x55, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x07,
-    0xE8, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00,
-    0xBF, 0x40, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD,
-    0x00, 0x07, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF8, 0x00,
-    0x2B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0x91, 0xBF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x6B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0xBF, 0xE0, 0x00, 0x02, 0xFD, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xF0,
-    0x00, 0x00, 0x7F, 0x83, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF3, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0x6F, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xF1, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0xFC, 0x00, 0x0B, 0xFD, 0x07, 0xFF,
-    0xF8, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xFF,
-    0x43, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0xBF, 0xFC, 0x00, 0x0F, 0xFF,
-    0xC0, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x3F, 0xFF, 0x40, 0x02, 0xFF, 0xFD, 0x02, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0x02,
-    0xFE, 0xFF, 0xCB, 0xFF, 0xFD, 0x00, 0x0F, 0xF7, 0xFF, 0x7F, 0xDF, 0xF4, 0x00, 0x3F, 0xCF, 0xFF,
-    0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xFF, 0x5F, 0xF8,
-    0x00, 0x3F, 0xE2, 0xFF, 0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0x4B, 0xFF, 0xD3, 0xFF, 0x00, 0x0F, 0xFC,
-    0x1F, 0xFF, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x7F, 0xF0, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0xFF, 0x83,
-    0xFF, 0x40, 0x0B, 0xFE, 0x03, 0xFC, 0x2F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xF8,
-    0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFC, 0x00,
-    0x02, 0xFF, 0xF4, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-    0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xFB, 0xFC, 0x0F, 0xF4, 0x00, 0x07,
-    0xFD, 0xBF, 0x47, 0xFC, 0x00, 0x03, 0xFF, 0x2F, 0xE2, 0xFE, 0x00, 0x00, 0xFF, 0xC7, 0xFC, 0xFF,
-    0x40, 0x00, 0x7F, 0xF1, 0xFF, 0x7F, 0xC0, 0x00, 0x3F, 0xF8, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFD,
-    0x0F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0xBF, 0xFE, 0x00,
-    0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x40, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xA6, 0xFF, 0xD0, 0x00, 0x0F, 0xFE,
-    0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xD0,
-    0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0B,
-    0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0x90, 0x5B, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x07, 0xF4, 0x01, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00,
-    0x7F, 0x80, 0x0F, 0xF4, 0x00, 0x3F, 0xE5, 0xAF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
-    0xFF, 0xE4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0x07, 0xFF,
-    0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x02,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x04, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x0B, 0xD2,
-    0xFF, 0x00, 0x0F, 0xFE, 0x57, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x0B, 0xF0, 0x01, 0xFC,
-    0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x00,
-    0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xD0, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0xFF, 0x40, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0xFF, 0x80, 0x0F, 0xFD, 0x02, 0xFF,
-    0x80, 0x1F, 0xFD, 0x03, 0xFF, 0xC0, 0x2F, 0xFC, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xEB, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0xFF,
-    0xE4, 0x1F, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8,
-    0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00,
-    0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00,
-    0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07,
-    0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8,
-    0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x7F,
-    0xD1, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x1F, 0xF4,
-    0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00,
-    0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x40, 0x00, 0xFF, 0xD2, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF9, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xF4, 0x00,
-    0x69, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x1F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xF4, 0x07, 0xFF,
-    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0xFF, 0xF0, 0x1F, 0xF8, 0x00, 0x3F, 0xF4, 0x3F, 0xFF, 0x43,
-    0xFF, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0xF8, 0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0xFF, 0x8F, 0xFC,
-    0x00, 0x03, 0xFF, 0x7F, 0xFF, 0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFE, 0xFF, 0xFF, 0xF0, 0x00,
-    0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0xBF, 0xFF, 0x00, 0x00, 0x0B, 0xFF,
-    0xF4, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF8, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xF0, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC,
-    0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xC0, 0x1F, 0xFF, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xC0,
-    0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00,
-    0xFF, 0x80, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xF4,
-    0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x55, 0x40, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x16,
-    0x95, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0xD0, 0x2D, 0x03, 0xE0, 0x7E, 0x07, 0xF0,
-    0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x43, 0xF4, 0x3F, 0x43, 0xF8, 0x3F, 0x83, 0xFC, 0x3F,
-    0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xD3, 0xFC, 0x3F, 0x43, 0xE0, 0x3C, 0x03, 0x40, 0x10, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x55, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0x82,
-    0xFC, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x6A, 0xAA, 0xAA, 0xAA, 0x90, 0x15, 0x00,
-    0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFE, 0x07,
-    0xFD, 0x03, 0xF8, 0x02, 0xFC, 0x07, 0xF0, 0x02, 0xFC, 0x0B, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x02,
-    0xF8, 0x1F, 0x40, 0x03, 0xF8, 0x2F, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x0F, 0xF0, 0x3F, 0xEA, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x15,
-    0x00, 0x03, 0xFB, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0x41,
-    0xF8, 0x0F, 0xFC, 0x00, 0xFC, 0x0F, 0xF4, 0x00, 0xFC, 0x0F, 0xF0, 0x00, 0xFC, 0x1F, 0xE0, 0x02,
-    0xF8, 0x2F, 0xD0, 0x07, 0xF4, 0x2F, 0xF5, 0x7F, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFD, 0x00, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0x90, 0x50, 0x3F,
-    0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x02, 0xFE, 0x01, 0x00, 0x1F, 0xFA, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xEB, 0xFF, 0xF0, 0x00, 0x3F, 0xD0, 0x3F, 0xF8, 0x00, 0x1F,
-    0xD0, 0x0B, 0xFC, 0x00, 0x0B, 0xE0, 0x02, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0xFF, 0x80, 0x01, 0xFC,
-    0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xC0, 0x1F, 0xFC, 0x00, 0x07, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x03, 0xFC, 0x01, 0xF4, 0x02, 0xFC, 0x05, 0xBE, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFE, 0xA5, 0x50, 0x0B,
-    0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x07, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0xF5, 0xB0, 0x0B, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xD0,
-    0x0A, 0xFF, 0xA8, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0xFD, 0x00,
-    0x01, 0xFF, 0xFE, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xE0, 0xBF, 0xF8, 0x00, 0x3F,
-    0x40, 0x3F, 0xF4, 0x00, 0x7E, 0x00, 0x3F, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0xE0, 0x00, 0xF8, 0x00,
-    0x3F, 0xD0, 0x01, 0xF4, 0x00, 0x7F, 0xC0, 0x01, 0xF4, 0x00, 0xFF, 0xC0, 0x02, 0xF8, 0x07, 0xFF,
-    0x80, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x0A, 0x40, 0x7F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xFD, 0x00, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x42, 0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xC0, 0x0F,
-    0xF0, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xF8, 0x03, 0xFC, 0x00, 0x3F,
-    0x40, 0x7F, 0xC0, 0x07, 0xF0, 0x0B, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x1F, 0xF4,
-    0x02, 0xFE, 0x02, 0xFF, 0x40, 0x3F, 0xD0, 0x3F, 0xF0, 0x07, 0xFD, 0x00, 0x6B, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00,
-    0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x3F, 0x87, 0xF8, 0x00, 0x7F, 0x2F, 0xE0, 0x00, 0xBF, 0xBF, 0x80, 0x00, 0xFF, 0xFD, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0x00, 0x0F, 0xF7, 0xFF, 0x80, 0x1F, 0xF3, 0xFF, 0xE0, 0x2F, 0xE1, 0xFF, 0xF4, 0x3F,
-    0xD0, 0xBF, 0xFD, 0x00, 0x01, 0xE8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xF0, 0x00,
-    0x0F, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00,
-    0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE5, 0x00, 0x1F, 0xFF, 0x40, 0x2F,
-    0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xF4,
-    0x0B, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x3F, 0xF8, 0x2F, 0xFE, 0x0F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x1F, 0xC0, 0x0B, 0xFC,
-    0x01, 0xFF, 0x00, 0xBF, 0x00, 0x3F, 0xD0, 0x0B, 0xF8, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0x3F, 0xC0,
-    0x1F, 0xE0, 0x0B, 0xF8, 0x01, 0xFE, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x0F, 0xF4, 0x03, 0xFC, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x03, 0xFD, 0x02, 0xFF, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xF4, 0x7F, 0x80, 0x0B, 0xF8, 0x01, 0xF8, 0x00, 0xFF, 0x00, 0x2F,
-    0x80, 0x1F, 0xD0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x0B, 0xF0, 0x07, 0xF8,
-    0x00, 0xFF, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x0F, 0xF4, 0x02, 0xFE, 0x01, 0xFF, 0x00, 0x3F, 0xD0,
-    0x2F, 0xF0, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x03, 0xFF,
-    0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xFE, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0xBF, 0x00, 0xFE,
-    0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x03, 0xFC, 0x0F, 0xE0, 0x01, 0xFE, 0x07,
-    0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F,
-    0xFF, 0xD6, 0xF4, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0xBC, 0x00, 0x02,
-    0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x1F, 0x40, 0x00,
-    0x7F, 0xD0, 0x03, 0xF0, 0x00, 0x0F, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
-    0x0F, 0xF4, 0x6A, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xE0, 0xFD, 0x00, 0x1F, 0xFF, 0xEF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFD,
-    0x07, 0xFF, 0x40, 0x3F, 0x40, 0x3F, 0xF0, 0x07, 0xE0, 0x02, 0xFE, 0x00, 0xBC, 0x00, 0x3F, 0xD0,
-    0x0F, 0x80, 0x03, 0xFC, 0x01, 0xF4, 0x00, 0x7F, 0x80, 0x2F, 0x40, 0x0F, 0xF4, 0x02, 0xF8, 0x07,
-    0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xBE, 0x6F, 0xAF, 0x40, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0x7F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xA9, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0A, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0x95, 0xB4,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFC,
-    0x03, 0xD0, 0x1F, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x40,
-    0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xF0, 0x00, 0xBF, 0x0B, 0xE0, 0x00,
-    0xFE, 0x0F, 0xD0, 0x01, 0xFD, 0x0F, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x03, 0xFC, 0x1F, 0xC0, 0x03,
-    0xF8, 0x2F, 0xC0, 0x0B, 0xF8, 0x2F, 0x80, 0x0F, 0xF4, 0x3F, 0x40, 0x1F, 0xF0, 0x3F, 0x40, 0x3F,
-    0xF0, 0x3F, 0xD0, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x06, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xFC, 0x00,
-    0x07, 0xF8, 0x3F, 0xC0, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x1F, 0xE0, 0x07, 0xF8, 0x01,
-    0xFF, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xFF, 0x4B, 0xF8, 0x00, 0x0F, 0xF9, 0xFF,
-    0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x7F, 0x9F, 0xE0, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x02, 0xF0,
-    0x0F, 0xF0, 0x7F, 0x81, 0xFD, 0x0B, 0xF4, 0x1F, 0xE1, 0xFF, 0x87, 0xFC, 0x07, 0xF8, 0xFF, 0xF3,
-    0xFD, 0x01, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFB, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0xFF, 0xF0,
-    0x00, 0x1F, 0xFC, 0x2F, 0xF8, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0xFF,
-    0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x0B, 0xFD, 0x00,
-    0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
-    0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x80, 0x2F, 0xC0,
-    0x00, 0x1F, 0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x87, 0xF4, 0x00,
-    0x00, 0x2F, 0xF3, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x05,
-    0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xFA, 0xA8, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xD0, 0x00,
-    0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00,
-    0x2F, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0xF0, 0xBF, 0xC7, 0xC3, 0xEF,
-    0xFE, 0x2F, 0x1F, 0xF0, 0x7C, 0x2F, 0x40, 0x00, 0x1F, 0xFF, 0x00, 0x0B, 0xFF, 0xC0, 0x02, 0xFF,
-    0xD0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x1B, 0xFD, 0x00, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x50, 0x3F,
-    0xCF, 0x40, 0x07, 0xF4, 0xF0, 0x00, 0xFF, 0x0F, 0x00, 0x0F, 0xE1, 0xE0, 0x01, 0xFD, 0x2E, 0x00,
-    0x1F, 0xD3, 0xD0, 0x02, 0xFE, 0x3D, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x1F, 0xC0,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x6A, 0xFF, 0xAA, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x94, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x0A, 0xAA, 0xAA, 0xAA, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x02, 0x00, 0x0B, 0xFF, 0xD7, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xD2, 0xFD, 0x00, 0x2F, 0xD0, 0x3F, 0x40, 0x0F,
-    0xF0, 0x1F, 0xD0, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x01,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xC0, 0x42, 0xF0, 0x00, 0x40, 0x00, 0x10,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x0B,
-    0xFC, 0x00, 0x02, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x3D, 0x00,
-    0x07, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x3F, 0x00, 0x03, 0xD0, 0x00,
-    0x7C, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xD0, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x90, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x46, 0xFF,
-    0x00, 0x0B, 0xE0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0xFF, 0xAA, 0xBF, 0x80, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7D, 0x01, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x54, 0x05, 0x50, 0x7F, 0x82,
-    0xFD, 0x0F, 0xF8, 0x3F, 0xD1, 0xFF, 0x47, 0xFC, 0x2F, 0xF4, 0xFF, 0xC3, 0xFF, 0x1F, 0xFC, 0x00,
-    0x2F, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x7E, 0x47, 0xD0, 0x3F, 0xF8, 0x7C, 0x2F, 0xD0, 0x1F, 0x0F,
-    0xF0, 0x07, 0x83, 0xFC, 0x03, 0xD0, 0xF7, 0xF2, 0xF0, 0x2F, 0x47, 0xF0, 0x03, 0xFF, 0xF4, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xAC, 0x03, 0xEF, 0xC0, 0xB0, 0x78, 0x0D, 0x07, 0x41,
-    0xC0, 0x74, 0x2D, 0x6F, 0x01, 0xFF, 0xF0, 0x0B, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x1C, 0x00, 0x03, 0xD0, 0x0B, 0x80, 0x01, 0xFC, 0x07, 0xF4, 0x00, 0xFF, 0x42, 0xFE,
-    0x00, 0x7F, 0x80, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x03, 0xFC, 0x0F, 0xF4, 0x00, 0x3F, 0xF0,
-    0xBF, 0xC0, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x2F, 0x40, 0x7F, 0x00,
-    0x00, 0xF0, 0x02, 0xD0, 0x00, 0x01, 0x00, 0x08, 0x00, 0x09, 0x50, 0x00, 0x01, 0xFF, 0xFF, 0xF9,
-    0x2F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFD, 0x00, 0x15, 0x7F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x2F, 0xFF, 0x80, 0x2F,
-    0xF9, 0xF4, 0x1F, 0xC3, 0x1E, 0x0F, 0xB2, 0x4B, 0x83, 0xEF, 0xC3, 0xE0, 0xFE, 0x72, 0xF0, 0x3F,
-    0x5F, 0xF4, 0x07, 0xFF, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xD9, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xF0, 0x0F, 0xF4, 0x3F, 0x41, 0xFC, 0x03, 0xF4, 0x1F, 0xC0, 0xBF, 0x02,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x1A, 0xAF, 0xFA, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0xBF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x03, 0xEB, 0x40, 0x00, 0xE0, 0x00, 0xF0, 0x01, 0xF4, 0x07,
-    0xF4, 0x03, 0xFF, 0x42, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x2F, 0xF4, 0x01, 0x03, 0x80, 0x00, 0x38,
-    0x00, 0xAF, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0x00, 0x96, 0xF0, 0x1F, 0xFD, 0x02, 0xFF, 0x40, 0x00,
-    0xFC, 0x02, 0xF4, 0x07, 0xE0, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0xBF,
-    0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x0F, 0xD0, 0x02, 0xFC, 0x00,
-    0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0x7F,
-    0x80, 0x0F, 0xF4, 0x00, 0xBF, 0x40, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xF0, 0x01, 0xFF, 0xD0,
-    0xBF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xC7, 0xFE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC7, 0xF0, 0x00,
-    0x2F, 0xFF, 0x2F, 0xC0, 0x02, 0xFF, 0xF4, 0xFE, 0x00, 0x1F, 0xFF, 0xC3, 0xF4, 0x00, 0xFF, 0xFE,
-    0x1F, 0xC0, 0x03, 0xFF, 0xF4, 0x7F, 0x00, 0x0F, 0xFF, 0xC2, 0xF8, 0x00, 0x2F, 0xFE, 0x0F, 0xD0,
-    0x00, 0x3F, 0xF4, 0x3F, 0x00, 0x00, 0x7F, 0xC1, 0xFC, 0x00, 0x03, 0xFE, 0x0B, 0xE0, 0x00, 0x1F,
-    0xF4, 0x3F, 0x40, 0x00, 0xFF, 0xC0, 0xFC, 0x00, 0x03, 0xFE, 0x07, 0xF0, 0x00, 0x2F, 0xF4, 0x2F,
-    0x80, 0x00, 0xFF, 0xC0, 0xFD, 0x00, 0x0B, 0xFE, 0x03, 0xF0, 0x00, 0x3F, 0xF4, 0x1F, 0xC0, 0x02,
-    0xFF, 0xC0, 0xBE, 0x00, 0x0F, 0xFE, 0x03, 0xF4, 0x00, 0x7F, 0xF4, 0x0F, 0xC0, 0x01, 0x55, 0x40,
-    0x15, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC1, 0xFF, 0x0F, 0xFC, 0x7F, 0xF1, 0x55, 0x40, 0x02, 0xE0,
-    0x03, 0xC0, 0x0B, 0xE0, 0x0F, 0xF8, 0x14, 0xBC, 0x2F, 0xF8, 0x3F, 0xF0, 0x2A, 0x40, 0x01, 0xF0,
-    0x0F, 0xC0, 0x5E, 0x00, 0x74, 0x03, 0xC0, 0x0F, 0x00, 0x78, 0x1F, 0xFD, 0xBF, 0xF0, 0x02, 0xF8,
-    0x03, 0xEB, 0xC2, 0xE0, 0xF0, 0xF0, 0x3C, 0x78, 0x1E, 0x1F, 0xAF, 0x43, 0xFF, 0x80, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x09, 0x00, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x01, 0xFC, 0x03,
-    0xF4, 0x00, 0x0B, 0xF8, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x2F, 0xD0, 0x00, 0x2F, 0xC0, 0x7F, 0x40,
-    0x01, 0xFF, 0x03, 0xFC, 0x00, 0x3F, 0xE0, 0xFF, 0xC0, 0x0F, 0xFC, 0x2F, 0xF0, 0x01, 0xFF, 0x03,
-    0xFD, 0x00, 0x0F, 0xD0, 0x2F, 0x80, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xC0, 0x19, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xC0, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xC0, 0x00,
-    0x3F, 0xFF, 0xC0, 0x07, 0xF4, 0x1F, 0x03, 0xFF, 0xFC, 0x00, 0xFD, 0x07, 0xF0, 0x7F, 0xFF, 0x40,
-    0x3F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x7B, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x1E, 0x7C,
-    0x00, 0x00, 0x00, 0xFF, 0x07, 0xCB, 0xC0, 0x00, 0x00, 0x2F, 0xC1, 0xF0, 0xFD, 0x00, 0x00, 0x0B,
-    0xF4, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xFD, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xAA,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0x9F, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFC, 0x01, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xF0,
-    0xBF, 0xF0, 0x3F, 0xFF, 0xC0, 0x1F, 0xD1, 0xFF, 0xFC, 0x7F, 0xFF, 0x40, 0x3F, 0x43, 0x90, 0x7D,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xF0,
-    0x00, 0x01, 0xBC, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0xE0,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0xBF, 0x00,
-    0x00, 0xE5, 0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x07, 0xF4, 0x1F, 0x03, 0xFF, 0xFC,
-    0x00, 0xFD, 0x07, 0xF0, 0x2F, 0xFE, 0x00, 0x3F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x7B,
-    0xD0, 0x00, 0x00, 0x03, 0xFC, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x8B, 0xC0, 0x00, 0x00,
-    0x2F, 0xC1, 0xF1, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xFD, 0x0F, 0xFF,
-    0xFE, 0x00, 0x00, 0x7F, 0x80, 0x15, 0x7F, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x6F, 0xC0,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x10, 0x00, 0x7F, 0x00, 0x03, 0xC0, 0x00, 0xFE, 0x01, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFD,
-    0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x6F, 0xD0, 0x00, 0x00, 0x0F,
-    0xF1, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x0F,
-    0xF0, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x00, 0x0F,
-    0xFE, 0xAA, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xDB,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x00, 0x7F,
-    0x81, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x01,
-    0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF8, 0xBF, 0x40, 0x00,
-    0x00, 0x3F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xFB, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x6F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00,
-    0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00,
-    0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xFA, 0xAB, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xD1, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xCB, 0xC0, 0x00, 0x00, 0x07, 0xCF, 0xFD,
-    0x00, 0x00, 0x00, 0x3E, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x6F, 0xD0, 0x00,
-    0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x07, 0xF8,
-    0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0xFA, 0xAB, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F,
-    0xE0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x15, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0xD0, 0x00, 0x00, 0x03,
-    0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x4B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xDB, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x7F, 0x80,
-    0x00, 0x00, 0x07, 0xF8, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFE,
-    0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x00,
-    0x2E, 0x7C, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x6F, 0xD0, 0x00, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x1F, 0xE0, 0x00,
-    0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00,
-    0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAA, 0xAB, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC7, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x2F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0xFA, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xAB, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xA0, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFF, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x16, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xEA, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x80, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x02,
-    0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0xAA, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFA, 0xA8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAF, 0xE0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0x54, 0x05, 0x50, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x00, 0x07,
-    0xFC, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0xBF, 0xD0, 0x00, 0x03,
-    0xFF, 0x4F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x80, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xA0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x0A, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE8, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x2B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x02, 0xFD, 0x1F, 0xE0, 0x07, 0xF0, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE8,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2B, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x2F, 0xC0, 0x00, 0xFF,
-    0x43, 0xFC, 0x00, 0x1F, 0xF0, 0xBF, 0xC0, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xF1, 0xFF, 0x80,
-    0x05, 0x55, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFC, 0x15, 0xBF, 0xFC, 0x00, 0x03, 0xFE,
-    0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xF4,
-    0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFC, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0x83, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00,
-    0x3F, 0xD0, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xF0, 0x05, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xE9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xB4, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x3E, 0x00, 0x00,
-    0x00, 0x02, 0xFB, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F,
-    0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFF,
-    0xC0, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0xF4, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xFB, 0xFC,
-    0x0F, 0xF4, 0x00, 0x07, 0xFD, 0xBF, 0x47, 0xFC, 0x00, 0x03, 0xFF, 0x2F, 0xE2, 0xFE, 0x00, 0x00,
-    0xFF, 0xC7, 0xFC, 0xFF, 0x40, 0x00, 0x7F, 0xF1, 0xFF, 0x7F, 0xC0, 0x00, 0x3F, 0xF8, 0x3F, 0xFF,
-    0xE0, 0x00, 0x0F, 0xFD, 0x0F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0xC0, 0xBF, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x40, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x9B, 0xFF, 0x40, 0x00, 0x3F, 0xF8,
-    0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x2F,
-    0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xFE, 0x41, 0x6F, 0xFF, 0x40, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x9B, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x2F,
-    0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x3F,
-    0xD0, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0,
-    0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFE, 0x00, 0x3F, 0xFE, 0x41, 0x6F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xE2, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xA6, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00,
-    0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0x90, 0x5B, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x78, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x2E, 0x00,
-    0x00, 0x00, 0x02, 0xF3, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2E,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xA6, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x0B,
-    0xFE, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x0F,
-    0xF4, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0,
-    0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8,
-    0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00,
-    0x02, 0xFF, 0x80, 0x0F, 0xFF, 0x90, 0x5B, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x2F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xCB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xE9, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x00,
-    0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0xBF,
-    0xE0, 0x03, 0xFF, 0xE4, 0x16, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x3F, 0xEF, 0xF0,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xBF, 0xE0, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x16, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x0B,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xF7, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xFD, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x07, 0xFF, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xE0, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x8F, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x5B, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xD6, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00,
-    0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0xBF,
-    0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x40,
-    0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03,
-    0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0,
-    0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00,
-    0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF,
-    0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F,
-    0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0x83, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F,
-    0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0,
-    0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x01, 0xFF,
-    0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFD, 0x00,
-    0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x0F,
-    0xF4, 0x00, 0x00, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x2F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x05, 0x54, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00,
-    0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF,
-    0xC0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x1F, 0xF0,
-    0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x1F,
-    0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x0B, 0xFD,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xE0, 0x01, 0xFC, 0x0F, 0xF0, 0x02,
-    0xF4, 0x03, 0xF4, 0x03, 0xF0, 0x07, 0xF4, 0x03, 0xF0, 0x0F, 0xF0, 0x07, 0xE0, 0xBF, 0xD0, 0x0B,
-    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x1F, 0xE9, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0x41, 0xFC, 0x00, 0x2F, 0xC0, 0x0F, 0xC0, 0x03, 0xF8, 0x0B, 0xFC, 0x00, 0x7F,
-    0x03, 0xFF, 0xC0, 0x0B, 0xF0, 0xFF, 0xA0, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD2, 0xF4, 0x00,
-    0x02, 0xFC, 0x2F, 0x40, 0x00, 0x3F, 0xC2, 0xFE, 0x00, 0x03, 0xF8, 0x0F, 0xF8, 0x00, 0x7F, 0x40,
-    0x7F, 0xD0, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFD, 0x46, 0xFE, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFE,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0xFE, 0x07, 0xFD, 0x03, 0xF8, 0x02, 0xFC, 0x07, 0xF0, 0x02, 0xFC, 0x0B, 0xD0,
-    0x02, 0xFC, 0x0F, 0xC0, 0x02, 0xF8, 0x1F, 0x40, 0x03, 0xF8, 0x2F, 0x00, 0x03, 0xF4, 0x3F, 0x00,
-    0x0F, 0xF0, 0x3F, 0xEA, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xF8, 0x1F, 0xF4, 0x03, 0xF8, 0x02, 0xFC, 0x01, 0xFC,
-    0x00, 0xBF, 0x00, 0xBD, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x0B, 0xE0, 0x1F, 0x40, 0x03, 0xF8, 0x0B,
-    0xC0, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0xAB, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x1F, 0xD1, 0xFE, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFE, 0x07, 0xFD, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x2F, 0x40, 0x0B,
-    0xF0, 0x0F, 0xC0, 0x02, 0xF8, 0x07, 0xD0, 0x00, 0xFE, 0x02, 0xF0, 0x00, 0x3F, 0x40, 0xFC, 0x00,
-    0x3F, 0xC0, 0x3F, 0xEA, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x07, 0x80, 0x00, 0x3F, 0xF2,
-    0xE0, 0x00, 0x1F, 0xBF, 0xF4, 0x00, 0x0F, 0x87, 0xF8, 0x00, 0x01, 0x90, 0x64, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0x40, 0x0F, 0xE0, 0x7F, 0xD0, 0x0F, 0xE0, 0x0B, 0xF0, 0x07, 0xF0, 0x02, 0xFC, 0x02,
-    0xF4, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x7D, 0x00, 0x0F, 0xE0, 0x2F, 0x00, 0x03, 0xF4,
-    0x0F, 0xC0, 0x03, 0xFC, 0x03, 0xFE, 0xAF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x50, 0x00,
-    0x0B, 0xF8, 0x2F, 0xD0, 0x00, 0x3F, 0xD0, 0xFF, 0x00, 0x01, 0xFF, 0x4B, 0xFC, 0x00, 0x0F, 0xFC,
-    0x3F, 0xF0, 0x00, 0x7F, 0xF2, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x03, 0xF8, 0x1F, 0xF4, 0x00, 0x3F, 0x80, 0x2F,
-    0xC0, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x01,
-    0xF4, 0x00, 0x3F, 0x80, 0x0B, 0xC0, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xAB,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFE, 0x07, 0xFD, 0x03, 0xF8,
-    0x02, 0xFC, 0x07, 0xF0, 0x02, 0xFC, 0x0B, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x02, 0xF8, 0x1F, 0x40,
-    0x03, 0xF8, 0x2F, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x0F, 0xF0, 0x3F, 0xEA, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x01, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xEB, 0xFC, 0x00, 0xFE, 0x07, 0xFF, 0xF0, 0x0B, 0xC0, 0x3F,
-    0x80, 0x2F, 0xFC, 0x05, 0xBD, 0x07, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0xBD, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFD, 0x0F, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xD1, 0xF4, 0x00, 0x3F, 0xFA, 0xA5, 0x40, 0x2F,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x10, 0x3F, 0xEA, 0xFF, 0xFF,
-    0x90, 0x1F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x07, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFD, 0x00, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0x90, 0x50, 0x3F,
-    0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x02, 0xFE, 0x01, 0x00, 0x1F, 0xFA, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x04, 0x7C, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x3F, 0xC0, 0x1F, 0x40, 0x2F, 0xC0, 0x5B, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xEA, 0x55, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x7D, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x00, 0xFF,
-    0x00, 0x7D, 0x00, 0x2F, 0xC0, 0x5B, 0xE0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xEA, 0x55, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xF9, 0x01, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xE2, 0xFD, 0x00,
-    0x03, 0xF4, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0x7D, 0x00, 0x2F, 0xC0, 0x5B,
-    0xE0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF,
-    0xEA, 0x55, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x01, 0xF4,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x6F,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x54, 0x00, 0x00, 0xBF, 0x43, 0xFD, 0x00, 0x00, 0xFF,
-    0x43, 0xFC, 0x00, 0x01, 0xFF, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x7D, 0x00, 0x02, 0xFC, 0x05, 0xBE, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFE, 0xA5, 0x50, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x01, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBE, 0x00,
-    0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x40,
-    0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00,
-    0x07, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x0B, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xF1, 0xFE, 0x02, 0xFC, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x02, 0xF4,
-    0x2F, 0x41, 0xFD, 0x1F, 0xD0, 0xFF, 0x0F, 0xF0, 0x3F, 0xC7, 0xFC, 0x2F, 0xF2, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x10, 0x0F, 0xD0, 0x00,
-    0x00, 0x7F, 0xFC, 0x3F, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFD, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x3F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xEB,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x3C,
-    0x00, 0x00, 0x07, 0xFC, 0x3C, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0x0F, 0xF4, 0x00,
-    0x00, 0x1F, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x9B, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x7F, 0x80, 0x00, 0xBF, 0x80, 0x1F,
-    0x80, 0x00, 0xFF, 0x00, 0x2F, 0x80, 0x01, 0xFD, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x7F, 0x40,
-    0x03, 0xFC, 0x00, 0xBF, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x0F,
-    0xF4, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x2F, 0xF0, 0x07, 0xFD, 0x00, 0x3F, 0xF0,
-    0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0F, 0xF8,
-    0x1F, 0xF0, 0x0F, 0xF4, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0xFE,
-    0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x07, 0xF8, 0x1F, 0xD0, 0x03, 0xFC, 0x07, 0xFC, 0x07, 0xFF, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x0F, 0xF8, 0x1F, 0xF0, 0x0F, 0xF4, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0xBF, 0x02, 0xFC, 0x00,
-    0x2F, 0xC0, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x07, 0xF8, 0x1F, 0xD0, 0x03, 0xFC, 0x07, 0xFC,
-    0x07, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x3F, 0x87, 0xF8, 0x00, 0x3F, 0x80,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xFE, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0xBF, 0x00,
-    0xFE, 0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x03, 0xFC, 0x0F, 0xE0, 0x01, 0xFE,
-    0x07, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x78, 0x00, 0x00, 0xFF, 0xCB, 0xC0, 0x00, 0x1F, 0x3F, 0xF4,
-    0x00, 0x03, 0xF1, 0xFF, 0x00, 0x00, 0x19, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFD, 0x00,
-    0x0F, 0xF8, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x0B, 0xF0, 0x00,
-    0xBF, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x01, 0xFE, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x1F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x50, 0x00,
-    0x07, 0xF8, 0x2F, 0xD0, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x01, 0xFF, 0x4B, 0xFC, 0x00, 0x0F, 0xFC,
-    0x3F, 0xF0, 0x00, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x0F, 0xF4, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0B,
-    0xF0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x01,
-    0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x07, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x5F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x6F, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x7F, 0x80, 0x00, 0x00,
-    0x07, 0xFB, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x0B,
-    0xE0, 0x00, 0xFE, 0x0F, 0xD0, 0x01, 0xFD, 0x0F, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x03, 0xFC, 0x1F,
-    0xC0, 0x03, 0xF8, 0x2F, 0xC0, 0x0B, 0xF8, 0x2F, 0x80, 0x0F, 0xF4, 0x3F, 0x40, 0x1F, 0xF0, 0x3F,
-    0x40, 0x3F, 0xF0, 0x3F, 0xD0, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x0B,
-    0xE0, 0x00, 0xFE, 0x0F, 0xD0, 0x01, 0xFD, 0x0F, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x03, 0xFC, 0x1F,
-    0xC0, 0x03, 0xF8, 0x2F, 0xC0, 0x0B, 0xF8, 0x2F, 0x80, 0x0F, 0xF4, 0x3F, 0x40, 0x1F, 0xF0, 0x3F,
-    0x40, 0x3F, 0xF0, 0x3F, 0xD0, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0xFE, 0x2F, 0xD0, 0x03,
-    0xF8, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x0B,
-    0xE0, 0x00, 0xFE, 0x0F, 0xD0, 0x01, 0xFD, 0x0F, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x03, 0xFC, 0x1F,
-    0xC0, 0x03, 0xF8, 0x2F, 0xC0, 0x0B, 0xF8, 0x2F, 0x80, 0x0F, 0xF4, 0x3F, 0x40, 0x1F, 0xF0, 0x3F,
-    0x40, 0x3F, 0xF0, 0x3F, 0xD0, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xD0,
-    0x00, 0xBF, 0x43, 0xFD, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x02, 0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xF1,
-    0xFF, 0xC0, 0x01, 0x55, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x0B, 0xE0, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x1F,
-    0xD0, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x1F, 0xC0, 0x03, 0xF8, 0x02, 0xFC,
-    0x00, 0xBF, 0x80, 0x2F, 0x80, 0x0F, 0xF4, 0x03, 0xF4, 0x01, 0xFF, 0x00, 0x3F, 0x40, 0x3F, 0xF0,
-    0x03, 0xFD, 0x0B, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0x00,
-    0x00, 0x7F, 0xC0, 0x7F, 0x40, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0x1F, 0xD0, 0x00,
-    0x00, 0xBF, 0xCF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x16,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0x47, 0xFC, 0x00,
-    0x1F, 0xC0, 0x7F, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x03, 0xF8, 0x03, 0xF0, 0x01, 0xFD, 0x02, 0xFC,
-    0x00, 0xBF, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x0F, 0xE1, 0xFF, 0x00, 0x07, 0xFB, 0xFF,
-    0x40, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xE0, 0x00, 0x00,
-    0xBF, 0x83, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x4B, 0xFC, 0x00, 0x00,
-    0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x01, 0x55, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xD0, 0x03, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0x00,
-    0x00, 0x1F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x7F, 0x40,
-    0x00, 0x00, 0xBF, 0xCF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x05, 0xBF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0xAA, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x06, 0xAA, 0xA5, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC7,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00,
-    0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xAA, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x5A, 0xA4, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xEA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0xFE, 0x07,
-    0xFD, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x02, 0xF4, 0x00, 0xBF, 0x00,
-    0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x7D, 0x00, 0x0F, 0xE0, 0x02, 0xF0, 0x00, 0x3F, 0x40, 0x0F, 0xC0,
-    0x03, 0xFC, 0x00, 0x3F, 0xEA, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x6F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xFE, 0x07, 0xFD, 0x00, 0x03,
-    0xF8, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x02, 0xFC, 0x00, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x0F, 0xC0,
-    0x02, 0xF8, 0x00, 0x1F, 0x40, 0x03, 0xF8, 0x00, 0x2F, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xEA, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xF6,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x07, 0xF8,
-    0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x07, 0xFC,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFE,
-    0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x50, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x2F, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFE, 0x07, 0xFD, 0x03, 0xF8, 0x02, 0xFC, 0x07, 0xF0, 0x02,
-    0xFC, 0x0B, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x02, 0xF8, 0x1F, 0x40, 0x03, 0xF8, 0x2F, 0x00, 0x03,
-    0xF4, 0x3F, 0x00, 0x0F, 0xF0, 0x3F, 0xEA, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE5, 0x5B, 0xD0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x7F,
-    0xFF, 0xE0, 0x03, 0xFE, 0x41, 0x40, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x10, 0x00,
-    0x7F, 0xEB, 0xE0, 0x00, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0x90, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xBF, 0x40, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE5, 0x5B, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xFE, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xF0,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x90, 0x50, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x02, 0xFE, 0x01, 0x00, 0x00, 0x1F, 0xFA, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xE5, 0x5B, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF,
-    0x90, 0x50, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x10, 0x00, 0x1F, 0xFA,
-    0xF8, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x15, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFE, 0x55, 0xBD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0A, 0x90,
-    0x01, 0xA4, 0x00, 0x07, 0xF4, 0x0F, 0xE0, 0x00, 0x02, 0xFE, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00,
-    0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x90, 0x50, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x10, 0x00,
-    0x00, 0x1F, 0xFA, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0xA9, 0x00, 0x00, 0x01, 0xFD, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xF0, 0x56, 0xFF, 0xF0, 0x00,
-    0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x0B,
-    0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x01, 0xFF, 0x00,
-    0x00, 0x0F, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x03,
-    0xFD, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFD, 0x01, 0x6F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xCB, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x3F, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x9A,
-    0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEB, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xD0,
-    0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x02, 0xFF, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFC, 0x15, 0xBF, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x01,
-    0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x02,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x83, 0xFF, 0xFF,
-    0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xFC,
-    0x00, 0x1F, 0xF0, 0x05, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x5B, 0xF9,
-    0x50, 0x00, 0x01, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xAF, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x03, 0xFF, 0x80, 0x00, 0x07,
-    0xF4, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xE0, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFE, 0x00,
-    0x00, 0x1F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x1F,
-    0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x56, 0xAB, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xEA, 0xA9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xBF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFA, 0xA8, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xAB, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xAA, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x7D, 0x00, 0x02, 0xFC,
-    0x05, 0xBE, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x1F, 0xFE, 0xA5, 0x50, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0xF9, 0x01, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x02, 0xF4,
-    0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xAA, 0xBF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xFA, 0xA8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xAB, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xAA, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x1F, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x00, 0x03, 0xFC, 0x01, 0xF4, 0x00, 0x02, 0xFC, 0x05, 0xBE, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x1F, 0xFE, 0xA5, 0x50, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE4, 0x07, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x0F, 0xF0, 0x07, 0xD0, 0x02, 0xFC, 0x05,
-    0xBE, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F,
-    0xFE, 0xA5, 0x50, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x1F,
-    0x40, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x06,
-    0xFF, 0x90, 0x00, 0x00, 0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xEA, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x03, 0xFC, 0x01, 0xF4, 0x02, 0xFC,
-    0x05, 0xBE, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x1F,
-    0xFE, 0xA5, 0x50, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x07, 0xD0,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFA, 0xA8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xEA, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xAA, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x03, 0xFD, 0x7F, 0x80, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0x40, 0x00, 0x2F, 0xC0, 0x5B,
-    0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x80, 0x01, 0xFF, 0xEA, 0x55, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x40, 0x7D, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE2, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xD4, 0x01, 0x64, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0A, 0x50,
-    0x00, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xFF,
-    0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0x0B,
-    0xF4, 0x00, 0x0F, 0xFF, 0xD4, 0x16, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0x40, 0x00, 0x01,
-    0xFF, 0xFE, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFE, 0x0B, 0xFF, 0x80, 0x00,
-    0x0F, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0xFF, 0x80,
-    0x00, 0x0F, 0x80, 0x03, 0xFD, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0xFF,
-    0xC0, 0x00, 0x0B, 0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xBF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x29, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE9, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x07, 0xFF, 0xF5, 0x00, 0x59, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x29, 0x40,
-    0x00, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x07, 0xFF, 0xFE, 0x00, 0x0F,
-    0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x00,
-    0x0B, 0xF4, 0x00, 0x03, 0xFF, 0xF5, 0x05, 0xBF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x02, 0xF4, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x83, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xEF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x0F, 0xE0, 0xBF, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xE0, 0x03,
-    0xFF, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xD0,
-    0x01, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0xBE, 0x01, 0xFF, 0xE0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0x90, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE9, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF5, 0x00, 0x59,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x29, 0x40, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xFF, 0x42, 0xFF, 0x40, 0x07, 0xFF, 0xFE, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xD0, 0xFF, 0xE0, 0x00, 0x0B, 0xF4, 0x03,
-    0xFF, 0xF5, 0x05, 0xBF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0xFD, 0x00, 0x01, 0xFF, 0xFE, 0xFC, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xE0, 0xBF, 0xF8, 0x00, 0x3F, 0x40, 0x3F, 0xF4, 0x00, 0x7E, 0x00,
-    0x3F, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0xE0, 0x00, 0xF8, 0x00, 0x3F, 0xD0, 0x01, 0xF4, 0x00, 0x7F,
-    0xC0, 0x01, 0xF4, 0x00, 0xFF, 0xC0, 0x02, 0xF8, 0x07, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00,
-    0x0B, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0A, 0x40,
-    0x7F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x1F, 0xFF, 0xD4, 0x01, 0x64, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0A, 0x50, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x0B,
-    0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x0F, 0xFD, 0x00, 0x00, 0x7F,
-    0xF4, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x0F, 0xFF, 0xD4, 0x16, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x83, 0xF4, 0x00, 0x01, 0xFF, 0xFE, 0xFC, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x0B, 0xFF, 0x80, 0x00, 0xFD, 0x00, 0xFF, 0xD0, 0x00,
-    0x7E, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFD, 0x00, 0x07,
-    0xD0, 0x01, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0xBE, 0x01, 0xFF, 0xE0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x02, 0x90, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFE,
-    0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFE,
-    0x00, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00,
-    0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x3F,
-    0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0,
-    0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0xD5, 0x55,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x1F,
-    0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x0F, 0xF1, 0xFE, 0x00, 0x02,
-    0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0xBF, 0xD0,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x2F, 0xC0, 0x0B, 0xFC,
-    0x00, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x01, 0xFC, 0x02, 0xFD, 0x00, 0x2F, 0x80,
-    0x3F, 0xC0, 0x03, 0xF4, 0x07, 0xFC, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x0B, 0xF0, 0x0F, 0xF8, 0x00,
-    0xFF, 0x01, 0xFF, 0x40, 0x2F, 0xE0, 0x2F, 0xF4, 0x03, 0xFD, 0x03, 0xFF, 0x00, 0x7F, 0xD0, 0x06,
-    0xB0, 0x05, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF4,
-    0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xFE, 0xAA, 0xAB, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xF0, 0x00,
-    0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x55, 0x57, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0x40, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0x7F, 0xF4,
-    0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC1,
-    0x40, 0x00, 0x6B, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF5, 0x40, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0x42, 0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0xFC, 0x01, 0xFE,
-    0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xF8, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x7F, 0xC0, 0x07, 0xF0,
-    0x0B, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x1F, 0xF4, 0x02, 0xFE, 0x02, 0xFF, 0x40,
-    0x3F, 0xD0, 0x3F, 0xF0, 0x07, 0xFD, 0x00, 0x6B, 0x00, 0x54, 0x00, 0x00, 0x00, 0x14, 0x0F, 0x00,
-    0x00, 0x3F, 0x87, 0xC0, 0x00, 0x3F, 0xF6, 0xF0, 0x00, 0x1F, 0x2F, 0xF4, 0x00, 0x0B, 0xC3, 0xFC,
-    0x00, 0x00, 0xA0, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0A, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0B, 0x40,
-    0x3F, 0xE3, 0xD0, 0x2F, 0xBE, 0xF0, 0x0F, 0x4F, 0xF8, 0x03, 0xD1, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x0F, 0xD0, 0x00,
-    0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00,
-    0x07, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x6A, 0x80, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFA, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE8, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xBF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
-    0xFF, 0x2A, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x80, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x03, 0xF2, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2B, 0xF4, 0x00,
-    0x00, 0x00, 0xB9, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xFC, 0x02, 0xF8, 0x03, 0xF4, 0x03, 0xF0, 0x07,
-    0xF0, 0x0B, 0xE0, 0x0F, 0xE0, 0x1F, 0xD0, 0x2F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0xC0, 0x6F,
-    0x80, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0xAA, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x07, 0xFD,
-    0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF8, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x1F,
-    0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF,
-    0x40, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0,
-    0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x06, 0xBF, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0x40,
-    0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB9, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00,
-    0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x07,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x00, 0x1F, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x6F, 0x80, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0x91, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x0B,
-    0xF4, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xFC, 0x00, 0x00,
-    0x0F, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xCF, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0xBF, 0xD0, 0x00,
-    0x00, 0x0F, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xF3, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC7, 0xFF, 0xF0, 0x00, 0x03,
-    0xFE, 0x0F, 0xFF, 0xF0, 0x00, 0x2F, 0xF4, 0x1F, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x80, 0x00, 0x7F, 0x2F, 0xE0, 0x00, 0x0B,
-    0xFB, 0xF8, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0F, 0xF7,
-    0xFF, 0x80, 0x01, 0xFF, 0x3F, 0xFE, 0x00, 0x2F, 0xE1, 0xFF, 0xF4, 0x03, 0xFD, 0x0B, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1,
-    0xFC, 0x00, 0x7C, 0x7F, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0xF7, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80,
-    0x03, 0xF3, 0xFD, 0x00, 0x3F, 0x2F, 0xF4, 0x0B, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xFB, 0xFF,
-    0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xE8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE5, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xFF, 0x43, 0xFF,
-    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xA0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF9, 0x40, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0xBF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA8, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xC0, 0x01, 0xFF, 0x00, 0xFE, 0x00,
-    0x0B, 0xF8, 0x07, 0xF4, 0x00, 0x3F, 0xD0, 0x2F, 0xC0, 0x01, 0xFF, 0x00, 0xFE, 0x00, 0x0B, 0xF8,
-    0x06, 0xA4, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xE8, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00,
-    0x3F, 0x43, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x50, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0xFF, 0x00, 0x0B, 0xF4, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x01, 0xFF, 0x01, 0xFF, 0x40,
-    0x0B, 0xF8, 0x0F, 0xFD, 0x00, 0x3F, 0xD0, 0x15, 0x50, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD1, 0xFD, 0x00, 0x2F, 0xC3, 0xFD, 0x00, 0x3F,
-    0x87, 0xFC, 0x00, 0x3F, 0x4F, 0xFC, 0x00, 0xBF, 0x1F, 0xFC, 0x00, 0xFF, 0x15, 0x54, 0x00, 0xFD,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE5, 0x00, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFB, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD1, 0xAF, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFA, 0x40, 0x05, 0xAF, 0xFF, 0xFE, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xAF,
-    0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x0F,
-    0xF0, 0x00, 0x0B, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xC0,
-    0x00, 0x1F, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x0B, 0xFF, 0xFC, 0x0B, 0xF8, 0x00, 0x03, 0xFE, 0xFF,
-    0x03, 0xFD, 0x00, 0x01, 0xFF, 0x6F, 0xD1, 0xFF, 0x00, 0x00, 0xFF, 0xCB, 0xF8, 0xBF, 0x80, 0x00,
-    0x3F, 0xF1, 0xFF, 0x3F, 0xD0, 0x00, 0x1F, 0xFC, 0x7F, 0xDF, 0xF0, 0x00, 0x0F, 0xFE, 0x0F, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0xF0, 0x2F, 0xFF, 0x80, 0x00, 0x7F, 0xF8, 0x07, 0xFF, 0xD0, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xD1, 0xFE, 0x00, 0x0B, 0xF8, 0x01, 0xF8, 0x00,
-    0x3F, 0xC0, 0x0B, 0xE0, 0x01, 0xFD, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x01, 0xFD, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x0B, 0xF8,
-    0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xF8, 0x00,
-    0x1F, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x02,
-    0xFF, 0xF4, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x3F,
-    0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xFB, 0xFC, 0x0F, 0xF4, 0x00, 0x07, 0xFD,
-    0xBF, 0x47, 0xFC, 0x00, 0x03, 0xFF, 0x2F, 0xE2, 0xFE, 0x00, 0x00, 0xFF, 0xC7, 0xFC, 0xFF, 0x40,
-    0x00, 0x7F, 0xF1, 0xFF, 0x7F, 0xC0, 0x00, 0x3F, 0xF8, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x0F,
-    0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0xBF, 0xFE, 0x00, 0x01,
-    0xFF, 0xE0, 0x1F, 0xFF, 0x40, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xF4, 0x7F, 0x80, 0x0B, 0xF8, 0x01, 0xF8, 0x00, 0xFF, 0x00, 0x2F,
-    0x80, 0x1F, 0xD0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x0B, 0xF0, 0x07, 0xF8,
-    0x00, 0xFF, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x0F, 0xF4, 0x02, 0xFE, 0x01, 0xFF, 0x00, 0x3F, 0xD0,
-    0x2F, 0xF0, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x05, 0x40, 0x00, 0x00, 0x02,
-    0xFC, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF6, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x1F,
-    0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0B,
-    0xFF, 0xD0, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x0F,
-    0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xEF, 0xF0, 0x3F, 0xD0, 0x00, 0x07,
-    0xFD, 0xBF, 0x47, 0xFC, 0x00, 0x00, 0xFF, 0xCB, 0xF8, 0xBF, 0x80, 0x00, 0x0F, 0xFC, 0x7F, 0xCF,
-    0xF4, 0x00, 0x01, 0xFF, 0xC7, 0xFD, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0x43, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x02, 0xFF,
-    0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x40, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x02, 0xA0, 0x00, 0x00, 0x3F, 0xC0,
-    0xBF, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x9B, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x1F,
-    0xE0, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xD0,
-    0x03, 0xF8, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x1F,
-    0xE0, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0x80, 0x00,
-    0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF9, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0xF4, 0x02, 0xFE, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x2F,
-    0xE0, 0x00, 0x0F, 0xFB, 0xFC, 0x0F, 0xF4, 0x00, 0x07, 0xFD, 0xBF, 0x47, 0xFC, 0x00, 0x03, 0xFF,
-    0x2F, 0xE2, 0xFE, 0x00, 0x00, 0xFF, 0xC7, 0xFC, 0xFF, 0x40, 0x00, 0x7F, 0xF1, 0xFF, 0x7F, 0xC0,
-    0x00, 0x3F, 0xF8, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x0F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x03,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0xBF, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x40, 0x00,
-    0xBF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x00, 0x05, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xF4, 0x7F, 0x80, 0x0B, 0xF8, 0x01, 0xF8, 0x00, 0xFF, 0x00,
-    0x2F, 0x80, 0x1F, 0xD0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x0B, 0xF0, 0x07,
-    0xF8, 0x00, 0xFF, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x0F, 0xF4, 0x02, 0xFE, 0x01, 0xFF, 0x00, 0x3F,
-    0xD0, 0x2F, 0xF0, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0xAA, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1E, 0xAA, 0xA5, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xA6, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00,
-    0x1F, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x03,
-    0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xFC,
-    0x00, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-    0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0x90, 0x5B, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x6A, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0A, 0xAA, 0x95,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x0F, 0xF4, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF0,
-    0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x01, 0xFD,
-    0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x07, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE9, 0xBF,
-    0xF4, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x01, 0xFF,
-    0x80, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF,
-    0x40, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00,
-    0x00, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40,
-    0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0xE4, 0x16,
-    0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90,
-    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x00,
-    0x03, 0xFD, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0F,
-    0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x1F, 0xF0,
-    0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xE9, 0xBF, 0xF4, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x03, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x0F, 0xFF, 0x90, 0x5B, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x01, 0x50, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF4,
-    0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xC0,
-    0x00, 0x03, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x40,
-    0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x15, 0x55, 0xAA, 0xA0, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xFF, 0xFA, 0x6F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0xBD, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xE5, 0xAF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xAA, 0xA9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x0B, 0xF9, 0x00, 0x00,
-    0x3F, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFA, 0xFD, 0x00, 0x3F, 0xE0, 0x7F,
-    0xFE, 0x00, 0xF8, 0x03, 0xFD, 0x00, 0xBF, 0xD0, 0x5B, 0xF0, 0x0F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xBF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x0F, 0xE0,
-    0x01, 0xFF, 0xEA, 0x55, 0x00, 0x7F, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0xE0,
-    0x00, 0x04, 0x07, 0xFF, 0xFF, 0xFF, 0xF5, 0x06, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xE2, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xF8,
-    0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x01, 0xFC,
-    0x00, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x03, 0xF8, 0x00,
-    0x2F, 0xC0, 0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xD0,
-    0xFF, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0xFF,
-    0x80, 0x0F, 0xFD, 0x02, 0xFF, 0x80, 0x1F, 0xFD, 0x03, 0xFF, 0xC0, 0x2F, 0xFC, 0x03, 0xFF, 0xC0,
-    0x3F, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xEA, 0x40, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xAF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x02, 0xFC,
-    0x00, 0x0F, 0xD0, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xD0, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0x00,
-    0xFF, 0x80, 0x0B, 0xFE, 0x00, 0xFF, 0x80, 0x0F, 0xFD, 0x02, 0xFF, 0x80, 0x1F, 0xFD, 0x03, 0xFF,
-    0xC0, 0x2F, 0xFC, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE7,
-    0xF4, 0x00, 0x7F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xA9, 0x00, 0x3F, 0xE0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0A, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x02, 0xA0, 0x00,
-    0x00, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x00,
-    0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xD0,
-    0x00, 0x03, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF4,
-    0x3F, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0xBF,
-    0xE0, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x1F, 0xFD, 0x03, 0xFF, 0xC0, 0x00,
-    0xBF, 0xF0, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x01, 0x40, 0x02, 0xFC, 0x02, 0xF8, 0x00, 0x0F, 0xF6, 0xFE, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x40, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFE, 0xA4, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2A, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF,
-    0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xEB,
-    0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0xFF, 0xE4, 0x1F, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0x95, 0xB4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x03, 0xD0, 0x1F, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF8, 0xBF, 0x40, 0x00, 0x00, 0x3F,
-    0x80, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xE4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x03, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF9, 0x07, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1B, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xD1, 0xFE, 0x00,
-    0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xE5, 0x6D, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x03, 0xD0, 0x1F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xBF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xEB, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0xFF, 0xE4, 0x1F, 0xFF, 0x40, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xBF, 0xFF,
-    0xE4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x9F, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F,
-    0x95, 0xB4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x0B, 0xFC, 0x03, 0xD0, 0x1F, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x1B, 0xFF,
-    0xFF, 0x40, 0x03, 0xFF, 0xE4, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x10, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x69, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x03, 0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xF4,
-    0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x90, 0x7F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0xA9, 0x00, 0x01, 0xFD, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0xBF,
-    0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0x95, 0xB4, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xD0, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x04, 0x7C, 0x00, 0x00, 0x00, 0x1A, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x0B, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xAF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x1F, 0xE0, 0x00,
-    0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x64, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x0F,
-    0xF0, 0x0A, 0xA0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xE7, 0xD0, 0x00, 0x00,
-    0x00, 0xF9, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8,
-    0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x00,
-    0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
-    0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00,
-    0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0F, 0x00, 0x00, 0x7F, 0xC3,
-    0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0x1F, 0xF4, 0x00, 0x07, 0xC2, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x2F, 0xC0, 0xBE, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x07, 0xF4, 0x0F, 0xD0, 0x02, 0xFC, 0x03,
-    0xF0, 0x00, 0xFF, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x2F, 0xE0, 0x2F, 0x80, 0x0F, 0xF4,
-    0x0F, 0xD0, 0x07, 0xFC, 0x03, 0xF4, 0x03, 0xFF, 0x00, 0xFF, 0x42, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x06, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0xA4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-    0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0,
-    0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x6F,
-    0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x0B, 0xE0, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x1F, 0xD0, 0x0F,
-    0xD0, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x1F, 0xC0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0xBF,
-    0x80, 0x2F, 0x80, 0x0F, 0xF4, 0x03, 0xF4, 0x01, 0xFF, 0x00, 0x3F, 0x40, 0x3F, 0xF0, 0x03, 0xFD,
-    0x0B, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00,
-    0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF,
-    0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02,
-    0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC,
-    0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00,
-    0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00,
-    0xBE, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x7F, 0x40, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0x00,
-    0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0x80, 0x0F, 0xF4,
-    0x00, 0xFD, 0x00, 0x7F, 0xC0, 0x03, 0xF4, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x2F, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF,
-    0xE0, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-    0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0,
-    0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x0B, 0xE0, 0x00, 0xFE, 0x0F, 0xD0, 0x01,
-    0xFD, 0x0F, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x03, 0xFC, 0x1F, 0xC0, 0x03, 0xF8, 0x2F, 0xC0, 0x0B,
-    0xF8, 0x2F, 0x80, 0x0F, 0xF4, 0x3F, 0x40, 0x1F, 0xF0, 0x3F, 0x40, 0x3F, 0xF0, 0x3F, 0xD0, 0xBF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0x80, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0xBF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x00, 0x01, 0x54, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x05, 0x40, 0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x1F, 0xF0,
-    0x00, 0x7F, 0xD0, 0x0B, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0xBE,
-    0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x0B, 0xF8, 0x00, 0x02,
-    0xF8, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0x40, 0x1F, 0xF0, 0x00, 0x03, 0xF4, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xD0, 0xBF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00,
-    0xBF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF,
-    0xC0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x0B, 0xE0, 0x00,
-    0xFE, 0x0B, 0xE0, 0x01, 0xFD, 0x0F, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x03, 0xFC, 0x1F, 0xC0, 0x03,
-    0xF8, 0x1F, 0xC0, 0x0B, 0xF8, 0x2F, 0x80, 0x0F, 0xF4, 0x3F, 0x80, 0x0F, 0xF0, 0x3F, 0x40, 0x2F,
-    0xF0, 0x3F, 0x80, 0x7F, 0xE0, 0x3F, 0xFA, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x07, 0xFE, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x06, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x82, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x40, 0x0A, 0x90, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x02,
-    0xFF, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x40, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x0F, 0xFF,
-    0x01, 0xFF, 0x80, 0x03, 0xFF, 0x43, 0xFF, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0xBF, 0xFF, 0x87,
-    0xFE, 0x00, 0x03, 0xFF, 0x1F, 0xFF, 0xF8, 0xFF, 0xC0, 0x00, 0x3F, 0xF7, 0xFF, 0xFF, 0xDF, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x00,
-    0x07, 0xFF, 0xFF, 0x4F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0xBF, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x7F, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xF9, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00,
-    0x02, 0xFD, 0x1F, 0xE0, 0x2F, 0x00, 0xFF, 0x07, 0xF8, 0x1F, 0xD0, 0xBF, 0x41, 0xFE, 0x1F, 0xF8,
-    0x7F, 0xC0, 0x7F, 0x8F, 0xFF, 0x3F, 0xD0, 0x1F, 0xFF, 0xFF, 0xEF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xBF, 0xFE,
-    0x00, 0x07, 0xFF, 0x8F, 0xFF, 0x00, 0x01, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0x47, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x00,
-    0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x0B, 0xFC,
-    0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
-    0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x80, 0x2F, 0xC0,
-    0x00, 0x1F, 0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x87, 0xF4, 0x00,
-    0x00, 0x2F, 0xF3, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x05,
-    0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x0B, 0xF4, 0x00,
-    0x03, 0xFD, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0x0F,
-    0xFC, 0x7F, 0xF0, 0x00, 0x15, 0x54, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x1F, 0xF0,
-    0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x1F,
-    0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x0B, 0xFD,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xAF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x55, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xEA, 0xA0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5,
-    0x55, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xEA, 0xA0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x55, 0x40, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x81, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFE, 0xAA, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0x40, 0x02, 0xFF, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1B, 0xFF,
-    0x80, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x2F, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x0F, 0xF4, 0x00, 0x03, 0xFF, 0xE9, 0xBF, 0xF4, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0x8F,
-    0x40, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xF9, 0x05, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xBF, 0x90, 0x7D, 0x00,
-    0x0F, 0xFF, 0xF8, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x81, 0xFF, 0xF0, 0x03, 0xFD,
-    0x00, 0xBF, 0xC0, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x00,
-    0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x1F, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xF4, 0x01, 0xFD, 0x0F, 0xFB, 0xFC, 0x00, 0x3F, 0x83, 0xF4, 0xFF, 0x00, 0x0F, 0xE1, 0xF8,
-    0x7F, 0x80, 0x0F, 0xF4, 0xBD, 0x3F, 0xE5, 0xAF, 0xFC, 0x0F, 0x0F, 0xFF, 0xFF, 0xFE, 0x03, 0x87,
-    0xFF, 0xFF, 0xFF, 0x00, 0x92, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
-    0xFF, 0xE4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE9, 0x40, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xD6, 0xF4, 0x00, 0x01, 0xFF, 0xD0, 0x0F, 0x80,
-    0x00, 0x2F, 0xF8, 0x00, 0xBC, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xF8,
-    0x00, 0x0B, 0xFD, 0x00, 0x1F, 0x40, 0x00, 0xFF, 0xD0, 0x03, 0xF0, 0x00, 0x0F, 0xFF, 0x41, 0xFE,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x6A, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC1, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0x0C, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xBF,
-    0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x07, 0xF0, 0x00, 0xBF, 0xF8, 0x0B, 0xE0, 0x00, 0xFF, 0xF0, 0x0F, 0xD0, 0x01, 0xFF,
-    0x80, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00,
-    0x2F, 0xC0, 0x0B, 0xF8, 0x00, 0x2F, 0x80, 0x0F, 0xF4, 0x00, 0x3F, 0x40, 0x1F, 0xF0, 0x00, 0x3F,
-    0x40, 0x3F, 0xF0, 0x00, 0x3F, 0xD0, 0xBF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFE, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xFC, 0x02, 0xF4, 0x07, 0xE0, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x40, 0x0F, 0xF1, 0xFE, 0x02, 0xF8,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0xF0, 0xBF, 0xC7, 0xC3, 0xEF, 0xFE, 0x2F, 0x1F,
-    0xF0, 0x7C, 0x2F, 0x40, 0x01, 0x6A, 0xBF, 0xD0, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xE2, 0xAA,
-    0xA5, 0x54, 0x00, 0x00, 0x05, 0x55, 0x80, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xE6,
-    0xAA, 0xAA, 0x55, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE2, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xF4, 0x00, 0x6A, 0x90, 0x00, 0x01, 0x50, 0x3F, 0xC0, 0xFF, 0x0B, 0xFC, 0x3F,
-    0xF2, 0xFF, 0x80, 0x03, 0xF0, 0x7F, 0x02, 0xFC, 0x2F, 0xC0, 0xFF, 0x0F, 0xF0, 0xBF, 0xCB, 0xFC,
-    0x3F, 0xE3, 0xFE, 0x00, 0x3E, 0x1F, 0xD0, 0xB4, 0xF8, 0x74, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x82,
-    0xFF, 0x4F, 0x7D, 0x7F, 0xF0, 0xFF, 0x80, 0xA4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0xFF,
-    0x00, 0x03, 0xFC, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xF8, 0x0F, 0xE1,
-    0xFE, 0x00, 0x7F, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x54, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x03, 0xFD, 0x00,
-    0x2F, 0xF0, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0xA0, 0x00, 0xFF, 0xE0, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x0F,
-    0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x2A,
-    0x90, 0x00, 0x3F, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00,
-    0x07, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x1A, 0xA0, 0x01, 0x50, 0x0F, 0xC2, 0xBF,
-    0x2F, 0xF4, 0xFF, 0xC0, 0x3F, 0x00, 0xF8, 0x00, 0x14, 0x01, 0xF4, 0x03, 0xFA, 0x0F, 0xFD, 0x1F,
-    0xF8, 0x3E, 0x00, 0xFC, 0x00, 0x3F, 0xA9, 0x50, 0x7F, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x00, 0x03,
-    0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x90, 0x07,
-    0xD0, 0x2F, 0x01, 0xFC, 0x3F, 0xD0, 0xFE, 0x03, 0xE0, 0x04, 0x00, 0x00, 0x00, 0x2D, 0x0F, 0xD2,
-    0xF4, 0x2F, 0x42, 0xF4, 0x0B, 0x00, 0x00, 0x05, 0x00, 0x2F, 0x06, 0xBC, 0x1F, 0xF4, 0x7F, 0xFC,
-    0x6F, 0xF0, 0x01, 0x80, 0x64, 0x01, 0xFF, 0x97, 0xFF, 0xC2, 0xFF, 0x0B, 0xC4, 0x1F, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x70, 0xBF, 0xE1, 0xE4, 0x0D, 0x00, 0x00, 0x05, 0x6A, 0xBF, 0xC1, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xD6, 0xAA, 0xA5, 0x54, 0x0B, 0xF0, 0x3F, 0xC2, 0xFF, 0x0F, 0xFC, 0xBF,
-    0xE1, 0x55, 0x40, 0x0B, 0xF0, 0xBF, 0x0F, 0xE0, 0xFE, 0x2F, 0xE2, 0xFE, 0x3F, 0xD3, 0xFD, 0x7F,
-    0xD7, 0xFC, 0x00, 0x00, 0x2F, 0x82, 0xFF, 0x4F, 0x7D, 0x7F, 0xF0, 0xFF, 0x80, 0xA4, 0x00, 0x00,
-    0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00,
-    0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x1A, 0xA0, 0x00, 0x02, 0xE0, 0x03, 0xC0, 0x0B, 0xE0, 0x0F, 0xF8,
-    0x14, 0xBC, 0x2F, 0xF8, 0x3F, 0xF0, 0x2A, 0x40, 0x00, 0x14, 0x01, 0xFD, 0x0B, 0xF8, 0x1F, 0xD0,
-    0x3F, 0x40, 0x3F, 0xFC, 0x3F, 0xFC, 0x0B, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x03, 0xFC, 0x03, 0xF8,
-    0x07, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0x47, 0xF4, 0x7F, 0x07, 0xF0, 0xBE, 0x0B, 0xF0, 0x3F, 0xC0,
-    0x02, 0xFC, 0x0F, 0xF0, 0x2F, 0xE0, 0x07, 0xFE, 0xFF, 0x40, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0B, 0xFE,
-    0xFF, 0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x7C, 0x1F, 0xF8, 0x7D, 0x3F, 0xFC, 0xBC, 0x7D, 0x7F, 0xF8, 0xBC, 0x3F, 0xF0, 0x7C, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xF1, 0xFE, 0xAA, 0xA4, 0x00, 0x15, 0x6A,
-    0x90, 0x7F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFA, 0xA9, 0x02, 0xF8, 0x2F, 0x02, 0xFF,
-    0x4B, 0xC0, 0xFF, 0xF3, 0xE0, 0xBC, 0xBF, 0xF4, 0x3F, 0x0F, 0xFC, 0x0B, 0xC1, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x03, 0xF8, 0x02,
-    0xF0, 0x03, 0xD0, 0x3F, 0x40, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1F,
-    0xD0, 0x3F, 0xC0, 0xFE, 0x03, 0xFC, 0x0F, 0xF0, 0x2F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x6A, 0xAA, 0xA8, 0x02, 0xAA, 0xAA, 0x01, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xE0,
-    0x3F, 0x02, 0xF0, 0x0F, 0x80, 0xFC, 0x07, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFB, 0xE0, 0x2F, 0xFF, 0xD0, 0xF3, 0xFF, 0x47, 0x8F, 0x7C, 0x3D, 0x7C, 0xF0, 0xF2, 0xE7,
-    0x80, 0x00, 0x00, 0x00, 0x07, 0x4E, 0x00, 0xFE, 0x00, 0x2E, 0x00, 0x1F, 0xC0, 0x2D, 0xF4, 0x19,
-    0x19, 0x00, 0x0B, 0xD1, 0xF0, 0xBF, 0xC7, 0xC3, 0xEF, 0xFE, 0x2F, 0x1F, 0xF0, 0x7C, 0x2F, 0x40,
-    0x00, 0x01, 0xE0, 0x1F, 0xC2, 0xFC, 0x2F, 0xC3, 0xF4, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x07, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x1F, 0xF1, 0xFF, 0x00, 0xBF, 0x8F, 0xF8, 0x03, 0xFD,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFC, 0x2F,
-    0x82, 0xFC, 0x3F, 0x43, 0xF8, 0x3F, 0x03, 0xF4, 0x00, 0x56, 0xAB, 0xFC, 0x01, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFC, 0x0A, 0xAA, 0x95, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x15, 0x40, 0x00, 0x00,
-    0x01, 0x50, 0x15, 0x01, 0xFC, 0x0F, 0xC0, 0xBE, 0x0B, 0xF0, 0x3F, 0x43, 0xF8, 0x1F, 0xC0, 0xFD,
-    0x0B, 0xF0, 0xBF, 0x03, 0xF8, 0x3F, 0x81, 0xFD, 0x1F, 0xD0, 0x0A, 0x55, 0x41, 0xFF, 0xFE, 0x2F,
-    0xFF, 0xD3, 0xFF, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBC,
-    0x00, 0x07, 0xFF, 0x8B, 0xD0, 0x00, 0xFF, 0xF8, 0xFC, 0x00, 0x2F, 0xAF, 0xFF, 0x80, 0x03, 0xFB,
-    0xFF, 0xF0, 0x00, 0x3F, 0xF3, 0xFD, 0x00, 0x01, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x07,
-    0xFF, 0x40, 0x7F, 0xF8, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x68, 0x00, 0xBF, 0xFD, 0x0F, 0xF0, 0x2F, 0xEB, 0xF1,
-    0xFD, 0x03, 0xFC, 0x3F, 0xFF, 0xC0, 0x3F, 0x81, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x68, 0x00, 0xBF, 0xFD, 0x0B, 0xF0, 0x1F, 0xEB, 0xF1, 0xFE,
-    0x03, 0xFC, 0x3F, 0xFF, 0xC0, 0x2F, 0x80, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x04, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x08, 0x0B, 0xC0, 0xB0, 0x1C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1E, 0x2F, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0xFE,
-    0x40, 0x00, 0x6F, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x06, 0xFF, 0xFF, 0xE8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x0B, 0xF9, 0x55, 0x5B, 0xFF, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x3E, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x07,
-    0xF6, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x07,
-    0xF8, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x07,
-    0xFC, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07,
-    0xFE, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x7F, 0xC0, 0x5F, 0xF0, 0x00, 0x2F, 0xE0, 0x01, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0x80, 0x01, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0xAA, 0xFF, 0xC0, 0x03,
-    0xFD, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x40, 0x2F,
-    0xF5, 0x5B, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF,
-    0xFF, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xDF, 0xF0, 0x00, 0x01, 0xFF, 0x0F, 0xF0,
-    0x00, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x2F, 0xF0, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x0B, 0xFD,
-    0x00, 0x07, 0xFE, 0x1F, 0xF8, 0x00, 0x07, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xAA, 0xAF,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0xAA, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xEA, 0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x55, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFE, 0x00,
-    0x07, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x07,
-    0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00,
-    0xBF, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0xD5, 0x55, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFD,
-    0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xA6, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x40, 0x05, 0x43, 0xFD, 0x00,
-    0xBF, 0xCB, 0xFF, 0xF4, 0xFF, 0x40, 0x3F, 0xE7, 0xFF, 0xFE, 0x7F, 0xC0, 0x1F, 0xF3, 0xFF, 0xFF,
-    0x9F, 0xF0, 0x0B, 0xFC, 0x95, 0x50, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0x90, 0x5B, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE8,
-    0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00,
-    0x2F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xBF,
-    0x40, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00,
-    0x07, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x2B,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0xE0, 0x00, 0x02, 0xFD, 0x07, 0xFE, 0x00, 0x00, 0x0F,
-    0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x6F, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x40, 0x00,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFC,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFD, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xF3, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x07,
-    0xFF, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x00, 0x7F, 0xE0, 0x0F, 0xFD, 0x00, 0x2F,
-    0xF4, 0x01, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0xBF,
-    0xC0, 0x00, 0x3F, 0xE0, 0x2F, 0xF0, 0x00, 0x07, 0xFD, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC3, 0xFE,
-    0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x2F,
-    0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x40,
-    0x3F, 0xFF, 0x40, 0x02, 0xFF, 0xFD, 0x02, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0xFF, 0xCB, 0xFF, 0xFD, 0x00, 0x0F, 0xF7,
-    0xFF, 0x7F, 0xDF, 0xF4, 0x00, 0x3F, 0xCF, 0xFF, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0x3F, 0xFF, 0xF3,
-    0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xFF, 0x5F, 0xF8, 0x00, 0x3F, 0xE2, 0xFF, 0xFC, 0xBF, 0xD0, 0x01,
-    0xFF, 0x4B, 0xFF, 0xD3, 0xFF, 0x00, 0x0F, 0xFC, 0x1F, 0xFF, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x7F,
-    0xF0, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0xFF, 0x83, 0xFF, 0x40, 0x0B, 0xFE, 0x03, 0xFC, 0x2F, 0xFC,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0xF4, 0x02, 0xFE, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xE0,
-    0x00, 0x0F, 0xFB, 0xFC, 0x0F, 0xF4, 0x00, 0x07, 0xFD, 0xBF, 0x47, 0xFC, 0x00, 0x03, 0xFF, 0x2F,
-    0xE2, 0xFE, 0x00, 0x00, 0xFF, 0xC7, 0xFC, 0xFF, 0x40, 0x00, 0x7F, 0xF1, 0xFF, 0x7F, 0xC0, 0x00,
-    0x3F, 0xF8, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x0F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x03, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xC0, 0xBF, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x40, 0x00, 0xBF,
-    0xF4, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55,
-    0x55, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x55, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xA6, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F,
-    0xD0, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0,
-    0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0x90, 0x5B, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xF0, 0x00, 0xFE,
-    0x00, 0x2F, 0xC0, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x1F,
-    0xC0, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0x03,
-    0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00,
-    0x7F, 0x40, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x40,
-    0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xF4, 0x01, 0xFD,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x80, 0x0F, 0xF4,
-    0x00, 0x3F, 0xE5, 0xAF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x1F,
-    0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x02, 0xFF, 0x00,
-    0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x0B,
-    0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xAF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x8F,
-    0xF0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xD0, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x1F, 0xD0,
-    0x0B, 0xFF, 0x00, 0x1F, 0xFC, 0x02, 0xFC, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x40, 0x3F, 0xC0, 0x0F,
-    0xFE, 0x00, 0x7F, 0xF0, 0x07, 0xF8, 0x00, 0xFF, 0xD0, 0x0F, 0xFE, 0x00, 0xBF, 0x00, 0x2F, 0xFC,
-    0x00, 0xFF, 0xD0, 0x0F, 0xF0, 0x07, 0xFF, 0x40, 0x1F, 0xFE, 0x00, 0xFE, 0x02, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFE, 0x6F, 0xEA, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0,
-    0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0xE9, 0x00, 0x7E, 0x1E,
-    0x80, 0x2F, 0xC0, 0x0B, 0xD2, 0xFC, 0x03, 0xF8, 0x00, 0xFC, 0x2F, 0x80, 0x3F, 0x40, 0x0F, 0xC3,
-    0xF4, 0x03, 0xF0, 0x02, 0xF8, 0x7F, 0x00, 0x7F, 0x00, 0x3F, 0x4F, 0xE0, 0x07, 0xF0, 0x03, 0xF2,
-    0xFD, 0x00, 0xBF, 0x00, 0x7E, 0x7F, 0xC0, 0x0B, 0xF8, 0x0B, 0xFF, 0xF4, 0x00, 0x7F, 0xE0, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x2F,
-    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0,
-    0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x02, 0xFC, 0x00, 0x00,
-    0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFC,
-    0x00, 0x02, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xC1, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xC2, 0xFF,
-    0xFD, 0x00, 0x7F, 0xFF, 0x83, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF,
-    0xFE, 0x00, 0x00, 0xFE, 0x07, 0xFD, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x02, 0xFC,
-    0x00, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x1F, 0x40, 0x03, 0xF8, 0x00,
-    0x2F, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xEA, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x04, 0x2F, 0xFF, 0xFF, 0xFF, 0xBC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF,
-    0x80, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40,
-    0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x9F, 0xF8, 0x00,
-    0x0F, 0xF8, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x1F, 0xD0, 0x03, 0xF4, 0x00, 0x2F,
-    0xC1, 0x6F, 0xF0, 0x00, 0x3F, 0xCF, 0xFF, 0xC0, 0x00, 0x3F, 0x8F, 0xFF, 0x80, 0x00, 0x7F, 0x5F,
-    0xFF, 0xE0, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x0F,
-    0xF0, 0x02, 0xFF, 0xF4, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xF6, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x2F, 0xF8, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xE4, 0xFF, 0x00, 0x1F, 0xE2,
-    0xFC, 0x00, 0x7F, 0x4B, 0xF4, 0x02, 0xFC, 0x1F, 0xE0, 0x0F, 0xF0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF,
-    0x03, 0xFC, 0x03, 0xFD, 0x1F, 0xF0, 0x0B, 0xF8, 0xFF, 0x40, 0x1F, 0xFB, 0xFC, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFD,
-    0x5A, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x10, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFB, 0xFF, 0x00, 0x0F, 0xFD, 0x03,
-    0xFE, 0x00, 0xBF, 0xD0, 0x0B, 0xF8, 0x03, 0xFE, 0x00, 0x2F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0x40,
-    0x3F, 0xD0, 0x0F, 0xFC, 0x00, 0xFF, 0xEB, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF,
-    0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x06, 0xE0,
-    0x00, 0x1F, 0xFF, 0x00, 0x0F, 0x81, 0xE0, 0x07, 0x40, 0x64, 0x01, 0xD0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x2F, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0x80, 0xF4, 0x07, 0xC0, 0x7D, 0x01, 0xF4, 0x3F,
-    0x40, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0x5F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xFE,
-    0x47, 0xF8, 0x00, 0xFF, 0x40, 0x2F, 0x80, 0x0F, 0xE0, 0x02, 0xF8, 0x01, 0xFD, 0x00, 0x3F, 0x40,
-    0x3F, 0xC0, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x0B, 0xF4, 0x01,
-    0xFE, 0x00, 0xFF, 0x40, 0x2F, 0xD0, 0x1F, 0xF0, 0x03, 0xFC, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x3F,
-    0xE0, 0x0B, 0xF8, 0x02, 0xA9, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFD,
-    0x00, 0x02, 0xFE, 0x0B, 0xF0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x02, 0xFC,
-    0x00, 0x3F, 0x40, 0x3F, 0x80, 0x03, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x01, 0xFE, 0x55, 0x7F, 0xD0, 0x2F, 0xE0, 0x03, 0xFC, 0x02, 0xFE, 0x00,
-    0xFF, 0xC0, 0x3F, 0xF0, 0x2F, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0x90,
-    0x00, 0x00, 0x00, 0x09, 0x40, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x0B,
-    0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x40,
-    0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x1F, 0xFA, 0x43, 0xFF, 0xF4, 0x3F, 0xFF, 0x07, 0xFF, 0xE0, 0x00,
-    0x0F, 0xC2, 0xFC, 0x00, 0x0F, 0x87, 0xF0, 0x00, 0x2F, 0x4F, 0xD0, 0x00, 0x3F, 0x3F, 0x40, 0x00,
-    0x7E, 0xFE, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0F, 0xEF, 0xF4, 0x00, 0x0F,
-    0xCF, 0xFD, 0x00, 0x2F, 0x87, 0xFF, 0x00, 0x3F, 0x43, 0xFF, 0xC0, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x05, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0xCF, 0xF0, 0x00, 0x00, 0x3F, 0xE1, 0xFD, 0x00, 0x00,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x03, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0x00, 0x00,
-    0xFF, 0x40, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x00,
-    0x07, 0xF4, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x0F,
-    0xD0, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF8, 0x00, 0x7F, 0x80, 0x0F, 0xF4, 0x00, 0xBF, 0x40, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x3F,
-    0xF0, 0x01, 0xFF, 0xD0, 0xBF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xC7, 0xFE, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x03, 0xE4, 0xFF, 0x00, 0x1F, 0xE2, 0xFC, 0x00, 0x7F, 0x4B, 0xF4, 0x02, 0xFC, 0x1F, 0xE0, 0x0F,
-    0xF0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x03, 0xFD, 0x03, 0xFD, 0x1F, 0xF0, 0x0B, 0xF8, 0xFF, 0x40,
-    0x1F, 0xFB, 0xFC, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x55, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xD0, 0x00, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x03,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFE, 0x40,
-    0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xFC, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xFE, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0xBF,
-    0x00, 0xFE, 0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x03, 0xFC, 0x0F, 0xE0, 0x01,
-    0xFE, 0x07, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0x07, 0xF4, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x1F, 0xD0, 0xFE, 0x00,
-    0x00, 0xBF, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x1F, 0xD0, 0xFD, 0x00, 0x00, 0xBF,
-    0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x1F, 0xC1, 0xFF, 0xF0, 0x00, 0xFF, 0x07, 0xFF,
-    0x80, 0x02, 0xA4, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE6, 0xF8, 0x00, 0x00, 0xFF, 0x80,
-    0x3F, 0x00, 0x00, 0x7F, 0xC0, 0x0B, 0xC0, 0x00, 0x3F, 0xD0, 0x02, 0xF0, 0x00, 0x1F, 0xF0, 0x00,
-    0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xFE, 0x00, 0x2F, 0x40, 0x03, 0xFF, 0xD0, 0x6F,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xF4, 0x6F, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x40, 0x00, 0xBF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFC, 0x0B, 0xF8, 0x1F, 0xD0, 0xFE, 0x00, 0x14, 0x1F, 0xC0, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xF8, 0x1F, 0xE0, 0x00, 0x03,
-    0xFD, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00,
-    0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00,
-    0x1F, 0xF0, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x3F, 0x00,
-    0xFC, 0x07, 0xF0, 0x0F, 0xC0, 0xBE, 0x00, 0xFC, 0x0B, 0xE0, 0x0F, 0xC0, 0xFD, 0x00, 0xFC, 0x0F,
-    0xC0, 0x0F, 0xC1, 0xFC, 0x01, 0xFC, 0x2F, 0xC0, 0x2F, 0xC2, 0xFC, 0x03, 0xF8, 0x3F, 0xD1, 0xFF,
-    0x43, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x00, 0x6F,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xEF, 0x87, 0xFF,
-    0x00, 0x01, 0xFF, 0x8B, 0xD0, 0xBF, 0xC0, 0x00, 0xFF, 0x83, 0xF0, 0x0F, 0xF4, 0x00, 0xFF, 0xC0,
-    0xFC, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x7E, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x2F, 0x80, 0x3F, 0xD0,
-    0x0F, 0xF4, 0x0F, 0xD0, 0x1F, 0xF0, 0x07, 0xFC, 0x03, 0xF0, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0xFC,
-    0x03, 0xFE, 0x00, 0xBF, 0x80, 0x7E, 0x00, 0xFF, 0x40, 0x3F, 0xF0, 0x2F, 0x80, 0xFF, 0xC0, 0x0F,
-    0xFD, 0x0F, 0xD1, 0xFF, 0xE0, 0x03, 0xFF, 0xFB, 0xFB, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xFE,
-    0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xD0, 0xFF, 0x00, 0x00,
-    0x05, 0xBF, 0xE3, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF5, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0x00,
-    0xBF, 0xFD, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x6A, 0xA0, 0x00, 0x06, 0xA8, 0x00, 0x00,
-    0x02, 0x90, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0xE0, 0x03, 0xFF, 0xC0, 0xF8, 0x07, 0xFF, 0x80, 0xFC, 0x0B,
-    0xEF, 0x80, 0xFC, 0x0F, 0xEF, 0x40, 0xFC, 0x0F, 0xDF, 0x40, 0xFC, 0x0F, 0xDF, 0x01, 0xFC, 0x1F,
-    0xDF, 0x02, 0xF8, 0x2F, 0xDF, 0x02, 0xF8, 0x2F, 0xEF, 0x03, 0xF4, 0x3F, 0xFF, 0xAF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x1E, 0xA0, 0x06, 0x90, 0x00, 0x7F, 0xD0, 0x03, 0xF4, 0x01, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xFD,
-    0x00, 0x03, 0xF8, 0x0B, 0xF8, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x7D, 0x03, 0xF4, 0x2F, 0xD0, 0xBC,
-    0x03, 0xF4, 0x3F, 0xC0, 0xF8, 0x07, 0xF0, 0x3F, 0x80, 0xF4, 0x0F, 0xF0, 0x7F, 0x43, 0xF4, 0x7F,
-    0xD0, 0x3F, 0xEF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xF8, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xF6, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x1F,
-    0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFE, 0x00,
-    0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x0F, 0xE0, 0x7F, 0xD0, 0x03, 0xF8, 0x02, 0xFC, 0x00,
-    0x7F, 0x00, 0x2F, 0xC0, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x1F, 0x40, 0x03,
-    0xF8, 0x02, 0xF0, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x0F, 0xF0, 0x03, 0xFE, 0xAF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x6F,
-    0xD0, 0x00, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x81,
-    0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0,
-    0x0F, 0xF0, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xE0,
-    0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0xFE, 0x07, 0xFD, 0x03, 0xF8, 0x02, 0xFC, 0x07, 0xF0, 0x02, 0xFC, 0x0B, 0xD0,
-    0x02, 0xFC, 0x0F, 0xC0, 0x02, 0xF8, 0x1F, 0x40, 0x03, 0xF8, 0x2F, 0x00, 0x03, 0xF4, 0x3F, 0x00,
-    0x0F, 0xF0, 0x3F, 0xEA, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF6, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x81,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF4,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xF8, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x00,
-    0x07, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0xF8,
-    0x00, 0x00, 0x1F, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xEA, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xF6, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x01,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x64, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x07, 0xF4, 0x7F, 0x80, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFD,
-    0x00, 0x3F, 0x81, 0xFF, 0x40, 0x3F, 0x80, 0x2F, 0xC0, 0x1F, 0xC0, 0x0B, 0xF0, 0x0B, 0xD0, 0x02,
-    0xFC, 0x03, 0xF0, 0x00, 0xBE, 0x01, 0xF4, 0x00, 0x3F, 0x80, 0xBC, 0x00, 0x0F, 0xD0, 0x3F, 0x00,
-    0x0F, 0xF0, 0x0F, 0xFA, 0xBF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xE0,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF6, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00,
-    0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0xAA,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x02, 0xF0, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x07,
-    0xF0, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00,
-    0x07, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xC0,
-    0x00, 0x03, 0xFE, 0xAF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xD0, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x3D, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x9F, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x0A, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0x47, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F,
-    0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xFE, 0xAA, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x7D, 0x0F, 0x00, 0x00, 0x07, 0xFC, 0x3D, 0x00, 0x00, 0x3F, 0xF9, 0xF0, 0x00, 0x01,
-    0xF5, 0xFF, 0x80, 0x00, 0x07, 0xC3, 0xFC, 0x00, 0x00, 0x0A, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x1F, 0xC0, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xE0, 0x7F, 0xD0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x07,
-    0xF0, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x07, 0xD0, 0x00,
-    0xFE, 0x00, 0x2F, 0x00, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFE, 0xAF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF8, 0xBF,
-    0x40, 0x00, 0x00, 0x3F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x6F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40,
-    0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x1F,
-    0xF0, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xFA,
-    0xAB, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x03,
-    0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xD1, 0xFE, 0x00,
-    0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xE0, 0x7F,
-    0xD0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x07, 0xF0, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x0B, 0xF0, 0x00,
-    0xFC, 0x00, 0x2F, 0x80, 0x07, 0xD0, 0x00, 0xFE, 0x00, 0x2F, 0x00, 0x03, 0xF4, 0x00, 0xFC, 0x00,
-    0x3F, 0xC0, 0x03, 0xFE, 0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x6F, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x01,
-    0xFF, 0xAF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x1B,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xFE, 0x07, 0xFD, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x07,
-    0xF0, 0x02, 0xFC, 0x00, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0x40,
-    0x03, 0xF8, 0x00, 0x2F, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xEA, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x6F,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00,
-    0x01, 0xFF, 0xEF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00,
-    0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xFE, 0x07, 0xFD, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00,
-    0x07, 0xF0, 0x02, 0xFC, 0x00, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x1F,
-    0x40, 0x03, 0xF8, 0x00, 0x2F, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xEA,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xEF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF6, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF4,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x01, 0x4B, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0x02,
-    0xFF, 0xBF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xE0,
-    0x7F, 0xD0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x07, 0xF0, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x0B, 0xF0,
-    0x00, 0xFC, 0x00, 0x2F, 0x80, 0x07, 0xD0, 0x00, 0xFE, 0x00, 0x2F, 0x00, 0x03, 0xF4, 0x00, 0xFC,
-    0x00, 0x3F, 0xC0, 0x03, 0xFE, 0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF3, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x06, 0x41, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF6, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x2D, 0x00,
-    0x00, 0x03, 0xFE, 0x3D, 0x00, 0x00, 0x0B, 0xEF, 0xBC, 0x00, 0x00, 0x0F, 0x4F, 0xF8, 0x00, 0x00,
-    0x0F, 0x47, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xAF,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0x00, 0xFE, 0x07, 0xFD, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x02,
-    0xFC, 0x00, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0x40, 0x03, 0xF8,
-    0x00, 0x2F, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xEA, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF1,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x01, 0xFF, 0xAF, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xD0, 0x00, 0x03, 0xF8, 0x02,
-    0xFC, 0x00, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x2F, 0x80, 0x00, 0x1F, 0x40, 0x03, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xFE, 0xAF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xFE,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0xFF, 0x00, 0x03, 0xFC, 0x01, 0xF4, 0x00, 0xBF, 0x01,
-    0x6F, 0x80, 0x0F, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF8, 0x07,
-    0xFF, 0xA9, 0x54, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x07,
-    0xD0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x01,
-    0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x80, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x80, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x03, 0xFC, 0x01, 0xF4, 0x02,
-    0xFC, 0x05, 0xBE, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x1F, 0xFE, 0xA5, 0x50, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x07,
-    0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x01, 0xBF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0B, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0xB8, 0x00, 0x00, 0x01,
-    0xFF, 0xCF, 0x40, 0x00, 0x00, 0x2F, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xE2, 0xFD, 0x00, 0x00, 0x00,
-    0x19, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x80, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0xF0, 0x00, 0x00, 0x7F, 0xC7, 0xC0, 0x00, 0x03, 0xEF, 0xFE, 0x00, 0x00, 0x1F, 0x1F, 0xF4,
-    0x00, 0x00, 0x7C, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xBF, 0xC0, 0x00, 0x3F, 0xC0, 0x1F, 0x40, 0x02, 0xFC, 0x05, 0xBE, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFE, 0xA5, 0x50,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x7D, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0xBF, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFA, 0xA8, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAF, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x1F, 0xE2, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x05, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xA5, 0x50, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF9, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xBF, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFF, 0xFA, 0xA8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xAB, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xD1,
-    0xFD, 0x00, 0x03, 0xF4, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0x7D, 0x00, 0x2F,
-    0xC0, 0x5B, 0xE0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFE,
-    0x01, 0xFF, 0xEA, 0x55, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF9,
-    0x01, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFA, 0xA8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0xAF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xAA, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x01,
-    0xFE, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7D, 0x00, 0x00,
-    0x02, 0xFC, 0x05, 0xBE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0xA5, 0x50, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x01, 0xF4, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x1D, 0x00, 0x00, 0x00,
-    0x3F, 0xE2, 0xE0, 0x00, 0x00, 0x07, 0xEF, 0xBD, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFA, 0xA8,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFD,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAA,
-    0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x02, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x3D, 0x00, 0x00, 0x00, 0x7F, 0xE3, 0xC0, 0x00,
-    0x00, 0x0F, 0x9F, 0xFC, 0x00, 0x00, 0x00, 0xF4, 0xBF, 0x40, 0x00, 0x00, 0x0A, 0x01, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x2F, 0xD0, 0x00,
-    0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x07, 0xD0, 0x00, 0x02, 0xFC, 0x05, 0xBE, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFE, 0xA5,
-    0x50, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x90,
-    0x1F, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x02, 0xF8, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFA, 0xA8,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFD,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAA,
-    0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0xBF, 0x40, 0x00, 0x3F, 0x40,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x03, 0xFC, 0x01, 0xF4, 0x00, 0x2F, 0xC0, 0x5B,
-    0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x01,
-    0xFF, 0xEA, 0x55, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xE4,
-    0x07, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFA, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0xAF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0x40, 0x00, 0xBC,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE4,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xFE, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0xFF,
-    0x00, 0x03, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFA, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xAF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB9, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xA6, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00,
-    0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0x90, 0x5B, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x03, 0xFE, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x2F, 0xC0, 0x0F, 0xE0, 0x02, 0xFC, 0x02, 0xFC, 0x00,
-    0x2F, 0xC0, 0x3F, 0x80, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0x7F, 0x80, 0x7F, 0x40, 0x0F, 0xF0, 0x07,
-    0xFC, 0x07, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE9, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x03,
-    0xFD, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x0F, 0xF8,
-    0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00,
-    0x00, 0xBF, 0xE0, 0x03, 0xFF, 0xE4, 0x16, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x01, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4,
-    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0xFF, 0x40,
-    0x2F, 0xC0, 0x3F, 0x80, 0x0B, 0xF0, 0x2F, 0xC0, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0xFF, 0x03, 0xF8,
-    0x00, 0x7F, 0x81, 0xFD, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x7F, 0xF0, 0x1F, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xF8, 0x00, 0x00,
-    0x1F, 0xE2, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xE0, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xA6, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F,
-    0xFF, 0x90, 0x5B, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x87, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
-    0x01, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xCB, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0x00, 0x0A, 0x40, 0x01, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x9B, 0xFF, 0x40,
-    0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xF8, 0x00,
-    0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x02,
-    0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x03, 0xFE,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xFE, 0x41, 0x6F, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x07, 0xF8, 0x7F, 0x80, 0x03, 0xF4, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0xFF, 0x40, 0x2F, 0xC0, 0x3F, 0x80, 0x0B, 0xF0, 0x2F, 0xC0,
-    0x02, 0xFC, 0x0F, 0xE0, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0x81, 0xFD, 0x00, 0x3F, 0xC0, 0x7F,
-    0xC0, 0x7F, 0xF0, 0x1F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE2, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xA6, 0xFF, 0xD0, 0x00, 0x0F, 0xFE,
-    0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xD0,
-    0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0B,
-    0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0x90, 0x5B, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xF4,
-    0x02, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x07, 0xFC,
-    0x00, 0x00, 0x3F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00,
-    0xBF, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF4,
-    0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x43, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xDB, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xFF, 0xFA, 0x6F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0x80, 0x00, 0xBF,
-    0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF,
-    0x40, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x03, 0xFE, 0x00,
-    0x00, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80,
-    0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0xFF, 0xF9, 0x05, 0xBF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0x00, 0x00, 0x07, 0xFD, 0x3D, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xF4, 0xFF, 0x40, 0x00, 0x03, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x1F,
-    0xD0, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x03, 0xFF, 0xFE,
-    0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x03, 0xFE, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x0B, 0xF0, 0x00,
-    0xFE, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0xFE, 0x00,
-    0x1F, 0xE0, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x1F, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xE2, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xA6, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x1F,
-    0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0x90, 0x5B, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xFF, 0x40, 0x00, 0x0F, 0xE1, 0xFE, 0x00, 0x03, 0xF8, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x03, 0xFE, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x2F, 0xC0, 0x0F, 0xE0, 0x02, 0xFC,
-    0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0x7F, 0x80, 0x7F, 0x40,
-    0x0F, 0xF0, 0x07, 0xFC, 0x07, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x1B, 0xFF, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x2F, 0xC0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0xE9, 0xBF, 0xF4, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x01,
-    0xFF, 0x8F, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xF9, 0x05, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xBF, 0x90, 0x7D, 0x00,
-    0x0F, 0xFF, 0xF8, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x81, 0xFF, 0xF0, 0x03, 0xFD,
-    0x00, 0xBF, 0xC0, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x00,
-    0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x1F, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x1B, 0xFF, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x2F, 0xC0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0xE9, 0xBF, 0xF4, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x01,
-    0xFF, 0x8F, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xF9, 0x05, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x01, 0xBF, 0x90, 0x7D, 0x00, 0x0F, 0xFF, 0xF8, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0x81, 0xFF, 0xF0, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00,
-    0xBF, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xD0, 0x03, 0xFC,
-    0x00, 0x1F, 0xF0, 0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x2F, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0xE9, 0xBF, 0xF4, 0xFD,
-    0x00, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0x8F, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xF9, 0x05, 0xBF, 0xFD,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xBF, 0x90, 0x7D, 0x00, 0x0F, 0xFF, 0xF8, 0xFC, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x81, 0xFF, 0xF0, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x03, 0xF8, 0x00,
-    0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFE,
-    0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0xBC, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x2F, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x0F, 0xF4, 0x00, 0x03,
-    0xFF, 0xE9, 0xBF, 0xF4, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0x8F, 0x40, 0x00, 0x2F, 0xF8,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0xFF, 0xF9, 0x05, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x43,
-    0xC0, 0x00, 0x00, 0x3F, 0xC3, 0xD0, 0x00, 0x00, 0xBF, 0xE7, 0xC0, 0x00, 0x00, 0xF6, 0xFF, 0x80,
-    0x00, 0x01, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0xA0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xBF, 0x90, 0x7D, 0x00, 0x0F,
-    0xFF, 0xF8, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x81, 0xFF, 0xF0, 0x03, 0xFD, 0x00,
-    0xBF, 0xC0, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x00, 0xFF,
-    0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x1F, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x2F, 0xC0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFE, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0xE9, 0xBF, 0xF4, 0xFD, 0x00, 0x00, 0xFF,
-    0xE0, 0x01, 0xFF, 0x8F, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xF9, 0x05, 0xBF, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x06, 0xFE, 0x41, 0xF4, 0x00, 0x0F, 0xFF, 0xF8, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xF8, 0x1F, 0xFF, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00,
-    0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00,
-    0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-    0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F,
-    0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02,
-    0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE,
-    0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0xBE,
-    0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x7F, 0x40, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xF0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0x80, 0x0F, 0xF4, 0x00,
-    0xFD, 0x00, 0x7F, 0xC0, 0x03, 0xF4, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x2F, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xE0,
-    0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF,
-    0xD0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03,
-    0xFF, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0xBF, 0x0B, 0xE0, 0x00, 0xFE, 0x0F, 0xD0, 0x01, 0xFD, 0x0F, 0xD0, 0x02, 0xFC, 0x0F, 0xC0,
-    0x03, 0xFC, 0x1F, 0xC0, 0x03, 0xF8, 0x2F, 0xC0, 0x0B, 0xF8, 0x2F, 0x80, 0x0F, 0xF4, 0x3F, 0x40,
-    0x1F, 0xF0, 0x3F, 0x40, 0x3F, 0xF0, 0x3F, 0xD0, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
-    0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0xBF, 0xF8, 0x0B,
-    0xE0, 0x00, 0xFF, 0xF0, 0x0F, 0xD0, 0x01, 0xFF, 0x80, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x0F, 0xC0,
-    0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x0B, 0xF8, 0x00, 0x2F, 0x80, 0x0F,
-    0xF4, 0x00, 0x3F, 0x40, 0x1F, 0xF0, 0x00, 0x3F, 0x40, 0x3F, 0xF0, 0x00, 0x3F, 0xD0, 0xBF, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x02, 0xFF,
-    0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-    0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xD0,
-    0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0xBF, 0xF8, 0x0B, 0xE0, 0x00, 0xFF, 0xF0,
-    0x0F, 0xD0, 0x01, 0xFF, 0x80, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x1F,
-    0xC0, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x0B, 0xF8, 0x00, 0x2F, 0x80, 0x0F, 0xF4, 0x00, 0x3F, 0x40,
-    0x1F, 0xF0, 0x00, 0x3F, 0x40, 0x3F, 0xF0, 0x00, 0x3F, 0xD0, 0xBF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0,
-    0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0xBF, 0xF8, 0x0B, 0xE0,
-    0x00, 0xFF, 0xF0, 0x0F, 0xD0, 0x01, 0xFF, 0x80, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x03,
-    0xFC, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x0B, 0xF8, 0x00, 0x2F, 0x80, 0x0F, 0xF4,
-    0x00, 0x3F, 0x40, 0x1F, 0xF0, 0x00, 0x3F, 0x40, 0x3F, 0xF0, 0x00, 0x3F, 0xD0, 0xBF, 0xE0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0x80, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xE0, 0x00,
-    0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x0F, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x07,
-    0xC7, 0xFD, 0x00, 0x00, 0x07, 0xC2, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0xBF,
-    0xF8, 0x0B, 0xE0, 0x00, 0xFF, 0xF0, 0x0F, 0xD0, 0x01, 0xFF, 0x80, 0x0F, 0xD0, 0x02, 0xFC, 0x00,
-    0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x0B, 0xF8, 0x00, 0x2F,
-    0x80, 0x0F, 0xF4, 0x00, 0x3F, 0x40, 0x1F, 0xF0, 0x00, 0x3F, 0x40, 0x3F, 0xF0, 0x00, 0x3F, 0xD0,
-    0xBF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xBF,
-    0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xFF, 0x80, 0x02, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-    0xD0, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x00,
-    0x07, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x3F, 0xD0,
-    0x00, 0x03, 0xF4, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0xBF,
-    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC,
-    0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x2F,
-    0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x3F, 0xE0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xFE, 0x00, 0x02, 0xFE,
-    0x00, 0xBF, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0x40, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x03, 0xFE,
-    0x1F, 0xD0, 0x00, 0x00, 0xBF, 0xCF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x16, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x02, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x40, 0x00,
-    0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x40, 0xBF,
-    0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x02,
-    0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x03, 0xFD, 0x00, 0x3F,
-    0x80, 0x00, 0xBF, 0x80, 0x2F, 0xC0, 0x00, 0x1F, 0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xFD, 0x0F, 0xF0,
-    0x00, 0x00, 0xFF, 0x87, 0xF4, 0x00, 0x00, 0x2F, 0xF3, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x05, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0xFD, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0xBF, 0x80, 0x00, 0xBF, 0xE0, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC,
-    0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x2F,
-    0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x3F, 0xE0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC,
-    0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x40, 0x0F, 0xE0, 0x00, 0x2F, 0xE0, 0x0B, 0xF0, 0x00, 0x07, 0xFC,
-    0x07, 0xF4, 0x00, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x00, 0x3F, 0xE1, 0xFD, 0x00, 0x00, 0x0B, 0xFC,
-    0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0x6F, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x43, 0xC0, 0x00, 0x00, 0x7F, 0xC3,
-    0xC0, 0x00, 0x00, 0xFB, 0xDB, 0xC0, 0x00, 0x01, 0xF2, 0xFF, 0x40, 0x00, 0x02, 0xF0, 0xFF, 0x00,
-    0x00, 0x00, 0xA0, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00,
-    0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x02, 0xFF,
-    0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00,
-    0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xC0, 0x00, 0x00, 0x2F, 0xF9,
-    0xF0, 0x00, 0x00, 0x0F, 0x5F, 0xFC, 0x00, 0x00, 0x07, 0xC3, 0xFD, 0x00, 0x00, 0x00, 0xA0, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x2F, 0xC0,
-    0x00, 0xFF, 0x40, 0x0F, 0xE0, 0x00, 0x2F, 0xE0, 0x0B, 0xF0, 0x00, 0x07, 0xFC, 0x07, 0xF4, 0x00,
-    0x00, 0xFF, 0x43, 0xFC, 0x00, 0x00, 0x3F, 0xE1, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0xFE, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0x6F, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x2A, 0xAA,
-    0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x2A,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x02, 0xF8, 0x07, 0xE0, 0x00, 0x3F,
-    0x00, 0xBD, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7E, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x2F, 0x80,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x3F, 0x00,
-    0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0xBE, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x2F, 0x40, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0xFD,
-    0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x40, 0x01, 0xFC,
-    0x03, 0xF0, 0x00, 0x2F, 0x80, 0x7F, 0x00, 0x03, 0xF4, 0x0B, 0xD0, 0x00, 0x2A, 0x00, 0xA8, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F,
-    0xF4, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x00,
-    0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x2A, 0xA0, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x40, 0x2F, 0xFC,
-    0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x6A, 0x90,
-    0x00, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x0F,
-    0xFC, 0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x2A, 0xA0, 0x00, 0x7F, 0xF4, 0x00, 0xFF, 0xE0, 0x01,
-    0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8,
-    0x00, 0x2A, 0xA0, 0x7F, 0xF4, 0x7F, 0xF8, 0x00, 0xFF, 0xE0, 0xBF, 0xF0, 0x01, 0xFF, 0xC0, 0xFF,
-    0xC0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x0B, 0xFE, 0x00,
-    0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x1F, 0xFC, 0x00, 0x2A, 0xA0, 0x2A, 0xA0, 0x00, 0xFF,
-    0xF0, 0xFF, 0xF0, 0x07, 0xFF, 0x43, 0xFF, 0x80, 0x2F, 0xFC, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0xBF,
-    0xD0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x02, 0xFF, 0x81, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x0F, 0xFC, 0x00, 0x6A, 0x90, 0x6A, 0x90, 0x00, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x0F,
-    0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x2A,
-    0xA0, 0x00, 0xBF, 0xF4, 0x7F, 0xF8, 0x00, 0xFF, 0xE0, 0xBF, 0xF0, 0x01, 0xFF, 0xC0, 0xFF, 0xC0,
-    0x03, 0xFF, 0x02, 0xFF, 0x40, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x0B, 0xFE, 0x00, 0x0F,
-    0xFC, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x1F, 0xFC, 0x00, 0x2A, 0xA0, 0x2A, 0xA0, 0x00, 0x00, 0x1A,
-    0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x0F, 0xE5, 0x80, 0xBF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xF8, 0x55, 0xBF,
-    0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x05,
-    0x7F, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFA, 0x94,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x55, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xF4, 0x1F, 0xFF, 0xC2, 0xFF, 0xF0, 0x2F, 0xE4, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x0F, 0xF0, 0xBF, 0x83, 0xFE, 0x2F, 0xF4, 0xFF, 0xD0, 0x01,
-    0x54, 0x0F, 0xF0, 0xBF, 0x83, 0xFE, 0x2F, 0xF4, 0xFF, 0xD0, 0x01, 0x54, 0x00, 0x54, 0x00, 0x55,
-    0x07, 0xF8, 0x02, 0xFD, 0x01, 0xFE, 0x0F, 0xF4, 0x03, 0xFC, 0x03, 0xFE, 0x1F, 0xF4, 0x0B, 0xFC,
-    0x07, 0xFD, 0x3F, 0xF0, 0x0F, 0xFC, 0x0B, 0xFD, 0x7F, 0xF0, 0x1F, 0xFC, 0x0F, 0xFC, 0x3F, 0x3F,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xE0,
-    0x00, 0xFC, 0x00, 0x00, 0x34, 0xC0, 0x0F, 0xC0, 0x00, 0x01, 0xF7, 0x40, 0xFD, 0x00, 0x00, 0x0E,
-    0xDC, 0x0F, 0xE0, 0x00, 0x00, 0x38, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0xFF, 0x4B, 0xF0, 0x00, 0x00,
-    0x02, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x06, 0x02, 0x80, 0x00, 0x1F, 0xD0,
-    0x95, 0x36, 0x40, 0x01, 0xFE, 0x07, 0xA9, 0xB9, 0x00, 0x1F, 0xE0, 0x2A, 0xDA, 0xB0, 0x00, 0xFF,
-    0x00, 0xBF, 0x2F, 0xC0, 0x0F, 0xF0, 0x01, 0xF0, 0x7C, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x07, 0xFF,
-    0x43, 0xFF, 0x40, 0x2F, 0xF8, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x07, 0xFE, 0x03, 0xFF,
-    0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x02, 0xFF, 0x81, 0xFF, 0x80, 0x1F, 0xFC, 0x0F, 0xFC, 0x00, 0x6A,
-    0x90, 0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0xBC, 0x2F, 0xC0, 0xFD,
-    0x0F, 0xE3, 0xF4, 0x1F, 0xC0, 0xFD, 0x3F, 0x02, 0xF4, 0x1F, 0x8B, 0xD0, 0x3F, 0x03, 0xF0, 0x78,
-    0x03, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xBF, 0x07, 0xF0, 0x3F, 0x41,
-    0xF8, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x2F, 0x07, 0xF1, 0xFC, 0x0F, 0xD3, 0xF8, 0x2F,
-    0x87, 0xF0, 0x3F, 0x0F, 0xC0, 0x7C, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x07, 0xD0, 0x2F, 0x03, 0xF4, 0x3F, 0x81, 0xFC, 0x0B, 0xF0, 0x7F, 0x03, 0xF8, 0x0F, 0xC0, 0xFD,
-    0x07, 0xF0, 0x2F, 0x41, 0xF8, 0x0F, 0xC0, 0x3D, 0x02, 0xD0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x0F,
-    0xF8, 0xFF, 0xC0, 0xAA, 0x81, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x07, 0xC0, 0x03,
-    0xF8, 0x01, 0xFE, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x0B, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x00,
-    0x0F, 0xF4, 0x00, 0x3F, 0x00, 0x01, 0xE0, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x02,
-    0xE0, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xFC,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0x4B, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x55,
-    0x5F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF7, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x03, 0xFD, 0x7F, 0xFF, 0xF4, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x0F,
-    0xFF, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xC7, 0xFF, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xF7,
-    0xFF, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0x15, 0x6F, 0xFF, 0xFF, 0xC0, 0x05, 0x54, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xEB, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD1, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFF, 0xEF, 0xF0, 0x00, 0x1F, 0xFF, 0xC3, 0xF8, 0x00, 0x0A, 0x3F, 0x83, 0xF8, 0x00, 0x00, 0x7F,
-    0x43, 0xF8, 0x00, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x07, 0xF4, 0x00, 0x00, 0xFE, 0x0B,
-    0xF0, 0x00, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x7F, 0xC0, 0x00, 0x03, 0xFE, 0xFF, 0x40,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE2, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xF4, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x11, 0xE1,
-    0x40, 0x00, 0x0B, 0xAE, 0xB8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFB, 0xE0, 0x00, 0x00, 0x8F, 0x4A, 0x80, 0x00, 0x78, 0xF4, 0xB8,
-    0x50, 0x8B, 0x5F, 0xEF, 0xBD, 0x3F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xE0, 0xBF, 0xC0, 0x0B, 0xFD,
-    0x2F, 0xFF, 0x8B, 0xFF, 0xFF, 0xFE, 0xF8, 0xB7, 0xCB, 0x63, 0xC1, 0x00, 0x3C, 0x00, 0x38, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE,
-    0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xE4, 0x2F, 0xD0, 0xFF, 0xD4, 0x7F, 0x80, 0x03,
-    0xD0, 0x00, 0xFE, 0x0B, 0x80, 0x02, 0xFC, 0x00, 0x10, 0x00, 0x0F, 0xE0, 0x10, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x02, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00,
-    0x01, 0xE0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBD, 0x00, 0xFF, 0xE4, 0x3F, 0xC0, 0x00, 0x3F,
-    0x00, 0x0F, 0x40, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x1B,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xC2, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xF5, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xEF, 0x40, 0x07, 0xF0, 0x00, 0x00,
-    0x0F, 0xC4, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x03, 0xFC, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xF8,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x1F,
-    0xFE, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x55, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xF1, 0xC0, 0xB0, 0x34, 0x3D, 0xDD, 0x1E, 0xFB, 0x0B, 0x7B,
-    0xC2, 0xD2, 0xE0, 0xBF, 0xF0, 0x1F, 0xF4, 0x01, 0xA0, 0x00, 0x00, 0x08, 0x00, 0x3C, 0x00, 0xFC,
-    0x03, 0xB8, 0x0D, 0x74, 0x3D, 0xF8, 0xFF, 0xFC, 0x02, 0xE0, 0x03, 0xD0, 0x01, 0xAA, 0x40, 0xFF,
-    0xD0, 0x70, 0x00, 0x2C, 0x00, 0x0F, 0xF8, 0x03, 0xAF, 0x40, 0x01, 0xE0, 0x91, 0xF4, 0x3F, 0xFC,
-    0x1F, 0xFC, 0x01, 0x54, 0x00, 0x00, 0x2A, 0x80, 0x7F, 0xE0, 0x78, 0x00, 0x3D, 0x90, 0x1F, 0xFD,
-    0x0B, 0xC7, 0xC3, 0xC0, 0xE0, 0xF0, 0xB4, 0x3F, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x6A, 0xBC, 0x00, 0x78, 0x00, 0xF0, 0x02, 0xF0, 0x03, 0xD0, 0x0B, 0xC0, 0x0F, 0x80, 0x3F, 0x00,
-    0x2A, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x78, 0x74, 0x2C, 0x2C, 0x07, 0xFD, 0x02, 0xEF, 0x43,
-    0xC0, 0xE0, 0xF0, 0xB8, 0x3F, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xFF, 0x80,
-    0xF0, 0xB0, 0x70, 0x1C, 0x2C, 0x0F, 0x0B, 0xFF, 0xC0, 0xBF, 0xE0, 0x00, 0xF0, 0x7F, 0xF8, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xBF, 0x80, 0x00, 0x2F, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xF4, 0x7F, 0x80, 0x0B, 0xF8, 0x01, 0xF8, 0x00,
-    0xFF, 0x00, 0x2F, 0x80, 0x1F, 0xD0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x0B,
-    0xF0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x0F, 0xF4, 0x02, 0xFE, 0x01, 0xFF,
-    0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x7E, 0x00, 0x2D,
-    0x38, 0x07, 0x83, 0x80, 0xB7, 0x38, 0x0F, 0xB7, 0x81, 0xE6, 0xB4, 0x1E, 0x1F, 0x02, 0xFF, 0xE0,
-    0x1F, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x68, 0x0F, 0xE0, 0x3F, 0x40, 0x3C, 0x01, 0xF0, 0x0B, 0x80,
-    0x3C, 0x00, 0xF0, 0x7F, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x7F, 0xF4, 0x06, 0x07,
-    0x80, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x07, 0xE0, 0x02, 0xF8, 0x01, 0xFE, 0x00, 0x3F, 0xFD, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x3F, 0xF4, 0x01, 0x03, 0x80, 0x00, 0x74, 0x02,
-    0xFD, 0x00, 0x2B, 0xE0, 0x00, 0x1E, 0x02, 0xEB, 0xE0, 0x3F, 0xFC, 0x07, 0xFE, 0x00, 0x00, 0x02,
-    0x40, 0x03, 0xC0, 0x03, 0xF0, 0x03, 0x7C, 0x03, 0x9E, 0x03, 0xDB, 0x83, 0xFF, 0xF4, 0x56, 0xF8,
-    0x00, 0xB8, 0x00, 0x3E, 0x00, 0x01, 0x55, 0x40, 0xFF, 0xD0, 0x74, 0x00, 0x2C, 0x00, 0x0F, 0xF8,
-    0x02, 0xAF, 0x40, 0x01, 0xE0, 0xA6, 0xF0, 0x3F, 0xF8, 0x0F, 0xF4, 0x00, 0x00, 0x2A, 0x80, 0x1F,
-    0xFC, 0x07, 0x80, 0x00, 0xF6, 0x40, 0x1F, 0xFE, 0x02, 0xF0, 0xF0, 0x3D, 0x0F, 0x03, 0xC2, 0xE0,
-    0x2F, 0xFC, 0x00, 0xFE, 0x00, 0x2A, 0xA9, 0x7F, 0xFD, 0x00, 0x3C, 0x00, 0xB4, 0x00, 0xF0, 0x03,
-    0xE0, 0x07, 0xC0, 0x0F, 0xC0, 0x1F, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x2E, 0x7C,
-    0x03, 0x83, 0xC0, 0x78, 0x78, 0x02, 0xFF, 0x00, 0x7F, 0xF0, 0x1E, 0x0B, 0x03, 0xD1, 0xF0, 0x3F,
-    0xFE, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1F, 0xF4, 0x07, 0x43, 0x80, 0xE0,
-    0x3C, 0x0D, 0x0B, 0x80, 0xFF, 0xF4, 0x07, 0xFF, 0x00, 0x01, 0xE0, 0x3F, 0xFC, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x1B, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xB8, 0x00, 0x00, 0x00, 0x0F,
-    0xC7, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0x47, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0xF8, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xC7, 0xD0,
-    0x00, 0x07, 0xFF, 0xBD, 0x3F, 0x00, 0x00, 0x3F, 0xF7, 0xF1, 0xF4, 0x00, 0x02, 0xFF, 0x9F, 0x4F,
-    0xC0, 0x00, 0x0F, 0xFD, 0xBC, 0x3D, 0x00, 0x00, 0x7F, 0xF3, 0xE2, 0xF0, 0x00, 0x02, 0xFF, 0xAF,
-    0x0F, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0xBC, 0x00, 0x00, 0x3F, 0xFF, 0xC3, 0xE0, 0x00, 0x00, 0xFF,
-    0xFF, 0x2F, 0xAD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x29, 0x1A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x7F, 0xFF, 0xFB, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x0B, 0xEF, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0xBF, 0xF0, 0x0F, 0xFA,
-    0x80, 0x0F, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x0F, 0xFF, 0xD7, 0xF6,
-    0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x1F, 0xC0,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x6A, 0xFF, 0xAA, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x94, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x0A, 0xAA, 0xAA, 0xAA, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xC0, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x2A, 0xAF, 0xFE, 0xBF, 0xEF, 0xFA, 0xA4, 0x00,
-    0x07, 0xFF, 0x1F, 0xF7, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x7F, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x07, 0xF4, 0x02, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xE0, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xE5, 0xAF, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0xFC, 0x00,
-    0x01, 0xFF, 0x80, 0x0B, 0xC0, 0x7F, 0x40, 0x00, 0x7F, 0xFD, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F,
-    0x96, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0x00,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xFE, 0x6F, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x3F, 0x80, 0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0xBF,
-    0x41, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xF0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0xFF, 0x03,
-    0xFD, 0x00, 0x07, 0x42, 0xFD, 0x1F, 0xF0, 0x3F, 0xD0, 0x01, 0xFF, 0xFF, 0xC2, 0xFF, 0x03, 0xFE,
-    0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xE0, 0x7F, 0xE0, 0x03, 0xFF, 0xFE, 0x01, 0x54, 0x01, 0x54, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F,
-    0x00, 0x0B, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x00,
-    0x3F, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x41,
-    0xF0, 0x3F, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xAF,
-    0xFF, 0xFF, 0xBF, 0xEA, 0x40, 0x3F, 0x4F, 0xF4, 0xFC, 0x00, 0x00, 0xFD, 0xBF, 0xE7, 0xE0, 0x00,
-    0x03, 0xF7, 0xFF, 0xAF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xF3, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x83, 0xFD, 0x00, 0x00, 0x03, 0xFC,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3A, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFC, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0x2F, 0x02, 0xF4, 0x03, 0xF0,
-    0x00, 0x2F, 0x03, 0xF0, 0x03, 0xF1, 0x94, 0x3F, 0x07, 0xF0, 0x07, 0xE2, 0xF8, 0x3E, 0x0B, 0xE0,
-    0x0B, 0xD3, 0xF4, 0x7D, 0x0F, 0xD0, 0x0F, 0xC3, 0xF0, 0xBD, 0x0F, 0xC0, 0x0F, 0x87, 0xF0, 0xAC,
-    0x2F, 0xC0, 0x1F, 0x47, 0xF0, 0x00, 0x3F, 0x80, 0x2F, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0x0B,
-    0xF8, 0x01, 0xFF, 0x00, 0x3E, 0x07, 0xFF, 0xAF, 0xFE, 0x00, 0x7D, 0x02, 0xFF, 0xFF, 0xFD, 0x00,
-    0x14, 0x00, 0x6F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x56, 0xF9, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F,
-    0x9F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFC,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0xBC,
-    0x01, 0xFD, 0x00, 0x00, 0x0B, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x6F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x50, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x54, 0x00, 0x01, 0xFF, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xAA, 0x80, 0x00, 0x05, 0x55, 0x55,
-    0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x04, 0x00, 0x00, 0x03, 0xFE, 0xBC, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x7F, 0xF2, 0xC0, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x06, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xF9, 0x6B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xF4, 0x1A, 0x40,
-    0x0F, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0x42, 0xF8, 0x00,
-    0x00, 0x1F, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0xF8, 0x07, 0xFF, 0xFA, 0x40, 0xBF, 0xD0, 0x2F, 0xFF, 0xFF, 0x82, 0xFF, 0x40,
-    0xFF, 0xFF, 0xFE, 0x0F, 0xFD, 0x03, 0xFB, 0xFF, 0xF4, 0x3F, 0xF4, 0x0F, 0xC1, 0xFF, 0x90, 0xFF,
-    0xF0, 0x7E, 0x0F, 0xF4, 0x02, 0xFF, 0xFF, 0xFE, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x06, 0xFF, 0xF9, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x01, 0xFF, 0xFD, 0x50,
-    0x3F, 0xDF, 0xC0, 0x07, 0xF5, 0xF8, 0x00, 0xFF, 0x2F, 0x40, 0x0F, 0xE3, 0xF0, 0x01, 0xFD, 0x3F,
-    0x00, 0x2F, 0xD7, 0xE0, 0x02, 0xFF, 0xBE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x07,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x40,
-    0xBF, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE1, 0xB4, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-    0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0x90, 0x0F, 0xFF, 0xF4, 0x40, 0x0F, 0xFF, 0x5B, 0xC0, 0x1F,
-    0xFF, 0xFF, 0x80, 0x11, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xF9, 0xA9, 0x3F, 0xFE, 0x41, 0xFD, 0x7F,
-    0xFC, 0x0B, 0xF8, 0xA5, 0xF8, 0x7F, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xBF,
-    0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0x7F, 0x00, 0x02, 0xFE, 0xFC, 0x7F, 0x00, 0x03, 0xFC, 0xFC,
-    0x7F, 0x00, 0x03, 0xF5, 0xF8, 0xBE, 0x00, 0x07, 0xF2, 0xF4, 0xFD, 0x00, 0x0B, 0xE3, 0xF0, 0xFC,
-    0x00, 0x0F, 0xD3, 0xF1, 0xFC, 0x00, 0x0F, 0xC7, 0xF2, 0xF8, 0x00, 0x1F, 0xCB, 0xE3, 0xF4, 0x00,
-    0x2F, 0xCF, 0xD7, 0xF0, 0x00, 0x3F, 0xCF, 0xCB, 0xF0, 0x00, 0x3F, 0x9F, 0xCF, 0xE0, 0x00, 0x01,
-    0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07,
-    0xF4, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x7F, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE5, 0xAF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x1B, 0xE0, 0x3F, 0x81, 0xBF, 0xF8, 0x1F, 0xEF, 0xFF, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xE4, 0x0F, 0xFF, 0xFE, 0x40, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x2F, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFE, 0xFF, 0x03, 0xFF, 0x2F, 0x8F, 0xFC, 0x7F,
-    0x83, 0xF4, 0x3F, 0x42, 0xC0, 0x3F, 0x00, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x07, 0xE4, 0x00, 0xFD, 0x00, 0x7F, 0xFE, 0x47, 0xF0, 0x07, 0xFF, 0xFF, 0xBF, 0xC0,
-    0x06, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xF0, 0x00, 0x00, 0x1B, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x40, 0x7F, 0x00,
-    0x00, 0x3E, 0x03, 0xF4, 0x1E, 0x07, 0xFD, 0x2F, 0x83, 0xFC, 0x1F, 0xF9, 0xFC, 0xFF, 0x80, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x01, 0xBF, 0x90, 0x1F,
-    0x80, 0x03, 0xF1, 0xBF, 0xFF, 0xFE, 0x4B, 0xD0, 0x07, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xF9, 0x00, 0x1B, 0xFF, 0xF8, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x81, 0xFE, 0x7D,
-    0xBF, 0x4F, 0xC2, 0xF0, 0xBC, 0x18, 0x0F, 0xC0, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x2D, 0x0F, 0xC0, 0xD0, 0xFE, 0x2F, 0x0F, 0xD0, 0xBF, 0xBE, 0xFF, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x16, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x94,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFE, 0x2F,
-    0xFE, 0x00, 0x3F, 0x80, 0xBF, 0xF8, 0x0F, 0xE0, 0x07, 0xFF, 0xC3, 0xF8, 0x00, 0x1F, 0xE0, 0xF9,
-    0x00, 0x00, 0xA0, 0x02, 0x94, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x6B, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
-    0xF0, 0x07, 0xFF, 0xD3, 0xF8, 0x0B, 0xFF, 0x40, 0xFE, 0x1F, 0xFE, 0x00, 0x3F, 0x83, 0xFC, 0x00,
-    0x0F, 0xE0, 0x34, 0x00, 0x02, 0xF4, 0x02, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0xFD, 0x00, 0xA4, 0x0B, 0xF0, 0x0F, 0xC0, 0x3F, 0x41, 0xF8, 0x02, 0xFC, 0x2F, 0x40, 0x0F,
-    0xD3, 0xF0, 0x00, 0xBF, 0x3F, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x2F, 0xFD, 0x01, 0x00, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xF4, 0x01, 0x6B, 0xFF, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x41, 0xA0, 0x0B, 0xF0,
-    0x3F, 0x00, 0xFD, 0x02, 0xF0, 0x1F, 0xC0, 0x1F, 0x43, 0xF8, 0x00, 0xF8, 0x7F, 0x00, 0x0F, 0xCF,
-    0xE0, 0x00, 0xBE, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x04, 0x03, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xFE, 0x94, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xAA,
-    0xA0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x7F, 0xFA, 0xAA, 0xAA, 0xA8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0xB5, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0xF3, 0xFC, 0x00, 0x00, 0x07,
-    0xFE, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xD7, 0xFF, 0x40, 0x00, 0xBF, 0xFC, 0xBF, 0xFD, 0x00, 0x3F,
-    0xEF, 0x8F, 0xEF, 0xF0, 0x1F, 0xF5, 0xF4, 0xFC, 0xFF, 0xC3, 0xFD, 0x2F, 0x1F, 0x83, 0xFC, 0x3F,
-    0x03, 0xF2, 0xF4, 0x1E, 0x00, 0x80, 0x3E, 0x3F, 0x00, 0x40, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00,
-    0x00, 0xBC, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0x5F, 0x80, 0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x6A, 0xAA, 0xAA, 0xBF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xAA, 0xAA, 0xAA, 0xBF, 0xE0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x5F, 0x80, 0x00,
-    0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x7D, 0x00,
-    0x00, 0x18, 0x07, 0xD3, 0xE0, 0x04, 0x03, 0xE0, 0x3E, 0x3F, 0x02, 0xE0, 0x7F, 0xC3, 0xF2, 0xF4,
-    0x7F, 0x81, 0xFF, 0x5F, 0x1F, 0x8F, 0xF4, 0x07, 0xFE, 0xF4, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x8F,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xD7, 0xFD, 0x00, 0x00, 0x01, 0xFE,
-    0x3F, 0x80, 0x00, 0x00, 0x03, 0xF3, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xFA, 0xAA, 0xAA, 0xAA, 0xFD,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x7F, 0xFA, 0xAA, 0xAA, 0xAA, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0xBF, 0x7F, 0xFF, 0xD0, 0x1F,
-    0xF3, 0xEB, 0xF8, 0x0B, 0xFF, 0x3E, 0x0A, 0x02, 0xFF, 0xF3, 0xE0, 0x00, 0x3F, 0xFF, 0x3E, 0x00,
-    0x00, 0x76, 0xF3, 0xE0, 0x00, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0x2F,
-    0x3E, 0x00, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0xBA, 0xF3, 0xE0, 0x00,
-    0x3F, 0xFF, 0x3E, 0x00, 0x02, 0xFF, 0xF3, 0xE0, 0x00, 0x07, 0xFF, 0x3E, 0x1F, 0x00, 0x1F, 0xF3,
-    0xFF, 0xFC, 0x00, 0x7F, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0x90, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x02, 0xBF, 0x47, 0xF0, 0x00, 0x2F, 0xFF, 0xDB, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0x97, 0xFF, 0xC0, 0x03, 0xFD, 0x02, 0xFF, 0x40, 0x0B, 0xF4, 0x01, 0xFF, 0x00, 0x0F,
-    0xF0, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xF8, 0x00, 0x1F, 0xFE,
-    0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFA, 0xBF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xFE,
-    0x00, 0xBF, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x0B, 0xF8, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0xBF, 0x83,
-    0xFD, 0x00, 0x0B, 0xFC, 0x0B, 0xF8, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0xBF, 0x80, 0x7F, 0xC0, 0x01,
-    0xFF, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0xBF, 0xC0, 0x0F, 0xF8, 0x00, 0x2F, 0xF7, 0xFC,
-    0x00, 0x3F, 0xD0, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x2F, 0xF8,
-    0x00, 0x0F, 0xFF, 0xD4, 0x5B, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0x81, 0xBF, 0xFF, 0x90, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xDF, 0xF0, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00,
-    0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x2F, 0xF0, 0x0F, 0xFC, 0x00, 0x7F,
-    0xD0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x0B, 0xFD, 0x00,
-    0x07, 0xFE, 0x1F, 0xF8, 0x00, 0x07, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF,
-    0x00, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x7F, 0x40, 0xFF,
-    0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x01,
-    0xFD, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x01, 0xFE, 0x02,
-    0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x00, 0xFE, 0x01, 0xFD, 0x00,
-    0x07, 0xF4, 0x0B, 0xF0, 0x00, 0x1A, 0x80, 0x2A, 0x80, 0x00, 0x3F, 0xC0, 0x3F, 0x40, 0x00, 0x2F,
-    0xC0, 0x3F, 0xC0, 0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x1F, 0xD0, 0x00, 0x0F, 0xF0,
-    0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x07,
-    0xF4, 0x00, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x02, 0xFC,
-    0x00, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0x00,
-    0x00, 0x3F, 0x80, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x15, 0x6A, 0x80, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xD7, 0xFF, 0xEA,
-    0xA9, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xF0,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x64, 0x00, 0x69, 0x00, 0x00, 0x7F, 0xFE, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0xFE,
-    0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x07, 0xFF, 0x43, 0xF0, 0x2F, 0xC0,
-    0x03, 0xE0, 0x0B, 0xC0, 0xFC, 0x00, 0x0F, 0x00, 0x2F, 0x07, 0xF0, 0x00, 0xB8, 0x00, 0xFC, 0x2F,
-    0xC0, 0x1B, 0xF4, 0x1F, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0xFF, 0xF8, 0x00, 0x01, 0x69, 0x00, 0xBE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x90, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xFD, 0x01, 0xFF, 0xC0, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x0F, 0xF8, 0x01, 0xFF, 0x80, 0x3F, 0xF4, 0x07, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x68, 0x00, 0xBF, 0xFD, 0x0F, 0xF0, 0x2F, 0xEB, 0xF1, 0xFD, 0x03,
-    0xFC, 0x3F, 0xFF, 0xC0, 0x3F, 0x81, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x68, 0x00, 0xBF, 0xFD, 0x0B, 0xF0, 0x1F, 0xEB, 0xF1, 0xFE, 0x03, 0xFC,
-    0x3F, 0xFF, 0xC0, 0x2F, 0x80, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x05, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x55, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1B, 0xFF, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0xFF, 0xA5, 0x00, 0x01,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE9, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x6B,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x56, 0xBC, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xE4, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x05, 0xAF, 0xFD, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFF, 0xA9, 0x40, 0x00, 0x7A, 0x94, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_12_bolditalicBitmaps[41441] = {
+    0x77, 0x70, 0xA9, 0x73, 0xD7, 0x29, 0xDA, 0x71, 0xAD, 0xA7, 0x1E, 0x71, 0x9E, 0x71, 0xEA, 0x71,
+    0xE9, 0x70, 0xAE, 0x71, 0xF7, 0x1E, 0xA7, 0x0A, 0xE7, 0x1F, 0x70, 0x9E, 0xA7, 0x0A, 0xE9, 0x70,
+    0xF7, 0x19, 0xE7, 0x29, 0xC9, 0x73, 0x97, 0x77, 0x77, 0x77, 0x77, 0x5A, 0xF7, 0x0F, 0xC7, 0xAF,
+    0xA7, 0xFC, 0xA6, 0xAF, 0xC9, 0x6F, 0xD9, 0x59, 0xFD, 0x60, 0x9F, 0xCA, 0x1F, 0xD2, 0xFC, 0x91,
+    0xFC, 0xA2, 0xFC, 0x91, 0xAF, 0xA2, 0xAF, 0x91, 0x9F, 0xA2, 0x9F, 0xA2, 0xFA, 0x3F, 0xC2, 0xFC,
+    0x3F, 0xC2, 0xFC, 0x92, 0xAF, 0xA1, 0xAF, 0xA2, 0x9A, 0xAA, 0xA9, 0x2A, 0xAA, 0xAA, 0x00, 0x74,
+    0x9E, 0x3E, 0x97, 0x72, 0xEA, 0x29, 0xE7, 0x72, 0x9E, 0x3E, 0xA7, 0x72, 0xF2, 0x9E, 0x97, 0x72,
+    0xEA, 0x2A, 0xE7, 0x72, 0xAE, 0x3E, 0xA7, 0x4A, 0xFF, 0xFF, 0xFF, 0x49, 0xFF, 0xFF, 0xFF, 0x5F,
+    0xFF, 0xFF, 0xFA, 0x59, 0x99, 0x99, 0xAF, 0x99, 0x9F, 0xA9, 0x99, 0x99, 0x97, 0x3A, 0xE9, 0x2F,
+    0x77, 0x2F, 0x2A, 0xE9, 0x77, 0x1A, 0xEA, 0x2F, 0x77, 0x2F, 0x29, 0xEA, 0x74, 0x9F, 0xFF, 0xFF,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x94, 0xAF, 0xFF, 0xFF, 0xF5, 0x99, 0x99, 0x9F, 0xC9, 0x9A, 0xFA, 0x99,
+    0x99, 0x99, 0x73, 0xF9, 0x19, 0xF7, 0x71, 0xAF, 0x2F, 0xA7, 0x71, 0xFC, 0x2F, 0x97, 0x70, 0x9F,
+    0x91, 0xAF, 0x77, 0x19, 0xAA, 0xAA, 0x29, 0xAA, 0xA9, 0x75, 0x77, 0x77, 0x7E, 0x77, 0x29, 0xDA,
+    0x77, 0x2A, 0xD9, 0x77, 0x19, 0xE9, 0x74, 0x9A, 0xFF, 0xCA, 0x71, 0xFF, 0xF7, 0x09, 0xFF, 0xF9,
+    0x70, 0xFD, 0x90, 0xEA, 0x97, 0x0A, 0xF9, 0x2E, 0x72, 0xF9, 0x29, 0xE7, 0x2F, 0x92, 0xAD, 0xA7,
+    0x19, 0xFC, 0xA9, 0x0E, 0x97, 0x2F, 0xFE, 0x73, 0xAF, 0xFE, 0x97, 0x2A, 0xFF, 0xEA, 0x73, 0x9A,
+    0xFF, 0xCA, 0x76, 0xFF, 0x76, 0xFF, 0x5A, 0xA5, 0x9F, 0xF4, 0xAF, 0x92, 0xAF, 0xEA, 0x3F, 0xFF,
+    0xFD, 0x3F, 0xFF, 0xFD, 0x39, 0xAF, 0xFF, 0xE9, 0x79, 0xAF, 0xFC, 0xA7, 0x72, 0xE7, 0x73, 0xE7,
+    0x72, 0x9E, 0x77, 0x2A, 0xDA, 0x77, 0x77, 0x77, 0x39, 0x97, 0x73, 0xE7, 0x72, 0xE6, 0xAD, 0xA7,
+    0xE9, 0x49, 0xFD, 0x5E, 0x95, 0xD9, 0x1D, 0x93, 0xAD, 0xA5, 0xAC, 0xA2, 0xD9, 0x2A, 0xE6, 0xD3,
+    0xD2, 0x9E, 0x7D, 0x91, 0xAD, 0x19, 0xE7, 0x0F, 0xE9, 0x09, 0xE9, 0x70, 0xAF, 0xCA, 0x1E, 0x97,
+    0x2A, 0xDA, 0x91, 0xEA, 0x77, 0x1F, 0x09, 0xAD, 0xA7, 0x3A, 0xE0, 0xAF, 0xD7, 0x1A, 0xE0, 0x9D,
+    0x2D, 0x70, 0xAE, 0x90, 0xD9, 0x2D, 0x79, 0xE9, 0x1D, 0x29, 0xD6, 0x9E, 0xA1, 0x9D, 0x19, 0xDA,
+    0x6F, 0x29, 0xFE, 0x6F, 0x4F, 0xD9, 0x5F, 0x6A, 0xDA, 0x6F, 0x97, 0x70, 0x69, 0xAD, 0xA9, 0x72,
+    0x9F, 0xF7, 0x09, 0xE9, 0x19, 0xDA, 0x7E, 0x49, 0xD6, 0x9D, 0x59, 0xD6, 0xAD, 0x5E, 0x6A, 0xD9,
+    0x3E, 0xA7, 0xE1, 0xAF, 0x70, 0xAF, 0xF7, 0x2F, 0xDA, 0x71, 0x9F, 0xD7, 0x29, 0xFE, 0x93, 0xAA,
+    0x91, 0x9F, 0x99, 0xE9, 0x2E, 0x90, 0xF9, 0x19, 0xE9, 0x0A, 0xE0, 0x9F, 0x3A, 0xEA, 0xEA, 0x09,
+    0xF4, 0xAF, 0xD1, 0xAF, 0xC9, 0x99, 0xAF, 0xD2, 0x9F, 0xFF, 0xE9, 0x2F, 0xFF, 0xE9, 0x29, 0xFF,
+    0xD9, 0x9C, 0x95, 0xAF, 0xAA, 0x97, 0x77, 0x20, 0x0A, 0xAA, 0xAA, 0x91, 0xFC, 0xA1, 0xFC, 0x91,
+    0xFC, 0x91, 0xAF, 0x91, 0x9F, 0xC2, 0xFC, 0x2F, 0xC9, 0x1A, 0xFA, 0x74, 0xAC, 0xA9, 0x74, 0xAE,
+    0x97, 0x3A, 0xEA, 0x73, 0xAE, 0xA7, 0x39, 0xF7, 0x4F, 0x74, 0xF9, 0x73, 0x9E, 0xA7, 0x4F, 0x74,
+    0xAE, 0x97, 0x39, 0xEA, 0x74, 0xF7, 0x49, 0xEA, 0x74, 0xAE, 0x75, 0xEA, 0x74, 0x9E, 0x97, 0x4F,
+    0x75, 0xEA, 0x74, 0x9E, 0xA7, 0x4A, 0xE9, 0x74, 0xAE, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75,
+    0xF7, 0x5F, 0x97, 0x4F, 0x97, 0x4A, 0xEA, 0x74, 0xAF, 0x74, 0x9F, 0x75, 0xF9, 0x74, 0xFC, 0x74,
+    0x9F, 0x77, 0x09, 0x71, 0x09, 0xAC, 0xA7, 0x4A, 0xEA, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x4F, 0x97,
+    0x4F, 0x74, 0x9E, 0xA7, 0x4A, 0xE9, 0x74, 0xF7, 0x49, 0xEA, 0x74, 0xF7, 0x5E, 0xA7, 0x4A, 0xE7,
+    0x5E, 0xA7, 0x4F, 0x74, 0x9E, 0x97, 0x4E, 0xA7, 0x4F, 0x74, 0xAE, 0x74, 0x9E, 0x97, 0x39, 0xEA,
+    0x74, 0xEA, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x73, 0x9E, 0xA7, 0x3A, 0xEA, 0x73, 0xFA, 0x73,
+    0xF9, 0x72, 0x9F, 0x73, 0xAF, 0x73, 0xFA, 0x73, 0xF9, 0x73, 0x95, 0x69, 0xAA, 0x73, 0xE7, 0xA1,
+    0x9E, 0x1A, 0xC9, 0x1E, 0x99, 0xDA, 0x9E, 0x1A, 0xFF, 0xF1, 0x9F, 0xFD, 0x95, 0xFD, 0xA5, 0x9F,
+    0xFC, 0x91, 0x9F, 0xFF, 0xA0, 0x9E, 0xAE, 0x9E, 0xA2, 0xD9, 0x0E, 0x1A, 0xA3, 0x91, 0x9E, 0x72,
+    0xAC, 0xA9, 0x77, 0x50, 0x77, 0x6E, 0x72, 0x9E, 0x72, 0xAD, 0xA7, 0x2E, 0x97, 0x19, 0xE9, 0x4A,
+    0xFF, 0xF9, 0x0F, 0xFF, 0xC1, 0xFF, 0xFA, 0x59, 0xE7, 0x2A, 0xE7, 0x2E, 0xA7, 0x2E, 0x97, 0x19,
+    0xE6, 0x39, 0xFC, 0xA3, 0xAF, 0xC4, 0xFC, 0xA4, 0xFC, 0x4A, 0xF9, 0x4F, 0xC4, 0xFC, 0x93, 0xAF,
+    0xA4, 0xAA, 0xAA, 0xA4, 0x0F, 0xFF, 0x99, 0xFF, 0xF0, 0xAF, 0xFF, 0x00, 0x29, 0x99, 0x91, 0x9E,
+    0xA1, 0xF9, 0x09, 0xF9, 0x0F, 0xC0, 0x9F, 0xC0, 0x77, 0x72, 0x97, 0x77, 0x19, 0xD7, 0x77, 0x0E,
+    0x77, 0x70, 0xAD, 0xA7, 0x77, 0x9E, 0x77, 0x70, 0xEA, 0x77, 0x79, 0xE7, 0x77, 0x0E, 0xA7, 0x77,
+    0xAE, 0x77, 0x70, 0xE9, 0x77, 0x7A, 0xE7, 0x77, 0x0E, 0x97, 0x77, 0xF7, 0x77, 0x9E, 0x97, 0x77,
+    0xEA, 0x77, 0x79, 0xE7, 0x77, 0x0E, 0xA7, 0x77, 0xAE, 0x77, 0x70, 0xEA, 0x77, 0x7A, 0xE7, 0x77,
+    0x9E, 0x97, 0x77, 0xF7, 0x77, 0x9E, 0x97, 0x77, 0xF7, 0x77, 0xAE, 0x97, 0x77, 0xEA, 0x77, 0x7A,
+    0xE7, 0x77, 0x9E, 0xA7, 0x77, 0xF7, 0x77, 0x9E, 0xA7, 0x77, 0xF7, 0x77, 0xAE, 0x97, 0x77, 0xF7,
+    0x77, 0xAE, 0x97, 0x77, 0xF7, 0x77, 0xF9, 0x77, 0x69, 0xF7, 0x77, 0xF7, 0x77, 0xAE, 0xA7, 0x77,
+    0xEA, 0x77, 0x7A, 0xD7, 0x77, 0x1C, 0x97, 0x77, 0x19, 0x77, 0x72, 0x73, 0x97, 0x59, 0xFD, 0x72,
+    0xFF, 0xC7, 0x0F, 0x91, 0xAD, 0xA6, 0xAE, 0x4E, 0x59, 0xE9, 0x4E, 0x5F, 0x09, 0xC9, 0x1E, 0x49,
+    0xEA, 0x9E, 0x09, 0xE4, 0xAE, 0x0A, 0xE0, 0xAE, 0x4F, 0x0F, 0x0F, 0x39, 0xEA, 0x0E, 0xA9, 0xEA,
+    0x3A, 0xE9, 0x0E, 0x0A, 0xE9, 0x3F, 0x90, 0x9A, 0x09, 0xF4, 0xF9, 0x3F, 0xA4, 0xFC, 0x2F, 0xC5,
+    0xFF, 0xFC, 0x5F, 0xFF, 0x6A, 0xFF, 0xDA, 0x69, 0xFF, 0xCA, 0x70, 0xAF, 0xEA, 0x72, 0x9F, 0xA7,
+    0x00, 0x79, 0xAD, 0xA6, 0x9F, 0xCA, 0x59, 0xFD, 0x95, 0xAF, 0xD6, 0xD9, 0xEA, 0x59, 0x90, 0x9E,
+    0x97, 0x0A, 0xE7, 0x1F, 0x70, 0x9E, 0xA7, 0x0A, 0xE9, 0x70, 0xF7, 0x09, 0xF7, 0x0A, 0xEA, 0x70,
+    0xF9, 0x79, 0xF9, 0x4F, 0xFF, 0x1F, 0xFE, 0xA0, 0x9F, 0xFE, 0x90, 0xFF, 0xF1, 0x71, 0x99, 0x97,
+    0x29, 0xFE, 0xA7, 0xFF, 0xE6, 0xFF, 0xE9, 0x49, 0xE9, 0x2A, 0xEA, 0x4A, 0xA6, 0xF7, 0x5E, 0xA7,
+    0x4A, 0xEA, 0x73, 0x9F, 0x73, 0x9F, 0xA7, 0x29, 0xFC, 0x72, 0xFD, 0x71, 0xAF, 0xD9, 0x79, 0xFE,
+    0x97, 0xAF, 0xE9, 0x7A, 0xFE, 0x97, 0x9F, 0xFF, 0x4F, 0xFF, 0xC4, 0xFF, 0xFC, 0x3A, 0xFF, 0xFA,
+    0x30, 0x59, 0x9A, 0xFA, 0x71, 0xFF, 0xCA, 0x6A, 0xFF, 0xD9, 0x5C, 0xA9, 0x4A, 0xDA, 0x75, 0x9E,
+    0x75, 0x9D, 0xA7, 0x5E, 0x97, 0x39, 0xF7, 0xAF, 0xF9, 0x7F, 0xF7, 0x0A, 0xFF, 0x97, 0x99, 0x99,
+    0x9F, 0xC7, 0x5F, 0x75, 0xF4, 0x9C, 0x93, 0x9F, 0xC4, 0xFF, 0xF9, 0x39, 0xFF, 0xF4, 0xFF, 0xF9,
+    0x39, 0xFF, 0xE9, 0x6A, 0xFD, 0xA9, 0x60, 0x73, 0x9A, 0xC9, 0x72, 0x9E, 0x97, 0x19, 0xF7, 0x19,
+    0xFC, 0x70, 0x9F, 0xCA, 0x79, 0xDA, 0xE9, 0x69, 0xDA, 0x9E, 0x69, 0xDA, 0x0A, 0xE5, 0x9E, 0x1F,
+    0x49, 0xE2, 0xEA, 0x39, 0xE2, 0xAE, 0x92, 0x9F, 0xFF, 0xC9, 0x0F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD1,
+    0x99, 0x99, 0x9A, 0xAF, 0xCA, 0x97, 0x0F, 0x97, 0x19, 0xF7, 0x2F, 0xC7, 0x2F, 0xA7, 0x73, 0x77,
+    0x59, 0xFF, 0xE4, 0xAF, 0xFD, 0xA4, 0xFF, 0xE9, 0x4E, 0x74, 0x9E, 0x74, 0xEA, 0x74, 0xE7, 0x49,
+    0xFD, 0xAA, 0x7A, 0xFF, 0xC9, 0x5F, 0xFE, 0x94, 0xAA, 0xA9, 0x99, 0x9A, 0xF7, 0x4F, 0x73, 0x9F,
+    0x39, 0x6F, 0xA3, 0xD9, 0x29, 0xFC, 0x39, 0xFF, 0xF3, 0xFF, 0xF3, 0x9F, 0xFE, 0x4A, 0xFF, 0xCA,
+    0x69, 0xAF, 0xAA, 0x70, 0x72, 0x99, 0xAA, 0x99, 0x97, 0x0A, 0xFE, 0xA6, 0x9F, 0xFC, 0xA5, 0xAF,
+    0xFD, 0x94, 0x9E, 0xA9, 0x73, 0xE9, 0x74, 0xAD, 0xA7, 0x5E, 0x9A, 0xEA, 0x96, 0xAF, 0xFD, 0x95,
+    0xFF, 0xF4, 0x9F, 0xD9, 0x9F, 0xA3, 0xAF, 0x93, 0xF3, 0xFA, 0x4F, 0x3F, 0x5E, 0xA3, 0xF4, 0xAE,
+    0x93, 0xF3, 0xAF, 0x4F, 0xFF, 0x94, 0xFF, 0xEA, 0x6F, 0xFC, 0xA7, 0x0A, 0xFA, 0xA6, 0x77, 0xFF,
+    0xFC, 0x1F, 0xFF, 0xA0, 0xAF, 0xFF, 0x97, 0x99, 0xF7, 0x19, 0xE9, 0x71, 0xF7, 0x1A, 0xEA, 0x71,
+    0xF7, 0x1A, 0xF7, 0x1F, 0x97, 0x0F, 0xC7, 0x09, 0xFA, 0x70, 0xFC, 0x70, 0x9F, 0xA7, 0x0F, 0xC9,
+    0x79, 0xFC, 0x70, 0xFC, 0x97, 0xAF, 0xC7, 0x0F, 0xCA, 0x70, 0x70, 0xAF, 0xA7, 0x1A, 0xFF, 0x96,
+    0xAF, 0xAA, 0xF5, 0x9E, 0xA3, 0xE9, 0x4E, 0xA4, 0xE4, 0x9E, 0x93, 0x9E, 0x49, 0xE9, 0x29, 0xF4,
+    0x9F, 0x99, 0xAF, 0x95, 0xAF, 0xFC, 0xA7, 0x9F, 0xE7, 0xAF, 0xFD, 0x5F, 0xA2, 0xAE, 0xA3, 0xF9,
+    0x4F, 0x29, 0xF5, 0xF2, 0xAE, 0xA4, 0xAE, 0xA2, 0xAF, 0xA9, 0x9A, 0xFC, 0x92, 0xAF, 0xFF, 0xC3,
+    0x9F, 0xFF, 0x5A, 0xFF, 0xD7, 0x0A, 0xAF, 0xA6, 0x70, 0xAA, 0xDA, 0x97, 0x2A, 0xFE, 0xA7, 0x0F,
+    0xFD, 0xA6, 0xF9, 0x2F, 0x5A, 0xE5, 0xE5, 0xE6, 0xE4, 0x9D, 0xA6, 0xE4, 0xAD, 0x6A, 0xE4, 0xE6,
+    0xF4, 0xE9, 0x39, 0xFA, 0x4F, 0xCA, 0xFE, 0x94, 0x9F, 0xFF, 0x6A, 0xFF, 0xE7, 0x9A, 0xFA, 0xEA,
+    0x75, 0xAE, 0x59, 0x6A, 0xEA, 0x49, 0xFC, 0xAF, 0xD5, 0xAF, 0xFE, 0x95, 0xFF, 0xE9, 0x6A, 0xAF,
+    0xEA, 0x77, 0x72, 0x49, 0xF5, 0xAF, 0x5F, 0xA4, 0xAF, 0xA4, 0xFC, 0x93, 0xAF, 0xC9, 0x77, 0x77,
+    0x77, 0x72, 0xF5, 0xAF, 0x5F, 0xC4, 0xAF, 0xA4, 0xFC, 0xA3, 0x9F, 0xC9, 0x30, 0x77, 0x2A, 0xEA,
+    0x6F, 0xA5, 0x9F, 0x95, 0xFC, 0x94, 0x9F, 0xC5, 0xFD, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xAA, 0xAA,
+    0xA5, 0xFC, 0xA4, 0x9F, 0xC5, 0xAF, 0xA5, 0xFC, 0x5A, 0xF9, 0x49, 0xFC, 0x5F, 0xC9, 0x49, 0xFA,
+    0x50, 0x77, 0x77, 0x2A, 0x97, 0x70, 0xAD, 0xA7, 0x59, 0xFD, 0x73, 0x9F, 0xF7, 0x19, 0xFF, 0xA7,
+    0x09, 0xFF, 0xA7, 0x09, 0xFF, 0xA7, 0x19, 0xFF, 0x97, 0x3F, 0xE7, 0x5A, 0xFF, 0xA9, 0x71, 0xFF,
+    0xFC, 0xA9, 0x79, 0xAF, 0xFF, 0xCA, 0x70, 0x9A, 0xFF, 0xD9, 0x73, 0xAF, 0xEA, 0x76, 0x9A, 0xF7,
+    0x72, 0x9A, 0x00, 0x74, 0x99, 0x4A, 0xFF, 0xD3, 0xAF, 0xFE, 0x29, 0xFF, 0xF2, 0x99, 0x99, 0x77,
+    0x76, 0x99, 0x99, 0xAA, 0xAA, 0x93, 0xFF, 0xEA, 0x29, 0xFF, 0xEA, 0x2F, 0xDA, 0xAA, 0xAA, 0xA9,
+    0x10, 0x77, 0x71, 0xAA, 0x77, 0x2E, 0xA7, 0x70, 0xFC, 0xA7, 0x59, 0xFE, 0xA7, 0x5A, 0xFE, 0xA7,
+    0x49, 0xFF, 0xA7, 0x49, 0xFF, 0xA7, 0x49, 0xFF, 0x74, 0x9F, 0xDA, 0x71, 0x9A, 0xFF, 0x95, 0x9A,
+    0xFF, 0xFA, 0x2A, 0xFF, 0xFC, 0xA4, 0xAF, 0xFD, 0xA9, 0x7F, 0xEA, 0x97, 0x29, 0xFA, 0x97, 0x59,
+    0xA9, 0x77, 0x10, 0x77, 0x71, 0xAE, 0xA9, 0x70, 0x9F, 0xFC, 0x6A, 0xFF, 0xE4, 0x9F, 0xA9, 0x19,
+    0xEA, 0x4A, 0xCA, 0x5A, 0xE5, 0x96, 0xAE, 0x75, 0xAE, 0x75, 0xEA, 0x74, 0x9E, 0x97, 0x4F, 0x74,
+    0xAE, 0xA7, 0x3A, 0xF7, 0x19, 0xAF, 0xC7, 0x1F, 0xE7, 0x1A, 0xFC, 0xA7, 0x2F, 0xC7, 0x4F, 0xA7,
+    0x39, 0xF9, 0x73, 0xFC, 0x73, 0x9E, 0xA9, 0x73, 0x99, 0x77, 0x77, 0x77, 0x77, 0x59, 0x99, 0x75,
+    0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4F, 0xC7, 0x3A, 0xFA, 0x73, 0x77, 0x77, 0x79, 0xAF, 0xA9, 0x77,
+    0xAF, 0xFC, 0x97, 0x49, 0xFC, 0xA9, 0x9A, 0xE9, 0x72, 0x9F, 0x95, 0xAD, 0x71, 0xAE, 0x97, 0x0D,
+    0x97, 0x9E, 0x97, 0x19, 0xCA, 0x7E, 0x1A, 0xDA, 0xCA, 0x4D, 0x6E, 0xA0, 0xAF, 0xCA, 0x4D, 0x59,
+    0xE0, 0x9C, 0xA1, 0xD9, 0x39, 0xD5, 0xE9, 0x0D, 0x2A, 0xC4, 0xAC, 0xA4, 0x9E, 0x1C, 0x92, 0xD4,
+    0xD9, 0x4A, 0xE0, 0x9C, 0x3D, 0x3A, 0xD5, 0xAE, 0x0A, 0xCA, 0xAA, 0xE2, 0xAD, 0x95, 0xF0, 0x9F,
+    0xDA, 0x09, 0xEA, 0x6F, 0x1A, 0xEA, 0xFD, 0xA7, 0xF9, 0x6A, 0xE9, 0x70, 0xAF, 0x77, 0x49, 0xFC,
+    0xA9, 0x39, 0xAA, 0x73, 0xFF, 0xFD, 0x74, 0xFF, 0xFC, 0x75, 0xAF, 0xFE, 0x77, 0xAF, 0xFA, 0x77,
+    0x77, 0x00, 0x75, 0x9E, 0xA7, 0x70, 0xFA, 0x77, 0xAF, 0xC7, 0x69, 0xFD, 0x76, 0xFE, 0x75, 0xAE,
+    0xAE, 0x74, 0x9E, 0x9A, 0xE9, 0x73, 0xF0, 0x9E, 0x97, 0x2A, 0xE9, 0x09, 0xEA, 0x71, 0x9E, 0xA1,
+    0x9E, 0xA7, 0x1F, 0x29, 0xF7, 0x0F, 0xA2, 0x9F, 0x79, 0xF4, 0xF7, 0xFC, 0xAA, 0xAA, 0xAF, 0x6F,
+    0xFF, 0xE9, 0x49, 0xFF, 0xFE, 0x94, 0xFF, 0xFF, 0xA3, 0xFF, 0xFF, 0xCA, 0x29, 0xFA, 0x7F, 0xC2,
+    0xFC, 0x70, 0xFC, 0x1F, 0xC9, 0x79, 0xFC, 0x00, 0x5A, 0xFF, 0xA9, 0x71, 0xFF, 0xF7, 0x0F, 0xFF,
+    0xC6, 0x9F, 0x29, 0x9F, 0x6A, 0xEA, 0x49, 0xE9, 0x5F, 0x59, 0xE6, 0xF5, 0xEA, 0x59, 0xEA, 0x39,
+    0xF9, 0x5F, 0xFF, 0xCA, 0x6F, 0xFF, 0x96, 0x9F, 0xFF, 0xC9, 0x5A, 0xFA, 0xAA, 0xAA, 0xFC, 0x5F,
+    0x95, 0xF9, 0x4F, 0x6F, 0x93, 0x9F, 0x59, 0xF9, 0x3A, 0xF9, 0x99, 0x9A, 0xFD, 0x4F, 0xFF, 0xF4,
+    0xFF, 0xFE, 0x93, 0x9F, 0xFF, 0xDA, 0x4A, 0xFF, 0xFC, 0xA5, 0xFF, 0xEA, 0x96, 0x77, 0x77, 0x19,
+    0xAF, 0xDA, 0x97, 0x1A, 0xFF, 0xDA, 0x70, 0xFF, 0xF7, 0x9F, 0xFF, 0xC6, 0x9F, 0xFC, 0xAE, 0x96,
+    0xFD, 0x97, 0x5F, 0xD7, 0x6A, 0xFC, 0x77, 0xFC, 0x77, 0xAF, 0xA7, 0x7F, 0xC7, 0x79, 0xFC, 0x77,
+    0xAF, 0xA7, 0x7F, 0xD7, 0x7F, 0xD7, 0x7F, 0xEA, 0x99, 0x99, 0xAD, 0x95, 0xFF, 0xFE, 0x95, 0xAF,
+    0xFF, 0xD6, 0x9F, 0xFF, 0xD7, 0xFF, 0xFC, 0xA7, 0x0F, 0xFF, 0xA7, 0x1A, 0xFF, 0xD9, 0x40, 0x5A,
+    0xFF, 0xCA, 0x97, 0x3F, 0xFF, 0xCA, 0x71, 0xFF, 0xFD, 0xA7, 0x9F, 0xFF, 0xEA, 0x6A, 0xF1, 0x99,
+    0x9A, 0xFD, 0x6F, 0xA6, 0xAF, 0x6F, 0x97, 0xF9, 0x49, 0xF7, 0x0A, 0xE9, 0x4A, 0xF7, 0x0A, 0xE9,
+    0x4F, 0x97, 0x0A, 0xE4, 0x9F, 0x71, 0xF4, 0xAF, 0x70, 0xAE, 0xA4, 0xFA, 0x79, 0xF5, 0xF9, 0x69,
+    0xFC, 0x49, 0xF9, 0x29, 0x9A, 0xFD, 0x94, 0xAF, 0xFF, 0xFC, 0x5F, 0xFF, 0xFC, 0x95, 0xFF, 0xFF,
+    0xA5, 0x9F, 0xFF, 0xEA, 0x6A, 0xFF, 0xFD, 0x97, 0xFF, 0xEA, 0xA9, 0x70, 0x6A, 0xAA, 0xAA, 0xAA,
+    0xFE, 0x7F, 0xFF, 0xC9, 0x69, 0xFF, 0xFA, 0x7F, 0xFA, 0xAA, 0xAA, 0x70, 0xF7, 0x70, 0x9F, 0x77,
+    0x0A, 0xEA, 0x77, 0x0F, 0x97, 0x79, 0xFA, 0xAA, 0xEA, 0x71, 0xAF, 0xFD, 0x97, 0x1F, 0xFE, 0x72,
+    0xFF, 0xDA, 0x71, 0xAF, 0x77, 0x0F, 0xA7, 0x70, 0xF9, 0x77, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7,
+    0xFF, 0xFD, 0x7F, 0xFF, 0xD6, 0x9F, 0xFF, 0xD6, 0xAF, 0xFF, 0xD6, 0xFF, 0xFE, 0x50, 0x69, 0xAA,
+    0xAA, 0xFE, 0xA6, 0xAF, 0xFE, 0x96, 0xFF, 0xF6, 0x9F, 0xCA, 0xAA, 0xA9, 0x99, 0x6A, 0xE9, 0x76,
+    0xF7, 0x69, 0xEA, 0x76, 0xAF, 0xFD, 0x97, 0xFF, 0xE7, 0x0F, 0xFE, 0x7A, 0xFF, 0xDA, 0x7F, 0x99,
+    0x99, 0x99, 0x97, 0x0F, 0x76, 0x9F, 0x76, 0xFA, 0x76, 0xF9, 0x75, 0x9F, 0x76, 0xAF, 0x76, 0xFA,
+    0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x75, 0x72, 0x9A, 0xFE, 0xAA, 0x97, 0x0A, 0xFF, 0xFA,
+    0x69, 0xFF, 0xFD, 0xA5, 0x9F, 0xFF, 0xE9, 0x49, 0xFE, 0x99, 0x39, 0x9A, 0x94, 0xFD, 0x97, 0x6A,
+    0xFC, 0x77, 0x0F, 0xC7, 0x70, 0xAF, 0xA7, 0x70, 0xFC, 0x77, 0x1F, 0xC5, 0xAA, 0x99, 0x69, 0xFA,
+    0x49, 0xFF, 0x91, 0xAF, 0x94, 0x9F, 0xFA, 0x1F, 0xC5, 0x9F, 0xFA, 0x1F, 0xC9, 0x79, 0xFC, 0x91,
+    0xFC, 0xA7, 0xAE, 0x93, 0xFE, 0x99, 0x19, 0x9A, 0xF4, 0xAF, 0xFF, 0xFC, 0x5F, 0xFF, 0xFC, 0x5A,
+    0xFF, 0xFE, 0xA6, 0x9F, 0xFF, 0xCA, 0x71, 0x9A, 0xFD, 0xA9, 0x60, 0x6F, 0x96, 0xAE, 0xA5, 0x9F,
+    0x7F, 0x95, 0xAF, 0x7F, 0x95, 0xFA, 0x69, 0xF6, 0xF9, 0x6A, 0xF5, 0x9F, 0x7F, 0xA5, 0xFC, 0x69,
+    0xF9, 0x5F, 0xA6, 0xAF, 0x59, 0xF9, 0x6F, 0xC5, 0xAF, 0x96, 0xFA, 0x5F, 0xC6, 0xAF, 0x94, 0x9F,
+    0xC9, 0x99, 0x99, 0x99, 0xFC, 0x5A, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 0xCA, 0x5F, 0xFF, 0xFC, 0xA4,
+    0x9F, 0xFF, 0xFC, 0x94, 0xFF, 0xFF, 0xD5, 0xFC, 0x95, 0xAF, 0xC4, 0x9F, 0xC6, 0xFC, 0xA4, 0xAF,
+    0xC5, 0x9F, 0xC9, 0x4F, 0xCA, 0x5A, 0xFC, 0x40, 0x59, 0xDA, 0xA6, 0x9F, 0x6A, 0xEA, 0x6F, 0x96,
+    0xF6, 0x9F, 0x6A, 0xEA, 0x6A, 0xE9, 0x6F, 0x7F, 0x69, 0xEA, 0x6A, 0xE9, 0x6F, 0x69, 0xF6, 0xAF,
+    0x6F, 0xA6, 0xF9, 0x59, 0xF6, 0xFC, 0x6F, 0xC5, 0x9F, 0xA5, 0xAF, 0xA5, 0xAA, 0xE9, 0x40, 0x77,
+    0x0A, 0xF7, 0x71, 0xFA, 0x77, 0x09, 0xF7, 0x71, 0xFC, 0x77, 0x1F, 0x97, 0x70, 0xAF, 0x77, 0x1F,
+    0xA7, 0x70, 0x9F, 0x97, 0x70, 0xAF, 0x77, 0x1F, 0xA7, 0x70, 0x9F, 0x77, 0x1A, 0xF7, 0x71, 0xF9,
+    0x77, 0x09, 0xF7, 0x71, 0xFA, 0x77, 0x1F, 0x97, 0x70, 0xAF, 0x77, 0x1F, 0xA7, 0x70, 0x9F, 0x77,
+    0x1F, 0xC7, 0x2C, 0xA9, 0x09, 0xAF, 0xC9, 0x71, 0xAF, 0xFE, 0x72, 0xFF, 0xE9, 0x71, 0x9F, 0xFD,
+    0xA7, 0x2F, 0xFD, 0x97, 0x39, 0xAA, 0xFC, 0x97, 0x77, 0x73, 0x79, 0xF2, 0xAF, 0xA7, 0x0A, 0xE9,
+    0x19, 0xFA, 0x71, 0xF1, 0x9F, 0xC7, 0x19, 0xEA, 0x1F, 0xC7, 0x2F, 0x90, 0xFC, 0x73, 0xF0, 0xFC,
+    0x73, 0xAE, 0x9A, 0xF9, 0x73, 0xFA, 0xF9, 0x73, 0x9F, 0xFA, 0x74, 0xFF, 0xA7, 0x5F, 0xEA, 0x75,
+    0xAF, 0xE7, 0x6F, 0xEA, 0x75, 0x9F, 0xFA, 0x74, 0xAF, 0xFC, 0x97, 0x3F, 0xFE, 0x97, 0x19, 0xF0,
+    0xFE, 0x71, 0xFC, 0x09, 0xFE, 0x70, 0xFA, 0x1F, 0xF6, 0xAF, 0x91, 0x9F, 0xEA, 0x5F, 0xC3, 0xFF,
+    0xA3, 0x69, 0xEA, 0x73, 0xF9, 0x73, 0xF7, 0x39, 0xF7, 0x3A, 0xE9, 0x73, 0xF7, 0x39, 0xF7, 0x3A,
+    0xEA, 0x73, 0xF9, 0x72, 0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0x97, 0x29, 0xF7, 0x3A, 0xF7, 0x3F, 0xA7,
+    0x29, 0xF7, 0x3A, 0xFA, 0xFF, 0x91, 0xFF, 0xFD, 0x19, 0xFF, 0xFD, 0x1A, 0xFF, 0xFC, 0xA1, 0xFF,
+    0xFD, 0x90, 0x6F, 0xCA, 0x7A, 0xFA, 0x6F, 0xCA, 0x69, 0xFC, 0x95, 0x9F, 0xD6, 0xFD, 0x6A, 0xFD,
+    0x5A, 0xFD, 0x6F, 0xE4, 0x9F, 0xDA, 0x59, 0xFE, 0x93, 0xFE, 0x95, 0xAF, 0xE9, 0x2A, 0xFE, 0x6F,
+    0xFA, 0x19, 0xFF, 0x59, 0xFF, 0xA1, 0xFF, 0xA5, 0xAE, 0xAF, 0xC0, 0xAF, 0xF9, 0x5F, 0x9F, 0xC9,
+    0xF9, 0xF9, 0x5F, 0x0F, 0xFC, 0xAA, 0xF5, 0xAF, 0x0F, 0xFC, 0x0F, 0xC5, 0xFC, 0x0A, 0xFE, 0x99,
+    0xFA, 0x5F, 0xA0, 0xAF, 0xE0, 0xAF, 0x94, 0x9F, 0x90, 0xAF, 0xD9, 0x0F, 0xC5, 0xFC, 0x19, 0xFD,
+    0x09, 0xFC, 0x5F, 0xC1, 0x9F, 0xC1, 0xFC, 0xA4, 0x9F, 0xC2, 0xFA, 0x1F, 0xC9, 0x4A, 0xFA, 0x2F,
+    0x1A, 0xFC, 0x5F, 0xC9, 0x70, 0xFD, 0x40, 0x77, 0x3F, 0x70, 0xFA, 0x6F, 0x7A, 0xFA, 0x59, 0xEA,
+    0x7F, 0xD5, 0xF7, 0x9F, 0xD5, 0xF7, 0xAF, 0xD9, 0x3A, 0xEA, 0x7F, 0xEA, 0x3F, 0x79, 0xFF, 0x3F,
+    0x7A, 0xFF, 0x2A, 0xEA, 0x7F, 0xAF, 0x2F, 0x96, 0x9F, 0x9A, 0xE9, 0x09, 0xF7, 0xFC, 0x0A, 0xEA,
+    0x0A, 0xEA, 0x7F, 0xC0, 0x9F, 0x0F, 0x96, 0x9F, 0xC0, 0x9F, 0x9F, 0x7F, 0xCA, 0x1F, 0xFA, 0x7F,
+    0xC9, 0x1F, 0xF9, 0x6A, 0xFC, 0x2F, 0xF7, 0xFD, 0x2A, 0xFD, 0xA6, 0x9F, 0xCA, 0x29, 0xFD, 0x96,
+    0xAF, 0xC9, 0x29, 0xFD, 0x7F, 0xD4, 0xFC, 0xA6, 0x72, 0x9A, 0xFC, 0xA7, 0x69, 0xFF, 0xD9, 0x73,
+    0xAF, 0xFF, 0xA7, 0x1F, 0xDA, 0xA9, 0xAF, 0xC9, 0x7F, 0xCA, 0x49, 0xFA, 0x6A, 0xFA, 0x6A, 0xF5,
+    0x9F, 0xA7, 0x9F, 0x94, 0xFC, 0x71, 0xF9, 0x39, 0xF9, 0x71, 0xF9, 0x3A, 0xF7, 0x2F, 0x93, 0xFA,
+    0x71, 0x9F, 0x39, 0xF7, 0x29, 0xF3, 0xAF, 0x72, 0xFA, 0x3A, 0xF7, 0x2F, 0x93, 0xFA, 0x71, 0xFC,
+    0x4F, 0xC7, 0x0A, 0xFA, 0x4F, 0xDA, 0x91, 0x99, 0xAF, 0xD9, 0x4F, 0xFF, 0xFE, 0x5F, 0xFF, 0xFD,
+    0x95, 0xAF, 0xFF, 0xFA, 0x7F, 0xFF, 0xEA, 0x71, 0xFF, 0xFC, 0x97, 0x39, 0xAF, 0xEA, 0x97, 0x77,
+    0x71, 0x77, 0x73, 0x9F, 0xFA, 0x72, 0xFF, 0xE7, 0x1F, 0xFF, 0x79, 0xE9, 0x39, 0xE9, 0x6F, 0x5E,
+    0xA6, 0xF5, 0xEA, 0x59, 0xEA, 0x4F, 0x95, 0xFA, 0x99, 0xAA, 0xFC, 0x6F, 0xFF, 0xCA, 0x59, 0xFF,
+    0xFC, 0x6A, 0xFF, 0xF7, 0xFF, 0xEA, 0x79, 0xFF, 0xA9, 0x71, 0xAF, 0x77, 0xFA, 0x76, 0x9F, 0xA7,
+    0x6A, 0xF9, 0x76, 0xFC, 0x76, 0x9F, 0xC7, 0x6A, 0xFA, 0x76, 0xFC, 0xA7, 0x50, 0x74, 0x9A, 0xAA,
+    0x97, 0x70, 0x9F, 0xFA, 0x75, 0xFF, 0xF7, 0x29, 0xFF, 0xFD, 0x70, 0x9F, 0xCA, 0x29, 0xFC, 0x96,
+    0x9F, 0xC9, 0x5F, 0xA6, 0xFC, 0x7A, 0xF5, 0xAF, 0x70, 0x9F, 0x5F, 0xA7, 0x09, 0xF4, 0xAF, 0x71,
+    0x9F, 0x4F, 0xA7, 0x1A, 0xEA, 0x4F, 0x72, 0xFA, 0x39, 0xF7, 0x2F, 0x93, 0xAF, 0x71, 0x9F, 0x4A,
+    0xEA, 0x49, 0x3F, 0xA4, 0xFC, 0x3A, 0xD9, 0x0A, 0xF5, 0xFC, 0xA9, 0x99, 0xFF, 0xCA, 0x5A, 0xFF,
+    0xFF, 0xC6, 0x9F, 0xFF, 0xF9, 0x7F, 0xFF, 0xEA, 0x70, 0x9F, 0xFF, 0xCA, 0x72, 0xAF, 0xFF, 0xA7,
+    0x4A, 0xFF, 0xE9, 0x77, 0x0F, 0xF7, 0x70, 0xAF, 0xEA, 0x77, 0x0F, 0xF9, 0x77, 0x74, 0x7F, 0xEA,
+    0x97, 0x1A, 0xFF, 0xD7, 0x0F, 0xFE, 0xA7, 0xE4, 0x9E, 0x6A, 0xE4, 0x9E, 0x6E, 0xA4, 0xAE, 0x6E,
+    0x94, 0xEA, 0x5A, 0xE4, 0x9E, 0x95, 0xF3, 0xAF, 0x6F, 0xFF, 0x95, 0xAF, 0xFE, 0x96, 0xFF, 0xE9,
+    0x7F, 0xFF, 0x6A, 0xFC, 0x91, 0xF6, 0xFC, 0x3F, 0x95, 0xFC, 0x3F, 0xA4, 0xAF, 0xA3, 0xFA, 0x4F,
+    0xC9, 0x2A, 0xFA, 0x39, 0xFC, 0x92, 0xFD, 0x3A, 0xFC, 0x3F, 0xD3, 0xFD, 0x29, 0xFD, 0x77, 0x60,
+    0x72, 0xAA, 0xFC, 0xA9, 0x71, 0xAF, 0xFD, 0x97, 0xFF, 0xEA, 0x7F, 0xEA, 0xAE, 0x79, 0xFA, 0x76,
+    0xFA, 0x76, 0x9F, 0x77, 0x9F, 0x77, 0xAF, 0xC9, 0x75, 0x9F, 0xFA, 0x73, 0xFF, 0xE7, 0x2F, 0xFE,
+    0x97, 0x19, 0xFF, 0xD7, 0x49, 0xAF, 0xDA, 0x76, 0xFD, 0x77, 0xFC, 0x4D, 0x96, 0xAF, 0xA3, 0xFC,
+    0xA9, 0x19, 0xFD, 0x92, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xD9, 0x69, 0xAF, 0xEA,
+    0x96, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF,
+    0xFF, 0xD9, 0x0F, 0xFF, 0xFD, 0x09, 0xFF, 0xFF, 0xD7, 0xAE, 0xA7, 0x6F, 0x97, 0x59, 0xF7, 0x6A,
+    0xF7, 0x6F, 0xA7, 0x6F, 0x97, 0x5A, 0xF7, 0x6F, 0xC7, 0x6F, 0xA7, 0x59, 0xF9, 0x75, 0xAF, 0x76,
+    0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x75, 0xAF, 0xC7, 0x30, 0x4A, 0xFC,
+    0x59, 0xFC, 0x5F, 0xCA, 0x5A, 0xFC, 0x5F, 0xC6, 0xFC, 0xA4, 0x9F, 0xC6, 0xFC, 0x5A, 0xFA, 0x59,
+    0xFC, 0x5F, 0xC9, 0x5A, 0xFA, 0x5F, 0xC6, 0xFC, 0x6F, 0xA6, 0xFC, 0x59, 0xF9, 0x59, 0xFA, 0x5A,
+    0xF6, 0xAF, 0x95, 0xFA, 0x6F, 0xC6, 0xF9, 0x6F, 0xA5, 0x9F, 0x69, 0xF9, 0x5A, 0xF6, 0xFC, 0x6F,
+    0xC5, 0xAF, 0xA6, 0xFE, 0xAF, 0xF9, 0x6F, 0xFF, 0xF7, 0xFF, 0xFE, 0x97, 0xFF, 0xFE, 0x70, 0xAF,
+    0xFF, 0xC7, 0x29, 0xFF, 0xDA, 0x77, 0x77, 0x77, 0x70, 0x9F, 0x72, 0xF9, 0x9F, 0x71, 0xAF, 0x09,
+    0xF7, 0x09, 0xF9, 0x09, 0xF9, 0x7F, 0xA2, 0xF9, 0x6A, 0xF3, 0xFA, 0x59, 0xF9, 0x3F, 0xC5, 0xFC,
+    0x4F, 0xC4, 0xFC, 0x94, 0xFC, 0x3A, 0xFA, 0x5F, 0xC2, 0x9F, 0xC6, 0xFC, 0x91, 0xFC, 0x96, 0xFC,
+    0x90, 0xAF, 0xC7, 0xFC, 0xA9, 0xFC, 0x97, 0xFF, 0xEA, 0x70, 0xFF, 0xE7, 0x1A, 0xFF, 0xC9, 0x71,
+    0xAF, 0xFC, 0x72, 0xAF, 0xF9, 0x72, 0xAF, 0xEA, 0x73, 0xAF, 0xE7, 0x4A, 0xFD, 0x97, 0x30, 0x77,
+    0x76, 0x9F, 0xA7, 0x70, 0xFA, 0x1A, 0xFA, 0x77, 0xAF, 0x2A, 0xFA, 0x77, 0xFA, 0x2A, 0xF9, 0x76,
+    0xAF, 0x3A, 0xF9, 0x76, 0xFA, 0x3F, 0xC9, 0x49, 0xAA, 0x94, 0xFC, 0x4F, 0xC9, 0x39, 0xEA, 0x39,
+    0xFA, 0x4F, 0xC9, 0x29, 0xFC, 0x3F, 0xC5, 0xFC, 0x92, 0xFD, 0x29, 0xFA, 0x5F, 0xC9, 0x1F, 0xE9,
+    0x1F, 0xC6, 0xFC, 0x1A, 0xFE, 0xA0, 0x9F, 0xA6, 0xFC, 0x09, 0xFF, 0xA0, 0xFC, 0x7F, 0xC9, 0xFF,
+    0xD9, 0xFA, 0x7F, 0xFD, 0xAF, 0xFD, 0x79, 0xFF, 0xD0, 0xFF, 0xCA, 0x79, 0xFF, 0xC9, 0x0F, 0xFC,
+    0x70, 0x9F, 0xFA, 0x1A, 0xFE, 0xA7, 0x09, 0xFF, 0x2A, 0xFE, 0x71, 0xAF, 0xE9, 0x29, 0xFD, 0xA7,
+    0x1A, 0xFD, 0xA3, 0x9F, 0xD7, 0x2A, 0xFD, 0x49, 0xFC, 0xA7, 0x20, 0x69, 0xF7, 0x0F, 0x97, 0xFA,
+    0x6F, 0x97, 0x0A, 0xF4, 0x9F, 0x97, 0x19, 0xFA, 0x29, 0xF9, 0x73, 0xFC, 0x19, 0xF9, 0x74, 0xAF,
+    0xAA, 0xFA, 0x76, 0xFF, 0xCA, 0x77, 0xFF, 0xA7, 0x70, 0xAF, 0xDA, 0x77, 0x2F, 0xCA, 0x77, 0x29,
+    0xFC, 0xA7, 0x71, 0x9F, 0xE7, 0x70, 0x9F, 0xF9, 0x77, 0xFF, 0xD7, 0x6F, 0xFE, 0x75, 0xFC, 0xA9,
+    0xFC, 0xA7, 0x3F, 0xD1, 0xFD, 0x72, 0xFD, 0x2A, 0xFC, 0x97, 0x0F, 0xD3, 0x9F, 0xD7, 0xAF, 0xC9,
+    0x4F, 0xD6, 0xAF, 0xCA, 0x5A, 0xFC, 0xA4, 0x9F, 0x70, 0xAF, 0x1F, 0x96, 0x9F, 0x2F, 0xA6, 0xF9,
+    0x2A, 0xF5, 0xFA, 0x3A, 0xF4, 0xAF, 0x49, 0xF9, 0x2A, 0xF6, 0xFA, 0x19, 0xF9, 0x6F, 0xC1, 0xFA,
+    0x7A, 0xF9, 0xFC, 0x70, 0xAF, 0xFC, 0x71, 0x9F, 0xF9, 0x72, 0xFE, 0xA7, 0x3F, 0xE7, 0x4A, 0xFC,
+    0x75, 0xAF, 0xA7, 0x5F, 0xC9, 0x74, 0x9F, 0xC7, 0x5A, 0xFC, 0x75, 0xFC, 0xA7, 0x49, 0xFC, 0x97,
+    0x4A, 0xFC, 0x74, 0x7F, 0xFF, 0xFC, 0x97, 0xFF, 0xFF, 0xC7, 0x0A, 0xFF, 0xFF, 0x70, 0x9F, 0xFF,
+    0xEA, 0x71, 0xAA, 0xAF, 0xFF, 0x77, 0x09, 0xFE, 0x77, 0x09, 0xFD, 0xA7, 0x70, 0xAF, 0xDA, 0x77,
+    0x0F, 0xEA, 0x77, 0x9F, 0xE9, 0x77, 0xAF, 0xE9, 0x77, 0xFF, 0x97, 0x69, 0xFF, 0x77, 0x9F, 0xF7,
+    0x7A, 0xFF, 0x77, 0xFF, 0xC9, 0x99, 0x99, 0x99, 0x70, 0xFF, 0xFF, 0xC9, 0x7F, 0xFF, 0xFC, 0x96,
+    0x9F, 0xFF, 0xFC, 0x96, 0xAF, 0xFF, 0xFC, 0xA6, 0xFF, 0xFF, 0xDA, 0x50, 0x73, 0xFE, 0xA7, 0x29,
+    0xFE, 0x73, 0xAF, 0xE7, 0x3F, 0x76, 0x9E, 0x97, 0x6A, 0xE7, 0x7F, 0x77, 0xEA, 0x76, 0xAE, 0x77,
+    0xF7, 0x7E, 0xA7, 0x69, 0xE7, 0x7F, 0x77, 0xEA, 0x76, 0x9E, 0x97, 0x6A, 0xE7, 0x7E, 0xA7, 0x69,
+    0xE9, 0x76, 0xAE, 0x77, 0xEA, 0x76, 0x9E, 0x97, 0x6A, 0xE7, 0x7F, 0x76, 0x9E, 0x97, 0x6A, 0xE7,
+    0x7F, 0x77, 0xE9, 0x76, 0xAE, 0x77, 0xF7, 0x7E, 0xA7, 0x69, 0xE7, 0x7F, 0xF7, 0x3F, 0xF7, 0x29,
+    0xFE, 0xA7, 0x2A, 0xFE, 0x97, 0x29, 0x9A, 0xA9, 0x99, 0x97, 0x20, 0x75, 0xA9, 0x3C, 0x92, 0xAC,
+    0x92, 0xDA, 0x19, 0xDA, 0x19, 0xE1, 0x9E, 0x19, 0xE1, 0x9E, 0x19, 0xE1, 0x9E, 0x91, 0xE9, 0x1E,
+    0x91, 0xEA, 0x1E, 0xA1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF9, 0x0F, 0x1E, 0x91, 0xDA, 0x2D, 0x3C,
+    0x93, 0x93, 0xFE, 0xA7, 0x2A, 0xFE, 0x73, 0xFE, 0x97, 0x6E, 0xA7, 0x6A, 0xE7, 0x69, 0xE9, 0x76,
+    0xEA, 0x76, 0xAE, 0x76, 0x9E, 0x97, 0x6E, 0xA7, 0x6F, 0x76, 0x9E, 0x77, 0xEA, 0x76, 0xF7, 0x6A,
+    0xE7, 0x7E, 0x97, 0x6F, 0x76, 0xAE, 0x76, 0x9E, 0x97, 0x6F, 0x76, 0xAE, 0x76, 0x9E, 0x97, 0x6E,
+    0xA7, 0x6A, 0xE7, 0x69, 0xE9, 0x76, 0xEA, 0x76, 0xAE, 0x76, 0x9E, 0x97, 0x6E, 0xA7, 0x6F, 0x76,
+    0x9E, 0x72, 0x9F, 0xEA, 0x72, 0xFF, 0x72, 0xFF, 0x72, 0xAF, 0xE9, 0x72, 0x99, 0x99, 0xAA, 0x99,
+    0x77, 0x29, 0xD9, 0x72, 0xF9, 0x70, 0xAF, 0xCA, 0x69, 0xFE, 0xA5, 0xEA, 0x1A, 0xE3, 0xEA, 0x4E,
+    0x90, 0x77, 0x3A, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFA, 0x09, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x09, 0x99, 0x6F, 0x95, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x72,
+    0x77, 0x59, 0xAE, 0x97, 0x0A, 0xFF, 0xCA, 0x3A, 0xFF, 0xD9, 0x3E, 0xA1, 0x9F, 0x92, 0xEA, 0x3A,
+    0xE2, 0x9E, 0x4A, 0xE2, 0xAD, 0x94, 0xAE, 0x2E, 0x5A, 0xDA, 0x19, 0xD9, 0x5E, 0xA1, 0xAD, 0x6E,
+    0x91, 0xE5, 0xF2, 0xFA, 0xAA, 0xFD, 0x2F, 0xFF, 0xC2, 0xAF, 0xFF, 0x3F, 0xFE, 0xA4, 0xAF, 0xA6,
+    0x49, 0x99, 0x73, 0xAE, 0x97, 0x2F, 0x73, 0xEA, 0x73, 0xE9, 0x72, 0x9E, 0x73, 0xAE, 0x73, 0xAD,
+    0xA1, 0x99, 0x96, 0xEA, 0xFD, 0x5F, 0xFE, 0x39, 0xFF, 0xE9, 0x2A, 0xFC, 0x91, 0x9D, 0xA2, 0xFC,
+    0x4E, 0x2F, 0x94, 0xE2, 0xF5, 0xE1, 0x9E, 0xA4, 0xAD, 0xA1, 0xAE, 0x93, 0x9E, 0x91, 0xAF, 0x99,
+    0x9F, 0xC2, 0xFF, 0xFA, 0x2F, 0xFF, 0x3A, 0xFF, 0xD5, 0xFF, 0x97, 0x09, 0x99, 0x70, 0x77, 0x49,
+    0xAF, 0x94, 0x9F, 0xF3, 0x9F, 0xFA, 0x3F, 0xA9, 0x19, 0x92, 0xF7, 0x09, 0xE9, 0x70, 0xAE, 0x71,
+    0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE9, 0x70, 0xAE, 0xA2, 0x94, 0x9F, 0xAA, 0xDA, 0x4F, 0xFC, 0x93,
+    0x9F, 0xFC, 0x5A, 0xFC, 0xA2, 0x77, 0xF7, 0x70, 0xEA, 0x77, 0x9E, 0x77, 0x0F, 0x77, 0x0E, 0xA7,
+    0x7A, 0xE7, 0x19, 0xF9, 0x0F, 0x70, 0xFF, 0xEA, 0x7F, 0xFF, 0x7F, 0xAA, 0xFE, 0x6F, 0x92, 0xFC,
+    0xA5, 0x9E, 0x93, 0xAF, 0x6A, 0xDA, 0x4A, 0xF6, 0xE9, 0x4F, 0xA5, 0x9E, 0x5F, 0x69, 0xE4, 0xAF,
+    0x6A, 0xE3, 0x9F, 0xC6, 0x9F, 0xFF, 0xA7, 0xFF, 0xF9, 0x7F, 0xFF, 0x70, 0x9F, 0xFE, 0x72, 0xAE,
+    0xA9, 0x72, 0x69, 0xAE, 0xA7, 0x1F, 0xF7, 0xFC, 0xAF, 0x5F, 0x39, 0xD9, 0x3A, 0xE2, 0x99, 0xAD,
+    0xA3, 0xFF, 0xFA, 0x2A, 0xFF, 0xFA, 0x2F, 0xFF, 0xCA, 0x19, 0xFC, 0xAA, 0xA9, 0x99, 0x93, 0xAE,
+    0x74, 0xAE, 0x97, 0x3A, 0xFA, 0x92, 0x9D, 0x92, 0x9F, 0xFF, 0x4F, 0xFF, 0x5F, 0xFD, 0xA6, 0x9A,
+    0xFA, 0x94, 0x77, 0x5F, 0xC9, 0x59, 0xFD, 0x6F, 0xE5, 0x9E, 0x97, 0x0A, 0xE7, 0x1E, 0x96, 0x9F,
+    0xC9, 0x9A, 0xC3, 0xAF, 0xFA, 0x3F, 0xFC, 0x93, 0xAA, 0xFA, 0xAA, 0x5A, 0xE9, 0x70, 0xF7, 0x1F,
+    0x70, 0x9F, 0x70, 0xAE, 0xA7, 0x0F, 0x97, 0x0F, 0x70, 0xAF, 0x70, 0xFA, 0x70, 0xF9, 0x79, 0xF7,
+    0x00, 0x70, 0xAE, 0xA1, 0xE9, 0x69, 0xFE, 0xAE, 0x69, 0xFF, 0xF6, 0xEA, 0x1A, 0xFC, 0xA5, 0xE9,
+    0x3F, 0xC9, 0x49, 0xDA, 0x4F, 0xC5, 0xAD, 0x5F, 0xA5, 0xDA, 0x5F, 0x94, 0x9D, 0x94, 0x9F, 0x59,
+    0xD9, 0x4F, 0xC5, 0xAD, 0xA2, 0x9F, 0xCA, 0x5A, 0xFF, 0xF6, 0x9F, 0xFF, 0x7F, 0xFE, 0xA7, 0x9F,
+    0xFD, 0x97, 0x1A, 0xEA, 0xF7, 0x7E, 0xA7, 0x6F, 0x7A, 0xA9, 0x29, 0xF9, 0x7F, 0xFE, 0x7A, 0xFF,
+    0xD7, 0x0F, 0xFD, 0x71, 0x9A, 0xFD, 0x97, 0x10, 0x7E, 0xA7, 0x49, 0xE7, 0x5E, 0xA7, 0x5E, 0x97,
+    0x49, 0xE7, 0x5E, 0xA7, 0x5E, 0x9A, 0xF9, 0x69, 0xFF, 0xDA, 0x5F, 0xFF, 0x5F, 0xC9, 0x1A, 0xE4,
+    0xAF, 0x4E, 0x4F, 0x5E, 0x4E, 0xA4, 0x9E, 0x3A, 0xE9, 0x4A, 0xDA, 0x3F, 0x5E, 0x92, 0x9F, 0x49,
+    0xE3, 0xAE, 0xA4, 0xAE, 0x3F, 0xA4, 0xF2, 0x9F, 0x93, 0xAE, 0xA2, 0xAF, 0x93, 0xF9, 0x2F, 0xC3,
+    0x9F, 0x93, 0x9A, 0xAC, 0x39, 0x99, 0x40, 0x79, 0x99, 0x7A, 0xE9, 0x6F, 0x95, 0xAF, 0x6F, 0xC5,
+    0x9F, 0xC7, 0x77, 0x77, 0x0A, 0xCA, 0x97, 0xE9, 0x7E, 0x79, 0xE7, 0xAD, 0xA7, 0xE9, 0x7E, 0x79,
+    0xE7, 0xAD, 0xA7, 0xEA, 0x69, 0xE9, 0x6A, 0xE7, 0xF7, 0xF6, 0xAF, 0x69, 0xAD, 0xA6, 0x73, 0xAD,
+    0x97, 0x3E, 0x97, 0x2A, 0xE7, 0x3F, 0x77, 0x77, 0x77, 0x77, 0x72, 0xE7, 0x39, 0xE7, 0x3E, 0xA7,
+    0x3E, 0x97, 0x29, 0xE7, 0x3A, 0xDA, 0x73, 0xE9, 0x72, 0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0x97, 0x29,
+    0xE7, 0x3A, 0xDA, 0x73, 0xE9, 0x72, 0x9E, 0x73, 0xEA, 0x72, 0xF9, 0x79, 0xFD, 0x70, 0xAF, 0xCA,
+    0x70, 0xFD, 0x70, 0x9F, 0xA7, 0x77, 0x10, 0x7E, 0x97, 0x2A, 0xE7, 0x3E, 0xA7, 0x3E, 0x97, 0x2A,
+    0xE7, 0x3E, 0xA7, 0x3E, 0x97, 0x2A, 0xE7, 0x3E, 0xA0, 0x9E, 0xA4, 0x9E, 0x0A, 0xEA, 0x5A, 0xEA,
+    0xEA, 0x6F, 0xE9, 0x69, 0xFD, 0x97, 0xAF, 0xC9, 0x70, 0xFE, 0x79, 0xFF, 0x6A, 0xFF, 0xC5, 0xF9,
+    0xFC, 0xA3, 0x9F, 0x0F, 0xDA, 0x2A, 0xEA, 0x09, 0xFD, 0x91, 0xF9, 0x1A, 0xFD, 0x90, 0x69, 0xCA,
+    0xA7, 0xEA, 0x7E, 0x96, 0xAE, 0x7E, 0xA7, 0xE9, 0x6A, 0xE7, 0xEA, 0x7E, 0x96, 0x9E, 0x7F, 0x7E,
+    0xA6, 0x9E, 0x7A, 0xE7, 0xEA, 0x69, 0xE9, 0x6A, 0xE7, 0xF7, 0xEA, 0x99, 0x49, 0xFD, 0x93, 0xAF,
+    0xD4, 0xFE, 0x30, 0x77, 0x77, 0x0A, 0xE9, 0xF9, 0x2A, 0xE9, 0x70, 0xFF, 0xE0, 0xFD, 0xA6, 0x9F,
+    0xFF, 0xFE, 0x95, 0xFC, 0xA1, 0xAF, 0xCA, 0x1E, 0xA5, 0xFA, 0x3F, 0xA2, 0x9E, 0x4A, 0xF3, 0x9F,
+    0x3A, 0xE4, 0xF9, 0x3A, 0xEA, 0x3F, 0x39, 0xF4, 0xF3, 0x9E, 0xA3, 0xAE, 0xA3, 0x9E, 0xA3, 0xAE,
+    0x93, 0xF4, 0xF9, 0x3F, 0x39, 0xF3, 0x9F, 0x39, 0xF3, 0xFA, 0x3F, 0xA3, 0xAE, 0xA3, 0xF3, 0x9F,
+    0x4F, 0x92, 0xAF, 0x3A, 0xEA, 0x39, 0xF3, 0xFA, 0x3F, 0x93, 0xAF, 0x20, 0x77, 0x69, 0xDA, 0x9A,
+    0xEA, 0x7A, 0xFF, 0xD6, 0xFF, 0xE9, 0x49, 0xFC, 0x90, 0x9E, 0xA4, 0xAE, 0xA3, 0x9D, 0xA4, 0xF4,
+    0xAD, 0xA3, 0x9E, 0x94, 0xEA, 0x3A, 0xE4, 0x9E, 0x93, 0xF4, 0xAE, 0x39, 0xEA, 0x4F, 0x3A, 0xEA,
+    0x39, 0xF3, 0xF9, 0x3A, 0xEA, 0x29, 0xF4, 0xF9, 0x2A, 0xF3, 0x9F, 0x92, 0xFC, 0x3A, 0xF2, 0x69,
+    0xAE, 0xA9, 0x70, 0xFF, 0xA5, 0x9F, 0xFD, 0x94, 0xFA, 0x19, 0xF3, 0xF9, 0x3A, 0xE3, 0xEA, 0x4A,
+    0xE2, 0xAE, 0x5A, 0xE2, 0xEA, 0x5F, 0x2E, 0xA4, 0x9E, 0xA1, 0x9E, 0x94, 0xF2, 0x9F, 0x29, 0xFC,
+    0x29, 0xFF, 0xF9, 0x3F, 0xFE, 0xA4, 0xFF, 0xE6, 0xFF, 0xA7, 0x0A, 0xFA, 0x60, 0x75, 0x99, 0x99,
+    0x73, 0xAE, 0x9F, 0xD7, 0x2F, 0xFF, 0x71, 0xFE, 0x99, 0xAD, 0x97, 0x0F, 0xCA, 0x3D, 0xA7, 0x9F,
+    0xA4, 0xAD, 0x7A, 0xF5, 0xE7, 0xFA, 0x5D, 0xA7, 0xF9, 0x49, 0xD9, 0x69, 0xF9, 0x4E, 0x7F, 0xCA,
+    0x29, 0xEA, 0x7F, 0xFF, 0xC7, 0xAF, 0xFF, 0x97, 0xFF, 0xFA, 0x7A, 0xFF, 0xE9, 0x70, 0xF9, 0x09,
+    0xAA, 0xA9, 0x71, 0x9F, 0x77, 0x0F, 0xA7, 0x79, 0xF7, 0x70, 0xFA, 0x77, 0x9F, 0x77, 0x0F, 0xA7,
+    0x77, 0x75, 0x77, 0x70, 0x9A, 0xDA, 0x1E, 0x94, 0x9F, 0xEA, 0xE4, 0x9F, 0xFF, 0x4E, 0x91, 0x9F,
+    0xC9, 0x3E, 0x93, 0xFC, 0x39, 0xDA, 0x4A, 0xEA, 0x3A, 0xD5, 0xF9, 0x3D, 0xA5, 0xF3, 0x9D, 0x94,
+    0x9E, 0xA3, 0xAD, 0x94, 0xF9, 0x3A, 0xDA, 0x29, 0xFC, 0x4A, 0xFF, 0xEA, 0x49, 0xFF, 0xE9, 0x5F,
+    0xFE, 0x69, 0xFF, 0xD7, 0x0A, 0xDA, 0x9A, 0xDA, 0xAD, 0x97, 0x1F, 0xE7, 0x2F, 0xDA, 0x71, 0xAF,
+    0xD9, 0x71, 0xFA, 0x97, 0x29, 0xCA, 0x97, 0x77, 0x00, 0x5E, 0xA9, 0xE9, 0x49, 0xFF, 0x94, 0xAF,
+    0xF9, 0x4F, 0xDA, 0xAA, 0x94, 0xFA, 0x70, 0x9F, 0x71, 0xAE, 0x72, 0xF7, 0x19, 0xEA, 0x71, 0xAE,
+    0x97, 0x1F, 0x97, 0x09, 0xF7, 0x1F, 0xC7, 0x1F, 0xC7, 0x0A, 0xFC, 0x70, 0xAA, 0xAD, 0xA7, 0x77,
+    0x6A, 0xFC, 0xA9, 0x59, 0xFF, 0xC5, 0xEA, 0x99, 0x9A, 0xC9, 0x49, 0xDA, 0x73, 0x9D, 0x97, 0x39,
+    0xE9, 0x73, 0xFD, 0xA7, 0x1F, 0xE9, 0x70, 0x9F, 0xD7, 0x3A, 0xEA, 0x72, 0xAF, 0x3D, 0x92, 0x9F,
+    0xA2, 0xFF, 0xF2, 0xFF, 0xFA, 0x19, 0xFF, 0xE9, 0x49, 0xAF, 0xCA, 0x97, 0x74, 0x77, 0x49, 0xA9,
+    0x79, 0xE7, 0x0F, 0x70, 0xEA, 0x79, 0xE5, 0x9F, 0xFD, 0x1F, 0xFE, 0x0F, 0xFF, 0x3F, 0x70, 0xEA,
+    0x79, 0xE9, 0x7A, 0xE7, 0x0E, 0xA7, 0x0E, 0x97, 0xAE, 0x70, 0xFF, 0x4F, 0xF4, 0xFF, 0x4F, 0xF2,
+    0x19, 0xE5, 0xAE, 0x1A, 0xDA, 0x5E, 0xA1, 0xE9, 0x49, 0xE9, 0x1E, 0x94, 0xAE, 0x2E, 0x5F, 0x19,
+    0xE5, 0xEA, 0x1A, 0xE4, 0xAE, 0xA1, 0xAD, 0xA4, 0xF9, 0x1E, 0x93, 0x9F, 0x2E, 0x93, 0xFC, 0x2F,
+    0x91, 0xAF, 0xA2, 0xFF, 0xF9, 0x2F, 0xFF, 0x3F, 0xFF, 0x3A, 0xFF, 0xDA, 0x49, 0xAE, 0xA7, 0x0E,
+    0xA7, 0xAE, 0x90, 0xF6, 0x9E, 0xA1, 0xF6, 0xF2, 0xAE, 0x94, 0xAE, 0x92, 0x9E, 0xA3, 0x9E, 0xA3,
+    0x9F, 0x3F, 0x5F, 0x2F, 0x6F, 0x90, 0xAE, 0xA6, 0xFA, 0x9F, 0x7A, 0xFF, 0x70, 0x9F, 0xE9, 0x70,
+    0x9F, 0xE7, 0x19, 0xFD, 0x97, 0x19, 0xFD, 0x72, 0x9F, 0xCA, 0x70, 0x9E, 0xA7, 0x29, 0xEA, 0x9E,
+    0xA7, 0x2F, 0x09, 0xEA, 0x71, 0xAE, 0x90, 0x9E, 0xA2, 0xAD, 0x3F, 0x19, 0xEA, 0x19, 0xE9, 0x1A,
+    0xE9, 0x19, 0xEA, 0x09, 0xFA, 0x09, 0xF2, 0x9E, 0xA0, 0xFD, 0x0F, 0x92, 0x9F, 0xFE, 0xAF, 0x39,
+    0xFF, 0xFE, 0x93, 0x9F, 0xFF, 0xE4, 0x9F, 0xFF, 0xD9, 0x49, 0xFD, 0xAF, 0xDA, 0x59, 0xFC, 0xA0,
+    0xFD, 0x69, 0xFC, 0x1A, 0xFA, 0x69, 0xF2, 0x9F, 0x77, 0x74, 0x59, 0xF4, 0xF9, 0x6F, 0x92, 0xF7,
+    0x0A, 0xF1, 0xF7, 0x2F, 0xAF, 0x73, 0xAF, 0xE7, 0x5F, 0xD7, 0x6F, 0xC7, 0x6A, 0xFC, 0x97, 0x4F,
+    0xF7, 0x3F, 0xFC, 0x97, 0x1F, 0xC0, 0xFC, 0x79, 0xFC, 0x1A, 0xF9, 0x59, 0xFA, 0x29, 0xFC, 0x4A,
+    0xFA, 0x4F, 0xC9, 0x20, 0x4F, 0x6F, 0x5F, 0x5A, 0xE6, 0xF9, 0x4E, 0xA6, 0xAE, 0xA3, 0xAE, 0x79,
+    0xF2, 0x9E, 0x97, 0x0F, 0x91, 0xF7, 0x1F, 0xA0, 0x9E, 0x97, 0x1A, 0xF0, 0xEA, 0x72, 0x9F, 0xF7,
+    0x4F, 0xEA, 0x74, 0xFE, 0x75, 0xAF, 0xC9, 0x75, 0x9F, 0xC7, 0x7F, 0x77, 0xAE, 0xA7, 0x6A, 0xF7,
+    0x39, 0x9A, 0xFC, 0x97, 0x2F, 0xFA, 0x73, 0xFF, 0x73, 0x9F, 0xDA, 0x74, 0xAF, 0xA7, 0x60, 0x6F,
+    0xFE, 0x95, 0x9F, 0xFE, 0x95, 0xAF, 0xFE, 0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x74, 0xFC, 0x73, 0x9F,
+    0xA7, 0x3A, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC9, 0x72, 0x9F, 0xC7, 0x39, 0xFD, 0xAA, 0xAA, 0xA6,
+    0xFF, 0xFA, 0x49, 0xFF, 0xFC, 0x4F, 0xFF, 0xD3, 0x77, 0x71, 0x9A, 0xFC, 0x70, 0xAF, 0xD9, 0x7A,
+    0xFE, 0x70, 0xFA, 0x72, 0x9E, 0xA7, 0x3F, 0x97, 0x3F, 0x73, 0x9E, 0xA7, 0x3F, 0x97, 0x29, 0xF7,
+    0x0A, 0xFD, 0xA7, 0x0A, 0xFC, 0xA7, 0x1F, 0xD7, 0x2F, 0xD7, 0x4F, 0x74, 0xF7, 0x39, 0xF7, 0x3A,
+    0xE9, 0x73, 0xF7, 0x4F, 0x73, 0x9F, 0xE7, 0x09, 0xFE, 0x71, 0xFD, 0xA7, 0x2A, 0xF9, 0x77, 0x70,
+    0x6A, 0xDA, 0x6E, 0x7E, 0x69, 0xDA, 0x6E, 0x96, 0xE6, 0x9D, 0xA6, 0xAD, 0x96, 0xE6, 0x9E, 0x6A,
+    0xDA, 0x6E, 0x7E, 0x69, 0xDA, 0x6E, 0x96, 0xE6, 0x9D, 0xA6, 0xAD, 0x96, 0xE6, 0x9E, 0x6A, 0xDA,
+    0x6E, 0x96, 0xAA, 0xA6, 0x77, 0x7F, 0xCA, 0x70, 0x9F, 0xE7, 0xAF, 0xE7, 0x2A, 0xF7, 0x2A, 0xEA,
+    0x72, 0xF9, 0x72, 0xF7, 0x29, 0xEA, 0x72, 0xAE, 0x97, 0x2F, 0xA7, 0x2F, 0xDA, 0x70, 0xFD, 0x71,
+    0xAF, 0xC7, 0x0A, 0xFC, 0xA7, 0x0F, 0x72, 0xAE, 0x97, 0x2F, 0x72, 0x9F, 0x72, 0xAE, 0x97, 0x2F,
+    0x7A, 0xFD, 0xA7, 0xFE, 0x7A, 0xFD, 0x70, 0xFA, 0x97, 0x77, 0x00, 0x1A, 0xD9, 0x09, 0xD1, 0xAF,
+    0x09, 0xD1, 0xDA, 0xFC, 0xA0, 0xAD, 0x09, 0xF1, 0x9D, 0x1A, 0xD9, 0x10, 0x49, 0xFD, 0x5A, 0xFD,
+    0x5A, 0xFC, 0x95, 0xFD, 0x6F, 0xCA, 0x6F, 0xC7, 0xFC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6A, 0xA7,
+    0x09, 0xD9, 0x7F, 0x70, 0xF7, 0x9E, 0xA7, 0x9E, 0x97, 0xAE, 0x70, 0xF7, 0x0E, 0xA7, 0x0E, 0x97,
+    0x9E, 0x97, 0x9E, 0x70, 0xAE, 0x70, 0xEA, 0x70, 0xE9, 0x70, 0xE7, 0x09, 0xD7, 0x19, 0xA7, 0x77,
+    0x77, 0x7D, 0x72, 0x9D, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x09, 0xAF, 0x95, 0xFF, 0x39, 0xFF, 0xA3,
+    0xFD, 0xA0, 0x99, 0x2F, 0x0D, 0x94, 0x9E, 0x90, 0xD5, 0xF1, 0xD5, 0xEA, 0x09, 0xCA, 0x49, 0xE9,
+    0x0A, 0xCA, 0x49, 0xE9, 0x0D, 0x94, 0xAE, 0xA0, 0xD9, 0x49, 0xFF, 0xA4, 0xFF, 0xC9, 0x39, 0xFF,
+    0xC5, 0xAF, 0xCA, 0x70, 0xD7, 0x3D, 0x72, 0x9C, 0xA7, 0x29, 0xA9, 0x50, 0x77, 0x77, 0x76, 0x9A,
+    0xF9, 0x72, 0xFF, 0xC7, 0x9F, 0xFD, 0xA6, 0xF9, 0x29, 0xE6, 0xE7, 0x7D, 0xA7, 0x7D, 0xA7, 0x7D,
+    0xA7, 0x7E, 0x77, 0xE7, 0x4F, 0xFF, 0x94, 0x9F, 0xFF, 0x59, 0xAA, 0xAF, 0xAA, 0xAA, 0xA7, 0x1E,
+    0x97, 0x59, 0xE9, 0x74, 0xAF, 0x72, 0x9A, 0xFC, 0x97, 0x2F, 0xFD, 0xA9, 0x94, 0x9F, 0xFF, 0xC9,
+    0x3A, 0xFF, 0xFD, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x30, 0x77, 0x5A, 0xC9, 0x5A,
+    0x5A, 0xFD, 0x99, 0xDA, 0x3A, 0xFF, 0xF9, 0x3F, 0xFE, 0xA4, 0xF9, 0x0A, 0xE9, 0x4A, 0xE9, 0x2E,
+    0x94, 0xF2, 0x9E, 0x94, 0xF9, 0x0A, 0xF5, 0xFF, 0xDA, 0x4F, 0xFF, 0x29, 0xFF, 0xFC, 0xA2, 0xFF,
+    0xFC, 0x39, 0xD2, 0x91, 0xAD, 0x59, 0x79, 0x40, 0x3F, 0x96, 0x9F, 0x4A, 0xF5, 0xAF, 0x6F, 0xA3,
+    0xAF, 0x7A, 0xF9, 0x1F, 0xC7, 0x09, 0xFC, 0x9F, 0xC7, 0x2F, 0xFD, 0x73, 0x9F, 0xF7, 0x5F, 0xE7,
+    0x69, 0xFC, 0x77, 0x9F, 0xE7, 0x2F, 0xFE, 0x97, 0x0A, 0xFF, 0xE9, 0x79, 0xFF, 0xA9, 0x97, 0x59,
+    0xF7, 0x70, 0xFC, 0x09, 0x72, 0x9F, 0xFD, 0xA7, 0x1F, 0xFF, 0x70, 0xFF, 0xFC, 0x74, 0xFA, 0x77,
+    0x9F, 0x97, 0x7A, 0xF7, 0x77, 0x72, 0x69, 0xAA, 0x6D, 0x95, 0x9D, 0x6D, 0xA6, 0xD9, 0x59, 0xD6,
+    0xAD, 0x6C, 0xA9, 0x77, 0x77, 0x75, 0xAC, 0x6E, 0x6D, 0x95, 0x9D, 0x6A, 0xD6, 0xDA, 0x59, 0xD9,
+    0x5A, 0xD6, 0xDA, 0x6A, 0x96, 0x73, 0x9A, 0xAA, 0x74, 0xAF, 0xD9, 0x71, 0xAF, 0xF9, 0x70, 0xE9,
+    0x19, 0xD7, 0x0A, 0xD4, 0xA9, 0x70, 0xAD, 0xA7, 0x6A, 0xFC, 0xA9, 0x70, 0x9F, 0xFC, 0x96, 0x9F,
+    0xFE, 0x6F, 0x90, 0x9A, 0xF5, 0xAD, 0xA5, 0xAD, 0x5E, 0x6A, 0xD5, 0xFA, 0xAA, 0xAA, 0xEA, 0x5F,
+    0xFF, 0x69, 0xFF, 0xD7, 0x09, 0xAF, 0xE7, 0x5A, 0xEA, 0x76, 0xAE, 0x69, 0xD9, 0x29, 0xE9, 0x59,
+    0xFF, 0xE6, 0xFF, 0xE7, 0x9A, 0xFD, 0xA9, 0x70, 0x29, 0x99, 0x92, 0x99, 0x99, 0x19, 0xEA, 0x1A,
+    0xE9, 0x1F, 0xA1, 0xF9, 0x09, 0xF9, 0x09, 0xF1, 0xAF, 0x90, 0xFC, 0x1F, 0xC0, 0x9F, 0xC0, 0x4A,
+    0xEA, 0x59, 0xFE, 0x39, 0xDA, 0x90, 0x9D, 0x92, 0xFC, 0xA0, 0x9D, 0x1A, 0xE9, 0x29, 0xD1, 0xF3,
+    0x9C, 0xA1, 0xF3, 0xD9, 0x1D, 0x9E, 0x0A, 0xD2, 0xAD, 0x90, 0x9E, 0x4F, 0xE9, 0x5A, 0xE9, 0x40,
+    0x75, 0xAC, 0xAA, 0xC3, 0xDA, 0xE2, 0xAC, 0x19, 0xCA, 0x2C, 0x91, 0x9C, 0x91, 0x9C, 0x29, 0xC9,
+    0x1A, 0xC9, 0x9A, 0xD2, 0x9F, 0xD3, 0xAD, 0xAC, 0xA1, 0x77, 0x71, 0x9A, 0x49, 0xC7, 0xD9, 0x3A,
+    0xCA, 0x59, 0xE2, 0x9E, 0x94, 0xF9, 0x1A, 0xEA, 0x39, 0xEA, 0x2F, 0x49, 0xE9, 0x2E, 0xA5, 0xF2,
+    0xF9, 0x5F, 0xC1, 0xAF, 0x6F, 0xA1, 0xFC, 0x59, 0xF2, 0xF9, 0x5A, 0xD9, 0x29, 0xE7, 0xD4, 0xAC,
+    0x97, 0x09, 0x5A, 0x40, 0x1A, 0x99, 0x97, 0x09, 0xFF, 0xDA, 0x90, 0xAF, 0xFE, 0xA0, 0xFF, 0xF9,
+    0x49, 0x99, 0x9F, 0x71, 0xF7, 0x1E, 0xA7, 0x0A, 0xE9, 0x70, 0xF9, 0x00, 0x0A, 0xFF, 0xF1, 0xFF,
+    0xFC, 0x1F, 0xFF, 0xA0, 0x77, 0x09, 0xAE, 0xA5, 0xAF, 0xDA, 0x3A, 0xFA, 0x9D, 0x91, 0x9E, 0x1C,
+    0x09, 0xCA, 0x1D, 0xAC, 0x0A, 0x90, 0xAC, 0xA1, 0xDA, 0xE1, 0xDA, 0x1E, 0xA9, 0xC0, 0xAD, 0x2E,
+    0x99, 0xF9, 0x29, 0xFE, 0x94, 0x9F, 0xA7, 0x71, 0x74, 0xFF, 0xA0, 0xFF, 0xD9, 0xA9, 0x99, 0x99,
+    0x99, 0x10, 0x77, 0x29, 0xAD, 0xA9, 0x6F, 0xE9, 0x4F, 0xFC, 0x3F, 0x91, 0xE9, 0x19, 0xE3, 0xE9,
+    0x19, 0xE2, 0xAE, 0x2A, 0xFF, 0xCA, 0x3F, 0xFC, 0x4A, 0xFD, 0xA6, 0x9A, 0xDA, 0x94, 0x73, 0x99,
+    0x97, 0x6E, 0xA7, 0x6E, 0x97, 0x59, 0xE7, 0x19, 0xAA, 0xAA, 0xFA, 0xAA, 0x95, 0xFF, 0xFA, 0x49,
+    0xFF, 0xF9, 0x71, 0xEA, 0x76, 0xE9, 0x75, 0x9E, 0x76, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x71, 0x9A,
+    0xAA, 0xAF, 0xD6, 0x9F, 0xFE, 0x95, 0xFF, 0xF9, 0x77, 0x70, 0x19, 0xAD, 0xA3, 0xDA, 0xAC, 0x96,
+    0xCA, 0x5D, 0x49, 0xD9, 0x29, 0xE9, 0x3F, 0xC9, 0x1A, 0xFC, 0x91, 0x49, 0x95, 0xAF, 0x93, 0x92,
+    0xCA, 0x7C, 0xA4, 0xAA, 0xD4, 0xAE, 0xA7, 0xD3, 0xA9, 0x9A, 0xD2, 0x9F, 0xC9, 0x2A, 0xF9, 0x20,
+    0x3E, 0x3A, 0xD9, 0x29, 0xDA, 0x3E, 0x3E, 0xA7, 0x20, 0x59, 0xE9, 0x4A, 0xE5, 0xAE, 0x5E, 0xA5,
+    0xEA, 0x49, 0xE9, 0x5E, 0x94, 0xAE, 0x6E, 0x5F, 0x5A, 0xE5, 0xEA, 0x5F, 0x4A, 0xEA, 0x49, 0xEA,
+    0x4F, 0x94, 0xAE, 0x93, 0x9F, 0x5F, 0x93, 0xFC, 0x49, 0xFC, 0x91, 0xAF, 0xA4, 0xFF, 0xFD, 0x94,
+    0xFF, 0xFD, 0x4A, 0xFF, 0xFD, 0x4F, 0xFF, 0xDA, 0x39, 0xE0, 0x9F, 0xA7, 0x0A, 0xDA, 0x77, 0xE7,
+    0x77, 0x73, 0x7A, 0xAE, 0x09, 0xE6, 0xAF, 0xD0, 0xAE, 0x5A, 0xFD, 0x90, 0xEA, 0x49, 0xFE, 0x1E,
+    0x94, 0xFE, 0xA0, 0x9E, 0x5F, 0xE9, 0x09, 0xE5, 0xFE, 0x1A, 0xDA, 0x5A, 0xFC, 0xA1, 0xE9, 0x6F,
+    0xC9, 0x1E, 0x79, 0xF1, 0x9E, 0x7F, 0xA1, 0xAD, 0xA6, 0x9F, 0x91, 0xE9, 0x6F, 0xC2, 0xE7, 0xFA,
+    0x19, 0xE6, 0xAF, 0x91, 0xAD, 0xA6, 0xFC, 0x2E, 0x95, 0xAF, 0xA2, 0xE6, 0xFC, 0x91, 0x9E, 0x5A,
+    0xFC, 0x2A, 0xDA, 0x5F, 0xCA, 0x2E, 0x94, 0x9F, 0xC9, 0x2E, 0x59, 0x99, 0x99, 0x93, 0x99, 0x95,
+    0x1A, 0xE9, 0x1F, 0x19, 0xF1, 0xFC, 0x09, 0xFC, 0x09, 0x99, 0x99, 0x90, 0x2A, 0xCA, 0x4D, 0x4A,
+    0xDA, 0x3F, 0xA1, 0x99, 0x0A, 0xD1, 0xAF, 0xA1, 0xFC, 0x2A, 0xAA, 0x92, 0x29, 0xD3, 0xE2, 0x99,
+    0xCA, 0x39, 0xC9, 0x3D, 0x4D, 0x39, 0xCA, 0x19, 0xFC, 0x9A, 0xFC, 0x00, 0x2A, 0xDA, 0x3D, 0xAA,
+    0xD1, 0xAC, 0xA1, 0xD1, 0xD2, 0xD0, 0x9C, 0xA1, 0x9C, 0xA0, 0x9D, 0xAA, 0xD9, 0x1F, 0xCA, 0x29,
+    0xE9, 0x20, 0x77, 0x2C, 0x94, 0xA9, 0x70, 0xDA, 0x39, 0xD7, 0x9E, 0x3E, 0x96, 0xAE, 0xA1, 0x9E,
+    0xA7, 0xF2, 0xAE, 0x96, 0xAE, 0x29, 0xE9, 0x59, 0xF2, 0xF5, 0xFA, 0x1F, 0xC4, 0xFC, 0x1A, 0xF4,
+    0x9F, 0x2F, 0x95, 0xE9, 0x2A, 0xDA, 0x69, 0xCA, 0x4D, 0x70, 0xA5, 0x94, 0x5A, 0xD7, 0x74, 0xAE,
+    0xA7, 0x74, 0xF9, 0x74, 0xE3, 0x9A, 0x9D, 0x74, 0xE6, 0xAD, 0x73, 0xE9, 0x6D, 0xA7, 0x2E, 0x96,
+    0x9D, 0x97, 0x1A, 0xDA, 0x7A, 0xD7, 0x1A, 0xE7, 0x0E, 0x70, 0xAE, 0x70, 0x9D, 0xA7, 0x9E, 0x7F,
+    0xF4, 0x9E, 0x91, 0x9D, 0x2F, 0xF4, 0xE9, 0x19, 0xE1, 0x9F, 0xE9, 0x3E, 0xA1, 0x9E, 0xA7, 0x5E,
+    0xA1, 0x9C, 0xAD, 0x97, 0x4F, 0x19, 0xCA, 0x9D, 0x74, 0xF1, 0x9D, 0x0A, 0xD7, 0x3A, 0xE1, 0x9D,
+    0x1E, 0x97, 0x1A, 0xE9, 0x09, 0xFF, 0xC7, 0x09, 0xE9, 0x1F, 0xFC, 0xA7, 0x9E, 0xA7, 0xE7, 0x09,
+    0xEA, 0x79, 0xE7, 0x0F, 0x70, 0xAD, 0xA7, 0xAA, 0xAA, 0x77, 0x10, 0x5A, 0xD7, 0x76, 0xAE, 0xA7,
+    0x76, 0xF9, 0x74, 0xE5, 0x9A, 0x9D, 0x74, 0xE9, 0x7A, 0xD7, 0x3E, 0x97, 0x0D, 0xA7, 0x2A, 0xDA,
+    0x70, 0x9D, 0x97, 0x1A, 0xDA, 0x71, 0xAD, 0x71, 0xAE, 0x72, 0xE7, 0x0A, 0xE7, 0x29, 0xDA, 0x79,
+    0xE3, 0x94, 0xFF, 0x49, 0xE1, 0xAF, 0xC2, 0xFF, 0x39, 0xE9, 0x09, 0xFE, 0x09, 0xFE, 0x93, 0xE9,
+    0x1C, 0xA9, 0x19, 0xD9, 0x73, 0xEA, 0x70, 0xD9, 0x72, 0xEA, 0x70, 0xE7, 0x2F, 0x70, 0xEA, 0x71,
+    0xF7, 0x9E, 0xA7, 0x1A, 0xE6, 0x9F, 0xA7, 0x1A, 0xE9, 0x5A, 0xFA, 0x71, 0xAE, 0x95, 0xAF, 0xEA,
+    0x69, 0xEA, 0x6F, 0xFA, 0x59, 0xEA, 0x6A, 0xFF, 0x95, 0x99, 0x99, 0x77, 0x30, 0x39, 0xAE, 0xA7,
+    0x73, 0xFE, 0x77, 0x19, 0x93, 0xD9, 0x71, 0xE7, 0x1D, 0x97, 0x0E, 0x70, 0x9A, 0xD7, 0x0E, 0x95,
+    0xAF, 0xA7, 0x0E, 0x96, 0xFC, 0xA7, 0xAD, 0xA7, 0x2A, 0xD6, 0xAE, 0x73, 0x9D, 0x5A, 0xE7, 0xCA,
+    0x99, 0xAE, 0x49, 0xE7, 0xAF, 0xEA, 0x39, 0xE9, 0x19, 0xD2, 0xFF, 0x4E, 0x91, 0x9E, 0x2A, 0xFC,
+    0xA4, 0xEA, 0x19, 0xEA, 0x75, 0xEA, 0x19, 0xCA, 0xD9, 0x74, 0xF1, 0x9C, 0xA9, 0xD7, 0x4F, 0x19,
+    0xCA, 0x0A, 0xD7, 0x3A, 0xE1, 0x9D, 0x09, 0xE7, 0x2A, 0xE9, 0x09, 0xFF, 0xC7, 0x09, 0xE9, 0x1F,
+    0xFC, 0xA7, 0x9E, 0xA3, 0x99, 0x99, 0xE9, 0x79, 0xEA, 0x70, 0xE7, 0x0F, 0x70, 0xAD, 0xA7, 0xAA,
+    0xAA, 0x77, 0x10, 0x74, 0xFC, 0x74, 0x9F, 0xA7, 0x49, 0xF7, 0x5A, 0xF7, 0x5A, 0xE9, 0x75, 0x99,
+    0x99, 0x77, 0x77, 0x77, 0x77, 0x70, 0x99, 0x75, 0x9A, 0xE7, 0x4A, 0xF9, 0x74, 0xFC, 0x75, 0xFA,
+    0x74, 0xAF, 0x97, 0x3F, 0xD7, 0x29, 0xFD, 0xA7, 0x1A, 0xFC, 0xA7, 0x29, 0xF9, 0x74, 0xF7, 0x5A,
+    0xE9, 0x75, 0xF7, 0x6E, 0x97, 0x59, 0xE7, 0x69, 0xE7, 0x95, 0x9E, 0x6D, 0x6E, 0xA2, 0x9F, 0xC5,
+    0xAF, 0xFE, 0x96, 0xAF, 0xFA, 0x71, 0x9A, 0xF9, 0x77, 0x72, 0x74, 0xF7, 0x72, 0xF7, 0x71, 0x9F,
+    0x77, 0x1A, 0xF9, 0x77, 0x19, 0x99, 0x97, 0x77, 0x77, 0x77, 0x29, 0xEA, 0x77, 0x0F, 0xA7, 0x7A,
+    0xFC, 0x76, 0x9F, 0xD7, 0x6F, 0xE7, 0x5A, 0xEA, 0xE7, 0x49, 0xE9, 0xAE, 0x97, 0x3F, 0x09, 0xE9,
+    0x72, 0xAE, 0x90, 0x9E, 0xA7, 0x19, 0xEA, 0x19, 0xEA, 0x71, 0xF2, 0x9F, 0x70, 0xFA, 0x29, 0xF7,
+    0x9F, 0x4F, 0x7F, 0xCA, 0xAA, 0xAA, 0xF6, 0xFF, 0xFE, 0x94, 0x9F, 0xFF, 0xE9, 0x4F, 0xFF, 0xFA,
+    0x3F, 0xFF, 0xFC, 0xA2, 0x9F, 0xA7, 0xFC, 0x2F, 0xC7, 0x0F, 0xC1, 0xFC, 0x97, 0x9F, 0xC0, 0x77,
+    0x29, 0xD9, 0x77, 0x2E, 0x77, 0x2E, 0x77, 0x2A, 0xDA, 0x77, 0x19, 0xE7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0xEA, 0x77, 0x1F, 0xA7, 0x70, 0xAF, 0xC7, 0x79, 0xFD, 0x77,
+    0xFE, 0x76, 0xAE, 0xAE, 0x75, 0x9E, 0x9A, 0xE9, 0x74, 0xF0, 0x9E, 0x97, 0x3A, 0xE9, 0x09, 0xEA,
+    0x72, 0x9E, 0xA1, 0x9E, 0xA7, 0x2F, 0x29, 0xF7, 0x1F, 0xA2, 0x9F, 0x70, 0x9F, 0x4F, 0x70, 0xFC,
+    0xAA, 0xAA, 0xAF, 0x7F, 0xFF, 0xE9, 0x59, 0xFF, 0xFE, 0x95, 0xFF, 0xFF, 0xA4, 0xFF, 0xFF, 0xCA,
+    0x39, 0xFA, 0x7F, 0xC3, 0xFC, 0x70, 0xFC, 0x2F, 0xC9, 0x79, 0xFC, 0x10, 0x74, 0xAD, 0x77, 0x3F,
+    0x77, 0x1A, 0xFC, 0x77, 0x9F, 0xE9, 0x75, 0xEA, 0x0A, 0xE9, 0x73, 0xEA, 0x3A, 0xDA, 0x77, 0x77,
+    0x77, 0x74, 0x9E, 0xA7, 0x71, 0xFA, 0x77, 0x0A, 0xFC, 0x77, 0x9F, 0xD7, 0x7F, 0xE7, 0x6A, 0xEA,
+    0xE7, 0x59, 0xE9, 0xAE, 0x97, 0x4F, 0x09, 0xE9, 0x73, 0xAE, 0x90, 0x9E, 0xA7, 0x29, 0xEA, 0x19,
+    0xEA, 0x72, 0xF2, 0x9F, 0x71, 0xFA, 0x29, 0xF7, 0x09, 0xF4, 0xF7, 0x0F, 0xCA, 0xAA, 0xAA, 0xF7,
+    0xFF, 0xFE, 0x95, 0x9F, 0xFF, 0xE9, 0x5F, 0xFF, 0xFA, 0x4F, 0xFF, 0xFC, 0xA3, 0x9F, 0xA7, 0xFC,
+    0x3F, 0xC7, 0x0F, 0xC2, 0xFC, 0x97, 0x9F, 0xC1, 0x77, 0x99, 0x77, 0x29, 0xE9, 0x09, 0xCA, 0x75,
+    0xFC, 0x0A, 0xD7, 0x49, 0xD0, 0xFC, 0x97, 0x4D, 0xA0, 0xAF, 0x75, 0xAC, 0xA1, 0xAD, 0x77, 0x77,
+    0x77, 0x75, 0x9E, 0xA7, 0x71, 0xFA, 0x77, 0x0A, 0xFC, 0x77, 0x9F, 0xD7, 0x7F, 0xE7, 0x6A, 0xEA,
+    0xE7, 0x59, 0xE9, 0xAE, 0x97, 0x4F, 0x09, 0xE9, 0x73, 0xAE, 0x90, 0x9E, 0xA7, 0x29, 0xEA, 0x19,
+    0xEA, 0x72, 0xF2, 0x9F, 0x71, 0xFA, 0x29, 0xF7, 0x09, 0xF4, 0xF7, 0x0F, 0xCA, 0xAA, 0xAA, 0xF7,
+    0xFF, 0xFE, 0x95, 0x9F, 0xFF, 0xE9, 0x5F, 0xFF, 0xFA, 0x4F, 0xFF, 0xFC, 0xA3, 0x9F, 0xA7, 0xFC,
+    0x3F, 0xC7, 0x0F, 0xC2, 0xFC, 0x97, 0x9F, 0xC1, 0x75, 0x99, 0x99, 0x29, 0x99, 0x75, 0x9E, 0xA1,
+    0xAE, 0x97, 0x4F, 0x91, 0xF7, 0x49, 0xF9, 0x0A, 0xF7, 0x4F, 0xC1, 0xFC, 0x73, 0x9F, 0xC0, 0x9F,
+    0xC7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xEA, 0x77, 0x3F, 0xA7, 0x72, 0xAF, 0xC7, 0x71, 0x9F,
+    0xD7, 0x71, 0xFE, 0x77, 0x0A, 0xEA, 0xE7, 0x79, 0xE9, 0xAE, 0x97, 0x6F, 0x09, 0xE9, 0x75, 0xAE,
+    0x90, 0x9E, 0xA7, 0x49, 0xEA, 0x19, 0xEA, 0x74, 0xF2, 0x9F, 0x73, 0xFA, 0x29, 0xF7, 0x29, 0xF4,
+    0xF7, 0x2F, 0xCA, 0xAA, 0xAA, 0xF7, 0x1F, 0xFF, 0xE9, 0x79, 0xFF, 0xFE, 0x97, 0xFF, 0xFF, 0xA6,
+    0xFF, 0xFF, 0xCA, 0x59, 0xFA, 0x7F, 0xC5, 0xFC, 0x70, 0xFC, 0x4F, 0xC9, 0x79, 0xFC, 0x30, 0x77,
+    0x0A, 0xD9, 0x77, 0x0F, 0xC7, 0x79, 0xD9, 0xD7, 0x7A, 0xCA, 0x9D, 0x77, 0xAF, 0xC7, 0x79, 0xF9,
+    0x77, 0x09, 0xAA, 0x77, 0x77, 0x77, 0x74, 0x9E, 0xA7, 0x70, 0xFA, 0x77, 0xAF, 0xC7, 0x69, 0xFD,
+    0x76, 0xFE, 0x75, 0xAE, 0xAE, 0x74, 0x9E, 0x9A, 0xE9, 0x73, 0xF0, 0x9E, 0x97, 0x2A, 0xE9, 0x09,
+    0xEA, 0x71, 0x9E, 0xA1, 0x9E, 0xA7, 0x1F, 0x29, 0xF7, 0x0F, 0xA2, 0x9F, 0x79, 0xF4, 0xF7, 0xFC,
+    0xAA, 0xAA, 0xAF, 0x6F, 0xFF, 0xE9, 0x49, 0xFF, 0xFE, 0x94, 0xFF, 0xFF, 0xA3, 0xFF, 0xFF, 0xCA,
+    0x29, 0xFA, 0x7F, 0xC2, 0xFC, 0x70, 0xFC, 0x1F, 0xC9, 0x79, 0xFC, 0x00, 0x77, 0x19, 0x9A, 0xAA,
+    0xAA, 0xAA, 0xFE, 0x77, 0x1A, 0xFF, 0xFE, 0x97, 0x70, 0xAF, 0xFF, 0xF7, 0x70, 0x9F, 0xFE, 0xAA,
+    0xAA, 0xA7, 0x70, 0x9F, 0xF7, 0x77, 0x1F, 0xFC, 0x77, 0x70, 0xF9, 0xFA, 0x77, 0x7F, 0x09, 0xF9,
+    0x77, 0x6A, 0xE9, 0x0A, 0xFF, 0xDA, 0x77, 0x9E, 0xA1, 0xAF, 0xFD, 0x97, 0x69, 0xF2, 0xFF, 0xE7,
+    0x7F, 0x3F, 0xFA, 0xAA, 0x76, 0xF9, 0x29, 0xF9, 0x77, 0x3F, 0xCA, 0xAA, 0xAF, 0xC9, 0x77, 0x2A,
+    0xFF, 0xFD, 0x97, 0x71, 0xAF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAA, 0xA7, 0x19, 0xFF, 0xFF, 0xFF, 0x71,
+    0xFF, 0xFF, 0xFF, 0xC7, 0x0F, 0xC6, 0xFF, 0xFD, 0x7F, 0xC9, 0x5A, 0xFF, 0xFD, 0x6A, 0xF9, 0x6F,
+    0xFF, 0xE7, 0x77, 0x77, 0x00, 0x77, 0x77, 0x19, 0xAF, 0xDA, 0x97, 0x1A, 0xFF, 0xDA, 0x70, 0xFF,
+    0xF7, 0x9F, 0xFF, 0xC6, 0x9F, 0xFC, 0xAE, 0x96, 0xFD, 0xA7, 0x5F, 0xD7, 0x6A, 0xFC, 0x77, 0xFC,
+    0x77, 0xAF, 0xA7, 0x7F, 0xC9, 0x76, 0x9F, 0xC7, 0x7A, 0xFC, 0x77, 0xFD, 0x77, 0xFD, 0x77, 0xFE,
+    0x92, 0x99, 0xAC, 0x95, 0xFF, 0xFE, 0x95, 0xFF, 0xFE, 0x69, 0xFF, 0xFD, 0x7F, 0xFF, 0xCA, 0x79,
+    0xFF, 0xFA, 0x71, 0xAF, 0xFD, 0x97, 0x49, 0xD7, 0x72, 0xE9, 0x77, 0x0A, 0xF7, 0x70, 0x91, 0xD9,
+    0x77, 0xFC, 0x77, 0xAF, 0x97, 0x79, 0xAA, 0x97, 0x30, 0x71, 0x9E, 0xA7, 0x71, 0xAE, 0xA7, 0x71,
+    0xFA, 0x77, 0x1F, 0xA7, 0x72, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xAA, 0xAA, 0xAA, 0xFE,
+    0x7F, 0xFF, 0xC9, 0x69, 0xFF, 0xFA, 0x7F, 0xFA, 0xAA, 0xAA, 0x70, 0xF7, 0x70, 0x9F, 0x77, 0x0A,
+    0xEA, 0x77, 0x0F, 0x97, 0x79, 0xFA, 0xAA, 0xEA, 0x71, 0xAF, 0xFD, 0x97, 0x1F, 0xFE, 0x72, 0xFF,
+    0xDA, 0x71, 0xAF, 0x77, 0x0F, 0xA7, 0x70, 0xF9, 0x77, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF,
+    0xFD, 0x7F, 0xFF, 0xD6, 0x9F, 0xFF, 0xD6, 0xAF, 0xFF, 0xD6, 0xFF, 0xFE, 0x50, 0x77, 0x0E, 0x77,
+    0x1A, 0xD7, 0x71, 0x9D, 0xA7, 0x71, 0xE7, 0x71, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x4A, 0xAA, 0xAA, 0xAA, 0xFE, 0x7F, 0xFF, 0xC9, 0x69, 0xFF, 0xFA, 0x7F, 0xFA,
+    0xAA, 0xAA, 0x70, 0xF7, 0x70, 0x9F, 0x77, 0x0A, 0xEA, 0x77, 0x0F, 0x97, 0x79, 0xFA, 0xAA, 0xEA,
+    0x71, 0xAF, 0xFD, 0x97, 0x1F, 0xFE, 0x72, 0xFF, 0xDA, 0x71, 0xAF, 0x77, 0x0F, 0xA7, 0x70, 0xF9,
+    0x77, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD6, 0x9F, 0xFF, 0xD6, 0xAF,
+    0xFF, 0xD6, 0xFF, 0xFE, 0x50, 0x77, 0x77, 0x9D, 0xA7, 0x71, 0xAE, 0x97, 0x79, 0xFC, 0xA7, 0x6F,
+    0xF7, 0x4F, 0x1A, 0xE9, 0x71, 0xAD, 0xA4, 0xE9, 0x77, 0x77, 0x77, 0x4A, 0xAA, 0xAA, 0xAA, 0xFE,
+    0x7F, 0xFF, 0xC9, 0x69, 0xFF, 0xFA, 0x7F, 0xFA, 0xAA, 0xAA, 0x70, 0xF7, 0x70, 0x9F, 0x77, 0x0A,
+    0xEA, 0x77, 0x0F, 0x97, 0x79, 0xFA, 0xAA, 0xEA, 0x71, 0xAF, 0xFD, 0x97, 0x1F, 0xFE, 0x72, 0xFF,
+    0xDA, 0x71, 0xAF, 0x77, 0x0F, 0xA7, 0x70, 0xF9, 0x77, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF,
+    0xFD, 0x7F, 0xFF, 0xD6, 0x9F, 0xFF, 0xD6, 0xAF, 0xFF, 0xD6, 0xFF, 0xFE, 0x50, 0x72, 0x99, 0x99,
+    0x29, 0x99, 0x97, 0x2F, 0x19, 0xF7, 0x19, 0xF1, 0xAE, 0xA7, 0x1F, 0xA1, 0xFA, 0x70, 0x9F, 0xA0,
+    0xAF, 0x97, 0x0F, 0xC9, 0x0F, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xAA, 0xAA, 0xAA, 0xAF,
+    0xE7, 0xFF, 0xFC, 0x96, 0x9F, 0xFF, 0xA7, 0xFF, 0xAA, 0xAA, 0xA7, 0x0F, 0x77, 0x09, 0xF7, 0x70,
+    0xAE, 0xA7, 0x70, 0xF9, 0x77, 0x9F, 0xAA, 0xAE, 0xA7, 0x1A, 0xFF, 0xD9, 0x71, 0xFF, 0xE7, 0x2F,
+    0xFD, 0xA7, 0x1A, 0xF7, 0x70, 0xFA, 0x77, 0x0F, 0x97, 0x79, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x7F,
+    0xFF, 0xD7, 0xFF, 0xFD, 0x69, 0xFF, 0xFD, 0x6A, 0xFF, 0xFD, 0x6F, 0xFF, 0xE5, 0x59, 0x99, 0x73,
+    0xF9, 0x72, 0xF9, 0x71, 0x9F, 0x97, 0x19, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x29, 0xDA, 0xA7, 0x19,
+    0xF7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xF7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xAE, 0x97, 0x1F, 0x72,
+    0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAF, 0x71, 0xFA, 0x71, 0xF9, 0x70,
+    0x9F, 0x71, 0xFC, 0x71, 0xFC, 0x70, 0x9F, 0xA7, 0x0A, 0xFA, 0x70, 0xAA, 0xE9, 0x70, 0x73, 0x9D,
+    0x74, 0xDA, 0x73, 0xE7, 0x3A, 0xD9, 0x72, 0x9E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x70, 0x9D, 0xAA, 0x72, 0x9F, 0x72, 0xAE, 0xA7, 0x2F, 0x97, 0x2F, 0x72, 0x9F, 0x72, 0xAE, 0xA7,
+    0x2A, 0xE9, 0x72, 0xF7, 0x3F, 0x72, 0x9E, 0xA7, 0x2A, 0xE9, 0x72, 0xF7, 0x29, 0xF7, 0x2A, 0xF7,
+    0x2F, 0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x2F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0xA7, 0x1A,
+    0xAE, 0x97, 0x00, 0x77, 0x5E, 0x73, 0x9F, 0x72, 0xFD, 0x70, 0xFF, 0x95, 0xAE, 0x90, 0x9E, 0xA3,
+    0x9E, 0x4A, 0xE7, 0x77, 0x77, 0x76, 0x9D, 0xAA, 0x72, 0x9F, 0x72, 0xAE, 0xA7, 0x2F, 0x97, 0x2F,
+    0x72, 0x9F, 0x72, 0xAE, 0xA7, 0x2A, 0xE9, 0x72, 0xF7, 0x3F, 0x72, 0x9E, 0xA7, 0x2A, 0xE9, 0x72,
+    0xF7, 0x29, 0xF7, 0x2A, 0xF7, 0x2F, 0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x2F, 0xC7, 0x2F, 0xC7, 0x19,
+    0xFA, 0x71, 0xAF, 0xA7, 0x1A, 0xAE, 0x97, 0x00, 0x59, 0xE9, 0x1A, 0xE6, 0xF9, 0x1F, 0x59, 0xF1,
+    0xAF, 0x5F, 0xC1, 0xFC, 0x5F, 0xC0, 0x9F, 0xA4, 0x99, 0x99, 0x99, 0x09, 0x99, 0x99, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x69, 0xDA, 0xA7, 0x49, 0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x74, 0xF7, 0x49, 0xF7,
+    0x4A, 0xEA, 0x74, 0xAE, 0x97, 0x4F, 0x75, 0xF7, 0x49, 0xEA, 0x74, 0xAE, 0x97, 0x4F, 0x74, 0x9F,
+    0x74, 0xAF, 0x74, 0xFA, 0x74, 0xF9, 0x73, 0x9F, 0x74, 0xFC, 0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x3A,
+    0xFA, 0x73, 0xAA, 0xE9, 0x72, 0x6A, 0xFF, 0xCA, 0x97, 0x4F, 0xFF, 0xCA, 0x72, 0xFF, 0xFE, 0x70,
+    0x9F, 0xFF, 0xEA, 0x7A, 0xF1, 0x99, 0x9A, 0xFD, 0x7F, 0xA6, 0xAF, 0x95, 0x9F, 0x70, 0xF9, 0x5A,
+    0xF7, 0x0A, 0xE9, 0x5F, 0xA7, 0x0A, 0xE1, 0x9F, 0xFF, 0x94, 0xF1, 0xAF, 0xFF, 0x5E, 0xA1, 0xFF,
+    0xFA, 0x4A, 0xE9, 0x5F, 0xA7, 0x9F, 0x6F, 0x96, 0xAF, 0xC5, 0x9F, 0x39, 0x9A, 0xFD, 0x95, 0xAF,
+    0xFF, 0xFC, 0x6F, 0xFF, 0xFC, 0x96, 0xFF, 0xFF, 0xA6, 0x9F, 0xFF, 0xEA, 0x7F, 0xFF, 0xE9, 0x70,
+    0xFF, 0xEA, 0xA9, 0x70, 0x76, 0xDA, 0x1A, 0xC9, 0x77, 0xFA, 0x0D, 0xA7, 0x6A, 0xDA, 0xDA, 0xD7,
+    0x7D, 0xA0, 0xFA, 0x77, 0xD9, 0x1D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xF7, 0x0F, 0xA6,
+    0xF7, 0xAF, 0xA5, 0x9E, 0xA7, 0xFD, 0x5F, 0x79, 0xFD, 0x5F, 0x7A, 0xFD, 0x93, 0xAE, 0xA7, 0xFE,
+    0xA3, 0xF7, 0x9F, 0xF3, 0xF7, 0xAF, 0xF2, 0xAE, 0xA7, 0xFA, 0xF2, 0xF9, 0x69, 0xF9, 0xAE, 0x90,
+    0x9F, 0x7F, 0xC0, 0xAE, 0xA0, 0xAE, 0xA7, 0xFC, 0x09, 0xF0, 0xF9, 0x69, 0xFC, 0x09, 0xF9, 0xF7,
+    0xFC, 0xA1, 0xFF, 0xA7, 0xFC, 0x91, 0xFF, 0x96, 0xAF, 0xC2, 0xFF, 0x7F, 0xD2, 0xAF, 0xDA, 0x69,
+    0xFC, 0xA2, 0x9F, 0xD9, 0x6A, 0xFC, 0x92, 0x9F, 0xD7, 0xFD, 0x4F, 0xCA, 0x60, 0x73, 0xF7, 0x75,
+    0xF7, 0x74, 0x9F, 0x77, 0x4A, 0xF7, 0x75, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAF, 0xCA,
+    0x76, 0x9F, 0xFD, 0x97, 0x3A, 0xFF, 0xFA, 0x71, 0xFD, 0xAA, 0x9A, 0xFC, 0x97, 0xFC, 0xA4, 0x9F,
+    0xA6, 0xAF, 0xA6, 0xAF, 0x59, 0xFA, 0x79, 0xF9, 0x4F, 0xC7, 0x1F, 0x93, 0x9F, 0x97, 0x1F, 0x93,
+    0xAF, 0x72, 0xF9, 0x3F, 0xA7, 0x19, 0xF3, 0x9F, 0x72, 0x9F, 0x3A, 0xF7, 0x2F, 0xA3, 0xAF, 0x72,
+    0xF9, 0x3F, 0xA7, 0x1F, 0xC4, 0xFC, 0x70, 0xAF, 0xA4, 0xFD, 0xA9, 0x19, 0x9A, 0xFD, 0x94, 0xFF,
+    0xFF, 0xE5, 0xFF, 0xFF, 0xD9, 0x5A, 0xFF, 0xFF, 0xA7, 0xFF, 0xFE, 0xA7, 0x1F, 0xFF, 0xC9, 0x73,
+    0x9A, 0xFE, 0xA9, 0x77, 0x77, 0x10, 0x77, 0x19, 0xD9, 0x77, 0x4E, 0x77, 0x4E, 0x77, 0x4A, 0xDA,
+    0x77, 0x39, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xFC, 0xA7,
+    0x69, 0xFF, 0xD9, 0x73, 0xAF, 0xFF, 0xA7, 0x1F, 0xDA, 0xA9, 0xAF, 0xC9, 0x7F, 0xCA, 0x49, 0xFA,
+    0x6A, 0xFA, 0x6A, 0xF5, 0x9F, 0xA7, 0x9F, 0x94, 0xFC, 0x71, 0xF9, 0x39, 0xF9, 0x71, 0xF9, 0x3A,
+    0xF7, 0x2F, 0x93, 0xFA, 0x71, 0x9F, 0x39, 0xF7, 0x29, 0xF3, 0xAF, 0x72, 0xFA, 0x3A, 0xF7, 0x2F,
+    0x93, 0xFA, 0x71, 0xFC, 0x4F, 0xC7, 0x0A, 0xFA, 0x4F, 0xDA, 0x91, 0x99, 0xAF, 0xD9, 0x4F, 0xFF,
+    0xFE, 0x5F, 0xFF, 0xFD, 0x95, 0xAF, 0xFF, 0xFA, 0x7F, 0xFF, 0xEA, 0x71, 0xFF, 0xFC, 0x97, 0x39,
+    0xAF, 0xEA, 0x97, 0x77, 0x71, 0x73, 0xAD, 0x77, 0x5E, 0xA7, 0x73, 0xAF, 0xC7, 0x71, 0xAF, 0xE7,
+    0x79, 0xEA, 0x0A, 0xE9, 0x75, 0xEA, 0x3A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAF, 0xCA, 0x76,
+    0x9F, 0xFD, 0x97, 0x3A, 0xFF, 0xFA, 0x71, 0xFD, 0xAA, 0x9A, 0xFC, 0x97, 0xFC, 0xA4, 0x9F, 0xA6,
+    0xAF, 0xA6, 0xAF, 0x59, 0xFA, 0x79, 0xF9, 0x4F, 0xC7, 0x1F, 0x93, 0x9F, 0x97, 0x1F, 0x93, 0xAF,
+    0x72, 0xF9, 0x3F, 0xA7, 0x19, 0xF3, 0x9F, 0x72, 0x9F, 0x3A, 0xF7, 0x2F, 0xA3, 0xAF, 0x72, 0xF9,
+    0x3F, 0xA7, 0x1F, 0xC4, 0xFC, 0x70, 0xAF, 0xA4, 0xFD, 0xA9, 0x19, 0x9A, 0xFD, 0x94, 0xFF, 0xFF,
+    0xE5, 0xFF, 0xFF, 0xD9, 0x5A, 0xFF, 0xFF, 0xA7, 0xFF, 0xFE, 0xA7, 0x1F, 0xFF, 0xC9, 0x73, 0x9A,
+    0xFE, 0xA9, 0x77, 0x77, 0x10, 0x76, 0x99, 0x77, 0x49, 0xE9, 0x09, 0xCA, 0x77, 0xFC, 0x0A, 0xCA,
+    0x76, 0xAD, 0x0F, 0xC9, 0x76, 0xDA, 0x0A, 0xF7, 0x7A, 0xCA, 0x1E, 0x77, 0x77, 0x77, 0x77, 0x19,
+    0xAF, 0xCA, 0x76, 0x9F, 0xFD, 0x97, 0x3A, 0xFF, 0xFA, 0x71, 0xFD, 0xAA, 0x9A, 0xFC, 0x97, 0xFC,
+    0xA4, 0x9F, 0xA6, 0xAF, 0xA6, 0xAF, 0x59, 0xFA, 0x79, 0xF9, 0x4F, 0xC7, 0x1F, 0x93, 0x9F, 0x97,
+    0x1F, 0x93, 0xAF, 0x72, 0xF9, 0x3F, 0xA7, 0x19, 0xF3, 0x9F, 0x72, 0x9F, 0x3A, 0xF7, 0x2F, 0xA3,
+    0xAF, 0x72, 0xF9, 0x3F, 0xA7, 0x1F, 0xC4, 0xFC, 0x70, 0xAF, 0xA4, 0xFD, 0xA9, 0x19, 0x9A, 0xFD,
+    0x94, 0xFF, 0xFF, 0xE5, 0xFF, 0xFF, 0xD9, 0x5A, 0xFF, 0xFF, 0xA7, 0xFF, 0xFE, 0xA7, 0x1F, 0xFF,
+    0xC9, 0x73, 0x9A, 0xFE, 0xA9, 0x77, 0x77, 0x10, 0x74, 0x99, 0x99, 0x29, 0x99, 0x75, 0xAE, 0xA1,
+    0xAE, 0x97, 0x4F, 0x91, 0xF7, 0x49, 0xF1, 0xAF, 0x74, 0xFC, 0x1F, 0xC7, 0x39, 0xFC, 0x0A, 0xFC,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xAF, 0xCA, 0x76, 0x9F, 0xFD, 0x97, 0x3A, 0xFF, 0xFA, 0x71,
+    0xFD, 0xAA, 0x9A, 0xFC, 0x97, 0xFC, 0xA4, 0x9F, 0xA6, 0xAF, 0xA6, 0xAF, 0x59, 0xFA, 0x79, 0xF9,
+    0x4F, 0xC7, 0x1F, 0x93, 0x9F, 0x97, 0x1F, 0x93, 0xAF, 0x72, 0xF9, 0x3F, 0xA7, 0x19, 0xF3, 0x9F,
+    0x72, 0x9F, 0x3A, 0xF7, 0x2F, 0xA3, 0xAF, 0x72, 0xF9, 0x3F, 0xA7, 0x1F, 0xC4, 0xFC, 0x70, 0xAF,
+    0xA4, 0xFD, 0xA9, 0x19, 0x9A, 0xFD, 0x94, 0xFF, 0xFF, 0xE5, 0xFF, 0xFF, 0xD9, 0x5A, 0xFF, 0xFF,
+    0xA7, 0xFF, 0xFE, 0xA7, 0x1F, 0xFF, 0xC9, 0x73, 0x9A, 0xFE, 0xA9, 0x77, 0x77, 0x10, 0x77, 0x3F,
+    0xA1, 0xF5, 0xFA, 0xF6, 0x9F, 0xDA, 0x70, 0xAF, 0xA7, 0x09, 0xFD, 0x7A, 0xFF, 0x49, 0xFC, 0xAF,
+    0xA2, 0xAF, 0xC1, 0xFC, 0xA0, 0x77, 0x77, 0x74, 0x99, 0xAA, 0x77, 0x77, 0x72, 0x9F, 0xC7, 0x77,
+    0x77, 0x29, 0xFC, 0x77, 0x77, 0x73, 0xFC, 0x77, 0x77, 0x73, 0xFC, 0x77, 0x77, 0x73, 0xFC, 0x77,
+    0x77, 0x73, 0xFC, 0x97, 0x77, 0x77, 0x2F, 0xC9, 0x77, 0x77, 0x72, 0xFC, 0x97, 0x77, 0x77, 0x2F,
+    0xC9, 0x77, 0x77, 0x72, 0xFC, 0x97, 0x77, 0x77, 0x2F, 0xCA, 0x77, 0x77, 0x19, 0xAF, 0xCA, 0x9F,
+    0xCA, 0x77, 0x77, 0x09, 0xFF, 0xFD, 0xA7, 0x77, 0x70, 0xAF, 0xFF, 0xDA, 0x77, 0x77, 0x0F, 0xDA,
+    0xAA, 0xFE, 0x77, 0x77, 0x0F, 0xCA, 0x3F, 0xE7, 0x77, 0x7A, 0xFA, 0x3A, 0xFE, 0x77, 0x76, 0x9F,
+    0xA3, 0xAF, 0xF9, 0x77, 0x75, 0xFC, 0x3A, 0xFF, 0xC9, 0x77, 0x74, 0x9F, 0x92, 0x9F, 0xC9, 0xF9,
+    0x77, 0x74, 0xAF, 0x29, 0xFC, 0x90, 0xF9, 0x77, 0x74, 0xFA, 0x19, 0xFC, 0xA1, 0xF7, 0x77, 0x49,
+    0xF2, 0xFC, 0xA1, 0x9F, 0x77, 0x74, 0xAF, 0x1F, 0xD2, 0xFA, 0x77, 0x74, 0xAE, 0xA0, 0xFD, 0x3F,
+    0x97, 0x77, 0x4F, 0xFE, 0x3F, 0xC7, 0x77, 0x5F, 0xFD, 0x92, 0xAF, 0xA7, 0x77, 0x5F, 0xFC, 0xA9,
+    0x9A, 0xFD, 0x97, 0x77, 0x5F, 0xFF, 0xFE, 0x77, 0x76, 0xFF, 0xFF, 0xD9, 0x77, 0x76, 0xFF, 0xFF,
+    0xCA, 0x77, 0x76, 0xAF, 0xFF, 0xFA, 0x77, 0x76, 0xAF, 0xFF, 0xF9, 0x77, 0x76, 0xAF, 0xC9, 0x9A,
+    0xFD, 0xA9, 0x77, 0x77, 0x9F, 0xC9, 0x77, 0x77, 0x71, 0x9F, 0xCA, 0x77, 0x77, 0x71, 0x9F, 0xCA,
+    0x77, 0x77, 0x71, 0x9F, 0xCA, 0x77, 0x77, 0x71, 0x9F, 0xD7, 0x77, 0x77, 0x19, 0xFD, 0x77, 0x77,
+    0x71, 0x9F, 0xD7, 0x77, 0x77, 0x19, 0xFD, 0x77, 0x77, 0x71, 0x9F, 0xA9, 0x77, 0x77, 0x71, 0x9D,
+    0xA7, 0x77, 0x77, 0x59, 0x77, 0x77, 0x77, 0x72, 0x99, 0x99, 0x77, 0x3A, 0xEA, 0x77, 0x3A, 0xEA,
+    0x77, 0x3F, 0xA7, 0x73, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAF, 0xC5, 0x9F, 0xC5,
+    0xFC, 0xA5, 0xAF, 0xC5, 0xFC, 0x6F, 0xCA, 0x49, 0xFC, 0x6F, 0xC5, 0xAF, 0xA5, 0x9F, 0xC5, 0xFC,
+    0x95, 0xAF, 0xA5, 0xFC, 0x6F, 0xC6, 0xFA, 0x6F, 0xC5, 0x9F, 0x95, 0x9F, 0xA5, 0xAF, 0x6A, 0xF9,
+    0x5F, 0xA6, 0xFC, 0x6F, 0x96, 0xFA, 0x59, 0xF6, 0x9F, 0x95, 0xAF, 0x6F, 0xC6, 0xFC, 0x5A, 0xFA,
+    0x6F, 0xEA, 0xFF, 0x96, 0xFF, 0xFF, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xE7, 0x0A, 0xFF, 0xFC, 0x72,
+    0x9F, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x00, 0x77, 0x1D, 0xA7, 0x73, 0xE7, 0x73, 0xAD, 0x97, 0x72,
+    0x9E, 0x77, 0x3E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72,
+    0xAF, 0xC5, 0x9F, 0xC5, 0xFC, 0xA5, 0xAF, 0xC5, 0xFC, 0x6F, 0xCA, 0x49, 0xFC, 0x6F, 0xC5, 0xAF,
+    0xA5, 0x9F, 0xC5, 0xFC, 0x95, 0xAF, 0xA5, 0xFC, 0x6F, 0xC6, 0xFA, 0x6F, 0xC5, 0x9F, 0x95, 0x9F,
+    0xA5, 0xAF, 0x6A, 0xF9, 0x5F, 0xA6, 0xFC, 0x6F, 0x96, 0xFA, 0x59, 0xF6, 0x9F, 0x95, 0xAF, 0x6F,
+    0xC6, 0xFC, 0x5A, 0xFA, 0x6F, 0xEA, 0xFF, 0x96, 0xFF, 0xFF, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xE7,
+    0x0A, 0xFF, 0xFC, 0x72, 0x9F, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x00, 0x77, 0x77, 0x2A, 0xD9, 0x77,
+    0x3F, 0x77, 0x2A, 0xFC, 0x97, 0x7A, 0xFE, 0xA7, 0x59, 0xEA, 0x1F, 0x74, 0xE9, 0x39, 0xE9, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0xAF, 0xC5, 0x9F, 0xC5, 0xFC, 0xA5, 0xAF, 0xC5, 0xFC, 0x6F, 0xCA, 0x49,
+    0xFC, 0x6F, 0xC5, 0xAF, 0xA5, 0x9F, 0xC5, 0xFC, 0x95, 0xAF, 0xA5, 0xFC, 0x6F, 0xC6, 0xFA, 0x6F,
+    0xC5, 0x9F, 0x95, 0x9F, 0xA5, 0xAF, 0x6A, 0xF9, 0x5F, 0xA6, 0xFC, 0x6F, 0x96, 0xFA, 0x59, 0xF6,
+    0x9F, 0x95, 0xAF, 0x6F, 0xC6, 0xFC, 0x5A, 0xFA, 0x6F, 0xEA, 0xFF, 0x96, 0xFF, 0xFF, 0x7F, 0xFF,
+    0xE9, 0x7F, 0xFF, 0xE7, 0x0A, 0xFF, 0xFC, 0x72, 0x9F, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x00, 0x73,
+    0xEA, 0x19, 0xEA, 0x73, 0xAE, 0xA1, 0xF9, 0x73, 0xF9, 0x1F, 0x97, 0x29, 0xF9, 0x0A, 0xF7, 0x3F,
+    0xC1, 0xFC, 0x73, 0x99, 0x99, 0x91, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xAF,
+    0xC5, 0x9F, 0xC5, 0xFC, 0xA5, 0xAF, 0xC5, 0xFC, 0x6F, 0xCA, 0x49, 0xFC, 0x6F, 0xC5, 0xAF, 0xA5,
+    0x9F, 0xC5, 0xFC, 0x95, 0xAF, 0xA5, 0xFC, 0x6F, 0xC6, 0xFA, 0x6F, 0xC5, 0x9F, 0x95, 0x9F, 0xA5,
+    0xAF, 0x6A, 0xF9, 0x5F, 0xA6, 0xFC, 0x6F, 0x96, 0xFA, 0x59, 0xF6, 0x9F, 0x95, 0xAF, 0x6F, 0xC6,
+    0xFC, 0x5A, 0xFA, 0x6F, 0xEA, 0xFF, 0x96, 0xFF, 0xFF, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xE7, 0x0A,
+    0xFF, 0xFC, 0x72, 0x9F, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x00, 0x77, 0x77, 0x0A, 0xD7, 0x79, 0xDA,
+    0x77, 0xE7, 0x7E, 0x97, 0x6A, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x19, 0xF7, 0x0A, 0xF1, 0xF9, 0x69, 0xF2, 0xFA, 0x6F, 0x92, 0xAF, 0x5F, 0xA3, 0xAF, 0x4A,
+    0xF4, 0x9F, 0x92, 0xAF, 0x6F, 0xA1, 0x9F, 0x96, 0xFC, 0x1F, 0xA7, 0xAF, 0x9F, 0xC7, 0x0A, 0xFF,
+    0xC7, 0x19, 0xFF, 0x97, 0x2F, 0xEA, 0x73, 0xFE, 0x74, 0xAF, 0xC7, 0x5A, 0xFA, 0x75, 0xFC, 0x97,
+    0x49, 0xFC, 0x75, 0xAF, 0xC7, 0x5F, 0xCA, 0x74, 0x9F, 0xC9, 0x74, 0xAF, 0xC7, 0x40, 0x49, 0xAA,
+    0x97, 0x3A, 0xD9, 0x73, 0xE7, 0x4E, 0x97, 0x29, 0xFD, 0x97, 0xFF, 0xA6, 0xFF, 0xCA, 0x49, 0xE2,
+    0xF4, 0xAD, 0x93, 0xE9, 0x3E, 0x39, 0xE9, 0x3E, 0x3F, 0x39, 0xDA, 0x1A, 0xF9, 0x3A, 0xFF, 0xCA,
+    0x4F, 0xFC, 0x95, 0xFE, 0xA6, 0x9E, 0xAA, 0x97, 0x0A, 0xD9, 0x73, 0xE7, 0x4E, 0x73, 0xAD, 0xA7,
+    0x77, 0x30, 0x70, 0x99, 0xAA, 0xA9, 0x72, 0xFE, 0xA7, 0x9F, 0xFC, 0xA6, 0xF9, 0x19, 0xE5, 0xAE,
+    0x4E, 0x5E, 0xA2, 0xAF, 0x49, 0xE2, 0xFD, 0x4A, 0xE1, 0xFA, 0xA5, 0xEA, 0x09, 0xE7, 0x9E, 0x90,
+    0xAD, 0x97, 0xAE, 0x1A, 0xD9, 0x7F, 0x1A, 0xEA, 0x6E, 0xA2, 0xFA, 0x49, 0xE9, 0x29, 0xF9, 0x3F,
+    0x93, 0x9F, 0x3F, 0x5F, 0x29, 0xFC, 0x99, 0x09, 0xAE, 0xA2, 0xAF, 0xFF, 0xC3, 0xFF, 0xFC, 0xA2,
+    0x9F, 0xFF, 0xA3, 0xAF, 0xFD, 0xA5, 0x99, 0x99, 0x97, 0x40, 0x69, 0x99, 0x74, 0xAE, 0x97, 0x3F,
+    0x97, 0x3F, 0xA7, 0x29, 0xFA, 0x77, 0x77, 0x77, 0x69, 0xAE, 0x97, 0x0A, 0xFF, 0xCA, 0x3A, 0xFF,
+    0xD9, 0x3E, 0xA1, 0x9F, 0x92, 0xEA, 0x3A, 0xE2, 0x9E, 0x4A, 0xE2, 0xAD, 0x94, 0xAE, 0x2E, 0x5A,
+    0xDA, 0x19, 0xD9, 0x5E, 0xA1, 0xAD, 0x6E, 0x91, 0xE5, 0xF2, 0xFA, 0xAA, 0xFD, 0x2F, 0xFF, 0xC2,
+    0xAF, 0xFF, 0x3F, 0xFE, 0xA4, 0xAF, 0xA6, 0x74, 0x9D, 0x97, 0x4E, 0x74, 0xE7, 0x4A, 0xDA, 0x73,
+    0x9E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xE9, 0x71, 0xAF, 0xFC, 0xA4, 0xAF,
+    0xFD, 0x94, 0xEA, 0x19, 0xF9, 0x3E, 0xA3, 0xAE, 0x39, 0xE4, 0xAE, 0x3A, 0xD9, 0x4A, 0xE3, 0xE5,
+    0xAD, 0xA2, 0x9D, 0x95, 0xEA, 0x2A, 0xD6, 0xE9, 0x2E, 0x5F, 0x3F, 0xAA, 0xAF, 0xD3, 0xFF, 0xFC,
+    0x3A, 0xFF, 0xF4, 0xFF, 0xEA, 0x5A, 0xFA, 0x70, 0x77, 0x7E, 0x75, 0xF7, 0x3F, 0xD9, 0x70, 0xAF,
+    0xE9, 0x69, 0xE9, 0x09, 0xEA, 0x5E, 0x93, 0x9E, 0x77, 0x77, 0x70, 0x9A, 0xE9, 0x71, 0xAF, 0xFC,
+    0xA4, 0xAF, 0xFD, 0x94, 0xEA, 0x19, 0xF9, 0x3E, 0xA3, 0xAE, 0x39, 0xE4, 0xAE, 0x3A, 0xD9, 0x4A,
+    0xE3, 0xE5, 0xAD, 0xA2, 0x9D, 0x95, 0xEA, 0x2A, 0xD6, 0xE9, 0x2E, 0x5F, 0x3F, 0xAA, 0xAF, 0xD3,
+    0xFF, 0xFC, 0x3A, 0xFF, 0xF4, 0xFF, 0xEA, 0x5A, 0xFA, 0x70, 0x70, 0xAD, 0x19, 0xCA, 0x7F, 0xC0,
+    0xAC, 0xA6, 0x9D, 0xAF, 0xC9, 0x6D, 0xA0, 0x9E, 0xA7, 0x9A, 0x91, 0x9A, 0x97, 0x77, 0x77, 0x2A,
+    0xE9, 0x71, 0xAF, 0xFC, 0xA4, 0xAF, 0xFD, 0x94, 0xEA, 0x19, 0xF9, 0x3E, 0xA3, 0xAE, 0x39, 0xE4,
+    0xAE, 0x3A, 0xD9, 0x4A, 0xE3, 0xE5, 0xAD, 0xA2, 0x9D, 0x95, 0xEA, 0x2A, 0xD6, 0xE9, 0x2E, 0x5F,
+    0x3F, 0xAA, 0xAF, 0xD3, 0xFF, 0xFC, 0x3A, 0xFF, 0xF4, 0xFF, 0xEA, 0x5A, 0xFA, 0x70, 0x79, 0x99,
+    0x92, 0x99, 0x97, 0xAE, 0xA1, 0xAE, 0x96, 0xF9, 0x1F, 0x69, 0xF9, 0x0A, 0xF6, 0xFC, 0x1F, 0xC5,
+    0x9F, 0xC0, 0xAF, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xE9, 0x73, 0xAF, 0xFC, 0xA6, 0xAF,
+    0xFD, 0x96, 0xEA, 0x19, 0xF9, 0x5E, 0xA3, 0xAE, 0x59, 0xE4, 0xAE, 0x5A, 0xD9, 0x4A, 0xE5, 0xE5,
+    0xAD, 0xA4, 0x9D, 0x95, 0xEA, 0x4A, 0xD6, 0xE9, 0x4E, 0x5F, 0x5F, 0xAA, 0xAF, 0xD5, 0xFF, 0xFC,
+    0x5A, 0xFF, 0xF6, 0xFF, 0xEA, 0x7A, 0xFA, 0x71, 0x77, 0x72, 0xAD, 0x97, 0x2F, 0xC7, 0x19, 0xD9,
+    0xD7, 0x1A, 0xFC, 0x71, 0x9F, 0x97, 0x29, 0xAA, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xE9, 0x70, 0xAF,
+    0xFC, 0xA3, 0xAF, 0xFD, 0x93, 0xEA, 0x19, 0xF9, 0x2E, 0xA3, 0xAE, 0x29, 0xE4, 0xAE, 0x2A, 0xD9,
+    0x4A, 0xE2, 0xE5, 0xAD, 0xA1, 0x9D, 0x95, 0xEA, 0x1A, 0xD6, 0xE9, 0x1E, 0x5F, 0x2F, 0xAA, 0xAF,
+    0xD2, 0xFF, 0xFC, 0x2A, 0xFF, 0xF3, 0xFF, 0xEA, 0x4A, 0xFA, 0x60, 0x77, 0x77, 0x9A, 0xE9, 0x49,
+    0xAE, 0xA7, 0xAF, 0xFF, 0xFD, 0x5A, 0xFF, 0xFD, 0xAA, 0xF4, 0xEA, 0x19, 0xFE, 0x3A, 0xD3, 0xEA,
+    0x3A, 0xFC, 0x29, 0x9A, 0xD9, 0x19, 0xE4, 0xAF, 0xFF, 0xC9, 0x1A, 0xD9, 0x4A, 0xFF, 0xFC, 0x91,
+    0xE5, 0xAF, 0xFF, 0xC9, 0x09, 0xD9, 0x5F, 0xCA, 0xAA, 0xA9, 0x99, 0x3A, 0xD6, 0xF7, 0x3E, 0x5F,
+    0xC7, 0x92, 0xFA, 0xAA, 0xFF, 0xA9, 0x29, 0xD2, 0xFF, 0xFF, 0xFE, 0x2A, 0xFF, 0xFF, 0xFD, 0x3F,
+    0xFF, 0xFF, 0xCA, 0x4A, 0xFA, 0x49, 0xFC, 0xA9, 0x30, 0x77, 0x49, 0xAF, 0x94, 0x9F, 0xF3, 0x9F,
+    0xFA, 0x3F, 0xA9, 0x19, 0x92, 0xF7, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x09,
+    0xE9, 0x70, 0xAE, 0xA2, 0x94, 0x9F, 0xAA, 0xDA, 0x4F, 0xFC, 0x93, 0x9F, 0xFC, 0x49, 0xAF, 0xCA,
+    0x7D, 0x97, 0x19, 0xE9, 0x70, 0xFC, 0x70, 0x90, 0x9D, 0x79, 0xFC, 0x7A, 0xF7, 0x0A, 0xAA, 0x96,
+    0x7F, 0x75, 0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x59, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x49,
+    0xAE, 0xA7, 0x1F, 0xF7, 0xFC, 0xAF, 0x5F, 0x39, 0xD9, 0x3A, 0xE2, 0x99, 0xAD, 0xA3, 0xFF, 0xFA,
+    0x2A, 0xFF, 0xFA, 0x2F, 0xFF, 0xCA, 0x19, 0xFC, 0xAA, 0xA9, 0x99, 0x93, 0xAE, 0x74, 0xAE, 0x97,
+    0x3A, 0xFA, 0x92, 0x9D, 0x92, 0x9F, 0xFF, 0x4F, 0xFF, 0x5F, 0xFD, 0xA6, 0x9A, 0xFA, 0x94, 0x77,
+    0x77, 0xAD, 0x75, 0x9D, 0xA7, 0x5E, 0x75, 0xE9, 0x74, 0xAE, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x73, 0x9A, 0xEA, 0x72, 0xFF, 0x70, 0xFC, 0xAF, 0x6F, 0x39, 0xD9, 0x4A,
+    0xE2, 0x99, 0xAD, 0xA4, 0xFF, 0xFA, 0x3A, 0xFF, 0xFA, 0x3F, 0xFF, 0xCA, 0x29, 0xFC, 0xAA, 0xA9,
+    0x99, 0x94, 0xAE, 0x75, 0xAE, 0x97, 0x4A, 0xFA, 0x92, 0x9D, 0x93, 0x9F, 0xFF, 0x5F, 0xFF, 0x6F,
+    0xFD, 0xA7, 0x9A, 0xFA, 0x95, 0x7A, 0xD7, 0x6E, 0xA7, 0x4F, 0xCA, 0x72, 0xAF, 0xE7, 0x09, 0xEA,
+    0x0A, 0xE9, 0x6E, 0x93, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xEA, 0x72, 0xFF,
+    0x70, 0xFC, 0xAF, 0x6F, 0x39, 0xD9, 0x4A, 0xE2, 0x99, 0xAD, 0xA4, 0xFF, 0xFA, 0x3A, 0xFF, 0xFA,
+    0x3F, 0xFF, 0xCA, 0x29, 0xFC, 0xAA, 0xA9, 0x99, 0x94, 0xAE, 0x75, 0xAE, 0x97, 0x4A, 0xFA, 0x92,
+    0x9D, 0x93, 0x9F, 0xFF, 0x5F, 0xFF, 0x6F, 0xFD, 0xA7, 0x9A, 0xFA, 0x95, 0x70, 0x99, 0x99, 0x29,
+    0x99, 0x70, 0xAE, 0x91, 0xF9, 0x7F, 0x91, 0xF7, 0x9F, 0x1A, 0xF7, 0xFC, 0x1F, 0xC6, 0x9F, 0xC0,
+    0xAF, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xAE, 0xA7, 0x4F, 0xF7, 0x2F, 0xCA,
+    0xF7, 0x0F, 0x39, 0xD9, 0x6A, 0xE2, 0x99, 0xAD, 0xA6, 0xFF, 0xFA, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF,
+    0xCA, 0x49, 0xFC, 0xAA, 0xA9, 0x99, 0x96, 0xAE, 0x77, 0xAE, 0x97, 0x6A, 0xFA, 0x92, 0x9D, 0x95,
+    0x9F, 0xFF, 0x7F, 0xFF, 0x70, 0xFF, 0xDA, 0x71, 0x9A, 0xFA, 0x97, 0x1A, 0xE9, 0x6F, 0x96, 0xF9,
+    0x59, 0xFA, 0x79, 0x99, 0x77, 0x72, 0xAC, 0xA9, 0x6E, 0x96, 0xE6, 0x9E, 0x6A, 0xDA, 0x6E, 0x96,
+    0xE6, 0x9E, 0x6A, 0xDA, 0x6E, 0xA5, 0x9E, 0x95, 0xAE, 0x6F, 0x6F, 0x5A, 0xF5, 0x9A, 0xDA, 0x50,
+    0x77, 0x5D, 0xA7, 0x0E, 0x70, 0xAD, 0x97, 0x9E, 0x70, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x75, 0xAC,
+    0xA9, 0x70, 0xE9, 0x70, 0xE7, 0x09, 0xE7, 0x0A, 0xDA, 0x70, 0xE9, 0x70, 0xE7, 0x09, 0xE7, 0x0A,
+    0xDA, 0x70, 0xEA, 0x79, 0xE9, 0x7A, 0xE7, 0x0F, 0x70, 0xF7, 0xAF, 0x79, 0xAD, 0xA7, 0x39, 0xD9,
+    0x71, 0xF7, 0x09, 0xFC, 0x96, 0xFE, 0xA4, 0xF0, 0x9E, 0xA2, 0xAE, 0x39, 0xE7, 0x77, 0x72, 0xAC,
+    0xA9, 0x71, 0xE9, 0x71, 0xE7, 0x19, 0xE7, 0x1A, 0xDA, 0x71, 0xE9, 0x71, 0xE7, 0x19, 0xE7, 0x1A,
+    0xDA, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1F, 0x71, 0xF7, 0x0A, 0xF7, 0x09, 0xAD, 0xA6,
+    0x2A, 0xD9, 0x1A, 0xD9, 0x19, 0xE9, 0x09, 0xE9, 0x1F, 0x1F, 0x2F, 0x09, 0xF1, 0xAF, 0x0A, 0xF7,
+    0x77, 0x77, 0x3A, 0xCA, 0x97, 0x0E, 0x97, 0x0E, 0x70, 0x9E, 0x70, 0xAD, 0xA7, 0x0E, 0x97, 0x0E,
+    0x70, 0x9E, 0x70, 0xAD, 0xA7, 0x0E, 0xA7, 0x9E, 0x97, 0xAE, 0x70, 0xF7, 0x0F, 0x7A, 0xF7, 0x9A,
+    0xDA, 0x70, 0x77, 0x77, 0x39, 0xDA, 0x77, 0x2F, 0xC7, 0x70, 0xAF, 0xC9, 0x77, 0x2E, 0x97, 0x5F,
+    0xFF, 0xC7, 0x1F, 0xFF, 0x97, 0x09, 0xFF, 0xF7, 0x19, 0x3E, 0x97, 0x19, 0xFD, 0x1E, 0x71, 0xAF,
+    0xFA, 0xDA, 0x70, 0xFF, 0xFC, 0x70, 0xAF, 0x91, 0xAF, 0xC7, 0x0F, 0x4F, 0x97, 0xAE, 0x94, 0xF7,
+    0x0F, 0x49, 0xE9, 0x70, 0xF3, 0x9F, 0x71, 0xFC, 0xAA, 0xFC, 0x72, 0xFF, 0xEA, 0x72, 0xAF, 0xFC,
+    0xA7, 0x4A, 0xFE, 0xA7, 0x69, 0xFA, 0x75, 0x72, 0x9D, 0x91, 0xD7, 0x29, 0xF1, 0xD7, 0x2F, 0xFC,
+    0x71, 0x9D, 0x1F, 0x97, 0x19, 0xD1, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9D, 0xA9, 0xAE,
+    0xA7, 0x1A, 0xFF, 0xD7, 0x0F, 0xFE, 0x96, 0x9F, 0xC9, 0x09, 0xEA, 0x6A, 0xEA, 0x39, 0xDA, 0x6F,
+    0x4A, 0xDA, 0x59, 0xE9, 0x4E, 0xA5, 0xAE, 0x49, 0xE9, 0x5F, 0x4A, 0xE5, 0x9E, 0xA4, 0xF5, 0xAE,
+    0xA3, 0x9F, 0x5F, 0x93, 0xAE, 0xA4, 0x9F, 0x4F, 0x94, 0xAF, 0x39, 0xF9, 0x4F, 0xC3, 0xAF, 0x40,
+    0x6F, 0x75, 0xF7, 0x49, 0xF9, 0x73, 0xAF, 0x97, 0x49, 0x99, 0x97, 0x77, 0x77, 0x29, 0xAE, 0xA9,
+    0x70, 0xFF, 0xA5, 0x9F, 0xFD, 0x94, 0xFA, 0x19, 0xF3, 0xF9, 0x3A, 0xE3, 0xEA, 0x4A, 0xE2, 0xAE,
+    0x5A, 0xE2, 0xEA, 0x5F, 0x2E, 0xA4, 0x9E, 0xA1, 0x9E, 0x94, 0xF2, 0x9F, 0x29, 0xFC, 0x29, 0xFF,
+    0xF9, 0x3F, 0xFE, 0xA4, 0xFF, 0xE6, 0xFF, 0xA7, 0x0A, 0xFA, 0x60, 0x74, 0x9D, 0x97, 0x4E, 0x74,
+    0xAD, 0x97, 0x3A, 0xDA, 0x73, 0x9E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xEA, 0x97,
+    0x0F, 0xFA, 0x59, 0xFF, 0xD9, 0x4F, 0xA1, 0x9F, 0x3F, 0x93, 0xAE, 0x3E, 0xA4, 0xAE, 0x2A, 0xE5,
+    0xAE, 0x2E, 0xA5, 0xF2, 0xEA, 0x49, 0xEA, 0x19, 0xE9, 0x4F, 0x29, 0xF2, 0x9F, 0xC2, 0x9F, 0xFF,
+    0x93, 0xFF, 0xEA, 0x4F, 0xFE, 0x6F, 0xFA, 0x70, 0xAF, 0xA6, 0x6A, 0xD7, 0x5F, 0x73, 0xAF, 0xC7,
+    0x19, 0xFE, 0x97, 0xEA, 0x09, 0xEA, 0x5E, 0xA3, 0xAD, 0xA7, 0x77, 0x77, 0x19, 0xAE, 0xA9, 0x70,
+    0xFF, 0xA5, 0x9F, 0xFD, 0x94, 0xFA, 0x19, 0xF3, 0xF9, 0x3A, 0xE3, 0xEA, 0x4A, 0xE2, 0xAE, 0x5A,
+    0xE2, 0xEA, 0x5F, 0x2E, 0xA4, 0x9E, 0xA1, 0x9E, 0x94, 0xF2, 0x9F, 0x29, 0xFC, 0x29, 0xFF, 0xF9,
+    0x3F, 0xFE, 0xA4, 0xFF, 0xE6, 0xFF, 0xA7, 0x0A, 0xFA, 0x60, 0x71, 0x99, 0x75, 0x9E, 0xA0, 0x9C,
+    0xA7, 0x0F, 0xC0, 0xAD, 0x79, 0xD0, 0xFC, 0x97, 0xE0, 0x9F, 0x70, 0x9A, 0x91, 0x9A, 0x97, 0x77,
+    0x77, 0x59, 0xAE, 0xA9, 0x71, 0xFF, 0xA6, 0x9F, 0xFD, 0x95, 0xFA, 0x19, 0xF4, 0xF9, 0x3A, 0xE4,
+    0xEA, 0x4A, 0xE3, 0xAE, 0x5A, 0xE3, 0xEA, 0x5F, 0x3E, 0xA4, 0x9E, 0xA2, 0x9E, 0x94, 0xF3, 0x9F,
+    0x29, 0xFC, 0x39, 0xFF, 0xF9, 0x4F, 0xFE, 0xA5, 0xFF, 0xE7, 0xFF, 0xA7, 0x1A, 0xFA, 0x70, 0x79,
+    0x99, 0x92, 0x99, 0x97, 0x9E, 0xA1, 0xAE, 0x96, 0xF9, 0x1F, 0x95, 0x9F, 0x90, 0xAF, 0x6F, 0xC1,
+    0xFC, 0x6F, 0xC0, 0x9F, 0xC7, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xEA, 0x97, 0x2F, 0xFA, 0x79, 0xFF,
+    0xD9, 0x6F, 0xA1, 0x9F, 0x5F, 0x93, 0xAE, 0x5E, 0xA4, 0xAE, 0x4A, 0xE5, 0xAE, 0x4E, 0xA5, 0xF4,
+    0xEA, 0x49, 0xEA, 0x39, 0xE9, 0x4F, 0x49, 0xF2, 0x9F, 0xC4, 0x9F, 0xFF, 0x95, 0xFF, 0xEA, 0x6F,
+    0xFE, 0x70, 0xFF, 0xA7, 0x2A, 0xFA, 0x70, 0x71, 0x99, 0x97, 0x6F, 0x75, 0x9F, 0x75, 0xFC, 0x75,
+    0xFC, 0x74, 0xAF, 0xA7, 0x77, 0x74, 0x99, 0x99, 0x99, 0x3A, 0xFF, 0xFD, 0x2A, 0xFF, 0xFE, 0x90,
+    0xAF, 0xFF, 0xF9, 0x77, 0x70, 0x99, 0x99, 0x76, 0xF7, 0x5A, 0xF7, 0x5F, 0xA7, 0x49, 0xFA, 0x74,
+    0xFC, 0x97, 0x00, 0x77, 0x77, 0x77, 0x49, 0xA7, 0x77, 0x9D, 0xA7, 0x76, 0x9E, 0x77, 0x7E, 0xA7,
+    0x76, 0x9E, 0x77, 0x7E, 0x97, 0x76, 0xAE, 0x77, 0x7E, 0x97, 0x76, 0xAE, 0x77, 0x69, 0xE9, 0x77,
+    0x6E, 0xA7, 0x76, 0x9E, 0x77, 0x7E, 0xA7, 0x76, 0xAE, 0x77, 0x39, 0xAF, 0xCA, 0x77, 0x2F, 0xFA,
+    0x77, 0x1F, 0xFD, 0x97, 0x7F, 0xAF, 0xDA, 0x76, 0xF9, 0x9F, 0xE7, 0x6E, 0xA0, 0xFA, 0xE7, 0x5A,
+    0xE0, 0x9E, 0x9A, 0xE7, 0x5E, 0xA0, 0xF0, 0xF7, 0x5E, 0xA9, 0xE9, 0x9E, 0xA7, 0x49, 0xEA, 0xF0,
+    0xF7, 0x59, 0xFE, 0xAF, 0xC7, 0x59, 0xFF, 0xF9, 0x76, 0xFF, 0xEA, 0x77, 0xAF, 0xFD, 0x77, 0x1F,
+    0xFA, 0x77, 0x19, 0xFD, 0xA7, 0x73, 0xF7, 0x76, 0x9E, 0xA7, 0x76, 0xF7, 0x76, 0xAE, 0xA7, 0x76,
+    0xF7, 0x76, 0xAE, 0x97, 0x76, 0xF7, 0x76, 0xF9, 0x77, 0x59, 0xF7, 0x76, 0xEA, 0x77, 0x6A, 0xD9,
+    0x77, 0x7C, 0xA7, 0x77, 0x09, 0x77, 0x72, 0x59, 0x99, 0x74, 0xAE, 0x97, 0x3F, 0x97, 0x3F, 0xA7,
+    0x29, 0xFA, 0x77, 0x77, 0x77, 0x39, 0xE5, 0xAE, 0x1A, 0xDA, 0x5E, 0xA1, 0xE9, 0x49, 0xE9, 0x1E,
+    0x94, 0xAE, 0x2E, 0x5F, 0x19, 0xE5, 0xEA, 0x1A, 0xE4, 0xAE, 0xA1, 0xAD, 0xA4, 0xF9, 0x1E, 0x93,
+    0x9F, 0x2E, 0x93, 0xFC, 0x2F, 0x91, 0xAF, 0xA2, 0xFF, 0xF9, 0x2F, 0xFF, 0x3F, 0xFF, 0x3A, 0xFF,
+    0xDA, 0x49, 0xAE, 0xA7, 0x77, 0x73, 0x9D, 0x97, 0x3D, 0xA7, 0x3E, 0x73, 0xAD, 0x97, 0x2A, 0xE7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9E, 0x5A, 0xE1, 0xAD, 0xA5, 0xEA, 0x1E, 0x94, 0x9E, 0x91,
+    0xE9, 0x4A, 0xE2, 0xE5, 0xF1, 0x9E, 0x5E, 0xA1, 0xAE, 0x4A, 0xEA, 0x1A, 0xDA, 0x4F, 0x91, 0xE9,
+    0x39, 0xF2, 0xE9, 0x3F, 0xC2, 0xF9, 0x1A, 0xFA, 0x2F, 0xFF, 0x92, 0xFF, 0xF3, 0xFF, 0xF3, 0xAF,
+    0xFD, 0xA4, 0x9A, 0xEA, 0x70, 0x5A, 0xD7, 0x4F, 0x72, 0xAF, 0xC7, 0x09, 0xFE, 0x96, 0xEA, 0x0A,
+    0xE9, 0x4E, 0xA3, 0xAD, 0xA7, 0x77, 0x72, 0x9E, 0x5A, 0xE1, 0xAD, 0xA5, 0xEA, 0x1E, 0x94, 0x9E,
+    0x91, 0xE9, 0x4A, 0xE2, 0xE5, 0xF1, 0x9E, 0x5E, 0xA1, 0xAE, 0x4A, 0xEA, 0x1A, 0xDA, 0x4F, 0x91,
+    0xE9, 0x39, 0xF2, 0xE9, 0x3F, 0xC2, 0xF9, 0x1A, 0xFA, 0x2F, 0xFF, 0x92, 0xFF, 0xF3, 0xFF, 0xF3,
+    0xAF, 0xFD, 0xA4, 0x9A, 0xEA, 0x70, 0x59, 0xEA, 0x19, 0xE9, 0x5A, 0xE9, 0x1F, 0x95, 0xF9, 0x09,
+    0xF5, 0xAF, 0x1F, 0xC5, 0xFC, 0x09, 0xFC, 0x59, 0x99, 0x99, 0x09, 0x99, 0x99, 0x97, 0x77, 0x77,
+    0x77, 0x09, 0xE5, 0xAE, 0x3A, 0xDA, 0x5E, 0xA3, 0xE9, 0x49, 0xE9, 0x3E, 0x94, 0xAE, 0x4E, 0x5F,
+    0x39, 0xE5, 0xEA, 0x3A, 0xE4, 0xAE, 0xA3, 0xAD, 0xA4, 0xF9, 0x3E, 0x93, 0x9F, 0x4E, 0x93, 0xFC,
+    0x4F, 0x91, 0xAF, 0xA4, 0xFF, 0xF9, 0x4F, 0xFF, 0x5F, 0xFF, 0x5A, 0xFF, 0xDA, 0x69, 0xAE, 0xA7,
+    0x10, 0x77, 0x0D, 0xA7, 0x70, 0xE7, 0x70, 0xAD, 0x97, 0x79, 0xDA, 0x77, 0x0E, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xF6, 0xF5, 0xF5, 0xAE, 0x6F,
+    0x94, 0xEA, 0x6A, 0xEA, 0x3A, 0xE7, 0x9F, 0x29, 0xE9, 0x70, 0xF9, 0x1F, 0x71, 0xFA, 0x09, 0xE9,
+    0x71, 0xAF, 0x0E, 0xA7, 0x29, 0xFF, 0x74, 0xFE, 0xA7, 0x4F, 0xE7, 0x5A, 0xFC, 0x97, 0x59, 0xFC,
+    0x77, 0xF7, 0x7A, 0xEA, 0x76, 0xAF, 0x73, 0x99, 0xAF, 0xC9, 0x72, 0xFF, 0xA7, 0x3F, 0xF7, 0x39,
+    0xFD, 0xA7, 0x4A, 0xFA, 0x76, 0x6E, 0x97, 0x39, 0xE7, 0x4A, 0xE7, 0x4E, 0xA7, 0x4E, 0xA9, 0x72,
+    0x9F, 0xD9, 0x70, 0xAF, 0xEA, 0x7F, 0xFC, 0x96, 0xE9, 0x09, 0xF5, 0x9E, 0x29, 0xE5, 0xAE, 0x3E,
+    0x94, 0xEA, 0x3E, 0x49, 0xE9, 0x2A, 0xE4, 0xAE, 0x3E, 0x94, 0xF2, 0xF5, 0xEA, 0x09, 0xF5, 0x9E,
+    0xAF, 0xC9, 0x5A, 0xFF, 0x96, 0xFE, 0xA7, 0x0F, 0xCA, 0x97, 0x09, 0xE9, 0x73, 0xAE, 0x74, 0xF7,
+    0x4E, 0xA7, 0x39, 0xE9, 0x73, 0xAE, 0x74, 0x72, 0xEA, 0x19, 0xEA, 0x71, 0xAE, 0xA1, 0xF9, 0x71,
+    0xF9, 0x09, 0xF9, 0x70, 0xAF, 0x90, 0xAF, 0x71, 0xFC, 0x1F, 0xC7, 0x19, 0x99, 0x99, 0x19, 0x99,
+    0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xF6, 0xF6, 0xF5, 0xAE, 0x7F, 0x94,
+    0xEA, 0x7A, 0xEA, 0x3A, 0xE7, 0x09, 0xF2, 0x9E, 0x97, 0x1F, 0x91, 0xF7, 0x2F, 0xA0, 0x9E, 0x97,
+    0x2A, 0xF0, 0xEA, 0x73, 0x9F, 0xF7, 0x5F, 0xEA, 0x75, 0xFE, 0x76, 0xAF, 0xC9, 0x76, 0x9F, 0xC7,
+    0x70, 0xF7, 0x70, 0xAE, 0xA7, 0x7A, 0xF7, 0x49, 0x9A, 0xFC, 0x97, 0x3F, 0xFA, 0x74, 0xFF, 0x74,
+    0x9F, 0xDA, 0x75, 0xAF, 0xA7, 0x70, 0x75, 0x99, 0xAA, 0xAA, 0xF9, 0x74, 0xFF, 0xE9, 0x73, 0xAF,
+    0xFE, 0xA7, 0x29, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x29, 0xEA, 0x77, 0x3F, 0xA7, 0x72, 0xAF, 0xC7, 0x71, 0x9F, 0xD7, 0x71, 0xFE, 0x77, 0x0A, 0xEA,
+    0xE7, 0x79, 0xE9, 0xAE, 0x97, 0x6F, 0x09, 0xE9, 0x75, 0xAE, 0x90, 0x9E, 0xA7, 0x49, 0xEA, 0x19,
+    0xEA, 0x74, 0xF2, 0x9F, 0x73, 0xFA, 0x29, 0xF7, 0x29, 0xF4, 0xF7, 0x2F, 0xCA, 0xAA, 0xAA, 0xF7,
+    0x1F, 0xFF, 0xE9, 0x79, 0xFF, 0xFE, 0x97, 0xFF, 0xFF, 0xA6, 0xFF, 0xFF, 0xCA, 0x59, 0xFA, 0x7F,
+    0xC5, 0xFC, 0x70, 0xFC, 0x4F, 0xC9, 0x79, 0xFC, 0x30, 0x71, 0x99, 0x99, 0xAA, 0xAA, 0x96, 0xFF,
+    0xE9, 0x5A, 0xFF, 0xEA, 0x49, 0xFD, 0xAA, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74,
+    0x9A, 0xE9, 0x73, 0xAF, 0xFC, 0xA6, 0xAF, 0xFD, 0x96, 0xEA, 0x19, 0xF9, 0x5E, 0xA3, 0xAE, 0x59,
+    0xE4, 0xAE, 0x5A, 0xD9, 0x4A, 0xE5, 0xE5, 0xAD, 0xA4, 0x9D, 0x95, 0xEA, 0x4A, 0xD6, 0xE9, 0x4E,
+    0x5F, 0x5F, 0xAA, 0xAF, 0xD5, 0xFF, 0xFC, 0x5A, 0xFF, 0xF6, 0xFF, 0xEA, 0x7A, 0xFA, 0x71, 0x77,
+    0x77, 0x7E, 0x39, 0xE7, 0x6F, 0xFD, 0xA7, 0x6F, 0xFD, 0x77, 0x9F, 0xEA, 0x77, 0x29, 0xAA, 0xA9,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xEA, 0x77, 0x4F, 0xA7, 0x73, 0xAF, 0xC7, 0x72, 0x9F,
+    0xD7, 0x72, 0xFE, 0x77, 0x1A, 0xEA, 0xE7, 0x70, 0x9E, 0x9A, 0xE9, 0x77, 0xF0, 0x9E, 0x97, 0x6A,
+    0xE9, 0x09, 0xEA, 0x75, 0x9E, 0xA1, 0x9E, 0xA7, 0x5F, 0x29, 0xF7, 0x4F, 0xA2, 0x9F, 0x73, 0x9F,
+    0x4F, 0x73, 0xFC, 0xAA, 0xAA, 0xAF, 0x72, 0xFF, 0xFE, 0x97, 0x09, 0xFF, 0xFE, 0x97, 0x0F, 0xFF,
+    0xFA, 0x7F, 0xFF, 0xFC, 0xA6, 0x9F, 0xA7, 0xFC, 0x6F, 0xC7, 0x0F, 0xC5, 0xFC, 0x97, 0x9F, 0xC4,
+    0x7D, 0xA4, 0xE7, 0x9F, 0xAA, 0xFC, 0x70, 0xFF, 0xD7, 0x1A, 0xFF, 0x73, 0x9A, 0xF9, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x71, 0x9A, 0xE9, 0x74, 0xAF, 0xFC, 0xA7, 0xAF, 0xFD, 0x97, 0xEA, 0x19, 0xF9,
+    0x6E, 0xA3, 0xAE, 0x69, 0xE4, 0xAE, 0x6A, 0xD9, 0x4A, 0xE6, 0xE5, 0xAD, 0xA5, 0x9D, 0x95, 0xEA,
+    0x5A, 0xD6, 0xE9, 0x5E, 0x5F, 0x6F, 0xAA, 0xAF, 0xD6, 0xFF, 0xFC, 0x6A, 0xFF, 0xF7, 0xFF, 0xEA,
+    0x70, 0xAF, 0xA7, 0x20, 0x75, 0x9E, 0xA7, 0x70, 0xFA, 0x77, 0xAF, 0xC7, 0x69, 0xFD, 0x76, 0xFE,
+    0x75, 0xAE, 0xAE, 0x74, 0x9E, 0x9A, 0xE9, 0x73, 0xF0, 0x9E, 0x97, 0x2A, 0xE9, 0x09, 0xEA, 0x71,
+    0x9E, 0xA1, 0x9E, 0xA7, 0x1F, 0x29, 0xF7, 0x0F, 0xA2, 0x9F, 0x79, 0xF4, 0xF7, 0xFC, 0xAA, 0xAA,
+    0xAF, 0x6F, 0xFF, 0xE9, 0x49, 0xFF, 0xFE, 0x94, 0xFF, 0xFF, 0xA3, 0xFF, 0xFF, 0xCA, 0x29, 0xFA,
+    0x7F, 0xC2, 0xFC, 0x70, 0xFC, 0x1F, 0xC9, 0x79, 0xFC, 0x77, 0x9E, 0xA7, 0x79, 0xE9, 0x77, 0x0A,
+    0xDA, 0x99, 0x77, 0xFD, 0x97, 0x69, 0xFC, 0x77, 0x1A, 0xE7, 0x77, 0x77, 0x59, 0xAE, 0x97, 0x0A,
+    0xFF, 0xCA, 0x3A, 0xFF, 0xD9, 0x3E, 0xA1, 0x9F, 0x92, 0xEA, 0x3A, 0xE2, 0x9E, 0x4A, 0xE2, 0xAD,
+    0x94, 0xAE, 0x2E, 0x5A, 0xDA, 0x19, 0xD9, 0x5E, 0xA1, 0xAD, 0x6E, 0x91, 0xE5, 0xF2, 0xFA, 0xAA,
+    0xFD, 0x2F, 0xFF, 0xC2, 0xAF, 0xFF, 0x3F, 0xFF, 0x4A, 0xFA, 0x0F, 0x72, 0xF9, 0x71, 0xAE, 0x73,
+    0xE7, 0x39, 0xFD, 0x71, 0xFC, 0xA7, 0x19, 0xFA, 0x75, 0x92, 0x77, 0x77, 0x59, 0xD9, 0x77, 0x1E,
+    0x77, 0x1E, 0x77, 0x1A, 0xDA, 0x77, 0x09, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xFD, 0xA9,
+    0x71, 0xAF, 0xFD, 0xA7, 0x0F, 0xFF, 0x79, 0xFF, 0xFC, 0x69, 0xFF, 0xCA, 0xE9, 0x6F, 0xD9, 0x75,
+    0xFD, 0x76, 0xAF, 0xC7, 0x7F, 0xC7, 0x7A, 0xFA, 0x77, 0xFC, 0x77, 0x9F, 0xC7, 0x7A, 0xFA, 0x77,
+    0xFD, 0x77, 0xFD, 0x77, 0xFE, 0xA9, 0x99, 0x9A, 0xD9, 0x5F, 0xFF, 0xE9, 0x5A, 0xFF, 0xFD, 0x69,
+    0xFF, 0xFD, 0x7F, 0xFF, 0xCA, 0x70, 0xFF, 0xFA, 0x71, 0xAF, 0xFD, 0x94, 0x72, 0x9D, 0x97, 0x2D,
+    0xA7, 0x2E, 0x72, 0xAD, 0xA7, 0x19, 0xE7, 0x77, 0x09, 0xAF, 0x95, 0x9F, 0xF4, 0x9F, 0xFA, 0x4F,
+    0xA9, 0x19, 0x93, 0xF7, 0x19, 0xE9, 0x71, 0xAE, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE9, 0x71,
+    0xAE, 0xA2, 0x95, 0x9F, 0xAA, 0xDA, 0x5F, 0xFC, 0x94, 0x9F, 0xFC, 0x6A, 0xFC, 0xA3, 0x74, 0x9D,
+    0x97, 0x73, 0xAE, 0x77, 0x29, 0xFC, 0x97, 0x70, 0xFE, 0xA7, 0x6F, 0x09, 0xF7, 0x4A, 0xE3, 0x9E,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xFD, 0xA9, 0x73, 0xAF, 0xFD, 0xA7, 0x2F, 0xFF,
+    0x71, 0x9F, 0xFF, 0xC7, 0x09, 0xFF, 0xCA, 0xE9, 0x70, 0xFD, 0x97, 0x7F, 0xD7, 0x70, 0xAF, 0xC7,
+    0x71, 0xFC, 0x77, 0x1A, 0xFA, 0x77, 0x1F, 0xC7, 0x71, 0x9F, 0xC7, 0x71, 0xAF, 0xA7, 0x71, 0xFD,
+    0x77, 0x1F, 0xD7, 0x71, 0xFE, 0xA9, 0x99, 0x9A, 0xD9, 0x7F, 0xFF, 0xE9, 0x7A, 0xFF, 0xFD, 0x70,
+    0x9F, 0xFF, 0xD7, 0x1F, 0xFF, 0xCA, 0x72, 0xFF, 0xFA, 0x73, 0xAF, 0xFD, 0x96, 0x77, 0x71, 0xAD,
+    0x97, 0x5F, 0x97, 0x3A, 0xFC, 0x97, 0x19, 0xFE, 0xA7, 0x0E, 0xA1, 0xAE, 0x6E, 0xA3, 0x9E, 0x97,
+    0x77, 0x77, 0x29, 0xAF, 0x97, 0x09, 0xFF, 0x79, 0xFF, 0xA7, 0xFA, 0x91, 0x99, 0x6F, 0x74, 0x9E,
+    0x97, 0x4A, 0xE7, 0x5E, 0xA7, 0x49, 0xE9, 0x74, 0xAE, 0x97, 0x4A, 0xEA, 0x29, 0x70, 0x9F, 0xAA,
+    0xDA, 0x70, 0xFF, 0xC9, 0x79, 0xFF, 0xC7, 0x1A, 0xFC, 0xA6, 0x77, 0x09, 0x99, 0x77, 0x1F, 0x97,
+    0x70, 0xF7, 0x70, 0xAF, 0x77, 0x0F, 0xC7, 0x7A, 0xFC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xFD,
+    0xA9, 0x71, 0xAF, 0xFD, 0xA7, 0x0F, 0xFF, 0x79, 0xFF, 0xFC, 0x69, 0xFF, 0xCA, 0xE9, 0x6F, 0xD9,
+    0x75, 0xFD, 0x76, 0xAF, 0xC7, 0x7F, 0xC7, 0x7A, 0xFA, 0x77, 0xFC, 0x77, 0x9F, 0xC7, 0x7A, 0xFA,
+    0x77, 0xFD, 0x77, 0xFD, 0x77, 0xFE, 0xA9, 0x99, 0x9A, 0xD9, 0x5F, 0xFF, 0xE9, 0x5A, 0xFF, 0xFD,
+    0x69, 0xFF, 0xFD, 0x7F, 0xFF, 0xCA, 0x70, 0xFF, 0xFA, 0x71, 0xAF, 0xFD, 0x94, 0x72, 0xAE, 0x73,
+    0xF7, 0x2A, 0xF7, 0x2F, 0xC7, 0x19, 0xFA, 0x71, 0x99, 0x99, 0x99, 0x77, 0x79, 0xAF, 0x96, 0x9F,
+    0xF5, 0x9F, 0xFA, 0x5F, 0xA9, 0x19, 0x94, 0xF7, 0x29, 0xE9, 0x72, 0xAE, 0x73, 0xEA, 0x72, 0x9E,
+    0x97, 0x2A, 0xE9, 0x72, 0xAE, 0xA2, 0x96, 0x9F, 0xAA, 0xDA, 0x6F, 0xFC, 0x95, 0x9F, 0xFC, 0x7A,
+    0xFC, 0xA4, 0x73, 0x99, 0x69, 0x99, 0x73, 0x9E, 0x39, 0xE9, 0x74, 0xAE, 0x90, 0xF7, 0x7F, 0xEA,
+    0x77, 0x1F, 0xC9, 0x77, 0x29, 0xE9, 0x77, 0x4D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76,
+    0x9A, 0xFD, 0xA9, 0x74, 0xAF, 0xFD, 0xA7, 0x3F, 0xFF, 0x72, 0x9F, 0xFF, 0xC7, 0x19, 0xFF, 0xCA,
+    0xE9, 0x71, 0xFD, 0x97, 0x70, 0xFD, 0x77, 0x1A, 0xFC, 0x77, 0x2F, 0xC7, 0x72, 0xAF, 0xA7, 0x72,
+    0xFC, 0x77, 0x29, 0xFC, 0x77, 0x2A, 0xFA, 0x77, 0x2F, 0xD7, 0x72, 0xFD, 0x77, 0x2F, 0xEA, 0x99,
+    0x99, 0xAD, 0x97, 0x0F, 0xFF, 0xE9, 0x70, 0xAF, 0xFF, 0xD7, 0x19, 0xFF, 0xFD, 0x72, 0xFF, 0xFC,
+    0xA7, 0x3F, 0xFF, 0xA7, 0x4A, 0xFF, 0xD9, 0x70, 0x5A, 0xAA, 0x94, 0x9A, 0xA9, 0x69, 0xE9, 0x2E,
+    0xA7, 0x0A, 0xEA, 0xAE, 0x97, 0x2F, 0xE7, 0x5F, 0xC7, 0x6A, 0xE7, 0x70, 0xAA, 0x77, 0x77, 0x77,
+    0x69, 0xAF, 0x97, 0x29, 0xFF, 0x71, 0x9F, 0xFA, 0x71, 0xFA, 0x91, 0x99, 0x70, 0xF7, 0x69, 0xE9,
+    0x76, 0xAE, 0x77, 0xEA, 0x76, 0x9E, 0x97, 0x6A, 0xE9, 0x76, 0xAE, 0xA2, 0x97, 0x29, 0xFA, 0xAD,
+    0xA7, 0x2F, 0xFC, 0x97, 0x19, 0xFF, 0xC7, 0x3A, 0xFC, 0xA7, 0x00, 0x72, 0xAA, 0xA5, 0xAA, 0xA9,
+    0x72, 0x9E, 0x91, 0x9E, 0x97, 0x4A, 0xEA, 0xF7, 0x7F, 0xDA, 0x77, 0x1F, 0xA7, 0x72, 0xAD, 0xA7,
+    0x74, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xFF, 0xCA, 0x97, 0x3F, 0xFF, 0xCA, 0x71, 0xFF,
+    0xFD, 0xA7, 0x9F, 0xFF, 0xEA, 0x6A, 0xF1, 0x99, 0x9A, 0xFD, 0x6F, 0xA6, 0xAF, 0x6F, 0x97, 0xF9,
+    0x49, 0xF7, 0x0A, 0xE9, 0x4A, 0xF7, 0x0A, 0xE9, 0x4F, 0x97, 0x0A, 0xE4, 0x9F, 0x71, 0xF4, 0xAF,
+    0x70, 0xAE, 0xA4, 0xFA, 0x79, 0xF5, 0xF9, 0x69, 0xFC, 0x49, 0xF9, 0x29, 0x9A, 0xFD, 0x94, 0xAF,
+    0xFF, 0xFC, 0x5F, 0xFF, 0xFC, 0x95, 0xFF, 0xFF, 0xA5, 0x9F, 0xFF, 0xEA, 0x6A, 0xFF, 0xFD, 0x97,
+    0xFF, 0xEA, 0xA9, 0x70, 0x77, 0xF7, 0x74, 0xEA, 0x0E, 0x77, 0x9E, 0x0A, 0xE7, 0x7F, 0x0E, 0xA7,
+    0x7E, 0xA9, 0xE9, 0x76, 0xAE, 0x0A, 0xE7, 0x09, 0xF9, 0x0F, 0x0E, 0xA7, 0xFF, 0xEA, 0x9A, 0xAA,
+    0x7F, 0xFF, 0x73, 0xFA, 0xAF, 0xE7, 0x2F, 0x92, 0xFC, 0xA7, 0x19, 0xE9, 0x3A, 0xF7, 0x2A, 0xDA,
+    0x4A, 0xF7, 0x2E, 0x94, 0xFA, 0x71, 0x9E, 0x5F, 0x72, 0x9E, 0x4A, 0xF7, 0x2A, 0xE3, 0x9F, 0xC7,
+    0x29, 0xFF, 0xFA, 0x73, 0xFF, 0xF9, 0x73, 0xFF, 0xF7, 0x49, 0xFF, 0xE7, 0x6A, 0xEA, 0x97, 0x60,
+    0x6A, 0xFF, 0xCA, 0x97, 0x4F, 0xFF, 0xCA, 0x72, 0xFF, 0xFE, 0x70, 0x9F, 0xFF, 0xEA, 0x7A, 0xF1,
+    0x99, 0x9A, 0xFD, 0x7F, 0xA6, 0xAF, 0x95, 0x9F, 0x70, 0xF9, 0x5A, 0xF7, 0x0A, 0xE9, 0x5F, 0xA7,
+    0x0A, 0xE1, 0x9F, 0xFF, 0x94, 0xF1, 0xAF, 0xFF, 0x5E, 0xA1, 0xFF, 0xFA, 0x4A, 0xE9, 0x5F, 0xA7,
+    0x9F, 0x6F, 0x96, 0xAF, 0xC5, 0x9F, 0x39, 0x9A, 0xFD, 0x95, 0xAF, 0xFF, 0xFC, 0x6F, 0xFF, 0xFC,
+    0x96, 0xFF, 0xFF, 0xA6, 0x9F, 0xFF, 0xEA, 0x7F, 0xFF, 0xE9, 0x70, 0xFF, 0xEA, 0xA9, 0x70, 0x77,
+    0xF7, 0x73, 0xE9, 0x75, 0x9F, 0xFF, 0x72, 0xAF, 0xFF, 0x72, 0xFF, 0xFA, 0x72, 0x99, 0x99, 0xAE,
+    0xA9, 0x99, 0x70, 0x9F, 0x90, 0xF7, 0x3F, 0xFE, 0xA7, 0x2F, 0xFF, 0x72, 0xFA, 0xAF, 0xE7, 0x1F,
+    0x92, 0xFC, 0xA7, 0x09, 0xE9, 0x3A, 0xF7, 0x1A, 0xDA, 0x4A, 0xF7, 0x1E, 0x94, 0xFA, 0x70, 0x9E,
+    0x5F, 0x71, 0x9E, 0x4A, 0xF7, 0x1A, 0xE3, 0x9F, 0xC7, 0x19, 0xFF, 0xFA, 0x72, 0xFF, 0xF9, 0x72,
+    0xFF, 0xF7, 0x39, 0xFF, 0xE7, 0x5A, 0xEA, 0x97, 0x50, 0x72, 0x99, 0x99, 0xAA, 0xAA, 0xDA, 0x72,
+    0xAF, 0xFE, 0x72, 0xFF, 0xF7, 0x1A, 0xDA, 0xAA, 0xAA, 0xA9, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x2A, 0xAA, 0xAA, 0xAA, 0xFE, 0x70, 0xFF, 0xFC, 0x97, 0x9F, 0xFF, 0xA7, 0x0F,
+    0xFA, 0xAA, 0xAA, 0x71, 0xF7, 0x71, 0x9F, 0x77, 0x1A, 0xEA, 0x77, 0x1F, 0x97, 0x70, 0x9F, 0xAA,
+    0xAE, 0xA7, 0x2A, 0xFF, 0xD9, 0x72, 0xFF, 0xE7, 0x3F, 0xFD, 0xA7, 0x2A, 0xF7, 0x71, 0xFA, 0x77,
+    0x1F, 0x97, 0x70, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x0F, 0xFF, 0xD7, 0x0F, 0xFF, 0xD7, 0x9F,
+    0xFF, 0xD7, 0xAF, 0xFF, 0xD7, 0xFF, 0xFE, 0x60, 0x77, 0x73, 0x9A, 0xAF, 0xF9, 0x69, 0xFF, 0xE9,
+    0x6F, 0xFF, 0xA5, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x70, 0x9A, 0xEA, 0x74, 0xFF, 0x72, 0xFC, 0xAF, 0x70, 0xF3, 0x9D, 0x96, 0xAE, 0x29, 0x9A, 0xDA,
+    0x6F, 0xFF, 0xA5, 0xAF, 0xFF, 0xA5, 0xFF, 0xFC, 0xA4, 0x9F, 0xCA, 0xAA, 0x99, 0x99, 0x6A, 0xE7,
+    0x7A, 0xE9, 0x76, 0xAF, 0xA9, 0x29, 0xD9, 0x59, 0xFF, 0xF7, 0xFF, 0xF7, 0x0F, 0xFD, 0xA7, 0x19,
+    0xAF, 0xA9, 0x70, 0x72, 0xAD, 0x4A, 0xD9, 0x72, 0xFC, 0xAF, 0xC7, 0x3A, 0xFF, 0xCA, 0x74, 0xFF,
+    0xA7, 0x6A, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6A, 0xAA, 0xAA, 0xAA, 0xFE, 0x70, 0xFF,
+    0xFC, 0x97, 0x9F, 0xFF, 0xA7, 0x0F, 0xFA, 0xAA, 0xAA, 0x71, 0xF7, 0x71, 0x9F, 0x77, 0x1A, 0xEA,
+    0x77, 0x1F, 0x97, 0x70, 0x9F, 0xAA, 0xAE, 0xA7, 0x2A, 0xFF, 0xD9, 0x72, 0xFF, 0xE7, 0x3F, 0xFD,
+    0xA7, 0x2A, 0xF7, 0x71, 0xFA, 0x77, 0x1F, 0x97, 0x70, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x0F,
+    0xFF, 0xD7, 0x0F, 0xFF, 0xD7, 0x9F, 0xFF, 0xD7, 0xAF, 0xFF, 0xD7, 0xFF, 0xFE, 0x60, 0x77, 0x75,
+    0xE3, 0x9E, 0x70, 0x9F, 0xFD, 0xA7, 0x1F, 0xFD, 0x72, 0x9F, 0xEA, 0x75, 0x9A, 0xAA, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAE, 0xA7, 0x5F, 0xF7, 0x3F, 0xCA, 0xF7, 0x1F,
+    0x39, 0xD9, 0x7A, 0xE2, 0x99, 0xAD, 0xA7, 0xFF, 0xFA, 0x6A, 0xFF, 0xFA, 0x6F, 0xFF, 0xCA, 0x59,
+    0xFC, 0xAA, 0xA9, 0x99, 0x97, 0xAE, 0x77, 0x0A, 0xE9, 0x77, 0xAF, 0xA9, 0x29, 0xD9, 0x69, 0xFF,
+    0xF7, 0x0F, 0xFF, 0x71, 0xFF, 0xDA, 0x72, 0x9A, 0xFA, 0x97, 0x00, 0x77, 0x99, 0x99, 0x77, 0x0A,
+    0xEA, 0x77, 0x0F, 0x97, 0x79, 0xF9, 0x77, 0xFC, 0x77, 0x9F, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x71, 0xAA, 0xAA, 0xAA, 0xAF, 0xE7, 0xFF, 0xFC, 0x96, 0x9F, 0xFF, 0xA7, 0xFF, 0xAA, 0xAA, 0xA7,
+    0x0F, 0x77, 0x09, 0xF7, 0x70, 0xAE, 0xA7, 0x70, 0xF9, 0x77, 0x9F, 0xAA, 0xAE, 0xA7, 0x1A, 0xFF,
+    0xD9, 0x71, 0xFF, 0xE7, 0x2F, 0xFD, 0xA7, 0x1A, 0xF7, 0x70, 0xFA, 0x77, 0x0F, 0x97, 0x79, 0xFA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xD7, 0xFF, 0xFD, 0x69, 0xFF, 0xFD, 0x6A, 0xFF, 0xFD, 0x6F,
+    0xFF, 0xE5, 0x74, 0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4F, 0xA7, 0x3A, 0xFA, 0x73, 0x99, 0x99, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9A, 0xEA, 0x72, 0xFF, 0x70, 0xFC, 0xAF, 0x6F, 0x39,
+    0xD9, 0x4A, 0xE2, 0x99, 0xAD, 0xA4, 0xFF, 0xFA, 0x3A, 0xFF, 0xFA, 0x3F, 0xFF, 0xCA, 0x29, 0xFC,
+    0xAA, 0xA9, 0x99, 0x94, 0xAE, 0x75, 0xAE, 0x97, 0x4A, 0xFA, 0x92, 0x9D, 0x93, 0x9F, 0xFF, 0x5F,
+    0xFF, 0x6F, 0xFD, 0xA7, 0x9A, 0xFA, 0x95, 0x6A, 0xAA, 0xAA, 0xAA, 0xFE, 0x7F, 0xFF, 0xC9, 0x69,
+    0xFF, 0xFA, 0x7F, 0xFA, 0xAA, 0xAA, 0x70, 0xF7, 0x70, 0x9F, 0x77, 0x0A, 0xEA, 0x77, 0x0F, 0x97,
+    0x79, 0xFA, 0xAA, 0xEA, 0x71, 0xAF, 0xFD, 0x97, 0x1F, 0xFE, 0x72, 0xFF, 0xDA, 0x71, 0xAF, 0x77,
+    0x0F, 0xA7, 0x70, 0xF9, 0x77, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD6,
+    0x9F, 0xFF, 0xD6, 0xAF, 0xFF, 0xD6, 0xFF, 0xFE, 0x72, 0xEA, 0x77, 0x0E, 0xA7, 0x70, 0x9D, 0xA7,
+    0x71, 0xAF, 0xC7, 0x79, 0xFC, 0x77, 0x1A, 0xD9, 0x77, 0x77, 0x20, 0x69, 0xAE, 0xA7, 0x1F, 0xF7,
+    0xFC, 0xAF, 0x5F, 0x39, 0xD9, 0x3A, 0xE2, 0x99, 0xAD, 0xA3, 0xFF, 0xFA, 0x2A, 0xFF, 0xFA, 0x2F,
+    0xFF, 0xCA, 0x19, 0xFC, 0xAA, 0xA9, 0x99, 0x93, 0xAE, 0x74, 0xAE, 0x97, 0x3A, 0xFA, 0x92, 0x9D,
+    0x92, 0x9F, 0xFF, 0x4F, 0xFF, 0x5F, 0xFD, 0xA6, 0x9A, 0xFA, 0x97, 0x77, 0x3A, 0xA7, 0x49, 0xE9,
+    0x72, 0x9E, 0x97, 0x3E, 0x74, 0x9F, 0xC7, 0x3F, 0xC7, 0x4A, 0xE7, 0x77, 0x10, 0x77, 0x77, 0x19,
+    0xE4, 0xAD, 0xA7, 0x3A, 0xE9, 0x09, 0xEA, 0x75, 0xFF, 0x97, 0x7F, 0xD7, 0x71, 0x9F, 0x77, 0x3E,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5A, 0xAA, 0xAA, 0xAA, 0xFE, 0x71, 0xFF, 0xFC,
+    0x97, 0x09, 0xFF, 0xFA, 0x71, 0xFF, 0xAA, 0xAA, 0xA7, 0x2F, 0x77, 0x29, 0xF7, 0x72, 0xAE, 0xA7,
+    0x72, 0xF9, 0x77, 0x19, 0xFA, 0xAA, 0xEA, 0x73, 0xAF, 0xFD, 0x97, 0x3F, 0xFE, 0x74, 0xFF, 0xDA,
+    0x73, 0xAF, 0x77, 0x2F, 0xA7, 0x72, 0xF9, 0x77, 0x19, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x71, 0xFF,
+    0xFD, 0x71, 0xFF, 0xFD, 0x70, 0x9F, 0xFF, 0xD7, 0x0A, 0xFF, 0xFD, 0x70, 0xFF, 0xFE, 0x70, 0x79,
+    0x99, 0x69, 0x99, 0x7A, 0xE3, 0xAE, 0x71, 0xF9, 0x9E, 0xA7, 0x3F, 0xE9, 0x74, 0x9F, 0xC7, 0x7A,
+    0xE7, 0x70, 0x9D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAE, 0xA7,
+    0x5F, 0xF7, 0x3F, 0xCA, 0xF7, 0x1F, 0x39, 0xD9, 0x7A, 0xE2, 0x99, 0xAD, 0xA7, 0xFF, 0xFA, 0x6A,
+    0xFF, 0xFA, 0x6F, 0xFF, 0xCA, 0x59, 0xFC, 0xAA, 0xA9, 0x99, 0x97, 0xAE, 0x77, 0x0A, 0xE9, 0x77,
+    0xAF, 0xA9, 0x29, 0xD9, 0x69, 0xFF, 0xF7, 0x0F, 0xFF, 0x71, 0xFF, 0xDA, 0x72, 0x9A, 0xFA, 0x97,
+    0x00, 0x77, 0xE7, 0x76, 0xEA, 0x77, 0x4F, 0xCA, 0x77, 0x2A, 0xFE, 0x77, 0x09, 0xEA, 0x0A, 0xE9,
+    0x76, 0xE9, 0x3A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xAF,
+    0xEA, 0xA9, 0x73, 0xAF, 0xFF, 0xA7, 0x19, 0xFF, 0xFD, 0xA7, 0x09, 0xFF, 0xFE, 0x97, 0x9F, 0xE9,
+    0x93, 0x99, 0xA9, 0x7F, 0xD9, 0x77, 0x1A, 0xFC, 0x77, 0x3F, 0xC7, 0x73, 0xAF, 0xA7, 0x73, 0xFC,
+    0x77, 0x4F, 0xC5, 0xAA, 0x99, 0x71, 0x9F, 0xA4, 0x9F, 0xF9, 0x4A, 0xF9, 0x49, 0xFF, 0xA4, 0xFC,
+    0x59, 0xFF, 0xA4, 0xFC, 0x97, 0x9F, 0xC9, 0x4F, 0xCA, 0x7A, 0xE9, 0x6F, 0xE9, 0x91, 0x99, 0xAF,
+    0x7A, 0xFF, 0xFF, 0xC7, 0x0F, 0xFF, 0xFC, 0x70, 0xAF, 0xFF, 0xEA, 0x71, 0x9F, 0xFF, 0xCA, 0x74,
+    0x9A, 0xFD, 0xA9, 0x71, 0x77, 0x77, 0x3D, 0xA7, 0x72, 0xAE, 0xA7, 0x70, 0x9F, 0xCA, 0x77, 0xFF,
+    0x75, 0xF1, 0xAE, 0x97, 0x2A, 0xDA, 0x4A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5A, 0xEA,
+    0x1E, 0x97, 0x19, 0xFE, 0xAE, 0x71, 0x9F, 0xFF, 0x71, 0xEA, 0x1A, 0xFC, 0xA7, 0x0E, 0x93, 0xFC,
+    0x97, 0x9D, 0xA4, 0xFC, 0x70, 0xAD, 0x5F, 0xA7, 0x0D, 0xA5, 0xF9, 0x79, 0xD9, 0x49, 0xF7, 0x09,
+    0xD9, 0x4F, 0xC7, 0x0A, 0xDA, 0x29, 0xFC, 0xA7, 0x0A, 0xFF, 0xF7, 0x19, 0xFF, 0xF7, 0x2F, 0xFE,
+    0xA7, 0x29, 0xFF, 0xD9, 0x74, 0xAE, 0xAF, 0x77, 0x2E, 0xA7, 0x71, 0xF7, 0x2A, 0xA9, 0x29, 0xF9,
+    0x72, 0xFF, 0xE7, 0x2A, 0xFF, 0xD7, 0x3F, 0xFD, 0x74, 0x9A, 0xFD, 0x97, 0x40, 0x77, 0x77, 0x70,
+    0x9D, 0xA3, 0xAE, 0x76, 0xAF, 0xFD, 0x97, 0x69, 0xFF, 0xCA, 0x77, 0x0A, 0xFE, 0xA7, 0x73, 0xAA,
+    0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xFE, 0xAA, 0x97, 0x4A,
+    0xFF, 0xFA, 0x72, 0x9F, 0xFF, 0xDA, 0x71, 0x9F, 0xFF, 0xE9, 0x70, 0x9F, 0xE9, 0x93, 0x99, 0xA9,
+    0x70, 0xFD, 0x97, 0x72, 0xAF, 0xC7, 0x74, 0xFC, 0x77, 0x4A, 0xFA, 0x77, 0x4F, 0xC7, 0x75, 0xFC,
+    0x5A, 0xA9, 0x97, 0x29, 0xFA, 0x49, 0xFF, 0x95, 0xAF, 0x94, 0x9F, 0xFA, 0x5F, 0xC5, 0x9F, 0xFA,
+    0x5F, 0xC9, 0x79, 0xFC, 0x95, 0xFC, 0xA7, 0xAE, 0x97, 0xFE, 0x99, 0x19, 0x9A, 0xF7, 0x0A, 0xFF,
+    0xFF, 0xC7, 0x1F, 0xFF, 0xFC, 0x71, 0xAF, 0xFF, 0xEA, 0x72, 0x9F, 0xFF, 0xCA, 0x75, 0x9A, 0xFD,
+    0xA9, 0x72, 0x72, 0xAD, 0x4A, 0xD9, 0x72, 0xFC, 0xAF, 0xC7, 0x3F, 0xFD, 0xA7, 0x4F, 0xFA, 0x76,
+    0xAF, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xEA, 0x1E, 0x97, 0x19, 0xFE, 0xAE, 0x71,
+    0x9F, 0xFF, 0x71, 0xEA, 0x1A, 0xFC, 0xA7, 0x0E, 0x93, 0xFC, 0x97, 0x9D, 0xA4, 0xFC, 0x70, 0xAD,
+    0x5F, 0xA7, 0x0D, 0xA5, 0xF9, 0x79, 0xD9, 0x49, 0xF7, 0x09, 0xD9, 0x4F, 0xC7, 0x0A, 0xDA, 0x29,
+    0xFC, 0xA7, 0x0A, 0xFF, 0xF7, 0x19, 0xFF, 0xF7, 0x2F, 0xFE, 0xA7, 0x29, 0xFF, 0xD9, 0x74, 0xAE,
+    0xAF, 0x77, 0x2E, 0xA7, 0x71, 0xF7, 0x2A, 0xA9, 0x29, 0xF9, 0x72, 0xFF, 0xE7, 0x2A, 0xFF, 0xD7,
+    0x3F, 0xFD, 0x74, 0x9A, 0xFD, 0x97, 0x40, 0x77, 0x2F, 0x77, 0x19, 0xEA, 0x77, 0x1F, 0xA7, 0x70,
+    0x9F, 0x97, 0x70, 0xFC, 0x97, 0x70, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x69, 0xAF, 0xEA, 0xA9, 0x70, 0xAF, 0xFF, 0xA6, 0x9F, 0xFF, 0xDA, 0x59, 0xFF, 0xFE, 0x94, 0x9F,
+    0xE9, 0x93, 0x99, 0xA9, 0x4F, 0xD9, 0x76, 0xAF, 0xC7, 0x70, 0xFC, 0x77, 0x0A, 0xFA, 0x77, 0x0F,
+    0xC7, 0x71, 0xFC, 0x5A, 0xA9, 0x96, 0x9F, 0xA4, 0x9F, 0xF9, 0x1A, 0xF9, 0x49, 0xFF, 0xA1, 0xFC,
+    0x59, 0xFF, 0xA1, 0xFC, 0x97, 0x9F, 0xC9, 0x1F, 0xCA, 0x7A, 0xE9, 0x3F, 0xE9, 0x91, 0x99, 0xAF,
+    0x4A, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 0xC5, 0xAF, 0xFF, 0xEA, 0x69, 0xFF, 0xFC, 0xA7, 0x19, 0xAF,
+    0xDA, 0x96, 0x77, 0x99, 0x97, 0x7A, 0xE9, 0x76, 0xF9, 0x75, 0xAF, 0x76, 0xFC, 0x75, 0x9F, 0xC7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xEA, 0x1E, 0x96, 0x9F, 0xEA, 0xE6, 0x9F, 0xFF, 0x6E, 0xA1,
+    0xAF, 0xCA, 0x5E, 0x93, 0xFC, 0x94, 0x9D, 0xA4, 0xFC, 0x5A, 0xD5, 0xFA, 0x5D, 0xA5, 0xF9, 0x49,
+    0xD9, 0x49, 0xF5, 0x9D, 0x94, 0xFC, 0x5A, 0xDA, 0x29, 0xFC, 0xA5, 0xAF, 0xFF, 0x69, 0xFF, 0xF7,
+    0xFF, 0xEA, 0x79, 0xFF, 0xD9, 0x71, 0xAE, 0xAF, 0x77, 0xEA, 0x76, 0xF7, 0xAA, 0x92, 0x9F, 0x97,
+    0xFF, 0xE7, 0xAF, 0xFD, 0x70, 0xFF, 0xD7, 0x19, 0xAF, 0xD9, 0x71, 0x77, 0x77, 0x70, 0xAF, 0xC9,
+    0x77, 0x0F, 0xD7, 0x71, 0xFC, 0x77, 0x19, 0xFA, 0x77, 0x1F, 0xC7, 0x71, 0xAF, 0xA7, 0x71, 0xFC,
+    0x77, 0x1F, 0xC9, 0x77, 0x19, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x9A, 0xFE, 0xAA, 0x97, 0x1A, 0xFF, 0xFA, 0x79, 0xFF, 0xFD, 0xA6, 0x9F, 0xFF, 0xE9, 0x59,
+    0xFE, 0x99, 0x39, 0x9A, 0x95, 0xFD, 0x97, 0x7A, 0xFC, 0x77, 0x1F, 0xC7, 0x71, 0xAF, 0xA7, 0x71,
+    0xFC, 0x77, 0x2F, 0xC5, 0xAA, 0x99, 0x79, 0xFA, 0x49, 0xFF, 0x92, 0xAF, 0x94, 0x9F, 0xFA, 0x2F,
+    0xC5, 0x9F, 0xFA, 0x2F, 0xC9, 0x79, 0xFC, 0x92, 0xFC, 0xA7, 0xAE, 0x94, 0xFE, 0x99, 0x19, 0x9A,
+    0xF5, 0xAF, 0xFF, 0xFC, 0x6F, 0xFF, 0xFC, 0x6A, 0xFF, 0xFE, 0xA7, 0x9F, 0xFF, 0xCA, 0x72, 0x9A,
+    0xFD, 0xA9, 0x70, 0x75, 0x99, 0x99, 0x99, 0x75, 0x9F, 0xCA, 0x75, 0xAF, 0xC7, 0x6F, 0xC9, 0x76,
+    0xFC, 0x76, 0xFC, 0x97, 0x59, 0xFA, 0x76, 0xFC, 0x76, 0xAF, 0xA7, 0x77, 0x77, 0x77, 0xAE, 0xA1,
+    0xE9, 0x79, 0xFE, 0xAE, 0x79, 0xFF, 0xF7, 0xEA, 0x1A, 0xFC, 0xA6, 0xE9, 0x3F, 0xC9, 0x59, 0xDA,
+    0x4F, 0xC6, 0xAD, 0x5F, 0xA6, 0xDA, 0x5F, 0x95, 0x9D, 0x94, 0x9F, 0x69, 0xD9, 0x4F, 0xC6, 0xAD,
+    0xA2, 0x9F, 0xCA, 0x6A, 0xFF, 0xF7, 0x9F, 0xFF, 0x70, 0xFF, 0xEA, 0x70, 0x9F, 0xFD, 0x97, 0x2A,
+    0xEA, 0xF7, 0x70, 0xEA, 0x77, 0xF7, 0x0A, 0xA9, 0x29, 0xF9, 0x70, 0xFF, 0xE7, 0x0A, 0xFF, 0xD7,
+    0x1F, 0xFD, 0x72, 0x9A, 0xFD, 0x97, 0x20, 0x77, 0x77, 0x5A, 0xD9, 0x77, 0x3F, 0x77, 0x2A, 0xFC,
+    0x97, 0x79, 0xFE, 0xA7, 0x6E, 0xA1, 0xF7, 0x4E, 0x93, 0x9E, 0x97, 0x77, 0x77, 0x77, 0x77, 0x6F,
+    0x96, 0xAE, 0xA5, 0x9F, 0x7F, 0x95, 0xAF, 0x7F, 0x95, 0xFA, 0x69, 0xF6, 0xF9, 0x6A, 0xF5, 0x9F,
+    0x7F, 0xA5, 0xFC, 0x69, 0xF9, 0x5F, 0xA6, 0xAF, 0x59, 0xF9, 0x6F, 0xC5, 0xAF, 0x96, 0xFA, 0x5F,
+    0xC6, 0xAF, 0x94, 0x9F, 0xC9, 0x99, 0x99, 0x99, 0xFC, 0x5A, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 0xCA,
+    0x5F, 0xFF, 0xFC, 0xA4, 0x9F, 0xFF, 0xFC, 0x94, 0xFF, 0xFF, 0xD5, 0xFC, 0x95, 0xAF, 0xC4, 0x9F,
+    0xC6, 0xFC, 0xA4, 0xAF, 0xC5, 0x9F, 0xC9, 0x4F, 0xCA, 0x5A, 0xFC, 0x40, 0x79, 0xD7, 0x6F, 0x74,
+    0xAF, 0xC7, 0x29, 0xFE, 0x97, 0x0F, 0x09, 0xEA, 0x6A, 0xDA, 0x3A, 0xE7, 0x77, 0x77, 0x77, 0x6E,
+    0xA7, 0x49, 0xE7, 0x5E, 0xA7, 0x5E, 0x97, 0x49, 0xE7, 0x5E, 0xA7, 0x5E, 0x9A, 0xF9, 0x69, 0xFF,
+    0xDA, 0x5F, 0xFF, 0x5F, 0xC9, 0x1A, 0xE4, 0xAF, 0x4E, 0x4F, 0x5E, 0x4E, 0xA4, 0x9E, 0x3A, 0xE9,
+    0x4A, 0xDA, 0x3F, 0x5E, 0x92, 0x9F, 0x49, 0xE3, 0xAE, 0xA4, 0xAE, 0x3F, 0xA4, 0xF2, 0x9F, 0x93,
+    0xAE, 0xA2, 0xAF, 0x93, 0xF9, 0x2F, 0xC3, 0x9F, 0x93, 0x9A, 0xAC, 0x39, 0x99, 0x40, 0x6F, 0x96,
+    0xAE, 0xA6, 0x9F, 0x7F, 0x96, 0xAF, 0x7F, 0x96, 0xFA, 0x6A, 0xF7, 0xF9, 0x6F, 0xC5, 0xAF, 0xCA,
+    0xAA, 0xAA, 0xAA, 0xAF, 0xCA, 0x4F, 0xFF, 0xFF, 0x39, 0xFF, 0xFF, 0xEA, 0x3A, 0xFF, 0xFF, 0xE9,
+    0x4A, 0xF6, 0x9F, 0xA6, 0xFC, 0x6A, 0xF9, 0x59, 0xFC, 0x99, 0x99, 0x99, 0x9F, 0xC6, 0xAF, 0xFF,
+    0xFC, 0x6F, 0xFF, 0xFC, 0xA6, 0xFF, 0xFF, 0xCA, 0x59, 0xFF, 0xFF, 0xC9, 0x5F, 0xFF, 0xFD, 0x6F,
+    0xC9, 0x5A, 0xFC, 0x59, 0xFC, 0x6F, 0xCA, 0x5A, 0xFC, 0x59, 0xFC, 0x95, 0xFC, 0xA5, 0xAF, 0xC5,
+    0x7E, 0xA7, 0x49, 0xE1, 0x99, 0x69, 0xAA, 0xFF, 0x6F, 0xFD, 0xA6, 0xFD, 0x99, 0x97, 0x2E, 0xA7,
+    0x5E, 0x9A, 0xF9, 0x6A, 0xFF, 0xDA, 0x5F, 0xFF, 0x49, 0xFC, 0x91, 0xAE, 0x4A, 0xF4, 0xE4, 0xF5,
+    0xE3, 0x9E, 0xA4, 0x9E, 0x3A, 0xE9, 0x4A, 0xDA, 0x3F, 0x5E, 0x92, 0x9F, 0x49, 0xE3, 0xAE, 0xA4,
+    0xAE, 0x3F, 0xA4, 0xF2, 0x9F, 0x93, 0xAE, 0xA2, 0xAF, 0x93, 0xF9, 0x2F, 0xC3, 0x9F, 0x93, 0x9A,
+    0xAC, 0x39, 0x99, 0x40, 0x70, 0x99, 0x2D, 0x70, 0xEA, 0x09, 0xD7, 0xFC, 0x9A, 0xD6, 0x9D, 0x0A,
+    0xF9, 0x6A, 0xD1, 0xF7, 0x0A, 0xA2, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9D, 0xAA, 0x73,
+    0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAE, 0xA7, 0x3A, 0xE9, 0x73, 0xF7,
+    0x4F, 0x73, 0x9E, 0xA7, 0x3A, 0xE9, 0x73, 0xF7, 0x39, 0xF7, 0x3A, 0xF7, 0x3F, 0xA7, 0x3F, 0x97,
+    0x29, 0xF7, 0x3F, 0xC7, 0x3F, 0xC7, 0x29, 0xFA, 0x72, 0xAF, 0xA7, 0x2A, 0xAE, 0x97, 0x10, 0x39,
+    0xDA, 0x1A, 0xC9, 0x3F, 0xA0, 0xD9, 0x2A, 0xDA, 0xDA, 0xD3, 0xD9, 0x0F, 0xA3, 0xD9, 0x09, 0xDA,
+    0x77, 0x77, 0x77, 0x71, 0xAC, 0xA9, 0x70, 0xE9, 0x70, 0xE7, 0x09, 0xE7, 0x0A, 0xDA, 0x70, 0xE9,
+    0x70, 0xE7, 0x09, 0xE7, 0x0A, 0xDA, 0x70, 0xEA, 0x79, 0xE9, 0x7A, 0xE7, 0x0F, 0x70, 0xF7, 0xAF,
+    0x79, 0xAD, 0xA7, 0x70, 0x99, 0x99, 0xAA, 0xAA, 0x6F, 0xFE, 0x94, 0xAF, 0xFE, 0x93, 0x9F, 0xEA,
+    0xAA, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9D, 0xAA, 0x74, 0x9F, 0x74, 0xAE,
+    0xA7, 0x4F, 0x97, 0x4F, 0x74, 0x9F, 0x74, 0xAE, 0xA7, 0x4A, 0xE9, 0x74, 0xF7, 0x5F, 0x74, 0x9E,
+    0xA7, 0x4A, 0xE9, 0x74, 0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4F, 0xA7, 0x4F, 0x97, 0x39, 0xF7, 0x4F,
+    0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0xAF, 0xA7, 0x3A, 0xAE, 0x97, 0x20, 0x77, 0x0A, 0xAA, 0xAF,
+    0xDA, 0x1F, 0xFF, 0x09, 0xFF, 0xF0, 0xAA, 0xA9, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x76, 0xAC,
+    0xA9, 0x71, 0xE9, 0x71, 0xE7, 0x19, 0xE7, 0x1A, 0xDA, 0x71, 0xE9, 0x71, 0xE7, 0x19, 0xE7, 0x1A,
+    0xDA, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1F, 0x71, 0xF7, 0x0A, 0xF7, 0x09, 0xAD, 0xA7,
+    0x00, 0x79, 0xDA, 0xA7, 0x09, 0xF7, 0x0A, 0xEA, 0x70, 0xF9, 0x70, 0xF7, 0x09, 0xF7, 0x0A, 0xEA,
+    0x70, 0xAE, 0x97, 0x0F, 0x71, 0xF7, 0x09, 0xEA, 0x70, 0xAE, 0x97, 0x0F, 0x70, 0x9F, 0x70, 0xAF,
+    0x70, 0xFA, 0x70, 0xF9, 0x79, 0xF7, 0x0F, 0xC7, 0x0F, 0xC7, 0x9F, 0xA7, 0xAF, 0xA7, 0xE0, 0xA9,
+    0x6E, 0x71, 0xAD, 0x72, 0xFC, 0x97, 0xAF, 0x97, 0x09, 0xE7, 0x75, 0x72, 0x99, 0x97, 0x2A, 0xE9,
+    0x71, 0xF9, 0x70, 0xAF, 0x71, 0xFC, 0x70, 0x9F, 0xC7, 0x77, 0x77, 0x74, 0xAC, 0xA9, 0x72, 0xE9,
+    0x72, 0xE7, 0x29, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x72, 0xE7, 0x29, 0xE7, 0x2A, 0xDA, 0x72, 0xEA,
+    0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xF7, 0x1A, 0xF7, 0x1A, 0xEA, 0x70, 0x9E, 0xA7, 0x09,
+    0xE9, 0x71, 0xE9, 0x72, 0xFD, 0x70, 0xFD, 0x71, 0xAE, 0xA7, 0x49, 0x70, 0x72, 0x99, 0x99, 0x73,
+    0xF7, 0x2A, 0xF7, 0x2F, 0xA7, 0x19, 0xFA, 0x71, 0xFC, 0x97, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9D,
+    0xAA, 0x72, 0x9F, 0x72, 0xAE, 0xA7, 0x2F, 0x97, 0x2F, 0x72, 0x9F, 0x72, 0xAE, 0xA7, 0x2A, 0xE9,
+    0x72, 0xF7, 0x3F, 0x72, 0x9E, 0xA7, 0x2A, 0xE9, 0x72, 0xF7, 0x29, 0xF7, 0x2A, 0xF7, 0x2F, 0xA7,
+    0x2F, 0x97, 0x19, 0xF7, 0x2F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0xA7, 0x1A, 0xAE, 0x97,
+    0x00, 0x3A, 0xCA, 0x93, 0xE9, 0x3E, 0x39, 0xE3, 0xAD, 0xA3, 0xE9, 0x3E, 0x39, 0xE3, 0xAD, 0xA3,
+    0xEA, 0x29, 0xE9, 0x2A, 0xE3, 0xF3, 0xF2, 0xAF, 0x29, 0xAD, 0xA2, 0x5E, 0xA9, 0x70, 0xAA, 0xAA,
+    0x95, 0xF9, 0x79, 0xF6, 0xF7, 0x0A, 0xF5, 0x9F, 0x70, 0xFA, 0x5A, 0xEA, 0x79, 0xF9, 0x5F, 0x97,
+    0xAF, 0x6F, 0x70, 0xFA, 0x6F, 0x70, 0xF9, 0x59, 0xEA, 0x7A, 0xF6, 0xAE, 0x97, 0xFA, 0x6F, 0x70,
+    0xF9, 0x6F, 0x79, 0xF6, 0xAE, 0xA7, 0xFC, 0x6F, 0x97, 0xFA, 0x6F, 0x96, 0x9F, 0x69, 0xF7, 0xAF,
+    0x6A, 0xF7, 0xFA, 0x6F, 0xA6, 0x9F, 0x95, 0x9F, 0xA6, 0xAF, 0x6A, 0xF9, 0x6F, 0xA6, 0xFC, 0x7F,
+    0x96, 0xFC, 0x69, 0xF6, 0x9A, 0xAE, 0x6F, 0xA7, 0x73, 0xF9, 0x77, 0x2F, 0xC7, 0x4A, 0xC9, 0x2A,
+    0xFC, 0x74, 0xFF, 0xE9, 0x73, 0x9F, 0xFE, 0x74, 0xFF, 0xE9, 0x74, 0xFF, 0xDA, 0x74, 0xAF, 0xFC,
+    0xA7, 0x69, 0xAA, 0xFA, 0x77, 0x77, 0x50, 0x69, 0xE9, 0x7E, 0x7F, 0x96, 0x9E, 0x69, 0xF7, 0xF6,
+    0xFC, 0x69, 0xEA, 0x6F, 0xC7, 0x71, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xCA, 0x97,
+    0x09, 0xE6, 0xE9, 0x70, 0xEA, 0x6E, 0x71, 0xE9, 0x59, 0xE7, 0x09, 0xE6, 0xAD, 0xA7, 0x0A, 0xDA,
+    0x6E, 0x97, 0x0E, 0x96, 0xE7, 0x1E, 0x69, 0xE7, 0x09, 0xE6, 0xAD, 0xA7, 0x0E, 0x96, 0xEA, 0x70,
+    0xE6, 0x9E, 0x97, 0x9E, 0x6A, 0xE7, 0x0A, 0xDA, 0x6F, 0x70, 0xE7, 0xF7, 0x9E, 0x6A, 0xF7, 0xEA,
+    0x69, 0xAD, 0xA6, 0x9E, 0x97, 0x72, 0xF7, 0x70, 0xAF, 0xCA, 0x77, 0x0F, 0xD7, 0x70, 0x9F, 0xCA,
+    0x77, 0x0A, 0xFA, 0x77, 0x77, 0x10, 0x77, 0x77, 0x71, 0xDA, 0x77, 0x5A, 0xEA, 0x77, 0x39, 0xFC,
+    0xA7, 0x72, 0xFF, 0x77, 0x0F, 0x1A, 0xE9, 0x75, 0xAE, 0x4A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0xAF, 0x77, 0x4F, 0xA7, 0x73, 0x9F, 0x77, 0x4F, 0xC7, 0x74, 0xF9, 0x77, 0x3A, 0xF7, 0x74,
+    0xFA, 0x77, 0x39, 0xF9, 0x77, 0x3A, 0xF7, 0x74, 0xFA, 0x77, 0x39, 0xF7, 0x74, 0xAF, 0x77, 0x4F,
+    0x97, 0x73, 0x9F, 0x77, 0x4F, 0xA7, 0x74, 0xF9, 0x77, 0x3A, 0xF7, 0x74, 0xFA, 0x77, 0x39, 0xF7,
+    0x74, 0xFC, 0x75, 0xCA, 0x90, 0x9A, 0xFC, 0x97, 0x4A, 0xFF, 0xE7, 0x5F, 0xFE, 0x97, 0x49, 0xFF,
+    0xDA, 0x75, 0xFF, 0xD9, 0x76, 0x9A, 0xAF, 0xC9, 0x77, 0x77, 0x71, 0x77, 0x77, 0xDA, 0x77, 0x0A,
+    0xEA, 0x76, 0x9F, 0xCA, 0x75, 0xFF, 0x73, 0xF1, 0xAE, 0x97, 0x0A, 0xDA, 0x4A, 0xDA, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x76, 0xAA, 0xA7, 0x70, 0x9E, 0x77, 0x0A, 0xDA, 0x77, 0x0E, 0x97, 0x79, 0xE7,
+    0x70, 0xAD, 0xA7, 0x70, 0xE9, 0x77, 0x9E, 0x77, 0x0A, 0xDA, 0x77, 0x0E, 0x97, 0x79, 0xE7, 0x70,
+    0xAD, 0xA7, 0x70, 0xE9, 0x77, 0x9E, 0x77, 0x0E, 0xA7, 0x7F, 0x97, 0x49, 0xFD, 0x75, 0xAF, 0xCA,
+    0x75, 0xFD, 0x75, 0x9F, 0xA7, 0x77, 0x73, 0x77, 0x77, 0x5F, 0xD7, 0x70, 0xFC, 0x97, 0x79, 0xFC,
+    0x77, 0x0A, 0xF7, 0x70, 0x9F, 0xA7, 0x70, 0xFC, 0x77, 0x0A, 0xFA, 0x77, 0x9F, 0xC7, 0x71, 0x99,
+    0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xF2, 0xAF, 0xA7, 0x0A, 0xE9, 0x19, 0xFA, 0x71, 0xF1,
+    0x9F, 0xC7, 0x19, 0xEA, 0x1F, 0xC7, 0x2F, 0x90, 0xFC, 0x73, 0xF0, 0xFC, 0x73, 0xAE, 0x9A, 0xF9,
+    0x73, 0xFA, 0xF9, 0x73, 0x9F, 0xFA, 0x74, 0xFF, 0xA7, 0x5F, 0xEA, 0x75, 0xAF, 0xE7, 0x6F, 0xEA,
+    0x75, 0x9F, 0xFA, 0x74, 0xAF, 0xFC, 0x97, 0x3F, 0xFE, 0x97, 0x19, 0xF0, 0xFE, 0x71, 0xFC, 0x09,
+    0xFE, 0x70, 0xFA, 0x1F, 0xF6, 0xAF, 0x91, 0x9F, 0xEA, 0x5F, 0xC3, 0xFF, 0xA3, 0x71, 0xE9, 0x74,
+    0xAE, 0x75, 0xEA, 0x75, 0xE9, 0x74, 0xAE, 0x75, 0xEA, 0x75, 0xE9, 0x74, 0xAE, 0x75, 0xEA, 0x09,
+    0xEA, 0x69, 0xE0, 0xAE, 0xA7, 0xAE, 0xAE, 0xA7, 0x0F, 0xE9, 0x70, 0x9F, 0xD9, 0x71, 0xAF, 0xC9,
+    0x72, 0xFE, 0x71, 0x9F, 0xF7, 0x0A, 0xFF, 0xC7, 0xF9, 0xFC, 0xA5, 0x9F, 0x0F, 0xDA, 0x4A, 0xEA,
+    0x09, 0xFD, 0x93, 0xF9, 0x1A, 0xFD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x39, 0xFC, 0x97, 0x2A, 0xFC,
+    0x73, 0xFC, 0x97, 0x3F, 0xC7, 0x3A, 0xF9, 0x72, 0x9F, 0xC7, 0x3F, 0xC7, 0x3A, 0xFA, 0x73, 0xAA,
+    0xAA, 0xA7, 0x30, 0x77, 0x2D, 0xA0, 0x9E, 0x49, 0xD0, 0x9E, 0x5E, 0x0E, 0x6D, 0x9E, 0x6A, 0xFC,
+    0x96, 0xFC, 0x96, 0x9F, 0xA7, 0xAF, 0x70, 0xFC, 0xA6, 0x9F, 0xDA, 0x5E, 0x0F, 0x94, 0xE0, 0xAF,
+    0x92, 0xAD, 0x91, 0xFC, 0x20, 0x72, 0xE7, 0x4A, 0xD9, 0x73, 0x9D, 0xA7, 0x4E, 0x74, 0xEA, 0x77,
+    0x77, 0x75, 0x9E, 0xA7, 0x3F, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAE, 0x97, 0x3F, 0x73, 0x9F, 0x73,
+    0xAE, 0xA7, 0x3F, 0x97, 0x29, 0xF7, 0x3A, 0xEA, 0x73, 0xF9, 0x72, 0x9F, 0x73, 0xAF, 0x73, 0xFA,
+    0x72, 0x9F, 0x73, 0xAF, 0xAF, 0xF9, 0x1F, 0xFF, 0xD1, 0x9F, 0xFF, 0xD1, 0xAF, 0xFF, 0xCA, 0x1F,
+    0xFF, 0xD9, 0x00, 0x77, 0x73, 0xAD, 0x73, 0x9D, 0x97, 0x3E, 0x73, 0xE9, 0x72, 0xAD, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x19, 0xCA, 0xA7, 0x3E, 0xA7, 0x3E, 0x97, 0x2A, 0xE7, 0x3E, 0xA7, 0x3E,
+    0x97, 0x2A, 0xE7, 0x3E, 0xA7, 0x3E, 0x97, 0x29, 0xE7, 0x3F, 0x73, 0xEA, 0x72, 0x9E, 0x73, 0xAE,
+    0x73, 0xEA, 0x72, 0x9E, 0x97, 0x2A, 0xE7, 0x3F, 0x73, 0xEA, 0x99, 0x70, 0x9F, 0xD9, 0x7A, 0xFD,
+    0x70, 0xFE, 0x70, 0x69, 0xEA, 0x73, 0xF9, 0x73, 0xF7, 0x39, 0xF7, 0x3A, 0xE9, 0x73, 0xF7, 0x39,
+    0xF7, 0x3A, 0xEA, 0x73, 0xF9, 0x72, 0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0x97, 0x29, 0xF7, 0x3A, 0xF7,
+    0x3F, 0xA7, 0x29, 0xF7, 0x3A, 0xFA, 0xFF, 0x91, 0xFF, 0xFD, 0x19, 0xFF, 0xFD, 0x1A, 0xFF, 0xFC,
+    0xA1, 0xFF, 0xFD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xFC, 0x72, 0xFC, 0xA7, 0x2F, 0xC7, 0x29,
+    0xFA, 0x72, 0xFC, 0x72, 0xAF, 0x97, 0x2F, 0xC7, 0x2F, 0xC9, 0x72, 0xAA, 0xAA, 0xA7, 0x20, 0x71,
+    0x9C, 0xAA, 0x72, 0xEA, 0x72, 0xE9, 0x71, 0xAE, 0x72, 0xEA, 0x72, 0xE9, 0x71, 0xAE, 0x72, 0xEA,
+    0x72, 0xE9, 0x71, 0x9E, 0x72, 0xF7, 0x2E, 0xA7, 0x19, 0xE7, 0x2A, 0xE7, 0x2E, 0xA7, 0x19, 0xE9,
+    0x71, 0xAE, 0x72, 0xF7, 0x2E, 0xA9, 0x97, 0x9F, 0xD9, 0x6A, 0xFD, 0x7F, 0xE7, 0x77, 0x77, 0x77,
+    0x77, 0x72, 0xAA, 0xAA, 0xAA, 0x70, 0xFC, 0xA7, 0x9F, 0xC7, 0x0A, 0xFA, 0x70, 0xFC, 0x70, 0xAF,
+    0x97, 0x9F, 0xC7, 0x0F, 0xC9, 0x7A, 0xFC, 0x70, 0x69, 0xEA, 0x75, 0xF9, 0x75, 0xF7, 0x59, 0xF7,
+    0x5A, 0xE9, 0x3E, 0x6F, 0x39, 0xE5, 0x9F, 0x3E, 0xA5, 0xAE, 0xA2, 0x9E, 0x95, 0xF9, 0x2A, 0xE5,
+    0x9F, 0x3E, 0xA5, 0xAE, 0xA2, 0x9A, 0xAA, 0x95, 0xF9, 0x74, 0x9F, 0x75, 0xAF, 0x75, 0xFA, 0x74,
+    0x9F, 0x75, 0xAF, 0xAF, 0xF9, 0x3F, 0xFF, 0xD3, 0x9F, 0xFF, 0xD3, 0xAF, 0xFF, 0xCA, 0x3F, 0xFF,
+    0xD9, 0x20, 0x76, 0xAA, 0xA9, 0x76, 0xE7, 0x6A, 0xE7, 0x6E, 0x97, 0x9C, 0xAA, 0x19, 0xE7, 0x0E,
+    0xA1, 0xF7, 0x0E, 0x91, 0xEA, 0x7A, 0xE7, 0x6E, 0xA7, 0x6E, 0x97, 0x5A, 0xE7, 0x6E, 0xA7, 0x6E,
+    0x97, 0x59, 0xE7, 0x6F, 0x76, 0xEA, 0x75, 0x9E, 0x76, 0xAE, 0x76, 0xEA, 0x75, 0x9E, 0x97, 0x5A,
+    0xE7, 0x6F, 0x76, 0xEA, 0x99, 0x73, 0x9F, 0xD9, 0x72, 0xAF, 0xD7, 0x3F, 0xE7, 0x20, 0x69, 0xEA,
+    0x75, 0xF9, 0x75, 0xF7, 0x59, 0xF3, 0xF5, 0xAE, 0x92, 0x9F, 0x5F, 0x3F, 0xA4, 0x9F, 0x29, 0xF9,
+    0x4A, 0xEA, 0x2F, 0xC9, 0x4F, 0x92, 0x99, 0x99, 0x94, 0x9F, 0x75, 0xAE, 0xA7, 0x5F, 0x97, 0x49,
+    0xF7, 0x5A, 0xF7, 0x5F, 0xA7, 0x49, 0xF7, 0x5A, 0xFA, 0xFF, 0x93, 0xFF, 0xFD, 0x39, 0xFF, 0xFD,
+    0x3A, 0xFF, 0xFC, 0xA3, 0xFF, 0xFD, 0x92, 0x69, 0xDA, 0x73, 0xEA, 0x73, 0xE9, 0x72, 0xAE, 0x73,
+    0xEA, 0x73, 0xE9, 0x09, 0xE9, 0x4A, 0xE1, 0xF9, 0x4E, 0xA0, 0x9F, 0x5E, 0x90, 0xFC, 0x4A, 0xE0,
+    0x9F, 0xC4, 0xF0, 0x99, 0x99, 0x99, 0x4E, 0x97, 0x29, 0xE7, 0x3A, 0xE7, 0x3E, 0xA7, 0x29, 0xE9,
+    0x72, 0xAE, 0x73, 0xF7, 0x3E, 0xA9, 0x97, 0x09, 0xFD, 0x97, 0xAF, 0xD7, 0x0F, 0xE7, 0x77, 0x77,
+    0x77, 0x77, 0x6A, 0xE7, 0x77, 0x70, 0xF7, 0x77, 0x70, 0xF7, 0x77, 0x70, 0xF7, 0x77, 0x70, 0xF7,
+    0x77, 0x70, 0xF9, 0x77, 0x70, 0x9E, 0xA1, 0xF9, 0x77, 0x71, 0xF9, 0x0F, 0x97, 0x77, 0x2F, 0x0F,
+    0x97, 0x77, 0x29, 0xFF, 0x97, 0x77, 0x3A, 0xFE, 0x97, 0x77, 0x4F, 0xEA, 0x77, 0x74, 0x9F, 0xDA,
+    0x77, 0x75, 0xAF, 0xCA, 0x77, 0x76, 0xFC, 0xA7, 0x77, 0x69, 0xFA, 0x77, 0x77, 0xFC, 0x77, 0x77,
+    0xFC, 0x97, 0x77, 0x59, 0xFD, 0x77, 0x76, 0xFE, 0x77, 0x75, 0xFE, 0xA7, 0x77, 0x4F, 0xF7, 0x77,
+    0x4F, 0xFC, 0xAF, 0xF9, 0x77, 0x1F, 0xFF, 0xFE, 0x77, 0x1F, 0xC9, 0xFF, 0xFD, 0x77, 0x0F, 0xC0,
+    0xAF, 0xFF, 0xCA, 0x77, 0xFC, 0x1F, 0xFF, 0xD9, 0x76, 0xAF, 0x77, 0x77, 0xAF, 0x97, 0x77, 0x6A,
+    0xF9, 0x77, 0x76, 0xAF, 0x97, 0x77, 0x6A, 0xEA, 0x97, 0x77, 0x6A, 0xCA, 0x77, 0x77, 0x77, 0x77,
+    0x70, 0x77, 0x09, 0xCA, 0xA7, 0x76, 0xEA, 0x77, 0x6E, 0x97, 0x75, 0xAE, 0x77, 0x6E, 0xA7, 0x76,
+    0xE9, 0x77, 0x5A, 0xE7, 0x76, 0xEA, 0x77, 0x6E, 0x97, 0x75, 0x9E, 0x77, 0x6F, 0x77, 0x6E, 0xA7,
+    0x75, 0x9E, 0x90, 0x9A, 0xAD, 0xA7, 0x59, 0xFF, 0xDA, 0xA9, 0x49, 0x9A, 0xAF, 0xFC, 0xAA, 0x97,
+    0x0A, 0xFF, 0xAA, 0xE9, 0x76, 0x99, 0x93, 0xAE, 0x77, 0x6F, 0x77, 0x6E, 0xA9, 0x97, 0x73, 0x9F,
+    0xD9, 0x77, 0x2A, 0xFD, 0x77, 0x3F, 0xE7, 0x00, 0x77, 0x1A, 0xD7, 0x74, 0x9D, 0x97, 0x74, 0xE7,
+    0x74, 0xE9, 0x77, 0x3A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xF7, 0x0F, 0xA6,
+    0xF7, 0xAF, 0xA5, 0x9E, 0xA7, 0xFD, 0x5F, 0x79, 0xFD, 0x5F, 0x7A, 0xFD, 0x93, 0xAE, 0xA7, 0xFE,
+    0xA3, 0xF7, 0x9F, 0xF3, 0xF7, 0xAF, 0xF2, 0xAE, 0xA7, 0xFA, 0xF2, 0xF9, 0x69, 0xF9, 0xAE, 0x90,
+    0x9F, 0x7F, 0xC0, 0xAE, 0xA0, 0xAE, 0xA7, 0xFC, 0x09, 0xF0, 0xF9, 0x69, 0xFC, 0x09, 0xF9, 0xF7,
+    0xFC, 0xA1, 0xFF, 0xA7, 0xFC, 0x91, 0xFF, 0x96, 0xAF, 0xC2, 0xFF, 0x7F, 0xD2, 0xAF, 0xDA, 0x69,
+    0xFC, 0xA2, 0x9F, 0xD9, 0x6A, 0xFC, 0x92, 0x9F, 0xD7, 0xFD, 0x4F, 0xCA, 0x60, 0x76, 0xDA, 0x76,
+    0xAD, 0x76, 0xAD, 0xA7, 0x59, 0xE7, 0x6E, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9D, 0xA9,
+    0xAE, 0xA7, 0x0A, 0xFF, 0xD7, 0xFF, 0xE9, 0x59, 0xFC, 0x90, 0x9E, 0xA5, 0xAE, 0xA3, 0x9D, 0xA5,
+    0xF4, 0xAD, 0xA4, 0x9E, 0x94, 0xEA, 0x4A, 0xE4, 0x9E, 0x94, 0xF4, 0xAE, 0x49, 0xEA, 0x4F, 0x4A,
+    0xEA, 0x39, 0xF4, 0xF9, 0x3A, 0xEA, 0x39, 0xF4, 0xF9, 0x3A, 0xF3, 0x9F, 0x93, 0xFC, 0x3A, 0xF3,
+    0x77, 0x3F, 0x70, 0xFA, 0x6F, 0x7A, 0xFA, 0x59, 0xEA, 0x7F, 0xD5, 0xF7, 0x9F, 0xD5, 0xF7, 0xAF,
+    0xD9, 0x3A, 0xEA, 0x7F, 0xEA, 0x3F, 0x79, 0xFF, 0x3F, 0x7A, 0xFF, 0x2A, 0xEA, 0x7F, 0xAF, 0x2F,
+    0x96, 0x9F, 0x9A, 0xE9, 0x09, 0xF7, 0xFC, 0x0A, 0xEA, 0x0A, 0xEA, 0x7F, 0xC0, 0x9F, 0x0F, 0x96,
+    0x9F, 0xC0, 0x9F, 0x9F, 0x7F, 0xCA, 0x1F, 0xFA, 0x7F, 0xC9, 0x1F, 0xF9, 0x6A, 0xFC, 0x2F, 0xF7,
+    0xFD, 0x2A, 0xFD, 0xA6, 0x9F, 0xCA, 0x29, 0xFD, 0x96, 0xAF, 0xC9, 0x29, 0xFD, 0x7F, 0xD4, 0xFC,
+    0xA7, 0x77, 0x75, 0x9F, 0xC9, 0x77, 0x1A, 0xFC, 0x77, 0x2F, 0xC9, 0x77, 0x2F, 0xC7, 0x72, 0xAF,
+    0x97, 0x72, 0xFC, 0x77, 0x2F, 0xC9, 0x77, 0x1A, 0xFA, 0x77, 0x2A, 0xAA, 0xAA, 0x77, 0x00, 0x77,
+    0x69, 0xDA, 0x9A, 0xEA, 0x7A, 0xFF, 0xD6, 0xFF, 0xE9, 0x49, 0xFC, 0x90, 0x9E, 0xA4, 0xAE, 0xA3,
+    0x9D, 0xA4, 0xF4, 0xAD, 0xA3, 0x9E, 0x94, 0xEA, 0x3A, 0xE4, 0x9E, 0x93, 0xF4, 0xAE, 0x39, 0xEA,
+    0x4F, 0x3A, 0xEA, 0x39, 0xF3, 0xF9, 0x3A, 0xEA, 0x29, 0xF4, 0xF9, 0x2A, 0xF3, 0x9F, 0x92, 0xFC,
+    0x3A, 0xF7, 0x77, 0x1F, 0xD7, 0x29, 0xFC, 0x97, 0x2A, 0xFA, 0x73, 0xFC, 0x73, 0x9F, 0xA7, 0x3F,
+    0xC7, 0x3A, 0xFA, 0x72, 0x9F, 0xC7, 0x39, 0xAA, 0xAA, 0x97, 0x20, 0x74, 0x99, 0x95, 0x99, 0x97,
+    0x5A, 0xE2, 0x9E, 0xA7, 0x6F, 0x9A, 0xE9, 0x77, 0x0F, 0xE7, 0x72, 0x9F, 0xA7, 0x74, 0xEA, 0x77,
+    0x59, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2F, 0x71, 0xFA, 0x6F, 0x70, 0xAF,
+    0xA5, 0x9E, 0xA7, 0x0F, 0xD5, 0xF7, 0x09, 0xFD, 0x5F, 0x70, 0xAF, 0xD9, 0x3A, 0xEA, 0x70, 0xFE,
+    0xA3, 0xF7, 0x09, 0xFF, 0x3F, 0x70, 0xAF, 0xF2, 0xAE, 0xA7, 0x0F, 0xAF, 0x2F, 0x97, 0x9F, 0x9A,
+    0xE9, 0x09, 0xF7, 0x0F, 0xC0, 0xAE, 0xA0, 0xAE, 0xA7, 0x0F, 0xC0, 0x9F, 0x0F, 0x97, 0x9F, 0xC0,
+    0x9F, 0x9F, 0x70, 0xFC, 0xA1, 0xFF, 0xA7, 0x0F, 0xC9, 0x1F, 0xF9, 0x7A, 0xFC, 0x2F, 0xF7, 0x0F,
+    0xD2, 0xAF, 0xDA, 0x79, 0xFC, 0xA2, 0x9F, 0xD9, 0x7A, 0xFC, 0x92, 0x9F, 0xD7, 0x0F, 0xD4, 0xFC,
+    0xA7, 0x70, 0x9A, 0xAA, 0x5A, 0xAA, 0x72, 0xF2, 0xAE, 0x74, 0xFA, 0xEA, 0x75, 0x9F, 0xD9, 0x77,
+    0xAF, 0x77, 0x2E, 0x77, 0x39, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9D, 0xA9,
+    0xAE, 0xA7, 0x4A, 0xFF, 0xD7, 0x3F, 0xFE, 0x97, 0x19, 0xFC, 0x90, 0x9E, 0xA7, 0x1A, 0xEA, 0x39,
+    0xDA, 0x71, 0xF4, 0xAD, 0xA7, 0x09, 0xE9, 0x4E, 0xA7, 0x0A, 0xE4, 0x9E, 0x97, 0x0F, 0x4A, 0xE7,
+    0x09, 0xEA, 0x4F, 0x70, 0xAE, 0xA3, 0x9F, 0x70, 0xF9, 0x3A, 0xEA, 0x79, 0xF4, 0xF9, 0x7A, 0xF3,
+    0x9F, 0x97, 0xFC, 0x3A, 0xF7, 0x4A, 0xAA, 0xA7, 0x77, 0x3F, 0x97, 0x77, 0x2A, 0xF7, 0x77, 0x29,
+    0xF7, 0x77, 0x3F, 0xA7, 0x77, 0x2F, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x73, 0x9D, 0xA9, 0xAE, 0xA7, 0x76, 0xAF, 0xFD, 0x77, 0x5F, 0xFE, 0x97, 0x73,
+    0x9F, 0xC9, 0x09, 0xEA, 0x77, 0x3A, 0xEA, 0x39, 0xDA, 0x77, 0x3F, 0x4A, 0xDA, 0x77, 0x29, 0xE9,
+    0x4E, 0xA7, 0x72, 0xAE, 0x49, 0xE9, 0x77, 0x2F, 0x4A, 0xE7, 0x72, 0x9E, 0xA4, 0xF7, 0x72, 0xAE,
+    0xA3, 0x9F, 0x77, 0x2F, 0x93, 0xAE, 0xA7, 0x71, 0x9F, 0x4F, 0x97, 0x71, 0xAF, 0x39, 0xF9, 0x77,
+    0x1F, 0xC3, 0xAF, 0x20, 0x77, 0x3F, 0x70, 0xFA, 0x6F, 0x7A, 0xFA, 0x59, 0xEA, 0x7F, 0xD5, 0xF7,
+    0x9F, 0xD5, 0xF7, 0xAF, 0xD9, 0x3A, 0xEA, 0x7F, 0xEA, 0x3F, 0x79, 0xFF, 0x3F, 0x7A, 0xFF, 0x2A,
+    0xEA, 0x7F, 0xAF, 0x2F, 0x96, 0x9F, 0x9A, 0xE9, 0x09, 0xF7, 0xFC, 0x0A, 0xEA, 0x0A, 0xEA, 0x7F,
+    0xC0, 0x9F, 0x0F, 0x96, 0x9F, 0xC0, 0x9F, 0x9F, 0x7F, 0xCA, 0x1F, 0xFA, 0x7F, 0xC9, 0x1F, 0xF9,
+    0x6A, 0xFC, 0x2F, 0xF7, 0xFD, 0x2A, 0xFD, 0xA6, 0x9F, 0xCA, 0x29, 0xFD, 0x96, 0xAF, 0xC9, 0x29,
+    0xFD, 0x7F, 0xD4, 0xFC, 0xA7, 0x71, 0x9F, 0xC9, 0x76, 0x99, 0x9F, 0xD7, 0x69, 0xFF, 0xA7, 0x6F,
+    0xFC, 0x77, 0xFE, 0xA7, 0x77, 0x72, 0x77, 0x69, 0xDA, 0x9A, 0xEA, 0x7A, 0xFF, 0xD6, 0xFF, 0xE9,
+    0x49, 0xFC, 0x90, 0x9E, 0xA4, 0xAE, 0xA3, 0x9D, 0xA4, 0xF4, 0xAD, 0xA3, 0x9E, 0x94, 0xEA, 0x3A,
+    0xE4, 0x9E, 0x93, 0xF4, 0xAE, 0x39, 0xEA, 0x4F, 0x3A, 0xEA, 0x39, 0xF3, 0xF9, 0x3A, 0xEA, 0x29,
+    0xF4, 0xF9, 0x2A, 0xF3, 0x9F, 0x92, 0xFC, 0x3A, 0xF7, 0x4F, 0xC7, 0x1F, 0xE9, 0x70, 0x9F, 0xE7,
+    0x1F, 0xE7, 0x39, 0x99, 0x70, 0x74, 0x99, 0x9A, 0xAA, 0xAE, 0x97, 0x4F, 0xFE, 0x97, 0x3A, 0xFF,
+    0xEA, 0x72, 0x9C, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70,
+    0x9A, 0xFC, 0xA7, 0x69, 0xFF, 0xD9, 0x73, 0xAF, 0xFF, 0xA7, 0x1F, 0xDA, 0xA9, 0xAF, 0xC9, 0x7F,
+    0xCA, 0x49, 0xFA, 0x6A, 0xFA, 0x6A, 0xF5, 0x9F, 0xA7, 0x9F, 0x94, 0xFC, 0x71, 0xF9, 0x39, 0xF9,
+    0x71, 0xF9, 0x3A, 0xF7, 0x2F, 0x93, 0xFA, 0x71, 0x9F, 0x39, 0xF7, 0x29, 0xF3, 0xAF, 0x72, 0xFA,
+    0x3A, 0xF7, 0x2F, 0x93, 0xFA, 0x71, 0xFC, 0x4F, 0xC7, 0x0A, 0xFA, 0x4F, 0xDA, 0x91, 0x99, 0xAF,
+    0xD9, 0x4F, 0xFF, 0xFE, 0x5F, 0xFF, 0xFD, 0x95, 0xAF, 0xFF, 0xFA, 0x7F, 0xFF, 0xEA, 0x71, 0xFF,
+    0xFC, 0x97, 0x39, 0xAF, 0xEA, 0x97, 0x77, 0x71, 0x77, 0x72, 0x99, 0xAA, 0xAA, 0xF9, 0x6F, 0xFE,
+    0xA5, 0xAF, 0xFE, 0xA5, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39,
+    0xAE, 0xA9, 0x72, 0xFF, 0xA7, 0x9F, 0xFD, 0x96, 0xFA, 0x19, 0xF5, 0xF9, 0x3A, 0xE5, 0xEA, 0x4A,
+    0xE4, 0xAE, 0x5A, 0xE4, 0xEA, 0x5F, 0x4E, 0xA4, 0x9E, 0xA3, 0x9E, 0x94, 0xF4, 0x9F, 0x29, 0xFC,
+    0x49, 0xFF, 0xF9, 0x5F, 0xFE, 0xA6, 0xFF, 0xE7, 0x0F, 0xFA, 0x72, 0xAF, 0xA7, 0x00, 0x77, 0x77,
+    0x5E, 0x39, 0xE7, 0x49, 0xFF, 0xDA, 0x75, 0xFF, 0xD7, 0x69, 0xFE, 0xA7, 0x71, 0x9A, 0xAA, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0xAF, 0xCA, 0x76, 0x9F, 0xFD, 0x97, 0x3A, 0xFF, 0xFA, 0x71,
+    0xFD, 0xAA, 0x9A, 0xFC, 0x97, 0xFC, 0xA4, 0x9F, 0xA6, 0xAF, 0xA6, 0xAF, 0x59, 0xFA, 0x79, 0xF9,
+    0x4F, 0xC7, 0x1F, 0x93, 0x9F, 0x97, 0x1F, 0x93, 0xAF, 0x72, 0xF9, 0x3F, 0xA7, 0x19, 0xF3, 0x9F,
+    0x72, 0x9F, 0x3A, 0xF7, 0x2F, 0xA3, 0xAF, 0x72, 0xF9, 0x3F, 0xA7, 0x1F, 0xC4, 0xFC, 0x70, 0xAF,
+    0xA4, 0xFD, 0xA9, 0x19, 0x9A, 0xFD, 0x94, 0xFF, 0xFF, 0xE5, 0xFF, 0xFF, 0xD9, 0x5A, 0xFF, 0xFF,
+    0xA7, 0xFF, 0xFE, 0xA7, 0x1F, 0xFF, 0xC9, 0x73, 0x9A, 0xFE, 0xA9, 0x77, 0x77, 0x10, 0x77, 0x73,
+    0xE3, 0x9E, 0x70, 0xFF, 0xDA, 0x70, 0xFF, 0xD7, 0x19, 0xFF, 0x74, 0x9A, 0xAA, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x9A, 0xEA, 0x97, 0x3F, 0xFA, 0x70, 0x9F, 0xFD, 0x97, 0xFA, 0x19, 0xF6, 0xF9, 0x3A,
+    0xE6, 0xEA, 0x4A, 0xE5, 0xAE, 0x5A, 0xE5, 0xEA, 0x5F, 0x5E, 0xA4, 0x9E, 0xA4, 0x9E, 0x94, 0xF5,
+    0x9F, 0x29, 0xFC, 0x59, 0xFF, 0xF9, 0x6F, 0xFE, 0xA7, 0xFF, 0xE7, 0x1F, 0xFA, 0x73, 0xAF, 0xA7,
+    0x10, 0x74, 0x99, 0x97, 0x99, 0x97, 0x39, 0xEA, 0x59, 0xF7, 0x29, 0xF5, 0x9F, 0x72, 0x9F, 0x59,
+    0xF9, 0x71, 0xAF, 0x94, 0x9F, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xFC, 0xA7, 0x71,
+    0x9F, 0xFD, 0x97, 0x6A, 0xFF, 0xFA, 0x74, 0xFD, 0xAA, 0x9A, 0xFC, 0x97, 0x2F, 0xCA, 0x49, 0xFA,
+    0x71, 0xAF, 0xA6, 0xAF, 0x70, 0x9F, 0xA7, 0x9F, 0x97, 0xFC, 0x71, 0xF9, 0x69, 0xF9, 0x71, 0xF9,
+    0x6A, 0xF7, 0x2F, 0x96, 0xFA, 0x71, 0x9F, 0x69, 0xF7, 0x29, 0xF6, 0xAF, 0x72, 0xFA, 0x6A, 0xF7,
+    0x2F, 0x96, 0xFA, 0x71, 0xFC, 0x7F, 0xC7, 0x0A, 0xFA, 0x7F, 0xDA, 0x91, 0x99, 0xAF, 0xD9, 0x7F,
+    0xFF, 0xFE, 0x70, 0xFF, 0xFF, 0xD9, 0x70, 0xAF, 0xFF, 0xFA, 0x72, 0xFF, 0xFE, 0xA7, 0x4F, 0xFF,
+    0xC9, 0x76, 0x9A, 0xFE, 0xA9, 0x77, 0x77, 0x70, 0x79, 0x99, 0x79, 0x99, 0x69, 0xF6, 0xF5, 0x9F,
+    0x59, 0xF5, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x69, 0xAE,
+    0xA9, 0x76, 0xFF, 0xA7, 0x39, 0xFF, 0xD9, 0x72, 0xFA, 0x19, 0xF7, 0x1F, 0x93, 0xAE, 0x71, 0xEA,
+    0x4A, 0xE7, 0x0A, 0xE5, 0xAE, 0x70, 0xEA, 0x5F, 0x70, 0xEA, 0x49, 0xEA, 0x79, 0xE9, 0x4F, 0x70,
+    0x9F, 0x29, 0xFC, 0x70, 0x9F, 0xFF, 0x97, 0x1F, 0xFE, 0xA7, 0x2F, 0xFE, 0x74, 0xFF, 0xA7, 0x6A,
+    0xFA, 0x74, 0x72, 0x9A, 0xFC, 0xA1, 0x99, 0x99, 0x99, 0x9A, 0xAA, 0xAA, 0xA7, 0x19, 0xFF, 0xFF,
+    0xFE, 0x97, 0x0A, 0xFF, 0xFF, 0xFF, 0x70, 0xFD, 0xAA, 0x9A, 0xFF, 0xFE, 0x70, 0xFC, 0xA4, 0x9F,
+    0xC9, 0x77, 0xAF, 0xA6, 0xAF, 0x77, 0x9F, 0xA7, 0xAF, 0x97, 0x6F, 0xC7, 0x0F, 0xC9, 0x75, 0x9F,
+    0x97, 0x0F, 0xC9, 0x75, 0xAF, 0x70, 0x9F, 0xDA, 0xAD, 0x97, 0x0F, 0xA7, 0x0A, 0xFF, 0xD9, 0x79,
+    0xF7, 0x1F, 0xFE, 0x70, 0xAF, 0x71, 0xFF, 0xDA, 0x70, 0xAE, 0xA7, 0x09, 0xFC, 0x97, 0x5F, 0xC7,
+    0x0F, 0xD7, 0x6F, 0xC9, 0x7F, 0xD7, 0x6F, 0xEA, 0x99, 0xAA, 0xFE, 0x97, 0x6F, 0xFF, 0xFE, 0xAA,
+    0xAA, 0xAA, 0xA9, 0x7F, 0xFF, 0xFF, 0xFE, 0x7A, 0xFF, 0xFF, 0xFF, 0xD7, 0x0F, 0xFF, 0xFF, 0xFD,
+    0x71, 0xFF, 0xFF, 0xFF, 0xA7, 0x29, 0xAF, 0xFF, 0xFF, 0xCA, 0x77, 0x77, 0x70, 0x69, 0xAE, 0xA9,
+    0x3A, 0xEA, 0x97, 0x0F, 0xFC, 0x0A, 0xFE, 0xA5, 0x9F, 0xFF, 0xEA, 0xAE, 0x94, 0xFA, 0x19, 0xFD,
+    0xA3, 0xDA, 0x3F, 0x93, 0xAF, 0x91, 0x99, 0xAE, 0x3E, 0xA4, 0xAF, 0xFF, 0xC2, 0xAE, 0x5A, 0xFF,
+    0xFC, 0x2E, 0xA5, 0xFF, 0xFD, 0x2E, 0xA4, 0x9F, 0xCA, 0xAA, 0x99, 0x99, 0x39, 0xE9, 0x4F, 0x97,
+    0x39, 0xF2, 0x9F, 0xCA, 0x79, 0x29, 0xFF, 0xFE, 0x99, 0x19, 0xAC, 0xA3, 0xFF, 0xFF, 0xFD, 0x93,
+    0xFF, 0xFF, 0xFD, 0x94, 0xFF, 0xA0, 0xAF, 0xFD, 0x6A, 0xFA, 0x39, 0xAF, 0xCA, 0x93, 0x77, 0x77,
+    0x2D, 0xA7, 0x7E, 0x77, 0xAD, 0x97, 0x69, 0xE7, 0x7E, 0x97, 0x77, 0x77, 0x73, 0xFE, 0xA9, 0x71,
+    0xAF, 0xFD, 0x70, 0xFF, 0xEA, 0x7E, 0x49, 0xE6, 0xAE, 0x49, 0xE6, 0xEA, 0x4A, 0xE6, 0xE9, 0x4E,
+    0xA5, 0xAE, 0x49, 0xE9, 0x5F, 0x3A, 0xF6, 0xFF, 0xF9, 0x5A, 0xFF, 0xE9, 0x6F, 0xFE, 0x97, 0xFF,
+    0xF6, 0xAF, 0xC9, 0x1F, 0x6F, 0xC3, 0xF9, 0x5F, 0xC3, 0xFA, 0x4A, 0xFA, 0x3F, 0xA4, 0xFC, 0x92,
+    0xAF, 0xA3, 0x9F, 0xC9, 0x2F, 0xD3, 0xAF, 0xC3, 0xFD, 0x3F, 0xD2, 0x9F, 0xD7, 0x76, 0x77, 0x70,
+    0xAD, 0x72, 0x9D, 0x97, 0x2E, 0x72, 0xE7, 0x2A, 0xDA, 0x77, 0x70, 0xEA, 0x9E, 0x94, 0x9F, 0xF9,
+    0x4A, 0xFF, 0x94, 0xFD, 0xAA, 0xA9, 0x4F, 0xA7, 0x09, 0xF7, 0x1A, 0xE7, 0x2F, 0x71, 0x9E, 0xA7,
+    0x1A, 0xE9, 0x71, 0xF9, 0x70, 0x9F, 0x71, 0xFC, 0x71, 0xFC, 0x70, 0xAF, 0xC7, 0x0A, 0xAA, 0xDA,
+    0x70, 0x77, 0x77, 0x0F, 0xD7, 0x5F, 0xC9, 0x74, 0x9F, 0xC7, 0x5A, 0xF9, 0x75, 0xFC, 0x75, 0xFC,
+    0x97, 0x49, 0xFA, 0x75, 0xFC, 0x76, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x71, 0xFE, 0xA9, 0x71,
+    0xAF, 0xFD, 0x70, 0xFF, 0xEA, 0x7E, 0x49, 0xE6, 0xAE, 0x49, 0xE6, 0xEA, 0x4A, 0xE6, 0xE9, 0x4E,
+    0xA5, 0xAE, 0x49, 0xE9, 0x5F, 0x3A, 0xF6, 0xFF, 0xF9, 0x5A, 0xFF, 0xE9, 0x6F, 0xFE, 0x97, 0xFF,
+    0xF6, 0xAF, 0xC9, 0x1F, 0x6F, 0xC3, 0xF9, 0x5F, 0xC3, 0xFA, 0x4A, 0xFA, 0x3F, 0xA4, 0xFC, 0x92,
+    0xAF, 0xA3, 0x9F, 0xC9, 0x2F, 0xD3, 0xAF, 0xC3, 0xFD, 0x3F, 0xD2, 0x9F, 0xD7, 0x76, 0x77, 0x69,
+    0xFC, 0xA7, 0xAF, 0xC7, 0x0F, 0xC9, 0x70, 0xFC, 0x70, 0xAF, 0x97, 0x9F, 0xA7, 0x0F, 0xC7, 0x0A,
+    0xFA, 0x70, 0x99, 0x99, 0x97, 0x77, 0x77, 0x0E, 0xA9, 0xE9, 0x49, 0xFF, 0x94, 0xAF, 0xF9, 0x4F,
+    0xDA, 0xAA, 0x94, 0xFA, 0x70, 0x9F, 0x71, 0xAE, 0x72, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x97, 0x1F,
+    0x97, 0x09, 0xF7, 0x1F, 0xC7, 0x1F, 0xC7, 0x0A, 0xFC, 0x70, 0xAA, 0xAD, 0xA7, 0x70, 0x9A, 0xA9,
+    0x5A, 0xAA, 0x72, 0xEA, 0x29, 0xE9, 0x73, 0xF9, 0xF7, 0x59, 0xFD, 0xA7, 0x7A, 0xF9, 0x77, 0x1E,
+    0x97, 0x72, 0x9A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x73, 0xFE, 0xA9, 0x74, 0xAF, 0xFD, 0x73, 0xFF,
+    0xEA, 0x72, 0xE4, 0x9E, 0x71, 0xAE, 0x49, 0xE7, 0x1E, 0xA4, 0xAE, 0x71, 0xE9, 0x4E, 0xA7, 0x0A,
+    0xE4, 0x9E, 0x97, 0x0F, 0x3A, 0xF7, 0x1F, 0xFF, 0x97, 0x0A, 0xFF, 0xE9, 0x71, 0xFF, 0xE9, 0x72,
+    0xFF, 0xF7, 0x1A, 0xFC, 0x91, 0xF7, 0x1F, 0xC3, 0xF9, 0x70, 0xFC, 0x3F, 0xA7, 0xAF, 0xA3, 0xFA,
+    0x7F, 0xC9, 0x2A, 0xFA, 0x69, 0xFC, 0x92, 0xFD, 0x6A, 0xFC, 0x3F, 0xD6, 0xFD, 0x29, 0xFD, 0x77,
+    0x74, 0x49, 0x99, 0x69, 0x95, 0xAE, 0x3A, 0xDA, 0x6F, 0x9A, 0xEA, 0x70, 0xFE, 0x97, 0x19, 0xFC,
+    0x74, 0xF7, 0x59, 0xD7, 0x77, 0x77, 0x70, 0xEA, 0x9E, 0x97, 0x9F, 0xF9, 0x7A, 0xFF, 0x97, 0xFD,
+    0xAA, 0xA9, 0x7F, 0xA7, 0x39, 0xF7, 0x4A, 0xE7, 0x5F, 0x74, 0x9E, 0xA7, 0x4A, 0xE9, 0x74, 0xF9,
+    0x73, 0x9F, 0x74, 0xFC, 0x74, 0xFC, 0x73, 0xAF, 0xC7, 0x3A, 0xAA, 0xDA, 0x72, 0x77, 0x77, 0x4E,
+    0x77, 0x0A, 0xD9, 0x77, 0x9E, 0x77, 0x0E, 0x77, 0x0E, 0xA7, 0x77, 0x77, 0x77, 0x0A, 0xAF, 0xCA,
+    0x97, 0x1A, 0xFF, 0xD9, 0x7F, 0xFE, 0xA7, 0xFE, 0xAA, 0xE7, 0x9F, 0xA7, 0x6F, 0xA7, 0x69, 0xF7,
+    0x79, 0xF7, 0x7A, 0xFC, 0x97, 0x59, 0xFF, 0xA7, 0x3F, 0xFE, 0x72, 0xFF, 0xE9, 0x71, 0x9F, 0xFD,
+    0x74, 0x9A, 0xFD, 0xA7, 0x6F, 0xD7, 0x7F, 0xC4, 0xD9, 0x6A, 0xFA, 0x3F, 0xCA, 0x91, 0x9F, 0xD9,
+    0x2F, 0xFF, 0xFA, 0x2F, 0xFF, 0xFA, 0x3A, 0xFF, 0xFD, 0x96, 0x9A, 0xFE, 0xA9, 0x60, 0x73, 0xAD,
+    0x73, 0x9D, 0x97, 0x3E, 0x73, 0xE9, 0x72, 0xAD, 0xA7, 0x77, 0x77, 0x1A, 0xFC, 0xA9, 0x59, 0xFF,
+    0xC5, 0xEA, 0x99, 0x9A, 0xC9, 0x49, 0xDA, 0x73, 0x9D, 0x97, 0x39, 0xE9, 0x73, 0xFD, 0xA7, 0x1F,
+    0xE9, 0x70, 0x9F, 0xD7, 0x3A, 0xEA, 0x72, 0xAF, 0x3D, 0x92, 0x9F, 0xA2, 0xFF, 0xF2, 0xFF, 0xFA,
+    0x19, 0xFF, 0xE9, 0x49, 0xAF, 0xCA, 0x97, 0x74, 0x74, 0xAD, 0x77, 0x3F, 0x77, 0x1A, 0xFC, 0x77,
+    0x9F, 0xE9, 0x75, 0xEA, 0x0A, 0xE9, 0x73, 0xEA, 0x3A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A,
+    0xAF, 0xCA, 0x97, 0x3A, 0xFF, 0xD9, 0x71, 0xFF, 0xEA, 0x71, 0xFE, 0xAA, 0xE7, 0x19, 0xFA, 0x77,
+    0x0F, 0xA7, 0x70, 0x9F, 0x77, 0x19, 0xF7, 0x71, 0xAF, 0xC9, 0x77, 0x9F, 0xFA, 0x75, 0xFF, 0xE7,
+    0x4F, 0xFE, 0x97, 0x39, 0xFF, 0xD7, 0x69, 0xAF, 0xDA, 0x77, 0x0F, 0xD7, 0x71, 0xFC, 0x6D, 0x96,
+    0xAF, 0xA5, 0xFC, 0xA9, 0x19, 0xFD, 0x94, 0xFF, 0xFF, 0xA4, 0xFF, 0xFF, 0xA5, 0xAF, 0xFF, 0xD9,
+    0x70, 0x9A, 0xFE, 0xA9, 0x70, 0x77, 0x73, 0xAD, 0x77, 0xF7, 0x5F, 0xD9, 0x72, 0xAF, 0xE9, 0x70,
+    0x9E, 0x90, 0x9E, 0xA7, 0xE9, 0x39, 0xE7, 0x77, 0x77, 0x5A, 0xFC, 0xA9, 0x70, 0x9F, 0xFC, 0x70,
+    0xEA, 0x99, 0x9A, 0xC9, 0x79, 0xDA, 0x76, 0x9D, 0x97, 0x69, 0xE9, 0x76, 0xFD, 0xA7, 0x4F, 0xE9,
+    0x73, 0x9F, 0xD7, 0x6A, 0xEA, 0x75, 0xAF, 0x6D, 0x92, 0x9F, 0xA5, 0xFF, 0xF5, 0xFF, 0xFA, 0x49,
+    0xFF, 0xE9, 0x79, 0xAF, 0xCA, 0x97, 0x77, 0x20, 0x72, 0xAA, 0xFC, 0xA9, 0x71, 0xAF, 0xFD, 0x97,
+    0xFF, 0xEA, 0x7F, 0xEA, 0xAE, 0x79, 0xFA, 0x76, 0xFA, 0x76, 0x9F, 0x77, 0x9F, 0x77, 0xAF, 0xC9,
+    0x75, 0x9F, 0xFA, 0x73, 0xFF, 0xE7, 0x2F, 0xFE, 0x97, 0x19, 0xFF, 0xD7, 0x49, 0xAF, 0xDA, 0x76,
+    0xFD, 0x77, 0xFC, 0x4D, 0x96, 0xAF, 0xA3, 0xFC, 0xA9, 0x19, 0xFD, 0x92, 0xFF, 0xFF, 0xA2, 0xFF,
+    0xFF, 0xA2, 0x9F, 0xFF, 0xE9, 0x59, 0xAF, 0xFA, 0x97, 0x29, 0xD9, 0x77, 0x0F, 0x97, 0x69, 0xA9,
+    0xDA, 0x76, 0xFC, 0x97, 0x6F, 0xA7, 0x7A, 0xA9, 0x76, 0x77, 0x6A, 0xFC, 0xA9, 0x59, 0xFF, 0xC5,
+    0xEA, 0x99, 0x9A, 0xC9, 0x49, 0xDA, 0x73, 0x9D, 0x97, 0x39, 0xE9, 0x73, 0xFD, 0xA7, 0x1F, 0xE9,
+    0x70, 0x9F, 0xD7, 0x3A, 0xEA, 0x72, 0xAF, 0x3D, 0x92, 0x9F, 0xA1, 0x9F, 0xFF, 0x19, 0xFF, 0xFA,
+    0x29, 0xAF, 0xFC, 0x95, 0xFD, 0xA9, 0x6A, 0xD7, 0x4E, 0xA7, 0x29, 0xF9, 0x71, 0x91, 0xD9, 0x71,
+    0xFC, 0x71, 0x9F, 0x97, 0x19, 0xAA, 0x97, 0x30, 0x72, 0x99, 0x95, 0x99, 0x97, 0x3A, 0xE3, 0xEA,
+    0x74, 0xF9, 0xAE, 0x97, 0x6F, 0xE7, 0x70, 0x9F, 0xC7, 0x72, 0xF7, 0x73, 0x9C, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x1A, 0xAF, 0xCA, 0x97, 0x4A, 0xFF, 0xD9, 0x72, 0xFF, 0xEA, 0x72, 0xFE, 0xAA,
+    0xE7, 0x29, 0xFA, 0x77, 0x1F, 0xA7, 0x71, 0x9F, 0x77, 0x29, 0xF7, 0x72, 0xAF, 0xC9, 0x77, 0x09,
+    0xFF, 0xA7, 0x6F, 0xFE, 0x75, 0xFF, 0xE9, 0x74, 0x9F, 0xFD, 0x77, 0x9A, 0xFD, 0xA7, 0x71, 0xFD,
+    0x77, 0x2F, 0xC7, 0xD9, 0x6A, 0xFA, 0x6F, 0xCA, 0x91, 0x9F, 0xD9, 0x5F, 0xFF, 0xFA, 0x5F, 0xFF,
+    0xFA, 0x6A, 0xFF, 0xFD, 0x97, 0x19, 0xAF, 0xEA, 0x97, 0x10, 0x6A, 0xAA, 0x5A, 0xAA, 0x96, 0x9E,
+    0x91, 0x9E, 0x97, 0x0A, 0xEA, 0xF7, 0x3F, 0xDA, 0x75, 0xFA, 0x76, 0xAD, 0xA7, 0x70, 0xA9, 0x77,
+    0x77, 0x77, 0x5A, 0xFC, 0xA9, 0x71, 0x9F, 0xFC, 0x71, 0xEA, 0x99, 0x9A, 0xC9, 0x70, 0x9D, 0xA7,
+    0x79, 0xD9, 0x77, 0x9E, 0x97, 0x7F, 0xDA, 0x75, 0xFE, 0x97, 0x49, 0xFD, 0x77, 0xAE, 0xA7, 0x6A,
+    0xF7, 0xD9, 0x29, 0xFA, 0x6F, 0xFF, 0x6F, 0xFF, 0xA5, 0x9F, 0xFE, 0x97, 0x09, 0xAF, 0xCA, 0x97,
+    0x77, 0x40, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xFC, 0xA0,
+    0xFF, 0xFF, 0xD9, 0x0F, 0xFF, 0xFD, 0x09, 0xFF, 0xFF, 0xD7, 0xAE, 0xA7, 0x6F, 0x97, 0x59, 0xF7,
+    0x6A, 0xF7, 0x6F, 0xA7, 0x6F, 0x97, 0x5A, 0xF7, 0x6F, 0xC7, 0x6F, 0xA7, 0x59, 0xF9, 0x75, 0xAF,
+    0x76, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x75, 0xAF, 0xC7, 0x69, 0xCA,
+    0x77, 0x0E, 0x77, 0xAF, 0x76, 0x90, 0x9D, 0x75, 0x9A, 0xAE, 0x75, 0xAF, 0x97, 0x5F, 0x97, 0x50,
+    0x77, 0x69, 0xA9, 0x70, 0x9E, 0x71, 0xF7, 0x1E, 0xA7, 0x09, 0xE6, 0x9F, 0xFD, 0x2F, 0xFE, 0x1F,
+    0xFF, 0x4F, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1E, 0xA7, 0x1E, 0x97, 0x0A, 0xE7, 0x1F,
+    0xF5, 0xFF, 0x49, 0xFF, 0x5F, 0xF4, 0xAC, 0xA7, 0x2E, 0xA7, 0x0A, 0xF9, 0x7A, 0xAA, 0xD9, 0x69,
+    0xFC, 0x7A, 0xEA, 0x70, 0x77, 0x72, 0xEA, 0x3A, 0xE7, 0x0F, 0x09, 0xEA, 0x71, 0x9F, 0xE9, 0x73,
+    0xAF, 0xC7, 0x6F, 0x77, 0xAD, 0x77, 0x77, 0x77, 0x77, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x90, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xD9, 0x0F, 0xFF, 0xFD, 0x09, 0xFF, 0xFF,
+    0xD7, 0xAE, 0xA7, 0x6F, 0x97, 0x59, 0xF7, 0x6A, 0xF7, 0x6F, 0xA7, 0x6F, 0x97, 0x5A, 0xF7, 0x6F,
+    0xC7, 0x6F, 0xA7, 0x59, 0xF9, 0x75, 0xAF, 0x76, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC,
+    0x76, 0xFC, 0x75, 0xAF, 0xC7, 0x30, 0x77, 0xAD, 0xA7, 0x7E, 0x97, 0x69, 0xE7, 0x7F, 0x70, 0x9A,
+    0x93, 0xE9, 0x69, 0xE3, 0xAE, 0x7F, 0x3A, 0xAA, 0xA7, 0xEA, 0x76, 0x9E, 0x74, 0x9F, 0xFD, 0x70,
+    0xFF, 0xE7, 0xFF, 0xF7, 0x2F, 0x77, 0xEA, 0x76, 0x9E, 0x97, 0x6A, 0xE7, 0x7E, 0xA7, 0x7E, 0x97,
+    0x6A, 0xE7, 0x7F, 0xF7, 0x3F, 0xF7, 0x3F, 0xF7, 0x3F, 0xF7, 0x10, 0x19, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xD9, 0x0F, 0xFF, 0xFD, 0x09,
+    0xFF, 0xFF, 0xD7, 0xFA, 0x76, 0xF9, 0x75, 0x9F, 0x76, 0xAF, 0x76, 0xFA, 0x71, 0xAF, 0xFF, 0x6F,
+    0xFF, 0xC6, 0xFF, 0xF9, 0x72, 0xFA, 0x75, 0x9F, 0x97, 0x5F, 0xC7, 0x6F, 0xC7, 0x59, 0xFA, 0x75,
+    0xAF, 0x97, 0x5F, 0xC7, 0x6F, 0xC7, 0x5A, 0xFC, 0x73, 0x77, 0x70, 0x9A, 0x97, 0x19, 0xE7, 0x2F,
+    0x72, 0xEA, 0x71, 0x9E, 0x79, 0xFF, 0xD3, 0xFF, 0xE2, 0xFF, 0xF5, 0xF5, 0xAF, 0xFF, 0x1F, 0xFF,
+    0xC1, 0xFF, 0xF9, 0x5E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x72, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF2,
+    0x75, 0x99, 0x77, 0x4F, 0x1D, 0x76, 0xAF, 0xA9, 0xD9, 0x75, 0xDA, 0x9F, 0xC7, 0x59, 0xD1, 0xF9,
+    0x76, 0xAA, 0x2A, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAF, 0xC5, 0x9F, 0xC5,
+    0xFC, 0xA5, 0xAF, 0xC5, 0xFC, 0x6F, 0xCA, 0x49, 0xFC, 0x6F, 0xC5, 0xAF, 0xA5, 0x9F, 0xC5, 0xFC,
+    0x95, 0xAF, 0xA5, 0xFC, 0x6F, 0xC6, 0xFA, 0x6F, 0xC5, 0x9F, 0x95, 0x9F, 0xA5, 0xAF, 0x6A, 0xF9,
+    0x5F, 0xA6, 0xFC, 0x6F, 0x96, 0xFA, 0x59, 0xF6, 0x9F, 0x95, 0xAF, 0x6F, 0xC6, 0xFC, 0x5A, 0xFA,
+    0x6F, 0xEA, 0xFF, 0x96, 0xFF, 0xFF, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xE7, 0x0A, 0xFF, 0xFC, 0x72,
+    0x9F, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x00, 0x79, 0xD9, 0x1D, 0x79, 0xF1, 0xD7, 0xFF, 0xC6, 0x9D,
+    0x09, 0xF9, 0x69, 0xD1, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x9E, 0x5A, 0xE2, 0xAD, 0xA5, 0xEA,
+    0x2E, 0x94, 0x9E, 0x92, 0xE9, 0x4A, 0xE3, 0xE5, 0xF2, 0x9E, 0x5E, 0xA2, 0xAE, 0x4A, 0xEA, 0x2A,
+    0xDA, 0x4F, 0x92, 0xE9, 0x39, 0xF3, 0xE9, 0x3F, 0xC3, 0xF9, 0x1A, 0xFA, 0x3F, 0xFF, 0x93, 0xFF,
+    0xF4, 0xFF, 0xF4, 0xAF, 0xFD, 0xA5, 0x9A, 0xEA, 0x70, 0x76, 0x99, 0x99, 0xAA, 0xA9, 0x73, 0xAF,
+    0xFD, 0xA7, 0x29, 0xFF, 0xEA, 0x72, 0xFF, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x75, 0xAF, 0xC5, 0x9F, 0xC5, 0xFC, 0xA5, 0xAF, 0xC5, 0xFC, 0x6F, 0xCA, 0x49, 0xFC,
+    0x6F, 0xC5, 0xAF, 0xA5, 0x9F, 0xC5, 0xFC, 0x95, 0xAF, 0xA5, 0xFC, 0x6F, 0xC6, 0xFA, 0x6F, 0xC5,
+    0x9F, 0x95, 0x9F, 0xA5, 0xAF, 0x6A, 0xF9, 0x5F, 0xA6, 0xFC, 0x6F, 0x96, 0xFA, 0x59, 0xF6, 0x9F,
+    0x95, 0xAF, 0x6F, 0xC6, 0xFC, 0x5A, 0xFA, 0x6F, 0xEA, 0xFF, 0x96, 0xFF, 0xFF, 0x7F, 0xFF, 0xE9,
+    0x7F, 0xFF, 0xE7, 0x0A, 0xFF, 0xFC, 0x72, 0x9F, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x00, 0x77, 0x96,
+    0x9A, 0xFF, 0xC9, 0x49, 0xFF, 0xEA, 0x4F, 0xFF, 0xA4, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x29, 0xE5, 0xAE, 0x3A, 0xDA, 0x5E, 0xA3, 0xE9, 0x49, 0xE9, 0x3E, 0x94, 0xAE, 0x4E, 0x5F, 0x39,
+    0xE5, 0xEA, 0x3A, 0xE4, 0xAE, 0xA3, 0xAD, 0xA4, 0xF9, 0x3E, 0x93, 0x9F, 0x4E, 0x93, 0xFC, 0x4F,
+    0x91, 0xAF, 0xA4, 0xFF, 0xF9, 0x4F, 0xFF, 0x5F, 0xFF, 0x5A, 0xFF, 0xDA, 0x69, 0xAE, 0xA7, 0x10,
+    0x73, 0xE4, 0xAD, 0x74, 0xFC, 0xAF, 0xC7, 0x4F, 0xFD, 0x97, 0x49, 0xFF, 0x97, 0x7A, 0xF9, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xFC, 0x59, 0xFC, 0x5F, 0xCA, 0x5A, 0xFC, 0x5F,
+    0xC6, 0xFC, 0xA4, 0x9F, 0xC6, 0xFC, 0x5A, 0xFA, 0x59, 0xFC, 0x5F, 0xC9, 0x5A, 0xFA, 0x5F, 0xC6,
+    0xFC, 0x6F, 0xA6, 0xFC, 0x59, 0xF9, 0x59, 0xFA, 0x5A, 0xF6, 0xAF, 0x95, 0xFA, 0x6F, 0xC6, 0xF9,
+    0x6F, 0xA5, 0x9F, 0x69, 0xF9, 0x5A, 0xF6, 0xFC, 0x6F, 0xC5, 0xAF, 0xA6, 0xFE, 0xAF, 0xF9, 0x6F,
+    0xFF, 0xF7, 0xFF, 0xFE, 0x97, 0xFF, 0xFE, 0x70, 0xAF, 0xFF, 0xC7, 0x29, 0xFF, 0xDA, 0x77, 0x77,
+    0x77, 0x70, 0x77, 0x71, 0xE3, 0x9E, 0x69, 0xFF, 0xDA, 0x7F, 0xFD, 0x70, 0x9F, 0xEA, 0x73, 0x9A,
+    0xAA, 0x97, 0x77, 0x77, 0x77, 0x79, 0xE5, 0xAE, 0x4A, 0xDA, 0x5E, 0xA4, 0xE9, 0x49, 0xE9, 0x4E,
+    0x94, 0xAE, 0x5E, 0x5F, 0x49, 0xE5, 0xEA, 0x4A, 0xE4, 0xAE, 0xA4, 0xAD, 0xA4, 0xF9, 0x4E, 0x93,
+    0x9F, 0x5E, 0x93, 0xFC, 0x5F, 0x91, 0xAF, 0xA5, 0xFF, 0xF9, 0x5F, 0xFF, 0x6F, 0xFF, 0x6A, 0xFF,
+    0xDA, 0x79, 0xAE, 0xA7, 0x20, 0x76, 0xAD, 0x97, 0x72, 0xAF, 0x77, 0x2D, 0x9D, 0x97, 0x70, 0x9F,
+    0xC7, 0x72, 0xFA, 0x77, 0x29, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72,
+    0xAF, 0xC5, 0x9F, 0xC5, 0xFC, 0xA5, 0xAF, 0xC5, 0xFC, 0x6F, 0xCA, 0x49, 0xFC, 0x6F, 0xC5, 0xAF,
+    0xA5, 0x9F, 0xC5, 0xFC, 0x95, 0xAF, 0xA5, 0xFC, 0x6F, 0xC6, 0xFA, 0x6F, 0xC5, 0x9F, 0x95, 0x9F,
+    0xA5, 0xAF, 0x6A, 0xF9, 0x5F, 0xA6, 0xFC, 0x6F, 0x96, 0xFA, 0x59, 0xF6, 0x9F, 0x95, 0xAF, 0x6F,
+    0xC6, 0xFC, 0x5A, 0xFA, 0x6F, 0xEA, 0xFF, 0x96, 0xFF, 0xFF, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xE7,
+    0x0A, 0xFF, 0xFC, 0x72, 0x9F, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x00, 0x71, 0xAD, 0x97, 0x2A, 0xF7,
+    0x2D, 0x9D, 0x97, 0x0A, 0xD0, 0xD7, 0x1A, 0xFC, 0x72, 0xF9, 0x72, 0x9A, 0xA7, 0x77, 0x77, 0x77,
+    0x75, 0x9E, 0x5A, 0xE1, 0xAD, 0xA5, 0xEA, 0x1E, 0x94, 0x9E, 0x91, 0xE9, 0x4A, 0xE2, 0xE5, 0xF1,
+    0x9E, 0x5E, 0xA1, 0xAE, 0x4A, 0xEA, 0x1A, 0xDA, 0x4F, 0x91, 0xE9, 0x39, 0xF2, 0xE9, 0x3F, 0xC2,
+    0xF9, 0x1A, 0xFA, 0x2F, 0xFF, 0x92, 0xFF, 0xF3, 0xFF, 0xF3, 0xAF, 0xFD, 0xA4, 0x9A, 0xEA, 0x70,
+    0x72, 0xF6, 0xAE, 0x97, 0x1F, 0x95, 0xAE, 0x97, 0x1F, 0xA5, 0xFA, 0x71, 0xFC, 0x5F, 0xC7, 0x19,
+    0x99, 0x96, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5A, 0xFC, 0x59, 0xFC, 0x70,
+    0xFC, 0xA5, 0xAF, 0xC7, 0x0F, 0xC6, 0xFC, 0xA7, 0x9F, 0xC6, 0xFC, 0x70, 0xAF, 0xA5, 0x9F, 0xC7,
+    0x0F, 0xC9, 0x5A, 0xFA, 0x70, 0xFC, 0x6F, 0xC7, 0x1F, 0xA6, 0xFC, 0x70, 0x9F, 0x95, 0x9F, 0xA7,
+    0x0A, 0xF6, 0xAF, 0x97, 0x0F, 0xA6, 0xFC, 0x71, 0xF9, 0x6F, 0xA7, 0x09, 0xF6, 0x9F, 0x97, 0x0A,
+    0xF6, 0xFC, 0x71, 0xFC, 0x5A, 0xFA, 0x71, 0xFE, 0xAF, 0xF9, 0x71, 0xFF, 0xFF, 0x72, 0xFF, 0xFE,
+    0x97, 0x2F, 0xFF, 0xE7, 0x3A, 0xFF, 0xFC, 0x75, 0x9F, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x71, 0x69,
+    0x99, 0x79, 0x99, 0x59, 0xEA, 0x59, 0xF4, 0x9F, 0x59, 0xF4, 0x9F, 0x59, 0xF9, 0x3A, 0xF9, 0x49,
+    0xF9, 0x77, 0x77, 0x77, 0x77, 0x69, 0xE5, 0xAE, 0x7A, 0xDA, 0x5E, 0xA7, 0xE9, 0x49, 0xE9, 0x7E,
+    0x94, 0xAE, 0x70, 0xE5, 0xF7, 0x9E, 0x5E, 0xA7, 0xAE, 0x4A, 0xEA, 0x7A, 0xDA, 0x4F, 0x97, 0xE9,
+    0x39, 0xF7, 0x0E, 0x93, 0xFC, 0x70, 0xF9, 0x1A, 0xFA, 0x70, 0xFF, 0xF9, 0x70, 0xFF, 0xF7, 0x1F,
+    0xFF, 0x71, 0xAF, 0xFD, 0xA7, 0x29, 0xAE, 0xA7, 0x50, 0x4A, 0xFC, 0x59, 0xFC, 0x5F, 0xCA, 0x5A,
+    0xFC, 0x5F, 0xC6, 0xFC, 0xA4, 0x9F, 0xC6, 0xFC, 0x5A, 0xFA, 0x59, 0xFC, 0x5A, 0xF9, 0x5A, 0xFA,
+    0x5F, 0xC6, 0xFC, 0x6F, 0xA6, 0xFC, 0x59, 0xF9, 0x59, 0xFA, 0x5A, 0xF6, 0xAF, 0x95, 0xFA, 0x6F,
+    0xC6, 0xF9, 0x6F, 0xA5, 0x9F, 0x69, 0xF9, 0x5A, 0xF6, 0xFC, 0x6F, 0xC5, 0xAF, 0xA6, 0xFE, 0xAF,
+    0xF9, 0x6F, 0xFF, 0xF7, 0xFF, 0xFE, 0x97, 0xFF, 0xFE, 0x70, 0xAF, 0xFF, 0xC7, 0x2A, 0xFF, 0xDA,
+    0x77, 0x1F, 0x77, 0x2A, 0xDA, 0x77, 0x3D, 0xA7, 0x73, 0x9F, 0xC7, 0x72, 0xFC, 0x77, 0x3A, 0xDA,
+    0x77, 0x77, 0x20, 0x19, 0xE5, 0xAE, 0x1A, 0xDA, 0x5E, 0xA1, 0xAD, 0xA4, 0x9E, 0x91, 0xE9, 0x4A,
+    0xE2, 0xE5, 0xF1, 0x9E, 0x5E, 0xA1, 0x9E, 0x4A, 0xEA, 0x1A, 0xDA, 0x4F, 0x91, 0xEA, 0x4F, 0x2E,
+    0x93, 0xAF, 0x2E, 0xA2, 0x9F, 0xA2, 0xFC, 0xAA, 0xFC, 0x91, 0x9F, 0xFF, 0x3F, 0xFF, 0x3A, 0xFF,
+    0xDA, 0x49, 0xFA, 0xE7, 0x3E, 0xA7, 0x2E, 0x97, 0x2A, 0xD9, 0x73, 0xFC, 0xA7, 0x1A, 0xFA, 0x72,
+    0x9A, 0xD9, 0x77, 0x40, 0x77, 0x77, 0x71, 0xE7, 0x77, 0x19, 0xEA, 0x77, 0x70, 0xFD, 0x77, 0x6F,
+    0xF7, 0x74, 0xAE, 0x19, 0xE9, 0x77, 0x19, 0xE4, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x76, 0x99, 0x99,
+    0x77, 0x19, 0x99, 0x99, 0x19, 0xFA, 0x77, 0x9F, 0xA1, 0xAF, 0xA7, 0x7F, 0xC2, 0xAF, 0xA7, 0x69,
+    0xFA, 0x2A, 0xF9, 0x76, 0xFC, 0x3A, 0xF9, 0x75, 0x9F, 0xA3, 0xFC, 0x94, 0xAA, 0xA9, 0x4F, 0xC4,
+    0xFC, 0x93, 0xAF, 0x39, 0xFA, 0x4F, 0xC9, 0x29, 0xFC, 0x3F, 0xC5, 0xFC, 0x92, 0xFD, 0x29, 0xFA,
+    0x5F, 0xC9, 0x1F, 0xE9, 0x1F, 0xC6, 0xFC, 0x1A, 0xFE, 0xA0, 0x9F, 0xA6, 0xFC, 0x09, 0xFF, 0xA0,
+    0xFC, 0x7F, 0xC9, 0xFF, 0xD9, 0xFA, 0x7F, 0xFD, 0xAF, 0xFD, 0x79, 0xFF, 0xD0, 0xFF, 0xCA, 0x79,
+    0xFF, 0xC9, 0x0F, 0xFC, 0x70, 0x9F, 0xFA, 0x1A, 0xFE, 0xA7, 0x09, 0xFF, 0x2A, 0xFE, 0x71, 0xAF,
+    0xE9, 0x29, 0xFD, 0xA7, 0x1A, 0xFD, 0xA3, 0x9F, 0xD7, 0x2A, 0xFD, 0x49, 0xFC, 0xA7, 0x20, 0x7D,
+    0x97, 0x70, 0xAE, 0x97, 0x7F, 0xC9, 0x75, 0xFE, 0xA7, 0x3A, 0xE9, 0x0F, 0x71, 0x9E, 0x39, 0xE9,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xEA, 0x72, 0x9E, 0xA9, 0xEA, 0x72, 0xF0, 0x9E, 0xA7, 0x1A,
+    0xE9, 0x09, 0xEA, 0x2A, 0xD3, 0xF1, 0x9E, 0xA1, 0x9E, 0x91, 0xAE, 0x91, 0x9E, 0xA0, 0x9F, 0xA0,
+    0x9F, 0x29, 0xEA, 0x0F, 0xD0, 0xF9, 0x29, 0xFF, 0xEA, 0xF3, 0x9F, 0xFF, 0xE9, 0x39, 0xFF, 0xFE,
+    0x49, 0xFF, 0xFD, 0x94, 0x9F, 0xDA, 0xFD, 0xA5, 0x9F, 0xCA, 0x0F, 0xD6, 0x9F, 0xC1, 0xAF, 0xA6,
+    0x9F, 0x29, 0xF7, 0x77, 0x40, 0x77, 0x72, 0xE7, 0x79, 0xF7, 0x6F, 0xD7, 0x4A, 0xFE, 0x97, 0x1A,
+    0xE9, 0x09, 0xEA, 0x79, 0xE4, 0xAE, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xF7, 0x0A, 0xF1,
+    0xF9, 0x69, 0xF2, 0xFA, 0x6F, 0x92, 0xAF, 0x5F, 0xA3, 0xAF, 0x4A, 0xF4, 0x9F, 0x92, 0xAF, 0x6F,
+    0xA1, 0x9F, 0x96, 0xFC, 0x1F, 0xA7, 0xAF, 0x9F, 0xC7, 0x0A, 0xFF, 0xC7, 0x19, 0xFF, 0x97, 0x2F,
+    0xEA, 0x73, 0xFE, 0x74, 0xAF, 0xC7, 0x5A, 0xFA, 0x75, 0xFC, 0x97, 0x49, 0xFC, 0x75, 0xAF, 0xC7,
+    0x5F, 0xCA, 0x74, 0x9F, 0xC9, 0x74, 0xAF, 0xC7, 0x40, 0x77, 0x76, 0xAD, 0x77, 0x1F, 0x77, 0xAF,
+    0xC9, 0x74, 0xAF, 0xEA, 0x72, 0x9E, 0xA1, 0xF7, 0x1E, 0x93, 0x9E, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0xF6, 0xF5, 0xF5, 0xAE, 0x6F, 0x94, 0xEA, 0x6A, 0xEA, 0x3A, 0xE7, 0x9F, 0x29, 0xE9,
+    0x70, 0xF9, 0x1F, 0x71, 0xFA, 0x09, 0xE9, 0x71, 0xAF, 0x0E, 0xA7, 0x29, 0xFF, 0x74, 0xFE, 0xA7,
+    0x4F, 0xE7, 0x5A, 0xFC, 0x97, 0x59, 0xFC, 0x77, 0xF7, 0x7A, 0xEA, 0x76, 0xAF, 0x73, 0x99, 0xAF,
+    0xC9, 0x72, 0xFF, 0xA7, 0x3F, 0xF7, 0x39, 0xFD, 0xA7, 0x4A, 0xFA, 0x76, 0x69, 0xE9, 0x1A, 0xE9,
+    0x7F, 0x91, 0xF7, 0x9F, 0x19, 0xF7, 0xAF, 0x1F, 0xC7, 0xFC, 0x09, 0xFC, 0x69, 0x99, 0x99, 0x90,
+    0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9F, 0x70, 0xAF, 0x1F, 0x96,
+    0x9F, 0x2F, 0xA6, 0xF9, 0x2A, 0xF5, 0xFA, 0x3A, 0xF4, 0xAF, 0x49, 0xF9, 0x2A, 0xF6, 0xFA, 0x19,
+    0xF9, 0x6F, 0xC1, 0xFA, 0x7A, 0xF9, 0xFC, 0x70, 0xAF, 0xFC, 0x71, 0x9F, 0xF9, 0x72, 0xFE, 0xA7,
+    0x3F, 0xE7, 0x4A, 0xFC, 0x75, 0xAF, 0xA7, 0x5F, 0xC9, 0x74, 0x9F, 0xC7, 0x5A, 0xFC, 0x75, 0xFC,
+    0xA7, 0x49, 0xFC, 0x97, 0x4A, 0xFC, 0x74, 0x77, 0x09, 0xD7, 0x75, 0x9D, 0xA7, 0x75, 0xE7, 0x75,
+    0xE9, 0x77, 0x4A, 0xE7, 0x77, 0x77, 0x77, 0x73, 0xFF, 0xFF, 0xC9, 0x7F, 0xFF, 0xFC, 0x70, 0xAF,
+    0xFF, 0xF7, 0x09, 0xFF, 0xFE, 0xA7, 0x1A, 0xAA, 0xFF, 0xF7, 0x70, 0x9F, 0xE7, 0x70, 0x9F, 0xDA,
+    0x77, 0x0A, 0xFD, 0xA7, 0x70, 0xFE, 0xA7, 0x79, 0xFE, 0x97, 0x7A, 0xFE, 0x97, 0x7F, 0xF9, 0x76,
+    0x9F, 0xF7, 0x79, 0xFF, 0x77, 0xAF, 0xF7, 0x7F, 0xFC, 0x99, 0x99, 0x99, 0x97, 0x0F, 0xFF, 0xFC,
+    0x97, 0xFF, 0xFF, 0xC9, 0x69, 0xFF, 0xFF, 0xC9, 0x6A, 0xFF, 0xFF, 0xCA, 0x6F, 0xFF, 0xFD, 0xA5,
+    0x75, 0x9D, 0x97, 0x6D, 0xA7, 0x6E, 0x76, 0xAD, 0x97, 0x59, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x76,
+    0xFF, 0xE9, 0x59, 0xFF, 0xE9, 0x5A, 0xFF, 0xE9, 0x73, 0xAF, 0x97, 0x3A, 0xF7, 0x4F, 0xC7, 0x39,
+    0xFA, 0x73, 0xAF, 0xA7, 0x3A, 0xF9, 0x73, 0xFC, 0x97, 0x29, 0xFC, 0x73, 0x9F, 0xDA, 0xAA, 0xAA,
+    0x6F, 0xFF, 0xA4, 0x9F, 0xFF, 0xC4, 0xFF, 0xFD, 0x30, 0x77, 0x09, 0x99, 0x97, 0x75, 0xF7, 0x74,
+    0x9F, 0x77, 0x4F, 0xC7, 0x73, 0x9F, 0xA7, 0x73, 0xFC, 0xA7, 0x77, 0x77, 0x77, 0x70, 0xFF, 0xFF,
+    0xC9, 0x7F, 0xFF, 0xFC, 0x70, 0xAF, 0xFF, 0xF7, 0x09, 0xFF, 0xFE, 0xA7, 0x1A, 0xAA, 0xFF, 0xF7,
+    0x70, 0x9F, 0xE7, 0x70, 0x9F, 0xDA, 0x77, 0x0A, 0xFD, 0xA7, 0x70, 0xFE, 0xA7, 0x79, 0xFE, 0x97,
+    0x7A, 0xFE, 0x97, 0x7F, 0xF9, 0x76, 0x9F, 0xF7, 0x79, 0xFF, 0x77, 0xAF, 0xF7, 0x7F, 0xFC, 0x99,
+    0x99, 0x99, 0x97, 0x0F, 0xFF, 0xFC, 0x97, 0xFF, 0xFF, 0xC9, 0x69, 0xFF, 0xFF, 0xC9, 0x6A, 0xFF,
+    0xFF, 0xCA, 0x6F, 0xFF, 0xFD, 0xA5, 0x75, 0xAE, 0x76, 0xF7, 0x5A, 0xF7, 0x5F, 0xA7, 0x4A, 0xFA,
+    0x74, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x71, 0xFF, 0xE9, 0x59, 0xFF, 0xE9, 0x5A, 0xFF, 0xE9,
+    0x73, 0xAF, 0x97, 0x3A, 0xF7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0xAF, 0xA7, 0x3A, 0xF9, 0x73, 0xFC,
+    0x97, 0x29, 0xFC, 0x73, 0x9F, 0xDA, 0xAA, 0xAA, 0x6F, 0xFF, 0xA4, 0x9F, 0xFF, 0xC4, 0xFF, 0xFD,
+    0x30, 0x77, 0x77, 0x5E, 0xA3, 0x9E, 0x97, 0x5F, 0x1A, 0xE7, 0x79, 0xFE, 0xA7, 0x71, 0xAF, 0xC9,
+    0x77, 0x3F, 0x97, 0x74, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4F, 0xFF, 0xFC, 0x97, 0xFF,
+    0xFF, 0xC7, 0x0A, 0xFF, 0xFF, 0x70, 0x9F, 0xFF, 0xEA, 0x71, 0xAA, 0xAF, 0xFF, 0x77, 0x09, 0xFE,
+    0x77, 0x09, 0xFD, 0xA7, 0x70, 0xAF, 0xDA, 0x77, 0x0F, 0xEA, 0x77, 0x9F, 0xE9, 0x77, 0xAF, 0xE9,
+    0x77, 0xFF, 0x97, 0x69, 0xFF, 0x77, 0x9F, 0xF7, 0x7A, 0xFF, 0x77, 0xFF, 0xC9, 0x99, 0x99, 0x99,
+    0x70, 0xFF, 0xFF, 0xC9, 0x7F, 0xFF, 0xFC, 0x96, 0x9F, 0xFF, 0xFC, 0x96, 0xAF, 0xFF, 0xFC, 0xA6,
+    0xFF, 0xFF, 0xDA, 0x50, 0x70, 0xAD, 0x94, 0xAD, 0x97, 0x2E, 0xA1, 0x9E, 0x97, 0x39, 0xEA, 0xF7,
+    0x6A, 0xFD, 0x77, 0x0F, 0xA7, 0x71, 0x9D, 0xA7, 0x73, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x72, 0xFF, 0xE9, 0x71, 0x9F, 0xFE, 0x97, 0x1A, 0xFF, 0xE9, 0x77, 0xAF, 0x97, 0x7A, 0xF7, 0x70,
+    0xFC, 0x77, 0x9F, 0xA7, 0x7A, 0xFA, 0x77, 0xAF, 0x97, 0x7F, 0xC9, 0x76, 0x9F, 0xC7, 0x79, 0xFD,
+    0xAA, 0xAA, 0xA7, 0x2F, 0xFF, 0xA7, 0x09, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0x70, 0x70, 0x99, 0x99,
+    0x71, 0xFD, 0xA6, 0xFE, 0x95, 0xAF, 0xE6, 0xFA, 0x70, 0xAE, 0xA7, 0x1F, 0x72, 0xEA, 0x71, 0x9E,
+    0x97, 0x1A, 0xE7, 0x2E, 0xA7, 0x2E, 0xA7, 0x1A, 0xE9, 0x71, 0xF9, 0x71, 0xF7, 0x19, 0xF7, 0x1A,
+    0xEA, 0x71, 0xF9, 0x70, 0x9F, 0x71, 0xAF, 0x71, 0xFA, 0x70, 0x77, 0x77, 0x77, 0x79, 0xD7, 0x77,
+    0x29, 0xD9, 0x72, 0x9A, 0xFC, 0xA6, 0xAD, 0x71, 0x9F, 0xFD, 0x93, 0xAE, 0x70, 0xAF, 0xFF, 0xA1,
+    0xF9, 0x7F, 0xDA, 0xA9, 0xAF, 0xC9, 0x0E, 0x97, 0xFC, 0xA4, 0x9F, 0xA0, 0xD9, 0x7A, 0xFA, 0x6A,
+    0xF7, 0x29, 0xFA, 0x79, 0xF9, 0x71, 0xFC, 0x71, 0xF9, 0x70, 0x9F, 0x97, 0x1F, 0x97, 0x0A, 0xF7,
+    0x2F, 0x97, 0x0F, 0xA7, 0x19, 0xF7, 0x09, 0xF7, 0x29, 0xF7, 0x0A, 0xF7, 0x2F, 0xA7, 0x0A, 0xF7,
+    0x2F, 0x97, 0x0F, 0xA7, 0x1F, 0xC7, 0x1F, 0xC7, 0x0A, 0xFA, 0x71, 0xFD, 0xA9, 0x19, 0x9A, 0xFD,
+    0x97, 0x1F, 0xFF, 0xFE, 0x72, 0xFF, 0xFF, 0xD9, 0x72, 0xAF, 0xFF, 0xFA, 0x74, 0xFF, 0xFE, 0xA7,
+    0x6F, 0xFF, 0xC9, 0x77, 0x09, 0xAF, 0xEA, 0x97, 0x77, 0x77, 0x30, 0x77, 0x0A, 0x97, 0x71, 0xDA,
+    0x69, 0xAE, 0xA9, 0x19, 0xD9, 0x5F, 0xFA, 0x0E, 0x49, 0xFF, 0xFC, 0xA4, 0xFA, 0x19, 0xFD, 0x4F,
+    0x93, 0xAF, 0x5E, 0xA4, 0xAE, 0x5A, 0xE5, 0xAE, 0x5E, 0xA5, 0xF5, 0xEA, 0x49, 0xEA, 0x49, 0xE9,
+    0x4F, 0x59, 0xF2, 0x9F, 0xC5, 0x9F, 0xFF, 0x96, 0xFF, 0xEA, 0x7F, 0xFE, 0x71, 0xFF, 0xA7, 0x3A,
+    0xFA, 0x71, 0x77, 0x70, 0x9F, 0xFE, 0xA6, 0xAF, 0xFF, 0xD4, 0xAF, 0xFF, 0xF2, 0x9F, 0xF9, 0x39,
+    0xE9, 0x1F, 0xAF, 0x5E, 0xA1, 0xE9, 0x0F, 0x5E, 0xA0, 0x9D, 0xA0, 0x9E, 0xA4, 0xF9, 0x0A, 0xD9,
+    0x0F, 0xA9, 0x9A, 0xAF, 0xC2, 0xD1, 0xFF, 0xFC, 0xA2, 0xCA, 0x09, 0xFF, 0xFC, 0x3A, 0x90, 0xAF,
+    0xFF, 0x7F, 0xFE, 0xA7, 0x9F, 0xFA, 0x97, 0x1A, 0xF7, 0x7F, 0xA7, 0x69, 0xFA, 0x76, 0xAF, 0x97,
+    0x6F, 0xC7, 0x69, 0xFC, 0x76, 0xAF, 0xA7, 0x6F, 0xCA, 0x75, 0x77, 0x77, 0x9A, 0xE7, 0x79, 0xFC,
+    0x77, 0xFD, 0x77, 0xFA, 0xA9, 0x97, 0x4A, 0xEA, 0xFC, 0xA7, 0x2F, 0xFF, 0x71, 0xFE, 0x99, 0xAD,
+    0x97, 0x9F, 0xC9, 0x3D, 0xA7, 0xAF, 0xA4, 0xAD, 0x7F, 0xC5, 0xE6, 0x9F, 0xA5, 0xDA, 0x6A, 0xF9,
+    0x49, 0xD9, 0x6F, 0xC9, 0x4E, 0x7F, 0xD9, 0x19, 0xEA, 0x69, 0xFF, 0xFC, 0x7A, 0xFF, 0xF9, 0x7F,
+    0xFF, 0xA7, 0xAF, 0xFE, 0x97, 0x0F, 0x90, 0x9A, 0xAA, 0x97, 0x1A, 0xF7, 0x70, 0xF9, 0x77, 0x9F,
+    0x77, 0x0F, 0xA7, 0x79, 0xF7, 0x70, 0xFA, 0x77, 0x77, 0x6F, 0xFF, 0x93, 0x9F, 0xFF, 0x4A, 0xFF,
+    0xF4, 0x9F, 0x75, 0xFA, 0x75, 0xF7, 0x5A, 0xF7, 0x5F, 0x97, 0x4A, 0xEA, 0x75, 0xEA, 0x75, 0xE9,
+    0x73, 0x9E, 0x97, 0x3F, 0x97, 0x2A, 0xF7, 0x29, 0xFC, 0x73, 0xFF, 0xF9, 0x4F, 0xFF, 0x4A, 0xFF,
+    0xF4, 0xFF, 0xFA, 0x40, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0xAF, 0xFF,
+    0xFC, 0xA1, 0xAF, 0xFF, 0xFD, 0x90, 0xAF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0x19, 0xCA, 0x4A, 0xEA,
+    0x71, 0xC5, 0xF9, 0x77, 0x9F, 0x77, 0x0A, 0xF7, 0x70, 0xFA, 0x77, 0x0F, 0x97, 0x7A, 0xF7, 0x70,
+    0xFC, 0x77, 0x0F, 0xA7, 0x79, 0xF9, 0x77, 0xAF, 0x77, 0x0F, 0xC7, 0x79, 0xFA, 0x77, 0xAF, 0x97,
+    0x7F, 0xC7, 0x70, 0xFC, 0x77, 0xAF, 0xC7, 0x30, 0x72, 0xAD, 0x71, 0xAF, 0x70, 0xAF, 0xA7, 0x9F,
+    0xC9, 0x7F, 0xCA, 0x70, 0xEA, 0x71, 0xAE, 0x72, 0xF7, 0x2E, 0x97, 0x19, 0xE7, 0x9F, 0xFD, 0x3F,
+    0xFE, 0x2F, 0xFF, 0x5F, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2E, 0xA7, 0x2E, 0x97, 0x1A,
+    0xE7, 0x2F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x40, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x90, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xD9, 0x0F, 0xFF, 0xFD, 0x09, 0xFF, 0xFF, 0xD7,
+    0xAE, 0xA7, 0x6F, 0x97, 0x59, 0xF7, 0x6A, 0xF7, 0x6F, 0xA7, 0x6F, 0x97, 0x5A, 0xF7, 0x6F, 0xC7,
+    0x6F, 0xA7, 0x59, 0xF9, 0x75, 0xAF, 0x76, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x76,
+    0xFC, 0x75, 0xAF, 0xE7, 0x4F, 0xE7, 0x49, 0xFD, 0x75, 0x9F, 0xA7, 0x79, 0xAA, 0x72, 0x77, 0x77,
+    0x77, 0x19, 0xD7, 0x77, 0xAD, 0x97, 0x76, 0xE7, 0x75, 0x9E, 0xA5, 0xAF, 0xC5, 0x9F, 0xE6, 0xFC,
+    0xA5, 0xAF, 0xD7, 0xFC, 0x6F, 0xCA, 0x79, 0xFC, 0x6F, 0xC7, 0x0A, 0xFA, 0x59, 0xFC, 0x70, 0xFC,
+    0x95, 0xAF, 0xA7, 0x0F, 0xC6, 0xFC, 0x71, 0xFA, 0x6F, 0xC7, 0x09, 0xF9, 0x59, 0xFA, 0x70, 0xAF,
+    0x6A, 0xF9, 0x70, 0xFA, 0x6F, 0xC7, 0x1F, 0x96, 0xFA, 0x70, 0x9F, 0x69, 0xF9, 0x70, 0xAF, 0x6F,
+    0xC7, 0x1F, 0xC5, 0xAF, 0xA7, 0x1F, 0xEA, 0xFF, 0x97, 0x1F, 0xFF, 0xF7, 0x2F, 0xFF, 0xE9, 0x72,
+    0xFF, 0xFE, 0x73, 0xAF, 0xFF, 0xC7, 0x59, 0xFF, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x10, 0x77, 0x77,
+    0x4C, 0xA7, 0x71, 0xDA, 0x77, 0x9D, 0x97, 0x69, 0xE2, 0x9E, 0x5A, 0xFC, 0xA2, 0xAD, 0xA5, 0xFD,
+    0x3E, 0x94, 0x9F, 0xA4, 0xE9, 0x4A, 0xE6, 0xE5, 0xF5, 0x9E, 0x5E, 0xA5, 0xAE, 0x4A, 0xEA, 0x5A,
+    0xDA, 0x4F, 0x95, 0xE9, 0x39, 0xF6, 0xE9, 0x3F, 0xC6, 0xF9, 0x1A, 0xFA, 0x6F, 0xFF, 0x96, 0xFF,
+    0xF7, 0xFF, 0xF7, 0xAF, 0xFD, 0xA7, 0x09, 0xAE, 0xA7, 0x30, 0x09, 0x99, 0x6F, 0x95, 0xF9, 0x49,
+    0xF9, 0x49, 0xF9, 0x72, 0x3E, 0x3A, 0xD9, 0x29, 0xDA, 0x3E, 0x3E, 0xA7, 0x20, 0x39, 0xD7, 0x2F,
+    0x70, 0x9F, 0xC9, 0x6F, 0xE9, 0x4F, 0x09, 0xEA, 0x2A, 0xDA, 0x3A, 0xE7, 0x60, 0x1A, 0xD9, 0x09,
+    0xD1, 0xAF, 0x09, 0xD1, 0xDA, 0xFC, 0xA0, 0xAD, 0x09, 0xF1, 0x9D, 0x1A, 0xD9, 0x10, 0x29, 0x9A,
+    0xAA, 0xAF, 0x91, 0xFF, 0xEA, 0x0A, 0xFF, 0xEA, 0x0A, 0xAA, 0xAA, 0xAA, 0x99, 0x99, 0x90, 0x71,
+    0x99, 0x99, 0x99, 0xA2, 0x9F, 0xFF, 0xDA, 0x09, 0xFF, 0xFE, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9,
+    0x99, 0x99, 0x99, 0x00, 0x75, 0xAD, 0xA3, 0xAD, 0xA0, 0xAF, 0xFD, 0x19, 0xFF, 0xCA, 0x2A, 0xFE,
+    0x94, 0x9A, 0xAA, 0xA9, 0x30, 0x29, 0x99, 0x2F, 0x2F, 0x1A, 0xF1, 0xFC, 0x0A, 0xFA, 0x00, 0x2E,
+    0x19, 0xE2, 0xAE, 0x1A, 0xE2, 0xF1, 0xF1, 0xAF, 0x0A, 0xF1, 0xFA, 0x0F, 0xA0, 0x0D, 0xA0, 0x9E,
+    0x91, 0xAC, 0x90, 0xDA, 0x09, 0xC9, 0x60, 0x70, 0xAD, 0xA1, 0xAF, 0x90, 0xD9, 0xD9, 0x9F, 0xC1,
+    0xFA, 0x2A, 0xA9, 0x10, 0x49, 0x99, 0x79, 0x99, 0x4F, 0x6F, 0x3F, 0x95, 0xF9, 0x2F, 0xA5, 0xFA,
+    0x2F, 0xA5, 0xFA, 0x77, 0x60, 0x76, 0xEA, 0x3A, 0xDA, 0x2E, 0xA0, 0x9E, 0xA3, 0x9F, 0xE9, 0x5A,
+    0xFC, 0x70, 0xF7, 0x1A, 0xD6, 0x09, 0x99, 0x79, 0x99, 0x6F, 0x6F, 0x59, 0xF6, 0xF9, 0x4A, 0xF5,
+    0x9F, 0x94, 0xAF, 0x5A, 0xF9, 0x77, 0x50, 0x9A, 0xAA, 0xAA, 0x5F, 0xCA, 0x4A, 0xFC, 0x5F, 0xC5,
+    0xAF, 0x95, 0xFC, 0x59, 0xFA, 0x5F, 0xC9, 0x49, 0xFC, 0x00, 0x3F, 0xD4, 0xFC, 0xA4, 0xFC, 0x49,
+    0xFA, 0x4F, 0xC4, 0xAF, 0x93, 0x9F, 0xC4, 0xFC, 0x94, 0xAA, 0xAA, 0x94, 0x0F, 0xD4, 0xAF, 0xC5,
+    0xFC, 0x5A, 0xF9, 0x5F, 0xC5, 0x9F, 0xA5, 0xFC, 0x94, 0x9F, 0xC5, 0x9A, 0xAA, 0xA0, 0x29, 0x99,
+    0x3E, 0x1A, 0xAE, 0x0A, 0xF9, 0x0F, 0xC3, 0xE3, 0xDA, 0x10, 0x09, 0x93, 0x9D, 0x93, 0xEA, 0xA1,
+    0xFC, 0x90, 0x9F, 0xA1, 0xDA, 0x3E, 0x10, 0x0E, 0xAA, 0xA9, 0x99, 0x19, 0xFF, 0xD0, 0xAF, 0xFD,
+    0x7E, 0xA7, 0xE9, 0x7E, 0x79, 0xE7, 0x50, 0x29, 0xA9, 0x39, 0xD9, 0x2A, 0xD2, 0x9E, 0x1F, 0x91,
+    0xEA, 0x2D, 0xA3, 0x94, 0x70, 0xAC, 0x91, 0xE9, 0x0A, 0xD9, 0x1A, 0xD9, 0x1A, 0xD9, 0x2A, 0xC7,
+    0x19, 0x94, 0xAD, 0x19, 0xAA, 0xD1, 0x9F, 0x90, 0x9F, 0xD0, 0x9A, 0xF4, 0x9A, 0x9A, 0x93, 0x9F,
+    0xA9, 0x9F, 0xD1, 0xAF, 0x1A, 0xD0, 0x91, 0x9D, 0x70, 0x2C, 0x92, 0x9C, 0x1A, 0xFA, 0x09, 0xCA,
+    0x92, 0xC9, 0x70, 0x19, 0x99, 0xAA, 0xAA, 0xF1, 0x9F, 0xFE, 0x1F, 0xFF, 0x99, 0xAA, 0xAA, 0xAA,
+    0xA9, 0x99, 0x99, 0x00, 0x1A, 0xE2, 0xF1, 0xAF, 0x1F, 0xC0, 0xAF, 0xA0, 0x99, 0x99, 0x99, 0x00,
+    0x1A, 0xE1, 0xAE, 0x1E, 0xA1, 0xEA, 0x0A, 0xEA, 0x0A, 0xEA, 0x0F, 0x90, 0xF9, 0x9F, 0x99, 0xF0,
+    0x70, 0xAD, 0xA1, 0xAF, 0x90, 0xD9, 0xD9, 0x9F, 0xC1, 0xFA, 0x2A, 0xA9, 0x10, 0x39, 0xFC, 0xA3,
+    0xAF, 0xC4, 0xFC, 0xA4, 0xFC, 0x4A, 0xF9, 0x4F, 0xC4, 0xFC, 0x93, 0x9F, 0xC4, 0x9A, 0xAA, 0xA4,
+    0x2A, 0xCA, 0x4D, 0x4A, 0xDA, 0x3F, 0xA1, 0x99, 0x0A, 0xD1, 0xAF, 0xA1, 0xFC, 0x2A, 0xAA, 0x92,
+    0x49, 0x93, 0x9E, 0x91, 0xAE, 0xA1, 0x9E, 0x92, 0xE9, 0x3F, 0xD1, 0xFD, 0x2A, 0xEA, 0x59, 0x10,
+    0x72, 0xF3, 0xEA, 0x29, 0xE9, 0x2F, 0x3F, 0x2A, 0xEA, 0x2F, 0x92, 0xF2, 0x09, 0xFF, 0xC1, 0xAF,
+    0xFC, 0x1F, 0xFC, 0xA1, 0xE9, 0x09, 0xE9, 0x09, 0xE1, 0x9E, 0x1A, 0xDA, 0x1A, 0xE1, 0x0F, 0x5A,
+    0xE2, 0xF2, 0xAE, 0xA3, 0x9F, 0xAF, 0x95, 0xAF, 0xE7, 0x0F, 0xD7, 0x19, 0xF7, 0x3E, 0x77, 0x70,
+    0x4D, 0xA7, 0x3A, 0xE9, 0x72, 0xFC, 0xA7, 0x0F, 0xEA, 0x6A, 0xFA, 0xF4, 0x9F, 0x2F, 0x92, 0xEA,
+    0x49, 0xEA, 0x77, 0x00, 0x19, 0xDA, 0x19, 0xD1, 0x9F, 0xA0, 0x9D, 0x90, 0xFD, 0x0A, 0xD0, 0x9D,
+    0x99, 0xFC, 0xA0, 0xAD, 0x1F, 0xC1, 0x9D, 0x2A, 0xD2, 0x76, 0xAF, 0xFC, 0x1A, 0xFF, 0xD0, 0x9E,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x49, 0x99, 0x9A, 0xAA, 0xA9, 0x19, 0xFF, 0xD9, 0x1F, 0xFE, 0xA0,
+    0xAF, 0xDA, 0xAA, 0xAA, 0x90, 0x2A, 0xDA, 0x1A, 0xD2, 0xAF, 0x90, 0xAD, 0x2F, 0xD0, 0xDA, 0x1A,
+    0xD0, 0xAF, 0xC9, 0x1E, 0x1F, 0xC2, 0xAD, 0x19, 0xDA, 0x20, 0x0F, 0xFF, 0x99, 0xFF, 0xF0, 0xAF,
+    0xFF, 0x00, 0x7D, 0xA3, 0xEA, 0x3A, 0xD4, 0xD9, 0x2E, 0x92, 0xE3, 0xD9, 0x70, 0x75, 0x9E, 0xA1,
+    0x9E, 0x92, 0xF2, 0xEA, 0x2F, 0x2F, 0x2A, 0xFF, 0xD9, 0x2F, 0xFD, 0xA2, 0xFF, 0xE2, 0x9A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA0, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0x29, 0xFF, 0xC2, 0xAF, 0xFA, 0x2E, 0x2A,
+    0xD3, 0xDA, 0x2E, 0x29, 0xFF, 0xA2, 0xFF, 0xC9, 0x2F, 0xFC, 0x20, 0x2A, 0xDA, 0xDA, 0x2A, 0xFE,
+    0x91, 0xD0, 0xFC, 0x90, 0x9C, 0xA0, 0xD9, 0xD1, 0xD9, 0x9D, 0x0D, 0x1D, 0x0A, 0xCA, 0x9C, 0xA7,
+    0x30, 0x19, 0xC9, 0x0C, 0xA3, 0xEA, 0x4A, 0xCA, 0x49, 0xE3, 0xAC, 0x9D, 0x91, 0x9A, 0x90, 0x9A,
+    0x91, 0x1A, 0xD9, 0x09, 0xD1, 0xAF, 0x09, 0xD1, 0xDA, 0xFC, 0xA0, 0xAD, 0x09, 0xF1, 0x9D, 0x1A,
+    0xD9, 0x10, 0x69, 0xCA, 0x29, 0xE1, 0xAE, 0x1A, 0xE1, 0xE9, 0x1A, 0x92, 0x77, 0x71, 0xE7, 0x2A,
+    0xD9, 0x71, 0x9D, 0xA7, 0x2E, 0x72, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9E,
+    0x19, 0xE4, 0xF1, 0xF3, 0x9F, 0x09, 0xF3, 0xAE, 0xA0, 0xFA, 0x3F, 0x90, 0xF9, 0x20, 0x75, 0xFF,
+    0xCA, 0x1F, 0xFC, 0x90, 0x9F, 0xFC, 0x1A, 0xDA, 0x1A, 0xE1, 0xE9, 0x1E, 0xA1, 0xE2, 0xE9, 0x00,
+    0x39, 0x99, 0xAA, 0xAA, 0xF3, 0x9F, 0xFE, 0x3F, 0xFF, 0x2A, 0xAA, 0xAA, 0xAA, 0x99, 0x99, 0x99,
+    0x77, 0x73, 0x99, 0x49, 0xFF, 0xD9, 0x3F, 0xFE, 0xA2, 0xFF, 0xFA, 0x29, 0x99, 0x97, 0x20, 0x29,
+    0x99, 0x29, 0x99, 0x29, 0xE2, 0xE2, 0xAD, 0xA1, 0xAE, 0x2E, 0x91, 0xEA, 0x19, 0xE2, 0xE9, 0x1A,
+    0xE1, 0xAE, 0x2E, 0xA1, 0xEA, 0x19, 0xE9, 0x09, 0xE9, 0x10, 0x1A, 0xA9, 0x99, 0x99, 0x19, 0xFE,
+    0xA0, 0xAF, 0xE9, 0x0F, 0xF5, 0xF4, 0x9E, 0xA4, 0xAE, 0xA7, 0x20, 0x75, 0x97, 0x7C, 0xA7, 0x6D,
+    0x72, 0x9F, 0xC9, 0xAD, 0x69, 0xFC, 0xA0, 0xAD, 0x95, 0xFD, 0xA0, 0xE5, 0xAD, 0xAA, 0xFD, 0xA5,
+    0xEA, 0xFE, 0x6F, 0xC0, 0xF9, 0x69, 0x9D, 0x97, 0x6D, 0x76, 0xD7, 0x6A, 0xCA, 0x75, 0x9D, 0x76,
+    0xD9, 0x75, 0xAC, 0xA7, 0x59, 0xD7, 0x6D, 0x97, 0x5A, 0xC9, 0x76, 0x97, 0x77, 0x71, 0x77, 0x77,
+    0x72, 0xE7, 0x75, 0xAE, 0x77, 0x5F, 0x77, 0x49, 0xF7, 0x74, 0x9A, 0xAA, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x73, 0xAF, 0xDA, 0x49, 0xFA, 0x49, 0xFF, 0xD3, 0xAF, 0xC3, 0xAF, 0xFF, 0x19,
+    0xFC, 0x92, 0x9F, 0xCA, 0x1F, 0xFF, 0xA3, 0xFD, 0x3F, 0xFD, 0xA4, 0xFD, 0x4A, 0xFE, 0x95, 0xE9,
+    0x77, 0x49, 0xE7, 0x75, 0xF7, 0x75, 0x99, 0x99, 0x77, 0x40, 0x77, 0x69, 0xF9, 0x29, 0xAA, 0x4A,
+    0xFD, 0x91, 0xF2, 0xAE, 0xAA, 0xE0, 0x9E, 0x92, 0xF1, 0xFF, 0x3E, 0xA1, 0x9F, 0xD7, 0x49, 0xAA,
+    0x97, 0x77, 0x9F, 0x92, 0x9A, 0xA4, 0xAF, 0xD9, 0x1A, 0xE2, 0x9E, 0xAA, 0xE0, 0x9E, 0xA2, 0xF1,
+    0xFF, 0x3A, 0xDA, 0x2F, 0xD7, 0x49, 0xAA, 0x94, 0x19, 0x72, 0xAD, 0xA7, 0x0D, 0x97, 0x2A, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x79, 0x97, 0x19, 0xDA, 0x70, 0xE7, 0x50, 0x1A, 0x2A, 0xD2, 0xAC, 0x29, 0xC0, 0x77, 0x6D, 0x97,
+    0x69, 0xCA, 0x0A, 0xD9, 0x73, 0x9E, 0xA1, 0xEA, 0x96, 0x9A, 0xFA, 0x3A, 0xFF, 0xFD, 0xA9, 0x59,
+    0xAF, 0xFC, 0xAA, 0x77, 0x72, 0x49, 0xAF, 0xEA, 0x97, 0x09, 0xFF, 0xFD, 0x94, 0xAE, 0xA9, 0x99,
+    0x99, 0x99, 0xAF, 0xC2, 0x9D, 0xA7, 0x3A, 0xE9, 0x0D, 0xA7, 0x6A, 0xCA, 0x19, 0x77, 0x0A, 0x00,
+    0x77, 0x39, 0x97, 0x77, 0x0E, 0x93, 0xAF, 0xFF, 0xFF, 0xE9, 0x1F, 0xFF, 0xFF, 0xFC, 0x90, 0xFF,
+    0xFF, 0xFE, 0xA7, 0x74, 0xE9, 0x77, 0x6C, 0x97, 0x77, 0x70, 0x75, 0x9E, 0xA7, 0x70, 0xFA, 0x77,
+    0xAF, 0xC7, 0x69, 0xFD, 0x76, 0xFE, 0x75, 0xAE, 0xAE, 0x74, 0x9E, 0x9A, 0xE9, 0x73, 0xF0, 0x9E,
+    0x97, 0x2A, 0xE9, 0x09, 0xEA, 0x71, 0x9E, 0xA1, 0x9E, 0xA7, 0x1F, 0x29, 0xF7, 0x0F, 0xA2, 0x9F,
+    0x79, 0xF4, 0xF7, 0xFC, 0xAA, 0xAA, 0xAF, 0x6F, 0xFF, 0xE9, 0x49, 0xFF, 0xFE, 0x94, 0xFF, 0xFF,
+    0xA3, 0xFF, 0xFF, 0xCA, 0x29, 0xFA, 0x7F, 0xC2, 0xFC, 0x70, 0xFC, 0x1F, 0xC9, 0x79, 0xFC, 0x00,
+    0x5A, 0xFF, 0xA9, 0x71, 0xFF, 0xF7, 0x0F, 0xFF, 0xC6, 0x9F, 0x29, 0x9F, 0x6A, 0xEA, 0x49, 0xE9,
+    0x5F, 0x59, 0xE6, 0xF5, 0xEA, 0x59, 0xEA, 0x39, 0xF9, 0x5F, 0xFF, 0xCA, 0x6F, 0xFF, 0x96, 0x9F,
+    0xFF, 0xC9, 0x5A, 0xFA, 0xAA, 0xAA, 0xFC, 0x5F, 0x95, 0xF9, 0x4F, 0x6F, 0x93, 0x9F, 0x59, 0xF9,
+    0x3A, 0xF9, 0x99, 0x9A, 0xFD, 0x4F, 0xFF, 0xF4, 0xFF, 0xFE, 0x93, 0x9F, 0xFF, 0xDA, 0x4A, 0xFF,
+    0xFC, 0xA5, 0xFF, 0xEA, 0x96, 0x5A, 0xFF, 0xE6, 0xFF, 0xEA, 0x6F, 0xFE, 0x95, 0x9F, 0xFE, 0x6A,
+    0xDA, 0x76, 0xE9, 0x76, 0xE7, 0x69, 0xE7, 0x6A, 0xDA, 0x76, 0xEA, 0x75, 0x9E, 0x97, 0x5A, 0xE7,
+    0x6F, 0x76, 0xEA, 0x75, 0x9E, 0x97, 0x5A, 0xE7, 0x6F, 0x76, 0xF7, 0x59, 0xEA, 0x75, 0xAE, 0x97,
+    0x5F, 0x77, 0x77, 0x00, 0x74, 0x99, 0x99, 0x76, 0xFC, 0x75, 0xAF, 0xC7, 0x49, 0xFD, 0x97, 0x3F,
+    0xEA, 0x72, 0xFF, 0xC7, 0x1A, 0xF9, 0xF7, 0x09, 0xF1, 0xF7, 0x0F, 0x91, 0xF9, 0x6F, 0xC2, 0xFA,
+    0x5A, 0xF3, 0xFC, 0x49, 0xF9, 0x3F, 0xC4, 0xFA, 0x4A, 0xF3, 0xFC, 0x5A, 0xF9, 0x1A, 0xF9, 0x59,
+    0xFA, 0x09, 0xFA, 0x69, 0xFC, 0x0F, 0xFF, 0xFE, 0x9F, 0xFF, 0xFD, 0xAA, 0xFF, 0xFF, 0xD9, 0xFF,
+    0xFF, 0xE0, 0x6A, 0xAA, 0xAA, 0xAA, 0xFE, 0x7F, 0xFF, 0xC9, 0x69, 0xFF, 0xFA, 0x7F, 0xFA, 0xAA,
+    0xAA, 0x70, 0xF7, 0x70, 0x9F, 0x77, 0x0A, 0xEA, 0x77, 0x0F, 0x97, 0x79, 0xFA, 0xAA, 0xEA, 0x71,
+    0xAF, 0xFD, 0x97, 0x1F, 0xFE, 0x72, 0xFF, 0xDA, 0x71, 0xAF, 0x77, 0x0F, 0xA7, 0x70, 0xF9, 0x77,
+    0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD6, 0x9F, 0xFF, 0xD6, 0xAF, 0xFF,
+    0xD6, 0xFF, 0xFE, 0x50, 0x7F, 0xFF, 0xFC, 0x97, 0xFF, 0xFF, 0xC7, 0x0A, 0xFF, 0xFF, 0x70, 0x9F,
+    0xFF, 0xEA, 0x71, 0xAA, 0xAF, 0xFF, 0x77, 0x09, 0xFE, 0x77, 0x09, 0xFD, 0xA7, 0x70, 0xAF, 0xDA,
+    0x77, 0x0F, 0xEA, 0x77, 0x9F, 0xE9, 0x77, 0xAF, 0xE9, 0x77, 0xFF, 0x97, 0x69, 0xFF, 0x77, 0x9F,
+    0xF7, 0x7A, 0xFF, 0x77, 0xFF, 0xC9, 0x99, 0x99, 0x99, 0x70, 0xFF, 0xFF, 0xC9, 0x7F, 0xFF, 0xFC,
+    0x96, 0x9F, 0xFF, 0xFC, 0x96, 0xAF, 0xFF, 0xFC, 0xA6, 0xFF, 0xFF, 0xDA, 0x50, 0x6F, 0x96, 0xAE,
+    0xA5, 0x9F, 0x7F, 0x95, 0xAF, 0x7F, 0x95, 0xFA, 0x69, 0xF6, 0xF9, 0x6A, 0xF5, 0x9F, 0x7F, 0xA5,
+    0xFC, 0x69, 0xF9, 0x5F, 0xA6, 0xAF, 0x59, 0xF9, 0x6F, 0xC5, 0xAF, 0x96, 0xFA, 0x5F, 0xC6, 0xAF,
+    0x94, 0x9F, 0xC9, 0x99, 0x99, 0x99, 0xFC, 0x5A, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 0xCA, 0x5F, 0xFF,
+    0xFC, 0xA4, 0x9F, 0xFF, 0xFC, 0x94, 0xFF, 0xFF, 0xD5, 0xFC, 0x95, 0xAF, 0xC4, 0x9F, 0xC6, 0xFC,
+    0xA4, 0xAF, 0xC5, 0x9F, 0xC9, 0x4F, 0xCA, 0x5A, 0xFC, 0x40, 0x72, 0x9A, 0xFC, 0xA7, 0x69, 0xFF,
+    0xD9, 0x73, 0xAF, 0xFF, 0xA7, 0x1F, 0xDA, 0xA9, 0xAF, 0xC9, 0x7F, 0xCA, 0x49, 0xFA, 0x6A, 0xFA,
+    0x6A, 0xF5, 0x9F, 0xA7, 0x9F, 0x94, 0xFC, 0x71, 0xF9, 0x39, 0xF9, 0x49, 0x99, 0x1F, 0x93, 0xAF,
+    0x0A, 0xFE, 0x90, 0xF9, 0x3F, 0xA9, 0xFF, 0xA9, 0xF3, 0x9F, 0x0F, 0xFC, 0xA9, 0xF3, 0xAF, 0x0A,
+    0x99, 0x99, 0x93, 0xFA, 0x3A, 0xF7, 0x2F, 0x93, 0xFA, 0x71, 0xFC, 0x4F, 0xC7, 0x0A, 0xFA, 0x4F,
+    0xDA, 0x91, 0x99, 0xAF, 0xD9, 0x4F, 0xFF, 0xFE, 0x5F, 0xFF, 0xFD, 0x95, 0xAF, 0xFF, 0xFA, 0x7F,
+    0xFF, 0xEA, 0x71, 0xFF, 0xFC, 0x97, 0x39, 0xAF, 0xEA, 0x97, 0x77, 0x71, 0x59, 0xDA, 0xA6, 0x9F,
+    0x6A, 0xEA, 0x6F, 0x96, 0xF6, 0x9F, 0x6A, 0xEA, 0x6A, 0xE9, 0x6F, 0x7F, 0x69, 0xEA, 0x6A, 0xE9,
+    0x6F, 0x69, 0xF6, 0xAF, 0x6F, 0xA6, 0xF9, 0x59, 0xF6, 0xFC, 0x6F, 0xC5, 0x9F, 0xA5, 0xAF, 0xA5,
+    0xAA, 0xE9, 0x40, 0x79, 0xF2, 0xAF, 0xA7, 0x0A, 0xE9, 0x19, 0xFA, 0x71, 0xF1, 0x9F, 0xC7, 0x19,
+    0xEA, 0x1F, 0xC7, 0x2F, 0x90, 0xFC, 0x73, 0xF0, 0xFC, 0x73, 0xAE, 0x9A, 0xF9, 0x73, 0xFA, 0xF9,
+    0x73, 0x9F, 0xFA, 0x74, 0xFF, 0xA7, 0x5F, 0xEA, 0x75, 0xAF, 0xE7, 0x6F, 0xEA, 0x75, 0x9F, 0xFA,
+    0x74, 0xAF, 0xFC, 0x97, 0x3F, 0xFE, 0x97, 0x19, 0xF0, 0xFE, 0x71, 0xFC, 0x09, 0xFE, 0x70, 0xFA,
+    0x1F, 0xF6, 0xAF, 0x91, 0x9F, 0xEA, 0x5F, 0xC3, 0xFF, 0xA3, 0x0F, 0xE7, 0x5F, 0xEA, 0x74, 0xFF,
+    0x97, 0x3F, 0xFC, 0x73, 0xFF, 0xC9, 0x72, 0xFF, 0xD7, 0x2F, 0xFD, 0xA7, 0x1F, 0xFE, 0x97, 0x9F,
+    0xC0, 0xFD, 0x79, 0xFC, 0x1F, 0xC9, 0x69, 0xFC, 0x19, 0xFC, 0x69, 0xFC, 0x2A, 0xFA, 0x59, 0xFA,
+    0x3F, 0xC9, 0x4A, 0xF9, 0x39, 0xFC, 0x4A, 0xF9, 0x4A, 0xF9, 0x3A, 0xF6, 0xFC, 0x3A, 0xF7, 0xFA,
+    0x2A, 0xF7, 0x9F, 0x91, 0xAF, 0x70, 0xAF, 0x1F, 0xA7, 0x1F, 0x90, 0xFA, 0x71, 0x9F, 0x00, 0x6F,
+    0xCA, 0x7A, 0xFA, 0x6F, 0xCA, 0x69, 0xFC, 0x95, 0x9F, 0xD6, 0xFD, 0x6A, 0xFD, 0x5A, 0xFD, 0x6F,
+    0xE4, 0x9F, 0xDA, 0x59, 0xFE, 0x93, 0xFE, 0x95, 0xAF, 0xE9, 0x2A, 0xFE, 0x6F, 0xFA, 0x19, 0xFF,
+    0x59, 0xFF, 0xA1, 0xFF, 0xA5, 0xAE, 0xAF, 0xC0, 0xAF, 0xF9, 0x5F, 0x9F, 0xC9, 0xF9, 0xF9, 0x5F,
+    0x0F, 0xFC, 0xAA, 0xF5, 0xAF, 0x0F, 0xFC, 0x0F, 0xC5, 0xFC, 0x0A, 0xFE, 0x99, 0xFA, 0x5F, 0xA0,
+    0xAF, 0xE0, 0xAF, 0x94, 0x9F, 0x90, 0xAF, 0xD9, 0x0F, 0xC5, 0xFC, 0x19, 0xFD, 0x09, 0xFC, 0x5F,
+    0xC1, 0x9F, 0xC1, 0xFC, 0xA4, 0x9F, 0xC2, 0xFA, 0x1F, 0xC9, 0x4A, 0xFA, 0x2F, 0x1A, 0xFC, 0x5F,
+    0xC9, 0x70, 0xFD, 0x40, 0x77, 0x3F, 0x70, 0xFA, 0x6F, 0x7A, 0xFA, 0x59, 0xEA, 0x7F, 0xD5, 0xF7,
+    0x9F, 0xD5, 0xF7, 0xAF, 0xD9, 0x3A, 0xEA, 0x7F, 0xEA, 0x3F, 0x79, 0xFF, 0x3F, 0x7A, 0xFF, 0x2A,
+    0xEA, 0x7F, 0xAF, 0x2F, 0x96, 0x9F, 0x9A, 0xE9, 0x09, 0xF7, 0xFC, 0x0A, 0xEA, 0x0A, 0xEA, 0x7F,
+    0xC0, 0x9F, 0x0F, 0x96, 0x9F, 0xC0, 0x9F, 0x9F, 0x7F, 0xCA, 0x1F, 0xFA, 0x7F, 0xC9, 0x1F, 0xF9,
+    0x6A, 0xFC, 0x2F, 0xF7, 0xFD, 0x2A, 0xFD, 0xA6, 0x9F, 0xCA, 0x29, 0xFD, 0x96, 0xAF, 0xC9, 0x29,
+    0xFD, 0x7F, 0xD4, 0xFC, 0xA6, 0x59, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x96, 0xFF, 0xFD, 0xA4,
+    0x9F, 0xFF, 0xD5, 0xAF, 0xFF, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7F, 0xFD, 0x72, 0xFF,
+    0xCA, 0x71, 0xAF, 0xFC, 0x97, 0x29, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x5F, 0xFF,
+    0xF9, 0x3F, 0xFF, 0xF3, 0x9F, 0xFF, 0xF3, 0xAF, 0xFF, 0xEA, 0x30, 0x72, 0x9A, 0xFC, 0xA7, 0x69,
+    0xFF, 0xD9, 0x73, 0xAF, 0xFF, 0xA7, 0x1F, 0xDA, 0xA9, 0xAF, 0xC9, 0x7F, 0xCA, 0x49, 0xFA, 0x6A,
+    0xFA, 0x6A, 0xF5, 0x9F, 0xA7, 0x9F, 0x94, 0xFC, 0x71, 0xF9, 0x39, 0xF9, 0x71, 0xF9, 0x3A, 0xF7,
+    0x2F, 0x93, 0xFA, 0x71, 0x9F, 0x39, 0xF7, 0x29, 0xF3, 0xAF, 0x72, 0xFA, 0x3A, 0xF7, 0x2F, 0x93,
+    0xFA, 0x71, 0xFC, 0x4F, 0xC7, 0x0A, 0xFA, 0x4F, 0xDA, 0x91, 0x99, 0xAF, 0xD9, 0x4F, 0xFF, 0xFE,
+    0x5F, 0xFF, 0xFD, 0x95, 0xAF, 0xFF, 0xFA, 0x7F, 0xFF, 0xEA, 0x71, 0xFF, 0xFC, 0x97, 0x39, 0xAF,
+    0xEA, 0x97, 0x77, 0x71, 0x4F, 0xFF, 0xC5, 0xFF, 0xFA, 0x49, 0xFF, 0xF9, 0x4F, 0x49, 0xE5, 0xEA,
+    0x4A, 0xE4, 0x9E, 0x5E, 0xA4, 0xAE, 0x5E, 0x94, 0xEA, 0x49, 0xE5, 0xE9, 0x4A, 0xE4, 0x9E, 0x5E,
+    0xA4, 0xAE, 0x5E, 0x94, 0xEA, 0x49, 0xE5, 0xE9, 0x4A, 0xE4, 0x9E, 0x5E, 0xA4, 0xAE, 0x49, 0xE9,
+    0x4E, 0xA4, 0xAE, 0x5E, 0x94, 0xEA, 0x49, 0xE5, 0xE9, 0x4A, 0xDA, 0x49, 0xE5, 0x77, 0x73, 0x9F,
+    0xFA, 0x72, 0xFF, 0xE7, 0x1F, 0xFF, 0x79, 0xE9, 0x39, 0xE9, 0x6F, 0x5E, 0xA6, 0xF5, 0xEA, 0x59,
+    0xEA, 0x4F, 0x95, 0xFA, 0x99, 0xAA, 0xFC, 0x6F, 0xFF, 0xCA, 0x59, 0xFF, 0xFC, 0x6A, 0xFF, 0xF7,
+    0xFF, 0xEA, 0x79, 0xFF, 0xA9, 0x71, 0xAF, 0x77, 0xFA, 0x76, 0x9F, 0xA7, 0x6A, 0xF9, 0x76, 0xFC,
+    0x76, 0x9F, 0xC7, 0x6A, 0xFA, 0x76, 0xFC, 0xA7, 0x50, 0x77, 0x70, 0xFF, 0xF5, 0x9F, 0xFF, 0x5A,
+    0xFF, 0xEA, 0x59, 0xF7, 0x6F, 0xA7, 0x59, 0xF7, 0x6F, 0xA7, 0x6F, 0x76, 0xAE, 0xA7, 0x6E, 0x97,
+    0x6E, 0x75, 0x9E, 0x97, 0x4F, 0x74, 0xAF, 0x73, 0x9F, 0xC7, 0x4F, 0xFF, 0x94, 0x9F, 0xFF, 0x5A,
+    0xFF, 0xEA, 0x5F, 0xFF, 0x94, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF,
+    0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xD9, 0x0F, 0xFF, 0xFD, 0x09, 0xFF, 0xFF, 0xD7, 0xAE, 0xA7, 0x6F,
+    0x97, 0x59, 0xF7, 0x6A, 0xF7, 0x6F, 0xA7, 0x6F, 0x97, 0x5A, 0xF7, 0x6F, 0xC7, 0x6F, 0xA7, 0x59,
+    0xF9, 0x75, 0xAF, 0x76, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x75, 0xAF,
+    0xC7, 0x30, 0x9F, 0x70, 0xAF, 0x1F, 0x96, 0x9F, 0x2F, 0xA6, 0xF9, 0x2A, 0xF5, 0xFA, 0x3A, 0xF4,
+    0xAF, 0x49, 0xF9, 0x2A, 0xF6, 0xFA, 0x19, 0xF9, 0x6F, 0xC1, 0xFA, 0x7A, 0xF9, 0xFC, 0x70, 0xAF,
+    0xFC, 0x71, 0x9F, 0xF9, 0x72, 0xFE, 0xA7, 0x3F, 0xE7, 0x4A, 0xFC, 0x75, 0xAF, 0xA7, 0x5F, 0xC9,
+    0x74, 0x9F, 0xC7, 0x5A, 0xFC, 0x75, 0xFC, 0xA7, 0x49, 0xFC, 0x97, 0x4A, 0xFC, 0x74, 0x77, 0x0A,
+    0xAA, 0x97, 0x77, 0x0A, 0xE7, 0x77, 0x1F, 0x77, 0x71, 0xEA, 0x77, 0x79, 0xAF, 0xA9, 0x77, 0x2A,
+    0xFF, 0xF9, 0x75, 0xAF, 0xFF, 0xEA, 0x72, 0xAF, 0xFD, 0xAA, 0xFD, 0xA7, 0x0A, 0xFC, 0xA0, 0xF2,
+    0xAF, 0xC9, 0x6F, 0xD9, 0x1E, 0xA3, 0xFC, 0xA5, 0xFD, 0x29, 0xE9, 0x3A, 0xFC, 0x49, 0xFC, 0x3A,
+    0xE4, 0xAF, 0xA4, 0xFC, 0x93, 0xF4, 0xFC, 0xA3, 0x9F, 0xC3, 0x9E, 0xA4, 0xFC, 0x93, 0xFC, 0xA3,
+    0xAE, 0x4A, 0xFC, 0x4F, 0xC9, 0x3F, 0x39, 0xFC, 0x93, 0x9F, 0xCA, 0x3E, 0xA2, 0xAF, 0xD4, 0x9F,
+    0xEA, 0x9A, 0xEA, 0xAA, 0xFE, 0x94, 0x9F, 0xFF, 0xFF, 0xDA, 0x6F, 0xFF, 0xFF, 0xD7, 0xAF, 0xFF,
+    0xFE, 0xA7, 0x1A, 0xFF, 0xFF, 0xC9, 0x74, 0x9A, 0xFF, 0xDA, 0x97, 0x73, 0x9E, 0x97, 0x77, 0x0A,
+    0xE7, 0x77, 0x1F, 0x77, 0x70, 0x9E, 0xA7, 0x77, 0x77, 0x60, 0x69, 0xF7, 0x0F, 0x97, 0xFA, 0x6F,
+    0x97, 0x0A, 0xF4, 0x9F, 0x97, 0x19, 0xFA, 0x29, 0xF9, 0x73, 0xFC, 0x19, 0xF9, 0x74, 0xAF, 0xAA,
+    0xFA, 0x76, 0xFF, 0xCA, 0x77, 0xFF, 0xA7, 0x70, 0xAF, 0xDA, 0x77, 0x2F, 0xCA, 0x77, 0x29, 0xFC,
+    0xA7, 0x71, 0x9F, 0xE7, 0x70, 0x9F, 0xF9, 0x77, 0xFF, 0xD7, 0x6F, 0xFE, 0x75, 0xFC, 0xA9, 0xFC,
+    0xA7, 0x3F, 0xD1, 0xFD, 0x72, 0xFD, 0x2A, 0xFC, 0x97, 0x0F, 0xD3, 0x9F, 0xD7, 0xAF, 0xC9, 0x4F,
+    0xD6, 0xAF, 0xCA, 0x5A, 0xFC, 0xA4, 0x29, 0xCA, 0xA9, 0x39, 0xDA, 0x09, 0xCA, 0xA3, 0xAE, 0x4A,
+    0xD9, 0x0A, 0xE3, 0xEA, 0x4E, 0x1A, 0xDA, 0x3E, 0x94, 0xE1, 0xE9, 0x3E, 0x4A, 0xDA, 0x09, 0xE3,
+    0x9E, 0x4E, 0x90, 0xEA, 0x39, 0xE4, 0xE0, 0xAE, 0x93, 0xAE, 0x39, 0xDA, 0x9F, 0x4A, 0xEA, 0x2A,
+    0xFE, 0x94, 0x9F, 0xA1, 0xFF, 0x6F, 0xFF, 0xD7, 0xFF, 0xFC, 0x71, 0xFF, 0xDA, 0x73, 0x9A, 0xFC,
+    0xA7, 0x70, 0xAD, 0xA7, 0x71, 0xE9, 0x77, 0x1E, 0x77, 0x19, 0xDA, 0x77, 0x1A, 0xD9, 0x77, 0x1E,
+    0x77, 0x19, 0xE7, 0x71, 0xAD, 0x97, 0x71, 0xAD, 0x74, 0x77, 0x77, 0x2A, 0xFC, 0xA9, 0x75, 0xAF,
+    0xFC, 0xA7, 0x3F, 0xFF, 0xA7, 0x1F, 0xC9, 0x2A, 0xF9, 0x7F, 0xC5, 0xAE, 0xA6, 0xAF, 0x7F, 0x6F,
+    0x70, 0xF5, 0xAE, 0x97, 0x0F, 0x5F, 0x71, 0xF4, 0x9E, 0xA7, 0x09, 0xEA, 0x4A, 0xE7, 0x1A, 0xE9,
+    0x4F, 0x71, 0xF5, 0xF7, 0x0F, 0xA5, 0xF7, 0xAF, 0x6A, 0xE6, 0xAF, 0x96, 0x9F, 0x92, 0xAF, 0xC9,
+    0x5F, 0xF2, 0xFE, 0x94, 0xFF, 0x19, 0xFE, 0xA3, 0x9F, 0xF1, 0xAF, 0xE9, 0x39, 0xFE, 0xA1, 0xFF,
+    0x77, 0x74, 0x77, 0x71, 0x9A, 0xE9, 0x74, 0xAF, 0xFC, 0xA7, 0xAF, 0xFD, 0xA7, 0xEA, 0x19, 0xF9,
+    0x6E, 0xA3, 0xAE, 0x69, 0xE4, 0xAE, 0x6A, 0xD9, 0x4A, 0xE6, 0xE5, 0xAE, 0x59, 0xD9, 0x5E, 0xA5,
+    0xAD, 0x6E, 0x95, 0xE5, 0xF9, 0x5F, 0xAA, 0xAF, 0xD9, 0x5F, 0xFF, 0xD2, 0x91, 0xAF, 0xFF, 0xDA,
+    0xD2, 0xFF, 0xFF, 0xA3, 0xAF, 0xA2, 0xFD, 0x97, 0x49, 0xFC, 0x77, 0x50, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x75, 0x9E, 0xA7, 0x5F, 0xE9, 0x72, 0xFF, 0xC9, 0x70, 0xAF, 0xFD, 0x70, 0xFC, 0xA9,
+    0xFA, 0x6F, 0xA3, 0xAE, 0x6F, 0x49, 0xE5, 0x9E, 0x94, 0xE9, 0x5A, 0xE1, 0x99, 0xAF, 0x6F, 0x0F,
+    0xE7, 0xEA, 0x0F, 0xDA, 0x69, 0xE9, 0x9F, 0xEA, 0x5A, 0xE5, 0xF5, 0xF5, 0xAE, 0x94, 0xF9, 0x4F,
+    0x4A, 0xFD, 0x91, 0xFC, 0x4F, 0xFF, 0xDA, 0x4F, 0xFF, 0xD4, 0x9F, 0xFF, 0xCA, 0x4A, 0xE9, 0xAF,
+    0xF5, 0xF2, 0xAF, 0xA6, 0xEA, 0x76, 0x9E, 0x97, 0x6A, 0xE7, 0x7F, 0x77, 0xAA, 0xA9, 0x76, 0x0E,
+    0xA5, 0xDA, 0x90, 0xF4, 0x9E, 0xA0, 0xAE, 0x49, 0xE9, 0x0A, 0xE9, 0x3A, 0xE1, 0x9E, 0xA3, 0xF2,
+    0xF2, 0x9E, 0xA2, 0xF2, 0xF3, 0xF9, 0x09, 0xF3, 0xAE, 0xA0, 0xF9, 0x39, 0xFA, 0xF4, 0x9F, 0xF6,
+    0xFE, 0xA5, 0x9F, 0xE6, 0x9F, 0xD7, 0x9F, 0xC9, 0x7A, 0xF9, 0x70, 0xAF, 0x71, 0xFC, 0x71, 0xFC,
+    0x71, 0xFA, 0x70, 0x9F, 0xA7, 0x09, 0xF9, 0x71, 0x97, 0x30, 0x79, 0xAF, 0xDA, 0x97, 0xFF, 0xE9,
+    0x5F, 0xFF, 0x95, 0xF9, 0x99, 0xAA, 0xE6, 0xEA, 0x69, 0x6F, 0x97, 0x59, 0xFA, 0x75, 0xAF, 0xA7,
+    0x5A, 0xFA, 0x74, 0xAF, 0xC9, 0x71, 0xFF, 0xC7, 0x9F, 0xFE, 0x59, 0xFD, 0xAF, 0xC5, 0xFC, 0x92,
+    0xFA, 0x3A, 0xF9, 0x3A, 0xEA, 0x3F, 0xA4, 0xAE, 0xA3, 0xF9, 0x4F, 0x93, 0xF9, 0x3F, 0xC4, 0xFC,
+    0xAA, 0xFD, 0x94, 0xFF, 0xFA, 0x59, 0xFF, 0xDA, 0x79, 0xFF, 0x97, 0x2A, 0xEA, 0x97, 0x59, 0xAC,
+    0xA6, 0x9F, 0xD5, 0xDA, 0x19, 0xCA, 0x39, 0xC9, 0x29, 0xA9, 0x39, 0xC9, 0x72, 0xF7, 0xAF, 0x6A,
+    0xDA, 0x70, 0xDA, 0x2D, 0x92, 0x9D, 0x29, 0xD9, 0x29, 0xD9, 0x1E, 0x92, 0x9F, 0xF4, 0xFE, 0x6A,
+    0xE9, 0x40, 0x49, 0xFF, 0xD4, 0xAF, 0xFC, 0xA4, 0xFF, 0xD9, 0x6A, 0xFA, 0x97, 0xFC, 0x97, 0x0F,
+    0xA7, 0x1F, 0xA7, 0x1F, 0xA7, 0x1A, 0xEA, 0x72, 0xF7, 0x29, 0xE9, 0x72, 0xAE, 0x73, 0x9F, 0x97,
+    0x2F, 0xF9, 0x7F, 0xF7, 0x09, 0xFD, 0x72, 0x9F, 0x72, 0xFA, 0x71, 0xFC, 0x71, 0xFC, 0xA7, 0x9F,
+    0xCA, 0x70, 0xFC, 0xA7, 0x77, 0x77, 0x49, 0xE9, 0x74, 0xFC, 0x99, 0xFA, 0x5F, 0xFF, 0xC6, 0xFF,
+    0xE9, 0x49, 0xFA, 0x90, 0x9E, 0xA4, 0xF9, 0x3A, 0xDA, 0x4E, 0xA4, 0xAD, 0xA3, 0x9E, 0x94, 0xE9,
+    0x3F, 0x49, 0xE9, 0x3F, 0x4A, 0xE3, 0x9E, 0xA4, 0xF3, 0xAE, 0x93, 0x9E, 0xA3, 0xF9, 0x3A, 0xE9,
+    0x29, 0xF4, 0xF3, 0xAF, 0x39, 0xF3, 0xFA, 0x3A, 0xEA, 0x3A, 0xAA, 0xA9, 0x3F, 0x97, 0x4F, 0x74,
+    0xAF, 0x74, 0xFC, 0x74, 0xFA, 0x73, 0x9F, 0x97, 0x75, 0x72, 0x97, 0x49, 0xFD, 0x97, 0x0A, 0xFF,
+    0x96, 0xAE, 0xA1, 0xAE, 0x5A, 0xE9, 0x3E, 0x5E, 0xA4, 0xE9, 0x3A, 0xE5, 0xE9, 0x3E, 0xA5, 0xE3,
+    0xAF, 0xFF, 0xC3, 0xFF, 0xFD, 0x3F, 0xFF, 0xCA, 0x29, 0xEA, 0x99, 0x99, 0x9F, 0x92, 0xAE, 0xA4,
+    0xF3, 0xAE, 0xA3, 0xFC, 0x3F, 0xC2, 0xAF, 0x93, 0xFF, 0xFC, 0x4A, 0xFF, 0xE9, 0x4A, 0xFF, 0xDA,
+    0x6F, 0xFD, 0x79, 0xFE, 0xA7, 0x19, 0xAE, 0xA9, 0x70, 0x5A, 0x99, 0x59, 0xE5, 0xAD, 0xA5, 0xE9,
+    0x49, 0xE5, 0xAE, 0x5E, 0xA5, 0xE9, 0x49, 0xE5, 0xF5, 0xEA, 0x49, 0xE9, 0x4F, 0x94, 0xF4, 0x9F,
+    0xAA, 0x91, 0xFE, 0x91, 0xFE, 0x19, 0xFD, 0xA1, 0x5E, 0x1A, 0xE6, 0xDA, 0x09, 0xE6, 0xAD, 0x90,
+    0xE9, 0x6E, 0x0E, 0x96, 0x9D, 0xAE, 0xA7, 0xAF, 0xCA, 0x70, 0xFD, 0x70, 0x9F, 0xC7, 0x1F, 0xC9,
+    0x71, 0xFD, 0x70, 0x9F, 0xDA, 0x7E, 0xAF, 0x96, 0xE0, 0xFC, 0x94, 0xAD, 0xA0, 0x9F, 0xC4, 0xE9,
+    0x1F, 0xD2, 0xAF, 0xA7, 0x69, 0xFD, 0xA7, 0x5F, 0xF7, 0x4F, 0xFA, 0x74, 0x99, 0xAF, 0xC9, 0x77,
+    0xAF, 0x77, 0x0A, 0xE9, 0x77, 0x9F, 0x77, 0x9F, 0xA7, 0x6A, 0xFC, 0x76, 0xFD, 0xA7, 0x5F, 0xE7,
+    0x5F, 0xF7, 0x39, 0xFA, 0xE9, 0x72, 0xAF, 0x0F, 0x72, 0xFA, 0x09, 0xE9, 0x71, 0xF2, 0xF7, 0x09,
+    0xF3, 0xEA, 0x7A, 0xEA, 0x3A, 0xE7, 0xF9, 0x4E, 0xA6, 0xF5, 0xAE, 0x59, 0xEA, 0x6F, 0x00, 0x59,
+    0xE9, 0x4A, 0xE5, 0xAE, 0x5E, 0xA5, 0xEA, 0x49, 0xE9, 0x5E, 0x94, 0xAE, 0x6E, 0x5F, 0x5A, 0xE5,
+    0xEA, 0x5F, 0x4A, 0xEA, 0x49, 0xEA, 0x4F, 0x94, 0xAE, 0x93, 0x9F, 0x5F, 0x93, 0xFC, 0x49, 0xFC,
+    0x91, 0xAF, 0xA4, 0xFF, 0xFD, 0x94, 0xFF, 0xFD, 0x4A, 0xFF, 0xFD, 0x4F, 0xFF, 0xDA, 0x39, 0xE0,
+    0x9F, 0xA7, 0x0A, 0xDA, 0x77, 0xE7, 0x77, 0x73, 0x0E, 0xA5, 0xDA, 0x90, 0xF4, 0x9E, 0xA0, 0xAE,
+    0x49, 0xE9, 0x0A, 0xE9, 0x3A, 0xE1, 0x9E, 0xA3, 0xF2, 0xF2, 0x9E, 0xA2, 0xF2, 0xF9, 0x2F, 0x90,
+    0x9F, 0x3A, 0xEA, 0x0F, 0x93, 0x9F, 0xAF, 0x49, 0xFF, 0x95, 0xFE, 0xA5, 0x9F, 0xE6, 0x9F, 0xD9,
+    0x69, 0xFD, 0x70, 0x99, 0x99, 0xA6, 0x2F, 0xFD, 0x92, 0xFF, 0xD2, 0x9F, 0xFD, 0x5F, 0xD9, 0x5F,
+    0xE5, 0xAF, 0xE5, 0xFE, 0xA5, 0xFE, 0xA5, 0x9F, 0xD9, 0x59, 0xFD, 0x59, 0xFA, 0x96, 0xEA, 0x71,
+    0xEA, 0x70, 0x9F, 0xD9, 0x6F, 0xE9, 0x59, 0xFE, 0x71, 0xF7, 0x09, 0xF7, 0x9F, 0x96, 0xAF, 0xC6,
+    0xAF, 0xC7, 0xFC, 0x77, 0x40, 0x69, 0xAE, 0xA9, 0x70, 0xFF, 0xA5, 0x9F, 0xFD, 0x94, 0xFA, 0x19,
+    0xF3, 0xF9, 0x3A, 0xE3, 0xEA, 0x4A, 0xE2, 0xAE, 0x5A, 0xE2, 0xEA, 0x5F, 0x2E, 0xA4, 0x9E, 0xA1,
+    0x9E, 0x94, 0xF2, 0x9F, 0x29, 0xFC, 0x29, 0xFF, 0xF9, 0x3F, 0xFE, 0xA4, 0xFF, 0xE6, 0xFF, 0xA7,
+    0x0A, 0xFA, 0x60, 0x77, 0x49, 0xFF, 0xFE, 0x2A, 0xFF, 0xFD, 0xA2, 0xFF, 0xFE, 0x94, 0xAE, 0x19,
+    0xE9, 0x7E, 0xA1, 0xAE, 0x79, 0xE9, 0x1E, 0xA7, 0xAE, 0x19, 0xE7, 0x0E, 0xA1, 0xF7, 0x9E, 0x91,
+    0xE9, 0x7A, 0xE1, 0xAE, 0x70, 0xEA, 0x1F, 0x79, 0xE1, 0x9F, 0xD5, 0xF1, 0x9F, 0xCA, 0x5A, 0xAA,
+    0x92, 0xAF, 0x50, 0x75, 0x99, 0x97, 0x69, 0xFD, 0x74, 0xFF, 0xC7, 0x2F, 0xCA, 0x9A, 0xDA, 0x70,
+    0xFA, 0x3E, 0x79, 0xF4, 0xAD, 0x7F, 0x94, 0xAD, 0x69, 0xF5, 0xE6, 0xFA, 0x5D, 0xA5, 0x9F, 0xA4,
+    0xAD, 0x95, 0xFD, 0x91, 0x9A, 0xE6, 0xFF, 0xFC, 0x95, 0xAF, 0xFF, 0xA6, 0xFF, 0xFC, 0x6A, 0xFF,
+    0xEA, 0x7F, 0x90, 0x9A, 0xDA, 0x70, 0x9F, 0x77, 0xFA, 0x76, 0x9F, 0x77, 0xFA, 0x77, 0xEA, 0x97,
+    0x60, 0x77, 0x3A, 0xAA, 0xA9, 0x6A, 0xFE, 0x4F, 0xFD, 0x2A, 0xEA, 0x19, 0xE9, 0x1E, 0xA4, 0x99,
+    0x19, 0xE7, 0x1A, 0xDA, 0x71, 0xAD, 0xA7, 0x1A, 0xE7, 0x19, 0xEA, 0x71, 0xFC, 0x71, 0xF9, 0x70,
+    0xAE, 0x97, 0x0F, 0x70, 0x9F, 0x70, 0xAE, 0xA7, 0x09, 0xE7, 0x49, 0x70, 0x69, 0xAF, 0xFF, 0xC5,
+    0xFF, 0xFE, 0xA4, 0xFF, 0xFF, 0x93, 0xFA, 0x19, 0xEA, 0x70, 0xF9, 0x3A, 0xE7, 0x0E, 0xA4, 0xAE,
+    0x7A, 0xE5, 0xAE, 0x7E, 0xA5, 0xF7, 0xEA, 0x49, 0xEA, 0x69, 0xE9, 0x4F, 0x79, 0xF2, 0x9F, 0xC7,
+    0x9F, 0xFF, 0x97, 0x0F, 0xFE, 0xA7, 0x1F, 0xFE, 0x73, 0xFF, 0xA7, 0x5A, 0xFA, 0x73, 0x76, 0x9F,
+    0xFF, 0xC9, 0xAF, 0xFF, 0xC0, 0xFF, 0xFD, 0x5F, 0x72, 0xE9, 0x71, 0xAE, 0x72, 0xEA, 0x71, 0x9E,
+    0x97, 0x1F, 0x72, 0xEA, 0x71, 0xAE, 0x97, 0x1F, 0xD9, 0x7F, 0xD7, 0x09, 0xFA, 0x60, 0x2E, 0x2A,
+    0xD9, 0x3E, 0x3E, 0x29, 0xE3, 0xE2, 0xAD, 0xA3, 0xE2, 0xAD, 0xA3, 0xE2, 0xE9, 0x3E, 0x2E, 0x4E,
+    0x19, 0xE3, 0x9E, 0x1A, 0xE3, 0xAE, 0x1A, 0xE3, 0xEA, 0x1F, 0x90, 0x9F, 0x91, 0xFF, 0xE2, 0xFF,
+    0xD9, 0x2A, 0xFF, 0xC3, 0x9F, 0xF5, 0x9A, 0xEA, 0x94, 0x75, 0x9A, 0xA9, 0x77, 0x4E, 0x77, 0x5E,
+    0x77, 0x49, 0xE7, 0x74, 0xAD, 0xA7, 0x72, 0x9A, 0xFC, 0xA7, 0x69, 0xFF, 0xDA, 0x73, 0xAF, 0xFF,
+    0xA7, 0x1F, 0xFF, 0xE9, 0x7A, 0xFC, 0xAD, 0xA0, 0x9F, 0xC6, 0x9F, 0xA0, 0xAD, 0x91, 0xAF, 0x6F,
+    0xA1, 0xE3, 0xF9, 0x4F, 0xC2, 0xE3, 0xF9, 0x4F, 0x91, 0x9D, 0xA3, 0xF9, 0x3A, 0xF2, 0xAD, 0xA3,
+    0xF9, 0x3F, 0x92, 0xE9, 0x29, 0xF3, 0x9F, 0x3E, 0x39, 0xF3, 0xAF, 0x3E, 0x3F, 0xA3, 0xAE, 0xA2,
+    0x9D, 0xA3, 0xF9, 0x3F, 0xC2, 0xAD, 0xA2, 0xFC, 0x4F, 0xC9, 0x1E, 0x90, 0x9F, 0xCA, 0x4F, 0xEA,
+    0xEA, 0xFE, 0x94, 0xFF, 0xFF, 0xE5, 0xFF, 0xFF, 0xD9, 0x5A, 0xFF, 0xFF, 0xA7, 0xFF, 0xFE, 0xA7,
+    0x09, 0xFF, 0xFC, 0x97, 0x39, 0xAF, 0xEA, 0x97, 0x70, 0x9D, 0xA7, 0x74, 0xAD, 0x97, 0x74, 0xE9,
+    0x77, 0x4E, 0x77, 0x49, 0xE7, 0x50, 0x77, 0x75, 0xAD, 0xA9, 0x7E, 0xA6, 0xAF, 0xA5, 0xF7, 0xFD,
+    0xA3, 0xF7, 0x0F, 0xE9, 0x1F, 0x71, 0x99, 0xAF, 0xA0, 0xF9, 0x74, 0x9F, 0xF9, 0x76, 0xFE, 0x97,
+    0x7A, 0xFC, 0xA7, 0x70, 0xAF, 0xA7, 0x71, 0xFC, 0x77, 0x1F, 0xD7, 0x70, 0xFE, 0x97, 0x6F, 0xFA,
+    0x75, 0xAF, 0xFC, 0x74, 0xAF, 0x99, 0xF9, 0x72, 0xAF, 0xA1, 0xFF, 0x6A, 0xFA, 0x2F, 0xEA, 0x5A,
+    0xFC, 0x3A, 0xFD, 0x94, 0xAF, 0xC5, 0xFD, 0x49, 0xAA, 0xAA, 0xA7, 0x9A, 0xAA, 0xA4, 0x6A, 0xA9,
+    0x74, 0xD9, 0x73, 0x9D, 0x74, 0x9D, 0x74, 0x9D, 0x71, 0xFD, 0x2C, 0xA4, 0xFD, 0x2D, 0xA2, 0x9F,
+    0xCA, 0x2E, 0x2A, 0xDA, 0xDA, 0x2E, 0x2E, 0xAD, 0x92, 0xE2, 0xE9, 0xD9, 0x2E, 0x2E, 0x9D, 0x29,
+    0xE1, 0x9E, 0x9D, 0x2A, 0xDA, 0x1A, 0xE9, 0xD2, 0xAD, 0xA1, 0xAE, 0xAD, 0x2E, 0x91, 0xFE, 0xAA,
+    0xF2, 0xFF, 0xF9, 0x2A, 0xFF, 0xE4, 0xFF, 0xD6, 0xFE, 0x97, 0x09, 0xD9, 0x73, 0x9D, 0x74, 0x9D,
+    0x74, 0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xAA, 0x71, 0x49, 0xCA, 0xAA, 0x39, 0xAA,
+    0x95, 0x9F, 0x94, 0xE9, 0x39, 0xF9, 0x5E, 0xA3, 0xF9, 0x6E, 0xA2, 0xAE, 0xA7, 0xEA, 0x2F, 0x19,
+    0xD9, 0x2E, 0x91, 0xAE, 0x91, 0xAD, 0x3E, 0x91, 0xF2, 0xDA, 0x29, 0xE2, 0xEA, 0x2D, 0x92, 0xF1,
+    0x9E, 0x91, 0xE9, 0x09, 0xF9, 0x2F, 0xAF, 0xFE, 0x3F, 0xFF, 0xE4, 0x9F, 0xFF, 0xC6, 0x9E, 0xA1,
+    0xAD, 0xA9, 0x77, 0x71, 0x75, 0x9E, 0xA7, 0x70, 0xFA, 0x77, 0xAF, 0xC7, 0x69, 0xFD, 0x76, 0xFE,
+    0x75, 0xAE, 0xAE, 0x74, 0x9E, 0x9A, 0xE9, 0x73, 0xF0, 0x9E, 0x97, 0x2A, 0xE9, 0x09, 0xEA, 0x71,
+    0x9E, 0xA1, 0x9E, 0xA7, 0x1F, 0x29, 0xF7, 0x0F, 0xA2, 0x9F, 0x79, 0xF4, 0xF7, 0xFC, 0xAA, 0xAA,
+    0xAF, 0x6F, 0xFF, 0xE9, 0x49, 0xFF, 0xFE, 0x94, 0xFF, 0xFF, 0xA3, 0xFF, 0xFF, 0xCA, 0x29, 0xFA,
+    0x7F, 0xC2, 0xFC, 0x70, 0xFC, 0x1F, 0xC9, 0x79, 0xFC, 0x77, 0x74, 0x99, 0x99, 0x77, 0x09, 0xEA,
+    0x77, 0x0F, 0xA7, 0x79, 0xF9, 0x77, 0xAF, 0x97, 0x7F, 0xC7, 0x40, 0x77, 0x71, 0x9A, 0xE9, 0x72,
+    0xAF, 0xFC, 0xA5, 0xAF, 0xFD, 0x95, 0xEA, 0x19, 0xF9, 0x4E, 0xA3, 0xAE, 0x49, 0xE4, 0xAE, 0x4A,
+    0xD9, 0x4A, 0xE4, 0xE5, 0xAD, 0xA3, 0x9D, 0x95, 0xEA, 0x3A, 0xD6, 0xE9, 0x3E, 0x5F, 0x4F, 0xAA,
+    0xAF, 0xD4, 0xFF, 0xFC, 0x4A, 0xFF, 0xF5, 0xFF, 0xEA, 0x6A, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x99,
+    0x99, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x39, 0xF7, 0x4F, 0xC7, 0x39, 0xFC, 0x73, 0x77, 0x1A, 0xA7,
+    0x72, 0xAE, 0x77, 0x3A, 0xC7, 0x72, 0xDA, 0x77, 0x1D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x9E, 0xA7, 0x70, 0xFA, 0x77, 0xAF, 0xC7, 0x69, 0xFD, 0x76, 0xFE, 0x75, 0xAE, 0xAE, 0x74, 0x9E,
+    0x9A, 0xE9, 0x73, 0xF0, 0x9E, 0x97, 0x2A, 0xE9, 0x09, 0xEA, 0x71, 0x9E, 0xA1, 0x9E, 0xA7, 0x1F,
+    0x29, 0xF7, 0x0F, 0xA2, 0x9F, 0x79, 0xF4, 0xF7, 0xFC, 0xAA, 0xAA, 0xAF, 0x6F, 0xFF, 0xE9, 0x49,
+    0xFF, 0xFE, 0x94, 0xFF, 0xFF, 0xA3, 0xFF, 0xFF, 0xCA, 0x29, 0xFA, 0x7F, 0xC2, 0xFC, 0x70, 0xFC,
+    0x1F, 0xC9, 0x79, 0xFC, 0x00, 0x73, 0xAA, 0x74, 0xAE, 0x75, 0x9C, 0x74, 0xAD, 0x73, 0xAD, 0x74,
+    0xCA, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xE9, 0x70, 0xAF, 0xFC, 0xA3, 0xAF, 0xFD, 0x93, 0xEA,
+    0x19, 0xF9, 0x2E, 0xA3, 0xAE, 0x29, 0xE4, 0xAE, 0x2A, 0xD9, 0x4A, 0xE2, 0xE5, 0xAD, 0xA1, 0x9D,
+    0x95, 0xEA, 0x1A, 0xD6, 0xE9, 0x1E, 0x5F, 0x2F, 0xAA, 0xAF, 0xD2, 0xFF, 0xFC, 0x2A, 0xFF, 0xF3,
+    0xFF, 0xEA, 0x4A, 0xFA, 0x60, 0x77, 0x4D, 0xA7, 0x73, 0xE7, 0x73, 0xAD, 0x97, 0x72, 0x9D, 0xA7,
+    0x73, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0xAD, 0x77, 0x4F, 0x77, 0x2A, 0xFC, 0x77, 0x09, 0xFE,
+    0x97, 0x6E, 0xA0, 0xAE, 0x97, 0x4E, 0xA3, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x79, 0xEA, 0x77, 0x2F,
+    0xA7, 0x71, 0xAF, 0xC7, 0x70, 0x9F, 0xD7, 0x70, 0xFE, 0x77, 0xAE, 0xAE, 0x76, 0x9E, 0x9A, 0xE9,
+    0x75, 0xF0, 0x9E, 0x97, 0x4A, 0xE9, 0x09, 0xEA, 0x73, 0x9E, 0xA1, 0x9E, 0xA7, 0x3F, 0x29, 0xF7,
+    0x2F, 0xA2, 0x9F, 0x71, 0x9F, 0x4F, 0x71, 0xFC, 0xAA, 0xAA, 0xAF, 0x70, 0xFF, 0xFE, 0x96, 0x9F,
+    0xFF, 0xE9, 0x6F, 0xFF, 0xFA, 0x5F, 0xFF, 0xFC, 0xA4, 0x9F, 0xA7, 0xFC, 0x4F, 0xC7, 0x0F, 0xC3,
+    0xFC, 0x97, 0x9F, 0xC2, 0x77, 0x4D, 0xA7, 0x73, 0xE7, 0x73, 0xAD, 0x97, 0x72, 0x9E, 0x77, 0x3E,
+    0x71, 0xE7, 0x74, 0xF7, 0x72, 0xFD, 0x97, 0x7A, 0xFE, 0x97, 0x59, 0xE9, 0x09, 0xEA, 0x74, 0xE9,
+    0x39, 0xE7, 0x77, 0x77, 0x77, 0x59, 0xAE, 0x97, 0x70, 0xAF, 0xFC, 0xA7, 0x3A, 0xFF, 0xD9, 0x73,
+    0xEA, 0x19, 0xF9, 0x72, 0xEA, 0x3A, 0xE7, 0x29, 0xE4, 0xAE, 0x72, 0xAD, 0x94, 0xAE, 0x72, 0xE5,
+    0xAD, 0xA7, 0x19, 0xD9, 0x5E, 0xA7, 0x1A, 0xD6, 0xE9, 0x71, 0xE5, 0xF7, 0x2F, 0xAA, 0xAF, 0xD7,
+    0x2F, 0xFF, 0xC7, 0x2A, 0xFF, 0xF7, 0x3F, 0xFE, 0xA7, 0x4A, 0xFA, 0x76, 0x77, 0x99, 0x97, 0x74,
+    0xF7, 0x73, 0x9F, 0x77, 0x3A, 0xF7, 0x6A, 0xD1, 0xFC, 0x75, 0xF7, 0x72, 0xAF, 0xC7, 0x70, 0x9F,
+    0xE9, 0x76, 0xEA, 0x0A, 0xE9, 0x74, 0xEA, 0x3A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x9E, 0xA7, 0x72,
+    0xFA, 0x77, 0x1A, 0xFC, 0x77, 0x09, 0xFD, 0x77, 0x0F, 0xE7, 0x7A, 0xEA, 0xE7, 0x69, 0xE9, 0xAE,
+    0x97, 0x5F, 0x09, 0xE9, 0x74, 0xAE, 0x90, 0x9E, 0xA7, 0x39, 0xEA, 0x19, 0xEA, 0x73, 0xF2, 0x9F,
+    0x72, 0xFA, 0x29, 0xF7, 0x19, 0xF4, 0xF7, 0x1F, 0xCA, 0xAA, 0xAA, 0xF7, 0x0F, 0xFF, 0xE9, 0x69,
+    0xFF, 0xFE, 0x96, 0xFF, 0xFF, 0xA5, 0xFF, 0xFF, 0xCA, 0x49, 0xFA, 0x7F, 0xC4, 0xFC, 0x70, 0xFC,
+    0x3F, 0xC9, 0x79, 0xFC, 0x20, 0x19, 0xEA, 0x74, 0xAE, 0xA7, 0x4F, 0xA7, 0x4F, 0xA7, 0x59, 0x9A,
+    0x97, 0x77, 0x5E, 0x75, 0xF7, 0x3F, 0xD9, 0x70, 0xAF, 0xE9, 0x69, 0xE9, 0x09, 0xEA, 0x5E, 0x93,
+    0x9E, 0x77, 0x77, 0x70, 0x9A, 0xE9, 0x71, 0xAF, 0xFC, 0xA4, 0xAF, 0xFD, 0x94, 0xEA, 0x19, 0xF9,
+    0x3E, 0xA3, 0xAE, 0x39, 0xE4, 0xAE, 0x3A, 0xD9, 0x4A, 0xE3, 0xE5, 0xAD, 0xA2, 0x9D, 0x95, 0xEA,
+    0x2A, 0xD6, 0xE9, 0x2E, 0x5F, 0x3F, 0xAA, 0xAF, 0xD3, 0xFF, 0xFC, 0x3A, 0xFF, 0xF4, 0xFF, 0xEA,
+    0x5A, 0xFA, 0x70, 0x77, 0x3A, 0xA9, 0x77, 0x39, 0xE9, 0x77, 0x49, 0xC9, 0x77, 0x3A, 0xD7, 0x73,
+    0xAC, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6A, 0xD7, 0x74, 0xF7, 0x72, 0xAF, 0xC7, 0x70,
+    0x9F, 0xE9, 0x76, 0xEA, 0x0A, 0xE9, 0x74, 0xEA, 0x3A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x9E, 0xA7,
+    0x72, 0xFA, 0x77, 0x1A, 0xFC, 0x77, 0x09, 0xFD, 0x77, 0x0F, 0xE7, 0x7A, 0xEA, 0xE7, 0x69, 0xE9,
+    0xAE, 0x97, 0x5F, 0x09, 0xE9, 0x74, 0xAE, 0x90, 0x9E, 0xA7, 0x39, 0xEA, 0x19, 0xEA, 0x73, 0xF2,
+    0x9F, 0x72, 0xFA, 0x29, 0xF7, 0x19, 0xF4, 0xF7, 0x1F, 0xCA, 0xAA, 0xAA, 0xF7, 0x0F, 0xFF, 0xE9,
+    0x69, 0xFF, 0xFE, 0x96, 0xFF, 0xFF, 0xA5, 0xFF, 0xFF, 0xCA, 0x49, 0xFA, 0x7F, 0xC4, 0xFC, 0x70,
+    0xFC, 0x3F, 0xC9, 0x79, 0xFC, 0x20, 0x77, 0x77, 0x70, 0xE9, 0x77, 0x19, 0xF9, 0x77, 0x39, 0xC9,
+    0x77, 0x2E, 0x77, 0x19, 0xE7, 0x2A, 0xD4, 0xAC, 0xA7, 0x3F, 0x77, 0x1A, 0xFC, 0x77, 0x9F, 0xE9,
+    0x75, 0xF0, 0x9E, 0xA7, 0x3E, 0xA3, 0xAE, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xE9, 0x77, 0xAF,
+    0xFC, 0xA7, 0x2A, 0xFF, 0xD9, 0x72, 0xEA, 0x19, 0xF9, 0x71, 0xEA, 0x3A, 0xE7, 0x19, 0xE4, 0xAE,
+    0x71, 0xAD, 0x94, 0xAE, 0x71, 0xE5, 0xAD, 0xA7, 0x09, 0xD9, 0x5E, 0xA7, 0x0A, 0xD6, 0xE9, 0x70,
+    0xE5, 0xF7, 0x1F, 0xAA, 0xAF, 0xD7, 0x1F, 0xFF, 0xC7, 0x1A, 0xFF, 0xF7, 0x2F, 0xFE, 0xA7, 0x3A,
+    0xFA, 0x75, 0x76, 0xAC, 0x91, 0xD7, 0x70, 0xF1, 0xD9, 0x76, 0xAF, 0xA9, 0xD7, 0x7D, 0x99, 0xFA,
+    0x76, 0x9D, 0x1F, 0x77, 0x0A, 0xA2, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x5D, 0xA7, 0x74, 0xAE, 0xA7,
+    0x72, 0x9F, 0xCA, 0x77, 0x1F, 0xF7, 0x7A, 0xE1, 0x9E, 0x97, 0x4A, 0xE4, 0xAD, 0xA7, 0x77, 0x77,
+    0x9E, 0xA7, 0x73, 0xFA, 0x77, 0x2A, 0xFC, 0x77, 0x19, 0xFD, 0x77, 0x1F, 0xE7, 0x70, 0xAE, 0xAE,
+    0x77, 0x9E, 0x9A, 0xE9, 0x76, 0xF0, 0x9E, 0x97, 0x5A, 0xE9, 0x09, 0xEA, 0x74, 0x9E, 0xA1, 0x9E,
+    0xA7, 0x4F, 0x29, 0xF7, 0x3F, 0xA2, 0x9F, 0x72, 0x9F, 0x4F, 0x72, 0xFC, 0xAA, 0xAA, 0xAF, 0x71,
+    0xFF, 0xFE, 0x97, 0x9F, 0xFF, 0xE9, 0x7F, 0xFF, 0xFA, 0x6F, 0xFF, 0xFC, 0xA5, 0x9F, 0xA7, 0xFC,
+    0x5F, 0xC7, 0x0F, 0xC4, 0xFC, 0x97, 0x9F, 0xC3, 0x79, 0xD9, 0x1D, 0x71, 0x9F, 0x1D, 0x97, 0x0F,
+    0xCA, 0x9D, 0x70, 0x9D, 0x99, 0xFA, 0x70, 0x9D, 0x1F, 0x72, 0xAA, 0x2A, 0xA7, 0x77, 0x70, 0xDA,
+    0x76, 0x9E, 0x97, 0x5F, 0xCA, 0x73, 0xFE, 0xA7, 0x1A, 0xE9, 0x0A, 0xE7, 0x9E, 0x39, 0xE9, 0x77,
+    0x77, 0x74, 0x9A, 0xE9, 0x73, 0xAF, 0xFC, 0xA6, 0xAF, 0xFD, 0x96, 0xEA, 0x19, 0xF9, 0x5E, 0xA3,
+    0xAE, 0x59, 0xE4, 0xAE, 0x5A, 0xD9, 0x4A, 0xE5, 0xE5, 0xAD, 0xA4, 0x9D, 0x95, 0xEA, 0x4A, 0xD6,
+    0xE9, 0x4E, 0x5F, 0x5F, 0xAA, 0xAF, 0xD5, 0xFF, 0xFC, 0x5A, 0xFF, 0xF6, 0xFF, 0xEA, 0x7A, 0xFA,
+    0x71, 0x74, 0xAD, 0x77, 0x3F, 0x77, 0x1A, 0xFC, 0x77, 0x9F, 0xE9, 0x75, 0xEA, 0x0A, 0xE9, 0x73,
+    0xEA, 0x3A, 0xDA, 0x77, 0x77, 0x77, 0x74, 0x9E, 0xA7, 0x71, 0xFA, 0x77, 0x0A, 0xFC, 0x77, 0x9F,
+    0xD7, 0x7F, 0xE7, 0x6A, 0xEA, 0xE7, 0x59, 0xE9, 0xAE, 0x97, 0x4F, 0x09, 0xE9, 0x73, 0xAE, 0x90,
+    0x9E, 0xA7, 0x29, 0xEA, 0x19, 0xEA, 0x72, 0xF2, 0x9F, 0x71, 0xFA, 0x29, 0xF7, 0x09, 0xF4, 0xF7,
+    0x0F, 0xCA, 0xAA, 0xAA, 0xF7, 0xFF, 0xFE, 0x95, 0x9F, 0xFF, 0xE9, 0x5F, 0xFF, 0xFA, 0x4F, 0xFF,
+    0xFC, 0xA3, 0x9F, 0xA7, 0xFC, 0x3F, 0xC7, 0x0F, 0xC2, 0xFC, 0x97, 0x9F, 0xC7, 0x77, 0x69, 0x99,
+    0x97, 0x71, 0x9E, 0xA7, 0x71, 0xFA, 0x77, 0x09, 0xF9, 0x77, 0x0A, 0xF9, 0x77, 0x0F, 0xC7, 0x50,
+    0x77, 0x73, 0xE7, 0x7F, 0x75, 0xFD, 0x97, 0x2A, 0xFE, 0x97, 0x09, 0xE9, 0x09, 0xEA, 0x7E, 0x93,
+    0x9E, 0x77, 0x77, 0x76, 0x9A, 0xE9, 0x73, 0xAF, 0xFC, 0xA6, 0xAF, 0xFD, 0x96, 0xEA, 0x19, 0xF9,
+    0x5E, 0xA3, 0xAE, 0x59, 0xE4, 0xAE, 0x5A, 0xD9, 0x4A, 0xE5, 0xE5, 0xAD, 0xA4, 0x9D, 0x95, 0xEA,
+    0x4A, 0xD6, 0xE9, 0x4E, 0x5F, 0x5F, 0xAA, 0xAF, 0xD5, 0xFF, 0xFC, 0x5A, 0xFF, 0xF6, 0xFF, 0xEA,
+    0x7A, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x39, 0x99, 0x97, 0x5A, 0xEA, 0x75, 0xF9, 0x74, 0x9F, 0x75,
+    0xFC, 0x74, 0x9F, 0xC7, 0x40, 0x77, 0x4D, 0xA7, 0x75, 0xE7, 0x75, 0xAD, 0x97, 0x74, 0x9E, 0x77,
+    0x5E, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1E, 0x39, 0xE7, 0x6F, 0xFD, 0xA7, 0x6F,
+    0xFD, 0x77, 0x9F, 0xEA, 0x77, 0x29, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xEA,
+    0x77, 0x4F, 0xA7, 0x73, 0xAF, 0xC7, 0x72, 0x9F, 0xD7, 0x72, 0xFE, 0x77, 0x1A, 0xEA, 0xE7, 0x70,
+    0x9E, 0x9A, 0xE9, 0x77, 0xF0, 0x9E, 0x97, 0x6A, 0xE9, 0x09, 0xEA, 0x75, 0x9E, 0xA1, 0x9E, 0xA7,
+    0x5F, 0x29, 0xF7, 0x4F, 0xA2, 0x9F, 0x73, 0x9F, 0x4F, 0x73, 0xFC, 0xAA, 0xAA, 0xAF, 0x72, 0xFF,
+    0xFE, 0x97, 0x09, 0xFF, 0xFE, 0x97, 0x0F, 0xFF, 0xFA, 0x7F, 0xFF, 0xFC, 0xA6, 0x9F, 0xA7, 0xFC,
+    0x6F, 0xC7, 0x0F, 0xC5, 0xFC, 0x97, 0x9F, 0xC4, 0x77, 0x77, 0x19, 0xD9, 0x77, 0xE7, 0x7A, 0xD9,
+    0x76, 0xAD, 0xA7, 0x69, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x0D, 0xA4, 0xAC, 0xA7, 0x9F, 0xAA, 0xFC,
+    0x70, 0xFF, 0xD7, 0x1A, 0xFF, 0x97, 0x29, 0xAF, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAE,
+    0x97, 0x4A, 0xFF, 0xCA, 0x7A, 0xFF, 0xD9, 0x7E, 0xA1, 0x9F, 0x96, 0xEA, 0x3A, 0xE6, 0x9E, 0x4A,
+    0xE6, 0xAD, 0x94, 0xAE, 0x6E, 0x5A, 0xDA, 0x59, 0xD9, 0x5E, 0xA5, 0xAD, 0x6E, 0x95, 0xE5, 0xF6,
+    0xFA, 0xAA, 0xFD, 0x6F, 0xFF, 0xC6, 0xAF, 0xFF, 0x7F, 0xFE, 0xA7, 0x0A, 0xFA, 0x72, 0x77, 0xAE,
+    0xA7, 0x75, 0xAE, 0xA7, 0x75, 0xFA, 0x77, 0x5F, 0xA7, 0x76, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0xE3, 0x9E, 0x76, 0xFF, 0xDA, 0x76, 0xFF, 0xD7, 0x79, 0xFE, 0xA7, 0x72, 0x9A,
+    0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9E, 0xA7, 0x74, 0xFA, 0x77, 0x3A, 0xFC, 0x77,
+    0x29, 0xFD, 0x77, 0x2F, 0xE7, 0x71, 0xAE, 0xAE, 0x77, 0x09, 0xE9, 0xAE, 0x97, 0x7F, 0x09, 0xE9,
+    0x76, 0xAE, 0x90, 0x9E, 0xA7, 0x59, 0xEA, 0x19, 0xEA, 0x75, 0xF2, 0x9F, 0x74, 0xFA, 0x29, 0xF7,
+    0x39, 0xF4, 0xF7, 0x3F, 0xCA, 0xAA, 0xAA, 0xF7, 0x2F, 0xFF, 0xE9, 0x70, 0x9F, 0xFF, 0xE9, 0x70,
+    0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0xCA, 0x69, 0xFA, 0x7F, 0xC6, 0xFC, 0x70, 0xFC, 0x5F, 0xC9, 0x79,
+    0xFC, 0x40, 0x71, 0xAE, 0x97, 0x7A, 0xEA, 0x77, 0xFA, 0x77, 0xFA, 0x77, 0x09, 0x99, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x71, 0xE4, 0xE7, 0x9F, 0xCA, 0xFA, 0x70, 0xFF, 0xD7, 0x1A, 0xFF, 0x73, 0x9A,
+    0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xE9, 0x74, 0xAF, 0xFC, 0xA7, 0xAF, 0xFD, 0x97,
+    0xEA, 0x19, 0xF9, 0x6E, 0xA3, 0xAE, 0x69, 0xE4, 0xAE, 0x6A, 0xD9, 0x4A, 0xE6, 0xE5, 0xAD, 0xA5,
+    0x9D, 0x95, 0xEA, 0x5A, 0xD6, 0xE9, 0x5E, 0x5F, 0x6F, 0xAA, 0xAF, 0xD6, 0xFF, 0xFC, 0x6A, 0xFF,
+    0xF7, 0xFF, 0xEA, 0x70, 0xAF, 0xA7, 0x20, 0x77, 0x3A, 0xA9, 0x77, 0x6E, 0x97, 0x77, 0xCA, 0x77,
+    0x59, 0xD7, 0x75, 0x9D, 0x97, 0x75, 0x9C, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1E,
+    0x39, 0xE7, 0x6F, 0xFD, 0xA7, 0x6F, 0xFD, 0x77, 0x9F, 0xEA, 0x77, 0x29, 0xAA, 0xA9, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x09, 0xEA, 0x77, 0x4F, 0xA7, 0x73, 0xAF, 0xC7, 0x72, 0x9F, 0xD7, 0x72,
+    0xFE, 0x77, 0x1A, 0xEA, 0xE7, 0x70, 0x9E, 0x9A, 0xE9, 0x77, 0xF0, 0x9E, 0x97, 0x6A, 0xE9, 0x09,
+    0xEA, 0x75, 0x9E, 0xA1, 0x9E, 0xA7, 0x5F, 0x29, 0xF7, 0x4F, 0xA2, 0x9F, 0x73, 0x9F, 0x4F, 0x73,
+    0xFC, 0xAA, 0xAA, 0xAF, 0x72, 0xFF, 0xFE, 0x97, 0x09, 0xFF, 0xFE, 0x97, 0x0F, 0xFF, 0xFA, 0x7F,
+    0xFF, 0xFC, 0xA6, 0x9F, 0xA7, 0xFC, 0x6F, 0xC7, 0x0F, 0xC5, 0xFC, 0x97, 0x9F, 0xC4, 0x74, 0x9D,
+    0xA7, 0x6A, 0xF7, 0x59, 0x90, 0xAC, 0x77, 0xAD, 0x75, 0x9E, 0x97, 0x5E, 0x77, 0x99, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x69, 0xD9, 0x39, 0xDA, 0x6A, 0xFA, 0xFC, 0x96, 0x9F, 0xFD, 0x70, 0xFF, 0xC7,
+    0x2A, 0xFA, 0x97, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xE9, 0x73, 0xAF, 0xFC, 0xA6, 0xAF, 0xFD, 0x96,
+    0xEA, 0x19, 0xF9, 0x5E, 0xA3, 0xAE, 0x59, 0xE4, 0xAE, 0x5A, 0xD9, 0x4A, 0xE5, 0xE5, 0xAD, 0xA4,
+    0x9D, 0x95, 0xEA, 0x4A, 0xD6, 0xE9, 0x4E, 0x5F, 0x5F, 0xAA, 0xAF, 0xD5, 0xFF, 0xFC, 0x5A, 0xFF,
+    0xF6, 0xFF, 0xEA, 0x7A, 0xFA, 0x71, 0x77, 0x19, 0x97, 0x76, 0xAE, 0x1A, 0xC9, 0x77, 0x9F, 0xC0,
+    0xD9, 0x77, 0xDA, 0x0F, 0xC7, 0x70, 0xD9, 0x0A, 0xEA, 0x77, 0x09, 0xA9, 0x19, 0xA9, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x7E, 0x39, 0xE7, 0x6F, 0xFD, 0xA7, 0x6F, 0xFD, 0x77, 0x9F, 0xEA,
+    0x77, 0x29, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xEA, 0x77, 0x4F, 0xA7, 0x73,
+    0xAF, 0xC7, 0x72, 0x9F, 0xD7, 0x72, 0xFE, 0x77, 0x1A, 0xEA, 0xE7, 0x70, 0x9E, 0x9A, 0xE9, 0x77,
+    0xF0, 0x9E, 0x97, 0x6A, 0xE9, 0x09, 0xEA, 0x75, 0x9E, 0xA1, 0x9E, 0xA7, 0x5F, 0x29, 0xF7, 0x4F,
+    0xA2, 0x9F, 0x73, 0x9F, 0x4F, 0x73, 0xFC, 0xAA, 0xAA, 0xAF, 0x72, 0xFF, 0xFE, 0x97, 0x09, 0xFF,
+    0xFE, 0x97, 0x0F, 0xFF, 0xFA, 0x7F, 0xFF, 0xFC, 0xA6, 0x9F, 0xA7, 0xFC, 0x6F, 0xC7, 0x0F, 0xC5,
+    0xFC, 0x97, 0x9F, 0xC4, 0x72, 0x9D, 0xA1, 0xAC, 0x97, 0x2F, 0xA0, 0xD9, 0x71, 0xAD, 0xAD, 0xAD,
+    0x72, 0xD9, 0x0F, 0xA7, 0x2D, 0x90, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1D, 0xA4, 0xE7,
+    0x9F, 0xAA, 0xFC, 0x70, 0xFF, 0xD7, 0x1A, 0xFF, 0x73, 0x9A, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x71, 0x9A, 0xE9, 0x74, 0xAF, 0xFC, 0xA7, 0xAF, 0xFD, 0x97, 0xEA, 0x19, 0xF9, 0x6E, 0xA3, 0xAE,
+    0x69, 0xE4, 0xAE, 0x6A, 0xD9, 0x4A, 0xE6, 0xE5, 0xAD, 0xA5, 0x9D, 0x95, 0xEA, 0x5A, 0xD6, 0xE9,
+    0x5E, 0x5F, 0x6F, 0xAA, 0xAF, 0xD6, 0xFF, 0xFC, 0x6A, 0xFF, 0xF7, 0xFF, 0xEA, 0x70, 0xAF, 0xA7,
+    0x20, 0x77, 0x77, 0x7E, 0x39, 0xE7, 0x6F, 0xFD, 0xA7, 0x6F, 0xFD, 0x77, 0x9F, 0xEA, 0x77, 0x29,
+    0xAA, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xEA, 0x77, 0x4F, 0xA7, 0x73, 0xAF, 0xC7,
+    0x72, 0x9F, 0xD7, 0x72, 0xFE, 0x77, 0x1A, 0xEA, 0xE7, 0x70, 0x9E, 0x9A, 0xE9, 0x77, 0xF0, 0x9E,
+    0x97, 0x6A, 0xE9, 0x09, 0xEA, 0x75, 0x9E, 0xA1, 0x9E, 0xA7, 0x5F, 0x29, 0xF7, 0x4F, 0xA2, 0x9F,
+    0x73, 0x9F, 0x4F, 0x73, 0xFC, 0xAA, 0xAA, 0xAF, 0x72, 0xFF, 0xFE, 0x97, 0x09, 0xFF, 0xFE, 0x97,
+    0x0F, 0xFF, 0xFA, 0x7F, 0xFF, 0xFC, 0xA6, 0x9F, 0xA7, 0xFC, 0x6F, 0xC7, 0x0F, 0xC5, 0xFC, 0x97,
+    0x9F, 0xC7, 0x77, 0x74, 0x99, 0x99, 0x77, 0x49, 0xEA, 0x77, 0x4F, 0xA7, 0x73, 0x9F, 0x97, 0x73,
+    0xAF, 0x97, 0x73, 0xFC, 0x77, 0x00, 0x71, 0xDA, 0x4E, 0x71, 0x9F, 0xAA, 0xFC, 0x72, 0xFF, 0xD7,
+    0x3A, 0xFF, 0x75, 0x9A, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xAE, 0x97, 0x6A, 0xFF,
+    0xCA, 0x71, 0xAF, 0xFD, 0x97, 0x1E, 0xA1, 0x9F, 0x97, 0x0E, 0xA3, 0xAE, 0x70, 0x9E, 0x4A, 0xE7,
+    0x0A, 0xD9, 0x4A, 0xE7, 0x0E, 0x5A, 0xDA, 0x79, 0xD9, 0x5E, 0xA7, 0xAD, 0x6E, 0x97, 0xE5, 0xF7,
+    0x0F, 0xAA, 0xAF, 0xD7, 0x0F, 0xFF, 0xC7, 0x0A, 0xFF, 0xF7, 0x1F, 0xFE, 0xA7, 0x2A, 0xFA, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x99, 0x99, 0x77, 0x0A, 0xEA, 0x77, 0x0F, 0x97, 0x79, 0xF7, 0x70, 0xFC,
+    0x77, 0x9F, 0xC7, 0x70, 0x6A, 0xAA, 0xAA, 0xAA, 0xFE, 0x7F, 0xFF, 0xC9, 0x69, 0xFF, 0xFA, 0x7F,
+    0xFA, 0xAA, 0xAA, 0x70, 0xF7, 0x70, 0x9F, 0x77, 0x0A, 0xEA, 0x77, 0x0F, 0x97, 0x79, 0xFA, 0xAA,
+    0xEA, 0x71, 0xAF, 0xFD, 0x97, 0x1F, 0xFE, 0x72, 0xFF, 0xDA, 0x71, 0xAF, 0x77, 0x0F, 0xA7, 0x70,
+    0xF9, 0x77, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD6, 0x9F, 0xFF, 0xD6,
+    0xAF, 0xFF, 0xD6, 0xFF, 0xFE, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0x99, 0x97, 0x70, 0xAE,
+    0x97, 0x70, 0xF9, 0x77, 0x9F, 0x77, 0x0F, 0xC7, 0x79, 0xFC, 0x77, 0x79, 0xAE, 0xA7, 0x2F, 0xF7,
+    0x0F, 0xCA, 0xF6, 0xF3, 0x9D, 0x94, 0xAE, 0x29, 0x9A, 0xDA, 0x4F, 0xFF, 0xA3, 0xAF, 0xFF, 0xA3,
+    0xFF, 0xFC, 0xA2, 0x9F, 0xCA, 0xAA, 0x99, 0x99, 0x4A, 0xE7, 0x5A, 0xE9, 0x74, 0xAF, 0xA9, 0x29,
+    0xD9, 0x39, 0xFF, 0xF5, 0xFF, 0xF6, 0xFF, 0xDA, 0x79, 0xAF, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x99, 0x97, 0x5A, 0xE9, 0x74, 0xF7, 0x4A, 0xF7, 0x4F, 0xC7, 0x3A, 0xFC, 0x73, 0x76, 0xAA, 0x97,
+    0x72, 0xE9, 0x77, 0x3C, 0xA7, 0x71, 0xAD, 0x77, 0x19, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x71, 0xAA, 0xAA, 0xAA, 0xAF, 0xE7, 0xFF, 0xFC, 0x96, 0x9F, 0xFF, 0xA7, 0xFF, 0xAA, 0xAA,
+    0xA7, 0x0F, 0x77, 0x09, 0xF7, 0x70, 0xAE, 0xA7, 0x70, 0xF9, 0x77, 0x9F, 0xAA, 0xAE, 0xA7, 0x1A,
+    0xFF, 0xD9, 0x71, 0xFF, 0xE7, 0x2F, 0xFD, 0xA7, 0x1A, 0xF7, 0x70, 0xFA, 0x77, 0x0F, 0x97, 0x79,
+    0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xD7, 0xFF, 0xFD, 0x69, 0xFF, 0xFD, 0x6A, 0xFF, 0xFD,
+    0x6F, 0xFF, 0xE5, 0x73, 0x9D, 0x97, 0x4A, 0xE7, 0x6A, 0xC7, 0x49, 0xD9, 0x74, 0xD9, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xEA, 0x71, 0xFF, 0x7F, 0xCA, 0xF5, 0xF3, 0x9D, 0x93,
+    0xAE, 0x29, 0x9A, 0xDA, 0x3F, 0xFF, 0xA2, 0xAF, 0xFF, 0xA2, 0xFF, 0xFC, 0xA1, 0x9F, 0xCA, 0xAA,
+    0x99, 0x99, 0x3A, 0xE7, 0x4A, 0xE9, 0x73, 0xAF, 0xA9, 0x29, 0xD9, 0x29, 0xFF, 0xF4, 0xFF, 0xF5,
+    0xFF, 0xDA, 0x69, 0xAF, 0xA9, 0x40, 0x75, 0x92, 0xAC, 0x97, 0x4A, 0xE9, 0x0A, 0xCA, 0x73, 0x9F,
+    0xC0, 0xD9, 0x73, 0xAD, 0x0F, 0xC7, 0x4D, 0xA0, 0xAE, 0x97, 0x49, 0xA9, 0x19, 0xA9, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x1A, 0xAA, 0xAA, 0xAA, 0xFE, 0x7F, 0xFF, 0xC9, 0x69, 0xFF, 0xFA, 0x7F,
+    0xFA, 0xAA, 0xAA, 0x70, 0xF7, 0x70, 0x9F, 0x77, 0x0A, 0xEA, 0x77, 0x0F, 0x97, 0x79, 0xFA, 0xAA,
+    0xEA, 0x71, 0xAF, 0xFD, 0x97, 0x1F, 0xFE, 0x72, 0xFF, 0xDA, 0x71, 0xAF, 0x77, 0x0F, 0xA7, 0x70,
+    0xF9, 0x77, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD6, 0x9F, 0xFF, 0xD6,
+    0xAF, 0xFF, 0xD6, 0xFF, 0xFE, 0x50, 0x71, 0xAD, 0x91, 0xD7, 0x19, 0xF0, 0x9D, 0x71, 0xDA, 0xFC,
+    0xA7, 0x09, 0xD0, 0x9F, 0x97, 0x09, 0xD1, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x59, 0xAE, 0xA7, 0x3F, 0xF7, 0x1F, 0xCA, 0xF7, 0xF3, 0x9D, 0x95, 0xAE, 0x29, 0x9A, 0xDA,
+    0x5F, 0xFF, 0xA4, 0xAF, 0xFF, 0xA4, 0xFF, 0xFC, 0xA3, 0x9F, 0xCA, 0xAA, 0x99, 0x99, 0x5A, 0xE7,
+    0x6A, 0xE9, 0x75, 0xAF, 0xA9, 0x29, 0xD9, 0x49, 0xFF, 0xF6, 0xFF, 0xF7, 0xFF, 0xDA, 0x70, 0x9A,
+    0xFA, 0x96, 0x77, 0x77, 0x77, 0xAD, 0x77, 0x5A, 0xD9, 0x77, 0x49, 0xE7, 0x75, 0xE7, 0x49, 0xDA,
+    0x4E, 0xA7, 0x4A, 0xE9, 0x77, 0x39, 0xFC, 0xA7, 0x72, 0xFF, 0x77, 0x0F, 0x1A, 0xE9, 0x75, 0xAD,
+    0xA4, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xAA, 0xAA, 0xAA, 0xFE, 0x73, 0xFF, 0xFC, 0x97, 0x29,
+    0xFF, 0xFA, 0x73, 0xFF, 0xAA, 0xAA, 0xA7, 0x4F, 0x77, 0x49, 0xF7, 0x74, 0xAE, 0xA7, 0x74, 0xF9,
+    0x77, 0x39, 0xFA, 0xAA, 0xEA, 0x75, 0xAF, 0xFD, 0x97, 0x5F, 0xFE, 0x76, 0xFF, 0xDA, 0x75, 0xAF,
+    0x77, 0x4F, 0xA7, 0x74, 0xF9, 0x77, 0x39, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x73, 0xFF, 0xFD, 0x73,
+    0xFF, 0xFD, 0x72, 0x9F, 0xFF, 0xD7, 0x2A, 0xFF, 0xFD, 0x72, 0xFF, 0xFE, 0x71, 0x77, 0x77, 0x3A,
+    0xD7, 0x4A, 0xD7, 0x0E, 0xA7, 0x2A, 0xD9, 0x7F, 0xCA, 0x70, 0x9E, 0x7A, 0xFE, 0x7E, 0x79, 0xEA,
+    0x0A, 0xE9, 0x4E, 0xA7, 0xE9, 0x3A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x75, 0x9A, 0xEA, 0x77, 0x4F, 0xF7, 0x72, 0xFC, 0xAF, 0x77, 0x0F, 0x39, 0xD9, 0x76, 0xAE, 0x29,
+    0x9A, 0xDA, 0x76, 0xFF, 0xFA, 0x75, 0xAF, 0xFF, 0xA7, 0x5F, 0xFF, 0xCA, 0x74, 0x9F, 0xCA, 0xAA,
+    0x99, 0x99, 0x76, 0xAE, 0x77, 0x7A, 0xE9, 0x77, 0x6A, 0xFA, 0x92, 0x9D, 0x97, 0x59, 0xFF, 0xF7,
+    0x7F, 0xFF, 0x77, 0x0F, 0xFD, 0xA7, 0x71, 0x9A, 0xFA, 0x97, 0x70, 0x77, 0x19, 0x99, 0x77, 0x7F,
+    0x97, 0x76, 0xF9, 0x77, 0x59, 0xF9, 0x77, 0x59, 0xF9, 0x72, 0x9D, 0xA7, 0x76, 0xAE, 0x97, 0x74,
+    0x9F, 0xCA, 0x77, 0x3F, 0xF7, 0x71, 0xF1, 0xAE, 0x97, 0x6A, 0xDA, 0x4E, 0x97, 0x77, 0x77, 0x77,
+    0x73, 0xAA, 0xAA, 0xAA, 0xAF, 0xE7, 0x4F, 0xFF, 0xC9, 0x73, 0x9F, 0xFF, 0xA7, 0x4F, 0xFA, 0xAA,
+    0xAA, 0x75, 0xF7, 0x75, 0x9F, 0x77, 0x5A, 0xEA, 0x77, 0x5F, 0x97, 0x74, 0x9F, 0xAA, 0xAE, 0xA7,
+    0x6A, 0xFF, 0xD9, 0x76, 0xFF, 0xE7, 0x7F, 0xFD, 0xA7, 0x6A, 0xF7, 0x75, 0xFA, 0x77, 0x5F, 0x97,
+    0x74, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x4F, 0xFF, 0xD7, 0x4F, 0xFF, 0xD7, 0x39, 0xFF, 0xFD,
+    0x73, 0xAF, 0xFF, 0xD7, 0x3F, 0xFF, 0xE7, 0x20, 0x4F, 0x76, 0xF7, 0x59, 0xF7, 0x59, 0xF7, 0x5F,
+    0xC7, 0x39, 0xEA, 0x74, 0xFC, 0xA7, 0x2A, 0xFE, 0x70, 0x9E, 0x90, 0x9E, 0x96, 0xE9, 0x3A, 0xDA,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAE, 0xA7, 0x2F, 0xF7, 0x0F, 0xCA, 0xF6, 0xF3, 0x9D,
+    0x94, 0xAE, 0x29, 0x9A, 0xDA, 0x4F, 0xFF, 0xA3, 0xAF, 0xFF, 0xA3, 0xFF, 0xFC, 0xA2, 0x9F, 0xCA,
+    0xAA, 0x99, 0x99, 0x4A, 0xE7, 0x5A, 0xE9, 0x74, 0xAF, 0xA9, 0x29, 0xD9, 0x39, 0xFF, 0xF5, 0xFF,
+    0xF6, 0xFF, 0xDA, 0x79, 0xAF, 0xA9, 0x50, 0x77, 0x4A, 0xD9, 0x77, 0x5A, 0xE7, 0x77, 0xD7, 0x75,
+    0xAD, 0x77, 0x6C, 0xA7, 0x49, 0xDA, 0x77, 0x5A, 0xE9, 0x77, 0x39, 0xFC, 0xA7, 0x72, 0xFF, 0x77,
+    0x0F, 0x1A, 0xE9, 0x75, 0xAD, 0xA4, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xAA, 0xAA, 0xAA, 0xFE,
+    0x73, 0xFF, 0xFC, 0x97, 0x29, 0xFF, 0xFA, 0x73, 0xFF, 0xAA, 0xAA, 0xA7, 0x4F, 0x77, 0x49, 0xF7,
+    0x74, 0xAE, 0xA7, 0x74, 0xF9, 0x77, 0x39, 0xFA, 0xAA, 0xEA, 0x75, 0xAF, 0xFD, 0x97, 0x5F, 0xFE,
+    0x76, 0xFF, 0xDA, 0x75, 0xAF, 0x77, 0x4F, 0xA7, 0x74, 0xF9, 0x77, 0x39, 0xFA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x73, 0xFF, 0xFD, 0x73, 0xFF, 0xFD, 0x72, 0x9F, 0xFF, 0xD7, 0x2A, 0xFF, 0xFD, 0x72, 0xFF,
+    0xFE, 0x71, 0x77, 0x2D, 0xA7, 0x73, 0x9F, 0x77, 0x39, 0x09, 0xC9, 0x77, 0x39, 0xD7, 0x73, 0xAD,
+    0xA7, 0x72, 0xEA, 0x73, 0xAD, 0x4A, 0xC9, 0x74, 0xF7, 0x72, 0xFD, 0x97, 0x7A, 0xFE, 0xA7, 0x59,
+    0xEA, 0x09, 0xEA, 0x74, 0xE9, 0x39, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9A,
+    0xEA, 0x77, 0x0F, 0xF7, 0x6F, 0xCA, 0xF7, 0x4F, 0x39, 0xD9, 0x72, 0xAE, 0x29, 0x9A, 0xDA, 0x72,
+    0xFF, 0xFA, 0x71, 0xAF, 0xFF, 0xA7, 0x1F, 0xFF, 0xCA, 0x70, 0x9F, 0xCA, 0xAA, 0x99, 0x99, 0x72,
+    0xAE, 0x77, 0x3A, 0xE9, 0x77, 0x2A, 0xFA, 0x92, 0x9D, 0x97, 0x19, 0xFF, 0xF7, 0x3F, 0xFF, 0x74,
+    0xFF, 0xDA, 0x75, 0x9A, 0xFA, 0x97, 0x30, 0x73, 0xAD, 0x19, 0xC9, 0x74, 0xFA, 0x0A, 0xCA, 0x73,
+    0x9D, 0xAD, 0xAD, 0x97, 0x3D, 0xA0, 0xFC, 0x74, 0xDA, 0x1E, 0x77, 0x77, 0x77, 0x73, 0xAD, 0x77,
+    0x2F, 0x77, 0x0A, 0xFC, 0x76, 0x9F, 0xE9, 0x74, 0xEA, 0x09, 0xEA, 0x72, 0xEA, 0x3A, 0xDA, 0x77,
+    0x77, 0x77, 0x3A, 0xAA, 0xAA, 0xAA, 0xFE, 0x7F, 0xFF, 0xC9, 0x69, 0xFF, 0xFA, 0x7F, 0xFA, 0xAA,
+    0xAA, 0x70, 0xF7, 0x70, 0x9F, 0x77, 0x0A, 0xEA, 0x77, 0x0F, 0x97, 0x79, 0xFA, 0xAA, 0xEA, 0x71,
+    0xAF, 0xFD, 0x97, 0x1F, 0xFE, 0x72, 0xFF, 0xDA, 0x71, 0xAF, 0x77, 0x0F, 0xA7, 0x70, 0xF9, 0x77,
+    0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD6, 0x9F, 0xFF, 0xD6, 0xAF, 0xFF,
+    0xD6, 0xFF, 0xFE, 0x50, 0x75, 0x99, 0x2A, 0xC9, 0x74, 0xAE, 0x1D, 0x97, 0x39, 0xFA, 0x0D, 0x74,
+    0xDA, 0x9F, 0xC7, 0x4D, 0x90, 0xAE, 0x97, 0x4A, 0xA2, 0x9A, 0x77, 0x77, 0x0A, 0xD7, 0x72, 0xEA,
+    0x77, 0x0F, 0xCA, 0x76, 0xAF, 0xE7, 0x49, 0xEA, 0x0A, 0xE9, 0x72, 0xE9, 0x3A, 0xDA, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xEA, 0x76, 0xFF, 0x74, 0xFC, 0xAF, 0x72, 0xF3, 0x9D,
+    0x97, 0x0A, 0xE2, 0x99, 0xAD, 0xA7, 0x0F, 0xFF, 0xA7, 0xAF, 0xFF, 0xA7, 0xFF, 0xFC, 0xA6, 0x9F,
+    0xCA, 0xAA, 0x99, 0x99, 0x70, 0xAE, 0x77, 0x1A, 0xE9, 0x77, 0x0A, 0xFA, 0x92, 0x9D, 0x97, 0x9F,
+    0xFF, 0x71, 0xFF, 0xF7, 0x2F, 0xFD, 0xA7, 0x39, 0xAF, 0xA9, 0x71, 0x77, 0x77, 0x9D, 0xA7, 0x71,
+    0xAE, 0x97, 0x79, 0xFC, 0xA7, 0x6F, 0xF7, 0x4F, 0x1A, 0xE9, 0x71, 0xAD, 0xA4, 0xE9, 0x77, 0x77,
+    0x77, 0x4A, 0xAA, 0xAA, 0xAA, 0xFE, 0x7F, 0xFF, 0xC9, 0x69, 0xFF, 0xFA, 0x7F, 0xFA, 0xAA, 0xAA,
+    0x70, 0xF7, 0x70, 0x9F, 0x77, 0x0A, 0xEA, 0x77, 0x0F, 0x97, 0x79, 0xFA, 0xAA, 0xEA, 0x71, 0xAF,
+    0xFD, 0x97, 0x1F, 0xFE, 0x72, 0xFF, 0xDA, 0x71, 0xAF, 0x77, 0x0F, 0xA7, 0x70, 0xF9, 0x77, 0x9F,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD6, 0x9F, 0xFF, 0xD6, 0xAF, 0xFF, 0xD6,
+    0xFF, 0xFE, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0x99, 0x97, 0x70, 0xAE, 0x97, 0x70, 0xF9,
+    0x77, 0x9F, 0x77, 0x0F, 0xC7, 0x79, 0xFC, 0x77, 0x70, 0xAD, 0x77, 0xEA, 0x75, 0xFC, 0xA7, 0x3A,
+    0xFE, 0x71, 0x9E, 0xA0, 0xAE, 0x97, 0xE9, 0x3A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79,
+    0xAE, 0xA7, 0x3F, 0xF7, 0x1F, 0xCA, 0xF7, 0xF3, 0x9D, 0x95, 0xAE, 0x29, 0x9A, 0xDA, 0x5F, 0xFF,
+    0xA4, 0xAF, 0xFF, 0xA4, 0xFF, 0xFC, 0xA3, 0x9F, 0xCA, 0xAA, 0x99, 0x99, 0x5A, 0xE7, 0x6A, 0xE9,
+    0x75, 0xAF, 0xA9, 0x29, 0xD9, 0x49, 0xFF, 0xF6, 0xFF, 0xF7, 0xFF, 0xDA, 0x70, 0x9A, 0xFA, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x74, 0x99, 0x97, 0x6A, 0xE9, 0x75, 0xF7, 0x5A, 0xF7, 0x5F, 0xC7, 0x4A,
+    0xFC, 0x74, 0x71, 0x9A, 0xA7, 0x3A, 0xE7, 0x4A, 0xC7, 0x3A, 0xCA, 0x72, 0xE7, 0x3C, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x73, 0x9D, 0xAA, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x1F, 0x71, 0x9F,
+    0x71, 0xAE, 0xA7, 0x1A, 0xE9, 0x71, 0xF7, 0x2F, 0x71, 0x9E, 0xA7, 0x1A, 0xE9, 0x71, 0xF7, 0x19,
+    0xF7, 0x1A, 0xF7, 0x1F, 0xA7, 0x1F, 0x97, 0x09, 0xF7, 0x1F, 0xC7, 0x1F, 0xC7, 0x09, 0xFA, 0x70,
+    0xAF, 0xA7, 0x0A, 0xAE, 0x97, 0x6A, 0xA9, 0x69, 0xE9, 0x79, 0xC9, 0x6A, 0xD6, 0xAC, 0xA7, 0x77,
+    0x77, 0x71, 0xAC, 0xA9, 0x6E, 0x96, 0xE6, 0x9E, 0x6A, 0xDA, 0x6E, 0x96, 0xE6, 0x9E, 0x6A, 0xDA,
+    0x6E, 0xA5, 0x9E, 0x95, 0xAE, 0x6F, 0x6F, 0x5A, 0xF5, 0x9A, 0xDA, 0x50, 0x72, 0x9D, 0xAA, 0x73,
+    0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAE, 0xA7, 0x3A, 0xE9, 0x73, 0xF7,
+    0x4F, 0x73, 0x9E, 0xA7, 0x3A, 0xE9, 0x73, 0xF7, 0x39, 0xF7, 0x3A, 0xF7, 0x3F, 0xA7, 0x3F, 0x97,
+    0x29, 0xF7, 0x3F, 0xC7, 0x3F, 0xC7, 0x29, 0xFA, 0x72, 0xAF, 0xA7, 0x2A, 0xAE, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x39, 0xE9, 0x73, 0xF9, 0x72, 0x9F, 0x73, 0xFC, 0x73, 0xFC, 0x72, 0x99, 0x99,
+    0x99, 0x72, 0x73, 0x99, 0x97, 0x3A, 0xE9, 0x72, 0xF9, 0x71, 0xAF, 0x72, 0xFC, 0x71, 0x9F, 0xC7,
+    0x77, 0x77, 0x77, 0x0A, 0xCA, 0x97, 0x3E, 0x97, 0x3E, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0x97,
+    0x3E, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x73, 0xF7, 0x3F, 0x72,
+    0xAF, 0x72, 0x9A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x71, 0x99, 0x99, 0x73, 0xF7, 0x2A, 0xEA, 0x72,
+    0xFA, 0x71, 0xAF, 0x97, 0x1F, 0xC9, 0x70, 0x72, 0x9A, 0xFC, 0xA7, 0x69, 0xFF, 0xD9, 0x73, 0xAF,
+    0xFF, 0xA7, 0x1F, 0xDA, 0xA9, 0xAF, 0xC9, 0x7F, 0xCA, 0x49, 0xFA, 0x6A, 0xFA, 0x6A, 0xF5, 0x9F,
+    0xA7, 0x9F, 0x94, 0xFC, 0x71, 0xF9, 0x39, 0xF9, 0x71, 0xF9, 0x3A, 0xF7, 0x2F, 0x93, 0xFA, 0x71,
+    0x9F, 0x39, 0xF7, 0x29, 0xF3, 0xAF, 0x72, 0xFA, 0x3A, 0xF7, 0x2F, 0x93, 0xFA, 0x71, 0xFC, 0x4F,
+    0xC7, 0x0A, 0xFA, 0x4F, 0xDA, 0x91, 0x99, 0xAF, 0xD9, 0x4F, 0xFF, 0xFE, 0x5F, 0xFF, 0xFD, 0x95,
+    0xAF, 0xFF, 0xFA, 0x7F, 0xFF, 0xEA, 0x71, 0xFF, 0xFC, 0x97, 0x39, 0xAF, 0xEA, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9E, 0x97, 0x73, 0xF9, 0x77, 0x29, 0xF7, 0x73,
+    0xAF, 0x77, 0x3F, 0xC7, 0x72, 0x99, 0x99, 0x99, 0x77, 0x10, 0x79, 0xAE, 0xA9, 0x71, 0xFF, 0xA6,
+    0x9F, 0xFD, 0x95, 0xFA, 0x19, 0xF4, 0xF9, 0x3A, 0xE4, 0xEA, 0x4A, 0xE3, 0xAE, 0x5A, 0xE3, 0xEA,
+    0x5F, 0x3E, 0xA4, 0x9E, 0xA2, 0x9E, 0x94, 0xF3, 0x9F, 0x29, 0xFC, 0x39, 0xFF, 0xF9, 0x4F, 0xFE,
+    0xA5, 0xFF, 0xE7, 0xFF, 0xA7, 0x1A, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xE7, 0x5F, 0x74,
+    0xAF, 0x74, 0xFA, 0x73, 0xAF, 0xA7, 0x39, 0x99, 0x99, 0x74, 0x77, 0x9A, 0xA7, 0x75, 0xAE, 0x77,
+    0x6A, 0xC7, 0x74, 0x9D, 0xA7, 0x74, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0xAF,
+    0xCA, 0x76, 0x9F, 0xFD, 0x97, 0x3A, 0xFF, 0xFA, 0x71, 0xFD, 0xAA, 0x9A, 0xFC, 0x97, 0xFC, 0xA4,
+    0x9F, 0xA6, 0xAF, 0xA6, 0xAF, 0x59, 0xFA, 0x79, 0xF9, 0x4F, 0xC7, 0x1F, 0x93, 0x9F, 0x97, 0x1F,
+    0x93, 0xAF, 0x72, 0xF9, 0x3F, 0xA7, 0x19, 0xF3, 0x9F, 0x72, 0x9F, 0x3A, 0xF7, 0x2F, 0xA3, 0xAF,
+    0x72, 0xF9, 0x3F, 0xA7, 0x1F, 0xC4, 0xFC, 0x70, 0xAF, 0xA4, 0xFD, 0xA9, 0x19, 0x9A, 0xFD, 0x94,
+    0xFF, 0xFF, 0xE5, 0xFF, 0xFF, 0xD9, 0x5A, 0xFF, 0xFF, 0xA7, 0xFF, 0xFE, 0xA7, 0x1F, 0xFF, 0xC9,
+    0x73, 0x9A, 0xFE, 0xA9, 0x77, 0x77, 0x10, 0x73, 0xAA, 0x75, 0xAE, 0x76, 0x9C, 0x75, 0xDA, 0x74,
+    0xD9, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xEA, 0x97, 0x0F, 0xFA, 0x59, 0xFF, 0xD9, 0x4F, 0xA1,
+    0x9F, 0x3F, 0x93, 0xAE, 0x3E, 0xA4, 0xAE, 0x2A, 0xE5, 0xAE, 0x2E, 0xA5, 0xF2, 0xEA, 0x49, 0xEA,
+    0x19, 0xE9, 0x4F, 0x29, 0xF2, 0x9F, 0xC2, 0x9F, 0xFF, 0x93, 0xFF, 0xEA, 0x4F, 0xFE, 0x6F, 0xFA,
+    0x70, 0xAF, 0xA6, 0x73, 0xAD, 0x77, 0x71, 0xEA, 0x77, 0x7A, 0xFC, 0x79, 0xD7, 0x2A, 0xFE, 0x6D,
+    0xA7, 0x19, 0xEA, 0x0A, 0xE9, 0x3E, 0x72, 0xEA, 0x3A, 0xDA, 0x1A, 0xD9, 0x77, 0x79, 0xE7, 0x77,
+    0x77, 0x29, 0xAF, 0xCA, 0x77, 0x29, 0xFF, 0xD9, 0x77, 0xAF, 0xFF, 0xA7, 0x5F, 0xDA, 0xA9, 0xAF,
+    0xC9, 0x73, 0xFC, 0xA4, 0x9F, 0xA7, 0x2A, 0xFA, 0x6A, 0xF7, 0x19, 0xFA, 0x79, 0xF9, 0x70, 0xFC,
+    0x71, 0xF9, 0x79, 0xF9, 0x71, 0xF9, 0x7A, 0xF7, 0x2F, 0x97, 0xFA, 0x71, 0x9F, 0x79, 0xF7, 0x29,
+    0xF7, 0xAF, 0x72, 0xFA, 0x7A, 0xF7, 0x2F, 0x97, 0xFA, 0x71, 0xFC, 0x70, 0xFC, 0x70, 0xAF, 0xA7,
+    0x0F, 0xDA, 0x91, 0x99, 0xAF, 0xD9, 0x70, 0xFF, 0xFF, 0xE7, 0x1F, 0xFF, 0xFD, 0x97, 0x1A, 0xFF,
+    0xFF, 0xA7, 0x3F, 0xFF, 0xEA, 0x75, 0xFF, 0xFC, 0x97, 0x79, 0xAF, 0xEA, 0x97, 0x77, 0x77, 0x10,
+    0x77, 0x59, 0xD9, 0x77, 0x5E, 0x7A, 0xD7, 0x2E, 0x70, 0xF7, 0x0A, 0xDA, 0x7A, 0xFC, 0x69, 0xE7,
+    0x9F, 0xE9, 0x77, 0x0E, 0xA0, 0x9E, 0xA7, 0x6E, 0xA3, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x74, 0x9A,
+    0xEA, 0x97, 0x71, 0xFF, 0xA7, 0x69, 0xFF, 0xD9, 0x75, 0xFA, 0x19, 0xF7, 0x4F, 0x93, 0xAE, 0x74,
+    0xEA, 0x4A, 0xE7, 0x3A, 0xE5, 0xAE, 0x73, 0xEA, 0x5F, 0x73, 0xEA, 0x49, 0xEA, 0x72, 0x9E, 0x94,
+    0xF7, 0x39, 0xF2, 0x9F, 0xC7, 0x39, 0xFF, 0xF9, 0x74, 0xFF, 0xEA, 0x75, 0xFF, 0xE7, 0x7F, 0xFA,
+    0x77, 0x1A, 0xFA, 0x77, 0x7F, 0x77, 0x5F, 0x77, 0x49, 0xF9, 0x77, 0x3A, 0xF9, 0x77, 0x39, 0xF7,
+    0x73, 0xAF, 0xA7, 0x71, 0x9F, 0xE7, 0x70, 0xF0, 0xAE, 0x97, 0x5E, 0xA2, 0x9E, 0x97, 0x4A, 0xA9,
+    0x59, 0xAA, 0x77, 0x77, 0x79, 0xAF, 0xCA, 0x76, 0x9F, 0xFD, 0x97, 0x3A, 0xFF, 0xFA, 0x71, 0xFD,
+    0xAA, 0x9A, 0xFC, 0x97, 0xFC, 0xA4, 0x9F, 0xA6, 0xAF, 0xA6, 0xAF, 0x59, 0xFA, 0x79, 0xF9, 0x4F,
+    0xC7, 0x1F, 0x93, 0x9F, 0x97, 0x1F, 0x93, 0xAF, 0x72, 0xF9, 0x3F, 0xA7, 0x19, 0xF3, 0x9F, 0x72,
+    0x9F, 0x3A, 0xF7, 0x2F, 0xA3, 0xAF, 0x72, 0xF9, 0x3F, 0xA7, 0x1F, 0xC4, 0xFC, 0x70, 0xAF, 0xA4,
+    0xFD, 0xA9, 0x19, 0x9A, 0xFD, 0x94, 0xFF, 0xFF, 0xE5, 0xFF, 0xFF, 0xD9, 0x5A, 0xFF, 0xFF, 0xA7,
+    0xFF, 0xFE, 0xA7, 0x1F, 0xFF, 0xC9, 0x73, 0x9A, 0xFE, 0xA9, 0x77, 0x77, 0x10, 0x39, 0x99, 0x97,
+    0x49, 0xF7, 0x4A, 0xF7, 0x4A, 0xF7, 0x4F, 0xC7, 0x77, 0x4A, 0xD7, 0x5F, 0x73, 0xFD, 0x97, 0x0A,
+    0xFE, 0xA6, 0x9E, 0xA0, 0x9E, 0xA5, 0xE9, 0x39, 0xE7, 0x77, 0x09, 0xAE, 0xA9, 0x70, 0xFF, 0xA5,
+    0x9F, 0xFD, 0x94, 0xFA, 0x19, 0xF3, 0xF9, 0x3A, 0xE3, 0xEA, 0x4A, 0xE2, 0xAE, 0x5A, 0xE2, 0xEA,
+    0x5F, 0x2E, 0xA4, 0x9E, 0xA1, 0x9E, 0x94, 0xF2, 0x9F, 0x29, 0xFC, 0x29, 0xFF, 0xF9, 0x3F, 0xFE,
+    0xA4, 0xFF, 0xE6, 0xFF, 0xA7, 0x0A, 0xFA, 0x60, 0x77, 0x29, 0xAA, 0x77, 0x5A, 0xE7, 0x76, 0xAC,
+    0x77, 0x49, 0xDA, 0x75, 0xAD, 0x3D, 0x97, 0x6E, 0xA7, 0x73, 0xAF, 0xC7, 0x71, 0xAF, 0xE7, 0x79,
+    0xEA, 0x0A, 0xE9, 0x75, 0xEA, 0x3A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAF, 0xCA, 0x76, 0x9F,
+    0xFD, 0x97, 0x3A, 0xFF, 0xFA, 0x71, 0xFD, 0xAA, 0x9A, 0xFC, 0x97, 0xFC, 0xA4, 0x9F, 0xA6, 0xAF,
+    0xA6, 0xAF, 0x59, 0xFA, 0x79, 0xF9, 0x4F, 0xC7, 0x1F, 0x93, 0x9F, 0x97, 0x1F, 0x93, 0xAF, 0x72,
+    0xF9, 0x3F, 0xA7, 0x19, 0xF3, 0x9F, 0x72, 0x9F, 0x3A, 0xF7, 0x2F, 0xA3, 0xAF, 0x72, 0xF9, 0x3F,
+    0xA7, 0x1F, 0xC4, 0xFC, 0x70, 0xAF, 0xA4, 0xFD, 0xA9, 0x19, 0x9A, 0xFD, 0x94, 0xFF, 0xFF, 0xE5,
+    0xFF, 0xFF, 0xD9, 0x5A, 0xFF, 0xFF, 0xA7, 0xFF, 0xFE, 0xA7, 0x1F, 0xFF, 0xC9, 0x73, 0x9A, 0xFE,
+    0xA9, 0x77, 0x77, 0x10, 0x77, 0x77, 0x70, 0xEA, 0x77, 0x19, 0xF9, 0x77, 0x39, 0xC9, 0x77, 0x19,
+    0xE7, 0x71, 0xAE, 0x72, 0xAD, 0x93, 0xAC, 0x97, 0x3F, 0x77, 0x1A, 0xFC, 0x97, 0x69, 0xFE, 0xA7,
+    0x5E, 0xA1, 0xF7, 0x3E, 0x93, 0x9E, 0x97, 0x77, 0x77, 0x77, 0x09, 0xAE, 0xA9, 0x76, 0xFF, 0xA7,
+    0x39, 0xFF, 0xD9, 0x72, 0xFA, 0x19, 0xF7, 0x1F, 0x93, 0xAE, 0x71, 0xEA, 0x4A, 0xE7, 0x0A, 0xE5,
+    0xAE, 0x70, 0xEA, 0x5F, 0x70, 0xEA, 0x49, 0xEA, 0x79, 0xE9, 0x4F, 0x70, 0x9F, 0x29, 0xFC, 0x70,
+    0x9F, 0xFF, 0x97, 0x1F, 0xFE, 0xA7, 0x2F, 0xFE, 0x74, 0xFF, 0xA7, 0x6A, 0xFA, 0x74, 0x75, 0xAC,
+    0x91, 0xD7, 0x70, 0xF1, 0xD7, 0x7A, 0xFA, 0x9D, 0x77, 0xD9, 0xAF, 0xA7, 0x69, 0xD1, 0xF7, 0x70,
+    0xAA, 0x2A, 0xA7, 0x77, 0x77, 0x4D, 0x97, 0x74, 0x9E, 0x97, 0x73, 0xFC, 0xA7, 0x71, 0xFE, 0xA7,
+    0x7A, 0xE9, 0x0F, 0x75, 0x9E, 0x39, 0xE9, 0x77, 0x77, 0x59, 0xAF, 0xCA, 0x76, 0x9F, 0xFD, 0x97,
+    0x3A, 0xFF, 0xFA, 0x71, 0xFD, 0xAA, 0x9A, 0xFC, 0x97, 0xFC, 0xA4, 0x9F, 0xA6, 0xAF, 0xA6, 0xAF,
+    0x59, 0xFA, 0x79, 0xF9, 0x4F, 0xC7, 0x1F, 0x93, 0x9F, 0x97, 0x1F, 0x93, 0xAF, 0x72, 0xF9, 0x3F,
+    0xA7, 0x19, 0xF3, 0x9F, 0x72, 0x9F, 0x3A, 0xF7, 0x2F, 0xA3, 0xAF, 0x72, 0xF9, 0x3F, 0xA7, 0x1F,
+    0xC4, 0xFC, 0x70, 0xAF, 0xA4, 0xFD, 0xA9, 0x19, 0x9A, 0xFD, 0x94, 0xFF, 0xFF, 0xE5, 0xFF, 0xFF,
+    0xD9, 0x5A, 0xFF, 0xFF, 0xA7, 0xFF, 0xFE, 0xA7, 0x1F, 0xFF, 0xC9, 0x73, 0x9A, 0xFE, 0xA9, 0x77,
+    0x77, 0x10, 0x79, 0xDA, 0x1D, 0x71, 0x9F, 0x90, 0xD9, 0x70, 0xFF, 0xC7, 0x1D, 0x90, 0xF9, 0x71,
+    0xD1, 0x9D, 0xA7, 0x77, 0x77, 0x72, 0xDA, 0x76, 0x9E, 0x97, 0x5F, 0xCA, 0x73, 0xFF, 0x71, 0xAE,
+    0x90, 0xAE, 0x79, 0xE9, 0x29, 0xE9, 0x77, 0x72, 0x9A, 0xEA, 0x97, 0x2F, 0xFA, 0x79, 0xFF, 0xD9,
+    0x6F, 0xA1, 0x9F, 0x5F, 0x93, 0xAE, 0x5E, 0xA4, 0xAE, 0x4A, 0xE5, 0xAE, 0x4E, 0xA5, 0xF4, 0xEA,
+    0x49, 0xEA, 0x39, 0xE9, 0x4F, 0x49, 0xF2, 0x9F, 0xC4, 0x9F, 0xFF, 0x95, 0xFF, 0xEA, 0x6F, 0xFE,
+    0x70, 0xFF, 0xA7, 0x2A, 0xFA, 0x70, 0x73, 0xAD, 0x77, 0x5E, 0xA7, 0x73, 0xAF, 0xC7, 0x71, 0xAF,
+    0xE7, 0x79, 0xEA, 0x0A, 0xE9, 0x75, 0xEA, 0x3A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAF, 0xCA,
+    0x76, 0x9F, 0xFD, 0x97, 0x3A, 0xFF, 0xFA, 0x71, 0xFD, 0xAA, 0x9A, 0xFC, 0x97, 0xFC, 0xA4, 0x9F,
+    0xA6, 0xAF, 0xA6, 0xAF, 0x59, 0xFA, 0x79, 0xF9, 0x4F, 0xC7, 0x1F, 0x93, 0x9F, 0x97, 0x1F, 0x93,
+    0xAF, 0x72, 0xF9, 0x3F, 0xA7, 0x19, 0xF3, 0x9F, 0x72, 0x9F, 0x3A, 0xF7, 0x2F, 0xA3, 0xAF, 0x72,
+    0xF9, 0x3F, 0xA7, 0x1F, 0xC4, 0xFC, 0x70, 0xAF, 0xA4, 0xFD, 0xA9, 0x19, 0x9A, 0xFD, 0x94, 0xFF,
+    0xFF, 0xE5, 0xFF, 0xFF, 0xD9, 0x5A, 0xFF, 0xFF, 0xA7, 0xFF, 0xFE, 0xA7, 0x1F, 0xFF, 0xC9, 0x73,
+    0x9A, 0xFE, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xE9, 0x77,
+    0x3F, 0x97, 0x72, 0x9F, 0x77, 0x3A, 0xF7, 0x73, 0xFC, 0x77, 0x29, 0x99, 0x99, 0x97, 0x71, 0x7A,
+    0xD7, 0x6F, 0x74, 0xAF, 0xC7, 0x29, 0xFE, 0x97, 0x0E, 0xA0, 0x9E, 0xA6, 0xEA, 0x3A, 0xDA, 0x77,
+    0x77, 0x74, 0x9A, 0xEA, 0x97, 0x1F, 0xFA, 0x69, 0xFF, 0xD9, 0x5F, 0xA1, 0x9F, 0x4F, 0x93, 0xAE,
+    0x4E, 0xA4, 0xAE, 0x3A, 0xE5, 0xAE, 0x3E, 0xA5, 0xF3, 0xEA, 0x49, 0xEA, 0x29, 0xE9, 0x4F, 0x39,
+    0xF2, 0x9F, 0xC3, 0x9F, 0xFF, 0x94, 0xFF, 0xEA, 0x5F, 0xFE, 0x7F, 0xFA, 0x71, 0xAF, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x71, 0x99, 0x99, 0x75, 0xF7, 0x4A, 0xF7, 0x4F, 0xA7, 0x39, 0xFA, 0x73, 0xFC,
+    0x97, 0x20, 0x77, 0x77, 0x77, 0x1E, 0x77, 0x71, 0xAD, 0x77, 0x71, 0x9D, 0xA7, 0x77, 0x09, 0xE7,
+    0x77, 0x1E, 0x97, 0x77, 0x77, 0x77, 0x70, 0x9D, 0x77, 0x72, 0x9D, 0x97, 0x29, 0xAF, 0xCA, 0x6A,
+    0xD7, 0x19, 0xFF, 0xD9, 0x3A, 0xE7, 0x0A, 0xFF, 0xFA, 0x1F, 0x97, 0xFD, 0xAA, 0x9A, 0xFC, 0x90,
+    0xE9, 0x7F, 0xCA, 0x49, 0xFA, 0x0D, 0x97, 0xAF, 0xA6, 0xAF, 0x72, 0x9F, 0xA7, 0x9F, 0x97, 0x1F,
+    0xC7, 0x1F, 0x97, 0x09, 0xF9, 0x71, 0xF9, 0x70, 0xAF, 0x72, 0xF9, 0x70, 0xFA, 0x71, 0x9F, 0x70,
+    0x9F, 0x72, 0x9F, 0x70, 0xAF, 0x72, 0xFA, 0x70, 0xAF, 0x72, 0xF9, 0x70, 0xFA, 0x71, 0xFC, 0x71,
+    0xFC, 0x70, 0xAF, 0xA7, 0x1F, 0xDA, 0x91, 0x99, 0xAF, 0xD9, 0x71, 0xFF, 0xFF, 0xE7, 0x2F, 0xFF,
+    0xFD, 0x97, 0x2A, 0xFF, 0xFF, 0xA7, 0x4F, 0xFF, 0xEA, 0x76, 0xFF, 0xFC, 0x97, 0x70, 0x9A, 0xFE,
+    0xA9, 0x77, 0x77, 0x73, 0x73, 0x9D, 0x97, 0x7D, 0xA7, 0x7E, 0x77, 0xAD, 0xA7, 0x69, 0xE7, 0x77,
+    0x77, 0x3A, 0x97, 0x71, 0xDA, 0x69, 0xAE, 0xA9, 0x19, 0xD9, 0x5F, 0xFA, 0x0E, 0x49, 0xFF, 0xFC,
+    0xA4, 0xFA, 0x19, 0xFD, 0x4F, 0x93, 0xAF, 0x5E, 0xA4, 0xAE, 0x5A, 0xE5, 0xAE, 0x5E, 0xA5, 0xF5,
+    0xEA, 0x49, 0xEA, 0x49, 0xE9, 0x4F, 0x59, 0xF2, 0x9F, 0xC5, 0x9F, 0xFF, 0x96, 0xFF, 0xEA, 0x7F,
+    0xFE, 0x71, 0xFF, 0xA7, 0x3A, 0xFA, 0x71, 0x77, 0x99, 0x97, 0x77, 0x2F, 0x77, 0x71, 0x9F, 0x77,
+    0x71, 0x9F, 0x77, 0x71, 0xAF, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xD7, 0x77, 0x29, 0xD9,
+    0x72, 0x9A, 0xFC, 0xA6, 0xAD, 0x71, 0x9F, 0xFD, 0x93, 0xAE, 0x70, 0xAF, 0xFF, 0xA1, 0xF9, 0x7F,
+    0xDA, 0xA9, 0xAF, 0xC9, 0x0E, 0x97, 0xFC, 0xA4, 0x9F, 0xA0, 0xD9, 0x7A, 0xFA, 0x6A, 0xF7, 0x29,
+    0xFA, 0x79, 0xF9, 0x71, 0xFC, 0x71, 0xF9, 0x70, 0x9F, 0x97, 0x1F, 0x97, 0x0A, 0xF7, 0x2F, 0x97,
+    0x0F, 0xA7, 0x19, 0xF7, 0x09, 0xF7, 0x29, 0xF7, 0x0A, 0xF7, 0x2F, 0xA7, 0x0A, 0xF7, 0x2F, 0x97,
+    0x0F, 0xA7, 0x1F, 0xC7, 0x1F, 0xC7, 0x0A, 0xFA, 0x71, 0xFD, 0xA9, 0x19, 0x9A, 0xFD, 0x97, 0x1F,
+    0xFF, 0xFE, 0x72, 0xFF, 0xFF, 0xD9, 0x72, 0xAF, 0xFF, 0xFA, 0x74, 0xFF, 0xFE, 0xA7, 0x6F, 0xFF,
+    0xC9, 0x77, 0x09, 0xAF, 0xEA, 0x97, 0x77, 0x77, 0x30, 0x79, 0x99, 0x97, 0x7A, 0xEA, 0x77, 0xFA,
+    0x77, 0xFA, 0x76, 0x9F, 0xA7, 0x77, 0x77, 0x77, 0x4C, 0x97, 0x71, 0xDA, 0x69, 0xAE, 0xA9, 0x19,
+    0xD9, 0x5F, 0xFA, 0x0E, 0x49, 0xFF, 0xFC, 0xA4, 0xFA, 0x19, 0xFD, 0x4F, 0x93, 0xAF, 0x5E, 0xA4,
+    0xAE, 0x5A, 0xE5, 0xAE, 0x5E, 0xA5, 0xF5, 0xEA, 0x49, 0xEA, 0x49, 0xE9, 0x4F, 0x59, 0xF2, 0x9F,
+    0xC5, 0x9F, 0xFF, 0x96, 0xFF, 0xEA, 0x7F, 0xFE, 0x71, 0xFF, 0xA7, 0x3A, 0xFA, 0x71, 0x77, 0x29,
+    0xA9, 0x77, 0x72, 0xEA, 0x77, 0x73, 0xCA, 0x77, 0x71, 0x9D, 0x77, 0x71, 0x9C, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x69, 0xD9, 0x77, 0x71, 0x9D, 0x97, 0x29, 0xAF, 0xCA, 0x6A, 0xD7, 0x19, 0xFF,
+    0xD9, 0x3A, 0xE7, 0x0A, 0xFF, 0xFA, 0x1F, 0x97, 0xFD, 0xAA, 0x9A, 0xFC, 0x90, 0xE9, 0x7F, 0xCA,
+    0x49, 0xFA, 0x0D, 0x97, 0xAF, 0xA6, 0xAF, 0x72, 0x9F, 0xA7, 0x9F, 0x97, 0x1F, 0xC7, 0x1F, 0x97,
+    0x09, 0xF9, 0x71, 0xF9, 0x70, 0xAF, 0x72, 0xF9, 0x70, 0xFA, 0x71, 0x9F, 0x70, 0x9F, 0x72, 0x9F,
+    0x70, 0xAF, 0x72, 0xFA, 0x70, 0xAF, 0x72, 0xF9, 0x70, 0xFA, 0x71, 0xFC, 0x71, 0xFC, 0x70, 0xAF,
+    0xA7, 0x1F, 0xDA, 0x91, 0x99, 0xAF, 0xD9, 0x71, 0xFF, 0xFF, 0xE7, 0x2F, 0xFF, 0xFD, 0x97, 0x2A,
+    0xFF, 0xFF, 0xA7, 0x4F, 0xFF, 0xEA, 0x76, 0xFF, 0xFC, 0x97, 0x70, 0x9A, 0xFE, 0xA9, 0x77, 0x77,
+    0x73, 0x73, 0xAA, 0x77, 0x0A, 0xE7, 0x71, 0x9C, 0x77, 0x0D, 0xA7, 0x7D, 0x97, 0x77, 0x77, 0x77,
+    0x6C, 0xA7, 0x71, 0xDA, 0x69, 0xAE, 0xA9, 0x19, 0xD9, 0x5F, 0xFA, 0x0E, 0x49, 0xFF, 0xFC, 0xA4,
+    0xFA, 0x19, 0xFD, 0x4F, 0x93, 0xAF, 0x5E, 0xA4, 0xAE, 0x5A, 0xE5, 0xAE, 0x5E, 0xA5, 0xF5, 0xEA,
+    0x49, 0xEA, 0x49, 0xE9, 0x4F, 0x59, 0xF2, 0x9F, 0xC5, 0x9F, 0xFF, 0x96, 0xFF, 0xEA, 0x7F, 0xFE,
+    0x71, 0xFF, 0xA7, 0x3A, 0xFA, 0x71, 0x77, 0x0A, 0xD1, 0x9C, 0xA7, 0x74, 0xFC, 0x0A, 0xD7, 0x73,
+    0x9D, 0xAD, 0xAD, 0x97, 0x73, 0xAD, 0x0A, 0xF7, 0x74, 0xAC, 0xA1, 0xAD, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x74, 0x9D, 0x77, 0x72, 0x9D, 0x97, 0x29, 0xAF, 0xCA, 0x6A, 0xD7, 0x19, 0xFF, 0xD9, 0x3A,
+    0xE7, 0x0A, 0xFF, 0xFA, 0x1F, 0x97, 0xFD, 0xAA, 0x9A, 0xFC, 0x90, 0xE9, 0x7F, 0xCA, 0x49, 0xFA,
+    0x0D, 0x97, 0xAF, 0xA6, 0xAF, 0x72, 0x9F, 0xA7, 0x9F, 0x97, 0x1F, 0xC7, 0x1F, 0x97, 0x09, 0xF9,
+    0x71, 0xF9, 0x70, 0xAF, 0x72, 0xF9, 0x70, 0xFA, 0x71, 0x9F, 0x70, 0x9F, 0x72, 0x9F, 0x70, 0xAF,
+    0x72, 0xFA, 0x70, 0xAF, 0x72, 0xF9, 0x70, 0xFA, 0x71, 0xFC, 0x71, 0xFC, 0x70, 0xAF, 0xA7, 0x1F,
+    0xDA, 0x91, 0x99, 0xAF, 0xD9, 0x71, 0xFF, 0xFF, 0xE7, 0x2F, 0xFF, 0xFD, 0x97, 0x2A, 0xFF, 0xFF,
+    0xA7, 0x4F, 0xFF, 0xEA, 0x76, 0xFF, 0xFC, 0x97, 0x70, 0x9A, 0xFE, 0xA9, 0x77, 0x77, 0x73, 0x71,
+    0xAC, 0x91, 0xD7, 0x3F, 0x1D, 0x97, 0x1A, 0xFA, 0x9D, 0x72, 0xD9, 0xAF, 0xA7, 0x19, 0xD1, 0xF7,
+    0x3A, 0xA2, 0xAA, 0x77, 0x77, 0x71, 0xA9, 0x77, 0x1D, 0xA6, 0x9A, 0xEA, 0x91, 0x9D, 0x95, 0xFF,
+    0xA0, 0xE4, 0x9F, 0xFF, 0xCA, 0x4F, 0xA1, 0x9F, 0xD4, 0xF9, 0x3A, 0xF5, 0xEA, 0x4A, 0xE5, 0xAE,
+    0x5A, 0xE5, 0xEA, 0x5F, 0x5E, 0xA4, 0x9E, 0xA4, 0x9E, 0x94, 0xF5, 0x9F, 0x29, 0xFC, 0x59, 0xFF,
+    0xF9, 0x6F, 0xFE, 0xA7, 0xFF, 0xE7, 0x1F, 0xFA, 0x73, 0xAF, 0xA7, 0x10, 0x77, 0x77, 0x77, 0x79,
+    0xD7, 0x77, 0x29, 0xD9, 0x72, 0x9A, 0xFC, 0xA6, 0xAD, 0x71, 0x9F, 0xFD, 0x93, 0xAE, 0x70, 0xAF,
+    0xFF, 0xA1, 0xF9, 0x7F, 0xDA, 0xA9, 0xAF, 0xC9, 0x0E, 0x97, 0xFC, 0xA4, 0x9F, 0xA0, 0xD9, 0x7A,
+    0xFA, 0x6A, 0xF7, 0x29, 0xFA, 0x79, 0xF9, 0x71, 0xFC, 0x71, 0xF9, 0x70, 0x9F, 0x97, 0x1F, 0x97,
+    0x0A, 0xF7, 0x2F, 0x97, 0x0F, 0xA7, 0x19, 0xF7, 0x09, 0xF7, 0x29, 0xF7, 0x0A, 0xF7, 0x2F, 0xA7,
+    0x0A, 0xF7, 0x2F, 0x97, 0x0F, 0xA7, 0x1F, 0xC7, 0x1F, 0xC7, 0x0A, 0xFA, 0x71, 0xFD, 0xA9, 0x19,
+    0x9A, 0xFD, 0x97, 0x1F, 0xFF, 0xFE, 0x72, 0xFF, 0xFF, 0xD9, 0x72, 0xAF, 0xFF, 0xFA, 0x74, 0xFF,
+    0xFE, 0xA7, 0x6F, 0xFF, 0xC9, 0x77, 0x09, 0xAF, 0xEA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9E, 0x97, 0x77, 0x0F, 0x97, 0x77, 0x9F, 0x77, 0x70, 0xAF,
+    0x77, 0x70, 0xFC, 0x77, 0x79, 0x99, 0x99, 0x97, 0x76, 0x77, 0x1A, 0x97, 0x72, 0xDA, 0x79, 0xAE,
+    0xA9, 0x19, 0xD9, 0x6F, 0xFA, 0x0E, 0x59, 0xFF, 0xFC, 0xA5, 0xFA, 0x19, 0xFD, 0x5F, 0x93, 0xAF,
+    0x6E, 0xA4, 0xAE, 0x6A, 0xE5, 0xAE, 0x6E, 0xA5, 0xF6, 0xEA, 0x49, 0xEA, 0x59, 0xE9, 0x4F, 0x69,
+    0xF2, 0x9F, 0xC6, 0x9F, 0xFF, 0x97, 0xFF, 0xEA, 0x70, 0xFF, 0xE7, 0x2F, 0xFA, 0x74, 0xAF, 0xA7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x7A, 0xE7, 0x70, 0xF7, 0x7A, 0xF7, 0x7F, 0xA7, 0x6A, 0xFA, 0x76,
+    0x99, 0x99, 0x97, 0x70, 0x4A, 0xFC, 0x59, 0xFC, 0x5F, 0xCA, 0x5A, 0xFC, 0x5F, 0xC6, 0xFC, 0xA4,
+    0x9F, 0xC6, 0xFC, 0x5A, 0xFA, 0x59, 0xFC, 0x5F, 0xC9, 0x5A, 0xFA, 0x5F, 0xC6, 0xFC, 0x6F, 0xA6,
+    0xFC, 0x59, 0xF9, 0x59, 0xFA, 0x5A, 0xF6, 0xAF, 0x95, 0xFA, 0x6F, 0xC6, 0xF9, 0x6F, 0xA5, 0x9F,
+    0x69, 0xF9, 0x5A, 0xF6, 0xFC, 0x6F, 0xC5, 0xAF, 0xA6, 0xFE, 0xAF, 0xF7, 0xFF, 0xFF, 0x7F, 0xFF,
+    0xE9, 0x7F, 0xFF, 0xE7, 0x0A, 0xFF, 0xFC, 0x72, 0x9F, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x75, 0x99, 0x99, 0x77, 0x3F, 0x77, 0x2A, 0xF7, 0x72, 0xFA, 0x77, 0x1A, 0xF9, 0x77,
+    0x1F, 0xC9, 0x76, 0x49, 0xE5, 0xAE, 0x4A, 0xDA, 0x5E, 0xA4, 0xE9, 0x49, 0xE9, 0x4E, 0x94, 0xAE,
+    0x5E, 0x5F, 0x49, 0xE5, 0xEA, 0x4A, 0xE4, 0xAE, 0xA4, 0xAD, 0xA4, 0xF9, 0x4E, 0x93, 0x9F, 0x5E,
+    0x93, 0xFC, 0x5F, 0x91, 0xAF, 0xA5, 0xFF, 0xF9, 0x5F, 0xFF, 0x6F, 0xFF, 0x6A, 0xFF, 0xDA, 0x79,
+    0xAE, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xE7, 0x6F, 0x75, 0xAF, 0x75, 0xFC,
+    0x74, 0x9F, 0xA7, 0x49, 0x99, 0x99, 0x97, 0x40, 0x77, 0xAA, 0x77, 0x49, 0xE7, 0x75, 0x9C, 0x97,
+    0x73, 0x9D, 0x77, 0x3A, 0xD7, 0x74, 0xAC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3A,
+    0xFC, 0x59, 0xFC, 0x5F, 0xCA, 0x5A, 0xFC, 0x5F, 0xC6, 0xFC, 0xA4, 0x9F, 0xC6, 0xFC, 0x5A, 0xFA,
+    0x59, 0xFC, 0x5F, 0xC9, 0x5A, 0xFA, 0x5F, 0xC6, 0xFC, 0x6F, 0xA6, 0xFC, 0x59, 0xF9, 0x59, 0xFA,
+    0x5A, 0xF6, 0xAF, 0x95, 0xFA, 0x6F, 0xC6, 0xF9, 0x6F, 0xA5, 0x9F, 0x69, 0xF9, 0x5A, 0xF6, 0xFC,
+    0x6F, 0xC5, 0xAF, 0xA6, 0xFE, 0xAF, 0xF9, 0x6F, 0xFF, 0xF7, 0xFF, 0xFE, 0x97, 0xFF, 0xFE, 0x70,
+    0xAF, 0xFF, 0xC7, 0x29, 0xFF, 0xDA, 0x77, 0x77, 0x77, 0x70, 0x71, 0x9D, 0x97, 0x3A, 0xE7, 0x5A,
+    0xC7, 0x39, 0xD9, 0x73, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x49, 0xE5, 0xAE, 0x1A, 0xDA, 0x5E, 0xA1,
+    0xE9, 0x49, 0xE9, 0x1E, 0x94, 0xAE, 0x2E, 0x5F, 0x19, 0xE5, 0xEA, 0x1A, 0xE4, 0xAE, 0xA1, 0xAD,
+    0xA4, 0xF9, 0x1E, 0x93, 0x9F, 0x2E, 0x93, 0xFC, 0x2F, 0x91, 0xAF, 0xA2, 0xFF, 0xF9, 0x2F, 0xFF,
+    0x3F, 0xFF, 0x3A, 0xFF, 0xDA, 0x49, 0xAE, 0xA7, 0x77, 0x9D, 0x97, 0x76, 0xE7, 0x76, 0xE7, 0x76,
+    0xAD, 0xA7, 0x75, 0x9E, 0x77, 0x77, 0x09, 0x97, 0x77, 0x09, 0xD9, 0x77, 0x6A, 0xD7, 0x77, 0xE7,
+    0x75, 0x9E, 0xA5, 0xAF, 0xC5, 0x9F, 0xE6, 0xFC, 0xA5, 0xAF, 0xD7, 0xFC, 0x6F, 0xCA, 0x79, 0xFC,
+    0x6F, 0xC7, 0x0A, 0xFA, 0x59, 0xFC, 0x70, 0xFC, 0x95, 0xAF, 0xA7, 0x0F, 0xC6, 0xFC, 0x71, 0xFA,
+    0x6F, 0xC7, 0x09, 0xF9, 0x59, 0xFA, 0x70, 0xAF, 0x6A, 0xF9, 0x70, 0xFA, 0x6F, 0xC7, 0x1F, 0x96,
+    0xFA, 0x70, 0x9F, 0x69, 0xF9, 0x70, 0xAF, 0x6F, 0xC7, 0x1F, 0xC5, 0xAF, 0xA7, 0x1F, 0xEA, 0xFF,
+    0x97, 0x1F, 0xFF, 0xF7, 0x2F, 0xFF, 0xE9, 0x72, 0xFF, 0xFE, 0x73, 0xAF, 0xFF, 0xC7, 0x59, 0xFF,
+    0xDA, 0x77, 0x77, 0x77, 0x77, 0x10, 0x77, 0x76, 0xAD, 0x77, 0x9D, 0xA7, 0x7E, 0x77, 0xE9, 0x76,
+    0xAE, 0x4A, 0x97, 0x71, 0xDA, 0x77, 0x9D, 0x97, 0x69, 0xE2, 0x9E, 0x5A, 0xFC, 0xA2, 0xAD, 0xA5,
+    0xFD, 0x3E, 0x94, 0x9F, 0xA4, 0xE9, 0x4A, 0xE6, 0xE5, 0xF5, 0x9E, 0x5E, 0xA5, 0xAE, 0x4A, 0xEA,
+    0x5A, 0xDA, 0x4F, 0x95, 0xE9, 0x39, 0xF6, 0xE9, 0x3F, 0xC6, 0xF9, 0x1A, 0xFA, 0x6F, 0xFF, 0x96,
+    0xFF, 0xF7, 0xFF, 0xF7, 0xAF, 0xFD, 0xA7, 0x09, 0xAE, 0xA7, 0x30, 0x73, 0xAE, 0x97, 0x76, 0xF9,
+    0x77, 0x6F, 0x97, 0x75, 0x9F, 0x97, 0x77, 0x99, 0x97, 0x77, 0x59, 0x97, 0x77, 0x09, 0xD7, 0x77,
+    0xAD, 0x97, 0x76, 0xE7, 0x75, 0x9E, 0xA5, 0xAF, 0xC5, 0x9F, 0xE6, 0xFC, 0xA5, 0xAF, 0xD7, 0xFC,
+    0x6F, 0xCA, 0x79, 0xFC, 0x6F, 0xC7, 0x0A, 0xFA, 0x59, 0xFC, 0x70, 0xFC, 0x95, 0xAF, 0xA7, 0x0F,
+    0xC6, 0xFC, 0x71, 0xFA, 0x6F, 0xC7, 0x09, 0xF9, 0x59, 0xFA, 0x70, 0xAF, 0x6A, 0xF9, 0x70, 0xFA,
+    0x6F, 0xC7, 0x1F, 0x96, 0xFA, 0x70, 0x9F, 0x69, 0xF9, 0x70, 0xAF, 0x6F, 0xC7, 0x1F, 0xC5, 0xAF,
+    0xA7, 0x1F, 0xEA, 0xFF, 0x97, 0x1F, 0xFF, 0xF7, 0x2F, 0xFF, 0xE9, 0x72, 0xFF, 0xFE, 0x73, 0xAF,
+    0xFF, 0xC7, 0x59, 0xFF, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x10, 0x69, 0x99, 0x97, 0x7A, 0xE9, 0x77,
+    0xFA, 0x77, 0xFA, 0x76, 0x9F, 0xA7, 0x75, 0xA9, 0x77, 0x1D, 0xA7, 0x79, 0xD9, 0x76, 0x9E, 0x29,
+    0xE5, 0xAF, 0xCA, 0x2A, 0xDA, 0x5F, 0xD3, 0xE9, 0x49, 0xFA, 0x4E, 0x94, 0xAE, 0x6E, 0x5F, 0x59,
+    0xE5, 0xEA, 0x5A, 0xE4, 0xAE, 0xA5, 0xAD, 0xA4, 0xF9, 0x5E, 0x93, 0x9F, 0x6E, 0x93, 0xFC, 0x6F,
+    0x91, 0xAF, 0xA6, 0xFF, 0xF9, 0x6F, 0xFF, 0x7F, 0xFF, 0x7A, 0xFF, 0xDA, 0x70, 0x9A, 0xEA, 0x73,
+    0x77, 0xAA, 0x77, 0x79, 0xE7, 0x77, 0x09, 0xC9, 0x77, 0x69, 0xD7, 0x76, 0xAD, 0x77, 0x7A, 0xC7,
+    0x77, 0x77, 0x77, 0x39, 0xD7, 0x77, 0xAD, 0x97, 0x76, 0xE7, 0x75, 0x9E, 0xA5, 0xAF, 0xC5, 0x9F,
+    0xE6, 0xFC, 0xA5, 0xAF, 0xD7, 0xFC, 0x6F, 0xCA, 0x79, 0xFC, 0x6F, 0xC7, 0x0A, 0xFA, 0x59, 0xFC,
+    0x70, 0xFC, 0x95, 0xAF, 0xA7, 0x0F, 0xC6, 0xFC, 0x71, 0xFA, 0x6F, 0xC7, 0x09, 0xF9, 0x59, 0xFA,
+    0x70, 0xAF, 0x6A, 0xF9, 0x70, 0xFA, 0x6F, 0xC7, 0x1F, 0x96, 0xFA, 0x70, 0x9F, 0x69, 0xF9, 0x70,
+    0xAF, 0x6F, 0xC7, 0x1F, 0xC5, 0xAF, 0xA7, 0x1F, 0xEA, 0xFF, 0x97, 0x1F, 0xFF, 0xF7, 0x2F, 0xFF,
+    0xE9, 0x72, 0xFF, 0xFE, 0x73, 0xAF, 0xFF, 0xC7, 0x59, 0xFF, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x10,
+    0x71, 0x9D, 0x97, 0x7A, 0xE7, 0x71, 0xAC, 0x77, 0x9D, 0x97, 0x7D, 0x97, 0x77, 0xCA, 0x77, 0x1D,
+    0xA7, 0x79, 0xD9, 0x76, 0x9E, 0x29, 0xE5, 0xAF, 0xCA, 0x2A, 0xDA, 0x5F, 0xD3, 0xE9, 0x49, 0xFA,
+    0x4E, 0x94, 0xAE, 0x6E, 0x5F, 0x59, 0xE5, 0xEA, 0x5A, 0xE4, 0xAE, 0xA5, 0xAD, 0xA4, 0xF9, 0x5E,
+    0x93, 0x9F, 0x6E, 0x93, 0xFC, 0x6F, 0x91, 0xAF, 0xA6, 0xFF, 0xF9, 0x6F, 0xFF, 0x7F, 0xFF, 0x7A,
+    0xFF, 0xDA, 0x70, 0x9A, 0xEA, 0x73, 0x75, 0x99, 0x77, 0x7F, 0x1D, 0x77, 0x1A, 0xFA, 0x9D, 0x97,
+    0x70, 0xDA, 0x9F, 0xC7, 0x70, 0x9D, 0x1F, 0x97, 0x71, 0xAA, 0x2A, 0xA7, 0x77, 0x77, 0x77, 0x19,
+    0xD7, 0x77, 0xAD, 0x97, 0x76, 0xE7, 0x75, 0x9E, 0xA5, 0xAF, 0xC5, 0x9F, 0xE6, 0xFC, 0xA5, 0xAF,
+    0xD7, 0xFC, 0x6F, 0xCA, 0x79, 0xFC, 0x6F, 0xC7, 0x0A, 0xFA, 0x59, 0xFC, 0x70, 0xFC, 0x95, 0xAF,
+    0xA7, 0x0F, 0xC6, 0xFC, 0x71, 0xFA, 0x6F, 0xC7, 0x09, 0xF9, 0x59, 0xFA, 0x70, 0xAF, 0x6A, 0xF9,
+    0x70, 0xFA, 0x6F, 0xC7, 0x1F, 0x96, 0xFA, 0x70, 0x9F, 0x69, 0xF9, 0x70, 0xAF, 0x6F, 0xC7, 0x1F,
+    0xC5, 0xAF, 0xA7, 0x1F, 0xEA, 0xFF, 0x97, 0x1F, 0xFF, 0xF7, 0x2F, 0xFF, 0xE9, 0x72, 0xFF, 0xFE,
+    0x73, 0xAF, 0xFF, 0xC7, 0x59, 0xFF, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x10, 0x79, 0xD9, 0x1D, 0x72,
+    0x9F, 0x1D, 0x72, 0xFF, 0xC7, 0x19, 0xD0, 0x9F, 0x97, 0x19, 0xD1, 0xAD, 0x97, 0x75, 0xCA, 0x77,
+    0x1D, 0xA7, 0x79, 0xD9, 0x76, 0x9E, 0x29, 0xE5, 0xAF, 0xCA, 0x2A, 0xDA, 0x5F, 0xD3, 0xE9, 0x49,
+    0xFA, 0x4E, 0x94, 0xAE, 0x6E, 0x5F, 0x59, 0xE5, 0xEA, 0x5A, 0xE4, 0xAE, 0xA5, 0xAD, 0xA4, 0xF9,
+    0x5E, 0x93, 0x9F, 0x6E, 0x93, 0xFC, 0x6F, 0x91, 0xAF, 0xA6, 0xFF, 0xF9, 0x6F, 0xFF, 0x7F, 0xFF,
+    0x7A, 0xFF, 0xDA, 0x70, 0x9A, 0xEA, 0x73, 0x77, 0x77, 0x77, 0x19, 0xD7, 0x77, 0xAD, 0x97, 0x76,
+    0xE7, 0x75, 0x9E, 0xA5, 0xAF, 0xC5, 0x9F, 0xE6, 0xFC, 0xA5, 0xAF, 0xD7, 0xFC, 0x6F, 0xCA, 0x79,
+    0xFC, 0x6F, 0xC7, 0x0A, 0xFA, 0x59, 0xFC, 0x70, 0xFC, 0x95, 0xAF, 0xA7, 0x0F, 0xC6, 0xFC, 0x71,
+    0xFA, 0x6F, 0xC7, 0x09, 0xF9, 0x59, 0xFA, 0x70, 0xAF, 0x6A, 0xF9, 0x70, 0xFA, 0x6F, 0xC7, 0x1F,
+    0x96, 0xFA, 0x70, 0x9F, 0x69, 0xF9, 0x70, 0xAF, 0x6F, 0xC7, 0x1F, 0xC5, 0xAF, 0xA7, 0x1F, 0xEA,
+    0xFF, 0x72, 0xFF, 0xFF, 0x72, 0xFF, 0xFE, 0x97, 0x2F, 0xFF, 0xE7, 0x3A, 0xFF, 0xFC, 0x75, 0x9F,
+    0xFD, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x99, 0x99, 0x77, 0x6F, 0x77,
+    0x5A, 0xF7, 0x75, 0xFA, 0x77, 0x4A, 0xF9, 0x77, 0x4F, 0xC9, 0x77, 0x10, 0x77, 0x77, 0x72, 0xCA,
+    0x77, 0x4D, 0xA7, 0x72, 0x9D, 0x97, 0x71, 0x9E, 0x59, 0xE5, 0xAF, 0xCA, 0x5A, 0xDA, 0x5F, 0xD6,
+    0xE9, 0x49, 0xFA, 0x7E, 0x94, 0xAE, 0x71, 0xE5, 0xF7, 0x09, 0xE5, 0xEA, 0x70, 0xAE, 0x4A, 0xEA,
+    0x70, 0xAD, 0xA4, 0xF9, 0x70, 0xE9, 0x39, 0xF7, 0x1E, 0x93, 0xFC, 0x71, 0xF9, 0x1A, 0xFA, 0x71,
+    0xFF, 0xF9, 0x71, 0xFF, 0xF7, 0x2F, 0xFF, 0x72, 0xAF, 0xFD, 0xA7, 0x39, 0xAE, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xAE, 0x77, 0x2F, 0x77, 0x1A, 0xF7, 0x71, 0xFC, 0x77,
+    0x09, 0xFA, 0x77, 0x09, 0x99, 0x99, 0x97, 0x70, 0x69, 0x99, 0x77, 0x0F, 0x97, 0x7F, 0x97, 0x7F,
+    0x97, 0x69, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9F, 0x70, 0xAF, 0x1F, 0x96,
+    0x9F, 0x2F, 0xA6, 0xF9, 0x2A, 0xF5, 0xFA, 0x3A, 0xF4, 0xAF, 0x49, 0xF9, 0x2A, 0xF6, 0xFA, 0x19,
+    0xF9, 0x6F, 0xC1, 0xFA, 0x7A, 0xF9, 0xFC, 0x70, 0xAF, 0xFC, 0x71, 0x9F, 0xF9, 0x72, 0xFE, 0xA7,
+    0x3F, 0xE7, 0x4A, 0xFC, 0x75, 0xAF, 0xA7, 0x5F, 0xC9, 0x74, 0x9F, 0xC7, 0x5A, 0xFC, 0x75, 0xFC,
+    0xA7, 0x49, 0xFC, 0x97, 0x4A, 0xFC, 0x74, 0x71, 0x99, 0x99, 0x77, 0x0A, 0xEA, 0x77, 0x0F, 0xA7,
+    0x70, 0xFA, 0x77, 0x9F, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xF6, 0xF5, 0xF5,
+    0xAE, 0x6F, 0x94, 0xEA, 0x6A, 0xEA, 0x3A, 0xE7, 0x9F, 0x29, 0xE9, 0x70, 0xF9, 0x1F, 0x71, 0xFA,
+    0x09, 0xE9, 0x71, 0xAF, 0x0E, 0xA7, 0x29, 0xFF, 0x74, 0xFE, 0xA7, 0x4F, 0xE7, 0x5A, 0xFC, 0x97,
+    0x59, 0xFC, 0x77, 0xF7, 0x7A, 0xEA, 0x76, 0xAF, 0x73, 0x99, 0xAF, 0xC9, 0x72, 0xFF, 0xA7, 0x3F,
+    0xF7, 0x39, 0xFD, 0xA7, 0x4A, 0xFA, 0x76, 0x49, 0xF7, 0x0A, 0xF6, 0xF9, 0x69, 0xF7, 0xFA, 0x6F,
+    0x97, 0xAF, 0x5F, 0xA7, 0x0A, 0xF4, 0xAF, 0x71, 0x9F, 0x92, 0xAF, 0x73, 0xFA, 0x19, 0xF9, 0x73,
+    0xFC, 0x1F, 0xA7, 0x4A, 0xF9, 0xFC, 0x75, 0xAF, 0xFC, 0x76, 0x9F, 0xF9, 0x77, 0xFE, 0xA7, 0x70,
+    0xFE, 0x77, 0x1A, 0xFC, 0x77, 0x2A, 0xFA, 0x77, 0x2F, 0xC9, 0x77, 0x19, 0xFC, 0x77, 0x2A, 0xFC,
+    0x77, 0x2F, 0xCA, 0x77, 0x19, 0xFC, 0x97, 0x71, 0xAF, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xEA, 0x77, 0x3A, 0xE9, 0x77, 0x3F, 0x97, 0x72, 0xAF, 0x77,
+    0x3F, 0xC7, 0x73, 0x99, 0x99, 0x97, 0x72, 0x4F, 0x6F, 0x5F, 0x5A, 0xE6, 0xF9, 0x4E, 0xA6, 0xAE,
+    0xA3, 0xAE, 0x79, 0xF2, 0x9E, 0x97, 0x0F, 0x91, 0xF7, 0x1F, 0xA0, 0x9E, 0x97, 0x1A, 0xF0, 0xEA,
+    0x72, 0x9F, 0xF7, 0x4F, 0xEA, 0x74, 0xFE, 0x75, 0xAF, 0xC9, 0x75, 0x9F, 0xC7, 0x7F, 0x77, 0xAE,
+    0xA7, 0x6A, 0xF7, 0x39, 0x9A, 0xFC, 0x97, 0x2F, 0xFA, 0x73, 0xFF, 0x9E, 0xA6, 0x9F, 0xDA, 0x0A,
+    0xEA, 0x6A, 0xFA, 0x2F, 0x97, 0x6A, 0xF9, 0x76, 0xFC, 0x77, 0x99, 0x99, 0x97, 0x72, 0x9D, 0x97,
+    0x7A, 0xE7, 0x71, 0xAC, 0x77, 0xAD, 0x97, 0x7C, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x72, 0x9F, 0x70, 0xAF, 0x1F, 0x96, 0x9F, 0x2F, 0xA6, 0xF9, 0x2A, 0xF5, 0xFA, 0x3A, 0xF4,
+    0xAF, 0x49, 0xF9, 0x2A, 0xF6, 0xFA, 0x19, 0xF9, 0x6F, 0xC1, 0xFA, 0x7A, 0xF9, 0xFC, 0x70, 0xAF,
+    0xFC, 0x71, 0x9F, 0xF9, 0x72, 0xFE, 0xA7, 0x3F, 0xE7, 0x4A, 0xFC, 0x75, 0xAF, 0xA7, 0x5F, 0xC9,
+    0x74, 0x9F, 0xC7, 0x5A, 0xFC, 0x75, 0xFC, 0xA7, 0x49, 0xFC, 0x97, 0x4A, 0xFC, 0x74, 0x76, 0xD9,
+    0x77, 0x09, 0xE7, 0x72, 0xAC, 0x77, 0x1D, 0xA7, 0x70, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x0F, 0x6F, 0x5F, 0x5A, 0xE6, 0xF9, 0x4E, 0xA6, 0xAE, 0xA3, 0xAE,
+    0x79, 0xF2, 0x9E, 0x97, 0x0F, 0x91, 0xF7, 0x1F, 0xA0, 0x9E, 0x97, 0x1A, 0xF0, 0xEA, 0x72, 0x9F,
+    0xF7, 0x4F, 0xEA, 0x74, 0xFE, 0x75, 0xAF, 0xC9, 0x75, 0x9F, 0xC7, 0x7F, 0x77, 0xAE, 0xA7, 0x6A,
+    0xF7, 0x39, 0x9A, 0xFC, 0x97, 0x2F, 0xFA, 0x73, 0xFF, 0x73, 0x9F, 0xDA, 0x74, 0xAF, 0xA7, 0x60,
+    0x70, 0xAD, 0x91, 0xD7, 0x29, 0xF1, 0xD7, 0x2D, 0xAD, 0x9A, 0xD7, 0x19, 0xD0, 0xAF, 0x97, 0x1A,
+    0xD1, 0xF7, 0x3A, 0xA2, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xF7,
+    0x0A, 0xF1, 0xF9, 0x69, 0xF2, 0xFA, 0x6F, 0x92, 0xAF, 0x5F, 0xA3, 0xAF, 0x4A, 0xF4, 0x9F, 0x92,
+    0xAF, 0x6F, 0xA1, 0x9F, 0x96, 0xFC, 0x1F, 0xA7, 0xAF, 0x9F, 0xC7, 0x0A, 0xFF, 0xC7, 0x19, 0xFF,
+    0x97, 0x2F, 0xEA, 0x73, 0xFE, 0x74, 0xAF, 0xC7, 0x5A, 0xFA, 0x75, 0xFC, 0x97, 0x49, 0xFC, 0x75,
+    0xAF, 0xC7, 0x5F, 0xCA, 0x74, 0x9F, 0xC9, 0x74, 0xAF, 0xC7, 0x40, 0x74, 0x99, 0x77, 0x1F, 0x1D,
+    0x73, 0xAF, 0xA9, 0xD7, 0x3D, 0x99, 0xFC, 0x72, 0x9D, 0x1F, 0x97, 0x3A, 0xA2, 0xAA, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xF6, 0xF5, 0xF5, 0xAE, 0x6F, 0x94, 0xEA, 0x6A,
+    0xEA, 0x3A, 0xE7, 0x9F, 0x29, 0xE9, 0x70, 0xF9, 0x1F, 0x71, 0xFA, 0x09, 0xE9, 0x71, 0xAF, 0x0E,
+    0xA7, 0x29, 0xFF, 0x74, 0xFE, 0xA7, 0x4F, 0xE7, 0x5A, 0xFC, 0x97, 0x59, 0xFC, 0x77, 0xF7, 0x7A,
+    0xEA, 0x76, 0xAF, 0x73, 0x99, 0xAF, 0xC9, 0x72, 0xFF, 0xA7, 0x3F, 0xF7, 0x39, 0xFD, 0xA7, 0x4A,
+    0xFA, 0x76, 0x0F, 0xFF, 0x99, 0xFF, 0xF0, 0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0x99, 0xFF, 0xF0, 0xAF,
+    0xFF, 0x00, 0x1F, 0xFF, 0xFE, 0x0A, 0xFF, 0xFF, 0xD9, 0x0F, 0xFF, 0xFE, 0x00, 0x77, 0x5F, 0xFF,
+    0xFC, 0x1A, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0xC2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA1, 0x77, 0x75, 0xFF, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFC, 0x91,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x77, 0x75, 0xFF,
+    0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFC, 0x91, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x6A, 0xDA, 0x29, 0xDA, 0x6E, 0x3A, 0xD9,
+    0x6E, 0x3E, 0x69, 0xDA, 0x29, 0xE6, 0xE9, 0x2A, 0xDA, 0x6E, 0x3E, 0x69, 0xDA, 0x3E, 0x6A, 0xD9,
+    0x29, 0xDA, 0x6E, 0x3E, 0x95, 0x9E, 0x3E, 0x6A, 0xDA, 0x29, 0xE6, 0xE3, 0xAD, 0x96, 0xE3, 0xE6,
+    0x9D, 0xA3, 0xE6, 0xE9, 0x2A, 0xDA, 0x6E, 0x3E, 0x95, 0x9D, 0xA3, 0xE6, 0xAD, 0x92, 0x9D, 0xA6,
+    0xE3, 0xAD, 0x95, 0x9E, 0x3E, 0x6A, 0xDA, 0x29, 0xE6, 0xE9, 0x2A, 0xD9, 0x6A, 0xAA, 0x3A, 0xAA,
+    0x60, 0x19, 0xFF, 0xFF, 0xEA, 0x1F, 0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0xEA, 0x77, 0x77, 0x77, 0xFF,
+    0xFF, 0xF1, 0x9F, 0xFF, 0xFE, 0xA1, 0xFF, 0xFF, 0xF9, 0x10, 0x9F, 0xC9, 0x4F, 0xCA, 0x49, 0xFC,
+    0x5F, 0xC5, 0x9F, 0xA5, 0xAF, 0x95, 0xFC, 0x5A, 0xFA, 0x5A, 0xAA, 0xAA, 0x00, 0x3F, 0xD3, 0x9F,
+    0xC9, 0x3A, 0xFC, 0x4F, 0xC4, 0x9F, 0xA4, 0xFC, 0x4A, 0xFA, 0x4F, 0xC4, 0x9A, 0xAA, 0xA9, 0x40,
+    0x39, 0xFC, 0xA3, 0xAF, 0xC4, 0xFC, 0xA4, 0xFC, 0x4A, 0xF9, 0x4F, 0xC4, 0xFC, 0x93, 0xAF, 0xA4,
+    0xAA, 0xAA, 0xA4, 0x9F, 0xC9, 0x4F, 0xCA, 0x49, 0xFC, 0x5F, 0xC5, 0x9F, 0xA5, 0xAF, 0x95, 0xFC,
+    0x5A, 0xFA, 0x5A, 0xAA, 0xAA, 0x00, 0x9F, 0xC9, 0x09, 0xFC, 0xA4, 0xFC, 0xA1, 0xAF, 0xC4, 0x9F,
+    0xC2, 0xFC, 0x5F, 0xC2, 0xAF, 0x94, 0x9F, 0xA2, 0xFC, 0x5A, 0xF9, 0x1A, 0xFA, 0x5F, 0xC2, 0xFC,
+    0x5A, 0xFA, 0x19, 0xFC, 0x5A, 0xAA, 0xAA, 0x2A, 0xAA, 0xAA, 0x00, 0x3F, 0xD1, 0xFD, 0x39, 0xFC,
+    0x91, 0xFC, 0xA3, 0xAF, 0xC1, 0x9F, 0xC4, 0xFC, 0x2A, 0xF9, 0x39, 0xFA, 0x2F, 0xC4, 0xFC, 0x2F,
+    0xC9, 0x3A, 0xFA, 0x19, 0xFC, 0x4F, 0xC2, 0xFC, 0x49, 0xAA, 0xAA, 0x91, 0x9A, 0xAA, 0xA9, 0x40,
+    0x39, 0xFC, 0xA3, 0xAF, 0xC4, 0xFC, 0xA4, 0xFC, 0x4A, 0xF9, 0x4F, 0xC4, 0xFC, 0x93, 0xAF, 0xA4,
+    0xAA, 0xAA, 0xA4, 0xAF, 0xC9, 0x09, 0xFC, 0xA4, 0xFC, 0xA1, 0xAF, 0xC4, 0x9F, 0xC2, 0xFC, 0x5F,
+    0xC2, 0xAF, 0x94, 0x9F, 0xA2, 0xFC, 0x5A, 0xF9, 0x1A, 0xFA, 0x5F, 0xC2, 0xFC, 0x5A, 0xFA, 0x19,
+    0xFC, 0x5A, 0xAA, 0xAA, 0x2A, 0xAA, 0xAA, 0x00, 0x70, 0x9A, 0xAA, 0x72, 0xEA, 0x72, 0xE9, 0x71,
+    0x9E, 0x72, 0xAE, 0x72, 0xE9, 0x72, 0xE7, 0x2A, 0xE7, 0x2E, 0xA7, 0x2E, 0xA9, 0x9A, 0x2A, 0xFF,
+    0xE9, 0x09, 0xFF, 0xFA, 0x0F, 0xFF, 0xCA, 0x09, 0x99, 0x9A, 0xE9, 0x71, 0xAE, 0x72, 0xEA, 0x72,
+    0xE9, 0x71, 0x9E, 0x72, 0xAE, 0x72, 0xE9, 0x71, 0x9E, 0x72, 0xAE, 0x72, 0xEA, 0x72, 0xE9, 0x71,
+    0x9E, 0x72, 0xF7, 0x2E, 0x97, 0x19, 0xE7, 0x2A, 0xE7, 0x29, 0xDA, 0x73, 0xD9, 0x73, 0xAC, 0x74,
+    0x9C, 0x75, 0x97, 0x77, 0x10, 0x77, 0x75, 0xE7, 0x5A, 0xE7, 0x5E, 0xA7, 0x5E, 0x97, 0x49, 0xE7,
+    0x5A, 0xDA, 0x75, 0xE9, 0x75, 0xE7, 0x5A, 0xE7, 0x29, 0x99, 0xFF, 0x49, 0xFF, 0xF4, 0xFF, 0xFC,
+    0x3F, 0xFC, 0xAA, 0xA9, 0x97, 0x0E, 0x97, 0x49, 0xE7, 0x5A, 0xE7, 0x5E, 0xA7, 0x5E, 0x97, 0x49,
+    0xE7, 0x49, 0xFF, 0x5F, 0xFF, 0x4A, 0xFF, 0xF3, 0x9F, 0xF9, 0x99, 0x99, 0x70, 0xEA, 0x75, 0xE9,
+    0x74, 0x9E, 0x75, 0xEA, 0x75, 0xE9, 0x75, 0xE7, 0x6E, 0x76, 0x9C, 0xA7, 0x7C, 0x97, 0x7C, 0x77,
+    0x75, 0x70, 0xFF, 0xFC, 0x70, 0x9F, 0xFF, 0xC7, 0x0F, 0xFF, 0xD7, 0x9F, 0xFF, 0xCA, 0x7A, 0xFF,
+    0xFC, 0xA7, 0xFF, 0xFD, 0x96, 0xAF, 0xFF, 0xD9, 0x6F, 0xFF, 0xE6, 0xAF, 0xFF, 0xE6, 0xFF, 0xFF,
+    0x59, 0xFF, 0xFE, 0xA5, 0xFF, 0xFF, 0xA4, 0x9F, 0xFF, 0xF9, 0x4F, 0xFF, 0xFC, 0x93, 0x9F, 0xFF,
+    0xFC, 0x4A, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF, 0xD3, 0xAF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0xA2, 0x73,
+    0x9D, 0x95, 0xAF, 0x4F, 0xD9, 0x19, 0xFE, 0x1A, 0xFD, 0x2A, 0xEA, 0x93, 0xAC, 0xA7, 0x70, 0x29,
+    0x99, 0x92, 0xF1, 0xAE, 0xA1, 0xFA, 0x0A, 0xF9, 0x0F, 0xC9, 0x29, 0x99, 0x92, 0xF1, 0xAE, 0xA1,
+    0xFA, 0x0A, 0xF9, 0x0F, 0xC9, 0x29, 0x99, 0x94, 0x99, 0x94, 0x99, 0x99, 0x19, 0xEA, 0x3A, 0xE9,
+    0x29, 0xEA, 0x1F, 0x93, 0xF3, 0xFA, 0x09, 0xF9, 0x2A, 0xF2, 0x9F, 0x90, 0xFC, 0x3F, 0xC2, 0xAF,
+    0x99, 0xFC, 0x29, 0xFC, 0x2F, 0xC0, 0x0E, 0x0E, 0x0E, 0x77, 0x39, 0x97, 0x72, 0x9E, 0x71, 0xAC,
+    0xA5, 0xE7, 0x1C, 0x90, 0xC4, 0xE7, 0x19, 0xD9, 0xC9, 0x2E, 0x97, 0x1C, 0xAC, 0x9C, 0x2E, 0xA7,
+    0x2C, 0xA0, 0xD1, 0xAD, 0xA7, 0x3F, 0x90, 0xAE, 0x74, 0xAD, 0x90, 0x9E, 0x77, 0x19, 0xE7, 0x72,
+    0xE9, 0x77, 0x1E, 0xA7, 0x71, 0xEA, 0x77, 0x1F, 0x77, 0x1A, 0xE7, 0x71, 0xAE, 0x29, 0xA2, 0xAA,
+    0x79, 0xE9, 0x1A, 0x99, 0x90, 0xC9, 0xA9, 0x59, 0xEA, 0x19, 0xCA, 0xAA, 0x9A, 0xCA, 0x94, 0x9E,
+    0xA2, 0xAA, 0xAC, 0x9A, 0xAA, 0xC5, 0xF3, 0xAE, 0x0A, 0xE4, 0xF4, 0x9D, 0x19, 0xD4, 0xAE, 0x77,
+    0x10, 0x3F, 0xD3, 0x9F, 0xC9, 0x3A, 0xFA, 0x4F, 0xC4, 0x9F, 0xA4, 0xFC, 0x4A, 0xFA, 0x39, 0xFC,
+    0x49, 0xAA, 0xAA, 0x94, 0x3F, 0xD1, 0xFD, 0x39, 0xFC, 0x91, 0xFC, 0x93, 0xAF, 0xA1, 0x9F, 0xC4,
+    0xFC, 0x2A, 0xF9, 0x39, 0xFA, 0x2F, 0xC4, 0xFC, 0x2F, 0xC9, 0x3A, 0xFA, 0x19, 0xFA, 0x39, 0xFC,
+    0x2F, 0xC4, 0x9A, 0xAA, 0xA9, 0x19, 0xAA, 0xAA, 0x94, 0x77, 0x29, 0xD9, 0x2E, 0x2A, 0xD1, 0xAE,
+    0x2E, 0x91, 0xEA, 0x0E, 0x91, 0x9E, 0x2E, 0x90, 0xE2, 0xAD, 0x91, 0x9D, 0xA0, 0xAD, 0x92, 0xE2,
+    0xE1, 0x9C, 0xA3, 0xD9, 0x2A, 0xCA, 0x77, 0x30, 0x6D, 0xA1, 0xAE, 0x19, 0xE2, 0xE9, 0x19, 0xDA,
+    0x2A, 0xCA, 0x60, 0x73, 0xAC, 0xA1, 0xAD, 0x19, 0xE0, 0x9E, 0x2E, 0x90, 0xEA, 0x1A, 0xDA, 0x09,
+    0xE2, 0xE1, 0xE2, 0x9D, 0x2D, 0x73, 0x77, 0x39, 0xD2, 0x9D, 0x92, 0xAD, 0x2E, 0x91, 0xEA, 0x19,
+    0xE2, 0xAE, 0x19, 0xE2, 0xEA, 0x2E, 0x2E, 0x91, 0x9E, 0x2A, 0xD9, 0x19, 0xDA, 0x2E, 0x3D, 0x92,
+    0xAC, 0x93, 0xD7, 0x73, 0x6A, 0xD7, 0x2A, 0xE9, 0x70, 0xFD, 0x69, 0xFF, 0x4F, 0xA0, 0xFC, 0x2A,
+    0xAA, 0xAA, 0x19, 0xAA, 0xAA, 0x90, 0x77, 0x1C, 0x95, 0x9D, 0x5E, 0xA3, 0x9E, 0xA3, 0xAE, 0x93,
+    0xEA, 0x4A, 0xEA, 0x49, 0xF9, 0x4A, 0xF5, 0xF9, 0x5E, 0x69, 0xCA, 0x7A, 0x40, 0x73, 0xC9, 0x70,
+    0xAC, 0xA7, 0x0E, 0x96, 0x9E, 0xA7, 0xAE, 0x96, 0x9E, 0x96, 0xF5, 0xFC, 0x4A, 0xF5, 0xF9, 0x5A,
+    0xDA, 0x7D, 0x70, 0xA4, 0x77, 0x4F, 0x77, 0x73, 0x9E, 0xA7, 0x77, 0x3F, 0xA7, 0x77, 0x29, 0xF9,
+    0x77, 0x0F, 0xCA, 0x3F, 0xC9, 0x0A, 0xF9, 0x71, 0xAF, 0xC3, 0x99, 0x99, 0x99, 0xFC, 0x97, 0x3F,
+    0xD6, 0xAF, 0xC9, 0x74, 0xAF, 0xCA, 0x39, 0xFD, 0x77, 0xFD, 0x2A, 0xFD, 0x77, 0x0F, 0xE9, 0xFE,
+    0x77, 0x19, 0xFF, 0xFA, 0x76, 0x9E, 0x9F, 0xFE, 0xA3, 0xF7, 0xF9, 0x9F, 0xFC, 0x93, 0x9F, 0x69,
+    0xF1, 0xFF, 0x94, 0xAF, 0x6F, 0xC0, 0x9F, 0xE9, 0x5F, 0xA5, 0x9F, 0xC9, 0xFF, 0xA4, 0xAF, 0xA5,
+    0x99, 0x99, 0xAF, 0xFE, 0x49, 0x99, 0x99, 0x72, 0xAF, 0xFE, 0xA7, 0x72, 0xFF, 0xFD, 0x77, 0x1F,
+    0xEA, 0xAF, 0xDA, 0x76, 0x9F, 0xE9, 0x09, 0xFE, 0x97, 0x4A, 0xFE, 0x92, 0xFF, 0x73, 0xAF, 0xE4,
+    0x9F, 0xE9, 0x71, 0xFF, 0x6F, 0xF7, 0x0F, 0xF7, 0xAF, 0xE9, 0x77, 0x77, 0x77, 0x49, 0x99, 0x77,
+    0x74, 0xF7, 0x77, 0x39, 0xF7, 0x77, 0x3A, 0xF7, 0x77, 0x3F, 0xC7, 0x77, 0x2A, 0xFA, 0x77, 0x00,
+    0x77, 0x71, 0x9A, 0x74, 0xAC, 0x97, 0x3E, 0x72, 0x9E, 0x72, 0xEA, 0x72, 0xE9, 0x71, 0xAE, 0x72,
+    0xEA, 0x72, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x72, 0xF7, 0x19, 0xEA, 0x71,
+    0xAE, 0x97, 0x2E, 0x74, 0xD7, 0x59, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0xF7, 0x1F, 0xC7, 0x09,
+    0xFC, 0x70, 0xFD, 0x79, 0xFD, 0x7A, 0xFC, 0xA7, 0xFD, 0xA6, 0x77, 0x77, 0xA7, 0x71, 0x9C, 0x77,
+    0x1A, 0xCA, 0x77, 0x0E, 0x77, 0x9E, 0x77, 0xAE, 0x75, 0x9F, 0xE9, 0x70, 0x9F, 0xFD, 0x96, 0xAF,
+    0xEA, 0xF6, 0x9F, 0xE1, 0xEA, 0x6A, 0xA0, 0xEA, 0x1E, 0xA7, 0x09, 0xE9, 0x1E, 0xA7, 0x0A, 0xE2,
+    0xEA, 0x70, 0xF1, 0x9E, 0x97, 0x0E, 0xA1, 0xAE, 0x70, 0x9E, 0x91, 0xEA, 0x70, 0xAE, 0x09, 0xF7,
+    0x1F, 0xAF, 0x97, 0x09, 0xFF, 0xA7, 0x1A, 0xFE, 0x97, 0x3F, 0xCA, 0x75, 0xFA, 0x75, 0x9F, 0x97,
+    0x5F, 0xC7, 0x6F, 0xC7, 0x5A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xAE, 0x97, 0x5A, 0xF9,
+    0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x5A, 0xFC, 0x75, 0xFD, 0x74, 0x9F, 0xD7, 0x4A, 0xFC, 0xA7, 0x4F,
+    0xDA, 0x73, 0x0F, 0xFF, 0xA9, 0xFF, 0xF9, 0xAF, 0xFF, 0x00, 0x75, 0xAD, 0xA3, 0xAD, 0xA0, 0xAF,
+    0xFD, 0x19, 0xFF, 0xC9, 0x2A, 0xFE, 0x95, 0x99, 0x99, 0x40, 0x71, 0xAA, 0x74, 0x90, 0x9C, 0xA0,
+    0x99, 0x70, 0xAC, 0xAA, 0xCA, 0xAC, 0xA7, 0x0F, 0xEA, 0x72, 0xAF, 0x97, 0x2A, 0xFD, 0xA7, 0x0A,
+    0xFA, 0xDA, 0x71, 0xA0, 0xD9, 0x0A, 0xAA, 0x69, 0xCA, 0x0D, 0x90, 0xAC, 0xA0, 0x99, 0x1A, 0x0A,
+    0xC9, 0x9E, 0xAD, 0xAD, 0x90, 0xFF, 0xFE, 0xA1, 0xAF, 0xCA, 0x1A, 0xF4, 0xAF, 0x90, 0xAF, 0xDA,
+    0x0A, 0xFF, 0xFA, 0xDA, 0x0A, 0xC9, 0xD0, 0xAC, 0x9A, 0x0D, 0x19, 0x4D, 0x5C, 0xA7, 0x97, 0x50,
+    0x77, 0x39, 0x97, 0x73, 0xE7, 0x72, 0xE7, 0x72, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xAD, 0xA7, 0x71,
+    0xAE, 0x77, 0x19, 0xE7, 0x71, 0x9E, 0x77, 0x2E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0xA7, 0x71, 0xF7,
+    0x71, 0xAE, 0x77, 0x1A, 0xE7, 0x71, 0xAE, 0x97, 0x70, 0x9E, 0x97, 0x70, 0x9E, 0xA7, 0x71, 0xF7,
+    0x71, 0xF7, 0x71, 0xF7, 0x71, 0xF9, 0x77, 0x00, 0x77, 0x77, 0x71, 0x9A, 0xEA, 0x97, 0x09, 0xF9,
+    0x71, 0x9F, 0xFC, 0x5F, 0xFC, 0x96, 0xFF, 0xEA, 0x2A, 0xFF, 0xE5, 0xAF, 0xA9, 0x1A, 0xE9, 0x1F,
+    0xC9, 0x90, 0x9E, 0xA5, 0xD9, 0x5E, 0xA1, 0xAC, 0xA5, 0xAE, 0x59, 0x7E, 0xA2, 0x96, 0x9E, 0x76,
+    0xEA, 0x72, 0xAE, 0x75, 0x9E, 0x97, 0x2F, 0x75, 0xAE, 0x73, 0xEA, 0x75, 0xF7, 0x2A, 0xE7, 0x5F,
+    0x97, 0x19, 0xF7, 0x39, 0xFA, 0x71, 0xAF, 0x72, 0x9F, 0xD7, 0x9A, 0xFC, 0x97, 0x09, 0xFD, 0xA7,
+    0xFE, 0x97, 0x1F, 0xD9, 0x79, 0xFC, 0xA7, 0x3F, 0xA7, 0x1A, 0xF7, 0x49, 0xF9, 0x71, 0xFC, 0x74,
+    0xAF, 0x71, 0x9F, 0xA7, 0x4F, 0xC7, 0x1A, 0xF9, 0x73, 0xAE, 0xA7, 0x2E, 0xA9, 0x74, 0x99, 0x75,
+    0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0x99, 0x97, 0x39, 0x99, 0x76, 0xF7, 0x2A,
+    0xE9, 0x74, 0xAF, 0x72, 0xF7, 0x5F, 0xA7, 0x1A, 0xF7, 0x49, 0xFA, 0x71, 0xFC, 0x74, 0xFC, 0x97,
+    0x09, 0xFC, 0x73, 0x77, 0x77, 0x49, 0xAE, 0xA7, 0x3A, 0x7A, 0xFF, 0xA7, 0x09, 0xCA, 0x49, 0xFF,
+    0xEA, 0x7A, 0xD9, 0x3F, 0xCA, 0x91, 0xF7, 0xE5, 0xD9, 0x5E, 0x95, 0x9E, 0x59, 0x7E, 0x95, 0xEA,
+    0x76, 0xE9, 0x5E, 0x97, 0x59, 0xE5, 0x9E, 0x76, 0xF5, 0xF7, 0x59, 0xEA, 0x5E, 0x97, 0x5F, 0x5A,
+    0xE7, 0x49, 0xF9, 0x5F, 0x72, 0xAF, 0xCA, 0x59, 0xEA, 0x70, 0xAF, 0xDA, 0x6A, 0xE9, 0x70, 0xFD,
+    0x97, 0xF7, 0x09, 0xFA, 0x70, 0x9E, 0xA7, 0x0A, 0xF7, 0x2A, 0xD9, 0x70, 0xFC, 0x73, 0xAC, 0x70,
+    0x9F, 0xA7, 0x49, 0x70, 0xF9, 0x77, 0x7A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x99,
+    0x99, 0x72, 0xFA, 0x79, 0xEA, 0x71, 0xAF, 0xA7, 0xFA, 0x71, 0xFC, 0x97, 0xF9, 0x70, 0x9F, 0xC7,
+    0xAF, 0x97, 0x0F, 0xD7, 0xFC, 0x70, 0x9F, 0xD7, 0x75, 0xFE, 0x60, 0x77, 0x77, 0x69, 0x93, 0x9A,
+    0xEA, 0x77, 0xD1, 0xAF, 0xFA, 0x75, 0xFF, 0xFD, 0x97, 0x3A, 0xFE, 0x99, 0x09, 0xF7, 0x3E, 0xAD,
+    0x94, 0x9E, 0x73, 0xE0, 0x97, 0xE9, 0x71, 0xAE, 0x70, 0x9E, 0x97, 0x1E, 0xA7, 0x0A, 0xE7, 0x19,
+    0xE9, 0x70, 0xF7, 0x1A, 0xE7, 0x09, 0xE9, 0x71, 0xEA, 0x70, 0xF7, 0x19, 0xE9, 0x69, 0xF9, 0x71,
+    0xF5, 0xAF, 0xCA, 0x72, 0xF3, 0xAF, 0xD9, 0x72, 0x9E, 0xA3, 0xFD, 0x74, 0xF9, 0x29, 0xF9, 0x76,
+    0xE3, 0xAF, 0x77, 0x0C, 0xA3, 0xFC, 0x77, 0x19, 0x29, 0xFA, 0x77, 0x5E, 0xA9, 0x77, 0x6A, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9F, 0x39, 0x99, 0x97, 0x6F, 0xC2, 0x9E, 0xA7, 0x59, 0xFC,
+    0x2F, 0x97, 0x5F, 0xD1, 0x9F, 0x97, 0x49, 0xFC, 0xA1, 0xFC, 0x75, 0xFD, 0xA1, 0xFC, 0x75, 0xFD,
+    0x97, 0x73, 0x77, 0x77, 0x77, 0x69, 0xC7, 0x77, 0x09, 0xD9, 0x77, 0x79, 0xE7, 0x77, 0x0E, 0x97,
+    0x77, 0xAE, 0x77, 0x70, 0xE9, 0x77, 0x7A, 0xE7, 0x77, 0x0E, 0x77, 0x70, 0xEA, 0x74, 0x99, 0x99,
+    0x69, 0xE7, 0x5F, 0x6E, 0xA7, 0x49, 0xF5, 0x9E, 0x75, 0xFC, 0x5E, 0xA7, 0x49, 0xFA, 0x4A, 0xE7,
+    0x5F, 0xCA, 0x4E, 0x97, 0x77, 0xAE, 0x77, 0x79, 0xE9, 0x77, 0x7F, 0x77, 0x79, 0xE9, 0x77, 0x7F,
+    0x77, 0x79, 0xE7, 0x77, 0x0E, 0xA7, 0x77, 0xAE, 0x77, 0x70, 0xEA, 0x77, 0x7A, 0xE0, 0xAE, 0x97,
+    0x71, 0x9E, 0xA0, 0xF7, 0x72, 0xF0, 0x9F, 0x77, 0x19, 0xE9, 0x0F, 0xC7, 0x71, 0xF0, 0x9F, 0xC7,
+    0x70, 0xAE, 0x90, 0x99, 0x99, 0x99, 0x77, 0x0F, 0x77, 0x7A, 0xE9, 0x77, 0x7F, 0x77, 0x7F, 0x77,
+    0x79, 0xEA, 0x77, 0x7F, 0x77, 0x79, 0xEA, 0x77, 0x7F, 0x77, 0x7A, 0xEA, 0x77, 0x7E, 0x97, 0x77,
+    0xAC, 0xA7, 0x77, 0x1C, 0x97, 0x77, 0x19, 0x77, 0x72, 0x3A, 0xD9, 0x3D, 0x09, 0xC2, 0xAC, 0x2C,
+    0x91, 0xD9, 0xC9, 0xC9, 0x09, 0xCA, 0xDA, 0xC1, 0xAC, 0x9C, 0xAD, 0x1A, 0xC9, 0x0A, 0xCA, 0x1A,
+    0xFC, 0x29, 0xF9, 0x39, 0xAA, 0x30, 0x5A, 0x5D, 0x4E, 0x3C, 0xAC, 0xA2, 0xC9, 0x9C, 0x91, 0xD9,
+    0xDA, 0x0F, 0xE3, 0xAC, 0xA4, 0xD9, 0x10, 0x29, 0xAA, 0xAA, 0x92, 0xFC, 0x91, 0x9C, 0x6A, 0xC6,
+    0xFA, 0x3C, 0xAA, 0xD9, 0x59, 0xCA, 0x1A, 0x90, 0x9D, 0x91, 0xFD, 0x19, 0xFC, 0x39, 0x99, 0x93,
+    0x4A, 0xAA, 0xA2, 0x9F, 0xA1, 0x9C, 0xA5, 0xD9, 0xA9, 0x29, 0xFC, 0x91, 0xAD, 0x09, 0xD1, 0xD2,
+    0xCA, 0x1D, 0x1A, 0xC9, 0x1F, 0xD3, 0xAD, 0xA2, 0x79, 0xFD, 0x99, 0xAA, 0xAA, 0xD4, 0x9C, 0xA4,
+    0xD4, 0xAD, 0x4D, 0x93, 0xAD, 0x4D, 0xA3, 0xE4, 0xAA, 0xA3, 0x73, 0x9F, 0x29, 0xCA, 0x09, 0xC9,
+    0x1A, 0xC1, 0xAC, 0x29, 0xF9, 0x2A, 0xCA, 0xD9, 0x1D, 0x2C, 0xA1, 0xD1, 0xAC, 0xA1, 0xFD, 0x29,
+    0xEA, 0x73, 0x49, 0x5F, 0xA2, 0xD1, 0xAC, 0x19, 0xC2, 0x9C, 0x1A, 0xC2, 0xD1, 0xAF, 0xD2, 0xAF,
+    0xA5, 0xD1, 0x9F, 0xCA, 0x1A, 0xF9, 0x73, 0x77, 0x69, 0xDA, 0x9A, 0xEA, 0x7A, 0xFF, 0xD6, 0xFF,
+    0xE9, 0x49, 0xFC, 0x90, 0x9E, 0xA4, 0xAE, 0xA3, 0x9D, 0xA4, 0xF4, 0xAD, 0xA3, 0x9E, 0x94, 0xEA,
+    0x3A, 0xE4, 0x9E, 0x93, 0xF4, 0xAE, 0x39, 0xEA, 0x4F, 0x3A, 0xEA, 0x39, 0xF3, 0xF9, 0x3A, 0xEA,
+    0x29, 0xF4, 0xF9, 0x2A, 0xF3, 0x9F, 0x92, 0xFC, 0x3A, 0xF2, 0x39, 0xDA, 0x4A, 0xC9, 0x0C, 0xA2,
+    0x9C, 0xA1, 0xCA, 0x2A, 0xC9, 0xC0, 0xCA, 0x2D, 0xAC, 0x9C, 0xA1, 0x9C, 0xA9, 0xAA, 0xC9, 0x19,
+    0xCA, 0x09, 0xD2, 0xAF, 0xCA, 0x29, 0xFC, 0x4A, 0xDA, 0x30, 0x39, 0xAA, 0x2E, 0xA2, 0xE9, 0x3D,
+    0x39, 0xD3, 0xAC, 0xA3, 0xD4, 0xD1, 0x9F, 0xDA, 0xFC, 0xA6, 0x29, 0xAA, 0xA9, 0x39, 0xFC, 0x92,
+    0x9A, 0x19, 0xCA, 0x69, 0xCA, 0x6D, 0x59, 0xDA, 0x4A, 0xDA, 0x39, 0xEA, 0x4F, 0xD9, 0x1A, 0xFD,
+    0x74, 0x39, 0x99, 0x5F, 0xC9, 0x39, 0x2C, 0xA6, 0x9C, 0x93, 0xAE, 0x94, 0xAA, 0xDA, 0x69, 0xCA,
+    0x2A, 0xCA, 0xAD, 0xA2, 0xFD, 0x29, 0xFA, 0x30, 0x6A, 0x95, 0xD5, 0xE4, 0xC9, 0xD3, 0xCA, 0x9C,
+    0xA2, 0xD9, 0xAC, 0xA1, 0xFE, 0x90, 0x99, 0x9A, 0xDA, 0x4A, 0xCA, 0x5D, 0xA1, 0x29, 0x99, 0x99,
+    0x92, 0xFC, 0x91, 0x9C, 0x95, 0xAC, 0x6F, 0xA3, 0xAA, 0xAD, 0x95, 0x9C, 0xA1, 0xAA, 0x9A, 0xD2,
+    0xFC, 0xA2, 0xF9, 0x20, 0x4A, 0xAA, 0xA3, 0x9F, 0xC2, 0x9C, 0xA6, 0xD9, 0xA9, 0x39, 0xFC, 0xA2,
+    0xAD, 0x1D, 0x2D, 0x91, 0xD2, 0xD1, 0xAC, 0xA2, 0xAF, 0xC4, 0xEA, 0x30, 0x0A, 0xAA, 0xAA, 0xA9,
+    0x9F, 0xD9, 0x4D, 0x4A, 0xC9, 0x4D, 0x4D, 0xA3, 0x9D, 0x4E, 0x39, 0xD9, 0x3E, 0x73, 0x39, 0xE9,
+    0x3A, 0xCA, 0x9D, 0x3C, 0xA1, 0xD2, 0x9C, 0xA0, 0x9C, 0xA3, 0xAF, 0x39, 0xFC, 0x29, 0xCA, 0x1A,
+    0xC2, 0xD9, 0x09, 0xD2, 0xFD, 0xA3, 0xFA, 0x74, 0x49, 0x95, 0x9F, 0x92, 0x9C, 0x91, 0xCA, 0x2C,
+    0xA2, 0xD2, 0xC9, 0x1A, 0xCA, 0x2F, 0xD9, 0x29, 0xFC, 0x69, 0xCA, 0x2F, 0xD3, 0xFA, 0x75, 0x74,
+    0xAC, 0xA9, 0x74, 0xAE, 0x97, 0x3A, 0xEA, 0x73, 0xAE, 0xA7, 0x39, 0xF7, 0x4F, 0x74, 0xF9, 0x73,
+    0x9E, 0xA7, 0x4F, 0x74, 0xAE, 0x97, 0x39, 0xEA, 0x74, 0xF7, 0x49, 0xEA, 0x74, 0xAE, 0x75, 0xEA,
+    0x74, 0x9E, 0x97, 0x4F, 0x75, 0xEA, 0x74, 0x9E, 0xA7, 0x4A, 0xE9, 0x74, 0xAE, 0x75, 0xF7, 0x5F,
+    0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x97, 0x4F, 0x97, 0x4A, 0xEA, 0x74, 0xAF, 0x74, 0x9F, 0x75,
+    0xF9, 0x74, 0xFC, 0x74, 0x9F, 0x77, 0x09, 0x71, 0x09, 0xAC, 0xA7, 0x4A, 0xEA, 0x74, 0xAE, 0xA7,
+    0x4F, 0x97, 0x4F, 0x97, 0x4F, 0x74, 0x9E, 0xA7, 0x4A, 0xE9, 0x74, 0xF7, 0x49, 0xEA, 0x74, 0xF7,
+    0x5E, 0xA7, 0x4A, 0xE7, 0x5E, 0xA7, 0x4F, 0x74, 0x9E, 0x97, 0x4E, 0xA7, 0x4F, 0x74, 0xAE, 0x74,
+    0x9E, 0x97, 0x39, 0xEA, 0x74, 0xEA, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x73, 0x9E, 0xA7, 0x3A,
+    0xEA, 0x73, 0xFA, 0x73, 0xF9, 0x72, 0x9F, 0x73, 0xAF, 0x73, 0xFA, 0x73, 0xF9, 0x73, 0x95, 0x76,
+    0x9D, 0x1A, 0xCA, 0x76, 0xE0, 0x9D, 0x97, 0x59, 0xD9, 0x0A, 0xD7, 0x6E, 0x1D, 0x97, 0x59, 0xD9,
+    0x09, 0xD7, 0x6A, 0xD1, 0xD9, 0x74, 0x9A, 0xEA, 0x9D, 0xA7, 0x29, 0xFF, 0xDA, 0x71, 0xFF, 0xF9,
+    0x79, 0xFF, 0xFC, 0x79, 0xFF, 0xFC, 0xA7, 0xFF, 0x1D, 0xA7, 0x0F, 0xFC, 0x09, 0xD9, 0x79, 0xFC,
+    0xAD, 0x90, 0xE7, 0x0F, 0xC9, 0xE0, 0x9D, 0x97, 0xAF, 0xA9, 0xD9, 0x0E, 0x70, 0xFC, 0x9A, 0xD1,
+    0xD9, 0x79, 0xFC, 0x0D, 0xA0, 0xAD, 0x70, 0xAF, 0xAA, 0xD1, 0xDA, 0x70, 0xFF, 0xA0, 0xAD, 0x71,
+    0xFF, 0x1D, 0xA7, 0x1F, 0xF0, 0xAD, 0xAA, 0xC9, 0x6F, 0xFF, 0xE9, 0x6A, 0xFF, 0xFD, 0x79, 0xFF,
+    0xFD, 0x70, 0xFF, 0xFC, 0xA7, 0x1F, 0xFF, 0xA7, 0x1A, 0xFF, 0xE9, 0x71, 0xD9, 0x0A, 0xD7, 0x6A,
+    0xD1, 0xDA, 0x76, 0xDA, 0x0A, 0xD7, 0x6A, 0xD1, 0xDA, 0x76, 0xAA, 0x90, 0x9A, 0xA7, 0x60, 0x77,
+    0x77, 0x19, 0xAF, 0xDA, 0x97, 0x1A, 0xFF, 0xDA, 0x70, 0xFF, 0xF9, 0x69, 0xFF, 0xFC, 0x69, 0xFF,
+    0xCA, 0xEA, 0x6F, 0xDA, 0x75, 0xFD, 0x76, 0x9F, 0xC7, 0x7F, 0xC9, 0x76, 0x9F, 0xC7, 0x7F, 0xC9,
+    0x2A, 0xDA, 0xDA, 0x5F, 0xC3, 0xFD, 0xA4, 0xAF, 0xC3, 0xFA, 0xAA, 0x4F, 0xCA, 0x29, 0xE7, 0x0F,
+    0xD2, 0xE7, 0x1F, 0xE9, 0x9E, 0x9A, 0xC9, 0x5F, 0xFF, 0xE9, 0x5F, 0xFF, 0xE6, 0x9F, 0xFF, 0xD7,
+    0xFF, 0xFC, 0xA7, 0x9F, 0xFF, 0xA7, 0x1A, 0xFF, 0xD9, 0x40, 0x77, 0x77, 0x76, 0x9A, 0xF9, 0x72,
+    0xFF, 0xC7, 0x9F, 0xFD, 0xA6, 0xF9, 0x29, 0xE6, 0xE7, 0x4A, 0xFF, 0xF5, 0xFF, 0xFC, 0x5F, 0xFF,
+    0xA7, 0x0E, 0x77, 0xE7, 0x4F, 0xFF, 0x94, 0x9F, 0xFF, 0x59, 0xAA, 0xAF, 0xAA, 0xAA, 0xA7, 0x1E,
+    0x97, 0x59, 0xE9, 0x74, 0xAF, 0x72, 0x9A, 0xFC, 0x97, 0x2F, 0xFD, 0xA9, 0x94, 0x9F, 0xFF, 0xC9,
+    0x3A, 0xFF, 0xFD, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x30, 0x77, 0x5F, 0x74, 0xFA,
+    0x6F, 0x73, 0xAF, 0xA5, 0x9E, 0xA7, 0x3F, 0xD5, 0xF7, 0x39, 0xFD, 0x5F, 0x73, 0xAF, 0xD9, 0x3A,
+    0xEA, 0x73, 0xFE, 0xA3, 0xF7, 0x39, 0xFF, 0x3F, 0x73, 0xAF, 0xF2, 0xAE, 0xA7, 0x3F, 0xAF, 0x2F,
+    0x96, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xD9, 0x1A, 0xAA, 0xAA, 0xFC, 0xAA, 0xFA, 0xFA,
+    0xAA, 0xA9, 0x69, 0xFC, 0x09, 0xF9, 0xF7, 0x3F, 0xCA, 0x1F, 0xFA, 0x73, 0xFC, 0x91, 0xFF, 0x97,
+    0x2A, 0xFC, 0x2F, 0xF7, 0x3F, 0xD2, 0xAF, 0xDA, 0x72, 0x9F, 0xCA, 0x29, 0xFD, 0x97, 0x2A, 0xFC,
+    0x92, 0x9F, 0xD7, 0x3F, 0xD4, 0xFC, 0xA7, 0x00, 0x77, 0x76, 0x9F, 0xFA, 0x75, 0xFF, 0xE7, 0x4F,
+    0xFF, 0x72, 0x9E, 0x93, 0xAE, 0x95, 0xAF, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0xFA, 0x59, 0xEA, 0x4A,
+    0xE9, 0x70, 0xAE, 0xA9, 0x9A, 0xAF, 0xC7, 0x1F, 0xFF, 0xCA, 0x70, 0x9F, 0xFF, 0xC7, 0x1A, 0xFF,
+    0xF7, 0x2F, 0xFE, 0xA7, 0x29, 0xFF, 0xA9, 0x74, 0xAF, 0x77, 0x2F, 0xA7, 0x71, 0x9F, 0xA7, 0x71,
+    0xAF, 0x97, 0x71, 0xFC, 0x77, 0x19, 0xFC, 0x77, 0x1A, 0xFA, 0x77, 0x1F, 0xCA, 0x77, 0x00, 0x5A,
+    0xFC, 0xA7, 0x76, 0xFF, 0x97, 0x74, 0xFF, 0xC7, 0x73, 0x9D, 0x3A, 0xD7, 0x73, 0xAD, 0x39, 0xD7,
+    0x73, 0xDA, 0x3A, 0xD7, 0x72, 0x9D, 0x93, 0xE7, 0x9F, 0xA4, 0xAD, 0x29, 0xE9, 0x69, 0xFD, 0x93,
+    0xFF, 0xD7, 0xDA, 0x99, 0xAC, 0x4F, 0xFC, 0xA6, 0x9D, 0x70, 0x9F, 0xFA, 0x79, 0xD7, 0x0A, 0xFF,
+    0x97, 0x0D, 0x97, 0xFA, 0x9A, 0xE7, 0x0F, 0xC5, 0xEA, 0x2E, 0x70, 0x9F, 0xC9, 0x29, 0xE9, 0x2E,
+    0x72, 0xAF, 0x2A, 0xE9, 0x19, 0xE9, 0x73, 0xE2, 0xF2, 0xAE, 0x97, 0x3E, 0x91, 0xF2, 0xF9, 0x59,
+    0xC9, 0x1A, 0xE9, 0x09, 0xF2, 0xF9, 0x49, 0xFF, 0xC1, 0xAF, 0x2F, 0xA4, 0xFF, 0xC9, 0x1F, 0xA1,
+    0x9F, 0xA4, 0xFF, 0xA2, 0x99, 0x99, 0x39, 0x99, 0x96, 0x9F, 0xA7, 0x77, 0x71, 0x2A, 0xD9, 0x71,
+    0xE5, 0xAD, 0xA7, 0x09, 0xDA, 0x5A, 0xD9, 0x70, 0xAD, 0x95, 0xAD, 0x97, 0x0E, 0x6A, 0xD9, 0x70,
+    0xDA, 0x6A, 0xD9, 0x7A, 0xD9, 0x6A, 0xD9, 0x19, 0xD2, 0xE5, 0x9F, 0xFF, 0xFF, 0x90, 0xFF, 0xFF,
+    0xFC, 0x1A, 0xAF, 0xFD, 0xAF, 0xAA, 0xA9, 0x3E, 0x90, 0xF9, 0x0E, 0x70, 0xE9, 0xAF, 0xA9, 0xDA,
+    0x70, 0xE9, 0xFC, 0xAA, 0xD9, 0x70, 0xFF, 0xFC, 0x71, 0xFD, 0xAF, 0xCA, 0x71, 0xFD, 0x0F, 0xC9,
+    0x71, 0xFC, 0xA0, 0xFC, 0x72, 0xFC, 0x90, 0xFC, 0x72, 0xFC, 0x1F, 0xA7, 0x2F, 0xA1, 0xF9, 0x72,
+    0xF2, 0xF7, 0x3F, 0x2E, 0xA7, 0x00, 0x4C, 0xAA, 0x99, 0x97, 0x70, 0x9F, 0xFA, 0x75, 0xAF, 0xFD,
+    0x4E, 0x4F, 0xFE, 0xA3, 0xE4, 0xF9, 0x3E, 0x29, 0xDA, 0x39, 0xE5, 0xAD, 0x2A, 0xD9, 0x3E, 0x6A,
+    0xD2, 0xE4, 0xE0, 0x9A, 0x99, 0x1E, 0x19, 0xE3, 0x9D, 0xA0, 0xAD, 0xA1, 0xDA, 0x1A, 0xDA, 0x3A,
+    0xD9, 0x0E, 0x90, 0x9D, 0x91, 0xE9, 0x3E, 0x1E, 0x1A, 0xD9, 0x1E, 0x4D, 0xA0, 0x9E, 0x1A, 0xAC,
+    0x1A, 0xE3, 0x9D, 0x90, 0x9E, 0x6E, 0xA3, 0xAD, 0x1A, 0xE5, 0x9E, 0x4E, 0x1A, 0xEA, 0x39, 0xF4,
+    0xDA, 0x19, 0xFC, 0xAA, 0xFC, 0xA3, 0x9D, 0x92, 0xAF, 0xFE, 0x94, 0x99, 0x49, 0xAF, 0xFC, 0x77,
+    0x09, 0x9A, 0xAE, 0x40, 0x77, 0x99, 0x97, 0x72, 0xDA, 0x76, 0x99, 0x9A, 0xDA, 0x99, 0x73, 0xAF,
+    0xFC, 0x97, 0x2F, 0xFD, 0x76, 0x9D, 0x97, 0x4A, 0xDA, 0x9E, 0x73, 0x9F, 0xFC, 0x72, 0x9F, 0xFC,
+    0xA7, 0x19, 0xE2, 0xF7, 0x2E, 0x3F, 0x72, 0xD9, 0x3E, 0xA7, 0x1A, 0xD3, 0x9E, 0x97, 0x1A, 0xD3,
+    0xF7, 0x2A, 0xFF, 0xD7, 0x29, 0xFF, 0xCA, 0x73, 0xFF, 0xC9, 0x74, 0xAE, 0x9A, 0xD7, 0x77, 0x79,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x96, 0xAF, 0xFF, 0xCA, 0x6F, 0xFF, 0xD9, 0x50, 0x77, 0x77,
+    0x77, 0x19, 0xAF, 0xDA, 0x71, 0xFF, 0xD7, 0x0F, 0xFD, 0xA7, 0xFF, 0xE9, 0x6A, 0xFA, 0x75, 0xFA,
+    0x09, 0x99, 0x79, 0xFF, 0xE7, 0xFF, 0xF6, 0xFF, 0xFC, 0x70, 0x9E, 0x97, 0x6A, 0xE7, 0x7F, 0xFC,
+    0x97, 0xFF, 0xE9, 0x6A, 0xFF, 0xE9, 0x59, 0xFE, 0x99, 0x74, 0xAF, 0x76, 0xAF, 0xC9, 0x74, 0xAF,
+    0xFD, 0xA7, 0x9F, 0xFD, 0x97, 0x0F, 0xFD, 0x72, 0xAF, 0xEA, 0x74, 0x9A, 0xAA, 0xAA, 0x60, 0x19,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xD9,
+    0x0F, 0xFF, 0xFD, 0x09, 0xFF, 0xFF, 0xD7, 0xAE, 0xA1, 0x97, 0x3F, 0xAA, 0xD7, 0x29, 0xFE, 0x97,
+    0x19, 0xFF, 0x70, 0xAF, 0xFA, 0x97, 0x9F, 0xEA, 0x72, 0xAF, 0xE7, 0x3D, 0x9F, 0xC0, 0xAC, 0x73,
+    0xFF, 0x72, 0x9F, 0xEA, 0x70, 0x9A, 0xFF, 0x70, 0xFF, 0xA7, 0x19, 0xFE, 0xA7, 0x2A, 0xFE, 0x97,
+    0x2A, 0x90, 0xFC, 0x76, 0xFC, 0x75, 0xAF, 0xC7, 0x30, 0x77, 0x77, 0x29, 0xFF, 0xA7, 0x70, 0xAF,
+    0xFD, 0x77, 0xFF, 0xF7, 0x59, 0xEA, 0x19, 0xAF, 0x97, 0xFF, 0xFF, 0xFF, 0x7F, 0x5E, 0xA6, 0x9F,
+    0xFF, 0xFF, 0xEA, 0x6A, 0xEA, 0x99, 0xAA, 0xFC, 0x74, 0xFF, 0xFC, 0xA7, 0x39, 0xFF, 0xFC, 0x74,
+    0xAF, 0xFF, 0x75, 0xFF, 0xEA, 0x75, 0x9F, 0xFA, 0x97, 0x7A, 0xF7, 0x75, 0xFA, 0x77, 0x49, 0xFA,
+    0x77, 0x4A, 0xF9, 0x77, 0x4F, 0xC7, 0x74, 0x9F, 0xC7, 0x74, 0xAF, 0xA7, 0x74, 0xFC, 0xA7, 0x72,
+    0x77, 0x77, 0x5E, 0x77, 0x3E, 0x77, 0x29, 0xDA, 0x77, 0x2A, 0xD9, 0x77, 0x2E, 0x97, 0x79, 0xAA,
+    0xFD, 0xAA, 0x97, 0x0A, 0xFF, 0xFA, 0x69, 0xFF, 0xFD, 0xA5, 0x9F, 0xFF, 0xE9, 0x49, 0xFF, 0xD9,
+    0x19, 0xAA, 0x94, 0xFD, 0x90, 0xE7, 0x2A, 0xFC, 0x19, 0xE7, 0x2F, 0xC9, 0x1A, 0xDA, 0x71, 0x9F,
+    0xC2, 0xE9, 0x71, 0xFC, 0x92, 0xE7, 0x2F, 0xC3, 0xE7, 0x19, 0xFA, 0x29, 0xFE, 0xAA, 0x92, 0xAF,
+    0x92, 0xAF, 0xFD, 0xA1, 0xAF, 0x92, 0xFF, 0xEA, 0x1F, 0xC9, 0x2E, 0xAF, 0xE9, 0x1F, 0xC9, 0x2E,
+    0x19, 0xFA, 0x91, 0xFD, 0x19, 0xDA, 0x1F, 0x93, 0xAF, 0xFE, 0xAF, 0xC4, 0xAF, 0xFF, 0xFC, 0x5F,
+    0xFF, 0xFC, 0x59, 0xFF, 0xFE, 0xA6, 0x9F, 0xFF, 0xCA, 0x71, 0x9A, 0xFD, 0xA9, 0x97, 0x6E, 0x77,
+    0x3E, 0x77, 0x29, 0xE7, 0x72, 0x9A, 0xA9, 0x72, 0x79, 0xAF, 0xCA, 0xA7, 0x73, 0xFF, 0xD7, 0x72,
+    0x9F, 0xFD, 0x77, 0x2C, 0xA9, 0x1A, 0xF9, 0x77, 0x7A, 0xE9, 0x77, 0x79, 0xE9, 0x77, 0x7A, 0xE9,
+    0x73, 0x9F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x92, 0xAF, 0xFF, 0xFF, 0xF7, 0x77, 0x70, 0xAF,
+    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x92, 0xAF, 0xFF, 0xFF, 0xF4, 0xF9, 0x6A, 0xC7, 0x59, 0xFA,
+    0x39, 0xF9, 0x75, 0xFF, 0xFE, 0x75, 0xAF, 0xFF, 0xD9, 0x75, 0xAF, 0xFF, 0xCA, 0x77, 0xAA, 0xFD,
+    0xAA, 0x97, 0x77, 0x77, 0x10, 0x71, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x70, 0x9F, 0xCA, 0x49, 0xFF,
+    0x39, 0xFF, 0xA2, 0x9F, 0xE9, 0x99, 0x2F, 0x9E, 0x49, 0xE9, 0x9D, 0xA4, 0xF0, 0xAD, 0x94, 0xEA,
+    0x0E, 0x49, 0xE9, 0x0E, 0x4A, 0xE9, 0x9D, 0xA4, 0xAF, 0xAD, 0xA4, 0x9F, 0xFA, 0x4F, 0xFC, 0x93,
+    0x9F, 0xFC, 0x5A, 0xFC, 0xA7, 0xE7, 0x19, 0xDA, 0x77, 0x30, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x92, 0xFF, 0xFF, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x4F, 0xFF, 0xFD, 0x94, 0xFF, 0xFF, 0xD4, 0x9F, 0xFF, 0xFD,
+    0x73, 0xF9, 0x77, 0x2F, 0x77, 0x2A, 0xF7, 0x72, 0xFA, 0x77, 0x2F, 0x97, 0x71, 0xAF, 0x77, 0x2F,
+    0xC7, 0x71, 0x9F, 0x97, 0x71, 0xAF, 0x77, 0x2F, 0xC7, 0x71, 0x9F, 0xA7, 0x71, 0xFC, 0x97, 0x71,
+    0xFC, 0x77, 0x19, 0xFC, 0x77, 0x2A, 0xFF, 0xF2, 0xFF, 0xFA, 0x2F, 0xFF, 0x7A, 0xE7, 0x4E, 0x6F,
+    0xFF, 0xA2, 0xFF, 0xF9, 0x19, 0xFF, 0xF5, 0x9F, 0xC6, 0xFF, 0x7F, 0xE7, 0x9F, 0xDA, 0x7A, 0xFE,
+    0x96, 0x92, 0xAE, 0xA7, 0x29, 0xEA, 0x72, 0xAF, 0x72, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xC7, 0x1F,
+    0xD7, 0x19, 0x99, 0x99, 0x96, 0x59, 0xE7, 0x3A, 0xE7, 0x3E, 0xA0, 0x9A, 0xC9, 0x59, 0xFF, 0x6A,
+    0xFF, 0x4A, 0xFF, 0xA9, 0x3F, 0xF9, 0x09, 0x4F, 0xD9, 0x9A, 0xD3, 0x9F, 0xFD, 0xA3, 0x90, 0x9F,
+    0xF9, 0x3A, 0xFF, 0xA9, 0xAA, 0xA9, 0x0F, 0xDA, 0x91, 0x9E, 0x99, 0xFD, 0x2A, 0xEA, 0x0A, 0xA9,
+    0x9D, 0xA0, 0x9F, 0xC4, 0xAF, 0xFC, 0x5F, 0xF9, 0x6F, 0xD9, 0x70, 0xAA, 0xA9, 0x77, 0x70, 0x71,
+    0xAD, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0xAE, 0x97, 0x4F, 0xF7, 0x19, 0xFF, 0xD7, 0x0F, 0xFE, 0x7A,
+    0xFD, 0xAF, 0x7F, 0xE9, 0x9E, 0x6A, 0xEA, 0xE0, 0x9E, 0x6F, 0x0E, 0x09, 0xE6, 0xE9, 0x9D, 0xA0,
+    0xAD, 0xA5, 0x9E, 0x0A, 0xD9, 0x0E, 0x95, 0xAD, 0xA0, 0xE1, 0xE6, 0xE9, 0x0E, 0x09, 0xE6, 0xE0,
+    0x9E, 0x0A, 0xDA, 0x59, 0xE0, 0xAD, 0xA0, 0xE9, 0x5A, 0xE0, 0xE9, 0x9E, 0x6F, 0x0E, 0x0A, 0xE6,
+    0xEA, 0x9E, 0x0E, 0xA7, 0x09, 0x96, 0x96, 0x77, 0x77, 0x39, 0xFF, 0xA7, 0x6F, 0xFE, 0x75, 0xFF,
+    0xF7, 0x39, 0xE9, 0x39, 0xE9, 0x72, 0xF5, 0xEA, 0x72, 0xF5, 0xEA, 0x71, 0x9E, 0xA4, 0xF9, 0x71,
+    0xFA, 0x99, 0xAA, 0xFC, 0x6F, 0xFF, 0xFC, 0xA5, 0x9F, 0xFF, 0xFC, 0x69, 0xFF, 0xFF, 0x79, 0xFF,
+    0xFD, 0xA7, 0x0A, 0xFF, 0xEA, 0x97, 0x5A, 0xF7, 0x5F, 0xFF, 0xF7, 0x9F, 0xFF, 0xEA, 0x7A, 0xFF,
+    0xFE, 0x76, 0xFC, 0x77, 0x29, 0xFC, 0x77, 0x2A, 0xFA, 0x77, 0x2F, 0xCA, 0x75, 0x6A, 0x97, 0x59,
+    0xDA, 0x74, 0xE9, 0x73, 0xAD, 0xA7, 0x39, 0xE7, 0x4E, 0x93, 0x9A, 0xDA, 0x2E, 0xA1, 0x9A, 0xFC,
+    0xA1, 0x9E, 0xAF, 0xFC, 0xA1, 0xFF, 0xEA, 0x92, 0xFF, 0xCA, 0x94, 0xAF, 0xCA, 0x97, 0x1F, 0xCA,
+    0x73, 0xAF, 0xA7, 0x3A, 0xFC, 0x73, 0x9F, 0x97, 0x39, 0xDA, 0x75, 0x9C, 0x77, 0x71, 0x77, 0x72,
+    0x9C, 0xA7, 0x5A, 0xEA, 0x72, 0x9F, 0xD9, 0x70, 0xAF, 0xF9, 0x6F, 0xFE, 0x93, 0x9F, 0xFA, 0xF2,
+    0xFC, 0x0A, 0xDA, 0x0F, 0xC0, 0x9E, 0xA1, 0xE9, 0x1E, 0x91, 0xAC, 0x3E, 0x3C, 0x97, 0x9E, 0x75,
+    0xAD, 0xA7, 0x5E, 0x97, 0x5E, 0x75, 0x9E, 0x75, 0xEA, 0x75, 0xE7, 0x77, 0x30, 0x70, 0xA7, 0x69,
+    0xDA, 0x76, 0xE9, 0x75, 0x9E, 0x76, 0xAD, 0xA4, 0x9D, 0xA9, 0x4E, 0x93, 0x9F, 0xDA, 0x90, 0x9E,
+    0x39, 0xFF, 0xCA, 0xF4, 0x9A, 0xFF, 0xE9, 0x79, 0xAF, 0xF7, 0x29, 0xAF, 0xD7, 0x29, 0xFC, 0x72,
+    0x9F, 0xC7, 0x2A, 0xFC, 0x73, 0xFA, 0x74, 0x9D, 0xA7, 0x6A, 0xA7, 0x77, 0x00, 0x49, 0x99, 0x76,
+    0xE9, 0x75, 0xAD, 0xA7, 0x59, 0xE7, 0x6E, 0x76, 0xE9, 0x75, 0xAD, 0xA7, 0x19, 0x29, 0xE7, 0x0D,
+    0xA2, 0xE9, 0x19, 0xCA, 0x19, 0xF9, 0x0A, 0xDA, 0x1F, 0x19, 0xFA, 0x9E, 0x0F, 0xA3, 0xFF, 0xFC,
+    0x59, 0xFF, 0xD7, 0x0F, 0xF7, 0x2A, 0xFC, 0x97, 0x39, 0xE9, 0x76, 0xA9, 0x77, 0x70, 0x59, 0xA7,
+    0x39, 0xA7, 0x3D, 0xA7, 0x2D, 0x97, 0x1A, 0xD7, 0x3A, 0xD7, 0x09, 0xD9, 0x74, 0xE7, 0xE3, 0x9A,
+    0xEA, 0x92, 0x9D, 0xA5, 0xE0, 0x9A, 0xFF, 0xDA, 0x90, 0xAD, 0x93, 0x9F, 0xFE, 0xAF, 0xFE, 0x3F,
+    0xFA, 0x94, 0x9A, 0xFE, 0xA1, 0xFC, 0xA9, 0x74, 0xAF, 0xC9, 0x09, 0xF7, 0x7A, 0xF2, 0x9F, 0x97,
+    0x4A, 0xEA, 0x5F, 0x97, 0x2F, 0xA7, 0xE7, 0x3A, 0xD9, 0x71, 0xC9, 0x74, 0xC9, 0x77, 0x77, 0x00,
+    0x77, 0x69, 0xC7, 0x3A, 0xE7, 0x09, 0xFD, 0x6A, 0xFE, 0xA4, 0xFF, 0xDA, 0x19, 0xEA, 0x9D, 0x9A,
+    0xE9, 0x0E, 0x1A, 0xD1, 0xAD, 0x19, 0xA2, 0xE2, 0x97, 0xDA, 0x72, 0x9D, 0x97, 0x2A, 0xD7, 0x3D,
+    0xA7, 0x29, 0xD9, 0x72, 0x9D, 0x97, 0x3D, 0xA7, 0x3E, 0x73, 0xAD, 0x73, 0x9D, 0x97, 0x3D, 0xA6,
+    0xAC, 0x91, 0xE2, 0xC9, 0x1E, 0xA0, 0xAD, 0x1E, 0x91, 0xAE, 0xAD, 0xAF, 0x39, 0xFF, 0xC6, 0xFE,
+    0x97, 0x9F, 0x97, 0x2D, 0xA7, 0x49, 0x40, 0x71, 0x9A, 0xA9, 0x69, 0x9A, 0xFD, 0xA2, 0x9F, 0xFF,
+    0xC2, 0x9F, 0xFA, 0x99, 0x49, 0xFD, 0xA7, 0x1F, 0xF9, 0x7F, 0xFD, 0x6E, 0xA0, 0xAF, 0xCA, 0x4E,
+    0xA2, 0xAF, 0xCA, 0x2E, 0xA3, 0x9F, 0xD1, 0xEA, 0x59, 0xEA, 0x1D, 0xA9, 0x7A, 0xA1, 0x2A, 0xA9,
+    0x97, 0x4F, 0xEA, 0x97, 0xFF, 0xFA, 0x59, 0xAA, 0xFF, 0x71, 0xFE, 0x7A, 0xFF, 0x59, 0xFF, 0xD3,
+    0x9F, 0xD9, 0x0E, 0xA2, 0xAF, 0xC9, 0x2E, 0xA0, 0x9F, 0xCA, 0x4E, 0xA1, 0xF6, 0xEA, 0x2C, 0x97,
+    0xAD, 0x90, 0x2A, 0x73, 0xD9, 0x71, 0xAE, 0x72, 0xE9, 0x3A, 0xA9, 0x2A, 0xE3, 0xE3, 0xE9, 0x19,
+    0xDA, 0x3A, 0xE1, 0xAD, 0x94, 0xE9, 0x0E, 0x5A, 0xE0, 0xE6, 0xEA, 0xDA, 0x6A, 0xFC, 0x92, 0x93,
+    0xFC, 0x3F, 0xFD, 0x29, 0xFF, 0xCA, 0x2A, 0xFF, 0xC9, 0x39, 0x9A, 0xAF, 0xC7, 0x39, 0x93, 0x71,
+    0xA7, 0x3A, 0xD7, 0x2E, 0x91, 0x9A, 0xA3, 0xAE, 0x2E, 0x3E, 0x92, 0xAD, 0x29, 0xE3, 0x9D, 0x91,
+    0xEA, 0x4D, 0xA0, 0x9E, 0x5E, 0x0E, 0xA5, 0xAD, 0xAE, 0x69, 0xFC, 0xA7, 0xFC, 0x39, 0x3F, 0xFD,
+    0x3A, 0xFF, 0xC9, 0x29, 0xFF, 0xCA, 0x3F, 0xCA, 0xA9, 0x94, 0x99, 0x70, 0x77, 0x7D, 0x77, 0x09,
+    0xE7, 0x7A, 0xE7, 0x7E, 0x97, 0x6A, 0xE7, 0x7F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0xFF,
+    0xFF, 0x19, 0xFF, 0xFF, 0xC9, 0x0A, 0xEA, 0x76, 0x9F, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x2F, 0xFF, 0xFC, 0x3A, 0xFF, 0xFE, 0x93, 0xAF, 0x97, 0x6A, 0xF7, 0x7A, 0xE7, 0x70, 0xAC, 0x97,
+    0x77, 0x50, 0x75, 0x97, 0x70, 0xAC, 0x99, 0xC9, 0x76, 0xE0, 0xAD, 0x74, 0x9F, 0x0F, 0x72, 0x9F,
+    0xA0, 0xFA, 0x70, 0xAF, 0xC9, 0x9F, 0xC9, 0x6A, 0xFD, 0x0A, 0xFD, 0x94, 0xFA, 0xDA, 0x0E, 0xAF,
+    0x29, 0xF9, 0x9D, 0x90, 0xE0, 0xFC, 0x1F, 0x90, 0xAD, 0x09, 0xDA, 0x1F, 0x1E, 0x2E, 0x0A, 0xD9,
+    0x19, 0xCA, 0x3A, 0x3D, 0xA0, 0xE3, 0x97, 0x09, 0xD9, 0x0D, 0xA7, 0x5A, 0xD0, 0x9D, 0x97, 0x5E,
+    0x0A, 0xD7, 0x6D, 0xA0, 0xE7, 0x59, 0xD9, 0x9D, 0xA7, 0x5A, 0xD0, 0xAD, 0x97, 0x5E, 0x0E, 0x76,
+    0xD9, 0x0E, 0x71, 0x76, 0x97, 0x72, 0xAC, 0xA7, 0x70, 0x9E, 0x77, 0x0A, 0xE7, 0x71, 0xEA, 0x77,
+    0x09, 0xE4, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA3, 0xAF, 0xFF, 0xF3, 0xFF, 0xFF, 0xD7,
+    0x70, 0xF1, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0x1F, 0xFF, 0xFC, 0x92, 0xFF, 0xFF,
+    0x76, 0xFC, 0x76, 0xAF, 0x77, 0x9E, 0x77, 0x1D, 0x77, 0x74, 0x39, 0xD9, 0x9D, 0xA7, 0x6D, 0xA0,
+    0xE7, 0x6E, 0x0E, 0x76, 0xAD, 0x0A, 0xD9, 0x75, 0x9D, 0x99, 0xDA, 0x76, 0xDA, 0x0E, 0x76, 0xE0,
+    0xAD, 0x76, 0xAD, 0x09, 0xD9, 0x70, 0x9A, 0x29, 0xD9, 0x0D, 0xA3, 0x93, 0xDA, 0x2D, 0xA0, 0xE2,
+    0xAC, 0xA1, 0x9F, 0x1E, 0x0A, 0xD9, 0x09, 0xEA, 0x19, 0xF9, 0x9D, 0x09, 0xDA, 0x0F, 0x92, 0x9F,
+    0xAD, 0x90, 0xFE, 0xA5, 0xFD, 0xA0, 0xFE, 0x7A, 0xFC, 0x0A, 0xFC, 0x71, 0xAF, 0x99, 0xF9, 0x72,
+    0x9E, 0xA0, 0xEA, 0x75, 0xE0, 0xDA, 0x77, 0xD0, 0xAC, 0x77, 0x74, 0x77, 0x39, 0x70, 0xD7, 0x4A,
+    0xCA, 0x69, 0xE7, 0x2A, 0xE6, 0xAE, 0x72, 0xAE, 0x6E, 0x97, 0x3E, 0xA4, 0xAE, 0x74, 0xAE, 0x4F,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE9, 0x2A, 0xFF, 0xFF, 0xFD, 0x19, 0xFF, 0xFF, 0xFF,
+    0x0A, 0xEA, 0x76, 0x9F, 0x09, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0x2F, 0xFF,
+    0xFF, 0xC9, 0x4A, 0xFF, 0xFF, 0xD7, 0xAF, 0x95, 0xFC, 0x71, 0xAF, 0x4A, 0xF7, 0x3A, 0xE4, 0x9E,
+    0x75, 0xAC, 0x95, 0xD7, 0x77, 0x71, 0x69, 0xCA, 0x76, 0xF9, 0x73, 0xFE, 0x97, 0x0A, 0xFF, 0xCA,
+    0x94, 0xAE, 0x9F, 0xF9, 0x29, 0xF0, 0xDA, 0xAE, 0xA2, 0xAF, 0xC0, 0xDA, 0x1A, 0xA2, 0xAF, 0xD0,
+    0xDA, 0x6F, 0xE0, 0xDA, 0x79, 0xC9, 0xAD, 0x0D, 0xA7, 0x2A, 0xD0, 0xDA, 0x72, 0xAD, 0x0D, 0xA7,
+    0x2A, 0xD0, 0xDA, 0x72, 0xAD, 0x0D, 0xA7, 0x2A, 0xD0, 0xDA, 0x7A, 0xCA, 0xAD, 0x0D, 0xA6, 0xFE,
+    0x0D, 0xA6, 0xAF, 0xD0, 0xDA, 0x79, 0xFC, 0x0D, 0xA0, 0x9D, 0x49, 0xF0, 0xFF, 0x49, 0xEA, 0xFF,
+    0x94, 0xAF, 0xFC, 0xA9, 0x6A, 0xFC, 0xA9, 0x72, 0xF7, 0x6C, 0xA7, 0x77, 0x77, 0x1A, 0xD9, 0x76,
+    0x9F, 0xA7, 0x5F, 0xD7, 0x79, 0xE7, 0x70, 0xE7, 0x7A, 0xDA, 0x77, 0xE9, 0x7A, 0xAE, 0x90, 0x9E,
+    0x6A, 0xFE, 0x9A, 0xDA, 0x5A, 0xFF, 0xF5, 0xAF, 0xA9, 0x9F, 0xD5, 0xF9, 0x2A, 0xF9, 0x4A, 0xE9,
+    0x39, 0xF5, 0xF4, 0x9E, 0xA5, 0xEA, 0x4A, 0xE5, 0x9F, 0x3A, 0xEA, 0x59, 0xFC, 0xAA, 0xFC, 0x7F,
+    0xFE, 0x97, 0xAF, 0xFC, 0x97, 0x1F, 0xF9, 0x73, 0xAF, 0xA7, 0x10, 0x77, 0x77, 0x77, 0x1A, 0xA7,
+    0x69, 0xAF, 0xCA, 0x0A, 0xE7, 0x39, 0xFF, 0xFC, 0xA7, 0x2A, 0xFF, 0xFC, 0xA7, 0x2F, 0xDA, 0xAA,
+    0xFD, 0x97, 0x1F, 0xCA, 0x3F, 0xE7, 0x0A, 0xFA, 0x3F, 0xF7, 0x9F, 0xA3, 0xAE, 0xAF, 0x96, 0xFC,
+    0x3A, 0xEA, 0x0F, 0x95, 0x9F, 0x92, 0xAE, 0xA1, 0xF9, 0x5A, 0xF2, 0xAE, 0xA2, 0xF9, 0x5F, 0xA1,
+    0xAE, 0xA2, 0x9F, 0x59, 0xF1, 0xAF, 0x39, 0xF5, 0xAF, 0x0A, 0xF4, 0xFA, 0x5A, 0xF9, 0xF5, 0xF9,
+    0x5F, 0xFC, 0x5F, 0xC6, 0xFF, 0x5A, 0xFA, 0x6F, 0xE9, 0x90, 0x99, 0xAF, 0xD9, 0x6F, 0xFF, 0xFE,
+    0x7F, 0xFF, 0xFD, 0x96, 0x9F, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0xFC, 0x97,
+    0xAD, 0xA1, 0x9A, 0xFE, 0xA9, 0x72, 0x9A, 0x77, 0x60, 0x74, 0x99, 0x99, 0x76, 0xFC, 0x75, 0xAF,
+    0xC7, 0x49, 0xFD, 0x97, 0x3F, 0xEA, 0x72, 0xFF, 0xC7, 0x1A, 0xF9, 0xF7, 0x09, 0xF1, 0xF7, 0x0F,
+    0x91, 0xF9, 0x6F, 0xC2, 0xFA, 0x5A, 0xF3, 0xFC, 0x49, 0xF9, 0x3F, 0xC4, 0xFA, 0x4A, 0xF3, 0xFC,
+    0x5A, 0xF9, 0x1A, 0xF9, 0x59, 0xFA, 0x09, 0xFA, 0x69, 0xFC, 0x0F, 0xFF, 0xFE, 0x9F, 0xFF, 0xFD,
+    0xAA, 0xFF, 0xFF, 0xD9, 0xFF, 0xFF, 0xE0, 0x77, 0x5F, 0xFF, 0xF1, 0x9F, 0xFF, 0xEA, 0x1A, 0xFF,
+    0xFE, 0x93, 0xAE, 0x3F, 0x6F, 0x3E, 0xA6, 0xEA, 0x2A, 0xE9, 0x59, 0xE9, 0x2F, 0x6A, 0xE3, 0xF6,
+    0xF2, 0x9E, 0xA6, 0xEA, 0x2A, 0xE6, 0x9E, 0x92, 0xF6, 0xF3, 0xEA, 0x6F, 0x29, 0xE9, 0x59, 0xEA,
+    0x2A, 0xE6, 0xAE, 0x92, 0xF6, 0xF3, 0xEA, 0x6E, 0xA2, 0x9E, 0x95, 0x9E, 0x92, 0xAE, 0x69, 0xAA,
+    0xA3, 0xAA, 0xAA, 0x60, 0x0F, 0x3E, 0x97, 0xAE, 0x3F, 0x79, 0xE9, 0x2F, 0x70, 0xEA, 0x29, 0xE9,
+    0x7F, 0x3E, 0xA7, 0xAE, 0x3F, 0x79, 0xEA, 0x2A, 0xE7, 0x0F, 0x29, 0xE9, 0x7F, 0x3E, 0xA7, 0xAE,
+    0x92, 0xF7, 0x0E, 0xA2, 0xAE, 0x70, 0xF2, 0x9E, 0x97, 0xAE, 0x3F, 0x79, 0xE9, 0x2F, 0x70, 0xEA,
+    0x2A, 0xE9, 0x7F, 0x29, 0xEA, 0x5F, 0xFF, 0xF3, 0xAF, 0xFF, 0xE9, 0x29, 0xFF, 0xFE, 0xA0, 0x77,
+    0x6F, 0xFF, 0x93, 0x9F, 0xFF, 0x4A, 0xFF, 0xF4, 0x9F, 0x75, 0xFA, 0x75, 0xF7, 0x5A, 0xF7, 0x5F,
+    0x97, 0x4A, 0xEA, 0x75, 0xEA, 0x75, 0xE9, 0x73, 0x9E, 0x97, 0x3F, 0x97, 0x2A, 0xF7, 0x29, 0xFC,
+    0x73, 0xFF, 0xF9, 0x4F, 0xFF, 0x4A, 0xFF, 0xF4, 0xFF, 0xFA, 0x40, 0x49, 0x99, 0x9A, 0xAA, 0xA2,
+    0xFF, 0xE9, 0x0A, 0xFF, 0xE9, 0x9F, 0xDA, 0xAA, 0xAA, 0xA9, 0x75, 0x9F, 0xFC, 0x97, 0x5F, 0xFC,
+    0xA7, 0x5A, 0xFE, 0xAA, 0x76, 0xE9, 0x77, 0x3E, 0xA7, 0x73, 0x9E, 0x77, 0x4E, 0xA7, 0x73, 0xAE,
+    0x77, 0x4E, 0xA7, 0x73, 0xF7, 0x73, 0x9E, 0xA7, 0x73, 0xF7, 0x73, 0xAE, 0xA7, 0x73, 0xF7, 0x6A,
+    0x3F, 0xA7, 0x5A, 0xD1, 0x9F, 0x76, 0xAE, 0xAF, 0xA7, 0x6A, 0xFF, 0x77, 0x9F, 0xEA, 0x77, 0x0F,
+    0xE7, 0x71, 0xFD, 0xA7, 0x71, 0xAF, 0xC7, 0x77, 0x77, 0x20, 0x69, 0x9A, 0x94, 0x9A, 0xA9, 0x79,
+    0xFD, 0xA0, 0x9F, 0xCA, 0x5F, 0xFC, 0xAF, 0xEA, 0x3A, 0xFF, 0xFF, 0xD2, 0x9F, 0x91, 0x9F, 0xC9,
+    0x1E, 0x2A, 0xE5, 0xDA, 0x3A, 0xD2, 0xE6, 0xD4, 0xAD, 0x19, 0xE5, 0xAC, 0xA4, 0xE1, 0xAE, 0x39,
+    0xAE, 0x91, 0x9E, 0x91, 0xAF, 0xFF, 0xFE, 0x29, 0xFF, 0xFF, 0xDA, 0x3F, 0xFF, 0xFC, 0xA5, 0xFE,
+    0x1F, 0xDA, 0x79, 0x9A, 0xA9, 0x3A, 0xDA, 0x94, 0x77, 0x3A, 0xAC, 0xA9, 0x77, 0x2A, 0xFD, 0x77,
+    0x1A, 0xFD, 0xA7, 0x70, 0xAE, 0xA1, 0x9A, 0x77, 0x0F, 0x77, 0x4A, 0xE7, 0x75, 0xF7, 0x74, 0x9E,
+    0x97, 0x74, 0xF7, 0x74, 0x9E, 0x97, 0x74, 0xAE, 0x77, 0x5E, 0xA7, 0x74, 0xAE, 0x77, 0x5F, 0x77,
+    0x49, 0xE9, 0x77, 0x4F, 0x77, 0x5E, 0xA7, 0x74, 0xAE, 0x97, 0x74, 0xF7, 0x74, 0xAE, 0x97, 0x7A,
+    0x91, 0xAF, 0x75, 0x9F, 0xFD, 0x97, 0x5F, 0xFE, 0x76, 0xAF, 0xFC, 0x77, 0x0F, 0xF9, 0x77, 0x19,
+    0xAE, 0xA7, 0x77, 0x77, 0x20, 0x4A, 0xEA, 0x4F, 0xA3, 0x9F, 0x93, 0xFC, 0x92, 0x9F, 0xC3, 0xFD,
+    0x77, 0x77, 0x77, 0x49, 0xF4, 0xFA, 0x39, 0xFA, 0x3F, 0xC9, 0x29, 0xFC, 0x3F, 0xD3, 0x77, 0x69,
+    0xF9, 0x29, 0xAA, 0x4A, 0xFD, 0x91, 0xF2, 0xAE, 0xAA, 0xE0, 0x9E, 0x92, 0xF1, 0xFF, 0x3E, 0xA1,
+    0x9F, 0xD7, 0x49, 0xAA, 0x97, 0x77, 0x9F, 0x92, 0x9A, 0xA4, 0xAF, 0xD9, 0x1A, 0xE2, 0x9E, 0xAA,
+    0xE0, 0x9E, 0xA2, 0xF1, 0xFF, 0x3A, 0xDA, 0x2F, 0xD7, 0x49, 0xAA, 0x94, 0x77, 0x29, 0xAA, 0x77,
+    0x29, 0xDA, 0x77, 0x19, 0xE7, 0x71, 0x9E, 0x77, 0x2E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0xA1, 0x99,
+    0x7A, 0xFF, 0xFD, 0xA5, 0xAF, 0xFF, 0xEA, 0x4A, 0xFF, 0xFF, 0xA4, 0x93, 0xAE, 0x97, 0x70, 0x9E,
+    0xA7, 0x71, 0xF2, 0x99, 0x99, 0x7F, 0xFF, 0xE9, 0x5F, 0xFF, 0xFA, 0x4F, 0xFF, 0xFC, 0xA6, 0xAE,
+    0xA7, 0x70, 0x9E, 0xA7, 0x70, 0x9F, 0x77, 0x1F, 0x77, 0x1F, 0x77, 0x1A, 0xE7, 0x71, 0x77, 0x77,
+    0x4A, 0xC9, 0x77, 0x2A, 0xEA, 0x77, 0x0A, 0xFD, 0x76, 0xAF, 0xEA, 0x73, 0x9F, 0xFA, 0x73, 0x9F,
+    0xFA, 0x74, 0xFF, 0xC7, 0x6F, 0xE9, 0x77, 0xFE, 0xA9, 0x76, 0xFF, 0xEA, 0x97, 0x29, 0xAF, 0xFF,
+    0xCA, 0x97, 0x29, 0xAF, 0xFF, 0x75, 0xAF, 0xFC, 0xA7, 0x79, 0xAF, 0xD7, 0x73, 0x9A, 0xD7, 0xFA,
+    0xA9, 0x96, 0x97, 0xFF, 0xFC, 0xAA, 0x99, 0x6F, 0xFF, 0xFC, 0xA7, 0x99, 0x9A, 0xAF, 0xFE, 0x97,
+    0x70, 0x99, 0x9A, 0xAD, 0x00, 0x79, 0x77, 0x6D, 0xA7, 0x74, 0xFA, 0x77, 0x19, 0xFD, 0xA7, 0x70,
+    0xAF, 0xEA, 0x77, 0x0F, 0xF9, 0x77, 0x9F, 0xF9, 0x77, 0xAF, 0xF9, 0x77, 0xFF, 0x77, 0x9F, 0xDA,
+    0x73, 0x9A, 0xFF, 0xC9, 0x70, 0x9A, 0xFF, 0xFA, 0x5A, 0xFF, 0xFC, 0xA7, 0xAF, 0xFD, 0xA9, 0x72,
+    0xFF, 0xA9, 0x75, 0xFC, 0xA7, 0x70, 0x9C, 0xA9, 0x72, 0x97, 0x69, 0x9A, 0xAF, 0xC9, 0x69, 0xAA,
+    0xFF, 0xFC, 0xA5, 0xFF, 0xFF, 0xCA, 0x4A, 0xFF, 0xDA, 0xAA, 0x99, 0x69, 0xCA, 0xAA, 0x99, 0x77,
+    0x00,
 };
 
 static const EpdGlyph opendyslexic_12_bolditalicGlyphs[] = {
     { 0, 0, 22, 0, 0, 0, 0 }, //  
-    { 14, 32, 14, -1, 28, 112, 0 }, // !
-    { 17, 9, 20, 2, 22, 39, 112 }, // "
-    { 31, 23, 32, 0, 21, 179, 151 }, // #
-    { 23, 30, 29, 3, 24, 173, 330 }, // $
-    { 23, 22, 29, 5, 20, 127, 503 }, // %
-    { 19, 22, 24, 4, 20, 105, 630 }, // &
-    { 8, 9, 13, 4, 20, 18, 735 }, // '
-    { 18, 35, 20, 1, 26, 158, 753 }, // (
-    { 17, 35, 11, -8, 26, 149, 911 }, // )
-    { 15, 14, 20, 4, 20, 53, 1060 }, // *
-    { 15, 14, 18, 2, 14, 53, 1113 }, // +
-    { 11, 9, 10, -2, 4, 25, 1166 }, // ,
-    { 14, 3, 17, 2, 9, 11, 1191 }, // -
-    { 7, 6, 8, 0, 6, 11, 1202 }, // .
-    { 29, 43, 26, -4, 29, 312, 1213 }, // /
-    { 19, 21, 21, 1, 20, 100, 1525 }, // 0
-    { 14, 19, 18, 1, 19, 67, 1625 }, // 1
-    { 18, 20, 20, 1, 20, 90, 1692 }, // 2
-    { 18, 20, 20, 1, 19, 90, 1782 }, // 3
-    { 16, 20, 20, 2, 19, 80, 1872 }, // 4
-    { 17, 21, 19, 1, 20, 90, 1952 }, // 5
-    { 18, 20, 20, 1, 19, 90, 2042 }, // 6
-    { 15, 20, 21, 5, 20, 75, 2132 }, // 7
-    { 18, 20, 20, 1, 19, 90, 2207 }, // 8
-    { 19, 21, 21, 1, 19, 100, 2297 }, // 9
-    { 11, 17, 12, 0, 17, 47, 2397 }, // :
-    { 12, 21, 12, -1, 16, 63, 2444 }, // ;
-    { 21, 17, 20, -2, 17, 90, 2507 }, // <
-    { 16, 10, 18, 1, 12, 40, 2597 }, // =
-    { 21, 17, 23, 1, 17, 90, 2637 }, // >
-    { 18, 31, 23, 4, 28, 140, 2727 }, // ?
-    { 26, 24, 28, 1, 22, 156, 2867 }, // @
-    { 22, 21, 28, 1, 21, 116, 3023 }, // A
-    { 21, 21, 23, 1, 21, 111, 3139 }, // B
-    { 22, 23, 25, 2, 23, 127, 3250 }, // C
-    { 24, 21, 26, 1, 21, 126, 3377 }, // D
-    { 22, 21, 24, 1, 21, 116, 3503 }, // E
-    { 20, 22, 22, 1, 22, 110, 3619 }, // F
-    { 23, 22, 28, 2, 21, 127, 3729 }, // G
-    { 24, 21, 26, 1, 21, 126, 3856 }, // H
-    { 12, 23, 14, 1, 22, 69, 3982 }, // I
-    { 23, 27, 24, 0, 21, 156, 4051 }, // J
-    { 23, 21, 26, 1, 21, 121, 4207 }, // K
-    { 17, 21, 22, 1, 21, 90, 4328 }, // L
-    { 27, 21, 29, 1, 21, 142, 4418 }, // M
-    { 25, 21, 27, 1, 21, 132, 4560 }, // N
-    { 25, 24, 28, 2, 22, 150, 4692 }, // O
-    { 21, 22, 23, 1, 22, 116, 4842 }, // P
-    { 25, 27, 29, 2, 22, 169, 4958 }, // Q
-    { 20, 22, 24, 1, 21, 110, 5127 }, // R
-    { 21, 22, 26, 2, 21, 116, 5237 }, // S
-    { 20, 22, 27, 6, 22, 110, 5353 }, // T
-    { 24, 23, 27, 2, 21, 138, 5463 }, // U
-    { 21, 21, 29, 7, 21, 111, 5601 }, // V
-    { 30, 22, 37, 6, 22, 165, 5712 }, // W
-    { 26, 21, 28, 1, 21, 137, 5877 }, // X
-    { 20, 21, 28, 7, 21, 105, 6014 }, // Y
-    { 26, 21, 28, 1, 21, 137, 6119 }, // Z
-    { 20, 36, 19, -2, 27, 180, 6256 }, // [
-    { 6, 29, 12, 5, 22, 44, 6436 }, // <backslash>
-    { 19, 36, 14, -6, 27, 171, 6480 }, // ]
-    { 15, 7, 19, 3, 24, 27, 6651 }, // ^
-    { 19, 5, 18, -2, -1, 24, 6678 }, // _
-    { 10, 6, 16, 5, 20, 15, 6702 }, // `
-    { 16, 17, 21, 2, 16, 68, 6717 }, // a
-    { 16, 23, 22, 3, 22, 92, 6785 }, // b
-    { 14, 16, 20, 2, 16, 56, 6877 }, // c
-    { 21, 22, 24, 2, 21, 116, 6933 }, // d
-    { 17, 16, 21, 2, 15, 68, 7049 }, // e
-    { 14, 22, 18, 3, 22, 77, 7117 }, // f
-    { 20, 23, 21, 0, 15, 115, 7194 }, // g
-    { 18, 22, 22, 1, 21, 99, 7309 }, // h
-    { 12, 25, 14, 1, 24, 75, 7408 }, // i
-    { 16, 29, 19, 2, 22, 116, 7483 }, // j
-    { 16, 21, 22, 1, 21, 84, 7599 }, // k
-    { 12, 22, 15, 1, 22, 66, 7683 }, // l
-    { 27, 16, 31, 1, 16, 108, 7749 }, // m
-    { 18, 16, 22, 1, 16, 72, 7857 }, // n
-    { 17, 16, 21, 2, 15, 68, 7929 }, // o
-    { 22, 23, 23, -1, 15, 127, 7997 }, // p
-    { 18, 23, 24, 2, 16, 104, 8124 }, // q
-    { 15, 16, 18, 1, 15, 60, 8228 }, // r
-    { 16, 18, 21, 2, 16, 72, 8288 }, // s
-    { 13, 20, 20, 4, 20, 65, 8360 }, // t
-    { 16, 16, 21, 3, 15, 64, 8425 }, // u
-    { 18, 15, 24, 5, 15, 68, 8489 }, // v
-    { 21, 16, 28, 5, 15, 84, 8557 }, // w
-    { 21, 14, 24, 1, 14, 74, 8641 }, // x
-    { 21, 21, 23, 1, 14, 111, 8715 }, // y
-    { 19, 15, 22, 1, 15, 72, 8826 }, // z
-    { 17, 26, 20, 2, 20, 111, 8898 }, // {
-    { 11, 23, 13, 1, 18, 64, 9009 }, // |
-    { 16, 26, 17, -1, 20, 104, 9073 }, // }
-    { 11, 5, 17, 5, 19, 14, 9177 }, // ~
-    { 0, 0, 22, 0, 0, 0, 9191 }, //  
-    { 13, 32, 17, 3, 28, 104, 9191 }, // ¡
-    { 14, 24, 20, 2, 20, 84, 9295 }, // ¢
-    { 19, 23, 21, 1, 22, 110, 9379 }, // £
-    { 17, 15, 20, 2, 17, 64, 9489 }, // ¤
-    { 22, 22, 25, 2, 19, 121, 9553 }, // ¥
-    { 10, 22, 12, 1, 18, 55, 9674 }, // ¦
-    { 19, 22, 21, 1, 20, 105, 9729 }, // §
-    { 14, 6, 19, 4, 21, 21, 9834 }, // ¨
-    { 13, 11, 21, 7, 24, 36, 9855 }, // ©
-    { 10, 9, 18, 7, 19, 23, 9891 }, // ª
-    { 18, 14, 21, 2, 13, 63, 9914 }, // «
-    { 14, 9, 17, 2, 10, 32, 9977 }, // ¬
-    { 15, 3, 18, 2, 9, 12, 10009 }, // ­
-    { 13, 12, 22, 8, 28, 39, 10021 }, // ®
-    { 11, 4, 17, 5, 19, 11, 10060 }, // ¯
-    { 14, 11, 20, 5, 19, 39, 10071 }, // °
-    { 19, 18, 20, 0, 14, 86, 10110 }, // ±
-    { 9, 8, 19, 9, 20, 18, 10196 }, // ²
-    { 10, 10, 19, 8, 21, 25, 10214 }, // ³
-    { 8, 6, 13, 4, 19, 12, 10239 }, // ´
-    { 20, 19, 21, -1, 15, 95, 10251 }, // µ
-    { 19, 22, 22, 2, 18, 105, 10346 }, // ¶
-    { 7, 6, 10, 2, 12, 11, 10451 }, // ·
-    { 8, 8, 8, -1, 1, 16, 10462 }, // ¸
-    { 7, 9, 17, 9, 21, 16, 10478 }, // ¹
-    { 9, 8, 18, 8, 18, 18, 10494 }, // º
-    { 18, 14, 19, -4, 13, 63, 10512 }, // »
-    { 26, 23, 32, 2, 21, 150, 10575 }, // ¼
-    { 28, 23, 32, 2, 21, 161, 10725 }, // ½
-    { 26, 23, 32, 2, 21, 150, 10886 }, // ¾
-    { 19, 31, 18, -2, 18, 148, 11036 }, // ¿
-    { 22, 28, 28, 1, 28, 154, 11184 }, // À
-    { 23, 32, 28, 1, 32, 184, 11338 }, // Á
-    { 23, 29, 28, 1, 29, 167, 11522 }, // Â
-    { 23, 29, 28, 1, 29, 167, 11689 }, // Ã
-    { 25, 30, 28, 1, 30, 188, 11856 }, // Ä
-    { 22, 30, 28, 1, 30, 165, 12044 }, // Å
-    { 35, 22, 37, 1, 21, 193, 12209 }, // Æ
-    { 22, 30, 25, 2, 23, 165, 12402 }, // Ç
-    { 22, 29, 24, 1, 29, 160, 12567 }, // È
-    { 22, 33, 24, 1, 33, 182, 12727 }, // É
-    { 22, 30, 24, 1, 30, 165, 12909 }, // Ê
-    { 22, 31, 24, 1, 31, 171, 13074 }, // Ë
-    { 15, 32, 17, 1, 31, 120, 13245 }, // Ì
-    { 16, 36, 18, 1, 35, 144, 13365 }, // Í
-    { 16, 33, 18, 1, 32, 132, 13509 }, // Î
-    { 18, 33, 20, 1, 32, 149, 13641 }, // Ï
-    { 25, 21, 26, 0, 21, 132, 13790 }, // Ð
-    { 25, 29, 27, 1, 29, 182, 13922 }, // Ñ
-    { 25, 31, 28, 2, 29, 194, 14104 }, // Ò
-    { 25, 35, 28, 2, 33, 219, 14298 }, // Ó
-    { 25, 32, 28, 2, 30, 200, 14517 }, // Ô
-    { 25, 32, 28, 2, 30, 200, 14717 }, // Õ
-    { 25, 33, 28, 2, 31, 207, 14917 }, // Ö
-    { 16, 9, 17, 0, 11, 36, 15124 }, // ×
-    { 50, 46, 41, -10, 34, 575, 15160 }, // Ø
-    { 24, 32, 27, 2, 30, 192, 15735 }, // Ù
-    { 24, 36, 27, 2, 34, 216, 15927 }, // Ú
-    { 24, 33, 27, 2, 31, 198, 16143 }, // Û
-    { 24, 33, 27, 2, 31, 198, 16341 }, // Ü
-    { 20, 36, 28, 7, 36, 180, 16539 }, // Ý
-    { 16, 21, 18, 1, 20, 84, 16719 }, // Þ
-    { 18, 22, 20, 1, 20, 99, 16803 }, // ß
-    { 16, 24, 21, 2, 23, 96, 16902 }, // à
-    { 17, 28, 21, 2, 27, 119, 16998 }, // á
-    { 17, 25, 21, 2, 24, 107, 17117 }, // â
-    { 17, 23, 21, 2, 22, 98, 17224 }, // ã
-    { 19, 26, 22, 2, 25, 124, 17322 }, // ä
-    { 16, 26, 21, 2, 25, 104, 17446 }, // å
-    { 26, 17, 31, 2, 16, 111, 17550 }, // æ
-    { 14, 23, 20, 2, 16, 81, 17661 }, // ç
-    { 17, 26, 21, 2, 25, 111, 17742 }, // è
-    { 18, 31, 21, 2, 30, 140, 17853 }, // é
-    { 18, 27, 21, 2, 26, 122, 17993 }, // ê
-    { 20, 28, 23, 2, 27, 140, 18115 }, // ë
-    { 11, 23, 13, 1, 22, 64, 18255 }, // ì
-    { 13, 28, 15, 1, 27, 91, 18319 }, // í
-    { 14, 24, 14, -1, 23, 84, 18410 }, // î
-    { 13, 24, 15, 1, 23, 78, 18494 }, // ï
-    { 23, 22, 24, 0, 21, 127, 18572 }, // ð
-    { 20, 24, 22, 1, 24, 120, 18699 }, // ñ
-    { 17, 23, 21, 2, 22, 98, 18819 }, // ò
-    { 17, 27, 21, 2, 26, 115, 18917 }, // ó
-    { 17, 24, 21, 2, 23, 102, 19032 }, // ô
-    { 18, 24, 21, 2, 23, 108, 19134 }, // õ
-    { 19, 25, 22, 2, 24, 119, 19242 }, // ö
-    { 19, 18, 24, 4, 17, 86, 19361 }, // ÷
-    { 28, 44, 26, -3, 30, 308, 19447 }, // ø
-    { 16, 24, 21, 3, 23, 96, 19755 }, // ù
-    { 16, 28, 21, 3, 27, 112, 19851 }, // ú
-    { 16, 24, 21, 3, 23, 96, 19963 }, // û
-    { 18, 25, 22, 3, 24, 113, 20059 }, // ü
-    { 21, 36, 23, 1, 29, 189, 20172 }, // ý
-    { 17, 26, 18, 0, 21, 111, 20361 }, // þ
-    { 22, 33, 24, 1, 26, 182, 20472 }, // ÿ
-    { 25, 29, 28, 1, 29, 182, 20654 }, // Ā
-    { 19, 25, 22, 2, 24, 119, 20836 }, // ā
-    { 26, 30, 28, 1, 30, 195, 20955 }, // Ă
-    { 20, 25, 23, 2, 24, 125, 21150 }, // ă
-    { 22, 28, 28, 1, 21, 154, 21275 }, // Ą
-    { 16, 24, 21, 2, 16, 96, 21429 }, // ą
-    { 22, 31, 25, 2, 31, 171, 21525 }, // Ć
-    { 15, 21, 20, 2, 21, 79, 21696 }, // ć
-    { 24, 32, 27, 2, 32, 192, 21775 }, // Ĉ
-    { 18, 24, 21, 2, 24, 108, 21967 }, // ĉ
-    { 22, 31, 25, 2, 31, 171, 22075 }, // Ċ
-    { 16, 22, 20, 2, 22, 88, 22246 }, // ċ
-    { 25, 33, 28, 2, 33, 207, 22334 }, // Č
-    { 20, 24, 23, 2, 24, 120, 22541 }, // č
-    { 24, 31, 26, 1, 31, 186, 22661 }, // Ď
-    { 25, 22, 28, 2, 21, 138, 22847 }, // ď
-    { 25, 21, 26, 0, 21, 132, 22985 }, // Đ
-    { 24, 22, 27, 2, 21, 132, 23117 }, // đ
-    { 23, 30, 25, 1, 30, 173, 23249 }, // Ē
-    { 20, 28, 23, 2, 27, 140, 23422 }, // ē
-    { 23, 30, 25, 1, 30, 173, 23562 }, // Ĕ
-    { 21, 28, 24, 2, 27, 147, 23735 }, // ĕ
-    { 22, 31, 24, 1, 31, 171, 23882 }, // Ė
-    { 18, 28, 21, 2, 27, 126, 24053 }, // ė
-    { 22, 28, 24, 1, 21, 154, 24179 }, // Ę
-    { 17, 25, 21, 2, 15, 107, 24333 }, // ę
-    { 24, 33, 26, 1, 33, 198, 24440 }, // Ě
-    { 21, 30, 24, 2, 29, 158, 24638 }, // ě
-    { 26, 34, 29, 2, 33, 221, 24796 }, // Ĝ
-    { 23, 34, 24, 0, 26, 196, 25017 }, // ĝ
-    { 27, 33, 30, 2, 32, 223, 25213 }, // Ğ
-    { 23, 32, 24, 0, 24, 184, 25436 }, // ğ
-    { 23, 33, 28, 2, 32, 190, 25620 }, // Ġ
-    { 20, 33, 21, 0, 25, 165, 25810 }, // ġ
-    { 24, 38, 28, 2, 37, 228, 25975 }, // Ģ
-    { 21, 34, 22, 0, 26, 179, 26203 }, // ģ
-    { 24, 31, 26, 1, 31, 186, 26382 }, // Ĥ
-    { 18, 31, 22, 1, 30, 140, 26568 }, // ĥ
-    { 25, 21, 27, 1, 21, 132, 26708 }, // Ħ
-    { 18, 22, 22, 1, 21, 99, 26840 }, // ħ
-    { 17, 34, 19, 1, 33, 145, 26939 }, // Ĩ
-    { 13, 25, 15, 1, 24, 82, 27084 }, // ĩ
-    { 18, 33, 20, 1, 32, 149, 27166 }, // Ī
-    { 14, 25, 16, 1, 24, 88, 27315 }, // ī
-    { 14, 29, 14, -1, 22, 102, 27403 }, // Į
-    { 15, 32, 14, -2, 24, 120, 27505 }, // į
-    { 16, 34, 18, 1, 33, 136, 27625 }, // İ
-    { 8, 16, 11, 1, 15, 32, 27761 }, // ı
-    { 25, 33, 40, 7, 22, 207, 27793 }, // Ĳ
-    { 24, 30, 26, 1, 23, 180, 28000 }, // ĳ
-    { 26, 37, 27, 0, 31, 241, 28180 }, // Ĵ
-    { 21, 32, 24, 2, 25, 168, 28421 }, // ĵ
-    { 23, 34, 26, 1, 34, 196, 28589 }, // Ķ
-    { 18, 34, 22, -1, 21, 153, 28785 }, // ķ
-    { 14, 14, 16, -2, 14, 49, 28938 }, // ĸ
-    { 17, 28, 22, 1, 28, 119, 28987 }, // Ĺ
-    { 16, 33, 18, 1, 33, 132, 29106 }, // ĺ
-    { 17, 34, 22, 1, 21, 145, 29238 }, // Ļ
-    { 15, 36, 15, -2, 22, 135, 29383 }, // ļ
-    { 19, 21, 22, 1, 21, 100, 29518 }, // Ľ
-    { 19, 26, 21, 1, 26, 124, 29618 }, // ľ
-    { 19, 21, 22, 1, 21, 100, 29742 }, // Ŀ
-    { 16, 22, 18, 1, 22, 88, 29842 }, // ŀ
-    { 38, 35, 27, -12, 28, 333, 29930 }, // Ł
-    { 27, 22, 19, -9, 22, 149, 30263 }, // ł
-    { 25, 30, 27, 1, 30, 188, 30412 }, // Ń
-    { 19, 25, 22, 1, 25, 119, 30600 }, // ń
-    { 25, 31, 27, 1, 21, 194, 30719 }, // Ņ
-    { 18, 26, 22, 1, 16, 117, 30913 }, // ņ
-    { 26, 32, 28, 1, 32, 208, 31030 }, // Ň
-    { 23, 27, 25, 1, 27, 156, 31238 }, // ň
-    { 33, 26, 22, -14, 26, 215, 31394 }, // ŉ
-    { 25, 27, 27, 1, 21, 169, 31609 }, // Ŋ
-    { 18, 21, 22, 1, 16, 95, 31778 }, // ŋ
-    { 25, 32, 28, 2, 30, 200, 31873 }, // Ō
-    { 19, 25, 22, 2, 24, 119, 32073 }, // ō
-    { 25, 33, 28, 2, 31, 207, 32192 }, // Ŏ
-    { 20, 25, 23, 2, 24, 125, 32399 }, // ŏ
-    { 28, 32, 31, 2, 30, 224, 32524 }, // Ő
-    { 23, 24, 26, 2, 23, 138, 32748 }, // ő
-    { 35, 24, 38, 2, 22, 210, 32886 }, // Œ
-    { 27, 16, 30, 2, 15, 108, 33096 }, // œ
-    { 20, 30, 24, 1, 29, 150, 33204 }, // Ŕ
-    { 15, 23, 18, 1, 22, 87, 33354 }, // ŕ
-    { 20, 35, 24, 1, 34, 175, 33441 }, // Ŗ
-    { 15, 28, 18, 1, 27, 105, 33616 }, // ŗ
-    { 23, 32, 25, 1, 31, 184, 33721 }, // Ř
-    { 18, 25, 20, 1, 24, 113, 33905 }, // ř
-    { 21, 30, 26, 2, 29, 158, 34018 }, // Ś
-    { 16, 24, 21, 2, 22, 96, 34176 }, // ś
-    { 23, 31, 26, 2, 30, 179, 34272 }, // Ŝ
-    { 19, 26, 22, 2, 24, 124, 34451 }, // ŝ
-    { 21, 28, 26, 2, 21, 147, 34575 }, // Ş
-    { 16, 24, 21, 2, 16, 96, 34722 }, // ş
-    { 24, 32, 27, 2, 31, 192, 34818 }, // Š
-    { 20, 26, 23, 2, 24, 130, 35010 }, // š
-    { 20, 29, 27, 6, 22, 145, 35140 }, // Ţ
-    { 14, 26, 20, 3, 20, 91, 35285 }, // ţ
-    { 20, 32, 27, 6, 32, 160, 35376 }, // Ť
-    { 20, 23, 25, 4, 23, 115, 35536 }, // ť
-    { 20, 22, 27, 6, 22, 110, 35651 }, // Ŧ
-    { 15, 20, 20, 2, 20, 75, 35761 }, // ŧ
-    { 24, 34, 27, 2, 32, 204, 35836 }, // Ũ
-    { 17, 25, 21, 3, 24, 107, 36040 }, // ũ
-    { 24, 33, 27, 2, 31, 198, 36147 }, // Ū
-    { 18, 25, 22, 3, 24, 113, 36345 }, // ū
-    { 24, 33, 27, 2, 31, 198, 36458 }, // Ŭ
-    { 19, 25, 23, 3, 24, 119, 36656 }, // ŭ
-    { 24, 35, 27, 2, 33, 210, 36775 }, // Ů
-    { 16, 27, 21, 3, 26, 108, 36985 }, // ů
-    { 27, 32, 30, 2, 30, 216, 37093 }, // Ű
-    { 22, 24, 26, 3, 23, 132, 37309 }, // ű
-    { 24, 28, 27, 2, 21, 168, 37441 }, // Ų
-    { 16, 23, 21, 3, 15, 92, 37609 }, // ų
-    { 30, 31, 37, 6, 31, 233, 37701 }, // Ŵ
-    { 21, 26, 28, 5, 25, 137, 37934 }, // ŵ
-    { 20, 33, 28, 7, 33, 165, 38071 }, // Ŷ
-    { 21, 33, 23, 1, 26, 174, 38236 }, // ŷ
-    { 20, 33, 28, 7, 33, 165, 38410 }, // Ÿ
-    { 26, 28, 28, 1, 28, 182, 38575 }, // Ź
-    { 19, 24, 22, 1, 24, 114, 38757 }, // ź
-    { 26, 29, 28, 1, 29, 189, 38871 }, // Ż
-    { 19, 24, 22, 1, 24, 114, 39060 }, // ż
-    { 26, 31, 28, 1, 31, 202, 39174 }, // Ž
-    { 23, 26, 25, 1, 26, 150, 39376 }, // ž
-    { 15, 21, 18, 2, 21, 79, 39526 }, // ſ
-    { 30, 27, 33, 2, 25, 203, 39605 }, // Ơ
-    { 20, 18, 23, 2, 17, 90, 39808 }, // ơ
-    { 21, 22, 23, 1, 22, 116, 39898 }, // Ƥ
-    { 22, 26, 23, -1, 19, 143, 40014 }, // ƥ
-    { 18, 20, 20, 1, 19, 90, 40157 }, // Ʃ
-    { 22, 22, 27, 4, 22, 121, 40247 }, // Ƭ
-    { 15, 24, 20, 4, 24, 90, 40368 }, // ƭ
-    { 20, 26, 27, 6, 22, 130, 40458 }, // Ʈ
-    { 27, 28, 30, 2, 26, 189, 40588 }, // Ư
-    { 20, 21, 24, 3, 20, 105, 40777 }, // ư
-    { 10, 6, 16, 5, 20, 15, 40882 }, // ̀
-    { 8, 6, 13, 4, 19, 12, 40897 }, // ́
-    { 14, 7, 14, -1, 1, 25, 40909 }, // ̂
-    { 11, 5, 17, 5, 19, 14, 40934 }, // ̃
-    { 14, 4, 20, 5, 17, 14, 40948 }, // ̄
-    { 18, 4, 25, 6, 23, 18, 40962 }, // ̅
-    { 13, 6, 19, 5, 18, 20, 40980 }, // ̆
-    { 7, 6, 13, 5, 21, 11, 41000 }, // ̇
-    { 13, 5, 17, 3, 18, 17, 41011 }, // ̈
-    { 5, 6, 15, 9, 16, 8, 41028 }, // ̉
-    { 7, 7, 13, 5, 20, 13, 41036 }, // ̊
-    { 20, 6, 26, 5, 20, 30, 41049 }, // ̋
-    { 14, 7, 20, 5, 20, 25, 41079 }, // ̌
-    { 21, 6, 13, -9, 20, 32, 41104 }, // ̏
-    { 11, 9, 15, 3, 20, 25, 41136 }, // ̒
-    { 11, 9, 15, 3, 19, 25, 41161 }, // ̓
-    { 11, 9, 6, -6, 19, 25, 41186 }, // ̔
-    { 7, 7, 8, 0, 0, 13, 41211 }, // ̘
-    { 7, 7, 9, 1, 0, 13, 41224 }, // ̙
-    { 12, 8, 19, 6, 21, 24, 41237 }, // ̚
-    { 7, 8, 11, 3, 17, 14, 41261 }, // ̛
-    { 6, 8, 6, -1, 0, 12, 41275 }, // ̜
-    { 7, 7, 10, 2, 5, 13, 41287 }, // ̝
-    { 7, 7, 7, -1, 0, 13, 41300 }, // ̞
-    { 6, 6, 7, 0, -2, 9, 41313 }, // ̟
-    { 14, 4, 14, -1, -3, 14, 41322 }, // ̠
-    { 7, 6, 5, -3, 2, 11, 41336 }, // ̣
-    { 12, 5, 11, -2, -2, 15, 41347 }, // ̤
-    { 7, 7, 13, 5, 20, 13, 41362 }, // ̥
-    { 11, 9, 11, -1, 4, 25, 41375 }, // ̦
-    { 8, 8, 8, -1, 1, 16, 41400 }, // ̧
-    { 8, 9, 9, 0, 1, 18, 41416 }, // ̨
-    { 8, 9, 7, -2, 0, 18, 41434 }, // ̩
-    { 12, 6, 12, -1, 0, 18, 41452 }, // ̪
-    { 16, 8, 16, -1, 1, 32, 41470 }, // ̬
-    { 16, 8, 16, -1, 1, 32, 41502 }, // ̭
-    { 12, 6, 19, 6, 21, 18, 41534 }, // ̰
-    { 13, 4, 20, 6, 21, 13, 41552 }, // ̱
-    { 14, 4, 13, -2, -1, 14, 41565 }, // ̲
-    { 13, 6, 20, 6, 21, 20, 41579 }, // ̴
-    { 14, 3, 17, 2, 9, 11, 41599 }, // ̵
-    { 7, 9, 9, 1, 0, 16, 41610 }, // ̹
-    { 14, 8, 11, -4, 1, 28, 41626 }, // ̺
-    { 13, 8, 12, -2, 1, 26, 41654 }, // ̻
-    { 11, 7, 11, -1, 1, 20, 41680 }, // ̼
-    { 9, 6, 15, 5, 19, 14, 41700 }, // ̽
-    { 11, 5, 17, 5, 19, 14, 41714 }, // ͂
-    { 6, 7, 17, 10, 22, 11, 41728 }, // ̓
-    { 15, 19, 20, 4, 32, 72, 41739 }, // ̈́
-    { 12, 7, 17, 4, 21, 21, 41811 }, // ͆
-    { 16, 10, 15, -2, 0, 40, 41832 }, // ͇
-    { 13, 8, 13, -1, 1, 26, 41872 }, // ͈
-    { 10, 8, 10, -1, -1, 20, 41898 }, // ͉
-    { 18, 21, 23, 4, 27, 95, 41918 }, // ͊
-    { 26, 20, 35, 8, 30, 130, 42013 }, // ͋
-    { 18, 14, 32, 13, 14, 63, 42143 }, // ͌
-    { 13, 28, 15, 1, 9, 91, 42206 }, // ͍
-    { 5, 4, 18, 12, 3, 5, 42297 }, // ͎
-    { 22, 7, 23, 0, 1, 39, 42302 }, // ͜
-    { 22, 6, 27, 4, 20, 33, 42341 }, // ͡
-    { 27, 8, 27, -1, -1, 54, 42374 }, // ͢
-    { 22, 21, 28, 1, 21, 116, 42428 }, // Α
-    { 21, 21, 23, 1, 21, 111, 42544 }, // Β
-    { 19, 22, 20, 0, 19, 105, 42655 }, // Γ
-    { 20, 20, 22, 1, 19, 100, 42760 }, // Δ
-    { 22, 21, 24, 1, 21, 116, 42860 }, // Ε
-    { 26, 21, 28, 1, 21, 137, 42976 }, // Ζ
-    { 24, 21, 26, 1, 21, 126, 43113 }, // Η
-    { 25, 24, 28, 2, 22, 150, 43239 }, // Θ
-    { 12, 23, 14, 1, 22, 69, 43389 }, // Ι
-    { 23, 21, 26, 1, 21, 121, 43458 }, // Κ
-    { 21, 21, 53, 31, 21, 111, 43579 }, // Λ
-    { 27, 21, 29, 1, 21, 142, 43690 }, // Μ
-    { 25, 21, 27, 1, 21, 132, 43832 }, // Ν
-    { 21, 20, 23, 1, 19, 105, 43964 }, // Ξ
-    { 25, 24, 28, 2, 22, 150, 44069 }, // Ο
-    { 19, 19, 21, 1, 18, 91, 44219 }, // Π
-    { 21, 22, 23, 1, 22, 116, 44310 }, // Ρ
-    { 19, 20, 20, 0, 19, 95, 44426 }, // Σ
-    { 20, 22, 27, 6, 22, 110, 44521 }, // Τ
-    { 20, 21, 28, 7, 21, 105, 44631 }, // Υ
-    { 30, 28, 36, 5, 22, 210, 44736 }, // Φ
-    { 26, 21, 28, 1, 21, 137, 44946 }, // Χ
-    { 22, 23, 26, 3, 20, 127, 45083 }, // Ψ
-    { 24, 22, 26, 1, 20, 132, 45210 }, // Ω
-    { 20, 19, 24, 2, 16, 95, 45342 }, // α
-    { 20, 31, 20, -1, 25, 155, 45437 }, // β
-    { 15, 23, 20, 4, 15, 87, 45592 }, // γ
-    { 19, 23, 21, 1, 22, 110, 45679 }, // δ
-    { 13, 14, 15, 1, 13, 46, 45789 }, // ε
-    { 16, 23, 19, 2, 19, 92, 45835 }, // ζ
-    { 18, 24, 21, 2, 17, 108, 45927 }, // η
-    { 18, 21, 21, 2, 20, 95, 46035 }, // θ
-    { 10, 18, 16, 1, 17, 45, 46130 }, // ι
-    { 16, 15, 18, -2, 15, 60, 46175 }, // κ
-    { 21, 22, 21, -19, 21, 116, 46235 }, // λ
-    { 20, 19, 21, -1, 15, 95, 46351 }, // μ
-    { 15, 16, 20, 4, 15, 60, 46446 }, // ν
-    { 14, 23, 18, 3, 19, 81, 46506 }, // ξ
-    { 17, 16, 21, 2, 15, 68, 46587 }, // ο
-    { 19, 15, 22, 2, 14, 72, 46655 }, // π
-    { 21, 21, 21, -1, 15, 111, 46727 }, // ρ
-    { 14, 19, 18, 3, 19, 67, 46838 }, // ς
-    { 22, 16, 25, 2, 15, 88, 46905 }, // σ
-    { 15, 15, 20, 4, 14, 57, 46993 }, // τ
-    { 14, 16, 17, 2, 15, 56, 47050 }, // υ
-    { 25, 33, 28, 2, 27, 207, 47106 }, // φ
-    { 24, 21, 24, -1, 15, 126, 47313 }, // χ
-    { 16, 28, 19, 2, 20, 112, 47439 }, // ψ
-    { 20, 15, 23, 2, 13, 75, 47551 }, // ω
-    { 22, 28, 28, 1, 21, 154, 47626 }, // Ạ
-    { 18, 26, 21, 0, 16, 117, 47780 }, // ạ
-    { 22, 30, 28, 1, 30, 165, 47897 }, // Ả
-    { 16, 26, 21, 2, 25, 104, 48062 }, // ả
-    { 24, 37, 28, 1, 37, 222, 48166 }, // Ấ
-    { 24, 29, 27, 2, 28, 174, 48388 }, // ấ
-    { 24, 33, 28, 1, 33, 198, 48562 }, // Ầ
-    { 17, 30, 21, 2, 29, 128, 48760 }, // ầ
-    { 24, 38, 28, 1, 38, 228, 48888 }, // Ẩ
-    { 23, 31, 26, 2, 30, 179, 49116 }, // ẩ
-    { 25, 36, 28, 1, 36, 225, 49295 }, // Ẫ
-    { 19, 31, 22, 2, 30, 148, 49520 }, // ẫ
-    { 23, 36, 28, 1, 29, 207, 49668 }, // Ậ
-    { 19, 34, 21, 0, 24, 162, 49875 }, // ậ
-    { 26, 38, 28, 1, 38, 247, 50037 }, // Ắ
-    { 20, 34, 23, 2, 33, 170, 50284 }, // ắ
-    { 26, 38, 28, 1, 38, 247, 50454 }, // Ằ
-    { 20, 34, 23, 2, 33, 170, 50701 }, // ằ
-    { 26, 39, 28, 1, 39, 254, 50871 }, // Ẳ
-    { 19, 35, 22, 2, 34, 167, 51125 }, // ẳ
-    { 26, 39, 28, 1, 39, 254, 51292 }, // Ẵ
-    { 20, 34, 23, 2, 33, 170, 51546 }, // ẵ
-    { 26, 37, 28, 1, 30, 241, 51716 }, // Ặ
-    { 22, 34, 23, 0, 24, 187, 51957 }, // ặ
-    { 22, 31, 24, 1, 21, 171, 52144 }, // Ẹ
-    { 18, 26, 21, 1, 15, 117, 52315 }, // ẹ
-    { 22, 31, 24, 1, 31, 171, 52432 }, // Ẻ
-    { 17, 28, 21, 2, 27, 119, 52603 }, // ẻ
-    { 22, 31, 24, 1, 31, 171, 52722 }, // Ẽ
-    { 19, 28, 22, 2, 27, 133, 52893 }, // ẽ
-    { 26, 34, 28, 1, 34, 221, 53026 }, // Ế
-    { 28, 28, 31, 2, 27, 196, 53247 }, // ế
-    { 27, 34, 29, 1, 34, 230, 53443 }, // Ề
-    { 18, 31, 21, 2, 30, 140, 53673 }, // ề
-    { 26, 34, 28, 1, 34, 221, 53813 }, // Ể
-    { 24, 33, 27, 2, 32, 198, 54034 }, // ể
-    { 22, 36, 24, 1, 36, 198, 54232 }, // Ễ
-    { 22, 34, 25, 2, 33, 187, 54430 }, // ễ
-    { 22, 40, 24, 1, 30, 220, 54617 }, // Ệ
-    { 19, 37, 21, 1, 26, 176, 54837 }, // ệ
-    { 15, 34, 17, 1, 33, 128, 55013 }, // Ỉ
-    { 11, 25, 13, 1, 24, 69, 55141 }, // ỉ
-    { 17, 34, 14, -4, 22, 145, 55210 }, // Ị
-    { 16, 35, 14, -3, 24, 140, 55355 }, // ị
-    { 25, 35, 28, 2, 22, 219, 55495 }, // Ọ
-    { 18, 26, 21, 1, 15, 117, 55714 }, // ọ
-    { 25, 33, 28, 2, 31, 207, 55831 }, // Ỏ
-    { 17, 25, 21, 2, 24, 107, 56038 }, // ỏ
-    { 29, 32, 32, 2, 30, 232, 56145 }, // Ố
-    { 26, 26, 29, 2, 25, 169, 56377 }, // ố
-    { 25, 35, 28, 2, 33, 219, 56546 }, // Ồ
-    { 17, 29, 21, 2, 28, 124, 56765 }, // ồ
-    { 25, 36, 28, 2, 34, 225, 56889 }, // Ổ
-    { 23, 30, 26, 2, 29, 173, 57114 }, // ổ
-    { 25, 38, 28, 2, 36, 238, 57287 }, // Ỗ
-    { 19, 30, 22, 2, 29, 143, 57525 }, // ỗ
-    { 25, 43, 28, 2, 30, 269, 57668 }, // Ộ
-    { 18, 34, 21, 1, 23, 153, 57937 }, // ộ
-    { 30, 33, 33, 2, 31, 248, 58090 }, // Ớ
-    { 20, 24, 23, 2, 23, 120, 58338 }, // ớ
-    { 30, 33, 33, 2, 31, 248, 58458 }, // Ờ
-    { 20, 25, 23, 2, 24, 125, 58706 }, // ờ
-    { 30, 33, 33, 2, 31, 248, 58831 }, // Ở
-    { 20, 25, 23, 2, 24, 125, 59079 }, // ở
-    { 30, 33, 33, 2, 31, 248, 59204 }, // Ỡ
-    { 20, 25, 23, 2, 24, 125, 59452 }, // ỡ
-    { 30, 38, 33, 2, 25, 285, 59577 }, // Ợ
-    { 21, 28, 23, 1, 17, 147, 59862 }, // ợ
-    { 24, 32, 27, 2, 21, 192, 60009 }, // Ụ
-    { 19, 28, 21, 0, 15, 133, 60201 }, // ụ
-    { 24, 34, 27, 2, 32, 204, 60334 }, // Ủ
-    { 16, 25, 21, 3, 24, 100, 60538 }, // ủ
-    { 27, 33, 30, 2, 31, 223, 60638 }, // Ứ
-    { 20, 25, 24, 3, 24, 125, 60861 }, // ứ
-    { 27, 33, 30, 2, 31, 223, 60986 }, // Ừ
-    { 20, 25, 24, 3, 24, 125, 61209 }, // ừ
-    { 27, 34, 30, 2, 32, 230, 61334 }, // Ử
-    { 20, 25, 24, 3, 24, 125, 61564 }, // ử
-    { 27, 34, 30, 2, 32, 230, 61689 }, // Ữ
-    { 20, 25, 24, 3, 24, 125, 61919 }, // ữ
-    { 27, 37, 30, 2, 26, 250, 62044 }, // Ự
-    { 23, 33, 24, 0, 20, 190, 62294 }, // ự
-    { 20, 32, 28, 7, 32, 160, 62484 }, // Ỳ
-    { 21, 32, 23, 1, 25, 168, 62644 }, // ỳ
-    { 25, 34, 28, 2, 21, 213, 62812 }, // Ỵ
-    { 21, 24, 23, 1, 14, 126, 63025 }, // ỵ
-    { 20, 33, 28, 7, 33, 165, 63151 }, // Ỷ
-    { 21, 34, 23, 1, 27, 179, 63316 }, // ỷ
-    { 20, 34, 28, 7, 34, 170, 63495 }, // Ỹ
-    { 21, 34, 23, 1, 27, 179, 63665 }, // ỹ
-    { 0, 0, 17, 0, 0, 0, 63844 }, //  
-    { 0, 0, 29, 0, 0, 0, 63844 }, //  
-    { 0, 0, 17, 0, 0, 0, 63844 }, //  
-    { 0, 0, 29, 0, 0, 0, 63844 }, //  
-    { 0, 0, 12, 0, 0, 0, 63844 }, //  
-    { 0, 0, 10, 0, 0, 0, 63844 }, //  
-    { 0, 0, 8, 0, 0, 0, 63844 }, //  
-    { 0, 0, 18, 0, 0, 0, 63844 }, //  
-    { 0, 0, 7, 0, 0, 0, 63844 }, //  
-    { 0, 0, 9, 0, 0, 0, 63844 }, //  
-    { 0, 0, 8, 0, 0, 0, 63844 }, //  
-    { 0, 0, 4, 0, 0, 0, 63844 }, // ​
-    { 0, 0, 1, 0, 0, 0, 63844 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 63844 }, // ‍
-    { 0, 0, 1, 0, 0, 0, 63844 }, // ‎
-    { 0, 0, 1, 0, 0, 0, 63844 }, // ‏
-    { 14, 3, 17, 2, 9, 11, 63844 }, // ‐
-    { 14, 3, 17, 2, 9, 11, 63855 }, // ‑
-    { 21, 3, 21, -1, 9, 16, 63866 }, // ‒
-    { 20, 5, 23, 2, 10, 25, 63882 }, // –
-    { 28, 5, 31, 2, 10, 35, 63907 }, // —
-    { 28, 5, 31, 2, 10, 35, 63942 }, // ―
-    { 18, 23, 20, 1, 18, 104, 63977 }, // ‖
-    { 23, 8, 19, -5, -2, 46, 64081 }, // ‗
-    { 11, 9, 17, 5, 22, 25, 64127 }, // ‘
-    { 11, 9, 17, 5, 22, 25, 64152 }, // ’
-    { 11, 9, 10, -2, 4, 25, 64177 }, // ‚
-    { 11, 9, 17, 5, 22, 25, 64202 }, // ‛
-    { 19, 9, 25, 5, 22, 43, 64227 }, // “
-    { 19, 9, 25, 5, 22, 43, 64270 }, // ”
-    { 11, 9, 10, -2, 4, 25, 64313 }, // „
-    { 19, 9, 25, 5, 22, 43, 64338 }, // ‟
-    { 15, 35, 22, 6, 26, 132, 64381 }, // †
-    { 18, 35, 24, 5, 26, 158, 64513 }, // ‡
-    { 23, 19, 21, -3, 22, 110, 64671 }, // •
-    { 10, 9, 15, 4, 11, 23, 64781 }, // ‣
-    { 7, 6, 15, 4, 6, 11, 64804 }, // ․
-    { 7, 6, 15, 4, 6, 11, 64815 }, // ‥
-    { 24, 6, 25, 0, 6, 36, 64826 }, // …
-    { 4, 3, 14, 5, 9, 3, 64862 }, // ‧
-    { 0, 0, 28, 0, 0, 0, 64865 }, //  
-    { 23, 22, 28, 3, 20, 127, 64865 }, // ‰
-    { 11, 9, 20, 8, 22, 25, 64992 }, // ′
-    { 19, 9, 28, 8, 22, 43, 65017 }, // ″
-    { 18, 8, 17, -2, 21, 36, 65060 }, // ‴
-    { 6, 8, 14, 7, 21, 12, 65096 }, // ‵
-    { 11, 8, 17, 5, 21, 22, 65108 }, // ‶
-    { 19, 8, 20, 0, 21, 38, 65130 }, // ‷
-    { 15, 6, 21, 5, 21, 23, 65168 }, // ‸
-    { 10, 14, 14, 3, 14, 35, 65191 }, // ‹
-    { 11, 14, 10, -3, 14, 39, 65226 }, // ›
-    { 33, 32, 36, 2, 25, 264, 65265 }, // ※
-    { 15, 32, 18, 2, 28, 120, 65529 }, // ‼
-    { 20, 40, 25, 4, 34, 200, 65649 }, // ‽
-    { 14, 3, 20, 5, 21, 11, 65849 }, // ‾
-    { 13, 6, 19, 5, 17, 20, 65860 }, // ‿
-    { 18, 17, 21, 2, 23, 77, 65880 }, // ⁂
-    { 23, 22, 32, 5, 20, 127, 65957 }, // ⁄
-    { 34, 31, 41, 6, 28, 264, 66084 }, // ⁇
-    { 29, 32, 35, 5, 28, 232, 66348 }, // ⁈
-    { 28, 32, 27, -2, 28, 224, 66580 }, // ⁉
-    { 29, 44, 28, -2, 30, 319, 66804 }, // ⁒
-    { 0, 0, 117, 0, 0, 0, 67123 }, //  
-    { 9, 10, 19, 9, 21, 23, 67123 }, // ⁰
-    { 8, 9, 19, 10, 21, 18, 67146 }, // ⁴
-    { 9, 11, 19, 9, 22, 25, 67164 }, // ⁵
-    { 9, 10, 19, 9, 21, 23, 67189 }, // ⁶
-    { 8, 11, 20, 11, 22, 22, 67212 }, // ⁷
-    { 9, 11, 19, 9, 21, 25, 67234 }, // ⁸
-    { 9, 11, 19, 9, 21, 25, 67259 }, // ⁹
-    { 18, 16, 22, 1, 16, 72, 67284 }, // ⁿ
-    { 10, 10, 9, -8, 6, 25, 67356 }, // ₀
-    { 7, 11, 8, -8, 6, 20, 67381 }, // ₁
-    { 10, 11, 9, -8, 6, 28, 67401 }, // ₂
-    { 10, 10, 9, -8, 6, 25, 67429 }, // ₃
-    { 9, 10, 9, -8, 6, 23, 67454 }, // ₄
-    { 9, 10, 8, -8, 6, 23, 67477 }, // ₅
-    { 10, 10, 9, -8, 6, 25, 67500 }, // ₆
-    { 8, 11, 9, -6, 6, 22, 67525 }, // ₇
-    { 10, 11, 9, -8, 6, 28, 67547 }, // ₈
-    { 10, 11, 9, -8, 6, 28, 67575 }, // ₉
-    { 18, 35, 20, 1, 26, 158, 67603 }, // ₍
-    { 17, 35, 11, -8, 26, 149, 67761 }, // ₎
-    { 23, 33, 27, 3, 28, 190, 67910 }, // ₡
-    { 22, 23, 25, 2, 23, 127, 68100 }, // ₢
-    { 19, 23, 21, 1, 22, 110, 68227 }, // ₤
-    { 29, 21, 29, -1, 21, 153, 68337 }, // ₦
-    { 24, 22, 26, 1, 22, 132, 68490 }, // ₧
-    { 30, 23, 33, -1, 21, 173, 68622 }, // ₨
-    { 23, 22, 22, -2, 22, 127, 68795 }, // ₩
-    { 24, 19, 29, 4, 19, 114, 68922 }, // ₪
-    { 22, 22, 21, -2, 21, 121, 69036 }, // ₫
-    { 20, 24, 23, 2, 21, 120, 69157 }, // €
-    { 20, 22, 27, 6, 22, 110, 69277 }, // ₮
-    { 27, 22, 28, 0, 22, 149, 69387 }, // ₱
-    { 23, 33, 28, 2, 28, 190, 69536 }, // ₲
-    { 29, 21, 37, 7, 19, 153, 69726 }, // ₴
-    { 14, 21, 17, 2, 18, 74, 69879 }, // ₵
-    { 24, 23, 31, 6, 23, 138, 69953 }, // ₸
-    { 16, 21, 21, 4, 20, 84, 70091 }, // ₹
-    { 16, 19, 19, 2, 17, 76, 70175 }, // ₺
-    { 20, 21, 24, 3, 19, 105, 70251 }, // ₼
-    { 25, 22, 23, -3, 22, 138, 70356 }, // ₽
-    { 17, 18, 18, -4, 13, 77, 70494 }, // ←
-    { 18, 18, 22, 3, 17, 81, 70571 }, // ↑
-    { 18, 18, 24, 5, 13, 81, 70652 }, // →
-    { 18, 18, 26, 7, 16, 81, 70733 }, // ↓
-    { 28, 15, 28, -1, 12, 105, 70814 }, // ↔
-    { 15, 28, 20, 4, 27, 105, 70919 }, // ↕
-    { 17, 12, 20, -2, 11, 51, 71024 }, // ↖
-    { 17, 12, 21, 3, 11, 51, 71075 }, // ↗
-    { 14, 17, 20, 5, 15, 60, 71126 }, // ↘
-    { 14, 17, 16, -3, 15, 60, 71186 }, // ↙
-    { 20, 18, 24, 1, 16, 90, 71246 }, // ⇐
-    { 22, 20, 28, 5, 19, 110, 71336 }, // ⇑
-    { 21, 18, 25, 3, 16, 95, 71446 }, // ⇒
-    { 22, 20, 33, 10, 18, 110, 71541 }, // ⇓
-    { 26, 18, 28, 1, 16, 117, 71651 }, // ⇔
-    { 18, 25, 25, 6, 14, 113, 71768 }, // ⇕
-    { 20, 22, 22, 1, 21, 110, 71881 }, // ∂
-    { 27, 26, 28, 0, 24, 176, 71991 }, // ∅
-    { 20, 20, 22, 1, 19, 100, 72167 }, // ∆
-    { 19, 20, 23, 3, 19, 95, 72267 }, // ∏
-    { 20, 19, 28, 7, 18, 95, 72362 }, // ∐
-    { 18, 20, 20, 1, 19, 90, 72457 }, // ∑
-    { 14, 4, 17, 2, 9, 14, 72547 }, // −
-    { 25, 23, 29, 3, 21, 144, 72561 }, // √
-    { 23, 14, 26, 2, 16, 81, 72705 }, // ∞
-    { 26, 27, 27, 0, 20, 176, 72786 }, // ∫
-    { 10, 17, 12, 1, 17, 43, 72962 }, // ∶
-    { 18, 14, 36, 13, 14, 63, 73005 }, // ≈
-    { 23, 22, 32, 5, 20, 127, 73068 }, // ≠
-    { 24, 21, 22, -3, 18, 126, 73195 }, // ≤
-    { 24, 22, 25, 0, 19, 132, 73321 }, // ≥
+    { 14, 32, 14, -1, 28, 58, 0 }, // !
+    { 17, 9, 20, 2, 22, 37, 58 }, // "
+    { 31, 23, 32, 0, 21, 107, 95 }, // #
+    { 23, 30, 29, 3, 24, 93, 202 }, // $
+    { 23, 22, 29, 5, 20, 85, 295 }, // %
+    { 19, 22, 24, 4, 20, 76, 380 }, // &
+    { 8, 9, 13, 4, 20, 19, 456 }, // '
+    { 18, 35, 20, 1, 26, 73, 475 }, // (
+    { 17, 35, 11, -8, 26, 71, 548 }, // )
+    { 15, 14, 20, 4, 20, 41, 619 }, // *
+    { 15, 14, 18, 2, 14, 29, 660 }, // +
+    { 11, 9, 10, -2, 4, 19, 689 }, // ,
+    { 14, 3, 17, 2, 9, 8, 708 }, // -
+    { 7, 6, 8, 0, 6, 12, 716 }, // .
+    { 29, 43, 26, -4, 29, 115, 728 }, // /
+    { 19, 21, 21, 1, 20, 70, 843 }, // 0
+    { 14, 19, 18, 1, 19, 44, 913 }, // 1
+    { 18, 20, 20, 1, 20, 52, 957 }, // 2
+    { 18, 20, 20, 1, 19, 54, 1009 }, // 3
+    { 16, 20, 20, 2, 19, 56, 1063 }, // 4
+    { 17, 21, 19, 1, 20, 53, 1119 }, // 5
+    { 18, 20, 20, 1, 19, 58, 1172 }, // 6
+    { 15, 20, 21, 5, 20, 44, 1230 }, // 7
+    { 18, 20, 20, 1, 19, 62, 1274 }, // 8
+    { 19, 21, 21, 1, 19, 59, 1336 }, // 9
+    { 11, 17, 12, 0, 17, 26, 1395 }, // :
+    { 12, 21, 12, -1, 16, 36, 1421 }, // ;
+    { 21, 17, 20, -2, 17, 50, 1457 }, // <
+    { 16, 10, 18, 1, 12, 30, 1507 }, // =
+    { 21, 17, 23, 1, 17, 50, 1537 }, // >
+    { 18, 31, 23, 4, 28, 71, 1587 }, // ?
+    { 26, 24, 28, 1, 22, 104, 1658 }, // @
+    { 22, 21, 28, 1, 21, 70, 1762 }, // A
+    { 21, 21, 23, 1, 21, 69, 1832 }, // B
+    { 22, 23, 25, 2, 23, 66, 1901 }, // C
+    { 24, 21, 26, 1, 21, 77, 1967 }, // D
+    { 22, 21, 24, 1, 21, 66, 2044 }, // E
+    { 20, 22, 22, 1, 22, 58, 2110 }, // F
+    { 23, 22, 28, 2, 21, 83, 2168 }, // G
+    { 24, 21, 26, 1, 21, 77, 2251 }, // H
+    { 12, 23, 14, 1, 22, 39, 2328 }, // I
+    { 23, 27, 24, 0, 21, 75, 2367 }, // J
+    { 23, 21, 26, 1, 21, 71, 2442 }, // K
+    { 17, 21, 22, 1, 21, 49, 2513 }, // L
+    { 27, 21, 29, 1, 21, 101, 2562 }, // M
+    { 25, 21, 27, 1, 21, 81, 2663 }, // N
+    { 25, 24, 28, 2, 22, 89, 2744 }, // O
+    { 21, 22, 23, 1, 22, 60, 2833 }, // P
+    { 25, 27, 29, 2, 22, 97, 2893 }, // Q
+    { 20, 22, 24, 1, 21, 66, 2990 }, // R
+    { 21, 22, 26, 2, 21, 65, 3056 }, // S
+    { 20, 22, 27, 6, 22, 61, 3121 }, // T
+    { 24, 23, 27, 2, 21, 75, 3182 }, // U
+    { 21, 21, 29, 7, 21, 70, 3257 }, // V
+    { 30, 22, 37, 6, 22, 108, 3327 }, // W
+    { 26, 21, 28, 1, 21, 76, 3435 }, // X
+    { 20, 21, 28, 7, 21, 60, 3511 }, // Y
+    { 26, 21, 28, 1, 21, 73, 3571 }, // Z
+    { 20, 36, 19, -2, 27, 79, 3644 }, // [
+    { 6, 29, 12, 5, 22, 39, 3723 }, // <backslash>
+    { 19, 36, 14, -6, 27, 78, 3762 }, // ]
+    { 15, 7, 19, 3, 24, 17, 3840 }, // ^
+    { 19, 5, 18, -2, -1, 21, 3857 }, // _
+    { 10, 6, 16, 5, 20, 10, 3878 }, // `
+    { 16, 17, 21, 2, 16, 48, 3888 }, // a
+    { 16, 23, 22, 3, 22, 62, 3936 }, // b
+    { 14, 16, 20, 2, 16, 39, 3998 }, // c
+    { 21, 22, 24, 2, 21, 61, 4037 }, // d
+    { 17, 16, 21, 2, 15, 48, 4098 }, // e
+    { 14, 22, 18, 3, 22, 47, 4146 }, // f
+    { 20, 23, 21, 0, 15, 71, 4193 }, // g
+    { 18, 22, 22, 1, 21, 63, 4264 }, // h
+    { 12, 25, 14, 1, 24, 39, 4327 }, // i
+    { 16, 29, 19, 2, 22, 57, 4366 }, // j
+    { 16, 21, 22, 1, 21, 55, 4423 }, // k
+    { 12, 22, 15, 1, 22, 37, 4478 }, // l
+    { 27, 16, 31, 1, 16, 73, 4515 }, // m
+    { 18, 16, 22, 1, 16, 51, 4588 }, // n
+    { 17, 16, 21, 2, 15, 46, 4639 }, // o
+    { 22, 23, 23, -1, 15, 69, 4685 }, // p
+    { 18, 23, 24, 2, 16, 71, 4754 }, // q
+    { 15, 16, 18, 1, 15, 38, 4825 }, // r
+    { 16, 18, 21, 2, 16, 46, 4863 }, // s
+    { 13, 20, 20, 4, 20, 35, 4909 }, // t
+    { 16, 16, 21, 3, 15, 47, 4944 }, // u
+    { 18, 15, 24, 5, 15, 44, 4991 }, // v
+    { 21, 16, 28, 5, 15, 63, 5035 }, // w
+    { 21, 14, 24, 1, 14, 42, 5098 }, // x
+    { 21, 21, 23, 1, 14, 59, 5140 }, // y
+    { 19, 15, 22, 1, 15, 41, 5199 }, // z
+    { 17, 26, 20, 2, 20, 56, 5240 }, // {
+    { 11, 23, 13, 1, 18, 36, 5296 }, // |
+    { 16, 26, 17, -1, 20, 55, 5332 }, // }
+    { 11, 5, 17, 5, 19, 17, 5387 }, // ~
+    { 0, 0, 22, 0, 0, 0, 5404 }, //  
+    { 13, 32, 17, 3, 28, 52, 5404 }, // ¡
+    { 14, 24, 20, 2, 20, 60, 5456 }, // ¢
+    { 19, 23, 21, 1, 22, 64, 5516 }, // £
+    { 17, 15, 20, 2, 17, 44, 5580 }, // ¤
+    { 22, 22, 25, 2, 19, 62, 5624 }, // ¥
+    { 10, 22, 12, 1, 18, 31, 5686 }, // ¦
+    { 19, 22, 21, 1, 20, 67, 5717 }, // §
+    { 14, 6, 19, 4, 21, 23, 5784 }, // ¨
+    { 13, 11, 21, 7, 24, 33, 5807 }, // ©
+    { 10, 9, 18, 7, 19, 25, 5840 }, // ª
+    { 18, 14, 21, 2, 13, 43, 5865 }, // «
+    { 14, 9, 17, 2, 10, 24, 5908 }, // ¬
+    { 15, 3, 18, 2, 9, 8, 5932 }, // ­
+    { 13, 12, 22, 8, 28, 36, 5940 }, // ®
+    { 11, 4, 17, 5, 19, 10, 5976 }, // ¯
+    { 14, 11, 20, 5, 19, 28, 5986 }, // °
+    { 19, 18, 20, 0, 14, 44, 6014 }, // ±
+    { 9, 8, 19, 9, 20, 17, 6058 }, // ²
+    { 10, 10, 19, 8, 21, 21, 6075 }, // ³
+    { 8, 6, 13, 4, 19, 9, 6096 }, // ´
+    { 20, 19, 21, -1, 15, 57, 6105 }, // µ
+    { 19, 22, 22, 2, 18, 78, 6162 }, // ¶
+    { 7, 6, 10, 2, 12, 12, 6240 }, // ·
+    { 8, 8, 8, -1, 1, 16, 6252 }, // ¸
+    { 7, 9, 17, 9, 21, 16, 6268 }, // ¹
+    { 9, 8, 18, 8, 18, 22, 6284 }, // º
+    { 18, 14, 19, -4, 13, 42, 6306 }, // »
+    { 26, 23, 32, 2, 21, 95, 6348 }, // ¼
+    { 28, 23, 32, 2, 21, 98, 6443 }, // ½
+    { 26, 23, 32, 2, 21, 102, 6541 }, // ¾
+    { 19, 31, 18, -2, 18, 71, 6643 }, // ¿
+    { 22, 28, 28, 1, 28, 85, 6714 }, // À
+    { 23, 32, 28, 1, 32, 93, 6799 }, // Á
+    { 23, 29, 28, 1, 29, 92, 6892 }, // Â
+    { 23, 29, 28, 1, 29, 96, 6984 }, // Ã
+    { 25, 30, 28, 1, 30, 103, 7080 }, // Ä
+    { 22, 30, 28, 1, 30, 93, 7183 }, // Å
+    { 35, 22, 37, 1, 21, 105, 7276 }, // Æ
+    { 22, 30, 25, 2, 23, 84, 7381 }, // Ç
+    { 22, 29, 24, 1, 29, 84, 7465 }, // È
+    { 22, 33, 24, 1, 33, 88, 7549 }, // É
+    { 22, 30, 24, 1, 30, 88, 7637 }, // Ê
+    { 22, 31, 24, 1, 31, 96, 7725 }, // Ë
+    { 15, 32, 17, 1, 31, 65, 7821 }, // Ì
+    { 16, 36, 18, 1, 35, 69, 7886 }, // Í
+    { 16, 33, 18, 1, 32, 69, 7955 }, // Î
+    { 18, 33, 20, 1, 32, 77, 8024 }, // Ï
+    { 25, 21, 26, 0, 21, 79, 8101 }, // Ð
+    { 25, 29, 27, 1, 29, 105, 8180 }, // Ñ
+    { 25, 31, 28, 2, 29, 105, 8285 }, // Ò
+    { 25, 35, 28, 2, 33, 111, 8390 }, // Ó
+    { 25, 32, 28, 2, 30, 112, 8501 }, // Ô
+    { 25, 32, 28, 2, 30, 115, 8613 }, // Õ
+    { 25, 33, 28, 2, 31, 118, 8728 }, // Ö
+    { 16, 9, 17, 0, 11, 23, 8846 }, // ×
+    { 50, 46, 41, -10, 34, 242, 8869 }, // Ø
+    { 24, 32, 27, 2, 30, 96, 9111 }, // Ù
+    { 24, 36, 27, 2, 34, 100, 9207 }, // Ú
+    { 24, 33, 27, 2, 31, 100, 9307 }, // Û
+    { 24, 33, 27, 2, 31, 107, 9407 }, // Ü
+    { 20, 36, 28, 7, 36, 84, 9514 }, // Ý
+    { 16, 21, 18, 1, 20, 52, 9598 }, // Þ
+    { 18, 22, 20, 1, 20, 72, 9650 }, // ß
+    { 16, 24, 21, 2, 23, 61, 9722 }, // à
+    { 17, 28, 21, 2, 27, 65, 9783 }, // á
+    { 17, 25, 21, 2, 24, 66, 9848 }, // â
+    { 17, 23, 21, 2, 22, 68, 9914 }, // ã
+    { 19, 26, 22, 2, 25, 74, 9982 }, // ä
+    { 16, 26, 21, 2, 25, 67, 10056 }, // å
+    { 26, 17, 31, 2, 16, 78, 10123 }, // æ
+    { 14, 23, 20, 2, 16, 55, 10201 }, // ç
+    { 17, 26, 21, 2, 25, 63, 10256 }, // è
+    { 18, 31, 21, 2, 30, 70, 10319 }, // é
+    { 18, 27, 21, 2, 26, 71, 10389 }, // ê
+    { 20, 28, 23, 2, 27, 79, 10460 }, // ë
+    { 11, 23, 13, 1, 22, 37, 10539 }, // ì
+    { 13, 28, 15, 1, 27, 46, 10576 }, // í
+    { 14, 24, 14, -1, 23, 50, 10622 }, // î
+    { 13, 24, 15, 1, 23, 50, 10672 }, // ï
+    { 23, 22, 24, 0, 21, 69, 10722 }, // ð
+    { 20, 24, 22, 1, 24, 73, 10791 }, // ñ
+    { 17, 23, 21, 2, 22, 59, 10864 }, // ò
+    { 17, 27, 21, 2, 26, 63, 10923 }, // ó
+    { 17, 24, 21, 2, 23, 64, 10986 }, // ô
+    { 18, 24, 21, 2, 23, 69, 11050 }, // õ
+    { 19, 25, 22, 2, 24, 72, 11119 }, // ö
+    { 19, 18, 24, 4, 17, 44, 11191 }, // ÷
+    { 28, 44, 26, -3, 30, 132, 11235 }, // ø
+    { 16, 24, 21, 3, 23, 61, 11367 }, // ù
+    { 16, 28, 21, 3, 27, 65, 11428 }, // ú
+    { 16, 24, 21, 3, 23, 65, 11493 }, // û
+    { 18, 25, 22, 3, 24, 75, 11558 }, // ü
+    { 21, 36, 23, 1, 29, 84, 11633 }, // ý
+    { 17, 26, 18, 0, 21, 66, 11717 }, // þ
+    { 22, 33, 24, 1, 26, 95, 11783 }, // ÿ
+    { 25, 29, 28, 1, 29, 99, 11878 }, // Ā
+    { 19, 25, 22, 2, 24, 70, 11977 }, // ā
+    { 26, 30, 28, 1, 30, 97, 12047 }, // Ă
+    { 20, 25, 23, 2, 24, 68, 12144 }, // ă
+    { 22, 28, 28, 1, 21, 87, 12212 }, // Ą
+    { 16, 24, 21, 2, 16, 63, 12299 }, // ą
+    { 22, 31, 25, 2, 31, 82, 12362 }, // Ć
+    { 15, 21, 20, 2, 21, 50, 12444 }, // ć
+    { 24, 32, 27, 2, 32, 95, 12494 }, // Ĉ
+    { 18, 24, 21, 2, 24, 61, 12589 }, // ĉ
+    { 22, 31, 25, 2, 31, 83, 12650 }, // Ċ
+    { 16, 22, 20, 2, 22, 53, 12733 }, // ċ
+    { 25, 33, 28, 2, 33, 102, 12786 }, // Č
+    { 20, 24, 23, 2, 24, 67, 12888 }, // č
+    { 24, 31, 26, 1, 31, 105, 12955 }, // Ď
+    { 25, 22, 28, 2, 21, 76, 13060 }, // ď
+    { 25, 21, 26, 0, 21, 79, 13136 }, // Đ
+    { 24, 22, 27, 2, 21, 74, 13215 }, // đ
+    { 23, 30, 25, 1, 30, 95, 13289 }, // Ē
+    { 20, 28, 23, 2, 27, 75, 13384 }, // ē
+    { 23, 30, 25, 1, 30, 91, 13459 }, // Ĕ
+    { 21, 28, 24, 2, 27, 77, 13550 }, // ĕ
+    { 22, 31, 24, 1, 31, 87, 13627 }, // Ė
+    { 18, 28, 21, 2, 27, 69, 13714 }, // ė
+    { 22, 28, 24, 1, 21, 84, 13783 }, // Ę
+    { 17, 25, 21, 2, 15, 66, 13867 }, // ę
+    { 24, 33, 26, 1, 33, 98, 13933 }, // Ě
+    { 21, 30, 24, 2, 29, 82, 14031 }, // ě
+    { 26, 34, 29, 2, 33, 115, 14113 }, // Ĝ
+    { 23, 34, 24, 0, 26, 105, 14228 }, // ĝ
+    { 27, 33, 30, 2, 32, 117, 14333 }, // Ğ
+    { 23, 32, 24, 0, 24, 101, 14450 }, // ğ
+    { 23, 33, 28, 2, 32, 107, 14551 }, // Ġ
+    { 20, 33, 21, 0, 25, 89, 14658 }, // ġ
+    { 24, 38, 28, 2, 37, 120, 14747 }, // Ģ
+    { 21, 34, 22, 0, 26, 100, 14867 }, // ģ
+    { 24, 31, 26, 1, 31, 101, 14967 }, // Ĥ
+    { 18, 31, 22, 1, 30, 82, 15068 }, // ĥ
+    { 25, 21, 27, 1, 21, 82, 15150 }, // Ħ
+    { 18, 22, 22, 1, 21, 68, 15232 }, // ħ
+    { 17, 34, 19, 1, 33, 75, 15300 }, // Ĩ
+    { 13, 25, 15, 1, 24, 52, 15375 }, // ĩ
+    { 18, 33, 20, 1, 32, 73, 15427 }, // Ī
+    { 14, 25, 16, 1, 24, 53, 15500 }, // ī
+    { 14, 29, 14, -1, 22, 58, 15553 }, // Į
+    { 15, 32, 14, -2, 24, 65, 15611 }, // į
+    { 16, 34, 18, 1, 33, 69, 15676 }, // İ
+    { 8, 16, 11, 1, 15, 26, 15745 }, // ı
+    { 25, 33, 40, 7, 22, 108, 15771 }, // Ĳ
+    { 24, 30, 26, 1, 23, 95, 15879 }, // ĳ
+    { 26, 37, 27, 0, 31, 101, 15974 }, // Ĵ
+    { 21, 32, 24, 2, 25, 76, 16075 }, // ĵ
+    { 23, 34, 26, 1, 34, 102, 16151 }, // Ķ
+    { 18, 34, 22, -1, 21, 86, 16253 }, // ķ
+    { 14, 14, 16, -2, 14, 34, 16339 }, // ĸ
+    { 17, 28, 22, 1, 28, 62, 16373 }, // Ĺ
+    { 16, 33, 18, 1, 33, 64, 16435 }, // ĺ
+    { 17, 34, 22, 1, 21, 76, 16499 }, // Ļ
+    { 15, 36, 15, -2, 22, 73, 16575 }, // ļ
+    { 19, 21, 22, 1, 21, 58, 16648 }, // Ľ
+    { 19, 26, 21, 1, 26, 60, 16706 }, // ľ
+    { 19, 21, 22, 1, 21, 57, 16766 }, // Ŀ
+    { 16, 22, 18, 1, 22, 55, 16823 }, // ŀ
+    { 38, 35, 27, -12, 28, 131, 16878 }, // Ł
+    { 27, 22, 19, -9, 22, 71, 17009 }, // ł
+    { 25, 30, 27, 1, 30, 101, 17080 }, // Ń
+    { 19, 25, 22, 1, 25, 67, 17181 }, // ń
+    { 25, 31, 27, 1, 21, 111, 17248 }, // Ņ
+    { 18, 26, 22, 1, 16, 76, 17359 }, // ņ
+    { 26, 32, 28, 1, 32, 118, 17435 }, // Ň
+    { 23, 27, 25, 1, 27, 84, 17553 }, // ň
+    { 33, 26, 22, -14, 26, 95, 17637 }, // ŉ
+    { 25, 27, 27, 1, 21, 98, 17732 }, // Ŋ
+    { 18, 21, 22, 1, 16, 63, 17830 }, // ŋ
+    { 25, 32, 28, 2, 30, 115, 17893 }, // Ō
+    { 19, 25, 22, 2, 24, 70, 18008 }, // ō
+    { 25, 33, 28, 2, 31, 112, 18078 }, // Ŏ
+    { 20, 25, 23, 2, 24, 67, 18190 }, // ŏ
+    { 28, 32, 31, 2, 30, 119, 18257 }, // Ő
+    { 23, 24, 26, 2, 23, 74, 18376 }, // ő
+    { 35, 24, 38, 2, 22, 123, 18450 }, // Œ
+    { 27, 16, 30, 2, 15, 81, 18573 }, // œ
+    { 20, 30, 24, 1, 29, 80, 18654 }, // Ŕ
+    { 15, 23, 18, 1, 22, 51, 18734 }, // ŕ
+    { 20, 35, 24, 1, 34, 93, 18785 }, // Ŗ
+    { 15, 28, 18, 1, 27, 63, 18878 }, // ŗ
+    { 23, 32, 25, 1, 31, 100, 18941 }, // Ř
+    { 18, 25, 20, 1, 24, 60, 19041 }, // ř
+    { 21, 30, 26, 2, 29, 81, 19101 }, // Ś
+    { 16, 24, 21, 2, 22, 58, 19182 }, // ś
+    { 23, 31, 26, 2, 30, 93, 19240 }, // Ŝ
+    { 19, 26, 22, 2, 24, 67, 19333 }, // ŝ
+    { 21, 28, 26, 2, 21, 81, 19400 }, // Ş
+    { 16, 24, 21, 2, 16, 63, 19481 }, // ş
+    { 24, 32, 27, 2, 31, 98, 19544 }, // Š
+    { 20, 26, 23, 2, 24, 72, 19642 }, // š
+    { 20, 29, 27, 6, 22, 78, 19714 }, // Ţ
+    { 14, 26, 20, 3, 20, 52, 19792 }, // ţ
+    { 20, 32, 27, 6, 32, 82, 19844 }, // Ť
+    { 20, 23, 25, 4, 23, 53, 19926 }, // ť
+    { 20, 22, 27, 6, 22, 62, 19979 }, // Ŧ
+    { 15, 20, 20, 2, 20, 39, 20041 }, // ŧ
+    { 24, 34, 27, 2, 32, 103, 20080 }, // Ũ
+    { 17, 25, 21, 3, 24, 66, 20183 }, // ũ
+    { 24, 33, 27, 2, 31, 101, 20249 }, // Ū
+    { 18, 25, 22, 3, 24, 66, 20350 }, // ū
+    { 24, 33, 27, 2, 31, 98, 20416 }, // Ŭ
+    { 19, 25, 23, 3, 24, 67, 20514 }, // ŭ
+    { 24, 35, 27, 2, 33, 102, 20581 }, // Ů
+    { 16, 27, 21, 3, 26, 69, 20683 }, // ů
+    { 27, 32, 30, 2, 30, 111, 20752 }, // Ű
+    { 22, 24, 26, 3, 23, 74, 20863 }, // ű
+    { 24, 28, 27, 2, 21, 90, 20937 }, // Ų
+    { 16, 23, 21, 3, 15, 65, 21027 }, // ų
+    { 30, 31, 37, 6, 31, 139, 21092 }, // Ŵ
+    { 21, 26, 28, 5, 25, 86, 21231 }, // ŵ
+    { 20, 33, 28, 7, 33, 84, 21317 }, // Ŷ
+    { 21, 33, 23, 1, 26, 83, 21401 }, // ŷ
+    { 20, 33, 28, 7, 33, 91, 21484 }, // Ÿ
+    { 26, 28, 28, 1, 28, 89, 21575 }, // Ź
+    { 19, 24, 22, 1, 24, 57, 21664 }, // ź
+    { 26, 29, 28, 1, 29, 93, 21721 }, // Ż
+    { 19, 24, 22, 1, 24, 59, 21814 }, // ż
+    { 26, 31, 28, 1, 31, 99, 21873 }, // Ž
+    { 23, 26, 25, 1, 26, 73, 21972 }, // ž
+    { 15, 21, 18, 2, 21, 45, 22045 }, // ſ
+    { 30, 27, 33, 2, 25, 113, 22090 }, // Ơ
+    { 20, 18, 23, 2, 17, 55, 22203 }, // ơ
+    { 21, 22, 23, 1, 22, 72, 22258 }, // Ƥ
+    { 22, 26, 23, -1, 19, 78, 22330 }, // ƥ
+    { 18, 20, 20, 1, 19, 44, 22408 }, // Ʃ
+    { 22, 22, 27, 4, 22, 68, 22452 }, // Ƭ
+    { 15, 24, 20, 4, 24, 48, 22520 }, // ƭ
+    { 20, 26, 27, 6, 22, 70, 22568 }, // Ʈ
+    { 27, 28, 30, 2, 26, 96, 22638 }, // Ư
+    { 20, 21, 24, 3, 20, 60, 22734 }, // ư
+    { 10, 6, 16, 5, 20, 10, 22794 }, // ̀
+    { 8, 6, 13, 4, 19, 9, 22804 }, // ́
+    { 14, 7, 14, -1, 1, 16, 22813 }, // ̂
+    { 11, 5, 17, 5, 19, 17, 22829 }, // ̃
+    { 14, 4, 20, 5, 17, 17, 22846 }, // ̄
+    { 18, 4, 25, 6, 23, 21, 22863 }, // ̅
+    { 13, 6, 19, 5, 18, 17, 22884 }, // ̆
+    { 7, 6, 13, 5, 21, 10, 22901 }, // ̇
+    { 13, 5, 17, 3, 18, 14, 22911 }, // ̈
+    { 5, 6, 15, 9, 16, 10, 22925 }, // ̉
+    { 7, 7, 13, 5, 20, 13, 22935 }, // ̊
+    { 20, 6, 26, 5, 20, 17, 22948 }, // ̋
+    { 14, 7, 20, 5, 20, 16, 22965 }, // ̌
+    { 21, 6, 13, -9, 20, 18, 22981 }, // ̏
+    { 11, 9, 15, 3, 20, 19, 22999 }, // ̒
+    { 11, 9, 15, 3, 19, 18, 23018 }, // ̓
+    { 11, 9, 6, -6, 19, 18, 23036 }, // ̔
+    { 7, 7, 8, 0, 0, 12, 23054 }, // ̘
+    { 7, 7, 9, 1, 0, 13, 23066 }, // ̙
+    { 12, 8, 19, 6, 21, 16, 23079 }, // ̚
+    { 7, 8, 11, 3, 17, 13, 23095 }, // ̛
+    { 6, 8, 6, -1, 0, 12, 23108 }, // ̜
+    { 7, 7, 10, 2, 5, 13, 23120 }, // ̝
+    { 7, 7, 7, -1, 0, 12, 23133 }, // ̞
+    { 6, 6, 7, 0, -2, 10, 23145 }, // ̟
+    { 14, 4, 14, -1, -3, 17, 23155 }, // ̠
+    { 7, 6, 5, -3, 2, 12, 23172 }, // ̣
+    { 12, 5, 11, -2, -2, 16, 23184 }, // ̤
+    { 7, 7, 13, 5, 20, 13, 23200 }, // ̥
+    { 11, 9, 11, -1, 4, 19, 23213 }, // ̦
+    { 8, 8, 8, -1, 1, 16, 23232 }, // ̧
+    { 8, 9, 9, 0, 1, 16, 23248 }, // ̨
+    { 8, 9, 7, -2, 0, 12, 23264 }, // ̩
+    { 12, 6, 12, -1, 0, 18, 23276 }, // ̪
+    { 16, 8, 16, -1, 1, 18, 23294 }, // ̬
+    { 16, 8, 16, -1, 1, 20, 23312 }, // ̭
+    { 12, 6, 19, 6, 21, 21, 23332 }, // ̰
+    { 13, 4, 20, 6, 21, 12, 23353 }, // ̱
+    { 14, 4, 13, -2, -1, 16, 23365 }, // ̲
+    { 13, 6, 20, 6, 21, 21, 23381 }, // ̴
+    { 14, 3, 17, 2, 9, 8, 23402 }, // ̵
+    { 7, 9, 9, 1, 0, 11, 23410 }, // ̹
+    { 14, 8, 11, -4, 1, 23, 23421 }, // ̺
+    { 13, 8, 12, -2, 1, 23, 23444 }, // ̻
+    { 11, 7, 11, -1, 1, 22, 23467 }, // ̼
+    { 9, 6, 15, 5, 19, 16, 23489 }, // ̽
+    { 11, 5, 17, 5, 19, 17, 23505 }, // ͂
+    { 6, 7, 17, 10, 22, 10, 23522 }, // ̓
+    { 15, 19, 20, 4, 32, 34, 23532 }, // ̈́
+    { 12, 7, 17, 4, 21, 18, 23566 }, // ͆
+    { 16, 10, 15, -2, 0, 31, 23584 }, // ͇
+    { 13, 8, 13, -1, 1, 27, 23615 }, // ͈
+    { 10, 8, 10, -1, -1, 17, 23642 }, // ͉
+    { 18, 21, 23, 4, 27, 51, 23659 }, // ͊
+    { 26, 20, 35, 8, 30, 60, 23710 }, // ͋
+    { 18, 14, 32, 13, 14, 46, 23770 }, // ͌
+    { 13, 28, 15, 1, 9, 31, 23816 }, // ͍
+    { 5, 4, 18, 12, 3, 6, 23847 }, // ͎
+    { 22, 7, 23, 0, 1, 24, 23853 }, // ͜
+    { 22, 6, 27, 4, 20, 27, 23877 }, // ͡
+    { 27, 8, 27, -1, -1, 26, 23904 }, // ͢
+    { 22, 21, 28, 1, 21, 70, 23930 }, // Α
+    { 21, 21, 23, 1, 21, 69, 24000 }, // Β
+    { 19, 22, 20, 0, 19, 47, 24069 }, // Γ
+    { 20, 20, 22, 1, 19, 62, 24116 }, // Δ
+    { 22, 21, 24, 1, 21, 66, 24178 }, // Ε
+    { 26, 21, 28, 1, 21, 73, 24244 }, // Ζ
+    { 24, 21, 26, 1, 21, 77, 24317 }, // Η
+    { 25, 24, 28, 2, 22, 98, 24394 }, // Θ
+    { 12, 23, 14, 1, 22, 39, 24492 }, // Ι
+    { 23, 21, 26, 1, 21, 71, 24531 }, // Κ
+    { 21, 21, 53, 31, 21, 69, 24602 }, // Λ
+    { 27, 21, 29, 1, 21, 101, 24671 }, // Μ
+    { 25, 21, 27, 1, 21, 81, 24772 }, // Ν
+    { 21, 20, 23, 1, 19, 54, 24853 }, // Ξ
+    { 25, 24, 28, 2, 22, 89, 24907 }, // Ο
+    { 19, 19, 21, 1, 18, 57, 24996 }, // Π
+    { 21, 22, 23, 1, 22, 60, 25053 }, // Ρ
+    { 19, 20, 20, 0, 19, 44, 25113 }, // Σ
+    { 20, 22, 27, 6, 22, 61, 25157 }, // Τ
+    { 20, 21, 28, 7, 21, 60, 25218 }, // Υ
+    { 30, 28, 36, 5, 22, 124, 25278 }, // Φ
+    { 26, 21, 28, 1, 21, 76, 25402 }, // Χ
+    { 22, 23, 26, 3, 20, 83, 25478 }, // Ψ
+    { 24, 22, 26, 1, 20, 73, 25561 }, // Ω
+    { 20, 19, 24, 2, 16, 58, 25634 }, // α
+    { 20, 31, 20, -1, 25, 83, 25692 }, // β
+    { 15, 23, 20, 4, 15, 59, 25775 }, // γ
+    { 19, 23, 21, 1, 22, 68, 25834 }, // δ
+    { 13, 14, 15, 1, 13, 36, 25902 }, // ε
+    { 16, 23, 19, 2, 19, 51, 25938 }, // ζ
+    { 18, 24, 21, 2, 17, 68, 25989 }, // η
+    { 18, 21, 21, 2, 20, 64, 26057 }, // θ
+    { 10, 18, 16, 1, 17, 31, 26121 }, // ι
+    { 16, 15, 18, -2, 15, 42, 26152 }, // κ
+    { 21, 22, 21, -19, 21, 61, 26194 }, // λ
+    { 20, 19, 21, -1, 15, 57, 26255 }, // μ
+    { 15, 16, 20, 4, 15, 46, 26312 }, // ν
+    { 14, 23, 18, 3, 19, 47, 26358 }, // ξ
+    { 17, 16, 21, 2, 15, 46, 26405 }, // ο
+    { 19, 15, 22, 2, 14, 48, 26451 }, // π
+    { 21, 21, 21, -1, 15, 62, 26499 }, // ρ
+    { 14, 19, 18, 3, 19, 43, 26561 }, // ς
+    { 22, 16, 25, 2, 15, 50, 26604 }, // σ
+    { 15, 15, 20, 4, 14, 32, 26654 }, // τ
+    { 14, 16, 17, 2, 15, 43, 26686 }, // υ
+    { 25, 33, 28, 2, 27, 125, 26729 }, // φ
+    { 24, 21, 24, -1, 15, 72, 26854 }, // χ
+    { 16, 28, 19, 2, 20, 77, 26926 }, // ψ
+    { 20, 15, 23, 2, 13, 57, 27003 }, // ω
+    { 22, 28, 28, 1, 21, 87, 27060 }, // Ạ
+    { 18, 26, 21, 0, 16, 66, 27147 }, // ạ
+    { 22, 30, 28, 1, 30, 88, 27213 }, // Ả
+    { 16, 26, 21, 2, 25, 64, 27301 }, // ả
+    { 24, 37, 28, 1, 37, 111, 27365 }, // Ấ
+    { 24, 29, 27, 2, 28, 88, 27476 }, // ấ
+    { 24, 33, 28, 1, 33, 105, 27564 }, // Ầ
+    { 17, 30, 21, 2, 29, 78, 27669 }, // ầ
+    { 24, 38, 28, 1, 38, 115, 27747 }, // Ẩ
+    { 23, 31, 26, 2, 30, 92, 27862 }, // ẩ
+    { 25, 36, 28, 1, 36, 118, 27954 }, // Ẫ
+    { 19, 31, 22, 2, 30, 89, 28072 }, // ẫ
+    { 23, 36, 28, 1, 29, 111, 28161 }, // Ậ
+    { 19, 34, 21, 0, 24, 85, 28272 }, // ậ
+    { 26, 38, 28, 1, 38, 115, 28357 }, // Ắ
+    { 20, 34, 23, 2, 33, 86, 28472 }, // ắ
+    { 26, 38, 28, 1, 38, 116, 28558 }, // Ằ
+    { 20, 34, 23, 2, 33, 85, 28674 }, // ằ
+    { 26, 39, 28, 1, 39, 119, 28759 }, // Ẳ
+    { 19, 35, 22, 2, 34, 88, 28878 }, // ẳ
+    { 26, 39, 28, 1, 39, 126, 28966 }, // Ẵ
+    { 20, 34, 23, 2, 33, 93, 29092 }, // ẵ
+    { 26, 37, 28, 1, 30, 117, 29185 }, // Ặ
+    { 22, 34, 23, 0, 24, 94, 29302 }, // ặ
+    { 22, 31, 24, 1, 21, 87, 29396 }, // Ẹ
+    { 18, 26, 21, 1, 15, 66, 29483 }, // ẹ
+    { 22, 31, 24, 1, 31, 86, 29549 }, // Ẻ
+    { 17, 28, 21, 2, 27, 67, 29635 }, // ẻ
+    { 22, 31, 24, 1, 31, 96, 29702 }, // Ẽ
+    { 19, 28, 22, 2, 27, 76, 29798 }, // ẽ
+    { 26, 34, 28, 1, 34, 107, 29874 }, // Ế
+    { 28, 28, 31, 2, 27, 94, 29981 }, // ế
+    { 27, 34, 29, 1, 34, 109, 30075 }, // Ề
+    { 18, 31, 21, 2, 30, 79, 30184 }, // ề
+    { 26, 34, 28, 1, 34, 107, 30263 }, // Ể
+    { 24, 33, 27, 2, 32, 101, 30370 }, // ể
+    { 22, 36, 24, 1, 36, 109, 30471 }, // Ễ
+    { 22, 34, 25, 2, 33, 103, 30580 }, // ễ
+    { 22, 40, 24, 1, 30, 109, 30683 }, // Ệ
+    { 19, 37, 21, 1, 26, 90, 30792 }, // ệ
+    { 15, 34, 17, 1, 33, 67, 30882 }, // Ỉ
+    { 11, 25, 13, 1, 24, 39, 30949 }, // ỉ
+    { 17, 34, 14, -4, 22, 70, 30988 }, // Ị
+    { 16, 35, 14, -3, 24, 69, 31058 }, // ị
+    { 25, 35, 28, 2, 22, 115, 31127 }, // Ọ
+    { 18, 26, 21, 1, 15, 64, 31242 }, // ọ
+    { 25, 33, 28, 2, 31, 109, 31306 }, // Ỏ
+    { 17, 25, 21, 2, 24, 60, 31415 }, // ỏ
+    { 29, 32, 32, 2, 30, 125, 31475 }, // Ố
+    { 26, 26, 29, 2, 25, 84, 31600 }, // ố
+    { 25, 35, 28, 2, 33, 121, 31684 }, // Ồ
+    { 17, 29, 21, 2, 28, 75, 31805 }, // ồ
+    { 25, 36, 28, 2, 34, 124, 31880 }, // Ổ
+    { 23, 30, 26, 2, 29, 90, 32004 }, // ổ
+    { 25, 38, 28, 2, 36, 132, 32094 }, // Ỗ
+    { 19, 30, 22, 2, 29, 84, 32226 }, // ỗ
+    { 25, 43, 28, 2, 30, 137, 32310 }, // Ộ
+    { 18, 34, 21, 1, 23, 83, 32447 }, // ộ
+    { 30, 33, 33, 2, 31, 130, 32530 }, // Ớ
+    { 20, 24, 23, 2, 23, 67, 32660 }, // ớ
+    { 30, 33, 33, 2, 31, 130, 32727 }, // Ờ
+    { 20, 25, 23, 2, 24, 69, 32857 }, // ờ
+    { 30, 33, 33, 2, 31, 131, 32926 }, // Ở
+    { 20, 25, 23, 2, 24, 69, 33057 }, // ở
+    { 30, 33, 33, 2, 31, 137, 33126 }, // Ỡ
+    { 20, 25, 23, 2, 24, 77, 33263 }, // ỡ
+    { 30, 38, 33, 2, 25, 141, 33340 }, // Ợ
+    { 21, 28, 23, 1, 17, 75, 33481 }, // ợ
+    { 24, 32, 27, 2, 21, 95, 33556 }, // Ụ
+    { 19, 28, 21, 0, 15, 69, 33651 }, // ụ
+    { 24, 34, 27, 2, 32, 98, 33720 }, // Ủ
+    { 16, 25, 21, 3, 24, 62, 33818 }, // ủ
+    { 27, 33, 30, 2, 31, 110, 33880 }, // Ứ
+    { 20, 25, 24, 3, 24, 69, 33990 }, // ứ
+    { 27, 33, 30, 2, 31, 111, 34059 }, // Ừ
+    { 20, 25, 24, 3, 24, 70, 34170 }, // ừ
+    { 27, 34, 30, 2, 32, 112, 34240 }, // Ử
+    { 20, 25, 24, 3, 24, 70, 34352 }, // ử
+    { 27, 34, 30, 2, 32, 118, 34422 }, // Ữ
+    { 20, 25, 24, 3, 24, 75, 34540 }, // ữ
+    { 27, 37, 30, 2, 26, 117, 34615 }, // Ự
+    { 23, 33, 24, 0, 20, 92, 34732 }, // ự
+    { 20, 32, 28, 7, 32, 79, 34824 }, // Ỳ
+    { 21, 32, 23, 1, 25, 80, 34903 }, // ỳ
+    { 25, 34, 28, 2, 21, 96, 34983 }, // Ỵ
+    { 21, 24, 23, 1, 14, 70, 35079 }, // ỵ
+    { 20, 33, 28, 7, 33, 81, 35149 }, // Ỷ
+    { 21, 34, 23, 1, 27, 82, 35230 }, // ỷ
+    { 20, 34, 28, 7, 34, 91, 35312 }, // Ỹ
+    { 21, 34, 23, 1, 27, 87, 35403 }, // ỹ
+    { 0, 0, 17, 0, 0, 0, 35490 }, //  
+    { 0, 0, 29, 0, 0, 0, 35490 }, //  
+    { 0, 0, 17, 0, 0, 0, 35490 }, //  
+    { 0, 0, 29, 0, 0, 0, 35490 }, //  
+    { 0, 0, 12, 0, 0, 0, 35490 }, //  
+    { 0, 0, 10, 0, 0, 0, 35490 }, //  
+    { 0, 0, 8, 0, 0, 0, 35490 }, //  
+    { 0, 0, 18, 0, 0, 0, 35490 }, //  
+    { 0, 0, 7, 0, 0, 0, 35490 }, //  
+    { 0, 0, 9, 0, 0, 0, 35490 }, //  
+    { 0, 0, 8, 0, 0, 0, 35490 }, //  
+    { 0, 0, 4, 0, 0, 0, 35490 }, // ​
+    { 0, 0, 1, 0, 0, 0, 35490 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 35490 }, // ‍
+    { 0, 0, 1, 0, 0, 0, 35490 }, // ‎
+    { 0, 0, 1, 0, 0, 0, 35490 }, // ‏
+    { 14, 3, 17, 2, 9, 8, 35490 }, // ‐
+    { 14, 3, 17, 2, 9, 8, 35498 }, // ‑
+    { 21, 3, 21, -1, 9, 11, 35506 }, // ‒
+    { 20, 5, 23, 2, 10, 20, 35517 }, // –
+    { 28, 5, 31, 2, 10, 28, 35537 }, // —
+    { 28, 5, 31, 2, 10, 28, 35565 }, // ―
+    { 18, 23, 20, 1, 18, 72, 35593 }, // ‖
+    { 23, 8, 19, -5, -2, 25, 35665 }, // ‗
+    { 11, 9, 17, 5, 22, 19, 35690 }, // ‘
+    { 11, 9, 17, 5, 22, 19, 35709 }, // ’
+    { 11, 9, 10, -2, 4, 19, 35728 }, // ‚
+    { 11, 9, 17, 5, 22, 19, 35747 }, // ‛
+    { 19, 9, 25, 5, 22, 37, 35766 }, // “
+    { 19, 9, 25, 5, 22, 37, 35803 }, // ”
+    { 11, 9, 10, -2, 4, 19, 35840 }, // „
+    { 19, 9, 25, 5, 22, 37, 35859 }, // ‟
+    { 15, 35, 22, 6, 26, 77, 35896 }, // †
+    { 18, 35, 24, 5, 26, 76, 35973 }, // ‡
+    { 23, 19, 21, -3, 22, 62, 36049 }, // •
+    { 10, 9, 15, 4, 11, 16, 36111 }, // ‣
+    { 7, 6, 15, 4, 6, 11, 36127 }, // ․
+    { 7, 6, 15, 4, 6, 11, 36138 }, // ‥
+    { 24, 6, 25, 0, 6, 33, 36149 }, // …
+    { 4, 3, 14, 5, 9, 3, 36182 }, // ‧
+    { 0, 0, 28, 0, 0, 0, 36185 }, //  
+    { 23, 22, 28, 3, 20, 88, 36185 }, // ‰
+    { 11, 9, 20, 8, 22, 19, 36273 }, // ′
+    { 19, 9, 28, 8, 22, 37, 36292 }, // ″
+    { 18, 8, 17, -2, 21, 31, 36329 }, // ‴
+    { 6, 8, 14, 7, 21, 11, 36360 }, // ‵
+    { 11, 8, 17, 5, 21, 19, 36371 }, // ‶
+    { 19, 8, 20, 0, 21, 30, 36390 }, // ‷
+    { 15, 6, 21, 5, 21, 18, 36420 }, // ‸
+    { 10, 14, 14, 3, 14, 23, 36438 }, // ‹
+    { 11, 14, 10, -3, 14, 23, 36461 }, // ›
+    { 33, 32, 36, 2, 25, 140, 36484 }, // ※
+    { 15, 32, 18, 2, 28, 58, 36624 }, // ‼
+    { 20, 40, 25, 4, 34, 104, 36682 }, // ‽
+    { 14, 3, 20, 5, 21, 8, 36786 }, // ‾
+    { 13, 6, 19, 5, 17, 16, 36794 }, // ‿
+    { 18, 17, 21, 2, 23, 70, 36810 }, // ⁂
+    { 23, 22, 32, 5, 20, 56, 36880 }, // ⁄
+    { 34, 31, 41, 6, 28, 139, 36936 }, // ⁇
+    { 29, 32, 35, 5, 28, 120, 37075 }, // ⁈
+    { 28, 32, 27, -2, 28, 119, 37195 }, // ⁉
+    { 29, 44, 28, -2, 30, 135, 37314 }, // ⁒
+    { 0, 0, 117, 0, 0, 0, 37449 }, //  
+    { 9, 10, 19, 9, 21, 29, 37449 }, // ⁰
+    { 8, 9, 19, 10, 21, 17, 37478 }, // ⁴
+    { 9, 11, 19, 9, 22, 25, 37495 }, // ⁵
+    { 9, 10, 19, 9, 21, 24, 37520 }, // ⁶
+    { 8, 11, 20, 11, 22, 18, 37544 }, // ⁷
+    { 9, 11, 19, 9, 21, 24, 37562 }, // ⁸
+    { 9, 11, 19, 9, 21, 21, 37586 }, // ⁹
+    { 18, 16, 22, 1, 16, 51, 37607 }, // ⁿ
+    { 10, 10, 9, -8, 6, 32, 37658 }, // ₀
+    { 7, 11, 8, -8, 6, 16, 37690 }, // ₁
+    { 10, 11, 9, -8, 6, 23, 37706 }, // ₂
+    { 10, 10, 9, -8, 6, 23, 37729 }, // ₃
+    { 9, 10, 9, -8, 6, 21, 37752 }, // ₄
+    { 9, 10, 8, -8, 6, 23, 37773 }, // ₅
+    { 10, 10, 9, -8, 6, 24, 37796 }, // ₆
+    { 8, 11, 9, -6, 6, 18, 37820 }, // ₇
+    { 10, 11, 9, -8, 6, 26, 37838 }, // ₈
+    { 10, 11, 9, -8, 6, 23, 37864 }, // ₉
+    { 18, 35, 20, 1, 26, 73, 37887 }, // ₍
+    { 17, 35, 11, -8, 26, 71, 37960 }, // ₎
+    { 23, 33, 27, 3, 28, 128, 38031 }, // ₡
+    { 22, 23, 25, 2, 23, 75, 38159 }, // ₢
+    { 19, 23, 21, 1, 22, 66, 38234 }, // ₤
+    { 29, 21, 29, -1, 21, 92, 38300 }, // ₦
+    { 24, 22, 26, 1, 22, 71, 38392 }, // ₧
+    { 30, 23, 33, -1, 21, 110, 38463 }, // ₨
+    { 23, 22, 22, -2, 22, 89, 38573 }, // ₩
+    { 24, 19, 29, 4, 19, 94, 38662 }, // ₪
+    { 22, 22, 21, -2, 21, 74, 38756 }, // ₫
+    { 20, 24, 23, 2, 21, 65, 38830 }, // €
+    { 20, 22, 27, 6, 22, 74, 38895 }, // ₮
+    { 27, 22, 28, 0, 22, 71, 38969 }, // ₱
+    { 23, 33, 28, 2, 28, 120, 39040 }, // ₲
+    { 29, 21, 37, 7, 19, 77, 39160 }, // ₴
+    { 14, 21, 17, 2, 18, 53, 39237 }, // ₵
+    { 24, 23, 31, 6, 23, 75, 39290 }, // ₸
+    { 16, 21, 21, 4, 20, 48, 39365 }, // ₹
+    { 16, 19, 19, 2, 17, 58, 39413 }, // ₺
+    { 20, 21, 24, 3, 19, 72, 39471 }, // ₼
+    { 25, 22, 23, -3, 22, 70, 39543 }, // ₽
+    { 17, 18, 18, -4, 13, 49, 39613 }, // ←
+    { 18, 18, 22, 3, 17, 47, 39662 }, // ↑
+    { 18, 18, 24, 5, 13, 48, 39709 }, // →
+    { 18, 18, 26, 7, 16, 49, 39757 }, // ↓
+    { 28, 15, 28, -1, 12, 66, 39806 }, // ↔
+    { 15, 28, 20, 4, 27, 71, 39872 }, // ↕
+    { 17, 12, 20, -2, 11, 39, 39943 }, // ↖
+    { 17, 12, 21, 3, 11, 36, 39982 }, // ↗
+    { 14, 17, 20, 5, 15, 45, 40018 }, // ↘
+    { 14, 17, 16, -3, 15, 45, 40063 }, // ↙
+    { 20, 18, 24, 1, 16, 54, 40108 }, // ⇐
+    { 22, 20, 28, 5, 19, 81, 40162 }, // ⇑
+    { 21, 18, 25, 3, 16, 55, 40243 }, // ⇒
+    { 22, 20, 33, 10, 18, 81, 40298 }, // ⇓
+    { 26, 18, 28, 1, 16, 75, 40379 }, // ⇔
+    { 18, 25, 25, 6, 14, 85, 40454 }, // ⇕
+    { 20, 22, 22, 1, 21, 64, 40539 }, // ∂
+    { 27, 26, 28, 0, 24, 110, 40603 }, // ∅
+    { 20, 20, 22, 1, 19, 62, 40713 }, // ∆
+    { 19, 20, 23, 3, 19, 61, 40775 }, // ∏
+    { 20, 19, 28, 7, 18, 59, 40836 }, // ∐
+    { 18, 20, 20, 1, 19, 44, 40895 }, // ∑
+    { 14, 4, 17, 2, 9, 15, 40939 }, // −
+    { 25, 23, 29, 3, 21, 64, 40954 }, // √
+    { 23, 14, 26, 2, 16, 62, 41018 }, // ∞
+    { 26, 27, 27, 0, 20, 77, 41080 }, // ∫
+    { 10, 17, 12, 1, 17, 25, 41157 }, // ∶
+    { 18, 14, 36, 13, 14, 46, 41182 }, // ≈
+    { 23, 22, 32, 5, 20, 66, 41228 }, // ≠
+    { 24, 21, 22, -3, 18, 71, 41294 }, // ≤
+    { 24, 22, 25, 0, 19, 76, 41365 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_12_bolditalicIntervals[] = {
@@ -5335,4 +3335,5 @@ static const EpdFontData opendyslexic_12_bolditalic = {
     33,
     -13,
     true,
+    true,
 };
@@ -2,4528 +2,2970 @@
  * generated by fontconvert.py
  * name: opendyslexic_12_italic
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_12_italic 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py opendyslexic_12_italic 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_italicBitmaps[61602] = {
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00,
-    0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
-    0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x1F,
-    0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x83, 0xFC, 0x1F, 0xE0,
-    0xBF, 0x43, 0xFC, 0x2F, 0xD0, 0xFF, 0x07, 0xF4, 0x2F, 0xC0, 0xFE, 0x07, 0xF4, 0x3F, 0xC0, 0xFE,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x0B, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC3, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xBF, 0xA4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0x4F, 0x05, 0x00, 0x00, 0x7F, 0xB8, 0x38, 0x00, 0x00, 0x03, 0xF9, 0xD1, 0xD0, 0x00,
-    0x00, 0x0F, 0xCB, 0x0B, 0x00, 0x00, 0x00, 0x7F, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFB,
-    0xFF, 0xF8, 0x00, 0x00, 0x03, 0xC3, 0xFF, 0xF4, 0x00, 0x00, 0x0E, 0x0E, 0xFF, 0xF0, 0x00, 0x00,
-    0x74, 0x77, 0xFF, 0xC0, 0x00, 0x02, 0xC2, 0xEF, 0xFF, 0x00, 0x3F, 0xAF, 0xAF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x01, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x03, 0x83, 0x80,
-    0x00, 0x00, 0x00, 0x08, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xBE, 0x00, 0x01, 0xE0, 0x03, 0xD7, 0xC0, 0x03,
-    0x80, 0x0E, 0x00, 0xC0, 0x0F, 0x00, 0x1C, 0x00, 0xC0, 0x3C, 0x00, 0x2C, 0x01, 0xC0, 0xB4, 0x00,
-    0x28, 0x03, 0x82, 0xE0, 0x00, 0x3D, 0x1B, 0x47, 0x80, 0x00, 0x1F, 0xFE, 0x1F, 0x00, 0x00, 0x0B,
-    0xF4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x38, 0x00, 0x00, 0x0F,
-    0xC0, 0x2C, 0x00, 0x00, 0x2F, 0x80, 0x28, 0x00, 0x00, 0xBF, 0x40, 0x34, 0x00, 0x01, 0xF3, 0x91,
-    0xF0, 0x00, 0x07, 0xC3, 0xFF, 0xC0, 0x00, 0x0F, 0x40, 0xBE, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0x40, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00,
-    0xF8, 0x01, 0xFC, 0x00, 0x00, 0xBD, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0xBD,
-    0x00, 0x10, 0x1F, 0xE0, 0x2F, 0x40, 0xBD, 0x3F, 0xC0, 0x0F, 0xC1, 0xFC, 0x7F, 0x80, 0x03, 0xF7,
-    0xF4, 0xBF, 0x40, 0x00, 0xFF, 0xD0, 0xBF, 0xC0, 0x01, 0xFF, 0x80, 0x7F, 0xF9, 0x6F, 0xFF, 0x40,
-    0x3F, 0xFF, 0xFF, 0xFB, 0xC0, 0x0F, 0xFF, 0xFF, 0x82, 0x40, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0xFF, 0x03, 0xFC, 0x0B, 0xF0, 0x1F, 0xC0, 0x3F, 0x40, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xB0, 0x04, 0x38, 0x3C, 0x2D, 0x2F, 0xCE, 0x7D,
-    0x00, 0xBF, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xFF, 0xD0, 0x7E, 0x38, 0xBD, 0x1D, 0x0D, 0x06,
-    0x00, 0x0B, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0x40, 0x0F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF0, 0x00, 0x78,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x55,
-    0x03, 0xFD, 0x03, 0xFC, 0x0B, 0xF4, 0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0xBF, 0x40, 0x1A, 0xAA,
-    0xAA, 0x0F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xF2, 0xF8, 0xFE, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0xF4, 0x1E, 0x00, 0x00, 0xF0, 0x02, 0xC0,
-    0x00, 0xF4, 0x00, 0x78, 0x00, 0xBC, 0x00, 0x1E, 0x00, 0x3D, 0x04, 0x07, 0x80, 0x2F, 0x0B, 0x82,
-    0xE0, 0x0F, 0x83, 0xE0, 0xF4, 0x07, 0xD0, 0xF4, 0x3C, 0x02, 0xF0, 0x3C, 0x2F, 0x00, 0xFC, 0x08,
-    0x0F, 0x80, 0x3F, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xF4, 0x07, 0xF8, 0x00, 0xFF,
-    0xAF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x3D,
-    0xF8, 0x00, 0x04, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x15, 0xFE, 0x94, 0x1F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xE0, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0x90, 0x7F, 0x00,
-    0x01, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF9, 0x69, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x0B, 0xFA, 0xFD,
-    0x00, 0x01, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x1B, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xAF, 0xFD, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x0B,
-    0xCF, 0x00, 0x02, 0xF1, 0xF0, 0x00, 0xBC, 0x2E, 0x00, 0x2F, 0x03, 0xD0, 0x0B, 0xC0, 0x7D, 0x02,
-    0xF9, 0x5F, 0xE5, 0x3F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1A, 0xAB, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x01, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x1F, 0xC0, 0x08, 0x00, 0x7F, 0x80, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0x9B, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x01, 0xFF,
-    0x40, 0xFC, 0x00, 0xBF, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0xF0, 0x03,
-    0xD0, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x3F, 0x95, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD6,
-    0xAF, 0xFF, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF0, 0x00,
-    0x0B, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x01, 0xF9, 0x1F, 0x00,
-    0x01, 0xF0, 0x01, 0xE0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x0F,
-    0x80, 0x07, 0xC0, 0x0F, 0xC0, 0x00, 0xFD, 0x6F, 0xD0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x2F, 0xD0, 0x7E, 0x00, 0x2F, 0x80, 0x0B, 0xC0, 0x0F, 0x80, 0x01, 0xF4, 0x0B, 0xD0,
-    0x00, 0x7D, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x2F, 0xFA, 0xBF, 0xC0, 0x03,
-    0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xEF, 0xE0,
-    0x00, 0xBC, 0x02, 0xF4, 0x01, 0xF0, 0x00, 0xF8, 0x03, 0xC0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF8,
-    0x0B, 0x80, 0x00, 0xF8, 0x0F, 0x40, 0x01, 0xF4, 0x0F, 0x80, 0x03, 0xF0, 0x0B, 0xD0, 0x1F, 0xF0,
-    0x07, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x05, 0x47, 0xC0, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x2F, 0x40, 0x25, 0x55, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF8, 0x01, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x3F, 0x00, 0x2F,
-    0xC0, 0x0F, 0xF0, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x03, 0xFC,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80,
-    0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xF9,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1B, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2B,
-    0xFF, 0xFD, 0x07, 0xFF, 0xFA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xAF, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0xF4, 0x01,
-    0xBF, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xF0, 0x01,
-    0xFD, 0x5B, 0xF8, 0x01, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x38, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x3E, 0x0B, 0xDC, 0x00, 0x38, 0x00,
-    0x2F, 0x0E, 0x1E, 0x00, 0x0E, 0x00, 0x0F, 0x4D, 0x03, 0x40, 0x03, 0x40, 0x0F, 0xC6, 0x00, 0xD0,
-    0x01, 0xC0, 0x03, 0xE2, 0x40, 0xB0, 0x00, 0xE0, 0x01, 0xF8, 0xE1, 0xBC, 0x00, 0xF0, 0x00, 0xBE,
-    0x3F, 0xFF, 0x01, 0xF4, 0x00, 0x2F, 0xC3, 0xF6, 0x9B, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0x90,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00,
-    0x00, 0xBC, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0B,
-    0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xF5, 0x55, 0x57,
-    0xF8, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xC0, 0x02, 0xF4, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00,
-    0x3D, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x01, 0xFE, 0xAA, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xF8, 0x00, 0x1F, 0xD0, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x2F, 0x00,
-    0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x0B, 0xE0, 0x1F, 0x40, 0x00, 0x7F,
-    0x40, 0xBC, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x04,
-    0x00, 0x0F, 0xFF, 0xE9, 0x6F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3E,
-    0x00, 0x1B, 0xFD, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x2F, 0x40, 0x00, 0x03, 0xF8, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0x00,
-    0xBD, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0xD0,
-    0x1F, 0x95, 0x5A, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFE, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFA, 0xA4, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xBE, 0x55, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0xFD, 0x50, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xF9,
-    0x00, 0x05, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xA5, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0xFF, 0x4B, 0xF0, 0x00, 0x0A, 0xFF, 0xD2, 0xFC, 0x00, 0x00, 0x0F, 0xA0, 0xBF, 0x00, 0x00, 0x07,
-    0xC0, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0x0B, 0xFF, 0xEA, 0xAF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00,
-    0xFE, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFA, 0xAA,
-    0xAF, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-    0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00,
-    0x7F, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x03, 0xF4,
-    0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x07,
-    0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x04, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x07, 0xF0,
-    0x2F, 0xC0, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x0F, 0xC1, 0xFD, 0x00, 0x00, 0x1F, 0xC7, 0xF4,
-    0x00, 0x00, 0x2F, 0x4F, 0xE0, 0x00, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xF7, 0xFE, 0x00, 0x00, 0x0F, 0xE3,
-    0xFF, 0x40, 0x00, 0x1F, 0xC1, 0xFF, 0xC0, 0x00, 0x2F, 0xC0, 0xFF, 0xE0, 0x00, 0x3F, 0x80, 0xBF,
-    0xF4, 0x00, 0x7F, 0x00, 0x3F, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x02, 0xFF, 0xC0,
-    0x02, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xEF, 0xF0,
-    0x02, 0xFF, 0xF4, 0x00, 0xBD, 0xFF, 0x40, 0x7F, 0x7F, 0x00, 0x0F, 0xCF, 0xF4, 0x0F, 0xEB, 0xF0,
-    0x00, 0xFC, 0xBF, 0x82, 0xFC, 0xFF, 0x00, 0x2F, 0xC7, 0xF8, 0x7F, 0x4F, 0xE0, 0x03, 0xF8, 0x7F,
-    0xCF, 0xE2, 0xFD, 0x00, 0x3F, 0x43, 0xFE, 0xFC, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xFF, 0x43, 0xFC,
-    0x00, 0xFF, 0x03, 0xFF, 0xF0, 0xBF, 0xC0, 0x0F, 0xF0, 0x3F, 0xFC, 0x0F, 0xF8, 0x01, 0xFE, 0x02,
-    0xFF, 0x80, 0xFF, 0x40, 0x3F, 0xD0, 0x2F, 0xF0, 0x2F, 0xF0, 0x03, 0xFC, 0x01, 0xFC, 0x03, 0xFF,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xF8,
-    0x00, 0x07, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xFD, 0x00,
-    0x0B, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-    0x7F, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0xFE, 0x3F, 0x80, 0x7F, 0x00,
-    0x00, 0xFD, 0x2F, 0x80, 0xBF, 0x00, 0x02, 0xFC, 0x1F, 0xC0, 0xFD, 0x00, 0x03, 0xFC, 0x1F, 0xC1,
-    0xFC, 0x00, 0x07, 0xF8, 0x0F, 0xD2, 0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xE3, 0xF4, 0x00, 0x0F, 0xF0,
-    0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xF0, 0x07, 0xFB, 0xF0, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0xE0, 0x00,
-    0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0,
-    0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00,
-    0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40,
-    0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF,
-    0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0F, 0xD5, 0x5F, 0xF0, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0xF4, 0x00,
-    0x3F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x2F, 0xD0, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xE0,
-    0x00, 0x02, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0xFD, 0x00, 0x00, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x02, 0xF8, 0x00, 0x00, 0x02,
-    0xF4, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00,
-    0x00, 0x0B, 0xD0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00, 0xD0, 0x3F, 0x80, 0x0B,
-    0xF4, 0x03, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0x0F,
-    0x00, 0x07, 0xD0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x07,
-    0xF0, 0x00, 0x7C, 0x00, 0xBF, 0x40, 0x03, 0xFA, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x7F, 0x00,
-    0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x0F, 0xF0,
-    0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x02, 0xFE,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x10, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x40, 0x00, 0x1F,
-    0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE, 0xFE,
-    0xAF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x01, 0x50, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xD0, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00,
-    0x07, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x3F,
-    0x40, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x00,
-    0x3F, 0x40, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFE,
-    0xAF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x0F, 0xD0, 0x00, 0x03, 0xF4,
-    0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00,
-    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x3F, 0xD0, 0x00, 0x0B, 0xF4, 0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x0F, 0xF0, 0x00, 0x00,
-    0xBF, 0x8F, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F,
-    0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x07, 0xF8, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x0F,
-    0xFC, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0xFC, 0x02, 0xFC, 0x00, 0x2F, 0x80, 0xFF, 0xFD, 0x03,
-    0xF4, 0x00, 0x3F, 0x82, 0xFD, 0xFE, 0x0B, 0xF0, 0x00, 0x3F, 0x87, 0xFC, 0xFF, 0x0F, 0xD0, 0x00,
-    0x3F, 0x8F, 0xF0, 0xFF, 0x2F, 0xC0, 0x00, 0x3F, 0xBF, 0xD0, 0xBF, 0x7F, 0x40, 0x00, 0x3F, 0xFF,
-    0xC0, 0xBF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x7F,
-    0xC0, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xD3, 0xF4, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0xC0,
-    0x03, 0xF4, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x07, 0xF0, 0x00,
-    0x07, 0xF5, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01,
-    0xAA, 0xAA, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x30, 0x70,
-    0xB0, 0xB0, 0xB0, 0xB4, 0xB4, 0xB8, 0xB8, 0xB8, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D, 0x7D, 0x7E,
-    0x3E, 0x3C, 0x34, 0x20, 0x00, 0x15, 0x54, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xF0, 0x03, 0x80, 0x00, 0x7E, 0x00, 0x0F, 0xB8, 0x03, 0xD0, 0xF0, 0xB0, 0x01, 0xD0,
-    0x05, 0x55, 0x55, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x7D, 0x00, 0xBD, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x2C, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0xF8, 0x03, 0xD0, 0x00,
-    0xF8, 0x07, 0xC0, 0x00, 0xF4, 0x0F, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x03, 0xF0, 0x1E, 0x00, 0x0B,
-    0xF0, 0x2F, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xF7,
-    0xC0, 0x02, 0xFF, 0x87, 0xC0, 0x00, 0x54, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x0B, 0xC2, 0xF9, 0x00, 0x3F, 0xBF, 0xFD, 0x00, 0xFF, 0xE5, 0xBD, 0x07, 0xFC,
-    0x00, 0xB8, 0x2F, 0xC0, 0x01, 0xF0, 0xFE, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x2F, 0x0F, 0xC0, 0x00,
-    0xF8, 0x7E, 0x00, 0x0B, 0xC2, 0xFC, 0x00, 0xFE, 0x0B, 0xFE, 0xBF, 0xF0, 0x2F, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xF8, 0x03, 0xFD, 0x04, 0x02, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x69, 0x03, 0xC0, 0x00, 0x03, 0xFF, 0xCB, 0xC0, 0x00, 0x1F, 0xFF, 0xEF, 0x80, 0x00, 0x7E, 0x02,
-    0xFF, 0x00, 0x01, 0xF4, 0x00, 0xFF, 0x00, 0x03, 0xD0, 0x00, 0xFE, 0x00, 0x07, 0xC0, 0x00, 0xFD,
-    0x00, 0x0F, 0x40, 0x01, 0xFC, 0x00, 0x0F, 0x40, 0x02, 0xF8, 0x00, 0x1F, 0x40, 0x07, 0xF4, 0x00,
-    0x1F, 0xD0, 0x2F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x3F, 0x40, 0x38, 0x00, 0xB8, 0x00, 0x2C, 0x02, 0xE0,
-    0x00, 0x7C, 0x03, 0xEA, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0x95, 0x40, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0xFF,
-    0x80, 0x2F, 0xFF, 0xD0, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x02, 0x80,
-    0x00, 0xBF, 0xFD, 0xBC, 0x00, 0x2F, 0xAB, 0xFF, 0x80, 0x07, 0xC0, 0x1F, 0xF4, 0x00, 0xF4, 0x00,
-    0xFF, 0x00, 0x1E, 0x00, 0x0F, 0xE0, 0x03, 0xC0, 0x00, 0xFD, 0x00, 0x3C, 0x00, 0x1F, 0xC0, 0x03,
-    0x80, 0x03, 0xF8, 0x00, 0x7C, 0x01, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xF9, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x18, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x06, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x19, 0x40, 0x00, 0xBE, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFF, 0x40, 0xFC, 0x02, 0xFC, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x78, 0x07, 0xE0,
-    0x00, 0xB8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x80, 0x02, 0xF0, 0x2F, 0x40,
-    0x03, 0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x7F, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x3C,
-    0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00,
-    0x7E, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x3F, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0xBD, 0x00,
-    0xF4, 0xBD, 0x00, 0xBC, 0xBD, 0x00, 0x3E, 0xBD, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0xFB, 0xF8, 0x00, 0x7D, 0xBF, 0x40, 0x3F, 0x0F, 0xF0, 0x0F, 0xC2, 0xFF, 0x07,
-    0xE0, 0x3F, 0xE2, 0xF4, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0x40, 0x01, 0xF0,
-    0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x03,
-    0xE0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x2F, 0x00,
-    0x03, 0xF0, 0x00, 0x3F, 0xA4, 0x07, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0x00, 0x2D, 0x2F, 0xE0, 0x0B,
-    0xF4, 0x00, 0x0F, 0x7F, 0xFF, 0x0F, 0xFF, 0x40, 0x07, 0xFE, 0x5F, 0xDF, 0xEB, 0xE0, 0x03, 0xFC,
-    0x00, 0xFF, 0x40, 0x78, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x1E, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x0B,
-    0x80, 0x3F, 0x00, 0x07, 0xD0, 0x03, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xF0, 0x0F, 0xC0, 0x01,
-    0xF4, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x3E, 0x00, 0x1F, 0x80,
-    0xFC, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x40, 0x0B, 0xD0,
-    0x01, 0xFC, 0x00, 0x00, 0x74, 0xAF, 0x80, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0x91, 0xF4, 0x01,
-    0xFC, 0x00, 0xF8, 0x02, 0xF4, 0x00, 0xF8, 0x03, 0xF0, 0x00, 0xF4, 0x07, 0xD0, 0x01, 0xF4, 0x0B,
-    0xC0, 0x02, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x1F, 0xC0, 0x07, 0xE0, 0x2F, 0x80, 0x0B, 0xE0, 0x3F,
-    0x40, 0x0F, 0xD0, 0x7F, 0x00, 0x0F, 0xC0, 0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xBF, 0x80, 0x00,
-    0x07, 0xFF, 0xFC, 0x00, 0x0B, 0xF5, 0x5F, 0xC0, 0x07, 0xD0, 0x01, 0xF0, 0x03, 0xE0, 0x00, 0x3D,
-    0x01, 0xF0, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x01,
-    0xF4, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x40, 0xAE, 0x40, 0x00, 0x02, 0xE7, 0xFF,
-    0xE0, 0x00, 0x03, 0xFF, 0xD1, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x78, 0x00, 0x03, 0xF4, 0x00, 0x78,
-    0x00, 0x07, 0xE0, 0x00, 0x78, 0x00, 0x0B, 0xD0, 0x00, 0xB8, 0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00,
-    0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x2F, 0xE0, 0x03, 0xE0, 0x00, 0x3F, 0xFE, 0x6F, 0xC0, 0x00, 0x7F,
-    0xFF, 0xFF, 0x40, 0x00, 0xFE, 0xFF, 0xFD, 0x00, 0x01, 0xF4, 0xBF, 0xF0, 0x00, 0x03, 0xF0, 0x05,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0xBC, 0x00, 0x2F, 0xEF, 0xCF, 0x80, 0x0B, 0xD0,
-    0x1F, 0xF0, 0x02, 0xF0, 0x00, 0xFF, 0x00, 0x3D, 0x00, 0x0F, 0xD0, 0x0B, 0xC0, 0x01, 0xFC, 0x00,
-    0xF4, 0x00, 0x2F, 0x80, 0x0F, 0x00, 0x03, 0xF4, 0x01, 0xF0, 0x00, 0xBF, 0x00, 0x1F, 0x00, 0x2F,
-    0xE0, 0x00, 0xFE, 0xAF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xB8, 0x00, 0x00,
-    0xBF, 0x8B, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x6D, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x2B, 0x00, 0x1F, 0xBF, 0xC0, 0x0B, 0xFF, 0xF0, 0x03, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xA0, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x7E, 0x00, 0x7E, 0xAB, 0xF4, 0x0B, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFD, 0x00, 0x6F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00,
-    0x6B, 0xFA, 0x97, 0xFF, 0xFF, 0x40, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD5, 0x00, 0xBF, 0xFD,
-    0x03, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x1F, 0x00, 0x03, 0xD0, 0xBC,
-    0x00, 0x2F, 0x03, 0xE0, 0x00, 0xFC, 0x0F, 0x40, 0x03, 0xE0, 0x7C, 0x00, 0x1F, 0x41, 0xF0, 0x00,
-    0xBC, 0x0B, 0xC0, 0x03, 0xF0, 0x3E, 0x00, 0x2F, 0x80, 0xFC, 0x02, 0xFE, 0x03, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFD, 0xF8, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x29, 0x3D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x03, 0xD0,
-    0x1F, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x2F, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x0F, 0xC0, 0xF8, 0x00,
-    0x0B, 0xD3, 0xF0, 0x00, 0x0B, 0xEB, 0xC0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0xA8, 0x3F, 0x00, 0x00,
-    0x01, 0xF8, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0xE0, 0x0F,
-    0xC0, 0x3E, 0x03, 0xF4, 0x1F, 0x40, 0x7E, 0x0F, 0xF8, 0x3F, 0x00, 0x7E, 0x3F, 0xFC, 0xBD, 0x00,
-    0x7E, 0xFF, 0xFE, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFD, 0xFF, 0xE0, 0x00, 0x7F,
-    0xF0, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x07, 0xD0, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x07, 0xE0, 0x7D, 0x00, 0x00, 0x3F, 0x2F, 0x40,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x03, 0xF6, 0xF8, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00,
-    0x7F, 0x40, 0xFE, 0x00, 0x1F, 0xD0, 0x0B, 0xF0, 0x07, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x3D, 0x00,
-    0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x07, 0xD0,
-    0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x01,
-    0xF8, 0xBD, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0x55, 0x5F, 0xE0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1A,
-    0xA0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00,
-    0x74, 0x00, 0x0F, 0x00, 0x00, 0xE0, 0x00, 0x1D, 0x00, 0x02, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0x40,
-    0x00, 0xB0, 0x00, 0x0F, 0x00, 0x00, 0xE0, 0x00, 0x1D, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x07,
-    0x40, 0x00, 0xB0, 0x00, 0x0F, 0x00, 0x01, 0xD0, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02,
-    0xA9, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x1A, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0xA3, 0xDD, 0x0D, 0x74, 0xB2, 0xCB, 0x03, 0xF8, 0x00, 0x05, 0x00, 0x00,
-    0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x7E, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x01, 0xF0,
-    0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x2C, 0x00, 0x01,
-    0xBF, 0xE0, 0x02, 0xFF, 0xF8, 0x03, 0xFB, 0xC0, 0x02, 0xF4, 0xF0, 0x00, 0xF8, 0x38, 0x00, 0x7C,
-    0x2C, 0x00, 0x3E, 0x0F, 0x00, 0x0F, 0x43, 0x80, 0x07, 0xD1, 0xD0, 0x01, 0xF8, 0xF0, 0x00, 0x7F,
-    0xB8, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xE0, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x03, 0xFE, 0x41, 0xF4, 0x00, 0x1F,
-    0xC0, 0x00, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0x00, 0x5B, 0xD5, 0x50, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0x94, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x02, 0xC0,
-    0x2F, 0xFF, 0xBF, 0x40, 0x7F, 0xFF, 0xF8, 0x00, 0xF8, 0x0B, 0x80, 0x0B, 0xC0, 0x1F, 0x00, 0x3D,
-    0x00, 0xBC, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xE0, 0x7F, 0x00, 0x2F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xF8, 0x1F, 0x9F, 0xEB, 0xE0, 0x24, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0xF4, 0x01, 0xF4, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x2F, 0x80,
-    0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x74, 0x00, 0x0F, 0x00, 0x00, 0xE0,
-    0x00, 0x1D, 0x00, 0x02, 0xC0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x1D, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x40, 0x00, 0xB0, 0x00, 0x0F, 0x00,
-    0x01, 0xD0, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x2F,
-    0xAB, 0xC0, 0x00, 0x01, 0xD0, 0x02, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x3E,
-    0x40, 0x1B, 0xD0, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x01,
-    0xF0, 0x00, 0xBF, 0xF5, 0x6F, 0x80, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x19, 0x55, 0xFF, 0x40, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x2F, 0x80, 0xBE, 0x3F, 0x80, 0xFD, 0x7F, 0x42, 0xFD,
-    0x00, 0x1A, 0x00, 0x0A, 0x42, 0x40, 0xAB, 0x02, 0x07, 0xC0, 0x05, 0x39, 0x00, 0x14, 0xB0, 0x00,
-    0x82, 0xD0, 0x02, 0x09, 0xF4, 0x30, 0x18, 0x0B, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x80, 0x74, 0xF0, 0x30, 0x1C, 0x18, 0x0A, 0x09, 0x03, 0x83, 0x43, 0xD0, 0xFF, 0xF4, 0x0F, 0xDC,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x01, 0xD0, 0x01, 0xD0, 0x03, 0xE0, 0x02, 0xF0, 0x07, 0xD0,
-    0x07, 0xE0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0F, 0x80, 0x0B, 0x80, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x7F,
-    0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0D, 0x00, 0x1D, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x3F, 0xA9, 0x50, 0x0F, 0xFF, 0xFF, 0xC1, 0x55, 0x6B, 0xE0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1A, 0xAA,
-    0xAA, 0x0F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x00, 0x1A, 0x00, 0x0B, 0x42, 0x40, 0xBA, 0x02,
-    0x06, 0x82, 0x05, 0x32, 0x10, 0x14, 0x9F, 0x80, 0xC2, 0x93, 0x07, 0x0B, 0x1C, 0x30, 0x1C, 0x0B,
-    0x00, 0x1B, 0x90, 0x00, 0x01, 0x55, 0x83, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0x80, 0xF4, 0x0F, 0x40, 0x1F, 0x0B, 0xC0, 0x07, 0xC3,
-    0xE0, 0x02, 0xE0, 0xF8, 0x01, 0xF4, 0x3F, 0x42, 0xFC, 0x0B, 0xFF, 0xFC, 0x00, 0xFF, 0xF8, 0x00,
-    0x06, 0xA4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x55, 0xBD, 0x54, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x6A, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x15, 0x40, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x41, 0xC0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0xBF,
-    0xE0, 0x2A, 0xA4, 0x00, 0x03, 0xF8, 0x00, 0x05, 0x00, 0x05, 0x00, 0x1C, 0x03, 0xF0, 0x00, 0x38,
-    0x00, 0x28, 0x00, 0x74, 0x7F, 0xF0, 0x6E, 0x40, 0x00, 0xE0, 0x3C, 0x0B, 0x41, 0xE0, 0x3C, 0x00,
-    0x00, 0x0F, 0x00, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xE0,
-    0x00, 0xFC, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x2F, 0x00,
-    0x1F, 0xC0, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0xBE, 0x00, 0x3F, 0xC0, 0x2F, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x1D, 0xFF, 0xFF, 0xFC, 0x02, 0xC7, 0xFF, 0xDF, 0x80, 0x38,
-    0x05, 0x40, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0x41, 0xD0, 0x00, 0xFF, 0xC0, 0xB0, 0x00, 0xBF, 0xF0, 0x3C, 0x00, 0x3F,
-    0xF4, 0x0E, 0x00, 0x2F, 0xFC, 0x07, 0x40, 0x0B, 0xFF, 0x02, 0xC0, 0x02, 0xFF, 0x40, 0xF0, 0x00,
-    0x3F, 0xC0, 0x38, 0x00, 0x07, 0xF0, 0x1D, 0x00, 0x02, 0xF4, 0x0B, 0x00, 0x00, 0xFC, 0x03, 0xC0,
-    0x00, 0xBF, 0x00, 0xE0, 0x00, 0x3F, 0x40, 0x74, 0x00, 0x2F, 0xC0, 0x2D, 0x00, 0x0F, 0xF0, 0x0F,
-    0x00, 0x07, 0xF4, 0x03, 0xC0, 0x03, 0xFC, 0x01, 0xE0, 0x01, 0xFE, 0x00, 0xB4, 0x00, 0xFF, 0x40,
-    0x3C, 0x00, 0x7F, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0F, 0xD1, 0xFC, 0x3F, 0xC0, 0x02,
-    0x00, 0x20, 0x01, 0xE4, 0x00, 0x24, 0x00, 0x90, 0x5F, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0xC0, 0x1C, 0x02, 0x80, 0x34, 0x07, 0x00, 0xB0, 0xBF, 0xEA, 0xA8, 0x01, 0xFC, 0x02, 0xD2, 0xC0,
-    0xC0, 0x30, 0xA0, 0x0C, 0x34, 0x07, 0x0E, 0x07, 0x42, 0xFF, 0x80, 0x2F, 0x40, 0x40, 0x00, 0x40,
-    0x00, 0x1D, 0x00, 0x1D, 0x00, 0x03, 0xE0, 0x02, 0xE0, 0x00, 0x2F, 0x40, 0x1F, 0x40, 0x00, 0xF8,
-    0x00, 0xF8, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xF0, 0x07, 0xF0, 0x03, 0xF8, 0x03, 0xF4, 0x02,
-    0xFC, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xEC, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x09, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x74, 0x00, 0x00, 0xF0, 0x00, 0xB0,
-    0x00, 0x02, 0xC0, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x01, 0xE0, 0x00, 0x1D, 0x00, 0x02, 0xD0, 0x00,
-    0x78, 0x00, 0x17, 0xD4, 0x00, 0xF0, 0x00, 0x7F, 0xFE, 0x03, 0xC0, 0x00, 0xBF, 0xFD, 0x0F, 0x00,
-    0x74, 0x00, 0x00, 0x2D, 0x01, 0xF0, 0x00, 0x00, 0xB4, 0x07, 0xF0, 0x00, 0x01, 0xE0, 0x1E, 0xA0,
-    0x00, 0x07, 0xC0, 0x78, 0xE0, 0x00, 0x1F, 0x01, 0xE1, 0xD0, 0x00, 0x3C, 0x07, 0xC2, 0xD4, 0x00,
-    0xF4, 0x0B, 0xFF, 0xF8, 0x03, 0xE0, 0x06, 0xAB, 0xD0, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x2F, 0x00,
-    0x00, 0x0F, 0x40, 0x14, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x04, 0x00, 0x03, 0x80, 0x00, 0x02, 0xC0, 0x00, 0x74,
-    0x00, 0x00, 0xB0, 0x00, 0x0B, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x40, 0x00, 0x0E,
-    0x00, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x00, 0x38, 0x00, 0x01, 0x7D, 0x40, 0x0F, 0x05, 0x00, 0x7F,
-    0xFE, 0x03, 0xDF, 0xFE, 0x0B, 0xFF, 0xD0, 0xF2, 0x90, 0xB4, 0x00, 0x00, 0x2D, 0x00, 0x03, 0x40,
-    0x00, 0x0B, 0x80, 0x00, 0x74, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xD0,
-    0x00, 0x0F, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0xF4, 0x00, 0xBF, 0x40,
-    0x00, 0x3E, 0x00, 0x2F, 0xE5, 0x40, 0x0B, 0x80, 0x03, 0xFF, 0xF8, 0x02, 0xF0, 0x00, 0x7F, 0xFF,
-    0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x14, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x0D, 0x00, 0x00, 0x70, 0x00,
-    0x0E, 0x00, 0x15, 0xB0, 0x00, 0x0F, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0x00, 0x00, 0x1F, 0x00, 0x0B,
-    0x00, 0x00, 0x02, 0xC0, 0x07, 0x40, 0x00, 0x00, 0xF0, 0x07, 0x80, 0x00, 0x00, 0xB4, 0x03, 0x80,
-    0x00, 0xFF, 0xFC, 0x03, 0xC0, 0x00, 0xBF, 0xF8, 0x03, 0xC0, 0x1D, 0x01, 0x50, 0x03, 0xD0, 0x1F,
-    0x00, 0x00, 0x02, 0xD0, 0x1F, 0xC0, 0x00, 0x02, 0xE0, 0x1E, 0xA0, 0x00, 0x01, 0xF0, 0x1E, 0x38,
-    0x00, 0x01, 0xF0, 0x1E, 0x1D, 0x00, 0x00, 0xF0, 0x1F, 0x0B, 0x50, 0x00, 0xF4, 0x0B, 0xFF, 0xF8,
-    0x00, 0xF8, 0x01, 0xAA, 0xF4, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00,
-    0x14, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x02, 0x40, 0x1F, 0xE0, 0x1F, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xEB,
-    0xC0, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x3E, 0x07, 0xD0,
-    0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-    0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xF5, 0x55,
-    0x57, 0xF8, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x03, 0xE1, 0xF4, 0x00,
-    0x00, 0x03, 0xF0, 0x7D, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00,
-    0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00,
-    0x2F, 0x40, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x07,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFD, 0x55, 0x55, 0xFE, 0x01, 0xFC,
-    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xEE, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0xB0, 0x00, 0x00, 0x02, 0x80, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0x00,
-    0x1F, 0x47, 0xD0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x7E, 0x00, 0x00, 0x07,
-    0xD0, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x01, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xD5, 0x55, 0x5F, 0xE0, 0x1F, 0xC0, 0x00,
-    0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0C, 0x00, 0x00, 0x00, 0x75, 0xC1, 0xC0, 0x00, 0x00,
-    0x0F, 0x0B, 0xB8, 0x00, 0x00, 0x00, 0xD0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00,
-    0x00, 0x03, 0xE0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x3E, 0x00,
-    0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x55, 0x55, 0x7F, 0x80, 0x1F, 0xC0, 0x00, 0x03,
-    0xF8, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00,
-    0x00, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x00,
-    0x07, 0xD0, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xD5, 0x55,
-    0x5F, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0x45, 0x00, 0x00,
-    0x00, 0x0A, 0x09, 0x00, 0x00, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00,
-    0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x01,
-    0xF4, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x80,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xF5, 0x55, 0x57, 0xF8, 0x1F, 0xC0, 0x00, 0x03, 0xF8,
-    0x3F, 0x80, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xEA, 0x90, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD7,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xF8, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x04, 0x00,
-    0x0F, 0xFF, 0xE9, 0x6F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xAA, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xE5, 0x55, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xAA, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE5, 0x55, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x00, 0x07,
-    0x41, 0xE0, 0x00, 0x00, 0x34, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xEA, 0x90, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x55, 0x55, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x2F, 0x80, 0xBD, 0x00,
-    0x00, 0x3F, 0x80, 0xFD, 0x00, 0x00, 0x7F, 0x42, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xEA, 0x90, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x95, 0x55, 0x50, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00,
-    0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x3F,
-    0xC0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2E, 0xB4, 0x00, 0x07, 0x81, 0xE0, 0x00, 0xD0, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x2F, 0x80, 0x3F, 0x80, 0xFE,
-    0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x06, 0xFF, 0x40, 0x00,
-    0x7D, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4,
-    0x00, 0x3E, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x82, 0xAF, 0xEA, 0x90, 0x00,
-    0xFE, 0x2F, 0xFF, 0xFF, 0x80, 0x03, 0xF4, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x0B, 0xD0, 0x00,
-    0x00, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x07, 0xE5,
-    0x55, 0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xE9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x01, 0xC0, 0x00, 0x00, 0x00, 0xB7, 0x82, 0x80, 0x00, 0x00, 0x00,
-    0xE1, 0xC7, 0x40, 0x00, 0x00, 0x01, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01,
-    0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xFD,
-    0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x7F, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0xFE, 0x3F, 0x80, 0x7F,
-    0x00, 0x00, 0xFD, 0x2F, 0x80, 0xBF, 0x00, 0x02, 0xFC, 0x1F, 0xC0, 0xFD, 0x00, 0x03, 0xFC, 0x1F,
-    0xC1, 0xFC, 0x00, 0x07, 0xF8, 0x0F, 0xD2, 0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xE3, 0xF8, 0x00, 0x0F,
-    0xF0, 0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xF0, 0x07, 0xFB, 0xF0, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0xE0,
-    0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00,
-    0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00,
-    0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F,
-    0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00,
-    0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F,
-    0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00,
-    0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F,
-    0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55,
-    0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4,
-    0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B,
-    0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00,
-    0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F,
-    0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x03, 0x00, 0x00, 0x00, 0x02, 0xD7, 0x4B,
-    0x00, 0x00, 0x00, 0x03, 0x82, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F,
-    0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00,
-    0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F,
-    0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F,
-    0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00,
-    0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00,
-    0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00,
-    0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F,
-    0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD,
-    0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x1E, 0x00, 0x3E,
-    0x2E, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xD0, 0x01, 0xFD, 0xFC, 0x02, 0xF8,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x47, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x5B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x02, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xF0, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x02, 0xFC, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x56, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x54, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0,
-    0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x1F,
-    0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x00,
-    0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0xC0,
-    0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x0F,
-    0xFF, 0xAB, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x54, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x40,
-    0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x7F,
-    0x40, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00,
-    0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8,
-    0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x02,
-    0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFD, 0x00,
-    0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x55, 0x40, 0x07,
-    0xF8, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80,
-    0x03, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x00,
-    0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x40,
-    0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x2F,
-    0xC0, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0xEA, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x02, 0xFC, 0x00, 0x00,
-    0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x01, 0x54, 0x00, 0x1F, 0xE0, 0x00, 0x0F,
-    0xF4, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x00,
-    0x0B, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00,
-    0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x03, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF4, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x7F, 0x01, 0xFC, 0x00,
-    0x0F, 0xC0, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00,
-    0xBF, 0x07, 0xF0, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0xFD, 0x7F, 0xC0, 0x00, 0xF4, 0x07, 0xF0, 0x01, 0xF0, 0x01, 0xF4, 0x02,
-    0xF0, 0x00, 0xB4, 0x03, 0xE0, 0x00, 0xB4, 0x03, 0xD0, 0x02, 0xF0, 0x07, 0xC0, 0x0B, 0xD0, 0x0B,
-    0xC0, 0x7F, 0x80, 0x0F, 0xDB, 0xFD, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x02, 0xF4, 0x0F, 0x00, 0x00, 0xBC, 0x00,
-    0x34, 0x00, 0x0F, 0x00, 0x03, 0x40, 0x01, 0xE0, 0x01, 0xB4, 0x00, 0x3D, 0x01, 0xF9, 0x00, 0x03,
-    0xC0, 0x78, 0x00, 0x00, 0x7C, 0x0B, 0x00, 0x00, 0x0B, 0x80, 0xE0, 0x00, 0x00, 0xF4, 0x0F, 0x00,
-    0x00, 0x1F, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xE0,
-    0x00, 0x3C, 0x00, 0xBD, 0x00, 0x03, 0xC0, 0x0F, 0xC4, 0x00, 0xFC, 0x00, 0xFC, 0xFF, 0xFF, 0x40,
-    0x2F, 0x8F, 0xFF, 0xD0, 0x03, 0xF4, 0xBF, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x2C, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0xF4, 0x00,
-    0xF8, 0x03, 0xD0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF4, 0x0F, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x03,
-    0xF0, 0x1E, 0x00, 0x0B, 0xF0, 0x2F, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xF7, 0xC0, 0x02, 0xFF, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x2C, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0xF4, 0x00,
-    0xF8, 0x03, 0xD0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF4, 0x0F, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x03,
-    0xF0, 0x1E, 0x00, 0x0B, 0xF0, 0x2F, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xF7, 0xC0, 0x02, 0xFF, 0x87, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x07, 0xEE, 0x00, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x02, 0x80, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE2, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7E, 0x02, 0xFC, 0x00,
-    0x3D, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x1F, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x01, 0xF0,
-    0x03, 0xC0, 0x00, 0xFC, 0x01, 0xE0, 0x00, 0xBF, 0x00, 0xBC, 0x00, 0xFF, 0x80, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x7C, 0x00, 0x0B, 0xFE, 0x1F, 0x00, 0x00, 0x00,
-    0xF8, 0x0E, 0x00, 0x03, 0xDD, 0x0D, 0x00, 0x07, 0x0B, 0x2C, 0x00, 0x0F, 0x03, 0xF4, 0x00, 0x04,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x2C, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7E,
-    0x02, 0xFC, 0x00, 0xF4, 0x00, 0xF8, 0x03, 0xD0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF4, 0x0F, 0x00,
-    0x01, 0xF0, 0x0F, 0x00, 0x03, 0xF0, 0x1E, 0x00, 0x0B, 0xF0, 0x2F, 0x00, 0x3F, 0xE0, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xF7, 0xC0, 0x02, 0xFF, 0x87, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xD0, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x3F, 0x41, 0xFC, 0x00,
-    0x2F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xB0,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0x80, 0xBF, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x40, 0x03,
-    0xE0, 0x07, 0xC0, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x78, 0x00,
-    0x2F, 0xC0, 0x2F, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xDF, 0x00, 0x02, 0xFF, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x28, 0x30,
-    0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x2C, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x7E, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0xF8, 0x03, 0xD0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF4,
-    0x0F, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x03, 0xF0, 0x1E, 0x00, 0x0B, 0xF0, 0x2F, 0x00, 0x3F, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xF7, 0xC0, 0x02, 0xFF, 0x87, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x2F, 0xE2, 0xDF, 0xFB, 0xE0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x03, 0x40, 0x07, 0xE0, 0x2F, 0xF4, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0xFE, 0x00, 0x07,
-    0xC0, 0x3D, 0x00, 0x0F, 0xEA, 0xFF, 0xFC, 0x07, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x00,
-    0x1F, 0x95, 0x40, 0x00, 0x0F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF9, 0x56, 0xC0, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0x87, 0xC7, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xF8, 0x03, 0xFD, 0x04, 0x02,
-    0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07,
-    0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x80, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x70, 0x00,
-    0x0B, 0xF4, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFB, 0xF0, 0x00,
-    0x3F, 0x40, 0x38, 0x00, 0xB8, 0x00, 0x2C, 0x02, 0xE0, 0x00, 0x7C, 0x03, 0xEA, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x0F, 0x95, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xD0, 0x0B, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x03,
-    0xF4, 0x03, 0x80, 0x02, 0xE0, 0x00, 0xB0, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0xFA, 0xBF, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x3E, 0x55, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE5, 0x5B, 0x40, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x0B, 0xBD, 0x00, 0x00, 0x07, 0x81, 0xE0, 0x00, 0x03, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x0F, 0xD0, 0x0E,
-    0x00, 0x0B, 0x80, 0x02, 0xC0, 0x0B, 0x80, 0x01, 0xF0, 0x03, 0xEA, 0xFF, 0xFC, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0xF9, 0x54, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x95, 0x6D, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x01, 0xFC,
-    0x0B, 0xE0, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0x07, 0xF8, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x03, 0xF4, 0x03, 0x80, 0x00, 0xB8, 0x00, 0x2C, 0x00, 0x2E,
-    0x00, 0x07, 0xC0, 0x03, 0xEA, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0x95, 0x40, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF9,
-    0x56, 0xD0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0x90, 0x00,
-    0x01, 0x40, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0B, 0x40, 0x03, 0xC0, 0x01, 0xF0, 0x00,
-    0xB8, 0x00, 0x3D, 0x00, 0x1F, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x00,
-    0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x01, 0xF8,
-    0x00, 0x03, 0xEF, 0x00, 0x0B, 0x42, 0xD0, 0x1C, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07,
-    0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0xFC, 0x07,
-    0xF0, 0xBF, 0x03, 0xF8, 0x3F, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x06, 0xAB, 0xEA, 0x80, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0xF8, 0x0F, 0x00,
-    0x00, 0x07, 0xFF, 0xF1, 0xE0, 0x00, 0x02, 0xF8, 0x0B, 0xBC, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xD0,
-    0x00, 0x02, 0xF0, 0x00, 0xB8, 0x00, 0x00, 0x2F, 0xD5, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0xC0, 0x00, 0x07, 0xAC, 0x2C, 0x00, 0x00, 0xE0, 0xEB, 0x40, 0x00, 0x1D, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4A, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0F, 0xF9, 0x1F, 0x40, 0x01, 0xFC, 0x00, 0xF8, 0x00, 0x2F,
-    0x40, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x02, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x07, 0xE0, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x3F, 0x40,
-    0x0F, 0xD0, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x05,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xAF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFD, 0x57, 0xF0, 0x01,
-    0xF4, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x01, 0xF0,
-    0x0F, 0x40, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0x7D, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x3F, 0xFB, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFD,
-    0x57, 0xF0, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x03, 0xD0, 0x3E,
-    0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0x7D, 0x01, 0xF8, 0x00, 0x7F, 0x00,
-    0x3F, 0xFB, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07,
-    0x82, 0xD0, 0x00, 0x03, 0x40, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0B, 0xF5, 0x5F, 0xC0,
-    0x07, 0xD0, 0x01, 0xF0, 0x03, 0xE0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x07,
-    0xC0, 0x3D, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x01, 0xF4, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0xFF, 0xEF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xA0, 0x00, 0x0F, 0x38, 0x34, 0x00, 0x07, 0x07, 0xBC,
-    0x00, 0x02, 0xC0, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFD,
-    0x57, 0xF0, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x03, 0xD0, 0x3E,
-    0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0x7D, 0x01, 0xF8, 0x00, 0x7F, 0x00,
-    0x3F, 0xFB, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x07, 0xE0, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00,
-    0xBF, 0x42, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0x0B, 0xF5, 0x5F, 0xC0, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x03, 0xD0,
-    0x07, 0xC0, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x00, 0xFC, 0x01, 0xF0, 0x00,
-    0x1F, 0x40, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1B, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE,
-    0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0x5F, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x2E, 0x3C, 0x00, 0x00, 0x03, 0xE0, 0x7C, 0x3D, 0x00, 0x00,
-    0x07, 0xC0, 0xF4, 0x3C, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0x7C, 0x00, 0x00, 0x0F, 0x43, 0xD0, 0xFC,
-    0x00, 0x00, 0x1F, 0x0B, 0xC1, 0xF4, 0x00, 0x00, 0x1F, 0x4F, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x3E, 0x07, 0xC0, 0x00, 0xF4, 0x2F, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0xF8,
-    0x1F, 0x00, 0x07, 0xD0, 0x7C, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0xFC, 0x0F, 0x80, 0x0B, 0xE0, 0x3F,
-    0x00, 0xBF, 0x80, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0x7E, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0xF4, 0x2F, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x3F, 0x03, 0xD0,
-    0x00, 0xF8, 0x1F, 0x00, 0x07, 0xD0, 0x7C, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0xFC, 0x0F, 0x80, 0x0B,
-    0xE0, 0x3F, 0x00, 0xBF, 0x80, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0x7E, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFB, 0xC0, 0x00, 0x0B, 0x42, 0xD0, 0x00, 0x74, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x0F, 0x81, 0xF0, 0x00, 0x3D, 0x0B, 0xC0, 0x02, 0xF0, 0x3E, 0x00, 0x0F, 0xC0, 0xF4, 0x00,
-    0x3E, 0x07, 0xC0, 0x01, 0xF4, 0x1F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x02, 0xF8,
-    0x0F, 0xC0, 0x2F, 0xE0, 0x3F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xDF, 0x80, 0x01, 0x50, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x2F, 0x40, 0xFD, 0x00,
-    0x3F, 0x41, 0xFC, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF4, 0x0B, 0xC0, 0x02, 0xF0, 0x0F,
-    0x80, 0x03, 0xF0, 0x0F, 0x40, 0x03, 0xE0, 0x1F, 0x00, 0x07, 0xD0, 0x1F, 0x00, 0x0B, 0xC0, 0x2F,
-    0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0xBF, 0x80, 0x3F, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x7E, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x0B, 0xC0, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x1F, 0x40,
-    0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0x07,
-    0xE2, 0xF4, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x1F, 0x0B, 0xE0, 0x00,
-    0xB8, 0x07, 0xC0, 0x03, 0xD0, 0x0B, 0x80, 0x0F, 0x00, 0x0E, 0x00, 0x7C, 0x00, 0x74, 0x02, 0xE0,
-    0x02, 0xC0, 0x0F, 0x40, 0x1F, 0x00, 0x3C, 0x01, 0xF4, 0x01, 0xF0, 0x1F, 0x80, 0x0B, 0x82, 0xF8,
-    0x00, 0x3E, 0xBF, 0x40, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xD4, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x00, 0xBF,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00,
-    0x1F, 0x40, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0x0B,
-    0xD0, 0xFC, 0x00, 0x00, 0x07, 0xE2, 0xF4, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xAF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xC0,
-    0x00, 0x00, 0x01, 0xF4, 0x7D, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x7E,
-    0x00, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x03,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x55,
-    0x57, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAB, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF2,
-    0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3D, 0x00,
-    0x0F, 0x80, 0x1F, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x01, 0xF0, 0x03, 0xC0, 0x00, 0xFC, 0x01, 0xE0,
-    0x00, 0xBF, 0x00, 0xBC, 0x00, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0x7C, 0x00, 0x0B, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x50, 0x00, 0x00,
-    0x0E, 0x00, 0x0D, 0x00, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0xBC, 0x00,
-    0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xE0,
-    0x00, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x3F,
-    0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x55, 0x55,
-    0x7F, 0x80, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0B, 0x00, 0x07, 0x00, 0x03, 0xC0, 0x03, 0x80, 0x00, 0xBD, 0x5B, 0xC0,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x2C, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xE0,
-    0x2F, 0xC0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0xF0,
-    0x00, 0x1F, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x1E, 0x00, 0x0B, 0xF0, 0x0B, 0xC0, 0x0F, 0xF8, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xF7, 0xC0, 0x00, 0xBF, 0xE1, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00,
-    0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x01,
-    0xF4, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x80,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xF5, 0x55, 0x57, 0xF8, 0x1F, 0xC0, 0x00, 0x03, 0xF8,
-    0x3F, 0x80, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x2C,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0xF8, 0x03, 0xD0, 0x00, 0xF8,
-    0x07, 0xC0, 0x00, 0xF4, 0x0F, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x03, 0xF0, 0x1E, 0x00, 0x0B, 0xF0,
-    0x2F, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xF7, 0xC0,
-    0x02, 0xFF, 0x9F, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xFA, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x04, 0x00, 0x0F, 0xFF, 0xE9, 0x6F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x74, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFE, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xD0, 0x40, 0x02, 0xF8, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xB8, 0x00, 0x00, 0x00, 0x07, 0x81, 0xE0, 0x00, 0x00,
-    0x00, 0xD0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x04, 0x00, 0x0F, 0xFF, 0xE9, 0x6F,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x03, 0xC1, 0xE0, 0x00, 0x03, 0x80, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x40, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFE, 0x96, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x0B,
-    0xFF, 0xE0, 0x0F, 0xF4, 0x10, 0x0B, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x3C, 0x07, 0x80, 0x00, 0x00, 0x00, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x04, 0x00, 0x0F, 0xFF, 0xE9, 0x6F, 0xC0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0x00, 0x0F, 0x00, 0xB0, 0x00, 0x03, 0xCB, 0x80, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFF,
-    0x41, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x07, 0x40, 0x00, 0x00, 0x0B,
-    0x47, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xE0, 0x01, 0xBF, 0xD0, 0x00,
-    0x7D, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0x1F, 0x80, 0x00, 0x03, 0xF8, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x00, 0x03, 0xF8,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0xFF,
-    0x00, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0x0B, 0xFD, 0x01, 0xF9, 0x55, 0xAF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0xB4, 0x00, 0x00, 0x69, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xFF, 0xCB, 0xC0, 0x50, 0x00, 0x1F, 0xFF,
-    0xEF, 0x80, 0x00, 0x00, 0x7E, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0x40, 0x01, 0xFC, 0x00,
-    0x00, 0x0F, 0x40, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x2F,
-    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x06, 0xFF, 0x40, 0x00, 0x7D,
-    0x00, 0x00, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00,
-    0x3E, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x82, 0xAF, 0xEA, 0x90, 0x00, 0xFE,
-    0x2F, 0xFF, 0xFF, 0x80, 0x03, 0xF4, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x0B, 0xD0, 0x00, 0x00,
-    0xBF, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x07, 0xE5, 0x55,
-    0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0A,
-    0xAF, 0xEA, 0x40, 0x00, 0x06, 0x90, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0xF0, 0x00, 0x00, 0x1F,
-    0xFF, 0xEF, 0x80, 0x00, 0x01, 0xF8, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0xF0, 0x00, 0x00,
-    0xF4, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x3D, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x2F, 0xF0,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xBF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xEA,
-    0x90, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x01,
-    0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0x95, 0x55, 0x50, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x38, 0x00, 0x0B, 0x80, 0x02,
-    0xC0, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0x3E, 0xAF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xF9,
-    0x54, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0x95, 0x6D, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x6F,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0x00, 0x1F,
-    0x96, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xEA, 0x90, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0x95, 0x55, 0x50, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x1D,
-    0x00, 0x1C, 0x00, 0x01, 0xF0, 0x0B, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x0B, 0xFB, 0xF0, 0x00, 0x03, 0xF4, 0x03, 0x80, 0x00, 0xB8, 0x00, 0x2C, 0x00, 0x2E, 0x00, 0x07,
-    0xC0, 0x03, 0xEA, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0x95, 0x40, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xD0,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFA, 0xA4, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x55, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x3F, 0x40,
-    0x38, 0x00, 0xB8, 0x00, 0x2C, 0x02, 0xE0, 0x00, 0x7C, 0x03, 0xEA, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x0F, 0x95, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF9, 0x56, 0xD0, 0x0B, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFA, 0xA4, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xBE, 0x55, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x3F, 0x40, 0x38, 0x00, 0xB8,
-    0x00, 0x2C, 0x02, 0xE0, 0x00, 0x7C, 0x03, 0xEA, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0x95,
-    0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF9,
-    0x56, 0xD0, 0x0B, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x80,
-    0x00, 0x00, 0xF0, 0xB4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xEA, 0x90, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x02, 0xF9, 0x55, 0x55, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
-    0xB4, 0x07, 0x40, 0x00, 0x0B, 0x4F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFB,
-    0xF0, 0x00, 0x0F, 0xD0, 0x0E, 0x00, 0x0B, 0x80, 0x02, 0xC0, 0x0B, 0x80, 0x01, 0xF0, 0x03, 0xEA,
-    0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0x54, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x95, 0x6D, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xF0, 0x00,
-    0x00, 0x00, 0xB0, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFE, 0x40, 0x01, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x69,
-    0x40, 0x01, 0xFC, 0x00, 0x07, 0xFF, 0xF4, 0x2F, 0xC0, 0x00, 0x2B, 0xFF, 0x42, 0xFC, 0x00, 0x00,
-    0x0F, 0xA0, 0x2F, 0xC0, 0x00, 0x01, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xFF, 0xAA,
-    0xBF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x00, 0x07, 0x41, 0xE0, 0x00, 0x00, 0x34, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xA0, 0x00,
-    0x0B, 0xFF, 0xDB, 0xC0, 0x00, 0xBE, 0xAF, 0xFE, 0x00, 0x07, 0xC0, 0x1F, 0xF4, 0x00, 0x3D, 0x00,
-    0x3F, 0xC0, 0x01, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0x00, 0x03, 0xF4, 0x00, 0x3C, 0x00, 0x1F, 0xC0,
-    0x00, 0xE0, 0x00, 0xFE, 0x00, 0x07, 0xC0, 0x1F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0x9B, 0xC0, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x06, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x40, 0x00, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x00, 0x02, 0xE0, 0x0B, 0x40, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFE, 0x40, 0x01, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x69,
-    0x40, 0x01, 0xFC, 0x00, 0x07, 0xFF, 0xF4, 0x2F, 0xC0, 0x00, 0x2B, 0xFF, 0x42, 0xFC, 0x00, 0x00,
-    0x0F, 0xA0, 0x2F, 0xC0, 0x00, 0x01, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xFF, 0xAA,
-    0xBF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x0E,
-    0x00, 0x2C, 0x00, 0x00, 0xF9, 0x5F, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x28, 0x00, 0x0B, 0xFF, 0xDB, 0xC0, 0x02, 0xFA, 0xBF, 0xF8, 0x00,
-    0x7C, 0x01, 0xFF, 0x40, 0x0F, 0x40, 0x0F, 0xF0, 0x01, 0xE0, 0x00, 0xFE, 0x00, 0x3C, 0x00, 0x0F,
-    0xD0, 0x03, 0xC0, 0x01, 0xFC, 0x00, 0x38, 0x00, 0x3F, 0x80, 0x07, 0xC0, 0x1F, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0x9B, 0xC0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xF9, 0x00, 0x05, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xA5, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0xFF, 0x4B, 0xF0,
-    0x00, 0x0A, 0xFF, 0xD2, 0xFC, 0x00, 0x00, 0x0F, 0xA0, 0xBF, 0x00, 0x00, 0x07, 0xC0, 0x3F, 0xF0,
-    0x00, 0x03, 0xF0, 0x0B, 0xFF, 0xEA, 0xAF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x02, 0x80, 0x00, 0xBF, 0xFD, 0xBC, 0x00, 0x2F, 0xAB, 0xFF, 0x80,
-    0x07, 0xC0, 0x1F, 0xF4, 0x00, 0xF4, 0x00, 0xFF, 0x00, 0x1E, 0x00, 0x0F, 0xE0, 0x03, 0xC0, 0x00,
-    0xFD, 0x00, 0x3C, 0x00, 0x1F, 0xC0, 0x03, 0x80, 0x03, 0xF8, 0x00, 0x7C, 0x01, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xF9, 0xBC,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x18, 0x07, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x3F, 0xF9, 0x00, 0x05, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xA5, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0xFF, 0x4B, 0xF0, 0x00, 0x0A, 0xFF, 0xD2, 0xFC, 0x00, 0x00, 0x0F, 0xA0,
-    0xBF, 0x00, 0x00, 0x07, 0xC0, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0x0B, 0xFF, 0xEA, 0xAF, 0xF8, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x28, 0x00, 0x0B, 0xFF, 0xDB, 0xC0, 0x02, 0xFA, 0xBF, 0xF8, 0x00, 0x7C, 0x01, 0xFF, 0x40, 0x0F,
-    0x40, 0x0F, 0xF0, 0x01, 0xE0, 0x00, 0xFE, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x03, 0xC0, 0x01, 0xFC,
-    0x00, 0x38, 0x00, 0x3F, 0x80, 0x07, 0xC0, 0x1F, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0x9B, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x01, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xE0, 0x00, 0x00, 0x00, 0x03, 0x81,
-    0xF0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x7E, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00, 0x03,
-    0xF4, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xAA, 0xAA, 0xFF, 0x80, 0x0B,
-    0xF4, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0,
-    0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xEE, 0x00, 0x00, 0x0F, 0x43, 0xC0, 0x00, 0x2C, 0x00, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x3C, 0x19, 0x40, 0x00, 0xBE, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x40, 0xFC,
-    0x02, 0xFC, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x78, 0x07, 0xE0, 0x00, 0xB8, 0x0B, 0xC0, 0x00, 0xF4,
-    0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x80, 0x02, 0xF0, 0x2F, 0x40, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xE0,
-    0x7F, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF4, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xF5, 0x55, 0x56,
-    0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xAA, 0xAA, 0xBF, 0x80, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0x81, 0x54, 0x00, 0x6F, 0xFF,
-    0xF4, 0x00, 0xBF, 0xA5, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x19,
-    0x40, 0x00, 0xBE, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x40, 0xFC, 0x02, 0xFC, 0x00,
-    0x7C, 0x03, 0xF0, 0x00, 0x78, 0x07, 0xE0, 0x00, 0xB8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0xC0, 0x00,
-    0xF0, 0x1F, 0x80, 0x02, 0xF0, 0x2F, 0x40, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x7F, 0x00, 0x0F,
-    0xD0, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0x00, 0x3C, 0xA0, 0xD0,
-    0x07, 0x43, 0xAC, 0x00, 0xB0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0D, 0x07, 0x4E, 0x2C, 0x0F, 0x07, 0xF4, 0x0A, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B,
-    0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAB, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x02, 0xFF, 0xFF, 0xC2, 0xFF, 0xFE, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03,
-    0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80,
-    0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x01,
-    0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4,
-    0x00, 0x0B, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x70, 0x00, 0x00, 0x7A, 0x40, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x0F,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07,
-    0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x34, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F,
-    0x40, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00,
-    0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0F,
-    0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x02, 0xD0, 0x0F, 0x00, 0x3C, 0x01, 0xE0, 0x0B, 0x40, 0x3C, 0x01, 0xF0, 0x0B,
-    0x80, 0x3D, 0x01, 0xF0, 0x0B, 0xC0, 0x3F, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x01,
-    0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x07, 0xF0,
-    0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00,
-    0xBE, 0x00, 0x2F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x02, 0xF8,
-    0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x01,
-    0xFC, 0x00, 0x0B, 0xF0, 0x02, 0xF8, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x07, 0xF0,
-    0x00, 0x2F, 0xD0, 0x0B, 0xE0, 0x00, 0x3F, 0xC0, 0x0F, 0xD0, 0x00, 0x7F, 0xC0, 0x1F, 0xC0, 0x00,
-    0xBF, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFA,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xD0, 0x03,
-    0xF8, 0x00, 0x00, 0x3F, 0x40, 0x1F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x0A, 0x40, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x78, 0x00, 0x00, 0x0B, 0x80, 0x02, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x07, 0x80, 0x02, 0xF4, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x01, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0x00, 0x07, 0x41, 0xE0, 0x00,
-    0x00, 0x03, 0x40, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x04, 0x1F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x74, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xC1,
-    0xE0, 0x00, 0x00, 0x0E, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xFC, 0x00, 0x03,
-    0xF0, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x0F, 0xC1,
-    0xFD, 0x00, 0x00, 0x1F, 0xC7, 0xF4, 0x00, 0x00, 0x2F, 0x4F, 0xE0, 0x00, 0x00, 0x3F, 0x3F, 0x80,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0B,
-    0xF7, 0xFE, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x40, 0x00, 0x1F, 0xC1, 0xFF, 0xC0, 0x00, 0x2F, 0xC0,
-    0xFF, 0xE0, 0x00, 0x3F, 0x80, 0xBF, 0xF4, 0x00, 0x7F, 0x00, 0x3F, 0xFC, 0x00, 0xBF, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0xBD, 0x00, 0xF4, 0xBD, 0x00, 0xBC, 0xBD, 0x00,
-    0x3E, 0xBD, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFB, 0xF8, 0x00,
-    0x7D, 0xBF, 0x40, 0x3F, 0x0F, 0xF0, 0x0F, 0xC2, 0xFF, 0x07, 0xE0, 0x3F, 0xE2, 0xF4, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0xB4, 0x3D, 0x00, 0xF0, 0xF4,
-    0x01, 0xE2, 0xE0, 0x02, 0xDB, 0x80, 0x03, 0xDF, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x3D, 0xBE, 0x00, 0x3C, 0x3F, 0x40, 0x78, 0x3F, 0xC0, 0xF4, 0x1F,
-    0xE0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xA4, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x4F,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00,
-    0x0F, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00,
-    0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFE, 0x90, 0x07, 0xFF, 0x40, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0xFD,
-    0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x2F, 0x40, 0x05, 0x00, 0x3F, 0x00, 0x1E, 0x00, 0x7F, 0x00, 0x3D, 0x00, 0xBD, 0x00, 0x3C,
-    0x00, 0xFC, 0x00, 0xB8, 0x01, 0xFC, 0x00, 0xF4, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0xD0, 0x00, 0xBC, 0x0F, 0x00,
-    0x03, 0xE0, 0x7C, 0x00, 0x1F, 0x02, 0xE0, 0x00, 0xBC, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xE9, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x0B,
-    0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x01, 0xF8, 0x02, 0xFC, 0x00, 0xBD, 0x00, 0xFF, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x0B, 0xD0, 0x0F, 0x80,
-    0xFC, 0x00, 0xF4, 0x2F, 0xC0, 0x2F, 0x03, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0xA4, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x50, 0x00, 0x00, 0x02, 0xFB, 0xFE, 0x50, 0x01, 0x6B, 0xFF, 0xD4, 0x00, 0x02,
-    0xFF, 0x94, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02,
-    0xA4, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xFE, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x7F, 0x00, 0x2F, 0x80, 0x00, 0xBF,
-    0x3F, 0x40, 0x3F, 0x40, 0x00, 0xFE, 0x3F, 0x80, 0x7F, 0x00, 0x01, 0xFD, 0x2F, 0x80, 0xBE, 0x00,
-    0x02, 0xFC, 0x1F, 0xC0, 0xFD, 0x00, 0x03, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x07, 0xF8, 0x0F, 0xD2,
-    0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xE3, 0xF4, 0x00, 0x0F, 0xF0, 0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xF0,
-    0x07, 0xFB, 0xF0, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x00,
-    0x7F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4A, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0x91, 0xF4, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x0F, 0x80, 0x0F, 0xC0, 0x03, 0xD0,
-    0x07, 0xD0, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x1F,
-    0x80, 0x2F, 0x80, 0x0B, 0xE0, 0x0F, 0xD0, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0xFC, 0x02, 0xFC, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xFF, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x7F, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0xFE,
-    0x3F, 0x80, 0x7F, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0xBF, 0x00, 0x02, 0xFC, 0x1F, 0xC0, 0xFD, 0x00,
-    0x03, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x07, 0xF8, 0x0F, 0xD2, 0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xE3,
-    0xF4, 0x00, 0x0F, 0xF0, 0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xF0, 0x07, 0xFB, 0xF0, 0x00, 0x2F, 0xE0,
-    0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xC0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xAF, 0x80,
-    0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0x91, 0xF4, 0x01, 0xFC, 0x00, 0xF8, 0x02, 0xF4, 0x00, 0xF8,
-    0x03, 0xF0, 0x00, 0xF4, 0x07, 0xD0, 0x01, 0xF4, 0x0B, 0xC0, 0x02, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
-    0x1F, 0xC0, 0x07, 0xE0, 0x2F, 0x80, 0x0B, 0xE0, 0x3F, 0x40, 0x0F, 0xD0, 0x7F, 0x00, 0x0F, 0xC0,
-    0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0xFE, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x7F, 0x00, 0x2F, 0xC0, 0x00, 0xBF,
-    0x3F, 0x40, 0x3F, 0x40, 0x00, 0xFE, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0xBF, 0x00,
-    0x02, 0xFC, 0x1F, 0xC0, 0xFD, 0x00, 0x03, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x07, 0xF8, 0x0F, 0xD2,
-    0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xE3, 0xF4, 0x00, 0x0F, 0xF0, 0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xF0,
-    0x07, 0xFB, 0xF0, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x00,
-    0x7F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x40, 0x01,
-    0x40, 0x00, 0x78, 0x07, 0x80, 0x00, 0x0B, 0x8B, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4A, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0x91, 0xF4, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x0F, 0x80, 0x0F, 0xC0, 0x03, 0xD0,
-    0x07, 0xD0, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x1F,
-    0x80, 0x2F, 0x80, 0x0B, 0xE0, 0x0F, 0xD0, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0xFC, 0x02, 0xFC, 0x00,
-    0x7F, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x86, 0xF8, 0x00, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xF9, 0x1F, 0x40, 0x00, 0xFD, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x0B, 0x80, 0x03,
-    0xF0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x02, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x0B, 0xE0, 0x03, 0xF4,
-    0x00, 0xFD, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF4, 0x00,
-    0x0F, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x7F, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x3F,
-    0x40, 0x3F, 0x40, 0x00, 0xFE, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0xBF, 0x00, 0x02,
-    0xFC, 0x1F, 0xC0, 0xFD, 0x00, 0x03, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x07, 0xF8, 0x0F, 0xD2, 0xFC,
-    0x00, 0x0B, 0xF4, 0x0F, 0xE3, 0xF4, 0x00, 0x0F, 0xF0, 0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xF0, 0x07,
-    0xFB, 0xF0, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x7F,
-    0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x74, 0xAF, 0x80, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0x91, 0xF4, 0x01, 0xFC, 0x00, 0xF8, 0x02,
-    0xF4, 0x00, 0xF8, 0x03, 0xF0, 0x00, 0xF4, 0x07, 0xD0, 0x01, 0xF4, 0x0B, 0xC0, 0x02, 0xF0, 0x0F,
-    0xC0, 0x03, 0xF0, 0x1F, 0xC0, 0x07, 0xE0, 0x2F, 0x80, 0x0B, 0xE0, 0x3F, 0x40, 0x0F, 0xD0, 0x7F,
-    0x00, 0x0F, 0xC0, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFA, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF,
-    0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07,
-    0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00,
-    0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0xBF, 0xC0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xF5, 0x5F, 0xC0,
-    0x01, 0xF4, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0xF8, 0x00,
-    0x07, 0xC0, 0x0F, 0x40, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x1F, 0x80, 0x07, 0xF0, 0x00,
-    0xFF, 0xEF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x07, 0x40, 0x00, 0x00,
-    0x03, 0xE5, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0,
-    0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80,
-    0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x03,
-    0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x40, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x02, 0xE0, 0x0B, 0x40, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B,
-    0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xF5, 0x5F, 0xC0, 0x01, 0xF4, 0x00, 0x7C, 0x00,
-    0x3E, 0x00, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x00,
-    0xFC, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x15, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00,
-    0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00,
-    0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F,
-    0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x54, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0x55, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00,
-    0x1F, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x01,
-    0xF0, 0x00, 0x1F, 0x40, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xFE, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xD1, 0xAA, 0xAB, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x07, 0xFF, 0x56, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xF9, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x6F, 0xFF, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x0A,
-    0xFE, 0x00, 0xBF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x1F, 0xD0, 0x3C, 0x00, 0x2F, 0xD5, 0x7F, 0xF4,
-    0x00, 0x74, 0x01, 0xF4, 0x00, 0x7F, 0x40, 0x01, 0xE0, 0x0F, 0x80, 0x00, 0xFD, 0x6B, 0xFF, 0x80,
-    0x7C, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xE0, 0x00, 0x1F, 0xA9, 0x54, 0x00, 0x0F, 0x40, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0xBF, 0xFF, 0xF5, 0x57, 0x80, 0x0F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xF0, 0x00,
-    0xFC, 0x00, 0x03, 0xC0, 0x01, 0xF4, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x1F, 0x00,
-    0x03, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x00, 0x2F, 0xD0, 0x00, 0xFE, 0xAF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xF8, 0x03, 0xF8,
-    0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x1F,
-    0xD0, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x02,
-    0xFF, 0x00, 0xBF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0xAC, 0x00, 0x7E, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x00,
-    0x0F, 0x00, 0x07, 0xD0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0x00,
-    0x07, 0xF0, 0x00, 0x7C, 0x00, 0xBF, 0x40, 0x03, 0xFA, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x40,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x7F,
-    0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x0F,
-    0xF0, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x02,
-    0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC2, 0xB0, 0x00, 0x1F, 0xBF, 0xC0, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x07, 0x00, 0x00, 0x03,
-    0xD1, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0x0F, 0x00,
-    0x07, 0xD0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x07, 0xF0,
-    0x00, 0x7C, 0x00, 0xBF, 0x40, 0x03, 0xFA, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x7F,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x0F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x02,
-    0xFD, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x02, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0x40, 0x0A, 0x00, 0x78, 0x1E, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xAC, 0x00, 0x7E, 0xFF,
-    0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x00, 0x2F, 0xF9, 0x00, 0x10, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x40, 0x00, 0x1F, 0xFF, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x01, 0xF8, 0x01, 0xFA, 0xAF, 0xD0, 0x2F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF4,
-    0x01, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xB0, 0x00, 0x00, 0x00, 0xA0, 0x01,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xE4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x90,
-    0x01, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x17, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x40, 0x04, 0x00, 0x01, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x0B,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x07, 0x81, 0xE0, 0x00, 0x0D, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xA0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xEA,
-    0xBF, 0x40, 0x2F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xF9, 0x00, 0x10, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x40, 0x00, 0x1F, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xA0, 0x00, 0xBF, 0xFF, 0x40,
-    0x0B, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x7E, 0xAB,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x02, 0x40, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x01, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xF9, 0x00, 0x10, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x40, 0x00, 0x1F, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x40, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
-    0x90, 0x00, 0xF0, 0x2D, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x01, 0xF8, 0x01, 0xFA, 0xAF, 0xD0, 0x2F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF4, 0x01,
-    0xBF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE,
-    0xFE, 0xAF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x03, 0xE0, 0x00, 0x1F,
-    0x40, 0x00, 0xBC, 0x00, 0x6B, 0xFA, 0x97, 0xFF, 0xFF, 0x40, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x1F,
-    0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xD5, 0x00, 0xBF, 0xFD, 0x03, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x01, 0xE4, 0x00, 0x00, 0x24, 0x00,
-    0x01, 0xD0, 0x01, 0xFD, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0B, 0x00, 0x1D, 0x00, 0x00, 0x03, 0xC0,
-    0xF0, 0x00, 0x00, 0x00, 0xFB, 0x80, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE, 0xFE, 0xAF, 0xF8, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0xB0, 0x7C, 0x00, 0x3E, 0x0F, 0x40, 0x07, 0xD0, 0x50, 0x00, 0xBC,
-    0x00, 0x01, 0xAF, 0xEA, 0x40, 0x7F, 0xFF, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF5, 0x40, 0x00, 0xBF, 0xFD, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0xBF,
-    0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE, 0xFE,
-    0xAF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x06, 0xAF, 0xFA, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x6B, 0xFA, 0x90,
-    0x7F, 0xFF, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x0A, 0xAF, 0xEA, 0x4B, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD5, 0x00,
-    0x0B, 0xFF, 0xD0, 0x03, 0xFF, 0xF4, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x1C, 0x00, 0x00, 0x00, 0x2D, 0x74, 0xB0, 0x00, 0x00, 0x00, 0xE0, 0xBF,
-    0x00, 0x00, 0x00, 0x03, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x05, 0x54, 0x00, 0x7F,
-    0x80, 0x00, 0x3F, 0xD0, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00,
-    0x3F, 0x80, 0x00, 0x2F, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x02,
-    0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00,
-    0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC,
-    0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFE, 0xAF, 0xFF, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0xD0, 0x01, 0xD3, 0x8B, 0x00, 0x0F, 0x07, 0xF4, 0x00, 0x28, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x1F,
-    0x00, 0x03, 0xD0, 0xBC, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0xFC, 0x0F, 0x40, 0x03, 0xE0, 0x7C, 0x00,
-    0x1F, 0x41, 0xF0, 0x00, 0xBC, 0x0B, 0xC0, 0x03, 0xF0, 0x3E, 0x00, 0x2F, 0x80, 0xFC, 0x02, 0xFE,
-    0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFD, 0xF8, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x03, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xF8,
-    0x00, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x1F,
-    0xC0, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x00, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0xEA, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF4, 0x0B, 0xC0, 0x02, 0xF0, 0x0F,
-    0x80, 0x03, 0xF0, 0x0F, 0x40, 0x03, 0xE0, 0x1F, 0x00, 0x07, 0xD0, 0x1F, 0x00, 0x0B, 0xC0, 0x2F,
-    0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0xBF, 0x80, 0x3F, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x7E, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x3E, 0x56, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x05, 0x40, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x0B,
-    0xF4, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40,
-    0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F,
-    0x80, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x00,
-    0x3F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x3F,
-    0xD0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFA, 0xBF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x38, 0x00,
-    0x2F, 0x56, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x07,
-    0xC0, 0x00, 0xF4, 0x0B, 0xC0, 0x02, 0xF0, 0x0F, 0x80, 0x03, 0xF0, 0x0F, 0x40, 0x03, 0xE0, 0x1F,
-    0x00, 0x07, 0xD0, 0x1F, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x2F, 0x80, 0x3F,
-    0x00, 0xBF, 0x80, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F,
-    0xFF, 0x7E, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x20, 0x00, 0x00, 0x00, 0x01, 0xC1, 0x80, 0x00, 0x00, 0x00, 0x03, 0xAD, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x05,
-    0x40, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00,
-    0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xC0,
-    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x1F,
-    0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00,
-    0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0xFD,
-    0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFA, 0xBF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x02, 0x83, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x3A, 0xE0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0xBC, 0x0F, 0x80, 0x03, 0xF0,
-    0x3D, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x7D, 0x07, 0xC0, 0x02, 0xF0, 0x2F, 0x00, 0x0F, 0xC0, 0xF8,
-    0x00, 0xBE, 0x03, 0xF0, 0x0B, 0xF8, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xF7, 0xE0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x05, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01, 0x50, 0x00,
-    0x1F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD,
-    0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xF0, 0x00,
-    0x03, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x0F,
-    0xFF, 0xAB, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x50, 0x01, 0xF4, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x01,
-    0xF8, 0x02, 0xF8, 0x00, 0x1F, 0xC0, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00,
-    0x03, 0xD0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x03, 0xE0,
-    0x00, 0x7C, 0x00, 0x1F, 0x40, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x3E,
-    0x00, 0x2F, 0x80, 0x00, 0xFC, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFD, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x01, 0x50, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xD0, 0x02, 0xFD, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x01, 0xFD,
-    0x00, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00,
-    0xFE, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0B,
-    0xE0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0x00,
-    0x2F, 0xE0, 0x00, 0x3F, 0xFE, 0xAF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0xF8, 0x1F, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0xFC, 0x0F, 0x40, 0x03, 0xE0,
-    0x7C, 0x00, 0x1F, 0x41, 0xF0, 0x00, 0xBC, 0x0B, 0xC0, 0x03, 0xF0, 0x3E, 0x00, 0x2F, 0x80, 0xFC,
-    0x02, 0xFE, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFD,
-    0xF8, 0x00, 0x15, 0x0E, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xD0, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x02, 0xF8,
-    0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x07, 0xF8, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x00, 0xFD,
-    0x00, 0x2F, 0xC0, 0x3F, 0xFC, 0x02, 0xFC, 0x00, 0x2F, 0x80, 0xFF, 0xFD, 0x03, 0xF4, 0x00, 0x3F,
-    0x82, 0xFD, 0xFE, 0x0B, 0xF0, 0x00, 0x3F, 0x87, 0xFC, 0xFF, 0x0F, 0xD0, 0x00, 0x3F, 0x8F, 0xF0,
-    0xFF, 0x2F, 0xC0, 0x00, 0x3F, 0xBF, 0xD0, 0xBF, 0x7F, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0xBF, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x02, 0xF4, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0x0B, 0xD0, 0x3E, 0x01, 0xF0, 0x0F,
-    0xC0, 0x3E, 0x07, 0xF4, 0x2F, 0x40, 0x7E, 0x1F, 0xFC, 0x3F, 0x00, 0x7E, 0x7F, 0xFD, 0xBD, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xF9, 0xFF, 0xE0, 0x00, 0x7F,
-    0xF0, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0xF0, 0x2D, 0x00,
-    0x00, 0x1C, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xBD, 0x3F, 0x40, 0x00, 0x1F, 0x82, 0xF8, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0xFC, 0x01,
-    0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x7F,
-    0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFB, 0x80, 0x00, 0x00, 0x0F, 0x07, 0xC0, 0x00,
-    0x00, 0xB0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00, 0xBC,
-    0x00, 0x07, 0xD0, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0x00,
-    0xBD, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0xBD, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x02, 0xF4, 0x00,
-    0x0F, 0xD0, 0x3F, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xBD, 0x3F, 0x40, 0x00, 0x1F, 0x82, 0xF8, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0xFC,
-    0x01, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x0B, 0xF0,
-    0x7F, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6A, 0xAA, 0xAF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x55, 0x57, 0xF8, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x01, 0xAA, 0xAA, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0x55, 0x5F, 0xE0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6A, 0xAA, 0xAF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0A, 0x00,
-    0x00, 0xF0, 0x1E, 0x00, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x55, 0x57, 0xF8, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xE0, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00,
-    0x74, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x1F, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFC, 0x0F, 0xC0,
-    0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0xA0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x02, 0xFF, 0xD5, 0x5B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0A, 0xFE, 0x00,
-    0xD0, 0x01, 0xFF, 0xFF, 0x0B, 0x00, 0x2F, 0xD5, 0x7F, 0xB4, 0x01, 0xF4, 0x00, 0x7F, 0x40, 0x0F,
-    0x80, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x00,
-    0xFC, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x03, 0xFF, 0xBF, 0xF4, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xD5, 0x5F, 0xF0, 0x07, 0xFF,
-    0x80, 0x01, 0xF4, 0x0F, 0x5F, 0x40, 0x00, 0xF4, 0x0E, 0x3F, 0x00, 0x02, 0xF0, 0x1C, 0x3E, 0x00,
-    0x03, 0xF0, 0x0C, 0x7D, 0x00, 0x2F, 0xD0, 0x04, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xAE,
-    0x40, 0x00, 0x02, 0xE7, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xD1, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x78,
-    0x00, 0x07, 0xF4, 0x00, 0x78, 0x00, 0x0B, 0xE0, 0x00, 0x78, 0x00, 0x0F, 0xD0, 0x00, 0xB8, 0x00,
-    0x1F, 0xC0, 0x00, 0xF4, 0x00, 0x2F, 0xC0, 0x01, 0xF0, 0x00, 0x3F, 0xE0, 0x03, 0xE0, 0x00, 0x3F,
-    0xFE, 0x6F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFE, 0xFF, 0xFD, 0x00, 0x01, 0xF4, 0xBF,
-    0xF0, 0x00, 0x03, 0xF0, 0x05, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xD0,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x7F, 0xAA, 0xA9, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFE, 0xAF, 0xF8, 0x2F, 0x99, 0xFC, 0x00, 0x00, 0x2C, 0x00, 0xF8, 0x00, 0x00, 0x04,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x01, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x1A, 0xFE, 0xA4, 0x7F, 0xFF, 0xF4, 0x02, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F,
-    0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x54, 0x00, 0xBF, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0xBF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE, 0xFE, 0xAF, 0xF8,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xD2,
-    0xC0, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x3F,
-    0xC0, 0x00, 0x1F, 0xEA, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xFE, 0xAF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0D, 0x03, 0xC0, 0x00, 0xF9, 0xC0, 0x7C, 0x00, 0x0F,
-    0xB8, 0x0B, 0xC0, 0x02, 0xFF, 0x00, 0xF8, 0x00, 0x3F, 0x40, 0x0F, 0x40, 0x03, 0xE0, 0x01, 0xF0,
-    0x00, 0x7D, 0x00, 0x1F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x2F, 0x80,
-    0x03, 0xF0, 0x0B, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x01, 0xFF, 0xF7, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x7D, 0x00,
-    0xBD, 0x00, 0x69, 0x00, 0xE0, 0x3C, 0x0B, 0x41, 0xE0, 0x3C, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0xD0,
-    0x00, 0x7E, 0xE0, 0x03, 0x80, 0xF0, 0x28, 0x00, 0x70, 0x0F, 0x80, 0xA3, 0xDD, 0x0D, 0x74, 0xB2,
-    0xCB, 0x03, 0xF8, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x02, 0xFF, 0xFF, 0xC2, 0xFF, 0xFE, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0xFF, 0xD1, 0xFA, 0xAA, 0xAA, 0x50,
-    0x38, 0x00, 0x28, 0xF0, 0x01, 0xD3, 0xE5, 0x7E, 0x07, 0xFF, 0xE0, 0x07, 0xF9, 0x00, 0x00, 0x03,
-    0xE2, 0xF8, 0xFD, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x2F, 0x80, 0xBE, 0x3F, 0x80,
-    0xFD, 0x7F, 0x42, 0xFD, 0x2F, 0x81, 0x0E, 0x02, 0xD0, 0xF0, 0x08, 0x00, 0x07, 0xE0, 0x70, 0xC3,
-    0x43, 0x0E, 0xB8, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x0F, 0x81, 0xF8, 0x00, 0x0F, 0xC1, 0xFC, 0x00,
-    0x0F, 0xC1, 0xA4, 0x00, 0x0A, 0x40, 0x70, 0x00, 0xA0, 0xB4, 0x1E, 0x00, 0xFB, 0xD0, 0x00, 0xFC,
-    0x00, 0x02, 0xC0, 0x00, 0x3E, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x00,
-    0x3F, 0x00, 0x1A, 0x80, 0x00, 0x68, 0x55, 0x40, 0x3F, 0xC0, 0x2F, 0xD0, 0x0F, 0xE0, 0x07, 0xF0,
-    0x03, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x03, 0xFC, 0x07, 0xF4, 0x0B, 0xF0, 0x0F, 0xD0,
-    0x3F, 0xC0, 0x7F, 0x40, 0xBF, 0x80, 0x3F, 0xC0, 0x1F, 0xD0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xFC,
-    0x01, 0xFD, 0x00, 0xD0, 0x1C, 0x3F, 0xC1, 0x78, 0x03, 0x40, 0x00, 0xA0, 0x1C, 0x03, 0xF8, 0xF4,
-    0x2C, 0x00, 0x00, 0x2F, 0xAA, 0x50, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02,
-    0xE0, 0x00, 0x0B, 0x40, 0x01, 0x80, 0xB0, 0x34, 0x78, 0x38, 0x00, 0x00, 0x0A, 0x24, 0x30, 0x38,
-    0x00, 0x04, 0x00, 0xD0, 0x9D, 0x0B, 0xF8, 0x06, 0xC0, 0xA4, 0x07, 0xFC, 0x0E, 0x80, 0xD0, 0x04,
-    0x00, 0x02, 0x00, 0x30, 0x2F, 0x80, 0x90, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xA9, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xE3, 0xF9, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x0B, 0xD0, 0xFD, 0x03, 0xF0, 0x7F, 0x02, 0xFC, 0x3F, 0xC0, 0xFF, 0x00, 0x07, 0xE0, 0x70,
-    0xC3, 0x43, 0x0E, 0xB8, 0x0F, 0x80, 0x00, 0x55, 0x03, 0xFD, 0x03, 0xFC, 0x0B, 0xF4, 0x0F, 0xF0,
-    0x1F, 0xD0, 0x3F, 0xC0, 0xBF, 0x40, 0x02, 0x00, 0x20, 0x01, 0xE4, 0x00, 0x24, 0x00, 0x90, 0x5F,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x40, 0xB4, 0x07, 0x00, 0x38, 0x00, 0xBF, 0x00, 0x18, 0x00,
-    0x02, 0x80, 0x7C, 0x0B, 0x80, 0xF4, 0x1F, 0x03, 0xE0, 0x3D, 0x00, 0x1F, 0xFF, 0x8B, 0x96, 0xD3,
-    0x80, 0xB0, 0xD0, 0x28, 0x70, 0x00, 0x90, 0xB0, 0x2D, 0x00, 0xFB, 0xC0, 0x01, 0xFC, 0x00, 0x03,
-    0xC0, 0x00, 0x03, 0x80, 0x00, 0x1F, 0x80, 0x00, 0xFB, 0xC0, 0x0B, 0x42, 0xC0, 0x70, 0x01, 0xD0,
-    0x0F, 0x80, 0xA3, 0xDD, 0x0D, 0x74, 0xB2, 0xCB, 0x03, 0xF8, 0x00, 0x05, 0x00, 0x01, 0x55, 0x83,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x05, 0xAA, 0xF0, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0xA3, 0xDD, 0x0D, 0x74, 0xB2, 0xCB, 0x03, 0xF8, 0x00, 0x05, 0x00, 0x1A, 0xAA, 0xAA, 0x0F, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x70, 0x0C, 0x09, 0x1C, 0x00, 0x38, 0x07, 0x02, 0xC0, 0x74, 0x1E,
-    0x5B, 0x80, 0xFF, 0xFC, 0x0F, 0xFF, 0x86, 0x00, 0xD2, 0x40, 0x30, 0xC0, 0x1C, 0x30, 0x0A, 0x1F,
-    0xFF, 0x40, 0x00, 0x00, 0x0B, 0x85, 0x03, 0x0D, 0x52, 0x46, 0x24, 0xC2, 0x0C, 0x20, 0x83, 0x00,
-    0x0A, 0x20, 0x0F, 0x00, 0x34, 0x03, 0xB0, 0x30, 0xD0, 0x0F, 0x80, 0xA3, 0xDD, 0x0D, 0x74, 0xB2,
-    0xCB, 0x03, 0xF8, 0x00, 0x05, 0x00, 0x14, 0x0B, 0x80, 0x70, 0xB4, 0x10, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x2F, 0x80, 0xBE, 0x3F, 0x80, 0xFD, 0x7F, 0x42, 0xFD, 0x15, 0x55,
-    0x0F, 0xFF, 0xC7, 0x40, 0xE2, 0xC0, 0x34, 0x50, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF,
-    0xFD, 0x07, 0xFF, 0xFA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xAF, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xB8, 0x3C, 0x03, 0xD1,
-    0xF0, 0x1F, 0x0F, 0x80, 0xB8, 0x3D, 0x03, 0xD2, 0xF0, 0x1F, 0x06, 0x40, 0x68, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x3F, 0xFE, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x0F, 0x83, 0xA0, 0x3D, 0xDD,
-    0xD0, 0x74, 0xBA, 0xC0, 0xB0, 0x3F, 0x80, 0x50, 0x95, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00,
-    0xFC, 0x01, 0xFE, 0x5F, 0xD0, 0x02, 0xF4, 0x07, 0xF4, 0x02, 0xF4, 0x0B, 0xE0, 0x0F, 0xD0, 0x00,
-    0xBF, 0xFF, 0x80, 0x0F, 0x80, 0x00, 0x05, 0x54, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x38, 0x03, 0xF0, 0xB4, 0x0F, 0x40, 0xBC, 0x03, 0xE7, 0xE0, 0x06, 0x40, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x02, 0x40, 0x1F,
-    0x9F, 0x40, 0x7C, 0x03, 0xD0, 0x3D, 0x1F, 0x40, 0xBC, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x04, 0x18, 0x2D, 0x0C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0xC1, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x0E, 0x40, 0x00,
-    0x6F, 0x40, 0x00, 0x6B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x01, 0xE4, 0x00,
-    0x06, 0xF4, 0x01, 0x80, 0x00, 0x00, 0x02, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x3E, 0x07,
-    0xD0, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x03, 0xF0,
-    0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xF5,
-    0x55, 0x57, 0xF8, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x0F, 0x80, 0x0B,
-    0xC0, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x01, 0xFE, 0xAA, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xF8, 0x00, 0x1F, 0xD0, 0x07, 0xD0, 0x00, 0x0F, 0x80,
-    0x2F, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x0B, 0xE0, 0x1F, 0x40,
-    0x00, 0x7F, 0x40, 0xBC, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00,
-    0x1F, 0x8F, 0x80, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x01, 0xF8,
-    0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x2F, 0x80, 0x07,
-    0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x03, 0xF8, 0x00, 0x03, 0xF8,
-    0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x1F, 0xE5, 0x55, 0x57, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFA, 0xA4, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x55, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x01, 0xAA, 0xAA, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00,
-    0xFE, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFA, 0xAA,
-    0xAF, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-    0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56,
-    0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xD1, 0xBF, 0xFD, 0x0F, 0xC0, 0x0F, 0xC3, 0xFF, 0xA8,
-    0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80,
-    0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x3F,
-    0x40, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00,
-    0x3F, 0x40, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFD,
-    0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xFC, 0x00, 0x03,
-    0xF0, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x0F, 0xC1,
-    0xFD, 0x00, 0x00, 0x1F, 0xC7, 0xF4, 0x00, 0x00, 0x2F, 0x4F, 0xE0, 0x00, 0x00, 0x3F, 0x3F, 0x80,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0B,
-    0xF7, 0xFE, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x40, 0x00, 0x1F, 0xC1, 0xFF, 0xC0, 0x00, 0x2F, 0xC0,
-    0xFF, 0xE0, 0x00, 0x3F, 0x80, 0xBF, 0xF4, 0x00, 0x7F, 0x00, 0x3F, 0xFC, 0x00, 0xBF, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0x01, 0xFE, 0x03, 0xFC, 0x00,
-    0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0x2F,
-    0xC0, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x02, 0xFD, 0x00, 0xFF, 0x00, 0x01, 0xFD, 0x01, 0xFC, 0x00,
-    0x00, 0xFD, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x00,
-    0xFE, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x02, 0xFF,
-    0xC0, 0x02, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xEF,
-    0xF0, 0x02, 0xFF, 0xF4, 0x00, 0xBD, 0xFF, 0x40, 0x7F, 0x7F, 0x00, 0x0F, 0xCF, 0xF4, 0x0F, 0xEB,
-    0xF0, 0x00, 0xFC, 0xBF, 0x82, 0xFC, 0xFF, 0x00, 0x2F, 0xC7, 0xF8, 0x7F, 0x4F, 0xE0, 0x03, 0xF8,
-    0x7F, 0xCF, 0xE2, 0xFD, 0x00, 0x3F, 0x43, 0xFE, 0xFC, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xFF, 0x43,
-    0xFC, 0x00, 0xFF, 0x03, 0xFF, 0xF0, 0xBF, 0xC0, 0x0F, 0xF0, 0x3F, 0xFC, 0x0F, 0xF8, 0x01, 0xFE,
-    0x02, 0xFF, 0x80, 0xFF, 0x40, 0x3F, 0xD0, 0x2F, 0xF0, 0x2F, 0xF0, 0x03, 0xFC, 0x01, 0xFC, 0x03,
-    0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01,
-    0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xFD,
-    0x00, 0x0B, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x7F, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0xFE, 0x3F, 0x80, 0x7F,
-    0x00, 0x00, 0xFD, 0x2F, 0x80, 0xBF, 0x00, 0x02, 0xFC, 0x1F, 0xC0, 0xFD, 0x00, 0x03, 0xFC, 0x1F,
-    0xC1, 0xFC, 0x00, 0x07, 0xF8, 0x0F, 0xD2, 0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xE3, 0xF4, 0x00, 0x0F,
-    0xF0, 0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xF0, 0x07, 0xFB, 0xF0, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0xE0,
-    0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA,
-    0xAA, 0xAA, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00,
-    0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00,
-    0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F,
-    0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x80, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3D, 0x00, 0x07, 0x80, 0x03,
-    0xC0, 0x00, 0xB4, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x0B, 0x80, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x2E,
-    0x00, 0x0F, 0x00, 0x03, 0xD0, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x07, 0xC0, 0x03, 0xC0,
-    0x00, 0xB8, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x0B, 0x80, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0x1F, 0x00,
-    0x0F, 0x00, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x2E, 0x00, 0x03, 0xC0, 0x03, 0xD0, 0x00,
-    0x78, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xD5, 0x5F,
-    0xF0, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x02, 0xF0,
-    0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x1C,
-    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7F, 0xAA, 0xA9, 0x00, 0x2F,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE, 0xFE, 0xAF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF4, 0x00, 0x01, 0xF8, 0x2F, 0x80,
-    0x00, 0x7F, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0xFE, 0x00,
-    0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x90,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xAE, 0x07, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0x42, 0xD0, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x3C, 0x00, 0x3F, 0xD0, 0x00,
-    0x3F, 0xE0, 0x07, 0xC0, 0x02, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0xB4, 0x00, 0x2F, 0xD0, 0x00, 0xFF,
-    0x00, 0x0F, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x01, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00,
-    0x2D, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x40, 0x03, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x7C,
-    0x00, 0x3F, 0xD0, 0x00, 0xBF, 0xD0, 0x0B, 0x80, 0x2F, 0xF8, 0x00, 0x07, 0xFF, 0xEA, 0xFA, 0xBF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x7D, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xC0,
-    0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x1F,
-    0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x0B, 0x00, 0x3D, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x07, 0x80, 0x1D, 0x00, 0x78, 0x0B,
-    0x40, 0x2C, 0x00, 0xF4, 0x0F, 0x40, 0x3C, 0x01, 0xF0, 0x0F, 0x40, 0x38, 0x03, 0xE0, 0x0F, 0x40,
-    0x74, 0x0B, 0xC0, 0x0F, 0xC0, 0xF0, 0x2F, 0x80, 0x0F, 0xE0, 0xE0, 0xFF, 0x00, 0x07, 0xFE, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0x74, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xE0, 0x00,
-    0x1F, 0x80, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40,
-    0x0F, 0x80, 0x00, 0x01, 0xF4, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0,
-    0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x3D, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0x00, 0x0B, 0xF4,
-    0x00, 0x1B, 0xFE, 0x02, 0xFE, 0x90, 0x07, 0xFF, 0xD0, 0x3F, 0xFF, 0x00, 0xBF, 0xFC, 0x07, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x2C,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0xF8, 0x00,
-    0x03, 0xD0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x0F,
-    0x00, 0x03, 0xF0, 0x00, 0x1E, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xDA, 0x00, 0x0F, 0xFF, 0xF7, 0xEF, 0xBC, 0x02, 0xFF, 0x87,
-    0xEF, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBE, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0x96, 0xF4, 0x00, 0x0B, 0xD0, 0x07, 0xC0,
-    0x00, 0xF4, 0x00, 0x2C, 0x00, 0x1F, 0x00, 0x03, 0xC0, 0x02, 0xF0, 0x00, 0x78, 0x00, 0x3E, 0x00,
-    0x2F, 0x00, 0x03, 0xD0, 0xFF, 0x40, 0x00, 0x7C, 0x1F, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00,
-    0xF4, 0x00, 0x0F, 0x40, 0x1F, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x3F, 0xD0, 0x03,
-    0xF4, 0x03, 0xFF, 0xD1, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x0B, 0xEF, 0xFF, 0xFC, 0x00, 0xF8,
-    0x2F, 0xFF, 0x40, 0x0F, 0x40, 0x2F, 0x80, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x0B, 0x8F, 0x40, 0x03, 0xE3, 0xE0, 0x00, 0xF8, 0xBC, 0x00, 0x3D, 0x2F, 0x00, 0x2F, 0x07, 0xD0,
-    0x0F, 0x80, 0xF8, 0x07, 0xC0, 0x3F, 0x03, 0xF0, 0x0F, 0xC2, 0xF4, 0x02, 0xF6, 0xF8, 0x00, 0xBF,
-    0xFC, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFA, 0x40, 0x03, 0xFF, 0xFF, 0xE0, 0x01,
-    0xF4, 0x01, 0xA4, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xBF, 0xF4,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xF8, 0x0B, 0xD0, 0x07, 0xF4, 0x00, 0xFC, 0x03, 0xF4, 0x00,
-    0x3F, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x07, 0xE0, 0x1F, 0xC0, 0x07, 0xF0, 0x07, 0xF9,
-    0x5B, 0xF8, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x07, 0x91, 0xC0, 0x34, 0x03, 0x01, 0xC0, 0x00, 0x03, 0x40, 0x00, 0x07, 0xF0,
-    0x00, 0xBD, 0x40, 0x0B, 0x80, 0x00, 0x3C, 0x03, 0xC0, 0xF0, 0x0F, 0x03, 0xE5, 0xF8, 0x0B, 0xFF,
-    0xC0, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0A, 0xAF, 0xF8, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x02, 0xFC, 0x1B, 0x90, 0x00, 0x7E, 0xFF, 0xF4, 0x00, 0xBF, 0x40, 0xBC, 0x00, 0xFC, 0x00, 0x3C,
-    0x01, 0xF0, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xF4,
-    0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0xC0, 0x01, 0xF0, 0x1F, 0x80, 0x03, 0xF0, 0x2F, 0x40, 0x03, 0xE0,
-    0x3F, 0x40, 0x07, 0xD0, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0xF4, 0x1E, 0x00, 0x00, 0xF4, 0x02,
-    0xC0, 0x00, 0xF4, 0x00, 0x74, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x3D, 0x00, 0x07, 0x80, 0x1F, 0x00,
-    0x02, 0xE0, 0x0F, 0x80, 0x00, 0xB4, 0x03, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xBC,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xF4, 0x03, 0xF8, 0x00,
-    0xFF, 0xAB, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xB4, 0x00,
-    0xF0, 0x01, 0xE0, 0x02, 0xD0, 0x03, 0xD0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0x80, 0x1F, 0x80, 0x2F,
-    0x40, 0x3F, 0x50, 0xBF, 0xF0, 0xBF, 0xE0, 0x00, 0x18, 0x02, 0x80, 0x03, 0xC0, 0xF4, 0x00, 0x78,
-    0x3D, 0x00, 0x0F, 0x4F, 0x80, 0x00, 0xF2, 0xE0, 0x00, 0x1E, 0xBC, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xBF, 0x00, 0x02, 0xF3, 0xFC,
-    0x00, 0x3D, 0x1F, 0xE0, 0x07, 0xC0, 0xFF, 0x00, 0xBC, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x90, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x6F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0xF8, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00,
-    0x3F, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x00, 0x2F, 0x00,
-    0x2F, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x00, 0xF8,
-    0x00, 0x0F, 0x00, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xE0,
-    0x00, 0xFC, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x2F, 0x00,
-    0x1F, 0xC0, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0xBE, 0x00, 0x3F, 0xC0, 0x2F, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x1D, 0xFF, 0xFF, 0xFC, 0x02, 0xC7, 0xFF, 0xDF, 0x80, 0x38,
-    0x05, 0x40, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0B,
-    0x8F, 0x40, 0x03, 0xF3, 0xE0, 0x00, 0xF8, 0xBC, 0x00, 0x3D, 0x2F, 0x00, 0x2F, 0x07, 0xD0, 0x0F,
-    0x80, 0xF8, 0x07, 0xD0, 0x3F, 0x03, 0xF0, 0x0F, 0xC2, 0xF4, 0x02, 0xF6, 0xF8, 0x00, 0xBF, 0xFC,
-    0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x6A,
-    0xFF, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x03, 0xF9, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x03, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xA4, 0x00, 0x00,
-    0x00, 0x02, 0xBF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0B, 0xF5, 0x5F, 0xC0, 0x07, 0xD0, 0x01,
-    0xF0, 0x03, 0xE0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x07, 0xC0, 0x3D, 0x00,
-    0x03, 0xF0, 0x1F, 0x00, 0x01, 0xF4, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0x80, 0x7C, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x01, 0xF0, 0x0F,
-    0x00, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x0F, 0x80,
-    0xB8, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0xF8, 0x0B, 0xFC, 0x00, 0x3C,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xA7, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0xF0, 0x00, 0x02, 0xF4, 0x00,
-    0xF4, 0x00, 0x07, 0xE0, 0x00, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0xF0, 0x00, 0x0F, 0xC0, 0x02, 0xF0,
-    0x00, 0x2F, 0xC0, 0x03, 0xE0, 0x00, 0x3F, 0xC0, 0x0B, 0xC0, 0x00, 0xBF, 0xF9, 0xBF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFA, 0xFF, 0xFC, 0x00, 0x03, 0xF0, 0xBF, 0xE0, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xE0, 0x03, 0xFA, 0xBC, 0x0B, 0x80, 0x1D, 0x0F, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xE0, 0x00,
-    0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x00,
-    0x02, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xF5, 0x5F, 0xC0, 0x00,
-    0x00, 0x7D, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x2C, 0x0B, 0x00, 0x1D, 0x0F, 0x00, 0x0E, 0x0F, 0x00, 0x0E,
-    0x1E, 0x00, 0x1E, 0x1D, 0x00, 0x1D, 0x2D, 0x00, 0x2D, 0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x7C, 0x3D,
-    0x01, 0xF8, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x0B, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0xF6, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0xE0, 0x3F, 0xC0, 0x00, 0x7F, 0xC1, 0xD0, 0x1F, 0xD0,
-    0x00, 0xFF, 0x02, 0xC0, 0x0F, 0xE0, 0x02, 0xFC, 0x03, 0xC0, 0x0F, 0xE0, 0x03, 0xF4, 0x03, 0xC0,
-    0x0B, 0xE0, 0x07, 0xF0, 0x03, 0x80, 0x0B, 0xD0, 0x0F, 0xD0, 0x07, 0x40, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x0B, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x0F, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x0E, 0x00, 0x3F, 0x40,
-    0x2F, 0x80, 0x1D, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x2C, 0x02, 0xFD, 0x00, 0x2F, 0xF9, 0x3C, 0x6F,
-    0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x0A, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0x80, 0x01, 0xFF, 0xC0,
-    0x0B, 0xC0, 0x00, 0x07, 0xFC, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xD7,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0x40,
-    0x00, 0x03, 0xF8, 0x0B, 0xF9, 0x40, 0x03, 0xFC, 0x01, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0xF8,
-    0x03, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x38, 0x00, 0x07, 0x43, 0x81, 0x80, 0xB4, 0x74, 0x1D, 0x0F, 0x0B, 0x01, 0xD0, 0xF0,
-    0xF0, 0x1D, 0x0E, 0x0F, 0x01, 0xD1, 0xE0, 0xE0, 0x2D, 0x2D, 0x1D, 0x03, 0xC3, 0xD2, 0xC0, 0x3C,
-    0x3D, 0x2C, 0x0B, 0x83, 0xE3, 0xC2, 0xF4, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0x0B,
-    0xC0, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x03, 0xC0, 0x7D, 0x00, 0x00, 0x3C, 0x0F, 0x80, 0x00, 0x03,
-    0xC2, 0xF0, 0x05, 0x00, 0x3C, 0x3E, 0x00, 0xD0, 0x07, 0xC7, 0xC0, 0x1C, 0x00, 0xF4, 0x7C, 0x02,
-    0xC0, 0x1F, 0x07, 0xC0, 0x3C, 0x07, 0xE0, 0x7E, 0x5F, 0xFB, 0xFC, 0x03, 0xFF, 0xDF, 0xFF, 0x00,
-    0x0B, 0xE0, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x3E, 0x07,
-    0xD0, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x03, 0xF0,
-    0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xF5,
-    0x55, 0x57, 0xF8, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x2C, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0xF8, 0x03, 0xD0,
-    0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF4, 0x0F, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x03, 0xF0, 0x1E, 0x00,
-    0x0B, 0xF0, 0x2F, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xF7, 0xC0, 0x02, 0xFF, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x90, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x07, 0xD1, 0xF4,
-    0x00, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x1F, 0x80, 0x00, 0x01, 0xF4, 0x03, 0xE0,
-    0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xF5, 0x55, 0x57, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x03,
-    0xF8, 0x00, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x14, 0x34, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x2C, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x7F, 0x47, 0xFC, 0x00, 0xF4, 0x00, 0xF8, 0x03, 0xD0, 0x00, 0xF8, 0x07, 0xC0,
-    0x00, 0xF4, 0x0F, 0x40, 0x01, 0xF0, 0x0F, 0x00, 0x03, 0xF0, 0x1E, 0x00, 0x0B, 0xF0, 0x2F, 0x00,
-    0x3F, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xF7, 0xC0, 0x02, 0xFF,
-    0x87, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x55, 0x55, 0x7F,
-    0x80, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE2, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x80, 0x00,
-    0x00, 0x00, 0xF0, 0x2C, 0x00, 0x00, 0x00, 0xA0, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00,
-    0x07, 0xD1, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x1F, 0x80, 0x00, 0x01,
-    0xF4, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x7E,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xF5, 0x55, 0x57, 0xF8, 0x07, 0xF0, 0x00,
-    0x00, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0x9F, 0x40, 0x00, 0x07, 0x80, 0xB4, 0x00,
-    0x02, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0xC0, 0x00, 0x7F, 0xFF, 0xF0,
-    0x00, 0x7E, 0x02, 0xFC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x1F, 0x00, 0x03,
-    0xD0, 0x0F, 0x00, 0x01, 0xF0, 0x03, 0xC0, 0x00, 0xFC, 0x01, 0xE0, 0x00, 0xBF, 0x00, 0xBC, 0x00,
-    0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x7C, 0x00, 0x0B,
-    0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFA, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x3E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF,
-    0x55, 0x55, 0x7F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x38, 0x00, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0xB0, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0x1F, 0x80, 0xBF, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x40, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0xF4,
-    0x03, 0xC0, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x78, 0x00, 0x2F, 0xC0, 0x2F, 0x00, 0x3F,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xDF, 0x00, 0x02, 0xFF,
-    0x87, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xC0, 0x00, 0x00,
-    0x2C, 0xB0, 0xE0, 0x00, 0x00, 0x0D, 0x0E, 0xB0, 0x00, 0x00, 0x07, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0x47,
-    0xD0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x7E, 0x00, 0x00, 0x07, 0xD0, 0x0F,
-    0x80, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xD5, 0x55, 0x5F, 0xE0, 0x1F, 0xC0, 0x00, 0x03, 0xF8,
-    0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xD0, 0x34, 0x00,
-    0x0E, 0xB0, 0x70, 0x00, 0x2C, 0x38, 0xE0, 0x00, 0x38, 0x1F, 0xC0, 0x00, 0x10, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00,
-    0x2D, 0x0B, 0x40, 0x00, 0x74, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x2C, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0xF8, 0x03, 0xD0, 0x00, 0xF8, 0x07,
-    0xC0, 0x00, 0xF4, 0x0F, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x03, 0xF0, 0x1E, 0x00, 0x0B, 0xF0, 0x2F,
-    0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xF7, 0xC0, 0x02,
-    0xFF, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x07, 0xEE, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xB0, 0x00, 0x00, 0x02, 0x80, 0x07, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x00, 0x2F,
-    0x2F, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x0B, 0xC0,
-    0x7E, 0x00, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00,
-    0xFC, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xD5, 0x55, 0x5F,
-    0xE0, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x0B, 0x42, 0xD0, 0x00, 0x1C, 0x00, 0x28, 0x00,
-    0x02, 0xFE, 0x2C, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0xF8, 0x03,
-    0xD0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF4, 0x0F, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x03, 0xF0, 0x1E,
-    0x00, 0x0B, 0xF0, 0x2F, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xF7, 0xC0, 0x02, 0xFF, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x05, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xD0,
-    0x00, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x01, 0xF4,
-    0x7D, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x7E, 0x00, 0x00, 0x01, 0xF4,
-    0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x01, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x55, 0x57, 0xF8, 0x01, 0xFC,
-    0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x01, 0xC0, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0x2F,
-    0x56, 0xF0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x8B, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-    0x01, 0xF8, 0x0B, 0xF0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x0F,
-    0x40, 0x3C, 0x00, 0x07, 0xC0, 0x0F, 0x00, 0x03, 0xF0, 0x07, 0x80, 0x02, 0xFC, 0x02, 0xF0, 0x03,
-    0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0xF0, 0x00, 0x2F,
-    0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xCB,
-    0xC0, 0x00, 0x00, 0x01, 0xF4, 0x7D, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0,
-    0x7E, 0x00, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0,
-    0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xF5,
-    0x55, 0x57, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x0B, 0xF0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2C, 0x00, 0x1C, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x02, 0xF5, 0x6F, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0xB0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0x80, 0xBF,
-    0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x40, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0xF4, 0x03, 0xC0, 0x00,
-    0x7C, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x78, 0x00, 0x2F, 0xC0, 0x2F, 0x00, 0x3F, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xDF, 0x00, 0x02, 0xFF, 0x87, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x04, 0x38, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x50, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x00, 0x0B,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00,
-    0x00, 0xBC, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x00,
-    0x00, 0xBC, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-    0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0x55, 0x55, 0x7F, 0x80, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0xC0, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x01, 0x80, 0xB4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x05, 0x00, 0x03,
-    0x80, 0x03, 0x40, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xB0, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x1F, 0x80, 0xBF, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x40, 0x03, 0xE0, 0x07, 0xC0, 0x00,
-    0xF4, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x78, 0x00, 0x2F, 0xC0, 0x2F, 0x00,
-    0x3F, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xDF, 0x00, 0x02,
-    0xFF, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xA0, 0x00, 0x00, 0x03, 0xDE, 0x0D, 0x00,
-    0x00, 0x00, 0x74, 0x7B, 0xC0, 0x00, 0x00, 0x0B, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x00, 0x0B,
-    0xCB, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x7D, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0x0B,
-    0xC0, 0x7E, 0x00, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xC0, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B,
-    0xF5, 0x55, 0x57, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x0B,
-    0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x41, 0xC0, 0x00, 0x2C,
-    0x70, 0xE0, 0x00, 0x0D, 0x0F, 0xF0, 0x00, 0x03, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0x03, 0x80,
-    0x00, 0xBD, 0x5B, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x2C, 0x00, 0x07, 0xFF,
-    0xFF, 0x00, 0x07, 0xE0, 0x2F, 0xC0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x00, 0xF8, 0x01, 0xF0,
-    0x00, 0x3D, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x1E, 0x00, 0x0B, 0xF0, 0x0B,
-    0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xF7, 0xC0,
-    0x00, 0xBF, 0xE1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x50, 0x00, 0x00, 0x0E, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x00, 0x1F,
-    0x47, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x00, 0x1F,
-    0x40, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x80, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x55, 0x55, 0x7F, 0x80, 0x1F,
-    0xC0, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x07,
-    0x00, 0x03, 0xC0, 0x03, 0x80, 0x00, 0xBD, 0x5B, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x2C, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xE0, 0x2F, 0xC0, 0x03, 0xD0, 0x03, 0xE0, 0x03,
-    0xD0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x0F, 0xC0,
-    0x1E, 0x00, 0x0B, 0xF0, 0x0B, 0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xF7, 0xC0, 0x00, 0xBF, 0xE1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFA, 0xA4, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x55, 0x55, 0x40, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x3F, 0x40, 0x38, 0x00, 0xB8, 0x00, 0x2C, 0x02, 0xE0, 0x00,
-    0x7C, 0x03, 0xEA, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0x95, 0x40, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xD0, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x43, 0x80, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFA, 0xA4, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x55, 0x55, 0x40,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x3F, 0x40, 0x38, 0x00, 0xB8, 0x00, 0x2C, 0x02, 0xE0, 0x00, 0x7C,
-    0x03, 0xEA, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0x95, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xD0, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x28, 0x00, 0x00, 0x3D,
-    0xD0, 0xD0, 0x00, 0x01, 0xD2, 0xCB, 0x00, 0x00, 0x0B, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0xA9, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x95, 0x55, 0x50, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x2E, 0x02, 0xC0, 0x00, 0x2D, 0xD0, 0xE0, 0x00, 0x0D, 0x1C, 0x70, 0x00,
-    0x0B, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xBF,
-    0x00, 0x00, 0xFD, 0x00, 0xE0, 0x00, 0xB8, 0x00, 0x2C, 0x00, 0xB8, 0x00, 0x1F, 0x00, 0x3E, 0xAF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0x95, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xD0, 0x02, 0xFF, 0xFF, 0xF0, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xBD, 0x00, 0x00, 0x00, 0x74, 0x1E, 0x00, 0x00, 0x03, 0x40, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0xA9, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x95, 0x55,
-    0x50, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x74, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x3F, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x38, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x0F, 0xAB, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03,
-    0xE5, 0x50, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x55, 0xB4, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x00, 0x1D, 0x07, 0x80, 0x00, 0x00, 0xD0,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xAA, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xE5, 0x55, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0x07, 0x81, 0xE0, 0x00, 0x03, 0x40, 0x06,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFB,
-    0xF0, 0x00, 0x0F, 0xD0, 0x0E, 0x00, 0x0B, 0x80, 0x02, 0xC0, 0x0B, 0x80, 0x01, 0xF0, 0x03, 0xEA,
-    0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0x54, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x95, 0x6D, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x00, 0x00,
-    0x00, 0x41, 0xC0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xBD, 0x00, 0x00, 0x00, 0x74, 0x1E, 0x00, 0x00, 0x03, 0x40, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0xA9,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x95,
-    0x55, 0x50, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x01, 0x0A, 0x00,
-    0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x02, 0xD0, 0xB4, 0x00, 0x00,
-    0x70, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x3F,
-    0x40, 0x38, 0x00, 0x0B, 0x80, 0x02, 0xC0, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0x3E, 0xAF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xF9, 0x54, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x95, 0x6D, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0xD0, 0x00, 0x00,
-    0xF7, 0x03, 0x00, 0x00, 0x0B, 0x0A, 0x2C, 0x00, 0x00, 0x3C, 0x0F, 0xD0, 0x00, 0x00, 0x40, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x01, 0xE0, 0xB4, 0x00, 0x00, 0x0D, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xFA, 0xA4, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x80, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xBE, 0x55, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x0A, 0x00,
-    0x03, 0xDD, 0x0D, 0x00, 0x07, 0x0B, 0x2C, 0x00, 0x0B, 0x03, 0xF4, 0x00, 0x04, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x07, 0x81, 0xE0, 0x00, 0x0E, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x3F, 0x40, 0x38, 0x00,
-    0xB8, 0x00, 0x2C, 0x02, 0xE0, 0x00, 0x7C, 0x03, 0xEA, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F,
-    0x95, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF9, 0x56, 0xD0, 0x0B, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xF9, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x00, 0x07,
-    0x41, 0xE0, 0x00, 0x00, 0x34, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xEA, 0x90, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x55, 0x55, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x0B, 0x42, 0xD0, 0x00,
-    0x00, 0x70, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00,
-    0x00, 0x0F, 0xD0, 0x0E, 0x00, 0x00, 0xB8, 0x00, 0x2C, 0x00, 0x0B, 0x80, 0x01, 0xF0, 0x00, 0x3E,
-    0xAF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x95, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x10, 0xA0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0,
-    0x00, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x50, 0xC0, 0x00, 0x0F,
-    0x00, 0x01, 0xE0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x3C,
-    0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3F,
-    0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x02,
-    0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xE0,
-    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00,
-    0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x2F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x01,
-    0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00,
-    0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F,
-    0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00,
-    0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F,
-    0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55,
-    0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xBF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0B, 0xF5, 0x5F, 0xC0, 0x07, 0xD0,
-    0x01, 0xF0, 0x03, 0xE0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x07, 0xC0, 0x3D,
-    0x00, 0x03, 0xF0, 0x1F, 0x00, 0x01, 0xF4, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0xFF, 0xEF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE,
-    0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80,
-    0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03,
-    0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00,
-    0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F,
-    0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x43, 0x40, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xF0,
-    0x00, 0x2F, 0xD5, 0x7F, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x0F, 0x80, 0x00, 0xF4, 0x07, 0xC0, 0x00,
-    0x3D, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x07, 0xD0, 0x1F, 0x80,
-    0x07, 0xF0, 0x03, 0xFF, 0xBF, 0xF4, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x2C, 0x00, 0x07,
-    0xFF, 0x56, 0xFF, 0x80, 0x2D, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xF0, 0x1E, 0x00, 0x07, 0xF8, 0x00,
-    0x01, 0xFD, 0x0F, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x8F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x55, 0x6F,
-    0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xC0, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xF0, 0x00, 0x00,
-    0x78, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x55, 0xFC, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xD0,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00,
-    0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00,
-    0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F,
-    0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x07, 0x82, 0xD0, 0x00, 0x03, 0x40, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0B, 0xF5, 0x5F,
-    0xC0, 0x07, 0xD0, 0x01, 0xF0, 0x03, 0xE0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0xF8, 0x00,
-    0x07, 0xC0, 0x3D, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x01, 0xF4, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0xFF,
-    0xEF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xD5, 0xBF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xD5, 0x5B,
-    0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x0F, 0xBC, 0x00, 0x00, 0x03, 0xC0, 0xB0, 0x00, 0x00, 0xA0, 0x01, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xBF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x55, 0xFC, 0x00, 0x1F, 0x40, 0x07,
-    0xC0, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0xF4,
-    0x00, 0x0F, 0xC0, 0x1F, 0x00, 0x01, 0xF4, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xFE, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x1C, 0x00, 0x00, 0x00, 0x0B, 0x2C, 0x38, 0x00,
-    0x00, 0x00, 0x0D, 0x0E, 0xB0, 0x00, 0x00, 0x00, 0x1C, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0x28, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F,
-    0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0,
-    0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00,
-    0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80,
-    0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00,
-    0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x03, 0x40, 0x00, 0x78, 0xD1, 0xC0, 0x00, 0x2C, 0x2E,
-    0xE0, 0x00, 0x0E, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x78, 0x2D, 0x00, 0x00,
-    0x34, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x2F, 0xD5, 0x7F, 0x00, 0x1F, 0x40, 0x07,
-    0xC0, 0x0F, 0x80, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0xF4, 0x00,
-    0x0F, 0xC0, 0x7C, 0x00, 0x07, 0xD0, 0x1F, 0x80, 0x07, 0xF0, 0x03, 0xFF, 0xBF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x80, 0x00, 0x00, 0x00,
-    0x03, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56,
-    0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00,
-    0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80,
-    0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0x82, 0xD0, 0x00,
-    0x03, 0x40, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xBF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0B, 0xF5, 0x5F, 0xC0, 0x07, 0xD0, 0x01,
-    0xF0, 0x03, 0xE0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x07, 0xC0, 0x3D, 0x00,
-    0x03, 0xF0, 0x1F, 0x00, 0x01, 0xF4, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x03,
-    0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x74, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x1F, 0x00,
-    0x01, 0xFF, 0x40, 0x03, 0xFC, 0x0F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0xA0, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xD5, 0x5B, 0xFF, 0xC0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x40, 0x00, 0xAF, 0xE0, 0x0D, 0x00, 0x1F, 0xFF, 0xF0, 0xB0, 0x02, 0xFD, 0x57, 0xFB,
-    0x40, 0x1F, 0x40, 0x07, 0xF4, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x3E,
-    0x00, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x7D, 0x00, 0x1F, 0x80, 0x07,
-    0xF0, 0x00, 0x3F, 0xFB, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x74,
-    0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x1F, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFC, 0x0F, 0xC0, 0x00,
-    0x7F, 0x80, 0x00, 0x1F, 0xD0, 0xA0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x02, 0xFF, 0xD5, 0x5B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x24, 0x00, 0x0A, 0xFE, 0x00, 0xD0, 0x01, 0xFF, 0xFF, 0x0B, 0x00, 0x2F, 0xD5, 0x7F, 0xB4, 0x01,
-    0xF4, 0x00, 0x7F, 0x40, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x03, 0xE0, 0x00,
-    0x1F, 0x00, 0x0F, 0x40, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x01, 0xF8, 0x00, 0x7F, 0x00,
-    0x03, 0xFF, 0xBF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x0B,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x41, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x07, 0x40, 0x00, 0x7F, 0xF5, 0x6F, 0xF8, 0x01, 0xF0, 0x00, 0x1F,
-    0xF4, 0x00, 0x3F, 0xC0, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFD, 0x0A, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x04, 0x34, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0xAF, 0xE0, 0x0D, 0x00, 0x1F, 0xFF, 0xF0, 0xB0, 0x02, 0xFD, 0x57, 0xFB, 0x40,
-    0x1F, 0x40, 0x07, 0xF4, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x3E, 0x00,
-    0x01, 0xF0, 0x00, 0xF4, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x7D, 0x00, 0x1F, 0x80, 0x07, 0xF0,
-    0x00, 0x3F, 0xFB, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0xB0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC3, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x74, 0x00,
-    0x07, 0xFF, 0x56, 0xFF, 0x80, 0x1F, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFC, 0x0F, 0xC0, 0x00, 0x7F,
-    0x80, 0x00, 0x1F, 0xD0, 0xA0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0xD5, 0x5B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0E, 0x00, 0x00,
-    0x0E, 0x34, 0x34, 0x00, 0x00, 0xB0, 0x7B, 0xC0, 0x00, 0x03, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x2B, 0xF8, 0x03, 0x40, 0x07, 0xFF, 0xFC, 0x2C, 0x00, 0xBF,
-    0x55, 0xFE, 0xD0, 0x07, 0xD0, 0x01, 0xFD, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0x0F,
-    0x40, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x07,
-    0xE0, 0x01, 0xFC, 0x00, 0x0F, 0xFE, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0xD0, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xE0, 0x00, 0x74, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x1F, 0x00, 0x01, 0xFF, 0x40,
-    0x03, 0xFC, 0x0F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0xA0, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xD5, 0x5B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0A, 0xFE, 0x00, 0xD0, 0x01, 0xFF, 0xFF, 0x0B, 0x00, 0x2F,
-    0xD5, 0x7F, 0xB4, 0x01, 0xF4, 0x00, 0x7F, 0x40, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x03,
-    0xD0, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x01,
-    0xF8, 0x00, 0x7F, 0x00, 0x03, 0xFF, 0xBF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x01, 0x50, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xD0, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xBF,
-    0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x00,
-    0x7F, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0xBE, 0x00,
-    0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x7F,
-    0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x00,
-    0x3F, 0xFE, 0xAF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x1F, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x2F,
-    0x03, 0xE0, 0x00, 0xFC, 0x0F, 0x40, 0x03, 0xE0, 0x7C, 0x00, 0x1F, 0x41, 0xF0, 0x00, 0xBC, 0x0B,
-    0xC0, 0x03, 0xF0, 0x3E, 0x00, 0x2F, 0x80, 0xFC, 0x02, 0xFE, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFD, 0xF8, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0x40, 0x01, 0xFE,
-    0x00, 0x00, 0xFF, 0x40, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00,
-    0xFE, 0x00, 0x00, 0x7F, 0x40, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00,
-    0x07, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0,
-    0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFA, 0xBF, 0xFC, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x01, 0x43, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x03, 0xE0, 0x7C, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0xBC, 0x0F, 0x80, 0x03, 0xF0, 0x3D, 0x00, 0x0F,
-    0x81, 0xF0, 0x00, 0x7D, 0x07, 0xC0, 0x02, 0xF0, 0x2F, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0xBE, 0x03,
-    0xF0, 0x0B, 0xF8, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xFF,
-    0xF7, 0xE0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x4B,
-    0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x7C, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0xFF,
-    0x00, 0x00, 0x7F, 0xA8, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0xFA, 0xBF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x3C, 0x00, 0x0F, 0x9C, 0x07, 0xC0, 0x00, 0xFB, 0x80,
-    0xBC, 0x00, 0x2F, 0xF0, 0x0F, 0x80, 0x03, 0xF4, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x07,
-    0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x02, 0xF8, 0x00, 0x3F,
-    0x00, 0xBF, 0x80, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0x1F, 0xFF, 0x7E, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF4, 0xB0, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC7, 0xC0, 0x03, 0xFC,
-    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFA, 0x80, 0x00, 0x7F, 0x40, 0x00, 0x2F,
-    0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xAB, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0D, 0x03, 0xC0, 0x00, 0xF9, 0xC0, 0x7C, 0x00,
-    0x0F, 0xB8, 0x0B, 0xC0, 0x02, 0xFF, 0x00, 0xF8, 0x00, 0x3F, 0x40, 0x0F, 0x40, 0x03, 0xE0, 0x01,
-    0xF0, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x2F,
-    0x80, 0x03, 0xF0, 0x0B, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xF7, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x4B, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x7C, 0x00, 0x3F,
-    0xC0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xA8, 0x00, 0x07, 0xF4, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0xFA, 0xBF,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x05, 0x0D, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x3C, 0x00,
-    0x0F, 0x9C, 0x07, 0xC0, 0x00, 0xFB, 0x80, 0xBC, 0x00, 0x2F, 0xF0, 0x0F, 0x80, 0x03, 0xF4, 0x00,
-    0xF4, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0F,
-    0xC0, 0x03, 0xE0, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0xBF, 0x80, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x7E, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1C, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x74, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x7F,
-    0x80, 0x00, 0x2F, 0xD2, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x0F, 0xF0, 0x00, 0x03,
-    0xFF, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xEA, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xFE, 0xAF, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x03, 0x40, 0x00, 0x1D, 0x38, 0xB0,
-    0x00, 0x03, 0xC1, 0xFD, 0x00, 0x00, 0x28, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0D, 0x03, 0xC0, 0x00, 0xF9, 0xC0, 0x7C, 0x00, 0x0F, 0xB8,
-    0x0B, 0xC0, 0x02, 0xFF, 0x00, 0xF8, 0x00, 0x3F, 0x40, 0x0F, 0x40, 0x03, 0xE0, 0x01, 0xF0, 0x00,
-    0x7D, 0x00, 0x1F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x2F, 0x80, 0x03,
-    0xF0, 0x0B, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x01, 0xFF, 0xF7, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xD2, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x1F, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xEA, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xFE,
-    0xAF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0D, 0x03, 0xC0, 0x00, 0xF9, 0xC0, 0x7C, 0x00, 0x0F,
-    0xB8, 0x0B, 0xC0, 0x02, 0xFF, 0x00, 0xF8, 0x00, 0x3F, 0x40, 0x0F, 0x40, 0x03, 0xE0, 0x01, 0xF0,
-    0x00, 0x7D, 0x00, 0x1F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x2F, 0x80,
-    0x03, 0xF0, 0x0B, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x01, 0xFF, 0xF7, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD3,
-    0xF4, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x03,
-    0xF4, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x07,
-    0xF5, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x0B,
-    0xC0, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x07,
-    0xD0, 0x00, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0x07, 0xE2, 0xF4, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x3F,
-    0x40, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x7F,
-    0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0xBF,
-    0x07, 0xF0, 0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00, 0xBC, 0x00,
-    0x07, 0xD0, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0x00, 0xBD,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0xBD, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFC, 0x07, 0xFF, 0xD0, 0x07, 0xE0, 0x2F, 0xF4, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x01, 0x03, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF4, 0x00, 0x01, 0xF8,
-    0x2F, 0x80, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0xFD, 0x00,
-    0xFE, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x01, 0x0B, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0xBC, 0x00,
-    0x3E, 0x00, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x03, 0xE0,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x00, 0x7E, 0x2F, 0x40,
-    0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x0D, 0x00, 0x00, 0x3A, 0xC1, 0xC0, 0x00, 0x0B, 0x0E, 0x3C, 0x00, 0x00, 0xE0, 0x7F, 0x00,
-    0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x40, 0x00, 0x1F, 0x82,
-    0xF8, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x0F,
-    0xE0, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x70, 0x00, 0x00, 0x7A, 0xC2, 0xC0, 0x00,
-    0x03, 0x83, 0x4D, 0x00, 0x00, 0x1D, 0x0B, 0xF0, 0x00, 0x00, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x2F,
-    0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x1F,
-    0x40, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xF0, 0x1A, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x1A, 0xAA, 0xAA,
-    0xAA, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x05, 0x55, 0x55, 0x40,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x55, 0x55, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x50, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x02, 0xC0, 0x00, 0x38, 0x00, 0xF0, 0x00,
-    0x1D, 0x00, 0x74, 0x00, 0x0F, 0x00, 0x2C, 0x00, 0x03, 0x80, 0x0F, 0x00, 0x01, 0xD0, 0x03, 0x80,
-    0x00, 0xB0, 0x01, 0xD0, 0x00, 0x3C, 0x00, 0xB0, 0x00, 0x1D, 0x00, 0x38, 0x00, 0x0B, 0x00, 0x1D,
-    0x00, 0x03, 0xC0, 0x0B, 0x00, 0x00, 0xE0, 0x03, 0xC0, 0x00, 0x74, 0x00, 0xE0, 0x00, 0x3C, 0x00,
-    0xB0, 0x00, 0x0E, 0x00, 0x3C, 0x00, 0x07, 0x40, 0x0E, 0x00, 0x02, 0xC0, 0x07, 0x40, 0x00, 0xF0,
-    0x02, 0xC0, 0x00, 0x74, 0x00, 0xE0, 0x00, 0x2C, 0x00, 0x74, 0x00, 0x0F, 0x00, 0x2C, 0x00, 0x00,
-    0x02, 0xAA, 0xAA, 0xAA, 0xAA, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xAA, 0xAA, 0xA9, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0x1F, 0xD0,
-    0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x0B, 0xF4,
-    0x0F, 0xF0, 0x1F, 0xC0, 0x3F, 0x80, 0xBF, 0x00, 0x00, 0x55, 0x03, 0xFD, 0x03, 0xFC, 0x0B, 0xF4,
-    0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0xBF, 0x40, 0xBF, 0x80, 0x3F, 0xC0, 0x1F, 0xD0, 0x0F, 0xE0,
-    0x07, 0xF0, 0x03, 0xFC, 0x01, 0xFD, 0xBF, 0x8B, 0xF4, 0x03, 0xFC, 0x3F, 0xC0, 0x1F, 0xD2, 0xFD,
-    0x00, 0xFE, 0x0F, 0xE0, 0x07, 0xF0, 0xBF, 0x00, 0x3F, 0xC3, 0xF8, 0x01, 0xFD, 0x1F, 0xD0, 0x03,
-    0xFD, 0x3F, 0xD0, 0x3F, 0xC7, 0xFC, 0x0B, 0xF4, 0xBF, 0x00, 0xFF, 0x0F, 0xE0, 0x1F, 0xC1, 0xFC,
-    0x03, 0xF8, 0x3F, 0x80, 0xBF, 0x0B, 0xF0, 0x00, 0x00, 0x55, 0x03, 0xFD, 0x03, 0xFC, 0x0B, 0xF4,
-    0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0xBF, 0x40, 0x7F, 0xC7, 0xF8, 0x03, 0xFC, 0x3F, 0xC0, 0x1F,
-    0xE1, 0xFE, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xF4, 0x7F, 0x40, 0x2F, 0xC2, 0xFC, 0x00, 0xFE, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x00, 0x3D,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFE, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x60, 0x02, 0xF8, 0x0F, 0xFC, 0x7F, 0xF6, 0xFD, 0x0B, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0xFE, 0xBF, 0x40, 0x00, 0x03, 0xF2, 0xF8, 0xFE, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x2F, 0x80, 0x0F, 0xD0, 0x0B,
-    0xE3, 0xF8, 0x01, 0xFD, 0x00, 0xFE, 0xBF, 0x40, 0x2F, 0xC0, 0x1F, 0xD0, 0x68, 0xBC, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x09, 0x80, 0x00, 0x34, 0x00, 0x20,
-    0x40, 0x00, 0xE0, 0x00, 0x31, 0x80, 0x03, 0xC0, 0x00, 0x64, 0xC0, 0x0F, 0x00, 0x00, 0x91, 0x80,
-    0x2C, 0x00, 0x00, 0xBB, 0x40, 0xB4, 0x00, 0x00, 0x3D, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x51, 0x22, 0x00, 0x00, 0xF0, 0xA1, 0x96, 0x00, 0x03, 0xD0, 0x88, 0xC6, 0x00, 0x0F, 0x81,
-    0xDC, 0xDC, 0x00, 0x2E, 0x00, 0xF0, 0xB4, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x03, 0xFC, 0x0B, 0xF4, 0x0F, 0xF0, 0x1F, 0xC0, 0x3F, 0x80, 0xBF, 0x00, 0x03, 0xFD, 0x3F,
-    0xD0, 0x3F, 0xC7, 0xFC, 0x0B, 0xF4, 0xBF, 0x00, 0xFF, 0x0F, 0xE0, 0x1F, 0xC1, 0xFC, 0x03, 0xF8,
-    0x3F, 0x80, 0xBF, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x03, 0x40, 0x34, 0x0F,
-    0x80, 0x7C, 0x07, 0xD1, 0xF0, 0x0F, 0x80, 0xBC, 0x2E, 0x00, 0xF0, 0x0F, 0x43, 0xC0, 0x1E, 0x00,
-    0xF0, 0x34, 0x02, 0x80, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0xD0, 0xB8, 0x0F,
-    0x02, 0xD0, 0x28, 0x00, 0x00, 0x00, 0x70, 0x1D, 0x03, 0xE0, 0xF8, 0x0B, 0xC1, 0xF0, 0x0F, 0x03,
-    0xD0, 0x2D, 0x07, 0x80, 0x28, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x1D, 0x00, 0xB0,
-    0x3D, 0x03, 0xE0, 0x1F, 0x02, 0xE0, 0x1F, 0x00, 0xF4, 0x0F, 0x00, 0xF0, 0x07, 0xC0, 0xB4, 0x07,
-    0x80, 0x3C, 0x03, 0x80, 0x28, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x02, 0xF4,
-    0x00, 0x7C, 0xF4, 0x0B, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x01, 0xF0,
-    0x02, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00,
-    0x1D, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x02, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xF8, 0x00,
-    0x0B, 0xC0, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0xBE, 0x00, 0x0F, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xAF, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x8F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0xFE, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xFD, 0x7F, 0xFC, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF2, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x01,
-    0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xE0,
-    0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x06, 0xFA, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0x4F, 0x4B, 0xE0, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x02, 0xF0, 0x3F,
-    0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x1F, 0x43, 0xF0, 0x00, 0x0B, 0xC2,
-    0xF4, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x00, 0xFA, 0xFC, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1A, 0xAA,
-    0xAA, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x24, 0x00, 0x14, 0xE0, 0x00, 0xD3, 0xE4, 0x6F,
-    0x07, 0xFF, 0xF0, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0x03, 0x4C, 0xB0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7B, 0x7C,
-    0x00, 0x00, 0x08, 0x30, 0x40, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x47,
-    0x09, 0xC3, 0x2C, 0x2E, 0xAB, 0x4B, 0xFD, 0x00, 0x2F, 0x40, 0x1F, 0x40, 0x07, 0xF9, 0x1E, 0xDF,
-    0x03, 0x9C, 0xB2, 0x0C, 0x10, 0x01, 0x80, 0x01, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x2F, 0x80, 0x7F, 0x83, 0xF4, 0x0B, 0xF4,
-    0x01, 0x80, 0x00, 0xFC, 0x18, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B,
-    0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xE5, 0x7F, 0xD0, 0x0B, 0x02, 0xC0, 0x02, 0xF8, 0x0B, 0x80, 0x00,
-    0x00, 0x3F, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00,
-    0x02, 0xF4, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0xBD, 0x0B, 0xC0, 0x00, 0x00,
-    0xBE, 0x03, 0xE0, 0x00, 0x00, 0xBE, 0x01, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0xBC, 0x00, 0x07, 0xFE,
-    0x00, 0x3F, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0x80, 0x02, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0xFE, 0x00,
-    0x03, 0xF0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xBE, 0x00, 0x0B, 0xF0, 0x00,
-    0x2F, 0x40, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x0F, 0x80, 0x03, 0xFC, 0x00, 0x0B, 0xD0, 0x01, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0xFF,
-    0x80, 0x02, 0xFC, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x5F,
-    0xF0, 0x00, 0x00, 0x01, 0x28, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBD, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x3F,
-    0x40, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0F, 0xF0, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0x80, 0x00, 0x00,
-    0x00, 0x7F, 0x43, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC2, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x02, 0x48, 0x09, 0x05, 0x0C, 0x09, 0x18, 0xC9, 0x34, 0x8C, 0x34, 0x2C, 0x38, 0xB4, 0x3F, 0xF0,
-    0x1F, 0x80, 0x00, 0x04, 0x00, 0x28, 0x00, 0xB8, 0x02, 0xE4, 0x0B, 0x30, 0x2C, 0x70, 0x3F, 0xFC,
-    0x00, 0xE0, 0x00, 0xD0, 0x02, 0xD0, 0x03, 0xFE, 0x05, 0x00, 0x09, 0x00, 0x0C, 0x00, 0x1F, 0xE0,
-    0x00, 0x2C, 0x00, 0x2C, 0x10, 0x78, 0x7F, 0xF0, 0x6F, 0x80, 0x00, 0xBF, 0x00, 0xD0, 0x00, 0xD0,
-    0x00, 0x7B, 0xD0, 0x3D, 0x1C, 0x0D, 0x03, 0x03, 0x47, 0x80, 0xBF, 0xC0, 0x06, 0x40, 0x00, 0x7F,
-    0xF8, 0x00, 0xD0, 0x0B, 0x00, 0x34, 0x02, 0xC0, 0x0E, 0x00, 0xB0, 0x07, 0xC0, 0x3D, 0x00, 0xA0,
-    0x00, 0x00, 0x64, 0x00, 0xD1, 0x80, 0xA0, 0x60, 0x28, 0x74, 0x03, 0xF0, 0x07, 0x4B, 0x03, 0x41,
-    0xC1, 0xC0, 0xB0, 0x78, 0xB4, 0x0B, 0xF4, 0x00, 0x01, 0xFC, 0x02, 0x82, 0x80, 0xC0, 0x70, 0x70,
-    0x28, 0x1D, 0x6E, 0x02, 0xFF, 0x00, 0x01, 0xC0, 0xEB, 0xD0, 0x3F, 0xD0, 0x00, 0x00, 0x74, 0xAF,
-    0x80, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0x91, 0xF4, 0x01, 0xFC, 0x00, 0xF8, 0x02, 0xF4, 0x00,
-    0xF8, 0x03, 0xF0, 0x00, 0xF4, 0x07, 0xD0, 0x01, 0xF4, 0x0B, 0xC0, 0x02, 0xF0, 0x0F, 0xC0, 0x03,
-    0xF0, 0x1F, 0xC0, 0x07, 0xE0, 0x2F, 0x80, 0x0B, 0xE0, 0x3F, 0x40, 0x0F, 0xD0, 0x7F, 0x00, 0x0F,
-    0xC0, 0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x2A, 0x80, 0x00, 0xE0, 0x30, 0x03, 0xC0, 0x30, 0x07, 0x00,
-    0x34, 0x0F, 0x1C, 0x34, 0x0E, 0x3C, 0x70, 0x2D, 0x38, 0xB0, 0x2C, 0x10, 0xE0, 0x3C, 0x03, 0xD0,
-    0x3E, 0x1F, 0xC0, 0x3F, 0xFF, 0x40, 0x2F, 0xFD, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x50, 0x3E, 0x00,
-    0xD0, 0x0C, 0x02, 0xC0, 0x38, 0x03, 0x40, 0x70, 0x7F, 0xEF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0x00,
-    0x50, 0xA0, 0x00, 0x28, 0x00, 0x0D, 0x00, 0x1E, 0x00, 0x2E, 0x00, 0x7D, 0x00, 0x7F, 0xF4, 0x3F,
-    0xFC, 0x00, 0x02, 0xF8, 0x00, 0x01, 0x80, 0x00, 0x90, 0x0F, 0xE0, 0x00, 0x24, 0x00, 0x0B, 0x00,
-    0x03, 0x81, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x2C, 0x00, 0xB8, 0x02, 0xE4, 0x0B,
-    0x30, 0x2C, 0x74, 0x3F, 0xFC, 0x00, 0xE0, 0x00, 0xE0, 0x02, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x0C,
-    0x00, 0x0C, 0x00, 0x1F, 0xE0, 0x00, 0x34, 0x00, 0x34, 0x10, 0xB0, 0x7F, 0xE0, 0x6E, 0x40, 0x00,
-    0xBF, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0x7B, 0xD0, 0x3D, 0x1C, 0x0E, 0x03, 0x03, 0x02, 0xC0, 0xFB,
-    0xD0, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x03, 0x00, 0x38, 0x01, 0xC0, 0x0F, 0x00, 0x74,
-    0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x01, 0x40, 0x00, 0x00, 0x64, 0x00, 0xD1, 0xC0, 0xA0, 0x70, 0x28,
-    0x34, 0x03, 0xF4, 0x07, 0x4B, 0x03, 0x40, 0xC1, 0xC0, 0x70, 0x79, 0x78, 0x0B, 0xF4, 0x00, 0x01,
-    0xFC, 0x02, 0x82, 0x80, 0xC0, 0x70, 0x60, 0x28, 0x1D, 0x1E, 0x02, 0xFF, 0x00, 0x01, 0xC0, 0xEB,
-    0xD0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x82, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF8, 0x3D, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x7C, 0x00, 0x00, 0x03,
-    0xFF, 0xD0, 0xF4, 0x00, 0x00, 0x0F, 0xF7, 0xC1, 0xF0, 0x00, 0x00, 0x1F, 0xCF, 0x03, 0xC0, 0x00,
-    0x00, 0x3F, 0x5E, 0x0B, 0x80, 0x00, 0x00, 0xBF, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0xFD, 0xB8, 0x2E,
-    0x00, 0x00, 0x01, 0xFD, 0xF0, 0x3C, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0xB4, 0x00, 0x00, 0x02, 0xFF,
-    0xC1, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x83, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0xD6, 0xF0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xDB, 0xFF, 0xFE, 0x40, 0x00, 0x0B, 0x82,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x2E, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0x3C, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x76, 0xF0, 0x00, 0x3F, 0x40, 0x0B, 0xFF, 0x00, 0x07, 0xF0,
-    0x00, 0xFD, 0x10, 0x00, 0xBF, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xF8, 0x02, 0xE0, 0x00, 0x00, 0xFF,
-    0xE0, 0x3D, 0x04, 0x00, 0x0F, 0xFF, 0xFB, 0xEF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x03,
-    0xFE, 0x46, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0xBE, 0xAA, 0xA8, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x5B, 0xD5, 0x50, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF,
-    0xAA, 0x94, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xE0,
-    0x00, 0x07, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0xBE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xDF, 0xC0, 0x0B, 0xF0, 0x00, 0x0B, 0xF3, 0xF4, 0x03, 0xF4, 0x00, 0x03, 0xF8, 0xFE, 0x01,
-    0xFC, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0xBF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xE0, 0x3F, 0x4B, 0xF0, 0x00, 0x0B, 0xF4, 0x0F, 0xE3, 0xF4,
-    0x00, 0x03, 0xFC, 0x02, 0xF9, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0xBF, 0x80,
-    0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0xFD, 0x56, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x40, 0x00,
-    0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xAF, 0xFA, 0xAA, 0xBF, 0x90, 0x01, 0xF8, 0x00, 0x7F,
-    0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x57, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0xFA,
-    0xBF, 0xC0, 0x00, 0x3F, 0xFC, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0xB4, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0xD0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xD0, 0x00, 0x07, 0xF4, 0x3F, 0x00, 0x00, 0xF8,
-    0x00, 0x0B, 0xD0, 0x0F, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x2F, 0xF0, 0x0F,
-    0xC0, 0x1F, 0x00, 0x00, 0x00, 0xF4, 0x1F, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x2F, 0x80, 0x3F,
-    0x00, 0x03, 0xEB, 0xF4, 0x3F, 0x40, 0x3F, 0x00, 0x0F, 0xFF, 0xF0, 0x3F, 0x00, 0x7F, 0x00, 0x2F,
-    0xFF, 0xD0, 0x7F, 0x00, 0xBF, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0x2D,
-    0x00, 0x00, 0x07, 0x80, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0xF0,
-    0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x00, 0x2D, 0x00, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x05, 0x7D, 0x6F, 0xE5, 0xF5, 0x00, 0x0F, 0x0F,
-    0xF8, 0x7C, 0x00, 0x03, 0xC7, 0xEE, 0x2D, 0x00, 0x00, 0xF3, 0xF7, 0xCF, 0x00, 0x00, 0x3D, 0xF5,
-    0xF7, 0xC0, 0x00, 0x0F, 0xFC, 0x7E, 0xE0, 0x00, 0x03, 0xFE, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x0F,
-    0xC0, 0x00, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3A, 0x54, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3C, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x7C,
-    0x00, 0xF8, 0x00, 0x1F, 0x00, 0xB8, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0xF4, 0x03, 0xE0, 0x00, 0x0F,
-    0x01, 0xF0, 0x03, 0xD0, 0x24, 0x0F, 0x02, 0xF0, 0x07, 0xC0, 0xB8, 0x1E, 0x03, 0xE0, 0x0B, 0xC0,
-    0xF4, 0x2D, 0x03, 0xD0, 0x0F, 0x80, 0xF0, 0x3D, 0x07, 0xC0, 0x0F, 0x40, 0xF0, 0x28, 0x0B, 0xC0,
-    0x1F, 0x01, 0xE0, 0x00, 0x0F, 0x80, 0x2E, 0x01, 0xE0, 0x00, 0x1F, 0x00, 0x3D, 0x01, 0xF0, 0x00,
-    0x2F, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0xBE, 0x00, 0x7C, 0x00, 0xBF, 0xEB, 0xFD, 0x00, 0x10, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xF0, 0xE0, 0x00, 0x03, 0xFF, 0xED, 0x00, 0x00, 0xF4,
-    0x3F, 0xC0, 0x00, 0x3C, 0x01, 0xF8, 0x00, 0x0B, 0x00, 0x1F, 0x40, 0x00, 0xE0, 0x02, 0xF0, 0x00,
-    0x1E, 0x00, 0x3E, 0x00, 0x02, 0xF0, 0x1F, 0xD0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0x7C, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x50, 0x50, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0x00, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE, 0xFE, 0xAF,
-    0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x10, 0x00,
-    0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x03, 0x9F, 0xD2, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x18, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xD5, 0x5B, 0xF0, 0x00, 0x00, 0x0F, 0x80,
-    0x01, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBD, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x40, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F,
-    0xF9, 0xE0, 0x05, 0x00, 0x3F, 0xE0, 0x74, 0x00, 0x00, 0x3F, 0xD0, 0x2C, 0x00, 0x00, 0x1F, 0xE0,
-    0x0F, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0x80, 0x00, 0x03, 0xF4, 0x01, 0xD0, 0x00, 0x02, 0xFC, 0x00,
-    0xB0, 0x00, 0x00, 0xFE, 0x00, 0x2C, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xA5, 0x00, 0x1F, 0xC0, 0x03,
-    0xFF, 0xFF, 0x4B, 0xF0, 0x01, 0xEA, 0xFF, 0xD2, 0xFC, 0x00, 0xB0, 0x0F, 0xA0, 0xFF, 0x00, 0x3C,
-    0x07, 0xC0, 0x3F, 0xF0, 0x0E, 0x03, 0xF0, 0x0B, 0xFF, 0xEB, 0xEF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xFF, 0xE9,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x10, 0x01,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2A, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xA0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0x80, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x06, 0xFF, 0x80, 0x0B, 0xFF, 0xE0, 0x0F, 0xEF, 0x00, 0x0B,
-    0xE3, 0xC0, 0x03, 0xE0, 0xE0, 0x01, 0xF0, 0x70, 0x00, 0xF8, 0x2C, 0x00, 0x3D, 0x0E, 0x00, 0x1F,
-    0x47, 0x40, 0x07, 0xE2, 0xC0, 0x01, 0xFE, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFE, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01,
-    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xA5, 0x5F, 0xD1, 0x55,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xA8, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x0A, 0xAB, 0xEA, 0x40, 0xBF,
-    0xFF, 0xFD, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x19, 0x00, 0x03,
-    0xEB, 0xF0, 0x00, 0x1F, 0xFE, 0x40, 0x0B, 0xFE, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0x4F, 0x87,
-    0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x07, 0x4F, 0xBD, 0x00, 0x7C,
-    0x01, 0xF0, 0x0F, 0xC0, 0x0B, 0xC6, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x7F,
-    0xFF, 0xF0, 0x00, 0x0F, 0xEE, 0x3F, 0x00, 0x02, 0xF5, 0xE0, 0xF0, 0x00, 0x3E, 0x1D, 0x0F, 0x00,
-    0x07, 0xC2, 0xC0, 0xF0, 0x00, 0xB4, 0x3C, 0x0E, 0x00, 0x0F, 0x03, 0x81, 0xD0, 0x00, 0xF0, 0x74,
-    0x2C, 0x00, 0x1D, 0x0B, 0x03, 0xC0, 0x02, 0xC0, 0xF0, 0x38, 0x00, 0x3C, 0x0E, 0x0B, 0x40, 0x03,
-    0xC1, 0xD0, 0xF0, 0x00, 0x78, 0x2C, 0x1F, 0x00, 0x07, 0x83, 0xC1, 0xE0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xD5, 0x5F, 0xF0, 0x00,
-    0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0xD0, 0x00, 0x55, 0xFF,
-    0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0A, 0xAB, 0xFA, 0xA9, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x01, 0x01,
-    0xD0, 0x01, 0xBE, 0x03, 0xC1, 0xBF, 0xF9, 0x0F, 0xBF, 0xFE, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x02, 0xF6, 0xD7, 0xE0, 0x0F,
-    0x83, 0xC1, 0xF4, 0x7D, 0x03, 0xC0, 0x7C, 0x70, 0x07, 0x80, 0x10, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x1E, 0x00, 0xBE, 0x40, 0x0B, 0x40, 0x6F,
-    0xFE, 0x43, 0xC0, 0x01, 0xBF, 0xFE, 0xE0, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x30, 0x07, 0x80, 0x10, 0x7D, 0x03, 0xC0, 0x7C, 0x0F, 0x82, 0xC1, 0xF8, 0x02,
-    0xF5, 0xD3, 0xE0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x03, 0xC0,
-    0x1B, 0xDF, 0x90, 0x0F, 0x00, 0x1C, 0x2F, 0xF9, 0x1B, 0xFE, 0x0D, 0x00, 0xFF, 0xF9, 0x00, 0x01,
-    0xBF, 0xFC, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x02, 0xD7, 0x1F, 0x01, 0xF0, 0xB0, 0xB8,
-    0x38, 0x0E, 0x02, 0x80, 0x00, 0xD0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x70, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x03, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x1C, 0x00, 0x01, 0x00, 0xE0,
-    0x00, 0x3C, 0x0F, 0x03, 0x80, 0xF4, 0xB0, 0xF4, 0x01, 0xE7, 0x6E, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x16, 0xFF, 0xFC, 0x07, 0xFF, 0x94,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0xF0, 0xFE, 0x00, 0x03, 0xC0, 0x7F, 0x40,
-    0x0F, 0x00, 0x2F, 0xD0, 0x3C, 0x00, 0x0B, 0xE0, 0xF0, 0x00, 0x07, 0xD1, 0x40, 0x00, 0x00, 0x00,
-    0x03, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xE5, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0xFE, 0xF0, 0x00, 0x2F, 0xC3, 0xC0, 0x07, 0xF4, 0x0F, 0x01, 0xFE, 0x00, 0x3C, 0x3F, 0x80,
-    0x00, 0xF1, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40, 0x2C, 0x03, 0xC0, 0x3C, 0x02, 0xD0, 0x38, 0x00,
-    0xF0, 0x74, 0x00, 0xF4, 0xB0, 0x00, 0x7C, 0xF0, 0x00, 0x3D, 0xE0, 0x00, 0x1F, 0xD0, 0xBA, 0x5F,
-    0xC0, 0xFF, 0xFF, 0xC0, 0x05, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x74, 0x02, 0xE0, 0x38, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0x2C,
-    0x0F, 0x00, 0x0D, 0x1E, 0x00, 0x0E, 0x3C, 0x00, 0x0B, 0x78, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF5,
-    0xAE, 0x03, 0xFF, 0xFF, 0x02, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x74, 0x34, 0x00,
-    0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x3F, 0xE0, 0xBB, 0xC0, 0x00,
-    0xF8, 0xD0, 0xE3, 0xE0, 0x07, 0xE1, 0xC0, 0xD1, 0xF4, 0x1F, 0x42, 0xC1, 0xC0, 0xBC, 0x3C, 0x03,
-    0x82, 0xC0, 0x38, 0x10, 0x03, 0x43, 0x80, 0x00, 0x00, 0x07, 0x03, 0x40, 0x00, 0x00, 0x0B, 0x07,
-    0x00, 0x00, 0x00, 0x0D, 0x0F, 0x00, 0x00, 0x00, 0x0C, 0x0E, 0x00, 0x00, 0x00, 0x1C, 0x1D, 0x00,
-    0x00, 0x00, 0x28, 0x2C, 0x00, 0x00, 0x00, 0x34, 0x38, 0x00, 0x00, 0x00, 0x30, 0x34, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00,
-    0x00, 0x00, 0x70, 0x34, 0x00, 0x00, 0x00, 0x34, 0x38, 0x00, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00,
-    0x00, 0x2C, 0x1C, 0x00, 0x00, 0x00, 0x0C, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x0E, 0x00, 0x00, 0x00,
-    0x0A, 0x0B, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x74, 0x03, 0x03, 0x80, 0x30, 0x7E, 0x03,
-    0x43, 0xC0, 0xBC, 0x0F, 0x82, 0x82, 0xC1, 0xF4, 0x02, 0xF1, 0xC1, 0xD3, 0xE0, 0x00, 0xBD, 0xD0,
-    0xEB, 0xC0, 0x00, 0x1F, 0xE0, 0xBF, 0x00, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x34,
-    0x00, 0x00, 0x00, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x3C,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2E, 0xFD, 0x00, 0x00, 0x7C, 0xBF, 0xD0, 0x01,
-    0xF0, 0xA7, 0xFC, 0x07, 0xF0, 0xA0, 0x70, 0x1F, 0xF0, 0xA0, 0x00, 0x7E, 0x70, 0xA0, 0x00, 0x28,
-    0x70, 0xA0, 0x00, 0x00, 0x70, 0xA0, 0x00, 0x00, 0x70, 0xA0, 0x00, 0x00, 0x70, 0xA0, 0x00, 0x00,
-    0x70, 0xA0, 0x00, 0x00, 0x70, 0xA0, 0x00, 0x00, 0x70, 0xA0, 0x00, 0x28, 0x70, 0xA0, 0x00, 0x7E,
-    0x70, 0xA0, 0x00, 0x1F, 0xF0, 0xA0, 0x00, 0x07, 0xF0, 0xA0, 0x70, 0x01, 0xF0, 0xA7, 0xFC, 0x00,
-    0x7C, 0xBF, 0xD0, 0x00, 0x2E, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x0B, 0xF8, 0x0F, 0x00, 0x01, 0xFF, 0xFC, 0x78, 0x00, 0x2F,
-    0x80, 0xBB, 0xC0, 0x01, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B,
-    0xC0, 0x02, 0xF0, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x02, 0xE0, 0x00, 0x2F, 0xD5, 0xBF, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xA0, 0x3C, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xEF, 0x40, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x0B,
-    0xCB, 0xE0, 0x00, 0x3F, 0x40, 0x02, 0xE0, 0xBE, 0x00, 0x07, 0xF0, 0x00, 0xF8, 0x0B, 0xD0, 0x00,
-    0xFD, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x0F, 0xC0, 0x01, 0xF8, 0x07, 0xC0,
-    0x01, 0xF8, 0x00, 0x2F, 0x81, 0xF0, 0x00, 0x3F, 0x40, 0x02, 0xF8, 0xBC, 0x00, 0x0B, 0xF0, 0x00,
-    0x2F, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0xD5, 0x5B, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x0F, 0x6F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xC0, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x1F,
-    0x8F, 0x80, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x0F,
-    0xD0, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x2F, 0x80, 0x07, 0xF0,
-    0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x0B,
-    0xF0, 0x00, 0x03, 0xFC, 0x1F, 0xE5, 0x55, 0x57, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xF8, 0x00, 0xF4,
-    0x00, 0x0F, 0x40, 0x1F, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x03, 0xE0,
-    0x03, 0xD0, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0xF8, 0x00,
-    0x0F, 0x80, 0x0F, 0x00, 0x00, 0xF4, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x02, 0xF0, 0x03,
-    0xD0, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x0B,
-    0xC0, 0x0F, 0x40, 0x00, 0x14, 0x00, 0x28, 0x00, 0x03, 0xE0, 0x03, 0xC0, 0x00, 0x2F, 0x00, 0x3E,
-    0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x0B,
-    0xC0, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x3D,
-    0x00, 0x01, 0xF0, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x0B,
-    0xC0, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xD0,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x7F, 0xAA, 0xA9, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xBF, 0xFE, 0x3F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA4, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x20, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0xBE, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF4, 0x06, 0xF8, 0x00, 0x0F, 0xFF, 0xE1, 0xFF, 0xE0, 0x03, 0xF9, 0x5F, 0x7E, 0x5F,
-    0x00, 0xBC, 0x00, 0x7F, 0x40, 0x34, 0x0F, 0x00, 0x03, 0xD0, 0x03, 0x41, 0xE0, 0x00, 0x7C, 0x00,
-    0x34, 0x2C, 0x00, 0x0B, 0x80, 0x07, 0x03, 0xC0, 0x01, 0xFC, 0x01, 0xE0, 0x3E, 0x45, 0xBF, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xD3, 0xFF, 0xE0, 0x00, 0x2F, 0xE0, 0x0B,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF8, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x38, 0x03, 0xF0, 0xB4, 0x0F, 0x40, 0xBC,
-    0x03, 0xE7, 0xE0, 0x06, 0x40, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x02, 0x40, 0x1F, 0x9F, 0x40, 0x7C, 0x03, 0xD0, 0x3D, 0x1F, 0x40, 0xBC, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x94, 0x00, 0x00, 0x1A,
-    0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x5A, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x1B, 0xFF, 0xF4,
-    0x00, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x05, 0xAB, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFE, 0xA5, 0x00, 0x3E, 0xA5, 0x00, 0x00,
-    0x00, 0x00,
+static const uint8_t opendyslexic_12_italicBitmaps[36682] = {
+    0x71, 0x99, 0x70, 0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7,
+    0x9D, 0x97, 0xAD, 0x70, 0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x0E,
+    0x77, 0x76, 0xEA, 0x69, 0xEA, 0x6F, 0x95, 0x9F, 0x95, 0xAF, 0x60, 0xAE, 0xA1, 0xF1, 0x9E, 0xA1,
+    0xAE, 0x91, 0xF1, 0xAE, 0x91, 0xF1, 0x9E, 0x91, 0xAE, 0x2E, 0xA1, 0x9E, 0x91, 0xF2, 0xEA, 0x1A,
+    0xE0, 0x73, 0xD4, 0x9C, 0xA7, 0x70, 0x9D, 0x4D, 0x97, 0x70, 0xAC, 0xA4, 0xD7, 0x71, 0xD4, 0xAC,
+    0xA7, 0x70, 0xAD, 0x4D, 0x97, 0x70, 0xDA, 0x39, 0xD7, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE,
+    0x97, 0x09, 0xD9, 0x3A, 0xD7, 0x70, 0xAD, 0x4D, 0xA7, 0x70, 0xDA, 0x39, 0xD7, 0x70, 0xAD, 0x93,
+    0xE7, 0x70, 0xE3, 0x9D, 0x97, 0x79, 0xDA, 0x3A, 0xD7, 0x3F, 0xFF, 0xFF, 0xE3, 0x9F, 0xFF, 0xFF,
+    0xDA, 0x70, 0xAD, 0xA3, 0xE7, 0x70, 0xE3, 0x9D, 0xA7, 0x79, 0xE3, 0xAD, 0x97, 0x7E, 0x93, 0xE7,
+    0x79, 0xE3, 0xAD, 0xA7, 0x77, 0x77, 0x00, 0x77, 0x77, 0x3D, 0x1D, 0x77, 0x0D, 0x1C, 0xA7, 0x79,
+    0xDA, 0xEA, 0xA9, 0x72, 0x9F, 0xFE, 0x71, 0xAF, 0xFF, 0x70, 0xAF, 0xC9, 0x0D, 0x19, 0x97, 0x9E,
+    0xAC, 0xA1, 0xCA, 0x73, 0xEA, 0x9C, 0x90, 0x9C, 0x97, 0x3E, 0x0A, 0xC1, 0xAC, 0x73, 0x9E, 0x0D,
+    0x1D, 0x74, 0xFD, 0x99, 0xCA, 0x74, 0xAF, 0xFC, 0x97, 0x4A, 0xFF, 0xD9, 0x74, 0xDA, 0xFE, 0xA7,
+    0x3D, 0x1F, 0xE9, 0x72, 0xCA, 0x1C, 0xAF, 0xD7, 0x19, 0xC9, 0x09, 0xC9, 0xFD, 0x71, 0xAC, 0x1A,
+    0xCA, 0xFD, 0x4E, 0xAA, 0xDA, 0xAF, 0xF9, 0x3F, 0xFF, 0xFC, 0xA3, 0xFF, 0xFF, 0xCA, 0x3F, 0xFF,
+    0xFA, 0x69, 0xAF, 0xFD, 0xA9, 0x76, 0xD1, 0xD7, 0x70, 0xCA, 0x1C, 0xA7, 0x70, 0xA1, 0x9A, 0x71,
+    0x77, 0x77, 0x4A, 0xC7, 0x70, 0x9C, 0x94, 0xAD, 0xA6, 0x9C, 0xA4, 0xD9, 0x9D, 0x5C, 0xA4, 0xCA,
+    0x3C, 0x4D, 0x49, 0xC4, 0xC3, 0xD5, 0xAC, 0x39, 0xC2, 0xAC, 0x95, 0xAA, 0x3C, 0xA1, 0xAC, 0xA6,
+    0xD9, 0x09, 0xAC, 0x90, 0x9C, 0xA7, 0x9F, 0xCA, 0x09, 0xD7, 0x1A, 0xE9, 0x09, 0xD9, 0x77, 0xFD,
+    0x74, 0xE2, 0xCA, 0x72, 0xE3, 0xAC, 0x71, 0xAD, 0xA3, 0xAA, 0x70, 0xAE, 0x93, 0xC9, 0x79, 0xD0,
+    0xCA, 0x90, 0x9D, 0x79, 0xD1, 0xFD, 0x70, 0xD9, 0x2A, 0xDA, 0x70, 0xD9, 0x77, 0x77, 0x73, 0x9A,
+    0xDA, 0x97, 0x3F, 0xFA, 0x71, 0xE9, 0x29, 0xD7, 0x0A, 0xD5, 0xD9, 0x7D, 0xA4, 0x9D, 0x97, 0xDA,
+    0x39, 0xE7, 0x0A, 0xD9, 0x1F, 0x72, 0xEA, 0xEA, 0x74, 0xFC, 0x97, 0x39, 0xFC, 0x74, 0xAF, 0xDA,
+    0x72, 0xAE, 0xA0, 0xAD, 0x94, 0x92, 0x9E, 0xA2, 0xAD, 0x92, 0xAD, 0x90, 0xF4, 0xE1, 0x9E, 0x09,
+    0xEA, 0x5E, 0x9E, 0x90, 0xAE, 0x96, 0xFC, 0x91, 0xAF, 0x59, 0xFA, 0x29, 0xFC, 0xA9, 0x9A, 0xFD,
+    0x93, 0xFF, 0xFC, 0xAD, 0x4F, 0xFD, 0xA1, 0xA9, 0x59, 0xAF, 0xA9, 0x77, 0x74, 0x09, 0x99, 0x92,
+    0xF2, 0xF2, 0xAE, 0x29, 0xE3, 0xE9, 0x2F, 0x70, 0x72, 0xCA, 0x72, 0xDA, 0x71, 0xAC, 0xA7, 0x19,
+    0xD7, 0x2D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7, 0x2D, 0x72, 0xDA, 0x71, 0x9D, 0x72, 0xDA, 0x71, 0x9D,
+    0x72, 0xDA, 0x72, 0xD7, 0x2A, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2A, 0xCA,
+    0x72, 0xD9, 0x72, 0xD9, 0x72, 0xD9, 0x72, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x97, 0x2D, 0x97, 0x2D,
+    0x97, 0x2D, 0xA7, 0x2E, 0x72, 0xE7, 0x2A, 0xD7, 0x39, 0xA7, 0x10, 0x0D, 0x73, 0xAC, 0xA7, 0x3D,
+    0xA7, 0x3D, 0x97, 0x29, 0xD7, 0x3A, 0xD7, 0x3D, 0x97, 0x29, 0xD7, 0x3A, 0xCA, 0x73, 0xD9, 0x72,
+    0xAD, 0x73, 0xD9, 0x72, 0xDA, 0x72, 0x9D, 0x73, 0xD9, 0x72, 0xAC, 0xA7, 0x29, 0xD7, 0x3D, 0x73,
+    0xD9, 0x72, 0xAC, 0xA7, 0x2A, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7,
+    0x29, 0xD7, 0x29, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0xA7, 0x19, 0xA9,
+    0x10, 0x77, 0x2A, 0xC9, 0x71, 0xAC, 0x39, 0x1C, 0xA1, 0xD1, 0xAC, 0x90, 0xAE, 0x0C, 0xA9, 0xD9,
+    0x3A, 0xFC, 0x96, 0x9E, 0x69, 0xFE, 0x91, 0x9D, 0xA0, 0xCA, 0x0A, 0xD9, 0x09, 0xC9, 0x1C, 0x91,
+    0x9A, 0x5A, 0xC7, 0x2A, 0xA6, 0x69, 0xC9, 0x71, 0xD7, 0x2D, 0x71, 0x9C, 0xA7, 0x1A, 0xC9, 0x4F,
+    0xFE, 0x99, 0xFF, 0xE5, 0x9C, 0xA7, 0x1A, 0xC9, 0x71, 0xD7, 0x19, 0xD7, 0x19, 0xC9, 0x50, 0x39,
+    0x99, 0x92, 0xF9, 0x2F, 0x2A, 0xE9, 0x2F, 0x29, 0xE9, 0x2F, 0x2A, 0xE9, 0x20, 0x09, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x1F, 0xFE, 0x09, 0xFF, 0xE0, 0x6E, 0x0A, 0xDA, 0x0E, 0xAA, 0xE9, 0x77, 0x6A,
+    0x77, 0x5A, 0xC9, 0x77, 0x5D, 0x77, 0x5A, 0xC9, 0x77, 0x5D, 0x77, 0x5D, 0x77, 0x59, 0xCA, 0x77,
+    0x5D, 0x77, 0x5A, 0xCA, 0x77, 0x5D, 0x77, 0x5A, 0xCA, 0x77, 0x5D, 0x77, 0x5D, 0x97, 0x74, 0x9D,
+    0x77, 0x5D, 0x97, 0x74, 0x9D, 0x77, 0x5D, 0x77, 0x5A, 0xCA, 0x77, 0x5D, 0x77, 0x5D, 0xA7, 0x74,
+    0x9D, 0x77, 0x5D, 0xA7, 0x74, 0x9D, 0x77, 0x5D, 0x97, 0x74, 0xAD, 0x77, 0x5D, 0x97, 0x74, 0xE7,
+    0x74, 0x9D, 0x97, 0x74, 0xDA, 0x77, 0x49, 0xD7, 0x75, 0xDA, 0x77, 0x4A, 0xD7, 0x75, 0xDA, 0x77,
+    0x4A, 0xD7, 0x74, 0x9D, 0x97, 0x74, 0xE7, 0x74, 0x9C, 0xA7, 0x75, 0xC7, 0x77, 0x77, 0x70, 0x79,
+    0xAE, 0x97, 0x1D, 0x91, 0x9C, 0xA7, 0xD4, 0xAC, 0x6D, 0x94, 0x9C, 0xA4, 0xAD, 0x59, 0xCA, 0x4D,
+    0x91, 0x92, 0x9C, 0xA3, 0xAD, 0x1A, 0xCA, 0x1A, 0xCA, 0x3D, 0xA1, 0xDA, 0x1D, 0x92, 0x9D, 0x91,
+    0xD9, 0x1D, 0x3A, 0xD2, 0xD1, 0xAD, 0x3E, 0x2A, 0x2D, 0xA3, 0xE5, 0xAD, 0x93, 0xE5, 0xE4, 0xE9,
+    0x29, 0xEA, 0x4F, 0xAA, 0xFC, 0x5F, 0xFD, 0x95, 0xAF, 0xFA, 0x7F, 0xEA, 0x71, 0xAE, 0xA7, 0x77,
+    0x4A, 0xE6, 0x9F, 0xC6, 0xD9, 0xDA, 0x69, 0x1D, 0x71, 0x9D, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0x9D,
+    0x71, 0xAD, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x70, 0x9D, 0xA5, 0x99, 0x9E, 0xAA,
+    0x99, 0x19, 0xFF, 0xD1, 0xAF, 0xFD, 0x1F, 0xFD, 0xA0, 0x69, 0xAF, 0xA7, 0x1F, 0xFC, 0x96, 0x9D,
+    0xA9, 0x19, 0xE6, 0x99, 0x59, 0xD9, 0x76, 0xD9, 0x75, 0x9D, 0x76, 0xE7, 0x5A, 0xDA, 0x74, 0x9E,
+    0x74, 0x9E, 0x97, 0x3A, 0xEA, 0x72, 0x9F, 0xA7, 0x2A, 0xFA, 0x71, 0x9F, 0xC9, 0x71, 0xAF, 0xC7,
+    0x29, 0xFC, 0xA9, 0x9A, 0xA9, 0x5F, 0xFE, 0x94, 0x9F, 0xFE, 0x5F, 0xFF, 0x40, 0x59, 0xAF, 0xA7,
+    0x0A, 0xEA, 0xAE, 0x96, 0x96, 0xD7, 0x69, 0xC9, 0x75, 0x9C, 0x97, 0x5D, 0x75, 0x9C, 0xA7, 0x39,
+    0xAD, 0x70, 0xFD, 0xA7, 0x09, 0xFC, 0xA7, 0x59, 0xE7, 0x6D, 0xA7, 0x5D, 0xA7, 0x49, 0xD9, 0x73,
+    0x9E, 0x49, 0xEA, 0xAF, 0xC9, 0x4F, 0xFD, 0xA4, 0x9F, 0xFC, 0xA6, 0x9A, 0xFA, 0x97, 0x77, 0x70,
+    0xAC, 0x72, 0xAD, 0x71, 0xAD, 0xA7, 0x0A, 0xE9, 0x7A, 0xF7, 0xAD, 0x0D, 0x6A, 0xD0, 0x9D, 0x5A,
+    0xD1, 0xAC, 0xA4, 0xAD, 0x2D, 0x93, 0xAD, 0x29, 0xD9, 0x2A, 0xDA, 0x99, 0x9E, 0xA9, 0x90, 0xFF,
+    0xF9, 0x9F, 0xFF, 0x7A, 0xDA, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE, 0x71, 0xF3, 0x49, 0xAA, 0xAA,
+    0xAF, 0x5F, 0xFD, 0x5D, 0x74, 0x9C, 0xA7, 0x4A, 0xC9, 0x74, 0xD7, 0x49, 0xCA, 0x74, 0xAF, 0xDA,
+    0x7F, 0xFC, 0x95, 0x99, 0x4E, 0x75, 0xD9, 0x73, 0x9D, 0x97, 0x3A, 0xD9, 0x72, 0x9E, 0x4A, 0x49,
+    0xEA, 0x3A, 0xFF, 0xD4, 0xFF, 0xD9, 0x39, 0xFF, 0xC9, 0x5A, 0xFC, 0xA9, 0x60, 0x70, 0x9A, 0xFC,
+    0x79, 0xFF, 0x69, 0xDA, 0x97, 0x29, 0xD9, 0x74, 0xD9, 0x74, 0xDA, 0x74, 0x9D, 0x75, 0xAC, 0xA9,
+    0xAE, 0xA9, 0x6F, 0xFD, 0x94, 0x9F, 0x92, 0xE4, 0xAE, 0x5D, 0x93, 0xE6, 0xD9, 0x3D, 0xA6, 0xD4,
+    0xD9, 0x5A, 0xD4, 0xDA, 0x49, 0xD9, 0x4E, 0xA9, 0x99, 0xF5, 0xAF, 0xFC, 0x7F, 0xF7, 0x1A, 0xEA,
+    0x96, 0x74, 0x9F, 0xFE, 0x99, 0xAA, 0xAF, 0xF7, 0x1D, 0x97, 0x09, 0xD7, 0x1D, 0xA7, 0x09, 0xD7,
+    0x1E, 0x70, 0xAD, 0x97, 0x0E, 0x70, 0xAD, 0xA7, 0x0E, 0x70, 0xEA, 0x79, 0xE9, 0x7F, 0x79, 0xE9,
+    0x7F, 0x7A, 0xEA, 0x7F, 0x70, 0x7A, 0xFA, 0x70, 0x9D, 0xA9, 0x09, 0xD6, 0x9D, 0x49, 0xCA, 0x5D,
+    0x95, 0xD4, 0x9D, 0x59, 0xD4, 0x9D, 0x5D, 0xA4, 0x9D, 0x4E, 0x6E, 0x99, 0xAE, 0x97, 0xFD, 0xA7,
+    0x0A, 0xFD, 0xA6, 0xAE, 0x91, 0x9D, 0xA4, 0xAD, 0xA4, 0xAD, 0x4D, 0xA5, 0x9D, 0x92, 0xAD, 0x95,
+    0x9D, 0x92, 0xE6, 0xE3, 0xEA, 0x4E, 0xA3, 0xAF, 0xAA, 0xAF, 0x5F, 0xFC, 0xA7, 0x9A, 0xFA, 0x60,
+    0x6A, 0xF9, 0x7A, 0xEA, 0xEA, 0x5A, 0xD3, 0xAD, 0x93, 0x9D, 0x5D, 0xA3, 0xD6, 0xDA, 0x29, 0xD6,
+    0xDA, 0x2A, 0xCA, 0x6D, 0xA2, 0xD9, 0x59, 0xD9, 0x2D, 0xA5, 0xE3, 0xAD, 0x92, 0x9F, 0x39, 0xFF,
+    0xDA, 0x49, 0xFF, 0xC9, 0x79, 0x99, 0x09, 0xD7, 0x4A, 0xCA, 0x73, 0xAD, 0x93, 0xA9, 0x99, 0x99,
+    0x9E, 0xA4, 0xFF, 0xD4, 0xAF, 0xFC, 0x5A, 0xFE, 0x96, 0x4E, 0x4A, 0xE4, 0xF3, 0xAE, 0xA3, 0x99,
+    0x99, 0x97, 0x77, 0x77, 0x79, 0x99, 0x5E, 0x4A, 0xE4, 0xF3, 0xAE, 0xA3, 0x5A, 0xD9, 0x5E, 0x94,
+    0xAE, 0x5F, 0x59, 0x99, 0x97, 0x77, 0x77, 0x76, 0x99, 0x99, 0x4F, 0x94, 0xF4, 0xAE, 0x5E, 0xA4,
+    0x9E, 0x5E, 0xA4, 0x9A, 0xAA, 0x50, 0x77, 0x76, 0x9C, 0x97, 0x59, 0xEA, 0x73, 0x9F, 0xC7, 0x29,
+    0xFC, 0x97, 0x19, 0xFC, 0x97, 0x19, 0xFC, 0xA7, 0x2F, 0xCA, 0x74, 0xF9, 0x75, 0xAF, 0xCA, 0x97,
+    0x39, 0xAF, 0xEA, 0x97, 0x29, 0xAF, 0xFA, 0x97, 0x29, 0xAF, 0xE7, 0x5A, 0xF9, 0x77, 0x9A, 0xA0,
+    0x77, 0x0A, 0xAF, 0xF9, 0x19, 0xFE, 0xAA, 0xA9, 0x77, 0x77, 0x73, 0xAA, 0xAA, 0xFD, 0x2F, 0xFE,
+    0x77, 0x77, 0x69, 0xC9, 0x77, 0xAE, 0x97, 0x6A, 0xF9, 0x75, 0x9F, 0xC9, 0x75, 0x9F, 0xC9, 0x75,
+    0x9F, 0xC9, 0x75, 0xAF, 0xC7, 0x59, 0xF7, 0x29, 0xAF, 0xCA, 0x69, 0xAF, 0xF9, 0x39, 0xAF, 0xFA,
+    0x95, 0xFE, 0xA9, 0x70, 0x9F, 0xA9, 0x73, 0xAA, 0x97, 0x70, 0x77, 0x59, 0xAE, 0xA9, 0x69, 0xFF,
+    0xC4, 0x9E, 0x99, 0x9A, 0xEA, 0x39, 0xC9, 0x5E, 0x74, 0xAD, 0x74, 0xAD, 0x74, 0xE7, 0x4D, 0xA7,
+    0x3E, 0x73, 0x9D, 0xA7, 0x29, 0xE7, 0x29, 0xE7, 0x2A, 0xE7, 0x1A, 0xF7, 0x1F, 0xA7, 0x2E, 0x97,
+    0x29, 0xE7, 0x3A, 0xE7, 0x3E, 0x97, 0x3E, 0x74, 0x99, 0x77, 0x77, 0x74, 0xE7, 0x39, 0xE7, 0x3E,
+    0xA7, 0x29, 0xEA, 0x72, 0x77, 0x9A, 0xAA, 0x77, 0x1A, 0xFF, 0x75, 0xAE, 0xA3, 0xAD, 0x73, 0xE9,
+    0x7C, 0xA7, 0x1D, 0xA7, 0x19, 0xC7, 0x0D, 0xA7, 0x3C, 0x96, 0xDA, 0x1A, 0xD9, 0xC5, 0xCA, 0x5A,
+    0xD1, 0xCA, 0x09, 0xCA, 0x5C, 0xA5, 0xD9, 0x0C, 0x92, 0xC9, 0x5C, 0x94, 0xE0, 0x9A, 0x3C, 0x94,
+    0x9C, 0x5D, 0xA0, 0xA9, 0x2A, 0xC5, 0xCA, 0x49, 0xDA, 0x0C, 0xA0, 0x9A, 0xD4, 0xD5, 0xAD, 0xA0,
+    0xFE, 0x29, 0xD9, 0x5A, 0xE1, 0xE9, 0xAA, 0x9A, 0xE9, 0x6A, 0xE7, 0x9C, 0xA9, 0x70, 0x9F, 0x77,
+    0x4F, 0xC9, 0x49, 0x99, 0x72, 0x9F, 0xFF, 0xA7, 0x39, 0xFF, 0xEA, 0x75, 0xAF, 0xFC, 0xA7, 0x79,
+    0x9A, 0xAA, 0x99, 0x70, 0x74, 0x9D, 0xA7, 0x7F, 0x76, 0xAF, 0x75, 0x9F, 0xC7, 0x5D, 0xAA, 0xD7,
+    0x4A, 0xD0, 0xAD, 0x73, 0x9D, 0x90, 0x9D, 0x97, 0x2D, 0xA1, 0x9D, 0x97, 0x1A, 0xD2, 0x9D, 0xA7,
+    0x09, 0xD9, 0x3D, 0xA7, 0x0E, 0x4E, 0x7A, 0xD5, 0xE6, 0x9D, 0xA5, 0xE6, 0xE6, 0xE5, 0xAF, 0xFF,
+    0xC9, 0x39, 0xFF, 0xFD, 0x93, 0xFF, 0xFE, 0x92, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA1, 0x9E,
+    0x71, 0xEA, 0x1E, 0xA7, 0x1F, 0x0A, 0xE7, 0x2F, 0x00, 0x77, 0x79, 0xFF, 0xC9, 0x7A, 0xFF, 0xDA,
+    0x6E, 0x5A, 0xD9, 0x5D, 0xA6, 0xDA, 0x49, 0xD9, 0x6D, 0xA4, 0xAD, 0x7D, 0x94, 0xE6, 0xE4, 0x9E,
+    0xAA, 0xAA, 0xAF, 0x5A, 0xFF, 0xD9, 0x6F, 0xFF, 0x95, 0xDA, 0x59, 0xE9, 0x39, 0xD9, 0x7D, 0xA3,
+    0xAD, 0x70, 0xE3, 0xE7, 0x0E, 0x3D, 0xA7, 0xAD, 0xA2, 0x9D, 0x96, 0x9E, 0x92, 0xAD, 0x59, 0xFC,
+    0x3F, 0xFF, 0xDA, 0x3F, 0xFF, 0xD3, 0x9F, 0xFF, 0xC4, 0xFF, 0xEA, 0x95, 0x77, 0x77, 0x29, 0xAF,
+    0xCA, 0x73, 0xAF, 0xFC, 0x71, 0xAF, 0xFD, 0x97, 0x0F, 0xC9, 0x76, 0xF9, 0x77, 0xF7, 0x70, 0xF7,
+    0x70, 0x9E, 0x77, 0x1E, 0x97, 0x70, 0xAE, 0x77, 0x1E, 0x97, 0x70, 0x9E, 0x77, 0x1A, 0xE7, 0x71,
+    0xFA, 0x77, 0x0F, 0xC9, 0x79, 0x6F, 0xEA, 0xA9, 0x9A, 0xE6, 0xFF, 0xFD, 0xA6, 0xAF, 0xFF, 0xC9,
+    0x7F, 0xFF, 0xC7, 0x09, 0xFF, 0xF7, 0x2A, 0xFF, 0xA9, 0x77, 0x73, 0x59, 0x99, 0x99, 0x99, 0x75,
+    0x9F, 0xFC, 0xA7, 0x2A, 0xFF, 0xEA, 0x70, 0xFF, 0xFC, 0xA7, 0xDA, 0x49, 0xAF, 0x95, 0x9D, 0x97,
+    0xF5, 0xE7, 0x09, 0xE5, 0xE7, 0x1E, 0x93, 0x9D, 0xA7, 0x1E, 0xA3, 0xAD, 0x97, 0x1E, 0xA3, 0xE7,
+    0x2E, 0xA3, 0xE7, 0x2E, 0x92, 0x9D, 0xA7, 0x19, 0xE3, 0xAD, 0x97, 0x1F, 0x3E, 0x71, 0x9E, 0xA3,
+    0xE7, 0x0A, 0xF9, 0x29, 0xDA, 0x99, 0x99, 0x9A, 0xAF, 0xE3, 0xAF, 0xFF, 0xF4, 0xFF, 0xFF, 0x5F,
+    0xFF, 0xE5, 0x9F, 0xFF, 0xC9, 0x6F, 0xFC, 0xAA, 0x97, 0x10, 0x77, 0x70, 0xAF, 0xFE, 0xA5, 0xFF,
+    0xF5, 0x9F, 0xEA, 0xAA, 0xA9, 0x5A, 0xD7, 0x7E, 0x77, 0xDA, 0x76, 0xAD, 0x77, 0xE7, 0x7F, 0xFC,
+    0xA7, 0x9F, 0xFC, 0x97, 0xAF, 0xFC, 0x70, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xE7,
+    0x6A, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x95, 0xFF, 0xFC, 0x5F, 0xFF, 0xC4, 0x9F, 0xFF, 0xC4, 0xAF,
+    0xFF, 0xC4, 0x77, 0x79, 0xFF, 0xDA, 0x5A, 0xFF, 0xD9, 0x5E, 0x99, 0x97, 0x29, 0xDA, 0x75, 0xAD,
+    0x97, 0x5E, 0x76, 0xDA, 0x75, 0xAF, 0xFC, 0x96, 0xFF, 0xD7, 0xFF, 0xCA, 0x6A, 0xDA, 0x75, 0xE9,
+    0x75, 0xE7, 0x59, 0xE7, 0x5E, 0xA7, 0x5E, 0x97, 0x49, 0xE7, 0x5F, 0x75, 0xEA, 0x74, 0x9E, 0x97,
+    0x4A, 0xE7, 0x50, 0x76, 0x99, 0x74, 0x9F, 0xFD, 0x96, 0xAF, 0xFF, 0x95, 0xFC, 0xA9, 0x59, 0x94,
+    0xF9, 0x76, 0xF9, 0x76, 0x9E, 0xA7, 0x7F, 0x77, 0x0E, 0x97, 0x7A, 0xE7, 0x70, 0xEA, 0x77, 0x0E,
+    0x95, 0x9A, 0xA9, 0x94, 0x9E, 0x69, 0xFE, 0x90, 0xAE, 0x7A, 0xAF, 0xC9, 0x0A, 0xE7, 0x2D, 0xAA,
+    0x1A, 0xE7, 0x19, 0xD3, 0xFC, 0x70, 0xE3, 0xAF, 0xDA, 0xAA, 0xAA, 0xFA, 0x39, 0xFF, 0xFE, 0xA4,
+    0xFF, 0xFE, 0x95, 0xFF, 0xFC, 0xA7, 0x9A, 0xFE, 0xA9, 0x50, 0x77, 0x74, 0xE7, 0x1E, 0x6E, 0x70,
+    0x9E, 0x59, 0xDA, 0x70, 0xAD, 0xA5, 0xAD, 0x97, 0x0E, 0x95, 0xE7, 0x1E, 0x59, 0xE7, 0x09, 0xE5,
+    0xAE, 0x70, 0xEA, 0x5E, 0xA7, 0x0E, 0x95, 0xE9, 0x79, 0xE5, 0x9E, 0x70, 0xAE, 0x5F, 0x70, 0xF5,
+    0xFF, 0xFF, 0xA4, 0x9F, 0xFF, 0xF9, 0x4A, 0xFF, 0xFF, 0x5F, 0xFF, 0xFC, 0x49, 0xFA, 0xAA, 0xAA,
+    0xAA, 0xAF, 0xA4, 0xAE, 0x97, 0xF9, 0x4F, 0x70, 0xF5, 0xF7, 0x9F, 0x49, 0xF7, 0xAE, 0xA4, 0xAE,
+    0xA7, 0xFA, 0x40, 0x5E, 0x94, 0x9E, 0x5A, 0xE5, 0xAD, 0xA5, 0xE9, 0x5E, 0x59, 0xE5, 0xAD, 0xA5,
+    0xE5, 0x9E, 0x5A, 0xDA, 0x5E, 0x95, 0xE9, 0x49, 0xE5, 0xAE, 0x5E, 0xA4, 0x9E, 0x94, 0xAE, 0x94,
+    0xF4, 0x9F, 0x4A, 0xEA, 0x40, 0x74, 0x9E, 0x75, 0xAE, 0x75, 0xEA, 0x75, 0xE9, 0x74, 0xAE, 0x75,
+    0xEA, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xAD, 0xA7, 0x5E, 0x97, 0x49, 0xE7, 0x5A, 0xDA, 0x75, 0xE9,
+    0x75, 0xE7, 0x5A, 0xE7, 0x5E, 0x97, 0x5E, 0x75, 0x9E, 0x75, 0xAD, 0xA7, 0x5E, 0x75, 0xAE, 0x74,
+    0x9E, 0x97, 0x09, 0x19, 0xF7, 0x1F, 0xEA, 0x70, 0x9F, 0xE7, 0x1A, 0xFD, 0x72, 0xFC, 0x97, 0x49,
+    0x76, 0x6A, 0xD9, 0x3F, 0x7E, 0x3A, 0xE7, 0x9E, 0x2A, 0xE7, 0x0A, 0xD9, 0x19, 0xE7, 0x1E, 0x19,
+    0xE9, 0x70, 0x9E, 0x09, 0xE9, 0x71, 0xAD, 0x90, 0xEA, 0x72, 0xE0, 0xEA, 0x72, 0x9F, 0xDA, 0x73,
+    0xFE, 0x74, 0xFD, 0x74, 0x9F, 0xCA, 0x74, 0xFE, 0x74, 0xFF, 0x72, 0xAE, 0x9F, 0xA7, 0x1E, 0xA0,
+    0xFC, 0x97, 0x9E, 0x19, 0xFC, 0x7A, 0xE2, 0xFC, 0xA6, 0xEA, 0x2A, 0xFC, 0x94, 0x9E, 0x4F, 0xD4,
+    0xAE, 0x4A, 0xFD, 0x30, 0x77, 0x49, 0xDA, 0x72, 0xAD, 0x97, 0x2E, 0x72, 0x9D, 0xA7, 0x2A, 0xD9,
+    0x72, 0xE7, 0x29, 0xE7, 0x2A, 0xD9, 0x72, 0xE7, 0x29, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x72, 0xE7,
+    0x2A, 0xDA, 0x72, 0xE9, 0x72, 0xE7, 0x29, 0xE7, 0x2F, 0xFF, 0xC9, 0x0F, 0xFF, 0xC0, 0x9F, 0xFF,
+    0xA0, 0xAF, 0xFF, 0x90, 0x77, 0x77, 0x9F, 0x97, 0x0A, 0xE9, 0x5A, 0xF9, 0x79, 0xF9, 0x5F, 0xCA,
+    0x7F, 0xC6, 0xFC, 0xA6, 0xAF, 0xC5, 0xAF, 0xD5, 0x9F, 0xCA, 0x5F, 0xE5, 0xFD, 0xA5, 0xDA, 0xF4,
+    0xAF, 0xD9, 0x4A, 0xD9, 0xF9, 0x29, 0xE9, 0xE5, 0xE0, 0xF9, 0x2E, 0xAA, 0xE5, 0xE0, 0xAE, 0xA1,
+    0xAE, 0x0F, 0x4A, 0xE0, 0x9E, 0xA0, 0x9E, 0x90, 0xEA, 0x4E, 0xA0, 0x9F, 0x0E, 0xA0, 0xAE, 0x94,
+    0xE9, 0x1F, 0xAE, 0x1F, 0x49, 0xE2, 0xFE, 0x91, 0xF4, 0xF2, 0xFE, 0x1A, 0xF4, 0xF2, 0xFD, 0x2F,
+    0xA3, 0x9E, 0xA2, 0xAF, 0xA2, 0xF9, 0x3F, 0x92, 0xAF, 0x2A, 0xF4, 0xF3, 0x9E, 0x3F, 0xC3, 0x9F,
+    0x72, 0x9F, 0xC3, 0xAE, 0xA7, 0x2A, 0xFA, 0x30, 0x77, 0x76, 0x99, 0x99, 0x70, 0xE7, 0xF7, 0x9D,
+    0xA6, 0x9F, 0x7E, 0x96, 0xFC, 0x96, 0xE7, 0xFC, 0x95, 0xAD, 0xA6, 0x9F, 0xCA, 0x5E, 0x96, 0xFE,
+    0x5E, 0x7E, 0x9E, 0x4A, 0xE6, 0xAE, 0x0E, 0x93, 0xE9, 0x6E, 0xA0, 0xEA, 0x29, 0xE7, 0xE9, 0x0A,
+    0xDA, 0x2A, 0xE6, 0xAE, 0x19, 0xE2, 0xE9, 0x6F, 0x19, 0xE1, 0x9E, 0x69, 0xEA, 0x2E, 0x90, 0xAE,
+    0x6A, 0xE9, 0x2E, 0xA0, 0xE9, 0x6F, 0x3A, 0xDA, 0x9E, 0x69, 0xF3, 0x9E, 0xAE, 0x6A, 0xEA, 0x4F,
+    0xDA, 0x6F, 0x94, 0xFD, 0x69, 0xF5, 0xFD, 0x6A, 0xF5, 0xAF, 0xA6, 0x71, 0x9A, 0xFC, 0xA7, 0x5A,
+    0xFF, 0xDA, 0x71, 0x9F, 0xC9, 0x99, 0xAF, 0xA7, 0x9F, 0x95, 0xF6, 0x9E, 0xA7, 0x9E, 0x95, 0xF7,
+    0x1E, 0xA4, 0xAE, 0x72, 0xEA, 0x4E, 0x97, 0x2A, 0xDA, 0x39, 0xE7, 0x3A, 0xD9, 0x3E, 0x97, 0x3E,
+    0x4E, 0x74, 0xE3, 0x9D, 0xA7, 0x39, 0xDA, 0x3A, 0xDA, 0x73, 0xE9, 0x3A, 0xDA, 0x72, 0xAE, 0x4A,
+    0xE9, 0x70, 0xF9, 0x4A, 0xFC, 0x99, 0x99, 0x9A, 0xFD, 0x59, 0xFF, 0xFF, 0x96, 0xFF, 0xFE, 0xA7,
+    0xAF, 0xFF, 0xCA, 0x71, 0xAF, 0xFE, 0x97, 0x4A, 0xFD, 0xA9, 0x77, 0x77, 0x10, 0x6F, 0xFA, 0x71,
+    0xAF, 0xFD, 0x97, 0xE9, 0x99, 0x99, 0xF7, 0xDA, 0x59, 0xD9, 0x59, 0xD9, 0x6D, 0x95, 0xE6, 0xAD,
+    0x6D, 0xA6, 0xE5, 0x9D, 0x94, 0xAE, 0x95, 0xFF, 0xFA, 0x6F, 0xFE, 0xA6, 0x9F, 0xFA, 0x97, 0x0E,
+    0xA7, 0x7E, 0x97, 0x69, 0xE7, 0x7F, 0x77, 0xEA, 0x76, 0x9E, 0x97, 0x6A, 0xE9, 0x76, 0xF7, 0x69,
+    0xF7, 0x6A, 0xEA, 0x76, 0x77, 0x77, 0x29, 0xFD, 0xA9, 0x74, 0x9F, 0xFD, 0xA7, 0x2F, 0xA3, 0xAE,
+    0x97, 0x0E, 0xA6, 0x9E, 0x7A, 0xDA, 0x70, 0xAD, 0x95, 0xAE, 0x71, 0x9D, 0xA4, 0x9E, 0x73, 0xDA,
+    0x4E, 0x97, 0x29, 0xDA, 0x39, 0xE7, 0x39, 0xDA, 0x3A, 0xDA, 0x73, 0xAD, 0x93, 0xE7, 0x4E, 0x4E,
+    0x74, 0xE3, 0x9D, 0xA7, 0x3A, 0xD9, 0x3A, 0xDA, 0x73, 0xE4, 0xAE, 0x5C, 0x92, 0xEA, 0x4A, 0xE9,
+    0x3F, 0xFC, 0x5A, 0xFF, 0xFF, 0x95, 0x9F, 0xFF, 0xE9, 0x7F, 0xFF, 0xDA, 0x71, 0xFF, 0xFA, 0x73,
+    0x9A, 0xFF, 0xD7, 0x71, 0xAF, 0xCA, 0x77, 0x1F, 0xD9, 0x77, 0x0A, 0xFD, 0x77, 0x19, 0x99, 0x99,
+    0x94, 0x69, 0x99, 0x99, 0x75, 0xFF, 0x97, 0x0A, 0xFF, 0xCA, 0x7D, 0x5E, 0x7D, 0x59, 0xD9, 0x5A,
+    0xCA, 0x6D, 0x95, 0xD9, 0x59, 0xD6, 0xD5, 0x9E, 0x59, 0xD4, 0xAE, 0x95, 0xEA, 0xAA, 0xFC, 0xA6,
+    0xFF, 0xD9, 0x69, 0xFF, 0xC7, 0x0F, 0xFE, 0x7E, 0xA3, 0xEA, 0x59, 0xE5, 0xE5, 0xF5, 0xE5, 0xEA,
+    0x49, 0xE4, 0x9E, 0x94, 0xF4, 0xAE, 0x94, 0xF4, 0xF4, 0x9F, 0x39, 0xF4, 0xAF, 0x3A, 0xEA, 0x4F,
+    0xC3, 0x72, 0x9A, 0xFD, 0xA9, 0x71, 0xAF, 0xFD, 0x97, 0x0A, 0xFF, 0xE7, 0x0A, 0xFA, 0x94, 0x97,
+    0x0E, 0xA7, 0x70, 0x9D, 0xA7, 0x71, 0xE7, 0x72, 0xE7, 0x72, 0xFA, 0x97, 0x7A, 0xFE, 0xA7, 0x5A,
+    0xFF, 0xC7, 0x49, 0xAF, 0xFA, 0x75, 0x99, 0xFD, 0xA7, 0x79, 0xFC, 0x77, 0x0F, 0xC9, 0x76, 0xAF,
+    0xC9, 0x49, 0x79, 0xFD, 0x4A, 0xFF, 0xFE, 0x93, 0xAF, 0xFF, 0xEA, 0x3A, 0xFF, 0xFE, 0xA3, 0x9F,
+    0xFF, 0xDA, 0x96, 0xAF, 0xFC, 0xA9, 0x77, 0x75, 0x09, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xFC, 0x1F,
+    0xDA, 0xEA, 0xAA, 0xFA, 0x70, 0xE7, 0x70, 0xDA, 0x77, 0xAD, 0x97, 0x7E, 0x97, 0x7E, 0x77, 0x9E,
+    0x77, 0xEA, 0x77, 0xE9, 0x76, 0x9E, 0x77, 0xAE, 0x77, 0xEA, 0x76, 0x9E, 0x97, 0x6A, 0xE7, 0x7F,
+    0x76, 0x9E, 0xA7, 0x6A, 0xE9, 0x76, 0xF7, 0x7F, 0x74, 0x59, 0x99, 0x71, 0x99, 0x95, 0x9E, 0xA7,
+    0xF9, 0x4A, 0xE9, 0x7F, 0x5F, 0x70, 0xF5, 0xEA, 0x79, 0xE9, 0x49, 0xE9, 0x7A, 0xE5, 0xAE, 0x70,
+    0xF5, 0xF7, 0x0E, 0xA5, 0xEA, 0x79, 0xE5, 0x9E, 0x70, 0xAE, 0x59, 0xE7, 0x0E, 0xA5, 0xAD, 0xA7,
+    0x0E, 0x95, 0xE9, 0x79, 0xE6, 0xE7, 0x0A, 0xDA, 0x59, 0xE7, 0x0E, 0x95, 0xAE, 0x7A, 0xE6, 0xF9,
+    0x5A, 0xEA, 0x6F, 0xDA, 0xAA, 0xFD, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xD7, 0x09, 0xFF, 0xF9, 0x71,
+    0x9A, 0xFF, 0xA7, 0x77, 0x70, 0x77, 0x5E, 0x73, 0x9E, 0x1E, 0x73, 0xE2, 0xE9, 0x71, 0xAD, 0xA2,
+    0xE9, 0x70, 0x9E, 0x3E, 0x97, 0x0E, 0x93, 0xEA, 0x7F, 0x4E, 0xA6, 0x9E, 0x94, 0xF6, 0xEA, 0x5F,
+    0x5F, 0x6A, 0xE4, 0x9E, 0x96, 0xAE, 0x4F, 0x7A, 0xE3, 0xF9, 0x7A, 0xE9, 0x19, 0xEA, 0x70, 0xAE,
+    0x91, 0xF7, 0x1A, 0xEA, 0x0F, 0x97, 0x19, 0xFF, 0xC7, 0x29, 0xFF, 0x97, 0x29, 0xFE, 0xA7, 0x39,
+    0xFE, 0x74, 0x9F, 0xD9, 0x75, 0xFD, 0x74, 0x1E, 0x77, 0x2A, 0xDA, 0x09, 0xE7, 0x72, 0xE1, 0x9E,
+    0x77, 0x1E, 0xA1, 0x9E, 0x77, 0x09, 0xE2, 0x9E, 0x77, 0x0E, 0xA2, 0x9E, 0x77, 0x9E, 0x3A, 0xE5,
+    0xAD, 0xA5, 0xE9, 0x3A, 0xE4, 0x9E, 0xA4, 0x9E, 0x4A, 0xE4, 0xFC, 0x4E, 0x94, 0xAE, 0x3F, 0xD3,
+    0xAE, 0x5A, 0xDA, 0x2F, 0xE9, 0x2E, 0x95, 0xEA, 0x1A, 0xE9, 0xEA, 0x1A, 0xE6, 0xEA, 0x09, 0xF0,
+    0xF1, 0xE9, 0x6E, 0xA0, 0xF1, 0xF0, 0xAE, 0x7E, 0xAF, 0x91, 0xAE, 0x9E, 0x97, 0xFF, 0x2A, 0xFE,
+    0x70, 0xFE, 0x3A, 0xFD, 0x97, 0x0F, 0xD9, 0x39, 0xFD, 0x71, 0xFC, 0xA4, 0x9F, 0xC9, 0x71, 0xFC,
+    0x6F, 0xC7, 0x19, 0xF9, 0x6F, 0x97, 0x10, 0x77, 0x76, 0xE7, 0x19, 0xD9, 0x6A, 0xD9, 0x79, 0xD9,
+    0x70, 0xE6, 0x9D, 0xA7, 0x1E, 0x94, 0x9D, 0xA7, 0x2A, 0xDA, 0x39, 0xDA, 0x74, 0xE2, 0x9E, 0x75,
+    0xEA, 0x09, 0xE7, 0x69, 0xEA, 0xE7, 0x70, 0xFD, 0x77, 0x1F, 0xC9, 0x77, 0x1A, 0xEA, 0x77, 0x19,
+    0xFC, 0x77, 0x09, 0xFD, 0x77, 0x9F, 0xEA, 0x75, 0x9E, 0xA0, 0xF7, 0x49, 0xF1, 0xAE, 0xA7, 0x29,
+    0xF2, 0x9F, 0x71, 0x9F, 0x4F, 0x97, 0x9F, 0x5A, 0xF6, 0x9F, 0x95, 0x9F, 0x94, 0x9F, 0x97, 0xFC,
+    0x40, 0x0E, 0x71, 0xAD, 0x90, 0xE9, 0x79, 0xDA, 0x1A, 0xDA, 0x69, 0xE2, 0x9E, 0x6E, 0x39, 0xE5,
+    0xE9, 0x4E, 0x93, 0xEA, 0x5F, 0x2A, 0xE6, 0xAE, 0x19, 0xE7, 0x9E, 0x99, 0xE9, 0x70, 0xFE, 0xA7,
+    0x1F, 0xE7, 0x2F, 0xD7, 0x3A, 0xF9, 0x73, 0x9E, 0xA7, 0x4A, 0xE7, 0x5F, 0x74, 0xAE, 0xA7, 0x4F,
+    0x97, 0x3A, 0xF7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0x7F, 0xFF, 0xF7, 0x0F, 0xFF, 0xEA, 0x70, 0xAF,
+    0xFF, 0xD7, 0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC7, 0x72, 0xAF, 0x77, 0x2F, 0xC7, 0x71, 0x9F,
+    0xC7, 0x71, 0xAF, 0xA7, 0x71, 0xFC, 0xA7, 0x70, 0x9F, 0xC9, 0x77, 0x09, 0xFC, 0x97, 0x70, 0xAF,
+    0xC7, 0x71, 0xFD, 0x77, 0x09, 0xFC, 0xA7, 0x70, 0xAF, 0xCA, 0x77, 0x0A, 0xFC, 0x97, 0x70, 0xFD,
+    0x97, 0x70, 0xFF, 0xFF, 0xCA, 0x6F, 0xFF, 0xFC, 0xA5, 0x9F, 0xFF, 0xFD, 0x5F, 0xFF, 0xFD, 0xA5,
+    0x73, 0x99, 0x99, 0x99, 0x72, 0xAF, 0xCA, 0x72, 0xFD, 0x97, 0x19, 0xD9, 0x75, 0xAD, 0x76, 0xE7,
+    0x6D, 0xA7, 0x5A, 0xD7, 0x6E, 0x76, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xDA, 0x75, 0x9D, 0x97,
+    0x5E, 0x76, 0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD7, 0x6D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x76, 0xE7,
+    0x59, 0xD9, 0x75, 0xAD, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x76, 0xE7, 0x6D, 0xA7, 0x5A, 0xD9,
+    0x75, 0xE7, 0x6D, 0xA7, 0x59, 0xFD, 0x97, 0x1F, 0xE7, 0x2F, 0xDA, 0x71, 0x09, 0x2C, 0x19, 0xC1,
+    0xAC, 0x1A, 0xC1, 0xAC, 0x1A, 0xC9, 0x0A, 0xC9, 0x0A, 0xCA, 0x0A, 0xCA, 0x0A, 0xCA, 0x09, 0xD0,
+    0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x99, 0xD9, 0x9D, 0xA0, 0xDA, 0x0D, 0x1C, 0x91, 0xA5,
+    0x09, 0x99, 0x99, 0x97, 0x3F, 0xD9, 0x72, 0xAF, 0xCA, 0x76, 0xAD, 0x76, 0x9D, 0x97, 0x6D, 0xA7,
+    0x6E, 0x76, 0x9D, 0x97, 0x6D, 0xA7, 0x6E, 0x76, 0xAD, 0x97, 0x6D, 0xA7, 0x6E, 0x76, 0xAD, 0x77,
+    0xDA, 0x76, 0xE7, 0x6A, 0xD7, 0x69, 0xD9, 0x76, 0xE7, 0x6A, 0xD7, 0x69, 0xD9, 0x76, 0xDA, 0x76,
+    0xAD, 0x76, 0x9D, 0x97, 0x6D, 0xA7, 0x6E, 0x76, 0x9D, 0x97, 0x6D, 0xA7, 0x6E, 0x76, 0x9D, 0x97,
+    0x6D, 0xA7, 0x6E, 0x72, 0xAF, 0xD7, 0x3F, 0xDA, 0x72, 0xFE, 0x2C, 0xA6, 0x9D, 0xA5, 0xDA, 0xCA,
+    0x3D, 0x91, 0xD1, 0xAC, 0x49, 0xC9, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x5A, 0xFF, 0xFE, 0x1F,
+    0xFF, 0xEA, 0x77, 0x20, 0x0D, 0x93, 0x9D, 0x93, 0xAD, 0x93, 0x9A, 0xA9, 0x77, 0x6A, 0xEA, 0x0A,
+    0xC5, 0x9F, 0xFC, 0x49, 0xDA, 0x2A, 0xE4, 0xD9, 0x4D, 0xA3, 0xD9, 0x5D, 0xA2, 0x9D, 0x6D, 0x92,
+    0xD6, 0x9D, 0x3D, 0x6E, 0x29, 0xCA, 0x5A, 0xE2, 0xAD, 0x4F, 0xA2, 0xAF, 0xFE, 0xA2, 0x9F, 0xFE,
+    0x93, 0xFF, 0x9D, 0x5A, 0xFA, 0x09, 0xD2, 0x39, 0x99, 0x72, 0x9E, 0x72, 0xAD, 0xA7, 0x2A, 0xD9,
+    0x72, 0xE7, 0x3E, 0x72, 0x9D, 0xA7, 0x2A, 0xD9, 0x72, 0xAD, 0x1A, 0xDA, 0x94, 0xEA, 0xFD, 0x93,
+    0xFC, 0xA9, 0x9A, 0xD9, 0x19, 0xF4, 0xAC, 0xA1, 0xAE, 0x59, 0xD1, 0xEA, 0x59, 0xD1, 0xE6, 0xAD,
+    0x1E, 0x6D, 0xA0, 0x9D, 0xA5, 0xAD, 0x1A, 0xE4, 0xEA, 0x1A, 0xFA, 0xAF, 0xC2, 0xAF, 0xFD, 0x39,
+    0xFF, 0xC5, 0x9F, 0xD9, 0x71, 0x99, 0x70, 0x77, 0x29, 0xAF, 0xA4, 0xAF, 0xDA, 0x3F, 0x91, 0x93,
+    0xAD, 0xA7, 0x0D, 0xA7, 0x09, 0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x1D, 0x97, 0x09, 0xDA, 0x70, 0x9E,
+    0xA7, 0x0F, 0xF4, 0x9F, 0xF5, 0xAF, 0xCA, 0x76, 0x77, 0x0D, 0x77, 0x0A, 0xD7, 0x70, 0xD9, 0x77,
+    0x0D, 0x77, 0x0A, 0xD7, 0x70, 0xDA, 0x71, 0x9A, 0xA9, 0x2D, 0x71, 0xFD, 0x0A, 0xD7, 0x9F, 0xEA,
+    0xDA, 0x69, 0xDA, 0x2A, 0xF6, 0x9D, 0x94, 0xF6, 0xD9, 0x5E, 0xA5, 0x9D, 0x6E, 0x95, 0xD9, 0x59,
+    0xE6, 0xD9, 0x5A, 0xDA, 0x59, 0xD9, 0x49, 0xE9, 0x59, 0xE9, 0x2A, 0xF6, 0x9F, 0xFF, 0x7F, 0xFF,
+    0x70, 0xFF, 0xDA, 0x71, 0xAF, 0x90, 0xD9, 0x77, 0x71, 0x7A, 0xEA, 0x70, 0xAE, 0xAE, 0x6E, 0x93,
+    0xCA, 0x4A, 0xCA, 0x5A, 0xC3, 0xAC, 0xA5, 0x9D, 0x3D, 0xAA, 0xAF, 0xE2, 0xAF, 0xFF, 0x2D, 0xA9,
+    0x99, 0x97, 0x0D, 0x74, 0x9D, 0x97, 0x39, 0xE7, 0x4F, 0xA9, 0x99, 0x9A, 0xC9, 0x3A, 0xFF, 0xD5,
+    0xAF, 0xFC, 0x69, 0xAF, 0xA9, 0x30, 0x7A, 0xE7, 0xFC, 0x6D, 0xA7, 0x09, 0xD7, 0x1A, 0xC9, 0x71,
+    0xD7, 0x9F, 0xEA, 0x3A, 0xFE, 0x95, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xE7, 0x1D, 0xA7, 0x09,
+    0xD9, 0x70, 0xAD, 0x97, 0x0E, 0x71, 0xE7, 0x0A, 0xDA, 0x70, 0xE9, 0x70, 0xE7, 0x00, 0x7A, 0xE2,
+    0xAA, 0x6A, 0xFD, 0x9A, 0xD5, 0xAD, 0xAA, 0xAF, 0xCA, 0x49, 0xD3, 0x9F, 0x94, 0xD9, 0x4F, 0x49,
+    0xCA, 0x5E, 0xA4, 0xD6, 0xE9, 0x4D, 0x59, 0xE5, 0xCA, 0x5E, 0xA4, 0x9D, 0x39, 0xF9, 0x5F, 0xFE,
+    0x6F, 0xFD, 0xA6, 0x9F, 0xFC, 0x97, 0x9E, 0xA9, 0xAD, 0x75, 0x9D, 0xA7, 0x49, 0xE6, 0x9A, 0x29,
+    0xFA, 0x6F, 0xFD, 0x69, 0xFF, 0xC7, 0x9A, 0xFD, 0xA7, 0x39, 0x99, 0x73, 0x6D, 0x97, 0x4D, 0x74,
+    0xAC, 0xA7, 0x4D, 0x97, 0x4D, 0x74, 0xAC, 0xA7, 0x4D, 0x97, 0x4D, 0x19, 0xA9, 0x96, 0xAD, 0xAF,
+    0xD5, 0xFF, 0xDA, 0x39, 0xF9, 0x2E, 0x3A, 0xE4, 0x9D, 0x3E, 0x59, 0xCA, 0x29, 0xDA, 0x5A, 0xCA,
+    0x2A, 0xD6, 0xD9, 0x2E, 0x6D, 0x29, 0xDA, 0x5A, 0xD2, 0xAD, 0x95, 0xDA, 0x2E, 0x59, 0xDA, 0x19,
+    0xE5, 0xE9, 0x1A, 0xE5, 0xE2, 0x5E, 0x59, 0xE5, 0xEA, 0x49, 0xEA, 0x77, 0x77, 0x74, 0xAC, 0x96,
+    0xD7, 0xD6, 0x9C, 0xA6, 0xAC, 0x96, 0xD6, 0x9D, 0x6A, 0xCA, 0x6D, 0x95, 0x9D, 0x6A, 0xD6, 0xE5,
+    0x9D, 0xA5, 0xAD, 0x95, 0x74, 0xE7, 0x39, 0xE7, 0x3E, 0xA7, 0x29, 0xEA, 0x77, 0x77, 0x77, 0x72,
+    0x9D, 0x74, 0xAC, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xCA, 0x74, 0xD9, 0x74, 0xD7, 0x49, 0xCA,
+    0x74, 0xD9, 0x74, 0xD7, 0x49, 0xD7, 0x4A, 0xC9, 0x74, 0xD7, 0x49, 0xD7, 0x4A, 0xCA, 0x73, 0x9D,
+    0x73, 0x9E, 0x70, 0x9A, 0xF9, 0x7A, 0xFC, 0xA7, 0x0F, 0xA9, 0x77, 0x70, 0x5A, 0xCA, 0x71, 0xDA,
+    0x70, 0x9D, 0x71, 0xAD, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0xAD, 0x71, 0xDA, 0x1A, 0xD9, 0x3D, 0x90,
+    0xAD, 0x93, 0xAD, 0x0A, 0xD9, 0x4D, 0xAA, 0xD9, 0x5F, 0xC6, 0x9F, 0x96, 0xFD, 0x6D, 0xAE, 0xA4,
+    0x9D, 0x9A, 0xE9, 0x3E, 0x1F, 0x3E, 0x1A, 0xF1, 0x9D, 0xA2, 0xFA, 0x0A, 0xD9, 0x2A, 0xF9, 0x77,
+    0xAD, 0x6D, 0x95, 0x9D, 0x6A, 0xD6, 0xD9, 0x59, 0xD6, 0xDA, 0x6D, 0x95, 0x9D, 0x6D, 0xA6, 0xD9,
+    0x59, 0xD6, 0xE6, 0xDA, 0x59, 0xD9, 0x5A, 0xD6, 0xE6, 0xEA, 0xA9, 0x29, 0xFC, 0x92, 0xAF, 0xC9,
+    0x20, 0x4A, 0xC9, 0x0A, 0xEA, 0x3A, 0xE9, 0x6D, 0x9F, 0xE1, 0xFD, 0x94, 0x9F, 0xA9, 0x9E, 0x9E,
+    0xAA, 0xDA, 0x4F, 0x4F, 0x92, 0x9C, 0xA3, 0x9E, 0x5E, 0x93, 0x9C, 0xA3, 0xAD, 0x95, 0xE4, 0xAC,
+    0xA3, 0xE5, 0x9D, 0x94, 0xD9, 0x29, 0xDA, 0x5E, 0x5D, 0x3E, 0x59, 0xD9, 0x4A, 0xD3, 0xE5, 0xAD,
+    0x5E, 0x2A, 0xDA, 0x5D, 0xA4, 0x9D, 0xA2, 0xE5, 0xAD, 0x94, 0xAD, 0x91, 0x9E, 0x5E, 0x5E, 0x2A,
+    0xD9, 0x4A, 0xD9, 0x49, 0xE2, 0x39, 0xC9, 0x0A, 0xAD, 0xA6, 0xAF, 0xFC, 0x5F, 0xA9, 0x09, 0xD9,
+    0x39, 0xE4, 0xDA, 0x3A, 0xD9, 0x4D, 0xA3, 0xE5, 0xD9, 0x29, 0xD9, 0x49, 0xD9, 0x2A, 0xD5, 0xAD,
+    0x3E, 0x5E, 0x29, 0xE4, 0x9D, 0xA2, 0xAD, 0xA4, 0xAD, 0xA2, 0xE9, 0x4E, 0x91, 0x9E, 0x5E, 0x2A,
+    0xE4, 0x9E, 0x20, 0x6A, 0xAE, 0xA7, 0x09, 0xFF, 0x6A, 0xE9, 0x99, 0x9E, 0x49, 0xD9, 0x49, 0xD4,
+    0xDA, 0x6D, 0x92, 0x9D, 0x7D, 0x92, 0xDA, 0x69, 0xD3, 0xD9, 0x6E, 0x29, 0xD6, 0x9D, 0x92, 0x9D,
+    0xA4, 0x9E, 0x4F, 0xCA, 0xFC, 0x94, 0xFF, 0xD9, 0x6F, 0xF9, 0x70, 0xAE, 0xA9, 0x60, 0x79, 0x2A,
+    0xAC, 0xA9, 0x71, 0xAC, 0xA9, 0xFD, 0xA7, 0x0F, 0xD9, 0x09, 0xD9, 0x7F, 0x93, 0x9C, 0xA7, 0xE9,
+    0x49, 0xCA, 0x69, 0xDA, 0x59, 0xCA, 0x6A, 0xD9, 0x5A, 0xCA, 0x6E, 0x6D, 0x96, 0xE5, 0x9D, 0x6A,
+    0xEA, 0x4D, 0xA6, 0xFD, 0xA9, 0xAE, 0x69, 0xFF, 0xE9, 0x6E, 0xAF, 0xE9, 0x69, 0xD9, 0x0A, 0xFC,
+    0x70, 0xE3, 0x99, 0x71, 0x9D, 0xA7, 0x7E, 0x77, 0x9E, 0x77, 0xE9, 0x77, 0xE7, 0x77, 0x73, 0x71,
+    0x97, 0x49, 0xAF, 0x90, 0xAD, 0x5A, 0xEA, 0xE0, 0xDA, 0x4A, 0xD9, 0x29, 0xF4, 0xAD, 0x5F, 0x4D,
+    0x95, 0xE9, 0x3A, 0xD5, 0x9E, 0x4D, 0x95, 0xAD, 0xA4, 0xD6, 0xE9, 0x39, 0xD5, 0xAE, 0x49, 0xD4,
+    0xAE, 0xA5, 0xEA, 0xAA, 0xFC, 0x95, 0xFF, 0xE7, 0xFE, 0xAC, 0xA7, 0x0A, 0xEA, 0x0A, 0xC9, 0x76,
+    0xD7, 0x69, 0xD9, 0xAC, 0x97, 0x2F, 0xD7, 0x3F, 0xC9, 0x72, 0xAC, 0xA9, 0x77, 0x70, 0x4D, 0x1A,
+    0xAC, 0x49, 0xDA, 0xF4, 0xAF, 0xE4, 0xF9, 0x69, 0xE7, 0x0A, 0xD9, 0x70, 0xE7, 0x09, 0xE7, 0x0A,
+    0xD9, 0x70, 0xE9, 0x79, 0xE7, 0x0F, 0x79, 0xF7, 0xAE, 0xA7, 0x6A, 0xFA, 0xA5, 0xAF, 0xE9, 0x4A,
+    0xD9, 0x72, 0xD7, 0x4D, 0x74, 0xEA, 0x72, 0x9F, 0xC9, 0x71, 0xAF, 0xC7, 0x3A, 0xDA, 0x72, 0x9D,
+    0xA3, 0x9D, 0xAA, 0xAA, 0xE9, 0x2A, 0xFF, 0xD2, 0x9F, 0xFD, 0x93, 0x9A, 0xFD, 0xA4, 0x77, 0x0A,
+    0xC7, 0xDA, 0x69, 0xD9, 0x6A, 0xD4, 0x9A, 0xAE, 0xAA, 0xA9, 0x9F, 0xFC, 0x92, 0xAD, 0x7E, 0x69,
+    0xD9, 0x6A, 0xD7, 0xE6, 0x9D, 0xA6, 0xAD, 0x96, 0xE7, 0xE9, 0x99, 0x3A, 0xFD, 0x92, 0xFE, 0x92,
+    0xAF, 0xD9, 0x20, 0x2D, 0x6D, 0xA1, 0x9D, 0x6D, 0x91, 0xAD, 0x5A, 0xD2, 0xDA, 0x5E, 0x2D, 0x95,
+    0xDA, 0x19, 0xD5, 0x9D, 0x91, 0x9D, 0x5A, 0xD2, 0xAD, 0x5E, 0x2D, 0xA4, 0xAD, 0xA2, 0xE3, 0xAE,
+    0xA2, 0xFF, 0xE9, 0x2F, 0xFE, 0x3F, 0xFE, 0x39, 0xFD, 0x9D, 0xA5, 0x99, 0x97, 0x00, 0x0A, 0xA7,
+    0x1A, 0xA9, 0x0D, 0x97, 0xAD, 0x1D, 0xA6, 0x9D, 0x2A, 0xD6, 0xD9, 0x29, 0xD5, 0xDA, 0x39, 0xDA,
+    0x3A, 0xD5, 0xE2, 0x9D, 0x6E, 0x2D, 0xA6, 0xAD, 0x90, 0xE7, 0xAD, 0xAA, 0xD7, 0x09, 0xFC, 0x97,
+    0x09, 0xFC, 0x71, 0xAF, 0xA7, 0x1A, 0xF7, 0x00, 0x0A, 0xAA, 0x73, 0xAA, 0xA1, 0xE7, 0x29, 0xDA,
+    0x1D, 0xA7, 0x2E, 0x2D, 0xA7, 0x19, 0xD9, 0x2D, 0xA3, 0xCA, 0x3E, 0x3D, 0xA2, 0xE9, 0x19, 0xD9,
+    0x29, 0xDA, 0x1F, 0xA1, 0xE3, 0x9D, 0xA0, 0xFD, 0x0A, 0xD9, 0x39, 0xDA, 0xFE, 0xAE, 0x49, 0xFF,
+    0xFC, 0x94, 0x9F, 0xD9, 0xFC, 0xA5, 0x9F, 0xC1, 0xFC, 0x69, 0xF2, 0xAE, 0xA6, 0x9E, 0x39, 0xE7,
+    0x5E, 0x49, 0xD9, 0x5E, 0x39, 0xD9, 0x69, 0xDA, 0x19, 0xD9, 0x70, 0xE0, 0xAD, 0x97, 0x1A, 0xFC,
+    0x97, 0x29, 0xF9, 0x74, 0xEA, 0x74, 0xFC, 0x73, 0xFD, 0x97, 0x1E, 0x9A, 0xDA, 0x70, 0xE9, 0x09,
+    0xE6, 0x9E, 0x92, 0xEA, 0x49, 0xE9, 0x3A, 0xE3, 0x9E, 0x95, 0xEA, 0x20, 0x4D, 0x96, 0xAD, 0x5D,
+    0xA6, 0xD9, 0x5A, 0xD5, 0xAD, 0x69, 0xD9, 0x39, 0xD9, 0x7D, 0xA3, 0xE7, 0x0E, 0x29, 0xD9, 0x70,
+    0xAD, 0x91, 0xE7, 0x19, 0xDA, 0x0A, 0xD9, 0x72, 0xE0, 0xE7, 0x3F, 0xD9, 0x73, 0xAF, 0xC7, 0x49,
+    0xF9, 0x74, 0x9F, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0xF7, 0x4A, 0xF9, 0x71, 0xFE, 0xA7, 0x19, 0xFD,
+    0x97, 0x2A, 0xF9, 0x77, 0x77, 0x5F, 0xFD, 0x59, 0xFF, 0xD5, 0x99, 0x99, 0x99, 0x9E, 0xA7, 0x3E,
+    0xA7, 0x29, 0xE9, 0x72, 0x9E, 0x73, 0xAE, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x2A, 0xE9, 0x72, 0xF7,
+    0x3F, 0xFE, 0x5F, 0xFE, 0x93, 0xAF, 0xFE, 0xA3, 0x70, 0x9A, 0xAA, 0xA7, 0x9F, 0xCA, 0x7E, 0x97,
+    0x1A, 0xD9, 0x72, 0xE7, 0x3D, 0xA7, 0x2A, 0xD9, 0x72, 0xE7, 0x29, 0xDA, 0x72, 0xE7, 0x09, 0xF9,
+    0x70, 0xE9, 0x72, 0xF7, 0x39, 0xD9, 0x73, 0xD9, 0x72, 0x9D, 0x97, 0x2E, 0x73, 0xDA, 0x72, 0x9D,
+    0x97, 0x2A, 0xD7, 0x3F, 0xA9, 0x70, 0xAF, 0xC7, 0x1A, 0xF7, 0x76, 0x77, 0x0D, 0x7C, 0xA6, 0x9C,
+    0x96, 0xD7, 0xCA, 0x69, 0xC9, 0x6A, 0xC7, 0xD6, 0x9C, 0x96, 0xAC, 0x7D, 0x7C, 0xA6, 0x9C, 0x96,
+    0xD7, 0xCA, 0x69, 0xC9, 0x6A, 0xC7, 0xD6, 0x9C, 0x96, 0xAC, 0x7D, 0x60, 0x6A, 0xAA, 0xA9, 0x79,
+    0xFC, 0x72, 0xE9, 0x71, 0xAD, 0x97, 0x1A, 0xD7, 0x2E, 0x71, 0x9D, 0xA7, 0x1A, 0xD7, 0x2E, 0x72,
+    0xE7, 0x2F, 0xA7, 0x1A, 0xE7, 0x0A, 0xEA, 0x7E, 0x71, 0x9D, 0x97, 0x1E, 0x72, 0xDA, 0x71, 0xAD,
+    0x97, 0x1E, 0x71, 0x9D, 0xA6, 0x9A, 0xAE, 0x69, 0xFC, 0x7F, 0xA7, 0x76, 0x1D, 0xA2, 0xAA, 0x0D,
+    0x9C, 0x91, 0xC9, 0x9C, 0x90, 0xAC, 0x0A, 0xC0, 0xAC, 0x2E, 0xA6, 0x99, 0x10, 0x3F, 0xC4, 0xFA,
+    0x4F, 0x5F, 0x5E, 0x97, 0x77, 0x1E, 0x59, 0xE5, 0xAD, 0xA5, 0xAD, 0x95, 0xE6, 0xE5, 0x9D, 0xA5,
+    0x9D, 0x95, 0xAD, 0x6E, 0x6D, 0xA6, 0xD9, 0x59, 0xD6, 0xAD, 0x6D, 0xA6, 0xD9, 0x6D, 0x79, 0xA6,
+    0x71, 0x9A, 0x72, 0xD7, 0x2C, 0xA7, 0x19, 0xC9, 0x71, 0xAC, 0x79, 0xAF, 0xA4, 0xAF, 0xDA, 0x3E,
+    0xAD, 0x5A, 0xD9, 0x0D, 0x5D, 0xA1, 0xCA, 0x49, 0xD1, 0xAC, 0x5D, 0xA1, 0xD5, 0xD9, 0x1C, 0xA4,
+    0x9D, 0x90, 0x9C, 0x94, 0x9D, 0xA0, 0xD5, 0x9E, 0xAC, 0xA6, 0xFF, 0x49, 0xFF, 0x5A, 0xFC, 0xA6,
+    0xCA, 0x71, 0xAC, 0x72, 0x99, 0x60, 0x77, 0x77, 0x77, 0x9A, 0xEA, 0x97, 0x19, 0xFF, 0xA7, 0xFA,
+    0x91, 0x9D, 0x95, 0x9E, 0x6A, 0x6A, 0xD7, 0x7A, 0xC9, 0x77, 0xAC, 0x97, 0x7A, 0xC9, 0x77, 0xAC,
+    0xA7, 0x79, 0xCA, 0x77, 0x9C, 0xA7, 0x79, 0xD7, 0x5F, 0xFE, 0x69, 0xFF, 0xDA, 0x79, 0x9A, 0xD9,
+    0x99, 0x99, 0x72, 0xE7, 0x6A, 0xDA, 0x75, 0xF7, 0x39, 0xFA, 0x73, 0x9F, 0xAA, 0xAA, 0xA9, 0x96,
+    0xAF, 0xFF, 0xC9, 0x3F, 0xFF, 0xE3, 0x77, 0x29, 0xC5, 0xAC, 0x3A, 0xFD, 0xAE, 0x92, 0x9F, 0xFC,
+    0xA4, 0xDA, 0x2A, 0xCA, 0x4A, 0xD3, 0x9D, 0x4D, 0x93, 0xAD, 0x39, 0xD4, 0xDA, 0x39, 0xDA, 0x19,
+    0xE4, 0xAF, 0xFC, 0x3F, 0xFE, 0xA1, 0x9D, 0xA9, 0xEA, 0xAD, 0xA2, 0xA9, 0x6C, 0x97, 0x71, 0x3D,
+    0xA7, 0x0D, 0x93, 0x9D, 0x95, 0x9D, 0xA5, 0xE4, 0x9D, 0xA6, 0x9D, 0xA2, 0xAD, 0xA7, 0x0E, 0x90,
+    0xEA, 0x71, 0x9F, 0xDA, 0x73, 0xFC, 0xA7, 0x4A, 0xEA, 0x75, 0xAE, 0x72, 0xAF, 0xFC, 0xA7, 0xFF,
+    0xDA, 0x72, 0x9E, 0x76, 0xEA, 0x76, 0xE7, 0x69, 0xFD, 0x70, 0xFF, 0xD7, 0xAD, 0xAE, 0x97, 0x6E,
+    0x76, 0x9E, 0x76, 0xEA, 0x77, 0x75, 0x77, 0x0D, 0x7C, 0xA6, 0x9C, 0x96, 0xD7, 0xCA, 0x69, 0xC9,
+    0x6A, 0xC7, 0x97, 0x77, 0x75, 0x97, 0x9C, 0x96, 0xD7, 0xCA, 0x69, 0xC9, 0x6A, 0xC7, 0xD6, 0x9C,
+    0x96, 0xAC, 0x7D, 0x60, 0x73, 0xAE, 0xA7, 0x3A, 0xDA, 0xAA, 0xD7, 0x19, 0xC9, 0x4A, 0xA7, 0x0C,
+    0xA7, 0x70, 0xC9, 0x77, 0x9D, 0x97, 0x49, 0xFE, 0xA9, 0x79, 0xFF, 0xDA, 0x6D, 0xA9, 0x39, 0xAD,
+    0x94, 0xAC, 0xA7, 0xD9, 0x4D, 0x70, 0xD9, 0x4D, 0xA6, 0x9D, 0x5A, 0xFC, 0x99, 0x9A, 0xDA, 0x6A,
+    0xFF, 0xD7, 0x29, 0xFD, 0x75, 0xEA, 0x76, 0xF6, 0x9A, 0x99, 0x99, 0x9F, 0x95, 0x9F, 0xFD, 0xA5,
+    0x9F, 0xFD, 0xA7, 0xAF, 0xDA, 0x97, 0x77, 0x30, 0x75, 0xE3, 0xDA, 0x0A, 0xDA, 0x2A, 0xDA, 0x0E,
+    0xA2, 0xE9, 0x9E, 0x91, 0xAE, 0x90, 0x49, 0xAA, 0x5A, 0xA9, 0x1A, 0x92, 0xAA, 0xAC, 0x2A, 0x19,
+    0xD4, 0x99, 0x0C, 0xA9, 0x49, 0x90, 0xAC, 0x5A, 0x1A, 0xC9, 0x4A, 0x1A, 0x9D, 0x91, 0xC2, 0x9A,
+    0x2A, 0xC4, 0x9A, 0xCA, 0x93, 0x73, 0x9D, 0xAA, 0x29, 0xC9, 0x0D, 0x2C, 0x29, 0xC1, 0x9A, 0x2A,
+    0xA1, 0xA9, 0x2C, 0xA1, 0xC9, 0x1D, 0x91, 0xFD, 0x92, 0xE9, 0xC1, 0x79, 0x69, 0x59, 0xC9, 0x49,
+    0xC9, 0x4D, 0xA4, 0xAD, 0x39, 0xD9, 0x39, 0xDA, 0x3A, 0xD4, 0xAD, 0x4D, 0xA4, 0xAC, 0xA5, 0xE9,
+    0x3E, 0x59, 0xE3, 0xAE, 0x5A, 0xE3, 0xEA, 0x5E, 0x4E, 0x6C, 0x94, 0x9C, 0x96, 0x96, 0x93, 0x0E,
+    0xAA, 0xA9, 0x99, 0x3F, 0xFE, 0x19, 0x99, 0x99, 0x9A, 0xAD, 0xA7, 0x1D, 0x97, 0x09, 0xD7, 0x1A,
+    0xD7, 0x1E, 0x76, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFE, 0x09, 0xFF, 0xE0, 0x49, 0xAA,
+    0x5A, 0xC9, 0x1A, 0x92, 0xAC, 0xAA, 0x2A, 0x19, 0xAA, 0x1A, 0x19, 0x90, 0xC0, 0xA0, 0x92, 0x99,
+    0x0A, 0x9D, 0xA2, 0xC1, 0xAA, 0x90, 0xC1, 0x9C, 0x1A, 0xC0, 0x9C, 0x1C, 0x29, 0xC2, 0xAC, 0x49,
+    0xAC, 0xA9, 0x30, 0x29, 0x99, 0x99, 0xA1, 0xFF, 0x72, 0x77, 0x1A, 0xEA, 0x59, 0xFE, 0x39, 0xDA,
+    0x2D, 0x92, 0xD9, 0x39, 0xD1, 0xAD, 0x49, 0xD1, 0xDA, 0x4A, 0xCA, 0x1D, 0xA3, 0x9D, 0x91, 0xE9,
+    0x1A, 0xE2, 0xAF, 0xF4, 0xFD, 0xA6, 0x9A, 0xAA, 0x94, 0x71, 0x99, 0x75, 0xD7, 0x4A, 0xCA, 0x74,
+    0xD7, 0x09, 0x99, 0x9A, 0xD9, 0x99, 0x93, 0xAF, 0xFE, 0x70, 0xD7, 0x5D, 0x74, 0xAC, 0xA7, 0x4D,
+    0x77, 0x77, 0x72, 0x99, 0x99, 0x9A, 0xAA, 0x49, 0xFF, 0xD4, 0x99, 0x99, 0x72, 0x29, 0xE9, 0x39,
+    0x19, 0xC6, 0x9C, 0x6C, 0xA5, 0xD4, 0x9D, 0x4D, 0xA4, 0xAF, 0xA2, 0xAA, 0xAA, 0xA9, 0x10, 0x2E,
+    0xA6, 0x99, 0x59, 0x94, 0x9C, 0x3E, 0x6C, 0xA5, 0xAA, 0x49, 0xC9, 0x09, 0xFC, 0x19, 0xAC, 0xA9,
+    0x20, 0x3C, 0xA2, 0xD2, 0xAC, 0x91, 0x9C, 0xA2, 0xD2, 0x5D, 0x6D, 0xA4, 0x9D, 0x6D, 0x94, 0xAD,
+    0x5A, 0xD5, 0xDA, 0x5E, 0x5D, 0x95, 0xDA, 0x4A, 0xD5, 0x9D, 0x94, 0xE5, 0xAD, 0x49, 0xE5, 0xE4,
+    0xEA, 0x4A, 0xDA, 0x4F, 0x3A, 0xEA, 0x3A, 0xFF, 0xF9, 0x3F, 0xFF, 0xC3, 0x9C, 0x9F, 0xFE, 0x3A,
+    0xC0, 0x9F, 0xD9, 0xDA, 0x3C, 0xA2, 0x99, 0x97, 0x09, 0xC9, 0x76, 0x9A, 0x77, 0x77, 0x79, 0xAD,
+    0x91, 0x9C, 0x95, 0xFC, 0x2A, 0xC5, 0xAF, 0xC2, 0xD5, 0xFC, 0x92, 0xCA, 0x4A, 0xFC, 0x29, 0xC9,
+    0x4A, 0xFC, 0x2A, 0xC5, 0xAF, 0x92, 0xD6, 0xF3, 0xCA, 0x69, 0xE2, 0x9C, 0x96, 0xAD, 0x92, 0xAC,
+    0x7E, 0x3D, 0x6A, 0xE3, 0xCA, 0x6E, 0x92, 0x9C, 0x95, 0xAE, 0x3A, 0xC9, 0x5F, 0x3D, 0x59, 0xE9,
+    0x3D, 0x5F, 0x39, 0xCA, 0x49, 0xEA, 0x3A, 0xC9, 0x4F, 0x93, 0xD4, 0x9F, 0x4D, 0x40, 0x79, 0xD9,
+    0x1E, 0x90, 0x9E, 0x1F, 0x00, 0x2A, 0x4A, 0x49, 0xCA, 0x95, 0xA9, 0x4A, 0x91, 0x99, 0xD1, 0xAD,
+    0xA2, 0x70, 0xD9, 0x3C, 0x39, 0xC3, 0xAA, 0x3C, 0x92, 0x9C, 0x3A, 0xC1, 0xAF, 0xAA, 0xAA, 0xAA,
+    0x00, 0x29, 0xE3, 0xAC, 0x90, 0xAC, 0x2C, 0x3C, 0x1A, 0xA3, 0xC1, 0xC9, 0x29, 0xC1, 0xCA, 0x19,
+    0xC9, 0x1A, 0xFA, 0x3A, 0xD9, 0x20, 0x96, 0x97, 0x9C, 0x94, 0x9C, 0x96, 0xDA, 0x4A, 0xCA, 0x6A,
+    0xD9, 0x39, 0xD9, 0x6D, 0xA4, 0xDA, 0x6D, 0xA4, 0xAD, 0x5E, 0x39, 0xE4, 0xEA, 0x3E, 0x93, 0xAE,
+    0x3E, 0xA4, 0xE4, 0xE5, 0x9C, 0x59, 0xC7, 0x96, 0x93, 0x77, 0x79, 0xD9, 0x76, 0x9C, 0xAC, 0x77,
+    0x1A, 0xC7, 0x2A, 0x94, 0xCA, 0x71, 0xCA, 0x49, 0xC9, 0x70, 0xD5, 0xAC, 0x70, 0xAC, 0x6D, 0x7A,
+    0xC9, 0x59, 0xCA, 0x69, 0xC9, 0x6A, 0xC9, 0x59, 0xCA, 0x59, 0x9D, 0x99, 0x4D, 0x59, 0xFD, 0xA2,
+    0xD6, 0xAF, 0xD9, 0x1D, 0x39, 0xC9, 0x71, 0xAC, 0x92, 0x9D, 0x71, 0xAC, 0x92, 0x9E, 0x70, 0x9C,
+    0xA2, 0x9C, 0xAA, 0xA7, 0x9D, 0x29, 0xCA, 0x0C, 0xA6, 0x9D, 0x29, 0xCA, 0x09, 0xC9, 0x6D, 0x29,
+    0xD1, 0xAC, 0x99, 0x4D, 0x92, 0xAF, 0xEA, 0x3D, 0xA3, 0x9A, 0xAA, 0xAD, 0x93, 0xAC, 0xA7, 0x0A,
+    0xCA, 0x3A, 0xD7, 0x1D, 0x93, 0x99, 0x72, 0xD9, 0x20, 0x39, 0xAC, 0xA7, 0x70, 0x9E, 0x77, 0x3A,
+    0xC7, 0x29, 0x7C, 0xA7, 0x1A, 0xC6, 0x9C, 0x97, 0x0A, 0xC7, 0xAC, 0x70, 0xAC, 0x70, 0xD7, 0x9C,
+    0x97, 0x0C, 0xA6, 0x9C, 0xA7, 0x0A, 0xC9, 0x6C, 0xA7, 0x99, 0xD9, 0x94, 0xD1, 0x99, 0x39, 0xFD,
+    0xA2, 0xD9, 0xFC, 0xA1, 0xAF, 0xD9, 0x1D, 0x0A, 0xA9, 0x1A, 0xC9, 0x71, 0xAC, 0x96, 0xC9, 0x70,
+    0xAC, 0xA6, 0x9C, 0x97, 0x9C, 0xA7, 0xD7, 0x9D, 0x7D, 0x97, 0xD6, 0x9D, 0xA7, 0xD6, 0xAD, 0xA7,
+    0xD9, 0x4A, 0xE9, 0x7D, 0xA4, 0xAE, 0xA9, 0x99, 0x4A, 0xCA, 0x5F, 0xEA, 0x3A, 0xD5, 0x9F, 0xE9,
+    0x39, 0x97, 0x72, 0x77, 0x70, 0xFC, 0x97, 0x59, 0x92, 0x9C, 0x77, 0x3C, 0x70, 0xC9, 0x79, 0xC7,
+    0xCA, 0x49, 0x99, 0xAC, 0x7D, 0x49, 0xEA, 0x7A, 0xC7, 0x09, 0xD5, 0xAC, 0x72, 0xAC, 0x49, 0xC9,
+    0x72, 0xD3, 0x9C, 0xA7, 0x2A, 0xC9, 0x3C, 0xA6, 0xFE, 0x3D, 0x6A, 0xFC, 0xA3, 0xD3, 0x9C, 0x92,
+    0x99, 0x94, 0xD9, 0x29, 0xD7, 0x2A, 0xC9, 0x29, 0xE7, 0x1A, 0xCA, 0x29, 0xCA, 0xAA, 0x70, 0x9D,
+    0x29, 0xCA, 0x0C, 0xA7, 0x9D, 0x29, 0xCA, 0x09, 0xC9, 0x7D, 0x29, 0xD1, 0xAC, 0x99, 0x5D, 0x92,
+    0xAF, 0xEA, 0x4D, 0xA3, 0x9A, 0xAA, 0xAD, 0x94, 0xAC, 0xA7, 0x0A, 0xCA, 0x4A, 0xD7, 0x1D, 0x94,
+    0x99, 0x72, 0xD9, 0x20, 0x72, 0x9E, 0xA7, 0x29, 0xE7, 0x3A, 0xDA, 0x73, 0xAD, 0x77, 0x77, 0x75,
+    0x99, 0x73, 0xEA, 0x73, 0xE9, 0x72, 0x9E, 0x73, 0xAE, 0x73, 0xEA, 0x71, 0x9F, 0x97, 0x0A, 0xF9,
+    0x70, 0xAE, 0x97, 0x1A, 0xDA, 0x72, 0x9D, 0xA7, 0x3D, 0xA7, 0x3A, 0xD7, 0x39, 0xDA, 0x73, 0xAD,
+    0x74, 0xE7, 0x4E, 0x74, 0xAD, 0x95, 0xA9, 0x39, 0xEA, 0x29, 0xE4, 0xAF, 0xFC, 0x69, 0xFD, 0x97,
+    0x74, 0x73, 0x9D, 0x77, 0x1E, 0x77, 0x1E, 0x77, 0x1A, 0xAC, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9D,
+    0xA7, 0x7F, 0x76, 0xAF, 0x75, 0x9F, 0xC7, 0x5D, 0xAA, 0xD7, 0x4A, 0xD0, 0xAD, 0x73, 0x9D, 0x90,
+    0x9D, 0x97, 0x2D, 0xA1, 0x9D, 0x97, 0x1A, 0xD2, 0x9D, 0xA7, 0x09, 0xD9, 0x3D, 0xA7, 0x0E, 0x4E,
+    0x7A, 0xD5, 0xE6, 0x9D, 0xA5, 0xE6, 0xE6, 0xE5, 0xAF, 0xFF, 0xC9, 0x39, 0xFF, 0xFD, 0x93, 0xFF,
+    0xFE, 0x92, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA1, 0x9E, 0x71, 0xEA, 0x1E, 0xA7, 0x1F, 0x0A,
+    0xE7, 0x2F, 0x00, 0x77, 0x2C, 0xA7, 0x71, 0xD7, 0x71, 0xAC, 0x97, 0x70, 0x9D, 0x77, 0x1D, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9D, 0xA7, 0x70, 0xF7, 0x7A, 0xF7, 0x69, 0xFC,
+    0x76, 0xEA, 0xD7, 0x5A, 0xD0, 0xAD, 0x75, 0xDA, 0x09, 0xD9, 0x73, 0xE1, 0x9D, 0x97, 0x29, 0xD9,
+    0x19, 0xDA, 0x72, 0xE2, 0x9D, 0xA7, 0x1A, 0xD4, 0xDA, 0x70, 0x9D, 0xA4, 0xE7, 0x0E, 0x5E, 0x7A,
+    0xD9, 0x5E, 0x7E, 0x6E, 0x6F, 0xFF, 0xD9, 0x49, 0xFF, 0xFD, 0x94, 0xFF, 0xFE, 0xA3, 0xAE, 0x99,
+    0x99, 0x99, 0x99, 0x9E, 0xA2, 0x9E, 0x71, 0xEA, 0x2E, 0xA7, 0x1F, 0x1A, 0xE7, 0x2F, 0x10, 0x75,
+    0xCA, 0x77, 0x1A, 0xDA, 0x77, 0x9D, 0xAC, 0xA7, 0x6D, 0x2A, 0xC7, 0x4A, 0xA4, 0x9C, 0x97, 0x77,
+    0x71, 0x9D, 0xA7, 0x70, 0xF7, 0x7A, 0xF7, 0x69, 0xFC, 0x76, 0xDA, 0xAD, 0x75, 0xAD, 0x0A, 0xD7,
+    0x49, 0xD9, 0x09, 0xD9, 0x73, 0xDA, 0x19, 0xD9, 0x72, 0xAD, 0x29, 0xDA, 0x71, 0x9D, 0x93, 0xDA,
+    0x71, 0xE4, 0xE7, 0x0A, 0xD5, 0xE7, 0x9D, 0xA5, 0xE7, 0xE6, 0xE6, 0xAF, 0xFF, 0xC9, 0x49, 0xFF,
+    0xFD, 0x94, 0xFF, 0xFE, 0x93, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA2, 0x9E, 0x71, 0xEA, 0x2E,
+    0xA7, 0x1F, 0x1A, 0xE7, 0x2F, 0x10, 0x77, 0x77, 0x2A, 0xDA, 0x2C, 0x74, 0x9C, 0x99, 0xC1, 0x9C,
+    0x74, 0xD1, 0xAC, 0xAC, 0xA7, 0x4C, 0x92, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xDA, 0x77,
+    0x1F, 0x77, 0x0A, 0xF7, 0x79, 0xFC, 0x77, 0xDA, 0xAD, 0x76, 0xAD, 0x0A, 0xD7, 0x59, 0xD9, 0x09,
+    0xD9, 0x74, 0xDA, 0x19, 0xD9, 0x73, 0xAD, 0x29, 0xDA, 0x72, 0x9D, 0x93, 0xDA, 0x72, 0xE4, 0xE7,
+    0x1A, 0xD5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0xE6, 0xE7, 0xAF, 0xFF, 0xC9, 0x59, 0xFF, 0xFD, 0x95,
+    0xFF, 0xFE, 0x94, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA3, 0x9E, 0x71, 0xEA, 0x3E, 0xA7, 0x1F,
+    0x2A, 0xE7, 0x2F, 0x20, 0x73, 0xAD, 0x92, 0xAD, 0x74, 0xE3, 0xE7, 0x39, 0xE2, 0xAE, 0x73, 0xF2,
+    0xEA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9D, 0xA7, 0x72, 0xF7, 0x71, 0xAF, 0x77, 0x09,
+    0xFC, 0x77, 0x0D, 0xAA, 0xD7, 0x7A, 0xD0, 0xAD, 0x76, 0x9D, 0x90, 0x9D, 0x97, 0x5D, 0xA1, 0x9D,
+    0x97, 0x4A, 0xD2, 0x9D, 0xA7, 0x39, 0xD9, 0x3D, 0xA7, 0x3E, 0x4E, 0x72, 0xAD, 0x5E, 0x71, 0x9D,
+    0xA5, 0xE7, 0x1E, 0x6E, 0x70, 0xAF, 0xFF, 0xC9, 0x69, 0xFF, 0xFD, 0x96, 0xFF, 0xFE, 0x95, 0xAE,
+    0x99, 0x99, 0x99, 0x99, 0x9E, 0xA4, 0x9E, 0x71, 0xEA, 0x4E, 0xA7, 0x1F, 0x3A, 0xE7, 0x2F, 0x30,
+    0x77, 0xAC, 0xA7, 0x7C, 0x90, 0x99, 0x75, 0xAA, 0x1A, 0x97, 0x59, 0xCA, 0xD7, 0x7A, 0xCA, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x76, 0x9D, 0xA7, 0x7F, 0x76, 0xAF, 0x75, 0x9F, 0xC7, 0x5D, 0xAA, 0xD7,
+    0x4A, 0xD0, 0xAD, 0x73, 0x9D, 0x90, 0x9D, 0x97, 0x2D, 0xA1, 0x9D, 0x97, 0x1A, 0xD2, 0x9D, 0xA7,
+    0x09, 0xD9, 0x3D, 0xA7, 0x0E, 0x4E, 0x7A, 0xD5, 0xE6, 0x9D, 0xA5, 0xE6, 0xE6, 0xE5, 0xAF, 0xFF,
+    0xC9, 0x39, 0xFF, 0xFD, 0x93, 0xFF, 0xFE, 0x92, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA1, 0x9E,
+    0x71, 0xEA, 0x1E, 0xA7, 0x1F, 0x0A, 0xE7, 0x2F, 0x00, 0x77, 0x77, 0x77, 0x09, 0xFF, 0xFE, 0x77,
+    0x0F, 0xFF, 0xE9, 0x77, 0xFF, 0xEA, 0xAA, 0xA9, 0x77, 0xAF, 0xD7, 0x77, 0x0A, 0xD9, 0xF7, 0x77,
+    0x9D, 0x99, 0xEA, 0x77, 0x7D, 0xA0, 0x9E, 0x97, 0x76, 0xE1, 0x9E, 0x77, 0x6A, 0xD2, 0xAF, 0xFC,
+    0xA7, 0x6A, 0xD9, 0x2A, 0xFF, 0xC9, 0x75, 0x9D, 0xA3, 0xAF, 0xFC, 0x76, 0xE4, 0xE9, 0x77, 0x3E,
+    0x5E, 0x77, 0x3E, 0x94, 0x9E, 0x77, 0x2A, 0xE5, 0xAE, 0x77, 0x19, 0xFF, 0xFD, 0x77, 0x09, 0xFF,
+    0xFE, 0x99, 0x99, 0x99, 0x99, 0x70, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xFF, 0xC6, 0xAE, 0x70, 0xFF,
+    0xFC, 0x59, 0xE9, 0x7A, 0xFF, 0xFC, 0x77, 0x77, 0x60, 0x77, 0x77, 0x29, 0xAF, 0xCA, 0x73, 0xAF,
+    0xFC, 0x71, 0xAF, 0xFD, 0x97, 0x0F, 0xC9, 0x76, 0xF9, 0x77, 0xF7, 0x70, 0xF7, 0x70, 0x9E, 0x77,
+    0x1E, 0x97, 0x70, 0xAE, 0x77, 0x1E, 0x97, 0x70, 0x9E, 0x77, 0x1A, 0xE7, 0x71, 0xFA, 0x77, 0x0F,
+    0xC9, 0x79, 0x6F, 0xEA, 0xA9, 0x9A, 0xE6, 0xFF, 0xFD, 0xA6, 0xAF, 0xFF, 0xC9, 0x7F, 0xFF, 0xC7,
+    0x09, 0xFF, 0xF7, 0x2A, 0xFF, 0xA9, 0x76, 0xA7, 0x73, 0xAC, 0xA9, 0x77, 0x4C, 0x77, 0x4C, 0x77,
+    0x09, 0x9A, 0xCA, 0x77, 0x0E, 0xA7, 0x20, 0x71, 0xAA, 0x97, 0x79, 0xD9, 0x77, 0xAD, 0x97, 0x7A,
+    0xDA, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xFF, 0xEA, 0x5F, 0xFF, 0x59, 0xFE, 0xAA, 0xAA, 0x95, 0xAD,
+    0x77, 0xE7, 0x7D, 0xA7, 0x6A, 0xD7, 0x7E, 0x77, 0xFF, 0xCA, 0x79, 0xFF, 0xC9, 0x7A, 0xFF, 0xC7,
+    0x0E, 0x76, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xE7, 0x7E, 0x76, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x99,
+    0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x49, 0xFF, 0xFC, 0x4A, 0xFF, 0xFC, 0x40, 0x77, 0xAC, 0x77, 0x9C,
+    0xA7, 0x7D, 0x77, 0xD9, 0x76, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xFF,
+    0xEA, 0x5F, 0xFF, 0x59, 0xFE, 0xAA, 0xAA, 0x95, 0xAD, 0x77, 0xE7, 0x7D, 0xA7, 0x6A, 0xD7, 0x7E,
+    0x77, 0xFF, 0xCA, 0x79, 0xFF, 0xC9, 0x7A, 0xFF, 0xC7, 0x0E, 0x76, 0x9D, 0xA7, 0x6A, 0xD9, 0x76,
+    0xE7, 0x7E, 0x76, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x49, 0xFF,
+    0xFC, 0x4A, 0xFF, 0xFC, 0x40, 0x72, 0xAC, 0x97, 0x7E, 0x76, 0xAC, 0xAD, 0x97, 0x39, 0xC9, 0x19,
+    0xCA, 0x72, 0xC9, 0x4A, 0xA7, 0x77, 0x1A, 0xFF, 0xEA, 0x5F, 0xFF, 0x59, 0xFE, 0xAA, 0xAA, 0x95,
+    0xAD, 0x77, 0xE7, 0x7D, 0xA7, 0x6A, 0xD7, 0x7E, 0x77, 0xFF, 0xCA, 0x79, 0xFF, 0xC9, 0x7A, 0xFF,
+    0xC7, 0x0E, 0x76, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xE7, 0x7E, 0x76, 0xAD, 0xA9, 0x99, 0x99, 0x99,
+    0x99, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x49, 0xFF, 0xFC, 0x4A, 0xFF, 0xFC, 0x40, 0x77, 0x75, 0xE2,
+    0x9D, 0xA7, 0x0A, 0xDA, 0x2A, 0xD9, 0x70, 0xEA, 0x2E, 0x97, 0x9E, 0x91, 0xAE, 0x77, 0x77, 0x77,
+    0x77, 0x2A, 0xFF, 0xEA, 0x6F, 0xFF, 0x69, 0xFE, 0xAA, 0xAA, 0x96, 0xAD, 0x77, 0x0E, 0x77, 0x0D,
+    0xA7, 0x7A, 0xD7, 0x70, 0xE7, 0x70, 0xFF, 0xCA, 0x70, 0x9F, 0xFC, 0x97, 0x0A, 0xFF, 0xC7, 0x1E,
+    0x77, 0x9D, 0xA7, 0x7A, 0xD9, 0x77, 0xE7, 0x70, 0xE7, 0x7A, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x96,
+    0xFF, 0xFC, 0x6F, 0xFF, 0xC5, 0x9F, 0xFF, 0xC5, 0xAF, 0xFF, 0xC5, 0x4A, 0xCA, 0x71, 0xDA, 0x70,
+    0x9E, 0x70, 0x9A, 0xAA, 0x77, 0x77, 0x77, 0x6E, 0x96, 0x9E, 0x7A, 0xE7, 0xAD, 0xA7, 0xE9, 0x7E,
+    0x79, 0xE7, 0xAD, 0xA7, 0xE7, 0x9E, 0x7A, 0xDA, 0x7E, 0x97, 0xE9, 0x69, 0xE7, 0xAE, 0x7E, 0xA6,
+    0x9E, 0x96, 0xAE, 0x96, 0xF6, 0x9F, 0x6A, 0xEA, 0x60, 0x72, 0x9C, 0x97, 0x2C, 0xA7, 0x2D, 0x72,
+    0xAC, 0xA7, 0x19, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0E, 0x97, 0x09, 0xE7, 0x1A,
+    0xE7, 0x1A, 0xDA, 0x71, 0xE9, 0x71, 0xE7, 0x19, 0xE7, 0x1A, 0xDA, 0x71, 0xE7, 0x19, 0xE7, 0x1A,
+    0xDA, 0x71, 0xE9, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE9,
+    0x70, 0xF7, 0x09, 0xF7, 0x0A, 0xEA, 0x70, 0x59, 0xC9, 0x72, 0xE9, 0x70, 0xAC, 0xAA, 0xC9, 0x69,
+    0xCA, 0x19, 0xCA, 0x5C, 0x94, 0x9A, 0x77, 0x77, 0x2E, 0x97, 0x09, 0xE7, 0x1A, 0xE7, 0x1A, 0xDA,
+    0x71, 0xE9, 0x71, 0xE7, 0x19, 0xE7, 0x1A, 0xDA, 0x71, 0xE7, 0x19, 0xE7, 0x1A, 0xDA, 0x71, 0xE9,
+    0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE9, 0x70, 0xF7, 0x09,
+    0xF7, 0x0A, 0xEA, 0x70, 0x77, 0x3E, 0x3E, 0x39, 0xE2, 0xAD, 0xA3, 0xEA, 0x2E, 0xA2, 0x9E, 0xA1,
+    0xAE, 0x97, 0x77, 0x77, 0x77, 0x71, 0xE9, 0x71, 0x9E, 0x72, 0xAE, 0x72, 0xAD, 0xA7, 0x2E, 0x97,
+    0x2E, 0x72, 0x9E, 0x72, 0xAD, 0xA7, 0x2E, 0x72, 0x9E, 0x72, 0xAD, 0xA7, 0x2E, 0x97, 0x2E, 0x97,
+    0x19, 0xE7, 0x2A, 0xE7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAE,
+    0xA7, 0x10, 0x69, 0x99, 0x99, 0x99, 0x76, 0x9F, 0xFC, 0xA7, 0x3A, 0xFF, 0xEA, 0x71, 0xFF, 0xFC,
+    0xA7, 0x0D, 0xA4, 0x9A, 0xF9, 0x69, 0xD9, 0x7F, 0x6A, 0xD7, 0x09, 0xE6, 0xE7, 0x1E, 0x95, 0xDA,
+    0x71, 0xE9, 0x49, 0xD9, 0x71, 0xEA, 0x1A, 0xAA, 0xEA, 0xAA, 0xA9, 0x5E, 0xA0, 0xAF, 0xFD, 0xA5,
+    0xE9, 0x0F, 0xFE, 0x59, 0xE9, 0x3A, 0xD9, 0x71, 0xAE, 0x4E, 0x71, 0x9F, 0x4E, 0x70, 0xAF, 0x93,
+    0x9D, 0xA9, 0x99, 0x99, 0x9A, 0xFE, 0x4A, 0xFF, 0xFF, 0x5F, 0xFF, 0xF9, 0x5F, 0xFF, 0xE6, 0x9F,
+    0xFF, 0xC9, 0x7F, 0xFC, 0xAA, 0x97, 0x10, 0x74, 0xAC, 0xA2, 0x9C, 0x76, 0xAC, 0x9C, 0xA1, 0xAA,
+    0x76, 0xCA, 0x09, 0xC0, 0x9C, 0x97, 0x59, 0xC2, 0xF7, 0x74, 0x99, 0x77, 0x77, 0x39, 0x99, 0x97,
+    0x0E, 0x7F, 0x79, 0xDA, 0x69, 0xF7, 0xE9, 0x6F, 0xC9, 0x6E, 0x7F, 0xC9, 0x5A, 0xDA, 0x6A, 0xFC,
+    0xA5, 0xE9, 0x6F, 0xE5, 0xE7, 0xE9, 0xE4, 0xAE, 0x6A, 0xE0, 0xE9, 0x3E, 0x96, 0xEA, 0x0E, 0xA2,
+    0x9E, 0x7E, 0x90, 0xAD, 0xA2, 0xAE, 0x6A, 0xE1, 0x9E, 0x2E, 0x96, 0xF1, 0x9E, 0x19, 0xE6, 0x9E,
+    0xA2, 0xE9, 0x0A, 0xE6, 0xAE, 0x92, 0xEA, 0x0E, 0xA6, 0xF3, 0xAD, 0xA9, 0xE6, 0x9F, 0x39, 0xEA,
+    0xE6, 0xAE, 0xA4, 0xFD, 0xA6, 0xF9, 0x4F, 0xD6, 0x9F, 0x5F, 0xD6, 0xAF, 0x5A, 0xFA, 0x60, 0x73,
+    0x97, 0x76, 0xD9, 0x77, 0x49, 0xD9, 0x77, 0x4A, 0xDA, 0x77, 0x59, 0x97, 0x77, 0x77, 0x77, 0x70,
+    0x9A, 0xFC, 0xA7, 0x5A, 0xFF, 0xDA, 0x71, 0x9F, 0xC9, 0x99, 0xAF, 0xA7, 0x9F, 0x95, 0xF6, 0x9E,
+    0xA7, 0x9E, 0x95, 0xF7, 0x1E, 0xA4, 0xAE, 0x72, 0xEA, 0x4E, 0x97, 0x2A, 0xDA, 0x39, 0xE7, 0x3A,
+    0xD9, 0x3E, 0x97, 0x3E, 0x4E, 0x74, 0xE3, 0x9D, 0xA7, 0x39, 0xDA, 0x3A, 0xDA, 0x73, 0xE9, 0x3A,
+    0xDA, 0x72, 0xAE, 0x4A, 0xE9, 0x70, 0xF9, 0x4A, 0xFC, 0x99, 0x99, 0x9A, 0xFD, 0x59, 0xFF, 0xFF,
+    0x96, 0xFF, 0xFE, 0xA7, 0xAF, 0xFF, 0xCA, 0x71, 0xAF, 0xFE, 0x97, 0x4A, 0xFD, 0xA9, 0x77, 0x77,
+    0x10, 0x77, 0x1C, 0xA7, 0x74, 0xD7, 0x74, 0xAC, 0x97, 0x73, 0x9D, 0x77, 0x4D, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAF, 0xCA, 0x75, 0xAF, 0xFD, 0xA7, 0x19, 0xFC,
+    0x99, 0x9A, 0xFA, 0x79, 0xF9, 0x5F, 0x69, 0xEA, 0x79, 0xE9, 0x5F, 0x71, 0xEA, 0x4A, 0xE7, 0x2E,
+    0xA4, 0xE9, 0x72, 0xAD, 0xA3, 0x9E, 0x73, 0xAD, 0x93, 0xE9, 0x73, 0xE4, 0xE7, 0x4E, 0x39, 0xDA,
+    0x73, 0x9D, 0xA3, 0xAD, 0xA7, 0x3E, 0x93, 0xAD, 0xA7, 0x2A, 0xE4, 0xAE, 0x97, 0x0F, 0x94, 0xAF,
+    0xC9, 0x99, 0x99, 0xAF, 0xD5, 0x9F, 0xFF, 0xF9, 0x6F, 0xFF, 0xEA, 0x7A, 0xFF, 0xFC, 0xA7, 0x1A,
+    0xFF, 0xE9, 0x74, 0xAF, 0xDA, 0x97, 0x77, 0x71, 0x74, 0xCA, 0x77, 0x4A, 0xD9, 0x77, 0x3D, 0xAC,
+    0xA7, 0x71, 0xD1, 0x9D, 0x77, 0xAC, 0x49, 0xC9, 0x77, 0x77, 0x59, 0xAF, 0xCA, 0x75, 0xAF, 0xFD,
+    0xA7, 0x19, 0xFC, 0x99, 0x9A, 0xFA, 0x79, 0xF9, 0x5F, 0x69, 0xEA, 0x79, 0xE9, 0x5F, 0x71, 0xEA,
+    0x4A, 0xE7, 0x2E, 0xA4, 0xE9, 0x72, 0xAD, 0xA3, 0x9E, 0x73, 0xAD, 0x93, 0xE9, 0x73, 0xE4, 0xE7,
+    0x4E, 0x39, 0xDA, 0x73, 0x9D, 0xA3, 0xAD, 0xA7, 0x3E, 0x93, 0xAD, 0xA7, 0x2A, 0xE4, 0xAE, 0x97,
+    0x0F, 0x94, 0xAF, 0xC9, 0x99, 0x99, 0xAF, 0xD5, 0x9F, 0xFF, 0xF9, 0x6F, 0xFF, 0xEA, 0x7A, 0xFF,
+    0xFC, 0xA7, 0x1A, 0xFF, 0xE9, 0x74, 0xAF, 0xDA, 0x97, 0x77, 0x71, 0x77, 0x77, 0x3A, 0xDA, 0x2C,
+    0x76, 0xAC, 0x99, 0xC9, 0x0A, 0xC7, 0x6C, 0xA1, 0xAE, 0x77, 0xA9, 0x29, 0x97, 0x77, 0x77, 0x77,
+    0x79, 0xAF, 0xCA, 0x75, 0xAF, 0xFD, 0xA7, 0x19, 0xFC, 0x99, 0x9A, 0xFA, 0x79, 0xF9, 0x5F, 0x69,
+    0xEA, 0x79, 0xE9, 0x5F, 0x71, 0xEA, 0x4A, 0xE7, 0x2E, 0xA4, 0xE9, 0x72, 0xAD, 0xA3, 0x9E, 0x73,
+    0xAD, 0x93, 0xE9, 0x73, 0xE4, 0xE7, 0x4E, 0x39, 0xDA, 0x73, 0x9D, 0xA3, 0xAD, 0xA7, 0x3E, 0x93,
+    0xAD, 0xA7, 0x2A, 0xE4, 0xAE, 0x97, 0x0F, 0x94, 0xAF, 0xC9, 0x99, 0x99, 0xAF, 0xD5, 0x9F, 0xFF,
+    0xF9, 0x6F, 0xFF, 0xEA, 0x7A, 0xFF, 0xFC, 0xA7, 0x1A, 0xFF, 0xE9, 0x74, 0xAF, 0xDA, 0x97, 0x77,
+    0x71, 0x72, 0xAD, 0x92, 0xE7, 0x5E, 0x3E, 0x74, 0xAE, 0x2A, 0xE7, 0x4F, 0x2E, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x74, 0x9A, 0xFC, 0xA7, 0x5A, 0xFF, 0xDA, 0x71, 0x9F, 0xC9, 0x99, 0xAF, 0xA7, 0x9F,
+    0x95, 0xF6, 0x9E, 0xA7, 0x9E, 0x95, 0xF7, 0x1E, 0xA4, 0xAE, 0x72, 0xEA, 0x4E, 0x97, 0x2A, 0xDA,
+    0x39, 0xE7, 0x3A, 0xD9, 0x3E, 0x97, 0x3E, 0x4E, 0x74, 0xE3, 0x9D, 0xA7, 0x39, 0xDA, 0x3A, 0xDA,
+    0x73, 0xE9, 0x3A, 0xDA, 0x72, 0xAE, 0x4A, 0xE9, 0x70, 0xF9, 0x4A, 0xFC, 0x99, 0x99, 0x9A, 0xFD,
+    0x59, 0xFF, 0xFF, 0x96, 0xFF, 0xFE, 0xA7, 0xAF, 0xFF, 0xCA, 0x71, 0xAF, 0xFE, 0x97, 0x4A, 0xFD,
+    0xA9, 0x77, 0x77, 0x10, 0x29, 0xCA, 0x29, 0xCA, 0x4D, 0xA0, 0xAC, 0xA6, 0xF9, 0x7E, 0xA7, 0xFC,
+    0x94, 0x9E, 0x9E, 0x3A, 0xDA, 0x19, 0xE1, 0x77, 0x77, 0x71, 0x97, 0x77, 0x77, 0xAD, 0x97, 0x77,
+    0x76, 0xAD, 0x97, 0x77, 0x76, 0xAD, 0x97, 0x77, 0x76, 0xAD, 0xA7, 0x77, 0x76, 0xAD, 0xA7, 0x77,
+    0x76, 0xAD, 0xA7, 0x77, 0x76, 0xAD, 0xA7, 0x77, 0x76, 0xAD, 0xA7, 0x77, 0x76, 0xAE, 0x77, 0x75,
+    0x9A, 0xFC, 0x90, 0x9E, 0x77, 0x74, 0xAF, 0xFF, 0xC7, 0x77, 0x39, 0xFC, 0x99, 0x9A, 0xFC, 0x77,
+    0x73, 0x9F, 0x94, 0xAF, 0x77, 0x72, 0x9E, 0xA5, 0xAF, 0xC9, 0x77, 0x71, 0xF5, 0xAF, 0xDA, 0x77,
+    0x70, 0xAE, 0x5A, 0xE0, 0xAD, 0xA7, 0x77, 0x0E, 0x94, 0xAE, 0x1A, 0xDA, 0x77, 0x79, 0xE4, 0xAE,
+    0x2A, 0xD9, 0x77, 0x7E, 0x93, 0xAE, 0x3E, 0x77, 0x70, 0xE3, 0xAE, 0x4E, 0x77, 0x79, 0xDA, 0x2A,
+    0xE4, 0x9D, 0xA7, 0x77, 0xAD, 0xA1, 0xAE, 0x5E, 0x97, 0x77, 0xAD, 0xA0, 0xF5, 0xAE, 0x77, 0x70,
+    0xAF, 0xE5, 0xF9, 0x77, 0x70, 0xAF, 0xD9, 0x99, 0x9A, 0xFD, 0x77, 0x71, 0x9F, 0xFF, 0xF9, 0x77,
+    0x72, 0xFF, 0xFE, 0xA7, 0x77, 0x2F, 0xFF, 0xEA, 0x77, 0x72, 0xAF, 0xFF, 0xD9, 0x77, 0x72, 0xAE,
+    0x90, 0xAF, 0xDA, 0x97, 0x77, 0x3A, 0xE9, 0x77, 0x77, 0x5A, 0xE9, 0x77, 0x77, 0x5A, 0xE9, 0x77,
+    0x77, 0x5A, 0xEA, 0x77, 0x77, 0x5A, 0xEA, 0x77, 0x77, 0x5A, 0xEA, 0x77, 0x77, 0x5A, 0xEA, 0x77,
+    0x77, 0x5A, 0xEA, 0x77, 0x77, 0x5A, 0xCA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x72, 0x73, 0x97, 0x75,
+    0xD9, 0x77, 0x39, 0xDA, 0x77, 0x3A, 0xDA, 0x77, 0x49, 0x97, 0x77, 0x77, 0x77, 0x19, 0x99, 0x71,
+    0x99, 0x95, 0x9E, 0xA7, 0xF9, 0x4A, 0xE9, 0x7F, 0x5F, 0x70, 0xF5, 0xEA, 0x79, 0xE9, 0x49, 0xE9,
+    0x7A, 0xE5, 0xAE, 0x70, 0xF5, 0xF7, 0x0E, 0xA5, 0xEA, 0x79, 0xE5, 0x9E, 0x70, 0xAE, 0x59, 0xE7,
+    0x0E, 0xA5, 0xAD, 0xA7, 0x0E, 0x95, 0xE9, 0x79, 0xE6, 0xE7, 0x0A, 0xDA, 0x59, 0xE7, 0x0E, 0x95,
+    0xAE, 0x7A, 0xE6, 0xF9, 0x5A, 0xEA, 0x6F, 0xDA, 0xAA, 0xFD, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xD7,
+    0x09, 0xFF, 0xF9, 0x71, 0x9A, 0xFF, 0xA7, 0x77, 0x70, 0x77, 0x1C, 0xA7, 0x73, 0xD7, 0x73, 0xAC,
+    0x97, 0x72, 0x9D, 0x77, 0x3D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x99,
+    0x99, 0x70, 0x99, 0x95, 0x9E, 0xA7, 0xF9, 0x4A, 0xE9, 0x7F, 0x5F, 0x79, 0xF5, 0xEA, 0x79, 0xE9,
+    0x49, 0xE9, 0x7A, 0xE5, 0xAE, 0x70, 0xF5, 0xF7, 0x0E, 0xA5, 0xE9, 0x79, 0xE5, 0x9E, 0x70, 0xAE,
+    0x59, 0xE7, 0x0E, 0xA5, 0xAD, 0xA7, 0x0E, 0x95, 0xE9, 0x79, 0xE6, 0xE7, 0x0A, 0xDA, 0x59, 0xE7,
+    0x0E, 0x95, 0xAE, 0x7A, 0xE6, 0xF9, 0x5A, 0xEA, 0x6F, 0xDA, 0xAA, 0xFD, 0x7F, 0xFF, 0xDA, 0x7F,
+    0xFF, 0xD7, 0x09, 0xFF, 0xF9, 0x71, 0x9A, 0xFF, 0xA7, 0x77, 0x70, 0x74, 0xCA, 0x77, 0x39, 0xDA,
+    0x77, 0x2D, 0xAC, 0xA7, 0x70, 0xD2, 0xD7, 0x6A, 0xC4, 0x9C, 0x97, 0x77, 0x79, 0x99, 0x97, 0x99,
+    0x99, 0x94, 0x9E, 0xA7, 0xF9, 0x4A, 0xE9, 0x7F, 0x5F, 0x79, 0xEA, 0x5E, 0xA7, 0xAE, 0x94, 0x9E,
+    0x97, 0xAE, 0x5A, 0xE7, 0x0F, 0x5F, 0x70, 0xE9, 0x5E, 0x97, 0x9E, 0x59, 0xE7, 0x0A, 0xE5, 0xAE,
+    0x70, 0xEA, 0x5A, 0xDA, 0x70, 0xE9, 0x5E, 0x97, 0x9E, 0x6E, 0x70, 0xAD, 0xA5, 0x9E, 0x70, 0xE9,
+    0x5A, 0xE7, 0xAE, 0x6F, 0x95, 0xAE, 0xA6, 0xFD, 0xAA, 0xAF, 0xD7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD,
+    0x70, 0x9F, 0xFF, 0x97, 0x19, 0xAF, 0xFA, 0x77, 0x77, 0x72, 0x9D, 0x92, 0xAD, 0x74, 0xE3, 0xE7,
+    0x39, 0xE2, 0xAE, 0x73, 0xF2, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x49, 0x99, 0x97, 0x99, 0x99, 0x59,
+    0xEA, 0x7F, 0x94, 0xAE, 0x97, 0xF5, 0xF7, 0x9E, 0xA5, 0xEA, 0x7A, 0xE9, 0x49, 0xE9, 0x7A, 0xE5,
+    0xAE, 0x70, 0xF5, 0xF7, 0x0E, 0x95, 0xE9, 0x79, 0xE5, 0x9E, 0x70, 0xAE, 0x5A, 0xE7, 0x0E, 0xA5,
+    0xAD, 0xA7, 0x0E, 0x95, 0xE9, 0x79, 0xE6, 0xE7, 0x0A, 0xDA, 0x59, 0xE7, 0x0E, 0x95, 0xAE, 0x7A,
+    0xE6, 0xF9, 0x5A, 0xEA, 0x6F, 0xDA, 0xAA, 0xFD, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xD7, 0x09, 0xFF,
+    0xF9, 0x71, 0x9A, 0xFF, 0xA7, 0x77, 0x70, 0x74, 0xD7, 0x6A, 0xC7, 0x69, 0xCA, 0x76, 0xD7, 0x6D,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0xE7, 0x1A, 0xD9, 0x0E, 0x97, 0x9D, 0xA1,
+    0xAD, 0xA6, 0x9E, 0x29, 0xE6, 0xE3, 0x9E, 0x5E, 0x94, 0xE9, 0x3E, 0xA5, 0xF2, 0xAE, 0x6A, 0xE1,
+    0x9E, 0x79, 0xE9, 0x9E, 0x97, 0x0F, 0xEA, 0x71, 0xFE, 0x72, 0xFD, 0x73, 0xAF, 0x97, 0x39, 0xEA,
+    0x74, 0xAE, 0x75, 0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x73, 0xAF, 0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x30,
+    0x49, 0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xEA, 0xA7, 0x1A, 0xFD, 0xA7, 0xE9, 0x9F, 0x6D, 0x92,
+    0x9E, 0x49, 0xD4, 0x9D, 0x93, 0xAD, 0x5A, 0xC9, 0x3D, 0xA5, 0xAC, 0x93, 0xD9, 0x4A, 0xD3, 0x9D,
+    0x4A, 0xD9, 0x3A, 0xD2, 0x9E, 0xA4, 0xE9, 0xAF, 0x95, 0xFE, 0xA6, 0x9F, 0xA9, 0x70, 0xAD, 0x74,
+    0xDA, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0x72, 0x99, 0x74, 0x9F, 0xD7, 0x1A, 0xD9, 0x2D, 0x7A, 0xD5,
+    0xC9, 0x6D, 0x6C, 0x95, 0x9C, 0xA4, 0x9A, 0xC9, 0x5D, 0x92, 0x9D, 0xA9, 0x6D, 0x29, 0xCA, 0x70,
+    0x9D, 0x2A, 0xC7, 0x1A, 0xCA, 0x2C, 0xA7, 0x1D, 0x92, 0xD7, 0x09, 0xD3, 0xAD, 0x7A, 0xD3, 0x9E,
+    0x6E, 0x5E, 0x49, 0xDA, 0x6D, 0x4A, 0xD9, 0x6D, 0x4E, 0x09, 0x4E, 0x4E, 0x0F, 0xF9, 0x3A, 0xDA,
+    0x0F, 0xE9, 0x4E, 0x90, 0xAF, 0xA5, 0x69, 0x97, 0x5D, 0xA7, 0x5E, 0x74, 0x9E, 0x76, 0x99, 0x77,
+    0x71, 0xAE, 0xA0, 0xAC, 0x59, 0xFF, 0xC4, 0x9D, 0xA2, 0xAE, 0x4D, 0x94, 0xDA, 0x3D, 0x95, 0xDA,
+    0x29, 0xD6, 0xD9, 0x2D, 0x69, 0xD3, 0xD6, 0xE2, 0x9C, 0xA5, 0xAE, 0x2A, 0xD4, 0xFA, 0x2A, 0xFF,
+    0xEA, 0x29, 0xFF, 0xE9, 0x3F, 0xF9, 0xD5, 0xAF, 0xA0, 0x9D, 0x20, 0x74, 0xD7, 0x4A, 0xC9, 0x73,
+    0x9C, 0xA7, 0x4D, 0x74, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAE, 0xA0, 0xAC, 0x59, 0xFF,
+    0xC4, 0x9D, 0xA2, 0xAE, 0x4D, 0x94, 0xDA, 0x3D, 0x95, 0xDA, 0x29, 0xD6, 0xD9, 0x2D, 0x69, 0xD3,
+    0xD6, 0xE2, 0x9C, 0xA5, 0xAE, 0x2A, 0xD4, 0xFA, 0x2A, 0xFF, 0xEA, 0x29, 0xFF, 0xE9, 0x3F, 0xF9,
+    0xD5, 0xAF, 0xA0, 0x9D, 0x20, 0x71, 0xCA, 0x75, 0xAD, 0xA7, 0x39, 0xDA, 0xCA, 0x72, 0xD2, 0xD7,
+    0x0A, 0xA4, 0x9C, 0x77, 0x70, 0xAE, 0xA0, 0xAC, 0x69, 0xFF, 0xC5, 0x9D, 0xA2, 0xAE, 0x5D, 0x94,
+    0xDA, 0x4D, 0x95, 0xDA, 0x39, 0xD6, 0xD9, 0x3D, 0x69, 0xD4, 0xD6, 0xE3, 0x9C, 0xA5, 0xAE, 0x3A,
+    0xD4, 0xFA, 0x3A, 0xFF, 0xEA, 0x39, 0xFF, 0xE9, 0x4F, 0xF9, 0xD6, 0xAF, 0xA0, 0x9D, 0x30, 0x7D,
+    0xA2, 0xCA, 0x6D, 0x9C, 0x91, 0xC9, 0x59, 0xC1, 0xAC, 0x0A, 0xC6, 0xD2, 0xE9, 0x69, 0x49, 0x97,
+    0x77, 0x0A, 0xF0, 0xAC, 0x59, 0xFF, 0xC4, 0x9D, 0xA2, 0xAE, 0x4D, 0x94, 0xDA, 0x3D, 0x95, 0xDA,
+    0x29, 0xD6, 0xD9, 0x2D, 0x69, 0xD3, 0xD6, 0xE2, 0x9C, 0xA5, 0xAE, 0x2A, 0xD4, 0xFA, 0x2A, 0xFF,
+    0xEA, 0x29, 0xFF, 0xE9, 0x3F, 0xF9, 0xD5, 0xAF, 0xA0, 0x9D, 0x20, 0x77, 0x69, 0xDA, 0x29, 0xD9,
+    0x5E, 0x92, 0xE9, 0x5E, 0x91, 0x9E, 0x5A, 0xE2, 0xF7, 0x77, 0x77, 0x1A, 0xF0, 0xAC, 0x69, 0xFF,
+    0xC5, 0x9D, 0xA2, 0xAE, 0x5D, 0x94, 0xDA, 0x4D, 0x95, 0xDA, 0x39, 0xD6, 0xD9, 0x3D, 0x69, 0xD4,
+    0xD6, 0xE3, 0x9C, 0xA5, 0xAE, 0x3A, 0xD4, 0xFA, 0x3A, 0xFF, 0xEA, 0x39, 0xFF, 0xE9, 0x4F, 0xF9,
+    0xD6, 0xAF, 0xA0, 0x9D, 0x30, 0x71, 0xAD, 0x73, 0xAA, 0x1C, 0x72, 0xC2, 0xC7, 0x2C, 0x1C, 0xA7,
+    0x2F, 0x74, 0x99, 0x77, 0x77, 0x72, 0xAF, 0x0A, 0xC5, 0x9F, 0xFC, 0x49, 0xDA, 0x2A, 0xE4, 0xD9,
+    0x4D, 0xA3, 0xD9, 0x5D, 0xA2, 0x9D, 0x6D, 0x92, 0xD6, 0x9D, 0x3D, 0x6E, 0x29, 0xCA, 0x5A, 0xE2,
+    0xAD, 0x4F, 0xA2, 0xAF, 0xFE, 0xA2, 0x9F, 0xFE, 0x93, 0xFF, 0x9D, 0x5A, 0xFA, 0x09, 0xD2, 0x77,
+    0x09, 0xAE, 0x97, 0x1A, 0xEA, 0x0A, 0xC9, 0xFA, 0xDA, 0x69, 0xFF, 0xF4, 0xC9, 0x49, 0xDA, 0x2A,
+    0xF9, 0x5D, 0x4D, 0x94, 0xEA, 0x59, 0xD3, 0xD9, 0x5E, 0xAA, 0xAF, 0xE2, 0x9D, 0x6F, 0xFF, 0xC2,
+    0xD6, 0x9D, 0xA9, 0x99, 0x97, 0x0D, 0x6E, 0x74, 0x9C, 0xA5, 0xAE, 0x74, 0xAD, 0x4F, 0xCA, 0x73,
+    0xAF, 0xFF, 0xDA, 0x99, 0x99, 0xAC, 0x39, 0xFF, 0xFF, 0xFC, 0x4F, 0xF9, 0xFF, 0xEA, 0x5A, 0xFA,
+    0x09, 0xD0, 0x9F, 0xCA, 0x93, 0x77, 0x29, 0xAF, 0xA4, 0xAF, 0xDA, 0x3F, 0x91, 0x93, 0xAD, 0xA7,
+    0x0D, 0xA7, 0x09, 0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0xA7, 0x09, 0xEA, 0x70,
+    0xFF, 0x49, 0xFF, 0x49, 0xFD, 0xA6, 0xA7, 0x29, 0xAA, 0xA7, 0x3A, 0x97, 0x19, 0xC7, 0xAE, 0x97,
+    0x99, 0x96, 0x7A, 0xCA, 0x75, 0xDA, 0x74, 0x9D, 0xA7, 0x49, 0xAA, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x1A, 0xEA, 0x70, 0xAE, 0xAE, 0x6E, 0x93, 0xCA, 0x4A, 0xCA, 0x5A, 0xC3, 0xAC, 0xA5, 0x9D, 0x3D,
+    0xAA, 0xAF, 0xE2, 0xAF, 0xFF, 0x2D, 0xA9, 0x99, 0x97, 0x0D, 0x74, 0x9D, 0x97, 0x39, 0xE7, 0x4F,
+    0xA9, 0x99, 0x9A, 0xC9, 0x3A, 0xFF, 0xD5, 0xAF, 0xFC, 0x69, 0xAF, 0xA9, 0x30, 0x75, 0x9C, 0x97,
+    0x5C, 0xA7, 0x5D, 0x75, 0xAC, 0x97, 0x49, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71,
+    0xAE, 0xA7, 0x1A, 0xEA, 0xE7, 0xE9, 0x3C, 0xA5, 0xAC, 0xA5, 0xAC, 0x4A, 0xCA, 0x59, 0xD4, 0xDA,
+    0xAA, 0xFE, 0x3A, 0xFF, 0xF3, 0xDA, 0x99, 0x99, 0x71, 0xD7, 0x59, 0xD9, 0x74, 0x9E, 0x75, 0xFA,
+    0x99, 0x99, 0xAC, 0x94, 0xAF, 0xFD, 0x6A, 0xFF, 0xC7, 0x9A, 0xFA, 0x94, 0x70, 0x9C, 0x97, 0x5E,
+    0x97, 0x3A, 0xCA, 0xD9, 0x71, 0x9C, 0xA1, 0x9C, 0xA7, 0x0C, 0x94, 0x9A, 0x77, 0x77, 0x72, 0xAE,
+    0xA7, 0x1A, 0xEA, 0xE7, 0xE9, 0x3C, 0xA5, 0xAC, 0xA5, 0xAC, 0x4A, 0xCA, 0x59, 0xD4, 0xDA, 0xAA,
+    0xFE, 0x3A, 0xFF, 0xF3, 0xDA, 0x99, 0x99, 0x71, 0xD7, 0x59, 0xD9, 0x74, 0x9E, 0x75, 0xFA, 0x99,
+    0x99, 0xAC, 0x94, 0xAF, 0xFD, 0x6A, 0xFF, 0xC7, 0x9A, 0xFA, 0x94, 0x77, 0x71, 0xE3, 0xDA, 0x69,
+    0xE2, 0xAD, 0xA6, 0xEA, 0x2E, 0x95, 0x9E, 0xA1, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x77, 0x7A, 0xEA,
+    0x72, 0xAE, 0xAE, 0x70, 0xE9, 0x3C, 0xA6, 0xAC, 0xA5, 0xAC, 0x5A, 0xCA, 0x59, 0xD5, 0xDA, 0xAA,
+    0xFE, 0x4A, 0xFF, 0xF4, 0xDA, 0x99, 0x99, 0x72, 0xD7, 0x69, 0xD9, 0x75, 0x9E, 0x76, 0xFA, 0x99,
+    0x99, 0xAC, 0x95, 0xAF, 0xFD, 0x7A, 0xFF, 0xC7, 0x09, 0xAF, 0xA9, 0x50, 0x29, 0x96, 0xDA, 0x6E,
+    0x59, 0xE7, 0x77, 0x7A, 0xC9, 0x5D, 0x6D, 0x59, 0xCA, 0x5A, 0xC9, 0x5D, 0x59, 0xD5, 0xAC, 0xA5,
+    0xD9, 0x49, 0xD5, 0xAD, 0x5E, 0x49, 0xDA, 0x4A, 0xD9, 0x40, 0x70, 0xD7, 0x0A, 0xC9, 0x79, 0xCA,
+    0x70, 0xD7, 0x0D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x6A, 0xC9, 0x70, 0xD7, 0x1D, 0x70, 0x9C, 0xA7,
+    0x0A, 0xC9, 0x70, 0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0E, 0x79,
+    0xDA, 0x7A, 0xD9, 0x70, 0x3A, 0xA7, 0x09, 0xDA, 0x7D, 0xAD, 0x5A, 0xC9, 0x1A, 0xC9, 0x29, 0xC4,
+    0x9C, 0x97, 0x70, 0xAC, 0x97, 0x0D, 0x71, 0xD7, 0x09, 0xCA, 0x70, 0xAC, 0x97, 0x0D, 0x70, 0x9D,
+    0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x9D, 0x70, 0xAD, 0x70, 0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0x76, 0xAD,
+    0x3E, 0x2E, 0x29, 0xE1, 0xAE, 0x2E, 0xA1, 0xF1, 0x9E, 0xA7, 0x77, 0x77, 0x39, 0xC9, 0x71, 0xD7,
+    0x2D, 0x71, 0x9C, 0xA7, 0x1A, 0xC9, 0x71, 0xD7, 0x19, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x70, 0x9D,
+    0x71, 0xAD, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x00, 0x74, 0x9D, 0x97, 0x71, 0xAE, 0x97,
+    0x72, 0xAC, 0xA7, 0x72, 0x9C, 0xA7, 0x6F, 0xFE, 0x71, 0x9F, 0xFD, 0xA7, 0x19, 0xAA, 0xAA, 0xDA,
+    0xAA, 0xA7, 0x6A, 0xC9, 0x72, 0xAE, 0xA2, 0xD7, 0x19, 0xFE, 0x09, 0xCA, 0x70, 0xAD, 0xA2, 0xAC,
+    0xAD, 0x70, 0x9D, 0xA4, 0xF7, 0x0D, 0xA5, 0xAD, 0x97, 0x9D, 0x95, 0xAD, 0x70, 0xAD, 0x6D, 0x97,
+    0x0A, 0xD5, 0xAC, 0xA7, 0x1A, 0xE9, 0x99, 0xAE, 0x73, 0xFF, 0xC9, 0x73, 0xAF, 0xE9, 0x75, 0x9A,
+    0xEA, 0x74, 0x70, 0xAD, 0x92, 0xC7, 0x09, 0xCA, 0xAC, 0x1A, 0xC7, 0x0C, 0xA1, 0xCA, 0xAC, 0x97,
+    0x9C, 0x91, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x39, 0xC9, 0x0A, 0xAD, 0xA7, 0x0A, 0xFF, 0xC7, 0xFA,
+    0x90, 0x9D, 0x95, 0x9E, 0x4D, 0xA5, 0xAD, 0x94, 0xDA, 0x5E, 0x5D, 0x94, 0x9D, 0x94, 0x9D, 0x94,
+    0xAD, 0x5A, 0xD5, 0xE5, 0xE4, 0x9E, 0x49, 0xDA, 0x4A, 0xDA, 0x4A, 0xDA, 0x4E, 0x94, 0xE9, 0x39,
+    0xE5, 0xE4, 0xAE, 0x49, 0xE4, 0x77, 0x70, 0xDA, 0x76, 0xDA, 0x75, 0x9E, 0x75, 0x99, 0xA9, 0x77,
+    0x77, 0x77, 0x77, 0x75, 0xAA, 0xEA, 0x70, 0x9F, 0xF6, 0xAE, 0x99, 0x99, 0xE4, 0x9D, 0x94, 0x9D,
+    0x4D, 0xA6, 0xD9, 0x29, 0xD7, 0xD9, 0x2D, 0xA6, 0x9D, 0x3D, 0x96, 0xE2, 0x9D, 0x69, 0xD9, 0x29,
+    0xDA, 0x49, 0xE4, 0xFC, 0xAF, 0xC9, 0x4F, 0xFD, 0x96, 0xFF, 0x97, 0x0A, 0xEA, 0x96, 0x75, 0xAC,
+    0x75, 0x9C, 0x97, 0x5D, 0x75, 0xD9, 0x74, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x71, 0xAA, 0xEA, 0x70, 0x9F, 0xF6, 0xAE, 0x99, 0x99, 0xE4, 0x9D, 0x94, 0x9D, 0x4D, 0xA6,
+    0xD9, 0x29, 0xD7, 0xD9, 0x2D, 0xA6, 0x9D, 0x3D, 0x96, 0xE2, 0x9D, 0x69, 0xD9, 0x29, 0xDA, 0x49,
+    0xE4, 0xFC, 0xAF, 0xC9, 0x4F, 0xFD, 0x96, 0xFF, 0x97, 0x0A, 0xEA, 0x96, 0x70, 0xAC, 0x76, 0xE7,
+    0x4A, 0xF7, 0x29, 0xCA, 0x1A, 0xC9, 0x70, 0xC9, 0x4A, 0xA7, 0x77, 0x77, 0x77, 0x2A, 0xAE, 0xA7,
+    0x09, 0xFF, 0x6A, 0xE9, 0x99, 0x9E, 0x49, 0xD9, 0x49, 0xD4, 0xDA, 0x6D, 0x92, 0x9D, 0x7D, 0x92,
+    0xDA, 0x69, 0xD3, 0xD9, 0x6E, 0x29, 0xD6, 0x9D, 0x92, 0x9D, 0xA4, 0x9E, 0x4F, 0xCA, 0xFC, 0x94,
+    0xFF, 0xD9, 0x6F, 0xF9, 0x70, 0xAE, 0xA9, 0x60, 0x77, 0x70, 0x9E, 0x2A, 0xA7, 0xD0, 0xCA, 0x1C,
+    0x96, 0x9C, 0x19, 0xCA, 0xD7, 0xAC, 0x2A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAA, 0xEA, 0x70,
+    0x9F, 0xF6, 0xAE, 0x99, 0x99, 0xE4, 0x9D, 0x94, 0x9D, 0x4D, 0xA6, 0xD9, 0x29, 0xD7, 0xD9, 0x2D,
+    0xA6, 0x9D, 0x3D, 0x96, 0xE2, 0x9D, 0x69, 0xD9, 0x29, 0xDA, 0x49, 0xE4, 0xFC, 0xAF, 0xC9, 0x4F,
+    0xFD, 0x96, 0xFF, 0x97, 0x0A, 0xEA, 0x96, 0x7D, 0xA2, 0x9D, 0xA6, 0xAD, 0xA2, 0xE9, 0x6E, 0xA2,
+    0xE9, 0x5A, 0xE9, 0x1A, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAA, 0xEA, 0x71, 0x9F, 0xF7,
+    0xAE, 0x99, 0x99, 0xE5, 0x9D, 0x94, 0x9D, 0x5D, 0xA6, 0xD9, 0x39, 0xD7, 0xD9, 0x3D, 0xA6, 0x9D,
+    0x4D, 0x96, 0xE3, 0x9D, 0x69, 0xD9, 0x39, 0xDA, 0x49, 0xE5, 0xFC, 0xAF, 0xC9, 0x5F, 0xFD, 0x97,
+    0xFF, 0x97, 0x1A, 0xEA, 0x97, 0x77, 0x69, 0xD9, 0x73, 0xE7, 0x39, 0xE7, 0x3F, 0x77, 0x77, 0x77,
+    0x39, 0x19, 0xAF, 0xFF, 0x09, 0xFF, 0xDA, 0xAA, 0xA7, 0x77, 0x74, 0x9D, 0x97, 0x3E, 0x97, 0x29,
+    0xE7, 0x3F, 0x70, 0x77, 0x69, 0x77, 0x4A, 0xC9, 0x77, 0x39, 0xCA, 0x77, 0x4D, 0x77, 0x49, 0xCA,
+    0x77, 0x4D, 0x77, 0x4A, 0xCA, 0x77, 0x4D, 0x77, 0x4A, 0xC9, 0x77, 0x4D, 0x77, 0x4D, 0x97, 0x73,
+    0x9D, 0x77, 0x0A, 0xAF, 0x97, 0x69, 0xFF, 0x75, 0xAE, 0x99, 0xFC, 0x73, 0x9D, 0x91, 0xAC, 0xA0,
+    0xD7, 0x3D, 0xA1, 0x9D, 0x1D, 0x97, 0x19, 0xD2, 0xD9, 0x1D, 0x72, 0xDA, 0x19, 0xD1, 0x9D, 0x72,
+    0xD9, 0x1D, 0x91, 0xE7, 0x19, 0xD1, 0xAD, 0x19, 0xD9, 0x71, 0x9D, 0x90, 0xD1, 0x9E, 0x73, 0xFF,
+    0xE9, 0x73, 0xFF, 0xD9, 0x75, 0xFF, 0x97, 0x6A, 0xFA, 0x97, 0x70, 0xD9, 0x77, 0x3A, 0xD7, 0x73,
+    0x9D, 0x97, 0x73, 0xE7, 0x73, 0x9D, 0x97, 0x73, 0xDA, 0x77, 0x3A, 0xD7, 0x74, 0xDA, 0x77, 0x3A,
+    0xD7, 0x74, 0xDA, 0x77, 0x3D, 0x97, 0x73, 0x9A, 0x77, 0x77, 0x75, 0x59, 0x97, 0x4D, 0xA7, 0x4E,
+    0x73, 0x9E, 0x75, 0x99, 0x77, 0x77, 0x3D, 0x6D, 0xA1, 0x9D, 0x6D, 0x91, 0xAD, 0x5A, 0xD2, 0xDA,
+    0x5E, 0x2D, 0x95, 0xDA, 0x19, 0xD5, 0x9D, 0x91, 0x9D, 0x5A, 0xD2, 0xAD, 0x5E, 0x2D, 0xA4, 0xAD,
+    0xA2, 0xE3, 0xAE, 0xA2, 0xFF, 0xE9, 0x2F, 0xFE, 0x3F, 0xFE, 0x39, 0xFD, 0x9D, 0xA5, 0x99, 0x97,
+    0x00, 0x73, 0xAC, 0x73, 0xAC, 0x97, 0x29, 0xCA, 0x73, 0xD7, 0x3D, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x7D, 0x6D, 0xA1, 0x9D, 0x6D, 0x91, 0xAD, 0x5A, 0xD2, 0xDA, 0x5E, 0x2D, 0x95, 0xDA, 0x19,
+    0xD5, 0x9D, 0x91, 0x9D, 0x5A, 0xD2, 0xAD, 0x5E, 0x2D, 0xA4, 0xAD, 0xA2, 0xE3, 0xAE, 0xA2, 0xFF,
+    0xE9, 0x2F, 0xFE, 0x3F, 0xFE, 0x39, 0xFD, 0x9D, 0xA5, 0x99, 0x97, 0x00, 0x6A, 0xC7, 0x4E, 0x72,
+    0xDA, 0xD7, 0x0A, 0xC9, 0x1A, 0xC9, 0x59, 0xC9, 0x4C, 0xA7, 0x72, 0xD6, 0xDA, 0x19, 0xD6, 0xD9,
+    0x1A, 0xD5, 0xAD, 0x2D, 0xA5, 0xE2, 0xD9, 0x5D, 0xA1, 0x9D, 0x59, 0xD9, 0x19, 0xD5, 0xAD, 0x2A,
+    0xD5, 0xE2, 0xDA, 0x4A, 0xDA, 0x2E, 0x3A, 0xEA, 0x2F, 0xFE, 0x92, 0xFF, 0xE3, 0xFF, 0xE3, 0x9F,
+    0xD9, 0xDA, 0x59, 0x99, 0x70, 0x5D, 0xA2, 0x9D, 0x94, 0xAD, 0x92, 0xE9, 0x4E, 0x91, 0x9E, 0x4A,
+    0xE2, 0xF7, 0x77, 0x77, 0x73, 0xD6, 0xDA, 0x29, 0xD6, 0xD9, 0x2A, 0xD5, 0xAD, 0x3D, 0xA5, 0xE3,
+    0xD9, 0x5D, 0xA2, 0x9D, 0x59, 0xD9, 0x29, 0xD5, 0xAD, 0x3A, 0xD5, 0xE3, 0xDA, 0x4A, 0xDA, 0x3E,
+    0x3A, 0xEA, 0x3F, 0xFE, 0x93, 0xFF, 0xE4, 0xFF, 0xE4, 0x9F, 0xD9, 0xDA, 0x69, 0x99, 0x71, 0x77,
+    0xCA, 0x77, 0xD7, 0x7A, 0xC9, 0x76, 0x9C, 0xA7, 0x7D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x0D, 0x96, 0xAD, 0x5D, 0xA6, 0xD9, 0x5A, 0xD5, 0xAD, 0x69, 0xD9, 0x39, 0xD9,
+    0x7D, 0xA3, 0xE7, 0x0E, 0x29, 0xD9, 0x70, 0xAD, 0x91, 0xE7, 0x19, 0xDA, 0x0A, 0xD9, 0x72, 0xE0,
+    0xE7, 0x3F, 0xD9, 0x73, 0xAF, 0xC7, 0x49, 0xF9, 0x74, 0x9F, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0xF7,
+    0x4A, 0xF9, 0x71, 0xFE, 0xA7, 0x19, 0xFD, 0x97, 0x2A, 0xF9, 0x77, 0x77, 0x77, 0x4D, 0x97, 0x3D,
+    0x73, 0x9D, 0x73, 0xAC, 0xA7, 0x3E, 0xA9, 0x71, 0xFD, 0x96, 0x9D, 0x1A, 0xDA, 0x5A, 0xCA, 0x29,
+    0xD5, 0xD9, 0x3A, 0xCA, 0x4D, 0x5C, 0xA3, 0x9D, 0x49, 0xC9, 0x3A, 0xCA, 0x4A, 0xC4, 0xD9, 0x39,
+    0xD4, 0xD3, 0x9D, 0x93, 0x9D, 0x29, 0xDA, 0x4A, 0xCA, 0x1A, 0xDA, 0x5D, 0xAA, 0xE9, 0x6F, 0xCA,
+    0x79, 0xD9, 0x97, 0x1A, 0xCA, 0x73, 0xD9, 0x73, 0xD7, 0x39, 0xD7, 0x3A, 0xCA, 0x73, 0x99, 0x74,
+    0x70, 0xAD, 0x3E, 0x71, 0xE2, 0x9E, 0x70, 0xAE, 0x2F, 0x70, 0xF2, 0xEA, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x71, 0xD9, 0x6A, 0xD6, 0xDA, 0x6D, 0x96, 0xAD, 0x5A, 0xD7, 0x9D, 0x93, 0x9D, 0x97,
+    0x0D, 0xA3, 0xE7, 0x1E, 0x29, 0xD9, 0x71, 0xAD, 0x91, 0xE7, 0x29, 0xDA, 0x0A, 0xD9, 0x73, 0xE0,
+    0xE7, 0x4F, 0xD9, 0x74, 0xAF, 0xC7, 0x59, 0xF9, 0x75, 0x9F, 0x76, 0x9E, 0x97, 0x6F, 0x76, 0xF7,
+    0x5A, 0xF9, 0x72, 0xFE, 0xA7, 0x29, 0xFD, 0x97, 0x3A, 0xF9, 0x77, 0x77, 0x10, 0x77, 0x77, 0x1A,
+    0xAA, 0xAF, 0xD7, 0x2F, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9D, 0xA7, 0x71, 0xF7,
+    0x70, 0xAF, 0x77, 0x9F, 0xC7, 0x7D, 0xAA, 0xD7, 0x6A, 0xD0, 0xAD, 0x75, 0x9D, 0x90, 0x9D, 0x97,
+    0x4D, 0xA1, 0x9D, 0x97, 0x3A, 0xD2, 0x9D, 0xA7, 0x29, 0xD9, 0x3D, 0xA7, 0x2E, 0x4E, 0x71, 0xAD,
+    0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x0E, 0x6E, 0x7A, 0xFF, 0xFC, 0x95, 0x9F, 0xFF, 0xD9, 0x5F, 0xFF,
+    0xE9, 0x4A, 0xE9, 0x99, 0x99, 0x99, 0x99, 0xEA, 0x39, 0xE7, 0x1E, 0xA3, 0xEA, 0x71, 0xF2, 0xAE,
+    0x72, 0xF2, 0x77, 0x6A, 0xAA, 0xAF, 0xD5, 0x9F, 0xFD, 0x77, 0x77, 0x77, 0x72, 0xAF, 0x0A, 0xC6,
+    0x9F, 0xFC, 0x59, 0xDA, 0x2A, 0xE5, 0xD9, 0x4D, 0xA4, 0xD9, 0x5D, 0xA3, 0x9D, 0x6D, 0x93, 0xD6,
+    0x9D, 0x4D, 0x6E, 0x39, 0xCA, 0x5A, 0xE3, 0xAD, 0x4F, 0xA3, 0xAF, 0xFE, 0xA3, 0x9F, 0xFE, 0x94,
+    0xFF, 0x9D, 0x6A, 0xFA, 0x09, 0xD3, 0x73, 0xA9, 0x59, 0x97, 0x3C, 0xA5, 0xC9, 0x73, 0xD9, 0x29,
+    0xD7, 0x4A, 0xFE, 0x76, 0xAF, 0xA7, 0x71, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0xDA,
+    0x77, 0x1F, 0x77, 0x0A, 0xF7, 0x79, 0xFC, 0x77, 0xDA, 0xAD, 0x76, 0xAD, 0x0A, 0xD7, 0x59, 0xD9,
+    0x09, 0xD9, 0x74, 0xDA, 0x19, 0xD9, 0x73, 0xAD, 0x29, 0xDA, 0x72, 0x9D, 0x93, 0xDA, 0x72, 0xE4,
+    0xE7, 0x1A, 0xD5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0xE6, 0xE7, 0xAF, 0xFF, 0xC9, 0x59, 0xFF, 0xFD,
+    0x95, 0xFF, 0xFE, 0x94, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA3, 0x9E, 0x71, 0xEA, 0x3E, 0xA7,
+    0x1F, 0x2A, 0xE7, 0x2F, 0x20, 0x5A, 0xC5, 0x9C, 0x6D, 0x5C, 0xA6, 0xAD, 0x99, 0x9A, 0xD7, 0x0F,
+    0xE7, 0x2A, 0xE9, 0x77, 0x77, 0x77, 0x75, 0xAE, 0xA0, 0xAC, 0x69, 0xFF, 0xC5, 0x9D, 0xA2, 0xAE,
+    0x5D, 0x94, 0xDA, 0x4D, 0x95, 0xDA, 0x39, 0xD6, 0xD9, 0x3D, 0x69, 0xD4, 0xD6, 0xE3, 0x9C, 0xA5,
+    0xAE, 0x3A, 0xD4, 0xFA, 0x3A, 0xFF, 0xEA, 0x39, 0xFF, 0xE9, 0x4F, 0xF9, 0xD6, 0xAF, 0xA0, 0x9D,
+    0x30, 0x74, 0x9D, 0xA7, 0x7F, 0x76, 0xAF, 0x75, 0x9F, 0xC7, 0x5D, 0xAA, 0xD7, 0x4A, 0xD0, 0xAD,
+    0x73, 0x9D, 0x90, 0x9D, 0x97, 0x2D, 0xA1, 0x9D, 0x97, 0x1A, 0xD2, 0x9D, 0xA7, 0x09, 0xD9, 0x3D,
+    0xA7, 0x0E, 0x4E, 0x7A, 0xD5, 0xE6, 0x9D, 0xA5, 0xE6, 0xE6, 0xE5, 0xAF, 0xFF, 0xC9, 0x39, 0xFF,
+    0xFD, 0x93, 0xFF, 0xFE, 0x92, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA1, 0x9E, 0x71, 0xEA, 0x1E,
+    0xA7, 0x1F, 0x0A, 0xE7, 0x2F, 0x76, 0x9C, 0x97, 0x7A, 0xC9, 0x77, 0x9C, 0x97, 0x70, 0xAC, 0x77,
+    0x19, 0xE9, 0x77, 0x09, 0xA3, 0x77, 0x6A, 0xEA, 0x0A, 0xC5, 0x9F, 0xFC, 0x49, 0xDA, 0x2A, 0xE4,
+    0xD9, 0x4D, 0xA3, 0xD9, 0x5D, 0xA2, 0x9D, 0x6D, 0x92, 0xD6, 0x9D, 0x3D, 0x6E, 0x29, 0xCA, 0x5A,
+    0xE2, 0xAD, 0x4F, 0xA2, 0xAF, 0xFE, 0xA2, 0x9F, 0xFE, 0x93, 0xFF, 0x9D, 0x5A, 0xFA, 0x9E, 0x72,
+    0x9C, 0xA7, 0x4C, 0xA7, 0x5D, 0xAA, 0x74, 0xAD, 0x77, 0x30, 0x77, 0x09, 0xC9, 0x77, 0x2C, 0xA7,
+    0x72, 0xD7, 0x72, 0xAC, 0x97, 0x71, 0x9D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x59, 0xAF, 0xCA, 0x73, 0xAF, 0xFC, 0x71, 0xAF, 0xFD, 0x97, 0x0F, 0xC9, 0x76, 0xF9, 0x77, 0xF7,
+    0x70, 0xF7, 0x70, 0x9E, 0x77, 0x1E, 0x97, 0x70, 0xAE, 0x77, 0x1E, 0x97, 0x70, 0x9E, 0x77, 0x1A,
+    0xE7, 0x71, 0xFA, 0x77, 0x0F, 0xC9, 0x79, 0x6F, 0xEA, 0xA9, 0x9A, 0xE6, 0xFF, 0xFD, 0xA6, 0xAF,
+    0xFF, 0xC9, 0x7F, 0xFF, 0xC7, 0x09, 0xFF, 0xF7, 0x2A, 0xFF, 0xA9, 0x77, 0x73, 0x73, 0x9C, 0x97,
+    0x3D, 0x73, 0xD7, 0x3A, 0xCA, 0x72, 0x9D, 0x77, 0x77, 0x77, 0x77, 0x49, 0xAF, 0xA6, 0xAF, 0xDA,
+    0x5F, 0x91, 0x95, 0xAD, 0xA7, 0x2D, 0xA7, 0x29, 0xD7, 0x3D, 0xA7, 0x3D, 0x97, 0x3D, 0x97, 0x29,
+    0xDA, 0x72, 0x9E, 0xA7, 0x2F, 0xF6, 0x9F, 0xF7, 0xAF, 0xCA, 0x77, 0x20, 0x75, 0x9C, 0x97, 0x72,
+    0xE9, 0x77, 0x0A, 0xDA, 0xCA, 0x76, 0x9C, 0xA1, 0x9C, 0xA7, 0x5C, 0x94, 0x9A, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x59, 0xAF, 0xCA, 0x73, 0xAF, 0xFC, 0x71, 0xAF, 0xFD, 0x97, 0x0F, 0xC9, 0x76,
+    0xF9, 0x77, 0xF7, 0x70, 0xF7, 0x70, 0x9E, 0x77, 0x1E, 0x97, 0x70, 0xAE, 0x77, 0x1E, 0x97, 0x70,
+    0x9E, 0x77, 0x1A, 0xE7, 0x71, 0xFA, 0x77, 0x0F, 0xC9, 0x79, 0x6F, 0xEA, 0xA9, 0x9A, 0xE6, 0xFF,
+    0xFD, 0xA6, 0xAF, 0xFF, 0xC9, 0x7F, 0xFF, 0xC7, 0x09, 0xFF, 0xF7, 0x2A, 0xFF, 0xA9, 0x77, 0x73,
+    0x70, 0x9C, 0x97, 0x5A, 0xD9, 0x73, 0x9F, 0x97, 0x2D, 0x19, 0xCA, 0x70, 0xCA, 0x4A, 0xC7, 0x77,
+    0x77, 0x09, 0xAF, 0xA7, 0x0A, 0xFD, 0xA7, 0xF9, 0x19, 0x7A, 0xDA, 0x74, 0xDA, 0x74, 0x9D, 0x75,
+    0xDA, 0x75, 0xD9, 0x75, 0xD9, 0x74, 0x9D, 0xA7, 0x49, 0xEA, 0x74, 0xFF, 0x70, 0x9F, 0xF7, 0x1A,
+    0xFC, 0xA7, 0x76, 0x76, 0xE7, 0x71, 0x9D, 0xA7, 0x71, 0xEA, 0x77, 0x09, 0xE9, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0xAF, 0xCA, 0x73, 0xAF, 0xFC, 0x71, 0xAF, 0xFD, 0x97,
+    0x0F, 0xC9, 0x76, 0xF9, 0x77, 0xF7, 0x70, 0xF7, 0x70, 0x9E, 0x77, 0x1E, 0x97, 0x70, 0xAE, 0x77,
+    0x1E, 0x97, 0x70, 0x9E, 0x77, 0x1A, 0xE7, 0x71, 0xFA, 0x77, 0x0F, 0xC9, 0x79, 0x6F, 0xEA, 0xA9,
+    0x9A, 0xE6, 0xFF, 0xFD, 0xA6, 0xAF, 0xFF, 0xC9, 0x7F, 0xFF, 0xC7, 0x09, 0xFF, 0xF7, 0x2A, 0xFF,
+    0xA9, 0x77, 0x73, 0x77, 0x6E, 0x70, 0x9E, 0x70, 0xEA, 0x79, 0xEA, 0x77, 0x77, 0x74, 0x9A, 0xFA,
+    0x4A, 0xFD, 0xA3, 0xF9, 0x19, 0x3A, 0xDA, 0x70, 0xDA, 0x70, 0x9D, 0x71, 0xDA, 0x71, 0xD9, 0x71,
+    0xD9, 0x70, 0x9D, 0xA7, 0x09, 0xEA, 0x70, 0xFF, 0x49, 0xFF, 0x5A, 0xFC, 0xA7, 0x60, 0x71, 0x9A,
+    0x5A, 0x97, 0x4D, 0x29, 0xCA, 0x76, 0xD9, 0xD9, 0x77, 0x9E, 0x77, 0x2D, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xAF, 0xCA, 0x73, 0xAF, 0xFC, 0x71, 0xAF, 0xFD, 0x97, 0x0F,
+    0xC9, 0x76, 0xF9, 0x77, 0xF7, 0x70, 0xF7, 0x70, 0x9E, 0x77, 0x1E, 0x97, 0x70, 0xAE, 0x77, 0x1E,
+    0x97, 0x70, 0x9E, 0x77, 0x1A, 0xE7, 0x71, 0xFA, 0x77, 0x0F, 0xC9, 0x79, 0x6F, 0xEA, 0xA9, 0x9A,
+    0xE6, 0xFF, 0xFD, 0xA6, 0xAF, 0xFF, 0xC9, 0x7F, 0xFF, 0xC7, 0x09, 0xFF, 0xF7, 0x2A, 0xFF, 0xA9,
+    0x77, 0x73, 0x59, 0x59, 0x96, 0xD3, 0xAC, 0x70, 0xD0, 0xAC, 0xA7, 0x19, 0xE9, 0x73, 0xD9, 0x75,
+    0x97, 0x77, 0x77, 0x77, 0x39, 0xAF, 0xA7, 0xAF, 0xDA, 0x6F, 0x91, 0x96, 0xAD, 0xA7, 0x3D, 0xA7,
+    0x39, 0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x4D, 0x97, 0x39, 0xDA, 0x73, 0x9E, 0xA7, 0x3F, 0xF7, 0x9F,
+    0xF7, 0x0A, 0xFC, 0xA7, 0x74, 0x77, 0x76, 0x9C, 0x93, 0x9C, 0x97, 0x4A, 0xC9, 0x09, 0xD7, 0x7F,
+    0xA7, 0x70, 0x9D, 0xA7, 0x72, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x99, 0x99, 0x99, 0x97, 0x59,
+    0xFF, 0xCA, 0x72, 0xAF, 0xFE, 0xA7, 0x0F, 0xFF, 0xCA, 0x7D, 0xA4, 0x9A, 0xF9, 0x59, 0xD9, 0x7F,
+    0x5E, 0x70, 0x9E, 0x5E, 0x71, 0xE9, 0x39, 0xDA, 0x71, 0xEA, 0x3A, 0xD9, 0x71, 0xEA, 0x3E, 0x72,
+    0xEA, 0x3E, 0x72, 0xE9, 0x29, 0xDA, 0x71, 0x9E, 0x3A, 0xD9, 0x71, 0xF3, 0xE7, 0x19, 0xEA, 0x3E,
+    0x70, 0xAF, 0x92, 0x9D, 0xA9, 0x99, 0x99, 0xAA, 0xFE, 0x3A, 0xFF, 0xFF, 0x4F, 0xFF, 0xF5, 0xFF,
+    0xFE, 0x59, 0xFF, 0xFC, 0x96, 0xFF, 0xCA, 0xA9, 0x71, 0x77, 0x0D, 0x77, 0x4A, 0xD7, 0x74, 0xD9,
+    0x1A, 0xC9, 0x77, 0xD2, 0xD7, 0x7A, 0xD1, 0x9D, 0x77, 0xDA, 0x1A, 0xC9, 0x70, 0x9A, 0xA9, 0x2D,
+    0x2D, 0x70, 0xFD, 0x0A, 0xD2, 0x99, 0x69, 0xFE, 0xAD, 0xA7, 0x29, 0xDA, 0x2A, 0xF7, 0x29, 0xD9,
+    0x4F, 0x72, 0xD9, 0x5E, 0xA7, 0x19, 0xD6, 0xE9, 0x71, 0xD9, 0x59, 0xE7, 0x2D, 0x95, 0xAD, 0xA7,
+    0x19, 0xD9, 0x49, 0xE9, 0x71, 0x9E, 0x92, 0xAF, 0x72, 0x9F, 0xFF, 0x73, 0xFF, 0xF7, 0x4F, 0xFD,
+    0xA7, 0x5A, 0xF9, 0x0D, 0x97, 0x77, 0x71, 0x69, 0x99, 0x99, 0x99, 0x76, 0x9F, 0xFC, 0xA7, 0x3A,
+    0xFF, 0xEA, 0x71, 0xFF, 0xFC, 0xA7, 0x0D, 0xA4, 0x9A, 0xF9, 0x69, 0xD9, 0x7F, 0x6A, 0xD7, 0x09,
+    0xE6, 0xE7, 0x1E, 0x95, 0xDA, 0x71, 0xE9, 0x49, 0xD9, 0x71, 0xEA, 0x1A, 0xAA, 0xEA, 0xAA, 0xA9,
+    0x5E, 0xA0, 0xAF, 0xFD, 0xA5, 0xE9, 0x0F, 0xFE, 0x59, 0xE9, 0x3A, 0xD9, 0x71, 0xAE, 0x4E, 0x71,
+    0x9F, 0x4E, 0x70, 0xAF, 0x93, 0x9D, 0xA9, 0x99, 0x99, 0x9A, 0xFE, 0x4A, 0xFF, 0xFF, 0x5F, 0xFF,
+    0xF9, 0x5F, 0xFF, 0xE6, 0x9F, 0xFF, 0xC9, 0x7F, 0xFC, 0xAA, 0x97, 0x10, 0x77, 0x0D, 0x77, 0x3A,
+    0xD7, 0x73, 0xD9, 0x76, 0xFF, 0xE9, 0x72, 0xFF, 0xE7, 0x3A, 0xAA, 0xAE, 0xAA, 0xA9, 0x70, 0x9A,
+    0xA9, 0x2D, 0x74, 0xFD, 0x0A, 0xD7, 0x29, 0xFE, 0xAD, 0xA7, 0x19, 0xDA, 0x2A, 0xF7, 0x19, 0xD9,
+    0x4F, 0x71, 0xD9, 0x5E, 0xA7, 0x09, 0xD6, 0xE9, 0x70, 0xD9, 0x59, 0xE7, 0x1D, 0x95, 0xAD, 0xA7,
+    0x09, 0xD9, 0x49, 0xE9, 0x70, 0x9E, 0x92, 0xAF, 0x71, 0x9F, 0xFF, 0x72, 0xFF, 0xF7, 0x3F, 0xFD,
+    0xA7, 0x4A, 0xF9, 0x0D, 0x97, 0x77, 0x70, 0x77, 0x74, 0x9A, 0xAA, 0xFD, 0x97, 0x9F, 0xFD, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x75, 0xAF, 0xFE, 0xA6, 0xFF, 0xF6, 0x9F, 0xEA, 0xAA, 0xA9, 0x6A, 0xD7,
+    0x70, 0xE7, 0x70, 0xDA, 0x77, 0xAD, 0x77, 0x0E, 0x77, 0x0F, 0xFC, 0xA7, 0x09, 0xFF, 0xC9, 0x70,
+    0xAF, 0xFC, 0x71, 0xE7, 0x79, 0xDA, 0x77, 0xAD, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0xAD, 0xA9, 0x99,
+    0x99, 0x99, 0x99, 0x6F, 0xFF, 0xC6, 0xFF, 0xFC, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFC, 0x50, 0x77,
+    0x70, 0x9A, 0xAA, 0xFD, 0x96, 0xFF, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xEA, 0x72,
+    0xAE, 0xAE, 0x70, 0xE9, 0x3C, 0xA6, 0xAC, 0xA5, 0xAC, 0x5A, 0xCA, 0x59, 0xD5, 0xDA, 0xAA, 0xFE,
+    0x4A, 0xFF, 0xF4, 0xDA, 0x99, 0x99, 0x72, 0xD7, 0x69, 0xD9, 0x75, 0x9E, 0x76, 0xFA, 0x99, 0x99,
+    0xAC, 0x95, 0xAF, 0xFD, 0x7A, 0xFF, 0xC7, 0x09, 0xAF, 0xA9, 0x50, 0x70, 0x9C, 0x59, 0xC7, 0x1A,
+    0xC9, 0x4D, 0x71, 0x9D, 0xA9, 0x9A, 0xD9, 0x72, 0xFE, 0x97, 0x4A, 0xEA, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x71, 0xAF, 0xFE, 0xA6, 0xFF, 0xF6, 0x9F, 0xEA, 0xAA, 0xA9, 0x6A, 0xD7, 0x70, 0xE7, 0x70,
+    0xDA, 0x77, 0xAD, 0x77, 0x0E, 0x77, 0x0F, 0xFC, 0xA7, 0x09, 0xFF, 0xC9, 0x70, 0xAF, 0xFC, 0x71,
+    0xE7, 0x79, 0xDA, 0x77, 0xAD, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x99,
+    0x6F, 0xFF, 0xC6, 0xFF, 0xFC, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFC, 0x50, 0x7A, 0x69, 0x79, 0xC9,
+    0x49, 0xC7, 0x9D, 0x3A, 0xCA, 0x70, 0xFE, 0xA7, 0x2F, 0xC9, 0x75, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0xAE, 0xA7, 0x2A, 0xEA, 0xE7, 0x0E, 0x93, 0xCA, 0x6A, 0xCA, 0x5A, 0xC5, 0xAC, 0xA5,
+    0x9D, 0x5D, 0xAA, 0xAF, 0xE4, 0xAF, 0xFF, 0x4D, 0xA9, 0x99, 0x97, 0x2D, 0x76, 0x9D, 0x97, 0x59,
+    0xE7, 0x6F, 0xA9, 0x99, 0x9A, 0xC9, 0x5A, 0xFF, 0xD7, 0xAF, 0xFC, 0x70, 0x9A, 0xFA, 0x95, 0x77,
+    0x77, 0xAD, 0x77, 0xE7, 0x6A, 0xE7, 0x6F, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xFF, 0xEA, 0x5F,
+    0xFF, 0x59, 0xFE, 0xAA, 0xAA, 0x95, 0xAD, 0x77, 0xE7, 0x7D, 0xA7, 0x6A, 0xD7, 0x7E, 0x77, 0xFF,
+    0xCA, 0x79, 0xFF, 0xC9, 0x7A, 0xFF, 0xC7, 0x0E, 0x76, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xE7, 0x7E,
+    0x76, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x49, 0xFF, 0xFC, 0x4A,
+    0xFF, 0xFC, 0x40, 0x77, 0x72, 0x9D, 0x97, 0x3E, 0x73, 0x9E, 0x73, 0xF7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x1A, 0xEA, 0x70, 0xAE, 0xAE, 0x6E, 0x93, 0xCA, 0x4A, 0xCA, 0x5A, 0xC3, 0xAC, 0xA5, 0x9D,
+    0x3D, 0xAA, 0xAF, 0xE2, 0xAF, 0xFF, 0x2D, 0xA9, 0x99, 0x97, 0x0D, 0x74, 0x9D, 0x97, 0x39, 0xE7,
+    0x4F, 0xA9, 0x99, 0x9A, 0xC9, 0x3A, 0xFF, 0xD5, 0xAF, 0xFC, 0x69, 0xAF, 0xA9, 0x30, 0x77, 0x70,
+    0xAF, 0xFE, 0xA5, 0xFF, 0xF5, 0x9F, 0xEA, 0xAA, 0xA9, 0x5A, 0xD7, 0x7E, 0x77, 0xDA, 0x76, 0xAD,
+    0x77, 0xE7, 0x7F, 0xFC, 0xA7, 0x9F, 0xFC, 0x97, 0xAF, 0xFC, 0x70, 0xE7, 0x69, 0xDA, 0x76, 0xAD,
+    0x97, 0x6E, 0x77, 0xE7, 0x6A, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x95, 0xFF, 0xFC, 0x5F, 0xFF, 0xC4,
+    0x9F, 0xFF, 0xC4, 0xAF, 0xFF, 0xC7, 0x1A, 0xC7, 0x7A, 0xC7, 0x70, 0xC9, 0x77, 0x0F, 0x77, 0x9A,
+    0xA7, 0x20, 0x7A, 0xEA, 0x70, 0xAE, 0xAE, 0x6E, 0x93, 0xCA, 0x4A, 0xCA, 0x5A, 0xC3, 0xAC, 0xA5,
+    0x9D, 0x3D, 0xAA, 0xAF, 0xE2, 0xAF, 0xFF, 0x2D, 0xA9, 0x99, 0x97, 0x0D, 0x74, 0x9D, 0x97, 0x39,
+    0xE7, 0x4F, 0xA9, 0x99, 0x9A, 0xC9, 0x3A, 0xFF, 0xD5, 0xAF, 0xFC, 0x69, 0xAF, 0xA9, 0x71, 0xCA,
+    0x73, 0x9C, 0xA7, 0x4C, 0x97, 0x4A, 0xC7, 0x59, 0xE9, 0x74, 0x9A, 0x97, 0x77, 0x73, 0xD4, 0xCA,
+    0x72, 0xD1, 0xAC, 0x97, 0x39, 0xF7, 0x6A, 0xD7, 0x70, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0xAF,
+    0xFE, 0xA5, 0xFF, 0xF5, 0x9F, 0xEA, 0xAA, 0xA9, 0x5A, 0xD7, 0x7E, 0x77, 0xDA, 0x76, 0xAD, 0x77,
+    0xE7, 0x7F, 0xFC, 0xA7, 0x9F, 0xFC, 0x97, 0xAF, 0xFC, 0x70, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0x97,
+    0x6E, 0x77, 0xE7, 0x6A, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x95, 0xFF, 0xFC, 0x5F, 0xFF, 0xC4, 0x9F,
+    0xFF, 0xC4, 0xAF, 0xFF, 0xC4, 0x69, 0x69, 0x7A, 0xC9, 0x29, 0xC9, 0x70, 0xAC, 0x90, 0xD9, 0x72,
+    0xF7, 0x49, 0xD7, 0x69, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xEA, 0x71, 0xAE, 0xAE, 0x7E,
+    0x93, 0xCA, 0x5A, 0xCA, 0x5A, 0xC4, 0xAC, 0xA5, 0x9D, 0x4D, 0xAA, 0xAF, 0xE3, 0xAF, 0xFF, 0x3D,
+    0xA9, 0x99, 0x97, 0x1D, 0x75, 0x9D, 0x97, 0x49, 0xE7, 0x5F, 0xA9, 0x99, 0x9A, 0xC9, 0x4A, 0xFF,
+    0xD6, 0xAF, 0xFC, 0x79, 0xAF, 0xA9, 0x40, 0x76, 0xCA, 0x77, 0x29, 0xDA, 0x77, 0x1D, 0xAC, 0xA7,
+    0x7D, 0x2D, 0x75, 0xAC, 0x49, 0xC9, 0x77, 0x77, 0x77, 0x72, 0x99, 0x75, 0x9F, 0xFD, 0x97, 0xAF,
+    0xFF, 0x96, 0xFC, 0xA9, 0x59, 0x95, 0xF9, 0x77, 0xF9, 0x77, 0x9E, 0xA7, 0x70, 0xF7, 0x71, 0xE9,
+    0x77, 0x0A, 0xE7, 0x71, 0xEA, 0x77, 0x1E, 0x95, 0x9A, 0xA9, 0x95, 0x9E, 0x69, 0xFE, 0x91, 0xAE,
+    0x7A, 0xAF, 0xC9, 0x1A, 0xE7, 0x2D, 0xAA, 0x2A, 0xE7, 0x19, 0xD4, 0xFC, 0x70, 0xE4, 0xAF, 0xDA,
+    0xAA, 0xAA, 0xFA, 0x49, 0xFF, 0xFE, 0xA5, 0xFF, 0xFE, 0x96, 0xFF, 0xFC, 0xA7, 0x09, 0xAF, 0xEA,
+    0x96, 0x72, 0xAC, 0x97, 0x7E, 0x76, 0xAC, 0xAD, 0x97, 0x39, 0xC9, 0x19, 0xCA, 0x72, 0xC9, 0x4A,
+    0xA7, 0x77, 0x77, 0x6A, 0xE2, 0xAA, 0x7A, 0xFD, 0x9A, 0xD6, 0xAD, 0xAA, 0xAF, 0xCA, 0x59, 0xD3,
+    0x9F, 0x95, 0xD9, 0x4F, 0x59, 0xCA, 0x5E, 0xA5, 0xD6, 0xE9, 0x5D, 0x59, 0xE6, 0xCA, 0x5E, 0xA5,
+    0x9D, 0x39, 0xF9, 0x6F, 0xFE, 0x7F, 0xFD, 0xA7, 0x9F, 0xFC, 0x97, 0x09, 0xEA, 0x9A, 0xD7, 0x69,
+    0xDA, 0x75, 0x9E, 0x79, 0xA2, 0x9F, 0xA7, 0xFF, 0xD7, 0x9F, 0xFC, 0x70, 0x9A, 0xFD, 0xA7, 0x49,
+    0x99, 0x74, 0x72, 0x9A, 0x69, 0x73, 0xAC, 0x5A, 0xC7, 0x3A, 0xCA, 0x3A, 0xC9, 0x74, 0xFE, 0xA7,
+    0x59, 0xFC, 0x97, 0x71, 0x97, 0x77, 0x77, 0x77, 0x77, 0x76, 0x99, 0x75, 0x9F, 0xFD, 0x97, 0xAF,
+    0xFF, 0x96, 0xFC, 0xA9, 0x59, 0x95, 0xF9, 0x77, 0xF9, 0x77, 0x9E, 0xA7, 0x70, 0xF7, 0x71, 0xE9,
+    0x77, 0x0A, 0xE7, 0x71, 0xEA, 0x77, 0x1E, 0x95, 0x9A, 0xA9, 0x95, 0x9E, 0x69, 0xFE, 0x91, 0xAE,
+    0x7A, 0xAF, 0xC9, 0x1A, 0xE7, 0x2D, 0xAA, 0x2A, 0xE7, 0x19, 0xD4, 0xFC, 0x70, 0xE4, 0xAF, 0xDA,
+    0xAA, 0xAA, 0xFA, 0x49, 0xFF, 0xFE, 0xA5, 0xFF, 0xFE, 0x96, 0xFF, 0xFC, 0xA7, 0x09, 0xAF, 0xEA,
+    0x96, 0x7C, 0xA5, 0xCA, 0x7C, 0xA4, 0xAC, 0x70, 0xDA, 0x99, 0x9D, 0xA7, 0x0A, 0xFD, 0xA7, 0x29,
+    0xEA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xE2, 0xAA, 0x6A, 0xFD, 0x9A, 0xD5, 0xAD, 0xAA, 0xAF,
+    0xCA, 0x49, 0xD3, 0x9F, 0x94, 0xD9, 0x4F, 0x49, 0xCA, 0x5E, 0xA4, 0xD6, 0xE9, 0x4D, 0x59, 0xE5,
+    0xCA, 0x5E, 0xA4, 0x9D, 0x39, 0xF9, 0x5F, 0xFE, 0x6F, 0xFD, 0xA6, 0x9F, 0xFC, 0x97, 0x9E, 0xA9,
+    0xAD, 0x75, 0x9D, 0xA7, 0x49, 0xE6, 0x9A, 0x29, 0xFA, 0x6F, 0xFD, 0x69, 0xFF, 0xC7, 0x9A, 0xFD,
+    0xA7, 0x39, 0x99, 0x73, 0x77, 0x77, 0x3A, 0xD7, 0x71, 0xE7, 0x70, 0xAE, 0x77, 0x0F, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x09, 0x97, 0x49, 0xFF, 0xD9, 0x6A, 0xFF, 0xF9, 0x5F, 0xCA, 0x95, 0x99, 0x4F,
+    0x97, 0x6F, 0x97, 0x69, 0xEA, 0x77, 0xF7, 0x70, 0xE9, 0x77, 0xAE, 0x77, 0x0E, 0xA7, 0x70, 0xE9,
+    0x59, 0xAA, 0x99, 0x49, 0xE6, 0x9F, 0xE9, 0x0A, 0xE7, 0xAA, 0xFC, 0x90, 0xAE, 0x72, 0xDA, 0xA1,
+    0xAE, 0x71, 0x9D, 0x3F, 0xC7, 0x0E, 0x3A, 0xFD, 0xAA, 0xAA, 0xAF, 0xA3, 0x9F, 0xFF, 0xEA, 0x4F,
+    0xFF, 0xE9, 0x5F, 0xFF, 0xCA, 0x79, 0xAF, 0xEA, 0x95, 0x73, 0xDA, 0x75, 0xAD, 0xA7, 0x5E, 0x97,
+    0x4A, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xE2, 0xAA, 0x6A, 0xFD, 0x9A, 0xD5, 0xAD, 0xAA,
+    0xAF, 0xCA, 0x49, 0xD3, 0x9F, 0x94, 0xD9, 0x4F, 0x49, 0xCA, 0x5E, 0xA4, 0xD6, 0xE9, 0x4D, 0x59,
+    0xE5, 0xCA, 0x5E, 0xA4, 0x9D, 0x39, 0xF9, 0x5F, 0xFE, 0x6F, 0xFD, 0xA6, 0x9F, 0xFC, 0x97, 0x9E,
+    0xA9, 0xAD, 0x75, 0x9D, 0xA7, 0x49, 0xE6, 0x9A, 0x29, 0xFA, 0x6F, 0xFD, 0x69, 0xFF, 0xC7, 0x9A,
+    0xFD, 0xA7, 0x39, 0x99, 0x73, 0x76, 0x99, 0x74, 0x9F, 0xFD, 0x96, 0xAF, 0xFF, 0x95, 0xFC, 0xA9,
+    0x59, 0x94, 0xF9, 0x76, 0xF9, 0x76, 0x9E, 0xA7, 0x7F, 0x77, 0x0E, 0x97, 0x7A, 0xE7, 0x70, 0xEA,
+    0x77, 0x0E, 0x95, 0x9A, 0xA9, 0x94, 0x9E, 0x69, 0xFE, 0x90, 0xAE, 0x7A, 0xAF, 0xC9, 0x0A, 0xE7,
+    0x2D, 0xAA, 0x1A, 0xE7, 0x19, 0xD3, 0xFC, 0x70, 0xE3, 0xAF, 0xDA, 0xAA, 0xAA, 0xFA, 0x39, 0xFF,
+    0xFE, 0xA4, 0xFF, 0xFE, 0x95, 0xFF, 0xFC, 0xA7, 0x9A, 0xFE, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x3F, 0x77, 0xAE, 0x97, 0x7F, 0x77, 0x9E, 0x97, 0x7F, 0x77, 0x9E, 0x97, 0x7E, 0xA7, 0x77,
+    0x60, 0x73, 0xAE, 0xA7, 0x4F, 0x74, 0x9E, 0xA7, 0x4A, 0xE7, 0x5E, 0x97, 0x4A, 0xE7, 0x49, 0xE9,
+    0x77, 0x77, 0x77, 0xAE, 0x2A, 0xA6, 0xAF, 0xD9, 0xAD, 0x5A, 0xDA, 0xAA, 0xFC, 0xA4, 0x9D, 0x39,
+    0xF9, 0x4D, 0x94, 0xF4, 0x9C, 0xA5, 0xEA, 0x4D, 0x6E, 0x94, 0xD5, 0x9E, 0x5C, 0xA5, 0xEA, 0x49,
+    0xD3, 0x9F, 0x95, 0xFF, 0xE6, 0xFF, 0xDA, 0x69, 0xFF, 0xC9, 0x79, 0xEA, 0x9A, 0xD7, 0x59, 0xDA,
+    0x74, 0x9E, 0x69, 0xA2, 0x9F, 0xA6, 0xFF, 0xD6, 0x9F, 0xFC, 0x79, 0xAF, 0xDA, 0x73, 0x99, 0x97,
+    0x30, 0x72, 0x9C, 0xA7, 0x73, 0xE9, 0x77, 0x19, 0xDA, 0xCA, 0x77, 0x0C, 0xA1, 0x9D, 0x76, 0xCA,
+    0x49, 0xC7, 0x77, 0x77, 0x77, 0x0E, 0x71, 0xE6, 0xE7, 0x1E, 0x59, 0xDA, 0x70, 0xAD, 0xA5, 0xAD,
+    0x97, 0x0E, 0x95, 0xE7, 0x1E, 0x59, 0xE7, 0x09, 0xE5, 0xAE, 0x70, 0xAD, 0xA5, 0xEA, 0x70, 0xE9,
+    0x5E, 0x97, 0x9E, 0x59, 0xE7, 0x0A, 0xE5, 0xF7, 0x0F, 0x5F, 0xFF, 0xFA, 0x49, 0xFF, 0xFF, 0x94,
+    0xAF, 0xFF, 0xF5, 0xFF, 0xFF, 0xC4, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0x4A, 0xE9, 0x7F, 0x94,
+    0xF7, 0x0F, 0x5F, 0x79, 0xF4, 0x9F, 0x7A, 0xEA, 0x4A, 0xEA, 0x7F, 0xA4, 0x7C, 0xA7, 0x49, 0xDA,
+    0x73, 0xDA, 0xCA, 0x71, 0xD9, 0x1D, 0x7A, 0xC4, 0x9C, 0x97, 0x77, 0xD9, 0x74, 0xD7, 0x4A, 0xCA,
+    0x74, 0xD9, 0x74, 0xD7, 0x4A, 0xCA, 0x74, 0xD9, 0x74, 0xD1, 0x9A, 0x99, 0x6A, 0xDA, 0xFD, 0x5F,
+    0xFD, 0xA3, 0x9F, 0x92, 0xE3, 0xAE, 0x49, 0xD3, 0xE5, 0x9C, 0xA2, 0x9D, 0xA5, 0xAC, 0xA2, 0xAD,
+    0x6D, 0x92, 0xE6, 0xD2, 0x9D, 0xA5, 0xAD, 0x2A, 0xD9, 0x5D, 0xA2, 0xE5, 0x9D, 0xA1, 0x9E, 0x5E,
+    0x91, 0xAE, 0x5E, 0x20, 0x5A, 0xD7, 0x1A, 0xD6, 0xE7, 0x1E, 0x59, 0xE7, 0x09, 0xDA, 0x5A, 0xDA,
+    0x70, 0xAD, 0x95, 0xE9, 0x70, 0xE6, 0xE7, 0x09, 0xE5, 0x9E, 0x70, 0xAE, 0x39, 0xFF, 0xFF, 0xDA,
+    0x2A, 0xFF, 0xFF, 0xD9, 0x3A, 0xE9, 0x99, 0x99, 0x99, 0x99, 0xAE, 0x94, 0xAE, 0x70, 0xF5, 0xFA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x49, 0xFF, 0xFF, 0x94, 0xAF, 0xFF, 0xF5, 0xFF, 0xFF, 0xC5, 0xFF,
+    0xFF, 0xA4, 0xAE, 0xA7, 0xAE, 0x94, 0xF9, 0x7F, 0x5F, 0x79, 0xF4, 0x9F, 0x7A, 0xEA, 0x4A, 0xEA,
+    0x7F, 0xA4, 0x6D, 0x97, 0x4D, 0x74, 0xAC, 0xA1, 0x99, 0x99, 0x49, 0xAF, 0xF9, 0x4A, 0xEA, 0xA9,
+    0x99, 0x7A, 0xCA, 0x74, 0xD9, 0x74, 0xD1, 0x9A, 0x99, 0x6A, 0xDA, 0xFD, 0x5F, 0xFD, 0xA3, 0x9F,
+    0x92, 0xE3, 0xAE, 0x49, 0xD3, 0xE5, 0x9C, 0xA2, 0x9D, 0xA5, 0xAC, 0xA2, 0xAD, 0x6D, 0x92, 0xE6,
+    0xD2, 0x9D, 0xA5, 0xAD, 0x2A, 0xD9, 0x5D, 0xA2, 0xE5, 0x9D, 0xA1, 0x9E, 0x5E, 0x91, 0xAE, 0x5E,
+    0x20, 0x77, 0x3E, 0x2A, 0xC4, 0xD0, 0xAA, 0x1C, 0x93, 0x9C, 0x91, 0xCA, 0xAC, 0x4A, 0xC2, 0x9D,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x4E, 0x97, 0x09, 0xE7, 0x1A, 0xE7, 0x1A, 0xDA, 0x71, 0xE9, 0x71,
+    0xE7, 0x19, 0xE7, 0x1A, 0xDA, 0x71, 0xE7, 0x19, 0xE7, 0x1A, 0xDA, 0x71, 0xE9, 0x71, 0xE9, 0x70,
+    0x9E, 0x71, 0xAE, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE9, 0x70, 0xF7, 0x09, 0xF7, 0x0A, 0xEA,
+    0x70, 0x76, 0xAE, 0x2C, 0x91, 0x9C, 0x90, 0xCA, 0x0A, 0xC2, 0xD1, 0x9E, 0x92, 0xAA, 0x39, 0x77,
+    0x77, 0x72, 0xAC, 0x97, 0x0D, 0x71, 0xD7, 0x09, 0xCA, 0x70, 0xD9, 0x70, 0xD7, 0x09, 0xD7, 0x0A,
+    0xCA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x70, 0x77, 0x29, 0xAA,
+    0xAF, 0xD9, 0x3F, 0xFD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x70, 0xE9, 0x71, 0x9E, 0x72, 0xAE, 0x72,
+    0xAD, 0xA7, 0x2E, 0x97, 0x2E, 0x72, 0x9E, 0x72, 0xAD, 0xA7, 0x2E, 0x72, 0x9E, 0x72, 0xAD, 0xA7,
+    0x2E, 0x97, 0x2E, 0x97, 0x19, 0xE7, 0x2A, 0xE7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x97, 0x1F,
+    0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x10, 0x72, 0x92, 0xAF, 0xFC, 0x1A, 0xFE, 0xAA, 0xA7, 0x77, 0x77,
+    0x39, 0xA9, 0x71, 0xD7, 0x2D, 0x71, 0x9C, 0xA7, 0x1A, 0xC9, 0x71, 0xD7, 0x19, 0xD7, 0x1A, 0xCA,
+    0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x00, 0x69, 0xE7,
+    0xAE, 0x7A, 0xDA, 0x7E, 0x97, 0xE7, 0x9E, 0x7A, 0xDA, 0x7E, 0x97, 0xE7, 0xAD, 0xA7, 0xE9, 0x7E,
+    0x79, 0xE7, 0xAE, 0x7E, 0xA6, 0x9E, 0x96, 0xAE, 0x7F, 0x69, 0xF6, 0xAE, 0xA6, 0xF9, 0x6A, 0xC7,
+    0x0A, 0xC7, 0x09, 0xC7, 0x19, 0xCA, 0xA9, 0x79, 0xDA, 0x77, 0x20, 0x7E, 0x79, 0xE7, 0xEA, 0x69,
+    0xEA, 0x77, 0x77, 0x77, 0x6A, 0xC9, 0x70, 0xD7, 0x1D, 0x70, 0x9C, 0xA7, 0x0A, 0xC9, 0x70, 0xD7,
+    0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7D,
+    0x70, 0xD7, 0x1C, 0x97, 0x1F, 0x70, 0x9A, 0xA6, 0x77, 0x39, 0xD9, 0x7E, 0x96, 0x9E, 0x7F, 0x77,
+    0x77, 0x77, 0x77, 0x2E, 0x96, 0x9E, 0x7A, 0xE7, 0xAD, 0xA7, 0xE9, 0x7E, 0x79, 0xE7, 0xAD, 0xA7,
+    0xE7, 0x9E, 0x7A, 0xDA, 0x7E, 0x97, 0xE9, 0x69, 0xE7, 0xAE, 0x7E, 0xA6, 0x9E, 0x96, 0xAE, 0x96,
+    0xF6, 0x9F, 0x6A, 0xEA, 0x60, 0x72, 0xAC, 0x93, 0xD4, 0xD3, 0x9C, 0xA3, 0xAC, 0x93, 0xD3, 0x9D,
+    0x3A, 0xCA, 0x3D, 0x92, 0x9D, 0x3A, 0xD3, 0xE2, 0x9D, 0xA2, 0xAD, 0x92, 0x5E, 0x94, 0x9E, 0x59,
+    0xE5, 0xAE, 0x5A, 0xE5, 0xEA, 0x5A, 0xDA, 0x49, 0xE6, 0xE9, 0x4A, 0xE6, 0xE5, 0xEA, 0x59, 0xE5,
+    0xE6, 0xAD, 0xA4, 0xAE, 0x6E, 0x5E, 0xA5, 0x9E, 0x5E, 0x95, 0xAD, 0xA4, 0x9E, 0x6E, 0x94, 0xAD,
+    0xA6, 0xE9, 0x4E, 0x95, 0x9E, 0x49, 0xE6, 0xAE, 0x4A, 0xDA, 0x6E, 0xA4, 0xE9, 0x59, 0xE9, 0x39,
+    0xE6, 0xAE, 0x93, 0xAD, 0xA6, 0xF4, 0xE9, 0x59, 0xF3, 0x9E, 0x6A, 0xEA, 0x3E, 0xA7, 0x6A, 0xE9,
+    0x72, 0xA9, 0x9F, 0xC7, 0x29, 0xFE, 0x97, 0x2A, 0xFD, 0xA7, 0x3F, 0xD9, 0x74, 0xEA, 0xA7, 0x30,
+    0x5E, 0x77, 0x29, 0xE7, 0x19, 0xD9, 0x4E, 0xA7, 0x1E, 0x93, 0x9E, 0xA7, 0x09, 0xE7, 0x72, 0xF7,
+    0x77, 0x77, 0x77, 0x77, 0x1A, 0xC9, 0x72, 0xAA, 0x95, 0xD7, 0x3D, 0x6D, 0x72, 0x9D, 0x59, 0xCA,
+    0x72, 0xAC, 0xA5, 0xAC, 0x97, 0x2D, 0x95, 0xD7, 0x29, 0xD5, 0x9D, 0x72, 0xAC, 0xA5, 0xAC, 0xA7,
+    0x2D, 0x95, 0xD9, 0x72, 0xD5, 0x9D, 0x72, 0xAC, 0xA5, 0xAD, 0x72, 0xD9, 0x5E, 0x72, 0xD5, 0x9D,
+    0xA7, 0x19, 0xCA, 0x5A, 0xD9, 0x71, 0xD9, 0x77, 0x3D, 0x77, 0x3A, 0xCA, 0x77, 0x2A, 0xD9, 0x76,
+    0x99, 0xAF, 0x77, 0xFD, 0x97, 0x6A, 0xFA, 0x77, 0x77, 0x00, 0x74, 0xAC, 0x97, 0x71, 0xE7, 0x70,
+    0xAC, 0xAD, 0x97, 0x59, 0xC9, 0x19, 0xCA, 0x74, 0xC9, 0x4A, 0xA7, 0x77, 0x73, 0xAA, 0xA7, 0x70,
+    0xAE, 0x77, 0x0E, 0xA7, 0x70, 0xE9, 0x77, 0x9E, 0x77, 0x0A, 0xDA, 0x77, 0x0E, 0x97, 0x79, 0xE7,
+    0x70, 0xAE, 0x77, 0x0E, 0x97, 0x79, 0xE7, 0x70, 0xAE, 0x77, 0x0E, 0x97, 0x70, 0xE7, 0x70, 0x9E,
+    0x77, 0x0E, 0xA7, 0x70, 0xE7, 0x70, 0x9E, 0x77, 0x0A, 0xDA, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70,
+    0xE9, 0x73, 0x91, 0x9F, 0x74, 0xFE, 0xA7, 0x39, 0xFE, 0x74, 0xAF, 0xD7, 0x5F, 0xC9, 0x77, 0x97,
+    0x71, 0x73, 0x9C, 0x97, 0x70, 0xAD, 0x97, 0x69, 0xF9, 0x75, 0xD1, 0x9C, 0xA7, 0x3C, 0xA4, 0xAC,
+    0x77, 0x77, 0x77, 0x39, 0xD7, 0x70, 0xAC, 0xA7, 0x70, 0xD9, 0x77, 0x9D, 0x77, 0x0A, 0xCA, 0x77,
+    0x0D, 0x97, 0x70, 0xD7, 0x70, 0x9C, 0xA7, 0x70, 0xD9, 0x77, 0x0D, 0x77, 0x09, 0xD7, 0x70, 0xAC,
+    0x97, 0x70, 0xD7, 0x70, 0x9D, 0x77, 0x0A, 0xCA, 0x77, 0x9D, 0x77, 0x9E, 0x74, 0x9A, 0xF9, 0x73,
+    0xAF, 0xCA, 0x74, 0xFA, 0x97, 0x77, 0x70, 0x6A, 0xD9, 0x3F, 0x7E, 0x3A, 0xE7, 0x9E, 0x2A, 0xE7,
+    0x0A, 0xD9, 0x19, 0xE7, 0x1E, 0x19, 0xE9, 0x70, 0x9E, 0x09, 0xE9, 0x71, 0xAD, 0x90, 0xEA, 0x72,
+    0xE0, 0xEA, 0x72, 0x9F, 0xDA, 0x73, 0xFE, 0x74, 0xFD, 0x74, 0x9F, 0xCA, 0x74, 0xFE, 0x74, 0xFF,
+    0x72, 0xAE, 0x9F, 0xA7, 0x1E, 0xA0, 0xFC, 0x97, 0x9E, 0x19, 0xFC, 0x7A, 0xE2, 0xFC, 0xA6, 0xEA,
+    0x2A, 0xFC, 0x94, 0x9E, 0x4F, 0xD4, 0xAE, 0x4A, 0xFD, 0x77, 0x76, 0x99, 0x99, 0x97, 0x6F, 0x76,
+    0x9E, 0xA7, 0x6A, 0xE7, 0x7E, 0xA7, 0x6A, 0xE7, 0x69, 0xE9, 0x76, 0x9A, 0xAA, 0x73, 0x5A, 0xCA,
+    0x71, 0xDA, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0xAD, 0x71, 0xDA, 0x1A, 0xD9,
+    0x3D, 0x90, 0xAD, 0x93, 0xAD, 0x0A, 0xD9, 0x4D, 0xAA, 0xD9, 0x5F, 0xC6, 0x9F, 0x96, 0xFD, 0x6D,
+    0xAE, 0xA4, 0x9D, 0x9A, 0xE9, 0x3E, 0x1F, 0x3E, 0x1A, 0xF1, 0x9D, 0xA2, 0xFA, 0x0A, 0xD9, 0x2A,
+    0xF9, 0x77, 0x77, 0x77, 0x79, 0xF7, 0xF7, 0x0E, 0xA7, 0x9E, 0x70, 0xEA, 0x7A, 0xE7, 0x0E, 0xA7,
+    0x73, 0x49, 0x39, 0x4A, 0xC9, 0x1D, 0x93, 0xD1, 0xD9, 0x39, 0xCA, 0x0A, 0xCA, 0x4A, 0xC9, 0xAC,
+    0xA5, 0xD9, 0xD5, 0x9F, 0x6A, 0xE7, 0xF6, 0x9F, 0xC5, 0xD9, 0xAD, 0xA4, 0xD1, 0xE9, 0x29, 0xCA,
+    0x1F, 0x2D, 0x91, 0x9E, 0xA1, 0x71, 0x9C, 0x97, 0x3C, 0xA7, 0x3D, 0x73, 0xAC, 0xA7, 0x29, 0xD7,
+    0x77, 0x77, 0x77, 0x09, 0x99, 0x72, 0x9D, 0xA7, 0x2E, 0x73, 0xE7, 0x29, 0xDA, 0x72, 0xAD, 0x97,
+    0x2E, 0x72, 0x9D, 0xA7, 0x2A, 0xD9, 0x72, 0xE7, 0x29, 0xE7, 0x2A, 0xDA, 0x72, 0xE7, 0x3E, 0x72,
+    0xAD, 0xA7, 0x2E, 0x97, 0x2E, 0x72, 0x9E, 0x72, 0xFF, 0xFC, 0x90, 0xFF, 0xFC, 0x09, 0xFF, 0xFA,
+    0x0A, 0xFF, 0xF9, 0x00, 0x72, 0xAC, 0x72, 0x9C, 0xA7, 0x2D, 0x72, 0xD9, 0x71, 0xAD, 0x77, 0x77,
+    0x77, 0x77, 0x0A, 0xCA, 0x72, 0xDA, 0x71, 0x9D, 0x72, 0xAD, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xE7,
+    0x2D, 0x97, 0x19, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97,
+    0x1A, 0xD7, 0x2E, 0x72, 0xEA, 0xA9, 0x69, 0xFC, 0x96, 0xAF, 0xC9, 0x60, 0x77, 0x49, 0xDA, 0x72,
+    0xAD, 0x97, 0x2E, 0x72, 0x9D, 0xA7, 0x2A, 0xD9, 0x72, 0xE7, 0x29, 0xE7, 0x2A, 0xD9, 0x72, 0xE7,
+    0x29, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x72, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x72, 0xE7, 0x29, 0xE7,
+    0x2F, 0xFF, 0xC9, 0x0F, 0xFF, 0xC0, 0x9F, 0xFF, 0xA0, 0xAF, 0xFF, 0x97, 0x77, 0x77, 0x72, 0xF7,
+    0x19, 0xEA, 0x71, 0xF7, 0x2E, 0xA7, 0x1A, 0xE7, 0x2E, 0x97, 0x1F, 0x77, 0x70, 0x77, 0x1A, 0xD7,
+    0xD9, 0x69, 0xD7, 0xAD, 0x7D, 0x96, 0x9D, 0x7D, 0xA7, 0xD9, 0x69, 0xD7, 0xDA, 0x7D, 0x96, 0x9D,
+    0x7E, 0x7D, 0xA6, 0x9D, 0x96, 0xAD, 0x7E, 0x7E, 0xAA, 0x93, 0x9F, 0xC9, 0x3A, 0xFC, 0x97, 0x77,
+    0x77, 0xF5, 0x9E, 0xA5, 0xF6, 0xE9, 0x5A, 0xE5, 0x9E, 0x95, 0xF7, 0x70, 0x77, 0x59, 0xDA, 0x73,
+    0xAD, 0x97, 0x3E, 0x73, 0x9D, 0xA7, 0x3A, 0xD9, 0x49, 0x94, 0xE4, 0x9C, 0xA3, 0x9E, 0x4D, 0x93,
+    0xAD, 0x94, 0xD4, 0xE4, 0xAC, 0xA3, 0x9E, 0x4D, 0x93, 0xAD, 0xA7, 0x3E, 0x97, 0x3E, 0x73, 0xAD,
+    0xA7, 0x3E, 0x97, 0x3E, 0x73, 0x9E, 0x73, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x19, 0xFF, 0xFA, 0x1A,
+    0xFF, 0xF9, 0x10, 0x74, 0x97, 0x4A, 0xC9, 0x5A, 0xD2, 0xD6, 0xDA, 0x19, 0xD5, 0x9D, 0x2A, 0xCA,
+    0x5A, 0xD2, 0xD6, 0xD9, 0x72, 0x9D, 0x73, 0xDA, 0x73, 0xD9, 0x72, 0x9D, 0x73, 0xDA, 0x73, 0xD9,
+    0x72, 0x9D, 0x73, 0xE7, 0x3D, 0xA7, 0x29, 0xD9, 0x72, 0xAD, 0x73, 0xE7, 0x3E, 0xAA, 0x97, 0x9F,
+    0xC9, 0x7A, 0xFC, 0x97, 0x69, 0x99, 0x74, 0x9D, 0xA7, 0x4E, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD,
+    0x93, 0xAD, 0x5E, 0x4E, 0x49, 0xDA, 0x3A, 0xE4, 0xAD, 0x93, 0xF4, 0xE7, 0x49, 0xE7, 0x4A, 0xDA,
+    0x74, 0xE7, 0x5E, 0x74, 0xAD, 0xA7, 0x4E, 0x97, 0x4E, 0x74, 0x9E, 0x74, 0xFF, 0xFC, 0x92, 0xFF,
+    0xFC, 0x29, 0xFF, 0xFA, 0x2A, 0xFF, 0xF9, 0x20, 0x77, 0x3A, 0xD7, 0x2D, 0x97, 0x19, 0xD7, 0x2E,
+    0x72, 0xD9, 0x71, 0xAD, 0x2A, 0xD9, 0x3D, 0xA2, 0xE4, 0xD9, 0x1A, 0xE3, 0xAD, 0x2F, 0x3D, 0xA7,
+    0x2D, 0x97, 0x19, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xEA, 0xA9,
+    0x69, 0xFC, 0x96, 0xAF, 0xC9, 0x60, 0x77, 0x77, 0x77, 0x77, 0xAD, 0x77, 0x75, 0xAD, 0x77, 0x75,
+    0xAD, 0x77, 0x75, 0xAD, 0x77, 0x69, 0xDA, 0x2A, 0xD7, 0x77, 0xAD, 0x91, 0xAD, 0x77, 0x70, 0xE1,
+    0xAD, 0x77, 0x70, 0x9D, 0xA0, 0xAD, 0x77, 0x71, 0xAD, 0x99, 0xD7, 0x77, 0x2E, 0xAD, 0x97, 0x77,
+    0x19, 0xFC, 0x97, 0x77, 0x2A, 0xF9, 0x77, 0x73, 0xF9, 0x77, 0x73, 0x9E, 0x97, 0x77, 0x4A, 0xDA,
+    0x77, 0x74, 0x9E, 0x97, 0x77, 0x39, 0xF7, 0x77, 0x39, 0xFA, 0x77, 0x72, 0x9F, 0xC9, 0x77, 0x71,
+    0x9F, 0xD7, 0x77, 0x19, 0xDA, 0x9E, 0x77, 0x70, 0x9E, 0x0F, 0xFF, 0xC9, 0x75, 0x9E, 0x1F, 0xFF,
+    0xC7, 0x59, 0xE1, 0x9F, 0xFF, 0xA7, 0x49, 0xE2, 0xAF, 0xFF, 0x97, 0x39, 0xE7, 0x77, 0x49, 0xE7,
+    0x77, 0x49, 0xE7, 0x77, 0x49, 0xE7, 0x77, 0x49, 0xD9, 0x77, 0x75, 0x97, 0x77, 0x70, 0x77, 0x77,
+    0x5A, 0xD7, 0x73, 0xD9, 0x77, 0x29, 0xD7, 0x73, 0xAC, 0xA7, 0x73, 0xD9, 0x77, 0x29, 0xD7, 0x73,
+    0xDA, 0x77, 0x3D, 0x97, 0x72, 0x9D, 0x77, 0x3D, 0xA7, 0x73, 0xD9, 0x39, 0x97, 0x4A, 0xDA, 0xFA,
+    0x99, 0x49, 0x9A, 0xAF, 0xD9, 0x97, 0xAF, 0xA9, 0x91, 0xDA, 0x77, 0x29, 0xD9, 0x77, 0x2A, 0xD7,
+    0x73, 0xE7, 0x73, 0xEA, 0xA9, 0x77, 0x9F, 0xC9, 0x77, 0xAF, 0xC9, 0x60, 0x77, 0x1C, 0xA7, 0x74,
+    0xAC, 0x77, 0x49, 0xCA, 0x77, 0x4D, 0x77, 0x4D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x99,
+    0x97, 0xAA, 0xA9, 0x70, 0xE7, 0xF7, 0xAD, 0xA6, 0xAF, 0x7E, 0x96, 0xFC, 0x95, 0x9E, 0x7F, 0xCA,
+    0x5A, 0xDA, 0x6A, 0xFC, 0xA5, 0xE9, 0x6F, 0xE4, 0x9E, 0x7E, 0x9E, 0x4A, 0xDA, 0x6A, 0xE0, 0xE9,
+    0x3E, 0x96, 0xEA, 0x0E, 0xA2, 0x9E, 0x69, 0xE9, 0x0A, 0xDA, 0x2A, 0xDA, 0x6A, 0xE1, 0x9E, 0x2E,
+    0x96, 0xF1, 0x9E, 0x19, 0xE6, 0x9E, 0xA2, 0xE9, 0x0A, 0xE6, 0xAE, 0x92, 0xEA, 0x0E, 0x96, 0xF3,
+    0xAD, 0xA9, 0xE6, 0x9F, 0x39, 0xEA, 0xE6, 0xAE, 0xA4, 0xFD, 0xA6, 0xF9, 0x4F, 0xD6, 0x9F, 0x5F,
+    0xD6, 0xAF, 0x5A, 0xFA, 0x60, 0x75, 0xAC, 0x75, 0x9C, 0x97, 0x5D, 0x75, 0xD7, 0x5A, 0xCA, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x73, 0x9C, 0x90, 0xAA, 0xDA, 0x7A, 0xFF, 0xC6, 0xFA, 0x90, 0x9D, 0x94,
+    0x9E, 0x4D, 0xA4, 0xAD, 0x94, 0xDA, 0x4E, 0x5D, 0x93, 0x9D, 0x94, 0x9D, 0x93, 0xAD, 0x5A, 0xD4,
+    0xE5, 0xE3, 0x9E, 0x49, 0xDA, 0x3A, 0xDA, 0x4A, 0xDA, 0x3E, 0x94, 0xE9, 0x29, 0xE5, 0xE3, 0xAE,
+    0x49, 0xE3, 0x77, 0x76, 0x99, 0x99, 0x70, 0xE7, 0xF7, 0x9D, 0xA6, 0x9F, 0x7E, 0x96, 0xFC, 0x96,
+    0xE7, 0xFC, 0x95, 0xAD, 0xA6, 0x9F, 0xCA, 0x5E, 0x96, 0xFE, 0x5E, 0x7E, 0x9E, 0x4A, 0xE6, 0xAE,
+    0x0E, 0x93, 0xE9, 0x6E, 0xA0, 0xEA, 0x29, 0xE7, 0xE9, 0x0A, 0xDA, 0x2A, 0xE6, 0xAE, 0x19, 0xE2,
+    0xE9, 0x6F, 0x19, 0xE1, 0x9E, 0x69, 0xEA, 0x2E, 0x90, 0xAE, 0x6A, 0xE9, 0x2E, 0xA0, 0xE9, 0x6F,
+    0x3A, 0xDA, 0x9E, 0x69, 0xF3, 0x9E, 0xAE, 0x6A, 0xEA, 0x4F, 0xDA, 0x6F, 0x94, 0xFD, 0x69, 0xF5,
+    0xFD, 0x6A, 0xF5, 0xAF, 0xA7, 0x77, 0x75, 0x99, 0x99, 0x77, 0x29, 0xEA, 0x77, 0x2F, 0x77, 0x3E,
+    0xA7, 0x72, 0xAE, 0x77, 0x3E, 0x97, 0x72, 0xF7, 0x73, 0xAA, 0xA9, 0x77, 0x39, 0xC9, 0x0A, 0xAD,
+    0xA6, 0xAF, 0xFC, 0x5F, 0xA9, 0x09, 0xD9, 0x39, 0xE4, 0xDA, 0x3A, 0xD9, 0x4D, 0xA3, 0xE5, 0xD9,
+    0x29, 0xD9, 0x49, 0xD9, 0x2A, 0xD5, 0xAD, 0x3E, 0x5E, 0x29, 0xE4, 0x9D, 0xA2, 0xAD, 0xA4, 0xAD,
+    0xA2, 0xE9, 0x4E, 0x91, 0x9E, 0x5E, 0x2A, 0xE4, 0x9E, 0x77, 0x69, 0x99, 0x97, 0x29, 0xEA, 0x72,
+    0xF7, 0x3E, 0xA7, 0x2A, 0xE7, 0x3E, 0x97, 0x2F, 0x73, 0xAA, 0xA9, 0x72, 0x77, 0x77, 0x2A, 0xC4,
+    0xAA, 0x77, 0xD1, 0xAC, 0x97, 0x70, 0x9F, 0x97, 0x72, 0xAD, 0x77, 0x5A, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x79, 0x99, 0x97, 0x0E, 0x7F, 0x79, 0xDA, 0x69, 0xF7, 0xE9, 0x6F, 0xC9, 0x6E, 0x7F, 0xC9,
+    0x5A, 0xDA, 0x69, 0xFC, 0xA5, 0xE9, 0x6F, 0xE5, 0xE7, 0xE9, 0xE4, 0xAE, 0x6A, 0xE0, 0xE9, 0x3E,
+    0x96, 0xEA, 0x0E, 0xA2, 0x9E, 0x7E, 0x90, 0xAD, 0xA2, 0xAE, 0x6A, 0xE1, 0x9E, 0x2E, 0x96, 0xF1,
+    0x9E, 0x19, 0xE6, 0x9E, 0xA2, 0xE9, 0x0A, 0xE6, 0xAE, 0x92, 0xEA, 0x0E, 0x96, 0xF3, 0xAD, 0xA9,
+    0xE6, 0x9F, 0x39, 0xEA, 0xE6, 0xAE, 0xA4, 0xFD, 0xA6, 0xF9, 0x4F, 0xD6, 0x9F, 0x5F, 0xD6, 0xAF,
+    0x5A, 0xFA, 0x60, 0x69, 0x95, 0x99, 0x69, 0xCA, 0x29, 0xCA, 0x70, 0xAC, 0xA0, 0xAC, 0x97, 0x2F,
+    0x74, 0x9D, 0x76, 0x97, 0x77, 0x77, 0x77, 0x77, 0x59, 0xC9, 0x0A, 0xAD, 0xA7, 0xAF, 0xFC, 0x6F,
+    0xA9, 0x09, 0xD9, 0x49, 0xE4, 0xDA, 0x4A, 0xD9, 0x4D, 0xA4, 0xE5, 0xD9, 0x39, 0xD9, 0x49, 0xD9,
+    0x3A, 0xD5, 0xAD, 0x4E, 0x5E, 0x39, 0xE4, 0x9D, 0xA3, 0xAD, 0xA4, 0xAD, 0xA3, 0xE9, 0x4E, 0x92,
+    0x9E, 0x5E, 0x3A, 0xE4, 0x9E, 0x30, 0x49, 0x97, 0x6E, 0x75, 0xAD, 0x75, 0x9D, 0xA7, 0x49, 0xE7,
+    0x5A, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0C, 0xA0, 0x9A, 0xDA, 0x70, 0xAF,
+    0xFC, 0x7F, 0xA9, 0x09, 0xD9, 0x6E, 0x93, 0xAC, 0xA5, 0xAD, 0x94, 0xAC, 0xA5, 0xE5, 0xDA, 0x5D,
+    0xA5, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4E, 0x5E, 0x5E, 0x5E, 0x4A, 0xDA, 0x49, 0xDA, 0x4E, 0xA4,
+    0xAD, 0xA4, 0xE9, 0x4E, 0x93, 0xAE, 0x49, 0xE2, 0x77, 0x76, 0x99, 0x99, 0x70, 0xE7, 0xF7, 0x9D,
+    0xA6, 0x9F, 0x7E, 0x96, 0xFC, 0x96, 0xE7, 0xFC, 0x95, 0xAD, 0xA6, 0x9F, 0xCA, 0x5E, 0x96, 0xFE,
+    0x5E, 0x7E, 0x9E, 0x4A, 0xE6, 0xAE, 0x0E, 0x93, 0xE9, 0x6E, 0xA0, 0xEA, 0x29, 0xE7, 0xE9, 0x0A,
+    0xDA, 0x2A, 0xE6, 0xAE, 0x19, 0xE2, 0xE9, 0x6F, 0x19, 0xE1, 0x9E, 0x69, 0xEA, 0x2E, 0x90, 0xAE,
+    0x6A, 0xE9, 0x2E, 0xA0, 0xE9, 0x6F, 0x3A, 0xDA, 0x9E, 0x69, 0xF3, 0x9E, 0xAE, 0x6A, 0xEA, 0x4F,
+    0xDA, 0x6F, 0x94, 0xFD, 0x69, 0xF5, 0xFD, 0x6A, 0xF5, 0xAF, 0xA7, 0x71, 0xFC, 0x77, 0x19, 0xFA,
+    0x77, 0x0A, 0xFC, 0x76, 0xFF, 0x76, 0xAF, 0xA9, 0x77, 0x09, 0x97, 0x70, 0x39, 0xC9, 0x0A, 0xAD,
+    0xA6, 0xAF, 0xFC, 0x5F, 0xA9, 0x09, 0xD9, 0x39, 0xE4, 0xDA, 0x3A, 0xD9, 0x4D, 0xA3, 0xE5, 0xD9,
+    0x29, 0xD9, 0x49, 0xD9, 0x2A, 0xD5, 0xAD, 0x3E, 0x5E, 0x29, 0xE4, 0x9D, 0xA2, 0xAD, 0xA4, 0xAD,
+    0xA2, 0xE9, 0x4E, 0x91, 0x9E, 0x5E, 0x2A, 0xE4, 0xAE, 0x73, 0xEA, 0x72, 0xAE, 0x97, 0x0F, 0xD7,
+    0x0A, 0xFA, 0x77, 0x40, 0x77, 0x77, 0x2A, 0xFF, 0xC7, 0x4F, 0xFA, 0xAA, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x49, 0xAF, 0xCA, 0x75, 0xAF, 0xFD, 0xA7, 0x19, 0xFC, 0x99, 0x9A, 0xFA, 0x79, 0xF9, 0x5F,
+    0x69, 0xEA, 0x79, 0xE9, 0x5F, 0x71, 0xEA, 0x4A, 0xE7, 0x2E, 0xA4, 0xE9, 0x72, 0xAD, 0xA3, 0x9E,
+    0x73, 0xAD, 0x93, 0xE9, 0x73, 0xE4, 0xE7, 0x4E, 0x39, 0xDA, 0x73, 0x9D, 0xA3, 0xAD, 0xA7, 0x3E,
+    0x93, 0xAD, 0xA7, 0x2A, 0xE4, 0xAE, 0x97, 0x0F, 0x94, 0xAF, 0xC9, 0x99, 0x99, 0xAF, 0xD5, 0x9F,
+    0xFF, 0xF9, 0x6F, 0xFF, 0xEA, 0x7A, 0xFF, 0xFC, 0xA7, 0x1A, 0xFF, 0xE9, 0x74, 0xAF, 0xDA, 0x97,
+    0x77, 0x71, 0x69, 0x9A, 0xAA, 0xAF, 0x69, 0xFF, 0xD9, 0x69, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0xAA, 0xEA, 0x71, 0x9F, 0xF7, 0xAE, 0x99, 0x99, 0xE5, 0x9D, 0x94, 0x9D, 0x5D, 0xA6, 0xD9, 0x39,
+    0xD7, 0xD9, 0x3D, 0xA6, 0x9D, 0x4D, 0x96, 0xE3, 0x9D, 0x69, 0xD9, 0x39, 0xDA, 0x49, 0xE5, 0xFC,
+    0xAF, 0xC9, 0x5F, 0xFD, 0x97, 0xFF, 0x97, 0x1A, 0xEA, 0x97, 0x72, 0xCA, 0x5A, 0xA7, 0x5D, 0x49,
+    0xC9, 0x75, 0xDA, 0x99, 0x9D, 0xA7, 0x69, 0xFD, 0xA7, 0x70, 0x9E, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x70, 0x9A, 0xFC, 0xA7, 0x5A, 0xFF, 0xDA, 0x71, 0x9F, 0xC9, 0x99, 0xAF, 0xA7, 0x9F,
+    0x95, 0xF6, 0x9E, 0xA7, 0x9E, 0x95, 0xF7, 0x1E, 0xA4, 0xAE, 0x72, 0xEA, 0x4E, 0x97, 0x2A, 0xDA,
+    0x39, 0xE7, 0x3A, 0xD9, 0x3E, 0x97, 0x3E, 0x4E, 0x74, 0xE3, 0x9D, 0xA7, 0x39, 0xDA, 0x3A, 0xDA,
+    0x73, 0xE9, 0x3A, 0xDA, 0x72, 0xAE, 0x4A, 0xE9, 0x70, 0xF9, 0x4A, 0xFC, 0x99, 0x99, 0x9A, 0xFD,
+    0x59, 0xFF, 0xFF, 0x96, 0xFF, 0xFE, 0xA7, 0xAF, 0xFF, 0xCA, 0x71, 0xAF, 0xFE, 0x97, 0x4A, 0xFD,
+    0xA9, 0x77, 0x77, 0x10, 0x69, 0xA6, 0x97, 0xAC, 0x5A, 0xC7, 0xAC, 0xA3, 0xAC, 0x97, 0x0F, 0xEA,
+    0x71, 0x9F, 0xC9, 0x75, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xAA, 0xEA, 0x71, 0x9F, 0xF7,
+    0xAE, 0x99, 0x99, 0xE5, 0x9D, 0x94, 0x9D, 0x5D, 0xA6, 0xD9, 0x39, 0xD7, 0xD9, 0x3D, 0xA6, 0x9D,
+    0x4D, 0x96, 0xE3, 0x9D, 0x69, 0xD9, 0x39, 0xDA, 0x49, 0xE5, 0xFC, 0xAF, 0xC9, 0x5F, 0xFD, 0x97,
+    0xFF, 0x97, 0x1A, 0xEA, 0x97, 0x72, 0x99, 0x79, 0x99, 0x71, 0xAD, 0x69, 0xD7, 0x1A, 0xD6, 0xAD,
+    0x97, 0x0E, 0x95, 0xAD, 0xA7, 0x19, 0x70, 0x97, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xFC, 0xA7,
+    0x5A, 0xFF, 0xDA, 0x71, 0x9F, 0xC9, 0x99, 0xAF, 0xA7, 0x9F, 0x95, 0xF6, 0x9E, 0xA7, 0x9E, 0x95,
+    0xF7, 0x1E, 0xA4, 0xAE, 0x72, 0xEA, 0x4E, 0x97, 0x2A, 0xDA, 0x39, 0xE7, 0x3A, 0xD9, 0x3E, 0x97,
+    0x3E, 0x4E, 0x74, 0xE3, 0x9D, 0xA7, 0x39, 0xDA, 0x3A, 0xDA, 0x73, 0xE9, 0x3A, 0xDA, 0x72, 0xAE,
+    0x4A, 0xE9, 0x70, 0xF9, 0x4A, 0xFC, 0x99, 0x99, 0x9A, 0xFD, 0x59, 0xFF, 0xFF, 0x96, 0xFF, 0xFE,
+    0xA7, 0xAF, 0xFF, 0xCA, 0x71, 0xAF, 0xFE, 0x97, 0x4A, 0xFD, 0xA9, 0x77, 0x77, 0x10, 0x77, 0x73,
+    0xDA, 0x6A, 0xD6, 0xE6, 0xE5, 0x9E, 0x6E, 0x95, 0x99, 0x96, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x73, 0xAA, 0xEA, 0x74, 0x9F, 0xF7, 0x2A, 0xE9, 0x99, 0x9E, 0x70, 0x9D, 0x94, 0x9D,
+    0x70, 0xDA, 0x6D, 0x96, 0x9D, 0x7D, 0x96, 0xDA, 0x69, 0xD7, 0xD9, 0x6E, 0x69, 0xD6, 0x9D, 0x96,
+    0x9D, 0xA4, 0x9E, 0x70, 0xFC, 0xAF, 0xC9, 0x70, 0xFF, 0xD9, 0x72, 0xFF, 0x97, 0x4A, 0xEA, 0x97,
+    0x20, 0x71, 0x9A, 0xFC, 0x90, 0x9A, 0xAA, 0xAA, 0xAA, 0xFA, 0x7A, 0xFF, 0xFF, 0xFD, 0x95, 0x9F,
+    0xC9, 0x99, 0xAF, 0xFF, 0xDA, 0x59, 0xF9, 0x5F, 0x97, 0x6F, 0x79, 0xE9, 0x75, 0xF7, 0x1E, 0xA7,
+    0x49, 0xE9, 0x70, 0x9E, 0xA7, 0x4E, 0xA7, 0x1A, 0xEA, 0x73, 0x9E, 0x72, 0xF9, 0x73, 0xAD, 0xA7,
+    0x19, 0xFF, 0xCA, 0x6E, 0x72, 0xAF, 0xFC, 0x96, 0xE7, 0x2F, 0xFD, 0x69, 0xDA, 0x71, 0x9F, 0xA7,
+    0x3A, 0xDA, 0x71, 0xAF, 0x74, 0xAE, 0x71, 0xFA, 0x74, 0xAF, 0x95, 0x9F, 0xC7, 0x5A, 0xFF, 0xFF,
+    0xA9, 0x99, 0x99, 0x99, 0x69, 0xFF, 0xFF, 0xFF, 0xC6, 0xAF, 0xFF, 0xFF, 0xF7, 0xAF, 0xFF, 0xFF,
+    0xE7, 0x09, 0xAF, 0xDA, 0xFF, 0xFC, 0xA4, 0x77, 0x29, 0xAA, 0x97, 0x2A, 0xAE, 0xA3, 0xAF, 0xD7,
+    0x9F, 0xF0, 0x9E, 0x92, 0xD5, 0xAE, 0x99, 0x99, 0xFC, 0x94, 0x9C, 0x93, 0x9D, 0x94, 0x9E, 0x95,
+    0x9C, 0xA3, 0xDA, 0x6E, 0x99, 0xAA, 0xFC, 0xA2, 0x9D, 0x7F, 0xFF, 0xA2, 0xDA, 0x69, 0xDA, 0xAA,
+    0x99, 0x99, 0x6D, 0x96, 0xE7, 0x49, 0xD7, 0xDA, 0x74, 0x9D, 0xA4, 0x9F, 0x97, 0x4F, 0xCA, 0xFF,
+    0xC9, 0x99, 0x99, 0xCA, 0x4F, 0xFD, 0xAF, 0xFD, 0x95, 0xFF, 0x90, 0x9F, 0xFC, 0x96, 0xAF, 0x94,
+    0xAF, 0xA9, 0x40, 0x76, 0xAC, 0x77, 0x9C, 0x97, 0x7D, 0x77, 0xD7, 0x7A, 0xCA, 0x77, 0x77, 0x77,
+    0x09, 0x99, 0x99, 0x75, 0xFF, 0x97, 0x0A, 0xFF, 0xCA, 0x7D, 0x5E, 0x7D, 0x59, 0xD9, 0x5A, 0xCA,
+    0x6D, 0x95, 0xD9, 0x59, 0xD6, 0xD5, 0x9E, 0x59, 0xD4, 0xAE, 0x95, 0xEA, 0xAA, 0xFC, 0xA6, 0xFF,
+    0xD9, 0x69, 0xFF, 0xC7, 0x0F, 0xFE, 0x7E, 0xA3, 0xEA, 0x59, 0xE5, 0xE5, 0xF5, 0xE5, 0xEA, 0x49,
+    0xE4, 0x9E, 0x94, 0xF4, 0xAE, 0x94, 0xF4, 0xF4, 0x9F, 0x39, 0xF4, 0xAF, 0x3A, 0xEA, 0x4F, 0xC3,
+    0x71, 0xCA, 0x71, 0xD7, 0x1A, 0xC9, 0x70, 0x9D, 0x71, 0xD7, 0x77, 0x72, 0xD1, 0xAA, 0xC4, 0x9D,
+    0xAF, 0x4A, 0xFE, 0x4F, 0x96, 0x9E, 0x70, 0xAD, 0x97, 0x0E, 0x70, 0x9E, 0x70, 0xAD, 0x97, 0x0E,
+    0x97, 0x9E, 0x70, 0xF7, 0x9F, 0x7A, 0xEA, 0x70, 0x69, 0x99, 0x99, 0x75, 0xFF, 0x97, 0x0A, 0xFF,
+    0xCA, 0x7D, 0x5E, 0x7D, 0x59, 0xD9, 0x5A, 0xCA, 0x6D, 0x95, 0xD9, 0x59, 0xD6, 0xD5, 0x9E, 0x59,
+    0xD4, 0xAE, 0x95, 0xEA, 0xAA, 0xFC, 0xA6, 0xFF, 0xD9, 0x69, 0xFF, 0xC7, 0x0F, 0xFE, 0x7E, 0xA3,
+    0xEA, 0x59, 0xE5, 0xE5, 0xF5, 0xE5, 0xEA, 0x49, 0xE4, 0x9E, 0x94, 0xF4, 0xAE, 0x94, 0xF4, 0xF4,
+    0x9F, 0x39, 0xF4, 0xAF, 0x3A, 0xEA, 0x4F, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x76, 0x99, 0x99, 0x76,
+    0xF7, 0x59, 0xEA, 0x75, 0xF7, 0x6E, 0x97, 0x5A, 0xE7, 0x59, 0xE9, 0x75, 0x9A, 0xAA, 0x72, 0x6D,
+    0x1A, 0xAC, 0x69, 0xDA, 0xF6, 0xAF, 0xE6, 0xF9, 0x70, 0x9E, 0x72, 0xAD, 0x97, 0x2E, 0x72, 0x9E,
+    0x72, 0xAD, 0x97, 0x2E, 0x97, 0x19, 0xE7, 0x2F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x74, 0xAE, 0x97, 0x1F, 0x71, 0x9E, 0x97, 0x1F, 0x71, 0x9E, 0x97, 0x1E, 0xA7, 0x1A,
+    0xE7, 0x20, 0x77, 0x72, 0xAC, 0x49, 0xC7, 0x2D, 0x90, 0x9D, 0x74, 0xFA, 0x75, 0x9D, 0x97, 0x7A,
+    0xA7, 0x77, 0x77, 0x72, 0x99, 0x99, 0x97, 0x5F, 0xF9, 0x70, 0xAF, 0xFC, 0xA7, 0xD5, 0xE7, 0xD5,
+    0x9D, 0x95, 0xAC, 0xA6, 0xD9, 0x5D, 0x95, 0x9D, 0x6D, 0x59, 0xE5, 0x9D, 0x4A, 0xE9, 0x5E, 0xAA,
+    0xAF, 0xCA, 0x6F, 0xFD, 0x96, 0x9F, 0xFC, 0x70, 0xFF, 0xE7, 0xEA, 0x3E, 0xA5, 0x9E, 0x5E, 0x5F,
+    0x5E, 0x5E, 0xA4, 0x9E, 0x49, 0xE9, 0x4F, 0x4A, 0xE9, 0x4F, 0x4F, 0x49, 0xF3, 0x9F, 0x4A, 0xF3,
+    0xAE, 0xA4, 0xFC, 0x30, 0x2C, 0x94, 0xAA, 0x39, 0xCA, 0x19, 0xCA, 0x5A, 0xF9, 0x7E, 0x71, 0x9C,
+    0x97, 0x77, 0x73, 0xD1, 0xAA, 0xC4, 0x9D, 0xAF, 0x4A, 0xFE, 0x4F, 0x96, 0x9E, 0x70, 0xAD, 0x97,
+    0x0E, 0x70, 0x9E, 0x70, 0xAD, 0x97, 0x0E, 0x97, 0x9E, 0x70, 0xF7, 0x9F, 0x7A, 0xEA, 0x70, 0x77,
+    0x1C, 0x97, 0x72, 0xD7, 0x72, 0xAC, 0x97, 0x71, 0x9C, 0xA7, 0x72, 0xD7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x59, 0xAF, 0xDA, 0x97, 0x1A, 0xFF, 0xD9, 0x70, 0xAF, 0xFE, 0x70, 0xAF, 0xA9,
+    0x49, 0x70, 0xEA, 0x77, 0x09, 0xDA, 0x77, 0x1E, 0x77, 0x2E, 0x77, 0x2F, 0xA9, 0x77, 0xAF, 0xEA,
+    0x75, 0xAF, 0xFC, 0x74, 0x9A, 0xFF, 0xA7, 0x59, 0x9F, 0xDA, 0x77, 0x9F, 0xC7, 0x70, 0xFC, 0x97,
+    0x6A, 0xFC, 0x94, 0x97, 0x9F, 0xD4, 0xAF, 0xFF, 0xE9, 0x3A, 0xFF, 0xFE, 0xA3, 0xAF, 0xFF, 0xEA,
+    0x39, 0xFF, 0xFD, 0xA9, 0x6A, 0xFF, 0xCA, 0x97, 0x77, 0x50, 0x72, 0xAC, 0x73, 0x9C, 0xA7, 0x3D,
+    0x73, 0xD9, 0x72, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x76, 0xAF, 0xAA, 0x5A, 0xFE, 0x94, 0xAD, 0x97,
+    0x2D, 0x74, 0xD7, 0x4E, 0xA7, 0x29, 0xFC, 0x97, 0x1A, 0xFC, 0x73, 0xAD, 0xA7, 0x29, 0xDA, 0x39,
+    0xDA, 0xAA, 0xAE, 0x92, 0xAF, 0xFD, 0x29, 0xFF, 0xD9, 0x39, 0xAF, 0xDA, 0x40, 0x76, 0xCA, 0x77,
+    0x2A, 0xDA, 0x77, 0x09, 0xDA, 0xCA, 0x77, 0xD2, 0xAC, 0x75, 0xAA, 0x49, 0xC9, 0x77, 0x77, 0x77,
+    0x69, 0xAF, 0xDA, 0x97, 0x1A, 0xFF, 0xD9, 0x70, 0xAF, 0xFE, 0x70, 0xAF, 0xA9, 0x49, 0x70, 0xEA,
+    0x77, 0x09, 0xDA, 0x77, 0x1E, 0x77, 0x2E, 0x77, 0x2F, 0xA9, 0x77, 0xAF, 0xEA, 0x75, 0xAF, 0xFC,
+    0x74, 0x9A, 0xFF, 0xA7, 0x59, 0x9F, 0xDA, 0x77, 0x9F, 0xC7, 0x70, 0xFC, 0x97, 0x6A, 0xFC, 0x94,
+    0x97, 0x9F, 0xD4, 0xAF, 0xFF, 0xE9, 0x3A, 0xFF, 0xFE, 0xA3, 0xAF, 0xFF, 0xEA, 0x39, 0xFF, 0xFD,
+    0xA9, 0x6A, 0xFF, 0xCA, 0x97, 0x77, 0x50, 0x79, 0xC9, 0x74, 0xE9, 0x72, 0xAC, 0xAD, 0x97, 0x09,
+    0xCA, 0x19, 0xCA, 0x7C, 0x94, 0x9A, 0x77, 0x77, 0x7A, 0xFA, 0xA6, 0xAF, 0xE9, 0x5A, 0xD9, 0x73,
+    0xD7, 0x5D, 0x75, 0xEA, 0x73, 0x9F, 0xC9, 0x72, 0xAF, 0xC7, 0x4A, 0xDA, 0x73, 0x9D, 0xA4, 0x9D,
+    0xAA, 0xAA, 0xE9, 0x3A, 0xFF, 0xD3, 0x9F, 0xFD, 0x94, 0x9A, 0xFD, 0xA5, 0x72, 0x9A, 0xFD, 0xA9,
+    0x71, 0xAF, 0xFD, 0x97, 0x0A, 0xFF, 0xE7, 0x0A, 0xFA, 0x94, 0x97, 0x0E, 0xA7, 0x70, 0x9D, 0xA7,
+    0x71, 0xE7, 0x72, 0xE7, 0x72, 0xFA, 0x97, 0x7A, 0xFE, 0xA7, 0x5A, 0xFF, 0xC7, 0x49, 0xAF, 0xFA,
+    0x75, 0x99, 0xFD, 0xA7, 0x79, 0xFC, 0x77, 0x0F, 0xC9, 0x76, 0xAF, 0xC9, 0x49, 0x79, 0xFD, 0x4A,
+    0xFF, 0xFE, 0x93, 0xAF, 0xFF, 0xEA, 0x3A, 0xFF, 0xFE, 0xA3, 0x9F, 0xFF, 0xDA, 0x7A, 0xFF, 0xAA,
+    0x97, 0x7A, 0x77, 0x39, 0xCA, 0x97, 0x74, 0xA9, 0x77, 0x3A, 0x97, 0x70, 0x99, 0xD7, 0x70, 0xAD,
+    0xA7, 0x30, 0x6A, 0xFA, 0xA5, 0xAF, 0xE9, 0x4A, 0xD9, 0x72, 0xD7, 0x4D, 0x74, 0xEA, 0x72, 0x9F,
+    0xC9, 0x71, 0xAF, 0xC7, 0x3A, 0xDA, 0x72, 0x9D, 0xA3, 0x9D, 0xAA, 0xAA, 0xE9, 0x2A, 0xFF, 0xD2,
+    0x9F, 0xFD, 0x93, 0x9A, 0xFD, 0xA7, 0x1A, 0x97, 0x4A, 0x74, 0xAA, 0xAA, 0x75, 0xC9, 0x73, 0x9C,
+    0x71, 0xAE, 0x97, 0x19, 0x99, 0x70, 0x77, 0x77, 0x0C, 0xA3, 0x9C, 0x97, 0x5D, 0x1D, 0x97, 0x69,
+    0xF7, 0x71, 0xE7, 0x72, 0x9A, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xFD, 0xA9, 0x71,
+    0xAF, 0xFD, 0x97, 0x0A, 0xFF, 0xE7, 0x0A, 0xFA, 0x94, 0x97, 0x0E, 0xA7, 0x70, 0x9D, 0xA7, 0x71,
+    0xE7, 0x72, 0xE7, 0x72, 0xFA, 0x97, 0x7A, 0xFE, 0xA7, 0x5A, 0xFF, 0xC7, 0x49, 0xAF, 0xFA, 0x75,
+    0x99, 0xFD, 0xA7, 0x79, 0xFC, 0x77, 0x0F, 0xC9, 0x76, 0xAF, 0xC9, 0x49, 0x79, 0xFD, 0x4A, 0xFF,
+    0xFE, 0x93, 0xAF, 0xFF, 0xEA, 0x3A, 0xFF, 0xFE, 0xA3, 0x9F, 0xFF, 0xDA, 0x96, 0xAF, 0xFC, 0xA9,
+    0x77, 0x75, 0x39, 0xA5, 0xA9, 0x5D, 0x2A, 0xC9, 0x7D, 0x9D, 0x71, 0x9E, 0x73, 0xD7, 0x77, 0x77,
+    0x77, 0x77, 0x0A, 0xFA, 0xA5, 0xAF, 0xE9, 0x4A, 0xD9, 0x72, 0xD7, 0x4D, 0x74, 0xEA, 0x72, 0x9F,
+    0xC9, 0x71, 0xAF, 0xC7, 0x3A, 0xDA, 0x72, 0x9D, 0xA3, 0x9D, 0xAA, 0xAA, 0xE9, 0x2A, 0xFF, 0xD2,
+    0x9F, 0xFD, 0x93, 0x9A, 0xFD, 0xA4, 0x09, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xFC, 0x1F, 0xDA, 0xEA,
+    0xAA, 0xFA, 0x70, 0xE7, 0x70, 0xDA, 0x77, 0xAD, 0x97, 0x7E, 0x97, 0x7E, 0x77, 0x9E, 0x77, 0xEA,
+    0x77, 0xE9, 0x76, 0x9E, 0x77, 0xAE, 0x77, 0xEA, 0x76, 0x9E, 0x97, 0x6A, 0xE7, 0x7F, 0x76, 0x9E,
+    0xA7, 0x6A, 0xE9, 0x76, 0xF7, 0x7F, 0x77, 0x1A, 0x77, 0x19, 0xCA, 0xA7, 0x72, 0x9A, 0x76, 0x99,
+    0xAC, 0x76, 0x9D, 0xA7, 0x40, 0x77, 0x0A, 0xC7, 0xDA, 0x69, 0xD9, 0x6A, 0xD4, 0x9A, 0xAE, 0xAA,
+    0xA9, 0x9F, 0xFC, 0x92, 0xAD, 0x7E, 0x69, 0xD9, 0x6A, 0xD7, 0xE6, 0x9D, 0xA6, 0xAD, 0x96, 0xE7,
+    0xE9, 0x99, 0x3A, 0xFD, 0x92, 0xFE, 0x92, 0xAF, 0xD9, 0x49, 0xCA, 0x97, 0x1A, 0x97, 0x9C, 0x94,
+    0x9E, 0x96, 0x99, 0x60, 0x5A, 0xC4, 0x9C, 0x97, 0x2D, 0x2D, 0x75, 0xDA, 0xCA, 0x76, 0xAD, 0xA7,
+    0x70, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x59, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xFC, 0x1F, 0xDA, 0xEA,
+    0xAA, 0xFA, 0x70, 0xE7, 0x70, 0xDA, 0x77, 0xAD, 0x97, 0x7E, 0x97, 0x7E, 0x77, 0x9E, 0x77, 0xEA,
+    0x77, 0xE9, 0x76, 0x9E, 0x77, 0xAE, 0x77, 0xEA, 0x76, 0x9E, 0x97, 0x6A, 0xE7, 0x7F, 0x76, 0x9E,
+    0xA7, 0x6A, 0xE9, 0x76, 0xF7, 0x7F, 0x74, 0x72, 0x9C, 0xA7, 0x2A, 0xC9, 0x72, 0xD6, 0xAC, 0x19,
+    0xD5, 0xDA, 0x1D, 0x94, 0x9D, 0x91, 0x99, 0x5A, 0xD7, 0x9A, 0xAE, 0xAA, 0xA9, 0x29, 0xFF, 0xC9,
+    0x5A, 0xD7, 0x2E, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7,
+    0x2E, 0x99, 0x96, 0xAF, 0xD9, 0x5F, 0xE9, 0x5A, 0xFD, 0x95, 0x09, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF,
+    0xFC, 0x1F, 0xDA, 0xEA, 0xAA, 0xFA, 0x70, 0xE7, 0x70, 0xDA, 0x77, 0xAD, 0x97, 0x7E, 0x77, 0x0E,
+    0x77, 0x9D, 0xA7, 0x39, 0xAA, 0xAF, 0xAA, 0xA7, 0x0F, 0xFE, 0x79, 0xFF, 0xDA, 0x73, 0xAE, 0x77,
+    0xEA, 0x76, 0x9E, 0x97, 0x6A, 0xE7, 0x7F, 0x76, 0x9E, 0xA7, 0x6A, 0xE9, 0x76, 0xF7, 0x7F, 0x74,
+    0x77, 0x4A, 0xC7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x69, 0xAA, 0xEA, 0xAA, 0x91, 0x9F, 0xFC,
+    0x94, 0xAD, 0x71, 0xE5, 0xAA, 0xAA, 0xEA, 0xAA, 0x90, 0xAF, 0xFD, 0x90, 0xFF, 0xE5, 0xDA, 0x70,
+    0xAD, 0x97, 0x0E, 0x71, 0xE9, 0x99, 0x5A, 0xFD, 0x94, 0xFE, 0x94, 0xAF, 0xD9, 0x20, 0x77, 0x77,
+    0x2E, 0xA1, 0x9C, 0x75, 0xAC, 0x99, 0xC9, 0x0A, 0xC7, 0x5C, 0xA1, 0xAE, 0x76, 0xC9, 0x29, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x79, 0x99, 0x97, 0x99, 0x99, 0x94, 0x9E, 0xA7, 0xF9, 0x4A, 0xE9, 0x7F,
+    0x5F, 0x79, 0xEA, 0x5E, 0xA7, 0xAE, 0x94, 0x9E, 0x97, 0xAE, 0x5A, 0xE7, 0x0F, 0x5F, 0x70, 0xE9,
+    0x5E, 0x97, 0x9E, 0x59, 0xE7, 0x0A, 0xE5, 0xAE, 0x70, 0xEA, 0x5A, 0xDA, 0x70, 0xE9, 0x5E, 0x97,
+    0x9E, 0x6E, 0x70, 0xAD, 0xA5, 0x9E, 0x70, 0xE9, 0x5A, 0xE7, 0xAE, 0x6F, 0x95, 0xAE, 0xA6, 0xFD,
+    0xAA, 0xAF, 0xD7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0x70, 0x9F, 0xFF, 0x97, 0x19, 0xAF, 0xFA, 0x77,
+    0x77, 0x77, 0x4A, 0xE2, 0xC9, 0x49, 0xC9, 0x0C, 0xA0, 0xAC, 0x5D, 0x19, 0xE9, 0x5A, 0xA3, 0x99,
+    0x77, 0x77, 0x77, 0x1D, 0x6D, 0xA1, 0x9D, 0x6D, 0x91, 0xAD, 0x5A, 0xD2, 0xDA, 0x5E, 0x2D, 0x95,
+    0xDA, 0x19, 0xD5, 0x9D, 0x91, 0x9D, 0x5A, 0xD2, 0xAD, 0x5E, 0x2D, 0xA4, 0xAD, 0xA2, 0xE3, 0xAE,
+    0xA2, 0xFF, 0xE9, 0x2F, 0xFE, 0x3F, 0xFE, 0x39, 0xFD, 0x9D, 0xA5, 0x99, 0x97, 0x00, 0x77, 0x77,
+    0x1A, 0xFF, 0xC7, 0x3F, 0xFA, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0xEA, 0x7F, 0x94,
+    0xAE, 0x97, 0xF5, 0xF7, 0x0F, 0x5E, 0xA7, 0x9E, 0x94, 0x9E, 0x97, 0xAE, 0x5A, 0xE7, 0x0F, 0x5F,
+    0x70, 0xEA, 0x5E, 0xA7, 0x9E, 0x6E, 0x70, 0xAE, 0x59, 0xE7, 0x0E, 0xA5, 0xAD, 0xA7, 0x0E, 0x95,
+    0xE9, 0x79, 0xE6, 0xE7, 0x0A, 0xDA, 0x59, 0xE7, 0x0E, 0x95, 0xAE, 0x7A, 0xE6, 0xF9, 0x5A, 0xEA,
+    0x6F, 0xDA, 0xAA, 0xFD, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xD7, 0x09, 0xFF, 0xF9, 0x71, 0x9F, 0xFC,
+    0xA7, 0x77, 0x70, 0x75, 0x95, 0xAF, 0xFC, 0x4A, 0xFE, 0xAA, 0xA7, 0x77, 0x77, 0x73, 0xD6, 0xDA,
+    0x29, 0xD6, 0xD9, 0x2A, 0xD5, 0xAD, 0x3D, 0xA5, 0xE3, 0xD9, 0x5D, 0xA2, 0x9D, 0x59, 0xD9, 0x29,
+    0xD5, 0xAD, 0x3A, 0xD5, 0xE3, 0xDA, 0x4A, 0xDA, 0x3E, 0x3A, 0xEA, 0x3F, 0xFE, 0x93, 0xFF, 0xE4,
+    0xFF, 0xE4, 0x9F, 0xD9, 0xDA, 0x69, 0x99, 0x71, 0x72, 0xCA, 0x5A, 0xA7, 0x4D, 0x49, 0xC9, 0x74,
+    0xDA, 0x99, 0x9A, 0xCA, 0x75, 0x9F, 0xDA, 0x77, 0x9E, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x69, 0x99, 0x97, 0x09, 0x99, 0x59, 0xEA, 0x7F, 0x94, 0xAE, 0x97, 0xF5, 0xF7, 0x9F, 0x5E, 0xA7,
+    0x9E, 0x94, 0x9E, 0x97, 0xAE, 0x5A, 0xE7, 0x0F, 0x5F, 0x70, 0xEA, 0x5E, 0x97, 0x9E, 0x59, 0xE7,
+    0x0A, 0xE5, 0x9E, 0x70, 0xEA, 0x5A, 0xDA, 0x70, 0xE9, 0x5E, 0x97, 0x9E, 0x6E, 0x70, 0xAD, 0xA5,
+    0x9E, 0x70, 0xE9, 0x5A, 0xE7, 0xAE, 0x6F, 0x95, 0xAE, 0xA6, 0xFD, 0xAA, 0xAF, 0xD7, 0xFF, 0xFD,
+    0xA7, 0xFF, 0xFD, 0x70, 0x9F, 0xFF, 0x97, 0x19, 0xAF, 0xFA, 0x77, 0x77, 0x4A, 0xC5, 0x9C, 0x5D,
+    0x5C, 0xA5, 0xAD, 0x99, 0x9A, 0xD7, 0xFE, 0x71, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x76, 0xD6, 0xDA,
+    0x29, 0xD6, 0xD9, 0x2A, 0xD5, 0xAD, 0x3D, 0xA5, 0xE3, 0xD9, 0x5D, 0xA2, 0x9D, 0x59, 0xD9, 0x29,
+    0xD5, 0xAD, 0x3A, 0xD5, 0xE3, 0xDA, 0x4A, 0xDA, 0x3E, 0x3A, 0xEA, 0x3F, 0xFE, 0x93, 0xFF, 0xE4,
+    0xFF, 0xE4, 0x9F, 0xD9, 0xDA, 0x69, 0x99, 0x71, 0x76, 0xAD, 0x77, 0x2C, 0xA1, 0xA7, 0x70, 0x9C,
+    0x19, 0xA7, 0x71, 0xCA, 0xAC, 0x97, 0x71, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x99,
+    0x99, 0x70, 0x99, 0x95, 0x9E, 0xA7, 0xF9, 0x4A, 0xE9, 0x7F, 0x5F, 0x79, 0xF5, 0xEA, 0x79, 0xE9,
+    0x49, 0xE9, 0x7A, 0xE5, 0xAE, 0x70, 0xF5, 0xF7, 0x0E, 0xA5, 0xE9, 0x79, 0xE5, 0x9E, 0x70, 0xAE,
+    0x59, 0xE7, 0x0E, 0xA5, 0xAD, 0xA7, 0x0E, 0x95, 0xE9, 0x79, 0xE6, 0xE7, 0x0A, 0xDA, 0x59, 0xE7,
+    0x0E, 0x95, 0xAE, 0x7A, 0xE6, 0xF9, 0x5A, 0xEA, 0x6F, 0xDA, 0xAA, 0xFD, 0x7F, 0xFF, 0xDA, 0x7F,
+    0xFF, 0xD7, 0x09, 0xFF, 0xF9, 0x71, 0x9A, 0xFF, 0xA7, 0x77, 0x70, 0x70, 0x9D, 0x97, 0x1A, 0xA1,
+    0xC7, 0x1C, 0x2C, 0x71, 0xCA, 0xAC, 0xA7, 0x19, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x1D, 0x6D, 0xA1,
+    0x9D, 0x6D, 0x91, 0xAD, 0x5A, 0xD2, 0xDA, 0x5E, 0x2D, 0x95, 0xDA, 0x19, 0xD5, 0x9D, 0x91, 0x9D,
+    0x5A, 0xD2, 0xAD, 0x5E, 0x2D, 0xA4, 0xAD, 0xA2, 0xE3, 0xAE, 0xA2, 0xFF, 0xE9, 0x2F, 0xFE, 0x3F,
+    0xFE, 0x39, 0xFD, 0x9D, 0xA5, 0x99, 0x97, 0x00, 0x72, 0x99, 0x70, 0x99, 0x71, 0xAD, 0x69, 0xD9,
+    0x70, 0xAD, 0x95, 0x9D, 0xA7, 0x0A, 0xD9, 0x5A, 0xDA, 0x71, 0x97, 0x09, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x29, 0x99, 0x71, 0x99, 0x96, 0x9E, 0xA7, 0xF9, 0x5A, 0xE9, 0x7F, 0x6F, 0x70, 0xF6, 0xEA,
+    0x79, 0xE9, 0x59, 0xE9, 0x7A, 0xE6, 0xAE, 0x70, 0xF6, 0xF7, 0x0E, 0xA6, 0xEA, 0x79, 0xE6, 0x9E,
+    0x70, 0xAE, 0x69, 0xE7, 0x0E, 0xA6, 0xAD, 0xA7, 0x0E, 0x96, 0xE9, 0x79, 0xE7, 0xE7, 0x0A, 0xDA,
+    0x69, 0xE7, 0x0E, 0x96, 0xAE, 0x7A, 0xE7, 0xF9, 0x5A, 0xEA, 0x7F, 0xDA, 0xAA, 0xFD, 0x70, 0xFF,
+    0xFD, 0xA7, 0x0F, 0xFF, 0xD7, 0x19, 0xFF, 0xF9, 0x72, 0x9A, 0xFF, 0xA7, 0x77, 0x71, 0x49, 0x99,
+    0x79, 0x94, 0x9D, 0x96, 0xDA, 0x39, 0xDA, 0x59, 0xDA, 0x3A, 0xDA, 0x59, 0xE4, 0x97, 0x09, 0x77,
+    0x77, 0x77, 0x77, 0x1D, 0x6D, 0xA5, 0x9D, 0x6D, 0x95, 0xAD, 0x5A, 0xD6, 0xDA, 0x5E, 0x6D, 0x95,
+    0xDA, 0x59, 0xD5, 0x9D, 0x95, 0x9D, 0x5A, 0xD6, 0xAD, 0x5E, 0x6D, 0xA4, 0xAD, 0xA6, 0xE3, 0xAE,
+    0xA6, 0xFF, 0xE9, 0x6F, 0xFE, 0x7F, 0xFE, 0x79, 0xFD, 0x9D, 0xA7, 0x19, 0x99, 0x74, 0x59, 0x99,
+    0x71, 0x99, 0x95, 0x9E, 0xA7, 0xF9, 0x4A, 0xE9, 0x7F, 0x5F, 0x70, 0xF5, 0xEA, 0x79, 0xE9, 0x49,
+    0xE9, 0x7A, 0xE5, 0xAE, 0x70, 0xF5, 0xF7, 0x0E, 0xA5, 0xEA, 0x79, 0xE5, 0x9E, 0x70, 0xAE, 0x59,
+    0xE7, 0x0E, 0xA5, 0xAD, 0xA7, 0x0E, 0x95, 0xE9, 0x79, 0xE6, 0xE7, 0x0A, 0xDA, 0x59, 0xE7, 0x0E,
+    0x95, 0xAE, 0x7A, 0xE6, 0xF9, 0x5A, 0xEA, 0x6F, 0xDA, 0xAA, 0xFD, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF,
+    0xD7, 0x09, 0xFF, 0xF9, 0x71, 0x9A, 0xFF, 0xA7, 0x72, 0xCA, 0x77, 0x3C, 0xA7, 0x73, 0x9C, 0x77,
+    0x5E, 0xA7, 0x73, 0x9A, 0x97, 0x10, 0x2D, 0x6D, 0xA1, 0x9D, 0x6D, 0x91, 0xAD, 0x5A, 0xD2, 0xDA,
+    0x5E, 0x2D, 0x95, 0xDA, 0x19, 0xD5, 0x9D, 0x91, 0x9D, 0x5A, 0xD2, 0xAD, 0x5E, 0x2D, 0xA4, 0xAD,
+    0xA2, 0xE3, 0xAE, 0xA2, 0xFF, 0xE9, 0x2F, 0xFE, 0x3F, 0xFE, 0x39, 0xFD, 0x9D, 0xA5, 0x99, 0x91,
+    0xCA, 0x72, 0x9C, 0x97, 0x3C, 0x97, 0x3A, 0xC7, 0x49, 0xE9, 0x73, 0x9A, 0x94, 0x74, 0xAC, 0x77,
+    0x71, 0xE7, 0x77, 0xDA, 0xD7, 0x75, 0xAC, 0x91, 0xAC, 0x97, 0x72, 0x9C, 0x94, 0xCA, 0x77, 0x77,
+    0x5E, 0x77, 0x2A, 0xDA, 0x09, 0xE7, 0x72, 0xE1, 0x9E, 0x77, 0x1E, 0xA1, 0x9E, 0x77, 0x09, 0xE2,
+    0x9E, 0x77, 0x0E, 0xA2, 0x9E, 0x77, 0x9E, 0x3A, 0xE5, 0xAD, 0xA5, 0xE9, 0x3A, 0xE4, 0x9E, 0xA4,
+    0x9E, 0x4A, 0xE4, 0xFC, 0x4E, 0x94, 0xAE, 0x3F, 0xD3, 0xAE, 0x5A, 0xDA, 0x2F, 0xE9, 0x2E, 0x95,
+    0xEA, 0x1A, 0xE9, 0xEA, 0x1A, 0xE6, 0xEA, 0x09, 0xF0, 0xF1, 0xE9, 0x6E, 0xA0, 0xF1, 0xF0, 0xAE,
+    0x7E, 0xAF, 0x91, 0xAE, 0x9E, 0x97, 0xFF, 0x2A, 0xFE, 0x70, 0xFE, 0x3A, 0xFD, 0x97, 0x0F, 0xD9,
+    0x39, 0xFD, 0x71, 0xFC, 0xA4, 0x9F, 0xC9, 0x71, 0xFC, 0x6F, 0xC7, 0x19, 0xF9, 0x6F, 0x97, 0x10,
+    0x70, 0xC9, 0x77, 0x0A, 0xD9, 0x76, 0x9F, 0xA7, 0x5D, 0x19, 0xCA, 0x73, 0xCA, 0x4A, 0xC7, 0x77,
+    0x77, 0x5E, 0x73, 0xE1, 0xE7, 0x2A, 0xD9, 0x1D, 0xA7, 0x2E, 0x2D, 0xA7, 0x1A, 0xD9, 0x2D, 0xA2,
+    0x9D, 0x3E, 0x3D, 0xA1, 0x9E, 0x91, 0xAD, 0x92, 0x9D, 0xA0, 0x9F, 0xC1, 0xE3, 0x9D, 0xA9, 0xFD,
+    0x9A, 0xD9, 0x39, 0xFF, 0xFC, 0xA4, 0x9F, 0xFF, 0xC5, 0x9F, 0xCA, 0x9F, 0xCA, 0x59, 0xFC, 0x1F,
+    0xC6, 0x9F, 0x2A, 0xEA, 0x69, 0xE3, 0x9E, 0x70, 0x7D, 0x76, 0x9E, 0x75, 0xDA, 0xD7, 0x3D, 0x2A,
+    0xC9, 0x70, 0x9C, 0x5A, 0x97, 0x77, 0x77, 0xE7, 0x1A, 0xD9, 0x0E, 0x97, 0x9D, 0xA1, 0xAD, 0xA6,
+    0x9E, 0x29, 0xE6, 0xE3, 0x9E, 0x5E, 0x94, 0xE9, 0x3E, 0xA5, 0xF2, 0xAE, 0x6A, 0xE1, 0x9E, 0x79,
+    0xE9, 0x9E, 0x97, 0x0F, 0xEA, 0x71, 0xFE, 0x72, 0xFD, 0x73, 0xAF, 0x97, 0x39, 0xEA, 0x74, 0xAE,
+    0x75, 0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x73, 0xAF, 0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x30, 0x72, 0xCA,
+    0x77, 0xAD, 0x97, 0x6D, 0xAC, 0xA7, 0x4D, 0x19, 0xD7, 0x2A, 0xC4, 0x9C, 0x77, 0x77, 0x77, 0x77,
+    0xD9, 0x6A, 0xD5, 0xDA, 0x6D, 0x95, 0xAD, 0x5A, 0xD6, 0x9D, 0x93, 0x9D, 0x97, 0xDA, 0x3E, 0x70,
+    0xE2, 0x9D, 0x97, 0x0A, 0xD9, 0x1E, 0x71, 0x9D, 0xA0, 0xAD, 0x97, 0x2E, 0x0E, 0x73, 0xFD, 0x97,
+    0x3A, 0xFC, 0x74, 0x9F, 0x97, 0x49, 0xF7, 0x59, 0xE9, 0x75, 0xF7, 0x5F, 0x74, 0xAF, 0x97, 0x1F,
+    0xEA, 0x71, 0x9F, 0xD9, 0x72, 0xAF, 0x97, 0x77, 0x70, 0x77, 0x79, 0xD9, 0x2A, 0xD9, 0x6E, 0x92,
+    0xE6, 0x9E, 0x2A, 0xE6, 0xF2, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x2E, 0x71, 0xAD, 0x90, 0xE9, 0x79,
+    0xDA, 0x1A, 0xDA, 0x69, 0xE2, 0x9E, 0x6E, 0x39, 0xE5, 0xE9, 0x4E, 0x93, 0xEA, 0x5F, 0x2A, 0xE6,
+    0xAE, 0x19, 0xE7, 0x9E, 0x99, 0xE9, 0x70, 0xFE, 0xA7, 0x1F, 0xE7, 0x2F, 0xD7, 0x3A, 0xF9, 0x73,
+    0x9E, 0xA7, 0x4A, 0xE7, 0x5F, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x3A, 0xF7, 0x4F, 0xC7, 0x39, 0xFA,
+    0x73, 0x77, 0x09, 0xC9, 0x77, 0x5D, 0x77, 0x5D, 0x97, 0x74, 0xAC, 0xA7, 0x74, 0x9D, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x3F, 0xFF, 0xF7, 0x0F, 0xFF, 0xEA, 0x70, 0xAF, 0xFF, 0xD7, 0x19,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC7, 0x72, 0xAF, 0x77, 0x2F, 0xC7, 0x71, 0x9F, 0xC7, 0x71, 0xAF,
+    0xA7, 0x71, 0xFC, 0xA7, 0x70, 0x9F, 0xC9, 0x77, 0x09, 0xFC, 0x97, 0x70, 0xAF, 0xC7, 0x71, 0xFD,
+    0x77, 0x09, 0xFC, 0xA7, 0x70, 0xAF, 0xCA, 0x77, 0x0A, 0xFC, 0x97, 0x70, 0xFD, 0x97, 0x70, 0xFF,
+    0xFF, 0xCA, 0x6F, 0xFF, 0xFC, 0xA5, 0x9F, 0xFF, 0xFD, 0x5F, 0xFF, 0xFD, 0xA5, 0x74, 0x9C, 0x97,
+    0x5C, 0xA7, 0x5D, 0x75, 0xAC, 0xA7, 0x49, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x5F, 0xFD, 0x59, 0xFF,
+    0xD5, 0x99, 0x99, 0x99, 0x9E, 0xA7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0x9E, 0x73, 0xAE, 0x73, 0xEA,
+    0x72, 0x9E, 0x97, 0x2A, 0xE9, 0x72, 0xF7, 0x3F, 0xFE, 0x5F, 0xFE, 0x93, 0xAF, 0xFE, 0xA3, 0x77,
+    0x77, 0x7E, 0x77, 0x49, 0xE7, 0x74, 0xF7, 0x73, 0x9E, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1F,
+    0xFF, 0xF7, 0x0F, 0xFF, 0xEA, 0x70, 0xAF, 0xFF, 0xD7, 0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC7,
+    0x72, 0xAF, 0x77, 0x2F, 0xC7, 0x71, 0x9F, 0xC7, 0x71, 0xAF, 0xA7, 0x71, 0xFC, 0xA7, 0x70, 0x9F,
+    0xC9, 0x77, 0x09, 0xFC, 0x97, 0x70, 0xAF, 0xC7, 0x71, 0xFD, 0x77, 0x09, 0xFC, 0xA7, 0x70, 0xAF,
+    0xCA, 0x77, 0x0A, 0xFC, 0x97, 0x70, 0xFD, 0x97, 0x70, 0xFF, 0xFF, 0xCA, 0x6F, 0xFF, 0xFC, 0xA5,
+    0x9F, 0xFF, 0xFD, 0x5F, 0xFF, 0xFD, 0xA5, 0x72, 0xE7, 0x49, 0xE7, 0x4E, 0xA7, 0x39, 0xEA, 0x77,
+    0x77, 0x77, 0x77, 0x74, 0xFF, 0xD5, 0x9F, 0xFD, 0x59, 0x99, 0x99, 0x99, 0xEA, 0x73, 0xEA, 0x72,
+    0x9E, 0x97, 0x29, 0xE7, 0x3A, 0xE7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x97, 0x2F, 0x73, 0xFF,
+    0xE5, 0xFF, 0xE9, 0x3A, 0xFF, 0xEA, 0x30, 0x72, 0x96, 0x97, 0x7C, 0xA3, 0x9C, 0x97, 0x70, 0xD0,
+    0x9D, 0x77, 0x29, 0xEA, 0x77, 0x4D, 0xA7, 0x75, 0x9A, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xFF,
+    0xFF, 0x70, 0xFF, 0xFE, 0xA7, 0x0A, 0xFF, 0xFD, 0x71, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x77,
+    0x2A, 0xF7, 0x72, 0xFC, 0x77, 0x19, 0xFC, 0x77, 0x1A, 0xFA, 0x77, 0x1F, 0xCA, 0x77, 0x09, 0xFC,
+    0x97, 0x70, 0x9F, 0xC9, 0x77, 0x0A, 0xFC, 0x77, 0x1F, 0xD7, 0x70, 0x9F, 0xCA, 0x77, 0x0A, 0xFC,
+    0xA7, 0x70, 0xAF, 0xC9, 0x77, 0x0F, 0xD9, 0x77, 0x0F, 0xFF, 0xFC, 0xA6, 0xFF, 0xFF, 0xCA, 0x59,
+    0xFF, 0xFF, 0xD5, 0xFF, 0xFF, 0xDA, 0x50, 0x59, 0xA5, 0xAA, 0x7D, 0x29, 0xCA, 0x71, 0xD9, 0xD9,
+    0x72, 0x9E, 0x75, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x7F, 0xFD, 0x59, 0xFF, 0xD5, 0x99, 0x99, 0x99,
+    0x9E, 0xA7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0x9E, 0x73, 0xAE, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x2A,
+    0xE9, 0x72, 0xF7, 0x3F, 0xFE, 0x5F, 0xFE, 0x93, 0xAF, 0xFE, 0xA3, 0x70, 0xAD, 0xA7, 0x9F, 0xC7,
+    0xDA, 0x19, 0x6D, 0xA7, 0x19, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xAD, 0x72, 0xDA,
+    0x72, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x19, 0xDA,
+    0x71, 0xAD, 0x97, 0x1E, 0x97, 0x00, 0x77, 0x77, 0x77, 0x70, 0xAC, 0x72, 0x9A, 0xFC, 0xA7, 0x0D,
+    0x70, 0xAF, 0xFD, 0xA5, 0x9C, 0x96, 0x9F, 0xC9, 0x99, 0xAF, 0xA3, 0x9D, 0x69, 0xF9, 0x5F, 0x2E,
+    0x69, 0xEA, 0x79, 0xE9, 0x1A, 0xA7, 0xF7, 0x1E, 0xA7, 0x2A, 0xE7, 0x2E, 0xA7, 0x2E, 0x97, 0x2A,
+    0xDA, 0x71, 0x9E, 0x73, 0xAD, 0x97, 0x1E, 0x97, 0x3E, 0x72, 0xE7, 0x4E, 0x71, 0x9D, 0xA7, 0x39,
+    0xDA, 0x71, 0xAD, 0xA7, 0x3E, 0x97, 0x1A, 0xDA, 0x72, 0xAE, 0x72, 0xAE, 0x97, 0x0F, 0x97, 0x2A,
+    0xFC, 0x99, 0x99, 0x9A, 0xFD, 0x73, 0x9F, 0xFF, 0xF9, 0x74, 0xFF, 0xFE, 0xA7, 0x5A, 0xFF, 0xFC,
+    0xA7, 0x7A, 0xFF, 0xE9, 0x77, 0x2A, 0xFD, 0xA9, 0x77, 0x77, 0x75, 0x77, 0x0A, 0x96, 0xAA, 0xEA,
+    0x3C, 0x94, 0x9F, 0xF1, 0xAC, 0x4A, 0xE9, 0x99, 0x9E, 0xAC, 0x93, 0x9D, 0x94, 0x9E, 0x94, 0xDA,
+    0x6D, 0x94, 0x9D, 0x7D, 0x94, 0xDA, 0x69, 0xD5, 0xD9, 0x6E, 0x49, 0xD6, 0x9D, 0x94, 0x9D, 0xA4,
+    0x9E, 0x6F, 0xCA, 0xFC, 0x96, 0xFF, 0xD9, 0x70, 0xFF, 0x97, 0x2A, 0xEA, 0x97, 0x00, 0x49, 0xAF,
+    0xFA, 0x7A, 0xFF, 0xF9, 0x4A, 0xFC, 0x99, 0x99, 0x9F, 0x39, 0xFC, 0xA5, 0x9D, 0x92, 0xD9, 0x9D,
+    0x96, 0xD9, 0x2C, 0xA0, 0xE6, 0xAD, 0x29, 0xC1, 0xDA, 0x6E, 0x3C, 0x09, 0xD9, 0x4A, 0xE9, 0x39,
+    0x0F, 0xFF, 0xA6, 0xFF, 0xEA, 0x69, 0xFF, 0xA9, 0x70, 0xEA, 0x77, 0xE9, 0x76, 0x9E, 0x77, 0xF7,
+    0x7E, 0xA7, 0x69, 0xE9, 0x76, 0xAE, 0x97, 0x6F, 0x76, 0x9F, 0x76, 0xAE, 0xA7, 0x60, 0x77, 0x74,
+    0xAE, 0x76, 0x9E, 0xA7, 0x6D, 0xA7, 0x79, 0xD1, 0xAA, 0xCA, 0x97, 0x1A, 0xCA, 0x9F, 0xDA, 0x70,
+    0xFD, 0x90, 0x9D, 0x97, 0xF9, 0x39, 0xCA, 0x69, 0xE9, 0x49, 0xCA, 0x6A, 0xDA, 0x59, 0xCA, 0x6E,
+    0x95, 0xAC, 0xA5, 0x9E, 0x6D, 0x95, 0xAE, 0x59, 0xD6, 0xFA, 0x4D, 0xA6, 0xFD, 0xA9, 0xAE, 0x69,
+    0xFF, 0xE9, 0x6E, 0xAF, 0xE9, 0x69, 0xD9, 0x0A, 0xFC, 0x70, 0xE3, 0x99, 0x71, 0x9D, 0xA7, 0x7E,
+    0x77, 0x9E, 0x77, 0xE9, 0x77, 0xE7, 0x77, 0x73, 0x49, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x49, 0xC9,
+    0x76, 0xD7, 0x7C, 0xA7, 0x69, 0xC9, 0x76, 0xAC, 0x77, 0xCA, 0x76, 0x9C, 0x76, 0xAC, 0x75, 0xD7,
+    0x49, 0xD7, 0x4A, 0xCA, 0x74, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xEA, 0xAA, 0xAA, 0xAA, 0x94, 0xAF,
+    0xFD, 0x94, 0xFF, 0xE7, 0x75, 0x09, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xFC, 0x1F, 0xFD, 0xAA, 0xAF,
+    0xA1, 0xAD, 0xA9, 0xA9, 0xE7, 0x1A, 0xC4, 0xDA, 0x72, 0x93, 0xAD, 0x97, 0x7E, 0x97, 0x7E, 0x77,
+    0x9E, 0x77, 0xEA, 0x77, 0xE9, 0x76, 0x9E, 0x77, 0xAE, 0x77, 0xEA, 0x76, 0x9E, 0x97, 0x6A, 0xE7,
+    0x7F, 0x76, 0x9E, 0xA7, 0x6A, 0xE9, 0x76, 0xF7, 0x7F, 0x74, 0x77, 0x4A, 0xCA, 0x69, 0xE9, 0x59,
+    0xF6, 0xE9, 0x6E, 0x79, 0xD9, 0x7A, 0xD5, 0x9A, 0xAE, 0xAA, 0xA9, 0x09, 0xFF, 0xC9, 0x3A, 0xD7,
+    0x0E, 0x79, 0xD9, 0x7A, 0xD7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x70, 0xE9, 0x99, 0x4A, 0xFD,
+    0x93, 0xFE, 0x93, 0xAF, 0xD9, 0x30, 0x09, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xFC, 0x1F, 0xDA, 0xEA,
+    0xAA, 0xFA, 0x70, 0xE7, 0x70, 0xDA, 0x77, 0x9D, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0x9E, 0x77, 0xAD,
+    0xA7, 0x7E, 0x97, 0x69, 0xE7, 0x7A, 0xE7, 0x7E, 0xA7, 0x69, 0xE9, 0x76, 0xAE, 0x77, 0xF7, 0x7E,
+    0xA7, 0x6A, 0xE9, 0x76, 0xF7, 0x7F, 0x76, 0x9F, 0x97, 0x59, 0xFC, 0xA7, 0x5F, 0xD7, 0x6A, 0xF7,
+    0x70, 0xAD, 0x72, 0x77, 0x79, 0x69, 0xEA, 0x7A, 0xE9, 0x0A, 0xC5, 0xAE, 0x97, 0xF0, 0x9D, 0x5F,
+    0x70, 0xFE, 0x95, 0xF7, 0x9E, 0xAA, 0xA6, 0x9E, 0x97, 0xAE, 0x71, 0xAE, 0x70, 0xF7, 0x1A, 0xE7,
+    0x0E, 0xA7, 0x1E, 0xA7, 0x9E, 0x97, 0x1E, 0x70, 0xAE, 0x71, 0x9E, 0x70, 0xEA, 0x71, 0xAD, 0xA7,
+    0x0E, 0x97, 0x1E, 0x97, 0x9E, 0x72, 0xE7, 0x0A, 0xDA, 0x71, 0x9E, 0x70, 0xE9, 0x71, 0xAE, 0x7A,
+    0xE7, 0x2F, 0x95, 0xAE, 0xA7, 0x2F, 0xDA, 0xAA, 0xFD, 0x73, 0xFF, 0xFD, 0xA7, 0x3F, 0xFF, 0xD7,
+    0x49, 0xFF, 0xF9, 0x75, 0x9F, 0xFC, 0xA7, 0x77, 0x77, 0x77, 0x97, 0x70, 0xC9, 0x2D, 0x6D, 0xA9,
+    0xC2, 0x9D, 0x6D, 0xAC, 0xA2, 0xAD, 0x5A, 0xF3, 0xDA, 0x5E, 0x94, 0xD9, 0x5D, 0xA4, 0x9D, 0x59,
+    0xD9, 0x49, 0xD5, 0xAD, 0x5A, 0xD5, 0xE5, 0xDA, 0x4A, 0xDA, 0x5E, 0x3A, 0xEA, 0x5F, 0xFE, 0x95,
+    0xFF, 0xE6, 0xFF, 0xE6, 0x9F, 0xD9, 0xDA, 0x70, 0x99, 0x97, 0x30, 0x0D, 0x93, 0x9D, 0x93, 0xAD,
+    0x93, 0x9A, 0xA9, 0x3C, 0xA2, 0xD2, 0xAC, 0x91, 0x9C, 0xA2, 0xD2, 0x3C, 0xA7, 0xAD, 0x95, 0x9D,
+    0xAC, 0xA4, 0xCA, 0x2D, 0x2A, 0xA4, 0x9C, 0x00, 0x1D, 0xA2, 0xAA, 0x0D, 0x9C, 0x91, 0xC9, 0x9C,
+    0x90, 0xAC, 0x0A, 0xC0, 0xAC, 0x2E, 0xA6, 0x99, 0x10, 0x72, 0x92, 0xAF, 0xFC, 0x1A, 0xFE, 0xAA,
+    0xA7, 0x50, 0x77, 0x2A, 0xAF, 0xFF, 0x90, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0x00, 0x0C,
+    0xA5, 0xAA, 0x0D, 0x49, 0xC9, 0x0D, 0xA9, 0x99, 0xDA, 0x19, 0xFD, 0xA3, 0x9E, 0xA9, 0x20, 0x6D,
+    0xA0, 0xAD, 0xA0, 0xE9, 0xAE, 0x90, 0x75, 0xE3, 0xDA, 0x0A, 0xDA, 0x2A, 0xDA, 0x0E, 0xA2, 0xE9,
+    0x9E, 0x91, 0xAE, 0x90, 0x0A, 0xDA, 0x19, 0x1C, 0xA2, 0xAC, 0x91, 0xD3, 0xA2, 0x19, 0xDA, 0x19,
+    0xC1, 0xC1, 0xC9, 0x1C, 0x1C, 0xAA, 0xCA, 0x2D, 0xA1, 0x29, 0xD9, 0x6D, 0xA1, 0x9D, 0xA6, 0xE1,
+    0x9E, 0x6E, 0x19, 0xAA, 0x96, 0xAA, 0x92, 0x9C, 0x5A, 0xA1, 0xAC, 0x91, 0x9C, 0xA3, 0xDA, 0xD9,
+    0x5E, 0x7A, 0xC5, 0x0D, 0xA6, 0xAD, 0x5D, 0xA6, 0xE4, 0x9D, 0xA6, 0xE4, 0x9A, 0xAA, 0x69, 0xAA,
+    0x00, 0x99, 0x99, 0x93, 0xF3, 0xAE, 0x93, 0xEA, 0x39, 0xE4, 0xF4, 0xE9, 0x70, 0x2A, 0xEA, 0x2F,
+    0x29, 0xE9, 0x2A, 0xE3, 0xE9, 0x2F, 0x29, 0xE9, 0x20, 0xAE, 0xA3, 0xF3, 0x9E, 0x93, 0xEA, 0x39,
+    0xE4, 0xF3, 0x9E, 0x90, 0x3C, 0x92, 0x9C, 0x1F, 0x19, 0x9C, 0xA3, 0xC9, 0x60, 0xAA, 0x29, 0xC3,
+    0xEA, 0x0D, 0x91, 0xAC, 0x60, 0x0A, 0xDA, 0xAA, 0xA9, 0x91, 0xFF, 0xC9, 0x7D, 0x79, 0xD7, 0xAC,
+    0xA7, 0xAC, 0x90, 0x29, 0xA2, 0xAC, 0x2C, 0x90, 0x9C, 0xA1, 0xCA, 0x60, 0x1A, 0xA0, 0xA9, 0x1C,
+    0x2C, 0xA4, 0x19, 0x4C, 0x91, 0xA9, 0xC9, 0x1A, 0xEA, 0x29, 0xAC, 0x00, 0xAA, 0x92, 0x9F, 0x2C,
+    0xAA, 0x2C, 0x93, 0x92, 0x2A, 0x4C, 0x2A, 0xDA, 0x2A, 0x93, 0xA2, 0x74, 0x9A, 0xFF, 0xA0, 0xFE,
+    0xAA, 0xA9, 0x73, 0x1E, 0x0A, 0xDA, 0x0E, 0xA9, 0xE9, 0x40, 0x76, 0x9D, 0x92, 0xAD, 0x91, 0xE9,
+    0x2E, 0x19, 0xE2, 0xAE, 0x1F, 0x2F, 0x00, 0x19, 0xDA, 0x19, 0xC1, 0xC1, 0xC9, 0x1C, 0x1C, 0xAA,
+    0xCA, 0x2D, 0xA1, 0x39, 0x99, 0x92, 0xF9, 0x2F, 0x2A, 0xE9, 0x2F, 0x29, 0xE9, 0x2F, 0x2A, 0xE9,
+    0x20, 0x2A, 0x4A, 0x49, 0xCA, 0x95, 0xA9, 0x4A, 0x91, 0x99, 0xD1, 0xAD, 0xA2, 0x71, 0x9C, 0x92,
+    0xAC, 0x92, 0x9C, 0x4C, 0xA4, 0xAE, 0x49, 0xA1, 0x2A, 0xA2, 0x9D, 0x2A, 0xCA, 0x2D, 0x91, 0x9D,
+    0x2D, 0xA2, 0xD9, 0x10, 0x09, 0xFD, 0xA0, 0xAC, 0xA9, 0x9A, 0xC9, 0x0C, 0xA2, 0xAC, 0x1C, 0x92,
+    0xAA, 0x00, 0x9C, 0x5A, 0x91, 0xAC, 0x2A, 0xC9, 0x3D, 0xAD, 0x59, 0xE7, 0xD5, 0x2C, 0xA7, 0x9D,
+    0xA6, 0xDA, 0xD4, 0xAC, 0x91, 0xAC, 0x29, 0xC4, 0x9C, 0x90, 0x1D, 0xA2, 0xAA, 0x0D, 0x9C, 0x91,
+    0xC9, 0x9C, 0x90, 0xAC, 0x0A, 0xC0, 0xAC, 0x2E, 0xA6, 0x99, 0x10, 0x29, 0x99, 0x99, 0xA1, 0xFF,
+    0x72, 0x19, 0x9A, 0xAA, 0xAD, 0x1A, 0xFF, 0x73, 0x1D, 0xA2, 0xAA, 0x0D, 0x9C, 0x91, 0xC9, 0x9C,
+    0x90, 0xAC, 0x0A, 0xC0, 0xAC, 0x2E, 0xA6, 0x99, 0x10, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F,
+    0xFE, 0x09, 0xFF, 0xE0, 0x9C, 0x3C, 0x2A, 0x90, 0x9C, 0x40, 0x0C, 0xA2, 0x9C, 0x2A, 0xC2, 0x9C,
+    0x91, 0x9C, 0xA9, 0x9A, 0xCA, 0x2F, 0xE0, 0x1F, 0xDA, 0x09, 0xA3, 0xC9, 0x0A, 0x93, 0xC1, 0xC3,
+    0x9C, 0x1C, 0x3A, 0xA0, 0x9F, 0xD9, 0x71, 0x1A, 0xCA, 0x09, 0x92, 0xC1, 0xC9, 0x99, 0x0A, 0x90,
+    0x9A, 0x0A, 0x90, 0xC1, 0xA1, 0xC1, 0xA1, 0xA1, 0xC0, 0x1A, 0xA0, 0xA3, 0xD4, 0xC9, 0x3C, 0xAC,
+    0x2C, 0x1C, 0x90, 0x1D, 0xA2, 0xAA, 0x0D, 0x9C, 0x91, 0xC9, 0x9C, 0x90, 0xAC, 0x0A, 0xC0, 0xAC,
+    0x2E, 0xA6, 0x99, 0x10, 0x09, 0x92, 0xAC, 0xA2, 0x9C, 0x1A, 0xC9, 0x19, 0x20, 0x70, 0xAC, 0x70,
+    0x9C, 0xA7, 0x0D, 0x70, 0xD9, 0x7A, 0xCA, 0x77, 0x74, 0xE3, 0xDA, 0x0A, 0xDA, 0x2A, 0xDA, 0x0E,
+    0xA2, 0xE9, 0x9E, 0x91, 0xAE, 0x90, 0x09, 0x99, 0x99, 0x99, 0x1F, 0xE0, 0x9C, 0x92, 0xCA, 0x0A,
+    0xC3, 0xC9, 0x09, 0x93, 0x91, 0x77, 0x0A, 0xAF, 0xF9, 0x19, 0xFE, 0xAA, 0xA9, 0x77, 0x77, 0x73,
+    0xAA, 0xAA, 0xFD, 0x2F, 0xFE, 0x77, 0x1D, 0x92, 0xAC, 0xA1, 0xD3, 0xD9, 0x09, 0xD2, 0x9D, 0x1D,
+    0xA2, 0xAC, 0xA1, 0xD9, 0x2D, 0x90, 0xAD, 0x29, 0xD1, 0x9A, 0x92, 0x9A, 0xA1, 0x70, 0xFE, 0x0F,
+    0xDA, 0x4D, 0x93, 0x9D, 0x4A, 0xD7, 0x00, 0x71, 0x97, 0x19, 0x97, 0x1C, 0x71, 0xC7, 0x19, 0xA4,
+    0xDA, 0x1C, 0xAA, 0x2D, 0x9C, 0x9C, 0x9C, 0x91, 0x9C, 0x90, 0xAC, 0xAA, 0xC2, 0xAC, 0x2E, 0xA2,
+    0x99, 0x1A, 0x99, 0x96, 0x9C, 0x71, 0xC7, 0x1A, 0x97, 0x09, 0xA7, 0x74, 0x72, 0xD9, 0x77, 0x39,
+    0xD9, 0x77, 0x3E, 0x77, 0x9A, 0xFC, 0xA6, 0xE3, 0x9E, 0xA9, 0x9E, 0x94, 0xAD, 0x92, 0x9E, 0x93,
+    0xAD, 0x92, 0xAD, 0xA3, 0xE9, 0x5A, 0xFE, 0xA4, 0xDA, 0x70, 0x99, 0x99, 0x96, 0xDA, 0x77, 0x3A,
+    0xD9, 0x77, 0x39, 0x99, 0x77, 0x30, 0x77, 0x5A, 0xF9, 0x4C, 0xA3, 0xE1, 0xAC, 0x92, 0xD9, 0x2A,
+    0xD3, 0xDA, 0x9D, 0xA3, 0x9A, 0x94, 0xAE, 0xA7, 0x77, 0x77, 0x1A, 0xE9, 0x4A, 0x93, 0x9D, 0xA9,
+    0xD9, 0x29, 0xD3, 0xD9, 0x2D, 0x90, 0x9D, 0x92, 0xAD, 0x4F, 0xC9, 0x74, 0x99, 0x95, 0x74, 0xA9,
+    0x97, 0xAC, 0x97, 0x19, 0x77, 0x77, 0x97, 0x09, 0xAC, 0x97, 0x19, 0x00, 0x09, 0xA1, 0xAC, 0x91,
+    0xC4, 0x77, 0x5C, 0x77, 0x9C, 0x19, 0xC7, 0x49, 0xD4, 0xCA, 0x96, 0x9A, 0xD9, 0x69, 0xAA, 0xFC,
+    0xAA, 0x95, 0x39, 0xAF, 0xEA, 0x97, 0x9C, 0xA9, 0x69, 0xAD, 0x93, 0x9A, 0x75, 0xAC, 0x2C, 0x77,
+    0x9C, 0x77, 0x50, 0x77, 0x39, 0x77, 0x69, 0xD9, 0x2F, 0xFF, 0xFF, 0xE1, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x77, 0x4C, 0x97, 0x77, 0x40, 0x74, 0x9D, 0xA7, 0x7F, 0x76,
+    0xAF, 0x75, 0x9F, 0xC7, 0x5D, 0xAA, 0xD7, 0x4A, 0xD0, 0xAD, 0x73, 0x9D, 0x90, 0x9D, 0x97, 0x2D,
+    0xA1, 0x9D, 0x97, 0x1A, 0xD2, 0x9D, 0xA7, 0x09, 0xD9, 0x3D, 0xA7, 0x0E, 0x4E, 0x7A, 0xD5, 0xE6,
+    0x9D, 0xA5, 0xE6, 0xE6, 0xE5, 0xAF, 0xFF, 0xC9, 0x39, 0xFF, 0xFD, 0x93, 0xFF, 0xFE, 0x92, 0xAE,
+    0x99, 0x99, 0x99, 0x99, 0x9E, 0xA1, 0x9E, 0x71, 0xEA, 0x1E, 0xA7, 0x1F, 0x0A, 0xE7, 0x2F, 0x00,
+    0x77, 0x79, 0xFF, 0xC9, 0x7A, 0xFF, 0xDA, 0x6E, 0x5A, 0xD9, 0x5D, 0xA6, 0xDA, 0x49, 0xD9, 0x6D,
+    0xA4, 0xAD, 0x7D, 0x94, 0xE6, 0xE4, 0x9E, 0xAA, 0xAA, 0xAF, 0x5A, 0xFF, 0xD9, 0x6F, 0xFF, 0x95,
+    0xDA, 0x59, 0xE9, 0x39, 0xD9, 0x7D, 0xA3, 0xAD, 0x70, 0xE3, 0xE7, 0x0E, 0x3D, 0xA7, 0xAD, 0xA2,
+    0x9D, 0x96, 0x9E, 0x92, 0xAD, 0x59, 0xFC, 0x3F, 0xFF, 0xDA, 0x3F, 0xFF, 0xD3, 0x9F, 0xFF, 0xC4,
+    0xFF, 0xEA, 0x95, 0x59, 0x99, 0x99, 0x99, 0x99, 0x96, 0xFF, 0xD5, 0x9F, 0xFC, 0xA5, 0xD7, 0x6D,
+    0x75, 0x9C, 0xA7, 0x5A, 0xC9, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xD7, 0x5A, 0xCA, 0x75, 0xD9, 0x75,
+    0xD7, 0x59, 0xD7, 0x5A, 0xCA, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD7, 0x5E, 0x75, 0xDA, 0x75,
+    0x99, 0x75, 0x77, 0x77, 0x9E, 0x77, 0xF7, 0x6F, 0xC9, 0x74, 0xAD, 0xAD, 0xA7, 0x39, 0xDA, 0x0D,
+    0xA7, 0x3E, 0x1E, 0x72, 0xAD, 0x91, 0xE7, 0x19, 0xDA, 0x2E, 0x97, 0x0E, 0x3A, 0xDA, 0x7E, 0x93,
+    0xAE, 0x6A, 0xDA, 0x49, 0xE5, 0x9E, 0x6E, 0x5E, 0x96, 0xE9, 0x3E, 0xA7, 0xEA, 0x2A, 0xE7, 0x0F,
+    0x19, 0xEA, 0x99, 0x99, 0x99, 0x99, 0x9F, 0x1A, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xCA, 0x00, 0x77,
+    0x70, 0xAF, 0xFE, 0xA5, 0xFF, 0xF5, 0x9F, 0xEA, 0xAA, 0xA9, 0x5A, 0xD7, 0x7E, 0x77, 0xDA, 0x76,
+    0xAD, 0x77, 0xE7, 0x7F, 0xFC, 0xA7, 0x9F, 0xFC, 0x97, 0xAF, 0xFC, 0x70, 0xE7, 0x69, 0xDA, 0x76,
+    0xAD, 0x97, 0x6E, 0x77, 0xE7, 0x6A, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x95, 0xFF, 0xFC, 0x5F, 0xFF,
+    0xC4, 0x9F, 0xFF, 0xC4, 0xAF, 0xFF, 0xC4, 0x7F, 0xFF, 0xF7, 0x0F, 0xFF, 0xEA, 0x70, 0xAF, 0xFF,
+    0xD7, 0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC7, 0x72, 0xAF, 0x77, 0x2F, 0xC7, 0x71, 0x9F, 0xC7,
+    0x71, 0xAF, 0xA7, 0x71, 0xFC, 0xA7, 0x70, 0x9F, 0xC9, 0x77, 0x09, 0xFC, 0x97, 0x70, 0xAF, 0xC7,
+    0x71, 0xFD, 0x77, 0x09, 0xFC, 0xA7, 0x70, 0xAF, 0xCA, 0x77, 0x0A, 0xFC, 0x97, 0x70, 0xFD, 0x97,
+    0x70, 0xFF, 0xFF, 0xCA, 0x6F, 0xFF, 0xFC, 0xA5, 0x9F, 0xFF, 0xFD, 0x5F, 0xFF, 0xFD, 0xA5, 0x77,
+    0x74, 0xE7, 0x1E, 0x6E, 0x70, 0x9E, 0x59, 0xDA, 0x70, 0xAD, 0xA5, 0xAD, 0x97, 0x0E, 0x95, 0xE7,
+    0x1E, 0x59, 0xE7, 0x09, 0xE5, 0xAE, 0x70, 0xEA, 0x5E, 0xA7, 0x0E, 0x95, 0xE9, 0x79, 0xE5, 0x9E,
+    0x70, 0xAE, 0x5F, 0x70, 0xF5, 0xFF, 0xFF, 0xA4, 0x9F, 0xFF, 0xF9, 0x4A, 0xFF, 0xFF, 0x5F, 0xFF,
+    0xFC, 0x49, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xA4, 0xAE, 0x97, 0xF9, 0x4F, 0x70, 0xF5, 0xF7, 0x9F,
+    0x49, 0xF7, 0xAE, 0xA4, 0xAE, 0xA7, 0xFA, 0x40, 0x71, 0x9A, 0xFC, 0xA7, 0x5A, 0xFF, 0xDA, 0x71,
+    0x9F, 0xC9, 0x99, 0xAF, 0xA7, 0x9F, 0x95, 0xF6, 0x9E, 0xA7, 0x9E, 0x95, 0xF7, 0x1E, 0xA4, 0xAE,
+    0x72, 0xEA, 0x4E, 0x97, 0x2A, 0xDA, 0x39, 0xE7, 0x3A, 0xD9, 0x3E, 0x90, 0x9A, 0xFD, 0x91, 0xE4,
+    0xE1, 0xFC, 0xAA, 0xA2, 0xE3, 0x9D, 0xA7, 0x39, 0xDA, 0x3A, 0xDA, 0x73, 0xE9, 0x3A, 0xDA, 0x72,
+    0xAE, 0x4A, 0xE9, 0x70, 0xF9, 0x4A, 0xFC, 0x99, 0x99, 0x9A, 0xFD, 0x59, 0xFF, 0xFF, 0x96, 0xFF,
+    0xFE, 0xA7, 0xAF, 0xFF, 0xCA, 0x71, 0xAF, 0xFE, 0x97, 0x4A, 0xFD, 0xA9, 0x77, 0x77, 0x10, 0x5E,
+    0x94, 0x9E, 0x5A, 0xE5, 0xAD, 0xA5, 0xE9, 0x5E, 0x59, 0xE5, 0xAD, 0xA5, 0xE5, 0x9E, 0x5A, 0xDA,
+    0x5E, 0x95, 0xE9, 0x49, 0xE5, 0xAE, 0x5E, 0xA4, 0x9E, 0x94, 0xAE, 0x94, 0xF4, 0x9F, 0x4A, 0xEA,
+    0x40, 0x6A, 0xD9, 0x3F, 0x7E, 0x3A, 0xE7, 0x9E, 0x2A, 0xE7, 0x0A, 0xD9, 0x19, 0xE7, 0x1E, 0x19,
+    0xE9, 0x70, 0x9E, 0x09, 0xE9, 0x71, 0xAD, 0x90, 0xEA, 0x72, 0xE0, 0xEA, 0x72, 0x9F, 0xDA, 0x73,
+    0xFE, 0x74, 0xFD, 0x74, 0x9F, 0xCA, 0x74, 0xFE, 0x74, 0xFF, 0x72, 0xAE, 0x9F, 0xA7, 0x1E, 0xA0,
+    0xFC, 0x97, 0x9E, 0x19, 0xFC, 0x7A, 0xE2, 0xFC, 0xA6, 0xEA, 0x2A, 0xFC, 0x94, 0x9E, 0x4F, 0xD4,
+    0xAE, 0x4A, 0xFD, 0x30, 0x73, 0xFD, 0x97, 0x39, 0xFD, 0x97, 0x3F, 0xE9, 0x72, 0x9F, 0xEA, 0x72,
+    0xFF, 0xA7, 0x1A, 0xFF, 0xA7, 0x1F, 0x0A, 0xEA, 0x70, 0xF1, 0x9F, 0x79, 0xEA, 0x2F, 0x7F, 0x3F,
+    0x6A, 0xE9, 0x3F, 0x6E, 0xA4, 0xF5, 0xAE, 0x5A, 0xE5, 0xE9, 0x5A, 0xE9, 0x3F, 0x69, 0xE9, 0x29,
+    0xE7, 0x0E, 0x92, 0xE9, 0x70, 0xE9, 0x1A, 0xE7, 0x1E, 0xA1, 0xE7, 0x2E, 0xA0, 0xAD, 0xA7, 0x2A,
+    0xDA, 0x9E, 0x73, 0x9E, 0x77, 0x30, 0x77, 0x77, 0x9F, 0x97, 0x0A, 0xE9, 0x5A, 0xF9, 0x79, 0xF9,
+    0x5F, 0xCA, 0x7F, 0xC6, 0xFC, 0xA6, 0xAF, 0xC5, 0xAF, 0xD5, 0x9F, 0xCA, 0x5F, 0xE5, 0xFD, 0xA5,
+    0xDA, 0xF4, 0xAF, 0xD9, 0x4A, 0xD9, 0xF9, 0x29, 0xE9, 0xE5, 0xE0, 0xF9, 0x2E, 0xAA, 0xE5, 0xE0,
+    0xAE, 0xA1, 0xAE, 0x0F, 0x4A, 0xE0, 0x9E, 0xA0, 0x9E, 0x90, 0xEA, 0x4E, 0xA0, 0x9F, 0x0E, 0xA0,
+    0xAE, 0x94, 0xE9, 0x1F, 0xAE, 0x1F, 0x49, 0xE2, 0xFE, 0x91, 0xF4, 0xF2, 0xFE, 0x1A, 0xF4, 0xF2,
+    0xFD, 0x2F, 0xA3, 0x9E, 0xA2, 0xAF, 0xA2, 0xF9, 0x3F, 0x92, 0xAF, 0x2A, 0xF4, 0xF3, 0x9E, 0x3F,
+    0xC3, 0x9F, 0x72, 0x9F, 0xC3, 0xAE, 0xA7, 0x2A, 0xFA, 0x30, 0x77, 0x76, 0x99, 0x99, 0x70, 0xE7,
+    0xF7, 0x9D, 0xA6, 0x9F, 0x7E, 0x96, 0xFC, 0x96, 0xE7, 0xFC, 0x95, 0xAD, 0xA6, 0x9F, 0xCA, 0x5E,
+    0x96, 0xFE, 0x5E, 0x7E, 0x9E, 0x4A, 0xE6, 0xAE, 0x0E, 0x93, 0xE9, 0x6E, 0xA0, 0xEA, 0x29, 0xE7,
+    0xE9, 0x0A, 0xDA, 0x2A, 0xE6, 0xAE, 0x19, 0xE2, 0xE9, 0x6F, 0x19, 0xE1, 0x9E, 0x69, 0xEA, 0x2E,
+    0x90, 0xAE, 0x6A, 0xE9, 0x2E, 0xA0, 0xE9, 0x6F, 0x3A, 0xDA, 0x9E, 0x69, 0xF3, 0x9E, 0xAE, 0x6A,
+    0xEA, 0x4F, 0xDA, 0x6F, 0x94, 0xFD, 0x69, 0xF5, 0xFD, 0x6A, 0xF5, 0xAF, 0xA6, 0x59, 0xFF, 0xFA,
+    0x5A, 0xFF, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xFF, 0x72, 0xFF,
+    0xC7, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x3A, 0xFF,
+    0xFD, 0x93, 0xFF, 0xFE, 0x30, 0x71, 0x9A, 0xFC, 0xA7, 0x5A, 0xFF, 0xDA, 0x71, 0x9F, 0xC9, 0x99,
+    0xAF, 0xA7, 0x9F, 0x95, 0xF6, 0x9E, 0xA7, 0x9E, 0x95, 0xF7, 0x1E, 0xA4, 0xAE, 0x72, 0xEA, 0x4E,
+    0x97, 0x2A, 0xDA, 0x39, 0xE7, 0x3A, 0xD9, 0x3E, 0x97, 0x3E, 0x4E, 0x74, 0xE3, 0x9D, 0xA7, 0x39,
+    0xDA, 0x3A, 0xDA, 0x73, 0xE9, 0x3A, 0xDA, 0x72, 0xAE, 0x4A, 0xE9, 0x70, 0xF9, 0x4A, 0xFC, 0x99,
+    0x99, 0x9A, 0xFD, 0x59, 0xFF, 0xFF, 0x96, 0xFF, 0xFE, 0xA7, 0xAF, 0xFF, 0xCA, 0x71, 0xAF, 0xFE,
+    0x97, 0x4A, 0xFD, 0xA9, 0x77, 0x77, 0x10, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0xFF, 0xE5,
+    0xD9, 0x59, 0xCA, 0x5D, 0x6A, 0xC9, 0x49, 0xD6, 0xD5, 0xAC, 0xA6, 0xD5, 0xD6, 0xAC, 0xA5, 0xD6,
+    0xD9, 0x49, 0xCA, 0x6D, 0x5A, 0xC9, 0x59, 0xD5, 0xD6, 0xAC, 0xA4, 0x9D, 0x6D, 0x94, 0xAC, 0xA6,
+    0xD5, 0xD9, 0x59, 0xD5, 0xD6, 0xAC, 0xA4, 0x9D, 0x6D, 0x94, 0xAC, 0xA6, 0xD5, 0xD9, 0x59, 0xCA,
+    0x40, 0x6F, 0xFA, 0x71, 0xAF, 0xFD, 0x97, 0xE9, 0x99, 0x99, 0xF7, 0xDA, 0x59, 0xD9, 0x59, 0xD9,
+    0x6D, 0x95, 0xE6, 0xAD, 0x6D, 0xA6, 0xE5, 0x9D, 0x94, 0xAE, 0x95, 0xFF, 0xFA, 0x6F, 0xFE, 0xA6,
+    0x9F, 0xFA, 0x97, 0x0E, 0xA7, 0x7E, 0x97, 0x69, 0xE7, 0x7F, 0x77, 0xEA, 0x76, 0x9E, 0x97, 0x6A,
+    0xE9, 0x76, 0xF7, 0x69, 0xF7, 0x6A, 0xEA, 0x76, 0x49, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x49, 0xC9,
+    0x76, 0xD7, 0x7C, 0xA7, 0x69, 0xC9, 0x76, 0xAC, 0x77, 0xCA, 0x76, 0x9C, 0x76, 0xAC, 0x75, 0xD7,
+    0x49, 0xD7, 0x4A, 0xCA, 0x74, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xEA, 0xAA, 0xAA, 0xAA, 0x94, 0xAF,
+    0xFD, 0x94, 0xFF, 0xE7, 0x75, 0x09, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xFC, 0x1F, 0xDA, 0xEA, 0xAA,
+    0xFA, 0x70, 0xE7, 0x70, 0xDA, 0x77, 0xAD, 0x97, 0x7E, 0x97, 0x7E, 0x77, 0x9E, 0x77, 0xEA, 0x77,
+    0xE9, 0x76, 0x9E, 0x77, 0xAE, 0x77, 0xEA, 0x76, 0x9E, 0x97, 0x6A, 0xE7, 0x7F, 0x76, 0x9E, 0xA7,
+    0x6A, 0xE9, 0x76, 0xF7, 0x7F, 0x74, 0x0E, 0x71, 0xAD, 0x90, 0xE9, 0x79, 0xDA, 0x1A, 0xDA, 0x69,
+    0xE2, 0x9E, 0x6E, 0x39, 0xE5, 0xE9, 0x4E, 0x93, 0xEA, 0x5F, 0x2A, 0xE6, 0xAE, 0x19, 0xE7, 0x9E,
+    0x99, 0xE9, 0x70, 0xFE, 0xA7, 0x1F, 0xE7, 0x2F, 0xD7, 0x3A, 0xF9, 0x73, 0x9E, 0xA7, 0x4A, 0xE7,
+    0x5F, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x3A, 0xF7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0x77, 0x1A, 0x97,
+    0x77, 0x2A, 0xCA, 0x77, 0x72, 0xD9, 0x77, 0x72, 0xD7, 0x77, 0x29, 0xCA, 0x77, 0x79, 0xAF, 0xDA,
+    0xA9, 0x77, 0x9F, 0xFF, 0xD9, 0x73, 0x9F, 0xCA, 0xAC, 0xA1, 0x9F, 0xC9, 0x71, 0xAF, 0x91, 0xAC,
+    0x93, 0xAF, 0x70, 0xFA, 0x3D, 0x5F, 0x96, 0xFA, 0x39, 0xD5, 0xAE, 0x95, 0xAE, 0xA4, 0xAC, 0x95,
+    0xAE, 0x95, 0xF5, 0xD6, 0xAE, 0x5A, 0xE5, 0x9D, 0x6E, 0xA5, 0xEA, 0x5A, 0xC9, 0x59, 0xE9, 0x5E,
+    0x95, 0xD6, 0xF5, 0x9E, 0xA4, 0x9D, 0x5F, 0x95, 0xAF, 0x93, 0xAC, 0xA3, 0xAF, 0xA6, 0x9F, 0xDA,
+    0xAA, 0xDA, 0xAA, 0xFE, 0x70, 0xFF, 0xFF, 0xF7, 0x1A, 0xFF, 0xFF, 0xCA, 0x73, 0x9F, 0xFF, 0xDA,
+    0x77, 0x9A, 0xFF, 0xA9, 0x77, 0x59, 0xCA, 0x77, 0x72, 0xAC, 0x97, 0x77, 0x29, 0x97, 0x71, 0x77,
+    0x76, 0xE7, 0x19, 0xD9, 0x6A, 0xD9, 0x79, 0xD9, 0x70, 0xE6, 0x9D, 0xA7, 0x1E, 0x94, 0x9D, 0xA7,
+    0x2A, 0xDA, 0x39, 0xDA, 0x74, 0xE2, 0x9E, 0x75, 0xEA, 0x09, 0xE7, 0x69, 0xEA, 0xE7, 0x70, 0xFD,
+    0x77, 0x1F, 0xC9, 0x77, 0x1A, 0xEA, 0x77, 0x19, 0xFC, 0x77, 0x09, 0xFD, 0x77, 0x9F, 0xEA, 0x75,
+    0x9E, 0xA0, 0xF7, 0x49, 0xF1, 0xAE, 0xA7, 0x29, 0xF2, 0x9F, 0x71, 0x9F, 0x4F, 0x97, 0x9F, 0x5A,
+    0xF6, 0x9F, 0x95, 0x9F, 0x94, 0x9F, 0x97, 0xFC, 0x40, 0x77, 0x6D, 0x93, 0xAC, 0x4D, 0x92, 0xD4,
+    0xD4, 0xD2, 0x9C, 0xA3, 0x9C, 0x93, 0x9C, 0xA2, 0xAC, 0x93, 0xAC, 0x4D, 0x92, 0xD9, 0x3D, 0x39,
+    0xD3, 0xD9, 0x3C, 0xA3, 0xDA, 0x3D, 0x92, 0x9C, 0x92, 0xAD, 0x4E, 0x2D, 0x2A, 0xDA, 0x4E, 0xA1,
+    0xCA, 0x1F, 0x59, 0xFA, 0xFE, 0x7F, 0xFE, 0x71, 0x9F, 0xDA, 0x97, 0x49, 0xCA, 0x77, 0x0A, 0xC7,
+    0x71, 0xD7, 0x71, 0xCA, 0x77, 0x09, 0xC9, 0x77, 0x0D, 0x77, 0x1C, 0xA7, 0x70, 0x9C, 0x97, 0x70,
+    0xAC, 0x75, 0x72, 0x9A, 0xAA, 0xA9, 0x75, 0xAF, 0xF7, 0x29, 0xE9, 0x29, 0xE7, 0x0A, 0xDA, 0x6D,
+    0xA6, 0x9D, 0xA7, 0xAD, 0x6E, 0x70, 0x9D, 0x94, 0xAD, 0x72, 0xD9, 0x4D, 0xA7, 0x19, 0xD9, 0x39,
+    0xD7, 0x29, 0xD4, 0xE7, 0x2A, 0xD4, 0xDA, 0x72, 0xDA, 0x4D, 0x97, 0x19, 0xD9, 0x39, 0xD9, 0x71,
+    0xE5, 0xD9, 0x70, 0xE9, 0x5D, 0xA7, 0xEA, 0x7D, 0x5A, 0xE9, 0x59, 0xAF, 0xA2, 0xAE, 0xAA, 0x93,
+    0x9F, 0xD9, 0x2F, 0xE3, 0xAF, 0xD2, 0x9F, 0xE7, 0x77, 0x10, 0x77, 0x72, 0xAE, 0xA0, 0xAC, 0x71,
+    0x9F, 0xFC, 0x70, 0x9D, 0xA2, 0xAE, 0x70, 0xD9, 0x4D, 0xA7, 0xD9, 0x5D, 0xA6, 0x9D, 0x6D, 0x96,
+    0xD6, 0x9D, 0x7D, 0x6E, 0x69, 0xCA, 0x5A, 0xE6, 0xAD, 0x4F, 0xA6, 0xAF, 0xFE, 0xA6, 0x9F, 0xFE,
+    0x9A, 0xA5, 0xFF, 0x9D, 0xAD, 0xAD, 0x3A, 0xFA, 0x09, 0xDA, 0xFA, 0x76, 0x99, 0x30, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x29, 0xAD, 0xA9, 0x72, 0xAF, 0xDA, 0x70, 0xAD, 0xA9, 0x9A, 0xD9, 0x6A,
+    0xD9, 0x39, 0xD6, 0xD9, 0x5A, 0xC5, 0x9D, 0x6D, 0x5A, 0xD5, 0x9C, 0xA5, 0xDA, 0x4A, 0xD6, 0xD9,
+    0x1F, 0x96, 0x9D, 0x19, 0xFA, 0x6D, 0xA5, 0xE5, 0xD9, 0x6D, 0x93, 0x9D, 0x7D, 0xA3, 0xAD, 0x69,
+    0xDA, 0x3F, 0x94, 0xE9, 0x3F, 0xD9, 0x09, 0xF3, 0x9F, 0xFF, 0xA3, 0xAD, 0xAF, 0xFC, 0x4D, 0xA1,
+    0xAF, 0xD9, 0x4D, 0x93, 0xAD, 0xA5, 0x9D, 0x76, 0xAD, 0x76, 0xDA, 0x76, 0xD9, 0x77, 0x77, 0x0D,
+    0x6A, 0xCA, 0x0D, 0x95, 0xDA, 0x0D, 0xA5, 0xDA, 0x0A, 0xD5, 0xD9, 0x0A, 0xD4, 0xAD, 0x19, 0xD9,
+    0x3D, 0xA2, 0xDA, 0x29, 0xD3, 0xE2, 0xE3, 0xE1, 0xAD, 0x93, 0xAD, 0x9A, 0xDA, 0x4A, 0xFD, 0x5A,
+    0xFC, 0x95, 0xAF, 0xA6, 0xAF, 0x7F, 0x70, 0xEA, 0x70, 0xE9, 0x79, 0xE9, 0x79, 0xE7, 0x0A, 0xE7,
+    0x0A, 0xDA, 0x77, 0x40, 0x69, 0xAF, 0xCA, 0xA9, 0x5F, 0xFD, 0xA4, 0x9D, 0x93, 0x9A, 0xA9, 0x4A,
+    0xD7, 0x59, 0xD9, 0x75, 0xAD, 0x97, 0x5E, 0x97, 0x5A, 0xDA, 0x75, 0x9D, 0xA7, 0x1A, 0xAF, 0xC9,
+    0x69, 0xFF, 0xC5, 0xAE, 0xA2, 0xAD, 0x93, 0x9E, 0x94, 0xE3, 0xE9, 0x5E, 0x29, 0xE6, 0xE2, 0x9D,
+    0xA5, 0x9D, 0xA2, 0x9E, 0x49, 0xE3, 0x9E, 0xA9, 0x99, 0xAE, 0xA4, 0xFF, 0xDA, 0x59, 0xFF, 0x97,
+    0x0A, 0xEA, 0x96, 0x4A, 0xE9, 0x39, 0xCA, 0x90, 0x9C, 0x3C, 0x93, 0xC2, 0x9C, 0x71, 0xC9, 0x70,
+    0x9E, 0x5A, 0xD9, 0x94, 0xAC, 0xA7, 0xD3, 0xD2, 0xD3, 0xD2, 0xDA, 0x99, 0xDA, 0x2A, 0xFD, 0x4A,
+    0xE9, 0x30, 0x5F, 0xFC, 0x6A, 0xAA, 0xAF, 0xA7, 0x1E, 0x97, 0x19, 0xDA, 0x72, 0xAD, 0x73, 0xE7,
+    0x3E, 0x73, 0xAD, 0x74, 0xD9, 0x73, 0xAD, 0x74, 0xD9, 0x74, 0xDA, 0x74, 0x9E, 0xA7, 0x39, 0xFD,
+    0x72, 0xAF, 0x97, 0x3A, 0xD9, 0x73, 0xE7, 0x3A, 0xDA, 0x72, 0xAE, 0x72, 0xF7, 0x2A, 0xE7, 0x00,
+    0x77, 0x2E, 0x74, 0xAE, 0x19, 0xAC, 0xA9, 0x59, 0xDA, 0xFD, 0x94, 0xAE, 0x92, 0xAD, 0x4E, 0x5D,
+    0x39, 0xD6, 0xD3, 0xAD, 0x6D, 0x3D, 0x95, 0xAC, 0xA2, 0x9D, 0x6D, 0x92, 0xAD, 0x6D, 0x92, 0xE5,
+    0x9D, 0x29, 0xDA, 0x5E, 0x2A, 0xD9, 0x5D, 0xA2, 0xE9, 0x49, 0xD9, 0x19, 0xE5, 0xE7, 0x4E, 0x73,
+    0x9D, 0xA7, 0x3A, 0xD9, 0x73, 0xE7, 0x39, 0xE7, 0x3A, 0xDA, 0x77, 0x30, 0x79, 0xAE, 0x97, 0x1D,
+    0x91, 0x9C, 0xA7, 0xD9, 0x3A, 0xC6, 0xD9, 0x49, 0xC9, 0x49, 0xD5, 0x9C, 0xA4, 0xD9, 0x59, 0xCA,
+    0x39, 0xD6, 0xAC, 0xA3, 0xDA, 0x6A, 0xC9, 0x3F, 0xFF, 0x92, 0x9F, 0xFF, 0x3A, 0xD6, 0xE3, 0xE5,
+    0x9D, 0xA3, 0xE5, 0xE4, 0xE9, 0x3E, 0xA4, 0xFA, 0xAA, 0xF5, 0xFF, 0xDA, 0x5A, 0xFF, 0xA7, 0xFE,
+    0xA7, 0x1A, 0xEA, 0x70, 0x74, 0xD5, 0xD4, 0x9C, 0xA4, 0xAC, 0x94, 0xD4, 0x9C, 0xA4, 0xAC, 0x94,
+    0xD9, 0x39, 0xD4, 0xAD, 0x4D, 0xA3, 0x9D, 0xA3, 0xAD, 0x93, 0xE9, 0x91, 0xAF, 0xC1, 0xAF, 0xA1,
+    0x49, 0xA3, 0xAA, 0x5D, 0x2D, 0x94, 0x9C, 0xA1, 0xD9, 0x5D, 0x90, 0xDA, 0x6D, 0x0A, 0xCA, 0x69,
+    0xCA, 0xAD, 0x7F, 0xC7, 0x0F, 0x70, 0xAE, 0xA7, 0x0F, 0xC9, 0x7D, 0xAE, 0x6A, 0xD0, 0xF5, 0xD9,
+    0x09, 0xEA, 0x39, 0xD2, 0xF3, 0xAD, 0x29, 0xF2, 0x77, 0x3F, 0xA9, 0x74, 0xAF, 0xD7, 0x39, 0xFE,
+    0x97, 0x49, 0xAF, 0x77, 0xF7, 0x7E, 0xA7, 0x6A, 0xE7, 0x6A, 0xEA, 0x75, 0xAF, 0x75, 0xFC, 0xA7,
+    0x4F, 0xD7, 0x39, 0xE9, 0xDA, 0x72, 0xAD, 0x90, 0xE7, 0x2E, 0x19, 0xDA, 0x71, 0xE2, 0xAD, 0x70,
+    0x9D, 0x93, 0xDA, 0x7A, 0xD4, 0xAD, 0x7E, 0x5D, 0xA6, 0xD9, 0x59, 0xD5, 0x9D, 0x7D, 0xA0, 0x5D,
+    0x6D, 0xA4, 0x9D, 0x6D, 0x94, 0xAD, 0x5A, 0xD5, 0xDA, 0x5E, 0x5D, 0x95, 0xDA, 0x4A, 0xD5, 0x9D,
+    0x94, 0xE5, 0xAD, 0x49, 0xE5, 0xE4, 0xEA, 0x4A, 0xDA, 0x4F, 0x3A, 0xEA, 0x3A, 0xFF, 0xF9, 0x3F,
+    0xFF, 0xC3, 0x9C, 0x9F, 0xFE, 0x3A, 0xC0, 0x9F, 0xD9, 0xDA, 0x3C, 0xA2, 0x99, 0x97, 0x09, 0xC9,
+    0x76, 0x9A, 0x77, 0x0D, 0x6A, 0xCA, 0x0D, 0x95, 0xE0, 0xDA, 0x5D, 0xA0, 0xAD, 0x5D, 0x90, 0xAD,
+    0x4A, 0xD1, 0x9D, 0x93, 0xDA, 0x2D, 0xA2, 0x9D, 0x92, 0xE2, 0xE3, 0xE1, 0xAD, 0x93, 0xAD, 0x9A,
+    0xDA, 0x4A, 0xFD, 0x5A, 0xFC, 0x95, 0xAF, 0xC6, 0xAF, 0x50, 0x29, 0xFF, 0xA2, 0x9A, 0xAA, 0xFC,
+    0x95, 0xAD, 0xA7, 0xDA, 0x70, 0xAC, 0x97, 0x1C, 0xA7, 0x2D, 0x72, 0xEA, 0x99, 0x69, 0xFA, 0x6D,
+    0xA7, 0x0D, 0x71, 0x9C, 0xA7, 0x1A, 0xD9, 0x70, 0x9F, 0xC9, 0x69, 0xAF, 0x72, 0xD9, 0x71, 0xD9,
+    0x70, 0xE7, 0x0E, 0x96, 0x9E, 0xA7, 0xAA, 0xA9, 0x50, 0x6A, 0xAE, 0xA7, 0x09, 0xFF, 0x6A, 0xE9,
+    0x99, 0x9E, 0x49, 0xD9, 0x49, 0xD4, 0xDA, 0x6D, 0x92, 0x9D, 0x7D, 0x92, 0xDA, 0x69, 0xD3, 0xD9,
+    0x6E, 0x29, 0xD6, 0x9D, 0x92, 0x9D, 0xA4, 0x9E, 0x4F, 0xCA, 0xFC, 0x94, 0xFF, 0xD9, 0x6F, 0xF9,
+    0x70, 0xAE, 0xA9, 0x60, 0x1A, 0xFF, 0xFC, 0x2F, 0xFF, 0xD4, 0xAC, 0xA2, 0x9D, 0x7D, 0x92, 0xAC,
+    0xA6, 0x9D, 0x3D, 0x7A, 0xCA, 0x29, 0xD7, 0xD3, 0xD9, 0x69, 0xD3, 0xD7, 0xDA, 0x2A, 0xCA, 0x7D,
+    0x3D, 0x96, 0x9D, 0x29, 0xD7, 0xDA, 0x2A, 0xF5, 0xD3, 0x9F, 0x77, 0x50, 0x73, 0xAA, 0xCA, 0x75,
+    0xAF, 0xD7, 0x3E, 0xAA, 0x9E, 0x71, 0xE9, 0x3D, 0x70, 0xAD, 0x94, 0xD9, 0x69, 0xDA, 0x5D, 0x96,
+    0xE9, 0x5D, 0x7E, 0x5A, 0xD6, 0xAE, 0x5D, 0xA6, 0xF4, 0xAD, 0x6A, 0xFC, 0xA9, 0xAE, 0xA6, 0xFF,
+    0xF6, 0x9D, 0xAA, 0xFE, 0x7E, 0x1A, 0xFA, 0x79, 0xE7, 0x7E, 0x97, 0x7E, 0x77, 0xAD, 0x97, 0x7E,
+    0x77, 0x77, 0x30, 0x77, 0x9A, 0xEA, 0x4E, 0xAA, 0xAD, 0x2A, 0xCA, 0x39, 0xC9, 0x1D, 0x70, 0xAC,
+    0x97, 0x0D, 0x71, 0xD7, 0x1D, 0x71, 0xAC, 0xA7, 0x1D, 0xA7, 0x09, 0xDA, 0x70, 0xDA, 0x79, 0xD9,
+    0x7A, 0xD7, 0x0E, 0x71, 0xAA, 0x60, 0x6A, 0xAF, 0xFF, 0xCA, 0x49, 0xFF, 0xFE, 0xA4, 0xAE, 0x99,
+    0x99, 0xE7, 0x29, 0xD9, 0x49, 0xD7, 0x2D, 0xA6, 0xD9, 0x70, 0x9D, 0x7D, 0x97, 0x0D, 0xA6, 0x9D,
+    0x71, 0xD9, 0x6E, 0x70, 0x9D, 0x69, 0xD9, 0x70, 0x9D, 0xA4, 0x9E, 0x72, 0xFC, 0xAF, 0xC9, 0x72,
+    0xFF, 0xD9, 0x74, 0xFF, 0x97, 0x6A, 0xEA, 0x97, 0x40, 0x0A, 0xFF, 0xEA, 0x0F, 0xFF, 0x95, 0xD9,
+    0x72, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xDA, 0x72, 0xD7, 0x2A, 0xD7, 0x2D, 0xA7,
+    0x19, 0xF9, 0x70, 0xF9, 0x77, 0x30, 0x75, 0x9C, 0x93, 0xAC, 0x2A, 0xC4, 0x9C, 0x91, 0xD5, 0xCA,
+    0x1D, 0x5C, 0xA0, 0x9C, 0xA4, 0x9C, 0xA0, 0x9C, 0x94, 0x9C, 0x90, 0xAC, 0x94, 0xAC, 0x90, 0xD5,
+    0xD1, 0xD4, 0x9D, 0x1D, 0x92, 0x9D, 0xA0, 0x9F, 0xFC, 0x2F, 0xFA, 0x2F, 0xEA, 0x4A, 0xEA, 0x93,
+    0x75, 0x97, 0x75, 0x9C, 0x97, 0x74, 0xAC, 0x77, 0x5D, 0x77, 0x5C, 0xA7, 0x75, 0xCA, 0x77, 0x29,
+    0xAF, 0xCA, 0x75, 0xAF, 0xFD, 0xA7, 0x19, 0xFE, 0x9A, 0xFA, 0x79, 0xF9, 0x0C, 0xA2, 0xF6, 0x9F,
+    0x19, 0xC9, 0x29, 0xE9, 0x5F, 0x2A, 0xC4, 0xEA, 0x4A, 0xE3, 0xD4, 0xEA, 0x4E, 0x93, 0xD4, 0xAD,
+    0xA3, 0x9E, 0x4C, 0xA4, 0xAD, 0x93, 0xE9, 0x39, 0xC9, 0x4E, 0x4E, 0x4A, 0xC5, 0xE3, 0x9D, 0xA4,
+    0xD4, 0x9D, 0xA3, 0x9D, 0xA4, 0xCA, 0x4E, 0x93, 0xAD, 0xA3, 0x9C, 0x93, 0xAE, 0x4A, 0xE3, 0xAC,
+    0x3A, 0xE9, 0x4A, 0xFA, 0x90, 0xD0, 0x9A, 0xFC, 0x5A, 0xFF, 0xFF, 0x96, 0xFF, 0xFE, 0xA7, 0xAF,
+    0xFF, 0xCA, 0x71, 0xAF, 0xFE, 0x97, 0x4A, 0xFD, 0xA9, 0x77, 0x1C, 0xA7, 0x74, 0x9C, 0x97, 0x74,
+    0x9A, 0x76, 0x5C, 0xA9, 0x70, 0xAA, 0x6F, 0x95, 0xAC, 0xA5, 0x9F, 0xC4, 0xAD, 0x70, 0x9F, 0x2A,
+    0xD7, 0x3E, 0x1A, 0xD7, 0x49, 0xD9, 0x9D, 0x97, 0x5F, 0xC9, 0x76, 0xFA, 0x77, 0xEA, 0x77, 0x9E,
+    0x97, 0x69, 0xF9, 0x76, 0xFC, 0xA7, 0x5E, 0x9E, 0x74, 0xE9, 0x0E, 0x73, 0xEA, 0x1A, 0xD9, 0x71,
+    0xEA, 0x2A, 0xEA, 0x99, 0x5F, 0x39, 0xFD, 0x4F, 0x5F, 0xCA, 0x3F, 0x7A, 0xEA, 0x20, 0x69, 0xC7,
+    0x3A, 0xC7, 0x3D, 0x73, 0xCA, 0x69, 0xC9, 0x1C, 0xA1, 0x9A, 0x2A, 0xC9, 0x09, 0xC9, 0x19, 0xC9,
+    0x1D, 0x1A, 0xC2, 0x9C, 0x91, 0xD1, 0xD2, 0x9C, 0x91, 0xCA, 0x1D, 0x29, 0xC9, 0x09, 0xCA, 0x1C,
+    0xA2, 0xAC, 0x90, 0xAC, 0x90, 0x9C, 0x92, 0xD1, 0xD9, 0x0A, 0xC3, 0xD1, 0xD9, 0x0A, 0xC2, 0xAC,
+    0xA1, 0xDA, 0x0D, 0x1A, 0xD9, 0x1F, 0xFE, 0x2F, 0xFD, 0x92, 0xAF, 0xF9, 0x49, 0xFC, 0xA7, 0x0D,
+    0x73, 0xCA, 0x73, 0xCA, 0x72, 0x9C, 0x97, 0x2A, 0xC7, 0x39, 0xA7, 0x00, 0x49, 0x97, 0x95, 0xAD,
+    0x69, 0xD3, 0xAD, 0x70, 0xD2, 0x9D, 0x97, 0x0D, 0x2D, 0xA7, 0x1D, 0x1A, 0xD3, 0x99, 0x4D, 0x1D,
+    0xA3, 0xC9, 0x39, 0xD0, 0x9D, 0x39, 0xC4, 0xD9, 0x09, 0xD3, 0xAC, 0x39, 0xD1, 0x9D, 0x3D, 0x29,
+    0xDA, 0x19, 0xDA, 0x99, 0xFA, 0xF3, 0xFD, 0x9F, 0xD5, 0xAD, 0xA1, 0xAE, 0x97, 0x76, 0x74, 0x9D,
+    0xA7, 0x7F, 0x76, 0xAF, 0x75, 0x9F, 0xC7, 0x5D, 0xAA, 0xD7, 0x4A, 0xD0, 0xAD, 0x73, 0x9D, 0x90,
+    0x9D, 0x97, 0x2D, 0xA1, 0x9D, 0x97, 0x1A, 0xD2, 0x9D, 0xA7, 0x09, 0xD9, 0x3D, 0xA7, 0x0E, 0x4E,
+    0x7A, 0xD5, 0xE6, 0x9D, 0xA5, 0xE6, 0xE6, 0xE5, 0xAF, 0xFF, 0xC9, 0x39, 0xFF, 0xFD, 0x93, 0xFF,
+    0xFE, 0x92, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA1, 0x9E, 0x71, 0xEA, 0x1E, 0xA7, 0x1F, 0x0A,
+    0xE7, 0x2F, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0xDA, 0x77, 0xE9, 0x77, 0xE9, 0x76, 0xAE, 0x72,
+    0x77, 0x6A, 0xEA, 0x0A, 0xC5, 0x9F, 0xFC, 0x49, 0xDA, 0x2A, 0xE4, 0xD9, 0x4D, 0xA3, 0xD9, 0x5D,
+    0xA2, 0x9D, 0x6D, 0x92, 0xD6, 0x9D, 0x3D, 0x6E, 0x29, 0xCA, 0x5A, 0xE2, 0xAD, 0x4F, 0xA2, 0xAF,
+    0xFE, 0xA2, 0x9F, 0xFE, 0x93, 0xFF, 0x9D, 0x5A, 0xFA, 0x09, 0xD7, 0x77, 0x75, 0x9D, 0x97, 0x3E,
+    0x97, 0x29, 0xE7, 0x3F, 0x77, 0x71, 0x76, 0x9E, 0xA7, 0x7A, 0x91, 0xCA, 0x77, 0x1A, 0xC9, 0x77,
+    0x0D, 0x97, 0x70, 0xAC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9D, 0xA7, 0x70,
+    0xF7, 0x7A, 0xF7, 0x69, 0xFC, 0x76, 0xDA, 0xAD, 0x75, 0xAD, 0x0A, 0xD7, 0x49, 0xD9, 0x09, 0xD9,
+    0x73, 0xDA, 0x19, 0xD9, 0x72, 0xAD, 0x29, 0xDA, 0x71, 0x9D, 0x93, 0xDA, 0x71, 0xE4, 0xE7, 0x0A,
+    0xD5, 0xE7, 0x9D, 0xA5, 0xE7, 0xE6, 0xE6, 0xAF, 0xFF, 0xC9, 0x49, 0xFF, 0xFD, 0x94, 0xFF, 0xFE,
+    0x93, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA2, 0x9E, 0x71, 0xEA, 0x2E, 0xA7, 0x1F, 0x1A, 0xE7,
+    0x2F, 0x10, 0x71, 0xAD, 0xA7, 0x29, 0x91, 0xC9, 0x74, 0xD7, 0x4D, 0x74, 0x9A, 0x77, 0x77, 0x77,
+    0x72, 0xAE, 0xA0, 0xAC, 0x59, 0xFF, 0xC4, 0x9E, 0x90, 0x9F, 0x4D, 0x94, 0xDA, 0x3D, 0x95, 0xDA,
+    0x29, 0xD6, 0xD9, 0x2D, 0x95, 0x9D, 0x3D, 0x6E, 0x29, 0xCA, 0x5A, 0xE2, 0xAD, 0x4F, 0xA2, 0xAF,
+    0xFE, 0xA2, 0x9F, 0xFE, 0x93, 0xFF, 0x9D, 0x5A, 0xFA, 0x09, 0xD2, 0x77, 0x6D, 0x77, 0x6A, 0xC9,
+    0x77, 0x59, 0xCA, 0x77, 0x6D, 0x77, 0x6D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6C, 0xA7, 0x76,
+    0xAD, 0xA7, 0x74, 0x9D, 0xAC, 0xA7, 0x73, 0xD2, 0xAC, 0x77, 0x1A, 0xA4, 0x9C, 0x97, 0x77, 0x77,
+    0x39, 0xDA, 0x77, 0x5F, 0x77, 0x4A, 0xF7, 0x73, 0x9F, 0xC7, 0x73, 0xDA, 0xAD, 0x77, 0x2A, 0xD0,
+    0xAD, 0x77, 0x19, 0xD9, 0x09, 0xD9, 0x77, 0x0D, 0xA1, 0x9D, 0x97, 0x7A, 0xD2, 0x9D, 0xA7, 0x69,
+    0xD9, 0x3D, 0xA7, 0x6E, 0x4E, 0x75, 0xAD, 0x5E, 0x74, 0x9D, 0xA5, 0xE7, 0x4E, 0x6E, 0x73, 0xAF,
+    0xFF, 0xC9, 0x71, 0x9F, 0xFF, 0xD9, 0x71, 0xFF, 0xFE, 0x97, 0x0A, 0xE9, 0x99, 0x99, 0x99, 0x99,
+    0xEA, 0x79, 0xE7, 0x1E, 0xA7, 0xEA, 0x71, 0xF6, 0xAE, 0x72, 0xF6, 0x77, 0x5A, 0xC7, 0x75, 0x9C,
+    0x97, 0x75, 0xD7, 0x75, 0xD7, 0x75, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0xCA, 0x77, 0x5A,
+    0xDA, 0x77, 0x39, 0xDA, 0xCA, 0x77, 0x2D, 0x2D, 0x77, 0x0A, 0xA4, 0x9C, 0x77, 0x77, 0x70, 0xAE,
+    0xA0, 0xAC, 0x76, 0x9F, 0xFC, 0x75, 0x9D, 0xA2, 0xAE, 0x75, 0xD9, 0x4D, 0xA7, 0x4D, 0x95, 0xDA,
+    0x73, 0x9D, 0x6D, 0x97, 0x3D, 0x69, 0xD7, 0x4D, 0x6E, 0x73, 0x9C, 0xA5, 0xAE, 0x73, 0xAD, 0x4F,
+    0xA7, 0x3A, 0xFF, 0xEA, 0x73, 0x9F, 0xFE, 0x97, 0x4F, 0xF9, 0xD7, 0x6A, 0xFA, 0x09, 0xD7, 0x30,
+    0x77, 0x77, 0x1D, 0xA7, 0x72, 0xE7, 0x71, 0x9E, 0x77, 0x29, 0x99, 0x77, 0xCA, 0x77, 0x1A, 0xDA,
+    0x77, 0x9D, 0xAC, 0xA7, 0x6D, 0x2A, 0xC7, 0x4A, 0xA4, 0x9C, 0x97, 0x77, 0x71, 0x9D, 0xA7, 0x70,
+    0xF7, 0x7A, 0xF7, 0x69, 0xFC, 0x76, 0xDA, 0xAD, 0x75, 0xAD, 0x0A, 0xD7, 0x49, 0xD9, 0x09, 0xD9,
+    0x73, 0xDA, 0x19, 0xD9, 0x72, 0xAD, 0x29, 0xDA, 0x71, 0x9D, 0x93, 0xDA, 0x71, 0xE4, 0xE7, 0x0A,
+    0xD5, 0xE7, 0x9D, 0xA5, 0xE7, 0xE6, 0xE6, 0xAF, 0xFF, 0xC9, 0x49, 0xFF, 0xFD, 0x94, 0xFF, 0xFE,
+    0x93, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA2, 0x9E, 0x71, 0xEA, 0x2E, 0xA7, 0x1F, 0x1A, 0xE7,
+    0x2F, 0x10, 0x5D, 0xA7, 0x6D, 0xA7, 0x59, 0xDA, 0x75, 0x9A, 0xCA, 0x75, 0x9D, 0x75, 0xF7, 0x3A,
+    0xCA, 0x9D, 0x97, 0x09, 0xCA, 0x2A, 0xC9, 0x7A, 0x95, 0xA7, 0x77, 0x0A, 0xF0, 0xAC, 0x69, 0xFF,
+    0xC5, 0x9D, 0xA2, 0xAE, 0x5D, 0x94, 0xDA, 0x4D, 0x95, 0xDA, 0x39, 0xD6, 0xD9, 0x3D, 0x69, 0xD4,
+    0xD6, 0xE3, 0x9C, 0xA5, 0xAE, 0x3A, 0xD4, 0xFA, 0x3A, 0xFF, 0xEA, 0x39, 0xFF, 0xE9, 0x4F, 0xF9,
+    0xD6, 0xAF, 0xA0, 0x9D, 0x30, 0x77, 0x3A, 0xE7, 0x74, 0x91, 0xAA, 0x77, 0x5A, 0xC9, 0x77, 0x4D,
+    0x77, 0x6A, 0x77, 0x77, 0x77, 0x77, 0x2C, 0xA7, 0x75, 0xAD, 0xA7, 0x73, 0x9D, 0xAC, 0xA7, 0x72,
+    0xD2, 0xAC, 0x77, 0x0A, 0xA4, 0x9C, 0x97, 0x77, 0x77, 0x19, 0xDA, 0x77, 0x4F, 0x77, 0x3A, 0xF7,
+    0x72, 0x9F, 0xC7, 0x72, 0xDA, 0xAD, 0x77, 0x1A, 0xD0, 0xAD, 0x77, 0x09, 0xD9, 0x09, 0xD9, 0x77,
+    0xDA, 0x19, 0xD9, 0x76, 0xAD, 0x29, 0xDA, 0x75, 0x9D, 0x93, 0xDA, 0x75, 0xE4, 0xE7, 0x4A, 0xD5,
+    0xE7, 0x39, 0xDA, 0x5E, 0x73, 0xE6, 0xE7, 0x2A, 0xFF, 0xFC, 0x97, 0x09, 0xFF, 0xFD, 0x97, 0x0F,
+    0xFF, 0xE9, 0x7A, 0xE9, 0x99, 0x99, 0x99, 0x99, 0xEA, 0x69, 0xE7, 0x1E, 0xA6, 0xEA, 0x71, 0xF5,
+    0xAE, 0x72, 0xF5, 0x73, 0xAD, 0xA7, 0x7C, 0x97, 0x49, 0xCA, 0x74, 0x9C, 0x72, 0xC9, 0x75, 0xAD,
+    0x97, 0x39, 0xFA, 0x72, 0xD1, 0x9D, 0x70, 0xCA, 0x49, 0xC7, 0x77, 0x77, 0x3A, 0xEA, 0x0A, 0xC6,
+    0x9F, 0xFC, 0x59, 0xDA, 0x2A, 0xE5, 0xD9, 0x4D, 0xA4, 0xD9, 0x5D, 0xA3, 0x9D, 0x6D, 0x93, 0xD6,
+    0x9D, 0x4D, 0x6E, 0x39, 0xCA, 0x5A, 0xE3, 0xAD, 0x4F, 0xA3, 0xAF, 0xFE, 0xA3, 0x9F, 0xFE, 0x94,
+    0xFF, 0x9D, 0x6A, 0xFA, 0x09, 0xD3, 0x77, 0x77, 0x0E, 0x29, 0xC7, 0x3A, 0xC0, 0xAC, 0x1C, 0xA7,
+    0x3C, 0x91, 0xCA, 0xAC, 0x73, 0x9C, 0x29, 0xD9, 0x77, 0x77, 0x77, 0x70, 0xCA, 0x77, 0x1A, 0xD9,
+    0x77, 0x0D, 0xAC, 0xA7, 0x6D, 0x19, 0xD7, 0x4A, 0xC4, 0x9C, 0x97, 0x77, 0x77, 0x77, 0x9D, 0xA7,
+    0x70, 0xF7, 0x7A, 0xF7, 0x69, 0xFC, 0x76, 0xDA, 0xAD, 0x75, 0xAD, 0x0A, 0xD7, 0x49, 0xD9, 0x09,
+    0xD9, 0x73, 0xDA, 0x19, 0xD9, 0x72, 0xAD, 0x29, 0xDA, 0x71, 0x9D, 0x93, 0xDA, 0x71, 0xE4, 0xE7,
+    0x0A, 0xD5, 0xE7, 0x9D, 0xA5, 0xE7, 0xE6, 0xE6, 0xAF, 0xFF, 0xC9, 0x49, 0xFF, 0xFD, 0x94, 0xFF,
+    0xFE, 0x93, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA2, 0x9E, 0x71, 0xEA, 0x2E, 0xA7, 0x1F, 0x1A,
+    0xE7, 0x2F, 0x10, 0x59, 0xD9, 0x2C, 0x96, 0xCA, 0xAC, 0x19, 0xC6, 0xAC, 0x1C, 0xA0, 0xCA, 0x6C,
+    0xA1, 0x9E, 0x79, 0x49, 0x77, 0x72, 0xAC, 0x75, 0xE7, 0x3D, 0xAD, 0x71, 0xAC, 0x91, 0xAC, 0x96,
+    0x9C, 0x94, 0xCA, 0x77, 0x70, 0xAE, 0xA0, 0xAC, 0x59, 0xFF, 0xC4, 0x9D, 0xA2, 0xAE, 0x4D, 0x94,
+    0xDA, 0x3D, 0x95, 0xDA, 0x29, 0xD6, 0xD9, 0x2D, 0x69, 0xD3, 0xD6, 0xE2, 0x9C, 0xA5, 0xAE, 0x2A,
+    0xD4, 0xFA, 0x2A, 0xFF, 0xEA, 0x29, 0xFF, 0xE9, 0x3F, 0xF9, 0xD5, 0xAF, 0xA0, 0x9D, 0x20, 0x75,
+    0xCA, 0x77, 0x1A, 0xDA, 0x77, 0x9D, 0xAC, 0xA7, 0x6D, 0x2A, 0xC7, 0x4A, 0xA4, 0x9C, 0x97, 0x77,
+    0x71, 0x9D, 0xA7, 0x70, 0xF7, 0x7A, 0xF7, 0x69, 0xFC, 0x76, 0xDA, 0xAD, 0x75, 0xAD, 0x0A, 0xD7,
+    0x49, 0xD9, 0x09, 0xD9, 0x73, 0xDA, 0x19, 0xD9, 0x72, 0xAD, 0x29, 0xDA, 0x71, 0x9D, 0x93, 0xDA,
+    0x71, 0xE4, 0xE7, 0x0A, 0xD5, 0xE7, 0x9D, 0xA5, 0xE7, 0xE6, 0xE6, 0xAF, 0xFF, 0xC9, 0x49, 0xFF,
+    0xFD, 0x94, 0xFF, 0xFE, 0x93, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA2, 0x9E, 0x71, 0xEA, 0x2E,
+    0xA7, 0x1F, 0x1A, 0xE7, 0x2F, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9D, 0xA7, 0x70, 0xE9, 0x77,
+    0x0E, 0x97, 0x7A, 0xE7, 0x30, 0x7D, 0x74, 0x9E, 0x73, 0xDA, 0xD7, 0x1A, 0xC9, 0x1A, 0xC9, 0x69,
+    0xC5, 0xAA, 0x7A, 0xEA, 0x0A, 0xC5, 0x9F, 0xFC, 0x49, 0xDA, 0x2A, 0xE4, 0xD9, 0x4D, 0xA3, 0xD9,
+    0x5D, 0xA2, 0x9D, 0x6D, 0x92, 0xD6, 0x9D, 0x3D, 0x6E, 0x29, 0xCA, 0x5A, 0xE2, 0xAD, 0x4F, 0xA2,
+    0xAF, 0xFE, 0xA2, 0x9F, 0xFE, 0x93, 0xFF, 0x9D, 0x5A, 0xFA, 0x09, 0xD7, 0x77, 0x75, 0x9D, 0x97,
+    0x3E, 0x97, 0x29, 0xE7, 0x3F, 0x77, 0x71, 0x77, 0x2C, 0xA7, 0x72, 0xAC, 0x77, 0x29, 0xCA, 0x77,
+    0x2D, 0x77, 0x2D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xA9, 0x59, 0x97, 0x3C, 0xA5, 0xC9,
+    0x73, 0xD9, 0x29, 0xD7, 0x4A, 0xFE, 0x76, 0xAF, 0xA7, 0x71, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x29, 0xDA, 0x77, 0x1F, 0x77, 0x0A, 0xF7, 0x79, 0xFC, 0x77, 0xDA, 0xAD, 0x76, 0xAD, 0x0A,
+    0xD7, 0x59, 0xD9, 0x09, 0xD9, 0x74, 0xDA, 0x19, 0xD9, 0x73, 0xAD, 0x29, 0xDA, 0x72, 0x9D, 0x93,
+    0xDA, 0x72, 0xE4, 0xE7, 0x1A, 0xD5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0xE6, 0xE7, 0xAF, 0xFF, 0xC9,
+    0x59, 0xFF, 0xFD, 0x95, 0xFF, 0xFE, 0x94, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA3, 0x9E, 0x71,
+    0xEA, 0x3E, 0xA7, 0x1F, 0x2A, 0xE7, 0x2F, 0x20, 0x74, 0xAC, 0x75, 0x9C, 0x97, 0x5D, 0x75, 0xD7,
+    0x5A, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x75, 0xAC, 0x59, 0xC6, 0xD5, 0xCA, 0x6A, 0xD9, 0x99, 0xAD,
+    0x70, 0xFE, 0x72, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x5A, 0xEA, 0x0A, 0xC6, 0x9F, 0xFC, 0x59, 0xDA,
+    0x2A, 0xE5, 0xD9, 0x4D, 0xA4, 0xD9, 0x5D, 0xA3, 0x9D, 0x6D, 0x93, 0xD6, 0x9D, 0x4D, 0x6E, 0x39,
+    0xCA, 0x5A, 0xE3, 0xAD, 0x4F, 0xA3, 0xAF, 0xFE, 0xA3, 0x9F, 0xFE, 0x94, 0xFF, 0x9D, 0x6A, 0xFA,
+    0x09, 0xD3, 0x75, 0xAA, 0x77, 0x3A, 0xD7, 0x73, 0xE7, 0x73, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x70,
+    0xA9, 0x59, 0x97, 0x3C, 0xA5, 0xC9, 0x73, 0xD9, 0x29, 0xD7, 0x4A, 0xFE, 0x76, 0xAF, 0xA7, 0x71,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0xDA, 0x77, 0x1F, 0x77, 0x0A, 0xF7, 0x79, 0xFC,
+    0x77, 0xDA, 0xAD, 0x76, 0xAD, 0x0A, 0xD7, 0x59, 0xD9, 0x09, 0xD9, 0x74, 0xDA, 0x19, 0xD9, 0x73,
+    0xAD, 0x29, 0xDA, 0x72, 0x9D, 0x93, 0xDA, 0x72, 0xE4, 0xE7, 0x1A, 0xD5, 0xE7, 0x09, 0xDA, 0x5E,
+    0x70, 0xE6, 0xE7, 0xAF, 0xFF, 0xC9, 0x59, 0xFF, 0xFD, 0x95, 0xFF, 0xFE, 0x94, 0xAE, 0x99, 0x99,
+    0x99, 0x99, 0x9E, 0xA3, 0x9E, 0x71, 0xEA, 0x3E, 0xA7, 0x1F, 0x2A, 0xE7, 0x2F, 0x20, 0x7A, 0xCA,
+    0x76, 0xDA, 0x75, 0x9D, 0xA7, 0x59, 0xAA, 0xA7, 0x77, 0x77, 0x77, 0x3A, 0xC5, 0x9C, 0x6D, 0x5C,
+    0xA6, 0xAD, 0x99, 0x9A, 0xD7, 0x0F, 0xE7, 0x2A, 0xE9, 0x77, 0x77, 0x77, 0x75, 0xAE, 0xA0, 0xAC,
+    0x69, 0xFF, 0xC5, 0x9D, 0xA2, 0xAE, 0x5D, 0x94, 0xDA, 0x4D, 0x95, 0xDA, 0x39, 0xD6, 0xD9, 0x3D,
+    0x69, 0xD4, 0xD6, 0xE3, 0x9C, 0xA5, 0xAE, 0x3A, 0xD4, 0xFA, 0x3A, 0xFF, 0xEA, 0x39, 0xFF, 0xE9,
+    0x4F, 0xF9, 0xD6, 0xAF, 0xA0, 0x9D, 0x30, 0x77, 0xAE, 0x77, 0x19, 0x1C, 0xA7, 0x72, 0xD7, 0x72,
+    0xCA, 0x77, 0x39, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0x95, 0x99, 0x73, 0xCA, 0x5C, 0xA7, 0x3D,
+    0x92, 0x9D, 0x74, 0xAF, 0xE7, 0x6A, 0xFA, 0x77, 0x19, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72,
+    0x9D, 0xA7, 0x71, 0xF7, 0x70, 0xAF, 0x77, 0x9F, 0xC7, 0x7D, 0xAA, 0xD7, 0x6A, 0xD0, 0xAD, 0x75,
+    0x9D, 0x90, 0x9D, 0x97, 0x4D, 0xA1, 0x9D, 0x97, 0x3A, 0xD2, 0x9D, 0xA7, 0x29, 0xD9, 0x3D, 0xA7,
+    0x2E, 0x4E, 0x71, 0xAD, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x0E, 0x6E, 0x7A, 0xFF, 0xFC, 0x95, 0x9F,
+    0xFF, 0xD9, 0x5F, 0xFF, 0xE9, 0x4A, 0xE9, 0x99, 0x99, 0x99, 0x99, 0xEA, 0x39, 0xE7, 0x1E, 0xA3,
+    0xEA, 0x71, 0xF2, 0xAE, 0x72, 0xF2, 0x77, 0x71, 0x9F, 0xCA, 0x71, 0x9A, 0x2A, 0xC9, 0x75, 0xD9,
+    0x73, 0x9D, 0xA7, 0x3A, 0xD7, 0x5D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xA9, 0x59, 0x96, 0xCA,
+    0x5C, 0x96, 0xD9, 0x29, 0xD7, 0xAF, 0xE7, 0x1F, 0xCA, 0x74, 0x97, 0x77, 0x6A, 0xF0, 0xAC, 0x69,
+    0xFF, 0xC5, 0x9D, 0xA2, 0xAE, 0x5D, 0x94, 0xDA, 0x4D, 0x95, 0xDA, 0x39, 0xD6, 0xD9, 0x3D, 0x69,
+    0xD4, 0xD6, 0xE3, 0x9C, 0xA5, 0xAE, 0x3A, 0xD4, 0xFA, 0x3A, 0xFF, 0xEA, 0x39, 0xFF, 0xE9, 0x4F,
+    0xF9, 0xD6, 0xAF, 0xA0, 0x9D, 0x30, 0x75, 0xDA, 0x2A, 0xA7, 0x4D, 0x9C, 0xA1, 0xC9, 0x73, 0x9C,
+    0x90, 0x9C, 0xAD, 0x74, 0xAC, 0x2A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x76, 0xA9, 0x59, 0x97, 0x3C,
+    0xA5, 0xC9, 0x73, 0xD9, 0x29, 0xD7, 0x4A, 0xFE, 0x76, 0xAF, 0xA7, 0x71, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x29, 0xDA, 0x77, 0x1F, 0x77, 0x0A, 0xF7, 0x79, 0xFC, 0x77, 0xDA, 0xAD, 0x76,
+    0xAD, 0x0A, 0xD7, 0x59, 0xD9, 0x09, 0xD9, 0x74, 0xDA, 0x19, 0xD9, 0x73, 0xAD, 0x29, 0xDA, 0x72,
+    0x9D, 0x93, 0xDA, 0x72, 0xE4, 0xE7, 0x1A, 0xD5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0xE6, 0xE7, 0xAF,
+    0xFF, 0xC9, 0x59, 0xFF, 0xFD, 0x95, 0xFF, 0xFE, 0x94, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA3,
+    0x9E, 0x71, 0xEA, 0x3E, 0xA7, 0x1F, 0x2A, 0xE7, 0x2F, 0x20, 0x77, 0x70, 0xE9, 0x19, 0xC7, 0xAC,
+    0x09, 0xC1, 0xCA, 0x7C, 0x91, 0xF7, 0x0C, 0x39, 0x97, 0x77, 0x77, 0x77, 0x3A, 0xC5, 0xAC, 0x6D,
+    0x5C, 0xA6, 0xAD, 0x99, 0x9A, 0xD7, 0x0F, 0xE7, 0x2A, 0xE9, 0x77, 0x77, 0x77, 0x75, 0xAE, 0xA0,
+    0xAC, 0x69, 0xFF, 0xC5, 0x9D, 0xA2, 0xAE, 0x5D, 0x94, 0xDA, 0x4D, 0x95, 0xDA, 0x39, 0xD6, 0xD9,
+    0x3D, 0x69, 0xD4, 0xD6, 0xE3, 0x9C, 0xA5, 0xAE, 0x3A, 0xD4, 0xFA, 0x3A, 0xFF, 0xEA, 0x39, 0xFF,
+    0xE9, 0x4F, 0xF9, 0xD6, 0xAF, 0xA0, 0x9D, 0x30, 0x73, 0xA9, 0x59, 0x97, 0x3C, 0xA5, 0xC9, 0x73,
+    0xD9, 0x29, 0xD7, 0x4A, 0xFE, 0x76, 0xAF, 0xA7, 0x71, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x29, 0xDA, 0x77, 0x1F, 0x77, 0x0A, 0xF7, 0x79, 0xFC, 0x77, 0xDA, 0xAD, 0x76, 0xAD, 0x0A, 0xD7,
+    0x59, 0xD9, 0x09, 0xD9, 0x74, 0xDA, 0x19, 0xD9, 0x73, 0xAD, 0x29, 0xDA, 0x72, 0x9D, 0x93, 0xDA,
+    0x72, 0xE4, 0xE7, 0x1A, 0xD5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0xE6, 0xE7, 0xAF, 0xFF, 0xC9, 0x59,
+    0xFF, 0xFD, 0x95, 0xFF, 0xFE, 0x94, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA3, 0x9E, 0x71, 0xEA,
+    0x3E, 0xA7, 0x1F, 0x2A, 0xE7, 0x2F, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xDA, 0x77, 0x1E,
+    0x97, 0x71, 0xE9, 0x77, 0x0A, 0xE7, 0x40, 0x5A, 0xC5, 0x9C, 0x6D, 0x5C, 0xA6, 0xAD, 0x99, 0x9A,
+    0xD7, 0x0F, 0xE7, 0x2A, 0xE9, 0x77, 0x77, 0x77, 0x75, 0xAE, 0xA0, 0xAC, 0x69, 0xFF, 0xC5, 0x9D,
+    0xA2, 0xAE, 0x5D, 0x94, 0xDA, 0x4D, 0x95, 0xDA, 0x39, 0xD6, 0xD9, 0x3D, 0x69, 0xD4, 0xD6, 0xE3,
+    0x9C, 0xA5, 0xAE, 0x3A, 0xD4, 0xFA, 0x3A, 0xFF, 0xEA, 0x39, 0xFF, 0xE9, 0x4F, 0xF9, 0xD6, 0xAF,
+    0xA0, 0x9D, 0x77, 0x77, 0x70, 0x9D, 0x97, 0x4E, 0x97, 0x39, 0xE7, 0x4F, 0x77, 0x73, 0x77, 0x70,
+    0xAF, 0xFE, 0xA5, 0xFF, 0xF5, 0x9F, 0xEA, 0xAA, 0xA9, 0x5A, 0xD7, 0x7E, 0x77, 0xDA, 0x76, 0xAD,
+    0x77, 0xE7, 0x7F, 0xFC, 0xA7, 0x9F, 0xFC, 0x97, 0xAF, 0xFC, 0x70, 0xE7, 0x69, 0xDA, 0x76, 0xAD,
+    0x97, 0x6E, 0x77, 0xE7, 0x6A, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x95, 0xFF, 0xFC, 0x5F, 0xFF, 0xC4,
+    0x9F, 0xFF, 0xC4, 0xAF, 0xFF, 0xC7, 0x77, 0x77, 0x7E, 0x76, 0xAD, 0xA7, 0x6E, 0xA7, 0x59, 0xE9,
+    0x72, 0x7A, 0xEA, 0x70, 0xAE, 0xAE, 0x6E, 0x93, 0xCA, 0x4A, 0xCA, 0x5A, 0xC3, 0xAC, 0xA5, 0x9D,
+    0x3D, 0xAA, 0xAF, 0xE2, 0xAF, 0xFF, 0x2D, 0xA9, 0x99, 0x97, 0x0D, 0x74, 0x9D, 0x97, 0x39, 0xE7,
+    0x4F, 0xA9, 0x99, 0x9A, 0xC9, 0x3A, 0xFF, 0xD5, 0xAF, 0xFC, 0x69, 0xAF, 0xA9, 0x77, 0x77, 0x77,
+    0x7A, 0xD9, 0x73, 0xE7, 0x39, 0xE7, 0x3F, 0x70, 0x74, 0xAE, 0x76, 0x91, 0xCA, 0x77, 0xD7, 0x7C,
+    0xA7, 0x70, 0x97, 0x77, 0x77, 0x77, 0x77, 0x75, 0xAF, 0xFE, 0xA5, 0xFF, 0xF5, 0x9F, 0xEA, 0xAA,
+    0xA9, 0x5A, 0xD7, 0x7E, 0x77, 0xDA, 0x76, 0xAD, 0x77, 0xE7, 0x7F, 0xFC, 0xA7, 0x9F, 0xFC, 0x97,
+    0xAF, 0xFC, 0x70, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xE7, 0x6A, 0xDA, 0x99, 0x99,
+    0x99, 0x99, 0x95, 0xFF, 0xFC, 0x5F, 0xFF, 0xC4, 0x9F, 0xFF, 0xC4, 0xAF, 0xFF, 0xC4, 0x72, 0xAE,
+    0x73, 0x91, 0xAA, 0x74, 0xAC, 0x74, 0xCA, 0x75, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xEA,
+    0x70, 0xAE, 0xAE, 0x6E, 0x93, 0xCA, 0x4A, 0xCA, 0x5A, 0xC3, 0xAC, 0xA5, 0x9D, 0x3D, 0xAA, 0xAF,
+    0xE2, 0xAF, 0xFF, 0x2D, 0xA9, 0x99, 0x97, 0x0D, 0x74, 0x9D, 0x97, 0x39, 0xE7, 0x4F, 0xA9, 0x99,
+    0x9A, 0xC9, 0x3A, 0xFF, 0xD5, 0xAF, 0xFC, 0x69, 0xAF, 0xA9, 0x30, 0x72, 0xDA, 0x2A, 0xA7, 0x1D,
+    0x9C, 0x91, 0xC9, 0x70, 0x9C, 0x90, 0xAC, 0x0A, 0xC7, 0x1A, 0xC2, 0xEA, 0x77, 0x99, 0x77, 0x77,
+    0x77, 0x77, 0x0A, 0xFF, 0xEA, 0x5F, 0xFF, 0x59, 0xFE, 0xAA, 0xAA, 0x95, 0xAD, 0x77, 0xE7, 0x7D,
+    0xA7, 0x6A, 0xD7, 0x7E, 0x77, 0xFF, 0xCA, 0x79, 0xFF, 0xC9, 0x7A, 0xFF, 0xC7, 0x0E, 0x76, 0x9D,
+    0xA7, 0x6A, 0xD9, 0x76, 0xE7, 0x7E, 0x76, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x5F, 0xFF, 0xC5,
+    0xFF, 0xFC, 0x49, 0xFF, 0xFC, 0x4A, 0xFF, 0xFC, 0x40, 0x70, 0xAC, 0xA2, 0xAC, 0x7A, 0xC9, 0xC9,
+    0x1C, 0xA7, 0xC9, 0x09, 0xC0, 0x9C, 0x7A, 0xC2, 0xEA, 0x75, 0x99, 0x77, 0x77, 0x77, 0x77, 0x75,
+    0xAE, 0xA7, 0x1A, 0xEA, 0xE7, 0xE9, 0x3C, 0xA5, 0xAC, 0xA5, 0xAC, 0x4A, 0xCA, 0x59, 0xD4, 0xDA,
+    0xAA, 0xFE, 0x3A, 0xFF, 0xF3, 0xDA, 0x99, 0x99, 0x71, 0xD7, 0x59, 0xD9, 0x74, 0x9E, 0x75, 0xFA,
+    0x99, 0x99, 0xAC, 0x94, 0xAF, 0xFD, 0x6A, 0xFF, 0xC7, 0x9A, 0xFA, 0x94, 0x77, 0xAC, 0x77, 0x9C,
+    0xA7, 0x7D, 0x77, 0xD9, 0x76, 0xAC, 0xA7, 0x77, 0x70, 0xAC, 0x97, 0x7E, 0x76, 0xAC, 0xAD, 0x97,
+    0x39, 0xC9, 0x19, 0xCA, 0x72, 0xC9, 0x4A, 0xA7, 0x77, 0x1A, 0xFF, 0xEA, 0x5F, 0xFF, 0x59, 0xFE,
+    0xAA, 0xAA, 0x95, 0xAD, 0x77, 0xE7, 0x7D, 0xA7, 0x6A, 0xD7, 0x7E, 0x77, 0xFF, 0xCA, 0x79, 0xFF,
+    0xC9, 0x7A, 0xFF, 0xC7, 0x0E, 0x76, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xE7, 0x7E, 0x76, 0xAD, 0xA9,
+    0x99, 0x99, 0x99, 0x99, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x49, 0xFF, 0xFC, 0x4A, 0xFF, 0xFC, 0x40,
+    0x77, 0x59, 0xC9, 0x77, 0x5C, 0xA7, 0x75, 0xD7, 0x29, 0xC9, 0x7A, 0xCA, 0x72, 0xE9, 0x59, 0xD7,
+    0x2A, 0xCA, 0xD9, 0x77, 0x19, 0xCA, 0x19, 0xCA, 0x77, 0x0C, 0x94, 0x9A, 0x77, 0x77, 0x77, 0x77,
+    0x2A, 0xEA, 0x77, 0x1A, 0xEA, 0xE7, 0x7E, 0x93, 0xCA, 0x75, 0xAC, 0xA5, 0xAC, 0x74, 0xAC, 0xA5,
+    0x9D, 0x74, 0xDA, 0xAA, 0xFE, 0x73, 0xAF, 0xFF, 0x73, 0xDA, 0x99, 0x99, 0x77, 0x1D, 0x77, 0x59,
+    0xD9, 0x77, 0x49, 0xE7, 0x75, 0xFA, 0x99, 0x99, 0xAC, 0x97, 0x4A, 0xFF, 0xD7, 0x6A, 0xFF, 0xC7,
+    0x79, 0xAF, 0xA9, 0x74, 0x77, 0x75, 0xAD, 0x77, 0x0E, 0x77, 0x0E, 0x77, 0x09, 0x9A, 0x74, 0xAC,
+    0x97, 0x7E, 0x76, 0xAC, 0xAD, 0x97, 0x39, 0xC9, 0x19, 0xCA, 0x72, 0xC9, 0x4A, 0xA7, 0x77, 0x1A,
+    0xFF, 0xEA, 0x5F, 0xFF, 0x59, 0xFE, 0xAA, 0xAA, 0x95, 0xAD, 0x77, 0xE7, 0x7D, 0xA7, 0x6A, 0xD7,
+    0x7E, 0x77, 0xFF, 0xCA, 0x79, 0xFF, 0xC9, 0x7A, 0xFF, 0xC7, 0x0E, 0x76, 0x9D, 0xA7, 0x6A, 0xD9,
+    0x76, 0xE7, 0x7E, 0x76, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x49,
+    0xFF, 0xFC, 0x4A, 0xFF, 0xFC, 0x40, 0x6A, 0xCA, 0x76, 0xDA, 0x75, 0x9D, 0xA7, 0x59, 0xAC, 0xA7,
+    0x49, 0xC9, 0x75, 0xE9, 0x73, 0xAC, 0xAD, 0x97, 0x19, 0xCA, 0x19, 0xCA, 0x70, 0xC9, 0x49, 0xA7,
+    0x77, 0x77, 0x2A, 0xEA, 0x71, 0xAE, 0xAE, 0x7E, 0x93, 0xCA, 0x5A, 0xCA, 0x5A, 0xC4, 0xAC, 0xA5,
+    0x9D, 0x4D, 0xAA, 0xAF, 0xE3, 0xAF, 0xFF, 0x3D, 0xA9, 0x99, 0x97, 0x1D, 0x75, 0x9D, 0x97, 0x49,
+    0xE7, 0x5F, 0xA9, 0x99, 0x9A, 0xC9, 0x4A, 0xFF, 0xD6, 0xAF, 0xFC, 0x79, 0xAF, 0xA9, 0x40, 0x74,
+    0x9A, 0xD9, 0x75, 0x91, 0x9C, 0x77, 0x9C, 0xA7, 0x6A, 0xC9, 0x77, 0x99, 0x77, 0x77, 0x0A, 0xC9,
+    0x77, 0xE7, 0x6A, 0xCA, 0xD9, 0x73, 0x9C, 0x91, 0x9C, 0xA7, 0x2C, 0x94, 0xAA, 0x77, 0x71, 0xAF,
+    0xFE, 0xA5, 0xFF, 0xF5, 0x9F, 0xEA, 0xAA, 0xA9, 0x5A, 0xD7, 0x7E, 0x77, 0xDA, 0x76, 0xAD, 0x77,
+    0xE7, 0x7F, 0xFC, 0xA7, 0x9F, 0xFC, 0x97, 0xAF, 0xFC, 0x70, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0x97,
+    0x6E, 0x77, 0xE7, 0x6A, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x95, 0xFF, 0xFC, 0x5F, 0xFF, 0xC4, 0x9F,
+    0xFF, 0xC4, 0xAF, 0xFF, 0xC4, 0x74, 0xAD, 0xA7, 0x59, 0x1A, 0xA7, 0x69, 0xC9, 0x75, 0xAC, 0x97,
+    0x6C, 0x73, 0xD7, 0x69, 0xE7, 0x5D, 0xAD, 0x73, 0xAC, 0x91, 0xAC, 0x97, 0x09, 0xC5, 0xA9, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x1A, 0xEA, 0x72, 0xAE, 0xAE, 0x70, 0xE9, 0x3C, 0xA6, 0xAC, 0xA5, 0xAC,
+    0x5A, 0xCA, 0x59, 0xD5, 0xDA, 0xAA, 0xFE, 0x4A, 0xFF, 0xF4, 0xDA, 0x99, 0x99, 0x72, 0xD7, 0x69,
+    0xD9, 0x75, 0x9E, 0x76, 0xFA, 0x99, 0x99, 0xAC, 0x95, 0xAF, 0xFD, 0x7A, 0xFF, 0xC7, 0x09, 0xAF,
+    0xA9, 0x50, 0x70, 0x9D, 0x92, 0xC9, 0x71, 0xD9, 0xC2, 0xC7, 0x1A, 0xC1, 0xAA, 0x0A, 0xC7, 0x1D,
+    0x2E, 0x97, 0x19, 0x49, 0x77, 0x77, 0x09, 0xC7, 0x70, 0xE7, 0x6A, 0xF9, 0x73, 0x9C, 0xA1, 0xAC,
+    0x97, 0x2C, 0x94, 0xAA, 0x77, 0x77, 0x75, 0xAF, 0xFE, 0xA5, 0xFF, 0xF5, 0x9F, 0xEA, 0xAA, 0xA9,
+    0x5A, 0xD7, 0x7E, 0x77, 0xDA, 0x76, 0xAD, 0x77, 0xE7, 0x7F, 0xFC, 0xA7, 0x9F, 0xFC, 0x97, 0xAF,
+    0xFC, 0x70, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xE7, 0x6A, 0xDA, 0x99, 0x99, 0x99,
+    0x99, 0x95, 0xFF, 0xFC, 0x5F, 0xFF, 0xC4, 0x9F, 0xFF, 0xC4, 0xAF, 0xFF, 0xC4, 0x7D, 0xA2, 0xAA,
+    0x6D, 0x9C, 0x91, 0xC9, 0x59, 0xC1, 0xAC, 0x0A, 0xC6, 0xAC, 0x2E, 0x96, 0x94, 0x99, 0x77, 0x71,
+    0x9C, 0x97, 0x4E, 0x73, 0xAF, 0x97, 0x09, 0xCA, 0x19, 0xCA, 0x7C, 0xA4, 0xAC, 0x77, 0x77, 0x77,
+    0x70, 0xAE, 0xA7, 0x0A, 0xEA, 0xE6, 0xE9, 0x3C, 0xA4, 0xAC, 0xA5, 0xAC, 0x3A, 0xCA, 0x59, 0xD3,
+    0xDA, 0xAA, 0xFE, 0x2A, 0xFF, 0xF2, 0xDA, 0x99, 0x99, 0x70, 0xD7, 0x49, 0xD9, 0x73, 0x9E, 0x74,
+    0xFA, 0x99, 0x99, 0xAC, 0x93, 0xAF, 0xFD, 0x5A, 0xFF, 0xC6, 0x9A, 0xFA, 0x93, 0x72, 0xAC, 0x97,
+    0x7E, 0x76, 0xAC, 0xAD, 0x97, 0x39, 0xC9, 0x19, 0xCA, 0x72, 0xC9, 0x4A, 0xA7, 0x77, 0x1A, 0xFF,
+    0xEA, 0x5F, 0xFF, 0x59, 0xFE, 0xAA, 0xAA, 0x95, 0xAD, 0x77, 0xE7, 0x7D, 0xA7, 0x6A, 0xD7, 0x7E,
+    0x77, 0xFF, 0xCA, 0x79, 0xFF, 0xC9, 0x7A, 0xFF, 0xC7, 0x0E, 0x76, 0x9D, 0xA7, 0x6A, 0xD9, 0x76,
+    0xE7, 0x7E, 0x76, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x49, 0xFF,
+    0xFC, 0x4A, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0xE7, 0x6A, 0xDA, 0x76, 0xEA, 0x75, 0x9E, 0x97, 0x20,
+    0x72, 0xAA, 0x77, 0x0D, 0xA7, 0x6D, 0xAD, 0x74, 0xAC, 0x91, 0xAC, 0x97, 0x19, 0xC4, 0x9C, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x74, 0xAE, 0xA7, 0x3A, 0xEA, 0xE7, 0x1E, 0x93, 0xCA, 0x7A, 0xCA, 0x5A,
+    0xC6, 0xAC, 0xA5, 0x9D, 0x6D, 0xAA, 0xAF, 0xE5, 0xAF, 0xFF, 0x5D, 0xA9, 0x99, 0x97, 0x3D, 0x77,
+    0x9D, 0x97, 0x69, 0xE7, 0x7F, 0xA9, 0x99, 0x9A, 0xC9, 0x6A, 0xFF, 0xD7, 0x0A, 0xFF, 0xC7, 0x19,
+    0xAF, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xD9, 0x76, 0xE7, 0x69, 0xE7, 0x6F, 0x73, 0x7A, 0xDA,
+    0x70, 0x91, 0xAA, 0x71, 0xAC, 0x97, 0x0A, 0xC9, 0x71, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x76, 0xE9,
+    0x79, 0xE7, 0x0A, 0xE7, 0x0A, 0xDA, 0x70, 0xE9, 0x70, 0xE7, 0x09, 0xE7, 0x0A, 0xDA, 0x70, 0xE7,
+    0x09, 0xE7, 0x0A, 0xDA, 0x70, 0xE9, 0x70, 0xE9, 0x79, 0xE7, 0x0A, 0xE7, 0x0E, 0xA7, 0x9E, 0x97,
+    0xAE, 0x97, 0xF7, 0x9F, 0x7A, 0xEA, 0x70, 0x5A, 0xDA, 0x59, 0x91, 0xC7, 0x0D, 0x69, 0xCA, 0x79,
+    0x97, 0x77, 0x77, 0x72, 0xAC, 0x97, 0xD7, 0x0D, 0x79, 0xCA, 0x7A, 0xC9, 0x7D, 0x79, 0xD7, 0xAC,
+    0xA7, 0xD9, 0x69, 0xD7, 0xAD, 0x7E, 0x69, 0xDA, 0x6A, 0xD9, 0x60, 0x7E, 0x96, 0x9E, 0x7A, 0xE7,
+    0xAD, 0xA7, 0xE9, 0x7E, 0x79, 0xE7, 0xAD, 0xA7, 0xE7, 0x9E, 0x7A, 0xDA, 0x7E, 0x97, 0xE9, 0x69,
+    0xE7, 0xAE, 0x7E, 0xA6, 0x9E, 0x96, 0xAE, 0x96, 0xF6, 0x9F, 0x6A, 0xEA, 0x77, 0x76, 0xDA, 0x7A,
+    0xDA, 0x7E, 0xA6, 0xAE, 0x97, 0x72, 0x7E, 0x79, 0xE7, 0xEA, 0x69, 0xEA, 0x77, 0x77, 0x77, 0x6A,
+    0xC9, 0x70, 0xD7, 0x1D, 0x70, 0x9C, 0xA7, 0x0A, 0xC9, 0x70, 0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70,
+    0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x77, 0x77, 0xE7, 0x9E, 0x7E, 0xA6,
+    0x9E, 0xA7, 0x72, 0x71, 0x9A, 0xFC, 0xA7, 0x5A, 0xFF, 0xDA, 0x71, 0x9F, 0xC9, 0x99, 0xAF, 0xA7,
+    0x9F, 0x95, 0xF6, 0x9E, 0xA7, 0x9E, 0x95, 0xF7, 0x1E, 0xA4, 0xAE, 0x72, 0xEA, 0x4E, 0x97, 0x2A,
+    0xDA, 0x39, 0xE7, 0x3A, 0xD9, 0x3E, 0x97, 0x3E, 0x4E, 0x74, 0xE3, 0x9D, 0xA7, 0x39, 0xDA, 0x3A,
+    0xDA, 0x73, 0xE9, 0x3A, 0xDA, 0x72, 0xAE, 0x4A, 0xE9, 0x70, 0xF9, 0x4A, 0xFC, 0x99, 0x99, 0x9A,
+    0xFD, 0x59, 0xFF, 0xFF, 0x96, 0xFF, 0xFE, 0xA7, 0xAF, 0xFF, 0xCA, 0x71, 0xAF, 0xFE, 0x97, 0x4A,
+    0xFD, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7E, 0x77, 0x39, 0xE7, 0x73, 0xEA, 0x77, 0x29, 0xEA,
+    0x77, 0x77, 0x60, 0x6A, 0xAE, 0xA7, 0x09, 0xFF, 0x6A, 0xE9, 0x99, 0x9E, 0x49, 0xD9, 0x49, 0xD4,
+    0xDA, 0x6D, 0x92, 0x9D, 0x7D, 0x92, 0xDA, 0x69, 0xD3, 0xD9, 0x6E, 0x29, 0xD6, 0x9D, 0x92, 0x9D,
+    0xA4, 0x9E, 0x4F, 0xCA, 0xFC, 0x94, 0xFF, 0xD9, 0x6F, 0xF9, 0x70, 0xAE, 0xA9, 0x77, 0x77, 0x77,
+    0x77, 0x76, 0xDA, 0x74, 0xAD, 0xA7, 0x4E, 0x97, 0x3A, 0xE9, 0x71, 0x75, 0x9A, 0xD9, 0x77, 0x29,
+    0x19, 0xC7, 0x74, 0x9C, 0xA7, 0x73, 0xAC, 0x97, 0x74, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x09, 0xAF, 0xCA, 0x75, 0xAF, 0xFD, 0xA7, 0x19, 0xFC, 0x99, 0x9A, 0xFA, 0x79, 0xF9, 0x5F,
+    0x69, 0xEA, 0x79, 0xE9, 0x5F, 0x71, 0xEA, 0x4A, 0xE7, 0x2E, 0xA4, 0xE9, 0x72, 0xAD, 0xA3, 0x9E,
+    0x73, 0xAD, 0x93, 0xE9, 0x73, 0xE4, 0xE7, 0x4E, 0x39, 0xDA, 0x73, 0x9D, 0xA3, 0xAD, 0xA7, 0x3E,
+    0x93, 0xAD, 0xA7, 0x2A, 0xE4, 0xAE, 0x97, 0x0F, 0x94, 0xAF, 0xC9, 0x99, 0x99, 0xAF, 0xD5, 0x9F,
+    0xFF, 0xF9, 0x6F, 0xFF, 0xEA, 0x7A, 0xFF, 0xFC, 0xA7, 0x1A, 0xFF, 0xE9, 0x74, 0xAF, 0xDA, 0x97,
+    0x77, 0x71, 0x72, 0xAD, 0xA7, 0x49, 0x1C, 0x97, 0x5A, 0xC7, 0x5D, 0x76, 0xA7, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x70, 0xAA, 0xEA, 0x70, 0x9F, 0xF6, 0xAE, 0x99, 0x99, 0xE4, 0x9D, 0x94, 0x9D,
+    0x4D, 0xA6, 0xD9, 0x29, 0xD7, 0xD9, 0x2D, 0xA6, 0x9D, 0x3D, 0x96, 0xE2, 0x9D, 0x69, 0xD9, 0x29,
+    0xDA, 0x49, 0xE4, 0xFC, 0xAF, 0xC9, 0x4F, 0xFD, 0x96, 0xFF, 0x97, 0x0A, 0xEA, 0x96, 0x74, 0xCA,
+    0x77, 0x71, 0xAD, 0x97, 0x77, 0x0D, 0xAC, 0xA7, 0x76, 0xD1, 0x9D, 0x77, 0x4A, 0xC4, 0x9C, 0x97,
+    0x77, 0x77, 0x79, 0xAF, 0xCA, 0x77, 0x2A, 0xFF, 0xDA, 0x5A, 0xC6, 0x9F, 0xC9, 0x99, 0xAF, 0xA3,
+    0xAC, 0x95, 0x9F, 0x95, 0xF2, 0x9C, 0xA5, 0x9E, 0xA7, 0x9E, 0x91, 0xD6, 0xF7, 0x1E, 0xA0, 0xD9,
+    0x5A, 0xE7, 0x2E, 0xA7, 0x1E, 0x97, 0x2A, 0xDA, 0x70, 0x9E, 0x73, 0xAD, 0x97, 0x0E, 0x97, 0x3E,
+    0x71, 0xE7, 0x4E, 0x70, 0x9D, 0xA7, 0x39, 0xDA, 0x70, 0xAD, 0xA7, 0x3E, 0x97, 0x0A, 0xDA, 0x72,
+    0xAE, 0x71, 0xAE, 0x97, 0x0F, 0x97, 0x1A, 0xFC, 0x99, 0x99, 0x9A, 0xFD, 0x72, 0x9F, 0xFF, 0xF9,
+    0x73, 0xFF, 0xFE, 0xA7, 0x4A, 0xFF, 0xFC, 0xA7, 0x6A, 0xFF, 0xE9, 0x77, 0x1A, 0xFD, 0xA9, 0x77,
+    0x77, 0x73, 0x77, 0x6C, 0x97, 0x75, 0xD7, 0x1A, 0xC7, 0x1A, 0xC9, 0x71, 0xE7, 0x9C, 0xA7, 0x1A,
+    0xF6, 0xD7, 0x19, 0xCA, 0x1A, 0xC9, 0x77, 0x0C, 0x94, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72,
+    0xAA, 0xEA, 0x77, 0x09, 0xFF, 0x76, 0xAE, 0x99, 0x99, 0xE7, 0x49, 0xD9, 0x49, 0xD7, 0x4D, 0xA6,
+    0xD9, 0x72, 0x9D, 0x7D, 0x97, 0x2D, 0xA6, 0x9D, 0x73, 0xD9, 0x6E, 0x72, 0x9D, 0x69, 0xD9, 0x72,
+    0x9D, 0xA4, 0x9E, 0x74, 0xFC, 0xAF, 0xC9, 0x74, 0xFF, 0xD9, 0x76, 0xFF, 0x97, 0x70, 0xAE, 0xA9,
+    0x76, 0x77, 0x77, 0x09, 0xD9, 0x77, 0x4A, 0xD9, 0x77, 0x4A, 0xD9, 0x77, 0x49, 0x9A, 0x77, 0x77,
+    0x75, 0xCA, 0x77, 0x4A, 0xD9, 0x77, 0x3D, 0xAC, 0xA7, 0x71, 0xD1, 0x9D, 0x77, 0xAC, 0x49, 0xC9,
+    0x77, 0x77, 0x59, 0xAF, 0xCA, 0x75, 0xAF, 0xFD, 0xA7, 0x19, 0xFC, 0x99, 0x9A, 0xFA, 0x79, 0xF9,
+    0x5F, 0x69, 0xEA, 0x79, 0xE9, 0x5F, 0x71, 0xEA, 0x4A, 0xE7, 0x2E, 0xA4, 0xE9, 0x72, 0xAD, 0xA3,
+    0x9E, 0x73, 0xAD, 0x93, 0xE9, 0x73, 0xE4, 0xE7, 0x4E, 0x39, 0xDA, 0x73, 0x9D, 0xA3, 0xAD, 0xA7,
+    0x3E, 0x93, 0xAD, 0xA7, 0x2A, 0xE4, 0xAE, 0x97, 0x0F, 0x94, 0xAF, 0xC9, 0x99, 0x99, 0xAF, 0xD5,
+    0x9F, 0xFF, 0xF9, 0x6F, 0xFF, 0xEA, 0x7A, 0xFF, 0xFC, 0xA7, 0x1A, 0xFF, 0xE9, 0x74, 0xAF, 0xDA,
+    0x97, 0x77, 0x71, 0x6A, 0xA7, 0x6A, 0xD9, 0x75, 0xAD, 0x97, 0x5A, 0xD9, 0x74, 0xAC, 0x76, 0xE7,
+    0x4A, 0xF7, 0x29, 0xCA, 0x1A, 0xC9, 0x70, 0xC9, 0x4A, 0xA7, 0x77, 0x77, 0x77, 0x2A, 0xAE, 0xA7,
+    0x09, 0xFF, 0x6A, 0xE9, 0x99, 0x9E, 0x49, 0xD9, 0x49, 0xD4, 0xDA, 0x6D, 0x92, 0x9D, 0x7D, 0x92,
+    0xDA, 0x69, 0xD3, 0xD9, 0x6E, 0x29, 0xD6, 0x9D, 0x92, 0x9D, 0xA4, 0x9E, 0x4F, 0xCA, 0xFC, 0x94,
+    0xFF, 0xD9, 0x6F, 0xF9, 0x70, 0xAE, 0xA9, 0x60, 0x77, 0x69, 0xE9, 0x77, 0x79, 0x1A, 0xC7, 0x77,
+    0x19, 0xCA, 0x77, 0x70, 0xAC, 0x97, 0x77, 0x1A, 0x77, 0x0C, 0xA7, 0x77, 0x1A, 0xD9, 0x77, 0x70,
+    0xDA, 0xCA, 0x77, 0x6D, 0x19, 0xD7, 0x74, 0xAC, 0x49, 0xC9, 0x77, 0x77, 0x77, 0x9A, 0xFC, 0xA7,
+    0x72, 0xAF, 0xFD, 0xA7, 0x69, 0xFC, 0x99, 0x9A, 0xFA, 0x74, 0x9F, 0x95, 0xF7, 0x39, 0xEA, 0x79,
+    0xE9, 0x72, 0xF7, 0x1E, 0xA7, 0x1A, 0xE7, 0x2E, 0xA7, 0x1E, 0x97, 0x2A, 0xDA, 0x70, 0x9E, 0x73,
+    0xAD, 0x97, 0x0E, 0x97, 0x3E, 0x71, 0xE7, 0x4E, 0x70, 0x9D, 0xA7, 0x39, 0xDA, 0x70, 0xAD, 0xA7,
+    0x3E, 0x97, 0x0A, 0xDA, 0x72, 0xAE, 0x71, 0xAE, 0x97, 0x0F, 0x97, 0x1A, 0xFC, 0x99, 0x99, 0x9A,
+    0xFD, 0x72, 0x9F, 0xFF, 0xF9, 0x73, 0xFF, 0xFE, 0xA7, 0x4A, 0xFF, 0xFC, 0xA7, 0x6A, 0xFF, 0xE9,
+    0x77, 0x1A, 0xFD, 0xA9, 0x77, 0x77, 0x73, 0x74, 0xAD, 0xA7, 0x59, 0x1C, 0xA7, 0x6A, 0xC9, 0x75,
+    0xD9, 0x76, 0xC7, 0x3C, 0xA7, 0x6A, 0xDA, 0x75, 0xDA, 0xD7, 0x3D, 0x2A, 0xC7, 0x1A, 0xA4, 0x9C,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x70, 0xAA, 0xEA, 0x71, 0x9F, 0xF7, 0xAE, 0x99, 0x99, 0xE5, 0x9D,
+    0x94, 0x9D, 0x5D, 0xA6, 0xD9, 0x39, 0xD7, 0xD9, 0x3D, 0xA6, 0x9D, 0x4D, 0x96, 0xE3, 0x9D, 0x69,
+    0xD9, 0x39, 0xDA, 0x49, 0xE5, 0xFC, 0xAF, 0xC9, 0x5F, 0xFD, 0x97, 0xFF, 0x97, 0x1A, 0xEA, 0x97,
+    0x77, 0x77, 0x2E, 0x29, 0xC7, 0x6A, 0xC0, 0xAC, 0x1C, 0xA7, 0x6C, 0x91, 0xCA, 0xAC, 0x76, 0x9C,
+    0x29, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x1C, 0xA7, 0x74, 0xAD, 0xA7, 0x72, 0x9D, 0xAC, 0xA7, 0x71,
+    0xD2, 0xAC, 0x77, 0xAA, 0x49, 0xC9, 0x77, 0x77, 0x69, 0xAF, 0xCA, 0x75, 0xAF, 0xFD, 0xA7, 0x19,
+    0xFC, 0x99, 0x9A, 0xFA, 0x79, 0xF9, 0x5F, 0x69, 0xEA, 0x79, 0xE9, 0x5F, 0x71, 0xEA, 0x4A, 0xE7,
+    0x2E, 0xA4, 0xE9, 0x72, 0xAD, 0xA3, 0x9E, 0x73, 0xAD, 0x93, 0xE9, 0x73, 0xE4, 0xE7, 0x4E, 0x39,
+    0xDA, 0x73, 0x9D, 0xA3, 0xAD, 0xA7, 0x3E, 0x93, 0xAD, 0xA7, 0x2A, 0xE4, 0xAE, 0x97, 0x0F, 0x94,
+    0xAF, 0xC9, 0x99, 0x99, 0xAF, 0xD5, 0x9F, 0xFF, 0xF9, 0x6F, 0xFF, 0xEA, 0x7A, 0xFF, 0xFC, 0xA7,
+    0x1A, 0xFF, 0xE9, 0x74, 0xAF, 0xDA, 0x97, 0x77, 0x71, 0x77, 0x7A, 0xDA, 0x2C, 0x96, 0x9C, 0xA0,
+    0xC9, 0x09, 0xC7, 0xAC, 0x1A, 0xCA, 0xCA, 0x7C, 0xA2, 0xAD, 0x77, 0x77, 0x74, 0xAC, 0x76, 0xE7,
+    0x4A, 0xF7, 0x29, 0xCA, 0x1A, 0xC9, 0x70, 0xC9, 0x4A, 0xA7, 0x77, 0x77, 0x77, 0x3A, 0xAE, 0xA7,
+    0x09, 0xFF, 0x6A, 0xE9, 0x99, 0x9E, 0x49, 0xD9, 0x49, 0xD4, 0xDA, 0x6D, 0x92, 0x9D, 0x7D, 0x92,
+    0xDA, 0x69, 0xD3, 0xD9, 0x6E, 0x29, 0xD6, 0x9D, 0x92, 0x9D, 0xA4, 0x9E, 0x4F, 0xCA, 0xFC, 0x94,
+    0xFF, 0xD9, 0x6F, 0xF9, 0x70, 0xAE, 0xA9, 0x60, 0x74, 0xCA, 0x77, 0x4A, 0xD9, 0x77, 0x3D, 0xAC,
+    0xA7, 0x71, 0xD1, 0x9D, 0x77, 0xAC, 0x49, 0xC9, 0x77, 0x77, 0x59, 0xAF, 0xCA, 0x75, 0xAF, 0xFD,
+    0xA7, 0x19, 0xFC, 0x99, 0x9A, 0xFA, 0x79, 0xF9, 0x5F, 0x69, 0xEA, 0x79, 0xE9, 0x5F, 0x71, 0xEA,
+    0x4A, 0xE7, 0x2E, 0xA4, 0xE9, 0x72, 0xAD, 0xA3, 0x9E, 0x73, 0xAD, 0x93, 0xE9, 0x73, 0xE4, 0xE7,
+    0x4E, 0x39, 0xDA, 0x73, 0x9D, 0xA3, 0xAD, 0xA7, 0x3E, 0x93, 0xAD, 0xA7, 0x2A, 0xE4, 0xAE, 0x97,
+    0x0F, 0x94, 0xAF, 0xC9, 0x99, 0x99, 0xAF, 0xD5, 0x9F, 0xFF, 0xF9, 0x6F, 0xFF, 0xEA, 0x7A, 0xFF,
+    0xFC, 0xA7, 0x1A, 0xFF, 0xE9, 0x74, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0xE7, 0x73,
+    0x9E, 0x77, 0x3E, 0xA7, 0x72, 0x9E, 0xA7, 0x77, 0x76, 0x70, 0xAC, 0x76, 0xE7, 0x4A, 0xF7, 0x29,
+    0xCA, 0x1A, 0xC9, 0x70, 0xC9, 0x4A, 0xA7, 0x77, 0x77, 0x77, 0x2A, 0xAE, 0xA7, 0x09, 0xFF, 0x6A,
+    0xE9, 0x99, 0x9E, 0x49, 0xD9, 0x49, 0xD4, 0xDA, 0x6D, 0x92, 0x9D, 0x7D, 0x92, 0xDA, 0x69, 0xD3,
+    0xD9, 0x6E, 0x29, 0xD6, 0x9D, 0x92, 0x9D, 0xA4, 0x9E, 0x4F, 0xCA, 0xFC, 0x94, 0xFF, 0xD9, 0x6F,
+    0xF9, 0x70, 0xAE, 0xA9, 0x77, 0x77, 0x77, 0x77, 0xAD, 0x97, 0x4E, 0x74, 0x9E, 0x74, 0xF7, 0x77,
+    0x00, 0x77, 0x49, 0xC7, 0x77, 0x3C, 0xA7, 0x77, 0x2D, 0x77, 0x72, 0xAC, 0x97, 0x77, 0x1A, 0xD7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xC7, 0x29, 0xAF, 0xCA, 0x70, 0xD7,
+    0x0A, 0xFF, 0xDA, 0x59, 0xC9, 0x69, 0xFC, 0x99, 0x9A, 0xFA, 0x39, 0xD6, 0x9F, 0x95, 0xF2, 0xE6,
+    0x9E, 0xA7, 0x9E, 0x91, 0xAA, 0x7F, 0x71, 0xEA, 0x72, 0xAE, 0x72, 0xEA, 0x72, 0xE9, 0x72, 0xAD,
+    0xA7, 0x19, 0xE7, 0x3A, 0xD9, 0x71, 0xE9, 0x73, 0xE7, 0x2E, 0x74, 0xE7, 0x19, 0xDA, 0x73, 0x9D,
+    0xA7, 0x1A, 0xDA, 0x73, 0xE9, 0x71, 0xAD, 0xA7, 0x2A, 0xE7, 0x2A, 0xE9, 0x70, 0xF9, 0x72, 0xAF,
+    0xC9, 0x99, 0x99, 0xAF, 0xD7, 0x39, 0xFF, 0xFF, 0x97, 0x4F, 0xFF, 0xEA, 0x75, 0xAF, 0xFF, 0xCA,
+    0x77, 0xAF, 0xFE, 0x97, 0x72, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x50, 0x75, 0xCA, 0x77, 0xD7, 0x7A,
+    0xC9, 0x76, 0x9D, 0x77, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xA9, 0x6A, 0xAE, 0xA3,
+    0xC9, 0x49, 0xFF, 0x1A, 0xC4, 0xAE, 0x99, 0x99, 0xEA, 0xC9, 0x39, 0xD9, 0x49, 0xE9, 0x4D, 0xA6,
+    0xD9, 0x49, 0xD7, 0xD9, 0x4D, 0xA6, 0x9D, 0x5D, 0x96, 0xE4, 0x9D, 0x69, 0xD9, 0x49, 0xDA, 0x49,
+    0xE6, 0xFC, 0xAF, 0xC9, 0x6F, 0xFD, 0x97, 0x0F, 0xF9, 0x72, 0xAE, 0xA9, 0x70, 0x77, 0x9A, 0x97,
+    0x77, 0x3D, 0x97, 0x77, 0x29, 0xDA, 0x77, 0x72, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x4A, 0xC7, 0x29, 0xAF, 0xCA, 0x70, 0xD7, 0x0A, 0xFF, 0xDA, 0x59, 0xC9, 0x69, 0xFC, 0x99,
+    0x9A, 0xFA, 0x39, 0xD6, 0x9F, 0x95, 0xF2, 0xE6, 0x9E, 0xA7, 0x9E, 0x91, 0xAA, 0x7F, 0x71, 0xEA,
+    0x72, 0xAE, 0x72, 0xEA, 0x72, 0xE9, 0x72, 0xAD, 0xA7, 0x19, 0xE7, 0x3A, 0xD9, 0x71, 0xE9, 0x73,
+    0xE7, 0x2E, 0x74, 0xE7, 0x19, 0xDA, 0x73, 0x9D, 0xA7, 0x1A, 0xDA, 0x73, 0xE9, 0x71, 0xAD, 0xA7,
+    0x2A, 0xE7, 0x2A, 0xE9, 0x70, 0xF9, 0x72, 0xAF, 0xC9, 0x99, 0x99, 0xAF, 0xD7, 0x39, 0xFF, 0xFF,
+    0x97, 0x4F, 0xFF, 0xEA, 0x75, 0xAF, 0xFF, 0xCA, 0x77, 0xAF, 0xFE, 0x97, 0x72, 0xAF, 0xDA, 0x97,
+    0x77, 0x77, 0x50, 0x70, 0xD7, 0x70, 0xAD, 0x97, 0x7E, 0x97, 0x7A, 0xAC, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x70, 0xA9, 0x6A, 0xAE, 0xA3, 0xC9, 0x49, 0xFF, 0x1A, 0xC4, 0xAE, 0x99, 0x99, 0xEA,
+    0xC9, 0x39, 0xD9, 0x49, 0xE9, 0x4D, 0xA6, 0xD9, 0x49, 0xD7, 0xD9, 0x4D, 0xA6, 0x9D, 0x5D, 0x96,
+    0xE4, 0x9D, 0x69, 0xD9, 0x49, 0xDA, 0x49, 0xE6, 0xFC, 0xAF, 0xC9, 0x6F, 0xFD, 0x97, 0x0F, 0xF9,
+    0x72, 0xAE, 0xA9, 0x70, 0x77, 0x19, 0xEA, 0x77, 0x70, 0x91, 0x9C, 0x77, 0x72, 0x9C, 0xA7, 0x77,
+    0x1A, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xAC, 0x72, 0x9A, 0xFC,
+    0xA7, 0x0D, 0x70, 0xAF, 0xFD, 0xA5, 0x9C, 0x96, 0x9F, 0xC9, 0x99, 0xAF, 0xA3, 0x9D, 0x69, 0xF9,
+    0x5F, 0x2E, 0x69, 0xEA, 0x79, 0xE9, 0x1A, 0xA7, 0xF7, 0x1E, 0xA7, 0x2A, 0xE7, 0x2E, 0xA7, 0x2E,
+    0x97, 0x2A, 0xDA, 0x71, 0x9E, 0x73, 0xAD, 0x97, 0x1E, 0x97, 0x3E, 0x72, 0xE7, 0x4E, 0x71, 0x9D,
+    0xA7, 0x39, 0xDA, 0x71, 0xAD, 0xA7, 0x3E, 0x97, 0x1A, 0xDA, 0x72, 0xAE, 0x72, 0xAE, 0x97, 0x0F,
+    0x97, 0x2A, 0xFC, 0x99, 0x99, 0x9A, 0xFD, 0x73, 0x9F, 0xFF, 0xF9, 0x74, 0xFF, 0xFE, 0xA7, 0x5A,
+    0xFF, 0xFC, 0xA7, 0x7A, 0xFF, 0xE9, 0x77, 0x2A, 0xFD, 0xA9, 0x77, 0x77, 0x75, 0x72, 0xAD, 0xA7,
+    0x69, 0x1C, 0x97, 0x7A, 0xC7, 0x7D, 0x77, 0x0A, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5A,
+    0x96, 0xAA, 0xEA, 0x3C, 0x94, 0x9F, 0xF1, 0xAC, 0x4A, 0xE9, 0x99, 0x9E, 0xAC, 0x93, 0x9D, 0x94,
+    0x9E, 0x94, 0xDA, 0x6D, 0x94, 0x9D, 0x7D, 0x94, 0xDA, 0x69, 0xD5, 0xD9, 0x6E, 0x49, 0xD6, 0x9D,
+    0x94, 0x9D, 0xA4, 0x9E, 0x6F, 0xCA, 0xFC, 0x96, 0xFF, 0xD9, 0x70, 0xFF, 0x97, 0x2A, 0xEA, 0x97,
+    0x00, 0x77, 0x9D, 0x92, 0xC7, 0x74, 0x9C, 0xAA, 0xC1, 0x9C, 0x77, 0x4D, 0x1C, 0x90, 0xCA, 0x77,
+    0x4C, 0x91, 0x9E, 0x77, 0x59, 0x49, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xAC, 0x72, 0x9A, 0xFC,
+    0xA7, 0x0D, 0x70, 0xAF, 0xFD, 0xA5, 0x9C, 0x96, 0x9F, 0xC9, 0x99, 0xAF, 0xA3, 0x9D, 0x69, 0xF9,
+    0x5F, 0x2E, 0x69, 0xEA, 0x79, 0xE9, 0x1A, 0xA7, 0xF7, 0x1E, 0xA7, 0x2A, 0xE7, 0x2E, 0xA7, 0x2E,
+    0x97, 0x2A, 0xDA, 0x71, 0x9E, 0x73, 0xAD, 0x97, 0x1E, 0x97, 0x3E, 0x72, 0xE7, 0x4E, 0x71, 0x9D,
+    0xA7, 0x39, 0xDA, 0x71, 0xAD, 0xA7, 0x3E, 0x97, 0x1A, 0xDA, 0x72, 0xAE, 0x72, 0xAE, 0x97, 0x0F,
+    0x97, 0x2A, 0xFC, 0x99, 0x99, 0x9A, 0xFD, 0x73, 0x9F, 0xFF, 0xF9, 0x74, 0xFF, 0xFE, 0xA7, 0x5A,
+    0xFF, 0xFC, 0xA7, 0x7A, 0xFF, 0xE9, 0x77, 0x2A, 0xFD, 0xA9, 0x77, 0x77, 0x75, 0x77, 0x72, 0x9E,
+    0x2C, 0xA7, 0x1C, 0xA0, 0xC9, 0x1C, 0x97, 0x0A, 0xC1, 0x9C, 0xAD, 0x71, 0xD2, 0xAD, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x0A, 0x96, 0xAA, 0xEA, 0x3C, 0x94, 0x9F, 0xF1, 0xAC, 0x4A, 0xE9, 0x99,
+    0x9E, 0xAC, 0x93, 0x9D, 0x94, 0x9E, 0x94, 0xDA, 0x6D, 0x94, 0x9D, 0x7D, 0x94, 0xDA, 0x69, 0xD5,
+    0xD9, 0x6E, 0x49, 0xD6, 0x9D, 0x94, 0x9D, 0xA4, 0x9E, 0x6F, 0xCA, 0xFC, 0x96, 0xFF, 0xD9, 0x70,
+    0xFF, 0x97, 0x2A, 0xEA, 0x97, 0x00, 0x77, 0x77, 0x77, 0x70, 0xAC, 0x72, 0x9A, 0xFC, 0xA7, 0x0D,
+    0x70, 0xAF, 0xFD, 0xA5, 0x9C, 0x96, 0x9F, 0xC9, 0x99, 0xAF, 0xA3, 0x9D, 0x69, 0xF9, 0x5F, 0x2E,
+    0x69, 0xEA, 0x79, 0xE9, 0x1A, 0xA7, 0xF7, 0x1E, 0xA7, 0x2A, 0xE7, 0x2E, 0xA7, 0x2E, 0x97, 0x2A,
+    0xDA, 0x71, 0x9E, 0x73, 0xAD, 0x97, 0x1E, 0x97, 0x3E, 0x72, 0xE7, 0x4E, 0x71, 0x9D, 0xA7, 0x39,
+    0xDA, 0x71, 0xAD, 0xA7, 0x3E, 0x97, 0x1A, 0xDA, 0x72, 0xAE, 0x72, 0xAE, 0x97, 0x0F, 0x97, 0x2A,
+    0xFC, 0x99, 0x99, 0x9A, 0xFD, 0x73, 0x9F, 0xFF, 0xF9, 0x74, 0xFF, 0xFE, 0xA7, 0x5A, 0xFF, 0xFC,
+    0xA7, 0x7A, 0xFF, 0xE9, 0x77, 0x2A, 0xFD, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xE7,
+    0x77, 0x19, 0xE7, 0x77, 0x1E, 0xA7, 0x77, 0x09, 0xEA, 0x77, 0x77, 0x77, 0x20, 0x77, 0x0A, 0x96,
+    0xAA, 0xEA, 0x3C, 0x94, 0x9F, 0xF1, 0xAC, 0x4A, 0xE9, 0x99, 0x9E, 0xAC, 0x93, 0x9D, 0x94, 0x9E,
+    0x94, 0xDA, 0x6D, 0x94, 0x9D, 0x7D, 0x94, 0xDA, 0x69, 0xD5, 0xD9, 0x6E, 0x49, 0xD6, 0x9D, 0x94,
+    0x9D, 0xA4, 0x9E, 0x6F, 0xCA, 0xFC, 0x96, 0xFF, 0xD9, 0x70, 0xFF, 0x97, 0x2A, 0xEA, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x0D, 0xA7, 0x6A, 0xDA, 0x76, 0xE9, 0x75, 0xAE, 0x97, 0x30, 0x59, 0x99,
+    0x71, 0x99, 0x95, 0x9E, 0xA7, 0xF9, 0x4A, 0xE9, 0x7F, 0x5F, 0x70, 0xF5, 0xEA, 0x79, 0xE9, 0x49,
+    0xE9, 0x7A, 0xE5, 0xAE, 0x70, 0xF5, 0xF7, 0x0E, 0xA5, 0xEA, 0x79, 0xE5, 0x9E, 0x70, 0xAE, 0x59,
+    0xE7, 0x0E, 0xA5, 0xAD, 0xA7, 0x0E, 0x95, 0xE9, 0x79, 0xE6, 0xE7, 0x0A, 0xDA, 0x59, 0xE7, 0x0E,
+    0x95, 0xAE, 0x7A, 0xE6, 0xF9, 0x5A, 0xEA, 0x6F, 0xDA, 0xAA, 0xFD, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF,
+    0xD7, 0x09, 0xFF, 0xF9, 0x71, 0x9F, 0xFC, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x73, 0xE7, 0x72, 0xAD,
+    0xA7, 0x72, 0xEA, 0x77, 0x19, 0xE9, 0x75, 0x2D, 0x6D, 0xA1, 0x9D, 0x6D, 0x91, 0xAD, 0x5A, 0xD2,
+    0xDA, 0x5E, 0x2D, 0x95, 0xDA, 0x19, 0xD5, 0x9D, 0x91, 0x9D, 0x5A, 0xD2, 0xAD, 0x5E, 0x2D, 0xA4,
+    0xAD, 0xA2, 0xE3, 0xAE, 0xA2, 0xFF, 0xE9, 0x2F, 0xFE, 0x3F, 0xFE, 0x39, 0xFD, 0x9D, 0xA5, 0x99,
+    0x97, 0x77, 0x19, 0xDA, 0x72, 0xE9, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x77, 0x00, 0x75, 0x9A, 0xD9,
+    0x77, 0x19, 0x19, 0xC7, 0x73, 0x9C, 0xA7, 0x72, 0x9C, 0x97, 0x73, 0x99, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x79, 0x99, 0x71, 0x99, 0x95, 0x9E, 0xA7, 0xF9, 0x4A, 0xE9, 0x7F, 0x5F, 0x79, 0xF5,
+    0xEA, 0x79, 0xE9, 0x49, 0xE9, 0x7A, 0xE5, 0xAE, 0x70, 0xF5, 0xF7, 0x0E, 0xA5, 0xE9, 0x79, 0xE5,
+    0x9E, 0x70, 0xAE, 0x59, 0xE7, 0x0E, 0xA5, 0xAD, 0xA7, 0x0E, 0x95, 0xE9, 0x79, 0xE6, 0xE7, 0x0A,
+    0xDA, 0x59, 0xE7, 0x0E, 0x95, 0xAE, 0x7A, 0xE6, 0xF9, 0x5A, 0xEA, 0x6F, 0xDA, 0xAA, 0xFD, 0x7F,
+    0xFF, 0xDA, 0x7F, 0xFF, 0xD7, 0x09, 0xFF, 0xF9, 0x71, 0x9A, 0xFF, 0xA7, 0x77, 0x70, 0x70, 0xAD,
+    0xA7, 0x19, 0x91, 0xC9, 0x73, 0xD7, 0x3C, 0xA7, 0x39, 0x97, 0x77, 0x77, 0x77, 0x72, 0xD6, 0xDA,
+    0x19, 0xD6, 0xD9, 0x1A, 0xD5, 0xAD, 0x2D, 0xA5, 0xE2, 0xD9, 0x5D, 0xA1, 0x9D, 0x59, 0xD9, 0x19,
+    0xD5, 0xAD, 0x2A, 0xD5, 0xE2, 0xDA, 0x4A, 0xDA, 0x2E, 0x3A, 0xEA, 0x2F, 0xFE, 0x92, 0xFF, 0xE3,
+    0xFF, 0xE3, 0x9F, 0xD9, 0xDA, 0x59, 0x99, 0x70, 0x77, 0x0A, 0xC7, 0x77, 0x9C, 0xA7, 0x77, 0xD7,
+    0x77, 0xD9, 0x77, 0x6A, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0x69, 0xEA,
+    0x7A, 0xE9, 0x0A, 0xC5, 0xAE, 0x97, 0xF0, 0x9D, 0x5F, 0x70, 0xFE, 0x95, 0xF7, 0x9E, 0xAA, 0xA6,
+    0x9E, 0x97, 0xAE, 0x71, 0xAE, 0x70, 0xF7, 0x1A, 0xE7, 0x0E, 0xA7, 0x1E, 0xA7, 0x9E, 0x97, 0x1E,
+    0x70, 0xAE, 0x71, 0x9E, 0x70, 0xEA, 0x71, 0xAD, 0xA7, 0x0E, 0x97, 0x1E, 0x97, 0x9E, 0x72, 0xE7,
+    0x0A, 0xDA, 0x71, 0x9E, 0x70, 0xE9, 0x71, 0xAE, 0x7A, 0xE7, 0x2F, 0x95, 0xAE, 0xA7, 0x2F, 0xDA,
+    0xAA, 0xFD, 0x73, 0xFF, 0xFD, 0xA7, 0x3F, 0xFF, 0xD7, 0x49, 0xFF, 0xF9, 0x75, 0x9F, 0xFC, 0xA7,
+    0x77, 0x77, 0x72, 0x9C, 0x97, 0x6D, 0x76, 0xD9, 0x75, 0xAC, 0xA7, 0x59, 0xD7, 0x77, 0x77, 0x77,
+    0x77, 0x4C, 0x92, 0xD6, 0xDA, 0x9C, 0x29, 0xD6, 0xDA, 0xCA, 0x2A, 0xD5, 0xAF, 0x3D, 0xA5, 0xE9,
+    0x4D, 0x95, 0xDA, 0x49, 0xD5, 0x9D, 0x94, 0x9D, 0x5A, 0xD5, 0xAD, 0x5E, 0x5D, 0xA4, 0xAD, 0xA5,
+    0xE3, 0xAE, 0xA5, 0xFF, 0xE9, 0x5F, 0xFE, 0x6F, 0xFE, 0x69, 0xFD, 0x9D, 0xA7, 0x09, 0x99, 0x73,
+    0x73, 0xAC, 0xA7, 0x77, 0x0D, 0xA7, 0x77, 0x9E, 0x77, 0x79, 0xAD, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x19, 0x69, 0xEA, 0x7A, 0xE9, 0x0A, 0xC5, 0xAE, 0x97, 0xF0, 0x9D, 0x5F, 0x70, 0xFE,
+    0x95, 0xF7, 0x9E, 0xAA, 0xA6, 0x9E, 0x97, 0xAE, 0x71, 0xAE, 0x70, 0xF7, 0x1A, 0xE7, 0x0E, 0xA7,
+    0x1E, 0xA7, 0x9E, 0x97, 0x1E, 0x70, 0xAE, 0x71, 0x9E, 0x70, 0xEA, 0x71, 0xAD, 0xA7, 0x0E, 0x97,
+    0x1E, 0x97, 0x9E, 0x72, 0xE7, 0x0A, 0xDA, 0x71, 0x9E, 0x70, 0xE9, 0x71, 0xAE, 0x7A, 0xE7, 0x2F,
+    0x95, 0xAE, 0xA7, 0x2F, 0xDA, 0xAA, 0xFD, 0x73, 0xFF, 0xFD, 0xA7, 0x3F, 0xFF, 0xD7, 0x49, 0xFF,
+    0xF9, 0x75, 0x9F, 0xFC, 0xA7, 0x77, 0x77, 0x77, 0x79, 0xD9, 0x76, 0xAD, 0x97, 0x6E, 0x97, 0x69,
+    0xAA, 0x77, 0x77, 0x79, 0x77, 0x0C, 0x92, 0xD6, 0xDA, 0x9C, 0x29, 0xD6, 0xDA, 0xCA, 0x2A, 0xD5,
+    0xAF, 0x3D, 0xA5, 0xE9, 0x4D, 0x95, 0xDA, 0x49, 0xD5, 0x9D, 0x94, 0x9D, 0x5A, 0xD5, 0xAD, 0x5E,
+    0x5D, 0xA4, 0xAD, 0xA5, 0xE3, 0xAE, 0xA5, 0xFF, 0xE9, 0x5F, 0xFE, 0x6F, 0xFE, 0x69, 0xFD, 0x9D,
+    0xA7, 0x09, 0x99, 0x73, 0x75, 0x9A, 0xD9, 0x77, 0x59, 0x19, 0xC7, 0x77, 0x0D, 0x77, 0x69, 0xCA,
+    0x77, 0x7A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0x69, 0xEA, 0x7A, 0xE9,
+    0x0A, 0xC5, 0xAE, 0x97, 0xF0, 0x9D, 0x5F, 0x70, 0xFE, 0x95, 0xF7, 0x9E, 0xAA, 0xA6, 0x9E, 0x97,
+    0xAE, 0x71, 0xAE, 0x70, 0xF7, 0x1A, 0xE7, 0x0E, 0xA7, 0x1E, 0xA7, 0x9E, 0x97, 0x1E, 0x70, 0xAE,
+    0x71, 0x9E, 0x70, 0xEA, 0x71, 0xAD, 0xA7, 0x0E, 0x97, 0x1E, 0x97, 0x9E, 0x72, 0xE7, 0x0A, 0xDA,
+    0x71, 0x9E, 0x70, 0xE9, 0x71, 0xAE, 0x7A, 0xE7, 0x2F, 0x95, 0xAE, 0xA7, 0x2F, 0xDA, 0xAA, 0xFD,
+    0x73, 0xFF, 0xFD, 0xA7, 0x3F, 0xFF, 0xD7, 0x49, 0xFF, 0xF9, 0x75, 0x9F, 0xFC, 0xA7, 0x77, 0x77,
+    0x70, 0xAD, 0xA7, 0x49, 0x91, 0xC9, 0x76, 0xD7, 0x6C, 0xA7, 0x69, 0x97, 0x77, 0x77, 0x77, 0x29,
+    0x77, 0x0C, 0x92, 0xD6, 0xDA, 0x9C, 0x29, 0xD6, 0xDA, 0xCA, 0x2A, 0xD5, 0xAF, 0x3D, 0xA5, 0xE9,
+    0x4D, 0x95, 0xDA, 0x49, 0xD5, 0x9D, 0x94, 0x9D, 0x5A, 0xD5, 0xAD, 0x5E, 0x5D, 0xA4, 0xAD, 0xA5,
+    0xE3, 0xAE, 0xA5, 0xFF, 0xE9, 0x5F, 0xFE, 0x6F, 0xFE, 0x69, 0xFD, 0x9D, 0xA7, 0x09, 0x99, 0x73,
+    0x77, 0x77, 0x6E, 0xA1, 0x9C, 0x77, 0x1A, 0xC9, 0x9C, 0x90, 0xAC, 0x77, 0x1C, 0xA1, 0xAE, 0x77,
+    0x2C, 0x92, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0x69, 0xEA, 0x7A, 0xE9, 0x0A,
+    0xC5, 0xAE, 0x97, 0xF0, 0x9D, 0x5F, 0x70, 0xFE, 0x95, 0xF7, 0x9E, 0xAA, 0xA6, 0x9E, 0x97, 0xAE,
+    0x71, 0xAE, 0x70, 0xF7, 0x1A, 0xE7, 0x0E, 0xA7, 0x1E, 0xA7, 0x9E, 0x97, 0x1E, 0x70, 0xAE, 0x71,
+    0x9E, 0x70, 0xEA, 0x71, 0xAD, 0xA7, 0x0E, 0x97, 0x1E, 0x97, 0x9E, 0x72, 0xE7, 0x0A, 0xDA, 0x71,
+    0x9E, 0x70, 0xE9, 0x71, 0xAE, 0x7A, 0xE7, 0x2F, 0x95, 0xAE, 0xA7, 0x2F, 0xDA, 0xAA, 0xFD, 0x73,
+    0xFF, 0xFD, 0xA7, 0x3F, 0xFF, 0xD7, 0x49, 0xFF, 0xF9, 0x75, 0x9F, 0xFC, 0xA7, 0x77, 0x77, 0x77,
+    0x7A, 0xE2, 0xC9, 0x79, 0xC9, 0x0C, 0xA0, 0xAC, 0x70, 0xD1, 0x9E, 0x97, 0x0A, 0xA3, 0x99, 0x77,
+    0x77, 0x69, 0x77, 0x0C, 0x92, 0xD6, 0xDA, 0x9C, 0x29, 0xD6, 0xDA, 0xCA, 0x2A, 0xD5, 0xAF, 0x3D,
+    0xA5, 0xE9, 0x4D, 0x95, 0xDA, 0x49, 0xD5, 0x9D, 0x94, 0x9D, 0x5A, 0xD5, 0xAD, 0x5E, 0x5D, 0xA4,
+    0xAD, 0xA5, 0xE3, 0xAE, 0xA5, 0xFF, 0xE9, 0x5F, 0xFE, 0x6F, 0xFE, 0x69, 0xFD, 0x9D, 0xA7, 0x09,
+    0x99, 0x73, 0x77, 0x79, 0x69, 0xEA, 0x7A, 0xE9, 0x0A, 0xC5, 0xAE, 0x97, 0xF0, 0x9D, 0x5F, 0x70,
+    0xFE, 0x95, 0xF7, 0x9E, 0xAA, 0xA6, 0x9E, 0x97, 0xAE, 0x71, 0xAE, 0x70, 0xF7, 0x1A, 0xE7, 0x0E,
+    0xA7, 0x1E, 0xA7, 0x9E, 0x97, 0x1E, 0x70, 0xAE, 0x71, 0x9E, 0x70, 0xEA, 0x71, 0xAD, 0xA7, 0x0E,
+    0x97, 0x1E, 0x97, 0x9E, 0x72, 0xE7, 0x0A, 0xDA, 0x71, 0x9E, 0x70, 0xE9, 0x71, 0xAE, 0x7A, 0xE7,
+    0x2F, 0x95, 0xAE, 0xA7, 0x2F, 0xDA, 0xAA, 0xFD, 0x73, 0xFF, 0xFD, 0xA7, 0x3F, 0xFF, 0xD7, 0x49,
+    0xFF, 0xF9, 0x75, 0x9F, 0xFC, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0xE7, 0x76, 0xAD, 0xA7,
+    0x76, 0xEA, 0x77, 0x59, 0xE9, 0x77, 0x10, 0x77, 0x97, 0x70, 0xC9, 0x2D, 0x6D, 0xA9, 0xC2, 0x9D,
+    0x6D, 0xAC, 0xA2, 0xAD, 0x5A, 0xF3, 0xDA, 0x5E, 0x94, 0xD9, 0x5D, 0xA4, 0x9D, 0x59, 0xD9, 0x49,
+    0xD5, 0xAD, 0x5A, 0xD5, 0xE5, 0xDA, 0x4A, 0xDA, 0x5E, 0x3A, 0xEA, 0x5F, 0xFE, 0x95, 0xFF, 0xE6,
+    0xFF, 0xE6, 0x9F, 0xD9, 0xDA, 0x70, 0x99, 0x97, 0x77, 0x79, 0xDA, 0x75, 0xE9, 0x74, 0x9E, 0x97,
+    0x4A, 0xE7, 0x77, 0x60, 0x69, 0x97, 0x7D, 0xA7, 0x7E, 0x76, 0x9E, 0x77, 0x09, 0x77, 0x77, 0x77,
+    0x74, 0xE7, 0x1A, 0xD9, 0x0E, 0x97, 0x9D, 0xA1, 0xAD, 0xA6, 0x9E, 0x29, 0xE6, 0xE3, 0x9E, 0x5E,
+    0x94, 0xE9, 0x3E, 0xA5, 0xF2, 0xAE, 0x6A, 0xE1, 0x9E, 0x79, 0xE9, 0x9E, 0x97, 0x0F, 0xEA, 0x71,
+    0xFE, 0x72, 0xFD, 0x73, 0xAF, 0x97, 0x39, 0xEA, 0x74, 0xAE, 0x75, 0xF7, 0x4A, 0xEA, 0x74, 0xF9,
+    0x73, 0xAF, 0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x30, 0x70, 0x99, 0x97, 0x70, 0xD9, 0x77, 0x9D, 0xA7,
+    0x7A, 0xDA, 0x77, 0x19, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4D, 0x96, 0xAD, 0x5D, 0xA6, 0xD9, 0x5A,
+    0xD5, 0xAD, 0x69, 0xD9, 0x39, 0xD9, 0x7D, 0xA3, 0xE7, 0x0E, 0x29, 0xD9, 0x70, 0xAD, 0x91, 0xE7,
+    0x19, 0xDA, 0x0A, 0xD9, 0x72, 0xE0, 0xE7, 0x3F, 0xD9, 0x73, 0xAF, 0xC7, 0x49, 0xF9, 0x74, 0x9F,
+    0x75, 0x9E, 0x97, 0x5F, 0x75, 0xF7, 0x4A, 0xF9, 0x71, 0xFE, 0xA7, 0x19, 0xFD, 0x97, 0x2A, 0xF9,
+    0x77, 0x77, 0x3E, 0x71, 0xAD, 0x93, 0xE9, 0x79, 0xDA, 0x4A, 0xDA, 0x69, 0xE5, 0x9E, 0x6E, 0x69,
+    0xE5, 0xE9, 0x7E, 0x93, 0xEA, 0x70, 0xF2, 0xAE, 0x71, 0xAE, 0x19, 0xE7, 0x29, 0xE9, 0x9E, 0x97,
+    0x3F, 0xEA, 0x74, 0xFE, 0x75, 0xFD, 0x76, 0xAF, 0x97, 0x69, 0xEA, 0x77, 0xAE, 0x77, 0x0F, 0x77,
+    0xAE, 0xA7, 0x7F, 0x97, 0x6A, 0xF7, 0x7F, 0xC7, 0x69, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x0A, 0xD9, 0x77, 0x0E, 0x77, 0x0A, 0xE7, 0x70, 0xF7, 0x70, 0x4D, 0x96,
+    0xAD, 0x5D, 0xA6, 0xD9, 0x5A, 0xD5, 0xAD, 0x69, 0xD9, 0x39, 0xD9, 0x7D, 0xA3, 0xE7, 0x0E, 0x29,
+    0xD9, 0x70, 0xAD, 0x91, 0xE7, 0x19, 0xDA, 0x0A, 0xD9, 0x72, 0xE0, 0xE7, 0x3F, 0xD9, 0x73, 0xAF,
+    0xC7, 0x49, 0xF9, 0x74, 0x9F, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0xF7, 0x4A, 0xF9, 0x71, 0xFE, 0xA3,
+    0xE2, 0x9F, 0xD9, 0x39, 0xDA, 0x2A, 0xF9, 0x5E, 0xA7, 0x59, 0xE9, 0x77, 0x50, 0x70, 0x9E, 0xA7,
+    0x49, 0x2C, 0x76, 0x9D, 0x75, 0x9C, 0x97, 0x69, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0xE7,
+    0x1A, 0xD9, 0x0E, 0x97, 0x9D, 0xA1, 0xAD, 0xA6, 0x9E, 0x29, 0xE6, 0xE3, 0x9E, 0x5E, 0x94, 0xE9,
+    0x3E, 0xA5, 0xF2, 0xAE, 0x6A, 0xE1, 0x9E, 0x79, 0xE9, 0x9E, 0x97, 0x0F, 0xEA, 0x71, 0xFE, 0x72,
+    0xFD, 0x73, 0xAF, 0x97, 0x39, 0xEA, 0x74, 0xAE, 0x75, 0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x73, 0xAF,
+    0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x30, 0x73, 0x9A, 0xD9, 0x75, 0x91, 0xAC, 0x77, 0x9C, 0xA7, 0x6A,
+    0xC9, 0x77, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3D, 0x96, 0xAD, 0x5D, 0xA6, 0xD9,
+    0x5A, 0xD5, 0xAD, 0x69, 0xD9, 0x39, 0xD9, 0x7D, 0xA3, 0xE7, 0x0E, 0x29, 0xD9, 0x70, 0xAD, 0x91,
+    0xE7, 0x19, 0xDA, 0x0A, 0xD9, 0x72, 0xE0, 0xE7, 0x3F, 0xD9, 0x73, 0xAF, 0xC7, 0x49, 0xF9, 0x74,
+    0x9F, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0xF7, 0x4A, 0xF9, 0x71, 0xFE, 0xA7, 0x19, 0xFD, 0x97, 0x2A,
+    0xF9, 0x77, 0x77, 0x69, 0xD9, 0x2C, 0x97, 0x0C, 0xAA, 0xC1, 0x9C, 0x70, 0xAC, 0x1C, 0xA0, 0xD7,
+    0x0C, 0xA1, 0x9E, 0x71, 0x94, 0x97, 0x77, 0x77, 0x77, 0x77, 0x5E, 0x71, 0xAD, 0x90, 0xE9, 0x79,
+    0xDA, 0x1A, 0xDA, 0x69, 0xE2, 0x9E, 0x6E, 0x39, 0xE5, 0xE9, 0x4E, 0x93, 0xEA, 0x5F, 0x2A, 0xE6,
+    0xAE, 0x19, 0xE7, 0x9E, 0x99, 0xE9, 0x70, 0xFE, 0xA7, 0x1F, 0xE7, 0x2F, 0xD7, 0x3A, 0xF9, 0x73,
+    0x9E, 0xA7, 0x4A, 0xE7, 0x5F, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x3A, 0xF7, 0x4F, 0xC7, 0x39, 0xFA,
+    0x73, 0x71, 0xAD, 0x29, 0xC7, 0x19, 0xCA, 0xAC, 0x1A, 0xC7, 0x1C, 0xA1, 0xC9, 0x0C, 0x97, 0x09,
+    0xC9, 0x1A, 0xE7, 0x29, 0x39, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xD9, 0x6A, 0xD5, 0xDA,
+    0x6D, 0x95, 0xAD, 0x5A, 0xD6, 0x9D, 0x93, 0x9D, 0x97, 0xDA, 0x3E, 0x70, 0xE2, 0x9D, 0x97, 0x0A,
+    0xD9, 0x1E, 0x71, 0x9D, 0xA0, 0xAD, 0x97, 0x2E, 0x0E, 0x73, 0xFD, 0x97, 0x3A, 0xFC, 0x74, 0x9F,
+    0x97, 0x49, 0xF7, 0x59, 0xE9, 0x75, 0xF7, 0x5F, 0x74, 0xAF, 0x97, 0x1F, 0xEA, 0x71, 0x9F, 0xD9,
+    0x72, 0xAF, 0x97, 0x77, 0x70, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFE, 0x09, 0xFF, 0xE0,
+    0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFE, 0x09, 0xFF, 0xE0, 0x09, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFA, 0x09, 0xFF, 0xFF, 0x90, 0x19, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x5F, 0xFF, 0xF1, 0xFF, 0xFE, 0x97, 0x72, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x97, 0x0F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFE, 0xA7, 0x77, 0x20, 0x19, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x97, 0x0F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFE, 0xA7, 0x77, 0x20, 0x77, 0x7D,
+    0x4A, 0xC7, 0xCA, 0x4D, 0x69, 0xC9, 0x39, 0xC9, 0x6D, 0x4A, 0xC7, 0xCA, 0x4D, 0x69, 0xC9, 0x4C,
+    0xA6, 0xAC, 0x49, 0xC9, 0x6D, 0x4A, 0xC6, 0x9C, 0x94, 0xCA, 0x6A, 0xC4, 0x9C, 0x96, 0xD4, 0xAC,
+    0x7C, 0xA4, 0xD6, 0x9C, 0x94, 0xCA, 0x6D, 0x4A, 0xC7, 0xCA, 0x4D, 0x69, 0xC9, 0x4C, 0xA6, 0xAC,
+    0x49, 0xC9, 0x6D, 0x4A, 0xC6, 0x9C, 0x94, 0xCA, 0x6A, 0xC4, 0x9C, 0x96, 0xD4, 0xAC, 0x60, 0x2A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xC9, 0x77,
+    0x77, 0x73, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x2F, 0xFF, 0xFC, 0x91, 0xAF,
+    0xFF, 0xFC, 0x20, 0xAE, 0xA3, 0xF3, 0x9E, 0x93, 0xEA, 0x39, 0xE4, 0xF3, 0x9E, 0x90, 0x72, 0xF9,
+    0x2F, 0x2A, 0xE9, 0x2F, 0x29, 0xE3, 0xEA, 0x2A, 0xE3, 0x39, 0x99, 0x92, 0xF9, 0x2F, 0x2A, 0xE9,
+    0x2F, 0x29, 0xE9, 0x2F, 0x2A, 0xE9, 0x20, 0xAE, 0xA3, 0xF3, 0x9E, 0x93, 0xEA, 0x39, 0xE4, 0xF3,
+    0x9E, 0x90, 0xAE, 0xA0, 0xAE, 0x93, 0xF1, 0xF3, 0x9E, 0x90, 0xAE, 0x93, 0xEA, 0x1E, 0xA3, 0x9E,
+    0x1A, 0xE4, 0xF1, 0xEA, 0x39, 0xE9, 0x09, 0xE9, 0x2F, 0x90, 0xF9, 0x2F, 0x09, 0xF2, 0xAE, 0x90,
+    0xAE, 0x3F, 0x1E, 0xA2, 0x9E, 0x19, 0xE3, 0xEA, 0x1E, 0xA2, 0xAE, 0x1A, 0xE3, 0x39, 0x99, 0x92,
+    0xF9, 0x2F, 0x2A, 0xE9, 0x2F, 0x29, 0xE9, 0x2F, 0x2A, 0xE9, 0x20, 0x9F, 0x09, 0xEA, 0x3F, 0x1F,
+    0x39, 0xEA, 0x09, 0xEA, 0x3F, 0x1F, 0x4E, 0x90, 0x9E, 0x93, 0xAE, 0x1A, 0xE4, 0xEA, 0x1E, 0xA7,
+    0x50, 0x7A, 0xC9, 0x72, 0xD7, 0x3D, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x72, 0x9D, 0x72, 0xAC,
+    0xA7, 0x2D, 0x97, 0x2D, 0x69, 0xFF, 0xE1, 0xFF, 0xF5, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x2A, 0xCA,
+    0x72, 0xD9, 0x72, 0xD7, 0x29, 0xCA, 0x72, 0xAC, 0x97, 0x2D, 0x73, 0xD7, 0x29, 0xCA, 0x72, 0xAC,
+    0x97, 0x2D, 0x73, 0xD7, 0x29, 0xCA, 0x72, 0xAC, 0x97, 0x2A, 0xC7, 0x39, 0xC7, 0x4A, 0x77, 0x70,
+    0x71, 0x9C, 0xA7, 0x4A, 0xC9, 0x74, 0xD7, 0x49, 0xD7, 0x4A, 0xCA, 0x74, 0xD9, 0x74, 0xD7, 0x49,
+    0xD7, 0x4A, 0xCA, 0x74, 0xD9, 0x70, 0xFF, 0xE3, 0xFF, 0xF9, 0x6A, 0xCA, 0x74, 0xD9, 0x74, 0xD7,
+    0x49, 0xD7, 0x4A, 0xCA, 0x74, 0xD9, 0x74, 0xD7, 0x49, 0xD7, 0x0F, 0xFD, 0x4A, 0xFF, 0xD7, 0x1D,
+    0x74, 0x9C, 0xA7, 0x4A, 0xC9, 0x74, 0xD7, 0x5D, 0x74, 0x9C, 0xA7, 0x49, 0xC9, 0x75, 0xC7, 0x6A,
+    0x77, 0x72, 0x77, 0x69, 0xFF, 0xC6, 0xFF, 0xD5, 0x9F, 0xFD, 0x5F, 0xFD, 0xA4, 0x9F, 0xFD, 0xA4,
+    0xAF, 0xFD, 0x94, 0xFF, 0xE9, 0x3A, 0xFF, 0xE4, 0xFF, 0xF3, 0xAF, 0xFF, 0x3F, 0xFF, 0xC2, 0xAF,
+    0xFF, 0xA2, 0xFF, 0xFC, 0xA1, 0xAF, 0xFF, 0xC9, 0x10, 0x79, 0xA4, 0xAD, 0xA2, 0xFC, 0x09, 0xFC,
+    0x9A, 0xE9, 0x1A, 0xC9, 0x72, 0x6E, 0x0A, 0xDA, 0x0E, 0xAA, 0xE9, 0x6E, 0x0A, 0xDA, 0x0E, 0xAA,
+    0xE9, 0x77, 0x7E, 0x49, 0xDA, 0x4E, 0x0A, 0xDA, 0x4E, 0x93, 0xAD, 0xA0, 0xEA, 0x39, 0xE9, 0x3E,
+    0xAA, 0xE9, 0x3A, 0xE3, 0x9E, 0x90, 0x9A, 0xA0, 0xAD, 0x0A, 0xD0, 0x77, 0x77, 0x49, 0xC9, 0x5A,
+    0x9A, 0x7C, 0x95, 0xA1, 0x96, 0xCA, 0x6C, 0x09, 0xA5, 0xD6, 0x9A, 0x90, 0xC4, 0xD7, 0xA9, 0x09,
+    0xA3, 0xAC, 0x70, 0xAC, 0xAC, 0x92, 0xAC, 0x97, 0x1D, 0x92, 0x9C, 0xA7, 0x79, 0xCA, 0x77, 0x0D,
+    0x77, 0x0D, 0x77, 0x0D, 0x97, 0x7A, 0xC9, 0x77, 0xAC, 0xA7, 0x79, 0xD7, 0x79, 0xD0, 0x99, 0x09,
+    0x0A, 0x0A, 0x7D, 0x1A, 0xA0, 0x9A, 0x99, 0xA6, 0xD9, 0x1A, 0x0A, 0x0C, 0x09, 0xA5, 0xDA, 0x19,
+    0xC9, 0xC0, 0xC9, 0xC5, 0xAC, 0xA3, 0xD1, 0xAC, 0x95, 0x99, 0x77, 0x00, 0x72, 0xF9, 0x2F, 0x2A,
+    0xE9, 0x2F, 0x29, 0xE3, 0xEA, 0x2A, 0xE3, 0x2F, 0x90, 0xF9, 0x2F, 0x09, 0xF2, 0xAE, 0x90, 0xAE,
+    0x3F, 0x1E, 0xA2, 0x9E, 0x19, 0xE3, 0xEA, 0x1E, 0xA2, 0xAE, 0x1A, 0xE3, 0x77, 0x3A, 0xA4, 0xC9,
+    0x3C, 0x92, 0xDA, 0x29, 0xD2, 0x9D, 0x90, 0x9D, 0x3D, 0xA2, 0xAD, 0x1A, 0xCA, 0x3D, 0x3D, 0x91,
+    0xD3, 0x9C, 0xA3, 0xD2, 0xC9, 0x3A, 0xA3, 0x9C, 0x97, 0x73, 0x59, 0xC2, 0xD9, 0x1A, 0xCA, 0x2D,
+    0x2A, 0xC9, 0x2A, 0xA0, 0x73, 0x9C, 0x29, 0xC9, 0x2D, 0xA1, 0xDA, 0x2A, 0xD1, 0x9D, 0x3D, 0x2D,
+    0x92, 0xAC, 0x91, 0x9C, 0xA3, 0xAA, 0x2A, 0xC0, 0x77, 0x29, 0xC3, 0x9C, 0x93, 0xAC, 0x2D, 0x92,
+    0xDA, 0x29, 0xD2, 0xAC, 0xA2, 0x9D, 0x3D, 0x92, 0xD3, 0xD3, 0x9D, 0x2A, 0xC9, 0x29, 0xCA, 0x3D,
+    0x3C, 0xA3, 0xAA, 0x39, 0xC9, 0x77, 0x10, 0x4A, 0xC7, 0xAD, 0x94, 0x9D, 0x0D, 0x92, 0xAD, 0x19,
+    0xD9, 0x73, 0x77, 0xC9, 0x49, 0xD4, 0xAC, 0xA3, 0x9D, 0x93, 0xAD, 0x5E, 0x5A, 0xE5, 0xEA, 0x5E,
+    0x59, 0xC9, 0x6A, 0x30, 0x71, 0xC9, 0x6A, 0xCA, 0x69, 0xD9, 0x6D, 0xA6, 0xAD, 0x5A, 0xDA, 0x39,
+    0xE4, 0xE9, 0x3A, 0xDA, 0x5D, 0x6A, 0x30, 0x77, 0x77, 0x77, 0x5D, 0xA7, 0x7F, 0x7A, 0xDA, 0x09,
+    0xE7, 0x29, 0xE9, 0x6E, 0xAA, 0xE7, 0x4F, 0x5A, 0xFD, 0xA7, 0x59, 0xE9, 0x69, 0xEA, 0x77, 0xF5,
+    0x9E, 0x97, 0x70, 0xAE, 0xA3, 0xAE, 0x97, 0x72, 0xF2, 0xF9, 0x77, 0x3A, 0xEA, 0x0F, 0x77, 0x2D,
+    0xA0, 0xFF, 0x77, 0x2A, 0xDA, 0x0F, 0xDA, 0x79, 0xD9, 0x7E, 0x90, 0x9F, 0xC7, 0x0E, 0x96, 0xAE,
+    0x99, 0xFD, 0x79, 0xE7, 0x3A, 0xFE, 0xA6, 0xF7, 0x2F, 0xFD, 0x77, 0x39, 0xFC, 0x0A, 0xFA, 0x77,
+    0x1A, 0xFC, 0x2F, 0xC9, 0x77, 0xAF, 0xA3, 0xAF, 0xC7, 0x6F, 0xCA, 0x5F, 0xC9, 0x73, 0x9F, 0xC9,
+    0x6A, 0xFC, 0x72, 0xAF, 0xC9, 0x59, 0xFE, 0xA7, 0x0F, 0xD7, 0xFF, 0xC7, 0x75, 0x9E, 0x77, 0x73,
+    0xF7, 0x77, 0x77, 0x50, 0x71, 0x99, 0x70, 0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x79, 0xD7,
+    0x0A, 0xD7, 0x0D, 0xA7, 0x9D, 0x97, 0xAD, 0x70, 0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x9D, 0xA7,
+    0xAD, 0x97, 0xE7, 0x0E, 0x77, 0x76, 0xEA, 0x69, 0xEA, 0x6F, 0x95, 0x9F, 0x95, 0xAF, 0x60, 0x77,
+    0x71, 0xAC, 0x97, 0x5D, 0x74, 0x9A, 0xDA, 0xA7, 0x09, 0xFF, 0x95, 0xAF, 0xFD, 0x94, 0xAC, 0x90,
+    0xD9, 0x0A, 0xDA, 0x79, 0xD2, 0xE7, 0xAD, 0x2E, 0x7D, 0xA2, 0xDA, 0x7D, 0x91, 0x9D, 0x96, 0x9D,
+    0x91, 0xE7, 0xAD, 0x1A, 0xD9, 0x7E, 0x09, 0xDA, 0x70, 0xDA, 0xAE, 0x70, 0xAF, 0xD7, 0x1F, 0xD7,
+    0x2F, 0xA7, 0x29, 0xE7, 0x4A, 0xE7, 0x4E, 0x97, 0x4E, 0x74, 0x9E, 0x74, 0x99, 0x77, 0x76, 0xAE,
+    0x74, 0xEA, 0x73, 0xAE, 0xA7, 0x3F, 0x97, 0x29, 0xF9, 0x72, 0xAF, 0x73, 0x09, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x0A, 0x95, 0x99, 0x0C, 0xA5, 0xC9, 0x0D, 0xA9, 0x09,
+    0xAD, 0x19, 0xFE, 0x39, 0xEA, 0x92, 0x71, 0x97, 0x70, 0xC7, 0x5C, 0x90, 0xC0, 0xAC, 0x72, 0xAF,
+    0x97, 0x49, 0xD9, 0x73, 0x9C, 0xAC, 0x9D, 0x72, 0xA1, 0xC1, 0x97, 0x49, 0xA2, 0x97, 0x0C, 0x6C,
+    0x59, 0x09, 0xC1, 0xA9, 0xC1, 0xC0, 0xAC, 0x1A, 0xCA, 0xAA, 0xAC, 0x90, 0xAF, 0x94, 0xAD, 0x93,
+    0x9D, 0x94, 0x9E, 0xA9, 0x09, 0xCA, 0xC9, 0xD2, 0xCA, 0x9C, 0x0A, 0xC0, 0xA1, 0xC1, 0x94, 0x9A,
+    0x59, 0xA7, 0x97, 0x50, 0x77, 0x09, 0xC9, 0x77, 0x0C, 0xA7, 0x70, 0xCA, 0x77, 0x0D, 0x77, 0x0A,
+    0xC7, 0x70, 0xAC, 0x77, 0x0A, 0xC9, 0x77, 0x9C, 0xA7, 0x79, 0xCA, 0x77, 0x0D, 0x77, 0x0D, 0x77,
+    0x0D, 0x77, 0x0D, 0x97, 0x7A, 0xCA, 0x77, 0xAC, 0xA7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x70,
+    0xD9, 0x77, 0xDA, 0x77, 0x77, 0x77, 0x29, 0xAF, 0xCA, 0x59, 0xFD, 0x96, 0xAF, 0xFC, 0x3F, 0xFC,
+    0xA4, 0xAD, 0xA2, 0x9E, 0xA1, 0xE9, 0x2A, 0xE9, 0x39, 0xA6, 0xE1, 0x9A, 0x59, 0xDA, 0x74, 0xE7,
+    0x2E, 0x74, 0xE7, 0x2E, 0x74, 0xDA, 0x71, 0x9D, 0xA7, 0x3A, 0xD9, 0x71, 0xAD, 0x74, 0xDA, 0x71,
+    0x9D, 0xA7, 0x3E, 0x72, 0xE7, 0x3E, 0x97, 0x1E, 0x97, 0x19, 0xE9, 0x70, 0x9E, 0x97, 0x09, 0xF9,
+    0x79, 0xF9, 0x70, 0xFC, 0x97, 0xFC, 0x71, 0x9E, 0xA7, 0x09, 0xEA, 0x72, 0xAE, 0x71, 0xAE, 0x73,
+    0xEA, 0x71, 0xEA, 0x73, 0xE9, 0x71, 0xE9, 0x72, 0x9E, 0x71, 0x9E, 0x73, 0x9A, 0x99, 0x71, 0x9A,
+    0xA9, 0x77, 0x77, 0x77, 0x77, 0x7E, 0x72, 0xDA, 0x73, 0xAD, 0xA7, 0x1A, 0xDA, 0x73, 0xEA, 0x71,
+    0xE9, 0x72, 0x9E, 0x97, 0x0A, 0xE9, 0x77, 0x77, 0x70, 0x77, 0x72, 0xAF, 0xA7, 0x4A, 0xFF, 0x97,
+    0x1A, 0xDA, 0x99, 0x9F, 0x93, 0xAC, 0x2A, 0xC5, 0xAD, 0xA2, 0xAC, 0xA7, 0x3E, 0x2D, 0x97, 0x3E,
+    0x19, 0xD7, 0x4D, 0xA1, 0xAD, 0x73, 0xAD, 0x91, 0xDA, 0x73, 0xE1, 0x9D, 0x73, 0xAD, 0x91, 0xAD,
+    0x72, 0xAD, 0xA2, 0xDA, 0x71, 0xAD, 0xA2, 0x9D, 0x97, 0x9F, 0x3A, 0xD6, 0x9F, 0xA4, 0xE5, 0x9F,
+    0xA4, 0x9D, 0xA5, 0xAE, 0x6A, 0xD9, 0x5E, 0xA6, 0xE6, 0xE9, 0x59, 0xE5, 0x9E, 0x6A, 0xDA, 0x5A,
+    0xE6, 0xAD, 0x95, 0x99, 0x97, 0x77, 0x77, 0x79, 0xE7, 0xDA, 0x5F, 0x6A, 0xD9, 0x49, 0xF6, 0xE9,
+    0x4F, 0xA5, 0xAE, 0x49, 0xFA, 0x50, 0x77, 0x77, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xF9, 0x76, 0xEA,
+    0x99, 0x9F, 0x74, 0x90, 0xAA, 0x5A, 0xDA, 0x72, 0xD7, 0x1D, 0xA7, 0x1A, 0xCA, 0x71, 0xDA, 0x71,
+    0xD9, 0x70, 0x9D, 0x97, 0x1D, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0xDA, 0x71, 0xDA, 0x70, 0xE7, 0x2D,
+    0x97, 0xE9, 0x71, 0xAD, 0x7E, 0xA7, 0x2E, 0x5A, 0xEA, 0x73, 0xDA, 0x3A, 0xF9, 0x73, 0xAD, 0x92,
+    0x9F, 0x75, 0xE3, 0xAE, 0x76, 0xDA, 0x3E, 0xA7, 0x5A, 0xD9, 0x3E, 0x97, 0x5E, 0x39, 0xE7, 0x6E,
+    0x3A, 0xDA, 0x75, 0xAD, 0xA7, 0x76, 0x9A, 0x97, 0x77, 0x77, 0x6E, 0x93, 0x9D, 0xA7, 0x4A, 0xE4,
+    0xE9, 0x74, 0xF3, 0x9E, 0x97, 0x3A, 0xF3, 0xF7, 0x4F, 0xC7, 0x77, 0x77, 0x50, 0x77, 0x69, 0x77,
+    0x59, 0xC9, 0x77, 0x5D, 0x77, 0x5A, 0xC9, 0x77, 0x5D, 0x77, 0x5D, 0x97, 0x74, 0x9C, 0xA7, 0x75,
+    0xD7, 0x75, 0x9C, 0xA7, 0x69, 0xD9, 0x2D, 0x77, 0xE9, 0x1A, 0xCA, 0x76, 0x9E, 0x91, 0xD7, 0x7F,
+    0x1A, 0xC9, 0x77, 0x49, 0xD7, 0x75, 0xD9, 0x77, 0x49, 0xD7, 0x75, 0xD9, 0x77, 0x4A, 0xD7, 0x75,
+    0xD9, 0x77, 0x4A, 0xCA, 0x77, 0x5D, 0x77, 0x5D, 0xA7, 0x74, 0x9D, 0x77, 0x5D, 0xA0, 0xAD, 0x97,
+    0x79, 0xD1, 0xE7, 0x70, 0xD9, 0x0A, 0xE7, 0x7A, 0xD1, 0xF7, 0x7D, 0x97, 0x74, 0xAD, 0x77, 0x49,
+    0xD9, 0x77, 0x4E, 0x77, 0x49, 0xD7, 0x75, 0xDA, 0x77, 0x4A, 0xD7, 0x75, 0xDA, 0x77, 0x4A, 0xD7,
+    0x75, 0xD9, 0x77, 0x4C, 0xA7, 0x76, 0x97, 0x76, 0x39, 0x94, 0xA9, 0x0A, 0x2A, 0x91, 0x99, 0x1C,
+    0x2A, 0x90, 0x9A, 0x0C, 0x0A, 0x90, 0xC9, 0x0A, 0x0C, 0x1C, 0x91, 0xAC, 0x1C, 0xA0, 0xAC, 0x91,
+    0xFC, 0x29, 0xDA, 0x20, 0x59, 0x5A, 0xA4, 0xAC, 0xA3, 0xAC, 0xA9, 0x2A, 0xC0, 0xC2, 0xAC, 0x09,
+    0xC2, 0xFD, 0x4C, 0xA5, 0xC9, 0x4A, 0xC9, 0x10, 0x2F, 0xA1, 0x99, 0x5A, 0x95, 0xC5, 0x9E, 0xA6,
+    0xAC, 0x5A, 0xC1, 0x91, 0x9C, 0xA0, 0x9F, 0xC1, 0x9A, 0xDA, 0x20, 0x3A, 0xE3, 0xC9, 0x5C, 0x95,
+    0x9C, 0xAD, 0x92, 0xD9, 0x09, 0xC2, 0xC9, 0x2C, 0x2C, 0x90, 0x9C, 0xA2, 0xAF, 0x49, 0xA9, 0x30,
+    0x9F, 0xCA, 0x4C, 0x93, 0xAC, 0x4C, 0x93, 0xAC, 0x4C, 0xA3, 0xAC, 0x39, 0xD3, 0xD9, 0x3A, 0xA3,
+    0x39, 0xA9, 0x4C, 0x90, 0x9A, 0x2A, 0xA1, 0x9A, 0x2A, 0xA0, 0x9C, 0x93, 0xE3, 0x9C, 0x90, 0xAC,
+    0x2C, 0x91, 0x9C, 0x19, 0xC2, 0xAC, 0x19, 0xCA, 0x0A, 0xC9, 0x2A, 0xE9, 0x20, 0x29, 0xE3, 0xAA,
+    0x1A, 0xA2, 0xC2, 0x9C, 0x19, 0xC2, 0xAA, 0x19, 0xC9, 0x9A, 0xCA, 0x2A, 0xF6, 0x9C, 0x2C, 0xAA,
+    0xD9, 0x2F, 0x92, 0x39, 0xC9, 0x0A, 0xAD, 0xA6, 0xAF, 0xFC, 0x5F, 0xA9, 0x09, 0xD9, 0x39, 0xE4,
+    0xDA, 0x3A, 0xD9, 0x4D, 0xA3, 0xE5, 0xD9, 0x29, 0xD9, 0x49, 0xD9, 0x2A, 0xD5, 0xAD, 0x3E, 0x5E,
+    0x29, 0xE4, 0x9D, 0xA2, 0xAD, 0xA4, 0xAD, 0xA2, 0xE9, 0x4E, 0x91, 0x9E, 0x5E, 0x2A, 0xE4, 0x9E,
+    0x20, 0x4A, 0xAA, 0xA6, 0xCA, 0x2C, 0x4D, 0x3C, 0x39, 0xC4, 0xC9, 0x2D, 0x09, 0xC1, 0xC9, 0x2C,
+    0xA0, 0xD0, 0x9C, 0x2A, 0xC9, 0x0C, 0xA0, 0xAC, 0x2A, 0xC1, 0x91, 0xCA, 0x2D, 0x3D, 0x92, 0xDA,
+    0x09, 0xE3, 0xFE, 0x93, 0xAF, 0xC9, 0x5A, 0xDA, 0x94, 0x39, 0x92, 0xDA, 0x3C, 0x93, 0xC3, 0xAC,
+    0x3C, 0xA3, 0xC9, 0x29, 0xC1, 0x9F, 0xAF, 0xCA, 0x72, 0x9A, 0xE3, 0x99, 0x1A, 0xA6, 0xAA, 0x6C,
+    0x94, 0x9C, 0xA4, 0xAC, 0xA3, 0x9D, 0x93, 0x9F, 0xC9, 0x1F, 0xD2, 0x2A, 0xDA, 0x79, 0xA6, 0xA9,
+    0x3E, 0xA6, 0xA9, 0x6A, 0xC6, 0xCA, 0x19, 0xFC, 0x29, 0xEA, 0x30, 0x59, 0x5A, 0xC4, 0xAC, 0xA3,
+    0xAC, 0xA9, 0x2A, 0xC0, 0xC2, 0xAC, 0x09, 0xC9, 0x1F, 0xD4, 0xCA, 0x5C, 0xA4, 0xAC, 0x91, 0x71,
+    0x9F, 0x2C, 0x6C, 0x59, 0xEA, 0x6C, 0x95, 0xC9, 0x19, 0x1A, 0xC1, 0x9F, 0xA1, 0x9A, 0xCA, 0x92,
+    0x3A, 0xE3, 0xC9, 0x5C, 0x95, 0x9C, 0xAD, 0x92, 0xD9, 0x09, 0xC2, 0xCA, 0x2C, 0x2C, 0x2A, 0xC2,
+    0xDA, 0xD9, 0x29, 0xE9, 0x20, 0x69, 0xFC, 0x94, 0xC4, 0xCA, 0x39, 0xC4, 0xD3, 0x9C, 0x93, 0xD3,
+    0x9C, 0xA3, 0xD4, 0x99, 0x30, 0x39, 0xA9, 0x4C, 0x90, 0x9C, 0x2A, 0xA1, 0x9C, 0x2A, 0xA1, 0xC9,
+    0x3E, 0x92, 0x9C, 0x90, 0xAC, 0x2C, 0x92, 0xC1, 0x9C, 0x29, 0xC1, 0x9C, 0xA9, 0x9C, 0xA2, 0xAE,
+    0x92, 0x29, 0xE3, 0xAA, 0x1A, 0xA2, 0xC2, 0x9C, 0x19, 0xA2, 0xAA, 0x19, 0xC9, 0x09, 0xCA, 0x2A,
+    0xF6, 0x9C, 0x2C, 0xAA, 0xD9, 0x2F, 0x92, 0x72, 0xCA, 0x72, 0xDA, 0x71, 0xAC, 0xA7, 0x19, 0xD7,
+    0x2D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7, 0x2D, 0x72, 0xDA, 0x71, 0x9D, 0x72, 0xDA, 0x71, 0x9D, 0x72,
+    0xDA, 0x72, 0xD7, 0x2A, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2A, 0xCA, 0x72,
+    0xD9, 0x72, 0xD9, 0x72, 0xD9, 0x72, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x97, 0x2D, 0x97, 0x2D, 0x97,
+    0x2D, 0xA7, 0x2E, 0x72, 0xE7, 0x2A, 0xD7, 0x39, 0xA7, 0x10, 0x0D, 0x73, 0xAC, 0xA7, 0x3D, 0xA7,
+    0x3D, 0x97, 0x29, 0xD7, 0x3A, 0xD7, 0x3D, 0x97, 0x29, 0xD7, 0x3A, 0xCA, 0x73, 0xD9, 0x72, 0xAD,
+    0x73, 0xD9, 0x72, 0xDA, 0x72, 0x9D, 0x73, 0xD9, 0x72, 0xAC, 0xA7, 0x29, 0xD7, 0x3D, 0x73, 0xD9,
+    0x72, 0xAC, 0xA7, 0x2A, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29,
+    0xD7, 0x29, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0xA7, 0x19, 0xA9, 0x10,
+    0x77, 0x9C, 0xA1, 0x9C, 0xA7, 0x7D, 0x2D, 0x77, 0xAC, 0xA1, 0xAC, 0xA7, 0x7D, 0x2D, 0x77, 0xAC,
+    0xA1, 0xAC, 0xA7, 0x7F, 0xEA, 0x75, 0xAF, 0xFC, 0x73, 0xAF, 0xFD, 0x97, 0x2F, 0xCA, 0x1D, 0x97,
+    0x3F, 0xD1, 0x9D, 0x73, 0xFD, 0x91, 0xD9, 0x72, 0xF9, 0xD1, 0x9D, 0x72, 0x9E, 0x0D, 0x2D, 0x73,
+    0xE9, 0x9C, 0xA1, 0xAC, 0xA7, 0x2A, 0xE0, 0xD2, 0xD7, 0x3E, 0x9A, 0xCA, 0x1A, 0xCA, 0x72, 0x9E,
+    0x9D, 0x2D, 0x73, 0xAF, 0xC9, 0x1A, 0xC9, 0x73, 0xAF, 0xC1, 0x9D, 0x74, 0xFC, 0xA1, 0xD9, 0x74,
+    0xFE, 0xAD, 0x99, 0xAD, 0x70, 0xFF, 0xFD, 0xA7, 0x0A, 0xFF, 0xFC, 0x97, 0x1F, 0xFF, 0xC7, 0x19,
+    0xFF, 0xFC, 0x71, 0xD9, 0xAF, 0xFA, 0x97, 0x0A, 0xCA, 0x1A, 0xCA, 0x77, 0xD2, 0xD7, 0x7A, 0xCA,
+    0x1A, 0xCA, 0x77, 0xD2, 0xD7, 0x7A, 0xC9, 0x1A, 0xC9, 0x77, 0x77, 0x77, 0x29, 0xAF, 0xCA, 0x73,
+    0xAF, 0xFC, 0x71, 0xAF, 0xFD, 0x97, 0x9F, 0xA9, 0x75, 0x9F, 0x97, 0x69, 0xEA, 0x77, 0x0E, 0xA7,
+    0x70, 0xAE, 0x77, 0x09, 0xE7, 0x71, 0xAD, 0xA4, 0x9C, 0x9A, 0xD6, 0xE9, 0x4A, 0xFC, 0x59, 0xE5,
+    0xE9, 0x09, 0x5A, 0xE5, 0xD7, 0x1F, 0xA3, 0xAC, 0xA7, 0x1F, 0xCA, 0x2D, 0x91, 0x96, 0xFF, 0xAD,
+    0xAE, 0x6F, 0xFF, 0xDA, 0x6A, 0xFF, 0xFC, 0x97, 0xFF, 0xFC, 0x70, 0x9F, 0xFF, 0x72, 0xAF, 0xFA,
+    0x97, 0x77, 0x30, 0x77, 0x77, 0x77, 0x9A, 0xEA, 0x97, 0x19, 0xFF, 0xA7, 0xFA, 0x90, 0x9A, 0xD9,
+    0x59, 0xE6, 0xA6, 0xAD, 0x77, 0xAC, 0x97, 0x7A, 0xC9, 0x76, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0x69,
+    0xFF, 0xDA, 0x6A, 0xFF, 0xD9, 0x70, 0x9C, 0xA7, 0x79, 0xD7, 0x5F, 0xFE, 0x69, 0xFF, 0xDA, 0x79,
+    0x9A, 0xD9, 0x99, 0x99, 0x72, 0xE7, 0x6A, 0xDA, 0x75, 0xF7, 0x39, 0xFA, 0x73, 0x9F, 0xAA, 0xAA,
+    0xA9, 0x96, 0xAF, 0xFF, 0xC9, 0x3F, 0xFF, 0xE3, 0x77, 0x77, 0x09, 0x99, 0x97, 0x0E, 0x70, 0xF7,
+    0x9D, 0xA7, 0x9F, 0x7E, 0x97, 0xFC, 0x96, 0xE7, 0x0F, 0xC9, 0x5A, 0xDA, 0x79, 0xFC, 0xA5, 0xE9,
+    0x7F, 0xE5, 0xE7, 0x0E, 0x9E, 0x4A, 0xE7, 0xAE, 0x0E, 0x93, 0xE9, 0x7E, 0xA0, 0xEA, 0x29, 0xE7,
+    0x9E, 0x90, 0xEA, 0x2A, 0xE4, 0x9F, 0xFF, 0xFF, 0xD9, 0x0F, 0xFF, 0xFF, 0xE3, 0x9E, 0xA2, 0xE9,
+    0x0A, 0xE7, 0xAE, 0x92, 0xEA, 0x0E, 0x97, 0xF3, 0xAD, 0xA9, 0xE7, 0x9F, 0x39, 0xEA, 0xE7, 0xAE,
+    0xA4, 0xFD, 0xA7, 0xF9, 0x4F, 0xD7, 0x9F, 0x5F, 0xD7, 0xAF, 0x5A, 0xFA, 0x60, 0x6F, 0xFA, 0x72,
+    0x9F, 0xFD, 0x97, 0x0E, 0x99, 0x99, 0xAF, 0x70, 0xDA, 0x5A, 0xD9, 0x69, 0xD9, 0x6D, 0x92, 0x9F,
+    0xFF, 0xFD, 0x1A, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xEA, 0x94, 0x9D, 0xA4, 0x9E, 0xA6, 0xAF, 0xFF,
+    0x7F, 0xFE, 0xA7, 0x9F, 0xFC, 0x97, 0x1A, 0xDA, 0x77, 0x0E, 0x97, 0x79, 0xE7, 0x70, 0xAE, 0x77,
+    0x0E, 0xA7, 0x79, 0xE9, 0x77, 0xAE, 0x97, 0x7F, 0x77, 0x9F, 0x77, 0xAE, 0xA7, 0x70, 0x5F, 0xCA,
+    0x77, 0x49, 0xFE, 0x97, 0x72, 0xAC, 0x99, 0x99, 0xDA, 0x77, 0x2C, 0xA4, 0xD7, 0x72, 0xC9, 0x4D,
+    0x77, 0x19, 0xC5, 0xD7, 0x71, 0xAC, 0x4A, 0xD7, 0x71, 0xD3, 0xAD, 0x97, 0xAE, 0xA4, 0xDA, 0xAA,
+    0xF7, 0xFD, 0x3A, 0xFF, 0x96, 0xAC, 0x97, 0xFF, 0x70, 0xC9, 0x70, 0xFF, 0x97, 0xC9, 0x79, 0xE9,
+    0x1E, 0x7D, 0xA6, 0xAD, 0x93, 0xD7, 0xAE, 0xA4, 0xE3, 0x9D, 0x70, 0xAF, 0x3E, 0x39, 0xD7, 0x3D,
+    0x91, 0x9E, 0x3A, 0xD7, 0x3D, 0x91, 0xAD, 0xA3, 0xE6, 0xDA, 0xAE, 0x91, 0xE9, 0x3E, 0x5F, 0xF2,
+    0xE3, 0x9E, 0x4A, 0xFE, 0x91, 0x9E, 0x3A, 0xE5, 0xAF, 0xC9, 0x20, 0x3A, 0xC9, 0x72, 0xD4, 0xAC,
+    0x97, 0x19, 0xCA, 0x4A, 0xC9, 0x71, 0xAC, 0x94, 0xD7, 0x2D, 0x5D, 0x71, 0x9C, 0xA5, 0xD7, 0x1A,
+    0xC9, 0x5D, 0x3D, 0x3D, 0x4F, 0xFF, 0xFD, 0x1A, 0xFF, 0xFF, 0xC9, 0x19, 0x99, 0xD9, 0x9A, 0xEA,
+    0x99, 0xD9, 0x95, 0xD1, 0xFA, 0x09, 0xD7, 0xD0, 0x9D, 0xAC, 0xA0, 0xAC, 0x97, 0xD0, 0xE9, 0xD0,
+    0xD7, 0x0D, 0x9D, 0x99, 0xD9, 0xD7, 0x0F, 0xC0, 0x9D, 0xAC, 0xA7, 0x0F, 0xA0, 0x9F, 0x71, 0xF2,
+    0xF7, 0x1E, 0xA2, 0xEA, 0x71, 0xE9, 0x2E, 0x97, 0x09, 0xE3, 0xE7, 0x19, 0xDA, 0x3D, 0xA6, 0x4C,
+    0xAA, 0x99, 0x97, 0x70, 0x9F, 0xFA, 0x75, 0xAF, 0xFD, 0x5D, 0x4E, 0xA3, 0x9E, 0x39, 0xD4, 0xDA,
+    0x59, 0xD3, 0xAC, 0xA3, 0x9D, 0x7D, 0x3D, 0x93, 0xDA, 0x7D, 0x29, 0xD4, 0xD9, 0x2A, 0x92, 0xD2,
+    0xAD, 0x39, 0xD2, 0xAC, 0xA1, 0x9C, 0xA2, 0xDA, 0x3A, 0xD2, 0xD9, 0x1A, 0xC9, 0x2D, 0x93, 0xDA,
+    0x2D, 0x2D, 0x91, 0x9D, 0x4D, 0x92, 0xD2, 0xAA, 0x2A, 0xD3, 0x9D, 0x29, 0xCA, 0x7D, 0xA3, 0xAC,
+    0xA2, 0x9C, 0xA6, 0x9D, 0x4D, 0x92, 0x9D, 0x6A, 0xD4, 0xD4, 0xDA, 0x4A, 0xDA, 0x39, 0xD4, 0xAF,
+    0xAA, 0xF9, 0x49, 0x69, 0xFF, 0xC7, 0x70, 0x99, 0xAA, 0xE4, 0x75, 0x97, 0x7A, 0xC7, 0x7D, 0x73,
+    0xFF, 0xC7, 0x0F, 0xFA, 0x73, 0xD7, 0x19, 0xE1, 0xCA, 0x70, 0xFD, 0xAC, 0x97, 0xD9, 0x1F, 0x7D,
+    0x39, 0xDA, 0x6A, 0xC4, 0x9D, 0x96, 0xCA, 0x4A, 0xD6, 0x9C, 0xA4, 0xDA, 0x6A, 0xD2, 0x9E, 0x96,
+    0x9F, 0xFC, 0x70, 0xFF, 0xC7, 0x1F, 0xC9, 0xD7, 0x39, 0x74, 0xFF, 0xFA, 0x39, 0xFF, 0xF9, 0x30,
+    0x77, 0x77, 0x99, 0x99, 0x73, 0xAF, 0xE9, 0x70, 0xFF, 0xC7, 0x0F, 0x99, 0x19, 0x97, 0xAE, 0x76,
+    0xE7, 0x69, 0xD9, 0x73, 0xAF, 0xFC, 0x96, 0x9F, 0xFD, 0x97, 0x19, 0xD7, 0x7A, 0xD7, 0x4A, 0xFF,
+    0xC7, 0xFF, 0xE7, 0x3D, 0x97, 0x69, 0xD9, 0x76, 0xAD, 0x97, 0x6A, 0xDA, 0x76, 0xAF, 0xA9, 0x99,
+    0x97, 0x09, 0xFF, 0xC7, 0x1A, 0xFE, 0xA7, 0x29, 0xAF, 0xC9, 0x77, 0x70, 0x09, 0xFF, 0xFF, 0xC1,
+    0xAF, 0xFF, 0xFC, 0x1F, 0xDA, 0xEA, 0xAA, 0xFA, 0x70, 0xE7, 0x70, 0xDA, 0x77, 0x9D, 0x91, 0x97,
+    0x4E, 0xAD, 0xA7, 0x4F, 0xD9, 0x71, 0x9A, 0xFA, 0x97, 0x2F, 0xDA, 0x74, 0xCA, 0x9E, 0x90, 0xA9,
+    0x73, 0x9F, 0xD9, 0x73, 0xFD, 0x97, 0x19, 0xFC, 0xA7, 0x39, 0xFD, 0x97, 0x39, 0xA0, 0xAE, 0x77,
+    0xF7, 0x69, 0xEA, 0x76, 0xAE, 0x97, 0x6F, 0x77, 0xF7, 0x40, 0x6F, 0xF9, 0x75, 0xAF, 0xFD, 0x97,
+    0x3E, 0x99, 0x99, 0x9A, 0xE7, 0x3D, 0xA5, 0x9D, 0x96, 0xFF, 0xFF, 0xFC, 0x5E, 0x6A, 0xD6, 0x9F,
+    0xFF, 0xFF, 0x94, 0xAD, 0x93, 0x9A, 0xE9, 0x71, 0xFF, 0xFA, 0x72, 0xFF, 0xE9, 0x72, 0xAF, 0xFC,
+    0x97, 0x4E, 0xA7, 0x73, 0xE9, 0x77, 0x29, 0xE7, 0x73, 0xF7, 0x73, 0xEA, 0x77, 0x29, 0xE9, 0x77,
+    0x2F, 0x97, 0x72, 0xF7, 0x72, 0x9F, 0x77, 0x2A, 0xEA, 0x77, 0x20, 0x76, 0x97, 0x72, 0xD7, 0x72,
+    0xCA, 0x77, 0x19, 0xC9, 0x77, 0x1A, 0xC9, 0x97, 0x4A, 0xAF, 0xFC, 0x96, 0xAF, 0xFF, 0x95, 0xFC,
+    0xA9, 0xCA, 0x39, 0x94, 0xFA, 0x19, 0xC9, 0x71, 0xF9, 0x2A, 0xC7, 0x19, 0xEA, 0x3D, 0x71, 0xF4,
+    0xCA, 0x71, 0xE9, 0x39, 0xC9, 0x70, 0xAE, 0x4A, 0xC7, 0x1E, 0xA4, 0xAC, 0x71, 0xE9, 0x4D, 0xAA,
+    0x99, 0x49, 0xE5, 0xFF, 0xC9, 0x0A, 0xE4, 0x9C, 0xAA, 0xAF, 0xC9, 0x0A, 0xE4, 0xAC, 0x3D, 0xAA,
+    0x1F, 0x4D, 0x29, 0xD3, 0xFC, 0x3C, 0xA2, 0xE3, 0xAF, 0xDA, 0xAD, 0xAF, 0xA3, 0x9F, 0xFF, 0xEA,
+    0x4F, 0xFF, 0xE9, 0x5F, 0xFF, 0xCA, 0x79, 0xAF, 0xDA, 0xA9, 0x75, 0x9C, 0x97, 0x71, 0xAC, 0x77,
+    0x2D, 0x77, 0x77, 0x70, 0x9A, 0xFD, 0xA9, 0x77, 0x1F, 0xFE, 0x77, 0x0F, 0xFE, 0xA7, 0x79, 0x49,
+    0xAF, 0x77, 0x79, 0xE7, 0x77, 0x0E, 0x77, 0x70, 0xDA, 0x77, 0x7E, 0x97, 0x39, 0xFF, 0xFF, 0xFC,
+    0x5F, 0xFF, 0xFF, 0xCA, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x77,
+    0x77, 0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFD,
+    0xA3, 0xFF, 0xFF, 0xFE, 0x4F, 0xC9, 0x77, 0x49, 0xFC, 0xA6, 0x9A, 0x73, 0x9F, 0xFF, 0xEA, 0x73,
+    0xFF, 0xFF, 0x73, 0x9F, 0xFF, 0xEA, 0x73, 0x9F, 0xFF, 0xE7, 0x59, 0xAF, 0xFC, 0xA9, 0x77, 0x77,
+    0x50, 0x77, 0x59, 0xC9, 0x71, 0xAC, 0x72, 0xD7, 0x9A, 0xFA, 0x4A, 0xFD, 0xA3, 0xEA, 0xD5, 0xAD,
+    0xA0, 0xD5, 0xDA, 0x1C, 0xA4, 0x9D, 0x19, 0xC5, 0xDA, 0x1A, 0xC5, 0xD9, 0x1C, 0xA4, 0x9D, 0x90,
+    0x9C, 0x94, 0x9D, 0xA0, 0xAC, 0x59, 0xEA, 0xD6, 0xFF, 0x49, 0xFF, 0x5A, 0xFC, 0xA6, 0xD7, 0x72,
+    0x3F, 0xFF, 0xFC, 0xA4, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x70,
+    0x9F, 0xFF, 0xFC, 0x4A, 0xFF, 0xFF, 0xA4, 0xAA, 0xA9, 0x99, 0x9E, 0x90, 0x99, 0x99, 0x97, 0x4E,
+    0x77, 0x29, 0xDA, 0x77, 0x2E, 0x97, 0x72, 0xE7, 0x72, 0xAD, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE7,
+    0x72, 0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9E, 0x97, 0x71, 0xAE, 0x77, 0x2F, 0x77, 0x19, 0xE9, 0x77,
+    0x1F, 0x77, 0x2F, 0x77, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x29, 0xFF, 0xDA, 0x69, 0xCA, 0x74,
+    0xAC, 0x74, 0xAC, 0x7A, 0xAA, 0xAA, 0xDA, 0xAA, 0x92, 0xAF, 0xFD, 0x97, 0xD9, 0x71, 0x9E, 0x69,
+    0xFC, 0xA7, 0xAF, 0xA7, 0x0F, 0xD9, 0x73, 0xDA, 0x73, 0xAD, 0x73, 0xE7, 0x3E, 0x72, 0x9E, 0x72,
+    0xF7, 0x2F, 0x77, 0x50, 0x6D, 0x97, 0x3D, 0x73, 0x9D, 0x19, 0xA9, 0x6D, 0xAA, 0xE6, 0x9F, 0xCA,
+    0x94, 0xAF, 0xA9, 0x69, 0xFC, 0x70, 0x99, 0x0D, 0xA0, 0x9D, 0x7F, 0xDA, 0x59, 0xFC, 0xA5, 0x9F,
+    0xC4, 0x9C, 0x90, 0xDA, 0xD9, 0x39, 0xD3, 0x9D, 0x3E, 0x4A, 0xD0, 0x9A, 0xDA, 0x5F, 0xE7, 0xEA,
+    0x97, 0x75, 0x77, 0x72, 0xAC, 0x77, 0xD7, 0x7C, 0xA7, 0x59, 0xAD, 0xA7, 0x29, 0xFE, 0x97, 0x9F,
+    0xFC, 0x7E, 0xAC, 0xA0, 0xE6, 0xAD, 0x99, 0xCA, 0x1D, 0x6D, 0xA0, 0x9C, 0x91, 0xD5, 0x9D, 0x1A,
+    0xC2, 0xD5, 0xAC, 0x91, 0xD2, 0xCA, 0x5D, 0x2C, 0xA1, 0x9C, 0x95, 0xD1, 0x9C, 0x91, 0xAC, 0x59,
+    0xC9, 0x1A, 0xC2, 0xD5, 0xAC, 0x2D, 0x2C, 0xA5, 0xD2, 0xCA, 0x1A, 0xC9, 0x5D, 0x19, 0xC9, 0x1D,
+    0x59, 0xCA, 0x1A, 0xC1, 0x9D, 0x59, 0xCA, 0x1D, 0x19, 0xCA, 0x50, 0x72, 0xFF, 0xA7, 0x5A, 0xFF,
+    0xD9, 0x73, 0xE9, 0x99, 0x99, 0xF7, 0x3D, 0xA5, 0x9D, 0x97, 0x19, 0xD9, 0x6D, 0x97, 0x1E, 0x6A,
+    0xD7, 0x2D, 0xA6, 0xE7, 0x19, 0xD9, 0x4A, 0xE9, 0x59, 0x99, 0x9F, 0xFF, 0xA5, 0xAF, 0xFF, 0xEA,
+    0x6A, 0xFF, 0xFA, 0x97, 0x0F, 0xEA, 0x77, 0x3E, 0x97, 0x6A, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0x97,
+    0x0A, 0xFF, 0xFC, 0x71, 0xFF, 0xFD, 0x75, 0x9E, 0xA7, 0x72, 0xAE, 0x97, 0x72, 0xF7, 0x72, 0x9F,
+    0x77, 0x2A, 0xEA, 0x76, 0x6A, 0x75, 0xAC, 0x97, 0x39, 0xCA, 0x74, 0xD7, 0x4D, 0x70, 0x92, 0x9C,
+    0x94, 0x9A, 0xDA, 0x2D, 0x19, 0xAF, 0xCA, 0x91, 0xDA, 0xFD, 0xA4, 0xAF, 0xCA, 0x97, 0xE9, 0x74,
+    0xE7, 0x5E, 0x75, 0xE9, 0x74, 0xAD, 0x75, 0xAA, 0x77, 0x70, 0x70, 0xA7, 0x49, 0xE7, 0x2A, 0xFC,
+    0x79, 0xFE, 0xA5, 0xAD, 0x9A, 0xC9, 0x9D, 0xA3, 0xDA, 0x1D, 0x19, 0xD9, 0x09, 0xD9, 0x2D, 0x29,
+    0xD0, 0x9C, 0x39, 0xCA, 0x39, 0x7A, 0xC9, 0x74, 0xD7, 0x5D, 0x74, 0x9C, 0xA7, 0x4A, 0xC9, 0x74,
+    0xD7, 0x5C, 0xA7, 0x00, 0x7A, 0x75, 0x9C, 0xA7, 0x5A, 0xC9, 0x75, 0xD4, 0x97, 0x9C, 0xA3, 0xAD,
+    0xA9, 0x4A, 0xC9, 0x29, 0xAF, 0xCA, 0x91, 0xD5, 0x9A, 0xFD, 0xAC, 0xA7, 0x09, 0xAF, 0xC9, 0x73,
+    0xAE, 0x73, 0xE7, 0x29, 0xE7, 0x29, 0xDA, 0x72, 0x9D, 0xA7, 0x4A, 0x97, 0x75, 0x4D, 0x75, 0xD7,
+    0x5A, 0xC9, 0x74, 0x9C, 0xA7, 0x5D, 0x75, 0xD7, 0x5A, 0xC9, 0x7C, 0x39, 0xCA, 0x39, 0x19, 0xD9,
+    0x2D, 0x29, 0xD2, 0xDA, 0x1A, 0xC1, 0x9D, 0xA3, 0xAD, 0x99, 0xC9, 0x0D, 0xA6, 0xFE, 0xA7, 0x0A,
+    0xFC, 0x72, 0x9E, 0x75, 0xA5, 0x5A, 0x74, 0xA7, 0x2A, 0xC7, 0x4C, 0xA7, 0x09, 0xC7, 0x6C, 0x97,
+    0xCA, 0x76, 0xAC, 0x6D, 0x39, 0xAD, 0x9D, 0xA9, 0x3D, 0x49, 0xC1, 0xAF, 0xA9, 0x09, 0xAF, 0xA1,
+    0xC9, 0x3F, 0xDA, 0x96, 0x9A, 0xFD, 0x2E, 0xA9, 0x76, 0x9A, 0xE1, 0x9D, 0x97, 0x70, 0x9D, 0x92,
+    0x9D, 0x97, 0x69, 0xD9, 0x5D, 0x97, 0x49, 0xD7, 0x0D, 0x74, 0xD7, 0x77, 0x70, 0x77, 0x4A, 0xC7,
+    0x2F, 0x79, 0xFD, 0x5A, 0xC9, 0x9C, 0x09, 0xD2, 0x9D, 0x1A, 0xC1, 0xAC, 0xA1, 0xCA, 0x2C, 0xA2,
+    0xAA, 0x6C, 0x97, 0x29, 0xC7, 0x3A, 0xC7, 0x3C, 0xA7, 0x3C, 0x97, 0x29, 0xC7, 0x49, 0x73, 0x9C,
+    0x74, 0xC9, 0x73, 0xCA, 0x73, 0xAC, 0x73, 0x9C, 0x79, 0x3C, 0xA6, 0xD2, 0xD2, 0xCA, 0x2D, 0x90,
+    0xAC, 0x1D, 0x93, 0x9C, 0xA9, 0xC9, 0xAC, 0xA6, 0xFC, 0xA7, 0x0A, 0xE7, 0x29, 0xC4, 0x79, 0xAA,
+    0xC4, 0x99, 0xAF, 0xE2, 0x9F, 0xCA, 0x99, 0x6F, 0x97, 0x1D, 0xAD, 0xA7, 0x0D, 0x1E, 0xA6, 0xD2,
+    0x9E, 0x94, 0xD4, 0xAE, 0x92, 0xD6, 0xAD, 0xA1, 0xD7, 0x9D, 0x90, 0x99, 0x73, 0x2C, 0xAA, 0x97,
+    0x2F, 0xEA, 0x99, 0x79, 0x9A, 0xFC, 0x71, 0x9F, 0x70, 0xEA, 0xD6, 0xAE, 0x1D, 0x49, 0xE9, 0x2D,
+    0x29, 0xEA, 0x4D, 0x1E, 0xA6, 0xD0, 0x9D, 0x79, 0xD7, 0x49, 0x90, 0x74, 0xAC, 0x71, 0xAC, 0x97,
+    0x1D, 0x71, 0xAC, 0x93, 0xAC, 0x3D, 0x3D, 0x3A, 0xC9, 0x2C, 0xA4, 0xD1, 0x9C, 0x94, 0xD9, 0x0A,
+    0xC5, 0x9D, 0x0D, 0x6D, 0x9C, 0xA6, 0x9E, 0x91, 0xAC, 0xAA, 0x99, 0xE2, 0xFF, 0xC4, 0x99, 0xAE,
+    0xA7, 0x60, 0x77, 0x4C, 0x97, 0x0A, 0xCA, 0x70, 0xD1, 0x9C, 0x93, 0xAC, 0xA2, 0xCA, 0x3D, 0x3D,
+    0x29, 0xCA, 0x3A, 0xC2, 0xD5, 0xC9, 0x09, 0xCA, 0x5C, 0xA0, 0xD6, 0xAC, 0x9C, 0xA6, 0x9E, 0x70,
+    0xE9, 0x9A, 0xAC, 0xA2, 0xFF, 0xC2, 0xAE, 0xA9, 0x97, 0x50, 0x3A, 0x77, 0x1C, 0xA7, 0x7A, 0xD7,
+    0x7D, 0x77, 0x9C, 0xA7, 0x7D, 0x77, 0xAF, 0xFF, 0xE1, 0x9D, 0x77, 0xAD, 0x77, 0x09, 0xDA, 0x77,
+    0x9F, 0xFF, 0xE4, 0xE9, 0x77, 0xE7, 0x70, 0xE7, 0x70, 0xCA, 0x77, 0x74, 0x71, 0x97, 0x70, 0x9C,
+    0x91, 0xC9, 0x73, 0x9D, 0x2D, 0x72, 0xAE, 0x19, 0xE7, 0x0F, 0xA1, 0xAC, 0xAD, 0x6D, 0xA0, 0xC9,
+    0x1C, 0xA0, 0xDA, 0x39, 0xDA, 0x09, 0xC2, 0xC9, 0x09, 0xD9, 0x19, 0xD9, 0x1A, 0xC1, 0x9C, 0x2A,
+    0xD1, 0xD3, 0xCA, 0x1A, 0xC3, 0xCA, 0x19, 0x4C, 0x91, 0xCA, 0x74, 0x9C, 0x2C, 0x97, 0x4A, 0xC1,
+    0x9C, 0x75, 0xC9, 0x1D, 0x75, 0xC2, 0xCA, 0x74, 0x9C, 0x19, 0xC9, 0x74, 0xAA, 0x1A, 0xC7, 0x5C,
+    0x91, 0xCA, 0x75, 0xC2, 0xC9, 0x70, 0x74, 0x97, 0x70, 0x9C, 0x97, 0x7A, 0xD7, 0x70, 0xD7, 0x70,
+    0x9C, 0xA7, 0x70, 0xD3, 0xFF, 0xFF, 0x77, 0x0A, 0xCA, 0x77, 0xAD, 0x75, 0x9D, 0xA1, 0xFF, 0xFE,
+    0x97, 0x5E, 0x97, 0x5A, 0xD9, 0x75, 0xAD, 0x77, 0x0C, 0x97, 0x77, 0x10, 0x39, 0xA1, 0x9A, 0x75,
+    0x9C, 0x2C, 0x97, 0x5C, 0x91, 0xCA, 0x75, 0xCA, 0x1A, 0xC7, 0x5A, 0xC1, 0x9C, 0x76, 0xC2, 0xC9,
+    0x75, 0xC9, 0x1C, 0xA7, 0x5A, 0xA1, 0xAC, 0x75, 0x9C, 0x19, 0xC7, 0x9C, 0x93, 0xC2, 0xCA, 0x3C,
+    0x19, 0xDA, 0x2C, 0x91, 0xD2, 0xAD, 0x2D, 0xA1, 0xAA, 0x1A, 0xC1, 0x9D, 0x93, 0xAD, 0x09, 0xC1,
+    0x9C, 0x90, 0xDA, 0x5A, 0xD9, 0xC9, 0x1C, 0xAA, 0xD7, 0x9E, 0xA1, 0xAE, 0x72, 0xE1, 0x9D, 0x74,
+    0xD2, 0xC9, 0x75, 0xA9, 0x1A, 0x77, 0x71, 0x3A, 0x75, 0x97, 0x0C, 0xA7, 0x39, 0xC9, 0x6A, 0xD7,
+    0x3A, 0xCA, 0x6D, 0x75, 0xD5, 0x9C, 0xA7, 0x59, 0xCA, 0x4D, 0x77, 0xD3, 0xAF, 0xFF, 0xFF, 0xC1,
+    0x9D, 0x77, 0x1D, 0x90, 0xAD, 0x77, 0x1E, 0x19, 0xDA, 0x75, 0x9D, 0xA3, 0x9F, 0xFF, 0xFD, 0x96,
+    0xE9, 0x70, 0xE9, 0x70, 0xE7, 0xE7, 0x3E, 0x5A, 0xD7, 0x5C, 0xA5, 0x9C, 0x77, 0x77, 0x00, 0x6C,
+    0x75, 0xE9, 0x72, 0xAC, 0xAE, 0x97, 0x9D, 0x0A, 0xF9, 0x49, 0xD1, 0xAA, 0x9F, 0x29, 0xE1, 0xAA,
+    0x19, 0xC2, 0x9F, 0x1A, 0xA5, 0x9D, 0xA9, 0xC1, 0xAA, 0x6A, 0xA0, 0x9C, 0x1A, 0xA7, 0x19, 0xC1,
+    0xAA, 0x71, 0x9C, 0x1A, 0xA7, 0x19, 0xC1, 0xAA, 0x71, 0x9C, 0x1A, 0xA7, 0x19, 0xC1, 0xAA, 0x71,
+    0x9C, 0x1A, 0xA6, 0xAA, 0x09, 0xC1, 0xAA, 0x59, 0xDA, 0x9C, 0x1A, 0xA6, 0x9F, 0x1A, 0xA7, 0x9E,
+    0x1A, 0xA1, 0x9C, 0x49, 0xD1, 0xAA, 0x9F, 0x49, 0xD0, 0xAF, 0x96, 0xAC, 0xAE, 0x72, 0xE9, 0x74,
+    0xA7, 0x74, 0x9D, 0x97, 0x6A, 0xE9, 0x77, 0xAC, 0xA7, 0x79, 0xCA, 0x77, 0xAC, 0x97, 0x7D, 0x77,
+    0x0D, 0x77, 0x9C, 0x97, 0xAE, 0xA2, 0xD6, 0x9F, 0xE0, 0x9C, 0xA5, 0xAD, 0xA2, 0xAC, 0xAD, 0x59,
+    0xDA, 0x4F, 0x5D, 0xA5, 0xAD, 0x94, 0x9D, 0x95, 0xAD, 0x5A, 0xD6, 0xD9, 0x5A, 0xD5, 0xAC, 0xA6,
+    0xAE, 0x99, 0x9A, 0xE7, 0x0F, 0xFC, 0x97, 0x0A, 0xFE, 0x97, 0x29, 0xAE, 0xA7, 0x10, 0x77, 0x77,
+    0x59, 0xAF, 0xAA, 0x2D, 0x72, 0xAF, 0xFD, 0xAD, 0x97, 0x09, 0xFC, 0x99, 0x9A, 0xFC, 0x97, 0x09,
+    0xF9, 0x5F, 0x70, 0x9E, 0xA6, 0x9F, 0x97, 0xF6, 0xAF, 0xCA, 0x6A, 0xE6, 0xAD, 0x0A, 0xDA, 0x6E,
+    0x95, 0xAC, 0xA1, 0xAD, 0xA5, 0x9E, 0x5D, 0xA2, 0xAD, 0x95, 0xE9, 0x4D, 0x93, 0xE6, 0xE3, 0x9D,
+    0x94, 0xE5, 0x9D, 0xA2, 0x9D, 0x59, 0xDA, 0x5A, 0xDA, 0x19, 0xD6, 0xE9, 0x5A, 0xDA, 0x0A, 0xD6,
+    0xAE, 0x6A, 0xFC, 0xA6, 0xF9, 0x6A, 0xFC, 0x99, 0x99, 0x9A, 0xFD, 0x79, 0xFF, 0xFF, 0x97, 0x9F,
+    0xFF, 0xEA, 0x70, 0xFF, 0xFE, 0xA7, 0x0D, 0x9A, 0xFF, 0xE9, 0x70, 0xD3, 0xAF, 0xDA, 0x97, 0x2A,
+    0x77, 0x70, 0x77, 0x77, 0x9E, 0x77, 0xF7, 0x6F, 0xC9, 0x74, 0xAD, 0xAD, 0xA7, 0x39, 0xDA, 0x0D,
+    0xA7, 0x3E, 0x1E, 0x72, 0xAD, 0x91, 0xE7, 0x19, 0xDA, 0x2E, 0x97, 0x0E, 0x3A, 0xDA, 0x7E, 0x93,
+    0xAE, 0x6A, 0xDA, 0x49, 0xE5, 0x9E, 0x6E, 0x5E, 0x96, 0xE9, 0x3E, 0xA7, 0xEA, 0x2A, 0xE7, 0x0F,
+    0x19, 0xEA, 0x99, 0x99, 0x99, 0x99, 0x9F, 0x1A, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xCA, 0x00, 0x19,
+    0xFF, 0xFD, 0x2A, 0xFF, 0xFD, 0x4D, 0xA4, 0xD9, 0x6D, 0x93, 0x9D, 0x69, 0xD4, 0xAD, 0x6A, 0xD4,
+    0xDA, 0x6D, 0xA4, 0xD9, 0x6D, 0x93, 0x9D, 0x69, 0xD4, 0xAD, 0x6A, 0xD4, 0xDA, 0x6D, 0xA4, 0xD7,
+    0xD9, 0x39, 0xD6, 0x9D, 0x4A, 0xCA, 0x6A, 0xD4, 0xD9, 0x6D, 0xA3, 0x9D, 0x7D, 0x93, 0xAD, 0x69,
+    0xD4, 0xDA, 0x6A, 0xD4, 0xD9, 0x60, 0x09, 0x95, 0xAA, 0x7D, 0xA4, 0xD7, 0xAD, 0x4D, 0xA6, 0x9D,
+    0x4A, 0xD7, 0xD9, 0x39, 0xD7, 0xDA, 0x4D, 0x96, 0xAD, 0x4D, 0xA6, 0x9D, 0x4A, 0xD7, 0xD9, 0x39,
+    0xD7, 0xDA, 0x4D, 0x96, 0x9D, 0x4D, 0xA7, 0xD9, 0x3A, 0xD7, 0xDA, 0x39, 0xD7, 0xAD, 0x4D, 0x96,
+    0x9D, 0x4D, 0xA7, 0xD9, 0x3A, 0xD5, 0xFF, 0xFD, 0x92, 0xFF, 0xFD, 0xA0, 0x49, 0xFF, 0xD9, 0x4A,
+    0xFF, 0xD9, 0x49, 0xC9, 0x76, 0xD7, 0x7C, 0xA7, 0x69, 0xC9, 0x76, 0xAC, 0x77, 0xCA, 0x76, 0x9C,
+    0x76, 0xAC, 0x75, 0xD7, 0x49, 0xD7, 0x4A, 0xCA, 0x74, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xEA, 0xAA,
+    0xAA, 0xAA, 0x94, 0xAF, 0xFD, 0x94, 0xFF, 0xE7, 0x75, 0x75, 0xAA, 0xAF, 0xDA, 0x0F, 0xFD, 0xA7,
+    0x30, 0x76, 0xAF, 0xE9, 0x75, 0xAF, 0xCA, 0xA9, 0x76, 0xD9, 0x77, 0x3D, 0xA7, 0x73, 0x9D, 0x77,
+    0x4D, 0xA7, 0x73, 0xAD, 0x77, 0x39, 0xD9, 0x77, 0x3E, 0x77, 0x3A, 0xD9, 0x77, 0x29, 0xE7, 0x73,
+    0xE9, 0x77, 0x2A, 0xE7, 0x73, 0xE7, 0x6A, 0x3E, 0xA7, 0x5A, 0xD1, 0x9E, 0x76, 0xAD, 0xA0, 0xEA,
+    0x76, 0x9F, 0xE7, 0x70, 0xFD, 0xA7, 0x70, 0xFD, 0x77, 0x1A, 0xF9, 0x77, 0x00, 0x49, 0xAE, 0x92,
+    0x9A, 0xDA, 0x6F, 0xEA, 0x09, 0xFC, 0xA4, 0xEA, 0x99, 0x9D, 0x9D, 0xA9, 0x9D, 0x3A, 0xD4, 0x9E,
+    0x93, 0xC9, 0x2D, 0x6D, 0x94, 0xC9, 0x19, 0xCA, 0x59, 0xD5, 0xC9, 0x1A, 0xC6, 0xAC, 0xA4, 0x9C,
+    0x2D, 0x59, 0xE3, 0x9C, 0xA2, 0xDA, 0x90, 0x99, 0xAF, 0xFD, 0x3A, 0xFF, 0x9F, 0xEA, 0x4F, 0xE9,
+    0x0F, 0xDA, 0x6A, 0xEA, 0x3A, 0xDA, 0x94, 0x77, 0x4A, 0xEA, 0x77, 0x39, 0xFD, 0x77, 0x29, 0xDA,
+    0x77, 0x6D, 0xA7, 0x76, 0xAD, 0x77, 0x7D, 0xA7, 0x76, 0xAD, 0x77, 0x7D, 0xA7, 0x76, 0x9D, 0x77,
+    0x7E, 0x77, 0x69, 0xD9, 0x77, 0x6A, 0xD7, 0x77, 0xD9, 0x77, 0x6A, 0xD7, 0x77, 0xDA, 0x77, 0x69,
+    0xD9, 0x77, 0x6E, 0x77, 0x69, 0xD9, 0x77, 0x6A, 0xD7, 0x77, 0xDA, 0x77, 0x6E, 0x77, 0x6A, 0xDA,
+    0x77, 0x0A, 0xA2, 0xAE, 0x77, 0xAF, 0xFC, 0xA7, 0x7F, 0xFD, 0x77, 0x09, 0xFF, 0x77, 0x3A, 0xFA,
+    0x77, 0x77, 0x74, 0x4E, 0x4A, 0xE4, 0xF3, 0xAE, 0xA3, 0x99, 0x99, 0x97, 0x77, 0x77, 0x79, 0x99,
+    0x5E, 0x4A, 0xE4, 0xF3, 0xAE, 0xA3, 0x77, 0x5A, 0xF9, 0x4C, 0xA3, 0xE1, 0xAC, 0x92, 0xD9, 0x2A,
+    0xD3, 0xDA, 0x9D, 0xA3, 0x9A, 0x94, 0xAE, 0xA7, 0x77, 0x77, 0x1A, 0xE9, 0x4A, 0x93, 0x9D, 0xA9,
+    0xD9, 0x29, 0xD3, 0xD9, 0x2D, 0x90, 0x9D, 0x92, 0xAD, 0x4F, 0xC9, 0x74, 0x99, 0x95, 0x77, 0x77,
+    0x49, 0xC7, 0x70, 0x9C, 0x97, 0x70, 0xC9, 0x77, 0x0C, 0xA7, 0x70, 0xAA, 0x77, 0x0A, 0xC7, 0x70,
+    0x9F, 0xD5, 0xAF, 0xFF, 0xC9, 0x3A, 0xFA, 0xD9, 0x77, 0x0C, 0xA7, 0x70, 0xD7, 0x70, 0xD7, 0x4A,
+    0xAF, 0xFF, 0x4A, 0xFF, 0xFD, 0x7A, 0xCA, 0x77, 0xAD, 0x77, 0x9D, 0x77, 0x9D, 0x77, 0x0D, 0x97,
+    0x7D, 0xA7, 0x77, 0x73, 0x74, 0x97, 0x71, 0xAD, 0x77, 0xAF, 0x75, 0xAF, 0xA7, 0x4A, 0xFA, 0x74,
+    0xAF, 0xA7, 0x4A, 0xFC, 0x97, 0x4A, 0xF9, 0x76, 0x9F, 0x97, 0x7F, 0xEA, 0x97, 0x59, 0xAF, 0xEA,
+    0x97, 0x5A, 0xFF, 0xA9, 0x74, 0x9A, 0xFC, 0xA7, 0x70, 0x9A, 0xD7, 0x73, 0x96, 0xA9, 0x97, 0x70,
+    0x9F, 0xEA, 0xA9, 0x97, 0x19, 0xAA, 0xAF, 0xFE, 0xA7, 0x59, 0x99, 0xAA, 0xD9, 0x79, 0x77, 0x39,
+    0xD9, 0x77, 0x1A, 0xF9, 0x77, 0x1F, 0xC9, 0x77, 0x09, 0xFC, 0x97, 0x70, 0x9F, 0xC9, 0x77, 0x0A,
+    0xFC, 0x97, 0x70, 0xAF, 0x77, 0x9A, 0xF7, 0x39, 0xAF, 0xE9, 0x79, 0xAF, 0xFA, 0x96, 0xAF, 0xFA,
+    0x97, 0x2F, 0xD9, 0x75, 0x9D, 0xA9, 0x77, 0x09, 0x77, 0x77, 0x09, 0x99, 0x71, 0x99, 0xAA, 0xAF,
+    0xE4, 0x9F, 0xFE, 0xAA, 0xA9, 0x94, 0xDA, 0xAA, 0x99, 0x75,
 };
 
 static const EpdGlyph opendyslexic_12_italicGlyphs[] = {
     { 0, 0, 21, 0, 0, 0, 0 }, //  
-    { 12, 25, 14, 1, 25, 75, 0 }, // !
-    { 13, 7, 19, 5, 21, 23, 75 }, // "
-    { 28, 22, 32, 3, 20, 154, 98 }, // #
-    { 23, 27, 26, 1, 24, 156, 252 }, // $
-    { 20, 21, 27, 6, 20, 105, 408 }, // %
-    { 20, 23, 25, 4, 22, 115, 513 }, // &
-    { 7, 8, 12, 4, 19, 14, 628 }, // '
-    { 14, 34, 18, 3, 25, 119, 642 }, // (
-    { 14, 34, 11, -6, 25, 119, 761 }, // )
-    { 13, 12, 19, 5, 19, 39, 880 }, // *
-    { 13, 12, 17, 3, 13, 39, 919 }, // +
-    { 8, 8, 9, 0, 4, 16, 958 }, // ,
-    { 13, 3, 17, 3, 9, 10, 974 }, // -
-    { 5, 5, 7, 1, 5, 7, 984 }, // .
-    { 25, 39, 23, -3, 27, 244, 991 }, // /
-    { 17, 19, 20, 2, 19, 81, 1235 }, // 0
-    { 13, 19, 15, 1, 19, 62, 1316 }, // 1
-    { 18, 19, 20, 1, 19, 86, 1378 }, // 2
-    { 17, 19, 20, 2, 19, 81, 1464 }, // 3
-    { 14, 19, 18, 3, 19, 67, 1545 }, // 4
-    { 16, 19, 19, 2, 19, 76, 1612 }, // 5
-    { 17, 19, 20, 2, 19, 81, 1688 }, // 6
-    { 13, 19, 20, 6, 19, 62, 1769 }, // 7
-    { 17, 19, 20, 2, 19, 81, 1831 }, // 8
-    { 16, 19, 20, 3, 19, 76, 1912 }, // 9
-    { 9, 15, 11, 1, 15, 34, 1988 }, // :
-    { 10, 18, 11, 0, 14, 45, 2022 }, // ;
-    { 19, 15, 20, -1, 16, 72, 2067 }, // <
-    { 14, 9, 17, 2, 11, 32, 2139 }, // =
-    { 19, 15, 22, 2, 16, 72, 2171 }, // >
-    { 16, 28, 21, 4, 28, 112, 2243 }, // ?
-    { 25, 21, 30, 3, 20, 132, 2355 }, // @
-    { 20, 21, 25, 1, 21, 105, 2487 }, // A
-    { 19, 22, 21, 1, 22, 105, 2592 }, // B
-    { 22, 23, 24, 1, 22, 127, 2697 }, // C
-    { 22, 22, 24, 1, 22, 121, 2824 }, // D
-    { 19, 22, 21, 1, 22, 105, 2945 }, // E
-    { 18, 22, 20, 1, 22, 99, 3050 }, // F
-    { 21, 22, 25, 2, 22, 116, 3149 }, // G
-    { 23, 22, 25, 1, 22, 127, 3265 }, // H
-    { 10, 21, 12, 1, 21, 53, 3392 }, // I
-    { 18, 28, 18, -1, 22, 126, 3445 }, // J
-    { 20, 21, 22, 1, 21, 105, 3571 }, // K
-    { 15, 22, 19, 1, 22, 83, 3676 }, // L
-    { 26, 22, 28, 1, 22, 143, 3759 }, // M
-    { 24, 22, 26, 1, 22, 132, 3902 }, // N
-    { 24, 22, 27, 2, 21, 132, 4034 }, // O
-    { 20, 21, 22, 1, 21, 105, 4166 }, // P
-    { 24, 26, 26, 1, 22, 156, 4271 }, // Q
-    { 19, 22, 21, 1, 22, 105, 4427 }, // R
-    { 22, 23, 25, 1, 22, 127, 4532 }, // S
-    { 20, 21, 26, 5, 21, 105, 4659 }, // T
-    { 23, 23, 25, 1, 22, 133, 4764 }, // U
-    { 21, 22, 28, 6, 22, 116, 4897 }, // V
-    { 28, 21, 34, 5, 21, 147, 5013 }, // W
-    { 24, 22, 26, 1, 22, 132, 5160 }, // X
-    { 18, 21, 25, 6, 21, 95, 5292 }, // Y
-    { 25, 21, 27, 1, 21, 132, 5387 }, // Z
-    { 18, 35, 18, -1, 27, 158, 5519 }, // [
-    { 4, 24, 12, 6, 19, 24, 5677 }, // <backslash>
-    { 18, 35, 13, -6, 27, 158, 5701 }, // ]
-    { 10, 5, 16, 5, 23, 13, 5859 }, // ^
-    { 18, 4, 20, 0, -2, 18, 5872 }, // _
-    { 7, 4, 14, 6, 19, 7, 5890 }, // `
-    { 16, 15, 19, 1, 15, 60, 5897 }, // a
-    { 15, 23, 20, 3, 22, 87, 5957 }, // b
-    { 13, 16, 17, 1, 15, 52, 6044 }, // c
-    { 20, 22, 22, 1, 21, 110, 6096 }, // d
-    { 16, 15, 19, 1, 15, 60, 6206 }, // e
-    { 13, 20, 16, 2, 20, 65, 6266 }, // f
-    { 18, 21, 19, 0, 14, 95, 6331 }, // g
-    { 16, 21, 19, 1, 21, 84, 6426 }, // h
-    { 10, 22, 12, 1, 22, 55, 6510 }, // i
-    { 16, 28, 19, 2, 21, 112, 6565 }, // j
-    { 13, 20, 19, 1, 20, 65, 6677 }, // k
-    { 10, 21, 12, 1, 21, 53, 6742 }, // l
-    { 25, 14, 28, 1, 14, 88, 6795 }, // m
-    { 16, 14, 19, 1, 14, 56, 6883 }, // n
-    { 17, 14, 19, 1, 14, 60, 6939 }, // o
-    { 20, 21, 20, -1, 14, 105, 6999 }, // p
-    { 18, 21, 22, 1, 15, 95, 7104 }, // q
-    { 13, 14, 15, 1, 14, 46, 7199 }, // r
-    { 15, 14, 18, 1, 14, 53, 7245 }, // s
-    { 11, 19, 16, 4, 19, 53, 7298 }, // t
-    { 15, 15, 18, 2, 14, 57, 7351 }, // u
-    { 16, 14, 21, 4, 14, 56, 7408 }, // v
-    { 20, 14, 25, 4, 14, 70, 7464 }, // w
-    { 18, 14, 21, 1, 14, 63, 7534 }, // x
-    { 19, 21, 20, 0, 14, 100, 7597 }, // y
-    { 17, 14, 19, 1, 14, 60, 7697 }, // z
-    { 15, 24, 19, 3, 19, 90, 7757 }, // {
-    { 10, 22, 11, 0, 18, 55, 7847 }, // |
-    { 14, 24, 16, 0, 19, 84, 7902 }, // }
-    { 10, 5, 16, 5, 19, 13, 7986 }, // ~
-    { 0, 0, 21, 0, 0, 0, 7999 }, //  
-    { 10, 25, 13, 2, 19, 63, 7999 }, // ¡
-    { 13, 22, 17, 1, 19, 72, 8062 }, // ¢
-    { 19, 24, 21, 1, 24, 114, 8134 }, // £
-    { 15, 14, 19, 3, 16, 53, 8248 }, // ¤
-    { 19, 21, 23, 3, 18, 100, 8301 }, // ¥
-    { 10, 22, 11, 0, 18, 55, 8401 }, // ¦
-    { 19, 22, 21, 1, 19, 105, 8456 }, // §
-    { 12, 5, 18, 5, 20, 15, 8561 }, // ¨
-    { 11, 10, 18, 6, 23, 28, 8576 }, // ©
-    { 9, 9, 14, 4, 19, 21, 8604 }, // ª
-    { 17, 12, 20, 2, 12, 51, 8625 }, // «
-    { 13, 8, 17, 3, 9, 26, 8676 }, // ¬
-    { 13, 3, 17, 3, 9, 10, 8702 }, // ­
-    { 11, 10, 19, 7, 27, 28, 8712 }, // ®
-    { 10, 3, 17, 6, 18, 8, 8740 }, // ¯
-    { 13, 12, 18, 4, 20, 39, 8748 }, // °
-    { 16, 15, 18, 0, 14, 60, 8787 }, // ±
-    { 9, 9, 12, 2, 20, 21, 8847 }, // ²
-    { 8, 10, 12, 3, 20, 20, 8868 }, // ³
-    { 6, 5, 12, 5, 19, 8, 8888 }, // ´
-    { 18, 17, 18, -1, 14, 77, 8896 }, // µ
-    { 17, 21, 19, 1, 18, 90, 8973 }, // ¶
-    { 6, 5, 9, 2, 11, 8, 9063 }, // ·
-    { 7, 7, 8, 0, 1, 13, 9071 }, // ¸
-    { 6, 10, 10, 3, 21, 15, 9084 }, // ¹
-    { 9, 8, 14, 4, 18, 18, 9099 }, // º
-    { 17, 12, 16, -3, 12, 51, 9117 }, // »
-    { 20, 24, 28, 6, 22, 120, 9168 }, // ¼
-    { 22, 23, 29, 6, 21, 127, 9288 }, // ½
-    { 21, 24, 28, 5, 22, 126, 9415 }, // ¾
-    { 16, 28, 15, -2, 15, 112, 9541 }, // ¿
-    { 20, 28, 25, 1, 28, 140, 9653 }, // À
-    { 21, 33, 25, 1, 33, 174, 9793 }, // Á
-    { 21, 27, 25, 1, 27, 142, 9967 }, // Â
-    { 22, 29, 25, 1, 29, 160, 10109 }, // Ã
-    { 23, 29, 25, 1, 29, 167, 10269 }, // Ä
-    { 20, 30, 25, 1, 30, 150, 10436 }, // Å
-    { 33, 23, 36, 1, 22, 190, 10586 }, // Æ
-    { 22, 28, 24, 1, 22, 154, 10776 }, // Ç
-    { 19, 28, 21, 1, 28, 133, 10930 }, // È
-    { 19, 32, 21, 1, 32, 152, 11063 }, // É
-    { 19, 27, 21, 1, 27, 129, 11215 }, // Ê
-    { 20, 29, 22, 1, 29, 145, 11344 }, // Ë
-    { 12, 29, 14, 1, 29, 87, 11489 }, // Ì
-    { 14, 34, 16, 1, 34, 119, 11576 }, // Í
-    { 14, 28, 16, 1, 28, 98, 11695 }, // Î
-    { 15, 30, 17, 1, 30, 113, 11793 }, // Ï
-    { 23, 22, 24, 0, 22, 127, 11906 }, // Ð
-    { 24, 27, 26, 1, 27, 162, 12033 }, // Ñ
-    { 24, 29, 27, 2, 28, 174, 12195 }, // Ò
-    { 24, 33, 27, 2, 32, 198, 12369 }, // Ó
-    { 24, 28, 27, 2, 27, 168, 12567 }, // Ô
-    { 24, 29, 27, 2, 28, 174, 12735 }, // Õ
-    { 24, 29, 27, 2, 28, 174, 12909 }, // Ö
-    { 13, 7, 16, 2, 10, 23, 13083 }, // ×
-    { 44, 41, 36, -9, 31, 451, 13106 }, // Ø
-    { 23, 30, 25, 1, 29, 173, 13557 }, // Ù
-    { 23, 34, 25, 1, 33, 196, 13730 }, // Ú
-    { 23, 29, 25, 1, 28, 167, 13926 }, // Û
-    { 23, 30, 25, 1, 29, 173, 14093 }, // Ü
-    { 18, 33, 25, 6, 33, 149, 14266 }, // Ý
-    { 16, 20, 18, 1, 20, 80, 14415 }, // Þ
-    { 18, 20, 20, 1, 20, 90, 14495 }, // ß
-    { 16, 20, 19, 1, 20, 80, 14585 }, // à
-    { 16, 24, 19, 1, 24, 96, 14665 }, // á
-    { 17, 20, 19, 1, 20, 85, 14761 }, // â
-    { 16, 20, 19, 1, 20, 80, 14846 }, // ã
-    { 17, 21, 19, 1, 21, 90, 14926 }, // ä
-    { 16, 22, 19, 1, 22, 88, 15016 }, // å
-    { 26, 15, 31, 1, 15, 98, 15104 }, // æ
-    { 13, 21, 17, 1, 15, 69, 15202 }, // ç
-    { 16, 23, 19, 1, 23, 92, 15271 }, // è
-    { 17, 27, 19, 1, 27, 115, 15363 }, // é
-    { 17, 22, 19, 1, 22, 94, 15478 }, // ê
-    { 18, 24, 20, 1, 24, 108, 15572 }, // ë
-    { 9, 21, 11, 1, 21, 48, 15680 }, // ì
-    { 12, 25, 14, 1, 25, 75, 15728 }, // í
-    { 12, 20, 14, 1, 20, 60, 15803 }, // î
-    { 13, 22, 15, 1, 22, 72, 15863 }, // ï
-    { 22, 20, 25, 2, 20, 110, 15935 }, // ð
-    { 18, 21, 20, 1, 21, 95, 16045 }, // ñ
-    { 17, 23, 19, 1, 23, 98, 16140 }, // ò
-    { 17, 27, 19, 1, 27, 115, 16238 }, // ó
-    { 17, 22, 19, 1, 22, 94, 16353 }, // ô
-    { 17, 23, 19, 1, 23, 98, 16447 }, // õ
-    { 18, 23, 20, 1, 23, 104, 16545 }, // ö
-    { 16, 16, 21, 4, 16, 64, 16649 }, // ÷
-    { 24, 39, 22, -3, 26, 234, 16713 }, // ø
-    { 15, 22, 18, 2, 21, 83, 16947 }, // ù
-    { 15, 26, 18, 2, 25, 98, 17030 }, // ú
-    { 15, 21, 18, 2, 20, 79, 17128 }, // û
-    { 16, 22, 19, 2, 21, 88, 17207 }, // ü
-    { 19, 34, 20, 0, 27, 162, 17295 }, // ý
-    { 15, 26, 17, 1, 21, 98, 17457 }, // þ
-    { 20, 30, 21, 0, 23, 150, 17555 }, // ÿ
-    { 22, 28, 25, 1, 28, 154, 17705 }, // Ā
-    { 17, 20, 19, 1, 20, 85, 17859 }, // ā
-    { 22, 31, 25, 1, 31, 171, 17944 }, // Ă
-    { 17, 22, 19, 1, 22, 94, 18115 }, // ă
-    { 20, 27, 25, 1, 21, 135, 18209 }, // Ą
-    { 16, 20, 19, 1, 15, 80, 18344 }, // ą
-    { 22, 33, 24, 1, 32, 182, 18424 }, // Ć
-    { 15, 24, 17, 1, 23, 90, 18606 }, // ć
-    { 22, 31, 24, 1, 30, 171, 18696 }, // Ĉ
-    { 17, 22, 19, 1, 21, 94, 18867 }, // ĉ
-    { 22, 32, 24, 1, 31, 176, 18961 }, // Ċ
-    { 13, 23, 17, 1, 22, 75, 19137 }, // ċ
-    { 22, 33, 24, 1, 32, 182, 19212 }, // Č
-    { 16, 24, 18, 1, 23, 96, 19394 }, // č
-    { 22, 31, 24, 1, 31, 171, 19490 }, // Ď
-    { 24, 22, 26, 1, 21, 132, 19661 }, // ď
-    { 23, 22, 24, 0, 22, 127, 19793 }, // Đ
-    { 23, 22, 25, 1, 21, 127, 19920 }, // đ
-    { 20, 28, 22, 1, 28, 140, 20047 }, // Ē
-    { 18, 23, 20, 1, 23, 104, 20187 }, // ē
-    { 20, 30, 22, 1, 30, 150, 20291 }, // Ĕ
-    { 18, 26, 20, 1, 26, 117, 20441 }, // ĕ
-    { 19, 30, 21, 1, 30, 143, 20558 }, // Ė
-    { 16, 25, 19, 1, 25, 100, 20701 }, // ė
-    { 19, 27, 21, 1, 22, 129, 20801 }, // Ę
-    { 16, 21, 19, 1, 15, 84, 20930 }, // ę
-    { 19, 31, 21, 1, 31, 148, 21014 }, // Ě
-    { 17, 26, 19, 1, 26, 111, 21162 }, // ě
-    { 22, 29, 25, 2, 29, 160, 21273 }, // Ĝ
-    { 19, 28, 20, 0, 21, 133, 21433 }, // ĝ
-    { 22, 31, 25, 2, 31, 171, 21566 }, // Ğ
-    { 18, 30, 19, 0, 23, 135, 21737 }, // ğ
-    { 21, 30, 25, 2, 30, 158, 21872 }, // Ġ
-    { 18, 29, 19, 0, 22, 131, 22030 }, // ġ
-    { 21, 34, 25, 2, 22, 179, 22161 }, // Ģ
-    { 18, 30, 19, 0, 23, 135, 22340 }, // ģ
-    { 23, 28, 25, 1, 28, 161, 22475 }, // Ĥ
-    { 16, 27, 19, 1, 27, 108, 22636 }, // ĥ
-    { 23, 21, 25, 1, 21, 121, 22744 }, // Ħ
-    { 16, 21, 19, 1, 21, 84, 22865 }, // ħ
-    { 14, 31, 16, 1, 31, 109, 22949 }, // Ĩ
-    { 12, 22, 14, 1, 22, 66, 23058 }, // ĩ
-    { 15, 29, 17, 1, 29, 109, 23124 }, // Ī
-    { 13, 20, 15, 1, 20, 65, 23233 }, // ī
-    { 12, 27, 16, 3, 21, 81, 23298 }, // Į
-    { 12, 27, 12, -1, 22, 81, 23379 }, // į
-    { 12, 31, 14, 1, 31, 93, 23460 }, // İ
-    { 7, 15, 9, 1, 15, 27, 23553 }, // ı
-    { 20, 27, 23, 1, 21, 135, 23580 }, // Ĳ
-    { 23, 29, 25, 1, 22, 167, 23715 }, // ĳ
-    { 21, 34, 21, -1, 28, 179, 23882 }, // Ĵ
-    { 20, 28, 23, 2, 21, 140, 24061 }, // ĵ
-    { 20, 30, 22, 1, 21, 150, 24201 }, // Ķ
-    { 13, 32, 19, 1, 20, 104, 24351 }, // ķ
-    { 12, 14, 14, 0, 14, 42, 24455 }, // ĸ
-    { 15, 30, 19, 1, 30, 113, 24497 }, // Ĺ
-    { 14, 29, 16, 1, 29, 102, 24610 }, // ĺ
-    { 15, 33, 19, 1, 22, 124, 24712 }, // Ļ
-    { 11, 32, 12, 0, 21, 88, 24836 }, // ļ
-    { 16, 22, 19, 1, 22, 88, 24924 }, // Ľ
-    { 15, 22, 17, 1, 22, 83, 25012 }, // ľ
-    { 17, 22, 19, 1, 22, 94, 25095 }, // Ŀ
-    { 14, 21, 16, 1, 21, 74, 25189 }, // ŀ
-    { 34, 32, 23, -12, 26, 272, 25263 }, // Ł
-    { 23, 21, 16, -8, 21, 121, 25535 }, // ł
-    { 24, 30, 26, 1, 30, 180, 25656 }, // Ń
-    { 17, 24, 19, 1, 24, 102, 25836 }, // ń
-    { 24, 31, 26, 1, 22, 186, 25938 }, // Ņ
-    { 16, 23, 19, 1, 14, 92, 26124 }, // ņ
-    { 24, 30, 26, 1, 30, 180, 26216 }, // Ň
-    { 17, 24, 19, 1, 24, 102, 26396 }, // ň
-    { 18, 26, 17, -3, 26, 117, 26498 }, // ŉ
-    { 24, 28, 26, 1, 22, 168, 26615 }, // Ŋ
-    { 16, 19, 19, 1, 14, 76, 26783 }, // ŋ
-    { 24, 28, 27, 2, 27, 168, 26859 }, // Ō
-    { 18, 21, 20, 1, 21, 95, 27027 }, // ō
-    { 24, 31, 27, 2, 30, 186, 27122 }, // Ŏ
-    { 18, 25, 20, 1, 25, 113, 27308 }, // ŏ
-    { 24, 30, 27, 2, 29, 180, 27421 }, // Ő
-    { 21, 24, 23, 1, 24, 126, 27601 }, // ő
-    { 32, 21, 35, 2, 21, 168, 27727 }, // Œ
-    { 27, 15, 29, 1, 15, 102, 27895 }, // œ
-    { 19, 29, 21, 1, 29, 138, 27997 }, // Ŕ
-    { 13, 21, 15, 1, 21, 69, 28135 }, // ŕ
-    { 19, 34, 21, 1, 22, 162, 28204 }, // Ŗ
-    { 15, 27, 15, -1, 14, 102, 28366 }, // ŗ
-    { 19, 30, 21, 1, 30, 143, 28468 }, // Ř
-    { 13, 21, 15, 1, 21, 69, 28611 }, // ř
-    { 22, 33, 25, 1, 32, 182, 28680 }, // Ś
-    { 15, 23, 18, 1, 23, 87, 28862 }, // ś
-    { 22, 30, 25, 1, 29, 165, 28949 }, // Ŝ
-    { 16, 21, 18, 1, 21, 84, 29114 }, // ŝ
-    { 22, 28, 25, 1, 22, 154, 29198 }, // Ş
-    { 15, 21, 18, 1, 14, 79, 29352 }, // ş
-    { 22, 33, 25, 1, 32, 182, 29431 }, // Š
-    { 15, 23, 18, 1, 23, 87, 29613 }, // š
-    { 20, 26, 26, 5, 21, 130, 29700 }, // Ţ
-    { 11, 24, 16, 4, 19, 66, 29830 }, // ţ
-    { 20, 29, 26, 5, 29, 145, 29896 }, // Ť
-    { 14, 21, 19, 4, 21, 74, 30041 }, // ť
-    { 20, 21, 26, 5, 21, 105, 30115 }, // Ŧ
-    { 13, 19, 16, 2, 19, 62, 30220 }, // ŧ
-    { 23, 31, 25, 1, 30, 179, 30282 }, // Ũ
-    { 15, 23, 18, 2, 22, 87, 30461 }, // ũ
-    { 23, 29, 25, 1, 28, 167, 30548 }, // Ū
-    { 16, 21, 19, 2, 20, 84, 30715 }, // ū
-    { 23, 32, 25, 1, 31, 184, 30799 }, // Ŭ
-    { 16, 24, 19, 2, 23, 96, 30983 }, // ŭ
-    { 23, 32, 25, 1, 31, 184, 31079 }, // Ů
-    { 15, 24, 18, 2, 23, 90, 31263 }, // ů
-    { 24, 31, 26, 1, 30, 186, 31353 }, // Ű
-    { 19, 23, 22, 2, 22, 110, 31539 }, // ű
-    { 23, 27, 25, 1, 22, 156, 31649 }, // Ų
-    { 15, 20, 18, 2, 14, 75, 31805 }, // ų
-    { 28, 27, 34, 5, 27, 189, 31880 }, // Ŵ
-    { 20, 21, 25, 4, 21, 105, 32069 }, // ŵ
-    { 18, 28, 25, 6, 28, 126, 32174 }, // Ŷ
-    { 19, 29, 20, 0, 22, 138, 32300 }, // ŷ
-    { 18, 30, 25, 6, 30, 135, 32438 }, // Ÿ
-    { 25, 30, 27, 1, 30, 188, 32573 }, // Ź
-    { 17, 23, 19, 1, 23, 98, 32761 }, // ź
-    { 25, 29, 27, 1, 29, 182, 32859 }, // Ż
-    { 17, 22, 19, 1, 22, 94, 33041 }, // ż
-    { 25, 30, 27, 1, 30, 188, 33135 }, // Ž
-    { 17, 23, 19, 1, 23, 98, 33323 }, // ž
-    { 14, 20, 18, 3, 20, 70, 33421 }, // ſ
-    { 30, 24, 33, 2, 23, 180, 33491 }, // Ơ
-    { 19, 15, 21, 1, 15, 72, 33671 }, // ơ
-    { 20, 21, 22, 1, 21, 105, 33743 }, // Ƥ
-    { 20, 25, 20, -1, 18, 125, 33848 }, // ƥ
-    { 17, 19, 19, 1, 18, 81, 33973 }, // Ʃ
-    { 20, 21, 26, 5, 21, 105, 34054 }, // Ƭ
-    { 12, 22, 17, 4, 22, 66, 34159 }, // ƭ
-    { 20, 26, 26, 5, 21, 130, 34225 }, // Ʈ
-    { 27, 23, 29, 1, 22, 156, 34355 }, // Ư
-    { 18, 17, 21, 2, 16, 77, 34511 }, // ư
-    { 7, 4, 14, 6, 19, 7, 34588 }, // ̀
-    { 6, 5, 12, 5, 19, 8, 34595 }, // ́
-    { 11, 5, 11, -1, 0, 14, 34603 }, // ̂
-    { 10, 5, 16, 5, 19, 13, 34617 }, // ̃
-    { 13, 4, 18, 4, 17, 13, 34630 }, // ̄
-    { 17, 3, 25, 7, 22, 13, 34643 }, // ̅
-    { 11, 5, 17, 5, 18, 14, 34656 }, // ̆
-    { 5, 5, 11, 5, 20, 7, 34670 }, // ̇
-    { 12, 5, 18, 5, 20, 15, 34677 }, // ̈
-    { 6, 5, 11, 4, 16, 8, 34692 }, // ̉
-    { 7, 5, 13, 5, 19, 9, 34700 }, // ̊
-    { 17, 4, 23, 5, 19, 17, 34709 }, // ̋
-    { 11, 5, 17, 5, 19, 14, 34726 }, // ̌
-    { 18, 4, 11, -8, 20, 18, 34740 }, // ̏
-    { 8, 8, 13, 4, 19, 16, 34758 }, // ̒
-    { 8, 7, 13, 4, 18, 14, 34774 }, // ̓
-    { 8, 7, 5, -4, 18, 14, 34788 }, // ̔
-    { 6, 6, 7, 0, -1, 9, 34802 }, // ̘
-    { 5, 6, 8, 2, -1, 8, 34811 }, // ̙
-    { 11, 6, 18, 6, 20, 17, 34819 }, // ̚
-    { 5, 6, 10, 4, 16, 8, 34836 }, // ̛
-    { 4, 5, 5, 0, -2, 5, 34844 }, // ̜
-    { 6, 5, 10, 3, 4, 8, 34849 }, // ̝
-    { 6, 5, 7, 0, -1, 8, 34857 }, // ̞
-    { 6, 5, 7, 0, -2, 8, 34865 }, // ̟
-    { 12, 4, 13, 0, -3, 12, 34873 }, // ̠
-    { 5, 5, 6, 0, 1, 7, 34885 }, // ̣
-    { 13, 5, 13, -1, 0, 17, 34892 }, // ̤
-    { 7, 5, 13, 5, 19, 9, 34909 }, // ̥
-    { 8, 8, 9, 0, 4, 16, 34918 }, // ̦
-    { 7, 7, 8, 0, 1, 13, 34934 }, // ̧
-    { 7, 7, 8, 0, 1, 13, 34947 }, // ̨
-    { 6, 7, 6, -1, -1, 11, 34960 }, // ̩
-    { 9, 4, 10, 0, -1, 9, 34971 }, // ̪
-    { 11, 5, 12, 0, 0, 14, 34980 }, // ̬
-    { 11, 5, 11, -1, -1, 14, 34994 }, // ̭
-    { 10, 5, 16, 5, 19, 13, 35008 }, // ̰
-    { 10, 3, 17, 6, 18, 8, 35021 }, // ̱
-    { 11, 3, 12, 0, -2, 9, 35029 }, // ̲
-    { 10, 5, 16, 5, 19, 13, 35038 }, // ̴
-    { 13, 3, 17, 3, 9, 10, 35051 }, // ̵
-    { 4, 5, 7, 2, -2, 5, 35061 }, // ̹
-    { 10, 4, 9, -2, -1, 10, 35066 }, // ̺
-    { 9, 7, 10, 0, 0, 16, 35076 }, // ̻
-    { 9, 5, 10, 0, 0, 12, 35092 }, // ̼
-    { 7, 5, 13, 5, 19, 9, 35104 }, // ̽
-    { 10, 5, 16, 5, 19, 13, 35113 }, // ͂
-    { 5, 5, 11, 5, 21, 7, 35126 }, // ̓
-    { 12, 11, 18, 5, 26, 33, 35133 }, // ̈́
-    { 9, 5, 16, 6, 20, 12, 35166 }, // ͆
-    { 14, 9, 14, -1, 0, 32, 35178 }, // ͇
-    { 11, 7, 12, 0, 0, 20, 35210 }, // ͈
-    { 8, 7, 9, 0, -1, 14, 35230 }, // ͉
-    { 12, 15, 18, 5, 24, 45, 35244 }, // ͊
-    { 24, 11, 33, 8, 22, 66, 35289 }, // ͋
-    { 18, 12, 24, 5, 13, 54, 35355 }, // ͌
-    { 12, 8, 15, 2, 0, 24, 35409 }, // ͍
-    { 4, 4, 8, 3, 3, 4, 35433 }, // ͎
-    { 21, 5, 23, 1, 0, 27, 35437 }, // ͜
-    { 21, 5, 27, 5, 19, 27, 35464 }, // ͡
-    { 25, 6, 26, 0, -2, 38, 35491 }, // ͢
-    { 20, 21, 25, 1, 21, 105, 35529 }, // Α
-    { 19, 22, 21, 1, 22, 105, 35634 }, // Β
-    { 17, 21, 19, 1, 19, 90, 35739 }, // Γ
-    { 20, 19, 22, 1, 19, 95, 35829 }, // Δ
-    { 19, 22, 21, 1, 22, 105, 35924 }, // Ε
-    { 25, 21, 27, 1, 21, 132, 36029 }, // Ζ
-    { 23, 22, 25, 1, 22, 127, 36161 }, // Η
-    { 24, 22, 27, 2, 21, 132, 36288 }, // Θ
-    { 10, 21, 12, 1, 21, 53, 36420 }, // Ι
-    { 20, 21, 22, 1, 21, 105, 36473 }, // Κ
-    { 20, 22, 25, 1, 21, 110, 36578 }, // Λ
-    { 26, 22, 28, 1, 22, 143, 36688 }, // Μ
-    { 24, 22, 26, 1, 22, 132, 36831 }, // Ν
-    { 20, 18, 22, 1, 18, 90, 36963 }, // Ξ
-    { 24, 22, 27, 2, 21, 132, 37053 }, // Ο
-    { 18, 18, 20, 1, 18, 81, 37185 }, // Π
-    { 20, 21, 22, 1, 21, 105, 37266 }, // Ρ
-    { 17, 19, 19, 1, 18, 81, 37371 }, // Σ
-    { 20, 21, 26, 5, 21, 105, 37452 }, // Τ
-    { 18, 21, 25, 6, 21, 95, 37557 }, // Υ
-    { 30, 26, 33, 2, 23, 195, 37652 }, // Φ
-    { 24, 22, 26, 1, 22, 132, 37847 }, // Χ
-    { 20, 22, 25, 4, 20, 110, 37979 }, // Ψ
-    { 22, 20, 24, 1, 19, 110, 38089 }, // Ω
-    { 20, 16, 23, 1, 15, 80, 38199 }, // α
-    { 18, 30, 19, 0, 24, 135, 38279 }, // β
-    { 13, 22, 19, 5, 14, 72, 38414 }, // γ
-    { 17, 21, 20, 2, 21, 90, 38486 }, // δ
-    { 11, 13, 14, 2, 13, 36, 38576 }, // ε
-    { 16, 21, 19, 2, 18, 84, 38612 }, // ζ
-    { 16, 23, 20, 3, 16, 92, 38696 }, // η
-    { 17, 19, 20, 2, 19, 81, 38788 }, // θ
-    { 8, 17, 13, 1, 17, 34, 38869 }, // ι
-    { 14, 15, 15, 0, 15, 53, 38903 }, // κ
-    { 19, 21, 19, -9, 21, 100, 38956 }, // λ
-    { 18, 17, 18, -1, 14, 77, 39056 }, // μ
-    { 13, 14, 19, 5, 14, 46, 39133 }, // ν
-    { 13, 21, 17, 3, 18, 69, 39179 }, // ξ
-    { 17, 14, 19, 1, 14, 60, 39248 }, // ο
-    { 17, 14, 21, 3, 13, 60, 39308 }, // π
-    { 20, 20, 21, 0, 14, 100, 39368 }, // ρ
-    { 12, 17, 17, 4, 18, 51, 39468 }, // ς
-    { 23, 14, 25, 1, 14, 81, 39519 }, // σ
-    { 14, 14, 19, 4, 13, 49, 39600 }, // τ
-    { 12, 15, 16, 3, 15, 45, 39649 }, // υ
-    { 24, 30, 27, 2, 27, 180, 39694 }, // φ
-    { 21, 19, 22, 0, 14, 100, 39874 }, // χ
-    { 14, 24, 18, 3, 18, 84, 39974 }, // ψ
-    { 18, 14, 22, 2, 13, 63, 40058 }, // ω
-    { 20, 29, 25, 1, 21, 145, 40121 }, // Ạ
-    { 16, 22, 19, 1, 15, 88, 40266 }, // ạ
-    { 21, 32, 25, 1, 32, 168, 40354 }, // Ả
-    { 16, 22, 19, 1, 22, 88, 40522 }, // ả
-    { 26, 35, 28, 1, 35, 228, 40610 }, // Ấ
-    { 25, 28, 27, 1, 28, 175, 40838 }, // ấ
-    { 21, 32, 25, 1, 32, 168, 41013 }, // Ầ
-    { 17, 24, 19, 1, 24, 102, 41181 }, // ầ
-    { 25, 34, 27, 1, 34, 213, 41283 }, // Ẩ
-    { 17, 25, 19, 1, 25, 107, 41496 }, // ẩ
-    { 21, 35, 25, 1, 35, 184, 41603 }, // Ẫ
-    { 16, 26, 19, 1, 26, 104, 41787 }, // ẫ
-    { 21, 35, 25, 1, 27, 184, 41891 }, // Ậ
-    { 16, 26, 19, 1, 19, 104, 42075 }, // ậ
-    { 22, 40, 25, 1, 40, 220, 42179 }, // Ắ
-    { 17, 31, 19, 1, 31, 132, 42399 }, // ắ
-    { 22, 38, 25, 1, 38, 209, 42531 }, // Ằ
-    { 17, 29, 19, 1, 29, 124, 42740 }, // ằ
-    { 22, 39, 25, 1, 39, 215, 42864 }, // Ẳ
-    { 17, 33, 19, 1, 33, 141, 43079 }, // ẳ
-    { 22, 38, 25, 1, 38, 209, 43220 }, // Ẵ
-    { 17, 30, 19, 1, 30, 128, 43429 }, // ẵ
-    { 22, 39, 25, 1, 31, 215, 43557 }, // Ặ
-    { 17, 29, 19, 1, 22, 124, 43772 }, // ặ
-    { 19, 28, 21, 1, 22, 133, 43896 }, // Ẹ
-    { 16, 22, 19, 1, 15, 88, 44029 }, // ẹ
-    { 19, 30, 21, 1, 30, 143, 44117 }, // Ẻ
-    { 16, 25, 19, 1, 25, 100, 44260 }, // ẻ
-    { 19, 29, 21, 1, 29, 138, 44360 }, // Ẽ
-    { 17, 24, 19, 1, 24, 102, 44498 }, // ẽ
-    { 19, 33, 21, 1, 33, 157, 44600 }, // Ế
-    { 25, 25, 27, 1, 25, 157, 44757 }, // ế
-    { 19, 32, 21, 1, 32, 152, 44914 }, // Ề
-    { 17, 26, 19, 1, 26, 111, 45066 }, // ề
-    { 19, 33, 21, 1, 33, 157, 45177 }, // Ể
-    { 18, 29, 20, 1, 29, 131, 45334 }, // ể
-    { 19, 34, 21, 1, 34, 162, 45465 }, // Ễ
-    { 16, 29, 19, 1, 29, 116, 45627 }, // ễ
-    { 19, 33, 21, 1, 27, 157, 45743 }, // Ệ
-    { 19, 31, 21, 1, 24, 148, 45900 }, // ệ
-    { 13, 32, 15, 1, 32, 104, 46048 }, // Ỉ
-    { 11, 23, 13, 1, 23, 64, 46152 }, // ỉ
-    { 12, 28, 12, -1, 21, 84, 46216 }, // Ị
-    { 12, 29, 12, -1, 22, 87, 46300 }, // ị
-    { 24, 29, 27, 2, 21, 174, 46387 }, // Ọ
-    { 17, 22, 19, 1, 14, 94, 46561 }, // ọ
-    { 24, 31, 27, 2, 30, 186, 46655 }, // Ỏ
-    { 17, 25, 19, 1, 25, 107, 46841 }, // ỏ
-    { 29, 28, 32, 2, 27, 203, 46948 }, // Ố
-    { 25, 24, 27, 1, 24, 150, 47151 }, // ố
-    { 24, 34, 27, 2, 33, 204, 47301 }, // Ồ
-    { 17, 26, 19, 1, 26, 111, 47505 }, // ồ
-    { 29, 33, 32, 2, 32, 240, 47616 }, // Ổ
-    { 18, 28, 20, 1, 28, 126, 47856 }, // ổ
-    { 24, 35, 27, 2, 34, 210, 47982 }, // Ỗ
-    { 17, 29, 19, 1, 29, 124, 48192 }, // ỗ
-    { 24, 35, 27, 2, 27, 210, 48316 }, // Ộ
-    { 17, 30, 19, 1, 22, 128, 48526 }, // ộ
-    { 30, 32, 33, 2, 31, 240, 48654 }, // Ớ
-    { 19, 25, 21, 1, 25, 119, 48894 }, // ớ
-    { 30, 30, 33, 2, 29, 225, 49013 }, // Ờ
-    { 19, 23, 21, 1, 23, 110, 49238 }, // ờ
-    { 30, 31, 33, 2, 30, 233, 49348 }, // Ở
-    { 19, 25, 21, 1, 25, 119, 49581 }, // ở
-    { 30, 30, 33, 2, 29, 225, 49700 }, // Ỡ
-    { 19, 24, 21, 1, 24, 114, 49925 }, // ỡ
-    { 30, 31, 33, 2, 23, 233, 50039 }, // Ợ
-    { 19, 23, 21, 1, 15, 110, 50272 }, // ợ
-    { 23, 29, 25, 1, 22, 167, 50382 }, // Ụ
-    { 15, 21, 18, 2, 14, 79, 50549 }, // ụ
-    { 23, 32, 25, 1, 31, 184, 50628 }, // Ủ
-    { 15, 24, 18, 2, 23, 90, 50812 }, // ủ
-    { 27, 32, 29, 1, 31, 216, 50902 }, // Ứ
-    { 18, 24, 21, 2, 23, 108, 51118 }, // ứ
-    { 27, 30, 29, 1, 29, 203, 51226 }, // Ừ
-    { 18, 23, 21, 2, 22, 104, 51429 }, // ừ
-    { 27, 32, 29, 1, 31, 216, 51533 }, // Ử
-    { 18, 24, 21, 2, 23, 108, 51749 }, // ử
-    { 27, 31, 29, 1, 30, 210, 51857 }, // Ữ
-    { 18, 23, 21, 2, 22, 104, 52067 }, // ữ
-    { 27, 29, 29, 1, 22, 196, 52171 }, // Ự
-    { 18, 23, 21, 2, 16, 104, 52367 }, // ự
-    { 18, 29, 25, 6, 29, 131, 52471 }, // Ỳ
-    { 19, 30, 20, 0, 23, 143, 52602 }, // ỳ
-    { 21, 32, 25, 3, 21, 168, 52745 }, // Ỵ
-    { 19, 22, 20, 0, 14, 105, 52913 }, // ỵ
-    { 18, 31, 25, 6, 31, 140, 53018 }, // Ỷ
-    { 19, 32, 20, 0, 25, 152, 53158 }, // ỷ
-    { 18, 30, 25, 6, 30, 135, 53310 }, // Ỹ
-    { 19, 31, 20, 0, 24, 148, 53445 }, // ỹ
-    { 0, 0, 21, 0, 0, 0, 53593 }, //  
-    { 0, 0, 33, 0, 0, 0, 53593 }, //  
-    { 0, 0, 21, 0, 0, 0, 53593 }, //  
-    { 0, 0, 33, 0, 0, 0, 53593 }, //  
-    { 0, 0, 16, 0, 0, 0, 53593 }, //  
-    { 0, 0, 14, 0, 0, 0, 53593 }, //  
-    { 0, 0, 12, 0, 0, 0, 53593 }, //  
-    { 0, 0, 17, 0, 0, 0, 53593 }, //  
-    { 0, 0, 7, 0, 0, 0, 53593 }, //  
-    { 0, 0, 13, 0, 0, 0, 53593 }, //  
-    { 0, 0, 12, 0, 0, 0, 53593 }, //  
-    { 0, 0, 8, 0, 0, 0, 53593 }, // ​
-    { 0, 0, 1, 0, 0, 0, 53593 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 53593 }, // ‍
-    { 0, 0, 1, 0, 0, 0, 53593 }, // ‎
-    { 0, 0, 1, 0, 0, 0, 53593 }, // ‏
-    { 13, 3, 17, 3, 9, 10, 53593 }, // ‐
-    { 13, 3, 17, 3, 9, 10, 53603 }, // ‑
-    { 19, 3, 24, 4, 9, 15, 53613 }, // ‒
-    { 18, 4, 22, 3, 9, 18, 53628 }, // –
-    { 26, 4, 30, 3, 9, 26, 53646 }, // —
-    { 26, 4, 30, 3, 9, 26, 53672 }, // ―
-    { 17, 22, 18, 0, 18, 94, 53698 }, // ‖
-    { 21, 8, 22, 0, -2, 42, 53792 }, // ‗
-    { 8, 7, 14, 5, 21, 14, 53834 }, // ‘
-    { 8, 8, 14, 5, 22, 16, 53848 }, // ’
-    { 8, 8, 9, 0, 4, 16, 53864 }, // ‚
-    { 8, 7, 14, 5, 21, 14, 53880 }, // ‛
-    { 14, 7, 20, 5, 21, 25, 53894 }, // “
-    { 14, 7, 20, 5, 21, 25, 53919 }, // ”
-    { 8, 8, 9, 0, 4, 16, 53944 }, // „
-    { 14, 8, 20, 5, 21, 28, 53960 }, // ‟
-    { 14, 32, 19, 4, 25, 112, 53988 }, // †
-    { 16, 32, 19, 2, 25, 128, 54100 }, // ‡
-    { 17, 15, 18, 0, 18, 64, 54228 }, // •
-    { 7, 8, 11, 3, 11, 14, 54292 }, // ‣
-    { 5, 5, 7, 1, 5, 7, 54306 }, // ․
-    { 5, 5, 7, 1, 5, 7, 54313 }, // ‥
-    { 22, 5, 24, 1, 5, 28, 54320 }, // …
-    { 4, 3, 7, 2, 9, 3, 54348 }, // ‧
-    { 0, 0, 32, 0, 0, 0, 54351 }, //  
-    { 20, 22, 28, 6, 20, 110, 54351 }, // ‰
-    { 8, 8, 14, 5, 22, 16, 54461 }, // ′
-    { 14, 7, 20, 5, 21, 25, 54477 }, // ″
-    { 18, 8, 21, -3, 21, 36, 54502 }, // ‴
-    { 5, 7, 12, 6, 21, 9, 54538 }, // ‵
-    { 11, 7, 17, 5, 21, 20, 54547 }, // ‶
-    { 18, 8, 25, 6, 21, 36, 54567 }, // ‷
-    { 11, 5, 18, 6, 20, 14, 54603 }, // ‸
-    { 9, 12, 13, 3, 13, 27, 54617 }, // ‹
-    { 9, 12, 10, -2, 13, 27, 54644 }, // ›
-    { 32, 26, 34, 1, 23, 208, 54671 }, // ※
-    { 12, 25, 14, 1, 25, 75, 54879 }, // ‼
-    { 17, 31, 23, 5, 30, 132, 54954 }, // ‽
-    { 13, 3, 20, 6, 21, 10, 55086 }, // ‾
-    { 11, 5, 17, 5, 17, 14, 55096 }, // ‿
-    { 18, 16, 23, 4, 22, 72, 55110 }, // ⁂
-    { 20, 20, 28, 6, 19, 100, 55182 }, // ⁄
-    { 30, 28, 37, 6, 28, 210, 55282 }, // ⁇
-    { 21, 28, 28, 6, 28, 147, 55492 }, // ⁈
-    { 26, 30, 27, 0, 28, 195, 55639 }, // ⁉
-    { 25, 39, 25, -1, 27, 244, 55834 }, // ⁒
-    { 0, 0, 121, 0, 0, 0, 56078 }, //  
-    { 8, 10, 12, 3, 21, 20, 56078 }, // ⁰
-    { 8, 10, 12, 3, 21, 20, 56098 }, // ⁴
-    { 8, 10, 12, 3, 21, 20, 56118 }, // ⁵
-    { 9, 9, 13, 3, 20, 21, 56138 }, // ⁶
-    { 7, 10, 13, 5, 21, 18, 56159 }, // ⁷
-    { 9, 10, 13, 3, 21, 23, 56177 }, // ⁸
-    { 9, 9, 13, 3, 20, 21, 56200 }, // ⁹
-    { 16, 14, 19, 1, 14, 56, 56221 }, // ⁿ
-    { 12, 13, 14, 1, 13, 39, 56277 }, // ₀
-    { 6, 10, 8, -1, 6, 15, 56316 }, // ₁
-    { 9, 10, 9, -1, 6, 23, 56331 }, // ₂
-    { 9, 9, 9, -1, 5, 21, 56354 }, // ₃
-    { 8, 10, 8, -1, 6, 20, 56375 }, // ₄
-    { 8, 10, 8, -1, 6, 20, 56395 }, // ₅
-    { 9, 9, 9, -1, 5, 21, 56415 }, // ₆
-    { 7, 11, 9, 1, 6, 20, 56436 }, // ₇
-    { 9, 10, 9, -1, 6, 23, 56456 }, // ₈
-    { 9, 9, 9, -1, 5, 21, 56479 }, // ₉
-    { 14, 34, 18, 3, 25, 119, 56500 }, // ₍
-    { 14, 34, 11, -6, 25, 119, 56619 }, // ₎
-    { 24, 31, 25, 0, 26, 186, 56738 }, // ₡
-    { 22, 23, 24, 1, 22, 127, 56924 }, // ₢
-    { 19, 24, 21, 1, 24, 114, 57051 }, // ₤
-    { 25, 22, 26, 0, 22, 138, 57165 }, // ₦
-    { 21, 21, 23, 1, 21, 111, 57303 }, // ₧
-    { 28, 21, 29, 0, 21, 147, 57414 }, // ₨
-    { 21, 21, 21, -1, 21, 111, 57561 }, // ₩
-    { 24, 19, 29, 4, 19, 114, 57672 }, // ₪
-    { 18, 20, 21, 2, 20, 90, 57786 }, // ₫
-    { 19, 23, 22, 2, 20, 110, 57876 }, // €
-    { 20, 21, 26, 5, 21, 105, 57986 }, // ₮
-    { 24, 21, 26, 1, 21, 126, 58091 }, // ₱
-    { 21, 30, 25, 2, 26, 158, 58217 }, // ₲
-    { 28, 23, 31, 2, 22, 161, 58375 }, // ₴
-    { 13, 20, 17, 1, 18, 65, 58536 }, // ₵
-    { 23, 22, 29, 5, 22, 127, 58601 }, // ₸
-    { 15, 20, 19, 3, 19, 75, 58728 }, // ₹
-    { 15, 17, 18, 2, 16, 64, 58803 }, // ₺
-    { 18, 20, 21, 2, 20, 90, 58867 }, // ₼
-    { 24, 21, 22, -3, 21, 126, 58957 }, // ₽
-    { 16, 16, 19, -3, 12, 64, 59083 }, // ←
-    { 16, 15, 21, 4, 15, 60, 59147 }, // ↑
-    { 16, 16, 23, 6, 12, 64, 59207 }, // →
-    { 16, 15, 25, 8, 15, 60, 59271 }, // ↓
-    { 27, 13, 26, -2, 11, 88, 59331 }, // ↔
-    { 14, 26, 18, 3, 24, 91, 59419 }, // ↕
-    { 15, 11, 16, -3, 11, 42, 59510 }, // ↖
-    { 15, 11, 20, 4, 11, 42, 59552 }, // ↗
-    { 12, 16, 19, 6, 14, 48, 59594 }, // ↘
-    { 12, 16, 16, -2, 14, 48, 59642 }, // ↙
-    { 19, 16, 21, 0, 15, 76, 59690 }, // ⇐
-    { 20, 18, 25, 4, 18, 90, 59766 }, // ⇑
-    { 19, 16, 23, 3, 15, 76, 59856 }, // ⇒
-    { 20, 19, 30, 9, 18, 95, 59932 }, // ⇓
-    { 25, 16, 26, 0, 15, 100, 60027 }, // ⇔
-    { 16, 24, 23, 6, 15, 96, 60127 }, // ⇕
-    { 19, 20, 22, 2, 20, 95, 60223 }, // ∂
-    { 26, 23, 27, 0, 22, 150, 60318 }, // ∅
-    { 20, 19, 22, 1, 19, 95, 60468 }, // ∆
-    { 18, 18, 23, 4, 18, 81, 60563 }, // ∏
-    { 18, 18, 27, 8, 18, 81, 60644 }, // ∐
-    { 17, 19, 19, 1, 18, 81, 60725 }, // ∑
-    { 12, 4, 16, 3, 9, 12, 60806 }, // −
-    { 24, 21, 28, 3, 20, 126, 60818 }, // √
-    { 22, 12, 26, 3, 15, 66, 60944 }, // ∞
-    { 27, 28, 28, 0, 22, 189, 61010 }, // ∫
-    { 9, 15, 11, 1, 15, 34, 61199 }, // ∶
-    { 18, 12, 24, 5, 13, 54, 61233 }, // ≈
-    { 20, 22, 28, 6, 20, 110, 61287 }, // ≠
-    { 21, 19, 22, -1, 18, 100, 61397 }, // ≤
-    { 22, 19, 24, 1, 18, 105, 61497 }, // ≥
+    { 12, 25, 14, 1, 25, 43, 0 }, // !
+    { 13, 7, 19, 5, 21, 22, 43 }, // "
+    { 28, 22, 32, 3, 20, 86, 65 }, // #
+    { 23, 27, 26, 1, 24, 105, 151 }, // $
+    { 20, 21, 27, 6, 20, 77, 256 }, // %
+    { 20, 23, 25, 4, 22, 80, 333 }, // &
+    { 7, 8, 12, 4, 19, 11, 413 }, // '
+    { 14, 34, 18, 3, 25, 67, 424 }, // (
+    { 14, 34, 11, -6, 25, 70, 491 }, // )
+    { 13, 12, 19, 5, 19, 36, 561 }, // *
+    { 13, 12, 17, 3, 13, 26, 597 }, // +
+    { 8, 8, 9, 0, 4, 14, 623 }, // ,
+    { 13, 3, 17, 3, 9, 11, 637 }, // -
+    { 5, 5, 7, 1, 5, 6, 648 }, // .
+    { 25, 39, 23, -3, 27, 97, 654 }, // /
+    { 17, 19, 20, 2, 19, 64, 751 }, // 0
+    { 13, 19, 15, 1, 19, 42, 815 }, // 1
+    { 18, 19, 20, 1, 19, 52, 857 }, // 2
+    { 17, 19, 20, 2, 19, 49, 909 }, // 3
+    { 14, 19, 18, 3, 19, 47, 958 }, // 4
+    { 16, 19, 19, 2, 19, 48, 1005 }, // 5
+    { 17, 19, 20, 2, 19, 52, 1053 }, // 6
+    { 13, 19, 20, 6, 19, 36, 1105 }, // 7
+    { 17, 19, 20, 2, 19, 59, 1141 }, // 8
+    { 16, 19, 20, 3, 19, 57, 1200 }, // 9
+    { 9, 15, 11, 1, 15, 19, 1257 }, // :
+    { 10, 18, 11, 0, 14, 26, 1276 }, // ;
+    { 19, 15, 20, -1, 16, 42, 1302 }, // <
+    { 14, 9, 17, 2, 11, 17, 1344 }, // =
+    { 19, 15, 22, 2, 16, 41, 1361 }, // >
+    { 16, 28, 21, 4, 28, 58, 1402 }, // ?
+    { 25, 21, 30, 3, 20, 96, 1460 }, // @
+    { 20, 21, 25, 1, 21, 69, 1556 }, // A
+    { 19, 22, 21, 1, 22, 67, 1625 }, // B
+    { 22, 23, 24, 1, 22, 63, 1692 }, // C
+    { 22, 22, 24, 1, 22, 79, 1755 }, // D
+    { 19, 22, 21, 1, 22, 56, 1834 }, // E
+    { 18, 22, 20, 1, 22, 49, 1890 }, // F
+    { 21, 22, 25, 2, 22, 71, 1939 }, // G
+    { 23, 22, 25, 1, 22, 73, 2010 }, // H
+    { 10, 21, 12, 1, 21, 34, 2083 }, // I
+    { 18, 28, 18, -1, 22, 60, 2117 }, // J
+    { 20, 21, 22, 1, 21, 67, 2177 }, // K
+    { 15, 22, 19, 1, 22, 48, 2244 }, // L
+    { 26, 22, 28, 1, 22, 100, 2292 }, // M
+    { 24, 22, 26, 1, 22, 83, 2392 }, // N
+    { 24, 22, 27, 2, 21, 82, 2475 }, // O
+    { 20, 21, 22, 1, 21, 55, 2557 }, // P
+    { 24, 26, 26, 1, 22, 93, 2612 }, // Q
+    { 19, 22, 21, 1, 22, 64, 2705 }, // R
+    { 22, 23, 25, 1, 22, 71, 2769 }, // S
+    { 20, 21, 26, 5, 21, 49, 2840 }, // T
+    { 23, 23, 25, 1, 22, 76, 2889 }, // U
+    { 21, 22, 28, 6, 22, 66, 2965 }, // V
+    { 28, 21, 34, 5, 21, 96, 3031 }, // W
+    { 24, 22, 26, 1, 22, 74, 3127 }, // X
+    { 18, 21, 25, 6, 21, 55, 3201 }, // Y
+    { 25, 21, 27, 1, 21, 72, 3256 }, // Z
+    { 18, 35, 18, -1, 27, 76, 3328 }, // [
+    { 4, 24, 12, 6, 19, 36, 3404 }, // <backslash>
+    { 18, 35, 13, -6, 27, 74, 3440 }, // ]
+    { 10, 5, 16, 5, 23, 12, 3514 }, // ^
+    { 18, 4, 20, 0, -2, 14, 3526 }, // _
+    { 7, 4, 14, 6, 19, 8, 3540 }, // `
+    { 16, 15, 19, 1, 15, 43, 3548 }, // a
+    { 15, 23, 20, 3, 22, 64, 3591 }, // b
+    { 13, 16, 17, 1, 15, 33, 3655 }, // c
+    { 20, 22, 22, 1, 21, 65, 3688 }, // d
+    { 16, 15, 19, 1, 15, 45, 3753 }, // e
+    { 13, 20, 16, 2, 20, 40, 3798 }, // f
+    { 18, 21, 19, 0, 14, 62, 3838 }, // g
+    { 16, 21, 19, 1, 21, 57, 3900 }, // h
+    { 10, 22, 12, 1, 22, 31, 3957 }, // i
+    { 16, 28, 19, 2, 21, 56, 3988 }, // j
+    { 13, 20, 19, 1, 20, 51, 4044 }, // k
+    { 10, 21, 12, 1, 21, 34, 4095 }, // l
+    { 25, 14, 28, 1, 14, 68, 4129 }, // m
+    { 16, 14, 19, 1, 14, 46, 4197 }, // n
+    { 17, 14, 19, 1, 14, 43, 4243 }, // o
+    { 20, 21, 20, -1, 14, 65, 4286 }, // p
+    { 18, 21, 22, 1, 15, 63, 4351 }, // q
+    { 13, 14, 15, 1, 14, 28, 4414 }, // r
+    { 15, 14, 18, 1, 14, 36, 4442 }, // s
+    { 11, 19, 16, 4, 19, 37, 4478 }, // t
+    { 15, 15, 18, 2, 14, 43, 4515 }, // u
+    { 16, 14, 21, 4, 14, 42, 4558 }, // v
+    { 20, 14, 25, 4, 14, 56, 4600 }, // w
+    { 18, 14, 21, 1, 14, 44, 4656 }, // x
+    { 19, 21, 20, 0, 14, 57, 4700 }, // y
+    { 17, 14, 19, 1, 14, 35, 4757 }, // z
+    { 15, 24, 19, 3, 19, 51, 4792 }, // {
+    { 10, 22, 11, 0, 18, 33, 4843 }, // |
+    { 14, 24, 16, 0, 19, 48, 4876 }, // }
+    { 10, 5, 16, 5, 19, 17, 4924 }, // ~
+    { 0, 0, 21, 0, 0, 0, 4941 }, //  
+    { 10, 25, 13, 2, 19, 35, 4941 }, // ¡
+    { 13, 22, 17, 1, 19, 54, 4976 }, // ¢
+    { 19, 24, 21, 1, 24, 64, 5030 }, // £
+    { 15, 14, 19, 3, 16, 41, 5094 }, // ¤
+    { 19, 21, 23, 3, 18, 55, 5135 }, // ¥
+    { 10, 22, 11, 0, 18, 30, 5190 }, // ¦
+    { 19, 22, 21, 1, 19, 68, 5220 }, // §
+    { 12, 5, 18, 5, 20, 14, 5288 }, // ¨
+    { 11, 10, 18, 6, 23, 31, 5302 }, // ©
+    { 9, 9, 14, 4, 19, 22, 5333 }, // ª
+    { 17, 12, 20, 2, 12, 36, 5355 }, // «
+    { 13, 8, 17, 3, 9, 20, 5391 }, // ¬
+    { 13, 3, 17, 3, 9, 11, 5411 }, // ­
+    { 11, 10, 19, 7, 27, 37, 5422 }, // ®
+    { 10, 3, 17, 6, 18, 6, 5459 }, // ¯
+    { 13, 12, 18, 4, 20, 32, 5465 }, // °
+    { 16, 15, 18, 0, 14, 36, 5497 }, // ±
+    { 9, 9, 12, 2, 20, 18, 5533 }, // ²
+    { 8, 10, 12, 3, 20, 18, 5551 }, // ³
+    { 6, 5, 12, 5, 19, 8, 5569 }, // ´
+    { 18, 17, 18, -1, 14, 52, 5577 }, // µ
+    { 17, 21, 19, 1, 18, 65, 5629 }, // ¶
+    { 6, 5, 9, 2, 11, 7, 5694 }, // ·
+    { 7, 7, 8, 0, 1, 12, 5701 }, // ¸
+    { 6, 10, 10, 3, 21, 16, 5713 }, // ¹
+    { 9, 8, 14, 4, 18, 21, 5729 }, // º
+    { 17, 12, 16, -3, 12, 35, 5750 }, // »
+    { 20, 24, 28, 6, 22, 96, 5785 }, // ¼
+    { 22, 23, 29, 6, 21, 90, 5881 }, // ½
+    { 21, 24, 28, 5, 22, 97, 5971 }, // ¾
+    { 16, 28, 15, -2, 15, 61, 6068 }, // ¿
+    { 20, 28, 25, 1, 28, 82, 6129 }, // À
+    { 21, 33, 25, 1, 33, 92, 6211 }, // Á
+    { 21, 27, 25, 1, 27, 87, 6303 }, // Â
+    { 22, 29, 25, 1, 29, 94, 6390 }, // Ã
+    { 23, 29, 25, 1, 29, 92, 6484 }, // Ä
+    { 20, 30, 25, 1, 30, 89, 6576 }, // Å
+    { 33, 23, 36, 1, 22, 96, 6665 }, // Æ
+    { 22, 28, 24, 1, 22, 78, 6761 }, // Ç
+    { 19, 28, 21, 1, 28, 69, 6839 }, // È
+    { 19, 32, 21, 1, 32, 73, 6908 }, // É
+    { 19, 27, 21, 1, 27, 72, 6981 }, // Ê
+    { 20, 29, 22, 1, 29, 78, 7053 }, // Ë
+    { 12, 29, 14, 1, 29, 46, 7131 }, // Ì
+    { 14, 34, 16, 1, 34, 62, 7177 }, // Í
+    { 14, 28, 16, 1, 28, 61, 7239 }, // Î
+    { 15, 30, 17, 1, 30, 62, 7300 }, // Ï
+    { 23, 22, 24, 0, 22, 85, 7362 }, // Ð
+    { 24, 27, 26, 1, 27, 104, 7447 }, // Ñ
+    { 24, 29, 27, 2, 28, 98, 7551 }, // Ò
+    { 24, 33, 27, 2, 32, 103, 7649 }, // Ó
+    { 24, 28, 27, 2, 27, 99, 7752 }, // Ô
+    { 24, 29, 27, 2, 28, 102, 7851 }, // Õ
+    { 24, 29, 27, 2, 28, 99, 7953 }, // Ö
+    { 13, 7, 16, 2, 10, 19, 8052 }, // ×
+    { 44, 41, 36, -9, 31, 198, 8071 }, // Ø
+    { 23, 30, 25, 1, 29, 92, 8269 }, // Ù
+    { 23, 34, 25, 1, 33, 98, 8361 }, // Ú
+    { 23, 29, 25, 1, 28, 94, 8459 }, // Û
+    { 23, 30, 25, 1, 29, 94, 8553 }, // Ü
+    { 18, 33, 25, 6, 33, 73, 8647 }, // Ý
+    { 16, 20, 18, 1, 20, 54, 8720 }, // Þ
+    { 18, 20, 20, 1, 20, 64, 8774 }, // ß
+    { 16, 20, 19, 1, 20, 53, 8838 }, // à
+    { 16, 24, 19, 1, 24, 58, 8891 }, // á
+    { 17, 20, 19, 1, 20, 58, 8949 }, // â
+    { 16, 20, 19, 1, 20, 60, 9007 }, // ã
+    { 17, 21, 19, 1, 21, 58, 9067 }, // ä
+    { 16, 22, 19, 1, 22, 58, 9125 }, // å
+    { 26, 15, 31, 1, 15, 70, 9183 }, // æ
+    { 13, 21, 17, 1, 15, 45, 9253 }, // ç
+    { 16, 23, 19, 1, 23, 59, 9298 }, // è
+    { 17, 27, 19, 1, 27, 63, 9357 }, // é
+    { 17, 22, 19, 1, 22, 63, 9420 }, // ê
+    { 18, 24, 20, 1, 24, 65, 9483 }, // ë
+    { 9, 21, 11, 1, 21, 30, 9548 }, // ì
+    { 12, 25, 14, 1, 25, 42, 9578 }, // í
+    { 12, 20, 14, 1, 20, 42, 9620 }, // î
+    { 13, 22, 15, 1, 22, 44, 9662 }, // ï
+    { 22, 20, 25, 2, 20, 72, 9706 }, // ð
+    { 18, 21, 20, 1, 21, 67, 9778 }, // ñ
+    { 17, 23, 19, 1, 23, 57, 9845 }, // ò
+    { 17, 27, 19, 1, 27, 62, 9902 }, // ó
+    { 17, 22, 19, 1, 22, 60, 9964 }, // ô
+    { 17, 23, 19, 1, 23, 63, 10024 }, // õ
+    { 18, 23, 20, 1, 23, 62, 10087 }, // ö
+    { 16, 16, 21, 4, 16, 30, 10149 }, // ÷
+    { 24, 39, 22, -3, 26, 120, 10179 }, // ø
+    { 15, 22, 18, 2, 21, 54, 10299 }, // ù
+    { 15, 26, 18, 2, 25, 59, 10353 }, // ú
+    { 15, 21, 18, 2, 20, 57, 10412 }, // û
+    { 16, 22, 19, 2, 21, 58, 10469 }, // ü
+    { 19, 34, 20, 0, 27, 77, 10527 }, // ý
+    { 15, 26, 17, 1, 21, 68, 10604 }, // þ
+    { 20, 30, 21, 0, 23, 77, 10672 }, // ÿ
+    { 22, 28, 25, 1, 28, 85, 10749 }, // Ā
+    { 17, 20, 19, 1, 20, 52, 10834 }, // ā
+    { 22, 31, 25, 1, 31, 95, 10886 }, // Ă
+    { 17, 22, 19, 1, 22, 60, 10981 }, // ă
+    { 20, 27, 25, 1, 21, 84, 11041 }, // Ą
+    { 16, 20, 19, 1, 15, 53, 11125 }, // ą
+    { 22, 33, 24, 1, 32, 83, 11178 }, // Ć
+    { 15, 24, 17, 1, 23, 47, 11261 }, // ć
+    { 22, 31, 24, 1, 30, 84, 11308 }, // Ĉ
+    { 17, 22, 19, 1, 21, 51, 11392 }, // ĉ
+    { 22, 32, 24, 1, 31, 80, 11443 }, // Ċ
+    { 13, 23, 17, 1, 22, 43, 11523 }, // ċ
+    { 22, 33, 24, 1, 32, 84, 11566 }, // Č
+    { 16, 24, 18, 1, 23, 51, 11650 }, // č
+    { 22, 31, 24, 1, 31, 100, 11701 }, // Ď
+    { 24, 22, 26, 1, 21, 78, 11801 }, // ď
+    { 23, 22, 24, 0, 22, 85, 11879 }, // Đ
+    { 23, 22, 25, 1, 21, 75, 11964 }, // đ
+    { 20, 28, 22, 1, 28, 72, 12039 }, // Ē
+    { 18, 23, 20, 1, 23, 60, 12111 }, // ē
+    { 20, 30, 22, 1, 30, 81, 12171 }, // Ĕ
+    { 18, 26, 20, 1, 26, 67, 12252 }, // ĕ
+    { 19, 30, 21, 1, 30, 68, 12319 }, // Ė
+    { 16, 25, 19, 1, 25, 59, 12387 }, // ė
+    { 19, 27, 21, 1, 22, 68, 12446 }, // Ę
+    { 16, 21, 19, 1, 15, 58, 12514 }, // ę
+    { 19, 31, 21, 1, 31, 73, 12572 }, // Ě
+    { 17, 26, 19, 1, 26, 66, 12645 }, // ě
+    { 22, 29, 25, 2, 29, 90, 12711 }, // Ĝ
+    { 19, 28, 20, 0, 21, 81, 12801 }, // ĝ
+    { 22, 31, 25, 2, 31, 95, 12882 }, // Ğ
+    { 18, 30, 19, 0, 23, 83, 12977 }, // ğ
+    { 21, 30, 25, 2, 30, 85, 13060 }, // Ġ
+    { 18, 29, 19, 0, 22, 76, 13145 }, // ġ
+    { 21, 34, 25, 2, 22, 92, 13221 }, // Ģ
+    { 18, 30, 19, 0, 23, 80, 13313 }, // ģ
+    { 23, 28, 25, 1, 28, 91, 13393 }, // Ĥ
+    { 16, 27, 19, 1, 27, 72, 13484 }, // ĥ
+    { 23, 21, 25, 1, 21, 78, 13556 }, // Ħ
+    { 16, 21, 19, 1, 21, 63, 13634 }, // ħ
+    { 14, 31, 16, 1, 31, 64, 13697 }, // Ĩ
+    { 12, 22, 14, 1, 22, 44, 13761 }, // ĩ
+    { 15, 29, 17, 1, 29, 57, 13805 }, // Ī
+    { 13, 20, 15, 1, 20, 40, 13862 }, // ī
+    { 12, 27, 16, 3, 21, 45, 13902 }, // Į
+    { 12, 27, 12, -1, 22, 45, 13947 }, // į
+    { 12, 31, 14, 1, 31, 45, 13992 }, // İ
+    { 7, 15, 9, 1, 15, 23, 14037 }, // ı
+    { 20, 27, 23, 1, 21, 84, 14060 }, // Ĳ
+    { 23, 29, 25, 1, 22, 90, 14144 }, // ĳ
+    { 21, 34, 21, -1, 28, 87, 14234 }, // Ĵ
+    { 20, 28, 23, 2, 21, 70, 14321 }, // ĵ
+    { 20, 30, 22, 1, 21, 87, 14391 }, // Ķ
+    { 13, 32, 19, 1, 20, 67, 14478 }, // ķ
+    { 12, 14, 14, 0, 14, 36, 14545 }, // ĸ
+    { 15, 30, 19, 1, 30, 63, 14581 }, // Ĺ
+    { 14, 29, 16, 1, 29, 56, 14644 }, // ĺ
+    { 15, 33, 19, 1, 22, 65, 14700 }, // Ļ
+    { 11, 32, 12, 0, 21, 47, 14765 }, // ļ
+    { 16, 22, 19, 1, 22, 55, 14812 }, // Ľ
+    { 15, 22, 17, 1, 22, 49, 14867 }, // ľ
+    { 17, 22, 19, 1, 22, 52, 14916 }, // Ŀ
+    { 14, 21, 16, 1, 21, 46, 14968 }, // ŀ
+    { 34, 32, 23, -12, 26, 120, 15014 }, // Ł
+    { 23, 21, 16, -8, 21, 62, 15134 }, // ł
+    { 24, 30, 26, 1, 30, 105, 15196 }, // Ń
+    { 17, 24, 19, 1, 24, 61, 15301 }, // ń
+    { 24, 31, 26, 1, 22, 106, 15362 }, // Ņ
+    { 16, 23, 19, 1, 14, 64, 15468 }, // ņ
+    { 24, 30, 26, 1, 30, 103, 15532 }, // Ň
+    { 17, 24, 19, 1, 24, 67, 15635 }, // ň
+    { 18, 26, 17, -3, 26, 66, 15702 }, // ŉ
+    { 24, 28, 26, 1, 22, 100, 15768 }, // Ŋ
+    { 16, 19, 19, 1, 14, 56, 15868 }, // ŋ
+    { 24, 28, 27, 2, 27, 94, 15924 }, // Ō
+    { 18, 21, 20, 1, 21, 56, 16018 }, // ō
+    { 24, 31, 27, 2, 30, 106, 16074 }, // Ŏ
+    { 18, 25, 20, 1, 25, 65, 16180 }, // ŏ
+    { 24, 30, 27, 2, 29, 105, 16245 }, // Ő
+    { 21, 24, 23, 1, 24, 67, 16350 }, // ő
+    { 32, 21, 35, 2, 21, 102, 16417 }, // Œ
+    { 27, 15, 29, 1, 15, 76, 16519 }, // œ
+    { 19, 29, 21, 1, 29, 77, 16595 }, // Ŕ
+    { 13, 21, 15, 1, 21, 40, 16672 }, // ŕ
+    { 19, 34, 21, 1, 22, 87, 16712 }, // Ŗ
+    { 15, 27, 15, -1, 14, 51, 16799 }, // ŗ
+    { 19, 30, 21, 1, 30, 82, 16850 }, // Ř
+    { 13, 21, 15, 1, 21, 43, 16932 }, // ř
+    { 22, 33, 25, 1, 32, 91, 16975 }, // Ś
+    { 15, 23, 18, 1, 23, 51, 17066 }, // ś
+    { 22, 30, 25, 1, 29, 90, 17117 }, // Ŝ
+    { 16, 21, 18, 1, 21, 53, 17207 }, // ŝ
+    { 22, 28, 25, 1, 22, 86, 17260 }, // Ş
+    { 15, 21, 18, 1, 14, 52, 17346 }, // ş
+    { 22, 33, 25, 1, 32, 92, 17398 }, // Š
+    { 15, 23, 18, 1, 23, 52, 17490 }, // š
+    { 20, 26, 26, 5, 21, 63, 17542 }, // Ţ
+    { 11, 24, 16, 4, 19, 47, 17605 }, // ţ
+    { 20, 29, 26, 5, 29, 67, 17652 }, // Ť
+    { 14, 21, 19, 4, 21, 51, 17719 }, // ť
+    { 20, 21, 26, 5, 21, 54, 17770 }, // Ŧ
+    { 13, 19, 16, 2, 19, 46, 17824 }, // ŧ
+    { 23, 31, 25, 1, 30, 99, 17870 }, // Ũ
+    { 15, 23, 18, 2, 22, 61, 17969 }, // ũ
+    { 23, 29, 25, 1, 28, 85, 18030 }, // Ū
+    { 16, 21, 19, 2, 20, 53, 18115 }, // ū
+    { 23, 32, 25, 1, 31, 100, 18168 }, // Ŭ
+    { 16, 24, 19, 2, 23, 60, 18268 }, // ŭ
+    { 23, 32, 25, 1, 31, 99, 18328 }, // Ů
+    { 15, 24, 18, 2, 23, 61, 18427 }, // ů
+    { 24, 31, 26, 1, 30, 102, 18488 }, // Ű
+    { 19, 23, 22, 2, 22, 64, 18590 }, // ű
+    { 23, 27, 25, 1, 22, 88, 18654 }, // Ų
+    { 15, 20, 18, 2, 14, 55, 18742 }, // ų
+    { 28, 27, 34, 5, 27, 115, 18797 }, // Ŵ
+    { 20, 21, 25, 4, 21, 72, 18912 }, // ŵ
+    { 18, 28, 25, 6, 28, 70, 18984 }, // Ŷ
+    { 19, 29, 20, 0, 22, 75, 19054 }, // ŷ
+    { 18, 30, 25, 6, 30, 72, 19129 }, // Ÿ
+    { 25, 30, 27, 1, 30, 92, 19201 }, // Ź
+    { 17, 23, 19, 1, 23, 50, 19293 }, // ź
+    { 25, 29, 27, 1, 29, 88, 19343 }, // Ż
+    { 17, 22, 19, 1, 22, 48, 19431 }, // ż
+    { 25, 30, 27, 1, 30, 96, 19479 }, // Ž
+    { 17, 23, 19, 1, 23, 52, 19575 }, // ž
+    { 14, 20, 18, 3, 20, 43, 19627 }, // ſ
+    { 30, 24, 33, 2, 23, 101, 19670 }, // Ơ
+    { 19, 15, 21, 1, 15, 51, 19771 }, // ơ
+    { 20, 21, 22, 1, 21, 64, 19822 }, // Ƥ
+    { 20, 25, 20, -1, 18, 74, 19886 }, // ƥ
+    { 17, 19, 19, 1, 18, 45, 19960 }, // Ʃ
+    { 20, 21, 26, 5, 21, 53, 20005 }, // Ƭ
+    { 12, 22, 17, 4, 22, 44, 20058 }, // ƭ
+    { 20, 26, 26, 5, 21, 61, 20102 }, // Ʈ
+    { 27, 23, 29, 1, 22, 86, 20163 }, // Ư
+    { 18, 17, 21, 2, 16, 50, 20249 }, // ư
+    { 7, 4, 14, 6, 19, 8, 20299 }, // ̀
+    { 6, 5, 12, 5, 19, 8, 20307 }, // ́
+    { 11, 5, 11, -1, 0, 13, 20315 }, // ̂
+    { 10, 5, 16, 5, 19, 17, 20328 }, // ̃
+    { 13, 4, 18, 4, 17, 9, 20345 }, // ̄
+    { 17, 3, 25, 7, 22, 13, 20354 }, // ̅
+    { 11, 5, 17, 5, 18, 16, 20367 }, // ̆
+    { 5, 5, 11, 5, 20, 7, 20383 }, // ̇
+    { 12, 5, 18, 5, 20, 14, 20390 }, // ̈
+    { 6, 5, 11, 4, 16, 9, 20404 }, // ̉
+    { 7, 5, 13, 5, 19, 12, 20413 }, // ̊
+    { 17, 4, 23, 5, 19, 14, 20425 }, // ̋
+    { 11, 5, 17, 5, 19, 12, 20439 }, // ̌
+    { 18, 4, 11, -8, 20, 14, 20451 }, // ̏
+    { 8, 8, 13, 4, 19, 12, 20465 }, // ̒
+    { 8, 7, 13, 4, 18, 12, 20477 }, // ̓
+    { 8, 7, 5, -4, 18, 11, 20489 }, // ̔
+    { 6, 6, 7, 0, -1, 9, 20500 }, // ̘
+    { 5, 6, 8, 2, -1, 8, 20509 }, // ̙
+    { 11, 6, 18, 6, 20, 14, 20517 }, // ̚
+    { 5, 6, 10, 4, 16, 9, 20531 }, // ̛
+    { 4, 5, 5, 0, -2, 6, 20540 }, // ̜
+    { 6, 5, 10, 3, 4, 10, 20546 }, // ̝
+    { 6, 5, 7, 0, -1, 8, 20556 }, // ̞
+    { 6, 5, 7, 0, -2, 7, 20564 }, // ̟
+    { 12, 4, 13, 0, -3, 8, 20571 }, // ̠
+    { 5, 5, 6, 0, 1, 7, 20579 }, // ̣
+    { 13, 5, 13, -1, 0, 13, 20586 }, // ̤
+    { 7, 5, 13, 5, 19, 12, 20599 }, // ̥
+    { 8, 8, 9, 0, 4, 14, 20611 }, // ̦
+    { 7, 7, 8, 0, 1, 12, 20625 }, // ̧
+    { 7, 7, 8, 0, 1, 11, 20637 }, // ̨
+    { 6, 7, 6, -1, -1, 12, 20648 }, // ̩
+    { 9, 4, 10, 0, -1, 14, 20660 }, // ̪
+    { 11, 5, 12, 0, 0, 11, 20674 }, // ̬
+    { 11, 5, 11, -1, -1, 13, 20685 }, // ̭
+    { 10, 5, 16, 5, 19, 17, 20698 }, // ̰
+    { 10, 3, 17, 6, 18, 6, 20715 }, // ̱
+    { 11, 3, 12, 0, -2, 7, 20721 }, // ̲
+    { 10, 5, 16, 5, 19, 17, 20728 }, // ̴
+    { 13, 3, 17, 3, 9, 11, 20745 }, // ̵
+    { 4, 5, 7, 2, -2, 6, 20756 }, // ̹
+    { 10, 4, 9, -2, -1, 13, 20762 }, // ̺
+    { 9, 7, 10, 0, 0, 16, 20775 }, // ̻
+    { 9, 5, 10, 0, 0, 18, 20791 }, // ̼
+    { 7, 5, 13, 5, 19, 10, 20809 }, // ̽
+    { 10, 5, 16, 5, 19, 17, 20819 }, // ͂
+    { 5, 5, 11, 5, 21, 9, 20836 }, // ̓
+    { 12, 11, 18, 5, 26, 25, 20845 }, // ̈́
+    { 9, 5, 16, 6, 20, 15, 20870 }, // ͆
+    { 14, 9, 14, -1, 0, 17, 20885 }, // ͇
+    { 11, 7, 12, 0, 0, 23, 20902 }, // ͈
+    { 8, 7, 9, 0, -1, 10, 20925 }, // ͉
+    { 12, 15, 18, 5, 24, 37, 20935 }, // ͊
+    { 24, 11, 33, 8, 22, 42, 20972 }, // ͋
+    { 18, 12, 24, 5, 13, 40, 21014 }, // ͌
+    { 12, 8, 15, 2, 0, 14, 21054 }, // ͍
+    { 4, 4, 8, 3, 3, 5, 21068 }, // ͎
+    { 21, 5, 23, 1, 0, 17, 21073 }, // ͜
+    { 21, 5, 27, 5, 19, 17, 21090 }, // ͡
+    { 25, 6, 26, 0, -2, 24, 21107 }, // ͢
+    { 20, 21, 25, 1, 21, 69, 21131 }, // Α
+    { 19, 22, 21, 1, 22, 67, 21200 }, // Β
+    { 17, 21, 19, 1, 19, 47, 21267 }, // Γ
+    { 20, 19, 22, 1, 19, 61, 21314 }, // Δ
+    { 19, 22, 21, 1, 22, 56, 21375 }, // Ε
+    { 25, 21, 27, 1, 21, 72, 21431 }, // Ζ
+    { 23, 22, 25, 1, 22, 73, 21503 }, // Η
+    { 24, 22, 27, 2, 21, 87, 21576 }, // Θ
+    { 10, 21, 12, 1, 21, 34, 21663 }, // Ι
+    { 20, 21, 22, 1, 21, 67, 21697 }, // Κ
+    { 20, 22, 25, 1, 21, 66, 21764 }, // Λ
+    { 26, 22, 28, 1, 22, 100, 21830 }, // Μ
+    { 24, 22, 26, 1, 22, 83, 21930 }, // Ν
+    { 20, 18, 22, 1, 18, 40, 22013 }, // Ξ
+    { 24, 22, 27, 2, 21, 82, 22053 }, // Ο
+    { 18, 18, 20, 1, 18, 58, 22135 }, // Π
+    { 20, 21, 22, 1, 21, 55, 22193 }, // Ρ
+    { 17, 19, 19, 1, 18, 45, 22248 }, // Σ
+    { 20, 21, 26, 5, 21, 49, 22293 }, // Τ
+    { 18, 21, 25, 6, 21, 55, 22342 }, // Υ
+    { 30, 26, 33, 2, 23, 114, 22397 }, // Φ
+    { 24, 22, 26, 1, 22, 74, 22511 }, // Χ
+    { 20, 22, 25, 4, 20, 73, 22585 }, // Ψ
+    { 22, 20, 24, 1, 19, 72, 22658 }, // Ω
+    { 20, 16, 23, 1, 15, 52, 22730 }, // α
+    { 18, 30, 19, 0, 24, 81, 22782 }, // β
+    { 13, 22, 19, 5, 14, 53, 22863 }, // γ
+    { 17, 21, 20, 2, 21, 63, 22916 }, // δ
+    { 11, 13, 14, 2, 13, 31, 22979 }, // ε
+    { 16, 21, 19, 2, 18, 46, 23010 }, // ζ
+    { 16, 23, 20, 3, 16, 60, 23056 }, // η
+    { 17, 19, 20, 2, 19, 56, 23116 }, // θ
+    { 8, 17, 13, 1, 17, 28, 23172 }, // ι
+    { 14, 15, 15, 0, 15, 40, 23200 }, // κ
+    { 19, 21, 19, -9, 21, 55, 23240 }, // λ
+    { 18, 17, 18, -1, 14, 52, 23295 }, // μ
+    { 13, 14, 19, 5, 14, 39, 23347 }, // ν
+    { 13, 21, 17, 3, 18, 47, 23386 }, // ξ
+    { 17, 14, 19, 1, 14, 43, 23433 }, // ο
+    { 17, 14, 21, 3, 13, 40, 23476 }, // π
+    { 20, 20, 21, 0, 14, 55, 23516 }, // ρ
+    { 12, 17, 17, 4, 18, 35, 23571 }, // ς
+    { 23, 14, 25, 1, 14, 51, 23606 }, // σ
+    { 14, 14, 19, 4, 13, 29, 23657 }, // τ
+    { 12, 15, 16, 3, 15, 42, 23686 }, // υ
+    { 24, 30, 27, 2, 27, 114, 23728 }, // φ
+    { 21, 19, 22, 0, 14, 60, 23842 }, // χ
+    { 14, 24, 18, 3, 18, 78, 23902 }, // ψ
+    { 18, 14, 22, 2, 13, 50, 23980 }, // ω
+    { 20, 29, 25, 1, 21, 82, 24030 }, // Ạ
+    { 16, 22, 19, 1, 15, 54, 24112 }, // ạ
+    { 21, 32, 25, 1, 32, 92, 24166 }, // Ả
+    { 16, 22, 19, 1, 22, 57, 24258 }, // ả
+    { 26, 35, 28, 1, 35, 112, 24315 }, // Ấ
+    { 25, 28, 27, 1, 28, 85, 24427 }, // ấ
+    { 21, 32, 25, 1, 32, 98, 24512 }, // Ầ
+    { 17, 24, 19, 1, 24, 67, 24610 }, // ầ
+    { 25, 34, 27, 1, 34, 110, 24677 }, // Ẩ
+    { 17, 25, 19, 1, 25, 67, 24787 }, // ẩ
+    { 21, 35, 25, 1, 35, 109, 24854 }, // Ẫ
+    { 16, 26, 19, 1, 26, 76, 24963 }, // ẫ
+    { 21, 35, 25, 1, 27, 102, 25039 }, // Ậ
+    { 16, 26, 19, 1, 19, 66, 25141 }, // ậ
+    { 22, 40, 25, 1, 40, 113, 25207 }, // Ắ
+    { 17, 31, 19, 1, 31, 74, 25320 }, // ắ
+    { 22, 38, 25, 1, 38, 108, 25394 }, // Ằ
+    { 17, 29, 19, 1, 29, 73, 25502 }, // ằ
+    { 22, 39, 25, 1, 39, 111, 25575 }, // Ẳ
+    { 17, 33, 19, 1, 33, 80, 25686 }, // ẳ
+    { 22, 38, 25, 1, 38, 116, 25766 }, // Ẵ
+    { 17, 30, 19, 1, 30, 78, 25882 }, // ẵ
+    { 22, 39, 25, 1, 31, 111, 25960 }, // Ặ
+    { 17, 29, 19, 1, 22, 71, 26071 }, // ặ
+    { 19, 28, 21, 1, 22, 67, 26142 }, // Ẹ
+    { 16, 22, 19, 1, 15, 55, 26209 }, // ẹ
+    { 19, 30, 21, 1, 30, 70, 26264 }, // Ẻ
+    { 16, 25, 19, 1, 25, 61, 26334 }, // ẻ
+    { 19, 29, 21, 1, 29, 78, 26395 }, // Ẽ
+    { 17, 24, 19, 1, 24, 67, 26473 }, // ẽ
+    { 19, 33, 21, 1, 33, 84, 26540 }, // Ế
+    { 25, 25, 27, 1, 25, 84, 26624 }, // ế
+    { 19, 32, 21, 1, 32, 82, 26708 }, // Ề
+    { 17, 26, 19, 1, 26, 73, 26790 }, // ề
+    { 19, 33, 21, 1, 33, 86, 26863 }, // Ể
+    { 18, 29, 20, 1, 29, 77, 26949 }, // ể
+    { 19, 34, 21, 1, 34, 91, 27026 }, // Ễ
+    { 16, 29, 19, 1, 29, 80, 27117 }, // ễ
+    { 19, 33, 21, 1, 27, 83, 27197 }, // Ệ
+    { 19, 31, 21, 1, 24, 78, 27280 }, // ệ
+    { 13, 32, 15, 1, 32, 57, 27358 }, // Ỉ
+    { 11, 23, 13, 1, 23, 36, 27415 }, // ỉ
+    { 12, 28, 12, -1, 21, 43, 27451 }, // Ị
+    { 12, 29, 12, -1, 22, 45, 27494 }, // ị
+    { 24, 29, 27, 2, 21, 96, 27539 }, // Ọ
+    { 17, 22, 19, 1, 14, 56, 27635 }, // ọ
+    { 24, 31, 27, 2, 30, 103, 27691 }, // Ỏ
+    { 17, 25, 19, 1, 25, 60, 27794 }, // ỏ
+    { 29, 28, 32, 2, 27, 116, 27854 }, // Ố
+    { 25, 24, 27, 1, 24, 79, 27970 }, // ố
+    { 24, 34, 27, 2, 33, 114, 28049 }, // Ồ
+    { 17, 26, 19, 1, 26, 69, 28163 }, // ồ
+    { 29, 33, 32, 2, 32, 127, 28232 }, // Ổ
+    { 18, 28, 20, 1, 28, 73, 28359 }, // ổ
+    { 24, 35, 27, 2, 34, 121, 28432 }, // Ỗ
+    { 17, 29, 19, 1, 29, 79, 28553 }, // ỗ
+    { 24, 35, 27, 2, 27, 113, 28632 }, // Ộ
+    { 17, 30, 19, 1, 22, 72, 28745 }, // ộ
+    { 30, 32, 33, 2, 31, 122, 28817 }, // Ớ
+    { 19, 25, 21, 1, 25, 66, 28939 }, // ớ
+    { 30, 30, 33, 2, 29, 118, 29005 }, // Ờ
+    { 19, 23, 21, 1, 23, 65, 29123 }, // ờ
+    { 30, 31, 33, 2, 30, 121, 29188 }, // Ở
+    { 19, 25, 21, 1, 25, 68, 29309 }, // ở
+    { 30, 30, 33, 2, 29, 124, 29377 }, // Ỡ
+    { 19, 24, 21, 1, 24, 73, 29501 }, // ỡ
+    { 30, 31, 33, 2, 23, 119, 29574 }, // Ợ
+    { 19, 23, 21, 1, 15, 65, 29693 }, // ợ
+    { 23, 29, 25, 1, 22, 89, 29758 }, // Ụ
+    { 15, 21, 18, 2, 14, 54, 29847 }, // ụ
+    { 23, 32, 25, 1, 31, 97, 29901 }, // Ủ
+    { 15, 24, 18, 2, 23, 58, 29998 }, // ủ
+    { 27, 32, 29, 1, 31, 106, 30056 }, // Ứ
+    { 18, 24, 21, 2, 23, 62, 30162 }, // ứ
+    { 27, 30, 29, 1, 29, 103, 30224 }, // Ừ
+    { 18, 23, 21, 2, 22, 61, 30327 }, // ừ
+    { 27, 32, 29, 1, 31, 108, 30388 }, // Ử
+    { 18, 24, 21, 2, 23, 64, 30496 }, // ử
+    { 27, 31, 29, 1, 30, 111, 30560 }, // Ữ
+    { 18, 23, 21, 2, 22, 67, 30671 }, // ữ
+    { 27, 29, 29, 1, 22, 101, 30738 }, // Ự
+    { 18, 23, 21, 2, 16, 61, 30839 }, // ự
+    { 18, 29, 25, 6, 29, 68, 30900 }, // Ỳ
+    { 19, 30, 20, 0, 23, 74, 30968 }, // ỳ
+    { 21, 32, 25, 3, 21, 76, 31042 }, // Ỵ
+    { 19, 22, 20, 0, 14, 63, 31118 }, // ỵ
+    { 18, 31, 25, 6, 31, 73, 31181 }, // Ỷ
+    { 19, 32, 20, 0, 25, 77, 31254 }, // ỷ
+    { 18, 30, 25, 6, 30, 78, 31331 }, // Ỹ
+    { 19, 31, 20, 0, 24, 84, 31409 }, // ỹ
+    { 0, 0, 21, 0, 0, 0, 31493 }, //  
+    { 0, 0, 33, 0, 0, 0, 31493 }, //  
+    { 0, 0, 21, 0, 0, 0, 31493 }, //  
+    { 0, 0, 33, 0, 0, 0, 31493 }, //  
+    { 0, 0, 16, 0, 0, 0, 31493 }, //  
+    { 0, 0, 14, 0, 0, 0, 31493 }, //  
+    { 0, 0, 12, 0, 0, 0, 31493 }, //  
+    { 0, 0, 17, 0, 0, 0, 31493 }, //  
+    { 0, 0, 7, 0, 0, 0, 31493 }, //  
+    { 0, 0, 13, 0, 0, 0, 31493 }, //  
+    { 0, 0, 12, 0, 0, 0, 31493 }, //  
+    { 0, 0, 8, 0, 0, 0, 31493 }, // ​
+    { 0, 0, 1, 0, 0, 0, 31493 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 31493 }, // ‍
+    { 0, 0, 1, 0, 0, 0, 31493 }, // ‎
+    { 0, 0, 1, 0, 0, 0, 31493 }, // ‏
+    { 13, 3, 17, 3, 9, 11, 31493 }, // ‐
+    { 13, 3, 17, 3, 9, 11, 31504 }, // ‑
+    { 19, 3, 24, 4, 9, 16, 31515 }, // ‒
+    { 18, 4, 22, 3, 9, 13, 31531 }, // –
+    { 26, 4, 30, 3, 9, 19, 31544 }, // —
+    { 26, 4, 30, 3, 9, 19, 31563 }, // ―
+    { 17, 22, 18, 0, 18, 65, 31582 }, // ‖
+    { 21, 8, 22, 0, -2, 36, 31647 }, // ‗
+    { 8, 7, 14, 5, 21, 11, 31683 }, // ‘
+    { 8, 8, 14, 5, 22, 11, 31694 }, // ’
+    { 8, 8, 9, 0, 4, 14, 31705 }, // ‚
+    { 8, 7, 14, 5, 21, 11, 31719 }, // ‛
+    { 14, 7, 20, 5, 21, 22, 31730 }, // “
+    { 14, 7, 20, 5, 21, 21, 31752 }, // ”
+    { 8, 8, 9, 0, 4, 14, 31773 }, // „
+    { 14, 8, 20, 5, 21, 22, 31787 }, // ‟
+    { 14, 32, 19, 4, 25, 63, 31809 }, // †
+    { 16, 32, 19, 2, 25, 66, 31872 }, // ‡
+    { 17, 15, 18, 0, 18, 39, 31938 }, // •
+    { 7, 8, 11, 3, 11, 12, 31977 }, // ‣
+    { 5, 5, 7, 1, 5, 6, 31989 }, // ․
+    { 5, 5, 7, 1, 5, 6, 31995 }, // ‥
+    { 22, 5, 24, 1, 5, 21, 32001 }, // …
+    { 4, 3, 7, 2, 9, 5, 32022 }, // ‧
+    { 0, 0, 32, 0, 0, 0, 32027 }, //  
+    { 20, 22, 28, 6, 20, 81, 32027 }, // ‰
+    { 8, 8, 14, 5, 22, 11, 32108 }, // ′
+    { 14, 7, 20, 5, 21, 21, 32119 }, // ″
+    { 18, 8, 21, -3, 21, 30, 32140 }, // ‴
+    { 5, 7, 12, 6, 21, 10, 32170 }, // ‵
+    { 11, 7, 17, 5, 21, 20, 32180 }, // ‶
+    { 18, 8, 25, 6, 21, 31, 32200 }, // ‷
+    { 11, 5, 18, 6, 20, 11, 32231 }, // ‸
+    { 9, 12, 13, 3, 13, 18, 32242 }, // ‹
+    { 9, 12, 10, -2, 13, 19, 32260 }, // ›
+    { 32, 26, 34, 1, 23, 109, 32279 }, // ※
+    { 12, 25, 14, 1, 25, 43, 32388 }, // ‼
+    { 17, 31, 23, 5, 30, 77, 32431 }, // ‽
+    { 13, 3, 20, 6, 21, 11, 32508 }, // ‾
+    { 11, 5, 17, 5, 17, 15, 32519 }, // ‿
+    { 18, 16, 23, 4, 22, 62, 32534 }, // ⁂
+    { 20, 20, 28, 6, 19, 48, 32596 }, // ⁄
+    { 30, 28, 37, 6, 28, 117, 32644 }, // ⁇
+    { 21, 28, 28, 6, 28, 93, 32761 }, // ⁈
+    { 26, 30, 27, 0, 28, 103, 32854 }, // ⁉
+    { 25, 39, 25, -1, 27, 107, 32957 }, // ⁒
+    { 0, 0, 121, 0, 0, 0, 33064 }, //  
+    { 8, 10, 12, 3, 21, 28, 33064 }, // ⁰
+    { 8, 10, 12, 3, 21, 20, 33092 }, // ⁴
+    { 8, 10, 12, 3, 21, 19, 33112 }, // ⁵
+    { 9, 9, 13, 3, 20, 21, 33131 }, // ⁶
+    { 7, 10, 13, 5, 21, 16, 33152 }, // ⁷
+    { 9, 10, 13, 3, 21, 29, 33168 }, // ⁸
+    { 9, 9, 13, 3, 20, 22, 33197 }, // ⁹
+    { 16, 14, 19, 1, 14, 46, 33219 }, // ⁿ
+    { 12, 13, 14, 1, 13, 40, 33265 }, // ₀
+    { 6, 10, 8, -1, 6, 15, 33305 }, // ₁
+    { 9, 10, 9, -1, 6, 19, 33320 }, // ₂
+    { 9, 9, 9, -1, 5, 16, 33339 }, // ₃
+    { 8, 10, 8, -1, 6, 20, 33355 }, // ₄
+    { 8, 10, 8, -1, 6, 17, 33375 }, // ₅
+    { 9, 9, 9, -1, 5, 21, 33392 }, // ₆
+    { 7, 11, 9, 1, 6, 16, 33413 }, // ₇
+    { 9, 10, 9, -1, 6, 28, 33429 }, // ₈
+    { 9, 9, 9, -1, 5, 22, 33457 }, // ₉
+    { 14, 34, 18, 3, 25, 67, 33479 }, // ₍
+    { 14, 34, 11, -6, 25, 70, 33546 }, // ₎
+    { 24, 31, 25, 0, 26, 122, 33616 }, // ₡
+    { 22, 23, 24, 1, 22, 73, 33738 }, // ₢
+    { 19, 24, 21, 1, 24, 69, 33811 }, // ₤
+    { 25, 22, 26, 0, 22, 85, 33880 }, // ₦
+    { 21, 21, 23, 1, 21, 65, 33965 }, // ₧
+    { 28, 21, 29, 0, 21, 93, 34030 }, // ₨
+    { 21, 21, 21, -1, 21, 84, 34123 }, // ₩
+    { 24, 19, 29, 4, 19, 91, 34207 }, // ₪
+    { 18, 20, 21, 2, 20, 54, 34298 }, // ₫
+    { 19, 23, 22, 2, 20, 60, 34352 }, // €
+    { 20, 21, 26, 5, 21, 62, 34412 }, // ₮
+    { 24, 21, 26, 1, 21, 65, 34474 }, // ₱
+    { 21, 30, 25, 2, 26, 104, 34539 }, // ₲
+    { 28, 23, 31, 2, 22, 94, 34643 }, // ₴
+    { 13, 20, 17, 1, 18, 47, 34737 }, // ₵
+    { 23, 22, 29, 5, 22, 68, 34784 }, // ₸
+    { 15, 20, 19, 3, 19, 48, 34852 }, // ₹
+    { 15, 17, 18, 2, 16, 46, 34900 }, // ₺
+    { 18, 20, 21, 2, 20, 73, 34946 }, // ₼
+    { 24, 21, 22, -3, 21, 73, 35019 }, // ₽
+    { 16, 16, 19, -3, 12, 38, 35092 }, // ←
+    { 16, 15, 21, 4, 15, 42, 35130 }, // ↑
+    { 16, 16, 23, 6, 12, 41, 35172 }, // →
+    { 16, 15, 25, 8, 15, 40, 35213 }, // ↓
+    { 27, 13, 26, -2, 11, 56, 35253 }, // ↔
+    { 14, 26, 18, 3, 24, 65, 35309 }, // ↕
+    { 15, 11, 16, -3, 11, 31, 35374 }, // ↖
+    { 15, 11, 20, 4, 11, 30, 35405 }, // ↗
+    { 12, 16, 19, 6, 14, 39, 35435 }, // ↘
+    { 12, 16, 16, -2, 14, 40, 35474 }, // ↙
+    { 19, 16, 21, 0, 15, 34, 35514 }, // ⇐
+    { 20, 18, 25, 4, 18, 74, 35548 }, // ⇑
+    { 19, 16, 23, 3, 15, 38, 35622 }, // ⇒
+    { 20, 19, 30, 9, 18, 75, 35660 }, // ⇓
+    { 25, 16, 26, 0, 15, 56, 35735 }, // ⇔
+    { 16, 24, 23, 6, 15, 82, 35791 }, // ⇕
+    { 19, 20, 22, 2, 20, 61, 35873 }, // ∂
+    { 26, 23, 27, 0, 22, 100, 35934 }, // ∅
+    { 20, 19, 22, 1, 19, 61, 36034 }, // ∆
+    { 18, 18, 23, 4, 18, 55, 36095 }, // ∏
+    { 18, 18, 27, 8, 18, 54, 36150 }, // ∐
+    { 17, 19, 19, 1, 18, 45, 36204 }, // ∑
+    { 12, 4, 16, 3, 9, 8, 36249 }, // −
+    { 24, 21, 28, 3, 20, 60, 36257 }, // √
+    { 22, 12, 26, 3, 15, 58, 36317 }, // ∞
+    { 27, 28, 28, 0, 22, 76, 36375 }, // ∫
+    { 9, 15, 11, 1, 15, 19, 36451 }, // ∶
+    { 18, 12, 24, 5, 13, 40, 36470 }, // ≈
+    { 20, 22, 28, 6, 20, 54, 36510 }, // ≠
+    { 21, 19, 22, -1, 18, 57, 36564 }, // ≤
+    { 22, 19, 24, 1, 18, 61, 36621 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_12_italicIntervals[] = {
@@ -4595,4 +3037,5 @@ static const EpdFontData opendyslexic_12_italic = {
     33,
     -13,
     true,
+    true,
 };
@@ -2,3904 +2,2825 @@
  * generated by fontconvert.py
  * name: opendyslexic_12_regular
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_12_regular 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py opendyslexic_12_regular 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_regularBitmaps[51630] = {
-    0x01, 0x80, 0x3C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xFC, 0x0F,
-    0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x40, 0x00, 0x3F, 0x83,
-    0xF8, 0x7F, 0xCB, 0xFC, 0xFF, 0xC0, 0xBF, 0x83, 0xFC, 0xBF, 0x43, 0xFC, 0xBF, 0x03, 0xFC, 0xBF,
-    0x03, 0xF8, 0xBF, 0x03, 0xF4, 0xFF, 0x03, 0xF4, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x01, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x1D, 0x10, 0x00, 0x1F,
-    0xD7, 0x47, 0x40, 0x00, 0x0B, 0xE1, 0xD1, 0xD0, 0x00, 0x02, 0xF8, 0x74, 0x74, 0x00, 0x00, 0x7F,
-    0x1D, 0x1D, 0x00, 0x00, 0x0F, 0xFF, 0x8B, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0x4B, 0xFF, 0xF0, 0x00, 0x01,
-    0xD1, 0xEF, 0xFE, 0x00, 0x00, 0x74, 0x77, 0xFF, 0xC0, 0x00, 0x1D, 0x1E, 0xFF, 0xF0, 0x1F, 0xEF,
-    0xAF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xD1, 0xD0, 0x00, 0x00, 0x00, 0x74,
-    0x74, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x00, 0x03, 0x80, 0x1F, 0xD0, 0x02, 0xC0, 0x1E, 0x6D, 0x00, 0xE0, 0x0D, 0x01, 0xC0,
-    0xF0, 0x03, 0x00, 0x30, 0x74, 0x01, 0xC0, 0x0D, 0x3C, 0x00, 0x34, 0x03, 0x2D, 0x00, 0x0F, 0x47,
-    0xDF, 0x00, 0x01, 0xFF, 0xEF, 0x00, 0x00, 0x1F, 0xD7, 0x80, 0x00, 0x00, 0x03, 0xDF, 0xF8, 0x00,
-    0x02, 0xEE, 0x03, 0x80, 0x00, 0xF7, 0x00, 0x70, 0x00, 0xF5, 0xC0, 0x1C, 0x00, 0x7C, 0x70, 0x07,
-    0x00, 0x3D, 0x0E, 0x47, 0xC0, 0x2F, 0x02, 0xFF, 0xD0, 0x1F, 0x00, 0x2F, 0xD0, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x80,
-    0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00,
-    0x0B, 0xE0, 0xBF, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFC, 0x00, 0x14, 0x1F, 0xD0,
-    0x3F, 0x00, 0xFC, 0x3F, 0xC0, 0x0F, 0xD1, 0xFC, 0x3F, 0xC0, 0x02, 0xF7, 0xF4, 0x3F, 0xC0, 0x00,
-    0xBF, 0xF0, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x1F, 0xFE, 0x57, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFE,
-    0xF4, 0x02, 0xFF, 0xFF, 0xF0, 0x20, 0x00, 0x2B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x6F, 0xDB, 0xF7, 0xFC, 0xFF, 0x3F, 0xCF, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0xB4,
-    0x00, 0xF0, 0x02, 0xE0, 0x03, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x0F, 0x00, 0x2E, 0x00, 0x3E, 0x00,
-    0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x0F, 0xC0,
-    0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x15, 0x74, 0x00,
-    0x3C, 0x00, 0x2E, 0x00, 0x0F, 0x00, 0x0B, 0x80, 0x03, 0xC0, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xF0,
-    0x00, 0xF4, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D,
-    0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0xF4,
-    0x02, 0xF0, 0x03, 0xE0, 0x03, 0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x1F, 0x40, 0x3F, 0x00, 0x7E, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xE0, 0x10, 0x74, 0x38, 0x2D, 0x2F,
-    0xCE, 0x7D, 0x00, 0x7F, 0xF4, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xFF, 0xE4, 0x1F, 0xCE, 0x2F, 0x83,
-    0x83, 0xC0, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF4,
-    0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2C, 0x00,
-    0x05, 0x51, 0xFE, 0x2F, 0xD2, 0xFC, 0x2F, 0xC3, 0xF8, 0x7F, 0x4B, 0xF0, 0x2A, 0xAA, 0xAA, 0x0F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xC3, 0xF1, 0xFC, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x1E, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0x00, 0xF4, 0x00, 0xB4, 0x0F, 0x00,
-    0x03, 0xC2, 0xF0, 0x00, 0x3C, 0x2E, 0x0B, 0x03, 0xD3, 0xE0, 0xF8, 0x3D, 0x3E, 0x0F, 0x83, 0xE3,
-    0xE0, 0xF4, 0x3E, 0x3F, 0x07, 0x03, 0xE3, 0xF0, 0x00, 0x7D, 0x2F, 0x40, 0x0B, 0xD2, 0xFC, 0x01,
-    0xFC, 0x1F, 0xFA, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0x7D, 0x00, 0x04,
-    0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBD, 0x00,
-    0x15, 0xFE, 0x94, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x01, 0xBF, 0x90, 0x0B,
-    0xFF, 0xFF, 0x02, 0xE4, 0x1B, 0xE0, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xC0,
-    0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xFA, 0xA9,
-    0x2F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0x06, 0xFF, 0x90, 0x03, 0xFA, 0xFF,
-    0x00, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0xBC, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x3F, 0xAF, 0xFE, 0x1F, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x3E, 0x78,
-    0x00, 0x0F, 0xC7, 0x80, 0x02, 0xF0, 0xBC, 0x00, 0x7E, 0x0B, 0xC0, 0x0F, 0xC0, 0xBC, 0x03, 0xF5,
-    0x5F, 0xD5, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x0A, 0xAB, 0xFD, 0x07, 0xFF,
-    0xFF, 0x81, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x2F, 0xFF, 0xFC, 0x05, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xE1, 0x80, 0x07, 0xF4, 0x7F, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x0B, 0xFF, 0xF4,
-    0x02, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x03, 0xE2, 0xFE, 0x40, 0x3F, 0xFF, 0xFE, 0x03, 0xFE, 0x02, 0xF8, 0x3F, 0x80, 0x0B, 0xC3,
-    0xF0, 0x00, 0x3D, 0x2F, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x3D, 0x1F, 0x80, 0x0B, 0xD0, 0xFE, 0x56,
-    0xFC, 0x07, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xE0, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xE2, 0xAF, 0xFF, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xD0,
-    0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xE0,
-    0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x0B, 0x91,
-    0xB8, 0x00, 0x78, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0xF0, 0x0F, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x1F,
-    0x00, 0xBC, 0x00, 0xF8, 0x00, 0xFD, 0x5F, 0xC0, 0x00, 0xBF, 0xF8, 0x00, 0x07, 0xFF, 0xF4, 0x00,
-    0xBE, 0x02, 0xF8, 0x07, 0xE0, 0x02, 0xF4, 0x2F, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0x3F, 0x0F, 0xE0, 0x02, 0xFC, 0x0F, 0xFA, 0xBF, 0xC0, 0x1F, 0xFF, 0xFD, 0x00, 0x0A, 0xFE,
-    0x80, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0xAF, 0xD0, 0x0F, 0x80, 0x3F, 0x01, 0xF0, 0x00, 0xF8,
-    0x2D, 0x00, 0x0F, 0xC3, 0xD0, 0x00, 0xBC, 0x3D, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0x7D, 0x2F, 0x00,
-    0x0B, 0xE0, 0xFC, 0x01, 0xFE, 0x0B, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFD, 0x00, 0x05, 0x43, 0xD0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x65, 0x56, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xE4, 0x00, 0x3F, 0x0F, 0xD7, 0xF6, 0xFE, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0xFC, 0x7F, 0x6F, 0xDB, 0xF8, 0x0F, 0xC1, 0xFC, 0x2F, 0xC3, 0xFD, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x51, 0xFE, 0x2F, 0xD2, 0xFC, 0x2F, 0xC3, 0xF8,
-    0x7F, 0x4B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xE4, 0x00, 0x00,
-    0x1B, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00,
-    0x1B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x83, 0xFF, 0xFE,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xE0, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01,
-    0xBF, 0xFC, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x6F, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x03,
-    0xFE, 0x40, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00,
-    0x0F, 0xFF, 0xFD, 0x03, 0xF9, 0x6F, 0xF0, 0x2C, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xF9, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x02,
-    0xD0, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x01, 0xF0, 0x0F, 0xE8,
-    0x02, 0xC0, 0x3E, 0x03, 0x87, 0xC0, 0x1C, 0x03, 0xC0, 0x60, 0x2C, 0x00, 0xD0, 0xBC, 0x09, 0x02,
-    0xC0, 0x1D, 0x0B, 0xC0, 0xD0, 0x2C, 0x02, 0xC0, 0xBD, 0x0F, 0x4B, 0xC0, 0x3C, 0x0B, 0xE0, 0x7F,
-    0xFD, 0x0F, 0x40, 0x7F, 0x01, 0xF8, 0xEB, 0xD0, 0x03, 0xFC, 0x00, 0x02, 0xE0, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x01, 0xA0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2,
-    0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC,
-    0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40,
-    0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0,
-    0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0xFF, 0x40, 0x7E, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x03, 0xE0, 0x7E, 0x00, 0x02, 0xF0,
-    0x7E, 0x00, 0x02, 0xE0, 0x7E, 0x00, 0x03, 0xE0, 0x7F, 0xAA, 0xAF, 0xC0, 0x7F, 0xFF, 0xFE, 0x00,
-    0x7F, 0xFF, 0xFF, 0x80, 0x7E, 0x00, 0x07, 0xF4, 0x7E, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0xBD,
-    0x7E, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0xBE, 0x7E, 0x00, 0x00, 0xFE, 0x7E, 0x00, 0x0B, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x04, 0x0F, 0xFF, 0xFA, 0x6B, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF9,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x7E, 0x00, 0x1B, 0xFD,
-    0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xC0, 0x7E, 0x00, 0x00, 0x1F, 0xD0,
-    0x7E, 0x00, 0x00, 0x0F, 0xE0, 0x7E, 0x00, 0x00, 0x0B, 0xF0, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x7E,
-    0x00, 0x00, 0x07, 0xF4, 0x7E, 0x00, 0x00, 0x07, 0xF4, 0x7E, 0x00, 0x00, 0x07, 0xF4, 0x7E, 0x00,
-    0x00, 0x0F, 0xF4, 0x7E, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0x55, 0x5B, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF,
-    0xFE, 0x0B, 0xFF, 0xEA, 0xA0, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xF8, 0x7F, 0x50, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xD0, 0xBE, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFE, 0x40, 0x01, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xA5, 0x00, 0x3F, 0x40, 0x01,
-    0xFF, 0xFE, 0x3F, 0x40, 0x00, 0x6F, 0xFE, 0x3F, 0x80, 0x00, 0x01, 0xFA, 0x3F, 0xC0, 0x00, 0x01,
-    0xF0, 0x2F, 0xF4, 0x00, 0x02, 0xF0, 0x1F, 0xFF, 0xAA, 0xAF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00,
-    0x03, 0xF0, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0xFD,
-    0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x00, 0x3F, 0x43, 0xF8,
-    0x00, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0,
-    0xFF, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x3F, 0xC0,
-    0x00, 0x1F, 0xF1, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3,
-    0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x8F, 0xE7, 0xF9,
-    0xFF, 0x7F, 0xDF, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00,
-    0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80,
-    0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xBF,
-    0x01, 0x0B, 0xFC, 0x0F, 0xFF, 0xD0, 0x3F, 0xFF, 0x00, 0xFF, 0xF4, 0x03, 0xFF, 0x00, 0x01, 0x40,
-    0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x02, 0xF4, 0x07, 0xF0, 0x00, 0xBD, 0x03, 0xF8, 0x00, 0x2F, 0x42,
-    0xFC, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x03, 0xF0, 0xFF, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x3F,
-    0x3F, 0x80, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x02, 0xFA, 0xFF, 0x40,
-    0x00, 0xFE, 0x3F, 0xF4, 0x00, 0x3F, 0x83, 0xFF, 0x40, 0x0F, 0xE0, 0x7F, 0xF4, 0x03, 0xF4, 0x0B,
-    0xFF, 0x40, 0xFD, 0x00, 0xFF, 0xF4, 0x3F, 0x40, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x02, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x1F,
-    0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x01, 0xFF, 0xF4, 0x00, 0xBF, 0xFC,
-    0x07, 0xEF, 0xF0, 0x03, 0xFB, 0xF0, 0x2F, 0x7F, 0xD0, 0x1F, 0xDF, 0xC0, 0xBD, 0x7F, 0x80, 0xFF,
-    0x3F, 0x02, 0xF8, 0xFF, 0x03, 0xF5, 0xFD, 0x0B, 0xE2, 0xFE, 0x2F, 0xC7, 0xF4, 0x2F, 0x87, 0xFC,
-    0xFF, 0x1F, 0xD0, 0xFE, 0x0F, 0xFB, 0xF4, 0xBF, 0x83, 0xFC, 0x1F, 0xFF, 0xC2, 0xFE, 0x0F, 0xF0,
-    0x3F, 0xFE, 0x0B, 0xF8, 0x3F, 0xC0, 0xBF, 0xF4, 0x2F, 0xF0, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xC3,
-    0xFC, 0x03, 0xFE, 0x03, 0xFF, 0x0F, 0xF0, 0x07, 0xF0, 0x0F, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0F,
-    0xC0, 0xBF, 0x40, 0x00, 0x3F, 0x03, 0xFE, 0x00, 0x00, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xF0, 0x3F,
-    0xF8, 0x00, 0x1F, 0xC0, 0xFF, 0xF0, 0x00, 0x7F, 0x03, 0xFF, 0xE0, 0x02, 0xFC, 0x0F, 0xDF, 0xC0,
-    0x0B, 0xE0, 0x7F, 0x3F, 0x80, 0x2F, 0x81, 0xFC, 0x7F, 0x00, 0xBE, 0x07, 0xF0, 0xFE, 0x03, 0xF8,
-    0x2F, 0xC1, 0xFC, 0x0F, 0xE0, 0xBF, 0x03, 0xF4, 0x3F, 0x42, 0xFC, 0x07, 0xF0, 0xFD, 0x0B, 0xF0,
-    0x0F, 0xD3, 0xF4, 0x3F, 0xC0, 0x2F, 0xDF, 0xD0, 0xFF, 0x40, 0x3F, 0xBF, 0x43, 0xFD, 0x00, 0xBF,
-    0xFC, 0x0F, 0xF4, 0x00, 0xFF, 0xF0, 0x3F, 0xD0, 0x02, 0xFF, 0xC0, 0xFF, 0x40, 0x03, 0xFF, 0x00,
-    0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07,
-    0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80,
-    0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00,
-    0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00,
-    0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xF5, 0x56, 0xFD, 0x0B, 0xC0, 0x00, 0xFC, 0x2F, 0x00, 0x01,
-    0xF4, 0xBC, 0x00, 0x07, 0xD2, 0xF0, 0x00, 0x2F, 0x4F, 0xC0, 0x02, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xF9, 0x01,
-    0xFF, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00,
-    0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x1F, 0xC0, 0x00, 0x00,
-    0x2F, 0x87, 0xE0, 0x00, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x00, 0x00,
-    0x7E, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x47, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x19, 0x03,
-    0xF0, 0x3F, 0xE0, 0x0F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x05, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0x00, 0x0F, 0x00, 0x1F, 0xC0, 0x0F, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x03, 0xD0, 0x1F, 0x00,
-    0x03, 0xE0, 0x1F, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x1F, 0xD0, 0x2F, 0xAA, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x3F, 0xC0, 0x2F, 0xC0, 0x3F, 0x80,
-    0x0B, 0xE0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07, 0xF4, 0x3F, 0xC0,
-    0x07, 0xF8, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07, 0xFD, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x90,
-    0x04, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x17, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x01, 0x40,
-    0x00, 0x3F, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xAF, 0xEA, 0xFF, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0x43, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0x80,
-    0x00, 0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x01, 0xFD,
-    0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xC3, 0xF4, 0x00,
-    0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3,
-    0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x02, 0xFC, 0x2F, 0xE0, 0x00,
-    0x7F, 0xC1, 0xFF, 0xEA, 0xBF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC2, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x00,
-    0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x40, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x0B,
-    0xF4, 0x00, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0xBF,
-    0x40, 0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x4F, 0xF4,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD2, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-    0x02, 0xFC, 0x00, 0x7F, 0x80, 0x07, 0xF0, 0x07, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xD0,
-    0x1F, 0xFE, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0xFF, 0xFC, 0x07, 0xF0, 0x00, 0xBF, 0x0B, 0xFB, 0xF8,
-    0x2F, 0xC0, 0x02, 0xFC, 0x3F, 0xCB, 0xF0, 0xFE, 0x00, 0x07, 0xF2, 0xFE, 0x0F, 0xE3, 0xF4, 0x00,
-    0x0F, 0xEF, 0xF4, 0x3F, 0xDF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x02, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFF,
-    0x40, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xF8,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80,
-    0xFD, 0x00, 0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x00,
-    0x7F, 0xC2, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x07, 0xFC,
-    0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x3F, 0x00, 0x00,
-    0x0B, 0xE2, 0xF8, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xBF, 0x00, 0x03, 0xF0, 0x03,
-    0xF4, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0xFD, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0xBF,
-    0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6A, 0xAA, 0xAF, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0x55, 0x41, 0xFF, 0xF0, 0x7F, 0xFC, 0x2F, 0x00, 0x0B, 0xC0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x01, 0xF4, 0x00,
-    0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02,
-    0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0x0F,
-    0xFF, 0x83, 0xFF, 0xE0, 0x10, 0x00, 0x08, 0x00, 0x03, 0x40, 0x00, 0xF0, 0x00, 0x2C, 0x00, 0x07,
-    0x80, 0x00, 0xF0, 0x00, 0x2D, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x00,
-    0xF0, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x00,
-    0x3E, 0x00, 0x0F, 0x40, 0x02, 0xC0, 0x00, 0x20, 0x00, 0x00, 0x15, 0x54, 0x0F, 0xFF, 0x03, 0xFF,
-    0xC0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x0F,
-    0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x7D,
-    0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8,
-    0x00, 0x3E, 0x0F, 0xFF, 0x83, 0xFF, 0xF0, 0xFF, 0xFC, 0x00, 0x28, 0x00, 0x02, 0xF4, 0x00, 0x1F,
-    0xF4, 0x01, 0xE0, 0xB4, 0x2C, 0x00, 0x74, 0x05, 0x55, 0x55, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x70, 0x02, 0xFF, 0xFF, 0x40, 0xBE, 0x5B, 0xF4, 0x0F, 0x40,
-    0x1F, 0x82, 0xE0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xBC, 0x3C, 0x00, 0x0F, 0xC3,
-    0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x7F, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF,
-    0x7D, 0x01, 0xBF, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x2F, 0x0B, 0xE4, 0x00, 0xBE, 0xFF, 0xFC, 0x02, 0xFF, 0xE6, 0xFC, 0x07, 0xFC,
-    0x00, 0xF8, 0x1F, 0xC0, 0x01, 0xF0, 0x7F, 0x00, 0x03, 0xE1, 0xFC, 0x00, 0x0F, 0x87, 0xF0, 0x00,
-    0x3E, 0x0F, 0xC0, 0x01, 0xF4, 0x3F, 0x80, 0x1F, 0xC0, 0xFF, 0xEB, 0xFE, 0x03, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0xE0, 0x10, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xE0, 0x00,
-    0x0F, 0xFF, 0xF4, 0x07, 0xFF, 0xFC, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0xA4, 0x1F, 0x00, 0x2F, 0xFD, 0x7C, 0x03, 0xFF, 0xFE, 0xF0, 0x2F, 0x41,
-    0xFF, 0xC0, 0xF0, 0x00, 0xFF, 0x0B, 0x80, 0x02, 0xFC, 0x3D, 0x00, 0x0B, 0xE0, 0xF4, 0x00, 0x1F,
-    0x83, 0xD0, 0x00, 0xBE, 0x0F, 0x80, 0x03, 0xF8, 0x3F, 0x90, 0x7F, 0xE0, 0x7F, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xBC, 0x00, 0x6F, 0xE1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xD0, 0x0B, 0x00, 0xF4, 0x00, 0x3C, 0x1E, 0x00, 0x03,
-    0xC2, 0xFA, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE3, 0xD5, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x95, 0x6C, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC,
-    0x00, 0x2B, 0xFD, 0x00, 0x00, 0x6F, 0x80, 0x7F, 0xE0, 0x3E, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
-    0xF0, 0x03, 0xFF, 0xFC, 0xFF, 0xFF, 0x07, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x1F, 0x40, 0x07,
-    0xD0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x2F,
-    0x80, 0x00, 0xBF, 0x43, 0xD0, 0x3F, 0xFE, 0x7C, 0x0F, 0xEB, 0xFF, 0xC1, 0xF0, 0x0B, 0xFC, 0x3D,
-    0x00, 0x3F, 0xC3, 0xC0, 0x01, 0xFC, 0x3C, 0x00, 0x1F, 0xC3, 0xC0, 0x01, 0xFC, 0x3C, 0x00, 0x2F,
-    0xC3, 0xE0, 0x07, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0x0B,
-    0xF4, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF4, 0x0D, 0x01, 0xFF, 0x00, 0xFF, 0xFF, 0xE0,
-    0x1F, 0xFF, 0xFC, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xF0, 0x69, 0x00, 0x1F, 0x7F, 0xFD, 0x01, 0xFF, 0xFF, 0xF4, 0x1F, 0xF0,
-    0x1F, 0x81, 0xFC, 0x00, 0x7C, 0x2F, 0x40, 0x03, 0xC2, 0xF0, 0x00, 0x3C, 0x2F, 0x00, 0x03, 0xD3,
-    0xF0, 0x00, 0x3D, 0x3F, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x3D, 0x3F, 0x00, 0x07, 0xE3, 0xF4, 0x00,
-    0xBE, 0x3F, 0x40, 0x0B, 0xE0, 0x2F, 0x0F, 0xD3, 0xF5, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0xB8, 0x2F, 0x0B, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F,
-    0xD0, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
-    0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07,
-    0x80, 0x00, 0x78, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x07, 0xF4, 0x1F, 0xFF, 0x03,
-    0xFF, 0xC0, 0x15, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x3E,
-    0x00, 0x2F, 0x0F, 0xC0, 0x02, 0xF3, 0xF0, 0x00, 0x2F, 0xBD, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x3F,
-    0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xF3, 0xFC, 0x00, 0x3F, 0x1F, 0xF0,
-    0x03, 0xF0, 0xBF, 0xC0, 0x3F, 0x02, 0xFF, 0x03, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x7C, 0x01, 0xF0,
-    0x0B, 0xC0, 0x2F, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40,
-    0x7D, 0x01, 0xF4, 0x07, 0xD0, 0x1F, 0x40, 0x7D, 0x01, 0xF4, 0x07, 0xFF, 0x1F, 0xFD, 0x7F, 0xF8,
-    0x0B, 0x87, 0xF8, 0x01, 0xFE, 0x00, 0x2E, 0xBF, 0xFD, 0x2F, 0xFE, 0x00, 0xFF, 0xE6, 0xFD, 0xFA,
-    0xBD, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0xB8, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0xF0, 0x3F, 0x00, 0x0B,
-    0xC0, 0x03, 0xC1, 0xF8, 0x00, 0x2F, 0x00, 0x0F, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x3C, 0x2F, 0x40,
-    0x03, 0xE0, 0x01, 0xF0, 0xBD, 0x00, 0x0F, 0x80, 0x07, 0xC3, 0xF4, 0x00, 0x7D, 0x00, 0x2F, 0x4F,
-    0xC0, 0x02, 0xF4, 0x00, 0xBD, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xD0, 0x0E, 0x1F, 0xE0, 0x01, 0xFF, 0xFF, 0xD0, 0x1F, 0xF4, 0x7F, 0x01, 0xFC, 0x00, 0xF8, 0x2F,
-    0x40, 0x0B, 0x82, 0xF0, 0x00, 0xBC, 0x2F, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0xBC, 0x3F, 0x40, 0x0F,
-    0xC3, 0xF4, 0x00, 0xFC, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x3F, 0x40, 0x0F, 0xD3, 0xF4,
-    0x00, 0xFD, 0x00, 0x6F, 0xE0, 0x00, 0x2F, 0xFF, 0xE0, 0x0F, 0xE4, 0x6F, 0x41, 0xF0, 0x00, 0x7C,
-    0x3E, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x3E, 0x3D, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x2F, 0x3E, 0x00,
-    0x03, 0xE3, 0xF4, 0x00, 0xBD, 0x1F, 0xFE, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00,
-    0x07, 0xFE, 0x00, 0x01, 0x02, 0xB9, 0x00, 0x2E, 0x3F, 0xFE, 0x00, 0xBF, 0xF4, 0x7E, 0x01, 0xFF,
-    0x00, 0x3C, 0x07, 0xF0, 0x00, 0xB8, 0x1F, 0xC0, 0x01, 0xF0, 0x7E, 0x00, 0x07, 0xC1, 0xFC, 0x00,
-    0x1F, 0x07, 0xF0, 0x00, 0x7C, 0x1F, 0xF0, 0x03, 0xE0, 0xBF, 0xF9, 0xBF, 0x42, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xEF, 0xFF, 0xC0, 0x3E, 0x2F, 0xFC, 0x01, 0xF8, 0x01, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0xBC, 0x00, 0x3F, 0xAF, 0xAF, 0x00, 0x3F,
-    0x00, 0xFF, 0xC0, 0x1F, 0x00, 0x0F, 0xF0, 0x0F, 0x80, 0x03, 0xF8, 0x03, 0xD0, 0x00, 0xFE, 0x00,
-    0xF0, 0x00, 0x3F, 0x40, 0x3C, 0x00, 0x0F, 0xD0, 0x0F, 0x00, 0x07, 0xF4, 0x03, 0xE0, 0x03, 0xFC,
-    0x00, 0x7F, 0xAB, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFD, 0xF0, 0x00, 0x06, 0xF9,
-    0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xDB, 0x80, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0A, 0xD0, 0xFB,
-    0xFD, 0x0F, 0xFF, 0xE0, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xD0,
-    0x7E, 0xAB, 0xF4, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x6B, 0xFA, 0x93, 0xFF, 0xFF,
-    0xC0, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8,
-    0x00, 0x07, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0x54, 0x01, 0xFF, 0xF8, 0x0B, 0xFF, 0xE0, 0x1F,
-    0xFF, 0xC0, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xFC,
-    0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x00,
-    0x0F, 0xC2, 0xF4, 0x03, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFB, 0xC0,
-    0x3F, 0xFD, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x28, 0x00, 0x00, 0x29, 0x2F, 0x00, 0x00, 0x7C, 0x0F,
-    0x40, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0xF0, 0x07, 0xD0, 0x02, 0xF0, 0x03, 0xF0, 0x03, 0xD0, 0x01,
-    0xF4, 0x0B, 0xC0, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0xBD, 0x2F, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x2A,
-    0x00, 0x00, 0x00, 0xA8, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x01, 0xF8, 0x1F, 0x80,
-    0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x3C, 0x03, 0xF0, 0x0F, 0xC0, 0xBE, 0x03, 0xF0, 0x0B, 0xD1, 0xFF,
-    0x47, 0xE0, 0x07, 0xE3, 0xFF, 0xCB, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xEB, 0xFF, 0x80, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0x00,
-    0x00, 0xBE, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0xFD, 0x0F,
-    0xC0, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0xBF, 0x7F, 0x40, 0x01, 0xFC, 0x2F,
-    0xC0, 0x03, 0xF4, 0x0F, 0xE0, 0x0F, 0xE0, 0x07, 0xF4, 0x3F, 0xC0, 0x02, 0xFC, 0x3D, 0x00, 0x01,
-    0xF0, 0x7C, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x3E, 0x01, 0xF4, 0x01, 0xF4, 0x03, 0xF0, 0x0B, 0xC0,
-    0x07, 0xD0, 0x3F, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x3F, 0x7F, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xFF, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xFF, 0xFD, 0x01, 0x55, 0x5F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F,
-    0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xA8,
-    0x00, 0x3F, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0x40,
-    0x00, 0x3F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xF4, 0x00,
-    0x02, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xFE, 0x90, 0x00, 0xFF, 0xE0, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
-    0x2C, 0x2C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x38, 0x2A, 0x90, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFC, 0x00,
-    0x07, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x05, 0xBF, 0x40, 0x0B, 0xFF, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0xC3, 0xAC, 0x0C, 0x70, 0xB1, 0xC7, 0x03, 0xF8, 0x10, 0x05, 0x00,
-    0xFF, 0xCB, 0xFC, 0x7F, 0xC3, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x41, 0xFC, 0x1F, 0xC0, 0xFC, 0x0F,
-    0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x07, 0xC0,
-    0x7C, 0x07, 0xC0, 0x3C, 0x01, 0x80, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xBF, 0xF0, 0x07, 0xFF, 0xF0, 0x0F, 0xDF, 0x10, 0x2F, 0x4E,
-    0x00, 0x3F, 0x0E, 0x00, 0x3D, 0x0E, 0x00, 0x3D, 0x0E, 0x00, 0x3D, 0x0E, 0x00, 0x3E, 0x0E, 0x00,
-    0x3F, 0x4E, 0x00, 0x2F, 0xED, 0x00, 0x0F, 0xFF, 0xF4, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xF9, 0x00,
-    0x1D, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0F, 0xF9, 0x1B, 0xD0, 0x0F, 0x80, 0x00, 0x80,
-    0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x40, 0x05, 0xBD, 0x55, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0xFF, 0xEA, 0xA5, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x0F,
-    0xEF, 0xAF, 0xC0, 0xBF, 0xFF, 0xF4, 0x03, 0xE0, 0x3E, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0xC0, 0x0F,
-    0x40, 0xBC, 0x01, 0xF0, 0x07, 0xF0, 0x7F, 0x00, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xC2, 0xFA,
-    0xFD, 0xBD, 0x0A, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x2F, 0x80, 0x00, 0xBE, 0x2F, 0xC0, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x03, 0xEF, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x2C, 0x2C, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x38, 0x00, 0x01, 0x90, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x0B, 0x80, 0x7C, 0x00, 0x34, 0x00, 0x20, 0x00, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0x90, 0x1F, 0x80, 0xB8,
-    0x00, 0x1F, 0x02, 0xD0, 0x00, 0x7C, 0x0B, 0xE4, 0x03, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFC, 0x00, 0x01, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x65, 0x57, 0xFD,
-    0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0x3F, 0x01, 0xFC, 0x7F, 0x02, 0xFC, 0xBF, 0x43, 0xFC, 0x00,
-    0x69, 0x00, 0x1D, 0x0A, 0x00, 0xC7, 0x86, 0x08, 0x70, 0x0C, 0x32, 0x40, 0x24, 0xC9, 0x00, 0x53,
-    0x1D, 0x02, 0x06, 0x2F, 0x0C, 0x0A, 0x01, 0xC0, 0x06, 0xE4, 0x00, 0x00, 0x00, 0x07, 0xEC, 0x1D,
-    0x3C, 0x24, 0x0C, 0x30, 0x0C, 0x30, 0x0D, 0x34, 0x3D, 0x2F, 0xFE, 0x0B, 0xDA, 0x00, 0x05, 0x00,
-    0x40, 0x07, 0x40, 0xB0, 0x0B, 0xC0, 0xF8, 0x0B, 0xC0, 0xF8, 0x0F, 0x81, 0xF4, 0x0B, 0xC0, 0xF4,
-    0x03, 0xF8, 0x7F, 0x00, 0x3F, 0x87, 0xF0, 0x02, 0xF8, 0x7F, 0x00, 0x2F, 0x07, 0xE0, 0x02, 0xC0,
-    0x74, 0x00, 0x10, 0x00, 0x3F, 0xA9, 0x50, 0x0F, 0xFF, 0xFF, 0xC1, 0x55, 0x6B, 0xF0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0xAA, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x00, 0x69, 0x00, 0x1D, 0x0A, 0x00, 0xCA, 0x45,
-    0x09, 0x22, 0x4C, 0x30, 0x88, 0x24, 0xC3, 0xF0, 0x53, 0x0C, 0xA2, 0x06, 0x31, 0xDC, 0x0A, 0x02,
-    0xC0, 0x06, 0xE4, 0x00, 0x00, 0x55, 0x82, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBE, 0x00, 0x0F, 0xFF, 0xD0, 0x2F, 0x01, 0xF0, 0x3C, 0x00, 0xB8, 0x7C, 0x00, 0x3C, 0xBC, 0x00,
-    0x7C, 0x7D, 0x00, 0xBC, 0x3F, 0x42, 0xF8, 0x2F, 0xFF, 0xF0, 0x0B, 0xFF, 0xC0, 0x01, 0xB9, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xFF, 0xFF,
-    0x45, 0x57, 0xE5, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0xA4, 0x2F, 0xFF, 0xFF, 0x05, 0x50, 0x00, 0x00, 0x2F, 0xD0,
-    0x41, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0xE0, 0x1F, 0x01, 0xF0, 0x0F, 0xFD, 0x2A, 0xA0, 0x1F, 0xE0,
-    0x00, 0x90, 0x00, 0x80, 0x09, 0x07, 0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x0B, 0x2F, 0xF4, 0x6E, 0x40,
-    0x07, 0x43, 0xC1, 0xF0, 0xB4, 0x3C, 0x00, 0x2F, 0x40, 0x03, 0xE0, 0xBD, 0x00, 0x0F, 0x82, 0xF4,
-    0x00, 0x3E, 0x0F, 0xD0, 0x00, 0xFC, 0x3F, 0x80, 0x03, 0xF0, 0xFE, 0x00, 0x0F, 0xC3, 0xF8, 0x00,
-    0x3F, 0x0F, 0xF0, 0x00, 0xFC, 0x3F, 0xC0, 0x03, 0xF0, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x3B, 0xFF, 0xFE, 0xF0, 0xE3, 0xFF, 0xDB, 0xC3, 0x80, 0x54, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xC0, 0xFF, 0xC0,
-    0xF0, 0xBF, 0xF0, 0x3C, 0x3F, 0xFC, 0x0F, 0x0F, 0xFE, 0x03, 0xC3, 0xFF, 0x80, 0xF0, 0x7F, 0xE0,
-    0x3C, 0x0B, 0xF8, 0x0F, 0x00, 0xBD, 0x03, 0xC0, 0x3F, 0x40, 0xF0, 0x0F, 0xD0, 0x2C, 0x03, 0xF0,
-    0x0B, 0x01, 0xFC, 0x02, 0xC0, 0xBF, 0x00, 0xB0, 0x3F, 0xC0, 0x2D, 0x0F, 0xF0, 0x0B, 0x43, 0xFC,
-    0x02, 0xD1, 0xFF, 0x00, 0xB4, 0xBF, 0x80, 0x2D, 0x2F, 0xE0, 0x0B, 0x40, 0x00, 0x0F, 0xC3, 0xF1,
-    0xFC, 0xBF, 0x40, 0x08, 0x02, 0x40, 0x3A, 0x40, 0x0C, 0x00, 0x91, 0x6C, 0x3F, 0x40, 0x00, 0x00,
-    0x7C, 0x01, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x70, 0x01, 0xC0, 0x3F, 0xF0, 0xAA, 0x80,
-    0x07, 0xF0, 0x1D, 0x1C, 0x34, 0x0D, 0x34, 0x0A, 0x34, 0x0A, 0x38, 0x0D, 0x1F, 0xFC, 0x07, 0xE0,
-    0x10, 0x04, 0x00, 0x0E, 0x01, 0xD0, 0x03, 0xF0, 0x3E, 0x00, 0x2F, 0x03, 0xE0, 0x01, 0xF4, 0x2F,
-    0x00, 0x1F, 0x03, 0xE0, 0x0F, 0xC2, 0xFC, 0x0F, 0xD2, 0xFC, 0x0F, 0xD2, 0xF8, 0x0B, 0xD0, 0xF8,
-    0x01, 0xD0, 0x38, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x03, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0D, 0x00, 0x03, 0x80, 0x00, 0x0B,
-    0x00, 0x00, 0xE0, 0x00, 0x07, 0x40, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x02, 0xD0,
-    0x00, 0x07, 0x80, 0x00, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0xB0, 0x00, 0x01, 0xB9, 0x40, 0x78, 0x00,
-    0x02, 0xFF, 0xF4, 0x3C, 0x00, 0x40, 0xBF, 0xFD, 0x2D, 0x00, 0x34, 0x00, 0x00, 0x0F, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x2F, 0x80, 0x00, 0x07, 0xC0, 0x1D, 0xE0, 0x00, 0x03, 0xD0, 0x0E, 0x38,
-    0x00, 0x02, 0xE0, 0x0F, 0x0E, 0x00, 0x00, 0xF0, 0x0B, 0x83, 0xD0, 0x00, 0xF8, 0x03, 0xFF, 0xFE,
-    0x00, 0x7C, 0x00, 0x50, 0x7D, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xC0,
-    0x05, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x13, 0x80, 0x00, 0x01, 0x40, 0x00, 0x38, 0x00, 0x00, 0xB0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00,
-    0x00, 0x38, 0x00, 0x02, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x74, 0x00, 0x00, 0x78, 0x00, 0x0F, 0x00,
-    0x00, 0x07, 0x80, 0x02, 0xD0, 0x00, 0x01, 0xB9, 0x40, 0x38, 0x05, 0x00, 0xBF, 0xFD, 0x0F, 0x1F,
-    0xFE, 0x0B, 0xFF, 0xD1, 0xE2, 0x80, 0xB4, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x40,
-    0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0,
-    0x00, 0x2F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2E, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xC0,
-    0x01, 0xFE, 0x54, 0x00, 0xF4, 0x00, 0x2F, 0xFF, 0xC0, 0x2F, 0x00, 0x03, 0xFF, 0xFC, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x10,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x09, 0x00, 0x00, 0x06, 0x00, 0x02, 0xC0, 0x00,
-    0x16, 0x80, 0x00, 0x34, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xF0, 0x01, 0xD0, 0x00,
-    0x00, 0x0F, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB0, 0x0B, 0x00, 0x00, 0x10, 0x1F, 0x01, 0xE0, 0x00,
-    0x07, 0xFF, 0xE0, 0x3C, 0x00, 0x40, 0xBF, 0xF8, 0x07, 0x80, 0x0D, 0x00, 0x54, 0x00, 0xF0, 0x03,
-    0xD0, 0x00, 0x00, 0x2D, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xC0, 0x1D, 0xE0, 0x00, 0x00, 0xF4, 0x03,
-    0x8E, 0x00, 0x00, 0x2E, 0x00, 0xF0, 0xE0, 0x00, 0x03, 0xC0, 0x2E, 0x0F, 0x40, 0x00, 0xB8, 0x03,
-    0xFF, 0xFE, 0x00, 0x1F, 0x00, 0x14, 0x1F, 0x40, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0xBC, 0x00,
-    0x00, 0x0F, 0x00, 0x05, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x18, 0x0F, 0xF4, 0x1B, 0xD0,
-    0x7F, 0xFF, 0xF8, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00,
-    0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00,
-    0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8,
-    0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02,
-    0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00,
-    0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0xBD, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x2F, 0x80, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03,
-    0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00,
-    0x1D, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0,
-    0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00,
-    0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x34, 0x00, 0x00, 0x0F, 0x38, 0x34, 0x00, 0x00, 0x0D, 0x0E, 0xB0, 0x00,
-    0x00, 0x0D, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3,
-    0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0,
-    0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x1F, 0x40,
-    0xBC, 0x00, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0x00, 0x3F, 0xC1, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07,
-    0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F,
-    0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x40, 0x00, 0x00, 0x01, 0xC1, 0x80, 0x00, 0x00, 0x00, 0xEB,
-    0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F,
-    0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00,
-    0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F,
-    0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F,
-    0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xEA, 0xA4,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF9,
-    0x55, 0x50, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x1F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xF8, 0x00, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xEA,
-    0x6B, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE8, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x79,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x05, 0xB8, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xE0, 0xBF, 0xFE, 0xAA, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD5, 0x55, 0x50, 0x3F, 0xFF, 0xFF,
-    0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xE0, 0xBF, 0xFE, 0xAA,
-    0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xD5, 0x55, 0x50, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x1E, 0x2E, 0x00, 0x01, 0xD0, 0x1E, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x82, 0xFF, 0xFA, 0xA8, 0x0B, 0xC0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x55,
-    0x55, 0x40, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xFD, 0x07, 0xF0,
-    0x07, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x82, 0xFF, 0xFA, 0xA8, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x55, 0x55, 0x40, 0xFF,
-    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x10, 0x00,
-    0x3E, 0x00, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFE,
-    0x00, 0xFE, 0x01, 0xFE, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x03, 0x81, 0xD0, 0xF0, 0x78, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F,
-    0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x8F, 0xE7,
-    0xF9, 0xFF, 0x7F, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x02, 0xF8, 0x00, 0xBA, 0xE0, 0x2D,
-    0x07, 0x86, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F,
-    0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x01, 0xFF, 0x00, 0x1F, 0xF0,
-    0x01, 0xFF, 0x00, 0x1F, 0x40, 0xBD, 0x2F, 0x80, 0xFD, 0x3F, 0xC0, 0xFE, 0x3F, 0xC0, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x3F,
-    0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x6F, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xF0, 0x00,
-    0x1F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0x3F,
-    0x80, 0x07, 0xE0, 0x00, 0x00, 0xBF, 0x06, 0xAF, 0xEA, 0x80, 0x01, 0xFC, 0x3F, 0xFF, 0xFF, 0x40,
-    0x07, 0xF4, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x1F, 0x80,
-    0x00, 0x02, 0xFD, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0xFD, 0x55, 0x6F, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x34,
-    0x00, 0x00, 0x2D, 0xD0, 0xD0, 0x00, 0x00, 0xD1, 0xD3, 0x40, 0x00, 0x03, 0x42, 0xFC, 0x00, 0x00,
-    0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x3F, 0x02, 0xFD, 0x00,
-    0x00, 0xFC, 0x0F, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0xF0, 0x00, 0x1F, 0xC0, 0xFF, 0xE0, 0x00, 0x7F,
-    0x03, 0xFF, 0xC0, 0x01, 0xFC, 0x0F, 0xFF, 0x80, 0x0B, 0xF0, 0x3F, 0x7F, 0x00, 0x2F, 0x81, 0xFC,
-    0xFE, 0x00, 0xBE, 0x07, 0xF1, 0xFC, 0x02, 0xF8, 0x1F, 0xC3, 0xF8, 0x0F, 0xE0, 0xBF, 0x07, 0xF0,
-    0x3F, 0x82, 0xFC, 0x0F, 0xD0, 0xFD, 0x0B, 0xF0, 0x1F, 0xC3, 0xF4, 0x2F, 0xC0, 0x3F, 0x4F, 0xD0,
-    0xFF, 0x00, 0xBF, 0x7F, 0x43, 0xFD, 0x00, 0xFE, 0xFD, 0x0F, 0xF4, 0x02, 0xFF, 0xF0, 0x3F, 0xD0,
-    0x03, 0xFF, 0xC0, 0xFF, 0x40, 0x0B, 0xFF, 0x03, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F,
-    0xF0, 0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00,
-    0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00,
-    0xFE, 0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
-    0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F,
-    0xF0, 0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00,
-    0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00,
-    0xFE, 0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
-    0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xE3, 0xC0, 0x00, 0x00, 0x0B, 0x00,
-    0xB0, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0,
-    0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F,
-    0x00, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00,
-    0x00, 0xFE, 0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40,
-    0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x2C, 0x00, 0x00,
-    0x07, 0x78, 0x28, 0x00, 0x00, 0x0B, 0x0E, 0x38, 0x00, 0x00, 0x0E, 0x07, 0xF4, 0x00, 0x00, 0x04,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x07,
-    0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xBE,
-    0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0xD0,
-    0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x7D, 0x00,
-    0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x2F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00,
-    0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00,
-    0xBE, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F,
-    0xD0, 0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xB0, 0x03, 0xE3, 0xD0, 0x00, 0xFF, 0x80,
-    0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xF7, 0xF0, 0x1F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x95, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0xFD, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x2F, 0x82, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x0F,
-    0xE2, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xEF, 0xD0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x55, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x54, 0x3F, 0xC0, 0x00,
-    0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x02, 0xFD, 0x3F,
-    0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01,
-    0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4,
-    0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x2F,
-    0xC2, 0xFE, 0x00, 0x07, 0xFC, 0x1F, 0xFE, 0xAB, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x54, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFE, 0x3F,
-    0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01,
-    0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4,
-    0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F,
-    0xC3, 0xF8, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x2F, 0xC2, 0xFE, 0x00, 0x07, 0xFC, 0x1F, 0xFE,
-    0xAB, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBA, 0xE0, 0x00, 0x00, 0x2D, 0x07, 0x80, 0x00,
-    0x06, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x05, 0x43, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFD, 0x3F,
-    0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01,
-    0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4,
-    0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x1F,
-    0xC2, 0xFC, 0x00, 0x02, 0xFC, 0x2F, 0xE0, 0x00, 0x7F, 0xC1, 0xFF, 0xEA, 0xBF, 0xF8, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00, 0xFE,
-    0x03, 0xF4, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x01, 0x54, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xF8, 0x00,
-    0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3,
-    0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00,
-    0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F,
-    0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x2F, 0xC2, 0xFE, 0x00, 0x07,
-    0xFC, 0x1F, 0xFE, 0xAB, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2F, 0x80,
-    0xBF, 0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0xFD, 0x03,
-    0xF8, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFE, 0x00,
-    0xBD, 0x7F, 0xD0, 0xBC, 0x07, 0xF4, 0xBC, 0x00, 0xFC, 0xBC, 0x00, 0x3D, 0xBC, 0x00, 0x1E, 0xBC,
-    0x00, 0x3D, 0xBC, 0x00, 0xFC, 0xBC, 0x0B, 0xF4, 0xBE, 0xBF, 0xD0, 0xBF, 0xFE, 0x00, 0xBF, 0x90,
-    0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x3D, 0x02, 0xD0, 0x03, 0xD0, 0x02, 0xC0, 0x0F, 0x00, 0x03, 0x40,
-    0x3C, 0x00, 0x6D, 0x01, 0xF0, 0x0B, 0x90, 0x07, 0xC0, 0x74, 0x00, 0x1F, 0x02, 0xC0, 0x00, 0x7C,
-    0x0F, 0x00, 0x02, 0xF0, 0x2E, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x2F, 0x00, 0x7F, 0x40, 0xBC, 0x00,
-    0x3F, 0x42, 0xF0, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x7C, 0x3F, 0x10, 0x02, 0xF0, 0xFD, 0xBF, 0xFF,
-    0x83, 0xF6, 0xFF, 0xFC, 0x0F, 0xD6, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD7,
-    0x00, 0x2F, 0xFF, 0xF4, 0x0B, 0xE5, 0xBF, 0x40, 0xF4, 0x01, 0xF8, 0x2E, 0x00, 0x0F, 0x83, 0xC0,
-    0x00, 0xFC, 0x3C, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0F, 0xC3, 0xE0, 0x07, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF7, 0xD0, 0x1B, 0xF8, 0x3E, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xD7, 0x00, 0x2F, 0xFF, 0xF4, 0x0B, 0xE5, 0xBF, 0x40, 0xF4, 0x01, 0xF8, 0x2E,
-    0x00, 0x0F, 0x83, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0F,
-    0xC3, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF7, 0xD0, 0x1B,
-    0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xBD, 0x00,
-    0x03, 0xC0, 0xB4, 0x00, 0xA0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x70, 0x02, 0xFF,
-    0xFF, 0x40, 0xBE, 0x5B, 0xF4, 0x0F, 0x40, 0x1F, 0x82, 0xE0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0xC3,
-    0xC0, 0x00, 0xBC, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x7F, 0xC3, 0xFF, 0xFF,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x7D, 0x01, 0xBF, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0xC0, 0x03, 0x8D, 0x0C, 0x00, 0x70, 0x7B, 0xC0, 0x07, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0x87, 0x00, 0x2F, 0xFF, 0xB4, 0x0B, 0xE5, 0xBF, 0x40, 0xF4, 0x01, 0xF8, 0x2E,
-    0x00, 0x0F, 0x83, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0F,
-    0xC3, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF7, 0xD0, 0x1B,
-    0xF8, 0x3E, 0x0B, 0xC0, 0x3F, 0x00, 0xFD, 0x03, 0xF0, 0x0F, 0xD0, 0x7F, 0x01, 0xFE, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD7, 0x00, 0x2F, 0xFF, 0xF4, 0x0B, 0xE5,
-    0xBF, 0x40, 0xF4, 0x01, 0xF8, 0x2E, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0B, 0xC3,
-    0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0F, 0xC3, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF,
-    0xFD, 0x0B, 0xFF, 0xF7, 0xD0, 0x1B, 0xF8, 0x3E, 0x00, 0x1A, 0x00, 0x00, 0x03, 0x0C, 0x00, 0x00,
-    0xA0, 0x90, 0x00, 0x0A, 0x0D, 0x00, 0x00, 0x7A, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x97, 0x00, 0x2F, 0xFF, 0xF4, 0x0B, 0xE5, 0xBF, 0x40, 0xF4,
-    0x01, 0xF8, 0x2E, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0xFC,
-    0x3C, 0x00, 0x0F, 0xC3, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF,
-    0xF7, 0xD0, 0x1B, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x6F, 0xD7, 0x0F, 0xFF,
-    0x80, 0x02, 0xFF, 0xFF, 0xBE, 0x41, 0xF0, 0x0B, 0xE5, 0xBF, 0xF4, 0x00, 0x34, 0x0F, 0x40, 0x1F,
-    0xE0, 0x00, 0x3C, 0x2E, 0x00, 0x0F, 0xE6, 0xAF, 0xFD, 0x3C, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x3C,
-    0x00, 0x0B, 0xE5, 0x50, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x3E, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x95, 0x6C, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xF7, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0x83, 0xE2, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0xE0, 0x10, 0x2F, 0x40, 0x00, 0x3F, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x2F, 0xE0, 0x00, 0x0F, 0xFF, 0xF4, 0x07, 0xFF, 0xFC, 0x00, 0xBF, 0xF9, 0x00, 0x08, 0x00, 0x00,
-    0x1E, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x00, 0xB0, 0x00, 0x2F, 0xC0, 0x00, 0x15, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xFF,
-    0xD0, 0x07, 0xD0, 0x0B, 0x00, 0xF4, 0x00, 0x3C, 0x1E, 0x00, 0x03, 0xC2, 0xFA, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xE3, 0xD5, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0xFF, 0x95, 0x6C, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x2B, 0xFD, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xD0,
-    0x07, 0xD0, 0x0B, 0x00, 0xF4, 0x00, 0x3C, 0x1E, 0x00, 0x03, 0xC2, 0xFA, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xE3, 0xD5, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xFF, 0x95, 0x6C, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x2B, 0xFD, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0x0B, 0x40, 0x03, 0x80, 0x1D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x7D, 0x00, 0xB0, 0x0F, 0x40, 0x03, 0xC1, 0xE0, 0x00, 0x3C, 0x2F,
-    0xAF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3D, 0x50, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xC0, 0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x02,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0xF4, 0x07, 0xF0, 0x2F, 0x80, 0xBF, 0x03, 0xFC,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x7D, 0x00, 0xB0, 0x0F, 0x40, 0x03, 0xC1,
-    0xE0, 0x00, 0x3C, 0x2F, 0xAF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3D, 0x50, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xC0, 0xBF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xFF, 0xC0, 0x02, 0xBF, 0xD0, 0x14, 0x00, 0x07, 0xD0, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01,
-    0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x0B, 0x80, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x02, 0xC0, 0x3C, 0x0B, 0x80, 0xF0, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1E, 0x01, 0xE0, 0x1E, 0x01, 0xE0, 0x1E, 0x01,
-    0xE0, 0x2E, 0x02, 0xF0, 0x2F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x0F, 0xC0, 0x00, 0xFB, 0xC0, 0x0E, 0x02, 0xC0, 0x90, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00,
-    0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xBD, 0x2F,
-    0x80, 0xBD, 0x3F, 0xC0, 0xFE, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1E, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0A, 0xAF, 0xAA, 0x40, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0xAF, 0x80, 0xF0, 0x00, 0x1F, 0xFF, 0xD3, 0xC0, 0x00, 0xFD, 0x07, 0xDE, 0x00, 0x0B,
-    0xC0, 0x03, 0xF4, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00,
-    0x7C, 0x00, 0x0B, 0xC0, 0x03, 0xD0, 0x00, 0x1F, 0xE5, 0x7F, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0x03, 0x40, 0x0F, 0x78,
-    0x34, 0x00, 0xD1, 0xEB, 0x00, 0x1D, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xE1, 0xFE, 0x00, 0x1F, 0xFF, 0xFD, 0x01, 0xFF, 0x47, 0xF0, 0x1F, 0xC0, 0x0F,
-    0x82, 0xF4, 0x00, 0xB8, 0x2F, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0xBC, 0x2F, 0x00, 0x0B, 0xC3, 0xF4,
-    0x00, 0xFC, 0x3F, 0x40, 0x0F, 0xC3, 0xF4, 0x00, 0xFD, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD,
-    0x3F, 0x40, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x05, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0xFE, 0x46, 0xF4, 0x1F, 0x00,
-    0x07, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x2F, 0x3D, 0x00, 0x02, 0xF3,
-    0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF, 0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF,
-    0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0xFE, 0x46, 0xF4, 0x1F, 0x00, 0x07,
-    0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x2F, 0x3D, 0x00, 0x02, 0xF3, 0xE0,
-    0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF, 0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1E,
-    0x07, 0x80, 0x07, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0xFE, 0x46, 0xF4, 0x1F, 0x00,
-    0x07, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x2F, 0x3D, 0x00, 0x02, 0xF3,
-    0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF, 0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF,
-    0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xA0, 0x02, 0xCB, 0x0A, 0x00,
-    0x38, 0x3E, 0xD0, 0x03, 0x80, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0xFE, 0x46, 0xF4, 0x1F,
-    0x00, 0x07, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x2F, 0x3D, 0x00, 0x02,
-    0xF3, 0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF, 0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xE0, 0x1F, 0x40, 0xBE, 0x02, 0xF4, 0x0B, 0xF0, 0x3F,
-    0x80, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0xFE, 0x46, 0xF4,
-    0x1F, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x2F, 0x3D, 0x00,
-    0x02, 0xF3, 0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF, 0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40,
-    0x2F, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0B, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF,
-    0xEA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x6F, 0xF4, 0x00, 0x2F, 0xFF, 0xE0, 0x0F, 0xE6, 0xFF, 0x81,
-    0xF0, 0x3D, 0x7C, 0x3E, 0x03, 0xC3, 0xD3, 0xD0, 0x7C, 0x2E, 0x3D, 0x0B, 0x82, 0xF3, 0xD0, 0xF4,
-    0x2F, 0x3E, 0x1F, 0x03, 0xE3, 0xF6, 0xE0, 0xBD, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xF8,
-    0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3E, 0x00,
-    0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x40, 0x3F, 0xC1,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xBC, 0x03, 0xFF, 0xDB, 0xC0, 0x01, 0x50,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0,
-    0x00, 0xF8, 0x3D, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC,
-    0x2F, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x40, 0x3F, 0xC1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xBC, 0x03, 0xFF, 0xDB, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x03, 0x80, 0xF0, 0x00, 0xD0, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xF8, 0x3D,
-    0x00, 0x0F, 0x83, 0xD0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3E, 0x00, 0x0F,
-    0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF4, 0x03, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFB, 0xC0, 0x3F, 0xFD, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x0F, 0xC0, 0x3E,
-    0x00, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0xBF, 0x02, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xF8,
-    0x3D, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x2F, 0x00,
-    0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x40, 0x3F, 0xC1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xBC, 0x03, 0xFF, 0xDB, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC1, 0xF0,
-    0x00, 0x2F, 0x03, 0xE0, 0x00, 0xF8, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0xC0, 0x2F, 0x00, 0x1F, 0x40,
-    0xFC, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x7E, 0x2F, 0x40, 0x00, 0xFD, 0xFC, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x3F, 0xFE, 0x00, 0x3D,
-    0x2F, 0xC0, 0x3D, 0x03, 0xF0, 0x3D, 0x00, 0xF4, 0x3D, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x3D, 0x00,
-    0x3C, 0x3D, 0x00, 0x3C, 0x3D, 0x00, 0xB8, 0x3D, 0x01, 0xF0, 0x3D, 0x07, 0xD0, 0x2E, 0x6F, 0x80,
-    0x2F, 0xFD, 0x00, 0x2F, 0x90, 0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x0F, 0xC0, 0x7F, 0x00,
-    0x7F, 0x02, 0xFC, 0x02, 0xFD, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC1, 0xF0, 0x00,
-    0x2F, 0x03, 0xE0, 0x00, 0xF8, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0xC0, 0x2F, 0x00, 0x1F, 0x40, 0xFC,
-    0x00, 0x3F, 0x07, 0xE0, 0x00, 0x7E, 0x2F, 0x40, 0x00, 0xFD, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0xBF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00,
-    0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E,
-    0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00,
-    0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC,
-    0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xEA, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x70, 0x02, 0xFF, 0xFF, 0x40, 0xBE, 0x5B,
-    0xF4, 0x0F, 0x40, 0x1F, 0x82, 0xE0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xBC, 0x3C,
-    0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x7F, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xD0, 0xBF, 0xFF, 0x7D, 0x01, 0xBF, 0x83, 0xE0, 0x00, 0x2D, 0x40, 0x2C, 0x00, 0x00, 0x1C, 0x00,
-    0x2C, 0x00, 0x00, 0x0E, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81,
-    0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E,
-    0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80,
-    0x00, 0x01, 0xFD, 0x0E, 0x00, 0x0E, 0x00, 0xF0, 0x00, 0xE0, 0x07, 0xD5, 0xBC, 0x00, 0x2F, 0xFF,
-    0x40, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xD7, 0x00, 0x2F, 0xFF, 0xF4, 0x0B, 0xE5, 0xBF, 0x40, 0xF4, 0x01, 0xF8, 0x2E, 0x00, 0x0F,
-    0x83, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0F, 0xC3, 0xE0,
-    0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF7, 0xD0, 0x1B, 0xF8, 0x3E,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B,
-    0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F,
-    0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F,
-    0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x70, 0x02, 0xFF,
-    0xFF, 0x40, 0xBE, 0x5B, 0xF4, 0x0F, 0x40, 0x1F, 0x82, 0xE0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0xC3,
-    0xC0, 0x00, 0xBC, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x7F, 0xC3, 0xFF, 0xFF,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x7D, 0x01, 0xBF, 0x83, 0xE0, 0x00, 0x00, 0xD0, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x02, 0xE9, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xAF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x04, 0x0F, 0xFF, 0xFA, 0x6B, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x07, 0xFF, 0xF0, 0x0F, 0xE0, 0x10, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xFF,
-    0xF4, 0x07, 0xFF, 0xFC, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0x28, 0x00, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x04, 0x0F, 0xFF, 0xFA, 0x6B, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x80, 0x03,
-    0xD1, 0xE0, 0x0E, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x07, 0xFF,
-    0xF0, 0x0F, 0xE0, 0x10, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xFF, 0xF4, 0x07,
-    0xFF, 0xFC, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xA6, 0xBC, 0x07, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0xE0, 0x10, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xE0,
-    0x00, 0x0F, 0xFF, 0xF4, 0x07, 0xFF, 0xFC, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
-    0x24, 0x00, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x02, 0xEB, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xAF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x04, 0x0F, 0xFF, 0xFA, 0x6B, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x00, 0x08, 0x07, 0x40, 0x74, 0x01, 0xF2, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x2F,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x07, 0xFF, 0xF0, 0x0F, 0xE0, 0x10, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xFF,
-    0xF4, 0x07, 0xFF, 0xFC, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE0, 0x03, 0x80, 0x00, 0x00, 0x3C, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x7E, 0x00, 0x1B, 0xFD, 0x00,
-    0x7E, 0x00, 0x00, 0xFF, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xC0, 0x7E, 0x00, 0x00, 0x1F, 0xD0, 0x7E,
-    0x00, 0x00, 0x0F, 0xE0, 0x7E, 0x00, 0x00, 0x0B, 0xF0, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x7E, 0x00,
-    0x00, 0x07, 0xF4, 0x7E, 0x00, 0x00, 0x07, 0xF4, 0x7E, 0x00, 0x00, 0x07, 0xF4, 0x7E, 0x00, 0x00,
-    0x0F, 0xF4, 0x7E, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0x55, 0x5B, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00,
-    0x01, 0xF0, 0x7C, 0x00, 0x0A, 0x41, 0xF0, 0x7C, 0x00, 0xBF, 0xF5, 0xF0, 0x14, 0x03, 0xFF, 0xFE,
-    0xF0, 0x00, 0x0B, 0xD0, 0x7F, 0xF0, 0x00, 0x0F, 0x00, 0x0F, 0xF0, 0x00, 0x2E, 0x00, 0x0B, 0xF0,
-    0x00, 0x3D, 0x00, 0x0B, 0xE0, 0x00, 0x3D, 0x00, 0x07, 0xE0, 0x00, 0x3D, 0x00, 0x0B, 0xE0, 0x00,
-    0x3E, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x90, 0x7F, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0xF0, 0x00, 0x00, 0x6F, 0xE1, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x6F, 0xF4, 0x00,
-    0x07, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0x2F,
-    0xC0, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xE0, 0x00, 0x00, 0xBF, 0x06, 0xAF, 0xEA, 0x80,
-    0x01, 0xFC, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xF4, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xD0, 0x07, 0xE0,
-    0x00, 0x00, 0x7F, 0x40, 0x1F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xF0, 0x01,
-    0xFD, 0x55, 0x6F, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFE, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x06, 0xAB, 0xEA, 0x80, 0x00,
-    0xA4, 0x1F, 0x00, 0x00, 0x2F, 0xFD, 0x7C, 0x00, 0x03, 0xFF, 0xFE, 0xF0, 0x00, 0x2F, 0x41, 0xFF,
-    0xC0, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0x0B, 0x80, 0x02, 0xFC, 0x00, 0x3D, 0x00, 0x0B, 0xE0, 0x00,
-    0xF4, 0x00, 0x1F, 0x80, 0x03, 0xD0, 0x00, 0xBE, 0x00, 0x0F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x90,
-    0x7F, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xBC,
-    0x00, 0x00, 0x6F, 0xE1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xAF, 0xFF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xE0, 0xBF, 0xFE, 0xAA,
-    0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xD5, 0x55, 0x50, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xD0, 0x0B, 0x00, 0xF4, 0x00, 0x3C, 0x1E, 0x00,
-    0x03, 0xC2, 0xFA, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE3, 0xD5, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x95, 0x6C, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFC, 0x00, 0x2B, 0xFD, 0x00, 0x03, 0x80, 0x03, 0x80, 0x0F, 0x00, 0x0D, 0x00, 0x1F, 0x56, 0xF0,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF,
-    0xEA, 0xA0, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFD, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x55, 0x00, 0x00, 0x74, 0x00, 0x74, 0x03, 0xD0, 0x1F,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x7D, 0x00, 0xB0, 0x0F, 0x40, 0x03, 0xC1, 0xE0, 0x00, 0x3C, 0x2F, 0xAF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3D, 0x50, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xC0, 0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x02, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xEA, 0xA0, 0x2F, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD,
-    0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xD0, 0x0B, 0x00,
-    0xF4, 0x00, 0x3C, 0x1E, 0x00, 0x03, 0xC2, 0xFA, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE3, 0xD5, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x95, 0x6C, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x2B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xEA, 0xA0, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x55, 0x55, 0x03, 0xFF, 0xFF,
-    0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xE0, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x19, 0x00, 0x00,
-    0x00, 0x0A, 0x40, 0x00, 0x0B, 0xFF, 0x80, 0x03, 0xF4, 0x1F, 0x00, 0xB8, 0x00, 0x38, 0x1F, 0x00,
-    0x02, 0xC2, 0xE6, 0xAF, 0xFD, 0x3F, 0xFF, 0xFF, 0xE3, 0xE5, 0x50, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFF, 0x95, 0x6C, 0x0B, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFC, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40,
-    0x2C, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xAA, 0x80, 0xBC, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF5, 0x55, 0x54, 0x0F,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x2D, 0x01, 0xD0, 0x00, 0xB8, 0xB4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x7D, 0x00, 0xB0,
-    0x0F, 0x40, 0x03, 0xC1, 0xE0, 0x00, 0x3C, 0x2F, 0xAF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3D, 0x50,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xC0,
-    0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x02, 0xBF, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xF2, 0xE0, 0x00, 0x00, 0x07,
-    0x80, 0x78, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x40, 0x01,
-    0x80, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xA5, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0xFE, 0x3F, 0x40,
-    0x00, 0x6F, 0xFE, 0x3F, 0x80, 0x00, 0x01, 0xFA, 0x3F, 0xC0, 0x00, 0x01, 0xF0, 0x2F, 0xF4, 0x00,
-    0x02, 0xF0, 0x1F, 0xFF, 0xAA, 0xAF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x7E, 0xE0, 0x00, 0x1E, 0x07, 0x80, 0x07, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x3D, 0x03, 0xFF, 0xE7, 0xC0, 0xFE, 0xBF, 0xFC, 0x1F, 0x00,
-    0xBF, 0xC3, 0xD0, 0x03, 0xFC, 0x3C, 0x00, 0x1F, 0xC3, 0xC0, 0x01, 0xFC, 0x3C, 0x00, 0x1F, 0xC3,
-    0xC0, 0x02, 0xFC, 0x3E, 0x00, 0x7F, 0xC1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xF8, 0x00, 0xBF, 0x4F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0xD0, 0x1F, 0xF0, 0x0F,
-    0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0x40, 0x2D, 0x00, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x1B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x40, 0x01, 0x80, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x01, 0xA5, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0xFE, 0x3F, 0x40, 0x00, 0x6F, 0xFE,
-    0x3F, 0x80, 0x00, 0x01, 0xFA, 0x3F, 0xC0, 0x00, 0x01, 0xF0, 0x2F, 0xF4, 0x00, 0x02, 0xF0, 0x1F,
-    0xFF, 0xAA, 0xAF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x07, 0x00, 0x07, 0x00, 0x74, 0x00, 0xB0, 0x03,
-    0xE5, 0x6E, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x3D, 0x03, 0xFF, 0xE7, 0xC0, 0xFE,
-    0xBF, 0xFC, 0x1F, 0x00, 0xBF, 0xC3, 0xD0, 0x03, 0xFC, 0x3C, 0x00, 0x1F, 0xC3, 0xC0, 0x01, 0xFC,
-    0x3C, 0x00, 0x1F, 0xC3, 0xC0, 0x02, 0xFC, 0x3E, 0x00, 0x7F, 0xC1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x00, 0xBF, 0x4F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0xD0, 0x1F, 0xF0, 0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0xE0, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1B,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x40, 0x01, 0x80, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x01, 0xA5, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0xFE, 0x3F, 0x40, 0x00, 0x6F, 0xFE, 0x3F,
-    0x80, 0x00, 0x01, 0xFA, 0x3F, 0xC0, 0x00, 0x01, 0xF0, 0x2F, 0xF4, 0x00, 0x02, 0xF0, 0x1F, 0xFF,
-    0xAA, 0xAF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x43, 0xD0, 0x3F, 0xFE, 0x7C, 0x0F, 0xEB, 0xFF, 0xC1, 0xF0, 0x0B,
-    0xFC, 0x3D, 0x00, 0x3F, 0xC3, 0xC0, 0x01, 0xFC, 0x3C, 0x00, 0x1F, 0xC3, 0xC0, 0x01, 0xFC, 0x3C,
-    0x00, 0x2F, 0xC3, 0xE0, 0x07, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0x80, 0x0B, 0xF4, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF4, 0x0D, 0x01, 0xFF, 0x00, 0xFF,
-    0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x40, 0x01,
-    0x80, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xA5, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0xFE, 0x3F, 0x40,
-    0x00, 0x6F, 0xFE, 0x3F, 0x80, 0x00, 0x01, 0xFA, 0x3F, 0xC0, 0x00, 0x01, 0xF0, 0x2F, 0xF4, 0x00,
-    0x02, 0xF0, 0x1F, 0xFF, 0xAA, 0xAF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x3D, 0x03, 0xFF, 0xE7, 0xC0, 0xFE, 0xBF, 0xFC, 0x1F, 0x00, 0xBF, 0xC3,
-    0xD0, 0x03, 0xFC, 0x3C, 0x00, 0x1F, 0xC3, 0xC0, 0x01, 0xFC, 0x3C, 0x00, 0x1F, 0xC3, 0xC0, 0x02,
-    0xFC, 0x3E, 0x00, 0x7F, 0xC1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x00,
-    0xBF, 0x4F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0xD0, 0x1F, 0xF0, 0x0F, 0xFF, 0xFE,
-    0x01, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x1D,
-    0x02, 0xC0, 0x00, 0x00, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x0F,
-    0xD0, 0x00, 0x03, 0xF4, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00,
-    0x00, 0xFD, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x00, 0x3F,
-    0x83, 0xF8, 0x00, 0x00, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFA, 0xAA, 0xAF, 0xFC, 0x3F, 0xC0, 0x00,
-    0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x07, 0xFC,
-    0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x07, 0xEF, 0x00, 0x00, 0x1E, 0x03, 0xC0, 0x00, 0x34, 0x00, 0xA0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x69, 0x00, 0x01, 0xF7, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0x7C, 0x02, 0xF4, 0x00,
-    0x3C, 0x02, 0xF0, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x3D, 0x03, 0xF0, 0x00,
-    0x3D, 0x03, 0xF0, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0xBE, 0x03, 0xF4, 0x00,
-    0xBE, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x03, 0xF0,
-    0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x0F,
-    0xD0, 0x00, 0x03, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xE5,
-    0x55, 0x57, 0xF8, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x0F, 0xFA, 0xAA, 0xAB, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x00, 0x07, 0xFC,
-    0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x6B, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0xA0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x69, 0x00, 0x01, 0xF7, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xF4, 0x01, 0xFF, 0x01, 0xF8, 0x02, 0xFC, 0x00, 0x7C, 0x02, 0xF4, 0x00, 0x3C, 0x02, 0xF0,
-    0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x3D, 0x03, 0xF0,
-    0x00, 0x3D, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x00,
-    0x01, 0xFC, 0x0E, 0x3C, 0xF0, 0xD3, 0x83, 0xED, 0x34, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xE0, 0x00,
-    0xFE, 0x00, 0x1F, 0xE0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x1C, 0x71, 0xE2, 0xCB, 0x07, 0xF8, 0x60, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01,
-    0xE0, 0x00, 0x2E, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x04, 0x1B, 0xFF, 0xFD, 0x3F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x7F,
-    0x80, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F,
-    0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xD1,
-    0xFD, 0x2F, 0xD2, 0xFE, 0x2F, 0xE2, 0xFE, 0x0E, 0x03, 0x80, 0x30, 0x03, 0xE8, 0x0B, 0xC0, 0x00,
-    0x0B, 0xC0, 0xFD, 0x0F, 0xD1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x78, 0x07,
-    0x80, 0x78, 0x07, 0x80, 0x78, 0x07, 0x80, 0xB8, 0x0B, 0xC0, 0xBC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0,
-    0xFD, 0x0D, 0x03, 0x80, 0x30, 0x03, 0xE8, 0x0B, 0xC0, 0x00, 0x3F, 0x1F, 0xC7, 0xF2, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x47, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F,
-    0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xE3, 0xF9, 0xFE, 0x7F, 0xDF, 0xF7,
-    0xFC, 0x0E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0xB8, 0x2F, 0x0B, 0xC3, 0xF0, 0xFC,
-    0x3F, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x01, 0xFC, 0x3F,
-    0x00, 0x01, 0xFC, 0x3F, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x01, 0xFC, 0x3F,
-    0x00, 0x02, 0xFC, 0x3F, 0x00, 0x02, 0xFC, 0x3F, 0x00, 0x02, 0xFC, 0x3F, 0x00, 0x02, 0xFC, 0x3F,
-    0x00, 0x02, 0xF8, 0x3F, 0x40, 0x02, 0xF8, 0x3F, 0x40, 0x02, 0xF8, 0x3F, 0x40, 0x02, 0xF8, 0x3F,
-    0x40, 0x03, 0xF8, 0x3F, 0x80, 0x03, 0xF4, 0x3F, 0x80, 0x03, 0xF4, 0x7F, 0x80, 0x03, 0xF4, 0x7F,
-    0xC0, 0x03, 0xF4, 0x7F, 0xC0, 0x03, 0xF4, 0x7F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x09, 0x7F, 0xF0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00,
-    0x3F, 0x1F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0x90, 0x78, 0x00,
-    0x00, 0x0B, 0xC1, 0xE0, 0x00, 0x00, 0x2E, 0x07, 0x80, 0x00, 0x00, 0xB8, 0x1E, 0x00, 0x00, 0x02,
-    0xE0, 0x78, 0x00, 0x00, 0x0B, 0x81, 0xE0, 0x00, 0x00, 0x2D, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x2F,
-    0x00, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00,
-    0x00, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xC0, 0xFD, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x16, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xD2, 0xD0, 0x0F, 0x00, 0x74, 0x04, 0x07, 0xF4, 0x00,
-    0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B,
-    0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0,
-    0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00,
-    0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0x10, 0xBF,
-    0xC0, 0x3F, 0xFF, 0x40, 0x3F, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xE0, 0xF0, 0x02, 0xC0, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x1F, 0xFF,
-    0x00, 0x0F, 0xFF, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x02, 0xF4, 0x07, 0xF0,
-    0x00, 0xBD, 0x03, 0xF8, 0x00, 0x2F, 0x42, 0xFC, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x03, 0xF0, 0xFF,
-    0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x02, 0xFA, 0xFF, 0x40, 0x00, 0xFE, 0x3F, 0xF4, 0x00, 0x3F, 0x83, 0xFF, 0x40,
-    0x0F, 0xE0, 0x7F, 0xF4, 0x03, 0xF4, 0x0B, 0xFF, 0x40, 0xFD, 0x00, 0xFF, 0xF4, 0x3F, 0x40, 0x0F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x02, 0xF0, 0x3E, 0x00, 0x2F, 0x0F, 0xC0, 0x02, 0xF3, 0xF0, 0x00, 0x2F, 0xBD, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xF3, 0xFC, 0x00,
-    0x3F, 0x1F, 0xF0, 0x03, 0xF0, 0xBF, 0xC0, 0x3F, 0x02, 0xFF, 0x03, 0xF0, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0x01, 0x40, 0x0F, 0x07, 0xC0, 0x0F, 0x0F, 0x40, 0x0F, 0x2E,
-    0x00, 0x0E, 0x3C, 0x00, 0x1E, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xE0, 0x00,
-    0x2F, 0xF8, 0x00, 0x2D, 0xBE, 0x00, 0x3D, 0x3F, 0x80, 0x3D, 0x0F, 0xE0, 0x3D, 0x07, 0xF8, 0x02,
-    0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x07, 0x80, 0x2D, 0x00, 0xF0, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xF8,
-    0x03, 0xE0, 0x0F, 0x80, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x7D, 0x01, 0xF4, 0x07, 0xD0,
-    0x1F, 0x40, 0x7D, 0x01, 0xF4, 0x07, 0xFF, 0x1F, 0xFD, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x01, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3D, 0x00, 0xF4,
-    0x03, 0xD0, 0x0F, 0x40, 0x7D, 0x01, 0xF4, 0x07, 0xD0, 0x1F, 0x40, 0x7D, 0x01, 0xF4, 0x07, 0xFF,
-    0x1F, 0xFD, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xC1, 0xFD, 0x07, 0xF0,
-    0x2F, 0xC0, 0xFE, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x50, 0x2F, 0x80, 0x0F, 0x02,
-    0xF8, 0x00, 0xF0, 0x2F, 0x40, 0x0F, 0x02, 0xF4, 0x01, 0xF0, 0x2F, 0x40, 0x1F, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x40, 0x00, 0x2D, 0x1F, 0x02, 0xD1, 0xF0, 0x3D, 0x2F, 0x03,
-    0xD2, 0xF0, 0x3C, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03,
-    0xD0, 0x00, 0x3D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0,
-    0x00, 0x7D, 0x00, 0x07, 0xFF, 0x00, 0x7F, 0xF4, 0x07, 0xFF, 0x80, 0x05, 0x40, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x01, 0xF8,
-    0x2F, 0x80, 0x2F, 0x82, 0xF8, 0x02, 0xFC, 0x2F, 0x40, 0x3F, 0xC2, 0xF4, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x3F, 0x0F, 0x80, 0xFC, 0x3D, 0x07,
-    0xF0, 0xF4, 0x2F, 0xD3, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7D, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xD0,
-    0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x1F, 0xFD, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x3D, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x01, 0x00, 0x03, 0xF3, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xD3, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xC3, 0xFF, 0xFF, 0xFF, 0x00, 0x2F,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x3D, 0x19, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x02, 0xF8, 0x7D, 0x00, 0x2F, 0xD0, 0x7D, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x1A, 0x80, 0x00,
-    0x0F, 0xC0, 0xBF, 0x40, 0x00, 0x3F, 0x03, 0xFF, 0x00, 0x00, 0xFC, 0x0F, 0xFD, 0x00, 0x07, 0xF0,
-    0x3F, 0xFC, 0x00, 0x1F, 0xC0, 0xFF, 0xF0, 0x00, 0x7F, 0x03, 0xFF, 0xE0, 0x02, 0xFC, 0x0F, 0xDF,
-    0xC0, 0x0B, 0xE0, 0x7F, 0x3F, 0x80, 0x2F, 0x81, 0xFC, 0x7F, 0x00, 0xFE, 0x07, 0xF0, 0xFE, 0x03,
-    0xF8, 0x2F, 0xC1, 0xFC, 0x0F, 0xE0, 0xBF, 0x03, 0xF8, 0x3F, 0x42, 0xFC, 0x07, 0xF0, 0xFD, 0x0F,
-    0xF0, 0x0F, 0xD3, 0xF4, 0x3F, 0xC0, 0x1F, 0xDF, 0xD0, 0xFF, 0x40, 0x3F, 0xBF, 0x43, 0xFD, 0x00,
-    0xBF, 0xFC, 0x0F, 0xF4, 0x00, 0xFF, 0xF0, 0x3F, 0xD0, 0x02, 0xFF, 0xC0, 0xFF, 0x40, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x1F, 0xE0, 0x01, 0xFF, 0xFF, 0xD0, 0x1F, 0xF4, 0x7F, 0x01, 0xFC,
-    0x00, 0xF8, 0x2F, 0x40, 0x0B, 0x82, 0xF0, 0x00, 0xBC, 0x2F, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0xBC,
-    0x3F, 0x40, 0x0F, 0xC3, 0xF4, 0x00, 0xFC, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x3F, 0x40,
-    0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0F, 0xC0, 0xBF,
-    0x40, 0x00, 0x3F, 0x03, 0xFE, 0x00, 0x00, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xF0, 0x3F, 0xF8, 0x00,
-    0x1F, 0xC0, 0xFF, 0xF0, 0x00, 0x7F, 0x03, 0xFF, 0xE0, 0x02, 0xFC, 0x0F, 0xDF, 0xC0, 0x0B, 0xE0,
-    0x7F, 0x3F, 0x80, 0x2F, 0x81, 0xFC, 0x7F, 0x00, 0xBE, 0x07, 0xF0, 0xFE, 0x03, 0xF8, 0x2F, 0xC1,
-    0xFC, 0x0F, 0xE0, 0xBF, 0x03, 0xF4, 0x3F, 0x42, 0xFC, 0x07, 0xF0, 0xFD, 0x0B, 0xF0, 0x0F, 0xD3,
-    0xF4, 0x3F, 0xC0, 0x2F, 0xDF, 0xD0, 0xFF, 0x40, 0x3F, 0xBF, 0x43, 0xFD, 0x00, 0xBF, 0xFC, 0x0F,
-    0xF4, 0x00, 0xFF, 0xF0, 0x3F, 0xD0, 0x02, 0xFF, 0xC0, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1F, 0xE0, 0x01, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xF4, 0x7F, 0x01, 0xFC, 0x00, 0xF8, 0x2F, 0x40, 0x0B, 0x82, 0xF0, 0x00, 0xBC, 0x2F, 0x00,
-    0x0B, 0xC2, 0xF0, 0x00, 0xBC, 0x3F, 0x40, 0x0F, 0xC3, 0xF4, 0x00, 0xFC, 0x3F, 0x40, 0x0F, 0xD3,
-    0xF4, 0x00, 0xFD, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x01, 0xD0, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0F, 0xC0, 0xBF, 0x40, 0x00, 0x3F, 0x03, 0xFE,
-    0x00, 0x00, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xF0, 0x3F, 0xF8, 0x00, 0x1F, 0xC0, 0xFF, 0xF0, 0x00,
-    0x7F, 0x03, 0xFF, 0xE0, 0x02, 0xFC, 0x0F, 0xDF, 0xC0, 0x0B, 0xE0, 0x7F, 0x3F, 0x80, 0x2F, 0x81,
-    0xFC, 0x7F, 0x00, 0xBE, 0x07, 0xF0, 0xFE, 0x03, 0xF8, 0x2F, 0xC1, 0xFC, 0x0F, 0xE0, 0xBF, 0x03,
-    0xF4, 0x3F, 0x42, 0xFC, 0x07, 0xF0, 0xFD, 0x0B, 0xF0, 0x0F, 0xD3, 0xF4, 0x3F, 0xC0, 0x2F, 0xDF,
-    0xD0, 0xFF, 0x40, 0x3F, 0xBF, 0x43, 0xFD, 0x00, 0xBF, 0xFC, 0x0F, 0xF4, 0x00, 0xFF, 0xF0, 0x3F,
-    0xD0, 0x02, 0xFF, 0xC0, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x01, 0x40, 0x01, 0x40, 0x0E, 0x00, 0xB0,
-    0x00, 0x3D, 0x7C, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1F, 0xE0, 0x01,
-    0xFF, 0xFF, 0xD0, 0x1F, 0xF4, 0x7F, 0x01, 0xFC, 0x00, 0xF8, 0x2F, 0x40, 0x0B, 0x82, 0xF0, 0x00,
-    0xBC, 0x2F, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0xBC, 0x3F, 0x40, 0x0F, 0xC3, 0xF4, 0x00, 0xFC, 0x3F,
-    0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1B, 0xE4, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xF4,
-    0x2F, 0x01, 0xFC, 0x00, 0xF8, 0x1F, 0x80, 0x0B, 0xC1, 0xF4, 0x00, 0xBC, 0x1F, 0x40, 0x0B, 0xC2,
-    0xF4, 0x00, 0xBD, 0x2F, 0x40, 0x0B, 0xD2, 0xF4, 0x00, 0xBD, 0x3F, 0x80, 0x0B, 0xD3, 0xF8, 0x00,
-    0xBE, 0x3F, 0x80, 0x0B, 0xE3, 0xF8, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x0F, 0xC0, 0xBF, 0x40, 0x00, 0x3F, 0x03, 0xFE, 0x00, 0x00, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xF0,
-    0x3F, 0xF8, 0x00, 0x1F, 0xC0, 0xFF, 0xF0, 0x00, 0x7F, 0x03, 0xFF, 0xE0, 0x02, 0xFC, 0x0F, 0xDF,
-    0xC0, 0x0B, 0xE0, 0x7F, 0x3F, 0x80, 0x2F, 0x81, 0xFC, 0x7F, 0x00, 0xBE, 0x07, 0xF0, 0xFE, 0x03,
-    0xF8, 0x2F, 0xC1, 0xFC, 0x0F, 0xE0, 0xBF, 0x03, 0xF4, 0x3F, 0x42, 0xFC, 0x07, 0xF0, 0xFD, 0x0B,
-    0xF0, 0x0F, 0xD3, 0xF4, 0x3F, 0xC0, 0x2F, 0xDF, 0xD0, 0xFF, 0x40, 0x3F, 0xBF, 0x43, 0xFD, 0x00,
-    0xBF, 0xFC, 0x0F, 0xF4, 0x00, 0xFF, 0xF0, 0x3F, 0xD0, 0x02, 0xFF, 0xC0, 0xFF, 0x40, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1B, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x0E, 0x1F, 0xE0, 0x01, 0xFF, 0xFF, 0xD0, 0x1F, 0xF4, 0x7F, 0x01, 0xFC,
-    0x00, 0xF8, 0x2F, 0x40, 0x0B, 0x82, 0xF0, 0x00, 0xBC, 0x2F, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0xBC,
-    0x3F, 0x40, 0x0F, 0xC3, 0xF4, 0x00, 0xFC, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x3F, 0x40,
-    0x0F, 0xD3, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xBF, 0xFE,
-    0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x1F, 0xC0,
-    0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00,
-    0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0xD0, 0x00, 0x02, 0xFD,
-    0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xAA, 0xFF, 0x40, 0xFF, 0xFF, 0xF8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0xFE, 0x46, 0xF4, 0x1F, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03,
-    0xE3, 0xD0, 0x00, 0x2F, 0x3D, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF,
-    0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1D, 0x00,
-    0x1D, 0x00, 0x00, 0x0E, 0x00, 0x2C, 0x00, 0x00, 0x0F, 0x95, 0xB8, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x1F, 0xC0,
-    0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00,
-    0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0xD0, 0x00, 0x02, 0xFD,
-    0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x50, 0x07, 0x00, 0x70, 0x00, 0xB0, 0x03, 0xC0, 0x1E, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0xFE, 0x46, 0xF4, 0x1F, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE3, 0xD0,
-    0x00, 0x2F, 0x3D, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF, 0xEF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0x90, 0x00, 0x1A,
-    0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xE5, 0x7F, 0xF4, 0x00,
-    0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x0F,
-    0xE0, 0x00, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x3F,
-    0x00, 0x00, 0x00, 0x7F, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0xFC,
-    0x00, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x41, 0xFF,
-    0xE5, 0x56, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x2F, 0x00,
-    0x02, 0xF4, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0x14, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x03, 0xF9, 0x1B,
-    0xD0, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x3E, 0x00,
-    0x0F, 0x40, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xF4,
-    0x00, 0xBD, 0x00, 0x07, 0xFF, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE1, 0xAA, 0xAB, 0xFE, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xF9, 0x5F, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xF0, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xE0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x7F, 0xF9, 0x55, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x55,
-    0x54, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x1B, 0xF9, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xE2, 0xF4,
-    0x0B, 0x40, 0x3F, 0x91, 0xBF, 0xF0, 0x00, 0xB0, 0x1F, 0x00, 0x07, 0xF0, 0x00, 0x1E, 0x0F, 0x80,
-    0x00, 0xFD, 0x6B, 0xFF, 0xC3, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0xF4, 0x00, 0x0B, 0xD5, 0x40,
-    0x00, 0x3D, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0xFF, 0x95, 0x78, 0x0F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE,
-    0x00, 0xBF, 0xFF, 0x87, 0xFF, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x1F, 0xC0, 0x0F, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x03,
-    0xD0, 0x1F, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x1F, 0xD0, 0x2F, 0xAA, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x3F, 0xC0, 0x2F,
-    0xC0, 0x3F, 0x80, 0x0B, 0xE0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07,
-    0xF4, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07,
-    0xFD, 0x00, 0x3C, 0x00, 0x07, 0x40, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0xAD, 0x0F, 0xBF, 0xD0, 0xFF, 0xFE, 0x0F, 0xF0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0,
-    0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0x00, 0x0F, 0x00, 0x1F, 0xC0, 0x0F, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x03, 0xD0, 0x1F, 0x00,
-    0x03, 0xE0, 0x1F, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x1F, 0xD0, 0x2F, 0xAA, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x3F, 0xC0, 0x2F, 0xC0, 0x3F, 0x80,
-    0x0B, 0xE0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07, 0xF4, 0x3F, 0xC0,
-    0x07, 0xF8, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xC2,
-    0xB4, 0x0F, 0xBF, 0xD0, 0x3F, 0xFF, 0x80, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00,
-    0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x0A,
-    0x00, 0x00, 0xF4, 0x78, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x1F, 0xC0, 0x0F, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x03,
-    0xD0, 0x1F, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x1F, 0xD0, 0x2F, 0xAA, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x3F, 0xC0, 0x2F,
-    0xC0, 0x3F, 0x80, 0x0B, 0xE0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07,
-    0xF4, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07,
-    0xFD, 0x34, 0x00, 0xA0, 0x38, 0x1E, 0x00, 0x3E, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xAD, 0x03, 0xEF, 0xF4, 0x0F, 0xFF, 0xE0, 0x3F, 0xC0, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x90, 0x04,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x17, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x01, 0x40, 0x00,
-    0x3F, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x3F, 0xFF, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x1F, 0xAA,
-    0xFD, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x80, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0x8B, 0x40, 0x00, 0x00,
-    0x2D, 0x01, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0x90, 0x04, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x17, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x01, 0x40, 0x00, 0x3F, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xFF, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xFC, 0x00,
-    0x07, 0x83, 0xC0, 0x07, 0x40, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x41, 0xFA, 0xAF,
-    0xD1, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x90, 0x04, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x17, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x01, 0x40, 0x00, 0x3F, 0xFD,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
-    0x3A, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x16,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0xF4, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x01, 0xBF,
-    0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x7E, 0xAB, 0xF4, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFE, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x90, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x07, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2C, 0x00, 0xE0, 0x00, 0x00, 0x0B, 0x47, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x90,
-    0x04, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x17, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x01, 0x40,
-    0x00, 0x3F, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x05, 0x00, 0xE0, 0x0B, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x1F,
-    0xAA, 0xFD, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x80, 0x6F, 0xFE, 0x40, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xAF, 0xEA, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
-    0x05, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x1A, 0xFE, 0xA4, 0x3F, 0xFF, 0xFC, 0x00, 0xF8, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
-    0xF4, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFD, 0x50, 0x01, 0xFF, 0xF8, 0x02, 0xFF, 0xF8, 0x01, 0xFF,
-    0xFC, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x0B, 0xF0, 0x00, 0x05, 0x40,
-    0x00, 0x34, 0x00, 0xB0, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xAF, 0xEA, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x1F, 0x00, 0x2C, 0x1F, 0x00, 0xBC, 0x2E, 0x00, 0xFC, 0x04, 0x00, 0xFC, 0x00, 0x1A,
-    0xFE, 0xA4, 0x3F, 0xFF, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
-    0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFD, 0x50,
-    0x01, 0xFF, 0xF8, 0x02, 0xFF, 0xF8, 0x01, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xAF, 0xEA, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x02, 0xAB, 0xFA, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x06, 0xBF, 0xA9, 0x0F,
-    0xFF, 0xFF, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x2A, 0xBF, 0xA9, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0x00, 0x7E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x54, 0x00, 0x7F, 0xFE,
-    0x00, 0xBF, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0D, 0x00, 0x00,
-    0x38, 0xB0, 0xD0, 0x00, 0x03, 0x43, 0xFC, 0x00, 0x00, 0x24, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x15, 0x53, 0xFC,
-    0x00, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x2F,
-    0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80,
-    0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC,
-    0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x1F, 0xC2, 0xFC, 0x00,
-    0x02, 0xFC, 0x2F, 0xE0, 0x00, 0x7F, 0xC1, 0xFF, 0xEA, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xC0, 0x07, 0x1E, 0x2C, 0x00, 0xB0, 0x7F, 0x40,
-    0x06, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x0F, 0x83, 0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3,
-    0xE0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF4, 0x03,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFB, 0xC0, 0x3F, 0xFD, 0xBC, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFE, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFD,
-    0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00,
-    0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3,
-    0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00,
-    0x1F, 0xC2, 0xFC, 0x00, 0x02, 0xFC, 0x2F, 0xE0, 0x00, 0x7F, 0xC1, 0xFF, 0xEA, 0xBF, 0xF8, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x2F, 0xFF, 0xEA,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x83, 0xD0,
-    0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC,
-    0x3E, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF4, 0x03, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFB, 0xC0, 0x3F, 0xFD, 0xBC, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0xB0, 0x00, 0x07, 0x40, 0x0F, 0x00, 0x00, 0x3E, 0x57, 0xD0, 0x00, 0x01, 0xFF,
-    0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x54, 0x3F, 0xC0, 0x00,
-    0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x02, 0xFD, 0x3F,
-    0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01,
-    0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4,
-    0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x2F,
-    0xC2, 0xFE, 0x00, 0x07, 0xFC, 0x1F, 0xFE, 0xAB, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0D, 0x00, 0x0D, 0x00, 0xE0, 0x01, 0xD0, 0x0B, 0x95, 0xBC, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0xC3, 0xE0, 0x00,
-    0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F,
-    0x40, 0x3F, 0xC1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xBC, 0x03, 0xFF, 0xDB,
-    0xC0, 0x01, 0x50, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x30, 0x90, 0x00, 0x00, 0x07, 0x06,
-    0x00, 0x00, 0x00, 0x3A, 0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x54, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8,
-    0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F,
-    0xD3, 0xF8, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40,
-    0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x01, 0xFC,
-    0x2F, 0xC0, 0x00, 0x2F, 0xC2, 0xFE, 0x00, 0x07, 0xFC, 0x1F, 0xFE, 0xAB, 0xFF, 0x81, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0A, 0x0C, 0x00, 0x00, 0xD0, 0xC0, 0x00, 0x0B,
-    0xAC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xF8, 0x3D, 0x00,
-    0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2,
-    0xF0, 0x00, 0xFC, 0x2F, 0x40, 0x3F, 0xC1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xBC, 0x03, 0xFF, 0xDB, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x05, 0x00, 0x00, 0x54, 0x00, 0x2F, 0x00,
-    0x02, 0xF0, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x04, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x05, 0x40, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x3F, 0x80, 0x00, 0x2F, 0xE0, 0x3F,
-    0x80, 0x00, 0x2F, 0xD0, 0x3F, 0x80, 0x00, 0x2F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80,
-    0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00,
-    0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F,
-    0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x00, 0x2F, 0xC0,
-    0x2F, 0xE0, 0x00, 0x7F, 0xC0, 0x1F, 0xFE, 0xAB, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x01, 0xF4, 0x00, 0x0F, 0x80, 0x2F, 0x40, 0x01,
-    0xF4, 0x03, 0xF4, 0x00, 0x2F, 0x40, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0x40,
-    0x03, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0xFC,
-    0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x02,
-    0xF0, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x0F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xBC, 0x00, 0x00, 0xFF, 0xF6, 0xF0, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x05, 0x43, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xE3, 0xF8,
-    0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F,
-    0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40,
-    0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC,
-    0x3F, 0x80, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x02, 0xFC, 0x2F, 0xE0, 0x00, 0x7F, 0xC1, 0xFF, 0xEA,
-    0xBF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x3D, 0x00, 0x0F, 0x83, 0xD0,
-    0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC,
-    0x3E, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF4, 0x03, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFB, 0xC0, 0x3F, 0xFD, 0xBC, 0x00, 0x15, 0x2D, 0x00,
-    0x00, 0x07, 0x40, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0xBF, 0x00, 0x1F, 0xE0, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xE0, 0x03, 0xF4, 0x07,
-    0xFF, 0x80, 0x3F, 0x40, 0x0F, 0xE0, 0x3F, 0xFF, 0x01, 0xFC, 0x00, 0x2F, 0xC2, 0xFE, 0xFE, 0x0B,
-    0xF0, 0x00, 0xBF, 0x0F, 0xF2, 0xFC, 0x3F, 0x80, 0x01, 0xFC, 0xBF, 0x83, 0xF8, 0xFD, 0x00, 0x03,
-    0xFB, 0xFD, 0x0F, 0xF7, 0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x40,
-    0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x00, 0x00, 0x00, 0x0B, 0x42,
-    0xC0, 0x00, 0x00, 0x28, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0xA8, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x2F, 0x40, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x3C, 0x03, 0xF0, 0x0F,
-    0xC0, 0xBE, 0x03, 0xF0, 0x0B, 0xD1, 0xFF, 0x47, 0xE0, 0x07, 0xE3, 0xFF, 0xCB, 0xD0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xEB, 0xFF, 0x80, 0x01, 0xFF, 0xC3,
-    0xFF, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBA, 0xE0, 0x00, 0x00, 0x2D,
-    0x07, 0x80, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0xFC, 0x00,
-    0x02, 0xF8, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xFC, 0x01, 0xFC, 0x00,
-    0x0F, 0xD0, 0x3F, 0x80, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F,
-    0x7D, 0x00, 0x01, 0xE0, 0x2D, 0x00, 0x09, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0xBC,
-    0x0F, 0x80, 0x03, 0xE0, 0x1F, 0x40, 0x1F, 0x40, 0x3F, 0x00, 0xBC, 0x00, 0x7D, 0x03, 0xF0, 0x00,
-    0xFC, 0x1F, 0x80, 0x01, 0xF8, 0xBD, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x2F,
-    0x40, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x02, 0xF8, 0x0B, 0xF0,
-    0x00, 0x3F, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x3F, 0x80,
-    0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6A, 0xAA, 0xAF, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0xFD, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6A, 0xAA,
-    0xAF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFD, 0x01, 0x55, 0x5F, 0xD0, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0x83, 0xFF, 0xFF, 0xFC, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x1D, 0x00, 0xF0, 0x00, 0x00, 0x07,
-    0x87, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x6A, 0xAA, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0x40, 0x06, 0x00, 0x0E, 0x02,
-    0xC0, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF,
-    0xD0, 0x15, 0x55, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xBE, 0x00, 0xFF, 0xC0,
-    0xBC, 0x10, 0x3C, 0x00, 0x1F, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1C, 0x00, 0x06, 0xFF, 0xE4, 0x01, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x2C, 0x02, 0xFF,
-    0x95, 0xFF, 0xD3, 0x80, 0x7F, 0xC0, 0x01, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x01, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x3F,
-    0x00, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x03,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0,
-    0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xE5, 0x56, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x6F, 0xE4, 0x0D, 0x02, 0xFF, 0xFE, 0x0C, 0x0F, 0xE4, 0x6F, 0xAC, 0x1F, 0x00, 0x07, 0xF0,
-    0x3E, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0,
-    0x3E, 0x00, 0x03, 0xE0, 0x3F, 0x40, 0x0B, 0xD0, 0x1F, 0xFE, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xFD, 0x55, 0xBF, 0x43, 0xFF, 0xC0, 0x00, 0xFC, 0x3C, 0xBC, 0x00, 0x07, 0xD3, 0xCB,
-    0xC0, 0x00, 0x7D, 0x38, 0xBC, 0x00, 0x0B, 0xD1, 0x8F, 0xC0, 0x02, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x82, 0xB9, 0x00, 0x2E, 0x3F, 0xFE, 0x00, 0xBF, 0xF4,
-    0x7E, 0x02, 0xFF, 0x00, 0x3C, 0x0B, 0xF0, 0x00, 0xB8, 0x2F, 0xC0, 0x01, 0xF0, 0xBE, 0x00, 0x07,
-    0xC2, 0xFC, 0x00, 0x1F, 0x0B, 0xF0, 0x00, 0x7C, 0x2F, 0xF0, 0x03, 0xE0, 0xBF, 0xF9, 0xBF, 0x42,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xEF, 0xFF, 0xC0, 0x3E, 0x2F, 0xFC, 0x01, 0xF8, 0x01, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x02, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F,
-    0x40, 0x00, 0x3F, 0xAA, 0xAA, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xEF, 0xEA, 0xFF, 0x0B, 0x00, 0x3F, 0x00,
-    0x00, 0x0C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0x40,
-    0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x1A, 0xFE, 0xA4, 0xFF, 0xFF, 0xF0, 0x0F, 0x80,
-    0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF4,
-    0x00, 0x07, 0xE0, 0x00, 0x1F, 0xD5, 0x00, 0x7F, 0xFE, 0x02, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xAF, 0xEA, 0xFF, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x7F,
-    0xC0, 0x00, 0x2F, 0xFD, 0x3F, 0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0x80, 0x00, 0x2F, 0xD0, 0x3F, 0x80,
-    0x00, 0x2F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00,
-    0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F,
-    0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0,
-    0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x2F, 0xE0, 0x00, 0x7F, 0xC0, 0x1F,
-    0xFE, 0xAB, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x0C, 0x3D, 0x00, 0x0F, 0x8C, 0x3D, 0x00, 0x0F, 0xAC, 0x3D, 0x00, 0x0F,
-    0xF4, 0x3D, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x0F,
-    0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x2F, 0x40, 0x3F, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFB, 0xC0, 0x03, 0xFF, 0xDB, 0xC0, 0x00, 0x15, 0x00,
-    0x00, 0x3D, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x68, 0x07, 0x43, 0xC1, 0xF0, 0xB4, 0x3C, 0x00,
-    0x00, 0x3C, 0x00, 0x02, 0xF8, 0x00, 0x2E, 0xF4, 0x02, 0xD0, 0x74, 0x18, 0x00, 0x34, 0x1F, 0x40,
-    0xC3, 0xAC, 0x0C, 0x70, 0xB1, 0xC7, 0x03, 0xF8, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC2,
-    0xFA, 0xAA, 0xAA, 0x50, 0x38, 0x00, 0x38, 0xF0, 0x00, 0xE1, 0xF5, 0x6F, 0x02, 0xFF, 0xF4, 0x01,
-    0xFE, 0x00, 0x00, 0x0F, 0xC3, 0xF1, 0xFC, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0x3F,
-    0x01, 0xFC, 0x7F, 0x02, 0xFC, 0xBF, 0x43, 0xFC, 0x2F, 0x81, 0x0E, 0x00, 0xD0, 0x34, 0x01, 0x00,
-    0x1F, 0x83, 0x0A, 0x70, 0x63, 0xAD, 0x1F, 0x80, 0x00, 0x7D, 0x00, 0x03, 0xE0, 0x0B, 0xD0, 0x00,
-    0x7E, 0x00, 0xFD, 0x00, 0x0B, 0xE0, 0x0A, 0x40, 0x00, 0xA9, 0x00, 0x18, 0x00, 0x34, 0x2D, 0x07,
-    0x80, 0x2E, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x7D, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x1A, 0x00, 0x01, 0xA4, 0x55, 0x0B, 0xF4, 0x7F,
-    0x83, 0xF8, 0x3F, 0x81, 0xFC, 0x0F, 0xE0, 0x00, 0x1F, 0xF1, 0xFE, 0x2F, 0xD2, 0xFC, 0x3F, 0x83,
-    0xF4, 0xBF, 0x00, 0xFF, 0x4B, 0xF4, 0x7F, 0x83, 0xF8, 0x2F, 0xC1, 0xFC, 0x0F, 0xE0, 0x02, 0x80,
-    0xA3, 0xF8, 0x5E, 0x02, 0x80, 0x00, 0x34, 0x0D, 0x03, 0xF8, 0xE4, 0x34, 0x00, 0x00, 0x3F, 0xA9,
-    0x50, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x07,
-    0x07, 0x0A, 0x2C, 0x34, 0x00, 0x0C, 0x30, 0x30, 0x1C, 0x00, 0x02, 0x00, 0x0C, 0x01, 0x79, 0x0F,
-    0xFC, 0x3F, 0xF0, 0x6E, 0x40, 0x30, 0x00, 0x80, 0x02, 0x00, 0x30, 0x2B, 0x90, 0x30, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC7,
-    0xF2, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0x3F, 0x01, 0xFC, 0x7F, 0x02, 0xFC,
-    0xBF, 0x43, 0xFC, 0x1F, 0x83, 0x0A, 0x70, 0x63, 0xAD, 0x1F, 0x80, 0x05, 0x51, 0xFE, 0x2F, 0xD2,
-    0xFC, 0x2F, 0xC3, 0xF8, 0x7F, 0x4B, 0xF0, 0x08, 0x02, 0x40, 0x3A, 0x40, 0x0C, 0x00, 0x91, 0x6C,
-    0x3F, 0x40, 0x00, 0x00, 0x34, 0x0D, 0x02, 0x80, 0x38, 0x02, 0xFD, 0x01, 0x90, 0x19, 0x2D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3F, 0xFF, 0x0F, 0x57, 0xC3, 0x80, 0xB0, 0xE0, 0x2C, 0x18, 0x00, 0x34,
-    0x2D, 0x07, 0x80, 0x2E, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x00, 0x34, 0x00, 0x03, 0xF0,
-    0x00, 0x2E, 0xF0, 0x02, 0xD0, 0xF0, 0x38, 0x00, 0xB0, 0x1F, 0x40, 0xC3, 0xAC, 0x0C, 0x70, 0xB1,
-    0xC7, 0x03, 0xF8, 0x10, 0x05, 0x00, 0x00, 0x55, 0x82, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0xAA,
-    0xF0, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0xC3, 0xAC, 0x0C, 0x70, 0xB1, 0xC7, 0x03,
-    0xF8, 0x10, 0x05, 0x00, 0x2A, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x34, 0x0C,
-    0x0C, 0x38, 0x10, 0x38, 0x0B, 0x0E, 0x02, 0xC3, 0xD5, 0xF0, 0xFF, 0xFC, 0x3F, 0xFE, 0x34, 0x0A,
-    0x30, 0x0A, 0x30, 0x0A, 0x30, 0x0A, 0x3F, 0xFE, 0x00, 0x00, 0x1E, 0x44, 0x09, 0x24, 0x83, 0x08,
-    0x30, 0xC2, 0x0C, 0x20, 0x43, 0x00, 0x18, 0x90, 0xE8, 0x07, 0x00, 0xEC, 0x34, 0xD0, 0x1F, 0x40,
-    0xC3, 0xAC, 0x0C, 0x70, 0xB1, 0xC7, 0x03, 0xF8, 0x10, 0x05, 0x00, 0x10, 0x3C, 0x0A, 0x1D, 0x10,
-    0x00, 0x07, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0x3F, 0x01, 0xFC, 0x7F, 0x02, 0xFC, 0xBF, 0x43,
-    0xFC, 0x15, 0x55, 0x0F, 0xFF, 0xC3, 0x80, 0xB0, 0xE0, 0x2C, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xAA, 0xFF, 0xE0, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x02, 0xE2, 0xD0, 0x2E,
-    0x3D, 0x02, 0xE3, 0xD0, 0x3E, 0x3D, 0x03, 0xE3, 0xD0, 0x3E, 0x29, 0x02, 0x90, 0x00, 0x00, 0x3F,
-    0xFE, 0x3F, 0xFE, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x06, 0x00, 0x00, 0xC0, 0x00, 0x0C, 0x01, 0xF5, 0x8C, 0x3A, 0xF4, 0xC7, 0x0B, 0x5C, 0x70,
-    0x7F, 0x80, 0x0A, 0x50, 0x00, 0xD0, 0x00, 0x0C, 0x00, 0x02, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x07, 0xFF, 0x80, 0x54, 0x3F, 0x2F, 0xD6, 0xF8, 0x00, 0x3F, 0x7F, 0x00, 0x3F, 0x80, 0xBD, 0xBF,
-    0x00, 0x07, 0xFF, 0xF8, 0x00, 0x1F, 0x00, 0x15, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x01, 0x81,
-    0xF5, 0xF0, 0x0B, 0x4B, 0x81, 0xF0, 0x3C, 0x3D, 0x01, 0xFA, 0xF0, 0xA0, 0x01, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x74, 0xBC, 0x3E, 0x02, 0xD3, 0xD0, 0x2F,
-    0x6F, 0x0A, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1F, 0xC3,
-    0x00, 0x00, 0x41, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x1D, 0x0C, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xE0, 0x00, 0x00, 0x01, 0xD0, 0x07, 0x90,
-    0x00, 0x1B, 0x80, 0x00, 0x1A, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0xB9,
-    0x00, 0x01, 0xBC, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xD0, 0x90, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81,
-    0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E,
-    0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x7E,
-    0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x03, 0xE0, 0x7E, 0x00, 0x02, 0xF0, 0x7E, 0x00, 0x02, 0xE0, 0x7E,
-    0x00, 0x03, 0xE0, 0x7F, 0xAA, 0xAF, 0xC0, 0x7F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x7E,
-    0x00, 0x07, 0xF4, 0x7E, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0xBD, 0x7E,
-    0x00, 0x00, 0xBE, 0x7E, 0x00, 0x00, 0xFE, 0x7E, 0x00, 0x0B, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFE, 0x40, 0x15, 0x55, 0x54, 0x3F, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFC, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xEF,
-    0x80, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x01, 0xFC, 0x7E, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00,
-    0x00, 0x3F, 0x02, 0xF8, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0xBE,
-    0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x00,
-    0xFE, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x3F, 0xD5, 0x55, 0x5B, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xEA, 0xA0, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6A, 0xAA, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x0F,
-    0xD0, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00,
-    0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x00, 0x3F,
-    0x43, 0xF8, 0x00, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xEA, 0xAA,
-    0xBF, 0xF0, 0xFF, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x07, 0xFC,
-    0x3F, 0xC0, 0x00, 0x1F, 0xF1, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0,
-    0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00,
-    0x00, 0xBE, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x0B, 0xFF, 0xF0, 0x7F, 0x7E, 0x0F, 0xFE, 0xA0,
-    0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE,
-    0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3,
-    0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x8F, 0xE7, 0xF9,
-    0xFF, 0x7F, 0xDF, 0xF0, 0x07, 0xE0, 0x0B, 0xF0, 0x02, 0xF4, 0x07, 0xF0, 0x00, 0xBD, 0x03, 0xF8,
-    0x00, 0x2F, 0x42, 0xFC, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x03, 0xF0, 0xFF, 0x00, 0x00, 0xFC, 0x7F,
-    0x00, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x02,
-    0xFA, 0xFF, 0x40, 0x00, 0xFE, 0x3F, 0xF4, 0x00, 0x3F, 0x83, 0xFF, 0x40, 0x0F, 0xE0, 0x7F, 0xF4,
-    0x03, 0xF4, 0x0B, 0xFF, 0x40, 0xFD, 0x00, 0xFF, 0xF4, 0x3F, 0x40, 0x0F, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFD,
-    0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x00, 0x2F, 0xD0,
-    0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x00,
-    0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x00,
-    0x1F, 0xD0, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x00,
-    0x0F, 0xD0, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0xC0,
-    0x00, 0x0F, 0xF8, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x7F,
-    0xFC, 0x00, 0x0F, 0xFF, 0x01, 0xFF, 0xF4, 0x00, 0xBF, 0xFC, 0x07, 0xEF, 0xF0, 0x03, 0xFB, 0xF0,
-    0x2F, 0x7F, 0xD0, 0x1F, 0xDF, 0xC0, 0xBD, 0x7F, 0x80, 0xFF, 0x3F, 0x02, 0xF8, 0xFF, 0x03, 0xF5,
-    0xFD, 0x0B, 0xE2, 0xFE, 0x2F, 0xC7, 0xF4, 0x2F, 0x87, 0xFC, 0xFF, 0x1F, 0xD0, 0xFE, 0x0F, 0xFB,
-    0xF4, 0xBF, 0x83, 0xFC, 0x1F, 0xFF, 0xC2, 0xFE, 0x0F, 0xF0, 0x3F, 0xFE, 0x0B, 0xF8, 0x3F, 0xC0,
-    0xBF, 0xF4, 0x2F, 0xF0, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xC3, 0xFC, 0x03, 0xFE, 0x03, 0xFF, 0x0F,
-    0xF0, 0x07, 0xF0, 0x0F, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0F, 0xC0, 0xBF, 0x40, 0x00, 0x3F, 0x03,
-    0xFE, 0x00, 0x00, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xF0, 0x3F, 0xF8, 0x00, 0x1F, 0xC0, 0xFF, 0xF0,
-    0x00, 0x7F, 0x03, 0xFF, 0xE0, 0x02, 0xFC, 0x0F, 0xDF, 0xC0, 0x0B, 0xE0, 0x7F, 0x3F, 0x80, 0x2F,
-    0x81, 0xFC, 0x7F, 0x00, 0xBE, 0x07, 0xF0, 0xFE, 0x03, 0xF8, 0x2F, 0xC1, 0xFC, 0x0F, 0xE0, 0xBF,
-    0x03, 0xF4, 0x3F, 0x42, 0xFC, 0x07, 0xF0, 0xFD, 0x0B, 0xF0, 0x0F, 0xD3, 0xF4, 0x3F, 0xC0, 0x2F,
-    0xDF, 0xD0, 0xFF, 0x40, 0x3F, 0xBF, 0x43, 0xFD, 0x00, 0xBF, 0xFC, 0x0F, 0xF4, 0x00, 0xFF, 0xF0,
-    0x3F, 0xD0, 0x02, 0xFF, 0xC0, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF8,
-    0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x3F,
-    0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0xD0, 0x00,
-    0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xE3, 0xC0, 0x00, 0xB8, 0xF0,
-    0x00, 0x2E, 0x3C, 0x00, 0x0B, 0x8F, 0x00, 0x02, 0xE3, 0xC0, 0x00, 0xB8, 0xF0, 0x00, 0x2E, 0x3C,
-    0x00, 0x0B, 0x8F, 0x00, 0x02, 0xE3, 0xC0, 0x00, 0xB8, 0xF0, 0x00, 0x2E, 0x3C, 0x00, 0x0B, 0x8F,
-    0x00, 0x02, 0xE3, 0xC0, 0x00, 0xB8, 0xF0, 0x00, 0x2E, 0x3C, 0x00, 0x0B, 0x8F, 0x00, 0x02, 0xE0,
-    0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xF5, 0x56, 0xFD, 0x0B, 0xC0, 0x00, 0xFC, 0x2F,
-    0x00, 0x01, 0xF4, 0xBC, 0x00, 0x07, 0xD2, 0xF0, 0x00, 0x2F, 0x4F, 0xC0, 0x02, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x80, 0x00, 0x02, 0x80, 0x00, 0x0F, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0xAA, 0xAA, 0x3F,
-    0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xAF, 0xEA, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xE2, 0xF8, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xBF, 0x00, 0x03, 0xF0, 0x03, 0xF4,
-    0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0xFD, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0xBF, 0x00,
-    0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xEF, 0xFE, 0x00, 0x03, 0xFF, 0x43,
-    0xD0, 0xBF, 0xF0, 0x02, 0xFF, 0x00, 0xF4, 0x07, 0xFF, 0x01, 0xFF, 0x00, 0x3D, 0x00, 0x3F, 0xD0,
-    0xBF, 0x40, 0x0F, 0x40, 0x0B, 0xF8, 0x3F, 0xC0, 0x03, 0xC0, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0xF0,
-    0x00, 0x3F, 0xC3, 0xF8, 0x00, 0x3C, 0x00, 0x0B, 0xF0, 0xFE, 0x00, 0x0F, 0x00, 0x02, 0xFC, 0x3F,
-    0xC0, 0x03, 0xC0, 0x00, 0xFF, 0x0F, 0xF4, 0x00, 0xF0, 0x00, 0x7F, 0xC2, 0xFF, 0x80, 0x3C, 0x00,
-    0xBF, 0xE0, 0x3F, 0xFF, 0xAF, 0xAB, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x90,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x00,
-    0x7F, 0x00, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x00, 0x07, 0xFB, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00,
-    0x2F, 0xE3, 0xFC, 0x00, 0x00, 0x7F, 0xC2, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x02, 0xFF,
-    0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0B, 0x00, 0x3C, 0x3C, 0x00, 0xF0, 0x03, 0xC3,
-    0xC0, 0x0F, 0x00, 0x3C, 0x3C, 0x00, 0xF0, 0x03, 0xC2, 0xD0, 0x0F, 0x00, 0x7C, 0x2E, 0x00, 0xF0,
-    0x0B, 0xC1, 0xF0, 0x0F, 0x00, 0xF8, 0x0F, 0xC0, 0xF0, 0x2F, 0x40, 0xFE, 0x0F, 0x0B, 0xF0, 0x03,
-    0xFE, 0xFB, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x0F,
-    0xE0, 0x1B, 0xE0, 0x00, 0xBD, 0x00, 0x0B, 0xE0, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00,
-    0x0F, 0x80, 0xF8, 0x00, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x1F, 0x00, 0x00, 0x01, 0xF0,
-    0xBC, 0x00, 0x00, 0x07, 0xD2, 0xF0, 0x00, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0x00, 0xBC, 0x0F, 0x40,
-    0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x7D, 0x00, 0x01, 0xFC, 0x00, 0x7D, 0x00, 0x2F,
-    0xC0, 0x1A, 0xFE, 0x01, 0xFF, 0x90, 0xFF, 0xFC, 0x0B, 0xFF, 0xD3, 0xFF, 0xF0, 0x2F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF5, 0xC0, 0x00, 0x2F, 0xFF, 0xF4,
-    0x00, 0x2F, 0x96, 0xFD, 0x00, 0x0F, 0x40, 0x1F, 0x80, 0x0B, 0x80, 0x03, 0xE0, 0x03, 0xC0, 0x00,
-    0xFC, 0x00, 0xF0, 0x00, 0x2F, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x0F, 0x00, 0x03, 0xF0, 0x03, 0xE0,
-    0x07, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFD, 0xFF, 0xE0,
-    0x1B, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x03, 0xF5, 0x7F, 0x40, 0x2F, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x2D, 0x03, 0xD0, 0x00,
-    0x74, 0x0F, 0x40, 0x02, 0xD0, 0x3D, 0x00, 0x2F, 0x00, 0xF4, 0x3F, 0xE0, 0x03, 0xD0, 0xFF, 0xD0,
-    0x0F, 0x40, 0x07, 0xF0, 0x3D, 0x00, 0x03, 0xE0, 0xF4, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x2F, 0x0F,
-    0xE4, 0x00, 0xFC, 0x3F, 0xFD, 0x0B, 0xF0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFE, 0x0F, 0x47,
-    0xFF, 0xF0, 0x3D, 0x01, 0xBE, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x0F,
-    0x40, 0xF8, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0xF8, 0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xC0, 0x0F, 0x40,
-    0x0F, 0xC0, 0x7C, 0x00, 0x2F, 0x42, 0xF0, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0xBD, 0xBD, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00,
-    0x3F, 0xFF, 0xFD, 0x01, 0xF0, 0x01, 0xB4, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xBF,
-    0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x03, 0xFD, 0x07, 0xF0, 0x2F, 0xC0, 0x07, 0xE0, 0xFD, 0x00, 0x0F,
-    0xC3, 0xF0, 0x00, 0x2F, 0x0F, 0xD0, 0x00, 0xFC, 0x2F, 0xC0, 0x07, 0xF0, 0x3F, 0xD5, 0xBF, 0x80,
-    0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x2F, 0xE4, 0x00, 0x02, 0xFD, 0x00, 0x39, 0x1C,
-    0x02, 0x80, 0x24, 0x0A, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xF5, 0x00, 0x0F, 0x00,
-    0x00, 0x3C, 0x03, 0xC0, 0xF0, 0x0F, 0x42, 0xF5, 0xBC, 0x03, 0xFF, 0xE0, 0x02, 0xFD, 0x00, 0x02,
-    0xFF, 0xFF, 0x40, 0x6A, 0xFF, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xD0,
-    0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC1, 0xBA, 0x00, 0x03, 0xEF, 0xFF, 0xC0,
-    0x03, 0xFD, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0xF4, 0x03, 0xE0, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0x78,
-    0x03, 0xD0, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0xB8, 0x03, 0xE0, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0xBC,
-    0x07, 0xE0, 0x00, 0xBC, 0x07, 0xF0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x1E, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0x00, 0xF4, 0x00, 0xB4, 0x1F, 0x00, 0x03, 0xC2, 0xF0, 0x00,
-    0x3C, 0x2E, 0x00, 0x03, 0xD3, 0xE0, 0x00, 0x3D, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3F,
-    0x00, 0x03, 0xE3, 0xF0, 0x00, 0x7D, 0x2F, 0x40, 0x0B, 0xD2, 0xFC, 0x01, 0xFC, 0x1F, 0xFA, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x6F, 0xE0, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xBC,
-    0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xFD, 0x03, 0xF9, 0x0F, 0xFE, 0x3F, 0xE4, 0x19, 0x02, 0x80,
-    0x2D, 0x0B, 0xC0, 0x2D, 0x1F, 0x00, 0x2D, 0x3E, 0x00, 0x3D, 0x7C, 0x00, 0x3D, 0xF4, 0x00, 0x3F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x7E, 0xFC, 0x00, 0x7C, 0xFF,
-    0x00, 0xBC, 0x3F, 0xC0, 0xBC, 0x1F, 0xF0, 0xBC, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0x7F, 0x40, 0x01, 0xFC, 0x7E, 0x00, 0x0F,
-    0xC0, 0xF8, 0x00, 0x7E, 0x03, 0xF0, 0x03, 0xF0, 0x0B, 0xC0, 0x1F, 0x40, 0x0F, 0x40, 0xFC, 0x00,
-    0x3E, 0x07, 0xD0, 0x00, 0xBC, 0x3E, 0x00, 0x01, 0xF0, 0x2F, 0x40, 0x03, 0xE0, 0xBD, 0x00, 0x0F,
-    0x82, 0xF4, 0x00, 0x3E, 0x0F, 0xD0, 0x00, 0xFC, 0x3F, 0x80, 0x03, 0xF0, 0xFE, 0x00, 0x0F, 0xC3,
-    0xF8, 0x00, 0x3F, 0x0F, 0xF0, 0x00, 0xFC, 0x3F, 0xC0, 0x03, 0xF0, 0xFF, 0x40, 0x3F, 0xC3, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x3B, 0xFF, 0xFE, 0xF0, 0xE3, 0xFF, 0xDB, 0xC3, 0x80, 0x54,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x29, 0x00, 0x02, 0x90, 0x7C, 0x00, 0x0F,
-    0x40, 0xF4, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0xF8, 0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xC0, 0x0F, 0x80,
-    0x0F, 0x80, 0x7D, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0xFC, 0xBD, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFC, 0x02, 0xAB, 0xFE, 0x00, 0x02, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x74,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xFA, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0x0F,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x01, 0xBF, 0xC0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00,
-    0x06, 0xA0, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x2F, 0xFF, 0xE0, 0x0F, 0xE4, 0x6F, 0x41, 0xF0, 0x00,
-    0x7C, 0x3E, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x3E, 0x3D, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x2F, 0x3E,
-    0x00, 0x03, 0xE3, 0xF4, 0x00, 0xBD, 0x1F, 0xFE, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFD,
-    0x00, 0x07, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0x00, 0xF0, 0x00,
-    0xBC, 0x03, 0xC0, 0x02, 0xE0, 0x1F, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x3E, 0x02, 0xE0, 0x00, 0xF4,
-    0x0B, 0x80, 0x03, 0xD0, 0x3D, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0xF0, 0x0F,
-    0xF8, 0x07, 0xC0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB9, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x3F, 0x9B, 0xF0, 0x00, 0xBD, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x7C, 0x02, 0xF4, 0x00,
-    0x7C, 0x03, 0xF0, 0x00, 0x3C, 0x03, 0xF4, 0x00, 0x3C, 0x03, 0xF4, 0x00, 0x7C, 0x07, 0xFC, 0x00,
-    0xBC, 0x07, 0xFF, 0x96, 0xF8, 0x0B, 0xFF, 0xFF, 0xF0, 0x0F, 0xDF, 0xFF, 0xD0, 0x0F, 0xC7, 0xFF,
-    0x40, 0x0F, 0xC0, 0x10, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0xFE,
-    0xBF, 0x0B, 0x80, 0x2D, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xE4, 0x6F, 0x40, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x03, 0xD0,
-    0x00, 0x3E, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x03, 0xE0,
-    0x03, 0xF4, 0x00, 0xBD, 0x00, 0x1F, 0xFE, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x3C, 0x00,
-    0xB4, 0x3C, 0x00, 0x38, 0x3C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x2D, 0x00, 0x2D, 0x2D, 0x00, 0x2D,
-    0x2E, 0x00, 0x2E, 0x1F, 0x00, 0x2E, 0x1F, 0x80, 0x7D, 0x0F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFC, 0x07,
-    0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xBD,
-    0xBF, 0xD0, 0x07, 0xFC, 0x2C, 0x1F, 0xF0, 0x0F, 0xF0, 0x3C, 0x07, 0xF8, 0x1F, 0xC0, 0x3C, 0x02,
-    0xFC, 0x3F, 0x80, 0x3C, 0x00, 0xFD, 0x3F, 0x00, 0x3C, 0x00, 0xBE, 0x3F, 0x00, 0x3C, 0x00, 0x7E,
-    0x3F, 0x00, 0x3C, 0x00, 0x7F, 0x7E, 0x00, 0x3C, 0x00, 0x3F, 0x3F, 0x00, 0x3C, 0x00, 0x7E, 0x3F,
-    0x00, 0x3C, 0x00, 0x7E, 0x3F, 0x40, 0x3C, 0x00, 0xFE, 0x3F, 0xC0, 0x3C, 0x02, 0xFD, 0x2F, 0xF9,
-    0x3C, 0x5F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x0A, 0x01,
-    0xFF, 0x40, 0x03, 0xD0, 0x1F, 0xFD, 0x00, 0xBC, 0x00, 0x1F, 0xF4, 0x1F, 0x00, 0x00, 0x2F, 0xC3,
-    0xE0, 0x00, 0x00, 0xBD, 0xBC, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x2F, 0xEF, 0x80, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0xFE, 0x0B, 0xE0, 0x00, 0x2F,
-    0xC0, 0x3F, 0xE4, 0x07, 0xF8, 0x02, 0xFF, 0xE0, 0xFF, 0x00, 0x0F, 0xFE, 0x2F, 0xD0, 0x00, 0x2F,
-    0xE0, 0x00, 0x10, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0xF0, 0x74,
-    0x24, 0x3C, 0x1D, 0x0F, 0x0F, 0x03, 0x81, 0xE3, 0xC0, 0xE0, 0x3C, 0xB4, 0x38, 0x0F, 0x2D, 0x0E,
-    0x03, 0xCB, 0x43, 0x80, 0xF2, 0xE0, 0xF0, 0x3D, 0x7C, 0x3C, 0x0F, 0x5F, 0x8F, 0x0B, 0xD3, 0xFF,
-    0xFF, 0xF0, 0xBF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xF4, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x74, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x50, 0x00, 0x04, 0x00, 0x2E, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0x00,
-    0xB4, 0x1F, 0x00, 0x00, 0x07, 0x82, 0xF0, 0x05, 0x00, 0x7C, 0x3E, 0x00, 0xD0, 0x03, 0xC3, 0xE0,
-    0x0D, 0x00, 0x7C, 0x3E, 0x00, 0xE0, 0x0B, 0xC2, 0xF0, 0x0F, 0x01, 0xF8, 0x1F, 0x97, 0xFE, 0xFF,
-    0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFD, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0,
-    0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00,
-    0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01,
-    0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00,
-    0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFD, 0x70, 0x02, 0xFF, 0xFF, 0x40, 0xBE, 0x5B, 0xF4, 0x0F, 0x40, 0x1F,
-    0x82, 0xE0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xBC, 0x3C, 0x00, 0x0F, 0xC3, 0xC0,
-    0x00, 0xFC, 0x3E, 0x00, 0x7F, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x7D,
-    0x01, 0xBF, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x42, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0,
-    0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00,
-    0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x2F, 0x80, 0x00,
-    0x01, 0x0E, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD7, 0x00, 0x2F, 0xFF, 0xF4, 0x0B,
-    0xE5, 0xBF, 0x40, 0xF4, 0x01, 0xF8, 0x2E, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0B,
-    0xC3, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0F, 0xC3, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF,
-    0xFF, 0xFD, 0x0B, 0xFF, 0xF7, 0xD0, 0x1B, 0xF8, 0x3E, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0x82, 0xD0, 0x00, 0x00, 0x1D, 0x00, 0x74, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2,
-    0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC,
-    0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40,
-    0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0,
-    0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xD0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xEF, 0x00, 0x00, 0x2D, 0x0B,
-    0x40, 0x02, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x5C, 0x00, 0x2F, 0xFF, 0xF4,
-    0x02, 0xF9, 0x6F, 0xD0, 0x0F, 0x40, 0x1F, 0x80, 0xB8, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0xFC, 0x0F,
-    0x00, 0x02, 0xF0, 0x3C, 0x00, 0x0F, 0xC0, 0xF0, 0x00, 0x3F, 0x03, 0xE0, 0x07, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xDF, 0x40, 0x1B, 0xF8, 0x3E, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x60, 0x00, 0x00, 0x01, 0xA0,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x74,
-    0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x00, 0x07, 0xD3,
-    0xE0, 0x00, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xE5, 0x55, 0x57,
-    0xF4, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x00, 0x07,
-    0xF4, 0x14, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3E, 0xF4, 0x00, 0x00,
-    0x3C, 0x0B, 0x40, 0x00, 0x28, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF5, 0xC0,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x2F, 0x96, 0xFD, 0x00, 0x0F, 0x40, 0x1F, 0x80, 0x0B, 0x80, 0x03,
-    0xE0, 0x03, 0xC0, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0x2F, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x0F, 0x00,
-    0x03, 0xF0, 0x03, 0xE0, 0x07, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFD, 0xF4, 0x00, 0x1B, 0xF8, 0x3E, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x42, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xC3, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0,
-    0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00,
-    0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00,
-    0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55,
-    0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x04, 0x0D, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xB0, 0x00,
-    0x01, 0x04, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xC0, 0x2C,
-    0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x70, 0x02, 0xFF, 0xFF, 0x40, 0xBE,
-    0x5B, 0xF4, 0x0F, 0x40, 0x1F, 0x82, 0xE0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xBC,
-    0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x7F, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xD0, 0xBF, 0xFF, 0x7D, 0x01, 0xBF, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x34, 0x00, 0x00, 0x0F, 0x38, 0x34, 0x00, 0x00, 0x0D, 0x0E, 0xB0, 0x00, 0x00, 0x0D, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xC2, 0xE0, 0x00,
-    0x00, 0x0E, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2,
-    0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC,
-    0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40,
-    0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0,
-    0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xC0, 0x03,
-    0x8D, 0x0C, 0x00, 0x70, 0x7B, 0xC0, 0x07, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xBD, 0x00, 0x02, 0xD0, 0x78, 0x00, 0x60,
-    0x00, 0x90, 0x00, 0x6F, 0xD7, 0x00, 0x2F, 0xFF, 0xF4, 0x0B, 0xE5, 0xBF, 0x40, 0xF4, 0x01, 0xF8,
-    0x2E, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0xFC, 0x3C, 0x00,
-    0x0F, 0xC3, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF7, 0xD0,
-    0x1B, 0xF8, 0x3E, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F,
-    0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00,
-    0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F,
-    0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F,
-    0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xBD, 0x00, 0x03, 0xC0, 0xB4, 0x00, 0xA0, 0x01,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x70, 0x02, 0xFF, 0xFF, 0x40, 0xBE, 0x5B, 0xF4, 0x0F,
-    0x40, 0x1F, 0x82, 0xE0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xBC, 0x3C, 0x00, 0x0F,
-    0xC3, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x7F, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0xBF,
-    0xFF, 0x7D, 0x01, 0xBF, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x40, 0x2C, 0x00,
-    0x00, 0x1C, 0x00, 0x2C, 0x00, 0x00, 0x0E, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00,
-    0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00,
-    0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8,
-    0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02,
-    0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x0F, 0x00, 0x0E, 0x00, 0x7D, 0x5B, 0xC0,
-    0x02, 0xFF, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFD, 0x70, 0x02, 0xFF, 0xFF, 0x40, 0xBE, 0x5B, 0xF4, 0x0F, 0x40, 0x1F, 0x82,
-    0xE0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xBC, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00,
-    0xFC, 0x3E, 0x00, 0x7F, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x7D, 0x01,
-    0xBF, 0x83, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x2B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x40, 0x2C, 0x00, 0x00, 0x1C, 0x00, 0x2C, 0x00,
-    0x00, 0x0E, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0,
-    0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00,
-    0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00,
-    0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55,
-    0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E,
-    0x00, 0xF0, 0x00, 0xE0, 0x07, 0xD5, 0xBC, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD7, 0x00, 0x2F, 0xFF, 0xF4,
-    0x0B, 0xE5, 0xBF, 0x40, 0xF4, 0x01, 0xF8, 0x2E, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0xFC, 0x3C, 0x00,
-    0x0B, 0xC3, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0F, 0xC3, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1,
-    0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF7, 0xD0, 0x1B, 0xF8, 0x3E, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x42, 0xC0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x2C, 0x00, 0x00, 0x1C, 0x00, 0x3C,
-    0x00, 0x00, 0x0E, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7,
-    0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4,
-    0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00,
-    0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5,
-    0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00,
-    0x01, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0x1E, 0x5B, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0xF0, 0x00, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x70, 0x02, 0xFF, 0xFF, 0x40, 0xBE, 0x5B, 0xF4, 0x0F,
-    0x40, 0x1F, 0x82, 0xE0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xBC, 0x3C, 0x00, 0x0F,
-    0xC3, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x7F, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0xBF,
-    0xFF, 0x7D, 0x01, 0xBF, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x34, 0x00,
-    0x00, 0x0E, 0x38, 0x34, 0x00, 0x00, 0x0D, 0x0E, 0xB0, 0x00, 0x00, 0x0D, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x2C, 0x00, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B,
-    0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F,
-    0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F,
-    0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xC0,
-    0x03, 0x4E, 0x1C, 0x00, 0x70, 0x3F, 0x80, 0x07, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0xF0, 0x00, 0xE0, 0x07, 0xD5, 0xBC, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xD7, 0x00, 0x2F, 0xFF, 0xF4, 0x0B, 0xE5, 0xBF, 0x40, 0xF4, 0x01, 0xF8, 0x2E,
-    0x00, 0x0F, 0x83, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0F,
-    0xC3, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF7, 0xD0, 0x1B,
-    0xF8, 0x3E, 0x00, 0x2D, 0x40, 0x2C, 0x00, 0x00, 0x1C, 0x00, 0x2C, 0x00, 0x00, 0x0E, 0x00, 0xB4,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3,
-    0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0,
-    0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0xF0, 0x00, 0xE0, 0x07, 0xD5, 0xBC, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xD7, 0x00, 0x2F, 0xFF, 0xF4, 0x0B, 0xE5, 0xBF, 0x40, 0xF4, 0x01, 0xF8, 0x2E,
-    0x00, 0x0F, 0x83, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0F,
-    0xC3, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF7, 0xD0, 0x1B,
-    0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xEA, 0xA0, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x55, 0x55, 0x03, 0xFF,
-    0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xD0, 0x0B, 0x00, 0xF4,
-    0x00, 0x3C, 0x1E, 0x00, 0x03, 0xC2, 0xFA, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE3, 0xD5, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x95, 0x6C, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x2B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xEA, 0xA0, 0x2F, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD,
-    0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xD0, 0x0B, 0x00,
-    0xF4, 0x00, 0x3C, 0x1E, 0x00, 0x03, 0xC2, 0xFA, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE3, 0xD5, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x95, 0x6C, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x2B, 0xFD, 0x00, 0x00, 0x7D, 0x03, 0x00, 0x03, 0xAC,
-    0x0C, 0x00, 0x1C, 0x2C, 0xB0, 0x00, 0x70, 0x3F, 0x80, 0x00, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x82,
-    0xFF, 0xFA, 0xA8, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x55, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xB8, 0x0A, 0x00, 0x1D, 0xE0, 0xA0, 0x02, 0x83,
-    0x8E, 0x00, 0x38, 0x1F, 0xC0, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x7D, 0x00,
-    0xB0, 0x0F, 0x40, 0x03, 0xC1, 0xE0, 0x00, 0x3C, 0x2F, 0xAF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3D,
-    0x50, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF9, 0x56,
-    0xC0, 0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x02, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x01, 0xE0, 0x1D, 0x00, 0x02,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xAA, 0x80, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x55, 0x55, 0x40, 0x3F,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x06, 0x00, 0x1D, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x3F, 0xD0, 0x7C, 0x00,
-    0xF0, 0xB4, 0xF4, 0x03, 0x80, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x07,
-    0xD0, 0x0B, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x1E, 0x00, 0x03, 0xC0, 0x2F, 0xAF, 0xFF, 0xE0, 0x3F,
-    0xFF, 0xFF, 0xE0, 0x3D, 0x50, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
-    0x2B, 0xFD, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x40, 0x00, 0x01, 0xF8, 0x02,
-    0xF0, 0x00, 0x00, 0x5A, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1E, 0x2E, 0x00, 0x00, 0x00, 0x74, 0x07,
-    0x80, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xEA, 0xA0, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xD5, 0x55, 0x50, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x60, 0x00, 0x00, 0x1A, 0x3E, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x00, 0x38, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0xF4, 0x02, 0xC0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x78, 0x00,
-    0x0F, 0x00, 0x2F, 0xAF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF8, 0x03, 0xD5, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x95, 0x6C, 0x00,
-    0x2F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0A, 0xFF, 0x40, 0x00, 0x00, 0x06, 0xE4,
-    0x00, 0x00, 0x04, 0x1C, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x01, 0x00, 0x40,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x78, 0xB8, 0x00, 0x01, 0xD0, 0x1E, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xAA, 0x80, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x55, 0x55, 0x40,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xDF, 0x40, 0x00, 0xE0, 0x1D, 0x00,
-    0x24, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xD0, 0x0B, 0x00, 0xF4, 0x00, 0x3C, 0x1E,
-    0x00, 0x03, 0xC2, 0xFA, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE3, 0xD5, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x95, 0x6C, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xFC, 0x00, 0x2B, 0xFD, 0x00, 0x00, 0x7D, 0x03, 0x00, 0x03, 0xAC, 0x0C, 0x00, 0x1C, 0x2C,
-    0xB0, 0x00, 0x70, 0x3F, 0x80, 0x00, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x0E, 0x00, 0xB0, 0x00,
-    0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF,
-    0xEA, 0xA0, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFD, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xB8, 0x0A, 0x00, 0x1D, 0xE0, 0xA0, 0x02, 0xC3, 0x8E,
-    0x00, 0x38, 0x1F, 0xD0, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0x8B, 0x80, 0x02, 0xC0, 0x0E, 0x00, 0x10, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xD0,
-    0x0B, 0x00, 0xF4, 0x00, 0x3C, 0x1E, 0x00, 0x03, 0xC2, 0xFA, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE3,
-    0xD5, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x95,
-    0x6C, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x2B, 0xFD, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1E, 0x2E, 0x00, 0x01, 0xD0, 0x1E, 0x00, 0x04,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xFF, 0x82, 0xFF, 0xFA, 0xA8, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x55, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0x4B, 0x80, 0x03, 0x80,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x7D, 0x00, 0xB0, 0x0F, 0x40, 0x03, 0xC1, 0xE0, 0x00,
-    0x3C, 0x2F, 0xAF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3D, 0x50, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xC0, 0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xC0, 0x02, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7E, 0x44, 0x2C,
-    0x03, 0x80, 0xE0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x3F,
-    0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x43,
-    0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x83, 0xF8, 0x7F, 0x87, 0xFC, 0x7F, 0xC7, 0xFC, 0x2F, 0x84, 0x0D,
-    0x02, 0xC0, 0x70, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1E, 0x01, 0xE0, 0x1E,
-    0x01, 0xE0, 0x1E, 0x01, 0xE0, 0x2E, 0x02, 0xF0, 0x2F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x40,
-    0x00, 0x1F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F,
-    0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x8F, 0xE7, 0xF9, 0xFF, 0x7F, 0xDF, 0xF0, 0x00, 0x00, 0x3F, 0x0F,
-    0xC7, 0xF2, 0xFD, 0x00, 0x00, 0x2F, 0x0F, 0xD3, 0xF5, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0xB8, 0x2F, 0x0B, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F,
-    0xD0, 0x00, 0x00, 0x3E, 0x1F, 0xCB, 0xF3, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0,
-    0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00,
-    0x00, 0xBE, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00,
-    0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE,
-    0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x2F,
-    0xFF, 0xE0, 0x0F, 0xE4, 0x6F, 0x41, 0xF0, 0x00, 0x7C, 0x3E, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x3E,
-    0x3D, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x2F, 0x3E, 0x00, 0x03, 0xE3, 0xF4, 0x00, 0xBD, 0x1F, 0xFE,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x41,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07,
-    0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80,
-    0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00,
-    0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00,
-    0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x90, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0xFE, 0x46, 0xF4, 0x1F,
-    0x00, 0x07, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x2F, 0x3D, 0x00, 0x02,
-    0xF3, 0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF, 0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x8F, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0xBF,
-    0xE5, 0x7F, 0xF4, 0x03, 0xC0, 0x7F, 0xC0, 0x01, 0xFF, 0x01, 0xE0, 0x3F, 0xC0, 0x00, 0x1F, 0xE0,
-    0xF0, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x7C, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x01,
-    0xFF, 0xE5, 0x56, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x03, 0xC0, 0x03, 0xC0, 0x02, 0xFC, 0x01, 0xE0, 0x02, 0xE7, 0xC0, 0xF4, 0x02, 0xC0, 0x3C,
-    0x7C, 0x01, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x0F,
-    0xE4, 0x6F, 0x40, 0x07, 0xC0, 0x01, 0xF0, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x0F, 0x80,
-    0x3D, 0x00, 0x02, 0xF0, 0x0F, 0x40, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x2F,
-    0x40, 0x1F, 0xFE, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x40, 0x00, 0x00, 0x7E, 0x00, 0xF4,
-    0x00, 0x00, 0x06, 0xA0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xF0, 0x00, 0x00, 0x00, 0xB0, 0x0B,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFE, 0x57, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x1F,
-    0xF0, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x00, 0x03,
-    0xF4, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x07,
-    0xF1, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x00, 0x1F,
-    0x83, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x0B, 0xF4, 0x1F, 0xFE, 0x55, 0x6F, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xB0,
-    0x00, 0x00, 0x05, 0x7E, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0x74,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xD0,
-    0x01, 0xF0, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x03, 0xE0, 0x0F, 0x40, 0x00,
-    0xBC, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x3F, 0x40, 0x0B, 0xD0, 0x07, 0xFF,
-    0xBF, 0xF0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x10, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x00, 0x0B, 0x00, 0xB4, 0x00, 0x00, 0x04, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x1F,
-    0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x00,
-    0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0xD0, 0x00, 0x02,
-    0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x00, 0xD0, 0x00,
-    0x00, 0x34, 0x00, 0x01, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xDB, 0x40,
-    0x01, 0xE0, 0x1D, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x2F, 0xFF, 0xE0, 0x0F, 0xE4, 0x6F, 0x41,
-    0xF0, 0x00, 0x7C, 0x3E, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x3E, 0x3D, 0x00, 0x02, 0xF3, 0xD0, 0x00,
-    0x2F, 0x3E, 0x00, 0x03, 0xE3, 0xF4, 0x00, 0xBD, 0x1F, 0xFE, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x02,
-    0xFF, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xE0, 0x2C, 0x00, 0x00, 0x07, 0x78, 0x28, 0x00,
-    0x00, 0x0B, 0x0E, 0x38, 0x00, 0x00, 0x0E, 0x07, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x01, 0xE2, 0xE0, 0x00, 0x00, 0x07, 0x40, 0x78, 0x00, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF,
-    0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC,
-    0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F,
-    0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00,
-    0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55,
-    0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xA0, 0x02, 0xCB, 0x0A, 0x00, 0x38, 0x3E, 0xD0, 0x03, 0x80,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xEF, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x38, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0xFE, 0x46, 0xF4, 0x1F,
-    0x00, 0x07, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x2F, 0x3D, 0x00, 0x02,
-    0xF3, 0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF, 0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xE3, 0xC0, 0x00, 0x00, 0x0B, 0x00, 0xB0, 0x00, 0x00,
-    0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00,
-    0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00,
-    0xBE, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F,
-    0xD0, 0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1E, 0x07, 0x80, 0x07, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0xFE, 0x46, 0xF4, 0x1F, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE3, 0xD0,
-    0x00, 0x2F, 0x3D, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF, 0xEF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x06,
-    0xFF, 0xE4, 0x01, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x2C, 0x02, 0xFF, 0x95, 0xFF, 0xD3, 0x80, 0x7F,
-    0xC0, 0x01, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x3F,
-    0x80, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x03,
-    0xF0, 0x00, 0x00, 0x07, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0,
-    0x3F, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xD0, 0x00, 0x02, 0xFD,
-    0x01, 0xFF, 0xE5, 0x56, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x00, 0x6F, 0xE4, 0x0D, 0x02, 0xFF, 0xFE, 0x0C, 0x0F, 0xE4, 0x6F, 0xAC, 0x1F,
-    0x00, 0x07, 0xF0, 0x3E, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x02, 0xF0, 0x3D,
-    0x00, 0x02, 0xF0, 0x3E, 0x00, 0x03, 0xE0, 0x3F, 0x40, 0x0B, 0xD0, 0x1F, 0xFE, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x06, 0xFF, 0xE4, 0x01, 0xC0, 0x07, 0xFF, 0xFF,
-    0xF0, 0x2C, 0x02, 0xFF, 0x95, 0xFF, 0xD3, 0x80, 0x7F, 0xC0, 0x01, 0xFF, 0xF0, 0x0F, 0xF0, 0x00,
-    0x07, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00,
-    0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x7E, 0x00,
-    0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xE5, 0x56, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x06, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x6F, 0xE4, 0x0D, 0x02, 0xFF, 0xFE, 0x0C, 0x0F, 0xE4, 0x6F, 0xAC,
-    0x1F, 0x00, 0x07, 0xF0, 0x3E, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x02, 0xF0,
-    0x3D, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x03, 0xE0, 0x3F, 0x40, 0x0B, 0xD0, 0x1F, 0xFE, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x6F,
-    0xFE, 0x40, 0x1C, 0x00, 0x7F, 0xFF, 0xFF, 0x02, 0xC0, 0x2F, 0xF9, 0x5F, 0xFD, 0x38, 0x07, 0xFC,
-    0x00, 0x1F, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x03, 0xF8,
-    0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x3F,
-    0x00, 0x00, 0x00, 0x7F, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x03,
-    0xF0, 0x00, 0x00, 0x07, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xD0,
-    0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x6F, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x10, 0xB0, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x6F, 0xE4, 0x0D, 0x02, 0xFF, 0xFE, 0x0C, 0x0F, 0xE4, 0x6F, 0xAC, 0x1F,
-    0x00, 0x07, 0xF0, 0x3E, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x02, 0xF0, 0x3D,
-    0x00, 0x02, 0xF0, 0x3E, 0x00, 0x03, 0xE0, 0x3F, 0x40, 0x0B, 0xD0, 0x1F, 0xFE, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xE0, 0x1C, 0x00,
-    0x00, 0x00, 0x7A, 0xC1, 0xC0, 0x00, 0x00, 0x0B, 0x0E, 0x28, 0x00, 0x00, 0x00, 0xB0, 0x3F, 0x40,
-    0x00, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x06, 0xFF, 0xE4, 0x01, 0xC0, 0x07, 0xFF, 0xFF,
-    0xF0, 0x2C, 0x02, 0xFF, 0x95, 0xFF, 0xD3, 0x80, 0x7F, 0xC0, 0x01, 0xFF, 0xF0, 0x0F, 0xF0, 0x00,
-    0x07, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00,
-    0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x7E, 0x00,
-    0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xE5, 0x56, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0A, 0x00, 0x02, 0xCB, 0x0E, 0x00, 0x03, 0x83, 0xED, 0x00,
-    0x03, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x6F, 0xE4, 0x0D, 0x02, 0xFF, 0xFE, 0x0C,
-    0x0F, 0xE4, 0x6F, 0xAC, 0x1F, 0x00, 0x07, 0xF0, 0x3E, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x03, 0xE0,
-    0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x03, 0xE0, 0x3F, 0x40, 0x0B, 0xD0,
-    0x1F, 0xFE, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x06, 0xFF, 0xE4, 0x01,
-    0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x2C, 0x02, 0xFF, 0x95, 0xFF, 0xD3, 0x80, 0x7F, 0xC0, 0x01, 0xFF,
-    0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x00,
-    0xFD, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00,
-    0x07, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00,
-    0x00, 0x7E, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xE5,
-    0x56, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
-    0x6F, 0xE4, 0x0D, 0x02, 0xFF, 0xFE, 0x0C, 0x0F, 0xE4, 0x6F, 0xAC, 0x1F, 0x00, 0x07, 0xF0, 0x3E,
-    0x00, 0x03, 0xD0, 0x3D, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3E,
-    0x00, 0x03, 0xE0, 0x3F, 0x40, 0x0B, 0xD0, 0x1F, 0xFE, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x40, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x15, 0x00, 0x00, 0x05, 0x43, 0xFC, 0x00, 0x02, 0xFE,
-    0x3F, 0x80, 0x00, 0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00,
-    0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xC3,
-    0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00,
-    0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x02, 0xFC, 0x2F,
-    0xE0, 0x00, 0x7F, 0xC1, 0xFF, 0xEA, 0xBF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00,
-    0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3E,
-    0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF4, 0x03, 0xFC, 0x1F, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFB, 0xC0, 0x3F, 0xFD, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x10, 0xB0, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x54, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8,
-    0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F,
-    0xD3, 0xF8, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40,
-    0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x01, 0xFC,
-    0x2F, 0xC0, 0x00, 0x2F, 0xC2, 0xFE, 0x00, 0x07, 0xFC, 0x1F, 0xFE, 0xAB, 0xFF, 0x81, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x40, 0x00, 0x04, 0x1D, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xF8, 0x3D, 0x00,
-    0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2,
-    0xF0, 0x00, 0xFC, 0x2F, 0x40, 0x3F, 0xC1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xBC, 0x03, 0xFF, 0xDB, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x7F, 0xC0, 0x00, 0x2F, 0xFD, 0x3F,
-    0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0x80, 0x00, 0x2F, 0xD0, 0x3F, 0x80, 0x00, 0x2F, 0xD0, 0x3F, 0x80,
-    0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00,
-    0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F,
-    0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xC0,
-    0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x2F, 0xE0, 0x00, 0x7F, 0xC0, 0x1F, 0xFE, 0xAB, 0xFF, 0x80, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3D, 0x00, 0x0F, 0x8C,
-    0x3D, 0x00, 0x0F, 0xAC, 0x3D, 0x00, 0x0F, 0xF4, 0x3D, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x0F, 0xC0,
-    0x3E, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0xC0,
-    0x2F, 0x40, 0x3F, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFB, 0xC0,
-    0x03, 0xFF, 0xDB, 0xC0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E,
-    0x7F, 0xC0, 0x00, 0x2F, 0xFD, 0x3F, 0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0x80, 0x00, 0x2F, 0xD0, 0x3F,
-    0x80, 0x00, 0x2F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80,
-    0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00,
-    0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F,
-    0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x2F, 0xE0, 0x00, 0x7F, 0xC0,
-    0x1F, 0xFE, 0xAB, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x06,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x3D, 0x00,
-    0x0F, 0x8C, 0x3D, 0x00, 0x0F, 0xAC, 0x3D, 0x00, 0x0F, 0xF4, 0x3D, 0x00, 0x0F, 0xC0, 0x3E, 0x00,
-    0x0F, 0xC0, 0x3E, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x2F, 0x00,
-    0x0F, 0xC0, 0x2F, 0x40, 0x3F, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFB, 0xC0, 0x03, 0xFF, 0xDB, 0xC0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x7F, 0xC0, 0x00, 0x2F,
-    0xFD, 0x3F, 0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0x80, 0x00, 0x2F, 0xD0, 0x3F, 0x80, 0x00, 0x2F, 0xD0,
-    0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F,
-    0x80, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40,
-    0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00,
-    0x1F, 0xC0, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x2F, 0xE0, 0x00, 0x7F, 0xC0, 0x1F, 0xFE, 0xAB, 0xFF,
-    0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x40, 0x00, 0x00, 0x41,
-    0xD0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x3D, 0x00,
-    0x0F, 0x8C, 0x3D, 0x00, 0x0F, 0xAC, 0x3D, 0x00, 0x0F, 0xF4, 0x3D, 0x00, 0x0F, 0xC0, 0x3E, 0x00,
-    0x0F, 0xC0, 0x3E, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x2F, 0x00,
-    0x0F, 0xC0, 0x2F, 0x40, 0x3F, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFB, 0xC0, 0x03, 0xFF, 0xDB, 0xC0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0xD0, 0x00, 0x00, 0x38, 0xB0, 0xD0, 0x00, 0x00, 0x34, 0x3F, 0xC0, 0x00, 0x00, 0x24,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x7F, 0xC0, 0x00, 0x2F, 0xFD, 0x3F, 0xC0, 0x00, 0x2F,
-    0xF8, 0x3F, 0x80, 0x00, 0x2F, 0xD0, 0x3F, 0x80, 0x00, 0x2F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0,
-    0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x3F,
-    0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40,
-    0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x2F, 0xE0, 0x00, 0x7F, 0xC0, 0x1F, 0xFE, 0xAB, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1C, 0x00, 0x07, 0x1E, 0x2C,
-    0x00, 0x0B, 0x07, 0xF4, 0x00, 0x06, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x0C, 0x3D, 0x00, 0x0F, 0x8C, 0x3D, 0x00, 0x0F, 0xAC, 0x3D, 0x00, 0x0F,
-    0xF4, 0x3D, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x0F,
-    0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x2F, 0x40, 0x3F, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFB, 0xC0, 0x03, 0xFF, 0xDB, 0xC0, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x7F, 0xC0, 0x00, 0x2F, 0xFD, 0x3F, 0xC0, 0x00, 0x2F, 0xF8, 0x3F,
-    0x80, 0x00, 0x2F, 0xD0, 0x3F, 0x80, 0x00, 0x2F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80,
-    0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00,
-    0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F,
-    0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x00, 0x2F, 0xC0,
-    0x2F, 0xE0, 0x00, 0x7F, 0xC0, 0x1F, 0xFE, 0xAB, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x3D, 0x00, 0x0F, 0x8C, 0x3D, 0x00, 0x0F,
-    0xAC, 0x3D, 0x00, 0x0F, 0xF4, 0x3D, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x0F,
-    0xC0, 0x3E, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x2F, 0x40, 0x3F,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFB, 0xC0, 0x03, 0xFF, 0xDB,
-    0xC0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xBF,
-    0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0xFD, 0x03, 0xF8,
-    0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0xF8, 0x07, 0xD0, 0x07,
-    0xD0, 0x0F, 0xC0, 0x2F, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x7E, 0x2F, 0x40,
-    0x00, 0xFD, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFF,
-    0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xBF,
-    0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0xFD, 0x03, 0xF8,
-    0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x3D, 0x00, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x7D,
-    0x00, 0x7D, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0xFC, 0x1F, 0x80,
-    0x00, 0x07, 0xE2, 0xF4, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xFC,
-    0x00, 0xF8, 0x1F, 0xFF, 0x00, 0x1F, 0xC1, 0xFF, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x10, 0xB0, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xBF,
-    0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0xFD, 0x03, 0xF8,
-    0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x40, 0xD0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x1F, 0x00, 0x02,
-    0xF0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x7D, 0x00, 0xFC, 0x02, 0xF0, 0x01, 0xF4, 0x0F, 0xC0,
-    0x03, 0xF0, 0x7E, 0x00, 0x07, 0xE2, 0xF4, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xFC, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xE0, 0x00, 0x02, 0xDE, 0x0D,
-    0x00, 0x00, 0x38, 0x74, 0xD0, 0x00, 0x03, 0x42, 0xFC, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x02, 0xF8, 0x0B, 0xF0,
-    0x00, 0x3F, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x3F, 0x80,
-    0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xBC, 0x07, 0x00, 0x03, 0xAC, 0x1C, 0x00, 0x1C, 0x38, 0xB0, 0x00, 0xB0, 0x3F, 0x80, 0x01, 0x40,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0xBC, 0x0F, 0x80, 0x03, 0xE0,
-    0x1F, 0x40, 0x1F, 0x40, 0x3F, 0x00, 0xBC, 0x00, 0x7D, 0x03, 0xF0, 0x00, 0xFC, 0x1F, 0x80, 0x01,
-    0xF8, 0xBD, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x2A, 0xAA,
-    0xAA, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x2A, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x05, 0x55, 0x55, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x50, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x55, 0x55, 0x55, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00,
-    0xE1, 0xD0, 0x03, 0x87, 0x40, 0x0E, 0x1D, 0x00, 0x74, 0xB0, 0x01, 0xD2, 0xC0, 0x07, 0x4B, 0x00,
-    0x1D, 0x2C, 0x00, 0x74, 0xB0, 0x01, 0xD2, 0xC0, 0x07, 0x4B, 0x00, 0x1D, 0x2C, 0x00, 0x74, 0xF0,
-    0x02, 0xC3, 0xC0, 0x0B, 0x0F, 0x00, 0x2C, 0x3C, 0x00, 0xB0, 0xF0, 0x02, 0xC3, 0xC0, 0x0B, 0x0F,
-    0x00, 0x2C, 0x3C, 0x00, 0xB0, 0xE0, 0x03, 0xC0, 0x2A, 0xAA, 0xAA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xAA, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0x87,
-    0xF8, 0x3F, 0xC3, 0xFC, 0x2F, 0xC0, 0xFD, 0x0F, 0xF0, 0x1F, 0xF1, 0xFE, 0x2F, 0xD2, 0xFC, 0x3F,
-    0x83, 0xF4, 0xBF, 0x00, 0x05, 0x51, 0xFE, 0x2F, 0xD2, 0xFC, 0x2F, 0xC3, 0xF8, 0x7F, 0x4B, 0xF0,
-    0xBF, 0x87, 0xF8, 0x3F, 0xC3, 0xFC, 0x2F, 0xC0, 0xFD, 0x0F, 0xF0, 0xBF, 0x8F, 0xF4, 0x7F, 0x87,
-    0xF8, 0x3F, 0xC3, 0xF8, 0x3F, 0xC3, 0xF8, 0x2F, 0xC2, 0xFC, 0x0F, 0xD1, 0xFD, 0x0F, 0xF0, 0xFE,
-    0x1F, 0xF1, 0xFF, 0x1F, 0xE2, 0xFD, 0x2F, 0xD2, 0xFC, 0x2F, 0xC2, 0xFC, 0x3F, 0x83, 0xF8, 0x3F,
-    0x47, 0xF4, 0xBF, 0x0B, 0xF0, 0x05, 0x51, 0xFE, 0x2F, 0xD2, 0xFC, 0x2F, 0xC3, 0xF8, 0x7F, 0x4B,
-    0xF0, 0x7F, 0xCB, 0xF8, 0x0F, 0xF0, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xBF, 0x0B, 0xF0, 0x1F, 0xD1,
-    0xFC, 0x03, 0xF8, 0x3F, 0x80, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x3C, 0x00, 0x0B, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF,
-    0xC2, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xA0, 0x03, 0xF4, 0x0F, 0xFD, 0x3F, 0xF4, 0xFE, 0x03, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF1, 0xFC, 0xBF, 0x40, 0x00, 0x0F, 0xC3, 0xF1, 0xFC, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x3F, 0x00, 0x1F, 0xC0, 0x0F,
-    0xC7, 0xF0, 0x02, 0xFC, 0x01, 0xFC, 0xBF, 0x40, 0x3F, 0xC0, 0x2F, 0xD0, 0x29, 0x3E, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x15, 0x00, 0x00, 0xF0, 0x20, 0x80, 0x01, 0xD0, 0x24,
-    0x80, 0x03, 0x80, 0x65, 0x80, 0x0B, 0x00, 0x30, 0xC0, 0x0E, 0x00, 0x3B, 0xC0, 0x3C, 0x00, 0x1F,
-    0x40, 0x74, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0xF0, 0x44, 0x88, 0x03, 0xE2, 0x58, 0xA4, 0x07, 0xC2, 0x0D, 0x48, 0x0F, 0x41, 0x98, 0xDC, 0x2F,
-    0x00, 0xF0, 0xB8, 0x14, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0xFE, 0x2F, 0xD2, 0xFC, 0x3F, 0x83, 0xF4,
-    0xBF, 0x00, 0x1F, 0xF1, 0xFF, 0x1F, 0xE2, 0xFD, 0x2F, 0xD2, 0xFC, 0x2F, 0xC2, 0xFC, 0x3F, 0x83,
-    0xF8, 0x3F, 0x47, 0xF4, 0xBF, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x38, 0x02,
-    0x80, 0x3E, 0x02, 0xF4, 0x1F, 0x42, 0xF0, 0x0F, 0x80, 0xF8, 0x1F, 0x00, 0xB8, 0x0B, 0xC0, 0xF4,
-    0x07, 0xC0, 0x3C, 0x07, 0x80, 0x28, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0,
-    0x7E, 0x02, 0xF0, 0x0F, 0x80, 0x3D, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x1C, 0x07, 0x40, 0x3E, 0x0F,
-    0xC0, 0x1F, 0x43, 0xD0, 0x0B, 0xC1, 0xF0, 0x03, 0xD0, 0xB8, 0x00, 0xB0, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x70, 0x07, 0x00, 0x28, 0x07, 0xE0, 0x3F, 0x02, 0xF4, 0x0B, 0xC0, 0x7D, 0x03, 0xF0,
-    0x0F, 0x80, 0xBC, 0x03, 0xD0, 0x0F, 0x00, 0xF4, 0x07, 0xC0, 0x0E, 0x00, 0xB0, 0x07, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x02, 0xF8, 0x00, 0x2D, 0x78, 0x03, 0xE0, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x7D, 0x01, 0xF4, 0x0B, 0xC0, 0x2F, 0x00, 0x3F, 0x40, 0x0F,
-    0xD0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0x08, 0x10, 0x00, 0x34, 0x00, 0x3E, 0x00, 0x0F,
-    0x80, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xFD, 0x03, 0xF8, 0x0F, 0xE0, 0x2F, 0x40, 0x1D, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0xFC, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x1F, 0xC0, 0x3F, 0xC0, 0x00, 0xBF, 0x42, 0xFD, 0x0B,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x3F, 0xC0, 0x2F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0xFF,
-    0x00, 0x00, 0x1F, 0x40, 0x3F, 0xFF, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0xFF, 0xF4, 0x02, 0xF4, 0x3F,
-    0x80, 0x07, 0xFF, 0x00, 0x3F, 0x43, 0xFC, 0x00, 0xFF, 0xF4, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xD0, 0x3F, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00,
-    0x0F, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0xBF, 0xF4, 0x2F, 0x00, 0xFF, 0xE0,
-    0x1F, 0xFE, 0x03, 0xF0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x3C, 0x07, 0xC0, 0x7C,
-    0x07, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F,
-    0xC0, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x40, 0x00, 0x3F, 0x83, 0xF8, 0x7F, 0xCB, 0xFC, 0xFF, 0xC0,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x1F, 0xFF,
-    0xFD, 0x03, 0xE0, 0xFF, 0xF0, 0x24, 0x0F, 0x6F, 0x80, 0x00, 0xF0, 0xFC, 0x00, 0x1F, 0x0B, 0xC0,
-    0x01, 0xF0, 0xBC, 0x00, 0x1F, 0x0B, 0xC0, 0x01, 0xF0, 0xFC, 0x00, 0x2F, 0x1F, 0x40, 0x02, 0xF7,
-    0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2A, 0xAA, 0xAA,
-    0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x3D, 0x40, 0x38, 0xB0, 0x00, 0xD1, 0xE4, 0x5F, 0x01,
-    0xFF, 0xF0, 0x00, 0x65, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x07, 0x18,
-    0xA0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xAB, 0x80, 0x00, 0x02,
-    0x18, 0x10, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x90, 0x00, 0xD0, 0x00, 0x24, 0x5A, 0x24, 0xD2,
-    0xD9, 0xB0, 0xBF, 0xD0, 0x0B, 0xD0, 0x07, 0xD0, 0x07, 0xFD, 0x0F, 0xAB, 0x47, 0x64, 0xE6, 0x28,
-    0x40, 0x0A, 0x00, 0x0A, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x6F,
-    0xFE, 0x00, 0x1F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xC0, 0x7E, 0x41, 0xFF, 0x07, 0xE4, 0x1F, 0xF0,
-    0x24, 0x00, 0x2F, 0x83, 0x40, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x64, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x40,
-    0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xE5, 0xBF, 0xC0, 0x1D, 0x38, 0x00, 0x3F, 0x40, 0xF4,
-    0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00,
-    0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x01, 0xF8, 0x1F, 0x40, 0x00, 0x0F, 0xC0,
-    0x7D, 0x00, 0x00, 0xBE, 0x01, 0xF4, 0x00, 0x0B, 0xF0, 0x0B, 0xD0, 0x02, 0xFF, 0x00, 0x2F, 0x40,
-    0x2F, 0xF0, 0x00, 0xBD, 0x00, 0xBF, 0x00, 0x02, 0xF4, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x0B, 0xF0,
-    0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x02, 0xF4, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x3E, 0x00, 0x0F, 0xF0, 0x01,
-    0xFC, 0x00, 0x3F, 0xC0, 0x0B, 0xF0, 0x01, 0xFF, 0x40, 0x3F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x07, 0xF5, 0x6F, 0xF0,
-    0x00, 0x4E, 0x00, 0x0F, 0xD0, 0x0F, 0x00, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x00, 0x3F, 0x01, 0xF0,
-    0x00, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x00,
-    0x7D, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x07, 0xF8, 0x00,
-    0xFC, 0x01, 0xFF, 0x80, 0x03, 0xF0, 0x0B, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0x00, 0x3F, 0x00,
-    0xBF, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x1F, 0xC0, 0x2F, 0x80,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x7E, 0x00, 0x07, 0xFC, 0x02, 0xFC, 0x00, 0x2F, 0xF0, 0x0F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0xC0,
-    0xB4, 0x00, 0x3F, 0x03, 0xC0, 0x01, 0xFC, 0x1F, 0x00, 0x0B, 0xF4, 0xB8, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x0F, 0x87, 0xD0, 0x00, 0x3D, 0x2F, 0x80, 0x02, 0xF0, 0xFE, 0x00, 0x0F, 0xC3,
-    0xFC, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x20, 0x82, 0x41, 0x4D, 0x06, 0x32, 0x8C, 0xC5, 0x73, 0x42, 0xCF, 0x5E, 0x1F, 0xF4, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0xD0, 0x02, 0xE0, 0x07, 0xA0, 0x0D, 0x60, 0x2C, 0xB0, 0x3F, 0xFC, 0x00,
-    0xB0, 0x00, 0xB0, 0x00, 0xB0, 0xBF, 0xD9, 0x00, 0x90, 0x0D, 0x00, 0xFF, 0x80, 0x0E, 0x00, 0xB4,
-    0x0F, 0xFF, 0xDB, 0xF4, 0x03, 0xF8, 0x0C, 0x00, 0x24, 0x00, 0x3B, 0xE0, 0x3C, 0x2C, 0x38, 0x0C,
-    0x2C, 0x2C, 0x0F, 0xF4, 0x01, 0x90, 0xFF, 0xF0, 0x01, 0xC0, 0x0B, 0x00, 0x38, 0x00, 0xE0, 0x07,
-    0x40, 0x2D, 0x00, 0xF0, 0x03, 0xC0, 0x0A, 0x00, 0x01, 0x90, 0x0C, 0x24, 0x28, 0x1C, 0x1D, 0x28,
-    0x07, 0xE0, 0x1D, 0x38, 0x38, 0x1C, 0x38, 0x0D, 0x3D, 0x7C, 0x0B, 0xF0, 0x0B, 0xE0, 0x28, 0x28,
-    0x30, 0x1C, 0x34, 0x0C, 0x2D, 0x6D, 0x0B, 0xFD, 0x00, 0x0C, 0x1A, 0xBC, 0x1F, 0xE0, 0x0E, 0x1F,
-    0xE0, 0x01, 0xFF, 0xFF, 0xD0, 0x1F, 0xF4, 0x7F, 0x01, 0xFC, 0x00, 0xF8, 0x2F, 0x40, 0x0B, 0x82,
-    0xF0, 0x00, 0xBC, 0x2F, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0xBC, 0x3F, 0x40, 0x0F, 0xC3, 0xF4, 0x00,
-    0xFC, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x06,
-    0xA4, 0x07, 0x02, 0x83, 0x80, 0x30, 0xD0, 0x0E, 0x70, 0xD3, 0xAC, 0x34, 0xBB, 0x0D, 0x3E, 0xD1,
-    0x0F, 0x78, 0x07, 0x9F, 0x47, 0xE3, 0xFF, 0xF0, 0x7F, 0xF8, 0x06, 0xF8, 0x00, 0x04, 0x07, 0xD0,
-    0x0D, 0x00, 0xD0, 0x0D, 0x00, 0xD0, 0x0D, 0x00, 0xD0, 0xBF, 0xDF, 0xFD, 0x00, 0x01, 0xFE, 0x08,
-    0x0E, 0x00, 0x1C, 0x00, 0xB0, 0x07, 0x40, 0xB8, 0x0F, 0x80, 0xBF, 0xF3, 0xFF, 0xC0, 0x1F, 0xE0,
-    0x00, 0x18, 0x00, 0x18, 0x07, 0xE0, 0x00, 0x24, 0x00, 0x1C, 0x00, 0x2C, 0x2F, 0xF8, 0x2F, 0xE0,
-    0x00, 0x10, 0x00, 0xE0, 0x02, 0xE0, 0x07, 0x70, 0x0D, 0x70, 0x2C, 0x70, 0x3F, 0xFD, 0x00, 0xB0,
-    0x00, 0xB0, 0x00, 0xB4, 0x00, 0x00, 0xBF, 0xC3, 0x00, 0x0C, 0x00, 0x3F, 0xD0, 0x01, 0xC0, 0x03,
-    0x84, 0x1D, 0x3F, 0xF0, 0xAE, 0x00, 0x02, 0xF8, 0x0D, 0x00, 0x24, 0x00, 0x3B, 0xE0, 0x3C, 0x2C,
-    0x38, 0x0C, 0x28, 0x0C, 0x1F, 0xBC, 0x07, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0x00, 0x28, 0x00,
-    0xE0, 0x03, 0x40, 0x1D, 0x00, 0xB0, 0x03, 0xC0, 0x1F, 0x00, 0x14, 0x00, 0x01, 0x90, 0x0C, 0x28,
-    0x18, 0x0C, 0x0D, 0x28, 0x07, 0xF0, 0x1D, 0x28, 0x38, 0x0C, 0x38, 0x0D, 0x2D, 0x6C, 0x0B, 0xF4,
-    0x0B, 0xE0, 0x28, 0x28, 0x30, 0x1C, 0x34, 0x0C, 0x2D, 0x2D, 0x0B, 0xFD, 0x00, 0x0C, 0x1A, 0xBC,
-    0x1F, 0xE0, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0xB4, 0x00, 0xF0, 0x02, 0xE0, 0x03, 0xC0, 0x0B, 0x80,
-    0x0F, 0x40, 0x0F, 0x00, 0x2E, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E, 0x00,
-    0x2F, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x0F, 0xC0, 0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xF0, 0x02, 0xF4,
-    0x00, 0xFC, 0x00, 0xBD, 0x00, 0x15, 0x74, 0x00, 0x3C, 0x00, 0x2E, 0x00, 0x0F, 0x00, 0x0B, 0x80,
-    0x03, 0xC0, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C,
-    0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C,
-    0x00, 0xBC, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0xF4, 0x02, 0xF0, 0x03, 0xE0, 0x03, 0xD0, 0x0B, 0xC0,
-    0x0F, 0xC0, 0x1F, 0x40, 0x3F, 0x00, 0x7E, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2D, 0x0B, 0x40, 0x00,
-    0x0F, 0x03, 0xC0, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x00, 0xF4, 0x3D, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xD0, 0xF4,
-    0x00, 0xFF, 0xF0, 0x3C, 0x00, 0x7F, 0xBC, 0x1F, 0x00, 0x3F, 0x6D, 0x0B, 0x40, 0x1F, 0xCF, 0x03,
-    0xC0, 0x0B, 0xE7, 0xC1, 0xF0, 0x03, 0xF6, 0xE0, 0xB8, 0x00, 0xFC, 0xF4, 0x3D, 0x00, 0x3F, 0x7C,
-    0x0F, 0x00, 0x0F, 0xFF, 0x07, 0xC0, 0x03, 0xFF, 0x82, 0xE0, 0x00, 0xFF, 0xE0, 0xF4, 0x00, 0x3F,
-    0xFF, 0xBD, 0x6F, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0x02, 0xE6, 0xFF, 0xFE, 0x40, 0xF4, 0x3D, 0x00, 0x00, 0x3C, 0x0F, 0x00,
-    0x00, 0x1F, 0x07, 0xC0, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xE4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x2D, 0xFC, 0x0F, 0xD0, 0x02, 0xFF, 0xC0, 0xFE, 0x00, 0x2F, 0x00, 0x0F, 0xF0, 0x02,
-    0xD0, 0x00, 0xFF, 0xE0, 0x3D, 0x00, 0x0F, 0xFF, 0xFB, 0xEB, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0F, 0xF9, 0x1B, 0xD0, 0x0F, 0x80, 0x00, 0x80, 0x0F, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x40, 0x05, 0xBD, 0x55, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0xFF, 0xEA, 0xA5, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0xFE, 0x00,
-    0xBE, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0xFE, 0x00, 0x02, 0xFD, 0x3F, 0x80, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFC, 0x07, 0xF0, 0xFD, 0x00,
-    0x03, 0xFC, 0x03, 0xF4, 0xFD, 0x00, 0x03, 0xFD, 0x02, 0xFD, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0xFE,
-    0xFD, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFD,
-    0x00, 0x2F, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x00,
-    0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x7D, 0x56, 0xFF, 0x40, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xBC,
-    0x00, 0x07, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xFF, 0xAA, 0xAF, 0xF8, 0x00, 0xBC, 0x00,
-    0x1F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE4,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01,
-    0xD5, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xB0,
-    0x03, 0xF0, 0x00, 0x1F, 0xF8, 0x2E, 0xAF, 0xF8, 0x00, 0x1F, 0xFE, 0x0B, 0xFF, 0xFC, 0x00, 0x0E,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xE0, 0x00, 0x3F, 0x92,
-    0xF4, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x2F, 0x00, 0x03, 0xFE, 0x03, 0xF0, 0x07, 0xC0, 0x00, 0x2F,
-    0xF0, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0x8F, 0xC0, 0x1F,
-    0xC0, 0x0B, 0xAB, 0xE3, 0xF0, 0x07, 0xF0, 0x07, 0xFF, 0xF8, 0xFC, 0x01, 0xFC, 0x02, 0xFF, 0xFC,
-    0x3F, 0x00, 0xBF, 0x40, 0x2F, 0xF9, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x3C, 0x00, 0x00, 0x0B,
-    0x40, 0xF0, 0x00, 0x00, 0x3C, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x1E,
-    0x00, 0x00, 0x1F, 0x00, 0x7C, 0x07, 0x80, 0x78, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x5F, 0x9B, 0xF9, 0x7D, 0x40, 0x2D, 0x2F, 0xF0, 0xF0, 0x00, 0xB4, 0xFB, 0xC7, 0xC0,
-    0x01, 0xE3, 0xDF, 0x5E, 0x00, 0x07, 0xEF, 0x2E, 0xB8, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x3F,
-    0xE0, 0xFF, 0x40, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x2F,
-    0xC0, 0x00, 0x2F, 0x80, 0x7E, 0x00, 0x00, 0x7D, 0x00, 0xF8, 0x00, 0x3A, 0x94, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x2F, 0x3F, 0x40, 0x6F, 0x80, 0x2F, 0x3E,
-    0x00, 0x07, 0xD0, 0x2F, 0x3D, 0x00, 0x02, 0xE0, 0x2F, 0x3D, 0x00, 0x01, 0xF0, 0x2F, 0x3D, 0x02,
-    0x40, 0xF0, 0x2F, 0x3D, 0x07, 0xC0, 0xF0, 0x2F, 0x3D, 0x07, 0xC0, 0xF0, 0x2F, 0x3D, 0x07, 0xC0,
-    0xF0, 0x2F, 0x3D, 0x03, 0xC0, 0xA0, 0x2F, 0x3C, 0x03, 0xC0, 0x00, 0x2F, 0x3C, 0x03, 0xC0, 0x00,
-    0x2F, 0x3C, 0x02, 0xF0, 0x00, 0x3F, 0x3C, 0x00, 0xFD, 0x00, 0x7F, 0x3C, 0x00, 0x7F, 0xFB, 0xFF,
-    0x14, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1A, 0xBE, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0xBE, 0x2C, 0x00, 0x01, 0xFF, 0xEF, 0x00, 0x00, 0xF4, 0x7F, 0xC0,
-    0x00, 0xB0, 0x03, 0xF0, 0x00, 0x38, 0x00, 0xBC, 0x00, 0x1E, 0x00, 0x2F, 0x00, 0x03, 0xC0, 0x0F,
-    0xC0, 0x00, 0xF8, 0x0B, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x2F,
-    0xF7, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE, 0x00, 0x3F,
-    0x90, 0x14, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-    0x01, 0xFB, 0xFF, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x03, 0xFE, 0x95, 0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x06,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xAF, 0xEA, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x40, 0x00, 0x00, 0x0F, 0xEF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0B, 0xFE, 0x40,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xAF, 0xC6, 0x40, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x19, 0xBF,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x55, 0x6F, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x03, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xAF, 0x56, 0xC0, 0x0F, 0xF8, 0x0F, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0x00, 0x00,
-    0x2F, 0xC0, 0x0F, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0x00, 0x00, 0x3F, 0x80, 0x0E, 0x00, 0x00, 0x3F,
-    0x40, 0x0E, 0x00, 0x00, 0x3F, 0x40, 0x0E, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0x50, 0x00, 0x3F, 0x40,
-    0x0F, 0xFF, 0xFD, 0x3F, 0x40, 0x0E, 0xAF, 0xFE, 0x3F, 0xC0, 0x0E, 0x01, 0xFA, 0x3F, 0xD0, 0x0E,
-    0x01, 0xF0, 0x2F, 0xF4, 0x0E, 0x02, 0xF0, 0x1F, 0xFF, 0xEF, 0xAF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1B, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0xBF, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0xEE, 0x10, 0x2F, 0x4E, 0x00, 0x3F, 0x0E,
-    0x00, 0x3D, 0x0E, 0x00, 0x3D, 0x0E, 0x00, 0x3D, 0x0E, 0x00, 0x3E, 0x0E, 0x00, 0x3F, 0x0F, 0x00,
-    0x2F, 0xDF, 0x00, 0x0F, 0xFF, 0xF4, 0x07, 0xFF, 0xFC, 0x00, 0x7F, 0xF9, 0x00, 0x0B, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xA5, 0x4F, 0xC5, 0x55,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC0, 0x02,
-    0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x40, 0x0A, 0xAB, 0xFA, 0x83, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3D, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0x00, 0x00, 0xF7, 0xFC, 0x00, 0x07, 0xFF, 0x90, 0x02,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x01, 0x00, 0x25, 0xF1, 0xBC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
-    0xF8, 0x00, 0x0F, 0xFD, 0x00, 0x3C, 0x3E, 0xF0, 0x02, 0xE0, 0x07, 0xC0, 0x2F, 0x00, 0x1F, 0x0B,
-    0xF0, 0x00, 0x7F, 0xFD, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x07, 0xFB, 0x5F, 0xC0, 0x0B, 0xC7, 0x47, 0xC0, 0x0F, 0x87, 0x43,
-    0xD0, 0x0F, 0x47, 0x42, 0xD0, 0x0F, 0x07, 0x42, 0xD0, 0x0F, 0x03, 0x81, 0xD0, 0x0F, 0x03, 0x81,
-    0xD0, 0x0F, 0x03, 0x81, 0xD0, 0x0F, 0x03, 0x81, 0xD0, 0x0F, 0x03, 0x82, 0xD0, 0x0F, 0x03, 0x82,
-    0xD0, 0x0F, 0x43, 0x82, 0xD0, 0x0B, 0x43, 0x82, 0xD0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xD5, 0x5B, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xC0,
-    0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x02,
-    0xFC, 0x05, 0x5F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2A, 0xAF, 0xFA, 0xA4, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x01,
-    0xFF, 0xFE, 0x00, 0x01, 0xF5, 0xE3, 0xE0, 0x02, 0xF4, 0x78, 0x3F, 0x02, 0xF0, 0x1E, 0x02, 0xE0,
-    0x70, 0x07, 0x80, 0x20, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x70, 0x07, 0x80, 0x10, 0x2F, 0x01, 0xE0, 0x2E, 0x02, 0xF4, 0x78, 0x3F, 0x00, 0x1F, 0x5E, 0x3E,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x30, 0x00, 0x00, 0x3C, 0x00, 0x3C,
-    0x00, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x07, 0x80, 0x00, 0x01, 0xE0,
-    0x1F, 0xAA, 0xAA, 0xAA, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x03,
-    0xC0, 0x00, 0x02, 0xD0, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0x1C,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x0F, 0xBF, 0x80, 0x07, 0xC7, 0x2E, 0x01, 0xF0, 0x70, 0x7C, 0x28, 0x07, 0x01,
-    0xC0, 0x00, 0x70, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-    0x70, 0x00, 0x04, 0x07, 0x00, 0x03, 0xE0, 0x70, 0x2C, 0x0B, 0x87, 0x0B, 0x40, 0x2F, 0xB3, 0xD0,
-    0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x5A, 0xAE, 0x07, 0xFF,
-    0xFF, 0x81, 0xFD, 0x40, 0x00, 0xBF, 0x80, 0x00, 0x2D, 0xF8, 0x00, 0x0B, 0x0F, 0x80, 0x02, 0xC0,
-    0xF8, 0x00, 0xF0, 0x0F, 0x80, 0x3C, 0x00, 0xF8, 0x0F, 0x00, 0x0F, 0xC2, 0x40, 0x00, 0xF8, 0x00,
-    0x00, 0x08, 0x0F, 0xAA, 0x54, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x17, 0xF4, 0x00, 0x03, 0xFD, 0x00,
-    0x03, 0xF7, 0x80, 0x03, 0xF1, 0xE0, 0x03, 0xF0, 0x38, 0x03, 0xF0, 0x0E, 0x03, 0xF0, 0x03, 0xC3,
-    0xF0, 0x00, 0xF2, 0xF0, 0x00, 0x14, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x10, 0x3E, 0x00, 0x0F, 0x03, 0xE0, 0x03, 0x80, 0x3D, 0x01, 0xD0, 0x07, 0xD0, 0x74,
-    0x00, 0x7C, 0x2C, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xF8, 0xF0, 0x00,
-    0xF8, 0x3C, 0x00, 0xBC, 0x0B, 0x00, 0xBC, 0x01, 0xD0, 0x7C, 0x00, 0x78, 0x7D, 0x00, 0x0E, 0x3D,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x47, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0xC0, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x00,
-    0x7E, 0xC0, 0xEF, 0x00, 0x01, 0xF5, 0xC0, 0xD7, 0xD0, 0x07, 0xD1, 0xC0, 0xD1, 0xF4, 0x1F, 0x41,
-    0xC0, 0xD0, 0x7D, 0x2E, 0x01, 0xC0, 0xD0, 0x1D, 0x04, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0,
-    0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0,
-    0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00,
-    0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00,
-    0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00,
-    0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x1C, 0x01,
-    0xC0, 0xD0, 0x0C, 0x2F, 0x01, 0xC0, 0xD0, 0x3E, 0x0B, 0xC1, 0xC0, 0xD0, 0xF8, 0x02, 0xF1, 0xC0,
-    0xD3, 0xE0, 0x00, 0xFE, 0xC0, 0xDF, 0x80, 0x00, 0x3F, 0xC0, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0xF4,
-    0x00, 0x00, 0x03, 0xC0, 0xD0, 0x00, 0x00, 0x00, 0xC0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x0F, 0x80,
-    0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-    0x2F, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7E, 0xF4, 0x00, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0xFE, 0x0E,
-    0xFC, 0x02, 0xFF, 0x83, 0x4B, 0xE0, 0x3C, 0xA0, 0xD0, 0xB4, 0x00, 0x28, 0x34, 0x00, 0x00, 0x0A,
-    0x0D, 0x00, 0x00, 0x02, 0x83, 0x40, 0x00, 0x00, 0xA0, 0xD0, 0x00, 0x00, 0x28, 0x34, 0x00, 0x00,
-    0x0A, 0x0D, 0x01, 0x01, 0xF6, 0x83, 0x43, 0xE0, 0x7F, 0xE0, 0xD3, 0xF4, 0x02, 0xF8, 0x3F, 0xE0,
-    0x00, 0x1F, 0x4F, 0xD0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0xAF, 0x80, 0xF0, 0x1F, 0xFF, 0xD3, 0xC0, 0xFD, 0x07, 0xDE, 0x0B, 0xC0, 0x03, 0xF4, 0x3E,
-    0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x7C, 0x0B, 0xC0, 0x03, 0xD0, 0x1F, 0xE5,
-    0x7F, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x03, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0x03, 0xE0,
-    0x00, 0xBF, 0xE5, 0x7F, 0xF7, 0xE0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x00,
-    0x1F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x03,
-    0xF0, 0x00, 0x07, 0xCB, 0xE0, 0x00, 0xFC, 0x00, 0x07, 0xC1, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xC0,
-    0x3E, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x0F, 0xC0, 0x03, 0xF0, 0x0B, 0x80, 0x03, 0xE0, 0x00, 0xFC,
-    0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3F, 0x4F, 0x80, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xBF,
-    0x40, 0x01, 0xFF, 0xE5, 0x56, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0x4B, 0xFF, 0xFF, 0xF4, 0x00,
-    0x0F, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x07, 0xEF, 0x80, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x01, 0xFC, 0x7E, 0x00, 0x00, 0x0F,
-    0xD0, 0xFC, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0B,
-    0xE0, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0x7F, 0x00,
-    0xFD, 0x00, 0x00, 0xFE, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x3F, 0xD5, 0x55, 0x5B, 0xF4, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0,
-    0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0,
-    0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0,
-    0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0,
-    0x01, 0x50, 0x02, 0x80, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0,
-    0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0,
-    0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0,
-    0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x2C, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x02, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03,
-    0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0xAA, 0xAA, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0x82, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFA, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x80, 0x3F, 0x40, 0x00, 0x00, 0xF8, 0x2F, 0xC0,
-    0x00, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x2F, 0x80, 0x07, 0xFF, 0xF0, 0xFF, 0xF4, 0x0F, 0xD5, 0xBA, 0xF9, 0xBC, 0x2E, 0x00, 0x2F, 0xC0,
-    0x0D, 0x3C, 0x00, 0x0F, 0x80, 0x0E, 0x3C, 0x00, 0x0F, 0x40, 0x0B, 0x3C, 0x00, 0x0F, 0x40, 0x0B,
-    0x3C, 0x00, 0x0F, 0xC0, 0x1E, 0x2F, 0x51, 0xBF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFA, 0xFF, 0xFC, 0x07,
-    0xFF, 0xF0, 0xFF, 0xF4, 0x00, 0xBF, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00,
-    0x00, 0x02, 0xFE, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x19, 0x07, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xD7, 0xF6,
-    0xFE, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0xFC, 0x7F, 0x6F, 0xDB, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x01, 0x81, 0xF5, 0xF0, 0x0B, 0x4B, 0x81, 0xF0, 0x3C, 0x3D, 0x01,
-    0xFA, 0xF0, 0xA0, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x74, 0xBC, 0x3E, 0x02, 0xD3, 0xD0, 0x2F, 0x6F, 0x0A, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFB, 0xF0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0xF8, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0xE4,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0xBF, 0xFF,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE9, 0x40, 0x00, 0x16, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x15, 0xAF, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x6F, 0xFF, 0xD0, 0x01, 0xBF, 0xFF, 0xE4, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x90, 0x00,
-    0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00,
-    0x05, 0xAF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xA9, 0x42, 0xEA, 0x50, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_12_regularBitmaps[34362] = {
+    0x29, 0xA3, 0xD2, 0x9D, 0x29, 0xD2, 0x9D, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x19, 0xE1, 0x9E, 0x49, 0x7E, 0xA1, 0xEA, 0x09, 0xF0, 0xAF, 0x0F, 0xC0,
+    0xAE, 0xA1, 0xF0, 0xAE, 0x91, 0xF0, 0xAE, 0x2F, 0x0A, 0xE2, 0xEA, 0x0A, 0xE2, 0xE9, 0x0F, 0x2E,
+    0x90, 0xF2, 0xEA, 0x00, 0x70, 0xD4, 0xAC, 0x97, 0x69, 0xD4, 0xD9, 0x76, 0xAD, 0x4D, 0x97, 0x6A,
+    0xCA, 0x4D, 0x77, 0xDA, 0x4D, 0x77, 0xDA, 0x39, 0xD7, 0x1F, 0xFF, 0xFF, 0xE9, 0x1F, 0xFF, 0xFF,
+    0xE7, 0x9D, 0x93, 0xE7, 0x6A, 0xD4, 0xDA, 0x76, 0xAD, 0x4D, 0xA7, 0x6E, 0x4D, 0x97, 0x6E, 0x39,
+    0xD9, 0x76, 0xE3, 0x9D, 0x97, 0x09, 0xFF, 0xFF, 0xFD, 0xA1, 0xAF, 0xFF, 0xFF, 0xD9, 0x6A, 0xDA,
+    0x3E, 0x76, 0xE9, 0x3E, 0x76, 0xE9, 0x3E, 0x76, 0xE9, 0x29, 0xE7, 0x6E, 0x39, 0xDA, 0x77, 0x77,
+    0x20, 0x77, 0x73, 0x9C, 0x90, 0x9C, 0x97, 0x59, 0xC9, 0x09, 0xC9, 0x74, 0x9A, 0xFD, 0xA9, 0x70,
+    0x9F, 0xFE, 0x96, 0x9F, 0xFF, 0x7F, 0xDA, 0x09, 0xC9, 0x09, 0x69, 0xE9, 0x9C, 0x90, 0x9C, 0x97,
+    0x0A, 0xDA, 0x09, 0xC9, 0x09, 0xC9, 0x70, 0xAD, 0xA0, 0x9C, 0x90, 0x9C, 0x97, 0x09, 0xE0, 0x9C,
+    0x90, 0x9C, 0x97, 0x1F, 0xDA, 0x0A, 0xC9, 0x71, 0x9F, 0xFC, 0xA7, 0x3A, 0xFF, 0xD9, 0x72, 0xAF,
+    0xFC, 0xA7, 0x19, 0xC9, 0x0A, 0xFE, 0x70, 0x9C, 0x90, 0x9C, 0xAF, 0xCA, 0x79, 0xC9, 0x09, 0xC9,
+    0xFD, 0x79, 0xC9, 0x09, 0xCA, 0xFD, 0x29, 0xEA, 0xDA, 0xAF, 0xFC, 0x2F, 0xFF, 0xFC, 0x91, 0xFF,
+    0xFF, 0xCA, 0x1A, 0xFF, 0xFF, 0x93, 0x9A, 0xFF, 0xEA, 0x97, 0x39, 0xC9, 0x09, 0xC9, 0x75, 0x9C,
+    0x90, 0x9C, 0x97, 0x69, 0x2A, 0x70, 0x77, 0x75, 0x9C, 0x97, 0x5C, 0xA3, 0x9E, 0x94, 0xAC, 0x39,
+    0xCA, 0x9A, 0xC9, 0x3C, 0xA3, 0xC9, 0x29, 0xC2, 0xD4, 0xC4, 0xC1, 0x9C, 0x93, 0x9C, 0x4C, 0x90,
+    0xD5, 0xC9, 0x3C, 0x0A, 0xC9, 0x5D, 0x90, 0x9D, 0x9D, 0x69, 0xFC, 0xAD, 0x70, 0x9E, 0x99, 0xCA,
+    0x75, 0xD9, 0xFA, 0x7A, 0xCA, 0xCA, 0x2C, 0xA6, 0xD9, 0xC3, 0x9C, 0x5D, 0x99, 0xC3, 0x9C, 0x49,
+    0xD0, 0x9C, 0x39, 0xC4, 0xD9, 0x1C, 0xA9, 0x09, 0xD3, 0xAD, 0x2A, 0xFC, 0x92, 0x9D, 0x4A, 0xE9,
+    0x3D, 0xA7, 0x30, 0x49, 0xAD, 0xA9, 0x73, 0xAF, 0xEA, 0x71, 0xAD, 0x92, 0x9D, 0xA7, 0x0D, 0x94,
+    0xAD, 0x70, 0xD9, 0x4A, 0xD7, 0x0E, 0x39, 0xDA, 0x70, 0xAD, 0xA1, 0xAE, 0x72, 0xAF, 0xE7, 0x4A,
+    0xFA, 0x75, 0xFC, 0x75, 0xFE, 0x73, 0xF1, 0xE5, 0x99, 0x19, 0xE9, 0x2E, 0x3E, 0x1F, 0x4E, 0x90,
+    0x9E, 0x1F, 0x5A, 0xD9, 0xE9, 0x1F, 0x6A, 0xFC, 0x2A, 0xF5, 0x9F, 0x39, 0xFC, 0xA9, 0x99, 0xFD,
+    0x93, 0xAF, 0xFF, 0xAD, 0x93, 0xAF, 0xFD, 0x2A, 0x6A, 0xAF, 0xA9, 0x77, 0x72, 0x99, 0x99, 0x9A,
+    0xE9, 0xAE, 0x9F, 0x0F, 0x0F, 0x0F, 0x50, 0x4A, 0xC9, 0x4D, 0x4A, 0xC9, 0x4D, 0x4A, 0xCA, 0x4D,
+    0x4A, 0xCA, 0x4D, 0x94, 0xD4, 0xAC, 0xA4, 0xDA, 0x4D, 0x94, 0xD4, 0x9D, 0x49, 0xD4, 0x9D, 0x49,
+    0xD4, 0x9D, 0x49, 0xD4, 0x9D, 0x5D, 0x5D, 0x94, 0xDA, 0x4A, 0xD4, 0x9D, 0x5D, 0x94, 0xE4, 0xAD,
+    0x49, 0xD9, 0x4E, 0x4A, 0xD9, 0x4E, 0x4A, 0xD9, 0x49, 0x99, 0x9C, 0x95, 0xD5, 0xAC, 0xA5, 0xD5,
+    0xAC, 0xA5, 0xD5, 0xD9, 0x49, 0xD5, 0xD5, 0xD9, 0x4A, 0xCA, 0x49, 0xD4, 0x9D, 0x5D, 0x5D, 0x94,
+    0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x5D, 0x49, 0xD4, 0xAD, 0x4A, 0xCA, 0x4D, 0xA4, 0xD9, 0x3A, 0xD4,
+    0xDA, 0x4D, 0x93, 0xAD, 0x4E, 0x39, 0xD9, 0x3E, 0x39, 0xDA, 0x39, 0x99, 0x40, 0x77, 0x19, 0xCA,
+    0x72, 0xCA, 0x29, 0x19, 0xC9, 0x1C, 0xA1, 0xAC, 0x90, 0xAE, 0x0C, 0xA9, 0xD9, 0x39, 0xFC, 0x97,
+    0xAD, 0xA6, 0x9F, 0xDA, 0x91, 0x9E, 0x0C, 0xA0, 0xAD, 0xA1, 0xCA, 0x1D, 0x2A, 0x6D, 0x72, 0xCA,
+    0x40, 0x5A, 0xC7, 0x2D, 0x72, 0xD7, 0x2D, 0x72, 0xD5, 0xFF, 0xE9, 0x0F, 0xFE, 0x95, 0xD7, 0x2D,
+    0x72, 0xD7, 0x2D, 0x72, 0xAC, 0x40, 0x19, 0x99, 0x90, 0x9E, 0xA0, 0xAE, 0x90, 0xAE, 0x1A, 0xE1,
+    0xEA, 0x09, 0xE9, 0x0A, 0xE1, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFE, 0x1F, 0xFE, 0x00,
+    0x5E, 0x1E, 0x09, 0xE0, 0xAE, 0x90, 0x74, 0xA7, 0x39, 0xCA, 0x73, 0xAC, 0x97, 0x3D, 0x73, 0x9D,
+    0x73, 0xAC, 0x97, 0x3D, 0x74, 0xD7, 0x39, 0xCA, 0x73, 0xD9, 0x73, 0xD7, 0x39, 0xD7, 0x3A, 0xCA,
+    0x73, 0xD9, 0x72, 0x9D, 0x73, 0xAC, 0xA7, 0x3D, 0x97, 0x3D, 0x73, 0x9D, 0x73, 0xDA, 0x73, 0xD9,
+    0x72, 0x9D, 0x73, 0xAD, 0x73, 0xD9, 0x72, 0x9D, 0x73, 0xAD, 0x73, 0xDA, 0x73, 0xD9, 0x72, 0xAD,
+    0x73, 0xE7, 0x3D, 0xA7, 0x29, 0xD9, 0x72, 0xAD, 0x73, 0xDA, 0x72, 0x9D, 0x97, 0x2A, 0xD7, 0x3D,
+    0x97, 0x3A, 0x77, 0x73, 0x4A, 0xEA, 0x69, 0xCA, 0x19, 0xD4, 0x9D, 0x4D, 0x3D, 0x94, 0xAC, 0x92,
+    0xD6, 0xD1, 0xAD, 0x6D, 0x1A, 0xCA, 0x1A, 0xC2, 0xD9, 0x0D, 0xA1, 0xDA, 0x1D, 0x90, 0xDA, 0x1D,
+    0xA1, 0xDA, 0x0D, 0xA1, 0xD9, 0x1D, 0xA0, 0xE1, 0x9C, 0x2D, 0xA0, 0xE5, 0x9D, 0x90, 0xAD, 0x94,
+    0xAD, 0x90, 0xAE, 0x39, 0xE1, 0x9F, 0xAA, 0xFC, 0x2F, 0xFD, 0xA2, 0x9F, 0xFC, 0x4A, 0xFE, 0x95,
+    0x9A, 0xEA, 0x30, 0x76, 0x9E, 0x95, 0xAF, 0x95, 0xD9, 0xD9, 0x59, 0x1D, 0x97, 0x0D, 0x97, 0x0D,
+    0x97, 0x0D, 0x97, 0x0D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0xAD,
+    0x94, 0x99, 0x9E, 0xAA, 0x99, 0x1F, 0xFD, 0x90, 0xFF, 0xD9, 0x0F, 0xFD, 0x90, 0x29, 0xAE, 0xA9,
+    0x3A, 0xFF, 0xC2, 0xAC, 0xA9, 0x19, 0xAD, 0xA1, 0x96, 0xAD, 0x72, 0xD9, 0x71, 0xDA, 0x71, 0xDA,
+    0x70, 0x9D, 0x97, 0x0E, 0x70, 0xF7, 0xAE, 0x7F, 0x95, 0x9F, 0xA5, 0xAF, 0xA5, 0xFC, 0xA5, 0x9F,
+    0xCA, 0xAA, 0xAA, 0x90, 0xAF, 0xFE, 0x0A, 0xFF, 0xE0, 0xFF, 0xF0, 0x19, 0xAF, 0xA9, 0x4E, 0xAA,
+    0xF3, 0x95, 0xAD, 0x72, 0xAC, 0x97, 0x19, 0xC9, 0x71, 0x9C, 0x97, 0x1A, 0xC9, 0x70, 0xAD, 0x4F,
+    0xDA, 0x5F, 0xD9, 0x71, 0x9E, 0x72, 0xDA, 0x71, 0xE7, 0x1E, 0x70, 0x9D, 0xA1, 0xEA, 0xAF, 0xCA,
+    0x09, 0xFF, 0xD1, 0xFF, 0xD3, 0xAF, 0xCA, 0x92, 0x77, 0x59, 0xC7, 0x3D, 0x97, 0x1E, 0x97, 0x0A,
+    0xE9, 0x79, 0xDA, 0xCA, 0x7D, 0xA9, 0xCA, 0x6E, 0x09, 0xCA, 0x5A, 0xD1, 0xAD, 0x49, 0xDA, 0x1A,
+    0xD4, 0xE2, 0xAD, 0x3E, 0x99, 0x99, 0xE9, 0x99, 0x0F, 0xFF, 0xA0, 0xFF, 0xFA, 0x7E, 0x97, 0x1E,
+    0x97, 0x1E, 0x97, 0x1E, 0xA7, 0x1E, 0xA1, 0x1A, 0xAA, 0xAA, 0xF9, 0x19, 0xFF, 0xCA, 0x19, 0xCA,
+    0x71, 0x9C, 0xA7, 0x19, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAF, 0xDA, 0x4A, 0xFF, 0xC2,
+    0x99, 0x49, 0xE7, 0x19, 0xD9, 0x71, 0xDA, 0x71, 0xDA, 0x70, 0x9D, 0xA0, 0x9A, 0x49, 0xE9, 0x09,
+    0xFF, 0xD1, 0xAF, 0xFC, 0xA1, 0xFF, 0xCA, 0x29, 0xAF, 0xCA, 0x30, 0x5A, 0xFC, 0x94, 0xAF, 0xE9,
+    0x3A, 0xD9, 0x70, 0x9D, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xAC, 0xA7, 0x2D, 0xA0, 0xAE, 0xA9, 0x3F,
+    0xFD, 0xA2, 0xFA, 0x2A, 0xDA, 0x1E, 0xA4, 0xAD, 0x1E, 0x6D, 0x90, 0xAD, 0x6D, 0xA0, 0xAD, 0x6D,
+    0x90, 0x9D, 0xA4, 0xAD, 0x91, 0xEA, 0x99, 0x9A, 0xE2, 0x9F, 0xFC, 0x93, 0xAF, 0xEA, 0x59, 0xAE,
+    0xA3, 0x75, 0xFF, 0xEA, 0x0A, 0xAA, 0xFF, 0x97, 0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1E, 0x71,
+    0xDA, 0x70, 0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xE9, 0x70, 0xE7, 0x0A, 0xE7, 0x0F, 0x70, 0xEA, 0x79,
+    0xEA, 0x7A, 0xE9, 0x7F, 0x70, 0xF2, 0x39, 0xAE, 0xA9, 0x6A, 0xCA, 0x90, 0x9A, 0xCA, 0x49, 0xCA,
+    0x4A, 0xCA, 0x3D, 0x95, 0xD3, 0xD6, 0xD3, 0xD9, 0x49, 0xD3, 0xAD, 0x4D, 0xA4, 0xE9, 0x99, 0xE6,
+    0xAF, 0xCA, 0x69, 0xFE, 0x94, 0xAD, 0xA2, 0xAD, 0xA2, 0x9D, 0xA4, 0xAD, 0x91, 0xAD, 0x6E, 0x1E,
+    0x6E, 0x1E, 0x6E, 0x1E, 0xA4, 0xAE, 0x2F, 0xAA, 0xAF, 0x39, 0xFF, 0xC9, 0x5A, 0xAE, 0xAA, 0x30,
+    0x39, 0xAE, 0xA6, 0xEA, 0xAE, 0x93, 0xDA, 0x3E, 0x29, 0xD5, 0xDA, 0x1A, 0xC9, 0x5E, 0x1D, 0x95,
+    0xAD, 0x1D, 0x95, 0x9D, 0x90, 0xD9, 0x59, 0xD9, 0x0A, 0xD5, 0xAD, 0xA1, 0xE3, 0x9E, 0xA1, 0xAF,
+    0xFD, 0xA2, 0x9F, 0xFC, 0x95, 0x99, 0x91, 0xD9, 0x72, 0xD9, 0x71, 0xAD, 0x29, 0xA9, 0x99, 0x99,
+    0xAE, 0x2F, 0xFD, 0x92, 0xFF, 0xCA, 0x3A, 0xFD, 0xA9, 0x20, 0x0E, 0x1E, 0x99, 0xE9, 0xAE, 0xA9,
+    0x99, 0x99, 0x77, 0x71, 0x99, 0x91, 0xE0, 0x9E, 0x9A, 0xE9, 0xAE, 0xA0, 0x1E, 0x19, 0xE1, 0xAE,
+    0x1F, 0x90, 0x99, 0x99, 0x77, 0x77, 0x09, 0x99, 0x90, 0x9E, 0xA0, 0xAE, 0x90, 0xAE, 0x1A, 0xE1,
+    0xEA, 0x09, 0xE9, 0x0A, 0xE1, 0x77, 0x77, 0x9C, 0x97, 0x4A, 0xE9, 0x72, 0xAF, 0x97, 0x09, 0xFC,
+    0x97, 0x09, 0xFC, 0x97, 0x0A, 0xFC, 0x97, 0x0A, 0xFC, 0x97, 0x2F, 0x97, 0x4F, 0xDA, 0x97, 0x19,
+    0xAF, 0xF9, 0x72, 0xAF, 0xFA, 0x97, 0x19, 0xAF, 0xE7, 0x39, 0xAF, 0x77, 0xAC, 0x00, 0x75, 0x9A,
+    0xFF, 0xA1, 0xFF, 0xAA, 0xA7, 0x77, 0x77, 0x1A, 0xAA, 0xAF, 0xCA, 0x1A, 0xFF, 0xD7, 0x50, 0x77,
+    0x3C, 0x97, 0x7E, 0xA7, 0x59, 0xFA, 0x75, 0x9F, 0xC9, 0x74, 0x9F, 0xC9, 0x74, 0x9A, 0xFA, 0x75,
+    0xAF, 0xA7, 0x49, 0xF7, 0x19, 0xAF, 0xD6, 0x9A, 0xFE, 0xA9, 0x29, 0xAF, 0xFA, 0x94, 0xFF, 0x97,
+    0x0F, 0xA9, 0x73, 0xCA, 0x97, 0x50, 0x77, 0x09, 0xAE, 0xA9, 0x5F, 0xFC, 0x92, 0xEA, 0x99, 0xAF,
+    0x2A, 0xC5, 0xAE, 0x72, 0xAD, 0x72, 0x9D, 0x97, 0x19, 0xD9, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E,
+    0x71, 0xAD, 0x97, 0x09, 0xE7, 0x09, 0xE7, 0x9F, 0x97, 0xF9, 0x70, 0xE9, 0x71, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0x72, 0x99, 0x77, 0x77, 0x7E, 0x72, 0xE7, 0x19, 0xE9, 0x70, 0x9E, 0x94, 0x71, 0x9A,
+    0xAA, 0xA9, 0x75, 0x9F, 0xF9, 0x72, 0xEA, 0x92, 0x9D, 0xA7, 0x0D, 0xA7, 0xAC, 0x96, 0xD9, 0x71,
+    0xAC, 0x5D, 0xA7, 0x3C, 0xA3, 0x9D, 0x3E, 0xAA, 0x3A, 0xC3, 0xDA, 0x2C, 0xA0, 0x9D, 0x39, 0xC3,
+    0xD2, 0x9A, 0x2A, 0xC4, 0xC9, 0x1A, 0xD2, 0xA9, 0x2A, 0xC3, 0x9C, 0x91, 0xAD, 0x2C, 0x92, 0xAC,
+    0x3A, 0xC2, 0xAD, 0x91, 0xD9, 0x0A, 0xD3, 0xD2, 0xAD, 0xA1, 0x9F, 0xD9, 0x1D, 0x92, 0x9E, 0x29,
+    0xDA, 0x0C, 0xAA, 0xD9, 0x4F, 0x7A, 0xCA, 0x6A, 0xF7, 0x71, 0xFC, 0xA9, 0x39, 0xAA, 0x70, 0xFF,
+    0xFC, 0x71, 0xAF, 0xFE, 0x97, 0x19, 0xAF, 0xFC, 0xA7, 0x49, 0xAA, 0xAA, 0xA9, 0x40, 0x79, 0xDA,
+    0x77, 0xAE, 0x77, 0xF9, 0x75, 0x9F, 0xC7, 0x5D, 0xA9, 0xD9, 0x73, 0x9D, 0x90, 0xDA, 0x73, 0xAD,
+    0x1A, 0xD7, 0x3D, 0xA1, 0x9D, 0x97, 0x19, 0xD9, 0x2E, 0x71, 0xE3, 0xAD, 0x71, 0xDA, 0x39, 0xDA,
+    0x7A, 0xD9, 0x4E, 0x7E, 0x5A, 0xD9, 0x59, 0xDA, 0x6D, 0xA5, 0xFF, 0xFD, 0x5F, 0xFF, 0xDA, 0x3A,
+    0xFF, 0xFE, 0x3E, 0xA9, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x19, 0xE7, 0x1E, 0xA1, 0xAE, 0x71, 0xAE,
+    0x1E, 0xA7, 0x19, 0xE9, 0x77, 0x9F, 0xFC, 0xA4, 0x9F, 0xFE, 0x92, 0x9D, 0xA4, 0x9E, 0x29, 0xDA,
+    0x6D, 0xA1, 0x9D, 0xA6, 0xAD, 0x19, 0xDA, 0x6A, 0xCA, 0x19, 0xDA, 0x6D, 0xA1, 0x9E, 0xAA, 0xAA,
+    0xAA, 0xE2, 0x9F, 0xFD, 0xA3, 0x9F, 0xFE, 0xA2, 0x9D, 0xA5, 0x9E, 0x90, 0x9D, 0xA7, 0xE0, 0x9D,
+    0xA7, 0xAD, 0x99, 0xDA, 0x7A, 0xD9, 0x9D, 0xA7, 0xAD, 0xA9, 0xDA, 0x7E, 0xA9, 0xDA, 0x5A, 0xF9,
+    0x9F, 0xFF, 0xD9, 0x9F, 0xFF, 0xD0, 0x9F, 0xFF, 0xC1, 0x9F, 0xFD, 0xA9, 0x20, 0x77, 0x72, 0x9A,
+    0xAF, 0xA7, 0x9F, 0xFC, 0x6F, 0xFE, 0x5F, 0xA7, 0x3F, 0x97, 0x3A, 0xE9, 0x74, 0xE9, 0x74, 0x9E,
+    0x75, 0xAD, 0xA7, 0x5E, 0x97, 0x5E, 0x76, 0xE9, 0x75, 0xEA, 0x75, 0xF9, 0x74, 0xFC, 0xA7, 0x92,
+    0xFF, 0xAA, 0x9A, 0xAD, 0x29, 0xFF, 0xFD, 0x3F, 0xFF, 0xD3, 0x9F, 0xFF, 0xC5, 0xFF, 0xF6, 0x9F,
+    0xFA, 0x97, 0x72, 0x09, 0x99, 0x99, 0x99, 0x73, 0x9F, 0xFC, 0xA9, 0x79, 0xFF, 0xF9, 0x59, 0xFF,
+    0xFC, 0x94, 0x9D, 0xA4, 0x9A, 0xF9, 0x39, 0xDA, 0x7F, 0x39, 0xDA, 0x70, 0xF2, 0x9D, 0xA7, 0x09,
+    0xE9, 0x19, 0xDA, 0x71, 0xEA, 0x19, 0xDA, 0x71, 0xAE, 0x19, 0xDA, 0x71, 0x9E, 0x19, 0xDA, 0x71,
+    0x9E, 0x90, 0x9D, 0xA7, 0x19, 0xE9, 0x09, 0xDA, 0x71, 0x9E, 0x90, 0x9D, 0xA7, 0x1F, 0x90, 0x9D,
+    0xA7, 0x0A, 0xF1, 0x9E, 0x99, 0x99, 0x99, 0xAF, 0xE1, 0x9F, 0xFF, 0xF9, 0x19, 0xFF, 0xFF, 0x29,
+    0xFF, 0xFD, 0xA3, 0x9F, 0xFF, 0xC9, 0x49, 0xFF, 0xAA, 0x97, 0x77, 0x9F, 0xFF, 0x1A, 0xFF, 0xEA,
+    0x1A, 0xFD, 0xAA, 0xAA, 0xA2, 0xAD, 0x73, 0xAD, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3F, 0xFD, 0x4F,
+    0xFD, 0x4F, 0xFD, 0x4E, 0x97, 0x2E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x99, 0x99, 0x99, 0x99,
+    0x92, 0xFF, 0xFA, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x76, 0xFF, 0xDA, 0x1F, 0xFD,
+    0xA0, 0x9E, 0x99, 0x69, 0xDA, 0x70, 0x9D, 0xA7, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x0A, 0xFF, 0xC9,
+    0x1A, 0xFF, 0xC9, 0x1A, 0xFF, 0xC9, 0x1A, 0xDA, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9,
+    0x70, 0xEA, 0x70, 0xEA, 0x70, 0xEA, 0x70, 0xEA, 0x70, 0xEA, 0x70, 0xEA, 0x70, 0x72, 0x99, 0x97,
+    0x29, 0xAF, 0xFC, 0xA5, 0x9F, 0xFF, 0xC4, 0x9F, 0xA9, 0x59, 0xA4, 0xF9, 0x75, 0x9E, 0x97, 0x6F,
+    0x77, 0xEA, 0x77, 0xE9, 0x77, 0xE9, 0x77, 0xE9, 0x77, 0xE9, 0x59, 0xAA, 0x99, 0x4E, 0x95, 0x9F,
+    0xEA, 0x0E, 0x96, 0x9A, 0xFC, 0xA0, 0xEA, 0x71, 0x9D, 0xAA, 0x0F, 0x71, 0x9D, 0x2A, 0xF9, 0x7A,
+    0xD2, 0x9F, 0xDA, 0xAA, 0xAA, 0xAF, 0x3A, 0xFF, 0xFE, 0x4F, 0xFF, 0xE9, 0x4A, 0xFF, 0xFA, 0x79,
+    0xAF, 0xDA, 0x93, 0x77, 0x3A, 0xD9, 0x70, 0xE2, 0xAD, 0x97, 0x0E, 0x2E, 0x97, 0x0E, 0x2E, 0x97,
+    0x0E, 0x91, 0xE9, 0x70, 0xE9, 0x1E, 0x97, 0x0E, 0x91, 0xE9, 0x70, 0xE9, 0x1E, 0xA7, 0x0E, 0x91,
+    0xEA, 0x70, 0xE9, 0x1E, 0xA7, 0x0E, 0xA1, 0xEA, 0x70, 0xEA, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF, 0xFA,
+    0x1F, 0xFF, 0xFA, 0x1F, 0xFF, 0xFA, 0x1F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x1F, 0x79, 0xF1, 0xF7,
+    0x9F, 0x1F, 0x79, 0xF1, 0xF7, 0x9F, 0x09, 0xF7, 0x9F, 0x00, 0x49, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1,
+    0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xEA, 0x0E, 0xA9, 0xEA,
+    0x9F, 0x9F, 0x9F, 0x59, 0xE6, 0x9E, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAD, 0xA6,
+    0xAD, 0xA6, 0xAD, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96,
+    0xE7, 0xE7, 0xE6, 0xAE, 0x29, 0x1A, 0xF2, 0xFE, 0x92, 0xFE, 0x3F, 0xD9, 0x3F, 0xC6, 0x99, 0x60,
+    0x19, 0xDA, 0x3A, 0xE4, 0xAD, 0x92, 0x9E, 0x5A, 0xD9, 0x2E, 0xA5, 0xAD, 0x91, 0xAE, 0x6E, 0x2E,
+    0x96, 0xE1, 0xF7, 0xE0, 0x9E, 0x70, 0xE0, 0xEA, 0x70, 0xEA, 0xE7, 0x09, 0xFD, 0x97, 0x09, 0xFD,
+    0x71, 0x9F, 0xCA, 0x71, 0xAF, 0xD9, 0x70, 0xAF, 0xE9, 0x7A, 0xDA, 0xAF, 0x96, 0xEA, 0x0F, 0xC9,
+    0x5E, 0xA1, 0xFC, 0x94, 0xEA, 0x19, 0xFC, 0x93, 0xE9, 0x2A, 0xFC, 0x92, 0xE9, 0x3F, 0xD9, 0x1E,
+    0x94, 0xFD, 0x90, 0x76, 0x9D, 0xA7, 0x19, 0xDA, 0x71, 0x9D, 0xA7, 0x19, 0xDA, 0x71, 0x9D, 0xA7,
+    0x1A, 0xDA, 0x71, 0xAD, 0xA7, 0x1A, 0xD9, 0x71, 0xAD, 0x97, 0x1A, 0xD9, 0x71, 0xE9, 0x71, 0xE9,
+    0x71, 0xE9, 0x71, 0xE9, 0x71, 0xE9, 0x71, 0xE7, 0x2E, 0x70, 0x90, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0,
+    0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x77, 0x70, 0xF9, 0x70, 0xAE, 0xA3, 0xFC, 0x70, 0xFA, 0x29, 0xFC,
+    0x79, 0xFA, 0x29, 0xFC, 0xA6, 0xFD, 0x29, 0xFD, 0x6F, 0xD2, 0x9F, 0xD9, 0x4A, 0xFD, 0x29, 0xDA,
+    0xF4, 0xEA, 0xE2, 0xAD, 0x9F, 0x92, 0x9E, 0x9E, 0x2A, 0xD9, 0x9E, 0xA2, 0xF0, 0xE2, 0xAD, 0xA0,
+    0xF2, 0xE9, 0x9E, 0x91, 0xAD, 0xA0, 0xAE, 0xA0, 0xAE, 0x09, 0xE9, 0x1A, 0xDA, 0x09, 0xF0, 0xF0,
+    0x9E, 0x91, 0xEA, 0x1F, 0xAE, 0x90, 0xAE, 0xA1, 0xF1, 0x9F, 0xE1, 0xAE, 0xA1, 0xF2, 0xFD, 0xA1,
+    0xAE, 0xA1, 0xF2, 0xAF, 0xC9, 0x1A, 0xF1, 0xF3, 0xFC, 0x2F, 0xC1, 0xF3, 0xFA, 0x2F, 0xC1, 0xF3,
+    0x9E, 0x3F, 0xC1, 0xF7, 0x3F, 0xC1, 0xF7, 0x3F, 0xC0, 0x77, 0x49, 0x99, 0x97, 0x0E, 0x2A, 0xE9,
+    0x7E, 0x2F, 0xA7, 0xE2, 0xFC, 0x69, 0xE2, 0xFC, 0xA5, 0x9E, 0x2F, 0xD5, 0x9E, 0x2F, 0xDA, 0x4A,
+    0xE2, 0xE9, 0xE4, 0xAD, 0xA1, 0x9E, 0x0E, 0xA3, 0xAD, 0xA1, 0x9E, 0x09, 0xE3, 0xAD, 0xA1, 0x9E,
+    0x1E, 0xA2, 0xEA, 0x1A, 0xE1, 0x9E, 0x2E, 0xA1, 0xAE, 0x2E, 0x91, 0xE9, 0x1A, 0xE2, 0x9E, 0x1E,
+    0x91, 0xAE, 0x3E, 0x90, 0xE9, 0x1F, 0x3A, 0xE9, 0xE9, 0x1F, 0x93, 0xEA, 0xE9, 0x1F, 0x93, 0xAF,
+    0xD2, 0xF9, 0x4F, 0xD2, 0xF9, 0x4A, 0xFC, 0x2F, 0x95, 0xFC, 0x10, 0x59, 0xAF, 0xCA, 0x97, 0x09,
+    0xFF, 0xE6, 0xAF, 0xA9, 0x99, 0xFC, 0x93, 0x9F, 0x59, 0xF3, 0xF7, 0x9E, 0xA1, 0x9E, 0x71, 0xAE,
+    0x1E, 0xA7, 0x2E, 0x90, 0xE7, 0x3A, 0xDA, 0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x39, 0xE9, 0xDA, 0x74,
+    0xE0, 0xE7, 0x4D, 0xA0, 0xE7, 0x39, 0xDA, 0x0E, 0x97, 0x2E, 0xA0, 0xF9, 0x70, 0xAE, 0x90, 0x9F,
+    0xCA, 0x99, 0x99, 0x9A, 0xFC, 0x2F, 0xFF, 0xFA, 0x29, 0xFF, 0xFE, 0x4A, 0xFF, 0xFC, 0x95, 0xAF,
+    0xFE, 0x97, 0x09, 0xAF, 0xCA, 0x97, 0x77, 0x00, 0x09, 0xFF, 0xA4, 0x9F, 0xFD, 0xA2, 0x9D, 0x99,
+    0x99, 0x9A, 0xE9, 0x1A, 0xD6, 0xE1, 0xAD, 0x69, 0xD9, 0x0A, 0xD6, 0x9D, 0x90, 0xAD, 0x6A, 0xD9,
+    0x0E, 0x5A, 0xE1, 0xFF, 0xF9, 0x1F, 0xFE, 0xA2, 0xFF, 0xCA, 0x4E, 0xA7, 0x2E, 0x97, 0x2E, 0x97,
+    0x2E, 0xA7, 0x2E, 0xA7, 0x19, 0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xF7, 0x19, 0xF7, 0x19, 0xF7, 0x10,
+    0x77, 0x72, 0x9F, 0xDA, 0x97, 0x19, 0xFF, 0xDA, 0x79, 0xEA, 0x92, 0x9F, 0x59, 0xE9, 0x6A, 0xDA,
+    0x4E, 0x97, 0x0E, 0x92, 0x9E, 0x71, 0x9E, 0x2E, 0x97, 0x2E, 0x2E, 0x73, 0xAD, 0x90, 0x9E, 0x73,
+    0xAD, 0xA0, 0x9D, 0xA7, 0x39, 0xDA, 0x09, 0xDA, 0x73, 0x9D, 0xA0, 0x9D, 0xA7, 0x39, 0xDA, 0x09,
+    0xE7, 0x3A, 0xD9, 0x09, 0xE7, 0x3E, 0x91, 0xEA, 0x49, 0xA9, 0x2E, 0x2F, 0xA3, 0xFF, 0xC2, 0xAF,
+    0xFF, 0xF9, 0x3F, 0xFF, 0xF4, 0x9F, 0xFF, 0xD6, 0x9F, 0xFF, 0xA7, 0x09, 0xAF, 0xFD, 0x97, 0x59,
+    0xFD, 0x97, 0x59, 0xFD, 0x76, 0xAF, 0xD7, 0x69, 0x99, 0x99, 0x90, 0x19, 0x99, 0x99, 0x72, 0xFF,
+    0xA6, 0xFF, 0xD5, 0xD4, 0x9E, 0x4D, 0x59, 0xD3, 0x9D, 0x6D, 0x92, 0x9D, 0x6D, 0xA2, 0x9D, 0x59,
+    0xDA, 0x29, 0xD4, 0x9E, 0x92, 0xAD, 0xAA, 0xAA, 0xFC, 0x3A, 0xFF, 0xCA, 0x4A, 0xFF, 0xC9, 0x4A,
+    0xFF, 0xD9, 0x3F, 0x3A, 0xE3, 0xEA, 0x4A, 0xDA, 0x2F, 0x49, 0xE2, 0xF4, 0x9E, 0x2F, 0x49, 0xE9,
+    0x1F, 0x49, 0xEA, 0x1F, 0x49, 0xF1, 0xF4, 0x9F, 0x1F, 0x49, 0xF9, 0x59, 0xAF, 0xDA, 0x97, 0x0F,
+    0xFD, 0xA7, 0xFF, 0xEA, 0x6A, 0xFA, 0x93, 0x97, 0xEA, 0x77, 0xE7, 0x70, 0xE7, 0x70, 0xE7, 0x70,
+    0xFA, 0x97, 0x6F, 0xEA, 0x97, 0x29, 0xFF, 0xD7, 0x29, 0xFF, 0xCA, 0x73, 0x99, 0xFE, 0x76, 0xFC,
+    0xA7, 0x59, 0xFC, 0x75, 0x9F, 0xC9, 0x29, 0x97, 0xFD, 0x92, 0xFF, 0xFF, 0x2F, 0xFF, 0xF9, 0x1A,
+    0xFF, 0xFE, 0xA2, 0xFF, 0xFE, 0x94, 0x9A, 0xFF, 0xAA, 0x77, 0x71, 0x9F, 0xFF, 0xFC, 0x09, 0xFF,
+    0xFF, 0xC0, 0x9F, 0xCA, 0xAE, 0xAA, 0xAF, 0x70, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E,
+    0x77, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x6A, 0xE7, 0x6A, 0xE9,
+    0x75, 0xAE, 0x97, 0x5A, 0xE9, 0x75, 0xAE, 0x97, 0x5A, 0xE9, 0x60, 0x09, 0x99, 0x71, 0x99, 0x91,
+    0xF7, 0xAE, 0xA0, 0xEA, 0x7A, 0xEA, 0x0E, 0xA7, 0xAE, 0x90, 0xEA, 0x7A, 0xE9, 0x0E, 0xA7, 0x9E,
+    0x90, 0xEA, 0x79, 0xE9, 0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79,
+    0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xEA, 0x79, 0xE1, 0xAE, 0x7A, 0xE1,
+    0xAE, 0xA5, 0x9F, 0x19, 0xFC, 0xAA, 0xAA, 0xFC, 0xA1, 0x9F, 0xFF, 0xD9, 0x2F, 0xFF, 0xD3, 0x9F,
+    0xFF, 0x95, 0xAF, 0xFA, 0x97, 0x74, 0x77, 0x5E, 0x73, 0x9E, 0x1A, 0xDA, 0x72, 0xAD, 0xA1, 0x9E,
+    0x72, 0xE9, 0x2E, 0x97, 0x09, 0xE3, 0xEA, 0x70, 0xEA, 0x39, 0xE7, 0x9E, 0x94, 0xE9, 0x6A, 0xE5,
+    0xF6, 0xEA, 0x5A, 0xE5, 0xAE, 0x96, 0xEA, 0x4F, 0x7F, 0x39, 0xEA, 0x7A, 0xE9, 0x2A, 0xE9, 0x79,
+    0xEA, 0x2F, 0x71, 0xF1, 0xAE, 0xA7, 0x1A, 0xE9, 0x0F, 0x97, 0x19, 0xFF, 0xC7, 0x3F, 0xFA, 0x73,
+    0xAF, 0xE9, 0x73, 0x9F, 0xE7, 0x5F, 0xDA, 0x75, 0xAF, 0xC9, 0x60, 0x0E, 0x77, 0x2A, 0xDA, 0x0E,
+    0x97, 0x71, 0xE9, 0x0A, 0xDA, 0x77, 0x1E, 0x1A, 0xE7, 0x70, 0x9E, 0x19, 0xE7, 0x70, 0xAD, 0xA2,
+    0xE9, 0x77, 0xE9, 0x2E, 0xA5, 0xE6, 0xE3, 0xAE, 0x49, 0xEA, 0x49, 0xE3, 0x9E, 0x4F, 0xC4, 0xEA,
+    0x4E, 0x92, 0x9F, 0xCA, 0x3E, 0x94, 0xEA, 0x2F, 0xE2, 0x9E, 0x5A, 0xE1, 0xAE, 0xAE, 0xA1, 0xAE,
+    0x5A, 0xE1, 0xF0, 0xAE, 0x1E, 0xA5, 0x9E, 0x0A, 0xEA, 0x1E, 0xA0, 0xE9, 0x6E, 0xAF, 0x91, 0xF9,
+    0xE7, 0xFF, 0x29, 0xFE, 0x7A, 0xFD, 0x93, 0xFD, 0xA7, 0x9F, 0xD4, 0xAF, 0xCA, 0x70, 0xFC, 0xA4,
+    0x9F, 0xC9, 0x70, 0xFC, 0x95, 0xFC, 0x71, 0xFC, 0x6A, 0xF4, 0x77, 0x5E, 0x71, 0x9D, 0x93, 0xE7,
+    0x0E, 0x4A, 0xDA, 0x6E, 0x6E, 0x5A, 0xDA, 0x69, 0xE3, 0x9E, 0x70, 0xAD, 0xA2, 0xE9, 0x71, 0xE9,
+    0x0A, 0xDA, 0x72, 0x9E, 0xAE, 0x74, 0xFD, 0x97, 0x5F, 0xC7, 0x6F, 0x97, 0x59, 0xFC, 0x75, 0xFD,
+    0xA7, 0x3F, 0xF9, 0x71, 0xAE, 0xA0, 0xF7, 0x09, 0xF1, 0xAE, 0xA7, 0xF9, 0x2F, 0x95, 0xAF, 0x39,
+    0xF4, 0x9F, 0x5A, 0xF3, 0xFA, 0x6F, 0xA1, 0xFC, 0x79, 0xF9, 0x0E, 0x71, 0xAD, 0xA0, 0xAD, 0xA7,
+    0x0E, 0x2E, 0x7A, 0xDA, 0x2A, 0xE6, 0xE4, 0xE9, 0x4E, 0xA4, 0xAE, 0x39, 0xE6, 0xE9, 0x2E, 0xA6,
+    0xAE, 0x1A, 0xE7, 0x0E, 0xA0, 0xEA, 0x70, 0xAF, 0xE7, 0x2F, 0xDA, 0x72, 0xAF, 0xC7, 0x4F, 0xA7,
+    0x4F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4F, 0xC7, 0x4F, 0xC6, 0x2F, 0xFF,
+    0xF3, 0x9F, 0xFF, 0xE4, 0xFF, 0xFE, 0x49, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xA7, 0x5A, 0xF9, 0x74,
+    0xAF, 0x97, 0x4A, 0xFA, 0x74, 0xAF, 0xA7, 0x4A, 0xFA, 0x74, 0xAF, 0xC7, 0x4A, 0xFC, 0x74, 0xAF,
+    0xC7, 0x4A, 0xFC, 0x74, 0xAF, 0xC9, 0x73, 0xAF, 0xC9, 0x73, 0xAF, 0xCA, 0x73, 0xAF, 0xCA, 0x73,
+    0x9F, 0xFF, 0xFC, 0x90, 0x9F, 0xFF, 0xFC, 0xA0, 0x9F, 0xFF, 0xFD, 0x09, 0xFF, 0xFF, 0xD9, 0x29,
+    0x99, 0x99, 0x91, 0x9F, 0xD1, 0x9F, 0xD1, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5E, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA4, 0x9D, 0x94, 0x9D, 0x94, 0x9D,
+    0x94, 0x9D, 0x94, 0x9D, 0x94, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x5F, 0xE1, 0xFD, 0xA1, 0xFD, 0xA0, 0x09, 0x7A, 0x7C, 0x96, 0xD6, 0xAC, 0x69, 0xCA, 0x6D, 0x6A,
+    0xC9, 0x59, 0xCA, 0x6D, 0x6D, 0x95, 0xAD, 0x6D, 0x6D, 0xA5, 0xAD, 0x59, 0xD9, 0x5D, 0xA5, 0xAD,
+    0x59, 0xD9, 0x5D, 0xA5, 0xD9, 0x5A, 0xC7, 0xA7, 0x10, 0x09, 0x99, 0x99, 0x92, 0xFD, 0x2F, 0xD5,
+    0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x95, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5,
+    0xDA, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0x9D, 0x94,
+    0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x95, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA1, 0xFD, 0xA1,
+    0xFE, 0x1F, 0xE0, 0x4A, 0xA7, 0xAD, 0x95, 0x9F, 0x93, 0x9C, 0xA1, 0xAC, 0x91, 0xAC, 0x49, 0xC9,
+    0x19, 0x99, 0x99, 0x99, 0x99, 0x95, 0xFF, 0xFF, 0x0F, 0xFF, 0xEA, 0x77, 0x00, 0x0D, 0x95, 0xDA,
+    0x5E, 0x59, 0xAA, 0x00, 0x77, 0x19, 0xAE, 0x99, 0xC4, 0xAF, 0xF9, 0x2A, 0xDA, 0x99, 0xAE, 0x92,
+    0xD9, 0x39, 0xDA, 0x1A, 0xCA, 0x5D, 0xA1, 0xD6, 0xE1, 0xD6, 0xAD, 0x1D, 0x6E, 0x1D, 0x6E, 0x1D,
+    0xA3, 0x9F, 0x1F, 0xFF, 0x90, 0x9F, 0xFE, 0x91, 0xAF, 0xE9, 0xD9, 0x29, 0xAE, 0xA1, 0xDA, 0x77,
+    0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xAD, 0x73, 0xAD, 0x1A, 0xDA, 0x94, 0xAD,
+    0xAF, 0xE3, 0xAF, 0xCA, 0x9A, 0xE2, 0x9F, 0x4D, 0xA1, 0x9E, 0x59, 0xD1, 0x9E, 0x6D, 0xA0, 0x9E,
+    0x6D, 0xA0, 0x9E, 0x6D, 0xA1, 0xE5, 0x9D, 0x91, 0xEA, 0x39, 0xE2, 0xFC, 0xAA, 0xFA, 0x2F, 0xFE,
+    0x4F, 0xFC, 0x6F, 0xDA, 0x72, 0x99, 0x50, 0x77, 0xAF, 0xA3, 0x9F, 0xE3, 0xEA, 0x29, 0x2A, 0xD9,
+    0x7E, 0x70, 0xDA, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xDA, 0x70, 0xE9, 0x7A, 0xEA, 0x7F, 0xF9, 0x29,
+    0xFF, 0x49, 0xAF, 0xA9, 0x73, 0x73, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x39, 0xD6, 0xAA,
+    0x91, 0x9D, 0x4A, 0xFC, 0x99, 0xD3, 0xFF, 0xAD, 0x2A, 0xD9, 0x19, 0xFC, 0x2D, 0x5F, 0x1A, 0xCA,
+    0x5A, 0xE1, 0xD9, 0x5A, 0xDA, 0x1D, 0x95, 0x9D, 0xA1, 0xD9, 0x5A, 0xDA, 0x1D, 0xA5, 0xEA, 0x1E,
+    0xA9, 0x19, 0xFA, 0x19, 0xFF, 0xF2, 0xFF, 0xF3, 0xAF, 0xEA, 0xD4, 0x9A, 0xEA, 0x09, 0xD7, 0x70,
+    0x4A, 0xEA, 0x69, 0xFE, 0x93, 0x9D, 0x93, 0xAC, 0x3D, 0x95, 0xD1, 0x9C, 0xA6, 0xD1, 0xAD, 0xAA,
+    0xFE, 0xA0, 0xFF, 0xFA, 0x0D, 0x99, 0x97, 0x0D, 0x97, 0x2D, 0xA7, 0x2E, 0xA7, 0x2F, 0xA9, 0x99,
+    0x9A, 0xC2, 0xAF, 0xFD, 0x39, 0xFF, 0xC5, 0xAA, 0xF9, 0x10, 0x39, 0xAD, 0xA2, 0x9F, 0xA2, 0xDA,
+    0x5D, 0x6D, 0x6D, 0x4F, 0xF0, 0xFF, 0x19, 0xD9, 0x5D, 0x95, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49,
+    0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x4A, 0xDA, 0x20, 0x3A, 0xE9,
+    0x1D, 0x92, 0xFD, 0xA9, 0xD2, 0xEA, 0xAF, 0xD1, 0x9D, 0x3A, 0xF1, 0xD9, 0x4F, 0x1D, 0x59, 0xE1,
+    0xD5, 0x9E, 0x1D, 0x59, 0xE1, 0xD5, 0xAE, 0x1D, 0xA3, 0x9F, 0x19, 0xFF, 0xE2, 0xFF, 0xE3, 0xFF,
+    0xCA, 0x4A, 0xE9, 0x0D, 0xA7, 0x19, 0xD9, 0x71, 0xE9, 0x2C, 0x92, 0x9F, 0x3F, 0xFC, 0xA2, 0x9F,
+    0xFC, 0x39, 0xAF, 0xDA, 0x70, 0x99, 0x95, 0x1A, 0xCA, 0x72, 0xD9, 0x72, 0xD9, 0x72, 0xD9, 0x72,
+    0xD9, 0x72, 0xD7, 0x3D, 0x73, 0xD1, 0x9A, 0xA9, 0x49, 0xD9, 0xFD, 0x92, 0x9F, 0xFD, 0x91, 0x9F,
+    0x29, 0xDA, 0x19, 0xE4, 0x9D, 0x1A, 0xD9, 0x5D, 0x1A, 0xD6, 0xD1, 0xAD, 0x6D, 0x90, 0xE6, 0xD9,
+    0x0E, 0x6D, 0x90, 0xE6, 0xD9, 0x0E, 0x59, 0xDA, 0x0E, 0x94, 0xAD, 0xA0, 0xE9, 0x4A, 0xDA, 0x0A,
+    0xD1, 0xE9, 0x0E, 0x99, 0xEA, 0x77, 0x49, 0xCA, 0x19, 0xCA, 0x19, 0xCA, 0x19, 0xCA, 0x19, 0xCA,
+    0x19, 0xCA, 0x19, 0xCA, 0x1A, 0xCA, 0x1A, 0xD1, 0xAD, 0x1E, 0x1E, 0x1E, 0x1E, 0x90, 0x59, 0xD9,
+    0x5A, 0xDA, 0x5E, 0xA5, 0xF7, 0x77, 0x74, 0xAA, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x69, 0xD6,
+    0x9D, 0x69, 0xD6, 0x9D, 0x69, 0xCA, 0x69, 0xCA, 0x6A, 0xCA, 0x6A, 0xCA, 0x6D, 0x94, 0x9E, 0x91,
+    0x9F, 0xD2, 0xFD, 0x39, 0x99, 0x94, 0x1D, 0x97, 0x2D, 0x97, 0x19, 0xD7, 0x29, 0xD7, 0x29, 0xD7,
+    0x29, 0xD7, 0x29, 0xD7, 0x2A, 0xD2, 0xDA, 0x4A, 0xD1, 0xE5, 0xAD, 0x0E, 0x6A, 0xDA, 0xD9, 0x6A,
+    0xFA, 0x7F, 0xC7, 0x0F, 0xD7, 0xFE, 0x6E, 0x0F, 0x5E, 0x09, 0xF4, 0xE1, 0xAF, 0x3E, 0x2A, 0xF2,
+    0xE3, 0xFC, 0x00, 0x79, 0xD3, 0x9D, 0x3A, 0xD3, 0xAD, 0x3D, 0xA3, 0xDA, 0x3D, 0xA3, 0xD9, 0x3D,
+    0x93, 0xD9, 0x3D, 0x92, 0x9D, 0x92, 0x9D, 0x92, 0x9D, 0x92, 0x9D, 0x92, 0x9D, 0x92, 0x9D, 0x92,
+    0x9F, 0xC0, 0x9F, 0xC9, 0x9F, 0xCA, 0x1A, 0xCA, 0x09, 0xEA, 0x39, 0xEA, 0x4A, 0xCA, 0xAF, 0xD9,
+    0x0A, 0xFC, 0xA3, 0xFC, 0xA9, 0xAE, 0x9D, 0xAA, 0xAD, 0x92, 0xF3, 0x9F, 0x3A, 0xCA, 0x2E, 0x5E,
+    0x94, 0xD2, 0xE5, 0xAD, 0x5D, 0x19, 0xDA, 0x5A, 0xD5, 0xD1, 0x9D, 0xA5, 0xDA, 0x5D, 0x1A, 0xD9,
+    0x5D, 0xA4, 0x9D, 0x1A, 0xD9, 0x5D, 0xA4, 0x9D, 0x1E, 0x94, 0x9D, 0x94, 0xAD, 0x90, 0xE5, 0xAD,
+    0x94, 0xAD, 0x90, 0xE5, 0xE5, 0xE9, 0x0E, 0x5E, 0x5E, 0x90, 0x1C, 0xA0, 0x9E, 0xA4, 0x9F, 0xFC,
+    0x92, 0x9F, 0x90, 0x9E, 0x29, 0xE4, 0xDA, 0x1A, 0xD9, 0x4A, 0xCA, 0x1A, 0xD5, 0xAD, 0x1A, 0xD5,
+    0xAD, 0x1A, 0xD5, 0xAD, 0x1E, 0x94, 0xE1, 0xE9, 0x4E, 0x1E, 0x94, 0xE9, 0x0E, 0x94, 0xE9, 0x0E,
+    0x94, 0xE9, 0x0E, 0x94, 0xE9, 0x39, 0xAE, 0xA6, 0xAF, 0xEA, 0x3E, 0xA9, 0x09, 0xAD, 0x91, 0x9D,
+    0x59, 0xD1, 0xDA, 0x6D, 0x90, 0xD9, 0x6D, 0xA0, 0xD9, 0x6A, 0xD0, 0xD9, 0x6A, 0xD0, 0xDA, 0x6D,
+    0xA0, 0xE9, 0x4A, 0xD9, 0x09, 0xFC, 0xAF, 0xC2, 0xFF, 0xD9, 0x3A, 0xFE, 0x95, 0x9F, 0xA3, 0x29,
+    0x2A, 0xAC, 0xA9, 0x4A, 0xCA, 0x0F, 0xDA, 0x3A, 0xFC, 0x90, 0x9D, 0xA2, 0x9F, 0x4D, 0x29, 0xE5,
+    0xAC, 0xA1, 0x9E, 0x59, 0xD1, 0x9D, 0xA5, 0x9D, 0x19, 0xE5, 0x9D, 0x19, 0xE5, 0x9D, 0x19, 0xF4,
+    0xDA, 0x1A, 0xFC, 0xA9, 0xAE, 0x91, 0xAF, 0xFE, 0x2E, 0xAF, 0xE3, 0xDA, 0x0A, 0xFC, 0x39, 0xDA,
+    0x39, 0x5A, 0xD9, 0x72, 0xAD, 0x97, 0x2E, 0x73, 0xE7, 0x29, 0xE7, 0x77, 0x10, 0x69, 0x74, 0xAF,
+    0xA0, 0xAD, 0x5E, 0xAA, 0xDA, 0xAD, 0x4E, 0x3F, 0xC3, 0x9D, 0x5F, 0x3D, 0xA5, 0xEA, 0x3D, 0x95,
+    0xEA, 0x3D, 0x6E, 0x93, 0xD6, 0xE9, 0x3D, 0x59, 0xE9, 0x3D, 0xA4, 0xF4, 0x9E, 0xAA, 0xAF, 0xC5,
+    0xAF, 0xFD, 0x6A, 0xFD, 0x9D, 0x79, 0xAD, 0xA9, 0x0D, 0x76, 0xD7, 0x59, 0xD9, 0xAC, 0xA7, 0x19,
+    0xFC, 0x97, 0x19, 0xFC, 0x72, 0xAC, 0xA9, 0x77, 0x30, 0x1D, 0x1A, 0xAC, 0x91, 0xDA, 0xF9, 0x1F,
+    0xEA, 0x1F, 0x5E, 0x6E, 0x6E, 0x6E, 0x59, 0xE5, 0x9E, 0x5A, 0xE5, 0xAE, 0x5F, 0x5F, 0x93, 0x3A,
+    0xFC, 0xA4, 0xFF, 0x3D, 0x97, 0x1D, 0x72, 0xD9, 0x71, 0xAE, 0x97, 0x0F, 0xDA, 0x69, 0xAF, 0xC9,
+    0x70, 0x9E, 0x71, 0xE9, 0x19, 0xDA, 0xAA, 0xAE, 0x90, 0x9F, 0xFD, 0x1F, 0xFD, 0xA2, 0x9A, 0xFC,
+    0xA9, 0x10, 0x77, 0xAC, 0x7A, 0xD7, 0xE7, 0xE4, 0x9A, 0xAE, 0xAA, 0xA9, 0x0F, 0xFD, 0x3D, 0xA7,
+    0xDA, 0x7D, 0xA7, 0xDA, 0x69, 0xDA, 0x69, 0xDA, 0x69, 0xD9, 0x69, 0xDA, 0x69, 0xE9, 0x99, 0x39,
+    0xFD, 0xA2, 0xAF, 0xDA, 0x29, 0xFE, 0x0D, 0x95, 0xDA, 0x1D, 0x95, 0xDA, 0x1D, 0x95, 0xDA, 0x1D,
+    0x95, 0xE1, 0xDA, 0x5E, 0x1D, 0xA5, 0xE1, 0xDA, 0x5E, 0x1A, 0xD5, 0xE1, 0xAD, 0x5E, 0x1A, 0xD9,
+    0x3F, 0x19, 0xFF, 0xE2, 0xFF, 0xE2, 0xFF, 0xAD, 0x3F, 0xD9, 0xAD, 0x59, 0x99, 0x50, 0x0A, 0xA7,
+    0x1A, 0xA9, 0x0A, 0xD7, 0x9D, 0x2D, 0x96, 0xDA, 0x2E, 0x6D, 0x39, 0xD9, 0x4A, 0xD4, 0xE4, 0xD9,
+    0x49, 0xD9, 0x2A, 0xD6, 0xE2, 0xD9, 0x6A, 0xD9, 0x0A, 0xD7, 0x0E, 0x0D, 0xA7, 0x0A, 0xFC, 0x71,
+    0x9F, 0xC7, 0x2F, 0xC7, 0x2F, 0xA4, 0x0A, 0xAA, 0x73, 0xAA, 0xA1, 0xE7, 0x3E, 0x1A, 0xD9, 0x71,
+    0x9D, 0xA1, 0x9D, 0xA7, 0x1A, 0xD9, 0x2E, 0x3D, 0x3E, 0x3E, 0x2A, 0xDA, 0x2E, 0x3A, 0xD9, 0x09,
+    0xF9, 0x09, 0xDA, 0x39, 0xDA, 0x0F, 0xD0, 0xAD, 0x94, 0xFF, 0xFD, 0x5F, 0xFF, 0xD5, 0xAF, 0xCA,
+    0xAF, 0xCA, 0x59, 0xFC, 0x1F, 0xC7, 0xF9, 0x19, 0xF7, 0xAD, 0xA3, 0xEA, 0x30, 0x2E, 0x49, 0xDA,
+    0x39, 0xDA, 0x3E, 0x5E, 0x91, 0xE7, 0xE0, 0xAD, 0x97, 0x9F, 0xCA, 0x71, 0xFC, 0x72, 0x9E, 0x97,
+    0x2F, 0xC7, 0x1A, 0xFC, 0xA7, 0xAE, 0x9E, 0x95, 0x9E, 0x1A, 0xE5, 0xE9, 0x2E, 0xA3, 0xEA, 0x39,
+    0xE9, 0x1F, 0x5A, 0xE0, 0x0D, 0x96, 0x9D, 0x19, 0xD6, 0xAD, 0x2D, 0xA5, 0xDA, 0x29, 0xD9, 0x39,
+    0xD9, 0x3E, 0x3A, 0xD4, 0x9D, 0x92, 0xE5, 0xE1, 0x9D, 0xA5, 0x9D, 0xA0, 0xAD, 0x96, 0xE9, 0xE7,
+    0x9F, 0xD7, 0x0F, 0xCA, 0x70, 0x9F, 0x97, 0x1F, 0x72, 0xF7, 0x2E, 0xA7, 0x1A, 0xE9, 0x79, 0xFC,
+    0x59, 0xFE, 0x69, 0xFD, 0x79, 0xF9, 0x77, 0x60, 0x2F, 0xFD, 0x92, 0xFF, 0xD9, 0x29, 0x99, 0x99,
+    0x99, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xEA, 0x70, 0xEA, 0x70, 0xEA, 0x79, 0xEA, 0x79, 0xEA,
+    0x79, 0xEA, 0x70, 0xAF, 0xFD, 0x2F, 0xFE, 0xA1, 0xFF, 0xF0, 0x59, 0xAA, 0xAA, 0x5F, 0xD4, 0x9D,
+    0xA7, 0xAD, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xDA, 0x79, 0xD9, 0x5A, 0xF6, 0xE9, 0x7F,
+    0x97, 0x0E, 0x70, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0xAD, 0x97, 0xAD, 0x70, 0x9D, 0x97, 0x9E,
+    0xAA, 0x95, 0xFC, 0xA6, 0xAF, 0x75, 0x49, 0xC9, 0x09, 0xC9, 0x09, 0xC9, 0x09, 0xC9, 0x0A, 0xC1,
+    0xAC, 0x1A, 0xC1, 0xAC, 0x1A, 0xC1, 0xAC, 0x1A, 0xC1, 0xAC, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1C, 0xA0, 0x0A, 0xAA, 0xA9, 0x6F, 0xD7, 0x0A, 0xD9, 0x70, 0xDA, 0x70, 0xE7, 0x0E,
+    0x70, 0xE7, 0x0E, 0x70, 0xAD, 0x70, 0x9D, 0x97, 0x0F, 0xA7, 0x9E, 0x69, 0xF6, 0xE7, 0x9D, 0x97,
+    0x9D, 0x97, 0x9D, 0x97, 0x0D, 0xA7, 0x0D, 0xA7, 0x9D, 0x94, 0x99, 0xAE, 0x94, 0xAF, 0xC5, 0xFA,
+    0x77, 0x00, 0x09, 0xD9, 0x2C, 0x1C, 0xAA, 0xC2, 0xC0, 0x9C, 0x1A, 0xC0, 0x9C, 0x09, 0xC2, 0xEA,
+    0x19, 0x39, 0x91, 0xFC, 0x0A, 0xF0, 0x9F, 0x1E, 0xA1, 0xEA, 0x72, 0x91, 0x9E, 0x19, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0x9D, 0x29, 0xD2, 0x9D,
+    0x3D, 0x39, 0xA0, 0x59, 0x97, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0xAF, 0xC3, 0x9F, 0xE3, 0xE9,
+    0xD0, 0x92, 0xAD, 0x90, 0xCA, 0x4E, 0x1C, 0xA4, 0xD9, 0x1C, 0xA4, 0xD9, 0x1C, 0xA4, 0xD9, 0x1C,
+    0xA4, 0xDA, 0x1C, 0xA4, 0xE9, 0x0C, 0xA4, 0xAE, 0xAC, 0x95, 0xFF, 0x93, 0xFF, 0x49, 0xFC, 0xA9,
+    0x49, 0xC9, 0x70, 0x9C, 0x97, 0x19, 0x40, 0x77, 0x77, 0x4A, 0xFA, 0x7A, 0xFF, 0x94, 0xFA, 0x90,
+    0x9A, 0xD9, 0x3D, 0xA6, 0xA4, 0xD7, 0x5D, 0x75, 0xD9, 0x74, 0xAC, 0xA7, 0x5D, 0x75, 0xD9, 0x74,
+    0xAC, 0xA7, 0x49, 0xD7, 0x2A, 0xFF, 0xD9, 0x3A, 0xFF, 0xD9, 0x49, 0x9A, 0xD9, 0x99, 0x99, 0x79,
+    0xD9, 0x73, 0xE7, 0x3F, 0x70, 0x9A, 0xEA, 0x71, 0xFC, 0xAA, 0xAA, 0xA9, 0x93, 0xFF, 0xFD, 0x1F,
+    0xFF, 0xE0, 0x77, 0x9C, 0x59, 0xC3, 0xEA, 0xDA, 0xAE, 0x2A, 0xFF, 0xC9, 0x3D, 0xA2, 0xDA, 0x39,
+    0xD3, 0x9D, 0x3A, 0xD4, 0xD9, 0x2A, 0xD3, 0x9D, 0x39, 0xE1, 0x9E, 0x39, 0xFF, 0xC2, 0x9F, 0xFE,
+    0x1A, 0xDA, 0xAE, 0x9A, 0xD9, 0x1A, 0xA6, 0xA9, 0x76, 0x0A, 0xD7, 0x0D, 0xA2, 0xE6, 0xE4, 0xE4,
+    0xAD, 0x94, 0x9D, 0xA2, 0xAD, 0xA6, 0xAD, 0xA0, 0xAE, 0x70, 0xFE, 0x72, 0xFC, 0x97, 0x29, 0xEA,
+    0x74, 0xE7, 0x1F, 0xFD, 0x6F, 0xFD, 0x97, 0x09, 0xE7, 0x49, 0xE7, 0x49, 0xE7, 0x49, 0xFD, 0x6F,
+    0xFD, 0xA5, 0xDA, 0xF7, 0x49, 0xE7, 0x49, 0xE7, 0x49, 0xE7, 0x77, 0x49, 0xC9, 0x09, 0xC9, 0x09,
+    0xC9, 0x09, 0xC9, 0x09, 0xC1, 0xAC, 0x1A, 0xC2, 0x97, 0x69, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1C, 0xA0, 0x69, 0xA9, 0x71, 0xAF, 0xD6, 0xAC, 0xA2, 0x9D, 0x5C, 0x95, 0xA5, 0xC9,
+    0x74, 0xD7, 0x4A, 0xE9, 0x71, 0xAF, 0xDA, 0x5F, 0xFD, 0x39, 0xDA, 0x92, 0x9D, 0xA2, 0xAC, 0xA5,
+    0x9D, 0x2A, 0xC9, 0x59, 0xD2, 0xAD, 0xA9, 0x3E, 0x3F, 0xFE, 0x4A, 0xFF, 0x79, 0x9F, 0xA7, 0x2A,
+    0xE7, 0x29, 0xEA, 0x29, 0xA9, 0x99, 0x99, 0xF9, 0x2F, 0xFE, 0x2F, 0xFE, 0x39, 0xAF, 0xDA, 0x97,
+    0x72, 0x74, 0xE3, 0xDA, 0x1E, 0x29, 0xE0, 0x9E, 0x2A, 0xE0, 0xAE, 0x91, 0xF0, 0x39, 0xAA, 0x94,
+    0x9C, 0x91, 0xAA, 0x3C, 0x09, 0xCA, 0x09, 0xA1, 0xA0, 0x9C, 0x3C, 0x1C, 0x0A, 0x93, 0xA9, 0x0C,
+    0x0A, 0x93, 0x99, 0x0C, 0x09, 0xC9, 0x2A, 0x19, 0xA0, 0xAD, 0x1C, 0x2A, 0xA2, 0x9C, 0x49, 0xAC,
+    0xA9, 0x20, 0x71, 0x9D, 0xAC, 0x19, 0xC9, 0x0D, 0x1A, 0x92, 0xC1, 0xC3, 0xC1, 0xC3, 0xC9, 0x0C,
+    0x91, 0xD9, 0x0A, 0xFC, 0xA1, 0xAD, 0x9A, 0xA0, 0x59, 0x93, 0x94, 0x9C, 0x92, 0xAC, 0x3A, 0xD2,
+    0xDA, 0x2A, 0xD2, 0xDA, 0x2D, 0xA1, 0x9D, 0x92, 0xAD, 0x2D, 0x93, 0xEA, 0x09, 0xE4, 0xEA, 0x09,
+    0xE4, 0xAD, 0xA0, 0x9E, 0x4A, 0xD1, 0x9D, 0xA4, 0xAC, 0x29, 0xC9, 0x59, 0x50, 0x0E, 0xAA, 0xA9,
+    0x99, 0x3F, 0xFE, 0x19, 0x99, 0x99, 0x9A, 0xAE, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D,
+    0x75, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x39, 0xAA, 0x94, 0x9C,
+    0x91, 0xAA, 0x3C, 0x0A, 0xA9, 0x09, 0x91, 0xA9, 0x0A, 0x0A, 0x90, 0xC1, 0xC1, 0xA0, 0xA1, 0xA9,
+    0x0C, 0x1E, 0x19, 0x90, 0xC1, 0xC0, 0xAA, 0x0A, 0x19, 0xA0, 0xC0, 0x9C, 0x9C, 0x2A, 0xA2, 0xAC,
+    0x49, 0xAC, 0xA9, 0x20, 0x39, 0x99, 0x9A, 0x1A, 0xFE, 0xA7, 0x10, 0x76, 0x9A, 0xDA, 0x5F, 0xE9,
+    0x2A, 0xD2, 0x9D, 0x2D, 0x4A, 0xCA, 0x09, 0xD5, 0xD0, 0xAD, 0x49, 0xD0, 0x9D, 0x93, 0xAD, 0x1E,
+    0x91, 0xAD, 0xA1, 0xAF, 0xF3, 0xAF, 0xD5, 0x9A, 0xCA, 0x93, 0x5D, 0x72, 0xD7, 0x2D, 0x72, 0xD5,
+    0xFF, 0xE9, 0x09, 0x99, 0x99, 0xDA, 0x99, 0x96, 0xD7, 0x2D, 0x72, 0xD7, 0x77, 0x72, 0x99, 0x99,
+    0xAA, 0xA9, 0x1A, 0xFF, 0xD1, 0x99, 0x99, 0x70, 0x0A, 0xE9, 0x19, 0x19, 0xC5, 0xC5, 0xC4, 0xCA,
+    0x29, 0xD2, 0x9D, 0x3F, 0xC9, 0x0A, 0xAA, 0xAA, 0x00, 0x09, 0xEA, 0x5A, 0x95, 0xA4, 0xA9, 0x19,
+    0xDA, 0x5C, 0xA4, 0x9C, 0x4A, 0xC0, 0xAF, 0x90, 0x9A, 0xCA, 0x90, 0x19, 0xC9, 0x1D, 0x19, 0xD1,
+    0xAC, 0x91, 0xD1, 0x0A, 0xD9, 0x5D, 0xA1, 0xAD, 0x95, 0xDA, 0x1A, 0xD9, 0x5D, 0xA1, 0xE9, 0x5E,
+    0x1E, 0xA5, 0xE1, 0xEA, 0x5E, 0x1E, 0xA5, 0xE1, 0xF5, 0xE1, 0xF5, 0xE1, 0xF9, 0x3F, 0x1F, 0xFF,
+    0xC1, 0xFF, 0xFC, 0x1C, 0xAF, 0xFA, 0xD1, 0xCA, 0x0F, 0xD9, 0xAD, 0x1C, 0xA2, 0x99, 0x96, 0xCA,
+    0x74, 0xA9, 0x73, 0x77, 0xAE, 0x2D, 0x2F, 0xC2, 0xD1, 0xAF, 0xC2, 0xD1, 0xFD, 0x2D, 0x1F, 0xCA,
+    0x2D, 0x1F, 0xCA, 0x2D, 0x19, 0xFA, 0x2D, 0x2A, 0xEA, 0x2D, 0x3A, 0xD9, 0x2D, 0x3E, 0x92, 0xD3,
+    0xE9, 0x2A, 0xC3, 0xE3, 0xAC, 0x29, 0xE3, 0xAC, 0x2A, 0xE3, 0xAC, 0x2F, 0x3A, 0xC9, 0x1F, 0x3A,
+    0xC9, 0x1F, 0x3A, 0xC9, 0x09, 0xF3, 0xAC, 0x90, 0xAE, 0xA3, 0xAC, 0x90, 0xAE, 0xA3, 0xAC, 0x90,
+    0x5E, 0x1E, 0x09, 0xE0, 0xAE, 0x90, 0x1A, 0x3A, 0x93, 0xCA, 0xA9, 0x4C, 0x4A, 0x90, 0x99, 0xAC,
+    0x1E, 0x90, 0x79, 0xD3, 0x90, 0xC5, 0xC5, 0xC5, 0xC4, 0x9C, 0x49, 0xC3, 0xFC, 0x1A, 0xAA, 0xAA,
+    0x00, 0x19, 0xE2, 0x9C, 0x90, 0x9C, 0x1C, 0x92, 0xC9, 0x0C, 0x92, 0xAA, 0x0C, 0x92, 0xAA, 0x0C,
+    0xA2, 0xC9, 0x09, 0xFC, 0x29, 0xDA, 0x10, 0x09, 0x39, 0x6C, 0xA2, 0x9C, 0x94, 0xE2, 0xDA, 0x4A,
+    0xD2, 0xDA, 0x49, 0xD9, 0x1A, 0xD4, 0x9D, 0x2D, 0xA3, 0xE1, 0xAE, 0x2E, 0x90, 0xAE, 0x2E, 0x90,
+    0xAD, 0xA2, 0xAD, 0x91, 0xDA, 0x39, 0xC9, 0x2C, 0xA7, 0x29, 0x40, 0x77, 0x59, 0xDA, 0x77, 0x0C,
+    0xAC, 0xA7, 0x72, 0xCA, 0x71, 0xC9, 0x6C, 0xA7, 0x0A, 0xC7, 0xCA, 0x79, 0xC9, 0x7C, 0xA7, 0xD7,
+    0x9C, 0xA6, 0xAC, 0x97, 0x9C, 0xA6, 0xCA, 0x70, 0x9C, 0xA5, 0xAC, 0x70, 0x9A, 0xCA, 0x99, 0x29,
+    0xCA, 0x7A, 0xFD, 0x91, 0xD4, 0x92, 0xAF, 0xD9, 0x0A, 0xC9, 0x4C, 0x97, 0x2D, 0x4D, 0x97, 0x1D,
+    0x93, 0xAD, 0xA7, 0x09, 0xD3, 0x9C, 0x9C, 0xA7, 0x0D, 0x93, 0xCA, 0x0C, 0xA7, 0xAC, 0xA3, 0xD1,
+    0xCA, 0x7D, 0x3A, 0xCA, 0x1D, 0x95, 0xDA, 0x3F, 0xFA, 0x39, 0xD4, 0x99, 0x19, 0xD9, 0x4D, 0x97,
+    0x1D, 0x4A, 0xD7, 0x2D, 0x49, 0x97, 0x29, 0xD1, 0x1A, 0xCA, 0x77, 0x1E, 0xA7, 0x71, 0x90, 0xCA,
+    0x71, 0x99, 0x7C, 0xA7, 0x0A, 0xC7, 0x0C, 0xA7, 0x0C, 0xA7, 0x0C, 0xA7, 0xAC, 0x70, 0x9C, 0xA6,
+    0x9C, 0x97, 0x09, 0xCA, 0x6D, 0x71, 0x9C, 0xA5, 0xAC, 0x97, 0x09, 0xAC, 0xA9, 0x93, 0xCA, 0x29,
+    0x93, 0xAF, 0xD9, 0x1D, 0x09, 0xFC, 0xA1, 0xAF, 0xD9, 0x09, 0xCA, 0x0A, 0xA2, 0xAC, 0x97, 0x1D,
+    0x7D, 0x70, 0xAC, 0x97, 0xD7, 0x9D, 0x70, 0xD7, 0xD9, 0x7D, 0x96, 0x9D, 0x7A, 0xD7, 0xD7, 0xE7,
+    0xAC, 0xA5, 0xAE, 0x79, 0xD5, 0x9E, 0xA9, 0x99, 0x4D, 0x95, 0xAF, 0xE3, 0xAD, 0x6F, 0xF3, 0x99,
+    0x77, 0x00, 0x77, 0x6A, 0xF9, 0x77, 0x92, 0x9C, 0x97, 0x73, 0x9C, 0x7A, 0x97, 0x19, 0xA6, 0xAC,
+    0x79, 0x9A, 0xA7, 0xC9, 0x6F, 0xA6, 0xD7, 0x2A, 0xD4, 0x9C, 0x97, 0x3D, 0x4D, 0x74, 0xAC, 0x3A,
+    0xC7, 0x09, 0x29, 0xD2, 0x9C, 0xA7, 0x9F, 0xDA, 0x2D, 0x49, 0x2A, 0xFC, 0xA2, 0x9C, 0xA4, 0xC9,
+    0x39, 0x99, 0x4D, 0x4D, 0x97, 0x2A, 0xC9, 0x3A, 0xDA, 0x71, 0x9D, 0x39, 0xC9, 0xCA, 0x71, 0xD9,
+    0x3C, 0xA0, 0xCA, 0x70, 0xAC, 0xA3, 0xD1, 0xCA, 0x70, 0xD3, 0xAC, 0xA1, 0xD9, 0x6A, 0xCA, 0x3F,
+    0xFA, 0x49, 0xD4, 0x99, 0x19, 0xD9, 0x5D, 0x97, 0x1D, 0x5A, 0xD7, 0x2D, 0x59, 0x97, 0x29, 0xD1,
+    0x5F, 0x71, 0xEA, 0x71, 0xE9, 0x71, 0xAD, 0x77, 0x77, 0x70, 0x99, 0x71, 0xEA, 0x71, 0xEA, 0x71,
+    0xEA, 0x71, 0xEA, 0x71, 0xEA, 0x70, 0xAE, 0xA7, 0xFA, 0x7A, 0xE7, 0x09, 0xDA, 0x71, 0xE7, 0x19,
+    0xD9, 0x71, 0xE7, 0x2E, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xE7, 0x2A, 0xDA, 0x59, 0xA2, 0xF9, 0x19,
+    0xAD, 0x91, 0x9F, 0xFC, 0xA4, 0xAF, 0xCA, 0x97, 0x70, 0x5D, 0x97, 0x70, 0x9D, 0x97, 0x70, 0x9D,
+    0xA7, 0x71, 0xAA, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x39, 0xDA, 0x77, 0xAE, 0x77, 0xF9, 0x75, 0x9F,
+    0xC7, 0x5D, 0xA9, 0xD9, 0x73, 0x9D, 0x90, 0xDA, 0x73, 0xAD, 0x1A, 0xD7, 0x3D, 0xA1, 0x9D, 0x97,
+    0x19, 0xD9, 0x2E, 0x71, 0xE3, 0xAD, 0x71, 0xDA, 0x39, 0xDA, 0x7A, 0xD9, 0x4E, 0x7E, 0x5A, 0xD9,
+    0x59, 0xDA, 0x6D, 0xA5, 0xFF, 0xFD, 0x5F, 0xFF, 0xDA, 0x3A, 0xFF, 0xFE, 0x3E, 0xA9, 0x99, 0x99,
+    0x99, 0x99, 0xE9, 0x19, 0xE7, 0x1E, 0xA1, 0xAE, 0x71, 0xAE, 0x1E, 0xA7, 0x19, 0xE9, 0x72, 0xCA,
+    0x77, 0x0A, 0xC9, 0x77, 0x0D, 0x77, 0x0A, 0xCA, 0x77, 0x0D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x9D, 0xA7, 0x7A, 0xE7, 0x7F, 0x97, 0x59, 0xFC, 0x75, 0xEA, 0xD7, 0x5D, 0xA0,
+    0xDA, 0x73, 0xAD, 0x1E, 0x73, 0xE1, 0xAD, 0x97, 0x19, 0xDA, 0x2D, 0xA7, 0x1A, 0xD3, 0xE7, 0x1E,
+    0x3A, 0xD9, 0x79, 0xDA, 0x4E, 0x7E, 0x5E, 0x7E, 0x5A, 0xDA, 0x59, 0xDA, 0x6E, 0x5F, 0xFF, 0xD5,
+    0xFF, 0xFD, 0xA3, 0xAF, 0xFF, 0xE3, 0xEA, 0x99, 0x99, 0x99, 0x99, 0x9E, 0x91, 0x9E, 0x71, 0xEA,
+    0x1A, 0xE7, 0x1A, 0xE1, 0xEA, 0x71, 0x9E, 0x90, 0x70, 0x9A, 0x77, 0x09, 0xD9, 0x77, 0xF7, 0x6D,
+    0x1D, 0x73, 0x9C, 0x93, 0xAC, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9D, 0xA7, 0x7A, 0xE7, 0x7F, 0x97,
+    0x59, 0xFC, 0x75, 0xDA, 0x9D, 0x97, 0x39, 0xD9, 0x0D, 0xA7, 0x3A, 0xD1, 0xAD, 0x73, 0xDA, 0x19,
+    0xD9, 0x71, 0x9D, 0x92, 0xE7, 0x1E, 0x3A, 0xD7, 0x1D, 0xA3, 0x9D, 0xA7, 0xAD, 0x94, 0xE7, 0xE5,
+    0xAD, 0x95, 0x9D, 0xA6, 0xDA, 0x5F, 0xFF, 0xD5, 0xFF, 0xFD, 0xA3, 0xAF, 0xFF, 0xE3, 0xEA, 0x99,
+    0x99, 0x99, 0x99, 0x9E, 0x91, 0x9E, 0x71, 0xEA, 0x1A, 0xE7, 0x1A, 0xE1, 0xEA, 0x71, 0x9E, 0x90,
+    0x77, 0x71, 0x9E, 0x2C, 0x97, 0x2D, 0x0C, 0xA1, 0xC9, 0x72, 0xC9, 0x1C, 0xAA, 0xC7, 0x3C, 0x92,
+    0xDA, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9D, 0xA7, 0x7A, 0xE7, 0x7F, 0x97, 0x59, 0xFC, 0x75, 0xDA,
+    0x9D, 0x97, 0x39, 0xD9, 0x0D, 0xA7, 0x3A, 0xD1, 0xAD, 0x73, 0xDA, 0x19, 0xD9, 0x71, 0x9D, 0x92,
+    0xE7, 0x1E, 0x3A, 0xD7, 0x1D, 0xA3, 0x9D, 0xA7, 0xAD, 0x94, 0xE7, 0xE5, 0xAD, 0x95, 0x9D, 0xA6,
+    0xDA, 0x5F, 0xFF, 0xD5, 0xFF, 0xFD, 0xA3, 0xAF, 0xFF, 0xE3, 0xEA, 0x99, 0x99, 0x99, 0x99, 0x9E,
+    0x91, 0x9E, 0x71, 0xEA, 0x1A, 0xE7, 0x1A, 0xE1, 0xEA, 0x71, 0x9E, 0x90, 0x49, 0xD9, 0x2A, 0xD7,
+    0x1A, 0xDA, 0x2E, 0x97, 0x0E, 0xA2, 0xE9, 0x70, 0xF1, 0x9E, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x39, 0xDA, 0x77, 0xAE, 0x77, 0xF9, 0x75, 0x9F, 0xC7, 0x5D, 0xA9, 0xD9, 0x73, 0x9D, 0x90, 0xDA,
+    0x73, 0xAD, 0x1A, 0xD7, 0x3D, 0xA1, 0x9D, 0x97, 0x19, 0xD9, 0x2E, 0x71, 0xE3, 0xAD, 0x71, 0xDA,
+    0x39, 0xDA, 0x7A, 0xD9, 0x4E, 0x7E, 0x5A, 0xD9, 0x59, 0xDA, 0x6D, 0xA5, 0xFF, 0xFD, 0x5F, 0xFF,
+    0xDA, 0x3A, 0xFF, 0xFE, 0x3E, 0xA9, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x19, 0xE7, 0x1E, 0xA1, 0xAE,
+    0x71, 0xAE, 0x1E, 0xA7, 0x19, 0xE9, 0x79, 0xDA, 0x77, 0xC1, 0xA9, 0x75, 0x9C, 0x19, 0xA7, 0x6C,
+    0xAA, 0xC9, 0x76, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xDA, 0x77, 0xAE, 0x77, 0xF9,
+    0x75, 0x9F, 0xC7, 0x5D, 0xA9, 0xD9, 0x73, 0x9D, 0x90, 0xDA, 0x73, 0xAD, 0x1A, 0xD7, 0x3D, 0xA1,
+    0x9D, 0x97, 0x19, 0xD9, 0x2E, 0x71, 0xE3, 0xAD, 0x71, 0xDA, 0x39, 0xDA, 0x7A, 0xD9, 0x4E, 0x7E,
+    0x5A, 0xD9, 0x59, 0xDA, 0x6D, 0xA5, 0xFF, 0xFD, 0x5F, 0xFF, 0xDA, 0x3A, 0xFF, 0xFE, 0x3E, 0xA9,
+    0x99, 0x99, 0x99, 0x99, 0xE9, 0x19, 0xE7, 0x1E, 0xA1, 0xAE, 0x71, 0xAE, 0x1E, 0xA7, 0x19, 0xE9,
+    0x77, 0x77, 0x7F, 0xFF, 0xE7, 0x3F, 0xFF, 0xEA, 0x72, 0x9F, 0xFD, 0xAA, 0xAA, 0xA9, 0x72, 0xFE,
+    0x77, 0x39, 0xD9, 0xF7, 0x73, 0xE0, 0xF7, 0x72, 0x9D, 0x90, 0xAE, 0x77, 0x2E, 0x19, 0xE7, 0x71,
+    0xAD, 0x92, 0xFF, 0xD7, 0x2E, 0x3F, 0xFD, 0x71, 0xAD, 0x93, 0xFF, 0xD7, 0x1E, 0x4E, 0xA7, 0x6A,
+    0xD9, 0x4E, 0xA7, 0x6E, 0x5F, 0x75, 0xEA, 0x5F, 0x74, 0x9F, 0xFF, 0xD9, 0x73, 0xFF, 0xFE, 0xA9,
+    0x99, 0x99, 0x99, 0x39, 0xFF, 0xFF, 0xFE, 0xA2, 0xF7, 0xFF, 0xFC, 0x19, 0xE9, 0x7F, 0xFF, 0xC1,
+    0xF7, 0x0F, 0xFF, 0xC9, 0x77, 0x73, 0x77, 0x72, 0x9A, 0xAF, 0xA7, 0x9F, 0xFC, 0x6F, 0xFE, 0x5F,
+    0xA7, 0x3F, 0x97, 0x3A, 0xE9, 0x74, 0xE9, 0x74, 0x9E, 0x75, 0xAD, 0xA7, 0x5E, 0x97, 0x5E, 0x76,
+    0xE9, 0x75, 0xEA, 0x75, 0xF9, 0x74, 0xFC, 0xA7, 0x3F, 0xEA, 0xAA, 0x9A, 0xAD, 0x29, 0xFF, 0xFD,
+    0x3F, 0xFF, 0xD3, 0x9F, 0xFF, 0xC5, 0xFF, 0xF6, 0x9F, 0xFA, 0xA7, 0x3A, 0x77, 0x9C, 0xA9, 0x77,
+    0x0A, 0xA7, 0x79, 0xC7, 0x49, 0x9A, 0xCA, 0x74, 0xEA, 0x30, 0x29, 0xA9, 0x74, 0xE7, 0x4E, 0x97,
+    0x3A, 0xDA, 0x77, 0x77, 0x77, 0x29, 0xFF, 0xF1, 0xAF, 0xFE, 0xA1, 0xAF, 0xDA, 0xAA, 0xAA, 0x2A,
+    0xD7, 0x3A, 0xD7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD4, 0xE9, 0x72,
+    0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xA1, 0xFF, 0xFC,
+    0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x00, 0x79, 0xC7, 0x4D, 0x73, 0x9C, 0xA7, 0x3D, 0x73, 0x9D, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xFF, 0xF1, 0xAF, 0xFE, 0xA1, 0xAF, 0xDA, 0xAA, 0xAA, 0x2A,
+    0xD7, 0x3A, 0xD7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD4, 0xE9, 0x72,
+    0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xA1, 0xFF, 0xFC,
+    0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x00, 0x69, 0x74, 0xAD, 0x72, 0x9E, 0xA7, 0x09, 0xCA, 0x0A, 0xCA,
+    0x69, 0xC9, 0x29, 0xCA, 0x59, 0x69, 0x77, 0x77, 0x19, 0xFF, 0xF1, 0xAF, 0xFE, 0xA1, 0xAF, 0xDA,
+    0xAA, 0xAA, 0x2A, 0xD7, 0x3A, 0xD7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF,
+    0xD4, 0xE9, 0x72, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF,
+    0xA1, 0xFF, 0xFC, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x00, 0x77, 0x1E, 0x3E, 0x4E, 0x3E, 0x4E, 0x91,
+    0x9E, 0x39, 0xE9, 0x1A, 0xE9, 0x77, 0x77, 0x76, 0x9F, 0xFF, 0x1A, 0xFF, 0xEA, 0x1A, 0xFD, 0xAA,
+    0xAA, 0xA2, 0xAD, 0x73, 0xAD, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3F, 0xFD, 0x4F, 0xFD, 0x4F, 0xFD,
+    0x4E, 0x97, 0x2E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFA,
+    0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x09, 0x6D, 0xA5, 0xAD, 0x94, 0xAD, 0x95, 0x99,
+    0x97, 0x77, 0x72, 0x9E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x93,
+    0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0xA3, 0xEA, 0x29, 0xEA, 0x29, 0xF2, 0x9F, 0x29, 0xF0, 0x2C, 0xA1,
+    0x9C, 0x91, 0xD1, 0x9C, 0xA1, 0xD9, 0x77, 0x77, 0x70, 0x9E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0xA0, 0xEA, 0x9E, 0xA9, 0xF9,
+    0xF9, 0xF0, 0x75, 0xD6, 0xAD, 0xA4, 0xAC, 0xAA, 0xCA, 0x2A, 0xC9, 0x19, 0xCA, 0x09, 0xA5, 0xA9,
+    0x77, 0x77, 0x72, 0x9E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x95,
+    0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0xA5, 0xEA, 0x49, 0xEA, 0x49, 0xF4, 0x9F, 0x49, 0xF1, 0x09, 0xD9,
+    0x2A, 0xD9, 0x0A, 0xDA, 0x2E, 0x90, 0xF2, 0xEA, 0x0F, 0x2E, 0xA7, 0x77, 0x77, 0x74, 0x99, 0x97,
+    0x9E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E,
+    0x70, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xEA, 0x7E, 0xA6, 0x9E, 0xA6, 0x9F, 0x69, 0xF6, 0x9F,
+    0x20, 0x39, 0x99, 0x99, 0x99, 0x76, 0x9F, 0xFC, 0xA9, 0x72, 0x9F, 0xFF, 0x97, 0x09, 0xFF, 0xFC,
+    0x97, 0x9D, 0xA4, 0x9A, 0xF9, 0x69, 0xDA, 0x7F, 0x69, 0xDA, 0x70, 0xEA, 0x59, 0xDA, 0x70, 0xAE,
+    0x59, 0xDA, 0x71, 0xEA, 0x49, 0xDA, 0x71, 0xAE, 0x19, 0xAA, 0xAE, 0xAA, 0xAA, 0x59, 0xE1, 0xFF,
+    0xE9, 0x49, 0xE9, 0x0F, 0xFE, 0x94, 0x9E, 0x93, 0x9D, 0xA7, 0x19, 0xE9, 0x39, 0xDA, 0x71, 0xAE,
+    0x93, 0x9D, 0xA7, 0x0A, 0xF4, 0x9E, 0x99, 0x99, 0x99, 0xAF, 0xE4, 0x9F, 0xFF, 0xF9, 0x49, 0xFF,
+    0xFF, 0x59, 0xFF, 0xFD, 0xA6, 0x9F, 0xFF, 0xC9, 0x79, 0xFF, 0xAA, 0x97, 0x6D, 0xA2, 0xC9, 0x71,
+    0xAC, 0x9C, 0x91, 0xC9, 0x71, 0xC9, 0x09, 0xC9, 0x0C, 0x97, 0x1C, 0x91, 0xAE, 0x72, 0x94, 0x97,
+    0x77, 0x29, 0x99, 0x97, 0x0E, 0x2A, 0xE9, 0x7E, 0x2F, 0xC7, 0xE2, 0xFC, 0x69, 0xE2, 0xFC, 0xA5,
+    0x9E, 0x2F, 0xD5, 0x9E, 0x2F, 0xDA, 0x4A, 0xE2, 0xE9, 0xE4, 0xAD, 0xA1, 0x9E, 0x0E, 0xA3, 0xAD,
+    0xA1, 0x9E, 0x09, 0xE3, 0xAD, 0xA1, 0x9E, 0x1E, 0xA2, 0xEA, 0x1A, 0xE1, 0x9E, 0x2E, 0xA1, 0xAE,
+    0x2E, 0x91, 0xE9, 0x1A, 0xE2, 0x9E, 0x1E, 0x91, 0xAE, 0x3E, 0x90, 0xE9, 0x1F, 0x3A, 0xE9, 0xE9,
+    0x1F, 0x93, 0xEA, 0xE9, 0x1F, 0x93, 0xAF, 0xD2, 0xF9, 0x4F, 0xD2, 0xF9, 0x4A, 0xFC, 0x2F, 0x95,
+    0xFC, 0x10, 0x5A, 0xA7, 0x71, 0x9D, 0x97, 0x70, 0x9D, 0xA7, 0x71, 0xE9, 0x77, 0x77, 0x77, 0x49,
+    0xAF, 0xCA, 0x97, 0x09, 0xFF, 0xE6, 0xAF, 0xA9, 0x99, 0xFC, 0x93, 0x9F, 0x59, 0xF3, 0xF7, 0x9E,
+    0xA1, 0x9E, 0x71, 0xAE, 0x1E, 0xA7, 0x2E, 0x90, 0xE7, 0x3A, 0xDA, 0x0E, 0x73, 0x9D, 0xA0, 0xE7,
+    0x39, 0xE9, 0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xE7, 0x39, 0xDA, 0x0E, 0x97, 0x2E, 0xA0, 0xF9,
+    0x70, 0xAE, 0x90, 0x9F, 0xCA, 0x99, 0x99, 0x9A, 0xFC, 0x2F, 0xFF, 0xFA, 0x29, 0xFF, 0xFE, 0x4A,
+    0xFF, 0xFC, 0x95, 0xAF, 0xFE, 0x97, 0x09, 0xAF, 0xCA, 0x97, 0x77, 0x00, 0x72, 0xD7, 0x70, 0x9C,
+    0xA7, 0x70, 0xD7, 0x70, 0x9D, 0x77, 0x0A, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19,
+    0xAF, 0xCA, 0x97, 0x09, 0xFF, 0xE6, 0xAF, 0xA9, 0x99, 0xFC, 0x93, 0x9F, 0x59, 0xF3, 0xF7, 0x9E,
+    0xA1, 0x9E, 0x71, 0xAE, 0x1E, 0xA7, 0x2E, 0x90, 0xE7, 0x3A, 0xDA, 0x0E, 0x73, 0x9D, 0xA0, 0xE7,
+    0x39, 0xE9, 0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xE7, 0x39, 0xDA, 0x0E, 0x97, 0x2E, 0xA0, 0xF9,
+    0x70, 0xAE, 0x90, 0x9F, 0xCA, 0x99, 0x99, 0x9A, 0xFC, 0x2F, 0xFF, 0xFA, 0x29, 0xFF, 0xFE, 0x4A,
+    0xFF, 0xFC, 0x95, 0xAF, 0xFE, 0x97, 0x09, 0xAF, 0xCA, 0x97, 0x77, 0x00, 0x71, 0x97, 0x71, 0xD9,
+    0x77, 0xAE, 0x76, 0xAC, 0xA0, 0xD7, 0x4A, 0xC3, 0xAC, 0x73, 0x96, 0x97, 0x77, 0x69, 0xAF, 0xCA,
+    0x97, 0x09, 0xFF, 0xE6, 0xAF, 0xA9, 0x99, 0xFC, 0x93, 0x9F, 0x59, 0xF3, 0xF7, 0x9E, 0xA1, 0x9E,
+    0x71, 0xAE, 0x1E, 0xA7, 0x2E, 0x90, 0xE7, 0x3A, 0xDA, 0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x39, 0xE9,
+    0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xE7, 0x39, 0xDA, 0x0E, 0x97, 0x2E, 0xA0, 0xF9, 0x70, 0xAE,
+    0x90, 0x9F, 0xCA, 0x99, 0x99, 0x9A, 0xFC, 0x2F, 0xFF, 0xFA, 0x29, 0xFF, 0xFE, 0x4A, 0xFF, 0xFC,
+    0x95, 0xAF, 0xFE, 0x97, 0x09, 0xAF, 0xCA, 0x97, 0x77, 0x00, 0x6A, 0xCA, 0x2A, 0xC7, 0x29, 0xC9,
+    0xCA, 0x1A, 0xA7, 0x2A, 0xC1, 0xCA, 0x0C, 0xA7, 0x2C, 0xA1, 0x9E, 0x97, 0x29, 0x49, 0x77, 0x77,
+    0x09, 0xAF, 0xCA, 0x97, 0x09, 0xFF, 0xE6, 0xAF, 0xA9, 0x99, 0xFC, 0x93, 0x9F, 0x59, 0xF3, 0xF7,
+    0x9E, 0xA1, 0x9E, 0x71, 0xAE, 0x1E, 0xA7, 0x2E, 0x90, 0xE7, 0x3A, 0xDA, 0x0E, 0x73, 0x9D, 0xA0,
+    0xE7, 0x39, 0xE9, 0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xE7, 0x39, 0xDA, 0x0E, 0x97, 0x2E, 0xA0,
+    0xF9, 0x70, 0xAE, 0x90, 0x9F, 0xCA, 0x99, 0x99, 0x9A, 0xFC, 0x2F, 0xFF, 0xFA, 0x29, 0xFF, 0xFE,
+    0x4A, 0xFF, 0xFC, 0x95, 0xAF, 0xFE, 0x97, 0x09, 0xAF, 0xCA, 0x97, 0x77, 0x00, 0x77, 0x71, 0xDA,
+    0x29, 0xD9, 0x70, 0x9E, 0x2A, 0xDA, 0x70, 0xAE, 0x2F, 0x70, 0xF2, 0xF7, 0x77, 0x77, 0x71, 0x9A,
+    0xFC, 0xA9, 0x70, 0x9F, 0xFE, 0x6A, 0xFA, 0x99, 0x9F, 0xC9, 0x39, 0xF5, 0x9F, 0x3F, 0x79, 0xEA,
+    0x19, 0xE7, 0x1A, 0xE1, 0xEA, 0x72, 0xE9, 0x0E, 0x73, 0xAD, 0xA0, 0xE7, 0x39, 0xDA, 0x0E, 0x73,
+    0x9E, 0x9D, 0xA7, 0x4E, 0x0E, 0x74, 0xDA, 0x0E, 0x73, 0x9D, 0xA0, 0xE9, 0x72, 0xEA, 0x0F, 0x97,
+    0x0A, 0xE9, 0x09, 0xFC, 0xA9, 0x99, 0x99, 0xAF, 0xC2, 0xFF, 0xFF, 0xA2, 0x9F, 0xFF, 0xE4, 0xAF,
+    0xFF, 0xC9, 0x5A, 0xFF, 0xE9, 0x70, 0x9A, 0xFC, 0xA9, 0x77, 0x70, 0x1D, 0x92, 0xAC, 0x4D, 0xA0,
+    0xD9, 0x5F, 0xA6, 0x9E, 0x69, 0xFC, 0x49, 0xE9, 0xE2, 0x9E, 0x19, 0xE0, 0x77, 0x77, 0x77, 0x72,
+    0xAC, 0xA7, 0x77, 0x2E, 0x77, 0x72, 0xAD, 0x97, 0x77, 0x2E, 0x77, 0x72, 0xAD, 0x77, 0x72, 0x9D,
+    0xA7, 0x77, 0x2E, 0x77, 0x72, 0xAD, 0x97, 0x77, 0x2E, 0x77, 0x72, 0xE7, 0x77, 0x29, 0xDA, 0x77,
+    0x19, 0xAF, 0xCA, 0x9E, 0x77, 0x09, 0xFF, 0xF9, 0x77, 0x9F, 0xA9, 0x99, 0xFC, 0x97, 0x69, 0xF5,
+    0xFC, 0x76, 0xF5, 0xAF, 0xD7, 0x49, 0xE9, 0x49, 0xEA, 0xE7, 0x4A, 0xE5, 0xE9, 0x0E, 0x97, 0x3E,
+    0x94, 0xAD, 0xA1, 0xAD, 0xA7, 0x3E, 0x49, 0xE2, 0x9E, 0x73, 0xE4, 0xE9, 0x3E, 0x73, 0xE3, 0xAE,
+    0x4E, 0x73, 0xE3, 0xE9, 0x4E, 0x73, 0xE2, 0xEA, 0x49, 0xE7, 0x3E, 0xA0, 0xAE, 0x5E, 0xA7, 0x3A,
+    0xEA, 0xE9, 0x4A, 0xE9, 0x73, 0x9F, 0xE9, 0x99, 0x9A, 0xFC, 0x75, 0xFF, 0xFF, 0xC7, 0x59, 0xFF,
+    0xFE, 0x97, 0x6F, 0xFF, 0xDA, 0x76, 0x9F, 0xFF, 0xC9, 0x77, 0xF9, 0xAF, 0xCA, 0x97, 0x70, 0xAE,
+    0x77, 0x72, 0xEA, 0x77, 0x71, 0xF7, 0x77, 0x19, 0xE9, 0x77, 0x71, 0xF7, 0x77, 0x1A, 0xE7, 0x77,
+    0x19, 0xEA, 0x77, 0x71, 0xF7, 0x77, 0x1A, 0xE9, 0x77, 0x71, 0xE9, 0x77, 0x71, 0xAA, 0x97, 0x77,
+    0x77, 0x77, 0x10, 0x49, 0x77, 0x0D, 0xA7, 0x7E, 0x77, 0xE9, 0x77, 0x99, 0x77, 0x77, 0x73, 0x99,
+    0x97, 0x19, 0x99, 0x1F, 0x7A, 0xEA, 0x0E, 0xA7, 0xAE, 0xA0, 0xEA, 0x7A, 0xE9, 0x0E, 0xA7, 0xAE,
+    0x90, 0xEA, 0x79, 0xE9, 0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x79, 0xE9, 0x0E, 0xA7, 0x9E, 0x1E, 0x97,
+    0x9E, 0x1E, 0x97, 0x9E, 0x1E, 0x97, 0x9E, 0x1E, 0x97, 0x9E, 0x1E, 0x97, 0x9E, 0x1E, 0xA7, 0x9E,
+    0x1A, 0xE7, 0xAE, 0x1A, 0xEA, 0x59, 0xF1, 0x9F, 0xCA, 0xAA, 0xAF, 0xCA, 0x19, 0xFF, 0xFD, 0x92,
+    0xFF, 0xFD, 0x39, 0xFF, 0xF9, 0x5A, 0xFF, 0xA9, 0x77, 0x40, 0x71, 0xCA, 0x76, 0xAC, 0x97, 0x6D,
+    0x76, 0xAC, 0xA7, 0x6D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x99, 0x99, 0x70, 0x99,
+    0x91, 0xF7, 0xAE, 0xA0, 0xEA, 0x7A, 0xEA, 0x0E, 0xA7, 0xAE, 0x90, 0xEA, 0x7A, 0xE9, 0x0E, 0xA7,
+    0x9E, 0x90, 0xEA, 0x79, 0xE9, 0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9,
+    0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xEA, 0x79, 0xE1, 0xAE, 0x7A,
+    0xE1, 0xAE, 0xA5, 0x9F, 0x19, 0xFC, 0xAA, 0xAA, 0xFC, 0xA1, 0x9F, 0xFF, 0xD9, 0x2F, 0xFF, 0xD3,
+    0x9F, 0xFF, 0x95, 0xAF, 0xFA, 0x97, 0x74, 0x77, 0x71, 0xD7, 0x6A, 0xDA, 0x74, 0xAC, 0xAA, 0xCA,
+    0x72, 0xAC, 0x91, 0x9C, 0xA7, 0x09, 0xA5, 0xA9, 0x77, 0x77, 0x70, 0x99, 0x97, 0x19, 0x99, 0x1F,
+    0x7A, 0xEA, 0x0E, 0xA7, 0xAE, 0xA0, 0xEA, 0x7A, 0xE9, 0x0E, 0xA7, 0xAE, 0x90, 0xEA, 0x79, 0xE9,
+    0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x79, 0xE9, 0x0E, 0xA7, 0x9E, 0x1E, 0x97, 0x9E, 0x1E, 0x97, 0x9E,
+    0x1E, 0x97, 0x9E, 0x1E, 0x97, 0x9E, 0x1E, 0x97, 0x9E, 0x1E, 0xA7, 0x9E, 0x1A, 0xE7, 0xAE, 0x1A,
+    0xEA, 0x59, 0xF1, 0x9F, 0xCA, 0xAA, 0xAF, 0xCA, 0x19, 0xFF, 0xFD, 0x92, 0xFF, 0xFD, 0x39, 0xFF,
+    0xF9, 0x5A, 0xFF, 0xA9, 0x77, 0x40, 0x39, 0xD9, 0x2A, 0xD7, 0xAD, 0xA2, 0xE9, 0x6E, 0xA2, 0xE9,
+    0x6F, 0x19, 0xEA, 0x77, 0x77, 0x77, 0x71, 0x99, 0x99, 0x79, 0x99, 0x91, 0xF7, 0xAE, 0xA0, 0xEA,
+    0x7A, 0xEA, 0x0E, 0xA7, 0xAE, 0x90, 0xEA, 0x7A, 0xE9, 0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x79, 0xE9,
+    0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1,
+    0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xEA, 0x79, 0xE1, 0xAE, 0x7A, 0xE1, 0xAE, 0xA5, 0x9F, 0x19,
+    0xFC, 0xAA, 0xAA, 0xFC, 0xA2, 0xFF, 0xFD, 0x92, 0xFF, 0xFD, 0x39, 0xFF, 0xF9, 0x5A, 0xFF, 0xA9,
+    0x77, 0x40, 0x71, 0xCA, 0x76, 0xAC, 0x97, 0x6D, 0x76, 0xAC, 0xA7, 0x6D, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x75, 0xE7, 0x1A, 0xDA, 0x0A, 0xDA, 0x70, 0xE2, 0xE7, 0xAD, 0xA2, 0xAE,
+    0x6E, 0x4E, 0x94, 0xEA, 0x4A, 0xE3, 0x9E, 0x6E, 0x92, 0xEA, 0x6A, 0xE1, 0xAE, 0x70, 0xEA, 0x0E,
+    0xA7, 0x0A, 0xFE, 0x72, 0xFD, 0xA7, 0x2A, 0xFC, 0x74, 0xFA, 0x74, 0xF7, 0x5F, 0x75, 0xF7, 0x5F,
+    0x74, 0x9F, 0x74, 0xAF, 0x74, 0xFC, 0x74, 0xFC, 0x60, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xAE,
+    0xA9, 0x5A, 0xFD, 0xA3, 0xAD, 0x99, 0xF9, 0x1A, 0xD2, 0x9E, 0x90, 0xAD, 0x4E, 0x0A, 0xD5, 0xD9,
+    0xAD, 0x59, 0xCA, 0xAD, 0x5D, 0x9A, 0xD4, 0xE0, 0xAD, 0x2A, 0xE9, 0x0A, 0xDA, 0xAF, 0x91, 0xAF,
+    0xDA, 0x3A, 0xEA, 0x95, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0x69, 0x72, 0xFD, 0x96,
+    0xD9, 0x2A, 0xC9, 0x4D, 0x94, 0xAC, 0x4D, 0x6C, 0x93, 0xD4, 0x9A, 0xC9, 0x29, 0xD3, 0xAC, 0xA9,
+    0x39, 0xD2, 0x9C, 0x95, 0x9D, 0x2A, 0xC6, 0x9D, 0x2D, 0x6A, 0xD2, 0xAC, 0xA5, 0xAD, 0x3E, 0x4A,
+    0xD3, 0x9E, 0x92, 0xAD, 0x5E, 0x91, 0xAD, 0x6A, 0xD1, 0xE6, 0x9D, 0x1E, 0x09, 0x4A, 0xD1, 0xE9,
+    0xAF, 0xEA, 0x1E, 0x9A, 0xFE, 0x2E, 0x99, 0xAF, 0x92, 0x77, 0x9D, 0x97, 0x3D, 0xA7, 0x3E, 0x74,
+    0x99, 0x77, 0x69, 0xAE, 0x99, 0xC4, 0xAF, 0xF9, 0x2A, 0xDA, 0x99, 0xAE, 0x92, 0xD9, 0x39, 0xDA,
+    0x1A, 0xCA, 0x5D, 0xA1, 0xD6, 0xE1, 0xD6, 0xAD, 0x1D, 0x6E, 0x1D, 0x6E, 0x1D, 0xA3, 0x9F, 0x1F,
+    0xFF, 0x90, 0x9F, 0xFE, 0x91, 0xAF, 0xE9, 0xD9, 0x29, 0xAE, 0xA1, 0xDA, 0x69, 0xC9, 0x72, 0xD7,
+    0x29, 0xCA, 0x72, 0xD9, 0x71, 0x9D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xE9, 0x9C, 0x4A, 0xFF,
+    0x92, 0xAD, 0xA9, 0x9A, 0xE9, 0x2D, 0x93, 0x9D, 0xA1, 0xAC, 0xA5, 0xDA, 0x1D, 0x6E, 0x1D, 0x6A,
+    0xD1, 0xD6, 0xE1, 0xD6, 0xE1, 0xDA, 0x39, 0xF1, 0xFF, 0xF9, 0x09, 0xFF, 0xE9, 0x1A, 0xFE, 0x9D,
+    0x92, 0x9A, 0xEA, 0x1D, 0xA0, 0x77, 0x3C, 0xA7, 0x2E, 0x97, 0x0D, 0xAD, 0x96, 0xD2, 0xAC, 0x94,
+    0xAA, 0x49, 0xC7, 0x74, 0x9A, 0xE9, 0x9C, 0x4A, 0xFF, 0x92, 0xAD, 0xA9, 0x9A, 0xE9, 0x2D, 0x93,
+    0x9D, 0xA1, 0xAC, 0xA5, 0xDA, 0x1D, 0x6E, 0x1D, 0x6A, 0xD1, 0xD6, 0xE1, 0xD6, 0xE1, 0xDA, 0x39,
+    0xF1, 0xFF, 0xF9, 0x09, 0xFF, 0xE9, 0x1A, 0xFE, 0x9D, 0x92, 0x9A, 0xEA, 0x1D, 0xA0, 0x77, 0x0A,
+    0xDA, 0x2C, 0x5C, 0xA0, 0xC9, 0x1C, 0x49, 0xC1, 0x9C, 0xAD, 0x49, 0xC2, 0x9D, 0x97, 0x74, 0x9A,
+    0xDA, 0x09, 0xC4, 0xAF, 0xDA, 0xC9, 0x2A, 0xDA, 0x99, 0xAE, 0x92, 0xD9, 0x39, 0xDA, 0x1A, 0xCA,
+    0x5D, 0xA1, 0xD6, 0xE1, 0xD6, 0xAD, 0x1D, 0x6E, 0x1D, 0x6E, 0x1D, 0xA3, 0x9F, 0x1F, 0xFF, 0x90,
+    0x9F, 0xFE, 0x91, 0xAF, 0xE9, 0xD9, 0x29, 0xAE, 0xA1, 0xDA, 0x1A, 0xD3, 0xE3, 0xE9, 0x2E, 0x3E,
+    0x91, 0x9E, 0x29, 0xEA, 0x1A, 0xE9, 0x77, 0x77, 0x09, 0xAE, 0x99, 0xC4, 0xAF, 0xF9, 0x2A, 0xDA,
+    0x99, 0xAE, 0x92, 0xD9, 0x39, 0xDA, 0x1A, 0xCA, 0x5D, 0xA1, 0xD6, 0xE1, 0xD6, 0xAD, 0x1D, 0x6E,
+    0x1D, 0x6E, 0x1D, 0xA3, 0x9F, 0x1F, 0xFF, 0x90, 0x9F, 0xFE, 0x91, 0xAF, 0xE9, 0xD9, 0x29, 0xAE,
+    0xA1, 0xDA, 0x49, 0xAA, 0x72, 0xC1, 0xC7, 0x0A, 0xA1, 0xA9, 0x7A, 0xA1, 0xC9, 0x79, 0xCA, 0xAC,
+    0x71, 0x9D, 0x97, 0x77, 0x74, 0x9A, 0xDA, 0x99, 0xC4, 0xAF, 0xF9, 0x2A, 0xDA, 0x99, 0xAE, 0x92,
+    0xD9, 0x39, 0xDA, 0x1A, 0xCA, 0x5D, 0xA1, 0xD6, 0xE1, 0xD6, 0xAD, 0x1D, 0x6E, 0x1D, 0x6E, 0x1D,
+    0xA3, 0x9F, 0x1F, 0xFF, 0x90, 0x9F, 0xFE, 0x91, 0xAF, 0xE9, 0xD9, 0x29, 0xAE, 0xA1, 0xDA, 0x76,
+    0x9A, 0xA9, 0x70, 0x9A, 0xE9, 0x9C, 0x1F, 0xDA, 0x5A, 0xFF, 0xAD, 0xA9, 0x19, 0xD3, 0xAD, 0xA9,
+    0x9A, 0xFC, 0x95, 0xC9, 0x2D, 0x93, 0x9E, 0xA6, 0xD1, 0xAC, 0xA5, 0xEA, 0x9A, 0xAA, 0xFC, 0x90,
+    0xD6, 0xFF, 0xFC, 0xA0, 0xD6, 0xAD, 0xA9, 0x99, 0x96, 0xD6, 0xE7, 0x3D, 0x6E, 0xA7, 0x2D, 0xA3,
+    0x9F, 0xC9, 0x71, 0xFF, 0xFE, 0xA9, 0x99, 0x9A, 0xC1, 0x9F, 0xFF, 0xFF, 0xC2, 0xAF, 0xE9, 0xFF,
+    0xF3, 0x9A, 0xEA, 0x1D, 0xA0, 0xAF, 0xA9, 0x10, 0x77, 0xAF, 0xA3, 0x9F, 0xE3, 0xEA, 0x29, 0x2A,
+    0xD9, 0x7E, 0x70, 0xDA, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xDA, 0x70, 0xE9, 0x7A, 0xEA, 0x7F, 0xF9,
+    0x29, 0xFF, 0x4A, 0xFC, 0xA9, 0x5A, 0x71, 0x9C, 0xAC, 0x72, 0x9C, 0x71, 0xAC, 0x6A, 0xE7, 0x99,
+    0x93, 0x2D, 0x97, 0x3D, 0xA7, 0x3E, 0x97, 0x2A, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x70, 0xAE, 0xA6,
+    0x9F, 0xE9, 0x39, 0xD9, 0x3A, 0xC3, 0xD9, 0x5D, 0x19, 0xCA, 0x6D, 0x1A, 0xDA, 0xAF, 0xEA, 0x0F,
+    0xFF, 0xA0, 0xD9, 0x99, 0x70, 0xD9, 0x72, 0xDA, 0x72, 0xEA, 0x72, 0xFA, 0x99, 0x99, 0xAC, 0x2A,
+    0xFF, 0xD3, 0x9F, 0xFC, 0x5A, 0xAF, 0x91, 0x7D, 0x72, 0x9C, 0xA7, 0x2D, 0x72, 0x9D, 0x72, 0xDA,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAE, 0xA6, 0x9F, 0xE9, 0x39, 0xD9, 0x3A, 0xC3, 0xD9,
+    0x5D, 0x19, 0xCA, 0x6D, 0x1A, 0xDA, 0xAF, 0xEA, 0x0F, 0xFF, 0xA0, 0xD9, 0x99, 0x70, 0xD9, 0x72,
+    0xDA, 0x72, 0xEA, 0x72, 0xFA, 0x99, 0x99, 0xAC, 0x2A, 0xFF, 0xD3, 0x9F, 0xFC, 0x5A, 0xAF, 0x91,
+    0x59, 0xA7, 0x3D, 0xA7, 0x1F, 0x97, 0xD1, 0xAC, 0x95, 0xCA, 0x39, 0xC9, 0x77, 0x77, 0x77, 0x76,
+    0xAE, 0xA6, 0x9F, 0xE9, 0x39, 0xD9, 0x3A, 0xC3, 0xD9, 0x5D, 0x19, 0xCA, 0x6D, 0x1A, 0xDA, 0xAF,
+    0xEA, 0x0F, 0xFF, 0xA0, 0xD9, 0x99, 0x70, 0xD9, 0x72, 0xDA, 0x72, 0xEA, 0x72, 0xFA, 0x99, 0x99,
+    0xAC, 0x2A, 0xFF, 0xD3, 0x9F, 0xFC, 0x5A, 0xAF, 0x91, 0x77, 0x0D, 0xA2, 0x9D, 0x92, 0x9E, 0x2A,
+    0xDA, 0x2A, 0xE2, 0xF2, 0xF2, 0xF7, 0x77, 0x77, 0x77, 0x5A, 0xEA, 0x69, 0xFE, 0x93, 0x9D, 0x93,
+    0xAC, 0x3D, 0x95, 0xD1, 0x9C, 0xA6, 0xD1, 0xAD, 0xAA, 0xFE, 0xA0, 0xFF, 0xFA, 0x0D, 0x99, 0x97,
+    0x0D, 0x97, 0x2D, 0xA7, 0x2E, 0xA7, 0x2F, 0xA9, 0x99, 0x9A, 0xC2, 0xAF, 0xFD, 0x39, 0xFF, 0xC5,
+    0xAA, 0xF9, 0x10, 0x09, 0x96, 0x9D, 0x95, 0x9D, 0xA5, 0x9E, 0x79, 0x97, 0x77, 0xCA, 0x59, 0xCA,
+    0x59, 0xCA, 0x59, 0xCA, 0x59, 0xCA, 0x59, 0xCA, 0x59, 0xCA, 0x5A, 0xCA, 0x5A, 0xD5, 0xAD, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x90, 0x2A, 0xC3, 0xD2, 0xAC, 0xA2, 0xD2, 0xAD, 0x77, 0x77, 0x7C, 0xA2, 0x9C,
+    0xA2, 0x9C, 0xA2, 0x9C, 0xA2, 0x9C, 0xA2, 0x9C, 0xA2, 0x9C, 0xA2, 0xAC, 0xA2, 0xAD, 0x2A, 0xD2,
+    0xE2, 0xE2, 0xE2, 0xE9, 0x00, 0x76, 0x9C, 0xA7, 0xE6, 0xDA, 0xD4, 0xCA, 0x2A, 0xC2, 0xA9, 0x49,
+    0xA7, 0x77, 0x3C, 0xA7, 0x9C, 0xA7, 0x9C, 0xA7, 0x9C, 0xA7, 0x9C, 0xA7, 0x9C, 0xA7, 0x9C, 0xA7,
+    0xAC, 0xA7, 0xAD, 0x7A, 0xD7, 0xE7, 0xE7, 0xE7, 0xE9, 0x20, 0x74, 0x9D, 0xA2, 0xAD, 0x90, 0xAD,
+    0xA2, 0xAD, 0x90, 0xF2, 0xEA, 0x0F, 0x2F, 0x77, 0x77, 0x71, 0xCA, 0x70, 0x9C, 0xA7, 0x09, 0xCA,
+    0x70, 0x9C, 0xA7, 0x09, 0xCA, 0x70, 0x9C, 0xA7, 0x09, 0xCA, 0x70, 0xAC, 0xA7, 0x0A, 0xD7, 0x0A,
+    0xD7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE9, 0x20, 0x70, 0x9C, 0xA9, 0x76, 0xAE, 0xA7, 0x79, 0xD7,
+    0x70, 0xD7, 0x39, 0xFF, 0xDA, 0x69, 0xFF, 0xDA, 0x7A, 0xAA, 0xAD, 0xAA, 0xAA, 0x97, 0x3D, 0x70,
+    0xAA, 0xDA, 0x2D, 0x69, 0xFE, 0x90, 0xD6, 0xE9, 0x19, 0xD9, 0xCA, 0x5A, 0xD5, 0xE9, 0x5D, 0xA5,
+    0xAD, 0x6D, 0xA5, 0x9D, 0x6D, 0xA5, 0x9D, 0x6A, 0xD5, 0xD9, 0x69, 0xEA, 0x99, 0x9E, 0x70, 0xFF,
+    0xCA, 0x71, 0xFF, 0x73, 0x9A, 0xE9, 0x70, 0x39, 0xD9, 0x2C, 0x94, 0xD9, 0xCA, 0x1C, 0x94, 0xC9,
+    0x09, 0xCA, 0xAC, 0x49, 0xC9, 0x19, 0xDA, 0x77, 0x77, 0x75, 0xCA, 0x09, 0xEA, 0x49, 0xFF, 0xC9,
+    0x29, 0xF9, 0x09, 0xE2, 0x9E, 0x4D, 0xA1, 0xAD, 0x94, 0xAC, 0xA1, 0xAD, 0x5A, 0xD1, 0xAD, 0x5A,
+    0xD1, 0xAD, 0x5A, 0xD1, 0xE9, 0x4E, 0x1E, 0x94, 0xE1, 0xE9, 0x4E, 0x90, 0xE9, 0x4E, 0x90, 0xE9,
+    0x4E, 0x90, 0xE9, 0x4E, 0x90, 0x77, 0x0D, 0xA7, 0x3E, 0x73, 0xE9, 0x72, 0x99, 0xA9, 0x77, 0x77,
+    0x77, 0x77, 0x9A, 0xEA, 0x6A, 0xFE, 0xA3, 0xEA, 0x90, 0x9A, 0xD9, 0x19, 0xD5, 0x9D, 0x1D, 0xA6,
+    0xD9, 0x0D, 0x96, 0xDA, 0x0D, 0x96, 0xAD, 0x0D, 0x96, 0xAD, 0x0D, 0xA6, 0xDA, 0x0E, 0x94, 0xAD,
+    0x90, 0x9F, 0xCA, 0xFC, 0x2F, 0xFD, 0x93, 0xAF, 0xE9, 0x59, 0xFA, 0x30, 0x7C, 0xA7, 0x29, 0xC9,
+    0x72, 0xD7, 0x29, 0xD7, 0x2D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAE, 0xA6,
+    0xAF, 0xEA, 0x3E, 0xA9, 0x09, 0xAD, 0x91, 0x9D, 0x59, 0xD1, 0xDA, 0x6D, 0x90, 0xD9, 0x6D, 0xA0,
+    0xD9, 0x6A, 0xD0, 0xD9, 0x6A, 0xD0, 0xDA, 0x6D, 0xA0, 0xE9, 0x4A, 0xD9, 0x09, 0xFC, 0xAF, 0xC2,
+    0xFF, 0xD9, 0x3A, 0xFE, 0x95, 0x9F, 0xA3, 0x5A, 0xC7, 0x29, 0xDA, 0x70, 0x9F, 0xA6, 0x9C, 0xA1,
+    0x9C, 0xA4, 0x9C, 0x94, 0xCA, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xEA, 0x6A, 0xFE, 0xA3, 0xEA, 0x90,
+    0x9A, 0xD9, 0x19, 0xD5, 0x9D, 0x1D, 0xA6, 0xD9, 0x0D, 0x96, 0xDA, 0x0D, 0x96, 0xAD, 0x0D, 0x96,
+    0xAD, 0x0D, 0xA6, 0xDA, 0x0E, 0x94, 0xAD, 0x90, 0x9F, 0xCA, 0xFC, 0x2F, 0xFD, 0x93, 0xAF, 0xE9,
+    0x59, 0xFA, 0x30, 0x77, 0x1E, 0x2A, 0xA4, 0xAC, 0x0A, 0xC1, 0xAA, 0x4C, 0xA1, 0xDA, 0xC9, 0x4C,
+    0xA2, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x69, 0xAE, 0xA6, 0xAF, 0xEA, 0x3E, 0xA9, 0x09, 0xAD, 0x91,
+    0x9D, 0x59, 0xD1, 0xDA, 0x6D, 0x90, 0xD9, 0x6D, 0xA0, 0xD9, 0x6A, 0xD0, 0xD9, 0x6A, 0xD0, 0xDA,
+    0x6D, 0xA0, 0xE9, 0x4A, 0xD9, 0x09, 0xFC, 0xAF, 0xC2, 0xFF, 0xD9, 0x3A, 0xFE, 0x95, 0x9F, 0xA3,
+    0x19, 0xDA, 0x29, 0xD9, 0x2A, 0xDA, 0x2A, 0xD9, 0x2A, 0xE2, 0xEA, 0x2F, 0x2F, 0x77, 0x77, 0x77,
+    0x77, 0x72, 0x9A, 0xEA, 0x6A, 0xFE, 0xA3, 0xEA, 0x90, 0x9A, 0xD9, 0x19, 0xD5, 0x9D, 0x1D, 0xA6,
+    0xD9, 0x0D, 0x96, 0xDA, 0x0D, 0x96, 0xAD, 0x0D, 0x96, 0xAD, 0x0D, 0xA6, 0xDA, 0x0E, 0x94, 0xAD,
+    0x90, 0x9F, 0xCA, 0xFC, 0x2F, 0xFD, 0x93, 0xAF, 0xE9, 0x59, 0xFA, 0x30, 0x77, 0x69, 0xDA, 0x74,
+    0xAD, 0xA7, 0x4A, 0xE7, 0x4F, 0x77, 0x77, 0x77, 0x69, 0x3A, 0xFF, 0xF9, 0x1A, 0xFF, 0xDA, 0xAA,
+    0xA7, 0x77, 0x77, 0x09, 0xDA, 0x74, 0xAD, 0xA7, 0x4A, 0xE7, 0x4F, 0x60, 0x74, 0x97, 0x29, 0xC9,
+    0x72, 0xD7, 0x3D, 0x72, 0x9C, 0xA7, 0x2D, 0x97, 0x2D, 0x72, 0x9C, 0xA7, 0x2A, 0xC9, 0x72, 0xD7,
+    0x29, 0xD7, 0x2A, 0xCA, 0x69, 0xAF, 0x95, 0xAF, 0xEA, 0x3E, 0xA9, 0xAF, 0xA1, 0x9D, 0x2D, 0x99,
+    0xD1, 0xDA, 0x2D, 0x1D, 0x90, 0xD9, 0x19, 0xD1, 0xAC, 0xA0, 0xD9, 0x1A, 0xCA, 0x1A, 0xD0, 0xD9,
+    0x1D, 0x91, 0xAD, 0x0D, 0xA0, 0x9D, 0x2D, 0xA0, 0xE9, 0xAC, 0xA1, 0xAD, 0x90, 0x9F, 0xFE, 0x2F,
+    0xFD, 0x93, 0xFF, 0x95, 0xFC, 0xA7, 0xD9, 0x71, 0x9D, 0x72, 0xE7, 0x2D, 0xA7, 0x19, 0xD7, 0x2A,
+    0xD7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2C, 0xA7, 0x29, 0x97, 0x77, 0x10, 0x19,
+    0x97, 0x39, 0xD9, 0x72, 0x9D, 0xA7, 0x29, 0xE7, 0x49, 0x97, 0x77, 0x71, 0xD9, 0x5D, 0xA1, 0xD9,
+    0x5D, 0xA1, 0xD9, 0x5D, 0xA1, 0xD9, 0x5E, 0x1D, 0xA5, 0xE1, 0xDA, 0x5E, 0x1D, 0xA5, 0xE1, 0xAD,
+    0x5E, 0x1A, 0xD5, 0xE1, 0xAD, 0x93, 0xF1, 0x9F, 0xFE, 0x2F, 0xFE, 0x2F, 0xFA, 0xD3, 0xFD, 0x9A,
+    0xD5, 0x99, 0x95, 0x6A, 0xC7, 0x3D, 0x72, 0xAC, 0x97, 0x2D, 0x72, 0xAD, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x72, 0xD9, 0x5D, 0xA1, 0xD9, 0x5D, 0xA1, 0xD9, 0x5D, 0xA1, 0xD9, 0x5E, 0x1D, 0xA5, 0xE1,
+    0xDA, 0x5E, 0x1D, 0xA5, 0xE1, 0xAD, 0x5E, 0x1A, 0xD5, 0xE1, 0xAD, 0x93, 0xF1, 0x9F, 0xFE, 0x2F,
+    0xFE, 0x2F, 0xFA, 0xD3, 0xFD, 0x9A, 0xD5, 0x99, 0x95, 0x77, 0x29, 0xC9, 0x72, 0xE7, 0x1D, 0xAD,
+    0x7C, 0xA2, 0xD5, 0xC9, 0x49, 0xA7, 0x77, 0x7D, 0x95, 0xDA, 0x1D, 0x95, 0xDA, 0x1D, 0x95, 0xDA,
+    0x1D, 0x95, 0xE1, 0xDA, 0x5E, 0x1D, 0xA5, 0xE1, 0xDA, 0x5E, 0x1A, 0xD5, 0xE1, 0xAD, 0x5E, 0x1A,
+    0xD9, 0x3F, 0x19, 0xFF, 0xE2, 0xFF, 0xE2, 0xFF, 0xAD, 0x3F, 0xD9, 0xAD, 0x59, 0x99, 0x50, 0x1E,
+    0x3D, 0xA3, 0xE2, 0x9E, 0x29, 0xE2, 0xAE, 0x2A, 0xE9, 0x1F, 0x77, 0x77, 0x74, 0xD9, 0x5D, 0xA1,
+    0xD9, 0x5D, 0xA1, 0xD9, 0x5D, 0xA1, 0xD9, 0x5E, 0x1D, 0xA5, 0xE1, 0xDA, 0x5E, 0x1D, 0xA5, 0xE1,
+    0xAD, 0x5E, 0x1A, 0xD5, 0xE1, 0xAD, 0x93, 0xF1, 0x9F, 0xFE, 0x2F, 0xFE, 0x2F, 0xFA, 0xD3, 0xFD,
+    0x9A, 0xD5, 0x99, 0x95, 0x7A, 0xC7, 0x4D, 0x73, 0xAC, 0x97, 0x3D, 0x73, 0xAD, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x76, 0xD9, 0x69, 0xD1, 0x9D, 0x6A, 0xD2, 0xDA, 0x5D, 0xA2, 0x9D, 0x93,
+    0x9D, 0x93, 0xE3, 0xAD, 0x49, 0xD9, 0x2E, 0x5E, 0x19, 0xDA, 0x59, 0xDA, 0x0A, 0xD9, 0x6E, 0x9E,
+    0x79, 0xFD, 0x70, 0xFC, 0xA7, 0x09, 0xF9, 0x71, 0xF7, 0x2F, 0x72, 0xEA, 0x71, 0xAE, 0x97, 0x9F,
+    0xC5, 0x9F, 0xE6, 0x9F, 0xD7, 0x9F, 0x97, 0x76, 0x74, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x97, 0x0E,
+    0xA9, 0x6F, 0xDA, 0x4D, 0x90, 0xAE, 0x3D, 0x92, 0xE2, 0xD9, 0x3D, 0x91, 0xD9, 0x4D, 0x1D, 0x94,
+    0xD1, 0xD9, 0x4D, 0x1D, 0x94, 0xD1, 0xD9, 0x3A, 0xCA, 0x1D, 0x92, 0x9D, 0x2D, 0x91, 0x9D, 0x92,
+    0xAC, 0xA9, 0xAD, 0xA3, 0xAF, 0xC9, 0x4A, 0xDA, 0x96, 0xAC, 0x97, 0x0A, 0xCA, 0x70, 0xAC, 0xA7,
+    0x0A, 0xCA, 0x70, 0xAC, 0xA7, 0x09, 0xC9, 0x70, 0x2E, 0x3D, 0xA4, 0xE2, 0x9E, 0x39, 0xE2, 0xAE,
+    0x3A, 0xE9, 0x1A, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x5D, 0x96, 0x9D, 0x19, 0xD6, 0xAD, 0x2D, 0xA5,
+    0xDA, 0x29, 0xD9, 0x39, 0xD9, 0x3E, 0x3A, 0xD4, 0x9D, 0x92, 0xE5, 0xE1, 0x9D, 0xA5, 0x9D, 0xA0,
+    0xAD, 0x96, 0xE9, 0xE7, 0x9F, 0xD7, 0x0F, 0xCA, 0x70, 0x9F, 0x97, 0x1F, 0x72, 0xF7, 0x2E, 0xA7,
+    0x1A, 0xE9, 0x79, 0xFC, 0x59, 0xFE, 0x69, 0xFD, 0x79, 0xF9, 0x77, 0x60, 0x77, 0x70, 0x9A, 0xAA,
+    0xFD, 0x97, 0x0F, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xDA, 0x77, 0xAE, 0x77, 0xF9,
+    0x75, 0x9F, 0xC7, 0x5D, 0xA9, 0xD9, 0x73, 0x9D, 0x90, 0xDA, 0x73, 0xAD, 0x1A, 0xD7, 0x3D, 0xA1,
+    0x9D, 0x97, 0x19, 0xD9, 0x2E, 0x71, 0xE3, 0xAD, 0x71, 0xDA, 0x39, 0xDA, 0x7A, 0xD9, 0x4E, 0x7E,
+    0x5A, 0xD9, 0x59, 0xDA, 0x6D, 0xA5, 0xFF, 0xFD, 0x5F, 0xFF, 0xDA, 0x3A, 0xFF, 0xFE, 0x3E, 0xA9,
+    0x99, 0x99, 0x99, 0x99, 0xE9, 0x19, 0xE7, 0x1E, 0xA1, 0xAE, 0x71, 0xAE, 0x1E, 0xA7, 0x19, 0xE9,
+    0x77, 0xAF, 0xFC, 0x29, 0xFE, 0xAA, 0xA7, 0x77, 0x71, 0x9A, 0xE9, 0x9C, 0x4A, 0xFF, 0x92, 0xAD,
+    0xA9, 0x9A, 0xE9, 0x2D, 0x93, 0x9D, 0xA1, 0xAC, 0xA5, 0xDA, 0x1D, 0x6E, 0x1D, 0x6A, 0xD1, 0xD6,
+    0xE1, 0xD6, 0xE1, 0xDA, 0x39, 0xF1, 0xFF, 0xF9, 0x09, 0xFF, 0xE9, 0x1A, 0xFE, 0x9D, 0x92, 0x9A,
+    0xEA, 0x1D, 0xA0, 0x4A, 0xC9, 0x93, 0xAC, 0x71, 0x9C, 0x5A, 0xC7, 0x2C, 0xA3, 0xAC, 0x97, 0x2A,
+    0xFD, 0xA7, 0x4A, 0xF9, 0x77, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xDA, 0x77, 0xAE,
+    0x77, 0xF9, 0x75, 0x9F, 0xC7, 0x5D, 0xA9, 0xD9, 0x73, 0x9D, 0x90, 0xDA, 0x73, 0xAD, 0x1A, 0xD7,
+    0x3D, 0xA1, 0x9D, 0x97, 0x19, 0xD9, 0x2E, 0x71, 0xE3, 0xAD, 0x71, 0xDA, 0x39, 0xDA, 0x7A, 0xD9,
+    0x4E, 0x7E, 0x5A, 0xD9, 0x59, 0xDA, 0x6D, 0xA5, 0xFF, 0xFD, 0x5F, 0xFF, 0xDA, 0x3A, 0xFF, 0xFE,
+    0x3E, 0xA9, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x19, 0xE7, 0x1E, 0xA1, 0xAE, 0x71, 0xAE, 0x1E, 0xA7,
+    0x19, 0xE9, 0x1C, 0xA5, 0xCA, 0x3D, 0x5C, 0xA3, 0x9D, 0x99, 0x9A, 0xD5, 0xAF, 0xD9, 0x69, 0xEA,
+    0x77, 0x77, 0x77, 0x29, 0xAE, 0x99, 0xC4, 0xAF, 0xF9, 0x2A, 0xDA, 0x99, 0xAE, 0x92, 0xD9, 0x39,
+    0xDA, 0x1A, 0xCA, 0x5D, 0xA1, 0xD6, 0xE1, 0xD6, 0xAD, 0x1D, 0x6E, 0x1D, 0x6E, 0x1D, 0xA3, 0x9F,
+    0x1F, 0xFF, 0x90, 0x9F, 0xFE, 0x91, 0xAF, 0xE9, 0xD9, 0x29, 0xAE, 0xA1, 0xDA, 0x79, 0xDA, 0x77,
+    0xAE, 0x77, 0xF9, 0x75, 0x9F, 0xC7, 0x5D, 0xA9, 0xD9, 0x73, 0x9D, 0x90, 0xDA, 0x73, 0xAD, 0x1A,
+    0xD7, 0x3D, 0xA1, 0x9D, 0x97, 0x19, 0xD9, 0x2E, 0x71, 0xE3, 0xAD, 0x71, 0xDA, 0x39, 0xDA, 0x7A,
+    0xD9, 0x4E, 0x7E, 0x5A, 0xD9, 0x59, 0xDA, 0x6D, 0xA5, 0xFF, 0xFD, 0x5F, 0xFF, 0xDA, 0x3A, 0xFF,
+    0xFE, 0x3E, 0xA9, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x19, 0xE7, 0x1E, 0xA1, 0xAE, 0x71, 0xAE, 0x1E,
+    0xA7, 0x19, 0xE9, 0x76, 0x9C, 0x77, 0x09, 0xC7, 0x71, 0xC9, 0x77, 0x1C, 0x97, 0x71, 0xAE, 0x77,
+    0x09, 0xAA, 0x10, 0x77, 0x19, 0xAE, 0x99, 0xC4, 0xAF, 0xF9, 0x2A, 0xDA, 0x99, 0xAE, 0x92, 0xD9,
+    0x39, 0xDA, 0x1A, 0xCA, 0x5D, 0xA1, 0xD6, 0xE1, 0xD6, 0xAD, 0x1D, 0x6E, 0x1D, 0x6E, 0x1D, 0xA3,
+    0x9F, 0x1F, 0xFF, 0x90, 0x9F, 0xFE, 0x91, 0xAF, 0xE9, 0xD9, 0x29, 0xAE, 0xA1, 0xDA, 0x71, 0xC9,
+    0x72, 0xAC, 0x73, 0xAC, 0xAA, 0x97, 0x19, 0xDA, 0x75, 0x71, 0x9C, 0x97, 0x6D, 0x76, 0x9C, 0xA7,
+    0x6D, 0x97, 0x59, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xAA, 0xFA, 0x79, 0xFF,
+    0xC6, 0xFF, 0xE5, 0xFA, 0x73, 0xF9, 0x73, 0xAE, 0x97, 0x4E, 0x97, 0x49, 0xE7, 0x5A, 0xDA, 0x75,
+    0xE9, 0x75, 0xE7, 0x6E, 0x97, 0x5E, 0xA7, 0x5F, 0x97, 0x4F, 0xCA, 0x79, 0x2F, 0xFA, 0xA9, 0xAA,
+    0xD2, 0x9F, 0xFF, 0xD3, 0xFF, 0xFD, 0x39, 0xFF, 0xFC, 0x5F, 0xFF, 0x69, 0xFF, 0xA9, 0x77, 0x20,
+    0x6A, 0xC7, 0x1C, 0xA7, 0x0A, 0xC9, 0x70, 0xD7, 0x0A, 0xCA, 0x77, 0x77, 0x77, 0x7A, 0xFA, 0x39,
+    0xFE, 0x3E, 0xA2, 0x92, 0xAD, 0x97, 0xE7, 0x0D, 0xA7, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0xA7, 0x0E,
+    0x97, 0xAE, 0xA7, 0xFF, 0x92, 0x9F, 0xF4, 0x9A, 0xFA, 0x97, 0x30, 0x70, 0xCA, 0x76, 0xAD, 0x97,
+    0x4A, 0xCA, 0xD9, 0x72, 0xAC, 0x91, 0xAC, 0x97, 0x0A, 0xA4, 0x9C, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x73, 0x9A, 0xAF, 0xA7, 0x9F, 0xFC, 0x6F, 0xFE, 0x5F, 0xA7, 0x3F, 0x97, 0x3A, 0xE9, 0x74, 0xE9,
+    0x74, 0x9E, 0x75, 0xAD, 0xA7, 0x5E, 0x97, 0x5E, 0x76, 0xE9, 0x75, 0xEA, 0x75, 0xF9, 0x74, 0xFC,
+    0xA7, 0x92, 0xFF, 0xAA, 0x9A, 0xAD, 0x29, 0xFF, 0xFD, 0x3F, 0xFF, 0xD3, 0x9F, 0xFF, 0xC5, 0xFF,
+    0xF6, 0x9F, 0xFA, 0x97, 0x72, 0x5A, 0x71, 0xE7, 0xFA, 0x5D, 0x90, 0x9C, 0xA3, 0xCA, 0x4C, 0xA7,
+    0x77, 0x4A, 0xFA, 0x39, 0xFE, 0x3E, 0xA2, 0x92, 0xAD, 0x97, 0xE7, 0x0D, 0xA7, 0x0D, 0x97, 0x0D,
+    0x97, 0x0D, 0xA7, 0x0E, 0x97, 0xAE, 0xA7, 0xFF, 0x92, 0x9F, 0xF4, 0x9A, 0xFA, 0x97, 0x30, 0x79,
+    0xD9, 0x75, 0xAD, 0xA7, 0x5E, 0xA7, 0x5F, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9A,
+    0xAF, 0xA7, 0x9F, 0xFC, 0x6F, 0xFE, 0x5F, 0xA7, 0x3F, 0x97, 0x3A, 0xE9, 0x74, 0xE9, 0x74, 0x9E,
+    0x75, 0xAD, 0xA7, 0x5E, 0x97, 0x5E, 0x76, 0xE9, 0x75, 0xEA, 0x75, 0xF9, 0x74, 0xFC, 0xA7, 0x92,
+    0xFF, 0xAA, 0x9A, 0xAD, 0x29, 0xFF, 0xFD, 0x3F, 0xFF, 0xD3, 0x9F, 0xFF, 0xC5, 0xFF, 0xF6, 0x9F,
+    0xFA, 0x97, 0x72, 0x77, 0x0E, 0x70, 0xE7, 0x0E, 0x96, 0x9E, 0xA7, 0x77, 0x77, 0x2A, 0xFA, 0x39,
+    0xFE, 0x3E, 0xA2, 0x92, 0xAD, 0x97, 0xE7, 0x0D, 0xA7, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0xA7, 0x0E,
+    0x97, 0xAE, 0xA7, 0xFF, 0x92, 0x9F, 0xF4, 0x9A, 0xFA, 0x97, 0x30, 0x49, 0xA5, 0xA9, 0x70, 0xD2,
+    0x9C, 0xA7, 0x2A, 0xCA, 0xAC, 0xA7, 0x4E, 0xA7, 0x6D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x73, 0x9A, 0xAF, 0xA7, 0x9F, 0xFC, 0x6F, 0xFE, 0x5F, 0xA7, 0x3F, 0x97, 0x3A, 0xE9, 0x74, 0xE9,
+    0x74, 0x9E, 0x75, 0xAD, 0xA7, 0x5E, 0x97, 0x5E, 0x76, 0xE9, 0x75, 0xEA, 0x75, 0xF9, 0x74, 0xFC,
+    0xA7, 0x92, 0xFF, 0xAA, 0x9A, 0xAD, 0x29, 0xFF, 0xFD, 0x3F, 0xFF, 0xD3, 0x9F, 0xFF, 0xC5, 0xFF,
+    0xF6, 0x9F, 0xFA, 0x97, 0x72, 0x1A, 0x6A, 0x29, 0xC9, 0x29, 0xC9, 0x39, 0xD0, 0xAC, 0x95, 0x9E,
+    0x97, 0xAD, 0x71, 0x97, 0x77, 0x77, 0x4A, 0xFA, 0x39, 0xFE, 0x3E, 0xA2, 0x92, 0xAD, 0x97, 0xE7,
+    0x0D, 0xA7, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0xA7, 0x0E, 0x97, 0xAE, 0xA7, 0xFF, 0x92, 0x9F, 0xF4,
+    0x9A, 0xFA, 0x97, 0x30, 0x77, 0x7C, 0xA4, 0xCA, 0x73, 0xD1, 0x9C, 0xA7, 0x5F, 0xA7, 0x7E, 0x77,
+    0x09, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x99, 0x99, 0x99, 0x97, 0x39, 0xFF, 0xCA, 0x97, 0x9F, 0xFF,
+    0x95, 0x9F, 0xFF, 0xC9, 0x49, 0xDA, 0x49, 0xAF, 0x93, 0x9D, 0xA7, 0xF3, 0x9D, 0xA7, 0x0F, 0x29,
+    0xDA, 0x70, 0x9E, 0x91, 0x9D, 0xA7, 0x1E, 0xA1, 0x9D, 0xA7, 0x1A, 0xE1, 0x9D, 0xA7, 0x19, 0xE1,
+    0x9D, 0xA7, 0x19, 0xE9, 0x09, 0xDA, 0x71, 0x9E, 0x90, 0x9D, 0xA7, 0x19, 0xE9, 0x09, 0xDA, 0x71,
+    0xF9, 0x09, 0xDA, 0x70, 0xAF, 0x19, 0xE9, 0x99, 0x99, 0x9A, 0xFE, 0x19, 0xFF, 0xFF, 0x91, 0x9F,
+    0xFF, 0xF2, 0x9F, 0xFF, 0xDA, 0x39, 0xFF, 0xFC, 0x94, 0x9F, 0xFA, 0xA9, 0x70, 0x73, 0xD7, 0x71,
+    0xD7, 0x71, 0xD2, 0xD7, 0x4D, 0x2D, 0x74, 0xD2, 0xD7, 0x39, 0xD1, 0x9D, 0x6A, 0xA9, 0x19, 0xD1,
+    0x9D, 0x4A, 0xFC, 0x99, 0xD2, 0x99, 0x3F, 0xFA, 0xD7, 0xAD, 0x91, 0x9F, 0xC7, 0xD5, 0xF6, 0xAC,
+    0xA5, 0xAE, 0x6D, 0x95, 0xAD, 0xA6, 0xD9, 0x59, 0xDA, 0x6D, 0x95, 0xAD, 0xA6, 0xDA, 0x5E, 0xA6,
+    0xEA, 0x91, 0x9F, 0xA6, 0x9F, 0xFF, 0x7F, 0xFF, 0x70, 0xAF, 0xEA, 0xD7, 0x19, 0xAE, 0xA0, 0x9D,
+    0x77, 0x71, 0x39, 0x99, 0x99, 0x99, 0x76, 0x9F, 0xFC, 0xA9, 0x72, 0x9F, 0xFF, 0x97, 0x09, 0xFF,
+    0xFC, 0x97, 0x9D, 0xA4, 0x9A, 0xF9, 0x69, 0xDA, 0x7F, 0x69, 0xDA, 0x70, 0xEA, 0x59, 0xDA, 0x70,
+    0xAE, 0x59, 0xDA, 0x71, 0xEA, 0x49, 0xDA, 0x71, 0xAE, 0x19, 0xAA, 0xAE, 0xAA, 0xAA, 0x59, 0xE1,
+    0xFF, 0xE9, 0x49, 0xE9, 0x0F, 0xFE, 0x94, 0x9E, 0x93, 0x9D, 0xA7, 0x19, 0xE9, 0x39, 0xDA, 0x71,
+    0xAE, 0x93, 0x9D, 0xA7, 0x0A, 0xF4, 0x9E, 0x99, 0x99, 0x99, 0xAF, 0xE4, 0x9F, 0xFF, 0xF9, 0x49,
+    0xFF, 0xFF, 0x59, 0xFF, 0xFD, 0xA6, 0x9F, 0xFF, 0xC9, 0x79, 0xFF, 0xAA, 0x97, 0x73, 0xD7, 0x70,
+    0xD7, 0x70, 0xD7, 0x3F, 0xFE, 0x7F, 0xFE, 0x79, 0xAA, 0xAA, 0xDA, 0xAA, 0xA6, 0xAA, 0x91, 0x9D,
+    0x70, 0xAF, 0xC9, 0x9D, 0x7F, 0xFA, 0xD6, 0xAD, 0x91, 0x9F, 0xC6, 0xD5, 0xF5, 0xAC, 0xA5, 0xAE,
+    0x5D, 0x95, 0xAD, 0xA5, 0xD9, 0x59, 0xDA, 0x5D, 0x95, 0xAD, 0xA5, 0xDA, 0x5E, 0xA5, 0xEA, 0x91,
+    0x9F, 0xA5, 0x9F, 0xFF, 0x6F, 0xFF, 0x7A, 0xFE, 0xAD, 0x70, 0x9A, 0xEA, 0x09, 0xD7, 0x77, 0x77,
+    0x1A, 0xAA, 0xAF, 0xD3, 0x9F, 0xFD, 0x77, 0x77, 0x77, 0x76, 0x9F, 0xFF, 0x1A, 0xFF, 0xEA, 0x1A,
+    0xFD, 0xAA, 0xAA, 0xA2, 0xAD, 0x73, 0xAD, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3F, 0xFD, 0x4F, 0xFD,
+    0x4F, 0xFD, 0x4E, 0x97, 0x2E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x99, 0x99, 0x99, 0x99, 0x92,
+    0xFF, 0xFA, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x77, 0x0A, 0xAA, 0xFD, 0xA2, 0xFF,
+    0xDA, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAE, 0xA6, 0x9F, 0xE9, 0x39, 0xD9, 0x3A, 0xC3, 0xD9, 0x5D,
+    0x19, 0xCA, 0x6D, 0x1A, 0xDA, 0xAF, 0xEA, 0x0F, 0xFF, 0xA0, 0xD9, 0x99, 0x70, 0xD9, 0x72, 0xDA,
+    0x72, 0xEA, 0x72, 0xFA, 0x99, 0x99, 0xAC, 0x2A, 0xFF, 0xD3, 0x9F, 0xFC, 0x5A, 0xAF, 0x91, 0x2C,
+    0xA5, 0xCA, 0x4D, 0x5C, 0x94, 0x9D, 0x99, 0x9A, 0xD6, 0xAF, 0xD9, 0x79, 0xEA, 0x77, 0x77, 0x77,
+    0x77, 0x19, 0xFF, 0xF1, 0xAF, 0xFE, 0xA1, 0xAF, 0xDA, 0xAA, 0xAA, 0x2A, 0xD7, 0x3A, 0xD7, 0x3E,
+    0x73, 0xE7, 0x3E, 0x73, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD4, 0xE9, 0x72, 0xE7, 0x3E, 0x73, 0xE7,
+    0x3E, 0x73, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xA1, 0xFF, 0xFC, 0x1F, 0xFF, 0xC1, 0xFF,
+    0xFC, 0x00, 0x39, 0x99, 0x97, 0x9C, 0x94, 0x9C, 0x93, 0xD9, 0x29, 0xD4, 0xAF, 0xEA, 0x59, 0xFC,
+    0xA7, 0x19, 0x97, 0x77, 0x77, 0x77, 0x77, 0x7A, 0xEA, 0x69, 0xFE, 0x93, 0x9D, 0x93, 0xAC, 0x3D,
+    0x95, 0xD1, 0x9C, 0xA6, 0xD1, 0xAD, 0xAA, 0xFE, 0xA0, 0xFF, 0xFA, 0x0D, 0x99, 0x97, 0x0D, 0x97,
+    0x2D, 0xA7, 0x2E, 0xA7, 0x2F, 0xA9, 0x99, 0x9A, 0xC2, 0xAF, 0xFD, 0x39, 0xFF, 0xC5, 0xAA, 0xF9,
+    0x10, 0x77, 0x4A, 0xD9, 0x72, 0xAD, 0x97, 0x2E, 0xA7, 0x2F, 0x77, 0x77, 0x77, 0x77, 0x19, 0xFF,
+    0xF1, 0xAF, 0xFE, 0xA1, 0xAF, 0xDA, 0xAA, 0xAA, 0x2A, 0xD7, 0x3A, 0xD7, 0x3E, 0x73, 0xE7, 0x3E,
+    0x73, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD4, 0xE9, 0x72, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE9,
+    0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xA1, 0xFF, 0xFC, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x00, 0x77,
+    0x3E, 0x72, 0xE7, 0x19, 0xE7, 0x1A, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x76, 0xAE, 0xA6, 0x9F, 0xE9,
+    0x39, 0xD9, 0x3A, 0xC3, 0xD9, 0x5D, 0x19, 0xCA, 0x6D, 0x1A, 0xDA, 0xAF, 0xEA, 0x0F, 0xFF, 0xA0,
+    0xD9, 0x99, 0x70, 0xD9, 0x72, 0xDA, 0x72, 0xEA, 0x72, 0xFA, 0x99, 0x99, 0xAC, 0x2A, 0xFF, 0xD3,
+    0x9F, 0xFC, 0x5A, 0xAF, 0x91, 0x77, 0x9F, 0xFF, 0x1A, 0xFF, 0xEA, 0x1A, 0xFD, 0xAA, 0xAA, 0xA2,
+    0xAD, 0x73, 0xAD, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3F, 0xFD, 0x4F, 0xFD, 0x4F, 0xFD, 0x4E, 0x97,
+    0x2E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFA, 0x1F, 0xFF,
+    0xC1, 0xFF, 0xFC, 0x1F, 0xFF, 0xC6, 0xCA, 0x73, 0xAC, 0x74, 0xD7, 0x49, 0xEA, 0x73, 0x9A, 0x94,
+    0x5A, 0xA9, 0x70, 0xAF, 0xCA, 0x5E, 0x91, 0x9D, 0x3A, 0xCA, 0x5C, 0xA1, 0x9D, 0x6A, 0xC1, 0xAC,
+    0xA9, 0xAA, 0xAF, 0xC9, 0x0F, 0xFF, 0xA0, 0xDA, 0x99, 0x99, 0x6D, 0x97, 0x2D, 0xA7, 0x2A, 0xDA,
+    0x71, 0x9F, 0xA9, 0x99, 0x9A, 0xC2, 0xAF, 0xFD, 0x3A, 0xFF, 0xC5, 0xAF, 0xCA, 0x70, 0xCA, 0x72,
+    0xCA, 0x72, 0xAC, 0x73, 0xCA, 0x73, 0x9E, 0xA7, 0x29, 0xA9, 0x30, 0x77, 0x19, 0xC9, 0x3A, 0xC6,
+    0x9C, 0xA1, 0xD7, 0x09, 0xF7, 0x2A, 0xD7, 0x4A, 0x97, 0x77, 0x77, 0x77, 0x72, 0x9F, 0xFF, 0x1A,
+    0xFF, 0xEA, 0x1A, 0xFD, 0xAA, 0xAA, 0xA2, 0xAD, 0x73, 0xAD, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3F,
+    0xFD, 0x4F, 0xFD, 0x4F, 0xFD, 0x4E, 0x97, 0x2E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x99, 0x99,
+    0x99, 0x99, 0x92, 0xFF, 0xFA, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x29, 0x69, 0x4A,
+    0xC9, 0x29, 0xC9, 0x5A, 0xCA, 0x0A, 0xC9, 0x7A, 0xE9, 0x71, 0xAC, 0xA7, 0x39, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x0A, 0xEA, 0x69, 0xFE, 0x93, 0x9D, 0x93, 0xAC, 0x3D, 0x95, 0xD1, 0x9C, 0xA6, 0xD1,
+    0xAD, 0xAA, 0xFE, 0xA0, 0xFF, 0xFA, 0x0D, 0x99, 0x97, 0x0D, 0x97, 0x2D, 0xA7, 0x2E, 0xA7, 0x2F,
+    0xA9, 0x99, 0x9A, 0xC2, 0xAF, 0xFD, 0x39, 0xFF, 0xC5, 0xAA, 0xF9, 0x10, 0x71, 0x97, 0x71, 0x9D,
+    0x77, 0x9E, 0xA7, 0x59, 0xD0, 0xAC, 0xA7, 0x39, 0xCA, 0x29, 0xCA, 0x72, 0xA6, 0xA7, 0x77, 0x73,
+    0x99, 0x97, 0x29, 0xAF, 0xFC, 0xA5, 0x9F, 0xFF, 0xC4, 0x9F, 0xA9, 0x59, 0xA4, 0xF9, 0x75, 0x9E,
+    0x97, 0x6F, 0x77, 0xEA, 0x77, 0xE9, 0x77, 0xE9, 0x77, 0xE9, 0x77, 0xE9, 0x59, 0xAA, 0x99, 0x4E,
+    0x95, 0x9F, 0xEA, 0x0E, 0x96, 0x9A, 0xFC, 0xA0, 0xEA, 0x71, 0x9D, 0xAA, 0x0F, 0x71, 0x9D, 0x2A,
+    0xF9, 0x7A, 0xD2, 0x9F, 0xDA, 0xAA, 0xAA, 0xAF, 0x3A, 0xFF, 0xFE, 0x4F, 0xFF, 0xE9, 0x4A, 0xFF,
+    0xFA, 0x79, 0xAF, 0xDA, 0x93, 0x5A, 0xC7, 0x29, 0xDA, 0x70, 0x9D, 0xAC, 0xA6, 0x9C, 0xA1, 0x9C,
+    0xA4, 0x9C, 0x5A, 0xA7, 0x77, 0x71, 0xAE, 0x91, 0xD9, 0x2F, 0xDA, 0x9D, 0x2E, 0xAA, 0xFD, 0x19,
+    0xD3, 0xAF, 0x1D, 0x94, 0xF1, 0xD5, 0x9E, 0x1D, 0x59, 0xE1, 0xD5, 0x9E, 0x1D, 0x5A, 0xE1, 0xDA,
+    0x39, 0xF1, 0x9F, 0xFE, 0x2F, 0xFE, 0x3F, 0xFC, 0xA4, 0xAE, 0x90, 0xDA, 0x71, 0x9D, 0x97, 0x1E,
+    0x92, 0xC9, 0x29, 0xF3, 0xFF, 0xCA, 0x29, 0xFF, 0xC3, 0x9A, 0xFD, 0xA7, 0x09, 0x99, 0x50, 0x79,
+    0x99, 0x76, 0xCA, 0x5C, 0xA7, 0x1D, 0x93, 0xAC, 0x97, 0x2F, 0xF7, 0x39, 0xFD, 0x77, 0x99, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x59, 0x99, 0x72, 0x9A, 0xFF, 0xCA, 0x59, 0xFF, 0xFC, 0x49, 0xFA, 0x95,
+    0x9A, 0x4F, 0x97, 0x59, 0xE9, 0x76, 0xF7, 0x7E, 0xA7, 0x7E, 0x97, 0x7E, 0x97, 0x7E, 0x97, 0x7E,
+    0x95, 0x9A, 0xA9, 0x94, 0xE9, 0x59, 0xFE, 0xA0, 0xE9, 0x69, 0xAF, 0xCA, 0x0E, 0xA7, 0x19, 0xDA,
+    0xA0, 0xF7, 0x19, 0xD2, 0xAF, 0x97, 0xAD, 0x29, 0xFD, 0xAA, 0xAA, 0xAA, 0xF3, 0xAF, 0xFF, 0xE4,
+    0xFF, 0xFE, 0x94, 0xAF, 0xFF, 0xA7, 0x9A, 0xFD, 0xA9, 0x30, 0x19, 0xC5, 0x9C, 0x39, 0xC9, 0x4A,
+    0xC4, 0xDA, 0x99, 0x9A, 0xCA, 0x49, 0xFE, 0x7A, 0xE9, 0x77, 0x77, 0x77, 0x77, 0xAE, 0x91, 0xD9,
+    0x2F, 0xDA, 0x9D, 0x2E, 0xAA, 0xFD, 0x19, 0xD3, 0xAF, 0x1D, 0x94, 0xF1, 0xD5, 0x9E, 0x1D, 0x59,
+    0xE1, 0xD5, 0x9E, 0x1D, 0x5A, 0xE1, 0xDA, 0x39, 0xF1, 0x9F, 0xFE, 0x2F, 0xFE, 0x3F, 0xFC, 0xA4,
+    0xAE, 0x90, 0xDA, 0x71, 0x9D, 0x97, 0x1E, 0x92, 0xC9, 0x29, 0xF3, 0xFF, 0xCA, 0x29, 0xFF, 0xC3,
+    0x9A, 0xFD, 0xA7, 0x09, 0x99, 0x50, 0x77, 0x74, 0xAD, 0x97, 0x7E, 0x97, 0x7E, 0xA7, 0x7E, 0xA7,
+    0x77, 0x77, 0x77, 0x77, 0x59, 0x99, 0x72, 0x9A, 0xFF, 0xCA, 0x59, 0xFF, 0xFC, 0x49, 0xFA, 0x95,
+    0x9A, 0x4F, 0x97, 0x59, 0xE9, 0x76, 0xF7, 0x7E, 0xA7, 0x7E, 0x97, 0x7E, 0x97, 0x7E, 0x97, 0x7E,
+    0x95, 0x9A, 0xA9, 0x94, 0xE9, 0x59, 0xFE, 0xA0, 0xE9, 0x69, 0xAF, 0xCA, 0x0E, 0xA7, 0x19, 0xDA,
+    0xA0, 0xF7, 0x19, 0xD2, 0xAF, 0x97, 0xAD, 0x29, 0xFD, 0xAA, 0xAA, 0xAA, 0xF3, 0xAF, 0xFF, 0xE4,
+    0xFF, 0xFE, 0x94, 0xAF, 0xFF, 0xA7, 0x9A, 0xFD, 0xA9, 0x30, 0x5E, 0x71, 0x9E, 0x71, 0x9E, 0x71,
+    0xAE, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xE9, 0x1D, 0x92, 0xFD, 0xA9, 0xD2, 0xEA, 0xAF, 0xD1, 0x9D,
+    0x3A, 0xF1, 0xD9, 0x4F, 0x1D, 0x59, 0xE1, 0xD5, 0x9E, 0x1D, 0x59, 0xE1, 0xD5, 0xAE, 0x1D, 0xA3,
+    0x9F, 0x19, 0xFF, 0xE2, 0xFF, 0xE3, 0xFF, 0xCA, 0x4A, 0xE9, 0x0D, 0xA7, 0x19, 0xD9, 0x71, 0xE9,
+    0x2C, 0x92, 0x9F, 0x3F, 0xFC, 0xA2, 0x9F, 0xFC, 0x39, 0xAF, 0xDA, 0x70, 0x99, 0x95, 0x72, 0x99,
+    0x97, 0x29, 0xAF, 0xFC, 0xA5, 0x9F, 0xFF, 0xC4, 0x9F, 0xA9, 0x59, 0xA4, 0xF9, 0x75, 0x9E, 0x97,
+    0x6F, 0x77, 0xEA, 0x77, 0xE9, 0x77, 0xE9, 0x77, 0xE9, 0x77, 0xE9, 0x59, 0xAA, 0x99, 0x4E, 0x95,
+    0x9F, 0xEA, 0x0E, 0x96, 0x9A, 0xFC, 0xA0, 0xEA, 0x71, 0x9D, 0xAA, 0x0F, 0x71, 0x9D, 0x2A, 0xF9,
+    0x7A, 0xD2, 0x9F, 0xDA, 0xAA, 0xAA, 0xAF, 0x3A, 0xFF, 0xFE, 0x4F, 0xFF, 0xE9, 0x4A, 0xFF, 0xFA,
+    0x79, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4F, 0x77, 0xF7, 0x7E, 0xA7, 0x7E, 0x97,
+    0x69, 0xE7, 0x7F, 0x77, 0xEA, 0x70, 0x5F, 0x97, 0x0F, 0x71, 0xF7, 0x1E, 0x97, 0x09, 0xE7, 0x1A,
+    0xE7, 0x1E, 0xA7, 0x77, 0x74, 0xAE, 0x91, 0xD9, 0x2F, 0xDA, 0x9D, 0x2E, 0xAA, 0xFD, 0x19, 0xD3,
+    0xAF, 0x1D, 0x94, 0xF1, 0xD5, 0x9E, 0x1D, 0x59, 0xE1, 0xD5, 0x9E, 0x1D, 0x5A, 0xE1, 0xDA, 0x39,
+    0xF1, 0x9F, 0xFE, 0x2F, 0xFE, 0x3F, 0xFC, 0xA4, 0xAE, 0x90, 0xDA, 0x71, 0x9D, 0x97, 0x1E, 0x92,
+    0xC9, 0x29, 0xF3, 0xFF, 0xCA, 0x29, 0xFF, 0xC3, 0x9A, 0xFD, 0xA7, 0x09, 0x99, 0x50, 0x77, 0x72,
+    0xAC, 0x97, 0x69, 0xE7, 0x59, 0xD9, 0xD7, 0x39, 0xC9, 0x2A, 0xC7, 0x2A, 0x59, 0xA7, 0x77, 0x77,
+    0x3A, 0xD9, 0x70, 0xE2, 0xAD, 0x97, 0x0E, 0x2E, 0x97, 0x0E, 0x2E, 0x97, 0x0E, 0x91, 0xE9, 0x70,
+    0xE9, 0x1E, 0x97, 0x0E, 0x91, 0xE9, 0x70, 0xE9, 0x1E, 0xA7, 0x0E, 0x91, 0xEA, 0x70, 0xE9, 0x1E,
+    0xA7, 0x0E, 0xA1, 0xEA, 0x70, 0xEA, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF, 0xFA, 0x1F,
+    0xFF, 0xFA, 0x1F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x1F, 0x79, 0xF1, 0xF7, 0x9F, 0x1F, 0x79, 0xF1,
+    0xF7, 0x9F, 0x09, 0xF7, 0x9F, 0x00, 0x77, 0x3A, 0xC9, 0x73, 0x9E, 0x72, 0x9D, 0xAD, 0x70, 0x9C,
+    0xA2, 0xD7, 0xC9, 0x4A, 0xA7, 0x1A, 0xCA, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74,
+    0xD7, 0x5D, 0x75, 0xD1, 0x9A, 0xA9, 0x69, 0xD9, 0xFD, 0x94, 0x9F, 0xFD, 0x93, 0x9F, 0x29, 0xDA,
+    0x39, 0xE4, 0x9D, 0x3A, 0xD9, 0x5D, 0x3A, 0xD6, 0xD3, 0xAD, 0x6D, 0x92, 0xE6, 0xD9, 0x2E, 0x6D,
+    0x92, 0xE6, 0xD9, 0x2E, 0x59, 0xDA, 0x2E, 0x94, 0xAD, 0xA2, 0xE9, 0x4A, 0xDA, 0x1A, 0xD7, 0x1A,
+    0xD3, 0xAD, 0x97, 0x0E, 0x3A, 0xD9, 0x70, 0xE3, 0xE9, 0x70, 0xE9, 0x2E, 0x97, 0x0E, 0x92, 0xE9,
+    0x70, 0xE9, 0x2E, 0x97, 0x0E, 0x90, 0x9F, 0xFF, 0xFD, 0xAA, 0xFF, 0xFF, 0xD9, 0x09, 0xEA, 0x99,
+    0x99, 0x99, 0x99, 0x9E, 0xA2, 0xEA, 0x70, 0xEA, 0x2F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA2, 0xFF,
+    0xFF, 0xA2, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xC2, 0xF7, 0x9F, 0x2F, 0x79, 0xF2,
+    0xF7, 0x9F, 0x2F, 0x79, 0xF1, 0x9F, 0x79, 0xF0, 0x3A, 0xCA, 0x74, 0xDA, 0x74, 0xD9, 0x70, 0x9A,
+    0xAF, 0xE5, 0xFE, 0xAA, 0xA7, 0x1D, 0x75, 0xD7, 0x5D, 0x19, 0xAA, 0x96, 0x9D, 0x9F, 0xD9, 0x49,
+    0xFF, 0xD9, 0x39, 0xF2, 0x9D, 0xA3, 0xAE, 0x49, 0xD3, 0xAD, 0x95, 0xD3, 0xAD, 0x6D, 0x3A, 0xD6,
+    0xD9, 0x2E, 0x6D, 0x92, 0xE6, 0xD9, 0x2E, 0x6D, 0x92, 0xE5, 0x9D, 0xA2, 0xE9, 0x4A, 0xDA, 0x2E,
+    0x94, 0xAD, 0xA0, 0x72, 0x9E, 0x2C, 0xA0, 0xD0, 0xD1, 0xC9, 0x0C, 0xA1, 0xDA, 0xC9, 0x0C, 0x92,
+    0xDA, 0x77, 0x77, 0x77, 0x59, 0xE5, 0x9E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E,
+    0x6E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0xA5, 0xEA, 0x49, 0xEA, 0x49, 0xF4, 0x9F, 0x49, 0xF1,
+    0x72, 0xEA, 0x19, 0xC0, 0x9C, 0x09, 0xCA, 0x0A, 0xC0, 0xAC, 0x19, 0xEA, 0x09, 0xA3, 0x99, 0x77,
+    0x77, 0x29, 0xCA, 0x69, 0xCA, 0x69, 0xCA, 0x69, 0xCA, 0x69, 0xCA, 0x69, 0xCA, 0x69, 0xCA, 0x6A,
+    0xCA, 0x6A, 0xD6, 0xAD, 0x6E, 0x6E, 0x6E, 0x6E, 0x92, 0x71, 0x91, 0x9A, 0xFF, 0x90, 0xFF, 0xAA,
+    0x97, 0x77, 0x77, 0x77, 0x79, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E,
+    0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0xA7, 0xEA, 0x69, 0xEA,
+    0x69, 0xF6, 0x9F, 0x69, 0xF2, 0x74, 0xAF, 0xFC, 0x0A, 0xFE, 0xAA, 0xA7, 0x77, 0x77, 0x1A, 0x97,
+    0x09, 0xCA, 0x70, 0x9C, 0xA7, 0x09, 0xCA, 0x70, 0x9C, 0xA7, 0x09, 0xCA, 0x70, 0x9C, 0xA7, 0x0A,
+    0xCA, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x40, 0x6A, 0xE1, 0x9E, 0x19,
+    0xE1, 0x9E, 0x19, 0xE1, 0x9E, 0x19, 0xE1, 0x9E, 0x19, 0xE1, 0x9E, 0x19, 0xE1, 0x9E, 0x19, 0xE1,
+    0x9E, 0x19, 0xE1, 0x9E, 0x90, 0x9E, 0x90, 0xAE, 0x90, 0xAE, 0xA0, 0xAE, 0xA0, 0xAE, 0xA1, 0xCA,
+    0x2C, 0xA3, 0xC4, 0xDA, 0xA2, 0xAD, 0x60, 0x1A, 0xD2, 0xE9, 0x1E, 0x90, 0x9E, 0xA7, 0x77, 0x19,
+    0xCA, 0x29, 0xCA, 0x29, 0xCA, 0x29, 0xCA, 0x29, 0xCA, 0x29, 0xCA, 0x29, 0xCA, 0x2A, 0xCA, 0x2A,
+    0xD2, 0xAD, 0x2E, 0x2E, 0x2E, 0x2E, 0x91, 0xC9, 0x2C, 0xA3, 0xC4, 0xDA, 0xA2, 0xAD, 0x60, 0x0E,
+    0x09, 0xE0, 0x9E, 0x0A, 0xE7, 0x77, 0x29, 0x99, 0x09, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1,
+    0xE1, 0xE1, 0xE1, 0xE1, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xEA, 0x0E, 0xA9, 0xEA, 0x9F, 0x9F,
+    0x9F, 0x1C, 0xA1, 0x9C, 0xA1, 0x9C, 0xA1, 0x9C, 0xA1, 0x9C, 0xA1, 0x9C, 0xA1, 0x9C, 0xA1, 0xAC,
+    0xA1, 0xAD, 0x1A, 0xD1, 0xE1, 0xE1, 0xE1, 0xE9, 0x77, 0x9E, 0x69, 0xE1, 0xE6, 0x9E, 0x1E, 0x69,
+    0xE1, 0xE6, 0x9E, 0x1E, 0x69, 0xE1, 0xE6, 0x9E, 0x1E, 0x6A, 0xE1, 0xE6, 0xAE, 0x1E, 0x6A, 0xE1,
+    0xE6, 0xAE, 0x1E, 0x6A, 0xDA, 0x1E, 0x95, 0xAD, 0xA1, 0xE9, 0x5A, 0xDA, 0x1E, 0x95, 0xAD, 0xA1,
+    0xE9, 0x5E, 0xA1, 0xEA, 0x5E, 0x91, 0xEA, 0x5E, 0x90, 0x9E, 0xA5, 0xE9, 0x09, 0xF5, 0xE9, 0x09,
+    0xF5, 0xE9, 0x09, 0xF5, 0xE7, 0x3A, 0xE7, 0xA9, 0x9F, 0xC7, 0xFE, 0x97, 0xFE, 0x70, 0xFD, 0x71,
+    0xFA, 0x40, 0x0A, 0xD7, 0x7E, 0x97, 0x1E, 0x1E, 0x97, 0x1E, 0x09, 0xEA, 0x70, 0x9E, 0x76, 0xAE,
+    0x97, 0x77, 0x77, 0x77, 0x19, 0xCA, 0x72, 0x9A, 0x91, 0x9C, 0xA7, 0x2A, 0xD1, 0x9C, 0xA7, 0x2A,
+    0xCA, 0x19, 0xCA, 0x72, 0xAC, 0xA1, 0x9C, 0xA7, 0x2A, 0xCA, 0x19, 0xCA, 0x72, 0xAC, 0xA1, 0x9C,
+    0xA7, 0x2A, 0xC9, 0x1A, 0xCA, 0x72, 0xD9, 0x1A, 0xD7, 0x2D, 0x91, 0xAD, 0x72, 0xD9, 0x1E, 0x72,
+    0xD9, 0x1E, 0x72, 0xD2, 0xE7, 0x2D, 0x2E, 0x97, 0x1D, 0x77, 0x0D, 0x77, 0x9D, 0x77, 0xE7, 0x39,
+    0x9A, 0xEA, 0x73, 0xFD, 0x73, 0x9F, 0xA7, 0x76, 0x5A, 0x71, 0xDA, 0x7A, 0xE9, 0x5A, 0xC9, 0x0A,
+    0xC9, 0x3D, 0x39, 0xC9, 0x29, 0x29, 0xE9, 0x69, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE,
+    0x7A, 0xE7, 0xAD, 0xA7, 0xAD, 0xA7, 0xEA, 0x7E, 0xA7, 0xEA, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9,
+    0x7E, 0x97, 0xE7, 0x0E, 0x70, 0xE7, 0xAE, 0x39, 0x1A, 0xF3, 0xFE, 0x93, 0xFE, 0x4F, 0xD9, 0x4F,
+    0xC7, 0x99, 0x70, 0x6A, 0xA7, 0x1A, 0xD9, 0x79, 0xF6, 0x9C, 0xA1, 0xD4, 0xAC, 0x49, 0xC7, 0x77,
+    0x71, 0xD9, 0x71, 0xD7, 0x2D, 0x72, 0xD7, 0x2D, 0x72, 0xD7, 0x2D, 0x71, 0x9D, 0x71, 0x9D, 0x71,
+    0x9D, 0x71, 0x9D, 0x71, 0x9C, 0xA7, 0x19, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xD9, 0x79,
+    0xE9, 0x49, 0xFD, 0x5F, 0xD6, 0x99, 0x99, 0x70, 0x19, 0xDA, 0x3A, 0xE4, 0xAD, 0x92, 0x9E, 0x5A,
+    0xD9, 0x2E, 0xA5, 0xAD, 0x91, 0xAE, 0x6E, 0x2E, 0x96, 0xE1, 0xF7, 0xE0, 0x9E, 0x70, 0xE0, 0xEA,
+    0x70, 0xEA, 0xE7, 0x09, 0xFD, 0x97, 0x09, 0xFD, 0x71, 0x9F, 0xCA, 0x71, 0xAF, 0xD9, 0x70, 0xAF,
+    0xE9, 0x7A, 0xDA, 0xAF, 0x96, 0xEA, 0x0F, 0xC9, 0x5E, 0xA1, 0xFC, 0x94, 0xEA, 0x19, 0xFC, 0x93,
+    0xE9, 0x2A, 0xFC, 0x92, 0xE9, 0x3F, 0xD9, 0x1E, 0x94, 0xFD, 0x97, 0x75, 0x99, 0x99, 0x73, 0x9F,
+    0x73, 0x9E, 0xA7, 0x3A, 0xE9, 0x73, 0xAE, 0x74, 0xF7, 0x4E, 0xA7, 0x39, 0xE9, 0x70, 0x1D, 0x97,
+    0x2D, 0x97, 0x19, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x2A, 0xD2, 0xDA, 0x4A,
+    0xD1, 0xE5, 0xAD, 0x0E, 0x6A, 0xDA, 0xD9, 0x6A, 0xFA, 0x7F, 0xC7, 0x0F, 0xD7, 0xFE, 0x6E, 0x0F,
+    0x5E, 0x09, 0xF4, 0xE1, 0xAF, 0x3E, 0x2A, 0xF2, 0xE3, 0xFC, 0x77, 0x77, 0x77, 0x74, 0xF7, 0x09,
+    0xEA, 0x70, 0x9E, 0x97, 0x09, 0xE7, 0x1A, 0xE7, 0x1E, 0xA7, 0x09, 0xE9, 0x60, 0x29, 0x29, 0x94,
+    0xD1, 0x9D, 0x4D, 0x1D, 0x94, 0xD0, 0xAC, 0xA5, 0xCA, 0x0D, 0x59, 0xCA, 0xD9, 0x59, 0xF6, 0x9E,
+    0x96, 0xAE, 0xA6, 0xAF, 0xA5, 0xAC, 0x9A, 0xDA, 0x4D, 0x90, 0xEA, 0x3D, 0x91, 0xEA, 0x2D, 0x91,
+    0x9E, 0xA0, 0x2A, 0xC7, 0x3D, 0x72, 0xAC, 0xA7, 0x2D, 0x72, 0xAD, 0x77, 0x77, 0x77, 0x59, 0x99,
+    0x71, 0x9D, 0xA7, 0x19, 0xDA, 0x71, 0x9D, 0xA7, 0x19, 0xDA, 0x71, 0x9D, 0xA7, 0x1A, 0xDA, 0x71,
+    0xAD, 0xA7, 0x1A, 0xD9, 0x71, 0xAD, 0x97, 0x1A, 0xD9, 0x71, 0xE9, 0x71, 0xE9, 0x71, 0xE9, 0x71,
+    0xE9, 0x71, 0xE9, 0x71, 0xE7, 0x2E, 0x70, 0x90, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xC0, 0x3D, 0x39, 0xCA, 0x3A, 0xC9, 0x3D, 0x3A, 0xCA, 0x77, 0x76, 0x9D, 0x39, 0xD3, 0xAD,
+    0x3A, 0xD3, 0xDA, 0x3D, 0xA3, 0xDA, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x29, 0xD9, 0x29, 0xD9,
+    0x29, 0xD9, 0x29, 0xD9, 0x29, 0xD9, 0x29, 0xD9, 0x29, 0xFC, 0x09, 0xFC, 0x99, 0xFC, 0xA0, 0x76,
+    0x9D, 0xA7, 0x19, 0xDA, 0x71, 0x9D, 0xA7, 0x19, 0xDA, 0x71, 0x9D, 0xA7, 0x1A, 0xDA, 0x71, 0xAD,
+    0xA7, 0x1A, 0xD9, 0x71, 0xAD, 0x97, 0x1A, 0xD9, 0x71, 0xE9, 0x71, 0xE9, 0x71, 0xE9, 0x71, 0xE9,
+    0x71, 0xE9, 0x71, 0xE7, 0x2E, 0x70, 0x90, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xC7, 0x77, 0x77, 0x77, 0x4A, 0xEA, 0x70, 0xAE, 0x97, 0x0F, 0x71, 0xF7, 0x1E, 0x97, 0x09, 0xE7,
+    0x1F, 0x50, 0x79, 0xD3, 0x9D, 0x3A, 0xD3, 0xAD, 0x3D, 0xA3, 0xDA, 0x3D, 0xA3, 0xD9, 0x3D, 0x93,
+    0xD9, 0x3D, 0x92, 0x9D, 0x92, 0x9D, 0x92, 0x9D, 0x92, 0x9D, 0x92, 0x9D, 0x92, 0x9D, 0x92, 0x9F,
+    0xC0, 0x9F, 0xC9, 0x9F, 0xCA, 0x77, 0x6F, 0x19, 0xF1, 0x9E, 0x91, 0x9E, 0x2A, 0xE2, 0xEA, 0x19,
+    0xE9, 0x70, 0x76, 0x9D, 0xA7, 0x19, 0xDA, 0x71, 0x9D, 0xA7, 0x19, 0xDA, 0x71, 0x9D, 0xA4, 0x99,
+    0x2A, 0xDA, 0x4D, 0x2A, 0xDA, 0x4D, 0x2A, 0xD9, 0x4D, 0x2A, 0xD9, 0x39, 0xD2, 0xAD, 0x93, 0x9D,
+    0x2E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x72, 0xE7, 0x09, 0x0F, 0xFF,
+    0xC0, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x79, 0x7A, 0xC9, 0x09, 0xD2, 0xAC, 0x90, 0x9D,
+    0x2D, 0x90, 0xAD, 0x2D, 0x90, 0xAD, 0x2D, 0x1D, 0xA6, 0xDA, 0x6D, 0xA6, 0xD9, 0x6D, 0x96, 0xD9,
+    0x6D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9F, 0xC3,
+    0x9F, 0xC9, 0x29, 0xFC, 0xA2, 0x19, 0x99, 0x71, 0x9D, 0xA7, 0x19, 0xDA, 0x71, 0x9D, 0xA7, 0x19,
+    0xDA, 0x71, 0x9D, 0xA3, 0x9D, 0xA1, 0xAD, 0xA3, 0xAD, 0xA1, 0xAD, 0xA3, 0xAE, 0x1A, 0xD9, 0x3F,
+    0x1A, 0xD9, 0x71, 0xAD, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E,
+    0x72, 0xE7, 0x09, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x73, 0x9D, 0x79,
+    0xD7, 0xAD, 0x7A, 0xD7, 0xDA, 0x7D, 0xA2, 0xE1, 0xDA, 0x2E, 0x1D, 0x91, 0x9E, 0x1D, 0x91, 0xAE,
+    0x90, 0xD9, 0x7D, 0x96, 0x9D, 0x96, 0x9D, 0x96, 0x9D, 0x96, 0x9D, 0x96, 0x9D, 0x96, 0x9D, 0x96,
+    0x9F, 0xC4, 0x9F, 0xC9, 0x39, 0xFC, 0xA3, 0x77, 0x59, 0x97, 0x74, 0xD7, 0x74, 0xD9, 0x77, 0x39,
+    0xD7, 0x74, 0xD7, 0x74, 0xAC, 0xA7, 0x59, 0xDA, 0x19, 0xD7, 0x69, 0xDA, 0x1D, 0x97, 0x69, 0xDA,
+    0x0A, 0xD7, 0x79, 0xDA, 0x0D, 0x97, 0x79, 0xDA, 0xDA, 0x77, 0x0A, 0xFC, 0x77, 0x1A, 0xF9, 0x77,
+    0x1A, 0xF7, 0x72, 0xAE, 0x97, 0x72, 0xAD, 0xA7, 0x73, 0xE9, 0x77, 0x3E, 0x97, 0x72, 0xAE, 0x97,
+    0x71, 0x9F, 0x97, 0x71, 0xFC, 0x97, 0x70, 0xAF, 0xC7, 0x71, 0xDA, 0xE7, 0x09, 0x6E, 0x0F, 0xFF,
+    0xC5, 0x9D, 0x90, 0xFF, 0xFC, 0x5E, 0x1F, 0xFF, 0xC4, 0xAD, 0x2F, 0xFF, 0xC3, 0x9D, 0xA7, 0x73,
+    0xE7, 0x73, 0xAD, 0x97, 0x73, 0xE7, 0x73, 0xE9, 0x77, 0x29, 0xD9, 0x77, 0x3A, 0x97, 0x74, 0x77,
+    0x70, 0x9D, 0x74, 0x9D, 0x74, 0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xD9,
+    0x74, 0xD9, 0x09, 0xA9, 0x70, 0xDA, 0xDA, 0x70, 0x9E, 0xA7, 0x1A, 0xE9, 0x70, 0xAF, 0xC7, 0xAD,
+    0xA0, 0x9D, 0x94, 0xAE, 0x91, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xFC, 0x71, 0x9F,
+    0xC9, 0x70, 0x9F, 0xCA, 0x00, 0x72, 0xCA, 0x77, 0xAC, 0x97, 0x7D, 0x77, 0xAC, 0xA7, 0x7D, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x69, 0x99, 0x29, 0xAA, 0xA7, 0x0E, 0x2A, 0xE9, 0x7E, 0x2F, 0xC7, 0xE2,
+    0xFC, 0x95, 0x9E, 0x2F, 0xD5, 0x9E, 0x2F, 0xD5, 0x9E, 0x2F, 0xDA, 0x4A, 0xE2, 0xE9, 0xE4, 0xAD,
+    0xA1, 0x9E, 0x0E, 0xA3, 0xAD, 0xA1, 0x9E, 0x09, 0xE3, 0xEA, 0x19, 0xE1, 0xEA, 0x2E, 0xA1, 0xAE,
+    0x19, 0xE2, 0xEA, 0x1A, 0xE2, 0xEA, 0x1E, 0x91, 0xAE, 0x29, 0xE1, 0xE9, 0x1F, 0x3E, 0x90, 0xE9,
+    0x1F, 0x39, 0xE9, 0xE9, 0x1F, 0x93, 0xEA, 0xE9, 0x1F, 0x93, 0xAF, 0xD2, 0xF9, 0x4F, 0xD2, 0xF9,
+    0x4A, 0xFC, 0x2F, 0x95, 0xFC, 0x10, 0x70, 0xC9, 0x72, 0xAC, 0x73, 0xD7, 0x2A, 0xC9, 0x72, 0xD7,
+    0x77, 0x77, 0x77, 0x77, 0x4C, 0xA0, 0x9E, 0xA4, 0x9F, 0xFC, 0x92, 0x9F, 0x90, 0x9E, 0x29, 0xE4,
+    0xDA, 0x1A, 0xD9, 0x4A, 0xCA, 0x1A, 0xD5, 0xAD, 0x1A, 0xD5, 0xAD, 0x1A, 0xD5, 0xAD, 0x1E, 0x94,
+    0xE1, 0xE9, 0x4E, 0x1E, 0x94, 0xE9, 0x0E, 0x94, 0xE9, 0x0E, 0x94, 0xE9, 0x0E, 0x94, 0xE9, 0x77,
+    0x49, 0x99, 0x97, 0x0E, 0x2A, 0xE9, 0x7E, 0x2F, 0xA7, 0xE2, 0xFC, 0x69, 0xE2, 0xFC, 0xA5, 0x9E,
+    0x2F, 0xD5, 0x9E, 0x2F, 0xDA, 0x4A, 0xE2, 0xE9, 0xE4, 0xAD, 0xA1, 0x9E, 0x0E, 0xA3, 0xAD, 0xA1,
+    0x9E, 0x09, 0xE3, 0xAD, 0xA1, 0x9E, 0x1E, 0xA2, 0xEA, 0x1A, 0xE1, 0x9E, 0x2E, 0xA1, 0xAE, 0x2E,
+    0x91, 0xE9, 0x1A, 0xE2, 0x9E, 0x1E, 0x91, 0xAE, 0x3E, 0x90, 0xE9, 0x1F, 0x3A, 0xE9, 0xE9, 0x1F,
+    0x93, 0xEA, 0xE9, 0x1F, 0x93, 0xAF, 0xD2, 0xF9, 0x4F, 0xD2, 0xF9, 0x4A, 0xFC, 0x2F, 0x95, 0xFC,
+    0x77, 0x73, 0x99, 0x99, 0x76, 0xF7, 0x6E, 0xA7, 0x59, 0xE9, 0x75, 0x9E, 0x76, 0xF7, 0x6E, 0x97,
+    0x77, 0x30, 0x1C, 0xA0, 0x9E, 0xA4, 0x9F, 0xFC, 0x92, 0x9F, 0x90, 0x9E, 0x29, 0xE4, 0xDA, 0x1A,
+    0xD9, 0x4A, 0xCA, 0x1A, 0xD5, 0xAD, 0x1A, 0xD5, 0xAD, 0x1A, 0xD5, 0xAD, 0x1E, 0x94, 0xE1, 0xE9,
+    0x4E, 0x1E, 0x94, 0xE9, 0x0E, 0x94, 0xE9, 0x0E, 0x94, 0xE9, 0x0E, 0x94, 0xE9, 0x77, 0x29, 0x99,
+    0x97, 0x1F, 0x70, 0x9E, 0xA7, 0x09, 0xE9, 0x70, 0x9E, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x73, 0x77,
+    0x70, 0xCA, 0x39, 0xC9, 0x72, 0xD1, 0xAC, 0x97, 0x4F, 0x97, 0x6D, 0xA7, 0x79, 0xA7, 0x77, 0x77,
+    0x77, 0x72, 0x99, 0x99, 0x70, 0xE2, 0xAE, 0x97, 0xE2, 0xFA, 0x7E, 0x2F, 0xC6, 0x9E, 0x2F, 0xCA,
+    0x59, 0xE2, 0xFD, 0x59, 0xE2, 0xFD, 0xA4, 0xAE, 0x2E, 0x9E, 0x4A, 0xDA, 0x19, 0xE0, 0xEA, 0x3A,
+    0xDA, 0x19, 0xE0, 0x9E, 0x3A, 0xDA, 0x19, 0xE1, 0xEA, 0x2E, 0xA1, 0xAE, 0x19, 0xE2, 0xEA, 0x1A,
+    0xE2, 0xE9, 0x1E, 0x91, 0xAE, 0x29, 0xE1, 0xE9, 0x1A, 0xE3, 0xE9, 0x0E, 0x91, 0xF3, 0xAE, 0x9E,
+    0x91, 0xF9, 0x3E, 0xAE, 0x91, 0xF9, 0x3A, 0xFD, 0x2F, 0x94, 0xFD, 0x2F, 0x94, 0xAF, 0xC2, 0xF9,
+    0x5F, 0xC1, 0x29, 0x95, 0x99, 0x4C, 0xA3, 0xAC, 0x6D, 0x99, 0xD7, 0x0F, 0x72, 0xD7, 0x39, 0x97,
+    0x77, 0x77, 0x77, 0x6C, 0xA0, 0x9E, 0xA4, 0x9F, 0xFC, 0x92, 0x9F, 0x90, 0x9E, 0x29, 0xE4, 0xDA,
+    0x1A, 0xD9, 0x4A, 0xCA, 0x1A, 0xD5, 0xAD, 0x1A, 0xD5, 0xAD, 0x1A, 0xD5, 0xAD, 0x1E, 0x94, 0xE1,
+    0xE9, 0x4E, 0x1E, 0x94, 0xE9, 0x0E, 0x94, 0xE9, 0x0E, 0x94, 0xE9, 0x0E, 0x94, 0xE9, 0x71, 0x99,
+    0x71, 0x9D, 0x97, 0x09, 0xDA, 0x70, 0x9E, 0x70, 0x9E, 0x71, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x74, 0xCA, 0x09, 0xAD, 0xA9, 0x4F, 0xFC, 0xA3, 0xF9, 0x1A, 0xD2, 0x9E, 0x4D, 0xA1, 0x9D, 0xA4,
+    0xAD, 0x19, 0xD9, 0x4A, 0xD1, 0x9D, 0x94, 0xAD, 0x1A, 0xD9, 0x4A, 0xD9, 0x0A, 0xD9, 0x4A, 0xD9,
+    0x0A, 0xD9, 0x4A, 0xD9, 0x0E, 0xA4, 0xAD, 0x90, 0xEA, 0x4A, 0xDA, 0x0E, 0xA4, 0xAD, 0xA0, 0xEA,
+    0x4A, 0xDA, 0x77, 0x49, 0x99, 0x97, 0x0E, 0x2A, 0xE9, 0x7E, 0x2F, 0xA7, 0xE2, 0xFC, 0x69, 0xE2,
+    0xFC, 0xA5, 0x9E, 0x2F, 0xD5, 0x9E, 0x2F, 0xDA, 0x4A, 0xE2, 0xE9, 0xE4, 0xAD, 0xA1, 0x9E, 0x0E,
+    0xA3, 0xAD, 0xA1, 0x9E, 0x09, 0xE3, 0xAD, 0xA1, 0x9E, 0x1E, 0xA2, 0xEA, 0x1A, 0xE1, 0x9E, 0x2E,
+    0xA1, 0xAE, 0x2E, 0x91, 0xE9, 0x1A, 0xE2, 0x9E, 0x1E, 0x91, 0xAE, 0x3E, 0x90, 0xE9, 0x1F, 0x3A,
+    0xE9, 0xE9, 0x1F, 0x93, 0xEA, 0xE9, 0x1F, 0x93, 0xAF, 0xD2, 0xF9, 0x4F, 0xD2, 0xF9, 0x4A, 0xFC,
+    0x2F, 0x95, 0xFC, 0x74, 0x9F, 0xA7, 0x19, 0xAF, 0xD7, 0x2F, 0xCA, 0x97, 0x29, 0xAA, 0x97, 0x1C,
+    0xA0, 0x9E, 0xA4, 0x9F, 0xFC, 0x92, 0x9F, 0x90, 0x9E, 0x29, 0xE4, 0xDA, 0x1A, 0xD9, 0x4A, 0xCA,
+    0x1A, 0xD5, 0xAD, 0x1A, 0xD5, 0xAD, 0x1A, 0xD5, 0xAD, 0x1E, 0x94, 0xE1, 0xE9, 0x4E, 0x1E, 0x94,
+    0xE9, 0x0E, 0x94, 0xE9, 0x0E, 0x94, 0xE9, 0x0E, 0x94, 0xEA, 0x71, 0xE9, 0x70, 0xAE, 0x96, 0xFD,
+    0x7F, 0xA9, 0x76, 0x77, 0x71, 0xAA, 0xAF, 0xDA, 0x70, 0xFF, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x59,
+    0xAF, 0xCA, 0x97, 0x09, 0xFF, 0xE6, 0xAF, 0xA9, 0x99, 0xFC, 0x93, 0x9F, 0x59, 0xF3, 0xF7, 0x9E,
+    0xA1, 0x9E, 0x71, 0xAE, 0x1E, 0xA7, 0x2E, 0x90, 0xE7, 0x3A, 0xDA, 0x0E, 0x73, 0x9D, 0xA0, 0xE7,
+    0x39, 0xE9, 0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xE7, 0x39, 0xDA, 0x0E, 0x97, 0x2E, 0xA0, 0xF9,
+    0x70, 0xAE, 0x90, 0x9F, 0xCA, 0x99, 0x99, 0x9A, 0xFC, 0x2F, 0xFF, 0xFA, 0x29, 0xFF, 0xFE, 0x4A,
+    0xFF, 0xFC, 0x95, 0xAF, 0xFE, 0x97, 0x09, 0xAF, 0xCA, 0x97, 0x77, 0x00, 0x29, 0xAA, 0xAA, 0xF9,
+    0x2F, 0xFD, 0xA2, 0x99, 0x77, 0x77, 0x77, 0x77, 0x59, 0xAE, 0xA6, 0xAF, 0xEA, 0x3E, 0xA9, 0x09,
+    0xAD, 0x91, 0x9D, 0x59, 0xD1, 0xDA, 0x6D, 0x90, 0xD9, 0x6D, 0xA0, 0xD9, 0x6A, 0xD0, 0xD9, 0x6A,
+    0xD0, 0xDA, 0x6D, 0xA0, 0xE9, 0x4A, 0xD9, 0x09, 0xFC, 0xAF, 0xC2, 0xFF, 0xD9, 0x3A, 0xFE, 0x95,
+    0x9F, 0xA3, 0x49, 0xC9, 0x49, 0xC9, 0x71, 0xCA, 0x4A, 0xC7, 0x2D, 0xA9, 0x99, 0xAC, 0xA7, 0x3F,
+    0xE7, 0x5A, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xFC, 0xA9, 0x70, 0x9F, 0xFE, 0x6A, 0xFA,
+    0x99, 0x9F, 0xC9, 0x39, 0xF5, 0x9F, 0x3F, 0x79, 0xEA, 0x19, 0xE7, 0x1A, 0xE1, 0xEA, 0x72, 0xE9,
+    0x0E, 0x73, 0xAD, 0xA0, 0xE7, 0x39, 0xDA, 0x0E, 0x73, 0x9E, 0x9D, 0xA7, 0x4E, 0x0E, 0x74, 0xDA,
+    0x0E, 0x73, 0x9D, 0xA0, 0xE9, 0x72, 0xEA, 0x0F, 0x97, 0x0A, 0xE9, 0x09, 0xFC, 0xA9, 0x99, 0x99,
+    0xAF, 0xC2, 0xFF, 0xFF, 0xA2, 0x9F, 0xFF, 0xE4, 0xAF, 0xFF, 0xC9, 0x5A, 0xFF, 0xE9, 0x70, 0x9A,
+    0xFC, 0xA9, 0x77, 0x70, 0x19, 0xC9, 0x93, 0x9C, 0x39, 0xC5, 0xAC, 0x4D, 0x39, 0xCA, 0x4A, 0xFE,
+    0x69, 0xFA, 0x72, 0x97, 0x77, 0x77, 0x77, 0x77, 0x79, 0xAE, 0xA6, 0xAF, 0xEA, 0x3E, 0xA9, 0x09,
+    0xAD, 0x91, 0x9D, 0x59, 0xD1, 0xDA, 0x6D, 0x90, 0xD9, 0x6D, 0xA0, 0xD9, 0x6A, 0xD0, 0xD9, 0x6A,
+    0xD0, 0xDA, 0x6D, 0xA0, 0xE9, 0x4A, 0xD9, 0x09, 0xFC, 0xAF, 0xC2, 0xFF, 0xD9, 0x3A, 0xFE, 0x95,
+    0x9F, 0xA3, 0x6A, 0xA9, 0x69, 0xAA, 0x6D, 0xA6, 0xAD, 0x59, 0xDA, 0x6E, 0x5A, 0xDA, 0x59, 0xDA,
+    0x77, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xFC, 0xA9, 0x71, 0x9F, 0xFE, 0x7A, 0xFA, 0x99, 0x9F, 0xC9,
+    0x49, 0xF5, 0x9F, 0x4F, 0x79, 0xEA, 0x29, 0xE7, 0x1A, 0xE2, 0xEA, 0x72, 0xE9, 0x1E, 0x73, 0xAD,
+    0xA1, 0xE7, 0x39, 0xDA, 0x1E, 0x73, 0x9E, 0x09, 0xDA, 0x74, 0xE1, 0xE7, 0x4D, 0xA1, 0xE7, 0x39,
+    0xDA, 0x1E, 0x97, 0x2E, 0xA1, 0xF9, 0x70, 0xAE, 0x91, 0x9F, 0xCA, 0x99, 0x99, 0x9A, 0xFC, 0x3F,
+    0xFF, 0xFA, 0x39, 0xFF, 0xFE, 0x5A, 0xFF, 0xFC, 0x96, 0xAF, 0xFE, 0x97, 0x19, 0xAF, 0xCA, 0x97,
+    0x77, 0x20, 0x77, 0x69, 0xD6, 0x9D, 0x93, 0xAD, 0x6A, 0xD9, 0x29, 0xE6, 0xE9, 0x39, 0x97, 0x99,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAE, 0xA7, 0x3A, 0xFE, 0xA7, 0x0E, 0xA9, 0x09,
+    0xAD, 0x96, 0x9D, 0x59, 0xD6, 0xDA, 0x6D, 0x95, 0xD9, 0x6D, 0xA5, 0xD9, 0x6A, 0xD5, 0xD9, 0x6A,
+    0xD5, 0xDA, 0x6D, 0xA5, 0xE9, 0x4A, 0xD9, 0x59, 0xFC, 0xAF, 0xC7, 0xFF, 0xD9, 0x70, 0xAF, 0xE9,
+    0x72, 0x9F, 0xA7, 0x59, 0xAF, 0xCA, 0x09, 0xAA, 0xAA, 0xAA, 0xAF, 0xA4, 0x9F, 0xFF, 0xFF, 0xDA,
+    0x3A, 0xFA, 0x99, 0x9F, 0xFF, 0xE9, 0x2A, 0xF5, 0x9F, 0x97, 0x3E, 0xA7, 0x0E, 0xA7, 0x2A, 0xE7,
+    0x1F, 0x72, 0xEA, 0x71, 0xF9, 0x71, 0xE7, 0x2F, 0xA7, 0x1E, 0x72, 0xFF, 0xD4, 0xE7, 0x2F, 0xFD,
+    0x4D, 0xA7, 0x2F, 0xFD, 0x4E, 0x72, 0xFC, 0x71, 0xE7, 0x2F, 0xA7, 0x1E, 0xA7, 0x1F, 0x97, 0x1F,
+    0x97, 0x0F, 0x97, 0x19, 0xFC, 0xA9, 0x99, 0x99, 0xAF, 0xC7, 0x3F, 0xFF, 0xFC, 0x99, 0x99, 0x99,
+    0x99, 0x39, 0xFF, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xFF, 0xF4, 0x9F, 0xFF, 0xFF, 0xE6, 0x9A, 0xFC,
+    0xAA, 0xFF, 0xFC, 0x00, 0x77, 0x9A, 0xA9, 0x70, 0x9A, 0xEA, 0x92, 0xAF, 0xD9, 0x5A, 0xFE, 0xA0,
+    0xAD, 0x92, 0xAC, 0x93, 0xEA, 0x90, 0x9A, 0xFC, 0x5A, 0xC2, 0x9D, 0x59, 0xE6, 0x9C, 0xA1, 0xDA,
+    0x6E, 0x99, 0xAA, 0xFD, 0x1D, 0x96, 0xAF, 0xFF, 0x1D, 0x96, 0xAD, 0x99, 0x99, 0x7D, 0x96, 0xE7,
+    0x3D, 0xA6, 0xE7, 0x3E, 0x94, 0x9F, 0x72, 0x9F, 0xCA, 0xFF, 0xCA, 0x99, 0x99, 0xCA, 0x2F, 0xFD,
+    0xAF, 0xFD, 0xA3, 0xAF, 0xEA, 0x09, 0xFF, 0xCA, 0x49, 0xFA, 0x49, 0xAF, 0xA9, 0x10, 0x7D, 0x74,
+    0x9C, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xCA, 0x77, 0x77, 0x70, 0x99, 0x99, 0x97, 0x2F, 0xFA,
+    0x6F, 0xFD, 0x5D, 0x49, 0xE4, 0xD5, 0x9D, 0x39, 0xD6, 0xD9, 0x29, 0xD6, 0xDA, 0x29, 0xD5, 0x9D,
+    0xA2, 0x9D, 0x49, 0xE9, 0x2A, 0xDA, 0xAA, 0xAF, 0xC3, 0xAF, 0xFC, 0xA4, 0xAF, 0xFC, 0x94, 0xAF,
+    0xFD, 0x93, 0xF3, 0xAE, 0x3E, 0xA4, 0xAD, 0xA2, 0xF4, 0x9E, 0x2F, 0x49, 0xE2, 0xF4, 0x9E, 0x91,
+    0xF4, 0x9E, 0xA1, 0xF4, 0x9F, 0x1F, 0x49, 0xF1, 0xF4, 0x9F, 0x90, 0x4D, 0x69, 0xC9, 0x6D, 0x69,
+    0xCA, 0x6D, 0x97, 0x77, 0x1D, 0x1A, 0xAC, 0x91, 0xDA, 0xF9, 0x1F, 0xEA, 0x1F, 0x5E, 0x6E, 0x6E,
+    0x6E, 0x59, 0xE5, 0x9E, 0x5A, 0xE5, 0xAE, 0x5F, 0x5F, 0x93, 0x19, 0x99, 0x99, 0x72, 0xFF, 0xA6,
+    0xFF, 0xD5, 0xD4, 0x9E, 0x4D, 0x59, 0xD3, 0x9D, 0x6D, 0x92, 0x9D, 0x6D, 0xA2, 0x9D, 0x59, 0xDA,
+    0x29, 0xD4, 0x9E, 0x92, 0xAD, 0xAA, 0xAA, 0xFC, 0x3A, 0xFF, 0xCA, 0x4A, 0xFF, 0xC9, 0x4A, 0xFF,
+    0xD9, 0x3F, 0x3A, 0xE3, 0xEA, 0x4A, 0xDA, 0x2F, 0x49, 0xE2, 0xF4, 0x9E, 0x2F, 0x49, 0xE9, 0x1F,
+    0x49, 0xEA, 0x1F, 0x49, 0xF1, 0xF4, 0x9F, 0x1F, 0x49, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x59, 0x99,
+    0x97, 0x2A, 0xEA, 0x72, 0xAE, 0x97, 0x2F, 0x73, 0xF7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x70,
+    0x2D, 0x1A, 0xAC, 0x92, 0xDA, 0xF9, 0x2F, 0xEA, 0x2F, 0x6E, 0x7E, 0x7E, 0x7E, 0x69, 0xE6, 0x9E,
+    0x6A, 0xE6, 0xAE, 0x6F, 0x6F, 0x97, 0x77, 0x77, 0x77, 0x77, 0xF9, 0x5F, 0x6E, 0xA6, 0xE9, 0x59,
+    0xE6, 0xF6, 0xEA, 0x50, 0x77, 0x2C, 0xA4, 0xAA, 0x7D, 0x90, 0x9C, 0xA7, 0x1F, 0xA7, 0x3E, 0x75,
+    0xC9, 0x77, 0x77, 0x70, 0x99, 0x99, 0x97, 0x2F, 0xFA, 0x6F, 0xFD, 0x5D, 0x49, 0xE4, 0xD5, 0x9D,
+    0x39, 0xD6, 0xD9, 0x29, 0xD6, 0xDA, 0x29, 0xD5, 0x9D, 0xA2, 0x9D, 0x49, 0xE9, 0x2A, 0xDA, 0xAA,
+    0xAF, 0xC3, 0xAF, 0xFC, 0xA4, 0xAF, 0xFC, 0x94, 0xAF, 0xFD, 0x93, 0xF3, 0xAE, 0x3E, 0xA4, 0xAD,
+    0xA2, 0xF4, 0x9E, 0x2F, 0x49, 0xE2, 0xF4, 0x9E, 0x91, 0xF4, 0x9E, 0xA1, 0xF4, 0x9F, 0x1F, 0x49,
+    0xF1, 0xF4, 0x9F, 0x90, 0x0C, 0x94, 0xAA, 0x2C, 0xA1, 0x9C, 0xA4, 0xDA, 0xCA, 0x6E, 0x79, 0xC7,
+    0x77, 0x5D, 0x1A, 0xAC, 0x92, 0xDA, 0xF9, 0x2F, 0xEA, 0x2F, 0x6E, 0x7E, 0x7E, 0x7E, 0x69, 0xE6,
+    0x9E, 0x6A, 0xE6, 0xAE, 0x6F, 0x6F, 0x93, 0x71, 0xAC, 0x77, 0x1C, 0xA7, 0x70, 0xAC, 0x97, 0x70,
+    0xD7, 0x70, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xFD, 0xA9, 0x70, 0xFF,
+    0xDA, 0x7F, 0xFE, 0xA6, 0xAF, 0xA9, 0x39, 0x7E, 0xA7, 0x7E, 0x77, 0x0E, 0x77, 0x0E, 0x77, 0x0F,
+    0xA9, 0x76, 0xFE, 0xA9, 0x72, 0x9F, 0xFD, 0x72, 0x9F, 0xFC, 0xA7, 0x39, 0x9F, 0xE7, 0x6F, 0xCA,
+    0x75, 0x9F, 0xC7, 0x59, 0xFC, 0x92, 0x99, 0x7F, 0xD9, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x91, 0xAF,
+    0xFF, 0xEA, 0x2F, 0xFF, 0xE9, 0x49, 0xAF, 0xFA, 0xA7, 0x77, 0x10, 0x69, 0xC9, 0x71, 0xD7, 0x19,
+    0xD7, 0x1A, 0xC9, 0x71, 0xD7, 0x77, 0x77, 0x77, 0x4A, 0xFC, 0xA4, 0xFF, 0x3D, 0x97, 0x1D, 0x72,
+    0xD9, 0x71, 0xAE, 0x97, 0x0F, 0xDA, 0x69, 0xAF, 0xC9, 0x70, 0x9E, 0x71, 0xE9, 0x19, 0xDA, 0xAA,
+    0xAE, 0x90, 0x9F, 0xFD, 0x1F, 0xFD, 0xA2, 0x9A, 0xFC, 0xA9, 0x10, 0x70, 0x97, 0x71, 0xAC, 0xA7,
+    0x7A, 0xE9, 0x75, 0xAC, 0xA0, 0xAC, 0x97, 0x3A, 0xC9, 0x29, 0xC9, 0x72, 0x96, 0x97, 0x77, 0x77,
+    0x73, 0x9A, 0xFD, 0xA9, 0x70, 0xFF, 0xDA, 0x7F, 0xFE, 0xA6, 0xAF, 0xA9, 0x39, 0x7E, 0xA7, 0x7E,
+    0x77, 0x0E, 0x77, 0x0E, 0x77, 0x0F, 0xA9, 0x76, 0xFE, 0xA9, 0x72, 0x9F, 0xFD, 0x72, 0x9F, 0xFC,
+    0xA7, 0x39, 0x9F, 0xE7, 0x6F, 0xCA, 0x75, 0x9F, 0xC7, 0x59, 0xFC, 0x92, 0x99, 0x7F, 0xD9, 0x2F,
+    0xFF, 0xF2, 0xFF, 0xFF, 0x91, 0xAF, 0xFF, 0xEA, 0x2F, 0xFF, 0xE9, 0x49, 0xAF, 0xFA, 0xA7, 0x77,
+    0x10, 0x5A, 0x97, 0x19, 0xD7, 0x09, 0xF6, 0x9C, 0xA1, 0xD4, 0x9C, 0x93, 0xAC, 0x77, 0x77, 0xAF,
+    0xCA, 0x4F, 0xF3, 0xD9, 0x71, 0xD7, 0x2D, 0x97, 0x1A, 0xE9, 0x70, 0xFD, 0xA6, 0x9A, 0xFC, 0x97,
+    0x09, 0xE7, 0x1E, 0x91, 0x9D, 0xAA, 0xAA, 0xE9, 0x09, 0xFF, 0xD1, 0xFF, 0xDA, 0x29, 0xAF, 0xCA,
+    0x91, 0x59, 0xAF, 0xDA, 0x97, 0x0F, 0xFD, 0xA7, 0xFF, 0xEA, 0x6A, 0xFA, 0x93, 0x97, 0xEA, 0x77,
+    0xE7, 0x70, 0xE7, 0x70, 0xE7, 0x70, 0xFA, 0x97, 0x6F, 0xEA, 0x97, 0x29, 0xFF, 0xD7, 0x29, 0xFF,
+    0xCA, 0x73, 0x99, 0xFE, 0x76, 0xFC, 0xA7, 0x59, 0xFC, 0x75, 0x9F, 0xC9, 0x29, 0x97, 0xFD, 0x92,
+    0xFF, 0xFF, 0x2F, 0xFF, 0xF9, 0x1A, 0xFF, 0xFE, 0xA2, 0xFF, 0xFE, 0x94, 0x9A, 0xFF, 0xCA, 0x97,
+    0x5C, 0x77, 0x2C, 0xAA, 0x77, 0x29, 0xC7, 0x72, 0xC7, 0x79, 0x9A, 0xC7, 0x69, 0xE7, 0x3A, 0xFC,
+    0xA4, 0xFF, 0x3D, 0x97, 0x1D, 0x72, 0xD9, 0x71, 0xAE, 0x97, 0x0F, 0xDA, 0x69, 0xAF, 0xC9, 0x70,
+    0x9E, 0x71, 0xE9, 0x19, 0xDA, 0xAA, 0xAE, 0x90, 0x9F, 0xFD, 0x1F, 0xFD, 0xA2, 0x9F, 0xE9, 0x7A,
+    0x97, 0x2C, 0x73, 0xCA, 0xC9, 0x73, 0xC7, 0x29, 0xC7, 0x9E, 0x97, 0x09, 0x94, 0x77, 0x70, 0xAC,
+    0x4C, 0xA7, 0x3A, 0xC9, 0x09, 0xCA, 0x75, 0xAE, 0xA7, 0x7A, 0xD7, 0x71, 0xA9, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x76, 0x9A, 0xFD, 0xA9, 0x70, 0xFF, 0xDA, 0x7F, 0xFE, 0xA6, 0xAF, 0xA9, 0x39, 0x7E,
+    0xA7, 0x7E, 0x77, 0x0E, 0x77, 0x0E, 0x77, 0x0F, 0xA9, 0x76, 0xFE, 0xA9, 0x72, 0x9F, 0xFD, 0x72,
+    0x9F, 0xFC, 0xA7, 0x39, 0x9F, 0xE7, 0x6F, 0xCA, 0x75, 0x9F, 0xC7, 0x59, 0xFC, 0x92, 0x99, 0x7F,
+    0xD9, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x91, 0xAF, 0xFF, 0xEA, 0x2F, 0xFF, 0xE9, 0x49, 0xAF, 0xFA,
+    0xA7, 0x77, 0x10, 0x19, 0x95, 0x99, 0x3C, 0xA3, 0xAC, 0x5D, 0x09, 0xD7, 0xF7, 0x1D, 0x72, 0x99,
+    0x77, 0x77, 0x77, 0xAF, 0xCA, 0x4F, 0xF3, 0xD9, 0x71, 0xD7, 0x2D, 0x97, 0x1A, 0xE9, 0x70, 0xFD,
+    0xA6, 0x9A, 0xFC, 0x97, 0x09, 0xE7, 0x1E, 0x91, 0x9D, 0xAA, 0xAA, 0xE9, 0x09, 0xFF, 0xD1, 0xFF,
+    0xDA, 0x29, 0xAF, 0xCA, 0x91, 0x9F, 0xFF, 0xFC, 0x09, 0xFF, 0xFF, 0xC0, 0x9F, 0xCA, 0xAE, 0xAA,
+    0xAF, 0x70, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x69, 0xE7, 0x69, 0xE7,
+    0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x6A, 0xE7, 0x6A, 0xE9, 0x75, 0xAE, 0x97, 0x5A, 0xE9, 0x75,
+    0xAE, 0x97, 0x5A, 0xE9, 0x77, 0x9A, 0x77, 0x09, 0xAA, 0xA9, 0x77, 0x1C, 0x76, 0x99, 0xCA, 0x75,
+    0xAD, 0xA5, 0x77, 0x0A, 0xC7, 0x0A, 0xD7, 0x0E, 0x70, 0xE5, 0x9A, 0xAE, 0xAA, 0xA9, 0x1F, 0xFD,
+    0x4D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x9D, 0xA7, 0x9D, 0xA7, 0x9D, 0x97, 0x9D, 0xA7,
+    0x9E, 0x99, 0x94, 0x9F, 0xDA, 0x3A, 0xFD, 0xA3, 0x9F, 0xE6, 0xAC, 0xA9, 0x72, 0xAA, 0x71, 0xAA,
+    0x6A, 0xE7, 0x99, 0x92, 0x4C, 0x94, 0xAC, 0x72, 0xD1, 0x9D, 0x74, 0xDA, 0xD7, 0x6E, 0x77, 0x9C,
+    0x97, 0x77, 0x77, 0x77, 0x70, 0x9F, 0xFF, 0xFC, 0x09, 0xFF, 0xFF, 0xC0, 0x9F, 0xCA, 0xAE, 0xAA,
+    0xAF, 0x70, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x69, 0xE7, 0x69, 0xE7,
+    0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x6A, 0xE7, 0x6A, 0xE9, 0x75, 0xAE, 0x97, 0x5A, 0xE9, 0x75,
+    0xAE, 0x97, 0x5A, 0xE9, 0x60, 0x71, 0xD7, 0x1D, 0x70, 0x9D, 0x4A, 0xC1, 0x9D, 0x3A, 0xD1, 0xAC,
+    0xA3, 0xE2, 0x94, 0xE5, 0x9A, 0xAE, 0xAA, 0xA9, 0x1F, 0xFD, 0x4D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7,
+    0x0D, 0xA7, 0x9D, 0xA7, 0x9D, 0xA7, 0x9D, 0x97, 0x9D, 0xA7, 0x9E, 0x99, 0x94, 0x9F, 0xDA, 0x3A,
+    0xFD, 0xA3, 0x9F, 0xE0, 0x9F, 0xFF, 0xFC, 0x09, 0xFF, 0xFF, 0xC0, 0x9F, 0xCA, 0xAE, 0xAA, 0xAF,
+    0x70, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x73, 0xAA, 0xAA, 0xEA, 0xAA, 0x97, 0xFF,
+    0xE7, 0xFF, 0xE7, 0x29, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x6A, 0xE7, 0x6A, 0xE9, 0x75, 0xAE, 0x97,
+    0x5A, 0xE9, 0x75, 0xAE, 0x97, 0x5A, 0xE9, 0x60, 0x77, 0x1A, 0xC7, 0x0A, 0xD7, 0x0E, 0x70, 0xE5,
+    0x9A, 0xAE, 0xAA, 0xA9, 0x1F, 0xFD, 0x4D, 0xA7, 0x0D, 0xA4, 0xAA, 0xAA, 0xEA, 0xAA, 0x90, 0xFF,
+    0xE0, 0xFF, 0xE3, 0x9D, 0xA7, 0x9D, 0x97, 0x9D, 0xA7, 0x9E, 0x99, 0x94, 0x9F, 0xDA, 0x3A, 0xFD,
+    0xA3, 0x9F, 0xE0, 0x77, 0x69, 0xE2, 0xC9, 0x70, 0xCA, 0x0A, 0xC1, 0xC9, 0x70, 0xC9, 0x1F, 0x71,
+    0xA9, 0x29, 0x97, 0x77, 0x77, 0x77, 0x49, 0x99, 0x97, 0x99, 0x99, 0x90, 0xF7, 0xAE, 0xA0, 0xEA,
+    0x7A, 0xE9, 0x0E, 0xA7, 0xAE, 0x90, 0xEA, 0x7A, 0xE9, 0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x79, 0xE9,
+    0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1,
+    0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xEA, 0x79, 0xE1, 0xAE, 0x7A, 0xE1, 0xAE, 0xA5, 0x9F, 0x19,
+    0xFC, 0xAA, 0xAA, 0xFC, 0xA2, 0xFF, 0xFD, 0x92, 0xFF, 0xFD, 0x39, 0xFF, 0xF9, 0x5A, 0xFF, 0xA9,
+    0x77, 0x40, 0x77, 0x0E, 0xA1, 0x9C, 0x49, 0xC0, 0x9C, 0xA0, 0xAC, 0x4A, 0xC1, 0x9E, 0x94, 0x9A,
+    0x39, 0x97, 0x77, 0x77, 0x6D, 0x95, 0xDA, 0x1D, 0x95, 0xDA, 0x1D, 0x95, 0xDA, 0x1D, 0x95, 0xE1,
+    0xDA, 0x5E, 0x1D, 0xA5, 0xE1, 0xDA, 0x5E, 0x1A, 0xD5, 0xE1, 0xAD, 0x5E, 0x1A, 0xD9, 0x3F, 0x19,
+    0xFF, 0xE2, 0xFF, 0xE2, 0xFF, 0xAD, 0x3F, 0xD9, 0xAD, 0x59, 0x99, 0x50, 0x74, 0x97, 0xAF, 0xFC,
+    0x96, 0xFE, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x73, 0xF7, 0xAE, 0xA0, 0xEA, 0x7A, 0xEA, 0x0E,
+    0xA7, 0xAE, 0x90, 0xEA, 0x7A, 0xE9, 0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x79, 0xE9, 0x0E, 0xA7, 0x9E,
+    0x90, 0xEA, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1,
+    0xE9, 0x79, 0xE1, 0xEA, 0x79, 0xE1, 0xAE, 0x7A, 0xE1, 0xAE, 0xA5, 0x9F, 0x19, 0xFC, 0xAA, 0xAA,
+    0xFC, 0xA1, 0x9F, 0xFF, 0xD9, 0x2F, 0xFF, 0xD3, 0x9F, 0xFF, 0x95, 0xAF, 0xFA, 0x97, 0x74, 0x77,
+    0xAF, 0xFC, 0x2A, 0xFE, 0xAA, 0xA7, 0x77, 0x77, 0x4D, 0x95, 0xDA, 0x1D, 0x95, 0xDA, 0x1D, 0x95,
+    0xDA, 0x1D, 0x95, 0xE1, 0xDA, 0x5E, 0x1D, 0xA5, 0xE1, 0xDA, 0x5E, 0x1A, 0xD5, 0xE1, 0xAD, 0x5E,
+    0x1A, 0xD9, 0x3F, 0x19, 0xFF, 0xE2, 0xFF, 0xE2, 0xFF, 0xAD, 0x3F, 0xD9, 0xAD, 0x59, 0x99, 0x50,
+    0x3A, 0xC5, 0xAC, 0x79, 0xC9, 0x4D, 0x70, 0xDA, 0x99, 0x9D, 0x97, 0x09, 0xFD, 0xA7, 0x3A, 0xE9,
+    0x77, 0x77, 0x77, 0x77, 0x76, 0x99, 0x99, 0x70, 0x99, 0x91, 0xF7, 0xAE, 0xA0, 0xEA, 0x7A, 0xEA,
+    0x0E, 0xA7, 0xAE, 0x90, 0xEA, 0x7A, 0xE9, 0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x79, 0xE9, 0x0E, 0xA7,
+    0x9E, 0x90, 0xEA, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79,
+    0xE1, 0xE9, 0x79, 0xE1, 0xEA, 0x79, 0xE1, 0xAE, 0x7A, 0xE1, 0xAE, 0xA5, 0x9F, 0x19, 0xFC, 0xAA,
+    0xAA, 0xFC, 0xA1, 0x9F, 0xFF, 0xD9, 0x2F, 0xFF, 0xD3, 0x9F, 0xFF, 0x95, 0xAF, 0xFA, 0x97, 0x74,
+    0x1C, 0x95, 0xC9, 0x3C, 0xA4, 0x9C, 0x93, 0xAC, 0xA9, 0x99, 0xAD, 0x5F, 0xE7, 0xAE, 0xA7, 0x77,
+    0x77, 0x77, 0x5D, 0x95, 0xDA, 0x1D, 0x95, 0xDA, 0x1D, 0x95, 0xDA, 0x1D, 0x95, 0xE1, 0xDA, 0x5E,
+    0x1D, 0xA5, 0xE1, 0xDA, 0x5E, 0x1A, 0xD5, 0xE1, 0xAD, 0x5E, 0x1A, 0xD9, 0x3F, 0x19, 0xFF, 0xE2,
+    0xFF, 0xE2, 0xFF, 0xAD, 0x3F, 0xD9, 0xAD, 0x59, 0x99, 0x50, 0x69, 0xDA, 0x75, 0xC1, 0xA9, 0x73,
+    0x9C, 0x19, 0xA7, 0x4C, 0xAA, 0xC9, 0x74, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x79, 0x99, 0x97,
+    0x09, 0x99, 0x1F, 0x7A, 0xEA, 0x0E, 0xA7, 0xAE, 0xA0, 0xEA, 0x7A, 0xE9, 0x0E, 0xA7, 0xAE, 0x90,
+    0xEA, 0x79, 0xE9, 0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x79, 0xE9, 0x0E, 0xA7, 0x9E, 0x1E, 0x97, 0x9E,
+    0x1E, 0x97, 0x9E, 0x1E, 0x97, 0x9E, 0x1E, 0x97, 0x9E, 0x1E, 0x97, 0x9E, 0x1E, 0xA7, 0x9E, 0x1A,
+    0xE7, 0xAE, 0x1A, 0xEA, 0x59, 0xF1, 0x9F, 0xCA, 0xAA, 0xAF, 0xCA, 0x19, 0xFF, 0xFD, 0x92, 0xFF,
+    0xFD, 0x39, 0xFF, 0xF9, 0x5A, 0xFF, 0xA9, 0x77, 0x40, 0x4A, 0xD7, 0x1A, 0xA1, 0xC7, 0x0C, 0x91,
+    0xC7, 0x0A, 0xCA, 0xAC, 0x71, 0xAD, 0x77, 0x77, 0x77, 0x76, 0xD9, 0x5D, 0xA1, 0xD9, 0x5D, 0xA1,
+    0xD9, 0x5D, 0xA1, 0xD9, 0x5E, 0x1D, 0xA5, 0xE1, 0xDA, 0x5E, 0x1D, 0xA5, 0xE1, 0xAD, 0x5E, 0x1A,
+    0xD5, 0xE1, 0xAD, 0x93, 0xF1, 0x9F, 0xFE, 0x2F, 0xFE, 0x2F, 0xFA, 0xD3, 0xFD, 0x9A, 0xD5, 0x99,
+    0x95, 0x59, 0x97, 0x99, 0x95, 0xAD, 0x6A, 0xD4, 0x9E, 0x6E, 0x4A, 0xDA, 0x59, 0xE5, 0x97, 0x09,
+    0x77, 0x77, 0x77, 0x77, 0x39, 0x99, 0x71, 0x99, 0x93, 0xF7, 0xAE, 0xA2, 0xEA, 0x7A, 0xEA, 0x2E,
+    0xA7, 0xAE, 0x92, 0xEA, 0x7A, 0xE9, 0x2E, 0xA7, 0x9E, 0x92, 0xEA, 0x79, 0xE9, 0x2E, 0xA7, 0x9E,
+    0x92, 0xEA, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xE9, 0x79, 0xE3,
+    0xE9, 0x79, 0xE3, 0xEA, 0x79, 0xE3, 0xAE, 0x7A, 0xE3, 0xAE, 0xA5, 0x9F, 0x39, 0xFC, 0xAA, 0xAA,
+    0xFC, 0xA3, 0x9F, 0xFF, 0xD9, 0x4F, 0xFF, 0xD5, 0x9F, 0xFF, 0x97, 0xAF, 0xFA, 0x97, 0x77, 0x00,
+    0x59, 0x97, 0x99, 0x49, 0xD9, 0x6D, 0xA3, 0xAD, 0x95, 0x9D, 0x93, 0xE9, 0x5A, 0xD9, 0x39, 0x70,
+    0x97, 0x77, 0x77, 0x77, 0x72, 0xD9, 0x5D, 0xA6, 0xD9, 0x5D, 0xA6, 0xD9, 0x5D, 0xA6, 0xD9, 0x5E,
+    0x6D, 0xA5, 0xE6, 0xDA, 0x5E, 0x6D, 0xA5, 0xE6, 0xAD, 0x5E, 0x6A, 0xD5, 0xE6, 0xAD, 0x93, 0xF6,
+    0x9F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFA, 0xD7, 0x0F, 0xD9, 0xAD, 0x72, 0x99, 0x97, 0x00, 0x09, 0x99,
+    0x71, 0x99, 0x91, 0xF7, 0xAE, 0xA0, 0xEA, 0x7A, 0xEA, 0x0E, 0xA7, 0xAE, 0x90, 0xEA, 0x7A, 0xE9,
+    0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x79, 0xE9, 0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x79, 0xE1, 0xE9, 0x79,
+    0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xEA, 0x79, 0xE1,
+    0xAE, 0x7A, 0xE1, 0xAE, 0xA5, 0x9F, 0x19, 0xFC, 0xAA, 0xAA, 0xFC, 0xA1, 0x9F, 0xFF, 0xD9, 0x2F,
+    0xFF, 0xD3, 0x9F, 0xFF, 0x95, 0xAF, 0xFA, 0x97, 0x49, 0xC7, 0x7C, 0x97, 0x7C, 0x97, 0x7A, 0xE7,
+    0x69, 0xAA, 0x30, 0x0D, 0x95, 0xDA, 0x1D, 0x95, 0xDA, 0x1D, 0x95, 0xDA, 0x1D, 0x95, 0xE1, 0xDA,
+    0x5E, 0x1D, 0xA5, 0xE1, 0xDA, 0x5E, 0x1A, 0xD5, 0xE1, 0xAD, 0x5E, 0x1A, 0xD9, 0x3F, 0x19, 0xFF,
+    0xE2, 0xFF, 0xE2, 0xFF, 0xAD, 0x3F, 0xD9, 0xAD, 0x59, 0x99, 0x0A, 0xC9, 0x71, 0x9C, 0x97, 0x2C,
+    0xA7, 0x3C, 0xA7, 0x39, 0xE9, 0x72, 0x9A, 0x90, 0x73, 0x9C, 0x97, 0x77, 0xE7, 0x76, 0xDA, 0xD7,
+    0x74, 0xCA, 0x2D, 0x77, 0x2C, 0x94, 0xAC, 0x77, 0x77, 0x77, 0x77, 0xE7, 0x72, 0xAD, 0xA0, 0xE9,
+    0x77, 0x1E, 0x90, 0xAD, 0xA7, 0x71, 0xE1, 0xAE, 0x77, 0x09, 0xE1, 0x9E, 0x77, 0x0A, 0xDA, 0x2E,
+    0x97, 0x7E, 0x92, 0xEA, 0x5E, 0x6E, 0x3A, 0xE4, 0x9E, 0xA4, 0x9E, 0x39, 0xE4, 0xFC, 0x4E, 0xA4,
+    0xE9, 0x29, 0xFC, 0xA3, 0xE9, 0x4E, 0xA2, 0xFE, 0x29, 0xE5, 0xAE, 0x1A, 0xEA, 0xEA, 0x1A, 0xE5,
+    0xAE, 0x1F, 0x0A, 0xE1, 0xEA, 0x59, 0xE0, 0xAE, 0xA1, 0xEA, 0x0E, 0x96, 0xEA, 0xF9, 0x1F, 0x9E,
+    0x7F, 0xF2, 0x9F, 0xE7, 0xAF, 0xD9, 0x3F, 0xDA, 0x79, 0xFD, 0x4A, 0xFC, 0xA7, 0x0F, 0xCA, 0x49,
+    0xFC, 0x97, 0x0F, 0xC9, 0x5F, 0xC7, 0x1F, 0xC6, 0xAF, 0x40, 0x70, 0xCA, 0x77, 0x0A, 0xD9, 0x76,
+    0xAC, 0xAD, 0x75, 0xAC, 0x91, 0xAC, 0x73, 0xAA, 0x49, 0xC7, 0x77, 0x77, 0x77, 0x72, 0xAA, 0xA7,
+    0x3A, 0xAA, 0x1E, 0x73, 0xE1, 0xAD, 0x97, 0x19, 0xDA, 0x19, 0xDA, 0x71, 0xAD, 0x92, 0xE3, 0xD3,
+    0xE3, 0xE2, 0xAD, 0xA2, 0xE3, 0xAD, 0x90, 0x9F, 0x90, 0x9D, 0xA3, 0x9D, 0xA0, 0xFD, 0x0A, 0xD9,
+    0x4F, 0xFF, 0xD5, 0xFF, 0xFD, 0x5A, 0xFC, 0xAA, 0xFC, 0xA5, 0x9F, 0xC1, 0xFC, 0x7F, 0x91, 0x9F,
+    0x7A, 0xDA, 0x3E, 0xA3, 0x77, 0x71, 0xD7, 0x6A, 0xDA, 0x74, 0xAC, 0xAA, 0xCA, 0x72, 0xAC, 0x91,
+    0x9C, 0xA7, 0x09, 0xA5, 0xA9, 0x77, 0x77, 0x77, 0x72, 0xE7, 0x1A, 0xDA, 0x0A, 0xDA, 0x70, 0xE2,
+    0xE7, 0xAD, 0xA2, 0xAE, 0x6E, 0x4E, 0x94, 0xEA, 0x4A, 0xE3, 0x9E, 0x6E, 0x92, 0xEA, 0x6A, 0xE1,
+    0xAE, 0x70, 0xEA, 0x0E, 0xA7, 0x0A, 0xFE, 0x72, 0xFD, 0xA7, 0x2A, 0xFC, 0x74, 0xFA, 0x74, 0xF7,
+    0x5F, 0x75, 0xF7, 0x5F, 0x74, 0x9F, 0x74, 0xAF, 0x74, 0xFC, 0x74, 0xFC, 0x60, 0x77, 0x49, 0xCA,
+    0x72, 0x9E, 0x97, 0x09, 0xD9, 0xD9, 0x69, 0xCA, 0x2A, 0xC9, 0x5A, 0x94, 0x9A, 0x77, 0x77, 0x77,
+    0x77, 0xD9, 0x69, 0xD1, 0x9D, 0x6A, 0xD2, 0xDA, 0x5D, 0xA2, 0x9D, 0x93, 0x9D, 0x93, 0xE3, 0xAD,
+    0x49, 0xD9, 0x2E, 0x5E, 0x19, 0xDA, 0x59, 0xDA, 0x0A, 0xD9, 0x6E, 0x9E, 0x79, 0xFD, 0x70, 0xFC,
+    0xA7, 0x09, 0xF9, 0x71, 0xF7, 0x2F, 0x72, 0xEA, 0x71, 0xAE, 0x97, 0x9F, 0xC5, 0x9F, 0xE6, 0x9F,
+    0xD7, 0x9F, 0x97, 0x76, 0x77, 0x59, 0xD9, 0x2A, 0xD9, 0x6A, 0xDA, 0x2E, 0x96, 0xF2, 0xEA, 0x6F,
+    0x2E, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x3E, 0x71, 0xAD, 0xA0, 0xAD, 0xA7, 0x0E, 0x2E, 0x7A, 0xDA,
+    0x2A, 0xE6, 0xE4, 0xE9, 0x4E, 0xA4, 0xAE, 0x39, 0xE6, 0xE9, 0x2E, 0xA6, 0xAE, 0x1A, 0xE7, 0x0E,
+    0xA0, 0xEA, 0x70, 0xAF, 0xE7, 0x2F, 0xDA, 0x72, 0xAF, 0xC7, 0x4F, 0xA7, 0x4F, 0x75, 0xF7, 0x5F,
+    0x75, 0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4F, 0xC7, 0x4F, 0xC6, 0x71, 0xAC, 0x77, 0x1D, 0x77, 0x0A,
+    0xCA, 0x77, 0x0D, 0x77, 0x09, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3F, 0xFF, 0xF3, 0x9F, 0xFF,
+    0xE4, 0xFF, 0xFE, 0x49, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xA7, 0x5A, 0xF9, 0x74, 0xAF, 0x97, 0x4A,
+    0xFA, 0x74, 0xAF, 0xA7, 0x4A, 0xFA, 0x74, 0xAF, 0xC7, 0x4A, 0xFC, 0x74, 0xAF, 0xC7, 0x4A, 0xFC,
+    0x74, 0xAF, 0xC9, 0x73, 0xAF, 0xC9, 0x73, 0xAF, 0xCA, 0x73, 0xAF, 0xCA, 0x73, 0x9F, 0xFF, 0xFC,
+    0x90, 0x9F, 0xFF, 0xFC, 0xA0, 0x9F, 0xFF, 0xFD, 0x09, 0xFF, 0xFF, 0xD9, 0x7D, 0x72, 0x9C, 0xA7,
+    0x2D, 0x97, 0x2D, 0x72, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x7F, 0xFD, 0x92, 0xFF, 0xD9, 0x29, 0x99,
+    0x99, 0x99, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xEA, 0x70, 0xEA, 0x70, 0xEA, 0x79, 0xEA, 0x79,
+    0xEA, 0x79, 0xEA, 0x70, 0xAF, 0xFD, 0x2F, 0xFE, 0xA1, 0xFF, 0xF0, 0x77, 0x73, 0xAD, 0x97, 0x7E,
+    0x97, 0x7E, 0xA7, 0x7E, 0xA7, 0x77, 0x77, 0x77, 0x76, 0xFF, 0xFF, 0x39, 0xFF, 0xFE, 0x4F, 0xFF,
+    0xE4, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0x75, 0xAF, 0x97, 0x4A, 0xF9, 0x74, 0xAF, 0xA7, 0x4A,
+    0xFA, 0x74, 0xAF, 0xA7, 0x4A, 0xFC, 0x74, 0xAF, 0xC7, 0x4A, 0xFC, 0x74, 0xAF, 0xC7, 0x4A, 0xFC,
+    0x97, 0x3A, 0xFC, 0x97, 0x3A, 0xFC, 0xA7, 0x3A, 0xFC, 0xA7, 0x39, 0xFF, 0xFF, 0xC9, 0x09, 0xFF,
+    0xFF, 0xCA, 0x09, 0xFF, 0xFF, 0xD0, 0x9F, 0xFF, 0xFD, 0x90, 0x5E, 0x72, 0xE7, 0x2E, 0x97, 0x09,
+    0xE9, 0x77, 0x77, 0x77, 0x76, 0xFF, 0xD9, 0x2F, 0xFD, 0x92, 0x99, 0x99, 0x99, 0x9E, 0x97, 0x0E,
+    0x97, 0x0E, 0x97, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x9E, 0xA7, 0x9E, 0xA7, 0x9E, 0xA7, 0x0A,
+    0xFF, 0xD2, 0xFF, 0xEA, 0x1F, 0xFF, 0x00, 0x49, 0x69, 0x72, 0x9C, 0x93, 0xD7, 0x39, 0xCA, 0x09,
+    0xD7, 0x59, 0xF7, 0x79, 0xD7, 0x71, 0x99, 0x77, 0x77, 0x77, 0x77, 0x7F, 0xFF, 0xF3, 0x9F, 0xFF,
+    0xE4, 0xFF, 0xFE, 0x49, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xA7, 0x5A, 0xF9, 0x74, 0xAF, 0x97, 0x4A,
+    0xFA, 0x74, 0xAF, 0xA7, 0x4A, 0xFA, 0x74, 0xAF, 0xC7, 0x4A, 0xFC, 0x74, 0xAF, 0xC7, 0x4A, 0xFC,
+    0x74, 0xAF, 0xC9, 0x73, 0xAF, 0xC9, 0x73, 0xAF, 0xCA, 0x73, 0xAF, 0xCA, 0x73, 0x9F, 0xFF, 0xFC,
+    0x90, 0x9F, 0xFF, 0xFC, 0xA0, 0x9F, 0xFF, 0xFD, 0x09, 0xFF, 0xFF, 0xD9, 0x2A, 0x94, 0x9A, 0x5C,
+    0xA2, 0xAC, 0x7D, 0x9D, 0x71, 0xE7, 0x29, 0xCA, 0x77, 0x77, 0x77, 0x77, 0xFF, 0xD9, 0x2F, 0xFD,
+    0x92, 0x99, 0x99, 0x99, 0x9E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7,
+    0x9E, 0xA7, 0x9E, 0xA7, 0x9E, 0xA7, 0x0A, 0xFF, 0xD2, 0xFF, 0xEA, 0x1F, 0xFF, 0x00, 0x3A, 0xDA,
+    0x3F, 0xC2, 0xAD, 0x19, 0x2D, 0x59, 0xD5, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0xA5, 0xE5,
+    0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE4, 0x77, 0x77, 0x70, 0x9C, 0x69, 0xAF,
+    0xCA, 0x93, 0x9C, 0x49, 0xFF, 0xE2, 0xAC, 0x3A, 0xFA, 0x99, 0x9F, 0xC9, 0x0C, 0xA2, 0x9F, 0x59,
+    0xFD, 0x3F, 0x79, 0xF3, 0x9E, 0x71, 0xAE, 0x3E, 0xA7, 0x2E, 0x92, 0xE7, 0x3A, 0xDA, 0x2E, 0x73,
+    0x9D, 0xA2, 0xE7, 0x39, 0xE1, 0x9D, 0xA7, 0x4E, 0x2E, 0x74, 0xDA, 0x2E, 0x73, 0x9D, 0xA2, 0xE9,
+    0x72, 0xEA, 0x2F, 0x97, 0x0A, 0xE9, 0x29, 0xFC, 0xA9, 0x99, 0x99, 0xAF, 0xC4, 0xFF, 0xFF, 0xA4,
+    0x9F, 0xFF, 0xE6, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xE9, 0x72, 0x9A, 0xFC, 0xA9, 0x77, 0x74, 0x75,
+    0xA4, 0x9A, 0xEA, 0x92, 0xC9, 0x2A, 0xFE, 0xA1, 0xC2, 0xEA, 0x90, 0x9A, 0xDA, 0xAC, 0x19, 0xD5,
+    0x9E, 0x2D, 0xA6, 0xD9, 0x2D, 0x96, 0xDA, 0x2D, 0x96, 0xAD, 0x2D, 0x96, 0xAD, 0x2D, 0xA6, 0xDA,
+    0x2E, 0x94, 0xAD, 0x92, 0x9F, 0xCA, 0xFC, 0x4F, 0xFD, 0x95, 0xAF, 0xE9, 0x79, 0xFA, 0x50, 0x29,
+    0xFF, 0xCA, 0x5A, 0xFF, 0xFA, 0x29, 0xFC, 0x99, 0x99, 0x9A, 0xE9, 0x1F, 0xD6, 0xE1, 0xD0, 0xAD,
+    0x69, 0xD9, 0x0D, 0x0A, 0xD6, 0x9D, 0x90, 0xCA, 0x0A, 0xD6, 0xAD, 0x90, 0x9A, 0x0E, 0x5A, 0xE4,
+    0xFF, 0xF9, 0x4F, 0xFE, 0xA5, 0xFF, 0xCA, 0x7E, 0xA7, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0xA7, 0x5E,
+    0xA7, 0x49, 0xEA, 0x74, 0x9E, 0xA7, 0x49, 0xF7, 0x49, 0xF7, 0x49, 0xF7, 0x10, 0x77, 0x1E, 0x97,
+    0x1A, 0xE9, 0x71, 0xAC, 0xA7, 0x3A, 0xCA, 0x1A, 0xAC, 0xA9, 0x4A, 0xCA, 0x0F, 0xDA, 0x3A, 0xFC,
+    0x90, 0x9D, 0xA2, 0xAF, 0x4D, 0x2A, 0xE5, 0xAC, 0xA1, 0xAE, 0x59, 0xD1, 0xAD, 0xA5, 0x9D, 0x1A,
+    0xE5, 0x9D, 0x1A, 0xE5, 0x9D, 0x1A, 0xF4, 0xDA, 0x1A, 0xFC, 0xA9, 0xAE, 0x91, 0xAF, 0xFE, 0x2E,
+    0xAF, 0xE3, 0xDA, 0x0A, 0xFC, 0x39, 0xDA, 0x39, 0x5A, 0xD9, 0x72, 0xE9, 0x72, 0xE7, 0x3E, 0x72,
+    0x9E, 0x77, 0x71, 0x0F, 0xFD, 0xA0, 0xFF, 0xE0, 0xAC, 0x72, 0xAC, 0x72, 0xAC, 0x72, 0xAC, 0x72,
+    0xAC, 0x72, 0xD7, 0x2C, 0xA7, 0x1A, 0xA7, 0x0D, 0x70, 0xD9, 0x7D, 0x97, 0xD9, 0x7D, 0x97, 0xEA,
+    0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xE0, 0xFF, 0xE7, 0x30, 0x9F, 0xFF, 0xFC, 0x09, 0xFF, 0xFF, 0xC0,
+    0x9F, 0xDA, 0xEA, 0xAA, 0xF1, 0xAC, 0x4E, 0x71, 0xC4, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7,
+    0x7E, 0x76, 0x9E, 0x76, 0x9E, 0x76, 0x9E, 0x76, 0x9E, 0x76, 0x9E, 0x76, 0xAE, 0x76, 0xAE, 0x97,
+    0x5A, 0xE9, 0x75, 0xAE, 0x97, 0x5A, 0xE9, 0x75, 0xAE, 0x96, 0x77, 0x1A, 0xCA, 0x6E, 0xA5, 0xAE,
+    0xA5, 0xE9, 0x5A, 0xD7, 0xAD, 0x7E, 0x49, 0xAA, 0xEA, 0xAA, 0x90, 0xFF, 0xD3, 0xDA, 0x7D, 0xA7,
+    0xDA, 0x7D, 0xA6, 0x9D, 0xA6, 0x9D, 0xA6, 0x9D, 0x96, 0x9D, 0xA6, 0x9E, 0x99, 0x93, 0x9F, 0xDA,
+    0x2A, 0xFD, 0xA2, 0x9F, 0xE0, 0x9F, 0xFF, 0xFC, 0x09, 0xFF, 0xFF, 0xC0, 0x9F, 0xCA, 0xAE, 0xAA,
+    0xAF, 0x70, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x76, 0x9E, 0x76, 0x9E, 0x76, 0x9E,
+    0x76, 0x9E, 0x76, 0x9E, 0x76, 0x9E, 0x76, 0xAE, 0x97, 0x5A, 0xE9, 0x75, 0xAE, 0x97, 0x5A, 0xE9,
+    0x75, 0xAE, 0x97, 0x5F, 0xC7, 0x5A, 0xFA, 0x74, 0x9F, 0xD9, 0x73, 0x9F, 0xCA, 0x75, 0xAE, 0xA7,
+    0x79, 0x99, 0x30, 0x77, 0x77, 0x5A, 0x97, 0x71, 0xCA, 0x77, 0x1C, 0xA9, 0xF7, 0xAF, 0xC9, 0x0F,
+    0x7A, 0xFA, 0x1E, 0xA7, 0xAE, 0x92, 0xEA, 0x7A, 0xE9, 0x2E, 0xA7, 0x9E, 0x92, 0xEA, 0x79, 0xE9,
+    0x2E, 0xA7, 0x9E, 0x92, 0xEA, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xE9, 0x79, 0xE3,
+    0xE9, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xEA, 0x79, 0xE3, 0xAE, 0x7A, 0xE3, 0xAE, 0xA5, 0x9F, 0x39,
+    0xFC, 0xAA, 0xAA, 0xFC, 0xA3, 0x9F, 0xFF, 0xD9, 0x4F, 0xFF, 0xD5, 0x9F, 0xFF, 0x97, 0xAF, 0xFA,
+    0x97, 0x77, 0x00, 0x75, 0x97, 0x6C, 0x1D, 0x95, 0xDA, 0x0C, 0x1D, 0x95, 0xDA, 0xAC, 0x1D, 0x95,
+    0xF9, 0x1D, 0x95, 0xE3, 0xDA, 0x5E, 0x3D, 0xA5, 0xE3, 0xDA, 0x5E, 0x3A, 0xD5, 0xE3, 0xAD, 0x5E,
+    0x3A, 0xD9, 0x3F, 0x39, 0xFF, 0xE4, 0xFF, 0xE4, 0xFF, 0xAD, 0x5F, 0xD9, 0xAD, 0x79, 0x99, 0x70,
+    0x0D, 0x95, 0xDA, 0x5E, 0x59, 0xAA, 0x00, 0x19, 0xC9, 0x1D, 0x19, 0xD1, 0xAC, 0x91, 0xD1, 0x4D,
+    0x7A, 0xDA, 0x5A, 0xCA, 0xD9, 0x3A, 0xC9, 0x19, 0xC9, 0x19, 0xA5, 0xC9, 0x09, 0xD9, 0x2C, 0x1C,
+    0xAA, 0xC2, 0xC0, 0x9C, 0x1A, 0xC0, 0x9C, 0x09, 0xC2, 0xEA, 0x19, 0x39, 0x91, 0x74, 0xAF, 0xFC,
+    0x0A, 0xFE, 0xAA, 0xA7, 0x40, 0x77, 0x2A, 0xFF, 0xFC, 0x1A, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9,
+    0x90, 0x0C, 0xA5, 0xCA, 0x0D, 0x5C, 0xA0, 0x9D, 0x99, 0x9A, 0xD2, 0xAF, 0xD9, 0x39, 0xEA, 0x20,
+    0x5E, 0x1E, 0x09, 0xE0, 0xAE, 0x90, 0x74, 0xE3, 0xDA, 0x1E, 0x29, 0xE0, 0x9E, 0x2A, 0xE0, 0xAE,
+    0x91, 0xF0, 0x0A, 0xDA, 0x19, 0x1C, 0xA3, 0xC9, 0x2C, 0x93, 0x91, 0x09, 0xDA, 0x1C, 0x1A, 0xA9,
+    0xC1, 0x9A, 0x0C, 0xAA, 0xC9, 0x09, 0xDA, 0x00, 0x39, 0xD9, 0x6D, 0xA3, 0xAD, 0x95, 0x9D, 0xA3,
+    0xE9, 0x5A, 0xDA, 0x3A, 0xA9, 0x6A, 0xAA, 0x93, 0x09, 0xA5, 0xC9, 0x1A, 0xC9, 0x19, 0xCA, 0x3A,
+    0xCA, 0xDA, 0x5A, 0xDA, 0x7D, 0x30, 0x9D, 0x96, 0xDA, 0x6D, 0xA6, 0xE6, 0xE6, 0xE9, 0x59, 0xAA,
+    0x69, 0xAA, 0x90, 0x99, 0x99, 0x1A, 0xE9, 0x09, 0xEA, 0x1E, 0xA1, 0xEA, 0x19, 0xE2, 0xEA, 0x50,
+    0x09, 0xF0, 0x9E, 0xA0, 0xAE, 0x90, 0xAE, 0x1E, 0xA1, 0xE9, 0x0A, 0xE1, 0xF9, 0x0A, 0xE9, 0x09,
+    0xEA, 0x1E, 0xA1, 0xAE, 0x19, 0xE2, 0xEA, 0x2A, 0xA2, 0xAA, 0x0E, 0xA0, 0x99, 0xCA, 0x2A, 0xA4,
+    0x0C, 0x92, 0xC9, 0x2E, 0xA0, 0xCA, 0x91, 0xC9, 0x60, 0x0E, 0xAA, 0xA9, 0x99, 0x1F, 0xFC, 0x97,
+    0xAC, 0x97, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA0, 0x19, 0xC1, 0x9C, 0x1A, 0xA0, 0xAC, 0x1C, 0x94,
+    0x1C, 0x1C, 0x2C, 0x29, 0xC4, 0x2A, 0x5C, 0x39, 0x9C, 0xA9, 0x1F, 0xC0, 0x0F, 0xC1, 0x9A, 0xCA,
+    0x93, 0xC5, 0xA2, 0x2A, 0x4C, 0x2A, 0xAC, 0xA9, 0x2C, 0x4A, 0x10, 0x75, 0x9A, 0xFF, 0xA1, 0xFF,
+    0xAA, 0xA7, 0x50, 0x0E, 0x1E, 0x09, 0xE0, 0xAE, 0x94, 0x74, 0xE3, 0xDA, 0x1E, 0x29, 0xE0, 0x9E,
+    0x2A, 0xE0, 0xAE, 0x91, 0xF0, 0x09, 0xDA, 0x1C, 0x1A, 0xA9, 0xC1, 0x9A, 0x0C, 0xAA, 0xC9, 0x09,
+    0xDA, 0x00, 0x19, 0x99, 0x90, 0x9E, 0xA0, 0xAE, 0x90, 0xAE, 0x1A, 0xE1, 0xEA, 0x09, 0xE9, 0x0A,
+    0xE1, 0x1A, 0x3A, 0x93, 0xCA, 0xA9, 0x4C, 0x4A, 0x90, 0x99, 0xAC, 0x1E, 0x90, 0x70, 0xC9, 0x2C,
+    0x92, 0xAA, 0x3C, 0xA3, 0xAE, 0x92, 0x9A, 0x90, 0x09, 0xA9, 0x0A, 0xC9, 0x0D, 0x90, 0xD9, 0x0D,
+    0x90, 0xD9, 0x0D, 0x90, 0x0F, 0xE1, 0xD9, 0x99, 0xD1, 0xCA, 0x2A, 0xC1, 0xCA, 0x2A, 0xC0, 0x09,
+    0xA5, 0xC9, 0x1A, 0xC9, 0x19, 0xCA, 0x3A, 0xCA, 0xDA, 0x5A, 0xDA, 0x7D, 0x30, 0x4C, 0x97, 0xE6,
+    0xAC, 0xAD, 0x4A, 0xC9, 0x1D, 0x2C, 0xA4, 0xAC, 0x00, 0x09, 0xD9, 0x2C, 0x1C, 0xAA, 0xC2, 0xC0,
+    0x9C, 0x1A, 0xC0, 0x9C, 0x09, 0xC2, 0xEA, 0x19, 0x39, 0x91, 0x39, 0x99, 0x9A, 0x1A, 0xFE, 0xA7,
+    0x10, 0x19, 0x9A, 0xAA, 0xAD, 0x1A, 0xFF, 0x73, 0x09, 0xD9, 0x2C, 0x1C, 0xAA, 0xC2, 0xC0, 0x9C,
+    0x1A, 0xC0, 0x9C, 0x09, 0xC2, 0xEA, 0x19, 0x39, 0x91, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F,
+    0xFE, 0x1F, 0xFE, 0x00, 0x0C, 0x92, 0xC2, 0xC1, 0xCA, 0x19, 0x10, 0x0C, 0xA2, 0xAC, 0x1C, 0xA2,
+    0xAC, 0x1D, 0x99, 0x9D, 0x1F, 0xE0, 0x0F, 0xDA, 0x0C, 0x92, 0xAA, 0x0C, 0x3A, 0xA0, 0xC3, 0xAA,
+    0x0C, 0x3A, 0xA0, 0xFD, 0xA7, 0x09, 0xCA, 0x90, 0x92, 0xA9, 0x0A, 0x90, 0xA1, 0xC1, 0xA1, 0xC1,
+    0xC1, 0xA1, 0xC1, 0xA1, 0x91, 0xC0, 0x09, 0xA0, 0xA9, 0x1C, 0xAA, 0x29, 0xC3, 0xCA, 0xC1, 0xC9,
+    0x0C, 0x90, 0x09, 0xD9, 0x2C, 0x1C, 0xAA, 0xC2, 0xC0, 0x9C, 0x1A, 0xC0, 0x9C, 0x09, 0xC2, 0xEA,
+    0x19, 0x39, 0x91, 0x09, 0x2D, 0x2A, 0xA0, 0x9C, 0x90, 0x91, 0x59, 0xC9, 0x70, 0xD7, 0x09, 0xCA,
+    0x70, 0xD9, 0x79, 0xD7, 0x77, 0x5E, 0x3D, 0xA1, 0xE2, 0x9E, 0x09, 0xE2, 0xAE, 0x0A, 0xE9, 0x1F,
+    0x00, 0x09, 0x99, 0x99, 0x99, 0x1F, 0xE1, 0xCA, 0x2A, 0xC1, 0xCA, 0x2A, 0xC1, 0x99, 0x39, 0x00,
+    0x75, 0x9A, 0xFF, 0xA1, 0xFF, 0xAA, 0xA7, 0x77, 0x77, 0x1A, 0xAA, 0xAF, 0xCA, 0x1A, 0xFF, 0xD7,
+    0x50, 0x0A, 0xC9, 0x2A, 0xCA, 0x0A, 0xC9, 0x2A, 0xCA, 0x0D, 0x92, 0xAC, 0xA0, 0xD9, 0x2D, 0xA0,
+    0xD9, 0x2D, 0xA0, 0xD9, 0x2D, 0xA0, 0xAA, 0x92, 0xAA, 0x90, 0x70, 0xFD, 0xA0, 0xFD, 0xA4, 0xE4,
+    0xE4, 0xE7, 0x77, 0x0A, 0x79, 0xA7, 0xC7, 0x0C, 0x39, 0xD9, 0x9A, 0x0C, 0x1C, 0xAA, 0xD9, 0x0C,
+    0x09, 0xC1, 0xAC, 0x99, 0xC0, 0x9C, 0x19, 0xEA, 0x4A, 0xA9, 0x95, 0xC9, 0x7C, 0x7A, 0xA7, 0xA7,
+    0x70, 0x73, 0xAD, 0x77, 0x0E, 0x77, 0x0E, 0x69, 0xFC, 0xA2, 0x99, 0x91, 0xE0, 0xAE, 0x99, 0xAD,
+    0xA5, 0xE9, 0xE4, 0xEA, 0x2A, 0xD9, 0xAE, 0x59, 0xFE, 0xA5, 0x9D, 0x49, 0x99, 0x97, 0xAD, 0x77,
+    0x0E, 0x77, 0x09, 0x99, 0x73, 0x77, 0x09, 0xEA, 0x49, 0xA1, 0x9D, 0x99, 0xD3, 0xAC, 0x90, 0xAC,
+    0xA1, 0x9D, 0x2D, 0x1D, 0x92, 0x9D, 0xAA, 0xD1, 0xAA, 0x49, 0xAE, 0x97, 0x77, 0x70, 0xFC, 0x93,
+    0x9C, 0x90, 0xAD, 0x1D, 0xA2, 0xAC, 0x90, 0xD9, 0x2A, 0xD9, 0xAD, 0x1A, 0xA4, 0x9A, 0xE9, 0x77,
+    0x71, 0x97, 0x19, 0xE1, 0xC7, 0x91, 0x9E, 0x71, 0x97, 0x20, 0x1A, 0x19, 0xC9, 0x1C, 0x29, 0x00,
+    0x77, 0x5A, 0x97, 0x7C, 0x91, 0xCA, 0x74, 0x9C, 0x93, 0x9C, 0xA9, 0x69, 0xAC, 0xA7, 0x9A, 0xAF,
+    0xCA, 0xA9, 0x40, 0x49, 0xAF, 0xEA, 0x97, 0xAC, 0xA9, 0x69, 0xAD, 0x4C, 0xA7, 0x49, 0xC9, 0x1A,
+    0x97, 0x7C, 0x97, 0x74, 0x77, 0x29, 0x77, 0x79, 0xD9, 0x2F, 0xFF, 0xFF, 0xE1, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF9, 0x77, 0x39, 0xC9, 0x77, 0x73, 0x79, 0xDA, 0x77, 0xAE,
+    0x77, 0xF9, 0x75, 0x9F, 0xC7, 0x5D, 0xA9, 0xD9, 0x73, 0x9D, 0x90, 0xDA, 0x73, 0xAD, 0x1A, 0xD7,
+    0x3D, 0xA1, 0x9D, 0x97, 0x19, 0xD9, 0x2E, 0x71, 0xE3, 0xAD, 0x71, 0xDA, 0x39, 0xDA, 0x7A, 0xD9,
+    0x4E, 0x7E, 0x5A, 0xD9, 0x59, 0xDA, 0x6D, 0xA5, 0xFF, 0xFD, 0x5F, 0xFF, 0xDA, 0x3A, 0xFF, 0xFE,
+    0x3E, 0xA9, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x19, 0xE7, 0x1E, 0xA1, 0xAE, 0x71, 0xAE, 0x1E, 0xA7,
+    0x19, 0xE9, 0x77, 0x9F, 0xFC, 0xA4, 0x9F, 0xFE, 0x92, 0x9D, 0xA4, 0x9E, 0x29, 0xDA, 0x6D, 0xA1,
+    0x9D, 0xA6, 0xAD, 0x19, 0xDA, 0x6A, 0xCA, 0x19, 0xDA, 0x6D, 0xA1, 0x9E, 0xAA, 0xAA, 0xAA, 0xE2,
+    0x9F, 0xFD, 0xA3, 0x9F, 0xFE, 0xA2, 0x9D, 0xA5, 0x9E, 0x90, 0x9D, 0xA7, 0xE0, 0x9D, 0xA7, 0xAD,
+    0x99, 0xDA, 0x7A, 0xD9, 0x9D, 0xA7, 0xAD, 0xA9, 0xDA, 0x7E, 0xA9, 0xDA, 0x5A, 0xF9, 0x9F, 0xFF,
+    0xD9, 0x9F, 0xFF, 0xD0, 0x9F, 0xFF, 0xC1, 0x9F, 0xFD, 0xA9, 0x20, 0x09, 0x99, 0x99, 0x99, 0x99,
+    0x91, 0xFF, 0xD1, 0xFF, 0xD1, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D,
+    0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D,
+    0xA7, 0x0D, 0xA7, 0x09, 0x97, 0x00, 0x77, 0x72, 0xE9, 0x75, 0x9E, 0xA7, 0x5F, 0xC7, 0x49, 0xDA,
+    0xDA, 0x73, 0xE0, 0xAD, 0x72, 0x9E, 0x09, 0xDA, 0x71, 0xE9, 0x1E, 0x71, 0xE2, 0xAD, 0xA7, 0xAD,
+    0x93, 0xE7, 0xE4, 0xAD, 0xA5, 0xAD, 0xA4, 0x9E, 0x5E, 0x6E, 0xA3, 0xAE, 0x69, 0xE3, 0xE9, 0x7E,
+    0xA1, 0xAE, 0x70, 0xAE, 0x1F, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xE9, 0x0F, 0xFF, 0xFC, 0x90, 0xFF,
+    0xFF, 0xC9, 0x77, 0x9F, 0xFF, 0x1A, 0xFF, 0xEA, 0x1A, 0xFD, 0xAA, 0xAA, 0xA2, 0xAD, 0x73, 0xAD,
+    0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3F, 0xFD, 0x4F, 0xFD, 0x4F, 0xFD, 0x4E, 0x97, 0x2E, 0x73, 0xE7,
+    0x3E, 0x73, 0xE7, 0x3E, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFA, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC,
+    0x1F, 0xFF, 0xC0, 0x2F, 0xFF, 0xF3, 0x9F, 0xFF, 0xE4, 0xFF, 0xFE, 0x49, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAF, 0xA7, 0x5A, 0xF9, 0x74, 0xAF, 0x97, 0x4A, 0xFA, 0x74, 0xAF, 0xA7, 0x4A, 0xFA, 0x74, 0xAF,
+    0xC7, 0x4A, 0xFC, 0x74, 0xAF, 0xC7, 0x4A, 0xFC, 0x74, 0xAF, 0xC9, 0x73, 0xAF, 0xC9, 0x73, 0xAF,
+    0xCA, 0x73, 0xAF, 0xCA, 0x73, 0x9F, 0xFF, 0xFC, 0x90, 0x9F, 0xFF, 0xFC, 0xA0, 0x9F, 0xFF, 0xFD,
+    0x09, 0xFF, 0xFF, 0xD9, 0x77, 0x3A, 0xD9, 0x70, 0xE2, 0xAD, 0x97, 0x0E, 0x2E, 0x97, 0x0E, 0x2E,
+    0x97, 0x0E, 0x91, 0xE9, 0x70, 0xE9, 0x1E, 0x97, 0x0E, 0x91, 0xE9, 0x70, 0xE9, 0x1E, 0xA7, 0x0E,
+    0x91, 0xEA, 0x70, 0xE9, 0x1E, 0xA7, 0x0E, 0xA1, 0xEA, 0x70, 0xEA, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF,
+    0xFA, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF, 0xFA, 0x1F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x1F, 0x79, 0xF1,
+    0xF7, 0x9F, 0x1F, 0x79, 0xF1, 0xF7, 0x9F, 0x09, 0xF7, 0x9F, 0x00, 0x59, 0xAF, 0xCA, 0x97, 0x09,
+    0xFF, 0xE6, 0xAF, 0xA9, 0x99, 0xFC, 0x93, 0x9F, 0x59, 0xF3, 0xF7, 0x9E, 0xA1, 0x9E, 0x71, 0xAE,
+    0x1E, 0xA7, 0x2E, 0x90, 0xE7, 0x3A, 0xDA, 0x0E, 0x73, 0x9D, 0xA0, 0xE1, 0xAF, 0xE1, 0x9E, 0x9D,
+    0xA1, 0xFC, 0xAA, 0xA2, 0xE0, 0xE7, 0x4D, 0xA0, 0xE7, 0x39, 0xDA, 0x0E, 0x97, 0x2E, 0xA0, 0xF9,
+    0x70, 0xAE, 0x90, 0x9F, 0xCA, 0x99, 0x99, 0x9A, 0xFC, 0x2F, 0xFF, 0xFA, 0x29, 0xFF, 0xFE, 0x4A,
+    0xFF, 0xFC, 0x95, 0xAF, 0xFE, 0x97, 0x09, 0xAF, 0xCA, 0x97, 0x77, 0x00, 0x49, 0xE1, 0xE1, 0xE1,
+    0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xEA, 0x0E,
+    0xA9, 0xEA, 0x9F, 0x9F, 0x9F, 0x19, 0xDA, 0x3A, 0xE4, 0xAD, 0x92, 0x9E, 0x5A, 0xD9, 0x2E, 0xA5,
+    0xAD, 0x91, 0xAE, 0x6E, 0x2E, 0x96, 0xE1, 0xF7, 0xE0, 0x9E, 0x70, 0xE0, 0xEA, 0x70, 0xEA, 0xE7,
+    0x09, 0xFD, 0x97, 0x09, 0xFD, 0x71, 0x9F, 0xCA, 0x71, 0xAF, 0xD9, 0x70, 0xAF, 0xE9, 0x7A, 0xDA,
+    0xAF, 0x96, 0xEA, 0x0F, 0xC9, 0x5E, 0xA1, 0xFC, 0x94, 0xEA, 0x19, 0xFC, 0x93, 0xE9, 0x2A, 0xFC,
+    0x92, 0xE9, 0x3F, 0xD9, 0x1E, 0x94, 0xFD, 0x90, 0x6A, 0xFC, 0x97, 0x5F, 0xDA, 0x74, 0x9F, 0xE7,
+    0x4A, 0xFE, 0x97, 0x3F, 0xFA, 0x72, 0x9F, 0xFC, 0x72, 0xAE, 0x90, 0xF9, 0x71, 0xF1, 0xAE, 0xA7,
+    0x09, 0xEA, 0x2F, 0x70, 0xAE, 0x92, 0xAE, 0x97, 0xF3, 0x9E, 0xA7, 0xEA, 0x4F, 0x6A, 0xE5, 0xAE,
+    0x95, 0xF6, 0xEA, 0x5E, 0x96, 0xAE, 0x49, 0xE7, 0x9E, 0x93, 0xEA, 0x70, 0xEA, 0x3E, 0x97, 0x09,
+    0xE2, 0x9E, 0x72, 0xE9, 0x1A, 0xDA, 0x72, 0xAD, 0xA1, 0xE7, 0x39, 0xE7, 0x75, 0x77, 0x70, 0xF9,
+    0x70, 0xAE, 0xA3, 0xFC, 0x70, 0xFA, 0x29, 0xFC, 0x79, 0xFA, 0x29, 0xFC, 0xA6, 0xFD, 0x29, 0xFD,
+    0x6F, 0xD2, 0x9F, 0xD9, 0x4A, 0xFD, 0x29, 0xDA, 0xF4, 0xEA, 0xE2, 0xAD, 0x9F, 0x92, 0x9E, 0x9E,
+    0x2A, 0xD9, 0x9E, 0xA2, 0xF0, 0xE2, 0xAD, 0xA0, 0xF2, 0xE9, 0x9E, 0x91, 0xAD, 0xA0, 0xAE, 0xA0,
+    0xAE, 0x09, 0xE9, 0x1A, 0xDA, 0x09, 0xF0, 0xF0, 0x9E, 0x91, 0xEA, 0x1F, 0xAE, 0x90, 0xAE, 0xA1,
+    0xF1, 0x9F, 0xE1, 0xAE, 0xA1, 0xF2, 0xFD, 0xA1, 0xAE, 0xA1, 0xF2, 0xAF, 0xC9, 0x1A, 0xF1, 0xF3,
+    0xFC, 0x2F, 0xC1, 0xF3, 0xFA, 0x2F, 0xC1, 0xF3, 0x9E, 0x3F, 0xC1, 0xF7, 0x3F, 0xC1, 0xF7, 0x3F,
+    0xC0, 0x77, 0x49, 0x99, 0x97, 0x0E, 0x2A, 0xE9, 0x7E, 0x2F, 0xA7, 0xE2, 0xFC, 0x69, 0xE2, 0xFC,
+    0xA5, 0x9E, 0x2F, 0xD5, 0x9E, 0x2F, 0xDA, 0x4A, 0xE2, 0xE9, 0xE4, 0xAD, 0xA1, 0x9E, 0x0E, 0xA3,
+    0xAD, 0xA1, 0x9E, 0x09, 0xE3, 0xAD, 0xA1, 0x9E, 0x1E, 0xA2, 0xEA, 0x1A, 0xE1, 0x9E, 0x2E, 0xA1,
+    0xAE, 0x2E, 0x91, 0xE9, 0x1A, 0xE2, 0x9E, 0x1E, 0x91, 0xAE, 0x3E, 0x90, 0xE9, 0x1F, 0x3A, 0xE9,
+    0xE9, 0x1F, 0x93, 0xEA, 0xE9, 0x1F, 0x93, 0xAF, 0xD2, 0xF9, 0x4F, 0xD2, 0xF9, 0x4A, 0xFC, 0x2F,
+    0x95, 0xFC, 0x10, 0x1F, 0xFF, 0xC3, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74,
+    0xFF, 0xC7, 0xFF, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0x59, 0xAF, 0xCA, 0x97, 0x09, 0xFF, 0xE6, 0xAF, 0xA9, 0x99,
+    0xFC, 0x93, 0x9F, 0x59, 0xF3, 0xF7, 0x9E, 0xA1, 0x9E, 0x71, 0xAE, 0x1E, 0xA7, 0x2E, 0x90, 0xE7,
+    0x3A, 0xDA, 0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x39, 0xE9, 0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xE7,
+    0x39, 0xDA, 0x0E, 0x97, 0x2E, 0xA0, 0xF9, 0x70, 0xAE, 0x90, 0x9F, 0xCA, 0x99, 0x99, 0x9A, 0xFC,
+    0x2F, 0xFF, 0xFA, 0x29, 0xFF, 0xFE, 0x4A, 0xFF, 0xFC, 0x95, 0xAF, 0xFE, 0x97, 0x09, 0xAF, 0xCA,
+    0x97, 0x77, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xEA, 0x0D, 0x6A, 0xCA, 0x0D,
+    0x6A, 0xCA, 0x0D, 0x6A, 0xCA, 0x0D, 0x6A, 0xCA, 0x0D, 0x6A, 0xCA, 0x0D, 0x6A, 0xCA, 0x0D, 0x6A,
+    0xCA, 0x0D, 0x6A, 0xCA, 0x0D, 0x6A, 0xCA, 0x0D, 0x6A, 0xCA, 0x0D, 0x6A, 0xCA, 0x0D, 0x6A, 0xCA,
+    0x0D, 0x6A, 0xCA, 0x0D, 0x6A, 0xCA, 0x0D, 0x6A, 0xCA, 0x0D, 0x6A, 0xCA, 0x09, 0xFF, 0xA4, 0x9F,
+    0xFD, 0xA2, 0x9D, 0x99, 0x99, 0x9A, 0xE9, 0x1A, 0xD6, 0xE1, 0xAD, 0x69, 0xD9, 0x0A, 0xD6, 0x9D,
+    0x90, 0xAD, 0x6A, 0xD9, 0x0E, 0x5A, 0xE1, 0xFF, 0xF9, 0x1F, 0xFE, 0xA2, 0xFF, 0xCA, 0x4E, 0xA7,
+    0x2E, 0x97, 0x2E, 0x97, 0x2E, 0xA7, 0x2E, 0xA7, 0x19, 0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xF7, 0x19,
+    0xF7, 0x19, 0xF7, 0x10, 0x0F, 0xFD, 0xA0, 0xFF, 0xE0, 0xAC, 0x72, 0xAC, 0x72, 0xAC, 0x72, 0xAC,
+    0x72, 0xAC, 0x72, 0xD7, 0x2C, 0xA7, 0x1A, 0xA7, 0x0D, 0x70, 0xD9, 0x7D, 0x97, 0xD9, 0x7D, 0x97,
+    0xEA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xE0, 0xFF, 0xE7, 0x30, 0x9F, 0xFF, 0xFC, 0x09, 0xFF, 0xFF,
+    0xC0, 0x9F, 0xCA, 0xAE, 0xAA, 0xAF, 0x70, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77,
+    0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x6A, 0xE7, 0x6A, 0xE9, 0x75,
+    0xAE, 0x97, 0x5A, 0xE9, 0x75, 0xAE, 0x97, 0x5A, 0xE9, 0x60, 0x0E, 0x71, 0xAD, 0xA0, 0xAD, 0xA7,
+    0x0E, 0x2E, 0x7A, 0xDA, 0x2A, 0xE6, 0xE4, 0xE9, 0x4E, 0xA4, 0xAE, 0x39, 0xE6, 0xE9, 0x2E, 0xA6,
+    0xAE, 0x1A, 0xE7, 0x0E, 0xA0, 0xEA, 0x70, 0xAF, 0xE7, 0x2F, 0xDA, 0x72, 0xAF, 0xC7, 0x4F, 0xA7,
+    0x4F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4F, 0xC7, 0x4F, 0xC6, 0x77, 0x77,
+    0x3A, 0xCA, 0x77, 0x5A, 0xCA, 0x77, 0x5A, 0xCA, 0x77, 0x5A, 0xC9, 0x77, 0x49, 0xDA, 0x97, 0x7A,
+    0xFF, 0xEA, 0x71, 0xAF, 0xFC, 0xAF, 0xCA, 0x6F, 0xC9, 0x1D, 0x91, 0xAF, 0xC4, 0xAF, 0x3D, 0x92,
+    0x9F, 0xC2, 0x9F, 0x4D, 0x94, 0xF9, 0x1A, 0xE9, 0x4D, 0x94, 0xAE, 0xA1, 0xF5, 0xD6, 0xF1, 0xEA,
+    0x5D, 0x6F, 0x1E, 0xA5, 0xD6, 0xAE, 0x1E, 0xA5, 0xD6, 0xAE, 0x1F, 0x5D, 0x6F, 0x1F, 0x94, 0xD5,
+    0x9F, 0x1A, 0xFA, 0x3D, 0x4A, 0xFA, 0x2F, 0xEA, 0xAD, 0xAA, 0xAF, 0xE3, 0x9F, 0xFF, 0xFE, 0xA4,
+    0xAF, 0xFF, 0xFC, 0xA7, 0xFF, 0xFE, 0x97, 0x29, 0xAF, 0xEA, 0xA9, 0x77, 0x9D, 0x77, 0x59, 0xD7,
+    0x76, 0x97, 0x40, 0x77, 0x5E, 0x71, 0x9D, 0x93, 0xE7, 0x0E, 0x4A, 0xDA, 0x6E, 0x6E, 0x5A, 0xDA,
+    0x69, 0xE3, 0x9E, 0x70, 0xAD, 0xA2, 0xE9, 0x71, 0xE9, 0x0A, 0xDA, 0x72, 0x9E, 0xAE, 0x74, 0xFD,
+    0x97, 0x5F, 0xC7, 0x6F, 0x97, 0x59, 0xFC, 0x75, 0xFD, 0xA7, 0x3F, 0xF9, 0x71, 0xAE, 0xA0, 0xF7,
+    0x09, 0xF1, 0xAE, 0xA7, 0xF9, 0x2F, 0x95, 0xAF, 0x39, 0xF4, 0x9F, 0x5A, 0xF3, 0xFA, 0x6F, 0xA1,
+    0xFC, 0x79, 0xF9, 0x77, 0x2D, 0x93, 0xAC, 0x4D, 0x1D, 0x4D, 0x4D, 0x1D, 0x4D, 0x4D, 0x1D, 0x4D,
+    0x4D, 0x1A, 0xC9, 0x3D, 0x39, 0xD1, 0xAC, 0xA3, 0xD3, 0xAD, 0x19, 0xD3, 0xD3, 0xDA, 0x2E, 0x2D,
+    0x2A, 0xD9, 0x2E, 0xA1, 0xD1, 0xAE, 0x4F, 0xAD, 0xAF, 0x94, 0x9F, 0xFD, 0xA7, 0xAF, 0xDA, 0x74,
+    0xCA, 0x77, 0xCA, 0x77, 0xCA, 0x77, 0xCA, 0x77, 0xCA, 0x77, 0xC9, 0x76, 0x9C, 0x97, 0x69, 0xC9,
+    0x76, 0x9C, 0x97, 0x69, 0xAA, 0xAA, 0x97, 0x2A, 0xFF, 0x97, 0xEA, 0x29, 0xAD, 0xA5, 0xAD, 0x95,
+    0xAD, 0xA3, 0x9D, 0x97, 0xAD, 0x3E, 0x71, 0xDA, 0x2D, 0xA7, 0x1A, 0xD1, 0x9D, 0x97, 0x1A, 0xD1,
+    0x9D, 0x72, 0x9D, 0x1A, 0xD7, 0x29, 0xD9, 0x0A, 0xD7, 0x29, 0xD9, 0x09, 0xD7, 0x2A, 0xD2, 0xD9,
+    0x71, 0xE2, 0xE7, 0x09, 0xDA, 0x29, 0xD9, 0x69, 0xE4, 0x9D, 0x94, 0xAE, 0x39, 0xAA, 0xEA, 0x29,
+    0xFA, 0x91, 0xFE, 0x2A, 0xFD, 0x90, 0xFE, 0x2A, 0xFD, 0x97, 0x72, 0x77, 0x49, 0xAE, 0x99, 0xC7,
+    0xAF, 0xF9, 0x5A, 0xDA, 0x99, 0xAE, 0x95, 0xD9, 0x39, 0xDA, 0x4A, 0xCA, 0x5D, 0xA4, 0xD6, 0xE4,
+    0xD6, 0xAD, 0x4D, 0x6E, 0x4D, 0x6E, 0x4D, 0xA3, 0x9F, 0x4F, 0xFF, 0x93, 0x9F, 0xFE, 0x94, 0x9F,
+    0xE9, 0xFC, 0xA2, 0x9A, 0xEA, 0x1F, 0xCA, 0x73, 0xAA, 0xA9, 0x00, 0x77, 0x77, 0x77, 0x77, 0x76,
+    0xAE, 0x97, 0x0F, 0xE6, 0xE9, 0x99, 0xE9, 0x3A, 0xD4, 0xAD, 0x3D, 0xA5, 0xAC, 0x92, 0xD9, 0x59,
+    0xC9, 0x2D, 0x95, 0xAC, 0x92, 0xD9, 0x4A, 0xD3, 0xD9, 0x1F, 0xA4, 0xD9, 0x1F, 0xC9, 0x3D, 0x94,
+    0x9E, 0x2D, 0x96, 0xDA, 0x1D, 0x96, 0xAD, 0x1D, 0xA6, 0xAD, 0x1E, 0xA9, 0x4E, 0x1F, 0xD9, 0x1A,
+    0xE1, 0xFF, 0xFC, 0x1F, 0xFF, 0xA1, 0xD9, 0x09, 0xFE, 0x2D, 0x92, 0x9A, 0xDA, 0x3D, 0x97, 0x3D,
+    0x97, 0x3D, 0x97, 0x3D, 0x97, 0x39, 0x97, 0x30, 0x0D, 0xA6, 0xD9, 0x19, 0xD6, 0xD9, 0x2D, 0xA5,
+    0xDA, 0x29, 0xD5, 0xDA, 0x3D, 0xA4, 0xDA, 0x3A, 0xD4, 0xD9, 0x4E, 0x29, 0xD5, 0xAD, 0x91, 0xAD,
+    0x6E, 0x1D, 0xA6, 0xAD, 0x9A, 0xD9, 0x69, 0xFD, 0x70, 0xFC, 0x97, 0x0F, 0xC7, 0x1F, 0xA7, 0x1A,
+    0xE7, 0x2A, 0xE7, 0x29, 0xE7, 0x29, 0xE9, 0x72, 0xE9, 0x72, 0xEA, 0x72, 0xE9, 0x77, 0x20, 0x29,
+    0xAF, 0xCA, 0x94, 0xFF, 0xD9, 0x29, 0xD4, 0x9A, 0xC9, 0x29, 0xD7, 0x4E, 0x74, 0xE9, 0x73, 0xEA,
+    0x73, 0xAE, 0x97, 0x3E, 0x97, 0xAA, 0xFC, 0x95, 0xFF, 0xC9, 0x3F, 0x91, 0x9E, 0x2A, 0xE4, 0x9D,
+    0xA1, 0xE9, 0x5E, 0x1E, 0x6A, 0xD1, 0xE9, 0x5E, 0x1A, 0xE4, 0x9E, 0x2F, 0x99, 0x9A, 0xEA, 0x2A,
+    0xFF, 0xD4, 0xAF, 0xF7, 0xAE, 0xA9, 0x30, 0x2A, 0xE9, 0x4C, 0xA9, 0x09, 0xC3, 0xAA, 0x3A, 0x92,
+    0xAA, 0x70, 0x9C, 0x97, 0x09, 0xE6, 0xD9, 0x95, 0xD7, 0x0D, 0x3D, 0x2D, 0x3D, 0x91, 0xAD, 0x99,
+    0xAD, 0x3F, 0xDA, 0x4A, 0xE9, 0x20, 0x2A, 0xFF, 0x92, 0x9A, 0xAA, 0xFC, 0x7D, 0xA7, 0x0D, 0xA7,
+    0x9D, 0x97, 0x0D, 0xA7, 0x0D, 0xA7, 0x09, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xAD,
+    0x72, 0xEA, 0x97, 0x0A, 0xFC, 0xA7, 0xAF, 0xA7, 0x0A, 0xDA, 0x70, 0x9D, 0xA7, 0x0E, 0x97, 0xAE,
+    0x79, 0xE9, 0x7E, 0xA2, 0x0E, 0x97, 0x3A, 0xE1, 0x9A, 0xCA, 0xA6, 0xDA, 0xFE, 0x5F, 0x92, 0xAD,
+    0x4E, 0x5D, 0x93, 0xDA, 0x5A, 0xCA, 0x3D, 0x95, 0x9C, 0xA3, 0xD9, 0x5A, 0xCA, 0x3D, 0x95, 0xAC,
+    0xA3, 0xDA, 0x5A, 0xD3, 0xDA, 0x5A, 0xD2, 0x9D, 0xA5, 0xAD, 0x29, 0xE5, 0xE2, 0x9E, 0x5E, 0x29,
+    0xE5, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x70, 0x4A, 0xEA, 0x69, 0xCA,
+    0x19, 0xD4, 0x9D, 0x4D, 0x3D, 0x94, 0xAC, 0x91, 0x9D, 0x6D, 0x1A, 0xD6, 0xD1, 0xAC, 0xA6, 0xD9,
+    0x0D, 0xA6, 0xD9, 0x0F, 0xFF, 0xA0, 0xFF, 0xFA, 0x0E, 0x6D, 0xA0, 0xE5, 0x9D, 0x90, 0xAD, 0x94,
+    0xAD, 0x90, 0xAE, 0x39, 0xE1, 0x9F, 0xAA, 0xFC, 0x2F, 0xFD, 0xA2, 0x9F, 0xFC, 0x4A, 0xFE, 0x95,
+    0x9A, 0xEA, 0x30, 0x70, 0xD4, 0xD4, 0xD4, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0xAD, 0x3A,
+    0xD3, 0xAD, 0x3A, 0xD3, 0xE9, 0x2E, 0xA9, 0x1F, 0xCA, 0x0F, 0xA9, 0x09, 0xA9, 0x2A, 0xA3, 0xAC,
+    0x91, 0xAD, 0x3A, 0xC9, 0x09, 0xD4, 0xAC, 0x90, 0xDA, 0x4D, 0x99, 0xD5, 0xD9, 0xD9, 0x5F, 0xC6,
+    0xF7, 0xF6, 0x9F, 0xC5, 0x9D, 0xAE, 0x49, 0xD0, 0xF3, 0xAD, 0x1F, 0x2A, 0xD1, 0x9F, 0x1A, 0xD2,
+    0xAF, 0x00, 0x77, 0x9F, 0x97, 0x09, 0xFD, 0x79, 0xFE, 0x97, 0x09, 0xAF, 0x72, 0x9E, 0xA7, 0x2F,
+    0x72, 0xAE, 0x72, 0xF9, 0x70, 0x9F, 0xA7, 0x0F, 0xD7, 0x9F, 0xD7, 0xE9, 0xE9, 0x59, 0xE0, 0x9D,
+    0xA5, 0xE2, 0xDA, 0x49, 0xDA, 0x2E, 0x4E, 0x3A, 0xD3, 0x9D, 0x94, 0xD9, 0x2E, 0x5D, 0xA1, 0x9D,
+    0x95, 0xAD, 0x1D, 0xA6, 0x9D, 0x00, 0x0A, 0xD9, 0x5D, 0xA1, 0xAD, 0x95, 0xDA, 0x1A, 0xD9, 0x5D,
+    0xA1, 0xE9, 0x5E, 0x1E, 0xA5, 0xE1, 0xEA, 0x5E, 0x1E, 0xA5, 0xE1, 0xF5, 0xE1, 0xF5, 0xE1, 0xF9,
+    0x3F, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x1C, 0xAF, 0xFA, 0xD1, 0xCA, 0x0F, 0xD9, 0xAD, 0x1C, 0xA2,
+    0x99, 0x96, 0xCA, 0x74, 0xA9, 0x73, 0x0A, 0xA9, 0x6A, 0xA9, 0x19, 0xD6, 0xD9, 0x2D, 0x95, 0xDA,
+    0x2A, 0xD5, 0xDA, 0x3D, 0xA4, 0xDA, 0x3A, 0xD4, 0xDA, 0x4D, 0xA2, 0x9D, 0x94, 0xE2, 0xAD, 0x59,
+    0xDA, 0x1E, 0x6E, 0x0A, 0xD9, 0x69, 0xFD, 0x70, 0xFC, 0xA7, 0x0F, 0xC9, 0x70, 0xFC, 0x30, 0x1F,
+    0xFC, 0x3A, 0xAA, 0xAF, 0xA6, 0xAD, 0x97, 0xAC, 0xA7, 0x09, 0xD7, 0x19, 0xC9, 0x71, 0x9C, 0xA7,
+    0x2E, 0xAA, 0x97, 0xFC, 0x69, 0xD9, 0x70, 0xD7, 0x2D, 0x72, 0xDA, 0x71, 0xAF, 0xA9, 0x69, 0xAF,
+    0x72, 0xDA, 0x71, 0xAD, 0x71, 0xE7, 0x0E, 0x97, 0xAE, 0x79, 0xAA, 0xA2, 0x39, 0xAE, 0xA6, 0xAF,
+    0xEA, 0x3E, 0xA9, 0x09, 0xAD, 0x91, 0x9D, 0x59, 0xD1, 0xDA, 0x6D, 0x90, 0xD9, 0x6D, 0xA0, 0xD9,
+    0x6A, 0xD0, 0xD9, 0x6A, 0xD0, 0xDA, 0x6D, 0xA0, 0xE9, 0x4A, 0xD9, 0x09, 0xFC, 0xAF, 0xC2, 0xFF,
+    0xD9, 0x3A, 0xFE, 0x95, 0x9F, 0xA3, 0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x29, 0xD3, 0xD5, 0xAD, 0x3D,
+    0x5A, 0xCA, 0x29, 0xD5, 0xAC, 0xA2, 0x9D, 0x5D, 0xA2, 0xAC, 0xA5, 0xD9, 0x2A, 0xCA, 0x5D, 0x92,
+    0xD9, 0x5D, 0x92, 0xD9, 0x5D, 0x3D, 0x95, 0xD3, 0xFA, 0x29, 0xD3, 0xAE, 0xA7, 0x70, 0x69, 0xAC,
+    0xA9, 0x71, 0xFE, 0x7E, 0xA9, 0xAE, 0x5A, 0xD9, 0x3D, 0x94, 0xDA, 0x49, 0xD3, 0xAD, 0x94, 0x9D,
+    0x3E, 0x6D, 0x3E, 0x95, 0xD3, 0xE9, 0x49, 0xD2, 0x9F, 0x4A, 0xD2, 0x9F, 0xCA, 0x99, 0xAD, 0xA2,
+    0xAF, 0xFE, 0x3E, 0x9F, 0xE9, 0x3E, 0x09, 0xFC, 0x94, 0xE3, 0x96, 0x9D, 0xA7, 0x3A, 0xDA, 0x73,
+    0xAD, 0x97, 0x3E, 0x97, 0x77, 0x20, 0x75, 0x9F, 0x93, 0xEA, 0xAE, 0x1A, 0xCA, 0x3A, 0xC9, 0x0D,
+    0x70, 0xD7, 0x0D, 0x70, 0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x79, 0xDA, 0x79, 0xE7, 0xAD, 0x7A, 0xD7,
+    0xAD, 0x7A, 0xD7, 0x09, 0xA3, 0x39, 0xAF, 0xFE, 0x3A, 0xFF, 0xF9, 0x2E, 0xA9, 0x09, 0xAD, 0x95,
+    0x9D, 0x59, 0xD5, 0xDA, 0x6D, 0x94, 0xD9, 0x6D, 0xA4, 0xD9, 0x6A, 0xD4, 0xD9, 0x6A, 0xD4, 0xDA,
+    0x6D, 0xA4, 0xE9, 0x4A, 0xD9, 0x49, 0xFC, 0xAF, 0xC6, 0xFF, 0xD9, 0x7A, 0xFE, 0x97, 0x19, 0xFA,
+    0x70, 0x0F, 0xFF, 0x90, 0xFF, 0xF9, 0x5A, 0xCA, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x97, 0x2D,
+    0x73, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x2A, 0xD7, 0x2A, 0xF7, 0x1F, 0x77, 0x10, 0x74, 0xD4, 0xD2,
+    0xD4, 0xAC, 0x91, 0xD5, 0xCA, 0x1D, 0x5D, 0x1A, 0xC5, 0xD1, 0xAC, 0x94, 0xAC, 0x90, 0xAC, 0x94,
+    0xAC, 0x90, 0xAC, 0xA4, 0xAC, 0xA0, 0x9D, 0x4A, 0xCA, 0x09, 0xDA, 0x29, 0xD9, 0x1F, 0xFC, 0x91,
+    0xFF, 0xC2, 0x9F, 0xE9, 0x39, 0xFA, 0x20, 0x71, 0x97, 0x71, 0xAC, 0x77, 0x1A, 0xC7, 0x71, 0xAC,
+    0x77, 0x1A, 0xC7, 0x71, 0xAC, 0x76, 0x9A, 0xFC, 0xA9, 0x70, 0x9F, 0xFE, 0x95, 0xAF, 0xAD, 0x9A,
+    0xF9, 0x39, 0xF1, 0xAC, 0x19, 0xF3, 0xF2, 0xD2, 0x9E, 0xA1, 0x9E, 0x3D, 0x3A, 0xE1, 0xEA, 0x3D,
+    0x4E, 0x90, 0xE4, 0xD4, 0xAD, 0xA0, 0xE4, 0xD4, 0x9D, 0xA0, 0xE4, 0xD4, 0x9E, 0x9D, 0xA4, 0xD5,
+    0xE0, 0xE4, 0xD4, 0x9D, 0xA0, 0xE4, 0xD4, 0x9D, 0xA0, 0xE9, 0x3D, 0x4E, 0xA0, 0xF3, 0xD3, 0xAE,
+    0x90, 0xAF, 0xA9, 0x0D, 0x09, 0x9F, 0xC2, 0xFF, 0xFF, 0xC2, 0xAF, 0xFF, 0xE4, 0xFF, 0xFD, 0xA5,
+    0xAF, 0xFE, 0x97, 0x0A, 0xFD, 0xA9, 0x75, 0xCA, 0x77, 0x1C, 0xA7, 0x71, 0xA9, 0x70, 0x09, 0xCA,
+    0x97, 0x0A, 0xA2, 0x9F, 0x95, 0xD9, 0x29, 0xFC, 0x93, 0xAD, 0x59, 0xF9, 0x19, 0xD7, 0x0A, 0xE1,
+    0xDA, 0x71, 0xAD, 0x9A, 0xD7, 0x3F, 0xC9, 0x73, 0xAF, 0x74, 0x9E, 0x97, 0x49, 0xE7, 0x5F, 0xA7,
+    0x3F, 0xD7, 0x2A, 0xEA, 0xDA, 0x71, 0xE9, 0x0E, 0x70, 0xEA, 0x1A, 0xDA, 0x6A, 0xE3, 0xFA, 0x92,
+    0x9E, 0xA3, 0xAF, 0xCA, 0x1F, 0x5F, 0xCA, 0x0A, 0xE9, 0x6A, 0xEA, 0x49, 0x72, 0xAC, 0x72, 0x9C,
+    0x97, 0x19, 0xC9, 0x5D, 0x19, 0xC9, 0x1A, 0x91, 0xD1, 0x9C, 0x91, 0xD1, 0xD2, 0xCA, 0x19, 0xCA,
+    0x0D, 0x2C, 0xA2, 0xD0, 0xAC, 0x91, 0xCA, 0x2D, 0x0A, 0xC9, 0x1C, 0xA2, 0xD0, 0xAC, 0x91, 0xCA,
+    0x2D, 0x0A, 0xCA, 0x1D, 0x2D, 0x99, 0xD1, 0xD2, 0xD9, 0x9D, 0xA0, 0xD1, 0xAD, 0x90, 0xFF, 0xE1,
+    0xAF, 0xFC, 0xA2, 0xFF, 0xC4, 0xAF, 0xC9, 0x7A, 0xC7, 0x29, 0xC9, 0x71, 0x9C, 0x97, 0x19, 0xC9,
+    0x71, 0x9C, 0x97, 0x2A, 0x50, 0x39, 0x97, 0x95, 0xAC, 0xA6, 0xAD, 0x39, 0xD7, 0x0D, 0x3D, 0x97,
+    0x0A, 0xC9, 0x19, 0xD7, 0x19, 0xCA, 0x1A, 0xD3, 0x99, 0x39, 0xD1, 0xDA, 0x3C, 0x94, 0xD1, 0xDA,
+    0x3C, 0x93, 0x9D, 0x1D, 0xA3, 0xCA, 0x3A, 0xD1, 0xAD, 0x3D, 0x29, 0xDA, 0x19, 0xDA, 0x99, 0xFA,
+    0xF3, 0xAF, 0xCA, 0xFD, 0x94, 0x9E, 0x91, 0xEA, 0x97, 0x74, 0x79, 0xDA, 0x77, 0xAE, 0x77, 0xF9,
+    0x75, 0x9F, 0xC7, 0x5D, 0xA9, 0xD9, 0x73, 0x9D, 0x90, 0xDA, 0x73, 0xAD, 0x1A, 0xD7, 0x3D, 0xA1,
+    0x9D, 0x97, 0x19, 0xD9, 0x2E, 0x71, 0xE3, 0xAD, 0x71, 0xDA, 0x39, 0xDA, 0x7A, 0xD9, 0x4E, 0x7E,
+    0x5A, 0xD9, 0x59, 0xDA, 0x6D, 0xA5, 0xFF, 0xFD, 0x5F, 0xFF, 0xDA, 0x3A, 0xFF, 0xFE, 0x3E, 0xA9,
+    0x99, 0x99, 0x99, 0x99, 0xE9, 0x19, 0xE7, 0x1E, 0xA1, 0xAE, 0x71, 0xAE, 0x1E, 0xA7, 0x19, 0xE9,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xDA, 0x77, 0xAD, 0xA7, 0x7A, 0xE7, 0x7F, 0x70, 0x77, 0x19,
+    0xAE, 0x99, 0xC4, 0xAF, 0xF9, 0x2A, 0xDA, 0x99, 0xAE, 0x92, 0xD9, 0x39, 0xDA, 0x1A, 0xCA, 0x5D,
+    0xA1, 0xD6, 0xE1, 0xD6, 0xAD, 0x1D, 0x6E, 0x1D, 0x6E, 0x1D, 0xA3, 0x9F, 0x1F, 0xFF, 0x90, 0x9F,
+    0xFE, 0x91, 0xAF, 0xE9, 0xD9, 0x29, 0xAE, 0xA1, 0xDA, 0x77, 0x77, 0x0A, 0xD7, 0x2E, 0x72, 0xE9,
+    0x70, 0x9E, 0xA7, 0x72, 0x7A, 0xE9, 0x76, 0x91, 0xAC, 0x77, 0x1A, 0xC7, 0x70, 0xAC, 0x97, 0x79,
+    0xC9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xDA, 0x77, 0xAE, 0x77, 0xF9, 0x75,
+    0x9F, 0xC7, 0x5D, 0xA9, 0xD9, 0x73, 0x9D, 0x90, 0xDA, 0x73, 0xAD, 0x1A, 0xD7, 0x3D, 0xA1, 0x9D,
+    0x97, 0x19, 0xD9, 0x2E, 0x71, 0xE3, 0xAD, 0x71, 0xDA, 0x39, 0xDA, 0x7A, 0xD9, 0x4E, 0x7E, 0x5A,
+    0xD9, 0x59, 0xDA, 0x6D, 0xA5, 0xFF, 0xFD, 0x5F, 0xFF, 0xDA, 0x3A, 0xFF, 0xFE, 0x3E, 0xA9, 0x99,
+    0x99, 0x99, 0x99, 0xE9, 0x19, 0xE7, 0x1E, 0xA1, 0xAE, 0x71, 0xAE, 0x1E, 0xA7, 0x19, 0xE9, 0x4A,
+    0xDA, 0x71, 0x91, 0xCA, 0x72, 0x9C, 0x97, 0x2C, 0x97, 0x29, 0xA7, 0x77, 0x77, 0x73, 0x9A, 0xE9,
+    0x9C, 0x4A, 0xFF, 0x92, 0xAD, 0xA9, 0x9A, 0xE9, 0x2D, 0x93, 0x9D, 0xA1, 0xAC, 0xA5, 0xDA, 0x1D,
+    0x6E, 0x1D, 0x6A, 0xD1, 0xD6, 0xE1, 0xD6, 0xE1, 0xDA, 0x39, 0xF1, 0xFF, 0xF9, 0x09, 0xFF, 0xE9,
+    0x1A, 0xFE, 0x9D, 0x92, 0x9A, 0xEA, 0x1D, 0xA0, 0x72, 0xCA, 0x77, 0x0A, 0xC9, 0x77, 0x0D, 0x77,
+    0x0A, 0xCA, 0x77, 0x0D, 0x97, 0x77, 0x74, 0xD7, 0x70, 0xAD, 0xA7, 0x69, 0xF9, 0x74, 0x9C, 0xA1,
+    0xAC, 0x97, 0x29, 0xC9, 0x39, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9D, 0xA7, 0x7A, 0xE7, 0x7F,
+    0x97, 0x59, 0xFC, 0x75, 0xDA, 0x9D, 0x97, 0x39, 0xD9, 0x0D, 0xA7, 0x3A, 0xD1, 0xAD, 0x73, 0xDA,
+    0x19, 0xD9, 0x71, 0x9D, 0x92, 0xE7, 0x1E, 0x3A, 0xD7, 0x1D, 0xA3, 0x9D, 0xA7, 0xAD, 0x94, 0xE7,
+    0xE5, 0xAD, 0x95, 0x9D, 0xA6, 0xDA, 0x5F, 0xFF, 0xD5, 0xFF, 0xFD, 0xA3, 0xAF, 0xFF, 0xE3, 0xEA,
+    0x99, 0x99, 0x99, 0x99, 0x9E, 0x91, 0x9E, 0x71, 0xEA, 0x1A, 0xE7, 0x1A, 0xE1, 0xEA, 0x71, 0x9E,
+    0x90, 0x74, 0xD7, 0x39, 0xC9, 0x73, 0xD7, 0x39, 0xD7, 0x3D, 0x97, 0x77, 0x74, 0xCA, 0x73, 0xAD,
+    0x97, 0x1A, 0xCA, 0xD7, 0x0A, 0xC9, 0x1A, 0xC9, 0x5A, 0xA4, 0x9C, 0x77, 0x69, 0xAE, 0x99, 0xC5,
+    0xAF, 0xF9, 0x3A, 0xDA, 0x99, 0xAE, 0x93, 0xD9, 0x39, 0xDA, 0x2A, 0xCA, 0x5D, 0xA2, 0xD6, 0xE2,
+    0xD6, 0xAD, 0x2D, 0x6E, 0x2D, 0x6E, 0x2D, 0xA3, 0x9F, 0x2F, 0xFF, 0x91, 0x9F, 0xFE, 0x92, 0xAF,
+    0xE9, 0xD9, 0x39, 0xAE, 0xA1, 0xDA, 0x00, 0x9D, 0x77, 0x29, 0xD9, 0x77, 0x19, 0xDA, 0x39, 0xA7,
+    0x49, 0xAA, 0x19, 0xD9, 0x77, 0x0F, 0x77, 0xD1, 0xD7, 0x49, 0xC9, 0x3A, 0xC7, 0x77, 0x77, 0x77,
+    0x77, 0x59, 0xDA, 0x77, 0x0A, 0xE7, 0x70, 0xF9, 0x76, 0x9F, 0xC7, 0x6D, 0xA9, 0xD9, 0x74, 0x9D,
+    0x90, 0xDA, 0x74, 0xAD, 0x1A, 0xD7, 0x4D, 0xA1, 0x9D, 0x97, 0x29, 0xD9, 0x2E, 0x72, 0xE3, 0xAD,
+    0x72, 0xDA, 0x39, 0xDA, 0x70, 0xAD, 0x94, 0xE7, 0x0E, 0x5A, 0xD9, 0x69, 0xDA, 0x6D, 0xA6, 0xFF,
+    0xFD, 0x6F, 0xFF, 0xDA, 0x4A, 0xFF, 0xFE, 0x4E, 0xA9, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x29, 0xE7,
+    0x1E, 0xA2, 0xAE, 0x71, 0xAE, 0x2E, 0xA7, 0x19, 0xE9, 0x09, 0x97, 0x6A, 0xD7, 0x6A, 0xD9, 0x75,
+    0xAD, 0xA7, 0x72, 0xCA, 0x75, 0xE9, 0x73, 0xDA, 0xD9, 0x71, 0xD2, 0xAC, 0x97, 0xAA, 0x49, 0xC7,
+    0x77, 0x29, 0xAE, 0x99, 0xC7, 0xAF, 0xF9, 0x5A, 0xDA, 0x99, 0xAE, 0x95, 0xD9, 0x39, 0xDA, 0x4A,
+    0xCA, 0x5D, 0xA4, 0xD6, 0xE4, 0xD6, 0xAD, 0x4D, 0x6E, 0x4D, 0x6E, 0x4D, 0xA3, 0x9F, 0x4F, 0xFF,
+    0x93, 0x9F, 0xFE, 0x94, 0xAF, 0xE9, 0xD9, 0x59, 0xAE, 0xA1, 0xDA, 0x7A, 0xDA, 0x97, 0x69, 0x1A,
+    0xC7, 0x71, 0xCA, 0x77, 0x0C, 0x97, 0x71, 0x97, 0x71, 0x99, 0x77, 0x09, 0xD9, 0x77, 0xF7, 0x6D,
+    0x1D, 0x74, 0xCA, 0x3A, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x19, 0xDA, 0x77, 0xAE, 0x77, 0xF9, 0x75,
+    0x9F, 0xC7, 0x5D, 0xA9, 0xD9, 0x73, 0x9D, 0x90, 0xDA, 0x73, 0xAD, 0x1A, 0xD7, 0x3D, 0xA1, 0x9D,
+    0x97, 0x19, 0xD9, 0x2E, 0x71, 0xE3, 0xAD, 0x71, 0xDA, 0x39, 0xDA, 0x7A, 0xD9, 0x4E, 0x7E, 0x5A,
+    0xD9, 0x59, 0xDA, 0x6D, 0xA5, 0xFF, 0xFD, 0x5F, 0xFF, 0xDA, 0x3A, 0xFF, 0xFE, 0x3E, 0xA9, 0x99,
+    0x99, 0x99, 0x99, 0xE9, 0x19, 0xE7, 0x1E, 0xA1, 0xAE, 0x71, 0xAE, 0x1E, 0xA7, 0x19, 0xE9, 0x79,
+    0xEA, 0x70, 0x92, 0xC9, 0x72, 0xAC, 0x72, 0xAC, 0x70, 0x91, 0x97, 0x0D, 0x97, 0x1A, 0xE7, 0x0D,
+    0x90, 0xD6, 0xD3, 0xAC, 0x59, 0x69, 0x77, 0x39, 0xAE, 0x99, 0xC4, 0xAF, 0xF9, 0x2A, 0xDA, 0x99,
+    0xAE, 0x92, 0xD9, 0x39, 0xDA, 0x1A, 0xCA, 0x5D, 0xA1, 0xD6, 0xE1, 0xD6, 0xAD, 0x1D, 0x6E, 0x1D,
+    0x6E, 0x1D, 0xA3, 0x9F, 0x1F, 0xFF, 0x90, 0x9F, 0xFE, 0x91, 0xAF, 0xE9, 0xD9, 0x29, 0xAE, 0xA1,
+    0xDA, 0x77, 0x71, 0x9E, 0x2C, 0x97, 0x2D, 0x0C, 0xA1, 0xC9, 0x72, 0xC9, 0x1C, 0xAA, 0xC7, 0x3C,
+    0x92, 0xDA, 0x77, 0x77, 0x77, 0x69, 0xC7, 0x71, 0xDA, 0x77, 0xFA, 0x75, 0xD1, 0xAC, 0xA7, 0x3C,
+    0xA4, 0xCA, 0x77, 0x77, 0x77, 0x49, 0xDA, 0x77, 0xAE, 0x77, 0xF9, 0x75, 0x9F, 0xC7, 0x5D, 0xA9,
+    0xD9, 0x73, 0x9D, 0x90, 0xDA, 0x73, 0xAD, 0x1A, 0xD7, 0x3D, 0xA1, 0x9D, 0x97, 0x19, 0xD9, 0x2E,
+    0x71, 0xE3, 0xAD, 0x71, 0xDA, 0x39, 0xDA, 0x7A, 0xD9, 0x4E, 0x7E, 0x5A, 0xD9, 0x59, 0xDA, 0x6D,
+    0xA5, 0xFF, 0xFD, 0x5F, 0xFF, 0xDA, 0x3A, 0xFF, 0xFE, 0x3E, 0xA9, 0x99, 0x99, 0x99, 0x99, 0xE9,
+    0x19, 0xE7, 0x1E, 0xA1, 0xAE, 0x71, 0xAE, 0x1E, 0xA7, 0x19, 0xE9, 0x77, 0x0A, 0xDA, 0x2C, 0x5C,
+    0xA0, 0xC9, 0x1C, 0x49, 0xC1, 0x9C, 0xAD, 0x49, 0xC2, 0x9D, 0x97, 0x77, 0x74, 0xD7, 0x2A, 0xDA,
+    0x70, 0xAC, 0xAD, 0x96, 0xAC, 0x91, 0x9C, 0xA4, 0x9A, 0x5A, 0x95, 0x9A, 0xE9, 0x9C, 0x4A, 0xFF,
+    0x92, 0xAD, 0xA9, 0x9A, 0xE9, 0x2D, 0x93, 0x9D, 0xA1, 0xAC, 0xA5, 0xDA, 0x1D, 0x6E, 0x1D, 0x6A,
+    0xD1, 0xD6, 0xE1, 0xD6, 0xE1, 0xDA, 0x39, 0xF1, 0xFF, 0xF9, 0x09, 0xFF, 0xE9, 0x1A, 0xFE, 0x9D,
+    0x92, 0x9A, 0xEA, 0x1D, 0xA0, 0x70, 0x9A, 0x77, 0x09, 0xD9, 0x77, 0xF7, 0x6D, 0x1D, 0x73, 0x9C,
+    0x93, 0xAC, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9D, 0xA7, 0x7A, 0xE7, 0x7F, 0x97, 0x59, 0xFC, 0x75,
+    0xDA, 0x9D, 0x97, 0x39, 0xD9, 0x0D, 0xA7, 0x3A, 0xD1, 0xAD, 0x73, 0xDA, 0x19, 0xD9, 0x71, 0x9D,
+    0x92, 0xE7, 0x1E, 0x3A, 0xD7, 0x1D, 0xA3, 0x9D, 0xA7, 0xAD, 0x94, 0xE7, 0xE5, 0xAD, 0x95, 0x9D,
+    0xA6, 0xDA, 0x5F, 0xFF, 0xD5, 0xFF, 0xFD, 0xA3, 0xAF, 0xFF, 0xE3, 0xEA, 0x99, 0x99, 0x99, 0x99,
+    0x9E, 0x91, 0x9E, 0x71, 0xEA, 0x1A, 0xE7, 0x1A, 0xE1, 0xEA, 0x71, 0x9E, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x9D, 0xA7, 0x7A, 0xDA, 0x77, 0xAE, 0x77, 0xF7, 0x77, 0x3C, 0xA7, 0x2E, 0x97, 0x0D,
+    0xAD, 0x96, 0xD2, 0xAC, 0x94, 0xAA, 0x49, 0xC7, 0x74, 0x9A, 0xE9, 0x9C, 0x4A, 0xFF, 0x92, 0xAD,
+    0xA9, 0x9A, 0xE9, 0x2D, 0x93, 0x9D, 0xA1, 0xAC, 0xA5, 0xDA, 0x1D, 0x6E, 0x1D, 0x6A, 0xD1, 0xD6,
+    0xE1, 0xD6, 0xE1, 0xDA, 0x39, 0xF1, 0xFF, 0xF9, 0x09, 0xFF, 0xE9, 0x1A, 0xFE, 0x9D, 0x92, 0x9A,
+    0xEA, 0x1D, 0xA7, 0x77, 0x70, 0xAD, 0x72, 0xE7, 0x2E, 0x97, 0x09, 0xEA, 0x77, 0x20, 0x72, 0xCA,
+    0x77, 0x0A, 0xC9, 0x77, 0x0D, 0x77, 0x0A, 0xCA, 0x77, 0x0D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x4A, 0xC9, 0x93, 0xAC, 0x71, 0x9C, 0x5A, 0xC7, 0x2C, 0xA3, 0xAC, 0x97, 0x2A, 0xFD, 0xA7, 0x4A,
+    0xF9, 0x77, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xDA, 0x77, 0xAE, 0x77, 0xF9, 0x75,
+    0x9F, 0xC7, 0x5D, 0xA9, 0xD9, 0x73, 0x9D, 0x90, 0xDA, 0x73, 0xAD, 0x1A, 0xD7, 0x3D, 0xA1, 0x9D,
+    0x97, 0x19, 0xD9, 0x2E, 0x71, 0xE3, 0xAD, 0x71, 0xDA, 0x39, 0xDA, 0x7A, 0xD9, 0x4E, 0x7E, 0x5A,
+    0xD9, 0x59, 0xDA, 0x6D, 0xA5, 0xFF, 0xFD, 0x5F, 0xFF, 0xDA, 0x3A, 0xFF, 0xFE, 0x3E, 0xA9, 0x99,
+    0x99, 0x99, 0x99, 0xE9, 0x19, 0xE7, 0x1E, 0xA1, 0xAE, 0x71, 0xAE, 0x1E, 0xA7, 0x19, 0xE9, 0x69,
+    0xC9, 0x72, 0xD7, 0x29, 0xCA, 0x72, 0xD9, 0x71, 0x9D, 0x77, 0x77, 0x77, 0x77, 0xCA, 0x5C, 0xA3,
+    0xD5, 0xCA, 0x39, 0xD9, 0x99, 0xAD, 0x5A, 0xFD, 0x96, 0x9E, 0xA7, 0x77, 0x77, 0x72, 0x9A, 0xE9,
+    0x9C, 0x4A, 0xFF, 0x92, 0xAD, 0xA9, 0x9A, 0xE9, 0x2D, 0x93, 0x9D, 0xA1, 0xAC, 0xA5, 0xDA, 0x1D,
+    0x6E, 0x1D, 0x6A, 0xD1, 0xD6, 0xE1, 0xD6, 0xE1, 0xDA, 0x39, 0xF1, 0xFF, 0xF9, 0x09, 0xFF, 0xE9,
+    0x1A, 0xFE, 0x9D, 0x92, 0x9A, 0xEA, 0x1D, 0xA0, 0x5A, 0xCA, 0x77, 0x1A, 0xD7, 0x71, 0xAD, 0x97,
+    0x70, 0xAA, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x7A, 0xC9, 0x93, 0xAC, 0x71, 0x9C, 0x5A, 0xC7, 0x2C,
+    0xA3, 0xAC, 0x97, 0x2A, 0xFD, 0xA7, 0x4A, 0xF9, 0x77, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x09, 0xDA, 0x77, 0xAE, 0x77, 0xF9, 0x75, 0x9F, 0xC7, 0x5D, 0xA9, 0xD9, 0x73, 0x9D, 0x90, 0xDA,
+    0x73, 0xAD, 0x1A, 0xD7, 0x3D, 0xA1, 0x9D, 0x97, 0x19, 0xD9, 0x2E, 0x71, 0xE3, 0xAD, 0x71, 0xDA,
+    0x39, 0xDA, 0x7A, 0xD9, 0x4E, 0x7E, 0x5A, 0xD9, 0x59, 0xDA, 0x6D, 0xA5, 0xFF, 0xFD, 0x5F, 0xFF,
+    0xDA, 0x3A, 0xFF, 0xFE, 0x3E, 0xA9, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x19, 0xE7, 0x1E, 0xA1, 0xAE,
+    0x71, 0xAE, 0x1E, 0xA7, 0x19, 0xE9, 0x77, 0x0A, 0xD7, 0x3A, 0xD9, 0x72, 0xAD, 0xA7, 0x39, 0x99,
+    0x77, 0x77, 0x77, 0xCA, 0x5C, 0xA3, 0xD5, 0xCA, 0x39, 0xD9, 0x99, 0xAD, 0x5A, 0xFD, 0x96, 0x9E,
+    0xA7, 0x77, 0x77, 0x72, 0x9A, 0xE9, 0x9C, 0x4A, 0xFF, 0x92, 0xAD, 0xA9, 0x9A, 0xE9, 0x2D, 0x93,
+    0x9D, 0xA1, 0xAC, 0xA5, 0xDA, 0x1D, 0x6E, 0x1D, 0x6A, 0xD1, 0xD6, 0xE1, 0xD6, 0xE1, 0xDA, 0x39,
+    0xF1, 0xFF, 0xF9, 0x09, 0xFF, 0xE9, 0x1A, 0xFE, 0x9D, 0x92, 0x9A, 0xEA, 0x1D, 0xA0, 0x7A, 0xDA,
+    0x77, 0x91, 0xAC, 0x77, 0x1C, 0xA7, 0x70, 0xCA, 0x77, 0x1A, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75,
+    0xAC, 0x94, 0xAC, 0x71, 0x9C, 0x5D, 0x72, 0xCA, 0x3A, 0xC9, 0x72, 0xAF, 0xDA, 0x74, 0xAF, 0x97,
+    0x79, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9D, 0xA7, 0x7A, 0xE7, 0x7F, 0x97, 0x59, 0xFC,
+    0x75, 0xDA, 0x9D, 0x97, 0x39, 0xD9, 0x0D, 0xA7, 0x3A, 0xD1, 0xAD, 0x73, 0xDA, 0x19, 0xD9, 0x71,
+    0x9D, 0x92, 0xE7, 0x1E, 0x3A, 0xD7, 0x1D, 0xA3, 0x9D, 0xA7, 0xAD, 0x94, 0xE7, 0xE5, 0xAD, 0x95,
+    0x9D, 0xA6, 0xDA, 0x5F, 0xFF, 0xD5, 0xFF, 0xFD, 0xA3, 0xAF, 0xFF, 0xE3, 0xEA, 0x99, 0x99, 0x99,
+    0x99, 0x9E, 0x91, 0x9E, 0x71, 0xEA, 0x1A, 0xE7, 0x1A, 0xE1, 0xEA, 0x71, 0x9E, 0x90, 0x39, 0xFA,
+    0x69, 0xCA, 0x99, 0xAC, 0xA7, 0x3D, 0x72, 0xD9, 0x71, 0xD9, 0x71, 0xAC, 0x97, 0x29, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x79, 0x99, 0x70, 0xD5, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x4F, 0xF6, 0xFD, 0x97,
+    0x09, 0x99, 0x77, 0x69, 0xAE, 0x99, 0xC4, 0xAF, 0xF9, 0x2A, 0xDA, 0x99, 0xAE, 0x92, 0xD9, 0x39,
+    0xDA, 0x1A, 0xCA, 0x5D, 0xA1, 0xD6, 0xE1, 0xD6, 0xAD, 0x1D, 0x6E, 0x1D, 0x6E, 0x1D, 0xA3, 0x9F,
+    0x1F, 0xFF, 0x90, 0x9F, 0xFE, 0x91, 0xAF, 0xE9, 0xD9, 0x29, 0xAE, 0xA1, 0xDA, 0x77, 0x71, 0x9E,
+    0x2C, 0x97, 0x2C, 0xA0, 0xCA, 0x1C, 0x97, 0x2C, 0x91, 0xCA, 0xAC, 0x73, 0xC9, 0x19, 0xDA, 0x77,
+    0x77, 0x77, 0x77, 0x6A, 0xC5, 0xAC, 0x71, 0x9C, 0x5D, 0x72, 0xD3, 0xAC, 0x97, 0x2A, 0xFD, 0xA7,
+    0x4A, 0xF9, 0x77, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xDA, 0x77, 0xAE, 0x77, 0xF9,
+    0x75, 0x9F, 0xC7, 0x5D, 0xA9, 0xD9, 0x73, 0x9D, 0x90, 0xDA, 0x73, 0xAD, 0x1A, 0xD7, 0x3D, 0xA1,
+    0x9D, 0x97, 0x19, 0xD9, 0x2E, 0x71, 0xE3, 0xAD, 0x71, 0xDA, 0x39, 0xDA, 0x7A, 0xD9, 0x4E, 0x7E,
+    0x5A, 0xD9, 0x59, 0xDA, 0x6D, 0xA5, 0xFF, 0xFD, 0x5F, 0xFF, 0xDA, 0x3A, 0xFF, 0xFE, 0x3E, 0xA9,
+    0x99, 0x99, 0x99, 0x99, 0xE9, 0x19, 0xE7, 0x1E, 0xA1, 0xAE, 0x71, 0xAE, 0x1E, 0xA7, 0x19, 0xE9,
+    0x77, 0x0A, 0xDA, 0x2C, 0x5C, 0x90, 0xCA, 0x09, 0xC4, 0x9C, 0x2E, 0xA4, 0x9C, 0x39, 0x97, 0x77,
+    0x77, 0x7C, 0xA5, 0xCA, 0x3D, 0x5C, 0xA3, 0x9D, 0x99, 0x9A, 0xD5, 0xAF, 0xD9, 0x69, 0xEA, 0x77,
+    0x77, 0x77, 0x29, 0xAE, 0x99, 0xC4, 0xAF, 0xF9, 0x2A, 0xDA, 0x99, 0xAE, 0x92, 0xD9, 0x39, 0xDA,
+    0x1A, 0xCA, 0x5D, 0xA1, 0xD6, 0xE1, 0xD6, 0xAD, 0x1D, 0x6E, 0x1D, 0x6E, 0x1D, 0xA3, 0x9F, 0x1F,
+    0xFF, 0x90, 0x9F, 0xFE, 0x91, 0xAF, 0xE9, 0xD9, 0x29, 0xAE, 0xA1, 0xDA, 0x4A, 0xC9, 0x93, 0xAC,
+    0x71, 0x9C, 0x5A, 0xC7, 0x2C, 0xA3, 0xAC, 0x97, 0x2A, 0xFD, 0xA7, 0x4A, 0xF9, 0x77, 0x99, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xDA, 0x77, 0xAE, 0x77, 0xF9, 0x75, 0x9F, 0xC7, 0x5D, 0xA9,
+    0xD9, 0x73, 0x9D, 0x90, 0xDA, 0x73, 0xAD, 0x1A, 0xD7, 0x3D, 0xA1, 0x9D, 0x97, 0x19, 0xD9, 0x2E,
+    0x71, 0xE3, 0xAD, 0x71, 0xDA, 0x39, 0xDA, 0x7A, 0xD9, 0x4E, 0x7E, 0x5A, 0xD9, 0x59, 0xDA, 0x6D,
+    0xA5, 0xFF, 0xFD, 0x5F, 0xFF, 0xDA, 0x3A, 0xFF, 0xFE, 0x3E, 0xA9, 0x99, 0x99, 0x99, 0x99, 0xE9,
+    0x19, 0xE7, 0x1E, 0xA1, 0xAE, 0x71, 0xAE, 0x1E, 0xA7, 0x19, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x79, 0xDA, 0x77, 0xAD, 0xA7, 0x7A, 0xE7, 0x7F, 0x70, 0x1C, 0xA5, 0xCA, 0x3D, 0x5C, 0xA3, 0x9D,
+    0x99, 0x9A, 0xD5, 0xAF, 0xD9, 0x69, 0xEA, 0x77, 0x77, 0x77, 0x29, 0xAE, 0x99, 0xC4, 0xAF, 0xF9,
+    0x2A, 0xDA, 0x99, 0xAE, 0x92, 0xD9, 0x39, 0xDA, 0x1A, 0xCA, 0x5D, 0xA1, 0xD6, 0xE1, 0xD6, 0xAD,
+    0x1D, 0x6E, 0x1D, 0x6E, 0x1D, 0xA3, 0x9F, 0x1F, 0xFF, 0x90, 0x9F, 0xFE, 0x91, 0xAF, 0xE9, 0xD9,
+    0x29, 0xAE, 0xA1, 0xDA, 0x77, 0x77, 0x0A, 0xD7, 0x2E, 0x72, 0xE9, 0x70, 0x9E, 0xA7, 0x72, 0x77,
+    0x9F, 0xFF, 0x1A, 0xFF, 0xEA, 0x1A, 0xFD, 0xAA, 0xAA, 0xA2, 0xAD, 0x73, 0xAD, 0x73, 0xE7, 0x3E,
+    0x73, 0xE7, 0x3F, 0xFD, 0x4F, 0xFD, 0x4F, 0xFD, 0x4E, 0x97, 0x2E, 0x73, 0xE7, 0x3E, 0x73, 0xE7,
+    0x3E, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFA, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x1F, 0xFF, 0xC7,
+    0x77, 0x74, 0xAD, 0x73, 0xE9, 0x72, 0xEA, 0x71, 0x9E, 0xA4, 0x4A, 0xEA, 0x69, 0xFE, 0x93, 0x9D,
+    0x93, 0xAC, 0x3D, 0x95, 0xD1, 0x9C, 0xA6, 0xD1, 0xAD, 0xAA, 0xFE, 0xA0, 0xFF, 0xFA, 0x0D, 0x99,
+    0x97, 0x0D, 0x97, 0x2D, 0xA7, 0x2E, 0xA7, 0x2F, 0xA9, 0x99, 0x9A, 0xC2, 0xAF, 0xFD, 0x39, 0xFF,
+    0xC5, 0xAA, 0xF9, 0x77, 0x77, 0x77, 0x1A, 0xD7, 0x2E, 0x97, 0x1E, 0x97, 0x09, 0xEA, 0x30, 0x5A,
+    0xDA, 0x75, 0xCA, 0x73, 0xAC, 0x73, 0x9C, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xFF, 0xF1, 0xAF,
+    0xFE, 0xA1, 0xAF, 0xDA, 0xAA, 0xAA, 0x2A, 0xD7, 0x3A, 0xD7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xFF,
+    0xD4, 0xFF, 0xD4, 0xFF, 0xD4, 0xE9, 0x72, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE9, 0x99, 0x99,
+    0x99, 0x99, 0x2F, 0xFF, 0xA1, 0xFF, 0xFC, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x00, 0x49, 0xE9, 0x70,
+    0x91, 0x9C, 0x73, 0xCA, 0x72, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xAE, 0xA6, 0x9F, 0xE9,
+    0x39, 0xD9, 0x3A, 0xC3, 0xD9, 0x5D, 0x19, 0xCA, 0x6D, 0x1A, 0xDA, 0xAF, 0xEA, 0x0F, 0xFF, 0xA0,
+    0xD9, 0x99, 0x70, 0xD9, 0x72, 0xDA, 0x72, 0xEA, 0x72, 0xFA, 0x99, 0x99, 0xAC, 0x2A, 0xFF, 0xD3,
+    0x9F, 0xFC, 0x5A, 0xAF, 0x91, 0x39, 0xD9, 0x2C, 0x6C, 0xAA, 0xC2, 0xC5, 0x9C, 0x1A, 0xC0, 0xAC,
+    0x59, 0xC2, 0xEA, 0x69, 0x39, 0x97, 0x77, 0x77, 0x71, 0x9F, 0xFF, 0x1A, 0xFF, 0xEA, 0x1A, 0xFD,
+    0xAA, 0xAA, 0xA2, 0xAD, 0x73, 0xAD, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3F, 0xFD, 0x4F, 0xFD, 0x4F,
+    0xFD, 0x4E, 0x97, 0x2E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF,
+    0xFA, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x3A, 0xCA, 0x2A, 0xA4, 0x9C, 0x9C, 0xA1,
+    0xAA, 0x4A, 0xA1, 0xCA, 0x0C, 0xA4, 0xCA, 0x19, 0xE5, 0x94, 0x97, 0x77, 0x77, 0x77, 0x70, 0xAE,
+    0xA6, 0x9F, 0xE9, 0x39, 0xD9, 0x3A, 0xC3, 0xD9, 0x5D, 0x19, 0xCA, 0x6D, 0x1A, 0xDA, 0xAF, 0xEA,
+    0x0F, 0xFF, 0xA0, 0xD9, 0x99, 0x70, 0xD9, 0x72, 0xDA, 0x72, 0xEA, 0x72, 0xFA, 0x99, 0x99, 0xAC,
+    0x2A, 0xFF, 0xD3, 0x9F, 0xFC, 0x5A, 0xAF, 0x91, 0x74, 0xD7, 0x49, 0xCA, 0x74, 0xAC, 0x97, 0x4D,
+    0x74, 0xAC, 0xA7, 0x9C, 0xA7, 0x4E, 0x97, 0x2D, 0x9D, 0x97, 0x9C, 0xA2, 0x9C, 0x96, 0xA6, 0xA7,
+    0x77, 0x74, 0x9F, 0xFF, 0x2A, 0xFF, 0xEA, 0x2A, 0xFD, 0xAA, 0xAA, 0xA3, 0xAD, 0x74, 0xAD, 0x74,
+    0xE7, 0x4E, 0x74, 0xE7, 0x4F, 0xFD, 0x5F, 0xFD, 0x5F, 0xFD, 0x5E, 0x97, 0x3E, 0x74, 0xE7, 0x4E,
+    0x74, 0xE7, 0x4E, 0x99, 0x99, 0x99, 0x99, 0x93, 0xFF, 0xFA, 0x2F, 0xFF, 0xC2, 0xFF, 0xFC, 0x2F,
+    0xFF, 0xC1, 0x75, 0xD5, 0x9A, 0x49, 0xC9, 0x5D, 0xA3, 0xD5, 0xF9, 0x19, 0xD4, 0xD1, 0xAC, 0x90,
+    0xD9, 0x3C, 0xA3, 0x9C, 0x97, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xEA, 0x70, 0x9F, 0xE9, 0x59, 0xD9,
+    0x3A, 0xC5, 0xD9, 0x5D, 0x39, 0xCA, 0x6D, 0x3A, 0xDA, 0xAF, 0xEA, 0x2F, 0xFF, 0xA2, 0xD9, 0x99,
+    0x72, 0xD9, 0x74, 0xDA, 0x74, 0xEA, 0x74, 0xFA, 0x99, 0x99, 0xAC, 0x4A, 0xFF, 0xD5, 0x9F, 0xFC,
+    0x7A, 0xAF, 0x93, 0x0A, 0xD7, 0x71, 0xAD, 0x95, 0x97, 0x19, 0xDA, 0x3A, 0xD7, 0x19, 0x9A, 0xA1,
+    0x9E, 0xA7, 0x59, 0xCA, 0x0A, 0xCA, 0x73, 0x9C, 0x92, 0x9C, 0xA7, 0x29, 0x69, 0x77, 0x77, 0x77,
+    0x09, 0xFF, 0xF6, 0xAF, 0xFE, 0xA6, 0xAF, 0xDA, 0xAA, 0xAA, 0x7A, 0xD7, 0x70, 0xAD, 0x77, 0x0E,
+    0x77, 0x0E, 0x77, 0x0E, 0x77, 0x0F, 0xFD, 0x71, 0xFF, 0xD7, 0x1F, 0xFD, 0x71, 0xE9, 0x77, 0xE7,
+    0x70, 0xE7, 0x70, 0xE7, 0x70, 0xE7, 0x70, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x7F, 0xFF, 0xA6, 0xFF,
+    0xFC, 0x6F, 0xFF, 0xC6, 0xFF, 0xFC, 0x00, 0x77, 0x19, 0xD7, 0x69, 0xD9, 0x75, 0x9D, 0xA1, 0x9A,
+    0x72, 0x9A, 0xA0, 0xDA, 0x74, 0xF9, 0x72, 0xD1, 0xAC, 0x97, 0x0C, 0xA3, 0x9C, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x5A, 0xEA, 0x71, 0x9F, 0xE9, 0x69, 0xD9, 0x3A, 0xC6, 0xD9, 0x5D, 0x49, 0xCA, 0x6D,
+    0x4A, 0xDA, 0xAF, 0xEA, 0x3F, 0xFF, 0xA3, 0xD9, 0x99, 0x73, 0xD9, 0x75, 0xDA, 0x75, 0xEA, 0x75,
+    0xFA, 0x99, 0x99, 0xAC, 0x5A, 0xFF, 0xD6, 0x9F, 0xFC, 0x70, 0xAA, 0xF9, 0x10, 0x71, 0x9A, 0xCA,
+    0x97, 0x29, 0x19, 0xC7, 0x5A, 0xC7, 0x4A, 0xC7, 0x09, 0x39, 0x70, 0xAD, 0x73, 0x9E, 0xA7, 0x19,
+    0xCA, 0x0A, 0xCA, 0x79, 0xC9, 0x29, 0xCA, 0x69, 0x69, 0x77, 0x77, 0x49, 0xFF, 0xF2, 0xAF, 0xFE,
+    0xA2, 0xAF, 0xDA, 0xAA, 0xAA, 0x3A, 0xD7, 0x4A, 0xD7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xFF, 0xD5,
+    0xFF, 0xD5, 0xFF, 0xD5, 0xE9, 0x73, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE9, 0x99, 0x99, 0x99,
+    0x99, 0x3F, 0xFF, 0xA2, 0xFF, 0xFC, 0x2F, 0xFF, 0xC2, 0xFF, 0xFC, 0x10, 0x70, 0xAD, 0xA7, 0x19,
+    0x1A, 0xC7, 0x3C, 0xA7, 0x2C, 0xA7, 0x39, 0x79, 0xD7, 0x2E, 0x97, 0x0D, 0x9D, 0x96, 0xCA, 0x29,
+    0xC9, 0x4A, 0x95, 0xA7, 0x77, 0x77, 0x77, 0x6A, 0xEA, 0x69, 0xFE, 0x93, 0x9D, 0x93, 0xAC, 0x3D,
+    0x95, 0xD1, 0x9C, 0xA6, 0xD1, 0xAD, 0xAA, 0xFE, 0xA0, 0xFF, 0xFA, 0x0D, 0x99, 0x97, 0x0D, 0x97,
+    0x2D, 0xA7, 0x2E, 0xA7, 0x2F, 0xA9, 0x99, 0x9A, 0xC2, 0xAF, 0xFD, 0x39, 0xFF, 0xC5, 0xAA, 0xF9,
+    0x10, 0x39, 0xD9, 0x2C, 0x6C, 0xAA, 0xC2, 0xC5, 0x9C, 0x1A, 0xC0, 0xAC, 0x59, 0xC2, 0xEA, 0x69,
+    0x39, 0x97, 0x77, 0x19, 0x97, 0x39, 0xD7, 0x3F, 0x71, 0xD0, 0x9D, 0x7C, 0xA3, 0xAC, 0x59, 0x95,
+    0x99, 0x77, 0x19, 0xFF, 0xF1, 0xAF, 0xFE, 0xA1, 0xAF, 0xDA, 0xAA, 0xAA, 0x2A, 0xD7, 0x3A, 0xD7,
+    0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD4, 0xE9, 0x72, 0xE7, 0x3E, 0x73,
+    0xE7, 0x3E, 0x73, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xA1, 0xFF, 0xFC, 0x1F, 0xFF, 0xC1,
+    0xFF, 0xFC, 0x00, 0x3A, 0xCA, 0x2A, 0xA4, 0x9C, 0x9C, 0xA1, 0xAA, 0x4A, 0xC1, 0xCA, 0x0C, 0xA4,
+    0xCA, 0x19, 0xE9, 0x49, 0x49, 0x77, 0x70, 0x97, 0x3A, 0xD7, 0x1A, 0xEA, 0x7A, 0xCA, 0x0A, 0xCA,
+    0x5A, 0xC4, 0xCA, 0x49, 0x69, 0x77, 0x77, 0x2A, 0xEA, 0x69, 0xFE, 0x93, 0x9D, 0x93, 0xAC, 0x3D,
+    0x95, 0xD1, 0x9C, 0xA6, 0xD1, 0xAD, 0xAA, 0xFE, 0xA0, 0xFF, 0xFA, 0x0D, 0x99, 0x97, 0x0D, 0x97,
+    0x2D, 0xA7, 0x2E, 0xA7, 0x2F, 0xA9, 0x99, 0x9A, 0xC2, 0xAF, 0xFD, 0x39, 0xFF, 0xC5, 0xAA, 0xF9,
+    0x10, 0x69, 0x74, 0xAD, 0x72, 0x9E, 0xA7, 0x09, 0xCA, 0x0A, 0xCA, 0x69, 0xC9, 0x29, 0xCA, 0x59,
+    0x69, 0x77, 0x77, 0x19, 0xFF, 0xF1, 0xAF, 0xFE, 0xA1, 0xAF, 0xDA, 0xAA, 0xAA, 0x2A, 0xD7, 0x3A,
+    0xD7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD4, 0xE9, 0x72, 0xE7, 0x3E,
+    0x73, 0xE7, 0x3E, 0x73, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xA1, 0xFF, 0xFC, 0x1F, 0xFF,
+    0xC1, 0xFF, 0xFC, 0x77, 0x77, 0x4A, 0xD7, 0x3E, 0x97, 0x2E, 0xA7, 0x19, 0xEA, 0x40, 0x59, 0xA7,
+    0x3D, 0xA7, 0x1F, 0xA7, 0xD9, 0x0A, 0xCA, 0x5C, 0xA3, 0x9C, 0xA7, 0x77, 0x77, 0x77, 0x6A, 0xEA,
+    0x69, 0xFE, 0x93, 0x9D, 0x93, 0xAC, 0x3D, 0x95, 0xD1, 0x9C, 0xA6, 0xD1, 0xAD, 0xAA, 0xFE, 0xA0,
+    0xFF, 0xFA, 0x0D, 0x99, 0x97, 0x0D, 0x97, 0x2D, 0xA7, 0x2E, 0xA7, 0x2F, 0xA9, 0x99, 0x9A, 0xC2,
+    0xAF, 0xFD, 0x39, 0xFF, 0xC5, 0xAA, 0xF9, 0x77, 0x77, 0x77, 0x1A, 0xD7, 0x2E, 0x97, 0x1E, 0x97,
+    0x09, 0xEA, 0x30, 0x9D, 0xA9, 0x09, 0x1A, 0xC3, 0xCA, 0x2C, 0xA3, 0x97, 0x77, 0x76, 0x9E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x91, 0xE9, 0x1E, 0x91, 0xE9, 0x1E,
+    0xA1, 0xEA, 0x09, 0xEA, 0x09, 0xF0, 0x9F, 0x09, 0xF0, 0x0A, 0xDA, 0x09, 0x2C, 0x92, 0xAC, 0x29,
+    0xC3, 0x97, 0x77, 0x4C, 0xA2, 0x9C, 0xA2, 0x9C, 0xA2, 0x9C, 0xA2, 0x9C, 0xA2, 0x9C, 0xA2, 0x9C,
+    0xA2, 0xAC, 0xA2, 0xAD, 0x2A, 0xD2, 0xE2, 0xE2, 0xE2, 0xE9, 0x00, 0x49, 0xE1, 0xE1, 0xE1, 0xE1,
+    0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xEA, 0x0E, 0xA9,
+    0xEA, 0x9F, 0x9F, 0x9F, 0x72, 0xE1, 0xE0, 0x9E, 0x0A, 0xE9, 0x40, 0x0A, 0xD1, 0xE9, 0x0E, 0x99,
+    0xEA, 0x77, 0x49, 0xCA, 0x19, 0xCA, 0x19, 0xCA, 0x19, 0xCA, 0x19, 0xCA, 0x19, 0xCA, 0x19, 0xCA,
+    0x1A, 0xCA, 0x1A, 0xD1, 0xAD, 0x1E, 0x1E, 0x1E, 0x1E, 0x97, 0x2D, 0xA0, 0x9E, 0x0A, 0xE0, 0xF5,
+    0x59, 0xAF, 0xCA, 0x97, 0x09, 0xFF, 0xE6, 0xAF, 0xA9, 0x99, 0xFC, 0x93, 0x9F, 0x59, 0xF3, 0xF7,
+    0x9E, 0xA1, 0x9E, 0x71, 0xAE, 0x1E, 0xA7, 0x2E, 0x90, 0xE7, 0x3A, 0xDA, 0x0E, 0x73, 0x9D, 0xA0,
+    0xE7, 0x39, 0xE9, 0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xE7, 0x39, 0xDA, 0x0E, 0x97, 0x2E, 0xA0,
+    0xF9, 0x70, 0xAE, 0x90, 0x9F, 0xCA, 0x99, 0x99, 0x9A, 0xFC, 0x2F, 0xFF, 0xFA, 0x29, 0xFF, 0xFE,
+    0x4A, 0xFF, 0xFC, 0x95, 0xAF, 0xFE, 0x97, 0x09, 0xAF, 0xCA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x1E,
+    0x77, 0x0E, 0x77, 0x9E, 0x77, 0xAE, 0x77, 0x73, 0x39, 0xAE, 0xA6, 0xAF, 0xEA, 0x3E, 0xA9, 0x09,
+    0xAD, 0x91, 0x9D, 0x59, 0xD1, 0xDA, 0x6D, 0x90, 0xD9, 0x6D, 0xA0, 0xD9, 0x6A, 0xD0, 0xD9, 0x6A,
+    0xD0, 0xDA, 0x6D, 0xA0, 0xE9, 0x4A, 0xD9, 0x09, 0xFC, 0xAF, 0xC2, 0xFF, 0xD9, 0x3A, 0xFE, 0x95,
+    0x9F, 0xA7, 0x77, 0x77, 0x77, 0x71, 0xE7, 0x2E, 0x71, 0x9E, 0x71, 0xAE, 0x93, 0x79, 0xE9, 0x76,
+    0x91, 0x9C, 0x77, 0x1D, 0x77, 0x0C, 0xA7, 0x71, 0x97, 0x77, 0x77, 0x77, 0x77, 0x29, 0xAF, 0xCA,
+    0x97, 0x09, 0xFF, 0xE6, 0xAF, 0xA9, 0x99, 0xFC, 0x93, 0x9F, 0x59, 0xF3, 0xF7, 0x9E, 0xA1, 0x9E,
+    0x71, 0xAE, 0x1E, 0xA7, 0x2E, 0x90, 0xE7, 0x3A, 0xDA, 0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x39, 0xE9,
+    0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xE7, 0x39, 0xDA, 0x0E, 0x97, 0x2E, 0xA0, 0xF9, 0x70, 0xAE,
+    0x90, 0x9F, 0xCA, 0x99, 0x99, 0x9A, 0xFC, 0x2F, 0xFF, 0xFA, 0x29, 0xFF, 0xFE, 0x4A, 0xFF, 0xFC,
+    0x95, 0xAF, 0xFE, 0x97, 0x09, 0xAF, 0xCA, 0x97, 0x77, 0x00, 0x49, 0xDA, 0x97, 0x09, 0x1A, 0xC7,
+    0x3D, 0x72, 0xCA, 0x73, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xAE, 0xA6, 0xAF, 0xEA, 0x3E,
+    0xA9, 0x09, 0xAD, 0x91, 0x9D, 0x59, 0xD1, 0xDA, 0x6D, 0x90, 0xD9, 0x6D, 0xA0, 0xD9, 0x6A, 0xD0,
+    0xD9, 0x6A, 0xD0, 0xDA, 0x6D, 0xA0, 0xE9, 0x4A, 0xD9, 0x09, 0xFC, 0xAF, 0xC2, 0xFF, 0xD9, 0x3A,
+    0xFE, 0x95, 0x9F, 0xA3, 0x71, 0x97, 0x76, 0xD9, 0x77, 0x4A, 0xE7, 0x73, 0xAC, 0xA0, 0xD7, 0x71,
+    0xAC, 0x3A, 0xC7, 0x70, 0x96, 0x97, 0x77, 0x77, 0x09, 0xAF, 0xCA, 0x97, 0x59, 0xFF, 0xE5, 0x9C,
+    0x3A, 0xFA, 0x99, 0x9F, 0xC9, 0x3D, 0x29, 0xF5, 0x9F, 0x29, 0xCA, 0x2F, 0x79, 0xEA, 0x1D, 0x29,
+    0xE7, 0x1A, 0xE0, 0x9D, 0x2E, 0xA7, 0x2E, 0x95, 0xE7, 0x3A, 0xDA, 0x5E, 0x73, 0x9D, 0xA5, 0xE7,
+    0x39, 0xE4, 0x9D, 0xA7, 0x4E, 0x5E, 0x74, 0xDA, 0x5E, 0x73, 0x9D, 0xA5, 0xE9, 0x72, 0xEA, 0x5F,
+    0x97, 0x0A, 0xE9, 0x59, 0xFC, 0xA9, 0x99, 0x99, 0xAF, 0xC7, 0xFF, 0xFF, 0xA7, 0x9F, 0xFF, 0xE7,
+    0x1A, 0xFF, 0xFC, 0x97, 0x2A, 0xFF, 0xE9, 0x75, 0x9A, 0xFC, 0xA9, 0x77, 0x77, 0x20, 0x75, 0x9C,
+    0x95, 0xD5, 0xD5, 0xAE, 0x39, 0xCA, 0x4A, 0xCA, 0x9D, 0x2D, 0x93, 0xAC, 0x3D, 0x09, 0xD3, 0x9A,
+    0x59, 0x97, 0x77, 0x77, 0x77, 0x77, 0x49, 0xAE, 0xA7, 0x1A, 0xFE, 0xA6, 0xEA, 0x90, 0x9A, 0xD9,
+    0x49, 0xD5, 0x9D, 0x4D, 0xA6, 0xD9, 0x3D, 0x96, 0xDA, 0x3D, 0x96, 0xAD, 0x3D, 0x96, 0xAD, 0x3D,
+    0xA6, 0xDA, 0x3E, 0x94, 0xAD, 0x93, 0x9F, 0xCA, 0xFC, 0x5F, 0xFD, 0x96, 0xAF, 0xE9, 0x70, 0x9F,
+    0xA6, 0x9C, 0xA7, 0x72, 0xAD, 0x95, 0x97, 0x29, 0xDA, 0x3D, 0x97, 0x29, 0xAA, 0xA1, 0xAE, 0x77,
+    0xAC, 0xA0, 0xD7, 0x5A, 0xC3, 0xAC, 0x74, 0x96, 0x97, 0x77, 0x70, 0x9A, 0xFC, 0xA9, 0x71, 0x9F,
+    0xFE, 0x7A, 0xFA, 0x99, 0x9F, 0xC9, 0x49, 0xF5, 0x9F, 0x4F, 0x79, 0xEA, 0x29, 0xE7, 0x1A, 0xE2,
+    0xEA, 0x72, 0xE9, 0x1E, 0x73, 0xAD, 0xA1, 0xE7, 0x39, 0xDA, 0x1E, 0x73, 0x9E, 0x09, 0xDA, 0x74,
+    0xE1, 0xE7, 0x4D, 0xA1, 0xE7, 0x39, 0xDA, 0x1E, 0x97, 0x2E, 0xA1, 0xF9, 0x70, 0xAE, 0x91, 0x9F,
+    0xCA, 0x99, 0x99, 0x9A, 0xFC, 0x3F, 0xFF, 0xFA, 0x39, 0xFF, 0xFE, 0x5A, 0xFF, 0xFC, 0x96, 0xAF,
+    0xFE, 0x97, 0x19, 0xAF, 0xCA, 0x97, 0x77, 0x10, 0x09, 0x97, 0x69, 0xD9, 0x75, 0x9D, 0xA7, 0x59,
+    0xE1, 0xAC, 0x73, 0x99, 0x9D, 0xA7, 0x39, 0xFA, 0x71, 0x9C, 0xA1, 0x9C, 0xA7, 0x9C, 0x94, 0xCA,
+    0x77, 0x77, 0x77, 0x77, 0x74, 0x9A, 0xEA, 0x71, 0xAF, 0xEA, 0x6E, 0xA9, 0x09, 0xAD, 0x94, 0x9D,
+    0x59, 0xD4, 0xDA, 0x6D, 0x93, 0xD9, 0x6D, 0xA3, 0xD9, 0x6A, 0xD3, 0xD9, 0x6A, 0xD3, 0xDA, 0x6D,
+    0xA3, 0xE9, 0x4A, 0xD9, 0x39, 0xFC, 0xAF, 0xC5, 0xFF, 0xD9, 0x6A, 0xFE, 0x97, 0x09, 0xFA, 0x30,
+    0x74, 0xAD, 0xA7, 0x79, 0x1A, 0xC7, 0x71, 0xCA, 0x77, 0x0C, 0xA7, 0x39, 0xA3, 0xA7, 0x4D, 0xA7,
+    0x7F, 0x97, 0x5D, 0x90, 0xD9, 0x73, 0xAC, 0x3A, 0xC9, 0x72, 0x96, 0x97, 0x77, 0x69, 0xAF, 0xCA,
+    0x97, 0x09, 0xFF, 0xE6, 0xAF, 0xA9, 0x99, 0xFC, 0x93, 0x9F, 0x59, 0xF3, 0xF7, 0x9E, 0xA1, 0x9E,
+    0x71, 0xAE, 0x1E, 0xA7, 0x2E, 0x90, 0xE7, 0x3A, 0xDA, 0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x39, 0xE9,
+    0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xE7, 0x39, 0xDA, 0x0E, 0x97, 0x2E, 0xA0, 0xF9, 0x70, 0xAE,
+    0x90, 0x9F, 0xCA, 0x99, 0x99, 0x9A, 0xFC, 0x2F, 0xFF, 0xFA, 0x29, 0xFF, 0xFE, 0x4A, 0xFF, 0xFC,
+    0x95, 0xAF, 0xFE, 0x97, 0x09, 0xAF, 0xCA, 0x97, 0x77, 0x00, 0x70, 0xAD, 0xA7, 0x19, 0x1C, 0xA7,
+    0x3C, 0x97, 0x2C, 0x97, 0x92, 0x97, 0x9C, 0xA7, 0x19, 0xE9, 0x79, 0xD9, 0xAC, 0x95, 0x9C, 0xA2,
+    0x9C, 0x94, 0xA6, 0xA7, 0x77, 0x77, 0x77, 0x59, 0xAE, 0xA6, 0xAF, 0xEA, 0x3E, 0xA9, 0x09, 0xAD,
+    0x91, 0x9D, 0x59, 0xD1, 0xDA, 0x6D, 0x90, 0xD9, 0x6D, 0xA0, 0xD9, 0x6A, 0xD0, 0xD9, 0x6A, 0xD0,
+    0xDA, 0x6D, 0xA0, 0xE9, 0x4A, 0xD9, 0x09, 0xFC, 0xAF, 0xC2, 0xFF, 0xD9, 0x3A, 0xFE, 0x95, 0x9F,
+    0xA3, 0x6A, 0xCA, 0x2A, 0xC7, 0x29, 0xC9, 0xCA, 0x1A, 0xA7, 0x2A, 0xC1, 0xCA, 0x0C, 0xA7, 0x2C,
+    0xA1, 0x9E, 0x97, 0x29, 0x49, 0x77, 0x77, 0x49, 0x77, 0x1A, 0xD7, 0x79, 0xEA, 0x75, 0x9C, 0xA0,
+    0xAC, 0xA7, 0x39, 0xC9, 0x29, 0xCA, 0x72, 0x96, 0x97, 0x29, 0xAF, 0xCA, 0x97, 0x09, 0xFF, 0xE6,
+    0xAF, 0xA9, 0x99, 0xFC, 0x93, 0x9F, 0x59, 0xF3, 0xF7, 0x9E, 0xA1, 0x9E, 0x71, 0xAE, 0x1E, 0xA7,
+    0x2E, 0x90, 0xE7, 0x3A, 0xDA, 0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x39, 0xE9, 0xDA, 0x74, 0xE0, 0xE7,
+    0x4D, 0xA0, 0xE7, 0x39, 0xDA, 0x0E, 0x97, 0x2E, 0xA0, 0xF9, 0x70, 0xAE, 0x90, 0x9F, 0xCA, 0x99,
+    0x99, 0x9A, 0xFC, 0x2F, 0xFF, 0xFA, 0x29, 0xFF, 0xFE, 0x4A, 0xFF, 0xFC, 0x95, 0xAF, 0xFE, 0x97,
+    0x09, 0xAF, 0xCA, 0x97, 0x77, 0x00, 0x77, 0x1E, 0x2A, 0xA4, 0xAC, 0x0A, 0xC1, 0xAA, 0x4C, 0xA1,
+    0xDA, 0xC9, 0x4C, 0xA2, 0xAC, 0xA7, 0x77, 0x74, 0x9C, 0x97, 0x2E, 0x71, 0xDA, 0xD7, 0xD1, 0x9D,
+    0x5C, 0xA4, 0xAC, 0x77, 0x77, 0x77, 0x9A, 0xEA, 0x6A, 0xFE, 0xA3, 0xEA, 0x90, 0x9A, 0xD9, 0x19,
+    0xD5, 0x9D, 0x1D, 0xA6, 0xD9, 0x0D, 0x96, 0xDA, 0x0D, 0x96, 0xAD, 0x0D, 0x96, 0xAD, 0x0D, 0xA6,
+    0xDA, 0x0E, 0x94, 0xAD, 0x90, 0x9F, 0xCA, 0xFC, 0x2F, 0xFD, 0x93, 0xAF, 0xE9, 0x59, 0xFA, 0x30,
+    0x71, 0x97, 0x71, 0xD9, 0x77, 0xAE, 0x76, 0xAC, 0xA0, 0xD7, 0x4A, 0xC3, 0xAC, 0x73, 0x96, 0x97,
+    0x77, 0x69, 0xAF, 0xCA, 0x97, 0x09, 0xFF, 0xE6, 0xAF, 0xA9, 0x99, 0xFC, 0x93, 0x9F, 0x59, 0xF3,
+    0xF7, 0x9E, 0xA1, 0x9E, 0x71, 0xAE, 0x1E, 0xA7, 0x2E, 0x90, 0xE7, 0x3A, 0xDA, 0x0E, 0x73, 0x9D,
+    0xA0, 0xE7, 0x39, 0xE9, 0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xE7, 0x39, 0xDA, 0x0E, 0x97, 0x2E,
+    0xA0, 0xF9, 0x70, 0xAE, 0x90, 0x9F, 0xCA, 0x99, 0x99, 0x9A, 0xFC, 0x2F, 0xFF, 0xFA, 0x29, 0xFF,
+    0xFE, 0x4A, 0xFF, 0xFC, 0x95, 0xAF, 0xFE, 0x97, 0x09, 0xAF, 0xCA, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x1E, 0x77, 0x0E, 0x77, 0x9E, 0x77, 0xAE, 0x77, 0x73, 0x5A, 0xC7, 0x29, 0xDA, 0x70, 0x9F, 0xA6,
+    0x9C, 0xA1, 0x9C, 0xA4, 0x9C, 0x94, 0xCA, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xEA, 0x6A, 0xFE, 0xA3,
+    0xEA, 0x90, 0x9A, 0xD9, 0x19, 0xD5, 0x9D, 0x1D, 0xA6, 0xD9, 0x0D, 0x96, 0xDA, 0x0D, 0x96, 0xAD,
+    0x0D, 0x96, 0xAD, 0x0D, 0xA6, 0xDA, 0x0E, 0x94, 0xAD, 0x90, 0x9F, 0xCA, 0xFC, 0x2F, 0xFD, 0x93,
+    0xAF, 0xE9, 0x59, 0xFA, 0x77, 0x77, 0x77, 0x29, 0xD9, 0x71, 0xAD, 0xA7, 0x1E, 0xA7, 0x1F, 0x77,
+    0x20, 0x72, 0xAC, 0x77, 0x3C, 0xA7, 0x72, 0xAC, 0x97, 0x72, 0xD7, 0x72, 0xAC, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x74, 0x9C, 0x69, 0xAF, 0xCA, 0x93, 0x9C, 0x49, 0xFF, 0xE2, 0xAC, 0x3A,
+    0xFA, 0x99, 0x9F, 0xC9, 0x0C, 0xA2, 0x9F, 0x59, 0xFD, 0x3F, 0x79, 0xF3, 0x9E, 0x71, 0xAE, 0x3E,
+    0xA7, 0x2E, 0x92, 0xE7, 0x3A, 0xDA, 0x2E, 0x73, 0x9D, 0xA2, 0xE7, 0x39, 0xE1, 0x9D, 0xA7, 0x4E,
+    0x2E, 0x74, 0xDA, 0x2E, 0x73, 0x9D, 0xA2, 0xE9, 0x72, 0xEA, 0x2F, 0x97, 0x0A, 0xE9, 0x29, 0xFC,
+    0xA9, 0x99, 0x99, 0xAF, 0xC4, 0xFF, 0xFF, 0xA4, 0x9F, 0xFF, 0xE6, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF,
+    0xE9, 0x72, 0x9A, 0xFC, 0xA9, 0x77, 0x74, 0x7C, 0xA7, 0x49, 0xC9, 0x74, 0xD7, 0x49, 0xCA, 0x74,
+    0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4A, 0x49, 0xAE, 0xA9, 0x2C, 0x92, 0xAF, 0xEA, 0x1C,
+    0x2E, 0xA9, 0x09, 0xAD, 0xAA, 0xC1, 0x9D, 0x59, 0xE2, 0xDA, 0x6D, 0x92, 0xD9, 0x6D, 0xA2, 0xD9,
+    0x6A, 0xD2, 0xD9, 0x6A, 0xD2, 0xDA, 0x6D, 0xA2, 0xE9, 0x4A, 0xD9, 0x29, 0xFC, 0xAF, 0xC4, 0xFF,
+    0xD9, 0x5A, 0xFE, 0x97, 0x9F, 0xA5, 0x6A, 0x97, 0x73, 0xAD, 0x77, 0x3A, 0xD9, 0x77, 0x2A, 0xDA,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9C, 0x69, 0xAF, 0xCA, 0x93, 0x9C, 0x49, 0xFF, 0xE2, 0xAC,
+    0x3A, 0xFA, 0x99, 0x9F, 0xC9, 0x0C, 0xA2, 0x9F, 0x59, 0xFD, 0x3F, 0x79, 0xF3, 0x9E, 0x71, 0xAE,
+    0x3E, 0xA7, 0x2E, 0x92, 0xE7, 0x3A, 0xDA, 0x2E, 0x73, 0x9D, 0xA2, 0xE7, 0x39, 0xE1, 0x9D, 0xA7,
+    0x4E, 0x2E, 0x74, 0xDA, 0x2E, 0x73, 0x9D, 0xA2, 0xE9, 0x72, 0xEA, 0x2F, 0x97, 0x0A, 0xE9, 0x29,
+    0xFC, 0xA9, 0x99, 0x99, 0xAF, 0xC4, 0xFF, 0xFF, 0xA4, 0x9F, 0xFF, 0xE6, 0xAF, 0xFF, 0xC9, 0x7A,
+    0xFF, 0xE9, 0x72, 0x9A, 0xFC, 0xA9, 0x77, 0x74, 0x29, 0xCA, 0x75, 0xAD, 0x97, 0x4A, 0xDA, 0x74,
+    0x9A, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3A, 0x49, 0xAE, 0xA9, 0x2C, 0x92, 0xAF, 0xEA, 0x1C,
+    0x2E, 0xA9, 0x09, 0xAD, 0xAA, 0xC1, 0x9D, 0x59, 0xE2, 0xDA, 0x6D, 0x92, 0xD9, 0x6D, 0xA2, 0xD9,
+    0x6A, 0xD2, 0xD9, 0x6A, 0xD2, 0xDA, 0x6D, 0xA2, 0xE9, 0x4A, 0xD9, 0x29, 0xFC, 0xAF, 0xC4, 0xFF,
+    0xD9, 0x5A, 0xFE, 0x97, 0x9F, 0xA5, 0x79, 0xEA, 0x77, 0x4C, 0x97, 0x72, 0xAC, 0x77, 0x2A, 0xA7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9C, 0x69, 0xAF, 0xCA, 0x93, 0x9C, 0x49, 0xFF, 0xE2,
+    0xAC, 0x3A, 0xFA, 0x99, 0x9F, 0xC9, 0x0C, 0xA2, 0x9F, 0x59, 0xFD, 0x3F, 0x79, 0xF3, 0x9E, 0x71,
+    0xAE, 0x3E, 0xA7, 0x2E, 0x92, 0xE7, 0x3A, 0xDA, 0x2E, 0x73, 0x9D, 0xA2, 0xE7, 0x39, 0xE1, 0x9D,
+    0xA7, 0x4E, 0x2E, 0x74, 0xDA, 0x2E, 0x73, 0x9D, 0xA2, 0xE9, 0x72, 0xEA, 0x2F, 0x97, 0x0A, 0xE9,
+    0x29, 0xFC, 0xA9, 0x99, 0x99, 0xAF, 0xC4, 0xFF, 0xFF, 0xA4, 0x9F, 0xFF, 0xE6, 0xAF, 0xFF, 0xC9,
+    0x7A, 0xFF, 0xE9, 0x72, 0x9A, 0xFC, 0xA9, 0x77, 0x74, 0x49, 0xDA, 0x97, 0x29, 0x1A, 0xC7, 0x5D,
+    0x74, 0xCA, 0x75, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xC9, 0x39, 0xAE, 0xA9, 0x2C, 0x92,
+    0xAF, 0xEA, 0x1C, 0x2E, 0xA9, 0x09, 0xAD, 0xAA, 0xC1, 0x9D, 0x59, 0xE2, 0xDA, 0x6D, 0x92, 0xD9,
+    0x6D, 0xA2, 0xD9, 0x6A, 0xD2, 0xD9, 0x6A, 0xD2, 0xDA, 0x6D, 0xA2, 0xE9, 0x4A, 0xD9, 0x29, 0xFC,
+    0xAF, 0xC4, 0xFF, 0xD9, 0x5A, 0xFE, 0x97, 0x9F, 0xA5, 0x6A, 0xCA, 0x29, 0xC7, 0x49, 0xCA, 0xAC,
+    0x19, 0xC7, 0x4A, 0xC1, 0xCA, 0x0A, 0xA7, 0x4A, 0xC2, 0xE9, 0x74, 0x94, 0x99, 0x77, 0x77, 0x77,
+    0x77, 0x69, 0xC6, 0x9A, 0xFC, 0xA9, 0x39, 0xC4, 0x9F, 0xFE, 0x2A, 0xC3, 0xAF, 0xA9, 0x99, 0xFC,
+    0x90, 0xCA, 0x29, 0xF5, 0x9F, 0xD3, 0xF7, 0x9F, 0x39, 0xE7, 0x1A, 0xE3, 0xEA, 0x72, 0xE9, 0x2E,
+    0x73, 0xAD, 0xA2, 0xE7, 0x39, 0xDA, 0x2E, 0x73, 0x9E, 0x19, 0xDA, 0x74, 0xE2, 0xE7, 0x4D, 0xA2,
+    0xE7, 0x39, 0xDA, 0x2E, 0x97, 0x2E, 0xA2, 0xF9, 0x70, 0xAE, 0x92, 0x9F, 0xCA, 0x99, 0x99, 0x9A,
+    0xFC, 0x4F, 0xFF, 0xFA, 0x49, 0xFF, 0xFE, 0x6A, 0xFF, 0xFC, 0x97, 0xAF, 0xFE, 0x97, 0x29, 0xAF,
+    0xCA, 0x97, 0x77, 0x40, 0x77, 0x29, 0xE2, 0xAA, 0x6A, 0xC0, 0xAC, 0x1C, 0xA6, 0xCA, 0x1D, 0xAC,
+    0x96, 0xCA, 0x2D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x72, 0xA4, 0x9A, 0xEA, 0x92, 0xC9, 0x2A, 0xFE,
+    0xA1, 0xC2, 0xEA, 0x90, 0x9A, 0xDA, 0xAC, 0x19, 0xD5, 0x9E, 0x2D, 0xA6, 0xD9, 0x2D, 0x96, 0xDA,
+    0x2D, 0x96, 0xAD, 0x2D, 0x96, 0xAD, 0x2D, 0xA6, 0xDA, 0x2E, 0x94, 0xAD, 0x92, 0x9F, 0xCA, 0xFC,
+    0x4F, 0xFD, 0x95, 0xAF, 0xE9, 0x79, 0xFA, 0x50, 0x77, 0x77, 0x70, 0x9C, 0x69, 0xAF, 0xCA, 0x93,
+    0x9C, 0x49, 0xFF, 0xE2, 0xAC, 0x3A, 0xFA, 0x99, 0x9F, 0xC9, 0x0C, 0xA2, 0x9F, 0x59, 0xFD, 0x3F,
+    0x79, 0xF3, 0x9E, 0x71, 0xAE, 0x3E, 0xA7, 0x2E, 0x92, 0xE7, 0x3A, 0xDA, 0x2E, 0x73, 0x9D, 0xA2,
+    0xE7, 0x39, 0xE1, 0x9D, 0xA7, 0x4E, 0x2E, 0x74, 0xDA, 0x2E, 0x73, 0x9D, 0xA2, 0xE9, 0x72, 0xEA,
+    0x2F, 0x97, 0x0A, 0xE9, 0x29, 0xFC, 0xA9, 0x99, 0x99, 0xAF, 0xC4, 0xFF, 0xFF, 0xA4, 0x9F, 0xFF,
+    0xE6, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xE9, 0x72, 0x9A, 0xFC, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x1E, 0x77, 0x2E, 0x77, 0x19, 0xE7, 0x71, 0xAE, 0x77, 0x77, 0x75, 0xA4, 0x9A, 0xEA, 0x92, 0xC9,
+    0x2A, 0xFE, 0xA1, 0xC2, 0xEA, 0x90, 0x9A, 0xDA, 0xAC, 0x19, 0xD5, 0x9E, 0x2D, 0xA6, 0xD9, 0x2D,
+    0x96, 0xDA, 0x2D, 0x96, 0xAD, 0x2D, 0x96, 0xAD, 0x2D, 0xA6, 0xDA, 0x2E, 0x94, 0xAD, 0x92, 0x9F,
+    0xCA, 0xFC, 0x4F, 0xFD, 0x95, 0xAF, 0xE9, 0x79, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x73, 0xE7, 0x4E,
+    0x73, 0x9E, 0x73, 0xAE, 0x95, 0x09, 0x99, 0x71, 0x99, 0x91, 0xF7, 0xAE, 0xA0, 0xEA, 0x7A, 0xEA,
+    0x0E, 0xA7, 0xAE, 0x90, 0xEA, 0x7A, 0xE9, 0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x79, 0xE9, 0x0E, 0xA7,
+    0x9E, 0x90, 0xEA, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79, 0xE1, 0xE9, 0x79,
+    0xE1, 0xE9, 0x79, 0xE1, 0xEA, 0x79, 0xE1, 0xAE, 0x7A, 0xE1, 0xAE, 0xA5, 0x9F, 0x19, 0xFC, 0xAA,
+    0xAA, 0xFC, 0xA1, 0x9F, 0xFF, 0xD9, 0x2F, 0xFF, 0xD3, 0x9F, 0xFF, 0x95, 0xAF, 0xFA, 0x97, 0x77,
+    0x77, 0x77, 0x79, 0xD9, 0x75, 0xAD, 0xA7, 0x5F, 0x75, 0xF6, 0x0D, 0x95, 0xDA, 0x1D, 0x95, 0xDA,
+    0x1D, 0x95, 0xDA, 0x1D, 0x95, 0xE1, 0xDA, 0x5E, 0x1D, 0xA5, 0xE1, 0xDA, 0x5E, 0x1A, 0xD5, 0xE1,
+    0xAD, 0x5E, 0x1A, 0xD9, 0x3F, 0x19, 0xFF, 0xE2, 0xFF, 0xE2, 0xFF, 0xAD, 0x3F, 0xD9, 0xAD, 0x59,
+    0x99, 0x77, 0x70, 0xAD, 0x72, 0xE9, 0x71, 0xE9, 0x70, 0x9E, 0xA7, 0x72, 0x6A, 0xDA, 0x75, 0x91,
+    0xAC, 0x77, 0xCA, 0x76, 0xCA, 0x77, 0x97, 0x77, 0x77, 0x77, 0x77, 0x70, 0x99, 0x97, 0x19, 0x99,
+    0x1F, 0x7A, 0xEA, 0x0E, 0xA7, 0xAE, 0xA0, 0xEA, 0x7A, 0xE9, 0x0E, 0xA7, 0xAE, 0x90, 0xEA, 0x79,
+    0xE9, 0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x79, 0xE9, 0x0E, 0xA7, 0x9E, 0x1E, 0x97, 0x9E, 0x1E, 0x97,
+    0x9E, 0x1E, 0x97, 0x9E, 0x1E, 0x97, 0x9E, 0x1E, 0x97, 0x9E, 0x1E, 0xA7, 0x9E, 0x1A, 0xE7, 0xAE,
+    0x1A, 0xEA, 0x59, 0xF1, 0x9F, 0xCA, 0xAA, 0xAF, 0xCA, 0x19, 0xFF, 0xFD, 0x92, 0xFF, 0xFD, 0x39,
+    0xFF, 0xF9, 0x5A, 0xFF, 0xA9, 0x77, 0x40, 0x39, 0xAC, 0xA9, 0x70, 0x91, 0x9C, 0x97, 0x2A, 0xC7,
+    0x2A, 0xC7, 0x39, 0x77, 0x77, 0x77, 0x77, 0xD9, 0x5D, 0xA1, 0xD9, 0x5D, 0xA1, 0xD9, 0x5D, 0xA1,
+    0xD9, 0x5E, 0x1D, 0xA5, 0xE1, 0xDA, 0x5E, 0x1D, 0xA5, 0xE1, 0xAD, 0x5E, 0x1A, 0xD5, 0xE1, 0xAD,
+    0x93, 0xF1, 0x9F, 0xFE, 0x2F, 0xFE, 0x2F, 0xFA, 0xD3, 0xFD, 0x9A, 0xD5, 0x99, 0x95, 0x71, 0xCA,
+    0x77, 0x0A, 0xC9, 0x77, 0x0D, 0x77, 0x0A, 0xCA, 0x77, 0x0D, 0x97, 0x77, 0x77, 0x77, 0x72, 0xA9,
+    0x77, 0x1C, 0xA7, 0x71, 0xCA, 0x9F, 0x7A, 0xFC, 0x90, 0xF7, 0xAF, 0xA1, 0xEA, 0x7A, 0xE9, 0x2E,
+    0xA7, 0xAE, 0x92, 0xEA, 0x79, 0xE9, 0x2E, 0xA7, 0x9E, 0x92, 0xEA, 0x79, 0xE9, 0x2E, 0xA7, 0x9E,
+    0x3E, 0x97, 0x9E, 0x3E, 0x97, 0x9E, 0x3E, 0x97, 0x9E, 0x3E, 0x97, 0x9E, 0x3E, 0x97, 0x9E, 0x3E,
+    0xA7, 0x9E, 0x3A, 0xE7, 0xAE, 0x3A, 0xEA, 0x59, 0xF3, 0x9F, 0xCA, 0xAA, 0xAF, 0xCA, 0x39, 0xFF,
+    0xFD, 0x94, 0xFF, 0xFD, 0x59, 0xFF, 0xF9, 0x7A, 0xFF, 0xA9, 0x77, 0x70, 0x6A, 0xC7, 0x5C, 0xA7,
+    0x4A, 0xC9, 0x74, 0xD7, 0x4A, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x5C, 0x1D, 0x95, 0xDA, 0x0C, 0x1D,
+    0x95, 0xDA, 0xAC, 0x1D, 0x95, 0xF9, 0x1D, 0x95, 0xE3, 0xDA, 0x5E, 0x3D, 0xA5, 0xE3, 0xDA, 0x5E,
+    0x3A, 0xD5, 0xE3, 0xAD, 0x5E, 0x3A, 0xD9, 0x3F, 0x39, 0xFF, 0xE4, 0xFF, 0xE4, 0xFF, 0xAD, 0x5F,
+    0xD9, 0xAD, 0x79, 0x99, 0x70, 0x4A, 0xCA, 0x77, 0x1E, 0x77, 0x1A, 0xD9, 0x77, 0x0A, 0xAC, 0xA7,
+    0x77, 0x77, 0x5A, 0x97, 0x71, 0xCA, 0x77, 0x1C, 0xA9, 0xF7, 0xAF, 0xC9, 0x0F, 0x7A, 0xFA, 0x1E,
+    0xA7, 0xAE, 0x92, 0xEA, 0x7A, 0xE9, 0x2E, 0xA7, 0x9E, 0x92, 0xEA, 0x79, 0xE9, 0x2E, 0xA7, 0x9E,
+    0x92, 0xEA, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xE9, 0x79, 0xE3,
+    0xE9, 0x79, 0xE3, 0xEA, 0x79, 0xE3, 0xAE, 0x7A, 0xE3, 0xAE, 0xA5, 0x9F, 0x39, 0xFC, 0xAA, 0xAA,
+    0xFC, 0xA3, 0x9F, 0xFF, 0xD9, 0x4F, 0xFF, 0xD5, 0x9F, 0xFF, 0x97, 0xAF, 0xFA, 0x97, 0x77, 0x00,
+    0x77, 0x2D, 0x97, 0x5D, 0xA7, 0x5E, 0x75, 0x9A, 0xA7, 0x77, 0x74, 0x97, 0x6C, 0x1D, 0x95, 0xDA,
+    0x0C, 0x1D, 0x95, 0xDA, 0xAC, 0x1D, 0x95, 0xF9, 0x1D, 0x95, 0xE3, 0xDA, 0x5E, 0x3D, 0xA5, 0xE3,
+    0xDA, 0x5E, 0x3A, 0xD5, 0xE3, 0xAD, 0x5E, 0x3A, 0xD9, 0x3F, 0x39, 0xFF, 0xE4, 0xFF, 0xE4, 0xFF,
+    0xAD, 0x5F, 0xD9, 0xAD, 0x79, 0x99, 0x70, 0x6A, 0xDA, 0x77, 0x91, 0xAC, 0x77, 0x1C, 0xA7, 0x70,
+    0xCA, 0x77, 0x1A, 0x77, 0x77, 0x77, 0x77, 0x3C, 0x97, 0x71, 0xCA, 0x77, 0x1C, 0xA9, 0xF7, 0xAF,
+    0xC9, 0x0F, 0x7A, 0xFA, 0x1E, 0xA7, 0xAE, 0x92, 0xEA, 0x7A, 0xE9, 0x2E, 0xA7, 0x9E, 0x92, 0xEA,
+    0x79, 0xE9, 0x2E, 0xA7, 0x9E, 0x92, 0xEA, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xE9,
+    0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xEA, 0x79, 0xE3, 0xAE, 0x7A, 0xE3, 0xAE, 0xA5,
+    0x9F, 0x39, 0xFC, 0xAA, 0xAA, 0xFC, 0xA3, 0x9F, 0xFF, 0xD9, 0x4F, 0xFF, 0xD5, 0x9F, 0xFF, 0x97,
+    0xAF, 0xFA, 0x97, 0x77, 0x00, 0x39, 0xAC, 0xA9, 0x72, 0x91, 0x9C, 0x97, 0x4A, 0xC7, 0x4A, 0xC7,
+    0x59, 0x77, 0x77, 0x77, 0x69, 0x76, 0xC1, 0xD9, 0x5D, 0xA0, 0xC1, 0xD9, 0x5D, 0xAA, 0xC1, 0xD9,
+    0x5F, 0x91, 0xD9, 0x5E, 0x3D, 0xA5, 0xE3, 0xDA, 0x5E, 0x3D, 0xA5, 0xE3, 0xAD, 0x5E, 0x3A, 0xD5,
+    0xE3, 0xAD, 0x93, 0xF3, 0x9F, 0xFE, 0x4F, 0xFE, 0x4F, 0xFA, 0xD5, 0xFD, 0x9A, 0xD7, 0x99, 0x97,
+    0x77, 0x70, 0x9E, 0x2C, 0x97, 0x2C, 0xA0, 0xAC, 0x1C, 0x97, 0x2C, 0x91, 0xF7, 0x3A, 0x92, 0x99,
+    0x77, 0x71, 0x97, 0x72, 0xC9, 0x77, 0x1C, 0xA7, 0x71, 0xCA, 0x9F, 0x7A, 0xFC, 0x90, 0xF7, 0xAF,
+    0xA1, 0xEA, 0x7A, 0xE9, 0x2E, 0xA7, 0xAE, 0x92, 0xEA, 0x79, 0xE9, 0x2E, 0xA7, 0x9E, 0x92, 0xEA,
+    0x79, 0xE9, 0x2E, 0xA7, 0x9E, 0x3E, 0x97, 0x9E, 0x3E, 0x97, 0x9E, 0x3E, 0x97, 0x9E, 0x3E, 0x97,
+    0x9E, 0x3E, 0x97, 0x9E, 0x3E, 0xA7, 0x9E, 0x3A, 0xE7, 0xAE, 0x3A, 0xEA, 0x59, 0xF3, 0x9F, 0xCA,
+    0xAA, 0xAF, 0xCA, 0x39, 0xFF, 0xFD, 0x94, 0xFF, 0xFD, 0x59, 0xFF, 0xF9, 0x7A, 0xFF, 0xA9, 0x77,
+    0x70, 0x77, 0x2E, 0xA1, 0x9C, 0x69, 0xC0, 0x9C, 0xA0, 0xAC, 0x6A, 0xC1, 0x9E, 0x96, 0x9A, 0x39,
+    0x97, 0x77, 0x73, 0x97, 0x6C, 0x1D, 0x95, 0xDA, 0x0C, 0x1D, 0x95, 0xDA, 0xAC, 0x1D, 0x95, 0xF9,
+    0x1D, 0x95, 0xE3, 0xDA, 0x5E, 0x3D, 0xA5, 0xE3, 0xDA, 0x5E, 0x3A, 0xD5, 0xE3, 0xAD, 0x5E, 0x3A,
+    0xD9, 0x3F, 0x39, 0xFF, 0xE4, 0xFF, 0xE4, 0xFF, 0xAD, 0x5F, 0xD9, 0xAD, 0x79, 0x99, 0x70, 0x77,
+    0x77, 0x5A, 0x97, 0x71, 0xCA, 0x77, 0x1C, 0xA9, 0xF7, 0xAF, 0xC9, 0x0F, 0x7A, 0xFA, 0x1E, 0xA7,
+    0xAE, 0x92, 0xEA, 0x7A, 0xE9, 0x2E, 0xA7, 0x9E, 0x92, 0xEA, 0x79, 0xE9, 0x2E, 0xA7, 0x9E, 0x92,
+    0xEA, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xE9, 0x79, 0xE3, 0xE9,
+    0x79, 0xE3, 0xEA, 0x79, 0xE3, 0xAE, 0x7A, 0xE3, 0xAE, 0xA5, 0x9F, 0x39, 0xFC, 0xAA, 0xAA, 0xFC,
+    0xA3, 0x9F, 0xFF, 0xD9, 0x4F, 0xFF, 0xD5, 0x9F, 0xFF, 0x97, 0xAF, 0xFA, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x9D, 0x97, 0x7A, 0xDA, 0x77, 0xF7, 0x7F, 0x70, 0x75, 0x97, 0x6C, 0x1D, 0x95, 0xDA, 0x0C,
+    0x1D, 0x95, 0xDA, 0xAC, 0x1D, 0x95, 0xF9, 0x1D, 0x95, 0xE3, 0xDA, 0x5E, 0x3D, 0xA5, 0xE3, 0xDA,
+    0x5E, 0x3A, 0xD5, 0xE3, 0xAD, 0x5E, 0x3A, 0xD9, 0x3F, 0x39, 0xFF, 0xE4, 0xFF, 0xE4, 0xFF, 0xAD,
+    0x5F, 0xD9, 0xAD, 0x79, 0x99, 0x77, 0x74, 0xAD, 0x74, 0xE9, 0x73, 0xE9, 0x72, 0x9E, 0xA7, 0x76,
+    0x49, 0x97, 0x7A, 0xD7, 0x7A, 0xD9, 0x76, 0xAD, 0xA7, 0x70, 0x97, 0x77, 0x77, 0x77, 0x5E, 0x71,
+    0xAD, 0xA0, 0xAD, 0xA7, 0x0E, 0x2E, 0x7A, 0xDA, 0x2A, 0xE6, 0xE4, 0xE9, 0x4E, 0xA4, 0xAE, 0x39,
+    0xE6, 0xE9, 0x2E, 0xA6, 0xAE, 0x1A, 0xE7, 0x0E, 0xA0, 0xEA, 0x70, 0xAF, 0xE7, 0x2F, 0xDA, 0x72,
+    0xAF, 0xC7, 0x4F, 0xA7, 0x4F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4F, 0xC7,
+    0x4F, 0xC6, 0x29, 0x97, 0x49, 0xD9, 0x74, 0xDA, 0x74, 0xE7, 0x69, 0x77, 0x77, 0x77, 0x77, 0x1D,
+    0x96, 0x9D, 0x19, 0xD6, 0xAD, 0x2D, 0xA5, 0xDA, 0x29, 0xD9, 0x39, 0xD9, 0x3E, 0x3A, 0xD4, 0x9D,
+    0x92, 0xE5, 0xE1, 0x9D, 0xA5, 0x9D, 0xA0, 0xAD, 0x96, 0xE9, 0xE7, 0x9F, 0xD7, 0x0F, 0xCA, 0x70,
+    0x9F, 0x97, 0x1F, 0x72, 0xF7, 0x2E, 0xA7, 0x1A, 0xE9, 0x79, 0xFC, 0x59, 0xFE, 0x69, 0xFD, 0x79,
+    0xF9, 0x77, 0x60, 0x0E, 0x71, 0xAD, 0xA0, 0xAD, 0xA7, 0x0E, 0x2E, 0x7A, 0xDA, 0x2A, 0xE6, 0xE4,
+    0xE9, 0x4E, 0xA4, 0xAE, 0x39, 0xE6, 0xE9, 0x2E, 0xA6, 0xAE, 0x1A, 0xE7, 0x0E, 0xA0, 0xEA, 0x70,
+    0xAF, 0xE7, 0x2F, 0xDA, 0x72, 0xAF, 0xC7, 0x4F, 0xA7, 0x4F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x49,
+    0xF7, 0x4A, 0xF7, 0x4F, 0xC7, 0x4F, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3E,
+    0x76, 0xE7, 0x59, 0xE9, 0x74, 0xAE, 0x96, 0x0D, 0x96, 0x9D, 0x49, 0xD6, 0xAD, 0x5D, 0xA5, 0xDA,
+    0x59, 0xD9, 0x39, 0xD9, 0x6E, 0x3A, 0xD7, 0x9D, 0x92, 0xE7, 0x0E, 0x19, 0xDA, 0x70, 0x9D, 0xA0,
+    0xAD, 0x97, 0x1E, 0x9E, 0x72, 0x9F, 0xD7, 0x3F, 0xCA, 0x73, 0x9F, 0x97, 0x4F, 0x75, 0xF7, 0x5E,
+    0xA7, 0x4A, 0xE9, 0x72, 0x9F, 0xC7, 0x09, 0xFE, 0x4D, 0xA1, 0x9F, 0xD4, 0x9E, 0x19, 0xF9, 0x5A,
+    0xE7, 0x5F, 0x77, 0x20, 0x6A, 0xDA, 0x97, 0x49, 0x1A, 0xC7, 0x7C, 0xA7, 0x6C, 0xA7, 0x79, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x2E, 0x71, 0xAD, 0xA0, 0xAD, 0xA7, 0x0E, 0x2E, 0x7A, 0xDA, 0x2A,
+    0xE6, 0xE4, 0xE9, 0x4E, 0xA4, 0xAE, 0x39, 0xE6, 0xE9, 0x2E, 0xA6, 0xAE, 0x1A, 0xE7, 0x0E, 0xA0,
+    0xEA, 0x70, 0xAF, 0xE7, 0x2F, 0xDA, 0x72, 0xAF, 0xC7, 0x4F, 0xA7, 0x4F, 0x75, 0xF7, 0x5F, 0x75,
+    0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4F, 0xC7, 0x4F, 0xC6, 0x5A, 0xDA, 0x71, 0x92, 0xC9, 0x73, 0xAC,
+    0x73, 0xAC, 0x74, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xD9, 0x69, 0xD1, 0x9D, 0x6A, 0xD2,
+    0xDA, 0x5D, 0xA2, 0x9D, 0x93, 0x9D, 0x93, 0xE3, 0xAD, 0x49, 0xD9, 0x2E, 0x5E, 0x19, 0xDA, 0x59,
+    0xDA, 0x0A, 0xD9, 0x6E, 0x9E, 0x79, 0xFD, 0x70, 0xFC, 0xA7, 0x09, 0xF9, 0x71, 0xF7, 0x2F, 0x72,
+    0xEA, 0x71, 0xAE, 0x97, 0x9F, 0xC5, 0x9F, 0xE6, 0x9F, 0xD7, 0x9F, 0x97, 0x76, 0x5D, 0xA2, 0xCA,
+    0x70, 0xAC, 0x9C, 0xA1, 0xC9, 0x70, 0xCA, 0x09, 0xC9, 0x0C, 0x97, 0x0C, 0x91, 0xAE, 0x71, 0x94,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x6E, 0x71, 0xAD, 0xA0, 0xAD, 0xA7, 0x0E, 0x2E, 0x7A, 0xDA, 0x2A,
+    0xE6, 0xE4, 0xE9, 0x4E, 0xA4, 0xAE, 0x39, 0xE6, 0xE9, 0x2E, 0xA6, 0xAE, 0x1A, 0xE7, 0x0E, 0xA0,
+    0xEA, 0x70, 0xAF, 0xE7, 0x2F, 0xDA, 0x72, 0xAF, 0xC7, 0x4F, 0xA7, 0x4F, 0x75, 0xF7, 0x5F, 0x75,
+    0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4F, 0xC7, 0x4F, 0xC6, 0x3A, 0xD2, 0x9C, 0x6C, 0xAA, 0xC1, 0x9C,
+    0x59, 0xC1, 0xCA, 0x0A, 0xC5, 0xAC, 0x2E, 0xA5, 0x99, 0x39, 0x97, 0x77, 0x77, 0x77, 0x77, 0x7D,
+    0x96, 0x9D, 0x19, 0xD6, 0xAD, 0x2D, 0xA5, 0xDA, 0x29, 0xD9, 0x39, 0xD9, 0x3E, 0x3A, 0xD4, 0x9D,
+    0x92, 0xE5, 0xE1, 0x9D, 0xA5, 0x9D, 0xA0, 0xAD, 0x96, 0xE9, 0xE7, 0x9F, 0xD7, 0x0F, 0xCA, 0x70,
+    0x9F, 0x97, 0x1F, 0x72, 0xF7, 0x2E, 0xA7, 0x1A, 0xE9, 0x79, 0xFC, 0x59, 0xFE, 0x69, 0xFD, 0x79,
+    0xF9, 0x77, 0x60, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x0A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x0F, 0xFF, 0xFA, 0x0F, 0xFF, 0xFA, 0x19, 0x99, 0x99, 0x99, 0x99, 0x95, 0xFF, 0xFF,
+    0x0F, 0xFF, 0xEA, 0x77, 0x00, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x0F, 0xFF,
+    0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x77, 0x72, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97,
+    0x0F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x77, 0x72, 0x73, 0x9C, 0x94, 0xCA, 0x09, 0xC9, 0x4C,
+    0xA0, 0x9C, 0x94, 0xCA, 0x09, 0xC9, 0x39, 0xC9, 0x0A, 0xC4, 0x9C, 0x90, 0xAC, 0x49, 0xC9, 0x0A,
+    0xC4, 0x9C, 0x90, 0xAC, 0x49, 0xC9, 0x0A, 0xC4, 0x9C, 0x90, 0xAC, 0x49, 0xC9, 0x0A, 0xC4, 0x9C,
+    0x90, 0xAC, 0x49, 0xC9, 0x0D, 0x4A, 0xC1, 0xD4, 0xAC, 0x1D, 0x4A, 0xC1, 0xD4, 0xAC, 0x1D, 0x4A,
+    0xC1, 0xD4, 0xAC, 0x1D, 0x4A, 0xC1, 0xD4, 0xAC, 0x1C, 0xA4, 0xD0, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0xA7, 0x77, 0x76, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xCA, 0xAE, 0xA0,
+    0x9E, 0xA1, 0xF1, 0xF1, 0xAE, 0x2E, 0x91, 0xF0, 0x09, 0xF0, 0x9E, 0xA0, 0xAE, 0x90, 0xAE, 0x1E,
+    0xA1, 0xE9, 0x0A, 0xE1, 0x19, 0x99, 0x90, 0x9E, 0xA0, 0xAE, 0x90, 0xAE, 0x1A, 0xE1, 0xEA, 0x09,
+    0xE9, 0x0A, 0xE1, 0xAE, 0xA0, 0x9E, 0xA1, 0xF1, 0xF1, 0xAE, 0x2E, 0x91, 0xF0, 0xAE, 0xA0, 0xF9,
+    0x09, 0xEA, 0x09, 0xEA, 0x1F, 0x1E, 0xA1, 0xF1, 0xEA, 0x1A, 0xE1, 0xAE, 0x2E, 0x90, 0x9E, 0x91,
+    0xF1, 0xEA, 0x09, 0xF0, 0x9F, 0x09, 0xEA, 0x0A, 0xE9, 0x0A, 0xE9, 0x0A, 0xE1, 0xAE, 0x1A, 0xE1,
+    0xEA, 0x1E, 0xA1, 0xE9, 0x09, 0xE9, 0x0A, 0xE1, 0xAE, 0x10, 0x19, 0x99, 0x90, 0x9E, 0xA0, 0xAE,
+    0x90, 0xAE, 0x1A, 0xE1, 0xEA, 0x09, 0xE9, 0x0A, 0xE1, 0x9F, 0x0A, 0xEA, 0x2F, 0x1F, 0x2F, 0x1F,
+    0x2A, 0xE1, 0xAE, 0x29, 0xE9, 0x09, 0xE3, 0xEA, 0x1E, 0xA2, 0xF1, 0xF7, 0x50, 0x77, 0x29, 0xCA,
+    0x72, 0x9C, 0xA7, 0x29, 0xCA, 0x72, 0x9C, 0xA7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7,
+    0x29, 0xD7, 0x3D, 0x69, 0xFF, 0xE1, 0xAF, 0xFE, 0x95, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7,
+    0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D,
+    0x73, 0xD7, 0x4C, 0x74, 0xA7, 0x73, 0x77, 0x1D, 0x72, 0xD7, 0x2D, 0x72, 0xD7, 0x2D, 0x72, 0xD7,
+    0x2D, 0x72, 0xD7, 0x2D, 0x72, 0xD6, 0xFF, 0xE0, 0x9F, 0xFE, 0xA4, 0xD7, 0x2D, 0x72, 0xD7, 0x2D,
+    0x72, 0xD7, 0x2D, 0x72, 0xD7, 0x2D, 0x6A, 0xFF, 0xC2, 0xFF, 0xD6, 0xD9, 0x71, 0xD9, 0x71, 0xD9,
+    0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xAC, 0x97, 0x2C, 0x97, 0x29, 0x97, 0x71, 0x77, 0x1A,
+    0xFF, 0xA4, 0xFF, 0xD4, 0xFF, 0xD3, 0x9F, 0xFD, 0x3A, 0xFF, 0xD3, 0xFF, 0xE9, 0x2F, 0xFE, 0xA2,
+    0xFF, 0xEA, 0x19, 0xFF, 0xF1, 0xAF, 0xFF, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x99, 0xFF, 0xFC, 0x99,
+    0xFF, 0xFC, 0xA0, 0x7A, 0xA4, 0xE9, 0x2F, 0xC9, 0x0F, 0xC9, 0x0E, 0xA2, 0xCA, 0x72, 0x5E, 0x1E,
+    0x09, 0xE0, 0xAE, 0x90, 0x5E, 0x1E, 0x09, 0xE0, 0xAE, 0x90, 0x77, 0x6E, 0x5D, 0xA4, 0xE1, 0xE4,
+    0x9E, 0x4E, 0x09, 0xE4, 0xAE, 0x39, 0xE0, 0xAE, 0x93, 0xF3, 0xAE, 0x90, 0x0A, 0xA9, 0x0D, 0xA0,
+    0xDA, 0x77, 0x74, 0xC9, 0x19, 0x99, 0x7D, 0x2A, 0x1A, 0x59, 0xC9, 0x2A, 0x90, 0xA5, 0xCA, 0x29,
+    0xA9, 0x9A, 0x4A, 0xC4, 0xC1, 0xC4, 0xCA, 0x4C, 0xAD, 0x3D, 0x59, 0xD9, 0x29, 0xC9, 0x74, 0xD7,
+    0x4A, 0xC9, 0x74, 0xD7, 0x4D, 0x97, 0x39, 0xCA, 0x74, 0xD7, 0x4A, 0xCA, 0x74, 0xD1, 0x90, 0x90,
+    0xA0, 0xA3, 0xDA, 0x0A, 0x99, 0xA0, 0xAA, 0x92, 0x9D, 0x1A, 0x1C, 0x99, 0x0A, 0x2D, 0x91, 0x9A,
+    0x9A, 0x0C, 0x9C, 0x1A, 0xD3, 0xD1, 0xAC, 0xA1, 0x99, 0x74, 0x09, 0xF0, 0x9E, 0xA0, 0xAE, 0x90,
+    0xAE, 0x1E, 0xA1, 0xE9, 0x0A, 0xE1, 0x09, 0xF0, 0x9F, 0x09, 0xEA, 0x0A, 0xE9, 0x0A, 0xE9, 0x0A,
+    0xE1, 0xAE, 0x1A, 0xE1, 0xEA, 0x1E, 0xA1, 0xE9, 0x09, 0xE9, 0x0A, 0xE1, 0xAE, 0x10, 0x77, 0x5A,
+    0xA4, 0xCA, 0x3A, 0xA3, 0xDA, 0x2A, 0xD9, 0x19, 0xD9, 0x1A, 0xD3, 0xDA, 0x2D, 0xA1, 0x9D, 0x3A,
+    0xCA, 0x2A, 0xD2, 0xD9, 0x29, 0xD3, 0xD2, 0x9C, 0xA3, 0xAA, 0x3A, 0xC9, 0x77, 0x50, 0x69, 0xC2,
+    0x9D, 0xA2, 0xAD, 0x3D, 0xA3, 0xD9, 0x3C, 0xA0, 0x74, 0x9C, 0x29, 0xC9, 0x3D, 0xA1, 0xE3, 0x9D,
+    0x91, 0xD9, 0x3A, 0xD1, 0x9D, 0x4D, 0x91, 0xAC, 0xA4, 0xAC, 0x2A, 0xC0, 0x77, 0x39, 0xC3, 0x9C,
+    0x4A, 0xA2, 0x9D, 0xA2, 0xE2, 0xAD, 0x92, 0xAD, 0x29, 0xD9, 0x2E, 0x3D, 0xA2, 0xAD, 0x3D, 0x93,
+    0xD3, 0xD9, 0x29, 0xD4, 0xCA, 0x3A, 0xC3, 0x9C, 0x97, 0x72, 0x4D, 0x7A, 0xDA, 0x5A, 0xC9, 0x9C,
+    0xA3, 0xDA, 0x1A, 0xD7, 0x30, 0x75, 0xC9, 0x39, 0xD9, 0x29, 0xD9, 0x2A, 0xD3, 0xAD, 0x4E, 0x94,
+    0xE9, 0x4E, 0x94, 0xE5, 0xD6, 0xA0, 0x09, 0x6C, 0x95, 0xDA, 0x5D, 0xA5, 0xAD, 0x5A, 0xD4, 0xE9,
+    0x2E, 0xA2, 0xEA, 0x2A, 0xD9, 0x39, 0xC9, 0x59, 0x40, 0x77, 0x77, 0x5E, 0x75, 0xE9, 0x4E, 0x4E,
+    0xA4, 0x9E, 0x92, 0x9E, 0x3F, 0x6A, 0xE9, 0x1A, 0xE9, 0x1A, 0xE7, 0x0F, 0x7A, 0xE9, 0x71, 0xF5,
+    0xAE, 0x97, 0x3F, 0x3A, 0xEA, 0x74, 0x9F, 0x19, 0xF7, 0x6A, 0xF9, 0xF7, 0x09, 0xD9, 0x3F, 0xF9,
+    0x70, 0xAD, 0xA4, 0xFD, 0x93, 0xAD, 0x91, 0xEA, 0x49, 0xFC, 0x4E, 0x91, 0xF4, 0xFD, 0x93, 0xEA,
+    0x71, 0xFF, 0x92, 0xEA, 0x70, 0xFF, 0xD7, 0x6F, 0xC9, 0x0F, 0xC7, 0x4F, 0xCA, 0x19, 0xFC, 0x72,
+    0xAF, 0xC3, 0xAF, 0xC7, 0x0A, 0xFC, 0x5F, 0xD6, 0xAF, 0xC7, 0xFC, 0xA4, 0xAF, 0xC9, 0x1A, 0xD3,
+    0xFC, 0xA2, 0x9F, 0xCA, 0x2E, 0x39, 0xFC, 0xA7, 0x3E, 0x97, 0x74, 0x9E, 0xA7, 0x77, 0x74, 0x29,
+    0xA3, 0xD2, 0x9D, 0x29, 0xD2, 0x9D, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x19, 0xE1, 0x9E, 0x49, 0x7E, 0xA1, 0xEA, 0x09, 0xF0, 0xAF, 0x0F, 0xC0, 0x69,
+    0x73, 0xD7, 0x3D, 0x70, 0xAF, 0xCA, 0x49, 0xFF, 0xC9, 0x2D, 0xA1, 0xFD, 0x2A, 0x92, 0xD9, 0xAD,
+    0xA6, 0xD1, 0xE5, 0x9D, 0x1A, 0xD5, 0x9D, 0x1A, 0xD5, 0x9D, 0x1A, 0xD5, 0x9D, 0x1E, 0x5A, 0xD0,
+    0x9D, 0x95, 0xAD, 0x9E, 0x6A, 0xFC, 0x96, 0xAF, 0xA6, 0x9F, 0xA7, 0xAE, 0xA7, 0x0A, 0xE7, 0x1A,
+    0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xDA, 0x77, 0x70, 0x99, 0x72, 0xAE, 0x71, 0xF7, 0x1F, 0x71,
+    0xF7, 0x09, 0xF9, 0x7A, 0xF9, 0x40, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFE, 0x1F, 0xFE,
+    0x00, 0x0D, 0x99, 0x3C, 0xA0, 0xAC, 0x5C, 0x90, 0x9C, 0xA9, 0x09, 0x9D, 0x29, 0xFD, 0x59, 0xA9,
+    0x92, 0x79, 0x76, 0xAA, 0x73, 0x9C, 0x09, 0xA0, 0xAA, 0x71, 0xAF, 0x97, 0x39, 0xDA, 0x73, 0xAC,
+    0xAA, 0xAC, 0xA7, 0x1A, 0x09, 0xA1, 0x97, 0x39, 0xC2, 0x97, 0xA9, 0x5C, 0x96, 0xA9, 0x09, 0x9A,
+    0xA0, 0xA9, 0x0C, 0x90, 0xAC, 0x9A, 0x9A, 0xC1, 0xAF, 0x93, 0xAD, 0x93, 0x9D, 0x93, 0x9F, 0x91,
+    0xDA, 0xAA, 0xC9, 0x09, 0xC9, 0xA9, 0x0C, 0xA9, 0xA0, 0xAA, 0x09, 0x4A, 0xA5, 0xAA, 0x69, 0x97,
+    0x20, 0x74, 0xC9, 0x73, 0xD7, 0x39, 0xC9, 0x73, 0xD7, 0x3A, 0xC7, 0x4C, 0xA7, 0x3D, 0x73, 0x9C,
+    0x97, 0x3D, 0x73, 0xAC, 0x97, 0x29, 0xD7, 0x3D, 0x73, 0xAC, 0xA7, 0x3D, 0x73, 0xDA, 0x72, 0x9D,
+    0x73, 0xD9, 0x72, 0xAD, 0x73, 0xD7, 0x3D, 0xA7, 0x20, 0x77, 0x76, 0xAF, 0xCA, 0x59, 0xAF, 0xCA,
+    0x49, 0xFF, 0xC9, 0x2A, 0xFF, 0xC2, 0x9D, 0xA9, 0x19, 0xF1, 0x9D, 0xA9, 0x19, 0xF2, 0xA9, 0x5A,
+    0xDA, 0x1C, 0x95, 0xAD, 0xA7, 0x2E, 0x72, 0xE7, 0x2A, 0xD7, 0x2E, 0x72, 0xAD, 0x72, 0xE7, 0x2E,
+    0x72, 0xE7, 0x2D, 0xA7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x97, 0x1E, 0x71, 0x9D, 0xA7, 0x09,
+    0xE7, 0x19, 0xE7, 0x0A, 0xE9, 0x70, 0xAE, 0x96, 0x9F, 0x97, 0xAF, 0x97, 0xAE, 0x71, 0xAE, 0x71,
+    0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71,
+    0x9A, 0x97, 0x2A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x3D, 0xA7, 0x2D, 0xA7, 0x19, 0xE7, 0x19, 0xDA,
+    0x71, 0xAE, 0x71, 0xAE, 0x71, 0xF7, 0x1F, 0x77, 0x77, 0x10, 0x77, 0x59, 0xFA, 0x97, 0x19, 0xFF,
+    0xC7, 0x0E, 0xA9, 0x9A, 0xF3, 0x9C, 0x90, 0xCA, 0x5E, 0x92, 0xD9, 0x71, 0xE2, 0xD9, 0x71, 0xAD,
+    0x2D, 0x97, 0x1A, 0xD2, 0xD9, 0x71, 0xAD, 0x2D, 0x97, 0x1E, 0x2D, 0x97, 0x09, 0xDA, 0x19, 0xD9,
+    0x70, 0xE2, 0x9D, 0x97, 0xAD, 0xA2, 0x9D, 0x96, 0xAE, 0x3A, 0xD9, 0x4A, 0xF4, 0xAD, 0x93, 0xAF,
+    0x5A, 0xD9, 0x3A, 0xE6, 0xAD, 0x93, 0xAE, 0x6E, 0x93, 0xAE, 0x6E, 0x93, 0xAE, 0x6E, 0x93, 0xAE,
+    0x6A, 0xD9, 0x39, 0x99, 0x77, 0x77, 0x74, 0xAE, 0x5D, 0xA5, 0xF4, 0x9E, 0x5F, 0x4A, 0xE4, 0x9F,
+    0x93, 0xF4, 0x9F, 0x90, 0x77, 0x72, 0xAF, 0xA9, 0x71, 0x9F, 0xFA, 0x79, 0xE9, 0x99, 0xAF, 0x59,
+    0x0C, 0xA5, 0xE9, 0x3D, 0x71, 0xE2, 0x9D, 0x71, 0xE2, 0x9D, 0x71, 0xE2, 0x9D, 0x71, 0xE2, 0x9D,
+    0x71, 0xDA, 0x2A, 0xD7, 0x09, 0xD9, 0x2A, 0xD7, 0x0E, 0x3A, 0xD7, 0xE9, 0x3E, 0x59, 0xEA, 0x4E,
+    0x39, 0xFA, 0x5E, 0x3A, 0xEA, 0x6E, 0x3A, 0xE7, 0xE3, 0xAE, 0x7E, 0x3A, 0xE7, 0xE3, 0xAE, 0x69,
+    0xE3, 0xAD, 0xA6, 0x9E, 0x77, 0x9A, 0xA7, 0x77, 0x71, 0xEA, 0x39, 0xDA, 0x6E, 0xA3, 0x9D, 0xA5,
+    0x9F, 0x3A, 0xE5, 0xAF, 0x3F, 0x5F, 0xC7, 0x77, 0x70, 0x74, 0xA7, 0x39, 0xCA, 0x73, 0xAC, 0x97,
+    0x3D, 0x74, 0xD7, 0x3A, 0xCA, 0x73, 0xD9, 0x73, 0xD7, 0x39, 0xCA, 0x5E, 0x2A, 0xC9, 0x5E, 0x2D,
+    0x59, 0xE1, 0x9D, 0x5A, 0xE9, 0x0A, 0xCA, 0x73, 0xD9, 0x73, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x3D,
+    0x73, 0x9D, 0x73, 0xAC, 0xA7, 0x3D, 0x97, 0x29, 0xD7, 0x3A, 0xD7, 0x3D, 0xA0, 0x9D, 0x96, 0xD9,
+    0x0A, 0xDA, 0x5A, 0xD1, 0xEA, 0x5E, 0x1F, 0x5D, 0x97, 0x29, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x29,
+    0xD9, 0x72, 0xAD, 0x73, 0xE7, 0x3D, 0xA7, 0x29, 0xD9, 0x72, 0xDA, 0x73, 0xC9, 0x73, 0x97, 0x50,
+    0x29, 0x93, 0xA1, 0xA1, 0xA9, 0x19, 0x90, 0xC9, 0x19, 0xA0, 0xC0, 0xAA, 0x0C, 0x0C, 0x09, 0x99,
+    0xC0, 0xC9, 0x1A, 0xC0, 0xD9, 0x9C, 0xA0, 0x9F, 0x91, 0xAD, 0x90, 0x73, 0xC9, 0x4A, 0xCA, 0x39,
+    0xCA, 0xA3, 0xC9, 0x9A, 0x2A, 0xC0, 0xAC, 0x2F, 0xD4, 0xAC, 0x5A, 0xC5, 0xAC, 0x10, 0xAF, 0x9A,
+    0x93, 0xA9, 0x3C, 0x93, 0xFA, 0x4C, 0xA3, 0xAC, 0x92, 0xFE, 0x9A, 0xE9, 0x00, 0x2E, 0xA2, 0xC5,
+    0xA9, 0x5C, 0xAD, 0xA2, 0xD1, 0xAC, 0x1C, 0xA2, 0xC1, 0xAC, 0x1A, 0xC2, 0xF9, 0x39, 0xA9, 0x10,
+    0xFD, 0x49, 0xC4, 0xAC, 0x4C, 0xA4, 0xCA, 0x39, 0xC9, 0x3A, 0xC9, 0x3D, 0x4D, 0x4A, 0xA1, 0x29,
+    0xA9, 0x3C, 0x1A, 0x91, 0xAA, 0x19, 0xC1, 0x9C, 0x90, 0xAA, 0x29, 0xDA, 0x29, 0xC9, 0x0C, 0xA1,
+    0xCA, 0x19, 0xC1, 0xCA, 0x2C, 0x90, 0xD9, 0x9D, 0x2A, 0xE1, 0x1A, 0xDA, 0x2A, 0xA1, 0xAA, 0x1C,
+    0x29, 0xC1, 0xC9, 0x2C, 0x1A, 0xC9, 0x9A, 0xC9, 0x1A, 0xF9, 0x5C, 0x19, 0xAA, 0xAD, 0x19, 0xEA,
+    0x10, 0x1C, 0xA0, 0x9E, 0xA4, 0x9F, 0xFC, 0x92, 0x9F, 0x90, 0x9E, 0x29, 0xE4, 0xDA, 0x1A, 0xD9,
+    0x4A, 0xCA, 0x1A, 0xD5, 0xAD, 0x1A, 0xD5, 0xAD, 0x1A, 0xD5, 0xAD, 0x1E, 0x94, 0xE1, 0xE9, 0x4E,
+    0x1E, 0x94, 0xE9, 0x0E, 0x94, 0xE9, 0x0E, 0x94, 0xE9, 0x0E, 0x94, 0xE9, 0x19, 0xAA, 0xA9, 0x29,
+    0xC2, 0xAA, 0x1C, 0xA3, 0xC1, 0xC9, 0x3C, 0xA9, 0xC1, 0xC9, 0x0C, 0xAA, 0xC1, 0xC9, 0x0A, 0xCA,
+    0xC1, 0xC9, 0x0D, 0xAC, 0x90, 0x91, 0xD9, 0xCA, 0x29, 0xCA, 0x9D, 0x90, 0x9D, 0xA0, 0xFE, 0x19,
+    0xFC, 0xA2, 0x9A, 0xDA, 0x10, 0x19, 0x29, 0xD9, 0x3C, 0x93, 0xC9, 0x3C, 0x93, 0xC9, 0x3C, 0x93,
+    0xC9, 0x1A, 0xF9, 0xFC, 0x90, 0x69, 0xEA, 0x1A, 0x2C, 0xA4, 0x9C, 0x4A, 0xC3, 0x9C, 0x92, 0xAC,
+    0xA2, 0xDA, 0x2A, 0xFC, 0x0F, 0xD0, 0x09, 0xEA, 0x69, 0xA5, 0x9A, 0x29, 0xDA, 0x6A, 0x95, 0x9C,
+    0x5A, 0xC1, 0xAF, 0xA1, 0xAE, 0xA1, 0x49, 0x5C, 0xA4, 0xAC, 0xA3, 0x9C, 0x9C, 0x3C, 0x99, 0xC2,
+    0xAC, 0x09, 0xC2, 0xFD, 0x93, 0xAC, 0x5A, 0xC5, 0xAC, 0x90, 0x7A, 0xF1, 0xC5, 0xC5, 0xF9, 0x49,
+    0xC5, 0xCA, 0x09, 0x19, 0xC9, 0x0F, 0xC1, 0xAA, 0xCA, 0x10, 0x2A, 0xDA, 0x2C, 0x94, 0xA9, 0x5C,
+    0xAD, 0xA2, 0xD1, 0xAC, 0x1C, 0xA2, 0xC1, 0xAA, 0x2C, 0x19, 0xDA, 0xD2, 0x9D, 0xA1, 0x6F, 0xD4,
+    0x9C, 0x4A, 0xA4, 0xCA, 0x4C, 0x93, 0x9C, 0x93, 0xAC, 0x4D, 0x39, 0xD4, 0x99, 0x10, 0x29, 0xA9,
+    0x3C, 0x1A, 0xA1, 0x9A, 0x2C, 0x2C, 0x90, 0xAA, 0x29, 0xE2, 0x9C, 0x90, 0xAA, 0x1C, 0xA2, 0xC1,
+    0xCA, 0x2C, 0x90, 0xAC, 0x99, 0xAC, 0x2A, 0xE9, 0x00, 0x1A, 0xDA, 0x2A, 0xA1, 0xAA, 0x1C, 0x29,
+    0xC1, 0xC9, 0x2C, 0x1A, 0xC9, 0x0A, 0xC9, 0x1A, 0xF9, 0x5C, 0x19, 0xAA, 0xAD, 0x19, 0xEA, 0x10,
+    0x4A, 0xC9, 0x4D, 0x4A, 0xC9, 0x4D, 0x4A, 0xCA, 0x4D, 0x4A, 0xCA, 0x4D, 0x94, 0xD4, 0xAC, 0xA4,
+    0xDA, 0x4D, 0x94, 0xD4, 0x9D, 0x49, 0xD4, 0x9D, 0x49, 0xD4, 0x9D, 0x49, 0xD4, 0x9D, 0x5D, 0x5D,
+    0x94, 0xDA, 0x4A, 0xD4, 0x9D, 0x5D, 0x94, 0xE4, 0xAD, 0x49, 0xD9, 0x4E, 0x4A, 0xD9, 0x4E, 0x4A,
+    0xD9, 0x49, 0x99, 0x9C, 0x95, 0xD5, 0xAC, 0xA5, 0xD5, 0xAC, 0xA5, 0xD5, 0xD9, 0x49, 0xD5, 0xD5,
+    0xD9, 0x4A, 0xCA, 0x49, 0xD4, 0x9D, 0x5D, 0x5D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x5D, 0x49,
+    0xD4, 0xAD, 0x4A, 0xCA, 0x4D, 0xA4, 0xD9, 0x3A, 0xD4, 0xDA, 0x4D, 0x93, 0xAD, 0x4E, 0x39, 0xD9,
+    0x3E, 0x39, 0xDA, 0x39, 0x99, 0x40, 0x70, 0xAC, 0x91, 0xAC, 0x97, 0x0D, 0x2D, 0x70, 0x9D, 0x19,
+    0xD7, 0x0A, 0xCA, 0x1A, 0xCA, 0x70, 0xD9, 0x1D, 0x97, 0x0F, 0xEA, 0x69, 0xFF, 0xC5, 0xAF, 0xFD,
+    0x4F, 0xC9, 0x1D, 0x94, 0xFD, 0x2D, 0x49, 0xEA, 0xD1, 0x9D, 0x4E, 0x9A, 0xC9, 0x1A, 0xC9, 0x39,
+    0xE0, 0xD2, 0xD4, 0xAD, 0xA9, 0xD1, 0x9D, 0x4E, 0x9A, 0xCA, 0x1A, 0xCA, 0x4E, 0x0D, 0x91, 0xD9,
+    0x4E, 0x9D, 0x2D, 0x5F, 0xD1, 0x9D, 0x5F, 0xCA, 0x1A, 0xCA, 0x5F, 0xCA, 0x1D, 0x95, 0xFE, 0xAD,
+    0x99, 0xAD, 0x19, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0xFF, 0xFC, 0x2A, 0xCA, 0x9A,
+    0xFE, 0xA9, 0x2D, 0x91, 0xD9, 0x70, 0xD2, 0xD7, 0x09, 0xD1, 0x9D, 0x70, 0xAC, 0xA1, 0xAC, 0xA7,
+    0x0D, 0x91, 0xD9, 0x70, 0x77, 0x72, 0x9A, 0xAF, 0xA7, 0x9F, 0xFC, 0x6F, 0xFE, 0x5F, 0xA9, 0x72,
+    0xF9, 0x73, 0x9E, 0x97, 0x4E, 0xA7, 0x49, 0xE7, 0x5A, 0xDA, 0x75, 0xE9, 0x75, 0xE5, 0xAC, 0x9E,
+    0x2E, 0x94, 0xAF, 0xC2, 0xEA, 0x4A, 0xD5, 0xF4, 0xAC, 0x95, 0xFC, 0xA2, 0xD9, 0x5F, 0xFA, 0xDA,
+    0xAD, 0x29, 0xFF, 0xFD, 0x3F, 0xFF, 0xD3, 0x9F, 0xFF, 0xC4, 0x9F, 0xFF, 0x69, 0xFF, 0xA9, 0x77,
+    0x20, 0x77, 0x77, 0x4A, 0xFA, 0x7A, 0xFF, 0x94, 0xFA, 0x90, 0x9A, 0xD9, 0x3D, 0xA6, 0xA4, 0xD7,
+    0x5D, 0x75, 0xD9, 0x73, 0xAE, 0xAA, 0xAA, 0xAA, 0xA4, 0xFF, 0xE4, 0xFF, 0xE6, 0xAC, 0xA7, 0x49,
+    0xD7, 0x2A, 0xFF, 0xD9, 0x3A, 0xFF, 0xD9, 0x49, 0x9A, 0xD9, 0x99, 0x99, 0x79, 0xD9, 0x73, 0xE7,
+    0x3F, 0x70, 0x9A, 0xEA, 0x71, 0xFC, 0xAA, 0xAA, 0xA9, 0x93, 0xFF, 0xFD, 0x1F, 0xFF, 0xE0, 0x77,
+    0x73, 0x99, 0x99, 0x70, 0xE7, 0xAE, 0x97, 0xE7, 0xFA, 0x7E, 0x7F, 0xC6, 0x9E, 0x7F, 0xCA, 0x59,
+    0xE7, 0xFD, 0x59, 0xE7, 0xFD, 0xA4, 0xAE, 0x7E, 0x9E, 0x4A, 0xE6, 0x9E, 0x0E, 0xA3, 0xAD, 0xA6,
+    0x9E, 0x09, 0xE3, 0xEA, 0x6A, 0xE9, 0x0E, 0xA2, 0xEA, 0x3A, 0xFF, 0xFF, 0xFD, 0x9A, 0xFF, 0xFF,
+    0xFD, 0x92, 0xAE, 0x29, 0xE1, 0xE9, 0x6F, 0x3E, 0x90, 0xE9, 0x6F, 0x92, 0xAE, 0x9E, 0x96, 0xF9,
+    0x3E, 0xAE, 0x96, 0xF9, 0x3A, 0xFD, 0x7F, 0x94, 0xFD, 0x7F, 0x94, 0xAF, 0xC7, 0xF9, 0x5F, 0xC4,
+    0x39, 0xFE, 0xA9, 0x71, 0x9F, 0xFD, 0x97, 0x9D, 0x99, 0x99, 0xAF, 0x96, 0xAD, 0x6E, 0x6A, 0xD6,
+    0x9D, 0x91, 0x9F, 0xFF, 0xFD, 0x1A, 0xAA, 0xFA, 0xAA, 0xAA, 0xAF, 0xA4, 0xAD, 0x59, 0xE6, 0xFF,
+    0xFA, 0x6F, 0xFF, 0x7F, 0xFC, 0xA9, 0x70, 0xEA, 0x77, 0xE9, 0x77, 0xE9, 0x77, 0xEA, 0x77, 0xEA,
+    0x76, 0x9E, 0xA7, 0x69, 0xEA, 0x76, 0x9F, 0x76, 0x9F, 0x76, 0x9F, 0x73, 0x09, 0xFC, 0xA7, 0x71,
+    0x9F, 0xE9, 0x77, 0x9C, 0x99, 0x99, 0xAD, 0x77, 0x9C, 0x4A, 0xCA, 0x76, 0x9C, 0x5C, 0xA7, 0x6A,
+    0xC5, 0xD7, 0x6A, 0xC4, 0x9D, 0x76, 0xAC, 0x4E, 0x69, 0xFA, 0x1A, 0xCA, 0xAA, 0xFA, 0x59, 0xFC,
+    0xA1, 0xAF, 0xF6, 0xCA, 0x6F, 0xF7, 0xC9, 0x6F, 0xFA, 0x6C, 0xA6, 0xEA, 0x90, 0xAD, 0x95, 0xE9,
+    0x4E, 0x3A, 0xD6, 0xFA, 0x2E, 0x39, 0xD7, 0xAF, 0x1E, 0x39, 0xD9, 0x70, 0x9D, 0xA0, 0xE3, 0x9D,
+    0xA7, 0x1A, 0xCA, 0x0E, 0x39, 0xE4, 0xAC, 0xAA, 0xAD, 0xA0, 0xE3, 0x9E, 0x39, 0xFE, 0xA0, 0xE3,
+    0x9E, 0x3A, 0xFE, 0x1E, 0x3A, 0xE9, 0x3A, 0xFA, 0x90, 0x1D, 0x72, 0x9C, 0xA2, 0xD7, 0x2A, 0xC9,
+    0x2D, 0x72, 0xD3, 0xAC, 0x97, 0x1D, 0x3A, 0xC9, 0x71, 0xD3, 0x9C, 0xA7, 0x09, 0xD3, 0x9D, 0x29,
+    0xCA, 0x29, 0xCA, 0x1A, 0xFF, 0xFF, 0xCA, 0xAF, 0xFF, 0xFC, 0xA0, 0x99, 0xDA, 0x9A, 0xEA, 0x99,
+    0xD9, 0x93, 0xAC, 0x90, 0xAF, 0x1D, 0x5A, 0xC9, 0x0D, 0xAD, 0x09, 0xD5, 0x9C, 0xA0, 0xD9, 0xD9,
+    0x9C, 0xA5, 0x9D, 0xAD, 0x0A, 0xCA, 0xAC, 0xA6, 0xFC, 0x09, 0xF9, 0x6F, 0xA1, 0xF9, 0x6F, 0x91,
+    0xF7, 0xF2, 0xF7, 0xAE, 0x2A, 0xE7, 0xAD, 0xA2, 0x9D, 0xA7, 0x9D, 0x93, 0xDA, 0x30, 0x0C, 0xAA,
+    0xA9, 0x97, 0x5F, 0xFC, 0x97, 0x1F, 0xFE, 0x4A, 0xD0, 0xE9, 0x29, 0xAD, 0xA3, 0xAD, 0x0D, 0xA5,
+    0x9D, 0x92, 0xAD, 0x0D, 0x96, 0xAC, 0xA2, 0xAD, 0x0D, 0x96, 0x9D, 0x2A, 0xD0, 0xD9, 0x2A, 0x92,
+    0xD2, 0xAD, 0x0D, 0x91, 0x9D, 0x2D, 0x2A, 0xD0, 0xD9, 0x19, 0xD2, 0xD2, 0xAD, 0x0D, 0x91, 0x9D,
+    0x2D, 0x2A, 0xD0, 0xD9, 0x2D, 0x2A, 0xA2, 0xAD, 0x0D, 0x3D, 0x7A, 0xD0, 0xD3, 0xD7, 0xAD, 0x0D,
+    0x3A, 0xD6, 0xE0, 0xD4, 0xE9, 0x39, 0xE0, 0xD4, 0x9F, 0xCA, 0xFC, 0x09, 0x96, 0xAF, 0xFC, 0x74,
+    0x9A, 0xAA, 0xDA, 0x73, 0x97, 0x6A, 0xC9, 0x75, 0xAC, 0x72, 0x9F, 0xF9, 0x69, 0xFF, 0x97, 0x2A,
+    0xC7, 0x1A, 0xDA, 0x0A, 0xC7, 0x9F, 0xCA, 0xD7, 0xD9, 0x09, 0xF6, 0xAC, 0x4E, 0x6C, 0xA4, 0xAD,
+    0x59, 0xCA, 0x4A, 0xD6, 0xD4, 0xE6, 0xDA, 0x2A, 0xE6, 0xAF, 0xFC, 0x7F, 0xFC, 0x70, 0xAF, 0x9D,
+    0x72, 0x97, 0x1F, 0xFF, 0xA3, 0xFF, 0xFA, 0x20, 0x77, 0x69, 0x9A, 0xAA, 0x96, 0xAF, 0xEA, 0x4A,
+    0xFF, 0xA4, 0xEA, 0x92, 0x99, 0x3A, 0xDA, 0x72, 0xE7, 0x3D, 0xA7, 0x0F, 0xFD, 0x39, 0xDA, 0xFE,
+    0x96, 0xD9, 0x73, 0xD9, 0x70, 0xAF, 0xFA, 0x3A, 0xFF, 0xD7, 0xDA, 0x73, 0xE7, 0x3A, 0xD9, 0x72,
+    0x9E, 0x73, 0xFA, 0xA9, 0x99, 0x94, 0xAF, 0xFA, 0x5F, 0xFA, 0x69, 0xAF, 0xCA, 0x76, 0x9F, 0xFF,
+    0xFC, 0x09, 0xFF, 0xFF, 0xC0, 0x9F, 0xCA, 0xAE, 0xAA, 0xAF, 0x70, 0xE7, 0x7E, 0x77, 0xE1, 0x97,
+    0x4E, 0xAD, 0x97, 0x3F, 0xD9, 0x71, 0xAF, 0xA9, 0x71, 0x9F, 0xD7, 0x39, 0xCA, 0xAE, 0x09, 0xA9,
+    0x72, 0x9F, 0xD9, 0x72, 0xAF, 0xCA, 0x71, 0xAF, 0xC9, 0x72, 0x9F, 0xD7, 0x39, 0xA9, 0xAE, 0x76,
+    0xAE, 0x97, 0x5A, 0xE9, 0x75, 0xAE, 0x97, 0x5A, 0xE9, 0x75, 0xAE, 0x96, 0x49, 0xFE, 0xA9, 0x73,
+    0x9F, 0xFD, 0x97, 0x19, 0xD9, 0x99, 0x99, 0xAE, 0xA7, 0x0A, 0xD6, 0xE3, 0x9F, 0xFF, 0xFF, 0xA4,
+    0xAD, 0x69, 0xD9, 0x29, 0xFF, 0xFF, 0xF9, 0x4E, 0x5A, 0xE7, 0x0F, 0xFF, 0xA7, 0x0F, 0xFE, 0xA7,
+    0x1F, 0xFC, 0xA7, 0x3E, 0xA7, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xEA, 0x77, 0x1E, 0xA7, 0x70,
+    0x9E, 0xA7, 0x70, 0x9E, 0xA7, 0x70, 0x9F, 0x77, 0x09, 0xF7, 0x70, 0x9F, 0x74, 0x77, 0x75, 0xD7,
+    0x71, 0xD7, 0x71, 0xD7, 0x71, 0xD7, 0x59, 0xAA, 0xFD, 0xA9, 0x6A, 0xFF, 0xF5, 0xFC, 0xAA, 0xD9,
+    0x99, 0xAC, 0x4F, 0xA2, 0xD7, 0x09, 0xEA, 0x3D, 0x70, 0xAE, 0x4D, 0x70, 0xEA, 0x4D, 0x70, 0xEA,
+    0x4C, 0xA7, 0x0E, 0x94, 0xCA, 0x70, 0xE9, 0x4C, 0xA7, 0x0E, 0x94, 0xD9, 0x96, 0xE9, 0x4F, 0xFC,
+    0x90, 0xE9, 0x4C, 0xAA, 0xAF, 0xCA, 0x0F, 0x4C, 0xA2, 0x9D, 0xAA, 0x0F, 0x93, 0xCA, 0x29, 0xD2,
+    0xAF, 0x92, 0xCA, 0x2A, 0xD2, 0x9F, 0xEA, 0xDA, 0xAF, 0x3F, 0xFF, 0xF4, 0xFF, 0xFE, 0x94, 0xFF,
+    0xFC, 0xA7, 0xAF, 0xEA, 0x97, 0x49, 0xC9, 0x77, 0x09, 0xC9, 0x77, 0x09, 0xC9, 0x77, 0x73, 0x4A,
+    0xAF, 0xDA, 0x75, 0xFF, 0xDA, 0x73, 0xFF, 0xE9, 0x72, 0x94, 0x9A, 0xF7, 0x72, 0x9E, 0x97, 0x72,
+    0xAD, 0xA7, 0x72, 0x9D, 0xA7, 0x72, 0xAD, 0xA5, 0xFF, 0xFF, 0xFC, 0x90, 0xFF, 0xFF, 0xFC, 0x90,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x7A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xC9, 0x0F, 0xFF, 0xFF, 0xC9, 0x0F,
+    0xD7, 0x70, 0xFD, 0x97, 0xA6, 0x9F, 0xFF, 0xEA, 0x6F, 0xFF, 0xF9, 0x6F, 0xFF, 0xF7, 0xAF, 0xFF,
+    0xD9, 0x70, 0x9A, 0xFF, 0xCA, 0x77, 0x73, 0x49, 0xC9, 0x70, 0x9C, 0x97, 0x09, 0xC9, 0x7A, 0xFA,
+    0x39, 0xFE, 0x3E, 0xAC, 0xA0, 0x92, 0xAD, 0x90, 0xCA, 0x4E, 0x1C, 0xA4, 0xD9, 0x1C, 0xA4, 0xD9,
+    0x1C, 0xA4, 0xD9, 0x1C, 0xA4, 0xDA, 0x1C, 0xA4, 0xE1, 0xD4, 0xAE, 0x9D, 0x5F, 0xF9, 0x29, 0xFF,
+    0x49, 0xFC, 0xA9, 0x5A, 0xC3, 0x9F, 0xFF, 0xFC, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x77, 0x77, 0x69, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFC, 0x1A, 0xAA, 0x99, 0x90, 0xE0, 0x99,
+    0x99, 0x99, 0x70, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7,
+    0x69, 0xE7, 0x69, 0xE7, 0x6A, 0xE7, 0x6A, 0xE9, 0x75, 0xAE, 0x97, 0x5A, 0xE9, 0x75, 0xAE, 0x96,
+    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFE, 0x5A, 0xC9, 0x72, 0xD7, 0x29, 0xC9, 0x4A, 0xAA,
+    0xAA, 0xEA, 0xAA, 0x1F, 0xFE, 0x6D, 0x97, 0x9E, 0x5F, 0xD6, 0xFC, 0x96, 0xFD, 0x97, 0x1E, 0x71,
+    0x9D, 0x97, 0x1E, 0x71, 0xE7, 0x1E, 0x97, 0x0F, 0x79, 0xF7, 0x70, 0x77, 0x2D, 0x74, 0xD7, 0x4D,
+    0x2A, 0xA7, 0xD9, 0xF6, 0x9F, 0xCA, 0x94, 0xAF, 0xC9, 0x7F, 0xC3, 0x94, 0xA9, 0x9D, 0x09, 0xAD,
+    0x69, 0xFD, 0xA5, 0x9F, 0xCA, 0x6F, 0xC9, 0x4D, 0x1D, 0xAD, 0x4A, 0xCA, 0x39, 0xD3, 0xAD, 0x49,
+    0xD1, 0xAE, 0x59, 0xFD, 0x96, 0x9E, 0xA9, 0x77, 0x40, 0x5A, 0xC7, 0x5A, 0xC7, 0x59, 0xC9, 0x73,
+    0x9E, 0x97, 0x1F, 0xE9, 0x6F, 0xFC, 0x94, 0x9E, 0xAC, 0x99, 0xE4, 0xAD, 0x09, 0xC9, 0x09, 0xD4,
+    0xDA, 0x09, 0xC9, 0x1D, 0x93, 0xD9, 0x09, 0xC9, 0x1A, 0xC9, 0x3D, 0x19, 0xC9, 0x1A, 0xC9, 0x3D,
+    0x2C, 0xA1, 0x9C, 0x93, 0xD2, 0xCA, 0x19, 0xC9, 0x3D, 0x2C, 0xA1, 0x9C, 0x93, 0xD2, 0xCA, 0x19,
+    0xC9, 0x3D, 0x2C, 0xA1, 0xAC, 0x93, 0xD2, 0xCA, 0x1A, 0xC9, 0x3D, 0x91, 0xCA, 0x1A, 0xC9, 0x3A,
+    0xC9, 0x1C, 0xA1, 0xAC, 0x91, 0x59, 0xFF, 0xA7, 0x19, 0xFF, 0xDA, 0x79, 0xD9, 0x99, 0x99, 0xAE,
+    0x96, 0xAD, 0x6E, 0x6A, 0xD6, 0x9D, 0x95, 0xAD, 0x69, 0xD9, 0x5A, 0xD6, 0xAD, 0x95, 0xE5, 0xAE,
+    0x29, 0x99, 0x9F, 0xFF, 0x92, 0xFF, 0xFE, 0xA3, 0xFF, 0xFC, 0xA5, 0xFE, 0xA7, 0x7E, 0x97, 0x2A,
+    0xAA, 0xAA, 0xFA, 0xAA, 0xA9, 0x5F, 0xFF, 0xCA, 0x5F, 0xFF, 0xCA, 0x71, 0x9E, 0xA7, 0x69, 0xEA,
+    0x76, 0x9F, 0x76, 0x9F, 0x76, 0x9F, 0x71, 0x6A, 0x75, 0xAC, 0xA7, 0x39, 0xD7, 0x39, 0xD7, 0x4D,
+    0x97, 0x3D, 0xA7, 0x3A, 0xCA, 0x73, 0xAF, 0xFF, 0xD0, 0xAF, 0xFF, 0xD1, 0xAC, 0xA7, 0x5D, 0xA7,
+    0x5D, 0x97, 0x5D, 0x97, 0x49, 0xD7, 0x59, 0xC7, 0x77, 0x7A, 0x76, 0xE9, 0x73, 0xFC, 0x97, 0x09,
+    0xFE, 0xA6, 0x9D, 0x99, 0xCA, 0x0D, 0xA4, 0xAD, 0x90, 0x9C, 0xA1, 0xE2, 0xAD, 0x29, 0xCA, 0x2A,
+    0xCA, 0x19, 0xC3, 0x9C, 0xA3, 0xA7, 0x09, 0xCA, 0x75, 0x9C, 0xA7, 0x59, 0xCA, 0x75, 0x9C, 0xA7,
+    0x59, 0xCA, 0x75, 0x9C, 0xA7, 0x59, 0xCA, 0x60, 0x79, 0xA7, 0x5D, 0x97, 0x5D, 0x97, 0x49, 0xD7,
+    0x59, 0xD7, 0x5A, 0xD7, 0x5D, 0xA1, 0xFF, 0xFD, 0x90, 0xFF, 0xFD, 0x97, 0x3D, 0xA7, 0x3A, 0xCA,
+    0x73, 0xAD, 0x73, 0x9D, 0x73, 0x9D, 0x74, 0x9C, 0x97, 0x74, 0x69, 0xCA, 0x75, 0x9C, 0xA7, 0x59,
+    0xCA, 0x75, 0x9C, 0xA7, 0x59, 0xCA, 0x75, 0x9C, 0xA7, 0x59, 0xCA, 0x79, 0xC3, 0x9C, 0xA3, 0x92,
+    0xAD, 0x29, 0xCA, 0x2A, 0xCA, 0x2A, 0xD9, 0x09, 0xCA, 0x1E, 0x49, 0xD9, 0x9C, 0xA0, 0xDA, 0x69,
+    0xFE, 0xA7, 0x1F, 0xC9, 0x73, 0xE9, 0x75, 0xA7, 0x77, 0x71, 0xC5, 0xC7, 0x2D, 0x5D, 0x70, 0xAC,
+    0x96, 0xD6, 0xAC, 0x97, 0x0D, 0x49, 0xCA, 0x71, 0x9C, 0xA2, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xDA, 0x1A, 0xFF, 0xFF, 0xC2, 0xD7, 0x3D, 0x4D, 0x71, 0xAC, 0x95, 0xD7, 0xAC, 0x96, 0x9C,
+    0xA5, 0x9C, 0xA7, 0x09, 0xC5, 0xCA, 0x77, 0x70, 0x77, 0x3A, 0xC9, 0x71, 0xAE, 0x97, 0xDA, 0xEA,
+    0x49, 0xD0, 0x9C, 0x0A, 0xCA, 0x29, 0xD1, 0x9C, 0x19, 0xD1, 0xAA, 0x29, 0xC2, 0x9C, 0x69, 0xC7,
+    0x39, 0xC7, 0x39, 0xC7, 0x39, 0xC7, 0x39, 0xC7, 0x92, 0x9C, 0x6D, 0xA1, 0x9C, 0x2A, 0xC2, 0xAC,
+    0xA0, 0x9C, 0x1A, 0xC9, 0x3A, 0xDA, 0xC0, 0xD9, 0x59, 0xFC, 0x70, 0x9E, 0x73, 0xA5, 0x29, 0x99,
+    0xAA, 0xAA, 0xCA, 0x19, 0xFF, 0xCA, 0x19, 0xE9, 0x96, 0xAE, 0xA7, 0xAC, 0x9D, 0xA6, 0xAC, 0x1D,
+    0xA5, 0xAC, 0x2D, 0xA4, 0xD3, 0xDA, 0x3D, 0x4D, 0xA2, 0xD5, 0xE1, 0xA9, 0x6D, 0xA7, 0x2A, 0x00,
+    0x1D, 0xAA, 0xAA, 0x99, 0x93, 0xFF, 0xD9, 0x69, 0x9E, 0x97, 0xF9, 0x6E, 0x9C, 0xA5, 0xE0, 0x9C,
+    0xA4, 0xE2, 0xCA, 0x3E, 0x3C, 0xA2, 0xE4, 0xD1, 0xE5, 0xD0, 0xAD, 0x69, 0x91, 0xA7, 0x10, 0x75,
+    0x9C, 0x72, 0xAD, 0x69, 0x2D, 0xA5, 0xD2, 0xDA, 0x4C, 0xA3, 0xD9, 0x29, 0xC9, 0x39, 0xD9, 0x19,
+    0xC9, 0x49, 0xD1, 0xAC, 0x6A, 0xD0, 0xD7, 0xAF, 0x70, 0xEA, 0x2F, 0xFC, 0xA2, 0xFF, 0xC9, 0x00,
+    0x77, 0x7C, 0x72, 0xDA, 0x0D, 0x5D, 0xA1, 0xD4, 0xAD, 0x2A, 0xC3, 0xAD, 0x39, 0xC9, 0x19, 0xD4,
+    0x9C, 0xA0, 0x9D, 0x95, 0xCA, 0x0D, 0x96, 0xFA, 0x7E, 0xA7, 0x0A, 0xFF, 0xC2, 0xAF, 0xFC, 0x00,
+    0x59, 0x97, 0x70, 0xD7, 0x79, 0xD7, 0x7D, 0x97, 0x6A, 0xCA, 0x76, 0xAD, 0x76, 0x9F, 0xFF, 0xE9,
+    0x09, 0xD9, 0x76, 0xAD, 0x77, 0x0E, 0x77, 0x0F, 0xFF, 0xE9, 0x3E, 0x77, 0x0D, 0xA7, 0x79, 0xD9,
+    0x77, 0xAC, 0x77, 0x75, 0x7A, 0x77, 0x1A, 0xC2, 0xC7, 0x4A, 0xD2, 0xD7, 0x2A, 0xE2, 0xE7, 0x09,
+    0xDA, 0xC2, 0xCA, 0xD6, 0x9D, 0x99, 0xC2, 0xC9, 0x9D, 0x93, 0x9D, 0x90, 0x9C, 0x2C, 0x90, 0x9D,
+    0x91, 0x9D, 0x91, 0x9C, 0x2C, 0x91, 0x9D, 0x90, 0xAC, 0xA2, 0x9C, 0x2C, 0x92, 0x9C, 0x91, 0x93,
+    0x9C, 0x2C, 0x97, 0x49, 0xC2, 0xC9, 0x74, 0x9C, 0x2C, 0x97, 0x49, 0xC2, 0xC9, 0x74, 0x9C, 0x2C,
+    0x97, 0x49, 0xC2, 0xC9, 0x74, 0x9C, 0x2C, 0x97, 0x49, 0xC2, 0xC9, 0x74, 0x9C, 0x2C, 0x95, 0x73,
+    0x97, 0x70, 0xD7, 0x70, 0xDA, 0x77, 0x0D, 0x77, 0x09, 0xD7, 0x70, 0xAD, 0x3F, 0xFF, 0xEA, 0x77,
+    0x0D, 0xA7, 0x7A, 0xD7, 0x6A, 0xD2, 0xFF, 0xFE, 0x76, 0xAD, 0x76, 0x9D, 0x97, 0x6D, 0xA7, 0x7A,
+    0xC7, 0x71, 0x95, 0x7A, 0x2A, 0x75, 0x9C, 0x2C, 0x97, 0x49, 0xC2, 0xC9, 0x74, 0x9C, 0x2C, 0x97,
+    0x49, 0xC2, 0xC9, 0x74, 0x9C, 0x2C, 0x97, 0x49, 0xC2, 0xC9, 0x74, 0x9C, 0x2C, 0x97, 0x49, 0xC2,
+    0xC9, 0x69, 0xC3, 0x9C, 0x2C, 0x93, 0xC1, 0xAD, 0x29, 0xC2, 0xC9, 0x2D, 0xA1, 0xAD, 0x19, 0xC2,
+    0xC9, 0x1D, 0xA3, 0xAD, 0x09, 0xC2, 0xC9, 0x0D, 0xA5, 0xEA, 0xC2, 0xC9, 0xDA, 0x7F, 0x2E, 0x97,
+    0x1E, 0x2D, 0x97, 0x3D, 0x2C, 0x97, 0x5C, 0x29, 0x77, 0x72, 0x59, 0x96, 0x97, 0x3D, 0x5D, 0x72,
+    0x9D, 0x5D, 0xA7, 0x1D, 0x96, 0xD7, 0x0A, 0xCA, 0x79, 0xD6, 0xAD, 0x71, 0xAC, 0xA4, 0x9F, 0xFF,
+    0xFA, 0x29, 0xD9, 0x74, 0xDA, 0x1A, 0xD7, 0x5A, 0xD2, 0xE7, 0x3A, 0xD4, 0xFF, 0xFF, 0x6E, 0x7A,
+    0xD7, 0x0D, 0xA5, 0x9D, 0x97, 0x09, 0xD9, 0x4D, 0xA7, 0x2A, 0xC5, 0xAC, 0x77, 0x49, 0x50, 0x77,
+    0x79, 0xC7, 0x59, 0xE7, 0x39, 0xDA, 0xD9, 0x70, 0xAD, 0x1E, 0x96, 0xEA, 0x1C, 0xAE, 0x3A, 0xFA,
+    0x1C, 0x90, 0xAD, 0xA2, 0xD0, 0xAA, 0x1C, 0x91, 0xAC, 0x95, 0xAA, 0x1C, 0x97, 0x2A, 0xA1, 0xC9,
+    0x72, 0xAA, 0x1C, 0x97, 0x2A, 0xA1, 0xC9, 0x72, 0xAA, 0x1C, 0x97, 0x2A, 0xA1, 0xC9, 0x29, 0x29,
+    0xD9, 0xAA, 0x1C, 0x91, 0xDA, 0x19, 0xFA, 0x1C, 0x90, 0xE9, 0x3A, 0xDA, 0x1F, 0xA6, 0x9D, 0x90,
+    0xE9, 0x70, 0x9F, 0xC7, 0x4E, 0x75, 0x9A, 0x70, 0x70, 0x9C, 0xA9, 0x72, 0xAE, 0xA7, 0x39, 0xD7,
+    0x4D, 0x74, 0xAC, 0x74, 0xAC, 0x74, 0xAC, 0x74, 0xD4, 0xAA, 0xDA, 0x2D, 0x29, 0xFE, 0x90, 0xD2,
+    0xE9, 0x19, 0xD9, 0xCA, 0x1A, 0xD5, 0xE9, 0x1D, 0xA5, 0xAD, 0x2D, 0xA5, 0x9D, 0x2D, 0xA5, 0x9D,
+    0x2A, 0xD5, 0xD9, 0x29, 0xEA, 0x99, 0x9E, 0x4F, 0xFC, 0xA5, 0xFF, 0x79, 0xAE, 0x94, 0x77, 0x77,
+    0x09, 0xAF, 0xCA, 0x94, 0xD6, 0x9F, 0xFE, 0x2D, 0xA5, 0xAF, 0xA9, 0x99, 0xFC, 0x9D, 0xA5, 0x9F,
+    0x59, 0xFC, 0xA6, 0xF7, 0x9F, 0x69, 0xE7, 0x09, 0xF6, 0xEA, 0x79, 0xFC, 0x95, 0xE7, 0x9D, 0x0A,
+    0xDA, 0x5E, 0x69, 0xD1, 0x9D, 0xA5, 0xE5, 0xAD, 0x3D, 0xA5, 0xDA, 0x4A, 0xD4, 0xE5, 0xE3, 0xAC,
+    0xA5, 0xDA, 0x5E, 0x2D, 0xA5, 0x9D, 0xA5, 0xE9, 0x0D, 0xA6, 0xEA, 0x5F, 0xD9, 0x6A, 0xE9, 0x59,
+    0xFC, 0xA9, 0x99, 0x99, 0xAF, 0xC7, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0x7F, 0xFF, 0xF9, 0x6D, 0x90,
+    0xAF, 0xFE, 0x96, 0xD4, 0x9A, 0xFC, 0xA9, 0x70, 0xA7, 0x76, 0x77, 0x72, 0xE9, 0x75, 0x9E, 0xA7,
+    0x5F, 0xC7, 0x49, 0xDA, 0xDA, 0x73, 0xE0, 0xAD, 0x72, 0x9E, 0x09, 0xDA, 0x71, 0xE9, 0x1E, 0x71,
+    0xE2, 0xAD, 0xA7, 0xAD, 0x93, 0xE7, 0xE4, 0xAD, 0xA5, 0xAD, 0xA4, 0x9E, 0x5E, 0x6E, 0xA3, 0xAE,
+    0x69, 0xE3, 0xE9, 0x7E, 0xA1, 0xAE, 0x70, 0xAE, 0x1F, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xE9, 0x0F,
+    0xFF, 0xFC, 0x90, 0xFF, 0xFF, 0xC9, 0x0F, 0xFF, 0xD9, 0x0F, 0xFF, 0xD9, 0x2D, 0xA4, 0xD9, 0x4D,
+    0xA4, 0xD9, 0x4D, 0xA4, 0xD9, 0x4D, 0xA4, 0xD9, 0x4D, 0xA4, 0xD9, 0x4D, 0xA4, 0xD9, 0x4D, 0xA4,
+    0xD9, 0x4D, 0xA4, 0xD9, 0x4D, 0xA4, 0xD9, 0x4D, 0xA4, 0xD9, 0x4D, 0xA4, 0xD9, 0x4D, 0xA4, 0xD9,
+    0x4D, 0xA4, 0xD9, 0x4D, 0xA4, 0xD9, 0x4D, 0xA4, 0xD9, 0x4D, 0xA4, 0xD9, 0x10, 0x29, 0x99, 0x4A,
+    0xA5, 0xDA, 0x4D, 0x94, 0xDA, 0x4D, 0x94, 0xDA, 0x4D, 0x94, 0xDA, 0x4D, 0x94, 0xDA, 0x4D, 0x94,
+    0xDA, 0x4D, 0x94, 0xDA, 0x4D, 0x94, 0xDA, 0x4D, 0x94, 0xDA, 0x4D, 0x94, 0xDA, 0x4D, 0x94, 0xDA,
+    0x4D, 0x94, 0xDA, 0x4D, 0x94, 0xDA, 0x4D, 0x94, 0xDA, 0x4D, 0x94, 0xDA, 0x4D, 0x92, 0xFF, 0xFD,
+    0x90, 0xFF, 0xFD, 0x90, 0x0F, 0xFD, 0xA0, 0xFF, 0xE0, 0xAC, 0x72, 0xAC, 0x72, 0xAC, 0x72, 0xAC,
+    0x72, 0xAC, 0x72, 0xD7, 0x2C, 0xA7, 0x1A, 0xA7, 0x0D, 0x70, 0xD9, 0x7D, 0x97, 0xD9, 0x7D, 0x97,
+    0xEA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xE0, 0xFF, 0xE7, 0x30, 0x76, 0xAA, 0xAF, 0xDA, 0x1A, 0xFF,
+    0xD7, 0x50, 0x73, 0xFF, 0x73, 0x9F, 0xCA, 0xAA, 0x73, 0xAC, 0xA7, 0x71, 0xD9, 0x77, 0x09, 0xD7,
+    0x71, 0xE7, 0x71, 0xD9, 0x77, 0x0A, 0xD7, 0x71, 0xE7, 0x70, 0x9D, 0xA7, 0x70, 0xAD, 0x97, 0x70,
+    0xE7, 0x70, 0x9E, 0x77, 0x0E, 0xA7, 0x29, 0xA3, 0xE9, 0x72, 0xDA, 0x1A, 0xE7, 0x39, 0xE0, 0xEA,
+    0x74, 0xFE, 0x97, 0x49, 0xFD, 0x76, 0xFD, 0x76, 0x9F, 0xA7, 0x30, 0x3A, 0xEA, 0x3A, 0xDA, 0x49,
+    0xFE, 0x1F, 0xD9, 0x2E, 0x99, 0x9A, 0xCA, 0xAD, 0xA9, 0xAD, 0x1A, 0xCA, 0x4A, 0xE4, 0xC9, 0x0D,
+    0x6D, 0xA4, 0xCA, 0x0D, 0x6D, 0x94, 0xAC, 0x0D, 0x6D, 0x94, 0xAC, 0x0D, 0x6E, 0x39, 0xCA, 0x0A,
+    0xD9, 0x90, 0x9A, 0xFF, 0xD9, 0x1F, 0xFA, 0xAF, 0xE2, 0x9F, 0xE1, 0xFD, 0x94, 0xAE, 0xA3, 0xAD,
+    0xA2, 0x76, 0x9E, 0xA9, 0x75, 0xAE, 0xAC, 0xA7, 0x49, 0xD9, 0x77, 0x0D, 0xA7, 0x71, 0xD9, 0x77,
+    0x0A, 0xD7, 0x71, 0xAD, 0x77, 0x1D, 0xA7, 0x71, 0xDA, 0x77, 0x1D, 0x97, 0x70, 0x9D, 0x77, 0x1A,
+    0xD7, 0x71, 0xAD, 0x77, 0x1E, 0x77, 0x1D, 0xA7, 0x71, 0xDA, 0x77, 0x09, 0xD9, 0x77, 0x09, 0xD9,
+    0x77, 0x0A, 0xD7, 0x71, 0xE7, 0x71, 0xE7, 0x70, 0xAD, 0xA7, 0x29, 0xA9, 0x19, 0xE9, 0x70, 0x9F,
+    0xFD, 0x71, 0xAF, 0xFC, 0xA7, 0x2A, 0xFF, 0x75, 0xAF, 0xA7, 0x77, 0x70, 0x0E, 0x1E, 0x99, 0xE9,
+    0xAE, 0xA9, 0x99, 0x99, 0x77, 0x71, 0x99, 0x91, 0xE0, 0x9E, 0x9A, 0xE9, 0xAE, 0xA0, 0x77, 0x09,
+    0xEA, 0x49, 0xA1, 0x9D, 0x99, 0xD3, 0xAC, 0x90, 0xAC, 0xA1, 0x9D, 0x2D, 0x1D, 0x92, 0x9D, 0xAA,
+    0xD1, 0xAA, 0x49, 0xAE, 0x97, 0x77, 0x70, 0xFC, 0x93, 0x9C, 0x90, 0xAD, 0x1D, 0xA2, 0xAC, 0x90,
+    0xD9, 0x2A, 0xD9, 0xAD, 0x1A, 0xA4, 0x9A, 0xE9, 0x77, 0x77, 0x73, 0x9C, 0x97, 0x4C, 0xA7, 0x49,
+    0xC7, 0x5C, 0xA7, 0x4A, 0xC7, 0x5C, 0x97, 0x4A, 0xFC, 0x1F, 0xFF, 0xD9, 0x9F, 0xCA, 0xE7, 0x4A,
+    0xC7, 0x49, 0xCA, 0x74, 0xD7, 0x0A, 0xAF, 0xFF, 0x09, 0xFF, 0xFD, 0x93, 0xDA, 0x73, 0x9D, 0x74,
+    0xD9, 0x73, 0xAD, 0x74, 0xD9, 0x73, 0xDA, 0x77, 0x73, 0x76, 0x97, 0x79, 0xD9, 0x74, 0xAF, 0x72,
+    0x9A, 0xF9, 0x71, 0x9F, 0xC9, 0x71, 0xAF, 0xC9, 0x71, 0xAF, 0xC9, 0x72, 0xFA, 0x97, 0x4F, 0xA9,
+    0x74, 0xAF, 0xEA, 0x97, 0x29, 0xAF, 0xEA, 0x97, 0x29, 0xAF, 0xFA, 0x73, 0xAF, 0xD7, 0x69, 0xAD,
+    0x77, 0x19, 0x39, 0x99, 0x77, 0xFE, 0xAA, 0x99, 0x79, 0x9A, 0xAF, 0xFE, 0xA7, 0x39, 0x99, 0xAA,
+    0xD9, 0x29, 0x77, 0x1D, 0xA7, 0x7A, 0xF9, 0x76, 0xAF, 0x97, 0x6A, 0xFA, 0x76, 0xAF, 0xA9, 0x75,
+    0xAF, 0xC9, 0x75, 0x9F, 0x97, 0x49, 0xF9, 0x70, 0x9A, 0xFE, 0x94, 0x9A, 0xFF, 0xA9, 0x39, 0xFF,
+    0xC9, 0x7A, 0xFC, 0xA9, 0x72, 0xAD, 0xA9, 0x75, 0x97, 0x77, 0x59, 0x9A, 0x79, 0x9A, 0xAF, 0xEA,
+    0x19, 0xFF, 0xEA, 0xAA, 0x99, 0x1A, 0xCA, 0xAA, 0x99, 0x72,
 };
 
 static const EpdGlyph opendyslexic_12_regularGlyphs[] = {
     { 0, 0, 21, 0, 0, 0, 0 }, //  
-    { 6, 25, 8, 1, 25, 38, 0 }, // !
-    { 12, 7, 14, 1, 21, 21, 38 }, // "
-    { 26, 22, 28, 1, 20, 143, 59 }, // #
-    { 21, 27, 30, 5, 24, 142, 202 }, // $
-    { 17, 21, 25, 5, 20, 90, 344 }, // %
-    { 20, 22, 24, 2, 21, 110, 434 }, // &
-    { 5, 8, 7, 1, 19, 10, 544 }, // '
-    { 8, 34, 11, 2, 25, 68, 554 }, // (
-    { 8, 34, 11, 1, 25, 68, 622 }, // )
-    { 13, 12, 16, 1, 19, 39, 690 }, // *
-    { 13, 12, 16, 1, 13, 39, 729 }, // +
-    { 6, 8, 8, 1, 4, 12, 768 }, // ,
-    { 13, 3, 15, 1, 9, 10, 780 }, // -
-    { 5, 5, 7, 1, 5, 7, 790 }, // .
-    { 15, 39, 16, 0, 27, 147, 797 }, // /
-    { 14, 19, 17, 1, 19, 67, 944 }, // 0
-    { 12, 19, 15, 1, 19, 57, 1011 }, // 1
-    { 13, 19, 16, 1, 19, 62, 1068 }, // 2
-    { 13, 19, 16, 1, 19, 62, 1130 }, // 3
-    { 14, 19, 17, 1, 19, 67, 1192 }, // 4
-    { 13, 19, 16, 1, 19, 62, 1259 }, // 5
-    { 14, 19, 17, 1, 19, 67, 1321 }, // 6
-    { 13, 19, 16, 1, 19, 62, 1388 }, // 7
-    { 15, 19, 17, 1, 19, 72, 1450 }, // 8
-    { 14, 19, 17, 1, 19, 67, 1522 }, // 9
-    { 5, 15, 7, 1, 15, 19, 1589 }, // :
-    { 6, 18, 8, 1, 14, 27, 1608 }, // ;
-    { 18, 15, 20, 1, 16, 68, 1635 }, // <
-    { 13, 9, 15, 1, 11, 30, 1703 }, // =
-    { 18, 15, 20, 1, 16, 68, 1733 }, // >
-    { 14, 28, 15, 0, 28, 98, 1801 }, // ?
-    { 22, 21, 30, 3, 20, 116, 1899 }, // @
-    { 20, 21, 28, 4, 21, 105, 2015 }, // A
-    { 16, 22, 24, 4, 22, 88, 2120 }, // B
-    { 18, 23, 25, 3, 22, 104, 2208 }, // C
-    { 20, 22, 27, 4, 22, 110, 2312 }, // D
-    { 15, 22, 23, 4, 22, 83, 2422 }, // E
-    { 13, 22, 21, 4, 22, 72, 2505 }, // F
-    { 20, 22, 29, 4, 22, 110, 2577 }, // G
-    { 19, 22, 27, 4, 22, 105, 2687 }, // H
-    { 5, 22, 11, 3, 22, 28, 2792 }, // I
-    { 11, 28, 19, 4, 22, 77, 2820 }, // J
-    { 17, 21, 26, 4, 21, 90, 2897 }, // K
-    { 14, 22, 23, 4, 22, 77, 2987 }, // L
-    { 23, 22, 31, 4, 22, 127, 3064 }, // M
-    { 19, 22, 27, 4, 22, 105, 3191 }, // N
-    { 20, 22, 29, 4, 21, 110, 3296 }, // O
-    { 15, 21, 23, 4, 21, 79, 3406 }, // P
-    { 21, 26, 25, 2, 22, 137, 3485 }, // Q
-    { 16, 22, 24, 4, 22, 88, 3622 }, // R
-    { 20, 23, 28, 4, 22, 115, 3710 }, // S
-    { 19, 21, 27, 4, 21, 100, 3825 }, // T
-    { 18, 23, 26, 4, 22, 104, 3925 }, // U
-    { 21, 22, 29, 4, 22, 116, 4029 }, // V
-    { 27, 21, 36, 4, 21, 142, 4145 }, // W
-    { 20, 22, 28, 4, 22, 110, 4287 }, // X
-    { 18, 21, 27, 4, 21, 95, 4397 }, // Y
-    { 20, 21, 28, 4, 21, 105, 4492 }, // Z
-    { 9, 35, 12, 1, 27, 79, 4597 }, // [
-    { 9, 24, 12, 1, 19, 54, 4676 }, // <backslash>
-    { 9, 35, 12, 1, 27, 79, 4730 }, // ]
-    { 11, 5, 14, 1, 23, 14, 4809 }, // ^
-    { 17, 4, 20, 1, -2, 17, 4823 }, // _
-    { 8, 4, 10, 1, 19, 8, 4840 }, // `
-    { 14, 15, 21, 3, 15, 53, 4848 }, // a
-    { 15, 23, 21, 3, 22, 87, 4901 }, // b
-    { 12, 16, 19, 3, 15, 48, 4988 }, // c
-    { 15, 22, 21, 3, 21, 83, 5036 }, // d
-    { 14, 15, 21, 3, 15, 53, 5119 }, // e
-    { 9, 20, 16, 3, 20, 45, 5172 }, // f
-    { 14, 21, 20, 3, 14, 74, 5217 }, // g
-    { 14, 21, 21, 3, 21, 74, 5291 }, // h
-    { 5, 22, 11, 3, 22, 28, 5365 }, // i
-    { 10, 27, 16, 3, 21, 68, 5393 }, // j
-    { 14, 20, 20, 3, 20, 70, 5461 }, // k
-    { 7, 21, 14, 3, 21, 37, 5531 }, // l
-    { 23, 14, 29, 3, 14, 81, 5568 }, // m
-    { 14, 14, 20, 3, 14, 49, 5649 }, // n
-    { 14, 14, 21, 3, 14, 49, 5698 }, // o
-    { 15, 21, 20, 2, 14, 79, 5747 }, // p
-    { 17, 21, 24, 3, 15, 90, 5826 }, // q
-    { 10, 14, 16, 3, 14, 35, 5916 }, // r
-    { 13, 14, 19, 3, 14, 46, 5951 }, // s
-    { 11, 19, 18, 3, 19, 53, 5997 }, // t
-    { 14, 15, 20, 3, 14, 53, 6050 }, // u
-    { 16, 14, 23, 3, 14, 56, 6103 }, // v
-    { 20, 14, 26, 3, 14, 70, 6159 }, // w
-    { 16, 14, 22, 3, 14, 56, 6229 }, // x
-    { 15, 21, 21, 3, 14, 79, 6285 }, // y
-    { 14, 14, 20, 3, 14, 49, 6364 }, // z
-    { 12, 24, 14, 1, 19, 72, 6413 }, // {
-    { 4, 22, 6, 1, 18, 22, 6485 }, // |
-    { 12, 24, 14, 1, 19, 72, 6507 }, // }
-    { 10, 5, 12, 1, 19, 13, 6579 }, // ~
-    { 0, 0, 21, 0, 0, 0, 6592 }, //  
-    { 6, 25, 8, 1, 19, 38, 6592 }, // ¡
-    { 12, 22, 19, 3, 19, 66, 6630 }, // ¢
-    { 16, 24, 18, 1, 24, 96, 6696 }, // £
-    { 14, 14, 17, 1, 16, 49, 6792 }, // ¤
-    { 17, 21, 19, 1, 18, 90, 6841 }, // ¥
-    { 4, 22, 6, 1, 18, 22, 6931 }, // ¦
-    { 15, 23, 21, 3, 20, 87, 6953 }, // §
-    { 12, 5, 14, 1, 20, 15, 7040 }, // ¨
-    { 11, 10, 13, 1, 23, 28, 7055 }, // ©
-    { 8, 9, 11, 2, 19, 18, 7083 }, // ª
-    { 13, 12, 16, 1, 12, 39, 7101 }, // «
-    { 13, 8, 15, 1, 9, 26, 7140 }, // ¬
-    { 13, 3, 15, 1, 9, 10, 7166 }, // ­
-    { 11, 10, 13, 1, 27, 28, 7176 }, // ®
-    { 10, 3, 13, 1, 18, 8, 7204 }, // ¯
-    { 12, 12, 14, 1, 20, 36, 7212 }, // °
-    { 13, 14, 16, 1, 13, 46, 7248 }, // ±
-    { 7, 9, 8, 0, 20, 16, 7294 }, // ²
-    { 7, 10, 8, 0, 20, 18, 7310 }, // ³
-    { 5, 5, 7, 1, 19, 7, 7328 }, // ´
-    { 15, 17, 20, 2, 14, 64, 7335 }, // µ
-    { 13, 21, 15, 1, 18, 69, 7399 }, // ¶
-    { 5, 5, 7, 1, 11, 7, 7468 }, // ·
-    { 6, 7, 8, 1, 1, 11, 7475 }, // ¸
-    { 7, 10, 8, 0, 21, 18, 7486 }, // ¹
-    { 8, 8, 11, 2, 18, 16, 7504 }, // º
-    { 13, 12, 16, 1, 12, 39, 7520 }, // »
-    { 21, 24, 28, 4, 22, 126, 7559 }, // ¼
-    { 22, 23, 28, 4, 21, 127, 7685 }, // ½
-    { 22, 24, 28, 3, 22, 132, 7812 }, // ¾
-    { 14, 28, 15, 0, 15, 98, 7944 }, // ¿
-    { 20, 28, 28, 4, 28, 140, 8042 }, // À
-    { 20, 33, 28, 4, 33, 165, 8182 }, // Á
-    { 20, 29, 28, 4, 29, 145, 8347 }, // Â
-    { 20, 29, 28, 4, 29, 145, 8492 }, // Ã
-    { 20, 29, 28, 4, 29, 145, 8637 }, // Ä
-    { 20, 30, 28, 4, 30, 150, 8782 }, // Å
-    { 28, 23, 36, 4, 22, 161, 8932 }, // Æ
-    { 18, 28, 25, 3, 22, 126, 9093 }, // Ç
-    { 15, 28, 23, 4, 28, 105, 9219 }, // È
-    { 15, 32, 23, 4, 32, 120, 9324 }, // É
-    { 15, 29, 23, 4, 29, 109, 9444 }, // Ê
-    { 15, 29, 23, 4, 29, 109, 9553 }, // Ë
-    { 8, 30, 11, 0, 30, 60, 9662 }, // Ì
-    { 5, 34, 11, 3, 34, 43, 9722 }, // Í
-    { 10, 31, 11, 0, 31, 78, 9765 }, // Î
-    { 12, 30, 12, -1, 30, 90, 9843 }, // Ï
-    { 23, 22, 27, 1, 22, 127, 9933 }, // Ð
-    { 19, 27, 27, 4, 27, 129, 10060 }, // Ñ
-    { 20, 28, 29, 4, 27, 140, 10189 }, // Ò
-    { 20, 32, 29, 4, 31, 160, 10329 }, // Ó
-    { 20, 29, 29, 4, 28, 145, 10489 }, // Ô
-    { 20, 28, 29, 4, 27, 140, 10634 }, // Õ
-    { 20, 29, 29, 4, 28, 145, 10774 }, // Ö
-    { 12, 7, 15, 1, 10, 21, 10919 }, // ×
-    { 31, 45, 31, -1, 33, 349, 10940 }, // Ø
-    { 18, 30, 26, 4, 29, 135, 11289 }, // Ù
-    { 18, 34, 26, 4, 33, 153, 11424 }, // Ú
-    { 18, 31, 26, 4, 30, 140, 11577 }, // Û
-    { 18, 30, 26, 4, 29, 135, 11717 }, // Ü
-    { 18, 33, 27, 4, 33, 149, 11852 }, // Ý
-    { 12, 20, 14, 1, 20, 60, 12001 }, // Þ
-    { 15, 20, 17, 1, 20, 75, 12061 }, // ß
-    { 14, 20, 21, 3, 20, 70, 12136 }, // à
-    { 14, 24, 21, 3, 24, 84, 12206 }, // á
-    { 14, 21, 21, 3, 21, 74, 12290 }, // â
-    { 14, 20, 21, 3, 20, 70, 12364 }, // ã
-    { 14, 20, 21, 3, 20, 70, 12434 }, // ä
-    { 14, 22, 21, 3, 22, 77, 12504 }, // å
-    { 24, 15, 31, 3, 15, 90, 12581 }, // æ
-    { 12, 21, 19, 3, 15, 63, 12671 }, // ç
-    { 14, 23, 21, 3, 23, 81, 12734 }, // è
-    { 14, 27, 21, 3, 27, 95, 12815 }, // é
-    { 14, 24, 21, 3, 24, 84, 12910 }, // ê
-    { 14, 24, 21, 3, 24, 84, 12994 }, // ë
-    { 9, 21, 11, 0, 21, 48, 13078 }, // ì
-    { 6, 25, 11, 3, 25, 38, 13126 }, // í
-    { 11, 22, 12, 0, 22, 61, 13164 }, // î
-    { 12, 22, 12, -1, 22, 66, 13225 }, // ï
-    { 19, 20, 21, 1, 20, 95, 13291 }, // ð
-    { 14, 21, 20, 3, 21, 74, 13386 }, // ñ
-    { 14, 23, 21, 3, 23, 81, 13460 }, // ò
-    { 14, 27, 21, 3, 27, 95, 13541 }, // ó
-    { 14, 23, 21, 3, 23, 81, 13636 }, // ô
-    { 14, 23, 21, 3, 23, 81, 13717 }, // õ
-    { 14, 23, 21, 3, 23, 81, 13798 }, // ö
-    { 17, 16, 19, 1, 16, 68, 13879 }, // ÷
-    { 14, 39, 21, 3, 26, 137, 13947 }, // ø
-    { 14, 22, 20, 3, 21, 77, 14084 }, // ù
-    { 14, 26, 20, 3, 25, 91, 14161 }, // ú
-    { 14, 23, 20, 3, 22, 81, 14252 }, // û
-    { 14, 22, 20, 3, 21, 77, 14333 }, // ü
-    { 15, 34, 21, 3, 27, 128, 14410 }, // ý
-    { 12, 26, 14, 1, 21, 78, 14538 }, // þ
-    { 15, 30, 21, 3, 23, 113, 14616 }, // ÿ
-    { 20, 28, 28, 4, 28, 140, 14729 }, // Ā
-    { 14, 19, 21, 3, 19, 67, 14869 }, // ā
-    { 20, 31, 28, 4, 31, 155, 14936 }, // Ă
-    { 14, 22, 21, 3, 22, 77, 15091 }, // ă
-    { 20, 27, 28, 4, 21, 135, 15168 }, // Ą
-    { 14, 20, 21, 3, 15, 70, 15303 }, // ą
-    { 18, 33, 25, 3, 32, 149, 15373 }, // Ć
-    { 12, 24, 19, 3, 23, 72, 15522 }, // ć
-    { 18, 31, 25, 3, 30, 140, 15594 }, // Ĉ
-    { 12, 22, 19, 3, 21, 66, 15734 }, // ĉ
-    { 18, 32, 25, 3, 31, 144, 15800 }, // Ċ
-    { 12, 23, 19, 3, 22, 69, 15944 }, // ċ
-    { 18, 33, 25, 3, 32, 149, 16013 }, // Č
-    { 12, 24, 19, 3, 23, 72, 16162 }, // č
-    { 20, 31, 27, 4, 31, 155, 16234 }, // Ď
-    { 20, 22, 24, 3, 21, 110, 16389 }, // ď
-    { 23, 22, 27, 1, 22, 127, 16499 }, // Đ
-    { 19, 22, 23, 3, 21, 105, 16626 }, // đ
-    { 15, 28, 23, 4, 28, 105, 16731 }, // Ē
-    { 14, 23, 21, 3, 23, 81, 16836 }, // ē
-    { 15, 30, 23, 4, 30, 113, 16917 }, // Ĕ
-    { 14, 26, 21, 3, 26, 91, 17030 }, // ĕ
-    { 15, 30, 23, 4, 30, 113, 17121 }, // Ė
-    { 14, 25, 21, 3, 25, 88, 17234 }, // ė
-    { 15, 27, 23, 4, 22, 102, 17322 }, // Ę
-    { 14, 21, 21, 3, 15, 74, 17424 }, // ę
-    { 15, 31, 23, 4, 31, 117, 17498 }, // Ě
-    { 14, 26, 21, 3, 26, 91, 17615 }, // ě
-    { 20, 29, 29, 4, 29, 145, 17706 }, // Ĝ
-    { 14, 28, 20, 3, 21, 98, 17851 }, // ĝ
-    { 20, 31, 29, 4, 31, 155, 17949 }, // Ğ
-    { 14, 30, 20, 3, 23, 105, 18104 }, // ğ
-    { 20, 30, 29, 4, 30, 150, 18209 }, // Ġ
-    { 14, 29, 20, 3, 22, 102, 18359 }, // ġ
-    { 20, 33, 29, 4, 22, 165, 18461 }, // Ģ
-    { 14, 30, 20, 3, 23, 105, 18626 }, // ģ
-    { 19, 29, 27, 4, 29, 138, 18731 }, // Ĥ
-    { 16, 27, 21, 1, 27, 108, 18869 }, // ĥ
-    { 20, 21, 27, 3, 21, 105, 18977 }, // Ħ
-    { 16, 21, 21, 1, 21, 84, 19082 }, // ħ
-    { 10, 31, 11, 0, 31, 78, 19166 }, // Ĩ
-    { 10, 22, 12, 1, 22, 55, 19244 }, // ĩ
-    { 12, 29, 12, -1, 29, 87, 19299 }, // Ī
-    { 12, 20, 13, 0, 20, 60, 19386 }, // ī
-    { 6, 28, 15, 6, 22, 42, 19446 }, // Į
-    { 6, 28, 11, 2, 22, 42, 19488 }, // į
-    { 5, 31, 11, 3, 31, 39, 19530 }, // İ
-    { 5, 14, 11, 3, 14, 18, 19569 }, // ı
-    { 16, 28, 23, 3, 22, 112, 19587 }, // Ĳ
-    { 19, 29, 23, 3, 22, 138, 19699 }, // ĳ
-    { 12, 33, 19, 4, 27, 99, 19837 }, // Ĵ
-    { 13, 27, 17, 3, 21, 88, 19936 }, // ĵ
-    { 17, 30, 26, 4, 21, 128, 20024 }, // Ķ
-    { 14, 31, 20, 3, 20, 109, 20152 }, // ķ
-    { 12, 14, 16, 2, 14, 42, 20261 }, // ĸ
-    { 14, 30, 23, 4, 30, 105, 20303 }, // Ĺ
-    { 7, 29, 14, 3, 29, 51, 20408 }, // ĺ
-    { 14, 33, 23, 4, 22, 116, 20459 }, // Ļ
-    { 7, 32, 14, 3, 21, 56, 20575 }, // ļ
-    { 14, 22, 23, 4, 22, 77, 20631 }, // Ľ
-    { 10, 22, 14, 3, 22, 55, 20708 }, // ľ
-    { 14, 22, 23, 4, 22, 77, 20763 }, // Ŀ
-    { 11, 21, 15, 3, 21, 58, 20840 }, // ŀ
-    { 24, 34, 23, -6, 27, 204, 20898 }, // Ł
-    { 16, 21, 14, -5, 21, 84, 21102 }, // ł
-    { 19, 30, 27, 4, 30, 143, 21186 }, // Ń
-    { 14, 24, 20, 3, 24, 84, 21329 }, // ń
-    { 19, 31, 27, 4, 22, 148, 21413 }, // Ņ
-    { 14, 23, 20, 3, 14, 81, 21561 }, // ņ
-    { 19, 30, 27, 4, 30, 143, 21642 }, // Ň
-    { 14, 24, 20, 3, 24, 84, 21785 }, // ň
-    { 14, 26, 17, 1, 26, 91, 21869 }, // ŉ
-    { 19, 26, 27, 4, 22, 124, 21960 }, // Ŋ
-    { 14, 19, 20, 3, 14, 67, 22084 }, // ŋ
-    { 20, 28, 29, 4, 27, 140, 22151 }, // Ō
-    { 14, 21, 21, 3, 21, 74, 22291 }, // ō
-    { 20, 30, 29, 4, 29, 150, 22365 }, // Ŏ
-    { 14, 25, 21, 3, 25, 88, 22515 }, // ŏ
-    { 21, 29, 29, 4, 28, 153, 22603 }, // Ő
-    { 19, 24, 22, 2, 24, 114, 22756 }, // ő
-    { 29, 21, 34, 4, 21, 153, 22870 }, // Œ
-    { 25, 15, 29, 3, 15, 94, 23023 }, // œ
-    { 16, 29, 24, 4, 29, 116, 23117 }, // Ŕ
-    { 10, 21, 16, 3, 21, 53, 23233 }, // ŕ
-    { 16, 34, 24, 4, 22, 136, 23286 }, // Ŗ
-    { 11, 27, 16, 2, 14, 75, 23422 }, // ŗ
-    { 16, 30, 24, 4, 30, 120, 23497 }, // Ř
-    { 11, 21, 16, 2, 21, 58, 23617 }, // ř
-    { 20, 33, 28, 4, 32, 165, 23675 }, // Ś
-    { 13, 23, 19, 3, 23, 75, 23840 }, // ś
-    { 20, 31, 28, 4, 30, 155, 23915 }, // Ŝ
-    { 13, 21, 19, 3, 21, 69, 24070 }, // ŝ
-    { 20, 28, 28, 4, 22, 140, 24139 }, // Ş
-    { 13, 21, 19, 3, 14, 69, 24279 }, // ş
-    { 20, 33, 28, 4, 32, 165, 24348 }, // Š
-    { 13, 23, 19, 3, 23, 75, 24513 }, // š
-    { 19, 26, 27, 4, 21, 124, 24588 }, // Ţ
-    { 12, 24, 18, 3, 19, 72, 24712 }, // ţ
-    { 19, 29, 27, 4, 29, 138, 24784 }, // Ť
-    { 12, 21, 18, 3, 21, 63, 24922 }, // ť
-    { 19, 21, 27, 4, 21, 100, 24985 }, // Ŧ
-    { 12, 19, 18, 2, 19, 57, 25085 }, // ŧ
-    { 18, 31, 26, 4, 30, 140, 25142 }, // Ũ
-    { 14, 23, 20, 3, 22, 81, 25282 }, // ũ
-    { 18, 29, 26, 4, 28, 131, 25363 }, // Ū
-    { 14, 21, 20, 3, 20, 74, 25494 }, // ū
-    { 18, 32, 26, 4, 31, 144, 25568 }, // Ŭ
-    { 14, 24, 20, 3, 23, 84, 25712 }, // ŭ
-    { 18, 32, 26, 4, 31, 144, 25796 }, // Ů
-    { 14, 24, 20, 3, 23, 84, 25940 }, // ů
-    { 20, 31, 26, 4, 30, 155, 26024 }, // Ű
-    { 19, 23, 21, 1, 22, 110, 26179 }, // ű
-    { 18, 27, 26, 4, 22, 122, 26289 }, // Ų
-    { 14, 20, 20, 3, 14, 70, 26411 }, // ų
-    { 27, 28, 36, 4, 28, 189, 26481 }, // Ŵ
-    { 20, 22, 26, 3, 22, 110, 26670 }, // ŵ
-    { 18, 30, 27, 4, 30, 135, 26780 }, // Ŷ
-    { 15, 31, 21, 3, 24, 117, 26915 }, // ŷ
-    { 18, 30, 27, 4, 30, 135, 27032 }, // Ÿ
-    { 20, 30, 28, 4, 30, 150, 27167 }, // Ź
-    { 14, 23, 20, 3, 23, 81, 27317 }, // ź
-    { 20, 29, 28, 4, 29, 145, 27398 }, // Ż
-    { 14, 22, 20, 3, 22, 77, 27543 }, // ż
-    { 20, 30, 28, 4, 30, 150, 27620 }, // Ž
-    { 14, 23, 20, 3, 23, 81, 27770 }, // ž
-    { 9, 20, 13, 3, 20, 45, 27851 }, // ſ
-    { 22, 24, 29, 4, 23, 132, 27896 }, // Ơ
-    { 16, 15, 21, 3, 15, 60, 28028 }, // ơ
-    { 18, 21, 23, 1, 21, 95, 28088 }, // Ƥ
-    { 15, 25, 20, 2, 18, 94, 28183 }, // ƥ
-    { 12, 19, 15, 1, 18, 57, 28277 }, // Ʃ
-    { 19, 21, 27, 4, 21, 100, 28334 }, // Ƭ
-    { 11, 22, 18, 3, 22, 61, 28434 }, // ƭ
-    { 19, 26, 27, 4, 21, 124, 28495 }, // Ʈ
-    { 20, 26, 26, 4, 25, 130, 28619 }, // Ư
-    { 16, 17, 20, 3, 16, 68, 28749 }, // ư
-    { 8, 4, 10, 1, 19, 8, 28817 }, // ̀
-    { 5, 5, 7, 1, 19, 7, 28825 }, // ́
-    { 11, 5, 13, 1, 0, 14, 28832 }, // ̂
-    { 10, 5, 12, 1, 19, 13, 28846 }, // ̃
-    { 12, 4, 15, 2, 17, 12, 28859 }, // ̄
-    { 17, 3, 19, 1, 22, 13, 28871 }, // ̅
-    { 11, 5, 13, 1, 18, 14, 28884 }, // ̆
-    { 5, 5, 7, 1, 20, 7, 28898 }, // ̇
-    { 12, 5, 14, 1, 20, 15, 28905 }, // ̈
-    { 6, 5, 7, 0, 16, 8, 28920 }, // ̉
-    { 6, 5, 8, 1, 19, 8, 28928 }, // ̊
-    { 19, 4, 21, 1, 19, 19, 28936 }, // ̋
-    { 11, 5, 13, 1, 19, 14, 28955 }, // ̌
-    { 19, 4, 15, -5, 20, 19, 28969 }, // ̏
-    { 6, 8, 8, 1, 19, 12, 28988 }, // ̒
-    { 6, 7, 8, 1, 18, 11, 29000 }, // ̓
-    { 6, 7, 8, 1, 18, 11, 29011 }, // ̔
-    { 5, 6, 7, 1, -1, 8, 29022 }, // ̘
-    { 5, 6, 7, 1, -1, 8, 29030 }, // ̙
-    { 11, 6, 13, 1, 20, 17, 29038 }, // ̚
-    { 4, 6, 6, 1, 16, 6, 29055 }, // ̛
-    { 4, 5, 6, 1, -2, 5, 29061 }, // ̜
-    { 7, 4, 9, 1, 3, 7, 29066 }, // ̝
-    { 7, 4, 9, 1, -1, 7, 29073 }, // ̞
-    { 6, 5, 8, 1, -2, 8, 29080 }, // ̟
-    { 13, 4, 15, 1, -3, 13, 29088 }, // ̠
-    { 5, 5, 7, 1, 1, 7, 29101 }, // ̣
-    { 12, 5, 14, 1, 0, 15, 29108 }, // ̤
-    { 6, 5, 8, 1, 19, 8, 29123 }, // ̥
-    { 6, 8, 8, 1, 4, 12, 29131 }, // ̦
-    { 6, 7, 8, 1, 1, 11, 29143 }, // ̧
-    { 6, 7, 8, 1, 1, 11, 29154 }, // ̨
-    { 4, 7, 6, 1, -1, 7, 29165 }, // ̩
-    { 9, 4, 11, 1, -1, 9, 29172 }, // ̪
-    { 11, 5, 13, 1, 0, 14, 29181 }, // ̬
-    { 11, 5, 13, 1, -1, 14, 29195 }, // ̭
-    { 10, 5, 12, 1, 19, 13, 29209 }, // ̰
-    { 10, 3, 12, 1, 18, 8, 29222 }, // ̱
-    { 11, 3, 13, 1, -2, 9, 29230 }, // ̲
-    { 10, 5, 12, 1, 19, 13, 29239 }, // ̴
-    { 13, 3, 15, 1, 9, 10, 29252 }, // ̵
-    { 4, 5, 6, 1, -2, 5, 29262 }, // ̹
-    { 9, 4, 11, 1, -1, 9, 29267 }, // ̺
-    { 8, 7, 10, 1, 0, 14, 29276 }, // ̻
-    { 9, 5, 11, 1, 0, 12, 29290 }, // ̼
-    { 6, 5, 9, 2, 19, 8, 29302 }, // ̽
-    { 10, 5, 12, 1, 19, 13, 29310 }, // ͂
-    { 4, 5, 6, 1, 21, 5, 29323 }, // ̓
-    { 12, 11, 14, 1, 26, 33, 29328 }, // ̈́
-    { 9, 5, 11, 1, 20, 12, 29361 }, // ͆
-    { 13, 9, 15, 1, 0, 30, 29373 }, // ͇
-    { 10, 7, 12, 1, 0, 18, 29403 }, // ͈
-    { 8, 7, 10, 1, -1, 14, 29421 }, // ͉
-    { 10, 15, 12, 1, 24, 38, 29435 }, // ͊
-    { 20, 11, 22, 1, 22, 55, 29473 }, // ͋
-    { 15, 13, 18, 2, 14, 49, 29528 }, // ͌
-    { 13, 5, 16, 2, -3, 17, 29577 }, // ͍
-    { 4, 4, 6, 1, 3, 4, 29594 }, // ͎
-    { 21, 5, 23, 1, 0, 27, 29598 }, // ͜
-    { 21, 5, 23, 1, 19, 27, 29625 }, // ͡
-    { 25, 6, 27, 1, -2, 38, 29652 }, // ͢
-    { 20, 21, 28, 4, 21, 105, 29690 }, // Α
-    { 16, 22, 24, 4, 22, 88, 29795 }, // Β
-    { 12, 21, 14, 1, 19, 63, 29883 }, // Γ
-    { 19, 19, 22, 1, 19, 91, 29946 }, // Δ
-    { 15, 22, 23, 4, 22, 83, 30037 }, // Ε
-    { 20, 21, 28, 4, 21, 105, 30120 }, // Ζ
-    { 19, 22, 27, 4, 22, 105, 30225 }, // Η
-    { 20, 22, 29, 4, 21, 110, 30330 }, // Θ
-    { 5, 22, 11, 3, 22, 28, 30440 }, // Ι
-    { 17, 21, 26, 4, 21, 90, 30468 }, // Κ
-    { 21, 22, 29, 4, 21, 116, 30558 }, // Λ
-    { 23, 22, 31, 4, 22, 127, 30674 }, // Μ
-    { 19, 22, 27, 4, 22, 105, 30801 }, // Ν
-    { 17, 18, 19, 1, 18, 77, 30906 }, // Ξ
-    { 20, 22, 29, 4, 21, 110, 30983 }, // Ο
-    { 13, 18, 16, 1, 18, 59, 31093 }, // Π
-    { 15, 21, 23, 4, 21, 79, 31152 }, // Ρ
-    { 12, 19, 15, 1, 18, 57, 31231 }, // Σ
-    { 19, 21, 27, 4, 21, 100, 31288 }, // Τ
-    { 18, 21, 27, 4, 21, 95, 31388 }, // Υ
-    { 25, 27, 35, 5, 24, 169, 31483 }, // Φ
-    { 20, 22, 28, 4, 22, 110, 31652 }, // Χ
-    { 18, 22, 20, 1, 20, 99, 31762 }, // Ψ
-    { 19, 20, 21, 1, 19, 95, 31861 }, // Ω
-    { 17, 16, 23, 3, 15, 68, 31956 }, // α
-    { 15, 30, 17, 1, 24, 113, 32024 }, // β
-    { 15, 22, 17, 1, 14, 83, 32137 }, // γ
-    { 15, 21, 17, 1, 21, 79, 32220 }, // δ
-    { 11, 13, 13, 1, 13, 36, 32299 }, // ε
-    { 13, 21, 14, 0, 18, 69, 32335 }, // ζ
-    { 16, 22, 18, 1, 15, 88, 32404 }, // η
-    { 14, 19, 17, 1, 19, 67, 32492 }, // θ
-    { 7, 17, 13, 3, 17, 30, 32559 }, // ι
-    { 12, 15, 18, 3, 15, 45, 32589 }, // κ
-    { 15, 21, 19, 2, 21, 79, 32634 }, // λ
-    { 15, 17, 20, 2, 14, 64, 32713 }, // μ
-    { 15, 14, 17, 1, 14, 53, 32777 }, // ν
-    { 13, 21, 14, 0, 18, 69, 32830 }, // ξ
-    { 14, 14, 21, 3, 14, 49, 32899 }, // ο
-    { 15, 14, 18, 1, 13, 53, 32948 }, // π
-    { 16, 20, 18, 1, 14, 80, 33001 }, // ρ
-    { 11, 17, 14, 1, 18, 47, 33081 }, // ς
-    { 18, 14, 22, 3, 14, 63, 33128 }, // σ
-    { 14, 14, 16, 1, 13, 49, 33191 }, // τ
-    { 12, 15, 15, 1, 15, 45, 33240 }, // υ
-    { 20, 30, 29, 4, 27, 150, 33285 }, // φ
-    { 18, 19, 21, 1, 14, 86, 33435 }, // χ
-    { 13, 24, 16, 2, 18, 78, 33521 }, // ψ
-    { 18, 14, 20, 1, 13, 63, 33599 }, // ω
-    { 20, 29, 28, 4, 21, 145, 33662 }, // Ạ
-    { 14, 22, 21, 3, 15, 77, 33807 }, // ạ
-    { 20, 32, 28, 4, 32, 160, 33884 }, // Ả
-    { 14, 22, 21, 3, 22, 77, 34044 }, // ả
-    { 20, 35, 28, 4, 35, 175, 34121 }, // Ấ
-    { 15, 27, 21, 3, 27, 102, 34296 }, // ấ
-    { 21, 31, 28, 3, 31, 163, 34398 }, // Ầ
-    { 17, 24, 21, 0, 24, 102, 34561 }, // ầ
-    { 20, 34, 28, 4, 34, 170, 34663 }, // Ẩ
-    { 14, 25, 21, 3, 25, 88, 34833 }, // ẩ
-    { 20, 35, 28, 4, 35, 175, 34921 }, // Ẫ
-    { 14, 26, 21, 3, 26, 91, 35096 }, // ẫ
-    { 20, 37, 28, 4, 29, 185, 35187 }, // Ậ
-    { 14, 28, 21, 3, 21, 98, 35372 }, // ậ
-    { 20, 40, 28, 4, 40, 200, 35470 }, // Ắ
-    { 14, 31, 21, 3, 31, 109, 35670 }, // ắ
-    { 20, 38, 28, 4, 38, 190, 35779 }, // Ằ
-    { 14, 30, 21, 3, 30, 105, 35969 }, // ằ
-    { 20, 40, 28, 4, 40, 200, 36074 }, // Ẳ
-    { 14, 33, 21, 3, 33, 116, 36274 }, // ẳ
-    { 20, 39, 28, 4, 39, 195, 36390 }, // Ẵ
-    { 14, 30, 21, 3, 30, 105, 36585 }, // ẵ
-    { 20, 39, 28, 4, 31, 195, 36690 }, // Ặ
-    { 14, 29, 21, 3, 22, 102, 36885 }, // ặ
-    { 15, 28, 23, 4, 22, 105, 36987 }, // Ẹ
-    { 14, 22, 21, 3, 15, 77, 37092 }, // ẹ
-    { 15, 30, 23, 4, 30, 113, 37169 }, // Ẻ
-    { 14, 25, 21, 3, 25, 88, 37282 }, // ẻ
-    { 15, 29, 23, 4, 29, 109, 37370 }, // Ẽ
-    { 14, 24, 21, 3, 24, 84, 37479 }, // ẽ
-    { 16, 33, 23, 4, 33, 132, 37563 }, // Ế
-    { 16, 25, 21, 3, 25, 100, 37695 }, // ế
-    { 20, 30, 23, -1, 30, 150, 37795 }, // Ề
-    { 17, 27, 21, 0, 27, 115, 37945 }, // ề
-    { 16, 33, 23, 4, 33, 132, 38060 }, // Ể
-    { 14, 29, 21, 3, 29, 102, 38192 }, // ể
-    { 15, 34, 23, 4, 34, 128, 38294 }, // Ễ
-    { 14, 29, 21, 3, 29, 102, 38422 }, // ễ
-    { 15, 35, 23, 4, 29, 132, 38524 }, // Ệ
-    { 14, 31, 21, 3, 24, 109, 38656 }, // ệ
-    { 6, 32, 11, 3, 32, 48, 38765 }, // Ỉ
-    { 6, 23, 11, 3, 23, 35, 38813 }, // ỉ
-    { 5, 29, 11, 3, 22, 37, 38848 }, // Ị
-    { 5, 29, 11, 3, 22, 37, 38885 }, // ị
-    { 20, 29, 29, 4, 21, 145, 38922 }, // Ọ
-    { 14, 22, 21, 3, 14, 77, 39067 }, // ọ
-    { 20, 30, 29, 4, 29, 150, 39144 }, // Ỏ
-    { 14, 25, 21, 3, 25, 88, 39294 }, // ỏ
-    { 25, 29, 30, 4, 28, 182, 39382 }, // Ố
-    { 17, 24, 21, 3, 24, 102, 39564 }, // ố
-    { 21, 30, 29, 3, 29, 158, 39666 }, // Ồ
-    { 17, 26, 21, 0, 26, 111, 39824 }, // ồ
-    { 20, 33, 29, 4, 32, 165, 39935 }, // Ổ
-    { 14, 28, 21, 3, 28, 98, 40100 }, // ổ
-    { 20, 34, 29, 4, 33, 170, 40198 }, // Ỗ
-    { 14, 29, 21, 3, 29, 102, 40368 }, // ỗ
-    { 20, 36, 29, 4, 28, 180, 40470 }, // Ộ
-    { 14, 31, 21, 3, 23, 109, 40650 }, // ộ
-    { 22, 32, 29, 4, 31, 176, 40759 }, // Ớ
-    { 16, 25, 21, 3, 25, 100, 40935 }, // ớ
-    { 22, 30, 29, 4, 29, 165, 41035 }, // Ờ
-    { 16, 23, 21, 3, 23, 92, 41200 }, // ờ
-    { 22, 31, 29, 4, 30, 171, 41292 }, // Ở
-    { 16, 25, 21, 3, 25, 100, 41463 }, // ở
-    { 22, 30, 29, 4, 29, 165, 41563 }, // Ỡ
-    { 16, 24, 21, 3, 24, 96, 41728 }, // ỡ
-    { 22, 31, 29, 4, 23, 171, 41824 }, // Ợ
-    { 16, 23, 21, 3, 15, 92, 41995 }, // ợ
-    { 18, 29, 26, 4, 22, 131, 42087 }, // Ụ
-    { 14, 21, 20, 3, 14, 74, 42218 }, // ụ
-    { 18, 32, 26, 4, 31, 144, 42292 }, // Ủ
-    { 14, 24, 20, 3, 23, 84, 42436 }, // ủ
-    { 20, 32, 26, 4, 31, 160, 42520 }, // Ứ
-    { 16, 24, 20, 3, 23, 96, 42680 }, // ứ
-    { 20, 30, 26, 4, 29, 150, 42776 }, // Ừ
-    { 16, 23, 20, 3, 22, 92, 42926 }, // ừ
-    { 20, 32, 26, 4, 31, 160, 43018 }, // Ử
-    { 16, 24, 20, 3, 23, 96, 43178 }, // ử
-    { 20, 31, 26, 4, 30, 155, 43274 }, // Ữ
-    { 16, 23, 20, 3, 22, 92, 43429 }, // ữ
-    { 20, 32, 26, 4, 25, 160, 43521 }, // Ự
-    { 16, 23, 20, 3, 16, 92, 43681 }, // ự
-    { 18, 29, 27, 4, 29, 131, 43773 }, // Ỳ
-    { 15, 30, 21, 3, 23, 113, 43904 }, // ỳ
-    { 18, 32, 27, 4, 21, 144, 44017 }, // Ỵ
-    { 18, 22, 22, 3, 14, 99, 44161 }, // ỵ
-    { 18, 31, 27, 4, 31, 140, 44260 }, // Ỷ
-    { 15, 32, 21, 3, 25, 120, 44400 }, // ỷ
-    { 18, 30, 27, 4, 30, 135, 44520 }, // Ỹ
-    { 15, 31, 21, 3, 24, 117, 44655 }, // ỹ
-    { 0, 0, 21, 0, 0, 0, 44772 }, //  
-    { 0, 0, 33, 0, 0, 0, 44772 }, //  
-    { 0, 0, 21, 0, 0, 0, 44772 }, //  
-    { 0, 0, 33, 0, 0, 0, 44772 }, //  
-    { 0, 0, 16, 0, 0, 0, 44772 }, //  
-    { 0, 0, 14, 0, 0, 0, 44772 }, //  
-    { 0, 0, 12, 0, 0, 0, 44772 }, //  
-    { 0, 0, 17, 0, 0, 0, 44772 }, //  
-    { 0, 0, 7, 0, 0, 0, 44772 }, //  
-    { 0, 0, 13, 0, 0, 0, 44772 }, //  
-    { 0, 0, 12, 0, 0, 0, 44772 }, //  
-    { 0, 0, 8, 0, 0, 0, 44772 }, // ​
-    { 0, 0, 1, 0, 0, 0, 44772 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 44772 }, // ‍
-    { 0, 0, 1, 0, 0, 0, 44772 }, // ‎
-    { 0, 0, 1, 0, 0, 0, 44772 }, // ‏
-    { 13, 3, 15, 1, 9, 10, 44772 }, // ‐
-    { 13, 3, 15, 1, 9, 10, 44782 }, // ‑
-    { 18, 3, 20, 1, 9, 14, 44792 }, // ‒
-    { 17, 4, 20, 1, 9, 17, 44806 }, // –
-    { 26, 4, 28, 1, 9, 26, 44823 }, // —
-    { 26, 4, 28, 1, 9, 26, 44849 }, // ―
-    { 11, 22, 14, 1, 18, 61, 44875 }, // ‖
-    { 19, 8, 21, 1, -2, 38, 44936 }, // ‗
-    { 6, 7, 8, 1, 21, 11, 44974 }, // ‘
-    { 6, 7, 8, 1, 21, 11, 44985 }, // ’
-    { 6, 8, 8, 1, 4, 12, 44996 }, // ‚
-    { 6, 7, 8, 1, 21, 11, 45008 }, // ‛
-    { 12, 7, 14, 1, 21, 21, 45019 }, // “
-    { 12, 7, 14, 1, 21, 21, 45040 }, // ”
-    { 6, 8, 8, 1, 4, 12, 45061 }, // „
-    { 13, 8, 15, 1, 21, 26, 45073 }, // ‟
-    { 14, 33, 15, 0, 26, 116, 45099 }, // †
-    { 13, 33, 15, 1, 26, 108, 45215 }, // ‡
-    { 15, 15, 15, -1, 18, 57, 45323 }, // •
-    { 7, 8, 10, 1, 11, 14, 45380 }, // ‣
-    { 5, 5, 7, 1, 5, 7, 45394 }, // ․
-    { 5, 5, 7, 1, 5, 7, 45401 }, // ‥
-    { 22, 5, 24, 1, 5, 28, 45408 }, // …
-    { 4, 3, 6, 1, 9, 3, 45436 }, // ‧
-    { 0, 0, 32, 0, 0, 0, 45439 }, //  
-    { 16, 22, 28, 6, 20, 88, 45439 }, // ‰
-    { 6, 7, 8, 1, 21, 11, 45527 }, // ′
-    { 12, 7, 14, 1, 21, 21, 45538 }, // ″
-    { 19, 8, 21, 1, 21, 38, 45559 }, // ‴
-    { 6, 7, 8, 1, 21, 11, 45597 }, // ‵
-    { 12, 7, 13, 0, 21, 21, 45608 }, // ‶
-    { 19, 8, 21, 1, 21, 38, 45629 }, // ‷
-    { 11, 5, 14, 1, 20, 14, 45667 }, // ‸
-    { 8, 12, 10, 1, 13, 24, 45681 }, // ‹
-    { 8, 12, 10, 1, 13, 24, 45705 }, // ›
-    { 26, 26, 33, 5, 23, 169, 45729 }, // ※
-    { 6, 25, 8, 1, 25, 38, 45898 }, // ‼
-    { 14, 31, 19, 2, 30, 109, 45936 }, // ‽
-    { 13, 3, 15, 1, 21, 10, 46045 }, // ‾
-    { 11, 5, 14, 1, 17, 14, 46055 }, // ‿
-    { 17, 16, 20, 1, 22, 68, 46069 }, // ⁂
-    { 15, 20, 28, 6, 19, 75, 46137 }, // ⁄
-    { 28, 28, 32, 2, 28, 196, 46212 }, // ⁇
-    { 19, 28, 25, 2, 28, 133, 46408 }, // ⁈
-    { 19, 30, 21, 1, 28, 143, 46541 }, // ⁉
-    { 15, 39, 19, 2, 27, 147, 46684 }, // ⁒
-    { 0, 0, 121, 0, 0, 0, 46831 }, //  
-    { 7, 10, 8, 0, 21, 18, 46831 }, // ⁰
-    { 8, 10, 9, 0, 21, 20, 46849 }, // ⁴
-    { 6, 10, 8, 1, 21, 15, 46869 }, // ⁵
-    { 8, 9, 9, 0, 20, 18, 46884 }, // ⁶
-    { 7, 10, 9, 1, 21, 18, 46902 }, // ⁷
-    { 8, 10, 9, 0, 21, 20, 46920 }, // ⁸
-    { 8, 9, 9, 0, 20, 18, 46940 }, // ⁹
-    { 14, 14, 20, 3, 14, 49, 46958 }, // ⁿ
-    { 9, 13, 11, 1, 13, 30, 47007 }, // ₀
-    { 6, 10, 8, 1, 6, 15, 47037 }, // ₁
-    { 7, 10, 9, 1, 6, 18, 47052 }, // ₂
-    { 8, 9, 9, 0, 5, 18, 47070 }, // ₃
-    { 8, 10, 9, 0, 6, 20, 47088 }, // ₄
-    { 7, 10, 8, 0, 6, 18, 47108 }, // ₅
-    { 8, 9, 9, 0, 5, 18, 47126 }, // ₆
-    { 7, 11, 9, 1, 6, 20, 47144 }, // ₇
-    { 8, 10, 9, 0, 6, 20, 47164 }, // ₈
-    { 8, 9, 9, 0, 5, 18, 47184 }, // ₉
-    { 8, 34, 11, 2, 25, 68, 47202 }, // ₍
-    { 8, 34, 11, 1, 25, 68, 47270 }, // ₎
-    { 17, 31, 25, 4, 26, 132, 47338 }, // ₡
-    { 18, 23, 25, 3, 22, 104, 47470 }, // ₢
-    { 16, 24, 18, 1, 24, 96, 47574 }, // ₤
-    { 24, 22, 27, 2, 22, 132, 47670 }, // ₦
-    { 20, 21, 23, 1, 21, 105, 47802 }, // ₧
-    { 25, 21, 29, 3, 21, 132, 47907 }, // ₨
-    { 19, 21, 21, 1, 21, 100, 48039 }, // ₩
-    { 20, 19, 27, 3, 19, 95, 48139 }, // ₪
-    { 17, 20, 19, 1, 20, 85, 48234 }, // ₫
-    { 15, 23, 19, 2, 20, 87, 48319 }, // €
-    { 19, 21, 27, 4, 21, 100, 48406 }, // ₮
-    { 22, 21, 23, 0, 21, 116, 48506 }, // ₱
-    { 20, 30, 29, 4, 26, 150, 48622 }, // ₲
-    { 23, 23, 25, 1, 22, 133, 48772 }, // ₴
-    { 12, 18, 19, 3, 17, 54, 48905 }, // ₵
-    { 19, 22, 27, 4, 22, 105, 48959 }, // ₸
-    { 13, 20, 15, 1, 19, 65, 49064 }, // ₹
-    { 15, 18, 17, 1, 17, 68, 49129 }, // ₺
-    { 16, 19, 17, 0, 19, 76, 49197 }, // ₼
-    { 20, 21, 23, -1, 21, 105, 49273 }, // ₽
-    { 16, 16, 19, 1, 14, 64, 49378 }, // ←
-    { 17, 15, 19, 1, 15, 64, 49442 }, // ↑
-    { 16, 16, 19, 1, 14, 64, 49506 }, // →
-    { 17, 15, 19, 1, 15, 64, 49570 }, // ↓
-    { 20, 14, 22, 1, 14, 70, 49634 }, // ↔
-    { 14, 19, 16, 1, 20, 67, 49704 }, // ↕
-    { 13, 12, 16, 1, 13, 39, 49771 }, // ↖
-    { 13, 12, 16, 1, 13, 39, 49810 }, // ↗
-    { 13, 13, 16, 1, 14, 43, 49849 }, // ↘
-    { 13, 13, 16, 1, 14, 43, 49892 }, // ↙
-    { 19, 16, 21, 1, 15, 76, 49935 }, // ⇐
-    { 20, 18, 23, 1, 18, 90, 50011 }, // ⇑
-    { 19, 16, 21, 1, 15, 76, 50101 }, // ⇒
-    { 20, 19, 23, 1, 18, 95, 50177 }, // ⇓
-    { 22, 16, 24, 1, 15, 88, 50272 }, // ⇔
-    { 17, 21, 19, 1, 14, 90, 50360 }, // ⇕
-    { 15, 20, 17, 1, 20, 75, 50450 }, // ∂
-    { 25, 23, 29, 2, 22, 144, 50525 }, // ∅
-    { 19, 19, 22, 1, 19, 91, 50669 }, // ∆
-    { 16, 18, 18, 1, 18, 72, 50760 }, // ∏
-    { 16, 18, 18, 1, 18, 72, 50832 }, // ∐
-    { 12, 19, 15, 1, 18, 57, 50904 }, // ∑
-    { 13, 4, 15, 1, 9, 13, 50961 }, // −
-    { 21, 21, 23, 1, 20, 111, 50974 }, // √
-    { 20, 12, 23, 1, 15, 60, 51085 }, // ∞
-    { 21, 28, 22, 0, 22, 147, 51145 }, // ∫
-    { 5, 15, 7, 1, 15, 19, 51292 }, // ∶
-    { 15, 13, 19, 2, 14, 49, 51311 }, // ≈
-    { 16, 22, 28, 6, 20, 88, 51360 }, // ≠
-    { 19, 19, 22, 1, 18, 91, 51448 }, // ≤
-    { 19, 19, 22, 1, 18, 91, 51539 }, // ≥
+    { 6, 25, 8, 1, 25, 32, 0 }, // !
+    { 12, 7, 14, 1, 21, 20, 32 }, // "
+    { 26, 22, 28, 1, 20, 77, 52 }, // #
+    { 21, 27, 30, 5, 24, 117, 129 }, // $
+    { 17, 21, 25, 5, 20, 77, 246 }, // %
+    { 20, 22, 24, 2, 21, 74, 323 }, // &
+    { 5, 8, 7, 1, 19, 10, 397 }, // '
+    { 8, 34, 11, 2, 25, 51, 407 }, // (
+    { 8, 34, 11, 1, 25, 51, 458 }, // )
+    { 13, 12, 16, 1, 19, 36, 509 }, // *
+    { 13, 12, 16, 1, 13, 21, 545 }, // +
+    { 6, 8, 8, 1, 4, 15, 566 }, // ,
+    { 13, 3, 15, 1, 9, 11, 581 }, // -
+    { 5, 5, 7, 1, 5, 6, 592 }, // .
+    { 15, 39, 16, 0, 27, 78, 598 }, // /
+    { 14, 19, 17, 1, 19, 63, 676 }, // 0
+    { 12, 19, 15, 1, 19, 42, 739 }, // 1
+    { 13, 19, 16, 1, 19, 46, 781 }, // 2
+    { 13, 19, 16, 1, 19, 45, 827 }, // 3
+    { 14, 19, 17, 1, 19, 47, 872 }, // 4
+    { 13, 19, 16, 1, 19, 52, 919 }, // 5
+    { 14, 19, 17, 1, 19, 54, 971 }, // 6
+    { 13, 19, 16, 1, 19, 37, 1025 }, // 7
+    { 15, 19, 17, 1, 19, 58, 1062 }, // 8
+    { 14, 19, 17, 1, 19, 58, 1120 }, // 9
+    { 5, 15, 7, 1, 15, 18, 1178 }, // :
+    { 6, 18, 8, 1, 14, 25, 1196 }, // ;
+    { 18, 15, 20, 1, 16, 41, 1221 }, // <
+    { 13, 9, 15, 1, 11, 17, 1262 }, // =
+    { 18, 15, 20, 1, 16, 39, 1279 }, // >
+    { 14, 28, 15, 0, 28, 56, 1318 }, // ?
+    { 22, 21, 30, 3, 20, 96, 1374 }, // @
+    { 20, 21, 28, 4, 21, 70, 1470 }, // A
+    { 16, 22, 24, 4, 22, 73, 1540 }, // B
+    { 18, 23, 25, 3, 22, 54, 1613 }, // C
+    { 20, 22, 27, 4, 22, 87, 1667 }, // D
+    { 15, 22, 23, 4, 22, 49, 1754 }, // E
+    { 13, 22, 21, 4, 22, 50, 1803 }, // F
+    { 20, 22, 29, 4, 22, 70, 1853 }, // G
+    { 19, 22, 27, 4, 22, 71, 1923 }, // H
+    { 5, 22, 11, 3, 22, 25, 1994 }, // I
+    { 11, 28, 19, 4, 22, 45, 2019 }, // J
+    { 17, 21, 26, 4, 21, 67, 2064 }, // K
+    { 14, 22, 23, 4, 22, 50, 2131 }, // L
+    { 23, 22, 31, 4, 22, 100, 2181 }, // M
+    { 19, 22, 27, 4, 22, 82, 2281 }, // N
+    { 20, 22, 29, 4, 21, 77, 2363 }, // O
+    { 15, 21, 23, 4, 21, 56, 2440 }, // P
+    { 21, 26, 25, 2, 22, 91, 2496 }, // Q
+    { 16, 22, 24, 4, 22, 64, 2587 }, // R
+    { 20, 23, 28, 4, 22, 64, 2651 }, // S
+    { 19, 21, 27, 4, 21, 48, 2715 }, // T
+    { 18, 23, 26, 4, 22, 75, 2763 }, // U
+    { 21, 22, 29, 4, 22, 69, 2838 }, // V
+    { 27, 21, 36, 4, 21, 95, 2907 }, // W
+    { 20, 22, 28, 4, 22, 64, 3002 }, // X
+    { 18, 21, 27, 4, 21, 52, 3066 }, // Y
+    { 20, 21, 28, 4, 21, 65, 3118 }, // Z
+    { 9, 35, 12, 1, 27, 55, 3183 }, // [
+    { 9, 24, 12, 1, 19, 35, 3238 }, // <backslash>
+    { 9, 35, 12, 1, 27, 58, 3273 }, // ]
+    { 11, 5, 14, 1, 23, 13, 3331 }, // ^
+    { 17, 4, 20, 1, -2, 13, 3344 }, // _
+    { 8, 4, 10, 1, 19, 7, 3357 }, // `
+    { 14, 15, 21, 3, 15, 43, 3364 }, // a
+    { 15, 23, 21, 3, 22, 56, 3407 }, // b
+    { 12, 16, 19, 3, 15, 30, 3463 }, // c
+    { 15, 22, 21, 3, 21, 59, 3493 }, // d
+    { 14, 15, 21, 3, 15, 42, 3552 }, // e
+    { 9, 20, 16, 3, 20, 36, 3594 }, // f
+    { 14, 21, 20, 3, 14, 57, 3630 }, // g
+    { 14, 21, 21, 3, 21, 56, 3687 }, // h
+    { 5, 22, 11, 3, 22, 31, 3743 }, // i
+    { 10, 27, 16, 3, 21, 40, 3774 }, // j
+    { 14, 20, 20, 3, 20, 45, 3814 }, // k
+    { 7, 21, 14, 3, 21, 35, 3859 }, // l
+    { 23, 14, 29, 3, 14, 68, 3894 }, // m
+    { 14, 14, 20, 3, 14, 43, 3962 }, // n
+    { 14, 14, 21, 3, 14, 42, 4005 }, // o
+    { 15, 21, 20, 2, 14, 62, 4047 }, // p
+    { 17, 21, 24, 3, 15, 60, 4109 }, // q
+    { 10, 14, 16, 3, 14, 22, 4169 }, // r
+    { 13, 14, 19, 3, 14, 35, 4191 }, // s
+    { 11, 19, 18, 3, 19, 36, 4226 }, // t
+    { 14, 15, 20, 3, 14, 40, 4262 }, // u
+    { 16, 14, 23, 3, 14, 40, 4302 }, // v
+    { 20, 14, 26, 3, 14, 55, 4342 }, // w
+    { 16, 14, 22, 3, 14, 39, 4397 }, // x
+    { 15, 21, 21, 3, 14, 52, 4436 }, // y
+    { 14, 14, 20, 3, 14, 34, 4488 }, // z
+    { 12, 24, 14, 1, 19, 44, 4522 }, // {
+    { 4, 22, 6, 1, 18, 30, 4566 }, // |
+    { 12, 24, 14, 1, 19, 46, 4596 }, // }
+    { 10, 5, 12, 1, 19, 17, 4642 }, // ~
+    { 0, 0, 21, 0, 0, 0, 4659 }, //  
+    { 6, 25, 8, 1, 19, 32, 4659 }, // ¡
+    { 12, 22, 19, 3, 19, 52, 4691 }, // ¢
+    { 16, 24, 18, 1, 24, 59, 4743 }, // £
+    { 14, 14, 17, 1, 16, 39, 4802 }, // ¤
+    { 17, 21, 19, 1, 18, 50, 4841 }, // ¥
+    { 4, 22, 6, 1, 18, 25, 4891 }, // ¦
+    { 15, 23, 21, 3, 20, 61, 4916 }, // §
+    { 12, 5, 14, 1, 20, 12, 4977 }, // ¨
+    { 11, 10, 13, 1, 23, 37, 4989 }, // ©
+    { 8, 9, 11, 2, 19, 22, 5026 }, // ª
+    { 13, 12, 16, 1, 12, 37, 5048 }, // «
+    { 13, 8, 15, 1, 9, 20, 5085 }, // ¬
+    { 13, 3, 15, 1, 9, 11, 5105 }, // ­
+    { 11, 10, 13, 1, 27, 40, 5116 }, // ®
+    { 10, 3, 13, 1, 18, 7, 5156 }, // ¯
+    { 12, 12, 14, 1, 20, 31, 5163 }, // °
+    { 13, 14, 16, 1, 13, 30, 5194 }, // ±
+    { 7, 9, 8, 0, 20, 17, 5224 }, // ²
+    { 7, 10, 8, 0, 20, 18, 5241 }, // ³
+    { 5, 5, 7, 1, 19, 8, 5259 }, // ´
+    { 15, 17, 20, 2, 14, 48, 5267 }, // µ
+    { 13, 21, 15, 1, 18, 61, 5315 }, // ¶
+    { 5, 5, 7, 1, 11, 6, 5376 }, // ·
+    { 6, 7, 8, 1, 1, 12, 5382 }, // ¸
+    { 7, 10, 8, 0, 21, 15, 5394 }, // ¹
+    { 8, 8, 11, 2, 18, 22, 5409 }, // º
+    { 13, 12, 16, 1, 12, 36, 5431 }, // »
+    { 21, 24, 28, 4, 22, 93, 5467 }, // ¼
+    { 22, 23, 28, 4, 21, 90, 5560 }, // ½
+    { 22, 24, 28, 3, 22, 94, 5650 }, // ¾
+    { 14, 28, 15, 0, 15, 57, 5744 }, // ¿
+    { 20, 28, 28, 4, 28, 85, 5801 }, // À
+    { 20, 33, 28, 4, 33, 90, 5886 }, // Á
+    { 20, 29, 28, 4, 29, 88, 5976 }, // Â
+    { 20, 29, 28, 4, 29, 92, 6064 }, // Ã
+    { 20, 29, 28, 4, 29, 90, 6156 }, // Ä
+    { 20, 30, 28, 4, 30, 90, 6246 }, // Å
+    { 28, 23, 36, 4, 22, 86, 6336 }, // Æ
+    { 18, 28, 25, 3, 22, 68, 6422 }, // Ç
+    { 15, 28, 23, 4, 28, 60, 6490 }, // È
+    { 15, 32, 23, 4, 32, 64, 6550 }, // É
+    { 15, 29, 23, 4, 29, 67, 6614 }, // Ê
+    { 15, 29, 23, 4, 29, 63, 6681 }, // Ë
+    { 8, 30, 11, 0, 30, 38, 6744 }, // Ì
+    { 5, 34, 11, 3, 34, 36, 6782 }, // Í
+    { 10, 31, 11, 0, 31, 44, 6818 }, // Î
+    { 12, 30, 12, -1, 30, 51, 6862 }, // Ï
+    { 23, 22, 27, 1, 22, 91, 6913 }, // Ð
+    { 19, 27, 27, 4, 27, 102, 7004 }, // Ñ
+    { 20, 28, 29, 4, 27, 90, 7106 }, // Ò
+    { 20, 32, 29, 4, 31, 96, 7196 }, // Ó
+    { 20, 29, 29, 4, 28, 94, 7292 }, // Ô
+    { 20, 28, 29, 4, 27, 99, 7386 }, // Õ
+    { 20, 29, 29, 4, 28, 94, 7485 }, // Ö
+    { 12, 7, 15, 1, 10, 17, 7579 }, // ×
+    { 31, 45, 31, -1, 33, 167, 7596 }, // Ø
+    { 18, 30, 26, 4, 29, 87, 7763 }, // Ù
+    { 18, 34, 26, 4, 33, 93, 7850 }, // Ú
+    { 18, 31, 26, 4, 30, 95, 7943 }, // Û
+    { 18, 30, 26, 4, 29, 92, 8038 }, // Ü
+    { 18, 33, 27, 4, 33, 71, 8130 }, // Ý
+    { 12, 20, 14, 1, 20, 51, 8201 }, // Þ
+    { 15, 20, 17, 1, 20, 61, 8252 }, // ß
+    { 14, 20, 21, 3, 20, 51, 8313 }, // à
+    { 14, 24, 21, 3, 24, 57, 8364 }, // á
+    { 14, 21, 21, 3, 21, 57, 8421 }, // â
+    { 14, 20, 21, 3, 20, 60, 8478 }, // ã
+    { 14, 20, 21, 3, 20, 56, 8538 }, // ä
+    { 14, 22, 21, 3, 22, 61, 8594 }, // å
+    { 24, 15, 31, 3, 15, 73, 8655 }, // æ
+    { 12, 21, 19, 3, 15, 41, 8728 }, // ç
+    { 14, 23, 21, 3, 23, 54, 8769 }, // è
+    { 14, 27, 21, 3, 27, 57, 8823 }, // é
+    { 14, 24, 21, 3, 24, 57, 8880 }, // ê
+    { 14, 24, 21, 3, 24, 58, 8937 }, // ë
+    { 9, 21, 11, 0, 21, 33, 8995 }, // ì
+    { 6, 25, 11, 3, 25, 33, 9028 }, // í
+    { 11, 22, 12, 0, 22, 37, 9061 }, // î
+    { 12, 22, 12, -1, 22, 46, 9098 }, // ï
+    { 19, 20, 21, 1, 20, 63, 9144 }, // ð
+    { 14, 21, 20, 3, 21, 62, 9207 }, // ñ
+    { 14, 23, 21, 3, 23, 55, 9269 }, // ò
+    { 14, 27, 21, 3, 27, 59, 9324 }, // ó
+    { 14, 23, 21, 3, 23, 60, 9383 }, // ô
+    { 14, 23, 21, 3, 23, 61, 9443 }, // õ
+    { 14, 23, 21, 3, 23, 60, 9504 }, // ö
+    { 17, 16, 19, 1, 16, 32, 9564 }, // ÷
+    { 14, 39, 21, 3, 26, 99, 9596 }, // ø
+    { 14, 22, 20, 3, 21, 52, 9695 }, // ù
+    { 14, 26, 20, 3, 25, 54, 9747 }, // ú
+    { 14, 23, 20, 3, 22, 54, 9801 }, // û
+    { 14, 22, 20, 3, 21, 53, 9855 }, // ü
+    { 15, 34, 21, 3, 27, 68, 9908 }, // ý
+    { 12, 26, 14, 1, 21, 64, 9976 }, // þ
+    { 15, 30, 21, 3, 23, 68, 10040 }, // ÿ
+    { 20, 28, 28, 4, 28, 84, 10108 }, // Ā
+    { 14, 19, 21, 3, 19, 51, 10192 }, // ā
+    { 20, 31, 28, 4, 31, 95, 10243 }, // Ă
+    { 14, 22, 21, 3, 22, 59, 10338 }, // ă
+    { 20, 27, 28, 4, 21, 86, 10397 }, // Ą
+    { 14, 20, 21, 3, 15, 54, 10483 }, // ą
+    { 18, 33, 25, 3, 32, 71, 10537 }, // Ć
+    { 12, 24, 19, 3, 23, 43, 10608 }, // ć
+    { 18, 31, 25, 3, 30, 74, 10651 }, // Ĉ
+    { 12, 22, 19, 3, 21, 42, 10725 }, // ĉ
+    { 18, 32, 25, 3, 31, 68, 10767 }, // Ċ
+    { 12, 23, 19, 3, 22, 40, 10835 }, // ċ
+    { 18, 33, 25, 3, 32, 74, 10875 }, // Č
+    { 12, 24, 19, 3, 23, 47, 10949 }, // č
+    { 20, 31, 27, 4, 31, 105, 10996 }, // Ď
+    { 20, 22, 24, 3, 21, 69, 11101 }, // ď
+    { 23, 22, 27, 1, 22, 91, 11170 }, // Đ
+    { 19, 22, 23, 3, 21, 66, 11261 }, // đ
+    { 15, 28, 23, 4, 28, 59, 11327 }, // Ē
+    { 14, 23, 21, 3, 23, 53, 11386 }, // ē
+    { 15, 30, 23, 4, 30, 67, 11439 }, // Ĕ
+    { 14, 26, 21, 3, 26, 63, 11506 }, // ĕ
+    { 15, 30, 23, 4, 30, 62, 11569 }, // Ė
+    { 14, 25, 21, 3, 25, 54, 11631 }, // ė
+    { 15, 27, 23, 4, 22, 59, 11685 }, // Ę
+    { 14, 21, 21, 3, 15, 59, 11744 }, // ę
+    { 15, 31, 23, 4, 31, 66, 11803 }, // Ě
+    { 14, 26, 21, 3, 26, 63, 11869 }, // ě
+    { 20, 29, 29, 4, 29, 89, 11932 }, // Ĝ
+    { 14, 28, 20, 3, 21, 74, 12021 }, // ĝ
+    { 20, 31, 29, 4, 31, 91, 12095 }, // Ğ
+    { 14, 30, 20, 3, 23, 76, 12186 }, // ğ
+    { 20, 30, 29, 4, 30, 84, 12262 }, // Ġ
+    { 14, 29, 20, 3, 22, 68, 12346 }, // ġ
+    { 20, 33, 29, 4, 22, 88, 12414 }, // Ģ
+    { 14, 30, 20, 3, 23, 72, 12502 }, // ģ
+    { 19, 29, 27, 4, 29, 88, 12574 }, // Ĥ
+    { 16, 27, 21, 1, 27, 71, 12662 }, // ĥ
+    { 20, 21, 27, 3, 21, 75, 12733 }, // Ħ
+    { 16, 21, 21, 1, 21, 59, 12808 }, // ħ
+    { 10, 31, 11, 0, 31, 45, 12867 }, // Ĩ
+    { 10, 22, 12, 1, 22, 41, 12912 }, // ĩ
+    { 12, 29, 12, -1, 29, 44, 12953 }, // Ī
+    { 12, 20, 13, 0, 20, 39, 12997 }, // ī
+    { 6, 28, 15, 6, 22, 43, 13036 }, // Į
+    { 6, 28, 11, 2, 22, 40, 13079 }, // į
+    { 5, 31, 11, 3, 31, 34, 13119 }, // İ
+    { 5, 14, 11, 3, 14, 23, 13153 }, // ı
+    { 16, 28, 23, 3, 22, 74, 13176 }, // Ĳ
+    { 19, 29, 23, 3, 22, 86, 13250 }, // ĳ
+    { 12, 33, 19, 4, 27, 59, 13336 }, // Ĵ
+    { 13, 27, 17, 3, 21, 53, 13395 }, // ĵ
+    { 17, 30, 26, 4, 21, 86, 13448 }, // Ķ
+    { 14, 31, 20, 3, 20, 63, 13534 }, // ķ
+    { 12, 14, 16, 2, 14, 37, 13597 }, // ĸ
+    { 14, 30, 23, 4, 30, 64, 13634 }, // Ĺ
+    { 7, 29, 14, 3, 29, 45, 13698 }, // ĺ
+    { 14, 33, 23, 4, 22, 67, 13743 }, // Ļ
+    { 7, 32, 14, 3, 21, 48, 13810 }, // ļ
+    { 14, 22, 23, 4, 22, 54, 13858 }, // Ľ
+    { 10, 22, 14, 3, 22, 45, 13912 }, // ľ
+    { 14, 22, 23, 4, 22, 56, 13957 }, // Ŀ
+    { 11, 21, 15, 3, 21, 42, 14013 }, // ŀ
+    { 24, 34, 23, -6, 27, 104, 14055 }, // Ł
+    { 16, 21, 14, -5, 21, 54, 14159 }, // ł
+    { 19, 30, 27, 4, 30, 97, 14213 }, // Ń
+    { 14, 24, 20, 3, 24, 57, 14310 }, // ń
+    { 19, 31, 27, 4, 22, 99, 14367 }, // Ņ
+    { 14, 23, 20, 3, 14, 61, 14466 }, // ņ
+    { 19, 30, 27, 4, 30, 99, 14527 }, // Ň
+    { 14, 24, 20, 3, 24, 60, 14626 }, // ň
+    { 14, 26, 17, 1, 26, 68, 14686 }, // ŉ
+    { 19, 26, 27, 4, 22, 93, 14754 }, // Ŋ
+    { 14, 19, 20, 3, 14, 52, 14847 }, // ŋ
+    { 20, 28, 29, 4, 27, 89, 14899 }, // Ō
+    { 14, 21, 21, 3, 21, 54, 14988 }, // ō
+    { 20, 30, 29, 4, 29, 98, 15042 }, // Ŏ
+    { 14, 25, 21, 3, 25, 62, 15140 }, // ŏ
+    { 21, 29, 29, 4, 28, 96, 15202 }, // Ő
+    { 19, 24, 22, 2, 24, 65, 15298 }, // ő
+    { 29, 21, 34, 4, 21, 97, 15363 }, // Œ
+    { 25, 15, 29, 3, 15, 74, 15460 }, // œ
+    { 16, 29, 24, 4, 29, 77, 15534 }, // Ŕ
+    { 10, 21, 16, 3, 21, 31, 15611 }, // ŕ
+    { 16, 34, 24, 4, 22, 86, 15642 }, // Ŗ
+    { 11, 27, 16, 2, 14, 36, 15728 }, // ŗ
+    { 16, 30, 24, 4, 30, 80, 15764 }, // Ř
+    { 11, 21, 16, 2, 21, 35, 15844 }, // ř
+    { 20, 33, 28, 4, 32, 84, 15879 }, // Ś
+    { 13, 23, 19, 3, 23, 48, 15963 }, // ś
+    { 20, 31, 28, 4, 30, 86, 16011 }, // Ŝ
+    { 13, 21, 19, 3, 21, 48, 16097 }, // ŝ
+    { 20, 28, 28, 4, 22, 77, 16145 }, // Ş
+    { 13, 21, 19, 3, 14, 47, 16222 }, // ş
+    { 20, 33, 28, 4, 32, 86, 16269 }, // Š
+    { 13, 23, 19, 3, 23, 50, 16355 }, // š
+    { 19, 26, 27, 4, 21, 61, 16405 }, // Ţ
+    { 12, 24, 18, 3, 19, 50, 16466 }, // ţ
+    { 19, 29, 27, 4, 29, 65, 16516 }, // Ť
+    { 12, 21, 18, 3, 21, 47, 16581 }, // ť
+    { 19, 21, 27, 4, 21, 52, 16628 }, // Ŧ
+    { 12, 19, 18, 2, 19, 43, 16680 }, // ŧ
+    { 18, 31, 26, 4, 30, 95, 16723 }, // Ũ
+    { 14, 23, 20, 3, 22, 58, 16818 }, // ũ
+    { 18, 29, 26, 4, 28, 83, 16876 }, // Ū
+    { 14, 21, 20, 3, 20, 49, 16959 }, // ū
+    { 18, 32, 26, 4, 31, 96, 17008 }, // Ŭ
+    { 14, 24, 20, 3, 23, 58, 17104 }, // ŭ
+    { 18, 32, 26, 4, 31, 95, 17162 }, // Ů
+    { 14, 24, 20, 3, 23, 56, 17257 }, // ů
+    { 20, 31, 26, 4, 30, 95, 17313 }, // Ű
+    { 19, 23, 21, 1, 22, 62, 17408 }, // ű
+    { 18, 27, 26, 4, 22, 85, 17470 }, // Ų
+    { 14, 20, 20, 3, 14, 53, 17555 }, // ų
+    { 27, 28, 36, 4, 28, 114, 17608 }, // Ŵ
+    { 20, 22, 26, 3, 22, 74, 17722 }, // ŵ
+    { 18, 30, 27, 4, 30, 73, 17796 }, // Ŷ
+    { 15, 31, 21, 3, 24, 71, 17869 }, // ŷ
+    { 18, 30, 27, 4, 30, 70, 17940 }, // Ÿ
+    { 20, 30, 28, 4, 30, 82, 18010 }, // Ź
+    { 14, 23, 20, 3, 23, 47, 18092 }, // ź
+    { 20, 29, 28, 4, 29, 79, 18139 }, // Ż
+    { 14, 22, 20, 3, 22, 45, 18218 }, // ż
+    { 20, 30, 28, 4, 30, 85, 18263 }, // Ž
+    { 14, 23, 20, 3, 23, 50, 18348 }, // ž
+    { 9, 20, 13, 3, 20, 28, 18398 }, // ſ
+    { 22, 24, 29, 4, 23, 85, 18426 }, // Ơ
+    { 16, 15, 21, 3, 15, 48, 18511 }, // ơ
+    { 18, 21, 23, 1, 21, 62, 18559 }, // Ƥ
+    { 15, 25, 20, 2, 18, 70, 18621 }, // ƥ
+    { 12, 19, 15, 1, 18, 38, 18691 }, // Ʃ
+    { 19, 21, 27, 4, 21, 49, 18729 }, // Ƭ
+    { 11, 22, 18, 3, 22, 43, 18778 }, // ƭ
+    { 19, 26, 27, 4, 21, 62, 18821 }, // Ʈ
+    { 20, 26, 26, 4, 25, 80, 18883 }, // Ư
+    { 16, 17, 20, 3, 16, 45, 18963 }, // ư
+    { 8, 4, 10, 1, 19, 7, 19008 }, // ̀
+    { 5, 5, 7, 1, 19, 8, 19015 }, // ́
+    { 11, 5, 13, 1, 0, 13, 19023 }, // ̂
+    { 10, 5, 12, 1, 19, 17, 19036 }, // ̃
+    { 12, 4, 15, 2, 17, 8, 19053 }, // ̄
+    { 17, 3, 19, 1, 22, 12, 19061 }, // ̅
+    { 11, 5, 13, 1, 18, 15, 19073 }, // ̆
+    { 5, 5, 7, 1, 20, 6, 19088 }, // ̇
+    { 12, 5, 14, 1, 20, 12, 19094 }, // ̈
+    { 6, 5, 7, 0, 16, 9, 19106 }, // ̉
+    { 6, 5, 8, 1, 19, 13, 19115 }, // ̊
+    { 19, 4, 21, 1, 19, 16, 19128 }, // ̋
+    { 11, 5, 13, 1, 19, 14, 19144 }, // ̌
+    { 19, 4, 15, -5, 20, 13, 19158 }, // ̏
+    { 6, 8, 8, 1, 19, 13, 19171 }, // ̒
+    { 6, 7, 8, 1, 18, 12, 19184 }, // ̓
+    { 6, 7, 8, 1, 18, 11, 19196 }, // ̔
+    { 5, 6, 7, 1, -1, 9, 19207 }, // ̘
+    { 5, 6, 7, 1, -1, 9, 19216 }, // ̙
+    { 11, 6, 13, 1, 20, 15, 19225 }, // ̚
+    { 4, 6, 6, 1, 16, 8, 19240 }, // ̛
+    { 4, 5, 6, 1, -2, 5, 19248 }, // ̜
+    { 7, 4, 9, 1, 3, 7, 19253 }, // ̝
+    { 7, 4, 9, 1, -1, 7, 19260 }, // ̞
+    { 6, 5, 8, 1, -2, 8, 19267 }, // ̟
+    { 13, 4, 15, 1, -3, 8, 19275 }, // ̠
+    { 5, 5, 7, 1, 1, 6, 19283 }, // ̣
+    { 12, 5, 14, 1, 0, 12, 19289 }, // ̤
+    { 6, 5, 8, 1, 19, 13, 19301 }, // ̥
+    { 6, 8, 8, 1, 4, 15, 19314 }, // ̦
+    { 6, 7, 8, 1, 1, 12, 19329 }, // ̧
+    { 6, 7, 8, 1, 1, 11, 19341 }, // ̨
+    { 4, 7, 6, 1, -1, 12, 19352 }, // ̩
+    { 9, 4, 11, 1, -1, 11, 19364 }, // ̪
+    { 11, 5, 13, 1, 0, 14, 19375 }, // ̬
+    { 11, 5, 13, 1, -1, 12, 19389 }, // ̭
+    { 10, 5, 12, 1, 19, 17, 19401 }, // ̰
+    { 10, 3, 12, 1, 18, 7, 19418 }, // ̱
+    { 11, 3, 13, 1, -2, 7, 19425 }, // ̲
+    { 10, 5, 12, 1, 19, 17, 19432 }, // ̴
+    { 13, 3, 15, 1, 9, 11, 19449 }, // ̵
+    { 4, 5, 6, 1, -2, 7, 19460 }, // ̹
+    { 9, 4, 11, 1, -1, 11, 19467 }, // ̺
+    { 8, 7, 10, 1, 0, 15, 19478 }, // ̻
+    { 9, 5, 11, 1, 0, 17, 19493 }, // ̼
+    { 6, 5, 9, 2, 19, 12, 19510 }, // ̽
+    { 10, 5, 12, 1, 19, 17, 19522 }, // ͂
+    { 4, 5, 6, 1, 21, 7, 19539 }, // ̓
+    { 12, 11, 14, 1, 26, 23, 19546 }, // ̈́
+    { 9, 5, 11, 1, 20, 15, 19569 }, // ͆
+    { 13, 9, 15, 1, 0, 17, 19584 }, // ͇
+    { 10, 7, 12, 1, 0, 25, 19601 }, // ͈
+    { 8, 7, 10, 1, -1, 8, 19626 }, // ͉
+    { 10, 15, 12, 1, 24, 31, 19634 }, // ͊
+    { 20, 11, 22, 1, 22, 36, 19665 }, // ͋
+    { 15, 13, 18, 2, 14, 43, 19701 }, // ͌
+    { 13, 5, 16, 2, -3, 10, 19744 }, // ͍
+    { 4, 4, 6, 1, 3, 6, 19754 }, // ͎
+    { 21, 5, 23, 1, 0, 19, 19760 }, // ͜
+    { 21, 5, 23, 1, 19, 17, 19779 }, // ͡
+    { 25, 6, 27, 1, -2, 24, 19796 }, // ͢
+    { 20, 21, 28, 4, 21, 70, 19820 }, // Α
+    { 16, 22, 24, 4, 22, 73, 19890 }, // Β
+    { 12, 21, 14, 1, 19, 43, 19963 }, // Γ
+    { 19, 19, 22, 1, 19, 60, 20006 }, // Δ
+    { 15, 22, 23, 4, 22, 49, 20066 }, // Ε
+    { 20, 21, 28, 4, 21, 65, 20115 }, // Ζ
+    { 19, 22, 27, 4, 22, 71, 20180 }, // Η
+    { 20, 22, 29, 4, 21, 81, 20251 }, // Θ
+    { 5, 22, 11, 3, 22, 25, 20332 }, // Ι
+    { 17, 21, 26, 4, 21, 67, 20357 }, // Κ
+    { 21, 22, 29, 4, 21, 69, 20424 }, // Λ
+    { 23, 22, 31, 4, 22, 100, 20493 }, // Μ
+    { 19, 22, 27, 4, 22, 82, 20593 }, // Ν
+    { 17, 18, 19, 1, 18, 35, 20675 }, // Ξ
+    { 20, 22, 29, 4, 21, 77, 20710 }, // Ο
+    { 13, 18, 16, 1, 18, 57, 20787 }, // Π
+    { 15, 21, 23, 4, 21, 56, 20844 }, // Ρ
+    { 12, 19, 15, 1, 18, 38, 20900 }, // Σ
+    { 19, 21, 27, 4, 21, 48, 20938 }, // Τ
+    { 18, 21, 27, 4, 21, 52, 20986 }, // Υ
+    { 25, 27, 35, 5, 24, 101, 21038 }, // Φ
+    { 20, 22, 28, 4, 22, 64, 21139 }, // Χ
+    { 18, 22, 20, 1, 20, 64, 21203 }, // Ψ
+    { 19, 20, 21, 1, 19, 72, 21267 }, // Ω
+    { 17, 16, 23, 3, 15, 48, 21339 }, // α
+    { 15, 30, 17, 1, 24, 77, 21387 }, // β
+    { 15, 22, 17, 1, 14, 55, 21464 }, // γ
+    { 15, 21, 17, 1, 21, 56, 21519 }, // δ
+    { 11, 13, 13, 1, 13, 31, 21575 }, // ε
+    { 13, 21, 14, 0, 18, 46, 21606 }, // ζ
+    { 16, 22, 18, 1, 15, 56, 21652 }, // η
+    { 14, 19, 17, 1, 19, 55, 21708 }, // θ
+    { 7, 17, 13, 3, 17, 24, 21763 }, // ι
+    { 12, 15, 18, 3, 15, 39, 21787 }, // κ
+    { 15, 21, 19, 2, 21, 52, 21826 }, // λ
+    { 15, 17, 20, 2, 14, 48, 21878 }, // μ
+    { 15, 14, 17, 1, 14, 41, 21926 }, // ν
+    { 13, 21, 14, 0, 18, 45, 21967 }, // ξ
+    { 14, 14, 21, 3, 14, 42, 22012 }, // ο
+    { 15, 14, 18, 1, 13, 40, 22054 }, // π
+    { 16, 20, 18, 1, 14, 56, 22094 }, // ρ
+    { 11, 17, 14, 1, 18, 31, 22150 }, // ς
+    { 18, 14, 22, 3, 14, 44, 22181 }, // σ
+    { 14, 14, 16, 1, 13, 28, 22225 }, // τ
+    { 12, 15, 15, 1, 15, 42, 22253 }, // υ
+    { 20, 30, 29, 4, 27, 103, 22295 }, // φ
+    { 18, 19, 21, 1, 14, 61, 22398 }, // χ
+    { 13, 24, 16, 2, 18, 74, 22459 }, // ψ
+    { 18, 14, 20, 1, 13, 53, 22533 }, // ω
+    { 20, 29, 28, 4, 21, 84, 22586 }, // Ạ
+    { 14, 22, 21, 3, 15, 54, 22670 }, // ạ
+    { 20, 32, 28, 4, 32, 91, 22724 }, // Ả
+    { 14, 22, 21, 3, 22, 57, 22815 }, // ả
+    { 20, 35, 28, 4, 35, 105, 22872 }, // Ấ
+    { 15, 27, 21, 3, 27, 70, 22977 }, // ấ
+    { 21, 31, 28, 3, 31, 98, 23047 }, // Ầ
+    { 17, 24, 21, 0, 24, 66, 23145 }, // ầ
+    { 20, 34, 28, 4, 34, 100, 23211 }, // Ẩ
+    { 14, 25, 21, 3, 25, 66, 23311 }, // ẩ
+    { 20, 35, 28, 4, 35, 106, 23377 }, // Ẫ
+    { 14, 26, 21, 3, 26, 74, 23483 }, // ẫ
+    { 20, 37, 28, 4, 29, 101, 23557 }, // Ậ
+    { 14, 28, 21, 3, 21, 68, 23658 }, // ậ
+    { 20, 40, 28, 4, 40, 113, 23726 }, // Ắ
+    { 14, 31, 21, 3, 31, 73, 23839 }, // ắ
+    { 20, 38, 28, 4, 38, 110, 23912 }, // Ằ
+    { 14, 30, 21, 3, 30, 72, 24022 }, // ằ
+    { 20, 40, 28, 4, 40, 112, 24094 }, // Ẳ
+    { 14, 33, 21, 3, 33, 79, 24206 }, // ẳ
+    { 20, 39, 28, 4, 39, 115, 24285 }, // Ẵ
+    { 14, 30, 21, 3, 30, 76, 24400 }, // ẵ
+    { 20, 39, 28, 4, 31, 109, 24476 }, // Ặ
+    { 14, 29, 21, 3, 22, 70, 24585 }, // ặ
+    { 15, 28, 23, 4, 22, 59, 24655 }, // Ẹ
+    { 14, 22, 21, 3, 15, 53, 24714 }, // ẹ
+    { 15, 30, 23, 4, 30, 62, 24767 }, // Ẻ
+    { 14, 25, 21, 3, 25, 56, 24829 }, // ẻ
+    { 15, 29, 23, 4, 29, 68, 24885 }, // Ẽ
+    { 14, 24, 21, 3, 24, 63, 24953 }, // ẽ
+    { 16, 33, 23, 4, 33, 74, 25016 }, // Ế
+    { 16, 25, 21, 3, 25, 65, 25090 }, // ế
+    { 20, 30, 23, -1, 30, 84, 25155 }, // Ề
+    { 17, 27, 21, 0, 27, 70, 25239 }, // ề
+    { 16, 33, 23, 4, 33, 79, 25309 }, // Ể
+    { 14, 29, 21, 3, 29, 69, 25388 }, // ể
+    { 15, 34, 23, 4, 34, 82, 25457 }, // Ễ
+    { 14, 29, 21, 3, 29, 78, 25539 }, // ễ
+    { 15, 35, 23, 4, 29, 77, 25617 }, // Ệ
+    { 14, 31, 21, 3, 24, 69, 25694 }, // ệ
+    { 6, 32, 11, 3, 32, 38, 25763 }, // Ỉ
+    { 6, 23, 11, 3, 23, 34, 25801 }, // ỉ
+    { 5, 29, 11, 3, 22, 32, 25835 }, // Ị
+    { 5, 29, 11, 3, 22, 37, 25867 }, // ị
+    { 20, 29, 29, 4, 21, 88, 25904 }, // Ọ
+    { 14, 22, 21, 3, 14, 53, 25992 }, // ọ
+    { 20, 30, 29, 4, 29, 93, 26045 }, // Ỏ
+    { 14, 25, 21, 3, 25, 58, 26138 }, // ỏ
+    { 25, 29, 30, 4, 28, 106, 26196 }, // Ố
+    { 17, 24, 21, 3, 24, 67, 26302 }, // ố
+    { 21, 30, 29, 3, 29, 103, 26369 }, // Ồ
+    { 17, 26, 21, 0, 26, 72, 26472 }, // ồ
+    { 20, 33, 29, 4, 32, 106, 26544 }, // Ổ
+    { 14, 28, 21, 3, 28, 71, 26650 }, // ổ
+    { 20, 34, 29, 4, 33, 117, 26721 }, // Ỗ
+    { 14, 29, 21, 3, 29, 74, 26838 }, // ỗ
+    { 20, 36, 29, 4, 28, 105, 26912 }, // Ộ
+    { 14, 31, 21, 3, 23, 72, 27017 }, // ộ
+    { 22, 32, 29, 4, 31, 102, 27089 }, // Ớ
+    { 16, 25, 21, 3, 25, 63, 27191 }, // ớ
+    { 22, 30, 29, 4, 29, 98, 27254 }, // Ờ
+    { 16, 23, 21, 3, 23, 62, 27352 }, // ờ
+    { 22, 31, 29, 4, 30, 99, 27414 }, // Ở
+    { 16, 25, 21, 3, 25, 64, 27513 }, // ở
+    { 22, 30, 29, 4, 29, 107, 27577 }, // Ỡ
+    { 16, 24, 21, 3, 24, 68, 27684 }, // ỡ
+    { 22, 31, 29, 4, 23, 98, 27752 }, // Ợ
+    { 16, 23, 21, 3, 15, 59, 27850 }, // ợ
+    { 18, 29, 26, 4, 22, 85, 27909 }, // Ụ
+    { 14, 21, 20, 3, 14, 50, 27994 }, // ụ
+    { 18, 32, 26, 4, 31, 91, 28044 }, // Ủ
+    { 14, 24, 20, 3, 23, 55, 28135 }, // ủ
+    { 20, 32, 26, 4, 31, 94, 28190 }, // Ứ
+    { 16, 24, 20, 3, 23, 57, 28284 }, // ứ
+    { 20, 30, 26, 4, 29, 91, 28341 }, // Ừ
+    { 16, 23, 20, 3, 22, 55, 28432 }, // ừ
+    { 20, 32, 26, 4, 31, 94, 28487 }, // Ử
+    { 16, 24, 20, 3, 23, 59, 28581 }, // ử
+    { 20, 31, 26, 4, 30, 97, 28640 }, // Ữ
+    { 16, 23, 20, 3, 22, 62, 28737 }, // ữ
+    { 20, 32, 26, 4, 25, 90, 28799 }, // Ự
+    { 16, 23, 20, 3, 16, 55, 28889 }, // ự
+    { 18, 29, 27, 4, 29, 66, 28944 }, // Ỳ
+    { 15, 30, 21, 3, 23, 65, 29010 }, // ỳ
+    { 18, 32, 27, 4, 21, 68, 29075 }, // Ỵ
+    { 18, 22, 22, 3, 14, 61, 29143 }, // ỵ
+    { 18, 31, 27, 4, 31, 69, 29204 }, // Ỷ
+    { 15, 32, 21, 3, 25, 68, 29273 }, // ỷ
+    { 18, 30, 27, 4, 30, 76, 29341 }, // Ỹ
+    { 15, 31, 21, 3, 24, 74, 29417 }, // ỹ
+    { 0, 0, 21, 0, 0, 0, 29491 }, //  
+    { 0, 0, 33, 0, 0, 0, 29491 }, //  
+    { 0, 0, 21, 0, 0, 0, 29491 }, //  
+    { 0, 0, 33, 0, 0, 0, 29491 }, //  
+    { 0, 0, 16, 0, 0, 0, 29491 }, //  
+    { 0, 0, 14, 0, 0, 0, 29491 }, //  
+    { 0, 0, 12, 0, 0, 0, 29491 }, //  
+    { 0, 0, 17, 0, 0, 0, 29491 }, //  
+    { 0, 0, 7, 0, 0, 0, 29491 }, //  
+    { 0, 0, 13, 0, 0, 0, 29491 }, //  
+    { 0, 0, 12, 0, 0, 0, 29491 }, //  
+    { 0, 0, 8, 0, 0, 0, 29491 }, // ​
+    { 0, 0, 1, 0, 0, 0, 29491 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 29491 }, // ‍
+    { 0, 0, 1, 0, 0, 0, 29491 }, // ‎
+    { 0, 0, 1, 0, 0, 0, 29491 }, // ‏
+    { 13, 3, 15, 1, 9, 11, 29491 }, // ‐
+    { 13, 3, 15, 1, 9, 11, 29502 }, // ‑
+    { 18, 3, 20, 1, 9, 15, 29513 }, // ‒
+    { 17, 4, 20, 1, 9, 13, 29528 }, // –
+    { 26, 4, 28, 1, 9, 18, 29541 }, // —
+    { 26, 4, 28, 1, 9, 18, 29559 }, // ―
+    { 11, 22, 14, 1, 18, 66, 29577 }, // ‖
+    { 19, 8, 21, 1, -2, 35, 29643 }, // ‗
+    { 6, 7, 8, 1, 21, 10, 29678 }, // ‘
+    { 6, 7, 8, 1, 21, 12, 29688 }, // ’
+    { 6, 8, 8, 1, 4, 15, 29700 }, // ‚
+    { 6, 7, 8, 1, 21, 10, 29715 }, // ‛
+    { 12, 7, 14, 1, 21, 21, 29725 }, // “
+    { 12, 7, 14, 1, 21, 24, 29746 }, // ”
+    { 6, 8, 8, 1, 4, 15, 29770 }, // „
+    { 13, 8, 15, 1, 21, 20, 29785 }, // ‟
+    { 14, 33, 15, 0, 26, 57, 29805 }, // †
+    { 13, 33, 15, 1, 26, 56, 29862 }, // ‡
+    { 15, 15, 15, -1, 18, 37, 29918 }, // •
+    { 7, 8, 10, 1, 11, 11, 29955 }, // ‣
+    { 5, 5, 7, 1, 5, 6, 29966 }, // ․
+    { 5, 5, 7, 1, 5, 6, 29972 }, // ‥
+    { 22, 5, 24, 1, 5, 18, 29978 }, // …
+    { 4, 3, 6, 1, 9, 5, 29996 }, // ‧
+    { 0, 0, 32, 0, 0, 0, 30001 }, //  
+    { 16, 22, 28, 6, 20, 73, 30001 }, // ‰
+    { 6, 7, 8, 1, 21, 12, 30074 }, // ′
+    { 12, 7, 14, 1, 21, 24, 30086 }, // ″
+    { 19, 8, 21, 1, 21, 32, 30110 }, // ‴
+    { 6, 7, 8, 1, 21, 10, 30142 }, // ‵
+    { 12, 7, 13, 0, 21, 20, 30152 }, // ‶
+    { 19, 8, 21, 1, 21, 30, 30172 }, // ‷
+    { 11, 5, 14, 1, 20, 11, 30202 }, // ‸
+    { 8, 12, 10, 1, 13, 17, 30213 }, // ‹
+    { 8, 12, 10, 1, 13, 19, 30230 }, // ›
+    { 26, 26, 33, 5, 23, 102, 30249 }, // ※
+    { 6, 25, 8, 1, 25, 32, 30351 }, // ‼
+    { 14, 31, 19, 2, 30, 71, 30383 }, // ‽
+    { 13, 3, 15, 1, 21, 11, 30454 }, // ‾
+    { 11, 5, 14, 1, 17, 16, 30465 }, // ‿
+    { 17, 16, 20, 1, 22, 64, 30481 }, // ⁂
+    { 15, 20, 28, 6, 19, 40, 30545 }, // ⁄
+    { 28, 28, 32, 2, 28, 113, 30585 }, // ⁇
+    { 19, 28, 25, 2, 28, 90, 30698 }, // ⁈
+    { 19, 30, 21, 1, 28, 85, 30788 }, // ⁉
+    { 15, 39, 19, 2, 27, 87, 30873 }, // ⁒
+    { 0, 0, 121, 0, 0, 0, 30960 }, //  
+    { 7, 10, 8, 0, 21, 27, 30960 }, // ⁰
+    { 8, 10, 9, 0, 21, 19, 30987 }, // ⁴
+    { 6, 10, 8, 1, 21, 15, 31006 }, // ⁵
+    { 8, 9, 9, 0, 20, 19, 31021 }, // ⁶
+    { 7, 10, 9, 1, 21, 15, 31040 }, // ⁷
+    { 8, 10, 9, 0, 21, 27, 31055 }, // ⁸
+    { 8, 9, 9, 0, 20, 23, 31082 }, // ⁹
+    { 14, 14, 20, 3, 14, 43, 31105 }, // ⁿ
+    { 9, 13, 11, 1, 13, 41, 31148 }, // ₀
+    { 6, 10, 8, 1, 6, 16, 31189 }, // ₁
+    { 7, 10, 9, 1, 6, 17, 31205 }, // ₂
+    { 8, 9, 9, 0, 5, 16, 31222 }, // ₃
+    { 8, 10, 9, 0, 6, 20, 31238 }, // ₄
+    { 7, 10, 8, 0, 6, 16, 31258 }, // ₅
+    { 8, 9, 9, 0, 5, 20, 31274 }, // ₆
+    { 7, 11, 9, 1, 6, 16, 31294 }, // ₇
+    { 8, 10, 9, 0, 6, 27, 31310 }, // ₈
+    { 8, 9, 9, 0, 5, 23, 31337 }, // ₉
+    { 8, 34, 11, 2, 25, 51, 31360 }, // ₍
+    { 8, 34, 11, 1, 25, 51, 31411 }, // ₎
+    { 17, 31, 25, 4, 26, 110, 31462 }, // ₡
+    { 18, 23, 25, 3, 22, 61, 31572 }, // ₢
+    { 16, 24, 18, 1, 24, 62, 31633 }, // ₤
+    { 24, 22, 27, 2, 22, 81, 31695 }, // ₦
+    { 20, 21, 23, 1, 21, 60, 31776 }, // ₧
+    { 25, 21, 29, 3, 21, 93, 31836 }, // ₨
+    { 19, 21, 21, 1, 21, 85, 31929 }, // ₩
+    { 20, 19, 27, 3, 19, 85, 32014 }, // ₪
+    { 17, 20, 19, 1, 20, 53, 32099 }, // ₫
+    { 15, 23, 19, 2, 20, 54, 32152 }, // €
+    { 19, 21, 27, 4, 21, 62, 32206 }, // ₮
+    { 22, 21, 23, 0, 21, 65, 32268 }, // ₱
+    { 20, 30, 29, 4, 26, 98, 32333 }, // ₲
+    { 23, 23, 25, 1, 22, 88, 32431 }, // ₴
+    { 12, 18, 19, 3, 17, 46, 32519 }, // ₵
+    { 19, 22, 27, 4, 22, 59, 32565 }, // ₸
+    { 13, 20, 15, 1, 19, 43, 32624 }, // ₹
+    { 15, 18, 17, 1, 17, 46, 32667 }, // ₺
+    { 16, 19, 17, 0, 19, 76, 32713 }, // ₼
+    { 20, 21, 23, -1, 21, 66, 32789 }, // ₽
+    { 16, 16, 19, 1, 14, 34, 32855 }, // ←
+    { 17, 15, 19, 1, 15, 47, 32889 }, // ↑
+    { 16, 16, 19, 1, 14, 34, 32936 }, // →
+    { 17, 15, 19, 1, 15, 46, 32970 }, // ↓
+    { 20, 14, 22, 1, 14, 48, 33016 }, // ↔
+    { 14, 19, 16, 1, 20, 54, 33064 }, // ↕
+    { 13, 12, 16, 1, 13, 34, 33118 }, // ↖
+    { 13, 12, 16, 1, 13, 31, 33152 }, // ↗
+    { 13, 13, 16, 1, 14, 33, 33183 }, // ↘
+    { 13, 13, 16, 1, 14, 32, 33216 }, // ↙
+    { 19, 16, 21, 1, 15, 36, 33248 }, // ⇐
+    { 20, 18, 23, 1, 18, 75, 33284 }, // ⇑
+    { 19, 16, 21, 1, 15, 36, 33359 }, // ⇒
+    { 20, 19, 23, 1, 18, 71, 33395 }, // ⇓
+    { 22, 16, 24, 1, 15, 53, 33466 }, // ⇔
+    { 17, 21, 19, 1, 14, 73, 33519 }, // ⇕
+    { 15, 20, 17, 1, 20, 54, 33592 }, // ∂
+    { 25, 23, 29, 2, 22, 92, 33646 }, // ∅
+    { 19, 19, 22, 1, 19, 60, 33738 }, // ∆
+    { 16, 18, 18, 1, 18, 55, 33798 }, // ∏
+    { 16, 18, 18, 1, 18, 55, 33853 }, // ∐
+    { 12, 19, 15, 1, 18, 38, 33908 }, // ∑
+    { 13, 4, 15, 1, 9, 8, 33946 }, // −
+    { 21, 21, 23, 1, 20, 57, 33954 }, // √
+    { 20, 12, 23, 1, 15, 54, 34011 }, // ∞
+    { 21, 28, 22, 0, 22, 75, 34065 }, // ∫
+    { 5, 15, 7, 1, 15, 18, 34140 }, // ∶
+    { 15, 13, 19, 2, 14, 43, 34158 }, // ≈
+    { 16, 22, 28, 6, 20, 48, 34201 }, // ≠
+    { 19, 19, 22, 1, 18, 56, 34249 }, // ≤
+    { 19, 19, 22, 1, 18, 57, 34305 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_12_regularIntervals[] = {
@@ -3971,4 +2892,5 @@ static const EpdFontData opendyslexic_12_regular = {
     33,
     -13,
     true,
+    true,
 };
@@ -2,5734 +2,3767 @@
  * generated by fontconvert.py
  * name: opendyslexic_14_bold
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_14_bold 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py opendyslexic_14_bold 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_14_boldBitmaps[80904] = {
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x1F, 0x00, 0x07, 0xF0, 0x01, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xC0,
-    0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x01, 0xFF, 0x00,
-    0x7F, 0xC0, 0x1F, 0xF0, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x1F, 0xF0, 0x00, 0xFC, 0x00,
-    0x0B, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x41, 0xFF, 0xE0, 0xBF, 0xF8, 0x2F, 0xFF, 0x0F, 0xFF, 0xC3, 0xFF, 0xF1, 0xFF,
-    0xFC, 0x7F, 0xFF, 0x40, 0x7F, 0xFD, 0x0F, 0xFF, 0xCB, 0xFF, 0xC0, 0xFF, 0xF8, 0xBF, 0xFC, 0x0F,
-    0xFF, 0x4B, 0xFF, 0x40, 0xFF, 0xF0, 0xBF, 0xF0, 0x0F, 0xFF, 0x0B, 0xFF, 0x00, 0xFF, 0xF0, 0xBF,
-    0xF4, 0x0F, 0xFF, 0x0B, 0xFF, 0x40, 0xFF, 0xF0, 0xBF, 0xF4, 0x0F, 0xFF, 0x0F, 0xFF, 0x40, 0xFF,
-    0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x94, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03,
-    0xFF, 0xFF, 0xF6, 0xA0, 0x00, 0x03, 0xFF, 0x8B, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x0B, 0xF0, 0x00,
-    0x00, 0x07, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0xFD, 0x00, 0xE0, 0x0F,
-    0xE0, 0x3F, 0xFD, 0x03, 0xFF, 0x8F, 0xE0, 0x7F, 0xFD, 0x0B, 0xFF, 0xFF, 0xFB, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0xBF, 0x00, 0x0F, 0xD1, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xD0, 0x2F, 0x00, 0x3F, 0xC0,
-    0x01, 0xF0, 0x07, 0xC0, 0x1F, 0xE0, 0x00, 0x7D, 0x01, 0xF0, 0x0F, 0xF0, 0x00, 0x0F, 0x80, 0xFC,
-    0x0B, 0xF4, 0x00, 0x03, 0xFF, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x03, 0xFD, 0x00, 0x00,
-    0x07, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xCB, 0xD1, 0xF8, 0x00, 0x00, 0x3F, 0xD3, 0xE0, 0x2F, 0x00,
-    0x00, 0x2F, 0xF0, 0xF4, 0x07, 0xC0, 0x00, 0x0F, 0xF4, 0x3D, 0x01, 0xF4, 0x00, 0x0F, 0xFC, 0x0F,
-    0x80, 0x7C, 0x00, 0x07, 0xFC, 0x03, 0xF9, 0xBF, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xFF, 0x80, 0x02,
-    0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0xBF, 0x40, 0x00, 0x3F, 0x40, 0x07,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x0F,
-    0xD0, 0x00, 0x2F, 0xD0, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x2F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0xEF, 0xE0, 0x0B, 0xFC, 0xFF, 0xC2, 0xFF, 0x02, 0xFE, 0x3F, 0xE0, 0x1F, 0xF0,
-    0xFF, 0x9F, 0xF4, 0x01, 0xFF, 0xBF, 0xC7, 0xFF, 0x00, 0x1F, 0xFF, 0xE1, 0xFF, 0xF4, 0x02, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFB,
-    0xF0, 0x0B, 0xFF, 0xFF, 0xE0, 0x70, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFD,
-    0x7F, 0xFC, 0x7F, 0xF8, 0x7F, 0xF4, 0x7F, 0xF4, 0x7F, 0xF4, 0x7F, 0xF8, 0xBF, 0xF8, 0xBF, 0xF8,
-    0x00, 0x00, 0xFA, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF0,
-    0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xF0,
-    0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x0F,
-    0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x00,
-    0x0A, 0xA9, 0x0B, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF8,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFE,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x1F, 0xFC,
-    0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xE0,
-    0x00, 0xAA, 0xA0, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x01,
-    0xC0, 0x38, 0x3F, 0xC2, 0xF0, 0x3F, 0xEB, 0xF7, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF,
-    0xFE, 0x00, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xBF, 0x9F, 0xCB, 0xF0, 0x0F, 0x47, 0xF0, 0x24, 0x00, 0x41, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0xB4, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x6A, 0xAF, 0xFE, 0xA9,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xF8, 0x0F, 0xFF, 0x40,
-    0xFF, 0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF,
-    0x40, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFD, 0x05, 0x50, 0x7F, 0xC2, 0xFF, 0x4F, 0xFE, 0x3F, 0xF8, 0xFF, 0xF7, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x1F, 0xF4, 0x2F, 0xF0, 0x0F, 0xF0, 0x02, 0xFD, 0x07, 0xF8, 0x00,
-    0x7F, 0x83, 0xFD, 0x04, 0x0F, 0xF0, 0xFF, 0x4F, 0xC3, 0xFD, 0x3F, 0xC7, 0xF8, 0xBF, 0x5F, 0xF2,
-    0xFF, 0x2F, 0xE7, 0xFC, 0xBF, 0xCB, 0xFA, 0xFF, 0x2F, 0xF2, 0xFE, 0xBF, 0xC7, 0xF8, 0xFF, 0x9F,
-    0xF4, 0xBC, 0x3F, 0xE7, 0xFE, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x0F, 0xFE, 0x3F, 0xFC, 0x0B, 0xFF,
-    0x4F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x3F, 0xFD, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x7F, 0xFF, 0x40, 0x01, 0xE3, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF,
-    0x40, 0x07, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF,
-    0xDB, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x90, 0x1F, 0xFC, 0x0E, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBF, 0xAA, 0xBF, 0xF0, 0x24, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x0F, 0x40, 0x07, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x01, 0xFD, 0xFF, 0x00, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x0B, 0xF0,
-    0xFF, 0x00, 0x01, 0xFD, 0x0F, 0xF4, 0x00, 0x3F, 0x80, 0xFF, 0x40, 0x0F, 0xF0, 0x0F, 0xF4, 0x02,
-    0xFE, 0x5A, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xC1, 0xAA, 0xAB, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF,
-    0xF8, 0x2F, 0xEA, 0xAA, 0xA4, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0x04, 0x00, 0x07, 0xFF, 0x1F, 0x40, 0x1F, 0xFF, 0x2F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x80, 0x06, 0xFF, 0xE8,
-    0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xC7, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFC, 0x07, 0xFF, 0x2F, 0xFC, 0x00, 0x7F, 0xD7, 0xFE, 0x00, 0x0F,
-    0xF9, 0xFF, 0x40, 0x03, 0xFE, 0x7F, 0xE0, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0x7F, 0xE3, 0xFF, 0xEA,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x6A, 0xAA, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x1B, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x7F,
-    0xE0, 0x0F, 0xF0, 0x01, 0xFF, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0xFF,
-    0x80, 0x7F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07, 0xFF, 0x43, 0xFF, 0x00, 0x0F, 0xF8, 0x7F, 0xD0,
-    0x00, 0xBF, 0xC7, 0xFD, 0x00, 0x0B, 0xFC, 0xBF, 0xE0, 0x00, 0xFF, 0xC7, 0xFF, 0x80, 0x7F, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFF, 0x40, 0x00, 0x2B, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0x40, 0x3F, 0xE5, 0xBF, 0xF0, 0x3F, 0xC0, 0x03, 0xFE, 0x0F, 0xD0, 0x00, 0x3F,
-    0xC7, 0xF0, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x02, 0xFD, 0x7F, 0x00, 0x00, 0xBF, 0x9F, 0xC0, 0x00,
-    0x3F, 0xE3, 0xF8, 0x00, 0x1F, 0xF8, 0xFF, 0xD5, 0xBF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xF7, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xC1, 0xFE, 0x95, 0xBF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xAF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x2F,
-    0xF8, 0x2F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x7F, 0xFD, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x2F, 0xF8, 0x2F, 0xFC, 0x3F, 0xFC, 0x3F,
-    0xFC, 0x7F, 0xFD, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x0B,
-    0xFF, 0x40, 0xFF, 0xF4, 0x0F, 0xFF, 0x80, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x90, 0xBF, 0xFC, 0x0B, 0xFF, 0xC0,
-    0x7F, 0xF8, 0x07, 0xFF, 0x40, 0xFF, 0xF0, 0x0F, 0xFF, 0x02, 0xFF, 0xD0, 0x3F, 0xFC, 0x07, 0xFF,
-    0xC0, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x16,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x05, 0x5A, 0xAF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFC, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x1B, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFA, 0xAA, 0x94, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x1B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x6F, 0xFF, 0xFF, 0xFF, 0xE5, 0x07, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xAA, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0x40, 0x00, 0xFF, 0x40, 0xD0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x15,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF9, 0x01, 0xBF, 0x80, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x0F, 0xE0, 0x0B, 0xEF, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFF, 0xFC, 0x01, 0xF0,
-    0x02, 0xFC, 0x0B, 0x83, 0xF0, 0x03, 0xD0, 0x0F, 0xE0, 0x3C, 0x07, 0xC0, 0x0F, 0x40, 0x3F, 0x80,
-    0xE0, 0x0F, 0x00, 0x3D, 0x01, 0xFE, 0x07, 0x40, 0x3D, 0x01, 0xF0, 0x07, 0xF8, 0x1E, 0x01, 0xF4,
-    0x0F, 0xC0, 0x1F, 0xF0, 0x3F, 0xFF, 0xE0, 0xBE, 0x00, 0x7F, 0xC0, 0xBF, 0xFF, 0x9F, 0xF0, 0x00,
-    0xFF, 0x80, 0xBF, 0xAF, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD4, 0x06, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x3F,
-    0xE0, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF,
-    0x80, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x95, 0x5F, 0xFD, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x80,
-    0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF4,
-    0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xE0, 0x01, 0xFF, 0xC0,
-    0x7F, 0xE0, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xC0, 0x7F,
-    0xE0, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x16, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xE0, 0x00,
-    0xBF, 0xF4, 0x7F, 0xE0, 0x00, 0x1F, 0xFC, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x1F,
-    0xFC, 0x7F, 0xE5, 0x55, 0xBF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xA4, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xEA, 0xAF, 0x40, 0x0F, 0xFF, 0xD0, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD4,
-    0x05, 0xB4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xE4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0xF4, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0xC7,
-    0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xD7, 0xFF, 0x00, 0x00, 0x03, 0xFE,
-    0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xF7, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x2F,
-    0xF7, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0x00, 0x00, 0x07,
-    0xFE, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xE7, 0xFF, 0x00, 0x16, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF,
-    0xE9, 0x00, 0x00, 0x06, 0xAA, 0xAF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFA, 0x55, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD5,
-    0x56, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x55, 0x54, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0A, 0xAA, 0xBF, 0xFF, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFD, 0x54, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xBE, 0xA5, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x69, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x1A, 0x50, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xA0, 0x3F, 0xF8, 0x00,
-    0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x06, 0xFF, 0xFF,
-    0x83, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFC, 0x2F, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xFF,
-    0x50, 0x06, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xFF,
-    0xC2, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x0F,
-    0xFC, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x01,
-    0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00,
-    0x1F, 0xFD, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x3F, 0xFC, 0x00,
-    0x01, 0xFF, 0xD3, 0xFF, 0xD5, 0x55, 0x6F, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xE3, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x7F,
-    0xFD, 0x00, 0x03, 0xFF, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F,
-    0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F,
-    0xF0, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F,
-    0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x1F, 0x90, 0x7F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x16, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0xF4, 0x00, 0x3F, 0xF0, 0x0F,
-    0xFF, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x7F, 0xF8, 0x00, 0x03, 0xFE, 0x0F,
-    0xFF, 0x00, 0x00, 0x3F, 0xE1, 0xFF, 0xD0, 0x00, 0x07, 0xFE, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xDB,
-    0xFF, 0x40, 0x00, 0x0B, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x02,
-    0xFF, 0xAF, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0xBF, 0xFF, 0xC0, 0x03, 0xFF, 0x83, 0xFF, 0xFF, 0x00,
-    0x3F, 0xF8, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0x80, 0x7F, 0xFF, 0xF4, 0x3F, 0xF8, 0x01, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xAA, 0xAB, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xF0, 0x1F,
-    0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x42, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF4, 0x2F, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFF, 0x42, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF4, 0x2F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x42,
-    0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xF4, 0x2F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xE0,
-    0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x83, 0xFF, 0x7F, 0xF4, 0xFF, 0xEF, 0xF8,
-    0x3F, 0xF3, 0xFF, 0x9F, 0xFE, 0xFF, 0x83, 0xFF, 0x2F, 0xFF, 0xFF, 0xAF, 0xF8, 0x3F, 0xF5, 0xFF,
-    0xFF, 0xF2, 0xFF, 0xC3, 0xFF, 0x4F, 0xFF, 0xFF, 0x3F, 0xFC, 0x3F, 0xF4, 0xBF, 0xFF, 0xE3, 0xFF,
-    0xC3, 0xFF, 0x87, 0xFF, 0xFD, 0x3F, 0xFC, 0x3F, 0xF8, 0x3F, 0xFF, 0xC3, 0xFF, 0xC3, 0xFF, 0x82,
-    0xFF, 0xF8, 0x3F, 0xFC, 0x3F, 0xF8, 0x0F, 0xFF, 0x47, 0xFF, 0xC3, 0xFF, 0xC0, 0xFF, 0xF0, 0x7F,
-    0xFC, 0x3F, 0xFC, 0x0B, 0xFF, 0x07, 0xFF, 0xC3, 0xFF, 0xC0, 0x3F, 0xD0, 0xBF, 0xFC, 0x7F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x6A, 0xA0, 0x00, 0x03, 0xFD,
-    0x07, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0xBF, 0xFC, 0x00, 0x07, 0xFD, 0x0B, 0xFF, 0xD0, 0x00, 0x7F,
-    0xC0, 0xBF, 0xFF, 0x00, 0x0B, 0xFC, 0x0F, 0xFF, 0xF4, 0x00, 0xBF, 0xC0, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFC, 0x0F, 0xFF, 0xFD, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0x40,
-    0xFF, 0xC0, 0xFF, 0xEF, 0xFC, 0x0F, 0xFC, 0x1F, 0xFD, 0xBF, 0xC0, 0xFF, 0xC1, 0xFF, 0xE3, 0xFE,
-    0x0F, 0xFC, 0x1F, 0xFE, 0x3F, 0xF0, 0xFF, 0x82, 0xFF, 0xE1, 0xFF, 0x9F, 0xF8, 0x2F, 0xFE, 0x0F,
-    0xFE, 0xFF, 0x82, 0xFF, 0xE0, 0xBF, 0xFF, 0xF8, 0x2F, 0xFE, 0x03, 0xFF, 0xFF, 0x83, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xF4, 0x3F, 0xFF, 0x01, 0xFF, 0xFF, 0x43, 0xFF, 0xF0, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0x00, 0x7F, 0xFF, 0x43, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF4, 0x07, 0xFF, 0xE0, 0x01, 0xFF,
-    0xE0, 0x00, 0x2F, 0xFD, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF4, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x5F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xC3,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0xFF, 0xFF, 0x94, 0x5B, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x1B, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA,
-    0xA9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xF4, 0x01, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x02, 0xFE, 0x07,
-    0xFD, 0x00, 0x0B, 0xFC, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x7F, 0xE5, 0x5B, 0xFF, 0xC1, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF8,
-    0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xF8,
-    0x00, 0x0B, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x0F,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xE0, 0x01, 0xD0, 0x1F, 0xF8, 0x02, 0xFF,
-    0xC0, 0x0F, 0xF5, 0xFF, 0xD0, 0x07, 0xFF, 0xE5, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xF5, 0x56, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x80,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xFA, 0xAF, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x2F, 0xFF, 0x47, 0xFF, 0x40, 0x3F, 0xFC, 0x01, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xFF,
-    0xC0, 0x3F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x3F, 0xFD, 0x00, 0xFF, 0xF0,
-    0x3F, 0xFD, 0x00, 0xFF, 0xF8, 0x3F, 0xFD, 0x00, 0xFF, 0xFC, 0x3F, 0xFE, 0x00, 0xFF, 0xFC, 0x2A,
-    0xA9, 0x00, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFF, 0xD0, 0x1B, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x3E, 0x00, 0x00, 0x2F, 0xFD, 0x02, 0xFF, 0xE0, 0x01, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x01, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF,
-    0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03,
-    0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00,
-    0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00,
-    0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0xFF, 0xD0,
-    0x00, 0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xC2, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x02, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x7F, 0xF4, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-    0xC0, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0x00, 0x7F, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x0F, 0xFF, 0x40,
-    0x00, 0x0F, 0xFF, 0x0B, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE3, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFE,
-    0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2A, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xAA, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xF0, 0x0B, 0xFF,
-    0x80, 0x0F, 0xFE, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x3F,
-    0xFC, 0x03, 0xFF, 0xF4, 0x07, 0xFF, 0x40, 0x0F, 0xFF, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xC0, 0x02,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xD0, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x7F, 0xFF, 0xFC, 0x3F, 0xF8, 0x00,
-    0x1F, 0xFF, 0x3F, 0xFF, 0xFF, 0x5F, 0xFD, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0xFF, 0xFB, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xE0,
-    0x00, 0x07, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x07, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xD0,
-    0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x0B, 0xFF, 0x00, 0x00,
-    0x1F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x7F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFD,
-    0x2F, 0xFF, 0x40, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x0B, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xD0, 0x03, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x3F, 0xFF, 0x40, 0x00, 0xFF,
-    0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0xBF, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFD, 0x02, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x80, 0x0B, 0xFF,
-    0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0x00, 0x00,
-    0x7F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xDF, 0xFE, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6A,
-    0xAA, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF5, 0x55, 0x50, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x47,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x06, 0xAA, 0xA8, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xFC, 0x0F, 0xF8, 0x00,
-    0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F,
-    0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00,
-    0x2F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x3F,
-    0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0,
-    0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xD0, 0x00,
-    0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x28, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x00,
-    0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x03,
-    0xFD, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC,
-    0x00, 0x0B, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0x40, 0x6A, 0xAA, 0x80, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF,
-    0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0,
-    0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00,
-    0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4,
-    0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xF8, 0x00,
-    0x0B, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0x07, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x7F, 0xDF, 0xFC, 0x00,
-    0xBF, 0x80, 0xBF, 0xC0, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x55, 0x40, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0xFF, 0xE0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0, 0x0F, 0xF9, 0xBF, 0xFC, 0x07,
-    0xF4, 0x03, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0xC0, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0x00, 0x02, 0xFD,
-    0x1F, 0x80, 0x00, 0xBF, 0x4B, 0xE0, 0x00, 0x1F, 0xE1, 0xF4, 0x00, 0x07, 0xF8, 0x7E, 0x00, 0x02,
-    0xFF, 0x1F, 0xE5, 0x5B, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xBF, 0xD0, 0x0B, 0xFE, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC2, 0xFD, 0x00, 0x03, 0xFD, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0x86, 0xFE, 0x02, 0xFF, 0xD0, 0x07, 0xF0, 0x2F, 0xFC, 0x00, 0x3F, 0x42, 0xFF,
-    0x80, 0x02, 0xF8, 0x1F, 0xF4, 0x00, 0x2F, 0xC1, 0xFF, 0x40, 0x03, 0xFC, 0x1F, 0xF4, 0x00, 0x7F,
-    0xC1, 0xFF, 0xD0, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x65, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0xFF, 0xE0, 0x78, 0x02, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE4, 0x7F, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xF4, 0x2F, 0xFF, 0x83, 0xFD,
-    0x00, 0xBF, 0xF8, 0x3F, 0xC0, 0x03, 0xFF, 0x87, 0xF4, 0x00, 0x3F, 0xF8, 0xBF, 0x40, 0x02, 0xFF,
-    0x47, 0xF4, 0x00, 0x2F, 0xF4, 0x7F, 0x40, 0x03, 0xFF, 0x43, 0xFC, 0x00, 0x7F, 0xF4, 0x3F, 0xFA,
-    0xAF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF8,
-    0x02, 0xFF, 0xFF, 0xBF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x2F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0xFD, 0x0F, 0xFA,
-    0xAA, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F,
-    0xF9, 0x54, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x0B,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0xBF, 0xFC, 0x01, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFC, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFD, 0x00,
-    0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07,
-    0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x2F,
-    0xE4, 0xBF, 0x80, 0x7F, 0xFF, 0xBF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFB, 0xFF, 0xFD, 0x2F,
-    0xC0, 0x2F, 0xFF, 0x4F, 0xD0, 0x03, 0xFF, 0xD7, 0xF0, 0x00, 0x7F, 0xF5, 0xF8, 0x00, 0x0F, 0xFD,
-    0xBE, 0x00, 0x03, 0xFF, 0x6F, 0x80, 0x00, 0xFF, 0xC7, 0xF0, 0x00, 0x7F, 0xF1, 0xFE, 0x00, 0x7F,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0xE8, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF4, 0x0E, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0xBF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x05, 0xBF, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF2, 0xFF, 0x90, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFD, 0x02, 0xFF,
-    0xFE, 0xFF, 0xF0, 0x2F, 0xFC, 0x00, 0xFF, 0x02, 0xFF, 0x00, 0x07, 0xF4, 0x3F, 0xF0, 0x00, 0x3F,
-    0x43, 0xFF, 0x00, 0x03, 0xF8, 0x3F, 0xF0, 0x00, 0x3F, 0x83, 0xFF, 0x00, 0x07, 0xF8, 0x3F, 0xF0,
-    0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x0F, 0xFC,
-    0x7F, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0xBF, 0xF4, 0x02, 0xFF, 0xC0, 0x05, 0x50,
-    0x7F, 0xC2, 0xFF, 0x4B, 0xFE, 0x3F, 0xF8, 0xFF, 0xF7, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03,
-    0xFC, 0x0F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF4, 0xBF, 0xE2, 0xFF, 0x80, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00,
-    0x1F, 0xE0, 0x00, 0x7F, 0x40, 0x02, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0x00,
-    0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xE0, 0x10, 0xFF, 0x40, 0xFF, 0xFD,
-    0x03, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x7F, 0xFD, 0x00, 0x69, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x05, 0x54, 0x00, 0x2F, 0xD2, 0xFF, 0x40, 0x02, 0xFD, 0x7F,
-    0xE0, 0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xEF, 0xFF, 0x80, 0x07, 0xFD, 0x7F, 0xFF, 0x00, 0x7F,
-    0xD2, 0xFF, 0xFC, 0x07, 0xFE, 0x0F, 0xFF, 0xF0, 0xBF, 0xE0, 0x3F, 0xFF, 0xD0, 0x1F, 0xF0, 0x07,
-    0xF8, 0x01, 0xFE, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x0B, 0xF4, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x01, 0xFF,
-    0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xFF, 0xCB, 0xFF,
-    0xF6, 0xFF, 0xFE, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0xBF,
-    0x90, 0x0B, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xEB, 0xFF, 0xFE, 0xBF, 0xF0, 0x0F, 0xFE, 0x00, 0xFF, 0xF0, 0x0F, 0xF4,
-    0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x07, 0xF8, 0x1F, 0xF8, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x1F, 0xF8,
-    0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x2F, 0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x2F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x07, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x0B,
-    0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x3F,
-    0xF0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x7F, 0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x7F, 0xE0, 0x03,
-    0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF1, 0xBF, 0xA0, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFE, 0x00, 0xBF, 0xC2, 0xFF, 0x00,
-    0x0F, 0xF0, 0xFF, 0x80, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0xFF, 0x4F, 0xF4, 0x00, 0x3F, 0xD3, 0xFE,
-    0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0x7F, 0xE7,
-    0xFF, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x0B, 0xFF, 0x7F, 0xF0, 0x02, 0xFF, 0xEF, 0xFC, 0x00, 0xBF,
-    0xF0, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x3F, 0xFE,
-    0xBF, 0xF0, 0x2F, 0xF4, 0x07, 0xFE, 0x0F, 0xF8, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x0F, 0xF5, 0xFF,
-    0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0xBF, 0xAF, 0xF0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x0F, 0xF9,
-    0xFF, 0x40, 0x03, 0xFE, 0x3F, 0xF0, 0x03, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x2F, 0xE7, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xF4,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xE0, 0x0F, 0xFF, 0x00, 0x0F, 0xC0, 0x3F,
-    0xF8, 0x00, 0x2F, 0x80, 0xFF, 0xD0, 0x00, 0xBE, 0x03, 0xFF, 0x40, 0x01, 0xFC, 0x0F, 0xFD, 0x00,
-    0x07, 0xF0, 0x3F, 0xF8, 0x00, 0x2F, 0x80, 0xFF, 0xF4, 0x01, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFE,
-    0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0xAE, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x7F, 0x80, 0x01, 0xFF, 0xFF, 0xBF, 0x80, 0x07, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0F, 0xF9, 0xBF, 0xFF, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0x40, 0x3F, 0x40, 0x0B, 0xFF,
-    0x00, 0x7F, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0x00,
-    0xBF, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0x80, 0x0B, 0xFE, 0x00, 0x3F,
-    0xFE, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x01, 0x00, 0x2F, 0xF9, 0xFD, 0x6F, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF5, 0xBF, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0x41,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFD, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE4,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0F, 0xFA, 0xBF, 0xC0, 0x03, 0xF4, 0x00, 0x50, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x40, 0x02, 0xFF, 0x80,
-    0xB8, 0x00, 0xBF, 0xE0, 0x7F, 0xFA, 0xBF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x1A, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x00, 0x6F, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xAA,
-    0xFF, 0xAA, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0xA6,
-    0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x7F, 0xC7, 0xF4, 0x00, 0x1F,
-    0xF1, 0xFE, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x01, 0xFF, 0x0F, 0xE0, 0x00, 0x7F, 0xC3, 0xF8, 0x00,
-    0x1F, 0xF0, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x02, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0xC3, 0xFD,
-    0x00, 0x3F, 0xF4, 0xFF, 0xD0, 0x2F, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x1B, 0xFD, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x00, 0x7F,
-    0xC0, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x0B, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0xFC,
-    0x00, 0x2F, 0xF4, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD1, 0xFF, 0x40,
-    0x00, 0x1F, 0xFC, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0x2F, 0xF0, 0x01,
-    0x40, 0x0B, 0xFC, 0x1F, 0xF4, 0x0B, 0xF0, 0x0F, 0xF8, 0x0F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x0F,
-    0xFC, 0x3F, 0xFC, 0x2F, 0xF0, 0x0B, 0xFC, 0x7F, 0xFE, 0x3F, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xBF,
-    0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xBF, 0xFF, 0x40, 0x00,
-    0xFF, 0xFD, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xFC, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFE,
-    0x00, 0x00, 0x2A, 0x90, 0x06, 0xA8, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x0B,
-    0xFC, 0x00, 0x0B, 0xFD, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xCB, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x02, 0xFF, 0xEF, 0xFE, 0x00, 0x01, 0xFF, 0xD2, 0xFF, 0xD0, 0x01, 0xFF, 0xE0, 0x3F, 0xFC,
-    0x01, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x7F, 0xD0, 0x00, 0x0F, 0xF4,
-    0xFF, 0xC0, 0x00, 0x7F, 0xC1, 0xFF, 0x80, 0x02, 0xFE, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x03, 0xFF,
-    0x00, 0x7F, 0xC0, 0x0B, 0xFD, 0x02, 0xFE, 0x00, 0x0F, 0xFC, 0x0F, 0xF4, 0x00, 0x2F, 0xF8, 0x7F,
-    0xC0, 0x00, 0x3F, 0xF2, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x1A, 0xAA, 0xBF, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x55, 0x54, 0x03, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x5A, 0xA0, 0x00, 0x2F, 0xFF, 0xC0, 0x02, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xBF,
-    0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x02,
-    0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0xE9, 0x00, 0x07, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x4B, 0xF2, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F,
-    0x8F, 0xE3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF5, 0xFD, 0x7F, 0x5F, 0xD7, 0xF1, 0xFC, 0x7F, 0x1F,
-    0xC7, 0xF0, 0x6A, 0x90, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0xBF, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x06, 0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xBC, 0x2F, 0xF4,
-    0xBC, 0x3F, 0xFD, 0xBC, 0x7D, 0x7F, 0xFC, 0x7D, 0x2F, 0xF4, 0x3E, 0x07, 0xD0, 0x7F, 0xFF, 0x5F,
-    0xFF, 0xC3, 0xFF, 0xF0, 0xFF, 0xFC, 0x2F, 0xFF, 0x0B, 0xFF, 0x81, 0xFF, 0xE0, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0xB0, 0x00, 0xFC, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x7F,
-    0xC0, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
-    0x00, 0x2F, 0xD0, 0x0B, 0xF4, 0x01, 0xFD, 0x00, 0x7F, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0x80, 0xBF, 0xCF, 0x80, 0x03, 0xFD, 0x3E, 0x00, 0x0F, 0xF0, 0xF8, 0x00, 0x7F, 0xC3,
-    0xE0, 0x01, 0xFF, 0x0F, 0x80, 0x07, 0xFC, 0x3E, 0x00, 0x1F, 0xF4, 0xF8, 0x00, 0x3F, 0xE3, 0xE0,
-    0x00, 0xFF, 0xEF, 0xA4, 0x01, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF0,
-    0x01, 0xBF, 0xF9, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x2F,
-    0xF4, 0x1B, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0x40, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xA0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x03, 0xD0, 0x01, 0xFC,
-    0x00, 0xFF, 0xBF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
-    0xBF, 0xFC, 0x00, 0x7F, 0xC0, 0xBF, 0xC0, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x3F, 0xD0,
-    0x0B, 0xFD, 0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFE, 0xBF, 0xEF, 0xF0, 0x0B, 0x80, 0x00, 0x3C, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x15, 0x42, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x0F,
-    0xFD, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0xD0, 0x3F, 0xF8, 0x00,
-    0x0F, 0xFF, 0x4F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2A, 0xAF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0A,
-    0xA8, 0x00, 0x00, 0x1B, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x3E, 0x7E, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBC, 0xBC, 0xFC, 0x40, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4, 0x02, 0xFD, 0x47, 0xF4, 0x02, 0xF4, 0x00,
-    0xF0, 0x03, 0xF8, 0x00, 0x50, 0x02, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x0B, 0xFD, 0x5B, 0xFC, 0x0F, 0xF0, 0x02, 0xFD, 0x0F, 0xE0, 0x02,
-    0xFD, 0x0F, 0xFF, 0xEF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x02, 0x40, 0x02,
-    0xFD, 0x0B, 0xF4, 0x07, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0x40, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0xBF, 0xD0, 0xBF, 0xD2, 0xFF, 0x42, 0xFF,
-    0x4F, 0xFE, 0x0F, 0xFE, 0x3F, 0xF8, 0x3F, 0xF8, 0xFF, 0xF1, 0xFF, 0xF1, 0x55, 0x41, 0x55, 0x40,
-    0x00, 0xBF, 0x90, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFA, 0xFE, 0x02, 0xF4, 0x03, 0xF4, 0x3E, 0x3F,
-    0x4F, 0xC7, 0xCF, 0x00, 0xBC, 0x7C, 0xE0, 0x07, 0xC7, 0xDF, 0x50, 0xBC, 0x3F, 0x2F, 0x9F, 0x82,
-    0xFD, 0x07, 0xF0, 0x0F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xB4, 0x0F, 0xFF, 0x42, 0xD0, 0xF8, 0x3C, 0x0B, 0x83, 0x80, 0x7C, 0x38, 0x07, 0xC3,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x7F, 0x68, 0x00, 0x00, 0x40, 0x01, 0x00, 0x02, 0xC0, 0x1D, 0x00,
-    0x0F, 0xC0, 0x7D, 0x00, 0x3F, 0xC2, 0xFD, 0x01, 0xFF, 0x4B, 0xFC, 0x07, 0xFD, 0x3F, 0xF0, 0x2F,
-    0xF0, 0xFF, 0x80, 0x7F, 0xC3, 0xFD, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x7F, 0xF6, 0xFF, 0xC0, 0x0F,
-    0xFD, 0xBF, 0xF0, 0x03, 0xFF, 0x6F, 0xFC, 0x00, 0xFF, 0x4B, 0xFC, 0x00, 0x3F, 0x02, 0xF8, 0x00,
-    0x0F, 0x00, 0xB4, 0x00, 0x02, 0x00, 0x10, 0x7F, 0xA9, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x15, 0x56, 0xAF, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x90, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFA, 0xFE, 0x02, 0xFF, 0xF6,
-    0xF4, 0x3E, 0x61, 0xCF, 0x87, 0xD6, 0x1C, 0xBC, 0x7C, 0xBF, 0x47, 0xC7, 0xCB, 0xB8, 0xBC, 0x3E,
-    0xB2, 0xCF, 0x82, 0xFF, 0x2F, 0xF4, 0x0F, 0xFB, 0xFE, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xAF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xFF, 0x83, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xE0, 0xBF, 0x87, 0xFC, 0x03, 0xFC, 0x7F, 0x80, 0x3F, 0xC7, 0xFC, 0x03, 0xFC, 0x3F, 0xFA,
-    0xFF, 0x83, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xAF, 0x90, 0x00,
-    0x00, 0x06, 0xA4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x55, 0x60, 0x1F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x80, 0xBF, 0xF4, 0xA0, 0xB8, 0x00, 0x3C,
-    0x00, 0x7C, 0x01, 0xF4, 0x0B, 0xE0, 0x3F, 0xC0, 0xBF, 0xFC, 0xBF, 0xFC, 0x00, 0x00, 0x16, 0x90,
-    0x3F, 0xF8, 0x10, 0x2C, 0x00, 0x2D, 0x0B, 0xF8, 0x0F, 0xF8, 0x00, 0x7D, 0x10, 0x2E, 0x3F, 0xFD,
-    0xBF, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0xBE, 0x03, 0xF4, 0x2F, 0xC0, 0xFE, 0x0B, 0xF4,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFE,
-    0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x07, 0xFC, 0x7F, 0xE0, 0x00, 0x7F,
-    0xC7, 0xFF, 0x00, 0x0B, 0xFC, 0x7F, 0xF0, 0x00, 0xBF, 0xC7, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xF4,
-    0x00, 0xFF, 0xD7, 0xFF, 0xD0, 0x2F, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xEB, 0xF1, 0xBF,
-    0xD0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0x00, 0xFF, 0xFC, 0x3F, 0xC0, 0xFF, 0xFF, 0x0F,
-    0xF0, 0xBF, 0xFF, 0xC3, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xC3, 0xFF, 0xFE,
-    0x0F, 0xF0, 0xBF, 0xFF, 0x83, 0xFC, 0x1F, 0xFF, 0xE0, 0xFF, 0x02, 0xFF, 0xF8, 0x3F, 0xC0, 0x1F,
-    0xFD, 0x0B, 0xF0, 0x03, 0xFF, 0x42, 0xFC, 0x00, 0xFF, 0xD0, 0xBF, 0x00, 0x3F, 0xF0, 0x2F, 0xC0,
-    0x1F, 0xFC, 0x0B, 0xF0, 0x0B, 0xFF, 0x02, 0xFC, 0x03, 0xFF, 0xC0, 0xBF, 0x00, 0xFF, 0xF0, 0x2F,
-    0xC0, 0x3F, 0xFC, 0x0B, 0xF0, 0x1F, 0xFF, 0x02, 0xFD, 0x0B, 0xFF, 0x80, 0xBF, 0x43, 0xFF, 0xE0,
-    0x2F, 0xD0, 0xFF, 0xF8, 0x0B, 0xF4, 0x3F, 0xFE, 0x01, 0xFD, 0x1F, 0xFF, 0x40, 0x7F, 0x40, 0x1F,
-    0xF0, 0xBF, 0xD2, 0xFF, 0x4F, 0xFE, 0x3F, 0xF8, 0xFF, 0xF1, 0x55, 0x40, 0x0F, 0x40, 0x1F, 0x00,
-    0x3F, 0x00, 0x3F, 0xF0, 0x7F, 0xF8, 0x10, 0xFC, 0x3F, 0xFC, 0x7F, 0xF4, 0xBF, 0xD0, 0x00, 0x00,
-    0x7D, 0x03, 0xF4, 0x1A, 0xD0, 0x0B, 0x40, 0x2D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x43, 0xFF, 0xEF,
-    0xFF, 0x95, 0x54, 0x02, 0xFD, 0x00, 0xFF, 0xF4, 0x2E, 0x07, 0xC3, 0xD0, 0x3C, 0x3D, 0x03, 0xD3,
-    0xE0, 0x7C, 0x2F, 0xFF, 0xC0, 0xFF, 0xF4, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0xA0, 0x03, 0x40, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0xBF, 0x43, 0xF8, 0x00, 0x7F, 0xD3, 0xFF, 0x00,
-    0x1F, 0xF8, 0xBF, 0xC0, 0x03, 0xFE, 0x1F, 0xF4, 0x00, 0xFF, 0x47, 0xFC, 0x01, 0xFF, 0xCB, 0xFD,
-    0x07, 0xFF, 0x6F, 0xFC, 0x1F, 0xFD, 0xFF, 0xF0, 0x7F, 0xF6, 0xFF, 0x80, 0x3F, 0xD2, 0xFE, 0x00,
-    0x3F, 0x01, 0xF8, 0x00, 0x3C, 0x01, 0xE0, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xD0,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x18, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFC, 0x01, 0x40, 0x3F, 0xFF, 0xF0,
-    0x2F, 0xE0, 0x2F, 0x40, 0xFF, 0xFF, 0xC0, 0xFF, 0x01, 0xFD, 0x03, 0xFF, 0xFF, 0x0B, 0xF8, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x07, 0xDF, 0x80, 0x00,
-    0x00, 0x2F, 0xF0, 0x3D, 0x3E, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xE1, 0xF8, 0x00, 0x00, 0x0F, 0xF8,
-    0x2F, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFE, 0x0B, 0xFF, 0xFF,
-    0xE0, 0x00, 0x2F, 0xF0, 0x05, 0x6B, 0xFE, 0x40, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x18, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x41, 0x69, 0x00, 0x3F, 0xFF, 0xF0,
-    0x1F, 0xF1, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x03, 0xFC, 0x2F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF0, 0xBF,
-    0x82, 0xE4, 0x2F, 0xC1, 0x55, 0x55, 0x0F, 0xF0, 0x10, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x01,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0x55, 0x55, 0x40, 0x06, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xE5, 0x6F, 0x80, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0x2F, 0xD0, 0x00, 0x01, 0xAB, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xF0,
-    0x00, 0x00, 0x50, 0x0F, 0xD0, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x43, 0xFC, 0x07, 0xD0, 0x1F,
-    0xFF, 0xFC, 0x3F, 0xD0, 0x3F, 0x40, 0xFF, 0xFF, 0xD1, 0xFE, 0x03, 0xFD, 0x01, 0xBF, 0xF9, 0x0F,
-    0xF0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x81, 0xF7, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0x4F,
-    0x80, 0x00, 0x00, 0x3F, 0xD0, 0xF8, 0x7E, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xC1, 0xF8, 0x00, 0x00,
-    0x1F, 0xF0, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x82, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFC, 0x06,
-    0xAA, 0xFF, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0xC0, 0x3F, 0xD0, 0x00, 0x7F, 0x02, 0xFF, 0x80, 0x7F, 0xF8, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x6A, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFB,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x00,
-    0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0x0B,
-    0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x95, 0x5F, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFE,
-    0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF4, 0x7F, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0xC2, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xE5, 0x57, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0xBF,
-    0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xFD, 0x1F, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x8F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xF9, 0x55, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFC,
-    0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x47, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x6D,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x7D, 0x00, 0x00,
-    0x00, 0x0F, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0xC2, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xE5, 0x57, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0xBF,
-    0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xFD, 0x1F, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x2F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0x4F, 0xFF, 0x40, 0x00, 0x01, 0x55, 0x41, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x8F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xF9, 0x55, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFC,
-    0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x47, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xF9, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xD3, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00,
-    0x00, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0,
-    0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x55, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F,
-    0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0x00, 0x00, 0x0B,
-    0xFF, 0x47, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x51, 0xAA, 0xAA, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xA5, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF2, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD2, 0xFF, 0xFE, 0x55,
-    0x58, 0x00, 0x00, 0x00, 0xBF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x55, 0x55, 0x50, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFE,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xA4, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xEA, 0xAF, 0x40, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD4, 0x05, 0xB4,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x10,
-    0xBD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0xAA, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xA5, 0x54, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x55,
-    0x68, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0x55, 0x55, 0x40, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xFF,
-    0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFE, 0x02,
-    0xFF, 0xA5, 0x54, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x55, 0x68, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xF9, 0x55, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x03, 0xFD, 0x0B, 0xF8,
-    0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x54, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0x95, 0x50, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xF5, 0x55, 0xA0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE5,
-    0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0x03, 0xFE, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x01, 0xFF, 0xC1,
-    0xFF, 0xC0, 0x07, 0xFF, 0x4B, 0xFF, 0x40, 0x2F, 0xFD, 0x2F, 0xFD, 0x00, 0x55, 0x50, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xAA, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF5,
-    0x55, 0xA0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B,
-    0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x02, 0xF8, 0x03, 0xF4, 0x0B, 0xF0, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F,
-    0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F,
-    0xF4, 0x2F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xBF, 0xD0, 0x0F, 0xF4, 0x0F, 0xF4, 0x3F, 0xC0, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x05, 0x50, 0x05, 0x50, 0x7F, 0xC0, 0xBF,
-    0xC2, 0xFF, 0x42, 0xFF, 0x4F, 0xFD, 0x0F, 0xFD, 0x3F, 0xF8, 0x3F, 0xF8, 0xFF, 0xE0, 0xFF, 0xE7,
-    0xFF, 0xC7, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xFF,
-    0x40, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xC5, 0x5B, 0xFF, 0x55, 0x40, 0x02, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF3, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x07, 0xFF,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xF0, 0x01, 0x6F,
-    0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFA, 0x40,
-    0x00, 0x00, 0x00, 0x6D, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x3D, 0x00, 0x00, 0x02, 0xFF, 0xE7,
-    0xD0, 0x00, 0x00, 0x3F, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x06, 0xAA, 0x00, 0x00, 0x3F, 0xD0, 0x7F, 0xF8,
-    0x00, 0x07, 0xFD, 0x0B, 0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0xBF, 0xFD, 0x00, 0x07, 0xFC, 0x0B, 0xFF,
-    0xF0, 0x00, 0xBF, 0xC0, 0xFF, 0xFF, 0x40, 0x0B, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xC0, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x0F, 0xFC, 0x0F,
-    0xFE, 0xFF, 0xC0, 0xFF, 0xC1, 0xFF, 0xDB, 0xFC, 0x0F, 0xFC, 0x1F, 0xFE, 0x3F, 0xE0, 0xFF, 0xC1,
-    0xFF, 0xE3, 0xFF, 0x0F, 0xF8, 0x2F, 0xFE, 0x1F, 0xF9, 0xFF, 0x82, 0xFF, 0xE0, 0xFF, 0xEF, 0xF8,
-    0x2F, 0xFE, 0x0B, 0xFF, 0xFF, 0x82, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x3F, 0xFE, 0x02, 0xFF, 0xFF,
-    0x43, 0xFF, 0xF0, 0x1F, 0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0xFF, 0xFF, 0x43, 0xFF, 0xF0, 0x07, 0xFF,
-    0xF4, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x03, 0xFF, 0xF0, 0x02, 0xFF, 0xF0, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF4, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFD, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4,
-    0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x5F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xC3, 0xFF,
-    0xE0, 0x00, 0x01, 0xFF, 0xF0, 0xFF, 0xFF, 0x94, 0x5B, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1B, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFD, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xF8,
-    0x00, 0x0B, 0xFF, 0x40, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD,
-    0x0B, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD7,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0xFF,
-    0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x3F, 0xFF, 0xE5, 0x16, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x06, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0x82, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x40, 0x7F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x02,
-    0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x42, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xD3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0x0F, 0xFF, 0xF9, 0x45, 0xBF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x3E, 0x00, 0x00, 0x00,
-    0x0B, 0xCF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFD,
-    0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF0,
-    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x0B, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x3F, 0xFF, 0xE5, 0x16, 0xFF,
-    0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFE,
-    0x1F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x87, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x50, 0x55, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x40, 0x7F,
-    0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x02, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x03, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xD0, 0x00, 0x00, 0x1F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x4F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xF0, 0x00,
-    0x00, 0x2F, 0xFC, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x0F, 0xFF, 0xF9, 0x45, 0xBF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x01, 0xFF, 0x8F, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x01,
-    0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFE, 0x1F, 0xFF, 0x05, 0x55, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0x9F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xFF, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x07, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0xD0, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0xE0, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xFF,
-    0xF0, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x7F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xFE, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x96, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03,
-    0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00,
-    0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80,
-    0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8,
-    0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0xFF,
-    0xD0, 0x00, 0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC,
-    0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F,
-    0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3,
-    0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0x82, 0xFF, 0xC0, 0x00, 0x3F, 0xF8,
-    0x2F, 0xFD, 0x00, 0x07, 0xFF, 0x82, 0xFF, 0xFE, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0x43, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F,
-    0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC,
-    0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF,
-    0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F,
-    0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x03,
-    0xFF, 0x82, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x00, 0x7F,
-    0xF0, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xF0, 0x00, 0x0F,
-    0xFF, 0x4F, 0xFF, 0x00, 0x00, 0x55, 0x50, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD,
-    0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF,
-    0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02,
-    0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00,
-    0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00,
-    0x03, 0xFF, 0x82, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD2, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x0B, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFD, 0x00,
-    0x0F, 0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF4, 0x03, 0xFF, 0x80, 0x00, 0xFF,
-    0xF0, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xD0, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC7, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x07, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0x07, 0xF0, 0x1F, 0xFC, 0x7F, 0x00, 0x3F, 0xD7, 0xF0, 0x02, 0xFE,
-    0x7F, 0x00, 0x3F, 0xE7, 0xF0, 0x0B, 0xFD, 0x7F, 0x47, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x0F, 0xF8, 0x07, 0xFC,
-    0x01, 0xFF, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x07, 0xFD, 0x02, 0xFD, 0x02, 0xFF, 0xE0, 0x2F, 0xD0,
-    0x7F, 0xFC, 0x02, 0xFD, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0xFD, 0x00, 0x03, 0xFE, 0x0F, 0xC0, 0x00,
-    0x3F, 0xE0, 0xFE, 0x00, 0x03, 0xFE, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x7F, 0xF0, 0x03, 0xFE, 0x03,
-    0xFF, 0xD0, 0x3F, 0xE0, 0x1F, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0xBF, 0xC3,
-    0xFF, 0x00, 0x03, 0xFD, 0x3F, 0xFE, 0x40, 0x7F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFD, 0x01, 0x55, 0x1B, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xF9, 0xBF, 0xFC, 0x07, 0xF4, 0x03, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0xC0, 0xFD,
-    0x00, 0x0F, 0xF0, 0x3F, 0x00, 0x02, 0xFD, 0x1F, 0x80, 0x00, 0xBF, 0x4B, 0xE0, 0x00, 0x1F, 0xE1,
-    0xF4, 0x00, 0x07, 0xF8, 0x7E, 0x00, 0x02, 0xFF, 0x1F, 0xE5, 0x5B, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xBF, 0xD0, 0x0B, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0, 0x0F, 0xF9, 0xBF, 0xFC, 0x07, 0xF4, 0x03, 0xFF, 0x03, 0xF8,
-    0x00, 0x7F, 0xC0, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0x00, 0x02, 0xFD, 0x1F, 0x80, 0x00, 0xBF, 0x4B,
-    0xE0, 0x00, 0x1F, 0xE1, 0xF4, 0x00, 0x07, 0xF8, 0x7E, 0x00, 0x02, 0xFF, 0x1F, 0xE5, 0x5B, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF,
-    0xBF, 0xD0, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x82, 0xFF, 0x00,
-    0xFF, 0x40, 0x0F, 0xF0, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFE, 0x6F,
-    0xFF, 0x01, 0xFD, 0x00, 0xFF, 0xC0, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x03, 0xFC, 0x0F, 0xC0,
-    0x00, 0xBF, 0x47, 0xE0, 0x00, 0x2F, 0xD2, 0xF8, 0x00, 0x07, 0xF8, 0x7D, 0x00, 0x01, 0xFE, 0x1F,
-    0x80, 0x00, 0xBF, 0xC7, 0xF9, 0x56, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xEF, 0xF4, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x2E, 0x03,
-    0xD0, 0x00, 0x3F, 0xF0, 0xF8, 0x00, 0x1F, 0xFE, 0x3E, 0x00, 0x0B, 0xCF, 0xFF, 0x40, 0x03, 0xF0,
-    0xFF, 0xC0, 0x00, 0xBC, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xF9, 0xBF, 0xFC, 0x07, 0xF4, 0x03, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0xC0, 0xFD, 0x00, 0x0F,
-    0xF0, 0x3F, 0x00, 0x02, 0xFD, 0x1F, 0x80, 0x00, 0xBF, 0x4B, 0xE0, 0x00, 0x1F, 0xE1, 0xF4, 0x00,
-    0x07, 0xF8, 0x7E, 0x00, 0x02, 0xFF, 0x1F, 0xE5, 0x5B, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xBF, 0xD0, 0x0B, 0xFE, 0x40, 0x00,
-    0x0B, 0xFC, 0x0B, 0xFC, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x3F, 0xF4, 0x3F,
-    0xF4, 0x1F, 0xFE, 0x1F, 0xFD, 0x07, 0xFF, 0x8B, 0xFF, 0x80, 0x55, 0x50, 0x55, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFE, 0x6F, 0xFF, 0x01, 0xFD, 0x00, 0xFF, 0xC0,
-    0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x03, 0xFC, 0x0F, 0xC0, 0x00, 0xBF, 0x47, 0xE0, 0x00, 0x2F,
-    0xD2, 0xF8, 0x00, 0x07, 0xF8, 0x7D, 0x00, 0x01, 0xFE, 0x1F, 0x80, 0x00, 0xBF, 0xC7, 0xF9, 0x56,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xEF, 0xF4, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x02, 0xFB, 0xF0, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFE,
-    0x6F, 0xFF, 0x01, 0xFD, 0x00, 0xFF, 0xC0, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x03, 0xFC, 0x0F,
-    0xC0, 0x00, 0xBF, 0x47, 0xE0, 0x00, 0x2F, 0xD2, 0xF8, 0x00, 0x07, 0xF8, 0x7D, 0x00, 0x01, 0xFE,
-    0x1F, 0x80, 0x00, 0xBF, 0xC7, 0xF9, 0x56, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xEF, 0xF4, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0x9F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xF9, 0xBF, 0xFF, 0xF4,
-    0x0B, 0xF4, 0x07, 0xF4, 0x03, 0xFF, 0xF4, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x7F, 0xFE, 0xAA, 0xBF,
-    0xD0, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
-    0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xCB, 0xE0, 0x00, 0x1F, 0xFA, 0x54, 0x00, 0x01, 0xF4, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xE5, 0x5B, 0xFF,
-    0xFE, 0x00, 0x07, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0B, 0xFE, 0x40, 0x00, 0xBF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00,
-    0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x78, 0x01, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x10, 0xBC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x2F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0xFD, 0x0F, 0xFA,
-    0xAA, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F,
-    0xF9, 0x54, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x0B,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFD, 0x07, 0xFC, 0x07,
-    0xFC, 0x00, 0x3F, 0x43, 0xFE, 0xAA, 0xBF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x5F, 0xFF, 0xFF, 0xFF, 0xDB, 0xFE, 0x55, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x02, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF0,
-    0x00, 0xBF, 0x81, 0xFF, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x41, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0xFF, 0xAA, 0xAF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x95, 0x40,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0xB0, 0xBF, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x6F, 0xFE, 0x40, 0x01, 0x54, 0x01, 0x54, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0xBF, 0xD0, 0xBF, 0xC0,
-    0x3F, 0xF4, 0x3F, 0xF4, 0x0F, 0xFE, 0x0F, 0xFE, 0x03, 0xFF, 0x87, 0xFF, 0x81, 0xFF, 0xF1, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x41, 0xFF, 0x01,
-    0xFF, 0x00, 0x0F, 0xD0, 0xFF, 0xAA, 0xAF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x95, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0xB0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xFE, 0x40, 0x7F, 0xD0, 0x00, 0x1F, 0xF4,
-    0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0,
-    0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xE0, 0x03, 0xF0, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F, 0xC1, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x03, 0xFC,
-    0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0,
-    0x7F, 0xC1, 0xFF, 0x07, 0xFD, 0x1F, 0xF4, 0xBF, 0xE2, 0xFF, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xBF, 0xD0,
-    0x01, 0xFF, 0x07, 0xFD, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x54, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x2F, 0xD0,
-    0xBF, 0x42, 0xFE, 0x0B, 0xF8, 0x3F, 0xE0, 0xFF, 0x83, 0xFF, 0x0F, 0xFC, 0x7F, 0xF1, 0xFF, 0xC6,
-    0xAA, 0x1A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x55, 0x6F, 0xE5, 0x54, 0x00, 0x6F, 0x90, 0x7F, 0x00, 0x00,
-    0x1F, 0xFF, 0xF2, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xE0, 0x7F, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0xBF,
-    0xD0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00,
-    0x2F, 0xE0, 0x00, 0x1F, 0xFD, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xF8,
-    0x00, 0x0F, 0xFD, 0x2F, 0x00, 0x03, 0xFF, 0xCB, 0xC0, 0x01, 0xF5, 0xFF, 0xF0, 0x00, 0x7D, 0x2F,
-    0xF4, 0x00, 0x0F, 0x82, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x6F, 0xE4, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0x80, 0x2F, 0xF0, 0xBF, 0xC0, 0x03, 0xFC,
-    0x3F, 0xE0, 0x00, 0xFF, 0x0F, 0xF4, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x03,
-    0xFD, 0x3F, 0xE0, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x1F, 0xF9, 0xFF, 0xC0,
-    0x07, 0xFE, 0x7F, 0xF0, 0x02, 0xFF, 0xDF, 0xFC, 0x00, 0xBF, 0xFB, 0xFF, 0x00, 0x2F, 0xFC, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x3F, 0xFE,
-    0xBF, 0xF0, 0x2F, 0xF4, 0x07, 0xFE, 0x0F, 0xF8, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x0F, 0xF5, 0xFF,
-    0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0xBF, 0xAF, 0xF0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x0F, 0xF9,
-    0xFF, 0x40, 0x03, 0xFE, 0x3F, 0xF0, 0x03, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x1F, 0xFF,
-    0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xAF, 0xFC, 0x0B, 0xFD, 0x01, 0xFF, 0x83, 0xFE,
-    0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xFF, 0x9F, 0xF0, 0x00, 0x2F, 0xEB,
-    0xFC, 0x00, 0x0B, 0xF9, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFD, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
-    0xFF, 0x82, 0xFF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xEB, 0xFF, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0xFF, 0x80, 0x07, 0xFC, 0x3F, 0xC0,
-    0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x02, 0xFE, 0x7F,
-    0xC0, 0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x3F, 0xF4, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF,
-    0x40, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2E, 0x03, 0xD0, 0x00, 0x3F, 0xF0, 0xF8, 0x00, 0x1F,
-    0xFF, 0x3E, 0x00, 0x0B, 0xCF, 0xFF, 0x40, 0x02, 0xF0, 0xFF, 0xC0, 0x00, 0xBC, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xAF, 0xFC, 0x0B, 0xFD, 0x01,
-    0xFF, 0x83, 0xFE, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xFF, 0x9F, 0xF0,
-    0x00, 0x2F, 0xEB, 0xFC, 0x00, 0x0B, 0xF9, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0xFF, 0x8F,
-    0xFC, 0x00, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0B, 0xFC, 0x0B,
-    0xFC, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x3F, 0xF4, 0x3F, 0xF4, 0x0F, 0xFE,
-    0x1F, 0xFD, 0x07, 0xFF, 0x87, 0xFF, 0x80, 0x55, 0x50, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xEB, 0xFF, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0xFF, 0x80, 0x07,
-    0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x0B, 0xFA, 0xFF, 0x00,
-    0x02, 0xFE, 0x7F, 0xC0, 0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x3F, 0xF4, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFA, 0xAA, 0xAA,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1B,
-    0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x2F, 0xF5, 0xFF, 0xFE, 0x00, 0xFF, 0x8B, 0xFF, 0xFC, 0x03, 0xFC, 0x3F, 0xEF, 0xF4, 0x1F,
-    0xF0, 0xFF, 0x3F, 0xD0, 0x7F, 0xC7, 0xFC, 0xBF, 0x82, 0xFF, 0x2F, 0xE2, 0xFE, 0x07, 0xFC, 0xFF,
-    0x4F, 0xF8, 0x1F, 0xFB, 0xFC, 0x7F, 0xE0, 0x3F, 0xFF, 0xF7, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x1F, 0xF1, 0xFD,
-    0x00, 0x07, 0xFC, 0x7F, 0x80, 0x01, 0xFF, 0x1F, 0xE0, 0x00, 0x7F, 0xC3, 0xF8, 0x00, 0x1F, 0xF0,
-    0xFE, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x02, 0xFF, 0x0F, 0xF0, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x3F,
-    0xF0, 0xFF, 0x40, 0x0F, 0xFD, 0x3F, 0xF4, 0x0B, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xE0, 0x06,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x07, 0xFC, 0x7F, 0x40, 0x01, 0xFF, 0x1F, 0xE0, 0x00, 0x7F, 0xC7,
-    0xF8, 0x00, 0x1F, 0xF0, 0xFE, 0x00, 0x07, 0xFC, 0x3F, 0x80, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0xBF,
-    0xC3, 0xFC, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x0F, 0xFC, 0x3F, 0xD0, 0x03, 0xFF, 0x4F, 0xFD, 0x02,
-    0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xF8, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x3F, 0xEB, 0xFD, 0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x7F, 0x40,
-    0x01, 0xFF, 0x1F, 0xD0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x07, 0xFC, 0x3F,
-    0x80, 0x01, 0xFF, 0x0F, 0xE0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x0B, 0xFC,
-    0x3F, 0xC0, 0x03, 0xFF, 0x0F, 0xF4, 0x00, 0xFF, 0xD3, 0xFF, 0x40, 0xBF, 0xF4, 0xBF, 0xFF, 0xFF,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x01, 0x54, 0x01, 0x54, 0x02, 0xFF, 0x02, 0xFF, 0x00,
-    0xBF, 0xC0, 0xFF, 0xC0, 0x3F, 0xF4, 0x3F, 0xF4, 0x0F, 0xFE, 0x0F, 0xFD, 0x03, 0xFF, 0x87, 0xFF,
-    0x81, 0xFF, 0xF2, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x01, 0xFF, 0x1F, 0xD0,
-    0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x07, 0xFC, 0x3F, 0x80, 0x01, 0xFF, 0x0F,
-    0xE0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x03, 0xFF,
-    0x0F, 0xF4, 0x00, 0xFF, 0xD3, 0xFF, 0x40, 0xBF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x6F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x4F, 0xFC, 0x00,
-    0x07, 0xFC, 0x1F, 0xF8, 0x00, 0x2F, 0xE0, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xF0, 0x07, 0xFC,
-    0x00, 0xBF, 0xD0, 0x2F, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0x40, 0x02, 0xFF, 0x87, 0xFC, 0x00, 0x03,
-    0xFF, 0x2F, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFC, 0x07,
-    0xFE, 0xFF, 0xF0, 0x7F, 0xC2, 0xFF, 0x87, 0xFC, 0x0B, 0xFC, 0x7F, 0xC0, 0x2F, 0xE7, 0xFC, 0x00,
-    0xFE, 0x7F, 0xC0, 0x0F, 0xE3, 0xFC, 0x00, 0xFE, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x07, 0xFC, 0x3F,
-    0xC0, 0xFF, 0x83, 0xFC, 0x7F, 0xF0, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xD0,
-    0x03, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0xFF, 0x80, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0xBF, 0xF0,
-    0x02, 0xFF, 0xC2, 0xFF, 0xC0, 0x0F, 0xFF, 0x4F, 0xFF, 0x00, 0x15, 0x54, 0x15, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0xFF, 0x4F, 0xFC, 0x00, 0x07, 0xFC, 0x1F, 0xF8, 0x00, 0x2F, 0xE0, 0x3F, 0xF0,
-    0x00, 0xFF, 0x40, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0xD0, 0x2F, 0xE0, 0x00, 0xFF, 0xC0, 0xFF,
-    0x40, 0x02, 0xFF, 0x87, 0xFC, 0x00, 0x03, 0xFF, 0x2F, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0xAF,
-    0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xEA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x03, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xD0,
-    0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x55, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x2F,
-    0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x47, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x9B,
-    0xFF, 0xC0, 0x7F, 0x40, 0x3F, 0xF0, 0x3F, 0x80, 0x07, 0xFC, 0x0F, 0xD0, 0x00, 0xFF, 0x03, 0xF0,
-    0x00, 0x2F, 0xD1, 0xF8, 0x00, 0x0B, 0xF4, 0xBE, 0x00, 0x01, 0xFE, 0x1F, 0x40, 0x00, 0x7F, 0x87,
-    0xE0, 0x00, 0x2F, 0xF1, 0xFE, 0x55, 0xBF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFB, 0xFD, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x0A,
-    0x94, 0x02, 0xA8, 0x00, 0x00, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1B,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xD3, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF4,
-    0x00, 0x00, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF,
-    0xC0, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x55, 0xFF, 0xD0,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0x47, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x0A, 0xA4, 0x01, 0xA8, 0x03, 0xFD, 0x01,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFE, 0x6F, 0xFF, 0x01, 0xFD, 0x00, 0xFF, 0xC0, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x03,
-    0xFC, 0x0F, 0xC0, 0x00, 0xBF, 0x47, 0xE0, 0x00, 0x2F, 0xD2, 0xF8, 0x00, 0x07, 0xF8, 0x7D, 0x00,
-    0x01, 0xFE, 0x1F, 0x80, 0x00, 0xBF, 0xC7, 0xF9, 0x56, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xEF, 0xF4, 0x02, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x81, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x95, 0x5F, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0,
-    0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF4, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0F, 0xF9, 0xBF, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xF0, 0x03, 0xF8, 0x00, 0x7F, 0xC0,
-    0x0F, 0xD0, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x02, 0xFD, 0x01, 0xF8, 0x00, 0x0B, 0xF4, 0x0B, 0xE0,
-    0x00, 0x1F, 0xE0, 0x1F, 0x40, 0x00, 0x7F, 0x80, 0x7E, 0x00, 0x02, 0xFF, 0x01, 0xFE, 0x55, 0xBF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x1F, 0xFF, 0xFB, 0xFD, 0x00, 0x0B, 0xFE, 0x47, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x40, 0x00, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0xAA, 0xF4, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x40, 0x5B, 0x40,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x07, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF8, 0x03,
-    0xFF, 0xFF, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x3F, 0xF8, 0x1E, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xFB, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x40, 0x00, 0x07, 0xFF, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0xAA, 0xF4, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x40, 0x5B, 0x40, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBF, 0xDF, 0xFC, 0x00, 0xBF,
-    0x80, 0xBF, 0xC0, 0xBF, 0x40, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF8,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x78, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0xAA, 0xF4,
-    0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x40, 0x5B, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0xBF,
-    0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x78,
-    0x02, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xF9, 0x00,
-    0x00, 0x2F, 0xD0, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0x7F, 0xE0,
-    0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFE, 0xAA, 0xF4, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x40, 0x5B, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x0F, 0xF4, 0x1F, 0xF0, 0x03, 0xFE, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE,
-    0x40, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x2F, 0xF4, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x1E,
-    0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFE,
-    0x40, 0x01, 0x50, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC1, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF,
-    0x00, 0x07, 0xFF, 0xF4, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x7F,
-    0xF0, 0x00, 0x00, 0x7F, 0xD7, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xF7,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xF7, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xF0, 0x00, 0x01, 0xFF,
-    0xE7, 0xFF, 0x00, 0x16, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xE0,
-    0x00, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF2, 0xFE, 0x00, 0x1F, 0xE4, 0x7F, 0xCF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0x3F, 0xD0, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x1F, 0xF4, 0x2F, 0xFF, 0x80, 0x00, 0xFF, 0x40, 0x2F, 0xFE, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0x40, 0x01, 0xFD,
-    0x00, 0x0B, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFA, 0xAF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x40,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xFF, 0x40, 0x01, 0xFF, 0xC0, 0x00,
-    0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC5, 0x5B, 0xFF,
-    0x55, 0x40, 0x02, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xF3, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xF0, 0x01, 0x6F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x55,
-    0x7F, 0xD5, 0x50, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE4, 0x7F, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF4,
-    0x2F, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0xBF, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x80, 0x07, 0xF4,
-    0x00, 0x3F, 0xF8, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x7F,
-    0x40, 0x03, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFA, 0xAF, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x02, 0xFF, 0xFF, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF5, 0x55, 0xA0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0xAF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF,
-    0x41, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0xFF, 0xAA, 0xAF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x95, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0xB0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xFE, 0x40, 0x02, 0xA9,
-    0x00, 0xAA, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xAA, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF5, 0x55,
-    0xA0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x83,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0xBF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xE0, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0x41, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0xFF, 0xAA, 0xAF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x95, 0x40, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0xB0, 0xBF, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xFE,
-    0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x55,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xF5, 0x55, 0xA0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x41, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0xFF, 0xAA, 0xAF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x95,
-    0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0xB0, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x6F, 0xFE, 0x40, 0x06, 0xAA, 0xAF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFA, 0x55, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xD5, 0x56, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x55, 0x54, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x00,
-    0xFD, 0x0F, 0xFA, 0xAA, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x6F, 0xF9, 0x54, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xFD, 0x00, 0x0B, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x1F, 0xEA, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x06, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x40, 0x0F, 0xF4, 0x0B,
-    0xF8, 0x00, 0x0F, 0xF9, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xE9, 0x55, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x55, 0x5A, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x55, 0x55, 0x50,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1A, 0x80, 0x00,
-    0x6A, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x3F, 0xE1, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xF4,
-    0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0xFD, 0x0F, 0xFA, 0xAA, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F, 0xF9, 0x54, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x0B, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x7F, 0xD0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xBE, 0xA5, 0x40, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x69, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x1A, 0x50, 0x00, 0x07, 0xFF, 0x80,
-    0x01, 0xFF, 0xFF, 0xA0, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xF8, 0x3F, 0xFC, 0x00, 0x06, 0xFF, 0xFF, 0x83, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFC, 0x2F, 0xFF,
-    0x40, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xFF, 0x50, 0x06, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0xFA,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x0B, 0xFD, 0xFF, 0x80, 0x02, 0xFE, 0x02,
-    0xFE, 0x00, 0xBF, 0x40, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x4B,
-    0xF8, 0x01, 0xFF, 0xFE, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFE, 0xFF, 0xFF, 0x42, 0xFC,
-    0x02, 0xFF, 0xF4, 0x3F, 0x40, 0x0F, 0xFF, 0x47, 0xF0, 0x00, 0x7F, 0xF4, 0x7E, 0x00, 0x03, 0xFF,
-    0x4B, 0xE0, 0x00, 0x3F, 0xF4, 0xBE, 0x00, 0x03, 0xFF, 0x07, 0xF0, 0x00, 0x7F, 0xF0, 0x7F, 0x80,
-    0x1F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x1B, 0xA1, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0x0F, 0xFE, 0xFF, 0xF8, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x16, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x2F, 0xF5, 0x5F, 0xF0, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xBE, 0xA5, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0x90, 0x00, 0x69, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x1A, 0x50, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xA0, 0x3F, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0x43, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x06, 0xFF, 0xFF, 0x83, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFC, 0x2F, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xFF, 0x50, 0x06,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x40, 0x00, 0x01, 0xA9, 0x40, 0x2A, 0x40, 0xBF, 0x80,
-    0x2F, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x92, 0xFE, 0x01, 0xFF, 0xFE, 0xFF,
-    0x81, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xEF, 0xFF, 0xF4, 0xBF, 0x00, 0xBF, 0xFD, 0x3F, 0x40, 0x0F,
-    0xFF, 0x5F, 0xC0, 0x01, 0xFF, 0xD7, 0xE0, 0x00, 0x3F, 0xF6, 0xF8, 0x00, 0x0F, 0xFD, 0xBE, 0x00,
-    0x03, 0xFF, 0x1F, 0xC0, 0x01, 0xFF, 0xC7, 0xF8, 0x01, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1B, 0xA1, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x38, 0x00, 0x3F,
-    0xF0, 0x0F, 0xFE, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x16, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAB, 0xEA,
-    0x54, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xF9, 0x00,
-    0x06, 0x90, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xA5, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x1F, 0xFF, 0xFA, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF4, 0x3F, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xC2, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xFF, 0xF5, 0x00, 0x6F, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x92, 0xFE, 0x01, 0xFF, 0xFE, 0xFF, 0x81, 0xFF, 0xFF, 0xFF,
-    0xE0, 0xFF, 0xEF, 0xFF, 0xF4, 0xBF, 0x00, 0xBF, 0xFD, 0x3F, 0x40, 0x0F, 0xFF, 0x5F, 0xC0, 0x01,
-    0xFF, 0xD7, 0xE0, 0x00, 0x3F, 0xF6, 0xF8, 0x00, 0x0F, 0xFD, 0xBE, 0x00, 0x03, 0xFF, 0x1F, 0xC0,
-    0x01, 0xFF, 0xC7, 0xF8, 0x01, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xA1, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x38, 0x00, 0x3F, 0xF0, 0x0F, 0xFE, 0xFF,
-    0xF8, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x16, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xBE, 0xA5, 0x40, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x69, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x1A, 0x50, 0x00, 0x07, 0xFF, 0x80, 0x01,
-    0xFF, 0xFF, 0xA0, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xFC, 0x00, 0x06, 0xFF, 0xFF, 0x83, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFC, 0x2F, 0xFF, 0x40,
-    0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xFF, 0x50, 0x06, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x2F, 0xE0, 0x1F, 0xFF, 0xEF,
-    0xF8, 0x1F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFE, 0xFF, 0xFF, 0x4B, 0xF0, 0x0B, 0xFF, 0xD3, 0xF4, 0x00,
-    0xFF, 0xF5, 0xFC, 0x00, 0x1F, 0xFD, 0x7E, 0x00, 0x03, 0xFF, 0x6F, 0x80, 0x00, 0xFF, 0xDB, 0xE0,
-    0x00, 0x3F, 0xF1, 0xFC, 0x00, 0x1F, 0xFC, 0x7F, 0x80, 0x1F, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x01, 0xBA, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x03, 0x80, 0x03,
-    0xFF, 0x00, 0xFF, 0xEF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x01, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x00, 0x0F, 0xF0,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC2, 0xFF,
-    0x40, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x2F,
-    0xF8, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC3,
-    0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x1F, 0xFD,
-    0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x3F, 0xFC, 0x00, 0x01, 0xFF,
-    0xD3, 0xFF, 0xD5, 0x55, 0x6F, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xE3, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x7F, 0xFD, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0x81, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x01, 0x50, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFE, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00,
-    0xFF, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xFF, 0x00,
-    0x03, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xF0,
-    0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0xBF,
-    0xF4, 0x02, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC,
-    0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x00,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x41,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD0, 0x0F,
-    0xFF, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xFF, 0xD5, 0x55, 0x6F, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF8, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xC0, 0x3F, 0xFD, 0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x40, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x05, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x3A, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF2,
-    0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF,
-    0xFE, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x3F,
-    0xF0, 0x00, 0x3F, 0x40, 0x03, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x80, 0x03,
-    0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x0B, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x07, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0xBF, 0xF4, 0x02, 0xFF, 0xC0, 0x0B, 0x80, 0xF4, 0xFF, 0xC3,
-    0xF3, 0xFF, 0xCF, 0xDF, 0x6F, 0xFE, 0xBC, 0x3F, 0xF6, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xD0, 0x02, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x2F, 0xF8,
-    0x00, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
-    0xC0, 0x0F, 0xFF, 0x00, 0x0B, 0x90, 0xB8, 0x2F, 0xF4, 0xBC, 0x3F, 0xFC, 0xBC, 0x7D, 0x7F, 0xFC,
-    0x7D, 0x2F, 0xF8, 0x3E, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x02,
-    0xFF, 0x80, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x55, 0xA4, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xFE, 0x2A, 0xAA, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xAF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFE, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0F, 0xFC, 0x03, 0xFF,
-    0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFC,
-    0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0xBF, 0xD0, 0x2F, 0xF4,
-    0x0B, 0xFD, 0x02, 0xFF, 0x80, 0xFF, 0xE0, 0x3F, 0xF8, 0x0F, 0xFE, 0x03, 0xFF, 0xC0, 0xFF, 0xF0,
-    0x3F, 0xFC, 0x0F, 0xFF, 0x07, 0xF4, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0xBF, 0xFC, 0x1F, 0xFF, 0x01,
-    0xFF, 0xC0, 0x01, 0x50, 0x05, 0x50, 0x1F, 0xF0, 0x2F, 0xF4, 0x2F, 0xF8, 0x3F, 0xF8, 0x3F, 0xFC,
-    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xF0,
-    0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF4, 0x2F, 0xF8, 0x2F, 0xF8, 0x0B, 0xF8, 0x2F, 0xF0, 0x3F, 0xC0,
-    0xBF, 0x40, 0xFF, 0x00, 0xFF, 0xFD, 0xBF, 0xFE, 0x2F, 0xFE, 0x02, 0xFD, 0x05, 0x50, 0x2F, 0xF0,
-    0x3F, 0xF0, 0x3F, 0xF4, 0x3F, 0xF4, 0x7F, 0xF8, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0,
-    0x3F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0,
-    0x2F, 0xF0, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8,
-    0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x15, 0x43, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3,
-    0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xDB, 0xFE,
-    0xBF, 0xE0, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xF6, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xCB, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xF1, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0xC7, 0xFD, 0x00, 0x00, 0x0B, 0xFE, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0xF8,
-    0x3F, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x43, 0xFE, 0x00, 0x00, 0x0F,
-    0xFD, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0,
-    0x00, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x07, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x1F,
-    0xFC, 0x00, 0x00, 0xBF, 0xD0, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0x0F, 0xFD,
-    0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x2F, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF4, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xE4,
-    0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x2F, 0x41, 0xFF, 0x00, 0x03, 0xF8, 0x2F, 0xF4, 0x00, 0x7F, 0xC2, 0xFF,
-    0x80, 0x07, 0xFC, 0x3F, 0xF8, 0x00, 0xBF, 0xC3, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0xFF, 0x00, 0x07, 0xF8, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x07, 0xF8,
-    0x0F, 0xF0, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x07, 0xF4, 0x0F, 0xF0, 0x00, 0x7F, 0x40, 0xFF, 0x00,
-    0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0xBF, 0x01,
-    0xFF, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0xBF, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xF4, 0x00,
-    0xFF, 0x02, 0xFF, 0x80, 0x0F, 0xE0, 0x2F, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0xBB, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x15, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0x90, 0x7F, 0xFC, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x16, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x01, 0xFF, 0xBF, 0xD0, 0x01, 0xFF, 0x07, 0xFD, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x54,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x10, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x2F,
-    0xFD, 0x00, 0x03, 0xFF, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0x1F,
-    0xFD, 0x00, 0x00, 0x7F, 0xE3, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xDF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFA, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0x8B, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xF8, 0x07, 0xFF, 0xFF, 0x43, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x02, 0xFE, 0x05, 0x54, 0x00, 0x2F, 0xD2, 0xFF, 0x40, 0x02, 0xFD, 0x7F, 0xE0,
-    0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xEF, 0xFF, 0x80, 0x07, 0xFD, 0x7F, 0xFF, 0x00, 0x7F, 0xD2,
-    0xFF, 0xFC, 0x07, 0xFE, 0x0F, 0xFF, 0xF0, 0xBF, 0xE0, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x01,
-    0x50, 0x55, 0x00, 0x1F, 0x83, 0xF8, 0x00, 0xBD, 0x2F, 0xC0, 0x02, 0xF5, 0xFD, 0x00, 0x0F, 0xCF,
-    0xF0, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x2F, 0xBF, 0xF4, 0x00,
-    0xFE, 0x3F, 0xF4, 0x03, 0xF8, 0x7F, 0xF8, 0x0F, 0xE0, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0xBF, 0xD3, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x0B, 0xF0, 0x03, 0xF4, 0x02,
-    0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x2F, 0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0xFF,
-    0x40, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC,
-    0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0,
-    0x07, 0xFF, 0xF2, 0xFF, 0xFD, 0xBF, 0xFF, 0xAF, 0xFF, 0xF0, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0xAA, 0xAB, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0x00,
-    0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0x40, 0x02, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xD0,
-    0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0xBF, 0xFF, 0x42, 0xFF, 0xFE, 0x0B,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0xC0, 0x2F, 0xFF, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xD0,
-    0x0F, 0xFF, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0x01, 0xFF, 0x80,
-    0x1F, 0xE0, 0x1F, 0xF8, 0x01, 0xFE, 0x01, 0xFF, 0x80, 0x2F, 0xE0, 0x1F, 0xF8, 0x02, 0xFE, 0x02,
-    0xFF, 0x80, 0x3F, 0xD0, 0x2F, 0xF8, 0x03, 0xFD, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0xAA, 0xAF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xE0, 0x7F, 0xC1, 0xFE, 0x0B, 0xFC, 0x2F, 0xD0, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x05, 0x50, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0xFF,
-    0x80, 0x2F, 0xF4, 0x1F, 0xF8, 0x02, 0xFF, 0x81, 0xFF, 0x80, 0x3F, 0xF8, 0x1F, 0xF8, 0x03, 0xFF,
-    0xC1, 0xFF, 0x80, 0x7F, 0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xAA,
-    0xAB, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFD, 0x05, 0x50, 0x3F, 0xD0,
-    0xFF, 0x83, 0xFC, 0x1F, 0xF8, 0x3F, 0xC1, 0xFF, 0xC3, 0xFC, 0x2F, 0xFC, 0x3F, 0xC3, 0xFF, 0xC3,
-    0xFC, 0x3F, 0xFC, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0xAA, 0xBF,
-    0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0F, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x87, 0xFC,
-    0x00, 0x01, 0x6F, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x0B,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x6A, 0xA0, 0x00, 0x03, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0xBF, 0xFC, 0x00, 0x07, 0xFD,
-    0x0B, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0xBF, 0xFF, 0x00, 0x0B, 0xFC, 0x0F, 0xFF, 0xF4, 0x00, 0xBF,
-    0xC0, 0xFF, 0xFF, 0xC0, 0x0B, 0xFC, 0x0F, 0xFF, 0xFD, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0xFF, 0xC0, 0xFF, 0xEF, 0xFC, 0x0F, 0xFC, 0x1F, 0xFD, 0xBF, 0xC0,
-    0xFF, 0xC1, 0xFF, 0xE3, 0xFE, 0x0F, 0xFC, 0x1F, 0xFE, 0x3F, 0xF0, 0xFF, 0x82, 0xFF, 0xE1, 0xFF,
-    0x9F, 0xF8, 0x2F, 0xFE, 0x0F, 0xFE, 0xFF, 0x82, 0xFF, 0xE0, 0xBF, 0xFF, 0xF8, 0x2F, 0xFE, 0x03,
-    0xFF, 0xFF, 0x83, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4, 0x3F, 0xFF, 0x01, 0xFF, 0xFF, 0x43, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x43, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x3F, 0xFF,
-    0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC6, 0xFE, 0x40, 0x07, 0xFF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF4, 0x2F, 0xF8, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x3F,
-    0xC3, 0xFE, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0xFF, 0x4F, 0xF8, 0x00,
-    0x3F, 0xD3, 0xFE, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x03, 0xFE, 0x3F, 0xF0, 0x01, 0xFF, 0x9F, 0xFC,
-    0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x2F, 0xFD, 0xFF, 0xC0, 0x0B, 0xFF, 0xBF, 0xF0, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x6A, 0xA0, 0x00, 0x03, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x7F,
-    0xD0, 0xBF, 0xFC, 0x00, 0x07, 0xFD, 0x0B, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0xBF, 0xFF, 0x00, 0x0B,
-    0xFC, 0x0F, 0xFF, 0xF4, 0x00, 0xBF, 0xC0, 0xFF, 0xFF, 0xC0, 0x0B, 0xFC, 0x0F, 0xFF, 0xFD, 0x00,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0xFF, 0xC0, 0xFF, 0xEF, 0xFC,
-    0x0F, 0xFC, 0x1F, 0xFD, 0xBF, 0xC0, 0xFF, 0xC1, 0xFF, 0xE3, 0xFE, 0x0F, 0xFC, 0x1F, 0xFE, 0x3F,
-    0xF0, 0xFF, 0x82, 0xFF, 0xE1, 0xFF, 0x9F, 0xF8, 0x2F, 0xFE, 0x0F, 0xFE, 0xFF, 0x82, 0xFF, 0xE0,
-    0xBF, 0xFF, 0xF8, 0x2F, 0xFE, 0x03, 0xFF, 0xFF, 0x83, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0x01, 0xFF, 0xFF, 0x43, 0xFF, 0xF0, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x43, 0xFF,
-    0xF0, 0x03, 0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF1, 0xBF, 0xA0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xFD, 0x0B, 0xFE, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x03, 0xFC, 0x3F, 0xD0,
-    0x00, 0xFF, 0x4F, 0xF4, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x03, 0xFE, 0x3F,
-    0xE0, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x0B, 0xFF,
-    0x7F, 0xF0, 0x02, 0xFF, 0xEF, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF8, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x06, 0xAA, 0x00, 0x00, 0x3F, 0xD0, 0x7F,
-    0xF8, 0x00, 0x07, 0xFD, 0x0B, 0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0xBF, 0xFD, 0x00, 0x07, 0xFC, 0x0B,
-    0xFF, 0xF0, 0x00, 0xBF, 0xC0, 0xFF, 0xFF, 0x40, 0x0B, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xC0,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x0F, 0xFC,
-    0x0F, 0xFE, 0xFF, 0xC0, 0xFF, 0xC1, 0xFF, 0xDB, 0xFC, 0x0F, 0xFC, 0x1F, 0xFE, 0x3F, 0xE0, 0xFF,
-    0xC1, 0xFF, 0xE3, 0xFF, 0x0F, 0xF8, 0x2F, 0xFE, 0x1F, 0xF9, 0xFF, 0x82, 0xFF, 0xE0, 0xFF, 0xEF,
-    0xF8, 0x2F, 0xFE, 0x0B, 0xFF, 0xFF, 0x82, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x3F, 0xFE, 0x02, 0xFF,
-    0xFF, 0x43, 0xFF, 0xF0, 0x1F, 0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0xFF, 0xFF, 0x43, 0xFF, 0xF0, 0x07,
-    0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x03, 0xFF, 0xF0, 0x02, 0xFF, 0xF0, 0x06, 0xA0, 0x00,
-    0x1A, 0x80, 0x2F, 0xD0, 0x0F, 0xF4, 0x00, 0xBF, 0xC7, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x06, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC6, 0xFE, 0x80,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xF8,
-    0x02, 0xFF, 0x02, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x0F, 0xF4,
-    0x3F, 0xD0, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0xFF, 0x83, 0xFE, 0x00,
-    0x0F, 0xF8, 0x3F, 0xF0, 0x01, 0xFF, 0x87, 0xFF, 0x00, 0x1F, 0xF8, 0x7F, 0xF0, 0x02, 0xFF, 0xC7,
-    0xFF, 0x00, 0x2F, 0xFC, 0xBF, 0xF0, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF1, 0xBF, 0xA0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xFD, 0x0B, 0xFE, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x03, 0xFC, 0x3F, 0xD0,
-    0x00, 0xFF, 0x4F, 0xF4, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x03, 0xFE, 0x3F,
-    0xE0, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x0B, 0xFF,
-    0x7F, 0xF0, 0x02, 0xFF, 0xEF, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x6A,
-    0xA0, 0x00, 0x03, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0xBF, 0xFC, 0x00, 0x07, 0xFD, 0x0B,
-    0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0xBF, 0xFF, 0x00, 0x0B, 0xFC, 0x0F, 0xFF, 0xF4, 0x00, 0xBF, 0xC0,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFC, 0x0F, 0xFF, 0xFD, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC,
-    0x0F, 0xFF, 0xFF, 0x40, 0xFF, 0xC0, 0xFF, 0xDF, 0xFC, 0x0F, 0xFC, 0x1F, 0xFD, 0xBF, 0xC0, 0xFF,
-    0xC1, 0xFF, 0xE3, 0xFE, 0x0F, 0xFC, 0x1F, 0xFE, 0x3F, 0xF0, 0xFF, 0x82, 0xFF, 0xE1, 0xFF, 0x9F,
-    0xF8, 0x2F, 0xFE, 0x0F, 0xFE, 0xFF, 0x82, 0xFF, 0xE0, 0xBF, 0xFF, 0xF8, 0x2F, 0xFE, 0x03, 0xFF,
-    0xFF, 0x83, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0xFF, 0xFF, 0x43, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x43, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x3F, 0xFF, 0x00,
-    0x2F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x1A, 0xFA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF1, 0xBF,
-    0xA0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFE,
-    0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0xFF, 0x4F,
-    0xF4, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0xFF,
-    0x8F, 0xFC, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x0B, 0xFF, 0x7F, 0xF0, 0x02,
-    0xFF, 0xEF, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0xA9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x40, 0x7F, 0xFE, 0x00, 0x1F, 0xFE, 0x00,
-    0x02, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x42,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0x0F, 0xFF, 0xF9, 0x45, 0xBF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x02, 0xAF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF,
-    0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xEB, 0xFF, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0xFF, 0x80, 0x07,
-    0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x0B, 0xFA, 0xFF, 0x00,
-    0x02, 0xFE, 0x7F, 0xC0, 0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x3F, 0xF4, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x01, 0xA8, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x2F, 0xFF, 0x40, 0x7F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x02, 0xFF, 0xD0, 0x0B, 0xFF, 0x00,
-    0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0,
-    0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x7F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x0F, 0xFF,
-    0xF9, 0x45, 0xBF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x01, 0xA8, 0x03, 0xFD, 0x00, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xEB, 0xFF, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0xFF, 0x80, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0x5F,
-    0xF0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0xFF,
-    0x9F, 0xF4, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x3F, 0xF4, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xBF,
-    0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x1F, 0xFF,
-    0x80, 0x00, 0x7F, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xE5, 0x16, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0,
-    0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xD0, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xD0,
-    0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0xBF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xE9, 0x54, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x9A, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x55, 0x55, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x02, 0xFE, 0x40, 0x00,
-    0x7F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xF4,
-    0x07, 0xFF, 0xFD, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x0F,
-    0xFF, 0xAA, 0xBF, 0xF1, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x6F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFC, 0x00, 0x0F, 0xFE, 0x55, 0x00,
-    0x01, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xF5, 0x56, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xBF,
-    0x80, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xFA, 0xAF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x47, 0xFF, 0x40, 0x3F, 0xFC, 0x01, 0xFF, 0xC0, 0x3F, 0xFC, 0x00,
-    0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x3F, 0xFD, 0x00, 0xFF,
-    0xF0, 0x3F, 0xFD, 0x00, 0xFF, 0xF8, 0x3F, 0xFD, 0x00, 0xFF, 0xFC, 0x3F, 0xFE, 0x00, 0xFF, 0xFC,
-    0x2A, 0xA9, 0x00, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF5, 0xBF, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0x41, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0F, 0xF5, 0x56, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x1F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xFA, 0xAF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x47,
-    0xFF, 0x40, 0x3F, 0xFC, 0x01, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xFF,
-    0xE0, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x3F, 0xFD, 0x00, 0xFF, 0xF0, 0x3F, 0xFD, 0x00, 0xFF, 0xF8,
-    0x3F, 0xFD, 0x00, 0xFF, 0xFC, 0x3F, 0xFE, 0x00, 0xFF, 0xFC, 0x2A, 0xA9, 0x00, 0xAA, 0xA8, 0x07,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFD, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD6, 0xFC,
-    0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0x04, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x01,
-    0xFE, 0x00, 0x07, 0xFD, 0x0B, 0xF8, 0x00, 0x01, 0xFF, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0F, 0xF5, 0x56, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xFA, 0xAF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFF, 0x47, 0xFF, 0x40, 0x3F, 0xFC, 0x01, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xFF, 0xC0, 0x3F, 0xFC,
-    0x00, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x3F, 0xFD, 0x00, 0xFF, 0xF0, 0x3F, 0xFD, 0x00,
-    0xFF, 0xF8, 0x3F, 0xFD, 0x00, 0xFF, 0xFC, 0x3F, 0xFE, 0x00, 0xFF, 0xFC, 0x2A, 0xA9, 0x00, 0xAA,
-    0xA8, 0x2F, 0x80, 0x00, 0xBE, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x6F, 0xC0,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xD0,
-    0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFE, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x40, 0x6C, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x6F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0xF8, 0x00, 0x00, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0x07, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x3F, 0xEA,
-    0xFF, 0x00, 0x0F, 0xD0, 0x01, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xF9, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xF0, 0x01, 0x00, 0x0B, 0xFE, 0x02, 0xE0, 0x02, 0xFF, 0x81, 0xFF, 0xEA, 0xFF,
-    0xE1, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x6B, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFD, 0x01,
-    0xB0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x03, 0xE0, 0x00,
-    0x02, 0xFF, 0xD0, 0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x16, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-    0x00, 0x7F, 0xEF, 0xFC, 0x00, 0x7F, 0xC0, 0xBF, 0xC0, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xFE,
-    0xAF, 0xF0, 0x00, 0xFD, 0x00, 0x14, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02,
-    0xFF, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x10, 0x00, 0xBF, 0xE0, 0x2E, 0x00, 0x2F, 0xF8, 0x1F, 0xFE, 0xAF,
-    0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xBF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xD0, 0x1B, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x3E, 0x00, 0x00, 0x2F, 0xFD, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x01, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x0F, 0xFA, 0xBF, 0xC0, 0x03, 0xF4, 0x00, 0x50, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x40, 0x02, 0xFF, 0x80, 0x78, 0x00, 0xBF,
-    0xE0, 0x7F, 0xFA, 0xBF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0x29, 0xBE, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xE0, 0x00,
-    0x01, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x02, 0xFF, 0xF4, 0x06, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x0F, 0x80, 0x00, 0x0B, 0xFF, 0x40, 0xBF, 0xF8, 0x00, 0x7F, 0xFD, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x5B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x7F, 0xC0, 0x03, 0xFE, 0xBF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xAB, 0xFC, 0x00, 0x3F, 0x40, 0x05, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x04, 0x00, 0x2F,
-    0xF8, 0x0B, 0x80, 0x0B, 0xFE, 0x07, 0xFF, 0xAB, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xD0, 0x01, 0xAF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x97, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x00, 0x6F, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xAA,
-    0xFF, 0xAA, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0xA6,
-    0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0,
-    0x07, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x02, 0x5B, 0xD0, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x01, 0x54, 0x00,
-    0x01, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x4B, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0x40, 0x2F, 0xE0, 0x01, 0xBD, 0x00, 0xBF,
-    0x80, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x02, 0xAB, 0xFE, 0xAA, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x99, 0x00, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x15, 0x6F, 0xFD, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x0A, 0xAF, 0xFA, 0xA8, 0x00, 0x1F, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0x55, 0x7F, 0xF5, 0x54,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0x64, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x7F, 0xE1, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x5F, 0x00,
-    0x00, 0x00, 0xF8, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x87, 0xFE, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00,
-    0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC,
-    0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF,
-    0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F,
-    0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x82,
-    0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x03, 0xD0, 0x00, 0x3F, 0xF0, 0xFC, 0x00, 0x1F, 0xFF, 0x3E, 0x00, 0x0B, 0xCB,
-    0xFF, 0x80, 0x02, 0xF0, 0xFF, 0xD0, 0x00, 0x7D, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x1F,
-    0xF1, 0xFE, 0x00, 0x07, 0xFC, 0x3F, 0x80, 0x01, 0xFF, 0x0F, 0xE0, 0x00, 0x7F, 0xC3, 0xFC, 0x00,
-    0x2F, 0xF0, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x03, 0xFF, 0x0F, 0xF4, 0x00, 0xFF, 0xD3, 0xFF,
-    0x40, 0xBF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xD0,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x06, 0xAF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD3,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC,
-    0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF,
-    0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F,
-    0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02,
-    0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0xFF, 0xD0, 0x00,
-    0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x56, 0xA4, 0x03, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xF8, 0x2A,
-    0x95, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x07,
-    0xFC, 0x7F, 0x40, 0x01, 0xFF, 0x1F, 0xE0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x1F, 0xF0, 0xFE, 0x00,
-    0x07, 0xFC, 0x3F, 0x80, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x2F, 0xF0, 0xFF,
-    0x00, 0x0F, 0xFC, 0x3F, 0xD0, 0x03, 0xFF, 0x4F, 0xFD, 0x02, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x6A, 0x50, 0x0A, 0x90, 0x00, 0x07, 0xF8, 0x01, 0xFE, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00,
-    0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8,
-    0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF,
-    0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F,
-    0xFC, 0x00, 0x03, 0xFF, 0x82, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0xFF,
-    0x95, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x01, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00,
-    0x7F, 0xC7, 0xF8, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x07, 0xFC, 0x3F, 0x80, 0x01, 0xFF, 0x0F, 0xE0,
-    0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x03, 0xFF, 0x0F,
-    0xF4, 0x00, 0xFF, 0xD3, 0xFF, 0x40, 0xBF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x43, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x6F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFB,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD3,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC,
-    0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF,
-    0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F,
-    0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02,
-    0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0xFF, 0xD0, 0x00,
-    0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00,
-    0x3E, 0x7E, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x1F, 0xF1, 0xFD, 0x00,
-    0x07, 0xFC, 0x7F, 0x80, 0x01, 0xFF, 0x1F, 0xE0, 0x00, 0x7F, 0xC3, 0xF8, 0x00, 0x1F, 0xF0, 0xFE,
-    0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x02, 0xFF, 0x0F, 0xF0, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x3F, 0xF0,
-    0xFF, 0x40, 0x0F, 0xFD, 0x3F, 0xF4, 0x0B, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xE0, 0x06, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF8, 0x00,
-    0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00,
-    0xFF, 0xD0, 0x01, 0xFF, 0xD0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00,
-    0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0xFC, 0x00,
-    0x03, 0xFF, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0,
-    0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC,
-    0x00, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF8,
-    0x00, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x02, 0xFF,
-    0x80, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0x07, 0xFF, 0x80, 0x02, 0xFF,
-    0xFE, 0xAB, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00,
-    0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x7F, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xF8,
-    0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x03,
-    0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00,
-    0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x80,
-    0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8,
-    0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF,
-    0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x2F,
-    0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0xBF, 0x40, 0x00, 0xFF,
-    0x1F, 0xD0, 0x00, 0x7F, 0xC7, 0xF4, 0x00, 0x1F, 0xF1, 0xFD, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x01,
-    0xFF, 0x0F, 0xE0, 0x00, 0x7F, 0xC3, 0xF8, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xC0,
-    0x02, 0xFF, 0x0F, 0xF0, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x3F, 0xF4, 0xFF, 0x80, 0x1F, 0xFD, 0x2F,
-    0xFD, 0x5F, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFD,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x1B, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE6, 0x40, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEB, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xF0,
-    0x0B, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x0F, 0xFE,
-    0x00, 0x3F, 0xFC, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0x40, 0x0F, 0xFF, 0x41, 0xFF, 0xFF, 0x02, 0xFF,
-    0xC0, 0x02, 0xFF, 0xD0, 0xFF, 0xFF, 0xD0, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x7F, 0xFF, 0xFC, 0x3F,
-    0xF8, 0x00, 0x1F, 0xFF, 0x3F, 0xFF, 0xFF, 0x5F, 0xFD, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0xFF, 0xFB,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x2F,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x7F, 0xF0,
-    0x00, 0x00, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0x2F, 0xF0, 0x01,
-    0x40, 0x0B, 0xFC, 0x1F, 0xF4, 0x0B, 0xF0, 0x0F, 0xF8, 0x0F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x0F,
-    0xFC, 0x3F, 0xFC, 0x2F, 0xF0, 0x0B, 0xFC, 0x7F, 0xFE, 0x3F, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xBF,
-    0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xBF, 0xFF, 0x40, 0x00,
-    0xFF, 0xFD, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xFC, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFE,
-    0x00, 0x00, 0x2A, 0x90, 0x06, 0xA8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x00,
-    0x05, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x4B, 0xFE, 0x00,
-    0x00, 0x1F, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x3F,
-    0xF4, 0x00, 0x3F, 0xF8, 0x00, 0xBF, 0xF0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x0F, 0xFE, 0x00,
-    0x03, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0x43, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x1F, 0xFC,
-    0x00, 0x00, 0x1F, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0x7F, 0xDF, 0xFC, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x03, 0xFD, 0x3F, 0xF0, 0x00, 0x1F, 0xF0, 0x7F, 0xE0, 0x00, 0xBF, 0x80, 0xFF, 0xC0,
-    0x03, 0xFD, 0x00, 0xFF, 0xC0, 0x1F, 0xF0, 0x02, 0xFF, 0x40, 0xBF, 0x80, 0x03, 0xFF, 0x03, 0xFD,
-    0x00, 0x0B, 0xFE, 0x1F, 0xF0, 0x00, 0x0F, 0xFC, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xF4,
-    0x7F, 0xF4, 0x00, 0x02, 0xFF, 0xE2, 0xFF, 0xE0, 0x00, 0x05, 0x55, 0x45, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x4B, 0xFE, 0x00, 0x00,
-    0x1F, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xF4,
-    0x00, 0x3F, 0xF8, 0x00, 0xBF, 0xF0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x0F, 0xFE, 0x00, 0x03,
-    0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0x43, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x1F, 0xFC, 0x00,
-    0x00, 0x1F, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xAA, 0xAA, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD5, 0x55, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xAA, 0xAB, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x01, 0xFF, 0xF5, 0x55, 0x40, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xAA, 0xAA, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF,
-    0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD5, 0x55, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xAA, 0xAB, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF5, 0x55, 0x40, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6A, 0x00, 0x01, 0xA8,
-    0x00, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1A, 0xAA, 0xAF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x55, 0x54, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x06, 0xA0, 0x00, 0x1A, 0x80, 0x3F,
-    0xD0, 0x0F, 0xF0, 0x00, 0xFF, 0x8B, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x01, 0xAA, 0xAB, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF5, 0x55, 0x40, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0x90, 0x2F, 0xFF, 0xD0, 0xFF, 0xFF, 0x4B, 0xFF, 0xFD, 0x3F, 0xF9, 0x10, 0xFF,
-    0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01,
-    0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xC0, 0x0B, 0xFF, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x7F, 0x00, 0x07, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xF7, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0xBF, 0xF0,
-    0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xE0, 0x3F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x7F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x47, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x43, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0xE0, 0x00, 0x01,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xE5, 0x16, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x1B, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x06, 0xFF, 0x40, 0x7F,
-    0x01, 0xFF, 0xFF, 0xD2, 0xF8, 0x1F, 0xFF, 0xFF, 0xEF, 0xD0, 0xFF, 0xFA, 0xFF, 0xFF, 0x0B, 0xFD,
-    0x01, 0xFF, 0xF4, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0xFF, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x0F,
-    0xF4, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0xBF, 0xC0, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x03, 0xFE, 0x07,
-    0xFD, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xFD, 0x00, 0x7F, 0xF0, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xF4, 0x3F, 0xC3, 0xFD, 0x00, 0x0B, 0xF8,
-    0x3F, 0x87, 0xFD, 0x00, 0x0B, 0xFC, 0x3F, 0x47, 0xFD, 0x00, 0x0F, 0xFC, 0x3F, 0x47, 0xFE, 0x55,
-    0xBF, 0xFC, 0x1F, 0x47, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0x4B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0x4B,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0x4B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x69, 0x40, 0x00, 0xBF, 0xDF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x3F, 0x80, 0xBF, 0xFC, 0x00, 0x3F,
-    0x02, 0xFF, 0xE0, 0x00, 0xBE, 0x0B, 0xFF, 0x40, 0x02, 0xF8, 0x2F, 0xFD, 0x00, 0x07, 0xF0, 0xBF,
-    0xF4, 0x00, 0x1F, 0xC2, 0xFF, 0xD0, 0x00, 0xBE, 0x0B, 0xFF, 0xC0, 0x03, 0xF8, 0x2F, 0xFF, 0xE5,
-    0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFB, 0xFF, 0xF8, 0x00, 0xFF, 0xC2, 0xBA, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0x95, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFE, 0xAA, 0xAA, 0x2F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x01,
-    0xFF, 0xFA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x03, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x20, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xE0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0A, 0xAF, 0xFA, 0xA8, 0x00, 0x7F, 0xC0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xFA, 0x64, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC7,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xD0, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x03,
-    0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0xFF,
-    0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xF8,
-    0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC,
-    0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00,
-    0x00, 0xBF, 0xE0, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0xBF, 0xF4, 0x00, 0x1F, 0xFE, 0x00,
-    0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x40, 0x00, 0xFF, 0xFC,
-    0x7F, 0x40, 0x01, 0xFF, 0xF4, 0x7F, 0x40, 0x01, 0xFF, 0xE0, 0x7F, 0x80, 0x01, 0xFF, 0x40, 0x7F,
-    0x80, 0x01, 0xFF, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0xC0,
-    0x02, 0xFF, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x40, 0x3F, 0xD0, 0x03,
-    0xFF, 0x40, 0x3F, 0xF4, 0x0B, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x6F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF,
-    0xE0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBE, 0x03, 0xF4, 0x2F, 0xC0,
-    0xFE, 0x0B, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x2F, 0xF0, 0x3F, 0xD0, 0x03, 0xFC,
-    0x15, 0x00, 0x00, 0x54, 0x0B, 0xD0, 0xBC, 0x2F, 0xF4, 0xBC, 0x3F, 0xFD, 0xBC, 0x7D, 0x7F, 0xFC,
-    0x7D, 0x2F, 0xF4, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x0A, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFE, 0xAA, 0xA4, 0x00, 0x00, 0x15, 0x56, 0xA8, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x50, 0x0A, 0x97, 0xF8, 0x02, 0xFD, 0x7F, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xF0, 0xBF, 0xC3, 0xFF, 0x0F,
-    0xFD, 0x7F, 0xF5, 0xFF, 0xE1, 0x55, 0x40, 0x2F, 0xD0, 0xBF, 0x42, 0xFE, 0x0B, 0xF8, 0x3F, 0xE0,
-    0xFF, 0x83, 0xFF, 0x0F, 0xFC, 0x7F, 0xF1, 0xFF, 0xC6, 0xAA, 0x1A, 0xA8, 0x3E, 0x03, 0xFC, 0x01,
-    0xD0, 0x7C, 0x1F, 0x42, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x1F, 0xF0, 0x3F, 0xFC, 0x7D, 0xBC, 0x7D,
-    0xBD, 0x3F, 0xFC, 0x2F, 0xF8, 0x0B, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x0B, 0xFF, 0x00,
-    0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x02,
-    0xFD, 0x0F, 0xF4, 0x1F, 0xF4, 0x03, 0xFE, 0xBF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x3F, 0xD0, 0x00,
-    0x0F, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x07, 0xFF, 0xD0, 0x3F, 0xFD, 0x03, 0xFF, 0xC0, 0x2F, 0xFD, 0x00,
-    0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0x80, 0x3F, 0xFC, 0x07, 0xFF, 0xE0, 0x7F,
-    0xFD, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xBF, 0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xE0,
-    0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x7F, 0xFE, 0x03, 0xFF, 0xE0, 0x3F, 0xFE, 0x01, 0xFF, 0xE0, 0x0F,
-    0xFE, 0x00, 0xFF, 0xF0, 0x0B, 0xFF, 0x40, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x2F, 0xFD, 0x00, 0x00,
-    0x0F, 0xD0, 0x3F, 0x5F, 0xFD, 0x7F, 0xF5, 0xFF, 0xD0, 0x3F, 0x40, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x07, 0xF0, 0x1F, 0xFD, 0x7F, 0xF5, 0xFF, 0xD7, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0xA9,
-    0x50, 0x07, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC2, 0xAA, 0xAB, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x3F, 0x00, 0xFC, 0x07, 0xF0, 0xBF, 0xC3, 0xFD, 0x0B, 0xE0, 0x0D, 0x00, 0x00, 0x02,
-    0xE2, 0xF8, 0xFD, 0x7D, 0x1F, 0xE3, 0xF8, 0x3E, 0x00, 0x00, 0x02, 0xA0, 0x03, 0xF0, 0x03, 0xF0,
-    0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0x15, 0x55, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0x17, 0xF5,
-    0x07, 0xF0, 0x07, 0xF0, 0x01, 0x00, 0x2C, 0x00, 0xB0, 0x3F, 0xFC, 0x5F, 0x50, 0x2C, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x1A, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFE, 0xAA, 0x94, 0x05, 0x50, 0x1F, 0xF4, 0x1F, 0xF4, 0x2F, 0xF8, 0x3F, 0xF8, 0x3F,
-    0xFC, 0x3F, 0xFC, 0x2F, 0xD0, 0xBF, 0x42, 0xFE, 0x0B, 0xF8, 0x3F, 0xE0, 0xFF, 0x83, 0xFF, 0x0F,
-    0xFC, 0x7F, 0xF1, 0xFF, 0xC6, 0xAA, 0x1A, 0xA8, 0x01, 0x40, 0x1F, 0xF0, 0x3F, 0xFC, 0x7D, 0xBC,
-    0x7D, 0xBD, 0x3F, 0xFC, 0x2F, 0xF8, 0x0B, 0xE0, 0x0F, 0xFF, 0xC0, 0xFF, 0xF8, 0x0F, 0xFF, 0x40,
-    0xFF, 0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF,
-    0x40, 0x0F, 0x40, 0x1F, 0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x7F, 0xF8, 0x10, 0xFC, 0x3F, 0xFC, 0x7F,
-    0xF4, 0xBF, 0xD0, 0x00, 0x68, 0x00, 0xBF, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x0F, 0xE0,
-    0x03, 0xFF, 0xF0, 0xFF, 0xFD, 0x0F, 0xFF, 0x40, 0x6F, 0xC0, 0x3F, 0xC3, 0xFC, 0x3F, 0xC7, 0xFC,
-    0x7F, 0xC7, 0xFC, 0xBF, 0xCB, 0xFC, 0xBF, 0xCA, 0xA8, 0x2A, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x3F, 0xC0, 0xFF, 0x0F, 0xF0, 0x3F, 0xC3, 0xFC, 0x0F, 0xF0,
-    0x3F, 0xD0, 0x00, 0x7F, 0xD0, 0xFF, 0x80, 0x2F, 0xF4, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xF9, 0xFF, 0xC0, 0x0F, 0xFC, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x1F, 0x47, 0xFF, 0x07, 0xE2, 0xFF, 0xF1, 0xF8, 0xFD, 0xFF, 0xBD, 0x3F,
-    0x1F, 0xFF, 0x4F, 0xC2, 0xFF, 0xC3, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x3F, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x0A, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0x7F,
-    0xFE, 0xAA, 0x94, 0x07, 0xF4, 0x1F, 0x47, 0xFF, 0x07, 0xE2, 0xFF, 0xF1, 0xF8, 0xFD, 0xFF, 0xBD,
-    0x3F, 0x1F, 0xFF, 0x4F, 0xC2, 0xFF, 0xC3, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x54, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x2E, 0x0B,
-    0xF2, 0xFE, 0x0F, 0xEF, 0xFB, 0xF6, 0xF8, 0x64, 0x00, 0x00, 0x54, 0x00, 0x00, 0x3F, 0xE0, 0x3F,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFE, 0x3F, 0x40, 0xFE, 0x3F, 0x40, 0xFE, 0x3F, 0x40, 0xFE, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xFE, 0x15, 0x55, 0x54, 0x0B, 0xEB, 0xD0, 0xFF, 0xFF, 0xC7, 0xEF, 0xFF, 0x5F, 0x2F,
-    0x7E, 0xBC, 0xBC, 0xBA, 0xE2, 0xF2, 0xEB, 0x8B, 0xCB, 0x40, 0x00, 0x00, 0x0F, 0x0F, 0x01, 0xEF,
-    0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x07, 0xFC, 0x07, 0xCB, 0xC2, 0x90, 0xA4, 0x0B, 0xD0, 0xBC, 0x2F,
-    0xF4, 0xBC, 0x3F, 0xFD, 0xBC, 0x7D, 0x7F, 0xFC, 0x7D, 0x2F, 0xF4, 0x3E, 0x07, 0xD0, 0x00, 0x0B,
-    0x80, 0xBF, 0x0B, 0xF8, 0x7F, 0xC7, 0xF8, 0xBE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0xBF, 0x42, 0xFE, 0x0B, 0xF8, 0x3F, 0xE0, 0xFF, 0x83, 0xFF, 0x0F, 0xFC,
-    0x7F, 0xF1, 0xFF, 0xC6, 0xAA, 0x1A, 0xA8, 0x2A, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFC, 0x3F, 0xC0, 0xFF, 0x0F, 0xF0, 0x3F, 0xC3, 0xFC, 0x0F, 0xF0, 0x05, 0x5A,
-    0xAF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFD, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x1B, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFA, 0xAA, 0x94, 0x1A, 0x40, 0x6A, 0x0F, 0xF0, 0x3F,
-    0xC3, 0xFC, 0x0F, 0xF0, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x0F, 0xF0, 0x3F, 0xC7, 0xFC, 0x0F,
-    0xF1, 0xFF, 0x07, 0xFC, 0x7F, 0xC1, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x1A,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xBF, 0x1F, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xDF, 0xD2, 0xFF, 0xFF, 0xFF, 0x4F, 0xE2, 0xFF, 0xFC, 0x3F,
-    0x83, 0xFF, 0xE0, 0xBF, 0x1F, 0xFE, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA9, 0x00, 0x02, 0xAA, 0x40,
-    0x3F, 0xFF, 0xFD, 0x00, 0x2F, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x2F, 0xFE, 0x3F, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x42, 0xFF, 0xF2, 0xF4, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x01, 0x50,
-    0x0F, 0xFF, 0xD0, 0x3F, 0xC2, 0xFF, 0xFF, 0x83, 0xFC, 0x3F, 0xD3, 0xFD, 0x3F, 0xC3, 0xFC, 0x1F,
-    0xFF, 0xF8, 0x2F, 0xD0, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x01, 0x50, 0x0F, 0xFF, 0xD0, 0x3F, 0xC2, 0xFF, 0xFF, 0x43, 0xFC, 0x3F, 0xC7, 0xFD,
-    0x7F, 0xC7, 0xFC, 0x1F, 0xFF, 0xF8, 0x2F, 0xD0, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x80, 0x00, 0xFF, 0x4B,
-    0xA0, 0x01, 0xBC, 0x7F, 0xC0, 0x00, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x07, 0x83, 0xF8, 0x34, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xC7, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x1F,
-    0xF8, 0x00, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xFF, 0xAB, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x0A, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x5A, 0xA5, 0x40, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xF9, 0x00, 0x01, 0xBF,
-    0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0xFF,
-    0x90, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x81, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x95, 0x5F, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0,
-    0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF4, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0xFE,
-    0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x7F, 0xE0, 0x01, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xC0,
-    0x7F, 0xE0, 0x00, 0x3F, 0xC0, 0x7F, 0xE0, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x16, 0xFF, 0x80, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xE0, 0x00, 0xBF, 0xF4, 0x7F, 0xE0, 0x00, 0x1F, 0xFC, 0x7F, 0xE0, 0x00,
-    0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x1F, 0xFC, 0x7F, 0xE5, 0x55, 0xBF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x15, 0x55, 0x55, 0x51, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF1, 0xFD, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xEF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x7F, 0xF0, 0x00,
-    0x00, 0xFF, 0xD0, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x03, 0xFF,
-    0x40, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0xBF, 0xF0, 0x00,
-    0x3F, 0xF8, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xC7, 0xFF, 0xD5, 0x55, 0x5F, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x06, 0xAA, 0xAF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFA, 0x55, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD5, 0x56, 0x80,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x55, 0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6A, 0xAA, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xF5, 0x55, 0x50, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x40,
-    0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x2F, 0xF8,
-    0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC3, 0xFF,
-    0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x1F, 0xFD, 0x3F,
-    0xFC, 0x00, 0x01, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD3,
-    0xFF, 0xD5, 0x55, 0x6F, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xE3, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x7F, 0xFD, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF4, 0x07, 0xFF,
-    0xE0, 0x01, 0xFF, 0xE0, 0x00, 0x2F, 0xFD, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF,
-    0xC3, 0xFF, 0x05, 0x6A, 0xFD, 0x3F, 0xF0, 0xFF, 0xC7, 0xFF, 0xFF, 0x8F, 0xFC, 0x3F, 0xF2, 0xFF,
-    0xFF, 0xF3, 0xFF, 0x5F, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xD7, 0xFF, 0x2A, 0xA5, 0x50, 0x3F, 0xF4,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0xC3, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0xFF, 0xFF, 0x94, 0x5B, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1B, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x2F, 0xF0, 0x2F,
-    0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF4, 0x2F,
-    0xF4, 0x2F, 0xF4, 0x2F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F,
-    0xFC, 0x3F, 0xFC, 0x02, 0xFF, 0x00, 0xBF, 0xF4, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-    0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x7F, 0xF8, 0x00, 0x03, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0x3F,
-    0xE1, 0xFF, 0xD0, 0x00, 0x07, 0xFE, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xDB, 0xFF, 0x40, 0x00, 0x0B,
-    0xFD, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00,
-    0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xAF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xF8, 0xBF, 0xFF, 0xC0, 0x03, 0xFF, 0x83, 0xFF, 0xFF, 0x00, 0x3F, 0xF8, 0x0F, 0xFF,
-    0xFC, 0x03, 0xFF, 0x80, 0x7F, 0xFF, 0xF4, 0x3F, 0xF8, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xEF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xE3, 0xFF,
-    0xE0, 0x00, 0x00, 0xFF, 0xF0, 0xBF, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x0F, 0xFF, 0x40, 0x00, 0x2F,
-    0xFD, 0x02, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFF,
-    0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xF4,
-    0x00, 0x0B, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xFC,
-    0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xD0, 0x00,
-    0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0x01, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x42, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xF4, 0x2F, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x42, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
-    0xF4, 0x2F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xF4, 0x2F, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x0B, 0xFF,
-    0xFF, 0x83, 0xFF, 0x7F, 0xF4, 0xFF, 0xEF, 0xF8, 0x3F, 0xF3, 0xFF, 0x9F, 0xFE, 0xFF, 0x83, 0xFF,
-    0x2F, 0xFF, 0xFF, 0xAF, 0xF8, 0x3F, 0xF5, 0xFF, 0xFF, 0xF2, 0xFF, 0xC3, 0xFF, 0x4F, 0xFF, 0xFF,
-    0x3F, 0xFC, 0x3F, 0xF4, 0xBF, 0xFF, 0xE3, 0xFF, 0xC3, 0xFF, 0x87, 0xFF, 0xFD, 0x3F, 0xFC, 0x3F,
-    0xF8, 0x3F, 0xFF, 0xC3, 0xFF, 0xC3, 0xFF, 0x82, 0xFF, 0xF8, 0x3F, 0xFC, 0x3F, 0xF8, 0x0F, 0xFF,
-    0x47, 0xFF, 0xC3, 0xFF, 0xC0, 0xFF, 0xF0, 0x7F, 0xFC, 0x3F, 0xFC, 0x0B, 0xFF, 0x07, 0xFF, 0xC3,
-    0xFF, 0xC0, 0x3F, 0xD0, 0xBF, 0xFC, 0x7F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x6A, 0xA0, 0x00, 0x03, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0xBF, 0xFC,
-    0x00, 0x07, 0xFD, 0x0B, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0xBF, 0xFF, 0x00, 0x0B, 0xFC, 0x0F, 0xFF,
-    0xF4, 0x00, 0xBF, 0xC0, 0xFF, 0xFF, 0xC0, 0x0B, 0xFC, 0x0F, 0xFF, 0xFD, 0x00, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0xFF, 0xC0, 0xFF, 0xEF, 0xFC, 0x0F, 0xFC, 0x1F,
-    0xFD, 0xBF, 0xC0, 0xFF, 0xC1, 0xFF, 0xE3, 0xFE, 0x0F, 0xFC, 0x1F, 0xFE, 0x3F, 0xF0, 0xFF, 0x82,
-    0xFF, 0xE1, 0xFF, 0x9F, 0xF8, 0x2F, 0xFE, 0x0F, 0xFE, 0xFF, 0x82, 0xFF, 0xE0, 0xBF, 0xFF, 0xF8,
-    0x2F, 0xFE, 0x03, 0xFF, 0xFF, 0x83, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4, 0x3F, 0xFF, 0x01, 0xFF, 0xFF,
-    0x43, 0xFF, 0xF0, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x43, 0xFF, 0xF0, 0x03, 0xFF,
-    0xF0, 0x3F, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF4, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xE0, 0x00, 0x2F, 0xFD, 0x00,
-    0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFC, 0x00, 0x00,
-    0x0B, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x5F, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0xF0, 0xFF, 0xFF, 0x94, 0x5B, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1B, 0xFF,
-    0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01,
-    0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01,
-    0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01,
-    0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01,
-    0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01,
-    0xFE, 0x6A, 0x40, 0x01, 0xA9, 0x0A, 0xAA, 0xA9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xF4, 0x01, 0xFF, 0xC0, 0x3F, 0xD0, 0x00,
-    0xFF, 0x40, 0xFF, 0x40, 0x02, 0xFE, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x1F, 0xF4, 0x00, 0x3F, 0xF0,
-    0x7F, 0xE5, 0x5B, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x90,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xAA, 0xAA, 0x3F, 0xF4, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x02, 0xFF, 0xFA, 0xAA, 0xAB,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF4, 0xBF, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xD0, 0x00, 0x0F, 0xFD,
-    0x02, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x1F,
-    0xFC, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF4,
-    0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xDF, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xD3, 0xFD, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x3F, 0xD0, 0x3F,
-    0xFF, 0x00, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0xFF, 0xF8, 0x1F, 0xFF, 0x00, 0x3F, 0xC0, 0x0B, 0xFF,
-    0xC3, 0xFF, 0xE0, 0x07, 0xFC, 0x00, 0x3F, 0xFD, 0x3F, 0xFD, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xE3,
-    0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x2F, 0xFE, 0x3F, 0xFC, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0xE3, 0xFF,
-    0xC0, 0x07, 0xFC, 0x00, 0x3F, 0xFE, 0x3F, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xE3, 0xFF, 0xF4,
-    0x07, 0xFC, 0x00, 0xFF, 0xFD, 0x2F, 0xFF, 0xF9, 0xBF, 0xC6, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x7F,
-    0xE0, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF8,
-    0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x7F, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x7F, 0xFE,
-    0x00, 0x00, 0x7F, 0xFD, 0x2F, 0xFF, 0x40, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0,
-    0x0B, 0xFF, 0xE0, 0x0B, 0xFF, 0xD0, 0x03, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x3F,
-    0xFF, 0x40, 0x00, 0xFF, 0xFE, 0x15, 0x40, 0x01, 0x54, 0x15, 0x47, 0xFC, 0x00, 0x3F, 0x83, 0xFC,
-    0x7F, 0xC0, 0x03, 0xF8, 0x3F, 0xC7, 0xF8, 0x00, 0x3F, 0x83, 0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x3F,
-    0xC7, 0xF8, 0x00, 0x3F, 0x83, 0xFC, 0x3F, 0xC0, 0x03, 0xF8, 0x7F, 0xC3, 0xFC, 0x00, 0x3F, 0x4B,
-    0xF8, 0x3F, 0xD0, 0x03, 0xF4, 0xFF, 0x43, 0xFF, 0x00, 0x3F, 0x6F, 0xF4, 0x1F, 0xF8, 0x03, 0xFF,
-    0xFF, 0x00, 0xFF, 0xF4, 0x7F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x6F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x16, 0x94, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x01, 0xFF, 0xE0, 0x1B, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0xBF, 0xD0, 0x00,
-    0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xC0,
-    0x00, 0x00, 0x7F, 0xD2, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x4B, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x2F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xD2, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0x47, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xF0, 0x00, 0x03,
-    0xFF, 0x80, 0x3F, 0xF0, 0x00, 0xBF, 0xFC, 0x06, 0xFF, 0xFC, 0x0B, 0xFF, 0xE4, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0x8F, 0xFF,
-    0xFD, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF9,
-    0xBF, 0xFC, 0x00, 0x1F, 0xD0, 0x0F, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0x40, 0x03,
-    0xFC, 0x00, 0x3F, 0x00, 0x02, 0xFD, 0x00, 0x7E, 0x00, 0x02, 0xFD, 0x00, 0xBE, 0x00, 0x01, 0xFE,
-    0x00, 0x7D, 0x00, 0x01, 0xFE, 0x00, 0x7E, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0x95, 0x6F, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x5F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
-    0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0xBF, 0xE4, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x2F, 0xFD, 0x6F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0xFE, 0x07, 0xFC, 0x00,
-    0x1F, 0xD0, 0x7F, 0xC0, 0x03, 0xFC, 0x07, 0xFC, 0x7F, 0xFF, 0x80, 0x7F, 0xCB, 0xFF, 0xF0, 0x07,
-    0xFC, 0xBF, 0xFF, 0xC0, 0x7F, 0xCB, 0xFF, 0xFF, 0x07, 0xFC, 0x00, 0x2F, 0xF8, 0x7F, 0xC0, 0x00,
-    0xBF, 0xC7, 0xFC, 0x00, 0x07, 0xFD, 0x7F, 0xF8, 0x00, 0xBF, 0xD7, 0xFF, 0xF9, 0x1F, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x7F, 0xC7, 0xFF, 0xFE, 0x07, 0xFC, 0x06, 0xFF, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x83, 0xFD, 0x00, 0x0F, 0xF8, 0x3F, 0xF0,
-    0x00, 0xFF, 0x81, 0xFF, 0x40, 0x0B, 0xF8, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x0F, 0xFC,
-    0x03, 0xFF, 0x00, 0xFF, 0x80, 0x2F, 0xF8, 0x0F, 0xF8, 0x00, 0xFF, 0xC1, 0xFF, 0x40, 0x0B, 0xFE,
-    0x2F, 0xF0, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x2F, 0xE0, 0x01, 0xBE, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF,
-    0xAF, 0xFF, 0x83, 0xFF, 0xC0, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0xD7, 0xFF, 0x00, 0x07, 0xFE,
-    0x7F, 0xF0, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x0B, 0xFD, 0x3F, 0xFD, 0x02, 0xFF, 0xD2, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-    0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0xBF, 0xFE, 0x00,
-    0x1F, 0x81, 0xF4, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0x50, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xE5, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x3F, 0x00, 0xFD, 0x03,
-    0xF0, 0x0F, 0xD0, 0x3F, 0xE6, 0xFD, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF4, 0x00, 0x1B, 0xF4,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xAB, 0xFF,
-    0xE8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0x07, 0xFF, 0xFE,
-    0x40, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC6, 0xFE, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xF8, 0x02, 0xFE, 0x00, 0xFF,
-    0x80, 0x03, 0xFC, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00,
-    0xFF, 0x01, 0xFF, 0x40, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0x0F, 0xF0, 0x1F, 0xF4, 0x00, 0x3F, 0xD0,
-    0x7F, 0xE0, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x07, 0xFD, 0x0B, 0xFE, 0x00, 0x1F, 0xF4, 0x2F, 0xFC,
-    0x00, 0x7F, 0xD0, 0xBF, 0xF0, 0x01, 0xFF, 0x42, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x06,
-    0xA8, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x1F, 0xF4, 0x2F, 0xF0, 0x0F,
-    0xF4, 0x02, 0xFD, 0x07, 0xFC, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x02, 0xFD,
-    0x3F, 0xC0, 0x00, 0xBF, 0x9F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xDF, 0xF4, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x1F, 0xF8, 0xFF, 0xC0,
-    0x0B, 0xFE, 0x3F, 0xFC, 0x07, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x6F, 0xF4, 0x00, 0x05, 0x50, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xE0,
-    0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x01, 0xFE, 0x00, 0x2F, 0xE0, 0x02,
-    0xFE, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x43, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xD7, 0xFF, 0xFD, 0x3F, 0xFE, 0x80, 0x0F, 0xD0, 0xFF, 0x40, 0x3F, 0x07, 0xF8,
-    0x00, 0xFC, 0x3F, 0xC0, 0x07, 0xF2, 0xFE, 0x00, 0x1F, 0xCF, 0xF0, 0x00, 0xBF, 0xBF, 0x40, 0x02,
-    0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFD, 0xFF, 0xF0, 0x07, 0xF4, 0xFF,
-    0xF0, 0x2F, 0xD1, 0xFF, 0xF0, 0xBF, 0x41, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFB, 0xFE, 0x00, 0x01, 0xFF, 0xC7, 0xFC, 0x00, 0x0F,
-    0xFD, 0x0F, 0xF0, 0x00, 0x7F, 0xF0, 0x3F, 0xD0, 0x03, 0xFF, 0x40, 0xBF, 0xC0, 0x1F, 0xF8, 0x01,
-    0xFF, 0x00, 0xFF, 0xC0, 0x03, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0x1F, 0xF1,
-    0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0xD0,
-    0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x07, 0xFC,
-    0x7F, 0xE0, 0x00, 0x7F, 0xC7, 0xFF, 0x00, 0x0B, 0xFC, 0x7F, 0xF0, 0x00, 0xBF, 0xC7, 0xFF, 0x00,
-    0x0F, 0xFC, 0x7F, 0xF4, 0x00, 0xFF, 0xD7, 0xFF, 0xD0, 0x2F, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xDB,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xEB, 0xF1, 0xBF, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x83, 0xFD, 0x00, 0x0F,
-    0xF8, 0x3F, 0xF0, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x7F,
-    0xD0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x0F, 0xF8, 0x00, 0xFF, 0xC1, 0xFF,
-    0x80, 0x0B, 0xFE, 0x2F, 0xF4, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x2A, 0xA9, 0x00, 0x7F, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xFF, 0x42, 0xAF, 0xFF, 0xE4, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xE0, 0x02, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFF, 0xD0, 0x03, 0xFF, 0x90, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xF9,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x3F, 0xFE, 0xBF, 0xF0, 0x2F, 0xF4, 0x07, 0xFE, 0x0F, 0xF8, 0x00,
-    0x7F, 0xC3, 0xFC, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0xBF, 0xAF, 0xF0,
-    0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x0F, 0xF9, 0xFF, 0x40, 0x03, 0xFE, 0x3F, 0xF0, 0x03, 0xFF, 0x4F,
-    0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x6A, 0xAA, 0xAA, 0xAA, 0xA5, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFE, 0x03, 0xFC,
-    0x00, 0x0B, 0xF8, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x7F, 0xC0, 0x00, 0xFF, 0x42, 0xFF, 0x00, 0x03,
-    0xFD, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x3F, 0xC0, 0xFF, 0x40, 0x00, 0xFF, 0x03,
-    0xFD, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x7F, 0xFF, 0x00, 0x7F, 0xC1, 0xFF, 0xFC,
-    0x01, 0xFF, 0x03, 0xFF, 0xF0, 0x06, 0xA8, 0x02, 0xBF, 0x40, 0x00, 0x00, 0x16, 0x40, 0x00, 0x00,
-    0x07, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xE0,
-    0x0F, 0xE0, 0x03, 0xFF, 0x00, 0x0F, 0xC0, 0x1F, 0xF4, 0x00, 0x3F, 0x40, 0xBF, 0xD0, 0x00, 0xBE,
-    0x03, 0xFF, 0x00, 0x02, 0xF8, 0x0F, 0xFD, 0x00, 0x0B, 0xE0, 0x3F, 0xF4, 0x00, 0x2F, 0x81, 0xFF,
-    0xF0, 0x01, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xE1, 0xFF, 0xD0, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x07, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xF8, 0x3F, 0xF5, 0xBF, 0xD3, 0xFC, 0x01,
-    0xFD, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x1B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xBF, 0xFE, 0x54, 0x1F, 0xF4, 0x07,
-    0xFE, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x00, 0xFF,
-    0x40, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x7F, 0xC0, 0x00, 0xFF, 0x80,
-    0x7F, 0xD0, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xAA, 0x5F, 0xFF, 0xFF, 0xFF,
-    0xE7, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x07, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x02, 0xBF, 0x40,
-    0x00, 0x7F, 0x41, 0xFF, 0x01, 0xFD, 0x02, 0xFE, 0x07, 0xF4, 0x03, 0xFC, 0x1F, 0xE0, 0x0B, 0xF4,
-    0x3F, 0x80, 0x0F, 0xE0, 0xFE, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x02, 0xFC, 0x3F,
-    0xC0, 0x0B, 0xF4, 0xFF, 0x00, 0x2F, 0xD3, 0xFD, 0x00, 0xBF, 0x4F, 0xFC, 0x03, 0xFD, 0x2F, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xBF, 0xBF, 0xFF, 0x00, 0x1F, 0xFE,
-    0x1F, 0xC2, 0xFF, 0xE0, 0x0F, 0xFF, 0x07, 0xF0, 0x2F, 0xFC, 0x07, 0xFF, 0x01, 0xFC, 0x03, 0xFF,
-    0x42, 0xFF, 0x80, 0x7F, 0x00, 0xBF, 0xF0, 0xFF, 0xD0, 0x1F, 0xC0, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B,
-    0xF0, 0x03, 0xFF, 0x0F, 0xFC, 0x02, 0xFC, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0xBF, 0x00, 0x3F, 0xF5,
-    0xFF, 0xC0, 0x2F, 0xC0, 0x0F, 0xFD, 0x3F, 0xF0, 0x0B, 0xF0, 0x03, 0xFF, 0x4F, 0xFC, 0x02, 0xFC,
-    0x00, 0xFF, 0xC3, 0xFF, 0x80, 0xBF, 0x00, 0xBF, 0xF0, 0xFF, 0xF8, 0x2F, 0xC0, 0x7F, 0xFC, 0x3F,
-    0xFF, 0xEF, 0xF6, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00,
-    0x00, 0xFF, 0x00, 0xBF, 0xF8, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0xC0, 0x0B, 0xFF,
-    0xFC, 0x07, 0xFD, 0x00, 0x2F, 0xFF, 0xF8, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xF7, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF2, 0xFF, 0xD0, 0x00, 0x0B,
-    0xFF, 0x83, 0xFF, 0xFF, 0x80, 0x7F, 0xFC, 0x0B, 0xFF, 0xFE, 0x03, 0xFF, 0xD0, 0x0F, 0xFF, 0xF8,
-    0x3F, 0xFE, 0x00, 0x2F, 0xFF, 0xE2, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x85, 0x55, 0x40, 0x00, 0x05,
-    0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF4, 0xBC, 0xBF, 0x01, 0xFD,
-    0x2F, 0x0F, 0xE0, 0x7F, 0x4B, 0xD2, 0xFC, 0x1F, 0xE2, 0xF4, 0x7F, 0x43, 0xF8, 0x7D, 0x0F, 0xE0,
-    0xFE, 0x1F, 0x83, 0xFC, 0x3F, 0xC7, 0xE0, 0xBF, 0x0F, 0xF1, 0xF8, 0x2F, 0xC3, 0xFC, 0x3E, 0x0B,
-    0xF4, 0xFF, 0x0F, 0xC1, 0xFD, 0x3F, 0xD3, 0xF0, 0x7F, 0x4B, 0xFC, 0xFC, 0x3F, 0xD2, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x05, 0x50, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xD0, 0x03,
-    0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFD,
-    0x03, 0xFD, 0x02, 0xF0, 0x07, 0xF4, 0x1F, 0xF0, 0x0F, 0xC0, 0x1F, 0xE0, 0x7F, 0xC0, 0x3F, 0x00,
-    0x7F, 0x81, 0xFF, 0x00, 0xFC, 0x01, 0xFE, 0x07, 0xFD, 0x03, 0xF0, 0x0F, 0xF4, 0x0F, 0xFD, 0x7F,
-    0xE0, 0xBF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xF9, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x81, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x95, 0x5F, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0,
-    0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF4, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0, 0x0F, 0xF9, 0xBF, 0xFC, 0x07, 0xF4, 0x03, 0xFF, 0x03, 0xF8,
-    0x00, 0x7F, 0xC0, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0x00, 0x02, 0xFD, 0x1F, 0x80, 0x00, 0xBF, 0x4B,
-    0xE0, 0x00, 0x1F, 0xE1, 0xF4, 0x00, 0x07, 0xF8, 0x7E, 0x00, 0x02, 0xFF, 0x1F, 0xE5, 0x5B, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF,
-    0xBF, 0xD0, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0xFF,
-    0x80, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x07, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFE,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x55, 0x7F, 0xF4, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFE, 0x00,
-    0x00, 0x3F, 0xF8, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xD1,
-    0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF,
-    0xFE, 0x00, 0xFF, 0x9B, 0xFF, 0xC0, 0x7F, 0x40, 0x3F, 0xF0, 0x3F, 0x80, 0x07, 0xFC, 0x0F, 0xD0,
-    0x00, 0xFF, 0x03, 0xF0, 0x00, 0x2F, 0xD1, 0xF8, 0x00, 0x0B, 0xF4, 0xBE, 0x00, 0x01, 0xFE, 0x1F,
-    0x40, 0x00, 0x7F, 0x87, 0xE0, 0x00, 0x2F, 0xF1, 0xFE, 0x55, 0xBF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFB, 0xFD, 0x00, 0xBF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0xBF, 0x80, 0x00,
-    0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x80,
-    0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x55, 0x7F, 0xF4, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0x00,
-    0x3F, 0xF8, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xD1, 0xFF,
-    0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xF8, 0x7F, 0x40, 0x00, 0x3F, 0xCF, 0xF0,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xAF, 0xF4, 0x00, 0x7F, 0xD0,
-    0x3F, 0xD0, 0x0A, 0x90, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xF8, 0x00, 0xFF, 0x9B, 0xFF, 0xC0, 0x1F, 0xD0, 0x0F, 0xFC, 0x03, 0xF8, 0x00, 0x7F, 0xC0, 0x3F,
-    0x40, 0x03, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0xD0, 0x7E, 0x00, 0x02, 0xFD, 0x0B, 0xE0, 0x00, 0x1F,
-    0xE0, 0x7D, 0x00, 0x01, 0xFE, 0x07, 0xE0, 0x00, 0x2F, 0xF0, 0x7F, 0x95, 0x6F, 0xFF, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFE, 0xFF,
-    0x40, 0x0B, 0xFE, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x1F,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x5F, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF4, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0xFF,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE6, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xD0,
-    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x7F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x7F, 0x95, 0x6F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x81, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0B,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFF, 0x95, 0x5F, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xC0, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF4, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0xFD, 0x07, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x00, 0xBF, 0xDF, 0xF8, 0x00, 0x0B, 0xF8, 0x0B, 0xF8, 0x00, 0xBF, 0x40, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x03, 0xFE, 0x6F, 0xFF, 0x00, 0x1F, 0xD0, 0x0F,
-    0xFC, 0x00, 0xFE, 0x00, 0x1F, 0xF0, 0x03, 0xF4, 0x00, 0x3F, 0xC0, 0x0F, 0xC0, 0x00, 0xBF, 0x40,
-    0x7E, 0x00, 0x02, 0xFD, 0x02, 0xF8, 0x00, 0x07, 0xF8, 0x07, 0xD0, 0x00, 0x1F, 0xE0, 0x1F, 0x80,
-    0x00, 0xBF, 0xC0, 0x7F, 0x95, 0x6F, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFE, 0xFF, 0x40, 0x02, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x6E, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x3D, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF1, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0xBC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0x40, 0x00, 0x00, 0xFE,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x4F,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xD0, 0x00, 0x00,
-    0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F,
-    0xE0, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xE5, 0x57, 0xFF, 0x40, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0x80, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xFD,
-    0x1F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x3F, 0xF0, 0xF8, 0x00,
-    0x1F, 0xFF, 0x3E, 0x00, 0x0B, 0xCB, 0xFF, 0x80, 0x02, 0xF0, 0xFF, 0xC0, 0x00, 0x7D, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0x07, 0xFD, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x54, 0x00, 0x00, 0x50, 0x00, 0x6F, 0xE0, 0x00, 0x00,
-    0xBF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xE6, 0xFF, 0xF0, 0x1F, 0xD0, 0x0F, 0xFC,
-    0x0F, 0xE0, 0x01, 0xFF, 0x03, 0xF4, 0x00, 0x3F, 0xC0, 0xFC, 0x00, 0x0B, 0xF4, 0x7E, 0x00, 0x02,
-    0xFD, 0x2F, 0x80, 0x00, 0x7F, 0x87, 0xD0, 0x00, 0x1F, 0xE1, 0xF8, 0x00, 0x0B, 0xFC, 0x7F, 0x95,
-    0x6F, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFD, 0x07,
-    0xFF, 0xFE, 0xFF, 0x40, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x03, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0xBF,
-    0xD0, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x55, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xE0,
-    0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x47, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0x82, 0xFF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFE, 0x6F, 0xFF, 0x01, 0xFD, 0x00, 0xFF, 0xC0, 0xFE, 0x00, 0x1F, 0xF0, 0x3F,
-    0x40, 0x03, 0xFC, 0x0F, 0xC0, 0x00, 0xBF, 0x47, 0xE0, 0x00, 0x2F, 0xD2, 0xF8, 0x00, 0x07, 0xF8,
-    0x7D, 0x00, 0x01, 0xFE, 0x1F, 0x80, 0x00, 0xBF, 0xC7, 0xF9, 0x56, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xEF, 0xF4, 0x02, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA9, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x81,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x00,
-    0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x95, 0x5F,
-    0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0,
-    0x00, 0x00, 0xBF, 0xF4, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x1A, 0x80, 0x3F, 0xD0, 0x1F, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xE6, 0xFF,
-    0xF0, 0x1F, 0xD0, 0x0F, 0xFC, 0x0F, 0xE0, 0x01, 0xFF, 0x03, 0xF4, 0x00, 0x3F, 0xC0, 0xFC, 0x00,
-    0x0B, 0xF4, 0x7E, 0x00, 0x02, 0xFD, 0x2F, 0x80, 0x00, 0x7F, 0x87, 0xD0, 0x00, 0x1F, 0xE1, 0xF8,
-    0x00, 0x0B, 0xFC, 0x7F, 0x95, 0x6F, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFE, 0xFF, 0x40, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x2A,
-    0x80, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x3F,
-    0xE0, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF,
-    0x80, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x95, 0x5F, 0xFD, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x80,
-    0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF4,
-    0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xAA, 0x00, 0x1A, 0x80, 0x3F, 0xD0, 0x1F, 0xF0, 0x0F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xE6, 0xFF, 0xF0, 0x1F, 0xD0, 0x0F,
-    0xFC, 0x0F, 0xE0, 0x01, 0xFF, 0x03, 0xF4, 0x00, 0x3F, 0xC0, 0xFC, 0x00, 0x0B, 0xF4, 0x7E, 0x00,
-    0x02, 0xFD, 0x2F, 0x80, 0x00, 0x7F, 0x87, 0xD0, 0x00, 0x1F, 0xE1, 0xF8, 0x00, 0x0B, 0xFC, 0x7F,
-    0x95, 0x6F, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x07, 0xFF, 0xFE, 0xFF, 0x40, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x90, 0x0A, 0xA0, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xD0,
-    0x00, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xE5, 0x57, 0xFF, 0x40,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01,
-    0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x00,
-    0x2F, 0xFD, 0x1F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0A, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFE, 0x6F, 0xFF, 0x01, 0xFD, 0x00, 0xFF, 0xC0, 0xFE, 0x00, 0x1F, 0xF0,
-    0x3F, 0x40, 0x03, 0xFC, 0x0F, 0xC0, 0x00, 0xBF, 0x47, 0xE0, 0x00, 0x2F, 0xD2, 0xF8, 0x00, 0x07,
-    0xF8, 0x7D, 0x00, 0x01, 0xFE, 0x1F, 0x80, 0x00, 0xBF, 0xC7, 0xF9, 0x56, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xEF, 0xF4, 0x02,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xAA, 0x50, 0x2A, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x81, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x95, 0x5F, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0,
-    0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF4, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7E, 0x03,
-    0xE0, 0x00, 0x3F, 0xF0, 0xF8, 0x00, 0x1F, 0xFF, 0x3E, 0x00, 0x0B, 0xCB, 0xFF, 0x40, 0x03, 0xF0,
-    0xFF, 0xC0, 0x00, 0x7D, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x50, 0x1A, 0x80, 0x3F, 0xD0, 0x0F, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F,
-    0xE6, 0xFF, 0xF0, 0x1F, 0xD0, 0x0F, 0xFC, 0x0F, 0xE0, 0x01, 0xFF, 0x03, 0xF4, 0x00, 0x3F, 0xC0,
-    0xFC, 0x00, 0x0B, 0xF4, 0x7E, 0x00, 0x02, 0xFD, 0x2F, 0x80, 0x00, 0x7F, 0x87, 0xD0, 0x00, 0x1F,
-    0xE1, 0xF8, 0x00, 0x0B, 0xFC, 0x7F, 0x95, 0x6F, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFE, 0xFF, 0x40, 0x2F, 0xF9, 0x00, 0x00, 0x00,
-    0x0A, 0x94, 0x02, 0xA8, 0x00, 0x00, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x1F,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x55, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0x00,
-    0x00, 0x0B, 0xFF, 0x47, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50,
-    0x00, 0x00, 0x0A, 0xA4, 0x01, 0xA8, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFE, 0x6F, 0xFF, 0x01, 0xFD, 0x00,
-    0xFF, 0xC0, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x03, 0xFC, 0x0F, 0xC0, 0x00, 0xBF, 0x47, 0xE0,
-    0x00, 0x2F, 0xD2, 0xF8, 0x00, 0x07, 0xF8, 0x7D, 0x00, 0x01, 0xFE, 0x1F, 0x80, 0x00, 0xBF, 0xC7,
-    0xF9, 0x56, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xEF, 0xF4, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x06, 0xAA, 0xAF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFA, 0x55, 0x40, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xD5, 0x56, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x95,
-    0x55, 0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x43, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0xFD, 0x0F, 0xFA, 0xAA,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F, 0xF9,
-    0x54, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x0B, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xAA, 0xAF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFA, 0x55, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD5, 0x56, 0x80,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x55, 0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0x41, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0xFF, 0xAA, 0xAF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x95, 0x40, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0xB0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xFE, 0x40,
-    0x00, 0x1F, 0x80, 0xF4, 0x00, 0x01, 0xFF, 0xC3, 0xE0, 0x00, 0x0B, 0xFF, 0x8F, 0x40, 0x00, 0x3F,
-    0x3F, 0xFD, 0x00, 0x00, 0xFC, 0x3F, 0xF0, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xF5, 0x55, 0xA0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x43, 0xE0, 0x00,
-    0x3F, 0xF0, 0xFC, 0x00, 0x1F, 0xFF, 0x3F, 0x00, 0x07, 0xCB, 0xFF, 0x80, 0x02, 0xF0, 0xFF, 0xD0,
-    0x00, 0x7D, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x41, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0xFF, 0xAA, 0xAF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x95, 0x40,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0xB0, 0xBF, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x6F, 0xFE, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x07, 0xF0,
-    0x03, 0xFE, 0x0B, 0xF8, 0x3F, 0x80, 0x3F, 0xC0, 0x07, 0xFA, 0xFC, 0x00, 0x54, 0x00, 0x01, 0x5F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xAA, 0xAB, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF5, 0x55, 0xA0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0xBF,
-    0xF0, 0x00, 0xBE, 0x00, 0x0B, 0xFF, 0xF0, 0x03, 0xF4, 0x00, 0xBF, 0xFF, 0xF0, 0x2F, 0xC0, 0x0B,
-    0xF8, 0x1F, 0xF0, 0xFE, 0x00, 0xBF, 0x40, 0x0F, 0xFF, 0xF4, 0x01, 0x50, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0x00, 0x0F,
-    0xFA, 0xAA, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xF9, 0x54, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0xB0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x1F, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x50, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xAA, 0xAF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFA, 0x55, 0x40,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x55, 0x68, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x55, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0xFD, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xE0,
-    0x7F, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x05, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xEA,
-    0xAB, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xE5, 0x50, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x02, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x01, 0xF4, 0x2F, 0x00, 0x00, 0x0F, 0xF0, 0x60, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0xFF, 0x00, 0x1F,
-    0xF0, 0x01, 0x50, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xAF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFA, 0x55, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xD5, 0x56, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x55, 0x54, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x19, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xFD, 0x07,
-    0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00,
-    0x7F, 0xDF, 0xFC, 0x00, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0x41, 0xFF, 0x00, 0x1F, 0xF0, 0x00,
-    0xFD, 0x00, 0xFF, 0xAA, 0xAF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0x95, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x0B, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00,
-    0x00, 0x1F, 0x80, 0xF4, 0x00, 0x00, 0xFF, 0xC3, 0xE0, 0x00, 0x0B, 0xFF, 0x8F, 0x40, 0x00, 0x3F,
-    0x3F, 0xFD, 0x00, 0x00, 0xFC, 0x3F, 0xF0, 0x00, 0x02, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xAF, 0xF4, 0x00, 0x0F, 0xF4,
-    0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xAA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xE9, 0x55, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x55, 0x5A, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x55, 0x55, 0x50, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2E, 0x03, 0xD0, 0x00, 0x3F, 0xF0, 0xF8,
-    0x00, 0x1F, 0xFF, 0x3E, 0x00, 0x0B, 0xCF, 0xFF, 0x40, 0x02, 0xF0, 0xFF, 0xC0, 0x00, 0xBC, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFE, 0x07, 0xFC, 0x02,
-    0xFD, 0x00, 0x3F, 0xC0, 0x54, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFD,
-    0x07, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0x43, 0xFE, 0xAA, 0xBF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xDB, 0xFE, 0x55, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x02, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x03, 0xFD, 0x0B, 0xF8, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00,
-    0x54, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xAA, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF5, 0x55,
-    0xA0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x83,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x01, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0xBF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0xBF, 0x40, 0x0F, 0xF0,
-    0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x41, 0xFF, 0x01, 0xFF,
-    0x00, 0x0F, 0xD0, 0xFF, 0xAA, 0xAF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x95, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0xB0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x0B, 0xF8, 0x00, 0x38, 0x00, 0xF4, 0x03, 0xE0, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F,
-    0xF0, 0x3F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F,
-    0xF0, 0x2F, 0xF0, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F,
-    0xF8, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x1F, 0x80, 0x7F, 0x80, 0x0B, 0x00, 0xB8,
-    0x0B, 0xC0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x0F, 0xF0, 0x3F, 0xC0,
-    0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC1, 0xFF, 0x07,
-    0xFC, 0x1F, 0xF0, 0x7F, 0xD2, 0xFF, 0x8B, 0xFE, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F,
-    0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F,
-    0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF8, 0x3F, 0xF8, 0x3F,
-    0xF8, 0x3F, 0xF8, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xF4, 0x2F, 0xF4, 0x3F, 0xF8, 0x3F,
-    0xFC, 0x3F, 0xFC, 0x15, 0x54, 0x05, 0x50, 0x1F, 0xF0, 0x2F, 0xF4, 0x2F, 0xF8, 0x3F, 0xF8, 0x3F,
-    0xFC, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F,
-    0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF4, 0x2F, 0xF8, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x1F, 0xF4, 0x1F, 0xF4, 0x2F, 0xF8, 0x3F, 0xFC, 0x3F,
-    0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF4, 0x07,
-    0xFF, 0xE0, 0x01, 0xFF, 0xE0, 0x00, 0x2F, 0xFD, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0xC3, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0xFF, 0xFF, 0x94, 0x5B, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1B, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x1B, 0xFD,
-    0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x3F, 0xFE, 0xBF, 0xF0, 0x2F, 0xF4,
-    0x07, 0xFE, 0x0F, 0xF8, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x03, 0xFE, 0x7F,
-    0xC0, 0x00, 0xBF, 0xAF, 0xF0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x0F, 0xF9, 0xFF, 0x40, 0x03, 0xFE,
-    0x3F, 0xF0, 0x03, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xD0, 0x1F, 0xFF,
-    0x80, 0x07, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xD0, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x00, 0x07, 0xFF,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD3,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xFC, 0x00, 0x00,
-    0x0B, 0xFF, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xC3, 0xFF, 0xFE, 0x51, 0x6F, 0xFF, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x6F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFA, 0xFF,
-    0xC0, 0xBF, 0xD0, 0x1F, 0xF8, 0x3F, 0xE0, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x3F, 0xD7, 0xFC, 0x00,
-    0x0F, 0xF9, 0xFF, 0x00, 0x02, 0xFE, 0xBF, 0xC0, 0x00, 0xBF, 0x9F, 0xF0, 0x00, 0x3F, 0xE7, 0xFD,
-    0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x0F, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0x80,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0,
-    0x1F, 0xC0, 0x00, 0x3F, 0xE0, 0xBF, 0xC3, 0xF8, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x7F, 0x40, 0x00,
-    0x54, 0x00, 0x01, 0x5F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xF4, 0x07,
-    0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x47, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x7F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0xFF, 0xFE,
-    0x51, 0x6F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0x0B, 0xFF,
-    0x01, 0xFD, 0x00, 0x0B, 0xFF, 0xF0, 0xBF, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0x80, 0x0F, 0xF8, 0x2F,
-    0xF0, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x01, 0x50, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFE, 0xBF, 0xF0, 0x00, 0x2F, 0xF4, 0x07, 0xFE,
-    0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x03, 0xFE,
-    0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x0F, 0xF8,
-    0x01, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFD, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xFF, 0x94, 0x5B,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00,
-    0x00, 0x54, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x03, 0xFE,
-    0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x01,
-    0xFF, 0x00, 0x02, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0,
-    0x00, 0x7F, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F,
-    0xFF, 0x40, 0x7F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x02, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x2F,
-    0xFC, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xC3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x7F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x0F, 0xFF, 0xF9, 0x45,
-    0xBF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x07, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xDF, 0xF8, 0x00, 0x0B, 0xF8,
-    0x0B, 0xF8, 0x00, 0xBF, 0x40, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xEB, 0xFF, 0x00, 0x2F, 0xF4, 0x07, 0xFE, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x03, 0xFC, 0x00,
-    0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0xBF, 0x82, 0xFF, 0x00, 0x02, 0xFE,
-    0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xF4, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x3E, 0x00, 0x00, 0x00,
-    0x0B, 0xCB, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0xFF,
-    0x07, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF4, 0x07, 0xFF, 0xE0, 0x01,
-    0xFF, 0xE0, 0x00, 0x2F, 0xFD, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00,
-    0x3F, 0xF4, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF,
-    0xC3, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0xFF, 0xFF, 0x94, 0x5B, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x1B, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x03, 0xD0, 0x00, 0x3F, 0xF0, 0xF8, 0x00, 0x1F, 0xFF, 0x3E, 0x00, 0x0B, 0xCB, 0xFF, 0x80,
-    0x02, 0xF0, 0xFF, 0xC0, 0x00, 0x7D, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x01, 0xFF, 0xBF, 0xD0, 0x02, 0xFF, 0x07, 0xFD, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x54,
-    0x00, 0x00, 0x54, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x3F, 0xFE, 0xBF, 0xF0, 0x2F, 0xF4, 0x07, 0xFE, 0x0F, 0xF8, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x0F,
-    0xF5, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0xBF, 0xAF, 0xF0, 0x00, 0x2F, 0xE7, 0xFC, 0x00,
-    0x0F, 0xF9, 0xFF, 0x40, 0x03, 0xFE, 0x3F, 0xF0, 0x03, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF4, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x82, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x40, 0x7F,
-    0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x02, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x03, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xD0, 0x00, 0x00, 0x1F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x4F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xF0, 0x00,
-    0x00, 0x2F, 0xFC, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x0F, 0xFF, 0xF9, 0x45, 0xBF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0xFF, 0x82, 0xFF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x15, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xEB, 0xFF, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0xFF, 0x80, 0x07,
-    0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x0B, 0xFA, 0xFF, 0x00,
-    0x02, 0xFE, 0x7F, 0xC0, 0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x3F, 0xF4, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x6F,
-    0xFE, 0x40, 0x07, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0xBE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xF8,
-    0x00, 0x0B, 0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xD0, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x47, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x43, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xF0, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0xFF, 0xFE, 0x51, 0x6F, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x01, 0xBF, 0xD0, 0x1F, 0xC0, 0x7F, 0xFF, 0xF4, 0xBE, 0x07, 0xFF, 0xFF, 0xFB,
-    0xF4, 0x3F, 0xFE, 0xBF, 0xFF, 0xC2, 0xFF, 0x40, 0x7F, 0xFD, 0x0F, 0xF8, 0x00, 0x7F, 0xE0, 0x3F,
-    0xC0, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x2F, 0xF0, 0x00,
-    0x2F, 0xE0, 0x7F, 0xC0, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x6F, 0xFE, 0x40, 0x07, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0xBE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x7F,
-    0xF8, 0x00, 0x0B, 0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF0, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x47, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x43,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0xF0, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0xFF, 0xFE, 0x51, 0x6F, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x01, 0xBF, 0xD0, 0x1F, 0xC0, 0x7F, 0xFF, 0xF4, 0xBE, 0x07, 0xFF, 0xFF,
-    0xFB, 0xF4, 0x3F, 0xFE, 0xBF, 0xFF, 0xC2, 0xFF, 0x40, 0x7F, 0xFD, 0x0F, 0xF8, 0x00, 0x7F, 0xE0,
-    0x3F, 0xC0, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x2F, 0xF0,
-    0x00, 0x2F, 0xE0, 0x7F, 0xC0, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x3F,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x7F, 0x00, 0x07, 0xFF, 0xFF,
-    0xF8, 0x0B, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xF7, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0xBF, 0xF0, 0x00,
-    0x02, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0,
-    0x3F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x47, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xE5, 0x16, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x1B, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x06, 0xFF, 0x40, 0x7F, 0x01, 0xFF, 0xFF, 0xD2, 0xF8, 0x1F, 0xFF, 0xFF, 0xEF, 0xD0, 0xFF,
-    0xFA, 0xFF, 0xFF, 0x0B, 0xFD, 0x01, 0xFF, 0xF4, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0xFF, 0x00, 0x03,
-    0xFD, 0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0xBF, 0xC0, 0x00, 0xBF, 0x81,
-    0xFF, 0x00, 0x03, 0xFE, 0x07, 0xFD, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x82, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x6F, 0xFE,
-    0x40, 0x07, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0xBE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x7F, 0xD0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xF8, 0x00,
-    0x0B, 0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0,
-    0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x47, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xF0, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0xFF, 0xFE, 0x51, 0x6F, 0xFF, 0xF0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x03, 0xD0, 0x00, 0x03, 0xFF, 0x0F, 0x80, 0x00, 0x1F, 0xFF, 0x3E, 0x00,
-    0x00, 0xBC, 0xBF, 0xF8, 0x00, 0x02, 0xF0, 0xFF, 0xC0, 0x00, 0x07, 0xD0, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA4, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x01, 0xBF, 0xD0, 0x1F, 0xC0, 0x7F, 0xFF, 0xF4, 0xBE, 0x07, 0xFF, 0xFF, 0xFB, 0xF4,
-    0x3F, 0xFE, 0xBF, 0xFF, 0xC2, 0xFF, 0x40, 0x7F, 0xFD, 0x0F, 0xF8, 0x00, 0x7F, 0xE0, 0x3F, 0xC0,
-    0x00, 0xFF, 0x41, 0xFF, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x2F, 0xF0, 0x00, 0x2F,
-    0xE0, 0x7F, 0xC0, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x06, 0xFF, 0xE4, 0x00, 0x7F, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x0B, 0xE0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF7, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0x40, 0x7F, 0xFF, 0xF0,
-    0x07, 0xFF, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFD, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x3F, 0xF4, 0x00, 0x00, 0x07, 0xFF,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x47, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x3F, 0xFF, 0xE5, 0x16, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xFF, 0xFA, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x06, 0xFF, 0x40, 0x7F, 0x01, 0xFF, 0xFF, 0xD2, 0xF8, 0x1F, 0xFF, 0xFF, 0xEF,
-    0xD0, 0xFF, 0xFA, 0xFF, 0xFF, 0x0B, 0xFD, 0x01, 0xFF, 0xF4, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0xFF,
-    0x00, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0xBF, 0xC0, 0x00,
-    0xBF, 0x81, 0xFF, 0x00, 0x03, 0xFE, 0x07, 0xFD, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0xFF, 0xD0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03,
-    0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00,
-    0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80,
-    0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8,
-    0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0xFF,
-    0xD0, 0x00, 0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x7F, 0xC7, 0xF4, 0x00, 0x1F, 0xF1, 0xFE,
-    0x00, 0x07, 0xFC, 0x7F, 0x80, 0x01, 0xFF, 0x0F, 0xE0, 0x00, 0x7F, 0xC3, 0xF8, 0x00, 0x1F, 0xF0,
-    0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x02, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x3F,
-    0xF4, 0xFF, 0xD0, 0x2F, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x1B, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC,
-    0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F,
-    0xF8, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3,
-    0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC,
-    0x3F, 0xF8, 0x00, 0x02, 0xFF, 0x82, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x2F, 0xFD, 0x00, 0x07, 0xFF,
-    0x82, 0xFF, 0xFE, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC,
-    0x7F, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x07,
-    0xFC, 0x3F, 0x80, 0x01, 0xFF, 0x0F, 0xE0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x2F, 0xF0, 0xFF, 0x00,
-    0x0B, 0xFC, 0x3F, 0xC0, 0x03, 0xFF, 0x0F, 0xF4, 0x00, 0xFF, 0xD3, 0xFF, 0x40, 0xBF, 0xF4, 0xBF,
-    0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xFD, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xFE,
-    0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x40, 0x3F, 0xFC, 0x00,
-    0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00,
-    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00,
-    0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x3F,
-    0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x2F,
-    0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x0B, 0xFF,
-    0x40, 0x01, 0xFF, 0xE0, 0x02, 0xFF, 0xFE, 0xAB, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x40, 0x00, 0xFF, 0xFC, 0x7F, 0x40,
-    0x01, 0xFF, 0xF4, 0x7F, 0x40, 0x01, 0xFF, 0xE0, 0x7F, 0x80, 0x01, 0xFF, 0x40, 0x7F, 0x80, 0x01,
-    0xFF, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x02, 0xFF,
-    0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x40, 0x3F, 0xD0, 0x03, 0xFF, 0x40,
-    0x3F, 0xF4, 0x0B, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x6F,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xFC,
-    0x00, 0x03, 0xFF, 0xFD, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFE,
-    0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x40, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00,
-    0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00,
-    0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x00,
-    0x2F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x0F,
-    0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x0B, 0xFF, 0x40, 0x01, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFE, 0xAB, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0xBF, 0x40, 0x00, 0xFF, 0xFC, 0x7F, 0x40, 0x01, 0xFF, 0xF4, 0x7F, 0x40, 0x01,
-    0xFF, 0xE0, 0x7F, 0x80, 0x01, 0xFF, 0x40, 0x7F, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0x80, 0x01, 0xFF,
-    0x00, 0x3F, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00,
-    0x3F, 0xC0, 0x03, 0xFF, 0x40, 0x3F, 0xD0, 0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x0B, 0xFF, 0x40, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x1F, 0xFF,
-    0x00, 0x00, 0xFF, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0x80, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD0, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0,
-    0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x03,
-    0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x02,
-    0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x02, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x00, 0xBF,
-    0xFF, 0xAA, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x40, 0x00, 0xFF, 0xFC, 0x7F, 0x40, 0x01,
-    0xFF, 0xF4, 0x7F, 0x40, 0x01, 0xFF, 0xE0, 0x7F, 0x80, 0x01, 0xFF, 0x40, 0x7F, 0x80, 0x01, 0xFF,
-    0x00, 0x3F, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00,
-    0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x40, 0x3F, 0xD0, 0x03, 0xFF, 0x40, 0x3F,
-    0xF4, 0x0B, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x87, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0xF5, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x87, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xFC, 0x00,
-    0x03, 0xFF, 0xFD, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00,
-    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x40, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00,
-    0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x3F,
-    0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x2F,
-    0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE,
-    0x00, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFE,
-    0x00, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x0B, 0xFF, 0x40, 0x01, 0xFF, 0xE0, 0x02, 0xFF, 0xFE,
-    0xAB, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x03, 0xD0, 0x00, 0x00, 0xFF, 0xC3, 0xF0, 0x00, 0x01, 0xFF, 0xF3, 0xE0, 0x00, 0x02,
-    0xF2, 0xFF, 0xE0, 0x00, 0x02, 0xF0, 0xFF, 0xD0, 0x00, 0x01, 0xF4, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x40, 0x00, 0xFF, 0xFC, 0x7F, 0x40, 0x01, 0xFF,
-    0xF4, 0x7F, 0x40, 0x01, 0xFF, 0xE0, 0x7F, 0x80, 0x01, 0xFF, 0x40, 0x7F, 0x80, 0x01, 0xFF, 0x00,
-    0x3F, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x3F,
-    0xC0, 0x02, 0xFF, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x40, 0x3F, 0xD0, 0x03, 0xFF, 0x40, 0x3F, 0xF4,
-    0x0B, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC7, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xD0, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF4, 0x03,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x03,
-    0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFF,
-    0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0xBF,
-    0xF0, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xF8,
-    0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF8,
-    0x00, 0xBF, 0xF4, 0x00, 0x1F, 0xFE, 0x00, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x40, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x40, 0x00,
-    0xFF, 0xFC, 0x7F, 0x40, 0x01, 0xFF, 0xF4, 0x7F, 0x40, 0x01, 0xFF, 0xE0, 0x7F, 0x80, 0x01, 0xFF,
-    0x40, 0x7F, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0x00,
-    0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x40, 0x3F,
-    0xD0, 0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x0B, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD2, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x03, 0xFF,
-    0x40, 0x00, 0x3F, 0xF4, 0x0B, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x0F, 0xFE, 0x00,
-    0x2F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF4, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x1F, 0xFC,
-    0x00, 0x01, 0xFF, 0xD0, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x7F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x3F, 0xD3, 0xFF, 0x00, 0x01, 0xFF, 0x07, 0xFE, 0x00, 0x0B, 0xF8, 0x0F,
-    0xFC, 0x00, 0x3F, 0xD0, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x2F, 0xF4, 0x0B, 0xF8, 0x00, 0x3F, 0xF0,
-    0x3F, 0xD0, 0x00, 0xBF, 0xE1, 0xFF, 0x00, 0x00, 0xFF, 0xCB, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00,
-    0x2F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0xBF, 0xE0,
-    0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0x02, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x03,
-    0xFF, 0x40, 0x03, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xE0,
-    0x00, 0x3F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xF1, 0xFF,
-    0xC0, 0x00, 0x01, 0xFF, 0xDF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x0F, 0xF4, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x3F, 0xF0,
-    0x00, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xD0, 0x2F, 0xE0, 0x00, 0x0F, 0xFC,
-    0x0F, 0xF4, 0x00, 0x02, 0xFF, 0x87, 0xFC, 0x00, 0x00, 0x3F, 0xF2, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x55, 0x03, 0xFF, 0xFE, 0x00,
-    0xBF, 0xC0, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF4,
-    0x00, 0x03, 0xFF, 0x40, 0xBF, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x02,
-    0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x40, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0x01, 0xFF, 0xC0,
-    0x00, 0x1F, 0xFD, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF7, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x3F, 0xF0,
-    0x00, 0x1F, 0xF0, 0x7F, 0xE0, 0x00, 0xBF, 0x80, 0xFF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0xC0, 0x1F,
-    0xF0, 0x02, 0xFF, 0x40, 0xBF, 0x80, 0x03, 0xFF, 0x03, 0xFD, 0x00, 0x0B, 0xFE, 0x1F, 0xF0, 0x00,
-    0x0F, 0xFC, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB8, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3E, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0xF8,
-    0x00, 0x00, 0x02, 0xF3, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xF8, 0x00, 0x00,
-    0x7F, 0xF0, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0xBF, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0,
-    0x00, 0xFF, 0xE0, 0x02, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x40, 0x3F, 0xF8, 0x00, 0x0F,
-    0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x7F, 0xF0, 0x00,
-    0x00, 0x7F, 0xF7, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xD0, 0x7C, 0x00, 0x00, 0x7F, 0xE1, 0xF4, 0x00,
-    0x03, 0xFF, 0xD7, 0xC0, 0x00, 0x0F, 0x8F, 0xFF, 0x00, 0x00, 0x3E, 0x1F, 0xFC, 0x00, 0x00, 0xFC,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x03, 0xFD, 0x3F, 0xF0, 0x00, 0x1F, 0xF0, 0x7F, 0xE0, 0x00, 0xBF, 0x80, 0xFF, 0xC0, 0x03, 0xFD,
-    0x00, 0xFF, 0xC0, 0x1F, 0xF0, 0x02, 0xFF, 0x40, 0xBF, 0x80, 0x03, 0xFF, 0x03, 0xFD, 0x00, 0x0B,
-    0xFE, 0x1F, 0xF0, 0x00, 0x0F, 0xFC, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x05, 0x42, 0xFC, 0x01,
-    0xFD, 0x2F, 0xC0, 0x1F, 0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0xC0, 0x1F, 0xC3, 0xFC, 0x01, 0xFC, 0x3F,
-    0x80, 0x1F, 0xC3, 0xF8, 0x01, 0xFC, 0x3F, 0x80, 0x2F, 0xC3, 0xF8, 0x02, 0xFC, 0x3F, 0x80, 0x2F,
-    0xC3, 0xF8, 0x02, 0xFC, 0x3F, 0x80, 0x2F, 0xC3, 0xF8, 0x02, 0xFC, 0x3F, 0x40, 0x2F, 0xC3, 0xF4,
-    0x02, 0xFC, 0x3F, 0x40, 0x3F, 0xC3, 0xF4, 0x03, 0xFC, 0x3F, 0x40, 0x3F, 0xC7, 0xF4, 0x03, 0xFC,
-    0x7F, 0x40, 0x3F, 0x87, 0xF4, 0x03, 0xF8, 0x7F, 0x00, 0x3F, 0x87, 0xF0, 0x03, 0xF8, 0x7F, 0x00,
-    0x3F, 0x87, 0xF0, 0x03, 0xF8, 0x7F, 0x00, 0x3F, 0x80, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0x03, 0xFF, 0xF0, 0x2F, 0xFF, 0x01, 0xFF, 0xF0, 0x0F,
-    0xFF, 0x00, 0xBF, 0xF0, 0x07, 0xFF, 0x80, 0x3F, 0xFC, 0x03, 0xFF, 0xD0, 0x2F, 0xFE, 0x07, 0xFF,
-    0xE0, 0x7F, 0xFD, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xBF, 0xF0, 0x0F, 0xFF, 0x01,
-    0xFF, 0xE0, 0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0xFF, 0xF8, 0x0F, 0xFF, 0x40, 0xFF,
-    0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF, 0x40,
-    0x3F, 0xFF, 0x03, 0xFF, 0xF0, 0x2F, 0xFF, 0x01, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0xBF, 0xF0, 0x07,
-    0xFF, 0x80, 0x3F, 0xFC, 0x03, 0xFF, 0xD0, 0x2F, 0xFE, 0x3F, 0xFF, 0x0B, 0xFF, 0xD0, 0x3F, 0xFF,
-    0x07, 0xFF, 0xD0, 0x2F, 0xFF, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0x01,
-    0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0xBF,
-    0xF4, 0x03, 0xFF, 0xD0, 0x7F, 0xFC, 0x02, 0xFF, 0xE0, 0x3F, 0xFC, 0x07, 0xFF, 0xE0, 0xBF, 0xFC,
-    0x07, 0xFF, 0xD0, 0xBF, 0xFC, 0x03, 0xFF, 0xC0, 0xBF, 0xF8, 0x03, 0xFF, 0xC0, 0xBF, 0xF4, 0x07,
-    0xFF, 0x80, 0xBF, 0xF0, 0x0B, 0xFF, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x1F, 0xFE,
-    0x03, 0xFF, 0xC0, 0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x0B, 0xFF, 0x80, 0x0F, 0xFF, 0xC0,
-    0xFF, 0xF8, 0x0F, 0xFF, 0x40, 0xFF, 0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x2F, 0xFD, 0x03, 0xFF,
-    0xC0, 0x7F, 0xF8, 0x0F, 0xFF, 0x40, 0x3F, 0xFF, 0x0B, 0xFF, 0xD0, 0x3F, 0xFF, 0x07, 0xFF, 0xD0,
-    0x2F, 0xFF, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x0B,
-    0xFF, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0xBF, 0xF4, 0x03, 0xFF,
-    0xD0, 0x3F, 0xFC, 0x02, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x58, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF,
-    0xF9, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFF, 0xF1, 0xFE, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0xF4, 0x07, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xC7, 0xFF, 0xF8, 0x7F, 0xFD, 0x07, 0xFD, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x7F, 0xC2, 0xFF, 0x4F, 0xFD, 0x3F, 0xF8, 0xFF, 0xE7, 0xFF, 0xC0, 0x05, 0x50, 0x7F, 0xC2, 0xFF,
-    0x4F, 0xFD, 0x3F, 0xF8, 0xFF, 0xE7, 0xFF, 0xC0, 0x05, 0x50, 0x00, 0x55, 0x00, 0x05, 0x50, 0x7F,
-    0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC2, 0xFF, 0x40, 0x1F, 0xF8, 0x02, 0xFF, 0x4F, 0xFE, 0x00, 0x7F,
-    0xF0, 0x0F, 0xFD, 0x3F, 0xF8, 0x02, 0xFF, 0xC0, 0x3F, 0xF8, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0xFF,
-    0xE7, 0xFF, 0xC0, 0x3F, 0xFC, 0x07, 0xFF, 0xC0, 0x55, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x2F, 0x00, 0x00, 0xFF, 0x00, 0x2C, 0xB0, 0x00, 0x7F,
-    0x40, 0x0D, 0xDD, 0x00, 0x3F, 0xC0, 0x03, 0x77, 0x40, 0x2F, 0xC0, 0x00, 0xD9, 0xD0, 0x1F, 0xE0,
-    0x00, 0x3C, 0xB4, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x03, 0xFC, 0x00,
-    0x00, 0x05, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x28, 0x06, 0x80, 0x0B, 0xFC, 0x35, 0xC3, 0x24,
-    0x03, 0xFD, 0x0E, 0x71, 0xB7, 0x03, 0xFF, 0x07, 0xAC, 0xAE, 0xC1, 0xFF, 0x00, 0xC7, 0x2C, 0xB0,
-    0xFF, 0x80, 0x3F, 0xC7, 0xF8, 0xBF, 0xC0, 0x07, 0xD0, 0xBC, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0xFF, 0xF4, 0x0F,
-    0xFF, 0x00, 0xFF, 0xE0, 0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x7F, 0xFC, 0x0B, 0xFF, 0x80, 0x0F, 0xFF,
-    0xC1, 0xFF, 0xF8, 0x3F, 0xFF, 0x07, 0xFF, 0xD0, 0xFF, 0xF8, 0x0F, 0xFF, 0x03, 0xFF, 0xD0, 0x3F,
-    0xFC, 0x0F, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF8, 0x0B, 0xFF, 0x42, 0xFF, 0xD0, 0x3F, 0xFC, 0x0F,
-    0xFF, 0x01, 0xFF, 0xE0, 0x7F, 0xFC, 0x0B, 0xFF, 0x42, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x0B, 0x80, 0x1D, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0xFF, 0x01,
-    0xFF, 0x03, 0xFF, 0x0B, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xD0, 0xBF, 0x80, 0xFF, 0x42, 0xFE,
-    0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xC0, 0x2F, 0x80, 0x7F, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x7F, 0xC0, 0x3F, 0xE0, 0x1F, 0xF0, 0x07, 0xF8, 0x02, 0xFC,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x2F, 0x40, 0x7F, 0xC7, 0xFC, 0x03, 0xFD,
-    0x3F, 0xE0, 0x1F, 0xF1, 0xFF, 0x00, 0xBF, 0x8B, 0xF8, 0x03, 0xFC, 0x3F, 0xC0, 0x0B, 0xC0, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x1F, 0x00, 0x1D, 0x00,
-    0x2F, 0xD0, 0x7F, 0x80, 0xBF, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0xFF, 0xC0, 0x0F, 0xF4, 0x2F, 0xE0,
-    0x3F, 0xD0, 0x07, 0xFC, 0x0F, 0xF4, 0x1F, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x0B, 0xF4, 0x00, 0xBF,
-    0x01, 0xFC, 0x02, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xCF, 0xFE, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x0D, 0x00, 0x07, 0xD0,
-    0x02, 0xFD, 0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x0F, 0xF8, 0x02, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF,
-    0xC0, 0x0B, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0xBF, 0xC0, 0x02, 0xF8, 0x00, 0x07, 0x40, 0x00, 0x10,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x3D, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xC0, 0x02,
-    0xFF, 0x40, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x2F, 0xFC, 0x0F, 0xFE, 0x03, 0xFF, 0x80, 0x2F, 0xE0,
-    0x01, 0xF8, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x3F, 0xFD, 0x03, 0xFF, 0xC0, 0x02, 0xFF, 0xF0, 0x2A, 0xA8, 0x0F, 0xFF, 0x40,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x02, 0xFF, 0xF8, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xBF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xF8,
-    0x1F, 0xF8, 0x0B, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x1F, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFC,
-    0x2F, 0xFC, 0x01, 0xFF, 0xFF, 0x40, 0x2F, 0xFC, 0x3F, 0xFC, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFC,
-    0x3F, 0xFC, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFC, 0x15, 0x54, 0x2F, 0xFF, 0xFF, 0xF0, 0x15, 0x54,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFE, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE0, 0x00,
-    0x00, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFD, 0x00,
-    0x03, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1F, 0x00, 0x0B,
-    0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFC, 0x03, 0xFF,
-    0x00, 0xFF, 0xC0, 0x1F, 0xF0, 0x01, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0xD0, 0xBF, 0xF8,
-    0x3F, 0xFE, 0x0F, 0xFF, 0xC3, 0xFF, 0xF1, 0xFF, 0xFC, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00,
-    0x07, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFD, 0x03, 0xFD, 0x7F,
-    0xEF, 0xF0, 0x1E, 0x07, 0xF8, 0xFF, 0x40, 0x40, 0xBF, 0x8B, 0xF8, 0x00, 0x0B, 0xF8, 0x7F, 0xC0,
-    0x00, 0xBF, 0x87, 0xFC, 0x00, 0x0B, 0xF8, 0x7F, 0xC0, 0x00, 0xFF, 0x87, 0xFC, 0x00, 0x0F, 0xF8,
-    0xBF, 0x80, 0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x54, 0x00, 0x40, 0x00, 0x07, 0xF8,
-    0x01, 0xFE, 0x7F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x42, 0x00, 0x00, 0x00, 0xE3, 0xD7, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x2F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xFF, 0xF8, 0x00, 0x00, 0x0F, 0x7E, 0xBC, 0x00, 0x00, 0x02, 0x4F, 0x85, 0x60, 0x00, 0x01, 0xE3,
-    0xE0, 0xBC, 0x14, 0x00, 0xF8, 0x66, 0x1F, 0x2E, 0x0F, 0x6E, 0x7F, 0xFB, 0xFF, 0x4B, 0xFF, 0xFF,
-    0xBF, 0xFE, 0x00, 0x7F, 0xFE, 0x02, 0xFF, 0xD0, 0x07, 0xFF, 0x93, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xDF, 0x83, 0xFB, 0xDF, 0x74, 0xF4, 0x40, 0x62, 0xF0, 0x40, 0x3C, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xA4, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFC, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xF8, 0x07, 0xFF, 0x07, 0xFF, 0x80, 0x7F, 0xF0, 0x1F, 0x80, 0x00, 0xFF, 0x81,
-    0xF8, 0x00, 0x0F, 0xF8, 0x09, 0x00, 0x00, 0x7F, 0xC0, 0x90, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x07,
-    0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x01, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03,
-    0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0xBF, 0xF4, 0x0B, 0xFE, 0x00, 0x00, 0x7F,
-    0x40, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0x00, 0x0C, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x05, 0x55, 0x00, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x80, 0x00, 0x6A, 0x40, 0x00, 0x00, 0xE0, 0x1F, 0xFF, 0xF8, 0x00, 0x01, 0xF8, 0xBF, 0xFF, 0xFF,
-    0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x7F, 0xF0, 0x02, 0xFF, 0xF4,
-    0x00, 0x0F, 0xF4, 0x02, 0xFD, 0xD0, 0x00, 0x0B, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x03,
-    0xFD, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x07, 0xFC, 0x00,
-    0x00, 0x2F, 0xF4, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x0B,
-    0xFC, 0x00, 0xBF, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xE0,
-    0x00, 0x02, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0C, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0xFF, 0x40, 0x00, 0x1F, 0xFE, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x01, 0xFF, 0x80, 0x00, 0x2F,
-    0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x03, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0x41, 0x55, 0x40, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0B,
-    0xFC, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x00,
-    0xFF, 0xD0, 0x2F, 0xE0, 0x00, 0x1F, 0xFD, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0xE0, 0x3F, 0xC0, 0x00,
-    0x15, 0x55, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x01, 0x54, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x0B, 0xFC,
-    0x00, 0xFF, 0xD0, 0x00, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0xE0, 0x02, 0xFF,
-    0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x3D, 0x78, 0x78, 0x2C, 0xB6, 0x9D, 0xB7, 0xDE,
-    0xF7, 0xDE, 0xF5, 0x2E, 0xBC, 0x3E, 0x7F, 0xFD, 0x3F, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x0F, 0x80, 0x0F, 0xE0, 0x0B, 0x78, 0x07, 0x5E, 0x03, 0xC7, 0xC2, 0xFF, 0xFC,
-    0xBF, 0xFF, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x3F, 0xFC, 0x7F, 0xFC, 0x78, 0x00, 0x78, 0x00, 0x7F,
-    0xE0, 0xBF, 0xFC, 0x00, 0x3E, 0x00, 0x2E, 0x20, 0x7E, 0x7F, 0xFD, 0xBF, 0xFC, 0x6F, 0xE0, 0x07,
-    0xFD, 0x0B, 0xFF, 0x43, 0xC0, 0x01, 0xEB, 0x80, 0xBF, 0xFC, 0x3F, 0x4F, 0x8F, 0x80, 0xF2, 0xE0,
-    0x3C, 0x7D, 0x6F, 0x0F, 0xFF, 0x40, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xCB, 0xFF, 0xF0, 0x00,
-    0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F,
-    0xC0, 0x0F, 0xE0, 0x01, 0x50, 0x00, 0x0B, 0xF4, 0x0F, 0xAF, 0x43, 0xC1, 0xE0, 0xF0, 0xB8, 0x2F,
-    0xFC, 0x07, 0xFF, 0x07, 0xC2, 0xF3, 0xE0, 0x3C, 0xBE, 0x7F, 0x1F, 0xFF, 0x81, 0xBF, 0x80, 0x0B,
-    0xE0, 0x0F, 0xFF, 0x47, 0x41, 0xE2, 0xC0, 0x3C, 0xB0, 0x0F, 0x2E, 0x0B, 0xD3, 0xFF, 0xF4, 0x2F,
-    0xFC, 0x10, 0x1F, 0x1F, 0xFF, 0x87, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF1,
-    0xBF, 0xA0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFD, 0x0B,
-    0xFE, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0xFF,
-    0x4F, 0xF4, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x03, 0xFE, 0x3F, 0xE0, 0x00,
-    0xFF, 0x8F, 0xFC, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x0B, 0xFF, 0x7F, 0xF0,
-    0x02, 0xFF, 0xEF, 0xFC, 0x00, 0xBF, 0xF0, 0x0B, 0xE0, 0x0B, 0x9F, 0x03, 0xC1, 0xD2, 0xE6, 0x3C,
-    0xB7, 0xCF, 0x3D, 0xF7, 0xCF, 0xAD, 0xF2, 0xF0, 0xBC, 0xBE, 0x7F, 0x0F, 0xFF, 0x42, 0xFF, 0xC0,
-    0x2F, 0x80, 0x01, 0x40, 0x2F, 0xC0, 0x3F, 0xC0, 0x27, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x6F, 0xE8, 0xBF, 0xFD, 0xBF, 0xFD, 0x1F, 0xE0, 0x1F, 0xFF, 0x4B, 0x43,
-    0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x0F, 0xD0, 0x0F, 0xE0, 0x1F, 0xF0, 0x0F, 0xFA,
-    0x87, 0xFF, 0xF2, 0xFF, 0xFC, 0x1A, 0x90, 0x0F, 0xFF, 0x01, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x1E,
-    0x03, 0xFF, 0x00, 0xFF, 0xD0, 0x00, 0xBC, 0x14, 0x1F, 0x0F, 0xFF, 0xC7, 0xFF, 0xE1, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x07, 0xBC, 0x03, 0xCF, 0x03, 0xC3, 0xC2,
-    0xFB, 0xFD, 0xFF, 0xFF, 0x45, 0x6F, 0x80, 0x07, 0xD0, 0x01, 0xF4, 0x2A, 0xA8, 0x7F, 0xFC, 0x74,
-    0x00, 0x74, 0x00, 0xBF, 0x90, 0xBF, 0xFC, 0x00, 0x3D, 0x00, 0x3E, 0x60, 0x7D, 0x7F, 0xFD, 0xBF,
-    0xF8, 0x6F, 0x90, 0x02, 0xFE, 0x07, 0xFF, 0x83, 0xD0, 0x01, 0xE0, 0x00, 0xBA, 0xE4, 0x2F, 0xFF,
-    0x4F, 0xD2, 0xF3, 0xF0, 0x3C, 0xBC, 0x0F, 0x5F, 0x9B, 0xC3, 0xFF, 0xE0, 0x2F, 0xE0, 0xBF, 0xFF,
-    0x2F, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x0B, 0xD0, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x7F, 0x00, 0x2F, 0x80, 0x05, 0x50, 0x01, 0x50, 0x07, 0xFF, 0x03, 0xD2, 0xF0,
-    0xF0, 0x3C, 0x3D, 0x2F, 0x0B, 0xFF, 0x41, 0xFF, 0xD1, 0xF0, 0x7C, 0xB8, 0x0F, 0x6F, 0xAF, 0xD3,
-    0xFF, 0xF0, 0x2F, 0xE0, 0x06, 0x90, 0x0B, 0xFF, 0x07, 0x82, 0xE2, 0xC0, 0x3C, 0xB0, 0x0F, 0x2D,
-    0x07, 0xD3, 0xFF, 0xF4, 0x3F, 0xFD, 0x00, 0x0F, 0x09, 0x4B, 0xC7, 0xFF, 0xE1, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x00,
-    0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0,
-    0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF,
-    0xF0, 0x00, 0x0A, 0xA9, 0x0B, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F,
-    0xF4, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00,
-    0x0B, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00,
-    0x1F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x01,
-    0xFF, 0xE0, 0x00, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x2A, 0x00, 0x00, 0x00, 0x7F, 0x0F,
-    0xC0, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x0F, 0xD1, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0xBD,
-    0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0xF7, 0xF8,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xEB, 0xFD, 0x00, 0xFF, 0xFF, 0xD1, 0xF8, 0x00,
-    0xBF, 0xFF, 0xF0, 0xBE, 0x00, 0x3F, 0xFD, 0xFC, 0x3F, 0x40, 0x1F, 0xFE, 0x7F, 0x0F, 0xC0, 0x0B,
-    0xFF, 0x5F, 0x83, 0xF0, 0x03, 0xFF, 0xCB, 0xD1, 0xF8, 0x00, 0xFF, 0xF3, 0xF4, 0xBE, 0x00, 0x3F,
-    0xFC, 0xFC, 0x3F, 0x40, 0x1F, 0xFF, 0x3F, 0x0F, 0xC0, 0x03, 0xFF, 0xEF, 0x83, 0xF0, 0x00, 0xFF,
-    0xFF, 0xE1, 0xFC, 0x00, 0x3F, 0xFF, 0xF4, 0xBE, 0x04, 0x0B, 0xFF, 0xFF, 0xBF, 0xEF, 0x41, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0xFC,
-    0x2F, 0x80, 0x00, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x00, 0x01, 0x40,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE8, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xEA, 0xAF, 0x40, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x6F, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0xF4,
-    0x0F, 0xFF, 0x00, 0x7F, 0xFF, 0x41, 0xFF, 0xF0, 0x07, 0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0x00,
-    0x00, 0xFF, 0xF8, 0x07, 0xF0, 0x00, 0x0F, 0xFF, 0xD0, 0x7F, 0x07, 0x40, 0xBF, 0xFF, 0xEB, 0xFF,
-    0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0x96, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x2E, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x15,
-    0xFF, 0x55, 0x54, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x80,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xAA, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x02, 0xFF, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xE0, 0x3F, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0x87, 0xFE, 0x7F, 0xE0, 0x00, 0x00,
-    0x0B, 0xFF, 0x83, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x82, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF, 0xD0, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x2A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x3F, 0xD0, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF5, 0x56, 0xFF, 0x95, 0x57, 0xFF, 0x54, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xC0, 0x00,
-    0x1F, 0xF9, 0x56, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD5, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x00, 0x07, 0xFE, 0x40, 0x1F, 0xC0, 0x0F, 0xE0,
-    0x00, 0x3F, 0xFF, 0xC0, 0x2F, 0xC0, 0x2F, 0xD0, 0x00, 0x7F, 0xAF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBC, 0x01, 0x40, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xFE, 0xFF, 0xC0,
-    0x00, 0x2F, 0xFE, 0x00, 0x3F, 0xF0, 0x3F, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x3F, 0xF0, 0x1F, 0xE0,
-    0x00, 0x01, 0xFF, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0xF0, 0x1F, 0xF0,
-    0x00, 0x00, 0x03, 0xFC, 0x3F, 0xF0, 0x1F, 0xF4, 0x00, 0x38, 0x03, 0xFC, 0x3F, 0xF0, 0x1F, 0xF8,
-    0x00, 0xBF, 0xAF, 0xFC, 0x3F, 0xF0, 0x1F, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0, 0x1F, 0xFC,
-    0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xF0, 0x1F, 0xFD, 0x02, 0xFF, 0xFF, 0xC0, 0x15, 0x50, 0x05, 0x54,
-    0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x05, 0x40, 0x3F, 0x40, 0x00, 0xFD,
-    0x03, 0xF0, 0x1F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x1F, 0xFD, 0x3F, 0x80, 0x00, 0x2F, 0xC7,
-    0xFF, 0x4F, 0xD0, 0x00, 0x07, 0xF6, 0xFF, 0xE3, 0xF4, 0x00, 0x01, 0xFD, 0xFF, 0xFD, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF3,
-    0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0xBF, 0xF8, 0x00, 0x00, 0x2F, 0xFE, 0x1F, 0xFD, 0x00, 0x00,
-    0x0B, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFA, 0x94, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0x7F, 0xFF, 0xFF, 0xF0, 0x03, 0xF9, 0xFF, 0xE5, 0xBF, 0xF0,
-    0x0F, 0xE7, 0xFC, 0x00, 0x2F, 0xC0, 0x3F, 0x9F, 0xC0, 0x00, 0x3F, 0x40, 0xFE, 0x7F, 0x00, 0x00,
-    0xBE, 0x03, 0xF9, 0xFC, 0x25, 0x02, 0xF8, 0x0F, 0xE7, 0xF0, 0xFF, 0x0B, 0xE0, 0x3F, 0x9F, 0xC3,
-    0xFC, 0x2F, 0xC0, 0xFE, 0x7F, 0x0F, 0xF0, 0xBF, 0x03, 0xF9, 0xFC, 0x3F, 0xC2, 0xFC, 0x0F, 0xE7,
-    0xF0, 0xFF, 0x01, 0x60, 0x7F, 0x9F, 0xC3, 0xFC, 0x00, 0x01, 0xFE, 0x7F, 0x0B, 0xF8, 0x00, 0x07,
-    0xF9, 0xFC, 0x1F, 0xF8, 0x00, 0x3F, 0xE7, 0xF0, 0x3F, 0xFE, 0x57, 0xFF, 0x9F, 0xC0, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x7F, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x16, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x01, 0xAB, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE4, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xD7, 0xFF, 0xC0,
-    0x00, 0x07, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xC0, 0x07, 0xFC,
-    0x00, 0x00, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xD0, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0x96, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0x40,
-    0x14, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0xAA, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0A, 0xBF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFA, 0xA8, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0x00, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x2F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC1, 0x80, 0x00, 0x02, 0x47, 0xFF, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x57, 0xFE, 0x56, 0xFF, 0xF5, 0x55, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0x80, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x95, 0xAF,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF,
-    0xF7, 0xFC, 0x01, 0x90, 0x00, 0xFF, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x3F, 0xD0,
-    0x00, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xFF, 0xA5, 0x03, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F,
-    0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFD, 0x03, 0xF9,
-    0x6F, 0xFF, 0xC3, 0xFF, 0xF0, 0x3F, 0x80, 0xBF, 0xD8, 0x2F, 0xFF, 0xC3, 0xF8, 0x0F, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0x9B, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xAF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x01, 0x55, 0x55, 0x55, 0x57, 0xFE, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x43,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xC0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x6F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xF9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFB, 0xF0, 0x00, 0xFF, 0x6F, 0xC0, 0x07, 0xFC, 0x7F, 0x00, 0x1F, 0xF1, 0xFC, 0x00, 0x7F,
-    0xC7, 0xF0, 0x01, 0xFF, 0x1F, 0xC0, 0x07, 0xFD, 0x7F, 0x00, 0x0F, 0xF9, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x6F, 0xFF,
-    0x40, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x05, 0x50, 0x0F, 0xFC, 0x01, 0x54, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x2A, 0xAF, 0xFE, 0xA8,
-    0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x10, 0x1F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x06, 0xAA, 0x80, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x50, 0x00, 0x0F, 0xF1, 0xBE, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xFE, 0x00, 0x1B, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x46, 0xE0,
-    0x07, 0xFF, 0xFB, 0xFE, 0x00, 0x7A, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFE, 0x5F, 0xD7, 0xFF, 0xFD, 0x02, 0xFD, 0x7F, 0xFF, 0x00, 0x7F, 0xC7, 0xEB, 0xF0, 0x2F, 0xF8,
-    0x60, 0x7F, 0x5F, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xEF, 0xFC, 0x00,
-    0x1F, 0xFB, 0xF5, 0xFF, 0x00, 0x0B, 0xFC, 0xFD, 0x3F, 0xC0, 0x02, 0xFE, 0x3F, 0x4F, 0xF4, 0x00,
-    0xBF, 0x4F, 0xD2, 0xFD, 0x00, 0x2F, 0xD3, 0xF8, 0xBF, 0x40, 0x0B, 0xF0, 0xFE, 0x2F, 0xD0, 0x02,
-    0xFC, 0x3F, 0x8B, 0xF4, 0x00, 0xBF, 0x0F, 0xE2, 0xFD, 0x00, 0x2F, 0xC3, 0xF8, 0xBF, 0x40, 0x0B,
-    0xF4, 0xFE, 0x2F, 0xD0, 0x02, 0xFD, 0x3F, 0x8B, 0xF4, 0x00, 0xBF, 0x8F, 0xE3, 0xFD, 0x00, 0x2F,
-    0xF3, 0xFC, 0xFF, 0x40, 0x07, 0xFC, 0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x2A, 0xAA, 0xA4, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0x80, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x55, 0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x15, 0x56, 0xFF, 0xF5, 0x55,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFA, 0xFD, 0xFF, 0xE0, 0x3F, 0xF8, 0xBF, 0x0F, 0xFE, 0x1F,
-    0xF4, 0x2F, 0xC0, 0xFF, 0x41, 0xF4, 0x0B, 0xF0, 0x0B, 0x40, 0x10, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xC0, 0x2F, 0xC0,
-    0x1C, 0x03, 0xFC, 0x0B, 0xF0, 0x1F, 0xC1, 0xFF, 0xD2, 0xFC, 0x2F, 0xFC, 0x1F, 0xFD, 0xBF, 0x2F,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x03,
-    0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xF8, 0x00,
-    0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x90, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0x2F, 0x5F, 0xF4, 0xFF, 0x0B, 0xD1, 0xFD, 0x1E, 0x02,
-    0xF4, 0x0D, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xE0, 0x2F, 0x40, 0xD0, 0xFF, 0x0B, 0xD0, 0xFD,
-    0x2F, 0xF2, 0xF5, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x5A, 0xB8, 0x0B, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0x50, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-    0xFE, 0xFF, 0xE0, 0x00, 0x3F, 0x8F, 0xFE, 0x00, 0x0F, 0xE0, 0xFF, 0xE0, 0x07, 0xF4, 0x0F, 0xFE,
-    0x01, 0xFD, 0x00, 0xFF, 0xE0, 0x7F, 0x40, 0x0F, 0xFE, 0x1F, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x0E, 0xA9, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0x7F, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFB, 0xF8, 0x00, 0x3F, 0xF4, 0xFE, 0x00, 0x3F, 0xF4, 0x3F,
-    0xC0, 0x3F, 0xF4, 0x0F, 0xF0, 0x3F, 0xF4, 0x03, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0x1F, 0xF4, 0x00,
-    0x2F, 0xC2, 0xF4, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x06, 0x90, 0xFF, 0xC0, 0x03, 0xFC, 0x0F, 0xFC, 0x00, 0xFF, 0x00,
-    0xFF, 0xC0, 0x3F, 0x80, 0x1F, 0xFC, 0x0F, 0xE0, 0x01, 0xFF, 0x87, 0xF4, 0x00, 0x2F, 0xFA, 0xFC,
-    0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x6A, 0xAA, 0xAA, 0xC0, 0x00, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xA0, 0x00, 0x2F, 0xF1, 0xFD, 0x00, 0x2F, 0xF4, 0x7F,
-    0x40, 0x2F, 0xF8, 0x0F, 0xE0, 0x1F, 0xF8, 0x03, 0xFC, 0x1F, 0xFC, 0x00, 0xFF, 0x0F, 0xFC, 0x00,
-    0x2F, 0xCF, 0xFC, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2A, 0xAA,
-    0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE2, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x2F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x8B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xE2, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0xF8, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFE, 0x2F, 0xFF, 0xD0, 0x01, 0xFF, 0xEF,
-    0x8B, 0xFB, 0xFE, 0x01, 0xFF, 0xC7, 0xE2, 0xF8, 0xBF, 0xE0, 0xFF, 0xD1, 0xF8, 0xBE, 0x0F, 0xFD,
-    0x3F, 0xD0, 0x7E, 0x2F, 0x80, 0xFE, 0x03, 0xD0, 0x1F, 0x8B, 0xE0, 0x0E, 0x00, 0x10, 0x07, 0xE2,
-    0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00,
-    0x07, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE2, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0x8B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x50, 0x07, 0xE2,
-    0xF8, 0x00, 0x00, 0x3D, 0x01, 0xF8, 0xBE, 0x00, 0xF0, 0x3F, 0xD0, 0x7E, 0x2F, 0x80, 0xFE, 0x0F,
-    0xFD, 0x1F, 0x8B, 0xE0, 0xFF, 0xD0, 0xFF, 0xD7, 0xE2, 0xF8, 0xFF, 0xD0, 0x0F, 0xFF, 0xF8, 0xBF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFE, 0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x8B, 0xFF, 0xD0, 0x00, 0x01,
-    0xFF, 0xE2, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0x8B, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE2, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x00, 0x1F,
-    0xF4, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xDF, 0xFF, 0x80, 0x2F, 0xFF, 0x5F, 0xFF, 0xF8, 0x7F, 0xFF, 0x5F, 0xFF, 0xFD, 0x3F, 0xFF,
-    0x5F, 0x8B, 0xFC, 0x0B, 0x6F, 0x5F, 0x81, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0x00, 0x2F, 0x5F,
-    0x80, 0x00, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0x00, 0x2F, 0x5F, 0x80,
-    0x00, 0x0B, 0x6F, 0x5F, 0x81, 0xE0, 0x3F, 0xFF, 0x5F, 0x8B, 0xFC, 0x7F, 0xFF, 0x5F, 0xFF, 0xFD,
-    0x2F, 0xFF, 0x5F, 0xFF, 0xF8, 0x07, 0xFF, 0xDF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00,
-    0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x01, 0xBE, 0x41, 0xFD,
-    0x01, 0xFF, 0xFF, 0x2F, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0x81,
-    0xFF, 0xFC, 0x3F, 0xE0, 0x03, 0xFF, 0x87, 0xFD, 0x00, 0x2F, 0xF4, 0x7F, 0xC0, 0x01, 0xFF, 0x47,
-    0xFC, 0x00, 0x0F, 0xF0, 0x7F, 0xD0, 0x01, 0xFF, 0x03, 0xFF, 0x40, 0xBF, 0xD0, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0x90, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0xBF, 0xD0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF,
-    0xFD, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x2F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC,
-    0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x0F, 0xFD, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0xFF,
-    0xD0, 0x01, 0xFF, 0xC0, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0xFF, 0xD0,
-    0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0x94, 0x5B, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x02, 0xFC, 0x00, 0x6F, 0xFF, 0xE9, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xEF, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xD0,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x03, 0xFF, 0x40, 0x02, 0xFF,
-    0xC0, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x3F, 0xF8, 0x03,
-    0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xC7, 0xFF, 0xD5, 0x55, 0x5F, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0xFF, 0xEA, 0xBF,
-    0xFA, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00,
-    0xFF, 0x80, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x3F, 0xE0,
-    0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFD,
-    0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F,
-    0xF8, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x03, 0xFE, 0x00,
-    0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x55,
-    0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x03,
-    0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0x80,
-    0x3F, 0xD0, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x0F, 0xF4,
-    0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x3F,
-    0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x03,
-    0xFD, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xAA, 0xAA, 0xAA, 0xAA, 0x80, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFE, 0xAA, 0xAA, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x01, 0xFF, 0xFA, 0xAA, 0xA7, 0xFF, 0xFF,
-    0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x50, 0x1A, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFE, 0xAA,
-    0x94, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x4B, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0xFF, 0xFE, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x06, 0xFF,
-    0xD0, 0x7F, 0x83, 0xFC, 0x00, 0x2F, 0xC0, 0x07, 0xF1, 0xFD, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x7F,
-    0x40, 0x00, 0xF8, 0x00, 0x3F, 0x1F, 0xD0, 0x00, 0x3F, 0x40, 0x2F, 0xC3, 0xFC, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF4, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x0B, 0xF9,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x6D, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7D, 0x0F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xF4, 0x3F,
-    0xF8, 0x3F, 0xFC, 0x7F, 0xFC, 0xBF, 0xFC, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xF4, 0x3F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFC, 0xBF,
-    0xFC, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x01, 0x50, 0x0F, 0xFF, 0xD0, 0x3F,
-    0xC2, 0xFF, 0xFF, 0x83, 0xFC, 0x3F, 0xD3, 0xFD, 0x3F, 0xC3, 0xFC, 0x1F, 0xFF, 0xF8, 0x2F, 0xD0,
-    0x7F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x01, 0x50,
-    0x0F, 0xFF, 0xD0, 0x3F, 0xC2, 0xFF, 0xFF, 0x43, 0xFC, 0x3F, 0xC7, 0xFD, 0x7F, 0xC7, 0xFC, 0x1F,
-    0xFF, 0xF8, 0x2F, 0xD0, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFE, 0xAA, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xEB, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x7A, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
-    0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x29, 0x50, 0x00, 0x00, 0x1B, 0x00, 0x0F, 0xFF, 0xFE, 0x94, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xA4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x05, 0x6B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x15, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x06, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40,
-    0x00, 0x00, 0x5A, 0x80, 0x00, 0x00, 0x5A, 0xFF, 0xFF, 0xC0, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFE, 0x95, 0x00, 0xBF, 0xE9, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_14_boldBitmaps[49438] = {
+    0x74, 0xC6, 0x9D, 0x59, 0xE4, 0x9E, 0x93, 0xAE, 0x93, 0xAE, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+    0x39, 0xF3, 0x9F, 0x39, 0xF3, 0xAF, 0x3A, 0xF3, 0xFC, 0x39, 0xF5, 0xE6, 0xAC, 0x79, 0x77, 0x77,
+    0x77, 0x71, 0xFC, 0x91, 0x9F, 0xCA, 0x1A, 0xFC, 0xA1, 0xAF, 0xD1, 0xFE, 0x1F, 0xE0, 0x9F, 0xE0,
+    0x9F, 0xE9, 0x9F, 0xD9, 0x1F, 0xE0, 0xAF, 0xD2, 0xFD, 0xA0, 0xAF, 0xD2, 0xFD, 0x90, 0xAF, 0xC9,
+    0x2F, 0xD1, 0xAF, 0xC3, 0xFD, 0x1A, 0xFC, 0x3F, 0xD1, 0xAF, 0xC9, 0x2F, 0xD1, 0xAF, 0xC9, 0x2F,
+    0xD1, 0xAF, 0xC9, 0x2F, 0xD1, 0xFD, 0x92, 0xFD, 0x10, 0x71, 0xAE, 0x93, 0xF7, 0x72, 0xF9, 0x3F,
+    0x77, 0x2F, 0x4F, 0x77, 0x2F, 0x39, 0xF7, 0x71, 0x9F, 0x3A, 0xF7, 0x71, 0x9F, 0x3A, 0xEA, 0x77,
+    0x1A, 0xF3, 0xFA, 0x72, 0x9F, 0xFF, 0xFF, 0xFF, 0x91, 0xAF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF,
+    0xFF, 0xA1, 0x9F, 0xFF, 0xFF, 0xFF, 0x97, 0x09, 0xF9, 0x29, 0xF7, 0x71, 0x9F, 0x92, 0xAF, 0x77,
+    0x1A, 0xF9, 0x2A, 0xF7, 0x71, 0xAF, 0x3F, 0xC7, 0x71, 0xFC, 0x3F, 0xC7, 0x71, 0xFC, 0x3F, 0xC7,
+    0x3F, 0xFF, 0xFF, 0xFF, 0x91, 0x9F, 0xFF, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
+    0xFF, 0xFA, 0x70, 0xAF, 0xA2, 0xAF, 0x97, 0x70, 0xFC, 0xA2, 0xFC, 0x77, 0x1F, 0xC9, 0x2F, 0xC7,
+    0x71, 0xFC, 0x92, 0xFC, 0x77, 0x09, 0xFC, 0x3F, 0xC7, 0x70, 0x9F, 0xC2, 0x9F, 0xC7, 0x20, 0x77,
+    0x77, 0x19, 0xE7, 0x73, 0x9E, 0x77, 0x3A, 0xE7, 0x73, 0xAE, 0x77, 0x19, 0xAF, 0xCA, 0xA9, 0x97,
+    0x2A, 0xFF, 0xF9, 0x79, 0xFF, 0xFD, 0x79, 0xFF, 0xFD, 0x97, 0xFF, 0xE9, 0xAA, 0xA7, 0x0F, 0xCA,
+    0x0A, 0xE7, 0x39, 0xFC, 0x1A, 0xE7, 0x39, 0xFC, 0x1A, 0xE7, 0x39, 0xFC, 0xA0, 0xF7, 0x4F, 0xFE,
+    0x74, 0xAF, 0xFD, 0xA9, 0x73, 0xFF, 0xFD, 0x97, 0x1A, 0xFF, 0xFD, 0x97, 0x09, 0xAF, 0xFF, 0xCA,
+    0x73, 0xFF, 0xF9, 0x72, 0xFA, 0xFF, 0x72, 0xEA, 0x1A, 0xFD, 0x93, 0xCA, 0x3E, 0xA2, 0xFD, 0x92,
+    0xFC, 0xA0, 0xEA, 0x19, 0xFD, 0x91, 0xAF, 0xFE, 0xAF, 0xF1, 0xAF, 0xFF, 0xFF, 0x90, 0x9F, 0xFF,
+    0xFF, 0xA2, 0xAF, 0xFF, 0xFC, 0xA7, 0x9A, 0xFF, 0xDA, 0x97, 0x7E, 0x97, 0x73, 0xE9, 0x77, 0x3E,
+    0x97, 0x73, 0xE9, 0x77, 0x3E, 0x97, 0x10, 0x77, 0x2A, 0xAA, 0x97, 0x73, 0xF7, 0x73, 0x9E, 0x95,
+    0xAE, 0xA7, 0x0F, 0x5F, 0xE6, 0xAE, 0x5E, 0x90, 0x9D, 0xA5, 0xEA, 0x5D, 0x92, 0xAD, 0x4F, 0x59,
+    0xD3, 0x9D, 0x39, 0xEA, 0x59, 0xD9, 0x29, 0xD3, 0xF7, 0xDA, 0x2E, 0x2A, 0xE9, 0x7F, 0xFA, 0x19,
+    0xF7, 0x09, 0xFE, 0x2F, 0x97, 0x19, 0xFC, 0x91, 0xAE, 0xA7, 0x49, 0x94, 0xF1, 0xAE, 0xA7, 0x4A,
+    0xEA, 0x0F, 0xE7, 0x29, 0xF0, 0xAD, 0x90, 0x9D, 0xA7, 0x1F, 0x90, 0xDA, 0x2A, 0xD7, 0x0A, 0xF1,
+    0xD9, 0x29, 0xD7, 0x0F, 0x91, 0xD9, 0x29, 0xD9, 0x6F, 0xC2, 0xDA, 0x29, 0xD6, 0x9F, 0x3E, 0xA9,
+    0xAE, 0x6F, 0xA3, 0xAF, 0xEA, 0x5A, 0xF5, 0xFE, 0x6F, 0xA6, 0xAE, 0xA6, 0xFC, 0x77, 0x77, 0x70,
+    0x77, 0x70, 0xAF, 0xCA, 0x73, 0x9F, 0xFC, 0xA7, 0x09, 0xEA, 0x2A, 0xE9, 0x7E, 0x94, 0x9E, 0x7E,
+    0x6A, 0xD9, 0x6E, 0x6A, 0xDA, 0x6E, 0x95, 0xE9, 0x6A, 0xE9, 0x3F, 0x70, 0xF9, 0x0A, 0xFA, 0x70,
+    0x9F, 0xFC, 0xA7, 0x29, 0xFE, 0xA7, 0x3A, 0xFD, 0x74, 0xAF, 0xEA, 0x72, 0x9F, 0xCA, 0xEA, 0x3A,
+    0xF0, 0xFC, 0x1A, 0xF2, 0xAE, 0xA0, 0xFA, 0x29, 0xF1, 0xFA, 0x9F, 0x93, 0x9F, 0xAF, 0x09, 0xFC,
+    0x49, 0xFE, 0xA0, 0x9F, 0xD9, 0x3A, 0xFD, 0x2F, 0xFF, 0xFD, 0x2A, 0xFF, 0xFF, 0xD9, 0x1F, 0xFF,
+    0xDA, 0xE3, 0xAF, 0xFD, 0xA1, 0x9C, 0x59, 0xAF, 0xCA, 0x97, 0x9F, 0xDA, 0x9F, 0xD9, 0x9F, 0xD0,
+    0x9F, 0xCA, 0x09, 0xFC, 0x90, 0x9F, 0xC9, 0x09, 0xFC, 0x90, 0x9F, 0xCA, 0x0A, 0xFC, 0xA0, 0xAF,
+    0xCA, 0x00, 0x7D, 0xAA, 0x7F, 0xA6, 0x9F, 0x7F, 0x96, 0xAF, 0x7F, 0x7A, 0xF7, 0xF9, 0x6A, 0xF7,
+    0xF9, 0x69, 0xF7, 0xAF, 0x7F, 0x97, 0xF7, 0x9F, 0x7A, 0xEA, 0x7A, 0xEA, 0x7F, 0x97, 0xF9, 0x7F,
+    0x97, 0xF9, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xAF, 0x7A, 0xF7, 0x9F, 0x97, 0xFA, 0x7F, 0xC7, 0xAF,
+    0x96, 0x9F, 0xA7, 0xFC, 0x7A, 0xFA, 0x69, 0xFC, 0x7F, 0xCA, 0x69, 0xFC, 0x96, 0xFD, 0x69, 0xFC,
+    0x96, 0xFD, 0x7A, 0xAA, 0xAA, 0x90, 0x1A, 0xE7, 0x0F, 0x97, 0x0F, 0x70, 0xAF, 0x70, 0xF9, 0x7A,
+    0xF7, 0x0F, 0x97, 0xAF, 0x70, 0xF9, 0x7A, 0xF7, 0x9F, 0x70, 0xF9, 0x7A, 0xEA, 0x79, 0xF7, 0x0F,
+    0x70, 0xF9, 0x7F, 0x97, 0xAE, 0xA7, 0xAE, 0xA7, 0xAF, 0x7A, 0xEA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7,
+    0xF9, 0x69, 0xF9, 0x6A, 0xF7, 0xFC, 0x7F, 0xA6, 0xAF, 0x96, 0xFC, 0x69, 0xFC, 0x6F, 0xC9, 0x59,
+    0xFC, 0x6F, 0xCA, 0x5A, 0xFC, 0x6F, 0xCA, 0x5A, 0xFC, 0x59, 0xFC, 0xA5, 0xAA, 0xAA, 0xAA, 0x50,
+    0x69, 0x9A, 0x74, 0xF7, 0x4F, 0x29, 0xC3, 0xCA, 0x1F, 0x1A, 0xD2, 0xFA, 0xAE, 0x9F, 0x90, 0xAF,
+    0xFF, 0xD9, 0x1A, 0xFF, 0xEA, 0x59, 0xAF, 0xE7, 0x0F, 0xFC, 0x94, 0xAF, 0xFF, 0xA1, 0xFF, 0xFE,
+    0x1A, 0xEA, 0x9E, 0x0A, 0xE3, 0xD9, 0x09, 0xE2, 0xA9, 0x49, 0x19, 0xE9, 0x73, 0x9E, 0x75, 0x97,
+    0x00, 0x59, 0xAA, 0xC9, 0x72, 0xAE, 0x97, 0x2A, 0xE9, 0x72, 0xAE, 0x97, 0x2A, 0xE9, 0x72, 0xAE,
+    0x94, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9A, 0xAA, 0xAA, 0xFC, 0xAA, 0xAA,
+    0x95, 0xAE, 0x97, 0x2A, 0xE9, 0x72, 0xAE, 0x97, 0x2A, 0xE9, 0x72, 0xAE, 0x97, 0x39, 0x99, 0x50,
+    0x1F, 0xE2, 0xFD, 0xA2, 0xFD, 0x92, 0xFD, 0x3F, 0xD2, 0x9F, 0xCA, 0x2A, 0xFC, 0x92, 0xFD, 0x29,
+    0xFC, 0xA2, 0xFD, 0x92, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xD9, 0x9F,
+    0xFF, 0xD9, 0x9F, 0xFF, 0xD9, 0x19, 0x99, 0x91, 0x9F, 0x1A, 0xF9, 0x0F, 0xCA, 0x0F, 0xCA, 0x0F,
+    0xD9, 0xFD, 0x77, 0x19, 0x77, 0x09, 0xD7, 0x7E, 0xA7, 0x6A, 0xE9, 0x76, 0xF7, 0x7F, 0x76, 0x9E,
+    0xA7, 0x6A, 0xE9, 0x76, 0xF7, 0x69, 0xEA, 0x76, 0xAE, 0x97, 0x6F, 0x77, 0xF7, 0x6A, 0xEA, 0x76,
+    0xF9, 0x76, 0xF7, 0x69, 0xF7, 0x6A, 0xEA, 0x76, 0xF9, 0x75, 0x9F, 0x76, 0xAE, 0xA7, 0x6F, 0x97,
+    0x6F, 0x76, 0xAF, 0x76, 0xFA, 0x76, 0xF9, 0x75, 0x9F, 0x76, 0xAF, 0x76, 0xFA, 0x75, 0x9F, 0x76,
+    0xAF, 0x76, 0xFA, 0x76, 0xF9, 0x75, 0x9F, 0x76, 0xFC, 0x76, 0xFA, 0x75, 0x9F, 0x97, 0x5A, 0xF7,
+    0x6F, 0xC7, 0x59, 0xF9, 0x75, 0xAF, 0x76, 0xFC, 0x76, 0xFA, 0x75, 0x9F, 0x97, 0x5F, 0xC7, 0x6F,
+    0xA7, 0x59, 0xE9, 0x76, 0xAD, 0x77, 0x0C, 0xA7, 0x71, 0x97, 0x71, 0x59, 0xAA, 0xA9, 0x71, 0x9F,
+    0xEA, 0x6A, 0xFF, 0xD4, 0x9F, 0x91, 0xAF, 0x3F, 0x4A, 0xE9, 0x19, 0xEA, 0x49, 0xEA, 0x1F, 0x91,
+    0x92, 0xF1, 0xF9, 0x0E, 0x1F, 0x90, 0xF0, 0x9E, 0xA0, 0xAE, 0x99, 0xF0, 0xAF, 0x0A, 0xEA, 0x9F,
+    0x0A, 0xF0, 0xAE, 0xAA, 0xF0, 0xAF, 0x0A, 0xEA, 0xAF, 0x09, 0xEA, 0x0F, 0xA9, 0xF9, 0x0A, 0xD1,
+    0xFA, 0x9F, 0xA4, 0x9F, 0xA9, 0xFC, 0x4F, 0xCA, 0x0F, 0xD2, 0xAF, 0xC9, 0x0F, 0xFF, 0xE1, 0xAF,
+    0xFF, 0xD2, 0xFF, 0xFC, 0x92, 0xAF, 0xFF, 0x4F, 0xFE, 0x6F, 0xFC, 0x97, 0x9A, 0xF9, 0x40, 0x77,
+    0x29, 0xAE, 0x97, 0xFD, 0x96, 0xFE, 0x96, 0xFE, 0x95, 0x9F, 0xE9, 0x59, 0xCA, 0x0F, 0x97, 0x1F,
+    0x97, 0x1F, 0x97, 0x1F, 0x97, 0x1F, 0x97, 0x1F, 0x97, 0x1F, 0x97, 0x09, 0xF9, 0x70, 0x9F, 0x97,
+    0x09, 0xF9, 0x70, 0x9F, 0x97, 0x09, 0xF9, 0x49, 0xFF, 0xFC, 0x0A, 0xFF, 0xFC, 0x9A, 0xFF, 0xFC,
+    0x9A, 0xFF, 0xFC, 0x9A, 0xFF, 0xFC, 0x90, 0x39, 0xAF, 0xA9, 0x59, 0xFF, 0xE4, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xCA, 0x2E, 0xA9, 0x29, 0xFC, 0x2C, 0xA7, 0xF9, 0x73, 0xFA, 0x73, 0xFC, 0x73, 0xFA, 0x72,
+    0xAF, 0x97, 0x19, 0xFC, 0x71, 0x9F, 0xC9, 0x70, 0xAF, 0xD7, 0x9F, 0xE7, 0xAF, 0xE9, 0x6F, 0xFA,
+    0x6F, 0xFA, 0x6A, 0xFF, 0xFD, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x1F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0,
+    0x29, 0xAF, 0xCA, 0x96, 0xFF, 0xE9, 0x39, 0xFF, 0xF3, 0xAE, 0xAA, 0xAA, 0xAF, 0xC2, 0xA9, 0x7A,
+    0xE9, 0x74, 0xEA, 0x74, 0xEA, 0x73, 0x9E, 0xA7, 0x29, 0xF9, 0x49, 0xFF, 0xCA, 0x5A, 0xFF, 0xA6,
+    0xFF, 0xD9, 0x5F, 0xFE, 0x97, 0x2A, 0xFC, 0x73, 0xFC, 0x73, 0xAF, 0x2D, 0x94, 0x9F, 0xC2, 0xFF,
+    0xFD, 0x19, 0xFF, 0xFD, 0x1F, 0xFF, 0xDA, 0x1F, 0xFF, 0xD1, 0x9F, 0xFF, 0xC4, 0x9A, 0xFE, 0xA9,
+    0x30, 0x77, 0x73, 0xF7, 0x4A, 0xF7, 0x39, 0xFC, 0x73, 0xFD, 0x72, 0xFE, 0x71, 0xAF, 0xE7, 0x09,
+    0xE9, 0xF7, 0x0E, 0xA0, 0xF7, 0xAE, 0x1F, 0x69, 0xE9, 0x1F, 0x95, 0xEA, 0x2F, 0x94, 0xF3, 0xF9,
+    0x3A, 0xEA, 0x99, 0xAA, 0xFC, 0xAA, 0x09, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x19,
+    0xAA, 0xAA, 0xAA, 0xAF, 0xF7, 0x19, 0xFA, 0x73, 0xAF, 0xA7, 0x3A, 0xFC, 0x73, 0xAF, 0xC7, 0x3A,
+    0xFC, 0x77, 0x40, 0x77, 0x0A, 0xFF, 0xF9, 0x1A, 0xFF, 0xF9, 0x1A, 0xFF, 0xFA, 0x1A, 0xEA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x91, 0xAE, 0x73, 0xF7, 0x3F, 0x97, 0x2F, 0x97, 0x2F, 0xEA, 0xA9, 0x5F, 0xFE,
+    0xA3, 0xFF, 0xFC, 0x2F, 0xFF, 0xD1, 0x99, 0x95, 0xFC, 0x97, 0x2F, 0xC7, 0x2F, 0xC1, 0x96, 0x9F,
+    0xC0, 0x9D, 0x93, 0x9F, 0xD0, 0xAF, 0xFF, 0xCA, 0x0F, 0xFF, 0xD9, 0x0F, 0xFF, 0xCA, 0x1F, 0xFF,
+    0xC1, 0x9F, 0xFE, 0xA4, 0x9A, 0xFC, 0xAA, 0x40, 0x59, 0xAF, 0xE9, 0x5F, 0xFD, 0x94, 0xFF, 0xE9,
+    0x3F, 0xFF, 0x92, 0xAF, 0x97, 0x2F, 0x73, 0x9E, 0x97, 0x3F, 0x74, 0xF0, 0x9F, 0xA5, 0xFF, 0xFA,
+    0x29, 0xFF, 0xFD, 0x19, 0xFF, 0xFD, 0x90, 0xAF, 0xD2, 0x9F, 0xC0, 0xAF, 0xC4, 0x9F, 0x99, 0xFA,
+    0x5F, 0xA9, 0xF9, 0x5F, 0xA9, 0xFA, 0x5F, 0xA0, 0xFC, 0x49, 0xFA, 0x0F, 0xDA, 0xAA, 0xFD, 0x90,
+    0x9F, 0xFF, 0xD2, 0xAF, 0xFF, 0x4A, 0xFF, 0xD7, 0xAF, 0xCA, 0x93, 0x77, 0x9F, 0xFF, 0xDA, 0x9F,
+    0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9A, 0xAA, 0xAA, 0xAA, 0xFE, 0x97, 0x19, 0xF7, 0x2A, 0xF7, 0x2F,
+    0xC7, 0x2F, 0xA7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1F, 0xC9, 0x70, 0x9F, 0xC7, 0x1A, 0xFC, 0x71,
+    0xFD, 0x71, 0xFC, 0xA7, 0x09, 0xFC, 0x97, 0x0A, 0xFC, 0x97, 0x0F, 0xD7, 0x09, 0xFD, 0x70, 0xAF,
+    0xD7, 0x0F, 0xDA, 0x70, 0xFD, 0xA2, 0x49, 0xAF, 0xA9, 0x79, 0xFF, 0xD6, 0xFF, 0xF4, 0xFC, 0x29,
+    0xFA, 0x3F, 0x49, 0xF2, 0x9E, 0xA5, 0xF2, 0x9F, 0x49, 0xF3, 0xFA, 0x29, 0xFC, 0x3A, 0xFF, 0xF9,
+    0x4A, 0xFF, 0xDA, 0x69, 0xFF, 0xC5, 0x9F, 0xFF, 0x92, 0x9F, 0xA2, 0x9F, 0xC9, 0x1F, 0xC5, 0xFA,
+    0x09, 0xF9, 0x5A, 0xF0, 0x9F, 0x95, 0xAF, 0x0A, 0xFA, 0x5F, 0xC0, 0x9F, 0xCA, 0x29, 0xFD, 0x1F,
+    0xFF, 0xF1, 0xAF, 0xFF, 0xD9, 0x2F, 0xFF, 0xCA, 0x4A, 0xFF, 0xD9, 0x7A, 0xAF, 0xA9, 0x40, 0x4A,
+    0xFC, 0x97, 0x9F, 0xFC, 0x94, 0xAF, 0xFE, 0x93, 0xFA, 0x99, 0xAF, 0xC2, 0xF5, 0xFA, 0x1E, 0x96,
+    0xF0, 0x9E, 0x7F, 0x09, 0xE7, 0xAE, 0x99, 0xE7, 0xAE, 0xA9, 0xE7, 0xFA, 0x0E, 0xA5, 0x9F, 0xA0,
+    0xFC, 0x99, 0x9A, 0xFD, 0xA0, 0xAF, 0xFF, 0xDA, 0x1F, 0xFF, 0xDA, 0x2A, 0xFF, 0xFA, 0x4A, 0xFC,
+    0x9F, 0x97, 0x3F, 0x97, 0x2A, 0xF1, 0x9E, 0xAA, 0x99, 0x9A, 0xFC, 0x1A, 0xFF, 0xFC, 0x91, 0xFF,
+    0xFD, 0x2F, 0xFF, 0xC3, 0x9A, 0xAF, 0xEA, 0x97, 0x74, 0x09, 0xFA, 0x1A, 0xFA, 0x1A, 0xFC, 0x1F,
+    0xD1, 0xFD, 0x09, 0xFD, 0x99, 0xFD, 0x97, 0x77, 0x77, 0x70, 0x9F, 0xA1, 0xAF, 0xA1, 0xAF, 0xC1,
+    0xFD, 0x1F, 0xD0, 0x9F, 0xD9, 0x9F, 0xD9, 0x74, 0xFC, 0x39, 0xFC, 0x39, 0xFC, 0x3A, 0xFC, 0x92,
+    0xFD, 0x92, 0xFD, 0xA2, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x69, 0xAA, 0xAA, 0xAA, 0x91, 0xAF, 0xD2,
+    0xAF, 0xD2, 0x9F, 0xCA, 0x29, 0xFC, 0x92, 0xFD, 0x3F, 0xD2, 0xAF, 0xC9, 0x2F, 0xD2, 0x9F, 0xD3,
+    0x99, 0x99, 0x93, 0x77, 0x39, 0x97, 0x72, 0x9D, 0x97, 0x70, 0xAF, 0xA7, 0x59, 0xAF, 0xDA, 0x73,
+    0x9F, 0xFC, 0x97, 0x1A, 0xFF, 0xC9, 0x71, 0xAF, 0xFC, 0x97, 0x09, 0xFF, 0xD9, 0x70, 0x9F, 0xFD,
+    0x97, 0x2F, 0xFC, 0x97, 0x4F, 0xF9, 0x75, 0xFF, 0xEA, 0x97, 0x0A, 0xFF, 0xFE, 0xA6, 0x99, 0xAF,
+    0xFF, 0xEA, 0x97, 0x9F, 0xFF, 0xD9, 0x71, 0x9A, 0xFF, 0xD9, 0x74, 0x9A, 0xFE, 0x97, 0x70, 0xAF,
+    0x97, 0x73, 0x9A, 0x90, 0x19, 0x99, 0x9A, 0xAA, 0xAF, 0x2A, 0xFF, 0xFA, 0x1F, 0xFF, 0xD0, 0xAF,
+    0xFF, 0xD0, 0x99, 0x99, 0x77, 0x77, 0x69, 0x99, 0x29, 0xAF, 0xFE, 0x91, 0xFF, 0xFC, 0xA0, 0x9F,
+    0xFF, 0xD0, 0xAF, 0xCA, 0xAA, 0xAA, 0xAA, 0x99, 0x00, 0x09, 0x97, 0x74, 0x9D, 0x97, 0x72, 0x9F,
+    0xA7, 0x70, 0xAF, 0xDA, 0x97, 0x59, 0xFF, 0xC9, 0x75, 0x9F, 0xFC, 0xA7, 0x59, 0xFF, 0xCA, 0x75,
+    0x9F, 0xFD, 0x97, 0x49, 0xFF, 0xD9, 0x74, 0x9F, 0xFC, 0x75, 0x9F, 0xF7, 0x19, 0xAF, 0xFE, 0x6A,
+    0xFF, 0xFE, 0xA1, 0x9A, 0xFF, 0xFE, 0xA9, 0x91, 0x9F, 0xFF, 0xDA, 0x69, 0xFF, 0xDA, 0x97, 0x19,
+    0xFE, 0xA9, 0x74, 0x9F, 0xA7, 0x70, 0x9A, 0x97, 0x73, 0x77, 0x7A, 0xAA, 0xA9, 0x71, 0x9F, 0xFA,
+    0x6A, 0xFF, 0xE9, 0x29, 0xFF, 0xFD, 0x29, 0xFC, 0xA2, 0x9F, 0xC2, 0xAD, 0x96, 0xF9, 0x2C, 0x97,
+    0xAF, 0x74, 0x9F, 0x74, 0x9F, 0x75, 0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4F, 0xA7, 0x3A, 0xF9, 0x71,
+    0x9F, 0xD7, 0x0A, 0xFE, 0x70, 0xAF, 0xE7, 0x1F, 0xE7, 0x2F, 0xCA, 0x73, 0xFC, 0xA7, 0x3F, 0xCA,
+    0x73, 0xFC, 0xA7, 0x3F, 0xC9, 0x72, 0x9D, 0xA9, 0x75, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0F,
+    0x97, 0x39, 0xFA, 0x73, 0x9F, 0xA7, 0x3A, 0xFC, 0x73, 0xFD, 0x73, 0xFD, 0x73, 0x99, 0x99, 0x99,
+    0x60, 0x75, 0x9A, 0xAA, 0xA9, 0x77, 0x1A, 0xFF, 0xC9, 0x75, 0x9F, 0xFF, 0xA7, 0x3A, 0xFA, 0x92,
+    0x9A, 0xEA, 0x71, 0xAE, 0xA7, 0x0E, 0x97, 0xAE, 0x97, 0x2E, 0x7E, 0x97, 0x4D, 0xA5, 0xEA, 0x3A,
+    0xDA, 0xD3, 0xAD, 0x49, 0xE3, 0xFE, 0x39, 0xD4, 0xAE, 0x2A, 0xCA, 0x1E, 0x4D, 0x93, 0xEA, 0x2D,
+    0x29, 0xD4, 0xD9, 0x3E, 0xA2, 0xCA, 0x3D, 0x4D, 0x92, 0x9E, 0xA1, 0x9C, 0x93, 0xD9, 0x29, 0xD3,
+    0x9E, 0xA1, 0x9C, 0xA2, 0x9D, 0x92, 0xE3, 0x9F, 0x2F, 0xFA, 0x1A, 0xDA, 0x39, 0xF2, 0xAF, 0xEA,
+    0x9F, 0x5F, 0xA2, 0xAE, 0xAA, 0xFD, 0x95, 0xFC, 0x97, 0xFC, 0x7A, 0xFC, 0x70, 0x99, 0x72, 0xFD,
+    0x97, 0x73, 0xAF, 0xE9, 0x92, 0x9A, 0xD9, 0x71, 0xFF, 0xFF, 0xA7, 0x2F, 0xFF, 0xF7, 0x3A, 0xFF,
+    0xFD, 0x74, 0x9A, 0xFF, 0xF9, 0x76, 0x9A, 0xFD, 0xA9, 0x97, 0x77, 0x60, 0x71, 0xF9, 0x77, 0x29,
+    0xFC, 0x77, 0x2F, 0xD7, 0x72, 0xFD, 0xA7, 0x70, 0xAF, 0xE7, 0x70, 0xFF, 0x97, 0x69, 0xFA, 0xF7,
+    0x6F, 0xA0, 0xF7, 0x6F, 0x90, 0xFA, 0x74, 0xAF, 0x1A, 0xF7, 0x4F, 0xA1, 0x9F, 0x97, 0x29, 0xF9,
+    0x2F, 0xC7, 0x2F, 0xC3, 0xAF, 0x72, 0xFC, 0x39, 0xFA, 0x70, 0xAF, 0x94, 0xFC, 0x70, 0xFC, 0xA9,
+    0x99, 0x99, 0xFC, 0x96, 0x9F, 0xFF, 0xFA, 0x6A, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0xDA, 0x4A, 0xFF,
+    0xFF, 0xE4, 0xFF, 0xFF, 0xF9, 0x29, 0xFC, 0xA7, 0x0F, 0xCA, 0x2A, 0xFC, 0x71, 0xFD, 0x2F, 0xD7,
+    0x1A, 0xFC, 0x90, 0x9F, 0xCA, 0x71, 0x9F, 0xD0, 0x9F, 0xFD, 0xA9, 0x69, 0xFF, 0xFC, 0x94, 0x9F,
+    0xFF, 0xDA, 0x39, 0xFF, 0xFE, 0x92, 0x9F, 0xA4, 0x9F, 0xC2, 0x9F, 0xA5, 0x9F, 0x29, 0xFA, 0x6F,
+    0x29, 0xFA, 0x6F, 0x29, 0xFA, 0x59, 0xF2, 0x9F, 0xA2, 0x99, 0xAF, 0xA2, 0x9F, 0xFF, 0xE3, 0x9F,
+    0xFF, 0xD9, 0x39, 0xFF, 0xFE, 0xA2, 0x9F, 0xFF, 0xFC, 0x19, 0xFA, 0x5A, 0xFC, 0x90, 0x9F, 0xA6,
+    0x9F, 0xC0, 0x9F, 0xA7, 0xFC, 0x09, 0xFA, 0x69, 0xFC, 0x09, 0xFA, 0x99, 0x99, 0x99, 0xAF, 0xD0,
+    0x9F, 0xFF, 0xFD, 0x09, 0xFF, 0xFF, 0xD0, 0x9F, 0xFF, 0xFC, 0xA0, 0x9F, 0xFF, 0xFC, 0x19, 0xFF,
+    0xFE, 0xA2, 0x9F, 0xFF, 0xCA, 0x40, 0x77, 0x77, 0x9A, 0xFD, 0xAA, 0x97, 0x09, 0xFF, 0xF7, 0xFF,
+    0xFD, 0x6F, 0xFF, 0xDA, 0x5F, 0xFF, 0xE9, 0x4A, 0xFF, 0xAA, 0xAA, 0xAD, 0x94, 0xFE, 0x97, 0x4A,
+    0xFD, 0x76, 0xFD, 0x76, 0x9F, 0xCA, 0x76, 0xAF, 0xC9, 0x76, 0xFD, 0x77, 0xFD, 0x77, 0xFD, 0x77,
+    0xFD, 0x77, 0xFD, 0x77, 0xFD, 0xA7, 0x6F, 0xE9, 0x75, 0xFF, 0xC9, 0x92, 0x99, 0xAC, 0x92, 0x9F,
+    0xFF, 0xFC, 0x93, 0xFF, 0xFF, 0xC9, 0x3A, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0xA5, 0xFF, 0xFE, 0xA6,
+    0xFF, 0xFD, 0xA7, 0x9F, 0xFF, 0xA0, 0x9F, 0xFE, 0xA9, 0x79, 0xFF, 0xFD, 0xA9, 0x49, 0xFF, 0xFF,
+    0xA3, 0x9F, 0xFF, 0xFD, 0x29, 0xFF, 0xFF, 0xE1, 0x9F, 0xC5, 0x9F, 0xE9, 0x09, 0xFC, 0x79, 0xFD,
+    0x09, 0xFC, 0x71, 0xFC, 0x09, 0xFC, 0x71, 0x9F, 0x99, 0xFC, 0x72, 0xFA, 0x9F, 0xC7, 0x2A, 0xF9,
+    0xFC, 0x72, 0xAF, 0x9F, 0xC7, 0x2A, 0xF9, 0xFC, 0x72, 0xFC, 0x9F, 0xC7, 0x2F, 0xC9, 0xFC, 0x71,
+    0x9F, 0xA9, 0xFC, 0x70, 0x9F, 0xCA, 0x9F, 0xC4, 0x99, 0xAF, 0xE9, 0x9F, 0xFF, 0xFF, 0x09, 0xFF,
+    0xFF, 0xF0, 0x9F, 0xFF, 0xFE, 0x90, 0x9F, 0xFF, 0xFE, 0x19, 0xFF, 0xFF, 0xD2, 0x9F, 0xFF, 0xFA,
+    0x39, 0xFF, 0xFA, 0xA9, 0x50, 0x19, 0xAA, 0xAA, 0xAA, 0xAF, 0xE9, 0x19, 0xFF, 0xFE, 0x2A, 0xFF,
+    0xFE, 0x2A, 0xFF, 0xFD, 0xA2, 0xAF, 0xAA, 0x99, 0x99, 0x96, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75,
+    0xAF, 0x75, 0xAF, 0x99, 0x99, 0x99, 0xAA, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFF,
+    0xFC, 0x5F, 0xC9, 0x74, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0x99,
+    0x92, 0xFF, 0xFF, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0xA1, 0xFF, 0xFF, 0xA0, 0x9F,
+    0xFF, 0xFC, 0x00, 0x1A, 0xAA, 0xAA, 0xAA, 0xFE, 0x1F, 0xFF, 0xD1, 0xFF, 0xFD, 0x1F, 0xFF, 0xD1,
+    0xFC, 0x99, 0x99, 0x6F, 0xA7, 0x19, 0xF9, 0x71, 0x9F, 0x97, 0x19, 0xF7, 0x29, 0xFF, 0xF9, 0x19,
+    0xFF, 0xF9, 0x1A, 0xFF, 0xF9, 0x1A, 0xFF, 0xF9, 0x1A, 0xFF, 0xF9, 0x1A, 0xF7, 0x2A, 0xF7, 0x2F,
+    0xC9, 0x71, 0xFC, 0x97, 0x1F, 0xC9, 0x71, 0xFC, 0x97, 0x1F, 0xC9, 0x71, 0xFC, 0xA7, 0x1F, 0xCA,
+    0x71, 0xFC, 0xA7, 0x1F, 0xCA, 0x70, 0x9F, 0xCA, 0x70, 0x70, 0x9A, 0xAA, 0xDA, 0xAA, 0x99, 0x97,
+    0x29, 0xFF, 0xFD, 0x70, 0x9F, 0xFF, 0xF7, 0x9F, 0xFF, 0xFC, 0x96, 0xFF, 0xFF, 0xD9, 0x5F, 0xFA,
+    0x95, 0x9A, 0xA9, 0x5F, 0xDA, 0x77, 0x1A, 0xFD, 0x77, 0x2F, 0xD9, 0x77, 0x2F, 0xD7, 0x73, 0xFC,
+    0xA7, 0x73, 0xFC, 0xA7, 0x73, 0xFC, 0xA5, 0x9A, 0xA9, 0x97, 0x9F, 0xCA, 0x59, 0xFF, 0xAA, 0x2F,
+    0xCA, 0x6F, 0xFD, 0x91, 0xFD, 0x6F, 0xFD, 0xA1, 0xFD, 0x69, 0xAF, 0xFA, 0x1F, 0xDA, 0x71, 0xAF,
+    0xD1, 0xAF, 0xD9, 0x70, 0xFC, 0x39, 0xFF, 0x99, 0x39, 0xAF, 0xC4, 0xFF, 0xFF, 0xFC, 0x49, 0xFF,
+    0xFF, 0xF5, 0x9F, 0xFF, 0xFE, 0x69, 0xFF, 0xFF, 0xD7, 0x0A, 0xFF, 0xFD, 0x97, 0x39, 0xAF, 0xDA,
+    0xA9, 0x60, 0x0A, 0xF9, 0x70, 0xFC, 0x1A, 0xF9, 0x70, 0xFC, 0x1A, 0xF9, 0x70, 0xFC, 0x1A, 0xFA,
+    0x70, 0xFC, 0x1A, 0xFA, 0x70, 0xFC, 0x1A, 0xFA, 0x79, 0xFC, 0x1F, 0xCA, 0x79, 0xFC, 0x1F, 0xCA,
+    0x79, 0xFC, 0x1F, 0xCA, 0x79, 0xFC, 0x1F, 0xCA, 0x79, 0xFC, 0x90, 0xFD, 0x79, 0xFC, 0x90, 0xFD,
+    0x79, 0xFC, 0x90, 0xFD, 0x79, 0xFC, 0x90, 0xFD, 0x99, 0x99, 0x99, 0x99, 0xAF, 0xC9, 0x0F, 0xFF,
+    0xFF, 0x90, 0xFF, 0xFF, 0xFA, 0x0F, 0xFF, 0xFF, 0xA0, 0xFF, 0xFF, 0xFA, 0x0F, 0xFF, 0xFF, 0xA0,
+    0xFF, 0xFF, 0xFA, 0x0F, 0xD7, 0xAF, 0xCA, 0x0F, 0xD7, 0xFE, 0x0F, 0xD7, 0xFE, 0x0F, 0xD9, 0x6F,
+    0xE9, 0xFD, 0x96, 0xFE, 0x0F, 0xC2, 0xFC, 0x2F, 0xC2, 0xFC, 0x2F, 0xC2, 0xFC, 0x2A, 0xF2, 0xAF,
+    0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF9, 0x1A, 0xF9, 0x1A, 0xF9, 0x1A,
+    0xFA, 0x1F, 0xCA, 0x1F, 0xCA, 0x1F, 0xCA, 0x1F, 0xD1, 0xFD, 0x1F, 0xD1, 0xFD, 0x00, 0x73, 0xAF,
+    0xA7, 0x3F, 0xCA, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xC7, 0x39, 0xFC, 0x73,
+    0x9F, 0xC7, 0x39, 0xFC, 0x73, 0xAF, 0xA7, 0x3A, 0xFA, 0x73, 0xFC, 0xA7, 0x3F, 0xC9, 0x73, 0xFC,
+    0x97, 0x3F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x39, 0xFC, 0x73, 0x9F, 0xC7, 0x3A, 0xFA, 0x73, 0xAF,
+    0xA7, 0x3A, 0xF9, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x29, 0xDA, 0x91, 0x9F, 0xD3, 0x9F, 0xFF, 0xC3,
+    0xAF, 0xFF, 0xA3, 0xFF, 0xFC, 0x4F, 0xFF, 0x94, 0xFF, 0xEA, 0x59, 0x9A, 0xAF, 0xCA, 0x77, 0x70,
+    0x2A, 0xF3, 0xAF, 0xC9, 0x5F, 0xC3, 0xFD, 0x6F, 0xC2, 0xAF, 0xC9, 0x6F, 0xC1, 0x9F, 0xCA, 0x7F,
+    0xA1, 0xFD, 0x70, 0xFA, 0x09, 0xFC, 0x97, 0x9F, 0xA0, 0xFD, 0x70, 0x9F, 0x9A, 0xFC, 0x97, 0x0A,
+    0xF9, 0xFC, 0xA7, 0x1A, 0xFF, 0xD7, 0x2A, 0xFF, 0xC9, 0x72, 0xFF, 0xD7, 0x3F, 0xFC, 0x97, 0x3F,
+    0xFA, 0x74, 0xFF, 0x97, 0x39, 0xFF, 0xC9, 0x72, 0x9F, 0xFD, 0x97, 0x19, 0xFF, 0xEA, 0x70, 0xAF,
+    0xFF, 0xA7, 0xAF, 0xAA, 0xFF, 0x6F, 0xCA, 0x0A, 0xFF, 0x5F, 0xCA, 0x1F, 0xFC, 0x4F, 0xCA, 0x2F,
+    0xFC, 0x3F, 0xCA, 0x29, 0xFF, 0xC9, 0x1F, 0xCA, 0x39, 0xFF, 0xC9, 0x1F, 0xC7, 0x4F, 0xC7, 0x4F,
+    0xC7, 0x4F, 0xC7, 0x4F, 0xA7, 0x4F, 0xA7, 0x39, 0xFA, 0x73, 0x9F, 0xA7, 0x39, 0xFA, 0x73, 0x9F,
+    0xA7, 0x39, 0xFA, 0x73, 0xAF, 0xA7, 0x3A, 0xFA, 0x73, 0xAF, 0xA7, 0x3A, 0xF9, 0x73, 0xFC, 0x97,
+    0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0xAA, 0xAA, 0xAA, 0xAF, 0x90, 0xFF, 0xFF,
+    0x90, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x90, 0x09, 0xFD, 0x71,
+    0xFD, 0x29, 0xFD, 0x97, 0x0F, 0xD2, 0x9F, 0xDA, 0x7A, 0xFD, 0x91, 0xAF, 0xE7, 0xFE, 0x91, 0xAF,
+    0xE9, 0x59, 0xFE, 0x91, 0xAF, 0xF5, 0xAF, 0xE9, 0x1A, 0xFF, 0x94, 0xFF, 0x91, 0xAF, 0xFA, 0x3A,
+    0xFF, 0x91, 0xAF, 0xFC, 0x3F, 0xFC, 0xA1, 0xAF, 0xFC, 0xA1, 0x9F, 0xFC, 0xA1, 0xFF, 0xE1, 0xAF,
+    0xFC, 0xA1, 0xFC, 0x9F, 0xC9, 0x0F, 0xCA, 0xFA, 0x1F, 0xC0, 0xFC, 0xA9, 0xFC, 0xAF, 0xA1, 0xFC,
+    0x0A, 0xFF, 0xDA, 0xAF, 0xA1, 0xFC, 0x99, 0xFF, 0xD0, 0xAF, 0xC1, 0xFC, 0x90, 0xFF, 0xD0, 0xFD,
+    0x1F, 0xC9, 0x0A, 0xFF, 0xA0, 0xFD, 0x1F, 0xCA, 0x09, 0xFF, 0x90, 0xFD, 0x1F, 0xCA, 0x1F, 0xF1,
+    0xFD, 0x1F, 0xCA, 0x1A, 0xFD, 0xA1, 0xFD, 0x1F, 0xCA, 0x2F, 0xD9, 0x09, 0xFD, 0x1F, 0xD2, 0xFD,
+    0x19, 0xFD, 0x1F, 0xD2, 0xAF, 0xC1, 0x9F, 0xD1, 0xFD, 0x3F, 0x91, 0xAF, 0xD0, 0x9F, 0xD7, 0x2A,
+    0xFD, 0x00, 0x77, 0x0F, 0x91, 0x9A, 0xAA, 0xAA, 0x70, 0xF9, 0x19, 0xFC, 0xA6, 0x9F, 0x91, 0xAF,
+    0xD6, 0x9F, 0x91, 0xAF, 0xD9, 0x59, 0xF2, 0xAF, 0xE5, 0xAF, 0x2F, 0xF9, 0x4A, 0xF2, 0xFF, 0xC4,
+    0xAF, 0x2F, 0xFC, 0x93, 0xFC, 0x2F, 0xFD, 0x3F, 0xC2, 0xFF, 0xD9, 0x2F, 0xC2, 0xFC, 0xAF, 0xC2,
+    0xFC, 0x19, 0xFC, 0x9A, 0xF2, 0xFC, 0x19, 0xFC, 0xA0, 0xFA, 0x1F, 0xC1, 0x9F, 0xCA, 0x0F, 0xC1,
+    0xFA, 0x1A, 0xFC, 0xA0, 0x9F, 0xA9, 0xFA, 0x1A, 0xFC, 0xA1, 0xFC, 0xAF, 0xA1, 0xAF, 0xCA, 0x1A,
+    0xFF, 0xCA, 0x1A, 0xFC, 0xA2, 0xFF, 0xCA, 0x1F, 0xDA, 0x2A, 0xFF, 0x91, 0xFE, 0x29, 0xFF, 0x91,
+    0xFE, 0x3F, 0xF9, 0x1F, 0xE3, 0x9F, 0xE9, 0x1F, 0xE4, 0xFE, 0x2F, 0xE4, 0xAF, 0xD1, 0x79, 0xAF,
+    0xCA, 0x97, 0x59, 0xFF, 0xE9, 0x72, 0xAF, 0xFF, 0xD7, 0x0A, 0xFF, 0xFF, 0x6A, 0xFD, 0x92, 0x9F,
+    0xDA, 0x49, 0xFC, 0xA6, 0xAF, 0xC9, 0x3A, 0xFC, 0x70, 0xAF, 0xC3, 0xFC, 0x72, 0xFC, 0x91, 0xAF,
+    0xC7, 0x2A, 0xFA, 0x1F, 0xC9, 0x72, 0x9F, 0xC1, 0xFC, 0x74, 0xFC, 0x1F, 0xC7, 0x4F, 0xC1, 0xFC,
+    0x74, 0xFC, 0x99, 0xFC, 0x74, 0xFC, 0x99, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0x74, 0xFC, 0x90, 0xFC,
+    0x74, 0xFC, 0x1F, 0xD7, 0x2A, 0xFC, 0x1F, 0xDA, 0x70, 0x9F, 0xD1, 0xFF, 0xA9, 0x90, 0x99, 0xAF,
+    0xF1, 0xAF, 0xFF, 0xFF, 0xCA, 0x2F, 0xFF, 0xFF, 0xC9, 0x2A, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE9,
+    0x5F, 0xFF, 0xFC, 0xA7, 0xAF, 0xFF, 0xD9, 0x72, 0x9A, 0xFE, 0xAA, 0x97, 0x77, 0x60, 0x1A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x97, 0x0F, 0xFE, 0xA6, 0xFF, 0xFC, 0x94, 0xFF, 0xFD, 0x93, 0xF9, 0x39, 0xFC,
+    0x3F, 0x95, 0xF9, 0x2F, 0x95, 0xAE, 0xA1, 0x9F, 0x95, 0xAF, 0x19, 0xF9, 0x5F, 0xC1, 0x9F, 0xA9,
+    0x99, 0x9A, 0xFD, 0x19, 0xFF, 0xFE, 0xA1, 0xAF, 0xFF, 0xE2, 0xAF, 0xFF, 0xDA, 0x2A, 0xFF, 0xFC,
+    0xA3, 0xAF, 0xFF, 0x94, 0xAF, 0xFC, 0xA9, 0x6F, 0xCA, 0x74, 0xFC, 0xA7, 0x4F, 0xD7, 0x4F, 0xD7,
+    0x4F, 0xD7, 0x4F, 0xD7, 0x4F, 0xD7, 0x4F, 0xD7, 0x39, 0xFD, 0x73, 0x77, 0x77, 0x29, 0xFE, 0xA7,
+    0x79, 0xFF, 0xEA, 0x74, 0xAF, 0xFF, 0xD7, 0x2A, 0xFF, 0xFF, 0x70, 0xAF, 0xD9, 0x29, 0xFD, 0xA7,
+    0xFC, 0xA6, 0xAF, 0xC9, 0x5A, 0xFC, 0x70, 0xAF, 0xC5, 0xFC, 0x97, 0x1F, 0xC4, 0x9F, 0xC7, 0x2A,
+    0xF9, 0x3A, 0xF9, 0x72, 0x9F, 0xA3, 0xFC, 0x97, 0x29, 0xFC, 0x3F, 0xC7, 0x4F, 0xC3, 0xFC, 0x74,
+    0xFC, 0x3F, 0xC7, 0x4F, 0xC3, 0xFC, 0x74, 0xFC, 0x3F, 0xC9, 0x73, 0xFC, 0x3F, 0xCA, 0x49, 0xC9,
+    0x29, 0xFA, 0x3A, 0xFC, 0x4F, 0x99, 0xFC, 0x93, 0x9F, 0xDA, 0x99, 0x9F, 0xFE, 0x5F, 0xFF, 0xFF,
+    0xC5, 0xAF, 0xFF, 0xFE, 0x96, 0xFF, 0xFF, 0xE7, 0x9F, 0xFF, 0xFC, 0x71, 0x9F, 0xFF, 0xF7, 0x3F,
+    0xFF, 0xEA, 0x74, 0xAF, 0xFF, 0xCA, 0x77, 0x09, 0xFF, 0xC9, 0x77, 0x09, 0xFF, 0xC9, 0x77, 0x09,
+    0xFF, 0xC7, 0x71, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x1A, 0xFF, 0xA9, 0x70, 0xFF, 0xF9, 0x6F,
+    0xFF, 0xC9, 0x5F, 0x99, 0x99, 0x9A, 0xF5, 0xF5, 0xAE, 0xA4, 0xF6, 0xF4, 0xF6, 0xF4, 0xF6, 0xF3,
+    0x9F, 0x59, 0xF3, 0x9F, 0x5F, 0xC3, 0x9F, 0xAA, 0xAA, 0xFD, 0x93, 0x9F, 0xFF, 0xD4, 0xAF, 0xFF,
+    0xC5, 0xAF, 0xFF, 0xC5, 0xAF, 0xFF, 0xD4, 0xAF, 0xD9, 0x09, 0xFC, 0x93, 0xFD, 0x39, 0xFC, 0x3F,
+    0xD4, 0xFC, 0x3F, 0xD4, 0xFC, 0xA2, 0xFD, 0x4F, 0xD2, 0xFD, 0x93, 0xFD, 0x2F, 0xD9, 0x3F, 0xDA,
+    0x1F, 0xD9, 0x3F, 0xE1, 0xFD, 0xA3, 0xFE, 0x1A, 0xAA, 0xAA, 0xA9, 0x3A, 0xAA, 0xAA, 0xAA, 0x00,
+    0x77, 0x75, 0x9F, 0xFC, 0xA9, 0x70, 0x9F, 0xFF, 0xA7, 0x9F, 0xFF, 0xC7, 0x0F, 0xFF, 0xCA, 0x7A,
+    0xFD, 0x92, 0x9A, 0xC7, 0x0F, 0xCA, 0x77, 0x0F, 0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xC9, 0x77, 0x0A,
+    0xFC, 0xA9, 0x76, 0x9F, 0xFC, 0xA9, 0x73, 0xAF, 0xFF, 0x97, 0x1F, 0xFF, 0xD7, 0x19, 0xFF, 0xFC,
+    0x97, 0x19, 0xAF, 0xFE, 0x75, 0x9A, 0xFF, 0x77, 0xAF, 0xD7, 0x70, 0xAF, 0xC9, 0x3D, 0xA7, 0x0A,
+    0xFC, 0x92, 0xAF, 0xCA, 0x49, 0xFD, 0x91, 0x9F, 0xFF, 0xFE, 0x19, 0xFF, 0xFF, 0xE9, 0x1F, 0xFF,
+    0xFE, 0x93, 0xAF, 0xFF, 0xEA, 0x79, 0x9A, 0xFF, 0xA9, 0x77, 0x74, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F,
+    0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC7, 0x1F,
+    0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F,
+    0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7,
+    0x70, 0x9F, 0xC7, 0x70, 0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x77,
+    0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x70, 0x9F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD9,
+    0x0F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD,
+    0x1F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xCA, 0x7F, 0xD1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7,
+    0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7,
+    0xAF, 0xA1, 0xAF, 0xC7, 0xFC, 0xA1, 0xAF, 0xC9, 0x59, 0xFC, 0xA1, 0xAF, 0xEA, 0xAA, 0xAF, 0xE9,
+    0x19, 0xFF, 0xFF, 0xD9, 0x2F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x39, 0xFF, 0xFF, 0x94, 0xAF, 0xFF,
+    0xDA, 0x69, 0xFF, 0xF9, 0x77, 0x71, 0x0F, 0xC7, 0x4F, 0xC1, 0xFC, 0x97, 0x29, 0xFC, 0x1A, 0xFC,
+    0x72, 0xFC, 0x92, 0xFC, 0x72, 0xFC, 0x3F, 0xCA, 0x70, 0xAF, 0xC3, 0xAF, 0xC7, 0x0F, 0xCA, 0x39,
+    0xFC, 0x96, 0xAF, 0xC5, 0xFD, 0x6F, 0xD5, 0xAF, 0xC5, 0x9F, 0xCA, 0x59, 0xFC, 0xA4, 0xFD, 0x7F,
+    0xD3, 0x9F, 0xD7, 0xAF, 0xC9, 0x2A, 0xFC, 0xA7, 0x9F, 0xCA, 0x2F, 0xD9, 0x70, 0xFD, 0x1A, 0xFD,
+    0x71, 0xFD, 0xA0, 0xFD, 0xA7, 0x19, 0xFD, 0xAF, 0xD9, 0x72, 0xFF, 0xFC, 0x73, 0xFF, 0xFA, 0x73,
+    0xAF, 0xFE, 0x97, 0x4F, 0xFE, 0x75, 0xFF, 0xDA, 0x75, 0xAF, 0xFC, 0x97, 0x59, 0xFF, 0xC7, 0x7F,
+    0xFA, 0x77, 0xAF, 0xE9, 0x70, 0x0A, 0xAA, 0xAA, 0xA7, 0x73, 0xAA, 0xAA, 0xAA, 0x0F, 0xD7, 0x73,
+    0xFC, 0xA0, 0xFD, 0x77, 0x29, 0xFC, 0x90, 0xAF, 0xC9, 0x77, 0x1A, 0xFC, 0x19, 0xFC, 0xA7, 0x71,
+    0xFD, 0x2F, 0xD7, 0x71, 0xFC, 0xA2, 0xFD, 0x77, 0x09, 0xFC, 0x92, 0xAF, 0xC9, 0x5F, 0x5A, 0xFC,
+    0x3A, 0xFC, 0xA4, 0xFC, 0xA4, 0xFD, 0x39, 0xFD, 0x39, 0xFD, 0x4F, 0xCA, 0x4F, 0xD3, 0xFE, 0x92,
+    0x9F, 0xC9, 0x4F, 0xD2, 0x9F, 0xF2, 0xAF, 0xC5, 0xAF, 0xC9, 0x1F, 0xFC, 0x91, 0xFD, 0x59, 0xFC,
+    0xA0, 0x9F, 0xFD, 0x1F, 0xCA, 0x59, 0xFD, 0x0F, 0xFE, 0x99, 0xFC, 0x96, 0xFD, 0xAF, 0xFF, 0xAF,
+    0xC7, 0xFF, 0xFA, 0xAF, 0xFE, 0x7A, 0xFF, 0xE9, 0x9F, 0xFD, 0xA7, 0x9F, 0xFE, 0x1F, 0xFD, 0x97,
+    0x0F, 0xFD, 0xA1, 0xAF, 0xFC, 0x71, 0xFF, 0xD3, 0xFF, 0xC7, 0x1F, 0xFC, 0xA3, 0xFF, 0xA7, 0x1A,
+    0xFF, 0x93, 0x9F, 0xE9, 0x71, 0x9F, 0xF5, 0xFE, 0x73, 0xFE, 0xA5, 0xFE, 0x50, 0x1F, 0xC7, 0x2F,
+    0xC2, 0x9F, 0xC7, 0x0A, 0xF4, 0xAF, 0xA6, 0x9F, 0xA5, 0xFC, 0x95, 0xFC, 0x6A, 0xFC, 0x4F, 0xC9,
+    0x7F, 0xCA, 0x2A, 0xFC, 0x70, 0x9F, 0xC9, 0x09, 0xFC, 0x72, 0xAF, 0xC9, 0xFC, 0xA7, 0x3F, 0xFE,
+    0x74, 0xAF, 0xFC, 0x97, 0x5F, 0xFA, 0x76, 0x9F, 0xE7, 0x70, 0xFD, 0xA7, 0x79, 0xFE, 0x77, 0xFF,
+    0xC7, 0x5A, 0xFF, 0xCA, 0x73, 0x9F, 0xFE, 0x97, 0x2F, 0xFF, 0xC7, 0x1F, 0xE9, 0xFD, 0xA7, 0x9F,
+    0xD9, 0x0A, 0xFD, 0x96, 0xFD, 0xA2, 0xFE, 0x5F, 0xE3, 0xAF, 0xDA, 0x3A, 0xFD, 0x94, 0xFE, 0x92,
+    0xFE, 0x59, 0xFE, 0x1F, 0xE9, 0x6F, 0xEA, 0x0F, 0xC7, 0x2F, 0xC9, 0x0A, 0xFA, 0x70, 0x9F, 0xC2,
+    0xFC, 0x97, 0xFC, 0x92, 0xAF, 0xC6, 0x9F, 0xC4, 0xFC, 0x95, 0xFC, 0xA4, 0xAF, 0xC4, 0x9F, 0xC5,
+    0x9F, 0xC9, 0x3F, 0xCA, 0x6F, 0xD2, 0x9F, 0xC7, 0x9F, 0xC9, 0x1F, 0xCA, 0x70, 0xFD, 0x09, 0xFC,
+    0x71, 0x9F, 0xC9, 0xFC, 0xA7, 0x2F, 0xFE, 0x97, 0x2A, 0xFF, 0xD7, 0x4F, 0xFC, 0x97, 0x4A, 0xFF,
+    0x76, 0xFE, 0x97, 0x6A, 0xFD, 0x77, 0x9F, 0xCA, 0x77, 0x9F, 0xCA, 0x77, 0xAF, 0xCA, 0x77, 0xAF,
+    0xCA, 0x77, 0xAF, 0xD7, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F, 0xE7, 0x19, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
+    0xF2, 0xAF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x3A, 0xFF, 0xFF, 0xD4, 0x9A, 0xAA, 0xAA, 0xAA, 0xAF,
+    0xF9, 0x74, 0xFF, 0x97, 0x4F, 0xFA, 0x74, 0xAF, 0xF7, 0x4A, 0xFF, 0x74, 0xAF, 0xF9, 0x73, 0xAF,
+    0xF9, 0x73, 0xAF, 0xFA, 0x73, 0xAF, 0xFC, 0x73, 0xAF, 0xFC, 0x73, 0xAF, 0xFC, 0x73, 0xAF, 0xFC,
+    0x97, 0x2A, 0xFF, 0xCA, 0x72, 0x9F, 0xFD, 0x99, 0x99, 0x99, 0x99, 0x3F, 0xFF, 0xFF, 0x19, 0xFF,
+    0xFF, 0xF1, 0x9F, 0xFF, 0xFF, 0x90, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF,
+    0xFF, 0xC9, 0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0xFF, 0x2A, 0xFF, 0x2A, 0xFF, 0x2F, 0xA6, 0xFA,
+    0x6F, 0x96, 0xF9, 0x6F, 0x96, 0xF9, 0x6F, 0x96, 0xF7, 0xF7, 0xF7, 0xF6, 0x9F, 0x69, 0xF6, 0x9F,
+    0x69, 0xF6, 0x9F, 0x6A, 0xF6, 0xAF, 0x6A, 0xEA, 0x6A, 0xEA, 0x6A, 0xEA, 0x6A, 0xEA, 0x6F, 0xA6,
+    0xF9, 0x6F, 0x96, 0xF9, 0x6F, 0x96, 0xF9, 0x6F, 0x96, 0xF7, 0xF7, 0xF6, 0x9F, 0x95, 0x9F, 0xFC,
+    0x19, 0xFF, 0xC1, 0x9F, 0xFC, 0x19, 0xFF, 0xC1, 0x9F, 0xFC, 0x75, 0x09, 0x72, 0xA7, 0x2A, 0xA7,
+    0x1D, 0x71, 0xD9, 0x70, 0xDA, 0x79, 0xE7, 0x9E, 0x97, 0xF7, 0xAE, 0x79, 0xEA, 0x7F, 0x7F, 0x96,
+    0xAE, 0xA7, 0xF7, 0xF9, 0x6A, 0xF6, 0x9F, 0x7F, 0xA6, 0xAF, 0x69, 0xF7, 0xFA, 0x6F, 0xC6, 0x9F,
+    0x96, 0xFA, 0x6F, 0xC6, 0xAF, 0x69, 0xEA, 0x7E, 0x70, 0xAD, 0x70, 0x9C, 0x97, 0x1C, 0x72, 0x92,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xA2, 0x9F, 0xF9, 0x19, 0xFF, 0x91, 0x9F, 0xF9, 0x6F, 0x96, 0xFA, 0x6A,
+    0xEA, 0x6A, 0xEA, 0x6A, 0xEA, 0x6A, 0xEA, 0x6A, 0xF6, 0xAF, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F,
+    0x69, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF9, 0x6F, 0x96, 0xF9, 0x6F, 0x96, 0xF9, 0x6F, 0xA6, 0xFA,
+    0x6A, 0xEA, 0x6A, 0xEA, 0x6A, 0xEA, 0x6A, 0xF6, 0xAF, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x19,
+    0xFF, 0xC1, 0x9F, 0xFC, 0x19, 0xFF, 0xC2, 0xFF, 0xC2, 0xFF, 0xC7, 0x40, 0x77, 0x7E, 0x97, 0x3A,
+    0xF7, 0x29, 0xFD, 0x70, 0x9F, 0xF6, 0x9F, 0x9F, 0xC4, 0xAE, 0xA2, 0xAF, 0x2A, 0xE9, 0x5F, 0x00,
+    0x77, 0x5F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0xA0, 0xFF, 0xFF, 0xEA, 0x76, 0x99,
+    0x99, 0x90, 0x0F, 0xA7, 0xFC, 0x7F, 0xC9, 0x6F, 0xCA, 0x6A, 0xFC, 0x74, 0x77, 0x49, 0xAE, 0xA7,
+    0x1A, 0xFF, 0xDA, 0x39, 0xFF, 0xEA, 0x3F, 0xA9, 0xAF, 0xD2, 0x9E, 0x93, 0xFC, 0x2E, 0xA4, 0x9F,
+    0x2E, 0x95, 0xF2, 0xE6, 0xAE, 0x90, 0x9D, 0xA6, 0xAE, 0x90, 0xAD, 0xA6, 0x9E, 0xA0, 0x9D, 0x96,
+    0x9E, 0xA0, 0x9D, 0xA6, 0xAF, 0x09, 0xEA, 0x99, 0x99, 0xAF, 0xD1, 0xFF, 0xFE, 0x1A, 0xFF, 0xFD,
+    0x2F, 0xFF, 0xD9, 0x19, 0xFF, 0xAF, 0x93, 0xAF, 0xA9, 0x50, 0x9F, 0x74, 0x9F, 0x74, 0x9F, 0x74,
+    0x9F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF1, 0xAE, 0x96, 0xF9, 0xFE, 0x94, 0xFF, 0xFC,
+    0x93, 0xFF, 0xFD, 0x3A, 0xFD, 0xA0, 0x9A, 0xEA, 0x2A, 0xFC, 0x93, 0x9E, 0x2A, 0xFC, 0x5E, 0x91,
+    0xAF, 0xA5, 0xAD, 0xA1, 0x9F, 0x95, 0xAE, 0x19, 0xF9, 0x5F, 0x19, 0xF9, 0x49, 0xF1, 0x9F, 0xC9,
+    0x29, 0xFC, 0x2F, 0xFF, 0xDA, 0x2F, 0xFF, 0xD9, 0x2A, 0xFF, 0xFA, 0x4F, 0xFE, 0xA6, 0xFF, 0xC9,
+    0x71, 0x9A, 0x99, 0x70, 0x77, 0x39, 0xAF, 0xA9, 0x49, 0xFF, 0xA3, 0x9F, 0xFC, 0xA3, 0xFF, 0xDA,
+    0x2A, 0xF9, 0x70, 0xF9, 0x70, 0x9F, 0x71, 0x9F, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0x9F, 0x97, 0x09,
+    0xFC, 0x71, 0xFC, 0xA1, 0x9C, 0xA3, 0xAF, 0xFD, 0x93, 0xFF, 0xE9, 0x3A, 0xFF, 0xD5, 0xAF, 0xCA,
+    0x91, 0x74, 0xF9, 0x74, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF5, 0x9E, 0xA9,
+    0x09, 0xF4, 0xFF, 0xFC, 0x3F, 0xFF, 0xD2, 0xFF, 0xFD, 0xA1, 0x9F, 0x91, 0xAF, 0xDA, 0x1F, 0x93,
+    0xAF, 0xCA, 0x1F, 0x5F, 0xCA, 0x09, 0xE9, 0x5F, 0xCA, 0x0A, 0xE9, 0x5A, 0xF9, 0x09, 0xE9, 0x5A,
+    0xF9, 0x09, 0xE9, 0x5F, 0xC9, 0x1F, 0x49, 0xFC, 0x91, 0xFC, 0xAA, 0xAA, 0xFD, 0xA1, 0xAF, 0xFF,
+    0xDA, 0x2F, 0xFF, 0xDA, 0x2A, 0xFF, 0xFC, 0xA3, 0xAF, 0xFA, 0xEA, 0x5A, 0xF9, 0x60, 0x49, 0xAE,
+    0xA9, 0x70, 0xAF, 0xF6, 0xFF, 0xE9, 0x3F, 0xC9, 0x19, 0xF2, 0x9F, 0x5E, 0x91, 0xFA, 0xAA, 0xAA,
+    0xAF, 0xC1, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x9A, 0xFA, 0x99, 0x99, 0x69, 0xF7,
+    0x39, 0xF9, 0x73, 0xFD, 0x95, 0xAC, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC4, 0xFF,
+    0xEA, 0x59, 0xAF, 0xCA, 0x92, 0x49, 0xAF, 0x4A, 0xFD, 0x39, 0xFE, 0x3F, 0xF3, 0xF7, 0xF7, 0xF4,
+    0xAF, 0xFD, 0x9A, 0xFF, 0xD9, 0xAF, 0xFD, 0x9A, 0xFF, 0xD9, 0x19, 0xF9, 0x6F, 0x95, 0x9F, 0x95,
+    0x9F, 0x95, 0x9F, 0x95, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0xAF, 0xA5, 0xAF, 0xA5,
+    0xAF, 0xA5, 0xAF, 0xC3, 0x4A, 0xEA, 0x90, 0xAE, 0xA2, 0x9F, 0xEA, 0xFA, 0x19, 0xFF, 0xFC, 0xA1,
+    0xFC, 0xAF, 0xF9, 0x0A, 0xE3, 0xAF, 0xD9, 0x0E, 0x94, 0xFD, 0x99, 0xE5, 0x9F, 0xC9, 0x9D, 0xA6,
+    0xFC, 0x9A, 0xDA, 0x6F, 0xC9, 0xAD, 0xA6, 0xFC, 0x09, 0xE5, 0x9F, 0xC0, 0x9E, 0xA3, 0x9F, 0xD1,
+    0xFF, 0xFE, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0x9F, 0xFF, 0x59, 0xAC, 0xAA,
+    0x09, 0xEA, 0x73, 0xAE, 0xA7, 0x3F, 0x92, 0xCA, 0x5F, 0xC3, 0xFC, 0xAF, 0xDA, 0x29, 0xFF, 0xF3,
+    0xAF, 0xFE, 0xA3, 0xFF, 0xEA, 0x49, 0x9A, 0xFD, 0xA5, 0x1F, 0x97, 0x4F, 0x97, 0x4F, 0x97, 0x4F,
+    0x97, 0x4F, 0x75, 0xF7, 0x5F, 0x74, 0x9F, 0x74, 0x9F, 0x0A, 0xFA, 0x94, 0x9F, 0xFF, 0xA3, 0x9F,
+    0xFF, 0xC9, 0x2A, 0xFE, 0xAF, 0xD2, 0xAF, 0xC4, 0xF2, 0xAF, 0x59, 0xE9, 0x1F, 0xC6, 0xE9, 0x1F,
+    0xC6, 0xEA, 0x1F, 0xC6, 0xEA, 0x1F, 0xC5, 0x9E, 0xA1, 0xFC, 0x59, 0xF1, 0xFC, 0x5A, 0xF1, 0xFC,
+    0x5F, 0xC0, 0x9F, 0xC5, 0xFC, 0x09, 0xFC, 0x5F, 0xC0, 0x9F, 0xC9, 0x39, 0xFC, 0x0A, 0xFC, 0x93,
+    0xAF, 0xC0, 0x19, 0x99, 0x91, 0x9F, 0x1A, 0xF9, 0x0A, 0xFA, 0x0F, 0xCA, 0x0F, 0xD9, 0xFD, 0x77,
+    0x75, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF1, 0x9F, 0x19, 0xF1, 0x9F, 0x19,
+    0xF9, 0x0A, 0xFA, 0x0A, 0xFA, 0x5E, 0x96, 0xEA, 0x59, 0xF5, 0xAF, 0x5A, 0xF7, 0x77, 0x77, 0x77,
+    0x49, 0xEA, 0x59, 0xEA, 0x59, 0xEA, 0x59, 0xE9, 0x5A, 0xE9, 0x5A, 0xE9, 0x5A, 0xE9, 0x5A, 0xE6,
+    0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xF6, 0xF6, 0xF6, 0xEA, 0x6E, 0xA5, 0xAE, 0xA2, 0x91, 0xF9,
+    0x2F, 0xE9, 0x2F, 0xE3, 0xFE, 0x29, 0xFD, 0x93, 0x9A, 0xA9, 0x94, 0x1F, 0x97, 0x4F, 0x75, 0xF7,
+    0x5F, 0x75, 0xF7, 0x5F, 0x74, 0x9F, 0x74, 0x9E, 0xA7, 0x49, 0xEA, 0x74, 0xAE, 0xA1, 0x99, 0x99,
+    0x95, 0xAE, 0x90, 0xAF, 0x95, 0xAE, 0x99, 0xFA, 0x6A, 0xEA, 0xFC, 0x7F, 0xFC, 0x70, 0xFF, 0x71,
+    0xFE, 0x97, 0x1F, 0xE9, 0x71, 0xFF, 0x97, 0x0F, 0xFC, 0xA7, 0xFF, 0xDA, 0x6F, 0xAF, 0xDA, 0x49,
+    0xF9, 0x9F, 0xE3, 0x9F, 0x90, 0xAF, 0xE2, 0x9F, 0xA1, 0xFF, 0x1A, 0xFA, 0x2F, 0xF9, 0x09, 0xF3,
+    0x9E, 0xA3, 0x9E, 0xA3, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xF9, 0x3F, 0x4F, 0x4F, 0x4F, 0x4F,
+    0x4F, 0x4F, 0x4F, 0x39, 0xF3, 0x9F, 0x39, 0xF3, 0x9F, 0x39, 0xF3, 0x9F, 0x39, 0xFE, 0x0A, 0xFE,
+    0x9A, 0xFE, 0xAA, 0xFF, 0x77, 0x75, 0xAE, 0xA0, 0xAE, 0xA9, 0x3A, 0xE9, 0x6A, 0xFF, 0xEA, 0x1F,
+    0xE5, 0xFF, 0xFC, 0xAF, 0xFC, 0x4F, 0xEA, 0xAF, 0xFA, 0xAF, 0xC3, 0xFC, 0xA3, 0xFD, 0x3F, 0x92,
+    0xFC, 0x4A, 0xFA, 0x39, 0xEA, 0x19, 0xFA, 0x49, 0xF9, 0x39, 0xF1, 0x9F, 0xA4, 0x9F, 0x93, 0x9F,
+    0x1A, 0xF9, 0x4A, 0xF4, 0x9F, 0x1A, 0xF9, 0x4F, 0xC4, 0x9F, 0x1F, 0xC9, 0x4F, 0xC4, 0xAF, 0x1F,
+    0xC5, 0xFA, 0x4A, 0xF1, 0xFC, 0x49, 0xFA, 0x4F, 0xC1, 0xFC, 0x4A, 0xF9, 0x4F, 0xC1, 0xFC, 0x4F,
+    0xC9, 0x4F, 0xC9, 0x9F, 0xC4, 0xFC, 0x5F, 0xC9, 0x9F, 0xA4, 0xFC, 0x5F, 0xC9, 0x77, 0x19, 0xE0,
+    0x9A, 0xEA, 0xA4, 0x9F, 0xFF, 0x39, 0xFF, 0xFC, 0x2A, 0xFF, 0xFC, 0x91, 0xAF, 0xA3, 0xAF, 0x1A,
+    0xF5, 0xF1, 0xFA, 0x5F, 0x1F, 0x95, 0xF9, 0x0F, 0x95, 0xF9, 0x0F, 0xA5, 0xF9, 0x0F, 0xA5, 0xFA,
+    0x0F, 0xA5, 0xFA, 0x0F, 0xC4, 0x9F, 0xA9, 0xFC, 0x49, 0xFA, 0x9F, 0xC4, 0xAF, 0xC9, 0xFC, 0x4A,
+    0xFC, 0xAF, 0xC4, 0xAF, 0xC0, 0x49, 0xAF, 0x97, 0x9F, 0xFC, 0x94, 0x9F, 0xFE, 0x93, 0xFD, 0xAA,
+    0xFC, 0x2A, 0xF9, 0x29, 0xFA, 0x1F, 0xA4, 0x9F, 0x1F, 0x6F, 0x99, 0xF6, 0xFA, 0x9F, 0x6A, 0xEA,
+    0xAF, 0x6A, 0xEA, 0x9F, 0x6F, 0xA9, 0xF9, 0x5F, 0xA0, 0xFC, 0x4F, 0xC9, 0x0F, 0xFF, 0xE1, 0xAF,
+    0xFF, 0xCA, 0x2F, 0xFF, 0xC3, 0x9F, 0xFE, 0x94, 0x9F, 0xFC, 0x97, 0x9F, 0xC9, 0x40, 0x70, 0x9A,
+    0xA9, 0x7A, 0xEA, 0x9F, 0xE9, 0x49, 0xFF, 0xFC, 0x93, 0x9F, 0xFF, 0xD3, 0x9F, 0xDA, 0x3E, 0xA3,
+    0xFD, 0x5E, 0x3F, 0xCA, 0x5A, 0xDA, 0x2F, 0xC9, 0x5A, 0xDA, 0x2F, 0xC9, 0x59, 0xE2, 0xFC, 0x95,
+    0x9E, 0x2F, 0xCA, 0x5A, 0xDA, 0x2F, 0xD9, 0x39, 0xEA, 0x2F, 0xFF, 0xE9, 0x19, 0xFF, 0xFE, 0x2A,
+    0xFF, 0xFD, 0x92, 0xAF, 0xFF, 0xD3, 0xFC, 0xAF, 0xEA, 0x4F, 0xC1, 0xAA, 0xCA, 0xA5, 0x9F, 0xA7,
+    0x4A, 0xF9, 0x74, 0xAF, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x49, 0xFC, 0x74, 0xAF, 0xC7, 0x77, 0x70,
+    0x77, 0x70, 0xAF, 0x90, 0x9E, 0xA5, 0x9F, 0xFA, 0xEA, 0x49, 0xFF, 0xFC, 0x94, 0xFA, 0x9A, 0xFE,
+    0x93, 0xAE, 0x4F, 0xD9, 0x3E, 0x94, 0xAF, 0xC3, 0x9E, 0x6F, 0xC3, 0x9E, 0x6F, 0xC3, 0xAE, 0x6F,
+    0xC3, 0xAE, 0x6F, 0xC3, 0x9E, 0x6F, 0xA3, 0x9E, 0xA4, 0xAF, 0xA4, 0xFD, 0xAF, 0xEA, 0x4A, 0xFF,
+    0xFC, 0xA5, 0xFF, 0xFC, 0x95, 0xAF, 0xFF, 0x96, 0xAF, 0xFE, 0x92, 0x94, 0xAF, 0xA9, 0xE9, 0x9A,
+    0xD7, 0x29, 0xFF, 0x72, 0x9F, 0xEA, 0x72, 0x9F, 0xEA, 0x72, 0xAF, 0xEA, 0x72, 0xAF, 0xA9, 0x74,
+    0xAC, 0xA9, 0x77, 0x70, 0x1F, 0x99, 0xAE, 0x2F, 0xFD, 0x2F, 0xFD, 0x91, 0xFF, 0xD9, 0x1F, 0xD9,
+    0x19, 0x2F, 0xC7, 0xF9, 0x7F, 0x97, 0xF9, 0x69, 0xF9, 0x69, 0xF9, 0x6A, 0xF9, 0x6A, 0xFA, 0x6F,
+    0xCA, 0x6F, 0xD6, 0xFD, 0x59, 0xFD, 0x50, 0x77, 0x5A, 0xFD, 0xA9, 0x59, 0xFF, 0xD9, 0x4F, 0xAA,
+    0xAF, 0x5E, 0x94, 0x99, 0x5E, 0x75, 0xEA, 0x74, 0xAF, 0xA9, 0x72, 0xFF, 0xA7, 0x0A, 0xFF, 0xA7,
+    0x0A, 0xFE, 0xA7, 0x29, 0xFC, 0x49, 0x5A, 0xFA, 0x2A, 0xCA, 0x4A, 0xFA, 0x19, 0xFC, 0xAA, 0xAF,
+    0xCA, 0x09, 0xFF, 0xFD, 0x1F, 0xFF, 0xD9, 0x1A, 0xFF, 0xF9, 0x49, 0xAA, 0xFC, 0xA9, 0x77, 0x40,
+    0x7A, 0x97, 0x19, 0xAD, 0x97, 0x1F, 0x97, 0x1F, 0x97, 0x1F, 0x72, 0xF7, 0xFF, 0xEA, 0x1A, 0xFF,
+    0xF1, 0xFF, 0xFC, 0x1A, 0xAA, 0xAF, 0xAA, 0xAA, 0xA4, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F,
+    0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0xAA, 0x9A, 0x94, 0xAF, 0xFA, 0x4A, 0xFF, 0xC4,
+    0xAF, 0xFC, 0x5F, 0xFC, 0x77, 0xAE, 0x96, 0xF0, 0x9E, 0x95, 0x9F, 0x09, 0xE9, 0x59, 0xF0, 0x9E,
+    0xA5, 0x9F, 0x09, 0xEA, 0x59, 0xF1, 0xEA, 0x59, 0xF1, 0xEA, 0x59, 0xF1, 0xF5, 0xAF, 0x1F, 0x5A,
+    0xF1, 0xF5, 0xFC, 0x1F, 0x94, 0xFC, 0x90, 0xFC, 0x92, 0xAF, 0xC9, 0x0A, 0xFF, 0xFD, 0x90, 0x9F,
+    0xFF, 0xD9, 0x1F, 0xFF, 0xD9, 0x1A, 0xFF, 0xFC, 0x92, 0xFF, 0xFC, 0xA3, 0x9A, 0xF9, 0x50, 0x9F,
+    0x71, 0x9F, 0x1F, 0xA7, 0x0F, 0xA1, 0x9F, 0x79, 0xF3, 0xFA, 0x6F, 0xA3, 0xAF, 0x94, 0x9F, 0x5F,
+    0xC4, 0xFC, 0x5A, 0xF9, 0x29, 0xF9, 0x6F, 0xC2, 0xFC, 0x7F, 0xC9, 0x09, 0xF9, 0x79, 0xFC, 0x0A,
+    0xF7, 0x1F, 0xCA, 0xFA, 0x71, 0x9F, 0xFC, 0x73, 0xFF, 0xA7, 0x3A, 0xFE, 0x97, 0x39, 0xFE, 0x97,
+    0x4F, 0xE7, 0x5F, 0xE6, 0x9F, 0x75, 0xFC, 0x0F, 0x97, 0x4F, 0xA0, 0xFA, 0x73, 0x9F, 0x90, 0xAF,
+    0x49, 0x94, 0xAF, 0x19, 0xF9, 0x2A, 0xE3, 0xFA, 0x2F, 0xA1, 0x9F, 0xA1, 0x9F, 0x92, 0xFC, 0x1F,
+    0xD1, 0xAF, 0x3A, 0xF0, 0x9F, 0xDA, 0x0F, 0xC3, 0x9F, 0xAF, 0xFA, 0xFA, 0x4F, 0xFF, 0xFD, 0x94,
+    0xFF, 0xFF, 0xD5, 0xAF, 0xFF, 0xFC, 0x59, 0xFF, 0xFF, 0xA6, 0xFF, 0xAF, 0xE9, 0x6F, 0xE9, 0x0F,
+    0xE7, 0xAF, 0xD1, 0x9F, 0xD7, 0x0F, 0xC3, 0xFC, 0xA7, 0x0A, 0xAA, 0xA9, 0x39, 0xAA, 0xAA, 0x40,
+    0x2F, 0xC5, 0xFC, 0x49, 0xFA, 0x3A, 0xF6, 0xAF, 0x91, 0xAF, 0x97, 0xFC, 0x0A, 0xFA, 0x70, 0x9F,
+    0xFC, 0xA7, 0x2A, 0xFF, 0x74, 0xFE, 0x75, 0x9F, 0xCA, 0x75, 0xFE, 0x74, 0xFF, 0xC7, 0x2A, 0xFF,
+    0xCA, 0x70, 0xAF, 0xCA, 0xFC, 0xA6, 0x9F, 0xC9, 0x0A, 0xFC, 0x94, 0x9F, 0xCA, 0x2F, 0xD3, 0x9F,
+    0xD4, 0xFD, 0x2F, 0xD5, 0x9F, 0xCA, 0x00, 0x9F, 0x97, 0xF9, 0x0F, 0xC6, 0x9F, 0x19, 0xFA, 0x5A,
+    0xEA, 0x2F, 0xC5, 0xF9, 0x3F, 0xC3, 0x9F, 0x4A, 0xF9, 0x2A, 0xEA, 0x5F, 0xC2, 0xF9, 0x5A, 0xFA,
+    0x09, 0xF7, 0xFC, 0x0A, 0xEA, 0x7A, 0xFF, 0xC9, 0x70, 0xFF, 0xC7, 0x1A, 0xFE, 0xA7, 0x2F, 0xE9,
+    0x72, 0xAF, 0xD7, 0x4F, 0xCA, 0x74, 0xAF, 0x97, 0x4A, 0xF7, 0x49, 0xFA, 0x73, 0xAF, 0xC9, 0x7F,
+    0xFD, 0x70, 0xFF, 0xC9, 0x70, 0xFF, 0xA7, 0x1F, 0xEA, 0x72, 0xFC, 0xA7, 0x77, 0x50, 0x2F, 0xFF,
+    0xCA, 0x3F, 0xFF, 0xD3, 0xFF, 0xFD, 0x39, 0xAA, 0xAA, 0xAA, 0xAF, 0xCA, 0x72, 0xFC, 0xA7, 0x2F,
+    0xCA, 0x72, 0xFD, 0x72, 0xFD, 0x72, 0xFD, 0x71, 0x9F, 0xD7, 0x19, 0xFD, 0x71, 0x9F, 0xD7, 0x19,
+    0xFD, 0x99, 0x99, 0x99, 0x93, 0xFF, 0xFD, 0x92, 0xFF, 0xFE, 0x2F, 0xFF, 0xE9, 0x09, 0xFF, 0xFF,
+    0x00, 0x79, 0x9A, 0xAA, 0xA6, 0xAF, 0xE5, 0xAF, 0xEA, 0x49, 0xFF, 0x94, 0xAF, 0xA7, 0x0A, 0xF7,
+    0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x09, 0xFA, 0x59, 0xFE, 0x95, 0xAF,
+    0xE6, 0xAF, 0xD7, 0xAF, 0xDA, 0x69, 0xFE, 0x71, 0xAF, 0x97, 0x09, 0xF9, 0x70, 0x9F, 0x97, 0x09,
+    0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF7, 0x1A, 0xF9, 0x70, 0xAF, 0xCA, 0xA9, 0x59, 0xFF, 0x95, 0xFF,
+    0x95, 0x9F, 0xE9, 0x7A, 0xFC, 0x97, 0x70, 0x19, 0x99, 0x0A, 0xE0, 0xAE, 0x0F, 0x0F, 0x0F, 0x0E,
+    0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0x90, 0xE9, 0x0E, 0x90,
+    0xE9, 0x0E, 0x99, 0xE9, 0x9E, 0x99, 0xE9, 0x9E, 0x09, 0xE0, 0x9E, 0x09, 0xE0, 0x9E, 0x00, 0x9A,
+    0xAA, 0xA9, 0x79, 0xFE, 0x6F, 0xF5, 0xFF, 0xA7, 0x9F, 0xC7, 0x0F, 0xC7, 0x0A, 0xF7, 0x0A, 0xF7,
+    0x0A, 0xF7, 0x0A, 0xF7, 0x09, 0xF9, 0x79, 0xFA, 0x70, 0xFE, 0xA5, 0xAF, 0xE6, 0xAF, 0xD5, 0x9F,
+    0xE5, 0xFE, 0xA5, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC,
+    0x49, 0xAA, 0xFD, 0x4F, 0xFA, 0x4F, 0xF9, 0x4F, 0xEA, 0x5F, 0xCA, 0x97, 0x72, 0x1A, 0xD9, 0x1A,
+    0xD1, 0xAF, 0x90, 0xAD, 0x1F, 0xD9, 0xAD, 0x09, 0xD9, 0x9F, 0xD0, 0x9D, 0x90, 0xAF, 0x91, 0xDA,
+    0x19, 0xD9, 0x10, 0x9F, 0xE9, 0x9F, 0xE1, 0xFE, 0x1F, 0xE1, 0xAF, 0xD1, 0xAF, 0xCA, 0x19, 0xFC,
+    0xA2, 0xFC, 0x97, 0x77, 0x77, 0x77, 0x49, 0x6A, 0xC5, 0xE3, 0x9F, 0x3F, 0xC3, 0xAF, 0x3A, 0xF3,
+    0x9F, 0x39, 0xF3, 0x9F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4A, 0xE9, 0x3A, 0xE9, 0x39, 0xE9,
+    0x39, 0xE4, 0x9D, 0x6C, 0x74, 0x6A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x19,
+    0xAF, 0xA9, 0x49, 0xFF, 0xA3, 0x9F, 0xFC, 0xA3, 0xFF, 0xDA, 0x2A, 0xF0, 0xDA, 0x5F, 0x90, 0xDA,
+    0x5F, 0x1D, 0xA4, 0x9F, 0x1D, 0xA4, 0x9F, 0x1D, 0xA4, 0x9F, 0x1D, 0xA4, 0x9F, 0x90, 0xDA, 0x5F,
+    0xA0, 0xDA, 0x5F, 0xCA, 0xDA, 0xA9, 0x39, 0xFF, 0xD9, 0x3F, 0xFE, 0x93, 0xAF, 0xFD, 0x49, 0xAF,
+    0xCA, 0x97, 0x0D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x39, 0x95, 0x77, 0x77, 0x72, 0x9F,
+    0xDA, 0x71, 0xFF, 0xD9, 0x6F, 0xFF, 0xA4, 0xAF, 0x91, 0x9A, 0xF9, 0x3F, 0x6A, 0x95, 0xAD, 0xA7,
+    0x6A, 0xE7, 0x7E, 0x77, 0xEA, 0x76, 0xAE, 0x76, 0x9E, 0x97, 0x2F, 0xFF, 0xE3, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xE7, 0x0F, 0x76, 0xF7, 0x6F, 0x75, 0xAF, 0x73, 0x9F, 0xD7, 0x19, 0xFE, 0xA9, 0x70, 0x9F,
+    0xFF, 0xCA, 0xA2, 0x9F, 0xFF, 0xEA, 0x19, 0xFF, 0xFF, 0x90, 0x9F, 0xFF, 0xFC, 0x00, 0x77, 0x59,
+    0x69, 0xC6, 0xD9, 0x49, 0xE4, 0xFA, 0xFF, 0xC2, 0xFF, 0xFE, 0x91, 0x9F, 0xFF, 0xCA, 0x39, 0xFC,
+    0xAF, 0xD4, 0x9F, 0x2A, 0xF4, 0xAE, 0xA3, 0xF4, 0xFA, 0x3F, 0x93, 0xAF, 0x91, 0xFC, 0x49, 0xFF,
+    0xF4, 0xFF, 0xFC, 0xA2, 0xFF, 0xFE, 0xA0, 0x9F, 0xFF, 0xF1, 0xAE, 0xAA, 0xFA, 0xF3, 0xAC, 0xA7,
+    0xD5, 0x97, 0x50, 0x09, 0x99, 0x99, 0x72, 0x99, 0x99, 0x1A, 0xFA, 0x79, 0xFC, 0x2F, 0xC9, 0x6F,
+    0xC4, 0xFC, 0x94, 0xFC, 0x94, 0x9F, 0xC9, 0x2F, 0xCA, 0x6F, 0xD9, 0x0F, 0xD7, 0x0F, 0xFF, 0x71,
+    0x9F, 0xFD, 0x97, 0x2A, 0xFF, 0xA7, 0x4F, 0xF7, 0x6F, 0xD7, 0x7A, 0xFF, 0x70, 0xAF, 0xFF, 0x97,
+    0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0xD6, 0xAA, 0xAA, 0xAF, 0xCA, 0x77, 0xFC, 0xA7, 0x7F, 0xCA, 0x73,
+    0x9A, 0xAA, 0xFF, 0xC7, 0x0F, 0xFF, 0xC9, 0x69, 0xFF, 0xFD, 0x6F, 0xFF, 0xE7, 0x3F, 0xC9, 0x77,
+    0xFC, 0x97, 0x7F, 0xC9, 0x77, 0xAA, 0xAA, 0xA7, 0x00, 0x09, 0xAC, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0D, 0xA0, 0xDA, 0x9D, 0xA0, 0x97, 0x72, 0x9C, 0xAA, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9,
+    0xAD, 0x9A, 0xD9, 0xAD, 0x0A, 0xD0, 0xE0, 0x92, 0x5A, 0xFA, 0x79, 0xFF, 0x95, 0xFF, 0xD9, 0x3A,
+    0xE9, 0x90, 0x9E, 0x93, 0xAD, 0x94, 0xD4, 0xEA, 0x49, 0x94, 0xAF, 0xA9, 0x71, 0xFF, 0x96, 0xFF,
+    0xD4, 0xFF, 0xEA, 0x2A, 0xF9, 0x99, 0xAF, 0x2F, 0x4A, 0xE9, 0x1E, 0xA4, 0xAE, 0x91, 0xFE, 0xAF,
+    0xC9, 0x1A, 0xFF, 0xF3, 0xFF, 0xEA, 0x39, 0xFF, 0xD6, 0xAF, 0xF7, 0x19, 0xFD, 0x72, 0x9F, 0x3A,
+    0x95, 0xAE, 0x91, 0xAE, 0x92, 0x9F, 0x19, 0xFF, 0xFA, 0x1F, 0xFF, 0xC2, 0x9F, 0xFD, 0x97, 0x99,
+    0x97, 0x09, 0xF2, 0x9F, 0x1A, 0xF9, 0x1A, 0xF9, 0x0A, 0xF9, 0x1A, 0xF9, 0x0F, 0xCA, 0x1F, 0xCA,
+    0x0F, 0xCA, 0x1F, 0xCA, 0x0F, 0xD0, 0x9F, 0xD0, 0x99, 0x99, 0x99, 0x19, 0x99, 0x99, 0x90, 0x3A,
+    0xEA, 0x96, 0xFE, 0xA4, 0xFA, 0xAE, 0xA2, 0xAD, 0x93, 0xE9, 0x1D, 0xA0, 0xE9, 0x0E, 0x09, 0xD0,
+    0xD3, 0xAD, 0x09, 0xD0, 0xCA, 0x39, 0xD0, 0x9D, 0x9D, 0x99, 0x1A, 0xD1, 0xE0, 0xAD, 0xA9, 0xDA,
+    0x1A, 0xE9, 0x19, 0xE3, 0xFF, 0xC9, 0x4A, 0xFD, 0x97, 0x9A, 0x95, 0x74, 0xEA, 0xC9, 0x2F, 0xD9,
+    0x1A, 0xC9, 0x1D, 0xA1, 0xD2, 0xAC, 0xA1, 0xCA, 0x29, 0xD1, 0xCA, 0x29, 0xD1, 0xFF, 0x19, 0xFE,
+    0x29, 0xE9, 0xAA, 0x00, 0x79, 0x59, 0x6A, 0xC3, 0x9C, 0x95, 0xE2, 0x9D, 0x94, 0xF1, 0xAE, 0x92,
+    0x9F, 0x90, 0xAF, 0x29, 0xF9, 0x0F, 0xC2, 0xAF, 0x1F, 0xA2, 0x9F, 0x1F, 0x93, 0xAF, 0x90, 0xFC,
+    0x39, 0xFC, 0x9A, 0xFC, 0x4F, 0xC9, 0xAF, 0xC4, 0xFC, 0x9A, 0xFC, 0x4F, 0x90, 0xAF, 0x5E, 0x2A,
+    0xDA, 0x6D, 0x3A, 0xC9, 0x7A, 0x49, 0x10, 0x9E, 0xAA, 0xA9, 0x99, 0x59, 0xFF, 0xFD, 0x09, 0xFF,
+    0xFD, 0x09, 0xFF, 0xFD, 0x19, 0x99, 0x99, 0x9A, 0xAA, 0xFC, 0x72, 0x9F, 0x72, 0x9F, 0x72, 0x9F,
+    0x72, 0x9F, 0x72, 0x9F, 0x97, 0x70, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF,
+    0xD0, 0xAF, 0xFF, 0xD0, 0xAF, 0xFF, 0xD0, 0x3A, 0xEA, 0x96, 0xFE, 0xA4, 0xFA, 0xAE, 0xA2, 0xAF,
+    0xD9, 0xAD, 0x91, 0xDA, 0x9A, 0x09, 0xC0, 0xDA, 0x09, 0xD9, 0x9A, 0x09, 0xC0, 0xAD, 0x09, 0xD0,
+    0xAE, 0x90, 0x9D, 0x09, 0xD0, 0xAC, 0xAC, 0xA0, 0xAD, 0x1D, 0xAA, 0xC0, 0xAC, 0x0D, 0xA1, 0xAF,
+    0x0A, 0xF9, 0x2F, 0xAF, 0xA3, 0x9F, 0xEA, 0x6A, 0xAD, 0xA9, 0x30, 0x76, 0xAA, 0xAA, 0xAF, 0xA1,
+    0xFF, 0xE0, 0x9F, 0xFE, 0x97, 0x40, 0x59, 0x97, 0x09, 0xFD, 0x5A, 0xFF, 0x92, 0x9F, 0xFD, 0x2F,
+    0xA1, 0xAE, 0xA0, 0x9F, 0x3F, 0x09, 0xEA, 0x3F, 0x09, 0xF3, 0xF1, 0xFC, 0xAA, 0xFA, 0x1F, 0xFE,
+    0x92, 0xFF, 0xCA, 0x39, 0xFE, 0xA6, 0xAA, 0xDA, 0x93, 0x59, 0xAA, 0xA9, 0x72, 0xAE, 0x97, 0x2A,
+    0xE9, 0x72, 0xAE, 0x97, 0x2A, 0xE9, 0x49, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA5,
+    0xAE, 0x97, 0x2A, 0xE9, 0x72, 0xAE, 0x97, 0x2A, 0xE9, 0x73, 0x99, 0x97, 0x59, 0x99, 0x99, 0xA2,
+    0x9F, 0xFF, 0x91, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x77, 0x00, 0x09, 0xAC, 0xA2, 0xAF, 0xC9, 0x0A,
+    0xA1, 0xAC, 0xA5, 0xD4, 0x9D, 0x39, 0xD9, 0x2A, 0xDA, 0x2F, 0x2A, 0xFD, 0x0A, 0xFD, 0x70, 0x09,
+    0x9A, 0xA9, 0x2F, 0xCA, 0x19, 0x2A, 0xC5, 0xAC, 0x91, 0xAE, 0xA2, 0xFA, 0x49, 0xD9, 0x09, 0x2A,
+    0xCA, 0x0F, 0xD9, 0xAF, 0xD0, 0x9F, 0xC9, 0x00, 0x71, 0xE2, 0xAD, 0xA2, 0xE9, 0x1A, 0xE2, 0xEA,
+    0x1A, 0xE9, 0x10, 0x0F, 0x7F, 0x1F, 0x95, 0x9F, 0x1F, 0x95, 0x9F, 0x1F, 0xA5, 0x9F, 0x1F, 0xA5,
+    0x9F, 0x1F, 0xA5, 0x9F, 0x09, 0xFA, 0x59, 0xF0, 0x9F, 0xC5, 0xAF, 0x09, 0xFC, 0x5A, 0xF0, 0x9F,
+    0xC5, 0xFC, 0x09, 0xFC, 0x94, 0xFC, 0x99, 0xFD, 0x92, 0xAF, 0xC9, 0x9F, 0xFF, 0xF9, 0xAF, 0xFF,
+    0xF9, 0xAF, 0xFF, 0xF9, 0xAF, 0xFF, 0xF9, 0xAF, 0xFF, 0xFA, 0xAE, 0x09, 0xAF, 0x95, 0xAE, 0x75,
+    0xF7, 0x5F, 0x77, 0x77, 0x3A, 0xFC, 0x1F, 0x3F, 0xE1, 0xF2, 0xFF, 0x1F, 0x1A, 0xFF, 0x1F, 0x1F,
+    0xFC, 0x1F, 0x1F, 0xFC, 0x1F, 0x1F, 0xFA, 0x1F, 0x1A, 0xFE, 0xA1, 0xF1, 0x9F, 0xEA, 0x1F, 0x2A,
+    0xFD, 0xA1, 0xF3, 0x9F, 0xC9, 0x1A, 0xE4, 0xFC, 0x91, 0xAE, 0x4F, 0xC9, 0x1A, 0xE4, 0xFC, 0x2A,
+    0xE3, 0x9F, 0xC2, 0xAE, 0x3A, 0xFC, 0x2A, 0xE3, 0xFD, 0x2A, 0xE3, 0xFD, 0x2A, 0xE3, 0xFD, 0x2A,
+    0xE2, 0x9F, 0xD2, 0xAE, 0x91, 0xAF, 0xCA, 0x2A, 0xE9, 0x1F, 0xDA, 0x2A, 0xE9, 0x1F, 0xDA, 0x2A,
+    0xE9, 0x1F, 0xDA, 0x29, 0xE9, 0x09, 0xFD, 0x92, 0x9E, 0x90, 0x09, 0xF1, 0xAF, 0x90, 0xAF, 0x90,
+    0xFC, 0xA0, 0xFC, 0xA0, 0xFD, 0x09, 0x99, 0x99, 0x90, 0x1D, 0x93, 0x9D, 0x4E, 0x4F, 0xC1, 0x9F,
+    0xCA, 0x19, 0x1E, 0x1F, 0xD0, 0x9F, 0xC9, 0x0A, 0xF9, 0x10, 0x79, 0xD9, 0x2E, 0x91, 0x9A, 0xAC,
+    0x93, 0xAC, 0x93, 0xAC, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x1F, 0xDA, 0xFD, 0xA9, 0x99, 0x99, 0x90,
+    0x2A, 0xE9, 0x3F, 0xD9, 0x1A, 0xCA, 0x19, 0xD1, 0xD9, 0x2D, 0x1D, 0x92, 0xD9, 0x0D, 0xA1, 0x9D,
+    0x1A, 0xFE, 0x2F, 0xD9, 0x3A, 0xE9, 0x73, 0x97, 0x6A, 0xA4, 0xC9, 0x6A, 0xD3, 0xDA, 0x5A, 0xE9,
+    0x1E, 0xA4, 0x9F, 0x90, 0xFC, 0x49, 0xFA, 0x0A, 0xF5, 0xFA, 0x09, 0xF9, 0x4F, 0x90, 0x9F, 0x39,
+    0xFC, 0x0A, 0xF9, 0x19, 0xFC, 0x9A, 0xFC, 0x19, 0xFC, 0x9F, 0xD1, 0x9F, 0xC9, 0xAF, 0xA3, 0xF9,
+    0x0A, 0xEA, 0x4E, 0x29, 0xDA, 0x5D, 0x39, 0xCA, 0x69, 0x5A, 0x60, 0x39, 0x99, 0x77, 0x59, 0xF7,
+    0x75, 0xFC, 0x73, 0x9E, 0x94, 0xFC, 0x73, 0xEA, 0x49, 0xA0, 0xE7, 0x2A, 0xE7, 0x0E, 0x72, 0xEA,
+    0x70, 0xE7, 0x1F, 0x71, 0xE7, 0x09, 0xE9, 0x71, 0xE7, 0x0F, 0x72, 0xE7, 0xAE, 0x97, 0x19, 0xE6,
+    0x9F, 0x72, 0x9E, 0x6F, 0x39, 0x93, 0xFF, 0xC2, 0xAE, 0xA2, 0xAD, 0x92, 0xFF, 0xC2, 0xF2, 0x9E,
+    0x92, 0xFF, 0xC1, 0xAE, 0xA2, 0xF9, 0x74, 0x9F, 0x2A, 0xFA, 0x74, 0xF9, 0x19, 0xD9, 0xDA, 0x73,
+    0xAF, 0x2D, 0x90, 0xDA, 0x73, 0xF2, 0xDA, 0x09, 0xDA, 0x72, 0xFA, 0x1A, 0xD1, 0x9E, 0x97, 0x09,
+    0xF1, 0x9F, 0xFD, 0xA7, 0xFA, 0x1A, 0xFF, 0xDA, 0x6A, 0xF3, 0x99, 0x9A, 0xAF, 0xA9, 0x59, 0xF9,
+    0x70, 0xAE, 0x7F, 0xC7, 0x1A, 0xE6, 0x9F, 0x97, 0x1A, 0xE6, 0xAE, 0xA7, 0x70, 0x39, 0x99, 0x77,
+    0x70, 0x9F, 0x77, 0x70, 0xFC, 0x74, 0xAA, 0xA9, 0x7F, 0xC7, 0x3F, 0x79, 0xA0, 0xE7, 0x29, 0xE9,
+    0x72, 0xE7, 0x2F, 0x73, 0xE7, 0x1A, 0xE7, 0x4E, 0x70, 0x9E, 0xA7, 0x4E, 0x70, 0xF7, 0x5E, 0x7A,
+    0xE9, 0x74, 0x9E, 0x7F, 0x75, 0x9E, 0x6A, 0xE9, 0x19, 0x9A, 0xA9, 0x4F, 0xFC, 0x29, 0xF0, 0x9F,
+    0xE9, 0x2F, 0xFC, 0x2F, 0x1A, 0xFF, 0x91, 0xFF, 0xC1, 0xAE, 0xA1, 0xAC, 0xA9, 0x1A, 0xE1, 0x99,
+    0x99, 0x99, 0x99, 0x91, 0xF2, 0x95, 0xE7, 0x3F, 0x97, 0x1E, 0x72, 0x9F, 0x72, 0xE7, 0x2F, 0x97,
+    0x1F, 0x71, 0xAF, 0x71, 0xF9, 0x70, 0x9F, 0x70, 0x9F, 0xA7, 0x1F, 0xA7, 0xAF, 0xC7, 0x1A, 0xF7,
+    0xFD, 0x72, 0xF9, 0x69, 0xFF, 0xC9, 0x5F, 0xC7, 0xAF, 0xFC, 0x94, 0x9F, 0x97, 0xFF, 0xDA, 0x4F,
+    0xA7, 0x09, 0x99, 0x99, 0x99, 0x99, 0x90, 0x19, 0xAF, 0x97, 0x73, 0xFF, 0x77, 0x19, 0xCA, 0x99,
+    0x9A, 0xDA, 0x79, 0xE7, 0x39, 0xD7, 0xEA, 0x73, 0x9D, 0x6F, 0x74, 0xE5, 0x9E, 0x97, 0x9F, 0xD6,
+    0xF7, 0x0A, 0xFD, 0x94, 0xAE, 0x97, 0x09, 0xAA, 0xAF, 0x39, 0xEA, 0x76, 0xE9, 0x2F, 0x71, 0x99,
+    0x3E, 0x91, 0xAE, 0xA7, 0x1F, 0xFC, 0x91, 0xF2, 0x9D, 0x92, 0x9F, 0xFC, 0x1F, 0x92, 0xE9, 0x2F,
+    0xFC, 0x90, 0x9E, 0xA2, 0xF9, 0x29, 0xAF, 0xCA, 0x91, 0xF2, 0xAF, 0x97, 0x4A, 0xEA, 0x19, 0xD9,
+    0xDA, 0x73, 0x9F, 0x2D, 0x90, 0xDA, 0x73, 0xF9, 0x1D, 0xA0, 0x9D, 0xA7, 0x2A, 0xF1, 0xAD, 0x19,
+    0xDA, 0x71, 0x9F, 0x19, 0xFF, 0xDA, 0x7F, 0xA1, 0xAF, 0xFD, 0xA6, 0xAF, 0x29, 0xAA, 0xAA, 0xAF,
+    0xC9, 0x6F, 0x97, 0x0A, 0xE7, 0xFC, 0x71, 0xAE, 0x69, 0xF9, 0x71, 0xAE, 0x6A, 0xEA, 0x77, 0x00,
+    0x5F, 0xD9, 0x72, 0xAF, 0xC7, 0x3A, 0xFC, 0x73, 0x9F, 0xC7, 0x39, 0xFA, 0x74, 0xF9, 0x74, 0x99,
+    0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xCA, 0x73, 0x9A, 0xEA, 0x72, 0x9F, 0xC9, 0x72, 0x9F,
+    0xC9, 0x72, 0x9F, 0xC7, 0x39, 0xFC, 0x73, 0xAF, 0xC7, 0x2F, 0xE7, 0x1F, 0xF7, 0x0F, 0xE9, 0x70,
+    0xAF, 0xC9, 0x72, 0xFC, 0x73, 0x9F, 0x74, 0xAF, 0x74, 0xFA, 0x74, 0xFA, 0x74, 0xAE, 0xA7, 0x4A,
+    0xEA, 0x74, 0x9F, 0x70, 0xC3, 0xF9, 0x59, 0xE2, 0xAF, 0xA2, 0x9F, 0xCA, 0x2F, 0xFF, 0xDA, 0x3F,
+    0xFF, 0x95, 0xAF, 0xFA, 0x71, 0x9A, 0xAA, 0xA9, 0x77, 0x70, 0x5F, 0xA7, 0x74, 0xFC, 0x77, 0x4F,
+    0xC9, 0x77, 0x3F, 0xC9, 0x77, 0x3F, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xF9, 0x77, 0x29,
+    0xFC, 0x77, 0x2F, 0xD7, 0x72, 0xFD, 0xA7, 0x70, 0xAF, 0xE7, 0x70, 0xFF, 0x97, 0x69, 0xFA, 0xF7,
+    0x6F, 0xA0, 0xF7, 0x6F, 0x90, 0xFA, 0x74, 0xAF, 0x1A, 0xF7, 0x4F, 0xA1, 0x9F, 0x97, 0x29, 0xF9,
+    0x2F, 0xC7, 0x2F, 0xC3, 0xAF, 0x72, 0xFC, 0x39, 0xFA, 0x70, 0xAF, 0x94, 0xFC, 0x70, 0xFC, 0xA9,
+    0x99, 0x99, 0xFC, 0x96, 0x9F, 0xFF, 0xFA, 0x6A, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0xDA, 0x4A, 0xFF,
+    0xFF, 0xE4, 0xFF, 0xFF, 0xF9, 0x29, 0xFC, 0xA7, 0x0F, 0xCA, 0x2A, 0xFC, 0x71, 0xFD, 0x2F, 0xD7,
+    0x1A, 0xFC, 0x90, 0x9F, 0xCA, 0x71, 0x9F, 0xD0, 0x73, 0xAD, 0xA7, 0x74, 0xE7, 0x74, 0xAE, 0x77,
+    0x4E, 0xA7, 0x73, 0xAE, 0x97, 0x73, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x73, 0xF9, 0x77, 0x29, 0xFC, 0x77, 0x2F, 0xD7, 0x72, 0xFD, 0xA7, 0x70, 0xAF, 0xE7,
+    0x70, 0xFF, 0x97, 0x69, 0xFA, 0xF7, 0x6F, 0xA0, 0xF7, 0x6F, 0x90, 0xFA, 0x74, 0xAF, 0x1A, 0xF7,
+    0x4F, 0xA1, 0x9F, 0x97, 0x29, 0xF9, 0x2F, 0xC7, 0x2F, 0xC3, 0xAF, 0x72, 0xFC, 0x39, 0xFA, 0x70,
+    0xAF, 0x94, 0xFC, 0x70, 0xFC, 0xA9, 0x99, 0x99, 0xFC, 0x96, 0x9F, 0xFF, 0xFA, 0x6A, 0xFF, 0xFF,
+    0xC6, 0xFF, 0xFF, 0xDA, 0x4A, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xF9, 0x29, 0xFC, 0xA7, 0x0F, 0xCA,
+    0x2A, 0xFC, 0x71, 0xFD, 0x2F, 0xD7, 0x1A, 0xFC, 0x90, 0x9F, 0xCA, 0x71, 0x9F, 0xD0, 0x72, 0xAD,
+    0x97, 0x74, 0xF7, 0x73, 0xFC, 0xA7, 0x71, 0xFE, 0xA7, 0x7F, 0xFC, 0xA7, 0x5F, 0x91, 0xAE, 0xA7,
+    0x3F, 0x49, 0xEA, 0x72, 0x99, 0x97, 0x99, 0x97, 0x77, 0x77, 0x77, 0x70, 0xF9, 0x77, 0x29, 0xFC,
+    0x77, 0x2F, 0xD7, 0x72, 0xFD, 0xA7, 0x70, 0xAF, 0xE7, 0x70, 0xFF, 0x97, 0x69, 0xFA, 0xF7, 0x6F,
+    0xA0, 0xF7, 0x6F, 0x90, 0xFA, 0x74, 0xAF, 0x1A, 0xF7, 0x4F, 0xA1, 0x9F, 0x97, 0x29, 0xF9, 0x2F,
+    0xC7, 0x2F, 0xC3, 0xAF, 0x72, 0xFC, 0x39, 0xFA, 0x70, 0xAF, 0x94, 0xFC, 0x70, 0xFC, 0xA9, 0x99,
+    0x99, 0xFC, 0x96, 0x9F, 0xFF, 0xFA, 0x6A, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0xDA, 0x4A, 0xFF, 0xFF,
+    0xE4, 0xFF, 0xFF, 0xF9, 0x29, 0xFC, 0xA7, 0x0F, 0xCA, 0x2A, 0xFC, 0x71, 0xFD, 0x2F, 0xD7, 0x1A,
+    0xFC, 0x90, 0x9F, 0xCA, 0x71, 0x9F, 0xD0, 0x79, 0xAC, 0x91, 0x9D, 0x76, 0x9F, 0xA1, 0xD9, 0x75,
+    0xAF, 0xCA, 0x9D, 0x97, 0x5E, 0x0F, 0xD7, 0x6E, 0x09, 0xFC, 0x76, 0xE1, 0x9E, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x75, 0xF9, 0x77, 0x29, 0xFC, 0x77, 0x2F, 0xD7, 0x72, 0xFD, 0xA7, 0x70, 0xAF, 0xE7,
+    0x70, 0xFF, 0x97, 0x69, 0xFA, 0xF7, 0x6F, 0xA0, 0xF7, 0x6F, 0x90, 0xFA, 0x74, 0xAF, 0x1A, 0xF7,
+    0x4F, 0xA1, 0x9F, 0x97, 0x29, 0xF9, 0x2F, 0xC7, 0x2F, 0xC3, 0xAF, 0x72, 0xFC, 0x39, 0xFA, 0x70,
+    0xAF, 0x94, 0xFC, 0x70, 0xFC, 0xA9, 0x99, 0x99, 0xFC, 0x96, 0x9F, 0xFF, 0xFA, 0x6A, 0xFF, 0xFF,
+    0xC6, 0xFF, 0xFF, 0xDA, 0x4A, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xF9, 0x29, 0xFC, 0xA7, 0x0F, 0xCA,
+    0x2A, 0xFC, 0x71, 0xFD, 0x2F, 0xD7, 0x1A, 0xFC, 0x90, 0x9F, 0xCA, 0x71, 0x9F, 0xD0, 0x5F, 0xA2,
+    0xFA, 0x73, 0xFC, 0x2F, 0xC7, 0x3F, 0xC2, 0xFC, 0x72, 0x9F, 0xC1, 0x9F, 0xC7, 0x2A, 0xFC, 0x90,
+    0xAF, 0xC7, 0x2A, 0xFC, 0x90, 0xFD, 0x97, 0x19, 0x99, 0x99, 0x91, 0x99, 0x99, 0x99, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x72, 0xF9, 0x77, 0x29, 0xFC, 0x77, 0x2F, 0xD7, 0x72, 0xFD, 0xA7, 0x70, 0xAF,
+    0xE7, 0x70, 0xFF, 0x97, 0x69, 0xFA, 0xF7, 0x6F, 0xA0, 0xF7, 0x6F, 0x90, 0xFA, 0x74, 0xAF, 0x1A,
+    0xF7, 0x4F, 0xA1, 0x9F, 0x97, 0x29, 0xF9, 0x2F, 0xC7, 0x2F, 0xC3, 0xAF, 0x72, 0xFC, 0x39, 0xFA,
+    0x70, 0xAF, 0x94, 0xFC, 0x70, 0xFC, 0xA9, 0x99, 0x99, 0xFC, 0x96, 0x9F, 0xFF, 0xFA, 0x6A, 0xFF,
+    0xFF, 0xC6, 0xFF, 0xFF, 0xDA, 0x4A, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xF9, 0x29, 0xFC, 0xA7, 0x0F,
+    0xCA, 0x2A, 0xFC, 0x71, 0xFD, 0x2F, 0xD7, 0x1A, 0xFC, 0x90, 0x9F, 0xCA, 0x71, 0x9F, 0xD0, 0x71,
+    0x9D, 0xA7, 0x73, 0x9F, 0xC7, 0x72, 0xEA, 0xDA, 0x77, 0x1D, 0xA9, 0xDA, 0x77, 0x1F, 0xD9, 0x77,
+    0x19, 0xFC, 0x77, 0x39, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xF9, 0x77, 0x29, 0xFC, 0x77,
+    0x2F, 0xD7, 0x72, 0xFD, 0xA7, 0x70, 0xAF, 0xE7, 0x70, 0xFF, 0x97, 0x69, 0xFA, 0xF7, 0x6F, 0xA0,
+    0xF7, 0x6F, 0x90, 0xFA, 0x74, 0xAF, 0x1A, 0xF7, 0x4F, 0xA1, 0x9F, 0x97, 0x29, 0xF9, 0x2F, 0xC7,
+    0x2F, 0xC3, 0xAF, 0x72, 0xFC, 0x39, 0xFA, 0x70, 0xAF, 0x94, 0xFC, 0x70, 0xFC, 0xA9, 0x99, 0x99,
+    0xFC, 0x96, 0x9F, 0xFF, 0xFA, 0x6A, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0xDA, 0x4A, 0xFF, 0xFF, 0xE4,
+    0xFF, 0xFF, 0xF9, 0x29, 0xFC, 0xA7, 0x0F, 0xCA, 0x2A, 0xFC, 0x71, 0xFD, 0x2F, 0xD7, 0x1A, 0xFC,
+    0x90, 0x9F, 0xCA, 0x71, 0x9F, 0xD0, 0x75, 0x99, 0x99, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xFE, 0x75,
+    0xAF, 0x0F, 0xFF, 0xEA, 0x74, 0x9F, 0xC9, 0xFF, 0xFE, 0x97, 0x4F, 0xDA, 0xFF, 0xFE, 0x74, 0x9F,
+    0xFF, 0xAA, 0x99, 0x99, 0x77, 0x0F, 0xFF, 0xA7, 0x75, 0x9F, 0xFF, 0xA7, 0x75, 0xF9, 0xFF, 0xA7,
+    0x74, 0xAF, 0x0A, 0xFE, 0xA7, 0x74, 0xF9, 0x0A, 0xFE, 0xA9, 0x99, 0x99, 0x9A, 0x74, 0xAF, 0x19,
+    0xFF, 0xFE, 0x97, 0x3F, 0x92, 0xFF, 0xFE, 0x97, 0x2F, 0xC3, 0xFF, 0xFE, 0x97, 0x19, 0xFA, 0x3F,
+    0xFF, 0xE9, 0x71, 0xFC, 0x4A, 0xFD, 0xA7, 0x70, 0x9F, 0xA4, 0x9F, 0xDA, 0x77, 0x0F, 0xFF, 0xFD,
+    0xA7, 0x7A, 0xFF, 0xFF, 0xDA, 0x77, 0xFF, 0xFF, 0xF9, 0x99, 0x99, 0x99, 0x99, 0x94, 0xAF, 0xFF,
+    0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xFE, 0x92, 0xAF, 0xC9, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xFF,
+    0xCA, 0x19, 0xFC, 0xA7, 0x0A, 0xFF, 0xFF, 0xC1, 0xFD, 0x71, 0x9F, 0xFF, 0xFC, 0x09, 0xFC, 0xA7,
+    0x19, 0xFF, 0xFF, 0xC9, 0x77, 0x77, 0x30, 0x77, 0x77, 0x9A, 0xFD, 0xAA, 0x97, 0x09, 0xFF, 0xF7,
+    0xFF, 0xFD, 0x6F, 0xFF, 0xDA, 0x5F, 0xFF, 0xE9, 0x4A, 0xFF, 0xAA, 0xAA, 0xAD, 0x94, 0xFE, 0x97,
+    0x4A, 0xFD, 0x76, 0xFD, 0x76, 0x9F, 0xCA, 0x76, 0xAF, 0xC9, 0x76, 0xFD, 0x77, 0xFD, 0x77, 0xFD,
+    0x77, 0xFD, 0x76, 0x9F, 0xD7, 0x7F, 0xDA, 0x76, 0xFE, 0x97, 0x5F, 0xFC, 0x99, 0x29, 0x9A, 0xC9,
+    0x2A, 0xFF, 0xFF, 0xC9, 0x3F, 0xFF, 0xFC, 0x93, 0xAF, 0xFF, 0xF9, 0x4F, 0xFF, 0xFA, 0x49, 0xFF,
+    0xFE, 0xA6, 0xFF, 0xFD, 0xA7, 0x9F, 0xFF, 0xA7, 0x4D, 0xA7, 0x71, 0x9D, 0x97, 0x71, 0xAF, 0x97,
+    0x7F, 0xD7, 0x79, 0x1A, 0xD9, 0x76, 0xAF, 0xC9, 0x76, 0xFC, 0xA7, 0x7F, 0xA5, 0x77, 0x5F, 0xA7,
+    0x6F, 0xC7, 0x6F, 0xC9, 0x75, 0xFC, 0xA7, 0x5A, 0xFC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xAA,
+    0xAA, 0xAA, 0xAF, 0xE9, 0x19, 0xFF, 0xFE, 0x2A, 0xFF, 0xFE, 0x2A, 0xFF, 0xFD, 0xA2, 0xAF, 0xAA,
+    0x99, 0x99, 0x96, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x99, 0x99, 0x99, 0xAA,
+    0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xC9, 0x74, 0xFC, 0x75, 0xFC,
+    0x75, 0xFC, 0x75, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFF, 0x2F, 0xFF, 0xF2, 0xFF,
+    0xFF, 0x91, 0xFF, 0xFF, 0xA1, 0xFF, 0xFF, 0xA0, 0x9F, 0xFF, 0xFC, 0x00, 0x70, 0xAD, 0xA7, 0x6E,
+    0x97, 0x59, 0xE7, 0x6E, 0xA7, 0x59, 0xE9, 0x75, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x71, 0x9A, 0xAA, 0xAA, 0xAA, 0xFE, 0x91, 0x9F, 0xFF, 0xE2, 0xAF, 0xFF, 0xE2, 0xAF,
+    0xFF, 0xDA, 0x2A, 0xFA, 0xA9, 0x99, 0x99, 0x6A, 0xF7, 0x5A, 0xF7, 0x5A, 0xF7, 0x5A, 0xF7, 0x5A,
+    0xF9, 0x99, 0x99, 0x9A, 0xA5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFC,
+    0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xCA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF,
+    0xF2, 0xFF, 0xFF, 0x2F, 0xFF, 0xF9, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF, 0xFA, 0x09, 0xFF, 0xFF, 0xC0,
+    0x79, 0xD9, 0x76, 0xF7, 0x5F, 0xCA, 0x73, 0xFE, 0xA7, 0x1F, 0xFC, 0xA7, 0xF9, 0x1A, 0xEA, 0x5F,
+    0x49, 0xF4, 0x99, 0x97, 0x99, 0x97, 0x77, 0x77, 0x77, 0x49, 0xAA, 0xAA, 0xAA, 0xAF, 0xE9, 0x19,
+    0xFF, 0xFE, 0x2A, 0xFF, 0xFE, 0x2A, 0xFF, 0xFD, 0xA2, 0xAF, 0xAA, 0x99, 0x99, 0x96, 0xAF, 0x75,
+    0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x99, 0x99, 0x99, 0xAA, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC,
+    0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xC9, 0x74, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0xA9,
+    0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFF, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0xA1,
+    0xFF, 0xFF, 0xA0, 0x9F, 0xFF, 0xFC, 0x00, 0x2A, 0xF2, 0xFA, 0x5F, 0xC2, 0xFC, 0x5F, 0xC2, 0xFC,
+    0x49, 0xFC, 0x19, 0xFC, 0x49, 0xFC, 0x90, 0xAF, 0xC9, 0x3A, 0xFC, 0x90, 0xAF, 0xC9, 0x39, 0x99,
+    0x99, 0x91, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAA, 0xAA, 0xAA, 0xAF, 0xE9,
+    0x19, 0xFF, 0xFE, 0x2A, 0xFF, 0xFE, 0x2A, 0xFF, 0xFD, 0xA2, 0xAF, 0xAA, 0x99, 0x99, 0x96, 0xAF,
+    0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x99, 0x99, 0x99, 0xAA, 0x5F, 0xFF, 0xC5, 0xFF,
+    0xFC, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xC9, 0x74, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC,
+    0xA9, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFF, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x91, 0xFF, 0xFF,
+    0xA1, 0xFF, 0xFF, 0xA0, 0x9F, 0xFF, 0xFC, 0x00, 0x75, 0xAF, 0x70, 0xAF, 0x97, 0xAF, 0xA7, 0xAF,
+    0xC7, 0x9F, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x6F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC,
+    0x7A, 0xF7, 0xAF, 0x7A, 0xF7, 0xAF, 0x7A, 0xF7, 0xAF, 0x7A, 0xF7, 0xAF, 0x7A, 0xF9, 0x6A, 0xF9,
+    0x6A, 0xF9, 0x6A, 0xFA, 0x6F, 0xCA, 0x6F, 0xCA, 0x6F, 0xCA, 0x6F, 0xD6, 0xFD, 0x6F, 0xD6, 0xFD,
+    0x10, 0x73, 0xE3, 0xAD, 0xA3, 0xE9, 0x2A, 0xE3, 0xEA, 0x2A, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x72,
+    0xFC, 0x2F, 0xC2, 0xFC, 0x2F, 0xC2, 0xFC, 0x2F, 0xC2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF,
+    0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x91, 0xAF, 0x91, 0xAF, 0x91, 0xAF, 0xA1, 0xFC, 0xA1, 0xFC,
+    0xA1, 0xFC, 0xA1, 0xFD, 0x1F, 0xD1, 0xFD, 0x1F, 0xD0, 0x77, 0x59, 0xE7, 0x3F, 0xA7, 0x1F, 0xD9,
+    0x7F, 0xF9, 0x5F, 0xCA, 0xF9, 0x3F, 0x92, 0xF9, 0x1F, 0x5A, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x4F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2A, 0xF7, 0x2A, 0xF7,
+    0x2A, 0xF7, 0x2A, 0xF7, 0x2A, 0xF7, 0x2A, 0xF7, 0x2A, 0xF7, 0x2A, 0xF7, 0x2A, 0xF9, 0x71, 0xAF,
+    0x97, 0x1A, 0xF9, 0x71, 0xAF, 0xA7, 0x1F, 0xCA, 0x71, 0xFC, 0xA7, 0x1F, 0xCA, 0x71, 0xFD, 0x71,
+    0xFD, 0x71, 0xFD, 0x71, 0xFD, 0x40, 0x19, 0x99, 0x93, 0x99, 0x99, 0x19, 0xF2, 0xAF, 0x1A, 0xF9,
+    0x1A, 0xF9, 0x0F, 0xC9, 0x1F, 0xC9, 0x0F, 0xCA, 0x1F, 0xCA, 0x0F, 0xCA, 0x1F, 0xCA, 0x9F, 0xD0,
+    0x9F, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F,
+    0xC7, 0x1F, 0xC7, 0x1A, 0xF7, 0x1A, 0xF7, 0x1A, 0xF7, 0x1A, 0xF7, 0x1A, 0xF7, 0x1A, 0xF7, 0x1A,
+    0xF7, 0x1A, 0xF7, 0x1A, 0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0xA7, 0x0F, 0xCA, 0x70,
+    0xFC, 0xA7, 0x0F, 0xCA, 0x70, 0xFD, 0x70, 0xFD, 0x70, 0xFD, 0x70, 0xFD, 0x30, 0x49, 0xFF, 0xEA,
+    0x97, 0x49, 0xFF, 0xFD, 0xA9, 0x71, 0x9F, 0xFF, 0xFA, 0x70, 0x9F, 0xFF, 0xFD, 0x79, 0xFF, 0xFF,
+    0xE6, 0x9F, 0xC5, 0x9F, 0xE9, 0x59, 0xFC, 0x79, 0xFD, 0x59, 0xFC, 0x71, 0xFC, 0x59, 0xFC, 0x71,
+    0x9F, 0x94, 0x9F, 0xC7, 0x2F, 0xA4, 0x9F, 0xC7, 0x2F, 0xC0, 0x99, 0x99, 0xAF, 0xC9, 0x99, 0x99,
+    0x5A, 0xF0, 0xFF, 0xFD, 0xA5, 0xAF, 0x0F, 0xFF, 0xDA, 0x5F, 0xC0, 0xFF, 0xFD, 0xA5, 0xFC, 0x49,
+    0xFC, 0x71, 0x9F, 0xA4, 0x9F, 0xC7, 0x09, 0xFC, 0xA4, 0x9F, 0xC4, 0x99, 0xAF, 0xE9, 0x49, 0xFF,
+    0xFF, 0xF5, 0x9F, 0xFF, 0xFF, 0x59, 0xFF, 0xFF, 0xE9, 0x59, 0xFF, 0xFF, 0xE6, 0x9F, 0xFF, 0xFD,
+    0x79, 0xFF, 0xFF, 0xA7, 0x09, 0xFF, 0xFA, 0xA9, 0x50, 0x79, 0xAC, 0x91, 0x9D, 0x73, 0x9F, 0xA1,
+    0xD9, 0x72, 0xAF, 0xCA, 0x9D, 0x97, 0x2E, 0x0F, 0xD7, 0x3E, 0x09, 0xFC, 0x73, 0xE1, 0x9E, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x70, 0xF9, 0x19, 0xAA, 0xAA, 0xA7, 0x0F, 0x91, 0x9F, 0xCA, 0x69, 0xF9,
+    0x1A, 0xFD, 0x69, 0xF9, 0x1A, 0xFD, 0x95, 0x9F, 0x2A, 0xFE, 0x5A, 0xF2, 0xFF, 0x94, 0xAF, 0x2F,
+    0xFC, 0x4A, 0xF2, 0xFF, 0xC9, 0x3F, 0xC2, 0xFF, 0xD3, 0xFC, 0x2F, 0xFD, 0x92, 0xFC, 0x2F, 0xCA,
+    0xFC, 0x2F, 0xC1, 0x9F, 0xC9, 0xAF, 0x2F, 0xC1, 0x9F, 0xCA, 0x0F, 0xA1, 0xFC, 0x19, 0xFC, 0xA0,
+    0xFC, 0x1F, 0xA1, 0xAF, 0xCA, 0x09, 0xFA, 0x9F, 0xA1, 0xAF, 0xCA, 0x1F, 0xCA, 0xFA, 0x1A, 0xFC,
+    0xA1, 0xAF, 0xFC, 0xA1, 0xAF, 0xCA, 0x2F, 0xFC, 0xA1, 0xFD, 0xA2, 0xAF, 0xF9, 0x1F, 0xE2, 0x9F,
+    0xF9, 0x1F, 0xE3, 0xFF, 0x91, 0xFE, 0x39, 0xFE, 0x91, 0xFE, 0x4F, 0xE2, 0xFE, 0x4A, 0xFD, 0x10,
+    0x5F, 0xA7, 0x74, 0xFC, 0x77, 0x4A, 0xF9, 0x77, 0x3A, 0xFA, 0x77, 0x3A, 0xFC, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x73, 0x9A, 0xFC, 0xA9, 0x75, 0x9F, 0xFE, 0x97, 0x2A, 0xFF, 0xFD, 0x70, 0xAF, 0xFF,
+    0xF6, 0xAF, 0xD9, 0x29, 0xFD, 0xA4, 0x9F, 0xCA, 0x6A, 0xFC, 0x93, 0xAF, 0xC7, 0x0A, 0xFC, 0x3F,
+    0xC7, 0x2F, 0xC9, 0x1A, 0xFC, 0x72, 0xAF, 0xA1, 0xFC, 0x97, 0x29, 0xFC, 0x1F, 0xC7, 0x4F, 0xC1,
+    0xFC, 0x74, 0xFC, 0x1F, 0xC7, 0x4F, 0xC9, 0x9F, 0xC7, 0x4F, 0xC9, 0x9F, 0xC7, 0x4F, 0xC9, 0x0F,
+    0xC7, 0x4F, 0xC9, 0x0F, 0xC7, 0x4F, 0xC1, 0xFD, 0x72, 0xAF, 0xC1, 0xFD, 0xA7, 0x09, 0xFD, 0x1F,
+    0xFA, 0x99, 0x09, 0x9A, 0xFF, 0x1A, 0xFF, 0xFF, 0xFC, 0xA2, 0xFF, 0xFF, 0xFC, 0x92, 0xAF, 0xFF,
+    0xFF, 0x4F, 0xFF, 0xFE, 0x95, 0xFF, 0xFF, 0xCA, 0x7A, 0xFF, 0xFD, 0x97, 0x29, 0xAF, 0xEA, 0xA9,
+    0x77, 0x76, 0x73, 0x9E, 0x77, 0x4E, 0xA7, 0x73, 0x9E, 0x77, 0x4F, 0x77, 0x39, 0xEA, 0x77, 0x3F,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAF, 0xCA, 0x97,
+    0x59, 0xFF, 0xE9, 0x72, 0xAF, 0xFF, 0xD7, 0x0A, 0xFF, 0xFF, 0x6A, 0xFD, 0x92, 0x9F, 0xDA, 0x49,
+    0xFC, 0xA6, 0xAF, 0xC9, 0x3A, 0xFC, 0x70, 0xAF, 0xC3, 0xFC, 0x72, 0xFC, 0x91, 0xAF, 0xC7, 0x2A,
+    0xFA, 0x1F, 0xC9, 0x72, 0x9F, 0xC1, 0xFC, 0x74, 0xFC, 0x1F, 0xC7, 0x4F, 0xC1, 0xFC, 0x74, 0xFC,
+    0x99, 0xFC, 0x74, 0xFC, 0x99, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0x74, 0xFC,
+    0x1F, 0xD7, 0x2A, 0xFC, 0x1F, 0xDA, 0x70, 0x9F, 0xD1, 0xFF, 0xA9, 0x90, 0x99, 0xAF, 0xF1, 0xAF,
+    0xFF, 0xFF, 0xCA, 0x2F, 0xFF, 0xFF, 0xC9, 0x2A, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE9, 0x5F, 0xFF,
+    0xFC, 0xA7, 0xAF, 0xFF, 0xD9, 0x72, 0x9A, 0xFE, 0xAA, 0x97, 0x77, 0x60, 0x72, 0x9D, 0xA7, 0x74,
+    0xF7, 0x73, 0xAF, 0xC7, 0x71, 0xAF, 0xE7, 0x7A, 0xFF, 0xC7, 0x5F, 0xA1, 0xAF, 0x73, 0xF9, 0x4F,
+    0x72, 0x99, 0x97, 0x99, 0x97, 0x77, 0x77, 0x77, 0x69, 0xAF, 0xCA, 0x97, 0x59, 0xFF, 0xE9, 0x72,
+    0xAF, 0xFF, 0xD7, 0x0A, 0xFF, 0xFF, 0x6A, 0xFD, 0x92, 0x9F, 0xDA, 0x49, 0xFC, 0xA6, 0xAF, 0xC9,
+    0x3A, 0xFC, 0x70, 0xAF, 0xC3, 0xFC, 0x72, 0xFC, 0x91, 0xAF, 0xC7, 0x2A, 0xFA, 0x1F, 0xC9, 0x72,
+    0x9F, 0xC1, 0xFC, 0x74, 0xFC, 0x1F, 0xC7, 0x4F, 0xC1, 0xFC, 0x74, 0xFC, 0x99, 0xFC, 0x74, 0xFC,
+    0x99, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0x74, 0xFC, 0x1F, 0xD7, 0x2A, 0xFC,
+    0x1F, 0xDA, 0x70, 0x9F, 0xD1, 0xFF, 0xA9, 0x90, 0x99, 0xAF, 0xF1, 0xAF, 0xFF, 0xFF, 0xCA, 0x2F,
+    0xFF, 0xFF, 0xC9, 0x2A, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE9, 0x5F, 0xFF, 0xFC, 0xA7, 0xAF, 0xFF,
+    0xD9, 0x72, 0x9A, 0xFE, 0xAA, 0x97, 0x77, 0x60, 0x70, 0xAC, 0xA2, 0xD9, 0x76, 0xFC, 0x1D, 0xA7,
+    0x59, 0xFD, 0x0D, 0xA7, 0x5A, 0xD0, 0xFD, 0x97, 0x5A, 0xD1, 0xFC, 0x76, 0xE2, 0xAD, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x29, 0xAF, 0xCA, 0x97, 0x59, 0xFF, 0xE9, 0x72, 0xAF, 0xFF, 0xD7, 0x0A,
+    0xFF, 0xFF, 0x6A, 0xFD, 0x92, 0x9F, 0xDA, 0x49, 0xFC, 0xA6, 0xAF, 0xC9, 0x3A, 0xFC, 0x70, 0xAF,
+    0xC3, 0xFC, 0x72, 0xFC, 0x91, 0xAF, 0xC7, 0x2A, 0xFA, 0x1F, 0xC9, 0x72, 0x9F, 0xC1, 0xFC, 0x74,
+    0xFC, 0x1F, 0xC7, 0x4F, 0xC1, 0xFC, 0x74, 0xFC, 0x99, 0xFC, 0x74, 0xFC, 0x99, 0xFC, 0x74, 0xFC,
+    0x90, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0x74, 0xFC, 0x1F, 0xD7, 0x2A, 0xFC, 0x1F, 0xDA, 0x70, 0x9F,
+    0xD1, 0xFF, 0xA9, 0x90, 0x99, 0xAF, 0xF1, 0xAF, 0xFF, 0xFF, 0xCA, 0x2F, 0xFF, 0xFF, 0xC9, 0x2A,
+    0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE9, 0x5F, 0xFF, 0xFC, 0xA7, 0xAF, 0xFF, 0xD9, 0x72, 0x9A, 0xFE,
+    0xAA, 0x97, 0x77, 0x60, 0x5A, 0xF2, 0xAF, 0x73, 0xAF, 0x2F, 0xC7, 0x3F, 0xC9, 0x1F, 0xC7, 0x3F,
+    0xC9, 0x1F, 0xC9, 0x72, 0xFC, 0xA0, 0x9F, 0xC9, 0x71, 0x9F, 0xCA, 0x09, 0xFC, 0xA7, 0x29, 0x99,
+    0x99, 0x91, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xAF, 0xCA, 0x97, 0x59, 0xFF,
+    0xE9, 0x72, 0xAF, 0xFF, 0xD7, 0x0A, 0xFF, 0xFF, 0x6A, 0xFD, 0x92, 0x9F, 0xDA, 0x49, 0xFC, 0xA6,
+    0xAF, 0xC9, 0x3A, 0xFC, 0x70, 0xAF, 0xC3, 0xFC, 0x72, 0xFC, 0x91, 0xAF, 0xC7, 0x2A, 0xFA, 0x1F,
+    0xC9, 0x72, 0x9F, 0xC1, 0xFC, 0x74, 0xFC, 0x1F, 0xC7, 0x4F, 0xC1, 0xFC, 0x74, 0xFC, 0x99, 0xFC,
+    0x74, 0xFC, 0x99, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0x74, 0xFC, 0x1F, 0xD7,
+    0x2A, 0xFC, 0x1F, 0xDA, 0x70, 0x9F, 0xD1, 0xFF, 0xA9, 0x90, 0x99, 0xAF, 0xF1, 0xAF, 0xFF, 0xFF,
+    0xCA, 0x2F, 0xFF, 0xFF, 0xC9, 0x2A, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE9, 0x5F, 0xFF, 0xFC, 0xA7,
+    0xAF, 0xFF, 0xD9, 0x72, 0x9A, 0xFE, 0xAA, 0x97, 0x77, 0x60, 0x09, 0xFA, 0x2F, 0xC3, 0x9F, 0xA0,
+    0xFC, 0x59, 0xFF, 0xC7, 0x9F, 0xE7, 0x1A, 0xFC, 0xA7, 0x09, 0xFE, 0x96, 0x9F, 0xFC, 0xA4, 0x9F,
+    0xFE, 0xA2, 0xAF, 0xCA, 0x09, 0xFD, 0x19, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x90, 0x77, 0x77,
+    0x77, 0x77, 0x74, 0x9A, 0xD9, 0x77, 0x77, 0x1A, 0xFC, 0x77, 0x77, 0x19, 0xFC, 0x77, 0x77, 0x2F,
+    0xCA, 0x77, 0x77, 0x1A, 0xFC, 0x77, 0x77, 0x19, 0xFC, 0x97, 0x77, 0x71, 0xFD, 0x77, 0x77, 0x19,
+    0xFC, 0x97, 0x77, 0x71, 0xFC, 0xA7, 0x77, 0x71, 0xAF, 0xC7, 0x77, 0x71, 0x9F, 0xC9, 0x77, 0x77,
+    0x1F, 0xD7, 0x77, 0x71, 0xAF, 0xC9, 0x77, 0x77, 0x1F, 0xCA, 0x77, 0x77, 0x1F, 0xD7, 0x77, 0x71,
+    0x9F, 0xCA, 0x77, 0x70, 0x9A, 0xFC, 0xA9, 0xFD, 0x77, 0x79, 0xFF, 0xFE, 0x97, 0x76, 0xAF, 0xFF,
+    0xF7, 0x76, 0xAF, 0xFF, 0xF9, 0x77, 0x5A, 0xFD, 0x92, 0xAF, 0xE7, 0x74, 0x9F, 0xCA, 0x4F, 0xFA,
+    0x77, 0x3A, 0xFC, 0x4A, 0xFF, 0xC7, 0x73, 0xFC, 0x5F, 0xFD, 0x97, 0x71, 0xAF, 0xC4, 0xFF, 0xEA,
+    0x77, 0x1F, 0xC9, 0x39, 0xFD, 0x9F, 0xC7, 0x71, 0xFC, 0x4F, 0xD9, 0x0F, 0xC7, 0x71, 0xFC, 0x39,
+    0xFD, 0x1F, 0xC9, 0x77, 0x0F, 0xC3, 0xFD, 0x91, 0xFC, 0x97, 0x79, 0xFC, 0x2A, 0xFC, 0xA2, 0xFC,
+    0x97, 0x79, 0xFC, 0x2F, 0xD3, 0xFC, 0x97, 0x70, 0xFC, 0x1A, 0xFC, 0xA3, 0xFC, 0x97, 0x70, 0xFC,
+    0x09, 0xFD, 0x4F, 0xC7, 0x71, 0xFC, 0xAF, 0xDA, 0x3A, 0xFC, 0x77, 0x1F, 0xFF, 0x39, 0xFD, 0x77,
+    0x1F, 0xFE, 0xA9, 0x9A, 0xFF, 0x77, 0x1A, 0xFF, 0xFF, 0xFC, 0xA7, 0x72, 0xFF, 0xFF, 0xFC, 0x97,
+    0x72, 0xFF, 0xFF, 0xFC, 0x77, 0x4F, 0xFF, 0xFE, 0x97, 0x74, 0xFF, 0xFF, 0xDA, 0x77, 0x4A, 0xFF,
+    0xFF, 0xC9, 0x77, 0x49, 0xFF, 0xFD, 0xAA, 0x97, 0x76, 0xFE, 0x77, 0x77, 0x0A, 0xFD, 0x97, 0x77,
+    0x70, 0xFE, 0x77, 0x77, 0x0F, 0xE7, 0x77, 0x70, 0x9F, 0xDA, 0x77, 0x77, 0x0F, 0xE7, 0x77, 0x70,
+    0xAF, 0xD9, 0x77, 0x77, 0x0F, 0xE7, 0x77, 0x70, 0xFE, 0x77, 0x77, 0x09, 0xFD, 0xA7, 0x77, 0x70,
+    0xFE, 0x77, 0x77, 0x0A, 0xFC, 0xA7, 0x77, 0x70, 0x9F, 0x97, 0x77, 0x72, 0xDA, 0x97, 0x77, 0x73,
+    0x99, 0x77, 0x77, 0x60, 0x39, 0xF9, 0x77, 0x09, 0xFA, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x97, 0x70,
+    0xFC, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD9,
+    0x0F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD,
+    0x1F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xCA, 0x7F, 0xD1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7,
+    0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7,
+    0xAF, 0xA1, 0xAF, 0xC7, 0xFC, 0xA1, 0xAF, 0xC9, 0x59, 0xFC, 0xA1, 0xAF, 0xEA, 0xAA, 0xAF, 0xE9,
+    0x19, 0xFF, 0xFF, 0xD9, 0x2F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x39, 0xFF, 0xFF, 0x94, 0xAF, 0xFF,
+    0xDA, 0x69, 0xFF, 0xF9, 0x77, 0x71, 0x72, 0xAD, 0x97, 0x71, 0xE7, 0x71, 0xAE, 0x77, 0x1E, 0x97,
+    0x70, 0xAE, 0x77, 0x1F, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x76, 0x9F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD9, 0x0F,
+    0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xCA,
+    0x7F, 0xD1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7,
+    0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xA1, 0xAF, 0xC7, 0xFC, 0xA1, 0xAF, 0xC9,
+    0x59, 0xFC, 0xA1, 0xAF, 0xEA, 0xAA, 0xAF, 0xE9, 0x19, 0xFF, 0xFF, 0xD9, 0x2F, 0xFF, 0xFD, 0x3F,
+    0xFF, 0xFD, 0x39, 0xFF, 0xFF, 0x94, 0xAF, 0xFF, 0xDA, 0x69, 0xFF, 0xF9, 0x77, 0x71, 0x71, 0xAD,
+    0x77, 0x19, 0xF7, 0x70, 0xFC, 0xA7, 0x6F, 0xEA, 0x73, 0x9F, 0xAF, 0xA7, 0x19, 0xF9, 0x1F, 0xA7,
+    0x9E, 0xA4, 0xAE, 0xA7, 0x99, 0x70, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0xFD, 0x7F,
+    0xD9, 0x0F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD1, 0xFD,
+    0x7F, 0xD1, 0xFD, 0x7F, 0xD1, 0xFD, 0x7F, 0xD1, 0xFD, 0x7F, 0xD1, 0xFC, 0xA7, 0xFD, 0x1F, 0xCA,
+    0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA,
+    0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFA, 0x1A, 0xFC, 0x7F, 0xCA, 0x1A, 0xFC, 0x95, 0x9F, 0xCA, 0x1A,
+    0xFE, 0xAA, 0xAA, 0xFE, 0x91, 0x9F, 0xFF, 0xFD, 0x92, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xD3, 0x9F,
+    0xFF, 0xF9, 0x4A, 0xFF, 0xFD, 0xA6, 0x9F, 0xFF, 0x97, 0x77, 0x10, 0x4F, 0xA2, 0xFA, 0x70, 0xFA,
+    0x2F, 0xA7, 0x9F, 0xC1, 0x9F, 0xC7, 0x9F, 0xC1, 0xAF, 0xC7, 0xAF, 0xC1, 0xAF, 0xC7, 0xFD, 0x90,
+    0xFD, 0x79, 0x99, 0x99, 0x91, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19,
+    0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F,
+    0xD1, 0xFD, 0x7F, 0xD1, 0xFD, 0x7F, 0xD1, 0xFD, 0x7F, 0xD1, 0xFD, 0x7F, 0xD1, 0xFC, 0xA7, 0xFD,
+    0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC,
+    0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFA, 0x1A, 0xFC, 0x7F, 0xCA, 0x1A, 0xFC, 0x95, 0x9F,
+    0xCA, 0x1A, 0xFE, 0xAA, 0xAA, 0xFE, 0x91, 0x9F, 0xFF, 0xFD, 0x92, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
+    0xD3, 0x9F, 0xFF, 0xF9, 0x4A, 0xFF, 0xFD, 0xA6, 0x9F, 0xFF, 0x97, 0x77, 0x10, 0x72, 0x9D, 0xA7,
+    0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xEA, 0x77, 0x19, 0xE9, 0x77, 0x1F, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7F, 0xC7, 0x2F, 0xC9,
+    0x0A, 0xFA, 0x70, 0x9F, 0xC2, 0xFC, 0x97, 0xFC, 0x92, 0xAF, 0xC6, 0x9F, 0xC4, 0xFC, 0x95, 0xFC,
+    0xA4, 0xAF, 0xC4, 0x9F, 0xC5, 0x9F, 0xC9, 0x3F, 0xCA, 0x6F, 0xD2, 0x9F, 0xC7, 0x9F, 0xC9, 0x1F,
+    0xCA, 0x70, 0xFD, 0x09, 0xFC, 0x71, 0x9F, 0xC9, 0xFC, 0xA7, 0x2F, 0xFE, 0x97, 0x2A, 0xFF, 0xD7,
+    0x4F, 0xFC, 0x97, 0x4A, 0xFF, 0x76, 0xFE, 0x97, 0x6A, 0xFD, 0x77, 0x9F, 0xCA, 0x77, 0x9F, 0xCA,
+    0x77, 0xAF, 0xCA, 0x77, 0xAF, 0xCA, 0x77, 0xAF, 0xD7, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F, 0xE7, 0x75,
+    0x9E, 0x71, 0x9E, 0x71, 0x9E, 0x71, 0x9E, 0x97, 0x09, 0xFD, 0xA5, 0x9F, 0xFA, 0x39, 0xFF, 0xD9,
+    0x19, 0xFF, 0xE1, 0x9E, 0x29, 0xFC, 0x09, 0xE4, 0xF9, 0x9E, 0x4A, 0xEA, 0x9E, 0x4F, 0xA9, 0xE3,
+    0xAF, 0x99, 0xE9, 0x09, 0xFD, 0x09, 0xFF, 0xE1, 0x9F, 0xFD, 0x29, 0xFF, 0x93, 0x9F, 0xD9, 0x59,
+    0xE9, 0x70, 0x9E, 0x71, 0x9E, 0x71, 0x9E, 0x71, 0x9E, 0x71, 0x77, 0x6A, 0xFC, 0xA7, 0x09, 0xFF,
+    0xC9, 0x59, 0xFF, 0xE9, 0x4F, 0xA2, 0x9F, 0x39, 0xF5, 0xE3, 0x9E, 0xA3, 0x9F, 0x92, 0xAE, 0x92,
+    0xAF, 0xCA, 0x2A, 0xE9, 0x19, 0xFD, 0x3A, 0xE9, 0x1F, 0x95, 0xF9, 0x1E, 0x96, 0xFA, 0x1E, 0x7F,
+    0xA1, 0xEA, 0x6F, 0xA1, 0xFA, 0x5F, 0xA1, 0x9F, 0xC4, 0xFA, 0x2F, 0xD9, 0x2F, 0xA2, 0x9F, 0xD2,
+    0xFC, 0x4F, 0xD1, 0xFC, 0x5A, 0xF1, 0xFC, 0x6F, 0x90, 0xFD, 0xA9, 0x29, 0xF0, 0x9F, 0xFF, 0xF0,
+    0x9F, 0xFF, 0xF0, 0x9F, 0xFF, 0xE1, 0x9F, 0xFF, 0xD9, 0x29, 0x99, 0x99, 0x09, 0xAE, 0xA9, 0x30,
+    0x77, 0x2F, 0xC7, 0x4A, 0xF9, 0x73, 0xAF, 0xA7, 0x3A, 0xFC, 0x73, 0xAF, 0xC9, 0x77, 0x77, 0x77,
+    0x72, 0x9A, 0xEA, 0x71, 0xAF, 0xFD, 0xA3, 0x9F, 0xFE, 0xA3, 0xFA, 0x9A, 0xFD, 0x29, 0xE9, 0x3F,
+    0xC2, 0xEA, 0x49, 0xF2, 0xE9, 0x5F, 0x2E, 0x6A, 0xE9, 0x09, 0xDA, 0x6A, 0xE9, 0x0A, 0xDA, 0x69,
+    0xEA, 0x09, 0xD9, 0x69, 0xEA, 0x09, 0xDA, 0x6A, 0xF0, 0x9E, 0xA9, 0x99, 0x9A, 0xFD, 0x1F, 0xFF,
+    0xE1, 0xAF, 0xFF, 0xD2, 0xFF, 0xFD, 0x91, 0x9F, 0xFA, 0xF9, 0x3A, 0xFA, 0x95, 0x79, 0xE7, 0x4E,
+    0x97, 0x39, 0xE7, 0x4F, 0x73, 0x9E, 0xA7, 0x3F, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x19, 0xAE, 0xA7, 0x1A, 0xFF, 0xDA, 0x39, 0xFF, 0xEA, 0x3F, 0xA9, 0xAF, 0xD2, 0x9E, 0x93, 0xFC,
+    0x2E, 0xA4, 0x9F, 0x2E, 0x95, 0xF2, 0xE6, 0xAE, 0x90, 0x9D, 0xA6, 0xAE, 0x90, 0xAD, 0xA6, 0x9E,
+    0xA0, 0x9D, 0x96, 0x9E, 0xA0, 0x9D, 0xA6, 0xAF, 0x09, 0xEA, 0x99, 0x99, 0xAF, 0xD1, 0xFF, 0xFE,
+    0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xD9, 0x19, 0xFF, 0xAF, 0x93, 0xAF, 0xA9, 0x50, 0x69, 0xDA, 0x74,
+    0xF7, 0x3A, 0xFC, 0x71, 0xFF, 0x7F, 0xFD, 0x5F, 0xA1, 0xAF, 0x3F, 0x94, 0xF2, 0x99, 0x97, 0x99,
+    0x97, 0x77, 0x76, 0x9A, 0xEA, 0x71, 0xAF, 0xFD, 0xA3, 0x9F, 0xFE, 0xA3, 0xFA, 0x9A, 0xFD, 0x29,
+    0xE9, 0x3F, 0xC2, 0xEA, 0x49, 0xF2, 0xE9, 0x5F, 0x2E, 0x6A, 0xE9, 0x09, 0xDA, 0x6A, 0xE9, 0x0A,
+    0xDA, 0x69, 0xEA, 0x09, 0xD9, 0x69, 0xEA, 0x09, 0xDA, 0x6A, 0xF0, 0x9E, 0xA9, 0x99, 0x9A, 0xFD,
+    0x1F, 0xFF, 0xE1, 0xAF, 0xFF, 0xD2, 0xFF, 0xFD, 0x91, 0x9F, 0xFA, 0xF9, 0x3A, 0xFA, 0x95, 0x4A,
+    0xCA, 0x2D, 0x96, 0xFC, 0x1D, 0xA5, 0x9F, 0xCA, 0x0D, 0xA5, 0xAD, 0x0F, 0xD9, 0x5E, 0x1F, 0xC6,
+    0xAD, 0x2A, 0xD9, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xEA, 0x71, 0xAF, 0xFD, 0xA3, 0x9F, 0xFE, 0xA3,
+    0xFA, 0x9A, 0xFD, 0x29, 0xE9, 0x3F, 0xC2, 0xEA, 0x49, 0xF2, 0xE9, 0x5F, 0x2E, 0x6A, 0xE9, 0x09,
+    0xDA, 0x6A, 0xE9, 0x0A, 0xDA, 0x69, 0xEA, 0x09, 0xD9, 0x69, 0xEA, 0x09, 0xDA, 0x6A, 0xF0, 0x9E,
+    0xA9, 0x99, 0x9A, 0xFD, 0x1F, 0xFF, 0xE1, 0xAF, 0xFF, 0xD2, 0xFF, 0xFD, 0x91, 0x9F, 0xFA, 0xF9,
+    0x3A, 0xFA, 0x95, 0x1A, 0xF2, 0xAF, 0x3A, 0xF2, 0xFC, 0x3F, 0xC2, 0xFC, 0x3F, 0xC9, 0x1F, 0xC9,
+    0x19, 0xFC, 0xA0, 0x9F, 0xC9, 0x19, 0xFC, 0xA0, 0xAF, 0xCA, 0x29, 0x99, 0x99, 0x91, 0x99, 0x99,
+    0x99, 0x77, 0x77, 0x77, 0x79, 0xAE, 0xA7, 0x1A, 0xFF, 0xDA, 0x39, 0xFF, 0xEA, 0x3F, 0xA9, 0xAF,
+    0xD2, 0x9E, 0x93, 0xFC, 0x2E, 0xA4, 0x9F, 0x2E, 0x95, 0xF2, 0xE6, 0xAE, 0x90, 0x9D, 0xA6, 0xAE,
+    0x90, 0xAD, 0xA6, 0x9E, 0xA0, 0x9D, 0x96, 0x9E, 0xA0, 0x9D, 0xA6, 0xAF, 0x09, 0xEA, 0x99, 0x99,
+    0xAF, 0xD1, 0xFF, 0xFE, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xD9, 0x19, 0xFF, 0xAF, 0x93, 0xAF, 0xA9,
+    0x50, 0x6E, 0x97, 0x3F, 0xC9, 0x71, 0xAD, 0xAE, 0x71, 0xE0, 0xE7, 0x1A, 0xFC, 0xA7, 0x2F, 0xC9,
+    0x73, 0xE9, 0x77, 0x77, 0x77, 0x74, 0x9A, 0xEA, 0x71, 0xAF, 0xFD, 0xA3, 0x9F, 0xFE, 0xA3, 0xFA,
+    0x9A, 0xFD, 0x29, 0xE9, 0x3F, 0xC2, 0xEA, 0x49, 0xF2, 0xE9, 0x5F, 0x2E, 0x6A, 0xE9, 0x09, 0xDA,
+    0x6A, 0xE9, 0x0A, 0xDA, 0x69, 0xEA, 0x09, 0xD9, 0x69, 0xEA, 0x09, 0xDA, 0x6A, 0xF0, 0x9E, 0xA9,
+    0x99, 0x9A, 0xFD, 0x1F, 0xFF, 0xE1, 0xAF, 0xFF, 0xD2, 0xFF, 0xFD, 0x91, 0x9F, 0xFA, 0xF9, 0x3A,
+    0xFA, 0x95, 0x77, 0x77, 0x09, 0xAE, 0xA6, 0x9A, 0xEA, 0x70, 0xAF, 0xFD, 0xA9, 0xFF, 0xA5, 0x9F,
+    0xFF, 0xFF, 0xDA, 0x4F, 0xA9, 0xAF, 0xFC, 0x92, 0xAE, 0x92, 0x9E, 0x93, 0xFE, 0x94, 0xAE, 0x2E,
+    0xA4, 0x9F, 0xDA, 0xAA, 0xAA, 0xAF, 0x91, 0xE9, 0x5F, 0xFF, 0xFA, 0x1E, 0x6A, 0xFF, 0xFF, 0x09,
+    0xDA, 0x6A, 0xFF, 0xFF, 0x0A, 0xDA, 0x69, 0xFA, 0xA9, 0x99, 0x79, 0xD9, 0x69, 0xF9, 0x73, 0x9D,
+    0xA6, 0xAF, 0xC7, 0x39, 0xEA, 0x99, 0x99, 0xAF, 0xFA, 0x59, 0xCA, 0x1F, 0xFF, 0xFF, 0xFD, 0xA1,
+    0xAF, 0xFF, 0xFF, 0xFC, 0xA2, 0xFF, 0xFF, 0xFF, 0xCA, 0x29, 0xFF, 0xAF, 0xFF, 0xE9, 0x4A, 0xFA,
+    0x96, 0xAF, 0xAA, 0x30, 0x77, 0x39, 0xAF, 0xA9, 0x49, 0xFF, 0xA3, 0x9F, 0xFC, 0xA3, 0xFF, 0xDA,
+    0x2A, 0xF9, 0x70, 0xF9, 0x70, 0x9F, 0x71, 0x9F, 0x71, 0xAF, 0x71, 0x9F, 0x71, 0x9F, 0x97, 0x09,
+    0xFC, 0x71, 0xFC, 0xA1, 0x9C, 0xA3, 0x9F, 0xFD, 0x93, 0xFF, 0xE9, 0x3A, 0xFF, 0xD4, 0x9A, 0xFC,
+    0xA9, 0x79, 0xD9, 0x72, 0xAF, 0x97, 0x0F, 0xD7, 0x09, 0x1A, 0xD7, 0x0F, 0xD7, 0x0F, 0xCA, 0x70,
+    0xF9, 0x30, 0x1A, 0xF7, 0x4A, 0xF9, 0x73, 0xAF, 0xA7, 0x3A, 0xFC, 0x73, 0xAF, 0xC9, 0x77, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0xAE, 0xA9, 0x70, 0xAF, 0xF6, 0xFF, 0xE9, 0x3F, 0xC9,
+    0x19, 0xF2, 0x9F, 0x5E, 0x91, 0xFA, 0xAA, 0xAA, 0xAF, 0xC1, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x99,
+    0xFF, 0xFE, 0x9A, 0xFA, 0x99, 0x99, 0x69, 0xF7, 0x39, 0xF9, 0x73, 0xFD, 0x95, 0xAC, 0x1A, 0xFF,
+    0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC4, 0xFF, 0xEA, 0x59, 0xAF, 0xCA, 0x92, 0x70, 0xE7, 0x4A,
+    0xDA, 0x74, 0xE9, 0x73, 0xAE, 0x74, 0xEA, 0x73, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xEA, 0x97, 0x0A, 0xFF, 0x6F, 0xFE, 0x93, 0xFC, 0x91,
+    0x9F, 0x29, 0xF5, 0xE9, 0x1F, 0xAA, 0xAA, 0xAA, 0xFC, 0x1F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x9F,
+    0xFF, 0xE9, 0xAF, 0xA9, 0x99, 0x96, 0x9F, 0x73, 0x9F, 0x97, 0x3F, 0xD9, 0x5A, 0xC1, 0xAF, 0xFF,
+    0xD2, 0xFF, 0xFD, 0x29, 0xFF, 0xFC, 0x4F, 0xFE, 0xA5, 0x9A, 0xFC, 0xA9, 0x20, 0x7D, 0xA7, 0x4F,
+    0x97, 0x2A, 0xFC, 0x71, 0xAF, 0xE7, 0xAF, 0xFC, 0x5A, 0xEA, 0x19, 0xF3, 0xAE, 0x94, 0xF2, 0x99,
+    0x97, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xAE, 0xA9, 0x70, 0xAF, 0xF6, 0xFF,
+    0xE9, 0x3F, 0xC9, 0x19, 0xF2, 0x9F, 0x5E, 0x91, 0xFA, 0xAA, 0xAA, 0xAF, 0xC1, 0xFF, 0xFE, 0x09,
+    0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x9A, 0xFA, 0x99, 0x99, 0x69, 0xF7, 0x39, 0xF9, 0x73, 0xFD, 0x95,
+    0xAC, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC4, 0xFF, 0xEA, 0x59, 0xAF, 0xCA, 0x92,
+    0x29, 0x99, 0x93, 0x99, 0x99, 0x39, 0xF2, 0xAF, 0x3A, 0xF9, 0x1A, 0xF3, 0xFC, 0x91, 0xFC, 0x92,
+    0xFC, 0xA1, 0xFC, 0xA2, 0xFC, 0xA0, 0x9F, 0xCA, 0x19, 0xFD, 0x09, 0xFD, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x74, 0x9A, 0xEA, 0x97, 0x0A, 0xFF, 0x6F, 0xFE, 0x93, 0xFC, 0x91, 0x9F, 0x29,
+    0xF5, 0xE9, 0x1F, 0xAA, 0xAA, 0xAA, 0xFC, 0x1F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9,
+    0xAF, 0xA9, 0x99, 0x96, 0x9F, 0x73, 0x9F, 0x97, 0x3F, 0xD9, 0x5A, 0xC1, 0xAF, 0xFF, 0xD2, 0xFF,
+    0xFD, 0x29, 0xFF, 0xFC, 0x4F, 0xFE, 0xA5, 0x9A, 0xFC, 0xA9, 0x20, 0x9F, 0x96, 0x9F, 0x96, 0x9F,
+    0xA6, 0x9F, 0xC6, 0x9F, 0xC9, 0x72, 0x97, 0x77, 0x5A, 0xAA, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+    0xF7, 0xF7, 0xF7, 0xF7, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x95, 0x9F, 0x95, 0xAF, 0xA5, 0xAF, 0xA1,
+    0x2E, 0x29, 0xE2, 0xEA, 0x19, 0xE2, 0xF1, 0x9E, 0xA7, 0x77, 0x77, 0x73, 0xAA, 0xAA, 0x2F, 0x2F,
+    0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x19, 0xF1, 0x9F, 0x19, 0xF9, 0x09, 0xF9, 0x0A,
+    0xFA, 0x0A, 0xFA, 0x00, 0x6E, 0x74, 0xAE, 0xA7, 0x29, 0xFC, 0x97, 0x09, 0xFE, 0x96, 0x9F, 0xAF,
+    0x94, 0x9F, 0x19, 0xF9, 0x29, 0xEA, 0x4A, 0xE9, 0x19, 0x99, 0x70, 0x99, 0x97, 0x77, 0x77, 0x0A,
+    0xAA, 0x97, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74,
+    0xF7, 0x39, 0xF7, 0x39, 0xF7, 0x39, 0xF9, 0x72, 0x9F, 0x97, 0x2A, 0xFA, 0x72, 0xAF, 0xA5, 0x0A,
+    0xE9, 0x1A, 0xE9, 0x1A, 0xEA, 0x1A, 0xEA, 0x1F, 0xA1, 0xFA, 0x1F, 0xC1, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x09, 0xAA, 0xAA, 0xA0, 0x9A, 0xAA, 0xAA, 0x77, 0x77, 0x77, 0xF7, 0x1F, 0x71, 0xF7, 0x1F,
+    0x71, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F, 0x70,
+    0x9F, 0x97, 0xAF, 0xA7, 0xAF, 0xA3, 0x72, 0xA9, 0x97, 0x72, 0x9F, 0x97, 0x70, 0xFD, 0xA7, 0x69,
+    0xFE, 0x77, 0x2F, 0x97, 0x4F, 0xFF, 0xDA, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xDA, 0x79, 0x99, 0x99,
+    0xAE, 0xA9, 0x99, 0x99, 0x49, 0xAD, 0xA9, 0x19, 0xE7, 0x09, 0xFF, 0x0A, 0xE7, 0xAF, 0xFF, 0xD7,
+    0xFF, 0xFE, 0x6A, 0xFA, 0x19, 0xFE, 0x6F, 0xA4, 0xFC, 0xA5, 0x9F, 0x5A, 0xF9, 0x59, 0xF5, 0x9F,
+    0x6A, 0xF5, 0x9F, 0x69, 0xF9, 0x4A, 0xEA, 0x69, 0xFC, 0x92, 0xAF, 0x97, 0xFF, 0xFD, 0x70, 0x9F,
+    0xFF, 0xA7, 0x1F, 0xFF, 0x73, 0xAF, 0xFC, 0x75, 0x9F, 0xDA, 0x77, 0x19, 0x99, 0x74, 0x5A, 0xD9,
+    0x1D, 0xA6, 0xFC, 0x90, 0xAD, 0x6F, 0xD0, 0xAD, 0x59, 0xD9, 0x9F, 0xD5, 0x9D, 0x90, 0xAF, 0x96,
+    0xDA, 0x1A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x79, 0xE0, 0x9A, 0xEA, 0x94, 0x9F, 0xFF, 0x39, 0xFF,
+    0xFC, 0x2A, 0xFF, 0xFC, 0x91, 0xAF, 0xA3, 0xAF, 0x1A, 0xF5, 0xF1, 0xFA, 0x5F, 0x1F, 0x95, 0xF9,
+    0x0F, 0x95, 0xF9, 0x0F, 0xA5, 0xF9, 0x0F, 0xA5, 0xFA, 0x0F, 0xA5, 0xFA, 0x0F, 0xC4, 0x9F, 0xA9,
+    0xFC, 0x49, 0xFA, 0x9F, 0xC4, 0xAF, 0xC9, 0xFC, 0x4A, 0xFC, 0xAF, 0xC4, 0xAF, 0xC0, 0x1F, 0xA7,
+    0x4F, 0xC7, 0x4A, 0xF9, 0x73, 0xAF, 0xA7, 0x3A, 0xFC, 0x77, 0x77, 0x77, 0x74, 0x9A, 0xF9, 0x79,
+    0xFF, 0xC9, 0x49, 0xFF, 0xE9, 0x3F, 0xDA, 0xAF, 0xC2, 0xAF, 0x92, 0x9F, 0xA1, 0xFA, 0x49, 0xF1,
+    0xF6, 0xF9, 0x9F, 0x6F, 0xA9, 0xF6, 0xAE, 0xAA, 0xF6, 0xAE, 0xA9, 0xF6, 0xFA, 0x9F, 0x95, 0xFA,
+    0x0F, 0xC4, 0xFC, 0x90, 0xFF, 0xFE, 0x1A, 0xFF, 0xFC, 0xA2, 0xFF, 0xFC, 0x39, 0xFF, 0xE9, 0x49,
+    0xFF, 0xC9, 0x79, 0xFC, 0x94, 0x79, 0xE7, 0x4E, 0xA7, 0x39, 0xE7, 0x4F, 0x73, 0x9E, 0xA7, 0x3A,
+    0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xF9, 0x79, 0xFF, 0xC9, 0x49, 0xFF,
+    0xE9, 0x3F, 0xDA, 0xAF, 0xC2, 0xAF, 0x92, 0x9F, 0xA1, 0xFA, 0x49, 0xF1, 0xF6, 0xF9, 0x9F, 0x6F,
+    0xA9, 0xF6, 0xAE, 0xAA, 0xF6, 0xAE, 0xA9, 0xF6, 0xFA, 0x9F, 0x95, 0xFA, 0x0F, 0xC4, 0xFC, 0x90,
+    0xFF, 0xFE, 0x1A, 0xFF, 0xFC, 0xA2, 0xFF, 0xFC, 0x39, 0xFF, 0xE9, 0x49, 0xFF, 0xC9, 0x79, 0xFC,
+    0x94, 0x69, 0xDA, 0x74, 0xF7, 0x3A, 0xFC, 0x71, 0xAF, 0xE7, 0xAF, 0xFC, 0x5F, 0xA1, 0xAF, 0x3F,
+    0x94, 0xF2, 0x99, 0x97, 0x99, 0x97, 0x77, 0x77, 0x9A, 0xF9, 0x79, 0xFF, 0xC9, 0x49, 0xFF, 0xE9,
+    0x3F, 0xDA, 0xAF, 0xC2, 0xAF, 0x92, 0x9F, 0xA1, 0xFA, 0x49, 0xF1, 0xF6, 0xF9, 0x9F, 0x6F, 0xA9,
+    0xF6, 0xAE, 0xAA, 0xF6, 0xAE, 0xA9, 0xF6, 0xFA, 0x9F, 0x95, 0xFA, 0x0F, 0xC4, 0xFC, 0x90, 0xFF,
+    0xFE, 0x1A, 0xFF, 0xFC, 0xA2, 0xFF, 0xFC, 0x39, 0xFF, 0xE9, 0x49, 0xFF, 0xC9, 0x79, 0xFC, 0x94,
+    0x4A, 0xCA, 0x2D, 0x96, 0xFC, 0x1D, 0xA5, 0x9F, 0xD0, 0xDA, 0x5A, 0xD0, 0xFD, 0x95, 0xAD, 0x1F,
+    0xC6, 0xAD, 0x2A, 0xD9, 0x77, 0x77, 0x77, 0x73, 0x9A, 0xF9, 0x79, 0xFF, 0xC9, 0x49, 0xFF, 0xE9,
+    0x3F, 0xDA, 0xAF, 0xC2, 0xAF, 0x92, 0x9F, 0xA1, 0xFA, 0x49, 0xF1, 0xF6, 0xF9, 0x9F, 0x6F, 0xA9,
+    0xF6, 0xAE, 0xAA, 0xF6, 0xAE, 0xA9, 0xF6, 0xFA, 0x9F, 0x95, 0xFA, 0x0F, 0xC4, 0xFC, 0x90, 0xFF,
+    0xFE, 0x1A, 0xFF, 0xFC, 0xA2, 0xFF, 0xFC, 0x39, 0xFF, 0xE9, 0x49, 0xFF, 0xC9, 0x79, 0xFC, 0x94,
+    0x1A, 0xF2, 0xAF, 0x3A, 0xF2, 0xFC, 0x3F, 0xC9, 0x1F, 0xC3, 0xFC, 0x91, 0xFC, 0x92, 0xFC, 0xA0,
+    0x9F, 0xC9, 0x19, 0xFC, 0xA0, 0x9F, 0xCA, 0x29, 0x99, 0x99, 0x91, 0x99, 0x99, 0x99, 0x77, 0x77,
+    0x77, 0x70, 0x9A, 0xF9, 0x79, 0xFF, 0xC9, 0x49, 0xFF, 0xE9, 0x3F, 0xDA, 0xAF, 0xC2, 0xAF, 0x92,
+    0x9F, 0xA1, 0xFA, 0x49, 0xF1, 0xF6, 0xF9, 0x9F, 0x6F, 0xA9, 0xF6, 0xAE, 0xAA, 0xF6, 0xAE, 0xA9,
+    0xF6, 0xFA, 0x9F, 0x95, 0xFA, 0x0F, 0xC4, 0xFC, 0x90, 0xFF, 0xFE, 0x1A, 0xFF, 0xFC, 0xA2, 0xFF,
+    0xFC, 0x39, 0xFF, 0xE9, 0x49, 0xFF, 0xC9, 0x79, 0xFC, 0x94, 0x70, 0x99, 0x99, 0x77, 0x0F, 0xC7,
+    0x70, 0xFC, 0x77, 0x0F, 0xC7, 0x79, 0xFC, 0x77, 0xAF, 0xC9, 0x76, 0xAF, 0xCA, 0x77, 0x77, 0x76,
+    0x99, 0x5A, 0xAA, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x91, 0x9F, 0xFF, 0xFE, 0x1F, 0xFC, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x97, 0x77, 0x79, 0x99, 0x97, 0x70, 0xFC, 0x77, 0x0F, 0xC7, 0x70, 0xFC, 0x77,
+    0x9F, 0xC7, 0x7A, 0xFC, 0x97, 0x6A, 0xFC, 0xA7, 0x77, 0x19, 0x77, 0x9C, 0x97, 0x59, 0xE7, 0x6F,
+    0x75, 0x9E, 0xA7, 0x5A, 0xE9, 0x75, 0xF7, 0x6F, 0x75, 0xAE, 0xA7, 0x5F, 0x97, 0x5F, 0x75, 0x9E,
+    0xA7, 0x5A, 0xE9, 0x75, 0xF7, 0x59, 0xF7, 0x5A, 0xEA, 0x75, 0xF9, 0x71, 0x9A, 0xFD, 0x70, 0x9F,
+    0xFC, 0x96, 0x9F, 0xFE, 0x95, 0xFF, 0xFC, 0x4A, 0xF9, 0x9F, 0xEA, 0x3F, 0xA0, 0xAF, 0xF3, 0xF1,
+    0xFA, 0xF9, 0x19, 0xF1, 0xF0, 0xF9, 0x19, 0xF0, 0x9F, 0x0A, 0xEA, 0x1A, 0xF0, 0xAE, 0xA0, 0xAE,
+    0xA1, 0x9F, 0x0F, 0x90, 0xFA, 0x19, 0xFA, 0xF0, 0x9F, 0xA2, 0xFF, 0xC9, 0xFC, 0x92, 0xFF, 0xFE,
+    0x3A, 0xFF, 0xFC, 0xA4, 0xFF, 0xFC, 0x59, 0xFF, 0xE9, 0x69, 0xFF, 0xC9, 0x79, 0xFE, 0x97, 0x1A,
+    0xF7, 0x5F, 0xC7, 0x5F, 0xA7, 0x4A, 0xF9, 0x74, 0xFC, 0x75, 0xFA, 0x74, 0x9F, 0x97, 0x4A, 0xF7,
+    0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x75, 0xF7, 0x6D, 0xA7, 0x6A, 0xC7, 0x70, 0x97, 0x71, 0x77,
+    0x2A, 0xF7, 0x4A, 0xF9, 0x73, 0xAF, 0xA7, 0x3A, 0xFC, 0x73, 0xAF, 0xC9, 0x77, 0x77, 0x77, 0x6A,
+    0xE9, 0x6F, 0x09, 0xE9, 0x59, 0xF0, 0x9E, 0x95, 0x9F, 0x09, 0xEA, 0x59, 0xF0, 0x9E, 0xA5, 0x9F,
+    0x1E, 0xA5, 0x9F, 0x1E, 0xA5, 0x9F, 0x1F, 0x5A, 0xF1, 0xF5, 0xAF, 0x1F, 0x5F, 0xC1, 0xF9, 0x4F,
+    0xC9, 0x0F, 0xC9, 0x2A, 0xFC, 0x90, 0xAF, 0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0x91, 0xFF, 0xFD, 0x91,
+    0xAF, 0xFF, 0xC9, 0x2F, 0xFF, 0xCA, 0x39, 0xAF, 0x95, 0x77, 0x70, 0x9E, 0x74, 0xEA, 0x73, 0x9E,
+    0x74, 0xAE, 0x74, 0xEA, 0x73, 0xAE, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xAE, 0x96,
+    0xF0, 0x9E, 0x95, 0x9F, 0x09, 0xE9, 0x59, 0xF0, 0x9E, 0xA5, 0x9F, 0x09, 0xEA, 0x59, 0xF1, 0xEA,
+    0x59, 0xF1, 0xEA, 0x59, 0xF1, 0xF5, 0xAF, 0x1F, 0x5A, 0xF1, 0xF5, 0xFC, 0x1F, 0x94, 0xFC, 0x90,
+    0xFC, 0x92, 0xAF, 0xC9, 0x0A, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD9, 0x1F, 0xFF, 0xD9, 0x1A, 0xFF,
+    0xFC, 0x92, 0xFF, 0xFC, 0xA3, 0x9A, 0xF9, 0x50, 0x77, 0x79, 0xE7, 0x4F, 0x97, 0x2F, 0xD9, 0x70,
+    0xFF, 0x96, 0xFA, 0xAF, 0x94, 0xF9, 0x2F, 0x92, 0xF5, 0xAE, 0x97, 0x77, 0x77, 0x72, 0xAE, 0x96,
+    0xF0, 0x9E, 0x95, 0x9F, 0x09, 0xE9, 0x59, 0xF0, 0x9E, 0xA5, 0x9F, 0x09, 0xEA, 0x59, 0xF1, 0xEA,
+    0x59, 0xF1, 0xEA, 0x59, 0xF1, 0xF5, 0xAF, 0x1F, 0x5A, 0xF1, 0xF5, 0xFC, 0x1F, 0x94, 0xFC, 0x90,
+    0xFC, 0x92, 0xAF, 0xC9, 0x0A, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD9, 0x1F, 0xFF, 0xD9, 0x1A, 0xFF,
+    0xFC, 0x92, 0xFF, 0xFC, 0xA3, 0x9A, 0xF9, 0x50, 0x29, 0x99, 0x93, 0x99, 0x99, 0x3A, 0xF2, 0xAF,
+    0x3A, 0xF2, 0xFC, 0x3F, 0xC9, 0x1F, 0xC9, 0x2F, 0xCA, 0x1F, 0xC9, 0x2F, 0xCA, 0x09, 0xFC, 0xA1,
+    0x9F, 0xD0, 0xAF, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xE9, 0x6F, 0x09, 0xE9, 0x59, 0xF0, 0x9E,
+    0x95, 0x9F, 0x09, 0xEA, 0x59, 0xF0, 0x9E, 0xA5, 0x9F, 0x1E, 0xA5, 0x9F, 0x1E, 0xA5, 0x9F, 0x1F,
+    0x5A, 0xF1, 0xF5, 0xAF, 0x1F, 0x5F, 0xC1, 0xF9, 0x4F, 0xC9, 0x0F, 0xC9, 0x2A, 0xFC, 0x90, 0xAF,
+    0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0x91, 0xFF, 0xFD, 0x91, 0xAF, 0xFF, 0xC9, 0x2F, 0xFF, 0xCA, 0x39,
+    0xAF, 0x95, 0x77, 0x74, 0xE9, 0x75, 0x9E, 0x76, 0xAD, 0xA7, 0x6E, 0x97, 0x5A, 0xE7, 0x6F, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xF9, 0x7F, 0x90,
+    0xFC, 0x69, 0xF1, 0x9F, 0xA5, 0xAE, 0xA2, 0xFC, 0x5F, 0x93, 0xFC, 0x39, 0xF4, 0xAF, 0x92, 0xAE,
+    0xA5, 0xFC, 0x2F, 0x95, 0xAF, 0xA0, 0x9F, 0x7F, 0xC0, 0xAE, 0xA7, 0xAF, 0xFC, 0x97, 0x0F, 0xFC,
+    0x71, 0xAF, 0xEA, 0x72, 0xFE, 0x97, 0x2A, 0xFD, 0x74, 0xFC, 0xA7, 0x4A, 0xF9, 0x74, 0xAF, 0x74,
+    0x9F, 0xA7, 0x3A, 0xFC, 0x97, 0xFF, 0xD7, 0x0F, 0xFC, 0x97, 0x0F, 0xFA, 0x71, 0xFE, 0xA7, 0x2F,
+    0xCA, 0x77, 0x75, 0x75, 0x9E, 0xA7, 0x09, 0xEA, 0x70, 0x9E, 0xA7, 0x09, 0xEA, 0x70, 0x9F, 0x70,
+    0x9F, 0xDA, 0x59, 0xFF, 0xA3, 0x9F, 0xFD, 0x29, 0xFA, 0xFD, 0x19, 0xF1, 0xAF, 0xA0, 0x9F, 0x2A,
+    0xF0, 0x9F, 0x3A, 0xEA, 0x9F, 0x4E, 0xA9, 0xF4, 0xEA, 0x0F, 0x4E, 0xA0, 0xF3, 0xAE, 0x90, 0xF2,
+    0x9F, 0x1F, 0x2F, 0xA1, 0xF0, 0x9F, 0xC2, 0xFF, 0xD9, 0x2F, 0xFC, 0x93, 0xFF, 0x94, 0xFD, 0x96,
+    0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x71, 0xF7, 0x00, 0x3F, 0xA2, 0xFA, 0x5F, 0xA2,
+    0xFA, 0x49, 0xFC, 0x19, 0xFC, 0x49, 0xFC, 0x1A, 0xFC, 0x4A, 0xFC, 0x1A, 0xFC, 0x4F, 0xD9, 0x0F,
+    0xD4, 0x99, 0x99, 0x99, 0x19, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76,
+    0x9F, 0x97, 0xF9, 0x0F, 0xC6, 0x9F, 0x19, 0xFA, 0x5A, 0xEA, 0x2F, 0xC5, 0xF9, 0x3F, 0xC3, 0x9F,
+    0x4A, 0xF9, 0x2A, 0xEA, 0x5F, 0xC2, 0xF9, 0x5A, 0xFA, 0x09, 0xF7, 0xFC, 0x0A, 0xEA, 0x7A, 0xFF,
+    0xC9, 0x70, 0xFF, 0xC7, 0x1A, 0xFE, 0xA7, 0x2F, 0xE9, 0x72, 0xAF, 0xD7, 0x4F, 0xCA, 0x74, 0xAF,
+    0x97, 0x4A, 0xF7, 0x49, 0xFA, 0x73, 0xAF, 0xC9, 0x7F, 0xFD, 0x70, 0xFF, 0xC9, 0x70, 0xFF, 0xA7,
+    0x1F, 0xEA, 0x72, 0xFC, 0xA7, 0x77, 0x50, 0x77, 0x09, 0x74, 0xAA, 0xAF, 0xFC, 0x97, 0x2A, 0xFF,
+    0xFC, 0x72, 0xFF, 0xFD, 0x71, 0xAF, 0xFA, 0xAA, 0xAA, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x4F, 0x97, 0x72, 0x9F, 0xC7, 0x72, 0xFD, 0x77, 0x2F, 0xDA, 0x77, 0x0A, 0xFE, 0x77,
+    0x0F, 0xF9, 0x76, 0x9F, 0xAF, 0x76, 0xFA, 0x0F, 0x76, 0xF9, 0x0F, 0xA7, 0x4A, 0xF1, 0xAF, 0x74,
+    0xFA, 0x19, 0xF9, 0x72, 0x9F, 0x92, 0xFC, 0x72, 0xFC, 0x3A, 0xF7, 0x2F, 0xC3, 0x9F, 0xA7, 0x0A,
+    0xF9, 0x4F, 0xC7, 0x0F, 0xCA, 0x99, 0x99, 0x9F, 0xC9, 0x69, 0xFF, 0xFF, 0xA6, 0xAF, 0xFF, 0xFC,
+    0x6F, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xFE, 0x4F, 0xFF, 0xFF, 0x92, 0x9F, 0xCA, 0x70, 0xFC, 0xA2,
+    0xAF, 0xC7, 0x1F, 0xD2, 0xFD, 0x71, 0xAF, 0xC9, 0x09, 0xFC, 0xA7, 0x19, 0xFD, 0x00, 0x77, 0x29,
+    0xAA, 0xAA, 0xFE, 0xA2, 0x9F, 0xFF, 0xC2, 0xFF, 0xFD, 0x90, 0x9F, 0xFE, 0xAA, 0xA9, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xEA, 0x71, 0xAF, 0xFD, 0xA3, 0x9F, 0xFE, 0xA3, 0xFA, 0x9A,
+    0xFD, 0x29, 0xE9, 0x3F, 0xC2, 0xEA, 0x49, 0xF2, 0xE9, 0x5F, 0x2E, 0x6A, 0xE9, 0x09, 0xDA, 0x6A,
+    0xE9, 0x0A, 0xDA, 0x69, 0xEA, 0x09, 0xD9, 0x69, 0xEA, 0x09, 0xDA, 0x6A, 0xF0, 0x9E, 0xA9, 0x99,
+    0x9A, 0xFD, 0x1F, 0xFF, 0xE1, 0xAF, 0xFF, 0xD2, 0xFF, 0xFD, 0x91, 0x9F, 0xFA, 0xF9, 0x3A, 0xFA,
+    0x95, 0x5A, 0xAA, 0x99, 0x3A, 0xAA, 0xA7, 0x3F, 0x39, 0xEA, 0x73, 0xFF, 0xF9, 0x73, 0xAF, 0xFD,
+    0xA7, 0x5A, 0xFF, 0xC7, 0x79, 0xAF, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6F, 0x97,
+    0x72, 0x9F, 0xC7, 0x72, 0xFD, 0x77, 0x2F, 0xDA, 0x77, 0x0A, 0xFE, 0x77, 0x0F, 0xF9, 0x76, 0x9F,
+    0xAF, 0x76, 0xFA, 0x0F, 0x76, 0xF9, 0x0F, 0xA7, 0x4A, 0xF1, 0xAF, 0x74, 0xFA, 0x19, 0xF9, 0x72,
+    0x9F, 0x92, 0xFC, 0x72, 0xFC, 0x3A, 0xF7, 0x2F, 0xC3, 0x9F, 0xA7, 0x0A, 0xF9, 0x4F, 0xC7, 0x0F,
+    0xCA, 0x99, 0x99, 0x9F, 0xC9, 0x69, 0xFF, 0xFF, 0xA6, 0xAF, 0xFF, 0xFC, 0x6F, 0xFF, 0xFD, 0xA4,
+    0xAF, 0xFF, 0xFE, 0x4F, 0xFF, 0xFF, 0x92, 0x9F, 0xCA, 0x70, 0xFC, 0xA2, 0xAF, 0xC7, 0x1F, 0xD2,
+    0xFD, 0x71, 0xAF, 0xC9, 0x09, 0xFC, 0xA7, 0x19, 0xFD, 0x00, 0x1A, 0xAA, 0xA9, 0x39, 0xAA, 0xA3,
+    0xF9, 0x29, 0xF3, 0xFF, 0xFA, 0x39, 0xFF, 0xE5, 0xAF, 0xFC, 0x70, 0xAF, 0xA9, 0x77, 0x77, 0x77,
+    0x77, 0x74, 0x9A, 0xEA, 0x71, 0xAF, 0xFD, 0xA3, 0x9F, 0xFE, 0xA3, 0xFA, 0x9A, 0xFD, 0x29, 0xE9,
+    0x3F, 0xC2, 0xEA, 0x49, 0xF2, 0xE9, 0x5F, 0x2E, 0x6A, 0xE9, 0x09, 0xDA, 0x6A, 0xE9, 0x0A, 0xDA,
+    0x69, 0xEA, 0x09, 0xD9, 0x69, 0xEA, 0x09, 0xDA, 0x6A, 0xF0, 0x9E, 0xA9, 0x99, 0x9A, 0xFD, 0x1F,
+    0xFF, 0xE1, 0xAF, 0xFF, 0xD2, 0xFF, 0xFD, 0x91, 0x9F, 0xFA, 0xF9, 0x3A, 0xFA, 0x95, 0x71, 0xF9,
+    0x77, 0x29, 0xFC, 0x77, 0x2F, 0xD7, 0x72, 0xFD, 0xA7, 0x70, 0xAF, 0xE7, 0x70, 0xFF, 0x97, 0x69,
+    0xFA, 0xF7, 0x6F, 0xA0, 0xF7, 0x6F, 0x90, 0xFA, 0x74, 0xAF, 0x1A, 0xF7, 0x4F, 0xA1, 0x9F, 0x97,
+    0x29, 0xF9, 0x2F, 0xC7, 0x2F, 0xC3, 0xAF, 0x72, 0xFC, 0x39, 0xFA, 0x70, 0xAF, 0x94, 0xFC, 0x70,
+    0xFC, 0xA9, 0x99, 0x99, 0xFC, 0x96, 0x9F, 0xFF, 0xFA, 0x6A, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0xDA,
+    0x4A, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xF9, 0x29, 0xFC, 0xA7, 0x0F, 0xCA, 0x2A, 0xFC, 0x71, 0xFD,
+    0x2F, 0xD7, 0x1A, 0xFC, 0x90, 0x9F, 0xCA, 0x71, 0x9F, 0xD7, 0x71, 0x9F, 0x77, 0x3F, 0x77, 0x39,
+    0xE9, 0x77, 0x39, 0xFE, 0x77, 0x1F, 0xE7, 0x71, 0x9F, 0xD7, 0x73, 0xAE, 0xA7, 0x77, 0x10, 0x77,
+    0x69, 0xAE, 0xA7, 0x3A, 0xFF, 0xDA, 0x59, 0xFF, 0xEA, 0x5F, 0xA9, 0xAF, 0xD4, 0x9E, 0x93, 0xFC,
+    0x4E, 0xA4, 0x9F, 0x4E, 0x95, 0xF4, 0xE6, 0xAE, 0x92, 0x9D, 0xA6, 0xAE, 0x92, 0xAD, 0xA6, 0x9E,
+    0xA2, 0x9D, 0x96, 0x9E, 0xA2, 0x9D, 0xA6, 0xAF, 0x29, 0xEA, 0x99, 0x99, 0xAF, 0xD3, 0xFF, 0xFE,
+    0x3A, 0xFF, 0xFD, 0x4F, 0xFF, 0xD4, 0x9F, 0xFA, 0xF9, 0x5A, 0xFA, 0x90, 0x9F, 0x75, 0xFA, 0x74,
+    0xFA, 0x74, 0x9E, 0xA7, 0x5A, 0xE7, 0x6A, 0xFE, 0x73, 0xFE, 0x73, 0x9F, 0xD7, 0x59, 0xAD, 0xA0,
+    0x73, 0xAD, 0x97, 0x71, 0xE7, 0x71, 0xAE, 0x77, 0x1E, 0x97, 0x70, 0xAE, 0x77, 0x1F, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xFD, 0xAA, 0x97, 0x09, 0xFF, 0xF7, 0xFF, 0xFD, 0x6F, 0xFF,
+    0xDA, 0x5F, 0xFF, 0xE9, 0x4A, 0xFF, 0xAA, 0xAA, 0xAD, 0x94, 0xFE, 0x97, 0x4A, 0xFD, 0x76, 0xFD,
+    0x76, 0x9F, 0xCA, 0x76, 0xAF, 0xC9, 0x76, 0xFD, 0x77, 0xFD, 0x77, 0xFD, 0x77, 0xFD, 0x77, 0xFD,
+    0x77, 0xFD, 0xA7, 0x6F, 0xE9, 0x75, 0xFF, 0xC9, 0x92, 0x99, 0xAC, 0x92, 0x9F, 0xFF, 0xFC, 0x93,
+    0xFF, 0xFF, 0xC9, 0x3A, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0xA5, 0xFF, 0xFE, 0xA6, 0xFF, 0xFD, 0xA7,
+    0x9F, 0xFF, 0xA0, 0x69, 0xE7, 0x2E, 0xA7, 0x2E, 0x72, 0xAE, 0x72, 0xEA, 0x71, 0xAE, 0x77, 0x77,
+    0x70, 0x9A, 0xFA, 0x94, 0x9F, 0xFA, 0x39, 0xFF, 0xCA, 0x3F, 0xFD, 0xA2, 0xAF, 0x97, 0x0F, 0x97,
+    0x09, 0xF7, 0x19, 0xF7, 0x1A, 0xF7, 0x1A, 0xF7, 0x19, 0xF9, 0x70, 0x9F, 0xC7, 0x1F, 0xCA, 0x19,
+    0xCA, 0x3A, 0xFF, 0xD9, 0x3F, 0xFE, 0x93, 0xAF, 0xFD, 0x5A, 0xFC, 0xA9, 0x10, 0x77, 0x77, 0x9E,
+    0x77, 0x1F, 0xA7, 0x7F, 0xD9, 0x75, 0xFF, 0x97, 0x3F, 0xCA, 0xF9, 0x71, 0xF9, 0x2F, 0x97, 0xF5,
+    0xAE, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9A, 0xFD, 0xAA, 0x97, 0x09, 0xFF, 0xF7, 0xFF,
+    0xFD, 0x6F, 0xFF, 0xDA, 0x5F, 0xFF, 0xE9, 0x4A, 0xFF, 0xAA, 0xAA, 0xAD, 0x94, 0xFE, 0x97, 0x4A,
+    0xFD, 0x76, 0xFD, 0x76, 0x9F, 0xCA, 0x76, 0xAF, 0xC9, 0x76, 0xFD, 0x77, 0xFD, 0x77, 0xFD, 0x77,
+    0xFD, 0x77, 0xFD, 0x77, 0xFD, 0xA7, 0x6F, 0xE9, 0x75, 0xFF, 0xC9, 0x92, 0x99, 0xAC, 0x92, 0x9F,
+    0xFF, 0xFC, 0x93, 0xFF, 0xFF, 0xC9, 0x3A, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0xA5, 0xFF, 0xFE, 0xA6,
+    0xFF, 0xFD, 0xA7, 0x9F, 0xFF, 0xA0, 0x77, 0x7E, 0x97, 0x3A, 0xF7, 0x29, 0xFC, 0xA7, 0x09, 0xFE,
+    0xA6, 0xAF, 0x9F, 0xC4, 0xAE, 0xA2, 0xAF, 0x2A, 0xE9, 0x49, 0xF7, 0x77, 0x77, 0x09, 0xAF, 0xA9,
+    0x69, 0xFF, 0xA5, 0x9F, 0xFC, 0xA5, 0xFF, 0xDA, 0x4A, 0xF9, 0x72, 0xF9, 0x72, 0x9F, 0x73, 0x9F,
+    0x73, 0xAF, 0x73, 0xAF, 0x73, 0x9F, 0x97, 0x29, 0xFC, 0x73, 0xFC, 0xA1, 0x9C, 0xA5, 0xAF, 0xFD,
+    0x95, 0xFF, 0xE9, 0x5A, 0xFF, 0xD7, 0xAF, 0xCA, 0x92, 0x71, 0xAF, 0x77, 0x0F, 0xC7, 0x70, 0xFC,
+    0x77, 0x0F, 0xC9, 0x76, 0x9F, 0xC9, 0x76, 0xAF, 0xCA, 0x76, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x71, 0x9A, 0xFD, 0xAA, 0x97, 0x09, 0xFF, 0xF7, 0xFF, 0xFD, 0x6F, 0xFF, 0xDA, 0x5F,
+    0xFF, 0xE9, 0x4A, 0xFF, 0xAA, 0xAA, 0xAD, 0x94, 0xFE, 0x97, 0x4A, 0xFD, 0x76, 0xFD, 0x76, 0x9F,
+    0xCA, 0x76, 0xAF, 0xC9, 0x76, 0xFD, 0x77, 0xFD, 0x77, 0xFD, 0x77, 0xFD, 0x77, 0xFD, 0x77, 0xFD,
+    0xA7, 0x6F, 0xE9, 0x75, 0xFF, 0xC9, 0x92, 0x99, 0xAC, 0x92, 0x9F, 0xFF, 0xFC, 0x93, 0xFF, 0xFF,
+    0xC9, 0x3A, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0xA5, 0xFF, 0xFE, 0xA6, 0xFF, 0xFD, 0xA7, 0x9F, 0xFF,
+    0xA0, 0x59, 0x99, 0x97, 0x19, 0xF9, 0x70, 0x9F, 0x97, 0x0A, 0xFA, 0x70, 0xFC, 0xA7, 0x0F, 0xD7,
+    0x0F, 0xD7, 0x77, 0x76, 0x9A, 0xFA, 0x94, 0x9F, 0xFA, 0x39, 0xFF, 0xCA, 0x3F, 0xFD, 0xA2, 0xAF,
+    0x97, 0x0F, 0x97, 0x09, 0xF7, 0x19, 0xF7, 0x1A, 0xF7, 0x1A, 0xF7, 0x19, 0xF9, 0x70, 0x9F, 0xC7,
+    0x1F, 0xCA, 0x19, 0xCA, 0x3A, 0xFF, 0xD9, 0x3F, 0xFE, 0x93, 0xAF, 0xFD, 0x5A, 0xFC, 0xA9, 0x10,
+    0x4A, 0xE9, 0x49, 0xEA, 0x7A, 0xEA, 0x2A, 0xEA, 0x71, 0xAF, 0x9F, 0xA7, 0x3A, 0xFE, 0xA7, 0x5A,
+    0xFC, 0xA7, 0x7A, 0xF7, 0x71, 0xE7, 0x73, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0xAF,
+    0xDA, 0xA9, 0x70, 0x9F, 0xFF, 0x7F, 0xFF, 0xD6, 0xFF, 0xFD, 0xA5, 0xFF, 0xFE, 0x94, 0xAF, 0xFA,
+    0xAA, 0xAA, 0xD9, 0x4F, 0xE9, 0x74, 0xAF, 0xD7, 0x6F, 0xD7, 0x69, 0xFC, 0xA7, 0x6A, 0xFC, 0x97,
+    0x6F, 0xD7, 0x7F, 0xD7, 0x7F, 0xD7, 0x7F, 0xD7, 0x7F, 0xD7, 0x7F, 0xDA, 0x76, 0xFE, 0x97, 0x5F,
+    0xFC, 0x99, 0x29, 0x9A, 0xC9, 0x29, 0xFF, 0xFF, 0xC9, 0x3F, 0xFF, 0xFC, 0x93, 0xAF, 0xFF, 0xF9,
+    0x4F, 0xFF, 0xFA, 0x5F, 0xFF, 0xEA, 0x6F, 0xFF, 0xDA, 0x79, 0xFF, 0xFA, 0x00, 0x77, 0x9E, 0xA5,
+    0xF2, 0xF9, 0x19, 0xF4, 0xFA, 0xFC, 0x6F, 0xF7, 0x0F, 0xD7, 0x19, 0xF7, 0x3A, 0xDA, 0x77, 0x77,
+    0x77, 0x72, 0x9A, 0xFA, 0x95, 0x9F, 0xFA, 0x49, 0xFF, 0xCA, 0x4F, 0xFD, 0xA3, 0xAF, 0x97, 0x1F,
+    0x97, 0x19, 0xF7, 0x29, 0xF7, 0x2A, 0xF7, 0x2A, 0xF7, 0x29, 0xF9, 0x71, 0x9F, 0xC7, 0x2F, 0xCA,
+    0x19, 0xCA, 0x4A, 0xFF, 0xD9, 0x4F, 0xFE, 0x94, 0xAF, 0xFD, 0x6A, 0xFC, 0xA9, 0x20, 0x29, 0x99,
+    0x79, 0x99, 0x7A, 0xE9, 0x4F, 0x70, 0xAF, 0x19, 0xF7, 0x2A, 0xFF, 0xC7, 0x4A, 0xFE, 0x76, 0xAF,
+    0xC7, 0x70, 0xF9, 0x77, 0x1D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9F, 0xFE, 0xA9, 0x79,
+    0xFF, 0xFD, 0xA9, 0x49, 0xFF, 0xFF, 0xA3, 0x9F, 0xFF, 0xFD, 0x29, 0xFF, 0xFF, 0xE1, 0x9F, 0xC5,
+    0x9F, 0xE9, 0x09, 0xFC, 0x79, 0xFD, 0x09, 0xFC, 0x71, 0xFC, 0x09, 0xFC, 0x71, 0x9F, 0x99, 0xFC,
+    0x72, 0xFA, 0x9F, 0xC7, 0x2A, 0xF9, 0xFC, 0x72, 0xAF, 0x9F, 0xC7, 0x2A, 0xF9, 0xFC, 0x72, 0xFC,
+    0x9F, 0xC7, 0x2F, 0xC9, 0xFC, 0x71, 0x9F, 0xA9, 0xFC, 0x70, 0x9F, 0xCA, 0x9F, 0xC4, 0x99, 0xAF,
+    0xE9, 0x9F, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0xF0, 0x9F, 0xFF, 0xFE, 0x90, 0x9F, 0xFF, 0xFE, 0x19,
+    0xFF, 0xFF, 0xD2, 0x9F, 0xFF, 0xFA, 0x39, 0xFF, 0xFA, 0xA9, 0x50, 0x74, 0xF9, 0x77, 0x1F, 0x77,
+    0x2F, 0x1F, 0x74, 0xF1, 0xEA, 0x74, 0xF0, 0x9E, 0xA7, 0x4F, 0x09, 0xEA, 0x74, 0xF0, 0xAE, 0xA7,
+    0x4F, 0x0A, 0xEA, 0x49, 0xEA, 0x90, 0x9F, 0x0F, 0x93, 0xFF, 0xFC, 0x0F, 0x92, 0xFF, 0xFD, 0x7F,
+    0xFF, 0xDA, 0x69, 0xF9, 0x1A, 0xFD, 0xA6, 0xF9, 0x3A, 0xFC, 0xA6, 0xF5, 0xFC, 0xA5, 0x9E, 0x95,
+    0xFC, 0xA5, 0xAE, 0x95, 0xAF, 0x95, 0x9E, 0x95, 0xAF, 0x95, 0x9E, 0x95, 0xFC, 0x96, 0xF4, 0x9F,
+    0xC9, 0x6F, 0xCA, 0xAA, 0xAF, 0xDA, 0x6A, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xAF, 0xFF, 0xCA,
+    0x70, 0xAF, 0xFA, 0xEA, 0x72, 0xAF, 0x97, 0x30, 0x49, 0xFF, 0xEA, 0x97, 0x49, 0xFF, 0xFD, 0xA9,
+    0x71, 0x9F, 0xFF, 0xFA, 0x70, 0x9F, 0xFF, 0xFD, 0x79, 0xFF, 0xFF, 0xE6, 0x9F, 0xC5, 0x9F, 0xE9,
+    0x59, 0xFC, 0x79, 0xFD, 0x59, 0xFC, 0x71, 0xFC, 0x59, 0xFC, 0x71, 0x9F, 0x94, 0x9F, 0xC7, 0x2F,
+    0xA4, 0x9F, 0xC7, 0x2F, 0xC0, 0x99, 0x99, 0xAF, 0xC9, 0x99, 0x99, 0x5A, 0xF0, 0xFF, 0xFD, 0xA5,
+    0xAF, 0x0F, 0xFF, 0xDA, 0x5F, 0xC0, 0xFF, 0xFD, 0xA5, 0xFC, 0x49, 0xFC, 0x71, 0x9F, 0xA4, 0x9F,
+    0xC7, 0x09, 0xFC, 0xA4, 0x9F, 0xC4, 0x99, 0xAF, 0xE9, 0x49, 0xFF, 0xFF, 0xF5, 0x9F, 0xFF, 0xFF,
+    0x59, 0xFF, 0xFF, 0xE9, 0x59, 0xFF, 0xFF, 0xE6, 0x9F, 0xFF, 0xFD, 0x79, 0xFF, 0xFF, 0xA7, 0x09,
+    0xFF, 0xFA, 0xA9, 0x50, 0x74, 0xF9, 0x77, 0x0F, 0x77, 0x1F, 0x73, 0xFF, 0xFE, 0x6F, 0xFF, 0xE6,
+    0xFF, 0xFE, 0x69, 0x99, 0x99, 0x9F, 0x99, 0x99, 0x97, 0x4F, 0x71, 0x9E, 0xA9, 0x09, 0xF7, 0x0F,
+    0xFF, 0xC7, 0xFF, 0xFD, 0x6F, 0xFF, 0xDA, 0x59, 0xF9, 0x1A, 0xFD, 0xA5, 0xF9, 0x3A, 0xFC, 0xA5,
+    0xF5, 0xFC, 0xA4, 0x9E, 0x95, 0xFC, 0xA4, 0xAE, 0x95, 0xAF, 0x94, 0x9E, 0x95, 0xAF, 0x94, 0x9E,
+    0x95, 0xFC, 0x95, 0xF4, 0x9F, 0xC9, 0x5F, 0xCA, 0xAA, 0xAF, 0xDA, 0x5A, 0xFF, 0xFD, 0xA6, 0xFF,
+    0xFD, 0xA6, 0xAF, 0xFF, 0xCA, 0x7A, 0xFF, 0xAE, 0xA7, 0x1A, 0xF9, 0x72, 0x74, 0x99, 0x6A, 0xFF,
+    0xE9, 0x4A, 0xFF, 0xFC, 0x4F, 0xFF, 0xD3, 0xAF, 0xDA, 0xAA, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x76, 0x9A, 0xAA, 0xAA, 0xAA, 0xFE, 0x91, 0x9F, 0xFF, 0xE2, 0xAF, 0xFF, 0xE2,
+    0xAF, 0xFF, 0xDA, 0x2A, 0xFA, 0xA9, 0x99, 0x99, 0x6A, 0xF7, 0x5A, 0xF7, 0x5A, 0xF7, 0x5A, 0xF7,
+    0x5A, 0xF9, 0x99, 0x99, 0x9A, 0xA5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5,
+    0xFC, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xCA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2F,
+    0xFF, 0xF2, 0xFF, 0xFF, 0x2F, 0xFF, 0xF9, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF, 0xFA, 0x09, 0xFF, 0xFF,
+    0xC0, 0x77, 0x29, 0x9A, 0xAA, 0xAA, 0xFC, 0xA3, 0xFF, 0xFC, 0x2A, 0xFF, 0xFC, 0x91, 0xFF, 0xFD,
+    0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0xAE, 0xA9, 0x70, 0xAF, 0xF6,
+    0xFF, 0xE9, 0x3F, 0xC9, 0x19, 0xF2, 0x9F, 0x5E, 0x91, 0xFA, 0xAA, 0xAA, 0xAF, 0xC1, 0xFF, 0xFE,
+    0x09, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x9A, 0xFA, 0x99, 0x99, 0x69, 0xF7, 0x39, 0xF9, 0x73, 0xFD,
+    0x95, 0xAC, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC4, 0xFF, 0xEA, 0x59, 0xAF, 0xCA,
+    0x92, 0x2A, 0xAA, 0xA9, 0x3A, 0xAA, 0xA5, 0xF3, 0x9F, 0x5F, 0xFF, 0x95, 0x9F, 0xFE, 0x7A, 0xFF,
+    0xC7, 0x2A, 0xFA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xAA, 0xAA, 0xAA, 0xFE, 0x91,
+    0x9F, 0xFF, 0xE2, 0xAF, 0xFF, 0xE2, 0xAF, 0xFF, 0xDA, 0x2A, 0xFA, 0xA9, 0x99, 0x99, 0x6A, 0xF7,
+    0x5A, 0xF7, 0x5A, 0xF7, 0x5A, 0xF7, 0x5A, 0xF9, 0x99, 0x99, 0x9A, 0xA5, 0xFF, 0xFC, 0x5F, 0xFF,
+    0xC5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFC, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xCA,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x2F, 0xFF, 0xF9, 0x1F, 0xFF, 0xFA,
+    0x1F, 0xFF, 0xFA, 0x09, 0xFF, 0xFF, 0xC0, 0x59, 0x97, 0x2F, 0x93, 0xAE, 0x3F, 0xFF, 0xC3, 0xAF,
+    0xFE, 0xA4, 0xFF, 0xE6, 0xFF, 0xA7, 0x09, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x71, 0x9A, 0xEA, 0x97, 0x0A, 0xFF, 0x6F, 0xFE, 0x93, 0xFC, 0x91, 0x9F, 0x29, 0xF5, 0xE9,
+    0x1F, 0xAA, 0xAA, 0xAA, 0xFC, 0x1F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0xAF, 0xA9,
+    0x99, 0x96, 0x9F, 0x73, 0x9F, 0x97, 0x3F, 0xD9, 0x5A, 0xC1, 0xAF, 0xFF, 0xD2, 0xFF, 0xFD, 0x29,
+    0xFF, 0xFC, 0x4F, 0xFE, 0xA5, 0x9A, 0xFC, 0xA9, 0x20, 0x6F, 0xA7, 0x5F, 0xC7, 0x5F, 0xC7, 0x49,
+    0xFC, 0x74, 0xAF, 0xC7, 0x4F, 0xD9, 0x73, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x49,
+    0xAA, 0xAA, 0xAA, 0xAF, 0xE9, 0x19, 0xFF, 0xFE, 0x2A, 0xFF, 0xFE, 0x2A, 0xFF, 0xFD, 0xA2, 0xAF,
+    0xAA, 0x99, 0x99, 0x96, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x99, 0x99, 0x99,
+    0xAA, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xC9, 0x74, 0xFC, 0x75,
+    0xFC, 0x75, 0xFC, 0x75, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFF, 0x2F, 0xFF, 0xF2,
+    0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0xA1, 0xFF, 0xFF, 0xA0, 0x9F, 0xFF, 0xFC, 0x00, 0x5A, 0xF7, 0x3A,
+    0xF7, 0x3F, 0xC7, 0x3F, 0xC9, 0x71, 0x9F, 0xCA, 0x71, 0x9F, 0xCA, 0x72, 0x99, 0x99, 0x99, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAE, 0xA9, 0x70, 0xAF, 0xF6, 0xFF, 0xE9, 0x3F,
+    0xC9, 0x19, 0xF2, 0x9F, 0x5E, 0x91, 0xFA, 0xAA, 0xAA, 0xAF, 0xC1, 0xFF, 0xFE, 0x09, 0xFF, 0xFE,
+    0x99, 0xFF, 0xFE, 0x9A, 0xFA, 0x99, 0x99, 0x69, 0xF7, 0x39, 0xF9, 0x73, 0xFD, 0x95, 0xAC, 0x1A,
+    0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC4, 0xFF, 0xEA, 0x59, 0xAF, 0xCA, 0x92, 0x19, 0xAA,
+    0xAA, 0xAA, 0xAF, 0xE9, 0x19, 0xFF, 0xFE, 0x2A, 0xFF, 0xFE, 0x2A, 0xFF, 0xFD, 0xA2, 0xAF, 0xAA,
+    0x99, 0x99, 0x96, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x99, 0x99, 0x99, 0xAA,
+    0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xC9, 0x74, 0xFC, 0x75, 0xFC,
+    0x75, 0xFC, 0x75, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFF, 0x2F, 0xFF, 0xF2, 0xFF,
+    0xFF, 0x91, 0xFF, 0xFF, 0xA1, 0xFF, 0xFF, 0xA0, 0x9F, 0xFF, 0xFC, 0x6E, 0xA7, 0x5E, 0xA7, 0x59,
+    0xE7, 0x69, 0xFD, 0x74, 0xFD, 0x75, 0xFC, 0x97, 0x69, 0x99, 0x70, 0x49, 0xAE, 0xA9, 0x70, 0xAF,
+    0xF6, 0xFF, 0xE9, 0x3F, 0xC9, 0x19, 0xF2, 0x9F, 0x5E, 0x91, 0xFA, 0xAA, 0xAA, 0xAF, 0xC1, 0xFF,
+    0xFE, 0x09, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x9A, 0xFA, 0x99, 0x99, 0x69, 0xF7, 0x39, 0xF9, 0x73,
+    0xFD, 0x95, 0xAC, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC4, 0xFF, 0xEA, 0x59, 0xAF,
+    0xCA, 0x97, 0x77, 0x49, 0x97, 0x5E, 0x97, 0x3F, 0x73, 0xAE, 0x74, 0xE9, 0x73, 0x9E, 0xAA, 0xA7,
+    0x2F, 0xD7, 0x2A, 0xFC, 0x97, 0x29, 0xAE, 0x77, 0x50, 0x1E, 0xA5, 0x9E, 0x94, 0xF9, 0x2A, 0xEA,
+    0x6F, 0xA9, 0xFA, 0x70, 0xFF, 0xA7, 0x2F, 0xDA, 0x74, 0xFA, 0x75, 0x9E, 0x77, 0x99, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAA, 0xAA, 0xAA, 0xAF, 0xE9, 0x19, 0xFF, 0xFE, 0x2A, 0xFF,
+    0xFE, 0x2A, 0xFF, 0xFD, 0xA2, 0xAF, 0xAA, 0x99, 0x99, 0x96, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75,
+    0xAF, 0x75, 0xAF, 0x99, 0x99, 0x99, 0xAA, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFF,
+    0xFC, 0x5F, 0xC9, 0x74, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0x99,
+    0x92, 0xFF, 0xFF, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0xA1, 0xFF, 0xFF, 0xA0, 0x9F,
+    0xFF, 0xFC, 0x00, 0x09, 0xAA, 0xA6, 0x9A, 0xAA, 0x2F, 0x93, 0xF9, 0x3F, 0xA0, 0x9F, 0x95, 0xFF,
+    0xC9, 0x7F, 0xE7, 0x2F, 0xC7, 0x4E, 0xA7, 0x49, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x39, 0xAE, 0xA9, 0x70, 0xAF, 0xF6, 0xFF, 0xE9, 0x3F, 0xC9, 0x19, 0xF2, 0x9F, 0x5E,
+    0x91, 0xFA, 0xAA, 0xAA, 0xAF, 0xC1, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x9A, 0xFA,
+    0x99, 0x99, 0x69, 0xF7, 0x39, 0xF9, 0x73, 0xFD, 0x95, 0xAC, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2,
+    0x9F, 0xFF, 0xC4, 0xFF, 0xEA, 0x59, 0xAF, 0xCA, 0x92, 0x73, 0xE7, 0x75, 0xAE, 0xA7, 0x73, 0x9F,
+    0xC9, 0x77, 0x19, 0xFE, 0x97, 0x79, 0xFA, 0xF9, 0x75, 0x9F, 0x19, 0xF9, 0x73, 0x9E, 0xA4, 0xAE,
+    0x97, 0x29, 0x99, 0x70, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x19, 0xAA, 0xAD, 0xAA, 0xA9, 0x99, 0x72, 0x9F, 0xFF, 0xD7, 0x09, 0xFF, 0xFF, 0x79, 0xFF, 0xFF,
+    0xC9, 0x6F, 0xFF, 0xFD, 0x95, 0xFF, 0xA9, 0x59, 0xAA, 0x95, 0xFD, 0xA7, 0x71, 0xAF, 0xD7, 0x72,
+    0xFD, 0x97, 0x72, 0xFD, 0x77, 0x3F, 0xCA, 0x77, 0x3F, 0xCA, 0x77, 0x3F, 0xCA, 0x59, 0xAA, 0x99,
+    0x79, 0xFC, 0xA5, 0x9F, 0xFA, 0xA2, 0xFC, 0xA6, 0xFF, 0xD9, 0x1F, 0xD6, 0xFF, 0xDA, 0x1F, 0xD6,
+    0x9A, 0xFF, 0xA1, 0xFD, 0xA7, 0x1A, 0xFD, 0x1A, 0xFD, 0x97, 0x0F, 0xC3, 0x9F, 0xF9, 0x93, 0x9A,
+    0xFC, 0x4F, 0xFF, 0xFF, 0xC4, 0x9F, 0xFF, 0xFF, 0x59, 0xFF, 0xFF, 0xE6, 0x9F, 0xFF, 0xFD, 0x70,
+    0xAF, 0xFF, 0xD9, 0x73, 0x9A, 0xFD, 0xAA, 0x96, 0x77, 0x71, 0xE9, 0x74, 0xAF, 0x73, 0xAF, 0xCA,
+    0x71, 0xAF, 0xEA, 0x7A, 0xF9, 0xFA, 0x5A, 0xEA, 0x2A, 0xEA, 0x3A, 0xE9, 0x49, 0xEA, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0xAE, 0xA9, 0x0A, 0xEA, 0x39, 0xFE, 0xAF, 0xA2, 0x9F, 0xFF, 0xCA, 0x2F,
+    0xCA, 0xFF, 0x91, 0xAE, 0x3A, 0xFD, 0x91, 0xE9, 0x4F, 0xD9, 0x09, 0xE5, 0x9F, 0xC9, 0x09, 0xDA,
+    0x6F, 0xC9, 0x0A, 0xDA, 0x6F, 0xC9, 0x0A, 0xDA, 0x6F, 0xC1, 0x9E, 0x59, 0xFC, 0x19, 0xEA, 0x39,
+    0xFD, 0x2F, 0xFF, 0xE2, 0xAF, 0xFF, 0xD3, 0xFF, 0xFD, 0x39, 0xFF, 0xFC, 0x49, 0xFF, 0xF6, 0x9A,
+    0xCA, 0xA0, 0x9E, 0xA7, 0x4A, 0xEA, 0x74, 0xF9, 0x3C, 0xA5, 0xFC, 0x4F, 0xCA, 0xFD, 0xA3, 0x9F,
+    0xFF, 0x4A, 0xFF, 0xEA, 0x4F, 0xFE, 0xA5, 0x99, 0xAF, 0xDA, 0x60, 0x6A, 0xAA, 0xA5, 0xAA, 0xA9,
+    0x73, 0xAF, 0x99, 0x99, 0xF7, 0x4A, 0xFF, 0xF7, 0x5F, 0xFE, 0x97, 0x59, 0xFF, 0xC9, 0x77, 0x09,
+    0xFC, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xAA, 0xAD, 0xAA,
+    0xA9, 0x99, 0x72, 0x9F, 0xFF, 0xD7, 0x09, 0xFF, 0xFF, 0x79, 0xFF, 0xFF, 0xC9, 0x6F, 0xFF, 0xFD,
+    0x95, 0xFF, 0xA9, 0x59, 0xAA, 0x95, 0xFD, 0xA7, 0x71, 0xAF, 0xD7, 0x72, 0xFD, 0x97, 0x72, 0xFD,
+    0x77, 0x3F, 0xCA, 0x77, 0x3F, 0xCA, 0x77, 0x3F, 0xCA, 0x59, 0xAA, 0x99, 0x79, 0xFC, 0xA5, 0x9F,
+    0xFA, 0xA2, 0xFC, 0xA6, 0xFF, 0xD9, 0x1F, 0xD6, 0xFF, 0xDA, 0x1F, 0xD6, 0x9A, 0xFF, 0xA1, 0xFD,
+    0xA7, 0x1A, 0xFD, 0x1A, 0xFD, 0x97, 0x0F, 0xC3, 0x9F, 0xF9, 0x93, 0x9A, 0xFC, 0x4F, 0xFF, 0xFF,
+    0xC4, 0x9F, 0xFF, 0xFF, 0x59, 0xFF, 0xFF, 0xE6, 0x9F, 0xFF, 0xFD, 0x70, 0xAF, 0xFF, 0xD9, 0x73,
+    0x9A, 0xFD, 0xAA, 0x96, 0x29, 0xAA, 0xA9, 0x93, 0xAA, 0xA9, 0x2A, 0xEA, 0x3A, 0xE9, 0x29, 0xFF,
+    0xF4, 0xFF, 0xE9, 0x5F, 0xFC, 0xA7, 0x9A, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xAE, 0xA9,
+    0x0A, 0xEA, 0x29, 0xFE, 0xAF, 0xA1, 0x9F, 0xFF, 0xCA, 0x1F, 0xCA, 0xFF, 0x90, 0xAE, 0x3A, 0xFD,
+    0x90, 0xE9, 0x4F, 0xD9, 0x9E, 0x59, 0xFC, 0x99, 0xDA, 0x6F, 0xC9, 0xAD, 0xA6, 0xFC, 0x9A, 0xDA,
+    0x6F, 0xC0, 0x9E, 0x59, 0xFC, 0x09, 0xEA, 0x39, 0xFD, 0x1F, 0xFF, 0xE1, 0xAF, 0xFF, 0xD2, 0xFF,
+    0xFD, 0x29, 0xFF, 0xFC, 0x39, 0xFF, 0xF5, 0x9A, 0xCA, 0xA0, 0x9E, 0xA7, 0x3A, 0xEA, 0x73, 0xF9,
+    0x2C, 0xA5, 0xFC, 0x3F, 0xCA, 0xFD, 0xA2, 0x9F, 0xFF, 0x3A, 0xFF, 0xEA, 0x3F, 0xFE, 0xA4, 0x99,
+    0xAF, 0xDA, 0x50, 0x73, 0x99, 0x99, 0x77, 0x49, 0xF7, 0x74, 0xAF, 0x97, 0x73, 0xFC, 0x97, 0x73,
+    0xFC, 0xA7, 0x73, 0xFC, 0xA7, 0x72, 0x9F, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x59, 0xAA, 0xAD, 0xAA, 0xA9, 0x99, 0x72, 0x9F, 0xFF, 0xD7, 0x09, 0xFF, 0xFF, 0x79,
+    0xFF, 0xFF, 0xC9, 0x6F, 0xFF, 0xFD, 0x95, 0xFF, 0xA9, 0x59, 0xAA, 0x95, 0xFD, 0xA7, 0x71, 0xAF,
+    0xD7, 0x72, 0xFD, 0x97, 0x72, 0xFD, 0x77, 0x3F, 0xCA, 0x77, 0x3F, 0xCA, 0x77, 0x3F, 0xCA, 0x59,
+    0xAA, 0x99, 0x79, 0xFC, 0xA5, 0x9F, 0xFA, 0xA2, 0xFC, 0xA6, 0xFF, 0xD9, 0x1F, 0xD6, 0xFF, 0xDA,
+    0x1F, 0xD6, 0x9A, 0xFF, 0xA1, 0xFD, 0xA7, 0x1A, 0xFD, 0x1A, 0xFD, 0x97, 0x0F, 0xC3, 0x9F, 0xF9,
+    0x93, 0x9A, 0xFC, 0x4F, 0xFF, 0xFF, 0xC4, 0x9F, 0xFF, 0xFF, 0x59, 0xFF, 0xFF, 0xE6, 0x9F, 0xFF,
+    0xFD, 0x70, 0xAF, 0xFF, 0xD9, 0x73, 0x9A, 0xFD, 0xAA, 0x96, 0x69, 0xF7, 0x39, 0xF9, 0x72, 0xAF,
+    0x97, 0x2F, 0xCA, 0x72, 0xFD, 0x72, 0xFD, 0x72, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x74,
+    0xAE, 0xA9, 0x0A, 0xEA, 0x29, 0xFE, 0xAF, 0xA1, 0x9F, 0xFF, 0xCA, 0x1F, 0xCA, 0xFF, 0x90, 0xAE,
+    0x3A, 0xFD, 0x90, 0xE9, 0x4F, 0xD9, 0x9E, 0x59, 0xFC, 0x99, 0xDA, 0x6F, 0xC9, 0xAD, 0xA6, 0xFC,
+    0x9A, 0xDA, 0x6F, 0xC0, 0x9E, 0x59, 0xFC, 0x09, 0xEA, 0x39, 0xFD, 0x1F, 0xFF, 0xE1, 0xAF, 0xFF,
+    0xD2, 0xFF, 0xFD, 0x29, 0xFF, 0xFC, 0x39, 0xFF, 0xF5, 0x9A, 0xCA, 0xA0, 0x9E, 0xA7, 0x3A, 0xEA,
+    0x73, 0xF9, 0x2C, 0xA5, 0xFC, 0x3F, 0xCA, 0xFD, 0xA2, 0x9F, 0xFF, 0x3A, 0xFF, 0xEA, 0x3F, 0xFE,
+    0xA4, 0x99, 0xAF, 0xDA, 0x50, 0x71, 0x99, 0x99, 0x99, 0x97, 0x72, 0xFD, 0xA7, 0x72, 0xFD, 0x97,
+    0x72, 0xFD, 0x77, 0x3F, 0xD7, 0x73, 0xFC, 0xA7, 0x72, 0xAF, 0xC9, 0x77, 0x2F, 0xD7, 0x72, 0x9F,
+    0xCA, 0x77, 0x2A, 0xFC, 0x97, 0x72, 0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xAA, 0xDA, 0xAA, 0x99, 0x97, 0x29, 0xFF, 0xFD, 0x70,
+    0x9F, 0xFF, 0xF7, 0x9F, 0xFF, 0xFC, 0x96, 0xFF, 0xFF, 0xD9, 0x5F, 0xFA, 0x95, 0x9A, 0xA9, 0x5F,
+    0xDA, 0x77, 0x1A, 0xFD, 0x77, 0x2F, 0xD9, 0x77, 0x2F, 0xD7, 0x73, 0xFC, 0xA7, 0x73, 0xFC, 0xA7,
+    0x73, 0xFC, 0xA5, 0x9A, 0xA9, 0x97, 0x9F, 0xCA, 0x59, 0xFF, 0xAA, 0x2F, 0xCA, 0x6F, 0xFD, 0x91,
+    0xFD, 0x6F, 0xFD, 0xA1, 0xFD, 0x69, 0xAF, 0xFA, 0x1F, 0xDA, 0x71, 0xAF, 0xD1, 0xAF, 0xD9, 0x70,
+    0xFC, 0x39, 0xFF, 0x99, 0x39, 0xAF, 0xC4, 0xFF, 0xFF, 0xFC, 0x49, 0xFF, 0xFF, 0xF5, 0x9F, 0xFF,
+    0xFE, 0x69, 0xFF, 0xFF, 0xD7, 0x0A, 0xFF, 0xFD, 0x97, 0x39, 0xAF, 0xDA, 0xA9, 0x60, 0x77, 0x69,
+    0xFD, 0xA7, 0x09, 0xFD, 0x97, 0x09, 0xFD, 0x72, 0xFC, 0xA7, 0x19, 0xFC, 0x97, 0x1A, 0xFC, 0x72,
+    0xFD, 0x71, 0x9F, 0xCA, 0x71, 0xFD, 0x97, 0x1F, 0xD7, 0x77, 0x77, 0x4A, 0xEA, 0x90, 0xAE, 0xA2,
+    0x9F, 0xEA, 0xFA, 0x19, 0xFF, 0xFC, 0xA1, 0xFC, 0xAF, 0xF9, 0x0A, 0xE3, 0xAF, 0xD9, 0x0E, 0x94,
+    0xFD, 0x99, 0xE5, 0x9F, 0xC9, 0x9D, 0xA6, 0xFC, 0x9A, 0xDA, 0x6F, 0xC9, 0xAD, 0xA6, 0xFC, 0x09,
+    0xE5, 0x9F, 0xC0, 0x9E, 0xA3, 0x9F, 0xD1, 0xFF, 0xFE, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F,
+    0xFF, 0xC3, 0x9F, 0xFF, 0x59, 0xAC, 0xAA, 0x09, 0xEA, 0x73, 0xAE, 0xA7, 0x3F, 0x92, 0xCA, 0x5F,
+    0xC3, 0xFC, 0xAF, 0xDA, 0x29, 0xFF, 0xF3, 0xAF, 0xFE, 0xA3, 0xFF, 0xEA, 0x49, 0x9A, 0xFD, 0xA5,
+    0x77, 0x76, 0x9E, 0x77, 0x1F, 0x97, 0x7F, 0xD9, 0x75, 0xFF, 0x97, 0x3F, 0xAA, 0xF9, 0x71, 0xF9,
+    0x2F, 0x97, 0xF5, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xF9, 0x70, 0xFC, 0x1A, 0xF9,
+    0x70, 0xFC, 0x1A, 0xF9, 0x70, 0xFC, 0x1A, 0xFA, 0x70, 0xFC, 0x1A, 0xFA, 0x70, 0xFC, 0x1A, 0xFA,
+    0x79, 0xFC, 0x1F, 0xCA, 0x79, 0xFC, 0x1F, 0xCA, 0x79, 0xFC, 0x1F, 0xCA, 0x79, 0xFC, 0x1F, 0xCA,
+    0x79, 0xFC, 0x90, 0xFD, 0x79, 0xFC, 0x90, 0xFD, 0x79, 0xFC, 0x90, 0xFD, 0x79, 0xFC, 0x90, 0xFD,
+    0x99, 0x99, 0x99, 0x99, 0xAF, 0xC9, 0x0F, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0xFA, 0x0F, 0xFF, 0xFF,
+    0xA0, 0xFF, 0xFF, 0xFA, 0x0F, 0xFF, 0xFF, 0xA0, 0xFF, 0xFF, 0xFA, 0x0F, 0xD7, 0xAF, 0xCA, 0x0F,
+    0xD7, 0xFE, 0x0F, 0xD7, 0xFE, 0x0F, 0xD9, 0x6F, 0xE9, 0xFD, 0x96, 0xFE, 0x6D, 0xA7, 0x71, 0xF9,
+    0x77, 0xAF, 0xC7, 0x6A, 0xFE, 0x74, 0xAF, 0xFC, 0x72, 0xAE, 0xA1, 0x9F, 0x70, 0xAE, 0x94, 0xF7,
+    0x99, 0x97, 0x99, 0x97, 0x77, 0x77, 0x77, 0x0F, 0x97, 0x70, 0xF9, 0x77, 0x0F, 0x97, 0x70, 0xF9,
+    0x77, 0x0F, 0x77, 0x1F, 0x77, 0x1F, 0x77, 0x09, 0xF7, 0x70, 0x9F, 0x0A, 0xFA, 0x97, 0x09, 0xFF,
+    0xFA, 0x79, 0xFF, 0xFC, 0x96, 0xAF, 0xEA, 0xFD, 0x6A, 0xFC, 0x4F, 0x6A, 0xF5, 0x9E, 0x95, 0xFC,
+    0x6E, 0x95, 0xFC, 0x6E, 0xA5, 0xFC, 0x6E, 0xA5, 0xFC, 0x59, 0xEA, 0x5F, 0xC5, 0x9F, 0x5F, 0xC5,
+    0xAF, 0x5F, 0xC5, 0xFC, 0x49, 0xFC, 0x5F, 0xC4, 0x9F, 0xC5, 0xFC, 0x49, 0xFC, 0x93, 0x9F, 0xC4,
+    0xAF, 0xC9, 0x3A, 0xFC, 0x00, 0x1A, 0xF9, 0x70, 0xFC, 0x4A, 0xF9, 0x70, 0xFC, 0x4A, 0xF9, 0x70,
+    0xFC, 0x4A, 0xFA, 0x70, 0xFC, 0x4A, 0xFA, 0x70, 0xFC, 0x4A, 0xFA, 0x70, 0xFC, 0x4F, 0xCA, 0x79,
+    0xFC, 0x91, 0x9F, 0xFF, 0xFF, 0xE0, 0x9F, 0xFF, 0xFF, 0xE0, 0x9F, 0xFF, 0xFF, 0xE0, 0xAF, 0xFF,
+    0xFF, 0xE2, 0xFD, 0x79, 0xFC, 0x93, 0xFD, 0x79, 0xFC, 0x93, 0xFD, 0x99, 0x99, 0x99, 0x99, 0xAF,
+    0xC9, 0x3F, 0xFF, 0xFF, 0x93, 0xFF, 0xFF, 0xFA, 0x3F, 0xFF, 0xFF, 0xA3, 0xFF, 0xFF, 0xFA, 0x3F,
+    0xFF, 0xFF, 0xA3, 0xFF, 0xFF, 0xFA, 0x3F, 0xD7, 0xAF, 0xCA, 0x3F, 0xD7, 0xFE, 0x3F, 0xD7, 0xFE,
+    0x3F, 0xD9, 0x6F, 0xE2, 0x9F, 0xD9, 0x6F, 0xE1, 0x5F, 0x97, 0x70, 0xF9, 0x77, 0x0F, 0x97, 0x69,
+    0x9F, 0xE9, 0x70, 0xFF, 0xF9, 0x70, 0xFF, 0xF9, 0x70, 0xCA, 0xAA, 0xAF, 0x77, 0x09, 0xF7, 0x70,
+    0x9F, 0x0A, 0xFA, 0x97, 0x09, 0xFF, 0xFA, 0x79, 0xFF, 0xFC, 0x96, 0xAF, 0xEA, 0xFD, 0x6A, 0xFC,
+    0x4F, 0x6A, 0xF5, 0x9E, 0x95, 0xFC, 0x6E, 0x95, 0xFC, 0x6E, 0xA5, 0xFC, 0x6E, 0xA5, 0xFC, 0x59,
+    0xEA, 0x5F, 0xC5, 0x9F, 0x5F, 0xC5, 0xAF, 0x5F, 0xC5, 0xFC, 0x49, 0xFC, 0x5F, 0xC4, 0x9F, 0xC5,
+    0xFC, 0x49, 0xFC, 0x93, 0x9F, 0xC4, 0xAF, 0xC9, 0x3A, 0xFC, 0x00, 0x1A, 0xCA, 0x2D, 0x90, 0xFC,
+    0x1E, 0x0F, 0xD0, 0xE9, 0xD9, 0xAF, 0xCA, 0xAD, 0x1F, 0xC9, 0xAD, 0x91, 0xAD, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x70, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xAF, 0x5A, 0xF5, 0xAF,
+    0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x94, 0xAF, 0x94, 0xAF, 0x94, 0xAF, 0xA4,
+    0xFC, 0xA4, 0xFC, 0xA4, 0xFC, 0xA4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD1, 0x1A, 0xCA, 0x91, 0xAC,
+    0xA1, 0xAF, 0x90, 0xAD, 0x1F, 0xD0, 0xAD, 0x09, 0xD9, 0x9F, 0xD0, 0x9D, 0x90, 0xAF, 0xA1, 0xDA,
+    0x1A, 0xDA, 0x77, 0x77, 0x77, 0x59, 0x99, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+    0xF7, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF9, 0x5A, 0xFA, 0x5A, 0xFA, 0x20, 0x79, 0x99, 0x9A,
+    0xA9, 0x2F, 0xFF, 0xC1, 0x9F, 0xFF, 0xC9, 0x0F, 0xFF, 0xDA, 0x0A, 0xAA, 0xAA, 0xAA, 0x99, 0x99,
+    0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7,
+    0x2F, 0xC7, 0x2F, 0xC7, 0x2A, 0xF7, 0x2A, 0xF7, 0x2A, 0xF7, 0x2A, 0xF7, 0x2A, 0xF7, 0x2A, 0xF7,
+    0x2A, 0xF7, 0x2A, 0xF7, 0x2A, 0xF9, 0x71, 0xAF, 0x97, 0x1A, 0xF9, 0x71, 0xAF, 0xA7, 0x1F, 0xCA,
+    0x71, 0xFC, 0xA7, 0x1F, 0xCA, 0x71, 0xFD, 0x71, 0xFD, 0x71, 0xFD, 0x71, 0xFD, 0x30, 0x77, 0x39,
+    0x9A, 0xAA, 0xAF, 0xD3, 0xFF, 0xFC, 0x91, 0x9F, 0xFF, 0xCA, 0x1F, 0xFF, 0xDA, 0x19, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x71, 0x99, 0x99, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74,
+    0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x73, 0x9F, 0x73, 0x9F, 0x73, 0x9F, 0x73, 0x9F, 0x97, 0x2A, 0xFA,
+    0x72, 0xAF, 0xA4, 0x1F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3A, 0xF3, 0xAF, 0x3A,
+    0xF3, 0xAF, 0x3A, 0xF3, 0xAF, 0x3A, 0xF3, 0xAF, 0x3A, 0xF9, 0x2A, 0xF9, 0x2A, 0xF9, 0x2A, 0xFA,
+    0x2F, 0xCA, 0x2F, 0xCA, 0x2F, 0xCA, 0x2F, 0xD2, 0xFD, 0x2F, 0xD2, 0xFD, 0x19, 0xE9, 0x3E, 0x93,
+    0x9E, 0x4A, 0xFD, 0x19, 0xFD, 0x29, 0xFC, 0x59, 0x99, 0x10, 0x19, 0x99, 0x92, 0x9F, 0x2A, 0xF9,
+    0x1A, 0xFA, 0x1F, 0xCA, 0x1F, 0xD0, 0x9F, 0xD7, 0x77, 0x72, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+    0xF3, 0xF3, 0xF3, 0xF2, 0x9F, 0x29, 0xF2, 0x9F, 0x29, 0xF9, 0x1A, 0xFA, 0x1A, 0xFA, 0x2A, 0xEA,
+    0x1A, 0xF2, 0xF2, 0xAE, 0x92, 0xF3, 0xFE, 0x9A, 0xFD, 0xA0, 0xAF, 0xCA, 0x2A, 0xE9, 0x19, 0x99,
+    0x92, 0xAF, 0x2F, 0xC2, 0xFC, 0x91, 0xFC, 0x90, 0x9F, 0xCA, 0x0A, 0xFC, 0xA7, 0x77, 0x77, 0x71,
+    0xFC, 0x2F, 0xC2, 0xFC, 0x2F, 0xC2, 0xFC, 0x2F, 0xC2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF,
+    0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x91, 0xAF, 0x91, 0xAF, 0x91, 0xAF, 0xA1, 0xFC, 0xA1, 0xFC,
+    0xA1, 0xFC, 0xA1, 0xFD, 0x1F, 0xD1, 0xFD, 0x1F, 0xD0, 0x09, 0x99, 0x91, 0xF1, 0xF1, 0xF1, 0xF1,
+    0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF0, 0x9F, 0x09, 0xF0, 0x9F, 0x09, 0xF9, 0xAF, 0xAA, 0xFA, 0xAF,
+    0xA7, 0x2F, 0xC9, 0xAF, 0xA7, 0x2F, 0xC0, 0xAF, 0xA7, 0x19, 0xFC, 0x09, 0xFA, 0x71, 0x9F, 0xC0,
+    0x9F, 0x97, 0x19, 0xFC, 0x09, 0xF9, 0x71, 0xAF, 0xC0, 0x9F, 0x97, 0x1A, 0xFA, 0x09, 0xF9, 0x71,
+    0xAF, 0xA1, 0xF9, 0x71, 0xFC, 0xA1, 0xF9, 0x71, 0xFC, 0x91, 0xFA, 0x71, 0xFC, 0x91, 0xFA, 0x71,
+    0xFC, 0x2F, 0xA7, 0x1F, 0xC2, 0xFA, 0x71, 0xFC, 0x19, 0xFA, 0x70, 0x9F, 0xC1, 0x9F, 0xC7, 0x09,
+    0xFC, 0x19, 0xFC, 0x70, 0x9F, 0xC1, 0x9F, 0xC7, 0x0A, 0xFA, 0x19, 0xFC, 0x70, 0xAF, 0xA1, 0x9F,
+    0xC7, 0x0A, 0xF9, 0x1A, 0xFC, 0x70, 0xFC, 0x91, 0xAF, 0xC7, 0x0F, 0xC9, 0x1A, 0xFC, 0x97, 0xFC,
+    0x2A, 0xFC, 0x97, 0xFC, 0x2F, 0xD9, 0x7F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0xAF, 0xC7, 0x0A, 0xCA,
+    0x92, 0x9F, 0xCA, 0x70, 0xFF, 0xFC, 0xA7, 0x0F, 0xFF, 0xC9, 0x70, 0xFF, 0xFC, 0x70, 0x9F, 0xFF,
+    0x97, 0x09, 0xFF, 0xF7, 0x1A, 0xFF, 0xE7, 0x39, 0x9A, 0xAF, 0xA9, 0x77, 0x75, 0x19, 0x99, 0x96,
+    0xAD, 0x91, 0x9F, 0x6E, 0xA1, 0xAF, 0x94, 0x9F, 0x1A, 0xFA, 0x49, 0xF1, 0xFC, 0xA4, 0xAF, 0x1F,
+    0xD7, 0x29, 0xFD, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9E, 0xA2, 0xF5, 0x9E, 0xA2, 0xF5, 0x9E, 0xA2,
+    0xF5, 0x9E, 0xA2, 0xF5, 0x9E, 0x92, 0xF5, 0x9E, 0x92, 0xF5, 0x9E, 0x92, 0xF5, 0xAE, 0x92, 0xF5,
+    0xAE, 0x3F, 0x5A, 0xE3, 0xF5, 0xAE, 0x29, 0xF5, 0xAE, 0x29, 0xF5, 0xAE, 0x29, 0xF5, 0xF2, 0x9F,
+    0x94, 0xF2, 0xAF, 0xA4, 0xEA, 0x2A, 0xFA, 0x39, 0xEA, 0x74, 0xAE, 0xA7, 0x1A, 0xCA, 0xFA, 0x71,
+    0xFE, 0x97, 0x1F, 0xE7, 0x2F, 0xE7, 0x19, 0xFC, 0xA7, 0x75, 0x71, 0xAD, 0x97, 0x69, 0xF7, 0x6F,
+    0xCA, 0x74, 0xFE, 0xA7, 0x2F, 0xFC, 0xA7, 0x0F, 0x91, 0xAE, 0xA6, 0xF4, 0x9E, 0xA5, 0x99, 0x97,
+    0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xFA, 0x75, 0xFC, 0xA7, 0x5F, 0xC9, 0x75, 0xFC, 0x97,
+    0x5F, 0xC9, 0x75, 0xFC, 0x75, 0x9F, 0xC7, 0x59, 0xFC, 0x75, 0x9F, 0xC7, 0x5A, 0xFA, 0x75, 0xAF,
+    0xA7, 0x5F, 0xCA, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x75, 0x9F,
+    0xC7, 0x59, 0xFC, 0x75, 0xAF, 0xA7, 0x5A, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x94,
+    0x9D, 0xA9, 0x19, 0xFD, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF, 0xC6, 0xFF, 0xF9, 0x6F,
+    0xFE, 0xA7, 0x99, 0xAA, 0xFC, 0xA7, 0x77, 0x40, 0x6E, 0x74, 0xAE, 0xA7, 0x29, 0xFC, 0x97, 0x09,
+    0xFE, 0x96, 0x9F, 0xAF, 0x94, 0x9F, 0x19, 0xF9, 0x29, 0xEA, 0x4A, 0xE9, 0x19, 0x99, 0x70, 0x99,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xAA, 0xAA, 0x73, 0x9E, 0xA7, 0x39, 0xEA, 0x73, 0x9E,
+    0x97, 0x3A, 0xE9, 0x73, 0xAE, 0x97, 0x3A, 0xE9, 0x73, 0xAE, 0x74, 0xAE, 0x74, 0xAE, 0x74, 0xAE,
+    0x74, 0xAE, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4E, 0xA7, 0x4E, 0xA7, 0x3A, 0xEA, 0x70, 0x91, 0xF9,
+    0x70, 0xFE, 0x97, 0x0F, 0xE7, 0x1F, 0xE7, 0x09, 0xFD, 0x97, 0x19, 0xAA, 0x99, 0x71, 0x69, 0x99,
+    0x99, 0x99, 0x76, 0xFE, 0x76, 0xFD, 0xA7, 0x6F, 0xD9, 0x76, 0xFD, 0x77, 0xFC, 0xA7, 0x69, 0xFC,
+    0x97, 0x6F, 0xD7, 0x7F, 0xD7, 0x6A, 0xFC, 0xA7, 0x6A, 0xAA, 0xAA, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x75, 0xAF, 0x3A, 0xFC, 0x95, 0xFC, 0x3F, 0xD6, 0xFC, 0x2A, 0xFC, 0x96, 0xFC, 0x19, 0xFC,
+    0xA7, 0xFA, 0x1F, 0xD7, 0x0F, 0xA0, 0x9F, 0xC9, 0x79, 0xFA, 0x0F, 0xD7, 0x09, 0xF9, 0xAF, 0xC9,
+    0x70, 0xAF, 0x9F, 0xCA, 0x71, 0xAF, 0xFD, 0x72, 0xAF, 0xFC, 0x97, 0x2F, 0xFD, 0x73, 0xFF, 0xC9,
+    0x73, 0xFF, 0xA7, 0x4F, 0xF9, 0x73, 0x9F, 0xFC, 0x97, 0x29, 0xFF, 0xD9, 0x71, 0x9F, 0xFE, 0xA7,
+    0x0A, 0xFF, 0xFA, 0x7A, 0xFA, 0xAF, 0xF6, 0xFC, 0xA0, 0xAF, 0xF5, 0xFC, 0xA1, 0xFF, 0xC4, 0xFC,
+    0xA2, 0xFF, 0xC3, 0xFC, 0xA2, 0x9F, 0xFC, 0x91, 0xFC, 0xA3, 0x9F, 0xFC, 0x90, 0x1F, 0x97, 0x4F,
+    0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x74, 0x9F, 0x74, 0x9E, 0xA7, 0x49, 0xEA, 0x74, 0xAE, 0xA1,
+    0x99, 0x99, 0x95, 0xAE, 0x90, 0xAF, 0x95, 0xAE, 0x99, 0xFA, 0x6A, 0xEA, 0xFC, 0x7F, 0xFC, 0x70,
+    0xFF, 0x71, 0xFE, 0x97, 0x1F, 0xE9, 0x71, 0xFF, 0x97, 0x0F, 0xFC, 0xA7, 0xFF, 0xDA, 0x6F, 0xAF,
+    0xDA, 0x49, 0xF9, 0x9F, 0xE3, 0x9F, 0x90, 0xAF, 0xE2, 0x9F, 0xA1, 0xFF, 0x1A, 0xFA, 0x2F, 0xF9,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xFE, 0x72, 0xFD, 0x97, 0x2F, 0xD7, 0x3F, 0xD7, 0x3F, 0xCA,
+    0x72, 0xAF, 0xC9, 0x72, 0xFD, 0x72, 0x9F, 0xCA, 0x72, 0xAF, 0xC9, 0x72, 0xAF, 0xC7, 0x10, 0x29,
+    0x99, 0x19, 0x99, 0x94, 0x9D, 0xA1, 0xEA, 0x4A, 0xD9, 0x0A, 0xE5, 0xAD, 0x99, 0xE9, 0x5E, 0x0F,
+    0x6E, 0x9E, 0x7F, 0xDA, 0x7F, 0xD7, 0x9F, 0xC9, 0x79, 0xFC, 0x70, 0x9F, 0xD7, 0xAF, 0xE6, 0xAD,
+    0xAF, 0xC9, 0x4E, 0xA0, 0xFC, 0x93, 0xEA, 0x09, 0xFC, 0xA2, 0xEA, 0x19, 0xFC, 0xA0, 0x77, 0x5E,
+    0x97, 0x49, 0xE7, 0x5E, 0xA7, 0x49, 0xE9, 0x74, 0xF7, 0x49, 0xEA, 0x77, 0x77, 0x77, 0x1F, 0xC7,
+    0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xA7, 0x4F, 0xA7, 0x39, 0xFA, 0x73, 0x9F, 0xA7, 0x39,
+    0xFA, 0x73, 0x9F, 0xA7, 0x39, 0xFA, 0x73, 0xAF, 0xA7, 0x3A, 0xFA, 0x73, 0xAF, 0xA7, 0x3A, 0xF9,
+    0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0xAA, 0xAA, 0xAA, 0xAF,
+    0x90, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x90,
+    0x74, 0xAD, 0x94, 0xE4, 0xAE, 0x4E, 0x93, 0xAE, 0x4F, 0x77, 0x77, 0x77, 0x71, 0x9F, 0x39, 0xEA,
+    0x39, 0xEA, 0x3A, 0xE9, 0x3A, 0xE9, 0x3A, 0xE9, 0x3F, 0x93, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+    0xF4, 0xF3, 0x9F, 0x39, 0xF3, 0x9F, 0x39, 0xF3, 0x9F, 0x39, 0xF3, 0x9F, 0xE0, 0xAF, 0xE9, 0xAF,
+    0xEA, 0xAF, 0xF0, 0x19, 0xFD, 0x97, 0x3A, 0xFD, 0x74, 0x9F, 0xD7, 0x49, 0xFC, 0xA7, 0x49, 0xFC,
+    0x97, 0x4F, 0xD7, 0x5F, 0xD7, 0x4A, 0xFC, 0x97, 0x4F, 0xD7, 0x5F, 0xD7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x70, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x76, 0xFA, 0x76, 0xFA, 0x75, 0x9F, 0xA7,
+    0x59, 0xFA, 0x75, 0x9F, 0xA7, 0x59, 0xFA, 0x75, 0x9F, 0xA7, 0x5A, 0xFA, 0x75, 0xAF, 0xA7, 0x5A,
+    0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xCA,
+    0xAA, 0xAA, 0xAA, 0xF9, 0x2F, 0xFF, 0xF9, 0x2F, 0xFF, 0xF9, 0x2F, 0xFF, 0xF9, 0x2F, 0xFF, 0xF9,
+    0x19, 0xFF, 0xFF, 0x90, 0x29, 0xF5, 0x9E, 0xA5, 0x9E, 0xA5, 0xAE, 0x95, 0xAE, 0x95, 0xAE, 0x95,
+    0xF9, 0x5F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x59, 0xF5, 0x9F, 0x59, 0xF5, 0x9F, 0x59,
+    0xF5, 0x9F, 0x59, 0xFE, 0x2A, 0xFE, 0x91, 0xAF, 0xEA, 0x1A, 0xFF, 0x77, 0x77, 0x77, 0x77, 0x3A,
+    0xFD, 0x92, 0xAF, 0xD3, 0xAF, 0xD3, 0x9F, 0xCA, 0x3A, 0xFC, 0x93, 0xFD, 0x4F, 0xCA, 0x3A, 0xFC,
+    0x93, 0xFD, 0x39, 0xFD, 0x30, 0x1F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xA7, 0x4F,
+    0xA4, 0xF2, 0x9F, 0xA4, 0xF2, 0x9F, 0xA3, 0x9E, 0xA2, 0x9F, 0xA3, 0x9E, 0xA2, 0x9F, 0xA3, 0xAE,
+    0xA2, 0x9F, 0xA3, 0xAE, 0xA2, 0xAF, 0xA3, 0xF9, 0x2A, 0xFA, 0x3F, 0x92, 0xAF, 0xA7, 0x3A, 0xF9,
+    0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0xAA, 0xAA, 0xAA, 0xFC,
+    0x90, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x90,
+    0x70, 0xAE, 0x71, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x19, 0xF1, 0x9F, 0x19, 0xEA, 0x19, 0xF1, 0x9E,
+    0xA1, 0xAF, 0x1A, 0xE9, 0x70, 0xAE, 0x97, 0x0A, 0xE9, 0x70, 0xF9, 0x70, 0xF7, 0x1F, 0x71, 0xF7,
+    0x1F, 0x71, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F, 0x70,
+    0x9F, 0x70, 0x9F, 0x70, 0x9F, 0xE5, 0xAF, 0xE9, 0x4A, 0xFE, 0xA4, 0xAF, 0xF4, 0x1F, 0xC7, 0x4F,
+    0xC7, 0x4F, 0xC7, 0x4F, 0xC4, 0x99, 0x99, 0x3F, 0xA3, 0x9F, 0x3F, 0xA3, 0xAF, 0x91, 0x9F, 0xA3,
+    0xAF, 0xA1, 0x9F, 0xA3, 0xFC, 0xA1, 0x9F, 0xA3, 0xFD, 0x19, 0xFA, 0x29, 0xFD, 0x19, 0xFA, 0x73,
+    0xAF, 0xA7, 0x3A, 0xFA, 0x73, 0xAF, 0xA7, 0x3A, 0xF9, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC,
+    0x97, 0x3F, 0xC9, 0x73, 0xFC, 0xAA, 0xAA, 0xAA, 0xAF, 0x90, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0x90,
+    0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x90, 0x09, 0xF7, 0x09, 0xEA, 0x70, 0x9E, 0xA7,
+    0x0A, 0xE9, 0x70, 0xAE, 0x97, 0x0A, 0xE9, 0x19, 0x99, 0x92, 0xF9, 0x1F, 0xA1, 0xF1, 0x9F, 0xA1,
+    0xF1, 0x9F, 0xC1, 0xF1, 0xAF, 0xC1, 0xF1, 0xFD, 0x1F, 0x1F, 0xD1, 0xF7, 0x1F, 0x71, 0xF7, 0x09,
+    0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xFE, 0x5A, 0xFE, 0x94,
+    0xAF, 0xEA, 0x4A, 0xFF, 0x40, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xCA, 0x77, 0x71, 0x9F, 0x77, 0x72,
+    0xF9, 0x77, 0x71, 0xAF, 0x77, 0x72, 0xF9, 0x77, 0x71, 0xFA, 0x77, 0x71, 0x9F, 0x77, 0x72, 0xFA,
+    0x77, 0x71, 0xAF, 0x77, 0x3F, 0xC0, 0x9F, 0x97, 0x73, 0xFC, 0x0F, 0xC7, 0x74, 0xFC, 0x9F, 0x77,
+    0x5F, 0xFC, 0xA7, 0x75, 0xFF, 0xC7, 0x76, 0xFF, 0x97, 0x75, 0x9F, 0xF7, 0x76, 0x9F, 0xE9, 0x77,
+    0x69, 0xFD, 0xA7, 0x77, 0x9F, 0xD7, 0x77, 0x09, 0xFC, 0xA7, 0x77, 0x0A, 0xFC, 0x77, 0x71, 0xAF,
+    0xA7, 0x77, 0x1F, 0xCA, 0x77, 0x70, 0xFD, 0x97, 0x77, 0x9F, 0xD9, 0x77, 0x7F, 0xE9, 0x77, 0x6A,
+    0xFE, 0x97, 0x75, 0x9F, 0xF9, 0x77, 0x5F, 0xFC, 0xAA, 0xAA, 0xAA, 0xAF, 0x97, 0x19, 0xFF, 0xFF,
+    0xF9, 0x71, 0xFF, 0xFF, 0xFC, 0x97, 0x0A, 0xFA, 0xFF, 0xFF, 0x97, 0x9F, 0xC9, 0xFF, 0xFF, 0x97,
+    0xFC, 0x99, 0xFF, 0xFF, 0x96, 0xAF, 0xC7, 0x77, 0x1F, 0xC7, 0x77, 0x1F, 0xCA, 0x77, 0x70, 0x9F,
+    0xC7, 0x77, 0x1F, 0xC9, 0x77, 0x70, 0xAF, 0xC7, 0x77, 0x1F, 0xC7, 0x77, 0x1E, 0xA7, 0x77, 0x29,
+    0xA9, 0x77, 0x77, 0x77, 0x74, 0x72, 0x9F, 0x77, 0x09, 0xEA, 0x77, 0x09, 0xEA, 0x77, 0x0A, 0xE9,
+    0x77, 0x0A, 0xE9, 0x77, 0x0A, 0xE9, 0x77, 0x0F, 0x97, 0x70, 0xF7, 0x71, 0xF7, 0x71, 0xF7, 0x71,
+    0xF7, 0x71, 0xF9, 0xAE, 0x97, 0x3F, 0xFA, 0x74, 0xFE, 0x74, 0x9F, 0xD9, 0x73, 0x9F, 0xE7, 0x39,
+    0xFF, 0xC7, 0x19, 0xFF, 0xE7, 0x9F, 0xDA, 0x09, 0xF7, 0x99, 0xAD, 0xA2, 0x9F, 0x77, 0x09, 0xF7,
+    0x70, 0x9F, 0xE7, 0x5A, 0xFE, 0x97, 0x4A, 0xFE, 0xA7, 0x4A, 0xFF, 0x20, 0x73, 0xE7, 0x71, 0x9E,
+    0x77, 0x1E, 0xA7, 0x70, 0x9E, 0x77, 0x1F, 0x77, 0x09, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x0F, 0x91, 0x9A, 0xAA, 0xAA, 0x70, 0xF9, 0x19, 0xFC, 0xA6, 0x9F, 0x91, 0xAF, 0xD6, 0x9F,
+    0x91, 0xAF, 0xD9, 0x59, 0xF2, 0xAF, 0xE5, 0xAF, 0x2F, 0xF9, 0x4A, 0xF2, 0xFF, 0xC4, 0xAF, 0x2F,
+    0xFC, 0x93, 0xFC, 0x2F, 0xFD, 0x3F, 0xC2, 0xFF, 0xD9, 0x2F, 0xC2, 0xFC, 0xAF, 0xC2, 0xFC, 0x19,
+    0xFC, 0x9A, 0xF2, 0xFC, 0x19, 0xFC, 0xA0, 0xFA, 0x1F, 0xC1, 0x9F, 0xCA, 0x0F, 0xC1, 0xFA, 0x1A,
+    0xFC, 0xA0, 0x9F, 0xA9, 0xFA, 0x1A, 0xFC, 0xA1, 0xFC, 0xAF, 0xA1, 0xAF, 0xCA, 0x1A, 0xFF, 0xCA,
+    0x1A, 0xFC, 0xA2, 0xFF, 0xCA, 0x1F, 0xDA, 0x2A, 0xFF, 0x91, 0xFE, 0x29, 0xFF, 0x91, 0xFE, 0x3F,
+    0xF9, 0x1F, 0xE3, 0x9F, 0xE9, 0x1F, 0xE4, 0xFE, 0x2F, 0xE4, 0xAF, 0xD1, 0x77, 0x71, 0x9D, 0xA7,
+    0x4E, 0x97, 0x39, 0xE7, 0x4E, 0xA7, 0x39, 0xE9, 0x73, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39,
+    0xE0, 0x9A, 0xEA, 0x94, 0x9F, 0xFF, 0x39, 0xFF, 0xFC, 0x2A, 0xFF, 0xFC, 0x91, 0xAF, 0xA3, 0xAF,
+    0x1A, 0xF5, 0xF1, 0xFA, 0x5F, 0x1F, 0x95, 0xF9, 0x0F, 0x95, 0xF9, 0x0F, 0xA5, 0xF9, 0x0F, 0xA5,
+    0xFA, 0x0F, 0xA5, 0xFA, 0x0F, 0xC4, 0x9F, 0xA9, 0xFC, 0x49, 0xFA, 0x9F, 0xC4, 0xAF, 0xC9, 0xFC,
+    0x4A, 0xFC, 0xAF, 0xC4, 0xAF, 0xC0, 0x77, 0x0F, 0x91, 0x9A, 0xAA, 0xAA, 0x70, 0xF9, 0x19, 0xFC,
+    0xA6, 0x9F, 0x91, 0xAF, 0xD6, 0x9F, 0x91, 0xAF, 0xD9, 0x59, 0xF2, 0xAF, 0xE5, 0xAF, 0x2F, 0xF9,
+    0x4A, 0xF2, 0xFF, 0xC4, 0xAF, 0x2F, 0xFC, 0x93, 0xFC, 0x2F, 0xFD, 0x3F, 0xC2, 0xFF, 0xD9, 0x2F,
+    0xC2, 0xFC, 0xAF, 0xC2, 0xFC, 0x19, 0xFC, 0x9A, 0xF2, 0xFC, 0x19, 0xFC, 0xA0, 0xFA, 0x1F, 0xC1,
+    0x9F, 0xCA, 0x0F, 0xC1, 0xFA, 0x1A, 0xFC, 0xA0, 0x9F, 0xA9, 0xFA, 0x1A, 0xFC, 0xA1, 0xFC, 0xAF,
+    0xA1, 0xAF, 0xCA, 0x1A, 0xFF, 0xCA, 0x1A, 0xFC, 0xA2, 0xFF, 0xCA, 0x1F, 0xDA, 0x2A, 0xFF, 0x91,
+    0xFE, 0x29, 0xFF, 0x91, 0xFE, 0x3F, 0xF9, 0x1F, 0xE3, 0x9F, 0xE9, 0x1F, 0xE4, 0xFE, 0x2F, 0xE4,
+    0xAF, 0xD7, 0x77, 0x7A, 0xAA, 0xAA, 0xAA, 0x76, 0xFD, 0xA7, 0x6F, 0xD9, 0x76, 0xFD, 0x77, 0xFD,
+    0x76, 0x9F, 0xCA, 0x76, 0xAF, 0xC7, 0x7F, 0xD7, 0x69, 0xFC, 0xA7, 0x6F, 0xD9, 0x76, 0x99, 0x99,
+    0x99, 0x71, 0x77, 0x19, 0xE0, 0x9A, 0xEA, 0xA4, 0x9F, 0xFF, 0x39, 0xFF, 0xFC, 0x2A, 0xFF, 0xFC,
+    0x91, 0xAF, 0xA3, 0xAF, 0x1A, 0xF5, 0xF1, 0xFA, 0x5F, 0x1F, 0x95, 0xF9, 0x0F, 0x95, 0xF9, 0x0F,
+    0xA5, 0xF9, 0x0F, 0xA5, 0xFA, 0x0F, 0xA5, 0xFA, 0x0F, 0xC4, 0x9F, 0xA9, 0xFC, 0x49, 0xFA, 0x9F,
+    0xC4, 0xAF, 0xC9, 0xFC, 0x4A, 0xFC, 0xAF, 0xC4, 0xAF, 0xC7, 0x75, 0x9F, 0xD9, 0x70, 0x9F, 0xD9,
+    0x70, 0x9F, 0xD7, 0x19, 0xFD, 0x71, 0x9F, 0xC9, 0x71, 0xAF, 0xC7, 0x2F, 0xD7, 0x19, 0xFC, 0xA7,
+    0x1A, 0xFC, 0x97, 0x1F, 0xD7, 0x77, 0x77, 0x72, 0xAE, 0x94, 0xF7, 0x0A, 0xEA, 0x19, 0xF7, 0x2A,
+    0xFF, 0xC7, 0x4A, 0xFE, 0x76, 0xAF, 0xC7, 0x70, 0xF9, 0x77, 0x1D, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x76, 0xF9, 0x19, 0xAA, 0xAA, 0xA7, 0x0F, 0x91, 0x9F, 0xCA, 0x69, 0xF9, 0x1A,
+    0xFD, 0x69, 0xF9, 0x1A, 0xFD, 0x95, 0x9F, 0x2A, 0xFE, 0x5A, 0xF2, 0xFF, 0x94, 0xAF, 0x2F, 0xFC,
+    0x4A, 0xF2, 0xFF, 0xC9, 0x3F, 0xC2, 0xFF, 0xD3, 0xFC, 0x2F, 0xFD, 0x92, 0xFC, 0x2F, 0xCA, 0xFC,
+    0x2F, 0xC1, 0x9F, 0xC9, 0xAF, 0x2F, 0xC1, 0x9F, 0xCA, 0x0F, 0xA1, 0xFC, 0x19, 0xFC, 0xA0, 0xFC,
+    0x1F, 0xA1, 0xAF, 0xCA, 0x09, 0xFA, 0x9F, 0xA1, 0xAF, 0xCA, 0x1F, 0xCA, 0xFA, 0x1A, 0xFC, 0xA1,
+    0xAF, 0xFC, 0xA1, 0xAF, 0xCA, 0x2F, 0xFC, 0xA1, 0xFD, 0xA2, 0xAF, 0xF9, 0x1F, 0xE2, 0x9F, 0xF9,
+    0x1F, 0xE3, 0xFF, 0x91, 0xFE, 0x39, 0xFE, 0x91, 0xFE, 0x4F, 0xE2, 0xFE, 0x4A, 0xFD, 0x10, 0x19,
+    0xAA, 0xA6, 0x9A, 0xAA, 0x3A, 0xE9, 0x3F, 0x94, 0xAF, 0x09, 0xF9, 0x6A, 0xFF, 0x97, 0x0A, 0xFD,
+    0x97, 0x2A, 0xF9, 0x74, 0xEA, 0x75, 0x9A, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9E,
+    0x09, 0xAE, 0xAA, 0x59, 0xFF, 0xF4, 0x9F, 0xFF, 0xC3, 0xAF, 0xFF, 0xC9, 0x2A, 0xFA, 0x3A, 0xF2,
+    0xAF, 0x5F, 0x2F, 0xA5, 0xF2, 0xF9, 0x5F, 0x91, 0xF9, 0x5F, 0x91, 0xFA, 0x5F, 0x91, 0xFA, 0x5F,
+    0xA1, 0xFA, 0x5F, 0xA1, 0xFC, 0x49, 0xFA, 0x09, 0xFC, 0x49, 0xFA, 0x09, 0xFC, 0x4A, 0xFC, 0x09,
+    0xFC, 0x4A, 0xFC, 0x0A, 0xFC, 0x4A, 0xFC, 0x00, 0x71, 0xAA, 0xAA, 0x73, 0xFC, 0x72, 0xFC, 0x72,
+    0xFC, 0x72, 0xFC, 0x97, 0x1F, 0xCA, 0x71, 0xFD, 0x71, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x70, 0x9E, 0x09, 0xAE, 0xAA, 0x49, 0xFF, 0xF3, 0x9F, 0xFF, 0xC2, 0xAF, 0xFF, 0xC9, 0x1A, 0xFA,
+    0x3A, 0xF1, 0xAF, 0x5F, 0x1F, 0xA5, 0xF1, 0xF9, 0x5F, 0x90, 0xF9, 0x5F, 0x90, 0xFA, 0x5F, 0x90,
+    0xFA, 0x5F, 0xA0, 0xFA, 0x5F, 0xA0, 0xFC, 0x49, 0xFA, 0x9F, 0xC4, 0x9F, 0xA9, 0xFC, 0x4A, 0xFC,
+    0x9F, 0xC4, 0xAF, 0xCA, 0xFC, 0x4A, 0xFC, 0x77, 0x0F, 0x91, 0x9A, 0xAA, 0xAA, 0x70, 0xF9, 0x19,
+    0xFC, 0xA6, 0x9F, 0x91, 0xAF, 0xD6, 0x9F, 0x91, 0xAF, 0xD9, 0x59, 0xF2, 0xAF, 0xE5, 0xAF, 0x2F,
+    0xF9, 0x4A, 0xF2, 0xFF, 0xC4, 0xAF, 0x2F, 0xFC, 0x93, 0xFC, 0x2F, 0xFD, 0x3F, 0xC2, 0xFF, 0xD9,
+    0x2F, 0xC2, 0xFC, 0x9F, 0xC2, 0xFC, 0x19, 0xFC, 0x9A, 0xF2, 0xFC, 0x19, 0xFC, 0xA0, 0xFA, 0x1F,
+    0xC1, 0x9F, 0xCA, 0x0F, 0xC1, 0xFA, 0x1A, 0xFC, 0xA0, 0x9F, 0xA9, 0xFA, 0x1A, 0xFC, 0xA1, 0xFC,
+    0xAF, 0xA1, 0xAF, 0xCA, 0x1A, 0xFF, 0xCA, 0x1A, 0xFC, 0xA2, 0xFF, 0xCA, 0x1F, 0xDA, 0x2A, 0xFF,
+    0x91, 0xFE, 0x3F, 0xF9, 0x1F, 0xE3, 0xFF, 0x91, 0xFE, 0x39, 0xFE, 0x91, 0xFE, 0x4F, 0xE2, 0xFE,
+    0x4A, 0xFD, 0x76, 0x9F, 0xD7, 0x6A, 0xFD, 0x73, 0xFF, 0xD7, 0x29, 0xFF, 0xCA, 0x72, 0xFF, 0xD7,
+    0x39, 0xAA, 0xDA, 0xAA, 0x97, 0x77, 0x10, 0x77, 0x19, 0xE0, 0x9A, 0xEA, 0xA4, 0x9F, 0xFF, 0x39,
+    0xFF, 0xFC, 0x2A, 0xFF, 0xFC, 0x91, 0xAF, 0xA3, 0xAF, 0x1A, 0xF5, 0xF1, 0xFA, 0x5F, 0x1F, 0x95,
+    0xF9, 0x0F, 0x95, 0xF9, 0x0F, 0xA5, 0xF9, 0x0F, 0xA5, 0xFA, 0x0F, 0xA5, 0xFA, 0x0F, 0xC4, 0x9F,
+    0xA9, 0xFC, 0x49, 0xFA, 0x9F, 0xC4, 0xAF, 0xC9, 0xFC, 0x4A, 0xFC, 0xAF, 0xC4, 0xAF, 0xC7, 0x2A,
+    0xFC, 0x72, 0xFD, 0x7F, 0xFA, 0x7F, 0xF9, 0x69, 0xFE, 0xA7, 0x09, 0x99, 0x99, 0x30, 0x77, 0x76,
+    0xAA, 0xAF, 0xFC, 0xA7, 0x29, 0xFF, 0xFC, 0x72, 0xFF, 0xFD, 0x97, 0x09, 0xFF, 0xCA, 0xAA, 0xAA,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAF, 0xCA, 0x97, 0x59, 0xFF, 0xE9,
+    0x72, 0xAF, 0xFF, 0xD7, 0x0A, 0xFF, 0xFF, 0x6A, 0xFD, 0x92, 0x9F, 0xDA, 0x49, 0xFC, 0xA6, 0xAF,
+    0xC9, 0x3A, 0xFC, 0x70, 0xAF, 0xC3, 0xFC, 0x72, 0xFC, 0x91, 0xAF, 0xC7, 0x2A, 0xFA, 0x1F, 0xC9,
+    0x72, 0x9F, 0xC1, 0xFC, 0x74, 0xFC, 0x1F, 0xC7, 0x4F, 0xC1, 0xFC, 0x74, 0xFC, 0x99, 0xFC, 0x74,
+    0xFC, 0x99, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0x74, 0xFC, 0x1F, 0xD7, 0x2A,
+    0xFC, 0x1F, 0xDA, 0x70, 0x9F, 0xD1, 0xFF, 0xA9, 0x90, 0x99, 0xAF, 0xF1, 0xAF, 0xFF, 0xFF, 0xCA,
+    0x2F, 0xFF, 0xFF, 0xC9, 0x2A, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE9, 0x5F, 0xFF, 0xFC, 0xA7, 0xAF,
+    0xFF, 0xD9, 0x72, 0x9A, 0xFE, 0xAA, 0x97, 0x77, 0x60, 0x74, 0x94, 0xAA, 0xAF, 0xFC, 0xA2, 0x9F,
+    0xFF, 0xC2, 0xFF, 0xFD, 0x90, 0x9F, 0xEA, 0xAA, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x29, 0xAF, 0x97, 0x9F, 0xFC, 0x94, 0x9F, 0xFE, 0x93, 0xFD, 0xAA, 0xFC, 0x2A, 0xF9, 0x29, 0xFA,
+    0x1F, 0xA4, 0x9F, 0x1F, 0x6F, 0x99, 0xF6, 0xFA, 0x9F, 0x6A, 0xEA, 0xAF, 0x6A, 0xEA, 0x9F, 0x6F,
+    0xA9, 0xF9, 0x5F, 0xA0, 0xFC, 0x4F, 0xC9, 0x0F, 0xFF, 0xE1, 0xAF, 0xFF, 0xCA, 0x2F, 0xFF, 0xC3,
+    0x9F, 0xFE, 0x94, 0x9F, 0xFC, 0x97, 0x9F, 0xC9, 0x40, 0x5A, 0xAA, 0xA9, 0x39, 0xAA, 0xA7, 0x3F,
+    0x93, 0xF7, 0x3F, 0xFF, 0xA7, 0x39, 0xFF, 0xE7, 0x59, 0xFF, 0xC7, 0x70, 0xAF, 0xA9, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0xAF, 0xCA, 0x97, 0x59, 0xFF, 0xE9, 0x72, 0xAF, 0xFF, 0xD7,
+    0x0A, 0xFF, 0xFF, 0x6A, 0xFD, 0x92, 0x9F, 0xDA, 0x49, 0xFC, 0xA6, 0xAF, 0xC9, 0x3A, 0xFC, 0x70,
+    0xAF, 0xC3, 0xFC, 0x72, 0xFC, 0x91, 0xAF, 0xC7, 0x2A, 0xFA, 0x1F, 0xC9, 0x72, 0x9F, 0xC1, 0xFC,
+    0x74, 0xFC, 0x1F, 0xC7, 0x4F, 0xC1, 0xFC, 0x74, 0xFC, 0x99, 0xFC, 0x74, 0xFC, 0x99, 0xFC, 0x74,
+    0xFC, 0x90, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0x74, 0xFC, 0x1F, 0xD7, 0x2A, 0xFC, 0x1F, 0xDA, 0x70,
+    0x9F, 0xD1, 0xFF, 0xA9, 0x90, 0x99, 0xAF, 0xF1, 0xAF, 0xFF, 0xFF, 0xCA, 0x2F, 0xFF, 0xFF, 0xC9,
+    0x2A, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE9, 0x5F, 0xFF, 0xFC, 0xA7, 0xAF, 0xFF, 0xD9, 0x72, 0x9A,
+    0xFE, 0xAA, 0x97, 0x77, 0x60, 0x1A, 0xAA, 0xA9, 0x39, 0xAA, 0xA3, 0xF9, 0x3F, 0x3F, 0xFF, 0xA3,
+    0x9F, 0xFE, 0x59, 0xFF, 0xC7, 0x0A, 0xFA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x59, 0xAF, 0x97, 0x9F,
+    0xFC, 0x94, 0x9F, 0xFE, 0x93, 0xFD, 0xAA, 0xFC, 0x2A, 0xF9, 0x29, 0xFA, 0x1F, 0xA4, 0x9F, 0x1F,
+    0x6F, 0x99, 0xF6, 0xFA, 0x9F, 0x6A, 0xEA, 0xAF, 0x6A, 0xEA, 0x9F, 0x6F, 0xA9, 0xF9, 0x5F, 0xA0,
+    0xFC, 0x4F, 0xC9, 0x0F, 0xFF, 0xE1, 0xAF, 0xFF, 0xCA, 0x2F, 0xFF, 0xC3, 0x9F, 0xFE, 0x94, 0x9F,
+    0xFC, 0x97, 0x9F, 0xC9, 0x40, 0x77, 0x77, 0x2A, 0xF7, 0xAF, 0x7F, 0xC7, 0xFC, 0x69, 0xFC, 0x69,
+    0xFC, 0x6A, 0xFC, 0x6A, 0xFC, 0x6F, 0xCA, 0x6F, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9A,
+    0xFC, 0xA9, 0x77, 0x9F, 0xFE, 0x97, 0x4A, 0xFF, 0xFD, 0x72, 0xAF, 0xFF, 0xF7, 0x0A, 0xFD, 0x92,
+    0x9F, 0xDA, 0x69, 0xFC, 0xA6, 0xAF, 0xC9, 0x5A, 0xFC, 0x70, 0xAF, 0xC5, 0xFC, 0x72, 0xFC, 0x93,
+    0xAF, 0xC7, 0x2A, 0xFA, 0x3F, 0xC9, 0x72, 0x9F, 0xC3, 0xFC, 0x74, 0xFC, 0x3F, 0xC7, 0x4F, 0xC3,
+    0xFC, 0x74, 0xFC, 0x91, 0x9F, 0xC7, 0x4F, 0xC9, 0x19, 0xFC, 0x74, 0xFC, 0x92, 0xFC, 0x74, 0xFC,
+    0x92, 0xFC, 0x74, 0xFC, 0x3F, 0xD7, 0x2A, 0xFC, 0x3F, 0xDA, 0x70, 0x9F, 0xD3, 0xFF, 0xA9, 0x90,
+    0x99, 0xAF, 0xF3, 0xAF, 0xFF, 0xFF, 0xCA, 0x4F, 0xFF, 0xFF, 0xC9, 0x4A, 0xFF, 0xFF, 0xF6, 0xFF,
+    0xFF, 0xE9, 0x7F, 0xFF, 0xFC, 0xA7, 0x1A, 0xFF, 0xFD, 0x97, 0x49, 0xAF, 0xEA, 0xA9, 0x77, 0x77,
+    0x20, 0x77, 0x76, 0xAF, 0x7A, 0xF5, 0xFC, 0x7F, 0xC4, 0x9F, 0xC6, 0x9F, 0xC4, 0xAF, 0xC6, 0xAF,
+    0xC4, 0xFC, 0xA6, 0xFC, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xF9, 0x77, 0x9F, 0xFC, 0x97,
+    0x49, 0xFF, 0xE9, 0x73, 0xFD, 0xAA, 0xFC, 0x72, 0xAF, 0x92, 0x9F, 0xA7, 0x1F, 0xA4, 0x9F, 0x71,
+    0xF6, 0xF9, 0x79, 0xF6, 0xFA, 0x79, 0xF6, 0xAE, 0xA7, 0xAF, 0x6A, 0xEA, 0x79, 0xF6, 0xFA, 0x79,
+    0xF9, 0x5F, 0xA7, 0x0F, 0xC4, 0xFC, 0x97, 0x0F, 0xFF, 0xE7, 0x1A, 0xFF, 0xFC, 0xA7, 0x2F, 0xFF,
+    0xC7, 0x39, 0xFF, 0xE9, 0x74, 0x9F, 0xFC, 0x97, 0x79, 0xFC, 0x97, 0x20, 0x79, 0xAF, 0xCA, 0x77,
+    0x99, 0x69, 0xFF, 0xFF, 0xFF, 0xDA, 0x5A, 0xFF, 0xFF, 0xFF, 0xE9, 0x4A, 0xFF, 0xFF, 0xFF, 0xF4,
+    0xAF, 0xD9, 0x29, 0xFF, 0xFF, 0xCA, 0x4F, 0xD6, 0xAF, 0xCA, 0x97, 0x4A, 0xFC, 0x70, 0xFD, 0x75,
+    0xFC, 0x97, 0x09, 0xFC, 0x97, 0x3A, 0xFC, 0x71, 0x9F, 0xCA, 0x73, 0xAF, 0x97, 0x19, 0xFD, 0x73,
+    0xFC, 0x72, 0x9F, 0xD7, 0x3F, 0xC7, 0x29, 0xFF, 0xF9, 0x4F, 0xC7, 0x29, 0xFF, 0xF9, 0x4F, 0xC7,
+    0x2A, 0xFF, 0xF9, 0x39, 0xFC, 0x72, 0xAF, 0xFF, 0x94, 0xFC, 0x72, 0xAF, 0xDA, 0xA9, 0x99, 0x95,
+    0xFC, 0x72, 0xAF, 0xD9, 0x72, 0xFD, 0x71, 0xAF, 0xD7, 0x3F, 0xDA, 0x70, 0xAF, 0xD7, 0x3F, 0xFC,
+    0xAA, 0x9A, 0xAA, 0xFF, 0x73, 0xAF, 0xFF, 0xFF, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xE3, 0xAF, 0xFF, 0xFF, 0xFF, 0xD9, 0x3F, 0xFF, 0xFF, 0xFF, 0xDA, 0x4F, 0xFF, 0xFF, 0xFF,
+    0xD5, 0xAF, 0xFF, 0xFF, 0xFF, 0x79, 0xAF, 0xFF, 0xFF, 0xFC, 0x97, 0x77, 0x72, 0x49, 0xAF, 0x97,
+    0x73, 0x9F, 0xFC, 0x93, 0xAE, 0xA9, 0x69, 0xFF, 0xE1, 0xAF, 0xF9, 0x4F, 0xDA, 0xAF, 0xFF, 0xF9,
+    0x2A, 0xF9, 0x29, 0xFF, 0x92, 0xF2, 0xFA, 0x49, 0xFD, 0x5E, 0xA1, 0xF6, 0xFD, 0xAA, 0xAA, 0xAF,
+    0xC0, 0x9F, 0x6F, 0xFF, 0xF0, 0x9F, 0x6A, 0xFF, 0xFE, 0x9A, 0xF6, 0xAF, 0xFF, 0xEA, 0x9F, 0x6F,
+    0xCA, 0x99, 0x99, 0x69, 0xF9, 0x5F, 0xC7, 0x4F, 0xC4, 0xFD, 0xA7, 0x3F, 0xFF, 0xFD, 0x95, 0xAC,
+    0x90, 0xAF, 0xFF, 0xFF, 0xFD, 0x91, 0xFF, 0xFF, 0xFF, 0xD9, 0x19, 0xFF, 0xEA, 0xFF, 0xFC, 0x92,
+    0x9F, 0xFC, 0x90, 0x9F, 0xFF, 0x59, 0xFC, 0x94, 0x9A, 0xFC, 0xA9, 0x20, 0x7A, 0xDA, 0x77, 0xE9,
+    0x76, 0x9E, 0x77, 0xEA, 0x76, 0x9E, 0x97, 0x6F, 0x77, 0x77, 0x77, 0x77, 0x7A, 0xFF, 0xA9, 0x70,
+    0xFF, 0xF9, 0x6F, 0xFF, 0xC9, 0x5F, 0x99, 0x99, 0x9A, 0xF5, 0xF5, 0xAE, 0xA4, 0xF6, 0xF4, 0xF6,
+    0xF4, 0xF6, 0xF3, 0x9F, 0x59, 0xF3, 0x9F, 0x5F, 0xC3, 0x9F, 0xAA, 0xAA, 0xFD, 0x93, 0x9F, 0xFF,
+    0xD4, 0xAF, 0xFF, 0xC5, 0xAF, 0xFF, 0xC5, 0xAF, 0xFF, 0xD4, 0xAF, 0xD9, 0x09, 0xFC, 0x93, 0xFD,
+    0x39, 0xFC, 0x3F, 0xD4, 0xFC, 0x3F, 0xD4, 0xFC, 0xA2, 0xFD, 0x4F, 0xD2, 0xFD, 0x93, 0xFD, 0x2F,
+    0xD9, 0x3F, 0xDA, 0x1F, 0xD9, 0x3F, 0xE1, 0xFD, 0xA3, 0xFE, 0x1A, 0xAA, 0xAA, 0xA9, 0x3A, 0xAA,
+    0xAA, 0xAA, 0x00, 0x77, 0x1A, 0xD9, 0x70, 0xE7, 0x0A, 0xE7, 0x0E, 0x97, 0xAE, 0x70, 0xF7, 0x74,
+    0xF9, 0x9A, 0xE2, 0xFF, 0xD2, 0xFF, 0xD9, 0x1F, 0xFD, 0x91, 0xFD, 0x91, 0x92, 0xFC, 0x7F, 0x97,
+    0xF9, 0x7F, 0x96, 0x9F, 0x96, 0x9F, 0x96, 0xAF, 0x96, 0xAF, 0xA6, 0xFC, 0xA6, 0xFD, 0x6F, 0xD5,
+    0x9F, 0xD5, 0x49, 0x99, 0x99, 0x97, 0x5F, 0xDA, 0x74, 0xFD, 0x97, 0x4F, 0xD7, 0x5F, 0xD7, 0x49,
+    0xFC, 0xA7, 0x4A, 0xFC, 0x97, 0x4F, 0xD7, 0x49, 0xFC, 0xA7, 0x4A, 0xFC, 0x97, 0x4A, 0xAA, 0xAA,
+    0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xFF, 0xA9, 0x70, 0xFF, 0xF9, 0x6F, 0xFF, 0xC9, 0x5F,
+    0x99, 0x99, 0x9A, 0xF5, 0xF5, 0xAE, 0xA4, 0xF6, 0xF4, 0xF6, 0xF4, 0xF6, 0xF3, 0x9F, 0x59, 0xF3,
+    0x9F, 0x5F, 0xC3, 0x9F, 0xAA, 0xAA, 0xFD, 0x93, 0x9F, 0xFF, 0xD4, 0xAF, 0xFF, 0xC5, 0xAF, 0xFF,
+    0xC5, 0xAF, 0xFF, 0xD4, 0xAF, 0xD9, 0x09, 0xFC, 0x93, 0xFD, 0x39, 0xFC, 0x3F, 0xD4, 0xFC, 0x3F,
+    0xD4, 0xFC, 0xA2, 0xFD, 0x4F, 0xD2, 0xFD, 0x93, 0xFD, 0x2F, 0xD9, 0x3F, 0xDA, 0x1F, 0xD9, 0x3F,
+    0xE1, 0xFD, 0xA3, 0xFE, 0x1A, 0xAA, 0xAA, 0xA9, 0x3A, 0xAA, 0xAA, 0xAA, 0x00, 0x19, 0xFD, 0xA5,
+    0x9F, 0xD9, 0x59, 0xFD, 0x69, 0xFC, 0xA6, 0x9F, 0xC9, 0x6A, 0xFC, 0x7F, 0xD6, 0x9F, 0xCA, 0x6F,
+    0xD9, 0x6F, 0xD7, 0x77, 0x77, 0x73, 0xF9, 0x9A, 0xE3, 0xFF, 0xD3, 0xFF, 0xD9, 0x2F, 0xFD, 0x92,
+    0xFD, 0x91, 0x93, 0xFC, 0x70, 0xF9, 0x70, 0xF9, 0x70, 0xF9, 0x79, 0xF9, 0x79, 0xF9, 0x7A, 0xF9,
+    0x7A, 0xFA, 0x7F, 0xCA, 0x7F, 0xD7, 0xFD, 0x69, 0xFD, 0x50, 0x77, 0x49, 0xEA, 0x49, 0xEA, 0x59,
+    0xF9, 0x1A, 0xEA, 0x79, 0xFA, 0xFA, 0x71, 0x9F, 0xEA, 0x73, 0x9F, 0xCA, 0x75, 0x9F, 0x77, 0xAD,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xFF, 0xA9, 0x70, 0xFF, 0xF9, 0x6F, 0xFF, 0xC9, 0x5F,
+    0x99, 0x99, 0x9A, 0xF5, 0xF5, 0xAE, 0xA4, 0xF6, 0xF4, 0xF6, 0xF4, 0xF6, 0xF3, 0x9F, 0x59, 0xF3,
+    0x9F, 0x5F, 0xC3, 0x9F, 0xAA, 0xAA, 0xFD, 0x93, 0x9F, 0xFF, 0xD4, 0xAF, 0xFF, 0xC5, 0xAF, 0xFF,
+    0xC5, 0xAF, 0xFF, 0xD4, 0xAF, 0xD9, 0x09, 0xFC, 0x93, 0xFD, 0x39, 0xFC, 0x3F, 0xD4, 0xFC, 0x3F,
+    0xD4, 0xFC, 0xA2, 0xFD, 0x4F, 0xD2, 0xFD, 0x93, 0xFD, 0x2F, 0xD9, 0x3F, 0xDA, 0x1F, 0xD9, 0x3F,
+    0xE1, 0xFD, 0xA3, 0xFE, 0x1A, 0xAA, 0xAA, 0xA9, 0x3A, 0xAA, 0xAA, 0xAA, 0x00, 0x0A, 0xDA, 0x6A,
+    0xDA, 0x2F, 0x92, 0x9F, 0x4F, 0xA0, 0xFC, 0x6F, 0xFC, 0x70, 0xFE, 0x72, 0xFC, 0x74, 0xE9, 0x74,
+    0x99, 0x97, 0x77, 0x77, 0x5F, 0x99, 0xAE, 0x6F, 0xFD, 0x6F, 0xFD, 0x95, 0xFF, 0xD9, 0x5F, 0xD9,
+    0x19, 0x6F, 0xC7, 0x3F, 0x97, 0x3F, 0x97, 0x3F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x2A, 0xF9,
+    0x72, 0xAF, 0xA7, 0x2F, 0xCA, 0x72, 0xFD, 0x72, 0xFD, 0x71, 0x9F, 0xD6, 0x77, 0x77, 0x1A, 0xD9,
+    0x77, 0x2E, 0x77, 0x2A, 0xE7, 0x72, 0xE9, 0x77, 0x1A, 0xE7, 0x72, 0xF7, 0x77, 0x77, 0x77, 0x77,
+    0x75, 0x9F, 0xFC, 0xA9, 0x70, 0x9F, 0xFF, 0xA7, 0x9F, 0xFF, 0xC7, 0x0F, 0xFF, 0xCA, 0x7A, 0xFD,
+    0x92, 0x9A, 0xC7, 0x0F, 0xCA, 0x77, 0x0F, 0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xC9, 0x77, 0x0A, 0xFC,
+    0xA9, 0x76, 0x9F, 0xFC, 0xA9, 0x73, 0xAF, 0xFF, 0x97, 0x1F, 0xFF, 0xD7, 0x19, 0xFF, 0xFC, 0x97,
+    0x19, 0xAF, 0xFE, 0x75, 0x9A, 0xFF, 0x77, 0xAF, 0xD7, 0x70, 0xAF, 0xC9, 0x3D, 0xA7, 0x0A, 0xFC,
+    0x92, 0xAF, 0xCA, 0x49, 0xFD, 0x91, 0x9F, 0xFF, 0xFE, 0x19, 0xFF, 0xFF, 0xE9, 0x1F, 0xFF, 0xFE,
+    0x93, 0xAF, 0xFF, 0xEA, 0x79, 0x9A, 0xFF, 0xA9, 0x77, 0x74, 0x70, 0xE7, 0x4A, 0xDA, 0x74, 0xE9,
+    0x73, 0xAE, 0x74, 0xEA, 0x73, 0xAE, 0x97, 0x77, 0x77, 0x4A, 0xFD, 0xA9, 0x59, 0xFF, 0xD9, 0x4F,
+    0xAA, 0xAF, 0x5E, 0x94, 0x99, 0x5E, 0x75, 0xEA, 0x74, 0xAF, 0xA9, 0x72, 0xFF, 0xA7, 0x0A, 0xFF,
+    0xA7, 0x0A, 0xFE, 0xA7, 0x29, 0xFC, 0x49, 0x5A, 0xFA, 0x2A, 0xCA, 0x4A, 0xFA, 0x19, 0xFC, 0xAA,
+    0xAF, 0xCA, 0x09, 0xFF, 0xFD, 0x1F, 0xFF, 0xD9, 0x1A, 0xFF, 0xF9, 0x49, 0xAA, 0xFC, 0xA9, 0x77,
+    0x40, 0x71, 0xE7, 0x72, 0xF9, 0x77, 0x0A, 0xFC, 0x77, 0xAF, 0xE7, 0x5A, 0xFF, 0xC7, 0x3A, 0xEA,
+    0x19, 0xF7, 0x1A, 0xE9, 0x4F, 0x70, 0x99, 0x97, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9F,
+    0xFC, 0xA9, 0x70, 0x9F, 0xFF, 0xA7, 0x9F, 0xFF, 0xC7, 0x0F, 0xFF, 0xCA, 0x7A, 0xFD, 0x92, 0x9A,
+    0xC7, 0x0F, 0xCA, 0x77, 0x0F, 0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xC9, 0x77, 0x0A, 0xFC, 0xA9, 0x76,
+    0x9F, 0xFC, 0xA9, 0x73, 0xAF, 0xFF, 0x97, 0x1F, 0xFF, 0xD7, 0x19, 0xFF, 0xFC, 0x97, 0x19, 0xAF,
+    0xFE, 0x75, 0x9A, 0xFF, 0x77, 0xAF, 0xD7, 0x70, 0xAF, 0xC9, 0x3D, 0xA7, 0x0A, 0xFC, 0x92, 0xAF,
+    0xCA, 0x49, 0xFD, 0x91, 0x9F, 0xFF, 0xFE, 0x19, 0xFF, 0xFF, 0xE9, 0x1F, 0xFF, 0xFE, 0x93, 0xAF,
+    0xFF, 0xEA, 0x79, 0x9A, 0xFF, 0xA9, 0x77, 0x74, 0x77, 0x7E, 0x97, 0x39, 0xF7, 0x29, 0xFD, 0x70,
+    0x9F, 0xF6, 0x9F, 0xAF, 0xC4, 0x9F, 0x2A, 0xF2, 0x9E, 0xA5, 0xF7, 0x77, 0x77, 0xAF, 0xDA, 0x95,
+    0x9F, 0xFD, 0x94, 0xFA, 0xAA, 0xF5, 0xE9, 0x49, 0x95, 0xE7, 0x5E, 0xA7, 0x4A, 0xFA, 0x97, 0x2F,
+    0xFA, 0x70, 0xAF, 0xFA, 0x70, 0xAF, 0xEA, 0x72, 0x9F, 0xC4, 0x95, 0xAF, 0xA2, 0xAC, 0xA4, 0xAF,
+    0xA1, 0x9F, 0xCA, 0xAA, 0xFC, 0xA0, 0x9F, 0xFF, 0xD1, 0xFF, 0xFD, 0x91, 0xAF, 0xFF, 0x94, 0x9A,
+    0xAF, 0xCA, 0x97, 0x74, 0x77, 0x75, 0x9F, 0xFC, 0xA9, 0x70, 0x9F, 0xFF, 0xA7, 0x9F, 0xFF, 0xC7,
+    0x0F, 0xFF, 0xCA, 0x7A, 0xFD, 0x92, 0x9A, 0xC7, 0x0F, 0xCA, 0x77, 0x0F, 0xC7, 0x71, 0xFC, 0x77,
+    0x1F, 0xC9, 0x77, 0x0A, 0xFC, 0xA9, 0x76, 0x9F, 0xFC, 0xA9, 0x73, 0xAF, 0xFF, 0x97, 0x1F, 0xFF,
+    0xD7, 0x19, 0xFF, 0xFC, 0x97, 0x19, 0xAF, 0xFE, 0x75, 0x9A, 0xFF, 0x77, 0xAF, 0xD7, 0x70, 0xAF,
+    0xC9, 0x3D, 0xA7, 0x0A, 0xFC, 0x92, 0xFD, 0xA4, 0x9F, 0xD9, 0x1F, 0xFF, 0xFF, 0x1A, 0xFF, 0xFF,
+    0xE9, 0x1A, 0xFF, 0xFF, 0xD9, 0x49, 0xAF, 0xFF, 0xCA, 0x71, 0x9F, 0xFA, 0x97, 0x3A, 0xD7, 0x73,
+    0xFC, 0x97, 0x70, 0xFD, 0x77, 0x09, 0x1A, 0xD7, 0x70, 0xFD, 0x77, 0x0F, 0xC9, 0x77, 0x9F, 0x97,
+    0x30, 0x77, 0x5A, 0xFD, 0xA9, 0x59, 0xFF, 0xD9, 0x4F, 0xAA, 0xAF, 0x5E, 0x94, 0x99, 0x5E, 0x75,
+    0xEA, 0x74, 0xAF, 0xA9, 0x72, 0xFF, 0xA7, 0x0A, 0xFF, 0xA7, 0x0A, 0xFE, 0xA7, 0x29, 0xFC, 0x49,
+    0x5A, 0xFA, 0x29, 0xCA, 0x4A, 0xFA, 0x19, 0xFC, 0xAA, 0xAF, 0xCA, 0x1F, 0xFF, 0xD1, 0xFF, 0xFD,
+    0x91, 0xFF, 0xFC, 0x93, 0x9A, 0xFE, 0xA9, 0x7A, 0xCA, 0x75, 0xF9, 0x72, 0xAF, 0xC9, 0x71, 0xAA,
+    0x9A, 0xDA, 0x71, 0x9F, 0xC9, 0x71, 0xAF, 0xC7, 0x2F, 0xA7, 0x00, 0x77, 0x72, 0x9E, 0xA4, 0xAE,
+    0xA7, 0x09, 0xF2, 0xFA, 0x72, 0x9F, 0xAF, 0x97, 0x49, 0xFE, 0x97, 0x69, 0xFC, 0x97, 0x70, 0xAE,
+    0xA7, 0x72, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0xFF, 0xCA, 0x97, 0x09, 0xFF, 0xFA,
+    0x79, 0xFF, 0xFC, 0x70, 0xFF, 0xFC, 0xA7, 0xAF, 0xD9, 0x29, 0xAC, 0x70, 0xFC, 0xA7, 0x70, 0xFC,
+    0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x97, 0x70, 0xAF, 0xCA, 0x97, 0x69, 0xFF, 0xCA, 0x97, 0x3A, 0xFF,
+    0xF9, 0x71, 0xFF, 0xFD, 0x71, 0x9F, 0xFF, 0xC9, 0x71, 0x9A, 0xFF, 0xE7, 0x59, 0xAF, 0xF7, 0x7A,
+    0xFD, 0x77, 0x0A, 0xFC, 0x93, 0xDA, 0x70, 0xAF, 0xC9, 0x2A, 0xFC, 0xA4, 0x9F, 0xD9, 0x19, 0xFF,
+    0xFF, 0xE1, 0x9F, 0xFF, 0xFE, 0x91, 0xFF, 0xFF, 0xE9, 0x3A, 0xFF, 0xFE, 0xA7, 0x99, 0xAF, 0xFA,
+    0x97, 0x77, 0x40, 0x77, 0x2F, 0x5F, 0x3F, 0x91, 0x9F, 0x5F, 0xAA, 0xF7, 0xFF, 0x71, 0xFD, 0x73,
+    0xF9, 0x73, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x5A, 0xFD, 0xA9, 0x59, 0xFF, 0xD9, 0x4F, 0xAA, 0xAF,
+    0x5E, 0x94, 0x99, 0x5E, 0x75, 0xEA, 0x74, 0xAF, 0xA9, 0x72, 0xFF, 0xA7, 0x0A, 0xFF, 0xA7, 0x0A,
+    0xFE, 0xA7, 0x29, 0xFC, 0x49, 0x5A, 0xFA, 0x2A, 0xCA, 0x4A, 0xFA, 0x19, 0xFC, 0xAA, 0xAF, 0xCA,
+    0x09, 0xFF, 0xFD, 0x1F, 0xFF, 0xD9, 0x1A, 0xFF, 0xF9, 0x49, 0xAA, 0xFC, 0xA9, 0x77, 0x40, 0x9F,
+    0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F,
+    0xFF, 0xFF, 0xC7, 0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xC7, 0x70,
+    0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F,
+    0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x77, 0xAF, 0xC9,
+    0x77, 0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x77, 0x1D, 0x97, 0x72,
+    0x9D, 0x77, 0x3F, 0xA7, 0x71, 0xFC, 0xA7, 0x70, 0xA9, 0x9E, 0x77, 0x0F, 0xD7, 0x70, 0xFC, 0x97,
+    0x79, 0xF9, 0x70, 0x7A, 0x97, 0x19, 0xAD, 0x97, 0x1F, 0x97, 0x1F, 0x97, 0x1F, 0x72, 0xF7, 0xFF,
+    0xEA, 0x1A, 0xFF, 0xF1, 0xFF, 0xFC, 0x1A, 0xAA, 0xAF, 0xAA, 0xAA, 0xA4, 0x9F, 0x71, 0x9F, 0x71,
+    0x9F, 0x71, 0x9F, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0xAA, 0x9A, 0x94, 0xAF, 0xFA,
+    0x4A, 0xFF, 0xC4, 0xAF, 0xFC, 0x5F, 0xFC, 0x49, 0xD9, 0x72, 0xAE, 0xA7, 0x1F, 0xD7, 0x0A, 0x99,
+    0xAD, 0x97, 0xFD, 0x70, 0xFC, 0xA7, 0x0F, 0xA5, 0x39, 0x99, 0x96, 0x99, 0x99, 0x79, 0xEA, 0x39,
+    0xF7, 0x19, 0xF9, 0x0A, 0xF7, 0x39, 0xFF, 0xC7, 0x59, 0xFE, 0x77, 0x9F, 0xC7, 0x71, 0xAE, 0x97,
+    0x72, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xFF, 0xFF, 0xFC, 0x09, 0xFF, 0xFF, 0xFC,
+    0x09, 0xFF, 0xFF, 0xFC, 0x09, 0xFF, 0xFF, 0xFC, 0x09, 0xFF, 0xFF, 0xFC, 0x71, 0xFC, 0x77, 0x1F,
+    0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x09, 0xFC, 0x77, 0x09, 0xFC, 0x77, 0x09,
+    0xFC, 0x77, 0x09, 0xFC, 0x77, 0x09, 0xFC, 0x77, 0x09, 0xFC, 0x77, 0x09, 0xFC, 0x77, 0x09, 0xFC,
+    0x77, 0x0A, 0xFC, 0x97, 0x7A, 0xFC, 0x97, 0x7A, 0xFC, 0x97, 0x7A, 0xFC, 0x97, 0x7A, 0xFC, 0x97,
+    0x7A, 0xFC, 0x97, 0x7A, 0xFC, 0x97, 0x76, 0xAD, 0xA7, 0x6F, 0x76, 0xF7, 0x59, 0xF7, 0x59, 0xEA,
+    0x7A, 0x93, 0xAE, 0xA4, 0x9A, 0xD9, 0x3A, 0xEA, 0x4F, 0x93, 0xFA, 0x4F, 0x97, 0x5F, 0x76, 0xF7,
+    0x3F, 0xFE, 0xA5, 0xAF, 0xFF, 0x5F, 0xFF, 0xC5, 0xAA, 0xAA, 0xFA, 0xAA, 0xAA, 0x70, 0x9F, 0x75,
+    0x9F, 0x75, 0x9F, 0x75, 0x9F, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0xAA, 0x9A, 0x97,
+    0x0A, 0xFF, 0xA7, 0x0A, 0xFF, 0xC7, 0x0A, 0xFF, 0xC7, 0x1F, 0xFC, 0x77, 0x70, 0x9F, 0xFF, 0xFF,
+    0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF,
+    0xC7, 0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x74,
+    0x99, 0x99, 0xAF, 0xC9, 0x99, 0x97, 0x0F, 0xFF, 0xD9, 0x7F, 0xFF, 0xD9, 0x7F, 0xFF, 0xD9, 0x73,
+    0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC9, 0x77, 0xAF, 0xC9, 0x77, 0xAF,
+    0xC9, 0x77, 0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x70, 0x70, 0xA9,
+    0x72, 0x9A, 0xD9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF7, 0x3F, 0x70, 0xFF, 0xEA, 0x2A, 0xFF, 0xF2,
+    0xFF, 0xFC, 0x2A, 0xAA, 0xAF, 0xAA, 0xAA, 0xA5, 0x9F, 0x5A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A,
+    0xFF, 0xFD, 0x09, 0x99, 0x99, 0xFC, 0x99, 0x99, 0x95, 0xAF, 0x72, 0xAF, 0x72, 0xAF, 0xAA, 0x9A,
+    0x95, 0xAF, 0xFA, 0x5A, 0xFF, 0xC5, 0xAF, 0xFC, 0x6F, 0xFC, 0x77, 0x00, 0x6A, 0xDA, 0x19, 0xD7,
+    0x39, 0xFA, 0x09, 0xD9, 0x72, 0xFD, 0x99, 0xD7, 0x3D, 0xA0, 0xFD, 0x73, 0xDA, 0x09, 0xFA, 0x73,
+    0xE1, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0xFD, 0x7F, 0xD9, 0x0F,
+    0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD1, 0xFD, 0x7F, 0xD1,
+    0xFD, 0x7F, 0xD1, 0xFD, 0x7F, 0xD1, 0xFD, 0x7F, 0xD1, 0xFC, 0xA7, 0xFD, 0x1F, 0xCA, 0x7A, 0xFC,
+    0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC,
+    0x1F, 0xCA, 0x7A, 0xFA, 0x1A, 0xFC, 0x7F, 0xCA, 0x1A, 0xFC, 0x95, 0x9F, 0xCA, 0x1A, 0xFE, 0xAA,
+    0xAA, 0xFE, 0x91, 0x9F, 0xFF, 0xFD, 0x92, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xD3, 0x9F, 0xFF, 0xF9,
+    0x4A, 0xFF, 0xFD, 0xA6, 0x9F, 0xFF, 0x97, 0x77, 0x10, 0x4A, 0xCA, 0x2D, 0x96, 0xFC, 0x1E, 0x59,
+    0xFD, 0x0D, 0xA5, 0xAD, 0x0A, 0xFC, 0xA5, 0xAD, 0x1F, 0xC9, 0x59, 0xD9, 0x1A, 0xD9, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x70, 0xAE, 0x96, 0xF0, 0x9E, 0x95, 0x9F, 0x09, 0xE9, 0x59, 0xF0, 0x9E, 0xA5,
+    0x9F, 0x09, 0xEA, 0x59, 0xF1, 0xEA, 0x59, 0xF1, 0xEA, 0x59, 0xF1, 0xF5, 0xAF, 0x1F, 0x5A, 0xF1,
+    0xF5, 0xFC, 0x1F, 0x94, 0xFC, 0x90, 0xFC, 0x92, 0xAF, 0xC9, 0x0A, 0xFF, 0xFD, 0x90, 0x9F, 0xFF,
+    0xD9, 0x1F, 0xFF, 0xD9, 0x1A, 0xFF, 0xFC, 0x92, 0xFF, 0xFC, 0xA3, 0x9A, 0xF9, 0x50, 0x77, 0x97,
+    0x09, 0xAA, 0xAF, 0xFC, 0x70, 0xFF, 0xFC, 0xA6, 0x9F, 0xFF, 0xD6, 0xAF, 0xFA, 0xAA, 0xAA, 0xA7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD,
+    0x90, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD1, 0xFD, 0x7F, 0xD1, 0xFD, 0x7F,
+    0xD1, 0xFD, 0x7F, 0xD1, 0xFD, 0x7F, 0xD1, 0xFC, 0xA7, 0xFD, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA,
+    0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA,
+    0x7A, 0xFA, 0x1A, 0xFC, 0x7F, 0xCA, 0x1A, 0xFC, 0x95, 0x9F, 0xCA, 0x1A, 0xFE, 0xAA, 0xAA, 0xFE,
+    0x91, 0x9F, 0xFF, 0xFD, 0x92, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xD3, 0x9F, 0xFF, 0xF9, 0x4A, 0xFF,
+    0xFD, 0xA6, 0x9F, 0xFF, 0x97, 0x77, 0x10, 0x69, 0x99, 0x9A, 0xAA, 0x93, 0xFF, 0xFC, 0x2A, 0xFF,
+    0xFC, 0x91, 0xFF, 0xFD, 0xA1, 0xAA, 0xAA, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72,
+    0xAE, 0x96, 0xF0, 0x9E, 0x95, 0x9F, 0x09, 0xE9, 0x59, 0xF0, 0x9E, 0xA5, 0x9F, 0x09, 0xEA, 0x59,
+    0xF1, 0xEA, 0x59, 0xF1, 0xEA, 0x59, 0xF1, 0xF5, 0xAF, 0x1F, 0x5A, 0xF1, 0xF5, 0xFC, 0x1F, 0x94,
+    0xFC, 0x90, 0xFC, 0x92, 0xAF, 0xC9, 0x0A, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD9, 0x1F, 0xFF, 0xD9,
+    0x1A, 0xFF, 0xFC, 0x92, 0xFF, 0xFC, 0xA3, 0x9A, 0xF9, 0x50, 0x39, 0xAA, 0xA9, 0x93, 0xAA, 0xA9,
+    0x79, 0xEA, 0x39, 0xEA, 0x70, 0xFF, 0xF9, 0x70, 0xAF, 0xFD, 0xA7, 0x2F, 0xFC, 0xA7, 0x49, 0xAF,
+    0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD,
+    0x90, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD1, 0xFD, 0x7F, 0xD1, 0xFD, 0x7F,
+    0xD1, 0xFD, 0x7F, 0xD1, 0xFD, 0x7F, 0xD1, 0xFC, 0xA7, 0xFD, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA,
+    0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA,
+    0x7A, 0xFA, 0x1A, 0xFC, 0x7F, 0xCA, 0x1A, 0xFC, 0x95, 0x9F, 0xCA, 0x1A, 0xFE, 0xAA, 0xAA, 0xFE,
+    0x91, 0x9F, 0xFF, 0xFD, 0x92, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xD3, 0x9F, 0xFF, 0xF9, 0x4A, 0xFF,
+    0xFD, 0xA6, 0x9F, 0xFF, 0x97, 0x77, 0x10, 0x77, 0x2F, 0x4A, 0xE3, 0xFA, 0x99, 0x9A, 0xF3, 0xAF,
+    0xFE, 0xA4, 0xFF, 0xE5, 0x9F, 0xFA, 0x70, 0x9A, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAE,
+    0x96, 0xF0, 0x9E, 0x95, 0x9F, 0x09, 0xE9, 0x59, 0xF0, 0x9E, 0xA5, 0x9F, 0x09, 0xEA, 0x59, 0xF1,
+    0xEA, 0x59, 0xF1, 0xEA, 0x59, 0xF1, 0xF5, 0xAF, 0x1F, 0x5A, 0xF1, 0xF5, 0xFC, 0x1F, 0x94, 0xFC,
+    0x90, 0xFC, 0x92, 0xAF, 0xC9, 0x0A, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD9, 0x1F, 0xFF, 0xD9, 0x1A,
+    0xFF, 0xFC, 0x92, 0xFF, 0xFC, 0xA3, 0x9A, 0xF9, 0x50, 0x70, 0xAD, 0x97, 0x70, 0xFC, 0x97, 0x69,
+    0xDA, 0xE7, 0x6A, 0xD0, 0xAD, 0x76, 0xAF, 0xD7, 0x7F, 0xCA, 0x77, 0x9E, 0xA7, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7,
+    0xFD, 0x90, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xD7,
+    0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xCA, 0x7F, 0xD1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1,
+    0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xA1,
+    0xAF, 0xC7, 0xFC, 0xA1, 0xAF, 0xC9, 0x59, 0xFC, 0xA1, 0xAF, 0xEA, 0xAA, 0xAF, 0xE9, 0x19, 0xFF,
+    0xFF, 0xD9, 0x2F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x39, 0xFF, 0xFF, 0x94, 0xAF, 0xFF, 0xDA, 0x69,
+    0xFF, 0xF9, 0x77, 0x71, 0x69, 0x97, 0x5F, 0x97, 0x2A, 0xFC, 0x72, 0xDA, 0x9D, 0x97, 0x1D, 0xA9,
+    0xDA, 0x71, 0xFD, 0x97, 0x19, 0xFC, 0x73, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xE9,
+    0x6F, 0x09, 0xE9, 0x59, 0xF0, 0x9E, 0x95, 0x9F, 0x09, 0xEA, 0x59, 0xF0, 0x9E, 0xA5, 0x9F, 0x1E,
+    0xA5, 0x9F, 0x1E, 0xA5, 0x9F, 0x1F, 0x5A, 0xF1, 0xF5, 0xAF, 0x1F, 0x5F, 0xC1, 0xF9, 0x4F, 0xC9,
+    0x0F, 0xC9, 0x2A, 0xFC, 0x90, 0xAF, 0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0x91, 0xFF, 0xFD, 0x91, 0xAF,
+    0xFF, 0xC9, 0x2F, 0xFF, 0xCA, 0x39, 0xAF, 0x95, 0x77, 0x77, 0x0F, 0xA6, 0x9F, 0xA5, 0x9F, 0x96,
+    0x9F, 0x95, 0xAF, 0x96, 0xAF, 0x95, 0xFC, 0x96, 0xFC, 0x94, 0x9F, 0xC9, 0x59, 0xFC, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9F, 0xD7, 0xFD, 0x94, 0xFD, 0x7F, 0xD9, 0x4F, 0xD7,
+    0xFD, 0x94, 0xFD, 0x7F, 0xD9, 0x4F, 0xD7, 0xFD, 0x5F, 0xD7, 0xFD, 0x5F, 0xD7, 0xFD, 0x5F, 0xD7,
+    0xFD, 0x5F, 0xD7, 0xFD, 0x5F, 0xCA, 0x7F, 0xD5, 0xFC, 0xA7, 0xAF, 0xC5, 0xFC, 0xA7, 0xAF, 0xC5,
+    0xFC, 0xA7, 0xAF, 0xC5, 0xFC, 0xA7, 0xAF, 0xC5, 0xFC, 0xA7, 0xAF, 0xC5, 0xFC, 0xA7, 0xAF, 0xA5,
+    0xAF, 0xC7, 0xFC, 0xA5, 0xAF, 0xC9, 0x59, 0xFC, 0xA5, 0xAF, 0xEA, 0xAA, 0xAF, 0xE9, 0x59, 0xFF,
+    0xFF, 0xD9, 0x6F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFD, 0x79, 0xFF, 0xFF, 0x97, 0x0A, 0xFF, 0xFD, 0xA7,
+    0x29, 0xFF, 0xF9, 0x77, 0x77, 0x10, 0x5A, 0xF7, 0xAF, 0x5F, 0xC7, 0xFC, 0x49, 0xFC, 0x69, 0xFC,
+    0x4A, 0xFC, 0x6A, 0xFC, 0x4A, 0xFC, 0x6A, 0xFC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xAE,
+    0x96, 0xF7, 0x09, 0xE9, 0x59, 0xF7, 0x09, 0xE9, 0x59, 0xF7, 0x09, 0xEA, 0x59, 0xF7, 0x09, 0xEA,
+    0x59, 0xF7, 0x1E, 0xA5, 0x9F, 0x71, 0xEA, 0x59, 0xF7, 0x1F, 0x5A, 0xF7, 0x1F, 0x5A, 0xF7, 0x1F,
+    0x5F, 0xC7, 0x1F, 0x94, 0xFC, 0x97, 0x0F, 0xC9, 0x2A, 0xFC, 0x97, 0x0A, 0xFF, 0xFD, 0x97, 0x09,
+    0xFF, 0xFD, 0x97, 0x1F, 0xFF, 0xD9, 0x71, 0xAF, 0xFF, 0xC9, 0x72, 0xFF, 0xFC, 0xA7, 0x39, 0xAF,
+    0x97, 0x30, 0x9F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD9,
+    0x0F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F,
+    0xCA, 0x7F, 0xD1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC,
+    0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xA1, 0xAF, 0xC7, 0xFC, 0xA1, 0xAF,
+    0xC9, 0x59, 0xFC, 0xA1, 0xAF, 0xEA, 0xAA, 0xAF, 0xE9, 0x19, 0xFF, 0xFF, 0xD9, 0x2F, 0xFF, 0xFD,
+    0x3F, 0xFF, 0xFD, 0x39, 0xFF, 0xFF, 0x94, 0xAF, 0xFF, 0xDA, 0x69, 0xFF, 0xF9, 0x77, 0xEA, 0x77,
+    0x0E, 0xA7, 0x71, 0xE7, 0x71, 0x9F, 0xD7, 0x7F, 0xD9, 0x77, 0xAF, 0x97, 0x71, 0x99, 0x94, 0xAE,
+    0x96, 0xF0, 0x9E, 0x95, 0x9F, 0x09, 0xE9, 0x59, 0xF0, 0x9E, 0x95, 0x9F, 0x09, 0xEA, 0x59, 0xF1,
+    0xEA, 0x59, 0xF1, 0xEA, 0x5A, 0xF1, 0xF5, 0xAF, 0x1F, 0x5A, 0xF1, 0xF5, 0xAF, 0x1F, 0x5F, 0xC9,
+    0x0F, 0xA3, 0x9F, 0xC9, 0x0A, 0xFC, 0x99, 0x9F, 0xD9, 0x0A, 0xFF, 0xFD, 0x91, 0xFF, 0xFD, 0x91,
+    0xAF, 0xFF, 0xC9, 0x2F, 0xFF, 0xCA, 0x39, 0xAF, 0xAE, 0xA7, 0x3A, 0xE9, 0x72, 0x9E, 0x97, 0x3E,
+    0xA7, 0x4E, 0xA9, 0xA9, 0x71, 0xFD, 0xA7, 0x19, 0xFD, 0x73, 0x9E, 0x97, 0x71, 0x77, 0x77, 0x77,
+    0x9E, 0x77, 0x74, 0xF9, 0x77, 0x72, 0xFD, 0x97, 0x77, 0x0F, 0xF9, 0x77, 0x6F, 0xAA, 0xF9, 0x77,
+    0x4F, 0x91, 0x9F, 0x97, 0x72, 0xEA, 0x5A, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x74, 0xFC, 0xA7, 0x73, 0xAF, 0xA0, 0xFD, 0x77, 0x3F, 0xCA, 0x0F, 0xD7, 0x72, 0x9F, 0xC9, 0x0A,
+    0xFC, 0x97, 0x71, 0xAF, 0xC1, 0x9F, 0xCA, 0x77, 0x1F, 0xD2, 0xFD, 0x77, 0x1F, 0xCA, 0x2F, 0xD7,
+    0x70, 0x9F, 0xC9, 0x2A, 0xFC, 0x95, 0xF5, 0xAF, 0xC3, 0xAF, 0xCA, 0x4F, 0xCA, 0x4F, 0xD3, 0x9F,
+    0xD3, 0x9F, 0xD4, 0xFC, 0xA4, 0xFD, 0x3F, 0xEA, 0x29, 0xFC, 0x94, 0xFD, 0x91, 0x9F, 0xF2, 0xAF,
+    0xC5, 0xAF, 0xC9, 0x1F, 0xFC, 0x91, 0xFD, 0x59, 0xFC, 0xA0, 0x9F, 0xFD, 0x1F, 0xCA, 0x59, 0xFD,
+    0x0F, 0xFE, 0x99, 0xFC, 0x96, 0xFD, 0xAF, 0xFF, 0xAF, 0xC7, 0xFF, 0xFA, 0xAF, 0xFE, 0x7A, 0xFF,
+    0xE9, 0x9F, 0xFD, 0xA7, 0x9F, 0xFE, 0x1F, 0xFD, 0x97, 0x0F, 0xFD, 0xA1, 0xAF, 0xFC, 0x71, 0xFF,
+    0xD3, 0xFF, 0xC7, 0x1F, 0xFC, 0xA3, 0xFF, 0xA7, 0x1A, 0xFF, 0x93, 0x9F, 0xE9, 0x71, 0x9F, 0xF5,
+    0xFE, 0x73, 0xFE, 0xA5, 0xFE, 0x50, 0x77, 0x77, 0x2E, 0x97, 0x72, 0xAF, 0x77, 0x19, 0xFD, 0x77,
+    0x9F, 0xF7, 0x59, 0xF9, 0xFC, 0x73, 0x9F, 0x2A, 0xF7, 0x19, 0xE9, 0x5F, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x73, 0x9F, 0x75, 0xFC, 0x0F, 0x97, 0x4F, 0xA0, 0xFA, 0x73, 0x9F, 0x90, 0xAF,
+    0x49, 0x94, 0xAF, 0x19, 0xF9, 0x2A, 0xE3, 0xFA, 0x2F, 0xA1, 0x9F, 0xA1, 0x9F, 0x92, 0xFC, 0x1F,
+    0xD1, 0xAF, 0x3A, 0xF0, 0x9F, 0xDA, 0x0F, 0xC3, 0x9F, 0xAF, 0xFA, 0xFA, 0x4F, 0xFF, 0xFD, 0x94,
+    0xFF, 0xFF, 0xD5, 0xAF, 0xFF, 0xFC, 0x59, 0xFF, 0xFF, 0xA6, 0xFF, 0xAF, 0xE9, 0x6F, 0xE9, 0x0F,
+    0xE7, 0xAF, 0xD1, 0x9F, 0xD7, 0x0F, 0xC3, 0xFC, 0xA7, 0x0A, 0xAA, 0xA9, 0x39, 0xAA, 0xAA, 0x40,
+    0x71, 0x9D, 0xA7, 0x72, 0xF7, 0x71, 0xFD, 0x77, 0xFF, 0x75, 0xFF, 0xD7, 0x3F, 0xA1, 0xAF, 0x71,
+    0xF9, 0x39, 0xF7, 0x09, 0x99, 0x79, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76,
+    0xFC, 0x72, 0xFC, 0x90, 0xAF, 0xA7, 0x09, 0xFC, 0x2F, 0xC9, 0x7F, 0xC9, 0x2A, 0xFC, 0x69, 0xFC,
+    0x4F, 0xC9, 0x5F, 0xCA, 0x4A, 0xFC, 0x49, 0xFC, 0x59, 0xFC, 0x93, 0xFC, 0xA6, 0xFD, 0x29, 0xFC,
+    0x79, 0xFC, 0x91, 0xFC, 0xA7, 0x0F, 0xD0, 0x9F, 0xC7, 0x19, 0xFC, 0x9F, 0xCA, 0x72, 0xFF, 0xE9,
+    0x72, 0xAF, 0xFD, 0x74, 0xFF, 0xC9, 0x74, 0xAF, 0xF7, 0x6F, 0xE9, 0x76, 0xAF, 0xD7, 0x79, 0xFC,
+    0xA7, 0x79, 0xFC, 0xA7, 0x7A, 0xFC, 0xA7, 0x7A, 0xFC, 0xA7, 0x7A, 0xFD, 0x77, 0xFE, 0x77, 0xFE,
+    0x77, 0xFE, 0x70, 0x77, 0x73, 0xE9, 0x75, 0xAF, 0x74, 0x9F, 0xD7, 0x29, 0xFF, 0x70, 0x9F, 0x9F,
+    0xC6, 0xAF, 0x2A, 0xF4, 0xAE, 0x95, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9F,
+    0x97, 0xF9, 0x0F, 0xC6, 0x9F, 0x19, 0xFA, 0x5A, 0xEA, 0x2F, 0xC5, 0xF9, 0x3F, 0xC3, 0x9F, 0x4A,
+    0xF9, 0x2A, 0xEA, 0x5F, 0xC2, 0xF9, 0x5A, 0xFA, 0x09, 0xF7, 0xFC, 0x0A, 0xEA, 0x7A, 0xFF, 0xC9,
+    0x70, 0xFF, 0xC7, 0x1A, 0xFE, 0xA7, 0x2F, 0xE9, 0x72, 0xAF, 0xD7, 0x4F, 0xCA, 0x74, 0xAF, 0x97,
+    0x4A, 0xF7, 0x49, 0xFA, 0x73, 0xAF, 0xC9, 0x7F, 0xFD, 0x70, 0xFF, 0xC9, 0x70, 0xFF, 0xA7, 0x1F,
+    0xEA, 0x72, 0xFC, 0xA7, 0x77, 0x50, 0x4A, 0xF2, 0xAF, 0x71, 0xFC, 0x2F, 0xC7, 0x1F, 0xC2, 0xFC,
+    0x71, 0xFC, 0x91, 0xFC, 0x70, 0x9F, 0xC9, 0x09, 0xFC, 0x97, 0xAF, 0xCA, 0x0A, 0xFC, 0xA7, 0x99,
+    0x99, 0x99, 0x90, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x6F, 0xC7, 0x2F, 0xC9, 0x0A, 0xFA, 0x70, 0x9F, 0xC2, 0xFC, 0x97, 0xFC, 0x92, 0xAF, 0xC6, 0x9F,
+    0xC4, 0xFC, 0x95, 0xFC, 0xA4, 0xAF, 0xC4, 0x9F, 0xC5, 0x9F, 0xC9, 0x3F, 0xCA, 0x6F, 0xD2, 0x9F,
+    0xC7, 0x9F, 0xC9, 0x1F, 0xCA, 0x70, 0xFD, 0x09, 0xFC, 0x71, 0x9F, 0xC9, 0xFC, 0xA7, 0x2F, 0xFE,
+    0x97, 0x2A, 0xFF, 0xD7, 0x4F, 0xFC, 0x97, 0x4A, 0xFF, 0x76, 0xFE, 0x97, 0x6A, 0xFD, 0x77, 0x9F,
+    0xCA, 0x77, 0x9F, 0xCA, 0x77, 0xAF, 0xCA, 0x77, 0xAF, 0xCA, 0x77, 0xAF, 0xD7, 0x7F, 0xE7, 0x7F,
+    0xE7, 0x7F, 0xE7, 0x77, 0x77, 0x1A, 0xDA, 0x77, 0x2E, 0x97, 0x71, 0xAE, 0x77, 0x2E, 0xA7, 0x71,
+    0x9E, 0x97, 0x71, 0xF7, 0x77, 0x77, 0x77, 0x19, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xF2, 0xAF, 0xFF,
+    0xFE, 0x3F, 0xFF, 0xFE, 0x3A, 0xFF, 0xFF, 0xD4, 0x9A, 0xAA, 0xAA, 0xAA, 0xAF, 0xF9, 0x74, 0xFF,
+    0x97, 0x4F, 0xFA, 0x74, 0xAF, 0xF7, 0x4A, 0xFF, 0x74, 0xAF, 0xF9, 0x73, 0xAF, 0xF9, 0x73, 0xAF,
+    0xFA, 0x73, 0xAF, 0xFC, 0x73, 0xAF, 0xFC, 0x73, 0xAF, 0xFC, 0x73, 0xAF, 0xFC, 0x97, 0x2A, 0xFF,
+    0xCA, 0x72, 0x9F, 0xFD, 0x99, 0x99, 0x99, 0x99, 0x3F, 0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0xF1, 0x9F,
+    0xFF, 0xFF, 0x90, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC9, 0x77,
+    0x72, 0xAD, 0xA7, 0x5E, 0x75, 0xAE, 0x75, 0xEA, 0x74, 0xAE, 0x75, 0xF7, 0x77, 0x77, 0x77, 0x77,
+    0x71, 0xFF, 0xFC, 0xA3, 0xFF, 0xFD, 0x3F, 0xFF, 0xD3, 0x9A, 0xAA, 0xAA, 0xAA, 0xFC, 0xA7, 0x2F,
+    0xCA, 0x72, 0xFC, 0xA7, 0x2F, 0xD7, 0x2F, 0xD7, 0x2F, 0xD7, 0x19, 0xFD, 0x71, 0x9F, 0xD7, 0x19,
+    0xFD, 0x71, 0x9F, 0xD9, 0x99, 0x99, 0x99, 0x3F, 0xFF, 0xD9, 0x2F, 0xFF, 0xE2, 0xFF, 0xFE, 0x90,
+    0x9F, 0xFF, 0xF0, 0x70, 0x9F, 0x77, 0x1A, 0xF7, 0x71, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC,
+    0xA7, 0x79, 0xFC, 0xA7, 0x70, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x79, 0xFF, 0xFF, 0xF2, 0xFF,
+    0xFF, 0xF2, 0xAF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x3A, 0xFF, 0xFF, 0xD4, 0x9A, 0xAA, 0xAA, 0xAA,
+    0xAF, 0xF9, 0x74, 0xFF, 0x97, 0x4F, 0xFA, 0x74, 0xAF, 0xF7, 0x4A, 0xFF, 0x74, 0xAF, 0xF9, 0x73,
+    0xAF, 0xF9, 0x73, 0xAF, 0xFA, 0x73, 0xAF, 0xFC, 0x73, 0xAF, 0xFC, 0x73, 0xAF, 0xFC, 0x73, 0xAF,
+    0xFC, 0x97, 0x2A, 0xFF, 0xCA, 0x72, 0x9F, 0xFD, 0x99, 0x99, 0x99, 0x99, 0x3F, 0xFF, 0xFF, 0x19,
+    0xFF, 0xFF, 0xF1, 0x9F, 0xFF, 0xFF, 0x90, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F,
+    0xFF, 0xFF, 0xC9, 0x6A, 0xF7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC9, 0x72, 0x9F, 0xC9, 0x72, 0x9F,
+    0xCA, 0x73, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0xFF, 0xFC, 0xA3, 0xFF, 0xFD, 0x3F,
+    0xFF, 0xD3, 0x9A, 0xAA, 0xAA, 0xAA, 0xFC, 0xA7, 0x2F, 0xCA, 0x72, 0xFC, 0xA7, 0x2F, 0xD7, 0x2F,
+    0xD7, 0x2F, 0xD7, 0x19, 0xFD, 0x71, 0x9F, 0xD7, 0x19, 0xFD, 0x71, 0x9F, 0xD9, 0x99, 0x99, 0x99,
+    0x3F, 0xFF, 0xD9, 0x2F, 0xFF, 0xE2, 0xFF, 0xFE, 0x90, 0x9F, 0xFF, 0xF0, 0x39, 0xAA, 0xA6, 0x9A,
+    0xAA, 0x70, 0xF9, 0x3F, 0x97, 0x1F, 0xA0, 0x9F, 0x97, 0x3F, 0xFC, 0x97, 0x5F, 0xE9, 0x77, 0xFC,
+    0x97, 0x71, 0xEA, 0x77, 0x29, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xFF, 0xFF, 0xF2, 0xFF,
+    0xFF, 0xF2, 0xAF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x3A, 0xFF, 0xFF, 0xD4, 0x9A, 0xAA, 0xAA, 0xAA,
+    0xAF, 0xF9, 0x74, 0xFF, 0x97, 0x4F, 0xFA, 0x74, 0xAF, 0xF7, 0x4A, 0xFF, 0x74, 0xAF, 0xF9, 0x73,
+    0xAF, 0xF9, 0x73, 0xAF, 0xFA, 0x73, 0xAF, 0xFC, 0x73, 0xAF, 0xFC, 0x73, 0xAF, 0xFC, 0x73, 0xAF,
+    0xFC, 0x97, 0x2A, 0xFF, 0xCA, 0x72, 0x9F, 0xFD, 0x99, 0x99, 0x99, 0x99, 0x3F, 0xFF, 0xFF, 0x19,
+    0xFF, 0xFF, 0xF1, 0x9F, 0xFF, 0xFF, 0x90, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F,
+    0xFF, 0xFF, 0xC9, 0x19, 0xAA, 0xA6, 0x9A, 0xAA, 0x3F, 0x93, 0xF5, 0xFA, 0x0A, 0xF7, 0xFF, 0xC7,
+    0x1F, 0xE7, 0x3F, 0xC7, 0x49, 0xEA, 0x75, 0x9A, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0xFF,
+    0xFC, 0xA3, 0xFF, 0xFD, 0x3F, 0xFF, 0xD3, 0x9A, 0xAA, 0xAA, 0xAA, 0xFC, 0xA7, 0x2F, 0xCA, 0x72,
+    0xFC, 0xA7, 0x2F, 0xD7, 0x2F, 0xD7, 0x2F, 0xD7, 0x19, 0xFD, 0x71, 0x9F, 0xD7, 0x19, 0xFD, 0x71,
+    0x9F, 0xD9, 0x99, 0x99, 0x99, 0x3F, 0xFF, 0xD9, 0x2F, 0xFF, 0xE2, 0xFF, 0xFE, 0x90, 0x9F, 0xFF,
+    0xF0, 0x29, 0xFA, 0x92, 0xAF, 0xE9, 0x1F, 0xF9, 0x0A, 0xFF, 0x90, 0xFC, 0xA9, 0x09, 0x1F, 0xC5,
+    0xF9, 0x5F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x94, 0x9F, 0x94, 0x9F, 0xA4, 0x9F, 0xA4, 0x9F,
+    0xA4, 0x9F, 0xA4, 0x9F, 0xA4, 0x9F, 0xC4, 0x9F, 0xC4, 0xAF, 0xC4, 0x9F, 0xA4, 0x77, 0x59, 0x97,
+    0x77, 0xAD, 0xA7, 0x75, 0x9E, 0x79, 0xAF, 0xCA, 0x94, 0x9E, 0x59, 0xFF, 0xEA, 0x2A, 0xDA, 0x4A,
+    0xFF, 0xFD, 0x9F, 0x93, 0xAF, 0xFF, 0xFF, 0x3A, 0xFD, 0x92, 0x9F, 0xFC, 0x39, 0xFC, 0xA6, 0xAF,
+    0xD4, 0xAF, 0xC7, 0x0A, 0xFC, 0x4F, 0xC7, 0x2F, 0xC9, 0x2A, 0xFC, 0x72, 0xAF, 0xA2, 0xFC, 0x97,
+    0x29, 0xFC, 0x2F, 0xC7, 0x4F, 0xC2, 0xFC, 0x74, 0xFC, 0x91, 0xFC, 0x74, 0xFC, 0x90, 0x9F, 0xC7,
+    0x4F, 0xC9, 0x09, 0xFC, 0x74, 0xFC, 0x91, 0xFC, 0x74, 0xFC, 0x91, 0xFC, 0x74, 0xFC, 0x2F, 0xD7,
+    0x2A, 0xFC, 0x2F, 0xDA, 0x70, 0x9F, 0xD2, 0xFF, 0xA9, 0x90, 0x99, 0xAF, 0xF2, 0xAF, 0xFF, 0xFF,
+    0xCA, 0x3F, 0xFF, 0xFF, 0xC9, 0x3A, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xE9, 0x6F, 0xFF, 0xFC, 0xA7,
+    0x0A, 0xFF, 0xFD, 0x97, 0x39, 0xAF, 0xEA, 0xA9, 0x77, 0x77, 0x00, 0x77, 0x77, 0x1D, 0xA9, 0x76,
+    0xAD, 0xA4, 0x9A, 0xF9, 0x29, 0xE2, 0x9F, 0xFC, 0x90, 0xAD, 0xA1, 0x9F, 0xFE, 0xAE, 0x91, 0xFD,
+    0xAA, 0xFF, 0x1A, 0xF9, 0x29, 0xFD, 0x91, 0xFA, 0x49, 0xFA, 0x2F, 0x6F, 0x91, 0x9F, 0x6F, 0x91,
+    0x9F, 0x6A, 0xEA, 0x1A, 0xF6, 0xAE, 0xA1, 0x9F, 0x6F, 0xA1, 0x9F, 0x95, 0xFA, 0x2F, 0xC4, 0xFC,
+    0x92, 0xFF, 0xFE, 0x3A, 0xFF, 0xFC, 0xA4, 0xFF, 0xFC, 0x59, 0xFF, 0xE9, 0x69, 0xFF, 0xC9, 0x71,
+    0x9F, 0xC9, 0x60, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x19, 0xFF, 0xFD, 0xA6, 0xAF, 0xFF,
+    0xFC, 0x94, 0xFF, 0xFF, 0xE9, 0x2A, 0xFF, 0xC9, 0x39, 0xFC, 0x2F, 0xFD, 0x95, 0xF9, 0x1F, 0x1F,
+    0x95, 0xAE, 0xA1, 0xEA, 0x09, 0xF9, 0x5A, 0xF1, 0xE9, 0x09, 0xF9, 0x5F, 0xC1, 0xE9, 0x09, 0xFA,
+    0x99, 0x99, 0xAF, 0xD1, 0x9D, 0x90, 0x9F, 0xFF, 0xEA, 0x2D, 0x90, 0xAF, 0xFF, 0xE4, 0xC9, 0x0A,
+    0xFF, 0xFD, 0xA4, 0xA9, 0x0A, 0xFF, 0xFC, 0xA7, 0x0A, 0xFF, 0xF9, 0x71, 0xAF, 0xFC, 0xA9, 0x73,
+    0xFC, 0xA7, 0x71, 0xFC, 0xA7, 0x71, 0xFD, 0x77, 0x1F, 0xD7, 0x71, 0xFD, 0x77, 0x1F, 0xD7, 0x71,
+    0xFD, 0x77, 0x1F, 0xD7, 0x70, 0x9F, 0xD7, 0x30, 0x77, 0x6A, 0xF7, 0x4F, 0xD7, 0x39, 0xFD, 0x73,
+    0x9F, 0xD7, 0x3A, 0xF1, 0x9A, 0xA9, 0x96, 0xAF, 0x9F, 0xE9, 0x4A, 0xFF, 0xFC, 0x93, 0xAF, 0xFF,
+    0xD3, 0xAF, 0xE3, 0xEA, 0x2A, 0xFD, 0x5E, 0x2A, 0xFC, 0xA5, 0xAD, 0xA1, 0xAF, 0xC9, 0x5A, 0xDA,
+    0x1A, 0xFC, 0x95, 0x9E, 0x1A, 0xFC, 0x95, 0x9E, 0x1A, 0xFC, 0x95, 0xAD, 0xA1, 0xAF, 0xD5, 0xEA,
+    0x1A, 0xFE, 0xA9, 0x9A, 0xF9, 0x1A, 0xFF, 0xFE, 0x29, 0xFF, 0xFD, 0x92, 0xAF, 0xFF, 0xD3, 0xFC,
+    0xAF, 0xEA, 0x4F, 0xC1, 0xAA, 0xCA, 0xA5, 0x9F, 0xA7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x4F, 0xC7,
+    0x5F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xAA, 0x99, 0x97, 0x40, 0x9F, 0xFF, 0xD9, 0xFF,
+    0xFD, 0x9F, 0xFF, 0xD9, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAF, 0x97, 0x1F, 0xC9, 0x71, 0xFC,
+    0x72, 0xFC, 0x71, 0x9F, 0xC7, 0x1A, 0xFA, 0x71, 0xAF, 0x72, 0xF7, 0x2F, 0x70, 0x9F, 0x70, 0xAF,
+    0x70, 0xFC, 0x79, 0xFC, 0x96, 0x9F, 0xDA, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9,
+    0xFF, 0xFD, 0x9F, 0xFF, 0xD0, 0x09, 0xFF, 0xFF, 0xFD, 0x09, 0xFF, 0xFF, 0xFE, 0x09, 0xFF, 0xFF,
+    0xFE, 0x09, 0xFF, 0xFF, 0xFE, 0x1A, 0xFF, 0xFF, 0xFD, 0x2D, 0x6F, 0xC7, 0x3A, 0x6F, 0xC7, 0x73,
+    0xFC, 0x77, 0x3F, 0xC7, 0x73, 0xFC, 0x77, 0x29, 0xFC, 0x77, 0x29, 0xFC, 0x77, 0x29, 0xFC, 0x77,
+    0x29, 0xFC, 0x77, 0x29, 0xFC, 0x77, 0x29, 0xFC, 0x77, 0x29, 0xFC, 0x77, 0x29, 0xFC, 0x77, 0x2A,
+    0xFC, 0x97, 0x71, 0xAF, 0xC9, 0x77, 0x1A, 0xFC, 0x97, 0x71, 0xAF, 0xC9, 0x77, 0x1A, 0xFC, 0x97,
+    0x71, 0xAF, 0xC9, 0x77, 0x1A, 0xFC, 0x97, 0x71, 0x97, 0x3A, 0xE7, 0x1F, 0xC7, 0x0A, 0xFC, 0x79,
+    0xFD, 0x7A, 0xFD, 0x7F, 0xA7, 0x1F, 0x97, 0x1F, 0x97, 0x1F, 0x97, 0x1F, 0x72, 0xF7, 0xFF, 0xEA,
+    0x1A, 0xFF, 0xF1, 0xFF, 0xFC, 0x1A, 0xAA, 0xAF, 0xAA, 0xAA, 0xA4, 0x9F, 0x71, 0x9F, 0x71, 0x9F,
+    0x71, 0x9F, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0xAA, 0x9A, 0x94, 0xAF, 0xFA, 0x4A,
+    0xFF, 0xC4, 0xAF, 0xFC, 0x5F, 0xFC, 0x77, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F,
+    0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC7, 0x1F, 0xC7, 0x71, 0xFC, 0x77,
+    0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x09, 0xFC, 0x77, 0x09, 0xFC, 0x77,
+    0x09, 0xFC, 0x77, 0x09, 0xFC, 0x77, 0x09, 0xFC, 0x77, 0x09, 0xFC, 0x77, 0x09, 0xFC, 0x97, 0x79,
+    0xFC, 0x97, 0x7A, 0xFC, 0x97, 0x7A, 0xFC, 0x97, 0x7A, 0xFC, 0x97, 0x7A, 0xFC, 0x97, 0x7A, 0xFD,
+    0x77, 0xAF, 0xF9, 0x75, 0xFF, 0x97, 0x59, 0xFE, 0x97, 0x69, 0xFD, 0xA7, 0x70, 0x9F, 0x97, 0x74,
+    0x95, 0x77, 0x77, 0x74, 0xAC, 0xAA, 0x77, 0x49, 0xE7, 0x75, 0xE7, 0x74, 0x9E, 0x77, 0x39, 0xF0,
+    0x9F, 0xD7, 0xFF, 0x91, 0xFD, 0x7F, 0xEA, 0x2F, 0xD7, 0xFD, 0xA3, 0xFD, 0x7F, 0xD9, 0x3F, 0xD7,
+    0xFD, 0x4F, 0xD7, 0xFD, 0x4F, 0xD7, 0xFD, 0x4F, 0xD7, 0xFD, 0x4F, 0xD7, 0xFD, 0x4F, 0xCA, 0x7F,
+    0xD4, 0xFC, 0xA7, 0xAF, 0xC4, 0xFC, 0xA7, 0xAF, 0xC4, 0xFC, 0xA7, 0xAF, 0xC4, 0xFC, 0xA7, 0xAF,
+    0xC4, 0xFC, 0xA7, 0xAF, 0xC4, 0xFC, 0xA7, 0xAF, 0xA4, 0xAF, 0xC7, 0xFC, 0xA4, 0xAF, 0xC9, 0x59,
+    0xFC, 0xA4, 0xAF, 0xEA, 0xAA, 0xAF, 0xE9, 0x49, 0xFF, 0xFF, 0xD9, 0x5F, 0xFF, 0xFD, 0x6F, 0xFF,
+    0xFD, 0x69, 0xFF, 0xFF, 0x97, 0xAF, 0xFF, 0xDA, 0x71, 0x9F, 0xFF, 0x97, 0x77, 0x70, 0x77, 0x99,
+    0x77, 0x1E, 0x97, 0x7E, 0x97, 0x7E, 0x97, 0x7E, 0x0A, 0xE9, 0x6F, 0xE0, 0x9E, 0x95, 0x9F, 0xD9,
+    0x09, 0xE9, 0x59, 0xFC, 0xA1, 0x9E, 0xA5, 0x9F, 0x92, 0x9E, 0xA5, 0x9F, 0x4E, 0xA5, 0x9F, 0x4E,
+    0xA5, 0x9F, 0x4F, 0x5A, 0xF4, 0xF5, 0xAF, 0x4F, 0x5F, 0xC9, 0x3F, 0x94, 0xFC, 0x93, 0xFC, 0x92,
+    0xAF, 0xC9, 0x3A, 0xFF, 0xFD, 0x93, 0x9F, 0xFF, 0xD9, 0x4F, 0xFF, 0xD9, 0x4A, 0xFF, 0xFC, 0x95,
+    0xFF, 0xFC, 0xA6, 0x9A, 0xF9, 0x70, 0x0F, 0xA7, 0xFC, 0x7F, 0xC9, 0x6F, 0xCA, 0x6A, 0xFC, 0x74,
+    0x71, 0xE2, 0xAD, 0xA2, 0xE9, 0x1A, 0xE2, 0xEA, 0x1A, 0xE9, 0x10, 0x59, 0xDA, 0x73, 0xF7, 0x2A,
+    0xFC, 0x70, 0xAF, 0xE6, 0xAF, 0xFC, 0x4F, 0xA1, 0xAF, 0x2F, 0x94, 0xF1, 0x99, 0x97, 0x99, 0x90,
+    0x1A, 0xD9, 0x1A, 0xD1, 0xAF, 0x90, 0xAD, 0x1F, 0xD9, 0xAD, 0x09, 0xD9, 0x9F, 0xD0, 0x9D, 0x90,
+    0xAF, 0x91, 0xDA, 0x19, 0xD9, 0x10, 0x73, 0x99, 0x3A, 0xAF, 0xFD, 0x91, 0xAF, 0xFF, 0xC1, 0xFF,
+    0xFD, 0x0A, 0xFD, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x70, 0x99, 0x99, 0x99, 0xAA, 0xAA, 0x3A, 0xFF,
+    0xFF, 0xC2, 0xFF, 0xFF, 0xD9, 0x0F, 0xFF, 0xFD, 0xAA, 0x77, 0x40, 0x9A, 0xAA, 0x99, 0x3A, 0xAA,
+    0x99, 0xEA, 0x3A, 0xE9, 0x9F, 0xFF, 0x1F, 0xFE, 0x92, 0xFF, 0xCA, 0x49, 0xAF, 0xA3, 0x0A, 0xF1,
+    0xAF, 0x1F, 0xC1, 0xFC, 0x99, 0xFC, 0x99, 0xFC, 0xA0, 0x99, 0x99, 0x99, 0x0A, 0xE9, 0x1A, 0xE9,
+    0x1A, 0xEA, 0x1A, 0xEA, 0x1F, 0xA1, 0xFA, 0x1F, 0xC1, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xAA,
+    0xAA, 0xA0, 0x9A, 0xAA, 0xAA, 0x00, 0x0D, 0xA2, 0xF3, 0x9C, 0x91, 0x9D, 0x19, 0xD9, 0x1A, 0xC9,
+    0x70, 0x29, 0x93, 0x9F, 0x2F, 0xD0, 0x9D, 0x9A, 0xD0, 0x9D, 0x9A, 0xD9, 0x0F, 0xD1, 0xAF, 0xA2,
+    0xAD, 0xA1, 0x5A, 0xF7, 0xAF, 0x5F, 0xC7, 0xFC, 0x49, 0xFC, 0x69, 0xFC, 0x4A, 0xFC, 0x6A, 0xFC,
+    0x4F, 0xCA, 0x6F, 0xCA, 0x77, 0x75, 0x0E, 0xA5, 0xAE, 0x91, 0xF9, 0x19, 0xF9, 0x3F, 0xAA, 0xF9,
+    0x5F, 0xF9, 0x7F, 0xD9, 0x71, 0xF9, 0x72, 0x9E, 0x74, 0x99, 0x60, 0x0F, 0x97, 0xF9, 0x7F, 0xA7,
+    0xFA, 0x7F, 0xC7, 0xFC, 0x7F, 0xC9, 0x6F, 0xC9, 0x6F, 0xCA, 0x6F, 0xCA, 0x77, 0x71, 0xAF, 0xD9,
+    0x19, 0xFD, 0x92, 0xFD, 0x92, 0xFD, 0x3A, 0xFC, 0x93, 0xFC, 0xA3, 0xFD, 0x3A, 0xFC, 0x92, 0x9F,
+    0xCA, 0x3F, 0xD0, 0x19, 0xFD, 0xA1, 0x9F, 0xD9, 0x2F, 0xD3, 0xFD, 0x29, 0xFC, 0xA2, 0xAF, 0xC3,
+    0xFD, 0x29, 0xFC, 0xA2, 0xAF, 0xC9, 0x2F, 0xD2, 0x9F, 0xDA, 0x2F, 0xDA, 0x2F, 0xDA, 0x29, 0xFC,
+    0xA3, 0xFC, 0xA3, 0xFD, 0x3A, 0xFC, 0x92, 0x9F, 0xCA, 0x3F, 0xD3, 0xAF, 0xC9, 0x71, 0xE9, 0x2E,
+    0x99, 0xFC, 0x99, 0xFC, 0x99, 0xFC, 0x92, 0xE9, 0x2E, 0x96, 0x69, 0xE2, 0x9E, 0x29, 0xFC, 0x99,
+    0xFC, 0x99, 0xFC, 0x99, 0xE2, 0x9E, 0x71, 0x9E, 0xAA, 0xA9, 0x99, 0x39, 0xFF, 0xF0, 0x9F, 0xFF,
+    0x1A, 0xAA, 0xAA, 0xAA, 0xAF, 0x71, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x76, 0x70, 0x9E, 0x3E, 0x3E,
+    0x29, 0xE1, 0xAF, 0x1F, 0x91, 0xAD, 0xA3, 0xC9, 0x20, 0x6A, 0xCA, 0x0A, 0xDA, 0x0E, 0x99, 0xD9,
+    0x09, 0xEA, 0x0E, 0xA1, 0xDA, 0x40, 0x2A, 0xAA, 0x4E, 0x4E, 0x19, 0xFE, 0x9F, 0xE9, 0xFE, 0x09,
+    0x99, 0x99, 0x99, 0x9F, 0xE9, 0xFE, 0x9F, 0xE0, 0x99, 0xE9, 0x91, 0x9E, 0x39, 0xE1, 0x29, 0x4A,
+    0xC4, 0xAC, 0x2F, 0xD0, 0x99, 0xD9, 0x92, 0xAC, 0x49, 0xA2, 0x73, 0x99, 0x29, 0xAA, 0xFF, 0xD9,
+    0x1F, 0xFF, 0xCA, 0x09, 0xFF, 0xFD, 0x0A, 0xFD, 0xAA, 0xAA, 0xAA, 0x99, 0x00, 0x19, 0x99, 0x92,
+    0x9F, 0x91, 0x9F, 0x91, 0xAF, 0xA1, 0xFC, 0xA1, 0xFD, 0x1F, 0xD0, 0x0A, 0xE9, 0x1A, 0xE9, 0x1A,
+    0xEA, 0x1A, 0xEA, 0x1F, 0xA1, 0xFA, 0x1F, 0xC1, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xAA, 0xAA,
+    0xA0, 0x9A, 0xAA, 0xAA, 0x00, 0x29, 0x93, 0x9F, 0x2F, 0xD0, 0x9D, 0x9A, 0xD0, 0x9D, 0x9A, 0xD9,
+    0x0F, 0xD1, 0xAF, 0xA2, 0xAD, 0xA1, 0x1F, 0xE2, 0xFD, 0xA2, 0xFD, 0x92, 0xFD, 0x3F, 0xD2, 0x9F,
+    0xCA, 0x2A, 0xFC, 0x92, 0xFD, 0x29, 0xFC, 0xA2, 0xFD, 0x92, 0x1D, 0x93, 0x9D, 0x4E, 0x4F, 0xC1,
+    0x9F, 0xCA, 0x19, 0x1E, 0x1F, 0xD0, 0x9F, 0xC9, 0x0A, 0xF9, 0x10, 0x39, 0xAA, 0x4A, 0xE3, 0xAF,
+    0x29, 0xF3, 0xF4, 0xEA, 0x4F, 0xE1, 0xFE, 0x91, 0xFD, 0x92, 0x9A, 0xE0, 0x0F, 0x1F, 0x1F, 0x09,
+    0xF0, 0x9F, 0x09, 0xF0, 0xAF, 0x0A, 0xF0, 0xAF, 0x0A, 0xAA, 0xAA, 0x00, 0x0A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x1F, 0xFE, 0x1F, 0xFE, 0x1F, 0xFE, 0x1F, 0x2F, 0x1F, 0x2F, 0x1F, 0x2F, 0x00, 0x0F,
+    0x95, 0x9F, 0x91, 0xFA, 0x3A, 0xF9, 0x3F, 0xC9, 0x0F, 0xC9, 0x5F, 0xFD, 0x97, 0xFF, 0x97, 0x1F,
+    0xD9, 0x73, 0xFA, 0x74, 0xAE, 0x77, 0x70, 0x69, 0xE7, 0x5F, 0x97, 0x3F, 0xD7, 0x2F, 0xF7, 0x0F,
+    0xFD, 0x6F, 0xCA, 0x9F, 0xC4, 0xFC, 0x3F, 0xC2, 0xFA, 0x59, 0xF7, 0x72, 0x19, 0xE9, 0x19, 0xD9,
+    0x09, 0xFC, 0x19, 0xDA, 0x0A, 0xFD, 0x09, 0xDA, 0x0E, 0x9F, 0xAD, 0x90, 0xE0, 0x9F, 0xD9, 0x0E,
+    0x1A, 0xFC, 0x1E, 0x2A, 0xE7, 0x60, 0x71, 0x99, 0x93, 0xFF, 0xE9, 0x1A, 0xFF, 0xF1, 0xFF, 0xFC,
+    0x77, 0x73, 0x99, 0x3A, 0xAF, 0xFD, 0x2A, 0xFF, 0xF9, 0x1F, 0xFF, 0xCA, 0x09, 0xFD, 0xAA, 0xAA,
+    0xAA, 0x99, 0x00, 0x19, 0xE9, 0x19, 0xD9, 0x09, 0xFC, 0x19, 0xDA, 0x0A, 0xFD, 0x09, 0xDA, 0x0E,
+    0x9F, 0xAD, 0x90, 0xE0, 0x9F, 0xD9, 0x0E, 0x1A, 0xFC, 0x1E, 0x2A, 0xE7, 0x60, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xD9, 0x9F, 0xFF, 0xD9, 0x9F, 0xFF, 0xD9, 0x4A, 0xCA,
+    0x1A, 0xE0, 0xAE, 0xA1, 0xEA, 0xFA, 0xE9, 0xAD, 0xA0, 0x9A, 0x96, 0x99, 0x97, 0x1F, 0xA2, 0xFF,
+    0xCA, 0x2F, 0xFC, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x40, 0x0F, 0xFD, 0xA0,
+    0xFF, 0xDA, 0x0F, 0xFD, 0xA0, 0xE9, 0x2E, 0xA0, 0xE9, 0x2E, 0xA0, 0xE9, 0x2E, 0xA0, 0xFF, 0xDA,
+    0x0F, 0xFD, 0xA0, 0xFF, 0xDA, 0x09, 0x99, 0x99, 0x99, 0x99, 0x90, 0x1A, 0xDA, 0xAD, 0x91, 0xFF,
+    0xC0, 0x9D, 0xAF, 0xD9, 0x9D, 0x0A, 0xD9, 0xDA, 0xAD, 0x0A, 0xD0, 0xAC, 0xAA, 0xCA, 0x0A, 0xD0,
+    0xAC, 0xAA, 0xCA, 0x0A, 0xD0, 0xAC, 0x97, 0x20, 0x1D, 0x1D, 0x29, 0xCA, 0xD4, 0xAD, 0x94, 0xAD,
+    0x93, 0x9F, 0x29, 0xD0, 0xAD, 0x1A, 0xA9, 0x1A, 0xA9, 0x1A, 0xD9, 0x1A, 0xD1, 0xAF, 0x90, 0xAD,
+    0x1F, 0xD9, 0xAD, 0x09, 0xD9, 0x9F, 0xD0, 0x9D, 0x90, 0xAF, 0x91, 0xDA, 0x19, 0xD9, 0x10, 0x5A,
+    0xCA, 0x2A, 0xE1, 0xAE, 0xA0, 0x9F, 0x09, 0xEA, 0x0A, 0xDA, 0x19, 0x93, 0x77, 0x4A, 0xD9, 0x71,
+    0xE7, 0x1A, 0xE7, 0x1E, 0x97, 0x0A, 0xE7, 0x1F, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x3A, 0xE9, 0x1A, 0xE9, 0x1A, 0xEA, 0x1A, 0xEA, 0x1F, 0xA1, 0xFA, 0x1F, 0xC1, 0xFC, 0x09, 0xFC,
+    0x09, 0xFC, 0x09, 0xAA, 0xAA, 0xA0, 0x9A, 0xAA, 0xAA, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x1F, 0xFE, 0x1F, 0xFE, 0x1F, 0xFE, 0x1F, 0x2F, 0x1F, 0x2F, 0x1F, 0x2F, 0x00, 0x19, 0x99, 0x9A,
+    0xAA, 0xAF, 0x2A, 0xFF, 0xFA, 0x1F, 0xFF, 0xD0, 0xAF, 0xFF, 0xD9, 0x99, 0x99, 0x77, 0x77, 0x69,
+    0x99, 0x29, 0xAF, 0xFE, 0x91, 0xFF, 0xFC, 0xA0, 0x9F, 0xFF, 0xD0, 0xAF, 0xCA, 0xAA, 0xAA, 0xAA,
+    0x99, 0x00, 0x09, 0xAA, 0x92, 0x9A, 0xAA, 0x1F, 0x2F, 0x1F, 0x2F, 0x1F, 0x2F, 0x1F, 0x2F, 0x1F,
+    0x2F, 0x09, 0xF2, 0xF0, 0x9F, 0x19, 0xF0, 0x9F, 0x19, 0xF0, 0x72, 0x9F, 0xFA, 0x09, 0xFF, 0xC0,
+    0x9F, 0xFC, 0x09, 0xFF, 0xC5, 0xAF, 0x5A, 0xF5, 0xAF, 0x59, 0xAA, 0xAA, 0x00, 0x77, 0x70, 0xAA,
+    0x73, 0xD9, 0x5A, 0xE0, 0x9F, 0xC2, 0xFF, 0xF9, 0x09, 0xFF, 0x9E, 0x90, 0xAF, 0xFF, 0x90, 0xEA,
+    0x0A, 0xFE, 0x1E, 0xA1, 0xFD, 0xA1, 0xAE, 0x09, 0xFC, 0xA7, 0xAD, 0x73, 0xDA, 0x72, 0x9D, 0x97,
+    0x2A, 0xD7, 0x3E, 0x73, 0xDA, 0x72, 0xAD, 0x97, 0x2E, 0x73, 0xE7, 0x29, 0xDA, 0x72, 0xD9, 0x73,
+    0xA7, 0x77, 0x10, 0x73, 0x99, 0x97, 0x76, 0xEA, 0x77, 0x49, 0xF7, 0x74, 0xAF, 0x77, 0x4A, 0xF7,
+    0x74, 0xFC, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xAA, 0xAA, 0x96, 0xAA, 0xAA,
+    0xA9, 0x3F, 0xFD, 0x94, 0xAF, 0xCA, 0x1F, 0xFF, 0xC3, 0x9F, 0xCA, 0x0A, 0xFF, 0xFD, 0x91, 0xAF,
+    0xCA, 0x0F, 0xDA, 0x1F, 0xFF, 0xE9, 0x9F, 0xD9, 0x2A, 0xFF, 0xFC, 0x09, 0xFD, 0xA3, 0x9F, 0xFE,
+    0x91, 0xAF, 0xD0, 0xAD, 0x90, 0x9F, 0xEA, 0x73, 0xEA, 0x77, 0x5E, 0xA7, 0x74, 0x9F, 0x77, 0x4A,
+    0xF7, 0x40, 0x77, 0x4A, 0xEA, 0x49, 0x99, 0x3F, 0xE9, 0x2F, 0x1A, 0xFF, 0xA1, 0xF1, 0xF9, 0x0F,
+    0x90, 0xF1, 0xF1, 0x9F, 0xFA, 0x1A, 0xE9, 0x19, 0xFE, 0x73, 0xAE, 0xA7, 0x77, 0xAE, 0xA4, 0x99,
+    0x93, 0xFE, 0x92, 0xF1, 0xAF, 0xF9, 0x1F, 0x1F, 0x09, 0xF9, 0x9F, 0x09, 0xF1, 0x9F, 0xFA, 0x1A,
+    0xE9, 0x19, 0xFE, 0x72, 0x9A, 0xEA, 0x77, 0x40, 0x77, 0x72, 0xC9, 0x2A, 0x6F, 0x90, 0xAC, 0xAA,
+    0x49, 0xAD, 0x09, 0xF6, 0xA3, 0xC7, 0x77, 0x20, 0x19, 0x29, 0xCA, 0x1E, 0xA1, 0xC9, 0x2C, 0x90,
+    0x77, 0x77, 0x77, 0xC0, 0x9D, 0x97, 0x71, 0xDA, 0x0E, 0xA7, 0x69, 0xEA, 0x09, 0xFA, 0x72, 0x9F,
+    0xA2, 0x9F, 0xFA, 0xAA, 0xFF, 0xA5, 0xAF, 0xFF, 0xEA, 0x72, 0xAA, 0xFE, 0xAA, 0x95, 0x79, 0x9A,
+    0xAA, 0xA9, 0x99, 0x74, 0xAF, 0xFF, 0xCA, 0x96, 0xAF, 0xFF, 0xFD, 0x4F, 0xCA, 0x96, 0x9A, 0xFC,
+    0x91, 0xAE, 0x97, 0x5A, 0xE9, 0x9E, 0x77, 0x09, 0xE0, 0xAA, 0x77, 0x29, 0xC9, 0x77, 0x70, 0x77,
+    0x59, 0x77, 0x75, 0xDA, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFA,
+    0x92, 0x9F, 0xFF, 0xFF, 0xFF, 0x90, 0x9F, 0xFF, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xFE, 0x97,
+    0x77, 0xF9, 0x77, 0x71, 0xD9, 0x77, 0x73, 0x97, 0x71, 0xF9, 0x77, 0x29, 0xFC, 0x77, 0x2F, 0xD7,
+    0x72, 0xFD, 0xA7, 0x70, 0xAF, 0xE7, 0x70, 0xFF, 0x97, 0x69, 0xFA, 0xF7, 0x6F, 0xA0, 0xF7, 0x6F,
+    0x90, 0xFA, 0x74, 0xAF, 0x1A, 0xF7, 0x4F, 0xA1, 0x9F, 0x97, 0x29, 0xF9, 0x2F, 0xC7, 0x2F, 0xC3,
+    0xAF, 0x72, 0xFC, 0x39, 0xFA, 0x70, 0xAF, 0x94, 0xFC, 0x70, 0xFC, 0xA9, 0x99, 0x99, 0xFC, 0x96,
+    0x9F, 0xFF, 0xFA, 0x6A, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0xDA, 0x4A, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF,
+    0xF9, 0x29, 0xFC, 0xA7, 0x0F, 0xCA, 0x2A, 0xFC, 0x71, 0xFD, 0x2F, 0xD7, 0x1A, 0xFC, 0x90, 0x9F,
+    0xCA, 0x71, 0x9F, 0xD0, 0x9F, 0xFD, 0xA9, 0x69, 0xFF, 0xFC, 0x94, 0x9F, 0xFF, 0xDA, 0x39, 0xFF,
+    0xFE, 0x92, 0x9F, 0xA4, 0x9F, 0xC2, 0x9F, 0xA5, 0x9F, 0x29, 0xFA, 0x6F, 0x29, 0xFA, 0x6F, 0x29,
+    0xFA, 0x59, 0xF2, 0x9F, 0xA2, 0x99, 0xAF, 0xA2, 0x9F, 0xFF, 0xE3, 0x9F, 0xFF, 0xD9, 0x39, 0xFF,
+    0xFE, 0xA2, 0x9F, 0xFF, 0xFC, 0x19, 0xFA, 0x5A, 0xFC, 0x90, 0x9F, 0xA6, 0x9F, 0xC0, 0x9F, 0xA7,
+    0xFC, 0x09, 0xFA, 0x69, 0xFC, 0x09, 0xFA, 0x99, 0x99, 0x99, 0xAF, 0xD0, 0x9F, 0xFF, 0xFD, 0x09,
+    0xFF, 0xFF, 0xD0, 0x9F, 0xFF, 0xFC, 0xA0, 0x9F, 0xFF, 0xFC, 0x19, 0xFF, 0xFE, 0xA2, 0x9F, 0xFF,
+    0xCA, 0x40, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xFC, 0x09, 0xFF, 0xFC, 0x09,
+    0xFF, 0xFC, 0x09, 0xFF, 0xFC, 0x09, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xEA, 0x71, 0x9E, 0xA7, 0x19,
+    0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F,
+    0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x97, 0x09,
+    0xF9, 0x77, 0x70, 0x70, 0xAA, 0xAA, 0xA7, 0x71, 0xFC, 0xA7, 0x7A, 0xFD, 0x77, 0xFE, 0xA7, 0x5A,
+    0xFF, 0x75, 0xFF, 0xC9, 0x73, 0xAF, 0xAF, 0xC7, 0x3F, 0xC0, 0xAF, 0x97, 0x1A, 0xFA, 0x09, 0xFC,
+    0x71, 0xFC, 0x91, 0xFC, 0x97, 0xAF, 0xC2, 0xAF, 0xC7, 0xFC, 0x93, 0xFC, 0x95, 0xAF, 0xC4, 0xFC,
+    0xA5, 0xFC, 0xA4, 0x9F, 0xC4, 0xAF, 0xC6, 0xFC, 0xA3, 0xFD, 0x6A, 0xFC, 0x29, 0xFC, 0x97, 0xFC,
+    0xA1, 0xFD, 0x70, 0xFD, 0x09, 0xFD, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xD9, 0x9F, 0xFF, 0xFF, 0xCA,
+    0x9F, 0xFF, 0xFF, 0xCA, 0x9F, 0xFF, 0xFF, 0xCA, 0x9F, 0xFF, 0xFF, 0xCA, 0x19, 0xAA, 0xAA, 0xAA,
+    0xAF, 0xE9, 0x19, 0xFF, 0xFE, 0x2A, 0xFF, 0xFE, 0x2A, 0xFF, 0xFD, 0xA2, 0xAF, 0xAA, 0x99, 0x99,
+    0x96, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x99, 0x99, 0x99, 0xAA, 0x5F, 0xFF,
+    0xC5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xC9, 0x74, 0xFC, 0x75, 0xFC, 0x75, 0xFC,
+    0x75, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFF, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x91,
+    0xFF, 0xFF, 0xA1, 0xFF, 0xFF, 0xA0, 0x9F, 0xFF, 0xFC, 0x00, 0x19, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
+    0xF2, 0xAF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x3A, 0xFF, 0xFF, 0xD4, 0x9A, 0xAA, 0xAA, 0xAA, 0xAF,
+    0xF9, 0x74, 0xFF, 0x97, 0x4F, 0xFA, 0x74, 0xAF, 0xF7, 0x4A, 0xFF, 0x74, 0xAF, 0xF9, 0x73, 0xAF,
+    0xF9, 0x73, 0xAF, 0xFA, 0x73, 0xAF, 0xFC, 0x73, 0xAF, 0xFC, 0x73, 0xAF, 0xFC, 0x73, 0xAF, 0xFC,
+    0x97, 0x2A, 0xFF, 0xCA, 0x72, 0x9F, 0xFD, 0x99, 0x99, 0x99, 0x99, 0x3F, 0xFF, 0xFF, 0x19, 0xFF,
+    0xFF, 0xF1, 0x9F, 0xFF, 0xFF, 0x90, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF,
+    0xFF, 0xC9, 0x0A, 0xF9, 0x70, 0xFC, 0x1A, 0xF9, 0x70, 0xFC, 0x1A, 0xF9, 0x70, 0xFC, 0x1A, 0xFA,
+    0x70, 0xFC, 0x1A, 0xFA, 0x70, 0xFC, 0x1A, 0xFA, 0x79, 0xFC, 0x1F, 0xCA, 0x79, 0xFC, 0x1F, 0xCA,
+    0x79, 0xFC, 0x1F, 0xCA, 0x79, 0xFC, 0x1F, 0xCA, 0x79, 0xFC, 0x90, 0xFD, 0x79, 0xFC, 0x90, 0xFD,
+    0x79, 0xFC, 0x90, 0xFD, 0x79, 0xFC, 0x90, 0xFD, 0x99, 0x99, 0x99, 0x99, 0xAF, 0xC9, 0x0F, 0xFF,
+    0xFF, 0x90, 0xFF, 0xFF, 0xFA, 0x0F, 0xFF, 0xFF, 0xA0, 0xFF, 0xFF, 0xFA, 0x0F, 0xFF, 0xFF, 0xA0,
+    0xFF, 0xFF, 0xFA, 0x0F, 0xD7, 0xAF, 0xCA, 0x0F, 0xD7, 0xFE, 0x0F, 0xD7, 0xFE, 0x0F, 0xD9, 0x6F,
+    0xE9, 0xFD, 0x96, 0xFE, 0x79, 0xAF, 0xCA, 0x97, 0x59, 0xFF, 0xE9, 0x72, 0xAF, 0xFF, 0xD7, 0x0A,
+    0xFF, 0xFF, 0x6A, 0xFD, 0x92, 0x9F, 0xDA, 0x49, 0xFC, 0xA6, 0xAF, 0xC9, 0x3A, 0xFC, 0x70, 0xAF,
+    0xC3, 0xFC, 0x72, 0xFC, 0x91, 0xAF, 0xC7, 0x2A, 0xFA, 0x1F, 0xC9, 0x72, 0x9F, 0xC1, 0xFC, 0x19,
+    0x99, 0xAA, 0xAE, 0x90, 0xFC, 0x1F, 0xC0, 0x9F, 0xFC, 0xA0, 0xFC, 0x1F, 0xC0, 0xAF, 0xFD, 0x0F,
+    0xC9, 0x9F, 0xC0, 0xFF, 0xE0, 0xFC, 0x99, 0xFC, 0x0A, 0xAA, 0xAA, 0x99, 0x99, 0x2F, 0xC9, 0x0F,
+    0xC7, 0x4F, 0xC9, 0x0F, 0xC7, 0x4F, 0xC1, 0xFD, 0x72, 0xAF, 0xC1, 0xFD, 0xA7, 0x09, 0xFD, 0x1F,
+    0xFA, 0x99, 0x09, 0x9A, 0xFF, 0x1A, 0xFF, 0xFF, 0xFC, 0xA2, 0xFF, 0xFF, 0xFC, 0x92, 0xAF, 0xFF,
+    0xFF, 0x4F, 0xFF, 0xFE, 0x95, 0xFF, 0xFF, 0xCA, 0x7A, 0xFF, 0xFD, 0x97, 0x29, 0xAF, 0xEA, 0xA9,
+    0x77, 0x76, 0x0F, 0xC2, 0xFC, 0x2F, 0xC2, 0xFC, 0x2F, 0xC2, 0xFC, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2,
+    0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF9, 0x1A, 0xF9, 0x1A, 0xF9, 0x1A, 0xFA, 0x1F,
+    0xCA, 0x1F, 0xCA, 0x1F, 0xCA, 0x1F, 0xD1, 0xFD, 0x1F, 0xD1, 0xFD, 0x00, 0x2A, 0xF3, 0xAF, 0xC9,
+    0x5F, 0xC3, 0xFD, 0x6F, 0xC2, 0xAF, 0xC9, 0x6F, 0xC1, 0x9F, 0xCA, 0x7F, 0xA1, 0xFD, 0x70, 0xFA,
+    0x09, 0xFC, 0x97, 0x9F, 0xA0, 0xFD, 0x70, 0x9F, 0x9A, 0xFC, 0x97, 0x0A, 0xF9, 0xFC, 0xA7, 0x1A,
+    0xFF, 0xD7, 0x2A, 0xFF, 0xC9, 0x72, 0xFF, 0xD7, 0x3F, 0xFC, 0x97, 0x3F, 0xFA, 0x74, 0xFF, 0x97,
+    0x39, 0xFF, 0xC9, 0x72, 0x9F, 0xFD, 0x97, 0x19, 0xFF, 0xEA, 0x70, 0xAF, 0xFF, 0xA7, 0xAF, 0xAA,
+    0xFF, 0x6F, 0xCA, 0x0A, 0xFF, 0x5F, 0xCA, 0x1F, 0xFC, 0x4F, 0xCA, 0x2F, 0xFC, 0x3F, 0xCA, 0x29,
+    0xFF, 0xC9, 0x1F, 0xCA, 0x39, 0xFF, 0xC9, 0x7A, 0xFE, 0x97, 0x7F, 0xFA, 0x76, 0x9F, 0xFC, 0x76,
+    0xAF, 0xFC, 0x97, 0x5F, 0xFD, 0xA7, 0x5F, 0xFE, 0x74, 0xAF, 0xFE, 0x97, 0x3F, 0xFF, 0xA7, 0x3F,
+    0xFF, 0xC7, 0x29, 0xFD, 0xAF, 0xD9, 0x71, 0xFD, 0xA0, 0xFD, 0xA7, 0x1F, 0xD1, 0xAF, 0xD7, 0x09,
+    0xFC, 0xA2, 0xFD, 0x97, 0xAF, 0xC9, 0x2A, 0xFC, 0xA7, 0xFD, 0x39, 0xFD, 0x69, 0xFC, 0xA4, 0xFD,
+    0x6A, 0xFC, 0x59, 0xFC, 0xA5, 0xFD, 0x6F, 0xD4, 0x9F, 0xC9, 0x6A, 0xFC, 0x4A, 0xFC, 0x70, 0xFC,
+    0xA3, 0xFC, 0xA7, 0x0A, 0xFC, 0x3F, 0xC7, 0x2F, 0xC2, 0xAF, 0xC7, 0x2F, 0xC9, 0x1F, 0xC9, 0x72,
+    0x9F, 0xC1, 0xFC, 0x74, 0xFC, 0x00, 0x09, 0xFD, 0x71, 0xFD, 0x29, 0xFD, 0x97, 0x0F, 0xD2, 0x9F,
+    0xDA, 0x7A, 0xFD, 0x91, 0xAF, 0xE7, 0xFE, 0x91, 0xAF, 0xE9, 0x59, 0xFE, 0x91, 0xAF, 0xF5, 0xAF,
+    0xE9, 0x1A, 0xFF, 0x94, 0xFF, 0x91, 0xAF, 0xFA, 0x3A, 0xFF, 0x91, 0xAF, 0xFC, 0x3F, 0xFC, 0xA1,
+    0xAF, 0xFC, 0xA1, 0x9F, 0xFC, 0xA1, 0xFF, 0xE1, 0xAF, 0xFC, 0xA1, 0xFC, 0x9F, 0xC9, 0x0F, 0xCA,
+    0xFA, 0x1F, 0xC0, 0xFC, 0xA9, 0xFC, 0xAF, 0xA1, 0xFC, 0x0A, 0xFF, 0xDA, 0xAF, 0xA1, 0xFC, 0x99,
+    0xFF, 0xD0, 0xAF, 0xC1, 0xFC, 0x90, 0xFF, 0xD0, 0xFD, 0x1F, 0xC9, 0x0A, 0xFF, 0xA0, 0xFD, 0x1F,
+    0xCA, 0x09, 0xFF, 0x90, 0xFD, 0x1F, 0xCA, 0x1F, 0xF1, 0xFD, 0x1F, 0xCA, 0x1A, 0xFD, 0xA1, 0xFD,
+    0x1F, 0xCA, 0x2F, 0xD9, 0x09, 0xFD, 0x1F, 0xD2, 0xFD, 0x19, 0xFD, 0x1F, 0xD2, 0xAF, 0xC1, 0x9F,
+    0xD1, 0xFD, 0x3F, 0x91, 0xAF, 0xD0, 0x9F, 0xD7, 0x2A, 0xFD, 0x00, 0x77, 0x0F, 0x91, 0x9A, 0xAA,
+    0xAA, 0x70, 0xF9, 0x19, 0xFC, 0xA6, 0x9F, 0x91, 0xAF, 0xD6, 0x9F, 0x91, 0xAF, 0xD9, 0x59, 0xF2,
+    0xAF, 0xE5, 0xAF, 0x2F, 0xF9, 0x4A, 0xF2, 0xFF, 0xC4, 0xAF, 0x2F, 0xFC, 0x93, 0xFC, 0x2F, 0xFD,
+    0x3F, 0xC2, 0xFF, 0xD9, 0x2F, 0xC2, 0xFC, 0xAF, 0xC2, 0xFC, 0x19, 0xFC, 0x9A, 0xF2, 0xFC, 0x19,
+    0xFC, 0xA0, 0xFA, 0x1F, 0xC1, 0x9F, 0xCA, 0x0F, 0xC1, 0xFA, 0x1A, 0xFC, 0xA0, 0x9F, 0xA9, 0xFA,
+    0x1A, 0xFC, 0xA1, 0xFC, 0xAF, 0xA1, 0xAF, 0xCA, 0x1A, 0xFF, 0xCA, 0x1A, 0xFC, 0xA2, 0xFF, 0xCA,
+    0x1F, 0xDA, 0x2A, 0xFF, 0x91, 0xFE, 0x29, 0xFF, 0x91, 0xFE, 0x3F, 0xF9, 0x1F, 0xE3, 0x9F, 0xE9,
+    0x1F, 0xE4, 0xFE, 0x2F, 0xE4, 0xAF, 0xD1, 0x09, 0xFF, 0xFF, 0xA1, 0x9F, 0xFF, 0xFA, 0x19, 0xFF,
+    0xFF, 0xA1, 0x9F, 0xFF, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xFF,
+    0xE7, 0xAF, 0xFE, 0x7A, 0xFF, 0xE7, 0xAF, 0xFE, 0x77, 0x77, 0x77, 0x77, 0x9F, 0xFF, 0xFD, 0xA9,
+    0xFF, 0xFF, 0xDA, 0x9F, 0xFF, 0xFD, 0xA9, 0xFF, 0xFF, 0xDA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x79, 0xAF, 0xCA, 0x97, 0x59, 0xFF, 0xE9, 0x72, 0xAF, 0xFF, 0xD7, 0x0A,
+    0xFF, 0xFF, 0x6A, 0xFD, 0x92, 0x9F, 0xDA, 0x49, 0xFC, 0xA6, 0xAF, 0xC9, 0x3A, 0xFC, 0x70, 0xAF,
+    0xC3, 0xFC, 0x72, 0xFC, 0x91, 0xAF, 0xC7, 0x2A, 0xFA, 0x1F, 0xC9, 0x72, 0x9F, 0xC1, 0xFC, 0x74,
+    0xFC, 0x1F, 0xC7, 0x4F, 0xC1, 0xFC, 0x74, 0xFC, 0x99, 0xFC, 0x74, 0xFC, 0x99, 0xFC, 0x74, 0xFC,
+    0x90, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0x74, 0xFC, 0x1F, 0xD7, 0x2A, 0xFC, 0x1F, 0xDA, 0x70, 0x9F,
+    0xD1, 0xFF, 0xA9, 0x90, 0x99, 0xAF, 0xF1, 0xAF, 0xFF, 0xFF, 0xCA, 0x2F, 0xFF, 0xFF, 0xC9, 0x2A,
+    0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE9, 0x5F, 0xFF, 0xFC, 0xA7, 0xAF, 0xFF, 0xD9, 0x72, 0x9A, 0xFE,
+    0xAA, 0x97, 0x77, 0x60, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xDA, 0x9F,
+    0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9E, 0xA5, 0x9E, 0xA9, 0xEA, 0x59, 0xEA, 0x9E, 0xA5, 0x9E, 0xA9,
+    0xEA, 0x59, 0xEA, 0x9E, 0xA5, 0x9E, 0xA9, 0xEA, 0x59, 0xEA, 0x9E, 0xA5, 0x9E, 0xA9, 0xEA, 0x59,
+    0xEA, 0x9E, 0xA5, 0x9E, 0xA9, 0xEA, 0x59, 0xEA, 0x9E, 0xA5, 0x9E, 0xA9, 0xEA, 0x59, 0xEA, 0x9E,
+    0xA5, 0x9E, 0xA9, 0xEA, 0x59, 0xEA, 0x9E, 0xA5, 0x9E, 0xA9, 0xEA, 0x59, 0xEA, 0x9E, 0xA5, 0x9E,
+    0xA9, 0xEA, 0x59, 0xEA, 0x9A, 0xAA, 0x95, 0x9A, 0xAA, 0x90, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0x97,
+    0x0F, 0xFE, 0xA6, 0xFF, 0xFC, 0x94, 0xFF, 0xFD, 0x93, 0xF9, 0x39, 0xFC, 0x3F, 0x95, 0xF9, 0x2F,
+    0x95, 0xAE, 0xA1, 0x9F, 0x95, 0xAF, 0x19, 0xF9, 0x5F, 0xC1, 0x9F, 0xA9, 0x99, 0x9A, 0xFD, 0x19,
+    0xFF, 0xFE, 0xA1, 0xAF, 0xFF, 0xE2, 0xAF, 0xFF, 0xDA, 0x2A, 0xFF, 0xFC, 0xA3, 0xAF, 0xFF, 0x94,
+    0xAF, 0xFC, 0xA9, 0x6F, 0xCA, 0x74, 0xFC, 0xA7, 0x4F, 0xD7, 0x4F, 0xD7, 0x4F, 0xD7, 0x4F, 0xD7,
+    0x4F, 0xD7, 0x4F, 0xD7, 0x39, 0xFD, 0x73, 0xAF, 0xFF, 0xDA, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA, 0xFC,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFC, 0x97, 0x1F, 0xC7, 0x2F, 0xC7, 0x19, 0xFC, 0x71, 0x9F, 0xA7,
+    0x1A, 0xFA, 0x71, 0xAF, 0x72, 0xF7, 0x2E, 0xA7, 0x09, 0xF7, 0x0A, 0xF7, 0x9F, 0xC7, 0xAF, 0xC7,
+    0xAF, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA, 0xFF, 0xFD, 0xAF, 0xFF, 0xD0,
+    0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0,
+    0x9F, 0xFF, 0xFF, 0xC7, 0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xC7,
+    0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70,
+    0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x77, 0xAF,
+    0xC9, 0x77, 0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x77, 0xAF, 0xC9, 0x70, 0x0F, 0xC7,
+    0x2F, 0xC9, 0x0A, 0xFA, 0x70, 0x9F, 0xC2, 0xFC, 0x97, 0xFC, 0x92, 0xAF, 0xC6, 0x9F, 0xC4, 0xFC,
+    0x95, 0xFC, 0xA4, 0xAF, 0xC4, 0x9F, 0xC5, 0x9F, 0xC9, 0x3F, 0xCA, 0x6F, 0xD2, 0x9F, 0xC7, 0x9F,
+    0xC9, 0x1F, 0xCA, 0x70, 0xFD, 0x09, 0xFC, 0x71, 0x9F, 0xC9, 0xFC, 0xA7, 0x2F, 0xFE, 0x97, 0x2A,
+    0xFF, 0xD7, 0x4F, 0xFC, 0x97, 0x4A, 0xFF, 0x76, 0xFE, 0x97, 0x6A, 0xFD, 0x77, 0x9F, 0xCA, 0x77,
+    0x9F, 0xCA, 0x77, 0xAF, 0xCA, 0x77, 0xAF, 0xCA, 0x77, 0xAF, 0xD7, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F,
+    0xE7, 0x74, 0x99, 0x99, 0x97, 0x77, 0x0F, 0xA7, 0x77, 0x0F, 0xA7, 0x77, 0x0F, 0x97, 0x77, 0x0F,
+    0x97, 0x75, 0x99, 0xAF, 0xCA, 0x99, 0x77, 0x9A, 0xFF, 0xFC, 0xA7, 0x39, 0xFF, 0xFF, 0xDA, 0x70,
+    0xAF, 0xFF, 0xFF, 0xC9, 0x5A, 0xFE, 0x90, 0xF9, 0x09, 0xFE, 0x49, 0xFD, 0xA2, 0xF9, 0x2F, 0xE3,
+    0xFD, 0xA3, 0xF4, 0xFD, 0xA1, 0x9F, 0xD4, 0xF4, 0xAF, 0xD1, 0xFD, 0xA3, 0x9F, 0x5F, 0xD9, 0x0F,
+    0xD9, 0x39, 0xF5, 0xFD, 0xA0, 0xFD, 0x49, 0xF5, 0xAF, 0xCA, 0x0F, 0xD4, 0x9F, 0x5A, 0xFC, 0xA0,
+    0xFD, 0x49, 0xF5, 0xFD, 0xA0, 0xFD, 0xA3, 0x9F, 0x5F, 0xDA, 0x0F, 0xE9, 0x29, 0xF4, 0xFE, 0x90,
+    0xAF, 0xFA, 0x9A, 0xF0, 0x9A, 0xFF, 0xC1, 0x9F, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFD, 0x93,
+    0xFF, 0xFF, 0xFF, 0xA5, 0xFF, 0xFF, 0xFD, 0xA7, 0xAF, 0xFF, 0xFE, 0x97, 0x39, 0xAF, 0xFD, 0xAA,
+    0x97, 0x72, 0xAE, 0xA7, 0x77, 0x0A, 0xEA, 0x77, 0x70, 0xFA, 0x77, 0x70, 0xFA, 0x77, 0x70, 0xAE,
+    0xA7, 0x40, 0x1F, 0xC7, 0x2F, 0xC2, 0x9F, 0xC7, 0x0A, 0xF4, 0xAF, 0xA6, 0x9F, 0xA5, 0xFC, 0x95,
+    0xFC, 0x6A, 0xFC, 0x4F, 0xC9, 0x7F, 0xCA, 0x2A, 0xFC, 0x70, 0x9F, 0xC9, 0x09, 0xFC, 0x72, 0xAF,
+    0xC9, 0xFC, 0xA7, 0x3F, 0xFE, 0x74, 0xAF, 0xFC, 0x97, 0x5F, 0xFA, 0x76, 0x9F, 0xE7, 0x70, 0xFD,
+    0xA7, 0x79, 0xFE, 0x77, 0xFF, 0xC7, 0x5A, 0xFF, 0xCA, 0x73, 0x9F, 0xFE, 0x97, 0x2F, 0xFF, 0xC7,
+    0x1F, 0xE9, 0xFD, 0xA7, 0x9F, 0xD9, 0x0A, 0xFD, 0x96, 0xFD, 0xA2, 0xFE, 0x5F, 0xE3, 0xAF, 0xDA,
+    0x3A, 0xFD, 0x94, 0xFE, 0x92, 0xFE, 0x59, 0xFE, 0x1F, 0xE9, 0x6F, 0xEA, 0x09, 0x99, 0x95, 0x99,
+    0x99, 0x19, 0x99, 0x90, 0x9F, 0x5E, 0xA1, 0xF0, 0x9F, 0x5E, 0xA1, 0xF0, 0x9E, 0xA5, 0xEA, 0x1F,
+    0x09, 0xEA, 0x5E, 0xA1, 0xF0, 0x9E, 0xA5, 0xEA, 0x1F, 0x1F, 0x5E, 0xA0, 0x9F, 0x1F, 0x5E, 0x90,
+    0xAE, 0xA1, 0xF9, 0x4E, 0x90, 0xF9, 0x1F, 0xC4, 0xE9, 0xAF, 0x91, 0x9F, 0xA3, 0xFF, 0xC3, 0xFD,
+    0x90, 0x9F, 0xFA, 0x3A, 0xFF, 0xFF, 0x94, 0xFF, 0xFE, 0xA6, 0xFF, 0xFC, 0xA7, 0x0A, 0xFF, 0xD9,
+    0x73, 0x99, 0xAF, 0x97, 0x70, 0x9E, 0x77, 0x19, 0xE7, 0x71, 0xAE, 0x77, 0x1A, 0xE7, 0x71, 0xAE,
+    0x77, 0x1A, 0xE7, 0x71, 0xAE, 0x77, 0x1A, 0xE7, 0x71, 0xAE, 0x77, 0x1A, 0xE7, 0x70, 0x99, 0xAA,
+    0x99, 0x76, 0xAF, 0xFA, 0x72, 0xAF, 0xFF, 0x97, 0xAF, 0xFF, 0xD9, 0x59, 0xFC, 0xA2, 0x9A, 0xFC,
+    0x94, 0xFC, 0x95, 0x9F, 0xC3, 0xAF, 0x97, 0xAF, 0x92, 0xFC, 0x71, 0xFC, 0x19, 0xF9, 0x71, 0xAF,
+    0x19, 0xF7, 0x29, 0xF9, 0x0A, 0xF7, 0x29, 0xF9, 0x0A, 0xF7, 0x3F, 0x90, 0xAF, 0x73, 0xFA, 0x0A,
+    0xF7, 0x29, 0xF9, 0x0A, 0xF7, 0x29, 0xF9, 0x09, 0xF9, 0x71, 0xFC, 0x2F, 0xA7, 0x09, 0xFC, 0x2A,
+    0xF7, 0x0F, 0xCA, 0x3F, 0xC5, 0xAF, 0xD2, 0x9A, 0xFE, 0x2A, 0xFD, 0xA9, 0x1F, 0xFC, 0x2F, 0xFC,
+    0xA0, 0xFF, 0xC2, 0xFF, 0xCA, 0x0F, 0xFC, 0x91, 0xFF, 0xCA, 0x0F, 0xFC, 0x91, 0xFF, 0xCA, 0x77,
+    0x60, 0x77, 0x79, 0xAE, 0xA7, 0x4A, 0xFF, 0xDA, 0x69, 0xFF, 0xEA, 0x6F, 0xA9, 0xAF, 0xD5, 0x9E,
+    0x93, 0xFC, 0x5E, 0xA4, 0x9F, 0x5E, 0x95, 0xF5, 0xE6, 0xAE, 0x93, 0x9D, 0xA6, 0xAE, 0x93, 0xAD,
+    0xA6, 0x9E, 0xA3, 0x9D, 0x96, 0x9E, 0xA3, 0x9D, 0xA6, 0xAF, 0x39, 0xEA, 0x99, 0x99, 0xAF, 0xD4,
+    0xFF, 0xFE, 0x4A, 0xFF, 0xFD, 0x99, 0xD1, 0xFF, 0xFF, 0xD1, 0x9F, 0xFA, 0xFF, 0x3A, 0xFA, 0x90,
+    0xFE, 0xA7, 0x39, 0xFD, 0x97, 0x73, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xDA, 0x73, 0xAF,
+    0xE7, 0x0A, 0xFF, 0xC9, 0x6F, 0xFE, 0x94, 0xAF, 0xFF, 0x93, 0xAF, 0xC9, 0x9A, 0xFC, 0x29, 0xFA,
+    0x4F, 0x91, 0x9F, 0x6E, 0xA1, 0x9F, 0x59, 0xE9, 0x19, 0xF5, 0xF2, 0x9F, 0x09, 0xFE, 0xA2, 0x9F,
+    0x0A, 0xFE, 0x39, 0xF0, 0xAF, 0xF2, 0x9F, 0x0A, 0xFF, 0xC1, 0x9F, 0x5A, 0xFA, 0x09, 0xF6, 0xAF,
+    0x09, 0xF6, 0x9F, 0x99, 0xFC, 0xA4, 0xAF, 0x99, 0xFE, 0xA9, 0x09, 0xFC, 0x99, 0xFF, 0xFF, 0x99,
+    0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFE, 0x90, 0x9F, 0x09, 0xFF, 0xA1, 0x9F, 0x29, 0xAF,
+    0x92, 0x9F, 0x74, 0x9F, 0x74, 0x9F, 0x74, 0x9F, 0x74, 0x9F, 0x77, 0x76, 0xAF, 0x6F, 0xA1, 0xF9,
+    0x5F, 0xA1, 0xFC, 0x5F, 0xA1, 0x9F, 0x94, 0xAE, 0xA2, 0xFC, 0x4F, 0xC2, 0x9F, 0x93, 0xFC, 0x3F,
+    0xC3, 0xFA, 0x3A, 0xFA, 0x2F, 0xA4, 0xFC, 0x19, 0xF9, 0x4A, 0xFA, 0x0A, 0xF6, 0xFC, 0x0F, 0xC6,
+    0xAF, 0xFC, 0xA6, 0x9F, 0xFC, 0x70, 0xFF, 0xA7, 0x0F, 0xF9, 0x70, 0xAF, 0xE7, 0x19, 0xFD, 0x97,
+    0x19, 0xFD, 0x73, 0xFC, 0xA7, 0x3F, 0xCA, 0x73, 0xFD, 0x73, 0xAF, 0xC7, 0x3A, 0xFC, 0x73, 0x9F,
+    0xC7, 0x39, 0xFC, 0x97, 0x3E, 0xAA, 0x77, 0x60, 0x39, 0xAF, 0xDA, 0x95, 0x9F, 0xFF, 0xA2, 0x9F,
+    0xFF, 0xCA, 0x2F, 0xFF, 0xDA, 0x2A, 0xEA, 0x49, 0xAD, 0xA2, 0xAF, 0xA7, 0x4F, 0xCA, 0x73, 0x9F,
+    0xD9, 0x72, 0x9F, 0xDA, 0x73, 0xFE, 0x73, 0xAF, 0xD7, 0x09, 0xFF, 0xC6, 0xFF, 0xF4, 0xFF, 0xFD,
+    0x2A, 0xFD, 0xAA, 0xFD, 0xA1, 0xFD, 0x39, 0xFC, 0x1F, 0xC5, 0xFC, 0x99, 0xFC, 0x59, 0xFA, 0x9F,
+    0xC5, 0x9F, 0xA9, 0xFC, 0x5A, 0xF9, 0x0F, 0xD9, 0x2A, 0xFC, 0x90, 0xAF, 0xFF, 0xE2, 0xFF, 0xFD,
+    0x92, 0x9F, 0xFF, 0xA4, 0x9F, 0xFD, 0xA7, 0xAF, 0xDA, 0x97, 0x39, 0x99, 0x60, 0x29, 0xAE, 0x96,
+    0xAF, 0xDA, 0x49, 0xDA, 0x19, 0xD9, 0x3A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x39, 0x94, 0x9D, 0x97,
+    0x2A, 0xF9, 0x79, 0xFA, 0x69, 0xEA, 0x99, 0x6E, 0x3A, 0xD3, 0xE3, 0xE9, 0x2E, 0x3E, 0x92, 0xFA,
+    0x9A, 0xE9, 0x29, 0xFF, 0xC4, 0xAF, 0xE9, 0x59, 0xAE, 0x94, 0x2F, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF,
+    0x39, 0xAA, 0xAF, 0xDA, 0xA6, 0xFC, 0xA7, 0x0F, 0xC9, 0x70, 0xFC, 0x71, 0xAF, 0x97, 0x1F, 0xA7,
+    0x1A, 0xF7, 0x2F, 0x97, 0x19, 0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x3F, 0xCA, 0x97, 0x09, 0xFF, 0xA9,
+    0x59, 0xFF, 0xD6, 0xFF, 0xC9, 0x69, 0xAF, 0xD9, 0x71, 0xAF, 0x97, 0x1F, 0xC9, 0x70, 0xAF, 0xC7,
+    0x09, 0xFC, 0xA7, 0x0F, 0xD7, 0x0F, 0xD9, 0x7A, 0xFC, 0xA7, 0x73, 0x19, 0x99, 0x75, 0x9F, 0xC7,
+    0x49, 0xFD, 0x09, 0xAE, 0xA9, 0x39, 0xFF, 0xFD, 0xA5, 0xFF, 0xFC, 0xA4, 0xFF, 0xFD, 0x4F, 0xCA,
+    0x3A, 0xEA, 0x3F, 0xA5, 0xF3, 0xF9, 0x5F, 0x3F, 0x95, 0xF3, 0xF9, 0x5F, 0x29, 0xF9, 0x5F, 0x29,
+    0xF9, 0x5F, 0x29, 0xF9, 0x5F, 0x91, 0x9F, 0xA4, 0x9F, 0x91, 0x9F, 0xA4, 0x9F, 0x91, 0xAF, 0xA4,
+    0x9F, 0x91, 0xAF, 0xC4, 0x9F, 0x91, 0xAF, 0xC4, 0x9F, 0x91, 0xAF, 0xC4, 0xAF, 0x97, 0x4A, 0xFA,
+    0x74, 0xAF, 0xA7, 0x4A, 0xFA, 0x74, 0xAF, 0xA7, 0x4F, 0xCA, 0x74, 0xFC, 0xA7, 0x4A, 0xFA, 0x59,
+    0xAA, 0xAA, 0x71, 0x9F, 0xEA, 0x6A, 0xFF, 0xD4, 0x9F, 0x91, 0xAF, 0x3F, 0x93, 0xAE, 0x91, 0x9F,
+    0x5F, 0x1A, 0xE9, 0x5F, 0x1F, 0x95, 0xAE, 0x90, 0xF6, 0xAE, 0xA9, 0xFF, 0xFE, 0xA9, 0xFF, 0xFE,
+    0xA9, 0xFF, 0xFF, 0x9F, 0xFF, 0xF9, 0xF9, 0x5F, 0xA9, 0xFA, 0x49, 0xFA, 0x0F, 0xC4, 0xAF, 0xA0,
+    0xFD, 0x29, 0xFC, 0x90, 0xFF, 0xFE, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xCA, 0x2A, 0xFF, 0xF4, 0xFF,
+    0xE9, 0x5A, 0xFF, 0x97, 0x9A, 0xF9, 0x40, 0x19, 0x99, 0x94, 0x9E, 0xA4, 0x9E, 0xA4, 0x9E, 0xA4,
+    0x9E, 0xA4, 0x9E, 0xA4, 0x9E, 0xA4, 0x9E, 0xA4, 0x9E, 0xA4, 0x9E, 0xA4, 0xAE, 0xA4, 0xAE, 0xA4,
+    0xAF, 0x4A, 0xF4, 0xFC, 0x4F, 0xC4, 0xFC, 0x90, 0x91, 0xFF, 0x1F, 0xF9, 0x9F, 0xF9, 0x0F, 0xDA,
+    0xA0, 0x1E, 0x91, 0xF9, 0x3E, 0x19, 0xEA, 0x4E, 0x1F, 0x49, 0xE0, 0xAE, 0xA4, 0x9E, 0x0F, 0x5A,
+    0xEA, 0xE9, 0x5A, 0xFD, 0xA6, 0xAF, 0xD7, 0xFD, 0x97, 0xFD, 0x70, 0xFD, 0xA7, 0xFE, 0xA5, 0x9F,
+    0xFA, 0x49, 0xE9, 0xFD, 0x39, 0xE9, 0x0F, 0xD2, 0xAE, 0x90, 0x9F, 0xD1, 0xAE, 0x91, 0x9F, 0xD9,
+    0x77, 0x4F, 0xCA, 0x74, 0xFE, 0xA7, 0x2F, 0xFA, 0x71, 0xFF, 0xCA, 0x70, 0xFF, 0xD7, 0x4A, 0xFC,
+    0x97, 0x49, 0xFA, 0x75, 0xAF, 0x75, 0xAF, 0x97, 0x4F, 0xCA, 0x73, 0x9F, 0xD7, 0x3F, 0xE9, 0x71,
+    0x9F, 0xEA, 0x71, 0xFF, 0xC7, 0x09, 0xFF, 0xC7, 0x0F, 0xCA, 0xFA, 0x69, 0xFC, 0x09, 0xF6, 0xFC,
+    0x91, 0xF5, 0x9F, 0xC2, 0xF9, 0x4F, 0xC9, 0x2A, 0xF3, 0x9F, 0xA3, 0x9F, 0x3F, 0xC5, 0xF9, 0x19,
+    0xFA, 0x5A, 0xF1, 0xFC, 0x69, 0xF0, 0x9F, 0x97, 0xF9, 0x0F, 0x7F, 0x1F, 0x95, 0x9F, 0x1F, 0x95,
+    0x9F, 0x1F, 0xA5, 0x9F, 0x1F, 0xA5, 0x9F, 0x1F, 0xA5, 0x9F, 0x09, 0xFA, 0x59, 0xF0, 0x9F, 0xC5,
+    0xAF, 0x09, 0xFC, 0x5A, 0xF0, 0x9F, 0xC5, 0xFC, 0x09, 0xFC, 0x94, 0xFC, 0x99, 0xFD, 0x92, 0xAF,
+    0xC9, 0x9F, 0xFF, 0xF9, 0xAF, 0xFF, 0xF9, 0xAF, 0xFF, 0xF9, 0xAF, 0xFF, 0xF9, 0xAF, 0xFF, 0xFA,
+    0xAE, 0x09, 0xAF, 0x95, 0xAE, 0x75, 0xF7, 0x5F, 0x77, 0x77, 0xAF, 0x6F, 0xA1, 0xF9, 0x5F, 0xA1,
+    0xFC, 0x5F, 0xA1, 0x9F, 0x94, 0xAF, 0x2F, 0xC4, 0xFC, 0x29, 0xF9, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3,
+    0xAF, 0xA2, 0xFA, 0x4F, 0xC1, 0x9F, 0xA4, 0xAF, 0xA0, 0xAF, 0x95, 0xFC, 0x0F, 0xC6, 0xAF, 0xFC,
+    0xA6, 0x9F, 0xFC, 0x97, 0xFF, 0xC7, 0x0F, 0xF9, 0x70, 0xAF, 0xE7, 0x19, 0xFE, 0x72, 0xAA, 0xAA,
+    0xAA, 0x93, 0x9F, 0xFE, 0x90, 0x9F, 0xFE, 0x90, 0x9F, 0xFE, 0x91, 0xAA, 0xAF, 0xEA, 0x93, 0xAF,
+    0xE5, 0xFF, 0x4A, 0xFF, 0x4A, 0xFF, 0x93, 0xAF, 0xF9, 0x39, 0xFF, 0xA4, 0xAF, 0xEA, 0x5F, 0xE9,
+    0x4F, 0xCA, 0x95, 0x9F, 0x70, 0x9F, 0x70, 0x9F, 0xCA, 0x96, 0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xFF,
+    0x70, 0x9F, 0xA7, 0x0F, 0xA7, 0xAF, 0xA6, 0x9F, 0xC9, 0x59, 0xFC, 0xA6, 0xFD, 0x7F, 0xC9, 0x77,
+    0x49, 0xAF, 0x97, 0x9F, 0xFC, 0x94, 0x9F, 0xFE, 0x93, 0xFD, 0xAA, 0xFC, 0x2A, 0xF9, 0x29, 0xFA,
+    0x1F, 0xA4, 0x9F, 0x1F, 0x6F, 0x99, 0xF6, 0xFA, 0x9F, 0x6A, 0xEA, 0xAF, 0x6A, 0xEA, 0x9F, 0x6F,
+    0xA9, 0xF9, 0x5F, 0xA0, 0xFC, 0x4F, 0xC9, 0x0F, 0xFF, 0xE1, 0xAF, 0xFF, 0xCA, 0x2F, 0xFF, 0xC3,
+    0x9F, 0xFE, 0x94, 0x9F, 0xFC, 0x97, 0x9F, 0xC9, 0x40, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x99, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xC9, 0x2A, 0xEA, 0x2F,
+    0x6A, 0xEA, 0x19, 0xF6, 0xAE, 0xA1, 0x9F, 0x6F, 0x91, 0xAF, 0x6F, 0x91, 0xAE, 0xA6, 0xF9, 0x1A,
+    0xEA, 0x6F, 0x2F, 0x96, 0xF2, 0xF9, 0x6F, 0x2F, 0x69, 0xF1, 0x9F, 0xE3, 0x9F, 0x19, 0xFE, 0x39,
+    0xF2, 0xFE, 0x39, 0xAA, 0xAA, 0x3A, 0xAE, 0x91, 0x70, 0x99, 0xA9, 0x74, 0x9F, 0xE7, 0x1A, 0xFF,
+    0xC9, 0x6A, 0xFF, 0xE5, 0x9F, 0xA3, 0xEA, 0x4F, 0xC5, 0xE3, 0x9F, 0x95, 0xE9, 0x2A, 0xF9, 0x5A,
+    0xDA, 0x2F, 0xC6, 0xAD, 0xA2, 0xFC, 0x95, 0xAD, 0xA2, 0xFC, 0x95, 0xAD, 0xA1, 0x9F, 0xD4, 0x9E,
+    0xA1, 0xAF, 0xFF, 0xE9, 0x1F, 0xFF, 0xF2, 0xFF, 0xFE, 0x92, 0xFF, 0xFD, 0xA2, 0x9F, 0xFF, 0xCA,
+    0x39, 0xFA, 0x09, 0xFC, 0x94, 0xAF, 0xA7, 0x4F, 0xC9, 0x74, 0xFC, 0x75, 0xFC, 0x74, 0x9F, 0xC7,
+    0x4A, 0xEA, 0xA7, 0x40, 0x77, 0x1A, 0xFA, 0x59, 0xFF, 0x92, 0x9F, 0xFD, 0xA1, 0xFC, 0x99, 0xAF,
+    0x90, 0xF3, 0x9E, 0x99, 0xE9, 0x70, 0x9E, 0x97, 0x09, 0xE9, 0x70, 0x9E, 0xA7, 0x1F, 0x71, 0xAF,
+    0x71, 0xFC, 0xA7, 0x9F, 0xD7, 0x9F, 0xC9, 0x7A, 0xF9, 0x79, 0xF9, 0x79, 0xF9, 0x79, 0xF9, 0x79,
+    0xF9, 0x70, 0x9A, 0xD9, 0x77, 0x10, 0x49, 0xAF, 0xFF, 0x39, 0xFF, 0xFE, 0x29, 0xFF, 0xFF, 0x2F,
+    0xDA, 0xFD, 0xA9, 0x99, 0x19, 0xF9, 0x29, 0xFA, 0x4F, 0xA4, 0x9F, 0x4F, 0x6F, 0x92, 0x9F, 0x6F,
+    0x92, 0x9F, 0x6A, 0xEA, 0x2A, 0xF6, 0xAE, 0xA2, 0x9F, 0x6F, 0xA2, 0x9F, 0x95, 0xFA, 0x3F, 0xC4,
+    0xFC, 0x93, 0xFF, 0xFE, 0x4A, 0xFF, 0xFC, 0xA5, 0xFF, 0xFC, 0x69, 0xFF, 0xE9, 0x79, 0xFF, 0xC9,
+    0x72, 0x9F, 0xC9, 0x70, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0xFF, 0xFE, 0xA9,
+    0xFF, 0xFE, 0xA9, 0xFF, 0xFE, 0xA6, 0xF7, 0x39, 0xF7, 0x39, 0xF7, 0x3A, 0xEA, 0x73, 0xAE, 0xA7,
+    0x3F, 0x97, 0x3F, 0x97, 0x3F, 0x74, 0xF7, 0x39, 0xFE, 0x70, 0x9F, 0xE7, 0x1F, 0xE7, 0x2A, 0xAE,
+    0x93, 0x9E, 0x91, 0x9F, 0x29, 0xE9, 0x2A, 0xEA, 0x19, 0xE9, 0x3F, 0x19, 0xEA, 0x3A, 0xE9, 0x1E,
+    0xA4, 0xEA, 0x1E, 0xA4, 0xF1, 0xF4, 0xF1, 0xF4, 0xAE, 0x1F, 0x4A, 0xE9, 0x0F, 0x4A, 0xE9, 0x0F,
+    0x93, 0xAE, 0x90, 0xFC, 0x3F, 0x90, 0xAF, 0xFF, 0x90, 0x9F, 0xFF, 0x2F, 0xFF, 0x2F, 0xFE, 0x93,
+    0xFF, 0xC9, 0x5A, 0xFC, 0xA7, 0x72, 0x72, 0xAA, 0xA9, 0x77, 0x4E, 0x97, 0x74, 0xE9, 0x77, 0x4E,
+    0x97, 0x74, 0xE9, 0x77, 0x39, 0xE9, 0x77, 0x19, 0xAF, 0xCA, 0x97, 0x5A, 0xFF, 0xEA, 0x72, 0xFF,
+    0xFE, 0x70, 0xFF, 0xFF, 0xC6, 0xAF, 0xDA, 0xEA, 0xFE, 0x49, 0xFC, 0xA0, 0x9E, 0x1A, 0xFC, 0xA3,
+    0xFD, 0x19, 0xE2, 0xAF, 0xC2, 0x9F, 0xC2, 0x9E, 0x3F, 0xC9, 0x1A, 0xFA, 0x29, 0xE3, 0xAF, 0xC1,
+    0xFC, 0x92, 0x9E, 0x4F, 0xC1, 0xFC, 0x3A, 0xE4, 0xFC, 0x1F, 0xC3, 0xAE, 0x4F, 0xC9, 0x0F, 0xC3,
+    0xAE, 0x4F, 0xC9, 0x9F, 0xC3, 0xAE, 0x4F, 0xC9, 0x0F, 0xC3, 0xAE, 0x4F, 0xC9, 0x0F, 0xC3, 0xAE,
+    0x4F, 0xC1, 0xFC, 0xA2, 0xAE, 0x3A, 0xFC, 0x1F, 0xDA, 0x1A, 0xE2, 0x9F, 0xD1, 0xFF, 0xAF, 0x9A,
+    0xFF, 0x1A, 0xFF, 0xFF, 0xFC, 0xA2, 0xFF, 0xFF, 0xFC, 0x92, 0xFF, 0xFF, 0xFC, 0x4F, 0xFF, 0xFE,
+    0x94, 0x9F, 0xFF, 0xFC, 0xA7, 0xFF, 0xFE, 0x97, 0x2A, 0xAF, 0xFA, 0x97, 0x7F, 0x77, 0x4E, 0xA7,
+    0x74, 0xEA, 0x77, 0x4E, 0xA7, 0x74, 0xEA, 0x77, 0x4E, 0xA7, 0x20, 0x77, 0x70, 0xAD, 0xA9, 0x71,
+    0xF3, 0xAF, 0xCA, 0x6F, 0xA3, 0xAF, 0xE4, 0xAF, 0x4A, 0xFF, 0x29, 0xF9, 0x4A, 0xFF, 0xA1, 0xFA,
+    0x71, 0xFD, 0x9F, 0xC7, 0x3A, 0xFF, 0xC9, 0x74, 0xFF, 0xC7, 0x59, 0xFE, 0x77, 0xFD, 0xA7, 0x7A,
+    0xFC, 0x77, 0x9F, 0xD9, 0x76, 0xFF, 0x75, 0xAF, 0xF9, 0x73, 0x9F, 0xFD, 0x73, 0xFF, 0xE9, 0x71,
+    0xFD, 0x0A, 0xFC, 0x97, 0xAF, 0xCA, 0x1F, 0xFC, 0xA2, 0x9F, 0xD2, 0xAF, 0xFA, 0x2F, 0xD9, 0x3F,
+    0xFA, 0x1F, 0xDA, 0x4A, 0xFE, 0xA0, 0xAF, 0xD6, 0x9F, 0xDA, 0x09, 0x99, 0x99, 0x99, 0x70, 0x99,
+    0x9A, 0xA9, 0x77, 0x6E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x79, 0xE9, 0x0A, 0xD0, 0xAE, 0x29,
+    0xE9, 0x0A, 0xD1, 0xEA, 0x19, 0xE9, 0x0A, 0xD9, 0x0A, 0xE1, 0x9E, 0xA0, 0xAD, 0x90, 0x9E, 0x91,
+    0xEA, 0x09, 0xD9, 0x1E, 0xA1, 0xEA, 0x09, 0xDA, 0x1F, 0x1F, 0x09, 0xDA, 0x1A, 0xE1, 0xF0, 0x9D,
+    0xA1, 0xAE, 0x1F, 0x1D, 0xA1, 0xAE, 0x90, 0xF1, 0xE1, 0x9E, 0x90, 0xF9, 0x0E, 0x19, 0xE9, 0x0A,
+    0xF0, 0xE1, 0xF9, 0x0A, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD2, 0xFF, 0xFC, 0xA3, 0xFF, 0xF5, 0xFF,
+    0xD7, 0x9A, 0xFA, 0x97, 0x2A, 0xD9, 0x74, 0x9D, 0x97, 0x49, 0xDA, 0x74, 0x9D, 0xA7, 0x49, 0xDA,
+    0x75, 0xDA, 0x75, 0xE7, 0x5E, 0x75, 0x99, 0x60, 0x3F, 0xA4, 0x99, 0x99, 0x7F, 0xC5, 0xAF, 0x59,
+    0xF9, 0x6F, 0x94, 0xFA, 0x7A, 0xF3, 0x9F, 0x71, 0xF3, 0xFA, 0x71, 0xAE, 0x92, 0xF9, 0x2A, 0xD3,
+    0x9E, 0x91, 0x9F, 0x3E, 0x39, 0xEA, 0x19, 0xF3, 0xE3, 0x9E, 0xA1, 0x9F, 0x3E, 0x39, 0xEA, 0x19,
+    0xF9, 0x2E, 0x3F, 0x92, 0xFC, 0x99, 0xFA, 0x1A, 0xF9, 0x2A, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xC9,
+    0x5F, 0xFF, 0xF7, 0x9F, 0xA9, 0xFD, 0xA7, 0x70, 0x9A, 0xA9, 0x60, 0x71, 0xF9, 0x77, 0x29, 0xFC,
+    0x77, 0x2F, 0xD7, 0x72, 0xFD, 0xA7, 0x70, 0xAF, 0xE7, 0x70, 0xFF, 0x97, 0x69, 0xFA, 0xF7, 0x6F,
+    0xA0, 0xF7, 0x6F, 0x90, 0xFA, 0x74, 0xAF, 0x1A, 0xF7, 0x4F, 0xA1, 0x9F, 0x97, 0x29, 0xF9, 0x2F,
+    0xC7, 0x2F, 0xC3, 0xAF, 0x72, 0xFC, 0x39, 0xFA, 0x70, 0xAF, 0x94, 0xFC, 0x70, 0xFC, 0xA9, 0x99,
+    0x99, 0xFC, 0x96, 0x9F, 0xFF, 0xFA, 0x6A, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0xDA, 0x4A, 0xFF, 0xFF,
+    0xE4, 0xFF, 0xFF, 0xF9, 0x29, 0xFC, 0xA7, 0x0F, 0xCA, 0x2A, 0xFC, 0x71, 0xFD, 0x2F, 0xD7, 0x1A,
+    0xFC, 0x90, 0x9F, 0xCA, 0x71, 0x9F, 0xD7, 0x77, 0x77, 0x77, 0x4F, 0x97, 0x72, 0x9F, 0xA7, 0x72,
+    0x9F, 0xA7, 0x72, 0xAF, 0xC7, 0x72, 0xFD, 0x77, 0x2F, 0xD7, 0x72, 0x99, 0x99, 0x99, 0x71, 0x77,
+    0x49, 0xAE, 0xA7, 0x1A, 0xFF, 0xDA, 0x39, 0xFF, 0xEA, 0x3F, 0xA9, 0xAF, 0xD2, 0x9E, 0x93, 0xFC,
+    0x2E, 0xA4, 0x9F, 0x2E, 0x95, 0xF2, 0xE6, 0xAE, 0x90, 0x9D, 0xA6, 0xAE, 0x90, 0xAD, 0xA6, 0x9E,
+    0xA0, 0x9D, 0x96, 0x9E, 0xA0, 0x9D, 0xA6, 0xAF, 0x09, 0xEA, 0x99, 0x99, 0xAF, 0xD1, 0xFF, 0xFE,
+    0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xD9, 0x19, 0xFF, 0xAF, 0x93, 0xAF, 0xA9, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0xF9, 0x73, 0xFA, 0x72, 0x9F, 0xA7, 0x2A, 0xFC, 0x72, 0xFD, 0x72, 0xFD, 0x72, 0x99, 0x99,
+    0x99, 0x50, 0x77, 0x77, 0x3E, 0x97, 0x74, 0xF7, 0x76, 0x9C, 0x97, 0x74, 0x9D, 0x77, 0x4A, 0xD9,
+    0x77, 0x4A, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1F, 0x97, 0x72, 0x9F, 0xC7, 0x72,
+    0xFD, 0x77, 0x2F, 0xDA, 0x77, 0x0A, 0xFE, 0x77, 0x0F, 0xF9, 0x76, 0x9F, 0xAF, 0x76, 0xFA, 0x0F,
+    0x76, 0xF9, 0x0F, 0xA7, 0x4A, 0xF1, 0xAF, 0x74, 0xFA, 0x19, 0xF9, 0x72, 0x9F, 0x92, 0xFC, 0x72,
+    0xFC, 0x3A, 0xF7, 0x2F, 0xC3, 0x9F, 0xA7, 0x0A, 0xF9, 0x4F, 0xC7, 0x0F, 0xCA, 0x99, 0x99, 0x9F,
+    0xC9, 0x69, 0xFF, 0xFF, 0xA6, 0xAF, 0xFF, 0xFC, 0x6F, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xFE, 0x4F,
+    0xFF, 0xFF, 0x92, 0x9F, 0xCA, 0x70, 0xFC, 0xA2, 0xAF, 0xC7, 0x1F, 0xD2, 0xFD, 0x71, 0xAF, 0xC9,
+    0x09, 0xFC, 0xA7, 0x19, 0xFD, 0x00, 0x77, 0x7E, 0x97, 0x4F, 0x97, 0x59, 0xCA, 0x74, 0x9D, 0x74,
+    0x9D, 0x97, 0x5A, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xEA, 0x71, 0xAF, 0xFD, 0xA3, 0x9F, 0xFE,
+    0xA3, 0xFA, 0x9A, 0xFD, 0x29, 0xE9, 0x3F, 0xC2, 0xEA, 0x49, 0xF2, 0xE9, 0x5F, 0x2E, 0x6A, 0xE9,
+    0x09, 0xDA, 0x6A, 0xE9, 0x0A, 0xDA, 0x69, 0xEA, 0x09, 0xD9, 0x69, 0xEA, 0x09, 0xDA, 0x6A, 0xF0,
+    0x9E, 0xA9, 0x99, 0x9A, 0xFD, 0x1F, 0xFF, 0xE1, 0xAF, 0xFF, 0xD2, 0xFF, 0xFD, 0x91, 0x9F, 0xFA,
+    0xF9, 0x3A, 0xFA, 0x95, 0x73, 0xE7, 0x74, 0xAE, 0x77, 0x4E, 0x97, 0x73, 0x9E, 0x77, 0x4F, 0x77,
+    0x39, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xD9, 0x77, 0x4F, 0x77, 0x3F, 0xCA, 0x77,
+    0x1F, 0xEA, 0x77, 0xFF, 0xCA, 0x75, 0xF9, 0x1A, 0xEA, 0x73, 0xF4, 0x9E, 0xA7, 0x29, 0x99, 0x79,
+    0x99, 0x77, 0x77, 0x77, 0x77, 0x0F, 0x97, 0x72, 0x9F, 0xC7, 0x72, 0xFD, 0x77, 0x2F, 0xDA, 0x77,
+    0x0A, 0xFE, 0x77, 0x0F, 0xF9, 0x76, 0x9F, 0xAF, 0x76, 0xFA, 0x0F, 0x76, 0xF9, 0x0F, 0xA7, 0x4A,
+    0xF1, 0xAF, 0x74, 0xFA, 0x19, 0xF9, 0x72, 0x9F, 0x92, 0xFC, 0x72, 0xFC, 0x3A, 0xF7, 0x2F, 0xC3,
+    0x9F, 0xA7, 0x0A, 0xF9, 0x4F, 0xC7, 0x0F, 0xCA, 0x99, 0x99, 0x9F, 0xC9, 0x69, 0xFF, 0xFF, 0xA6,
+    0xAF, 0xFF, 0xFC, 0x6F, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xFE, 0x4F, 0xFF, 0xFF, 0x92, 0x9F, 0xCA,
+    0x70, 0xFC, 0xA2, 0xAF, 0xC7, 0x1F, 0xD2, 0xFD, 0x71, 0xAF, 0xC9, 0x09, 0xFC, 0xA7, 0x19, 0xFD,
+    0x00, 0x75, 0x9D, 0xA7, 0x5E, 0x97, 0x49, 0xE7, 0x5F, 0x79, 0xDA, 0x09, 0xE9, 0x7F, 0x0F, 0x7F,
+    0xD9, 0x71, 0xFF, 0x70, 0xFA, 0xAF, 0x94, 0x9F, 0x92, 0xF9, 0x3A, 0xAA, 0x95, 0x9A, 0xAA, 0x97,
+    0x77, 0x77, 0x77, 0x29, 0xAE, 0xA7, 0x2A, 0xFF, 0xDA, 0x49, 0xFF, 0xEA, 0x4F, 0xA9, 0xAF, 0xD3,
+    0x9E, 0x93, 0xFC, 0x3E, 0xA4, 0x9F, 0x3E, 0x95, 0xF3, 0xE6, 0xAE, 0x91, 0x9D, 0xA6, 0xAE, 0x91,
+    0xAD, 0xA6, 0x9E, 0xA1, 0x9D, 0x96, 0x9E, 0xA1, 0x9D, 0xA6, 0xAF, 0x19, 0xEA, 0x99, 0x99, 0xAF,
+    0xD2, 0xFF, 0xFE, 0x2A, 0xFF, 0xFD, 0x3F, 0xFF, 0xD9, 0x29, 0xFF, 0xAF, 0x94, 0xAF, 0xA9, 0x60,
+    0x9F, 0x97, 0x76, 0x9F, 0xA7, 0x77, 0xFC, 0x77, 0x7F, 0xC9, 0x3A, 0xD9, 0x76, 0xFC, 0xA2, 0xF7,
+    0x76, 0xFC, 0xA7, 0x74, 0xFE, 0xA7, 0x72, 0xFF, 0xCA, 0x77, 0x0F, 0x91, 0xAE, 0xA7, 0x6F, 0x49,
+    0xEA, 0x75, 0x99, 0x97, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x1F, 0x97, 0x75, 0x9F, 0xC7, 0x75,
+    0xFD, 0x77, 0x5F, 0xDA, 0x77, 0x3A, 0xFE, 0x77, 0x3F, 0xF9, 0x77, 0x19, 0xFA, 0xF7, 0x71, 0xFA,
+    0x0F, 0x77, 0x1F, 0x90, 0xFA, 0x77, 0xAF, 0x1A, 0xF7, 0x7F, 0xA1, 0x9F, 0x97, 0x59, 0xF9, 0x2F,
+    0xC7, 0x5F, 0xC3, 0xAF, 0x75, 0xFC, 0x39, 0xFA, 0x73, 0xAF, 0x94, 0xFC, 0x73, 0xFC, 0xA9, 0x99,
+    0x99, 0xFC, 0x97, 0x19, 0xFF, 0xFF, 0xA7, 0x1A, 0xFF, 0xFF, 0xC7, 0x1F, 0xFF, 0xFD, 0xA7, 0xAF,
+    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x95, 0x9F, 0xCA, 0x70, 0xFC, 0xA5, 0xAF, 0xC7, 0x1F, 0xD5, 0xFD,
+    0x71, 0xAF, 0xC9, 0x39, 0xFC, 0xA7, 0x19, 0xFD, 0x00, 0x77, 0x71, 0xF9, 0x77, 0x4F, 0xA7, 0x74,
+    0xFC, 0x77, 0x4F, 0xC9, 0x77, 0x3F, 0xCA, 0x77, 0x74, 0x9D, 0xA7, 0x74, 0xF7, 0x73, 0xAF, 0xC7,
+    0x71, 0xFF, 0x77, 0xFF, 0xD7, 0x5F, 0xA1, 0xAF, 0x73, 0xF9, 0x4F, 0x72, 0x99, 0x97, 0x99, 0x97,
+    0x77, 0x77, 0x77, 0x69, 0xAE, 0xA7, 0x71, 0xAF, 0xFD, 0xA7, 0x39, 0xFF, 0xEA, 0x73, 0xFA, 0x9A,
+    0xFD, 0x72, 0x9E, 0x93, 0xFC, 0x72, 0xEA, 0x49, 0xF7, 0x2E, 0x95, 0xF7, 0x2E, 0x6A, 0xE9, 0x70,
+    0x9D, 0xA6, 0xAE, 0x97, 0x0A, 0xDA, 0x69, 0xEA, 0x70, 0x9D, 0x96, 0x9E, 0xA7, 0x09, 0xDA, 0x6A,
+    0xF7, 0x09, 0xEA, 0x99, 0x99, 0xAF, 0xD7, 0x1F, 0xFF, 0xE7, 0x1A, 0xFF, 0xFD, 0x72, 0xFF, 0xFD,
+    0x97, 0x19, 0xFF, 0xAF, 0x97, 0x3A, 0xFA, 0x95, 0x72, 0xDA, 0x77, 0x5F, 0x77, 0x69, 0xC9, 0x77,
+    0x5D, 0x77, 0x5D, 0x97, 0x74, 0xD9, 0x77, 0x69, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xD9,
+    0x77, 0x4F, 0x77, 0x3F, 0xCA, 0x77, 0x1F, 0xEA, 0x77, 0xFF, 0xCA, 0x75, 0xF9, 0x1A, 0xEA, 0x73,
+    0xF4, 0x9E, 0xA7, 0x29, 0x99, 0x79, 0x99, 0x77, 0x77, 0x77, 0x77, 0x0F, 0x97, 0x72, 0x9F, 0xC7,
+    0x72, 0xFD, 0x77, 0x2F, 0xDA, 0x77, 0x0A, 0xFE, 0x77, 0x0F, 0xF9, 0x76, 0x9F, 0xAF, 0x76, 0xFA,
+    0x0F, 0x76, 0xF9, 0x0F, 0xA7, 0x4A, 0xF1, 0xAF, 0x74, 0xFA, 0x19, 0xF9, 0x72, 0x9F, 0x92, 0xFC,
+    0x72, 0xFC, 0x3A, 0xF7, 0x2F, 0xC3, 0x9F, 0xA7, 0x0A, 0xF9, 0x4F, 0xC7, 0x0F, 0xCA, 0x99, 0x99,
+    0x9F, 0xC9, 0x69, 0xFF, 0xFF, 0xA6, 0xAF, 0xFF, 0xFC, 0x6F, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xFE,
+    0x4F, 0xFF, 0xFF, 0x92, 0x9F, 0xCA, 0x70, 0xFC, 0xA2, 0xAF, 0xC7, 0x1F, 0xD2, 0xFD, 0x71, 0xAF,
+    0xC9, 0x09, 0xFC, 0xA7, 0x19, 0xFD, 0x00, 0x74, 0xEA, 0x76, 0xFC, 0x75, 0xAA, 0xEA, 0x77, 0x9C,
+    0xA7, 0x6A, 0xD9, 0x75, 0xF7, 0x5A, 0xE7, 0x0E, 0x91, 0x9D, 0x70, 0xAF, 0x74, 0xAF, 0xCA, 0x72,
+    0xAF, 0xEA, 0x70, 0xAF, 0x9F, 0xA6, 0xAE, 0xA2, 0xAE, 0xA4, 0xAE, 0x94, 0x9E, 0xA7, 0x77, 0x77,
+    0x49, 0xAE, 0xA7, 0x3A, 0xFF, 0xDA, 0x59, 0xFF, 0xEA, 0x5F, 0xA9, 0xAF, 0xD4, 0x9E, 0x93, 0xFC,
+    0x4E, 0xA4, 0x9F, 0x4E, 0x95, 0xF4, 0xE6, 0xAE, 0x92, 0x9D, 0xA6, 0xAE, 0x92, 0xAD, 0xA6, 0x9E,
+    0xA2, 0x9D, 0x96, 0x9E, 0xA2, 0x9D, 0xA6, 0xAF, 0x29, 0xEA, 0x99, 0x99, 0xAF, 0xD3, 0xFF, 0xFE,
+    0x3A, 0xFF, 0xFD, 0x4F, 0xFF, 0xD9, 0x39, 0xFF, 0xAF, 0x95, 0xAF, 0xA9, 0x70, 0x79, 0xAC, 0xA2,
+    0xD7, 0x7F, 0xC1, 0xD9, 0x75, 0xAF, 0xCA, 0x0D, 0x97, 0x5E, 0x0F, 0xD9, 0x75, 0xE0, 0x9F, 0xC7,
+    0x6A, 0xD1, 0x9E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9E, 0x77, 0x4F, 0x97, 0x72, 0xFD, 0x97,
+    0x70, 0xFF, 0x97, 0x6F, 0xAA, 0xF9, 0x74, 0xF9, 0x19, 0xF9, 0x72, 0xEA, 0x5A, 0xE9, 0x77, 0x77,
+    0x7F, 0x97, 0x72, 0x9F, 0xC7, 0x72, 0xFD, 0x77, 0x2F, 0xDA, 0x77, 0x0A, 0xFE, 0x77, 0x0F, 0xF9,
+    0x76, 0x9F, 0xAF, 0x76, 0xFA, 0x0F, 0x76, 0xF9, 0x0F, 0xA7, 0x4A, 0xF1, 0xAF, 0x74, 0xFA, 0x19,
+    0xF9, 0x72, 0x9F, 0x92, 0xFC, 0x72, 0xFC, 0x3A, 0xF7, 0x2F, 0xC3, 0x9F, 0xA7, 0x0A, 0xF9, 0x4F,
+    0xC7, 0x0F, 0xCA, 0x99, 0x99, 0x9F, 0xC9, 0x69, 0xFF, 0xFF, 0xA6, 0xAF, 0xFF, 0xFC, 0x6F, 0xFF,
+    0xFD, 0xA4, 0xAF, 0xFF, 0xFE, 0x4F, 0xFF, 0xFF, 0x92, 0x9F, 0xCA, 0x70, 0xFC, 0xA2, 0xAF, 0xC7,
+    0x1F, 0xD2, 0xFD, 0x71, 0xAF, 0xC9, 0x09, 0xFC, 0xA7, 0x19, 0xFD, 0x00, 0x4D, 0xA2, 0xD9, 0x6F,
+    0xC1, 0xDA, 0x59, 0xFD, 0x0D, 0xA5, 0xAD, 0x0A, 0xFC, 0xA5, 0xAD, 0x1F, 0xC6, 0x9D, 0x91, 0xAD,
+    0x97, 0x77, 0x77, 0x4E, 0x74, 0xAE, 0x97, 0x29, 0xFC, 0x97, 0x09, 0xFE, 0x96, 0xAF, 0xFC, 0x94,
+    0xAF, 0x19, 0xF9, 0x2A, 0xEA, 0x4A, 0xE9, 0x19, 0x99, 0x70, 0x99, 0x59, 0xAE, 0xA7, 0x1A, 0xFF,
+    0xDA, 0x39, 0xFF, 0xEA, 0x3F, 0xA9, 0xAF, 0xD2, 0x9E, 0x93, 0xFC, 0x2E, 0xA4, 0x9F, 0x2E, 0x95,
+    0xF2, 0xE6, 0xAE, 0x90, 0x9D, 0xA6, 0xAE, 0x90, 0xAD, 0xA6, 0x9E, 0xA0, 0x9D, 0x96, 0x9E, 0xA0,
+    0x9D, 0xA6, 0xAF, 0x09, 0xEA, 0x99, 0x99, 0xAF, 0xD1, 0xFF, 0xFE, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF,
+    0xD9, 0x19, 0xFF, 0xAF, 0x93, 0xAF, 0xA9, 0x50, 0x72, 0xAD, 0x97, 0x74, 0xF7, 0x73, 0xFC, 0xA7,
+    0x71, 0xFE, 0xA7, 0x7F, 0xFC, 0xA7, 0x5F, 0x91, 0xAE, 0xA7, 0x3F, 0x49, 0xEA, 0x72, 0x99, 0x97,
+    0x99, 0x97, 0x77, 0x77, 0x77, 0x70, 0xF9, 0x77, 0x29, 0xFC, 0x77, 0x2F, 0xD7, 0x72, 0xFD, 0xA7,
+    0x70, 0xAF, 0xE7, 0x70, 0xFF, 0x97, 0x69, 0xFA, 0xF7, 0x6F, 0xA0, 0xF7, 0x6F, 0x90, 0xFA, 0x74,
+    0xAF, 0x1A, 0xF7, 0x4F, 0xA1, 0x9F, 0x97, 0x29, 0xF9, 0x2F, 0xC7, 0x2F, 0xC3, 0xAF, 0x72, 0xFC,
+    0x39, 0xFA, 0x70, 0xAF, 0x94, 0xFC, 0x70, 0xFC, 0xA9, 0x99, 0x99, 0xFC, 0x96, 0x9F, 0xFF, 0xFA,
+    0x6A, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0xDA, 0x4A, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xF9, 0x29, 0xFC,
+    0xA7, 0x0F, 0xCA, 0x2A, 0xFC, 0x71, 0xFD, 0x2F, 0xD7, 0x1A, 0xFC, 0x90, 0x9F, 0xCA, 0x71, 0x9F,
+    0xD7, 0x77, 0x77, 0x77, 0x4F, 0x97, 0x72, 0x9F, 0xA7, 0x72, 0x9F, 0xA7, 0x72, 0xAF, 0xC7, 0x72,
+    0xFD, 0x77, 0x2F, 0xD7, 0x72, 0x99, 0x99, 0x99, 0x71, 0x69, 0xDA, 0x74, 0xF7, 0x3A, 0xFC, 0x71,
+    0xFF, 0x7F, 0xFD, 0x5F, 0xA1, 0xAF, 0x3F, 0x94, 0xF2, 0x99, 0x97, 0x99, 0x97, 0x77, 0x76, 0x9A,
+    0xEA, 0x71, 0xAF, 0xFD, 0xA3, 0x9F, 0xFE, 0xA3, 0xFA, 0x9A, 0xFD, 0x29, 0xE9, 0x3F, 0xC2, 0xEA,
+    0x49, 0xF2, 0xE9, 0x5F, 0x2E, 0x6A, 0xE9, 0x09, 0xDA, 0x6A, 0xE9, 0x0A, 0xDA, 0x69, 0xEA, 0x09,
+    0xD9, 0x69, 0xEA, 0x09, 0xDA, 0x6A, 0xF0, 0x9E, 0xA9, 0x99, 0x9A, 0xFD, 0x1F, 0xFF, 0xE1, 0xAF,
+    0xFF, 0xD2, 0xFF, 0xFD, 0x91, 0x9F, 0xFA, 0xF9, 0x3A, 0xFA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x7F,
+    0x97, 0x3F, 0xA7, 0x29, 0xFA, 0x72, 0xAF, 0xC7, 0x2F, 0xD7, 0x2F, 0xD7, 0x29, 0x99, 0x99, 0x95,
+    0x73, 0xE7, 0x74, 0x9E, 0x77, 0x4E, 0xA7, 0x73, 0x9E, 0x77, 0x4F, 0x77, 0x39, 0xEA, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xAA, 0x94, 0xAA, 0xAA, 0x73, 0xF3, 0x9E, 0xA7, 0x3F, 0xFF,
+    0x97, 0x3A, 0xFF, 0xDA, 0x75, 0xAF, 0xFC, 0x77, 0x9A, 0xFA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x76, 0xF9, 0x77, 0x29, 0xFC, 0x77, 0x2F, 0xD7, 0x72, 0xFD, 0xA7, 0x70, 0xAF, 0xE7, 0x70,
+    0xFF, 0x97, 0x69, 0xFA, 0xF7, 0x6F, 0xA0, 0xF7, 0x6F, 0x90, 0xFA, 0x74, 0xAF, 0x1A, 0xF7, 0x4F,
+    0xA1, 0x9F, 0x97, 0x29, 0xF9, 0x2F, 0xC7, 0x2F, 0xC3, 0xAF, 0x72, 0xFC, 0x39, 0xFA, 0x70, 0xAF,
+    0x94, 0xFC, 0x70, 0xFC, 0xA9, 0x99, 0x99, 0xFC, 0x96, 0x9F, 0xFF, 0xFA, 0x6A, 0xFF, 0xFF, 0xC6,
+    0xFF, 0xFF, 0xDA, 0x4A, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xF9, 0x29, 0xFC, 0xA7, 0x0F, 0xCA, 0x2A,
+    0xFC, 0x71, 0xFD, 0x2F, 0xD7, 0x1A, 0xFC, 0x90, 0x9F, 0xCA, 0x71, 0x9F, 0xD0, 0x7A, 0xD9, 0x74,
+    0xE7, 0x4A, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x4F, 0x77, 0x77, 0x77, 0x77, 0x74, 0xAA, 0xAA, 0x49,
+    0xAA, 0xA3, 0xF9, 0x29, 0xF3, 0xFF, 0xFA, 0x39, 0xFF, 0xE5, 0xAF, 0xFC, 0x70, 0xAF, 0xA9, 0x77,
+    0x77, 0x77, 0x77, 0x74, 0x9A, 0xEA, 0x71, 0xAF, 0xFD, 0xA3, 0x9F, 0xFE, 0xA3, 0xFA, 0x9A, 0xFD,
+    0x29, 0xE9, 0x3F, 0xC2, 0xEA, 0x49, 0xF2, 0xE9, 0x5F, 0x2E, 0x6A, 0xE9, 0x09, 0xDA, 0x6A, 0xE9,
+    0x0A, 0xDA, 0x69, 0xEA, 0x09, 0xD9, 0x69, 0xEA, 0x09, 0xDA, 0x6A, 0xF0, 0x9E, 0xA9, 0x99, 0x9A,
+    0xFD, 0x1F, 0xFF, 0xE1, 0xAF, 0xFF, 0xD2, 0xFF, 0xFD, 0x91, 0x9F, 0xFA, 0xF9, 0x3A, 0xFA, 0x95,
+    0x59, 0xF9, 0x77, 0x39, 0xFA, 0x77, 0x39, 0xFC, 0x77, 0x39, 0xFC, 0x97, 0x73, 0xFC, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xAA, 0x94, 0xAA, 0xAA, 0x73, 0xF3, 0x9E, 0xA7,
+    0x3F, 0xFF, 0x97, 0x3A, 0xFF, 0xDA, 0x75, 0xAF, 0xFC, 0x77, 0x9A, 0xFA, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x76, 0xF9, 0x77, 0x29, 0xFC, 0x77, 0x2F, 0xD7, 0x72, 0xFD, 0xA7, 0x70, 0xAF,
+    0xE7, 0x70, 0xFF, 0x97, 0x69, 0xFA, 0xF7, 0x6F, 0xA0, 0xF7, 0x6F, 0x90, 0xFA, 0x74, 0xAF, 0x1A,
+    0xF7, 0x4F, 0xA1, 0x9F, 0x97, 0x29, 0xF9, 0x2F, 0xC7, 0x2F, 0xC3, 0xAF, 0x72, 0xFC, 0x39, 0xFA,
+    0x70, 0xAF, 0x94, 0xFC, 0x70, 0xFC, 0xA9, 0x99, 0x99, 0xFC, 0x96, 0x9F, 0xFF, 0xFA, 0x6A, 0xFF,
+    0xFF, 0xC6, 0xFF, 0xFF, 0xDA, 0x4A, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xF9, 0x29, 0xFC, 0xA7, 0x0F,
+    0xCA, 0x2A, 0xFC, 0x71, 0xFD, 0x2F, 0xD7, 0x1A, 0xFC, 0x90, 0x9F, 0xCA, 0x71, 0x9F, 0xD0, 0x2F,
+    0xA7, 0x4F, 0xC7, 0x4F, 0xC9, 0x73, 0xFC, 0xA7, 0x3F, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72,
+    0xAA, 0xAA, 0x49, 0xAA, 0xA3, 0xF9, 0x29, 0xF3, 0xFF, 0xFA, 0x39, 0xFF, 0xE5, 0xAF, 0xFC, 0x70,
+    0xAF, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9A, 0xEA, 0x71, 0xAF, 0xFD, 0xA3, 0x9F, 0xFE, 0xA3,
+    0xFA, 0x9A, 0xFD, 0x29, 0xE9, 0x3F, 0xC2, 0xEA, 0x49, 0xF2, 0xE9, 0x5F, 0x2E, 0x6A, 0xE9, 0x09,
+    0xDA, 0x6A, 0xE9, 0x0A, 0xDA, 0x69, 0xEA, 0x09, 0xD9, 0x69, 0xEA, 0x09, 0xDA, 0x6A, 0xF0, 0x9E,
+    0xA9, 0x99, 0x9A, 0xFD, 0x1F, 0xFF, 0xE1, 0xAF, 0xFF, 0xD2, 0xFF, 0xFD, 0x91, 0x9F, 0xFA, 0xF9,
+    0x3A, 0xFA, 0x95, 0x77, 0x77, 0x3E, 0x97, 0x74, 0xF7, 0x76, 0x9C, 0x97, 0x74, 0x9D, 0x77, 0x4A,
+    0xD7, 0x75, 0x9A, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5A, 0xAA, 0xA9, 0x3A, 0xAA, 0xA7,
+    0x3F, 0x39, 0xEA, 0x73, 0xFF, 0xF9, 0x73, 0xAF, 0xFD, 0xA7, 0x5A, 0xFF, 0xC7, 0x79, 0xAF, 0xA9,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6F, 0x97, 0x72, 0x9F, 0xC7, 0x72, 0xFD, 0x77, 0x2F,
+    0xDA, 0x77, 0x0A, 0xFE, 0x77, 0x0F, 0xF9, 0x76, 0x9F, 0xAF, 0x76, 0xFA, 0x0F, 0x76, 0xF9, 0x0F,
+    0xA7, 0x4A, 0xF1, 0xAF, 0x74, 0xFA, 0x19, 0xF9, 0x72, 0x9F, 0x92, 0xFC, 0x72, 0xFC, 0x3A, 0xF7,
+    0x2F, 0xC3, 0x9F, 0xA7, 0x0A, 0xF9, 0x4F, 0xC7, 0x0F, 0xCA, 0x99, 0x99, 0x9F, 0xC9, 0x69, 0xFF,
+    0xFF, 0xA6, 0xAF, 0xFF, 0xFC, 0x6F, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xFE, 0x4F, 0xFF, 0xFF, 0x92,
+    0x9F, 0xCA, 0x70, 0xFC, 0xA2, 0xAF, 0xC7, 0x1F, 0xD2, 0xFD, 0x71, 0xAF, 0xC9, 0x09, 0xFC, 0xA7,
+    0x19, 0xFD, 0x00, 0x77, 0x69, 0xEA, 0x73, 0x9F, 0xC7, 0x3A, 0xAE, 0x97, 0x5A, 0xC9, 0x74, 0xE7,
+    0x39, 0xE9, 0x73, 0xE7, 0x6A, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0x73, 0xF4, 0xF3, 0xFF, 0xFC,
+    0x3F, 0xFF, 0x94, 0xFF, 0xDA, 0x59, 0xFF, 0xA7, 0x09, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x39, 0xAE,
+    0xA7, 0x1A, 0xFF, 0xDA, 0x39, 0xFF, 0xEA, 0x3F, 0xA9, 0xAF, 0xD2, 0x9E, 0x93, 0xFC, 0x2E, 0xA4,
+    0x9F, 0x2E, 0x95, 0xF2, 0xE6, 0xAE, 0x90, 0x9D, 0xA6, 0xAE, 0x90, 0xAD, 0xA6, 0x9E, 0xA0, 0x9D,
+    0x96, 0x9E, 0xA0, 0x9D, 0xA6, 0xAF, 0x09, 0xEA, 0x99, 0x99, 0xAF, 0xD1, 0xFF, 0xFE, 0x1A, 0xFF,
+    0xFD, 0x2F, 0xFF, 0xD9, 0x19, 0xFF, 0xAF, 0x93, 0xAF, 0xA9, 0x50, 0x79, 0xDA, 0x19, 0xD7, 0x69,
+    0xFC, 0x1D, 0x97, 0x5A, 0xFC, 0xA9, 0xD9, 0x75, 0xE0, 0xFD, 0x76, 0xE1, 0xFC, 0x76, 0xAD, 0x19,
+    0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xAA, 0xAA, 0x99, 0x2A, 0xAA, 0xA7, 0x3F, 0x39,
+    0xEA, 0x73, 0xFF, 0xF9, 0x73, 0xAF, 0xFD, 0xA7, 0x5A, 0xFF, 0xC7, 0x79, 0xAF, 0xA9, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x6F, 0x97, 0x72, 0x9F, 0xC7, 0x72, 0xFD, 0x77, 0x2F, 0xDA, 0x77,
+    0x0A, 0xFE, 0x77, 0x0F, 0xF9, 0x76, 0x9F, 0xAF, 0x76, 0xFA, 0x0F, 0x76, 0xF9, 0x0F, 0xA7, 0x4A,
+    0xF1, 0xAF, 0x74, 0xFA, 0x19, 0xF9, 0x72, 0x9F, 0x92, 0xFC, 0x72, 0xFC, 0x3A, 0xF7, 0x2F, 0xC3,
+    0x9F, 0xA7, 0x0A, 0xF9, 0x4F, 0xC7, 0x0F, 0xCA, 0x99, 0x99, 0x9F, 0xC9, 0x69, 0xFF, 0xFF, 0xA6,
+    0xAF, 0xFF, 0xFC, 0x6F, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xFE, 0x4F, 0xFF, 0xFF, 0x92, 0x9F, 0xCA,
+    0x70, 0xFC, 0xA2, 0xAF, 0xC7, 0x1F, 0xD2, 0xFD, 0x71, 0xAF, 0xC9, 0x09, 0xFC, 0xA7, 0x19, 0xFD,
+    0x00, 0x39, 0xDA, 0x2D, 0xA6, 0xFC, 0x1D, 0xA5, 0x9F, 0xD0, 0xDA, 0x5A, 0xD0, 0xAF, 0xC9, 0x5E,
+    0x1F, 0xC6, 0x9D, 0x91, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xAA, 0xA9, 0x92, 0x9A, 0xAA,
+    0x3F, 0x93, 0xF3, 0xFF, 0xFA, 0x39, 0xFF, 0xE5, 0xAF, 0xFC, 0x70, 0xAF, 0xA9, 0x77, 0x77, 0x77,
+    0x77, 0x74, 0x9A, 0xEA, 0x71, 0xAF, 0xFD, 0xA3, 0x9F, 0xFE, 0xA3, 0xFA, 0x9A, 0xFD, 0x29, 0xE9,
+    0x3F, 0xC2, 0xEA, 0x49, 0xF2, 0xE9, 0x5F, 0x2E, 0x6A, 0xE9, 0x09, 0xDA, 0x6A, 0xE9, 0x0A, 0xDA,
+    0x69, 0xEA, 0x09, 0xD9, 0x69, 0xEA, 0x09, 0xDA, 0x6A, 0xF0, 0x9E, 0xA9, 0x99, 0x9A, 0xFD, 0x1F,
+    0xFF, 0xE1, 0xAF, 0xFF, 0xD2, 0xFF, 0xFD, 0x91, 0x9F, 0xFA, 0xF9, 0x3A, 0xFA, 0x95, 0x5A, 0xAA,
+    0x99, 0x3A, 0xAA, 0xA7, 0x3F, 0x39, 0xEA, 0x73, 0xFF, 0xF9, 0x73, 0xAF, 0xFD, 0xA7, 0x5A, 0xFF,
+    0xC7, 0x79, 0xAF, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6F, 0x97, 0x72, 0x9F, 0xC7,
+    0x72, 0xFD, 0x77, 0x2F, 0xDA, 0x77, 0x0A, 0xFE, 0x77, 0x0F, 0xF9, 0x76, 0x9F, 0xAF, 0x76, 0xFA,
+    0x0F, 0x76, 0xF9, 0x0F, 0xA7, 0x4A, 0xF1, 0xAF, 0x74, 0xFA, 0x19, 0xF9, 0x72, 0x9F, 0x92, 0xFC,
+    0x72, 0xFC, 0x3A, 0xF7, 0x2F, 0xC3, 0x9F, 0xA7, 0x0A, 0xF9, 0x4F, 0xC7, 0x0F, 0xCA, 0x99, 0x99,
+    0x9F, 0xC9, 0x69, 0xFF, 0xFF, 0xA6, 0xAF, 0xFF, 0xFC, 0x6F, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xFE,
+    0x4F, 0xFF, 0xFF, 0x92, 0x9F, 0xCA, 0x70, 0xFC, 0xA2, 0xAF, 0xC7, 0x1F, 0xD2, 0xFD, 0x71, 0xAF,
+    0xC9, 0x09, 0xFC, 0xA7, 0x19, 0xFD, 0x77, 0x77, 0x77, 0x74, 0xF9, 0x77, 0x29, 0xFA, 0x77, 0x29,
+    0xFA, 0x77, 0x2A, 0xFC, 0x77, 0x2F, 0xD7, 0x72, 0xFD, 0x77, 0x29, 0x99, 0x99, 0x97, 0x10, 0x1A,
+    0xAA, 0xA9, 0x39, 0xAA, 0xA3, 0xF9, 0x29, 0xF3, 0xFF, 0xFA, 0x39, 0xFF, 0xE5, 0xAF, 0xFC, 0x70,
+    0xAF, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9A, 0xEA, 0x71, 0xAF, 0xFD, 0xA3, 0x9F, 0xFE, 0xA3,
+    0xFA, 0x9A, 0xFD, 0x29, 0xE9, 0x3F, 0xC2, 0xEA, 0x49, 0xF2, 0xE9, 0x5F, 0x2E, 0x6A, 0xE9, 0x09,
+    0xDA, 0x6A, 0xE9, 0x0A, 0xDA, 0x69, 0xEA, 0x09, 0xD9, 0x69, 0xEA, 0x09, 0xDA, 0x6A, 0xF0, 0x9E,
+    0xA9, 0x99, 0x9A, 0xFD, 0x1F, 0xFF, 0xE1, 0xAF, 0xFF, 0xD2, 0xFF, 0xFD, 0x91, 0x9F, 0xFA, 0xF9,
+    0x3A, 0xFA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x7F, 0x97, 0x3F, 0xA7, 0x29, 0xFA, 0x72, 0xAF, 0xC7,
+    0x2F, 0xD7, 0x2F, 0xD7, 0x29, 0x99, 0x99, 0x95, 0x19, 0xAA, 0xAA, 0xAA, 0xAF, 0xE9, 0x19, 0xFF,
+    0xFE, 0x2A, 0xFF, 0xFE, 0x2A, 0xFF, 0xFD, 0xA2, 0xAF, 0xAA, 0x99, 0x99, 0x96, 0xAF, 0x75, 0xAF,
+    0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x99, 0x99, 0x99, 0xAA, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F,
+    0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xC9, 0x74, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0xA9, 0x99,
+    0x99, 0x99, 0x99, 0x92, 0xFF, 0xFF, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0xA1, 0xFF,
+    0xFF, 0xA0, 0x9F, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6A, 0xF7, 0x5F, 0xC7, 0x5F,
+    0xC7, 0x5F, 0xC9, 0x73, 0x9F, 0xC9, 0x73, 0xAF, 0xCA, 0x73, 0x99, 0x99, 0x99, 0x60, 0x49, 0xAE,
+    0xA9, 0x70, 0xAF, 0xF6, 0xFF, 0xE9, 0x3F, 0xC9, 0x19, 0xF2, 0x9F, 0x5E, 0x91, 0xFA, 0xAA, 0xAA,
+    0xAF, 0xC1, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x9A, 0xFA, 0x99, 0x99, 0x69, 0xF7,
+    0x39, 0xF9, 0x73, 0xFD, 0x95, 0xAC, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC4, 0xFF,
+    0xEA, 0x59, 0xAF, 0xCA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0x99, 0x99, 0x73, 0xFC, 0x73,
+    0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xC7, 0x2A, 0xFC, 0x97, 0x1A, 0xFC, 0x93, 0x77, 0x72, 0xE9, 0x76,
+    0xF7, 0x70, 0x9C, 0x97, 0x69, 0xD7, 0x69, 0xD9, 0x76, 0xAC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x71, 0x9A, 0xAA, 0xAA, 0xAA, 0xFE, 0x91, 0x9F, 0xFF, 0xE2, 0xAF, 0xFF, 0xE2, 0xAF, 0xFF, 0xDA,
+    0x2A, 0xFA, 0xA9, 0x99, 0x99, 0x6A, 0xF7, 0x5A, 0xF7, 0x5A, 0xF7, 0x5A, 0xF7, 0x5A, 0xF9, 0x99,
+    0x99, 0x9A, 0xA5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFC, 0x97, 0x4F,
+    0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xCA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xF2, 0xFF,
+    0xFF, 0x2F, 0xFF, 0xF9, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF, 0xFA, 0x09, 0xFF, 0xFF, 0xC0, 0x6A, 0xD9,
+    0x74, 0xAE, 0x97, 0x6C, 0xA7, 0x5A, 0xCA, 0x74, 0xDA, 0x74, 0x9C, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x73, 0x9A, 0xEA, 0x97, 0x0A, 0xFF, 0x6F, 0xFE, 0x93, 0xFC, 0x91, 0x9F,
+    0x29, 0xF5, 0xE9, 0x1F, 0xAA, 0xAA, 0xAA, 0xFC, 0x1F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF,
+    0xE9, 0xAF, 0xA9, 0x99, 0x96, 0x9F, 0x73, 0x9F, 0x97, 0x3F, 0xD9, 0x5A, 0xC1, 0xAF, 0xFF, 0xD2,
+    0xFF, 0xFD, 0x29, 0xFF, 0xFC, 0x4F, 0xFE, 0xA5, 0x9A, 0xFC, 0xA9, 0x20, 0x49, 0xDA, 0x2D, 0x97,
+    0x9F, 0xC1, 0xDA, 0x7A, 0xFC, 0xA0, 0xD9, 0x7E, 0x0F, 0xD9, 0x7E, 0x1F, 0xC7, 0x0A, 0xD2, 0xE7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xAA, 0xAA, 0xAA, 0xFE, 0x91, 0x9F, 0xFF, 0xE2, 0xAF,
+    0xFF, 0xE2, 0xAF, 0xFF, 0xDA, 0x2A, 0xFA, 0xA9, 0x99, 0x99, 0x6A, 0xF7, 0x5A, 0xF7, 0x5A, 0xF7,
+    0x5A, 0xF7, 0x5A, 0xF9, 0x99, 0x99, 0x9A, 0xA5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F,
+    0xFF, 0xC5, 0xFC, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xCA, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x2F, 0xFF, 0xF9, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF, 0xFA, 0x09,
+    0xFF, 0xFF, 0xC0, 0x4E, 0x91, 0xDA, 0x6F, 0xC1, 0xE5, 0x9F, 0xD0, 0xE5, 0x9D, 0x0A, 0xFC, 0xA5,
+    0xAD, 0x1F, 0xC9, 0x59, 0xD9, 0x1A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x09, 0xAE, 0xA9, 0x70, 0xAF, 0xF6, 0xFF, 0xE9, 0x3F, 0xC9, 0x19, 0xF2, 0x9F, 0x5E, 0x91, 0xFA,
+    0xAA, 0xAA, 0xAF, 0xC1, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x9A, 0xFA, 0x99, 0x99,
+    0x69, 0xF7, 0x39, 0xF9, 0x73, 0xFD, 0x95, 0xAC, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF,
+    0xC4, 0xFF, 0xEA, 0x59, 0xAF, 0xCA, 0x92, 0x79, 0xD9, 0x77, 0x2F, 0x77, 0x1F, 0xCA, 0x77, 0xFE,
+    0xA4, 0xE5, 0xFF, 0xCA, 0x29, 0xE4, 0xFA, 0x1A, 0xEA, 0x1E, 0xA3, 0xF4, 0x9E, 0xAA, 0xE4, 0x99,
+    0x97, 0x99, 0x9F, 0x77, 0x19, 0xE9, 0x77, 0x77, 0x77, 0x19, 0xAA, 0xAA, 0xAA, 0xAF, 0xE9, 0x59,
+    0xFF, 0xFE, 0x6A, 0xFF, 0xFE, 0x6A, 0xFF, 0xFD, 0xA6, 0xAF, 0xAA, 0x99, 0x99, 0x97, 0x2A, 0xF7,
+    0x71, 0xAF, 0x77, 0x1A, 0xF7, 0x71, 0xAF, 0x77, 0x1A, 0xF9, 0x99, 0x99, 0x9A, 0xA7, 0x1F, 0xFF,
+    0xC7, 0x1F, 0xFF, 0xC7, 0x1F, 0xFF, 0xC7, 0x1F, 0xFF, 0xC7, 0x1F, 0xC9, 0x77, 0x0F, 0xC7, 0x71,
+    0xFC, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x96, 0xFF, 0xFF, 0x6F, 0xFF,
+    0xF6, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0xA5, 0xFF, 0xFF, 0xA4, 0x9F, 0xFF, 0xFC, 0x40, 0x7D, 0xA7,
+    0x72, 0xF9, 0x6E, 0x6A, 0xFC, 0x5A, 0xDA, 0x5A, 0xFE, 0x4E, 0x94, 0xAF, 0xFC, 0x2A, 0xE4, 0xAE,
+    0xA1, 0x9F, 0x1E, 0xA3, 0xAE, 0x94, 0xFF, 0x93, 0x99, 0x97, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xEA, 0x97, 0x6A, 0xFF, 0x74, 0xFF, 0xE9, 0x71, 0xFC, 0x91,
+    0x9F, 0x70, 0x9F, 0x5E, 0x97, 0xFA, 0xAA, 0xAA, 0xAF, 0xC7, 0xFF, 0xFE, 0x69, 0xFF, 0xFE, 0x95,
+    0x9F, 0xFF, 0xE9, 0x5A, 0xFA, 0x99, 0x99, 0x74, 0x9F, 0x77, 0x19, 0xF9, 0x77, 0x1F, 0xD9, 0x5A,
+    0xC7, 0xAF, 0xFF, 0xD7, 0x0F, 0xFF, 0xD7, 0x09, 0xFF, 0xFC, 0x72, 0xFF, 0xEA, 0x73, 0x9A, 0xFC,
+    0xA9, 0x70, 0x9F, 0x97, 0x74, 0xFA, 0x77, 0x4F, 0xC7, 0x74, 0xFC, 0x93, 0x9D, 0x97, 0x3F, 0xCA,
+    0x2F, 0x77, 0x3F, 0xCA, 0x77, 0x1F, 0xEA, 0x77, 0xFF, 0xCA, 0x75, 0xF9, 0x1A, 0xEA, 0x73, 0xF4,
+    0x9F, 0x72, 0x99, 0x97, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9A, 0xAA, 0xAA, 0xAA, 0xFE,
+    0x97, 0x9F, 0xFF, 0xE7, 0x0A, 0xFF, 0xFE, 0x70, 0xAF, 0xFF, 0xDA, 0x70, 0xAF, 0xAA, 0x99, 0x99,
+    0x97, 0x4A, 0xF7, 0x73, 0xAF, 0x77, 0x3A, 0xF7, 0x73, 0xAF, 0x77, 0x3A, 0xF9, 0x99, 0x99, 0x9A,
+    0xA7, 0x3F, 0xFF, 0xC7, 0x3F, 0xFF, 0xC7, 0x3F, 0xFF, 0xC7, 0x3F, 0xFF, 0xC7, 0x3F, 0xC9, 0x77,
+    0x2F, 0xC7, 0x73, 0xFC, 0x77, 0x3F, 0xC7, 0x73, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x97, 0x0F,
+    0xFF, 0xF7, 0x0F, 0xFF, 0xF7, 0x0F, 0xFF, 0xF9, 0x7F, 0xFF, 0xFA, 0x7F, 0xFF, 0xFA, 0x69, 0xFF,
+    0xFF, 0xC0, 0x0A, 0xF7, 0x72, 0xAF, 0x97, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xC3, 0xDA, 0x72, 0xAF,
+    0xC9, 0x0F, 0x97, 0x79, 0xAF, 0xC7, 0x7A, 0xFE, 0x75, 0xAF, 0xFC, 0x73, 0xAE, 0xA1, 0x9F, 0x71,
+    0xAE, 0x94, 0xF7, 0x09, 0x99, 0x79, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x59, 0xAE, 0xA9, 0x76, 0xAF, 0xF7, 0x4F, 0xFE, 0x97, 0x1F, 0xC9, 0x19, 0xF7, 0x09, 0xF5, 0xE9,
+    0x7F, 0xAA, 0xAA, 0xAA, 0xFC, 0x7F, 0xFF, 0xE6, 0x9F, 0xFF, 0xE9, 0x59, 0xFF, 0xFE, 0x95, 0xAF,
+    0xA9, 0x99, 0x97, 0x49, 0xF7, 0x71, 0x9F, 0x97, 0x71, 0xFD, 0x95, 0xAC, 0x7A, 0xFF, 0xFD, 0x70,
+    0xFF, 0xFD, 0x70, 0x9F, 0xFF, 0xC7, 0x2F, 0xFE, 0xA7, 0x39, 0xAF, 0xCA, 0x92, 0x77, 0x77, 0x0E,
+    0x97, 0x6F, 0x77, 0x09, 0xC9, 0x76, 0x9D, 0x70, 0x9D, 0x91, 0xAD, 0x71, 0xF1, 0x9A, 0x71, 0xFC,
+    0xA7, 0x3F, 0xEA, 0x71, 0xFF, 0xCA, 0x7F, 0x91, 0xAE, 0xA5, 0xF4, 0x9F, 0x49, 0x99, 0x79, 0x99,
+    0x77, 0x77, 0x77, 0x74, 0x9A, 0xAA, 0xAA, 0xAA, 0xFE, 0x91, 0x9F, 0xFF, 0xE2, 0xAF, 0xFF, 0xE2,
+    0xAF, 0xFF, 0xDA, 0x2A, 0xFA, 0xA9, 0x99, 0x99, 0x6A, 0xF7, 0x5A, 0xF7, 0x5A, 0xF7, 0x5A, 0xF7,
+    0x5A, 0xF9, 0x99, 0x99, 0x9A, 0xA5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5,
+    0xFC, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xCA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2F,
+    0xFF, 0xF2, 0xFF, 0xFF, 0x2F, 0xFF, 0xF9, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF, 0xFA, 0x09, 0xFF, 0xFF,
+    0xC0, 0x74, 0x9A, 0x99, 0x76, 0xFC, 0x75, 0xFC, 0xA7, 0x79, 0xD7, 0x7A, 0xCA, 0x76, 0xE7, 0x59,
+    0xE9, 0x7E, 0x91, 0x9D, 0x70, 0xAF, 0x74, 0x9F, 0xD7, 0x29, 0xFF, 0x70, 0x9F, 0x9F, 0xC6, 0x9F,
+    0x2A, 0xF4, 0x9E, 0x95, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAE, 0xA9, 0x72,
+    0xAF, 0xF7, 0x0F, 0xFE, 0x95, 0xFC, 0x91, 0x9F, 0x49, 0xF5, 0xE9, 0x3F, 0xAA, 0xAA, 0xAA, 0xFC,
+    0x3F, 0xFF, 0xE2, 0x9F, 0xFF, 0xE9, 0x19, 0xFF, 0xFE, 0x91, 0xAF, 0xA9, 0x99, 0x97, 0x09, 0xF7,
+    0x59, 0xF9, 0x75, 0xFD, 0x95, 0xAC, 0x3A, 0xFF, 0xFD, 0x4F, 0xFF, 0xD4, 0x9F, 0xFF, 0xC6, 0xFF,
+    0xEA, 0x79, 0xAF, 0xCA, 0x94, 0x49, 0xDA, 0x2D, 0x97, 0x0F, 0xC1, 0xDA, 0x7A, 0xFC, 0xA0, 0xD9,
+    0x7E, 0x0F, 0xD9, 0x7E, 0x1F, 0xC7, 0x0A, 0xD2, 0xAD, 0x97, 0x77, 0x77, 0x71, 0x9E, 0x76, 0xF9,
+    0x74, 0xFD, 0x97, 0x2F, 0xF9, 0x70, 0xFA, 0xAF, 0x96, 0xF9, 0x2F, 0x94, 0xF5, 0xAE, 0x97, 0x77,
+    0x77, 0x19, 0xAA, 0xAA, 0xAA, 0xAF, 0xE9, 0x19, 0xFF, 0xFE, 0x2A, 0xFF, 0xFE, 0x2A, 0xFF, 0xFD,
+    0xA2, 0xAF, 0xAA, 0x99, 0x99, 0x96, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x99,
+    0x99, 0x99, 0xAA, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xC9, 0x74,
+    0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFF, 0x2F,
+    0xFF, 0xF2, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0xA1, 0xFF, 0xFF, 0xA0, 0x9F, 0xFF, 0xFC, 0x00, 0x4A,
+    0xCA, 0x2D, 0x96, 0xFC, 0x1D, 0xA5, 0x9F, 0xD0, 0xDA, 0x5A, 0xD0, 0xFD, 0x95, 0xAD, 0x1F, 0xC6,
+    0xAD, 0x2A, 0xD9, 0x77, 0x74, 0xDA, 0x74, 0xF9, 0x72, 0xAF, 0xC7, 0x1A, 0xFE, 0x7A, 0xFF, 0xC5,
+    0xAE, 0xA1, 0x9F, 0x3A, 0xE9, 0x4F, 0x29, 0x99, 0x79, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x73, 0x9A, 0xEA, 0x97, 0x0A, 0xFF, 0x6F, 0xFE, 0x93, 0xFC, 0x91, 0x9F, 0x29, 0xF5, 0xE9, 0x1F,
+    0xAA, 0xAA, 0xAA, 0xFC, 0x1F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0xAF, 0xA9, 0x99,
+    0x96, 0x9F, 0x73, 0x9F, 0x97, 0x3F, 0xD9, 0x5A, 0xC1, 0xAF, 0xFF, 0xD2, 0xFF, 0xFD, 0x29, 0xFF,
+    0xFC, 0x4F, 0xFE, 0xA5, 0x9A, 0xFC, 0xA9, 0x20, 0x79, 0xD9, 0x76, 0xF7, 0x5F, 0xCA, 0x73, 0xFE,
+    0xA7, 0x1F, 0xFC, 0xA7, 0xF9, 0x1A, 0xEA, 0x5F, 0x49, 0xF4, 0x99, 0x97, 0x99, 0x97, 0x77, 0x77,
+    0x77, 0x49, 0xAA, 0xAA, 0xAA, 0xAF, 0xE9, 0x19, 0xFF, 0xFE, 0x2A, 0xFF, 0xFE, 0x2A, 0xFF, 0xFD,
+    0xA2, 0xAF, 0xAA, 0x99, 0x99, 0x96, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0xAF, 0x99,
+    0x99, 0x99, 0xAA, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xC9, 0x74,
+    0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFF, 0x2F,
+    0xFF, 0xF2, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0xA1, 0xFF, 0xFF, 0xA0, 0x9F, 0xFF, 0xFC, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x6A, 0xF7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC9, 0x73, 0x9F, 0xC9, 0x73,
+    0xAF, 0xCA, 0x73, 0x99, 0x99, 0x99, 0x60, 0x7D, 0xA7, 0x4F, 0x97, 0x2A, 0xFC, 0x71, 0xAF, 0xE7,
+    0xAF, 0xFC, 0x5A, 0xEA, 0x19, 0xF3, 0xAE, 0x94, 0xF2, 0x99, 0x97, 0x99, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x39, 0xAE, 0xA9, 0x70, 0xAF, 0xF6, 0xFF, 0xE9, 0x3F, 0xC9, 0x19, 0xF2, 0x9F,
+    0x5E, 0x91, 0xFA, 0xAA, 0xAA, 0xAF, 0xC1, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x9A,
+    0xFA, 0x99, 0x99, 0x69, 0xF7, 0x39, 0xF9, 0x73, 0xFD, 0x95, 0xAC, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF,
+    0xD2, 0x9F, 0xFF, 0xC4, 0xFF, 0xEA, 0x59, 0xAF, 0xCA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69,
+    0x99, 0x99, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xC7, 0x2A, 0xFC, 0x97, 0x1A, 0xFC,
+    0x93, 0x71, 0xAD, 0xA3, 0xAE, 0xA5, 0xCA, 0x4D, 0x93, 0xDA, 0x4C, 0x97, 0x77, 0x77, 0x73, 0xFC,
+    0x2F, 0xC2, 0xFC, 0x2F, 0xC2, 0xFC, 0x2F, 0xC2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A,
+    0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x91, 0xAF, 0x91, 0xAF, 0x91, 0xAF, 0xA1, 0xFC, 0xA1, 0xFC, 0xA1,
+    0xFC, 0xA1, 0xFD, 0x1F, 0xD1, 0xFD, 0x1F, 0xD0, 0x09, 0xDA, 0x29, 0xEA, 0x4A, 0xC3, 0xAC, 0xA2,
+    0xAD, 0x3D, 0x77, 0x77, 0x99, 0x99, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+    0x19, 0xF1, 0x9F, 0x19, 0xF1, 0x9F, 0x90, 0xAF, 0xA0, 0xAF, 0xA0, 0x0F, 0xC2, 0xFC, 0x2F, 0xC2,
+    0xFC, 0x2F, 0xC2, 0xFC, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF,
+    0x2A, 0xF9, 0x1A, 0xF9, 0x1A, 0xF9, 0x1A, 0xFA, 0x1F, 0xCA, 0x1F, 0xCA, 0x1F, 0xCA, 0x1F, 0xD1,
+    0xFD, 0x1F, 0xD1, 0xFD, 0x77, 0x77, 0x77, 0x19, 0xF2, 0x9F, 0x91, 0xAF, 0x91, 0xFC, 0xA1, 0xFD,
+    0x1F, 0xD1, 0x99, 0x99, 0x99, 0x00, 0x19, 0x99, 0x92, 0x9F, 0x2A, 0xF9, 0x1A, 0xFA, 0x1F, 0xCA,
+    0x1F, 0xD0, 0x9F, 0xD7, 0x77, 0x72, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF2,
+    0x9F, 0x29, 0xF2, 0x9F, 0x29, 0xF9, 0x1A, 0xFA, 0x1A, 0xFA, 0x77, 0x77, 0x72, 0x99, 0x99, 0x29,
+    0xF9, 0x19, 0xF9, 0x1A, 0xFA, 0x1F, 0xD1, 0xFD, 0x1F, 0xD0, 0x79, 0xAF, 0xCA, 0x97, 0x59, 0xFF,
+    0xE9, 0x72, 0xAF, 0xFF, 0xD7, 0x0A, 0xFF, 0xFF, 0x6A, 0xFD, 0x92, 0x9F, 0xDA, 0x49, 0xFC, 0xA6,
+    0xAF, 0xC9, 0x3A, 0xFC, 0x70, 0xAF, 0xC3, 0xFC, 0x72, 0xFC, 0x91, 0xAF, 0xC7, 0x2A, 0xFA, 0x1F,
+    0xC9, 0x72, 0x9F, 0xC1, 0xFC, 0x74, 0xFC, 0x1F, 0xC7, 0x4F, 0xC1, 0xFC, 0x74, 0xFC, 0x99, 0xFC,
+    0x74, 0xFC, 0x99, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0x74, 0xFC, 0x1F, 0xD7,
+    0x2A, 0xFC, 0x1F, 0xDA, 0x70, 0x9F, 0xD1, 0xFF, 0xA9, 0x90, 0x99, 0xAF, 0xF1, 0xAF, 0xFF, 0xFF,
+    0xCA, 0x2F, 0xFF, 0xFF, 0xC9, 0x2A, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE9, 0x5F, 0xFF, 0xFC, 0xA7,
+    0xAF, 0xFF, 0xD9, 0x72, 0x9A, 0xFE, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x76, 0x99, 0x99, 0x77, 0x3F, 0xC7, 0x73, 0xFC, 0x77, 0x3F, 0xC7, 0x72, 0x9F, 0xC7, 0x72,
+    0xAF, 0xC9, 0x77, 0x1A, 0xFC, 0xA7, 0x00, 0x49, 0xAF, 0x97, 0x9F, 0xFC, 0x94, 0x9F, 0xFE, 0x93,
+    0xFD, 0xAA, 0xFC, 0x2A, 0xF9, 0x29, 0xFA, 0x1F, 0xA4, 0x9F, 0x1F, 0x6F, 0x99, 0xF6, 0xFA, 0x9F,
+    0x6A, 0xEA, 0xAF, 0x6A, 0xEA, 0x9F, 0x6F, 0xA9, 0xF9, 0x5F, 0xA0, 0xFC, 0x4F, 0xC9, 0x0F, 0xFF,
+    0xE1, 0xAF, 0xFF, 0xCA, 0x2F, 0xFF, 0xC3, 0x9F, 0xFE, 0x94, 0x9F, 0xFC, 0x97, 0x9F, 0xC9, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x99, 0x99, 0x73, 0x9F, 0x97, 0x2A, 0xF9, 0x72, 0xAF, 0xA7, 0x2F, 0xCA,
+    0x72, 0xFD, 0x71, 0x9F, 0xD4, 0x77, 0x77, 0x3E, 0x97, 0x74, 0xF9, 0x77, 0x6C, 0xA7, 0x75, 0xD9,
+    0x77, 0x4D, 0xA7, 0x74, 0x9C, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xFC, 0xA9,
+    0x75, 0x9F, 0xFE, 0x97, 0x2A, 0xFF, 0xFD, 0x70, 0xAF, 0xFF, 0xF6, 0xAF, 0xD9, 0x29, 0xFD, 0xA4,
+    0x9F, 0xCA, 0x6A, 0xFC, 0x93, 0xAF, 0xC7, 0x0A, 0xFC, 0x3F, 0xC7, 0x2F, 0xC9, 0x1A, 0xFC, 0x72,
+    0xAF, 0xA1, 0xFC, 0x97, 0x29, 0xFC, 0x1F, 0xC7, 0x4F, 0xC1, 0xFC, 0x74, 0xFC, 0x1F, 0xC7, 0x4F,
+    0xC9, 0x9F, 0xC7, 0x4F, 0xC9, 0x9F, 0xC7, 0x4F, 0xC9, 0x0F, 0xC7, 0x4F, 0xC9, 0x0F, 0xC7, 0x4F,
+    0xC1, 0xFD, 0x72, 0xAF, 0xC1, 0xFD, 0xA7, 0x09, 0xFD, 0x1F, 0xFA, 0x99, 0x09, 0x9A, 0xFF, 0x1A,
+    0xFF, 0xFF, 0xFC, 0xA2, 0xFF, 0xFF, 0xFC, 0x92, 0xAF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFE, 0x95, 0xFF,
+    0xFF, 0xCA, 0x7A, 0xFF, 0xFD, 0x97, 0x29, 0xAF, 0xEA, 0xA9, 0x77, 0x76, 0x77, 0x7E, 0x97, 0x4F,
+    0x97, 0x6C, 0xA7, 0x5D, 0x97, 0x4D, 0xA7, 0x49, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xF9,
+    0x79, 0xFF, 0xC9, 0x49, 0xFF, 0xE9, 0x3F, 0xDA, 0xAF, 0xC2, 0xAF, 0x92, 0x9F, 0xA1, 0xFA, 0x49,
+    0xF1, 0xF6, 0xF9, 0x9F, 0x6F, 0xA9, 0xF6, 0xAE, 0xAA, 0xF6, 0xAE, 0xA9, 0xF6, 0xFA, 0x9F, 0x95,
+    0xFA, 0x0F, 0xC4, 0xFC, 0x90, 0xFF, 0xFE, 0x1A, 0xFF, 0xFC, 0xA2, 0xFF, 0xFC, 0x39, 0xFF, 0xE9,
+    0x49, 0xFF, 0xC9, 0x79, 0xFC, 0x94, 0x72, 0x9D, 0xA7, 0x75, 0xF7, 0x74, 0xAF, 0xC7, 0x72, 0xAF,
+    0xE4, 0xE9, 0x7A, 0xFF, 0xC2, 0x9E, 0x7F, 0xA1, 0xAF, 0x1E, 0xA6, 0xF9, 0x39, 0xF9, 0xE9, 0x69,
+    0x99, 0x79, 0x99, 0xF7, 0x75, 0xEA, 0x77, 0x77, 0x39, 0xAF, 0xCA, 0x97, 0x69, 0xFF, 0xE9, 0x73,
+    0xAF, 0xFF, 0xD7, 0x1A, 0xFF, 0xFF, 0x7A, 0xFD, 0x92, 0x9F, 0xDA, 0x59, 0xFC, 0xA6, 0xAF, 0xC9,
+    0x4A, 0xFC, 0x70, 0xAF, 0xC4, 0xFC, 0x72, 0xFC, 0x92, 0xAF, 0xC7, 0x2A, 0xFA, 0x2F, 0xC9, 0x72,
+    0x9F, 0xC2, 0xFC, 0x74, 0xFC, 0x2F, 0xC7, 0x4F, 0xC2, 0xFC, 0x74, 0xFC, 0x90, 0x9F, 0xC7, 0x4F,
+    0xC9, 0x09, 0xFC, 0x74, 0xFC, 0x91, 0xFC, 0x74, 0xFC, 0x91, 0xFC, 0x74, 0xFC, 0x2F, 0xD7, 0x2A,
+    0xFC, 0x2F, 0xDA, 0x70, 0x9F, 0xD2, 0xFF, 0xA9, 0x90, 0x99, 0xAF, 0xF2, 0xAF, 0xFF, 0xFF, 0xCA,
+    0x3F, 0xFF, 0xFF, 0xC9, 0x3A, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xE9, 0x6F, 0xFF, 0xFC, 0xA7, 0x0A,
+    0xFF, 0xFD, 0x97, 0x39, 0xAF, 0xEA, 0xA9, 0x77, 0x77, 0x00, 0x77, 0x77, 0x5E, 0x96, 0x9D, 0xA4,
+    0x9E, 0x7F, 0x4E, 0xA6, 0xAF, 0xC2, 0x9E, 0x95, 0xAF, 0xE1, 0xAE, 0x5A, 0xFF, 0xC9, 0xEA, 0x4F,
+    0xA1, 0xAF, 0x7F, 0x94, 0xF6, 0x99, 0x97, 0x99, 0x97, 0x77, 0x77, 0x73, 0x9A, 0xF9, 0x73, 0x9F,
+    0xFC, 0x97, 0x09, 0xFF, 0xE9, 0x7F, 0xDA, 0xAF, 0xC6, 0xAF, 0x92, 0x9F, 0xA5, 0xFA, 0x49, 0xF5,
+    0xF6, 0xF9, 0x39, 0xF6, 0xFA, 0x39, 0xF6, 0xAE, 0xA3, 0xAF, 0x6A, 0xEA, 0x39, 0xF6, 0xFA, 0x39,
+    0xF9, 0x5F, 0xA4, 0xFC, 0x4F, 0xC9, 0x4F, 0xFF, 0xE5, 0xAF, 0xFF, 0xCA, 0x6F, 0xFF, 0xC7, 0x9F,
+    0xFE, 0x97, 0x09, 0xFF, 0xC9, 0x73, 0x9F, 0xC9, 0x70, 0x77, 0x74, 0xFA, 0x77, 0x7F, 0xC7, 0x77,
+    0xFC, 0x94, 0x9D, 0xA7, 0x5F, 0xCA, 0x3F, 0x76, 0xAF, 0xC1, 0xAF, 0xC7, 0x74, 0xAF, 0xE7, 0x72,
+    0xAF, 0xFC, 0x77, 0x0F, 0xA1, 0xAF, 0x76, 0xF9, 0x4F, 0x75, 0x99, 0x97, 0x99, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x9A, 0xFC, 0xA9, 0x77, 0x09, 0xFF, 0xE9, 0x75, 0xAF, 0xFF, 0xD7, 0x3A, 0xFF, 0xFF,
+    0x71, 0xAF, 0xD9, 0x29, 0xFD, 0xA7, 0x9F, 0xCA, 0x6A, 0xFC, 0x96, 0xAF, 0xC7, 0x0A, 0xFC, 0x6F,
+    0xC7, 0x2F, 0xC9, 0x4A, 0xFC, 0x72, 0xAF, 0xA4, 0xFC, 0x97, 0x29, 0xFC, 0x4F, 0xC7, 0x4F, 0xC4,
+    0xFC, 0x74, 0xFC, 0x4F, 0xC7, 0x4F, 0xC9, 0x29, 0xFC, 0x74, 0xFC, 0x92, 0x9F, 0xC7, 0x4F, 0xC9,
+    0x3F, 0xC7, 0x4F, 0xC9, 0x3F, 0xC7, 0x4F, 0xC4, 0xFD, 0x72, 0xAF, 0xC4, 0xFD, 0xA7, 0x09, 0xFD,
+    0x4F, 0xFA, 0x99, 0x09, 0x9A, 0xFF, 0x4A, 0xFF, 0xFF, 0xFC, 0xA5, 0xFF, 0xFF, 0xFC, 0x95, 0xAF,
+    0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x97, 0x0F, 0xFF, 0xFC, 0xA7, 0x2A, 0xFF, 0xFD, 0x97, 0x59, 0xAF,
+    0xEA, 0xA9, 0x77, 0x77, 0x10, 0x0F, 0xA7, 0x72, 0xFC, 0x77, 0x2F, 0xC9, 0x77, 0x1F, 0xCA, 0x77,
+    0x1A, 0xFC, 0x77, 0x70, 0x9D, 0xA7, 0x72, 0xF7, 0x71, 0xAF, 0xC7, 0x7A, 0xFE, 0x75, 0xAF, 0xFC,
+    0x73, 0xFA, 0x1A, 0xF7, 0x1F, 0x94, 0xF7, 0x09, 0x99, 0x79, 0x99, 0x77, 0x77, 0x77, 0x71, 0x9A,
+    0xF9, 0x75, 0x9F, 0xFC, 0x97, 0x29, 0xFF, 0xE9, 0x71, 0xFD, 0xAA, 0xFC, 0x70, 0xAF, 0x92, 0x9F,
+    0xA7, 0xFA, 0x49, 0xF7, 0xF6, 0xF9, 0x59, 0xF6, 0xFA, 0x59, 0xF6, 0xAE, 0xA5, 0xAF, 0x6A, 0xEA,
+    0x59, 0xF6, 0xFA, 0x59, 0xF9, 0x5F, 0xA6, 0xFC, 0x4F, 0xC9, 0x6F, 0xFF, 0xE7, 0xAF, 0xFF, 0xCA,
+    0x70, 0xFF, 0xFC, 0x71, 0x9F, 0xFE, 0x97, 0x29, 0xFF, 0xC9, 0x75, 0x9F, 0xC9, 0x40, 0x72, 0xAD,
+    0x97, 0x74, 0xF9, 0x77, 0x59, 0xCA, 0x77, 0x49, 0xAC, 0x97, 0x73, 0x9E, 0x77, 0x4F, 0x97, 0x72,
+    0xFD, 0x77, 0x1F, 0xF7, 0x7F, 0xCA, 0xF7, 0x5F, 0xA1, 0x9F, 0x73, 0xF5, 0xF7, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x9A, 0xFC, 0xA9, 0x75, 0x9F, 0xFE, 0x97, 0x2A, 0xFF, 0xFD, 0x70, 0xAF, 0xFF, 0xF6,
+    0xAF, 0xD9, 0x29, 0xFD, 0xA4, 0x9F, 0xCA, 0x6A, 0xFC, 0x93, 0xAF, 0xC7, 0x0A, 0xFC, 0x3F, 0xC7,
+    0x2F, 0xC9, 0x1A, 0xFC, 0x72, 0xAF, 0xA1, 0xFC, 0x97, 0x29, 0xFC, 0x1F, 0xC7, 0x4F, 0xC1, 0xFC,
+    0x74, 0xFC, 0x1F, 0xC7, 0x4F, 0xC9, 0x9F, 0xC7, 0x4F, 0xC9, 0x9F, 0xC7, 0x4F, 0xC9, 0x0F, 0xC7,
+    0x4F, 0xC9, 0x0F, 0xC7, 0x4F, 0xC1, 0xFD, 0x72, 0xAF, 0xC1, 0xFD, 0xA7, 0x09, 0xFD, 0x1F, 0xFA,
+    0x99, 0x09, 0x9A, 0xFF, 0x1A, 0xFF, 0xFF, 0xFC, 0xA2, 0xFF, 0xFF, 0xFC, 0x92, 0xAF, 0xFF, 0xFF,
+    0x4F, 0xFF, 0xFE, 0x95, 0xFF, 0xFF, 0xCA, 0x7A, 0xFF, 0xFD, 0x97, 0x29, 0xAF, 0xEA, 0xA9, 0x77,
+    0x76, 0x74, 0xEA, 0x76, 0xFC, 0x75, 0xAA, 0xEA, 0x77, 0x0D, 0x76, 0x9D, 0xA7, 0x59, 0xE7, 0x59,
+    0xE7, 0x0E, 0x91, 0x9D, 0x70, 0xAF, 0x74, 0xAF, 0xCA, 0x72, 0xAF, 0xEA, 0x70, 0xAF, 0x9F, 0xA6,
+    0xAE, 0xA2, 0xAE, 0xA4, 0xAE, 0x94, 0x9E, 0xA7, 0x77, 0x77, 0x59, 0xAF, 0x97, 0x19, 0xFF, 0xC9,
+    0x69, 0xFF, 0xE9, 0x5F, 0xDA, 0xAF, 0xC4, 0xAF, 0x92, 0x9F, 0xA3, 0xFA, 0x49, 0xF3, 0xF6, 0xF9,
+    0x19, 0xF6, 0xFA, 0x19, 0xF6, 0xAE, 0xA1, 0xAF, 0x6A, 0xEA, 0x19, 0xF6, 0xFA, 0x19, 0xF9, 0x5F,
+    0xA2, 0xFC, 0x4F, 0xC9, 0x2F, 0xFF, 0xE3, 0xAF, 0xFF, 0xCA, 0x4F, 0xFF, 0xC5, 0x9F, 0xFE, 0x96,
+    0x9F, 0xFC, 0x97, 0x19, 0xFC, 0x96, 0x70, 0xAC, 0xA2, 0xD9, 0x76, 0xFC, 0x1E, 0x75, 0x9F, 0xD0,
+    0xDA, 0x75, 0xAD, 0x0A, 0xFC, 0xA7, 0x5A, 0xD1, 0xFC, 0x76, 0x9D, 0x91, 0xAD, 0x97, 0x77, 0x77,
+    0x77, 0x74, 0xE7, 0x74, 0xAE, 0xA7, 0x72, 0x9F, 0xC9, 0x77, 0x09, 0xFE, 0x97, 0x69, 0xFA, 0xF9,
+    0x74, 0xAF, 0x19, 0xF9, 0x72, 0xAE, 0xA4, 0xAE, 0x97, 0x19, 0x99, 0x70, 0x99, 0x75, 0x9A, 0xFC,
+    0xA9, 0x75, 0x9F, 0xFE, 0x97, 0x2A, 0xFF, 0xFD, 0x70, 0xAF, 0xFF, 0xF6, 0xAF, 0xD9, 0x29, 0xFD,
+    0xA4, 0x9F, 0xCA, 0x6A, 0xFC, 0x93, 0xAF, 0xC7, 0x0A, 0xFC, 0x3F, 0xC7, 0x2F, 0xC9, 0x1A, 0xFC,
+    0x72, 0xAF, 0xA1, 0xFC, 0x97, 0x29, 0xFC, 0x1F, 0xC7, 0x4F, 0xC1, 0xFC, 0x74, 0xFC, 0x1F, 0xC7,
+    0x4F, 0xC9, 0x9F, 0xC7, 0x4F, 0xC9, 0x9F, 0xC7, 0x4F, 0xC9, 0x0F, 0xC7, 0x4F, 0xC9, 0x0F, 0xC7,
+    0x4F, 0xC1, 0xFD, 0x72, 0xAF, 0xC1, 0xFD, 0xA7, 0x09, 0xFD, 0x1F, 0xFA, 0x99, 0x09, 0x9A, 0xFF,
+    0x1A, 0xFF, 0xFF, 0xFC, 0xA2, 0xFF, 0xFF, 0xFC, 0x92, 0xAF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFE, 0x95,
+    0xFF, 0xFF, 0xCA, 0x7A, 0xFF, 0xFD, 0x97, 0x29, 0xAF, 0xEA, 0xA9, 0x77, 0x76, 0x4D, 0xA2, 0xD9,
+    0x6F, 0xC1, 0xDA, 0x59, 0xFD, 0x0D, 0xA5, 0xAD, 0x0A, 0xFC, 0xA5, 0xAD, 0x1F, 0xC6, 0x9D, 0x91,
+    0xAD, 0x97, 0x77, 0x77, 0x4E, 0x74, 0xAE, 0xA7, 0x29, 0xFC, 0x97, 0x09, 0xFE, 0x96, 0x9F, 0xAF,
+    0x94, 0xAF, 0x19, 0xF9, 0x2A, 0xEA, 0x4A, 0xE9, 0x19, 0x99, 0x70, 0x99, 0x95, 0x9A, 0xF9, 0x79,
+    0xFF, 0xC9, 0x49, 0xFF, 0xE9, 0x3F, 0xDA, 0xAF, 0xC2, 0xAF, 0x92, 0x9F, 0xA1, 0xFA, 0x49, 0xF1,
+    0xF6, 0xF9, 0x9F, 0x6F, 0xA9, 0xF6, 0xAE, 0xAA, 0xF6, 0xAE, 0xA9, 0xF6, 0xFA, 0x9F, 0x95, 0xFA,
+    0x0F, 0xC4, 0xFC, 0x90, 0xFF, 0xFE, 0x1A, 0xFF, 0xFC, 0xA2, 0xFF, 0xFC, 0x39, 0xFF, 0xE9, 0x49,
+    0xFF, 0xC9, 0x79, 0xFC, 0x94, 0x72, 0x9D, 0xA7, 0x74, 0xF7, 0x73, 0xAF, 0xC7, 0x71, 0xAF, 0xE7,
+    0x7A, 0xFF, 0xC7, 0x5F, 0xA1, 0xAF, 0x73, 0xF9, 0x4F, 0x72, 0x99, 0x97, 0x99, 0x97, 0x77, 0x77,
+    0x77, 0x69, 0xAF, 0xCA, 0x97, 0x59, 0xFF, 0xE9, 0x72, 0xAF, 0xFF, 0xD7, 0x0A, 0xFF, 0xFF, 0x6A,
+    0xFD, 0x92, 0x9F, 0xDA, 0x49, 0xFC, 0xA6, 0xAF, 0xC9, 0x3A, 0xFC, 0x70, 0xAF, 0xC3, 0xFC, 0x72,
+    0xFC, 0x91, 0xAF, 0xC7, 0x2A, 0xFA, 0x1F, 0xC9, 0x72, 0x9F, 0xC1, 0xFC, 0x74, 0xFC, 0x1F, 0xC7,
+    0x4F, 0xC1, 0xFC, 0x74, 0xFC, 0x99, 0xFC, 0x74, 0xFC, 0x99, 0xFC, 0x74, 0xFC, 0x90, 0xFC, 0x74,
+    0xFC, 0x90, 0xFC, 0x74, 0xFC, 0x1F, 0xD7, 0x2A, 0xFC, 0x1F, 0xDA, 0x70, 0x9F, 0xD1, 0xFF, 0xA9,
+    0x90, 0x99, 0xAF, 0xF1, 0xAF, 0xFF, 0xFF, 0xCA, 0x2F, 0xFF, 0xFF, 0xC9, 0x2A, 0xFF, 0xFF, 0xF4,
+    0xFF, 0xFF, 0xE9, 0x5F, 0xFF, 0xFC, 0xA7, 0xAF, 0xFF, 0xD9, 0x72, 0x9A, 0xFE, 0xAA, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x99, 0x99, 0x77, 0x3F, 0xC7, 0x73, 0xFC,
+    0x77, 0x3F, 0xC7, 0x72, 0x9F, 0xC7, 0x72, 0xAF, 0xC9, 0x77, 0x1A, 0xFC, 0xA7, 0x00, 0x69, 0xDA,
+    0x74, 0xF7, 0x3A, 0xFC, 0x71, 0xAF, 0xE7, 0xAF, 0xFC, 0x5F, 0xA1, 0xAF, 0x3F, 0x94, 0xF2, 0x99,
+    0x97, 0x99, 0x97, 0x77, 0x77, 0x9A, 0xF9, 0x79, 0xFF, 0xC9, 0x49, 0xFF, 0xE9, 0x3F, 0xDA, 0xAF,
+    0xC2, 0xAF, 0x92, 0x9F, 0xA1, 0xFA, 0x49, 0xF1, 0xF6, 0xF9, 0x9F, 0x6F, 0xA9, 0xF6, 0xAE, 0xAA,
+    0xF6, 0xAE, 0xA9, 0xF6, 0xFA, 0x9F, 0x95, 0xFA, 0x0F, 0xC4, 0xFC, 0x90, 0xFF, 0xFE, 0x1A, 0xFF,
+    0xFC, 0xA2, 0xFF, 0xFC, 0x39, 0xFF, 0xE9, 0x49, 0xFF, 0xC9, 0x79, 0xFC, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x69, 0xF7, 0x3A, 0xF7, 0x3F, 0xC9, 0x72, 0xFC, 0x97, 0x2F, 0xCA, 0x71, 0x9F, 0xCA,
+    0x72, 0x99, 0x99, 0x99, 0x50, 0x74, 0xE7, 0x75, 0xAD, 0xA7, 0x75, 0xE9, 0x77, 0x4A, 0xE7, 0x75,
+    0xEA, 0x77, 0x4A, 0xE9, 0x77, 0x77, 0x77, 0x72, 0xAA, 0x97, 0x76, 0xAD, 0xA7, 0x75, 0x9E, 0x79,
+    0xAF, 0xCA, 0x94, 0x9E, 0x59, 0xFF, 0xEA, 0x2A, 0xDA, 0x4A, 0xFF, 0xFD, 0x9F, 0x93, 0xAF, 0xFF,
+    0xFF, 0x3A, 0xFD, 0x92, 0x9F, 0xFC, 0x39, 0xFC, 0xA6, 0xAF, 0xD4, 0xAF, 0xC7, 0x0A, 0xFC, 0x4F,
+    0xC7, 0x2F, 0xC9, 0x2A, 0xFC, 0x72, 0xAF, 0xA2, 0xFC, 0x97, 0x29, 0xFC, 0x2F, 0xC7, 0x4F, 0xC2,
+    0xFC, 0x74, 0xFC, 0x91, 0xFC, 0x74, 0xFC, 0x90, 0x9F, 0xC7, 0x4F, 0xC9, 0x09, 0xFC, 0x74, 0xFC,
+    0x91, 0xFC, 0x74, 0xFC, 0x91, 0xFC, 0x74, 0xFC, 0x2F, 0xD7, 0x2A, 0xFC, 0x2F, 0xDA, 0x70, 0x9F,
+    0xD2, 0xFF, 0xA9, 0x90, 0x99, 0xAF, 0xF2, 0xAF, 0xFF, 0xFF, 0xCA, 0x3F, 0xFF, 0xFF, 0xC9, 0x3A,
+    0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xE9, 0x6F, 0xFF, 0xFC, 0xA7, 0x0A, 0xFF, 0xFD, 0x97, 0x39, 0xAF,
+    0xEA, 0xA9, 0x77, 0x77, 0x00, 0x77, 0x72, 0xAD, 0x97, 0x6E, 0x76, 0xAE, 0x76, 0xE9, 0x75, 0xAE,
+    0x76, 0xF7, 0x77, 0x77, 0x2A, 0xAA, 0x77, 0xAD, 0xA4, 0x9A, 0xF9, 0x29, 0xE2, 0x9F, 0xFC, 0x90,
+    0xAD, 0xA1, 0x9F, 0xFE, 0xAE, 0x91, 0xFD, 0xAA, 0xFF, 0x1A, 0xF9, 0x29, 0xFD, 0x91, 0xFA, 0x49,
+    0xFA, 0x2F, 0x6F, 0x91, 0x9F, 0x6F, 0x91, 0x9F, 0x6A, 0xEA, 0x1A, 0xF6, 0xAE, 0xA1, 0x9F, 0x6F,
+    0xA1, 0x9F, 0x95, 0xFA, 0x2F, 0xC4, 0xFC, 0x92, 0xFF, 0xFE, 0x3A, 0xFF, 0xFC, 0xA4, 0xFF, 0xFC,
+    0x59, 0xFF, 0xE9, 0x69, 0xFF, 0xC9, 0x71, 0x9F, 0xC9, 0x60, 0x6A, 0xF7, 0x75, 0x9F, 0x97, 0x74,
+    0x9F, 0xA7, 0x74, 0x9F, 0xC7, 0x74, 0x9F, 0xC9, 0x77, 0x70, 0x97, 0x77, 0x77, 0x77, 0xA9, 0x97,
+    0x76, 0xAD, 0xA7, 0x75, 0x9E, 0x79, 0xAF, 0xCA, 0x94, 0x9E, 0x59, 0xFF, 0xEA, 0x2A, 0xDA, 0x4A,
+    0xFF, 0xFD, 0x9F, 0x93, 0xAF, 0xFF, 0xFF, 0x3A, 0xFD, 0x92, 0x9F, 0xFC, 0x39, 0xFC, 0xA6, 0xAF,
+    0xD4, 0xAF, 0xC7, 0x0A, 0xFC, 0x4F, 0xC7, 0x2F, 0xC9, 0x2A, 0xFC, 0x72, 0xAF, 0xA2, 0xFC, 0x97,
+    0x29, 0xFC, 0x2F, 0xC7, 0x4F, 0xC2, 0xFC, 0x74, 0xFC, 0x91, 0xFC, 0x74, 0xFC, 0x90, 0x9F, 0xC7,
+    0x4F, 0xC9, 0x09, 0xFC, 0x74, 0xFC, 0x91, 0xFC, 0x74, 0xFC, 0x91, 0xFC, 0x74, 0xFC, 0x2F, 0xD7,
+    0x2A, 0xFC, 0x2F, 0xDA, 0x70, 0x9F, 0xD2, 0xFF, 0xA9, 0x90, 0x99, 0xAF, 0xF2, 0xAF, 0xFF, 0xFF,
+    0xCA, 0x3F, 0xFF, 0xFF, 0xC9, 0x3A, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xE9, 0x6F, 0xFF, 0xFC, 0xA7,
+    0x0A, 0xFF, 0xFD, 0x97, 0x39, 0xAF, 0xEA, 0xA9, 0x77, 0x77, 0x00, 0x2F, 0xA7, 0x6F, 0xC7, 0x6F,
+    0xC9, 0x75, 0xFC, 0xA7, 0x5F, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x75, 0xE9, 0x76, 0xAD, 0xA4, 0x9A,
+    0xF9, 0x29, 0xE2, 0x9F, 0xFC, 0x90, 0xAD, 0xA1, 0x9F, 0xFE, 0xAE, 0x91, 0xFD, 0xAA, 0xFF, 0x1A,
+    0xF9, 0x29, 0xFD, 0x91, 0xFA, 0x49, 0xFA, 0x2F, 0x6F, 0x91, 0x9F, 0x6F, 0x91, 0x9F, 0x6A, 0xEA,
+    0x1A, 0xF6, 0xAE, 0xA1, 0x9F, 0x6F, 0xA1, 0x9F, 0x95, 0xFA, 0x2F, 0xC4, 0xFC, 0x92, 0xFF, 0xFE,
+    0x3A, 0xFF, 0xFC, 0xA4, 0xFF, 0xFC, 0x59, 0xFF, 0xE9, 0x69, 0xFF, 0xC9, 0x71, 0x9F, 0xC9, 0x60,
+    0x77, 0x77, 0x49, 0xDA, 0x77, 0x59, 0xF7, 0x77, 0xAC, 0x77, 0x6A, 0xD7, 0x75, 0xAD, 0x77, 0x6A,
+    0xA7, 0x77, 0x77, 0x77, 0x39, 0x77, 0x70, 0xEA, 0x77, 0x59, 0xE7, 0x9A, 0xFC, 0xA9, 0x49, 0xE5,
+    0x9F, 0xFE, 0xA2, 0xAD, 0xA4, 0xAF, 0xFF, 0xD9, 0xF9, 0x3A, 0xFF, 0xFF, 0xF3, 0xAF, 0xD9, 0x29,
+    0xFF, 0xC3, 0x9F, 0xCA, 0x6A, 0xFD, 0x4A, 0xFC, 0x70, 0xAF, 0xC4, 0xFC, 0x72, 0xFC, 0x92, 0xAF,
+    0xC7, 0x2A, 0xFA, 0x2F, 0xC9, 0x72, 0x9F, 0xC2, 0xFC, 0x74, 0xFC, 0x2F, 0xC7, 0x4F, 0xC9, 0x1F,
+    0xC7, 0x4F, 0xC9, 0x09, 0xFC, 0x74, 0xFC, 0x90, 0x9F, 0xC7, 0x4F, 0xC9, 0x1F, 0xC7, 0x4F, 0xC9,
+    0x1F, 0xC7, 0x4F, 0xC2, 0xFD, 0x72, 0xAF, 0xC2, 0xFD, 0xA7, 0x09, 0xFD, 0x2F, 0xFA, 0x99, 0x09,
+    0x9A, 0xFF, 0x2A, 0xFF, 0xFF, 0xFC, 0xA3, 0xFF, 0xFF, 0xFC, 0x93, 0xAF, 0xFF, 0xFF, 0x5F, 0xFF,
+    0xFE, 0x96, 0xFF, 0xFF, 0xCA, 0x70, 0xAF, 0xFF, 0xD9, 0x73, 0x9A, 0xFE, 0xAA, 0x97, 0x77, 0x70,
+    0x77, 0x71, 0xE9, 0x76, 0xF9, 0x77, 0x0C, 0xA7, 0x7D, 0x97, 0x6D, 0xA7, 0x69, 0xC9, 0x77, 0x77,
+    0x77, 0x75, 0xDA, 0x97, 0x6A, 0xDA, 0x49, 0xAF, 0x92, 0x9E, 0x29, 0xFF, 0xC9, 0x0A, 0xDA, 0x19,
+    0xFF, 0xEA, 0xE9, 0x1F, 0xDA, 0xAF, 0xF1, 0xAF, 0x92, 0x9F, 0xD9, 0x1F, 0xA4, 0x9F, 0xA2, 0xF6,
+    0xF9, 0x19, 0xF6, 0xF9, 0x19, 0xF6, 0xAE, 0xA1, 0xAF, 0x6A, 0xEA, 0x19, 0xF6, 0xFA, 0x19, 0xF9,
+    0x5F, 0xA2, 0xFC, 0x4F, 0xC9, 0x2F, 0xFF, 0xE3, 0xAF, 0xFF, 0xCA, 0x4F, 0xFF, 0xC5, 0x9F, 0xFE,
+    0x96, 0x9F, 0xFC, 0x97, 0x19, 0xFC, 0x96, 0x70, 0xAD, 0xA1, 0xAD, 0x77, 0xAF, 0xA0, 0x9D, 0x77,
+    0xFD, 0x99, 0xD7, 0x7D, 0xA0, 0xFD, 0x77, 0xDA, 0x09, 0xFA, 0x77, 0xE1, 0x9D, 0xA7, 0x77, 0x77,
+    0x77, 0x09, 0x77, 0x70, 0xEA, 0x77, 0x59, 0xE7, 0x9A, 0xFC, 0xA9, 0x49, 0xE5, 0x9F, 0xFE, 0xA2,
+    0xAD, 0xA4, 0xAF, 0xFF, 0xD9, 0xF9, 0x3A, 0xFF, 0xFF, 0xF3, 0xAF, 0xD9, 0x29, 0xFF, 0xC3, 0x9F,
+    0xCA, 0x6A, 0xFD, 0x4A, 0xFC, 0x70, 0xAF, 0xC4, 0xFC, 0x72, 0xFC, 0x92, 0xAF, 0xC7, 0x2A, 0xFA,
+    0x2F, 0xC9, 0x72, 0x9F, 0xC2, 0xFC, 0x74, 0xFC, 0x2F, 0xC7, 0x4F, 0xC9, 0x1F, 0xC7, 0x4F, 0xC9,
+    0x09, 0xFC, 0x74, 0xFC, 0x90, 0x9F, 0xC7, 0x4F, 0xC9, 0x1F, 0xC7, 0x4F, 0xC9, 0x1F, 0xC7, 0x4F,
+    0xC2, 0xFD, 0x72, 0xAF, 0xC2, 0xFD, 0xA7, 0x09, 0xFD, 0x2F, 0xFA, 0x99, 0x09, 0x9A, 0xFF, 0x2A,
+    0xFF, 0xFF, 0xFC, 0xA3, 0xFF, 0xFF, 0xFC, 0x93, 0xAF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFE, 0x96, 0xFF,
+    0xFF, 0xCA, 0x70, 0xAF, 0xFF, 0xD9, 0x73, 0x9A, 0xFE, 0xAA, 0x97, 0x77, 0x70, 0x4A, 0xCA, 0x2D,
+    0x97, 0x0F, 0xC1, 0xDA, 0x79, 0xFD, 0x0D, 0xA7, 0xAD, 0x0A, 0xFC, 0xA7, 0xAD, 0x1F, 0xC7, 0x09,
+    0xD9, 0x1A, 0xD9, 0x77, 0x77, 0x77, 0x72, 0xCA, 0xA9, 0x76, 0xAD, 0xA4, 0x9A, 0xF9, 0x29, 0xE2,
+    0x9F, 0xFC, 0x90, 0xAD, 0xA1, 0x9F, 0xFE, 0xAE, 0x91, 0xFD, 0xAA, 0xFF, 0x1A, 0xF9, 0x29, 0xFD,
+    0x91, 0xFA, 0x49, 0xFA, 0x2F, 0x6F, 0x91, 0x9F, 0x6F, 0x91, 0x9F, 0x6A, 0xEA, 0x1A, 0xF6, 0xAE,
+    0xA1, 0x9F, 0x6F, 0xA1, 0x9F, 0x95, 0xFA, 0x2F, 0xC4, 0xFC, 0x92, 0xFF, 0xFE, 0x3A, 0xFF, 0xFC,
+    0xA4, 0xFF, 0xFC, 0x59, 0xFF, 0xE9, 0x69, 0xFF, 0xC9, 0x71, 0x9F, 0xC9, 0x60, 0x77, 0x59, 0x97,
+    0x77, 0xAD, 0xA7, 0x75, 0x9E, 0x79, 0xAF, 0xCA, 0x94, 0x9E, 0x59, 0xFF, 0xEA, 0x2A, 0xDA, 0x4A,
+    0xFF, 0xFD, 0x9F, 0x93, 0xAF, 0xFF, 0xFF, 0x3A, 0xFD, 0x92, 0x9F, 0xFC, 0x39, 0xFC, 0xA6, 0xAF,
+    0xD4, 0xAF, 0xC7, 0x0A, 0xFC, 0x4F, 0xC7, 0x2F, 0xC9, 0x2A, 0xFC, 0x72, 0xAF, 0xA2, 0xFC, 0x97,
+    0x29, 0xFC, 0x2F, 0xC7, 0x4F, 0xC2, 0xFC, 0x74, 0xFC, 0x91, 0xFC, 0x74, 0xFC, 0x90, 0x9F, 0xC7,
+    0x4F, 0xC9, 0x09, 0xFC, 0x74, 0xFC, 0x91, 0xFC, 0x74, 0xFC, 0x91, 0xFC, 0x74, 0xFC, 0x2F, 0xD7,
+    0x2A, 0xFC, 0x2F, 0xDA, 0x70, 0x9F, 0xD2, 0xFF, 0xA9, 0x90, 0x99, 0xAF, 0xF2, 0xAF, 0xFF, 0xFF,
+    0xCA, 0x3F, 0xFF, 0xFF, 0xC9, 0x3A, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xE9, 0x6F, 0xFF, 0xFC, 0xA7,
+    0x0A, 0xFF, 0xFD, 0x97, 0x39, 0xAF, 0xEA, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x75, 0x99, 0x99, 0x77, 0x4F, 0xC7, 0x74, 0xFC, 0x77, 0x4F, 0xC7, 0x73, 0x9F, 0xC7,
+    0x73, 0xAF, 0xC9, 0x77, 0x2A, 0xFC, 0xA7, 0x10, 0x77, 0x77, 0x1D, 0xA9, 0x76, 0xAD, 0xA4, 0x9A,
+    0xF9, 0x29, 0xE2, 0x9F, 0xFC, 0x90, 0xAD, 0xA1, 0x9F, 0xFE, 0xAE, 0x91, 0xFD, 0xAA, 0xFF, 0x1A,
+    0xF9, 0x29, 0xFD, 0x91, 0xFA, 0x49, 0xFA, 0x2F, 0x6F, 0x91, 0x9F, 0x6F, 0x91, 0x9F, 0x6A, 0xEA,
+    0x1A, 0xF6, 0xAE, 0xA1, 0x9F, 0x6F, 0xA1, 0x9F, 0x95, 0xFA, 0x2F, 0xC4, 0xFC, 0x92, 0xFF, 0xFE,
+    0x3A, 0xFF, 0xFC, 0xA4, 0xFF, 0xFC, 0x59, 0xFF, 0xE9, 0x69, 0xFF, 0xC9, 0x71, 0x9F, 0xC9, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x71, 0x99, 0x99, 0x75, 0x9F, 0x97, 0x4A, 0xF9, 0x74, 0xAF, 0xA7, 0x4F,
+    0xCA, 0x74, 0xFD, 0x73, 0x9F, 0xD6, 0x9F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD,
+    0x90, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD, 0x1F, 0xD7, 0xFD,
+    0x1F, 0xD7, 0xFD, 0x1F, 0xCA, 0x7F, 0xD1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC,
+    0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xC1, 0xFC, 0xA7, 0xAF, 0xA1, 0xAF,
+    0xC7, 0xFC, 0xA1, 0xAF, 0xC9, 0x59, 0xFC, 0xA1, 0xAF, 0xEA, 0xAA, 0xAF, 0xE9, 0x19, 0xFF, 0xFF,
+    0xD9, 0x2F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x39, 0xFF, 0xFF, 0x94, 0xAF, 0xFF, 0xDA, 0x69, 0xFF,
+    0xEA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x99, 0x99, 0x77, 0x09, 0xF9,
+    0x77, 0xAF, 0x97, 0x7A, 0xFA, 0x77, 0xFC, 0xA7, 0x7F, 0xD7, 0x69, 0xFD, 0x70, 0xAE, 0x96, 0xF0,
+    0x9E, 0x95, 0x9F, 0x09, 0xE9, 0x59, 0xF0, 0x9E, 0xA5, 0x9F, 0x09, 0xEA, 0x59, 0xF1, 0xEA, 0x59,
+    0xF1, 0xEA, 0x59, 0xF1, 0xF5, 0xAF, 0x1F, 0x5A, 0xF1, 0xF5, 0xFC, 0x1F, 0x94, 0xFC, 0x90, 0xFC,
+    0x92, 0xAF, 0xC9, 0x0A, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD9, 0x1F, 0xFF, 0xD9, 0x1A, 0xFF, 0xFC,
+    0x92, 0xFF, 0xFC, 0xA3, 0x9A, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0x99, 0x99,
+    0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xC7, 0x2A, 0xFC, 0x97, 0x1F, 0xD9, 0x40, 0x77,
+    0x77, 0xDA, 0x77, 0x19, 0xF7, 0x73, 0xAC, 0x77, 0x29, 0xD7, 0x71, 0xAD, 0x77, 0x2A, 0xC7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xFD, 0x7F, 0xD9, 0x0F, 0xD7, 0xFD, 0x90, 0xFD,
+    0x7F, 0xD9, 0x0F, 0xD7, 0xFD, 0x90, 0xFD, 0x7F, 0xD1, 0xFD, 0x7F, 0xD1, 0xFD, 0x7F, 0xD1, 0xFD,
+    0x7F, 0xD1, 0xFD, 0x7F, 0xD1, 0xFC, 0xA7, 0xFD, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC,
+    0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFC, 0x1F, 0xCA, 0x7A, 0xFA,
+    0x1A, 0xFC, 0x7F, 0xCA, 0x1A, 0xFC, 0x95, 0x9F, 0xCA, 0x1A, 0xFE, 0xAA, 0xAA, 0xFE, 0x91, 0x9F,
+    0xFF, 0xFD, 0x92, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xD3, 0x9F, 0xFF, 0xF9, 0x4A, 0xFF, 0xFD, 0xA6,
+    0x9F, 0xFF, 0x97, 0x77, 0x10, 0x6A, 0xD9, 0x74, 0xF9, 0x75, 0x9C, 0xA7, 0x5A, 0xC9, 0x74, 0xE7,
+    0x49, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAE, 0x96, 0xF0, 0x9E, 0x95, 0x9F, 0x09, 0xE9,
+    0x59, 0xF0, 0x9E, 0xA5, 0x9F, 0x09, 0xEA, 0x59, 0xF1, 0xEA, 0x59, 0xF1, 0xEA, 0x59, 0xF1, 0xF5,
+    0xAF, 0x1F, 0x5A, 0xF1, 0xF5, 0xFC, 0x1F, 0x94, 0xFC, 0x90, 0xFC, 0x92, 0xAF, 0xC9, 0x0A, 0xFF,
+    0xFD, 0x90, 0x9F, 0xFF, 0xD9, 0x1F, 0xFF, 0xD9, 0x1A, 0xFF, 0xFC, 0x92, 0xFF, 0xFC, 0xA3, 0x9A,
+    0xF9, 0x50, 0x77, 0x77, 0x3E, 0x77, 0x4A, 0xDA, 0x77, 0x4E, 0x97, 0x73, 0xAE, 0x77, 0x4E, 0xA7,
+    0x73, 0xAE, 0x97, 0x77, 0x7A, 0xA9, 0x97, 0x74, 0x9E, 0x77, 0x5E, 0x77, 0x49, 0xE7, 0x73, 0x9F,
+    0x09, 0xFD, 0x7F, 0xF9, 0x1F, 0xD7, 0xFE, 0xA2, 0xFD, 0x7F, 0xDA, 0x3F, 0xD7, 0xFD, 0x93, 0xFD,
+    0x7F, 0xD4, 0xFD, 0x7F, 0xD4, 0xFD, 0x7F, 0xD4, 0xFD, 0x7F, 0xD4, 0xFD, 0x7F, 0xD4, 0xFC, 0xA7,
+    0xFD, 0x4F, 0xCA, 0x7A, 0xFC, 0x4F, 0xCA, 0x7A, 0xFC, 0x4F, 0xCA, 0x7A, 0xFC, 0x4F, 0xCA, 0x7A,
+    0xFC, 0x4F, 0xCA, 0x7A, 0xFC, 0x4F, 0xCA, 0x7A, 0xFA, 0x4A, 0xFC, 0x7F, 0xCA, 0x4A, 0xFC, 0x95,
+    0x9F, 0xCA, 0x4A, 0xFE, 0xAA, 0xAA, 0xFE, 0x94, 0x9F, 0xFF, 0xFD, 0x95, 0xFF, 0xFF, 0xD6, 0xFF,
+    0xFF, 0xD6, 0x9F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFD, 0xA7, 0x19, 0xFF, 0xF9, 0x77, 0x77, 0x7A, 0xDA,
+    0x77, 0xE7, 0x7A, 0xE7, 0x7E, 0xA7, 0x6A, 0xE7, 0x7F, 0x49, 0xAA, 0x97, 0x70, 0xE9, 0x77, 0xEA,
+    0x77, 0xE9, 0x77, 0xE0, 0xAE, 0x96, 0xFE, 0x09, 0xE9, 0x59, 0xFD, 0x90, 0x9E, 0x95, 0x9F, 0xCA,
+    0x19, 0xEA, 0x59, 0xF9, 0x29, 0xEA, 0x59, 0xF4, 0xEA, 0x59, 0xF4, 0xEA, 0x59, 0xF4, 0xF5, 0xAF,
+    0x4F, 0x5A, 0xF4, 0xF5, 0xFC, 0x93, 0xF9, 0x4F, 0xC9, 0x3F, 0xC9, 0x2A, 0xFC, 0x93, 0xAF, 0xFF,
+    0xD9, 0x39, 0xFF, 0xFD, 0x94, 0xFF, 0xFD, 0x94, 0xAF, 0xFF, 0xC9, 0x5F, 0xFF, 0xCA, 0x69, 0xAF,
+    0x97, 0x00, 0x49, 0xF9, 0x77, 0x39, 0xF9, 0x77, 0x39, 0xFA, 0x77, 0x39, 0xFC, 0x77, 0x39, 0xFC,
+    0x97, 0x77, 0x97, 0x77, 0x77, 0x75, 0xAE, 0x77, 0x5E, 0x77, 0x5E, 0x77, 0x49, 0xE7, 0x73, 0x9F,
+    0x09, 0xFD, 0x7F, 0xF9, 0x1F, 0xD7, 0xFE, 0xA2, 0xFD, 0x7F, 0xDA, 0x3F, 0xD7, 0xFD, 0x93, 0xFD,
+    0x7F, 0xD4, 0xFD, 0x7F, 0xD4, 0xFD, 0x7F, 0xD4, 0xFD, 0x7F, 0xD4, 0xFD, 0x7F, 0xD4, 0xFC, 0xA7,
+    0xFD, 0x4F, 0xCA, 0x7A, 0xFC, 0x4F, 0xCA, 0x7A, 0xFC, 0x4F, 0xCA, 0x7A, 0xFC, 0x4F, 0xCA, 0x7A,
+    0xFC, 0x4F, 0xCA, 0x7A, 0xFC, 0x4F, 0xCA, 0x7A, 0xFA, 0x4A, 0xFC, 0x7F, 0xCA, 0x4A, 0xFC, 0x95,
+    0x9F, 0xCA, 0x4A, 0xFE, 0xAA, 0xAA, 0xFE, 0x94, 0x9F, 0xFF, 0xFD, 0x95, 0xFF, 0xFF, 0xD6, 0xFF,
+    0xFF, 0xD6, 0x9F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFD, 0xA7, 0x19, 0xFF, 0xF9, 0x77, 0x77, 0x2F, 0xA7,
+    0x7F, 0xC7, 0x7F, 0xC9, 0x76, 0xFC, 0xA7, 0x6A, 0xFC, 0x77, 0x69, 0x97, 0x71, 0xE9, 0x77, 0xE9,
+    0x77, 0xE9, 0x77, 0xE0, 0xAE, 0x96, 0xFE, 0x09, 0xE9, 0x59, 0xFD, 0x90, 0x9E, 0x95, 0x9F, 0xCA,
+    0x19, 0xEA, 0x59, 0xF9, 0x29, 0xEA, 0x59, 0xF4, 0xEA, 0x59, 0xF4, 0xEA, 0x59, 0xF4, 0xF5, 0xAF,
+    0x4F, 0x5A, 0xF4, 0xF5, 0xFC, 0x93, 0xF9, 0x4F, 0xC9, 0x3F, 0xC9, 0x2A, 0xFC, 0x93, 0xAF, 0xFF,
+    0xD9, 0x39, 0xFF, 0xFD, 0x94, 0xFF, 0xFD, 0x94, 0xAF, 0xFF, 0xC9, 0x5F, 0xFF, 0xCA, 0x69, 0xAF,
+    0x97, 0x00, 0x77, 0x77, 0x2D, 0xA7, 0x74, 0x9F, 0x77, 0x6A, 0xC7, 0x75, 0x9D, 0x77, 0x4A, 0xD7,
+    0x75, 0xAC, 0x77, 0x77, 0x77, 0x71, 0xAC, 0xA9, 0x77, 0x49, 0xE7, 0x75, 0xE7, 0x74, 0x9E, 0x77,
+    0x39, 0xF0, 0x9F, 0xD7, 0xFF, 0x91, 0xFD, 0x7F, 0xEA, 0x2F, 0xD7, 0xFD, 0xA3, 0xFD, 0x7F, 0xD9,
+    0x3F, 0xD7, 0xFD, 0x4F, 0xD7, 0xFD, 0x4F, 0xD7, 0xFD, 0x4F, 0xD7, 0xFD, 0x4F, 0xD7, 0xFD, 0x4F,
+    0xCA, 0x7F, 0xD4, 0xFC, 0xA7, 0xAF, 0xC4, 0xFC, 0xA7, 0xAF, 0xC4, 0xFC, 0xA7, 0xAF, 0xC4, 0xFC,
+    0xA7, 0xAF, 0xC4, 0xFC, 0xA7, 0xAF, 0xC4, 0xFC, 0xA7, 0xAF, 0xA4, 0xAF, 0xC7, 0xFC, 0xA4, 0xAF,
+    0xC9, 0x59, 0xFC, 0xA4, 0xAF, 0xEA, 0xAA, 0xAF, 0xE9, 0x49, 0xFF, 0xFF, 0xD9, 0x5F, 0xFF, 0xFD,
+    0x6F, 0xFF, 0xFD, 0x69, 0xFF, 0xFF, 0x97, 0xAF, 0xFF, 0xDA, 0x71, 0x9F, 0xFF, 0x97, 0x77, 0x70,
+    0x6A, 0xD9, 0x77, 0xF9, 0x77, 0x09, 0xCA, 0x77, 0x0A, 0xC9, 0x77, 0xE7, 0x79, 0xCA, 0x77, 0x70,
+    0x9A, 0xA9, 0x77, 0x0E, 0x97, 0x7E, 0xA7, 0x7E, 0x97, 0x7E, 0x0A, 0xE9, 0x6F, 0xE0, 0x9E, 0x95,
+    0x9F, 0xD9, 0x09, 0xE9, 0x59, 0xFC, 0xA1, 0x9E, 0xA5, 0x9F, 0x92, 0x9E, 0xA5, 0x9F, 0x4E, 0xA5,
+    0x9F, 0x4E, 0xA5, 0x9F, 0x4F, 0x5A, 0xF4, 0xF5, 0xAF, 0x4F, 0x5F, 0xC9, 0x3F, 0x94, 0xFC, 0x93,
+    0xFC, 0x92, 0xAF, 0xC9, 0x3A, 0xFF, 0xFD, 0x93, 0x9F, 0xFF, 0xD9, 0x4F, 0xFF, 0xD9, 0x4A, 0xFF,
+    0xFC, 0x95, 0xFF, 0xFC, 0xA6, 0x9A, 0xF9, 0x70, 0x6A, 0xDA, 0x19, 0xD7, 0x69, 0xFA, 0x09, 0xD9,
+    0x75, 0xFD, 0x99, 0xD7, 0x6D, 0xA0, 0xFD, 0x76, 0xDA, 0x09, 0xFA, 0x76, 0xE1, 0x9D, 0xA7, 0x77,
+    0x77, 0x76, 0xAC, 0xA9, 0x77, 0x49, 0xE7, 0x75, 0xE7, 0x74, 0x9E, 0x77, 0x39, 0xF0, 0x9F, 0xD7,
+    0xFF, 0x91, 0xFD, 0x7F, 0xEA, 0x2F, 0xD7, 0xFD, 0xA3, 0xFD, 0x7F, 0xD9, 0x3F, 0xD7, 0xFD, 0x4F,
+    0xD7, 0xFD, 0x4F, 0xD7, 0xFD, 0x4F, 0xD7, 0xFD, 0x4F, 0xD7, 0xFD, 0x4F, 0xCA, 0x7F, 0xD4, 0xFC,
+    0xA7, 0xAF, 0xC4, 0xFC, 0xA7, 0xAF, 0xC4, 0xFC, 0xA7, 0xAF, 0xC4, 0xFC, 0xA7, 0xAF, 0xC4, 0xFC,
+    0xA7, 0xAF, 0xC4, 0xFC, 0xA7, 0xAF, 0xA4, 0xAF, 0xC7, 0xFC, 0xA4, 0xAF, 0xC9, 0x59, 0xFC, 0xA4,
+    0xAF, 0xEA, 0xAA, 0xAF, 0xE9, 0x49, 0xFF, 0xFF, 0xD9, 0x5F, 0xFF, 0xFD, 0x6F, 0xFF, 0xFD, 0x69,
+    0xFF, 0xFF, 0x97, 0xAF, 0xFF, 0xDA, 0x71, 0x9F, 0xFF, 0x97, 0x77, 0x70, 0x4A, 0xCA, 0x2D, 0x97,
+    0x1F, 0xC1, 0xE7, 0x09, 0xFD, 0x0D, 0xA7, 0x0A, 0xD0, 0xAF, 0xCA, 0x70, 0xAD, 0x1F, 0xC9, 0x70,
+    0x9D, 0x91, 0xAD, 0x97, 0x75, 0x9C, 0xAA, 0x77, 0x0E, 0x97, 0x7E, 0xA7, 0x7E, 0x97, 0x7E, 0x0A,
+    0xE9, 0x6F, 0xE0, 0x9E, 0x95, 0x9F, 0xD9, 0x09, 0xE9, 0x59, 0xFC, 0xA1, 0x9E, 0xA5, 0x9F, 0x92,
+    0x9E, 0xA5, 0x9F, 0x4E, 0xA5, 0x9F, 0x4E, 0xA5, 0x9F, 0x4F, 0x5A, 0xF4, 0xF5, 0xAF, 0x4F, 0x5F,
+    0xC9, 0x3F, 0x94, 0xFC, 0x93, 0xFC, 0x92, 0xAF, 0xC9, 0x3A, 0xFF, 0xFD, 0x93, 0x9F, 0xFF, 0xD9,
+    0x4F, 0xFF, 0xD9, 0x4A, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0xA6, 0x9A, 0xF9, 0x70, 0x77, 0x77, 0x74,
+    0xAC, 0xAA, 0x77, 0x49, 0xE7, 0x75, 0xE7, 0x74, 0x9E, 0x77, 0x39, 0xF0, 0x9F, 0xD7, 0xFF, 0x91,
+    0xFD, 0x7F, 0xEA, 0x2F, 0xD7, 0xFD, 0xA3, 0xFD, 0x7F, 0xD9, 0x3F, 0xD7, 0xFD, 0x4F, 0xD7, 0xFD,
+    0x4F, 0xD7, 0xFD, 0x4F, 0xD7, 0xFD, 0x4F, 0xD7, 0xFD, 0x4F, 0xCA, 0x7F, 0xD4, 0xFC, 0xA7, 0xAF,
+    0xC4, 0xFC, 0xA7, 0xAF, 0xC4, 0xFC, 0xA7, 0xAF, 0xC4, 0xFC, 0xA7, 0xAF, 0xC4, 0xFC, 0xA7, 0xAF,
+    0xC4, 0xFC, 0xA7, 0xAF, 0xA4, 0xAF, 0xC7, 0xFC, 0xA4, 0xAF, 0xC9, 0x59, 0xFC, 0xA4, 0xAF, 0xEA,
+    0xAA, 0xAF, 0xE9, 0x49, 0xFF, 0xFF, 0xD9, 0x5F, 0xFF, 0xFD, 0x6F, 0xFF, 0xFD, 0x69, 0xFF, 0xFF,
+    0x97, 0xAF, 0xFF, 0xDA, 0x71, 0x9F, 0xFE, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x59, 0x99, 0x97, 0x73, 0x9F, 0x97, 0x72, 0xAF, 0x97, 0x72, 0xAF, 0xA7, 0x72, 0xFC,
+    0xA7, 0x72, 0xFD, 0x77, 0x19, 0xFD, 0x72, 0x77, 0x99, 0x77, 0x1E, 0x97, 0x7E, 0x97, 0x7E, 0x97,
+    0x7E, 0x0A, 0xE9, 0x6F, 0xE0, 0x9E, 0x95, 0x9F, 0xD9, 0x09, 0xE9, 0x59, 0xFC, 0xA1, 0x9E, 0xA5,
+    0x9F, 0x92, 0x9E, 0xA5, 0x9F, 0x4E, 0xA5, 0x9F, 0x4E, 0xA5, 0x9F, 0x4F, 0x5A, 0xF4, 0xF5, 0xAF,
+    0x4F, 0x5F, 0xC9, 0x3F, 0x94, 0xFC, 0x93, 0xFC, 0x92, 0xAF, 0xC9, 0x3A, 0xFF, 0xFD, 0x93, 0x9F,
+    0xFF, 0xD9, 0x4F, 0xFF, 0xD9, 0x4A, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0xA6, 0x9A, 0xF9, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0x99, 0x99, 0x76, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x75,
+    0x9F, 0xC7, 0x5A, 0xFC, 0x97, 0x4F, 0xD9, 0x70, 0x77, 0x73, 0xFA, 0x77, 0x2F, 0xC7, 0x72, 0xFC,
+    0x97, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x1F, 0xC7, 0x2F, 0xC9, 0x0A, 0xFA, 0x70, 0x9F, 0xC2, 0xFC, 0x97, 0xFC, 0x92, 0xAF, 0xC6,
+    0x9F, 0xC4, 0xFC, 0x95, 0xFC, 0xA4, 0xAF, 0xC4, 0x9F, 0xC5, 0x9F, 0xC9, 0x3F, 0xCA, 0x6F, 0xD2,
+    0x9F, 0xC7, 0x9F, 0xC9, 0x1F, 0xCA, 0x70, 0xFD, 0x09, 0xFC, 0x71, 0x9F, 0xC9, 0xFC, 0xA7, 0x2F,
+    0xFE, 0x97, 0x2A, 0xFF, 0xD7, 0x4F, 0xFC, 0x97, 0x4A, 0xFF, 0x76, 0xFE, 0x97, 0x6A, 0xFD, 0x77,
+    0x9F, 0xCA, 0x77, 0x9F, 0xCA, 0x77, 0xAF, 0xCA, 0x77, 0xAF, 0xCA, 0x77, 0xAF, 0xD7, 0x7F, 0xE7,
+    0x7F, 0xE7, 0x7F, 0xE7, 0x77, 0x6F, 0x97, 0x6F, 0xA7, 0x6F, 0xC7, 0x6F, 0xC9, 0x75, 0xFC, 0xA7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xF9, 0x7F, 0x90, 0xFC, 0x69, 0xF1, 0x9F,
+    0xA5, 0xAE, 0xA2, 0xFC, 0x5F, 0x93, 0xFC, 0x39, 0xF4, 0xAF, 0x92, 0xAE, 0xA5, 0xFC, 0x2F, 0x95,
+    0xAF, 0xA0, 0x9F, 0x7F, 0xC0, 0xAE, 0xA7, 0xAF, 0xFC, 0x97, 0x0F, 0xFC, 0x71, 0xAF, 0xEA, 0x72,
+    0xFE, 0x97, 0x2A, 0xFD, 0x74, 0xFC, 0xA7, 0x4A, 0xF9, 0x74, 0xAF, 0x74, 0x9F, 0xA7, 0x3A, 0xFC,
+    0x97, 0xFF, 0xD7, 0x0F, 0xFC, 0x97, 0x0F, 0xFA, 0x71, 0xFE, 0xA7, 0x2F, 0xCA, 0x77, 0x75, 0x0F,
+    0xC7, 0x2F, 0xC9, 0x0A, 0xFA, 0x70, 0x9F, 0xC2, 0xFC, 0x97, 0xFC, 0x92, 0xAF, 0xC6, 0x9F, 0xC4,
+    0xFC, 0x95, 0xFC, 0xA4, 0xAF, 0xC4, 0x9F, 0xC5, 0x9F, 0xC9, 0x3F, 0xCA, 0x6F, 0xD2, 0x9F, 0xC7,
+    0x9F, 0xC9, 0x1F, 0xCA, 0x70, 0xFD, 0x09, 0xFC, 0x71, 0x9F, 0xC9, 0xFC, 0xA7, 0x2F, 0xFE, 0x97,
+    0x2A, 0xFF, 0xD7, 0x4F, 0xFC, 0x97, 0x4A, 0xFF, 0x76, 0xFE, 0x97, 0x6A, 0xFD, 0x77, 0x9F, 0xCA,
+    0x77, 0x9F, 0xCA, 0x77, 0xAF, 0xCA, 0x77, 0xAF, 0xCA, 0x77, 0xAF, 0xD7, 0x7F, 0xE7, 0x7F, 0xE7,
+    0x7F, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0x99,
+    0x97, 0x71, 0xAF, 0x77, 0x1A, 0xF7, 0x71, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x79, 0xFC, 0xA7, 0x79,
+    0xFD, 0x70, 0x9F, 0x97, 0xF9, 0x2F, 0xC6, 0x9F, 0x39, 0xFA, 0x5A, 0xEA, 0x4F, 0xC5, 0xF9, 0x5F,
+    0xC3, 0x9F, 0x6A, 0xF9, 0x2A, 0xEA, 0x7F, 0xC2, 0xF9, 0x7A, 0xFA, 0x09, 0xF7, 0x1F, 0xC0, 0xAE,
+    0xA7, 0x1A, 0xFF, 0xC9, 0x72, 0xFF, 0xC7, 0x3A, 0xFE, 0xA7, 0x4F, 0xE9, 0x74, 0xAF, 0xD7, 0x6F,
+    0xCA, 0x76, 0xAF, 0x97, 0x6A, 0xF7, 0x69, 0xFA, 0x75, 0xAF, 0xC9, 0x71, 0xFF, 0xD7, 0x2F, 0xFC,
+    0x93, 0x99, 0x99, 0x2F, 0xFA, 0x3A, 0xF2, 0xFE, 0xA4, 0xFC, 0x2F, 0xCA, 0x6F, 0xC7, 0x69, 0xFC,
+    0x97, 0x59, 0xFC, 0x97, 0x5A, 0xFC, 0xA0, 0x77, 0x77, 0x0E, 0x97, 0x72, 0xF9, 0x77, 0x39, 0xCA,
+    0x77, 0x3D, 0x77, 0x29, 0xD9, 0x77, 0x29, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x2F, 0xC7, 0x2F, 0xC9, 0x0A, 0xFA, 0x70, 0x9F, 0xC2, 0xFC, 0x97, 0xFC,
+    0x92, 0xAF, 0xC6, 0x9F, 0xC4, 0xFC, 0x95, 0xFC, 0xA4, 0xAF, 0xC4, 0x9F, 0xC5, 0x9F, 0xC9, 0x3F,
+    0xCA, 0x6F, 0xD2, 0x9F, 0xC7, 0x9F, 0xC9, 0x1F, 0xCA, 0x70, 0xFD, 0x09, 0xFC, 0x71, 0x9F, 0xC9,
+    0xFC, 0xA7, 0x2F, 0xFE, 0x97, 0x2A, 0xFF, 0xD7, 0x4F, 0xFC, 0x97, 0x4A, 0xFF, 0x76, 0xFE, 0x97,
+    0x6A, 0xFD, 0x77, 0x9F, 0xCA, 0x77, 0x9F, 0xCA, 0x77, 0xAF, 0xCA, 0x77, 0xAF, 0xCA, 0x77, 0xAF,
+    0xD7, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F, 0xE7, 0x77, 0x73, 0xDA, 0x76, 0x9F, 0x77, 0x0A, 0xC7, 0x79,
+    0xD7, 0x6A, 0xD7, 0x7A, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xF9,
+    0x7F, 0x90, 0xFC, 0x69, 0xF1, 0x9F, 0xA5, 0xAE, 0xA2, 0xFC, 0x5F, 0x93, 0xFC, 0x39, 0xF4, 0xAF,
+    0x92, 0xAE, 0xA5, 0xFC, 0x2F, 0x95, 0xAF, 0xA0, 0x9F, 0x7F, 0xC0, 0xAE, 0xA7, 0xAF, 0xFC, 0x97,
+    0x0F, 0xFC, 0x71, 0xAF, 0xEA, 0x72, 0xFE, 0x97, 0x2A, 0xFD, 0x74, 0xFC, 0xA7, 0x4A, 0xF9, 0x74,
+    0xAF, 0x74, 0x9F, 0xA7, 0x3A, 0xFC, 0x97, 0xFF, 0xD7, 0x0F, 0xFC, 0x97, 0x0F, 0xFA, 0x71, 0xFE,
+    0xA7, 0x2F, 0xCA, 0x77, 0x75, 0x7A, 0xCA, 0x2D, 0x75, 0xFC, 0x1D, 0xA7, 0x39, 0xFC, 0xA0, 0xDA,
+    0x73, 0xAD, 0x0F, 0xD9, 0x73, 0xE1, 0xFC, 0x74, 0xAD, 0x2E, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xFC, 0x72, 0xFC, 0x90, 0xAF, 0xA7, 0x09, 0xFC,
+    0x2F, 0xC9, 0x7F, 0xC9, 0x2A, 0xFC, 0x69, 0xFC, 0x4F, 0xC9, 0x5F, 0xCA, 0x4A, 0xFC, 0x49, 0xFC,
+    0x59, 0xFC, 0x93, 0xFC, 0xA6, 0xFD, 0x29, 0xFC, 0x79, 0xFC, 0x91, 0xFC, 0xA7, 0x0F, 0xD0, 0x9F,
+    0xC7, 0x19, 0xFC, 0x9F, 0xCA, 0x72, 0xFF, 0xE9, 0x72, 0xAF, 0xFD, 0x74, 0xFF, 0xC9, 0x74, 0xAF,
+    0xF7, 0x6F, 0xE9, 0x76, 0xAF, 0xD7, 0x79, 0xFC, 0xA7, 0x79, 0xFC, 0xA7, 0x7A, 0xFC, 0xA7, 0x7A,
+    0xFC, 0xA7, 0x7A, 0xFD, 0x77, 0xFE, 0x77, 0xFE, 0x77, 0xFE, 0x70, 0x59, 0xAC, 0x91, 0x9D, 0x70,
+    0x9F, 0xA0, 0x9D, 0x97, 0xFD, 0x99, 0xD7, 0x0D, 0xA0, 0xFD, 0x70, 0xDA, 0x09, 0xFC, 0x70, 0xE1,
+    0x9E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9F, 0x97, 0xF9, 0x0F,
+    0xC6, 0x9F, 0x19, 0xFA, 0x5A, 0xEA, 0x2F, 0xC5, 0xF9, 0x3F, 0xC3, 0x9F, 0x4A, 0xF9, 0x2A, 0xEA,
+    0x5F, 0xC2, 0xF9, 0x5A, 0xFA, 0x09, 0xF7, 0xFC, 0x0A, 0xEA, 0x7A, 0xFF, 0xC9, 0x70, 0xFF, 0xC7,
+    0x1A, 0xFE, 0xA7, 0x2F, 0xE9, 0x72, 0xAF, 0xD7, 0x4F, 0xCA, 0x74, 0xAF, 0x97, 0x4A, 0xF7, 0x49,
+    0xFA, 0x73, 0xAF, 0xC9, 0x7F, 0xFD, 0x70, 0xFF, 0xC9, 0x70, 0xFF, 0xA7, 0x1F, 0xEA, 0x72, 0xFC,
+    0xA7, 0x77, 0x50, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xD9, 0x9F, 0xFF,
+    0xD9, 0x9F, 0xFF, 0xD9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xD9, 0x9F,
+    0xFF, 0xD9, 0x9F, 0xFF, 0xD9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x91, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFD, 0x00, 0x77, 0x5F, 0xFF, 0xFE,
+    0xA9, 0xFF, 0xFF, 0xEA, 0x9F, 0xFF, 0xFE, 0x99, 0xFF, 0xFF, 0xE9, 0x77, 0x40, 0x77, 0x77, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xFF, 0xFC, 0x09, 0xFF, 0xFF, 0xFF, 0xFC, 0x09, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x77, 0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xFF, 0xFC, 0x09,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x09, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x19, 0x99, 0x49, 0x99, 0x1A,
+    0xE3, 0x9E, 0x90, 0xAE, 0x39, 0xE9, 0x0F, 0x39, 0xE9, 0x0F, 0x39, 0xE1, 0xF3, 0x9E, 0x1E, 0xA3,
+    0x9E, 0x1E, 0xA3, 0x9E, 0x1E, 0xA3, 0xAE, 0x1E, 0xA3, 0xAE, 0x1E, 0xA3, 0xAE, 0x1E, 0xA3, 0xAE,
+    0x1E, 0xA3, 0xAE, 0x1E, 0xA3, 0xAE, 0x1E, 0x93, 0xAE, 0x1E, 0x93, 0xAE, 0x1E, 0x93, 0xF1, 0xE9,
+    0x3F, 0x1E, 0x93, 0xF0, 0x9E, 0x93, 0xF0, 0x9E, 0x93, 0xEA, 0x09, 0xE9, 0x3E, 0xA0, 0x9E, 0x4E,
+    0xA0, 0x9E, 0x4E, 0xA0, 0x9E, 0x4E, 0xA0, 0x9E, 0x4E, 0xA0, 0x9E, 0x4E, 0xA0, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAF, 0xFF, 0xFF, 0xDA, 0xAF, 0xFF, 0xFF,
+    0xDA, 0xAF, 0xFF, 0xFF, 0xDA, 0x77, 0x77, 0x77, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0xAF, 0xFF, 0xFF, 0xDA, 0xAF, 0xFF, 0xFF, 0xDA, 0xAF, 0xFF, 0xFF, 0xDA,
+    0x0F, 0xE2, 0xFE, 0x2A, 0xFD, 0x29, 0xFD, 0x3F, 0xD3, 0xAF, 0xC3, 0x9F, 0xCA, 0x3F, 0xD3, 0xFD,
+    0x92, 0xAF, 0xCA, 0x19, 0xFD, 0xA1, 0x9F, 0xD9, 0x2F, 0xD3, 0xFD, 0x29, 0xFC, 0xA2, 0xAF, 0xC3,
+    0xFD, 0x29, 0xFC, 0xA2, 0xAF, 0xC9, 0x2F, 0xD2, 0x1F, 0xE2, 0xFD, 0xA2, 0xFD, 0x92, 0xFD, 0x3F,
+    0xD2, 0x9F, 0xCA, 0x2A, 0xFC, 0x92, 0xFD, 0x29, 0xFC, 0xA2, 0xFD, 0x92, 0x0F, 0xE2, 0xFE, 0x2A,
+    0xFD, 0x29, 0xFD, 0x3F, 0xD3, 0xAF, 0xC3, 0x9F, 0xCA, 0x3F, 0xD3, 0xFD, 0x92, 0xAF, 0xCA, 0x0F,
+    0xE1, 0xAF, 0xD9, 0x2F, 0xE1, 0x9F, 0xD9, 0x2A, 0xFD, 0x2F, 0xD9, 0x29, 0xFD, 0x2A, 0xFC, 0x93,
+    0xFD, 0x29, 0xFC, 0x93, 0xAF, 0xC3, 0xFC, 0xA3, 0x9F, 0xCA, 0x2F, 0xD4, 0xFD, 0x2A, 0xFC, 0x93,
+    0xFD, 0x91, 0x9F, 0xD3, 0xAF, 0xCA, 0x2F, 0xD0, 0x19, 0xFD, 0xA1, 0xAF, 0xD2, 0x9F, 0xD9, 0x1A,
+    0xFD, 0x3F, 0xD2, 0xAF, 0xCA, 0x3F, 0xD2, 0xAF, 0xC9, 0x29, 0xFC, 0xA2, 0xAF, 0xC3, 0xAF, 0xC3,
+    0xFD, 0x3F, 0xD2, 0x9F, 0xCA, 0x29, 0xFC, 0xA2, 0xFD, 0x3A, 0xFC, 0x92, 0xFD, 0x3F, 0xD2, 0xAF,
+    0xCA, 0x20, 0x1F, 0xE2, 0xFD, 0xA2, 0xFD, 0x92, 0xFD, 0x3F, 0xD2, 0x9F, 0xCA, 0x2A, 0xFC, 0x92,
+    0xFD, 0x29, 0xFC, 0xA2, 0xFD, 0x92, 0x0F, 0xE1, 0xAF, 0xD9, 0x2F, 0xE1, 0x9F, 0xD9, 0x2A, 0xFD,
+    0x2F, 0xD9, 0x29, 0xFD, 0x2A, 0xFC, 0x93, 0xFD, 0x29, 0xFC, 0x93, 0xAF, 0xC3, 0xFC, 0xA3, 0x9F,
+    0xCA, 0x2F, 0xD4, 0xFD, 0x2A, 0xFC, 0x93, 0xFD, 0x92, 0xFD, 0x3A, 0xFC, 0xA2, 0xFD, 0x00, 0x77,
+    0x70, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75,
+    0xF7, 0x0A, 0xFF, 0xFC, 0x29, 0xFF, 0xFD, 0x2F, 0xFF, 0xEA, 0x1F, 0xFF, 0xF7, 0xF7, 0x5F, 0x74,
+    0x9F, 0x74, 0x9F, 0x74, 0x9F, 0x74, 0x9E, 0xA7, 0x49, 0xEA, 0x74, 0x9E, 0xA7, 0x49, 0xEA, 0x74,
+    0x9E, 0xA7, 0x49, 0xEA, 0x74, 0xAE, 0xA7, 0x4A, 0xEA, 0x74, 0xAE, 0xA7, 0x4A, 0xEA, 0x74, 0xAE,
+    0xA7, 0x4A, 0xEA, 0x74, 0xAE, 0xA7, 0x5E, 0x97, 0x59, 0xD9, 0x76, 0xD9, 0x76, 0x9C, 0x97, 0x7A,
+    0x97, 0x70, 0x97, 0x77, 0x00, 0x69, 0x99, 0xA7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74,
+    0xF7, 0x4F, 0x74, 0xF7, 0x39, 0xF7, 0x39, 0xF7, 0x39, 0xFF, 0xA2, 0xFF, 0xFD, 0x1A, 0xFF, 0xFD,
+    0x90, 0xFF, 0xFE, 0xA9, 0xFF, 0xCA, 0x73, 0x9E, 0xA7, 0x39, 0xEA, 0x73, 0x9E, 0xA7, 0x39, 0xEA,
+    0x73, 0xAE, 0xA7, 0x3A, 0xEA, 0x73, 0xAE, 0xA7, 0x3A, 0xFF, 0x3F, 0xFF, 0xC9, 0x1A, 0xFF, 0xFD,
+    0x1F, 0xFF, 0xE0, 0x9E, 0xAA, 0xFA, 0x73, 0xAE, 0x97, 0x3F, 0x97, 0x3F, 0x97, 0x3F, 0x97, 0x3F,
+    0x97, 0x3F, 0x97, 0x39, 0xE9, 0x74, 0xE9, 0x75, 0xD9, 0x75, 0xAC, 0x77, 0xC7, 0x79, 0x77, 0x70,
+    0x3A, 0xFF, 0xFD, 0x96, 0xFF, 0xFE, 0xA6, 0xFF, 0xFF, 0x6F, 0xFF, 0xF5, 0x9F, 0xFF, 0xF5, 0xAF,
+    0xFF, 0xF5, 0xFF, 0xFF, 0xC9, 0x4F, 0xFF, 0xFC, 0x94, 0xFF, 0xFF, 0xCA, 0x39, 0xFF, 0xFF, 0xCA,
+    0x39, 0xFF, 0xFF, 0xD3, 0xAF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x92, 0xFF, 0xFF,
+    0xE9, 0x19, 0xFF, 0xFF, 0xEA, 0x1A, 0xFF, 0xFF, 0xEA, 0x1F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFC,
+    0x1F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFF, 0xC9, 0x77, 0x60, 0x09, 0x97,
+    0xE9, 0x49, 0xFC, 0x92, 0x9F, 0xE1, 0x9F, 0xF0, 0x9F, 0xEA, 0x09, 0xFD, 0x91, 0x9F, 0x94, 0xD9,
+    0x77, 0x19, 0x99, 0x91, 0x9F, 0x1A, 0xF9, 0x0F, 0xC9, 0x0F, 0xCA, 0x0F, 0xCA, 0x9F, 0xD0, 0x19,
+    0x99, 0x91, 0x9F, 0x1A, 0xF9, 0x0F, 0xC9, 0x0F, 0xCA, 0x0F, 0xCA, 0x9F, 0xD0, 0x19, 0x99, 0x95,
+    0x99, 0x99, 0x59, 0x99, 0x91, 0x9F, 0x5F, 0xA3, 0x9F, 0x1A, 0xF9, 0x39, 0xFA, 0x3A, 0xF9, 0x0F,
+    0xCA, 0x39, 0xFC, 0x3F, 0xC9, 0x0F, 0xCA, 0x3A, 0xFC, 0x3F, 0xCA, 0x0F, 0xD3, 0xFD, 0x3F, 0xCA,
+    0x9F, 0xD3, 0xFD, 0x29, 0xFD, 0x99, 0x99, 0xAE, 0xAE, 0xAE, 0x76, 0xAE, 0x77, 0x9E, 0x94, 0xAD,
+    0x7F, 0x4A, 0xC0, 0xAC, 0x59, 0xE9, 0x4C, 0x9C, 0x9C, 0x94, 0xF5, 0xC9, 0xC9, 0xC9, 0x3A, 0xE6,
+    0xC9, 0xA9, 0xC9, 0x29, 0xEA, 0x6D, 0x0A, 0xC9, 0x2F, 0x7F, 0xC2, 0xAE, 0xA7, 0x9E, 0xA2, 0xF7,
+    0x29, 0x92, 0xAE, 0x97, 0x69, 0xF7, 0x7F, 0x97, 0x6A, 0xEA, 0x77, 0xF7, 0x7F, 0xA7, 0x69, 0xF7,
+    0x7F, 0x91, 0xAA, 0x29, 0xAA, 0x4A, 0xF1, 0xC9, 0x9C, 0x1C, 0x0A, 0x93, 0xF9, 0x1C, 0xA9, 0xC0,
+    0x9A, 0xC9, 0xC2, 0xFC, 0x19, 0xCA, 0xAC, 0x0A, 0xAC, 0xAC, 0x19, 0xF3, 0xC0, 0x9C, 0x0A, 0xC0,
+    0xAC, 0x1F, 0xA3, 0xF0, 0x9E, 0xA0, 0xAF, 0x49, 0xD9, 0x1A, 0xD0, 0x9F, 0xA7, 0x77, 0x73, 0x1F,
+    0xE2, 0xFE, 0x2F, 0xDA, 0x2F, 0xD9, 0x2F, 0xD3, 0xFC, 0xA2, 0xAF, 0xC9, 0x2F, 0xD2, 0x9F, 0xD2,
+    0xAF, 0xCA, 0x20, 0x1F, 0xE1, 0x9F, 0xDA, 0x1F, 0xE1, 0x9F, 0xD9, 0x1F, 0xDA, 0x2F, 0xD2, 0xFD,
+    0x92, 0xFD, 0x2F, 0xD3, 0xFC, 0xA2, 0xFC, 0xA2, 0xAF, 0xC9, 0x1A, 0xFC, 0x92, 0xFD, 0x2F, 0xD2,
+    0x9F, 0xCA, 0x19, 0xFD, 0x2A, 0xFC, 0x91, 0xAF, 0xCA, 0x2F, 0xD2, 0x77, 0x72, 0xCA, 0x4A, 0xCA,
+    0x39, 0xC9, 0x4F, 0x3F, 0x2F, 0x29, 0xF2, 0xFC, 0x1A, 0xF2, 0xFA, 0x19, 0xF2, 0xF9, 0x1A, 0xEA,
+    0x2F, 0x91, 0xAE, 0xA2, 0xF2, 0x9E, 0xA2, 0xF2, 0x9E, 0x3A, 0xDA, 0x29, 0xE4, 0x99, 0x74, 0x99,
+    0x40, 0x70, 0x9D, 0x92, 0x9F, 0x3F, 0xA2, 0x9F, 0x39, 0xEA, 0x3A, 0xE4, 0xAD, 0x70, 0x76, 0xAD,
+    0x91, 0xAD, 0x92, 0x9F, 0x09, 0xF3, 0xF9, 0x0F, 0xA2, 0x9F, 0x09, 0xF3, 0xAE, 0xA0, 0xAE, 0xA3,
+    0xF1, 0xF4, 0xAD, 0x2A, 0xD7, 0x60, 0x77, 0x71, 0x9A, 0xA3, 0x9D, 0x49, 0xC9, 0x4A, 0xE9, 0x19,
+    0xEA, 0x2A, 0xE4, 0xAF, 0x19, 0xF2, 0xFC, 0x4F, 0x91, 0xAE, 0xA2, 0xF9, 0x39, 0xF2, 0xF9, 0x19,
+    0xF4, 0x9E, 0xA2, 0xF2, 0xAE, 0x94, 0xAE, 0x29, 0xE3, 0xAD, 0xA6, 0x97, 0x59, 0x10, 0x69, 0xA9,
+    0x74, 0x9E, 0x97, 0x3F, 0xC7, 0x2F, 0xE7, 0x9F, 0xFC, 0x94, 0xAF, 0xC0, 0xFC, 0xA2, 0xFD, 0x2F,
+    0xD0, 0x70, 0x97, 0xC9, 0x59, 0xD9, 0x4A, 0xE9, 0x3A, 0xF3, 0xFC, 0x3F, 0xA3, 0xAE, 0xA4, 0xFC,
+    0x4A, 0xFC, 0x4A, 0xFC, 0x4A, 0xFC, 0x4A, 0xF5, 0xAD, 0xA6, 0x9C, 0x97, 0x91, 0x72, 0xC9, 0x7D,
+    0x96, 0xEA, 0x5F, 0xC5, 0xAF, 0x5A, 0xF9, 0x49, 0xF4, 0xAF, 0x3A, 0xFC, 0x2F, 0xCA, 0x2F, 0xCA,
+    0x3A, 0xEA, 0x49, 0xDA, 0x59, 0xCA, 0x7A, 0x60, 0x75, 0xFA, 0x77, 0x72, 0xFA, 0x77, 0x71, 0x9F,
+    0xC7, 0x77, 0x19, 0xFC, 0x77, 0x71, 0xAF, 0xC7, 0x69, 0xFD, 0x92, 0xFD, 0x92, 0xFD, 0x5A, 0xFD,
+    0x2A, 0xAA, 0xAA, 0xA2, 0xFD, 0x96, 0xAF, 0xD7, 0x1F, 0xDA, 0x70, 0xFE, 0x7F, 0xE7, 0x2F, 0xE5,
+    0xAF, 0xD7, 0x39, 0xFD, 0xA3, 0xAF, 0xD9, 0x74, 0xAF, 0xDA, 0x1A, 0xFD, 0xA7, 0x6F, 0xEA, 0xAF,
+    0xE7, 0x70, 0xFF, 0xFD, 0x97, 0x1F, 0x91, 0x9F, 0xFF, 0xA2, 0xFA, 0x19, 0xFA, 0x2A, 0xFF, 0xE3,
+    0xFA, 0x19, 0xFA, 0x3F, 0xFD, 0x39, 0xFC, 0x1A, 0xFC, 0x39, 0xFF, 0x93, 0xAF, 0xC1, 0xFD, 0x3F,
+    0xFC, 0x4A, 0xFC, 0x1F, 0xD2, 0xAF, 0xFD, 0x3F, 0xD1, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xF2, 0x99,
+    0x99, 0x99, 0x70, 0x9F, 0xFF, 0xD7, 0x79, 0xFF, 0xFE, 0xA7, 0x59, 0xFF, 0xAF, 0xFA, 0x74, 0xFF,
+    0xA0, 0x9F, 0xFA, 0x72, 0xFF, 0xC2, 0x9F, 0xF9, 0x70, 0xFF, 0xC4, 0xAF, 0xF9, 0x6F, 0xFC, 0x95,
+    0xFF, 0xC9, 0x4A, 0xFF, 0x97, 0xFF, 0xC9, 0x2A, 0xFF, 0xA7, 0x09, 0xFF, 0xC7, 0x77, 0x77, 0x69,
+    0x99, 0x97, 0x77, 0x2A, 0xF7, 0x77, 0x2F, 0xC7, 0x77, 0x2F, 0xC9, 0x77, 0x71, 0xFC, 0x97, 0x77,
+    0x09, 0xFC, 0xA7, 0x77, 0x0A, 0xFC, 0xA7, 0x50, 0x73, 0x9C, 0x69, 0xD5, 0xAE, 0x4A, 0xE4, 0xAE,
+    0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x39, 0xF3, 0x9F, 0x39, 0xF3, 0xAF, 0x3A, 0xF3, 0xAF, 0x3F, 0xC3,
+    0xFC, 0x39, 0xF4, 0x9E, 0x6D, 0x79, 0x77, 0x77, 0x77, 0x70, 0x9F, 0xC2, 0xAF, 0xC9, 0x1A, 0xFC,
+    0xA1, 0xFD, 0xA1, 0xFE, 0x1F, 0xE0, 0x9F, 0xE0, 0xAF, 0xE0, 0x69, 0x77, 0x0A, 0xA7, 0x7A, 0xC9,
+    0x76, 0xE9, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x29, 0xAF, 0xCA, 0x79, 0xFF, 0xD9, 0x4A, 0xFF, 0xFA,
+    0x2A, 0xFF, 0xFD, 0x92, 0xF9, 0x9F, 0xAF, 0x29, 0xCA, 0x19, 0xEA, 0x0F, 0x92, 0x92, 0xAE, 0xA0,
+    0xAE, 0xA6, 0xAE, 0xA0, 0x9F, 0x6A, 0xEA, 0x09, 0xF6, 0xAE, 0xA0, 0x9F, 0x6F, 0xA0, 0x9F, 0x6F,
+    0xA0, 0xAE, 0xA6, 0xFA, 0x9F, 0x96, 0xFF, 0xD7, 0xFF, 0xC9, 0x7F, 0xFA, 0x70, 0xFE, 0xA7, 0x1F,
+    0xD9, 0x72, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x72, 0x9F, 0x97, 0x3A, 0xCA,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0x99, 0x97, 0x4A, 0xFC, 0x73, 0xAF, 0xC7, 0x3F, 0xD7, 0x3F,
+    0xD9, 0x72, 0xFD, 0x97, 0x19, 0xFD, 0x97, 0x19, 0xFD, 0xA7, 0x1A, 0xFD, 0xA7, 0x1F, 0xF7, 0x1F,
+    0xF5, 0x9F, 0xFF, 0xD9, 0x9F, 0xFF, 0xD9, 0x9F, 0xFF, 0xD9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x90, 0x39, 0x70, 0x9E, 0xA3, 0x9E, 0xA9, 0xFF, 0xF9, 0x0F, 0xFF, 0x19, 0xFF, 0xD3, 0x9F,
+    0xEA, 0x70, 0x99, 0x50, 0x77, 0x74, 0xAC, 0x97, 0x71, 0xD9, 0x1A, 0x73, 0xCA, 0x0D, 0x99, 0xD7,
+    0x2A, 0xFF, 0xC7, 0x2A, 0xFF, 0x97, 0x49, 0xFC, 0x76, 0xFE, 0x97, 0x29, 0xFF, 0xCA, 0x72, 0xD9,
+    0xDA, 0xAD, 0x73, 0xA9, 0x0D, 0xA0, 0x99, 0x9A, 0x70, 0x9C, 0xA0, 0xDA, 0x1A, 0xD1, 0x99, 0x4D,
+    0xA0, 0x9A, 0x9A, 0x09, 0xD0, 0xAC, 0xA1, 0xD9, 0xAC, 0xA9, 0xFC, 0xAF, 0xC9, 0x0A, 0xFF, 0xCA,
+    0xFD, 0xA3, 0x9F, 0xDA, 0x2A, 0xFC, 0x93, 0x9F, 0xCA, 0x90, 0xFF, 0xC1, 0xFF, 0xFE, 0x9D, 0xA1,
+    0xEA, 0xD9, 0xD9, 0xC9, 0x0D, 0x90, 0x92, 0x9A, 0x0A, 0xD1, 0x93, 0xD7, 0x0A, 0xCA, 0x77, 0x77,
+    0x20, 0x77, 0xE9, 0x76, 0xF7, 0x69, 0xE9, 0x76, 0xEA, 0x76, 0xAE, 0x76, 0x9E, 0xA7, 0x6F, 0x76,
+    0xAE, 0x97, 0x6F, 0x76, 0xAE, 0x97, 0x59, 0xF7, 0x6F, 0x76, 0xAE, 0xA7, 0x6F, 0x76, 0xFA, 0x75,
+    0x9F, 0x76, 0xF9, 0x75, 0xAF, 0x75, 0x9F, 0x76, 0xFA, 0x75, 0x9F, 0x76, 0xFA, 0x75, 0xAF, 0x75,
+    0x9F, 0x97, 0x5F, 0xC7, 0x50, 0x77, 0x77, 0x71, 0x9A, 0xAA, 0x97, 0x49, 0xAA, 0xA9, 0x71, 0x9A,
+    0xFF, 0x70, 0xAF, 0xF6, 0xAF, 0xFE, 0xA4, 0xAF, 0xFE, 0xA3, 0xFF, 0xFD, 0x92, 0xFF, 0xFD, 0x91,
+    0x9F, 0xCA, 0x29, 0xFC, 0x19, 0xFC, 0xA2, 0x9F, 0xC2, 0x9D, 0xA6, 0xFA, 0x19, 0xDA, 0x6F, 0xA2,
+    0xA9, 0x79, 0xF2, 0xA9, 0x79, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x97, 0x4F, 0x97,
+    0x4F, 0x97, 0x4F, 0x97, 0x39, 0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4A, 0xF7, 0x39, 0xFA, 0x73, 0x9F,
+    0x97, 0x19, 0xFD, 0x72, 0x9F, 0xD7, 0x09, 0xFE, 0x97, 0x09, 0xFE, 0x97, 0x9F, 0xE9, 0x70, 0x9F,
+    0xE9, 0x70, 0xAF, 0xD9, 0x71, 0xAF, 0xD9, 0x71, 0xAF, 0xC7, 0x3A, 0xFC, 0x73, 0xAF, 0xC7, 0x3A,
+    0xFC, 0x73, 0xAF, 0xC7, 0x3A, 0xFC, 0x73, 0xFD, 0x73, 0xFD, 0x73, 0xFC, 0xA7, 0x3F, 0xCA, 0x73,
+    0xE9, 0x75, 0xE9, 0x75, 0x97, 0x70, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x70, 0xFA, 0x74, 0xFA, 0x74, 0xFA, 0x74, 0xFA, 0x73, 0x9F, 0xC7, 0x39, 0xFC, 0x73, 0x9F, 0xC7,
+    0x39, 0xFC, 0x73, 0xAF, 0xC7, 0x3A, 0xFC, 0x73, 0xFD, 0x97, 0x2F, 0xD9, 0x72, 0x99, 0x99, 0x99,
+    0x73, 0x99, 0x99, 0x99, 0x60, 0x77, 0x77, 0x49, 0xAA, 0xAA, 0x97, 0x59, 0x79, 0xFF, 0xA7, 0x3C,
+    0x94, 0x9F, 0xFF, 0x72, 0xDA, 0x29, 0xFF, 0xFD, 0x70, 0x9E, 0x91, 0xAF, 0xC9, 0x2A, 0xFA, 0x79,
+    0xE9, 0x2E, 0x95, 0x9F, 0x79, 0xE9, 0x3C, 0x70, 0xF9, 0x6A, 0xE9, 0x75, 0xAE, 0xA6, 0xAE, 0x97,
+    0x5A, 0xF6, 0xF9, 0x75, 0x9F, 0x6F, 0x97, 0x5A, 0xF6, 0xF9, 0x75, 0xAE, 0xA6, 0xF7, 0x6F, 0x96,
+    0xF7, 0x5F, 0xC7, 0xF7, 0x39, 0xFC, 0xA6, 0x9F, 0x71, 0x9F, 0xE7, 0x9F, 0x70, 0xFF, 0x70, 0x9F,
+    0x70, 0xFE, 0x71, 0xAF, 0x70, 0xFC, 0xA7, 0x2A, 0xF7, 0x0F, 0xC9, 0x73, 0xAE, 0x70, 0xFC, 0x97,
+    0x49, 0xD7, 0x9F, 0xC9, 0x76, 0xC7, 0x9F, 0xC9, 0x77, 0x7A, 0xEA, 0x77, 0x71, 0xAA, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9F, 0x74, 0xFC, 0xA6, 0xAF, 0x97, 0x3F, 0xCA,
+    0x6A, 0xF9, 0x72, 0x9F, 0xD6, 0xFC, 0xA7, 0x2A, 0xFD, 0x6F, 0xCA, 0x72, 0xFE, 0x59, 0xFD, 0x72,
+    0xFE, 0x69, 0x99, 0x99, 0x97, 0x2F, 0xE9, 0x77, 0x59, 0xFE, 0x90, 0x77, 0x73, 0xA6, 0x9A, 0xAA,
+    0x97, 0x2C, 0xA2, 0x9F, 0xFA, 0x79, 0xDA, 0x0A, 0xFF, 0xE9, 0x59, 0xFF, 0xFF, 0xC5, 0x9F, 0xFA,
+    0x29, 0xFC, 0x4A, 0xFD, 0x96, 0xF9, 0x3A, 0xE9, 0xC9, 0x7A, 0xF3, 0xAE, 0x97, 0x19, 0xF3, 0xF9,
+    0x71, 0x9F, 0x3F, 0x97, 0x19, 0xF3, 0xF7, 0x29, 0xF3, 0xF7, 0x2A, 0xF3, 0xF7, 0x2F, 0xA2, 0x9F,
+    0x71, 0xAF, 0x92, 0x9F, 0x79, 0xFD, 0x39, 0xF5, 0xAF, 0xE4, 0xAF, 0x4A, 0xFE, 0x5A, 0xF4, 0xFE,
+    0x6A, 0xF4, 0xFC, 0xA7, 0x0A, 0xE4, 0xFC, 0xA7, 0x19, 0xD4, 0xFC, 0xA7, 0x3C, 0x4F, 0xCA, 0x77,
+    0x1F, 0xC9, 0x77, 0x09, 0xDA, 0x97, 0x73, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4F, 0xC9,
+    0x3F, 0x97, 0x9F, 0xCA, 0x29, 0xFA, 0x79, 0xFD, 0x29, 0xFA, 0x7A, 0xFD, 0x2A, 0xFC, 0x7F, 0xE2,
+    0xFD, 0x7F, 0xE2, 0xFD, 0x7F, 0xE9, 0x19, 0x99, 0x99, 0x96, 0x9F, 0xE9, 0x76, 0x77, 0x77, 0x69,
+    0xC9, 0x77, 0x09, 0xE7, 0x71, 0xF7, 0x70, 0x9E, 0xA7, 0x70, 0xAE, 0x97, 0x70, 0xF7, 0x70, 0x9F,
+    0x77, 0x0A, 0xE9, 0x77, 0x0F, 0x77, 0x1F, 0x77, 0x09, 0xEA, 0x6A, 0xF4, 0xAE, 0x96, 0xFC, 0x4F,
+    0x7F, 0xC3, 0x9F, 0x7F, 0xC9, 0x2A, 0xEA, 0x69, 0xFC, 0x92, 0xF9, 0x6A, 0xFC, 0xA2, 0xF7, 0x99,
+    0x99, 0x99, 0x91, 0xAF, 0x77, 0x0F, 0x97, 0x70, 0xF7, 0x70, 0x9F, 0x77, 0x0A, 0xEA, 0x77, 0x0F,
+    0x97, 0x79, 0xF7, 0x70, 0xAF, 0x77, 0x0F, 0xA7, 0x70, 0xF9, 0x77, 0x9F, 0x77, 0x0F, 0xC4, 0x99,
+    0x99, 0x7F, 0xA3, 0xAF, 0x69, 0xF4, 0xAF, 0x6A, 0xF4, 0xFC, 0x95, 0xFA, 0x4F, 0xCA, 0x5F, 0x93,
+    0x9F, 0xCA, 0x4A, 0xF4, 0x9F, 0xD4, 0xFC, 0x77, 0x0F, 0xA7, 0x79, 0xF9, 0x77, 0xAF, 0x77, 0x0F,
+    0xC7, 0x79, 0xFA, 0x77, 0xAF, 0x97, 0x7F, 0xC7, 0x70, 0xFA, 0x77, 0x9F, 0x97, 0x7F, 0xC7, 0x70,
+    0xEA, 0x77, 0x09, 0xD9, 0x77, 0x1A, 0xC7, 0x73, 0x97, 0x73, 0x1A, 0xDA, 0x2D, 0x99, 0xCA, 0x09,
+    0xCA, 0x1A, 0xC0, 0xAC, 0x9A, 0xA9, 0xC9, 0xAC, 0x9D, 0x9C, 0xAD, 0x9D, 0x9C, 0xAD, 0x99, 0x0A,
+    0xCA, 0xAD, 0x1D, 0xA9, 0xFD, 0x90, 0xFD, 0x2F, 0x71, 0x74, 0x9C, 0x95, 0xDA, 0x4E, 0xA3, 0xAC,
+    0x9C, 0xA2, 0x9C, 0x99, 0xCA, 0x2D, 0x09, 0xD1, 0xAF, 0xE0, 0xAF, 0xE4, 0xAD, 0x5A, 0xD1, 0x0F,
+    0xD0, 0x9F, 0xD0, 0x9C, 0xA4, 0x9C, 0xA4, 0x9F, 0xA1, 0xAF, 0xD5, 0xDA, 0x4A, 0xCA, 0x0A, 0x19,
+    0xDA, 0x9F, 0xD9, 0xAF, 0xD0, 0x9A, 0xEA, 0x10, 0x19, 0xF9, 0x1A, 0xFC, 0x91, 0xD5, 0x9C, 0xAA,
+    0xCA, 0x2A, 0xFD, 0x1E, 0x90, 0xDA, 0x0D, 0xA2, 0xD0, 0xAC, 0xA2, 0xD0, 0x9D, 0x99, 0xAD, 0x1F,
+    0xD9, 0x2A, 0xE9, 0x10, 0x70, 0xAF, 0xE0, 0xAF, 0xE5, 0x9D, 0x5A, 0xCA, 0x5D, 0xA4, 0x9D, 0x94,
+    0xAD, 0x94, 0xE5, 0xE4, 0x9E, 0x4E, 0xA4, 0x99, 0x92, 0x1A, 0xE9, 0x2D, 0xAA, 0xD9, 0x1D, 0x19,
+    0xCA, 0x1D, 0x1A, 0xCA, 0x1A, 0xFC, 0x29, 0xFC, 0x19, 0xD1, 0xAD, 0x0D, 0xA2, 0xD0, 0xAD, 0xA9,
+    0xE0, 0x9F, 0xDA, 0x19, 0xAE, 0xA1, 0x1A, 0xDA, 0x3F, 0xD9, 0x09, 0xC9, 0x19, 0xCA, 0x0A, 0xC3,
+    0xD0, 0xAC, 0x3D, 0x0A, 0xCA, 0x1A, 0xD9, 0x0F, 0xE9, 0x1A, 0xFC, 0x19, 0x29, 0xD0, 0x9F, 0xDA,
+    0x09, 0xFC, 0xA7, 0x20, 0x77, 0x19, 0xE0, 0x9A, 0xEA, 0xA4, 0x9F, 0xFF, 0x39, 0xFF, 0xFC, 0x2A,
+    0xFF, 0xFC, 0x91, 0xAF, 0xA3, 0xAF, 0x1A, 0xF5, 0xF1, 0xFA, 0x5F, 0x1F, 0x95, 0xF9, 0x0F, 0x95,
+    0xF9, 0x0F, 0xA5, 0xF9, 0x0F, 0xA5, 0xFA, 0x0F, 0xA5, 0xFA, 0x0F, 0xC4, 0x9F, 0xA9, 0xFC, 0x49,
+    0xFA, 0x9F, 0xC4, 0xAF, 0xC9, 0xFC, 0x4A, 0xFC, 0xAF, 0xC4, 0xAF, 0xC0, 0x1A, 0xDA, 0x3A, 0xCA,
+    0x9D, 0x2D, 0x19, 0xC9, 0x0A, 0xCA, 0x9A, 0x0D, 0x0A, 0xC9, 0xD0, 0xD0, 0xD9, 0xD9, 0xD0, 0xDA,
+    0xAC, 0x9D, 0x0A, 0xD1, 0xAD, 0x0A, 0xDA, 0x9E, 0x1F, 0xD9, 0x1A, 0xFC, 0x3A, 0xDA, 0x20, 0x29,
+    0x93, 0xAE, 0x3F, 0x3A, 0x9D, 0x49, 0xD4, 0x9D, 0x49, 0xD4, 0xAD, 0x4A, 0xD2, 0x9A, 0xEA, 0xA0,
+    0xAF, 0xD9, 0xAF, 0xD9, 0x09, 0xEA, 0x29, 0xFD, 0x90, 0xAC, 0x91, 0xE5, 0x9D, 0x59, 0xD5, 0xDA,
+    0x4E, 0x93, 0xEA, 0x29, 0xF3, 0xFA, 0xAA, 0x09, 0xFE, 0x0A, 0xFE, 0x00, 0x09, 0xAA, 0xA9, 0x3F,
+    0xD2, 0x92, 0x9C, 0xA6, 0xD5, 0x9C, 0xA2, 0xFC, 0x3F, 0xC9, 0x5A, 0xD1, 0x99, 0x19, 0xD1, 0xFE,
+    0x09, 0xFD, 0xA0, 0x9A, 0xF9, 0x10, 0x75, 0xD5, 0xE4, 0xAE, 0x39, 0xCA, 0xD3, 0xD0, 0xD2, 0xD1,
+    0xD1, 0xAD, 0xAF, 0x9F, 0xF9, 0x09, 0x99, 0xAD, 0xA4, 0x9D, 0x94, 0x9D, 0x90, 0x0A, 0xAA, 0xAA,
+    0xA0, 0x9F, 0xD0, 0x9C, 0x94, 0x9C, 0x94, 0xAE, 0xA9, 0x1A, 0xFD, 0x5D, 0x94, 0xDA, 0x9A, 0x19,
+    0xD9, 0x9F, 0xD9, 0xAF, 0xCA, 0x09, 0xAD, 0xA9, 0x10, 0x2A, 0xEA, 0x19, 0xFC, 0xA1, 0xD9, 0x49,
+    0xCA, 0x5A, 0xCA, 0xAC, 0xA9, 0x1A, 0xFD, 0x90, 0xE9, 0x0A, 0xD0, 0xE2, 0xD0, 0xAD, 0x2D, 0x99,
+    0xDA, 0x9A, 0xD1, 0xFD, 0xA2, 0xAE, 0xA1, 0xAF, 0xE0, 0xAF, 0xE5, 0x9D, 0x5A, 0xD5, 0xDA, 0x49,
+    0xD9, 0x4A, 0xD9, 0x4E, 0x5E, 0x49, 0xE4, 0xAD, 0xA4, 0x99, 0x99, 0x10, 0x29, 0x99, 0x39, 0xFC,
+    0x2D, 0x90, 0xAD, 0x1D, 0x2D, 0x1D, 0x90, 0xAD, 0x1A, 0xFC, 0x91, 0x9F, 0xC9, 0x09, 0xD1, 0x9D,
+    0x0A, 0xCA, 0x2D, 0x9A, 0xDA, 0xAE, 0x90, 0xFE, 0x2A, 0xEA, 0x10, 0x19, 0xAA, 0x93, 0xAF, 0xC1,
+    0x9C, 0xA1, 0xAC, 0xA0, 0xAC, 0x3D, 0x0A, 0xC3, 0xD0, 0xAC, 0x91, 0x9D, 0x90, 0xFE, 0x91, 0xFD,
+    0x95, 0xD1, 0xA9, 0x90, 0xAD, 0x09, 0xFD, 0xA0, 0x9F, 0xC9, 0x72, 0x7D, 0xAA, 0x7F, 0xA6, 0x9F,
+    0x7F, 0x96, 0xAF, 0x7F, 0x7A, 0xF7, 0xF9, 0x6A, 0xF7, 0xF9, 0x69, 0xF7, 0xAF, 0x7F, 0x97, 0xF7,
+    0x9F, 0x7A, 0xEA, 0x7A, 0xEA, 0x7F, 0x97, 0xF9, 0x7F, 0x97, 0xF9, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7,
+    0xAF, 0x7A, 0xF7, 0x9F, 0x97, 0xFA, 0x7F, 0xC7, 0xAF, 0x96, 0x9F, 0xA7, 0xFC, 0x7A, 0xFA, 0x69,
+    0xFC, 0x7F, 0xCA, 0x69, 0xFC, 0x96, 0xFD, 0x69, 0xFC, 0x96, 0xFD, 0x7A, 0xAA, 0xAA, 0x90, 0x1A,
+    0xE7, 0x0F, 0x97, 0x0F, 0x70, 0xAF, 0x70, 0xF9, 0x7A, 0xF7, 0x0F, 0x97, 0xAF, 0x70, 0xF9, 0x7A,
+    0xF7, 0x9F, 0x70, 0xF9, 0x7A, 0xEA, 0x79, 0xF7, 0x0F, 0x70, 0xF9, 0x7F, 0x97, 0xAE, 0xA7, 0xAE,
+    0xA7, 0xAF, 0x7A, 0xEA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xF9, 0x69, 0xF9, 0x6A, 0xF7, 0xFC, 0x7F,
+    0xA6, 0xAF, 0x96, 0xFC, 0x69, 0xFC, 0x6F, 0xC9, 0x59, 0xFC, 0x6F, 0xCA, 0x5A, 0xFC, 0x6F, 0xCA,
+    0x5A, 0xFC, 0x59, 0xFC, 0xA5, 0xAA, 0xAA, 0xAA, 0x50, 0x73, 0xAA, 0xA1, 0xAA, 0xA7, 0x39, 0xE1,
+    0xE7, 0x3A, 0xDA, 0x09, 0xE7, 0x3E, 0x90, 0x9D, 0xA7, 0x3E, 0x1A, 0xD9, 0x73, 0xE1, 0xE7, 0x39,
+    0xE1, 0xE7, 0x29, 0xFC, 0x9E, 0xA7, 0x9F, 0xFF, 0x6F, 0xFF, 0xD5, 0xFF, 0xFD, 0xA4, 0xFF, 0xFE,
+    0x93, 0xAF, 0xFC, 0xAA, 0xF9, 0x3F, 0xFC, 0x90, 0x9D, 0xA4, 0xAF, 0xFC, 0x1A, 0xDA, 0x4F, 0xD9,
+    0xE1, 0xE9, 0x39, 0xFC, 0xA9, 0xE1, 0xE4, 0xAF, 0xC9, 0x9D, 0xA1, 0xE4, 0xFD, 0x0A, 0xD9, 0x09,
+    0xDA, 0x4F, 0xD0, 0xE9, 0x0A, 0xDA, 0x4F, 0xD0, 0xE1, 0xE9, 0x39, 0xFD, 0x0E, 0x1E, 0x5F, 0xDA,
+    0xDA, 0x1E, 0x5F, 0xFC, 0xA0, 0x9E, 0x5F, 0xFC, 0x90, 0xAD, 0xA1, 0x92, 0xAF, 0xFC, 0xAF, 0xAD,
+    0x91, 0x9F, 0xFF, 0xFC, 0x92, 0xFF, 0xFF, 0xC9, 0x2A, 0xFF, 0xFF, 0xA3, 0xFF, 0xFF, 0xA4, 0xFF,
+    0xFE, 0xA5, 0xFF, 0xFD, 0xA5, 0x9F, 0xFF, 0xCA, 0x5A, 0xDA, 0x09, 0xE7, 0x3A, 0xD9, 0x09, 0xDA,
+    0x73, 0xE1, 0xAD, 0xA7, 0x3E, 0x1E, 0x97, 0x29, 0xE1, 0xE7, 0x49, 0x92, 0x99, 0x97, 0x77, 0x77,
+    0x9A, 0xFE, 0xAA, 0x70, 0x9F, 0xFF, 0x7F, 0xFF, 0xD6, 0xFF, 0xFD, 0xA5, 0xFF, 0xFE, 0x94, 0xAF,
+    0xFA, 0xAA, 0xAA, 0xD9, 0x39, 0xFE, 0x97, 0x4F, 0xE7, 0x6F, 0xD7, 0x6A, 0xFC, 0xA7, 0x6F, 0xD9,
+    0x76, 0xFD, 0x79, 0xAD, 0x3F, 0xD3, 0x9F, 0xE9, 0x2F, 0xD3, 0x9F, 0xE9, 0x19, 0xFD, 0x39, 0xF9,
+    0x5F, 0xD3, 0x9E, 0x7F, 0xDA, 0x29, 0xE7, 0xFE, 0x91, 0x9E, 0x19, 0xC9, 0x2A, 0xFF, 0xAA, 0xFE,
+    0x92, 0x9F, 0xFF, 0xFC, 0x93, 0xFF, 0xFF, 0xC9, 0x3A, 0xFF, 0xFF, 0xA4, 0xFF, 0xFF, 0xA5, 0xFF,
+    0xFE, 0xA6, 0xFF, 0xFD, 0xA7, 0x9F, 0xFF, 0xA0, 0x77, 0x77, 0x76, 0x9A, 0xEA, 0x97, 0x2A, 0xFF,
+    0xC7, 0x0F, 0xFF, 0x95, 0xAF, 0xA9, 0x9A, 0xFC, 0x5F, 0x5A, 0xCA, 0x95, 0xEA, 0x74, 0x9F, 0xFF,
+    0xD9, 0x39, 0xFF, 0xFD, 0x93, 0x9F, 0xFF, 0xD9, 0x49, 0x99, 0xF9, 0x99, 0x99, 0x99, 0x70, 0xAE,
+    0x77, 0x9E, 0x97, 0x3F, 0xFF, 0xE4, 0xFF, 0xFE, 0x4F, 0xFF, 0xE7, 0x1F, 0x77, 0xF7, 0x7F, 0x76,
+    0xAF, 0x74, 0x9F, 0xD7, 0x29, 0xFE, 0xA9, 0x71, 0x9F, 0xFF, 0xCA, 0xA3, 0x9F, 0xFF, 0xEA, 0x29,
+    0xFF, 0xFF, 0x91, 0x9F, 0xFF, 0xFC, 0x00, 0x77, 0x5F, 0x97, 0x39, 0xAA, 0xAA, 0xA7, 0x0F, 0x97,
+    0x39, 0xFC, 0xA6, 0x9F, 0x97, 0x3A, 0xFD, 0x69, 0xF9, 0x73, 0xAF, 0xD9, 0x59, 0xF9, 0x73, 0xAF,
+    0xE5, 0xAF, 0x74, 0xFF, 0x94, 0xAF, 0x74, 0xFF, 0xC4, 0xAF, 0x74, 0xFF, 0xC9, 0x3F, 0xC7, 0x4F,
+    0xFD, 0x3F, 0xC7, 0x4F, 0xFD, 0x3F, 0xC7, 0x4F, 0xCA, 0xFA, 0x2F, 0xC6, 0xFF, 0xFF, 0xFF, 0xFD,
+    0x90, 0xFF, 0xFF, 0xFF, 0xFD, 0x90, 0xFF, 0xFF, 0xFF, 0xFD, 0x95, 0xAF, 0xCA, 0x09, 0xFA, 0x9F,
+    0xA7, 0x3A, 0xFC, 0xA1, 0xFC, 0x9F, 0xA7, 0x3A, 0xFC, 0xA1, 0xAF, 0xFC, 0xA7, 0x3F, 0xDA, 0x2F,
+    0xFC, 0xA7, 0x3F, 0xDA, 0x2A, 0xFF, 0x97, 0x3F, 0xE2, 0x9F, 0xF9, 0x73, 0xFE, 0x3F, 0xF9, 0x73,
+    0xFE, 0x39, 0xFE, 0x97, 0x3F, 0xE4, 0xFE, 0x74, 0xFE, 0x4A, 0xFD, 0x60, 0x4A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x97, 0x6F, 0xFE, 0xA7, 0x4F, 0xFF, 0xC9, 0x72, 0xFF, 0xFD, 0x97, 0x1F, 0x93, 0x9F, 0xC4,
+    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xF9, 0x99, 0x99, 0xAF, 0xA9, 0x99, 0x99, 0x9F, 0xC9, 0x99,
+    0x49, 0xF9, 0x5F, 0xC7, 0x9F, 0xA9, 0x99, 0x9A, 0xFD, 0x79, 0xFF, 0xFE, 0xA7, 0xAF, 0xFF, 0xE7,
+    0x0A, 0xFF, 0xFD, 0xA7, 0x0A, 0xFF, 0xFC, 0xA7, 0x1A, 0xFF, 0xF9, 0x72, 0xAF, 0xFC, 0xA9, 0x74,
+    0xFC, 0xA7, 0x72, 0xFC, 0xA7, 0x72, 0xFD, 0x77, 0x2F, 0xD7, 0x72, 0xFD, 0x77, 0x2F, 0xD7, 0x72,
+    0xFD, 0x77, 0x2F, 0xD7, 0x71, 0x9F, 0xD7, 0x60, 0x1F, 0xEA, 0x77, 0x7F, 0xFC, 0xA7, 0x75, 0xFF,
+    0xD9, 0x77, 0x4E, 0x99, 0x99, 0xF7, 0x74, 0xE4, 0xE7, 0x73, 0x9E, 0x4A, 0xD9, 0x77, 0x29, 0xE4,
+    0xAD, 0xA7, 0x72, 0x9E, 0x4A, 0xDA, 0x77, 0x29, 0xE4, 0xAD, 0xA7, 0x9F, 0xA9, 0x39, 0xE4, 0xEA,
+    0x6F, 0xF3, 0xAE, 0x3A, 0xE9, 0x59, 0xEA, 0xAE, 0x3A, 0xFF, 0xE6, 0xAD, 0x39, 0x93, 0xAF, 0xFD,
+    0x96, 0xAD, 0x71, 0xAF, 0xFD, 0x79, 0xD9, 0x70, 0xAF, 0xFD, 0x97, 0xF9, 0x6F, 0xDA, 0xFC, 0x7A,
+    0xFC, 0xA4, 0xFC, 0x2F, 0x97, 0xAF, 0xD9, 0x2F, 0xC2, 0x9E, 0xA7, 0x09, 0xFD, 0x2F, 0xC2, 0x9F,
+    0x73, 0xAE, 0xA1, 0xFC, 0x29, 0xF7, 0x4F, 0x1F, 0xC2, 0x9F, 0x95, 0xCA, 0x3F, 0x1F, 0xC2, 0x9F,
+    0xA4, 0xAE, 0xAA, 0xFC, 0x1F, 0xC2, 0x9F, 0xC3, 0x9F, 0xFD, 0xA1, 0xFC, 0x29, 0xFC, 0x3F, 0xFE,
+    0x2F, 0xC2, 0x9F, 0xC9, 0x2A, 0xFF, 0xC3, 0x99, 0x99, 0x93, 0x99, 0x99, 0x95, 0x9A, 0xEA, 0x97,
+    0x77, 0x73, 0x77, 0x73, 0xEA, 0x72, 0x9E, 0x5E, 0xA7, 0x29, 0xE5, 0xF7, 0x2A, 0xE5, 0xAE, 0x72,
+    0xEA, 0x5A, 0xE7, 0x2E, 0xA5, 0x9E, 0x72, 0xE9, 0x59, 0xE9, 0x29, 0x99, 0x3E, 0x96, 0xE9, 0x2E,
+    0x29, 0xE3, 0xAF, 0xFF, 0xFF, 0xE9, 0xAF, 0xFF, 0xFF, 0xE9, 0xAF, 0xFF, 0xFF, 0xE9, 0x3A, 0xE0,
+    0x9F, 0xC9, 0x0E, 0xA7, 0xAE, 0x09, 0xFC, 0x90, 0xE9, 0x79, 0xE9, 0xAF, 0xCA, 0x0E, 0x97, 0x9E,
+    0x9F, 0xE9, 0xE7, 0x1F, 0xFE, 0xAE, 0x71, 0xFE, 0xAF, 0xE7, 0x1F, 0xE0, 0xFD, 0xA7, 0x1F, 0xE0,
+    0xAF, 0xCA, 0x71, 0xAF, 0xCA, 0x09, 0xFC, 0x97, 0x1A, 0xFC, 0xA1, 0xFC, 0x97, 0x19, 0xFC, 0x91,
+    0xFC, 0x72, 0x9F, 0xC2, 0xFC, 0x73, 0xFC, 0x2A, 0xF7, 0x3F, 0xA2, 0x9E, 0xA5, 0x77, 0x69, 0xDA,
+    0xAA, 0x99, 0x76, 0x9F, 0xFD, 0x97, 0x29, 0xFF, 0xF5, 0xEA, 0x9F, 0xFF, 0xC4, 0xEA, 0x9F, 0xCA,
+    0x99, 0xAF, 0xC3, 0xEA, 0x9F, 0x5A, 0xE3, 0xEA, 0x9E, 0x7E, 0x92, 0xEA, 0x9E, 0x7A, 0xDA, 0x2E,
+    0xA9, 0xE1, 0xA9, 0x92, 0xAD, 0xA2, 0xEA, 0x9E, 0x1F, 0x1A, 0xDA, 0x2E, 0xA9, 0xE1, 0xF1, 0xAE,
+    0x2E, 0xA9, 0xE1, 0xF1, 0xAE, 0x2E, 0xA9, 0xE1, 0xF1, 0xAE, 0x2E, 0xA9, 0xE1, 0xF2, 0x99, 0xA1,
+    0x9E, 0xA9, 0xE1, 0xF7, 0x9E, 0xA9, 0xE1, 0xAE, 0xA6, 0x9E, 0xA9, 0xE1, 0x9F, 0xA5, 0xFA, 0x9E,
+    0x2F, 0xDA, 0x99, 0x9F, 0xCA, 0x9E, 0x29, 0xFF, 0xFD, 0xA9, 0xE3, 0x9F, 0xFF, 0xCA, 0x71, 0x9A,
+    0xFF, 0xDA, 0x76, 0x99, 0xAA, 0xAD, 0xA0, 0x75, 0x99, 0x97, 0x72, 0xE9, 0x77, 0x1E, 0x97, 0x4A,
+    0xFF, 0xE7, 0x1A, 0xFF, 0xE7, 0x19, 0xAA, 0xAF, 0xCA, 0xAA, 0x76, 0xE7, 0x4A, 0xDA, 0x90, 0xE7,
+    0x29, 0xFF, 0xD7, 0x19, 0xFF, 0xE7, 0x1F, 0x99, 0xFD, 0x70, 0x9E, 0x3F, 0xC7, 0x0A, 0xD9, 0x39,
+    0xF7, 0x0E, 0x49, 0xF7, 0x0E, 0x49, 0xF7, 0x0A, 0xD9, 0x3A, 0xF7, 0x0A, 0xEA, 0x99, 0xAF, 0xC7,
+    0x1F, 0xFF, 0x71, 0xAF, 0xFE, 0x72, 0xAF, 0xFD, 0x73, 0x9F, 0x99, 0xE7, 0x77, 0x2A, 0xFF, 0xFF,
+    0x4A, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0x40, 0x77, 0x76, 0x99, 0xAA, 0xA9, 0x97, 0x2A, 0xFF, 0xC7,
+    0x9F, 0xFE, 0x7F, 0xFF, 0x6A, 0xFF, 0xF6, 0xFD, 0x93, 0x99, 0x59, 0xFC, 0x75, 0xAF, 0xF6, 0x9F,
+    0xFF, 0xA5, 0xFF, 0xFD, 0x49, 0xFF, 0xFD, 0x93, 0xAA, 0xAA, 0xAF, 0xA7, 0x6F, 0xA7, 0x6F, 0xA7,
+    0x3A, 0xAA, 0xFF, 0xC9, 0x5F, 0xFF, 0xCA, 0x5F, 0xFF, 0xD4, 0xAF, 0xFF, 0xCA, 0x71, 0x9F, 0xA7,
+    0x59, 0xFC, 0xA7, 0x5F, 0xFA, 0xAA, 0xAA, 0x6F, 0xFF, 0xC6, 0x9F, 0xFF, 0x7A, 0xFF, 0xE7, 0x09,
+    0xFF, 0xD7, 0x29, 0xAF, 0xE7, 0x74, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF,
+    0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC7, 0x1F, 0xC2, 0x97, 0x5F, 0xC0, 0xAD,
+    0x75, 0xFF, 0xC7, 0x5F, 0xFC, 0x73, 0x9F, 0xFD, 0x71, 0xAF, 0xFD, 0x97, 0x2F, 0xFC, 0x97, 0x4F,
+    0xFC, 0x75, 0xFF, 0xC1, 0x9A, 0x71, 0xA9, 0x09, 0xFC, 0xAE, 0x74, 0x9F, 0xFC, 0x74, 0xAF, 0xFC,
+    0x72, 0xAF, 0xFD, 0xA7, 0x1F, 0xFD, 0x97, 0x3F, 0xFC, 0x97, 0x4F, 0xFC, 0x97, 0x4D, 0x9A, 0xFC,
+    0x97, 0x49, 0x1A, 0xFC, 0x97, 0x7A, 0xFC, 0x97, 0x7A, 0xFC, 0x97, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x97, 0x72, 0xFF, 0xEA, 0x77, 0x0F, 0xFF, 0xC9, 0x76, 0xFF, 0xFD, 0x79, 0x99, 0x99, 0x99, 0xFA,
+    0x99, 0x9A, 0xFD, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xFF, 0xFF, 0x7F, 0x95, 0xAE, 0xA5, 0xFF, 0xFF,
+    0xFF, 0xF6, 0x9F, 0xA4, 0x9F, 0xC7, 0x39, 0xFA, 0x99, 0x9A, 0xAF, 0xD7, 0x39, 0xFF, 0xFE, 0xA7,
+    0x3A, 0xFF, 0xFE, 0x74, 0xAF, 0xFF, 0xDA, 0x74, 0xAF, 0xFF, 0xCA, 0x75, 0xAF, 0xFF, 0x97, 0x6A,
+    0xFF, 0xCA, 0x97, 0x70, 0xFC, 0xA7, 0x76, 0xFC, 0xA7, 0x76, 0xFD, 0x77, 0x6F, 0xD7, 0x76, 0xFD,
+    0x77, 0x6F, 0xD7, 0x76, 0xFD, 0x77, 0x6F, 0xD7, 0x75, 0x9F, 0xD7, 0x70, 0x77, 0x77, 0x4A, 0xE7,
+    0x75, 0xAE, 0x77, 0x5A, 0xE7, 0x75, 0xAE, 0x77, 0x5A, 0xE7, 0x75, 0xAE, 0x77, 0x29, 0xAF, 0xFA,
+    0xA9, 0x72, 0xAF, 0xFF, 0xD7, 0x09, 0xFF, 0xFF, 0x79, 0xFF, 0xFF, 0xC9, 0x6F, 0xFF, 0xFD, 0x95,
+    0xFF, 0x9F, 0x39, 0xA9, 0x5F, 0xDA, 0x1F, 0x73, 0xAF, 0xD2, 0xF7, 0x3F, 0xD9, 0x2F, 0x73, 0xFD,
+    0x3F, 0x73, 0xFC, 0xA3, 0xEA, 0x73, 0xFC, 0xA3, 0xEA, 0x73, 0xFC, 0xA3, 0xF9, 0x71, 0x9F, 0xCA,
+    0x3F, 0xFC, 0xAA, 0x99, 0x2F, 0xCA, 0x3F, 0xFF, 0xC2, 0xFC, 0xA3, 0xFF, 0xFC, 0x91, 0xFD, 0x3F,
+    0xFF, 0xCA, 0x1F, 0xD9, 0x2E, 0xA9, 0x9A, 0xFE, 0x1F, 0xE2, 0xEA, 0x2A, 0xF9, 0xA1, 0xAF, 0xE1,
+    0xEA, 0x2F, 0xC4, 0xFF, 0xFA, 0x9A, 0xFD, 0x4F, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 0xF5, 0x9F, 0xFF,
+    0xFE, 0x69, 0xFF, 0xFF, 0xD7, 0x0F, 0xFF, 0xE9, 0x73, 0xAF, 0xFA, 0x97, 0x70, 0x9E, 0x97, 0x74,
+    0x9E, 0x97, 0x74, 0x9E, 0x97, 0x74, 0x9E, 0x97, 0x75, 0x99, 0x97, 0x30, 0x69, 0xAA, 0xFC, 0xAA,
+    0x77, 0x3F, 0xFE, 0xA7, 0x71, 0x9F, 0xFF, 0x77, 0x1A, 0xEA, 0xAF, 0xDA, 0x77, 0x19, 0x4A, 0xFC,
+    0x77, 0x70, 0xAF, 0x97, 0x77, 0x0F, 0x97, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F,
+    0xA9, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0xFF, 0xF9, 0x0F, 0xFF, 0xFF,
+    0xFF, 0x97, 0x77, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x91, 0xFF, 0xFF, 0xFF, 0xF9, 0x0F, 0xFF, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0xFF, 0xF9, 0x29,
+    0xFC, 0x71, 0xA7, 0x49, 0xFC, 0x95, 0x9F, 0x74, 0xFE, 0xA9, 0xAF, 0xEA, 0x73, 0xAF, 0xFF, 0xFC,
+    0x97, 0x3A, 0xFF, 0xFF, 0xC7, 0x49, 0xFF, 0xFE, 0x97, 0x7A, 0xAF, 0xEA, 0x99, 0x77, 0x77, 0x60,
+    0x77, 0x4F, 0x72, 0xF7, 0x2A, 0xE7, 0x1A, 0xFD, 0x94, 0xAF, 0xFA, 0x39, 0xFF, 0xCA, 0x3F, 0xFD,
+    0xA2, 0xAF, 0xAE, 0x5F, 0x9A, 0xE4, 0x9F, 0x09, 0xE4, 0x9F, 0x09, 0xE4, 0x9F, 0x09, 0xE4, 0x9F,
+    0x09, 0xE4, 0x9F, 0x99, 0xE5, 0xFA, 0x9E, 0x94, 0xFF, 0xD9, 0x39, 0xFF, 0xD9, 0x3F, 0xFE, 0x93,
+    0xAF, 0xFD, 0x49, 0xAF, 0xD9, 0x70, 0xE9, 0x72, 0xEA, 0x72, 0x96, 0x9F, 0xFF, 0xFF, 0xE9, 0xFF,
+    0xFF, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x09, 0xFF, 0xFF, 0xFC, 0x19, 0xFF, 0xFF, 0xFC, 0x19,
+    0xFF, 0xFF, 0xFC, 0x19, 0xFF, 0xFF, 0xFC, 0x29, 0x99, 0x93, 0xFC, 0x39, 0x99, 0x97, 0x2F, 0xC7,
+    0x72, 0xFC, 0x77, 0x2F, 0xC7, 0x72, 0xFC, 0x77, 0x19, 0xFC, 0x77, 0x19, 0xFC, 0x77, 0x19, 0xFC,
+    0x77, 0x19, 0xFC, 0x77, 0x19, 0xFC, 0x77, 0x19, 0xFC, 0x77, 0x1A, 0xFC, 0x97, 0x70, 0xAF, 0xC9,
+    0x77, 0x0A, 0xFC, 0x97, 0x70, 0xAF, 0xC9, 0x77, 0x0A, 0xFC, 0x97, 0x70, 0xAF, 0xC9, 0x70, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0x90, 0xFF, 0xFD, 0x90, 0xFF, 0xFD, 0x95,
+    0xAE, 0x97, 0x3F, 0x5F, 0xFF, 0xD9, 0x0F, 0xFF, 0xD9, 0x0F, 0xFF, 0xD9, 0x0A, 0xAA, 0xAA, 0xFC,
+    0xAA, 0xAA, 0x1F, 0xFC, 0x95, 0xFF, 0xC6, 0xFF, 0x7F, 0xFA, 0x6F, 0xFC, 0x95, 0x92, 0x9F, 0xC7,
+    0x2A, 0xF9, 0x71, 0x9F, 0xA7, 0x19, 0xFC, 0x71, 0xAF, 0xC7, 0x1A, 0xFC, 0xA7, 0x0A, 0xFD, 0x70,
+    0xAF, 0xD7, 0x09, 0xAA, 0xAA, 0xAA, 0x20, 0x3A, 0xAD, 0x75, 0xF7, 0x5F, 0x39, 0x97, 0xF0, 0x9A,
+    0xDA, 0x7F, 0xFC, 0xA7, 0xFF, 0xCA, 0x49, 0xAF, 0xFD, 0x93, 0x9F, 0xFC, 0xA6, 0x9F, 0xE9, 0x09,
+    0xAC, 0xA3, 0x9F, 0xEA, 0xFA, 0x39, 0xCA, 0xAF, 0xFC, 0xA6, 0xAF, 0xFC, 0xA4, 0xFF, 0xDA, 0x99,
+    0xE9, 0x9F, 0xF9, 0x2A, 0xE9, 0x9F, 0xE3, 0x9F, 0x09, 0xDA, 0xAE, 0x2A, 0xFA, 0x09, 0xA1, 0x9E,
+    0x99, 0xFD, 0x59, 0xFF, 0xD6, 0x9F, 0xFA, 0x79, 0xFD, 0xA7, 0x19, 0xEA, 0x97, 0x77, 0x10, 0x79,
+    0xAA, 0xA7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x0A, 0xEA, 0x97, 0x4A, 0xFF, 0x97,
+    0x1A, 0xFF, 0xD9, 0x7A, 0xFF, 0xF7, 0xFF, 0xFC, 0xA5, 0x9F, 0xFA, 0xFC, 0x59, 0xFA, 0xE9, 0x9F,
+    0x5A, 0xF0, 0xE9, 0x0F, 0x5A, 0xEA, 0x0E, 0x90, 0xF9, 0x4A, 0xE9, 0x0E, 0x90, 0xAE, 0x94, 0xAE,
+    0x90, 0xEA, 0x0A, 0xE9, 0x4A, 0xE1, 0xEA, 0x0A, 0xE9, 0x4A, 0xE1, 0xEA, 0x0A, 0xE9, 0x4A, 0xE1,
+    0xEA, 0x0A, 0xE9, 0x4A, 0xE1, 0xEA, 0x0A, 0xE9, 0x4A, 0xE9, 0x0E, 0xA0, 0xAE, 0x94, 0xAE, 0x90,
+    0xEA, 0x0A, 0xE9, 0x4A, 0xEA, 0x0E, 0xA0, 0xF9, 0x4A, 0xF0, 0xF0, 0xF9, 0x49, 0xF0, 0xF0, 0xF9,
+    0x10, 0x70, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0xFF, 0xEA, 0x75, 0xFF, 0xFC, 0x97, 0x3F, 0xFF,
+    0xD9, 0x72, 0xF9, 0x39, 0xFC, 0x72, 0xF9, 0x5F, 0x97, 0x1F, 0x95, 0xAE, 0xA7, 0x09, 0xF9, 0x5A,
+    0xF7, 0x09, 0xF9, 0x5F, 0xC7, 0x09, 0xFA, 0x99, 0x99, 0xAF, 0xD4, 0xFF, 0xFF, 0xFA, 0x4F, 0xFF,
+    0xFF, 0x5F, 0xFF, 0xFE, 0xA5, 0xFF, 0xFF, 0xDA, 0x6F, 0xFF, 0xFC, 0x97, 0xAF, 0xFF, 0xCA, 0x97,
+    0x5F, 0xCA, 0x74, 0xFF, 0xFF, 0xDA, 0x6F, 0xFF, 0xFD, 0xA6, 0xFF, 0xFF, 0xDA, 0x69, 0x99, 0x99,
+    0x9A, 0xFD, 0x99, 0x99, 0x99, 0x75, 0xFD, 0x77, 0x3F, 0xD7, 0x73, 0xFD, 0x77, 0x29, 0xFD, 0x73,
+    0x70, 0xA7, 0x71, 0xE7, 0x7A, 0xEA, 0x75, 0xAF, 0x97, 0x49, 0xF9, 0x74, 0x9F, 0xA7, 0x5F, 0xA7,
+    0x5F, 0xC7, 0x5F, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0x9F, 0xFF, 0xFD, 0x19,
+    0xFA, 0x76, 0xAF, 0x97, 0x6A, 0xF9, 0x76, 0xAF, 0x77, 0xFC, 0x77, 0xF9, 0x77, 0xD9, 0x77, 0x09,
+    0x97, 0x10, 0x71, 0x97, 0x72, 0xDA, 0x77, 0x0F, 0xA7, 0x59, 0xFE, 0x73, 0x9F, 0xFC, 0x71, 0xAF,
+    0xFE, 0x96, 0xAF, 0xFF, 0xC9, 0x4F, 0xCA, 0xAE, 0x9F, 0xCA, 0x2F, 0xCA, 0x0A, 0xE1, 0xFC, 0xA0,
+    0x9F, 0x91, 0xAE, 0x2F, 0x91, 0x9D, 0x92, 0xAE, 0x3A, 0xC9, 0x39, 0x4A, 0xE7, 0x70, 0xAE, 0x77,
+    0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x09,
+    0xAA, 0xA7, 0x00, 0x71, 0xA9, 0x77, 0x09, 0xD9, 0x76, 0x9F, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFA,
+    0x76, 0x9F, 0xA7, 0x69, 0xF9, 0x19, 0xFF, 0xFF, 0xC9, 0x09, 0xFF, 0xFF, 0xD0, 0x9F, 0xFF, 0xFD,
+    0x99, 0xFF, 0xFF, 0xCA, 0x75, 0xFA, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xAF, 0x97, 0x5F,
+    0x97, 0x7D, 0xA7, 0x71, 0xA7, 0x77, 0x74, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7,
+    0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x2D, 0x3A, 0xE3, 0x9C, 0x3F, 0x2A,
+    0xE2, 0x9E, 0x19, 0xFC, 0x90, 0xAE, 0x1A, 0xFC, 0x19, 0xFC, 0x9A, 0xE0, 0xAF, 0xC4, 0xFF, 0xFD,
+    0xA6, 0xFF, 0xFA, 0x70, 0xFF, 0xD9, 0x72, 0xAF, 0xE9, 0x74, 0xAF, 0xC7, 0x79, 0xE7, 0x71, 0x9A,
+    0x71, 0x6A, 0x7A, 0x74, 0x9D, 0x5D, 0x97, 0x29, 0xEA, 0x3A, 0xE9, 0x71, 0xF5, 0xF7, 0x0F, 0x7F,
+    0x6F, 0x71, 0xF4, 0xAE, 0x97, 0x19, 0xEA, 0x2A, 0xFF, 0xFF, 0xFA, 0x09, 0xFF, 0xFF, 0xFD, 0x90,
+    0xAF, 0xFF, 0xFF, 0xA2, 0xF9, 0x71, 0x9F, 0x4F, 0x71, 0xF6, 0xF7, 0xF7, 0x9E, 0xA5, 0xAE, 0x97,
+    0x0A, 0xE9, 0x39, 0xEA, 0x72, 0xAD, 0x5D, 0xA7, 0x4A, 0x7A, 0x60, 0x7A, 0x97, 0x5A, 0xDA, 0x73,
+    0xFC, 0xA7, 0x1F, 0xF6, 0x9F, 0xFD, 0x49, 0xFF, 0xF2, 0xAF, 0x0A, 0xD9, 0x9F, 0x90, 0xF1, 0xAD,
+    0x90, 0x9E, 0x90, 0x9C, 0xA2, 0xAD, 0x92, 0xC9, 0x7A, 0xD9, 0x74, 0xAD, 0x97, 0x4A, 0xD9, 0x74,
+    0xAD, 0x97, 0x4A, 0xD9, 0x69, 0xCA, 0x2A, 0xD9, 0x2C, 0x91, 0xF1, 0xAD, 0x91, 0xE9, 0x0A, 0xF0,
+    0xAD, 0x99, 0xF9, 0x19, 0xFF, 0xF9, 0x39, 0xFF, 0xD7, 0xFF, 0x71, 0xFC, 0xA7, 0x3E, 0xA7, 0x5A,
+    0x97, 0x77, 0x59, 0x99, 0x9A, 0xAA, 0xCA, 0x2A, 0xFF, 0xFC, 0x2A, 0xFF, 0xFA, 0x2F, 0xFF, 0xCA,
+    0x2F, 0xE9, 0x97, 0xFE, 0xA7, 0x0F, 0xFA, 0x7E, 0xAF, 0xCA, 0x6E, 0xA0, 0xFC, 0xA5, 0xEA, 0x1F,
+    0xCA, 0x39, 0xE9, 0x2F, 0xCA, 0x29, 0xE9, 0x3F, 0xCA, 0x19, 0xE9, 0x4F, 0xCA, 0x09, 0xE6, 0xFC,
+    0x74, 0xE7, 0x6A, 0x20, 0x1C, 0xAA, 0xAA, 0x99, 0x97, 0x0F, 0xFF, 0xC3, 0xFF, 0xFC, 0x92, 0xFF,
+    0xFC, 0x97, 0x99, 0xFD, 0x97, 0x0F, 0xEA, 0x7F, 0xFA, 0x6F, 0xCA, 0xEA, 0x5F, 0xC9, 0x0E, 0xA4,
+    0xFC, 0x91, 0xF3, 0xFC, 0x92, 0xF2, 0xFC, 0x93, 0xF1, 0xFC, 0x94, 0xAE, 0x09, 0xF9, 0x5A, 0xE1,
+    0xAD, 0x97, 0x5A, 0x97, 0x40, 0x19, 0xA7, 0x5A, 0xD9, 0x73, 0xAF, 0x95, 0x9A, 0xA9, 0x1F, 0xC5,
+    0xF2, 0xFC, 0x4F, 0x3F, 0xC3, 0xEA, 0x39, 0xFC, 0x2E, 0xA4, 0x9F, 0xA0, 0x9E, 0x95, 0xAF, 0xAA,
+    0xE7, 0xAF, 0xF7, 0x0F, 0xF7, 0x1F, 0xE2, 0x9F, 0xFF, 0xA2, 0xAF, 0xFF, 0x92, 0xAF, 0xFF, 0x92,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xC2, 0x74, 0xC7, 0x6E, 0x29, 0xAA, 0x6A, 0xF0, 0x9E, 0x94,
+    0xAF, 0x90, 0x9E, 0x93, 0xAF, 0xA2, 0xEA, 0x29, 0xFA, 0x3F, 0x19, 0xFC, 0x4F, 0x1F, 0xC5, 0xAE,
+    0x0F, 0xC6, 0xAF, 0xF7, 0x9F, 0xE9, 0x70, 0xFD, 0x97, 0x1F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xC3, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x77, 0x75, 0xD7, 0x73, 0x9E, 0x77, 0x2F, 0x97,
+    0x70, 0x9F, 0x97, 0x70, 0xFA, 0x77, 0x0F, 0xC7, 0x70, 0xAF, 0x77, 0x09, 0xFF, 0xFF, 0xE1, 0x9F,
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC0, 0x9F, 0xA7, 0x71, 0xAF, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0xE3,
+    0xAF, 0xFF, 0xFD, 0x4A, 0xFA, 0x77, 0x1F, 0xC9, 0x77, 0x1F, 0x97, 0x71, 0x9D, 0xA7, 0x73, 0xAC,
+    0x75, 0x77, 0x77, 0x5A, 0x77, 0x3A, 0xCA, 0x0A, 0xC7, 0x71, 0xAD, 0xA0, 0xAD, 0x97, 0x6A, 0xEA,
+    0x0A, 0xE9, 0x74, 0xAF, 0xA0, 0xAF, 0x97, 0x2A, 0xFC, 0xA0, 0xAF, 0xC9, 0x70, 0x9F, 0xDA, 0x0A,
+    0xFD, 0x96, 0x9F, 0xEA, 0x0A, 0xFE, 0x94, 0x9F, 0xCA, 0xDA, 0x0A, 0xEA, 0xFA, 0x29, 0xFC, 0x09,
+    0xDA, 0x0A, 0xDA, 0x0A, 0xFA, 0x1F, 0xC9, 0x09, 0xDA, 0x0A, 0xDA, 0x1F, 0xC9, 0x0F, 0x91, 0x9D,
+    0xA0, 0xAD, 0xA2, 0xEA, 0x2D, 0x92, 0x9D, 0xA0, 0xAD, 0xA3, 0xCA, 0x49, 0x39, 0xDA, 0x0A, 0xDA,
+    0x77, 0x9D, 0xA0, 0xAD, 0xA7, 0x79, 0xDA, 0x0A, 0xDA, 0x77, 0x9D, 0xA0, 0xAD, 0xA7, 0x79, 0xDA,
+    0x0A, 0xDA, 0x77, 0x9D, 0xA0, 0xAD, 0xA7, 0x79, 0xDA, 0x0A, 0xDA, 0x77, 0x9D, 0xA0, 0xAD, 0xA7,
+    0x79, 0xDA, 0x0A, 0xDA, 0x77, 0x9D, 0xA0, 0xAD, 0xA7, 0x77, 0x77, 0x3A, 0xC9, 0x77, 0x29, 0xE7,
+    0x72, 0xF9, 0x77, 0x1F, 0xC7, 0x72, 0xFA, 0x77, 0x19, 0xF9, 0x77, 0x1A, 0xF3, 0x9F, 0xFF, 0xFE,
+    0x29, 0xFF, 0xFF, 0xF1, 0x9F, 0xFF, 0xFF, 0xA7, 0x70, 0x9F, 0xC0, 0x9F, 0xFF, 0xFF, 0x19, 0xFF,
+    0xFF, 0xE2, 0x9F, 0xFF, 0xFD, 0x77, 0x0F, 0xC7, 0x70, 0xFC, 0x97, 0x70, 0xFA, 0x77, 0x2E, 0x77,
+    0x39, 0xC9, 0x60, 0x77, 0x77, 0x09, 0xDA, 0x0A, 0xDA, 0x77, 0x9D, 0xA0, 0xAD, 0xA7, 0x79, 0xDA,
+    0x0A, 0xDA, 0x77, 0x9D, 0xA0, 0xAD, 0xA7, 0x79, 0xDA, 0x0A, 0xDA, 0x77, 0x9D, 0xA0, 0xAD, 0xA7,
+    0x79, 0xDA, 0x0A, 0xDA, 0x77, 0x9D, 0xA0, 0xAD, 0xA7, 0x79, 0xDA, 0x0A, 0xDA, 0x71, 0x99, 0x39,
+    0xDA, 0x0A, 0xDA, 0x71, 0xD9, 0x29, 0xDA, 0x0A, 0xDA, 0x3D, 0x2F, 0x91, 0x9D, 0xA0, 0xAD, 0xA2,
+    0xEA, 0x1F, 0xC9, 0x09, 0xDA, 0x0A, 0xDA, 0x1F, 0xC9, 0x1F, 0xC9, 0x9D, 0xA0, 0xAD, 0xA0, 0xFC,
+    0x93, 0xFF, 0xA0, 0xAF, 0xF9, 0x5F, 0xEA, 0x0A, 0xFE, 0x96, 0x9F, 0xDA, 0x0A, 0xFD, 0x97, 0x09,
+    0xFC, 0xA0, 0xAF, 0xC7, 0x39, 0xFA, 0x0A, 0xF7, 0x59, 0xEA, 0x0A, 0xE7, 0x79, 0xDA, 0x0A, 0xD7,
+    0x71, 0xAC, 0xA0, 0xAC, 0x77, 0x69, 0x72, 0x77, 0x77, 0x0D, 0x7D, 0x74, 0x9E, 0x5E, 0x97, 0x3F,
+    0x93, 0x9F, 0x72, 0x9F, 0x93, 0x9F, 0x97, 0x1F, 0xA5, 0xAF, 0x70, 0xFC, 0x7F, 0xC6, 0xAF, 0x71,
+    0xFA, 0x49, 0xFF, 0xFF, 0xF9, 0x29, 0xFF, 0xFF, 0xFD, 0x91, 0xFF, 0xFF, 0xFF, 0x09, 0xFA, 0x75,
+    0xAF, 0x90, 0xAF, 0xFF, 0xFF, 0xDA, 0x29, 0xFF, 0xFF, 0xF9, 0x4A, 0xFF, 0xFF, 0xDA, 0x6A, 0xFA,
+    0x5A, 0xFA, 0x70, 0xFC, 0x93, 0x9F, 0xA7, 0x2F, 0x93, 0x9F, 0x73, 0x9D, 0xA5, 0xAD, 0x97, 0x4A,
+    0xC7, 0xCA, 0x60, 0x7A, 0xC9, 0x77, 0xAE, 0xA7, 0x5A, 0xFC, 0xA7, 0x3A, 0xFE, 0xA7, 0x1F, 0xFE,
+    0x69, 0xFD, 0x9F, 0xDA, 0x3A, 0xFD, 0x99, 0xFF, 0xA0, 0x9F, 0xE9, 0x9F, 0xFC, 0x90, 0xFE, 0x99,
+    0xDA, 0x0A, 0xF2, 0xAC, 0x9A, 0xD9, 0x9D, 0xA1, 0x9C, 0xA6, 0xAD, 0x99, 0xDA, 0x73, 0xAD, 0x99,
+    0xDA, 0x73, 0xAD, 0x99, 0xDA, 0x73, 0xAD, 0x99, 0xDA, 0x73, 0xAD, 0x99, 0xDA, 0x70, 0xAC, 0x9A,
+    0xD9, 0x9D, 0xA1, 0x9C, 0xA2, 0xFE, 0x99, 0xDA, 0x0A, 0xF0, 0x9F, 0xE9, 0x9F, 0xFC, 0x90, 0xAF,
+    0xD9, 0x9F, 0xFA, 0x29, 0xFD, 0x9F, 0xDA, 0x6A, 0xFF, 0xD7, 0x1A, 0xFE, 0xA7, 0x3A, 0xFC, 0xA7,
+    0x5A, 0xEA, 0x77, 0xAC, 0x97, 0x00, 0x72, 0xA9, 0x97, 0x59, 0xFA, 0x73, 0xFD, 0xA7, 0x19, 0xFE,
+    0x75, 0xF9, 0x74, 0x9E, 0xA7, 0x49, 0xE9, 0x74, 0x9E, 0x97, 0x49, 0xE9, 0x49, 0xAD, 0xA9, 0x19,
+    0xE9, 0x29, 0xFF, 0x0A, 0xE2, 0x9F, 0xFF, 0xD2, 0xFF, 0xFE, 0x1A, 0xFA, 0x19, 0xFE, 0x1F, 0xA4,
+    0xFC, 0xA0, 0x9F, 0x94, 0xAF, 0x90, 0x9F, 0x59, 0xF9, 0x09, 0xF6, 0xF1, 0x9F, 0x94, 0x9F, 0x2F,
+    0xC9, 0x2A, 0xF9, 0x2F, 0xFF, 0xD3, 0x9F, 0xFF, 0xA4, 0xAF, 0xFE, 0x6A, 0xFF, 0xC7, 0x09, 0xFD,
+    0xA7, 0x49, 0x99, 0x70, 0x77, 0x71, 0xA9, 0x74, 0x9A, 0xFC, 0xA9, 0x4A, 0xD9, 0x71, 0x9F, 0xFE,
+    0xA1, 0xAF, 0x97, 0xAF, 0xFF, 0xDA, 0xFA, 0x7A, 0xFF, 0xFF, 0xEA, 0x7A, 0xFD, 0x92, 0x9F, 0xFA,
+    0x79, 0xFC, 0xA6, 0xAF, 0xCA, 0x70, 0xAF, 0xC7, 0xAF, 0xD7, 0x0F, 0xC7, 0xAF, 0xE9, 0x6A, 0xFC,
+    0x6A, 0xFF, 0xA6, 0xFC, 0x95, 0x9F, 0xFD, 0x6F, 0xC5, 0x9F, 0xC0, 0xFC, 0x6F, 0xC4, 0x9F, 0xC1,
+    0xFC, 0x95, 0xFC, 0x39, 0xFC, 0x2F, 0xC9, 0x49, 0xFC, 0x29, 0xFC, 0x3A, 0xF9, 0x49, 0xFC, 0x19,
+    0xFC, 0x4F, 0xC9, 0x5F, 0xC0, 0x9F, 0xC5, 0xFC, 0x95, 0xFC, 0x9F, 0xC6, 0xFC, 0x6F, 0xFD, 0x6A,
+    0xFC, 0x6F, 0xFC, 0x69, 0xFD, 0x6F, 0xFA, 0x99, 0x09, 0x9A, 0xFF, 0x6A, 0xFF, 0xFF, 0xFC, 0xA6,
+    0x9F, 0xFF, 0xFF, 0xC9, 0x6F, 0xFF, 0xFF, 0xD5, 0x9F, 0xFF, 0xFF, 0xD9, 0x49, 0xFF, 0xFF, 0xFD,
+    0xA5, 0xFC, 0x1A, 0xFF, 0xFD, 0x96, 0xAE, 0x49, 0xAF, 0xEA, 0xA9, 0x71, 0xAC, 0x77, 0x77, 0x77,
+    0x70, 0x70, 0xAA, 0xAA, 0xA7, 0x71, 0xFC, 0xA7, 0x7A, 0xFD, 0x77, 0xFE, 0xA7, 0x5A, 0xFF, 0x75,
+    0xFF, 0xC9, 0x73, 0xAF, 0xAF, 0xC7, 0x3F, 0xC0, 0xAF, 0x97, 0x1A, 0xFA, 0x09, 0xFC, 0x71, 0xFC,
+    0x91, 0xFC, 0x97, 0xAF, 0xC2, 0xAF, 0xC7, 0xFC, 0x93, 0xFC, 0x95, 0xAF, 0xC4, 0xFC, 0xA5, 0xFC,
+    0xA4, 0x9F, 0xC4, 0xAF, 0xC6, 0xFC, 0xA3, 0xFD, 0x6A, 0xFC, 0x29, 0xFC, 0x97, 0xFC, 0xA1, 0xFD,
+    0x70, 0xFD, 0x09, 0xFD, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xD9, 0x9F, 0xFF, 0xFF, 0xCA, 0x9F, 0xFF,
+    0xFF, 0xCA, 0x9F, 0xFF, 0xFF, 0xCA, 0x9F, 0xFF, 0xFF, 0xCA, 0x9F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD,
+    0x9F, 0xFF, 0xFD, 0x9A, 0xAF, 0xCA, 0xAA, 0xAF, 0xCA, 0xA2, 0xFA, 0x3F, 0x94, 0xFA, 0x3F, 0x94,
+    0xFA, 0x3F, 0x94, 0xFA, 0x3F, 0x94, 0xFA, 0x3F, 0x94, 0xFA, 0x3F, 0x94, 0xFA, 0x3F, 0x94, 0xFA,
+    0x3F, 0x94, 0xFA, 0x3F, 0x94, 0xFA, 0x3F, 0x94, 0xFA, 0x3F, 0x94, 0xFA, 0x3F, 0x94, 0xFA, 0x3F,
+    0x94, 0xFA, 0x3F, 0x94, 0xFA, 0x3F, 0x94, 0xFA, 0x3F, 0x94, 0xFA, 0x3F, 0x94, 0xFA, 0x3F, 0x97,
+    0x74, 0x29, 0x99, 0x94, 0x99, 0x99, 0x5F, 0xA3, 0xF9, 0x4F, 0xA3, 0xF9, 0x4F, 0xA3, 0xF9, 0x4F,
+    0xA3, 0xF9, 0x4F, 0xA3, 0xF9, 0x4F, 0xA3, 0xF9, 0x4F, 0xA3, 0xF9, 0x4F, 0xA3, 0xF9, 0x4F, 0xA3,
+    0xF9, 0x4F, 0xA3, 0xF9, 0x4F, 0xA3, 0xF9, 0x4F, 0xA3, 0xF9, 0x4F, 0xA3, 0xF9, 0x4F, 0xA3, 0xF9,
+    0x4F, 0xA3, 0xF9, 0x4F, 0xA3, 0xF9, 0x4F, 0xA3, 0xF9, 0x4F, 0xA3, 0xF9, 0x19, 0xFF, 0xFF, 0xD9,
+    0xFF, 0xFF, 0xD9, 0xFF, 0xFF, 0xD9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F,
+    0xFF, 0xD9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAF, 0x97, 0x1F,
+    0xC9, 0x71, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xC7, 0x1A, 0xFA, 0x71, 0xAF, 0x72, 0xF7, 0x2F, 0x70,
+    0x9F, 0x70, 0xAF, 0x70, 0xFC, 0x79, 0xFC, 0x96, 0x9F, 0xDA, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xFD,
+    0x9F, 0xFF, 0xD9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD0, 0x73, 0x99, 0x29, 0xAA, 0xFF, 0xD9, 0x1F, 0xFF,
+    0xCA, 0x1F, 0xFF, 0xD0, 0xAF, 0xDA, 0xAA, 0xAA, 0xA9, 0x90, 0x73, 0xFF, 0xEA, 0x73, 0xFF, 0xE7,
+    0x39, 0xFF, 0xDA, 0x73, 0xFC, 0xAA, 0x99, 0x76, 0xF7, 0x72, 0x9E, 0xA7, 0x72, 0xAE, 0x97, 0x72,
+    0xF9, 0x77, 0x19, 0xF7, 0x72, 0xAF, 0x77, 0x2F, 0xA7, 0x71, 0x9F, 0x97, 0x71, 0xAF, 0x77, 0x2F,
+    0xC7, 0x71, 0x9F, 0xA7, 0x71, 0xAF, 0x97, 0x29, 0x5F, 0xC7, 0x3A, 0xCA, 0x29, 0xFC, 0x73, 0xAE,
+    0x90, 0xAF, 0xA7, 0x39, 0xFA, 0xFC, 0x97, 0x4F, 0xFD, 0x97, 0x49, 0xFF, 0xC7, 0x6F, 0xFC, 0x76,
+    0x9F, 0xEA, 0x77, 0xFE, 0x97, 0x79, 0xAA, 0xAA, 0xAA, 0x75, 0x77, 0x74, 0xAF, 0xCA, 0x3A, 0xFA,
+    0x6F, 0xFC, 0x1F, 0xEA, 0x4F, 0xFF, 0xFF, 0xA2, 0xAF, 0xFF, 0xFF, 0xC2, 0xFC, 0x91, 0x9A, 0xFC,
+    0x91, 0x9E, 0xA1, 0xF5, 0xAE, 0x49, 0xE0, 0x9E, 0x96, 0xDA, 0x5E, 0x09, 0xE9, 0x6D, 0xA5, 0xE0,
+    0x9E, 0x96, 0xE9, 0x3A, 0xE1, 0xF4, 0x9F, 0xFF, 0xC1, 0xFF, 0xFF, 0xFD, 0xA1, 0xAF, 0xFF, 0xFF,
+    0xC3, 0xFF, 0xFF, 0xFA, 0x39, 0xFF, 0xC9, 0x0F, 0xEA, 0x6F, 0xE3, 0xAE, 0xA9, 0x71, 0x99, 0x97,
+    0x70, 0x77, 0x9A, 0xEA, 0x77, 0xFE, 0x97, 0x5F, 0xF9, 0x74, 0xAF, 0xA9, 0xAC, 0x97, 0x4F, 0x93,
+    0x97, 0x4F, 0x77, 0x19, 0xF7, 0x71, 0xAE, 0xA7, 0x71, 0xF9, 0x77, 0x1F, 0x97, 0x71, 0xF7, 0x71,
+    0x9F, 0x77, 0x19, 0xF7, 0x71, 0xAE, 0xA7, 0x71, 0xFA, 0x77, 0x1F, 0x97, 0x71, 0xF9, 0x77, 0x1F,
+    0x77, 0x19, 0xF7, 0x71, 0xAF, 0x77, 0x1A, 0xEA, 0x77, 0x1F, 0xA7, 0x70, 0x9F, 0x97, 0x29, 0xD9,
+    0x1F, 0xC7, 0x2A, 0xFF, 0xE7, 0x09, 0xFF, 0xFA, 0x71, 0xFF, 0xF7, 0x3F, 0xFD, 0xA7, 0x4A, 0xFE,
+    0xA7, 0x79, 0xAA, 0xAA, 0x97, 0x77, 0x72, 0x0A, 0xF9, 0x1F, 0xC9, 0x1F, 0xCA, 0x1F, 0xD0, 0x9F,
+    0xD0, 0xAF, 0xD0, 0xAF, 0xD7, 0x77, 0x77, 0x71, 0xAF, 0x91, 0xFC, 0x91, 0xFC, 0xA1, 0xFD, 0x09,
+    0xFD, 0x0A, 0xFD, 0x0A, 0xFD, 0x00, 0x77, 0x4A, 0xEA, 0x49, 0x99, 0x3F, 0xE9, 0x2F, 0x1A, 0xFF,
+    0xA1, 0xF1, 0xF9, 0x0F, 0x90, 0xF1, 0xF1, 0x9F, 0xFA, 0x1A, 0xE9, 0x19, 0xFE, 0x73, 0xAE, 0xA7,
+    0x77, 0xAE, 0xA4, 0x99, 0x93, 0xFE, 0x92, 0xF1, 0xAF, 0xF9, 0x1F, 0x1F, 0x09, 0xF9, 0x9F, 0x09,
+    0xF1, 0x9F, 0xFA, 0x1A, 0xE9, 0x19, 0xFE, 0x72, 0x9A, 0xEA, 0x77, 0x40, 0x77, 0x0A, 0xA9, 0x77,
+    0x1F, 0x77, 0x09, 0xEA, 0x77, 0x0F, 0x77, 0x0A, 0xE9, 0x77, 0x9F, 0x77, 0x0F, 0x97, 0x7A, 0xF6,
+    0xAF, 0xFF, 0xFC, 0x29, 0xFF, 0xFF, 0xD9, 0x1F, 0xFF, 0xFF, 0x09, 0xFA, 0xAA, 0xAA, 0xFF, 0xE7,
+    0x19, 0xF7, 0x70, 0xF7, 0x70, 0xAF, 0xAA, 0xFA, 0x3A, 0xFF, 0xFF, 0xC9, 0x19, 0xFF, 0xFF, 0xE1,
+    0xFF, 0xFF, 0xF0, 0x9C, 0xAA, 0xAA, 0xF9, 0x77, 0xAE, 0xA7, 0x70, 0xF7, 0x70, 0xFA, 0x77, 0x9F,
+    0x77, 0x0F, 0xA7, 0x7A, 0xF7, 0x70, 0x99, 0x99, 0x97, 0x60, 0x77, 0x39, 0x77, 0x5A, 0xD7, 0x72,
+    0x9A, 0xF7, 0x70, 0x9F, 0xE7, 0x6A, 0xFF, 0xC7, 0x4A, 0xFF, 0xC9, 0x72, 0x9F, 0xFD, 0x97, 0x29,
+    0xFF, 0xCA, 0x97, 0x2A, 0xFF, 0xCA, 0x74, 0x9F, 0xFA, 0x76, 0x9F, 0xEA, 0x77, 0x9F, 0xFD, 0xA9,
+    0x73, 0xFF, 0xFE, 0xA9, 0x70, 0x9A, 0xFF, 0xFE, 0xA9, 0x71, 0x9F, 0xFF, 0xE7, 0x39, 0xAF, 0xFE,
+    0x76, 0x9A, 0xFF, 0x77, 0x29, 0xFC, 0x5A, 0xA9, 0x99, 0x72, 0x9A, 0xC5, 0xFF, 0xCA, 0xA9, 0x97,
+    0x29, 0xFF, 0xFF, 0xCA, 0xA9, 0x3F, 0xFF, 0xFF, 0xC5, 0x99, 0x9A, 0xAF, 0xFF, 0xD9, 0x76, 0x99,
+    0x9A, 0xAF, 0xA7, 0x77, 0x10, 0x77, 0x72, 0xAA, 0x77, 0x5F, 0x97, 0x72, 0xFD, 0x97, 0x70, 0xFF,
+    0xA7, 0x7A, 0xFF, 0xA7, 0x7A, 0xFF, 0xC9, 0x76, 0xAF, 0xFC, 0x97, 0x6A, 0xFF, 0xCA, 0x76, 0xAF,
+    0xFC, 0x97, 0x6A, 0xFE, 0xA7, 0x5A, 0xFF, 0x97, 0x19, 0xAF, 0xFE, 0xA6, 0xAF, 0xFF, 0xF9, 0x19,
+    0xAF, 0xFF, 0xEA, 0x94, 0xFF, 0xFD, 0xA9, 0x7F, 0xFE, 0x97, 0x3F, 0xEA, 0x97, 0x6F, 0xA9, 0x77,
+    0x1A, 0xA9, 0x72, 0x99, 0xAA, 0xA7, 0x29, 0x9A, 0xAF, 0xFC, 0x4A, 0xAF, 0xFF, 0xFC, 0xA2, 0xAF,
+    0xFF, 0xFF, 0x2F, 0xFF, 0xDA, 0xA9, 0x99, 0x3A, 0xFA, 0xA9, 0x99, 0x77, 0x77, 0x50,
 };
 
 static const EpdGlyph opendyslexic_14_boldGlyphs[] = {
     { 0, 0, 25, 0, 0, 0, 0 }, //  
-    { 9, 37, 10, 0, 32, 84, 0 }, // !
-    { 18, 10, 21, -2, 26, 45, 84 }, // "
-    { 32, 27, 32, -1, 25, 216, 129 }, // #
-    { 24, 34, 34, 5, 28, 204, 345 }, // $
-    { 25, 26, 32, 5, 23, 163, 549 }, // %
-    { 21, 25, 27, 3, 24, 132, 712 }, // &
-    { 8, 10, 10, 1, 23, 20, 844 }, // '
-    { 13, 40, 15, 1, 30, 130, 864 }, // (
-    { 13, 40, 13, -2, 30, 130, 994 }, // )
-    { 17, 16, 19, 1, 23, 68, 1124 }, // *
-    { 16, 16, 18, 1, 16, 64, 1192 }, // +
-    { 10, 10, 11, 0, 5, 25, 1256 }, // ,
-    { 16, 4, 17, 0, 11, 16, 1281 }, // -
-    { 7, 7, 8, 0, 7, 13, 1297 }, // .
-    { 20, 50, 21, 0, 34, 250, 1310 }, // /
-    { 17, 24, 21, 2, 23, 102, 1560 }, // 0
-    { 15, 23, 19, 2, 23, 87, 1662 }, // 1
-    { 17, 22, 21, 2, 22, 94, 1749 }, // 2
-    { 17, 23, 21, 2, 22, 98, 1843 }, // 3
-    { 18, 24, 22, 2, 23, 108, 1941 }, // 4
-    { 16, 24, 20, 2, 23, 96, 2049 }, // 5
-    { 17, 23, 21, 2, 22, 98, 2145 }, // 6
-    { 16, 23, 20, 2, 23, 92, 2243 }, // 7
-    { 18, 23, 22, 2, 22, 104, 2335 }, // 8
-    { 17, 24, 21, 2, 22, 102, 2439 }, // 9
-    { 8, 20, 9, 0, 20, 40, 2541 }, // :
-    { 10, 25, 11, 0, 19, 63, 2581 }, // ;
-    { 23, 19, 23, -1, 19, 110, 2644 }, // <
-    { 16, 11, 18, 1, 13, 44, 2754 }, // =
-    { 23, 19, 25, 1, 19, 110, 2798 }, // >
-    { 18, 37, 20, 1, 33, 167, 2908 }, // ?
-    { 27, 27, 30, 0, 24, 183, 3075 }, // @
-    { 25, 25, 28, 2, 25, 157, 3258 }, // A
-    { 20, 25, 28, 4, 25, 125, 3415 }, // B
-    { 22, 27, 29, 3, 27, 149, 3540 }, // C
-    { 22, 25, 31, 4, 25, 138, 3689 }, // D
-    { 19, 25, 27, 4, 25, 119, 3827 }, // E
-    { 16, 26, 25, 4, 26, 104, 3946 }, // F
-    { 26, 26, 34, 4, 25, 169, 4050 }, // G
-    { 22, 25, 31, 4, 25, 138, 4219 }, // H
-    { 8, 25, 16, 4, 25, 50, 4357 }, // I
-    { 18, 32, 26, 4, 25, 144, 4407 }, // J
-    { 22, 25, 31, 4, 25, 138, 4551 }, // K
-    { 18, 25, 26, 4, 25, 113, 4689 }, // L
-    { 26, 25, 34, 4, 25, 163, 4802 }, // M
-    { 22, 25, 30, 4, 25, 138, 4965 }, // N
-    { 25, 28, 33, 4, 26, 175, 5103 }, // O
-    { 19, 25, 27, 4, 25, 119, 5278 }, // P
-    { 27, 31, 31, 2, 26, 210, 5397 }, // Q
-    { 20, 25, 28, 4, 25, 125, 5607 }, // R
-    { 23, 27, 31, 4, 25, 156, 5732 }, // S
-    { 23, 25, 31, 4, 25, 144, 5888 }, // T
-    { 22, 26, 30, 4, 25, 143, 6032 }, // U
-    { 25, 25, 33, 4, 25, 157, 6175 }, // V
-    { 33, 25, 42, 4, 25, 207, 6332 }, // W
-    { 24, 25, 33, 4, 25, 150, 6539 }, // X
-    { 23, 25, 31, 4, 25, 144, 6689 }, // Y
-    { 23, 25, 32, 4, 25, 144, 6833 }, // Z
-    { 12, 43, 14, 1, 32, 129, 6977 }, // [
-    { 12, 33, 14, 1, 25, 99, 7106 }, // <backslash>
-    { 12, 43, 14, 1, 32, 129, 7205 }, // ]
-    { 17, 8, 18, 0, 29, 34, 7334 }, // ^
-    { 21, 6, 21, -1, -1, 32, 7368 }, // _
-    { 12, 6, 13, 0, 23, 18, 7400 }, // `
-    { 17, 19, 25, 4, 18, 81, 7418 }, // a
-    { 18, 26, 25, 4, 25, 117, 7499 }, // b
-    { 15, 18, 23, 4, 18, 68, 7616 }, // c
-    { 18, 26, 26, 4, 25, 117, 7684 }, // d
-    { 17, 18, 25, 4, 17, 77, 7801 }, // e
-    { 12, 24, 20, 4, 24, 72, 7878 }, // f
-    { 17, 26, 25, 4, 17, 111, 7950 }, // g
-    { 18, 25, 26, 4, 25, 113, 8061 }, // h
-    { 7, 27, 14, 3, 27, 48, 8174 }, // i
-    { 11, 34, 18, 4, 26, 94, 8222 }, // j
-    { 18, 25, 26, 4, 25, 113, 8316 }, // k
-    { 9, 25, 17, 4, 25, 57, 8429 }, // l
-    { 28, 18, 36, 4, 18, 126, 8486 }, // m
-    { 17, 18, 25, 4, 18, 77, 8612 }, // n
-    { 17, 19, 25, 4, 18, 81, 8689 }, // o
-    { 19, 26, 27, 4, 17, 124, 8770 }, // p
-    { 20, 26, 28, 4, 18, 130, 8894 }, // q
-    { 13, 17, 21, 4, 17, 56, 9024 }, // r
-    { 17, 20, 25, 4, 18, 85, 9080 }, // s
-    { 15, 23, 23, 4, 22, 87, 9165 }, // t
-    { 17, 18, 25, 4, 17, 77, 9252 }, // u
-    { 21, 17, 29, 4, 17, 90, 9329 }, // v
-    { 24, 18, 32, 4, 17, 108, 9419 }, // w
-    { 21, 16, 29, 4, 16, 84, 9527 }, // x
-    { 19, 25, 27, 4, 16, 119, 9611 }, // y
-    { 18, 17, 26, 4, 17, 77, 9730 }, // z
-    { 15, 30, 17, 1, 23, 113, 9807 }, // {
-    { 5, 27, 11, 3, 22, 34, 9920 }, // |
-    { 14, 30, 16, 1, 23, 105, 9954 }, // }
-    { 12, 6, 14, 1, 22, 18, 10059 }, // ~
-    { 0, 0, 25, 0, 0, 0, 10077 }, //  
-    { 9, 37, 22, 6, 32, 84, 10077 }, // ¡
-    { 15, 27, 23, 4, 22, 102, 10161 }, // ¢
-    { 19, 26, 21, 1, 25, 124, 10263 }, // £
-    { 18, 18, 20, 1, 20, 81, 10387 }, // ¤
-    { 22, 26, 23, 0, 23, 143, 10468 }, // ¥
-    { 4, 26, 11, 3, 21, 26, 10611 }, // ¦
-    { 16, 26, 22, 3, 23, 104, 10637 }, // §
-    { 15, 7, 16, 0, 24, 27, 10741 }, // ¨
-    { 14, 13, 20, 3, 28, 46, 10768 }, // ©
-    { 10, 10, 19, 6, 22, 25, 10814 }, // ª
-    { 16, 16, 17, 0, 15, 64, 10839 }, // «
-    { 16, 11, 18, 1, 11, 44, 10903 }, // ¬
-    { 16, 4, 18, 1, 11, 16, 10947 }, // ­
-    { 14, 13, 20, 3, 32, 46, 10963 }, // ®
-    { 13, 5, 15, 1, 22, 17, 11009 }, // ¯
-    { 14, 13, 20, 3, 22, 46, 11026 }, // °
-    { 16, 18, 18, 1, 16, 72, 11072 }, // ±
-    { 8, 11, 10, 1, 24, 22, 11144 }, // ²
-    { 8, 11, 10, 1, 24, 22, 11166 }, // ³
-    { 7, 7, 9, 1, 23, 13, 11188 }, // ´
-    { 18, 22, 25, 3, 17, 99, 11201 }, // µ
-    { 17, 25, 22, 2, 21, 107, 11300 }, // ¶
-    { 7, 7, 8, 0, 14, 13, 11407 }, // ·
-    { 8, 9, 10, 1, 1, 18, 11420 }, // ¸
-    { 7, 12, 9, 1, 25, 21, 11438 }, // ¹
-    { 10, 10, 19, 6, 21, 25, 11459 }, // º
-    { 16, 16, 22, 3, 15, 64, 11484 }, // »
-    { 27, 27, 36, 4, 25, 183, 11548 }, // ¼
-    { 30, 27, 36, 4, 25, 203, 11731 }, // ½
-    { 27, 26, 36, 4, 24, 176, 11934 }, // ¾
-    { 18, 37, 20, 1, 21, 167, 12110 }, // ¿
-    { 25, 33, 28, 2, 33, 207, 12277 }, // À
-    { 25, 38, 28, 2, 38, 238, 12484 }, // Á
-    { 25, 35, 28, 2, 35, 219, 12722 }, // Â
-    { 25, 34, 28, 2, 34, 213, 12941 }, // Ã
-    { 25, 35, 28, 2, 35, 219, 13154 }, // Ä
-    { 25, 35, 28, 2, 35, 219, 13373 }, // Å
-    { 36, 26, 40, 2, 25, 234, 13592 }, // Æ
-    { 22, 35, 29, 3, 27, 193, 13826 }, // Ç
-    { 19, 35, 27, 4, 35, 167, 14019 }, // È
-    { 19, 39, 27, 4, 39, 186, 14186 }, // É
-    { 19, 36, 27, 4, 36, 171, 14372 }, // Ê
-    { 19, 36, 27, 4, 36, 171, 14543 }, // Ë
-    { 13, 36, 16, 0, 36, 117, 14714 }, // Ì
-    { 8, 41, 16, 4, 41, 82, 14831 }, // Í
-    { 16, 38, 17, 0, 38, 152, 14913 }, // Î
-    { 15, 38, 16, 0, 38, 143, 15065 }, // Ï
-    { 27, 25, 31, -1, 25, 169, 15208 }, // Ð
-    { 22, 34, 30, 4, 34, 187, 15377 }, // Ñ
-    { 25, 36, 33, 4, 34, 225, 15564 }, // Ò
-    { 25, 41, 33, 4, 39, 257, 15789 }, // Ó
-    { 25, 38, 33, 4, 36, 238, 16046 }, // Ô
-    { 25, 37, 33, 4, 35, 232, 16284 }, // Õ
-    { 25, 38, 33, 4, 36, 238, 16516 }, // Ö
-    { 17, 10, 18, 0, 12, 43, 16754 }, // ×
-    { 41, 59, 38, -4, 43, 605, 16797 }, // Ø
-    { 22, 36, 30, 4, 35, 198, 17402 }, // Ù
-    { 22, 41, 30, 4, 40, 226, 17600 }, // Ú
-    { 22, 38, 30, 4, 37, 209, 17826 }, // Û
-    { 22, 38, 30, 4, 37, 209, 18035 }, // Ü
-    { 23, 42, 31, 4, 42, 242, 18244 }, // Ý
-    { 14, 24, 16, 1, 24, 84, 18486 }, // Þ
-    { 18, 26, 20, 1, 24, 117, 18570 }, // ß
-    { 17, 27, 25, 4, 26, 115, 18687 }, // à
-    { 17, 31, 25, 4, 30, 132, 18802 }, // á
-    { 17, 28, 25, 4, 27, 119, 18934 }, // â
-    { 17, 27, 25, 4, 26, 115, 19053 }, // ã
-    { 17, 28, 25, 4, 27, 119, 19168 }, // ä
-    { 17, 28, 25, 4, 27, 119, 19287 }, // å
-    { 29, 19, 37, 4, 18, 138, 19406 }, // æ
-    { 15, 25, 23, 4, 18, 94, 19544 }, // ç
-    { 17, 30, 25, 4, 29, 128, 19638 }, // è
-    { 17, 35, 25, 4, 34, 149, 19766 }, // é
-    { 17, 32, 25, 4, 31, 136, 19915 }, // ê
-    { 17, 32, 25, 4, 31, 136, 20051 }, // ë
-    { 12, 25, 14, 0, 25, 75, 20187 }, // ì
-    { 7, 30, 14, 4, 30, 53, 20262 }, // í
-    { 17, 27, 17, -1, 27, 115, 20315 }, // î
-    { 14, 25, 15, 0, 25, 88, 20430 }, // ï
-    { 23, 26, 23, -1, 24, 150, 20518 }, // ð
-    { 17, 27, 25, 4, 27, 115, 20668 }, // ñ
-    { 17, 27, 25, 4, 26, 115, 20783 }, // ò
-    { 17, 32, 25, 4, 31, 136, 20898 }, // ó
-    { 17, 29, 25, 4, 28, 124, 21034 }, // ô
-    { 17, 28, 25, 4, 27, 119, 21158 }, // õ
-    { 17, 29, 25, 4, 28, 124, 21277 }, // ö
-    { 22, 21, 26, 2, 20, 116, 21401 }, // ÷
-    { 19, 51, 25, 3, 35, 243, 21517 }, // ø
-    { 17, 27, 25, 4, 26, 115, 21760 }, // ù
-    { 17, 32, 25, 4, 31, 136, 21875 }, // ú
-    { 17, 29, 25, 4, 28, 124, 22011 }, // û
-    { 17, 29, 25, 4, 28, 124, 22135 }, // ü
-    { 19, 43, 27, 4, 34, 205, 22259 }, // ý
-    { 14, 31, 16, 1, 25, 109, 22464 }, // þ
-    { 19, 39, 27, 4, 30, 186, 22573 }, // ÿ
-    { 25, 35, 28, 2, 35, 219, 22759 }, // Ā
-    { 17, 29, 25, 4, 28, 124, 22978 }, // ā
-    { 25, 35, 28, 2, 35, 219, 23102 }, // Ă
-    { 17, 28, 25, 4, 27, 119, 23321 }, // ă
-    { 25, 33, 28, 2, 25, 207, 23440 }, // Ą
-    { 19, 27, 25, 4, 18, 129, 23647 }, // ą
-    { 22, 36, 29, 3, 36, 198, 23776 }, // Ć
-    { 15, 25, 23, 4, 25, 94, 23974 }, // ć
-    { 22, 38, 29, 3, 38, 209, 24068 }, // Ĉ
-    { 17, 27, 23, 3, 27, 115, 24277 }, // ĉ
-    { 22, 36, 29, 3, 36, 198, 24392 }, // Ċ
-    { 15, 26, 23, 4, 26, 98, 24590 }, // ċ
-    { 22, 38, 29, 3, 38, 209, 24688 }, // Č
-    { 16, 28, 23, 4, 28, 112, 24897 }, // č
-    { 22, 37, 31, 4, 37, 204, 25009 }, // Ď
-    { 23, 26, 28, 4, 25, 150, 25213 }, // ď
-    { 27, 25, 31, -1, 25, 169, 25363 }, // Đ
-    { 22, 26, 27, 4, 25, 143, 25532 }, // đ
-    { 19, 36, 27, 4, 36, 171, 25675 }, // Ē
-    { 17, 32, 25, 4, 31, 136, 25846 }, // ē
-    { 19, 36, 27, 4, 36, 171, 25982 }, // Ĕ
-    { 17, 32, 25, 4, 31, 136, 26153 }, // ĕ
-    { 19, 36, 27, 4, 36, 171, 26289 }, // Ė
-    { 17, 32, 25, 4, 31, 136, 26460 }, // ė
-    { 19, 32, 27, 4, 25, 152, 26596 }, // Ę
-    { 17, 29, 25, 4, 17, 124, 26748 }, // ę
-    { 19, 38, 27, 4, 38, 181, 26872 }, // Ě
-    { 17, 34, 25, 4, 33, 145, 27053 }, // ě
-    { 26, 40, 34, 4, 39, 260, 27198 }, // Ĝ
-    { 18, 39, 25, 4, 30, 176, 27458 }, // ĝ
-    { 26, 38, 34, 4, 37, 247, 27634 }, // Ğ
-    { 17, 37, 25, 4, 28, 158, 27881 }, // ğ
-    { 26, 39, 34, 4, 38, 254, 28039 }, // Ġ
-    { 17, 37, 25, 4, 28, 158, 28293 }, // ġ
-    { 26, 44, 34, 4, 43, 286, 28451 }, // Ģ
-    { 17, 39, 25, 4, 30, 166, 28737 }, // ģ
-    { 22, 37, 31, 4, 37, 204, 28903 }, // Ĥ
-    { 22, 35, 26, 0, 35, 193, 29107 }, // ĥ
-    { 25, 25, 31, 3, 25, 157, 29300 }, // Ħ
-    { 22, 25, 26, 0, 25, 138, 29457 }, // ħ
-    { 11, 38, 16, 2, 38, 105, 29595 }, // Ĩ
-    { 12, 27, 14, 1, 27, 81, 29700 }, // ĩ
-    { 16, 37, 16, -1, 37, 148, 29781 }, // Ī
-    { 17, 27, 16, -2, 27, 115, 29929 }, // ī
-    { 9, 32, 16, 3, 25, 72, 30044 }, // Į
-    { 8, 36, 14, 3, 27, 72, 30116 }, // į
-    { 8, 38, 16, 4, 38, 76, 30188 }, // İ
-    { 6, 17, 14, 4, 17, 26, 30264 }, // ı
-    { 23, 36, 46, 11, 25, 207, 30290 }, // Ĳ
-    { 18, 34, 22, 3, 27, 153, 30497 }, // ĳ
-    { 20, 43, 26, 4, 36, 215, 30650 }, // Ĵ
-    { 17, 37, 21, 3, 29, 158, 30865 }, // ĵ
-    { 22, 40, 31, 4, 40, 220, 31023 }, // Ķ
-    { 18, 40, 26, 4, 25, 180, 31243 }, // ķ
-    { 15, 16, 19, 2, 16, 60, 31423 }, // ĸ
-    { 18, 34, 26, 4, 34, 153, 31483 }, // Ĺ
-    { 9, 38, 17, 4, 38, 86, 31636 }, // ĺ
-    { 20, 39, 26, 2, 39, 195, 31722 }, // Ļ
-    { 11, 41, 17, 2, 25, 113, 31917 }, // ļ
-    { 18, 25, 26, 4, 25, 113, 32030 }, // Ľ
-    { 14, 30, 19, 4, 30, 105, 32143 }, // ľ
-    { 18, 25, 26, 4, 25, 113, 32248 }, // Ŀ
-    { 14, 25, 19, 4, 25, 88, 32361 }, // ŀ
-    { 32, 45, 26, -8, 35, 360, 32449 }, // Ł
-    { 22, 25, 17, -6, 25, 138, 32809 }, // ł
-    { 22, 35, 30, 4, 35, 193, 32947 }, // Ń
-    { 17, 29, 25, 4, 29, 124, 33140 }, // ń
-    { 22, 37, 30, 4, 25, 204, 33264 }, // Ņ
-    { 17, 30, 25, 4, 18, 128, 33468 }, // ņ
-    { 22, 38, 30, 4, 38, 209, 33596 }, // Ň
-    { 18, 31, 25, 4, 31, 140, 33805 }, // ň
-    { 17, 30, 25, 4, 30, 128, 33945 }, // ŉ
-    { 22, 32, 30, 4, 25, 176, 34073 }, // Ŋ
-    { 17, 24, 25, 4, 18, 102, 34249 }, // ŋ
-    { 25, 38, 33, 4, 36, 238, 34351 }, // Ō
-    { 17, 29, 25, 4, 28, 124, 34589 }, // ō
-    { 25, 38, 33, 4, 36, 238, 34713 }, // Ŏ
-    { 17, 29, 25, 4, 28, 124, 34951 }, // ŏ
-    { 27, 37, 33, 4, 35, 250, 35075 }, // Ő
-    { 25, 28, 28, 2, 27, 175, 35325 }, // ő
-    { 35, 28, 40, 4, 26, 245, 35500 }, // Œ
-    { 29, 19, 34, 4, 18, 138, 35745 }, // œ
-    { 20, 34, 28, 4, 34, 170, 35883 }, // Ŕ
-    { 13, 25, 21, 4, 25, 82, 36053 }, // ŕ
-    { 20, 40, 28, 4, 40, 200, 36135 }, // Ŗ
-    { 14, 30, 21, 3, 30, 105, 36335 }, // ŗ
-    { 20, 37, 28, 4, 37, 185, 36440 }, // Ř
-    { 17, 27, 21, 1, 27, 115, 36625 }, // ř
-    { 23, 36, 31, 4, 34, 207, 36740 }, // Ś
-    { 17, 27, 25, 4, 25, 115, 36947 }, // ś
-    { 23, 37, 31, 4, 35, 213, 37062 }, // Ŝ
-    { 17, 29, 25, 4, 27, 124, 37275 }, // ŝ
-    { 23, 33, 31, 4, 25, 190, 37399 }, // Ş
-    { 17, 26, 25, 4, 18, 111, 37589 }, // ş
-    { 23, 38, 31, 4, 36, 219, 37700 }, // Š
-    { 17, 30, 25, 4, 28, 128, 37919 }, // š
-    { 23, 33, 31, 4, 25, 190, 38047 }, // Ţ
-    { 15, 29, 23, 4, 22, 109, 38237 }, // ţ
-    { 23, 37, 31, 4, 37, 213, 38346 }, // Ť
-    { 19, 28, 24, 4, 27, 133, 38559 }, // ť
-    { 23, 25, 31, 4, 25, 144, 38692 }, // Ŧ
-    { 16, 23, 23, 3, 22, 92, 38836 }, // ŧ
-    { 22, 38, 30, 4, 37, 209, 38928 }, // Ũ
-    { 17, 29, 25, 4, 28, 124, 39137 }, // ũ
-    { 22, 38, 30, 4, 37, 209, 39261 }, // Ū
-    { 17, 28, 25, 4, 27, 119, 39470 }, // ū
-    { 22, 38, 30, 4, 37, 209, 39589 }, // Ŭ
-    { 17, 29, 25, 4, 28, 124, 39798 }, // ŭ
-    { 22, 40, 30, 4, 39, 220, 39922 }, // Ů
-    { 17, 31, 25, 4, 30, 132, 40142 }, // ů
-    { 26, 37, 31, 4, 36, 241, 40274 }, // Ű
-    { 25, 27, 28, 2, 26, 169, 40515 }, // ű
-    { 22, 32, 30, 4, 25, 176, 40684 }, // Ų
-    { 17, 26, 25, 4, 17, 111, 40860 }, // ų
-    { 33, 37, 42, 4, 37, 306, 40971 }, // Ŵ
-    { 24, 31, 32, 4, 30, 186, 41277 }, // ŵ
-    { 23, 39, 31, 4, 39, 225, 41463 }, // Ŷ
-    { 19, 40, 27, 4, 31, 190, 41688 }, // ŷ
-    { 23, 39, 31, 4, 39, 225, 41878 }, // Ÿ
-    { 23, 34, 32, 4, 34, 196, 42103 }, // Ź
-    { 18, 28, 26, 4, 28, 126, 42299 }, // ź
-    { 23, 34, 32, 4, 34, 196, 42425 }, // Ż
-    { 18, 28, 26, 4, 28, 126, 42621 }, // ż
-    { 23, 36, 32, 4, 36, 207, 42747 }, // Ž
-    { 18, 30, 26, 4, 30, 135, 42954 }, // ž
-    { 11, 24, 18, 3, 24, 66, 43089 }, // ſ
-    { 26, 31, 33, 4, 29, 202, 43155 }, // Ơ
-    { 19, 22, 25, 4, 21, 105, 43357 }, // ơ
-    { 24, 25, 27, -1, 25, 150, 43462 }, // Ƥ
-    { 19, 31, 27, 4, 22, 148, 43612 }, // ƥ
-    { 15, 22, 17, 1, 21, 83, 43760 }, // Ʃ
-    { 25, 25, 31, 2, 25, 157, 43843 }, // Ƭ
-    { 15, 29, 23, 4, 28, 109, 44000 }, // ƭ
-    { 23, 30, 31, 4, 25, 173, 44109 }, // Ʈ
-    { 25, 32, 30, 4, 31, 200, 44282 }, // Ư
-    { 20, 23, 25, 4, 22, 115, 44482 }, // ư
-    { 12, 6, 13, 0, 23, 18, 44597 }, // ̀
-    { 7, 7, 9, 1, 23, 13, 44615 }, // ́
-    { 16, 8, 17, 0, 1, 32, 44628 }, // ̂
-    { 12, 6, 14, 1, 22, 18, 44660 }, // ̃
-    { 16, 5, 18, 1, 21, 20, 44678 }, // ̄
-    { 21, 5, 22, 0, 27, 27, 44698 }, // ̅
-    { 14, 6, 16, 1, 21, 21, 44725 }, // ̆
-    { 7, 7, 12, 4, 24, 13, 44746 }, // ̇
-    { 14, 6, 15, 0, 21, 21, 44759 }, // ̈
-    { 6, 7, 13, 6, 19, 11, 44780 }, // ̉
-    { 8, 8, 10, 1, 23, 16, 44791 }, // ̊
-    { 25, 6, 27, 1, 23, 38, 44807 }, // ̋
-    { 16, 8, 17, 0, 23, 32, 44845 }, // ̌
-    { 25, 6, 19, -7, 23, 38, 44877 }, // ̏
-    { 10, 10, 11, 0, 23, 25, 44915 }, // ̒
-    { 10, 10, 11, 0, 22, 25, 44940 }, // ̓
-    { 10, 10, 10, -1, 22, 25, 44965 }, // ̔
-    { 7, 9, 9, 1, 0, 16, 44990 }, // ̘
-    { 7, 9, 9, 1, 0, 16, 45006 }, // ̙
-    { 14, 9, 16, 1, 24, 32, 45022 }, // ̚
-    { 7, 9, 8, 0, 20, 16, 45054 }, // ̛
-    { 5, 9, 7, 1, 0, 12, 45070 }, // ̜
-    { 8, 7, 10, 1, 4, 14, 45082 }, // ̝
-    { 8, 6, 10, 1, 0, 12, 45096 }, // ̞
-    { 7, 7, 10, 2, -2, 13, 45108 }, // ̟
-    { 16, 5, 18, 1, -3, 20, 45121 }, // ̠
-    { 8, 7, 9, 0, 3, 14, 45141 }, // ̣
-    { 14, 6, 15, 0, -2, 21, 45155 }, // ̤
-    { 8, 8, 10, 1, 23, 16, 45176 }, // ̥
-    { 10, 10, 11, 0, 5, 25, 45192 }, // ̦
-    { 8, 9, 10, 1, 1, 18, 45217 }, // ̧
-    { 9, 10, 11, 1, 1, 23, 45235 }, // ̨
-    { 6, 10, 8, 1, -1, 15, 45258 }, // ̩
-    { 13, 7, 14, 0, 0, 23, 45273 }, // ̪
-    { 18, 9, 18, -1, 1, 41, 45296 }, // ̬
-    { 18, 9, 18, -1, 1, 41, 45337 }, // ̭
-    { 13, 8, 15, 1, 25, 26, 45378 }, // ̰
-    { 15, 5, 17, 1, 24, 19, 45404 }, // ̱
-    { 16, 5, 17, 0, -1, 20, 45423 }, // ̲
-    { 13, 8, 15, 1, 25, 26, 45443 }, // ̴
-    { 16, 4, 17, 0, 11, 16, 45469 }, // ̵
-    { 5, 10, 7, 1, 0, 13, 45485 }, // ̹
-    { 13, 9, 14, 0, 1, 30, 45498 }, // ̺
-    { 12, 10, 13, 0, 1, 30, 45528 }, // ̻
-    { 11, 8, 13, 1, 1, 22, 45558 }, // ̼
-    { 9, 7, 12, 2, 22, 16, 45580 }, // ̽
-    { 12, 6, 14, 1, 22, 18, 45596 }, // ͂
-    { 6, 8, 14, 7, 26, 12, 45614 }, // ̓
-    { 14, 22, 16, 1, 37, 77, 45626 }, // ̈́
-    { 13, 7, 14, 0, 24, 23, 45703 }, // ͆
-    { 16, 11, 18, 1, 0, 44, 45726 }, // ͇
-    { 13, 9, 15, 1, 1, 30, 45770 }, // ͈
-    { 11, 9, 13, 1, -1, 25, 45800 }, // ͉
-    { 15, 23, 17, 1, 31, 87, 45825 }, // ͊
-    { 26, 22, 28, 1, 33, 143, 45912 }, // ͋
-    { 18, 17, 31, 12, 17, 77, 46055 }, // ͌
-    { 15, 7, 18, 2, -3, 27, 46132 }, // ͍
-    { 5, 5, 7, 1, 4, 7, 46159 }, // ͎
-    { 25, 8, 27, 1, 2, 50, 46166 }, // ͜
-    { 25, 8, 27, 1, 24, 50, 46216 }, // ͡
-    { 31, 9, 33, 1, -1, 70, 46266 }, // ͢
-    { 25, 25, 28, 2, 25, 157, 46336 }, // Α
-    { 20, 25, 28, 4, 25, 125, 46493 }, // Β
-    { 15, 26, 17, 1, 23, 98, 46618 }, // Γ
-    { 23, 23, 25, 1, 22, 133, 46716 }, // Δ
-    { 19, 25, 27, 4, 25, 119, 46849 }, // Ε
-    { 23, 25, 32, 4, 25, 144, 46968 }, // Ζ
-    { 22, 25, 31, 4, 25, 138, 47112 }, // Η
-    { 25, 28, 33, 4, 26, 175, 47250 }, // Θ
-    { 8, 25, 16, 4, 25, 50, 47425 }, // Ι
-    { 22, 25, 31, 4, 25, 138, 47475 }, // Κ
-    { 25, 25, 33, 4, 25, 157, 47613 }, // Λ
-    { 26, 25, 34, 4, 25, 163, 47770 }, // Μ
-    { 22, 25, 30, 4, 25, 138, 47933 }, // Ν
-    { 20, 23, 22, 1, 22, 115, 48071 }, // Ξ
-    { 25, 28, 33, 4, 26, 175, 48186 }, // Ο
-    { 16, 23, 18, 1, 22, 92, 48361 }, // Π
-    { 19, 25, 27, 4, 25, 119, 48453 }, // Ρ
-    { 15, 22, 17, 1, 21, 83, 48572 }, // Σ
-    { 23, 25, 31, 4, 25, 144, 48655 }, // Τ
-    { 23, 25, 31, 4, 25, 144, 48799 }, // Υ
-    { 30, 32, 40, 5, 26, 240, 48943 }, // Φ
-    { 24, 25, 33, 4, 25, 150, 49183 }, // Χ
-    { 22, 27, 24, 1, 24, 149, 49333 }, // Ψ
-    { 23, 25, 25, 1, 23, 144, 49482 }, // Ω
-    { 20, 21, 28, 4, 18, 105, 49626 }, // α
-    { 18, 36, 20, 1, 29, 162, 49731 }, // β
-    { 18, 27, 20, 1, 17, 122, 49893 }, // γ
-    { 18, 27, 20, 1, 25, 122, 50015 }, // δ
-    { 14, 16, 16, 1, 15, 56, 50137 }, // ε
-    { 16, 27, 17, 0, 22, 108, 50193 }, // ζ
-    { 19, 27, 21, 1, 19, 129, 50301 }, // η
-    { 17, 24, 19, 1, 23, 102, 50430 }, // θ
-    { 10, 21, 18, 4, 20, 53, 50532 }, // ι
-    { 15, 17, 21, 3, 17, 64, 50585 }, // κ
-    { 19, 26, 25, 3, 25, 124, 50649 }, // λ
-    { 18, 22, 25, 3, 17, 99, 50773 }, // μ
-    { 18, 18, 20, 1, 17, 81, 50872 }, // ν
-    { 14, 27, 16, 1, 22, 95, 50953 }, // ξ
-    { 17, 19, 25, 4, 18, 81, 51048 }, // ο
-    { 19, 17, 21, 1, 16, 81, 51129 }, // π
-    { 19, 24, 21, 1, 17, 114, 51210 }, // ρ
-    { 14, 22, 16, 1, 22, 77, 51324 }, // ς
-    { 20, 19, 28, 4, 18, 95, 51401 }, // σ
-    { 17, 17, 19, 1, 16, 73, 51496 }, // τ
-    { 15, 19, 17, 1, 17, 72, 51569 }, // υ
-    { 25, 38, 33, 4, 31, 238, 51641 }, // φ
-    { 23, 24, 24, 0, 17, 138, 51879 }, // χ
-    { 17, 33, 19, 1, 23, 141, 52017 }, // ψ
-    { 23, 17, 25, 1, 15, 98, 52158 }, // ω
-    { 25, 34, 28, 2, 25, 213, 52256 }, // Ạ
-    { 17, 30, 25, 4, 18, 128, 52469 }, // ạ
-    { 25, 36, 28, 2, 36, 225, 52597 }, // Ả
-    { 17, 29, 25, 4, 28, 124, 52822 }, // ả
-    { 25, 44, 28, 2, 44, 275, 52946 }, // Ấ
-    { 18, 32, 25, 4, 31, 144, 53221 }, // ấ
-    { 28, 38, 28, -1, 38, 266, 53365 }, // Ầ
-    { 25, 34, 25, -4, 33, 213, 53631 }, // ầ
-    { 25, 45, 28, 2, 45, 282, 53844 }, // Ẩ
-    { 19, 34, 25, 4, 33, 162, 54126 }, // ẩ
-    { 25, 42, 28, 2, 42, 263, 54288 }, // Ẫ
-    { 17, 34, 25, 4, 33, 145, 54551 }, // ẫ
-    { 25, 44, 28, 2, 35, 275, 54696 }, // Ậ
-    { 17, 39, 25, 4, 27, 166, 54971 }, // ậ
-    { 25, 45, 28, 2, 45, 282, 55137 }, // Ắ
-    { 17, 38, 25, 4, 37, 162, 55419 }, // ắ
-    { 25, 45, 28, 2, 45, 282, 55581 }, // Ằ
-    { 17, 38, 25, 4, 37, 162, 55863 }, // ằ
-    { 25, 46, 28, 2, 46, 288, 56025 }, // Ẳ
-    { 17, 40, 25, 4, 39, 170, 56313 }, // ẳ
-    { 25, 45, 28, 2, 45, 282, 56483 }, // Ẵ
-    { 17, 38, 25, 4, 37, 162, 56765 }, // ẵ
-    { 25, 44, 28, 2, 35, 275, 56927 }, // Ặ
-    { 17, 39, 25, 4, 27, 166, 57202 }, // ặ
-    { 19, 37, 27, 4, 25, 176, 57368 }, // Ẹ
-    { 17, 30, 25, 4, 17, 128, 57544 }, // ẹ
-    { 19, 37, 27, 4, 37, 176, 57672 }, // Ẻ
-    { 17, 32, 25, 4, 31, 136, 57848 }, // ẻ
-    { 19, 36, 27, 4, 36, 171, 57984 }, // Ẽ
-    { 17, 32, 25, 4, 31, 136, 58155 }, // ẽ
-    { 23, 36, 28, 4, 36, 207, 58291 }, // Ế
-    { 23, 32, 28, 4, 31, 184, 58498 }, // ế
-    { 25, 39, 27, -2, 39, 244, 58682 }, // Ề
-    { 23, 35, 25, -2, 34, 202, 58926 }, // ề
-    { 19, 41, 27, 4, 41, 195, 59128 }, // Ể
-    { 19, 38, 25, 4, 37, 181, 59323 }, // ể
-    { 19, 42, 27, 4, 42, 200, 59504 }, // Ễ
-    { 17, 39, 25, 4, 38, 166, 59704 }, // ễ
-    { 19, 48, 27, 4, 36, 228, 59870 }, // Ệ
-    { 17, 44, 25, 4, 31, 187, 60098 }, // ệ
-    { 8, 38, 16, 4, 38, 76, 60285 }, // Ỉ
-    { 7, 27, 14, 4, 27, 48, 60361 }, // ỉ
-    { 8, 38, 16, 4, 25, 76, 60409 }, // Ị
-    { 8, 39, 14, 3, 27, 78, 60485 }, // ị
-    { 25, 40, 33, 4, 26, 250, 60563 }, // Ọ
-    { 17, 30, 25, 4, 18, 128, 60813 }, // ọ
-    { 25, 39, 33, 4, 37, 244, 60941 }, // Ỏ
-    { 17, 30, 25, 4, 29, 128, 61185 }, // ỏ
-    { 26, 38, 33, 4, 36, 247, 61313 }, // Ố
-    { 21, 31, 26, 4, 30, 163, 61560 }, // ố
-    { 28, 41, 33, 1, 39, 287, 61723 }, // Ồ
-    { 23, 34, 25, -2, 33, 196, 62010 }, // ồ
-    { 25, 42, 33, 4, 40, 263, 62206 }, // Ổ
-    { 19, 35, 25, 4, 34, 167, 62469 }, // ổ
-    { 25, 44, 33, 4, 42, 275, 62636 }, // Ỗ
-    { 17, 35, 25, 4, 34, 149, 62911 }, // ỗ
-    { 25, 50, 33, 4, 36, 313, 63060 }, // Ộ
-    { 17, 41, 25, 4, 28, 175, 63373 }, // ộ
-    { 26, 38, 33, 4, 36, 247, 63548 }, // Ớ
-    { 19, 29, 25, 4, 28, 138, 63795 }, // ớ
-    { 26, 38, 33, 4, 36, 247, 63933 }, // Ờ
-    { 19, 29, 25, 4, 28, 138, 64180 }, // ờ
-    { 26, 39, 33, 4, 37, 254, 64318 }, // Ở
-    { 19, 30, 25, 4, 29, 143, 64572 }, // ở
-    { 26, 38, 33, 4, 36, 247, 64715 }, // Ỡ
-    { 19, 29, 25, 4, 28, 138, 64962 }, // ỡ
-    { 26, 43, 33, 4, 29, 280, 65100 }, // Ợ
-    { 19, 33, 25, 4, 21, 157, 65380 }, // ợ
-    { 22, 38, 30, 4, 25, 209, 65537 }, // Ụ
-    { 17, 31, 25, 4, 17, 132, 65746 }, // ụ
-    { 22, 39, 30, 4, 38, 215, 65878 }, // Ủ
-    { 17, 29, 25, 4, 28, 124, 66093 }, // ủ
-    { 25, 38, 30, 4, 37, 238, 66217 }, // Ứ
-    { 20, 28, 25, 4, 27, 140, 66455 }, // ứ
-    { 25, 38, 30, 4, 37, 238, 66595 }, // Ừ
-    { 20, 28, 25, 4, 27, 140, 66833 }, // ừ
-    { 25, 39, 30, 4, 38, 244, 66973 }, // Ử
-    { 20, 29, 25, 4, 28, 145, 67217 }, // ử
-    { 25, 38, 30, 4, 37, 238, 67362 }, // Ữ
-    { 20, 29, 25, 4, 28, 145, 67600 }, // ữ
-    { 25, 44, 30, 4, 31, 275, 67745 }, // Ự
-    { 20, 36, 25, 4, 22, 180, 68020 }, // ự
-    { 23, 38, 31, 4, 38, 219, 68200 }, // Ỳ
-    { 19, 38, 27, 4, 29, 181, 68419 }, // ỳ
-    { 23, 40, 31, 4, 25, 230, 68600 }, // Ỵ
-    { 21, 27, 27, 4, 16, 142, 68830 }, // ỵ
-    { 23, 40, 31, 4, 40, 230, 68972 }, // Ỷ
-    { 19, 40, 27, 4, 31, 190, 69202 }, // ỷ
-    { 23, 40, 31, 4, 40, 230, 69392 }, // Ỹ
-    { 19, 40, 27, 4, 31, 190, 69622 }, // ỹ
-    { 0, 0, 19, 0, 0, 0, 69812 }, //  
-    { 0, 0, 34, 0, 0, 0, 69812 }, //  
-    { 0, 0, 19, 0, 0, 0, 69812 }, //  
-    { 0, 0, 34, 0, 0, 0, 69812 }, //  
-    { 0, 0, 14, 0, 0, 0, 69812 }, //  
-    { 0, 0, 12, 0, 0, 0, 69812 }, //  
-    { 0, 0, 10, 0, 0, 0, 69812 }, //  
-    { 0, 0, 21, 0, 0, 0, 69812 }, //  
-    { 0, 0, 8, 0, 0, 0, 69812 }, //  
-    { 0, 0, 11, 0, 0, 0, 69812 }, //  
-    { 0, 0, 9, 0, 0, 0, 69812 }, //  
-    { 0, 0, 5, 0, 0, 0, 69812 }, // ​
-    { 0, 0, 1, 0, 0, 0, 69812 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 69812 }, // ‍
-    { 0, 0, 1, 0, 0, 0, 69812 }, // ‎
-    { 0, 0, 1, 0, 0, 0, 69812 }, // ‏
-    { 16, 4, 17, 0, 11, 16, 69812 }, // ‐
-    { 16, 4, 17, 0, 11, 16, 69828 }, // ‑
-    { 24, 4, 21, -4, 11, 24, 69844 }, // ‒
-    { 21, 6, 23, 1, 11, 32, 69868 }, // –
-    { 31, 6, 33, 1, 11, 47, 69900 }, // —
-    { 31, 6, 33, 1, 11, 47, 69947 }, // ―
-    { 14, 27, 18, 3, 22, 95, 69994 }, // ‖
-    { 24, 10, 21, -4, -2, 60, 70089 }, // ‗
-    { 10, 10, 13, 1, 26, 25, 70149 }, // ‘
-    { 10, 10, 13, 1, 26, 25, 70174 }, // ’
-    { 10, 10, 11, 0, 5, 25, 70199 }, // ‚
-    { 10, 10, 13, 1, 26, 25, 70224 }, // ‛
-    { 20, 10, 22, 1, 26, 50, 70249 }, // “
-    { 20, 10, 22, 1, 26, 50, 70299 }, // ”
-    { 10, 10, 11, 0, 5, 25, 70349 }, // „
-    { 20, 10, 22, 1, 26, 50, 70374 }, // ‟
-    { 18, 41, 24, 3, 31, 185, 70424 }, // †
-    { 17, 41, 25, 5, 30, 175, 70609 }, // ‡
-    { 23, 23, 20, -4, 26, 133, 70784 }, // •
-    { 10, 10, 18, 4, 13, 25, 70917 }, // ‣
-    { 7, 7, 18, 5, 7, 13, 70942 }, // ․
-    { 7, 7, 18, 5, 7, 13, 70955 }, // ‥
-    { 27, 7, 28, 0, 7, 48, 70968 }, // …
-    { 4, 4, 16, 6, 11, 4, 71016 }, // ‧
-    { 0, 0, 32, 0, 0, 0, 71020 }, //  
-    { 21, 26, 33, 6, 23, 137, 71020 }, // ‰
-    { 10, 10, 16, 5, 26, 25, 71157 }, // ′
-    { 19, 10, 25, 5, 26, 48, 71182 }, // ″
-    { 23, 9, 26, 2, 25, 52, 71230 }, // ‴
-    { 8, 9, 12, 2, 24, 18, 71282 }, // ‵
-    { 14, 9, 15, 0, 24, 32, 71300 }, // ‶
-    { 24, 9, 19, -6, 25, 54, 71332 }, // ‷
-    { 17, 7, 19, 1, 25, 30, 71386 }, // ‸
-    { 10, 16, 12, 1, 16, 40, 71416 }, // ‹
-    { 10, 16, 12, 1, 16, 40, 71456 }, // ›
-    { 32, 38, 40, 5, 30, 304, 71496 }, // ※
-    { 9, 37, 18, 4, 32, 84, 71800 }, // ‼
-    { 18, 46, 25, 3, 39, 207, 71884 }, // ‽
-    { 16, 4, 17, 0, 24, 16, 72091 }, // ‾
-    { 14, 7, 16, 1, 20, 25, 72107 }, // ‿
-    { 21, 22, 21, -1, 28, 116, 72132 }, // ⁂
-    { 20, 25, 36, 8, 23, 125, 72248 }, // ⁄
-    { 36, 37, 44, 4, 33, 333, 72373 }, // ⁇
-    { 31, 38, 35, 2, 33, 295, 72706 }, // ⁈
-    { 24, 38, 24, -1, 33, 228, 73001 }, // ⁉
-    { 22, 51, 27, 2, 35, 281, 73229 }, // ⁒
-    { 0, 0, 136, 0, 0, 0, 73510 }, //  
-    { 8, 12, 10, 1, 24, 24, 73510 }, // ⁰
-    { 9, 11, 11, 1, 25, 25, 73534 }, // ⁴
-    { 8, 12, 10, 1, 25, 24, 73559 }, // ⁵
-    { 9, 11, 11, 1, 24, 25, 73583 }, // ⁶
-    { 9, 13, 11, 1, 25, 30, 73608 }, // ⁷
-    { 9, 11, 11, 1, 24, 25, 73638 }, // ⁸
-    { 9, 12, 11, 1, 24, 27, 73663 }, // ⁹
-    { 17, 18, 25, 4, 18, 77, 73690 }, // ⁿ
-    { 9, 12, 11, 1, 7, 27, 73767 }, // ₀
-    { 8, 12, 10, 1, 7, 24, 73794 }, // ₁
-    { 9, 12, 11, 1, 7, 27, 73818 }, // ₂
-    { 9, 12, 11, 1, 7, 27, 73845 }, // ₃
-    { 9, 12, 11, 1, 7, 27, 73872 }, // ₄
-    { 8, 12, 10, 1, 7, 24, 73899 }, // ₅
-    { 9, 12, 11, 1, 7, 27, 73923 }, // ₆
-    { 9, 12, 11, 1, 7, 27, 73950 }, // ₇
-    { 9, 12, 11, 1, 7, 27, 73977 }, // ₈
-    { 9, 13, 11, 1, 7, 30, 74004 }, // ₉
-    { 13, 40, 15, 1, 30, 130, 74034 }, // ₍
-    { 13, 40, 13, -2, 30, 130, 74164 }, // ₎
-    { 21, 39, 29, 4, 33, 205, 74294 }, // ₡
-    { 22, 27, 29, 3, 27, 149, 74499 }, // ₢
-    { 20, 27, 21, 0, 26, 135, 74648 }, // ₤
-    { 32, 25, 32, -1, 25, 200, 74783 }, // ₦
-    { 25, 25, 27, 1, 25, 157, 74983 }, // ₧
-    { 32, 27, 38, 3, 25, 216, 75140 }, // ₨
-    { 25, 26, 26, 0, 26, 163, 75356 }, // ₩
-    { 23, 23, 31, 4, 23, 133, 75519 }, // ₪
-    { 22, 25, 21, -2, 24, 138, 75652 }, // ₫
-    { 20, 28, 22, 1, 24, 140, 75790 }, // €
-    { 23, 25, 31, 4, 25, 144, 75930 }, // ₮
-    { 29, 25, 29, -1, 25, 182, 76074 }, // ₱
-    { 26, 39, 34, 4, 33, 254, 76256 }, // ₲
-    { 30, 24, 36, 5, 22, 180, 76510 }, // ₴
-    { 15, 24, 20, 4, 21, 90, 76690 }, // ₵
-    { 24, 26, 31, 3, 26, 156, 76780 }, // ₸
-    { 16, 24, 20, 2, 23, 96, 76936 }, // ₹
-    { 18, 22, 20, 1, 20, 99, 77032 }, // ₺
-    { 21, 24, 24, 1, 23, 126, 77131 }, // ₼
-    { 26, 25, 27, -3, 25, 163, 77257 }, // ₽
-    { 20, 20, 21, 0, 18, 100, 77420 }, // ←
-    { 21, 20, 23, 1, 19, 105, 77520 }, // ↑
-    { 20, 20, 22, 1, 18, 100, 77625 }, // →
-    { 21, 20, 23, 1, 19, 105, 77725 }, // ↓
-    { 24, 17, 30, 3, 16, 102, 77830 }, // ↔
-    { 17, 24, 23, 3, 26, 102, 77932 }, // ↕
-    { 17, 16, 23, 3, 15, 68, 78034 }, // ↖
-    { 17, 16, 19, 1, 15, 68, 78102 }, // ↗
-    { 17, 16, 19, 1, 16, 68, 78170 }, // ↘
-    { 17, 16, 19, 1, 16, 68, 78238 }, // ↙
-    { 23, 20, 29, 3, 19, 115, 78306 }, // ⇐
-    { 25, 24, 31, 3, 23, 150, 78421 }, // ⇑
-    { 23, 20, 29, 3, 19, 115, 78571 }, // ⇒
-    { 25, 24, 31, 3, 22, 150, 78686 }, // ⇓
-    { 26, 20, 32, 3, 19, 130, 78836 }, // ⇔
-    { 20, 25, 26, 3, 14, 125, 78966 }, // ⇕
-    { 18, 26, 20, 1, 24, 117, 79091 }, // ∂
-    { 30, 30, 33, 1, 27, 225, 79208 }, // ∅
-    { 23, 23, 25, 1, 22, 133, 79433 }, // ∆
-    { 19, 23, 22, 1, 21, 110, 79566 }, // ∏
-    { 19, 23, 22, 1, 22, 110, 79676 }, // ∐
-    { 15, 22, 17, 1, 21, 83, 79786 }, // ∑
-    { 16, 5, 18, 1, 11, 20, 79869 }, // −
-    { 24, 26, 28, 2, 24, 156, 79889 }, // √
-    { 25, 17, 27, 1, 19, 107, 80045 }, // ∞
-    { 23, 31, 25, 1, 23, 179, 80152 }, // ∫
-    { 8, 20, 10, 1, 20, 40, 80331 }, // ∶
-    { 18, 17, 42, 12, 17, 77, 80371 }, // ≈
-    { 22, 26, 36, 7, 23, 143, 80448 }, // ≠
-    { 25, 25, 25, -1, 21, 157, 80591 }, // ≤
-    { 24, 26, 26, 1, 22, 156, 80748 }, // ≥
+    { 9, 37, 10, 0, 32, 50, 0 }, // !
+    { 18, 10, 21, -2, 26, 39, 50 }, // "
+    { 32, 27, 32, -1, 25, 118, 89 }, // #
+    { 24, 34, 34, 5, 28, 120, 207 }, // $
+    { 25, 26, 32, 5, 23, 105, 327 }, // %
+    { 21, 25, 27, 3, 24, 90, 432 }, // &
+    { 8, 10, 10, 1, 23, 24, 522 }, // '
+    { 13, 40, 15, 1, 30, 68, 546 }, // (
+    { 13, 40, 13, -2, 30, 74, 614 }, // )
+    { 17, 16, 19, 1, 23, 49, 688 }, // *
+    { 16, 16, 18, 1, 16, 47, 737 }, // +
+    { 10, 10, 11, 0, 5, 20, 784 }, // ,
+    { 16, 4, 17, 0, 11, 17, 804 }, // -
+    { 7, 7, 8, 0, 7, 13, 821 }, // .
+    { 20, 50, 21, 0, 34, 105, 834 }, // /
+    { 17, 24, 21, 2, 23, 84, 939 }, // 0
+    { 15, 23, 19, 2, 23, 56, 1023 }, // 1
+    { 17, 22, 21, 2, 22, 57, 1079 }, // 2
+    { 17, 23, 21, 2, 22, 65, 1136 }, // 3
+    { 18, 24, 22, 2, 23, 66, 1201 }, // 4
+    { 16, 24, 20, 2, 23, 69, 1267 }, // 5
+    { 17, 23, 21, 2, 22, 67, 1336 }, // 6
+    { 16, 23, 20, 2, 23, 59, 1403 }, // 7
+    { 18, 23, 22, 2, 22, 73, 1462 }, // 8
+    { 17, 24, 21, 2, 22, 74, 1535 }, // 9
+    { 8, 20, 9, 0, 20, 30, 1609 }, // :
+    { 10, 25, 11, 0, 19, 44, 1639 }, // ;
+    { 23, 19, 23, -1, 19, 65, 1683 }, // <
+    { 16, 11, 18, 1, 13, 37, 1748 }, // =
+    { 23, 19, 25, 1, 19, 64, 1785 }, // >
+    { 18, 37, 20, 1, 33, 88, 1849 }, // ?
+    { 27, 27, 30, 0, 24, 123, 1937 }, // @
+    { 25, 25, 28, 2, 25, 92, 2060 }, // A
+    { 20, 25, 28, 4, 25, 94, 2152 }, // B
+    { 22, 27, 29, 3, 27, 80, 2246 }, // C
+    { 22, 25, 31, 4, 25, 95, 2326 }, // D
+    { 19, 25, 27, 4, 25, 78, 2421 }, // E
+    { 16, 26, 25, 4, 26, 70, 2499 }, // F
+    { 26, 26, 34, 4, 25, 105, 2569 }, // G
+    { 22, 25, 31, 4, 25, 98, 2674 }, // H
+    { 8, 25, 16, 4, 25, 42, 2772 }, // I
+    { 18, 32, 26, 4, 25, 82, 2814 }, // J
+    { 22, 25, 31, 4, 25, 91, 2896 }, // K
+    { 18, 25, 26, 4, 25, 66, 2987 }, // L
+    { 26, 25, 34, 4, 25, 133, 3053 }, // M
+    { 22, 25, 30, 4, 25, 108, 3186 }, // N
+    { 25, 28, 33, 4, 26, 112, 3294 }, // O
+    { 19, 25, 27, 4, 25, 77, 3406 }, // P
+    { 27, 31, 31, 2, 26, 126, 3483 }, // Q
+    { 20, 25, 28, 4, 25, 87, 3609 }, // R
+    { 23, 27, 31, 4, 25, 91, 3696 }, // S
+    { 23, 25, 31, 4, 25, 78, 3787 }, // T
+    { 22, 26, 30, 4, 25, 93, 3865 }, // U
+    { 25, 25, 33, 4, 25, 95, 3958 }, // V
+    { 33, 25, 42, 4, 25, 136, 4053 }, // W
+    { 24, 25, 33, 4, 25, 90, 4189 }, // X
+    { 23, 25, 31, 4, 25, 83, 4279 }, // Y
+    { 23, 25, 32, 4, 25, 88, 4362 }, // Z
+    { 12, 43, 14, 1, 32, 73, 4450 }, // [
+    { 12, 33, 14, 1, 25, 53, 4523 }, // <backslash>
+    { 12, 43, 14, 1, 32, 76, 4576 }, // ]
+    { 17, 8, 18, 0, 29, 20, 4652 }, // ^
+    { 21, 6, 21, -1, -1, 18, 4672 }, // _
+    { 12, 6, 13, 0, 23, 10, 4690 }, // `
+    { 17, 19, 25, 4, 18, 62, 4700 }, // a
+    { 18, 26, 25, 4, 25, 74, 4762 }, // b
+    { 15, 18, 23, 4, 18, 45, 4836 }, // c
+    { 18, 26, 26, 4, 25, 77, 4881 }, // d
+    { 17, 18, 25, 4, 17, 55, 4958 }, // e
+    { 12, 24, 20, 4, 24, 47, 5013 }, // f
+    { 17, 26, 25, 4, 17, 85, 5060 }, // g
+    { 18, 25, 26, 4, 25, 73, 5145 }, // h
+    { 7, 27, 14, 3, 27, 35, 5218 }, // i
+    { 11, 34, 18, 4, 26, 54, 5253 }, // j
+    { 18, 25, 26, 4, 25, 67, 5307 }, // k
+    { 9, 25, 17, 4, 25, 38, 5374 }, // l
+    { 28, 18, 36, 4, 18, 89, 5412 }, // m
+    { 17, 18, 25, 4, 18, 56, 5501 }, // n
+    { 17, 19, 25, 4, 18, 57, 5557 }, // o
+    { 19, 26, 27, 4, 17, 82, 5614 }, // p
+    { 20, 26, 28, 4, 18, 84, 5696 }, // q
+    { 13, 17, 21, 4, 17, 35, 5780 }, // r
+    { 17, 20, 25, 4, 18, 57, 5815 }, // s
+    { 15, 23, 23, 4, 22, 53, 5872 }, // t
+    { 17, 18, 25, 4, 17, 58, 5925 }, // u
+    { 21, 17, 29, 4, 17, 53, 5983 }, // v
+    { 24, 18, 32, 4, 17, 76, 6036 }, // w
+    { 21, 16, 29, 4, 16, 55, 6112 }, // x
+    { 19, 25, 27, 4, 16, 71, 6167 }, // y
+    { 18, 17, 26, 4, 17, 51, 6238 }, // z
+    { 15, 30, 17, 1, 23, 70, 6289 }, // {
+    { 5, 27, 11, 3, 22, 40, 6359 }, // |
+    { 14, 30, 16, 1, 23, 62, 6399 }, // }
+    { 12, 6, 14, 1, 22, 22, 6461 }, // ~
+    { 0, 0, 25, 0, 0, 0, 6483 }, //  
+    { 9, 37, 22, 6, 32, 50, 6483 }, // ¡
+    { 15, 27, 23, 4, 22, 71, 6533 }, // ¢
+    { 19, 26, 21, 1, 25, 66, 6604 }, // £
+    { 18, 18, 20, 1, 20, 53, 6670 }, // ¤
+    { 22, 26, 23, 0, 23, 86, 6723 }, // ¥
+    { 4, 26, 11, 3, 21, 31, 6809 }, // ¦
+    { 16, 26, 22, 3, 23, 73, 6840 }, // §
+    { 15, 7, 16, 0, 24, 30, 6913 }, // ¨
+    { 14, 13, 20, 3, 28, 44, 6943 }, // ©
+    { 10, 10, 19, 6, 22, 25, 6987 }, // ª
+    { 16, 16, 17, 0, 15, 51, 7012 }, // «
+    { 16, 11, 18, 1, 11, 31, 7063 }, // ¬
+    { 16, 4, 18, 1, 11, 17, 7094 }, // ­
+    { 14, 13, 20, 3, 32, 52, 7111 }, // ®
+    { 13, 5, 15, 1, 22, 11, 7163 }, // ¯
+    { 14, 13, 20, 3, 22, 35, 7174 }, // °
+    { 16, 18, 18, 1, 16, 49, 7209 }, // ±
+    { 8, 11, 10, 1, 24, 21, 7258 }, // ²
+    { 8, 11, 10, 1, 24, 25, 7279 }, // ³
+    { 7, 7, 9, 1, 23, 11, 7304 }, // ´
+    { 18, 22, 25, 3, 17, 65, 7315 }, // µ
+    { 17, 25, 22, 2, 21, 86, 7380 }, // ¶
+    { 7, 7, 8, 0, 14, 15, 7466 }, // ·
+    { 8, 9, 10, 1, 1, 17, 7481 }, // ¸
+    { 7, 12, 9, 1, 25, 22, 7498 }, // ¹
+    { 10, 10, 19, 6, 21, 23, 7520 }, // º
+    { 16, 16, 22, 3, 15, 52, 7543 }, // »
+    { 27, 27, 36, 4, 25, 114, 7595 }, // ¼
+    { 30, 27, 36, 4, 25, 122, 7709 }, // ½
+    { 27, 26, 36, 4, 24, 121, 7831 }, // ¾
+    { 18, 37, 20, 1, 21, 90, 7952 }, // ¿
+    { 25, 33, 28, 2, 33, 110, 8042 }, // À
+    { 25, 38, 28, 2, 38, 118, 8152 }, // Á
+    { 25, 35, 28, 2, 35, 121, 8270 }, // Â
+    { 25, 34, 28, 2, 34, 119, 8391 }, // Ã
+    { 25, 35, 28, 2, 35, 129, 8510 }, // Ä
+    { 25, 35, 28, 2, 35, 119, 8639 }, // Å
+    { 36, 26, 40, 2, 25, 145, 8758 }, // Æ
+    { 22, 35, 29, 3, 27, 102, 8903 }, // Ç
+    { 19, 35, 27, 4, 35, 95, 9005 }, // È
+    { 19, 39, 27, 4, 39, 100, 9100 }, // É
+    { 19, 36, 27, 4, 36, 103, 9200 }, // Ê
+    { 19, 36, 27, 4, 36, 113, 9303 }, // Ë
+    { 13, 36, 16, 0, 36, 57, 9416 }, // Ì
+    { 8, 41, 16, 4, 41, 56, 9473 }, // Í
+    { 16, 38, 17, 0, 38, 77, 9529 }, // Î
+    { 15, 38, 16, 0, 38, 87, 9606 }, // Ï
+    { 27, 25, 31, -1, 25, 108, 9693 }, // Ð
+    { 22, 34, 30, 4, 34, 135, 9801 }, // Ñ
+    { 25, 36, 33, 4, 34, 130, 9936 }, // Ò
+    { 25, 41, 33, 4, 39, 138, 10066 }, // Ó
+    { 25, 38, 33, 4, 36, 140, 10204 }, // Ô
+    { 25, 37, 33, 4, 35, 140, 10344 }, // Õ
+    { 25, 38, 33, 4, 36, 150, 10484 }, // Ö
+    { 17, 10, 18, 0, 12, 36, 10634 }, // ×
+    { 41, 59, 38, -4, 43, 278, 10670 }, // Ø
+    { 22, 36, 30, 4, 35, 114, 10948 }, // Ù
+    { 22, 41, 30, 4, 40, 120, 11062 }, // Ú
+    { 22, 38, 30, 4, 37, 125, 11182 }, // Û
+    { 22, 38, 30, 4, 37, 130, 11307 }, // Ü
+    { 23, 42, 31, 4, 42, 114, 11437 }, // Ý
+    { 14, 24, 16, 1, 24, 59, 11551 }, // Þ
+    { 18, 26, 20, 1, 24, 86, 11610 }, // ß
+    { 17, 27, 25, 4, 26, 77, 11696 }, // à
+    { 17, 31, 25, 4, 30, 80, 11773 }, // á
+    { 17, 28, 25, 4, 27, 82, 11853 }, // â
+    { 17, 27, 25, 4, 26, 84, 11935 }, // ã
+    { 17, 28, 25, 4, 27, 94, 12019 }, // ä
+    { 17, 28, 25, 4, 27, 81, 12113 }, // å
+    { 29, 19, 37, 4, 18, 98, 12194 }, // æ
+    { 15, 25, 23, 4, 18, 62, 12292 }, // ç
+    { 17, 30, 25, 4, 29, 75, 12354 }, // è
+    { 17, 35, 25, 4, 34, 80, 12429 }, // é
+    { 17, 32, 25, 4, 31, 83, 12509 }, // ê
+    { 17, 32, 25, 4, 31, 91, 12592 }, // ë
+    { 12, 25, 14, 0, 25, 37, 12683 }, // ì
+    { 7, 30, 14, 4, 30, 36, 12720 }, // í
+    { 17, 27, 17, -1, 27, 59, 12756 }, // î
+    { 14, 25, 15, 0, 25, 55, 12815 }, // ï
+    { 23, 26, 23, -1, 24, 88, 12870 }, // ð
+    { 17, 27, 25, 4, 27, 80, 12958 }, // ñ
+    { 17, 27, 25, 4, 26, 71, 13038 }, // ò
+    { 17, 32, 25, 4, 31, 76, 13109 }, // ó
+    { 17, 29, 25, 4, 28, 79, 13185 }, // ô
+    { 17, 28, 25, 4, 27, 80, 13264 }, // õ
+    { 17, 29, 25, 4, 28, 90, 13344 }, // ö
+    { 22, 21, 26, 2, 20, 62, 13434 }, // ÷
+    { 19, 51, 25, 3, 35, 135, 13496 }, // ø
+    { 17, 27, 25, 4, 26, 74, 13631 }, // ù
+    { 17, 32, 25, 4, 31, 79, 13705 }, // ú
+    { 17, 29, 25, 4, 28, 80, 13784 }, // û
+    { 17, 29, 25, 4, 28, 90, 13864 }, // ü
+    { 19, 43, 27, 4, 34, 97, 13954 }, // ý
+    { 14, 31, 16, 1, 25, 72, 14051 }, // þ
+    { 19, 39, 27, 4, 30, 108, 14123 }, // ÿ
+    { 25, 35, 28, 2, 35, 119, 14231 }, // Ā
+    { 17, 29, 25, 4, 28, 83, 14350 }, // ā
+    { 25, 35, 28, 2, 35, 121, 14433 }, // Ă
+    { 17, 28, 25, 4, 27, 84, 14554 }, // ă
+    { 25, 33, 28, 2, 25, 113, 14638 }, // Ą
+    { 19, 27, 25, 4, 18, 81, 14751 }, // ą
+    { 22, 36, 29, 3, 36, 99, 14832 }, // Ć
+    { 15, 25, 23, 4, 25, 58, 14931 }, // ć
+    { 22, 38, 29, 3, 38, 105, 14989 }, // Ĉ
+    { 17, 27, 23, 3, 27, 67, 15094 }, // ĉ
+    { 22, 36, 29, 3, 36, 104, 15161 }, // Ċ
+    { 15, 26, 23, 4, 26, 63, 15265 }, // ċ
+    { 22, 38, 29, 3, 38, 109, 15328 }, // Č
+    { 16, 28, 23, 4, 28, 65, 15437 }, // č
+    { 22, 37, 31, 4, 37, 125, 15502 }, // Ď
+    { 23, 26, 28, 4, 25, 93, 15627 }, // ď
+    { 27, 25, 31, -1, 25, 108, 15720 }, // Đ
+    { 22, 26, 27, 4, 25, 88, 15828 }, // đ
+    { 19, 36, 27, 4, 36, 101, 15916 }, // Ē
+    { 17, 32, 25, 4, 31, 80, 16017 }, // ē
+    { 19, 36, 27, 4, 36, 102, 16097 }, // Ĕ
+    { 17, 32, 25, 4, 31, 82, 16199 }, // ĕ
+    { 19, 36, 27, 4, 36, 100, 16281 }, // Ė
+    { 17, 32, 25, 4, 31, 81, 16381 }, // ė
+    { 19, 32, 27, 4, 25, 93, 16462 }, // Ę
+    { 17, 29, 25, 4, 17, 78, 16555 }, // ę
+    { 19, 38, 27, 4, 38, 106, 16633 }, // Ě
+    { 17, 34, 25, 4, 33, 86, 16739 }, // ě
+    { 26, 40, 34, 4, 39, 143, 16825 }, // Ĝ
+    { 18, 39, 25, 4, 30, 115, 16968 }, // ĝ
+    { 26, 38, 34, 4, 37, 137, 17083 }, // Ğ
+    { 17, 37, 25, 4, 28, 111, 17220 }, // ğ
+    { 26, 39, 34, 4, 38, 135, 17331 }, // Ġ
+    { 17, 37, 25, 4, 28, 107, 17466 }, // ġ
+    { 26, 44, 34, 4, 43, 153, 17573 }, // Ģ
+    { 17, 39, 25, 4, 30, 114, 17726 }, // ģ
+    { 22, 37, 31, 4, 37, 124, 17840 }, // Ĥ
+    { 22, 35, 26, 0, 35, 105, 17964 }, // ĥ
+    { 25, 25, 31, 3, 25, 99, 18069 }, // Ħ
+    { 22, 25, 26, 0, 25, 83, 18168 }, // ħ
+    { 11, 38, 16, 2, 38, 65, 18251 }, // Ĩ
+    { 12, 27, 14, 1, 27, 49, 18316 }, // ĩ
+    { 16, 37, 16, -1, 37, 81, 18365 }, // Ī
+    { 17, 27, 16, -2, 27, 53, 18446 }, // ī
+    { 9, 32, 16, 3, 25, 55, 18499 }, // Į
+    { 8, 36, 14, 3, 27, 52, 18554 }, // į
+    { 8, 38, 16, 4, 38, 59, 18606 }, // İ
+    { 6, 17, 14, 4, 17, 22, 18665 }, // ı
+    { 23, 36, 46, 11, 25, 142, 18687 }, // Ĳ
+    { 18, 34, 22, 3, 27, 93, 18829 }, // ĳ
+    { 20, 43, 26, 4, 36, 110, 18922 }, // Ĵ
+    { 17, 37, 21, 3, 29, 86, 19032 }, // ĵ
+    { 22, 40, 31, 4, 40, 127, 19118 }, // Ķ
+    { 18, 40, 26, 4, 25, 98, 19245 }, // ķ
+    { 15, 16, 19, 2, 16, 47, 19343 }, // ĸ
+    { 18, 34, 26, 4, 34, 82, 19390 }, // Ĺ
+    { 9, 38, 17, 4, 38, 51, 19472 }, // ĺ
+    { 20, 39, 26, 2, 39, 97, 19523 }, // Ļ
+    { 11, 41, 17, 2, 25, 65, 19620 }, // ļ
+    { 18, 25, 26, 4, 25, 75, 19685 }, // Ľ
+    { 14, 30, 19, 4, 30, 61, 19760 }, // ľ
+    { 18, 25, 26, 4, 25, 76, 19821 }, // Ŀ
+    { 14, 25, 19, 4, 25, 60, 19897 }, // ŀ
+    { 32, 45, 26, -8, 35, 160, 19957 }, // Ł
+    { 22, 25, 17, -6, 25, 71, 20117 }, // ł
+    { 22, 35, 30, 4, 35, 128, 20188 }, // Ń
+    { 17, 29, 25, 4, 29, 74, 20316 }, // ń
+    { 22, 37, 30, 4, 25, 140, 20390 }, // Ņ
+    { 17, 30, 25, 4, 18, 84, 20530 }, // ņ
+    { 22, 38, 30, 4, 38, 137, 20614 }, // Ň
+    { 18, 31, 25, 4, 31, 89, 20751 }, // ň
+    { 17, 30, 25, 4, 30, 79, 20840 }, // ŉ
+    { 22, 32, 30, 4, 25, 128, 20919 }, // Ŋ
+    { 17, 24, 25, 4, 18, 71, 21047 }, // ŋ
+    { 25, 38, 33, 4, 36, 139, 21118 }, // Ō
+    { 17, 29, 25, 4, 28, 80, 21257 }, // ō
+    { 25, 38, 33, 4, 36, 140, 21337 }, // Ŏ
+    { 17, 29, 25, 4, 28, 80, 21477 }, // ŏ
+    { 27, 37, 33, 4, 35, 140, 21557 }, // Ő
+    { 25, 28, 28, 2, 27, 91, 21697 }, // ő
+    { 35, 28, 40, 4, 26, 145, 21788 }, // Œ
+    { 29, 19, 34, 4, 18, 95, 21933 }, // œ
+    { 20, 34, 28, 4, 34, 103, 22028 }, // Ŕ
+    { 13, 25, 21, 4, 25, 47, 22131 }, // ŕ
+    { 20, 40, 28, 4, 40, 123, 22178 }, // Ŗ
+    { 14, 30, 21, 3, 30, 61, 22301 }, // ŗ
+    { 20, 37, 28, 4, 37, 115, 22362 }, // Ř
+    { 17, 27, 21, 1, 27, 63, 22477 }, // ř
+    { 23, 36, 31, 4, 34, 110, 22540 }, // Ś
+    { 17, 27, 25, 4, 25, 71, 22650 }, // ś
+    { 23, 37, 31, 4, 35, 119, 22721 }, // Ŝ
+    { 17, 29, 25, 4, 27, 76, 22840 }, // ŝ
+    { 23, 33, 31, 4, 25, 109, 22916 }, // Ş
+    { 17, 26, 25, 4, 18, 74, 23025 }, // ş
+    { 23, 38, 31, 4, 36, 120, 23099 }, // Š
+    { 17, 30, 25, 4, 28, 76, 23219 }, // š
+    { 23, 33, 31, 4, 25, 100, 23295 }, // Ţ
+    { 15, 29, 23, 4, 22, 69, 23395 }, // ţ
+    { 23, 37, 31, 4, 37, 110, 23464 }, // Ť
+    { 19, 28, 24, 4, 27, 71, 23574 }, // ť
+    { 23, 25, 31, 4, 25, 81, 23645 }, // Ŧ
+    { 16, 23, 23, 3, 22, 62, 23726 }, // ŧ
+    { 22, 38, 30, 4, 37, 125, 23788 }, // Ũ
+    { 17, 29, 25, 4, 28, 85, 23913 }, // ũ
+    { 22, 38, 30, 4, 37, 121, 23998 }, // Ū
+    { 17, 28, 25, 4, 27, 83, 24119 }, // ū
+    { 22, 38, 30, 4, 37, 125, 24202 }, // Ŭ
+    { 17, 29, 25, 4, 28, 82, 24327 }, // ŭ
+    { 22, 40, 30, 4, 39, 123, 24409 }, // Ů
+    { 17, 31, 25, 4, 30, 84, 24532 }, // ů
+    { 26, 37, 31, 4, 36, 126, 24616 }, // Ű
+    { 25, 27, 28, 2, 26, 92, 24742 }, // ű
+    { 22, 32, 30, 4, 25, 109, 24834 }, // Ų
+    { 17, 26, 25, 4, 17, 78, 24943 }, // ų
+    { 33, 37, 42, 4, 37, 169, 25021 }, // Ŵ
+    { 24, 31, 32, 4, 30, 106, 25190 }, // ŵ
+    { 23, 39, 31, 4, 39, 115, 25296 }, // Ŷ
+    { 19, 40, 27, 4, 31, 99, 25411 }, // ŷ
+    { 23, 39, 31, 4, 39, 125, 25510 }, // Ÿ
+    { 23, 34, 32, 4, 34, 108, 25635 }, // Ź
+    { 18, 28, 26, 4, 28, 68, 25743 }, // ź
+    { 23, 34, 32, 4, 34, 112, 25811 }, // Ż
+    { 18, 28, 26, 4, 28, 73, 25923 }, // ż
+    { 23, 36, 32, 4, 36, 119, 25996 }, // Ž
+    { 18, 30, 26, 4, 30, 78, 26115 }, // ž
+    { 11, 24, 18, 3, 24, 44, 26193 }, // ſ
+    { 26, 31, 33, 4, 29, 126, 26237 }, // Ơ
+    { 19, 22, 25, 4, 21, 72, 26363 }, // ơ
+    { 24, 25, 27, -1, 25, 101, 26435 }, // Ƥ
+    { 19, 31, 27, 4, 22, 100, 26536 }, // ƥ
+    { 15, 22, 17, 1, 21, 57, 26636 }, // Ʃ
+    { 25, 25, 31, 2, 25, 82, 26693 }, // Ƭ
+    { 15, 29, 23, 4, 28, 64, 26775 }, // ƭ
+    { 23, 30, 31, 4, 25, 90, 26839 }, // Ʈ
+    { 25, 32, 30, 4, 31, 109, 26929 }, // Ư
+    { 20, 23, 25, 4, 22, 72, 27038 }, // ư
+    { 12, 6, 13, 0, 23, 10, 27110 }, // ̀
+    { 7, 7, 9, 1, 23, 11, 27120 }, // ́
+    { 16, 8, 17, 0, 1, 21, 27131 }, // ̂
+    { 12, 6, 14, 1, 22, 22, 27152 }, // ̃
+    { 16, 5, 18, 1, 21, 18, 27174 }, // ̄
+    { 21, 5, 22, 0, 27, 19, 27192 }, // ̅
+    { 14, 6, 16, 1, 21, 19, 27211 }, // ̆
+    { 7, 7, 12, 4, 24, 14, 27230 }, // ̇
+    { 14, 6, 15, 0, 21, 26, 27244 }, // ̈
+    { 6, 7, 13, 6, 19, 11, 27270 }, // ̉
+    { 8, 8, 10, 1, 23, 17, 27281 }, // ̊
+    { 25, 6, 27, 1, 23, 20, 27298 }, // ̋
+    { 16, 8, 17, 0, 23, 21, 27318 }, // ̌
+    { 25, 6, 19, -7, 23, 19, 27339 }, // ̏
+    { 10, 10, 11, 0, 23, 21, 27358 }, // ̒
+    { 10, 10, 11, 0, 22, 21, 27379 }, // ̓
+    { 10, 10, 10, -1, 22, 21, 27400 }, // ̔
+    { 7, 9, 9, 1, 0, 13, 27421 }, // ̘
+    { 7, 9, 9, 1, 0, 13, 27434 }, // ̙
+    { 14, 9, 16, 1, 24, 21, 27447 }, // ̚
+    { 7, 9, 8, 0, 20, 13, 27468 }, // ̛
+    { 5, 9, 7, 1, 0, 13, 27481 }, // ̜
+    { 8, 7, 10, 1, 4, 13, 27494 }, // ̝
+    { 8, 6, 10, 1, 0, 11, 27507 }, // ̞
+    { 7, 7, 10, 2, -2, 12, 27518 }, // ̟
+    { 16, 5, 18, 1, -3, 19, 27530 }, // ̠
+    { 8, 7, 9, 0, 3, 14, 27549 }, // ̣
+    { 14, 6, 15, 0, -2, 26, 27563 }, // ̤
+    { 8, 8, 10, 1, 23, 17, 27589 }, // ̥
+    { 10, 10, 11, 0, 5, 20, 27606 }, // ̦
+    { 8, 9, 10, 1, 1, 17, 27626 }, // ̧
+    { 9, 10, 11, 1, 1, 17, 27643 }, // ̨
+    { 6, 10, 8, 1, -1, 16, 27660 }, // ̩
+    { 13, 7, 14, 0, 0, 19, 27676 }, // ̪
+    { 18, 9, 18, -1, 1, 24, 27695 }, // ̬
+    { 18, 9, 18, -1, 1, 21, 27719 }, // ̭
+    { 13, 8, 15, 1, 25, 26, 27740 }, // ̰
+    { 15, 5, 17, 1, 24, 11, 27766 }, // ̱
+    { 16, 5, 17, 0, -1, 18, 27777 }, // ̲
+    { 13, 8, 15, 1, 25, 26, 27795 }, // ̴
+    { 16, 4, 17, 0, 11, 17, 27821 }, // ̵
+    { 5, 10, 7, 1, 0, 13, 27838 }, // ̹
+    { 13, 9, 14, 0, 1, 18, 27851 }, // ̺
+    { 12, 10, 13, 0, 1, 30, 27869 }, // ̻
+    { 11, 8, 13, 1, 1, 29, 27899 }, // ̼
+    { 9, 7, 12, 2, 22, 17, 27928 }, // ̽
+    { 12, 6, 14, 1, 22, 22, 27945 }, // ͂
+    { 6, 8, 14, 7, 26, 13, 27967 }, // ̓
+    { 14, 22, 16, 1, 37, 46, 27980 }, // ̈́
+    { 13, 7, 14, 0, 24, 19, 28026 }, // ͆
+    { 16, 11, 18, 1, 0, 37, 28045 }, // ͇
+    { 13, 9, 15, 1, 1, 24, 28082 }, // ͈
+    { 11, 9, 13, 1, -1, 19, 28106 }, // ͉
+    { 15, 23, 17, 1, 31, 54, 28125 }, // ͊
+    { 26, 22, 28, 1, 33, 79, 28179 }, // ͋
+    { 18, 17, 31, 12, 17, 54, 28258 }, // ͌
+    { 15, 7, 18, 2, -3, 16, 28312 }, // ͍
+    { 5, 5, 7, 1, 4, 8, 28328 }, // ͎
+    { 25, 8, 27, 1, 2, 30, 28336 }, // ͜
+    { 25, 8, 27, 1, 24, 33, 28366 }, // ͡
+    { 31, 9, 33, 1, -1, 41, 28399 }, // ͢
+    { 25, 25, 28, 2, 25, 92, 28440 }, // Α
+    { 20, 25, 28, 4, 25, 94, 28532 }, // Β
+    { 15, 26, 17, 1, 23, 65, 28626 }, // Γ
+    { 23, 23, 25, 1, 22, 89, 28691 }, // Δ
+    { 19, 25, 27, 4, 25, 78, 28780 }, // Ε
+    { 23, 25, 32, 4, 25, 88, 28858 }, // Ζ
+    { 22, 25, 31, 4, 25, 98, 28946 }, // Η
+    { 25, 28, 33, 4, 26, 126, 29044 }, // Θ
+    { 8, 25, 16, 4, 25, 42, 29170 }, // Ι
+    { 22, 25, 31, 4, 25, 91, 29212 }, // Κ
+    { 25, 25, 33, 4, 25, 95, 29303 }, // Λ
+    { 26, 25, 34, 4, 25, 133, 29398 }, // Μ
+    { 22, 25, 30, 4, 25, 108, 29531 }, // Ν
+    { 20, 23, 22, 1, 22, 61, 29639 }, // Ξ
+    { 25, 28, 33, 4, 26, 112, 29700 }, // Ο
+    { 16, 23, 18, 1, 22, 86, 29812 }, // Π
+    { 19, 25, 27, 4, 25, 77, 29898 }, // Ρ
+    { 15, 22, 17, 1, 21, 57, 29975 }, // Σ
+    { 23, 25, 31, 4, 25, 78, 30032 }, // Τ
+    { 23, 25, 31, 4, 25, 83, 30110 }, // Υ
+    { 30, 32, 40, 5, 26, 145, 30193 }, // Φ
+    { 24, 25, 33, 4, 25, 90, 30338 }, // Χ
+    { 22, 27, 24, 1, 24, 97, 30428 }, // Ψ
+    { 23, 25, 25, 1, 23, 100, 30525 }, // Ω
+    { 20, 21, 28, 4, 18, 69, 30625 }, // α
+    { 18, 36, 20, 1, 29, 102, 30694 }, // β
+    { 18, 27, 20, 1, 17, 76, 30796 }, // γ
+    { 18, 27, 20, 1, 25, 85, 30872 }, // δ
+    { 14, 16, 16, 1, 15, 45, 30957 }, // ε
+    { 16, 27, 17, 0, 22, 65, 31002 }, // ζ
+    { 19, 27, 21, 1, 19, 84, 31067 }, // η
+    { 17, 24, 19, 1, 23, 72, 31151 }, // θ
+    { 10, 21, 18, 4, 20, 42, 31223 }, // ι
+    { 15, 17, 21, 3, 17, 47, 31265 }, // κ
+    { 19, 26, 25, 3, 25, 73, 31312 }, // λ
+    { 18, 22, 25, 3, 17, 65, 31385 }, // μ
+    { 18, 18, 20, 1, 17, 56, 31450 }, // ν
+    { 14, 27, 16, 1, 22, 62, 31506 }, // ξ
+    { 17, 19, 25, 4, 18, 57, 31568 }, // ο
+    { 19, 17, 21, 1, 16, 63, 31625 }, // π
+    { 19, 24, 21, 1, 17, 76, 31688 }, // ρ
+    { 14, 22, 16, 1, 22, 50, 31764 }, // ς
+    { 20, 19, 28, 4, 18, 62, 31814 }, // σ
+    { 17, 17, 19, 1, 16, 45, 31876 }, // τ
+    { 15, 19, 17, 1, 17, 53, 31921 }, // υ
+    { 25, 38, 33, 4, 31, 149, 31974 }, // φ
+    { 23, 24, 24, 0, 17, 87, 32123 }, // χ
+    { 17, 33, 19, 1, 23, 102, 32210 }, // ψ
+    { 23, 17, 25, 1, 15, 67, 32312 }, // ω
+    { 25, 34, 28, 2, 25, 116, 32379 }, // Ạ
+    { 17, 30, 25, 4, 18, 83, 32495 }, // ạ
+    { 25, 36, 28, 2, 36, 116, 32578 }, // Ả
+    { 17, 29, 25, 4, 28, 78, 32694 }, // ả
+    { 25, 44, 28, 2, 44, 141, 32772 }, // Ấ
+    { 18, 32, 25, 4, 31, 95, 32913 }, // ấ
+    { 28, 38, 28, -1, 38, 137, 33008 }, // Ầ
+    { 25, 34, 25, -4, 33, 111, 33145 }, // ầ
+    { 25, 45, 28, 2, 45, 143, 33256 }, // Ẩ
+    { 19, 34, 25, 4, 33, 102, 33399 }, // ẩ
+    { 25, 42, 28, 2, 42, 143, 33501 }, // Ẫ
+    { 17, 34, 25, 4, 33, 108, 33644 }, // ẫ
+    { 25, 44, 28, 2, 35, 145, 33752 }, // Ậ
+    { 17, 39, 25, 4, 27, 103, 33897 }, // ậ
+    { 25, 45, 28, 2, 45, 141, 34000 }, // Ắ
+    { 17, 38, 25, 4, 37, 99, 34141 }, // ắ
+    { 25, 45, 28, 2, 45, 143, 34240 }, // Ằ
+    { 17, 38, 25, 4, 37, 100, 34383 }, // ằ
+    { 25, 46, 28, 2, 46, 144, 34483 }, // Ẳ
+    { 17, 40, 25, 4, 39, 104, 34627 }, // ẳ
+    { 25, 45, 28, 2, 45, 150, 34731 }, // Ẵ
+    { 17, 38, 25, 4, 37, 109, 34881 }, // ẵ
+    { 25, 44, 28, 2, 35, 145, 34990 }, // Ặ
+    { 17, 39, 25, 4, 27, 105, 35135 }, // ặ
+    { 19, 37, 27, 4, 25, 102, 35240 }, // Ẹ
+    { 17, 30, 25, 4, 17, 78, 35342 }, // ẹ
+    { 19, 37, 27, 4, 37, 98, 35420 }, // Ẻ
+    { 17, 32, 25, 4, 31, 78, 35518 }, // ẻ
+    { 19, 36, 27, 4, 36, 103, 35596 }, // Ẽ
+    { 17, 32, 25, 4, 31, 84, 35699 }, // ẽ
+    { 23, 36, 28, 4, 36, 119, 35783 }, // Ế
+    { 23, 32, 28, 4, 31, 100, 35902 }, // ế
+    { 25, 39, 27, -2, 39, 128, 36002 }, // Ề
+    { 23, 35, 25, -2, 34, 107, 36130 }, // ề
+    { 19, 41, 27, 4, 41, 116, 36237 }, // Ể
+    { 19, 38, 25, 4, 37, 100, 36353 }, // ể
+    { 19, 42, 27, 4, 42, 122, 36453 }, // Ễ
+    { 17, 39, 25, 4, 38, 105, 36575 }, // ễ
+    { 19, 48, 27, 4, 36, 127, 36680 }, // Ệ
+    { 17, 44, 25, 4, 31, 106, 36807 }, // ệ
+    { 8, 38, 16, 4, 38, 55, 36913 }, // Ỉ
+    { 7, 27, 14, 4, 27, 35, 36968 }, // ỉ
+    { 8, 38, 16, 4, 25, 59, 37003 }, // Ị
+    { 8, 39, 14, 3, 27, 52, 37062 }, // ị
+    { 25, 40, 33, 4, 26, 141, 37114 }, // Ọ
+    { 17, 30, 25, 4, 18, 78, 37255 }, // ọ
+    { 25, 39, 33, 4, 37, 135, 37333 }, // Ỏ
+    { 17, 30, 25, 4, 29, 74, 37468 }, // ỏ
+    { 26, 38, 33, 4, 36, 148, 37542 }, // Ố
+    { 21, 31, 26, 4, 30, 95, 37690 }, // ố
+    { 28, 41, 33, 1, 39, 156, 37785 }, // Ồ
+    { 23, 34, 25, -2, 33, 105, 37941 }, // ồ
+    { 25, 42, 33, 4, 40, 147, 38046 }, // Ổ
+    { 19, 35, 25, 4, 34, 101, 38193 }, // ổ
+    { 25, 44, 33, 4, 42, 167, 38294 }, // Ỗ
+    { 17, 35, 25, 4, 34, 104, 38461 }, // ỗ
+    { 25, 50, 33, 4, 36, 169, 38565 }, // Ộ
+    { 17, 41, 25, 4, 28, 103, 38734 }, // ộ
+    { 26, 38, 33, 4, 36, 144, 38837 }, // Ớ
+    { 19, 29, 25, 4, 28, 85, 38981 }, // ớ
+    { 26, 38, 33, 4, 36, 145, 39066 }, // Ờ
+    { 19, 29, 25, 4, 28, 85, 39211 }, // ờ
+    { 26, 39, 33, 4, 37, 144, 39296 }, // Ở
+    { 19, 30, 25, 4, 29, 87, 39440 }, // ở
+    { 26, 38, 33, 4, 36, 150, 39527 }, // Ỡ
+    { 19, 29, 25, 4, 28, 96, 39677 }, // ỡ
+    { 26, 43, 33, 4, 29, 155, 39773 }, // Ợ
+    { 19, 33, 25, 4, 21, 94, 39928 }, // ợ
+    { 22, 38, 30, 4, 25, 119, 40022 }, // Ụ
+    { 17, 31, 25, 4, 17, 82, 40141 }, // ụ
+    { 22, 39, 30, 4, 38, 118, 40223 }, // Ủ
+    { 17, 29, 25, 4, 28, 77, 40341 }, // ủ
+    { 25, 38, 30, 4, 37, 124, 40418 }, // Ứ
+    { 20, 28, 25, 4, 27, 84, 40542 }, // ứ
+    { 25, 38, 30, 4, 37, 124, 40626 }, // Ừ
+    { 20, 28, 25, 4, 27, 84, 40750 }, // ừ
+    { 25, 39, 30, 4, 38, 126, 40834 }, // Ử
+    { 20, 29, 25, 4, 28, 88, 40960 }, // ử
+    { 25, 38, 30, 4, 37, 132, 41048 }, // Ữ
+    { 20, 29, 25, 4, 28, 97, 41180 }, // ữ
+    { 25, 44, 30, 4, 31, 138, 41277 }, // Ự
+    { 20, 36, 25, 4, 22, 97, 41415 }, // ự
+    { 23, 38, 31, 4, 38, 108, 41512 }, // Ỳ
+    { 19, 38, 27, 4, 29, 91, 41620 }, // ỳ
+    { 23, 40, 31, 4, 25, 115, 41711 }, // Ỵ
+    { 21, 27, 27, 4, 16, 85, 41826 }, // ỵ
+    { 23, 40, 31, 4, 40, 112, 41911 }, // Ỷ
+    { 19, 40, 27, 4, 31, 94, 42023 }, // ỷ
+    { 23, 40, 31, 4, 40, 118, 42117 }, // Ỹ
+    { 19, 40, 27, 4, 31, 104, 42235 }, // ỹ
+    { 0, 0, 19, 0, 0, 0, 42339 }, //  
+    { 0, 0, 34, 0, 0, 0, 42339 }, //  
+    { 0, 0, 19, 0, 0, 0, 42339 }, //  
+    { 0, 0, 34, 0, 0, 0, 42339 }, //  
+    { 0, 0, 14, 0, 0, 0, 42339 }, //  
+    { 0, 0, 12, 0, 0, 0, 42339 }, //  
+    { 0, 0, 10, 0, 0, 0, 42339 }, //  
+    { 0, 0, 21, 0, 0, 0, 42339 }, //  
+    { 0, 0, 8, 0, 0, 0, 42339 }, //  
+    { 0, 0, 11, 0, 0, 0, 42339 }, //  
+    { 0, 0, 9, 0, 0, 0, 42339 }, //  
+    { 0, 0, 5, 0, 0, 0, 42339 }, // ​
+    { 0, 0, 1, 0, 0, 0, 42339 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 42339 }, // ‍
+    { 0, 0, 1, 0, 0, 0, 42339 }, // ‎
+    { 0, 0, 1, 0, 0, 0, 42339 }, // ‏
+    { 16, 4, 17, 0, 11, 17, 42339 }, // ‐
+    { 16, 4, 17, 0, 11, 17, 42356 }, // ‑
+    { 24, 4, 21, -4, 11, 23, 42373 }, // ‒
+    { 21, 6, 23, 1, 11, 17, 42396 }, // –
+    { 31, 6, 33, 1, 11, 23, 42413 }, // —
+    { 31, 6, 33, 1, 11, 23, 42436 }, // ―
+    { 14, 27, 18, 3, 22, 82, 42459 }, // ‖
+    { 24, 10, 21, -4, -2, 51, 42541 }, // ‗
+    { 10, 10, 13, 1, 26, 19, 42592 }, // ‘
+    { 10, 10, 13, 1, 26, 21, 42611 }, // ’
+    { 10, 10, 11, 0, 5, 20, 42632 }, // ‚
+    { 10, 10, 13, 1, 26, 19, 42652 }, // ‛
+    { 20, 10, 22, 1, 26, 41, 42671 }, // “
+    { 20, 10, 22, 1, 26, 42, 42712 }, // ”
+    { 10, 10, 11, 0, 5, 20, 42754 }, // „
+    { 20, 10, 22, 1, 26, 41, 42774 }, // ‟
+    { 18, 41, 24, 3, 31, 86, 42815 }, // †
+    { 17, 41, 25, 5, 30, 91, 42901 }, // ‡
+    { 23, 23, 20, -4, 26, 78, 42992 }, // •
+    { 10, 10, 18, 4, 13, 19, 43070 }, // ‣
+    { 7, 7, 18, 5, 7, 14, 43089 }, // ․
+    { 7, 7, 18, 5, 7, 14, 43103 }, // ‥
+    { 27, 7, 28, 0, 7, 40, 43117 }, // …
+    { 4, 4, 16, 6, 11, 5, 43157 }, // ‧
+    { 0, 0, 32, 0, 0, 0, 43162 }, //  
+    { 21, 26, 33, 6, 23, 101, 43162 }, // ‰
+    { 10, 10, 16, 5, 26, 20, 43263 }, // ′
+    { 19, 10, 25, 5, 26, 40, 43283 }, // ″
+    { 23, 9, 26, 2, 25, 38, 43323 }, // ‴
+    { 8, 9, 12, 2, 24, 13, 43361 }, // ‵
+    { 14, 9, 15, 0, 24, 24, 43374 }, // ‶
+    { 24, 9, 19, -6, 25, 40, 43398 }, // ‷
+    { 17, 7, 19, 1, 25, 19, 43438 }, // ‸
+    { 10, 16, 12, 1, 16, 28, 43457 }, // ‹
+    { 10, 16, 12, 1, 16, 27, 43485 }, // ›
+    { 32, 38, 40, 5, 30, 176, 43512 }, // ※
+    { 9, 37, 18, 4, 32, 50, 43688 }, // ‼
+    { 18, 46, 25, 3, 39, 119, 43738 }, // ‽
+    { 16, 4, 17, 0, 24, 17, 43857 }, // ‾
+    { 14, 7, 16, 1, 20, 18, 43874 }, // ‿
+    { 21, 22, 21, -1, 28, 93, 43892 }, // ⁂
+    { 20, 25, 36, 8, 23, 52, 43985 }, // ⁄
+    { 36, 37, 44, 4, 33, 176, 44037 }, // ⁇
+    { 31, 38, 35, 2, 33, 150, 44213 }, // ⁈
+    { 24, 38, 24, -1, 33, 130, 44363 }, // ⁉
+    { 22, 51, 27, 2, 35, 141, 44493 }, // ⁒
+    { 0, 0, 136, 0, 0, 0, 44634 }, //  
+    { 8, 12, 10, 1, 24, 31, 44634 }, // ⁰
+    { 9, 11, 11, 1, 25, 22, 44665 }, // ⁴
+    { 8, 12, 10, 1, 25, 25, 44687 }, // ⁵
+    { 9, 11, 11, 1, 24, 28, 44712 }, // ⁶
+    { 9, 13, 11, 1, 25, 21, 44740 }, // ⁷
+    { 9, 11, 11, 1, 24, 29, 44761 }, // ⁸
+    { 9, 12, 11, 1, 24, 30, 44790 }, // ⁹
+    { 17, 18, 25, 4, 18, 56, 44820 }, // ⁿ
+    { 9, 12, 11, 1, 7, 35, 44876 }, // ₀
+    { 8, 12, 10, 1, 7, 21, 44911 }, // ₁
+    { 9, 12, 11, 1, 7, 24, 44932 }, // ₂
+    { 9, 12, 11, 1, 7, 26, 44956 }, // ₃
+    { 9, 12, 11, 1, 7, 23, 44982 }, // ₄
+    { 8, 12, 10, 1, 7, 28, 45005 }, // ₅
+    { 9, 12, 11, 1, 7, 30, 45033 }, // ₆
+    { 9, 12, 11, 1, 7, 21, 45063 }, // ₇
+    { 9, 12, 11, 1, 7, 31, 45084 }, // ₈
+    { 9, 13, 11, 1, 7, 32, 45115 }, // ₉
+    { 13, 40, 15, 1, 30, 68, 45147 }, // ₍
+    { 13, 40, 13, -2, 30, 74, 45215 }, // ₎
+    { 21, 39, 29, 4, 33, 149, 45289 }, // ₡
+    { 22, 27, 29, 3, 27, 90, 45438 }, // ₢
+    { 20, 27, 21, 0, 26, 79, 45528 }, // ₤
+    { 32, 25, 32, -1, 25, 117, 45607 }, // ₦
+    { 25, 25, 27, 1, 25, 92, 45724 }, // ₧
+    { 32, 27, 38, 3, 25, 138, 45816 }, // ₨
+    { 25, 26, 26, 0, 26, 107, 45954 }, // ₩
+    { 23, 23, 31, 4, 23, 106, 46061 }, // ₪
+    { 22, 25, 21, -2, 24, 80, 46167 }, // ₫
+    { 20, 28, 22, 1, 24, 79, 46247 }, // €
+    { 23, 25, 31, 4, 25, 85, 46326 }, // ₮
+    { 29, 25, 29, -1, 25, 97, 46411 }, // ₱
+    { 26, 39, 34, 4, 33, 144, 46508 }, // ₲
+    { 30, 24, 36, 5, 22, 116, 46652 }, // ₴
+    { 15, 24, 20, 4, 21, 59, 46768 }, // ₵
+    { 24, 26, 31, 3, 26, 84, 46827 }, // ₸
+    { 16, 24, 20, 2, 23, 72, 46911 }, // ₹
+    { 18, 22, 20, 1, 20, 72, 46983 }, // ₺
+    { 21, 24, 24, 1, 23, 98, 47055 }, // ₼
+    { 26, 25, 27, -3, 25, 95, 47153 }, // ₽
+    { 20, 20, 21, 0, 18, 50, 47248 }, // ←
+    { 21, 20, 23, 1, 19, 65, 47298 }, // ↑
+    { 20, 20, 22, 1, 18, 50, 47363 }, // →
+    { 21, 20, 23, 1, 19, 60, 47413 }, // ↓
+    { 24, 17, 30, 3, 16, 58, 47473 }, // ↔
+    { 17, 24, 23, 3, 26, 71, 47531 }, // ↕
+    { 17, 16, 23, 3, 15, 50, 47602 }, // ↖
+    { 17, 16, 19, 1, 15, 49, 47652 }, // ↗
+    { 17, 16, 19, 1, 16, 50, 47701 }, // ↘
+    { 17, 16, 19, 1, 16, 49, 47751 }, // ↙
+    { 23, 20, 29, 3, 19, 57, 47800 }, // ⇐
+    { 25, 24, 31, 3, 23, 120, 47857 }, // ⇑
+    { 23, 20, 29, 3, 19, 58, 47977 }, // ⇒
+    { 25, 24, 31, 3, 22, 116, 48035 }, // ⇓
+    { 26, 20, 32, 3, 19, 76, 48151 }, // ⇔
+    { 20, 25, 26, 3, 14, 99, 48227 }, // ⇕
+    { 18, 26, 20, 1, 24, 78, 48326 }, // ∂
+    { 30, 30, 33, 1, 27, 141, 48404 }, // ∅
+    { 23, 23, 25, 1, 22, 89, 48545 }, // ∆
+    { 19, 23, 22, 1, 21, 71, 48634 }, // ∏
+    { 19, 23, 22, 1, 22, 78, 48705 }, // ∐
+    { 15, 22, 17, 1, 21, 57, 48783 }, // ∑
+    { 16, 5, 18, 1, 11, 18, 48840 }, // −
+    { 24, 26, 28, 2, 24, 80, 48858 }, // √
+    { 25, 17, 27, 1, 19, 71, 48938 }, // ∞
+    { 23, 31, 25, 1, 23, 86, 49009 }, // ∫
+    { 8, 20, 10, 1, 20, 31, 49095 }, // ∶
+    { 18, 17, 42, 12, 17, 54, 49126 }, // ≈
+    { 22, 26, 36, 7, 23, 78, 49180 }, // ≠
+    { 25, 25, 25, -1, 21, 91, 49258 }, // ≤
+    { 24, 26, 26, 1, 22, 89, 49349 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_14_boldIntervals[] = {
@@ -5801,4 +3834,5 @@ static const EpdFontData opendyslexic_14_bold = {
     38,
     -16,
     true,
+    true,
 };
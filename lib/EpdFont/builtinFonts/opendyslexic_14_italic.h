@@ -2,5862 +2,3516 @@
  * generated by fontconvert.py
  * name: opendyslexic_14_italic
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_14_italic 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py opendyslexic_14_italic 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_14_italicBitmaps[82949] = {
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC1, 0xFF, 0x42, 0xFF, 0x03, 0xFD, 0x0B,
-    0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x2F, 0xD0, 0x3F, 0xC0, 0x7F, 0xC0, 0xFF, 0x40, 0xFF, 0x02, 0xFE,
-    0x03, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x1A, 0xAA, 0xFE, 0xAA, 0xBF, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xAA, 0xBF, 0xEA,
-    0xAF, 0xEA, 0xAA, 0x90, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x43, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xFF, 0xAF, 0x06, 0x40, 0x00, 0x0B, 0xFF, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x3C, 0x1E,
-    0x00, 0x00, 0x00, 0x2F, 0xC7, 0x82, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0xB4, 0x3C, 0x00, 0x00, 0x00,
-    0x3F, 0xCF, 0x43, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x78, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xD7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3C, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0x83,
-    0xDF, 0xFF, 0xC0, 0x00, 0x00, 0xB4, 0x3C, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x43, 0xEF, 0xFF, 0xC0,
-    0x0B, 0x95, 0xF5, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x06, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0x82, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xB4,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x05, 0x40, 0x00, 0x03, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0x00, 0x03,
-    0xD0, 0x74, 0x00, 0x3C, 0x00, 0x0B, 0x00, 0x38, 0x00, 0xF4, 0x00, 0x0E, 0x00, 0x38, 0x02, 0xD0,
-    0x00, 0x1D, 0x00, 0x38, 0x0B, 0x80, 0x00, 0x2C, 0x00, 0xB0, 0x1E, 0x00, 0x00, 0x2D, 0x01, 0xF0,
-    0x7C, 0x00, 0x00, 0x1F, 0xFF, 0xC1, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x01,
-    0x94, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAB, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x01, 0xC0,
-    0x00, 0x00, 0x02, 0xF4, 0x01, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x01, 0xC0, 0x00, 0x00, 0x1F, 0xF0,
-    0x03, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x07, 0x80, 0x00, 0x00, 0xF8, 0xFE, 0xBF, 0x00, 0x00, 0x03,
-    0xE0, 0xBF, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xF9, 0x02, 0xF4, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF4,
-    0x00, 0x00, 0x2F, 0x80, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x80, 0x00, 0x00, 0x07, 0xFB,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xDF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xF4, 0x00,
-    0xA8, 0x07, 0xFC, 0x00, 0xFC, 0x01, 0xFC, 0x0F, 0xF4, 0x00, 0x7F, 0x07, 0xF8, 0x2F, 0xF0, 0x00,
-    0x1F, 0xDF, 0xF0, 0x2F, 0xF0, 0x00, 0x0B, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x2F,
-    0xFD, 0x00, 0x6F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x8F,
-    0x40, 0x02, 0xFF, 0xFF, 0xF8, 0x05, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x43, 0xFE, 0x0F, 0xF8, 0x2F, 0xE0, 0x7F, 0xC0, 0xFF, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2D, 0x00, 0x01, 0x40, 0xF0, 0x0E, 0x1F, 0x83, 0xC2, 0xF4,
-    0x7F, 0xDE, 0xBD, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0xBE,
-    0x79, 0xFF, 0x0F, 0xD1, 0xD0, 0xB8, 0x18, 0x0B, 0x00, 0x40, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x3F,
-    0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0xFE, 0x1F, 0xE3,
-    0xFD, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x07, 0xE4, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x3C, 0x00, 0x07, 0xD0, 0x00, 0xB4, 0x00, 0x3E, 0x00,
-    0x02, 0xE0, 0x02, 0xF0, 0x00, 0x0B, 0x80, 0x0F, 0x80, 0x80, 0x3E, 0x00, 0xBD, 0x0F, 0x80, 0xF8,
-    0x03, 0xF0, 0x3E, 0x03, 0xD0, 0x1F, 0x82, 0xF4, 0x2F, 0x00, 0xBD, 0x0B, 0xC0, 0xFC, 0x03, 0xF0,
-    0x1E, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x0F,
-    0xE0, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x2F, 0xF9, 0x6F, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7E,
-    0xF8, 0x00, 0x0A, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01,
-    0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0x90, 0x1F, 0xF0, 0x00, 0x18, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01,
-    0xAF, 0xF9, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0A, 0x40, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x55, 0xBF, 0x40, 0x00, 0x03, 0xFF, 0xF8, 0x00,
-    0x00, 0x07, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x06, 0x95, 0x6F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFA, 0xE0, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x1F, 0x87, 0xD0,
-    0x00, 0x7F, 0x0B, 0xC0, 0x01, 0xFC, 0x0F, 0xC0, 0x07, 0xF0, 0x1F, 0x80, 0x1F, 0xC0, 0x2F, 0x80,
-    0x7F, 0xEA, 0xBF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFF, 0xFF, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x02,
-    0xF5, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x50, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x10, 0x00, 0x1F, 0xF0, 0x00, 0xFD, 0x5B, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xBF, 0xFA, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xE5, 0x55,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xBF, 0xF4, 0x1F, 0xE0, 0x03, 0xFE, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x00, 0x3F, 0x00,
-    0x7F, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x1F, 0x80, 0x1F, 0x80,
-    0x00, 0xFC, 0x00, 0x7F, 0x40, 0x2F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x05, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xFE, 0x40, 0x00, 0x00, 0xBF, 0x9B, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x07, 0xC0,
-    0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02,
-    0xF4, 0x00, 0x0F, 0x80, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x6F, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFB, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x1F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x00, 0x7F, 0x80, 0x1F, 0xF4, 0x06, 0xFF, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00,
-    0xBC, 0x00, 0x07, 0xE0, 0x03, 0xD0, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x00, 0xBE, 0x00, 0xF8, 0x00,
-    0x02, 0xF4, 0x03, 0xE0, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x0B, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xF9, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x10, 0x00, 0x1F,
-    0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00,
-    0xFF, 0xC0, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xF0, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F,
-    0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x03,
-    0xFF, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xA0, 0x00, 0x00, 0x01, 0x54, 0x02, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1A, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xD0, 0x55, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x01, 0xBF, 0xFF, 0xF4, 0x00, 0x1B, 0xFF, 0xFF,
-    0x90, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFE, 0x41, 0xBF, 0xC0, 0x0F,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xB0,
-    0x00, 0x03, 0xF0, 0x7F, 0x30, 0x00, 0x2C, 0x00, 0x03, 0xF0, 0xB9, 0xBC, 0x00, 0x0B, 0x00, 0x01,
-    0xF4, 0x70, 0x0F, 0x00, 0x02, 0xC0, 0x00, 0xFC, 0x30, 0x03, 0x80, 0x00, 0xF0, 0x00, 0xBE, 0x28,
-    0x01, 0xD0, 0x00, 0xB4, 0x00, 0x3F, 0x4E, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x0F, 0xD3, 0xEB, 0xFC,
-    0x00, 0x7D, 0x00, 0x07, 0xF4, 0xBF, 0xFF, 0x00, 0xBD, 0x00, 0x01, 0xFE, 0x0B, 0xE3, 0xDB, 0xFD,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x51, 0x6B, 0x40, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x01, 0xFC,
-    0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x07,
-    0xF0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF4, 0x00,
-    0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x00,
-    0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x01,
-    0xFC, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xF0,
-    0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0xFF,
-    0x00, 0xBE, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0xFC, 0x00, 0x02, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x95, 0x5A, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x10, 0x00, 0x1F, 0xFF, 0xF9, 0x56, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x03,
-    0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0x80,
-    0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xFC,
-    0x02, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0xFE, 0x55, 0x56, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x56,
-    0xA0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5A, 0xAA, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0xBF, 0xAA, 0xA5, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xAA, 0xFC,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x95, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x3F, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x1B,
-    0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xF9, 0x40, 0xFF, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0x40, 0x0F, 0xFF, 0xA5, 0x56, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x02,
-    0xA0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x07, 0xFE, 0x55, 0x55, 0x6F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00,
-    0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0x80, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFE, 0x00,
-    0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F,
-    0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xE0, 0x0B, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0xBF, 0x80, 0x00, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xC0, 0x00, 0x00,
-    0x3F, 0x43, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF3,
-    0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x8B, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x0F, 0xFF, 0x40, 0x00, 0x0F,
-    0xF0, 0x2F, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xFD, 0x00,
-    0x0F, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0xBF, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xA9, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xAB, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xAA,
-    0x80, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x1F, 0xDF, 0xF4, 0x00,
-    0xFF, 0xBF, 0x40, 0x00, 0xBE, 0x7F, 0xE0, 0x0B, 0xFA, 0xFD, 0x00, 0x03, 0xF8, 0xFF, 0x80, 0x7F,
-    0xCF, 0xF0, 0x00, 0x1F, 0xD3, 0xFF, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xBF, 0x0F, 0xFC, 0x2F, 0xE2,
-    0xFE, 0x00, 0x03, 0xFC, 0x3F, 0xF1, 0xFF, 0x0F, 0xF8, 0x00, 0x1F, 0xE0, 0xBF, 0xDF, 0xF4, 0x7F,
-    0xD0, 0x00, 0xBF, 0x82, 0xFF, 0xFF, 0xC2, 0xFF, 0x00, 0x03, 0xFD, 0x07, 0xFF, 0xFC, 0x0F, 0xFC,
-    0x00, 0x1F, 0xF0, 0x0F, 0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xFF, 0x02, 0xFF, 0x80,
-    0x03, 0xFE, 0x00, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0x0F, 0xF4, 0x03, 0xFF, 0x80, 0x7F, 0xF0, 0x00,
-    0xBF, 0xD0, 0x0B, 0xFC, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x2F, 0xD0, 0x0F, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x2F, 0xD0,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x1F,
-    0xEB, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC3, 0xF8,
-    0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x83, 0xFC, 0x03, 0xFC,
-    0x00, 0x00, 0xFF, 0x42, 0xFD, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x02,
-    0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x07, 0xFD, 0x00,
-    0xFF, 0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0x7F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x1F, 0xEA, 0xFF, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x0B,
-    0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x1B, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0xAA, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0xFF, 0x00, 0x03, 0x80, 0x3F, 0xC0, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0xBF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xAA, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA9, 0x40, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2E, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xD0,
-    0x00, 0x2F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8,
-    0x00, 0x07, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0x95, 0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0x01, 0xFD, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xE0, 0x00,
-    0xFF, 0x80, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFD, 0x40, 0x04,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x40, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0xBF,
-    0xEA, 0xAF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0A, 0x95, 0x0B, 0xF0, 0x01,
-    0x50, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F,
-    0xD0, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFE,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
-    0xF4, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0xA9, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x3F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x2F, 0xD0, 0x00,
-    0x03, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F,
-    0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x40,
-    0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x1F,
-    0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0xD0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xC0,
-    0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0x80, 0x02, 0xFD, 0x00, 0x3F, 0xFD,
-    0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x3F, 0xFF, 0x80, 0x2F, 0xE0, 0x00, 0x2F, 0xD0, 0x2F, 0xFF,
-    0xF0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x1F, 0xFB, 0xFC, 0x0B, 0xF8, 0x00, 0x03, 0xFD, 0x0F, 0xF8,
-    0xFF, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x4F, 0xFC, 0x3F, 0xD2, 0xFD, 0x00, 0x00, 0x3F, 0xDB, 0xFD,
-    0x0F, 0xF9, 0xFF, 0x00, 0x00, 0x0F, 0xFB, 0xFE, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0x80, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x40,
-    0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x40,
-    0x0F, 0xF0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x4B,
-    0xF8, 0x00, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x02,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x03, 0x01, 0xD0, 0xB4, 0x2D, 0x0B, 0x82, 0xE0, 0xBC, 0x2F, 0x0B, 0xC1, 0xF0, 0x7C,
-    0x1F, 0x47, 0xD1, 0xF4, 0x7E, 0x1F, 0x83, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3E, 0x0F,
-    0x03, 0x00, 0x40, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x55, 0x55,
-    0x00, 0xB4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0x0B, 0x80, 0x0F, 0x00, 0x7C,
-    0x0A, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x3E, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00,
-    0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02,
-    0xFF, 0xFD, 0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xF0, 0x00, 0xFD,
-    0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x7C, 0x00,
-    0x01, 0xF8, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0xF4, 0x00, 0x0B, 0xF4, 0x0F, 0x80, 0x03, 0xFF, 0x00,
-    0xFF, 0x5A, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFE,
-    0x7E, 0x00, 0x0B, 0xFE, 0x47, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0x4B, 0xFE, 0x00, 0x03, 0xFB, 0xFF, 0xFD, 0x00, 0x7F, 0xFE, 0x5B, 0xF0, 0x0B, 0xFF, 0x00, 0x1F,
-    0x80, 0xFF, 0xC0, 0x00, 0xFC, 0x0F, 0xF0, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x00, 0xFC, 0x1F, 0xC0,
-    0x00, 0x0F, 0x82, 0xFC, 0x00, 0x02, 0xF4, 0x3F, 0xC0, 0x00, 0x7F, 0x03, 0xFC, 0x00, 0x2F, 0xD0,
-    0x3F, 0xE5, 0x6F, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00, 0x2F, 0xF9, 0x68, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xE5, 0xA0, 0x01,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x2F, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFB, 0xD0, 0x00, 0x07,
-    0xF4, 0x0B, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xD0, 0x00,
-    0x2F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xE0,
-    0x00, 0x2F, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x7F,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0x2F, 0xF8, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F,
-    0xD0, 0x0F, 0x00, 0x07, 0xE0, 0x00, 0x74, 0x01, 0xF4, 0x00, 0x03, 0xC0, 0x3E, 0x00, 0x5A, 0xFC,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0x95, 0x40, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x18, 0x01,
-    0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x7E, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x05, 0xFE, 0x54, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1A, 0x00, 0x00, 0x7F, 0xFF, 0x4F,
-    0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0x40, 0xFF, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xFC,
-    0x00, 0x2F, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0x40, 0x00, 0xFF, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0xC0,
-    0x02, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xEA, 0xBF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xFB, 0xE0, 0x00, 0x00, 0x7F, 0x93, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xD0, 0x1B, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x7C, 0x6F, 0xF4, 0x00, 0x03, 0xFB, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xE4,
-    0x0F, 0xD0, 0x03, 0xFD, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x00, 0x3D, 0x00, 0x7F, 0x00, 0x01, 0xF4,
-    0x03, 0xF8, 0x00, 0x07, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x03, 0xF8,
-    0x00, 0x07, 0xD0, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x00, 0xFC, 0x03, 0xFC, 0x00, 0x0B,
-    0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0xBF, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0F,
-    0xE0, 0x00, 0xBF, 0x40, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02,
-    0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x02,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x06, 0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x40,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x3F, 0x03, 0xF8, 0x00, 0x7E, 0x0F, 0xD0, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0xFC, 0xFD, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x0B,
-    0xEF, 0xF0, 0x00, 0x0F, 0xDB, 0xFC, 0x00, 0x0F, 0xC3, 0xFE, 0x00, 0x2F, 0xC2, 0xFF, 0x40, 0x3F,
-    0x80, 0xFF, 0xD0, 0x3F, 0x40, 0xBF, 0xF0, 0xBF, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x90, 0x00, 0x07,
-    0xD0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B,
-    0xD0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B,
-    0xD0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x07,
-    0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x1B, 0xF4, 0x00, 0x03, 0xF7, 0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0xE0, 0x1F, 0xFF, 0x40, 0xFC, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00,
-    0x1F, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x0B, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xE0,
-    0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x02, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0xFD,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00,
-    0xFD, 0x00, 0x0B, 0xE0, 0x1F, 0xD0, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x0B, 0xF0, 0x00, 0x3F, 0x80,
-    0x01, 0xFC, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xE6, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0x41, 0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xC0, 0x0F, 0xE0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x1F, 0xC0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x02, 0xF8, 0x07, 0xF0,
-    0x00, 0x3F, 0x40, 0xFF, 0x00, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x00, 0x01,
-    0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x7F, 0xEA, 0xFF, 0x40, 0x0F, 0xD0, 0x01, 0xF8,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xC1, 0xF4, 0x00,
-    0x00, 0xFC, 0x2F, 0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0xFE, 0x03,
-    0xFE, 0x55, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x10, 0x06, 0xE4, 0x00, 0x00, 0x02, 0xF1, 0xFF,
-    0xFC, 0x00, 0x00, 0x0B, 0xEF, 0xFA, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xF4, 0x00, 0x00, 0xFF,
-    0x80, 0x03, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x3E, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0x00,
-    0x00, 0xBF, 0xC0, 0x02, 0xF4, 0x00, 0x03, 0xFF, 0xD0, 0x2F, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xF7, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x47, 0xFF,
-    0xD0, 0x00, 0x01, 0xFC, 0x00, 0x50, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x54, 0x00, 0x07, 0xFF, 0xF1, 0xFC, 0x00,
-    0x2F, 0xFB, 0xFA, 0xF4, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x02, 0xF8, 0x00, 0x3F, 0xE0, 0x07, 0xF0,
-    0x00, 0x3F, 0xD0, 0x0B, 0xC0, 0x00, 0x3F, 0xC0, 0x0F, 0x80, 0x00, 0x7F, 0x80, 0x1F, 0x00, 0x00,
-    0xBF, 0x00, 0x2F, 0x00, 0x00, 0xFF, 0x00, 0x3E, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0x00, 0x0B, 0xFC,
-    0x00, 0x3F, 0x90, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0xFA, 0xF0, 0x00, 0x00, 0xBF, 0x93, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xC6, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xF9, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x1B, 0xD0, 0x01, 0xFB, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xF9, 0x60,
-    0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFA, 0x40, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x51, 0x40, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x90, 0x1F, 0xF0,
-    0x07, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x00,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x2F, 0x40,
-    0xBD, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x0F, 0x80, 0x00,
-    0xFD, 0x01, 0xF8, 0x00, 0x2F, 0xD0, 0x2F, 0xC0, 0x0B, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF7, 0xF0, 0x00, 0x7F, 0xF8, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x2F, 0x03, 0xF4, 0x00, 0x07, 0xD0, 0x2F, 0x80, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0xFD, 0x01, 0xF8, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0xBF,
-    0x0F, 0xC0, 0x00, 0x07, 0xF2, 0xF4, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x1F,
-    0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x14, 0x00, 0xFE, 0x01, 0xFC, 0x02, 0xF4, 0x07, 0xF0,
-    0x07, 0xF0, 0x2F, 0xF0, 0x3F, 0x80, 0x1F, 0xC2, 0xFF, 0xD1, 0xFC, 0x00, 0x7F, 0x2F, 0xFF, 0xCF,
-    0xE0, 0x01, 0xFE, 0xFF, 0xFF, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xEF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFC, 0x3F, 0xFD, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x0B, 0xFD,
-    0x02, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x80,
-    0x00, 0x2F, 0xC0, 0x0B, 0xE0, 0x00, 0x01, 0xFD, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40,
-    0x00, 0x00, 0x0B, 0xF7, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x41, 0xFF,
-    0x00, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x03, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0,
-    0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xFD, 0x00, 0x00, 0x01,
-    0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x06, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0B, 0x40, 0x00,
-    0xF0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xB4, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x2E, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x07,
-    0x02, 0xEF, 0x02, 0xC0, 0xE0, 0xD0, 0xE0, 0xB4, 0x2E, 0xF0, 0x3C, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0xC0, 0x00,
-    0xBF, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00,
-    0x3F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x68, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFD, 0x50, 0x07, 0xF4, 0xF0, 0x00, 0x3F, 0x0B, 0x40, 0x02, 0xF8, 0x3C, 0x00, 0x0F, 0xC0,
-    0xF0, 0x00, 0x7E, 0x07, 0x80, 0x02, 0xF4, 0x3C, 0x00, 0x0F, 0xD0, 0xF0, 0x00, 0x3F, 0x47, 0x80,
-    0x00, 0xFF, 0x3D, 0x00, 0x03, 0xFF, 0xFA, 0x80, 0x07, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xE4, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00,
-    0x02, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0A, 0xBF, 0xAA, 0xA8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE9, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x7C, 0x00, 0xBF, 0xBF, 0xAF, 0xD0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xD0,
-    0xFE, 0x00, 0x03, 0xE0, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x0B, 0xD0, 0x01,
-    0xF8, 0x01, 0xFC, 0x00, 0x1F, 0xD0, 0xBF, 0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xEF, 0xFF, 0xFD, 0x01, 0xF0, 0x15, 0x0F, 0x40, 0x08, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x01, 0x40, 0x0B, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00,
-    0x02, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0xE0, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x47, 0xF8, 0x00,
-    0x00, 0x07, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x04,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0B, 0x40,
-    0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xB4, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x2E, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x14, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x90, 0x06, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x01,
-    0xF8, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xFE, 0x50,
-    0x00, 0xFC, 0x00, 0x02, 0xFF, 0xFA, 0xAF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xD0, 0xFD, 0x00, 0xFD, 0x2F, 0xD0, 0x2F, 0xC3, 0xFC, 0x03, 0xFC,
-    0xBF, 0xC0, 0xBF, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x78, 0x07, 0x00, 0x7B, 0xC0, 0x20, 0x3E, 0x00,
-    0x0C, 0x2B, 0x00, 0x03, 0x0E, 0x80, 0x00, 0xC3, 0xB0, 0x00, 0x90, 0xDF, 0xD0, 0x70, 0x24, 0x50,
-    0x70, 0x03, 0x41, 0xB4, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xDC, 0x03, 0xD7, 0xC0,
-    0xE0, 0x2C, 0x1C, 0x03, 0xC2, 0x80, 0x38, 0x34, 0x0B, 0x43, 0x96, 0xF4, 0x3F, 0xFF, 0x00, 0xFE,
-    0x70, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x0B, 0x00, 0x00, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x00,
-    0x2F, 0x80, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x07, 0xE0, 0x00,
-    0xFC, 0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x0F, 0xF0,
-    0x00, 0xBF, 0x40, 0x1F, 0xE0, 0x00, 0xBC, 0x00, 0x2F, 0x40, 0x00, 0xD0, 0x00, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x3F, 0xA9, 0x50, 0x07, 0xFF, 0xFF, 0xFD, 0x6B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x15, 0x00, 0x3F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x1B, 0xE0, 0x00, 0x38, 0x03, 0x40, 0x3F, 0xE0, 0x30, 0x36, 0x0C, 0x08, 0x19, 0x46, 0x02, 0x0C,
-    0xBF, 0x00, 0xC3, 0x35, 0xC0, 0x70, 0xDC, 0x30, 0x34, 0x2F, 0x1C, 0x38, 0x03, 0x81, 0xB4, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE2, 0xAA, 0xA5, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xF0, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFE, 0x03, 0xF0, 0x0F, 0xD0, 0x03, 0xD0, 0x7D,
-    0x00, 0x0F, 0x83, 0xF0, 0x00, 0x3D, 0x0F, 0xC0, 0x02, 0xF0, 0x7F, 0x00, 0x1F, 0x80, 0xFE, 0x02,
-    0xFC, 0x02, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xAA, 0xAF, 0xEA, 0x90, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xAA, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x02,
-    0x43, 0x80, 0x00, 0x28, 0x00, 0x03, 0x40, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x1F, 0x80,
-    0x03, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0x00, 0x28,
-    0x00, 0xFD, 0x00, 0x00, 0xB0, 0x00, 0x03, 0x40, 0x00, 0x70, 0x04, 0x1F, 0x03, 0xFF, 0xC0, 0x2F,
-    0xE0, 0x00, 0x00, 0x64, 0x07, 0xC0, 0x3D, 0x03, 0xE0, 0x2F, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x2F, 0x40, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x01, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x80, 0x02,
-    0xFD, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x03, 0xEF, 0xFF, 0xFF, 0xF4, 0x01, 0xE7, 0xFF, 0xFD, 0xFC, 0x00, 0xF0, 0x7F, 0xF8, 0x7F,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x14, 0x00, 0x00, 0x7F, 0xD0, 0x3D, 0x00, 0x02, 0xFF, 0xC0, 0x3C,
-    0x00, 0x0B, 0xFF, 0xC0, 0x7C, 0x00, 0x0F, 0xFF, 0x40, 0xB8, 0x00, 0x2F, 0xFF, 0x00, 0xF4, 0x00,
-    0x2F, 0xFF, 0x00, 0xF0, 0x00, 0x2F, 0xFD, 0x01, 0xF0, 0x00, 0x2F, 0xFC, 0x02, 0xE0, 0x00, 0x0F,
-    0xFC, 0x03, 0xD0, 0x00, 0x03, 0xF4, 0x03, 0xC0, 0x00, 0x0B, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0xF0,
-    0x0B, 0x80, 0x00, 0x1F, 0xD0, 0x0F, 0x40, 0x00, 0x3F, 0xC0, 0x0F, 0x00, 0x00, 0x7F, 0xC0, 0x1F,
-    0x00, 0x00, 0xFF, 0x40, 0x2E, 0x00, 0x01, 0xFF, 0x00, 0x3D, 0x00, 0x03, 0xFE, 0x00, 0x3C, 0x00,
-    0x03, 0xFD, 0x00, 0x7C, 0x00, 0x0B, 0xFC, 0x00, 0xB8, 0x00, 0x0F, 0xF8, 0x00, 0xF4, 0x00, 0x2F,
-    0xF4, 0x00, 0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xF0, 0x00, 0x0B, 0xE0, 0xFE, 0x1F, 0xD3, 0xFD, 0x7F,
-    0xC0, 0x01, 0x40, 0x03, 0x00, 0x08, 0x00, 0x0F, 0xE0, 0x00, 0x34, 0x00, 0x34, 0x2B, 0xE0, 0xBF,
-    0x80, 0x00, 0x14, 0x00, 0xFC, 0x01, 0x78, 0x00, 0x34, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xD0, 0x01,
-    0xC0, 0x03, 0xC0, 0x3F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x0B, 0x42, 0xC1, 0xC0,
-    0x0C, 0x2C, 0x01, 0xC3, 0x80, 0x38, 0x3D, 0x5B, 0x42, 0xFF, 0xD0, 0x0B, 0xE0, 0x00, 0x10, 0x00,
-    0x04, 0x00, 0x00, 0x38, 0x00, 0x07, 0x40, 0x00, 0x2F, 0x40, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00,
-    0xFD, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00,
-    0xFC, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x2F, 0xE0, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x0F, 0xF0,
-    0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0xBC, 0x00, 0x1F, 0x40, 0x00, 0x34, 0x00, 0x0E, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x3C,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2B, 0xFA, 0x80, 0x1F,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x3C, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0xF4, 0x00, 0xD0, 0x00, 0x00,
-    0x03, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x3E, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0xF3, 0x80, 0x00, 0x01, 0xF0, 0x03, 0xC7, 0x40, 0x00, 0x07, 0xD0, 0x0F,
-    0x0B, 0x40, 0x00, 0x0F, 0x80, 0x3C, 0x0F, 0x00, 0x00, 0x3E, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFC,
-    0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7D, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0xAF, 0xEA, 0x00, 0x7C, 0x1A, 0x40, 0x7F, 0xFF, 0x80, 0x7D, 0xFF, 0xFC, 0x2F, 0xFF, 0xD0,
-    0x3C, 0x74, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0xBF, 0x40, 0x00,
-    0x0F, 0x80, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x2A, 0xAA, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x39, 0x5B, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3C,
-    0x00, 0x02, 0xAF, 0x40, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x0F, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x0F, 0x40, 0x0D, 0x06, 0xBE, 0x40, 0x0F,
-    0x80, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x0F, 0xB0, 0x00,
-    0x00, 0x0B, 0xC0, 0x0F, 0x38, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x1D, 0x00, 0x00, 0x07, 0xD0, 0x0F,
-    0x0B, 0x40, 0x00, 0x03, 0xE0, 0x0F, 0x03, 0xC0, 0x00, 0x03, 0xE0, 0x0F, 0xFF, 0xFF, 0x00, 0x03,
-    0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F,
-    0x40, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x54, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x02, 0x00, 0x0B, 0xF8,
-    0x00, 0x7E, 0x00, 0x0F, 0xFE, 0xAF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x01,
-    0xFC, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00,
-    0x07, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00,
-    0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0xBE, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xC0,
-    0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xF0,
-    0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x02,
-    0xC0, 0x00, 0x00, 0x00, 0x3E, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x07, 0x83, 0x47, 0x40, 0x00, 0x00,
-    0x00, 0xB0, 0x2E, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC3,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xBF, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x34, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x34, 0x38, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF0,
-    0x3F, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x00,
-    0x3F, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0,
-    0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xD0, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x02, 0xFE, 0x55, 0x69, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xAA, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x95, 0x5A, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x10, 0x00,
-    0x1F, 0xFF, 0xF9, 0x56, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x55, 0xA8, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD5, 0x5A, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x7D, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x0B, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x55,
-    0xA8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x55, 0x6A, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xDF, 0x80, 0x00, 0x1E,
-    0x01, 0xF0, 0x00, 0x38, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xD0, 0x00, 0xFD, 0x00, 0xFD, 0x00,
-    0x2F, 0xD0, 0x2F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x6F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x02,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0xFF, 0xFE, 0x00,
-    0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xCF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xF9, 0x55, 0x5B, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x03, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x8E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x07, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x0F, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xEB, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x2F,
-    0xD7, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC3, 0xFC,
-    0x02, 0xFD, 0x00, 0x00, 0xBF, 0x83, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x42, 0xFD, 0x07, 0xF8,
-    0x00, 0x01, 0xFF, 0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03,
-    0xFE, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x0B, 0xFC, 0x00,
-    0xBF, 0x7F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50,
-    0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF,
-    0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x5F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x2D,
-    0x0E, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF,
-    0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x0F, 0xC3, 0xE0,
-    0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x0B, 0xF1,
-    0xFD, 0x07, 0xF8, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFE, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF5, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0xBF, 0x40, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xD0,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xF8, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x2F,
-    0xE0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0xF8, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF4, 0x16, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x06, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x03,
-    0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00,
-    0x1F, 0xFE, 0x55, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xAA, 0x40, 0x00, 0x06, 0xA9, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC0,
-    0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0xBF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40,
-    0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFE,
-    0x55, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x28,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x40, 0x00, 0x06, 0xA9,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF,
-    0x40, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFE, 0x55, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x03,
-    0xFD, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x03,
-    0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFE, 0x55, 0xBF, 0xFD, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC,
-    0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00,
-    0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0x40, 0x00,
-    0x0F, 0xF4, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x03, 0xF4, 0x7F, 0xE0, 0x00, 0x1F, 0x80, 0x1F, 0xD0, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x03,
-    0xF0, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x00, 0x7C, 0x00, 0x7E, 0x00, 0x03, 0xE0, 0x02, 0xF4, 0x00,
-    0x7F, 0x00, 0x0F, 0xC0, 0x0B, 0xF4, 0x00, 0x3E, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x01, 0xFD, 0x01,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0xB0, 0x00, 0x0B, 0xC0, 0x00, 0x74, 0x00, 0x0F, 0x40, 0x00, 0x70,
-    0x00, 0x2F, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0x00, 0xBD, 0x00, 0x00, 0x3D, 0x01, 0xE0, 0x00, 0x00,
-    0x7C, 0x03, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0x80, 0x00, 0x00, 0xFC, 0x03, 0x80, 0x00, 0x01, 0xF8,
-    0x03, 0xE0, 0x00, 0x02, 0xF4, 0x02, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0x80, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x1F, 0xD0, 0x00, 0x1F,
-    0x80, 0x2F, 0xCE, 0x55, 0xBF, 0x00, 0x3F, 0xCF, 0xFF, 0xFE, 0x00, 0x3F, 0x8F, 0xFF, 0xF8, 0x00,
-    0xBF, 0x47, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0xF8, 0x00, 0x0F, 0xC0,
-    0x2F, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x01, 0xF8, 0x0F, 0x80, 0x00,
-    0x3F, 0x80, 0xF4, 0x00, 0x0B, 0xF4, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0x5A, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x0B, 0xFE, 0x47,
-    0xD0, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x00,
-    0x00, 0xFC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x01, 0xF8, 0x0F, 0x80, 0x00, 0x3F, 0x80,
-    0xF4, 0x00, 0x0B, 0xF4, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0x5A, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x0B, 0xFE, 0x47, 0xD0, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0x9F, 0x80, 0x00, 0x00, 0x2E, 0x01, 0xE0, 0x00, 0x00, 0x74, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0xC0,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x0F,
-    0x80, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xF5,
-    0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE,
-    0x7E, 0x00, 0x00, 0xBF, 0xE4, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x34, 0x00, 0x01, 0xFB, 0x42,
-    0xC0, 0x00, 0x0F, 0x0F, 0x0E, 0x00, 0x00, 0x78, 0x0F, 0xF0, 0x00, 0x01, 0xC0, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x7C, 0x00, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0x40, 0xBF, 0x80, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x3E, 0x00, 0x03, 0xF0,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x01, 0xF8, 0x03, 0xE0,
-    0x00, 0x0F, 0xE0, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x3E, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x5A, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF9, 0xF8, 0x00,
-    0x0B, 0xFE, 0x47, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0x01, 0xFD, 0x01, 0xFC, 0x00,
-    0x02, 0xFC, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFF,
-    0xFD, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x7F, 0x00, 0x0F,
-    0xD0, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x0F, 0xC0,
-    0x07, 0xC0, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x0F,
-    0x80, 0x03, 0xFF, 0x00, 0x0F, 0xF5, 0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x00, 0xBF, 0xE4, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x2C, 0x30, 0x00, 0x00, 0x07, 0x03, 0x40, 0x00, 0x00, 0xA0, 0x34, 0x00,
-    0x00, 0x0A, 0x0B, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0xF8, 0x00, 0x0F,
-    0xC0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x01, 0xF8, 0x0F, 0x80,
-    0x00, 0x3F, 0x80, 0xF4, 0x00, 0x0B, 0xF4, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0x5A, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x0B, 0xFE,
-    0x47, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x02, 0xFE,
-    0x40, 0x00, 0x02, 0xFF, 0xFD, 0xF2, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0xB4,
-    0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0x00, 0x03, 0xC0, 0x07, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x2D, 0x00,
-    0xF8, 0x00, 0x0F, 0xF0, 0x01, 0x6B, 0xD0, 0x2F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xD0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x7C, 0x00, 0x01, 0xFD, 0x54, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0x5A, 0xFF, 0xFF, 0x80, 0x00, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFE, 0x47, 0xD2, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0x80, 0x01, 0xFF, 0xFF, 0x00, 0x2F, 0xF9, 0x68, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xE5, 0xA0, 0x02, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xD0, 0x0F, 0x00, 0x07, 0xE0,
-    0x00, 0x74, 0x01, 0xF4, 0x00, 0x03, 0xC0, 0x3E, 0x00, 0x5A, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0x95, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x18, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0x40, 0x3C, 0x00, 0x07, 0xE0, 0x00, 0x74, 0x00, 0x7D, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x05, 0xAF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xE5, 0x50, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x06, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
-    0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0x5F, 0x40, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x0B, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0B, 0xF4, 0x03, 0xC0, 0x00, 0x7E,
-    0x00, 0x07, 0x40, 0x07, 0xD0, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x5A, 0xFC, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x7E, 0x55, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x60, 0x01, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x01, 0xFE,
-    0x00, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xD0,
-    0x0F, 0x00, 0x00, 0x7E, 0x00, 0x07, 0x40, 0x01, 0xF4, 0x00, 0x03, 0xC0, 0x03, 0xE0, 0x05, 0xAF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0x95, 0x40, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x18, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4,
-    0x00, 0x07, 0xF4, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2F,
-    0x80, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3E, 0x1F, 0x40, 0x0B, 0x80,
-    0x2E, 0x00, 0x90, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x03, 0xF0, 0x1F, 0xC0, 0x1F, 0xC0, 0xFF, 0x00, 0xFF, 0x07, 0xFC, 0x07, 0xFC,
-    0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x7C, 0x00, 0x00, 0x07, 0xFF,
-    0xFD, 0x2E, 0x00, 0x00, 0x07, 0xF8, 0x0B, 0xCF, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0xC0, 0x00,
-    0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x00, 0x03,
-    0xF8, 0x01, 0xBE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x02, 0xC0, 0x00, 0x00, 0xF1, 0xD0, 0xE0, 0x00,
-    0x00, 0x74, 0x2F, 0xF0, 0x00, 0x00, 0x3C, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x07,
-    0x9B, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x7F, 0x00, 0x00, 0x7F,
-    0x80, 0x0B, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x07, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x7F, 0x00,
-    0x03, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x0B, 0xF4, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0xBF, 0x80, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x7F, 0xEA, 0xFF, 0x40, 0x0F, 0xD0,
-    0x01, 0xF8, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xC1,
-    0xF4, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00,
-    0xFE, 0x03, 0xFE, 0x55, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xAB, 0xFD, 0x00, 0x0F, 0xD0,
-    0x01, 0xF8, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x3F,
-    0x01, 0xF4, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0xFD,
-    0x00, 0x03, 0xF8, 0x03, 0xFE, 0x55, 0xBF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0x6F, 0x00, 0x00,
-    0x00, 0xF0, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x1F, 0xFA, 0xBF, 0xD0, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x7D,
-    0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00,
-    0xBD, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x3F, 0xE5, 0x5B, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x38, 0x00, 0x00, 0xFB, 0x80, 0xD0, 0x00, 0x0B, 0x4B,
-    0x0B, 0x00, 0x00, 0x3C, 0x0F, 0xF8, 0x00, 0x01, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xEA, 0xFF,
-    0x40, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x03, 0xF0, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0xFF, 0x95, 0x6F, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0xBE, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x02, 0xFD, 0x02, 0xFD, 0x00, 0x03,
-    0xFD, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xEA, 0xFF, 0x40,
-    0x00, 0xFD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0x3F, 0xE5, 0x5B, 0xFC, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0x4F, 0xC0,
-    0x00, 0x00, 0x01, 0xF4, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0xFC, 0x00, 0x00,
-    0x00, 0x7D, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0x0F,
-    0xC1, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xBE,
-    0x6F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0xBD, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00,
-    0x7F, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x0F, 0x80, 0x00, 0xFD, 0x01, 0xF8, 0x00, 0x2F, 0xD0, 0x2F,
-    0xC0, 0x0B, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF,
-    0x40, 0x1F, 0xFF, 0xF7, 0xF0, 0x00, 0x7F, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF0,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x02, 0xF4,
-    0x0B, 0xD0, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0xF8, 0x00,
-    0x0F, 0xD0, 0x1F, 0x80, 0x02, 0xFD, 0x02, 0xFC, 0x00, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0x7F, 0x00, 0x07, 0xFF, 0x87,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x01, 0xD0, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x3F,
-    0x00, 0xBC, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x1F, 0x80,
-    0x02, 0xFD, 0x02, 0xFC, 0x00, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x80,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0x7F, 0x00, 0x07, 0xFF, 0x87, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0xFF,
-    0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x0B, 0xC0, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00, 0x2F, 0x40,
-    0x2F, 0x40, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x0F, 0x80,
-    0x00, 0xFD, 0x00, 0x7E, 0x00, 0x0B, 0xF4, 0x02, 0xFC, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x7F, 0x00, 0x01,
-    0xFF, 0xE1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00,
-    0xBD, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x80,
-    0x7F, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00, 0x00, 0xFE,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0x47, 0xF8, 0x00, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0x3E, 0x00,
-    0x3F, 0x00, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x0B, 0xC0, 0x00, 0xF0, 0x00,
-    0xF8, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x3F,
-    0x00, 0x03, 0xE0, 0x1F, 0xC0, 0x00, 0x3D, 0x0F, 0xF4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00,
-    0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x1F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFC,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x00,
-    0x2F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00,
-    0x00, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0,
-    0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x02, 0xFF, 0xFD, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x7F,
-    0x00, 0x0F, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00,
-    0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x00, 0xBF,
-    0x40, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xF5, 0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x00, 0xBF, 0xE4, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x01, 0x90, 0x00, 0x28, 0x00, 0x02,
-    0xD0, 0x00, 0x78, 0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xFF, 0x40, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x00,
-    0xF8, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x07, 0xC0,
-    0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x0F, 0x80, 0x03,
-    0xFF, 0x00, 0x0F, 0xF5, 0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x00, 0xBF, 0xE4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00,
-    0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0,
-    0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x01,
-    0xFC, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B,
-    0xF8, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFD,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0xF8,
-    0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x01, 0xF8,
-    0x0F, 0x80, 0x00, 0x3F, 0x80, 0xF4, 0x00, 0x0B, 0xF4, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0x5A,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x7E, 0x00,
-    0x0B, 0xFE, 0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0x95, 0x5A, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x1F, 0xFF, 0xF9,
-    0x56, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x2F, 0xF9, 0x68, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xE5, 0xA0, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x6F, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x95, 0x5A, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x01, 0x00, 0x00, 0x7F, 0xFF, 0xE5, 0x5B, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFA, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0x4B, 0x80, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x00,
-    0x06, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x5A, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0x68, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF9, 0x55, 0xA0, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x01, 0x00, 0x01, 0xFF, 0xFF, 0x95, 0x6F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00,
-    0x2F, 0xF9, 0x68, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xE5, 0xA0, 0x01, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0x95, 0x5A, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x1F, 0xFF, 0xF9, 0x56, 0xFC, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x07,
-    0x40, 0x02, 0xE0, 0x1F, 0x00, 0x00, 0x3F, 0x2E, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0xBF, 0xE5, 0xA0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x96, 0x80, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x80,
-    0x03, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x07,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xF0,
-    0x00, 0x00, 0x7F, 0xF8, 0x03, 0xF9, 0x55, 0x5B, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFA, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x81,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x2F, 0x02, 0x90, 0x00,
-    0x00, 0xFF, 0xFE, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x07, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0xFF,
-    0xFE, 0x00, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xCF, 0xFF, 0xFF, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xF9, 0x55, 0x5B, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF7, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x0A, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x55, 0xA8, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0x00, 0x00, 0x7E, 0x00,
-    0x07, 0x40, 0x01, 0xF4, 0x00, 0x03, 0xC0, 0x03, 0xE0, 0x05, 0xAF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0x95, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x18, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x38, 0x00, 0x00, 0x0F, 0x40, 0x02, 0xC0, 0x00,
-    0x00, 0x2F, 0x40, 0x7E, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x6A, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x09, 0x00, 0x00, 0xF0, 0x00, 0x2C, 0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0x00, 0x00, 0x7E, 0x00,
-    0x07, 0x40, 0x01, 0xF4, 0x00, 0x03, 0xC0, 0x03, 0xE0, 0x05, 0xAF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0x95, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x18, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD5, 0x5A, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-    0xFC, 0x00, 0x02, 0xFD, 0x00, 0xF0, 0x00, 0x7E, 0x00, 0x07, 0x40, 0x1F, 0x40, 0x00, 0x3C, 0x03,
-    0xE0, 0x05, 0xAF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x81, 0xF9, 0x54, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x01, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF5, 0x56, 0xA0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x2F, 0xD0, 0x0F, 0x00, 0x07, 0xE0, 0x00, 0x74, 0x01, 0xF4, 0x00, 0x03, 0xC0, 0x3E,
-    0x00, 0x5A, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0x95, 0x40, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x18, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
-    0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x06, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x01, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0x7C, 0x00,
-    0x00, 0x00, 0x0F, 0x8B, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x6A, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x07, 0x80, 0x00, 0x0B, 0x80, 0xB4, 0x00, 0x00, 0x0F, 0xEF,
-    0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0B, 0xF4, 0x03, 0xC0, 0x00, 0x7E, 0x00, 0x07, 0x40, 0x07,
-    0xD0, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x5A, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x7E, 0x55, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x60, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0x90, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0xAB, 0xF0, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x01, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x25, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x1B, 0xFF, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x3E, 0x50, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0xFD, 0x00, 0x0F, 0xFF, 0xA5, 0x56, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0x80,
-    0x00, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1A, 0x00, 0x00, 0x1F, 0xFF, 0xD3,
-    0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFD, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x0F,
-    0xFC, 0x00, 0x0B, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0x00, 0x00,
-    0xFF, 0x00, 0x02, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xE0, 0x00,
-    0xFF, 0xC0, 0x00, 0x3F, 0xAA, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xBE, 0x00, 0x00, 0x01, 0xFE, 0x4F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0D, 0x01, 0xBF, 0xE0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0xFE, 0xAB, 0xF0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x25, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0x50,
-    0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xFF, 0xA5,
-    0x56, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x0F, 0x40, 0x02, 0xC0, 0x00,
-    0x03, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x01, 0xA0, 0x00, 0x07,
-    0xFF, 0xF4, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xF4, 0x0F, 0xFF, 0x00, 0x03, 0xF0,
-    0x00, 0xFF, 0xC0, 0x02, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x7C, 0x00,
-    0x03, 0xFC, 0x00, 0x2E, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0x40, 0x00, 0xFF, 0x00, 0x03, 0xE0, 0x00,
-    0xFF, 0xC0, 0x00, 0xFE, 0xAB, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xBE, 0x00, 0x00, 0x07, 0xF9, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0D, 0x01, 0xBF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xAA, 0xFC, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x95, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x3F, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x0F, 0xF0, 0x00,
-    0x00, 0x1B, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xF9, 0x40, 0xFF, 0x40, 0x00, 0x00, 0xBD, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xFF, 0xA5, 0x56, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x06,
-    0x80, 0x00, 0x1F, 0xFF, 0xD3, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xD0, 0x3F, 0xFC,
-    0x00, 0x0F, 0xC0, 0x03, 0xFF, 0x00, 0x0B, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xD0, 0x00, 0x3F, 0xC0,
-    0x01, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xB8, 0x00, 0x07, 0xF8, 0x00, 0x3D, 0x00, 0x03, 0xFC, 0x00,
-    0x0F, 0x80, 0x03, 0xFF, 0x00, 0x03, 0xFA, 0xAF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0xF8, 0x00, 0x00, 0x1F, 0xE4, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x34, 0x06, 0xFF, 0x80, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1B,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xAA, 0xFC, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x95,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x0F, 0xF0,
-    0x00, 0x00, 0x1B, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xF9, 0x40, 0xFF, 0x40, 0x00, 0x00, 0xBD,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xFF, 0xA5, 0x56, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x68, 0x00, 0x01, 0xFF,
-    0xFD, 0x3F, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFD, 0x03, 0xFF, 0xC0, 0x00, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0xBC, 0x00, 0x0F, 0xF4, 0x00, 0x3D, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0x00, 0x00,
-    0xFF, 0x00, 0x0B, 0x80, 0x00, 0x7F, 0x80, 0x03, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xF8, 0x00, 0x3F,
-    0xF0, 0x00, 0x3F, 0xAA, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0xEF, 0x80, 0x00, 0x01, 0xFE, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0x40, 0x6F, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xD0, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00,
-    0x00, 0x06, 0xA0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x07, 0xFE, 0x55, 0x55, 0x6F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x40,
-    0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xD0,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x18, 0x00,
-    0x06, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xC6, 0xFF,
-    0x40, 0x00, 0x3F, 0xBF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFE, 0x40, 0xFD, 0x00,
-    0x3F, 0xD0, 0x01, 0xF8, 0x00, 0xFE, 0x00, 0x03, 0xD0, 0x07, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0x80,
-    0x00, 0x7C, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x0F, 0x80, 0x3F, 0x80, 0x00, 0x7D,
-    0x00, 0xFD, 0x00, 0x03, 0xF4, 0x0B, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0xFF,
-    0x00, 0x03, 0xF8, 0x0B, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0xAA,
-    0xAA, 0xBF, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xD5, 0x55, 0x5B, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x6B, 0xF0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xE5, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x6F, 0xF4, 0x00, 0x03, 0xFB, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xE4, 0x0F, 0xD0, 0x03, 0xFD, 0x00, 0x1F, 0x80, 0x0F, 0xE0,
-    0x00, 0x3D, 0x00, 0x7F, 0x00, 0x01, 0xF4, 0x03, 0xF8, 0x00, 0x07, 0xC0, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x7F, 0x00, 0x00, 0xF8, 0x03, 0xF8, 0x00, 0x07, 0xD0, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0xBF,
-    0x00, 0x00, 0xFC, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0xBF, 0x80, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0xFF, 0x01, 0xC0, 0x00, 0xF4, 0xE0, 0xF0, 0x00,
-    0x78, 0x2F, 0xF4, 0x00, 0x2C, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xD0, 0x1F,
-    0xB4, 0x1C, 0x03, 0xC2, 0xC3, 0xC0, 0x78, 0x0F, 0xF4, 0x07, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0xBF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x1F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0xB8,
-    0x00, 0xF4, 0x00, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x03, 0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x2F, 0x80, 0x3F, 0x40, 0x3F, 0x40, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xF8, 0x00,
-    0x0B, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF8,
-    0x00, 0x07, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x07,
-    0xF8, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0xBF,
-    0x40, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x80, 0x03, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x40,
-    0x00, 0xBF, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0xBF,
-    0x40, 0x00, 0x6F, 0xE0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x4B, 0xC0, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xE0, 0x0B,
-    0xF4, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0x80, 0x00, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xE0,
-    0x7F, 0xC0, 0x00, 0x00, 0x3F, 0x43, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xE3, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xF3, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x8B, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x0F,
-    0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x2F, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0xFE, 0x00, 0x03, 0xFD,
-    0x00, 0xBF, 0xFD, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0xBF, 0x80, 0x03, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF8, 0x00, 0x7E, 0x0F, 0xD0, 0x00, 0xBC, 0x3F, 0x40, 0x00,
-    0xFC, 0xFD, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x0B, 0xEF, 0xF0, 0x00, 0x0F, 0xDB, 0xFC, 0x00, 0x0F, 0xC3, 0xFE, 0x00, 0x2F,
-    0xC2, 0xFF, 0x40, 0x3F, 0x80, 0xFF, 0xD0, 0x3F, 0x40, 0xBF, 0xF0, 0xBF, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0x50, 0x03, 0xD0, 0xBC, 0x00, 0x3C,
-    0x1F, 0x00, 0x0B, 0x87, 0xD0, 0x00, 0xF4, 0xF4, 0x00, 0x1F, 0x3E, 0x00, 0x02, 0xEF, 0x80, 0x00,
-    0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xF7, 0xF8,
-    0x00, 0x3F, 0x2F, 0xD0, 0x03, 0xD0, 0xFF, 0x00, 0x7C, 0x0F, 0xF8, 0x0F, 0xC0, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xAB, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFA, 0xAB, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00,
-    0x02, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x0F,
-    0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x02, 0xFF, 0x00,
-    0x03, 0xFD, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA9, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x0B,
-    0x80, 0x03, 0xF4, 0x00, 0x3D, 0x00, 0x1F, 0xC0, 0x02, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0x80, 0x03,
-    0xF8, 0x00, 0x7D, 0x00, 0x1F, 0xC0, 0x02, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFA,
-    0xAB, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x0A, 0x40, 0xBC, 0x00,
-    0x01, 0xF4, 0x0F, 0x80, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0x07, 0xE0, 0x2F, 0x00, 0x00, 0xBD, 0x03,
-    0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00,
-    0x2F, 0xC0, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xAB, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0x40, 0x7E, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x3F, 0x01, 0xFD, 0x00, 0x7D, 0x03, 0xFD,
-    0x00, 0xFC, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xA4, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC7, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0xEA, 0xAF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0xAF, 0xF4, 0x00, 0x00, 0x01, 0x6F,
-    0xFF, 0xA4, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFE, 0x90, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-    0x0F, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x2F,
-    0xD7, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC3, 0xFC,
-    0x02, 0xFD, 0x00, 0x00, 0xBF, 0x83, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x42, 0xFD, 0x07, 0xF8,
-    0x00, 0x01, 0xFF, 0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03,
-    0xFE, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00,
-    0xBF, 0x7F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x1E, 0x6F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xF4,
-    0x1F, 0xC0, 0x00, 0x7F, 0x80, 0x0B, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x2F, 0x80,
-    0x07, 0xF0, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x2F,
-    0xD0, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0xBF, 0x80,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xF0, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x7F, 0x80, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0xC3, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0xBF,
-    0x83, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x42, 0xFD, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0x01, 0xFE,
-    0x0B, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x1F, 0xE0,
-    0x00, 0x07, 0xFD, 0x00, 0xFF, 0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0x7F, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x01, 0xE6, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x41,
-    0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xC0, 0x0F, 0xE0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x1F,
-    0xC0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x02, 0xF8, 0x07, 0xF0, 0x00, 0x3F,
-    0x40, 0xFF, 0x00, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x00, 0xFE, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xF0, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x7F, 0x80, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0xC3, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0xBF,
-    0x83, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x42, 0xFD, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0x01, 0xFE,
-    0x0B, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x1F, 0xE0,
-    0x00, 0x07, 0xFD, 0x00, 0xFF, 0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0x7F, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x09, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x47,
-    0xD0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1E,
-    0x6F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xF4, 0x1F, 0xC0, 0x00, 0x7F, 0x80,
-    0x0B, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x0F,
-    0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0x07, 0xF0, 0x00, 0x3F, 0x40,
-    0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x02, 0xE7, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x03,
-    0xFE, 0x41, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0,
-    0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x02, 0xF8, 0x00, 0x7F, 0x00, 0x03,
-    0xF4, 0x00, 0xBF, 0x00, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x01, 0xFD, 0x00, 0x0B, 0xF0,
-    0x02, 0xFD, 0x00, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x2F, 0xD0, 0x0B,
-    0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xF0,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x7F, 0x80, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0xFF,
-    0x00, 0x00, 0x3F, 0xC3, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x02, 0xFD, 0x00, 0x00,
-    0xBF, 0x83, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x42, 0xFD, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0x01,
-    0xFE, 0x0B, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x1F,
-    0xE0, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0x7F, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F, 0xF4,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xE6, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0x41, 0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xC0, 0x0F, 0xE0, 0x00, 0xBC, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x02,
-    0xF8, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0xBF, 0x02, 0xFD,
-    0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0xBF, 0x80, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x2B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x56, 0xAB, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x06, 0xAA, 0x95, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xEA, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x1F, 0x40,
-    0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00,
-    0xFE, 0x00, 0x3F, 0xE5, 0x5B, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x07, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x18, 0x00, 0x00, 0xF0, 0x00,
-    0x3C, 0x00, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFD, 0x00, 0x00, 0x7F, 0xEA, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x00, 0x0F, 0xC0,
-    0x2F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0x3F,
-    0xE5, 0x5B, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x2A, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x29, 0x40, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x40, 0x5B,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00,
-    0x1F, 0xC0, 0x01, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x94, 0x00,
-    0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xAB, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFD,
-    0x00, 0x03, 0xF8, 0x00, 0x03, 0xFE, 0x55, 0xBF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x80, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x1F, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x58, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFF, 0xFE, 0x1F, 0xE4, 0x0F, 0x00, 0x07, 0xFE, 0xAF, 0xFB, 0xE0, 0x00, 0x38, 0x00, 0xFD,
-    0x00, 0x1F, 0xF8, 0x00, 0x03, 0xC0, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x16, 0xBC, 0x07, 0xD0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0x40, 0x00, 0x1F,
-    0xD5, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE5, 0x5B, 0xFF, 0xF4, 0x00,
-    0x18, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x6F, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xAA, 0x94, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xC0,
-    0x00, 0x2F, 0x40, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x01, 0xF0,
-    0x00, 0x1F, 0xE0, 0x00, 0x2F, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0xF9, 0x5B, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x00,
-    0xFF, 0x40, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x0B, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x1B,
-    0xD0, 0x01, 0xFB, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xF9, 0x60, 0x01, 0xFF, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA9, 0x40, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2E, 0x00, 0x0B, 0xF0, 0x00,
-    0x03, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00,
-    0x00, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xF0, 0x01, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0x95, 0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0x01, 0xFD,
-    0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x1F,
-    0xE0, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x07,
-    0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0xE0, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD1, 0xBD, 0x00, 0x00, 0x7E, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xE5, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x02, 0x40, 0x00, 0x00, 0x78, 0x02, 0xD0, 0x00, 0x00, 0x02, 0xF1, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xAA, 0x94, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xC0,
-    0x00, 0x2F, 0x40, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x01, 0xF0,
-    0x00, 0x1F, 0xE0, 0x00, 0x2F, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0xF9, 0x5B, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x00,
-    0xFF, 0x40, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x0B, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x07, 0x80, 0x0B, 0x80, 0xB8, 0x00, 0x0F, 0xEF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x1B,
-    0xD0, 0x01, 0xFB, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xF9, 0x60, 0x01, 0xFF, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x10, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x02, 0xFF, 0xAA, 0xBF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE9, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07,
-    0xF5, 0x45, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x0F, 0xF9, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x1E, 0x40, 0x7F, 0xC0, 0x1F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x4B, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFD, 0x40, 0x04, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0xBF, 0xEA, 0xAF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2E, 0x0F,
-    0x80, 0x00, 0x01, 0xE0, 0x07, 0xC0, 0x00, 0x09, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFA, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x01, 0xFD,
-    0x51, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x79, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFD, 0x40, 0x04, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x40, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0xBF, 0xEA,
-    0xAF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFA, 0x40, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x51, 0x40, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x90,
-    0x1F, 0xF0, 0x07, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1B,
-    0xFF, 0xE4, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x02, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x10, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x01, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x02, 0xFF, 0xAA, 0xBF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x80, 0x07, 0x80, 0x00, 0xB8, 0x0F, 0x40,
-    0x00, 0x0F, 0xEF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE9, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xF5, 0x45, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x1E, 0x40, 0x7F, 0xC0, 0x1F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0A, 0x95, 0x0B, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00,
-    0x07, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF4,
-    0x00, 0x0C, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x7F, 0xD0,
-    0x00, 0x1A, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0B, 0x40, 0x0B, 0x40, 0x00,
-    0x00, 0x0F, 0x41, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xA9,
-    0x50, 0xBF, 0x00, 0x15, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x70, 0x3E, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x00, 0xBD, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00,
-    0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0A, 0x95, 0x0B, 0xF0, 0x05, 0x50,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xF0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x14, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x03, 0x80, 0x00, 0x00, 0x00, 0x78, 0xB0, 0x34, 0x00,
-    0x00, 0x00, 0x0F, 0x07, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4,
-    0x00, 0x00, 0x6A, 0x90, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF,
-    0xC0, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFC,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xFE,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBF,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0xFF, 0xD0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x01, 0xC0, 0x00, 0x2F, 0xB0, 0x2C, 0x00,
-    0x03, 0xC3, 0x83, 0x80, 0x00, 0xB4, 0x2E, 0xF0, 0x00, 0x0F, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F,
-    0x80, 0x7E, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x07, 0xF0, 0x0F, 0xC0,
-    0x00, 0xBE, 0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x02, 0xFD, 0x02, 0xFC, 0x00, 0xBF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF,
-    0x7F, 0x00, 0x07, 0xFF, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80,
-    0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0xFF, 0xD0,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x2B, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xF4, 0x02, 0xF0,
-    0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0x0B,
-    0xD0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x03,
-    0xE0, 0x00, 0x3F, 0x40, 0x1F, 0x80, 0x02, 0xFD, 0x00, 0xBF, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xDF, 0xC0,
-    0x00, 0x7F, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1D,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x02,
-    0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x00,
-    0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFE, 0x55,
-    0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0xF0,
-    0x00, 0x2E, 0x00, 0x07, 0x40, 0x00, 0xBD, 0x00, 0xBC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00,
-    0xBC, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x7E, 0x00,
-    0x02, 0xF4, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x02, 0xF8,
-    0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xE0, 0x00, 0xBF, 0x40, 0x2F, 0xC0, 0x0B, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF7,
-    0xF0, 0x00, 0x1F, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x34, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F,
-    0xD0, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFE,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
-    0xF4, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x74, 0xD0, 0x00, 0x00, 0x0D, 0x0A,
-    0x00, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x3F, 0x00,
-    0xBC, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x02,
-    0xFD, 0x02, 0xFC, 0x00, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x2F,
-    0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0x7F, 0x00, 0x07, 0xFF, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0xBF,
-    0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90,
-    0x00, 0x06, 0x80, 0x01, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x2F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x06, 0x90, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0xBD, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00,
-    0xBC, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x00,
-    0x1F, 0x80, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0x7F, 0x00,
-    0x00, 0x07, 0xFF, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0xBD, 0x00, 0x03,
-    0xF0, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x0F, 0x80, 0x00, 0xFD, 0x01, 0xF8,
-    0x00, 0x2F, 0xD0, 0x2F, 0xC0, 0x0B, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF7, 0xF0, 0x00, 0x7F, 0xF8, 0x7F, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x01, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x40, 0x01, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0xF4, 0x00,
-    0xFF, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0xFE, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x40, 0xBF, 0xFF, 0xC0,
-    0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x7F, 0xEF, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x3F, 0xE3, 0xFC,
-    0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xF0, 0xFF, 0x4B, 0xF4, 0x00, 0x00, 0xFF, 0x6F, 0xF4, 0x3F,
-    0xE7, 0xFC, 0x00, 0x00, 0x3F, 0xEF, 0xF8, 0x0F, 0xFB, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xD0,
-    0x0B, 0x40, 0x00, 0x00, 0x09, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x07,
-    0xF0, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x28, 0x00, 0xFE,
-    0x01, 0xFC, 0x03, 0xF4, 0x07, 0xF0, 0x07, 0xF0, 0x3F, 0xF0, 0x3F, 0x80, 0x1F, 0xC3, 0xFF, 0xD1,
-    0xFC, 0x00, 0x7F, 0x3F, 0xFF, 0xCF, 0xE0, 0x01, 0xFE, 0xFF, 0xFF, 0xBF, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x7F, 0xFC, 0x3F, 0xFD, 0x00, 0x01, 0xFF,
-    0xC0, 0xFF, 0xF0, 0x00, 0x0B, 0xFD, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x4F,
-    0xF0, 0x00, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x0F,
-    0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x2F,
-    0xE0, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x4B, 0xF8, 0x00, 0x00, 0x3F,
-    0xE7, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3D, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x2D, 0x00, 0x00, 0x01, 0x80, 0x00, 0x60, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x03, 0xF0,
-    0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC2, 0xFC,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD3, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00,
-    0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x03, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0x00,
-    0x03, 0xF8, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x02,
-    0xFD, 0x00, 0x00, 0x3F, 0xD2, 0xFE, 0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x40, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0xB0, 0x00, 0x00, 0x3C, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xA0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01, 0xFD, 0x04, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xFF, 0x40, 0x0B, 0xFE,
-    0x00, 0x7D, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xFC, 0x0B, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x0F, 0xF4, 0x0D, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x50,
-    0x16, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x1B,
-    0xFE, 0x00, 0x38, 0x00, 0x2F, 0xFF, 0xF4, 0x1C, 0x00, 0x7F, 0xEA, 0xFF, 0x1E, 0x00, 0x3F, 0x40,
-    0x07, 0xFF, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0x0F, 0xF9, 0x56, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF,
-    0xEA, 0xFF, 0xFC, 0x00, 0x7F, 0xFD, 0x00, 0x07, 0xF4, 0x03, 0xFB, 0xF0, 0x00, 0x0B, 0xE0, 0x1F,
-    0x5F, 0xC0, 0x00, 0x1F, 0x80, 0xB8, 0xFE, 0x00, 0x00, 0xBE, 0x03, 0xC3, 0xF4, 0x00, 0x03, 0xF0,
-    0x0F, 0x1F, 0xC0, 0x00, 0x3F, 0xC0, 0x24, 0xBF, 0x00, 0x1B, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xAA,
-    0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x1B, 0x90, 0x00, 0x00, 0x0B, 0xD7, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xBF, 0xEB, 0xF0,
-    0x00, 0x00, 0xFF, 0xE0, 0x03, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0xE0, 0x00,
-    0x2E, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0xE0,
-    0x00, 0x1F, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xD0, 0x00, 0x1F,
-    0xFF, 0x40, 0xBF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x2F, 0xDF, 0xFF, 0xF8, 0x00, 0x00, 0xFD, 0x1F, 0xFF, 0x40, 0x00, 0x07, 0xF0, 0x01, 0x40, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFB, 0xF0, 0x01, 0x50, 0x2F, 0x40, 0x3F, 0x80, 0x00, 0x00, 0x70,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0A, 0x95, 0x0B, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0xFF, 0x80, 0x00, 0x07, 0xFD, 0x1D, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC3, 0xD0, 0x02, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x1F, 0xF5, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 0x55,
-    0xBF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x40, 0x00,
-    0xBD, 0x74, 0x0B, 0xC0, 0x00, 0x3F, 0x7C, 0x03, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x7F,
-    0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x7E, 0x00, 0x0B, 0xF0,
-    0x00, 0x2F, 0xC0, 0x0B, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF7, 0xF0, 0x00, 0x01, 0xFF, 0xE1, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00,
-    0x05, 0x00, 0x00, 0x64, 0x07, 0xC0, 0x3D, 0x03, 0xE0, 0x2F, 0x01, 0xF4, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0x0F, 0x80, 0x1E, 0x00, 0x7C, 0x0A, 0x00, 0x02,
-    0x80, 0x02, 0xF4, 0x07, 0x02, 0xEF, 0x02, 0xC0, 0xE0, 0xD0, 0xE0, 0xB4, 0x2E, 0xF0, 0x3C, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0x4F, 0x00, 0x03, 0xC3, 0xE0, 0x07, 0xD0,
-    0xBF, 0xFF, 0xE0, 0x0F, 0xFF, 0xD0, 0x00, 0x6A, 0x40, 0x00, 0x0F, 0xD1, 0xFC, 0x3F, 0xC7, 0xFC,
-    0xBF, 0x80, 0x0B, 0xD0, 0x0B, 0xD0, 0xFD, 0x00, 0xFD, 0x2F, 0xD0, 0x2F, 0xC3, 0xFC, 0x03, 0xFC,
-    0xBF, 0xC0, 0xBF, 0xC0, 0x2F, 0xD1, 0x41, 0xC0, 0x0F, 0x01, 0xF0, 0x0E, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x0D, 0x0C, 0x28, 0x0C, 0x34, 0x2C, 0x2F, 0xF0, 0x0B, 0x80, 0x00, 0xBD, 0x00, 0x00, 0xBC,
-    0x02, 0xF4, 0x00, 0x02, 0xF4, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x50,
-    0x00, 0x00, 0x50, 0x00, 0x74, 0x00, 0x2D, 0x2E, 0x01, 0xF0, 0x0F, 0x9F, 0x80, 0x03, 0xFD, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x90, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0,
-    0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xD0, 0x01, 0xAD, 0x00, 0x01, 0xAD,
-    0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x02, 0xFE, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0xFF, 0xC0,
-    0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x3F, 0xD0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF,
-    0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x60, 0x02, 0xC1, 0x5F, 0x0F, 0xF4, 0x01, 0xC0, 0x0B,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0xE0, 0x02, 0xD5, 0x07, 0xFC, 0x0D, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0xBF, 0xA9, 0x50, 0xFF, 0xFF, 0xFD, 0x05, 0x55, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00,
-    0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0D, 0x00, 0xC0, 0x2C, 0x0B, 0x43, 0xE0, 0x24, 0x00,
-    0x07, 0x47, 0x03, 0x40, 0xC0, 0x2C, 0x01, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x34, 0x1F, 0xE0, 0x2F,
-    0xF4, 0x01, 0xA0, 0xA4, 0x02, 0xFF, 0x80, 0xBF, 0x02, 0xC0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x24, 0x0F, 0xFC, 0x03, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x41, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0xFD, 0x2F, 0xD3, 0xFC, 0xBF,
-    0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x2F, 0xC0, 0x2F, 0xC0, 0xFF, 0x00, 0xFF, 0x07, 0xFC, 0x0B, 0xFC,
-    0x2F, 0xE0, 0x2F, 0xE0, 0x02, 0xF4, 0x0D, 0x0C, 0x28, 0x0C, 0x34, 0x2C, 0x2F, 0xF0, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F,
-    0xF0, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x03, 0x00, 0x08, 0x00, 0x0F,
-    0xE0, 0x00, 0x34, 0x00, 0x34, 0x2B, 0xE0, 0xBF, 0x80, 0x00, 0x24, 0x01, 0xE0, 0x07, 0x80, 0x0E,
-    0x00, 0x2C, 0x00, 0x1F, 0xF0, 0x06, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x3D, 0x0B, 0xC0, 0xFC, 0x1F,
-    0x82, 0xF4, 0x3F, 0x02, 0xA0, 0x0A, 0xAA, 0xA0, 0x7F, 0xFF, 0xC2, 0xD0, 0x1E, 0x0F, 0x00, 0xB4,
-    0x28, 0x02, 0x80, 0x60, 0x00, 0x19, 0x3D, 0x00, 0xB4, 0x0F, 0x4B, 0xC0, 0x07, 0xFE, 0x00, 0x02,
-    0xF8, 0x00, 0x01, 0xE0, 0x00, 0x01, 0x90, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0x9F,
-    0x40, 0x3D, 0x02, 0xE0, 0xB4, 0x00, 0x2C, 0x02, 0xF4, 0x07, 0x02, 0xEF, 0x02, 0xC0, 0xE0, 0xD0,
-    0xE0, 0xB4, 0x2E, 0xF0, 0x3C, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xE2, 0xAA, 0xA5, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x07, 0x02, 0xEF, 0x02, 0xC0, 0xE0, 0xD0, 0xE0, 0xB4, 0x2E, 0xF0, 0x3C, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xC0,
-    0x38, 0x03, 0x80, 0x30, 0x0C, 0x0F, 0x01, 0x00, 0x14, 0x01, 0x40, 0xF0, 0x0B, 0x42, 0xD0, 0x1E,
-    0x07, 0xEA, 0xFC, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC1, 0xC0, 0x0E, 0x0B, 0x00,
-    0x34, 0x38, 0x01, 0xC0, 0xD0, 0x0B, 0x07, 0xFF, 0xF8, 0x05, 0x55, 0x40, 0x03, 0xE1, 0x80, 0x28,
-    0x74, 0x80, 0xC1, 0x83, 0x06, 0x08, 0x28, 0x34, 0x30, 0xD0, 0x40, 0x42, 0x00, 0x06, 0x08, 0x03,
-    0x74, 0x02, 0xD0, 0x03, 0xC0, 0x0D, 0xE0, 0x74, 0x70, 0x02, 0xF4, 0x07, 0x02, 0xEF, 0x02, 0xC0,
-    0xE0, 0xD0, 0xE0, 0xB4, 0x2E, 0xF0, 0x3C, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x07, 0xC0,
-    0x30, 0x7C, 0x24, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x0B, 0xD0, 0xFD, 0x00, 0xFD, 0x2F, 0xD0, 0x2F, 0xC3, 0xFC, 0x03, 0xFC, 0xBF, 0xC0,
-    0xBF, 0xC0, 0x2A, 0xAA, 0x93, 0xFF, 0xFD, 0x3C, 0x03, 0xC7, 0x80, 0x3C, 0xA0, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0xAF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFD, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x42, 0xF0,
-    0x0B, 0xC0, 0xF8, 0x03, 0xF0, 0x7D, 0x00, 0xF8, 0x3F, 0x00, 0xBC, 0x0F, 0xC0, 0x3F, 0x07, 0xE0,
-    0x1F, 0x81, 0xA0, 0x06, 0x90, 0x19, 0x55, 0x02, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x01, 0xF8, 0x00,
-    0x2F, 0x40, 0x03, 0xF4, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x01, 0x80, 0x02, 0xF4, 0x3B, 0x00,
-    0xBB, 0xCD, 0xB0, 0x0E, 0x0F, 0xCE, 0x02, 0xD0, 0xBF, 0xC0, 0x3C, 0x0F, 0xF4, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0x90, 0x00, 0x03, 0xF4, 0x03, 0xFF, 0xAF, 0xE0, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x0F, 0xE0,
-    0x02, 0xFC, 0x03, 0xFC, 0x00, 0x0B, 0xFA, 0xFF, 0xC0, 0x2F, 0xD0, 0x00, 0x06, 0xFF, 0xE4, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x3D, 0x01, 0xFC, 0x2F, 0x00, 0x7C, 0x03, 0xF0, 0x0F, 0x81, 0xF4, 0x0B,
-    0xC0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x01, 0x40, 0x0F, 0xEB, 0xD0, 0x07, 0xD0, 0x3F, 0x00, 0xF4,
-    0x0F, 0x80, 0xBD, 0x00, 0x7F, 0xFF, 0x00, 0x58, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x3D, 0x0C, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x06, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0x0B, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x01, 0xF5, 0x00, 0x01, 0xBF, 0x40, 0x00,
-    0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x40,
-    0x00, 0x02, 0xE5, 0x00, 0x05, 0xBE, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0xD0, 0x34, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x20, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40,
-    0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0B,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80,
-    0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0x55, 0x55,
-    0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFD, 0x00,
-    0x07, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x80,
-    0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFC,
-    0x00, 0x02, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x3F,
-    0x00, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xE0, 0x0F,
-    0xD0, 0x00, 0x03, 0xFD, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00,
-    0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x41, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x0F, 0xF0,
-    0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0xBF,
-    0x40, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x00, 0x03,
-    0xFC, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF5, 0x56, 0xA0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xA8,
-    0x00, 0x00, 0x02, 0xA0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xFE, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFE, 0x55, 0x55, 0x6F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF,
-    0x40, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xBF,
-    0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02,
-    0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x05,
-    0x60, 0x0F, 0xD0, 0x03, 0xF4, 0x2F, 0xFF, 0xF0, 0x1F, 0xC0, 0x07, 0xF0, 0x7F, 0xFF, 0xA0, 0x2F,
-    0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
-    0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xF0,
-    0x00, 0x7F, 0xE0, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x00, 0x01, 0xFC,
-    0x00, 0xFF, 0x40, 0x00, 0x0F, 0xE0, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0x80, 0x00, 0x02,
-    0xFC, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0x43, 0xFC, 0x00, 0x00,
-    0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xD0, 0x00,
-    0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF3, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0x8B, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x0F, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x2F, 0xFF, 0x00, 0x00,
-    0x7F, 0x80, 0x3F, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xFD, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xFC,
-    0x00, 0xBF, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x2F,
-    0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x00,
-    0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x0F,
-    0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x03,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x02,
-    0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x2A, 0x40, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0xAA,
-    0x80, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x1F, 0xDF, 0xF4, 0x00,
-    0xFF, 0xBF, 0x40, 0x00, 0xBE, 0x7F, 0xE0, 0x0B, 0xFA, 0xFD, 0x00, 0x03, 0xF8, 0xFF, 0x80, 0x7F,
-    0xCF, 0xF0, 0x00, 0x1F, 0xD3, 0xFF, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xBF, 0x0F, 0xFC, 0x2F, 0xE2,
-    0xFE, 0x00, 0x03, 0xFC, 0x3F, 0xF1, 0xFF, 0x0F, 0xF8, 0x00, 0x1F, 0xE0, 0xBF, 0xDF, 0xF4, 0x7F,
-    0xD0, 0x00, 0xBF, 0x82, 0xFF, 0xFF, 0xC2, 0xFF, 0x00, 0x03, 0xFD, 0x07, 0xFF, 0xFC, 0x0F, 0xFC,
-    0x00, 0x1F, 0xF0, 0x0F, 0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xFF, 0x02, 0xFF, 0x80,
-    0x03, 0xFE, 0x00, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0x0F, 0xF4, 0x03, 0xFF, 0x80, 0x7F, 0xF0, 0x00,
-    0xBF, 0xD0, 0x0B, 0xFC, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x2F, 0xD0, 0x0F, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x2F, 0xD0,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x1F,
-    0xEB, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC3, 0xF8,
-    0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x83, 0xFC, 0x03, 0xFC,
-    0x00, 0x00, 0xFF, 0x42, 0xFD, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x02,
-    0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x07, 0xFD, 0x00,
-    0xFF, 0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0x7F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x15, 0x55, 0x55, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x00,
-    0xF4, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x03, 0xE0,
-    0x00, 0xF4, 0x00, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x03,
-    0xE0, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x0B, 0xC0,
-    0x00, 0x2F, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x1F, 0x00, 0x00,
-    0x7C, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x01, 0xF4,
-    0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x1F, 0xEA, 0xFF, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xF0,
-    0x00, 0x0B, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0x03,
-    0xF4, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x1B, 0xFD, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xAA, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xC0,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x0A, 0x95, 0x0B, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x7F,
-    0x40, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF,
-    0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0xFF,
-    0x4B, 0xF8, 0x00, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xAF, 0x06, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0x42, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x3D, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0xD0, 0x07, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0xBC, 0x00, 0x07,
-    0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x40, 0x01, 0xF0, 0x00,
-    0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x03, 0xE0,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x3D, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x0B,
-    0xC0, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFE, 0x00,
-    0x0F, 0x40, 0x1B, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0x56, 0xF5, 0xAF, 0xFF, 0xD0, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xA0, 0x00, 0xE0, 0x00, 0xE0, 0x0F, 0xC0,
-    0x07, 0x80, 0x07, 0xC0, 0x3D, 0x00, 0x2D, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF4, 0x07,
-    0xC0, 0x07, 0x80, 0x07, 0xC0, 0x2E, 0x00, 0x2D, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0xF0, 0x02, 0xF4,
-    0x03, 0xE0, 0x03, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1E, 0x00, 0xFE, 0x00, 0x3F, 0x40, 0xF0, 0x0F,
-    0xF0, 0x00, 0xBF, 0x43, 0xC1, 0xFF, 0x40, 0x01, 0xFF, 0xAF, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6F, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x2F, 0x80, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x40,
-    0x1F, 0xF4, 0x00, 0x02, 0xFF, 0xFC, 0x02, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0,
-    0x07, 0xFF, 0xF4, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xDF, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x40,
-    0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0F,
-    0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xD0, 0x00,
-    0x2F, 0xD0, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD6, 0xBF, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF2, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x9E, 0x05, 0x03, 0xFF, 0xFE, 0x7E, 0xFF, 0xF4,
-    0x02, 0xFF, 0x91, 0xFB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x2F,
-    0x80, 0x00, 0x2F, 0x40, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x3C, 0x00, 0x0B, 0xD0, 0x00, 0x1F,
-    0x00, 0x03, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x7E, 0x01, 0x6F, 0xC0,
-    0x00, 0x2F, 0x42, 0xFF, 0x40, 0x00, 0x0F, 0xC0, 0xFF, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80,
-    0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40,
-    0x1F, 0xF4, 0x00, 0x2F, 0xC0, 0x0B, 0xFF, 0xD0, 0x2F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7E, 0x2F, 0xFF, 0xFC, 0x00, 0x2F, 0x40, 0x7F, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0x54, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0xF8, 0xF8, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0xBD, 0x2F, 0x40,
-    0x03, 0xF0, 0x7E, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0xBD, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xD0, 0x2F,
-    0x80, 0x2F, 0x81, 0xFC, 0x00, 0x7F, 0x0F, 0xD0, 0x01, 0xFE, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-    0x1F, 0xFF, 0x40, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x19, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0x45, 0xBF, 0x80, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x01, 0x7F,
-    0x40, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0B, 0xFD, 0x02, 0xFC, 0x00,
-    0x7F, 0xC0, 0x03, 0xF8, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0xBF, 0x00,
-    0x00, 0xBE, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x07, 0xFD,
-    0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0xBF, 0xE4, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0x96, 0xC0, 0x0F, 0x00, 0x30, 0x07, 0x00,
-    0x04, 0x01, 0xC0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xE8, 0x00, 0x0B, 0x80,
-    0x00, 0x03, 0xC0, 0x0F, 0x02, 0xE0, 0x07, 0xC0, 0xBC, 0x03, 0xF0, 0x1F, 0xEB, 0xF4, 0x03, 0xFF,
-    0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xD1,
-    0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x0B, 0xFE, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x07, 0xC0,
-    0x0F, 0xC0, 0x00, 0x7C, 0x02, 0xF4, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00,
-    0x0F, 0x80, 0x7E, 0x00, 0x01, 0xF4, 0x0F, 0xD0, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x1F,
-    0xC0, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x0B, 0xD0, 0x3F, 0x80, 0x00, 0xFD, 0x07, 0xF4, 0x00, 0x1F,
-    0xC0, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x07, 0xE4, 0x7D, 0x00, 0x00, 0xBD, 0x00, 0x3C, 0x00, 0x07, 0xD0, 0x00, 0xF4, 0x00, 0x3E, 0x00,
-    0x02, 0xE0, 0x02, 0xF0, 0x00, 0x0B, 0x80, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0xBD, 0x00, 0x00, 0xF8,
-    0x03, 0xF5, 0x55, 0x57, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x03, 0xF0,
-    0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x0F,
-    0xE0, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x2F, 0xF9, 0x6F, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x0F,
-    0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x0B, 0xE0,
-    0x03, 0xF4, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x3F, 0xE9, 0x1F, 0xFF, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0x2F, 0x0B, 0xD0, 0x00, 0x3D,
-    0x1F, 0x40, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xEF,
-    0xD0, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x2F, 0x4F, 0xF8, 0x00, 0x3F, 0x07, 0xFD, 0x00, 0x7E, 0x03,
-    0xFF, 0x00, 0xBD, 0x01, 0xFF, 0xC0, 0x6A, 0x90, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xFB, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0xFD, 0x00, 0x00, 0x00,
-    0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00,
-    0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x40,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00,
-    0x1F, 0x80, 0x00, 0xBD, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x02,
-    0xFC, 0x00, 0x0B, 0xE0, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x80, 0x02, 0xFD, 0x00, 0x3F,
-    0xF0, 0x02, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xEF,
-    0xFF, 0xFF, 0xF4, 0x01, 0xE7, 0xFF, 0xFD, 0xFC, 0x00, 0xF0, 0x7F, 0xF8, 0x7F, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x7E, 0x2F, 0x40, 0x02,
-    0xF4, 0xBE, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x7F, 0x03, 0xF0, 0x03, 0xF4, 0x0F, 0xD0, 0x1F, 0xC0,
-    0x3F, 0x80, 0xFE, 0x00, 0xBF, 0x0B, 0xF0, 0x01, 0xFC, 0x7F, 0x40, 0x07, 0xFF, 0xF8, 0x00, 0x1F,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFD, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3F,
-    0x90, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xE5, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x7F, 0xEA, 0xFF, 0x40,
-    0x0F, 0xD0, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC1, 0xF4, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x03, 0xF0, 0x3F,
-    0x40, 0x00, 0xFE, 0x03, 0xFE, 0x55, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xD0, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x02,
-    0xF0, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x03, 0xF0, 0x00,
-    0x07, 0xC0, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x07, 0xC0,
-    0x1F, 0x40, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0xF8, 0x03, 0xFF, 0x80, 0x0B, 0xC0, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x02, 0xF0, 0x00, 0x00, 0x3F,
-    0x40, 0x03, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x7D, 0x00, 0x00,
-    0xFE, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x7E, 0x00,
-    0x00, 0xFF, 0x40, 0x03, 0xF0, 0x00, 0x0B, 0xFF, 0x40, 0x7F, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xE7, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0x07, 0xFF,
-    0x80, 0x00, 0x03, 0xFC, 0x00, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x40, 0x7E, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0x41, 0xF0, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F,
-    0xEA, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x55, 0xBF, 0xC0, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x01, 0xD0, 0x0B, 0x80, 0x03,
-    0xC0, 0x3D, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x3C, 0x07, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x03, 0xC0,
-    0xB8, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0xB8, 0x0F, 0x40, 0x03, 0xE0, 0x7C, 0x00, 0x0F, 0x41, 0xF0,
-    0x00, 0xBC, 0x0B, 0xE0, 0x0B, 0xF0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xDB, 0x42, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x0F, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8,
-    0x0F, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0, 0x1E, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x2E, 0x00,
-    0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x2D, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x3C, 0x00, 0x0F, 0xD0,
-    0x03, 0xFC, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x78, 0x00, 0x1F, 0xC0, 0x07, 0xF0,
-    0x00, 0xB4, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0xF0, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00, 0xF0,
-    0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xE0, 0x03, 0xFD,
-    0x00, 0x0F, 0xF4, 0x02, 0xD0, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x53, 0xD5, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE4, 0x00, 0x00, 0x2E, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x2F, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x2F, 0x40, 0x00, 0x00,
-    0x0F, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x9F, 0x80,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF4, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x3F,
-    0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0xB8, 0x2D, 0x03, 0x80, 0x2D, 0x0F, 0x00, 0xF0, 0x0F, 0x43, 0xC0,
-    0x3C, 0x03, 0xC0, 0xF0, 0x0F, 0x41, 0xF0, 0x78, 0x03, 0xC0, 0xBC, 0x2D, 0x00, 0xF0, 0x2E, 0x0B,
-    0x40, 0x7C, 0x0F, 0x43, 0xC0, 0x2F, 0x03, 0xD0, 0xF0, 0x0F, 0x81, 0xF4, 0x78, 0x03, 0xD0, 0x7E,
-    0x1E, 0x03, 0xF0, 0x2F, 0xFF, 0xAB, 0xF8, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x14, 0x00, 0x03, 0xF4, 0x00, 0x01,
-    0xF0, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xF0, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0xC0, 0x0D, 0x00, 0x1F, 0x02, 0xF4, 0x01, 0xC0,
-    0x02, 0xF0, 0x3F, 0x00, 0x2C, 0x00, 0x3E, 0x03, 0xF0, 0x03, 0x80, 0x0B, 0xD0, 0x3E, 0x00, 0xB8,
-    0x01, 0xFC, 0x03, 0xF4, 0x2F, 0xC1, 0xBF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xF6,
-    0xFF, 0xF4, 0x00, 0x01, 0xA9, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0,
-    0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x0F,
-    0xD0, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x00,
-    0x3F, 0x80, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0xF8, 0x00,
-    0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x01, 0xF8, 0x0F,
-    0x80, 0x00, 0x3F, 0x80, 0xF4, 0x00, 0x0B, 0xF4, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0x5A, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x0B,
-    0xFE, 0x47, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x52, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xE0,
-    0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x00, 0x00, 0x00, 0x14, 0x2C, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFD,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0xF8,
-    0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x01, 0xF8,
-    0x0F, 0x80, 0x00, 0x3F, 0x80, 0xF4, 0x00, 0x0B, 0xF4, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0x5A,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x7E, 0x00,
-    0x0B, 0xFE, 0x47, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD6, 0xBF, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xE7, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x91, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC2, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x40, 0x00,
-    0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFE,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F,
-    0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0xC0,
-    0x00, 0x00, 0x3C, 0x00, 0xB4, 0x00, 0x00, 0x60, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
-    0xD0, 0x2F, 0xE0, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00,
-    0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x3F,
-    0x80, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xF5, 0xAF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x00,
-    0xBF, 0xE4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x18, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x00,
-    0x0A, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02,
-    0xFF, 0xFD, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x7F, 0x00,
-    0x0F, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x0F,
-    0xC0, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x00, 0xBF, 0x40,
-    0x0F, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xF5, 0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x00, 0xBF, 0xE4, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x0D, 0x00, 0x00, 0x00, 0x1F, 0xB4, 0x1C, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x3C,
-    0x00, 0x00, 0x00, 0x78, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xB4, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x6F, 0x40,
-    0x00, 0x00, 0x00, 0x3C, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00,
-    0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xC0,
-    0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00,
-    0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0xF8, 0x03, 0xC0, 0x00, 0x3E, 0xF0, 0x38, 0x00, 0x0B, 0x47, 0x4B, 0x00, 0x00, 0xF0, 0x3F, 0xE0,
-    0x00, 0x0E, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00,
-    0x00, 0xF4, 0x07, 0xC0, 0x00, 0x18, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF,
-    0xFD, 0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xF0, 0x00, 0xFD, 0x00,
-    0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x01,
-    0xF8, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0xF4, 0x00, 0x0B, 0xF4, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0xFF,
-    0x5A, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x7E,
-    0x00, 0x0B, 0xFE, 0x47, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0x80, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0xC3, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00,
-    0x00, 0x07, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0xBF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0xBF, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x03, 0xD0, 0x0B, 0x40, 0x00, 0x66, 0xFE,
-    0x1D, 0x00, 0x02, 0xFF, 0xFD, 0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x07,
-    0xF0, 0x00, 0xFD, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x0F,
-    0xC0, 0x7C, 0x00, 0x01, 0xF8, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0xF4, 0x00, 0x0B, 0xF4, 0x0F, 0x80,
-    0x03, 0xFF, 0x00, 0xFF, 0x5A, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x0B, 0xFE, 0x47, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x28, 0x00, 0x02, 0xD0, 0x00, 0x78,
-    0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x00, 0xF8, 0x00, 0x0F,
-    0xC0, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x1F, 0x80,
-    0x0F, 0x80, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0x0F,
-    0xF5, 0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFE, 0x7E, 0x00, 0x00, 0xBF, 0xE4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF4,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x2F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x3F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x07,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x90, 0x00, 0x28, 0x00, 0x02, 0xD0, 0x00, 0x78, 0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x02, 0xFF, 0xFD, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00,
-    0x7F, 0x00, 0x0F, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xD0,
-    0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x00,
-    0xBF, 0x40, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xF5, 0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x00, 0xBF, 0xE4, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x2C, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x03, 0xFA, 0xBC, 0x00, 0x00, 0x01, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x74, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x03, 0xF0, 0x07, 0xE0,
-    0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x00, 0xF8, 0x00,
-    0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x1F,
-    0x80, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x0F, 0x80, 0x03, 0xFF, 0x00,
-    0x0F, 0xF5, 0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFE, 0x7E, 0x00, 0x00, 0xBF, 0xE4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0D, 0x00, 0x00, 0x00, 0x02, 0xE3, 0x81, 0xC0, 0x00, 0x00, 0x00,
-    0x3C, 0x1C, 0x3C, 0x00, 0x00, 0x00, 0x07, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x74, 0x02, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x02,
-    0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF3,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x2F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x14, 0x00, 0x00, 0x2F, 0xD0, 0x3C, 0x00, 0x00, 0x3C, 0xB0, 0x38, 0x00, 0x00, 0xB0,
-    0x38, 0xB0, 0x00, 0x00, 0xF0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x28,
-    0x00, 0x02, 0xD0, 0x00, 0x78, 0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFF,
-    0xFD, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x7F, 0x00, 0x0F,
-    0xD0, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x0F, 0xC0,
-    0x07, 0xC0, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x0F,
-    0x80, 0x03, 0xFF, 0x00, 0x0F, 0xF5, 0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x00, 0xBF, 0xE4, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD3,
-    0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0,
-    0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x28, 0x00, 0x02, 0xD0, 0x00, 0x78, 0x00, 0x02, 0xF0, 0x01,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
-    0xD0, 0x2F, 0xE0, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00,
-    0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x3F,
-    0x80, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xF5, 0xAF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x00,
-    0xBF, 0xE4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x56, 0xA0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xD0,
-    0x0F, 0x00, 0x07, 0xE0, 0x00, 0x74, 0x01, 0xF4, 0x00, 0x03, 0xC0, 0x3E, 0x00, 0x5A, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0x95, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x18, 0x01, 0xFF,
-    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x24, 0x38, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x55, 0xA8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x80, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0xF0, 0x00, 0x7E, 0x00, 0x07,
-    0x40, 0x1F, 0x40, 0x00, 0x3C, 0x03, 0xE0, 0x05, 0xAF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x81, 0xF9, 0x54, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x01, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x50, 0x00, 0x00, 0x01, 0xFE, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x2D, 0x0E, 0x00, 0x00, 0x00, 0xB0,
-    0x3E, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD5, 0x5A, 0x80, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x3C, 0x00, 0x00, 0xFB, 0x80, 0xE0, 0x00, 0x0B, 0x47, 0x07, 0x00, 0x00, 0x3C,
-    0x0F, 0xFC, 0x00, 0x01, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0x40,
-    0x3C, 0x00, 0x07, 0xE0, 0x00, 0x74, 0x00, 0x7D, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x05, 0xAF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xE5, 0x50, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x06,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0x9F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x40, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x55, 0x6A, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x07, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x03, 0xE0, 0x05, 0xAF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0x95, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xB8,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x50, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x56, 0xA0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x3D, 0x7D, 0x00, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0x2C, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0x00, 0x01, 0xF8, 0x00,
-    0x1D, 0x00, 0x1F, 0x40, 0x00, 0x3C, 0x00, 0xF8, 0x01, 0x6B, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x01, 0xF9, 0x54, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x01, 0x80, 0x07, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00,
-    0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x40, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x6A, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x50,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x2D, 0x00, 0xB4, 0x00, 0x00, 0x09, 0x00, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x40, 0x3C, 0x00, 0x00, 0x7E, 0x00, 0x07, 0x40, 0x00,
-    0x7D, 0x00, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x5A, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xE5, 0x50, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x06, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1B,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x0E, 0x00,
-    0x00, 0x00, 0x78, 0xE0, 0x70, 0x00, 0x00, 0x03, 0xC1, 0xC3, 0xC0, 0x00, 0x00, 0x1D, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x55, 0xA8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xD0, 0x00,
-    0x1F, 0xB0, 0x1C, 0x00, 0x03, 0xC3, 0xC3, 0xC0, 0x00, 0x78, 0x1F, 0xF4, 0x00, 0x0B, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0x1F, 0x40,
-    0x00, 0x07, 0x80, 0x1E, 0x00, 0x00, 0x90, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x02, 0xFD, 0x00, 0xF0, 0x00, 0x7E, 0x00, 0x07, 0x40, 0x1F, 0x40, 0x00, 0x3C, 0x03, 0xE0, 0x05,
-    0xAF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x81, 0xF9, 0x54, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x01,
-    0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x06,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x2E, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x54, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x55, 0xA8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xB4, 0x00, 0x00,
-    0x0F, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x03, 0xC0, 0x00, 0x07, 0xE0,
-    0x00, 0x74, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0x00, 0x03, 0xE0, 0x05, 0xAF, 0xC0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7E, 0x55, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x60, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x14, 0x2C, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x01, 0x42, 0xC0,
-    0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x03,
-    0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x03,
-    0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF,
-    0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x7F, 0xEA, 0xFF, 0x40, 0x0F, 0xD0, 0x01, 0xF8, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x7D, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0xFC, 0x2F,
-    0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0xFE, 0x03, 0xFE, 0x55, 0xBF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0B,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x01, 0x41, 0xC0, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x0B,
-    0xFF, 0xFD, 0x00, 0x07, 0xFE, 0xAF, 0xF4, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0xFC,
-    0x07, 0xD0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0xFC, 0x1F, 0x40, 0x00, 0x0F, 0xC2, 0xF0, 0x00,
-    0x02, 0xF4, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x0F, 0xE0, 0x3F, 0xE5, 0x5B, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0x80, 0x00,
-    0x07, 0xFF, 0xFB, 0xFF, 0xF0, 0x00, 0xB4, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x1F, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xFC, 0x03, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0xF8,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x2F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x1F, 0x6F, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x55, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xB0,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0xBC, 0x00, 0x00, 0x03, 0xC0, 0x3D, 0x00,
-    0x00, 0x3C, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xEA, 0xFF,
-    0x40, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x03, 0xF0, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0xFF, 0x95, 0x6F, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFB, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x08, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x03, 0xD0,
-    0x0B, 0x40, 0x00, 0x06, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xEA, 0xFF, 0x40, 0x00,
-    0xFD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0x3F, 0xE5, 0x5B, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0xB4, 0xE0, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xB1, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xD0,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x40, 0x00, 0x1F, 0xF0, 0x2C, 0x00, 0x03, 0xC7, 0x43, 0x80, 0x00, 0xB4, 0x2F,
-    0xF0, 0x00, 0x0F, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x0B, 0x40, 0x2E, 0x00, 0x00, 0x90, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x07, 0xFE, 0xAF, 0xF4, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x3F, 0x00,
-    0x00, 0xFC, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0xFC, 0x1F, 0x40, 0x00, 0x0F, 0xC2,
-    0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x0F, 0xE0, 0x3F, 0xE5, 0x5B,
-    0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00,
-    0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x5F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF,
-    0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x1F, 0xFA, 0xBF, 0xD0, 0x00, 0xFD, 0x00, 0x1F,
-    0x80, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x1F,
-    0x40, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00,
-    0x3F, 0x80, 0x3F, 0xE5, 0x5B, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFD, 0x00,
-    0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00,
-    0x01, 0xE0, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x2F,
-    0xF8, 0x01, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF0, 0x2F, 0x80, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0xD0, 0x34, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD,
-    0x40, 0x5B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x6F, 0xF8, 0x00, 0xE0, 0x00, 0xBF,
-    0xFF, 0xD0, 0x70, 0x01, 0xFF, 0xAB, 0xFC, 0x78, 0x00, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0xFC, 0x00,
-    0x03, 0xF4, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x40, 0x00,
-    0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x03,
-    0xF8, 0x00, 0x3F, 0xE5, 0x5B, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x01, 0xBF,
-    0xFE, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x1F,
-    0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0xF0, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x1F, 0x40, 0x00,
-    0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x02, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x03, 0x40,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xD4, 0x05, 0xBF, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x06, 0xFF, 0x80, 0x0E, 0x00,
-    0x0B, 0xFF, 0xFD, 0x07, 0x00, 0x1F, 0xFA, 0xBF, 0xC7, 0x80, 0x0F, 0xD0, 0x01, 0xFF, 0xC0, 0x0F,
-    0xC0, 0x00, 0x3F, 0x40, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x01, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0,
-    0x00, 0x3F, 0x80, 0x03, 0xFE, 0x55, 0xBF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xE0,
-    0x00, 0x01, 0xFF, 0xFE, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x2F, 0xF8, 0x01,
-    0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF0, 0x2F, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0xD0, 0x34, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x40, 0x5B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x14,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x6F, 0xF8, 0x00, 0xE0, 0x00, 0xBF, 0xFF, 0xD0,
-    0x70, 0x01, 0xFF, 0xAB, 0xFC, 0x78, 0x00, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xF4,
-    0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0,
-    0x0B, 0xC0, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00,
-    0x3F, 0xE5, 0x5B, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0xE0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xC3, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x02, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xFF,
-    0x40, 0x0B, 0xFE, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xFC, 0x0B, 0xE0, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x0D, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x38, 0x00, 0x00, 0x0F, 0xB4, 0x1D,
-    0x00, 0x00, 0x0F, 0x0B, 0x0B, 0x00, 0x00, 0x03, 0x80, 0xFF, 0x80, 0x00, 0x01, 0xD0, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x00, 0x06, 0xFF, 0x80, 0x0E, 0x00, 0x0B, 0xFF, 0xFD, 0x07, 0x00, 0x1F, 0xFA, 0xBF, 0xC7, 0x80,
-    0x0F, 0xD0, 0x01, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0xBD, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x03, 0xFE, 0x55, 0xBF, 0xC0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x03, 0xC0,
-    0x00, 0x07, 0xFF, 0x40, 0x0B, 0xFE, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xFC, 0x0B,
-    0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x0D, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x1B, 0xFE, 0x00, 0x38, 0x00,
-    0x2F, 0xFF, 0xF4, 0x1C, 0x00, 0x7F, 0xEA, 0xFF, 0x1E, 0x00, 0x3F, 0x40, 0x07, 0xFF, 0x00, 0x3F,
-    0x00, 0x00, 0xFD, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x07, 0xD0,
-    0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40,
-    0x00, 0xFE, 0x00, 0x0F, 0xF9, 0x56, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF,
-    0xC0, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFE,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0xFF, 0xD0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0xBD, 0x00, 0x03, 0xF0, 0x0B,
-    0xC0, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x0F, 0x80, 0x00, 0xFD, 0x01, 0xF8, 0x00, 0x2F,
-    0xD0, 0x2F, 0xC0, 0x0B, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF7, 0xF0, 0x00, 0x7F, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0xFF, 0x80, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x3F, 0xF0, 0x00, 0x1F, 0xFE, 0x55, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x05, 0x0B, 0x00, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC,
-    0x03, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0xBC, 0x00,
-    0x07, 0xF0, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x02, 0xFD, 0x02,
-    0xFC, 0x00, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF,
-    0xF4, 0x01, 0xFF, 0xFF, 0x7F, 0x00, 0x07, 0xFF, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xD1,
-    0xD0, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x3D, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x50, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0xFF, 0xD0, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0xD0, 0x00, 0x2F, 0x5D, 0x02, 0xF0, 0x00, 0x0F, 0xDF,
-    0x00, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00,
-    0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00,
-    0x3E, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0x80, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x02, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFD, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F,
-    0xD1, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x3D, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x50, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0xFF, 0xD0, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x7D, 0x00, 0x02,
-    0xF5, 0xD0, 0x2F, 0x00, 0x00, 0xFD, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0xF0, 0x03, 0xF0, 0x00, 0x1F,
-    0xF0, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x01, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x2F, 0xC0,
-    0x00, 0xBF, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xDF, 0xC0, 0x00, 0x07, 0xFF, 0x87, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x09, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFD, 0x1D,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC3, 0xD0, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x50, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0xD0, 0x00, 0x2F, 0x5D, 0x02, 0xF0, 0x00, 0x0F, 0xDF,
-    0x00, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00,
-    0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00,
-    0x3E, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0x80, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x02, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFD, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x03, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0xB0, 0x34, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x07, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F,
-    0xD1, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x3D, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x50, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0xFF, 0xD0, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x01, 0xC0, 0x00, 0x00, 0xBE, 0xC0, 0xB0, 0x00, 0x00, 0x3C, 0x38, 0x38, 0x00, 0x00, 0x2D, 0x0B,
-    0xBC, 0x00, 0x00, 0x0F, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x7D, 0x00, 0x02,
-    0xF5, 0xD0, 0x2F, 0x00, 0x00, 0xFD, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0xF0, 0x03, 0xF0, 0x00, 0x1F,
-    0xF0, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x01, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x2F, 0xC0,
-    0x00, 0xBF, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xDF, 0xC0, 0x00, 0x07, 0xFF, 0x87, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0xFF,
-    0x80, 0x00, 0x07, 0xFD, 0x1D, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC3, 0xD0, 0x02, 0xFF, 0x00,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x1F, 0xF5, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0xBF,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x1F, 0x40, 0x00, 0xBD, 0x74, 0x0B, 0xC0, 0x00, 0x3F, 0x7C, 0x03, 0xF0, 0x00, 0x0F, 0xFC, 0x00,
-    0xFC, 0x00, 0x07, 0xFC, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x0B,
-    0xC0, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x7E,
-    0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x0B, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF7, 0xF0, 0x00, 0x01, 0xFF,
-    0xE1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x0F, 0xD3, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x00,
-    0x0B, 0xF0, 0x03, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xD0, 0x03,
-    0xFC, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xD2, 0xFE,
-    0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-    0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0x07,
-    0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x00,
-    0x2F, 0xC0, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x7F,
-    0x40, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00,
-    0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x2F,
-    0xD0, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3F,
-    0x00, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x2F,
-    0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x03, 0xF8, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0x40, 0x7F, 0xFD, 0x00, 0x0B, 0xF4, 0x0B, 0xE4,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x20, 0x38, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x4F, 0xF0,
-    0x00, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x0F, 0xF0,
-    0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xE0,
-    0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x4B, 0xF8, 0x00, 0x00, 0x3F, 0xE7,
-    0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x90, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x40,
-    0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xD0,
-    0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xFB, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xB0, 0x00, 0x00,
-    0x3E, 0xF0, 0x38, 0x00, 0x00, 0x1E, 0x1D, 0x1D, 0x00, 0x00, 0x0F, 0x03, 0xEF, 0x00, 0x00, 0x03,
-    0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x03, 0xF4, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x07, 0xF4, 0x00,
-    0x02, 0xFC, 0x00, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xF4, 0x00,
-    0xFF, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0x40, 0x00, 0x0F, 0xF4, 0xBF,
-    0x80, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x2C, 0x00, 0x00, 0x03, 0xD7,
-    0x03, 0x80, 0x00, 0x00, 0x78, 0x38, 0xB4, 0x00, 0x00, 0x0F, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xB0,
-    0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x0B,
-    0xD0, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xFD, 0x00, 0x00,
-    0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2A, 0xAA, 0xAA,
-    0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0,
-    0x00, 0xE0, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x01, 0xE0, 0x00, 0xF0,
-    0x00, 0x0B, 0x40, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x0B,
-    0x40, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x03,
-    0xC0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0xB4, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x00,
-    0x2D, 0x00, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0xB4, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x2D, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x02, 0xD0, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x00, 0xB4,
-    0x00, 0x7C, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xC0, 0x0F, 0xF8, 0x02, 0xFF,
-    0x00, 0x3F, 0xD0, 0x0B, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0F, 0xF0,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x3F, 0xF0,
-    0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xD0, 0x0B, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x3F, 0xE1, 0xFF, 0x40, 0x2F, 0xF0, 0xFF, 0xC0,
-    0x0F, 0xF4, 0x3F, 0xC0, 0x0B, 0xF8, 0x2F, 0xD0, 0x03, 0xFC, 0x0F, 0xF0, 0x01, 0xFF, 0x0B, 0xF8,
-    0x00, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE1, 0xFF, 0x40, 0x3F, 0xF0, 0xFF,
-    0xC0, 0x0F, 0xF4, 0x3F, 0xD0, 0x0B, 0xFC, 0x2F, 0xF0, 0x03, 0xFD, 0x0F, 0xF4, 0x01, 0xFF, 0x0B,
-    0xF8, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0xBF, 0x83, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0,
-    0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xD2, 0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xE0,
-    0x01, 0xFF, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0xFF, 0x43,
-    0xFD, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x02, 0xFE, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x1B, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0x95, 0x54, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x5F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xF5, 0x55, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xA0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x01, 0x55, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFD, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x6A, 0xAA, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0xFD, 0x00, 0x3F, 0xF4, 0x1F, 0xFF, 0x0F, 0xFF, 0x43, 0xF9, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0xFE, 0x1F, 0xE3, 0xFD, 0x7F, 0xD0, 0x07, 0xE0, 0xFE, 0x1F, 0xE3, 0xFD,
-    0x7F, 0xD0, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x1F,
-    0xE0, 0x00, 0xFF, 0x00, 0x1F, 0xD3, 0xFD, 0x00, 0x2F, 0xE0, 0x03, 0xFD, 0x7F, 0xD0, 0x03, 0xFE,
-    0x00, 0x7F, 0xC0, 0x3F, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x01, 0x60, 0x00, 0x01, 0xE0, 0x00, 0x06, 0x08, 0x00, 0x03, 0xC0, 0x00,
-    0x0C, 0x0C, 0x00, 0x0F, 0x00, 0x00, 0x18, 0x88, 0x00, 0x3C, 0x00, 0x00, 0x25, 0x68, 0x00, 0xF4,
-    0x00, 0x00, 0x34, 0x70, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x0B, 0x80, 0x00, 0x00, 0x1F, 0x80,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x48, 0x52, 0x04, 0x00, 0x00, 0x3E, 0x15, 0x15, 0x48, 0x00, 0x00,
-    0xFC, 0x22, 0x58, 0x94, 0x00, 0x03, 0xF0, 0x30, 0xCC, 0x30, 0x00, 0x0B, 0xC0, 0x3B, 0x8E, 0xE0,
-    0x00, 0x2F, 0x40, 0x2E, 0x07, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x0F, 0xFC, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE1, 0xFF, 0x40, 0x3F, 0xF0, 0xFF, 0xC0, 0x0F, 0xF4, 0x3F,
-    0xD0, 0x0B, 0xFC, 0x2F, 0xF0, 0x03, 0xFD, 0x0F, 0xF4, 0x01, 0xFF, 0x0B, 0xF8, 0x00, 0xFF, 0x03,
-    0xFC, 0x00, 0xBF, 0x83, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x40, 0x03, 0x40, 0x09, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x7E, 0x00, 0xFC, 0x01, 0xF4,
-    0x2F, 0x00, 0x3E, 0x00, 0xFC, 0x0F, 0x80, 0x1F, 0x00, 0x3D, 0x03, 0xC0, 0x0B, 0x80, 0x1F, 0x02,
-    0xD0, 0x03, 0x80, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x3F, 0x02,
-    0xF0, 0x0F, 0x80, 0xBC, 0x03, 0xC0, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0xA0, 0x3F,
-    0x03, 0xF0, 0x2F, 0x02, 0xF4, 0x0F, 0x40, 0xF8, 0x0B, 0xC0, 0xBC, 0x03, 0xC0, 0x3C, 0x01, 0xD0,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x0B, 0x00, 0x09, 0x03, 0xF0,
-    0x0F, 0xC0, 0x0F, 0xC0, 0xBC, 0x01, 0xF4, 0x03, 0xF0, 0x0F, 0x40, 0x3F, 0x00, 0x7D, 0x02, 0xF0,
-    0x07, 0xC0, 0x0F, 0x80, 0x3C, 0x00, 0xF4, 0x01, 0xF0, 0x0B, 0x40, 0x1A, 0x00, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x2F, 0x80, 0x00, 0xF7, 0xD0, 0x0B, 0xD2, 0xF4,
-    0x3F, 0x40, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x07, 0xC0, 0x02, 0xF4, 0x01, 0xFC, 0x00,
-    0xBD, 0x00, 0x3F, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x3F,
-    0x00, 0x00, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xFC, 0x00,
-    0x02, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x2F, 0xD0, 0x0B, 0xF8, 0x00,
-    0xFF, 0x00, 0x0F, 0xC0, 0x00, 0xB4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x2A, 0x40, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x4B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xCF, 0xFF, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xF2, 0xFF, 0xFE, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x07, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xFE, 0x1F, 0xFF,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x6F, 0xFF, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x06, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x6F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xEF, 0xDF, 0xFC, 0x00,
-    0x0F, 0x0F, 0xC2, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0xFD, 0x00, 0x00, 0x1F, 0x40, 0xFD, 0x00, 0x00,
-    0x2F, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0xBE,
-    0x03, 0xF0, 0x00, 0x00, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x2F, 0xC0, 0x00, 0x01, 0xFC, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x15, 0x54, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x06, 0x4F, 0x00, 0x03, 0xC3, 0xE0, 0x07, 0xD0, 0xBF, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xD0, 0x00, 0x59, 0x40, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x01, 0xD3, 0x4B, 0x00, 0x00, 0x01, 0xFB, 0xB8, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xCD, 0x3C, 0x00, 0x00, 0x01, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0x1C, 0x01, 0x00, 0x00, 0x18, 0x00, 0x07, 0x00, 0x00, 0x38, 0x12, 0x47, 0x0A, 0x2D,
-    0x30, 0xF3, 0xEA, 0xB4, 0x0B, 0xBB, 0x40, 0x6F, 0x40, 0x01, 0xF8, 0x00, 0xBF, 0xD0, 0x0B, 0xEF,
-    0x4B, 0x9C, 0xF8, 0x78, 0xD3, 0xC9, 0x28, 0x10, 0x00, 0xC0, 0x00, 0x38, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00,
-    0x06, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFA, 0xFF,
-    0xE0, 0x1F, 0xFA, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0xFD, 0x00, 0x2F, 0xD0, 0x02, 0x40,
-    0x00, 0x3F, 0x41, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x41, 0xFF,
-    0x80, 0x0F, 0x40, 0x38, 0x00, 0x0B, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0xFE, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBE,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xFF,
-    0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x00,
-    0x0F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xBC, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFC,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x1D, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x16, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x41, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x47, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0D, 0x1C, 0x03, 0x40, 0xC0, 0x71,
-    0x0C, 0x0E, 0x34, 0xC0, 0xD3, 0x2C, 0x1D, 0x03, 0x81, 0xD0, 0xB0, 0x1F, 0xBE, 0x00, 0xFF, 0xC0,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x3C, 0x00, 0xEC, 0x03, 0x9C, 0x0E, 0x38, 0x3C,
-    0x79, 0x7F, 0xFE, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x02, 0x80,
-    0x00, 0x34, 0x00, 0x03, 0x00, 0x00, 0x7F, 0xD0, 0x01, 0x07, 0x40, 0x00, 0x38, 0x00, 0x07, 0x41,
-    0x96, 0xF0, 0x3F, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0xB4, 0x00, 0xA0, 0x00, 0x30, 0x00,
-    0x2E, 0xFC, 0x0F, 0x43, 0x83, 0x80, 0xA1, 0xC0, 0x38, 0x74, 0x2C, 0x0F, 0xFD, 0x00, 0xB9, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x74, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0,
-    0x07, 0x80, 0x0F, 0x40, 0x2F, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x0E, 0x09, 0x02,
-    0x80, 0xA0, 0x34, 0x0D, 0x02, 0xD7, 0x80, 0x0F, 0xE0, 0x0B, 0x47, 0x41, 0xC0, 0x3C, 0x2C, 0x03,
-    0x82, 0xE6, 0xF0, 0x0B, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x74, 0x74, 0x0D, 0x03, 0x81, 0xC0, 0x38,
-    0x28, 0x03, 0x82, 0xC0, 0xB4, 0x0F, 0xFF, 0x00, 0x15, 0xA0, 0x00, 0x1D, 0x07, 0xFF, 0x80, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xE6, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0x41, 0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xC0, 0x0F, 0xE0, 0x00, 0xBC, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x02, 0xF8, 0x07,
-    0xF0, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x0F,
-    0xF0, 0x3F, 0xC0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x00,
-    0x06, 0xF8, 0x00, 0x03, 0x80, 0xA0, 0x00, 0xF0, 0x07, 0x00, 0x2C, 0x00, 0x70, 0x03, 0x83, 0x07,
-    0x40, 0xB4, 0xB0, 0xB0, 0x0F, 0x0F, 0x0F, 0x00, 0xF0, 0xE1, 0xE0, 0x1F, 0x00, 0x3D, 0x02, 0xF0,
-    0x07, 0xC0, 0x2F, 0x01, 0xF8, 0x02, 0xFE, 0xFF, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0xFF, 0xF8, 0x00,
-    0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0xED, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x34,
-    0x00, 0x70, 0x00, 0xB0, 0x00, 0xE0, 0x01, 0xD0, 0x2F, 0xFE, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x18, 0x0F, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0xB8, 0x00,
-    0x0F, 0x80, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x02, 0xFE, 0x00,
-    0x10, 0x28, 0x00, 0x01, 0xC0, 0x00, 0x74, 0x03, 0xFD, 0x00, 0x01, 0xD0, 0x00, 0x0F, 0x00, 0x00,
-    0xE0, 0x10, 0x6D, 0x07, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0x00, 0x03, 0xC0, 0x02, 0xE0,
-    0x02, 0x34, 0x02, 0x1C, 0x02, 0x0B, 0x02, 0xFF, 0xD0, 0xAF, 0xFC, 0x00, 0x74, 0x00, 0x2D, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x60, 0x00, 0x34, 0x00, 0x0C, 0x00, 0x07, 0xFD, 0x00,
-    0x01, 0xD0, 0x00, 0x74, 0x10, 0x7C, 0x1F, 0xFD, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x02, 0xD0, 0x00, 0x70, 0x00, 0x0D, 0x00, 0x01, 0xEF, 0xD0, 0x2E, 0x0B, 0x03, 0xC0,
-    0x70, 0x34, 0x07, 0x03, 0x81, 0xE0, 0x2F, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00,
-    0x1D, 0x00, 0x2C, 0x00, 0x74, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0x40, 0x2F,
-    0x00, 0x3D, 0x00, 0x00, 0x2E, 0x90, 0x03, 0x80, 0xC0, 0x1C, 0x07, 0x00, 0x70, 0x74, 0x00, 0xBF,
-    0x40, 0x0B, 0x5E, 0x00, 0xF0, 0x1C, 0x07, 0x40, 0xB0, 0x1E, 0x07, 0x80, 0x3F, 0xF8, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x34, 0x3C, 0x0E, 0x02, 0xC0, 0xC0, 0x2C, 0x1C, 0x03, 0xC0, 0xE5,
-    0xF8, 0x07, 0xFF, 0x40, 0x00, 0x70, 0x00, 0x1E, 0x03, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x29, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x41, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0xBE, 0x80, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0x03, 0xD0, 0x00, 0x00, 0x02, 0xFE, 0xBC, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0xF4, 0x0F, 0x40,
-    0x00, 0x00, 0x0F, 0xF2, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xE3, 0xD0, 0x7C, 0x00, 0x00, 0x00,
-    0x3F, 0xCB, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0x41, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x7F,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xBD, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x0F, 0x80,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x3D, 0x00, 0x40, 0x00,
-    0x01, 0xFF, 0xFE, 0xFD, 0x6F, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xF2, 0xFF, 0xFF, 0xE4, 0x00,
-    0x00, 0x03, 0xD0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x41, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x95, 0x5A, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x41, 0x40, 0x00, 0x3F, 0x80, 0x00,
-    0xFB, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xFD, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x03, 0xF0,
-    0x10, 0x00, 0x1F, 0xFF, 0xF9, 0xFE, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xE4, 0x07,
-    0xE0, 0x00, 0x03, 0xF8, 0x00, 0x02, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0A, 0xBF, 0xAA, 0xA8, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xE9, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF,
-    0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF5, 0xFE, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0xBF,
-    0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x02, 0xAF, 0xFE, 0xAB, 0xFE, 0xBF, 0xEA, 0x90, 0x00, 0xFF, 0xC0, 0x3F, 0xC3, 0xFC, 0x00, 0x00,
-    0x0F, 0xF8, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xCF, 0xF4, 0x00, 0x00, 0x3F,
-    0xF0, 0x02, 0xFE, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xEA, 0xFF, 0xFC, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x01,
-    0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xFA,
-    0xA5, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xAF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xBF, 0x00,
-    0x00, 0x0B, 0xF9, 0x00, 0x2E, 0x56, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x80,
-    0x00, 0x0F, 0x91, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0x90, 0x7F,
-    0x00, 0x00, 0x3F, 0x90, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x07, 0xFF, 0x40, 0x07, 0xF0, 0x02,
-    0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x02, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFE, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x1F, 0xD0, 0x00, 0x29, 0x07, 0xF0, 0x1F, 0xD0,
-    0x0B, 0xF4, 0x00, 0x1F, 0xFF, 0xF8, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x1F, 0xFF, 0xFC, 0x03, 0xFC,
-    0x00, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x01, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xF9, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7C, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x50, 0x03, 0xC0, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7C, 0x1F, 0xF4, 0x3E, 0x00, 0x00, 0xBC, 0x3F, 0xF8, 0x3D, 0x00, 0x00, 0xBC, 0x7E,
-    0xF8, 0xBC, 0x00, 0x00, 0xBC, 0xFC, 0xFC, 0xF8, 0x00, 0x00, 0xBD, 0xF8, 0xFC, 0xF4, 0x00, 0x00,
-    0xBF, 0xF4, 0xBE, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0xBF, 0xD0,
-    0x00, 0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x95, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x00, 0xBF, 0xD0, 0x6F, 0xF0, 0x00,
-    0xF8, 0x03, 0xF8, 0x00, 0x0B, 0xD0, 0x07, 0xD0, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x7E,
-    0x00, 0x00, 0x3E, 0x00, 0xF8, 0x02, 0xF4, 0x00, 0x00, 0xF4, 0x07, 0xD0, 0x0F, 0xC0, 0x24, 0x03,
-    0xD0, 0x2F, 0x00, 0x3E, 0x01, 0xF0, 0x1F, 0x00, 0xFC, 0x01, 0xF4, 0x0B, 0xC0, 0xBC, 0x03, 0xE0,
-    0x0B, 0xC0, 0x3E, 0x03, 0xE0, 0x1F, 0x40, 0x3F, 0x00, 0xF4, 0x0F, 0x40, 0xBC, 0x00, 0xF8, 0x07,
-    0xC0, 0x18, 0x03, 0xF0, 0x07, 0xD0, 0x1F, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x00, 0xBC, 0x00, 0x00,
-    0xBD, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x07, 0xD0, 0x07, 0xE0, 0x00, 0x2F, 0xC0, 0x2F,
-    0x00, 0x0F, 0xF9, 0x07, 0xFE, 0x00, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x56, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x15, 0x6E,
-    0x54, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x0B, 0xE0, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xDF, 0x00, 0x00, 0x03, 0xFA, 0xBF,
-    0xE0, 0x00, 0x00, 0xB8, 0x02, 0xFD, 0x00, 0x00, 0x2E, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xC0, 0x01,
-    0xF8, 0x00, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x01,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0xFB, 0xC0, 0x00, 0x00, 0x0B, 0xF9, 0x28, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x3F, 0xE4, 0x05, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x14, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF5, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0A, 0x95, 0x0B, 0xF0, 0x01, 0x50,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x10,
-    0x00, 0x00, 0x00, 0x2F, 0xDB, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x90, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xE7,
-    0xF8, 0x64, 0x00, 0x00, 0x04, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
-    0x01, 0x93, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0x94, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xFE, 0x40, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xEA, 0xFC, 0x00, 0x03, 0xFF, 0xD2, 0xD0, 0x01,
-    0x00, 0x03, 0xFF, 0x40, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x1E, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xC0, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x2E,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x0B, 0xE5, 0x00, 0x00, 0xBF, 0x40, 0x03, 0xFF, 0xFF, 0xE0, 0x3F,
-    0xD0, 0x00, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0x78, 0x1B, 0xFF, 0x03, 0xFC, 0x00, 0x2D, 0x00,
-    0xF9, 0x40, 0xFF, 0x40, 0x0F, 0x00, 0xBD, 0x00, 0x3F, 0xF0, 0x03, 0xC0, 0x3F, 0x40, 0x0F, 0xFF,
-    0xA5, 0xF6, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF,
-    0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xEA,
-    0xAF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0x54, 0x02, 0xFD, 0x78, 0x00, 0x1F, 0xD2, 0xD0, 0x00, 0xBE, 0x0F, 0x00, 0x03, 0xF0,
-    0x3C, 0x00, 0x1F, 0x81, 0xE0, 0x00, 0xBD, 0x0B, 0x40, 0x03, 0xF4, 0x3C, 0x00, 0x0F, 0xD0, 0xE0,
-    0x00, 0x3F, 0xCB, 0x40, 0x00, 0xBF, 0xFE, 0xA0, 0x01, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA,
-    0xAA, 0xAA, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAA, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x05, 0x5F, 0xD0, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x60, 0x00, 0x07, 0xD6, 0xFC, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x10, 0x03, 0x9B, 0xC1, 0xB8, 0x00, 0x03, 0xFB,
-    0xFC, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xD3, 0xEF,
-    0xC0, 0x03, 0xE0, 0x47, 0xE0, 0x0B, 0xF0, 0x02, 0xF0, 0x1F, 0xF0, 0x00, 0xFD, 0xBF, 0xD0, 0x00,
-    0x3F, 0xFF, 0x80, 0x00, 0x1F, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xEE, 0x2F, 0xC0, 0x00, 0x2F, 0xCB, 0x43,
-    0xF0, 0x00, 0x0F, 0xC3, 0xC0, 0xFC, 0x00, 0x0B, 0xD0, 0xF0, 0x2E, 0x00, 0x03, 0xF0, 0x78, 0x0F,
-    0x40, 0x00, 0xF4, 0x2D, 0x03, 0xD0, 0x00, 0x7C, 0x0F, 0x40, 0xF0, 0x00, 0x2E, 0x03, 0xC0, 0xB8,
-    0x00, 0x0F, 0x41, 0xF0, 0x3D, 0x00, 0x03, 0xC0, 0xB8, 0x0F, 0x00, 0x01, 0xF0, 0x2D, 0x07, 0xC0,
-    0x00, 0xBC, 0x0F, 0x02, 0xE0, 0x00, 0x3E, 0x03, 0xC0, 0xF4, 0x00, 0x0F, 0x81, 0xE0, 0x7C, 0x00,
-    0x03, 0xD0, 0xB4, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xEA, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x1B, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
-    0xFF, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1B, 0xE0, 0x3D,
-    0x00, 0x6F, 0xFE, 0x0B, 0x86, 0xFF, 0xF9, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x3F, 0xFE, 0x40, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xFD, 0xB8, 0xFD, 0x00, 0x1F, 0x83, 0xD0,
-    0xFC, 0x02, 0xF4, 0x0F, 0x00, 0xFC, 0x3F, 0x00, 0x7C, 0x01, 0xF0, 0x60, 0x02, 0xE0, 0x01, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0xBE, 0x40, 0x00, 0xF0, 0x0B, 0xFF, 0x90, 0x07, 0xC0, 0x06, 0xFF, 0xF9, 0x2E, 0x00, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x14, 0x00, 0xF4,
-    0x00, 0x40, 0xF8, 0x02, 0xE0, 0x0B, 0x80, 0xFD, 0x07, 0xC0, 0x7F, 0x00, 0xBE, 0x0F, 0x07, 0xF0,
-    0x00, 0x7F, 0x3D, 0x3F, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x18,
-    0x40, 0x00, 0x3C, 0x00, 0x0B, 0x00, 0x1B, 0xF7, 0xF9, 0x00, 0x78, 0x00, 0x74, 0x6F, 0xFE, 0x46,
-    0xFF, 0xE4, 0xB4, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x1B, 0xFF, 0xF0, 0x3F, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFF,
-    0xC0, 0x01, 0xF6, 0xCB, 0xC0, 0x2F, 0x0F, 0x0F, 0xC3, 0xE0, 0x38, 0x0F, 0x9D, 0x01, 0xD0, 0x08,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x01, 0x00, 0xB4, 0x00, 0x1E, 0x01, 0xE0, 0x2D, 0x1F, 0x43, 0xC1, 0xF4,
-    0x0F, 0x8F, 0x1F, 0x40, 0x0B, 0xEE, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x01, 0xC0, 0x00, 0x00, 0x00, 0x16, 0xE0, 0x00, 0x1A, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x50, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x2F, 0x7F, 0xC0, 0x00, 0x07, 0xC2, 0xFE, 0x00,
-    0x01, 0xF0, 0x0B, 0xF4, 0x00, 0x7C, 0x00, 0x7F, 0xD0, 0x1F, 0x00, 0x01, 0xFF, 0x03, 0xC0, 0x00,
-    0x0B, 0xF4, 0xF4, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xE5, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x01, 0xFE, 0xBC, 0x00, 0x01, 0xFF, 0x47, 0xC0, 0x00, 0xBF, 0x40, 0x7C, 0x00,
-    0xBF, 0x80, 0x0B, 0xC0, 0x7F, 0xC0, 0x00, 0xBC, 0x3F, 0xD0, 0x00, 0x0B, 0xC0, 0xE0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xC0, 0x3D, 0x00, 0x3C, 0x02, 0xF0, 0x07, 0x80, 0x0F,
-    0x40, 0xB4, 0x00, 0xBC, 0x0F, 0x00, 0x03, 0xD0, 0xF0, 0x00, 0x2F, 0x1E, 0x00, 0x00, 0xF6, 0xD0,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0xEB, 0xF8, 0x0F, 0xFF, 0xFF, 0x40, 0x05, 0xBF,
-    0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x03, 0xE0, 0x74, 0x00, 0x7C, 0x07, 0x80, 0x0F, 0x80, 0x3C, 0x01, 0xF0, 0x03, 0xC0, 0x3E,
-    0x00, 0x2D, 0x07, 0xC0, 0x01, 0xE0, 0xF8, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0xF3, 0xE0, 0x00, 0x0B,
-    0xBC, 0x00, 0x00, 0x7F, 0x80, 0x04, 0x03, 0xFA, 0xBF, 0xC0, 0x3F, 0xFF, 0xFD, 0x02, 0xFF, 0xA5,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x55, 0x55, 0x55, 0x50,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xF5, 0x55, 0x55,
-    0x54, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x0D, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x3C, 0x00, 0x00, 0x00,
-    0x7F, 0x41, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0xBE, 0xF0, 0x3D, 0xF4, 0x00,
-    0x0F, 0xE3, 0x80, 0xE2, 0xF4, 0x00, 0xFD, 0x1D, 0x07, 0x43, 0xF0, 0x1F, 0xC0, 0xB0, 0x2C, 0x07,
-    0xF1, 0xF8, 0x03, 0xC0, 0xF0, 0x0B, 0xC3, 0x40, 0x0D, 0x07, 0x80, 0x08, 0x00, 0x00, 0x70, 0x2D,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0x03, 0x80, 0x00, 0x00, 0x00, 0x34,
-    0x1D, 0x00, 0x00, 0x00, 0x01, 0xC0, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x38, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x74, 0x00, 0x00, 0x00, 0x07, 0x02, 0xC0, 0x00, 0x00,
-    0x00, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x55, 0x55, 0x55,
-    0x57, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0x55, 0x55,
-    0x56, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x34, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00,
-    0x00, 0x02, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x07, 0x41, 0xD0, 0x00, 0x00, 0x00, 0x0E, 0x03, 0x80,
-    0x00, 0x00, 0x00, 0x2C, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x2C, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x74, 0x00, 0x00, 0x00, 0x03, 0x80, 0xE0, 0x00, 0x01, 0x40, 0x0B, 0x03, 0xC0, 0x00, 0x0F, 0x80,
-    0x1C, 0x0B, 0x00, 0x3C, 0x1F, 0xC0, 0x34, 0x1D, 0x02, 0xF8, 0x0F, 0xD0, 0xE0, 0x3C, 0x0F, 0xC0,
-    0x0F, 0xE2, 0xC0, 0xF0, 0xFC, 0x00, 0x0B, 0xE7, 0x02, 0xDB, 0xD0, 0x00, 0x07, 0xFE, 0x07, 0xFD,
-    0x00, 0x00, 0x07, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xD0,
-    0x70, 0x00, 0x00, 0x00, 0x02, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x3F, 0x55, 0x55, 0x55, 0x55, 0x5B, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x87, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xD5, 0x55,
-    0x55, 0x7F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xF6, 0xFE, 0x40, 0x00, 0x3E, 0x1E, 0xFF, 0x90, 0x0F,
-    0xC1, 0xC2, 0xFD, 0x03, 0xF8, 0x1C, 0x03, 0x40, 0xFF, 0x81, 0xC0, 0x00, 0x3F, 0xA8, 0x1C, 0x00,
-    0x07, 0xE2, 0x81, 0xC0, 0x00, 0x04, 0x28, 0x1C, 0x00, 0x00, 0x02, 0x81, 0xC0, 0x00, 0x00, 0x28,
-    0x1C, 0x00, 0x00, 0x02, 0x81, 0xC0, 0x00, 0x00, 0x28, 0x1C, 0x00, 0x00, 0x02, 0x81, 0xC0, 0x00,
-    0x00, 0x28, 0x1C, 0x00, 0x00, 0x42, 0x81, 0xC0, 0x00, 0x7E, 0x28, 0x1C, 0x00, 0x03, 0xFA, 0x81,
-    0xC0, 0x00, 0x0F, 0xF8, 0x1C, 0x00, 0x00, 0x3F, 0x81, 0xC0, 0x34, 0x00, 0xFC, 0x1C, 0x2F, 0xD0,
-    0x03, 0xE1, 0xEF, 0xF9, 0x00, 0x0F, 0x6F, 0xF4, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x3C, 0x00, 0x07, 0xFF, 0xFD, 0x2E, 0x00,
-    0x07, 0xF8, 0x0B, 0xCF, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x01,
-    0xF8, 0x00, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0xBD, 0x00, 0x03, 0xF8, 0x01, 0xBE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x80, 0x3C, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x9F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x02,
-    0xF5, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBC, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0x00,
-    0xFD, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0xD0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x01, 0xFC,
-    0x00, 0x07, 0xF0, 0x01, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x00,
-    0x0F, 0xE0, 0x1F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x0B, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
-    0xF2, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0x90, 0x16, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0x87, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xE0, 0x06, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF2, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x1F,
-    0xD0, 0x00, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x00,
-    0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x40, 0x1F, 0xE0, 0x00,
-    0x07, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x2F, 0xE0, 0x00,
-    0x00, 0x3F, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x02,
-    0xF4, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x7E, 0x00, 0x1F,
-    0x40, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x01, 0xF8,
-    0x00, 0x01, 0xF4, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x54, 0x00, 0x15, 0x00, 0x00, 0x1F, 0x40, 0x0B, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0xF8,
-    0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x00, 0x07, 0xE0, 0x01, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x02, 0xF4,
-    0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0x01, 0xF4, 0x00, 0xBD, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0x03, 0xE0,
-    0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x01, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x42, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x06, 0x90, 0x00, 0x00, 0xBF,
-    0xFD, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x0F, 0xE4, 0x1F, 0x7F, 0x80,
-    0xF0, 0x02, 0xF4, 0x00, 0x3F, 0xC0, 0x07, 0x40, 0x3D, 0x00, 0x03, 0xF0, 0x00, 0x34, 0x0B, 0xC0,
-    0x00, 0x3E, 0x00, 0x07, 0x40, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0xB0, 0x0F, 0x00, 0x00, 0x7D, 0x00,
-    0x1E, 0x00, 0xF0, 0x00, 0x0F, 0xF0, 0x0B, 0xD0, 0x0F, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFB, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x2F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xC0, 0xBF,
-    0xE0, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x41,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x09, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x3F,
-    0xD0, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x01, 0xFF,
-    0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x3D,
-    0x01, 0xFC, 0x2F, 0x00, 0x7C, 0x03, 0xF0, 0x0F, 0x81, 0xF4, 0x0B, 0xC0, 0x03, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x01, 0x40, 0x0F, 0xEB, 0xD0, 0x07, 0xD0, 0x3F, 0x00, 0xF4, 0x0F, 0x80, 0xBD, 0x00, 0x7F,
-    0xFF, 0x00, 0x58, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x50, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xD5, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xA5,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE9, 0x40, 0x00, 0x00, 0x56, 0xAF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x5A, 0x80, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0xFE, 0x40, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x6B, 0xFF,
-    0xC0, 0x00, 0x16, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xA5, 0x40, 0x00, 0x02, 0xA5,
-    0x40, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_14_italicBitmaps[45417] = {
+    0x72, 0x9A, 0x97, 0x2D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7,
+    0x1A, 0xD9, 0x71, 0xE7, 0x19, 0xE7, 0x1A, 0xDA, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE, 0x71, 0xEA,
+    0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1E, 0xA7, 0x09, 0xE9, 0x70, 0x9A, 0xD7, 0x77, 0x74, 0xF7, 0x0A,
+    0xEA, 0x70, 0xFA, 0x7A, 0xF9, 0x7F, 0xC9, 0x6A, 0xFC, 0x70, 0xAF, 0x91, 0xFC, 0x19, 0xF9, 0x1A,
+    0xF2, 0xF9, 0x1A, 0xF2, 0xFA, 0x19, 0xF2, 0xAE, 0x92, 0xF2, 0x9F, 0x2F, 0x92, 0xF2, 0xAE, 0xA2,
+    0xF9, 0x19, 0xF7, 0x70, 0x75, 0x9D, 0x5A, 0xD7, 0x74, 0xE5, 0xDA, 0x77, 0x4D, 0x94, 0x9D, 0x77,
+    0x4A, 0xD5, 0xE7, 0x74, 0xE5, 0xDA, 0x77, 0x39, 0xD9, 0x4A, 0xD7, 0x74, 0xE5, 0xE7, 0x5F, 0xFF,
+    0xFF, 0xFE, 0x4A, 0xFF, 0xFF, 0xFF, 0xD9, 0x49, 0xAA, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAE, 0xAA,
+    0xAA, 0xAA, 0xA9, 0x73, 0xAD, 0xA4, 0xAD, 0x97, 0x73, 0xE5, 0xE7, 0x73, 0x9E, 0x4A, 0xDA, 0x77,
+    0x3E, 0x94, 0xE7, 0x73, 0x9E, 0x49, 0xE7, 0x73, 0xEA, 0x4E, 0x97, 0x5F, 0xFF, 0xFF, 0xFD, 0xA4,
+    0xAF, 0xFF, 0xFF, 0xFD, 0x5A, 0xAA, 0xAA, 0xAF, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0x97,
+    0x29, 0xE4, 0x9E, 0x77, 0x3F, 0x4E, 0xA7, 0x72, 0x9E, 0xA4, 0xE9, 0x77, 0x2A, 0xE4, 0xAE, 0x77,
+    0x3F, 0x4E, 0xA7, 0x73, 0x99, 0x99, 0x49, 0x99, 0x77, 0x76, 0xCA, 0x1A, 0xC9, 0x77, 0x1A, 0xCA,
+    0x1D, 0x77, 0x2A, 0xC9, 0x1D, 0x77, 0x19, 0xFF, 0xDA, 0x73, 0x9F, 0xFF, 0xC7, 0x2F, 0xFF, 0xDA,
+    0x71, 0xFE, 0xAA, 0xD1, 0x9A, 0x97, 0x0A, 0xFD, 0x19, 0xD7, 0x5F, 0x0D, 0x19, 0xCA, 0x74, 0xAE,
+    0x09, 0xCA, 0x1A, 0xC9, 0x74, 0xEA, 0x0A, 0xC9, 0x1D, 0x75, 0xF0, 0xD9, 0x1D, 0x75, 0xFE, 0x90,
+    0x9C, 0xA7, 0x59, 0xFF, 0xDA, 0x76, 0xAF, 0xFF, 0x97, 0x5A, 0xFF, 0xEA, 0x75, 0xD9, 0x9F, 0xFC,
+    0x74, 0xD1, 0xAF, 0xFA, 0x72, 0x9C, 0xA1, 0xD9, 0xFE, 0x72, 0xAC, 0x91, 0xD0, 0xFE, 0x72, 0xD9,
+    0x1D, 0xAF, 0xE4, 0xAC, 0xA9, 0x99, 0xD9, 0x9A, 0xFF, 0xC9, 0x3F, 0xFF, 0xFF, 0xA3, 0xFF, 0xFF,
+    0xFA, 0x3F, 0xFF, 0xFF, 0x93, 0xAF, 0xFF, 0xFD, 0xA7, 0x9A, 0xFF, 0xF9, 0x77, 0x09, 0xCA, 0x1A,
+    0xC9, 0x77, 0x1A, 0xC9, 0x1D, 0x77, 0x2D, 0x2D, 0x77, 0x77, 0x40, 0x77, 0x77, 0x73, 0x9C, 0x97,
+    0x73, 0x9C, 0xA7, 0x99, 0x97, 0x1D, 0x6A, 0xFC, 0x7D, 0x6D, 0x91, 0x9C, 0x95, 0xD6, 0xAC, 0x4C,
+    0xA4, 0xD9, 0x6C, 0xA4, 0xCA, 0x3A, 0xC9, 0x69, 0xC9, 0x4C, 0xA2, 0xAC, 0xA7, 0xAC, 0x4A, 0xC2,
+    0x9C, 0xA7, 0x0A, 0xC9, 0x29, 0xD1, 0x9D, 0x71, 0x9F, 0xE1, 0x9D, 0x73, 0xAF, 0xC2, 0xD7, 0x59,
+    0xA9, 0x92, 0xFC, 0xA7, 0x70, 0xEA, 0xAA, 0xD7, 0x6A, 0xD3, 0x9C, 0x75, 0xAD, 0x93, 0x9C, 0x97,
+    0x3A, 0xE4, 0x9C, 0x73, 0x9F, 0x4D, 0x72, 0x9D, 0x9D, 0x39, 0xCA, 0x72, 0xDA, 0x0E, 0xAA, 0xE7,
+    0x2D, 0xA1, 0xAF, 0xD7, 0x2E, 0x39, 0xEA, 0x72, 0xE7, 0x77, 0x77, 0x30, 0x77, 0x77, 0x09, 0xAF,
+    0xC9, 0x75, 0x9F, 0xFC, 0xA7, 0x39, 0xEA, 0x92, 0xAD, 0x97, 0x2E, 0x6D, 0xA7, 0x19, 0xDA, 0x59,
+    0xDA, 0x71, 0xAD, 0x95, 0xE9, 0x71, 0xAD, 0xA3, 0x9E, 0xA7, 0x3E, 0x91, 0xAE, 0xA7, 0x49, 0xEA,
+    0xF9, 0x76, 0xAF, 0xCA, 0x77, 0x9F, 0xC9, 0x77, 0xAF, 0xDA, 0x76, 0xFC, 0x9E, 0xA7, 0x4F, 0xC2,
+    0xE9, 0x4A, 0xAA, 0x29, 0xF4, 0xE3, 0x9E, 0x2F, 0x94, 0x9E, 0x19, 0xEA, 0x1A, 0xF6, 0x9E, 0x9F,
+    0x2A, 0xF7, 0xAF, 0xD3, 0xFC, 0x70, 0xFC, 0x93, 0xAF, 0xC9, 0x39, 0xAF, 0xCA, 0x49, 0xFF, 0xFF,
+    0xD5, 0xFF, 0xFD, 0xA0, 0xD9, 0x5A, 0xFF, 0xDA, 0x29, 0x97, 0x0A, 0xFC, 0xA9, 0x77, 0x77, 0x20,
+    0x9F, 0x90, 0x9F, 0x91, 0xFA, 0x1F, 0xA1, 0xAE, 0xA1, 0x9F, 0x2F, 0x2F, 0x96, 0x77, 0x75, 0xDA,
+    0x74, 0xAD, 0x74, 0x9D, 0x97, 0x39, 0xDA, 0x74, 0xE7, 0x4A, 0xD7, 0x49, 0xD9, 0x74, 0xDA, 0x74,
+    0xAD, 0x74, 0x9D, 0x97, 0x4E, 0x74, 0x9D, 0x97, 0x4E, 0x74, 0x9D, 0x97, 0x4E, 0x75, 0xDA, 0x74,
+    0xAD, 0x75, 0xE7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5D, 0xA7, 0x5D, 0xA7, 0x49,
+    0xD9, 0x74, 0x9D, 0x97, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x97, 0x4A, 0xD9, 0x74,
+    0x9D, 0x97, 0x49, 0xD9, 0x74, 0x9D, 0xA7, 0x49, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x97, 0x4A, 0xDA,
+    0x72, 0x77, 0x0D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xAD,
+    0x75, 0xE7, 0x49, 0xD9, 0x74, 0xE7, 0x5D, 0xA7, 0x4A, 0xD7, 0x5D, 0xA7, 0x4A, 0xD7, 0x5D, 0xA7,
+    0x4E, 0x74, 0xAD, 0x97, 0x4D, 0xA7, 0x4E, 0x74, 0xAD, 0x74, 0x9D, 0x97, 0x4D, 0xA7, 0x4E, 0x74,
+    0xE7, 0x4A, 0xD7, 0x4A, 0xD7, 0x4A, 0xD7, 0x4A, 0xD9, 0x73, 0xAD, 0x97, 0x3A, 0xD9, 0x73, 0xAD,
+    0x97, 0x3A, 0xD7, 0x4E, 0x74, 0xE7, 0x4E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0x90,
+    0x77, 0x59, 0xCA, 0x73, 0xAC, 0x96, 0x99, 0x2D, 0x3C, 0xA0, 0x9D, 0xA1, 0xD1, 0xAD, 0x90, 0x9F,
+    0x9C, 0xAA, 0xD9, 0x49, 0xAF, 0xC9, 0x70, 0xAE, 0x70, 0xAF, 0xE9, 0x3A, 0xDA, 0x9C, 0xA9, 0xF1,
+    0xE9, 0x09, 0xC9, 0x1A, 0xCA, 0x19, 0xA2, 0xAC, 0x39, 0x7D, 0x74, 0xCA, 0x70, 0x7D, 0xA7, 0x3D,
+    0x97, 0x29, 0xD7, 0x3A, 0xCA, 0x73, 0xD9, 0x72, 0x9D, 0x94, 0x9F, 0xFF, 0xC0, 0xAF, 0xFF, 0xA6,
+    0xD9, 0x72, 0x9D, 0x73, 0xAD, 0x73, 0xDA, 0x73, 0xD9, 0x73, 0xAA, 0x70, 0x75, 0xFC, 0x39, 0xF9,
+    0x3F, 0xC4, 0xF4, 0x9E, 0xA4, 0xF4, 0xAE, 0xA3, 0x9F, 0x76, 0x0F, 0xFF, 0xC9, 0xFF, 0xF9, 0xAF,
+    0xFF, 0x00, 0x19, 0xDA, 0x1E, 0xA0, 0x9E, 0xA0, 0xF9, 0x9F, 0x90, 0x77, 0x72, 0x99, 0x77, 0x71,
+    0xD7, 0x77, 0x1D, 0x97, 0x77, 0x09, 0xD7, 0x77, 0x1D, 0x97, 0x77, 0x0A, 0xD7, 0x77, 0x1D, 0x97,
+    0x77, 0x0A, 0xCA, 0x77, 0x70, 0x9D, 0x77, 0x71, 0xDA, 0x77, 0x70, 0x9D, 0x77, 0x71, 0xDA, 0x77,
+    0x70, 0xAD, 0x77, 0x71, 0xD9, 0x77, 0x70, 0xAD, 0x77, 0x71, 0xD9, 0x77, 0x70, 0xE7, 0x77, 0x09,
+    0xD9, 0x77, 0x70, 0xE7, 0x77, 0x0A, 0xD7, 0x77, 0x1D, 0xA7, 0x77, 0x0A, 0xD7, 0x77, 0x1D, 0xA7,
+    0x77, 0x0E, 0x77, 0x70, 0x9D, 0x97, 0x77, 0x0E, 0x77, 0x70, 0x9D, 0x97, 0x77, 0x0E, 0x77, 0x70,
+    0xAD, 0x97, 0x77, 0x0E, 0x77, 0x70, 0xE7, 0x77, 0x09, 0xDA, 0x77, 0x70, 0xE7, 0x77, 0x09, 0xDA,
+    0x77, 0x70, 0xE7, 0x77, 0x0A, 0xD9, 0x77, 0x70, 0xE7, 0x77, 0x0A, 0xD9, 0x77, 0x79, 0xE7, 0x77,
+    0x0E, 0x97, 0x77, 0x9E, 0x77, 0x70, 0xE7, 0x77, 0x0A, 0xD7, 0x77, 0x1C, 0x97, 0x77, 0x19, 0x77,
+    0x72, 0x70, 0x9F, 0xA7, 0x29, 0xDA, 0x90, 0x9D, 0x97, 0x9D, 0x94, 0xD6, 0x9D, 0x95, 0xAC, 0x95,
+    0xDA, 0x6A, 0xCA, 0x4A, 0xD7, 0xAC, 0xA4, 0xDA, 0x2A, 0x3D, 0xA3, 0xAD, 0x91, 0xDA, 0x2D, 0xA3,
+    0xE2, 0xDA, 0x2D, 0x92, 0x9D, 0xA1, 0xAD, 0x91, 0xAD, 0x3A, 0xD9, 0x1A, 0xD2, 0xE3, 0xE2, 0x9C,
+    0xA1, 0x9D, 0xA3, 0xE7, 0xE9, 0x29, 0xE6, 0x9E, 0x39, 0xE6, 0xEA, 0x3A, 0xEA, 0x4F, 0x93, 0xAF,
+    0xA9, 0x9A, 0xFC, 0x49, 0xFF, 0xF6, 0xFF, 0xE9, 0x6F, 0xFD, 0xA7, 0x0F, 0xF9, 0x72, 0xAF, 0xA7,
+    0x00, 0x73, 0x97, 0x1A, 0xE7, 0xFD, 0x69, 0xDA, 0xDA, 0x6A, 0xA0, 0x9D, 0x97, 0x1A, 0xD7, 0x2E,
+    0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x2E, 0x71, 0xAD, 0xA7, 0x1E, 0x97, 0x1E, 0x71, 0x9E,
+    0x71, 0xEA, 0x71, 0xE7, 0x19, 0xE5, 0xAF, 0xFE, 0xA0, 0xFF, 0xF9, 0x9F, 0xFF, 0x0A, 0xFF, 0xEA,
+    0x00, 0x72, 0x99, 0x75, 0x9F, 0xF7, 0x1F, 0xFE, 0x96, 0x9D, 0xA9, 0x29, 0xF6, 0x9A, 0x7E, 0x77,
+    0x0A, 0xD7, 0x70, 0xE7, 0x70, 0xE7, 0x7E, 0xA7, 0x6A, 0xE7, 0x6A, 0xEA, 0x75, 0xAF, 0x74, 0x9F,
+    0xC7, 0x4A, 0xFC, 0x73, 0xAF, 0xCA, 0x72, 0x9F, 0xD9, 0x72, 0xAF, 0xD9, 0x72, 0xAF, 0xD7, 0x4F,
+    0xFF, 0xC5, 0xAF, 0xFF, 0xC5, 0xFF, 0xFC, 0xA4, 0x9F, 0xFF, 0xC9, 0x40, 0x69, 0xAA, 0xFA, 0x97,
+    0x2F, 0xFD, 0x70, 0xAA, 0x94, 0x9E, 0x77, 0x1D, 0x77, 0x1D, 0x97, 0x70, 0xD7, 0x70, 0xAD, 0x77,
+    0x9D, 0x72, 0x99, 0x99, 0xAE, 0x97, 0x1F, 0xEA, 0x72, 0x9F, 0xDA, 0x97, 0x79, 0xEA, 0x77, 0x0E,
+    0x77, 0x0E, 0x77, 0x0E, 0x77, 0x9E, 0x76, 0x9E, 0x95, 0x9A, 0xA9, 0x99, 0x9A, 0xFC, 0x6F, 0xFF,
+    0x95, 0xAF, 0xFE, 0x96, 0xFF, 0xE9, 0x70, 0x9A, 0xFA, 0xA7, 0x10, 0x77, 0x73, 0x9C, 0xA7, 0x39,
+    0xD9, 0x72, 0x9E, 0x72, 0x9F, 0x71, 0x9F, 0xC7, 0x09, 0xDA, 0xAC, 0xA7, 0x9D, 0xA0, 0xD9, 0x69,
+    0xDA, 0x09, 0xD9, 0x59, 0xE1, 0xAD, 0x59, 0xE2, 0xE4, 0x9E, 0x29, 0xDA, 0x39, 0xE3, 0xAD, 0xA2,
+    0x9F, 0xAA, 0xAA, 0xFD, 0x9A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x70, 0xF7, 0x29, 0xEA, 0x72, 0xAE,
+    0x97, 0x2F, 0x73, 0xF7, 0x2A, 0xF4, 0x77, 0x70, 0x9F, 0xFE, 0x6A, 0xFF, 0xE6, 0xD9, 0x77, 0xD7,
+    0x79, 0xD7, 0x7A, 0xCA, 0x77, 0xD9, 0x76, 0x9D, 0x77, 0xAD, 0x99, 0x97, 0x4F, 0xFC, 0x97, 0x0F,
+    0xFE, 0x79, 0x95, 0xAD, 0xA7, 0x7E, 0x77, 0xE7, 0x69, 0xE7, 0x6E, 0xA4, 0x96, 0x9F, 0x5E, 0x99,
+    0x9A, 0xFD, 0x49, 0xFF, 0xF5, 0xAF, 0xFE, 0x6F, 0xFD, 0xA7, 0x9A, 0xFC, 0xAA, 0x70, 0x71, 0x9A,
+    0xFD, 0x70, 0x9F, 0xFC, 0x7A, 0xEA, 0x99, 0x99, 0x99, 0x6E, 0xA7, 0x5A, 0xD9, 0x75, 0x9D, 0x97,
+    0x6E, 0x76, 0x9D, 0x77, 0xE0, 0xAF, 0xCA, 0x69, 0xFF, 0xF5, 0xAF, 0xC9, 0x19, 0xEA, 0x4F, 0xA5,
+    0xE4, 0xEA, 0x6E, 0x39, 0xE7, 0xE3, 0x9D, 0xA7, 0xE3, 0xAD, 0x96, 0x9D, 0xA3, 0x9D, 0xA6, 0xE4,
+    0x9E, 0x93, 0xAE, 0xA5, 0xFF, 0xF6, 0xAF, 0xFD, 0x70, 0xFF, 0xA7, 0x2A, 0xFA, 0x70, 0x77, 0xFF,
+    0xFC, 0x99, 0xFF, 0xFC, 0x71, 0x99, 0xDA, 0x72, 0xAD, 0x73, 0xE7, 0x2A, 0xD9, 0x71, 0x9E, 0x72,
+    0xEA, 0x71, 0x9E, 0x72, 0xEA, 0x71, 0x9E, 0x72, 0xF7, 0x1A, 0xE9, 0x71, 0xF7, 0x1A, 0xEA, 0x71,
+    0xF7, 0x1F, 0xA7, 0x09, 0xF9, 0x70, 0xFC, 0x70, 0x9F, 0x97, 0x0F, 0xC7, 0x00, 0x71, 0xAA, 0xEA,
+    0x97, 0x2A, 0xEA, 0x9A, 0xDA, 0x70, 0xAD, 0x5D, 0x96, 0x9D, 0x6A, 0xD6, 0xDA, 0x6A, 0xD6, 0xD9,
+    0x6D, 0xA5, 0x9D, 0x95, 0xAD, 0x96, 0xDA, 0x49, 0xE7, 0xE9, 0x19, 0xAE, 0x70, 0x9F, 0xFC, 0x72,
+    0x9F, 0xD9, 0x71, 0xAF, 0xAF, 0xA7, 0xF9, 0x3E, 0xA5, 0xEA, 0x59, 0xE4, 0x9E, 0x7E, 0x4E, 0x97,
+    0xE3, 0x9E, 0x7A, 0xE3, 0x9E, 0x95, 0x9E, 0xA3, 0x9F, 0x92, 0x9A, 0xF5, 0xFF, 0xFC, 0x7F, 0xFD,
+    0xA7, 0x19, 0xAF, 0xAA, 0x70, 0x70, 0xAA, 0xEA, 0x72, 0xAF, 0xF9, 0x7E, 0x92, 0x9E, 0x6E, 0x5A,
+    0xD9, 0x4A, 0xD6, 0x9D, 0xA4, 0xD9, 0x6A, 0xDA, 0x3A, 0xD7, 0xAD, 0xA3, 0xDA, 0x7A, 0xD9, 0x3D,
+    0xA7, 0xE9, 0x3E, 0x6A, 0xE4, 0xEA, 0x4A, 0xF4, 0xAF, 0xFF, 0xA5, 0xAF, 0xFE, 0x96, 0x9F, 0xCA,
+    0x9E, 0x77, 0xDA, 0x76, 0xAD, 0x97, 0x59, 0xE5, 0x96, 0x9E, 0x94, 0x9F, 0xFF, 0x5A, 0xFF, 0xE6,
+    0xFF, 0xE7, 0xAF, 0xEA, 0x97, 0x5E, 0xA4, 0x9E, 0x94, 0xF9, 0x39, 0xF4, 0xFC, 0x49, 0x99, 0x99,
+    0x77, 0x77, 0x77, 0x77, 0x70, 0xAE, 0x5F, 0x49, 0xF4, 0xFC, 0x39, 0xFA, 0x30, 0x77, 0x2A, 0xE7,
+    0xF6, 0xAE, 0xA6, 0xFA, 0x5A, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0xFC, 0x59, 0xF9, 0x5F,
+    0xC6, 0xF6, 0x9E, 0xA6, 0xF6, 0xAE, 0xA5, 0x9F, 0x77, 0x20, 0x77, 0x77, 0x3A, 0xCA, 0x77, 0x0A,
+    0xF7, 0x6A, 0xFC, 0x97, 0x4A, 0xFC, 0xA7, 0x4A, 0xFC, 0xA7, 0x4A, 0xFC, 0xA7, 0x4A, 0xFD, 0x97,
+    0x4F, 0xD9, 0x76, 0xFC, 0x77, 0x0A, 0xFD, 0xA9, 0x75, 0xAF, 0xFC, 0xA9, 0x74, 0x9A, 0xFF, 0xCA,
+    0x97, 0x39, 0xAF, 0xFD, 0xA7, 0x49, 0xAF, 0xE7, 0x70, 0xAF, 0x97, 0x72, 0x9A, 0xA0, 0x72, 0x99,
+    0x99, 0x3A, 0xFF, 0xE2, 0xAF, 0xFF, 0x77, 0x77, 0x77, 0x74, 0x93, 0x9A, 0xAF, 0xFC, 0x3F, 0xFF,
+    0x91, 0x99, 0x99, 0x73, 0x59, 0x77, 0x4D, 0x97, 0x71, 0xAF, 0x97, 0x70, 0xAF, 0xC9, 0x77, 0x9F,
+    0xD9, 0x77, 0x9F, 0xD9, 0x77, 0x9F, 0xD9, 0x77, 0xAF, 0xD9, 0x77, 0xAF, 0xCA, 0x77, 0x9F, 0x97,
+    0x39, 0xAF, 0xE7, 0x19, 0xAF, 0xFC, 0x95, 0x9A, 0xFF, 0xCA, 0x94, 0x9A, 0xFF, 0xCA, 0x97, 0x0A,
+    0xFE, 0xA9, 0x73, 0xFA, 0x97, 0x7C, 0x97, 0x72, 0x77, 0x71, 0x99, 0x99, 0x97, 0x2A, 0xFF, 0x69,
+    0xFF, 0xE4, 0x9E, 0xA9, 0x19, 0xAF, 0x4D, 0x6A, 0xE7, 0x6E, 0x97, 0x5E, 0x97, 0x5E, 0x75, 0x9E,
+    0x75, 0xAD, 0xA7, 0x49, 0xE7, 0x5E, 0xA7, 0x4A, 0xE7, 0x4A, 0xE7, 0x4F, 0x97, 0x2A, 0xF9, 0x71,
+    0xAF, 0xC7, 0x2A, 0xFA, 0x73, 0xF9, 0x74, 0xF7, 0x49, 0xEA, 0x74, 0xAE, 0x97, 0x4F, 0x75, 0xF7,
+    0x59, 0x77, 0x77, 0x77, 0x3A, 0xD9, 0x75, 0xE9, 0x74, 0xAE, 0x97, 0x4F, 0x74, 0xAF, 0x74, 0x77,
+    0x77, 0x74, 0x9A, 0xFC, 0xA7, 0x72, 0x9F, 0xFD, 0xA7, 0x69, 0xEA, 0x94, 0x9D, 0xA7, 0x4A, 0xDA,
+    0x71, 0xD9, 0x72, 0xE7, 0x4D, 0x71, 0xE7, 0x5A, 0xC7, 0x0E, 0x19, 0xE0, 0xC6, 0xAC, 0x7E, 0x1A,
+    0xCA, 0x9A, 0xD6, 0xAC, 0x69, 0xD9, 0x09, 0xC3, 0xD6, 0xAC, 0x6E, 0x1C, 0x4C, 0xA6, 0xD5, 0xAD,
+    0xA0, 0xAA, 0x39, 0xC9, 0x5A, 0xC9, 0x5E, 0x90, 0xCA, 0x3D, 0x94, 0x9D, 0x6E, 0x90, 0xDA, 0xAF,
+    0x49, 0xD9, 0x59, 0xE9, 0x0A, 0xFE, 0x3A, 0xD9, 0x69, 0xEA, 0x1A, 0xDA, 0x0D, 0x9A, 0xF9, 0x79,
+    0xF7, 0x1E, 0xA7, 0x19, 0xFA, 0x77, 0x7F, 0xCA, 0x77, 0x6A, 0xFD, 0xA9, 0x90, 0x99, 0xAA, 0xC9,
+    0x74, 0xFF, 0xFE, 0x97, 0x5F, 0xFF, 0xD9, 0x76, 0x9F, 0xFF, 0x97, 0x70, 0x9A, 0xFD, 0xAA, 0x97,
+    0x77, 0x74, 0x77, 0xEA, 0x77, 0x1A, 0xEA, 0x77, 0x1F, 0xC7, 0x70, 0xFD, 0x77, 0x9D, 0xAE, 0x77,
+    0xE0, 0xE7, 0x6E, 0x90, 0xE9, 0x74, 0x9E, 0x1E, 0x97, 0x4E, 0x2E, 0x97, 0x3A, 0xDA, 0x2A, 0xDA,
+    0x72, 0x9E, 0x3A, 0xDA, 0x72, 0xE9, 0x3A, 0xE7, 0x1A, 0xE4, 0xAE, 0x70, 0x9E, 0x59, 0xE7, 0x0E,
+    0xA5, 0x9E, 0x7A, 0xE6, 0x9E, 0x96, 0xE9, 0x7E, 0x95, 0xFF, 0xFF, 0xA4, 0xAF, 0xFF, 0xFA, 0x4F,
+    0xFF, 0xFC, 0xA3, 0xFF, 0xFF, 0xE2, 0x9E, 0xA7, 0x2F, 0x2F, 0x73, 0xF1, 0xAE, 0xA7, 0x3F, 0x09,
+    0xF7, 0x39, 0xF9, 0x69, 0x99, 0x99, 0x99, 0x99, 0x97, 0x29, 0xFF, 0xEA, 0x70, 0xAF, 0xFF, 0xC7,
+    0xE9, 0x59, 0xE9, 0x6E, 0x70, 0xDA, 0x59, 0xE7, 0x0D, 0xA5, 0xAD, 0xA7, 0x9D, 0x95, 0xE7, 0x0E,
+    0x6E, 0x69, 0xE9, 0x5A, 0xFF, 0xFC, 0x96, 0xFF, 0xFA, 0x70, 0xFF, 0xFD, 0x95, 0x9E, 0x7A, 0xE9,
+    0x4A, 0xDA, 0x70, 0xF4, 0xE9, 0x70, 0x9E, 0x4E, 0x71, 0x9E, 0x39, 0xE7, 0x1F, 0x3A, 0xDA, 0x70,
+    0x9E, 0xA3, 0xE9, 0x70, 0xF9, 0x3E, 0x7A, 0xFC, 0x39, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xF4, 0xFF,
+    0xFF, 0x93, 0x9F, 0xFF, 0xE9, 0x4A, 0xFF, 0xFA, 0x70, 0x77, 0x77, 0x70, 0x9A, 0xFC, 0xA9, 0x74,
+    0x9F, 0xFD, 0xA7, 0x29, 0xFF, 0xF7, 0x2A, 0xFC, 0xA9, 0x99, 0x99, 0xAA, 0x71, 0xFC, 0xA7, 0x71,
+    0xFC, 0x77, 0x2F, 0xC7, 0x72, 0xAE, 0xA7, 0x72, 0x9F, 0x77, 0x3F, 0x77, 0x39, 0xEA, 0x77, 0x3F,
+    0x77, 0x39, 0xEA, 0x77, 0x3A, 0xE9, 0x77, 0x3F, 0x97, 0x73, 0xFA, 0x77, 0x29, 0xFC, 0x77, 0x29,
+    0xFD, 0x71, 0x96, 0x9F, 0xFA, 0x99, 0x99, 0xAE, 0x69, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0x97, 0xAF,
+    0xFF, 0xE7, 0x1F, 0xFF, 0xE7, 0x19, 0xFF, 0xFC, 0xA7, 0x3A, 0xFF, 0xCA, 0xA7, 0x77, 0x70, 0x6F,
+    0xFA, 0xA9, 0x74, 0x9F, 0xFF, 0xA7, 0x2A, 0xFF, 0xFD, 0x71, 0xFF, 0xFF, 0x79, 0xE6, 0x9F, 0xCA,
+    0x6A, 0xE7, 0x0A, 0xF6, 0xEA, 0x71, 0xAE, 0xA5, 0xE9, 0x72, 0xF4, 0x9E, 0x73, 0xF4, 0xAE, 0x73,
+    0xF4, 0xEA, 0x73, 0xF4, 0xE9, 0x73, 0xF3, 0x9E, 0x74, 0xF3, 0xAE, 0x73, 0x9F, 0x3E, 0xA7, 0x3A,
+    0xEA, 0x3E, 0x97, 0x3F, 0x92, 0x9E, 0x73, 0xFC, 0x3A, 0xE7, 0x19, 0xFC, 0xA3, 0xEA, 0x99, 0x99,
+    0x99, 0x9A, 0xFF, 0x4F, 0xFF, 0xFE, 0x93, 0x9F, 0xFF, 0xFD, 0xA4, 0xFF, 0xFF, 0xDA, 0x5F, 0xFF,
+    0xFC, 0x95, 0x9F, 0xFF, 0xE9, 0x7A, 0xFF, 0xDA, 0xA9, 0x72, 0x77, 0x19, 0x99, 0x97, 0xAF, 0xFF,
+    0xD7, 0xFF, 0xFD, 0x97, 0xFF, 0xFC, 0xA7, 0x9E, 0x97, 0x71, 0xE9, 0x77, 0x2E, 0x77, 0x29, 0xE7,
+    0x72, 0xAD, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE9, 0x99, 0x99, 0xAA, 0xA7, 0x2A, 0xFF, 0xE7, 0x2F,
+    0xFE, 0xA7, 0x2F, 0xFE, 0x97, 0x19, 0xE9, 0x77, 0x1E, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72,
+    0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9F, 0xFF, 0xD9, 0x6A, 0xFF, 0xFD, 0x96, 0xFF, 0xFE, 0x96, 0xFF,
+    0xFE, 0x95, 0xAF, 0xFF, 0xE6, 0x79, 0x99, 0x99, 0x9A, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xA6, 0x9F,
+    0xFF, 0x7F, 0x77, 0x0E, 0x97, 0x79, 0xE7, 0x70, 0xEA, 0x77, 0x0E, 0x97, 0x79, 0xE7, 0x70, 0xAF,
+    0xFE, 0x70, 0xFF, 0xEA, 0x79, 0xFF, 0xE9, 0x7A, 0xEA, 0xAA, 0xAA, 0xA9, 0x97, 0x0E, 0xA7, 0x79,
+    0xE9, 0x77, 0xAE, 0x77, 0x0F, 0x77, 0x9E, 0xA7, 0x7A, 0xE9, 0x77, 0xF7, 0x70, 0xF7, 0x7A, 0xEA,
+    0x77, 0xF9, 0x77, 0xF7, 0x7A, 0xF7, 0x70, 0x77, 0x77, 0x49, 0xAA, 0xFE, 0xA9, 0x71, 0x9F, 0xFF,
+    0xD7, 0x0F, 0xFC, 0xAA, 0xAA, 0xE7, 0xFD, 0x97, 0x09, 0x6F, 0xC9, 0x77, 0x1A, 0xF7, 0x73, 0xF9,
+    0x77, 0x2A, 0xEA, 0x77, 0x3F, 0x77, 0x3A, 0xEA, 0x77, 0x3F, 0x97, 0x73, 0xF7, 0x73, 0x9E, 0xA7,
+    0xA9, 0x99, 0x7A, 0xE9, 0x7F, 0xFA, 0x2F, 0x97, 0xFF, 0xC2, 0xF7, 0x29, 0xAF, 0xC2, 0xF7, 0x4D,
+    0xA9, 0x92, 0xF9, 0x72, 0xAD, 0x94, 0xFC, 0x72, 0xE9, 0x4F, 0xDA, 0xA9, 0x99, 0x99, 0xAF, 0xC5,
+    0xFF, 0xFF, 0xE5, 0xAF, 0xFF, 0xFC, 0xA6, 0xFF, 0xFF, 0xCA, 0x7A, 0xFF, 0xFD, 0x97, 0x29, 0xAF,
+    0xEA, 0x97, 0x69, 0xAA, 0xA7, 0x3A, 0xAA, 0x7A, 0xE7, 0x2A, 0xE7, 0xEA, 0x72, 0xEA, 0x69, 0xE9,
+    0x71, 0x9E, 0x96, 0xAE, 0x72, 0xAE, 0x7F, 0x72, 0xF7, 0xEA, 0x72, 0xEA, 0x69, 0xE9, 0x71, 0x9E,
+    0x96, 0xF7, 0x2F, 0x7F, 0x72, 0xF6, 0x9E, 0xA7, 0x19, 0xF6, 0xAE, 0x97, 0x1A, 0xEA, 0x6F, 0x72,
+    0xF9, 0x59, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xF6, 0xAF, 0xFF, 0xFE, 0x6F, 0xFF, 0xFE, 0xA6,
+    0xFF, 0xFF, 0xE9, 0x59, 0xFF, 0xFF, 0xE6, 0xFF, 0xFF, 0xF6, 0xFA, 0x71, 0xFA, 0x59, 0xF9, 0x70,
+    0x9F, 0x95, 0xAF, 0x71, 0xAF, 0x95, 0xFC, 0x71, 0xFC, 0x6F, 0xA7, 0x09, 0xFC, 0x5A, 0xF9, 0x70,
+    0xAF, 0xA5, 0x6E, 0xA7, 0xF6, 0x9E, 0xA6, 0xAE, 0x96, 0xAE, 0x7F, 0x7E, 0x96, 0x9E, 0x7A, 0xE7,
+    0xEA, 0x7E, 0x96, 0xAE, 0x7F, 0x7E, 0xA6, 0x9E, 0xA6, 0xAE, 0x96, 0xF7, 0xF6, 0xAE, 0xA6, 0xF9,
+    0x6F, 0x95, 0xAF, 0x6F, 0xC5, 0x9F, 0xA5, 0x9A, 0xEA, 0x50, 0x77, 0xAA, 0xAA, 0x77, 0x9E, 0xA7,
+    0x7A, 0xE9, 0x77, 0xF7, 0x79, 0xF7, 0x7A, 0xE9, 0x77, 0xF7, 0x70, 0xF7, 0x7A, 0xE9, 0x77, 0xF7,
+    0x70, 0xF7, 0x79, 0xEA, 0x77, 0xAE, 0x77, 0x0F, 0x77, 0x9E, 0xA7, 0x7A, 0xE9, 0x77, 0xF7, 0x70,
+    0xEA, 0x77, 0xAE, 0x97, 0x7F, 0x77, 0x0E, 0xA7, 0x79, 0xE9, 0x77, 0xAE, 0x77, 0x0E, 0xA7, 0x7A,
+    0xE9, 0x76, 0x9F, 0x72, 0x92, 0xAF, 0xA7, 0x2F, 0xFC, 0x72, 0x9F, 0xF9, 0x72, 0xAF, 0xEA, 0x73,
+    0xFE, 0x97, 0x4F, 0xA9, 0x77, 0x77, 0x20, 0x70, 0xE9, 0x4F, 0x70, 0x9E, 0x4F, 0x97, 0x0E, 0xA3,
+    0xAE, 0x97, 0x1E, 0x92, 0xAE, 0xA7, 0x1A, 0xE2, 0x9E, 0xA7, 0x2E, 0xA1, 0x9F, 0x73, 0xE9, 0x1F,
+    0x73, 0xAE, 0x1F, 0x74, 0xEA, 0x0F, 0x97, 0x39, 0xE9, 0xF9, 0x74, 0xAF, 0xEA, 0x75, 0xFE, 0xA7,
+    0x59, 0xFE, 0x76, 0xAF, 0xD7, 0x7F, 0xF7, 0x59, 0xFF, 0x97, 0x4A, 0xFF, 0xC7, 0x4F, 0x0F, 0xD7,
+    0x29, 0xEA, 0x0A, 0xFC, 0xA7, 0x1F, 0x91, 0xFD, 0x97, 0x0F, 0x2A, 0xFD, 0x79, 0xEA, 0x3F, 0xDA,
+    0x6F, 0x93, 0xAF, 0xD9, 0x5F, 0x49, 0xFE, 0x4A, 0xEA, 0x5F, 0xEA, 0x30, 0x7A, 0xAA, 0x97, 0x49,
+    0xE7, 0x5A, 0xE7, 0x5E, 0xA7, 0x5E, 0x97, 0x4A, 0xE7, 0x5E, 0xA7, 0x5E, 0x97, 0x49, 0xE7, 0x5F,
+    0x75, 0xEA, 0x74, 0x9E, 0x75, 0xF7, 0x5E, 0xA7, 0x49, 0xE9, 0x74, 0xAE, 0x75, 0xEA, 0x74, 0x9E,
+    0x97, 0x4A, 0xE7, 0x5F, 0x74, 0x9F, 0xAA, 0xAA, 0xAF, 0xD1, 0xAF, 0xFF, 0xDA, 0x1F, 0xFF, 0xE9,
+    0x1F, 0xFF, 0xE1, 0xAF, 0xFF, 0xE1, 0x7A, 0xAA, 0xAA, 0x73, 0xAA, 0xAA, 0xA7, 0x0F, 0xC9, 0x71,
+    0x9F, 0xC7, 0x9F, 0xCA, 0x71, 0xFC, 0xA7, 0xFD, 0xA7, 0x0A, 0xFC, 0x97, 0xFE, 0x79, 0xFD, 0x79,
+    0xFE, 0x7F, 0xE7, 0xAF, 0xE6, 0xAF, 0xE7, 0xFF, 0x59, 0xFE, 0xA6, 0x9E, 0x9F, 0x94, 0xFA, 0xE9,
+    0x6A, 0xDA, 0x9F, 0xA3, 0xAE, 0xAA, 0xE9, 0x6E, 0xA0, 0xFA, 0x29, 0xF0, 0xF6, 0x9E, 0x90, 0xFC,
+    0x2F, 0x99, 0xF6, 0xAE, 0x1F, 0xC1, 0xAE, 0xA0, 0xAE, 0xA6, 0xF1, 0xFC, 0x09, 0xF1, 0xFA, 0x59,
+    0xEA, 0x1A, 0xF9, 0xF9, 0x09, 0xF9, 0x5A, 0xEA, 0x1A, 0xFF, 0xC1, 0xAF, 0x6F, 0x91, 0x9F, 0xF2,
+    0xFC, 0x59, 0xF3, 0xFE, 0xA1, 0x9F, 0xC5, 0xAF, 0x3F, 0xE2, 0xAF, 0xA5, 0xFA, 0x3F, 0xD9, 0x2F,
+    0xC9, 0x5F, 0x93, 0xFC, 0xA2, 0x9F, 0xC5, 0xAF, 0x93, 0xAF, 0x3A, 0xFC, 0x5F, 0xC4, 0xAE, 0x93,
+    0xFD, 0x5F, 0xC7, 0x49, 0xFC, 0xA4, 0xAF, 0xA7, 0x4A, 0xFC, 0x94, 0x77, 0x69, 0xAA, 0xA7, 0x09,
+    0xEA, 0x71, 0xF7, 0x0F, 0xC7, 0x1E, 0xA7, 0x0F, 0xC7, 0x0A, 0xE7, 0x0A, 0xFC, 0x97, 0xF7, 0x0F,
+    0xDA, 0x7E, 0xA7, 0x9F, 0xDA, 0x6A, 0xE9, 0x7A, 0xFE, 0x6F, 0x70, 0xFF, 0x59, 0xEA, 0x79, 0xEA,
+    0xAE, 0x94, 0xAE, 0x97, 0xAE, 0x99, 0xEA, 0x4F, 0x70, 0xF1, 0xEA, 0x39, 0xEA, 0x79, 0xF1, 0xF3,
+    0xAE, 0x97, 0xAE, 0xA1, 0xF3, 0xF7, 0x0F, 0x91, 0xAE, 0x91, 0x9E, 0xA7, 0x9F, 0x29, 0xEA, 0x1A,
+    0xE9, 0x7A, 0xF3, 0xF1, 0xF7, 0x0F, 0xA3, 0xF0, 0x9E, 0xA7, 0x9F, 0x93, 0xF0, 0xF9, 0x7F, 0xC4,
+    0xAE, 0x9F, 0x70, 0xFC, 0x49, 0xFF, 0x79, 0xFA, 0x5F, 0xE9, 0x7F, 0xC9, 0x5F, 0xE7, 0x0F, 0xC6,
+    0xAF, 0xD7, 0xAF, 0xC6, 0xAF, 0xC9, 0x70, 0x73, 0x9A, 0xFD, 0xA7, 0x70, 0xAF, 0xFE, 0xA7, 0x49,
+    0xFE, 0xAF, 0xE7, 0x29, 0xFC, 0x94, 0xAF, 0xA7, 0x09, 0xFA, 0x7A, 0xF7, 0x0F, 0x97, 0x1F, 0x96,
+    0xFA, 0x72, 0xAE, 0xA5, 0x9E, 0xA7, 0x39, 0xEA, 0x5F, 0x75, 0xEA, 0x49, 0xE9, 0x75, 0xE9, 0x4F,
+    0x76, 0xE9, 0x4E, 0x97, 0x59, 0xE4, 0x9E, 0x76, 0xAE, 0x4A, 0xE7, 0x6E, 0x94, 0xEA, 0x75, 0x9E,
+    0x5E, 0xA7, 0x5F, 0x5F, 0x74, 0xF9, 0x5F, 0xA7, 0x19, 0xFC, 0x6F, 0xD9, 0x92, 0x99, 0xAF, 0xD9,
+    0x6F, 0xFF, 0xFF, 0x7A, 0xFF, 0xFF, 0xD7, 0x1F, 0xFF, 0xFC, 0x97, 0x1A, 0xFF, 0xFE, 0x74, 0x9F,
+    0xFF, 0xA7, 0x79, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x7F, 0xFC, 0xA9, 0x73, 0xFF, 0xF7, 0x19, 0xEA,
+    0xAA, 0xFE, 0x70, 0xE9, 0x59, 0xE9, 0x7E, 0x7A, 0xDA, 0x69, 0xE7, 0x9D, 0xA6, 0xEA, 0x7A, 0xDA,
+    0x6E, 0x97, 0xE6, 0x9E, 0x7F, 0x6A, 0xE4, 0x9A, 0xF9, 0x6F, 0xFF, 0xDA, 0x69, 0xFF, 0xFC, 0xA7,
+    0xAF, 0xFE, 0xA7, 0x1F, 0xCA, 0xAA, 0xA9, 0x73, 0x9E, 0xA7, 0x71, 0xAE, 0x97, 0x71, 0xF9, 0x77,
+    0x09, 0xF7, 0x71, 0xAF, 0x77, 0x1F, 0xA7, 0x71, 0xF9, 0x77, 0x0A, 0xF7, 0x71, 0xFC, 0x77, 0x1F,
+    0xC7, 0x70, 0xAF, 0xA7, 0x70, 0x75, 0x9A, 0xFC, 0x97, 0x72, 0xAF, 0xFD, 0x97, 0x69, 0xFD, 0xAA,
+    0xFC, 0xA7, 0x4A, 0xF9, 0x5F, 0x97, 0x2A, 0xEA, 0x70, 0xF7, 0x1A, 0xEA, 0x71, 0x9E, 0x97, 0x9E,
+    0xA7, 0x3E, 0x97, 0xF7, 0x4E, 0xA6, 0xAE, 0x75, 0xEA, 0x6E, 0xA7, 0x5E, 0xA5, 0xAE, 0x76, 0xE9,
+    0x5E, 0xA7, 0x6E, 0x94, 0x9E, 0x97, 0x59, 0xE5, 0xAE, 0x76, 0xF5, 0xAE, 0x76, 0xE9, 0x5F, 0x75,
+    0xAE, 0x6F, 0x75, 0xEA, 0x6F, 0x6C, 0xA3, 0xF7, 0xFA, 0x4A, 0xFA, 0xFA, 0x7F, 0xDA, 0xAA, 0xAF,
+    0xFD, 0x70, 0xFF, 0xFF, 0xE7, 0x1A, 0xFF, 0xFF, 0xC7, 0x3F, 0xFF, 0xF7, 0x5F, 0xFF, 0xDA, 0x76,
+    0x9A, 0xFF, 0xF7, 0x75, 0xAF, 0xE7, 0x75, 0xFE, 0x97, 0x74, 0xAF, 0xE7, 0x75, 0xFE, 0xA5, 0x79,
+    0xAA, 0xAA, 0xAA, 0x99, 0x74, 0xFF, 0xDA, 0x71, 0x9F, 0xFE, 0xA7, 0x0A, 0xCA, 0x5A, 0xE7, 0x0D,
+    0x96, 0xAD, 0x96, 0x9D, 0x7A, 0xD9, 0x6A, 0xD7, 0xAD, 0x7D, 0xA6, 0x9E, 0x69, 0xD6, 0x9E, 0xA6,
+    0xAD, 0x49, 0xFC, 0x7F, 0xFF, 0xC9, 0x69, 0xFF, 0xEA, 0x70, 0xAF, 0xFD, 0x97, 0x1F, 0xFF, 0x97,
+    0x0F, 0xA9, 0x99, 0xAF, 0x7A, 0xE9, 0x49, 0xE9, 0x6F, 0x6E, 0xA6, 0xF6, 0xEA, 0x5A, 0xF5, 0x9E,
+    0xA5, 0xFA, 0x5A, 0xEA, 0x5F, 0x95, 0xFA, 0x4A, 0xF5, 0x9F, 0xA4, 0xFC, 0x5A, 0xFA, 0x4F, 0xC5,
+    0xFC, 0xA3, 0xAF, 0xA5, 0xFC, 0xA3, 0x76, 0x99, 0x99, 0x99, 0x97, 0x69, 0xFF, 0xE7, 0x29, 0xFF,
+    0xFC, 0x72, 0xFF, 0xFC, 0xA7, 0x1F, 0xD9, 0x94, 0x97, 0x1A, 0xF7, 0x73, 0xEA, 0x77, 0x39, 0xE7,
+    0x74, 0xAD, 0xA7, 0x74, 0xF7, 0x74, 0xFC, 0xA9, 0x77, 0x19, 0xFF, 0xA9, 0x76, 0xAF, 0xFD, 0xA7,
+    0x59, 0xFF, 0xE9, 0x76, 0x9A, 0xFF, 0xA7, 0x71, 0xAF, 0xD9, 0x77, 0x1A, 0xFC, 0xA7, 0x71, 0xAF,
+    0xD7, 0x71, 0xFE, 0x59, 0x71, 0xAF, 0xDA, 0x4A, 0xFA, 0xAA, 0xAA, 0xFF, 0xC4, 0xAF, 0xFF, 0xFD,
+    0x93, 0xAF, 0xFF, 0xFD, 0x93, 0xAF, 0xFF, 0xFD, 0x94, 0xAF, 0xFF, 0xF9, 0x79, 0xAF, 0xFD, 0xA9,
+    0x77, 0x77, 0x10, 0x1F, 0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0xF1, 0xAF, 0xFF, 0xFE, 0xA1, 0xAA, 0xA9,
+    0x99, 0x1A, 0xE4, 0x99, 0x97, 0x2E, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xAE, 0x77, 0x2E,
+    0xA7, 0x71, 0x9E, 0x97, 0x71, 0xAE, 0x77, 0x2F, 0x77, 0x19, 0xEA, 0x77, 0x1A, 0xE9, 0x77, 0x1F,
+    0x77, 0x2F, 0x77, 0x19, 0xEA, 0x77, 0x1F, 0xA7, 0x71, 0xF9, 0x77, 0x09, 0xF7, 0x71, 0xAF, 0x77,
+    0x1F, 0xA7, 0x70, 0x9F, 0x97, 0x70, 0xAF, 0x77, 0x1F, 0xC7, 0x60, 0x5F, 0x97, 0x09, 0xF9, 0x49,
+    0xF9, 0x70, 0xAF, 0x5A, 0xF7, 0x1F, 0xC5, 0xFA, 0x71, 0xFA, 0x5F, 0x97, 0x09, 0xF5, 0x9F, 0x71,
+    0xAF, 0x5A, 0xF7, 0x1F, 0xA5, 0xF9, 0x71, 0xF9, 0x5F, 0x71, 0x9F, 0x6F, 0x71, 0xAE, 0xA5, 0x9E,
+    0xA7, 0x1A, 0xE9, 0x5A, 0xE7, 0x2F, 0x6F, 0x72, 0xEA, 0x6E, 0xA7, 0x19, 0xE9, 0x59, 0xE9, 0x71,
+    0xF6, 0xAE, 0x72, 0xF6, 0xF7, 0x1A, 0xE9, 0x6F, 0x71, 0xF7, 0xF9, 0x7F, 0xC6, 0x9F, 0xCA, 0x99,
+    0x99, 0xAF, 0xD9, 0x69, 0xFF, 0xFF, 0xC7, 0x9F, 0xFF, 0xF9, 0x70, 0xFF, 0xFE, 0xA7, 0x1A, 0xFF,
+    0xFC, 0xA7, 0x39, 0xAF, 0xFC, 0xA9, 0x77, 0x77, 0x30, 0x0A, 0xAA, 0x97, 0x6A, 0xAA, 0x90, 0xF7,
+    0x5F, 0x1F, 0x74, 0xAE, 0x91, 0xF7, 0x4E, 0xA2, 0xF7, 0x3F, 0x3F, 0x72, 0xAE, 0xA3, 0xF9, 0x70,
+    0x9F, 0x4A, 0xE9, 0x70, 0xF9, 0x4A, 0xE9, 0x7A, 0xEA, 0x5A, 0xEA, 0x69, 0xF6, 0xAE, 0xA6, 0xFA,
+    0x6A, 0xF5, 0xAF, 0x79, 0xF4, 0x9F, 0x97, 0x9F, 0x4F, 0xA7, 0x09, 0xF3, 0xAF, 0x71, 0x9F, 0x29,
+    0xFA, 0x71, 0x9F, 0x91, 0xFC, 0x73, 0xF9, 0x0A, 0xF9, 0x73, 0xFF, 0xDA, 0x74, 0xFF, 0xD7, 0x5F,
+    0xFC, 0xA7, 0x5F, 0xFC, 0x76, 0xFF, 0x97, 0x6F, 0xF7, 0x7F, 0xE7, 0x60, 0x1E, 0xA7, 0x75, 0xAE,
+    0x2E, 0xA7, 0x75, 0xEA, 0x2E, 0xA7, 0x74, 0xF2, 0x9E, 0xA7, 0x73, 0x9E, 0xA2, 0x9E, 0xA7, 0x73,
+    0xF3, 0x9E, 0xA7, 0x72, 0x9E, 0xA3, 0x9E, 0xA7, 0x72, 0xF4, 0x9E, 0xA6, 0xAE, 0x69, 0xEA, 0x4A,
+    0xE9, 0x59, 0xF6, 0xF5, 0xAE, 0x95, 0xFC, 0x5A, 0xEA, 0x5A, 0xE9, 0x4F, 0xD9, 0x4F, 0x6A, 0xE9,
+    0x3F, 0xEA, 0x3A, 0xEA, 0x6A, 0xE9, 0x2A, 0xFF, 0x3F, 0x7F, 0x91, 0x9F, 0xAF, 0x2A, 0xEA, 0x7F,
+    0x91, 0xFA, 0x0F, 0x2F, 0x70, 0xF9, 0x0F, 0xC1, 0xF9, 0x0A, 0xE9, 0x70, 0xF9, 0xAF, 0x91, 0xFA,
+    0x9F, 0x71, 0xFA, 0xFA, 0x2F, 0xAF, 0x97, 0x1F, 0xFC, 0x3A, 0xFF, 0x72, 0xFF, 0x93, 0xAF, 0xE9,
+    0x72, 0xFE, 0xA4, 0xAF, 0xE7, 0x3F, 0xE5, 0x9F, 0xD9, 0x73, 0xFD, 0x95, 0x9F, 0xD7, 0x39, 0xFC,
+    0xA7, 0xFC, 0x97, 0x39, 0xFC, 0x70, 0xFC, 0x74, 0x7A, 0xD9, 0x73, 0x9D, 0xA7, 0x09, 0xE7, 0x29,
+    0xE7, 0x2E, 0x97, 0x09, 0xE7, 0x3A, 0xE7, 0x9E, 0x97, 0x39, 0xE9, 0x59, 0xE9, 0x75, 0xEA, 0x49,
+    0xE9, 0x76, 0xAE, 0x39, 0xEA, 0x77, 0x9E, 0xA1, 0x9E, 0xA7, 0x71, 0xF0, 0x9E, 0xA7, 0x72, 0xAE,
+    0xAF, 0x77, 0x39, 0xFE, 0x77, 0x5F, 0xD7, 0x76, 0xAF, 0x77, 0x69, 0xFC, 0x97, 0x74, 0x9F, 0xDA,
+    0x77, 0x39, 0xFF, 0x77, 0x29, 0xFA, 0xFA, 0x77, 0x09, 0xFA, 0x0F, 0xC7, 0x79, 0xFA, 0x19, 0xF9,
+    0x75, 0x9F, 0xC3, 0xFC, 0x74, 0x9F, 0xC4, 0xFC, 0x97, 0x3F, 0xC5, 0x9F, 0xC7, 0x2F, 0xC7, 0xFC,
+    0x71, 0xFC, 0x97, 0xAF, 0xA7, 0xFC, 0x97, 0x09, 0xFC, 0x60, 0x0E, 0xA7, 0x3E, 0x90, 0xF7, 0x2E,
+    0xA1, 0xAE, 0x71, 0xAE, 0x29, 0xE9, 0x7A, 0xE4, 0xF6, 0x9E, 0x94, 0xF6, 0xEA, 0x5A, 0xE9, 0x4F,
+    0x6A, 0xEA, 0x3F, 0x79, 0xF2, 0xAE, 0x97, 0x0F, 0x90, 0xAE, 0xA7, 0x1F, 0xA9, 0xF7, 0x2A, 0xFF,
+    0x97, 0x29, 0xFE, 0x97, 0x39, 0xFD, 0xA7, 0x5F, 0xD7, 0x6F, 0xC9, 0x76, 0xFA, 0x77, 0xF9, 0x76,
+    0xAF, 0x77, 0xFC, 0x76, 0xAF, 0xA7, 0x6F, 0xC9, 0x75, 0x9F, 0xC7, 0x6F, 0xD7, 0x59, 0xFC, 0xA7,
+    0x50, 0x70, 0x9F, 0xFF, 0xFD, 0x72, 0xFF, 0xFF, 0xCA, 0x72, 0xFF, 0xFF, 0xC9, 0x72, 0xFF, 0xFF,
+    0xC7, 0x76, 0xFC, 0xA7, 0x75, 0xFC, 0xA7, 0x74, 0x9F, 0xCA, 0x77, 0x49, 0xFC, 0xA7, 0x74, 0xAF,
+    0xC9, 0x77, 0x4F, 0xD9, 0x77, 0x39, 0xFD, 0x77, 0x49, 0xFD, 0x77, 0x4A, 0xFD, 0x77, 0x4F, 0xDA,
+    0x77, 0x4F, 0xDA, 0x77, 0x39, 0xFD, 0xA7, 0x73, 0xAF, 0xD9, 0x77, 0x3F, 0xE9, 0x77, 0x3F, 0xE7,
+    0x73, 0x9F, 0xE7, 0x73, 0x9F, 0xFF, 0xFE, 0xA7, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC6, 0x9F,
+    0xFF, 0xFF, 0xC6, 0xAF, 0xFF, 0xFF, 0xC6, 0x74, 0xAF, 0xD9, 0x74, 0xFE, 0x97, 0x39, 0xFE, 0x74,
+    0xAD, 0xA7, 0x70, 0xE9, 0x77, 0x9E, 0x77, 0x0A, 0xDA, 0x77, 0x0E, 0x97, 0x70, 0xE7, 0x70, 0xAD,
+    0xA7, 0x70, 0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70, 0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70,
+    0xAD, 0x97, 0x70, 0xE7, 0x70, 0x9E, 0x77, 0x0A, 0xDA, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70, 0xAD,
+    0xA7, 0x70, 0xE9, 0x77, 0x9E, 0x77, 0x0A, 0xDA, 0x77, 0x0E, 0x97, 0x70, 0xE7, 0x70, 0xAD, 0xA7,
+    0x70, 0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70, 0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70, 0xAD,
+    0xA7, 0x70, 0xE7, 0x70, 0x9F, 0xEA, 0x73, 0xAF, 0xE7, 0x4F, 0xF7, 0x49, 0x99, 0x99, 0x99, 0x97,
+    0x30, 0x59, 0x3C, 0x29, 0xC9, 0x1A, 0xC9, 0x1A, 0xC9, 0x1A, 0xCA, 0x1A, 0xCA, 0x1A, 0xD1, 0xAD,
+    0x1A, 0xD1, 0x9D, 0x19, 0xD1, 0x9D, 0x90, 0x9D, 0x90, 0x9D, 0x90, 0x9D, 0xA0, 0x9D, 0xA1, 0xE1,
+    0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xDA, 0x1D, 0x2C, 0x39, 0x20, 0xAF, 0xD9, 0x73, 0xAF, 0xDA, 0x73,
+    0x9F, 0xE7, 0x70, 0xE9, 0x77, 0xAD, 0xA7, 0x70, 0xE7, 0x70, 0xE9, 0x77, 0xAD, 0xA7, 0x79, 0xE7,
+    0x70, 0xE9, 0x77, 0xAD, 0xA7, 0x79, 0xE7, 0x70, 0xE7, 0x70, 0xAD, 0xA7, 0x79, 0xE7, 0x70, 0xE7,
+    0x70, 0xE9, 0x77, 0x9E, 0x77, 0x0E, 0x77, 0x0E, 0x97, 0x7A, 0xDA, 0x77, 0x0E, 0x77, 0x0E, 0x97,
+    0x7A, 0xDA, 0x77, 0x9E, 0x77, 0x0E, 0x97, 0x7A, 0xDA, 0x77, 0x9E, 0x77, 0x0E, 0x77, 0x0A, 0xDA,
+    0x77, 0x9E, 0x77, 0x0E, 0x77, 0x0A, 0xDA, 0x77, 0x9E, 0x77, 0x0E, 0x77, 0x0E, 0x97, 0x79, 0xE7,
+    0x3F, 0xF7, 0x39, 0xFE, 0x97, 0x3F, 0xEA, 0x73, 0x99, 0x99, 0x99, 0x99, 0x3A, 0xC9, 0x71, 0xE9,
+    0x7A, 0xF9, 0x59, 0xD1, 0xAC, 0xA4, 0xD3, 0x9D, 0x2A, 0xA6, 0x9A, 0x00, 0x77, 0x59, 0xFF, 0xFF,
+    0xD1, 0xFF, 0xFF, 0xDA, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x0D, 0xA5,
+    0x9E, 0x5A, 0xE5, 0xF7, 0x99, 0x00, 0x77, 0x72, 0xAE, 0xA7, 0x2A, 0xFE, 0x9D, 0x5F, 0xFE, 0xA4,
+    0xF9, 0x2A, 0xEA, 0x39, 0xE5, 0xE9, 0x3D, 0xA6, 0xE3, 0xAD, 0x7E, 0x3D, 0x97, 0xE2, 0x9D, 0x79,
+    0xDA, 0x2D, 0xA7, 0xEA, 0x2D, 0x96, 0xAE, 0x92, 0xDA, 0x5F, 0xC3, 0xF9, 0x9A, 0xAF, 0xD3, 0xFF,
+    0xFD, 0x3A, 0xFF, 0xFA, 0x4F, 0xFA, 0x9D, 0xA5, 0xAF, 0xA9, 0x09, 0xD9, 0x10, 0x4E, 0xA7, 0x49,
+    0xE9, 0x74, 0xAE, 0x75, 0xAE, 0x75, 0xEA, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0x9E, 0x75, 0xAD, 0xA7,
+    0x5E, 0x90, 0xAF, 0xA6, 0xEA, 0xFF, 0x93, 0x9F, 0xDA, 0x99, 0xAE, 0x3A, 0xFC, 0x49, 0xDA, 0x2F,
+    0xC6, 0xE2, 0xF7, 0xE2, 0xEA, 0x7E, 0x19, 0xE7, 0x0D, 0xA1, 0xAE, 0x7A, 0xD9, 0x1F, 0x69, 0xE2,
+    0xF5, 0xAE, 0x92, 0xFA, 0x99, 0x9A, 0xFA, 0x3F, 0xFF, 0xC4, 0xFF, 0xF5, 0xAF, 0xFC, 0xA7, 0xAF,
+    0xE9, 0x73, 0x99, 0x97, 0x10, 0x77, 0x59, 0xAF, 0xA5, 0x9F, 0xF4, 0xAF, 0xA9, 0x9A, 0xA3, 0x9E,
+    0xA7, 0x1E, 0x97, 0x1A, 0xDA, 0x72, 0xE7, 0x29, 0xDA, 0x72, 0xAD, 0x97, 0x2E, 0x97, 0x2E, 0x97,
+    0x2F, 0x72, 0xFC, 0xA9, 0x9A, 0xA4, 0x9F, 0xFC, 0x94, 0xAF, 0xFC, 0x6A, 0xFD, 0x97, 0x71, 0x77,
+    0x3D, 0x97, 0x72, 0x9D, 0x77, 0x3E, 0x77, 0x3D, 0xA7, 0x72, 0x9D, 0x77, 0x3E, 0x77, 0x3D, 0xA7,
+    0x72, 0x9D, 0x97, 0x29, 0xF9, 0x1A, 0xD7, 0x2F, 0xEA, 0x0D, 0xA7, 0x09, 0xFF, 0xCA, 0xD9, 0x79,
+    0xE9, 0x2A, 0xFC, 0x70, 0xDA, 0x5F, 0xC7, 0xE6, 0xF9, 0x6A, 0xD7, 0xF7, 0xDA, 0x7F, 0x69, 0xD9,
+    0x7E, 0xA6, 0xAD, 0x7A, 0xE9, 0x6E, 0x69, 0xF7, 0xEA, 0x49, 0xFC, 0x7F, 0xFF, 0xDA, 0x7A, 0xFF,
+    0xFC, 0x97, 0x0F, 0xFF, 0xC7, 0x19, 0xFF, 0xAE, 0x73, 0xAF, 0xA1, 0xDA, 0x77, 0x75, 0x79, 0xAE,
+    0xA7, 0x19, 0xFF, 0x7A, 0xE9, 0x3D, 0x59, 0xDA, 0x59, 0xC9, 0x39, 0xD9, 0x7D, 0x3D, 0xA3, 0x99,
+    0xAA, 0xE2, 0xAF, 0xFF, 0xD2, 0xFF, 0xFD, 0xA1, 0x9D, 0xA9, 0x99, 0x97, 0x1A, 0xD7, 0x6E, 0x76,
+    0xEA, 0x75, 0xAF, 0x95, 0x9A, 0x39, 0xFF, 0xFA, 0x4F, 0xFF, 0x95, 0xFF, 0xE7, 0x9A, 0xFC, 0xA9,
+    0x40, 0x77, 0x5A, 0xFA, 0x6F, 0xD9, 0x59, 0xDA, 0x71, 0xDA, 0x71, 0x9D, 0x72, 0xAC, 0xA7, 0x2D,
+    0xA7, 0x9F, 0xFC, 0x3F, 0xFC, 0xA3, 0x99, 0xEA, 0x99, 0x96, 0xE7, 0x19, 0xDA, 0x71, 0xAD, 0x97,
+    0x1E, 0x72, 0xE7, 0x1A, 0xE7, 0x1E, 0xA7, 0x1E, 0x97, 0x09, 0xE7, 0x1A, 0xE7, 0x1E, 0xA7, 0x09,
+    0xE9, 0x70, 0xAE, 0x71, 0x70, 0xAE, 0xA2, 0x9A, 0xA7, 0x9F, 0xE9, 0x0E, 0x69, 0xFF, 0xF9, 0x59,
+    0xE9, 0x2F, 0xD6, 0xE5, 0xFC, 0x5A, 0xD6, 0xF9, 0x5D, 0x96, 0xF5, 0x9D, 0x7F, 0x5A, 0xCA, 0x69,
+    0xEA, 0x5D, 0x96, 0xF6, 0xDA, 0x5F, 0xC6, 0xEA, 0xAA, 0xAF, 0xDA, 0x6A, 0xFF, 0xF7, 0x0F, 0xFF,
+    0x70, 0xAF, 0xEA, 0xDA, 0x71, 0x9E, 0xA9, 0x0E, 0x77, 0x0E, 0xA7, 0x7F, 0x70, 0xC9, 0x29, 0xAF,
+    0xA7, 0xAF, 0xFE, 0x70, 0xFF, 0xE7, 0x09, 0xFF, 0xD7, 0x39, 0xAF, 0xA9, 0x77, 0x77, 0x79, 0xD7,
+    0x7E, 0x77, 0xDA, 0x76, 0x9D, 0x77, 0xE7, 0x7D, 0xA7, 0x69, 0xD7, 0x7E, 0x77, 0xDA, 0x76, 0x9D,
+    0x09, 0xAF, 0x97, 0xEA, 0xFF, 0x6F, 0xFF, 0x94, 0x9F, 0xA9, 0x2E, 0x94, 0xF9, 0x49, 0xDA, 0x4E,
+    0xA6, 0xD9, 0x39, 0xE6, 0x9D, 0x93, 0xEA, 0x69, 0xD4, 0xE7, 0xE3, 0x9E, 0x7D, 0xA3, 0xEA, 0x69,
+    0xD9, 0x3E, 0x96, 0xE9, 0x2A, 0xE7, 0xE3, 0xF6, 0xAE, 0x3F, 0x6E, 0xA2, 0xAE, 0xA5, 0x9E, 0x92,
+    0x69, 0xD9, 0x6E, 0xA5, 0xAE, 0x95, 0xF9, 0x49, 0xF7, 0x77, 0x77, 0x71, 0x99, 0x70, 0xDA, 0x7D,
+    0x96, 0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD7, 0xAD, 0x7D, 0xA7, 0xD9, 0x6A, 0xD7, 0xE7, 0xE6, 0xAD,
+    0xA6, 0xE9, 0x6E, 0x95, 0x9E, 0x60, 0x76, 0x9E, 0x76, 0xF7, 0x59, 0xEA, 0x75, 0xFA, 0x75, 0xF9,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xD9, 0x76, 0x9D, 0x97, 0x6E, 0x77, 0xDA, 0x76, 0x9D, 0x97,
+    0x6A, 0xD7, 0x7D, 0xA7, 0x69, 0xD9, 0x76, 0xAD, 0x77, 0xDA, 0x77, 0xD9, 0x76, 0xAD, 0x77, 0xDA,
+    0x77, 0xD9, 0x76, 0xAD, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x6E, 0x75, 0x9E, 0xA7, 0x19, 0xAA, 0xFC,
+    0x72, 0xFE, 0x97, 0x1F, 0xDA, 0x77, 0x75, 0x77, 0x69, 0xD9, 0x73, 0xE7, 0x4E, 0x73, 0x9D, 0x97,
+    0x3E, 0x74, 0xE7, 0x39, 0xDA, 0x73, 0xAD, 0x74, 0xE2, 0xEA, 0x49, 0xDA, 0x1E, 0x95, 0xAD, 0x1E,
+    0x96, 0xE0, 0xE9, 0x69, 0xFD, 0x97, 0xAF, 0xC9, 0x70, 0xFC, 0xA7, 0x09, 0xFD, 0x97, 0xAD, 0xAF,
+    0x7E, 0x9A, 0xF6, 0xE1, 0xFA, 0x4A, 0xE1, 0xAF, 0x93, 0xEA, 0x2F, 0xC9, 0x2E, 0x92, 0xAF, 0xC1,
+    0xAE, 0x4F, 0xD0, 0x7A, 0x97, 0x9D, 0x96, 0xE6, 0x9D, 0xA6, 0xAD, 0x96, 0xE6, 0x9D, 0xA6, 0xAD,
+    0x96, 0xE6, 0x9D, 0xA6, 0xAD, 0x7E, 0x69, 0xDA, 0x6A, 0xD9, 0x6E, 0x69, 0xE6, 0xAD, 0xA6, 0xE7,
+    0xE6, 0x9D, 0xA6, 0xE9, 0x6F, 0xDA, 0x3F, 0xDA, 0x29, 0xFD, 0x92, 0x72, 0xAE, 0xA4, 0x9A, 0xE9,
+    0x7E, 0x9F, 0xE9, 0x1F, 0xE7, 0xFF, 0xF0, 0xFF, 0xA5, 0xAF, 0xA2, 0x9F, 0xD9, 0x2E, 0x5F, 0x94,
+    0xAF, 0x49, 0xD4, 0x9E, 0x95, 0xAE, 0x5A, 0xD4, 0xF6, 0xE9, 0x5D, 0xA4, 0xE9, 0x6E, 0x6D, 0xA3,
+    0xAE, 0x6A, 0xDA, 0x5A, 0xD9, 0x3E, 0x96, 0xE6, 0xE3, 0x9E, 0x6A, 0xDA, 0x59, 0xE3, 0xEA, 0x6E,
+    0x95, 0xAD, 0xA2, 0x9E, 0x95, 0x9E, 0x6E, 0x92, 0xAE, 0x6E, 0xA5, 0x9E, 0x3E, 0xA5, 0x9E, 0x6F,
+    0x29, 0xE6, 0xEA, 0x6E, 0xA2, 0x72, 0x99, 0x97, 0x09, 0xCA, 0x9A, 0xFC, 0xA6, 0xFF, 0xEA, 0x5F,
+    0xC9, 0x19, 0xE4, 0x9E, 0xA4, 0xAD, 0x4E, 0xA5, 0xAD, 0x4E, 0x6E, 0x39, 0xE6, 0xE3, 0xE9, 0x59,
+    0xE3, 0xE9, 0x5A, 0xDA, 0x29, 0xE6, 0xE9, 0x2F, 0x59, 0xE3, 0xEA, 0x5A, 0xE2, 0xAE, 0x95, 0xF2,
+    0xF6, 0xEA, 0x2F, 0x59, 0xE9, 0x1A, 0xEA, 0x5F, 0x91, 0x69, 0xAF, 0xA7, 0x1A, 0xFF, 0x95, 0x9F,
+    0xAA, 0xAF, 0x94, 0xE9, 0x49, 0xDA, 0x3E, 0x7E, 0x29, 0xD9, 0x7E, 0x2E, 0x70, 0xE1, 0x9D, 0x97,
+    0x0E, 0x1A, 0xD7, 0x0A, 0xD9, 0x1E, 0x70, 0xE2, 0xE9, 0x6E, 0xA2, 0xFA, 0x99, 0x99, 0xAF, 0x3A,
+    0xFF, 0xF5, 0xFF, 0xE9, 0x59, 0xFF, 0xA7, 0x1A, 0xFA, 0x96, 0x70, 0x93, 0x9A, 0xCA, 0x97, 0x3A,
+    0xD0, 0x9F, 0xE7, 0x2A, 0xDA, 0xFA, 0xAE, 0x71, 0xFC, 0xA4, 0xD9, 0x70, 0xFA, 0x5D, 0xA7, 0x9E,
+    0xA6, 0xAC, 0xA7, 0xAE, 0x7D, 0xA7, 0xEA, 0x7D, 0x97, 0xEA, 0x69, 0xD7, 0x9E, 0x96, 0xE7, 0xAF,
+    0x5A, 0xD9, 0x7F, 0xD9, 0x2A, 0xE7, 0xAF, 0xFF, 0xC7, 0x0F, 0xFF, 0xCA, 0x7A, 0xE9, 0xFF, 0xA7,
+    0x0E, 0x90, 0x9F, 0xD9, 0x70, 0x9E, 0x49, 0x97, 0x3E, 0xA7, 0x71, 0x9E, 0x77, 0x2E, 0xA7, 0x71,
+    0x9E, 0x77, 0x2F, 0x77, 0x19, 0xE9, 0x77, 0x77, 0x70, 0x77, 0x74, 0x9A, 0xA9, 0x29, 0x99, 0x69,
+    0xFE, 0x09, 0xE5, 0xAF, 0xAE, 0xAA, 0xD9, 0x4E, 0xA3, 0x9F, 0xC4, 0xAD, 0xA5, 0xFA, 0x39, 0xE6,
+    0xF9, 0x3A, 0xD7, 0xF4, 0xDA, 0x69, 0xEA, 0x39, 0xD7, 0xAE, 0x4A, 0xD7, 0xF4, 0xDA, 0x6A, 0xEA,
+    0x4E, 0x5A, 0xF5, 0xEA, 0x91, 0x9F, 0xD5, 0xAF, 0xFF, 0xA6, 0xFF, 0xF7, 0x0F, 0xEA, 0xAD, 0x71,
+    0xAE, 0xA9, 0x0D, 0xA7, 0x70, 0xD9, 0x77, 0xAD, 0x09, 0xAC, 0x97, 0x3F, 0xE7, 0x39, 0xFD, 0x97,
+    0x3A, 0xFA, 0x97, 0x4C, 0xA9, 0x77, 0x73, 0x77, 0x4D, 0x90, 0x9A, 0xD9, 0x49, 0xDA, 0xFC, 0x5F,
+    0xFC, 0x5F, 0xCA, 0x99, 0xA4, 0x9F, 0x71, 0xAE, 0x72, 0xEA, 0x71, 0x9E, 0x72, 0xAE, 0x72, 0xEA,
+    0x71, 0x9E, 0x97, 0x1F, 0x72, 0xF7, 0x1A, 0xF7, 0x1F, 0xA7, 0x09, 0xFA, 0x70, 0x79, 0xFC, 0xAA,
+    0x95, 0x9F, 0xFC, 0x59, 0xE9, 0x99, 0x09, 0x96, 0xD9, 0x74, 0x9D, 0x75, 0x9D, 0xA7, 0x5F, 0xA9,
+    0x72, 0x9F, 0xDA, 0x72, 0xAF, 0xD9, 0x73, 0x9F, 0x74, 0xAE, 0x49, 0xCA, 0x92, 0x9F, 0x39, 0xFF,
+    0xEA, 0x2A, 0xFF, 0xF3, 0xFF, 0xF5, 0x9A, 0xFD, 0xA9, 0x40, 0x77, 0x4A, 0xC7, 0x09, 0xDA, 0x70,
+    0xAD, 0x97, 0x0E, 0x70, 0x9D, 0xA5, 0xFF, 0xE0, 0xAF, 0xFE, 0x39, 0xE7, 0x0A, 0xD9, 0x70, 0xE7,
+    0x09, 0xE7, 0x0A, 0xDA, 0x70, 0xE9, 0x79, 0xE7, 0x0A, 0xDA, 0x70, 0xE9, 0x79, 0xE9, 0x7A, 0xFE,
+    0x93, 0xFF, 0x93, 0xFF, 0x93, 0xFF, 0x92, 0x29, 0xD9, 0x6A, 0xD9, 0x2A, 0xD7, 0xE3, 0xE7, 0xE3,
+    0xE6, 0x9D, 0xA2, 0x9D, 0xA6, 0xAD, 0x92, 0xAD, 0x96, 0xE3, 0xAD, 0x69, 0xE3, 0xE6, 0xAD, 0xA3,
+    0xDA, 0x6E, 0x92, 0x9D, 0xA5, 0xAE, 0x92, 0xAE, 0x4A, 0xF3, 0xAF, 0xFF, 0xC3, 0xAF, 0xFF, 0xA3,
+    0xAF, 0xFF, 0x93, 0x9F, 0xF9, 0xE5, 0x9F, 0xCA, 0x09, 0xE7, 0x75, 0x9D, 0x97, 0x2D, 0xA0, 0xDA,
+    0x71, 0xE1, 0xE7, 0x0A, 0xD2, 0xE9, 0x69, 0xD9, 0x2A, 0xDA, 0x6D, 0xA3, 0x9E, 0x5E, 0x5E, 0x4A,
+    0xD9, 0x5E, 0x92, 0x9D, 0xA6, 0xEA, 0x2E, 0x7A, 0xE1, 0xE7, 0x09, 0xE0, 0xAD, 0x97, 0x09, 0xEA,
+    0xDA, 0x71, 0x9F, 0xD7, 0x29, 0xFD, 0x72, 0x9F, 0xC9, 0x72, 0xAF, 0xC7, 0x10, 0x9E, 0x75, 0xAD,
+    0xA0, 0x9E, 0x75, 0xE1, 0x9E, 0x74, 0xEA, 0x19, 0xE7, 0x39, 0xE2, 0x9E, 0x49, 0x94, 0xEA, 0x29,
+    0xE3, 0xAD, 0x92, 0x9E, 0x39, 0xE2, 0xAF, 0x2E, 0xA3, 0x9E, 0x1A, 0xFC, 0x90, 0x9E, 0x49, 0xE0,
+    0xAF, 0xE0, 0xEA, 0x49, 0xEA, 0xFF, 0xAE, 0x59, 0xFF, 0xFE, 0x95, 0x9F, 0xEA, 0xFE, 0x69, 0xFD,
+    0x1F, 0xD9, 0x69, 0xFC, 0x2F, 0xD7, 0xAF, 0x92, 0xAF, 0x97, 0xAE, 0x93, 0x9F, 0x70, 0x6E, 0x95,
+    0xAD, 0xA7, 0xAE, 0x4A, 0xDA, 0x70, 0x9E, 0x92, 0xEA, 0x72, 0xEA, 0x1E, 0xA7, 0x39, 0xE9, 0xE9,
+    0x75, 0xFD, 0x97, 0x6A, 0xF9, 0x77, 0xAE, 0xA7, 0x79, 0xFC, 0x76, 0xAF, 0xD9, 0x74, 0xAE, 0x9F,
+    0x73, 0xAE, 0x90, 0xAE, 0x97, 0x1F, 0x91, 0x9F, 0x70, 0xF9, 0x3F, 0x7F, 0x94, 0xAE, 0xA5, 0xF7,
+    0xF4, 0x5D, 0xA7, 0x0E, 0x6E, 0x79, 0xD9, 0x6A, 0xD9, 0x6E, 0x7A, 0xDA, 0x5A, 0xD9, 0x79, 0xE5,
+    0xE7, 0x1E, 0x4E, 0x97, 0x1E, 0xA2, 0x9E, 0x72, 0xAE, 0x2E, 0x97, 0x29, 0xE1, 0xAE, 0x74, 0xEA,
+    0x0E, 0x97, 0x4F, 0xAE, 0x75, 0xAF, 0xD9, 0x75, 0x9F, 0xD7, 0x7F, 0xC9, 0x77, 0xFC, 0x77, 0x0F,
+    0x97, 0x79, 0xF7, 0x70, 0xF9, 0x76, 0x9F, 0xC7, 0x59, 0xFD, 0x73, 0xFF, 0xC7, 0x4F, 0xEA, 0x74,
+    0x9F, 0xD9, 0x75, 0xAD, 0xA9, 0x77, 0x00, 0x6F, 0xFF, 0x69, 0xFF, 0xF6, 0x9F, 0xFF, 0x76, 0xEA,
+    0x75, 0x9E, 0xA7, 0x5A, 0xE9, 0x74, 0x9F, 0x75, 0xAE, 0xA7, 0x5F, 0x97, 0x49, 0xF9, 0x74, 0xAF,
+    0x75, 0xFA, 0x75, 0xFC, 0xAA, 0xAA, 0xAA, 0xA6, 0xAF, 0xFF, 0x95, 0xFF, 0xFC, 0xA4, 0x9F, 0xFF,
+    0xD4, 0x71, 0xAF, 0xA7, 0x9F, 0xD7, 0x9E, 0xA7, 0x2E, 0xA7, 0x3E, 0x73, 0xAD, 0xA7, 0x3E, 0x97,
+    0x3E, 0x73, 0xAE, 0x73, 0xE9, 0x72, 0x9E, 0x72, 0x9E, 0x97, 0x0F, 0xC9, 0x70, 0x9E, 0x97, 0x2A,
+    0xF9, 0x73, 0x9E, 0x74, 0xE7, 0x39, 0xE7, 0x3A, 0xDA, 0x73, 0xE7, 0x39, 0xE7, 0x3A, 0xDA, 0x73,
+    0xE9, 0x73, 0xEA, 0x73, 0xFE, 0x70, 0xAF, 0xCA, 0x71, 0x9A, 0xE9, 0x70, 0x69, 0xC9, 0x6D, 0x7D,
+    0x69, 0xCA, 0x6A, 0xC9, 0x6D, 0x69, 0xCA, 0x6A, 0xC9, 0x6D, 0x7D, 0x6A, 0xCA, 0x6D, 0x7D, 0x69,
+    0xCA, 0x6A, 0xC9, 0x6D, 0x69, 0xCA, 0x6A, 0xC9, 0x6D, 0x7D, 0x6A, 0xCA, 0x6D, 0x7D, 0x69, 0xCA,
+    0x6A, 0xC9, 0x60, 0x7F, 0xC9, 0x70, 0x9F, 0xD9, 0x72, 0xAE, 0xA7, 0x3E, 0x97, 0x3E, 0x97, 0x29,
+    0xE7, 0x3A, 0xDA, 0x73, 0xE9, 0x73, 0xE7, 0x39, 0xE7, 0x3A, 0xE7, 0x3A, 0xE9, 0x72, 0x9F, 0xC7,
+    0x3A, 0xE7, 0x19, 0xFA, 0x70, 0xAD, 0xA7, 0x3E, 0x73, 0xAD, 0xA7, 0x3E, 0x73, 0x9E, 0x73, 0xAD,
+    0xA7, 0x3E, 0x97, 0x29, 0xE7, 0x29, 0xE9, 0x7F, 0xDA, 0x79, 0xFC, 0xA7, 0x0A, 0xEA, 0x72, 0x2A,
+    0xD9, 0x29, 0xC2, 0xAC, 0xAD, 0x2A, 0xC2, 0xCA, 0x1C, 0x91, 0xCA, 0x1A, 0xC9, 0x1A, 0xCA, 0xD2,
+    0xD3, 0xE9, 0x76, 0x3F, 0xD4, 0xFC, 0xA4, 0xFC, 0x5F, 0xC5, 0xF9, 0x5F, 0x77, 0x74, 0xAA, 0xCA,
+    0x59, 0xE9, 0x5A, 0xE6, 0xAE, 0x6E, 0xA6, 0xE9, 0x59, 0xE6, 0x9E, 0x6A, 0xDA, 0x6E, 0x96, 0xE7,
+    0xE6, 0x9D, 0xA6, 0xAD, 0x96, 0xE7, 0xE7, 0xDA, 0x69, 0xD9, 0x69, 0xD7, 0xAD, 0x79, 0xAA, 0x70,
+    0x73, 0x97, 0x4D, 0x97, 0x3D, 0x73, 0x9C, 0xA7, 0x3A, 0xC9, 0x73, 0xD7, 0x19, 0xAF, 0xC5, 0x9F,
+    0xF4, 0xAF, 0xD9, 0x99, 0x39, 0xE9, 0x0D, 0x6E, 0x1A, 0xC9, 0x5A, 0xDA, 0x1D, 0x6E, 0x2D, 0x59,
+    0xDA, 0x19, 0xCA, 0x5A, 0xD9, 0x1D, 0x6E, 0x91, 0xD6, 0xE9, 0x09, 0xCA, 0x6F, 0x0D, 0x96, 0xFE,
+    0xAA, 0xA4, 0x9F, 0xFC, 0x94, 0xAF, 0xFC, 0x6A, 0xFD, 0x97, 0xD7, 0x3A, 0xC9, 0x73, 0xAC, 0x70,
+    0x77, 0x77, 0x49, 0x99, 0x97, 0x79, 0xFE, 0xA7, 0x39, 0xFF, 0xE7, 0x1A, 0xFA, 0x92, 0x9E, 0x70,
+    0xEA, 0x7A, 0x71, 0xDA, 0x77, 0x29, 0xD7, 0x73, 0x9D, 0x77, 0x39, 0xD7, 0x73, 0x9D, 0x77, 0x39,
+    0xD7, 0x74, 0xD7, 0x74, 0xD9, 0x77, 0x3D, 0x97, 0x70, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xA7, 0x09,
+    0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0x74, 0x9E, 0x77, 0x2A, 0xDA, 0x77, 0x19, 0xE9, 0x77, 0x0A, 0xEA,
+    0x77, 0xAF, 0xA7, 0x6F, 0xCA, 0x97, 0x7F, 0xFF, 0xAA, 0x96, 0x9F, 0xFF, 0xF5, 0xAF, 0xFF, 0xFA,
+    0x40, 0x77, 0x69, 0xCA, 0x59, 0xD4, 0xAE, 0xAE, 0xAA, 0xE9, 0x39, 0xFF, 0xEA, 0x5A, 0xE9, 0x1E,
+    0xA6, 0xDA, 0x4D, 0x95, 0xE5, 0xD9, 0x5D, 0xA4, 0xAD, 0x94, 0x9D, 0xA3, 0x9E, 0x59, 0xE9, 0x1A,
+    0xEA, 0x5A, 0xFF, 0xD9, 0x4F, 0xFF, 0xC3, 0xFA, 0xFF, 0xC9, 0x29, 0xD2, 0x99, 0x91, 0xD9, 0x4A,
+    0x70, 0x99, 0x30, 0x39, 0x99, 0x73, 0x99, 0x4A, 0xDA, 0x70, 0x9E, 0x5E, 0x96, 0xAD, 0xA6, 0xAE,
+    0x5A, 0xDA, 0x79, 0xEA, 0x3E, 0xA7, 0x1F, 0x90, 0x9E, 0xA7, 0x29, 0xF9, 0xEA, 0x74, 0xFE, 0xA7,
+    0x59, 0xFC, 0xA7, 0x7F, 0xA7, 0x70, 0xAE, 0x77, 0x1F, 0xE9, 0x70, 0x9F, 0xFE, 0x97, 0x0F, 0xF9,
+    0x97, 0x7F, 0x77, 0x1E, 0xA7, 0x70, 0xAE, 0x97, 0x70, 0xF1, 0x97, 0x2F, 0xFE, 0xA7, 0x0F, 0xFF,
+    0xA7, 0x4F, 0x77, 0x1F, 0x77, 0x09, 0xEA, 0x77, 0x0A, 0xE7, 0x50, 0x69, 0xC9, 0x6D, 0x7D, 0x69,
+    0xCA, 0x6A, 0xC9, 0x6D, 0x69, 0xCA, 0x6A, 0xC9, 0x6D, 0x77, 0x77, 0x77, 0x7A, 0xC9, 0x6D, 0x69,
+    0xCA, 0x6A, 0xC9, 0x6D, 0x7D, 0x6A, 0xCA, 0x6D, 0x7D, 0x69, 0xCA, 0x6A, 0xC9, 0x60, 0x75, 0xAF,
+    0xA7, 0x69, 0xFF, 0x74, 0x9D, 0x94, 0xD7, 0x3D, 0x69, 0x97, 0x29, 0xC9, 0x77, 0x3A, 0xC9, 0x77,
+    0x3A, 0xDA, 0x97, 0x7A, 0xFF, 0xA9, 0x71, 0x9F, 0xFF, 0xA7, 0x0E, 0xA9, 0x39, 0xAE, 0x7A, 0xD7,
+    0x09, 0xDA, 0x6D, 0x97, 0x1D, 0xA6, 0xD9, 0x70, 0x9D, 0x96, 0xEA, 0x99, 0x5E, 0x7A, 0xFD, 0xAA,
+    0xAA, 0xEA, 0x70, 0x9F, 0xFF, 0x74, 0x9A, 0xFD, 0xA7, 0x70, 0xF7, 0x72, 0xF9, 0x77, 0x0F, 0xC7,
+    0x09, 0xFF, 0xF9, 0x79, 0xFF, 0xFA, 0x70, 0xFF, 0xF9, 0x71, 0x9A, 0xFD, 0xAA, 0x97, 0x77, 0x71,
+    0x1A, 0xD9, 0x3A, 0xD9, 0x1E, 0x93, 0xE9, 0x0A, 0xE9, 0x2A, 0xE1, 0xF3, 0xF0, 0xAF, 0x2A, 0xF0,
+    0x4A, 0xEA, 0x59, 0xCA, 0x29, 0xC3, 0x9C, 0xAD, 0x3A, 0x2D, 0xA5, 0xC1, 0xAA, 0xC6, 0xC1, 0xCA,
+    0xA6, 0xC1, 0xCA, 0xC5, 0xA9, 0x1C, 0x9E, 0x91, 0x9C, 0x2A, 0x90, 0x99, 0x19, 0xC4, 0xC9, 0x19,
+    0xAC, 0x95, 0xAD, 0xA9, 0x40, 0x75, 0xAD, 0x9C, 0x3D, 0x99, 0xD2, 0xCA, 0x2A, 0xC1, 0x9C, 0x3D,
+    0x1A, 0xA3, 0xCA, 0x1C, 0x92, 0xAC, 0x91, 0xCA, 0x99, 0xAD, 0x91, 0xFE, 0x3E, 0xA9, 0xC1, 0x79,
+    0x97, 0x96, 0xAC, 0x7C, 0xA5, 0xE5, 0xAD, 0x4A, 0xDA, 0x5E, 0x93, 0xE9, 0x49, 0xDA, 0x39, 0xDA,
+    0x5E, 0x93, 0x9D, 0xA5, 0xE5, 0xAE, 0x49, 0xE9, 0x5F, 0x4F, 0x94, 0x9F, 0x4F, 0x5A, 0xE9, 0x39,
+    0xEA, 0x5A, 0xD5, 0xAD, 0x96, 0xC9, 0x6A, 0xC7, 0x71, 0x93, 0x0E, 0xAA, 0xA9, 0x99, 0x39, 0xFF,
+    0xF9, 0x9A, 0xAF, 0xFD, 0x97, 0x1E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0x99,
+    0x91, 0x0F, 0xFF, 0xC9, 0xFF, 0xF9, 0xAF, 0xFF, 0x00, 0x49, 0xAD, 0xA6, 0xCA, 0x3C, 0x93, 0xFA,
+    0x2C, 0x2C, 0x9A, 0x1C, 0x2A, 0x19, 0xA9, 0x90, 0x9A, 0x2A, 0x1C, 0x0A, 0xE3, 0xC1, 0xC0, 0xC9,
+    0x9C, 0x29, 0xC1, 0xC9, 0xC1, 0xC2, 0xC9, 0x1A, 0xD0, 0x9C, 0x1C, 0xA3, 0xCA, 0x19, 0xAC, 0x95,
+    0xAE, 0xA4, 0x73, 0xAF, 0xFA, 0x0A, 0xAA, 0xAA, 0xAA, 0x99, 0x90, 0x77, 0x39, 0xAF, 0x7F, 0xF9,
+    0x4E, 0xA2, 0xE3, 0xE9, 0x4D, 0x91, 0x9D, 0x95, 0xDA, 0x1E, 0x6D, 0x91, 0xE5, 0xAD, 0x19, 0xE4,
+    0x9D, 0xA2, 0xEA, 0x2A, 0xE3, 0xAF, 0xFC, 0x94, 0xFF, 0x96, 0xFC, 0xA7, 0x74, 0x72, 0x99, 0x75,
+    0x9D, 0x75, 0xDA, 0x75, 0xD9, 0x74, 0x9D, 0x7A, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0x92, 0xFF, 0xFC,
+    0x97, 0xAD, 0x75, 0xDA, 0x75, 0xD9, 0x74, 0xAD, 0x75, 0x99, 0x97, 0x77, 0x77, 0x29, 0x99, 0xAA,
+    0xAA, 0xAE, 0x4F, 0xFF, 0x39, 0x99, 0x99, 0x97, 0x20, 0x74, 0xAE, 0xA4, 0xA9, 0x1C, 0xA7, 0xAA,
+    0x7C, 0x96, 0xD5, 0x9D, 0x5A, 0xD4, 0x9D, 0xA5, 0xFD, 0x29, 0xFD, 0x20, 0x3A, 0xE9, 0x70, 0xC7,
+    0x0C, 0x7A, 0xA4, 0xE9, 0x7A, 0xC7, 0x0C, 0x96, 0x9C, 0x39, 0x19, 0xD2, 0xFD, 0x3A, 0xEA, 0x30,
+    0x39, 0xA9, 0x29, 0xD3, 0xD9, 0x2D, 0xA2, 0xAD, 0x29, 0xD9, 0x20, 0x59, 0xD9, 0x6A, 0xD9, 0x5A,
+    0xD7, 0xE6, 0xE7, 0xE6, 0xE6, 0x9D, 0xA5, 0x9D, 0xA6, 0xAD, 0x95, 0xE9, 0x6E, 0x6E, 0x69, 0xE5,
+    0xAE, 0x6A, 0xDA, 0x5E, 0xA6, 0xE9, 0x49, 0xEA, 0x5A, 0xE9, 0x4F, 0xC4, 0xAF, 0x5F, 0xFF, 0xE4,
+    0xAF, 0xFF, 0xDA, 0x4D, 0xAF, 0xFF, 0x93, 0x9C, 0xA9, 0xFF, 0x9E, 0x4D, 0x19, 0xFC, 0xA0, 0x9E,
+    0x4D, 0x77, 0x1A, 0xC9, 0x77, 0x1A, 0xA7, 0x72, 0x72, 0x99, 0x92, 0x99, 0x70, 0x9F, 0x92, 0xD9,
+    0x6A, 0xFC, 0x3D, 0x6A, 0xFD, 0x29, 0xD6, 0xFD, 0x92, 0xAC, 0xA5, 0xAF, 0xD3, 0xD9, 0x5A, 0xFD,
+    0x3D, 0x6A, 0xFC, 0x92, 0x9D, 0x6A, 0xFC, 0x3A, 0xCA, 0x7F, 0xC3, 0xD9, 0x70, 0xE9, 0x3D, 0x70,
+    0xAE, 0x39, 0xD7, 0x0F, 0x3A, 0xCA, 0x79, 0xE9, 0x3D, 0x97, 0xF4, 0xD7, 0x9F, 0x39, 0xD7, 0xF9,
+    0x3A, 0xCA, 0x69, 0xF4, 0xD9, 0x6F, 0xA4, 0xD7, 0xF9, 0x39, 0xD6, 0xAF, 0x4A, 0xCA, 0x6F, 0xA4,
+    0xD9, 0x5A, 0xF9, 0x4D, 0x6F, 0xC4, 0x9D, 0x50, 0x1A, 0xDA, 0x1E, 0xA0, 0x9E, 0x90, 0xF9, 0x9F,
+    0x00, 0x29, 0x95, 0xC5, 0xA6, 0xEA, 0x6C, 0x95, 0xC9, 0x1A, 0xAD, 0xA1, 0xAE, 0xA2, 0x49, 0x94,
+    0xE3, 0x99, 0xCA, 0x5C, 0x94, 0x9C, 0x5C, 0xA5, 0xC9, 0x49, 0xC5, 0xD3, 0xFD, 0x09, 0xFC, 0xA0,
+    0x74, 0x9F, 0x92, 0xAC, 0x91, 0xAC, 0x19, 0xC4, 0xC1, 0xAC, 0x39, 0xC1, 0xCA, 0x3C, 0xA1, 0xD9,
+    0x99, 0xAC, 0x91, 0xAF, 0xC9, 0x3A, 0xDA, 0x30, 0x09, 0x79, 0x71, 0xCA, 0x69, 0xC9, 0x7A, 0xD9,
+    0x5D, 0xA7, 0x9D, 0xA5, 0xE9, 0x7E, 0x94, 0xAD, 0xA7, 0xAD, 0xA5, 0xE7, 0x9D, 0xA5, 0xE6, 0xF4,
+    0xAE, 0x94, 0xAE, 0xA3, 0x9E, 0xA4, 0x9E, 0xA4, 0xF5, 0xF4, 0xAE, 0x6A, 0xD5, 0x9D, 0x97, 0xC9,
+    0x6C, 0xA7, 0x09, 0x75, 0x77, 0x74, 0x9D, 0xA7, 0x72, 0xAE, 0x97, 0x72, 0xA0, 0xAC, 0x77, 0x5D,
+    0x73, 0x9C, 0xA5, 0x9C, 0xA7, 0x3D, 0x6A, 0xC9, 0x72, 0xD7, 0xD7, 0x2D, 0x70, 0xD7, 0x1A, 0xC9,
+    0x7A, 0xCA, 0x70, 0xAC, 0x97, 0x0D, 0x97, 0xAC, 0xA7, 0x1D, 0x79, 0xD7, 0xAA, 0xEA, 0xAA, 0x39,
+    0xD7, 0x9F, 0xEA, 0x3D, 0x70, 0xAF, 0xE9, 0x2D, 0x94, 0xC9, 0x74, 0xDA, 0x4D, 0x74, 0xAC, 0xA4,
+    0xE7, 0x3A, 0xD4, 0xDA, 0xC7, 0x2A, 0xD4, 0xD0, 0xCA, 0x71, 0x9D, 0x4D, 0x09, 0xC9, 0x70, 0x9D,
+    0x93, 0xD1, 0xAC, 0x97, 0x0D, 0xA3, 0xD2, 0xD7, 0x0D, 0xA3, 0xFF, 0xD5, 0xE4, 0xFF, 0xCA, 0x4E,
+    0x72, 0xDA, 0x5A, 0xD7, 0x29, 0xD9, 0x4A, 0xD9, 0x72, 0xAD, 0x59, 0x99, 0x73, 0xE4, 0x49, 0xAD,
+    0x77, 0x3A, 0xEA, 0x77, 0x3A, 0x9A, 0xC7, 0x76, 0xD7, 0x39, 0xCA, 0x7C, 0xA7, 0x29, 0xCA, 0x7A,
+    0xC9, 0x72, 0xD7, 0x0D, 0x72, 0xD7, 0x1D, 0x71, 0xD7, 0x1A, 0xCA, 0x70, 0xAC, 0x97, 0x1D, 0x97,
+    0xAC, 0xA7, 0x2D, 0x7A, 0xCA, 0x70, 0xAA, 0xEA, 0xAA, 0x39, 0xD1, 0x9A, 0xA9, 0x29, 0xFE, 0xA2,
+    0x9D, 0x9F, 0xE1, 0xAF, 0xE9, 0x2D, 0x09, 0xC9, 0x2A, 0xD7, 0x3D, 0x97, 0xD7, 0x2D, 0xA7, 0x0D,
+    0x71, 0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAD, 0x70, 0x9D, 0x70, 0xAD, 0x70, 0x9D, 0x97, 0x9D, 0x70,
+    0xAD, 0xA7, 0x9D, 0x96, 0xAE, 0x97, 0x0D, 0xA5, 0x9F, 0x97, 0x0D, 0xA5, 0x9F, 0x71, 0xE6, 0xFF,
+    0xC4, 0xE6, 0x9F, 0xFA, 0x3A, 0xD7, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x73, 0x39, 0xAE, 0xA9,
+    0x77, 0x1C, 0xA9, 0x99, 0xAC, 0x97, 0x76, 0xAA, 0x77, 0x6A, 0xA7, 0x1C, 0xA7, 0x2C, 0x97, 0x0D,
+    0x71, 0x9D, 0x70, 0xD6, 0xAF, 0x97, 0x0D, 0x7A, 0xAA, 0xD9, 0x7A, 0xC9, 0x73, 0xD9, 0x5A, 0xCA,
+    0x74, 0xAC, 0x94, 0x9C, 0xA7, 0x5D, 0x49, 0xD7, 0x49, 0xE3, 0x9D, 0x70, 0xFF, 0x4D, 0x70, 0xAF,
+    0xE9, 0x3D, 0x94, 0xC9, 0x19, 0xAA, 0xDA, 0x94, 0xDA, 0x4D, 0x75, 0xAC, 0xA4, 0xE7, 0x4A, 0xD4,
+    0xDA, 0xC7, 0x3A, 0xD4, 0xD0, 0xCA, 0x72, 0x9D, 0x4D, 0x09, 0xC9, 0x71, 0x9D, 0x93, 0xD1, 0xAC,
+    0x97, 0x1D, 0xA3, 0xD2, 0xD7, 0x1D, 0xA3, 0xFF, 0xD6, 0xE4, 0xFF, 0xCA, 0x5A, 0xD7, 0x2D, 0xA6,
+    0xAD, 0x72, 0x9D, 0x95, 0xAD, 0x97, 0x2A, 0xD6, 0x99, 0x97, 0x3E, 0x40, 0x74, 0xAF, 0x75, 0xF9,
+    0x75, 0xF7, 0x6E, 0xA7, 0x6E, 0x77, 0x77, 0x77, 0x69, 0x97, 0x59, 0xEA, 0x75, 0xF7, 0x6F, 0x75,
+    0x9E, 0xA7, 0x5A, 0xE9, 0x74, 0x9F, 0x74, 0xAF, 0xC7, 0x3F, 0xCA, 0x73, 0xFA, 0x74, 0xF7, 0x5E,
+    0xA7, 0x5E, 0xA7, 0x59, 0xE7, 0x6E, 0x97, 0x59, 0xE7, 0x6A, 0xDA, 0x76, 0xE9, 0x76, 0xE9, 0x76,
+    0xEA, 0x7A, 0x5A, 0xEA, 0x49, 0xDA, 0x5F, 0xCA, 0xAA, 0xF6, 0x9F, 0xFC, 0xA7, 0x19, 0xAF, 0xA7,
+    0x77, 0x20, 0x76, 0xDA, 0x77, 0x39, 0xDA, 0x77, 0x3A, 0xE7, 0x73, 0xF7, 0x75, 0x99, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x5E, 0xA7, 0x71, 0xAE, 0xA7, 0x71, 0xFC, 0x77, 0x0F, 0xD7, 0x79, 0xDA, 0xE7,
+    0x7E, 0x0E, 0x76, 0xE9, 0x0E, 0x97, 0x49, 0xE1, 0xE9, 0x74, 0xE2, 0xE9, 0x73, 0xAD, 0xA2, 0xAD,
+    0xA7, 0x29, 0xE3, 0xAD, 0xA7, 0x2E, 0x93, 0xAE, 0x71, 0xAE, 0x4A, 0xE7, 0x09, 0xE5, 0x9E, 0x70,
+    0xEA, 0x59, 0xE7, 0xAE, 0x69, 0xE9, 0x6E, 0x97, 0xE9, 0x5F, 0xFF, 0xFA, 0x4A, 0xFF, 0xFF, 0xA4,
+    0xFF, 0xFF, 0xCA, 0x3F, 0xFF, 0xFE, 0x29, 0xEA, 0x72, 0xF2, 0xF7, 0x3F, 0x1A, 0xEA, 0x73, 0xF0,
+    0x9F, 0x73, 0x9F, 0x90, 0x77, 0x5A, 0xC9, 0x77, 0x49, 0xCA, 0x77, 0x49, 0xD7, 0x75, 0xD9, 0x77,
+    0x4E, 0x77, 0x49, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x71, 0xEA, 0x77, 0x3A, 0xEA, 0x77, 0x3F, 0xC7, 0x72, 0xFD, 0x77, 0x19, 0xDA, 0xE7, 0x71, 0xE0,
+    0xE7, 0x70, 0xE9, 0x0E, 0x97, 0x69, 0xE1, 0xE9, 0x76, 0xE2, 0xE9, 0x75, 0xAD, 0xA2, 0xAD, 0xA7,
+    0x49, 0xE3, 0xAD, 0xA7, 0x4E, 0x93, 0xAE, 0x73, 0xAE, 0x4A, 0xE7, 0x29, 0xE5, 0x9E, 0x72, 0xEA,
+    0x59, 0xE7, 0x1A, 0xE6, 0x9E, 0x97, 0x0E, 0x97, 0xE9, 0x7F, 0xFF, 0xFA, 0x6A, 0xFF, 0xFF, 0xA6,
+    0xFF, 0xFF, 0xCA, 0x5F, 0xFF, 0xFE, 0x49, 0xEA, 0x72, 0xF4, 0xF7, 0x3F, 0x3A, 0xEA, 0x73, 0xF2,
+    0x9F, 0x73, 0x9F, 0x91, 0x77, 0xAC, 0x97, 0x75, 0xE9, 0x77, 0x3A, 0xF9, 0x77, 0x19, 0xD1, 0xAC,
+    0xA7, 0x70, 0xD3, 0x9D, 0x76, 0xAA, 0x69, 0xA7, 0x77, 0x77, 0x1E, 0xA7, 0x73, 0xAE, 0xA7, 0x73,
+    0xFC, 0x77, 0x2F, 0xD7, 0x71, 0x9D, 0xAE, 0x77, 0x1E, 0x0E, 0x77, 0x0E, 0x90, 0xE9, 0x76, 0x9E,
+    0x1E, 0x97, 0x6E, 0x2E, 0x97, 0x5A, 0xDA, 0x2A, 0xDA, 0x74, 0x9E, 0x3A, 0xDA, 0x74, 0xE9, 0x3A,
+    0xE7, 0x3A, 0xE4, 0xAE, 0x72, 0x9E, 0x59, 0xE7, 0x2E, 0xA5, 0x9E, 0x71, 0xAE, 0x69, 0xE9, 0x70,
+    0xE9, 0x7E, 0x97, 0xFF, 0xFF, 0xA6, 0xAF, 0xFF, 0xFA, 0x6F, 0xFF, 0xFC, 0xA5, 0xFF, 0xFF, 0xE4,
+    0x9E, 0xA7, 0x2F, 0x4F, 0x73, 0xF3, 0xAE, 0xA7, 0x3F, 0x29, 0xF7, 0x39, 0xF9, 0x10, 0x77, 0xAD,
+    0x3A, 0xC7, 0x7D, 0xAD, 0x2D, 0x76, 0x9C, 0xA1, 0xC9, 0x09, 0xC9, 0x76, 0xAC, 0x2A, 0xCA, 0xD7,
+    0x7D, 0x3E, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7E, 0xA7, 0x74, 0xAE, 0xA7, 0x74, 0xFC, 0x77,
+    0x3F, 0xD7, 0x72, 0x9D, 0xAE, 0x77, 0x2E, 0x0E, 0x77, 0x1E, 0x90, 0xE9, 0x77, 0x9E, 0x1E, 0x97,
+    0x7E, 0x2E, 0x97, 0x6A, 0xDA, 0x2A, 0xDA, 0x75, 0x9E, 0x3A, 0xDA, 0x75, 0xE9, 0x3A, 0xE7, 0x4A,
+    0xE4, 0xAE, 0x73, 0x9E, 0x59, 0xE7, 0x3E, 0xA5, 0x9E, 0x72, 0xAE, 0x69, 0xE9, 0x71, 0xE9, 0x7E,
+    0x97, 0x0F, 0xFF, 0xFA, 0x7A, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0xCA, 0x6F, 0xFF, 0xFE, 0x59, 0xEA,
+    0x72, 0xF5, 0xF7, 0x3F, 0x4A, 0xEA, 0x73, 0xF3, 0x9F, 0x73, 0x9F, 0x92, 0x76, 0xE3, 0x9E, 0x76,
+    0xAE, 0x3F, 0x76, 0xF2, 0x9E, 0xA7, 0x5A, 0xEA, 0x2A, 0xEA, 0x75, 0xF9, 0x2F, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x71, 0xEA, 0x77, 0x5A, 0xEA, 0x77, 0x5F, 0xC7, 0x74, 0xFD, 0x77, 0x39, 0xDA,
+    0xE7, 0x73, 0xE0, 0xE7, 0x72, 0xE9, 0x0E, 0x97, 0x70, 0x9E, 0x1E, 0x97, 0x70, 0xE2, 0xE9, 0x77,
+    0xAD, 0xA2, 0xAD, 0xA7, 0x69, 0xE3, 0xAD, 0xA7, 0x6E, 0x93, 0xAE, 0x75, 0xAE, 0x4A, 0xE7, 0x49,
+    0xE5, 0x9E, 0x74, 0xEA, 0x59, 0xE7, 0x3A, 0xE6, 0x9E, 0x97, 0x2E, 0x97, 0xE9, 0x71, 0xFF, 0xFF,
+    0xA7, 0x0A, 0xFF, 0xFF, 0xA7, 0x0F, 0xFF, 0xFC, 0xA7, 0xFF, 0xFF, 0xE6, 0x9E, 0xA7, 0x2F, 0x6F,
+    0x73, 0xF5, 0xAE, 0xA7, 0x3F, 0x49, 0xF7, 0x39, 0xF9, 0x30, 0x77, 0x2A, 0xD7, 0x73, 0xC9, 0x09,
+    0xC7, 0x71, 0xC9, 0x2C, 0x77, 0x1C, 0x91, 0xCA, 0x77, 0x1A, 0xF7, 0x73, 0xAC, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x72, 0xEA, 0x77, 0x2A, 0xEA, 0x77, 0x2F, 0xC7, 0x71, 0xFD, 0x77, 0x09,
+    0xDA, 0xE7, 0x70, 0xE0, 0xE7, 0x7E, 0x90, 0xE9, 0x75, 0x9E, 0x1E, 0x97, 0x5E, 0x2E, 0x97, 0x4A,
+    0xDA, 0x2A, 0xDA, 0x73, 0x9E, 0x3A, 0xDA, 0x73, 0xE9, 0x3A, 0xE7, 0x2A, 0xE4, 0xAE, 0x71, 0x9E,
+    0x59, 0xE7, 0x1E, 0xA5, 0x9E, 0x70, 0xAE, 0x69, 0xE9, 0x7E, 0x97, 0xE9, 0x6F, 0xFF, 0xFA, 0x5A,
+    0xFF, 0xFF, 0xA5, 0xFF, 0xFF, 0xCA, 0x4F, 0xFF, 0xFE, 0x39, 0xEA, 0x72, 0xF3, 0xF7, 0x3F, 0x2A,
+    0xEA, 0x73, 0xF1, 0x9F, 0x73, 0x9F, 0x90, 0x77, 0x77, 0x09, 0x99, 0x97, 0x73, 0x9F, 0xFF, 0xFC,
+    0x77, 0x3F, 0xFF, 0xFD, 0x77, 0x2F, 0xFF, 0xFC, 0xA9, 0x77, 0x1F, 0xF9, 0x77, 0x73, 0xAD, 0xAF,
+    0xC7, 0x77, 0x39, 0xDA, 0x9F, 0xA7, 0x77, 0x29, 0xE0, 0x9F, 0x97, 0x77, 0x2E, 0x19, 0xF7, 0x77,
+    0x2E, 0x91, 0x9E, 0xA7, 0x77, 0x1E, 0x92, 0xAE, 0xA9, 0x99, 0x99, 0xAA, 0x97, 0x70, 0xAD, 0xA3,
+    0xAF, 0xFE, 0x77, 0x09, 0xE4, 0xAF, 0xFE, 0x77, 0x9E, 0x5F, 0xFE, 0xA7, 0x7E, 0x95, 0xF7, 0x76,
+    0xEA, 0x59, 0xEA, 0x77, 0x5A, 0xDA, 0x6F, 0xA7, 0x74, 0xAF, 0xAA, 0xAA, 0xAA, 0xAF, 0xA7, 0x73,
+    0x9F, 0xFF, 0xFA, 0x77, 0x3F, 0xFF, 0xFC, 0xA7, 0x72, 0xFF, 0xFF, 0xFF, 0xF7, 0x0F, 0x70, 0x9F,
+    0xFF, 0xDA, 0x7A, 0xE9, 0x70, 0xAF, 0xFF, 0xDA, 0x69, 0xF7, 0x1F, 0xFF, 0xEA, 0x59, 0xF7, 0x2F,
+    0xFF, 0xEA, 0x77, 0x77, 0x73, 0x77, 0x77, 0x70, 0x9A, 0xFC, 0xA9, 0x74, 0x9F, 0xFD, 0xA7, 0x29,
+    0xFF, 0xF7, 0x2A, 0xFC, 0xA9, 0x99, 0x99, 0xAA, 0x71, 0xFC, 0xA7, 0x71, 0xFC, 0x77, 0x2F, 0xC7,
+    0x72, 0xAE, 0xA7, 0x72, 0x9F, 0x77, 0x3F, 0x77, 0x39, 0xEA, 0x77, 0x3F, 0x77, 0x39, 0xEA, 0x77,
+    0x3A, 0xE9, 0x77, 0x3F, 0x97, 0x73, 0xFA, 0x77, 0x29, 0xFC, 0x77, 0x29, 0xFD, 0x71, 0x96, 0x9F,
+    0xFA, 0x99, 0x99, 0xAE, 0x69, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0x97, 0xAF, 0xFF, 0xE7, 0x1F, 0xFF,
+    0xE7, 0x19, 0xFF, 0xFC, 0xA7, 0x39, 0xAF, 0xFA, 0xA7, 0x71, 0xC7, 0x76, 0xA7, 0x77, 0xEA, 0x77,
+    0x7C, 0x97, 0x76, 0xC9, 0x77, 0x2A, 0xAD, 0xA7, 0x72, 0xAE, 0xA7, 0x30, 0x73, 0xDA, 0x77, 0x39,
+    0xE7, 0x73, 0xAE, 0x77, 0x3F, 0x77, 0x59, 0x97, 0x77, 0x77, 0x77, 0x73, 0x99, 0x99, 0x7A, 0xFF,
+    0xFD, 0x7F, 0xFF, 0xD9, 0x7F, 0xFF, 0xCA, 0x79, 0xE9, 0x77, 0x1E, 0x97, 0x72, 0xE7, 0x72, 0x9E,
+    0x77, 0x2A, 0xDA, 0x77, 0x2E, 0x97, 0x71, 0x9E, 0x99, 0x99, 0x9A, 0xAA, 0x72, 0xAF, 0xFE, 0x72,
+    0xFF, 0xEA, 0x72, 0xFF, 0xE9, 0x71, 0x9E, 0x97, 0x71, 0xEA, 0x77, 0x2E, 0x97, 0x71, 0x9E, 0x77,
+    0x2A, 0xE7, 0x72, 0xEA, 0x77, 0x19, 0xFF, 0xFD, 0x96, 0xAF, 0xFF, 0xD9, 0x6F, 0xFF, 0xE9, 0x6F,
+    0xFF, 0xE9, 0x5A, 0xFF, 0xFE, 0x60, 0x77, 0x29, 0xA9, 0x77, 0x3D, 0x77, 0x3D, 0x97, 0x72, 0xAC,
+    0xA7, 0x72, 0x9D, 0x77, 0x3D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x75, 0x99, 0x99, 0x97, 0xAF, 0xFF, 0xD7, 0xFF, 0xFD, 0x97, 0xFF, 0xFC, 0xA7, 0x9E, 0x97, 0x71,
+    0xE9, 0x77, 0x2E, 0x77, 0x29, 0xE7, 0x72, 0xAD, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE9, 0x99, 0x99,
+    0xAA, 0xA7, 0x2A, 0xFF, 0xE7, 0x2F, 0xFE, 0xA7, 0x2F, 0xFE, 0x97, 0x19, 0xE9, 0x77, 0x1E, 0xA7,
+    0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9F, 0xFF, 0xD9, 0x6A, 0xFF,
+    0xFD, 0x96, 0xFF, 0xFE, 0x96, 0xFF, 0xFE, 0x95, 0xAF, 0xFF, 0xE6, 0x74, 0x9A, 0x97, 0x73, 0xE7,
+    0x72, 0x9F, 0x97, 0x70, 0xDA, 0x9D, 0x97, 0x6D, 0x92, 0xAC, 0xA7, 0x4A, 0xC9, 0x5A, 0xC7, 0x77,
+    0x77, 0x09, 0x99, 0x99, 0x97, 0xAF, 0xFF, 0xD7, 0xFF, 0xFD, 0x97, 0xFF, 0xFC, 0xA7, 0x9E, 0x97,
+    0x71, 0xE9, 0x77, 0x2E, 0x77, 0x29, 0xE7, 0x72, 0xAD, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE9, 0x99,
+    0x99, 0xAA, 0xA7, 0x2A, 0xFF, 0xE7, 0x2F, 0xFE, 0xA7, 0x2F, 0xFE, 0x97, 0x19, 0xE9, 0x77, 0x1E,
+    0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9F, 0xFF, 0xD9, 0x6A,
+    0xFF, 0xFD, 0x96, 0xFF, 0xFE, 0x96, 0xFF, 0xFE, 0x95, 0xAF, 0xFF, 0xE6, 0x73, 0xE4, 0xE7, 0x39,
+    0xE3, 0xAE, 0x73, 0xF3, 0xF7, 0x29, 0xF2, 0xAE, 0xA7, 0x2F, 0xA2, 0xFA, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x71, 0x99, 0x99, 0x97, 0x0A, 0xFF, 0xFD, 0x70, 0xFF, 0xFD, 0x97, 0x0F, 0xFF, 0xCA, 0x70,
+    0x9E, 0x97, 0x72, 0xE9, 0x77, 0x3E, 0x77, 0x39, 0xE7, 0x73, 0xAD, 0xA7, 0x73, 0xE9, 0x77, 0x29,
+    0xE9, 0x99, 0x99, 0xAA, 0xA7, 0x3A, 0xFF, 0xE7, 0x3F, 0xFE, 0xA7, 0x3F, 0xFE, 0x97, 0x29, 0xE9,
+    0x77, 0x2E, 0xA7, 0x73, 0xE9, 0x77, 0x29, 0xE7, 0x73, 0xAE, 0x77, 0x3E, 0xA7, 0x72, 0x9F, 0xFF,
+    0xD9, 0x7A, 0xFF, 0xFD, 0x97, 0xFF, 0xFE, 0x97, 0xFF, 0xFE, 0x96, 0xAF, 0xFF, 0xE7, 0x59, 0x97,
+    0x3A, 0xD9, 0x72, 0xEA, 0x72, 0xEA, 0x71, 0x9A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x75, 0xEA, 0x71,
+    0xF7, 0x09, 0xEA, 0x70, 0xAE, 0x97, 0x0A, 0xE7, 0x1F, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE, 0x71,
+    0xEA, 0x71, 0xE9, 0x70, 0xAE, 0x71, 0xF7, 0x1E, 0xA7, 0x09, 0xEA, 0x70, 0xAE, 0x97, 0x0F, 0x71,
+    0xF7, 0x0A, 0xEA, 0x70, 0xF9, 0x70, 0xF9, 0x7A, 0xF7, 0x0F, 0xC7, 0x9F, 0xA7, 0x9A, 0xEA, 0x70,
+    0x75, 0xAA, 0x75, 0xD9, 0x74, 0xAC, 0xA7, 0x49, 0xD7, 0x5D, 0x97, 0x4E, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3E, 0xA7, 0x4F, 0x73, 0x9E, 0xA7, 0x3A, 0xE9, 0x73, 0xAE,
+    0x74, 0xF7, 0x4E, 0x97, 0x39, 0xE7, 0x4A, 0xE7, 0x4E, 0xA7, 0x4E, 0x97, 0x3A, 0xE7, 0x4F, 0x74,
+    0xEA, 0x73, 0x9E, 0xA7, 0x3A, 0xE9, 0x73, 0xF7, 0x4F, 0x73, 0xAE, 0xA7, 0x3F, 0x97, 0x3F, 0x97,
+    0x2A, 0xF7, 0x3F, 0xC7, 0x29, 0xFA, 0x72, 0x9A, 0xEA, 0x72, 0x7A, 0xA7, 0x49, 0xD9, 0x73, 0xF9,
+    0x71, 0xAD, 0x9D, 0xA7, 0x9C, 0xA2, 0x9D, 0x6C, 0xA5, 0x9C, 0x97, 0x77, 0x77, 0x76, 0xEA, 0x73,
+    0xF7, 0x29, 0xEA, 0x72, 0xAE, 0x97, 0x2A, 0xE7, 0x3F, 0x73, 0xE9, 0x72, 0x9E, 0x73, 0xAE, 0x73,
+    0xEA, 0x73, 0xE9, 0x72, 0xAE, 0x73, 0xF7, 0x3E, 0xA7, 0x29, 0xEA, 0x72, 0xAE, 0x97, 0x2F, 0x73,
+    0xF7, 0x2A, 0xEA, 0x72, 0xF9, 0x72, 0xF9, 0x71, 0xAF, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x19, 0xAE,
+    0xA7, 0x10, 0x5A, 0xD9, 0x3A, 0xD9, 0x5E, 0x93, 0xE9, 0x4A, 0xE9, 0x2A, 0xE5, 0xF3, 0xF4, 0xAF,
+    0x2A, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xEA, 0x75, 0xF7, 0x49, 0xEA, 0x74, 0xAE, 0x97,
+    0x4A, 0xE7, 0x5F, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xAE, 0x75, 0xEA, 0x75, 0xE9, 0x74, 0xAE, 0x75,
+    0xF7, 0x5E, 0xA7, 0x49, 0xEA, 0x74, 0xAE, 0x97, 0x4F, 0x75, 0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x74,
+    0xF9, 0x73, 0xAF, 0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x39, 0xAE, 0xA7, 0x30, 0x7F, 0xFA, 0xA9, 0x75,
+    0x9F, 0xFF, 0xA7, 0x3A, 0xFF, 0xFD, 0x72, 0xFF, 0xFF, 0x70, 0x9E, 0x69, 0xFD, 0x7A, 0xE7, 0x0A,
+    0xF9, 0x6E, 0xA7, 0x1A, 0xEA, 0x6E, 0x97, 0x2F, 0x59, 0xE7, 0x3F, 0x5A, 0xE7, 0x3F, 0x5E, 0xA7,
+    0x3F, 0x1F, 0xFF, 0xA6, 0xF0, 0xAF, 0xFF, 0x96, 0xF0, 0xFF, 0xFC, 0x69, 0xF4, 0xEA, 0x73, 0xAE,
+    0xA4, 0xE9, 0x73, 0xF9, 0x39, 0xE7, 0x3F, 0xC4, 0xAD, 0xA7, 0x1A, 0xFC, 0xA4, 0xEA, 0x99, 0x99,
+    0x99, 0x9A, 0xFF, 0x49, 0xFF, 0xFF, 0xE9, 0x4A, 0xFF, 0xFF, 0xDA, 0x5F, 0xFF, 0xFD, 0xA6, 0xFF,
+    0xFF, 0xC7, 0x9F, 0xFF, 0xE9, 0x70, 0xAF, 0xFD, 0xAA, 0x97, 0x20, 0x77, 0x99, 0x49, 0x97, 0x71,
+    0xF3, 0xC9, 0x77, 0x0A, 0xCA, 0x0C, 0xA1, 0x9C, 0x77, 0x1D, 0x19, 0xC1, 0xD7, 0x70, 0x9C, 0xA2,
+    0xF9, 0x77, 0x09, 0xC9, 0x3A, 0xA9, 0x77, 0x77, 0x77, 0x79, 0xAA, 0xA7, 0x19, 0x99, 0x97, 0x1F,
+    0x70, 0xAF, 0x71, 0xEA, 0x70, 0xFC, 0x70, 0x9E, 0x97, 0x9F, 0xC7, 0x0F, 0x70, 0xFD, 0x97, 0xEA,
+    0x70, 0xFD, 0xA6, 0xAE, 0x97, 0xAF, 0xE6, 0xF7, 0x0F, 0xF6, 0xEA, 0x70, 0xEA, 0xAE, 0x94, 0xAE,
+    0x97, 0xAE, 0x99, 0xEA, 0x4F, 0x70, 0xF0, 0x9E, 0xA3, 0x9E, 0xA7, 0x9F, 0x1F, 0x3A, 0xE9, 0x7A,
+    0xEA, 0x1F, 0x3F, 0x70, 0xF9, 0x1A, 0xE9, 0x19, 0xEA, 0x79, 0xF2, 0x9E, 0xA1, 0xAE, 0x97, 0xAF,
+    0x3F, 0x1F, 0x70, 0xFA, 0x3F, 0x09, 0xEA, 0x79, 0xF9, 0x3F, 0x0A, 0xE9, 0x7A, 0xF4, 0xAE, 0x9F,
+    0x70, 0xFC, 0x49, 0xFF, 0x79, 0xFA, 0x5F, 0xE9, 0x7F, 0xC9, 0x5F, 0xE7, 0x0F, 0xC6, 0xAF, 0xD7,
+    0xAF, 0xC6, 0xAF, 0xC9, 0x70, 0x75, 0x99, 0x77, 0x71, 0xE7, 0x77, 0x1E, 0x77, 0x70, 0x9E, 0x97,
+    0x77, 0xAA, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0xAF, 0xDA, 0x77, 0x0A, 0xFF, 0xEA,
+    0x74, 0x9F, 0xEA, 0xFE, 0x72, 0x9F, 0xC9, 0x4A, 0xFA, 0x70, 0x9F, 0xA7, 0xAF, 0x70, 0xF9, 0x71,
+    0xF9, 0x6F, 0xA7, 0x2A, 0xEA, 0x59, 0xEA, 0x73, 0x9E, 0xA5, 0xF7, 0x5E, 0xA4, 0x9E, 0x97, 0x5E,
+    0x94, 0xF7, 0x6E, 0x94, 0xE9, 0x75, 0x9E, 0x49, 0xE7, 0x6A, 0xE4, 0xAE, 0x76, 0xE9, 0x4E, 0xA7,
+    0x59, 0xE5, 0xEA, 0x75, 0xF5, 0xF7, 0x4F, 0x95, 0xFA, 0x71, 0x9F, 0xC6, 0xFD, 0x99, 0x29, 0x9A,
+    0xFD, 0x96, 0xFF, 0xFF, 0xF7, 0xAF, 0xFF, 0xFD, 0x71, 0xFF, 0xFF, 0xC9, 0x71, 0xAF, 0xFF, 0xE7,
+    0x49, 0xFF, 0xFA, 0x77, 0x9A, 0xFD, 0xA9, 0x77, 0x77, 0x70, 0x77, 0x49, 0xA7, 0x77, 0x09, 0xD7,
+    0x77, 0x0D, 0x77, 0x70, 0xDA, 0x77, 0x7A, 0xD7, 0x77, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xFD, 0xA7, 0x70, 0xAF, 0xFE, 0xA7, 0x49,
+    0xFE, 0xAF, 0xE7, 0x29, 0xFC, 0x94, 0xAF, 0xA7, 0x09, 0xFA, 0x7A, 0xF7, 0x0F, 0x97, 0x1F, 0x96,
+    0xFA, 0x72, 0xAE, 0xA5, 0x9E, 0xA7, 0x39, 0xEA, 0x5F, 0x75, 0xEA, 0x49, 0xE9, 0x75, 0xE9, 0x4F,
+    0x76, 0xE9, 0x4E, 0x97, 0x59, 0xE4, 0x9E, 0x76, 0xAE, 0x4A, 0xE7, 0x6E, 0x94, 0xEA, 0x75, 0x9E,
+    0x5E, 0xA7, 0x5F, 0x5F, 0x74, 0xF9, 0x5F, 0xA7, 0x19, 0xFC, 0x6F, 0xD9, 0x92, 0x99, 0xAF, 0xD9,
+    0x6F, 0xFF, 0xFF, 0x7A, 0xFF, 0xFF, 0xD7, 0x1F, 0xFF, 0xFC, 0x97, 0x1A, 0xFF, 0xFE, 0x74, 0x9F,
+    0xFF, 0xA7, 0x79, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x76, 0x9A, 0x77, 0x71, 0xE7, 0x77, 0x9F, 0x77,
+    0x6D, 0x99, 0xD9, 0x77, 0x3D, 0x92, 0xAC, 0xA7, 0x71, 0xAC, 0x6D, 0x77, 0x77, 0x74, 0x9A, 0xFD,
+    0xA7, 0x70, 0xAF, 0xFE, 0xA7, 0x49, 0xFE, 0xAF, 0xE7, 0x29, 0xFC, 0x94, 0xAF, 0xA7, 0x09, 0xFA,
+    0x7A, 0xF7, 0x0F, 0x97, 0x1F, 0x96, 0xFA, 0x72, 0xAE, 0xA5, 0x9E, 0xA7, 0x39, 0xEA, 0x5F, 0x75,
+    0xEA, 0x49, 0xE9, 0x75, 0xE9, 0x4F, 0x76, 0xE9, 0x4E, 0x97, 0x59, 0xE4, 0x9E, 0x76, 0xAE, 0x4A,
+    0xE7, 0x6E, 0x94, 0xEA, 0x75, 0x9E, 0x5E, 0xA7, 0x5F, 0x5F, 0x74, 0xF9, 0x5F, 0xA7, 0x19, 0xFC,
+    0x6F, 0xD9, 0x92, 0x99, 0xAF, 0xD9, 0x6F, 0xFF, 0xFF, 0x7A, 0xFF, 0xFF, 0xD7, 0x1F, 0xFF, 0xFC,
+    0x97, 0x1A, 0xFF, 0xFE, 0x74, 0x9F, 0xFF, 0xA7, 0x79, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x99,
+    0x49, 0x77, 0x19, 0xEA, 0x2D, 0x77, 0x1D, 0x0A, 0xC9, 0x1C, 0xA7, 0x70, 0xAC, 0x2D, 0xAD, 0x77,
+    0x1D, 0x3E, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9A, 0xFD, 0xA7, 0x70, 0xAF, 0xFE, 0xA7,
+    0x49, 0xFE, 0xAF, 0xE7, 0x29, 0xFC, 0x94, 0xAF, 0xA7, 0x09, 0xFA, 0x7A, 0xF7, 0x0F, 0x97, 0x1F,
+    0x96, 0xFA, 0x72, 0xAE, 0xA5, 0x9E, 0xA7, 0x39, 0xEA, 0x5F, 0x75, 0xEA, 0x49, 0xE9, 0x75, 0xE9,
+    0x4F, 0x76, 0xE9, 0x4E, 0x97, 0x59, 0xE4, 0x9E, 0x76, 0xAE, 0x4A, 0xE7, 0x6E, 0x94, 0xEA, 0x75,
+    0x9E, 0x5E, 0xA7, 0x5F, 0x5F, 0x74, 0xF9, 0x5F, 0xA7, 0x19, 0xFC, 0x6F, 0xD9, 0x92, 0x99, 0xAF,
+    0xD9, 0x6F, 0xFF, 0xFF, 0x7A, 0xFF, 0xFF, 0xD7, 0x1F, 0xFF, 0xFC, 0x97, 0x1A, 0xFF, 0xFE, 0x74,
+    0x9F, 0xFF, 0xA7, 0x79, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x74, 0x9E, 0x39, 0xE7, 0x7A, 0xE3, 0xF7,
+    0x7F, 0x29, 0xEA, 0x76, 0xAE, 0xA2, 0xFA, 0x76, 0xF9, 0x2F, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x72, 0x9A, 0xFD, 0xA7, 0x70, 0xAF, 0xFE, 0xA7, 0x49, 0xFE, 0xAF, 0xE7, 0x29, 0xFC, 0x94, 0xAF,
+    0xA7, 0x09, 0xFA, 0x7A, 0xF7, 0x0F, 0x97, 0x1F, 0x96, 0xFA, 0x72, 0xAE, 0xA5, 0x9E, 0xA7, 0x39,
+    0xEA, 0x5F, 0x75, 0xEA, 0x49, 0xE9, 0x75, 0xE9, 0x4F, 0x76, 0xE9, 0x4E, 0x97, 0x59, 0xE4, 0x9E,
+    0x76, 0xAE, 0x4A, 0xE7, 0x6E, 0x94, 0xEA, 0x75, 0x9E, 0x5E, 0xA7, 0x5F, 0x5F, 0x74, 0xF9, 0x5F,
+    0xA7, 0x19, 0xFC, 0x6F, 0xD9, 0x92, 0x99, 0xAF, 0xD9, 0x6F, 0xFF, 0xFF, 0x7A, 0xFF, 0xFF, 0xD7,
+    0x1F, 0xFF, 0xFC, 0x97, 0x1A, 0xFF, 0xFE, 0x74, 0x9F, 0xFF, 0xA7, 0x79, 0xAF, 0xDA, 0x97, 0x77,
+    0x77, 0x2A, 0xD3, 0xAD, 0x4E, 0x1D, 0xA5, 0x9F, 0xCA, 0x7A, 0xEA, 0x70, 0xFA, 0x69, 0xFD, 0xA4,
+    0xAE, 0x09, 0xE9, 0x19, 0xEA, 0x2A, 0xE9, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xC9,
+    0x77, 0x77, 0x74, 0xEA, 0x77, 0x77, 0x74, 0xEA, 0x77, 0x77, 0x74, 0xEA, 0x77, 0x77, 0x74, 0xEA,
+    0x77, 0x77, 0x74, 0xEA, 0x77, 0x77, 0x74, 0xF7, 0x77, 0x77, 0x4F, 0x77, 0x77, 0x74, 0xF7, 0x77,
+    0x77, 0x4F, 0x77, 0x77, 0x74, 0xF7, 0x77, 0x71, 0x9A, 0xFC, 0xAA, 0x1F, 0x77, 0x77, 0x0A, 0xFF,
+    0xFE, 0x77, 0x77, 0x9F, 0xEA, 0xFF, 0x77, 0x77, 0x9F, 0xC9, 0x4A, 0xFA, 0x77, 0x76, 0x9F, 0xA6,
+    0xAF, 0xC7, 0x77, 0x6F, 0x96, 0xAF, 0xD9, 0x77, 0x74, 0xFA, 0x6A, 0xFE, 0xA7, 0x77, 0x39, 0xEA,
+    0x6A, 0xE9, 0x9E, 0xA7, 0x77, 0x3F, 0x6A, 0xE9, 0x1E, 0xA7, 0x77, 0x29, 0xE9, 0x5A, 0xE9, 0x2E,
+    0x97, 0x77, 0x2F, 0x5A, 0xE9, 0x29, 0xE9, 0x77, 0x72, 0xE9, 0x4A, 0xEA, 0x39, 0xE7, 0x77, 0x29,
+    0xE4, 0xAE, 0xA4, 0xAE, 0x77, 0x72, 0xAE, 0x3A, 0xEA, 0x5E, 0x97, 0x77, 0x2E, 0xA2, 0xAE, 0xA5,
+    0x9E, 0x77, 0x73, 0xEA, 0x1A, 0xEA, 0x6F, 0x77, 0x73, 0xF0, 0xAE, 0xA6, 0xF9, 0x77, 0x73, 0xFF,
+    0xA5, 0x9F, 0xC7, 0x77, 0x4F, 0xF9, 0x19, 0x9A, 0xFD, 0x97, 0x77, 0x4F, 0xFF, 0xFF, 0x77, 0x75,
+    0xAF, 0xFF, 0xFD, 0x77, 0x76, 0xAF, 0xFF, 0xFC, 0x97, 0x77, 0x5A, 0xFF, 0xFF, 0xC7, 0x77, 0x6A,
+    0xFF, 0xFF, 0xA7, 0x77, 0x6A, 0xF1, 0x9A, 0xFD, 0xA9, 0x77, 0x77, 0xAF, 0x77, 0x77, 0x73, 0xAF,
+    0x77, 0x77, 0x73, 0xAF, 0x97, 0x77, 0x77, 0x2A, 0xF9, 0x77, 0x77, 0x72, 0xAF, 0x97, 0x77, 0x77,
+    0x2A, 0xF9, 0x77, 0x77, 0x72, 0xAF, 0x97, 0x77, 0x77, 0x29, 0xFA, 0x77, 0x77, 0x72, 0x9F, 0xA7,
+    0x77, 0x77, 0x29, 0xDA, 0x97, 0x77, 0x77, 0x39, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x00,
+    0x77, 0x77, 0x59, 0xDA, 0x77, 0x6A, 0xDA, 0x77, 0x6E, 0xA7, 0x76, 0xF7, 0x77, 0x09, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x1F, 0x97, 0x09, 0xF9, 0x49, 0xF9, 0x70, 0xAF, 0x5A, 0xF7, 0x1F, 0xC5,
+    0xFA, 0x71, 0xFA, 0x5F, 0x97, 0x09, 0xF5, 0x9F, 0x71, 0xAF, 0x5A, 0xF7, 0x1F, 0xA5, 0xF9, 0x71,
+    0xF9, 0x5F, 0x71, 0x9F, 0x6F, 0x71, 0xAE, 0xA5, 0x9E, 0xA7, 0x1A, 0xE9, 0x5A, 0xE7, 0x2F, 0x6F,
+    0x72, 0xEA, 0x6E, 0xA7, 0x19, 0xE9, 0x59, 0xE9, 0x71, 0xF6, 0xAE, 0x72, 0xF6, 0xF7, 0x1A, 0xE9,
+    0x6F, 0x71, 0xF7, 0xF9, 0x7F, 0xC6, 0x9F, 0xCA, 0x99, 0x99, 0xAF, 0xD9, 0x69, 0xFF, 0xFF, 0xC7,
+    0x9F, 0xFF, 0xF9, 0x70, 0xFF, 0xFE, 0xA7, 0x1A, 0xFF, 0xFC, 0xA7, 0x39, 0xAF, 0xFC, 0xA9, 0x77,
+    0x77, 0x30, 0x77, 0x3D, 0x77, 0x6A, 0xCA, 0x77, 0x59, 0xD7, 0x76, 0xD9, 0x77, 0x5E, 0x77, 0x59,
+    0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xAA, 0xA9,
+    0x70, 0x9A, 0xAA, 0xA9, 0x49, 0xF9, 0x70, 0xAF, 0x5A, 0xF7, 0x1F, 0xC5, 0xFA, 0x71, 0xFA, 0x5F,
+    0x97, 0x09, 0xF9, 0x49, 0xF7, 0x1A, 0xF5, 0xAF, 0x71, 0xFA, 0x5A, 0xE9, 0x71, 0xF9, 0x5F, 0x71,
+    0x9F, 0x6F, 0x71, 0x9E, 0xA5, 0x9E, 0xA7, 0x1A, 0xE9, 0x5A, 0xE9, 0x71, 0xF6, 0xF7, 0x2F, 0x6E,
+    0xA7, 0x19, 0xE9, 0x59, 0xE9, 0x71, 0xAE, 0x6A, 0xE7, 0x2F, 0x6F, 0x71, 0xAE, 0x96, 0xF7, 0x1F,
+    0x7F, 0x97, 0xFC, 0x69, 0xFC, 0xA9, 0x99, 0x9A, 0xFD, 0x96, 0x9F, 0xFF, 0xFC, 0x79, 0xFF, 0xFF,
+    0x97, 0x0F, 0xFF, 0xEA, 0x71, 0xAF, 0xFF, 0xCA, 0x73, 0x9A, 0xFF, 0xCA, 0x97, 0x77, 0x73, 0x75,
+    0xAC, 0x97, 0x76, 0xE7, 0x75, 0xAF, 0x97, 0x72, 0x9D, 0x1D, 0xA7, 0x70, 0x9D, 0x39, 0xD7, 0x7A,
+    0xA6, 0x9A, 0x77, 0x77, 0x3A, 0xAA, 0xA9, 0x70, 0x9A, 0xAA, 0xA9, 0x49, 0xF9, 0x70, 0xAF, 0x5A,
+    0xF7, 0x1F, 0xC5, 0xFA, 0x71, 0xFA, 0x5F, 0x97, 0x09, 0xF9, 0x49, 0xF7, 0x1A, 0xF5, 0xAF, 0x71,
+    0xFA, 0x5A, 0xEA, 0x71, 0xF9, 0x5F, 0x72, 0xF6, 0xF7, 0x19, 0xEA, 0x59, 0xEA, 0x71, 0xAE, 0x95,
+    0xAE, 0x97, 0x1F, 0x6F, 0x72, 0xF6, 0xEA, 0x71, 0x9E, 0x95, 0x9E, 0x97, 0x1A, 0xE6, 0xAE, 0x72,
+    0xF6, 0xF7, 0x1A, 0xE9, 0x6F, 0x71, 0xF7, 0xF9, 0x7F, 0xC6, 0x9F, 0xCA, 0x99, 0x99, 0xAF, 0xD9,
+    0x69, 0xFF, 0xFF, 0xC7, 0x9F, 0xFF, 0xF9, 0x70, 0xFF, 0xFE, 0xA7, 0x1A, 0xFF, 0xFC, 0xA7, 0x39,
+    0xAF, 0xFC, 0xA9, 0x77, 0x77, 0x30, 0x74, 0xDA, 0x39, 0xDA, 0x75, 0xAE, 0x3F, 0x75, 0xEA, 0x29,
+    0xEA, 0x74, 0xAE, 0xA2, 0xAE, 0xA7, 0x4F, 0x92, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0xFA, 0x70, 0x9F, 0x94, 0x9F, 0x71, 0xAF, 0x5A, 0xF7, 0x1F, 0xC5, 0xFA, 0x71, 0xFA, 0x5F, 0x97,
+    0x09, 0xF5, 0x9F, 0x71, 0xAF, 0x5A, 0xEA, 0x71, 0xFA, 0x5F, 0x97, 0x1F, 0x95, 0xF7, 0x19, 0xF5,
+    0x9F, 0x71, 0xAE, 0xA5, 0x9E, 0xA7, 0x1A, 0xE9, 0x5A, 0xE7, 0x2F, 0x6F, 0x72, 0xEA, 0x6E, 0xA7,
+    0x19, 0xE9, 0x59, 0xE9, 0x71, 0xF6, 0xAE, 0x72, 0xF6, 0xF7, 0x1A, 0xE9, 0x6F, 0x71, 0xF7, 0xF9,
+    0x7F, 0xC6, 0x9F, 0xCA, 0x99, 0x99, 0xAF, 0xD9, 0x69, 0xFF, 0xFF, 0xC7, 0x9F, 0xFF, 0xF9, 0x70,
+    0xFF, 0xFE, 0xA7, 0x1A, 0xFF, 0xFC, 0xA7, 0x39, 0xAF, 0xFC, 0xA9, 0x77, 0x77, 0x30, 0x76, 0x9A,
+    0x97, 0x71, 0xD7, 0x71, 0xD9, 0x77, 0x0A, 0xCA, 0x77, 0x0A, 0xD7, 0x70, 0x9D, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6E, 0xA7, 0x3E, 0x90, 0xF7, 0x2E, 0xA1, 0xAE,
+    0x71, 0xAE, 0x29, 0xE9, 0x7A, 0xE4, 0xF6, 0x9E, 0x94, 0xF6, 0xEA, 0x5A, 0xE9, 0x4F, 0x6A, 0xEA,
+    0x3F, 0x79, 0xF2, 0xAE, 0x97, 0x0F, 0x90, 0xAE, 0xA7, 0x1F, 0xA9, 0xF7, 0x2A, 0xFF, 0x97, 0x29,
+    0xFE, 0x97, 0x39, 0xFD, 0xA7, 0x5F, 0xD7, 0x6F, 0xC9, 0x76, 0xFA, 0x77, 0xF9, 0x76, 0xAF, 0x77,
+    0xFC, 0x76, 0xAF, 0xA7, 0x6F, 0xC9, 0x75, 0x9F, 0xC7, 0x6F, 0xD7, 0x59, 0xFC, 0xA7, 0x50, 0x59,
+    0xDA, 0x76, 0xAD, 0x77, 0xE7, 0x7E, 0x99, 0x74, 0x9F, 0xDA, 0x72, 0xAF, 0xF9, 0x70, 0xE9, 0x09,
+    0xFA, 0x69, 0xDA, 0x39, 0xE9, 0x5A, 0xD9, 0x49, 0xE5, 0xE6, 0x9D, 0x5E, 0x69, 0xD4, 0x9D, 0xA6,
+    0xDA, 0x4A, 0xD9, 0x49, 0xE5, 0xE4, 0xAE, 0x95, 0xDA, 0x2A, 0xF9, 0x59, 0xFF, 0xD7, 0xAF, 0xEA,
+    0x97, 0x0F, 0xCA, 0x97, 0x3D, 0xA7, 0x69, 0xD9, 0x76, 0xE7, 0x7E, 0x76, 0x9D, 0xA7, 0x60, 0x72,
+    0x99, 0xA9, 0x75, 0xAF, 0xE7, 0x19, 0xE9, 0x29, 0xD7, 0x0E, 0x5A, 0xC7, 0xAD, 0x69, 0xC9, 0x6D,
+    0x96, 0x9C, 0x6A, 0xD4, 0x9F, 0x6D, 0xA3, 0xAD, 0x97, 0x0D, 0x92, 0x9C, 0xA7, 0x19, 0xD3, 0xD7,
+    0x2E, 0x3C, 0xA7, 0x2E, 0x3C, 0xA7, 0x19, 0xDA, 0x3D, 0xA7, 0x0A, 0xD9, 0x3A, 0xDA, 0x7E, 0x5F,
+    0x59, 0xE6, 0xAD, 0xA4, 0xAD, 0xA7, 0xE4, 0xE9, 0x7E, 0x39, 0xE9, 0x69, 0xDA, 0x3A, 0xE0, 0xCA,
+    0x99, 0x99, 0xAE, 0x4F, 0x0F, 0xFC, 0xA4, 0xEA, 0x0F, 0xFA, 0x4A, 0xE9, 0x09, 0xFC, 0xA6, 0x77,
+    0x71, 0xAD, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x59, 0xEA, 0x77, 0x77, 0x77, 0xAE, 0xA7, 0x2A, 0xFE,
+    0x9D, 0x5F, 0xFE, 0xA4, 0xF9, 0x2A, 0xEA, 0x39, 0xE5, 0xE9, 0x3D, 0xA6, 0xE3, 0xAD, 0x7E, 0x3D,
+    0x97, 0xE2, 0x9D, 0x79, 0xDA, 0x2D, 0xA7, 0xEA, 0x2D, 0x96, 0xAE, 0x92, 0xDA, 0x5F, 0xC3, 0xF9,
+    0x9A, 0xAF, 0xD3, 0xFF, 0xFD, 0x3A, 0xFF, 0xFA, 0x4F, 0xFA, 0x9D, 0xA5, 0xAF, 0xA9, 0x09, 0xD9,
+    0x10, 0x76, 0x9C, 0xA7, 0x6D, 0x76, 0xD9, 0x75, 0xAD, 0x75, 0x9D, 0x76, 0xAA, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x75, 0xAE, 0xA7, 0x2A, 0xFE, 0x9D, 0x5F, 0xFE, 0xA4, 0xF9, 0x2A, 0xEA, 0x39,
+    0xE5, 0xE9, 0x3D, 0xA6, 0xE3, 0xAD, 0x7E, 0x3D, 0x97, 0xE2, 0x9D, 0x79, 0xDA, 0x2D, 0xA7, 0xEA,
+    0x2D, 0x96, 0xAE, 0x92, 0xDA, 0x5F, 0xC3, 0xF9, 0x9A, 0xAF, 0xD3, 0xFF, 0xFD, 0x3A, 0xFF, 0xFA,
+    0x4F, 0xFA, 0x9D, 0xA5, 0xAF, 0xA9, 0x09, 0xD9, 0x10, 0x73, 0xA9, 0x77, 0x0A, 0xD9, 0x77, 0xF9,
+    0x75, 0xDA, 0x9D, 0xA7, 0x3A, 0xCA, 0x29, 0xCA, 0x71, 0x9C, 0x95, 0xAC, 0x77, 0x75, 0xAE, 0xA7,
+    0x4A, 0xFE, 0x9D, 0x7F, 0xFE, 0xA6, 0xF9, 0x2A, 0xEA, 0x59, 0xE5, 0xE9, 0x5D, 0xA6, 0xE5, 0xAD,
+    0x7E, 0x5D, 0x97, 0xE4, 0x9D, 0x79, 0xDA, 0x4D, 0xA7, 0xEA, 0x4D, 0x96, 0xAE, 0x94, 0xDA, 0x5F,
+    0xC5, 0xF9, 0x9A, 0xAF, 0xD5, 0xFF, 0xFD, 0x5A, 0xFF, 0xFA, 0x6F, 0xFA, 0x9D, 0xA7, 0xAF, 0xA9,
+    0x09, 0xD9, 0x30, 0x70, 0xAD, 0xA3, 0xC9, 0x79, 0xDA, 0xC9, 0x1A, 0xC7, 0x0D, 0x1D, 0x1C, 0xA7,
+    0x9C, 0xA2, 0xF7, 0x09, 0xC3, 0x9A, 0xA7, 0x77, 0x6A, 0xEA, 0x73, 0xAF, 0xE9, 0xD6, 0xFF, 0xEA,
+    0x5F, 0x92, 0xAE, 0xA4, 0x9E, 0x5E, 0x94, 0xDA, 0x6E, 0x4A, 0xD7, 0xE4, 0xD9, 0x7E, 0x39, 0xD7,
+    0x9D, 0xA3, 0xDA, 0x7E, 0xA3, 0xD9, 0x6A, 0xE9, 0x3D, 0xA5, 0xFC, 0x4F, 0x99, 0xAA, 0xFD, 0x4F,
+    0xFF, 0xD4, 0xAF, 0xFF, 0xA5, 0xFF, 0xA9, 0xDA, 0x6A, 0xFA, 0x90, 0x9D, 0x92, 0x7A, 0xD9, 0x3A,
+    0xD9, 0x69, 0xE9, 0x29, 0xE7, 0xAE, 0x3F, 0x7F, 0x29, 0xF6, 0xAF, 0x2F, 0xC7, 0x77, 0x77, 0x71,
+    0xAE, 0xA7, 0x4A, 0xFE, 0x9D, 0x7F, 0xFE, 0xA6, 0xF9, 0x2A, 0xEA, 0x59, 0xE5, 0xE9, 0x5D, 0xA6,
+    0xE5, 0xAD, 0x7E, 0x5D, 0x97, 0xE4, 0x9D, 0x79, 0xDA, 0x4D, 0xA7, 0xEA, 0x4D, 0x96, 0xAE, 0x94,
+    0xDA, 0x5F, 0xC5, 0xF9, 0x9A, 0xAF, 0xD5, 0xFF, 0xFD, 0x5A, 0xFF, 0xFA, 0x6F, 0xFA, 0x9D, 0xA7,
+    0xAF, 0xA9, 0x09, 0xD9, 0x30, 0x73, 0x9D, 0x97, 0x4A, 0xC1, 0xC7, 0x39, 0xC2, 0xC9, 0x72, 0xAA,
+    0x2C, 0x97, 0x2A, 0xA1, 0xAC, 0x73, 0x9F, 0x97, 0x49, 0xAA, 0x77, 0x77, 0x77, 0x0A, 0xEA, 0x72,
+    0xAF, 0xE9, 0xD5, 0xFF, 0xEA, 0x4F, 0x92, 0xAE, 0xA3, 0x9E, 0x5E, 0x93, 0xDA, 0x6E, 0x3A, 0xD7,
+    0xE3, 0xD9, 0x7E, 0x29, 0xD7, 0x9D, 0xA2, 0xDA, 0x7E, 0xA2, 0xD9, 0x6A, 0xE9, 0x2D, 0xA5, 0xFC,
+    0x3F, 0x99, 0xAA, 0xFD, 0x3F, 0xFF, 0xD3, 0xAF, 0xFF, 0xA4, 0xFF, 0xA9, 0xDA, 0x5A, 0xFA, 0x90,
+    0x9D, 0x91, 0x77, 0x77, 0x6A, 0xEA, 0x6A, 0xEA, 0x97, 0x1A, 0xFE, 0x9D, 0x0A, 0xFE, 0xA7, 0xFF,
+    0xFE, 0xA9, 0x2A, 0xC9, 0x5F, 0x92, 0xAF, 0xD6, 0xD4, 0x9E, 0x5F, 0xC7, 0xAC, 0x93, 0xDA, 0x6F,
+    0x49, 0x9A, 0xAD, 0x92, 0xAD, 0x7F, 0xFF, 0xEA, 0x2D, 0x97, 0xFF, 0xFE, 0x91, 0x9D, 0x79, 0xE9,
+    0x99, 0x97, 0x2D, 0xA7, 0xEA, 0x76, 0xD9, 0x6A, 0xEA, 0x76, 0xDA, 0x5F, 0xD7, 0x6F, 0x99, 0xAA,
+    0xFF, 0xA6, 0xA4, 0xFF, 0xFF, 0xFF, 0xC4, 0xAF, 0xFF, 0xFF, 0xF5, 0xFF, 0xA9, 0xFF, 0xFC, 0xA6,
+    0xAF, 0xA9, 0x09, 0xD9, 0x0A, 0xAF, 0xA9, 0x40, 0x77, 0x59, 0xAF, 0xA5, 0x9F, 0xF4, 0xAF, 0xA9,
+    0x9A, 0xA3, 0x9E, 0xA7, 0x1E, 0x97, 0x1A, 0xDA, 0x72, 0xE7, 0x29, 0xDA, 0x72, 0xAD, 0x97, 0x2E,
+    0x97, 0x2E, 0x97, 0x2F, 0x72, 0xFC, 0xA9, 0x9A, 0xA4, 0xAF, 0xFC, 0x94, 0xFF, 0xD5, 0x9A, 0xFD,
+    0x97, 0xA7, 0x49, 0xDA, 0x75, 0x9C, 0x74, 0x9C, 0x73, 0x9C, 0xA7, 0x0F, 0xA7, 0x1A, 0xAA, 0x97,
+    0x77, 0x72, 0xE7, 0x69, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9A,
+    0xEA, 0x71, 0x9F, 0xF7, 0xAE, 0x93, 0xD5, 0x9D, 0xA5, 0x9C, 0x93, 0x9D, 0x97, 0xD3, 0xDA, 0x39,
+    0x9A, 0xAE, 0x2A, 0xFF, 0xFD, 0x2F, 0xFF, 0xDA, 0x19, 0xDA, 0x99, 0x99, 0x71, 0xAD, 0x76, 0xE7,
+    0x6E, 0xA7, 0x5A, 0xF9, 0x59, 0xA3, 0x9F, 0xFF, 0xA4, 0xFF, 0xF9, 0x5F, 0xFE, 0x79, 0xAF, 0xCA,
+    0x94, 0x77, 0xD7, 0x7A, 0xCA, 0x76, 0x9D, 0x77, 0xD9, 0x76, 0xE7, 0x69, 0xAA, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0xAE, 0xA7, 0x29, 0xFF, 0x70, 0xAE, 0x93,
+    0xD6, 0x9D, 0xA5, 0x9C, 0x94, 0x9D, 0x97, 0xD4, 0xDA, 0x39, 0x9A, 0xAE, 0x3A, 0xFF, 0xFD, 0x3F,
+    0xFF, 0xDA, 0x29, 0xDA, 0x99, 0x99, 0x72, 0xAD, 0x77, 0xE7, 0x7E, 0xA7, 0x6A, 0xF9, 0x59, 0xA4,
+    0x9F, 0xFF, 0xA5, 0xFF, 0xF9, 0x6F, 0xFE, 0x70, 0x9A, 0xFC, 0xA9, 0x50, 0x71, 0x9A, 0x77, 0x0E,
+    0x76, 0x9F, 0x75, 0xD9, 0x9D, 0x97, 0x2D, 0x92, 0xAC, 0xA7, 0x0A, 0xC6, 0xCA, 0x77, 0x77, 0x77,
+    0x77, 0x19, 0xAE, 0xA7, 0x29, 0xFF, 0x70, 0xAE, 0x93, 0xD6, 0x9D, 0xA5, 0x9C, 0x94, 0x9D, 0x97,
+    0xD4, 0xDA, 0x39, 0x9A, 0xAE, 0x3A, 0xFF, 0xFD, 0x3F, 0xFF, 0xDA, 0x29, 0xDA, 0x99, 0x99, 0x72,
+    0xAD, 0x77, 0xE7, 0x7E, 0xA7, 0x6A, 0xF9, 0x59, 0xA4, 0x9F, 0xFF, 0xA5, 0xFF, 0xF9, 0x6F, 0xFE,
+    0x70, 0x9A, 0xFC, 0xA9, 0x50, 0x79, 0xE3, 0x9E, 0x7F, 0x3F, 0x69, 0xEA, 0x29, 0xEA, 0x6F, 0xA2,
+    0xFA, 0x6F, 0x92, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9A, 0xEA, 0x73, 0x9F, 0xF7,
+    0x1A, 0xE9, 0x3D, 0x79, 0xDA, 0x59, 0xC9, 0x59, 0xD9, 0x7D, 0x5D, 0xA3, 0x99, 0xAA, 0xE4, 0xAF,
+    0xFF, 0xD4, 0xFF, 0xFD, 0xA3, 0x9D, 0xA9, 0x99, 0x97, 0x3A, 0xD7, 0x70, 0xE7, 0x70, 0xEA, 0x77,
+    0xAF, 0x95, 0x9A, 0x59, 0xFF, 0xFA, 0x6F, 0xFF, 0x97, 0xFF, 0xE7, 0x19, 0xAF, 0xCA, 0x96, 0x2A,
+    0xD7, 0x0E, 0x97, 0xE9, 0x69, 0xE9, 0x79, 0x9A, 0x77, 0x77, 0x6A, 0xCA, 0x7D, 0x96, 0x9D, 0x7A,
+    0xCA, 0x7D, 0x97, 0xD7, 0xAD, 0x7D, 0xA7, 0xD9, 0x6A, 0xD7, 0xE7, 0xE6, 0xAD, 0xA6, 0xE9, 0x6E,
+    0x95, 0x9E, 0x60, 0x72, 0xD7, 0x2D, 0x97, 0x1A, 0xCA, 0x71, 0x9D, 0x72, 0xD9, 0x71, 0xAA, 0xA7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xCA, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xAD, 0x72, 0xD9,
+    0x72, 0xD7, 0x29, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2E, 0x72, 0xE7, 0x1A, 0xDA, 0x71,
+    0xE9, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0x4D, 0x72, 0x9E, 0x71, 0xFC, 0x7D, 0xA0, 0x9D, 0x94, 0xAC,
+    0xA3, 0xAC, 0xA3, 0xA9, 0x6A, 0x97, 0x73, 0xAC, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2D,
+    0xA7, 0x2D, 0x72, 0x9D, 0x72, 0xDA, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xE7, 0x2E, 0x71, 0xAD, 0xA7,
+    0x1E, 0x97, 0x1E, 0x97, 0x09, 0xE7, 0x10, 0x2A, 0xD4, 0xE2, 0x9E, 0x39, 0xE2, 0xF3, 0xF1, 0x9F,
+    0x29, 0xF1, 0xFC, 0x2F, 0xA7, 0x77, 0x77, 0x77, 0x71, 0xAC, 0xA7, 0x3D, 0x97, 0x29, 0xD7, 0x3A,
+    0xCA, 0x73, 0xD9, 0x73, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x3D, 0x97, 0x2A, 0xD7, 0x3E, 0x73, 0xE7,
+    0x2A, 0xDA, 0x72, 0xE9, 0x72, 0xE9, 0x71, 0x9E, 0x72, 0x76, 0xAC, 0xA9, 0x77, 0x4F, 0xA7, 0x75,
+    0xE7, 0x75, 0xAD, 0x77, 0x0F, 0xFF, 0xC7, 0x29, 0xFF, 0xFA, 0x72, 0xAF, 0xFF, 0x97, 0x7A, 0xCA,
+    0x77, 0x5D, 0x97, 0x3A, 0xFC, 0x91, 0x9D, 0x72, 0x9F, 0xF9, 0x0A, 0xCA, 0x71, 0x9E, 0xA2, 0xAD,
+    0x0D, 0x71, 0x9E, 0x5F, 0xC7, 0x1E, 0x95, 0x9E, 0x97, 0x09, 0xDA, 0x69, 0xE7, 0x1A, 0xD7, 0x9D,
+    0x97, 0x1E, 0x7E, 0x72, 0xE6, 0xAD, 0x97, 0x2E, 0xA3, 0x9A, 0xDA, 0x73, 0xFF, 0xF7, 0x49, 0xFF,
+    0xD7, 0x6A, 0xFF, 0x77, 0x09, 0xAE, 0xA9, 0x76, 0x73, 0x99, 0x49, 0x72, 0x9F, 0x2A, 0xC7, 0x2D,
+    0x09, 0xC9, 0x1C, 0xA7, 0x19, 0xC9, 0x1A, 0xF7, 0x2D, 0x3A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x73,
+    0x99, 0x97, 0x39, 0xCA, 0x9A, 0xFC, 0xA7, 0x1F, 0xFE, 0xA7, 0x0F, 0xC9, 0x19, 0xE7, 0x9E, 0xA4,
+    0xAD, 0x7E, 0xA5, 0xAD, 0x7E, 0x6E, 0x69, 0xE6, 0xE6, 0xE9, 0x59, 0xE6, 0xE9, 0x5A, 0xDA, 0x59,
+    0xE6, 0xE9, 0x5F, 0x59, 0xE6, 0xEA, 0x5A, 0xE5, 0xAE, 0x95, 0xF5, 0xF6, 0xEA, 0x5F, 0x59, 0xE9,
+    0x4A, 0xEA, 0x5F, 0x94, 0x79, 0x99, 0x77, 0xE7, 0x69, 0xE7, 0x6A, 0xE7, 0x6A, 0xAA, 0xC7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x73, 0x9A, 0xFA, 0x71, 0xAF, 0xF9, 0x59, 0xFA, 0xAA, 0xF9, 0x4E, 0x94,
+    0x9D, 0xA3, 0xE7, 0xE2, 0x9D, 0x97, 0xE2, 0xE7, 0x0E, 0x19, 0xD9, 0x70, 0xE1, 0xAD, 0x70, 0xAD,
+    0x91, 0xE7, 0x0E, 0x2E, 0x96, 0xEA, 0x2F, 0xA9, 0x99, 0x9A, 0xF3, 0xAF, 0xFF, 0x5F, 0xFE, 0x95,
+    0x9F, 0xFA, 0x71, 0xAF, 0xA9, 0x60, 0x77, 0xAA, 0x77, 0xAC, 0xA7, 0x69, 0xD7, 0x7D, 0x97, 0x6D,
+    0xA7, 0x6A, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xFA,
+    0x72, 0xAF, 0xF9, 0x69, 0xFA, 0xAA, 0xF9, 0x5E, 0x94, 0x9D, 0xA4, 0xE7, 0xE3, 0x9D, 0x97, 0xE3,
+    0xE7, 0x0E, 0x29, 0xD9, 0x70, 0xE2, 0xAD, 0x70, 0xAD, 0x92, 0xE7, 0x0E, 0x3E, 0x96, 0xEA, 0x3F,
+    0xA9, 0x99, 0x9A, 0xF4, 0xAF, 0xFF, 0x6F, 0xFE, 0x96, 0x9F, 0xFA, 0x72, 0xAF, 0xA9, 0x70, 0x71,
+    0xAA, 0x77, 0x0D, 0xA7, 0x6A, 0xEA, 0x74, 0x9D, 0x9A, 0xD7, 0x3D, 0x3D, 0x97, 0x0D, 0x59, 0xCA,
+    0x77, 0x77, 0x77, 0x77, 0x09, 0xAF, 0xA7, 0x2A, 0xFF, 0x96, 0x9F, 0xAA, 0xAF, 0x95, 0xE9, 0x49,
+    0xDA, 0x4E, 0x7E, 0x39, 0xD9, 0x7E, 0x3E, 0x70, 0xE2, 0x9D, 0x97, 0x0E, 0x2A, 0xD7, 0x0A, 0xD9,
+    0x2E, 0x70, 0xE3, 0xE9, 0x6E, 0xA3, 0xFA, 0x99, 0x99, 0xAF, 0x4A, 0xFF, 0xF6, 0xFF, 0xE9, 0x69,
+    0xFF, 0xA7, 0x2A, 0xFA, 0x97, 0x70, 0x9E, 0x3C, 0xA7, 0x0D, 0xAC, 0xA2, 0xC9, 0x7A, 0xC9, 0x0A,
+    0xC1, 0xAC, 0x70, 0xD2, 0xFA, 0x79, 0xCA, 0x29, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79,
+    0xAF, 0xA7, 0x2A, 0xFF, 0x96, 0x9F, 0xAA, 0xAF, 0x95, 0xE9, 0x49, 0xDA, 0x4E, 0x7E, 0x39, 0xD9,
+    0x7E, 0x3E, 0x70, 0xE2, 0x9D, 0x97, 0x0E, 0x2A, 0xD7, 0x0A, 0xD9, 0x2E, 0x70, 0xE3, 0xE9, 0x6E,
+    0xA3, 0xFA, 0x99, 0x99, 0xAF, 0x4A, 0xFF, 0xF6, 0xFF, 0xE9, 0x69, 0xFF, 0xA7, 0x2A, 0xFA, 0x97,
+    0x7A, 0xDA, 0x3A, 0xDA, 0x7E, 0xA3, 0xEA, 0x6A, 0xE9, 0x2A, 0xE9, 0x6F, 0x92, 0xF9, 0x59, 0xF2,
+    0x9F, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9A, 0xFA, 0x73, 0xAF, 0xF9, 0x79, 0xFA, 0xAA,
+    0xF9, 0x6E, 0x94, 0x9D, 0xA5, 0xE7, 0xE4, 0x9D, 0x97, 0xE4, 0xE7, 0x0E, 0x39, 0xD9, 0x70, 0xE3,
+    0xAD, 0x70, 0xAD, 0x93, 0xE7, 0x0E, 0x4E, 0x96, 0xEA, 0x4F, 0xA9, 0x99, 0x9A, 0xF5, 0xAF, 0xFF,
+    0x7F, 0xFE, 0x97, 0x9F, 0xFA, 0x73, 0xAF, 0xA9, 0x70, 0x70, 0x9D, 0xA7, 0x6E, 0xA7, 0x59, 0xEA,
+    0x75, 0xF9, 0x74, 0x9F, 0x97, 0x77, 0x77, 0x77, 0x77, 0x39, 0x99, 0x99, 0x2A, 0xFF, 0xFE, 0x90,
+    0xAF, 0xFF, 0xF9, 0x77, 0x77, 0x73, 0xAD, 0x97, 0x59, 0xE7, 0x6F, 0x75, 0x9F, 0x75, 0xAF, 0x71,
+    0x77, 0x72, 0x97, 0x77, 0x19, 0xD7, 0x77, 0x1D, 0x77, 0x71, 0xAC, 0xA7, 0x77, 0x1D, 0x77, 0x71,
+    0xDA, 0x77, 0x70, 0x9D, 0x77, 0x71, 0xDA, 0x77, 0x70, 0x9D, 0x77, 0x71, 0xD9, 0x77, 0x70, 0xAD,
+    0x77, 0x71, 0xD9, 0x77, 0x70, 0xAD, 0x77, 0x70, 0x9D, 0x77, 0x49, 0xAF, 0xCA, 0x77, 0x3A, 0xFF,
+    0x97, 0x70, 0x9F, 0xAA, 0xFC, 0x77, 0x0E, 0x91, 0xAD, 0x9D, 0xA7, 0x6E, 0x29, 0xD9, 0x0E, 0x75,
+    0x9D, 0x92, 0xE1, 0xAD, 0x75, 0xE2, 0x9D, 0x91, 0xE7, 0x49, 0xD9, 0x2D, 0xA2, 0xDA, 0x74, 0xAD,
+    0x2A, 0xD2, 0xAD, 0x97, 0x4E, 0x19, 0xD9, 0x2E, 0x75, 0xE1, 0xE2, 0xEA, 0x75, 0xFA, 0xDA, 0x9A,
+    0xF7, 0x6A, 0xFF, 0xF7, 0x70, 0xFF, 0xE9, 0x77, 0x09, 0xFF, 0xA7, 0x73, 0xFD, 0xA9, 0x77, 0x39,
+    0xDA, 0x77, 0x70, 0xE7, 0x77, 0x0A, 0xD9, 0x77, 0x70, 0xE7, 0x77, 0x0A, 0xD9, 0x77, 0x79, 0xE7,
+    0x77, 0x0E, 0x97, 0x77, 0x9E, 0x77, 0x70, 0xE7, 0x77, 0x0A, 0xDA, 0x77, 0x70, 0xE7, 0x77, 0x0A,
+    0xD9, 0x77, 0x70, 0xCA, 0x77, 0x71, 0xA9, 0x77, 0x77, 0x77, 0x60, 0x69, 0x97, 0x7A, 0xD9, 0x76,
+    0xEA, 0x76, 0xEA, 0x75, 0x9A, 0xDA, 0x77, 0x77, 0x77, 0x74, 0x9D, 0x96, 0xAD, 0x92, 0xAD, 0x7E,
+    0x3E, 0x7E, 0x3E, 0x69, 0xDA, 0x29, 0xDA, 0x6A, 0xD9, 0x2A, 0xD9, 0x6E, 0x3A, 0xD6, 0x9E, 0x3E,
+    0x6A, 0xDA, 0x3D, 0xA6, 0xE9, 0x29, 0xDA, 0x5A, 0xE9, 0x2A, 0xE4, 0xAF, 0x3A, 0xFF, 0xFC, 0x3A,
+    0xFF, 0xFA, 0x3A, 0xFF, 0xF9, 0x39, 0xFF, 0x9E, 0x59, 0xFC, 0xA0, 0x9E, 0x77, 0x50, 0x76, 0xAA,
+    0x76, 0xD7, 0x6A, 0xCA, 0x75, 0x9D, 0x76, 0xD9, 0x75, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x74, 0x9D, 0x96, 0xAD, 0x92, 0xAD, 0x7E, 0x3E, 0x7E, 0x3E, 0x69, 0xDA, 0x29, 0xDA, 0x6A,
+    0xD9, 0x2A, 0xD9, 0x6E, 0x3A, 0xD6, 0x9E, 0x3E, 0x6A, 0xDA, 0x3D, 0xA6, 0xE9, 0x29, 0xDA, 0x5A,
+    0xE9, 0x2A, 0xE4, 0xAF, 0x3A, 0xFF, 0xFC, 0x3A, 0xFF, 0xFA, 0x3A, 0xFF, 0xF9, 0x39, 0xFF, 0x9E,
+    0x59, 0xFC, 0xA0, 0x9E, 0x77, 0x50, 0x70, 0xA9, 0x76, 0xAD, 0x97, 0x5F, 0x97, 0x3E, 0x9D, 0xA7,
+    0x1A, 0xCA, 0x29, 0xD7, 0x9C, 0x95, 0xAC, 0x97, 0x75, 0x9D, 0x96, 0xAD, 0x92, 0xAD, 0x7E, 0x3E,
+    0x7E, 0x3E, 0x69, 0xDA, 0x29, 0xDA, 0x6A, 0xD9, 0x2A, 0xD9, 0x6E, 0x3A, 0xD6, 0x9E, 0x3E, 0x6A,
+    0xDA, 0x3D, 0xA6, 0xE9, 0x29, 0xDA, 0x5A, 0xE9, 0x2A, 0xE4, 0xAF, 0x3A, 0xFF, 0xFC, 0x3A, 0xFF,
+    0xFA, 0x3A, 0xFF, 0xF9, 0x39, 0xFF, 0x9E, 0x59, 0xFC, 0xA0, 0x9E, 0x77, 0x50, 0x6E, 0x93, 0xE9,
+    0x59, 0xE9, 0x29, 0xE6, 0xF3, 0xF5, 0x9F, 0x29, 0xF5, 0xAE, 0xA2, 0xAE, 0xA7, 0x77, 0x77, 0x77,
+    0x49, 0xD9, 0x6A, 0xD9, 0x3A, 0xD7, 0xE4, 0xE7, 0xE4, 0xE6, 0x9D, 0xA3, 0x9D, 0xA6, 0xAD, 0x93,
+    0xAD, 0x96, 0xE4, 0xAD, 0x69, 0xE4, 0xE6, 0xAD, 0xA4, 0xDA, 0x6E, 0x93, 0x9D, 0xA5, 0xAE, 0x93,
+    0xAE, 0x4A, 0xF4, 0xAF, 0xFF, 0xC4, 0xAF, 0xFF, 0xA4, 0xAF, 0xFF, 0x94, 0x9F, 0xF9, 0xE6, 0x9F,
+    0xCA, 0x09, 0xE7, 0x77, 0x77, 0x19, 0xCA, 0x77, 0x19, 0xD7, 0x72, 0xD9, 0x77, 0x1D, 0xA7, 0x71,
+    0xAD, 0x77, 0x2A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0xDA, 0x70, 0xE6, 0xE7, 0x9D, 0x96, 0xAD, 0x96, 0xE7, 0xAD, 0xA5, 0xAD, 0x97, 0x9E, 0x5E,
+    0x71, 0xE4, 0xE9, 0x71, 0xEA, 0x29, 0xE7, 0x2A, 0xE2, 0xE9, 0x72, 0x9E, 0x1A, 0xE7, 0x4E, 0xA0,
+    0xE9, 0x74, 0xFA, 0xE7, 0x5A, 0xFD, 0x97, 0x59, 0xFD, 0x77, 0xFC, 0x97, 0x7F, 0xC7, 0x70, 0xF9,
+    0x77, 0x9F, 0x77, 0x0F, 0x97, 0x69, 0xFC, 0x75, 0x9F, 0xD7, 0x3F, 0xFC, 0x74, 0xFE, 0xA7, 0x49,
+    0xFD, 0x97, 0x5A, 0xDA, 0x97, 0x70, 0x77, 0x70, 0xAD, 0x76, 0xE7, 0x6D, 0xA7, 0x59, 0xD9, 0x75,
+    0xAD, 0x76, 0xFC, 0xA7, 0x3F, 0xE9, 0x70, 0x9D, 0x90, 0x9E, 0xA7, 0xAD, 0x3A, 0xD9, 0x6D, 0xA4,
+    0xE6, 0xD9, 0x49, 0xD5, 0x9D, 0x6D, 0x5A, 0xD6, 0xD5, 0xDA, 0x5A, 0xCA, 0x5D, 0x94, 0x9D, 0x59,
+    0xD5, 0xDA, 0x5A, 0xD4, 0xE6, 0xDA, 0x29, 0xE7, 0xD9, 0x1F, 0x96, 0x9F, 0xF7, 0x0A, 0xFD, 0x97,
+    0x1E, 0xA9, 0x74, 0xD9, 0x75, 0x9D, 0x76, 0xAD, 0x76, 0xDA, 0x76, 0xD9, 0x75, 0x9D, 0x76, 0x9A,
+    0xA7, 0x60, 0x72, 0xAD, 0x4A, 0xD7, 0x29, 0xE3, 0x9E, 0x72, 0xF3, 0xF7, 0x19, 0xF2, 0x9F, 0x71,
+    0xFC, 0x2F, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0xDA, 0x70, 0xE7, 0xE7,
+    0x9D, 0x97, 0xAD, 0x96, 0xE7, 0x0A, 0xDA, 0x5A, 0xD9, 0x70, 0x9E, 0x5E, 0x72, 0xE4, 0xE9, 0x72,
+    0xEA, 0x29, 0xE7, 0x3A, 0xE2, 0xE9, 0x73, 0x9E, 0x1A, 0xE7, 0x5E, 0xA0, 0xE9, 0x75, 0xFA, 0xE7,
+    0x6A, 0xFD, 0x97, 0x69, 0xFD, 0x77, 0x0F, 0xC9, 0x77, 0x0F, 0xC7, 0x71, 0xF9, 0x77, 0x09, 0xF7,
+    0x71, 0xF9, 0x77, 0x9F, 0xC7, 0x69, 0xFD, 0x74, 0xFF, 0xC7, 0x5F, 0xEA, 0x75, 0x9F, 0xD9, 0x76,
+    0xAD, 0xA9, 0x77, 0x10, 0x77, 0x59, 0x99, 0x97, 0x5F, 0xFE, 0xA7, 0x4F, 0xFF, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0xEA, 0x77, 0x4A, 0xEA, 0x77, 0x4F, 0xC7, 0x73, 0xFD, 0x77, 0x29,
+    0xDA, 0xE7, 0x72, 0xE0, 0xE7, 0x71, 0xE9, 0x0E, 0x97, 0x79, 0xE1, 0xE9, 0x77, 0xE2, 0xE9, 0x76,
+    0xAD, 0xA2, 0xAD, 0xA7, 0x59, 0xE3, 0xAD, 0xA7, 0x5E, 0x93, 0xAE, 0x74, 0xAE, 0x4A, 0xE7, 0x39,
+    0xE5, 0x9E, 0x73, 0xEA, 0x59, 0xE7, 0x2A, 0xE6, 0x9E, 0x97, 0x1E, 0x97, 0xE9, 0x70, 0xFF, 0xFF,
+    0xA7, 0xAF, 0xFF, 0xFA, 0x7F, 0xFF, 0xFC, 0xA6, 0xFF, 0xFF, 0xE5, 0x9E, 0xA7, 0x2F, 0x5F, 0x73,
+    0xF4, 0xAE, 0xA7, 0x3F, 0x39, 0xF7, 0x39, 0xF9, 0x20, 0x76, 0x99, 0x99, 0x7A, 0xFF, 0xE6, 0xAF,
+    0xFF, 0x77, 0x77, 0x77, 0x1A, 0xEA, 0x74, 0xAF, 0xE9, 0xD7, 0xFF, 0xEA, 0x6F, 0x92, 0xAE, 0xA5,
+    0x9E, 0x5E, 0x95, 0xDA, 0x6E, 0x5A, 0xD7, 0xE5, 0xD9, 0x7E, 0x49, 0xD7, 0x9D, 0xA4, 0xDA, 0x7E,
+    0xA4, 0xD9, 0x6A, 0xE9, 0x4D, 0xA5, 0xFC, 0x5F, 0x99, 0xAA, 0xFD, 0x5F, 0xFF, 0xD5, 0xAF, 0xFF,
+    0xA6, 0xFF, 0xA9, 0xDA, 0x7A, 0xFA, 0x90, 0x9D, 0x93, 0x75, 0xAA, 0x7A, 0x97, 0x5D, 0x6A, 0xC7,
+    0x6D, 0xA4, 0xAD, 0x76, 0xAF, 0xFC, 0x77, 0x0F, 0xF7, 0x72, 0xAE, 0xA9, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x5E, 0xA7, 0x74, 0xAE, 0xA7, 0x74, 0xFC, 0x77, 0x3F, 0xD7, 0x72,
+    0x9D, 0xAE, 0x77, 0x2E, 0x0E, 0x77, 0x1E, 0x90, 0xE9, 0x77, 0x9E, 0x1E, 0x97, 0x7E, 0x2E, 0x97,
+    0x6A, 0xDA, 0x2A, 0xDA, 0x75, 0x9E, 0x3A, 0xDA, 0x75, 0xE9, 0x3A, 0xE7, 0x4A, 0xE4, 0xAE, 0x73,
+    0x9E, 0x59, 0xE7, 0x3E, 0xA5, 0x9E, 0x72, 0xAE, 0x69, 0xE9, 0x71, 0xE9, 0x7E, 0x97, 0x0F, 0xFF,
+    0xFA, 0x7A, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0xCA, 0x6F, 0xFF, 0xFE, 0x59, 0xEA, 0x72, 0xF5, 0xF7,
+    0x3F, 0x4A, 0xEA, 0x73, 0xF3, 0x9F, 0x73, 0x9F, 0x92, 0x69, 0xA9, 0x6A, 0xA7, 0xAC, 0x95, 0x9C,
+    0xA7, 0xAD, 0x49, 0xD7, 0x1F, 0xFC, 0x97, 0x1A, 0xFE, 0x97, 0x39, 0xAD, 0xA9, 0x77, 0x77, 0x77,
+    0x77, 0x71, 0xAE, 0xA7, 0x4A, 0xFE, 0x9D, 0x7F, 0xFE, 0xA6, 0xF9, 0x2A, 0xEA, 0x59, 0xE5, 0xE9,
+    0x5D, 0xA6, 0xE5, 0xAD, 0x7E, 0x5D, 0x97, 0xE4, 0x9D, 0x79, 0xDA, 0x4D, 0xA7, 0xEA, 0x4D, 0x96,
+    0xAE, 0x94, 0xDA, 0x5F, 0xC5, 0xF9, 0x9A, 0xAF, 0xD5, 0xFF, 0xFD, 0x5A, 0xFF, 0xFA, 0x6F, 0xFA,
+    0x9D, 0xA7, 0xAF, 0xA9, 0x09, 0xD9, 0x30, 0x77, 0xEA, 0x77, 0x1A, 0xEA, 0x77, 0x1F, 0xC7, 0x70,
+    0xFD, 0x77, 0x9D, 0xAE, 0x77, 0xE0, 0xE7, 0x6E, 0x90, 0xE9, 0x74, 0x9E, 0x1E, 0x97, 0x4E, 0x2E,
+    0x97, 0x3A, 0xDA, 0x2A, 0xDA, 0x72, 0x9E, 0x3A, 0xDA, 0x72, 0xE9, 0x3A, 0xE7, 0x1A, 0xE4, 0xAE,
+    0x70, 0x9E, 0x59, 0xE7, 0x0E, 0xA5, 0x9E, 0x7A, 0xE6, 0x9E, 0x96, 0xE9, 0x7E, 0x95, 0xFF, 0xFF,
+    0xA4, 0xAF, 0xFF, 0xFA, 0x4F, 0xFF, 0xFC, 0xA3, 0xFF, 0xFF, 0xE2, 0x9E, 0xA7, 0x2F, 0x2F, 0x73,
+    0xF1, 0xAE, 0xA7, 0x3F, 0x09, 0xF7, 0x39, 0xF9, 0x77, 0x0A, 0xC9, 0x77, 0x2D, 0x77, 0x3D, 0x77,
+    0x39, 0xC7, 0x74, 0x9F, 0x77, 0x29, 0xAD, 0x77, 0x72, 0x77, 0x72, 0xAE, 0xA7, 0x2A, 0xFE, 0x9D,
+    0x5F, 0xFE, 0xA4, 0xF9, 0x2A, 0xEA, 0x39, 0xE5, 0xE9, 0x3D, 0xA6, 0xE3, 0xAD, 0x7E, 0x3D, 0x97,
+    0xE2, 0x9D, 0x79, 0xDA, 0x2D, 0xA7, 0xEA, 0x2D, 0x96, 0xAE, 0x92, 0xDA, 0x5F, 0xC3, 0xF9, 0x9A,
+    0xAF, 0xD3, 0xFF, 0xFD, 0x3A, 0xFF, 0xFA, 0x4F, 0xFA, 0x9D, 0xA5, 0xAF, 0xA9, 0xAE, 0x97, 0x3A,
+    0xD7, 0x6C, 0xA7, 0x69, 0xC9, 0x77, 0xF9, 0x75, 0xAD, 0x30, 0x77, 0x39, 0xCA, 0x77, 0x5D, 0x77,
+    0x5D, 0xA7, 0x74, 0xAD, 0x77, 0x49, 0xD9, 0x77, 0x4A, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xAF, 0xCA, 0x97, 0x49, 0xFF, 0xDA, 0x72, 0x9F, 0xFF,
+    0x72, 0xAF, 0xCA, 0x99, 0x99, 0x9A, 0xA7, 0x1F, 0xCA, 0x77, 0x1F, 0xC7, 0x72, 0xFC, 0x77, 0x2A,
+    0xEA, 0x77, 0x29, 0xF7, 0x73, 0xF7, 0x73, 0x9E, 0xA7, 0x73, 0xF7, 0x73, 0x9E, 0xA7, 0x73, 0xAE,
+    0x97, 0x73, 0xF9, 0x77, 0x3F, 0xA7, 0x72, 0x9F, 0xC7, 0x72, 0x9F, 0xD7, 0x19, 0x69, 0xFF, 0xA9,
+    0x99, 0x9A, 0xE6, 0x9F, 0xFF, 0xFA, 0x7F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFE, 0x71, 0xFF, 0xFE, 0x71,
+    0x9F, 0xFF, 0xCA, 0x73, 0xAF, 0xFC, 0xAA, 0x77, 0x77, 0x75, 0xAA, 0x75, 0xAC, 0xA7, 0x49, 0xD7,
+    0x5D, 0x97, 0x4D, 0xA7, 0x4A, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xAF, 0xA7, 0x9F, 0xF6,
+    0xAF, 0xA9, 0x9A, 0xA5, 0x9E, 0xA7, 0x3E, 0x97, 0x3A, 0xDA, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xAD,
+    0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4F, 0x74, 0xFC, 0xA9, 0x9A, 0xA6, 0x9F, 0xFC, 0x96, 0xAF, 0xFC,
+    0x70, 0xAF, 0xD9, 0x77, 0x50, 0x77, 0x09, 0xA7, 0x77, 0xE7, 0x75, 0xAF, 0x77, 0x39, 0xD9, 0xAD,
+    0x97, 0x71, 0xD3, 0xAC, 0x97, 0x7D, 0x59, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x29, 0xAF, 0xCA, 0x97, 0x59, 0xFF, 0xDA, 0x73, 0x9F, 0xFF, 0x73, 0xAF, 0xCA, 0x99, 0x99,
+    0x9A, 0xA7, 0x2F, 0xCA, 0x77, 0x2F, 0xC7, 0x73, 0xFC, 0x77, 0x3A, 0xEA, 0x77, 0x39, 0xF7, 0x74,
+    0xF7, 0x74, 0x9E, 0xA7, 0x74, 0xF7, 0x74, 0x9E, 0xA7, 0x74, 0xAE, 0x97, 0x74, 0xF9, 0x77, 0x4F,
+    0xA7, 0x73, 0x9F, 0xC7, 0x73, 0x9F, 0xD7, 0x19, 0x79, 0xFF, 0xA9, 0x99, 0x9A, 0xE7, 0x9F, 0xFF,
+    0xFA, 0x70, 0xFF, 0xFF, 0x97, 0x0A, 0xFF, 0xFE, 0x72, 0xFF, 0xFE, 0x72, 0x9F, 0xFF, 0xCA, 0x74,
+    0xAF, 0xFC, 0xAA, 0x77, 0x77, 0x10, 0x71, 0x9C, 0xA7, 0x7E, 0x97, 0x5A, 0xFA, 0x73, 0x9D, 0x90,
+    0xAC, 0xA7, 0x2D, 0x4D, 0x70, 0x9A, 0x69, 0xA7, 0x77, 0x77, 0x59, 0xAF, 0xA7, 0x19, 0xFF, 0x70,
+    0xAF, 0xA9, 0x9A, 0xA7, 0x9E, 0xA7, 0x5E, 0x97, 0x5A, 0xDA, 0x76, 0xE7, 0x69, 0xDA, 0x76, 0xAD,
+    0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6F, 0x76, 0xFC, 0xA9, 0x9A, 0xA7, 0x09, 0xFF, 0xC9, 0x70, 0xAF,
+    0xFC, 0x72, 0xAF, 0xD9, 0x77, 0x71, 0x77, 0x09, 0xE7, 0x74, 0xAE, 0x77, 0x4F, 0x77, 0x3A, 0xEA,
+    0x77, 0x3F, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAF, 0xCA,
+    0x97, 0x49, 0xFF, 0xDA, 0x72, 0x9F, 0xFF, 0x72, 0xAF, 0xCA, 0x99, 0x99, 0x9A, 0xA7, 0x1F, 0xCA,
+    0x77, 0x1F, 0xC7, 0x72, 0xFC, 0x77, 0x2A, 0xEA, 0x77, 0x29, 0xF7, 0x73, 0xF7, 0x73, 0x9E, 0xA7,
+    0x73, 0xF7, 0x73, 0x9E, 0xA7, 0x73, 0xAE, 0x97, 0x73, 0xF9, 0x77, 0x3F, 0xA7, 0x72, 0x9F, 0xC7,
+    0x72, 0x9F, 0xD7, 0x19, 0x69, 0xFF, 0xA9, 0x99, 0x9A, 0xE6, 0x9F, 0xFF, 0xFA, 0x7F, 0xFF, 0xF9,
+    0x7A, 0xFF, 0xFE, 0x71, 0xFF, 0xFE, 0x71, 0x9F, 0xFF, 0xCA, 0x73, 0xAF, 0xFC, 0xAA, 0x77, 0x77,
+    0x72, 0xAD, 0x72, 0x9E, 0x72, 0xF7, 0x19, 0xF7, 0x1F, 0xC7, 0x77, 0x77, 0x77, 0x73, 0x9A, 0xFA,
+    0x59, 0xFF, 0x4A, 0xFA, 0x99, 0xAA, 0x39, 0xEA, 0x71, 0xE9, 0x71, 0xAD, 0xA7, 0x2E, 0x72, 0x9D,
+    0xA7, 0x2A, 0xD9, 0x72, 0xE9, 0x72, 0xE9, 0x72, 0xF7, 0x2F, 0xCA, 0x99, 0xAA, 0x49, 0xFF, 0xC9,
+    0x4A, 0xFF, 0xC6, 0xAF, 0xD9, 0x77, 0x10, 0x73, 0x99, 0x7A, 0x76, 0xD4, 0xAC, 0x97, 0x69, 0xD1,
+    0x9D, 0x77, 0x1A, 0xFC, 0x77, 0x3E, 0xA7, 0x74, 0x9D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xAF, 0xCA, 0x97, 0x49, 0xFF, 0xDA, 0x72, 0x9F, 0xFF, 0x72,
+    0xAF, 0xCA, 0x99, 0x99, 0x9A, 0xA7, 0x1F, 0xCA, 0x77, 0x1F, 0xC7, 0x72, 0xFC, 0x77, 0x2A, 0xEA,
+    0x77, 0x29, 0xF7, 0x73, 0xF7, 0x73, 0x9E, 0xA7, 0x73, 0xF7, 0x73, 0x9E, 0xA7, 0x73, 0xAE, 0x97,
+    0x73, 0xF9, 0x77, 0x3F, 0xA7, 0x72, 0x9F, 0xC7, 0x72, 0x9F, 0xD7, 0x19, 0x69, 0xFF, 0xA9, 0x99,
+    0x9A, 0xE6, 0x9F, 0xFF, 0xFA, 0x7F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFE, 0x71, 0xFF, 0xFE, 0x71, 0x9F,
+    0xFF, 0xCA, 0x73, 0xAF, 0xFC, 0xAA, 0x77, 0x77, 0x5C, 0x95, 0x9C, 0x95, 0xAC, 0xA2, 0x9D, 0x70,
+    0xE0, 0xAC, 0xA7, 0x2F, 0xA7, 0x39, 0xDA, 0x75, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAF,
+    0xA7, 0x9F, 0xF6, 0xAF, 0xA9, 0x9A, 0xA5, 0x9E, 0xA7, 0x3E, 0x97, 0x3A, 0xDA, 0x74, 0xE7, 0x49,
+    0xDA, 0x74, 0xAD, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4F, 0x74, 0xFC, 0xA9, 0x9A, 0xA6, 0x9F, 0xFC,
+    0x96, 0xAF, 0xFC, 0x70, 0xAF, 0xD9, 0x77, 0x50, 0x77, 0x77, 0x3A, 0xC9, 0x49, 0xCA, 0x76, 0xD9,
+    0x2D, 0x97, 0x70, 0xDA, 0xAD, 0x77, 0x29, 0xEA, 0x77, 0x4E, 0x77, 0x59, 0xA7, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x73, 0xFF, 0xAA, 0x97, 0x49, 0xFF, 0xFA, 0x72, 0xAF, 0xFF, 0xD7, 0x1F, 0xFF,
+    0xF7, 0x9E, 0x69, 0xFC, 0xA6, 0xAE, 0x70, 0xAF, 0x6E, 0xA7, 0x1A, 0xEA, 0x5E, 0x97, 0x2F, 0x49,
+    0xE7, 0x3F, 0x4A, 0xE7, 0x3F, 0x4E, 0xA7, 0x3F, 0x4E, 0x97, 0x3F, 0x39, 0xE7, 0x4F, 0x3A, 0xE7,
+    0x39, 0xF3, 0xEA, 0x73, 0xAE, 0xA3, 0xE9, 0x73, 0xF9, 0x29, 0xE7, 0x3F, 0xC3, 0xAE, 0x71, 0x9F,
+    0xCA, 0x3E, 0xA9, 0x99, 0x99, 0x99, 0xAF, 0xF4, 0xFF, 0xFF, 0xE9, 0x39, 0xFF, 0xFF, 0xDA, 0x4F,
+    0xFF, 0xFD, 0xA5, 0xFF, 0xFF, 0xC9, 0x59, 0xFF, 0xFE, 0x97, 0xAF, 0xFD, 0xAA, 0x97, 0x20, 0x77,
+    0x3D, 0x97, 0x77, 0x9D, 0x77, 0x70, 0xE2, 0xDA, 0x77, 0x2D, 0xA2, 0xD7, 0x72, 0x9D, 0x2A, 0xD7,
+    0x72, 0xE2, 0xDA, 0x77, 0x2D, 0xA1, 0x9D, 0x97, 0x71, 0x9D, 0x91, 0xAD, 0x72, 0x9F, 0x91, 0xAD,
+    0x2A, 0xA9, 0x71, 0xFE, 0xA0, 0xDA, 0x75, 0x9F, 0xFC, 0xAD, 0x97, 0x49, 0xE9, 0x2A, 0xFC, 0x75,
+    0xDA, 0x5F, 0xC7, 0x4E, 0x6F, 0x97, 0x3A, 0xD7, 0xF7, 0x4D, 0xA7, 0xF7, 0x39, 0xD9, 0x7E, 0xA7,
+    0x3A, 0xD7, 0xAE, 0x97, 0x3E, 0x69, 0xF7, 0x4E, 0xA4, 0x9F, 0xC7, 0x4F, 0xFF, 0xDA, 0x74, 0xAF,
+    0xFF, 0xC9, 0x75, 0xFF, 0xFC, 0x76, 0x9F, 0xFA, 0xE7, 0x70, 0xAF, 0xA1, 0xDA, 0x77, 0x77, 0x70,
+    0x7F, 0xFA, 0xA9, 0x75, 0x9F, 0xFF, 0xA7, 0x3A, 0xFF, 0xFD, 0x72, 0xFF, 0xFF, 0x70, 0x9E, 0x69,
+    0xFD, 0x7A, 0xE7, 0x0A, 0xF9, 0x6E, 0xA7, 0x1A, 0xEA, 0x6E, 0x97, 0x2F, 0x59, 0xE7, 0x3F, 0x5A,
+    0xE7, 0x3F, 0x5E, 0xA7, 0x3F, 0x1F, 0xFF, 0xA6, 0xF0, 0xAF, 0xFF, 0x96, 0xF0, 0xFF, 0xFC, 0x69,
+    0xF4, 0xEA, 0x73, 0xAE, 0xA4, 0xE9, 0x73, 0xF9, 0x39, 0xE7, 0x3F, 0xC4, 0xAD, 0xA7, 0x1A, 0xFC,
+    0xA4, 0xEA, 0x99, 0x99, 0x99, 0x9A, 0xFF, 0x49, 0xFF, 0xFF, 0xE9, 0x4A, 0xFF, 0xFF, 0xDA, 0x5F,
+    0xFF, 0xFD, 0xA6, 0xFF, 0xFF, 0xC7, 0x9F, 0xFF, 0xE9, 0x70, 0xAF, 0xFD, 0xAA, 0x97, 0x20, 0x77,
+    0x3D, 0x97, 0x76, 0x9D, 0x77, 0x7A, 0xD7, 0x77, 0xDA, 0x77, 0x1A, 0xFF, 0xF7, 0x5F, 0xFF, 0xC7,
+    0x49, 0xFF, 0xFA, 0x77, 0x19, 0xD9, 0x76, 0x9F, 0x91, 0xAD, 0x76, 0xFE, 0xA0, 0xE7, 0x49, 0xFF,
+    0xC9, 0xD9, 0x73, 0x9E, 0x92, 0xAF, 0xC7, 0x4D, 0xA5, 0xFC, 0x73, 0xE6, 0xFA, 0x72, 0xAD, 0x7F,
+    0x73, 0xDA, 0x7F, 0x72, 0x9D, 0x97, 0xEA, 0x72, 0xAD, 0x7A, 0xE9, 0x72, 0xE6, 0x9F, 0x73, 0xEA,
+    0x49, 0xFC, 0x73, 0xFF, 0xFD, 0xA7, 0x3A, 0xFF, 0xFC, 0x97, 0x4F, 0xFF, 0xC7, 0x59, 0xFF, 0xAE,
+    0x77, 0xAF, 0xA1, 0xDA, 0x77, 0x77, 0x50, 0x77, 0x49, 0x73, 0xAA, 0xFF, 0xCA, 0x71, 0xAF, 0xFF,
+    0x71, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x99, 0x99, 0x97, 0xAF, 0xFF, 0xD7, 0xFF,
+    0xFD, 0x97, 0xFF, 0xFC, 0xA7, 0x9E, 0x97, 0x71, 0xE9, 0x77, 0x2E, 0x77, 0x29, 0xE7, 0x72, 0xAD,
+    0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE9, 0x99, 0x99, 0xAA, 0xA7, 0x2A, 0xFF, 0xE7, 0x2F, 0xFE, 0xA7,
+    0x2F, 0xFE, 0x97, 0x19, 0xE9, 0x77, 0x1E, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xAE, 0x77,
+    0x2E, 0xA7, 0x71, 0x9F, 0xFF, 0xD9, 0x6A, 0xFF, 0xFD, 0x96, 0xFF, 0xFE, 0x96, 0xFF, 0xFE, 0x95,
+    0xAF, 0xFF, 0xE6, 0x77, 0x99, 0x97, 0x0F, 0xFE, 0xA6, 0xFF, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x9A, 0xEA, 0x73, 0x9F, 0xF7, 0x1A, 0xE9, 0x3D, 0x79, 0xDA, 0x59, 0xC9, 0x59,
+    0xD9, 0x7D, 0x5D, 0xA3, 0x99, 0xAA, 0xE4, 0xAF, 0xFF, 0xD4, 0xFF, 0xFD, 0xA3, 0x9D, 0xA9, 0x99,
+    0x97, 0x3A, 0xD7, 0x70, 0xE7, 0x70, 0xEA, 0x77, 0xAF, 0x95, 0x9A, 0x59, 0xFF, 0xFA, 0x6F, 0xFF,
+    0x97, 0xFF, 0xE7, 0x19, 0xAF, 0xCA, 0x96, 0x72, 0xAC, 0x7C, 0xA7, 0x2D, 0x95, 0xAC, 0x73, 0xAD,
+    0x92, 0x9D, 0xA7, 0x39, 0xFF, 0xC7, 0x5A, 0xFD, 0xA7, 0x79, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x29, 0x99, 0x97, 0xAF, 0xFF, 0xD7, 0xFF, 0xFD, 0x97, 0xFF, 0xFC, 0xA7, 0x9E,
+    0x97, 0x71, 0xE9, 0x77, 0x2E, 0x77, 0x29, 0xE7, 0x72, 0xAD, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE9,
+    0x99, 0x99, 0xAA, 0xA7, 0x2A, 0xFF, 0xE7, 0x2F, 0xFE, 0xA7, 0x2F, 0xFE, 0x97, 0x19, 0xE9, 0x77,
+    0x1E, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9F, 0xFF, 0xD9,
+    0x6A, 0xFF, 0xFD, 0x96, 0xFF, 0xFE, 0x96, 0xFF, 0xFE, 0x95, 0xAF, 0xFF, 0xE6, 0x7A, 0xA7, 0xA9,
+    0x7D, 0x6A, 0xC7, 0x0D, 0xA4, 0xAC, 0xA7, 0x0A, 0xFF, 0xC7, 0x2F, 0xEA, 0x74, 0xAE, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAE, 0xA7, 0x39, 0xFF, 0x71, 0xAE, 0x93,
+    0xD7, 0x9D, 0xA5, 0x9C, 0x95, 0x9D, 0x97, 0xD5, 0xDA, 0x39, 0x9A, 0xAE, 0x4A, 0xFF, 0xFD, 0x4F,
+    0xFF, 0xDA, 0x39, 0xDA, 0x99, 0x99, 0x73, 0xAD, 0x77, 0x0E, 0x77, 0x0E, 0xA7, 0x7A, 0xF9, 0x59,
+    0xA5, 0x9F, 0xFF, 0xA6, 0xFF, 0xF9, 0x7F, 0xFE, 0x71, 0x9A, 0xFC, 0xA9, 0x60, 0x77, 0xE7, 0x72,
+    0xAE, 0x77, 0x2F, 0x77, 0x1A, 0xF7, 0x71, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09,
+    0x99, 0x99, 0x7A, 0xFF, 0xFD, 0x7F, 0xFF, 0xD9, 0x7F, 0xFF, 0xCA, 0x79, 0xE9, 0x77, 0x1E, 0x97,
+    0x72, 0xE7, 0x72, 0x9E, 0x77, 0x2A, 0xDA, 0x77, 0x2E, 0x97, 0x71, 0x9E, 0x99, 0x99, 0x9A, 0xAA,
+    0x72, 0xAF, 0xFE, 0x72, 0xFF, 0xEA, 0x72, 0xFF, 0xE9, 0x71, 0x9E, 0x97, 0x71, 0xEA, 0x77, 0x2E,
+    0x97, 0x71, 0x9E, 0x77, 0x2A, 0xE7, 0x72, 0xEA, 0x77, 0x19, 0xFF, 0xFD, 0x96, 0xAF, 0xFF, 0xD9,
+    0x6F, 0xFF, 0xE9, 0x6F, 0xFF, 0xE9, 0x5A, 0xFF, 0xFE, 0x60, 0x73, 0x9E, 0x75, 0xF7, 0x49, 0xEA,
+    0x74, 0xFA, 0x74, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xAE, 0xA7, 0x19, 0xFF,
+    0x7A, 0xE9, 0x3D, 0x59, 0xDA, 0x59, 0xC9, 0x39, 0xD9, 0x7D, 0x3D, 0xA3, 0x99, 0xAA, 0xE2, 0xAF,
+    0xFF, 0xD2, 0xFF, 0xFD, 0xA1, 0x9D, 0xA9, 0x99, 0x97, 0x1A, 0xD7, 0x6E, 0x76, 0xEA, 0x75, 0xAF,
+    0x95, 0x9A, 0x39, 0xFF, 0xFA, 0x4F, 0xFF, 0x95, 0xFF, 0xE7, 0x9A, 0xFC, 0xA9, 0x40, 0x77, 0x19,
+    0x99, 0x97, 0xAF, 0xFF, 0xD7, 0xFF, 0xFD, 0x97, 0xFF, 0xFC, 0xA7, 0x9E, 0x97, 0x71, 0xE9, 0x77,
+    0x2E, 0x77, 0x29, 0xE7, 0x72, 0xAD, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE9, 0x99, 0x99, 0xAA, 0xA7,
+    0x2A, 0xFF, 0xE7, 0x2F, 0xFE, 0xA7, 0x2F, 0xFE, 0x97, 0x19, 0xE9, 0x77, 0x1E, 0xA7, 0x72, 0xE9,
+    0x77, 0x19, 0xE7, 0x72, 0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9F, 0xFF, 0xD9, 0x6A, 0xFF, 0xFD, 0x96,
+    0xFF, 0xFE, 0x96, 0xFF, 0xFE, 0x95, 0xAF, 0xFF, 0xE7, 0x4A, 0xC9, 0x77, 0x2A, 0xC7, 0x74, 0xC9,
+    0x77, 0x4F, 0x97, 0x72, 0xAD, 0x97, 0x77, 0x73, 0x79, 0xAE, 0xA7, 0x19, 0xFF, 0x7A, 0xE9, 0x3D,
+    0x59, 0xDA, 0x59, 0xC9, 0x39, 0xD9, 0x7D, 0x3D, 0xA3, 0x99, 0xAA, 0xE2, 0xAF, 0xFF, 0xD2, 0xFF,
+    0xFD, 0xA1, 0x9D, 0xA9, 0x99, 0x97, 0x1A, 0xD7, 0x6E, 0x76, 0xEA, 0x75, 0xAF, 0x95, 0x9A, 0x39,
+    0xFF, 0xFA, 0x4F, 0xFF, 0x95, 0xFF, 0xE7, 0x9A, 0xFC, 0xA9, 0x72, 0xAC, 0x97, 0x5D, 0x76, 0xD7,
+    0x6A, 0xC7, 0x7D, 0x77, 0xAF, 0x75, 0x9A, 0xD7, 0x10, 0x71, 0x9C, 0x95, 0x9C, 0x97, 0x3A, 0xCA,
+    0x29, 0xD7, 0x6D, 0xA0, 0xAC, 0xA7, 0x70, 0xF9, 0x77, 0x1A, 0xD9, 0x77, 0x3C, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x74, 0x99, 0x99, 0x7A, 0xFF, 0xFD, 0x7F, 0xFF, 0xD9, 0x7F, 0xFF, 0xCA,
+    0x79, 0xE9, 0x77, 0x1E, 0x97, 0x72, 0xE7, 0x72, 0x9E, 0x77, 0x2A, 0xDA, 0x77, 0x2E, 0x97, 0x71,
+    0x9E, 0x99, 0x99, 0x9A, 0xAA, 0x72, 0xAF, 0xFE, 0x72, 0xFF, 0xEA, 0x72, 0xFF, 0xE9, 0x71, 0x9E,
+    0x97, 0x71, 0xEA, 0x77, 0x2E, 0x97, 0x71, 0x9E, 0x77, 0x2A, 0xE7, 0x72, 0xEA, 0x77, 0x19, 0xFF,
+    0xFD, 0x96, 0xAF, 0xFF, 0xD9, 0x6F, 0xFF, 0xE9, 0x6F, 0xFF, 0xE9, 0x5A, 0xFF, 0xFE, 0x60, 0x77,
+    0x71, 0x9C, 0x94, 0x9C, 0xA7, 0x0A, 0xCA, 0x2A, 0xC9, 0x72, 0xEA, 0xD9, 0x74, 0xF7, 0x6A, 0xD7,
+    0x70, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xEA, 0x72, 0x9F, 0xF7, 0x0A,
+    0xE9, 0x3D, 0x69, 0xDA, 0x59, 0xC9, 0x49, 0xD9, 0x7D, 0x4D, 0xA3, 0x99, 0xAA, 0xE3, 0xAF, 0xFF,
+    0xD3, 0xFF, 0xFD, 0xA2, 0x9D, 0xA9, 0x99, 0x97, 0x2A, 0xD7, 0x7E, 0x77, 0xEA, 0x76, 0xAF, 0x95,
+    0x9A, 0x49, 0xFF, 0xFA, 0x5F, 0xFF, 0x96, 0xFF, 0xE7, 0x09, 0xAF, 0xCA, 0x95, 0x77, 0x1A, 0x97,
+    0x76, 0x9D, 0x97, 0x75, 0xF9, 0x77, 0x3E, 0x9D, 0xA7, 0x71, 0xAC, 0xA2, 0x9D, 0x77, 0x9C, 0xA5,
+    0xAC, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAA, 0xFE, 0xA9, 0x72, 0x9F, 0xFF, 0xD7, 0x1F,
+    0xFC, 0xAA, 0xAA, 0xE7, 0x0F, 0xD9, 0x70, 0x97, 0xFC, 0x97, 0x72, 0xAF, 0x77, 0x4F, 0x97, 0x73,
+    0xAE, 0xA7, 0x74, 0xF7, 0x74, 0xAE, 0xA7, 0x74, 0xF9, 0x77, 0x4F, 0x77, 0x49, 0xEA, 0x7A, 0x99,
+    0x97, 0x0A, 0xE9, 0x7F, 0xFA, 0x3F, 0x97, 0xFF, 0xC3, 0xF7, 0x29, 0xAF, 0xC3, 0xF7, 0x4D, 0xA9,
+    0x93, 0xF9, 0x72, 0xAD, 0x95, 0xFC, 0x72, 0xE9, 0x5F, 0xDA, 0xA9, 0x99, 0x99, 0xAF, 0xC6, 0xFF,
+    0xFF, 0xE6, 0xAF, 0xFF, 0xFC, 0xA7, 0xFF, 0xFF, 0xCA, 0x70, 0xAF, 0xFF, 0xD9, 0x73, 0x9A, 0xFE,
+    0xA9, 0x70, 0x74, 0xAC, 0x97, 0x72, 0xE9, 0x77, 0x0A, 0xF9, 0x76, 0x9D, 0x1A, 0xCA, 0x75, 0xD3,
+    0x9D, 0x73, 0xAA, 0x69, 0xA7, 0x77, 0x77, 0x75, 0xAE, 0xA2, 0x9A, 0xA7, 0x09, 0xFE, 0x90, 0xE7,
+    0x9F, 0xFF, 0x96, 0x9E, 0x92, 0xFD, 0x7E, 0x5F, 0xC6, 0xAD, 0x6F, 0x96, 0xD9, 0x6F, 0x69, 0xD7,
+    0xF6, 0xAC, 0xA6, 0x9E, 0xA6, 0xD9, 0x6F, 0x7D, 0xA5, 0xFC, 0x7E, 0xAA, 0xAA, 0xFD, 0xA7, 0xAF,
+    0xFF, 0x71, 0xFF, 0xF7, 0x1A, 0xFE, 0xAD, 0xA7, 0x29, 0xEA, 0x90, 0xE7, 0x71, 0xEA, 0x77, 0x0F,
+    0x71, 0xC9, 0x29, 0xAF, 0xA7, 0x0A, 0xFF, 0xE7, 0x1F, 0xFE, 0x71, 0x9F, 0xFD, 0x74, 0x9A, 0xFA,
+    0x97, 0x77, 0x71, 0x75, 0xA9, 0x69, 0xA7, 0x59, 0xCA, 0x6C, 0xA7, 0x59, 0xD9, 0x39, 0xD9, 0x76,
+    0xFF, 0xC9, 0x77, 0x9F, 0xE9, 0x77, 0x19, 0xAE, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x72, 0x9A, 0xAF, 0xEA, 0x97, 0x29, 0xFF, 0xFD, 0x71, 0xFF, 0xCA, 0xAA, 0xAE, 0x70, 0xFD,
+    0x97, 0x09, 0x7F, 0xC9, 0x77, 0x2A, 0xF7, 0x74, 0xF9, 0x77, 0x3A, 0xEA, 0x77, 0x4F, 0x77, 0x4A,
+    0xEA, 0x77, 0x4F, 0x97, 0x74, 0xF7, 0x74, 0x9E, 0xA7, 0xA9, 0x99, 0x70, 0xAE, 0x97, 0xFF, 0xA3,
+    0xF9, 0x7F, 0xFC, 0x3F, 0x72, 0x9A, 0xFC, 0x3F, 0x74, 0xDA, 0x99, 0x3F, 0x97, 0x2A, 0xD9, 0x5F,
+    0xC7, 0x2E, 0x95, 0xFD, 0xAA, 0x99, 0x99, 0x9A, 0xFC, 0x6F, 0xFF, 0xFE, 0x6A, 0xFF, 0xFF, 0xCA,
+    0x7F, 0xFF, 0xFC, 0xA7, 0x0A, 0xFF, 0xFD, 0x97, 0x39, 0xAF, 0xEA, 0x97, 0x00, 0x70, 0xD7, 0xCA,
+    0x70, 0xD9, 0x5A, 0xC7, 0x1E, 0x39, 0xDA, 0x71, 0x9F, 0xFC, 0x73, 0xAF, 0xDA, 0x75, 0x9A, 0xAA,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAE, 0xA2, 0x9A, 0xA7, 0x9F, 0xE9, 0x0E, 0x69, 0xFF,
+    0xF9, 0x59, 0xE9, 0x2F, 0xD6, 0xE5, 0xFC, 0x5A, 0xD6, 0xF9, 0x5D, 0x96, 0xF5, 0x9D, 0x7F, 0x5A,
+    0xCA, 0x69, 0xEA, 0x5D, 0x96, 0xF6, 0xDA, 0x5F, 0xC6, 0xEA, 0xAA, 0xAF, 0xDA, 0x6A, 0xFF, 0xF7,
+    0x0F, 0xFF, 0x70, 0xAF, 0xEA, 0xDA, 0x71, 0x9E, 0xA9, 0x0E, 0x77, 0x0E, 0xA7, 0x7F, 0x70, 0xC9,
+    0x29, 0xAF, 0xA7, 0xAF, 0xFE, 0x70, 0xFF, 0xE7, 0x09, 0xFF, 0xD7, 0x39, 0xAF, 0xA9, 0x77, 0x77,
+    0x77, 0x1A, 0xDA, 0x77, 0x4E, 0x97, 0x73, 0xAE, 0x97, 0x73, 0xF7, 0x73, 0x9F, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x39, 0xAA, 0xFE, 0xA9, 0x71, 0x9F, 0xFF, 0xD7, 0x0F, 0xFC, 0xAA, 0xAA,
+    0xE7, 0xFD, 0x97, 0x09, 0x6F, 0xC9, 0x77, 0x1A, 0xF7, 0x73, 0xF9, 0x77, 0x2A, 0xEA, 0x77, 0x3F,
+    0x77, 0x3A, 0xEA, 0x77, 0x3F, 0x97, 0x73, 0xF7, 0x73, 0x9E, 0xA7, 0xA9, 0x99, 0x7A, 0xE9, 0x7F,
+    0xFA, 0x2F, 0x97, 0xFF, 0xC2, 0xF7, 0x29, 0xAF, 0xC2, 0xF7, 0x4D, 0xA9, 0x92, 0xF9, 0x72, 0xAD,
+    0x94, 0xFC, 0x72, 0xE9, 0x4F, 0xDA, 0xA9, 0x99, 0x99, 0xAF, 0xC5, 0xFF, 0xFF, 0xE5, 0xAF, 0xFF,
+    0xFC, 0xA6, 0xFF, 0xFF, 0xCA, 0x7A, 0xFF, 0xFD, 0x97, 0x29, 0xAF, 0xEA, 0x97, 0x75, 0xE7, 0x70,
+    0xAE, 0x77, 0x0F, 0x77, 0xAE, 0xA7, 0x7F, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0xAE, 0xA2,
+    0x9A, 0xA7, 0x9F, 0xE9, 0x0E, 0x69, 0xFF, 0xF9, 0x59, 0xE9, 0x2F, 0xD6, 0xE5, 0xFC, 0x5A, 0xD6,
+    0xF9, 0x5D, 0x96, 0xF5, 0x9D, 0x7F, 0x5A, 0xCA, 0x69, 0xEA, 0x5D, 0x96, 0xF6, 0xDA, 0x5F, 0xC6,
+    0xEA, 0xAA, 0xAF, 0xDA, 0x6A, 0xFF, 0xF7, 0x0F, 0xFF, 0x70, 0xAF, 0xEA, 0xDA, 0x71, 0x9E, 0xA9,
+    0x0E, 0x77, 0x0E, 0xA7, 0x7F, 0x70, 0xC9, 0x29, 0xAF, 0xA7, 0xAF, 0xFE, 0x70, 0xFF, 0xE7, 0x09,
+    0xFF, 0xD7, 0x39, 0xAF, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x49, 0xAA, 0xFE, 0xA9, 0x71, 0x9F, 0xFF,
+    0xD7, 0x0F, 0xFC, 0xAA, 0xAA, 0xE7, 0xFD, 0x97, 0x09, 0x6F, 0xC9, 0x77, 0x1A, 0xF7, 0x73, 0xF9,
+    0x77, 0x2A, 0xEA, 0x77, 0x3F, 0x77, 0x3A, 0xEA, 0x77, 0x3F, 0x97, 0x73, 0xF7, 0x73, 0x9E, 0xA7,
+    0xA9, 0x99, 0x7A, 0xE9, 0x7F, 0xFA, 0x2F, 0x97, 0xFF, 0xC2, 0xF7, 0x29, 0xAF, 0xC2, 0xF7, 0x4D,
+    0xA9, 0x92, 0xF9, 0x72, 0xAD, 0x94, 0xFC, 0x72, 0xE9, 0x4F, 0xDA, 0xA9, 0x99, 0x99, 0xAF, 0xC5,
+    0xFF, 0xFF, 0xE5, 0xAF, 0xFF, 0xFC, 0xA6, 0xFF, 0xFF, 0xCA, 0x7A, 0xFF, 0xFD, 0x97, 0x29, 0xAF,
+    0xEA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xFA, 0x77, 0x2A, 0xF7, 0x73, 0xFA, 0x77,
+    0x29, 0xF7, 0x73, 0xAE, 0x97, 0x73, 0xF7, 0x73, 0xF9, 0x77, 0x29, 0xF7, 0x77, 0x74, 0x77, 0x77,
+    0x29, 0xF9, 0x76, 0xFC, 0x77, 0xF9, 0x76, 0xAE, 0xA7, 0x7F, 0x77, 0xAE, 0xA7, 0x69, 0xF7, 0x7A,
+    0xE9, 0x77, 0x77, 0x77, 0x7A, 0xEA, 0x29, 0xAA, 0x79, 0xFE, 0x90, 0xE6, 0x9F, 0xFF, 0x95, 0x9E,
+    0x92, 0xFD, 0x6E, 0x5F, 0xC5, 0xAD, 0x6F, 0x95, 0xD9, 0x6F, 0x59, 0xD7, 0xF5, 0xAC, 0xA6, 0x9E,
+    0xA5, 0xD9, 0x6F, 0x6D, 0xA5, 0xFC, 0x6E, 0xAA, 0xAA, 0xFD, 0xA6, 0xAF, 0xFF, 0x70, 0xFF, 0xF7,
+    0x0A, 0xFE, 0xAD, 0xA7, 0x19, 0xEA, 0x90, 0xE7, 0x70, 0xEA, 0x77, 0xF7, 0x0C, 0x92, 0x9A, 0xFA,
+    0x7A, 0xFF, 0xE7, 0x0F, 0xFE, 0x70, 0x9F, 0xFD, 0x73, 0x9A, 0xFA, 0x97, 0x77, 0x70, 0x75, 0xD7,
+    0x77, 0xAD, 0xA7, 0x76, 0xFC, 0x77, 0x4D, 0xA0, 0x9D, 0x77, 0x2A, 0xC9, 0x3A, 0xC9, 0x77, 0x0A,
+    0x96, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAA, 0xA7, 0x29, 0xAA, 0xA7, 0xEA, 0x72, 0xAE, 0x7E,
+    0xA7, 0x2E, 0xA6, 0x9E, 0x97, 0x19, 0xE9, 0x6A, 0xE7, 0x2A, 0xE7, 0xF7, 0x2F, 0x7E, 0xA7, 0x2E,
+    0xA6, 0xAE, 0x97, 0x1A, 0xE9, 0x6F, 0x72, 0xF7, 0xF7, 0x2F, 0x69, 0xEA, 0x71, 0x9E, 0xA6, 0xAE,
+    0x97, 0x1A, 0xEA, 0x6F, 0x72, 0xF9, 0x59, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xF6, 0xAF, 0xFF,
+    0xFE, 0x6F, 0xFF, 0xFE, 0xA6, 0xFF, 0xFF, 0xE9, 0x59, 0xFF, 0xFF, 0xE6, 0xFF, 0xFF, 0xF6, 0xFA,
+    0x71, 0xFA, 0x59, 0xF9, 0x70, 0x9F, 0x95, 0xAF, 0x71, 0xAF, 0x95, 0xFC, 0x71, 0xFC, 0x6F, 0xA7,
+    0x09, 0xFC, 0x5A, 0xF9, 0x70, 0xAF, 0xA5, 0x70, 0x9C, 0xA7, 0x7E, 0x97, 0x59, 0xFA, 0x73, 0x9D,
+    0x90, 0xAD, 0x72, 0xD4, 0xD7, 0x09, 0xA6, 0x9A, 0x71, 0x9D, 0x77, 0xE7, 0x7D, 0xA7, 0x69, 0xD7,
+    0x7E, 0x77, 0xDA, 0x76, 0x9D, 0x77, 0xE7, 0x7D, 0xA7, 0x69, 0xD0, 0x9A, 0xF9, 0x7E, 0xAF, 0xF6,
+    0xFF, 0xF9, 0x49, 0xFA, 0x92, 0xE9, 0x4F, 0x94, 0x9D, 0xA4, 0xEA, 0x6D, 0x93, 0x9E, 0x69, 0xD9,
+    0x3E, 0xA6, 0x9D, 0x4E, 0x7E, 0x39, 0xE7, 0xDA, 0x3E, 0xA6, 0x9D, 0x93, 0xE9, 0x6E, 0x92, 0xAE,
+    0x7E, 0x3F, 0x6A, 0xE3, 0xF6, 0xEA, 0x2A, 0xEA, 0x59, 0xE9, 0x20, 0x69, 0xE7, 0x29, 0xE7, 0xEA,
+    0x72, 0xEA, 0x7E, 0x97, 0x2E, 0xA6, 0x9E, 0x72, 0x9E, 0x96, 0xAE, 0x72, 0xAE, 0x7F, 0x72, 0xF6,
+    0x9E, 0xA7, 0x19, 0xEA, 0x6A, 0xE9, 0x71, 0xAE, 0x94, 0xFF, 0xFF, 0xFD, 0x93, 0xFF, 0xFF, 0xFD,
+    0x4A, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0xA5, 0xF9, 0x71, 0xF9, 0x6F, 0x72, 0xF6, 0x9F,
+    0xFF, 0xFE, 0x6A, 0xFF, 0xFF, 0xDA, 0x6F, 0xFF, 0xFE, 0xA5, 0x9F, 0xFF, 0xFE, 0x95, 0xAF, 0xFF,
+    0xFE, 0x6F, 0xC9, 0x99, 0x99, 0x99, 0x99, 0xAF, 0xC5, 0x9F, 0x97, 0x09, 0xFA, 0x5A, 0xF7, 0x1A,
+    0xF9, 0x5F, 0xC7, 0x1F, 0xC6, 0xFA, 0x70, 0x9F, 0xC5, 0xAF, 0x97, 0x0A, 0xFA, 0x50, 0x79, 0xD7,
+    0x7E, 0x77, 0xDA, 0x76, 0x9D, 0xA9, 0xAA, 0xE6, 0x9F, 0xFE, 0x6A, 0xFA, 0x99, 0x97, 0x29, 0xD7,
+    0x7E, 0x77, 0xDA, 0x76, 0x9D, 0x09, 0xAF, 0x97, 0xEA, 0xFF, 0x6F, 0xFF, 0x94, 0x9F, 0xA9, 0x2E,
+    0x94, 0xF9, 0x49, 0xDA, 0x4E, 0xA6, 0xD9, 0x39, 0xE6, 0x9D, 0x93, 0xEA, 0x69, 0xD4, 0xE7, 0xE3,
+    0x9E, 0x7D, 0xA3, 0xEA, 0x69, 0xD9, 0x3E, 0x96, 0xE9, 0x2A, 0xE7, 0xE3, 0xF6, 0xAE, 0x3F, 0x6E,
+    0xA2, 0xAE, 0xA5, 0x9E, 0x92, 0x79, 0x94, 0x97, 0xF2, 0x9C, 0x6D, 0x90, 0xCA, 0x1D, 0x59, 0xCA,
+    0x1A, 0xF9, 0x5A, 0xC3, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6E, 0xA7, 0x4F, 0x73,
+    0x9E, 0xA7, 0x3A, 0xE9, 0x73, 0xAE, 0x74, 0xF7, 0x4E, 0x97, 0x39, 0xE7, 0x4A, 0xE7, 0x4E, 0xA7,
+    0x4E, 0x97, 0x3A, 0xE7, 0x4F, 0x74, 0xEA, 0x73, 0x9E, 0xA7, 0x3A, 0xE9, 0x73, 0xF7, 0x4F, 0x73,
+    0xAE, 0xA7, 0x3F, 0x97, 0x3F, 0x97, 0x2A, 0xF7, 0x3F, 0xC7, 0x29, 0xFA, 0x72, 0x9A, 0xEA, 0x72,
+    0x39, 0xDA, 0x3C, 0x92, 0x9D, 0xAC, 0x91, 0x9C, 0x3D, 0x1A, 0xC1, 0xD2, 0x9C, 0xA2, 0xF9, 0x29,
+    0xC9, 0x3A, 0xA9, 0x77, 0x77, 0x77, 0x76, 0xAC, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xCA, 0x72,
+    0xD9, 0x72, 0xD7, 0x2A, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xE7, 0x1A, 0xDA,
+    0x71, 0xE9, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0x76, 0x99, 0x59, 0xAF, 0xFD, 0x49, 0xFF, 0xF4, 0x99,
+    0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xEA, 0x75, 0xF7, 0x49, 0xEA, 0x74, 0xAE, 0x97,
+    0x4A, 0xE7, 0x5F, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xAE, 0x75, 0xEA, 0x75, 0xE9, 0x74, 0xAE, 0x75,
+    0xF7, 0x5E, 0xA7, 0x49, 0xEA, 0x74, 0xAE, 0x97, 0x4F, 0x75, 0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x74,
+    0xF9, 0x73, 0xAF, 0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x39, 0xAE, 0xA7, 0x30, 0x71, 0x99, 0x99, 0x29,
+    0xFF, 0xE1, 0x9F, 0xFF, 0x97, 0x77, 0x77, 0x77, 0x70, 0xAC, 0xA7, 0x3D, 0x97, 0x3D, 0x73, 0xAD,
+    0x73, 0xD9, 0x73, 0xD7, 0x39, 0xD7, 0x3D, 0xA7, 0x3D, 0x97, 0x29, 0xD9, 0x72, 0xE7, 0x3E, 0x72,
+    0xAD, 0xA7, 0x2E, 0x97, 0x2E, 0x97, 0x19, 0xE7, 0x20, 0x70, 0xAD, 0xA9, 0x70, 0xAE, 0x97, 0x0F,
+    0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1F, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1F,
+    0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1F, 0x70, 0x9E, 0xA7, 0x0A, 0xE9, 0x70, 0xF9, 0x70,
+    0xF7, 0x09, 0xF7, 0x0F, 0xA7, 0x0F, 0x97, 0xAF, 0x97, 0xFC, 0x70, 0xFC, 0x70, 0xAC, 0x97, 0x1A,
+    0xC9, 0x71, 0xAC, 0x97, 0x2D, 0x73, 0xAF, 0x71, 0x9A, 0xD7, 0x70, 0x9D, 0x97, 0x0E, 0xA7, 0xAE,
+    0x97, 0xF9, 0x69, 0xF7, 0x77, 0x77, 0x77, 0x39, 0x97, 0x2D, 0xA7, 0x1D, 0x97, 0x09, 0xD7, 0x1A,
+    0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x0A, 0xD9, 0x70, 0xE7, 0x1E,
+    0x70, 0xAD, 0xA7, 0x0E, 0xA7, 0x0E, 0x97, 0x9E, 0x70, 0xAC, 0x97, 0x0A, 0xC7, 0x2C, 0xA7, 0x2F,
+    0x97, 0x0A, 0xD9, 0x77, 0x30, 0x71, 0xE9, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1F, 0x70, 0xAF, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x73, 0xEA, 0x71, 0xF7, 0x09, 0xEA, 0x70, 0xAE, 0x97, 0x0A, 0xE7, 0x1F,
+    0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE, 0x71, 0xEA, 0x71, 0xE9, 0x70, 0xAE, 0x71, 0xF7, 0x1E, 0xA7,
+    0x09, 0xEA, 0x70, 0xAE, 0x97, 0x0F, 0x71, 0xF7, 0x0A, 0xEA, 0x70, 0xF9, 0x70, 0xF9, 0x7A, 0xF7,
+    0x0F, 0xC7, 0x9F, 0xA7, 0x9A, 0xEA, 0x70, 0x74, 0xAC, 0xA4, 0xD9, 0x39, 0xD4, 0xAC, 0xA4, 0xD9,
+    0x4D, 0x4A, 0xD4, 0xDA, 0x4D, 0x93, 0xAD, 0x4E, 0x4E, 0x3A, 0xDA, 0x3E, 0x93, 0xE9, 0x29, 0xE3,
+    0x6E, 0xA6, 0x9E, 0x96, 0xF6, 0xF9, 0x59, 0xEA, 0x6F, 0x6A, 0xE9, 0x59, 0xEA, 0x6A, 0xE6, 0xAE,
+    0x96, 0xF6, 0xF7, 0xE9, 0x59, 0xEA, 0x69, 0xE6, 0xAE, 0x96, 0xAE, 0x6F, 0x7E, 0xA5, 0x9E, 0xA7,
+    0xE9, 0x5A, 0xE9, 0x6A, 0xE6, 0xF7, 0xF6, 0xF7, 0xEA, 0x59, 0xE9, 0x69, 0xEA, 0x5F, 0x7A, 0xE9,
+    0x5F, 0x7F, 0x59, 0xEA, 0x7F, 0x5A, 0xE7, 0xAE, 0xA5, 0xF7, 0xF9, 0x49, 0xEA, 0x7F, 0x94, 0xAE,
+    0x96, 0xAF, 0x5F, 0x7F, 0xC5, 0xEA, 0x69, 0xFA, 0x4A, 0xE9, 0x69, 0xAE, 0xA4, 0xF7, 0x71, 0xFA,
+    0x74, 0x91, 0x9F, 0xC7, 0x49, 0xFF, 0xA7, 0x4A, 0xFF, 0x75, 0xFF, 0x75, 0x9F, 0xE7, 0x69, 0xFA,
+    0x97, 0x40, 0x69, 0xD9, 0x77, 0x6E, 0xA7, 0x75, 0xAE, 0x97, 0x3E, 0x95, 0xF9, 0x72, 0x9E, 0x59,
+    0xF7, 0x3F, 0x77, 0x59, 0xF7, 0x75, 0xAE, 0xA7, 0x77, 0x77, 0x77, 0x39, 0x97, 0x77, 0x0D, 0xA7,
+    0x4A, 0xD7, 0xD9, 0x74, 0xDA, 0x69, 0xD7, 0x49, 0xD9, 0x6A, 0xCA, 0x74, 0xAD, 0x7D, 0x97, 0x4D,
+    0xA7, 0xD7, 0x5D, 0x96, 0xAD, 0x74, 0xAD, 0x7D, 0xA7, 0x4E, 0x7D, 0x97, 0x4D, 0x96, 0xAD, 0x74,
+    0x9D, 0x7E, 0x74, 0xAD, 0x7E, 0x74, 0xDA, 0x6A, 0xDA, 0x73, 0x9D, 0x7E, 0x97, 0x3A, 0xD7, 0xE9,
+    0x73, 0xDA, 0x69, 0xE7, 0x39, 0xD9, 0x77, 0x6A, 0xD7, 0x77, 0xDA, 0x77, 0x6E, 0x97, 0x74, 0x9F,
+    0x77, 0x2F, 0xE9, 0x77, 0x1F, 0xEA, 0x77, 0x19, 0xFA, 0xA7, 0x77, 0x76, 0x76, 0x9C, 0xA7, 0x74,
+    0xE9, 0x77, 0x29, 0xFA, 0x77, 0x09, 0xD9, 0x0A, 0xD7, 0x7D, 0x4D, 0x75, 0x9A, 0x69, 0xA7, 0x77,
+    0x77, 0x09, 0x99, 0x97, 0x72, 0x9F, 0x77, 0x2A, 0xE9, 0x77, 0x2F, 0x77, 0x29, 0xF7, 0x72, 0xAE,
+    0xA7, 0x72, 0xF7, 0x73, 0xF7, 0x72, 0x9E, 0xA7, 0x72, 0xF7, 0x73, 0xF7, 0x72, 0x9E, 0xA7, 0x72,
+    0xAE, 0x97, 0x72, 0xF7, 0x72, 0x9E, 0xA7, 0x72, 0xAE, 0x97, 0x72, 0xF7, 0x73, 0xEA, 0x77, 0x2A,
+    0xE9, 0x77, 0x2F, 0x77, 0x3E, 0xA7, 0x72, 0x9E, 0x97, 0x72, 0xAE, 0x77, 0x3E, 0xA7, 0x72, 0xAE,
+    0x97, 0x71, 0x9F, 0x75, 0x92, 0xAF, 0xA7, 0x5F, 0xFC, 0x75, 0x9F, 0xF9, 0x75, 0xAF, 0xEA, 0x76,
+    0xFE, 0x97, 0x7F, 0xA9, 0x77, 0x77, 0x70, 0x76, 0xAA, 0x77, 0x5E, 0x77, 0x3A, 0xEA, 0x77, 0x19,
+    0xD9, 0xAD, 0x77, 0x0D, 0x3A, 0xC9, 0x75, 0xD5, 0x9C, 0xA7, 0x77, 0x77, 0x77, 0x6D, 0x97, 0x73,
+    0x9D, 0x97, 0x73, 0xE7, 0x74, 0xDA, 0x77, 0x39, 0xD9, 0x77, 0x3A, 0xD7, 0x74, 0xDA, 0x77, 0x39,
+    0xD9, 0x77, 0x3A, 0xD7, 0x74, 0xDA, 0x77, 0x4D, 0x97, 0x73, 0xAD, 0x77, 0x4D, 0xA7, 0x74, 0xD9,
+    0x77, 0x3A, 0xD7, 0x74, 0xDA, 0x77, 0x39, 0xD9, 0x77, 0x3E, 0x77, 0x29, 0xEA, 0x76, 0x9A, 0xAF,
+    0xC7, 0x7F, 0xE9, 0x76, 0xFD, 0xA7, 0x77, 0x77, 0x70, 0xE9, 0x4F, 0x70, 0x9E, 0x4F, 0x97, 0x0E,
+    0xA3, 0xAE, 0x97, 0x1E, 0x92, 0xAE, 0xA7, 0x1A, 0xE2, 0x9E, 0xA7, 0x2E, 0xA1, 0x9F, 0x73, 0xE9,
+    0x1F, 0x73, 0xAE, 0x1F, 0x74, 0xEA, 0x0F, 0x97, 0x39, 0xE9, 0xF9, 0x74, 0xAF, 0xEA, 0x75, 0xFE,
+    0xA7, 0x59, 0xFE, 0x76, 0xAF, 0xD7, 0x7F, 0xF7, 0x59, 0xFF, 0x97, 0x4A, 0xFF, 0xC7, 0x4F, 0x0F,
+    0xD7, 0x29, 0xEA, 0x0A, 0xFC, 0xA7, 0x1F, 0x91, 0xFD, 0x97, 0x0F, 0x2A, 0xFD, 0x79, 0xEA, 0x3F,
+    0xDA, 0x6F, 0x93, 0xAF, 0xD9, 0x5F, 0x49, 0xFE, 0x4A, 0xEA, 0x5F, 0xEA, 0x77, 0x77, 0x77, 0x71,
+    0x9F, 0xA7, 0x70, 0xFC, 0x77, 0x1F, 0x97, 0x70, 0xAF, 0x77, 0x1F, 0x97, 0x70, 0x9F, 0x77, 0x1F,
+    0x77, 0x1A, 0xEA, 0x77, 0x77, 0x30, 0x77, 0x69, 0xD9, 0x73, 0xE7, 0x4E, 0x73, 0x9D, 0x97, 0x3E,
+    0x74, 0xE7, 0x39, 0xDA, 0x73, 0xAD, 0x74, 0xE2, 0xEA, 0x49, 0xDA, 0x1E, 0x95, 0xAD, 0x1E, 0x96,
+    0xE0, 0xE9, 0x69, 0xFD, 0x97, 0xAF, 0xC9, 0x70, 0xFC, 0xA7, 0x09, 0xFD, 0x97, 0xAD, 0xAF, 0x7E,
+    0x9A, 0xF6, 0xE1, 0xFA, 0x4A, 0xE1, 0xAF, 0x93, 0xEA, 0x2F, 0xC9, 0x2E, 0x92, 0xAF, 0xC1, 0xAE,
+    0x4F, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9F, 0x97, 0x1F, 0xC7, 0x2F, 0x97, 0x1A, 0xF7, 0x2F,
+    0x72, 0xAE, 0xA7, 0x2F, 0x72, 0xFA, 0x77, 0x70, 0x49, 0x99, 0x29, 0x99, 0x4D, 0x91, 0xAD, 0x5D,
+    0x19, 0xD5, 0xAC, 0xA0, 0x9D, 0x95, 0xD9, 0x0D, 0x95, 0x9D, 0x0D, 0xA6, 0xAC, 0xAD, 0xA7, 0xFC,
+    0x79, 0xF7, 0x0A, 0xF7, 0x0F, 0xD6, 0x9D, 0x9E, 0xA5, 0xE0, 0xAE, 0x94, 0xD9, 0x1F, 0x39, 0xD2,
+    0xFA, 0x2E, 0x29, 0xF9, 0x10, 0x74, 0xA9, 0x76, 0xD7, 0x6A, 0xCA, 0x75, 0xAD, 0x75, 0x9D, 0x97,
+    0x5D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xAE, 0x75, 0xEA, 0x74, 0x9E,
+    0x97, 0x4A, 0xE7, 0x5E, 0xA7, 0x5E, 0x97, 0x4A, 0xE7, 0x5F, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xF7,
+    0x5E, 0xA7, 0x49, 0xE9, 0x74, 0xAE, 0x75, 0xEA, 0x74, 0x9E, 0x97, 0x4A, 0xE7, 0x5F, 0x74, 0x9F,
+    0xAA, 0xAA, 0xAF, 0xD1, 0xAF, 0xFF, 0xDA, 0x1F, 0xFF, 0xE9, 0x1F, 0xFF, 0xE1, 0xAF, 0xFF, 0xE1,
+    0x74, 0x9C, 0xA7, 0x4D, 0x74, 0xD9, 0x73, 0xAD, 0x73, 0x9D, 0x74, 0xAA, 0xA7, 0x77, 0x77, 0x77,
+    0x77, 0x29, 0x97, 0x49, 0xD9, 0x73, 0xE7, 0x4D, 0xA7, 0x3A, 0xD9, 0x73, 0xE7, 0x39, 0xDA, 0x73,
+    0xAD, 0x97, 0x3E, 0x73, 0x9D, 0xA7, 0x3A, 0xD7, 0x4E, 0x73, 0x9D, 0xA7, 0x3A, 0xD9, 0x73, 0xE7,
+    0x39, 0xE7, 0x3A, 0xDA, 0x73, 0xE7, 0x4E, 0x73, 0x9D, 0xA7, 0x3A, 0xD9, 0x73, 0xFD, 0xA7, 0x0F,
+    0xDA, 0x79, 0xFD, 0x97, 0x7A, 0xAA, 0x97, 0x49, 0xE7, 0x5A, 0xE7, 0x5E, 0xA7, 0x5E, 0x97, 0x4A,
+    0xE7, 0x5E, 0xA7, 0x5E, 0x97, 0x49, 0xE7, 0x5F, 0x75, 0xEA, 0x74, 0x9E, 0x75, 0xF7, 0x5E, 0xA7,
+    0x49, 0xE9, 0x74, 0xAE, 0x75, 0xEA, 0x74, 0x9E, 0x97, 0x4A, 0xE7, 0x5F, 0x74, 0x9F, 0xAA, 0xAA,
+    0xAF, 0xD1, 0xAF, 0xFF, 0xDA, 0x1F, 0xFF, 0xE9, 0x1F, 0xFF, 0xE1, 0xAF, 0xFF, 0xE7, 0x77, 0x77,
+    0x77, 0x77, 0x7F, 0xC7, 0x39, 0xF9, 0x73, 0xAF, 0x74, 0xF9, 0x73, 0x9E, 0xA7, 0x4F, 0x74, 0xAE,
+    0xA7, 0x39, 0xF7, 0x77, 0x40, 0x70, 0xA9, 0x70, 0x9D, 0x97, 0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0xE7,
+    0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x9D, 0xA7, 0xAD, 0x70, 0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x9E,
+    0x7A, 0xDA, 0x7E, 0x70, 0xE7, 0x9D, 0xA7, 0xE9, 0x7F, 0xDA, 0x4F, 0xDA, 0x39, 0xFD, 0x97, 0x77,
+    0x77, 0x76, 0x9F, 0x95, 0xFC, 0x6F, 0x95, 0xAF, 0x6F, 0x95, 0x9E, 0xA6, 0xF6, 0xAE, 0xA7, 0x71,
+    0x7A, 0xAA, 0x97, 0x59, 0xE7, 0x6A, 0xE7, 0x6E, 0xA7, 0x6E, 0x97, 0x5A, 0xE7, 0x6E, 0xA5, 0xAC,
+    0xA5, 0xE9, 0x5D, 0x94, 0x9E, 0x5A, 0xD5, 0xF5, 0xDA, 0x5E, 0xA4, 0x9D, 0x94, 0x9E, 0x5A, 0xD5,
+    0xAE, 0x76, 0xEA, 0x75, 0x9E, 0x97, 0x5A, 0xE7, 0x6E, 0xA7, 0x59, 0xE9, 0x75, 0xAE, 0x76, 0xF7,
+    0x59, 0xFA, 0xAA, 0xAA, 0xFD, 0x2A, 0xFF, 0xFD, 0xA2, 0xFF, 0xFE, 0x92, 0xFF, 0xFE, 0x2A, 0xFF,
+    0xFE, 0x20, 0x76, 0xD7, 0x0A, 0xA9, 0x2A, 0xD7, 0x9D, 0x92, 0xDA, 0x7E, 0x29, 0xD9, 0x69, 0xDA,
+    0x2A, 0xD7, 0xAD, 0x92, 0xDA, 0x7E, 0x75, 0x9D, 0xA7, 0x5A, 0xD7, 0x6E, 0x75, 0x9D, 0xA7, 0x5A,
+    0xD7, 0x6E, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x59, 0xE7, 0x5A, 0xDA, 0x75, 0xE7, 0x6E,
+    0x75, 0x9D, 0xA7, 0x5E, 0x97, 0x5F, 0xDA, 0x72, 0xFD, 0xA7, 0x19, 0xFD, 0x97, 0x10, 0x7E, 0x97,
+    0x69, 0xE7, 0x7A, 0xE7, 0x7E, 0xA7, 0x69, 0xE9, 0x76, 0xAE, 0x5E, 0x6E, 0xA4, 0x9E, 0x6E, 0x94,
+    0xF5, 0xAE, 0x49, 0xF5, 0xF4, 0xFA, 0x5E, 0x97, 0x69, 0xE7, 0x7F, 0x77, 0xEA, 0x76, 0x9E, 0x97,
+    0x6A, 0xE7, 0x7E, 0xA7, 0x69, 0xE9, 0x76, 0xAE, 0x77, 0xF7, 0x69, 0xFA, 0xAA, 0xAA, 0xFD, 0x3A,
+    0xFF, 0xFD, 0xA3, 0xFF, 0xFE, 0x93, 0xFF, 0xFE, 0x3A, 0xFF, 0xFE, 0x30, 0x77, 0x7D, 0x97, 0x3A,
+    0xD9, 0x73, 0xE7, 0x39, 0xDA, 0x73, 0xE7, 0x4E, 0x73, 0x9D, 0x92, 0x9D, 0xA4, 0xE3, 0xEA, 0x4E,
+    0x29, 0xE9, 0x39, 0xD9, 0x2F, 0x93, 0xE2, 0x9F, 0x4E, 0x73, 0x9D, 0xA7, 0x3E, 0x74, 0xE7, 0x39,
+    0xDA, 0x73, 0xAD, 0x97, 0x3E, 0x74, 0xE7, 0x3A, 0xDA, 0x73, 0xE9, 0x73, 0xFD, 0xA7, 0x0F, 0xDA,
+    0x79, 0xFD, 0x97, 0x77, 0x77, 0x49, 0x97, 0x77, 0x73, 0xAD, 0x77, 0x77, 0x3A, 0xD9, 0x77, 0x77,
+    0x2A, 0xD9, 0x77, 0x77, 0x2A, 0xD9, 0x77, 0x72, 0xAA, 0xA9, 0x3A, 0xD9, 0x77, 0x72, 0x9E, 0x3A,
+    0xD9, 0x77, 0x73, 0xAE, 0x2A, 0xD9, 0x77, 0x74, 0xEA, 0x1A, 0xDA, 0x77, 0x75, 0xE9, 0x0A, 0xDA,
+    0x77, 0x75, 0xAE, 0x09, 0xDA, 0x77, 0x76, 0xEA, 0x9D, 0xA7, 0x77, 0x7F, 0xDA, 0x77, 0x77, 0x9F,
+    0xCA, 0x77, 0x77, 0x0F, 0xD7, 0x77, 0x71, 0xFC, 0x77, 0x77, 0x19, 0xF7, 0x77, 0x72, 0xAE, 0x77,
+    0x77, 0x29, 0xEA, 0x77, 0x77, 0x19, 0xF9, 0x77, 0x77, 0x09, 0xFC, 0x77, 0x77, 0x09, 0xFC, 0xA7,
+    0x77, 0x79, 0xFD, 0x97, 0x77, 0x69, 0xFE, 0x77, 0x76, 0x9E, 0x9F, 0x77, 0x75, 0x9E, 0x99, 0xFA,
+    0xAA, 0xAA, 0xFD, 0x77, 0x19, 0xE9, 0x0A, 0xFF, 0xFD, 0xA7, 0x70, 0x9E, 0x91, 0xFF, 0xFE, 0x97,
+    0x79, 0xE9, 0x2F, 0xFF, 0xE7, 0x79, 0xEA, 0x2A, 0xFF, 0xFE, 0x76, 0x9E, 0xA7, 0x77, 0x72, 0xEA,
+    0x77, 0x77, 0x2E, 0xA7, 0x77, 0x72, 0xEA, 0x77, 0x77, 0x2E, 0xA7, 0x77, 0x72, 0xD9, 0x77, 0x77,
+    0x39, 0x77, 0x77, 0x50, 0x77, 0x2A, 0x97, 0x77, 0x09, 0xD9, 0x77, 0x7E, 0x77, 0x79, 0xDA, 0x77,
+    0x7A, 0xD9, 0x77, 0x7E, 0x77, 0x79, 0xDA, 0x77, 0x7A, 0xD7, 0x77, 0x0E, 0x77, 0x79, 0xDA, 0x77,
+    0x7A, 0xD7, 0x77, 0x0E, 0x77, 0x79, 0xDA, 0x77, 0x7A, 0xD9, 0x09, 0xAA, 0xF9, 0x73, 0x99, 0xAF,
+    0xDA, 0xA9, 0x70, 0x9A, 0xAF, 0xFC, 0xA7, 0x39, 0xAF, 0xAA, 0x92, 0xAD, 0x97, 0x77, 0xE7, 0x77,
+    0x0E, 0x77, 0x79, 0xDA, 0x77, 0x7A, 0xD9, 0x77, 0x7F, 0xDA, 0x77, 0x4F, 0xDA, 0x77, 0x39, 0xFD,
+    0x97, 0x00, 0x77, 0x49, 0xA9, 0x77, 0x79, 0xD7, 0x77, 0x0D, 0x77, 0x70, 0xDA, 0x77, 0x7A, 0xD7,
+    0x77, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xE7, 0x0A, 0xEA, 0x71,
+    0xF7, 0x0F, 0xC7, 0x1E, 0xA7, 0x9F, 0xC7, 0x0A, 0xE7, 0x0A, 0xFC, 0x97, 0xF7, 0x0F, 0xDA, 0x7E,
+    0xA7, 0x9F, 0xDA, 0x6A, 0xE7, 0x0A, 0xFE, 0x6F, 0x70, 0xFF, 0x59, 0xEA, 0x79, 0xEA, 0xAE, 0x94,
+    0xAE, 0x97, 0xAE, 0x99, 0xEA, 0x4F, 0x70, 0xF1, 0xF3, 0x9E, 0xA7, 0x9F, 0x1F, 0x3A, 0xE9, 0x7A,
+    0xEA, 0x1F, 0x3F, 0x70, 0xF9, 0x1A, 0xE9, 0x19, 0xEA, 0x79, 0xF2, 0x9E, 0xA1, 0xAE, 0x97, 0xAF,
+    0x3F, 0x1F, 0x70, 0xFA, 0x3F, 0x09, 0xEA, 0x79, 0xF9, 0x3F, 0x0F, 0x97, 0xFC, 0x4A, 0xE9, 0xF7,
+    0x0F, 0xC4, 0x9F, 0xF7, 0x9F, 0xA5, 0xFE, 0x97, 0xFC, 0x95, 0xFE, 0x70, 0xFC, 0x6A, 0xFD, 0x7A,
+    0xFC, 0x6A, 0xFC, 0x97, 0x77, 0x0A, 0xA7, 0x70, 0xAC, 0x97, 0x79, 0xD7, 0x70, 0xD7, 0x70, 0xDA,
+    0x77, 0xAD, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0x99, 0x72, 0x9C, 0xA9, 0xAF, 0xCA,
+    0x70, 0xFF, 0xEA, 0x7F, 0xC9, 0x19, 0xE6, 0x9E, 0xA4, 0xAD, 0x6E, 0xA5, 0xAD, 0x6E, 0x6E, 0x59,
+    0xE6, 0xE5, 0xE9, 0x59, 0xE5, 0xE9, 0x5A, 0xDA, 0x49, 0xE6, 0xE9, 0x4F, 0x59, 0xE5, 0xEA, 0x5A,
+    0xE4, 0xAE, 0x95, 0xF4, 0xF6, 0xEA, 0x4F, 0x59, 0xE9, 0x3A, 0xEA, 0x5F, 0x93, 0x77, 0x69, 0xAA,
+    0xA7, 0x09, 0xEA, 0x71, 0xF7, 0x0F, 0xC7, 0x1E, 0xA7, 0x0F, 0xC7, 0x0A, 0xE7, 0x0A, 0xFC, 0x97,
+    0xF7, 0x0F, 0xDA, 0x7E, 0xA7, 0x9F, 0xDA, 0x6A, 0xE9, 0x7A, 0xFE, 0x6F, 0x70, 0xFF, 0x59, 0xEA,
+    0x79, 0xEA, 0xAE, 0x94, 0xAE, 0x97, 0xAE, 0x99, 0xEA, 0x4F, 0x70, 0xF1, 0xEA, 0x39, 0xEA, 0x79,
+    0xF1, 0xF3, 0xAE, 0x97, 0xAE, 0xA1, 0xF3, 0xF7, 0x0F, 0x91, 0xAE, 0x91, 0x9E, 0xA7, 0x9F, 0x29,
+    0xEA, 0x1A, 0xE9, 0x7A, 0xF3, 0xF1, 0xF7, 0x0F, 0xA3, 0xF0, 0x9E, 0xA7, 0x9F, 0x93, 0xF0, 0xF9,
+    0x7F, 0xC4, 0xAE, 0x9F, 0x70, 0xFC, 0x49, 0xFF, 0x79, 0xFA, 0x5F, 0xE9, 0x7F, 0xC9, 0x5F, 0xE7,
+    0x0F, 0xC6, 0xAF, 0xD7, 0xAF, 0xC6, 0xAF, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x7F, 0xC7, 0x75, 0x9F,
+    0x97, 0x75, 0xFC, 0x77, 0x6F, 0x97, 0x75, 0x9E, 0xA7, 0x76, 0xF7, 0x76, 0xAE, 0xA7, 0x75, 0x9F,
+    0x77, 0x77, 0x76, 0x72, 0x99, 0x97, 0x09, 0xCA, 0x9A, 0xFC, 0xA6, 0xFF, 0xEA, 0x5F, 0xC9, 0x19,
+    0xE4, 0x9E, 0xA4, 0xAD, 0x4E, 0xA5, 0xAD, 0x4E, 0x6E, 0x39, 0xE6, 0xE3, 0xE9, 0x59, 0xE3, 0xE9,
+    0x5A, 0xDA, 0x29, 0xE6, 0xE9, 0x2F, 0x59, 0xE3, 0xEA, 0x5A, 0xE2, 0xAE, 0x95, 0xF2, 0xF6, 0xEA,
+    0x2F, 0x59, 0xE9, 0x1A, 0xEA, 0x5F, 0x97, 0x77, 0x77, 0x19, 0xF9, 0x73, 0xFC, 0x74, 0xF9, 0x73,
+    0xAF, 0x74, 0xF9, 0x73, 0xAE, 0xA7, 0x4F, 0x74, 0xFA, 0x77, 0x75, 0x77, 0x77, 0x70, 0xD5, 0x9C,
+    0x97, 0x71, 0xD2, 0x9D, 0x97, 0x72, 0x9D, 0x9A, 0xD7, 0x75, 0xAE, 0xA7, 0x77, 0xDA, 0x77, 0x70,
+    0x9A, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0xAA, 0xA7, 0x09, 0xEA, 0x71, 0xF7, 0x0F,
+    0xC7, 0x1E, 0xA7, 0x0F, 0xC7, 0x0A, 0xE7, 0x0A, 0xFC, 0x97, 0xF7, 0x0F, 0xDA, 0x7E, 0xA7, 0x9F,
+    0xDA, 0x6A, 0xE9, 0x7A, 0xFE, 0x6F, 0x70, 0xFF, 0x59, 0xEA, 0x79, 0xEA, 0xAE, 0x94, 0xAE, 0x97,
+    0xAE, 0x99, 0xEA, 0x4F, 0x70, 0xF1, 0xEA, 0x39, 0xEA, 0x79, 0xF1, 0xF3, 0xAE, 0x97, 0xAE, 0xA1,
+    0xF3, 0xF7, 0x0F, 0x91, 0xAE, 0x91, 0x9E, 0xA7, 0x9F, 0x29, 0xEA, 0x1A, 0xE9, 0x7A, 0xF3, 0xF1,
+    0xF7, 0x0F, 0xA3, 0xF0, 0x9E, 0xA7, 0x9F, 0x93, 0xF0, 0xF9, 0x7F, 0xC4, 0xAE, 0x9F, 0x70, 0xFC,
+    0x49, 0xFF, 0x79, 0xFA, 0x5F, 0xE9, 0x7F, 0xC9, 0x5F, 0xE7, 0x0F, 0xC6, 0xAF, 0xD7, 0xAF, 0xC6,
+    0xAF, 0xC9, 0x70, 0x79, 0xA7, 0xA9, 0x70, 0xD4, 0xAC, 0xA7, 0x2D, 0x90, 0x9D, 0x97, 0x39, 0xFC,
+    0x76, 0xAE, 0x77, 0x9D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0x99, 0x72, 0x9C, 0xA9,
+    0xAF, 0xCA, 0x70, 0xFF, 0xEA, 0x7F, 0xC9, 0x19, 0xE6, 0x9E, 0xA4, 0xAD, 0x6E, 0xA5, 0xAD, 0x6E,
+    0x6E, 0x59, 0xE6, 0xE5, 0xE9, 0x59, 0xE5, 0xE9, 0x5A, 0xDA, 0x49, 0xE6, 0xE9, 0x4F, 0x59, 0xE5,
+    0xEA, 0x5A, 0xE4, 0xAE, 0x95, 0xF4, 0xF6, 0xEA, 0x4F, 0x59, 0xE9, 0x3A, 0xEA, 0x5F, 0x93, 0x4D,
+    0xA7, 0x7E, 0x77, 0xAD, 0xA7, 0x69, 0xE7, 0x69, 0xEA, 0x76, 0xDA, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x99, 0x97, 0x2A, 0xCA, 0x9F, 0xD9, 0x70, 0xFF, 0xE9, 0x7F,
+    0xA9, 0x19, 0xDA, 0x6A, 0xE9, 0x4E, 0x6E, 0xA5, 0xE5, 0x9E, 0x6E, 0x5A, 0xDA, 0x6E, 0x5E, 0x95,
+    0xAD, 0xA4, 0x9E, 0x6E, 0x94, 0xAE, 0x6E, 0x94, 0xEA, 0x59, 0xE4, 0x9E, 0x95, 0xAE, 0x4A, 0xE9,
+    0x5E, 0xA4, 0xF5, 0x9E, 0xA3, 0x9F, 0x5A, 0xE9, 0x3A, 0xEA, 0x5F, 0x20, 0x77, 0x69, 0xAA, 0xA7,
+    0x09, 0xEA, 0x71, 0xF7, 0x0F, 0xC7, 0x1E, 0xA7, 0x0F, 0xC7, 0x0A, 0xE7, 0x0A, 0xFC, 0x97, 0xF7,
+    0x0F, 0xDA, 0x7E, 0xA7, 0x9F, 0xDA, 0x6A, 0xE9, 0x7A, 0xFE, 0x6F, 0x70, 0xFF, 0x59, 0xEA, 0x79,
+    0xEA, 0xAE, 0x94, 0xAE, 0x97, 0xAE, 0x99, 0xEA, 0x4F, 0x70, 0xF1, 0xEA, 0x39, 0xEA, 0x79, 0xF1,
+    0xF3, 0xAE, 0x97, 0xAE, 0xA1, 0xF3, 0xF7, 0x0F, 0x91, 0xAE, 0x91, 0x9E, 0xA7, 0x9F, 0x29, 0xEA,
+    0x1A, 0xE9, 0x7A, 0xF3, 0xF1, 0xF7, 0x0F, 0xA3, 0xF0, 0x9E, 0xA7, 0x9F, 0x93, 0xF0, 0xF9, 0x7F,
+    0xC4, 0xAE, 0x9F, 0x70, 0xFC, 0x49, 0xFF, 0x79, 0xFA, 0x5F, 0xE9, 0x7F, 0xC9, 0x5F, 0xE7, 0x0F,
+    0xC6, 0xFE, 0x7A, 0xFC, 0x6A, 0xFC, 0x97, 0x74, 0xFD, 0x77, 0x49, 0xFC, 0xA7, 0x74, 0xFD, 0x77,
+    0x19, 0xAF, 0xE9, 0x77, 0x0F, 0xFA, 0x77, 0x1A, 0xFA, 0x97, 0x74, 0x99, 0x77, 0x30, 0x72, 0x99,
+    0x97, 0x09, 0xCA, 0x9A, 0xFC, 0xA6, 0xFF, 0xEA, 0x5F, 0xC9, 0x19, 0xE4, 0x9E, 0xA4, 0xAD, 0x4E,
+    0xA5, 0xAD, 0x4E, 0x6E, 0x39, 0xE6, 0xE3, 0xE9, 0x59, 0xE3, 0xE9, 0x5A, 0xDA, 0x29, 0xE6, 0xE9,
+    0x2F, 0x59, 0xE3, 0xEA, 0x5A, 0xE2, 0xAE, 0x95, 0xF2, 0xF6, 0xEA, 0x2F, 0x59, 0xE9, 0x1A, 0xEA,
+    0x5F, 0x97, 0x4F, 0x74, 0xFA, 0x71, 0xFE, 0x71, 0x9F, 0xD9, 0x73, 0x99, 0x70, 0x77, 0x69, 0x77,
+    0x0A, 0xAF, 0xFC, 0xA7, 0x6F, 0xFF, 0xA7, 0x69, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x39, 0xAF, 0xDA, 0x77, 0x0A, 0xFF, 0xEA, 0x74, 0x9F, 0xEA, 0xFE, 0x72, 0x9F, 0xC9, 0x4A, 0xFA,
+    0x70, 0x9F, 0xA7, 0xAF, 0x70, 0xF9, 0x71, 0xF9, 0x6F, 0xA7, 0x2A, 0xEA, 0x59, 0xEA, 0x73, 0x9E,
+    0xA5, 0xF7, 0x5E, 0xA4, 0x9E, 0x97, 0x5E, 0x94, 0xF7, 0x6E, 0x94, 0xE9, 0x75, 0x9E, 0x49, 0xE7,
+    0x6A, 0xE4, 0xAE, 0x76, 0xE9, 0x4E, 0xA7, 0x59, 0xE5, 0xEA, 0x75, 0xF5, 0xF7, 0x4F, 0x95, 0xFA,
+    0x71, 0x9F, 0xC6, 0xFD, 0x99, 0x29, 0x9A, 0xFD, 0x96, 0xFF, 0xFF, 0xF7, 0xAF, 0xFF, 0xFD, 0x71,
+    0xFF, 0xFF, 0xC9, 0x71, 0xAF, 0xFF, 0xE7, 0x49, 0xFF, 0xFA, 0x77, 0x9A, 0xFD, 0xA9, 0x77, 0x77,
+    0x70, 0x79, 0x99, 0xAA, 0xAA, 0xF9, 0x6F, 0xFF, 0x95, 0x9A, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xAF, 0xA7, 0x3A, 0xFF, 0x97, 0x9F, 0xAA, 0xAF,
+    0x96, 0xE9, 0x49, 0xDA, 0x5E, 0x7E, 0x49, 0xD9, 0x7E, 0x4E, 0x70, 0xE3, 0x9D, 0x97, 0x0E, 0x3A,
+    0xD7, 0x0A, 0xD9, 0x3E, 0x70, 0xE4, 0xE9, 0x6E, 0xA4, 0xFA, 0x99, 0x99, 0xAF, 0x5A, 0xFF, 0xF7,
+    0xFF, 0xE9, 0x79, 0xFF, 0xA7, 0x3A, 0xFA, 0x97, 0x00, 0x74, 0xD6, 0x9C, 0x97, 0x7D, 0x6D, 0x77,
+    0x0E, 0x39, 0xDA, 0x77, 0x09, 0xFF, 0xA7, 0x72, 0xAF, 0xDA, 0x77, 0x49, 0xAA, 0xA9, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xAF, 0xDA, 0x77, 0x0A, 0xFF, 0xEA, 0x74, 0x9F, 0xEA,
+    0xFE, 0x72, 0x9F, 0xC9, 0x4A, 0xFA, 0x70, 0x9F, 0xA7, 0xAF, 0x70, 0xF9, 0x71, 0xF9, 0x6F, 0xA7,
+    0x2A, 0xEA, 0x59, 0xEA, 0x73, 0x9E, 0xA5, 0xF7, 0x5E, 0xA4, 0x9E, 0x97, 0x5E, 0x94, 0xF7, 0x6E,
+    0x94, 0xE9, 0x75, 0x9E, 0x49, 0xE7, 0x6A, 0xE4, 0xAE, 0x76, 0xE9, 0x4E, 0xA7, 0x59, 0xE5, 0xEA,
+    0x75, 0xF5, 0xF7, 0x4F, 0x95, 0xFA, 0x71, 0x9F, 0xC6, 0xFD, 0x99, 0x29, 0x9A, 0xFD, 0x96, 0xFF,
+    0xFF, 0xF7, 0xAF, 0xFF, 0xFD, 0x71, 0xFF, 0xFF, 0xC9, 0x71, 0xAF, 0xFF, 0xE7, 0x49, 0xFF, 0xFA,
+    0x77, 0x9A, 0xFD, 0xA9, 0x77, 0x77, 0x70, 0x7A, 0xA6, 0x9A, 0x70, 0xD6, 0xD7, 0x0D, 0x94, 0xD9,
+    0x70, 0xFF, 0xCA, 0x71, 0x9F, 0xEA, 0x74, 0xAE, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x9A, 0xFA, 0x73, 0xAF, 0xF9, 0x79, 0xFA, 0xAA, 0xF9, 0x6E, 0x94, 0x9D, 0xA5, 0xE7,
+    0xE4, 0x9D, 0x97, 0xE4, 0xE7, 0x0E, 0x39, 0xD9, 0x70, 0xE3, 0xAD, 0x70, 0xAD, 0x93, 0xE7, 0x0E,
+    0x4E, 0x96, 0xEA, 0x4F, 0xA9, 0x99, 0x9A, 0xF5, 0xAF, 0xFF, 0x7F, 0xFE, 0x97, 0x9F, 0xFA, 0x73,
+    0xAF, 0xA9, 0x70, 0x74, 0xAA, 0xA7, 0x0A, 0xAA, 0x74, 0xAD, 0x97, 0xAD, 0x97, 0x3E, 0xA7, 0xEA,
+    0x73, 0xF7, 0xF7, 0x3A, 0xA9, 0x97, 0xAA, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x39, 0xAF, 0xDA, 0x77, 0x1A, 0xFF, 0xEA, 0x75, 0x9F, 0xEA, 0xFE, 0x73, 0x9F, 0xC9, 0x4A, 0xFA,
+    0x71, 0x9F, 0xA7, 0xAF, 0x71, 0xF9, 0x71, 0xF9, 0x7F, 0xA7, 0x2A, 0xEA, 0x69, 0xEA, 0x73, 0x9E,
+    0xA6, 0xF7, 0x5E, 0xA5, 0x9E, 0x97, 0x5E, 0x95, 0xF7, 0x6E, 0x95, 0xE9, 0x75, 0x9E, 0x59, 0xE7,
+    0x6A, 0xE5, 0xAE, 0x76, 0xE9, 0x5E, 0xA7, 0x59, 0xE6, 0xEA, 0x75, 0xF6, 0xF7, 0x4F, 0x96, 0xFA,
+    0x71, 0x9F, 0xC7, 0xFD, 0x99, 0x29, 0x9A, 0xFD, 0x97, 0xFF, 0xFF, 0xF7, 0x0A, 0xFF, 0xFF, 0xD7,
+    0x2F, 0xFF, 0xFC, 0x97, 0x2A, 0xFF, 0xFE, 0x75, 0x9F, 0xFF, 0xA7, 0x70, 0x9A, 0xFD, 0xA9, 0x77,
+    0x77, 0x71, 0x7D, 0xA7, 0x0D, 0xA6, 0xE7, 0x9E, 0x59, 0xE9, 0x69, 0xE5, 0x9E, 0x96, 0x9E, 0x95,
+    0xA9, 0x97, 0x0A, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0xAF, 0xA7,
+    0x6A, 0xFF, 0x97, 0x29, 0xFA, 0xAA, 0xF9, 0x71, 0xE9, 0x49, 0xDA, 0x70, 0xE7, 0xE7, 0x9D, 0x97,
+    0xE7, 0xE7, 0x0E, 0x69, 0xD9, 0x70, 0xE6, 0xAD, 0x70, 0xAD, 0x96, 0xE7, 0x0E, 0x7E, 0x96, 0xEA,
+    0x7F, 0xA9, 0x99, 0x9A, 0xF7, 0x0A, 0xFF, 0xF7, 0x2F, 0xFE, 0x97, 0x29, 0xFF, 0xA7, 0x6A, 0xFA,
+    0x97, 0x30, 0x73, 0x9A, 0xFC, 0xAA, 0x73, 0x99, 0x99, 0x72, 0xAF, 0xFF, 0xFF, 0xFD, 0x70, 0x9F,
+    0xEA, 0xFF, 0xFF, 0xEA, 0x79, 0xFC, 0x94, 0xAF, 0xFF, 0xEA, 0x79, 0xFA, 0x7A, 0xF9, 0x77, 0x1F,
+    0xA7, 0x1F, 0x97, 0x70, 0xFA, 0x72, 0xF9, 0x77, 0x9F, 0x73, 0xFA, 0x77, 0xF7, 0x39, 0xFA, 0x76,
+    0x9E, 0x97, 0x3A, 0xF9, 0x76, 0xAE, 0x74, 0xFC, 0xA9, 0x99, 0x9A, 0x71, 0xEA, 0x73, 0x9F, 0xFE,
+    0x70, 0x9E, 0x74, 0xAF, 0xFE, 0x70, 0xAE, 0x74, 0xFF, 0xEA, 0x70, 0xEA, 0x74, 0xFC, 0x97, 0x6E,
+    0xA7, 0x3A, 0xFC, 0x77, 0xEA, 0x73, 0xFC, 0xA7, 0x7F, 0x97, 0x2F, 0xC7, 0x70, 0xFC, 0xA6, 0x9A,
+    0xFC, 0xA7, 0x70, 0xFF, 0xFF, 0xF7, 0x71, 0xAF, 0xFF, 0xFF, 0xFF, 0xA7, 0x9F, 0xFF, 0xFF, 0xFF,
+    0xA7, 0x0A, 0xFF, 0xFF, 0xFF, 0xEA, 0x71, 0x9F, 0xFF, 0xFF, 0xFD, 0xA7, 0x39, 0xAF, 0xDA, 0xAF,
+    0xFF, 0xEA, 0x50, 0x77, 0x4A, 0xEA, 0x72, 0x9A, 0xFA, 0x4F, 0xF9, 0x7A, 0xFF, 0xA0, 0x9E, 0xA9,
+    0x2D, 0x59, 0xFA, 0xAA, 0xFA, 0xDA, 0x6C, 0xA4, 0xE9, 0x49, 0xFA, 0x7D, 0x3E, 0x7F, 0x49, 0x9A,
+    0xAD, 0x29, 0xD9, 0x7F, 0xFF, 0xE2, 0xE7, 0x0F, 0xFF, 0xE1, 0x9D, 0x97, 0x9E, 0x99, 0x99, 0x71,
+    0xAD, 0x70, 0xAD, 0x97, 0x5E, 0x70, 0xE7, 0x6E, 0x96, 0xFA, 0x75, 0xFA, 0x99, 0x99, 0xAF, 0xE9,
+    0x59, 0xA3, 0xAF, 0xFF, 0xFF, 0xFA, 0x4F, 0xFE, 0x9A, 0xFF, 0xE9, 0x49, 0xFF, 0xC2, 0xAF, 0xFD,
+    0x7A, 0xFA, 0x94, 0x9A, 0xFC, 0xA9, 0x40, 0x77, 0x1D, 0x77, 0x2A, 0xC9, 0x77, 0x19, 0xD7, 0x72,
+    0xD9, 0x77, 0x1D, 0xA7, 0x71, 0x9A, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x69, 0xAA, 0xAA, 0xAA, 0x99,
+    0x74, 0xFF, 0xDA, 0x71, 0x9F, 0xFE, 0xA7, 0x0A, 0xCA, 0x5A, 0xE7, 0x0D, 0x96, 0xAD, 0x96, 0x9D,
+    0x7A, 0xD9, 0x6A, 0xD7, 0xAD, 0x7D, 0xA6, 0x9E, 0x69, 0xD6, 0x9E, 0xA6, 0xAD, 0x49, 0xFC, 0x7F,
+    0xFF, 0xC9, 0x69, 0xFF, 0xEA, 0x70, 0xAF, 0xFD, 0x97, 0x1F, 0xFF, 0x97, 0x0F, 0xA9, 0x99, 0xAF,
+    0x7A, 0xE9, 0x49, 0xE9, 0x6F, 0x6E, 0xA6, 0xF6, 0xEA, 0x5A, 0xF5, 0x9E, 0xA5, 0xFA, 0x5A, 0xEA,
+    0x5F, 0x95, 0xFA, 0x4A, 0xF5, 0x9F, 0xA4, 0xFC, 0x5A, 0xFA, 0x4F, 0xC5, 0xFC, 0xA3, 0xAF, 0xA5,
+    0xFC, 0xA3, 0x73, 0xAA, 0x73, 0xD9, 0x72, 0xAC, 0xA7, 0x29, 0xD7, 0x3D, 0x97, 0x2E, 0x77, 0x77,
+    0x77, 0x6D, 0x90, 0x9A, 0xD9, 0x49, 0xDA, 0xFC, 0x5F, 0xFC, 0x5F, 0xCA, 0x99, 0xA4, 0x9F, 0x71,
+    0xAE, 0x72, 0xEA, 0x71, 0x9E, 0x72, 0xAE, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1F, 0x72, 0xF7, 0x1A,
+    0xF7, 0x1F, 0xA7, 0x09, 0xFA, 0x70, 0x79, 0xAA, 0xAA, 0xAA, 0x99, 0x74, 0xFF, 0xDA, 0x71, 0x9F,
+    0xFE, 0xA7, 0x0A, 0xCA, 0x5A, 0xE7, 0x0D, 0x96, 0xAD, 0x96, 0x9D, 0x7A, 0xD9, 0x6A, 0xD7, 0xAD,
+    0x7D, 0xA6, 0x9E, 0x69, 0xD6, 0x9E, 0xA6, 0xAD, 0x49, 0xFC, 0x7F, 0xFF, 0xC9, 0x69, 0xFF, 0xEA,
+    0x70, 0xAF, 0xFD, 0x97, 0x1F, 0xFF, 0x97, 0x0F, 0xA9, 0x99, 0xAF, 0x7A, 0xE9, 0x49, 0xE9, 0x6F,
+    0x6E, 0xA6, 0xF6, 0xEA, 0x5A, 0xF5, 0x9E, 0xA5, 0xFA, 0x5A, 0xEA, 0x5F, 0x95, 0xFA, 0x4A, 0xF5,
+    0x9F, 0xA4, 0xFC, 0x5A, 0xFA, 0x4F, 0xC5, 0xFC, 0xA3, 0xAF, 0xA5, 0xFC, 0xA7, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x19, 0xF9, 0x77, 0xFC, 0x77, 0x0F, 0x97, 0x7A, 0xF7, 0x70, 0xF9, 0x77,
+    0x9E, 0xA7, 0x70, 0xF7, 0x70, 0xAE, 0xA7, 0x77, 0x71, 0x77, 0x72, 0xD9, 0x09, 0xAD, 0x97, 0x9D,
+    0xAF, 0xC7, 0x0F, 0xFC, 0x70, 0xFC, 0xA9, 0x9A, 0x79, 0xF7, 0x4A, 0xE7, 0x5E, 0xA7, 0x49, 0xE7,
+    0x5A, 0xE7, 0x5E, 0xA7, 0x49, 0xE9, 0x74, 0xF7, 0x5F, 0x74, 0xAF, 0x74, 0xFA, 0x73, 0x9F, 0xA7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0xF9, 0x73, 0xAF, 0x74, 0xF9, 0x73, 0x9F,
+    0x74, 0xF9, 0x73, 0x9F, 0x74, 0xF7, 0x4A, 0xEA, 0x73, 0x71, 0xC9, 0x6A, 0x97, 0x29, 0xCA, 0x3A,
+    0xC9, 0x74, 0xAD, 0x09, 0xD7, 0x7F, 0xC7, 0x70, 0x9E, 0x77, 0x2D, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x09, 0xAA, 0xAA, 0xAA, 0x99, 0x74, 0xFF, 0xDA, 0x71, 0x9F, 0xFE, 0xA7, 0x0A, 0xCA, 0x5A, 0xE7,
+    0x0D, 0x96, 0xAD, 0x96, 0x9D, 0x7A, 0xD9, 0x6A, 0xD7, 0xAD, 0x7D, 0xA6, 0x9E, 0x69, 0xD6, 0x9E,
+    0xA6, 0xAD, 0x49, 0xFC, 0x7F, 0xFF, 0xC9, 0x69, 0xFF, 0xEA, 0x70, 0xAF, 0xFD, 0x97, 0x1F, 0xFF,
+    0x97, 0x0F, 0xA9, 0x99, 0xAF, 0x7A, 0xE9, 0x49, 0xE9, 0x6F, 0x6E, 0xA6, 0xF6, 0xEA, 0x5A, 0xF5,
+    0x9E, 0xA5, 0xFA, 0x5A, 0xEA, 0x5F, 0x95, 0xFA, 0x4A, 0xF5, 0x9F, 0xA4, 0xFC, 0x5A, 0xFA, 0x4F,
+    0xC5, 0xFC, 0xA3, 0xAF, 0xA5, 0xFC, 0xA3, 0x77, 0x19, 0xCA, 0x49, 0xCA, 0x4A, 0xCA, 0x2A, 0xCA,
+    0x6E, 0xAD, 0x97, 0x0F, 0x72, 0xAD, 0x74, 0x97, 0x77, 0x77, 0x2D, 0x90, 0x9A, 0xD9, 0x49, 0xDA,
+    0xFC, 0x5F, 0xFC, 0x5F, 0xCA, 0x99, 0xA4, 0x9F, 0x71, 0xAE, 0x72, 0xEA, 0x71, 0x9E, 0x72, 0xAE,
+    0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1F, 0x72, 0xF7, 0x1A, 0xF7, 0x1F, 0xA7, 0x09, 0xFA, 0x70, 0x77,
+    0x4A, 0xA7, 0x75, 0xAC, 0xA7, 0x74, 0x9D, 0x77, 0x5D, 0x97, 0x74, 0xDA, 0x77, 0x4A, 0xD7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x99, 0x99, 0x99, 0x97, 0x69, 0xFF, 0xE7, 0x29,
+    0xFF, 0xFC, 0x72, 0xFF, 0xFC, 0xA7, 0x1F, 0xD9, 0x94, 0x97, 0x1A, 0xF7, 0x73, 0xEA, 0x77, 0x39,
+    0xE7, 0x74, 0xAD, 0xA7, 0x74, 0xF7, 0x74, 0xFC, 0xA9, 0x77, 0x19, 0xFF, 0xA9, 0x76, 0xAF, 0xFD,
+    0xA7, 0x59, 0xFF, 0xE9, 0x76, 0x9A, 0xFF, 0xA7, 0x71, 0xAF, 0xD9, 0x77, 0x1A, 0xFC, 0xA7, 0x71,
+    0xAF, 0xD7, 0x71, 0xFE, 0x59, 0x71, 0xAF, 0xDA, 0x4A, 0xFA, 0xAA, 0xAA, 0xFF, 0xC4, 0xAF, 0xFF,
+    0xFD, 0x93, 0xAF, 0xFF, 0xFD, 0x93, 0xAF, 0xFF, 0xFD, 0x94, 0xAF, 0xFF, 0xF9, 0x79, 0xAF, 0xFD,
+    0xA9, 0x77, 0x77, 0x10, 0x75, 0xAA, 0x75, 0xD7, 0x5A, 0xCA, 0x74, 0x9D, 0x74, 0x9D, 0x97, 0x4D,
+    0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9F, 0xCA, 0xA9, 0x59, 0xFF, 0xC5, 0x9E, 0x99, 0x90,
+    0x99, 0x6D, 0x97, 0x49, 0xD7, 0x59, 0xDA, 0x75, 0xFA, 0x97, 0x29, 0xFD, 0xA7, 0x2A, 0xFD, 0x97,
+    0x39, 0xF7, 0x4A, 0xE4, 0x9C, 0xA9, 0x29, 0xF3, 0x9F, 0xFE, 0xA2, 0xAF, 0xFF, 0x3F, 0xFF, 0x59,
+    0xAF, 0xDA, 0x94, 0x77, 0x09, 0xCA, 0x77, 0x6E, 0x97, 0x74, 0xAF, 0xA7, 0x72, 0x9D, 0x90, 0xAC,
+    0xA7, 0x71, 0xD4, 0xD7, 0x79, 0xA6, 0x9A, 0x77, 0x77, 0x77, 0x77, 0x39, 0x99, 0x99, 0x99, 0x77,
+    0x9F, 0xFE, 0x73, 0x9F, 0xFF, 0xC7, 0x3F, 0xFF, 0xCA, 0x72, 0xFD, 0x99, 0x49, 0x72, 0xAF, 0x77,
+    0x4E, 0xA7, 0x74, 0x9E, 0x77, 0x5A, 0xDA, 0x77, 0x5F, 0x77, 0x5F, 0xCA, 0x97, 0x72, 0x9F, 0xFA,
+    0x97, 0x7A, 0xFF, 0xDA, 0x76, 0x9F, 0xFE, 0x97, 0x79, 0xAF, 0xFA, 0x77, 0x2A, 0xFD, 0x97, 0x72,
+    0xAF, 0xCA, 0x77, 0x2A, 0xFD, 0x77, 0x2F, 0xE6, 0x97, 0x1A, 0xFD, 0xA5, 0xAF, 0xAA, 0xAA, 0xAF,
+    0xFC, 0x5A, 0xFF, 0xFF, 0xD9, 0x4A, 0xFF, 0xFF, 0xD9, 0x4A, 0xFF, 0xFF, 0xD9, 0x5A, 0xFF, 0xFF,
+    0x97, 0x09, 0xAF, 0xFD, 0xA9, 0x77, 0x77, 0x30, 0x71, 0xD7, 0x79, 0xE7, 0x6F, 0xC9, 0x73, 0xAC,
+    0xA1, 0xDA, 0x71, 0x9C, 0xA3, 0x9D, 0x70, 0xA9, 0x69, 0x97, 0x77, 0x77, 0x69, 0xFC, 0xAA, 0x97,
+    0x9F, 0xFC, 0x79, 0xE9, 0x99, 0x09, 0x97, 0x0D, 0x97, 0x69, 0xD7, 0x79, 0xDA, 0x77, 0xFA, 0x97,
+    0x49, 0xFD, 0xA7, 0x4A, 0xFD, 0x97, 0x59, 0xF7, 0x6A, 0xE6, 0x9C, 0xA9, 0x29, 0xF5, 0x9F, 0xFE,
+    0xA4, 0xAF, 0xFF, 0x5F, 0xFF, 0x79, 0xAF, 0xDA, 0x96, 0x76, 0x99, 0x99, 0x99, 0x97, 0x69, 0xFF,
+    0xE7, 0x29, 0xFF, 0xFC, 0x72, 0xFF, 0xFC, 0xA7, 0x1F, 0xD9, 0x94, 0x97, 0x1A, 0xF7, 0x73, 0xEA,
+    0x77, 0x39, 0xE7, 0x74, 0xAD, 0xA7, 0x74, 0xF7, 0x74, 0xFC, 0xA9, 0x77, 0x19, 0xFF, 0xA9, 0x76,
+    0xAF, 0xFD, 0xA7, 0x59, 0xFF, 0xE9, 0x76, 0x9A, 0xFF, 0xA7, 0x71, 0xAF, 0xD9, 0x77, 0x1A, 0xFC,
+    0xA7, 0x71, 0xAF, 0xD7, 0x71, 0xFE, 0x59, 0x71, 0xAF, 0xDA, 0x4A, 0xFA, 0xAA, 0xAA, 0xFF, 0xC4,
+    0xAF, 0xFF, 0xFD, 0x93, 0xAF, 0xFF, 0xFD, 0x93, 0xAF, 0xFF, 0xFD, 0x94, 0xAF, 0xFF, 0xF9, 0x79,
+    0xAF, 0xFD, 0xA9, 0x77, 0x2A, 0x77, 0x6E, 0x97, 0x77, 0xA9, 0x77, 0x6A, 0xA7, 0x75, 0xAC, 0x77,
+    0x3F, 0x97, 0x73, 0xAA, 0x97, 0x50, 0x79, 0xFC, 0xAA, 0x95, 0x9F, 0xFC, 0x59, 0xE9, 0x99, 0x09,
+    0x96, 0xD9, 0x74, 0x9D, 0x75, 0x9D, 0xA7, 0x5F, 0xA9, 0x72, 0x9F, 0xDA, 0x72, 0xAF, 0xD9, 0x73,
+    0x9F, 0x74, 0xAE, 0x49, 0xCA, 0x92, 0x9F, 0x39, 0xFF, 0xEA, 0x2A, 0xFF, 0xF3, 0xFF, 0xF5, 0x9A,
+    0xFD, 0xA9, 0x72, 0x99, 0x76, 0xA7, 0x6A, 0xDA, 0x77, 0xAA, 0x76, 0x9C, 0x75, 0x9C, 0x97, 0x2F,
+    0xA7, 0x3A, 0xA9, 0x97, 0x00, 0x74, 0x97, 0x97, 0x6D, 0x5D, 0x76, 0x9D, 0x2A, 0xCA, 0x77, 0x09,
+    0xDA, 0xD9, 0x77, 0x2F, 0x77, 0x49, 0xD7, 0x76, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x29, 0x99, 0x99, 0x99, 0x76, 0x9F, 0xFE, 0x72, 0x9F, 0xFF, 0xC7, 0x2F, 0xFF, 0xCA, 0x71, 0xFD,
+    0x99, 0x49, 0x71, 0xAF, 0x77, 0x3E, 0xA7, 0x73, 0x9E, 0x77, 0x4A, 0xDA, 0x77, 0x4F, 0x77, 0x4F,
+    0xCA, 0x97, 0x71, 0x9F, 0xFA, 0x97, 0x6A, 0xFF, 0xDA, 0x75, 0x9F, 0xFE, 0x97, 0x69, 0xAF, 0xFA,
+    0x77, 0x1A, 0xFD, 0x97, 0x71, 0xAF, 0xCA, 0x77, 0x1A, 0xFD, 0x77, 0x1F, 0xE5, 0x97, 0x1A, 0xFD,
+    0xA4, 0xAF, 0xAA, 0xAA, 0xAF, 0xFC, 0x4A, 0xFF, 0xFF, 0xD9, 0x3A, 0xFF, 0xFF, 0xD9, 0x3A, 0xFF,
+    0xFF, 0xD9, 0x4A, 0xFF, 0xFF, 0x97, 0x9A, 0xFF, 0xDA, 0x97, 0x77, 0x71, 0x76, 0x95, 0x9C, 0xA4,
+    0x9C, 0xA6, 0xAC, 0xA2, 0xD9, 0x70, 0xEA, 0xD7, 0x3F, 0x74, 0xAD, 0x76, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x72, 0x9F, 0xCA, 0xA9, 0x59, 0xFF, 0xC5, 0x9E, 0x99, 0x90, 0x99, 0x6D, 0x97, 0x49, 0xD7,
+    0x59, 0xDA, 0x75, 0xFA, 0x97, 0x29, 0xFD, 0xA7, 0x2A, 0xFD, 0x97, 0x39, 0xF7, 0x4A, 0xE4, 0x9C,
+    0xA9, 0x29, 0xF3, 0x9F, 0xFE, 0xA2, 0xAF, 0xFF, 0x3F, 0xFF, 0x59, 0xAF, 0xDA, 0x94, 0x1F, 0xFF,
+    0xFF, 0x19, 0xFF, 0xFF, 0xF1, 0xAF, 0xFF, 0xFE, 0xA1, 0xAA, 0xA9, 0x99, 0x1A, 0xE4, 0x99, 0x97,
+    0x2E, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9E, 0x97, 0x71,
+    0xAE, 0x77, 0x2F, 0x77, 0x19, 0xEA, 0x77, 0x1A, 0xE9, 0x77, 0x1F, 0x77, 0x2F, 0x77, 0x19, 0xEA,
+    0x77, 0x1F, 0xA7, 0x71, 0xF9, 0x77, 0x09, 0xF7, 0x71, 0xAF, 0x77, 0x1F, 0xA7, 0x70, 0x9F, 0x97,
+    0x70, 0xAF, 0x77, 0x1F, 0xC7, 0x74, 0xA7, 0x74, 0xAE, 0x97, 0x74, 0x9C, 0x77, 0x39, 0xCA, 0x77,
+    0x0F, 0xC7, 0x71, 0xAA, 0xA9, 0x76, 0x77, 0x4A, 0xC7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x70,
+    0x9D, 0xA5, 0xFF, 0xE0, 0xAF, 0xFE, 0x39, 0xE7, 0x0A, 0xD9, 0x70, 0xE7, 0x09, 0xE7, 0x0A, 0xDA,
+    0x70, 0xE9, 0x79, 0xE7, 0x0A, 0xDA, 0x70, 0xE9, 0x79, 0xE9, 0x7A, 0xFE, 0x93, 0xFF, 0x93, 0xFF,
+    0x93, 0xFF, 0x96, 0xC7, 0x29, 0xEA, 0x73, 0xC7, 0x2A, 0xC6, 0x9F, 0x96, 0x9A, 0xA9, 0x60, 0x69,
+    0x70, 0x97, 0x3A, 0xC9, 0x4A, 0xC9, 0x74, 0xD9, 0x19, 0xD7, 0x7D, 0xAD, 0xA7, 0x70, 0x9E, 0xA7,
+    0x72, 0xDA, 0x77, 0x49, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1F, 0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0xF1,
+    0xAF, 0xFF, 0xFE, 0xA1, 0xAA, 0xA9, 0x99, 0x1A, 0xE4, 0x99, 0x97, 0x2E, 0xA7, 0x72, 0xE9, 0x77,
+    0x19, 0xE7, 0x72, 0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9E, 0x97, 0x71, 0xAE, 0x77, 0x2F, 0x77, 0x19,
+    0xEA, 0x77, 0x1A, 0xE9, 0x77, 0x1F, 0x77, 0x2F, 0x77, 0x19, 0xEA, 0x77, 0x1F, 0xA7, 0x71, 0xF9,
+    0x77, 0x09, 0xF7, 0x71, 0xAF, 0x77, 0x1F, 0xA7, 0x70, 0x9F, 0x97, 0x70, 0xAF, 0x77, 0x1F, 0xC7,
+    0x60, 0x77, 0x76, 0xAC, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x09, 0xC2, 0xDA, 0x7D, 0xA1, 0x9D, 0x96,
+    0xAD, 0x91, 0xAD, 0x7E, 0x74, 0x9D, 0xA7, 0x1F, 0xFE, 0x4A, 0xFF, 0xE7, 0x9E, 0x74, 0xAD, 0x97,
+    0x4E, 0x74, 0x9E, 0x74, 0xAD, 0xA7, 0x4E, 0x97, 0x39, 0xE7, 0x4A, 0xDA, 0x74, 0xE9, 0x73, 0x9E,
+    0x97, 0x3A, 0xFE, 0x97, 0xFF, 0x97, 0xFF, 0x97, 0xFF, 0x96, 0x1F, 0xFF, 0xFF, 0x19, 0xFF, 0xFF,
+    0xF1, 0xAF, 0xFF, 0xFE, 0xA1, 0xAA, 0xA9, 0x99, 0x1A, 0xE3, 0x99, 0x99, 0x72, 0xEA, 0x77, 0x2E,
+    0x97, 0x71, 0x9E, 0x77, 0x2A, 0xE7, 0x72, 0xEA, 0x77, 0x2E, 0x97, 0x71, 0x9E, 0x97, 0x71, 0xF7,
+    0x5A, 0xFF, 0xF7, 0x1F, 0xFF, 0xC7, 0x09, 0xFF, 0xFA, 0x75, 0xF7, 0x71, 0x9F, 0x77, 0x1A, 0xEA,
+    0x77, 0x1F, 0x97, 0x70, 0x9F, 0x77, 0x1A, 0xF7, 0x71, 0xFA, 0x77, 0x09, 0xF9, 0x77, 0x0A, 0xF7,
+    0x71, 0xFC, 0x76, 0x77, 0x70, 0xAC, 0x72, 0x9D, 0xA7, 0x2A, 0xD9, 0x72, 0xE7, 0x29, 0xDA, 0x7F,
+    0xFE, 0x2A, 0xFF, 0xE5, 0x9E, 0x72, 0xAD, 0xA7, 0x2E, 0x95, 0xFF, 0xFC, 0x1F, 0xFF, 0xA0, 0xAF,
+    0xFF, 0x95, 0xE7, 0x2A, 0xE7, 0x2E, 0x97, 0x2E, 0x97, 0x1A, 0xFE, 0x95, 0xFF, 0x95, 0xFF, 0x95,
+    0xFF, 0x92, 0x75, 0x99, 0x93, 0x99, 0x77, 0xAE, 0x92, 0xCA, 0x76, 0x9C, 0xA0, 0xAC, 0x2C, 0x97,
+    0x6D, 0x19, 0xC9, 0x0D, 0x77, 0xCA, 0x2A, 0xEA, 0x77, 0x5A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x2A, 0xAA, 0xA9, 0x70, 0x9A, 0xAA, 0xA9, 0x49, 0xF9, 0x70, 0xAF, 0x5A, 0xF7, 0x1F,
+    0xC5, 0xFA, 0x71, 0xFA, 0x5F, 0x97, 0x09, 0xF9, 0x49, 0xF7, 0x1A, 0xF5, 0xAF, 0x71, 0xFA, 0x5F,
+    0x97, 0x1F, 0x95, 0xF7, 0x19, 0xF6, 0xF7, 0x19, 0xEA, 0x59, 0xEA, 0x71, 0xAE, 0x95, 0xAE, 0x97,
+    0x1F, 0x6F, 0x72, 0xF6, 0xEA, 0x71, 0x9E, 0x95, 0x9E, 0x97, 0x1A, 0xE6, 0xAE, 0x72, 0xF6, 0xF7,
+    0x1A, 0xE9, 0x6F, 0x71, 0xF7, 0xF9, 0x7F, 0xC6, 0x9F, 0xCA, 0x99, 0x99, 0xAF, 0xD9, 0x69, 0xFF,
+    0xFF, 0xC7, 0x9F, 0xFF, 0xF9, 0x70, 0xFF, 0xFE, 0xA7, 0x1A, 0xFF, 0xFC, 0xA7, 0x39, 0xAF, 0xFC,
+    0xA9, 0x77, 0x77, 0x30, 0x7A, 0xD9, 0x29, 0xC7, 0xAD, 0xAC, 0x2A, 0xC7, 0xD1, 0xCA, 0x1C, 0xA6,
+    0xAC, 0x91, 0xAC, 0xAD, 0x7D, 0x3A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9D, 0x96, 0xAD, 0x92,
+    0xAD, 0x7E, 0x3E, 0x7E, 0x3E, 0x69, 0xDA, 0x29, 0xDA, 0x6A, 0xD9, 0x2A, 0xD9, 0x6E, 0x3A, 0xD6,
+    0x9E, 0x3E, 0x6A, 0xDA, 0x3D, 0xA6, 0xE9, 0x29, 0xDA, 0x5A, 0xE9, 0x2A, 0xE4, 0xAF, 0x3A, 0xFF,
+    0xFC, 0x3A, 0xFF, 0xFA, 0x3A, 0xFF, 0xF9, 0x39, 0xFF, 0x9E, 0x59, 0xFC, 0xA0, 0x9E, 0x77, 0x50,
+    0x77, 0x59, 0x76, 0xAA, 0xFF, 0xCA, 0x74, 0xFF, 0xFA, 0x74, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x70, 0xFA, 0x70, 0xAF, 0x94, 0x9F, 0x71, 0xAF, 0x5A, 0xF7, 0x1F, 0xC5, 0xFA,
+    0x71, 0xF9, 0x5F, 0x97, 0x09, 0xF5, 0x9F, 0x71, 0xAF, 0x5A, 0xEA, 0x71, 0xFA, 0x5F, 0x97, 0x1F,
+    0x6F, 0x71, 0x9F, 0x59, 0xF7, 0x1A, 0xEA, 0x5A, 0xEA, 0x71, 0xF9, 0x5A, 0xE7, 0x2F, 0x6F, 0x72,
+    0xEA, 0x6E, 0xA7, 0x19, 0xE9, 0x59, 0xE9, 0x71, 0xF6, 0xAE, 0x72, 0xF6, 0xF7, 0x1A, 0xE9, 0x6F,
+    0x71, 0xF7, 0xF9, 0x7F, 0xA6, 0x9F, 0xCA, 0x99, 0x99, 0xAF, 0xD9, 0x69, 0xFF, 0xFF, 0xC7, 0x9F,
+    0xFF, 0xF9, 0x70, 0xFF, 0xFE, 0xA7, 0x1A, 0xFF, 0xFC, 0xA7, 0x39, 0xAF, 0xFC, 0xA9, 0x77, 0x77,
+    0x30, 0x77, 0x99, 0x6A, 0xAF, 0xFD, 0x59, 0xFF, 0xF5, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x59,
+    0xD9, 0x6A, 0xD9, 0x3A, 0xD7, 0xE4, 0xE7, 0xE4, 0xE6, 0x9D, 0xA3, 0x9D, 0xA6, 0xAD, 0x93, 0xAD,
+    0x96, 0xE4, 0xAD, 0x69, 0xE4, 0xE6, 0xAD, 0xA4, 0xDA, 0x6E, 0x93, 0x9D, 0xA5, 0xAE, 0x93, 0xAE,
+    0x4A, 0xF4, 0xAF, 0xFF, 0xC4, 0xAF, 0xFF, 0xA4, 0xAF, 0xFF, 0x94, 0x9F, 0xF9, 0xE6, 0x9F, 0xCA,
+    0x09, 0xE7, 0x77, 0x73, 0xD6, 0x9C, 0x97, 0x5D, 0x6D, 0x76, 0xE3, 0x9D, 0xA7, 0x6A, 0xFF, 0xA7,
+    0x70, 0xFE, 0x97, 0x72, 0x9A, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6F,
+    0x97, 0x09, 0xF9, 0x49, 0xF9, 0x70, 0xAF, 0x5A, 0xF7, 0x1F, 0xC5, 0xFA, 0x71, 0xFA, 0x5F, 0x97,
+    0x09, 0xF5, 0x9F, 0x71, 0xAF, 0x5A, 0xF7, 0x1F, 0xA5, 0xF9, 0x71, 0xF9, 0x5F, 0x71, 0x9F, 0x6F,
+    0x71, 0xAE, 0xA5, 0x9E, 0xA7, 0x1A, 0xE9, 0x5A, 0xE7, 0x2F, 0x6F, 0x72, 0xEA, 0x6E, 0xA7, 0x19,
+    0xE9, 0x59, 0xE9, 0x71, 0xF6, 0xAE, 0x72, 0xF6, 0xF7, 0x1A, 0xE9, 0x6F, 0x71, 0xF7, 0xF9, 0x7F,
+    0xC6, 0x9F, 0xCA, 0x99, 0x99, 0xAF, 0xD9, 0x69, 0xFF, 0xFF, 0xC7, 0x9F, 0xFF, 0xF9, 0x70, 0xFF,
+    0xFE, 0xA7, 0x1A, 0xFF, 0xFC, 0xA7, 0x39, 0xAF, 0xFC, 0xA9, 0x77, 0x77, 0x30, 0x59, 0xC9, 0x6D,
+    0x6A, 0xCA, 0x59, 0xC9, 0x6A, 0xD9, 0x3A, 0xD7, 0x0F, 0xFC, 0x71, 0x9F, 0xDA, 0x74, 0xAA, 0xAA,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0xD9, 0x6A, 0xD9, 0x3A, 0xD7, 0xE4, 0xE7, 0xE4, 0xE6, 0x9D,
+    0xA3, 0x9D, 0xA6, 0xAD, 0x93, 0xAD, 0x96, 0xE4, 0xAD, 0x69, 0xE4, 0xE6, 0xAD, 0xA4, 0xDA, 0x6E,
+    0x93, 0x9D, 0xA5, 0xAE, 0x93, 0xAE, 0x4A, 0xF4, 0xAF, 0xFF, 0xC4, 0xAF, 0xFF, 0xA4, 0xAF, 0xFF,
+    0x94, 0x9F, 0xF9, 0xE6, 0x9F, 0xCA, 0x09, 0xE7, 0x77, 0x77, 0x0A, 0xD7, 0x75, 0xCA, 0x09, 0xC7,
+    0x73, 0x9C, 0x2C, 0x77, 0x3C, 0x91, 0x9C, 0x77, 0x3C, 0xA1, 0xCA, 0x77, 0x3A, 0xF7, 0x75, 0xAC,
+    0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6F, 0x97, 0x09, 0xF9, 0x49, 0xF9, 0x70,
+    0xAF, 0x5A, 0xF7, 0x1F, 0xC5, 0xFA, 0x71, 0xFA, 0x5F, 0x97, 0x09, 0xF9, 0x49, 0xF7, 0x1A, 0xF5,
+    0xAF, 0x71, 0xFA, 0x5F, 0x97, 0x1F, 0x95, 0xF7, 0x19, 0xF6, 0xF7, 0x1A, 0xEA, 0x59, 0xEA, 0x71,
+    0xAE, 0x95, 0xAE, 0x72, 0xF6, 0xF7, 0x2E, 0xA6, 0xEA, 0x71, 0x9E, 0x95, 0x9E, 0x97, 0x1F, 0x6A,
+    0xE7, 0x2F, 0x6F, 0x71, 0xAE, 0x96, 0xF7, 0x1F, 0x7F, 0x97, 0xFC, 0x69, 0xFC, 0xA9, 0x99, 0x9A,
+    0xFD, 0x96, 0x9F, 0xFF, 0xFC, 0x79, 0xFF, 0xFF, 0x97, 0x0F, 0xFF, 0xEA, 0x71, 0xAF, 0xFF, 0xCA,
+    0x73, 0x9A, 0xFF, 0xCA, 0x97, 0x77, 0x73, 0x72, 0x9D, 0xA7, 0x49, 0xC9, 0x0C, 0x97, 0x3C, 0x91,
+    0xAA, 0x72, 0x9C, 0x2C, 0xA7, 0x29, 0xC1, 0x9C, 0x74, 0xFA, 0x74, 0x9A, 0xA9, 0x77, 0x77, 0x77,
+    0x77, 0x76, 0x9D, 0x96, 0xAD, 0x92, 0xAD, 0x7E, 0x3E, 0x7E, 0x3E, 0x69, 0xDA, 0x29, 0xDA, 0x6A,
+    0xD9, 0x2A, 0xD9, 0x6E, 0x3A, 0xD6, 0x9E, 0x3E, 0x6A, 0xDA, 0x3D, 0xA6, 0xE9, 0x29, 0xDA, 0x5A,
+    0xE9, 0x2A, 0xE4, 0xAF, 0x3A, 0xFF, 0xFC, 0x3A, 0xFF, 0xFA, 0x3A, 0xFF, 0xF9, 0x39, 0xFF, 0x9E,
+    0x59, 0xFC, 0xA0, 0x9E, 0x77, 0x50, 0x74, 0x99, 0x70, 0x99, 0x97, 0x39, 0xDA, 0x7A, 0xDA, 0x72,
+    0xAE, 0x7A, 0xE7, 0x2A, 0xE7, 0xAE, 0x72, 0xAD, 0xA7, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x75, 0xF9, 0x70, 0x9F, 0x96, 0x9F, 0x97, 0x0A, 0xF7, 0xAF, 0x71, 0xFC, 0x7F,
+    0xA7, 0x1F, 0xA7, 0xF9, 0x70, 0x9F, 0x79, 0xF7, 0x1A, 0xF7, 0xAF, 0x71, 0xFA, 0x7F, 0x97, 0x1F,
+    0x97, 0xF7, 0x19, 0xF7, 0x0F, 0x71, 0xAE, 0xA7, 0x9E, 0xA7, 0x1A, 0xE9, 0x7A, 0xE7, 0x2F, 0x70,
+    0xF7, 0x2E, 0xA7, 0x0E, 0xA7, 0x19, 0xE9, 0x79, 0xE9, 0x71, 0xF7, 0x0A, 0xE7, 0x2F, 0x70, 0xF7,
+    0x1A, 0xE9, 0x70, 0xF7, 0x1F, 0x71, 0xF9, 0x7F, 0xC7, 0x09, 0xFC, 0xA9, 0x99, 0x9A, 0xFD, 0x97,
+    0x09, 0xFF, 0xFF, 0xC7, 0x19, 0xFF, 0xFF, 0x97, 0x2F, 0xFF, 0xEA, 0x73, 0xAF, 0xFF, 0xCA, 0x75,
+    0x9A, 0xFF, 0xCA, 0x97, 0x77, 0x77, 0x59, 0xAA, 0x97, 0x9A, 0xA5, 0x9E, 0x79, 0xDA, 0x49, 0xE7,
+    0x9E, 0x4A, 0xE7, 0xAE, 0x49, 0xAA, 0x97, 0x9A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9D,
+    0x96, 0xAD, 0x96, 0xAD, 0x7E, 0x7E, 0x7E, 0x7E, 0x69, 0xDA, 0x69, 0xDA, 0x6A, 0xD9, 0x6A, 0xD9,
+    0x6E, 0x7A, 0xD6, 0x9E, 0x7E, 0x6A, 0xDA, 0x7D, 0xA6, 0xE9, 0x69, 0xDA, 0x5A, 0xE9, 0x6A, 0xE4,
+    0xAF, 0x7A, 0xFF, 0xFC, 0x7A, 0xFF, 0xFA, 0x7A, 0xFF, 0xF9, 0x79, 0xFF, 0x9E, 0x71, 0x9F, 0xCA,
+    0x09, 0xE7, 0x77, 0x50, 0x5F, 0x97, 0x09, 0xF9, 0x49, 0xF9, 0x70, 0xAF, 0x5A, 0xF7, 0x1F, 0xC5,
+    0xFA, 0x71, 0xFA, 0x5F, 0x97, 0x09, 0xF5, 0x9F, 0x71, 0xAF, 0x5A, 0xF7, 0x1F, 0xA5, 0xF9, 0x71,
+    0xF9, 0x5F, 0x71, 0x9F, 0x6F, 0x71, 0xAE, 0xA5, 0x9E, 0xA7, 0x1A, 0xE9, 0x5A, 0xE7, 0x2F, 0x6F,
+    0x72, 0xEA, 0x6E, 0xA7, 0x19, 0xE9, 0x59, 0xE9, 0x71, 0xF6, 0xAE, 0x72, 0xF6, 0xF7, 0x1A, 0xE9,
+    0x6F, 0x71, 0xF7, 0xF9, 0x7F, 0xC6, 0x9F, 0xCA, 0x99, 0x99, 0xAF, 0xD9, 0x69, 0xFF, 0xFF, 0xC7,
+    0x9F, 0xFF, 0xF9, 0x70, 0xFF, 0xFE, 0xA7, 0x1A, 0xFF, 0xFD, 0x73, 0x9A, 0xFF, 0xCA, 0x97, 0x73,
+    0x9C, 0xA7, 0x75, 0x9C, 0x97, 0x76, 0xD7, 0x77, 0xAE, 0xA7, 0x75, 0x9E, 0x77, 0x77, 0x50, 0x29,
+    0xD9, 0x6A, 0xD9, 0x2A, 0xD7, 0xE3, 0xE7, 0xE3, 0xE6, 0x9D, 0xA2, 0x9D, 0xA6, 0xAD, 0x92, 0xAD,
+    0x96, 0xE3, 0xAD, 0x69, 0xE3, 0xE6, 0xAD, 0xA3, 0xDA, 0x6E, 0x92, 0x9D, 0xA5, 0xAE, 0x92, 0xAE,
+    0x4A, 0xF3, 0xAF, 0xFF, 0xC3, 0xAF, 0xFF, 0xA3, 0xAF, 0xFF, 0x93, 0x9F, 0xF9, 0xE5, 0x9F, 0xCA,
+    0x09, 0xE7, 0x4A, 0xCA, 0x75, 0xAC, 0xA7, 0x5A, 0xCA, 0x76, 0xCA, 0x76, 0x9C, 0x97, 0x7F, 0x97,
+    0x59, 0xD9, 0x50, 0x76, 0x9A, 0x77, 0x76, 0xE7, 0x77, 0x4A, 0xF7, 0x77, 0x29, 0xD9, 0xAD, 0x97,
+    0x77, 0x0D, 0x92, 0xAC, 0x97, 0x76, 0xD6, 0xCA, 0x77, 0x77, 0x74, 0xEA, 0x77, 0x5A, 0xE2, 0xEA,
+    0x77, 0x5E, 0xA2, 0xEA, 0x77, 0x4F, 0x29, 0xEA, 0x77, 0x39, 0xEA, 0x29, 0xEA, 0x77, 0x3F, 0x39,
+    0xEA, 0x77, 0x29, 0xEA, 0x39, 0xEA, 0x77, 0x2F, 0x49, 0xEA, 0x6A, 0xE6, 0x9E, 0xA4, 0xAE, 0x95,
+    0x9F, 0x6F, 0x5A, 0xE9, 0x5F, 0xC5, 0xAE, 0xA5, 0xAE, 0x94, 0xFD, 0x94, 0xF6, 0xAE, 0x93, 0xFE,
+    0xA3, 0xAE, 0xA6, 0xAE, 0x92, 0xAF, 0xF3, 0xF7, 0xF9, 0x19, 0xFA, 0xF2, 0xAE, 0xA7, 0xF9, 0x1F,
+    0xA0, 0xF2, 0xF7, 0x0F, 0x90, 0xFC, 0x1F, 0x90, 0xAE, 0x97, 0x0F, 0x9A, 0xF9, 0x1F, 0xA9, 0xF7,
+    0x1F, 0xAF, 0xA2, 0xFA, 0xF9, 0x71, 0xFF, 0xC3, 0xAF, 0xF7, 0x2F, 0xF9, 0x3A, 0xFE, 0x97, 0x2F,
+    0xEA, 0x4A, 0xFE, 0x73, 0xFE, 0x59, 0xFD, 0x97, 0x3F, 0xD9, 0x59, 0xFD, 0x73, 0x9F, 0xCA, 0x7F,
+    0xC9, 0x73, 0x9F, 0xC7, 0x0F, 0xC7, 0x40, 0x71, 0xD7, 0x73, 0xAE, 0x77, 0x2F, 0xC7, 0x70, 0xDA,
+    0x09, 0xD9, 0x75, 0xAC, 0x93, 0xAC, 0x97, 0x4A, 0x96, 0xA9, 0x77, 0x77, 0x77, 0x29, 0xE7, 0x5E,
+    0xA0, 0x9E, 0x74, 0x9E, 0x19, 0xE7, 0x4E, 0xA1, 0x9E, 0x73, 0x9E, 0x29, 0xE4, 0xAA, 0x4E, 0xA2,
+    0x9E, 0x3E, 0x92, 0x9E, 0x39, 0xE2, 0xFC, 0x2E, 0xA3, 0x9E, 0x1F, 0xD9, 0x09, 0xE4, 0x9E, 0x0F,
+    0xF0, 0xEA, 0x49, 0xEA, 0xFF, 0xAE, 0x59, 0xFF, 0xFE, 0x95, 0x9F, 0xEA, 0xFE, 0x69, 0xFD, 0x1F,
+    0xD9, 0x69, 0xFC, 0x2F, 0xD7, 0xAF, 0x92, 0xAF, 0x97, 0xAE, 0x93, 0x9F, 0x70, 0x70, 0x9A, 0x97,
+    0x71, 0xE7, 0x70, 0x9F, 0x77, 0xDA, 0x9D, 0x97, 0x4D, 0x92, 0xAC, 0xA7, 0x2A, 0xC9, 0x5A, 0xC7,
+    0x77, 0x77, 0x6E, 0xA7, 0x3E, 0x90, 0xF7, 0x2E, 0xA1, 0xAE, 0x71, 0xAE, 0x29, 0xE9, 0x7A, 0xE4,
+    0xF6, 0x9E, 0x94, 0xF6, 0xEA, 0x5A, 0xE9, 0x4F, 0x6A, 0xEA, 0x3F, 0x79, 0xF2, 0xAE, 0x97, 0x0F,
+    0x90, 0xAE, 0xA7, 0x1F, 0xA9, 0xF7, 0x2A, 0xFF, 0x97, 0x29, 0xFE, 0x97, 0x39, 0xFD, 0xA7, 0x5F,
+    0xD7, 0x6F, 0xC9, 0x76, 0xFA, 0x77, 0xF9, 0x76, 0xAF, 0x77, 0xFC, 0x76, 0xAF, 0xA7, 0x6F, 0xC9,
+    0x75, 0x9F, 0xC7, 0x6F, 0xD7, 0x59, 0xFC, 0xA7, 0x50, 0x73, 0x9C, 0xA7, 0x72, 0xEA, 0x77, 0x09,
+    0xFA, 0x77, 0xD9, 0x0A, 0xD7, 0x5D, 0x93, 0xAC, 0x97, 0x29, 0xA6, 0x9A, 0x77, 0x77, 0x77, 0x77,
+    0x71, 0xDA, 0x70, 0xE6, 0xE7, 0x9D, 0x96, 0xAD, 0x96, 0xE7, 0xAD, 0xA5, 0xAD, 0x97, 0x9E, 0x5E,
+    0x71, 0xE4, 0xE9, 0x71, 0xEA, 0x29, 0xE7, 0x2A, 0xE2, 0xE9, 0x72, 0x9E, 0x1A, 0xE7, 0x4E, 0xA0,
+    0xE9, 0x74, 0xFA, 0xE7, 0x5A, 0xFD, 0x97, 0x59, 0xFD, 0x77, 0xFC, 0x97, 0x7F, 0xC7, 0x70, 0xF9,
+    0x77, 0x9F, 0x77, 0x0F, 0x97, 0x69, 0xFC, 0x75, 0x9F, 0xD7, 0x3F, 0xFC, 0x74, 0xFE, 0xA7, 0x49,
+    0xFD, 0x97, 0x5A, 0xDA, 0x97, 0x70, 0x7E, 0x4E, 0x70, 0xAE, 0x3A, 0xE7, 0x0F, 0x3F, 0x7A, 0xEA,
+    0x2A, 0xEA, 0x7F, 0x92, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6E, 0xA7, 0x3E, 0x90, 0xF7, 0x2E,
+    0xA1, 0xAE, 0x71, 0xAE, 0x29, 0xE9, 0x7A, 0xE4, 0xF6, 0x9E, 0x94, 0xF6, 0xEA, 0x5A, 0xE9, 0x4F,
+    0x6A, 0xEA, 0x3F, 0x79, 0xF2, 0xAE, 0x97, 0x0F, 0x90, 0xAE, 0xA7, 0x1F, 0xA9, 0xF7, 0x2A, 0xFF,
+    0x97, 0x29, 0xFE, 0x97, 0x39, 0xFD, 0xA7, 0x5F, 0xD7, 0x6F, 0xC9, 0x76, 0xFA, 0x77, 0xF9, 0x76,
+    0xAF, 0x77, 0xFC, 0x76, 0xAF, 0xA7, 0x6F, 0xC9, 0x75, 0x9F, 0xC7, 0x6F, 0xD7, 0x59, 0xFC, 0xA7,
+    0x50, 0x77, 0x4D, 0x77, 0x71, 0xD9, 0x77, 0x70, 0xAC, 0xA7, 0x77, 0x09, 0xD7, 0x77, 0x1D, 0xA7,
+    0x77, 0x0A, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xFF, 0xFF, 0xD7, 0x2F,
+    0xFF, 0xFC, 0xA7, 0x2F, 0xFF, 0xFC, 0x97, 0x2F, 0xFF, 0xFC, 0x77, 0x6F, 0xCA, 0x77, 0x5F, 0xCA,
+    0x77, 0x49, 0xFC, 0xA7, 0x74, 0x9F, 0xCA, 0x77, 0x4A, 0xFC, 0x97, 0x74, 0xFD, 0x97, 0x73, 0x9F,
+    0xD7, 0x74, 0x9F, 0xD7, 0x74, 0xAF, 0xD7, 0x74, 0xFD, 0xA7, 0x74, 0xFD, 0xA7, 0x73, 0x9F, 0xDA,
+    0x77, 0x3A, 0xFD, 0x97, 0x73, 0xFE, 0x97, 0x73, 0xFE, 0x77, 0x39, 0xFE, 0x77, 0x39, 0xFF, 0xFF,
+    0xEA, 0x7F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x69, 0xFF, 0xFF, 0xFC, 0x6A, 0xFF, 0xFF, 0xFC,
+    0x60, 0x77, 0xAA, 0x77, 0x09, 0xCA, 0x77, 0x9D, 0x77, 0x0D, 0x97, 0x7A, 0xD7, 0x7A, 0xD7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x7F, 0xFF, 0x69, 0xFF, 0xF6, 0x9F, 0xFF, 0x76, 0xEA, 0x75, 0x9E,
+    0xA7, 0x5A, 0xE9, 0x74, 0x9F, 0x75, 0xAE, 0xA7, 0x5F, 0x97, 0x49, 0xF9, 0x74, 0xAF, 0x75, 0xFA,
+    0x75, 0xFC, 0xAA, 0xAA, 0xAA, 0xA6, 0xAF, 0xFF, 0x95, 0xFF, 0xFC, 0xA4, 0x9F, 0xFF, 0xD4, 0x77,
+    0x1E, 0x77, 0x70, 0xAE, 0x77, 0x70, 0xF7, 0x77, 0x9F, 0x77, 0x7A, 0xEA, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x79, 0xFF, 0xFF, 0xD7, 0x2F, 0xFF, 0xFC, 0xA7, 0x2F, 0xFF, 0xFC, 0x97, 0x2F, 0xFF,
+    0xFC, 0x77, 0x6F, 0xCA, 0x77, 0x5F, 0xCA, 0x77, 0x49, 0xFC, 0xA7, 0x74, 0x9F, 0xCA, 0x77, 0x4A,
+    0xFC, 0x97, 0x74, 0xFD, 0x97, 0x73, 0x9F, 0xD7, 0x74, 0x9F, 0xD7, 0x74, 0xAF, 0xD7, 0x74, 0xFD,
+    0xA7, 0x74, 0xFD, 0xA7, 0x73, 0x9F, 0xDA, 0x77, 0x3A, 0xFD, 0x97, 0x73, 0xFE, 0x97, 0x73, 0xFE,
+    0x77, 0x39, 0xFE, 0x77, 0x39, 0xFF, 0xFF, 0xEA, 0x7F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x69,
+    0xFF, 0xFF, 0xFC, 0x6A, 0xFF, 0xFF, 0xFC, 0x60, 0x74, 0xE9, 0x76, 0x9E, 0x97, 0x6F, 0x76, 0x9F,
+    0x76, 0xAE, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2F, 0xFF, 0x69, 0xFF, 0xF6, 0x9F, 0xFF, 0x76,
+    0xEA, 0x75, 0x9E, 0xA7, 0x5A, 0xE9, 0x74, 0x9F, 0x75, 0xAE, 0xA7, 0x5F, 0x97, 0x49, 0xF9, 0x74,
+    0xAF, 0x75, 0xFA, 0x75, 0xFC, 0xAA, 0xAA, 0xAA, 0xA6, 0xAF, 0xFF, 0x95, 0xFF, 0xFC, 0xA4, 0x9F,
+    0xFF, 0xD4, 0x73, 0x9A, 0x95, 0x9A, 0x97, 0x71, 0xAC, 0x93, 0xAC, 0x97, 0x73, 0xDA, 0x0A, 0xD7,
+    0x76, 0xFA, 0x77, 0x7A, 0xDA, 0x77, 0x71, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x9F, 0xFF, 0xFD, 0x72, 0xFF, 0xFF, 0xCA, 0x72, 0xFF, 0xFF, 0xC9, 0x72, 0xFF, 0xFF, 0xC7, 0x76,
+    0xFC, 0xA7, 0x75, 0xFC, 0xA7, 0x74, 0x9F, 0xCA, 0x77, 0x49, 0xFC, 0xA7, 0x74, 0xAF, 0xC9, 0x77,
+    0x4F, 0xD9, 0x77, 0x39, 0xFD, 0x77, 0x49, 0xFD, 0x77, 0x4A, 0xFD, 0x77, 0x4F, 0xDA, 0x77, 0x4F,
+    0xDA, 0x77, 0x39, 0xFD, 0xA7, 0x73, 0xAF, 0xD9, 0x77, 0x3F, 0xE9, 0x77, 0x3F, 0xE7, 0x73, 0x9F,
+    0xE7, 0x73, 0x9F, 0xFF, 0xFE, 0xA7, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC6, 0x9F, 0xFF, 0xFF,
+    0xC6, 0xAF, 0xFF, 0xFF, 0xC6, 0x77, 0x73, 0xD5, 0xAC, 0x72, 0xD2, 0xAD, 0x73, 0x9D, 0xAD, 0xA7,
+    0x5A, 0xE9, 0x77, 0xD9, 0x77, 0x09, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5F, 0xFF, 0x69, 0xFF,
+    0xF6, 0x9F, 0xFF, 0x76, 0xEA, 0x75, 0x9E, 0xA7, 0x5A, 0xE9, 0x74, 0x9F, 0x75, 0xAE, 0xA7, 0x5F,
+    0x97, 0x49, 0xF9, 0x74, 0xAF, 0x75, 0xFA, 0x75, 0xFC, 0xAA, 0xAA, 0xAA, 0xA6, 0xAF, 0xFF, 0x95,
+    0xFF, 0xFC, 0xA4, 0x9F, 0xFF, 0xD4, 0x77, 0x71, 0xFA, 0x70, 0x9F, 0xD7, 0x9E, 0x91, 0x97, 0xE7,
+    0x3A, 0xD9, 0x73, 0xDA, 0x73, 0x9D, 0x97, 0x3E, 0x74, 0xDA, 0x73, 0x9D, 0xA7, 0x3A, 0xD9, 0x73,
+    0xE7, 0x4E, 0x73, 0xAD, 0xA7, 0x3E, 0x97, 0x3E, 0x73, 0x9E, 0x73, 0xEA, 0x73, 0xE9, 0x72, 0x9E,
+    0x73, 0xAE, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x20, 0x77, 0x77, 0x99, 0x77, 0x77, 0x0A, 0xC7, 0x49,
+    0xAF, 0xDA, 0x72, 0xD7, 0x2A, 0xFF, 0xEA, 0x79, 0xCA, 0x70, 0x9F, 0xEA, 0xFE, 0x6D, 0x70, 0x9F,
+    0xC9, 0x4A, 0xFA, 0x39, 0xD9, 0x79, 0xFA, 0x7A, 0xF2, 0xAD, 0xA7, 0x0F, 0x97, 0x1F, 0x92, 0xC9,
+    0x70, 0xFA, 0x72, 0xAE, 0xA7, 0x49, 0xEA, 0x73, 0x9E, 0xA7, 0x4F, 0x75, 0xEA, 0x73, 0x9E, 0x97,
+    0x5E, 0x97, 0x3F, 0x76, 0xE9, 0x73, 0xE9, 0x75, 0x9E, 0x73, 0x9E, 0x76, 0xAE, 0x73, 0xAE, 0x76,
+    0xE9, 0x73, 0xEA, 0x75, 0x9E, 0x74, 0xEA, 0x75, 0xF7, 0x4F, 0x74, 0xF9, 0x74, 0xFA, 0x71, 0x9F,
+    0xC7, 0x5F, 0xD9, 0x92, 0x99, 0xAF, 0xD9, 0x75, 0xFF, 0xFF, 0xF7, 0x6A, 0xFF, 0xFF, 0xD7, 0x70,
+    0xFF, 0xFF, 0xC9, 0x77, 0x0A, 0xFF, 0xFE, 0x77, 0x39, 0xFF, 0xFA, 0x77, 0x69, 0xAF, 0xDA, 0x97,
+    0x77, 0x77, 0x75, 0x77, 0x77, 0x7A, 0xA6, 0x9A, 0xFA, 0x4C, 0xA5, 0xAF, 0xF9, 0x19, 0xC4, 0x9F,
+    0xAA, 0xAF, 0x09, 0xCA, 0x4E, 0x94, 0x9F, 0xC4, 0xE7, 0xE9, 0x49, 0xD9, 0x7E, 0x5E, 0x70, 0xE4,
+    0x9D, 0x97, 0x0E, 0x4A, 0xD7, 0x0A, 0xD9, 0x4E, 0x70, 0xE5, 0xE9, 0x6E, 0xA5, 0xFA, 0x99, 0x99,
+    0xAF, 0x6A, 0xFF, 0xF7, 0x0F, 0xFE, 0x97, 0x09, 0xFF, 0xA7, 0x4A, 0xFA, 0x97, 0x10, 0x69, 0xFF,
+    0xCA, 0x97, 0x09, 0xFF, 0xFD, 0x6A, 0xFD, 0xAA, 0xAF, 0xE4, 0x9F, 0xD9, 0x59, 0xE9, 0x3E, 0xAE,
+    0x7A, 0xDA, 0x29, 0xD9, 0x9E, 0x79, 0xDA, 0x2A, 0xCA, 0x0E, 0xA7, 0xAD, 0xA2, 0xD1, 0xE9, 0x7E,
+    0x3D, 0x09, 0xE7, 0xF3, 0xA9, 0x0A, 0xE4, 0x9A, 0xF9, 0x6F, 0xFF, 0xDA, 0x69, 0xFF, 0xFC, 0xA7,
+    0xAF, 0xFE, 0xA7, 0x1F, 0xCA, 0xAA, 0xA9, 0x73, 0x9E, 0xA7, 0x71, 0xAE, 0x97, 0x71, 0xF9, 0x77,
+    0x09, 0xF7, 0x71, 0xAF, 0x77, 0x1F, 0xA7, 0x71, 0xF9, 0x77, 0x0A, 0xF7, 0x71, 0xFC, 0x77, 0x1F,
+    0xC7, 0x70, 0xAF, 0xA7, 0x70, 0x77, 0x77, 0x1A, 0xE7, 0x71, 0xFA, 0x77, 0x09, 0xEA, 0x97, 0x70,
+    0xE7, 0x73, 0xDA, 0x19, 0xAC, 0xA9, 0x73, 0xAD, 0x99, 0xFE, 0x72, 0xAD, 0xAF, 0xAA, 0xE7, 0x1F,
+    0xCA, 0x4D, 0x97, 0x9F, 0xA5, 0xDA, 0x7A, 0xEA, 0x6A, 0xCA, 0x7F, 0x7D, 0xA7, 0xEA, 0x7D, 0x96,
+    0xAE, 0xA6, 0x9D, 0x7F, 0x96, 0xE7, 0xFC, 0x5A, 0xD9, 0x69, 0xFD, 0x92, 0xAE, 0x7A, 0xFF, 0xFC,
+    0x70, 0xFF, 0xFC, 0xA7, 0xAE, 0x9F, 0xFA, 0x70, 0xE9, 0x09, 0xFD, 0x97, 0x09, 0xE4, 0x99, 0x73,
+    0xEA, 0x77, 0x19, 0xE7, 0x72, 0xEA, 0x77, 0x19, 0xE7, 0x72, 0xF7, 0x71, 0x9E, 0x97, 0x77, 0x77,
+    0x00, 0x49, 0xFF, 0xF9, 0x4A, 0xFF, 0xF5, 0x9C, 0xA7, 0x70, 0xD7, 0x71, 0xD7, 0x70, 0x9C, 0xA7,
+    0x70, 0xD7, 0x71, 0xD7, 0x70, 0x9C, 0xA7, 0x70, 0xD7, 0x70, 0x9C, 0x77, 0x9C, 0xA7, 0x6A, 0xCA,
+    0x76, 0xD9, 0x75, 0x9D, 0x97, 0x5A, 0xD7, 0x6D, 0xA7, 0x59, 0xE7, 0x6F, 0xFF, 0xC4, 0x9F, 0xFF,
+    0x94, 0xAF, 0xFF, 0x77, 0x70, 0x1F, 0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0xF1, 0xAF, 0xFF, 0xFE, 0xA1,
+    0xFF, 0xAE, 0x49, 0x99, 0x2A, 0xD9, 0x3E, 0xA7, 0x29, 0xC5, 0xE9, 0x73, 0x94, 0x9E, 0x77, 0x2A,
+    0xE7, 0x72, 0xEA, 0x77, 0x19, 0xE9, 0x77, 0x1A, 0xE7, 0x72, 0xF7, 0x71, 0x9E, 0xA7, 0x71, 0xAE,
+    0x97, 0x71, 0xF7, 0x72, 0xF7, 0x71, 0x9E, 0xA7, 0x71, 0xFA, 0x77, 0x1F, 0x97, 0x70, 0x9F, 0x77,
+    0x1A, 0xF7, 0x71, 0xFA, 0x77, 0x09, 0xF9, 0x77, 0x0A, 0xF7, 0x71, 0xFC, 0x76, 0x77, 0x71, 0x9A,
+    0xC7, 0x2F, 0x71, 0xFA, 0x70, 0xAE, 0xA7, 0x09, 0xE7, 0x19, 0xE7, 0x2A, 0xD9, 0x72, 0xE7, 0x29,
+    0xDA, 0x7F, 0xFE, 0x2A, 0xFF, 0xE5, 0x9E, 0x72, 0xAD, 0x97, 0x2E, 0x72, 0x9E, 0x72, 0xAD, 0xA7,
+    0x2E, 0x97, 0x19, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x71, 0x9E, 0x97, 0x1A, 0xFE, 0x95, 0xFF, 0x95,
+    0xFF, 0x95, 0xFF, 0x94, 0x1F, 0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0xF1, 0xAF, 0xFF, 0xFE, 0xA1, 0xAA,
+    0xA9, 0x99, 0x1A, 0xE4, 0x99, 0x97, 0x2E, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xAE, 0x77,
+    0x2E, 0xA7, 0x71, 0x9E, 0x97, 0x71, 0xAE, 0x77, 0x2F, 0x77, 0x2E, 0xA7, 0x71, 0xAE, 0x97, 0x71,
+    0xF9, 0x77, 0x1F, 0x77, 0x19, 0xF7, 0x71, 0xAE, 0xA7, 0x71, 0xF9, 0x77, 0x09, 0xF7, 0x71, 0xAF,
+    0x77, 0x1F, 0xA7, 0x71, 0xF9, 0x77, 0x0A, 0xF7, 0x71, 0xFC, 0x77, 0x1F, 0xC9, 0x77, 0x0F, 0xD9,
+    0x77, 0xFE, 0xA7, 0x7F, 0xDA, 0x77, 0x0A, 0xF9, 0x77, 0x2A, 0xAC, 0x74, 0x77, 0x73, 0xA6, 0xFA,
+    0x70, 0x9F, 0x90, 0x9C, 0x94, 0x9F, 0x71, 0xAF, 0x1D, 0x94, 0xAF, 0x71, 0xFF, 0xC5, 0xFA, 0x71,
+    0xFF, 0x6F, 0x97, 0x09, 0xF9, 0x97, 0x9F, 0x71, 0xAF, 0x71, 0xAE, 0xA7, 0x1F, 0xA7, 0x1F, 0x97,
+    0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xAE,
+    0x72, 0xF7, 0x2F, 0x72, 0xEA, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0xF7, 0x2A, 0xE7,
+    0x2F, 0x72, 0xF7, 0x1A, 0xE9, 0x72, 0xF7, 0x1F, 0x73, 0xF9, 0x7F, 0xA7, 0x29, 0xFC, 0xA9, 0x99,
+    0x9A, 0xFD, 0x97, 0x29, 0xFF, 0xFF, 0xC7, 0x39, 0xFF, 0xFF, 0x97, 0x4F, 0xFF, 0xEA, 0x75, 0xAF,
+    0xFF, 0xCA, 0x77, 0x9A, 0xFF, 0xCA, 0x97, 0x77, 0x77, 0x30, 0x77, 0x29, 0x97, 0x72, 0xCA, 0x29,
+    0xD9, 0x6A, 0xD9, 0x9C, 0x92, 0xAD, 0x7E, 0x9D, 0x3E, 0x7F, 0xC4, 0xE6, 0x9F, 0x49, 0xDA, 0x6A,
+    0xD9, 0x5A, 0xD9, 0x6E, 0x6A, 0xD6, 0x9E, 0x6E, 0x6A, 0xDA, 0x6D, 0xA6, 0xE9, 0x59, 0xDA, 0x5A,
+    0xE6, 0xAE, 0x4A, 0xF6, 0xAF, 0xFF, 0xC6, 0xAF, 0xFF, 0xA6, 0xAF, 0xFF, 0x96, 0x9F, 0xF9, 0xE7,
+    0x09, 0xFC, 0xA0, 0x9E, 0x77, 0x73, 0x0D, 0xA5, 0x9E, 0x5A, 0xE5, 0xF7, 0x99, 0x00, 0x39, 0xA9,
+    0x29, 0xD3, 0xD9, 0x2D, 0xA2, 0xAD, 0x29, 0xD9, 0x20, 0x3A, 0xC9, 0x71, 0xE7, 0x0F, 0xC9, 0x5A,
+    0xD1, 0xDA, 0x39, 0xCA, 0x39, 0xD2, 0xAA, 0x6A, 0xA0, 0x2A, 0xD9, 0x29, 0xC2, 0xAC, 0xAD, 0x2A,
+    0xC2, 0xCA, 0x1C, 0x91, 0xCA, 0x1A, 0xC9, 0x1A, 0xCA, 0xD2, 0xD3, 0xE9, 0x76, 0x71, 0x99, 0x99,
+    0x1F, 0xFF, 0x0A, 0xFF, 0xEA, 0x75, 0x77, 0x4A, 0xAA, 0xAA, 0xFF, 0xE1, 0xFF, 0xFF, 0xC7, 0x73,
+    0x0D, 0x69, 0xC9, 0x0D, 0x6D, 0x1D, 0xA3, 0x9D, 0x91, 0xAF, 0xFA, 0x3F, 0xE9, 0x59, 0xAA, 0xA9,
+    0x40, 0x1E, 0x90, 0x9E, 0x1F, 0x09, 0xF0, 0xAE, 0xA0, 0x1A, 0xD9, 0x3A, 0xD9, 0x1E, 0x93, 0xE9,
+    0x0A, 0xE9, 0x2A, 0xE1, 0xF3, 0xF0, 0xAF, 0x2A, 0xF0, 0x0A, 0xE9, 0x09, 0x91, 0x9C, 0x4D, 0x29,
+    0xD3, 0xCA, 0x71, 0x2A, 0xD9, 0x2C, 0x91, 0xC1, 0xAA, 0x2C, 0x1C, 0x91, 0xAC, 0x1A, 0xF3, 0xAC,
+    0xA2, 0x3A, 0xD9, 0x7A, 0xD3, 0xAD, 0x97, 0xAD, 0x92, 0xEA, 0x7E, 0xA2, 0xF7, 0xF2, 0x99, 0x71,
+    0x99, 0x50, 0x9C, 0x95, 0xAC, 0x90, 0xAC, 0xA2, 0x9D, 0x3D, 0xA9, 0xDA, 0x5F, 0x96, 0xAD, 0x97,
+    0x0A, 0x95, 0x09, 0x97, 0x19, 0x96, 0xE9, 0x7E, 0x95, 0xE9, 0x7E, 0x95, 0xE9, 0x69, 0xE9, 0x49,
+    0xAA, 0xC9, 0x69, 0xAA, 0xC9, 0x00, 0x0A, 0xF5, 0xFA, 0x4A, 0xF5, 0xF9, 0x4A, 0xEA, 0x5F, 0x59,
+    0xF5, 0xF9, 0x71, 0x75, 0x9F, 0xA3, 0xFC, 0x4F, 0x93, 0xAF, 0x4F, 0x93, 0x9E, 0xA4, 0xF4, 0xAE,
+    0xA3, 0x72, 0xFA, 0x4A, 0xF5, 0xF9, 0x49, 0xF5, 0xF5, 0x9F, 0x5F, 0x94, 0x9F, 0x00, 0x39, 0xA4,
+    0xAC, 0x19, 0x99, 0xD1, 0xF9, 0x39, 0xC4, 0xAC, 0x70, 0x0A, 0x94, 0xCA, 0x4A, 0xC9, 0x99, 0x19,
+    0xF2, 0xC9, 0x4C, 0xA7, 0x10, 0xAE, 0xAA, 0xA9, 0x99, 0x1F, 0xFE, 0x91, 0x99, 0x99, 0x99, 0xE7,
+    0x0E, 0x70, 0xDA, 0x79, 0xD9, 0x7A, 0xD1, 0x71, 0xC9, 0x3C, 0x3A, 0xC2, 0xAC, 0x91, 0xDA, 0x2A,
+    0x92, 0x19, 0xC9, 0x09, 0xC2, 0xC9, 0x2C, 0x3A, 0xC3, 0x91, 0x71, 0xC9, 0x4C, 0x91, 0x9E, 0xA2,
+    0xAF, 0x93, 0x9A, 0xA0, 0xAA, 0x93, 0xAF, 0xA2, 0xAE, 0x2A, 0xC4, 0xAC, 0x71, 0x71, 0x9A, 0x4A,
+    0x92, 0xFC, 0x3C, 0x49, 0xA7, 0x10, 0x71, 0x99, 0x91, 0x9F, 0xFE, 0x90, 0xFF, 0xF9, 0x75, 0x19,
+    0xD9, 0x1E, 0x90, 0xAE, 0x90, 0xF0, 0xAF, 0x00, 0x2E, 0x4E, 0x2A, 0xE3, 0xAE, 0x2F, 0x3F, 0x19,
+    0xF2, 0xAF, 0x1A, 0xEA, 0x2A, 0xEA, 0x00, 0x2A, 0xD9, 0x2C, 0x91, 0xC1, 0xAA, 0x2C, 0x1C, 0x91,
+    0xAC, 0x1A, 0xF3, 0xAC, 0xA2, 0x75, 0xFC, 0x39, 0xF9, 0x3F, 0xC4, 0xF4, 0x9E, 0xA4, 0xF4, 0xAE,
+    0xA3, 0x9F, 0x76, 0x29, 0x95, 0xC5, 0xA6, 0xEA, 0x6C, 0x95, 0xC9, 0x1A, 0xAD, 0xA1, 0xAE, 0xA2,
+    0x4A, 0x93, 0x9C, 0xA3, 0x9C, 0xA4, 0xCA, 0x4A, 0xC5, 0x9F, 0x39, 0xAD, 0x71, 0x2D, 0xA2, 0xD9,
+    0x1A, 0xD2, 0xE1, 0x9D, 0xA1, 0xAD, 0x91, 0xE2, 0xAA, 0xA1, 0x1A, 0xAA, 0xAA, 0xAA, 0xA1, 0x9F,
+    0xF1, 0xAC, 0x92, 0x9C, 0xA1, 0xD3, 0xAC, 0x91, 0xAA, 0x3A, 0xA1, 0x9A, 0x69, 0xA9, 0x0D, 0x93,
+    0xAC, 0x92, 0xD9, 0x0A, 0xD4, 0x9F, 0xA6, 0xAD, 0xA7, 0x9C, 0xA5, 0x29, 0xA9, 0x70, 0xE7, 0x9F,
+    0x6D, 0xA9, 0xD9, 0x3D, 0x92, 0xAC, 0xA1, 0xAC, 0x95, 0xAC, 0x00, 0x2A, 0xD9, 0x29, 0xC2, 0xAC,
+    0xAD, 0x2A, 0xC2, 0xCA, 0x1C, 0x91, 0xCA, 0x1A, 0xC9, 0x1A, 0xCA, 0xD2, 0xD3, 0xE9, 0x76, 0x73,
+    0xAF, 0xFA, 0x0A, 0xAA, 0xAA, 0xAA, 0x99, 0x90, 0x76, 0xAF, 0xFC, 0x1A, 0xFF, 0xAA, 0x75, 0x2A,
+    0xD9, 0x29, 0xC2, 0xAC, 0xAD, 0x2A, 0xC2, 0xCA, 0x1C, 0x91, 0xCA, 0x1A, 0xC9, 0x1A, 0xCA, 0xD2,
+    0xD3, 0xE9, 0x76, 0x0F, 0xFF, 0xC9, 0xFF, 0xF9, 0xAF, 0xFF, 0x00, 0x0C, 0xA3, 0xCA, 0x3C, 0x3C,
+    0x2D, 0x29, 0x10, 0x09, 0x93, 0x99, 0x2D, 0x3A, 0xC9, 0x1A, 0xC9, 0x29, 0xCA, 0x19, 0xDA, 0xAA,
+    0xE2, 0xFF, 0x00, 0x74, 0xFF, 0x19, 0xC4, 0xCA, 0x1A, 0xC4, 0xC9, 0x1C, 0xA3, 0x9C, 0x2C, 0x93,
+    0xAC, 0x19, 0xFE, 0xA2, 0x99, 0x99, 0x99, 0x92, 0x2D, 0xA0, 0x9A, 0x3A, 0xA0, 0x9C, 0x90, 0xA2,
+    0xC1, 0x9A, 0x1C, 0x19, 0xA1, 0xA1, 0xAA, 0x1C, 0x91, 0xC1, 0xC9, 0x19, 0x29, 0x1A, 0x10, 0x19,
+    0xA1, 0xA3, 0xC9, 0xC9, 0x3A, 0xC9, 0x4D, 0x4C, 0x9C, 0xA1, 0x9C, 0x90, 0x9C, 0x10, 0x2A, 0xD9,
+    0x29, 0xC2, 0xAC, 0xAD, 0x2A, 0xC2, 0xCA, 0x1C, 0x91, 0xCA, 0x1A, 0xC9, 0x1A, 0xCA, 0xD2, 0xD3,
+    0xE9, 0x76, 0x09, 0xC2, 0x9D, 0x3C, 0x19, 0xD1, 0xA9, 0x10, 0x72, 0xAA, 0x72, 0xAC, 0x97, 0x19,
+    0xD7, 0x2D, 0x72, 0xDA, 0x71, 0xAD, 0x77, 0x77, 0x1A, 0xD9, 0x3A, 0xD9, 0x1E, 0x93, 0xE9, 0x0A,
+    0xE9, 0x2A, 0xE1, 0xF3, 0xF0, 0xAF, 0x2A, 0xF0, 0x0A, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xF9, 0x0D,
+    0x3D, 0x09, 0xCA, 0x3D, 0x0A, 0xA3, 0x9A, 0x90, 0x75, 0x94, 0xAA, 0xFF, 0xC9, 0x2F, 0xFF, 0x92,
+    0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x19, 0x99, 0x99, 0x3F, 0xFE, 0xA2, 0xFF, 0xFA, 0x77, 0x10,
+    0x19, 0xD4, 0xD9, 0x1A, 0xD3, 0xAD, 0x2D, 0xA3, 0xE1, 0x9D, 0x93, 0xDA, 0x1E, 0x3A, 0xD2, 0xE3,
+    0xE1, 0x9D, 0xA2, 0x9D, 0xA1, 0x9A, 0xA3, 0x9A, 0xA9, 0x10, 0x09, 0xA9, 0x99, 0x99, 0x2A, 0xFE,
+    0x1F, 0xF5, 0x9D, 0xA5, 0xAD, 0x95, 0xE9, 0x5A, 0xAA, 0x10, 0x77, 0x71, 0xC9, 0x72, 0x9A, 0x73,
+    0xC7, 0x3C, 0x97, 0x29, 0xA5, 0xAD, 0x91, 0xCA, 0xC3, 0xAC, 0xAD, 0x0C, 0x9A, 0xC3, 0xCA, 0x1E,
+    0x0C, 0xA2, 0xAC, 0x91, 0xAF, 0x3D, 0x2F, 0x97, 0x9C, 0x73, 0xC7, 0x3C, 0xA7, 0x29, 0xC7, 0x3C,
+    0x97, 0x29, 0x72, 0x73, 0xAD, 0x77, 0x7E, 0x77, 0x6A, 0xE7, 0x76, 0xEA, 0x77, 0x09, 0xAF, 0xCA,
+    0x97, 0x0E, 0x93, 0xFC, 0xAA, 0xEA, 0x6F, 0x3F, 0x93, 0xEA, 0x4A, 0xE3, 0xF6, 0xAE, 0xAA, 0xFC,
+    0x3A, 0xE9, 0x79, 0xAF, 0xCA, 0x95, 0xDA, 0x77, 0x6A, 0xDA, 0x77, 0x6E, 0xA7, 0x76, 0x99, 0x97,
+    0x76, 0x59, 0x99, 0x97, 0x59, 0xFD, 0x5D, 0x92, 0x9E, 0x1A, 0xD3, 0x9D, 0x3E, 0x3D, 0xA1, 0x9D,
+    0x92, 0xAD, 0x5F, 0xDA, 0x75, 0x9A, 0xAA, 0x97, 0x77, 0x77, 0x5A, 0xF9, 0x59, 0x94, 0xEA, 0xAD,
+    0x93, 0x9D, 0x92, 0xE3, 0xD9, 0x2D, 0xA2, 0xAD, 0x93, 0x9F, 0xE3, 0x99, 0xA5, 0x9F, 0xA7, 0x77,
+    0x00, 0x19, 0x74, 0xE9, 0x72, 0xAA, 0x77, 0x77, 0x77, 0x59, 0x74, 0xAD, 0x72, 0xAA, 0xC7, 0x70,
+    0x09, 0x91, 0xD9, 0x1C, 0x2A, 0x00, 0x0A, 0x77, 0x39, 0xA0, 0x9A, 0x77, 0x1A, 0xC9, 0x1A, 0xC7,
+    0x6A, 0xD4, 0x9D, 0x99, 0x69, 0xAE, 0x97, 0x9A, 0xFF, 0xCA, 0x97, 0x77, 0x50, 0x49, 0xAF, 0xFA,
+    0x97, 0x1A, 0xCA, 0x99, 0x59, 0x9A, 0xDA, 0x5C, 0xA7, 0x59, 0xAC, 0x92, 0xC9, 0x77, 0x1C, 0xA1,
+    0xA7, 0x73, 0xA9, 0x77, 0x69, 0x77, 0x73, 0xDA, 0x3A, 0xFF, 0xFF, 0xFF, 0xC9, 0x1F, 0xFF, 0xFF,
+    0xFD, 0x97, 0x76, 0xE9, 0x77, 0x70, 0xA9, 0x77, 0x77, 0x10, 0x77, 0xEA, 0x77, 0x1A, 0xEA, 0x77,
+    0x1F, 0xC7, 0x70, 0xFD, 0x77, 0x9D, 0xAE, 0x77, 0xE0, 0xE7, 0x6E, 0x90, 0xE9, 0x74, 0x9E, 0x1E,
+    0x97, 0x4E, 0x2E, 0x97, 0x3A, 0xDA, 0x2A, 0xDA, 0x72, 0x9E, 0x3A, 0xDA, 0x72, 0xE9, 0x3A, 0xE7,
+    0x1A, 0xE4, 0xAE, 0x70, 0x9E, 0x59, 0xE7, 0x0E, 0xA5, 0x9E, 0x7A, 0xE6, 0x9E, 0x96, 0xE9, 0x7E,
+    0x95, 0xFF, 0xFF, 0xA4, 0xAF, 0xFF, 0xFA, 0x4F, 0xFF, 0xFC, 0xA3, 0xFF, 0xFF, 0xE2, 0x9E, 0xA7,
+    0x2F, 0x2F, 0x73, 0xF1, 0xAE, 0xA7, 0x3F, 0x09, 0xF7, 0x39, 0xF9, 0x69, 0x99, 0x99, 0x99, 0x99,
+    0x97, 0x29, 0xFF, 0xEA, 0x70, 0xAF, 0xFF, 0xC7, 0xE9, 0x59, 0xE9, 0x6E, 0x70, 0xDA, 0x59, 0xE7,
+    0x0D, 0xA5, 0xAD, 0xA7, 0x9D, 0x95, 0xE7, 0x0E, 0x6E, 0x69, 0xE9, 0x5A, 0xFF, 0xFC, 0x96, 0xFF,
+    0xFA, 0x70, 0xFF, 0xFD, 0x95, 0x9E, 0x7A, 0xE9, 0x4A, 0xDA, 0x70, 0xF4, 0xE9, 0x70, 0x9E, 0x4E,
+    0x71, 0x9E, 0x39, 0xE7, 0x1F, 0x3A, 0xDA, 0x70, 0x9E, 0xA3, 0xE9, 0x70, 0xF9, 0x3E, 0x7A, 0xFC,
+    0x39, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xF4, 0xFF, 0xFF, 0x93, 0x9F, 0xFF, 0xE9, 0x4A, 0xFF, 0xFA,
+    0x70, 0x6F, 0xFF, 0x7F, 0xFE, 0xA6, 0x9F, 0xFE, 0x96, 0xAC, 0xA7, 0x70, 0xD9, 0x77, 0x0D, 0x77,
+    0x0A, 0xD7, 0x70, 0xDA, 0x77, 0x0D, 0x97, 0x79, 0xD7, 0x70, 0xAD, 0x77, 0x0E, 0x77, 0x0D, 0xA7,
+    0x79, 0xD9, 0x77, 0xAD, 0x77, 0x0E, 0x77, 0x0D, 0xA7, 0x79, 0xD9, 0x77, 0xE7, 0x70, 0xE7, 0x79,
+    0xE7, 0x7A, 0xDA, 0x77, 0xE9, 0x77, 0x77, 0x20, 0x77, 0x77, 0x3E, 0xA7, 0x70, 0xAF, 0x77, 0x9F,
+    0xC7, 0x7F, 0xD9, 0x75, 0xEA, 0xEA, 0x74, 0xAE, 0x0A, 0xE7, 0x39, 0xE1, 0xAE, 0x73, 0xE9, 0x19,
+    0xE7, 0x2F, 0x29, 0xE9, 0x70, 0xAE, 0x4E, 0xA7, 0x9E, 0x94, 0xF7, 0xEA, 0x5F, 0x6F, 0x6A, 0xE9,
+    0x4A, 0xE9, 0x6A, 0xE9, 0x39, 0xEA, 0x79, 0xEA, 0x3F, 0x70, 0x9F, 0x2F, 0x97, 0x1F, 0x1A, 0xEA,
+    0x72, 0xF9, 0x0F, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0xF0, 0xAF, 0xFF, 0xFF, 0x00, 0x77, 0x19, 0x99,
+    0x97, 0xAF, 0xFF, 0xD7, 0xFF, 0xFD, 0x97, 0xFF, 0xFC, 0xA7, 0x9E, 0x97, 0x71, 0xE9, 0x77, 0x2E,
+    0x77, 0x29, 0xE7, 0x72, 0xAD, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE9, 0x99, 0x99, 0xAA, 0xA7, 0x2A,
+    0xFF, 0xE7, 0x2F, 0xFE, 0xA7, 0x2F, 0xFE, 0x97, 0x19, 0xE9, 0x77, 0x1E, 0xA7, 0x72, 0xE9, 0x77,
+    0x19, 0xE7, 0x72, 0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9F, 0xFF, 0xD9, 0x6A, 0xFF, 0xFD, 0x96, 0xFF,
+    0xFE, 0x96, 0xFF, 0xFE, 0x95, 0xAF, 0xFF, 0xE6, 0x70, 0x9F, 0xFF, 0xFD, 0x72, 0xFF, 0xFF, 0xCA,
+    0x72, 0xFF, 0xFF, 0xC9, 0x72, 0xFF, 0xFF, 0xC7, 0x76, 0xFC, 0xA7, 0x75, 0xFC, 0xA7, 0x74, 0x9F,
+    0xCA, 0x77, 0x49, 0xFC, 0xA7, 0x74, 0xAF, 0xC9, 0x77, 0x4F, 0xD9, 0x77, 0x39, 0xFD, 0x77, 0x49,
+    0xFD, 0x77, 0x4A, 0xFD, 0x77, 0x4F, 0xDA, 0x77, 0x4F, 0xDA, 0x77, 0x39, 0xFD, 0xA7, 0x73, 0xAF,
+    0xD9, 0x77, 0x3F, 0xE9, 0x77, 0x3F, 0xE7, 0x73, 0x9F, 0xE7, 0x73, 0x9F, 0xFF, 0xFE, 0xA7, 0xFF,
+    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC6, 0x9F, 0xFF, 0xFF, 0xC6, 0xAF, 0xFF, 0xFF, 0xC6, 0x69, 0xAA,
+    0xA7, 0x3A, 0xAA, 0x7A, 0xE7, 0x2A, 0xE7, 0xEA, 0x72, 0xEA, 0x69, 0xE9, 0x71, 0x9E, 0x96, 0xAE,
+    0x72, 0xAE, 0x7F, 0x72, 0xF7, 0xEA, 0x72, 0xEA, 0x69, 0xE9, 0x71, 0x9E, 0x96, 0xF7, 0x2F, 0x7F,
+    0x72, 0xF6, 0x9E, 0xA7, 0x19, 0xF6, 0xAE, 0x97, 0x1A, 0xEA, 0x6F, 0x72, 0xF9, 0x59, 0xFA, 0x99,
+    0x99, 0x99, 0x99, 0x9A, 0xF6, 0xAF, 0xFF, 0xFE, 0x6F, 0xFF, 0xFE, 0xA6, 0xFF, 0xFF, 0xE9, 0x59,
+    0xFF, 0xFF, 0xE6, 0xFF, 0xFF, 0xF6, 0xFA, 0x71, 0xFA, 0x59, 0xF9, 0x70, 0x9F, 0x95, 0xAF, 0x71,
+    0xAF, 0x95, 0xFC, 0x71, 0xFC, 0x6F, 0xA7, 0x09, 0xFC, 0x5A, 0xF9, 0x70, 0xAF, 0xA5, 0x73, 0x9A,
+    0xFD, 0xA7, 0x70, 0xAF, 0xFE, 0xA7, 0x49, 0xFE, 0xAF, 0xE7, 0x29, 0xFC, 0x94, 0xAF, 0xA7, 0x09,
+    0xFA, 0x7A, 0xF7, 0x0F, 0x97, 0x1F, 0x96, 0xFA, 0x72, 0xAE, 0xA5, 0x9E, 0xA7, 0x39, 0xEA, 0x5F,
+    0x75, 0xEA, 0x49, 0xE9, 0x75, 0xE9, 0x4F, 0x69, 0x99, 0xA3, 0xE9, 0x4E, 0x91, 0xAF, 0xF2, 0x9E,
+    0x49, 0xE1, 0x9F, 0xEA, 0xA2, 0xAE, 0x4A, 0xE7, 0x6E, 0x94, 0xEA, 0x75, 0x9E, 0x5E, 0xA7, 0x5F,
+    0x5F, 0x74, 0xF9, 0x5F, 0xA7, 0x19, 0xFC, 0x6F, 0xD9, 0x92, 0x99, 0xAF, 0xD9, 0x6F, 0xFF, 0xFF,
+    0x7A, 0xFF, 0xFF, 0xD7, 0x1F, 0xFF, 0xFC, 0x97, 0x1A, 0xFF, 0xFE, 0x74, 0x9F, 0xFF, 0xA7, 0x79,
+    0xAF, 0xDA, 0x97, 0x77, 0x77, 0x6E, 0xA7, 0xF6, 0x9E, 0xA6, 0xAE, 0x96, 0xAE, 0x7F, 0x7E, 0x96,
+    0x9E, 0x7A, 0xE7, 0xEA, 0x7E, 0x96, 0xAE, 0x7F, 0x7E, 0xA6, 0x9E, 0xA6, 0xAE, 0x96, 0xF7, 0xF6,
+    0xAE, 0xA6, 0xF9, 0x6F, 0x95, 0xAF, 0x6F, 0xC5, 0x9F, 0xA5, 0x9A, 0xEA, 0x50, 0x70, 0xE9, 0x4F,
+    0x70, 0x9E, 0x4F, 0x97, 0x0E, 0xA3, 0xAE, 0x97, 0x1E, 0x92, 0xAE, 0xA7, 0x1A, 0xE2, 0x9E, 0xA7,
+    0x2E, 0xA1, 0x9F, 0x73, 0xE9, 0x1F, 0x73, 0xAE, 0x1F, 0x74, 0xEA, 0x0F, 0x97, 0x39, 0xE9, 0xF9,
+    0x74, 0xAF, 0xEA, 0x75, 0xFE, 0xA7, 0x59, 0xFE, 0x76, 0xAF, 0xD7, 0x7F, 0xF7, 0x59, 0xFF, 0x97,
+    0x4A, 0xFF, 0xC7, 0x4F, 0x0F, 0xD7, 0x29, 0xEA, 0x0A, 0xFC, 0xA7, 0x1F, 0x91, 0xFD, 0x97, 0x0F,
+    0x2A, 0xFD, 0x79, 0xEA, 0x3F, 0xDA, 0x6F, 0x93, 0xAF, 0xD9, 0x5F, 0x49, 0xFE, 0x4A, 0xEA, 0x5F,
+    0xEA, 0x30, 0x75, 0xAF, 0xDA, 0x77, 0xFE, 0xA7, 0x6A, 0xFE, 0xA7, 0x6F, 0xFC, 0x75, 0xFF, 0xD7,
+    0x49, 0xFF, 0xD7, 0x4F, 0xFE, 0x73, 0xAF, 0x1F, 0xC7, 0x3F, 0xA1, 0xFC, 0x72, 0xAF, 0x2A, 0xF7,
+    0x2F, 0x92, 0xAF, 0x97, 0x0F, 0xA3, 0x9F, 0x97, 0x9F, 0x5F, 0x97, 0xF9, 0x5F, 0x96, 0xAE, 0xA6,
+    0xFA, 0x6F, 0x7F, 0xA5, 0xAE, 0x97, 0xAE, 0xA4, 0x9F, 0x70, 0x9F, 0x4F, 0x71, 0x9F, 0x39, 0xEA,
+    0x72, 0xF3, 0xF7, 0x3F, 0x2A, 0xE9, 0x73, 0xF2, 0xEA, 0x74, 0xAE, 0x1A, 0xE7, 0x5A, 0xE1, 0xAA,
+    0xA9, 0x75, 0x9A, 0xAA, 0x00, 0x7A, 0xAA, 0xAA, 0x73, 0xAA, 0xAA, 0xA7, 0x0F, 0xC9, 0x71, 0x9F,
+    0xC7, 0x9F, 0xCA, 0x71, 0xFC, 0xA7, 0xFD, 0xA7, 0x0A, 0xFC, 0x97, 0xFE, 0x79, 0xFD, 0x79, 0xFE,
+    0x7F, 0xE7, 0xAF, 0xE6, 0xAF, 0xE7, 0xFF, 0x59, 0xFE, 0xA6, 0x9E, 0x9F, 0x94, 0xFA, 0xE9, 0x6A,
+    0xDA, 0x9F, 0xA3, 0xAE, 0xAA, 0xE9, 0x6E, 0xA0, 0xFA, 0x29, 0xF0, 0xF6, 0x9E, 0x90, 0xFC, 0x2F,
+    0x99, 0xF6, 0xAE, 0x1F, 0xC1, 0xAE, 0xA0, 0xAE, 0xA6, 0xF1, 0xFC, 0x09, 0xF1, 0xFA, 0x59, 0xEA,
+    0x1A, 0xF9, 0xF9, 0x09, 0xF9, 0x5A, 0xEA, 0x1A, 0xFF, 0xC1, 0xAF, 0x6F, 0x91, 0x9F, 0xF2, 0xFC,
+    0x59, 0xF3, 0xFE, 0xA1, 0x9F, 0xC5, 0xAF, 0x3F, 0xE2, 0xAF, 0xA5, 0xFA, 0x3F, 0xD9, 0x2F, 0xC9,
+    0x5F, 0x93, 0xFC, 0xA2, 0x9F, 0xC5, 0xAF, 0x93, 0xAF, 0x3A, 0xFC, 0x5F, 0xC4, 0xAE, 0x93, 0xFD,
+    0x5F, 0xC7, 0x49, 0xFC, 0xA4, 0xAF, 0xA7, 0x4A, 0xFC, 0x94, 0x77, 0x69, 0xAA, 0xA7, 0x09, 0xEA,
+    0x71, 0xF7, 0x0F, 0xC7, 0x1E, 0xA7, 0x0F, 0xC7, 0x0A, 0xE7, 0x0A, 0xFC, 0x97, 0xF7, 0x0F, 0xDA,
+    0x7E, 0xA7, 0x9F, 0xDA, 0x6A, 0xE9, 0x7A, 0xFE, 0x6F, 0x70, 0xFF, 0x59, 0xEA, 0x79, 0xEA, 0xAE,
+    0x94, 0xAE, 0x97, 0xAE, 0x99, 0xEA, 0x4F, 0x70, 0xF1, 0xEA, 0x39, 0xEA, 0x79, 0xF1, 0xF3, 0xAE,
+    0x97, 0xAE, 0xA1, 0xF3, 0xF7, 0x0F, 0x91, 0xAE, 0x91, 0x9E, 0xA7, 0x9F, 0x29, 0xEA, 0x1A, 0xE9,
+    0x7A, 0xF3, 0xF1, 0xF7, 0x0F, 0xA3, 0xF0, 0x9E, 0xA7, 0x9F, 0x93, 0xF0, 0xF9, 0x7F, 0xC4, 0xAE,
+    0x9F, 0x70, 0xFC, 0x49, 0xFF, 0x79, 0xFA, 0x5F, 0xE9, 0x7F, 0xC9, 0x5F, 0xE7, 0x0F, 0xC6, 0xAF,
+    0xD7, 0xAF, 0xC6, 0xAF, 0xC9, 0x70, 0x6F, 0xFF, 0xE6, 0x9F, 0xFF, 0xE7, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0x99,
+    0x99, 0x99, 0x99, 0x97, 0x39, 0xFF, 0xD7, 0x3A, 0xFF, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x71, 0xFF, 0xFF, 0xCA, 0x39, 0xFF, 0xFF, 0xC9, 0x3A, 0xFF, 0xFF, 0xC4, 0x73, 0x9A, 0xFD,
+    0xA7, 0x70, 0xAF, 0xFE, 0xA7, 0x49, 0xFE, 0xAF, 0xE7, 0x29, 0xFC, 0x94, 0xAF, 0xA7, 0x09, 0xFA,
+    0x7A, 0xF7, 0x0F, 0x97, 0x1F, 0x96, 0xFA, 0x72, 0xAE, 0xA5, 0x9E, 0xA7, 0x39, 0xEA, 0x5F, 0x75,
+    0xEA, 0x49, 0xE9, 0x75, 0xE9, 0x4F, 0x76, 0xE9, 0x4E, 0x97, 0x59, 0xE4, 0x9E, 0x76, 0xAE, 0x4A,
+    0xE7, 0x6E, 0x94, 0xEA, 0x75, 0x9E, 0x5E, 0xA7, 0x5F, 0x5F, 0x74, 0xF9, 0x5F, 0xA7, 0x19, 0xFC,
+    0x6F, 0xD9, 0x92, 0x99, 0xAF, 0xD9, 0x6F, 0xFF, 0xFF, 0x7A, 0xFF, 0xFF, 0xD7, 0x1F, 0xFF, 0xFC,
+    0x97, 0x1A, 0xFF, 0xFE, 0x74, 0x9F, 0xFF, 0xA7, 0x79, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x5F, 0xFF,
+    0xC5, 0xAF, 0xFF, 0xC5, 0xDA, 0x7D, 0xA5, 0xD9, 0x7D, 0x94, 0x9D, 0x79, 0xD5, 0xAD, 0x7A, 0xD5,
+    0xDA, 0x7D, 0xA5, 0xD9, 0x7D, 0x94, 0x9D, 0x79, 0xD5, 0xAD, 0x7A, 0xD5, 0xDA, 0x7D, 0xA5, 0xD9,
+    0x7D, 0x94, 0x9D, 0x79, 0xD5, 0xAD, 0x7A, 0xD5, 0xDA, 0x7D, 0xA5, 0xD9, 0x7D, 0x94, 0x9D, 0x79,
+    0xD5, 0xAD, 0x7E, 0x5D, 0xA7, 0xDA, 0x49, 0xD9, 0x69, 0xD9, 0x4A, 0xD7, 0xAD, 0x50, 0x7F, 0xFC,
+    0xA9, 0x73, 0xFF, 0xF7, 0x19, 0xEA, 0xAA, 0xFE, 0x70, 0xE9, 0x59, 0xE9, 0x7E, 0x7A, 0xDA, 0x69,
+    0xE7, 0x9D, 0xA6, 0xEA, 0x7A, 0xDA, 0x6E, 0x97, 0xE6, 0x9E, 0x7F, 0x6A, 0xE4, 0x9A, 0xF9, 0x6F,
+    0xFF, 0xDA, 0x69, 0xFF, 0xFC, 0xA7, 0xAF, 0xFE, 0xA7, 0x1F, 0xCA, 0xAA, 0xA9, 0x73, 0x9E, 0xA7,
+    0x71, 0xAE, 0x97, 0x71, 0xF9, 0x77, 0x09, 0xF7, 0x71, 0xAF, 0x77, 0x1F, 0xA7, 0x71, 0xF9, 0x77,
+    0x0A, 0xF7, 0x71, 0xFC, 0x77, 0x1F, 0xC7, 0x70, 0xAF, 0xA7, 0x70, 0x49, 0xFF, 0xF9, 0x4A, 0xFF,
+    0xF5, 0x9C, 0xA7, 0x70, 0xD7, 0x71, 0xD7, 0x70, 0x9C, 0xA7, 0x70, 0xD7, 0x71, 0xD7, 0x70, 0x9C,
+    0xA7, 0x70, 0xD7, 0x70, 0x9C, 0x77, 0x9C, 0xA7, 0x6A, 0xCA, 0x76, 0xD9, 0x75, 0x9D, 0x97, 0x5A,
+    0xD7, 0x6D, 0xA7, 0x59, 0xE7, 0x6F, 0xFF, 0xC4, 0x9F, 0xFF, 0x94, 0xAF, 0xFF, 0x77, 0x70, 0x1F,
+    0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0xF1, 0xAF, 0xFF, 0xFE, 0xA1, 0xAA, 0xA9, 0x99, 0x1A, 0xE4, 0x99,
+    0x97, 0x2E, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9E, 0x97,
+    0x71, 0xAE, 0x77, 0x2F, 0x77, 0x19, 0xEA, 0x77, 0x1A, 0xE9, 0x77, 0x1F, 0x77, 0x2F, 0x77, 0x19,
+    0xEA, 0x77, 0x1F, 0xA7, 0x71, 0xF9, 0x77, 0x09, 0xF7, 0x71, 0xAF, 0x77, 0x1F, 0xA7, 0x70, 0x9F,
+    0x97, 0x70, 0xAF, 0x77, 0x1F, 0xC7, 0x60, 0x0E, 0xA7, 0x3E, 0x90, 0xF7, 0x2E, 0xA1, 0xAE, 0x71,
+    0xAE, 0x29, 0xE9, 0x7A, 0xE4, 0xF6, 0x9E, 0x94, 0xF6, 0xEA, 0x5A, 0xE9, 0x4F, 0x6A, 0xEA, 0x3F,
+    0x79, 0xF2, 0xAE, 0x97, 0x0F, 0x90, 0xAE, 0xA7, 0x1F, 0xA9, 0xF7, 0x2A, 0xFF, 0x97, 0x29, 0xFE,
+    0x97, 0x39, 0xFD, 0xA7, 0x5F, 0xD7, 0x6F, 0xC9, 0x76, 0xFA, 0x77, 0xF9, 0x76, 0xAF, 0x77, 0xFC,
+    0x76, 0xAF, 0xA7, 0x6F, 0xC9, 0x75, 0x9F, 0xC7, 0x6F, 0xD7, 0x59, 0xFC, 0xA7, 0x50, 0x77, 0x3A,
+    0xA9, 0x77, 0x75, 0x9D, 0x77, 0x76, 0xAD, 0x77, 0x76, 0xDA, 0x77, 0x76, 0xD9, 0x77, 0x75, 0xAD,
+    0x97, 0x77, 0x09, 0xAF, 0xFE, 0xA7, 0x71, 0xAF, 0xFF, 0xFA, 0x75, 0xAF, 0xDA, 0xAD, 0x19, 0xAF,
+    0xD7, 0x3F, 0xD9, 0x1A, 0xD4, 0xFC, 0xA7, 0x1F, 0xCA, 0x3D, 0x95, 0xFC, 0x70, 0xFC, 0x93, 0x9D,
+    0x6A, 0xF9, 0x6F, 0xC5, 0xAD, 0x69, 0xF6, 0x9F, 0x95, 0xDA, 0x69, 0xF6, 0xF9, 0x59, 0xD7, 0x9F,
+    0x5A, 0xF6, 0xAD, 0x7A, 0xEA, 0x5F, 0x96, 0xDA, 0x7F, 0x6F, 0x7D, 0x96, 0xAF, 0x5A, 0xF6, 0xAD,
+    0x7F, 0x95, 0xAF, 0x6D, 0xA5, 0x9F, 0xA6, 0xFC, 0xA5, 0xD9, 0x39, 0xAF, 0xC7, 0xAF, 0xDA, 0x99,
+    0x9A, 0xD9, 0x9A, 0xAF, 0xE9, 0x79, 0xFF, 0xFF, 0xFE, 0x97, 0x1F, 0xFF, 0xFF, 0xD9, 0x72, 0x9F,
+    0xFF, 0xFF, 0x76, 0xAF, 0xFF, 0xEA, 0x97, 0x71, 0x9A, 0xFF, 0xAA, 0x97, 0x77, 0x09, 0xD7, 0x77,
+    0x6A, 0xD7, 0x77, 0x6A, 0xA9, 0x77, 0x30, 0x7A, 0xD9, 0x73, 0x9D, 0xA7, 0x09, 0xE7, 0x29, 0xE7,
+    0x2E, 0x97, 0x09, 0xE7, 0x3A, 0xE7, 0x9E, 0x97, 0x39, 0xE9, 0x59, 0xE9, 0x75, 0xEA, 0x49, 0xE9,
+    0x76, 0xAE, 0x39, 0xEA, 0x77, 0x9E, 0xA1, 0x9E, 0xA7, 0x71, 0xF0, 0x9E, 0xA7, 0x72, 0xAE, 0xAF,
+    0x77, 0x39, 0xFE, 0x77, 0x5F, 0xD7, 0x76, 0xAF, 0x77, 0x69, 0xFC, 0x97, 0x74, 0x9F, 0xDA, 0x77,
+    0x39, 0xFF, 0x77, 0x29, 0xFA, 0xFA, 0x77, 0x09, 0xFA, 0x0F, 0xC7, 0x79, 0xFA, 0x19, 0xF9, 0x75,
+    0x9F, 0xC3, 0xFC, 0x74, 0x9F, 0xC4, 0xFC, 0x97, 0x3F, 0xC5, 0x9F, 0xC7, 0x2F, 0xC7, 0xFC, 0x71,
+    0xFC, 0x97, 0xAF, 0xA7, 0xFC, 0x97, 0x09, 0xFC, 0x60, 0x2A, 0xAA, 0x5C, 0xA5, 0xCA, 0x3E, 0x49,
+    0xCA, 0x49, 0xD3, 0xD9, 0x4A, 0xC9, 0x4D, 0xA2, 0x9D, 0x5D, 0x5D, 0x92, 0x9D, 0x49, 0xCA, 0x49,
+    0xD3, 0xAC, 0xA4, 0xAC, 0x94, 0xE3, 0xDA, 0x4D, 0x4A, 0xD9, 0x3D, 0xA4, 0xD4, 0xE4, 0xE3, 0x9C,
+    0xA3, 0xEA, 0x4E, 0x92, 0xD3, 0xF5, 0xAE, 0x91, 0xD1, 0x9F, 0x95, 0x9F, 0xAA, 0xDA, 0xFC, 0x97,
+    0xFF, 0xFC, 0x97, 0x1A, 0xFF, 0xCA, 0x75, 0x9A, 0xDA, 0xA9, 0x77, 0x0A, 0xC9, 0x77, 0x3D, 0x77,
+    0x4D, 0x77, 0x39, 0xCA, 0x77, 0x3D, 0x97, 0x73, 0xD7, 0x73, 0x9C, 0xA7, 0x73, 0xAC, 0x97, 0x73,
+    0xD7, 0x73, 0x9D, 0x77, 0x73, 0x9A, 0xFC, 0x97, 0x79, 0xFF, 0xD9, 0x74, 0xAE, 0xA9, 0x2A, 0xE9,
+    0x72, 0xEA, 0x69, 0xE7, 0x1E, 0xA7, 0x0A, 0xD9, 0x7A, 0xE7, 0x2D, 0xA6, 0x9E, 0x73, 0xE6, 0xE9,
+    0x73, 0xE5, 0x9E, 0x74, 0xE5, 0xAD, 0x97, 0x4E, 0x5E, 0x74, 0x9D, 0xA4, 0x9D, 0xA7, 0x4E, 0x94,
+    0xAD, 0xA7, 0x4E, 0x5A, 0xD9, 0x73, 0xAD, 0xA5, 0xAD, 0x97, 0x29, 0xE6, 0xAD, 0x97, 0x19, 0xEA,
+    0x7D, 0xA7, 0x09, 0xF7, 0x0A, 0xD7, 0xAE, 0xA7, 0x19, 0xE9, 0x39, 0xF9, 0x7A, 0xFE, 0x3A, 0xFE,
+    0x49, 0xFE, 0xA3, 0xFF, 0x49, 0xFE, 0x92, 0x9F, 0xF7, 0x77, 0x60, 0x77, 0x77, 0xAE, 0xA7, 0x7A,
+    0xFE, 0x9D, 0x72, 0xFF, 0xEA, 0x71, 0xF9, 0x2A, 0xEA, 0x70, 0x9E, 0x5E, 0x97, 0x0D, 0xA6, 0xE7,
+    0x0A, 0xD7, 0xE7, 0x0D, 0x97, 0xE7, 0x9D, 0x79, 0xDA, 0x7D, 0xA7, 0xEA, 0x7D, 0x96, 0xAE, 0x97,
+    0xDA, 0x5F, 0xC7, 0x0F, 0x99, 0xAA, 0xFD, 0x70, 0xFF, 0xFD, 0x0A, 0x6A, 0xFF, 0xFA, 0x9C, 0xA1,
+    0x99, 0x2F, 0xFA, 0x9D, 0xAF, 0xD9, 0x3A, 0xFA, 0x90, 0x9D, 0xAF, 0xCA, 0x77, 0x70, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xDA, 0x97, 0x5A, 0xFE, 0x73, 0xFF, 0xD7, 0x1E,
+    0xA3, 0xAD, 0xA7, 0xAD, 0x95, 0xAD, 0x69, 0xDA, 0x7D, 0x6A, 0xD9, 0x69, 0xD6, 0xE7, 0xAC, 0xA6,
+    0xE6, 0xAD, 0x69, 0xDA, 0x29, 0x9A, 0xE7, 0xAD, 0x91, 0xAF, 0x97, 0x0E, 0x2F, 0xD9, 0x7E, 0x6A,
+    0xDA, 0x59, 0xD9, 0x7A, 0xD5, 0xAD, 0x70, 0xAD, 0x94, 0xE7, 0x0E, 0x93, 0x9F, 0x95, 0xAE, 0x4A,
+    0xFD, 0x92, 0xAF, 0x4F, 0xFF, 0xE9, 0x4F, 0xFF, 0xE4, 0x9D, 0xA0, 0xAF, 0xFC, 0x5A, 0xD9, 0x29,
+    0xFD, 0x6E, 0x69, 0x99, 0x7D, 0xA7, 0x70, 0x9D, 0x97, 0x70, 0xAD, 0x77, 0x1E, 0x77, 0x1A, 0xA9,
+    0x77, 0x00, 0x9D, 0x97, 0xDA, 0x0D, 0xA7, 0xE0, 0xE6, 0x9D, 0xA0, 0xE6, 0xAD, 0x90, 0xAD, 0x95,
+    0xE1, 0x9D, 0xA4, 0x9E, 0x2E, 0x4A, 0xD9, 0x2E, 0x4E, 0x3E, 0x92, 0xAD, 0xA3, 0xAD, 0xA1, 0x9E,
+    0x49, 0xE1, 0xE9, 0x49, 0xEA, 0xF5, 0x9F, 0xE6, 0x9F, 0xD9, 0x69, 0xFC, 0xA7, 0x9F, 0xC7, 0x0A,
+    0xF7, 0x1A, 0xE9, 0x71, 0xF7, 0x2F, 0x72, 0xF7, 0x19, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0xA7, 0x19,
+    0xA9, 0x97, 0x10, 0x79, 0xAF, 0xDA, 0x96, 0x9F, 0xFF, 0x5E, 0xA9, 0x09, 0x9A, 0xEA, 0x49, 0xD9,
+    0x76, 0x9D, 0x97, 0x7E, 0x77, 0x9E, 0x97, 0x69, 0xE9, 0x76, 0xAE, 0x97, 0x69, 0xE9, 0x75, 0x99,
+    0xE9, 0x71, 0xAF, 0xF7, 0xAF, 0xFD, 0xA5, 0xAF, 0x92, 0xAE, 0x49, 0xF5, 0xEA, 0x3F, 0x6A, 0xE2,
+    0x9E, 0x96, 0xAE, 0x2A, 0xE7, 0xAD, 0xA2, 0xEA, 0x7E, 0x92, 0xF6, 0xF3, 0xFA, 0x39, 0xF9, 0x3A,
+    0xFF, 0xFA, 0x5F, 0xFE, 0xA7, 0xFF, 0xC9, 0x71, 0xAF, 0xA9, 0x70, 0x59, 0xEA, 0x6D, 0xA9, 0x9A,
+    0xC4, 0xD4, 0xC3, 0x9C, 0x59, 0x39, 0xC7, 0x3C, 0x97, 0x29, 0xE9, 0x6A, 0xDA, 0xA6, 0xAC, 0xA7,
+    0x1D, 0x4D, 0x2A, 0xCA, 0x39, 0xD2, 0xAD, 0x3E, 0x29, 0xEA, 0xAE, 0x93, 0xFE, 0x95, 0xAE, 0xA4,
+    0x5A, 0xFF, 0xD5, 0xFF, 0xDA, 0x71, 0x9E, 0x97, 0x2E, 0x97, 0x29, 0xE7, 0x3A, 0xDA, 0x73, 0xAD,
+    0xA7, 0x3A, 0xDA, 0x73, 0x9D, 0xA7, 0x4E, 0x74, 0xAD, 0x75, 0xDA, 0x75, 0xD9, 0x75, 0xE7, 0x5A,
+    0xEA, 0x74, 0xAF, 0xDA, 0x71, 0x9F, 0xD9, 0x73, 0xAE, 0xA7, 0x4E, 0x97, 0x39, 0xE7, 0x39, 0xEA,
+    0x72, 0x9F, 0x72, 0xAF, 0x72, 0xAF, 0x73, 0x99, 0x99, 0x71, 0x77, 0x4E, 0x97, 0x5F, 0x97, 0x59,
+    0xD9, 0x09, 0xFC, 0x95, 0x9F, 0xFE, 0x94, 0xAF, 0xA2, 0x9E, 0x4F, 0x59, 0xD4, 0xE6, 0x9D, 0x3A,
+    0xD9, 0x69, 0xD3, 0xE7, 0xAD, 0x3D, 0xA7, 0xDA, 0x29, 0xDA, 0x69, 0xD9, 0x2E, 0x96, 0xAD, 0x3E,
+    0x7E, 0x29, 0xE6, 0x9D, 0xA2, 0xF6, 0xAD, 0x92, 0xEA, 0x6E, 0x91, 0x9E, 0x95, 0x9E, 0x2A, 0xE6,
+    0xAE, 0x75, 0xEA, 0x75, 0xE9, 0x74, 0xAE, 0x75, 0xF7, 0x5E, 0xA7, 0x4A, 0xE9, 0x74, 0xF7, 0x76,
+    0x70, 0x9F, 0xA7, 0x29, 0xDA, 0x90, 0x9D, 0x97, 0xAD, 0x94, 0xD6, 0x9D, 0x95, 0xD9, 0x5D, 0xA6,
+    0xAC, 0xA4, 0xAD, 0x7A, 0xCA, 0x4D, 0xA7, 0xDA, 0x3A, 0xD9, 0x7D, 0xA3, 0xE9, 0x99, 0x99, 0x99,
+    0x99, 0xD9, 0x29, 0xFF, 0xFD, 0x3A, 0xFF, 0xFD, 0x3E, 0x79, 0xDA, 0x3E, 0x7E, 0x92, 0x9E, 0x69,
+    0xE3, 0x9E, 0x6E, 0xA3, 0xAE, 0x94, 0xF9, 0x3A, 0xFA, 0x99, 0xAF, 0xC4, 0x9F, 0xFF, 0x6F, 0xFE,
+    0x96, 0xFF, 0xDA, 0x70, 0xFF, 0x97, 0x2A, 0xFA, 0x70, 0x5A, 0xA9, 0x5D, 0x94, 0x9D, 0x5A, 0xCA,
+    0x5D, 0x95, 0xD5, 0xAD, 0x5D, 0xA5, 0xD9, 0x49, 0xD5, 0xE5, 0xE4, 0xAD, 0xA4, 0xE9, 0x4E, 0x93,
+    0xAE, 0x4F, 0xAA, 0x90, 0x9F, 0xD1, 0x9F, 0xCA, 0x10, 0x77, 0x5D, 0x92, 0xE5, 0x9D, 0x2A, 0xD6,
+    0xAD, 0x1A, 0xD9, 0x6D, 0x90, 0x9D, 0x96, 0x9D, 0x09, 0xDA, 0x7A, 0xD0, 0xDA, 0x70, 0xDA, 0xE7,
+    0x09, 0xFC, 0x71, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xCA, 0x70, 0xEA, 0xE9, 0x7D, 0xA0, 0xF6, 0xAD,
+    0x90, 0xFA, 0x5E, 0x19, 0xF9, 0x39, 0xDA, 0x2F, 0xC3, 0xAD, 0x92, 0x9F, 0xC2, 0x9A, 0xAA, 0xA9,
+    0x77, 0x0F, 0xD9, 0x76, 0xFF, 0x75, 0xAF, 0xF9, 0x76, 0x9A, 0xFC, 0x97, 0x70, 0xAF, 0x77, 0x1A,
+    0xF7, 0x71, 0xF9, 0x77, 0x0A, 0xF7, 0x70, 0xAF, 0x97, 0x7F, 0xD7, 0x7F, 0xD9, 0x75, 0x9F, 0xE7,
+    0x5A, 0xEA, 0xE9, 0x74, 0xAE, 0x0A, 0xE7, 0x4E, 0xA1, 0xE9, 0x73, 0xE2, 0xAE, 0x72, 0x9E, 0x3E,
+    0x97, 0x1A, 0xDA, 0x39, 0xE7, 0x1E, 0x94, 0xE9, 0x70, 0xE6, 0xE7, 0x9D, 0xA6, 0xAD, 0x96, 0xAD,
+    0x97, 0xE6, 0xE7, 0x0A, 0xD9, 0x59, 0xD9, 0x6A, 0xD9, 0x5A, 0xD7, 0xE6, 0xE7, 0xE6, 0xE6, 0x9D,
+    0xA5, 0x9D, 0xA6, 0xAD, 0x95, 0xE9, 0x6E, 0x6E, 0x69, 0xE5, 0xAE, 0x6A, 0xDA, 0x5E, 0xA6, 0xE9,
+    0x49, 0xEA, 0x5A, 0xE9, 0x4F, 0xC4, 0xAF, 0x5F, 0xFF, 0xE4, 0xAF, 0xFF, 0xDA, 0x4D, 0xAF, 0xFF,
+    0x93, 0x9C, 0xA9, 0xFF, 0x9E, 0x4D, 0x19, 0xFC, 0xA0, 0x9E, 0x4D, 0x77, 0x1A, 0xC9, 0x77, 0x1A,
+    0xA7, 0x72, 0x76, 0x9D, 0xA7, 0xE0, 0xE7, 0xDA, 0x0E, 0x69, 0xDA, 0x0A, 0xD9, 0x5A, 0xD9, 0x0A,
+    0xDA, 0x5E, 0x19, 0xE4, 0x9E, 0x2E, 0x4E, 0x92, 0xE9, 0x29, 0xE3, 0xEA, 0x2E, 0xA3, 0xAE, 0x1A,
+    0xE4, 0x9E, 0x09, 0xE9, 0x49, 0xFE, 0xA5, 0x9F, 0xE6, 0x9F, 0xD9, 0x69, 0xFD, 0x7A, 0xFC, 0x60,
+    0x4F, 0xFD, 0x49, 0xFF, 0xD7, 0x09, 0xEA, 0x71, 0xEA, 0x72, 0xE7, 0x3A, 0xD7, 0x4D, 0x75, 0xD7,
+    0x5E, 0xA9, 0x72, 0x9F, 0xD7, 0x09, 0xEA, 0x99, 0x79, 0xD9, 0x73, 0xD9, 0x73, 0xAD, 0x74, 0xAD,
+    0xA7, 0x3A, 0xFC, 0xA7, 0x1A, 0xFD, 0x73, 0x9E, 0x74, 0x9D, 0x97, 0x3E, 0x73, 0xAE, 0x72, 0xAE,
+    0x72, 0xF9, 0x71, 0xF9, 0x77, 0x60, 0x69, 0xAF, 0xA7, 0x1A, 0xFF, 0x95, 0x9F, 0xAA, 0xAF, 0x94,
+    0xE9, 0x49, 0xDA, 0x3E, 0x7E, 0x29, 0xD9, 0x7E, 0x2E, 0x70, 0xE1, 0x9D, 0x97, 0x0E, 0x1A, 0xD7,
+    0x0A, 0xD9, 0x1E, 0x70, 0xE2, 0xE9, 0x6E, 0xA2, 0xFA, 0x99, 0x99, 0xAF, 0x3A, 0xFF, 0xF5, 0xFF,
+    0xE9, 0x59, 0xFF, 0xA7, 0x1A, 0xFA, 0x96, 0x1F, 0xFF, 0xF9, 0x1F, 0xFF, 0xF4, 0x9D, 0x93, 0xDA,
+    0x7A, 0xD3, 0x9D, 0x97, 0xDA, 0x3A, 0xD7, 0x9D, 0x93, 0xDA, 0x7A, 0xD3, 0x9D, 0x70, 0xDA, 0x3E,
+    0x79, 0xD4, 0xD9, 0x7E, 0x3A, 0xD7, 0x0D, 0xA3, 0xDA, 0x79, 0xD3, 0x9D, 0x97, 0xE3, 0xE9, 0x7D,
+    0xA3, 0xFC, 0xA4, 0xAD, 0x4A, 0xF9, 0x77, 0x70, 0x75, 0x9A, 0xAA, 0x97, 0x7A, 0xFE, 0x75, 0xFF,
+    0xD7, 0x29, 0xEA, 0x3A, 0xD7, 0x2E, 0x95, 0xD9, 0x70, 0xAD, 0xA6, 0xD9, 0x79, 0xE6, 0x9D, 0x97,
+    0xEA, 0x6A, 0xD7, 0x0E, 0x96, 0xE7, 0xAE, 0x95, 0x9D, 0xA7, 0xF9, 0x5E, 0x7A, 0xFC, 0x92, 0x9E,
+    0xA7, 0xFF, 0xFD, 0x79, 0xFF, 0xFC, 0x70, 0xEA, 0x9F, 0xF9, 0x79, 0xE1, 0x9F, 0xCA, 0x71, 0xF4,
+    0x97, 0x39, 0xE9, 0x77, 0x1A, 0xE7, 0x72, 0xE9, 0x77, 0x1A, 0xE7, 0x72, 0xEA, 0x77, 0x77, 0x70,
+    0x77, 0x29, 0xFA, 0x59, 0xFF, 0x92, 0x9D, 0xA3, 0xAD, 0x2D, 0xA6, 0x91, 0x9D, 0x72, 0xAC, 0x97,
+    0x2D, 0x73, 0xD7, 0x3D, 0x73, 0xD9, 0x72, 0xAD, 0x97, 0x2E, 0xA7, 0x2E, 0x97, 0x1E, 0x97, 0x1E,
+    0x71, 0x9E, 0x71, 0xEA, 0x71, 0xAD, 0x97, 0x39, 0x70, 0x69, 0xAF, 0xFF, 0xFA, 0x5A, 0xFF, 0xFF,
+    0xCA, 0x49, 0xFA, 0xAA, 0xF9, 0x74, 0xE9, 0x49, 0xDA, 0x73, 0xE7, 0xE7, 0x29, 0xD9, 0x7E, 0x72,
+    0xE7, 0x0E, 0x71, 0x9D, 0x97, 0x0E, 0x71, 0xAD, 0x70, 0xAD, 0x97, 0x1E, 0x70, 0xE7, 0x2E, 0x96,
+    0xEA, 0x72, 0xFA, 0x99, 0x99, 0xAF, 0x73, 0xAF, 0xFF, 0x75, 0xFF, 0xE9, 0x75, 0x9F, 0xFA, 0x77,
+    0x1A, 0xFA, 0x97, 0x60, 0x0F, 0xFF, 0xDA, 0x0F, 0xFF, 0xD9, 0x6D, 0xA7, 0x39, 0xD7, 0x4E, 0x74,
+    0xD9, 0x73, 0xAD, 0x74, 0xDA, 0x73, 0x9D, 0x97, 0x3A, 0xD7, 0x4D, 0xA7, 0x3A, 0xD7, 0x4E, 0x97,
+    0x3F, 0xC9, 0x71, 0xAF, 0x77, 0x70, 0x29, 0xCA, 0x49, 0xC9, 0x3A, 0xCA, 0x5D, 0x3D, 0x95, 0xD3,
+    0xD6, 0xD2, 0x9D, 0x6D, 0x29, 0xD6, 0xD2, 0xAC, 0xA5, 0x9D, 0x2D, 0x95, 0xAC, 0xA2, 0xD9, 0x5D,
+    0xA1, 0x9D, 0x6D, 0x91, 0x9D, 0x5A, 0xD2, 0xAD, 0xA3, 0xAE, 0x2A, 0xFF, 0xD9, 0x2A, 0xFF, 0xD3,
+    0x9F, 0xFC, 0x5A, 0xFD, 0xA7, 0x99, 0xA9, 0x96, 0x77, 0x09, 0x77, 0x71, 0xAC, 0x97, 0x77, 0x0D,
+    0x77, 0x71, 0xD7, 0x77, 0x09, 0xCA, 0x77, 0x70, 0xAC, 0x97, 0x77, 0x0D, 0x97, 0x75, 0x9A, 0xFD,
+    0xA7, 0x70, 0xAF, 0xFE, 0xA7, 0x49, 0xFF, 0xFE, 0x72, 0x9F, 0xC9, 0xAC, 0x91, 0xAF, 0xA7, 0x09,
+    0xFA, 0x1D, 0x3A, 0xF7, 0x0F, 0xA2, 0xD4, 0xF9, 0x6F, 0x92, 0x9C, 0xA4, 0xAE, 0xA5, 0x9E, 0xA3,
+    0xAC, 0xA4, 0x9E, 0xA5, 0xF4, 0xAC, 0x95, 0xEA, 0x49, 0xE9, 0x4D, 0x6E, 0x94, 0xF5, 0xD6, 0xE9,
+    0x4E, 0x94, 0x9C, 0xA5, 0x9E, 0x49, 0xE5, 0xAC, 0x95, 0xAE, 0x4A, 0xE5, 0xD6, 0xEA, 0x4E, 0xA5,
+    0xD5, 0x9E, 0x5E, 0xA5, 0xD5, 0xF5, 0xF4, 0x9C, 0xA4, 0xF9, 0x5F, 0x93, 0xAC, 0x92, 0x9F, 0xC6,
+    0xFD, 0x99, 0x0D, 0x99, 0x9F, 0xD9, 0x6F, 0xFF, 0xFF, 0x7A, 0xFF, 0xFF, 0xD7, 0x09, 0xFF, 0xFF,
+    0xC9, 0x71, 0xAF, 0xFF, 0xE9, 0x73, 0x9F, 0xFF, 0xA7, 0x79, 0xAF, 0xDA, 0x97, 0x74, 0x9C, 0xA7,
+    0x77, 0x0A, 0xC9, 0x77, 0x70, 0xD7, 0x77, 0x77, 0x40, 0x6D, 0xA9, 0x71, 0xAC, 0xA7, 0xFC, 0x7A,
+    0xD7, 0x9F, 0xD5, 0xAD, 0x71, 0x9A, 0xFA, 0x3A, 0xD9, 0x74, 0xF2, 0xAD, 0x97, 0x6E, 0x90, 0xAD,
+    0xA7, 0x7A, 0xDA, 0x9D, 0xA7, 0x70, 0x9F, 0xD7, 0x71, 0x9F, 0xC7, 0x73, 0xF7, 0x73, 0x9E, 0x97,
+    0x72, 0x9F, 0xA7, 0x71, 0x9F, 0xD7, 0x71, 0xFE, 0x77, 0x0F, 0x9E, 0x97, 0x6F, 0x1E, 0x97, 0x5F,
+    0x2F, 0x74, 0xF9, 0x2A, 0xEA, 0x72, 0xF9, 0x39, 0xFE, 0x6F, 0xA5, 0xFE, 0x5F, 0xA6, 0xAF, 0xCA,
+    0x4A, 0xEA, 0x70, 0xAF, 0x93, 0x70, 0xAC, 0x97, 0x5D, 0x76, 0xD7, 0x59, 0xD7, 0x59, 0xCA, 0x70,
+    0xAC, 0xA1, 0xAC, 0x92, 0xCA, 0x3A, 0xC9, 0x1D, 0x3D, 0x3D, 0x91, 0xD3, 0xD3, 0xD2, 0xD3, 0xD9,
+    0x19, 0xD1, 0x9C, 0xA3, 0xD2, 0xAD, 0x1A, 0xC9, 0x3D, 0x2A, 0xCA, 0x1A, 0xC9, 0x29, 0xD2, 0xD9,
+    0x1D, 0x3A, 0xD2, 0xD9, 0x1D, 0x3D, 0xA1, 0x9D, 0x90, 0x9C, 0xA3, 0xD9, 0x19, 0xDA, 0x09, 0xCA,
+    0x2E, 0x2A, 0xFD, 0xAA, 0xAE, 0xA2, 0x9F, 0xFF, 0x4F, 0xFE, 0x94, 0xAF, 0xFC, 0x96, 0x9A, 0xFC,
+    0x97, 0x2A, 0xC9, 0x75, 0xAC, 0x97, 0x5D, 0x76, 0xD7, 0x59, 0xCA, 0x75, 0x9C, 0xA7, 0x59, 0xA7,
+    0x20, 0x5A, 0xAA, 0x79, 0x97, 0xE9, 0x79, 0xD5, 0xAD, 0x97, 0x09, 0xD4, 0xAD, 0xA7, 0x2D, 0x4E,
+    0x73, 0xD3, 0xE9, 0x73, 0xD2, 0x9E, 0x4C, 0x94, 0x9D, 0x2A, 0xD9, 0x39, 0xC5, 0xAD, 0x2E, 0x4A,
+    0xC5, 0xDA, 0x2E, 0x4C, 0xA4, 0xAD, 0x92, 0xDA, 0x3A, 0xCA, 0x39, 0xE3, 0xE9, 0x1A, 0xE1, 0x9A,
+    0xE9, 0x3A, 0xFF, 0xFE, 0x95, 0xFD, 0x9A, 0xFD, 0x97, 0x9A, 0xAA, 0x91, 0xAE, 0xA7, 0x77, 0x40,
+    0x77, 0xEA, 0x77, 0x1A, 0xEA, 0x77, 0x1F, 0xC7, 0x70, 0xFD, 0x77, 0x9D, 0xAE, 0x77, 0xE0, 0xE7,
+    0x6E, 0x90, 0xE9, 0x74, 0x9E, 0x1E, 0x97, 0x4E, 0x2E, 0x97, 0x3A, 0xDA, 0x2A, 0xDA, 0x72, 0x9E,
+    0x3A, 0xDA, 0x72, 0xE9, 0x3A, 0xE7, 0x1A, 0xE4, 0xAE, 0x70, 0x9E, 0x59, 0xE7, 0x0E, 0xA5, 0x9E,
+    0x7A, 0xE6, 0x9E, 0x96, 0xE9, 0x7E, 0x95, 0xFF, 0xFF, 0xA4, 0xAF, 0xFF, 0xFA, 0x4F, 0xFF, 0xFC,
+    0xA3, 0xFF, 0xFF, 0xE2, 0x9E, 0xA7, 0x2F, 0x2F, 0x73, 0xF1, 0xAE, 0xA7, 0x3F, 0x09, 0xF7, 0x39,
+    0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xD9, 0x77, 0x19, 0xE9, 0x77, 0x1A, 0xE7, 0x72,
+    0xF7, 0x71, 0xAF, 0x73, 0x77, 0x72, 0xAE, 0xA7, 0x2A, 0xFE, 0x9D, 0x5F, 0xFE, 0xA4, 0xF9, 0x2A,
+    0xEA, 0x39, 0xE5, 0xE9, 0x3D, 0xA6, 0xE3, 0xAD, 0x7E, 0x3D, 0x97, 0xE2, 0x9D, 0x79, 0xDA, 0x2D,
+    0xA7, 0xEA, 0x2D, 0x96, 0xAE, 0x92, 0xDA, 0x5F, 0xC3, 0xF9, 0x9A, 0xAF, 0xD3, 0xFF, 0xFD, 0x3A,
+    0xFF, 0xFA, 0x4F, 0xFA, 0x9D, 0xA5, 0xAF, 0xA9, 0x09, 0xD9, 0x77, 0x77, 0x77, 0x73, 0xAD, 0xA7,
+    0x5E, 0xA7, 0x4A, 0xE9, 0x74, 0xF9, 0x73, 0x9F, 0x72, 0x77, 0x19, 0xF9, 0x77, 0x2C, 0x99, 0x0A,
+    0xC7, 0x76, 0xD7, 0x74, 0x9D, 0x97, 0x73, 0xAD, 0x77, 0x5A, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x1E, 0xA7, 0x73, 0xAE, 0xA7, 0x73, 0xFC, 0x77, 0x2F, 0xD7, 0x71,
+    0x9D, 0xAE, 0x77, 0x1E, 0x0E, 0x77, 0x0E, 0x90, 0xE9, 0x76, 0x9E, 0x1E, 0x97, 0x6E, 0x2E, 0x97,
+    0x5A, 0xDA, 0x2A, 0xDA, 0x74, 0x9E, 0x3A, 0xDA, 0x74, 0xE9, 0x3A, 0xE7, 0x3A, 0xE4, 0xAE, 0x72,
+    0x9E, 0x59, 0xE7, 0x2E, 0xA5, 0x9E, 0x71, 0xAE, 0x69, 0xE9, 0x70, 0xE9, 0x7E, 0x97, 0xFF, 0xFF,
+    0xA6, 0xAF, 0xFF, 0xFA, 0x6F, 0xFF, 0xFC, 0xA5, 0xFF, 0xFF, 0xE4, 0x9E, 0xA7, 0x2F, 0x4F, 0x73,
+    0xF3, 0xAE, 0xA7, 0x3F, 0x29, 0xF7, 0x39, 0xF9, 0x10, 0x72, 0x9A, 0xE7, 0x49, 0x91, 0xAC, 0x76,
+    0x9C, 0xA7, 0x5A, 0xD7, 0x5A, 0xC9, 0x77, 0x97, 0x77, 0x77, 0x77, 0x72, 0xAE, 0xA7, 0x2A, 0xFE,
+    0x9D, 0x5F, 0xFE, 0xA4, 0xF9, 0x2A, 0xEA, 0x39, 0xE5, 0xE9, 0x3D, 0xA6, 0xE3, 0xAD, 0x7E, 0x3D,
+    0x97, 0xE2, 0x9D, 0x79, 0xDA, 0x2D, 0xA7, 0xEA, 0x2D, 0x96, 0xAE, 0x92, 0xDA, 0x5F, 0xC3, 0xF9,
+    0x9A, 0xAF, 0xD3, 0xFF, 0xFD, 0x3A, 0xFF, 0xFA, 0x4F, 0xFA, 0x9D, 0xA5, 0xAF, 0xA9, 0x09, 0xD9,
+    0x10, 0x77, 0x72, 0xAA, 0x77, 0x72, 0x9C, 0xA7, 0x77, 0x2D, 0x77, 0x72, 0xDA, 0x77, 0x71, 0xAD,
+    0x77, 0x71, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xC9, 0x77, 0x72, 0xE9, 0x77,
+    0x70, 0xAF, 0x97, 0x76, 0x9D, 0x1A, 0xCA, 0x77, 0x5D, 0x39, 0xD7, 0x73, 0xAA, 0x69, 0xA7, 0x77,
+    0x77, 0x73, 0xEA, 0x77, 0x70, 0xAE, 0xA7, 0x77, 0x0F, 0xC7, 0x77, 0xFD, 0x77, 0x69, 0xDA, 0xE7,
+    0x76, 0xE0, 0xE7, 0x75, 0xE9, 0x0E, 0x97, 0x73, 0x9E, 0x1E, 0x97, 0x73, 0xE2, 0xE9, 0x77, 0x2A,
+    0xDA, 0x2A, 0xDA, 0x77, 0x19, 0xE3, 0xAD, 0xA7, 0x71, 0xE9, 0x3A, 0xE7, 0x70, 0xAE, 0x4A, 0xE7,
+    0x79, 0xE5, 0x9E, 0x77, 0xEA, 0x59, 0xE7, 0x6A, 0xE6, 0x9E, 0x97, 0x5E, 0x97, 0xE9, 0x74, 0xFF,
+    0xFF, 0xA7, 0x3A, 0xFF, 0xFF, 0xA7, 0x3F, 0xFF, 0xFC, 0xA7, 0x2F, 0xFF, 0xFE, 0x71, 0x9E, 0xA7,
+    0x2F, 0x71, 0xF7, 0x3F, 0x70, 0xAE, 0xA7, 0x3F, 0x79, 0xF7, 0x39, 0xF9, 0x60, 0x77, 0x71, 0xD7,
+    0x77, 0x1A, 0xCA, 0x77, 0x70, 0x9D, 0x77, 0x71, 0xD9, 0x77, 0x70, 0xE7, 0x77, 0x09, 0xAA, 0x77,
+    0x77, 0x77, 0x77, 0x71, 0xA9, 0x77, 0x71, 0xAD, 0x97, 0x77, 0x0F, 0x97, 0x76, 0xDA, 0x9D, 0xA7,
+    0x74, 0xAC, 0xA2, 0x9C, 0xA7, 0x72, 0x9C, 0x95, 0xAC, 0x77, 0x77, 0x77, 0xAE, 0xA7, 0x75, 0xAF,
+    0xE9, 0xD7, 0x70, 0xFF, 0xEA, 0x77, 0xF9, 0x2A, 0xEA, 0x76, 0x9E, 0x5E, 0x97, 0x6D, 0xA6, 0xE7,
+    0x6A, 0xD7, 0xE7, 0x6D, 0x97, 0xE7, 0x59, 0xD7, 0x9D, 0xA7, 0x5D, 0xA7, 0xEA, 0x75, 0xD9, 0x6A,
+    0xE9, 0x75, 0xDA, 0x5F, 0xC7, 0x6F, 0x99, 0xAA, 0xFD, 0x76, 0xFF, 0xFD, 0x76, 0xAF, 0xFF, 0xA7,
+    0x7F, 0xFA, 0x9D, 0xA7, 0x70, 0xAF, 0xA9, 0x09, 0xD9, 0x74, 0x76, 0xAD, 0x77, 0x6E, 0x97, 0x74,
+    0x9E, 0x97, 0x74, 0x9E, 0x97, 0x76, 0x99, 0x77, 0x2A, 0xC9, 0x77, 0x5E, 0x97, 0x73, 0xAF, 0x97,
+    0x71, 0x9D, 0x1A, 0xCA, 0x77, 0x0D, 0x39, 0xD7, 0x6A, 0xA6, 0x9A, 0x77, 0x77, 0x71, 0xEA, 0x77,
+    0x3A, 0xEA, 0x77, 0x3F, 0xC7, 0x72, 0xFD, 0x77, 0x19, 0xDA, 0xE7, 0x71, 0xE0, 0xE7, 0x70, 0xE9,
+    0x0E, 0x97, 0x69, 0xE1, 0xE9, 0x76, 0xE2, 0xE9, 0x75, 0xAD, 0xA2, 0xAD, 0xA7, 0x49, 0xE3, 0xAD,
+    0xA7, 0x4E, 0x93, 0xAE, 0x73, 0xAE, 0x4A, 0xE7, 0x29, 0xE5, 0x9E, 0x72, 0xEA, 0x59, 0xE7, 0x1A,
+    0xE6, 0x9E, 0x97, 0x0E, 0x97, 0xE9, 0x7F, 0xFF, 0xFA, 0x6A, 0xFF, 0xFF, 0xA6, 0xFF, 0xFF, 0xCA,
+    0x5F, 0xFF, 0xFE, 0x49, 0xEA, 0x72, 0xF4, 0xF7, 0x3F, 0x3A, 0xEA, 0x73, 0xF2, 0x9F, 0x73, 0x9F,
+    0x91, 0x6E, 0x77, 0x1E, 0x77, 0x09, 0xE9, 0x77, 0xAE, 0x97, 0x70, 0xAD, 0x77, 0x0E, 0xA7, 0x69,
+    0xFA, 0x75, 0xD9, 0x0A, 0xD7, 0x3D, 0x4A, 0xC9, 0x70, 0x9A, 0x7A, 0x77, 0x75, 0xAE, 0xA7, 0x4A,
+    0xFE, 0x9D, 0x7F, 0xFE, 0xA6, 0xF9, 0x2A, 0xEA, 0x59, 0xE5, 0xE9, 0x5D, 0xA6, 0xE5, 0xAD, 0x7E,
+    0x5D, 0x97, 0xE4, 0x9D, 0x79, 0xDA, 0x4D, 0xA7, 0xEA, 0x4D, 0x96, 0xAE, 0x94, 0xDA, 0x5F, 0xC5,
+    0xF9, 0x9A, 0xAF, 0xD5, 0xFF, 0xFD, 0x5A, 0xFF, 0xFA, 0x6F, 0xFA, 0x9D, 0xA7, 0xAF, 0xA9, 0x09,
+    0xD9, 0x30, 0x77, 0x77, 0x77, 0x49, 0xF9, 0x77, 0x79, 0x91, 0xAC, 0x77, 0x72, 0x9D, 0x77, 0x71,
+    0xAC, 0xA7, 0x77, 0x19, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xAC, 0x97, 0x77, 0x2E,
+    0x97, 0x77, 0x0A, 0xF9, 0x77, 0x69, 0xD1, 0xAC, 0xA7, 0x75, 0xD3, 0x9D, 0x77, 0x3A, 0xA6, 0x9A,
+    0x77, 0x77, 0x77, 0x3E, 0xA7, 0x77, 0x0A, 0xEA, 0x77, 0x70, 0xFC, 0x77, 0x7F, 0xD7, 0x76, 0x9D,
+    0xAE, 0x77, 0x6E, 0x0E, 0x77, 0x5E, 0x90, 0xE9, 0x77, 0x39, 0xE1, 0xE9, 0x77, 0x3E, 0x2E, 0x97,
+    0x72, 0xAD, 0xA2, 0xAD, 0xA7, 0x71, 0x9E, 0x3A, 0xDA, 0x77, 0x1E, 0x93, 0xAE, 0x77, 0x0A, 0xE4,
+    0xAE, 0x77, 0x9E, 0x59, 0xE7, 0x7E, 0xA5, 0x9E, 0x76, 0xAE, 0x69, 0xE9, 0x75, 0xE9, 0x7E, 0x97,
+    0x4F, 0xFF, 0xFA, 0x73, 0xAF, 0xFF, 0xFA, 0x73, 0xFF, 0xFF, 0xCA, 0x72, 0xFF, 0xFF, 0xE7, 0x19,
+    0xEA, 0x72, 0xF7, 0x1F, 0x73, 0xF7, 0x0A, 0xEA, 0x73, 0xF7, 0x9F, 0x73, 0x9F, 0x96, 0x75, 0xAE,
+    0xA7, 0x59, 0xA1, 0x9C, 0x77, 0x1A, 0xC7, 0x70, 0xD9, 0x77, 0xD9, 0x77, 0x0C, 0x97, 0x3A, 0xC9,
+    0x77, 0x0E, 0x77, 0xFC, 0x97, 0x4A, 0xD1, 0xDA, 0x72, 0x9D, 0x39, 0xD7, 0x1A, 0xA6, 0xAA, 0x77,
+    0x77, 0xAE, 0xA7, 0x4A, 0xFE, 0x9D, 0x7F, 0xFE, 0xA6, 0xF9, 0x2A, 0xEA, 0x59, 0xE5, 0xE9, 0x5D,
+    0xA6, 0xE5, 0xAD, 0x7E, 0x5D, 0x97, 0xE4, 0x9D, 0x79, 0xDA, 0x4D, 0xA7, 0xEA, 0x4D, 0x96, 0xAE,
+    0x94, 0xDA, 0x5F, 0xC5, 0xF9, 0x9A, 0xAF, 0xD5, 0xFF, 0xFD, 0x5A, 0xFF, 0xFA, 0x6F, 0xFA, 0x9D,
+    0xA7, 0xAF, 0xA9, 0x09, 0xD9, 0x30, 0x75, 0x9D, 0xA3, 0xC9, 0x74, 0x9D, 0xAC, 0x91, 0x9C, 0x75,
+    0xD1, 0xD1, 0xD7, 0x49, 0xCA, 0x19, 0xF9, 0x74, 0xAC, 0x92, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x70,
+    0x9A, 0x77, 0x5E, 0x77, 0x3A, 0xF7, 0x71, 0x9D, 0x9A, 0xD9, 0x77, 0xD3, 0xAC, 0x97, 0x5D, 0x59,
+    0xCA, 0x77, 0x77, 0x77, 0x77, 0x0E, 0xA7, 0x72, 0xAE, 0xA7, 0x72, 0xFC, 0x77, 0x1F, 0xD7, 0x70,
+    0x9D, 0xAE, 0x77, 0x0E, 0x0E, 0x77, 0xE9, 0x0E, 0x97, 0x59, 0xE1, 0xE9, 0x75, 0xE2, 0xE9, 0x74,
+    0xAD, 0xA2, 0xAD, 0xA7, 0x39, 0xE3, 0xAD, 0xA7, 0x3E, 0x93, 0xAE, 0x72, 0xAE, 0x4A, 0xE7, 0x19,
+    0xE5, 0x9E, 0x71, 0xEA, 0x59, 0xE7, 0x0A, 0xE6, 0x9E, 0x97, 0xE9, 0x7E, 0x96, 0xFF, 0xFF, 0xA5,
+    0xAF, 0xFF, 0xFA, 0x5F, 0xFF, 0xFC, 0xA4, 0xFF, 0xFF, 0xE3, 0x9E, 0xA7, 0x2F, 0x3F, 0x73, 0xF2,
+    0xAE, 0xA7, 0x3F, 0x19, 0xF7, 0x39, 0xF9, 0x00, 0x7D, 0xA3, 0xD7, 0xDA, 0xD2, 0xCA, 0x6A, 0xC9,
+    0x09, 0xC9, 0x0A, 0xC7, 0xD2, 0xFA, 0x7C, 0xA3, 0x9A, 0x97, 0x77, 0x77, 0x7A, 0x97, 0x6A, 0xD9,
+    0x74, 0x9F, 0x97, 0x3D, 0xA0, 0xDA, 0x71, 0xD9, 0x29, 0xD7, 0x9A, 0x69, 0xA7, 0x2A, 0xEA, 0x72,
+    0xAF, 0xE9, 0xD5, 0xFF, 0xEA, 0x4F, 0x92, 0xAE, 0xA3, 0x9E, 0x5E, 0x93, 0xDA, 0x6E, 0x3A, 0xD7,
+    0xE3, 0xD9, 0x7E, 0x29, 0xD7, 0x9D, 0xA2, 0xDA, 0x7E, 0xA2, 0xD9, 0x6A, 0xE9, 0x2D, 0xA5, 0xFC,
+    0x3F, 0x99, 0xAA, 0xFD, 0x3F, 0xFF, 0xD3, 0xAF, 0xFF, 0xA4, 0xFF, 0xA9, 0xDA, 0x5A, 0xFA, 0x90,
+    0x9D, 0x91, 0x77, 0xAC, 0x97, 0x75, 0xE9, 0x77, 0x3A, 0xF9, 0x77, 0x19, 0xD1, 0xAC, 0xA7, 0x70,
+    0xD3, 0x9D, 0x76, 0xAA, 0x69, 0xA7, 0x77, 0x77, 0x1E, 0xA7, 0x73, 0xAE, 0xA7, 0x73, 0xFC, 0x77,
+    0x2F, 0xD7, 0x71, 0x9D, 0xAE, 0x77, 0x1E, 0x0E, 0x77, 0x0E, 0x90, 0xE9, 0x76, 0x9E, 0x1E, 0x97,
+    0x6E, 0x2E, 0x97, 0x5A, 0xDA, 0x2A, 0xDA, 0x74, 0x9E, 0x3A, 0xDA, 0x74, 0xE9, 0x3A, 0xE7, 0x3A,
+    0xE4, 0xAE, 0x72, 0x9E, 0x59, 0xE7, 0x2E, 0xA5, 0x9E, 0x71, 0xAE, 0x69, 0xE9, 0x70, 0xE9, 0x7E,
+    0x97, 0xFF, 0xFF, 0xA6, 0xAF, 0xFF, 0xFA, 0x6F, 0xFF, 0xFC, 0xA5, 0xFF, 0xFF, 0xE4, 0x9E, 0xA7,
+    0x2F, 0x4F, 0x73, 0xF3, 0xAE, 0xA7, 0x3F, 0x29, 0xF7, 0x39, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x75, 0xAD, 0x97, 0x73, 0x9E, 0x97, 0x73, 0xAE, 0x77, 0x4F, 0x77, 0x3A, 0xF7, 0x50, 0x71,
+    0xD7, 0x6A, 0xDA, 0x74, 0x9F, 0xA7, 0x3D, 0x90, 0xAD, 0x71, 0xD9, 0x3A, 0xC9, 0x69, 0xA9, 0xAE,
+    0xA0, 0x9C, 0x96, 0xAF, 0xE9, 0xD5, 0xFF, 0xEA, 0x4F, 0x92, 0xAE, 0xA3, 0x9E, 0x5E, 0x93, 0xDA,
+    0x6E, 0x3A, 0xD7, 0xE3, 0xD9, 0x7E, 0x29, 0xD7, 0x9D, 0xA2, 0xDA, 0x7E, 0xA2, 0xD9, 0x6A, 0xE9,
+    0x2D, 0xA5, 0xFC, 0x3F, 0x99, 0xAA, 0xFD, 0x3F, 0xFF, 0xD3, 0xAF, 0xFF, 0xA4, 0xFF, 0xA9, 0xDA,
+    0x5A, 0xFA, 0x90, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x3A, 0xDA, 0x75, 0xEA, 0x74, 0xAE, 0x97, 0x4F,
+    0x97, 0x39, 0xF7, 0x20, 0x77, 0x59, 0xA9, 0x77, 0x6D, 0x77, 0x6D, 0x97, 0x75, 0xAD, 0x77, 0x59,
+    0xD7, 0x76, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xC7, 0xC9, 0x75,
+    0xD6, 0xAC, 0x76, 0xDA, 0x4A, 0xCA, 0x76, 0xAF, 0xFC, 0x77, 0x0F, 0xF7, 0x72, 0xAE, 0xA9, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5E, 0xA7, 0x74, 0xAE, 0xA7, 0x74, 0xFC, 0x77,
+    0x3F, 0xD7, 0x72, 0x9D, 0xAE, 0x77, 0x2E, 0x0E, 0x77, 0x1E, 0x90, 0xE9, 0x77, 0x9E, 0x1E, 0x97,
+    0x7E, 0x2E, 0x97, 0x6A, 0xDA, 0x2A, 0xDA, 0x75, 0x9E, 0x3A, 0xDA, 0x75, 0xE9, 0x3A, 0xE7, 0x4A,
+    0xE4, 0xAE, 0x73, 0x9E, 0x59, 0xE7, 0x3E, 0xA5, 0x9E, 0x72, 0xAE, 0x69, 0xE9, 0x71, 0xE9, 0x7E,
+    0x97, 0x0F, 0xFF, 0xFA, 0x7A, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0xCA, 0x6F, 0xFF, 0xFE, 0x59, 0xEA,
+    0x72, 0xF5, 0xF7, 0x3F, 0x4A, 0xEA, 0x73, 0xF3, 0x9F, 0x73, 0x9F, 0x92, 0x77, 0xAA, 0x77, 0x0D,
+    0x97, 0x7A, 0xCA, 0x77, 0x9D, 0x77, 0x0D, 0xA7, 0x7E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x9A, 0x96, 0xAA, 0x7A, 0xC9, 0x59, 0xCA, 0x7A, 0xD4, 0x9D, 0x71, 0xFF, 0xC9, 0x71, 0xAF, 0xE9,
+    0x73, 0x9A, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xEA, 0x74, 0xAF, 0xE9, 0xD7, 0xFF, 0xEA,
+    0x6F, 0x92, 0xAE, 0xA5, 0x9E, 0x5E, 0x95, 0xDA, 0x6E, 0x5A, 0xD7, 0xE5, 0xD9, 0x7E, 0x49, 0xD7,
+    0x9D, 0xA4, 0xDA, 0x7E, 0xA4, 0xD9, 0x6A, 0xE9, 0x4D, 0xA5, 0xFC, 0x5F, 0x99, 0xAA, 0xFD, 0x5F,
+    0xFF, 0xD5, 0xAF, 0xFF, 0xA6, 0xFF, 0xA9, 0xDA, 0x7A, 0xFA, 0x90, 0x9D, 0x93, 0x77, 0xAD, 0x77,
+    0x7E, 0x97, 0x76, 0xE9, 0x77, 0x59, 0xE9, 0x77, 0x79, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6A,
+    0xA7, 0xA9, 0x75, 0xD6, 0xAC, 0x76, 0xDA, 0x4A, 0xD7, 0x6A, 0xFF, 0xC7, 0x70, 0xFF, 0x77, 0x2A,
+    0xEA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xEA, 0x77, 0x4A, 0xEA, 0x77,
+    0x4F, 0xC7, 0x73, 0xFD, 0x77, 0x29, 0xDA, 0xE7, 0x72, 0xE0, 0xE7, 0x71, 0xE9, 0x0E, 0x97, 0x79,
+    0xE1, 0xE9, 0x77, 0xE2, 0xE9, 0x76, 0xAD, 0xA2, 0xAD, 0xA7, 0x59, 0xE3, 0xAD, 0xA7, 0x5E, 0x93,
+    0xAE, 0x74, 0xAE, 0x4A, 0xE7, 0x39, 0xE5, 0x9E, 0x73, 0xEA, 0x59, 0xE7, 0x2A, 0xE6, 0x9E, 0x97,
+    0x1E, 0x97, 0xE9, 0x70, 0xFF, 0xFF, 0xA7, 0xAF, 0xFF, 0xFA, 0x7F, 0xFF, 0xFC, 0xA6, 0xFF, 0xFF,
+    0xE5, 0x9E, 0xA7, 0x2F, 0x5F, 0x73, 0xF4, 0xAE, 0xA7, 0x3F, 0x39, 0xF7, 0x39, 0xF9, 0x20, 0x70,
+    0x9D, 0x97, 0x70, 0xAD, 0xA7, 0x70, 0xEA, 0x77, 0x0E, 0xA7, 0x71, 0x99, 0x97, 0x77, 0x77, 0x77,
+    0x75, 0x9A, 0x96, 0xAA, 0x7A, 0xC9, 0x59, 0xCA, 0x7A, 0xD4, 0x9D, 0x71, 0xFF, 0xC9, 0x71, 0xAF,
+    0xE9, 0x73, 0x9A, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xEA, 0x74, 0xAF, 0xE9, 0xD7, 0xFF,
+    0xEA, 0x6F, 0x92, 0xAE, 0xA5, 0x9E, 0x5E, 0x95, 0xDA, 0x6E, 0x5A, 0xD7, 0xE5, 0xD9, 0x7E, 0x49,
+    0xD7, 0x9D, 0xA4, 0xDA, 0x7E, 0xA4, 0xD9, 0x6A, 0xE9, 0x4D, 0xA5, 0xFC, 0x5F, 0x99, 0xAA, 0xFD,
+    0x5F, 0xFF, 0xD5, 0xAF, 0xFF, 0xA6, 0xFF, 0xA9, 0xDA, 0x7A, 0xFA, 0x90, 0x9D, 0x93, 0x77, 0x2A,
+    0xE9, 0x77, 0x39, 0xA1, 0x9C, 0x77, 0x7D, 0x77, 0x59, 0xD7, 0x76, 0xCA, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xA7, 0xA9, 0x75, 0xD6, 0xAC, 0x76, 0xDA, 0x4A, 0xD7, 0x6A,
+    0xFF, 0xC7, 0x70, 0xFF, 0x77, 0x2A, 0xEA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x75, 0xEA, 0x77, 0x4A, 0xEA, 0x77, 0x4F, 0xC7, 0x73, 0xFD, 0x77, 0x29, 0xDA, 0xE7, 0x72, 0xE0,
+    0xE7, 0x71, 0xE9, 0x0E, 0x97, 0x79, 0xE1, 0xE9, 0x77, 0xE2, 0xE9, 0x76, 0xAD, 0xA2, 0xAD, 0xA7,
+    0x59, 0xE3, 0xAD, 0xA7, 0x5E, 0x93, 0xAE, 0x74, 0xAE, 0x4A, 0xE7, 0x39, 0xE5, 0x9E, 0x73, 0xEA,
+    0x59, 0xE7, 0x2A, 0xE6, 0x9E, 0x97, 0x1E, 0x97, 0xE9, 0x70, 0xFF, 0xFF, 0xA7, 0xAF, 0xFF, 0xFA,
+    0x7F, 0xFF, 0xFC, 0xA6, 0xFF, 0xFF, 0xE5, 0x9E, 0xA7, 0x2F, 0x5F, 0x73, 0xF4, 0xAE, 0xA7, 0x3F,
+    0x39, 0xF7, 0x39, 0xF9, 0x20, 0x73, 0x9F, 0xA7, 0x4E, 0xAA, 0xAD, 0x73, 0x94, 0xD9, 0x77, 0xAD,
+    0x76, 0x9E, 0x97, 0x5A, 0xDA, 0x77, 0xD9, 0x77, 0x09, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x73, 0xD6, 0x9C, 0x97, 0xD6, 0xD7, 0x0E, 0x39, 0xDA, 0x70, 0xAF, 0xFA, 0x72, 0xAF, 0xD9,
+    0x74, 0x9A, 0xAA, 0x97, 0x77, 0x72, 0xAE, 0xA7, 0x4A, 0xFE, 0x9D, 0x7F, 0xFE, 0xA6, 0xF9, 0x2A,
+    0xEA, 0x59, 0xE5, 0xE9, 0x5D, 0xA6, 0xE5, 0xAD, 0x7E, 0x5D, 0x97, 0xE4, 0x9D, 0x79, 0xDA, 0x4D,
+    0xA7, 0xEA, 0x4D, 0x96, 0xAE, 0x94, 0xDA, 0x5F, 0xC5, 0xF9, 0x9A, 0xAF, 0xD5, 0xFF, 0xFD, 0x5A,
+    0xFF, 0xFA, 0x6F, 0xFA, 0x9D, 0xA7, 0xAF, 0xA9, 0x09, 0xD9, 0x30, 0x77, 0x09, 0x94, 0x99, 0x77,
+    0xF3, 0xC9, 0x76, 0xAC, 0xA0, 0xCA, 0x19, 0xC7, 0x7D, 0x19, 0xC1, 0xD7, 0x69, 0xCA, 0x2F, 0x97,
+    0x69, 0xC9, 0x3A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xAA, 0x7A, 0x97, 0x5D, 0x6A, 0xC7,
+    0x6D, 0xA4, 0xAD, 0x76, 0xAF, 0xFC, 0x77, 0x0F, 0xF7, 0x72, 0xAE, 0xA9, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x5E, 0xA7, 0x74, 0xAE, 0xA7, 0x74, 0xFC, 0x77, 0x3F, 0xD7, 0x72,
+    0x9D, 0xAE, 0x77, 0x2E, 0x0E, 0x77, 0x1E, 0x90, 0xE9, 0x77, 0x9E, 0x1E, 0x97, 0x7E, 0x2E, 0x97,
+    0x6A, 0xDA, 0x2A, 0xDA, 0x75, 0x9E, 0x3A, 0xDA, 0x75, 0xE9, 0x3A, 0xE7, 0x4A, 0xE4, 0xAE, 0x73,
+    0x9E, 0x59, 0xE7, 0x3E, 0xA5, 0x9E, 0x72, 0xAE, 0x69, 0xE9, 0x71, 0xE9, 0x7E, 0x97, 0x0F, 0xFF,
+    0xFA, 0x7A, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0xCA, 0x6F, 0xFF, 0xFE, 0x59, 0xEA, 0x72, 0xF5, 0xF7,
+    0x3F, 0x4A, 0xEA, 0x73, 0xF3, 0x9F, 0x73, 0x9F, 0x92, 0x72, 0x99, 0x39, 0x97, 0x1A, 0xE9, 0x2D,
+    0x71, 0xD0, 0xAC, 0x2C, 0xA7, 0x0A, 0xC2, 0xCA, 0x0A, 0xC7, 0x1D, 0x2A, 0xEA, 0x77, 0xAA, 0x97,
+    0x77, 0x77, 0x77, 0x75, 0x9A, 0x96, 0xAA, 0x7A, 0xC9, 0x59, 0xCA, 0x7A, 0xD4, 0x9D, 0x71, 0xFF,
+    0xC9, 0x71, 0xAF, 0xE9, 0x73, 0x9A, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xEA, 0x74, 0xAF,
+    0xE9, 0xD7, 0xFF, 0xEA, 0x6F, 0x92, 0xAE, 0xA5, 0x9E, 0x5E, 0x95, 0xDA, 0x6E, 0x5A, 0xD7, 0xE5,
+    0xD9, 0x7E, 0x49, 0xD7, 0x9D, 0xA4, 0xDA, 0x7E, 0xA4, 0xD9, 0x6A, 0xE9, 0x4D, 0xA5, 0xFC, 0x5F,
+    0x99, 0xAA, 0xFD, 0x5F, 0xFF, 0xD5, 0xAF, 0xFF, 0xA6, 0xFF, 0xA9, 0xDA, 0x7A, 0xFA, 0x90, 0x9D,
+    0x93, 0x75, 0xAA, 0x7A, 0x97, 0x5D, 0x6A, 0xC7, 0x6D, 0xA4, 0xAD, 0x76, 0xAF, 0xFC, 0x77, 0x0F,
+    0xF7, 0x72, 0xAE, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5E, 0xA7, 0x74,
+    0xAE, 0xA7, 0x74, 0xFC, 0x77, 0x3F, 0xD7, 0x72, 0x9D, 0xAE, 0x77, 0x2E, 0x0E, 0x77, 0x1E, 0x90,
+    0xE9, 0x77, 0x9E, 0x1E, 0x97, 0x7E, 0x2E, 0x97, 0x6A, 0xDA, 0x2A, 0xDA, 0x75, 0x9E, 0x3A, 0xDA,
+    0x75, 0xE9, 0x3A, 0xE7, 0x4A, 0xE4, 0xAE, 0x73, 0x9E, 0x59, 0xE7, 0x3E, 0xA5, 0x9E, 0x72, 0xAE,
+    0x69, 0xE9, 0x71, 0xE9, 0x7E, 0x97, 0x0F, 0xFF, 0xFA, 0x7A, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0xCA,
+    0x6F, 0xFF, 0xFE, 0x59, 0xEA, 0x72, 0xF5, 0xF7, 0x3F, 0x4A, 0xEA, 0x73, 0xF3, 0x9F, 0x73, 0x9F,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xAD, 0x97, 0x74, 0x9E, 0x97, 0x74, 0xAE, 0x77,
+    0x5F, 0x77, 0x4A, 0xF7, 0x60, 0x69, 0xA9, 0x6A, 0xA7, 0xAC, 0x95, 0x9C, 0xA7, 0xAD, 0x49, 0xD7,
+    0x1F, 0xFC, 0x97, 0x1A, 0xFE, 0x97, 0x39, 0xAD, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAE, 0xA7,
+    0x4A, 0xFE, 0x9D, 0x7F, 0xFE, 0xA6, 0xF9, 0x2A, 0xEA, 0x59, 0xE5, 0xE9, 0x5D, 0xA6, 0xE5, 0xAD,
+    0x7E, 0x5D, 0x97, 0xE4, 0x9D, 0x79, 0xDA, 0x4D, 0xA7, 0xEA, 0x4D, 0x96, 0xAE, 0x94, 0xDA, 0x5F,
+    0xC5, 0xF9, 0x9A, 0xAF, 0xD5, 0xFF, 0xFD, 0x5A, 0xFF, 0xFA, 0x6F, 0xFA, 0x9D, 0xA7, 0xAF, 0xA9,
+    0x09, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xDA, 0x77, 0xEA, 0x76, 0xAE, 0x97, 0x6F, 0x97, 0x59,
+    0xF7, 0x40, 0x77, 0x19, 0x99, 0x97, 0xAF, 0xFF, 0xD7, 0xFF, 0xFD, 0x97, 0xFF, 0xFC, 0xA7, 0x9E,
+    0x97, 0x71, 0xE9, 0x77, 0x2E, 0x77, 0x29, 0xE7, 0x72, 0xAD, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE9,
+    0x99, 0x99, 0xAA, 0xA7, 0x2A, 0xFF, 0xE7, 0x2F, 0xFE, 0xA7, 0x2F, 0xFE, 0x97, 0x19, 0xE9, 0x77,
+    0x1E, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9F, 0xFF, 0xD9,
+    0x6A, 0xFF, 0xFD, 0x96, 0xFF, 0xFE, 0x96, 0xFF, 0xFE, 0x95, 0xAF, 0xFF, 0xE7, 0x77, 0x77, 0x77,
+    0x2E, 0x97, 0x71, 0x9E, 0x77, 0x2F, 0x77, 0x19, 0xF7, 0x71, 0xAE, 0xA7, 0x50, 0x79, 0xAE, 0xA7,
+    0x19, 0xFF, 0x7A, 0xE9, 0x3D, 0x59, 0xDA, 0x59, 0xC9, 0x39, 0xD9, 0x7D, 0x3D, 0xA3, 0x99, 0xAA,
+    0xE2, 0xAF, 0xFF, 0xD2, 0xFF, 0xFD, 0xA1, 0x9D, 0xA9, 0x99, 0x97, 0x1A, 0xD7, 0x6E, 0x76, 0xEA,
+    0x75, 0xAF, 0x95, 0x9A, 0x39, 0xFF, 0xFA, 0x4F, 0xFF, 0x95, 0xFF, 0xE7, 0x9A, 0xFC, 0xA9, 0x77,
+    0x77, 0x77, 0x76, 0x9D, 0xA7, 0x5E, 0xA7, 0x49, 0xEA, 0x74, 0xF9, 0x73, 0x9F, 0x97, 0x10, 0x77,
+    0x77, 0x5A, 0xEA, 0x77, 0x1A, 0x91, 0xCA, 0x77, 0x3A, 0xC9, 0x77, 0x2D, 0x97, 0x72, 0xD7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0x99, 0x97, 0xAF, 0xFF, 0xD7, 0xFF, 0xFD, 0x97,
+    0xFF, 0xFC, 0xA7, 0x9E, 0x97, 0x71, 0xE9, 0x77, 0x2E, 0x77, 0x29, 0xE7, 0x72, 0xAD, 0xA7, 0x72,
+    0xE9, 0x77, 0x19, 0xE9, 0x99, 0x99, 0xAA, 0xA7, 0x2A, 0xFF, 0xE7, 0x2F, 0xFE, 0xA7, 0x2F, 0xFE,
+    0x97, 0x19, 0xE9, 0x77, 0x1E, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xAE, 0x77, 0x2E, 0xA7,
+    0x71, 0x9F, 0xFF, 0xD9, 0x6A, 0xFF, 0xFD, 0x96, 0xFF, 0xFE, 0x96, 0xFF, 0xFE, 0x95, 0xAF, 0xFF,
+    0xE6, 0x77, 0x75, 0xAE, 0xA7, 0x4A, 0x2C, 0x97, 0x6D, 0x97, 0x49, 0xD9, 0x75, 0xCA, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xEA, 0x71, 0x9F, 0xF7, 0xAE, 0x93, 0xD5, 0x9D,
+    0xA5, 0x9C, 0x93, 0x9D, 0x97, 0xD3, 0xDA, 0x39, 0x9A, 0xAE, 0x2A, 0xFF, 0xFD, 0x2F, 0xFF, 0xDA,
+    0x19, 0xDA, 0x99, 0x99, 0x71, 0xAD, 0x76, 0xE7, 0x6E, 0xA7, 0x5A, 0xF9, 0x59, 0xA3, 0x9F, 0xFF,
+    0xA4, 0xFF, 0xF9, 0x5F, 0xFE, 0x79, 0xAF, 0xCA, 0x94, 0x75, 0x99, 0x39, 0x97, 0x49, 0xEA, 0x2D,
+    0x74, 0xD0, 0xAC, 0x91, 0xCA, 0x73, 0xAC, 0x2D, 0xAD, 0x74, 0xD3, 0xE9, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x76, 0x99, 0x99, 0x97, 0xAF, 0xFF, 0xD7, 0xFF, 0xFD, 0x97, 0xFF, 0xFC, 0xA7, 0x9E,
+    0x97, 0x71, 0xE9, 0x77, 0x2E, 0x77, 0x29, 0xE7, 0x72, 0xAD, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE9,
+    0x99, 0x99, 0xAA, 0xA7, 0x2A, 0xFF, 0xE7, 0x2F, 0xFE, 0xA7, 0x2F, 0xFE, 0x97, 0x19, 0xE9, 0x77,
+    0x1E, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9F, 0xFF, 0xD9,
+    0x6A, 0xFF, 0xFD, 0x96, 0xFF, 0xFE, 0x96, 0xFF, 0xFE, 0x95, 0xAF, 0xFF, 0xE6, 0x71, 0xE3, 0xD7,
+    0x0D, 0xAC, 0xA2, 0xCA, 0x7A, 0xC9, 0x09, 0xC1, 0x9C, 0x70, 0xD2, 0xFC, 0x79, 0xCA, 0x29, 0xE7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xAE, 0xA7, 0x29, 0xFF, 0x70, 0xAE, 0x93, 0xD6,
+    0x9D, 0xA5, 0x9C, 0x94, 0x9D, 0x97, 0xD4, 0xDA, 0x39, 0x9A, 0xAE, 0x3A, 0xFF, 0xFD, 0x3F, 0xFF,
+    0xDA, 0x29, 0xDA, 0x99, 0x99, 0x72, 0xAD, 0x77, 0xE7, 0x7E, 0xA7, 0x6A, 0xF9, 0x59, 0xA4, 0x9F,
+    0xFF, 0xA5, 0xFF, 0xF9, 0x6F, 0xFE, 0x70, 0x9A, 0xFC, 0xA9, 0x50, 0x77, 0x2A, 0xC9, 0x77, 0x29,
+    0xD7, 0x73, 0xD7, 0x73, 0xDA, 0x77, 0x2A, 0xD7, 0x73, 0xAA, 0x97, 0x77, 0x77, 0x9A, 0x97, 0x73,
+    0xE7, 0x72, 0x9F, 0x97, 0x70, 0xDA, 0x9D, 0x97, 0x6D, 0x92, 0xAC, 0xA7, 0x4A, 0xC9, 0x5A, 0xC7,
+    0x77, 0x77, 0x09, 0x99, 0x99, 0x97, 0xAF, 0xFF, 0xD7, 0xFF, 0xFD, 0x97, 0xFF, 0xFC, 0xA7, 0x9E,
+    0x97, 0x71, 0xE9, 0x77, 0x2E, 0x77, 0x29, 0xE7, 0x72, 0xAD, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE9,
+    0x99, 0x99, 0xAA, 0xA7, 0x2A, 0xFF, 0xE7, 0x2F, 0xFE, 0xA7, 0x2F, 0xFE, 0x97, 0x19, 0xE9, 0x77,
+    0x1E, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9F, 0xFF, 0xD9,
+    0x6A, 0xFF, 0xFD, 0x96, 0xFF, 0xFE, 0x96, 0xFF, 0xFE, 0x95, 0xAF, 0xFF, 0xE6, 0x77, 0x71, 0xAA,
+    0x77, 0x70, 0xD7, 0x77, 0x0A, 0xCA, 0x77, 0x79, 0xD7, 0x39, 0xA7, 0x2D, 0x97, 0x3E, 0x70, 0xE7,
+    0x39, 0xF7, 0x76, 0xD9, 0x9D, 0x97, 0x73, 0xD9, 0x2A, 0xCA, 0x77, 0x1A, 0xC6, 0xCA, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x59, 0xAE, 0xA7, 0x73, 0x9F, 0xF7, 0x71, 0xAE, 0x93, 0xD7, 0x79, 0xDA,
+    0x59, 0xC9, 0x75, 0x9D, 0x97, 0xD7, 0x5D, 0xA3, 0x99, 0xAA, 0xE7, 0x4A, 0xFF, 0xFD, 0x74, 0xFF,
+    0xFD, 0xA7, 0x39, 0xDA, 0x99, 0x99, 0x77, 0x3A, 0xD7, 0x77, 0x0E, 0x77, 0x70, 0xEA, 0x77, 0x7A,
+    0xF9, 0x59, 0xA7, 0x59, 0xFF, 0xFA, 0x76, 0xFF, 0xF9, 0x77, 0xFF, 0xE7, 0x71, 0x9A, 0xFC, 0xA9,
+    0x76, 0x74, 0x9A, 0x97, 0x73, 0x9D, 0xA7, 0x73, 0xAE, 0x77, 0x3F, 0x77, 0x39, 0xAA, 0xA7, 0x79,
+    0xA9, 0x77, 0x3E, 0x77, 0x29, 0xF9, 0x77, 0x0D, 0xA9, 0xD9, 0x76, 0xD9, 0x2A, 0xCA, 0x74, 0xAC,
+    0x95, 0xAC, 0x77, 0x77, 0x70, 0x99, 0x99, 0x99, 0x7A, 0xFF, 0xFD, 0x7F, 0xFF, 0xD9, 0x7F, 0xFF,
+    0xCA, 0x79, 0xE9, 0x77, 0x1E, 0x97, 0x72, 0xE7, 0x72, 0x9E, 0x77, 0x2A, 0xDA, 0x77, 0x2E, 0x97,
+    0x71, 0x9E, 0x99, 0x99, 0x9A, 0xAA, 0x72, 0xAF, 0xFE, 0x72, 0xFF, 0xEA, 0x72, 0xFF, 0xE9, 0x71,
+    0x9E, 0x97, 0x71, 0xEA, 0x77, 0x2E, 0x97, 0x71, 0x9E, 0x77, 0x2A, 0xE7, 0x72, 0xEA, 0x77, 0x19,
+    0xFF, 0xFD, 0x96, 0xAF, 0xFF, 0xD9, 0x6F, 0xFF, 0xE9, 0x6F, 0xFF, 0xE9, 0x5A, 0xFF, 0xFE, 0x60,
+    0x77, 0x71, 0x9D, 0xA7, 0x7A, 0xDA, 0x77, 0xEA, 0x77, 0xF7, 0x69, 0xA7, 0x70, 0xE7, 0x69, 0xF7,
+    0x5D, 0x99, 0xD9, 0x72, 0xD9, 0x2A, 0xCA, 0x70, 0xAC, 0x6C, 0xA7, 0x77, 0x77, 0x77, 0x71, 0x9A,
+    0xEA, 0x72, 0x9F, 0xF7, 0x0A, 0xE9, 0x3D, 0x69, 0xDA, 0x59, 0xC9, 0x49, 0xD9, 0x7D, 0x4D, 0xA3,
+    0x99, 0xAA, 0xE3, 0xAF, 0xFF, 0xD3, 0xFF, 0xFD, 0xA2, 0x9D, 0xA9, 0x99, 0x97, 0x2A, 0xD7, 0x7E,
+    0x77, 0xEA, 0x76, 0xAF, 0x95, 0x9A, 0x49, 0xFF, 0xFA, 0x5F, 0xFF, 0x96, 0xFF, 0xE7, 0x09, 0xAF,
+    0xCA, 0x95, 0x77, 0x77, 0x6A, 0xE9, 0x77, 0x09, 0x91, 0x9C, 0x77, 0x39, 0xD7, 0x72, 0xD9, 0x77,
+    0x3A, 0x77, 0x77, 0x70, 0x9A, 0x97, 0x73, 0xE7, 0x72, 0x9F, 0x97, 0x70, 0xDA, 0x9D, 0x97, 0x6D,
+    0x92, 0xAC, 0xA7, 0x4A, 0xC9, 0x5A, 0xC7, 0x77, 0x77, 0x09, 0x99, 0x99, 0x97, 0xAF, 0xFF, 0xD7,
+    0xFF, 0xFD, 0x97, 0xFF, 0xFC, 0xA7, 0x9E, 0x97, 0x71, 0xE9, 0x77, 0x2E, 0x77, 0x29, 0xE7, 0x72,
+    0xAD, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE9, 0x99, 0x99, 0xAA, 0xA7, 0x2A, 0xFF, 0xE7, 0x2F, 0xFE,
+    0xA7, 0x2F, 0xFE, 0x97, 0x19, 0xE9, 0x77, 0x1E, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xAE,
+    0x77, 0x2E, 0xA7, 0x71, 0x9F, 0xFF, 0xD9, 0x6A, 0xFF, 0xFD, 0x96, 0xFF, 0xFE, 0x96, 0xFF, 0xFE,
+    0x95, 0xAF, 0xFF, 0xE6, 0x77, 0x77, 0x29, 0xF9, 0x76, 0x99, 0x1D, 0x77, 0x1A, 0xCA, 0x77, 0x0D,
+    0x97, 0x70, 0x9C, 0x75, 0xD7, 0x71, 0xAE, 0x77, 0x0F, 0xC7, 0x6D, 0xA0, 0x9D, 0x97, 0x3A, 0xC9,
+    0x3A, 0xC9, 0x72, 0xA9, 0x6A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9A, 0xEA, 0x74,
+    0x9F, 0xF7, 0x2A, 0xE9, 0x3D, 0x70, 0x9D, 0xA5, 0x9C, 0x96, 0x9D, 0x97, 0xD6, 0xDA, 0x39, 0x9A,
+    0xAE, 0x5A, 0xFF, 0xFD, 0x5F, 0xFF, 0xDA, 0x49, 0xDA, 0x99, 0x99, 0x74, 0xAD, 0x77, 0x1E, 0x77,
+    0x1E, 0xA7, 0x70, 0xAF, 0x95, 0x9A, 0x69, 0xFF, 0xFA, 0x7F, 0xFF, 0x97, 0x0F, 0xFE, 0x72, 0x9A,
+    0xFC, 0xA9, 0x70, 0x73, 0x99, 0x49, 0x97, 0x4F, 0x3C, 0xA7, 0x39, 0xCA, 0x0C, 0xA1, 0x9C, 0x74,
+    0xD1, 0x9C, 0x1D, 0x73, 0x9C, 0x92, 0xF9, 0x77, 0x2A, 0xA9, 0x77, 0x77, 0x77, 0x75, 0xAC, 0x97,
+    0x73, 0xE9, 0x77, 0x1A, 0xF9, 0x77, 0x9D, 0x1A, 0xCA, 0x76, 0xD3, 0x9D, 0x74, 0xAA, 0x69, 0xA7,
+    0x77, 0x77, 0x29, 0x99, 0x99, 0x7A, 0xFF, 0xFD, 0x7F, 0xFF, 0xD9, 0x7F, 0xFF, 0xCA, 0x79, 0xE9,
+    0x77, 0x1E, 0x97, 0x72, 0xE7, 0x72, 0x9E, 0x77, 0x2A, 0xDA, 0x77, 0x2E, 0x97, 0x71, 0x9E, 0x99,
+    0x99, 0x9A, 0xAA, 0x72, 0xAF, 0xFE, 0x72, 0xFF, 0xEA, 0x72, 0xFF, 0xE9, 0x71, 0x9E, 0x97, 0x71,
+    0xEA, 0x77, 0x2E, 0x97, 0x71, 0x9E, 0x77, 0x2A, 0xE7, 0x72, 0xEA, 0x77, 0x19, 0xFF, 0xFD, 0x96,
+    0xAF, 0xFF, 0xD9, 0x6F, 0xFF, 0xE9, 0x6F, 0xFF, 0xE9, 0x5A, 0xFF, 0xFE, 0x60, 0x79, 0xDA, 0x3C,
+    0x96, 0x9D, 0xAC, 0x29, 0xC7, 0xD1, 0xD1, 0xD6, 0x9C, 0xA1, 0x9F, 0x96, 0xAC, 0x3A, 0xDA, 0x77,
+    0x77, 0x77, 0x77, 0x0D, 0x76, 0x9E, 0x75, 0xFC, 0x97, 0x2A, 0xD0, 0x9D, 0x97, 0x09, 0xCA, 0x39,
+    0xCA, 0x7A, 0x96, 0xAA, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xEA, 0x71, 0x9F, 0xF7, 0xAE, 0x93, 0xD5,
+    0x9D, 0xA5, 0x9C, 0x93, 0x9D, 0x97, 0xD3, 0xDA, 0x39, 0x9A, 0xAE, 0x2A, 0xFF, 0xFD, 0x2F, 0xFF,
+    0xDA, 0x19, 0xDA, 0x99, 0x99, 0x71, 0xAD, 0x76, 0xE7, 0x6E, 0xA7, 0x5A, 0xF9, 0x59, 0xA3, 0x9F,
+    0xFF, 0xA4, 0xFF, 0xF9, 0x5F, 0xFE, 0x79, 0xAF, 0xCA, 0x94, 0x74, 0x9A, 0x97, 0x73, 0xE7, 0x72,
+    0x9F, 0x97, 0x70, 0xDA, 0x9D, 0x97, 0x6D, 0x92, 0xAC, 0xA7, 0x4A, 0xC9, 0x5A, 0xC7, 0x77, 0x77,
+    0x09, 0x99, 0x99, 0x97, 0xAF, 0xFF, 0xD7, 0xFF, 0xFD, 0x97, 0xFF, 0xFC, 0xA7, 0x9E, 0x97, 0x71,
+    0xE9, 0x77, 0x2E, 0x77, 0x29, 0xE7, 0x72, 0xAD, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE9, 0x99, 0x99,
+    0xAA, 0xA7, 0x2A, 0xFF, 0xE7, 0x2F, 0xFE, 0xA7, 0x2F, 0xFE, 0x97, 0x19, 0xE9, 0x77, 0x1E, 0xA7,
+    0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9F, 0xFF, 0xD9, 0x6A, 0xFF,
+    0xFD, 0x96, 0xFF, 0xFE, 0x96, 0xFF, 0xFE, 0x95, 0xAF, 0xFF, 0xE7, 0x77, 0x77, 0x77, 0x2E, 0x97,
+    0x71, 0x9E, 0x77, 0x2F, 0x77, 0x19, 0xF7, 0x71, 0xAE, 0xA7, 0x50, 0x73, 0xAA, 0x77, 0x2E, 0x77,
+    0x0A, 0xF7, 0x69, 0xD9, 0xAD, 0x75, 0xD3, 0xAC, 0x97, 0x2D, 0x59, 0xCA, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x19, 0xAE, 0xA7, 0x49, 0xFF, 0x72, 0xAE, 0x93, 0xD7, 0x09, 0xDA, 0x59, 0xC9,
+    0x69, 0xD9, 0x7D, 0x6D, 0xA3, 0x99, 0xAA, 0xE5, 0xAF, 0xFF, 0xD5, 0xFF, 0xFD, 0xA4, 0x9D, 0xA9,
+    0x99, 0x97, 0x4A, 0xD7, 0x71, 0xE7, 0x71, 0xEA, 0x77, 0x0A, 0xF9, 0x59, 0xA6, 0x9F, 0xFF, 0xA7,
+    0xFF, 0xF9, 0x70, 0xFF, 0xE7, 0x29, 0xAF, 0xCA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x29, 0xDA, 0x77,
+    0x0E, 0xA7, 0x79, 0xEA, 0x77, 0xF9, 0x76, 0x9F, 0x97, 0x40, 0x77, 0x70, 0x9F, 0x97, 0x19, 0x91,
+    0xAC, 0x74, 0x9D, 0x73, 0xAC, 0xA7, 0x39, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71,
+    0xEA, 0x73, 0xF7, 0x29, 0xEA, 0x72, 0xAE, 0x97, 0x2A, 0xE7, 0x3F, 0x73, 0xE9, 0x72, 0x9E, 0x73,
+    0xAE, 0x73, 0xEA, 0x73, 0xE9, 0x72, 0xAE, 0x73, 0xF7, 0x3E, 0xA7, 0x29, 0xEA, 0x72, 0xAE, 0x97,
+    0x2F, 0x73, 0xF7, 0x2A, 0xEA, 0x72, 0xF9, 0x72, 0xF9, 0x71, 0xAF, 0x72, 0xFC, 0x71, 0x9F, 0xA7,
+    0x19, 0xAE, 0xA7, 0x10, 0x6A, 0xE9, 0x69, 0x91, 0xAC, 0x72, 0xD7, 0x09, 0xD7, 0x09, 0xCA, 0x77,
+    0x77, 0x77, 0x77, 0x70, 0x99, 0x72, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97,
+    0x1D, 0x71, 0xAD, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0xAD, 0x71, 0xE7, 0x1E, 0x70, 0xAD, 0xA7, 0x0E,
+    0x97, 0x0E, 0x97, 0x9E, 0x70, 0x70, 0xEA, 0x71, 0xF7, 0x09, 0xEA, 0x70, 0xAE, 0x97, 0x0A, 0xE7,
+    0x1F, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE, 0x71, 0xEA, 0x71, 0xE9, 0x70, 0xAE, 0x71, 0xF7, 0x1E,
+    0xA7, 0x09, 0xEA, 0x70, 0xAE, 0x97, 0x0F, 0x71, 0xF7, 0x0A, 0xEA, 0x70, 0xF9, 0x70, 0xF9, 0x7A,
+    0xF7, 0x0F, 0xC7, 0x9F, 0xA7, 0x9A, 0xEA, 0x77, 0x77, 0x3A, 0xD9, 0x70, 0x9E, 0x97, 0x0A, 0xE7,
+    0x1F, 0x70, 0xAF, 0x70, 0x70, 0x9D, 0x97, 0x0E, 0xA7, 0xAE, 0x97, 0xF9, 0x69, 0xF7, 0x77, 0x77,
+    0x77, 0x39, 0x97, 0x2D, 0xA7, 0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x1A,
+    0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xE7, 0x0A, 0xDA, 0x70, 0xE9, 0x70, 0xE9,
+    0x79, 0xE7, 0x77, 0x72, 0xAD, 0x97, 0x0E, 0x97, 0xAE, 0x97, 0xF7, 0xAF, 0x70, 0x73, 0x9A, 0xFD,
+    0xA7, 0x70, 0xAF, 0xFE, 0xA7, 0x49, 0xFE, 0xAF, 0xE7, 0x29, 0xFC, 0x94, 0xAF, 0xA7, 0x09, 0xFA,
+    0x7A, 0xF7, 0x0F, 0x97, 0x1F, 0x96, 0xFA, 0x72, 0xAE, 0xA5, 0x9E, 0xA7, 0x39, 0xEA, 0x5F, 0x75,
+    0xEA, 0x49, 0xE9, 0x75, 0xE9, 0x4F, 0x76, 0xE9, 0x4E, 0x97, 0x59, 0xE4, 0x9E, 0x76, 0xAE, 0x4A,
+    0xE7, 0x6E, 0x94, 0xEA, 0x75, 0x9E, 0x5E, 0xA7, 0x5F, 0x5F, 0x74, 0xF9, 0x5F, 0xA7, 0x19, 0xFC,
+    0x6F, 0xD9, 0x92, 0x99, 0xAF, 0xD9, 0x6F, 0xFF, 0xFF, 0x7A, 0xFF, 0xFF, 0xD7, 0x1F, 0xFF, 0xFC,
+    0x97, 0x1A, 0xFF, 0xFE, 0x74, 0x9F, 0xFF, 0xA7, 0x79, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x72, 0x9E, 0x77, 0x7E, 0xA7, 0x76, 0x9E, 0xA7, 0x76, 0xF9, 0x77, 0x59, 0xF9,
+    0x77, 0x00, 0x69, 0xAF, 0xA7, 0x1A, 0xFF, 0x95, 0x9F, 0xAA, 0xAF, 0x94, 0xE9, 0x49, 0xDA, 0x3E,
+    0x7E, 0x29, 0xD9, 0x7E, 0x2E, 0x70, 0xE1, 0x9D, 0x97, 0x0E, 0x1A, 0xD7, 0x0A, 0xD9, 0x1E, 0x70,
+    0xE2, 0xE9, 0x6E, 0xA2, 0xFA, 0x99, 0x99, 0xAF, 0x3A, 0xFF, 0xF5, 0xFF, 0xE9, 0x59, 0xFF, 0xA7,
+    0x1A, 0xFA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x72, 0xE7, 0x5A, 0xE7, 0x5F, 0x74, 0xAE, 0xA7, 0x4F,
+    0xA7, 0x20, 0x77, 0x77, 0x74, 0xAE, 0xA7, 0x76, 0xA2, 0xCA, 0x77, 0x70, 0xAC, 0x97, 0x76, 0x9D,
+    0x77, 0x70, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xFD, 0xA7,
+    0x70, 0xAF, 0xFE, 0xA7, 0x49, 0xFE, 0xAF, 0xE7, 0x29, 0xFC, 0x94, 0xAF, 0xA7, 0x09, 0xFA, 0x7A,
+    0xF7, 0x0F, 0x97, 0x1F, 0x96, 0xFA, 0x72, 0xAE, 0xA5, 0x9E, 0xA7, 0x39, 0xEA, 0x5F, 0x75, 0xEA,
+    0x49, 0xE9, 0x75, 0xE9, 0x4F, 0x76, 0xE9, 0x4E, 0x97, 0x59, 0xE4, 0x9E, 0x76, 0xAE, 0x4A, 0xE7,
+    0x6E, 0x94, 0xEA, 0x75, 0x9E, 0x5E, 0xA7, 0x5F, 0x5F, 0x74, 0xF9, 0x5F, 0xA7, 0x19, 0xFC, 0x6F,
+    0xD9, 0x92, 0x99, 0xAF, 0xD9, 0x6F, 0xFF, 0xFF, 0x7A, 0xFF, 0xFF, 0xD7, 0x1F, 0xFF, 0xFC, 0x97,
+    0x1A, 0xFF, 0xFE, 0x74, 0x9F, 0xFF, 0xA7, 0x79, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x75, 0xAE,
+    0xA7, 0x39, 0x91, 0x9C, 0x76, 0x9D, 0x75, 0xAC, 0xA7, 0x6C, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x9A, 0xFA, 0x71, 0xAF, 0xF9, 0x59, 0xFA, 0xAA, 0xF9, 0x4E, 0x94, 0x9D, 0xA3,
+    0xE7, 0xE2, 0x9D, 0x97, 0xE2, 0xE7, 0x0E, 0x19, 0xD9, 0x70, 0xE1, 0xAD, 0x70, 0xAD, 0x91, 0xE7,
+    0x0E, 0x2E, 0x96, 0xEA, 0x2F, 0xA9, 0x99, 0x9A, 0xF3, 0xAF, 0xFF, 0x5F, 0xFE, 0x95, 0x9F, 0xFA,
+    0x71, 0xAF, 0xA9, 0x60, 0x76, 0x9A, 0x77, 0x77, 0xE7, 0x77, 0x59, 0xF7, 0x77, 0x4D, 0x99, 0xD9,
+    0x77, 0x71, 0xD9, 0x2A, 0xCA, 0x77, 0x7A, 0xC6, 0xD7, 0x77, 0x77, 0x77, 0x09, 0xAF, 0xDA, 0x77,
+    0x6A, 0xFF, 0xEA, 0x7A, 0xA7, 0x09, 0xFE, 0xAF, 0xE5, 0xAC, 0x97, 0x9F, 0xC9, 0x4A, 0xFA, 0x39,
+    0xD7, 0x9F, 0xA7, 0xAF, 0x3D, 0x70, 0xF9, 0x71, 0xF9, 0x1D, 0xA7, 0xFA, 0x72, 0xAE, 0xA0, 0xAD,
+    0x79, 0xEA, 0x73, 0x9E, 0xA7, 0x3F, 0x75, 0xEA, 0x72, 0x9E, 0x97, 0x5E, 0x97, 0x2F, 0x76, 0xE9,
+    0x72, 0xE9, 0x75, 0x9E, 0x72, 0x9E, 0x76, 0xAE, 0x72, 0xAE, 0x76, 0xE9, 0x72, 0xEA, 0x75, 0x9E,
+    0x73, 0xEA, 0x75, 0xF7, 0x3F, 0x74, 0xF9, 0x73, 0xFA, 0x71, 0x9F, 0xC7, 0x4F, 0xD9, 0x92, 0x99,
+    0xAF, 0xD9, 0x74, 0xFF, 0xFF, 0xF7, 0x5A, 0xFF, 0xFF, 0xD7, 0x7F, 0xFF, 0xFC, 0x97, 0x7A, 0xFF,
+    0xFE, 0x77, 0x29, 0xFF, 0xFA, 0x77, 0x59, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x73, 0x77, 0x71, 0xD7,
+    0x77, 0x1D, 0x73, 0xAA, 0x73, 0xAC, 0xA7, 0x3D, 0xA7, 0x19, 0xD7, 0x3A, 0xEA, 0x79, 0xD9, 0x72,
+    0x9D, 0x9A, 0xD6, 0xAA, 0xA7, 0x3D, 0x3D, 0x97, 0x72, 0xD5, 0x9C, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x09, 0xAF, 0xA7, 0x74, 0xAF, 0xF9, 0x77, 0x09, 0xFA, 0xAA, 0xF9, 0x77, 0xE9, 0x49,
+    0xDA, 0x76, 0xE7, 0xE7, 0x59, 0xD9, 0x7E, 0x75, 0xE7, 0x0E, 0x74, 0x9D, 0x97, 0x0E, 0x74, 0xAD,
+    0x70, 0xAD, 0x97, 0x4E, 0x70, 0xE7, 0x5E, 0x96, 0xEA, 0x75, 0xFA, 0x99, 0x99, 0xAF, 0x76, 0xAF,
+    0xFF, 0x77, 0x0F, 0xFE, 0x97, 0x70, 0x9F, 0xFA, 0x77, 0x4A, 0xFA, 0x97, 0x71, 0x72, 0xAD, 0x97,
+    0x77, 0x0E, 0x97, 0x77, 0x0E, 0x97, 0x77, 0x9E, 0x97, 0x77, 0x19, 0x97, 0x77, 0x77, 0x74, 0x9A,
+    0x77, 0x71, 0xE7, 0x77, 0x9F, 0x77, 0x6D, 0x99, 0xD9, 0x77, 0x3D, 0x92, 0xAC, 0xA7, 0x71, 0xAC,
+    0x6D, 0x77, 0x77, 0x74, 0x9A, 0xFD, 0xA7, 0x70, 0xAF, 0xFE, 0xA7, 0x49, 0xFE, 0xAF, 0xE7, 0x29,
+    0xFC, 0x94, 0xAF, 0xA7, 0x09, 0xFA, 0x7A, 0xF7, 0x0F, 0x97, 0x1F, 0x96, 0xFA, 0x72, 0xAE, 0xA5,
+    0x9E, 0xA7, 0x39, 0xEA, 0x5F, 0x75, 0xEA, 0x49, 0xE9, 0x75, 0xE9, 0x4F, 0x76, 0xE9, 0x4E, 0x97,
+    0x59, 0xE4, 0x9E, 0x76, 0xAE, 0x4A, 0xE7, 0x6E, 0x94, 0xEA, 0x75, 0x9E, 0x5E, 0xA7, 0x5F, 0x5F,
+    0x74, 0xF9, 0x5F, 0xA7, 0x19, 0xFC, 0x6F, 0xD9, 0x92, 0x99, 0xAF, 0xD9, 0x6F, 0xFF, 0xFF, 0x7A,
+    0xFF, 0xFF, 0xD7, 0x1F, 0xFF, 0xFC, 0x97, 0x1A, 0xFF, 0xFE, 0x74, 0x9F, 0xFF, 0xA7, 0x79, 0xAF,
+    0xDA, 0x97, 0x77, 0x77, 0x77, 0x71, 0xAD, 0x97, 0x7E, 0x97, 0x7E, 0x97, 0x69, 0xEA, 0x76, 0xAA,
+    0x77, 0x0D, 0xA7, 0x6A, 0xEA, 0x74, 0x9D, 0x9A, 0xD7, 0x3D, 0x3D, 0x97, 0x0D, 0x59, 0xCA, 0x77,
+    0x77, 0x77, 0x77, 0x09, 0xAF, 0xA7, 0x2A, 0xFF, 0x96, 0x9F, 0xAA, 0xAF, 0x95, 0xE9, 0x49, 0xDA,
+    0x4E, 0x7E, 0x39, 0xD9, 0x7E, 0x3E, 0x70, 0xE2, 0x9D, 0x97, 0x0E, 0x2A, 0xD7, 0x0A, 0xD9, 0x2E,
+    0x70, 0xE3, 0xE9, 0x6E, 0xA3, 0xFA, 0x99, 0x99, 0xAF, 0x4A, 0xFF, 0xF6, 0xFF, 0xE9, 0x69, 0xFF,
+    0xA7, 0x2A, 0xFA, 0x97, 0x77, 0x77, 0x77, 0x74, 0x9F, 0x97, 0x77, 0x39, 0x91, 0xAC, 0x77, 0x76,
+    0xAC, 0xA7, 0x77, 0x5D, 0x97, 0x77, 0x59, 0xA7, 0x72, 0x9A, 0x77, 0x77, 0xE7, 0x77, 0x59, 0xF7,
+    0x77, 0x4D, 0x99, 0xD9, 0x77, 0x71, 0xD9, 0x2A, 0xCA, 0x77, 0x7A, 0xC6, 0xD7, 0x77, 0x77, 0x77,
+    0x09, 0xAF, 0xDA, 0x77, 0x6A, 0xFF, 0xEA, 0x77, 0x29, 0xFE, 0xAF, 0xE7, 0x70, 0x9F, 0xC9, 0x4A,
+    0xFA, 0x76, 0x9F, 0xA7, 0xAF, 0x76, 0xF9, 0x71, 0xF9, 0x74, 0xFA, 0x72, 0xAE, 0xA7, 0x39, 0xEA,
+    0x73, 0x9E, 0xA7, 0x3F, 0x75, 0xEA, 0x72, 0x9E, 0x97, 0x5E, 0x97, 0x2F, 0x76, 0xE9, 0x72, 0xE9,
+    0x75, 0x9E, 0x72, 0x9E, 0x76, 0xAE, 0x72, 0xAE, 0x76, 0xE9, 0x72, 0xEA, 0x75, 0x9E, 0x73, 0xEA,
+    0x75, 0xF7, 0x3F, 0x74, 0xF9, 0x73, 0xFA, 0x71, 0x9F, 0xC7, 0x4F, 0xD9, 0x92, 0x99, 0xAF, 0xD9,
+    0x74, 0xFF, 0xFF, 0xF7, 0x5A, 0xFF, 0xFF, 0xD7, 0x7F, 0xFF, 0xFC, 0x97, 0x7A, 0xFF, 0xFE, 0x77,
+    0x29, 0xFF, 0xFA, 0x77, 0x59, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x73, 0x77, 0x77, 0x1A, 0xEA, 0x76,
+    0xA2, 0xCA, 0x77, 0x0A, 0xC9, 0x76, 0x9D, 0x77, 0x0A, 0xA7, 0x39, 0xCA, 0x77, 0x0E, 0xA7, 0x69,
+    0xFA, 0x75, 0xD9, 0x0A, 0xD7, 0x3D, 0x93, 0xAC, 0x97, 0x09, 0xA6, 0x9A, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x75, 0x9A, 0xFA, 0x73, 0xAF, 0xF9, 0x79, 0xFA, 0xAA, 0xF9, 0x6E, 0x94, 0x9D, 0xA5,
+    0xE7, 0xE4, 0x9D, 0x97, 0xE4, 0xE7, 0x0E, 0x39, 0xD9, 0x70, 0xE3, 0xAD, 0x70, 0xAD, 0x93, 0xE7,
+    0x0E, 0x4E, 0x96, 0xEA, 0x4F, 0xA9, 0x99, 0x9A, 0xF5, 0xAF, 0xFF, 0x7F, 0xFE, 0x97, 0x9F, 0xFA,
+    0x73, 0xAF, 0xA9, 0x70, 0x75, 0x99, 0x49, 0x77, 0x2F, 0x29, 0xC9, 0x77, 0x0A, 0xC9, 0x0C, 0xA1,
+    0xAC, 0x77, 0x1C, 0xA1, 0xAC, 0x09, 0xCA, 0x77, 0x09, 0xC9, 0x2F, 0x77, 0x19, 0x5A, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x5D, 0x97, 0x77, 0x0E, 0x77, 0x7F, 0xC9, 0x77, 0x4A, 0xD1, 0xDA, 0x77, 0x29,
+    0xCA, 0x39, 0xCA, 0x77, 0x1A, 0xA6, 0xAA, 0x77, 0x77, 0x75, 0x9A, 0xFD, 0xA7, 0x70, 0xAF, 0xFE,
+    0xA7, 0x49, 0xFE, 0xAF, 0xE7, 0x29, 0xFC, 0x94, 0xAF, 0xA7, 0x09, 0xFA, 0x7A, 0xF7, 0x0F, 0x97,
+    0x1F, 0x96, 0xFA, 0x72, 0xAE, 0xA5, 0x9E, 0xA7, 0x39, 0xEA, 0x5F, 0x75, 0xEA, 0x49, 0xE9, 0x75,
+    0xE9, 0x4F, 0x76, 0xE9, 0x4E, 0x97, 0x59, 0xE4, 0x9E, 0x76, 0xAE, 0x4A, 0xE7, 0x6E, 0x94, 0xEA,
+    0x75, 0x9E, 0x5E, 0xA7, 0x5F, 0x5F, 0x74, 0xF9, 0x5F, 0xA7, 0x19, 0xFC, 0x6F, 0xD9, 0x92, 0x99,
+    0xAF, 0xD9, 0x6F, 0xFF, 0xFF, 0x7A, 0xFF, 0xFF, 0xD7, 0x1F, 0xFF, 0xFC, 0x97, 0x1A, 0xFF, 0xFE,
+    0x74, 0x9F, 0xFF, 0xA7, 0x79, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x70, 0x99, 0x49, 0x79, 0xF2, 0xAC,
+    0x7D, 0x09, 0xC9, 0x1C, 0xA6, 0xAC, 0x91, 0xAF, 0x7D, 0x3A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x0D,
+    0x76, 0x9E, 0x75, 0xFC, 0x73, 0xDA, 0x09, 0xD9, 0x70, 0xAC, 0x93, 0xAC, 0xA7, 0xA9, 0x6A, 0x97,
+    0x77, 0x77, 0x77, 0x59, 0xAF, 0xA7, 0x1A, 0xFF, 0x95, 0x9F, 0xAA, 0xAF, 0x94, 0xE9, 0x49, 0xDA,
+    0x3E, 0x7E, 0x29, 0xD9, 0x7E, 0x2E, 0x70, 0xE1, 0x9D, 0x97, 0x0E, 0x1A, 0xD7, 0x0A, 0xD9, 0x1E,
+    0x70, 0xE2, 0xE9, 0x6E, 0xA2, 0xFA, 0x99, 0x99, 0xAF, 0x3A, 0xFF, 0xF5, 0xFF, 0xE9, 0x59, 0xFF,
+    0xA7, 0x1A, 0xFA, 0x96, 0x76, 0x9A, 0x77, 0x71, 0xE7, 0x77, 0x9F, 0x77, 0x6D, 0x99, 0xD9, 0x77,
+    0x3D, 0x92, 0xAC, 0xA7, 0x71, 0xAC, 0x6D, 0x77, 0x77, 0x74, 0x9A, 0xFD, 0xA7, 0x70, 0xAF, 0xFE,
+    0xA7, 0x49, 0xFE, 0xAF, 0xE7, 0x29, 0xFC, 0x94, 0xAF, 0xA7, 0x09, 0xFA, 0x7A, 0xF7, 0x0F, 0x97,
+    0x1F, 0x96, 0xFA, 0x72, 0xAE, 0xA5, 0x9E, 0xA7, 0x39, 0xEA, 0x5F, 0x75, 0xEA, 0x49, 0xE9, 0x75,
+    0xE9, 0x4F, 0x76, 0xE9, 0x4E, 0x97, 0x59, 0xE4, 0x9E, 0x76, 0xAE, 0x4A, 0xE7, 0x6E, 0x94, 0xEA,
+    0x75, 0x9E, 0x5E, 0xA7, 0x5F, 0x5F, 0x74, 0xF9, 0x5F, 0xA7, 0x19, 0xFC, 0x6F, 0xD9, 0x92, 0x99,
+    0xAF, 0xD9, 0x6F, 0xFF, 0xFF, 0x7A, 0xFF, 0xFF, 0xD7, 0x1F, 0xFF, 0xFC, 0x97, 0x1A, 0xFF, 0xFE,
+    0x74, 0x9F, 0xFF, 0xA7, 0x79, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72,
+    0x9E, 0x77, 0x7E, 0xA7, 0x76, 0x9E, 0xA7, 0x76, 0xF9, 0x77, 0x59, 0xF9, 0x77, 0x00, 0x71, 0xAA,
+    0x77, 0x0D, 0xA7, 0x6A, 0xEA, 0x74, 0x9D, 0x9A, 0xD7, 0x3D, 0x3D, 0x97, 0x0D, 0x59, 0xCA, 0x77,
+    0x77, 0x77, 0x77, 0x09, 0xAF, 0xA7, 0x2A, 0xFF, 0x96, 0x9F, 0xAA, 0xAF, 0x95, 0xE9, 0x49, 0xDA,
+    0x4E, 0x7E, 0x39, 0xD9, 0x7E, 0x3E, 0x70, 0xE2, 0x9D, 0x97, 0x0E, 0x2A, 0xD7, 0x0A, 0xD9, 0x2E,
+    0x70, 0xE3, 0xE9, 0x6E, 0xA3, 0xFA, 0x99, 0x99, 0xAF, 0x4A, 0xFF, 0xF6, 0xFF, 0xE9, 0x69, 0xFF,
+    0xA7, 0x2A, 0xFA, 0x97, 0x77, 0x77, 0x77, 0x77, 0xE7, 0x6A, 0xE7, 0x6F, 0x75, 0xAE, 0xA7, 0x5F,
+    0xA7, 0x00, 0x77, 0x70, 0xAC, 0x97, 0x77, 0x69, 0xD7, 0x77, 0x7D, 0x97, 0x77, 0x6D, 0xA7, 0x77,
+    0x6A, 0xD7, 0x77, 0x7A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0x77,
+    0x77, 0x1A, 0xC7, 0x49, 0xAF, 0xDA, 0x72, 0xD7, 0x2A, 0xFF, 0xEA, 0x79, 0xCA, 0x70, 0x9F, 0xEA,
+    0xFE, 0x6D, 0x70, 0x9F, 0xC9, 0x4A, 0xFA, 0x39, 0xD9, 0x79, 0xFA, 0x7A, 0xF2, 0xAD, 0xA7, 0x0F,
+    0x97, 0x1F, 0x92, 0xC9, 0x70, 0xFA, 0x72, 0xAE, 0xA7, 0x49, 0xEA, 0x73, 0x9E, 0xA7, 0x4F, 0x75,
+    0xEA, 0x73, 0x9E, 0x97, 0x5E, 0x97, 0x3F, 0x76, 0xE9, 0x73, 0xE9, 0x75, 0x9E, 0x73, 0x9E, 0x76,
+    0xAE, 0x73, 0xAE, 0x76, 0xE9, 0x73, 0xEA, 0x75, 0x9E, 0x74, 0xEA, 0x75, 0xF7, 0x4F, 0x74, 0xF9,
+    0x74, 0xFA, 0x71, 0x9F, 0xC7, 0x5F, 0xD9, 0x92, 0x99, 0xAF, 0xD9, 0x75, 0xFF, 0xFF, 0xF7, 0x6A,
+    0xFF, 0xFF, 0xD7, 0x70, 0xFF, 0xFF, 0xC9, 0x77, 0x0A, 0xFF, 0xFE, 0x77, 0x39, 0xFF, 0xFA, 0x77,
+    0x69, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x75, 0x76, 0xAC, 0x97, 0x70, 0x9D, 0x77, 0x1D, 0x77, 0x1D,
+    0xA7, 0x70, 0xAD, 0x77, 0x1A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6A,
+    0xA6, 0x9A, 0xFA, 0x4C, 0xA5, 0xAF, 0xF9, 0x19, 0xC4, 0x9F, 0xAA, 0xAF, 0x09, 0xCA, 0x4E, 0x94,
+    0x9F, 0xC4, 0xE7, 0xE9, 0x49, 0xD9, 0x7E, 0x5E, 0x70, 0xE4, 0x9D, 0x97, 0x0E, 0x4A, 0xD7, 0x0A,
+    0xD9, 0x4E, 0x70, 0xE5, 0xE9, 0x6E, 0xA5, 0xFA, 0x99, 0x99, 0xAF, 0x6A, 0xFF, 0xF7, 0x0F, 0xFE,
+    0x97, 0x09, 0xFF, 0xA7, 0x4A, 0xFA, 0x97, 0x10, 0x77, 0x2A, 0xD7, 0x77, 0x70, 0xE7, 0x77, 0x79,
+    0xE9, 0x77, 0x76, 0x9E, 0x97, 0x77, 0x79, 0x9A, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x99,
+    0x77, 0x77, 0x0A, 0xC7, 0x49, 0xAF, 0xDA, 0x72, 0xD7, 0x2A, 0xFF, 0xEA, 0x79, 0xCA, 0x70, 0x9F,
+    0xEA, 0xFE, 0x6D, 0x70, 0x9F, 0xC9, 0x4A, 0xFA, 0x39, 0xD9, 0x79, 0xFA, 0x7A, 0xF2, 0xAD, 0xA7,
+    0x0F, 0x97, 0x1F, 0x92, 0xC9, 0x70, 0xFA, 0x72, 0xAE, 0xA7, 0x49, 0xEA, 0x73, 0x9E, 0xA7, 0x4F,
+    0x75, 0xEA, 0x73, 0x9E, 0x97, 0x5E, 0x97, 0x3F, 0x76, 0xE9, 0x73, 0xE9, 0x75, 0x9E, 0x73, 0x9E,
+    0x76, 0xAE, 0x73, 0xAE, 0x76, 0xE9, 0x73, 0xEA, 0x75, 0x9E, 0x74, 0xEA, 0x75, 0xF7, 0x4F, 0x74,
+    0xF9, 0x74, 0xFA, 0x71, 0x9F, 0xC7, 0x5F, 0xD9, 0x92, 0x99, 0xAF, 0xD9, 0x75, 0xFF, 0xFF, 0xF7,
+    0x6A, 0xFF, 0xFF, 0xD7, 0x70, 0xFF, 0xFF, 0xC9, 0x77, 0x0A, 0xFF, 0xFE, 0x77, 0x39, 0xFF, 0xFA,
+    0x77, 0x69, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x75, 0x70, 0x99, 0x97, 0x71, 0x9D, 0xA7, 0x71, 0xAD,
+    0xA7, 0x71, 0xF7, 0x71, 0xAE, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xA6, 0x9A,
+    0xFA, 0x4C, 0xA5, 0xAF, 0xF9, 0x19, 0xC4, 0x9F, 0xAA, 0xAF, 0x09, 0xCA, 0x4E, 0x94, 0x9F, 0xC4,
+    0xE7, 0xE9, 0x49, 0xD9, 0x7E, 0x5E, 0x70, 0xE4, 0x9D, 0x97, 0x0E, 0x4A, 0xD7, 0x0A, 0xD9, 0x4E,
+    0x70, 0xE5, 0xE9, 0x6E, 0xA5, 0xFA, 0x99, 0x99, 0xAF, 0x6A, 0xFF, 0xF7, 0x0F, 0xFE, 0x97, 0x09,
+    0xFF, 0xA7, 0x4A, 0xFA, 0x97, 0x10, 0x77, 0x5A, 0xEA, 0x77, 0x74, 0x9A, 0x19, 0xC7, 0x77, 0x70,
+    0xD7, 0x77, 0x69, 0xD7, 0x77, 0x7C, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x75, 0x99, 0x77, 0x77, 0x0A, 0xC7, 0x49, 0xAF, 0xDA, 0x72, 0xD7, 0x2A, 0xFF, 0xEA, 0x79,
+    0xCA, 0x70, 0x9F, 0xEA, 0xFE, 0x6D, 0x70, 0x9F, 0xC9, 0x4A, 0xFA, 0x39, 0xD9, 0x79, 0xFA, 0x7A,
+    0xF2, 0xAD, 0xA7, 0x0F, 0x97, 0x1F, 0x92, 0xC9, 0x70, 0xFA, 0x72, 0xAE, 0xA7, 0x49, 0xEA, 0x73,
+    0x9E, 0xA7, 0x4F, 0x75, 0xEA, 0x73, 0x9E, 0x97, 0x5E, 0x97, 0x3F, 0x76, 0xE9, 0x73, 0xE9, 0x75,
+    0x9E, 0x73, 0x9E, 0x76, 0xAE, 0x73, 0xAE, 0x76, 0xE9, 0x73, 0xEA, 0x75, 0x9E, 0x74, 0xEA, 0x75,
+    0xF7, 0x4F, 0x74, 0xF9, 0x74, 0xFA, 0x71, 0x9F, 0xC7, 0x5F, 0xD9, 0x92, 0x99, 0xAF, 0xD9, 0x75,
+    0xFF, 0xFF, 0xF7, 0x6A, 0xFF, 0xFF, 0xD7, 0x70, 0xFF, 0xFF, 0xC9, 0x77, 0x0A, 0xFF, 0xFE, 0x77,
+    0x39, 0xFF, 0xFA, 0x77, 0x69, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x75, 0x77, 0x77, 0x0A, 0xEA, 0x76,
+    0x99, 0x19, 0xC7, 0x71, 0x9D, 0x77, 0x0A, 0xCA, 0x77, 0x1C, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x76, 0xAA, 0x69, 0xAF, 0xA4, 0xCA, 0x5A, 0xFF, 0x91, 0x9C, 0x49, 0xFA, 0xAA,
+    0xF0, 0x9C, 0xA4, 0xE9, 0x49, 0xFC, 0x4E, 0x7E, 0x94, 0x9D, 0x97, 0xE5, 0xE7, 0x0E, 0x49, 0xD9,
+    0x70, 0xE4, 0xAD, 0x70, 0xAD, 0x94, 0xE7, 0x0E, 0x5E, 0x96, 0xEA, 0x5F, 0xA9, 0x99, 0x9A, 0xF6,
+    0xAF, 0xFF, 0x70, 0xFF, 0xE9, 0x70, 0x9F, 0xFA, 0x74, 0xAF, 0xA9, 0x71, 0x77, 0x39, 0x94, 0x99,
+    0x77, 0x70, 0xF3, 0xCA, 0x77, 0x79, 0xCA, 0x0C, 0xA1, 0x9C, 0x77, 0x70, 0xD1, 0x9C, 0x1D, 0x77,
+    0x79, 0xCA, 0x2F, 0x97, 0x77, 0x9C, 0x93, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59,
+    0x97, 0x77, 0x70, 0xAC, 0x74, 0x9A, 0xFD, 0xA7, 0x2D, 0x72, 0xAF, 0xFE, 0xA7, 0x9C, 0xA7, 0x09,
+    0xFE, 0xAF, 0xE6, 0xD7, 0x09, 0xFC, 0x94, 0xAF, 0xA3, 0x9D, 0x97, 0x9F, 0xA7, 0xAF, 0x2A, 0xDA,
+    0x70, 0xF9, 0x71, 0xF9, 0x2C, 0x97, 0x0F, 0xA7, 0x2A, 0xEA, 0x74, 0x9E, 0xA7, 0x39, 0xEA, 0x74,
+    0xF7, 0x5E, 0xA7, 0x39, 0xE9, 0x75, 0xE9, 0x73, 0xF7, 0x6E, 0x97, 0x3E, 0x97, 0x59, 0xE7, 0x39,
+    0xE7, 0x6A, 0xE7, 0x3A, 0xE7, 0x6E, 0x97, 0x3E, 0xA7, 0x59, 0xE7, 0x4E, 0xA7, 0x5F, 0x74, 0xF7,
+    0x4F, 0x97, 0x4F, 0xA7, 0x19, 0xFC, 0x75, 0xFD, 0x99, 0x29, 0x9A, 0xFD, 0x97, 0x5F, 0xFF, 0xFF,
+    0x76, 0xAF, 0xFF, 0xFD, 0x77, 0x0F, 0xFF, 0xFC, 0x97, 0x70, 0xAF, 0xFF, 0xE7, 0x73, 0x9F, 0xFF,
+    0xA7, 0x76, 0x9A, 0xFD, 0xA9, 0x77, 0x77, 0x77, 0x50, 0x70, 0x9D, 0xA3, 0xCA, 0x72, 0xDA, 0xC9,
+    0x19, 0xC9, 0x71, 0xD1, 0xAC, 0x1A, 0xC7, 0x2C, 0xA2, 0xFA, 0x71, 0x9C, 0x92, 0x9D, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7A, 0xA6, 0x9A, 0xFA, 0x4C, 0xA5, 0xAF, 0xF9, 0x19, 0xC4,
+    0x9F, 0xAA, 0xAF, 0x09, 0xCA, 0x4E, 0x94, 0x9F, 0xC4, 0xE7, 0xE9, 0x49, 0xD9, 0x7E, 0x5E, 0x70,
+    0xE4, 0x9D, 0x97, 0x0E, 0x4A, 0xD7, 0x0A, 0xD9, 0x4E, 0x70, 0xE5, 0xE9, 0x6E, 0xA5, 0xFA, 0x99,
+    0x99, 0xAF, 0x6A, 0xFF, 0xF7, 0x0F, 0xFE, 0x97, 0x09, 0xFF, 0xA7, 0x4A, 0xFA, 0x97, 0x10, 0x77,
+    0x77, 0x99, 0x77, 0x77, 0x0A, 0xC7, 0x49, 0xAF, 0xDA, 0x72, 0xD7, 0x2A, 0xFF, 0xEA, 0x79, 0xCA,
+    0x70, 0x9F, 0xEA, 0xFE, 0x6D, 0x70, 0x9F, 0xC9, 0x4A, 0xFA, 0x39, 0xD9, 0x79, 0xFA, 0x7A, 0xF2,
+    0xAD, 0xA7, 0x0F, 0x97, 0x1F, 0x92, 0xC9, 0x70, 0xFA, 0x72, 0xAE, 0xA7, 0x49, 0xEA, 0x73, 0x9E,
+    0xA7, 0x4F, 0x75, 0xEA, 0x73, 0x9E, 0x97, 0x5E, 0x97, 0x3F, 0x76, 0xE9, 0x73, 0xE9, 0x75, 0x9E,
+    0x73, 0x9E, 0x76, 0xAE, 0x73, 0xAE, 0x76, 0xE9, 0x73, 0xEA, 0x75, 0x9E, 0x74, 0xEA, 0x75, 0xF7,
+    0x4F, 0x74, 0xF9, 0x74, 0xFA, 0x71, 0x9F, 0xC7, 0x5F, 0xD9, 0x92, 0x99, 0xAF, 0xD9, 0x75, 0xFF,
+    0xFF, 0xF7, 0x6A, 0xFF, 0xFF, 0xD7, 0x70, 0xFF, 0xFF, 0xC9, 0x77, 0x0A, 0xFF, 0xFE, 0x77, 0x39,
+    0xFF, 0xFA, 0x77, 0x69, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x75, 0x9E, 0x77, 0x76, 0xEA, 0x77, 0x75, 0x9E, 0xA7, 0x77, 0x5F, 0x97, 0x77, 0x49, 0xF9, 0x77,
+    0x70, 0x77, 0x77, 0x7A, 0xA6, 0x9A, 0xFA, 0x4C, 0xA5, 0xAF, 0xF9, 0x19, 0xC4, 0x9F, 0xAA, 0xAF,
+    0x09, 0xCA, 0x4E, 0x94, 0x9F, 0xC4, 0xE7, 0xE9, 0x49, 0xD9, 0x7E, 0x5E, 0x70, 0xE4, 0x9D, 0x97,
+    0x0E, 0x4A, 0xD7, 0x0A, 0xD9, 0x4E, 0x70, 0xE5, 0xE9, 0x6E, 0xA5, 0xFA, 0x99, 0x99, 0xAF, 0x6A,
+    0xFF, 0xF7, 0x0F, 0xFE, 0x97, 0x09, 0xFF, 0xA7, 0x4A, 0xFA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x71, 0xE7, 0x70, 0xAE, 0x77, 0x0F, 0x77, 0xAE, 0xA7, 0x7F, 0xA7, 0x50, 0x5F, 0x97, 0x09, 0xF9,
+    0x49, 0xF9, 0x70, 0xAF, 0x5A, 0xF7, 0x1F, 0xC5, 0xFA, 0x71, 0xFA, 0x5F, 0x97, 0x09, 0xF5, 0x9F,
+    0x71, 0xAF, 0x5A, 0xF7, 0x1F, 0xA5, 0xF9, 0x71, 0xF9, 0x5F, 0x71, 0x9F, 0x6F, 0x71, 0xAE, 0xA5,
+    0x9E, 0xA7, 0x1A, 0xE9, 0x5A, 0xE7, 0x2F, 0x6F, 0x72, 0xEA, 0x6E, 0xA7, 0x19, 0xE9, 0x59, 0xE9,
+    0x71, 0xF6, 0xAE, 0x72, 0xF6, 0xF7, 0x1A, 0xE9, 0x6F, 0x71, 0xF7, 0xF9, 0x7F, 0xC6, 0x9F, 0xCA,
+    0x99, 0x99, 0xAF, 0xD9, 0x69, 0xFF, 0xFF, 0xC7, 0x9F, 0xFF, 0xF9, 0x70, 0xFF, 0xFE, 0xA7, 0x1A,
+    0xFF, 0xFC, 0xA7, 0x39, 0xAF, 0xFC, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xAD, 0x97, 0x75,
+    0xE9, 0x77, 0x4A, 0xE9, 0x77, 0x4F, 0x77, 0x4A, 0xF7, 0x70, 0x29, 0xD9, 0x6A, 0xD9, 0x2A, 0xD7,
+    0xE3, 0xE7, 0xE3, 0xE6, 0x9D, 0xA2, 0x9D, 0xA6, 0xAD, 0x92, 0xAD, 0x96, 0xE3, 0xAD, 0x69, 0xE3,
+    0xE6, 0xAD, 0xA3, 0xDA, 0x6E, 0x92, 0x9D, 0xA5, 0xAE, 0x92, 0xAE, 0x4A, 0xF3, 0xAF, 0xFF, 0xC3,
+    0xAF, 0xFF, 0xA3, 0xAF, 0xFF, 0x93, 0x9F, 0xF9, 0xE5, 0x9F, 0xCA, 0x09, 0xE7, 0x77, 0x77, 0x77,
+    0x49, 0xE7, 0x5E, 0xA7, 0x49, 0xEA, 0x74, 0xF9, 0x73, 0x9F, 0x97, 0x20, 0x77, 0xAE, 0xA7, 0x74,
+    0xA9, 0x09, 0xC9, 0x77, 0x6A, 0xC9, 0x77, 0x49, 0xD9, 0x77, 0x5D, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0xF9, 0x70, 0x9F, 0x94, 0x9F, 0x97, 0x0A, 0xF5, 0xAF, 0x71,
+    0xFC, 0x5F, 0xA7, 0x1F, 0xA5, 0xF9, 0x70, 0x9F, 0x59, 0xF7, 0x1A, 0xF5, 0xAF, 0x71, 0xFA, 0x5F,
+    0x97, 0x1F, 0x95, 0xF7, 0x19, 0xF6, 0xF7, 0x1A, 0xEA, 0x59, 0xEA, 0x71, 0xAE, 0x95, 0xAE, 0x72,
+    0xF6, 0xF7, 0x2E, 0xA6, 0xEA, 0x71, 0x9E, 0x95, 0x9E, 0x97, 0x1F, 0x6A, 0xE7, 0x2F, 0x6F, 0x71,
+    0xAE, 0x96, 0xF7, 0x1F, 0x7F, 0x97, 0xFC, 0x69, 0xFC, 0xA9, 0x99, 0x9A, 0xFD, 0x96, 0x9F, 0xFF,
+    0xFC, 0x79, 0xFF, 0xFF, 0x97, 0x0F, 0xFF, 0xEA, 0x71, 0xAF, 0xFF, 0xCA, 0x73, 0x9A, 0xFF, 0xCA,
+    0x97, 0x77, 0x73, 0x77, 0x73, 0x9F, 0x97, 0x39, 0x91, 0xAC, 0x76, 0x9C, 0xA7, 0x5D, 0xA7, 0x5A,
+    0xC7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9D, 0x96, 0xAD, 0x92, 0xAD, 0x7E, 0x3E, 0x7E, 0x3E,
+    0x69, 0xDA, 0x29, 0xDA, 0x6A, 0xD9, 0x2A, 0xD9, 0x6E, 0x3A, 0xD6, 0x9E, 0x3E, 0x6A, 0xDA, 0x3D,
+    0xA6, 0xE9, 0x29, 0xDA, 0x5A, 0xE9, 0x2A, 0xE4, 0xAF, 0x3A, 0xFF, 0xFC, 0x3A, 0xFF, 0xFA, 0x3A,
+    0xFF, 0xF9, 0x39, 0xFF, 0x9E, 0x59, 0xFC, 0xA0, 0x9E, 0x77, 0x50, 0x77, 0x3A, 0xA7, 0x77, 0x2D,
+    0x77, 0x72, 0xAC, 0xA7, 0x77, 0x19, 0xD7, 0x77, 0x2D, 0x97, 0x77, 0x1E, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xA6, 0xFA, 0x70, 0x9F, 0x90, 0x9C, 0x94, 0x9F,
+    0x71, 0xAF, 0x1D, 0x94, 0xAF, 0x71, 0xFF, 0xC5, 0xFA, 0x71, 0xFF, 0x6F, 0x97, 0x09, 0xF9, 0x97,
+    0x9F, 0x71, 0xAF, 0x71, 0xAE, 0xA7, 0x1F, 0xA7, 0x1F, 0x97, 0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71,
+    0x9F, 0x71, 0xAE, 0xA7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xAE, 0x72, 0xF7, 0x2F, 0x72, 0xEA, 0x72,
+    0xEA, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0xF7, 0x2A, 0xE7, 0x2F, 0x72, 0xF7, 0x1A, 0xE9, 0x72,
+    0xF7, 0x1F, 0x73, 0xF9, 0x7F, 0xA7, 0x29, 0xFC, 0xA9, 0x99, 0x9A, 0xFD, 0x97, 0x29, 0xFF, 0xFF,
+    0xC7, 0x39, 0xFF, 0xFF, 0x97, 0x4F, 0xFF, 0xEA, 0x75, 0xAF, 0xFF, 0xCA, 0x77, 0x9A, 0xFF, 0xCA,
+    0x97, 0x77, 0x77, 0x30, 0x75, 0xAA, 0x77, 0x19, 0xCA, 0x77, 0x09, 0xD7, 0x71, 0xD9, 0x77, 0x0A,
+    0xD7, 0x70, 0xAD, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x99, 0x77, 0x2C, 0xA2, 0x9D, 0x96, 0xAD,
+    0x99, 0xC9, 0x2A, 0xD7, 0xE9, 0xD3, 0xE7, 0xFC, 0x4E, 0x69, 0xF4, 0x9D, 0xA6, 0xAD, 0x95, 0xAD,
+    0x96, 0xE6, 0xAD, 0x69, 0xE6, 0xE6, 0xAD, 0xA6, 0xDA, 0x6E, 0x95, 0x9D, 0xA5, 0xAE, 0x6A, 0xE4,
+    0xAF, 0x6A, 0xFF, 0xFC, 0x6A, 0xFF, 0xFA, 0x6A, 0xFF, 0xF9, 0x69, 0xFF, 0x9E, 0x70, 0x9F, 0xCA,
+    0x09, 0xE7, 0x77, 0x30, 0x77, 0x77, 0x72, 0x9D, 0xA7, 0x77, 0x2A, 0xDA, 0x77, 0x72, 0xEA, 0x77,
+    0x72, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5A, 0x6F, 0xA7, 0x09, 0xF9,
+    0x09, 0xC9, 0x49, 0xF7, 0x1A, 0xF1, 0xD9, 0x4A, 0xF7, 0x1F, 0xFC, 0x5F, 0xA7, 0x1F, 0xF6, 0xF9,
+    0x70, 0x9F, 0x99, 0x79, 0xF7, 0x1A, 0xF7, 0x1A, 0xEA, 0x71, 0xFA, 0x71, 0xF9, 0x71, 0xF9, 0x71,
+    0xF7, 0x19, 0xF7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x1A, 0xE7, 0x2F, 0x72,
+    0xF7, 0x2E, 0xA7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x1F, 0x72, 0xAE, 0x72, 0xF7, 0x2F,
+    0x71, 0xAE, 0x97, 0x2F, 0x71, 0xF7, 0x3F, 0x97, 0xFA, 0x72, 0x9F, 0xCA, 0x99, 0x99, 0xAF, 0xD9,
+    0x72, 0x9F, 0xFF, 0xFC, 0x73, 0x9F, 0xFF, 0xF9, 0x74, 0xFF, 0xFE, 0xA7, 0x5A, 0xFF, 0xFC, 0xA7,
+    0x79, 0xAF, 0xFC, 0xA9, 0x77, 0x77, 0x73, 0x77, 0x74, 0xE7, 0x72, 0xE9, 0x77, 0x09, 0xE9, 0x77,
+    0x09, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x29, 0x97, 0x72, 0xCA, 0x29, 0xD9, 0x6A, 0xD9, 0x9C, 0x92,
+    0xAD, 0x7E, 0x9D, 0x3E, 0x7F, 0xC4, 0xE6, 0x9F, 0x49, 0xDA, 0x6A, 0xD9, 0x5A, 0xD9, 0x6E, 0x6A,
+    0xD6, 0x9E, 0x6E, 0x6A, 0xDA, 0x6D, 0xA6, 0xE9, 0x59, 0xDA, 0x5A, 0xE6, 0xAE, 0x4A, 0xF6, 0xAF,
+    0xFF, 0xC6, 0xAF, 0xFF, 0xA6, 0xAF, 0xFF, 0x96, 0x9F, 0xF9, 0xE7, 0x09, 0xFC, 0xA0, 0x9E, 0x77,
+    0x73, 0x77, 0xAE, 0xA7, 0x77, 0x0A, 0x90, 0x9C, 0x97, 0x77, 0x2A, 0xC7, 0x77, 0x19, 0xD9, 0x77,
+    0x71, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xA6, 0xFA,
+    0x70, 0x9F, 0x90, 0x9C, 0x94, 0x9F, 0x71, 0xAF, 0x1D, 0x94, 0xAF, 0x71, 0xFF, 0xC5, 0xFA, 0x71,
+    0xFF, 0x6F, 0x97, 0x09, 0xF9, 0x97, 0x9F, 0x71, 0xAF, 0x71, 0xAE, 0xA7, 0x1F, 0xA7, 0x1F, 0x97,
+    0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xAE,
+    0x72, 0xF7, 0x2F, 0x72, 0xEA, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0xF7, 0x2A, 0xE7,
+    0x2F, 0x72, 0xF7, 0x1A, 0xE9, 0x72, 0xF7, 0x1F, 0x73, 0xF9, 0x7F, 0xA7, 0x29, 0xFC, 0xA9, 0x99,
+    0x9A, 0xFD, 0x97, 0x29, 0xFF, 0xFF, 0xC7, 0x39, 0xFF, 0xFF, 0x97, 0x4F, 0xFF, 0xEA, 0x75, 0xAF,
+    0xFF, 0xCA, 0x77, 0x9A, 0xFF, 0xCA, 0x97, 0x77, 0x77, 0x30, 0x77, 0x76, 0x9F, 0x97, 0x69, 0x91,
+    0xAC, 0x77, 0x19, 0xCA, 0x77, 0x0D, 0xA7, 0x70, 0xAC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x97,
+    0x73, 0xCA, 0x29, 0xD9, 0x6A, 0xD9, 0x9C, 0x92, 0xAD, 0x7E, 0x9D, 0x3E, 0x7F, 0xC4, 0xE6, 0x9F,
+    0x49, 0xDA, 0x6A, 0xD9, 0x5A, 0xD9, 0x6E, 0x6A, 0xD6, 0x9E, 0x6E, 0x6A, 0xDA, 0x6D, 0xA6, 0xE9,
+    0x59, 0xDA, 0x5A, 0xE6, 0xAE, 0x4A, 0xF6, 0xAF, 0xFF, 0xC6, 0xAF, 0xFF, 0xA6, 0xAF, 0xFF, 0x96,
+    0x9F, 0xF9, 0xE7, 0x09, 0xFC, 0xA0, 0x9E, 0x77, 0x73, 0x75, 0x99, 0x93, 0x99, 0x77, 0x3A, 0xE9,
+    0x2C, 0xA7, 0x72, 0x9C, 0xA0, 0xAC, 0x2C, 0x97, 0x72, 0xD1, 0x9C, 0x90, 0xD7, 0x73, 0xCA, 0x2A,
+    0xEA, 0x77, 0x71, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0x6F, 0xA7, 0x09,
+    0xF9, 0x09, 0xC9, 0x49, 0xF7, 0x1A, 0xF1, 0xD9, 0x4A, 0xF7, 0x1F, 0xFC, 0x5F, 0xA7, 0x1F, 0xF6,
+    0xF9, 0x70, 0x9F, 0x99, 0x79, 0xF7, 0x1A, 0xF7, 0x1A, 0xEA, 0x71, 0xFA, 0x71, 0xF9, 0x71, 0xF9,
+    0x71, 0xF7, 0x19, 0xF7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x1A, 0xE7, 0x2F,
+    0x72, 0xF7, 0x2E, 0xA7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x1F, 0x72, 0xAE, 0x72, 0xF7,
+    0x2F, 0x71, 0xAE, 0x97, 0x2F, 0x71, 0xF7, 0x3F, 0x97, 0xFA, 0x72, 0x9F, 0xCA, 0x99, 0x99, 0xAF,
+    0xD9, 0x72, 0x9F, 0xFF, 0xFC, 0x73, 0x9F, 0xFF, 0xF9, 0x74, 0xFF, 0xFE, 0xA7, 0x5A, 0xFF, 0xFC,
+    0xA7, 0x79, 0xAF, 0xFC, 0xA9, 0x77, 0x77, 0x73, 0x7A, 0xD9, 0x29, 0xC7, 0x2A, 0xDA, 0xC2, 0xAC,
+    0x72, 0xD1, 0xCA, 0x1C, 0xA7, 0x1A, 0xC9, 0x1A, 0xCA, 0xD7, 0x2D, 0x3A, 0xD9, 0x77, 0x77, 0x77,
+    0x77, 0x1A, 0x97, 0x72, 0xCA, 0x29, 0xD9, 0x6A, 0xD9, 0x9C, 0x92, 0xAD, 0x7E, 0x9D, 0x3E, 0x7F,
+    0xC4, 0xE6, 0x9F, 0x49, 0xDA, 0x6A, 0xD9, 0x5A, 0xD9, 0x6E, 0x6A, 0xD6, 0x9E, 0x6E, 0x6A, 0xDA,
+    0x6D, 0xA6, 0xE9, 0x59, 0xDA, 0x5A, 0xE6, 0xAE, 0x4A, 0xF6, 0xAF, 0xFF, 0xC6, 0xAF, 0xFF, 0xA6,
+    0xAF, 0xFF, 0x96, 0x9F, 0xF9, 0xE7, 0x09, 0xFC, 0xA0, 0x9E, 0x77, 0x73, 0x77, 0x73, 0xA6, 0xFA,
+    0x70, 0x9F, 0x90, 0x9C, 0x94, 0x9F, 0x71, 0xAF, 0x1D, 0x94, 0xAF, 0x71, 0xFF, 0xC5, 0xFA, 0x71,
+    0xFF, 0x6F, 0x97, 0x09, 0xF9, 0x97, 0x9F, 0x71, 0xAF, 0x71, 0xAE, 0xA7, 0x1F, 0xA7, 0x1F, 0x97,
+    0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xAE,
+    0x72, 0xF7, 0x2F, 0x72, 0xEA, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0xF7, 0x2A, 0xE7,
+    0x2F, 0x72, 0xF7, 0x1A, 0xE9, 0x72, 0xF7, 0x1F, 0x73, 0xF9, 0x7F, 0xA7, 0x29, 0xFC, 0xA9, 0x99,
+    0x9A, 0xFD, 0x97, 0x29, 0xFF, 0xFF, 0xC7, 0x39, 0xFF, 0xFF, 0x97, 0x4F, 0xFF, 0xEA, 0x75, 0xAF,
+    0xFF, 0xCA, 0x77, 0x9A, 0xFF, 0xCA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5A, 0xD9, 0x77,
+    0x71, 0xE9, 0x77, 0x70, 0xAE, 0x97, 0x77, 0x0F, 0x77, 0x70, 0xAF, 0x77, 0x40, 0x77, 0x29, 0x97,
+    0x72, 0xCA, 0x29, 0xD9, 0x6A, 0xD9, 0x9C, 0x92, 0xAD, 0x7E, 0x9D, 0x3E, 0x7F, 0xC4, 0xE6, 0x9F,
+    0x49, 0xDA, 0x6A, 0xD9, 0x5A, 0xD9, 0x6E, 0x6A, 0xD6, 0x9E, 0x6E, 0x6A, 0xDA, 0x6D, 0xA6, 0xE9,
+    0x59, 0xDA, 0x5A, 0xE6, 0xAE, 0x4A, 0xF6, 0xAF, 0xFF, 0xC6, 0xAF, 0xFF, 0xA6, 0xAF, 0xFF, 0x96,
+    0x9F, 0xF9, 0xE7, 0x09, 0xFC, 0xA0, 0x9E, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9E, 0x77, 0x0E, 0xA7,
+    0x79, 0xEA, 0x77, 0xF9, 0x76, 0x9F, 0x97, 0x50, 0x7A, 0xA9, 0x77, 0x1A, 0xD9, 0x77, 0x1E, 0xA7,
+    0x71, 0xEA, 0x77, 0x19, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2E, 0xA7, 0x3E, 0x90, 0xF7,
+    0x2E, 0xA1, 0xAE, 0x71, 0xAE, 0x29, 0xE9, 0x7A, 0xE4, 0xF6, 0x9E, 0x94, 0xF6, 0xEA, 0x5A, 0xE9,
+    0x4F, 0x6A, 0xEA, 0x3F, 0x79, 0xF2, 0xAE, 0x97, 0x0F, 0x90, 0xAE, 0xA7, 0x1F, 0xA9, 0xF7, 0x2A,
+    0xFF, 0x97, 0x29, 0xFE, 0x97, 0x39, 0xFD, 0xA7, 0x5F, 0xD7, 0x6F, 0xC9, 0x76, 0xFA, 0x77, 0xF9,
+    0x76, 0xAF, 0x77, 0xFC, 0x76, 0xAF, 0xA7, 0x6F, 0xC9, 0x75, 0x9F, 0xC7, 0x6F, 0xD7, 0x59, 0xFC,
+    0xA7, 0x50, 0x72, 0xDA, 0x77, 0x29, 0xE7, 0x72, 0xAE, 0x77, 0x2F, 0x77, 0x39, 0x99, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x7D, 0xA7, 0x0E, 0x6E, 0x79, 0xD9, 0x6A, 0xD9, 0x6E, 0x7A, 0xDA,
+    0x5A, 0xD9, 0x79, 0xE5, 0xE7, 0x1E, 0x4E, 0x97, 0x1E, 0xA2, 0x9E, 0x72, 0xAE, 0x2E, 0x97, 0x29,
+    0xE1, 0xAE, 0x74, 0xEA, 0x0E, 0x97, 0x4F, 0xAE, 0x75, 0xAF, 0xD9, 0x75, 0x9F, 0xD7, 0x7F, 0xC9,
+    0x77, 0xFC, 0x77, 0x0F, 0x97, 0x79, 0xF7, 0x70, 0xF9, 0x76, 0x9F, 0xC7, 0x59, 0xFD, 0x73, 0xFF,
+    0xC7, 0x4F, 0xEA, 0x74, 0x9F, 0xD9, 0x75, 0xAD, 0xA9, 0x77, 0x00, 0x3E, 0xA7, 0x3E, 0x93, 0xF7,
+    0x2E, 0xA4, 0xAE, 0x71, 0xAE, 0x59, 0xE9, 0x7A, 0xE7, 0xF6, 0x9E, 0x97, 0xF6, 0xEA, 0x70, 0xAE,
+    0x94, 0xF7, 0x1A, 0xEA, 0x3F, 0x72, 0x9F, 0x2A, 0xE9, 0x73, 0xF9, 0x0A, 0xEA, 0x74, 0xFA, 0x9F,
+    0x75, 0xAF, 0xF9, 0x75, 0x9F, 0xE9, 0x76, 0x9F, 0xDA, 0x77, 0x0F, 0xD7, 0x71, 0xFC, 0x97, 0x71,
+    0xFA, 0x77, 0x2F, 0x97, 0x71, 0xAF, 0x77, 0x2F, 0xC7, 0x71, 0xAF, 0xA7, 0x71, 0xFC, 0x97, 0x70,
+    0x9F, 0xC7, 0x71, 0xFD, 0x77, 0x09, 0xFC, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x7A, 0xDA, 0x77, 0x3E, 0xA7, 0x72, 0xAE, 0x97, 0x72, 0xF9, 0x77, 0x19,
+    0xF7, 0x72, 0x5D, 0xA7, 0x0E, 0x6E, 0x79, 0xD9, 0x6A, 0xD9, 0x6E, 0x7A, 0xDA, 0x5A, 0xD9, 0x79,
+    0xE5, 0xE7, 0x1E, 0x4E, 0x97, 0x1E, 0xA2, 0x9E, 0x72, 0xAE, 0x2E, 0x97, 0x29, 0xE1, 0xAE, 0x74,
+    0xEA, 0x0E, 0x97, 0x4F, 0xAE, 0x75, 0xAF, 0xD9, 0x75, 0x9F, 0xD7, 0x7F, 0xC9, 0x77, 0xFC, 0x77,
+    0x0F, 0x97, 0x79, 0xF7, 0x70, 0xF9, 0x76, 0x9F, 0xC7, 0x59, 0xFD, 0x73, 0xFF, 0xC4, 0xEA, 0x3F,
+    0xEA, 0x5E, 0x92, 0x9F, 0xD9, 0x5A, 0xE9, 0x2A, 0xDA, 0x97, 0x0F, 0x77, 0x0A, 0xF3, 0x77, 0x77,
+    0xAE, 0xA7, 0x7A, 0x2C, 0xA7, 0x71, 0xAC, 0x97, 0x79, 0xD9, 0x77, 0x0C, 0xA7, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x75, 0xEA, 0x73, 0xE9, 0x0F, 0x72, 0xEA, 0x1A, 0xE7, 0x1A, 0xE2, 0x9E,
+    0x97, 0xAE, 0x4F, 0x69, 0xE9, 0x4F, 0x6E, 0xA5, 0xAE, 0x94, 0xF6, 0xAE, 0xA3, 0xF7, 0x9F, 0x2A,
+    0xE9, 0x70, 0xF9, 0x0A, 0xEA, 0x71, 0xFA, 0x9F, 0x72, 0xAF, 0xF9, 0x72, 0x9F, 0xE9, 0x73, 0x9F,
+    0xDA, 0x75, 0xFD, 0x76, 0xFC, 0x97, 0x6F, 0xA7, 0x7F, 0x97, 0x6A, 0xF7, 0x7F, 0xC7, 0x6A, 0xFA,
+    0x76, 0xFC, 0x97, 0x59, 0xFC, 0x76, 0xFD, 0x75, 0x9F, 0xCA, 0x75, 0x75, 0x9F, 0x77, 0x0A, 0x91,
+    0xD7, 0x72, 0x9C, 0xA7, 0x71, 0xAC, 0xA7, 0x71, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x1D, 0xA7, 0x0E, 0x6E, 0x79, 0xD9, 0x6A, 0xD9, 0x6E, 0x7A, 0xDA,
+    0x5A, 0xD9, 0x79, 0xE5, 0xE7, 0x1E, 0x4E, 0x97, 0x1E, 0xA2, 0x9E, 0x72, 0xAE, 0x2E, 0x97, 0x29,
+    0xE1, 0xAE, 0x74, 0xEA, 0x0E, 0x97, 0x4F, 0xAE, 0x75, 0xAF, 0xD9, 0x75, 0x9F, 0xD7, 0x7F, 0xC9,
+    0x77, 0xFC, 0x77, 0x0F, 0x97, 0x79, 0xF7, 0x70, 0xF9, 0x76, 0x9F, 0xC7, 0x59, 0xFD, 0x73, 0xFF,
+    0xC7, 0x4F, 0xEA, 0x74, 0x9F, 0xD9, 0x75, 0xAD, 0xA9, 0x77, 0x00, 0x70, 0xAD, 0x3A, 0xC7, 0x2D,
+    0xAD, 0x2C, 0xA7, 0x19, 0xCA, 0x09, 0xC9, 0x09, 0xC9, 0x71, 0xD2, 0xDA, 0xD7, 0x2D, 0x3E, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xEA, 0x73, 0xE9, 0x0F, 0x72, 0xEA, 0x1A, 0xE7, 0x1A, 0xE2,
+    0x9E, 0x97, 0xAE, 0x4F, 0x69, 0xE9, 0x4F, 0x6E, 0xA5, 0xAE, 0x94, 0xF6, 0xAE, 0xA3, 0xF7, 0x9F,
+    0x2A, 0xE9, 0x70, 0xF9, 0x0A, 0xEA, 0x71, 0xFA, 0x9F, 0x72, 0xAF, 0xF9, 0x72, 0x9F, 0xE9, 0x73,
+    0x9F, 0xDA, 0x75, 0xFD, 0x76, 0xFC, 0x97, 0x6F, 0xA7, 0x7F, 0x97, 0x6A, 0xF7, 0x7F, 0xC7, 0x6A,
+    0xFA, 0x76, 0xFC, 0x97, 0x59, 0xFC, 0x76, 0xFD, 0x75, 0x9F, 0xCA, 0x75, 0x74, 0x99, 0x49, 0x73,
+    0x9E, 0xA2, 0xAC, 0x73, 0xD9, 0x9C, 0x2C, 0xA7, 0x29, 0xCA, 0x1C, 0xA0, 0xAC, 0x97, 0x2D, 0x29,
+    0xF7, 0x3A, 0xC3, 0x9A, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4D, 0xA7, 0x0E,
+    0x6E, 0x79, 0xD9, 0x6A, 0xD9, 0x6E, 0x7A, 0xDA, 0x5A, 0xD9, 0x79, 0xE5, 0xE7, 0x1E, 0x4E, 0x97,
+    0x1E, 0xA2, 0x9E, 0x72, 0xAE, 0x2E, 0x97, 0x29, 0xE1, 0xAE, 0x74, 0xEA, 0x0E, 0x97, 0x4F, 0xAE,
+    0x75, 0xAF, 0xD9, 0x75, 0x9F, 0xD7, 0x7F, 0xC9, 0x77, 0xFC, 0x77, 0x0F, 0x97, 0x79, 0xF7, 0x70,
+    0xF9, 0x76, 0x9F, 0xC7, 0x59, 0xFD, 0x73, 0xFF, 0xC7, 0x4F, 0xEA, 0x74, 0x9F, 0xD9, 0x75, 0xAD,
+    0xA9, 0x77, 0x00, 0x0F, 0xFF, 0xC9, 0xFF, 0xF9, 0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xC9, 0xFF, 0xF9,
+    0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0xA0, 0xFF, 0xFF, 0xE0, 0xAF, 0xFF, 0xFE, 0x00, 0x0A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF, 0xFC, 0xA7, 0x74,
+    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF,
+    0xFF, 0xFF, 0xEA, 0x0A, 0xFF, 0xFF, 0xFF, 0xE9, 0x77, 0x76, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xFF, 0xFF, 0xEA, 0x0A, 0xFF, 0xFF,
+    0xFF, 0xE9, 0x77, 0x76, 0x69, 0xC9, 0x5C, 0xA7, 0xD5, 0x9C, 0xA7, 0xD5, 0xAC, 0x96, 0x9C, 0xA5,
+    0xD7, 0xAC, 0x94, 0x9D, 0x7D, 0x5A, 0xC9, 0x69, 0xCA, 0x5D, 0x7A, 0xC9, 0x5D, 0x7D, 0x59, 0xCA,
+    0x7D, 0x5D, 0x96, 0xAC, 0xA5, 0xD7, 0xD5, 0x9C, 0xA7, 0xD5, 0xAC, 0x96, 0x9C, 0xA5, 0xD7, 0xAC,
+    0x94, 0x9D, 0x7D, 0x5A, 0xC9, 0x69, 0xCA, 0x5D, 0x7A, 0xC9, 0x5D, 0x7D, 0x59, 0xCA, 0x7D, 0x5D,
+    0x96, 0xAC, 0xA5, 0xD7, 0xD5, 0x9C, 0xA7, 0xD5, 0xAC, 0x96, 0x9C, 0xA5, 0xD7, 0xAC, 0x94, 0x9D,
+    0x70, 0x2F, 0xFF, 0xFF, 0xA1, 0x9F, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x1A, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xF9, 0x1A, 0xFF, 0xFF, 0xF2, 0xAF, 0x4F, 0xA3, 0xAF, 0x4F,
+    0x93, 0xAE, 0xA4, 0xF4, 0x9F, 0x4F, 0x97, 0x00, 0x39, 0xFA, 0x3F, 0xC4, 0xF9, 0x3A, 0xF4, 0xF9,
+    0x39, 0xF4, 0xF4, 0xAE, 0xA7, 0x50, 0x75, 0xFC, 0x39, 0xF9, 0x3F, 0xC4, 0xF4, 0x9E, 0xA4, 0xF4,
+    0xAE, 0xA3, 0x9F, 0x76, 0xAF, 0x4F, 0xA3, 0xAF, 0x4F, 0x93, 0xAE, 0xA4, 0xF4, 0x9F, 0x4F, 0x97,
+    0x00, 0xAF, 0x1F, 0xC4, 0xFA, 0x09, 0xF9, 0x3A, 0xF1, 0xFC, 0x4F, 0x91, 0xF4, 0xAE, 0xA1, 0xAE,
+    0x94, 0xF2, 0xF4, 0x9F, 0x1A, 0xEA, 0x4F, 0x91, 0xF9, 0x77, 0x39, 0xFA, 0x09, 0xF9, 0x3F, 0xC1,
+    0xFC, 0x4F, 0x91, 0xF9, 0x3A, 0xF1, 0xAF, 0x4F, 0x91, 0xF9, 0x39, 0xF1, 0xAE, 0xA4, 0xF2, 0xF4,
+    0xAE, 0xA1, 0xFA, 0x77, 0x40, 0x75, 0xFC, 0x39, 0xF9, 0x3F, 0xC4, 0xF4, 0x9E, 0xA4, 0xF4, 0xAE,
+    0xA3, 0x9F, 0x76, 0x9F, 0x90, 0xAF, 0x94, 0xFC, 0x1F, 0xA4, 0x9F, 0x19, 0xF5, 0xFA, 0x1F, 0xA4,
+    0x9F, 0x19, 0xF5, 0xF9, 0x1F, 0x95, 0xF1, 0x9F, 0x5A, 0xEA, 0x1A, 0xEA, 0x77, 0x10, 0x70, 0x9A,
+    0x97, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A,
+    0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x39, 0xAF, 0xF1, 0xAF, 0xFF, 0xC0, 0x9F, 0xEA, 0x99,
+    0x99, 0x99, 0x59, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7,
+    0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7,
+    0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x49, 0xC7, 0x6C, 0x76, 0x97, 0x40,
+    0x74, 0xAA, 0x77, 0xAD, 0x77, 0xDA, 0x77, 0xD9, 0x76, 0x9D, 0x77, 0xAD, 0x77, 0xDA, 0x77, 0xD9,
+    0x76, 0x9D, 0x77, 0xAD, 0x77, 0xAC, 0xA7, 0x7D, 0x97, 0x59, 0x9F, 0xF5, 0xFF, 0xFC, 0x4F, 0xF9,
+    0x99, 0x99, 0x97, 0x1D, 0x97, 0x69, 0xD7, 0x7A, 0xD7, 0x7D, 0xA7, 0x7D, 0x97, 0x69, 0xD7, 0x7A,
+    0xD7, 0x7D, 0xA7, 0x7D, 0xA9, 0xAA, 0x69, 0xFF, 0xE6, 0xFF, 0xF6, 0x99, 0x99, 0x9D, 0xA7, 0x7D,
+    0x97, 0x69, 0xD7, 0x7A, 0xD7, 0x7D, 0xA7, 0x7D, 0x97, 0x69, 0xD7, 0x7A, 0xD7, 0x79, 0xCA, 0x77,
+    0x0C, 0x97, 0x70, 0xA7, 0x77, 0x70, 0x7F, 0xFE, 0x6A, 0xFF, 0xDA, 0x6F, 0xFE, 0xA5, 0xAF, 0xFE,
+    0x95, 0xFF, 0xF9, 0x49, 0xFF, 0xF5, 0xFF, 0xFC, 0x49, 0xFF, 0xFC, 0x4F, 0xFF, 0xD3, 0x9F, 0xFF,
+    0xCA, 0x3F, 0xFF, 0xDA, 0x29, 0xFF, 0xFD, 0x92, 0xFF, 0xFE, 0x91, 0x9F, 0xFF, 0xE2, 0xFF, 0xFF,
+    0x19, 0xFF, 0xFF, 0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x10, 0x72, 0xAA, 0x6E,
+    0x94, 0xFC, 0x91, 0x9F, 0xD1, 0xFD, 0x91, 0xEA, 0x93, 0xCA, 0x76, 0x19, 0xDA, 0x1E, 0xA0, 0x9E,
+    0xA0, 0xF9, 0x9F, 0x90, 0x19, 0xDA, 0x1E, 0xA0, 0x9E, 0xA0, 0xF9, 0x9F, 0x90, 0x19, 0xDA, 0x6E,
+    0x59, 0xDA, 0x1E, 0xA5, 0xAE, 0x5E, 0xA0, 0x9E, 0xA5, 0xF4, 0x9E, 0x90, 0xF9, 0x4A, 0xEA, 0x4F,
+    0x99, 0xF9, 0x4F, 0xA3, 0x9F, 0x00, 0x0E, 0x1E, 0x1E, 0x00, 0x77, 0x77, 0x73, 0x9C, 0x97, 0x99,
+    0xA7, 0x09, 0xCA, 0x79, 0xA1, 0xA7, 0xD7, 0x0C, 0x2C, 0x6D, 0x70, 0x9A, 0x0A, 0x0A, 0x5D, 0x71,
+    0xA9, 0x99, 0xAA, 0x4D, 0x97, 0x1C, 0x90, 0x9C, 0x4A, 0xC9, 0x72, 0xFA, 0x3A, 0xCA, 0x73, 0x9D,
+    0xA3, 0x9D, 0x77, 0x39, 0xD7, 0x74, 0xD7, 0x74, 0xD9, 0x77, 0x3D, 0xA7, 0x73, 0xAC, 0xA7, 0x73,
+    0xAD, 0x77, 0x39, 0xD7, 0x73, 0x9D, 0x97, 0x73, 0xD9, 0x0A, 0x09, 0x90, 0xA1, 0x97, 0x1D, 0xA0,
+    0x99, 0x90, 0x99, 0x99, 0x0A, 0x70, 0xE1, 0xA0, 0xA9, 0x9A, 0x0A, 0x99, 0x7E, 0x2C, 0x1C, 0x0C,
+    0x1C, 0x7A, 0xD3, 0xCA, 0xCA, 0x0C, 0xAC, 0xA6, 0xAD, 0x93, 0xAC, 0xA1, 0x9C, 0xA7, 0x99, 0x97,
+    0x73, 0x39, 0xFA, 0x3F, 0xC4, 0xF9, 0x3A, 0xF4, 0xF9, 0x39, 0xF4, 0xF4, 0xAE, 0xA7, 0x50, 0x39,
+    0xFA, 0x09, 0xF9, 0x3F, 0xC1, 0xFC, 0x4F, 0x91, 0xF9, 0x3A, 0xF1, 0xAF, 0x4F, 0x91, 0xF9, 0x39,
+    0xF1, 0xAE, 0xA4, 0xF2, 0xF4, 0xAE, 0xA1, 0xFA, 0x77, 0x40, 0x77, 0x6A, 0x95, 0xC9, 0x4A, 0x93,
+    0xE3, 0x9D, 0xA3, 0xE1, 0x9D, 0xA3, 0xE3, 0x9D, 0x91, 0xAD, 0x4D, 0xA3, 0xE2, 0xDA, 0x39, 0xD4,
+    0xD9, 0x2D, 0x4A, 0xCA, 0x39, 0xD2, 0xAC, 0x94, 0xCA, 0x4A, 0xC9, 0x77, 0x70, 0x7A, 0xA2, 0xE2,
+    0xAD, 0x3D, 0xA2, 0xAD, 0x3D, 0x39, 0xC9, 0x50, 0x74, 0x9A, 0xA3, 0xAA, 0x2E, 0x2E, 0x2A, 0xD2,
+    0xAD, 0x92, 0xD9, 0x2D, 0xA2, 0xAD, 0x2A, 0xD3, 0xD3, 0xD3, 0x9C, 0x92, 0x9C, 0x97, 0x30, 0x77,
+    0x6A, 0xA4, 0xAC, 0x5A, 0x92, 0xE3, 0xE4, 0xE2, 0xAD, 0x39, 0xD9, 0x3E, 0x3D, 0x93, 0xE3, 0x9D,
+    0x92, 0xAD, 0x39, 0xD4, 0xDA, 0x3D, 0x4D, 0x93, 0x9D, 0x3A, 0xC9, 0x39, 0xAA, 0x4A, 0xC7, 0x75,
+    0x5A, 0xC9, 0x7A, 0xDA, 0x6D, 0x9D, 0x93, 0xAD, 0x90, 0xAD, 0x91, 0xE9, 0x2E, 0x90, 0x77, 0x1C,
+    0x95, 0x9D, 0x5A, 0xD9, 0x39, 0xE4, 0xAD, 0x94, 0xE5, 0xAE, 0x6F, 0x59, 0xEA, 0x5A, 0xE9, 0x5E,
+    0x7D, 0x79, 0x93, 0x71, 0x9C, 0x70, 0xDA, 0x69, 0xE7, 0xAD, 0x96, 0x9E, 0x7E, 0x6E, 0xA4, 0xAE,
+    0x93, 0xAE, 0xA4, 0xF5, 0xE6, 0xAC, 0x97, 0x93, 0x77, 0x71, 0xE7, 0x72, 0xF7, 0x1A, 0xE2, 0xAA,
+    0xA9, 0x73, 0xFA, 0x70, 0xF0, 0x9F, 0x74, 0x9F, 0x7A, 0xEA, 0xAE, 0xA7, 0x6F, 0xA6, 0xFF, 0xA7,
+    0x7A, 0xF9, 0x79, 0xF9, 0x77, 0x1F, 0xC6, 0xAF, 0x97, 0x72, 0xAF, 0x94, 0xFC, 0x97, 0x74, 0xFC,
+    0x29, 0xFC, 0x77, 0x6F, 0xC9, 0x0A, 0xFC, 0x77, 0x79, 0xFF, 0xE7, 0x74, 0x9E, 0x0F, 0xFC, 0xA7,
+    0x0D, 0xA7, 0x1F, 0x0A, 0xFE, 0xA7, 0x0A, 0xE7, 0x09, 0xEA, 0x1F, 0xDA, 0x71, 0xEA, 0x70, 0xFA,
+    0x09, 0xFD, 0x71, 0xAE, 0xA7, 0x0F, 0x9A, 0xFE, 0xA7, 0x0F, 0x97, 0x4F, 0xFD, 0x77, 0x70, 0x9F,
+    0xFF, 0x77, 0x6A, 0xFC, 0xA0, 0xFD, 0x97, 0x74, 0xFD, 0xA1, 0x9F, 0xD7, 0x72, 0x9F, 0xD9, 0x3F,
+    0xD9, 0x77, 0x09, 0xFD, 0x59, 0xFD, 0x77, 0xAF, 0xD7, 0xFD, 0xA7, 0x5F, 0xDA, 0x79, 0xAF, 0xD7,
+    0x39, 0xFD, 0xA7, 0xAF, 0xFC, 0x71, 0xAF, 0xD9, 0x70, 0xFF, 0xD9, 0x77, 0x70, 0xAE, 0x97, 0x77,
+    0x7F, 0x97, 0x77, 0x79, 0x99, 0x97, 0x70, 0x72, 0x9A, 0x97, 0x2D, 0x97, 0x1A, 0xD7, 0x2E, 0x72,
+    0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x19, 0xE7, 0x1A, 0xDA, 0x71,
+    0xE9, 0x70, 0x9E, 0x71, 0xAE, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1E, 0xA7, 0x09, 0xE9,
+    0x70, 0x9A, 0xD7, 0x77, 0x74, 0xF7, 0x0A, 0xEA, 0x70, 0xFA, 0x7A, 0xF9, 0x7F, 0xC9, 0x6A, 0xFC,
+    0x70, 0x77, 0x77, 0xD7, 0x70, 0xAD, 0x77, 0x0E, 0x97, 0x4A, 0xFE, 0xA7, 0x09, 0xFF, 0xE7, 0xEA,
+    0xE9, 0xFC, 0x6D, 0x1E, 0x1A, 0xE7, 0x2D, 0xA2, 0xE9, 0x70, 0x9D, 0x92, 0xE9, 0x70, 0xAD, 0x3E,
+    0x97, 0x0E, 0x29, 0xE7, 0x09, 0xE2, 0xAD, 0xA7, 0x0A, 0xDA, 0x2E, 0x71, 0xE9, 0x1E, 0xA7, 0x1E,
+    0x1A, 0xE7, 0x19, 0xE0, 0xF7, 0x2A, 0xFE, 0x97, 0x2F, 0xE7, 0x39, 0xFD, 0x74, 0xAF, 0xA7, 0x5F,
+    0x97, 0x6F, 0x76, 0x9E, 0xA7, 0x6A, 0xE9, 0x76, 0xF7, 0x7E, 0xA7, 0x77, 0x77, 0x75, 0x9E, 0xA7,
+    0x6F, 0xA7, 0x6F, 0x97, 0x5A, 0xF9, 0x75, 0xFC, 0x75, 0x9F, 0xC7, 0x5A, 0xFC, 0x75, 0x99, 0x99,
+    0x99, 0x74, 0x09, 0xFF, 0xF9, 0x0A, 0xFF, 0xF1, 0xFF, 0xFC, 0x77, 0x0C, 0xA6, 0x9A, 0x90, 0xD6,
+    0xD1, 0xDA, 0x39, 0xD9, 0x1A, 0xFF, 0xA3, 0xAF, 0xD9, 0x59, 0x9A, 0x99, 0x40, 0x72, 0x9A, 0x77,
+    0x1A, 0xA7, 0x59, 0xC9, 0x0C, 0x90, 0xAC, 0x72, 0x9D, 0xAC, 0xAC, 0xA7, 0x59, 0xDA, 0x76, 0x9F,
+    0xC9, 0x72, 0x9D, 0x0C, 0x90, 0xD7, 0x39, 0x1C, 0x97, 0x70, 0x9C, 0x39, 0x70, 0x9A, 0x69, 0xC7,
+    0x0C, 0xA1, 0x90, 0xA9, 0x09, 0xC1, 0xAA, 0x0A, 0xC9, 0x0C, 0x1D, 0x0D, 0xAA, 0xAA, 0xC9, 0x2A,
+    0xCA, 0xCA, 0xC9, 0x29, 0xAD, 0x95, 0x9D, 0xA4, 0xAF, 0x93, 0xAD, 0xAD, 0x90, 0xAC, 0xA9, 0xC0,
+    0xDA, 0x09, 0xCA, 0x0C, 0x90, 0xD0, 0xA9, 0x0A, 0xA1, 0x95, 0xC7, 0xCA, 0x79, 0xA7, 0x60, 0x77,
+    0x39, 0xCA, 0x77, 0x4C, 0xA7, 0x74, 0xD7, 0x74, 0xD7, 0x74, 0xD9, 0x77, 0x3A, 0xC9, 0x77, 0x3A,
+    0xCA, 0x77, 0x39, 0xCA, 0x77, 0x39, 0xD7, 0x74, 0xD7, 0x74, 0xD9, 0x77, 0x3D, 0x97, 0x73, 0xDA,
+    0x77, 0x3A, 0xCA, 0x77, 0x3A, 0xD7, 0x73, 0x9D, 0x77, 0x39, 0xD9, 0x77, 0x29, 0xD9, 0x77, 0x3D,
+    0xA7, 0x73, 0xDA, 0x77, 0x3E, 0x77, 0x3A, 0xD7, 0x73, 0xAD, 0x97, 0x73, 0x99, 0x77, 0x40, 0x77,
+    0x77, 0x71, 0x9A, 0xFA, 0x70, 0x9A, 0xFA, 0x97, 0x09, 0xFF, 0xCA, 0x49, 0xFF, 0xD6, 0xAF, 0xAA,
+    0xFC, 0xA2, 0x9F, 0xAA, 0xFD, 0x5E, 0x5F, 0x2E, 0x94, 0xAE, 0x94, 0xA9, 0x7E, 0x91, 0x9A, 0x7E,
+    0xA7, 0x6E, 0x97, 0x3A, 0xDA, 0x76, 0xE9, 0x73, 0xAD, 0xA7, 0x6E, 0x74, 0xE9, 0x75, 0x9E, 0x74,
+    0xE7, 0x6E, 0xA7, 0x3A, 0xDA, 0x75, 0x9E, 0x73, 0x9E, 0x76, 0xE9, 0x73, 0xEA, 0x75, 0xEA, 0x73,
+    0xEA, 0x75, 0xF7, 0x29, 0xF7, 0x4A, 0xF7, 0x2A, 0xF7, 0x39, 0xFC, 0x70, 0x9A, 0xFA, 0x72, 0x9F,
+    0xD7, 0x09, 0xFC, 0xA7, 0x3A, 0xF9, 0x71, 0x9F, 0x75, 0xF9, 0x72, 0xAE, 0x97, 0x5F, 0x73, 0xF7,
+    0x59, 0xEA, 0x72, 0x9F, 0x75, 0xAE, 0x97, 0x2A, 0xEA, 0x75, 0xF7, 0x3F, 0x76, 0xEA, 0x73, 0x99,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9D, 0x97, 0x77, 0x6E, 0xA7, 0x39, 0xE7, 0x5A, 0xE9, 0x73,
+    0xEA, 0x75, 0xF9, 0x72, 0x9E, 0xA7, 0x49, 0xF7, 0x3F, 0x97, 0x77, 0x49, 0xF9, 0x74, 0x77, 0x77,
+    0x09, 0x99, 0x99, 0x77, 0x1A, 0xFE, 0xA7, 0x59, 0xFF, 0xE7, 0x39, 0xEA, 0x91, 0x9F, 0xA4, 0xD9,
+    0x3C, 0xA6, 0xAE, 0x39, 0xD7, 0x6E, 0x3E, 0x76, 0xE9, 0x2D, 0x97, 0x6E, 0x2A, 0xD7, 0x69, 0xE2,
+    0xE7, 0x6E, 0xA2, 0xDA, 0x75, 0x9E, 0x2A, 0xD9, 0x75, 0xEA, 0x2E, 0x75, 0xF3, 0xE7, 0x4A, 0xE3,
+    0xAD, 0xA7, 0x29, 0xF4, 0xE9, 0x71, 0xAF, 0x5E, 0x70, 0xAF, 0xC5, 0xAE, 0x7A, 0xFA, 0x6E, 0xA7,
+    0xF9, 0x7E, 0x97, 0xF7, 0xAE, 0x79, 0xEA, 0x7F, 0x7A, 0xE9, 0x7E, 0xA7, 0xF7, 0xAE, 0x97, 0xF7,
+    0x9A, 0xD7, 0x09, 0x77, 0x77, 0x77, 0x72, 0x9E, 0xA7, 0x0A, 0xD9, 0x6F, 0xA7, 0x0E, 0x95, 0x9F,
+    0x97, 0xAE, 0x6F, 0xC9, 0x7F, 0x59, 0xFC, 0x7A, 0xF5, 0xAF, 0xC7, 0x77, 0x77, 0x77, 0x19, 0x99,
+    0x97, 0x76, 0x9F, 0xFA, 0x77, 0x2A, 0xFF, 0xDA, 0x77, 0x0F, 0x92, 0xAF, 0x97, 0x59, 0x09, 0xC9,
+    0x6E, 0xA7, 0x39, 0xD7, 0x29, 0xE7, 0x3D, 0xA7, 0x29, 0xE7, 0x3D, 0x97, 0x29, 0xDA, 0x72, 0x9D,
+    0x73, 0xE9, 0x72, 0xE7, 0x3E, 0x73, 0xDA, 0x72, 0xAD, 0xA7, 0x29, 0xD9, 0x71, 0x9E, 0x73, 0xE7,
+    0x2E, 0x97, 0x3E, 0x71, 0xEA, 0x73, 0xAD, 0xA7, 0x9F, 0x74, 0xE9, 0x6F, 0xC7, 0x5E, 0x49, 0xFD,
+    0x75, 0xAE, 0x4F, 0xCA, 0x76, 0xEA, 0x39, 0xF7, 0x70, 0xE9, 0x3A, 0xE9, 0x77, 0xAE, 0x4F, 0x77,
+    0x0E, 0xA4, 0xF7, 0x70, 0xE9, 0x39, 0xEA, 0x77, 0xAE, 0x4A, 0xE9, 0x77, 0xF4, 0x99, 0x99, 0x77,
+    0x09, 0x9A, 0xA7, 0x77, 0x77, 0x77, 0x70, 0xE7, 0x7A, 0xE9, 0x4A, 0xE7, 0x7F, 0x94, 0xF7, 0x6A,
+    0xF4, 0xAE, 0xA7, 0x6F, 0xC4, 0xFA, 0x75, 0xAF, 0xC7, 0x77, 0xFD, 0x77, 0x60, 0x77, 0x77, 0x77,
+    0x6A, 0xA7, 0x77, 0x09, 0xD7, 0x77, 0x1D, 0x97, 0x77, 0x09, 0xD7, 0x77, 0x1D, 0x97, 0x77, 0x0A,
+    0xD7, 0x77, 0x1D, 0x97, 0x77, 0x0A, 0xD7, 0x77, 0x1D, 0x77, 0x71, 0xDA, 0x77, 0x1A, 0xDA, 0x29,
+    0xD7, 0x72, 0xE9, 0x2D, 0xA7, 0x71, 0xAE, 0x91, 0x9D, 0x77, 0x2F, 0x2D, 0xA7, 0x71, 0x9F, 0x1A,
+    0xD7, 0x77, 0x1D, 0x97, 0x77, 0x0A, 0xD7, 0x77, 0x09, 0xD9, 0x77, 0x70, 0xE7, 0x77, 0x09, 0xD9,
+    0x77, 0x70, 0xDA, 0x77, 0x70, 0xAD, 0x77, 0x71, 0xDA, 0x77, 0x70, 0xAD, 0x77, 0x70, 0x9D, 0xA7,
+    0x77, 0x0E, 0x77, 0x70, 0x9D, 0x90, 0x9E, 0x77, 0x3E, 0x1F, 0x77, 0x2A, 0xD9, 0x09, 0xEA, 0x77,
+    0x2E, 0x1F, 0xA7, 0x71, 0xAD, 0x91, 0xF9, 0x77, 0x1E, 0x77, 0x70, 0xE7, 0x77, 0x09, 0xDA, 0x77,
+    0x70, 0xE7, 0x77, 0x0A, 0xDA, 0x77, 0x70, 0xE7, 0x77, 0x0A, 0xD9, 0x77, 0x70, 0xE7, 0x77, 0x0E,
+    0x97, 0x77, 0x9E, 0x77, 0x70, 0xE9, 0x77, 0x79, 0xD7, 0x77, 0x1C, 0x97, 0x77, 0x77, 0x76, 0x49,
+    0x99, 0x5C, 0x90, 0x9C, 0x3C, 0x92, 0xC2, 0x9C, 0x09, 0x1C, 0x2C, 0xA0, 0xC9, 0x0C, 0x2C, 0x90,
+    0xC0, 0xAC, 0x19, 0xC9, 0x2C, 0xA1, 0x9C, 0x91, 0xAC, 0x29, 0xDA, 0xDA, 0x3F, 0xC4, 0x9D, 0xA3,
+    0x75, 0xC9, 0x4D, 0x4C, 0xAC, 0x3C, 0xA9, 0xC2, 0xCA, 0x0C, 0xA1, 0xD0, 0x9C, 0xA9, 0x9F, 0xDA,
+    0x3D, 0x5D, 0x49, 0xCA, 0x10, 0x75, 0xFC, 0xA2, 0xAA, 0x7C, 0x97, 0xC7, 0x9F, 0x94, 0x91, 0x9C,
+    0x97, 0xCA, 0x69, 0xC9, 0x19, 0xA9, 0x9A, 0xD2, 0xFD, 0x92, 0xAE, 0xA3, 0x39, 0xF2, 0xAC, 0x94,
+    0xAA, 0x6C, 0x6A, 0xCA, 0xE2, 0xD9, 0x1C, 0xA1, 0xCA, 0x2A, 0xA0, 0x9C, 0x3C, 0xA0, 0x9C, 0x91,
+    0xAC, 0x2F, 0xC9, 0x3A, 0xCA, 0x92, 0x79, 0xFD, 0xA4, 0x9C, 0x5D, 0x49, 0xC9, 0x4D, 0x49, 0xCA,
+    0x4D, 0x49, 0xCA, 0x4D, 0x93, 0xAD, 0x4D, 0x97, 0x30, 0x49, 0xAA, 0x94, 0xCA, 0x1A, 0x92, 0xAA,
+    0x2A, 0xA2, 0xC9, 0x2C, 0x92, 0xAC, 0x99, 0xCA, 0x4E, 0xA3, 0xAC, 0x90, 0x9C, 0x91, 0x9C, 0x3D,
+    0x1A, 0xC3, 0xCA, 0x1A, 0xCA, 0x9A, 0xD3, 0xAE, 0xA2, 0x3A, 0xD9, 0x39, 0xC9, 0x09, 0xC9, 0x2C,
+    0x92, 0xCA, 0x19, 0xC3, 0xCA, 0x1A, 0xA3, 0xCA, 0x1A, 0xC2, 0xAC, 0x92, 0xFD, 0x49, 0x99, 0xAA,
+    0x69, 0xC9, 0x19, 0xFC, 0xA2, 0xAF, 0x93, 0x72, 0x99, 0x97, 0x09, 0xCA, 0x9A, 0xFC, 0xA6, 0xFF,
+    0xEA, 0x5F, 0xC9, 0x19, 0xE4, 0x9E, 0xA4, 0xAD, 0x4E, 0xA5, 0xAD, 0x4E, 0x6E, 0x39, 0xE6, 0xE3,
+    0xE9, 0x59, 0xE3, 0xE9, 0x5A, 0xDA, 0x29, 0xE6, 0xE9, 0x2F, 0x59, 0xE3, 0xEA, 0x5A, 0xE2, 0xAE,
+    0x95, 0xF2, 0xF6, 0xEA, 0x2F, 0x59, 0xE9, 0x1A, 0xEA, 0x5F, 0x91, 0x59, 0xAD, 0xA7, 0xCA, 0x2A,
+    0xA5, 0xD3, 0x9C, 0x4A, 0xC4, 0x9C, 0x4C, 0xA1, 0xC1, 0x9C, 0x92, 0xAC, 0x90, 0xAC, 0x1A, 0xC3,
+    0xD1, 0xD1, 0xD3, 0xD1, 0xCA, 0x09, 0xCA, 0x29, 0xD4, 0xD9, 0x2A, 0xD3, 0x9D, 0x3A, 0xD2, 0x9D,
+    0xA3, 0xAE, 0xAF, 0x49, 0xFE, 0x95, 0xFD, 0xA7, 0xAD, 0xA9, 0x50, 0x74, 0xAC, 0xA3, 0xCA, 0xC9,
+    0x49, 0xC5, 0xCA, 0x5C, 0x94, 0x9C, 0x5A, 0xC5, 0xCA, 0x49, 0xC9, 0x2A, 0xFC, 0xA0, 0xFD, 0x90,
+    0x76, 0xFC, 0x49, 0xA2, 0xD7, 0x0A, 0xC7, 0x0C, 0xA7, 0xAC, 0x96, 0xAC, 0xA6, 0xDA, 0x5A, 0xDA,
+    0x5E, 0x95, 0xAF, 0xD3, 0xFE, 0x20, 0x2A, 0xEA, 0x49, 0x2A, 0xA7, 0x9C, 0x69, 0xC9, 0x3F, 0x96,
+    0x9C, 0x97, 0xD7, 0xCA, 0x29, 0x19, 0xAC, 0x91, 0x9F, 0xCA, 0x2A, 0xF9, 0x30, 0x6A, 0x6D, 0x5A,
+    0xCA, 0x4A, 0x0C, 0x93, 0xA0, 0x9C, 0x3A, 0x1A, 0xC2, 0xAF, 0xC9, 0x1A, 0xAF, 0xC4, 0x9C, 0x95,
+    0xAC, 0x95, 0xD2, 0x73, 0xFC, 0x91, 0x9A, 0x6C, 0x96, 0xC6, 0x9F, 0x96, 0x9C, 0x95, 0x9C, 0x91,
+    0x91, 0x9D, 0x19, 0xFC, 0x91, 0xAF, 0x97, 0x30, 0x75, 0x9F, 0x3A, 0xC9, 0x59, 0xC7, 0xC9, 0x69,
+    0xCA, 0xE9, 0x2A, 0xCA, 0x1A, 0xC2, 0xD2, 0x9C, 0x2C, 0x92, 0x9C, 0x2C, 0xA1, 0x9C, 0xA2, 0xAF,
+    0xC4, 0xAD, 0x93, 0x79, 0xFD, 0xA4, 0x9C, 0x94, 0xAC, 0x49, 0xC9, 0x4D, 0x49, 0xCA, 0x4D, 0x49,
+    0xD4, 0xD9, 0x3A, 0xD4, 0xD9, 0x30, 0x4A, 0xCA, 0xA9, 0x4C, 0xA2, 0xC3, 0x9C, 0x29, 0xC3, 0x9C,
+    0x19, 0xC9, 0x4A, 0xE9, 0x4A, 0xC9, 0x9C, 0xA3, 0xD2, 0x9C, 0x29, 0xC9, 0x2A, 0xC2, 0x9C, 0xA1,
+    0x9C, 0xA3, 0xFC, 0xA5, 0x99, 0x94, 0x3A, 0xDA, 0x4C, 0x91, 0xD2, 0xCA, 0x2A, 0xC2, 0xC3, 0xAC,
+    0x19, 0xC3, 0xD2, 0xCA, 0x99, 0xDA, 0x29, 0xFC, 0x96, 0x9C, 0x69, 0xCA, 0x2F, 0xD2, 0x9F, 0xA3,
+    0x77, 0x75, 0xDA, 0x74, 0xAD, 0x74, 0x9D, 0x97, 0x39, 0xDA, 0x74, 0xE7, 0x4A, 0xD7, 0x49, 0xD9,
+    0x74, 0xDA, 0x74, 0xAD, 0x74, 0x9D, 0x97, 0x4E, 0x74, 0x9D, 0x97, 0x4E, 0x74, 0x9D, 0x97, 0x4E,
+    0x75, 0xDA, 0x74, 0xAD, 0x75, 0xE7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5D, 0xA7,
+    0x5D, 0xA7, 0x49, 0xD9, 0x74, 0x9D, 0x97, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x97,
+    0x4A, 0xD9, 0x74, 0x9D, 0x97, 0x49, 0xD9, 0x74, 0x9D, 0xA7, 0x49, 0xE7, 0x5E, 0x75, 0xE7, 0x5E,
+    0x97, 0x4A, 0xDA, 0x72, 0x77, 0x0D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5D, 0xA7, 0x49,
+    0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x49, 0xD9, 0x74, 0xE7, 0x5D, 0xA7, 0x4A, 0xD7, 0x5D, 0xA7, 0x4A,
+    0xD7, 0x5D, 0xA7, 0x4E, 0x74, 0xAD, 0x97, 0x4D, 0xA7, 0x4E, 0x74, 0xAD, 0x74, 0x9D, 0x97, 0x4D,
+    0xA7, 0x4E, 0x74, 0xE7, 0x4A, 0xD7, 0x4A, 0xD7, 0x4A, 0xD7, 0x4A, 0xD9, 0x73, 0xAD, 0x97, 0x3A,
+    0xD9, 0x73, 0xAD, 0x97, 0x3A, 0xD7, 0x4E, 0x74, 0xE7, 0x4E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0xAD,
+    0xA7, 0x3E, 0x90, 0x77, 0x29, 0xAA, 0x2A, 0xA9, 0x77, 0x2D, 0x91, 0x9D, 0x97, 0x71, 0xAD, 0x2D,
+    0xA7, 0x72, 0xD9, 0x19, 0xD7, 0x72, 0xAD, 0x2D, 0xA7, 0x72, 0xD9, 0x19, 0xD7, 0x72, 0xFF, 0xC9,
+    0x77, 0x9F, 0xFD, 0xA7, 0x59, 0xFF, 0xF7, 0x5A, 0xFC, 0xA9, 0x0A, 0xDA, 0xA7, 0x4F, 0xDA, 0x2D,
+    0x97, 0x5F, 0xE2, 0xAD, 0x75, 0xFE, 0xA2, 0xD9, 0x74, 0xAE, 0xAA, 0xD2, 0xAD, 0x74, 0x9F, 0x0D,
+    0x92, 0xD9, 0x74, 0xF0, 0xAD, 0x2E, 0x74, 0x9E, 0xA0, 0xD9, 0x19, 0xD7, 0x5F, 0x0A, 0xD2, 0xDA,
+    0x75, 0xEA, 0x0D, 0x91, 0x9D, 0x75, 0xAE, 0x9E, 0x2D, 0xA7, 0x5F, 0xAD, 0x91, 0x9D, 0x76, 0xFD,
+    0xA2, 0xDA, 0x75, 0x9F, 0xD2, 0xAD, 0x76, 0x9F, 0xD2, 0xD9, 0x39, 0x71, 0x9F, 0xEA, 0xE9, 0x9A,
+    0xE7, 0x19, 0xFF, 0xFF, 0xA7, 0x2F, 0xFF, 0xF9, 0x72, 0xAF, 0xFF, 0xE7, 0x3A, 0xFF, 0xFE, 0x73,
+    0xFF, 0xFE, 0xA7, 0x2A, 0xD0, 0xAF, 0xFC, 0xA9, 0x73, 0xD9, 0x19, 0xD7, 0x72, 0xAD, 0x2D, 0xA7,
+    0x72, 0xD9, 0x19, 0xD7, 0x72, 0xAD, 0x2D, 0xA7, 0x71, 0x9D, 0x91, 0x9D, 0x77, 0x2A, 0xCA, 0x2A,
+    0xCA, 0x77, 0x20, 0x77, 0x77, 0x70, 0x9A, 0xFC, 0xA9, 0x74, 0x9F, 0xFD, 0xA7, 0x29, 0xFF, 0xF7,
+    0x2A, 0xFC, 0xA9, 0x99, 0x99, 0xAA, 0x71, 0xFC, 0xA7, 0x71, 0xFC, 0x97, 0x71, 0xFC, 0x77, 0x2A,
+    0xF7, 0x73, 0xF7, 0x73, 0xF9, 0x77, 0x29, 0xEA, 0x77, 0x3F, 0x69, 0x91, 0x99, 0x7E, 0xA6, 0xDA,
+    0xE9, 0x5A, 0xE9, 0x59, 0xFD, 0x6F, 0x95, 0xEA, 0x71, 0xF9, 0x5D, 0xA7, 0x19, 0xFC, 0x49, 0xD7,
+    0x29, 0xFD, 0x3E, 0x29, 0x69, 0xFF, 0xA9, 0xEA, 0xE6, 0x9F, 0xFF, 0xFA, 0x7F, 0xFF, 0xF9, 0x7F,
+    0xFF, 0xF7, 0x1F, 0xFF, 0xE7, 0x19, 0xFF, 0xFC, 0xA7, 0x3A, 0xFF, 0xCA, 0xA7, 0x77, 0x70, 0x77,
+    0x77, 0x49, 0x99, 0x97, 0x79, 0xFE, 0xA7, 0x39, 0xFF, 0xE7, 0x1A, 0xFA, 0x92, 0x9D, 0xA7, 0x0E,
+    0xA7, 0xA7, 0x1D, 0xA7, 0x72, 0x9D, 0x77, 0x39, 0xD7, 0x73, 0x9D, 0x77, 0x2F, 0xFF, 0xA7, 0x09,
+    0xFF, 0xF9, 0x70, 0xAF, 0xFF, 0x74, 0xD9, 0x77, 0x3D, 0x97, 0x70, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA,
+    0xA7, 0x09, 0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0x74, 0x9E, 0x77, 0x2A, 0xDA, 0x77, 0x19, 0xE9, 0x77,
+    0x0A, 0xEA, 0x77, 0xAF, 0xA7, 0x6F, 0xCA, 0x97, 0x7F, 0xFF, 0xAA, 0x96, 0x9F, 0xFF, 0xF5, 0xAF,
+    0xFF, 0xFA, 0x40, 0x77, 0x79, 0xE7, 0x2A, 0xEA, 0x71, 0xF7, 0x2F, 0xC7, 0x1E, 0xA7, 0x2F, 0xC7,
+    0x0A, 0xE7, 0x2A, 0xFC, 0x97, 0xF7, 0x2F, 0xDA, 0x7E, 0xA7, 0x19, 0xFE, 0x6A, 0xE7, 0x2A, 0xFE,
+    0x6F, 0x72, 0xFF, 0x59, 0xEA, 0x71, 0x9E, 0xAA, 0xE9, 0x4A, 0xE9, 0x71, 0xAE, 0x99, 0xEA, 0x4F,
+    0x72, 0xF1, 0xF3, 0x9E, 0xA7, 0x19, 0xF1, 0xF3, 0xAE, 0x96, 0xFF, 0xFF, 0xFF, 0xDA, 0x1A, 0xFF,
+    0xFF, 0xFF, 0xD2, 0xAA, 0xAF, 0xCA, 0xAA, 0xAF, 0xAA, 0xFA, 0xAA, 0xA9, 0x5F, 0xC3, 0xF1, 0xF7,
+    0x2F, 0xA3, 0xF0, 0x9E, 0xA7, 0x19, 0xF9, 0x3F, 0x0F, 0x97, 0x1F, 0xC4, 0xAE, 0xAF, 0x72, 0xFC,
+    0x49, 0xFF, 0x71, 0x9F, 0xA5, 0xFE, 0x97, 0x1F, 0xC9, 0x5F, 0xE7, 0x2F, 0xC6, 0xAF, 0xD7, 0x1A,
+    0xFC, 0x6A, 0xFC, 0x97, 0x00, 0x7F, 0xFC, 0xA9, 0x75, 0xFF, 0xF7, 0x39, 0xEA, 0xAA, 0xFE, 0x72,
+    0xAD, 0x95, 0xAE, 0x97, 0x1E, 0x7A, 0xDA, 0x70, 0x9E, 0x79, 0xDA, 0x4A, 0xFF, 0xFF, 0xFA, 0x19,
+    0xFF, 0xFF, 0xFC, 0x69, 0xE7, 0xAE, 0x70, 0xAE, 0x59, 0xF9, 0x70, 0xFF, 0xFD, 0xA7, 0x1F, 0xFF,
+    0xCA, 0x71, 0xAF, 0xFE, 0xA9, 0x72, 0xFC, 0xAA, 0xAA, 0x99, 0x75, 0xEA, 0x77, 0x3A, 0xE9, 0x77,
+    0x3F, 0x97, 0x73, 0xF7, 0x73, 0xAF, 0x77, 0x3F, 0xA7, 0x73, 0xF9, 0x77, 0x2A, 0xF7, 0x73, 0xFC,
+    0x77, 0x3F, 0xC7, 0x72, 0xAF, 0xA7, 0x72, 0x6F, 0xDA, 0x77, 0x70, 0x9F, 0xF9, 0x77, 0x6A, 0xCA,
+    0xAA, 0xAF, 0x77, 0x6D, 0x49, 0xD9, 0x77, 0x5C, 0xA5, 0xD9, 0x77, 0x49, 0xC9, 0x5D, 0x97, 0x74,
+    0xAC, 0x6D, 0x97, 0x74, 0xD5, 0xAD, 0x77, 0x49, 0xD4, 0xAE, 0x71, 0xAE, 0xA9, 0x4A, 0xCA, 0x99,
+    0x9A, 0xF9, 0x79, 0xFD, 0xA4, 0xFF, 0xDA, 0x70, 0xDA, 0x90, 0x99, 0x5F, 0xFC, 0x97, 0x0A, 0xC7,
+    0x29, 0xFF, 0xA7, 0x1D, 0x72, 0xAF, 0xFC, 0xA7, 0x0D, 0x97, 0x1E, 0xA9, 0x19, 0xE7, 0x0E, 0xA9,
+    0x7E, 0x4A, 0xD7, 0x09, 0xFC, 0x94, 0x9E, 0x4A, 0xD7, 0x2A, 0xF9, 0x3A, 0xE4, 0xE9, 0x73, 0x9E,
+    0x3E, 0xA4, 0xE9, 0x74, 0xE3, 0xE9, 0x39, 0xE9, 0x6A, 0xA9, 0x19, 0xE2, 0x9E, 0x93, 0xAE, 0x95,
+    0x9F, 0xFA, 0x2F, 0x4F, 0x94, 0x9F, 0xFC, 0x3F, 0x4F, 0x94, 0xAF, 0xF9, 0x29, 0xEA, 0x39, 0xF9,
+    0x59, 0xFC, 0xA9, 0x30, 0x4D, 0x75, 0xD5, 0xD7, 0x4A, 0xD5, 0xD7, 0x4D, 0x95, 0xD7, 0x4D, 0x6D,
+    0x73, 0xAD, 0x59, 0xD7, 0x3D, 0xA5, 0x9D, 0x49, 0x94, 0xD6, 0x9D, 0x39, 0xD3, 0xAD, 0x4F, 0xFF,
+    0xFF, 0xC1, 0x9F, 0xFF, 0xFF, 0xA1, 0xAF, 0xFF, 0xFF, 0x59, 0xD1, 0x9F, 0x91, 0xDA, 0x7A, 0xD1,
+    0xFC, 0xA1, 0xD9, 0x7A, 0xD0, 0x9D, 0xAD, 0xA0, 0xAD, 0x70, 0xAD, 0x0E, 0x0E, 0x0D, 0xA7, 0x0A,
+    0xD9, 0xDA, 0x0E, 0x0D, 0x97, 0x0A, 0xFC, 0x90, 0xAD, 0xAD, 0x71, 0xAF, 0xC1, 0xAF, 0xA7, 0x1A,
+    0xF9, 0x1A, 0xF9, 0x71, 0xAF, 0x2A, 0xF7, 0x2F, 0xA2, 0x9F, 0x72, 0xF3, 0x9E, 0x97, 0x2F, 0x39,
+    0xE7, 0x3E, 0x93, 0x9E, 0x70, 0x77, 0x77, 0xAD, 0xAA, 0x99, 0x97, 0x72, 0xFF, 0xDA, 0x77, 0xFF,
+    0xF9, 0x5E, 0x3A, 0xF9, 0x19, 0xAF, 0x5D, 0xA3, 0xEA, 0x6A, 0xD9, 0x39, 0xD9, 0x3E, 0x70, 0xDA,
+    0x3A, 0xD3, 0x9D, 0xA7, 0x0D, 0xA3, 0xDA, 0x3A, 0xD9, 0x70, 0xD9, 0x29, 0xD9, 0x3E, 0x3A, 0x93,
+    0xD9, 0x2A, 0xD4, 0xDA, 0x29, 0xD2, 0x9D, 0x3E, 0x39, 0xD9, 0x2A, 0xD2, 0xAD, 0x3D, 0xA3, 0xAD,
+    0x3D, 0xA2, 0xDA, 0x29, 0xD9, 0x3E, 0x3D, 0x92, 0xD9, 0x2A, 0xD4, 0xDA, 0x29, 0xD3, 0x9A, 0x3E,
+    0x39, 0xD9, 0x29, 0xD7, 0x09, 0xDA, 0x3A, 0xD3, 0xAD, 0x70, 0xAD, 0x93, 0xDA, 0x3A, 0xD7, 0x0E,
+    0x39, 0xD9, 0x39, 0xDA, 0x6A, 0xE3, 0xAD, 0x5F, 0xA9, 0x19, 0xFA, 0x3E, 0x59, 0xFF, 0xF7, 0x7A,
+    0xFF, 0xD7, 0x72, 0x99, 0x9A, 0xAD, 0xA4, 0x77, 0x77, 0x5D, 0x77, 0x29, 0xD7, 0x69, 0x99, 0x9A,
+    0xCA, 0x99, 0x97, 0x3F, 0xFD, 0x72, 0x9F, 0xFD, 0x76, 0xAC, 0xA7, 0x4A, 0xDA, 0x1D, 0x97, 0x2A,
+    0xFD, 0x9D, 0x72, 0xEA, 0xAA, 0xFA, 0x71, 0xAC, 0xA3, 0xAE, 0x97, 0x0A, 0xCA, 0x49, 0xE7, 0x1D,
+    0x59, 0xDA, 0x70, 0xAC, 0xA5, 0xAD, 0x97, 0x0D, 0x95, 0xE7, 0x1E, 0x39, 0xEA, 0x71, 0xFF, 0xEA,
+    0x71, 0xAF, 0xFD, 0x97, 0x2F, 0xEA, 0xD7, 0x4A, 0xEA, 0x90, 0xAA, 0x72, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x6A, 0xFF, 0xFD, 0x6F, 0xFF, 0xE5, 0x77, 0x77, 0x29, 0xAA, 0xAA, 0x97, 0x5A,
+    0xFF, 0xC7, 0x19, 0xFF, 0xDA, 0x71, 0xFA, 0x92, 0x99, 0x97, 0x0A, 0xE9, 0x77, 0x0E, 0x97, 0x70,
+    0xAD, 0xA7, 0x71, 0xE2, 0x99, 0x71, 0xFF, 0xF7, 0x0A, 0xFF, 0xF7, 0x4E, 0x77, 0x2D, 0xA7, 0x71,
+    0x9F, 0xE7, 0x1A, 0xFF, 0xE9, 0x79, 0xFE, 0x99, 0x77, 0x0E, 0x77, 0x19, 0xE7, 0x71, 0x9E, 0x77,
+    0x1A, 0xE9, 0x77, 0x0A, 0xF9, 0x77, 0x9F, 0xFD, 0xA7, 0x2F, 0xFD, 0xA7, 0x29, 0xFF, 0xC9, 0x74,
+    0x9A, 0xFD, 0x77, 0x74, 0x1F, 0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0xF1, 0xAF, 0xFF, 0xFE, 0xA1, 0xAA,
+    0xA9, 0x99, 0x1A, 0xE4, 0x99, 0x97, 0x2E, 0xA7, 0x72, 0xE9, 0x77, 0x19, 0xE2, 0x97, 0x6A, 0xE9,
+    0xAD, 0x76, 0xFE, 0xA7, 0x5A, 0xFC, 0xA9, 0x73, 0xAF, 0xD9, 0x75, 0xAF, 0xE7, 0x6D, 0xA9, 0xEA,
+    0x09, 0xA9, 0x72, 0x91, 0xAF, 0xE7, 0x6F, 0xEA, 0x74, 0xAF, 0xD9, 0x74, 0xFE, 0xA7, 0x6F, 0xEA,
+    0x75, 0x9A, 0x90, 0xF9, 0x77, 0x09, 0xF7, 0x71, 0xAF, 0x77, 0x1F, 0xA7, 0x70, 0x9F, 0x97, 0x70,
+    0xAF, 0x77, 0x1F, 0xC7, 0x60, 0x7F, 0xFC, 0xA9, 0x77, 0x0F, 0xFF, 0x76, 0x9E, 0xAA, 0xAF, 0xE7,
+    0x5E, 0x95, 0x9E, 0x97, 0x4E, 0x79, 0xDA, 0x79, 0xFF, 0xFF, 0xFF, 0x95, 0xEA, 0x7A, 0xDA, 0x73,
+    0xE9, 0x7E, 0x97, 0xFF, 0xFF, 0xFF, 0x95, 0xAE, 0x59, 0xF9, 0x73, 0xFF, 0xFD, 0xA7, 0x39, 0xFF,
+    0xFC, 0xA7, 0x4A, 0xFF, 0xEA, 0x97, 0x5F, 0xCA, 0xAA, 0xA9, 0x97, 0x79, 0xEA, 0x77, 0x6A, 0xE9,
+    0x77, 0x6F, 0x97, 0x76, 0xF7, 0x76, 0xAF, 0x77, 0x6F, 0xA7, 0x76, 0xF9, 0x77, 0x5A, 0xF7, 0x76,
+    0xFC, 0x77, 0x6F, 0xC7, 0x75, 0xAF, 0xA7, 0x75, 0x77, 0x0D, 0x77, 0x6D, 0x77, 0x59, 0xCA, 0x77,
+    0x5A, 0xC9, 0x77, 0x5D, 0x77, 0x29, 0x9A, 0xFE, 0xA9, 0x71, 0x9F, 0xFF, 0xD7, 0x0A, 0xFF, 0xCA,
+    0xAA, 0xE7, 0xFD, 0x90, 0xAC, 0x94, 0x96, 0xFC, 0x92, 0xD7, 0x4A, 0xF4, 0xD7, 0x39, 0xF9, 0x39,
+    0xCA, 0x73, 0xAE, 0xA4, 0xAC, 0x97, 0x3F, 0x5D, 0x73, 0xAE, 0xA5, 0xD7, 0x3F, 0x94, 0x9D, 0x73,
+    0xF5, 0xAC, 0xA7, 0x29, 0xEA, 0x5A, 0xDA, 0x99, 0x7A, 0xE9, 0x5F, 0xFD, 0xA2, 0xF9, 0x5F, 0xFE,
+    0x2F, 0x59, 0xCA, 0x19, 0xAF, 0xC2, 0xF5, 0xAC, 0x93, 0xDA, 0x99, 0x2F, 0x94, 0xD3, 0xAD, 0x94,
+    0xFC, 0x4D, 0x3E, 0x94, 0xFD, 0xAA, 0x99, 0xD9, 0xAF, 0xC5, 0xFF, 0xFF, 0xE5, 0xAF, 0xFF, 0xFC,
+    0xA6, 0xFF, 0xFF, 0xCA, 0x7A, 0xFF, 0xFD, 0x97, 0x29, 0xAF, 0xDA, 0xA9, 0x77, 0x1A, 0xC9, 0x77,
+    0x5D, 0x77, 0x6D, 0x77, 0x6A, 0xA7, 0x40, 0x73, 0x99, 0x99, 0xA9, 0x97, 0x76, 0xFF, 0xEA, 0x77,
+    0x3F, 0xFF, 0xA7, 0x72, 0xFF, 0xFC, 0x97, 0x71, 0x95, 0x9F, 0xCA, 0x77, 0x72, 0x9F, 0x77, 0x73,
+    0xF7, 0x77, 0x3E, 0xA7, 0x77, 0x3E, 0x97, 0x77, 0x2A, 0xE7, 0x6F, 0xFF, 0xFF, 0xFC, 0x5A, 0xFF,
+    0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0xFF, 0xC7, 0x77, 0x77, 0x77, 0x74, 0xAF, 0xFF, 0xFF, 0xFC, 0xA3,
+    0xAF, 0xFF, 0xFF, 0xFD, 0x4F, 0xFF, 0xFF, 0xFD, 0x93, 0xAF, 0xD7, 0x77, 0x0A, 0xFD, 0x71, 0x99,
+    0x74, 0xAF, 0xEA, 0xAA, 0xAA, 0xFD, 0x74, 0xAF, 0xFF, 0xFD, 0x97, 0x4F, 0xFF, 0xFE, 0x74, 0x9F,
+    0xFF, 0xFD, 0x76, 0xAF, 0xFF, 0xF9, 0x77, 0x9A, 0xFF, 0xDA, 0x97, 0x77, 0x77, 0x30, 0x77, 0x70,
+    0x9C, 0xA7, 0x3A, 0xC9, 0x73, 0xD7, 0x39, 0xD7, 0x09, 0xFE, 0x5F, 0xFC, 0x4F, 0xE9, 0x99, 0x3A,
+    0xE9, 0x9C, 0xA5, 0x9E, 0x90, 0xAC, 0x95, 0xAD, 0xA1, 0xD6, 0xE2, 0xD5, 0x9D, 0xA1, 0x9C, 0xA5,
+    0xAD, 0x91, 0xAC, 0x95, 0xE9, 0x1D, 0x6E, 0x91, 0xCA, 0x6F, 0x0A, 0xC9, 0x6A, 0xFD, 0xAA, 0xA4,
+    0x9F, 0xFC, 0x94, 0xAF, 0xFC, 0x6A, 0xFD, 0x97, 0xD7, 0x49, 0x70, 0x49, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0xAF, 0xFF, 0xFE, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x70, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x49, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFA,
+    0x74, 0xAD, 0xA7, 0x75, 0xE9, 0x77, 0x49, 0xE7, 0x75, 0xAE, 0x77, 0x5E, 0xA7, 0x74, 0x9E, 0x97,
+    0x74, 0xF7, 0x75, 0xEA, 0x77, 0x4A, 0xE9, 0x77, 0x4F, 0x77, 0x49, 0xF7, 0x74, 0xAE, 0xA7, 0x74,
+    0xF9, 0x77, 0x39, 0xF7, 0x74, 0xFC, 0x77, 0x4F, 0x97, 0x73, 0xAF, 0x77, 0x4F, 0xC7, 0x71, 0x3F,
+    0xFF, 0xC2, 0x9F, 0xFF, 0xA7, 0xAD, 0x76, 0xD7, 0x6A, 0xC9, 0x75, 0xAC, 0x96, 0x9F, 0xFF, 0x92,
+    0xAF, 0xFF, 0x70, 0x9D, 0xA7, 0x29, 0xAE, 0x7A, 0xFD, 0xA7, 0x0F, 0xD7, 0x2F, 0xDA, 0x71, 0x99,
+    0x99, 0xE9, 0x74, 0x9D, 0xA7, 0x49, 0xE7, 0x49, 0xE7, 0x4F, 0x74, 0xF7, 0x39, 0xF7, 0x3A, 0xF7,
+    0x3F, 0xC7, 0x77, 0x7A, 0xD7, 0x5E, 0x75, 0xDA, 0x29, 0xA7, 0x9D, 0x99, 0xAE, 0x7A, 0xFE, 0x96,
+    0xAF, 0xD9, 0x6F, 0xD9, 0x70, 0xAF, 0xC9, 0x39, 0x4C, 0xA9, 0xAD, 0x19, 0xAC, 0xA7, 0xEA, 0xF7,
+    0x9F, 0xDA, 0x95, 0xAF, 0xD9, 0x7F, 0xD6, 0xD9, 0x0D, 0xAE, 0x5D, 0xA1, 0x90, 0x9D, 0xA3, 0xAE,
+    0x4A, 0xD2, 0x9F, 0x5E, 0x9A, 0xF9, 0x6F, 0xEA, 0x79, 0xEA, 0xA7, 0x77, 0x10, 0x77, 0x77, 0xAC,
+    0x97, 0x71, 0xD7, 0x72, 0xD7, 0x71, 0xAD, 0x97, 0x6A, 0xFD, 0x97, 0x29, 0xFF, 0xC7, 0x19, 0xFF,
+    0xDA, 0x70, 0xFA, 0xCA, 0x0A, 0xE7, 0xAE, 0x0A, 0xC9, 0x1E, 0x7E, 0x1D, 0x2E, 0x6A, 0xD9, 0x1D,
+    0x2A, 0xCA, 0x6E, 0x19, 0xCA, 0x2D, 0x96, 0xD9, 0x1A, 0xC9, 0x2D, 0x95, 0x9D, 0x2D, 0x92, 0xD6,
+    0xAC, 0xA2, 0xD2, 0xAC, 0xA6, 0xD9, 0x19, 0xD2, 0xD9, 0x6D, 0x2A, 0xCA, 0x2D, 0x69, 0xD2, 0xAC,
+    0x91, 0x9D, 0x6A, 0xD2, 0xD2, 0xAC, 0xA6, 0xDA, 0x2D, 0x2D, 0x96, 0xDA, 0x19, 0xCA, 0x19, 0xD7,
+    0xD9, 0x1A, 0xC9, 0x1A, 0xCA, 0x60, 0x73, 0xFF, 0xCA, 0x97, 0x7F, 0xFF, 0x75, 0x9E, 0xAA, 0xAF,
+    0xE7, 0x4E, 0x95, 0x9E, 0x97, 0x3E, 0x7A, 0xDA, 0x72, 0x9E, 0x79, 0xDA, 0x72, 0xEA, 0x7A, 0xDA,
+    0x72, 0xE9, 0x7E, 0x72, 0x9E, 0x7F, 0x72, 0xF4, 0x9A, 0xF9, 0x49, 0xFF, 0xFF, 0xEA, 0x5A, 0xFF,
+    0xFF, 0xDA, 0x6A, 0xFF, 0xFF, 0xA7, 0x0F, 0xFD, 0xAA, 0xAA, 0x97, 0x79, 0xEA, 0x77, 0x5A, 0xE9,
+    0x77, 0xAF, 0xFF, 0xEA, 0x71, 0xFF, 0xFF, 0x71, 0x9F, 0xFF, 0xF7, 0x7F, 0xA7, 0x75, 0xF9, 0x77,
+    0x4A, 0xF7, 0x75, 0xFC, 0x77, 0x5F, 0xC7, 0x74, 0xAF, 0xA7, 0x70, 0x79, 0x77, 0xAC, 0x97, 0x59,
+    0xD7, 0x6D, 0x76, 0xDA, 0x75, 0x9D, 0x76, 0xD6, 0x9A, 0xDA, 0x2D, 0x93, 0x9A, 0xFC, 0xA1, 0xAC,
+    0xA0, 0x9A, 0xFD, 0xA9, 0x29, 0xFF, 0xCA, 0x95, 0xFD, 0xA9, 0x70, 0x9E, 0xA7, 0x59, 0xE9, 0x75,
+    0x9E, 0x97, 0x59, 0xE9, 0x76, 0xEA, 0x76, 0xE7, 0x7A, 0x71, 0x77, 0x74, 0x9C, 0xA7, 0x6A, 0xEA,
+    0x74, 0xFD, 0xA7, 0x1A, 0xFF, 0x97, 0xE9, 0xAC, 0xA0, 0xE9, 0x49, 0xDA, 0x1D, 0x91, 0xE3, 0xAD,
+    0x92, 0xD3, 0xE1, 0xE3, 0x9D, 0x39, 0xD1, 0x9A, 0x4A, 0xCA, 0x49, 0x71, 0xD9, 0x77, 0xD7, 0x79,
+    0xD7, 0x7A, 0xCA, 0x77, 0xD9, 0x77, 0xD7, 0x79, 0xD7, 0x7D, 0x97, 0x10, 0x70, 0x97, 0x79, 0xCA,
+    0x77, 0xD9, 0x77, 0xD7, 0x79, 0xD7, 0x7D, 0x93, 0xAD, 0xA9, 0x6D, 0x3A, 0xFC, 0xA9, 0x39, 0xD4,
+    0x9A, 0xFD, 0xA9, 0x0A, 0xCA, 0x7A, 0xFF, 0xC9, 0x71, 0x9A, 0xFD, 0x75, 0xAE, 0x97, 0x4E, 0xA7,
+    0x39, 0xE9, 0x73, 0x9E, 0x97, 0x3A, 0xE7, 0x5E, 0x77, 0xA6, 0x5D, 0x97, 0x7A, 0xCA, 0x77, 0x9D,
+    0x77, 0x0D, 0x77, 0x0D, 0x97, 0x7A, 0xCA, 0x77, 0x9D, 0x77, 0x0D, 0x71, 0x99, 0x4D, 0x94, 0x92,
+    0xDA, 0x3A, 0xCA, 0x3A, 0xCA, 0x2E, 0x91, 0x9D, 0x29, 0xE3, 0xAD, 0xA1, 0xD1, 0x9E, 0x59, 0xE0,
+    0xD9, 0x0E, 0x70, 0xAF, 0xF7, 0x29, 0xFD, 0x97, 0x4F, 0x97, 0x6A, 0xCA, 0x77, 0x70, 0x59, 0xA7,
+    0x6A, 0x74, 0xD7, 0x6D, 0x72, 0xAC, 0x77, 0x9C, 0xA7, 0x09, 0xCA, 0x77, 0x0A, 0xC7, 0x0D, 0x69,
+    0xA0, 0x97, 0xD6, 0xAC, 0x49, 0xAE, 0x9E, 0xA9, 0x39, 0xCA, 0x49, 0xC9, 0x09, 0xAF, 0xCA, 0x90,
+    0x9A, 0xFC, 0xA9, 0x0A, 0xC9, 0x3F, 0xEA, 0x97, 0x09, 0xAF, 0xE2, 0xFA, 0x97, 0x70, 0xAF, 0xA1,
+    0xE7, 0x75, 0x9D, 0xA2, 0xAD, 0x97, 0x72, 0x9D, 0xA4, 0xAD, 0x97, 0x70, 0xAD, 0xA6, 0xAD, 0xA7,
+    0x6A, 0xD9, 0x70, 0x9C, 0xA7, 0x6D, 0x97, 0x29, 0x77, 0x70, 0x77, 0x6D, 0x97, 0x19, 0xF7, 0x0A,
+    0xFD, 0x59, 0xD9, 0xAC, 0x0A, 0xD3, 0xAD, 0x1D, 0x1E, 0x1D, 0xA2, 0xCA, 0x2D, 0xA9, 0xC9, 0x29,
+    0xC9, 0x3A, 0x6A, 0xC7, 0x4D, 0x74, 0xCA, 0x73, 0xAC, 0x97, 0x3D, 0x74, 0xD7, 0x39, 0xC9, 0x74,
+    0x97, 0x5C, 0xA7, 0x4D, 0x74, 0xAC, 0x74, 0x9C, 0x97, 0x4C, 0xA7, 0x4D, 0x79, 0x3A, 0xC9, 0x59,
+    0xCA, 0x29, 0xCA, 0x2A, 0xC9, 0x09, 0xD9, 0x1D, 0x19, 0xD9, 0x2D, 0xA0, 0xD0, 0x9D, 0x94, 0xAD,
+    0xAC, 0xAD, 0xA6, 0x9F, 0xCA, 0x71, 0xAD, 0xA7, 0x39, 0xC4, 0x70, 0x99, 0xAC, 0xA6, 0x9A, 0xAF,
+    0xE2, 0x9F, 0xFA, 0x99, 0x4A, 0xF9, 0x72, 0xAF, 0xC9, 0x71, 0xAD, 0x9F, 0x70, 0x9D, 0x1A, 0xEA,
+    0x69, 0xD3, 0xAE, 0x94, 0x9D, 0x49, 0xF9, 0x29, 0xD6, 0x9F, 0x2D, 0x70, 0xAE, 0x90, 0xD9, 0x71,
+    0xAA, 0x77, 0x10, 0x3C, 0xAA, 0x97, 0x5F, 0xEA, 0x99, 0x71, 0x9A, 0xAF, 0xF7, 0x39, 0xAF, 0x73,
+    0xAF, 0xC7, 0x19, 0xEA, 0xAD, 0x79, 0xF9, 0x09, 0xD6, 0xAE, 0x92, 0x9D, 0x4A, 0xEA, 0x4A, 0xD2,
+    0x9F, 0x6A, 0xD1, 0xF9, 0x7A, 0xD2, 0xCA, 0x71, 0xAC, 0xA7, 0x72, 0x19, 0x73, 0x9C, 0x97, 0x29,
+    0xD7, 0x3D, 0x97, 0x29, 0xD5, 0xD3, 0xD9, 0x4D, 0x3A, 0xD3, 0x9C, 0xA4, 0xD9, 0x2A, 0xC9, 0x4A,
+    0xD2, 0xD6, 0xD9, 0x1D, 0x6A, 0xD0, 0x9C, 0xA7, 0xD9, 0xAC, 0x97, 0xAF, 0x71, 0xF2, 0xAF, 0xAA,
+    0xEA, 0x2F, 0xFD, 0x94, 0x99, 0xAF, 0xC7, 0x49, 0x30, 0x71, 0x97, 0x4D, 0x72, 0x9D, 0x72, 0xDA,
+    0x19, 0xC9, 0x49, 0xD2, 0x9C, 0xA4, 0xDA, 0x3D, 0x39, 0xD4, 0xD3, 0xDA, 0x4A, 0xC9, 0x19, 0xD5,
+    0x9C, 0xA1, 0xDA, 0x6D, 0x09, 0xD7, 0xD0, 0xDA, 0x7A, 0xCA, 0xD7, 0x09, 0xEA, 0x49, 0x3E, 0xAA,
+    0xAF, 0x3F, 0xFD, 0x92, 0xAF, 0xAA, 0x99, 0x59, 0x70, 0x77, 0x71, 0x9A, 0x77, 0x3A, 0xD7, 0x72,
+    0xE7, 0x71, 0x9D, 0x77, 0x2A, 0xCA, 0x77, 0x19, 0xD7, 0x72, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x2A, 0xFF, 0xFF, 0xD1, 0x9D, 0x97, 0x71, 0x9D, 0xA7, 0x72, 0x9E, 0x97, 0x72, 0xFF,
+    0xFF, 0xD4, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x95, 0xAE, 0x77, 0x29, 0xE7, 0x72, 0x9D,
+    0x97, 0x72, 0xAC, 0x77, 0x77, 0x10, 0x72, 0x97, 0x74, 0xAC, 0x2C, 0x97, 0x6D, 0xA2, 0xD7, 0x49,
+    0xE9, 0x19, 0xE7, 0x29, 0xF2, 0xAE, 0xA7, 0x0A, 0xDA, 0xD2, 0xD9, 0xD9, 0x6E, 0xA0, 0xCA, 0x2C,
+    0xA0, 0xAD, 0x94, 0xE9, 0x09, 0xC9, 0x19, 0xC9, 0x1E, 0x29, 0xE2, 0xAC, 0x2A, 0xC2, 0x9E, 0x09,
+    0xDA, 0x3D, 0x2D, 0x3A, 0xD1, 0xC9, 0x4C, 0x91, 0x9C, 0xA4, 0xA7, 0x09, 0xC2, 0xAC, 0x97, 0x6A,
+    0xC2, 0xD7, 0x7C, 0xA2, 0xCA, 0x77, 0xC9, 0x19, 0xC9, 0x76, 0x9C, 0x2A, 0xC7, 0x7A, 0xC2, 0xD7,
+    0x7C, 0xA2, 0xCA, 0x77, 0xC9, 0x19, 0xC9, 0x76, 0x9C, 0x2A, 0xC7, 0x7D, 0x2D, 0x72, 0x77, 0x77,
+    0x5C, 0x77, 0x3D, 0x97, 0x72, 0xDA, 0x77, 0x29, 0xD7, 0x73, 0xDA, 0x77, 0x29, 0xD4, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0xA3, 0xFF, 0xFF, 0xD9, 0x77, 0x2A, 0xD7, 0x72, 0xE9, 0x77,
+    0x9E, 0x2F, 0xFF, 0xFC, 0xA3, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAE, 0x97, 0x70, 0xE9, 0x77,
+    0x0E, 0x97, 0x70, 0xAD, 0x97, 0x72, 0xC9, 0x77, 0x75, 0x5A, 0x29, 0xA7, 0x70, 0xC9, 0x19, 0xCA,
+    0x77, 0xD2, 0xD7, 0x7A, 0xC2, 0xD7, 0x79, 0xC9, 0x19, 0xC9, 0x77, 0xCA, 0x2C, 0xA7, 0x7A, 0xC2,
+    0xD7, 0x79, 0xC2, 0xAC, 0x77, 0x0C, 0x91, 0x9C, 0x97, 0x7C, 0xA2, 0xCA, 0x70, 0x99, 0x4A, 0xC2,
+    0xD7, 0x0D, 0xA3, 0x9C, 0x2A, 0xC4, 0xD1, 0x9E, 0x3C, 0x91, 0x9C, 0x92, 0xAD, 0xA2, 0xE9, 0x1C,
+    0xA2, 0xD2, 0xE4, 0xEA, 0x0A, 0xC2, 0xD1, 0xE6, 0xAD, 0xA9, 0xC2, 0xAC, 0x9A, 0xD9, 0x79, 0xFA,
+    0x19, 0xF9, 0x71, 0x9F, 0x2E, 0xA7, 0x4E, 0x2A, 0xD7, 0x6A, 0xC9, 0x19, 0xC7, 0x70, 0xAA, 0x29,
+    0x77, 0x74, 0x77, 0x77, 0x09, 0xA7, 0x79, 0xA7, 0x0A, 0xD7, 0x5A, 0xD7, 0x0E, 0x75, 0xAD, 0x79,
+    0xD7, 0x7D, 0xA6, 0xAC, 0xA7, 0x79, 0xD5, 0x9D, 0x77, 0x1D, 0xA4, 0xE9, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x9A, 0xD3, 0xAF, 0xFF, 0xFF, 0xFC, 0x19, 0xD9, 0x77, 0x4D, 0xA0, 0x9D,
+    0xA7, 0x73, 0xAD, 0xA1, 0x9E, 0x97, 0x70, 0xE9, 0x4F, 0xFF, 0xFF, 0xD9, 0x6A, 0xE9, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x9F, 0x71, 0xAE, 0x71, 0xAE, 0x73, 0x9E, 0x7A, 0xDA, 0x75, 0x9D, 0x96, 0xDA,
+    0x77, 0xAC, 0x7A, 0xC7, 0x77, 0x75, 0x7A, 0x77, 0xAD, 0x97, 0x49, 0xFC, 0x97, 0x2D, 0x9A, 0xEA,
+    0x97, 0xDA, 0x09, 0xCA, 0xFA, 0x93, 0xE1, 0x9C, 0x1A, 0xE9, 0x2E, 0xA1, 0x9C, 0x3C, 0x92, 0xFA,
+    0x19, 0xC7, 0xEA, 0xAA, 0x19, 0xC6, 0x9D, 0xA0, 0xAA, 0x19, 0xC7, 0x09, 0x1A, 0xA1, 0x9C, 0x73,
+    0xAA, 0x19, 0xC7, 0x3A, 0xA1, 0x9C, 0x73, 0xAA, 0x19, 0xC7, 0x3A, 0xA1, 0x9C, 0x73, 0xAA, 0x19,
+    0xC7, 0x3A, 0xA1, 0x9C, 0x70, 0x91, 0xAA, 0x19, 0xC6, 0x9D, 0xA0, 0xAA, 0x19, 0xC7, 0xEA, 0xAA,
+    0x19, 0xC7, 0x0F, 0xA1, 0x9C, 0x71, 0xEA, 0x19, 0xC3, 0xC9, 0x4E, 0x19, 0xC1, 0xAE, 0x94, 0xDA,
+    0x09, 0xCA, 0xFA, 0x95, 0xD9, 0xAF, 0x97, 0x09, 0xFC, 0x97, 0x3A, 0xDA, 0x76, 0xC9, 0x70, 0x76,
+    0xAC, 0xA9, 0x77, 0x9F, 0x97, 0x71, 0xE7, 0x71, 0xAD, 0x77, 0x1A, 0xCA, 0x77, 0x1D, 0x97, 0x71,
+    0xD7, 0x71, 0x9D, 0x77, 0x1D, 0x97, 0xAF, 0xC9, 0x2D, 0x69, 0xFF, 0x90, 0xAC, 0xA5, 0x9E, 0xA2,
+    0xAD, 0x0D, 0x59, 0xE5, 0xFC, 0x5E, 0x95, 0x9E, 0x94, 0x9D, 0xA6, 0x9E, 0x5A, 0xD7, 0x9D, 0x95,
+    0xE7, 0xE6, 0xE6, 0xAD, 0x96, 0xEA, 0x39, 0xAD, 0xA7, 0xFF, 0xF7, 0x09, 0xFF, 0xD7, 0x2A, 0xFF,
+    0x74, 0x9A, 0xEA, 0x97, 0x20, 0x77, 0x77, 0x73, 0x9A, 0xFC, 0xAA, 0x3D, 0x74, 0xAF, 0xFE, 0xA9,
+    0xE7, 0x29, 0xFE, 0xAF, 0xFA, 0x72, 0x9F, 0xC9, 0x4A, 0xFC, 0x72, 0x9F, 0xA7, 0xAF, 0x72, 0xF9,
+    0x79, 0xFC, 0x97, 0x0F, 0xA7, 0xAF, 0xDA, 0x79, 0xEA, 0x7A, 0xD9, 0x9E, 0xA7, 0xF7, 0xAD, 0x2E,
+    0xA6, 0x9E, 0x96, 0xE3, 0xE9, 0x6F, 0x6E, 0x39, 0xE9, 0x6E, 0x95, 0xE4, 0x9E, 0x69, 0xE4, 0x9D,
+    0xA5, 0xAE, 0x6A, 0xE3, 0x9D, 0xA6, 0xE9, 0x6E, 0xA2, 0x9D, 0xA6, 0x9E, 0x7E, 0xA1, 0xAD, 0x97,
+    0xF7, 0xF0, 0xAD, 0x97, 0xF9, 0x7F, 0xE9, 0x69, 0xFC, 0x70, 0xFD, 0xA9, 0x29, 0x9A, 0xFD, 0x97,
+    0x0F, 0xFF, 0xFF, 0x71, 0xAF, 0xFF, 0xFD, 0x72, 0xFF, 0xFF, 0xD9, 0x71, 0xFF, 0xFF, 0xD7, 0x2D,
+    0xA0, 0x9F, 0xFF, 0xA7, 0x2D, 0xA3, 0x9A, 0xFD, 0xA9, 0x74, 0xA9, 0x77, 0x72, 0x77, 0x77, 0x3E,
+    0xA7, 0x70, 0xAF, 0x77, 0x9F, 0xC7, 0x7F, 0xD9, 0x75, 0xEA, 0xEA, 0x74, 0xAE, 0x0A, 0xE7, 0x39,
+    0xE1, 0xAE, 0x73, 0xE9, 0x19, 0xE7, 0x2F, 0x29, 0xE9, 0x70, 0xAE, 0x4E, 0xA7, 0x9E, 0x94, 0xF7,
+    0xEA, 0x5F, 0x6F, 0x6A, 0xE9, 0x4A, 0xE9, 0x6A, 0xE9, 0x39, 0xEA, 0x79, 0xEA, 0x3F, 0x70, 0x9F,
+    0x2F, 0x97, 0x1F, 0x1A, 0xEA, 0x72, 0xF9, 0x0F, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0xF0, 0xAF, 0xFF,
+    0xFF, 0x00, 0x77, 0x79, 0xFF, 0xFF, 0xA2, 0xAF, 0xFF, 0xF5, 0x9D, 0xA4, 0x9D, 0x97, 0xAD, 0x5A,
+    0xD7, 0x0E, 0x5E, 0x70, 0xDA, 0x49, 0xDA, 0x79, 0xD9, 0x4A, 0xD9, 0x7A, 0xD5, 0xE7, 0x0E, 0x5E,
+    0x79, 0xDA, 0x49, 0xDA, 0x7A, 0xD9, 0x4A, 0xD9, 0x7E, 0x5E, 0x70, 0xE5, 0xDA, 0x79, 0xDA, 0x49,
+    0xD9, 0x7A, 0xD5, 0xAD, 0x70, 0xE5, 0xE7, 0x0D, 0xA4, 0x9D, 0xA7, 0x9D, 0x94, 0xAD, 0x97, 0xAD,
+    0x5E, 0x70, 0xE5, 0xE7, 0x99, 0x95, 0x99, 0x97, 0x09, 0xD9, 0x4A, 0xD9, 0x70, 0xDA, 0x5D, 0xA7,
+    0x0E, 0x5E, 0x70, 0xAD, 0x94, 0xAD, 0x70, 0x9D, 0xA4, 0x9D, 0x97, 0x0E, 0x5D, 0xA7, 0x0E, 0x5E,
+    0x70, 0xAD, 0x94, 0xAD, 0x97, 0x9D, 0xA4, 0x9D, 0xA7, 0x0E, 0x5E, 0x70, 0xE5, 0xE7, 0x09, 0xD9,
+    0x4A, 0xD9, 0x70, 0xDA, 0x49, 0xDA, 0x70, 0xE5, 0xE7, 0x0A, 0xD5, 0xE7, 0x09, 0xD9, 0x49, 0xD9,
+    0x70, 0xDA, 0x5D, 0xA7, 0x0E, 0x5E, 0x6F, 0xFF, 0xFA, 0x3F, 0xFF, 0xFC, 0x00, 0x49, 0xFF, 0xF9,
+    0x4A, 0xFF, 0xF5, 0x9C, 0xA7, 0x70, 0xD7, 0x71, 0xD7, 0x70, 0x9C, 0xA7, 0x70, 0xD7, 0x71, 0xD7,
+    0x70, 0x9C, 0xA7, 0x70, 0xD7, 0x70, 0x9C, 0x77, 0x9C, 0xA7, 0x6A, 0xCA, 0x76, 0xD9, 0x75, 0x9D,
+    0x97, 0x5A, 0xD7, 0x6D, 0xA7, 0x59, 0xE7, 0x6F, 0xFF, 0xC4, 0x9F, 0xFF, 0x94, 0xAF, 0xFF, 0x77,
+    0x70, 0x70, 0x99, 0x99, 0x1A, 0xFF, 0xE0, 0x9F, 0xFF, 0x76, 0x77, 0x1F, 0xFD, 0x77, 0x0A, 0xFD,
+    0xAA, 0x97, 0x70, 0x9D, 0xA7, 0x77, 0xE7, 0x77, 0xAD, 0x97, 0x77, 0xE7, 0x77, 0xE9, 0x77, 0x69,
+    0xE7, 0x77, 0xE7, 0x77, 0xAD, 0xA7, 0x76, 0x9E, 0x77, 0x7E, 0xA7, 0x76, 0xAE, 0x77, 0x69, 0xEA,
+    0x77, 0x6F, 0x77, 0x6A, 0xE9, 0x77, 0x0A, 0x4F, 0x77, 0x0D, 0xA2, 0xF9, 0x77, 0x0E, 0x90, 0x9F,
+    0x77, 0x1F, 0x9F, 0x97, 0x71, 0xAF, 0xEA, 0x77, 0x29, 0xFE, 0x77, 0x4F, 0xDA, 0x77, 0x4F, 0xD7,
+    0x76, 0x99, 0x99, 0x77, 0x40, 0x79, 0x9A, 0x95, 0x9A, 0xA9, 0x71, 0xAF, 0xD9, 0x2F, 0xD7, 0xFF,
+    0xC1, 0xFF, 0x5E, 0xA9, 0x19, 0xD9, 0xEA, 0x2D, 0x4A, 0xD9, 0x5F, 0x49, 0xC9, 0x3D, 0x96, 0xE6,
+    0xC9, 0x2A, 0xD7, 0xDA, 0x59, 0xC9, 0x2D, 0x97, 0xD9, 0x5A, 0xC3, 0xD7, 0x9D, 0x94, 0x9C, 0xA3,
+    0xD7, 0xF3, 0xAD, 0x93, 0xDA, 0x4A, 0xFF, 0xF4, 0xFF, 0xDA, 0xFF, 0xC5, 0xAF, 0xFC, 0x0A, 0xFE,
+    0x96, 0xFF, 0x2A, 0xFA, 0x71, 0x9A, 0xAA, 0xA6, 0x99, 0x70, 0x77, 0x70, 0xAE, 0xA9, 0x77, 0x6A,
+    0xFD, 0xA7, 0x75, 0xAE, 0x91, 0x99, 0x77, 0x4A, 0xDA, 0x77, 0x72, 0xE7, 0x77, 0x2E, 0x97, 0x77,
+    0x19, 0xE7, 0x77, 0x2A, 0xD9, 0x77, 0x72, 0xE7, 0x77, 0x2A, 0xDA, 0x77, 0x72, 0xE7, 0x77, 0x29,
+    0xDA, 0x77, 0x72, 0xE7, 0x77, 0x29, 0xE7, 0x77, 0x2A, 0xD9, 0x77, 0x72, 0xE7, 0x77, 0x2A, 0xDA,
+    0x77, 0x72, 0xE7, 0x77, 0x29, 0xE7, 0x77, 0x2E, 0x97, 0x77, 0x2E, 0x77, 0x72, 0xAD, 0xA7, 0x77,
+    0x2E, 0x77, 0x72, 0xAE, 0x77, 0x72, 0xE9, 0x77, 0x71, 0xF7, 0x73, 0xA9, 0x3F, 0x97, 0x71, 0xAF,
+    0xFE, 0x77, 0x09, 0xFF, 0xF7, 0x72, 0xFF, 0xE9, 0x77, 0x3A, 0xFF, 0x97, 0x75, 0x9A, 0xFA, 0x77,
+    0x77, 0x77, 0x30, 0x5E, 0xA4, 0x9E, 0x94, 0xF9, 0x39, 0xF4, 0xFC, 0x49, 0x99, 0x99, 0x77, 0x77,
+    0x77, 0x77, 0x70, 0xAE, 0x5F, 0x49, 0xF4, 0xFC, 0x39, 0xFA, 0x30, 0x59, 0x99, 0x97, 0x59, 0xFD,
+    0x5D, 0x92, 0x9E, 0x1A, 0xD3, 0x9D, 0x3E, 0x3D, 0xA1, 0x9D, 0x92, 0xAD, 0x5F, 0xDA, 0x75, 0x9A,
+    0xAA, 0x97, 0x77, 0x77, 0x5A, 0xF9, 0x59, 0x94, 0xEA, 0xAD, 0x93, 0x9D, 0x92, 0xE3, 0xD9, 0x2D,
+    0xA2, 0xAD, 0x93, 0x9F, 0xE3, 0x99, 0xA5, 0x9F, 0xA7, 0x77, 0x00, 0x77, 0x4A, 0x97, 0x74, 0xD7,
+    0x74, 0xD9, 0x77, 0x3A, 0xC9, 0x77, 0x3A, 0xCA, 0x77, 0x3A, 0xCA, 0x77, 0x39, 0xD7, 0x73, 0x9D,
+    0x91, 0x99, 0x7F, 0xFF, 0xF9, 0x5F, 0xFF, 0xFC, 0xA7, 0x4D, 0xA7, 0x73, 0xDA, 0x77, 0x3A, 0xCA,
+    0x77, 0x39, 0xD7, 0x73, 0x9F, 0xFE, 0x69, 0xFF, 0xFF, 0x59, 0xFD, 0x99, 0x99, 0x77, 0x0D, 0x97,
+    0x73, 0xDA, 0x77, 0x3A, 0xCA, 0x77, 0x3A, 0xD7, 0x73, 0xAD, 0x77, 0x3A, 0xD7, 0x77, 0x77, 0x30,
+    0x75, 0x9A, 0x77, 0x49, 0xE7, 0x72, 0x9F, 0xC9, 0x77, 0x9F, 0xCA, 0x77, 0x9F, 0xD7, 0x79, 0xFD,
+    0x97, 0x69, 0xFD, 0x97, 0x69, 0xFD, 0xA7, 0x70, 0xFC, 0xA7, 0x72, 0x9F, 0xA9, 0x77, 0x2F, 0xFA,
+    0x97, 0x79, 0xAF, 0xFC, 0xA9, 0x77, 0x9F, 0xFD, 0xA9, 0x76, 0x9A, 0xFF, 0xC9, 0x77, 0x09, 0xAF,
+    0xCA, 0x77, 0x39, 0xAE, 0x77, 0x79, 0x79, 0x97, 0x76, 0xFD, 0xAA, 0x99, 0x76, 0xFF, 0xFD, 0xAA,
+    0x99, 0x72, 0x99, 0x9A, 0xAA, 0xFF, 0xC9, 0x77, 0x39, 0x9A, 0xAA, 0x00, 0x70, 0xA9, 0x77, 0x7E,
+    0x97, 0x75, 0xFC, 0x97, 0x74, 0xAF, 0xC9, 0x77, 0x4A, 0xFC, 0x97, 0x73, 0x9F, 0xD9, 0x77, 0x39,
+    0xFD, 0x97, 0x73, 0x9F, 0xD9, 0x77, 0x3A, 0xFC, 0x77, 0x29, 0xAF, 0xA7, 0x69, 0xAF, 0xF7, 0x39,
+    0xAF, 0xFC, 0xA9, 0x70, 0x9A, 0xFF, 0xDA, 0x73, 0xFF, 0xCA, 0x97, 0x59, 0xFC, 0xA9, 0x77, 0x1E,
+    0xA9, 0x77, 0x49, 0x77, 0x77, 0x79, 0x97, 0x79, 0x9A, 0xAF, 0xD7, 0x99, 0xAA, 0xFF, 0xFD, 0x6F,
+    0xFD, 0xAA, 0x99, 0x97, 0x1A, 0xAA, 0x99, 0x97, 0x72,
 };
 
 static const EpdGlyph opendyslexic_14_italicGlyphs[] = {
     { 0, 0, 25, 0, 0, 0, 0 }, //  
-    { 14, 29, 16, 1, 29, 102, 0 }, // !
-    { 15, 9, 22, 6, 25, 34, 102 }, // "
-    { 33, 25, 37, 3, 23, 207, 136 }, // #
-    { 26, 31, 31, 2, 27, 202, 343 }, // $
-    { 24, 25, 32, 7, 23, 150, 545 }, // %
-    { 24, 26, 29, 4, 25, 156, 695 }, // &
-    { 7, 9, 13, 5, 22, 16, 851 }, // '
-    { 17, 40, 21, 3, 30, 170, 867 }, // (
-    { 16, 40, 13, -7, 30, 160, 1037 }, // )
-    { 15, 14, 22, 6, 22, 53, 1197 }, // *
-    { 15, 14, 20, 4, 15, 53, 1250 }, // +
-    { 10, 10, 11, 0, 5, 25, 1303 }, // ,
-    { 14, 3, 19, 4, 10, 11, 1328 }, // -
-    { 6, 5, 8, 1, 5, 8, 1339 }, // .
-    { 29, 45, 26, -4, 32, 327, 1347 }, // /
-    { 19, 22, 23, 3, 22, 105, 1674 }, // 0
-    { 14, 22, 17, 2, 22, 77, 1779 }, // 1
-    { 20, 22, 23, 2, 22, 110, 1856 }, // 2
-    { 20, 22, 23, 2, 22, 110, 1966 }, // 3
-    { 16, 22, 21, 4, 22, 88, 2076 }, // 4
-    { 19, 23, 22, 2, 23, 110, 2164 }, // 5
-    { 19, 22, 23, 3, 22, 105, 2274 }, // 6
-    { 15, 22, 23, 7, 22, 83, 2379 }, // 7
-    { 20, 22, 23, 2, 22, 110, 2462 }, // 8
-    { 19, 22, 23, 3, 22, 105, 2572 }, // 9
-    { 10, 18, 12, 1, 18, 45, 2677 }, // :
-    { 12, 22, 13, 0, 17, 66, 2722 }, // ;
-    { 22, 17, 23, -1, 18, 94, 2788 }, // <
-    { 16, 10, 20, 3, 13, 40, 2882 }, // =
-    { 22, 17, 25, 2, 18, 94, 2922 }, // >
-    { 18, 33, 24, 5, 33, 149, 3016 }, // ?
-    { 29, 25, 35, 4, 23, 182, 3165 }, // @
-    { 23, 25, 29, 1, 25, 144, 3347 }, // A
-    { 22, 25, 24, 1, 25, 138, 3491 }, // B
-    { 25, 27, 27, 1, 26, 169, 3629 }, // C
-    { 25, 25, 28, 1, 25, 157, 3798 }, // D
-    { 23, 25, 25, 1, 25, 144, 3955 }, // E
-    { 21, 25, 23, 1, 25, 132, 4099 }, // F
-    { 25, 26, 29, 2, 26, 163, 4231 }, // G
-    { 27, 25, 29, 1, 25, 169, 4394 }, // H
-    { 12, 25, 14, 1, 25, 75, 4563 }, // I
-    { 21, 33, 21, -1, 26, 174, 4638 }, // J
-    { 23, 25, 26, 1, 25, 144, 4812 }, // K
-    { 18, 25, 22, 1, 25, 113, 4956 }, // L
-    { 31, 25, 33, 1, 25, 194, 5069 }, // M
-    { 28, 25, 30, 1, 25, 175, 5263 }, // N
-    { 28, 26, 31, 2, 25, 182, 5438 }, // O
-    { 23, 25, 25, 1, 25, 144, 5620 }, // P
-    { 29, 29, 31, 1, 25, 211, 5764 }, // Q
-    { 22, 25, 24, 1, 25, 138, 5975 }, // R
-    { 25, 27, 29, 1, 26, 169, 6113 }, // S
-    { 23, 25, 30, 6, 25, 144, 6282 }, // T
-    { 26, 26, 29, 2, 25, 169, 6426 }, // U
-    { 24, 25, 32, 7, 25, 150, 6595 }, // V
-    { 33, 25, 40, 6, 25, 207, 6745 }, // W
-    { 29, 25, 31, 1, 25, 182, 6952 }, // X
-    { 21, 25, 29, 7, 25, 132, 7134 }, // Y
-    { 29, 25, 31, 1, 25, 182, 7266 }, // Z
-    { 21, 41, 21, -1, 31, 216, 7448 }, // [
-    { 5, 28, 14, 7, 23, 35, 7664 }, // <backslash>
-    { 20, 41, 15, -6, 31, 205, 7699 }, // ]
-    { 13, 6, 19, 5, 26, 20, 7904 }, // ^
-    { 21, 4, 23, 0, -2, 21, 7924 }, // _
-    { 9, 5, 17, 7, 22, 12, 7945 }, // `
-    { 18, 18, 22, 1, 18, 81, 7957 }, // a
-    { 18, 26, 23, 3, 25, 117, 8038 }, // b
-    { 15, 18, 20, 2, 17, 68, 8155 }, // c
-    { 23, 26, 25, 1, 25, 150, 8223 }, // d
-    { 18, 17, 22, 2, 17, 77, 8373 }, // e
-    { 14, 24, 18, 3, 24, 84, 8450 }, // f
-    { 21, 24, 22, 0, 16, 126, 8534 }, // g
-    { 19, 25, 22, 1, 25, 119, 8660 }, // h
-    { 11, 26, 13, 1, 26, 72, 8779 }, // i
-    { 19, 32, 22, 2, 25, 152, 8851 }, // j
-    { 16, 24, 22, 1, 24, 96, 9003 }, // k
-    { 11, 24, 14, 1, 24, 66, 9099 }, // l
-    { 29, 16, 32, 1, 16, 116, 9165 }, // m
-    { 18, 17, 22, 1, 17, 77, 9281 }, // n
-    { 18, 16, 22, 2, 16, 72, 9358 }, // o
-    { 23, 24, 24, -1, 16, 138, 9430 }, // p
-    { 20, 25, 26, 2, 18, 125, 9568 }, // q
-    { 15, 17, 17, 1, 17, 64, 9693 }, // r
-    { 17, 16, 21, 1, 16, 68, 9757 }, // s
-    { 13, 22, 19, 4, 22, 72, 9825 }, // t
-    { 18, 17, 21, 2, 16, 77, 9897 }, // u
-    { 18, 16, 24, 5, 16, 72, 9974 }, // v
-    { 23, 16, 29, 5, 16, 92, 10046 }, // w
-    { 22, 16, 24, 1, 16, 88, 10138 }, // x
-    { 22, 24, 23, 0, 16, 132, 10226 }, // y
-    { 20, 16, 22, 1, 16, 80, 10358 }, // z
-    { 16, 27, 21, 4, 22, 108, 10438 }, // {
-    { 10, 25, 12, 1, 21, 63, 10546 }, // |
-    { 16, 27, 18, 0, 22, 108, 10609 }, // }
-    { 13, 6, 19, 5, 22, 20, 10717 }, // ~
-    { 0, 0, 25, 0, 0, 0, 10737 }, //  
-    { 11, 29, 15, 3, 22, 80, 10737 }, // ¡
-    { 15, 25, 20, 2, 22, 94, 10817 }, // ¢
-    { 23, 27, 25, 1, 27, 156, 10911 }, // £
-    { 18, 15, 22, 3, 18, 68, 11067 }, // ¤
-    { 22, 24, 27, 4, 22, 132, 11135 }, // ¥
-    { 10, 25, 12, 1, 21, 63, 11267 }, // ¦
-    { 23, 25, 25, 1, 22, 144, 11330 }, // §
-    { 14, 5, 21, 6, 23, 18, 11474 }, // ¨
-    { 13, 11, 21, 7, 26, 36, 11492 }, // ©
-    { 10, 10, 16, 5, 22, 25, 11528 }, // ª
-    { 19, 14, 24, 3, 14, 67, 11553 }, // «
-    { 14, 9, 19, 4, 10, 32, 11620 }, // ¬
-    { 14, 3, 19, 4, 10, 11, 11652 }, // ­
-    { 13, 11, 22, 8, 31, 36, 11663 }, // ®
-    { 11, 3, 19, 7, 21, 9, 11699 }, // ¯
-    { 15, 14, 21, 5, 23, 53, 11708 }, // °
-    { 17, 17, 21, 1, 16, 73, 11761 }, // ±
-    { 10, 11, 14, 3, 24, 28, 11834 }, // ²
-    { 10, 11, 14, 3, 23, 28, 11862 }, // ³
-    { 7, 6, 14, 6, 23, 11, 11890 }, // ´
-    { 21, 19, 21, -1, 16, 100, 11901 }, // µ
-    { 20, 24, 22, 1, 21, 120, 12001 }, // ¶
-    { 6, 5, 10, 3, 12, 8, 12121 }, // ·
-    { 8, 8, 10, 0, 1, 16, 12129 }, // ¸
-    { 8, 11, 12, 3, 24, 22, 12145 }, // ¹
-    { 10, 9, 16, 5, 21, 23, 12167 }, // º
-    { 20, 14, 19, -4, 14, 70, 12190 }, // »
-    { 24, 28, 32, 7, 26, 168, 12260 }, // ¼
-    { 25, 27, 33, 7, 25, 169, 12428 }, // ½
-    { 25, 27, 32, 6, 25, 169, 12597 }, // ¾
-    { 19, 32, 18, -2, 17, 152, 12766 }, // ¿
-    { 23, 33, 29, 1, 33, 190, 12918 }, // À
-    { 25, 38, 29, 1, 38, 238, 13108 }, // Á
-    { 25, 32, 29, 1, 32, 200, 13346 }, // Â
-    { 26, 33, 29, 1, 33, 215, 13546 }, // Ã
-    { 27, 33, 29, 1, 33, 223, 13761 }, // Ä
-    { 24, 35, 29, 1, 35, 210, 13984 }, // Å
-    { 38, 26, 42, 1, 25, 247, 14194 }, // Æ
-    { 25, 33, 27, 1, 26, 207, 14441 }, // Ç
-    { 23, 32, 25, 1, 32, 184, 14648 }, // È
-    { 23, 38, 25, 1, 38, 219, 14832 }, // É
-    { 23, 32, 25, 1, 32, 184, 15051 }, // Ê
-    { 24, 33, 26, 1, 33, 198, 15235 }, // Ë
-    { 14, 35, 16, 1, 35, 123, 15433 }, // Ì
-    { 17, 40, 19, 1, 40, 170, 15556 }, // Í
-    { 16, 34, 18, 1, 34, 136, 15726 }, // Î
-    { 18, 35, 20, 1, 35, 158, 15862 }, // Ï
-    { 26, 25, 28, 0, 25, 163, 16020 }, // Ð
-    { 28, 32, 30, 1, 32, 224, 16183 }, // Ñ
-    { 28, 34, 31, 2, 33, 238, 16407 }, // Ò
-    { 28, 39, 31, 2, 38, 273, 16645 }, // Ó
-    { 28, 33, 31, 2, 32, 231, 16918 }, // Ô
-    { 28, 34, 31, 2, 33, 238, 17149 }, // Õ
-    { 28, 34, 31, 2, 33, 238, 17387 }, // Ö
-    { 14, 8, 18, 3, 11, 28, 17625 }, // ×
-    { 50, 49, 41, -10, 37, 613, 17653 }, // Ø
-    { 26, 35, 29, 2, 34, 228, 18266 }, // Ù
-    { 26, 39, 29, 2, 38, 254, 18494 }, // Ú
-    { 26, 33, 29, 2, 32, 215, 18748 }, // Û
-    { 26, 35, 29, 2, 34, 228, 18963 }, // Ü
-    { 21, 39, 29, 7, 39, 205, 19191 }, // Ý
-    { 19, 23, 21, 1, 23, 110, 19396 }, // Þ
-    { 20, 23, 23, 2, 23, 115, 19506 }, // ß
-    { 18, 24, 22, 1, 24, 108, 19621 }, // à
-    { 18, 28, 22, 1, 28, 126, 19729 }, // á
-    { 20, 24, 22, 1, 24, 120, 19855 }, // â
-    { 19, 23, 22, 1, 23, 110, 19975 }, // ã
-    { 20, 24, 22, 1, 24, 120, 20085 }, // ä
-    { 18, 26, 22, 1, 26, 117, 20205 }, // å
-    { 30, 18, 36, 1, 18, 135, 20322 }, // æ
-    { 15, 24, 20, 2, 17, 90, 20457 }, // ç
-    { 18, 27, 22, 2, 27, 122, 20547 }, // è
-    { 19, 32, 22, 2, 32, 152, 20669 }, // é
-    { 19, 26, 22, 2, 26, 124, 20821 }, // ê
-    { 20, 27, 23, 2, 27, 135, 20945 }, // ë
-    { 11, 24, 13, 1, 24, 66, 21080 }, // ì
-    { 14, 29, 16, 1, 29, 102, 21146 }, // í
-    { 14, 23, 16, 1, 23, 81, 21248 }, // î
-    { 15, 25, 17, 1, 25, 94, 21329 }, // ï
-    { 25, 23, 29, 3, 23, 144, 21423 }, // ð
-    { 21, 25, 23, 1, 25, 132, 21567 }, // ñ
-    { 18, 26, 22, 2, 26, 117, 21699 }, // ò
-    { 19, 31, 22, 2, 31, 148, 21816 }, // ó
-    { 19, 25, 22, 2, 25, 119, 21964 }, // ô
-    { 19, 26, 22, 2, 26, 124, 22083 }, // õ
-    { 20, 26, 23, 2, 26, 130, 22207 }, // ö
-    { 19, 18, 24, 4, 18, 86, 22337 }, // ÷
-    { 29, 45, 26, -4, 30, 327, 22423 }, // ø
-    { 18, 25, 21, 2, 24, 113, 22750 }, // ù
-    { 18, 30, 21, 2, 29, 135, 22863 }, // ú
-    { 18, 24, 21, 2, 23, 108, 22998 }, // û
-    { 19, 25, 22, 2, 24, 119, 23106 }, // ü
-    { 22, 39, 23, 0, 31, 215, 23225 }, // ý
-    { 18, 30, 20, 1, 24, 135, 23440 }, // þ
-    { 23, 35, 24, 0, 27, 202, 23575 }, // ÿ
-    { 26, 32, 29, 1, 32, 208, 23777 }, // Ā
-    { 20, 22, 22, 1, 22, 110, 23985 }, // ā
-    { 26, 36, 29, 1, 36, 234, 24095 }, // Ă
-    { 20, 26, 22, 1, 26, 130, 24329 }, // ă
-    { 23, 32, 29, 1, 25, 184, 24459 }, // Ą
-    { 18, 23, 22, 1, 18, 104, 24643 }, // ą
-    { 25, 39, 27, 1, 38, 244, 24747 }, // Ć
-    { 17, 28, 20, 2, 27, 119, 24991 }, // ć
-    { 26, 37, 28, 1, 36, 241, 25110 }, // Ĉ
-    { 19, 25, 22, 2, 24, 119, 25351 }, // ĉ
-    { 25, 37, 27, 1, 36, 232, 25470 }, // Ċ
-    { 15, 26, 20, 2, 25, 98, 25702 }, // ċ
-    { 25, 39, 27, 1, 38, 244, 25800 }, // Č
-    { 17, 27, 20, 2, 26, 115, 26044 }, // č
-    { 25, 36, 28, 1, 36, 225, 26159 }, // Ď
-    { 28, 26, 30, 1, 25, 182, 26384 }, // ď
-    { 26, 25, 28, 0, 25, 163, 26566 }, // Đ
-    { 27, 26, 29, 1, 25, 176, 26729 }, // đ
-    { 23, 32, 25, 1, 32, 184, 26905 }, // Ē
-    { 20, 26, 23, 2, 26, 130, 27089 }, // ē
-    { 23, 35, 25, 1, 35, 202, 27219 }, // Ĕ
-    { 20, 30, 23, 2, 30, 150, 27421 }, // ĕ
-    { 23, 34, 25, 1, 34, 196, 27571 }, // Ė
-    { 18, 28, 22, 2, 28, 126, 27767 }, // ė
-    { 23, 31, 25, 1, 25, 179, 27893 }, // Ę
-    { 18, 24, 22, 2, 17, 108, 28072 }, // ę
-    { 23, 35, 25, 1, 35, 202, 28180 }, // Ě
-    { 19, 30, 22, 2, 30, 143, 28382 }, // ě
-    { 26, 34, 29, 2, 34, 221, 28525 }, // Ĝ
-    { 22, 32, 23, 0, 24, 176, 28746 }, // ĝ
-    { 26, 36, 29, 2, 36, 234, 28922 }, // Ğ
-    { 21, 34, 22, 0, 26, 179, 29156 }, // ğ
-    { 25, 34, 29, 2, 34, 213, 29335 }, // Ġ
-    { 21, 33, 22, 0, 25, 174, 29548 }, // ġ
-    { 25, 39, 29, 2, 26, 244, 29722 }, // Ģ
-    { 21, 35, 22, 0, 27, 184, 29966 }, // ģ
-    { 27, 33, 29, 1, 33, 223, 30150 }, // Ĥ
-    { 19, 31, 22, 1, 31, 148, 30373 }, // ĥ
-    { 27, 24, 29, 1, 24, 162, 30521 }, // Ħ
-    { 19, 25, 22, 1, 25, 119, 30683 }, // ħ
-    { 17, 36, 19, 1, 36, 153, 30802 }, // Ĩ
-    { 14, 25, 16, 1, 25, 88, 30955 }, // ĩ
-    { 18, 34, 20, 1, 34, 153, 31043 }, // Ī
-    { 15, 23, 17, 1, 23, 87, 31196 }, // ī
-    { 14, 31, 18, 3, 25, 109, 31283 }, // Į
-    { 13, 32, 13, -1, 26, 104, 31392 }, // į
-    { 14, 36, 16, 1, 36, 126, 31496 }, // İ
-    { 8, 17, 11, 1, 17, 34, 31622 }, // ı
-    { 23, 32, 27, 1, 25, 184, 31656 }, // Ĳ
-    { 27, 34, 29, 1, 26, 230, 31840 }, // ĳ
-    { 24, 40, 24, -1, 33, 240, 32070 }, // Ĵ
-    { 24, 31, 27, 2, 24, 186, 32310 }, // ĵ
-    { 23, 36, 26, 1, 25, 207, 32496 }, // Ķ
-    { 16, 38, 22, 1, 24, 152, 32703 }, // ķ
-    { 14, 16, 16, 0, 16, 56, 32855 }, // ĸ
-    { 18, 35, 22, 1, 35, 158, 32911 }, // Ĺ
-    { 16, 34, 18, 1, 34, 136, 33069 }, // ĺ
-    { 18, 38, 22, 1, 25, 171, 33205 }, // Ļ
-    { 12, 37, 14, 0, 24, 111, 33376 }, // ļ
-    { 19, 25, 22, 1, 25, 119, 33487 }, // Ľ
-    { 18, 25, 20, 1, 25, 113, 33606 }, // ľ
-    { 20, 25, 22, 1, 25, 125, 33719 }, // Ŀ
-    { 16, 25, 18, 1, 25, 100, 33844 }, // ŀ
-    { 40, 37, 27, -14, 30, 370, 33944 }, // Ł
-    { 28, 24, 19, -10, 24, 168, 34314 }, // ł
-    { 28, 35, 30, 1, 35, 245, 34482 }, // Ń
-    { 20, 28, 22, 1, 28, 140, 34727 }, // ń
-    { 28, 36, 30, 1, 25, 252, 34867 }, // Ņ
-    { 18, 28, 22, 1, 17, 126, 35119 }, // ņ
-    { 28, 35, 30, 1, 35, 245, 35245 }, // Ň
-    { 20, 28, 22, 1, 28, 140, 35490 }, // ň
-    { 20, 30, 20, -3, 30, 150, 35630 }, // ŉ
-    { 28, 32, 30, 1, 25, 224, 35780 }, // Ŋ
-    { 18, 22, 22, 1, 17, 99, 36004 }, // ŋ
-    { 28, 33, 31, 2, 32, 231, 36103 }, // Ō
-    { 20, 25, 23, 2, 25, 125, 36334 }, // ō
-    { 28, 36, 31, 2, 35, 252, 36459 }, // Ŏ
-    { 20, 29, 23, 2, 29, 145, 36711 }, // ŏ
-    { 29, 35, 32, 2, 34, 254, 36856 }, // Ő
-    { 23, 27, 26, 2, 27, 156, 37110 }, // ő
-    { 38, 25, 41, 2, 25, 238, 37266 }, // Œ
-    { 30, 17, 33, 2, 17, 128, 37504 }, // œ
-    { 22, 34, 24, 1, 34, 187, 37632 }, // Ŕ
-    { 15, 25, 17, 1, 25, 94, 37819 }, // ŕ
-    { 22, 39, 24, 1, 25, 215, 37913 }, // Ŗ
-    { 18, 32, 17, -2, 17, 144, 38128 }, // ŗ
-    { 22, 34, 24, 1, 34, 187, 38272 }, // Ř
-    { 15, 25, 17, 1, 25, 94, 38459 }, // ř
-    { 25, 38, 29, 1, 37, 238, 38553 }, // Ś
-    { 17, 27, 21, 1, 27, 115, 38791 }, // ś
-    { 26, 35, 29, 1, 34, 228, 38906 }, // Ŝ
-    { 19, 24, 21, 1, 24, 114, 39134 }, // ŝ
-    { 25, 33, 29, 1, 26, 207, 39248 }, // Ş
-    { 17, 24, 21, 1, 16, 102, 39455 }, // ş
-    { 25, 38, 29, 1, 37, 238, 39557 }, // Š
-    { 17, 27, 21, 1, 27, 115, 39795 }, // š
-    { 23, 31, 30, 6, 25, 179, 39910 }, // Ţ
-    { 13, 28, 19, 4, 22, 91, 40089 }, // ţ
-    { 23, 35, 30, 6, 35, 202, 40180 }, // Ť
-    { 17, 25, 22, 4, 25, 107, 40382 }, // ť
-    { 23, 25, 30, 6, 25, 144, 40489 }, // Ŧ
-    { 15, 22, 19, 2, 22, 83, 40633 }, // ŧ
-    { 26, 36, 29, 2, 35, 234, 40716 }, // Ũ
-    { 18, 26, 21, 2, 25, 117, 40950 }, // ũ
-    { 26, 34, 29, 2, 33, 221, 41067 }, // Ū
-    { 19, 24, 22, 2, 23, 114, 41288 }, // ū
-    { 26, 37, 29, 2, 36, 241, 41402 }, // Ŭ
-    { 19, 27, 22, 2, 26, 129, 41643 }, // ŭ
-    { 26, 38, 29, 2, 37, 247, 41772 }, // Ů
-    { 18, 28, 21, 2, 27, 126, 42019 }, // ů
-    { 28, 36, 31, 2, 35, 252, 42145 }, // Ű
-    { 22, 26, 25, 2, 25, 143, 42397 }, // ű
-    { 26, 31, 29, 2, 25, 202, 42540 }, // Ų
-    { 18, 23, 21, 2, 16, 104, 42742 }, // ų
-    { 33, 32, 40, 6, 32, 264, 42846 }, // Ŵ
-    { 23, 24, 29, 5, 24, 138, 43110 }, // ŵ
-    { 21, 33, 29, 7, 33, 174, 43248 }, // Ŷ
-    { 22, 33, 23, 0, 25, 182, 43422 }, // ŷ
-    { 21, 34, 29, 7, 34, 179, 43604 }, // Ÿ
-    { 29, 35, 31, 1, 35, 254, 43783 }, // Ź
-    { 20, 27, 22, 1, 27, 135, 44037 }, // ź
-    { 29, 33, 31, 1, 33, 240, 44172 }, // Ż
-    { 20, 25, 22, 1, 25, 125, 44412 }, // ż
-    { 29, 35, 31, 1, 35, 254, 44537 }, // Ž
-    { 20, 27, 22, 1, 27, 135, 44791 }, // ž
-    { 16, 24, 21, 4, 24, 96, 44926 }, // ſ
-    { 35, 28, 38, 2, 27, 245, 45022 }, // Ơ
-    { 21, 18, 24, 2, 18, 95, 45267 }, // ơ
-    { 23, 25, 25, 1, 25, 144, 45362 }, // Ƥ
-    { 23, 29, 24, -1, 21, 167, 45506 }, // ƥ
-    { 19, 22, 22, 2, 21, 105, 45673 }, // Ʃ
-    { 23, 25, 30, 6, 25, 144, 45778 }, // Ƭ
-    { 15, 26, 20, 4, 26, 98, 45922 }, // ƭ
-    { 23, 31, 30, 6, 25, 179, 46020 }, // Ʈ
-    { 30, 27, 33, 2, 26, 203, 46199 }, // Ư
-    { 21, 19, 24, 2, 18, 100, 46402 }, // ư
-    { 9, 5, 17, 7, 22, 12, 46502 }, // ̀
-    { 7, 6, 14, 6, 23, 11, 46514 }, // ́
-    { 13, 6, 13, -1, 0, 20, 46525 }, // ̂
-    { 13, 6, 19, 5, 22, 20, 46545 }, // ̃
-    { 14, 4, 20, 5, 20, 14, 46565 }, // ̄
-    { 19, 4, 29, 9, 26, 19, 46579 }, // ̅
-    { 13, 6, 20, 6, 21, 20, 46598 }, // ̆
-    { 6, 5, 13, 6, 22, 8, 46618 }, // ̇
-    { 14, 5, 21, 6, 23, 18, 46626 }, // ̈
-    { 7, 6, 13, 5, 19, 11, 46644 }, // ̉
-    { 8, 6, 15, 6, 22, 12, 46655 }, // ̊
-    { 20, 5, 27, 6, 22, 25, 46667 }, // ̋
-    { 12, 6, 19, 6, 22, 18, 46692 }, // ̌
-    { 21, 5, 13, -9, 24, 27, 46710 }, // ̏
-    { 10, 9, 15, 4, 22, 23, 46737 }, // ̒
-    { 10, 9, 15, 4, 22, 23, 46760 }, // ̓
-    { 10, 9, 6, -5, 22, 23, 46783 }, // ̔
-    { 7, 7, 8, 0, -1, 13, 46806 }, // ̘
-    { 7, 7, 10, 2, -1, 13, 46819 }, // ̙
-    { 12, 7, 21, 8, 23, 21, 46832 }, // ̚
-    { 6, 7, 12, 5, 19, 11, 46853 }, // ̛
-    { 5, 6, 6, 0, -2, 8, 46864 }, // ̜
-    { 7, 6, 11, 3, 5, 11, 46872 }, // ̝
-    { 7, 6, 8, 0, -1, 11, 46883 }, // ̞
-    { 7, 7, 8, 0, -2, 13, 46894 }, // ̟
-    { 14, 4, 15, 0, -4, 14, 46907 }, // ̠
-    { 6, 5, 7, 0, 1, 8, 46921 }, // ̣
-    { 15, 5, 15, -1, -1, 19, 46929 }, // ̤
-    { 8, 6, 15, 6, 22, 12, 46948 }, // ̥
-    { 10, 10, 11, 0, 5, 25, 46960 }, // ̦
-    { 8, 8, 9, 0, 1, 16, 46985 }, // ̧
-    { 8, 8, 9, 0, 1, 16, 47001 }, // ̨
-    { 6, 8, 6, -1, -2, 12, 47017 }, // ̩
-    { 11, 5, 12, 0, -1, 14, 47029 }, // ̪
-    { 12, 6, 13, 0, 0, 18, 47043 }, // ̬
-    { 12, 6, 12, -1, -1, 18, 47061 }, // ̭
-    { 13, 6, 19, 5, 22, 20, 47079 }, // ̰
-    { 11, 3, 19, 7, 21, 9, 47099 }, // ̱
-    { 13, 4, 14, 0, -2, 13, 47108 }, // ̲
-    { 13, 6, 19, 5, 22, 20, 47121 }, // ̴
-    { 14, 3, 19, 4, 10, 11, 47141 }, // ̵
-    { 5, 6, 8, 2, -2, 8, 47152 }, // ̹
-    { 11, 5, 10, -2, -1, 14, 47160 }, // ̺
-    { 11, 8, 12, 0, 0, 22, 47174 }, // ̻
-    { 11, 6, 12, 0, 0, 17, 47196 }, // ̼
-    { 8, 6, 15, 6, 22, 12, 47213 }, // ̽
-    { 13, 6, 19, 5, 22, 20, 47225 }, // ͂
-    { 5, 5, 12, 6, 24, 7, 47245 }, // ̓
-    { 14, 13, 21, 6, 31, 46, 47252 }, // ̈́
-    { 10, 5, 18, 7, 23, 13, 47298 }, // ͆
-    { 16, 11, 16, -1, 0, 44, 47311 }, // ͇
-    { 13, 8, 14, 0, 0, 26, 47355 }, // ͈
-    { 10, 7, 11, 0, -2, 18, 47381 }, // ͉
-    { 14, 17, 20, 5, 28, 60, 47399 }, // ͊
-    { 27, 13, 38, 10, 26, 88, 47459 }, // ͋
-    { 20, 14, 27, 6, 15, 70, 47547 }, // ͌
-    { 15, 9, 18, 2, -1, 34, 47617 }, // ͍
-    { 4, 4, 9, 4, 3, 4, 47651 }, // ͎
-    { 24, 6, 26, 1, 0, 36, 47655 }, // ͜
-    { 24, 5, 31, 6, 23, 30, 47691 }, // ͡
-    { 29, 7, 30, 0, -2, 51, 47721 }, // ͢
-    { 23, 25, 29, 1, 25, 144, 47772 }, // Α
-    { 22, 25, 24, 1, 25, 138, 47916 }, // Β
-    { 20, 24, 22, 1, 22, 120, 48054 }, // Γ
-    { 22, 22, 25, 2, 22, 121, 48174 }, // Δ
-    { 23, 25, 25, 1, 25, 144, 48295 }, // Ε
-    { 29, 25, 31, 1, 25, 182, 48439 }, // Ζ
-    { 27, 25, 29, 1, 25, 169, 48621 }, // Η
-    { 28, 26, 31, 2, 25, 182, 48790 }, // Θ
-    { 12, 25, 14, 1, 25, 75, 48972 }, // Ι
-    { 23, 25, 26, 1, 25, 144, 49047 }, // Κ
-    { 24, 25, 30, 1, 25, 150, 49191 }, // Λ
-    { 31, 25, 33, 1, 25, 194, 49341 }, // Μ
-    { 28, 25, 30, 1, 25, 175, 49535 }, // Ν
-    { 23, 21, 26, 2, 21, 121, 49710 }, // Ξ
-    { 28, 26, 31, 2, 25, 182, 49831 }, // Ο
-    { 20, 21, 23, 2, 21, 105, 50013 }, // Π
-    { 23, 25, 25, 1, 25, 144, 50118 }, // Ρ
-    { 19, 22, 22, 2, 21, 105, 50262 }, // Σ
-    { 23, 25, 30, 6, 25, 144, 50367 }, // Τ
-    { 21, 25, 29, 7, 25, 132, 50511 }, // Υ
-    { 34, 30, 38, 3, 27, 255, 50643 }, // Φ
-    { 29, 25, 31, 1, 25, 182, 50898 }, // Χ
-    { 23, 25, 29, 5, 23, 144, 51080 }, // Ψ
-    { 26, 23, 28, 1, 22, 150, 51224 }, // Ω
-    { 23, 19, 27, 1, 18, 110, 51374 }, // α
-    { 21, 34, 22, 0, 28, 179, 51484 }, // β
-    { 15, 25, 22, 6, 16, 94, 51663 }, // γ
-    { 19, 25, 23, 3, 25, 119, 51757 }, // δ
-    { 13, 15, 16, 2, 15, 49, 51876 }, // ε
-    { 17, 25, 21, 3, 21, 107, 51925 }, // ζ
-    { 18, 27, 23, 4, 19, 122, 52032 }, // η
-    { 19, 22, 23, 3, 22, 105, 52154 }, // θ
-    { 9, 19, 15, 1, 19, 43, 52259 }, // ι
-    { 16, 18, 18, 0, 18, 72, 52302 }, // κ
-    { 22, 24, 23, -10, 24, 132, 52374 }, // λ
-    { 21, 19, 21, -1, 16, 100, 52506 }, // μ
-    { 15, 17, 22, 6, 17, 64, 52606 }, // ν
-    { 16, 25, 20, 3, 21, 100, 52670 }, // ξ
-    { 18, 16, 22, 2, 16, 72, 52770 }, // ο
-    { 19, 16, 24, 4, 15, 76, 52842 }, // π
-    { 23, 23, 24, 0, 16, 133, 52918 }, // ρ
-    { 14, 20, 20, 5, 21, 70, 53051 }, // ς
-    { 26, 16, 29, 2, 16, 104, 53121 }, // σ
-    { 16, 16, 22, 5, 15, 64, 53225 }, // τ
-    { 15, 17, 19, 3, 16, 64, 53289 }, // υ
-    { 28, 36, 31, 2, 32, 252, 53353 }, // φ
-    { 25, 22, 26, 0, 16, 138, 53605 }, // χ
-    { 17, 28, 21, 3, 21, 119, 53743 }, // ψ
-    { 22, 16, 26, 2, 15, 88, 53862 }, // ω
-    { 23, 34, 29, 1, 25, 196, 53950 }, // Ạ
-    { 18, 26, 22, 1, 18, 117, 54146 }, // ạ
-    { 25, 37, 29, 1, 37, 232, 54263 }, // Ả
-    { 18, 26, 22, 1, 26, 117, 54495 }, // ả
-    { 30, 41, 32, 1, 41, 308, 54612 }, // Ấ
-    { 29, 32, 31, 1, 32, 232, 54920 }, // ấ
-    { 25, 37, 29, 1, 37, 232, 55152 }, // Ầ
-    { 20, 28, 22, 1, 28, 140, 55384 }, // ầ
-    { 30, 41, 32, 1, 41, 308, 55524 }, // Ẩ
-    { 20, 30, 22, 1, 30, 150, 55832 }, // ẩ
-    { 24, 40, 29, 1, 40, 240, 55982 }, // Ẫ
-    { 18, 30, 22, 1, 30, 135, 56222 }, // ẫ
-    { 25, 41, 29, 1, 32, 257, 56357 }, // Ậ
-    { 18, 30, 22, 1, 22, 135, 56614 }, // ậ
-    { 26, 47, 29, 1, 47, 306, 56749 }, // Ắ
-    { 20, 37, 22, 1, 37, 185, 57055 }, // ắ
-    { 26, 44, 29, 1, 44, 286, 57240 }, // Ằ
-    { 20, 34, 22, 1, 34, 170, 57526 }, // ằ
-    { 26, 46, 29, 1, 46, 299, 57696 }, // Ẳ
-    { 20, 38, 22, 1, 38, 190, 57995 }, // ẳ
-    { 26, 45, 29, 1, 45, 293, 58185 }, // Ẵ
-    { 20, 35, 22, 1, 35, 175, 58478 }, // ẵ
-    { 26, 45, 29, 1, 36, 293, 58653 }, // Ặ
-    { 20, 34, 22, 1, 26, 170, 58946 }, // ặ
-    { 23, 32, 25, 1, 25, 184, 59116 }, // Ẹ
-    { 18, 25, 22, 2, 17, 113, 59300 }, // ẹ
-    { 23, 36, 25, 1, 36, 207, 59413 }, // Ẻ
-    { 18, 30, 22, 2, 30, 135, 59620 }, // ẻ
-    { 23, 34, 25, 1, 34, 196, 59755 }, // Ẽ
-    { 19, 28, 22, 2, 28, 133, 59951 }, // ẽ
-    { 23, 39, 25, 1, 39, 225, 60084 }, // Ế
-    { 28, 30, 31, 2, 30, 210, 60309 }, // ế
-    { 23, 37, 25, 1, 37, 213, 60519 }, // Ề
-    { 19, 31, 22, 2, 31, 148, 60732 }, // ề
-    { 23, 39, 25, 1, 39, 225, 60880 }, // Ể
-    { 21, 34, 24, 2, 34, 179, 61105 }, // ể
-    { 23, 40, 25, 1, 40, 230, 61284 }, // Ễ
-    { 18, 34, 22, 2, 34, 153, 61514 }, // ễ
-    { 23, 39, 25, 1, 32, 225, 61667 }, // Ệ
-    { 21, 36, 24, 2, 28, 189, 61892 }, // ệ
-    { 16, 38, 18, 1, 38, 152, 62081 }, // Ỉ
-    { 13, 27, 15, 1, 27, 88, 62233 }, // ỉ
-    { 14, 32, 14, -1, 25, 112, 62321 }, // Ị
-    { 13, 33, 13, -1, 26, 108, 62433 }, // ị
-    { 28, 34, 31, 2, 25, 238, 62541 }, // Ọ
-    { 18, 25, 22, 2, 16, 113, 62779 }, // ọ
-    { 28, 37, 31, 2, 36, 259, 62892 }, // Ỏ
-    { 18, 29, 22, 2, 29, 131, 63151 }, // ỏ
-    { 34, 33, 37, 2, 32, 281, 63282 }, // Ố
-    { 29, 27, 32, 2, 27, 196, 63563 }, // ố
-    { 28, 39, 31, 2, 38, 273, 63759 }, // Ồ
-    { 19, 30, 22, 2, 30, 143, 64032 }, // ồ
-    { 34, 39, 37, 2, 38, 332, 64175 }, // Ổ
-    { 20, 33, 23, 2, 33, 165, 64507 }, // ổ
-    { 28, 41, 31, 2, 40, 287, 64672 }, // Ỗ
-    { 18, 33, 22, 2, 33, 149, 64959 }, // ỗ
-    { 28, 41, 31, 2, 32, 287, 65108 }, // Ộ
-    { 19, 33, 22, 2, 25, 157, 65395 }, // ộ
-    { 35, 37, 38, 2, 36, 324, 65552 }, // Ớ
-    { 21, 29, 24, 2, 29, 153, 65876 }, // ớ
-    { 35, 35, 38, 2, 34, 307, 66029 }, // Ờ
-    { 21, 27, 24, 2, 27, 142, 66336 }, // ờ
-    { 35, 37, 38, 2, 36, 324, 66478 }, // Ở
-    { 21, 29, 24, 2, 29, 153, 66802 }, // ở
-    { 35, 36, 38, 2, 35, 315, 66955 }, // Ỡ
-    { 21, 27, 24, 2, 27, 142, 67270 }, // ỡ
-    { 35, 36, 38, 2, 27, 315, 67412 }, // Ợ
-    { 21, 27, 24, 2, 18, 142, 67727 }, // ợ
-    { 26, 33, 29, 2, 25, 215, 67869 }, // Ụ
-    { 18, 24, 21, 2, 16, 108, 68084 }, // ụ
-    { 26, 37, 29, 2, 36, 241, 68192 }, // Ủ
-    { 18, 28, 21, 2, 27, 126, 68433 }, // ủ
-    { 30, 38, 33, 2, 37, 285, 68559 }, // Ứ
-    { 21, 28, 24, 2, 27, 147, 68844 }, // ứ
-    { 30, 36, 33, 2, 35, 270, 68991 }, // Ừ
-    { 21, 26, 24, 2, 25, 137, 69261 }, // ừ
-    { 30, 37, 33, 2, 36, 278, 69398 }, // Ử
-    { 21, 28, 24, 2, 27, 147, 69676 }, // ử
-    { 30, 36, 33, 2, 35, 270, 69823 }, // Ữ
-    { 21, 26, 24, 2, 25, 137, 70093 }, // ữ
-    { 30, 34, 33, 2, 26, 255, 70230 }, // Ự
-    { 21, 26, 24, 2, 18, 137, 70485 }, // ự
-    { 21, 34, 29, 7, 34, 179, 70622 }, // Ỳ
-    { 22, 34, 23, 0, 26, 187, 70801 }, // ỳ
-    { 24, 38, 29, 4, 25, 228, 70988 }, // Ỵ
-    { 22, 25, 23, 0, 16, 138, 71216 }, // ỵ
-    { 21, 37, 29, 7, 37, 195, 71354 }, // Ỷ
-    { 22, 37, 23, 0, 29, 204, 71549 }, // ỷ
-    { 21, 35, 29, 7, 35, 184, 71753 }, // Ỹ
-    { 22, 36, 23, 0, 28, 198, 71937 }, // ỹ
-    { 0, 0, 24, 0, 0, 0, 72135 }, //  
-    { 0, 0, 39, 0, 0, 0, 72135 }, //  
-    { 0, 0, 24, 0, 0, 0, 72135 }, //  
-    { 0, 0, 39, 0, 0, 0, 72135 }, //  
-    { 0, 0, 19, 0, 0, 0, 72135 }, //  
-    { 0, 0, 17, 0, 0, 0, 72135 }, //  
-    { 0, 0, 14, 0, 0, 0, 72135 }, //  
-    { 0, 0, 19, 0, 0, 0, 72135 }, //  
-    { 0, 0, 8, 0, 0, 0, 72135 }, //  
-    { 0, 0, 15, 0, 0, 0, 72135 }, //  
-    { 0, 0, 14, 0, 0, 0, 72135 }, //  
-    { 0, 0, 9, 0, 0, 0, 72135 }, // ​
-    { 0, 0, 1, 0, 0, 0, 72135 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 72135 }, // ‍
-    { 0, 0, 1, 0, 0, 0, 72135 }, // ‎
-    { 0, 0, 1, 0, 0, 0, 72135 }, // ‏
-    { 14, 3, 19, 4, 10, 11, 72135 }, // ‐
-    { 14, 3, 19, 4, 10, 11, 72146 }, // ‑
-    { 21, 3, 27, 5, 10, 16, 72157 }, // ‒
-    { 20, 4, 25, 4, 10, 20, 72173 }, // –
-    { 30, 4, 35, 4, 10, 30, 72193 }, // —
-    { 30, 4, 35, 4, 10, 30, 72223 }, // ―
-    { 19, 25, 21, 1, 21, 119, 72253 }, // ‖
-    { 24, 9, 25, 0, -3, 54, 72372 }, // ‗
-    { 9, 9, 16, 6, 25, 21, 72426 }, // ‘
-    { 10, 9, 16, 5, 25, 23, 72447 }, // ’
-    { 10, 10, 11, 0, 5, 25, 72470 }, // ‚
-    { 9, 9, 16, 6, 25, 21, 72495 }, // ‛
-    { 16, 9, 23, 6, 25, 36, 72516 }, // “
-    { 17, 9, 23, 5, 25, 39, 72552 }, // ”
-    { 10, 10, 11, 0, 5, 25, 72591 }, // „
-    { 17, 9, 24, 6, 25, 39, 72616 }, // ‟
-    { 16, 38, 22, 5, 30, 152, 72655 }, // †
-    { 19, 38, 22, 2, 30, 181, 72807 }, // ‡
-    { 19, 17, 20, 0, 20, 81, 72988 }, // •
-    { 9, 9, 13, 3, 13, 21, 73069 }, // ‣
-    { 6, 5, 8, 1, 5, 8, 73090 }, // ․
-    { 6, 5, 8, 1, 5, 8, 73098 }, // ‥
-    { 26, 5, 28, 1, 5, 33, 73106 }, // …
-    { 5, 3, 8, 2, 10, 4, 73139 }, // ‧
-    { 0, 0, 37, 0, 0, 0, 73143 }, //  
-    { 24, 25, 32, 7, 23, 150, 73143 }, // ‰
-    { 10, 9, 16, 5, 25, 23, 73293 }, // ′
-    { 17, 9, 23, 5, 25, 39, 73316 }, // ″
-    { 21, 9, 25, -3, 25, 48, 73355 }, // ‴
-    { 6, 9, 14, 7, 24, 14, 73403 }, // ‵
-    { 12, 9, 19, 6, 24, 27, 73417 }, // ‶
-    { 21, 9, 29, 7, 25, 48, 73444 }, // ‷
-    { 12, 5, 20, 7, 23, 15, 73492 }, // ‸
-    { 10, 14, 15, 4, 15, 35, 73507 }, // ‹
-    { 10, 14, 12, -2, 15, 35, 73542 }, // ›
-    { 37, 29, 39, 1, 26, 269, 73577 }, // ※
-    { 14, 29, 16, 1, 29, 102, 73846 }, // ‼
-    { 20, 37, 26, 5, 35, 185, 73948 }, // ‽
-    { 15, 4, 23, 7, 24, 15, 74133 }, // ‾
-    { 13, 6, 20, 6, 20, 20, 74148 }, // ‿
-    { 20, 18, 26, 5, 25, 90, 74168 }, // ⁂
-    { 24, 24, 32, 7, 22, 144, 74258 }, // ⁄
-    { 35, 33, 43, 7, 33, 289, 74402 }, // ⁇
-    { 25, 33, 33, 7, 33, 207, 74691 }, // ⁈
-    { 30, 35, 31, 0, 33, 263, 74898 }, // ⁉
-    { 29, 46, 29, -1, 32, 334, 75161 }, // ⁒
-    { 0, 0, 141, 0, 0, 0, 75495 }, //  
-    { 10, 11, 14, 3, 24, 28, 75495 }, // ⁰
-    { 8, 11, 13, 4, 24, 22, 75523 }, // ⁴
-    { 10, 12, 14, 3, 25, 30, 75545 }, // ⁵
-    { 9, 11, 14, 4, 24, 25, 75575 }, // ⁶
-    { 8, 13, 15, 6, 25, 26, 75600 }, // ⁷
-    { 10, 11, 14, 3, 24, 28, 75626 }, // ⁸
-    { 10, 11, 15, 4, 24, 28, 75654 }, // ⁹
-    { 18, 17, 22, 1, 17, 77, 75682 }, // ⁿ
-    { 14, 15, 16, 1, 15, 53, 75759 }, // ₀
-    { 8, 12, 9, -2, 7, 24, 75812 }, // ₁
-    { 11, 12, 10, -2, 7, 33, 75836 }, // ₂
-    { 10, 11, 10, -1, 6, 28, 75869 }, // ₃
-    { 9, 11, 10, -1, 6, 25, 75897 }, // ₄
-    { 9, 12, 9, -1, 7, 27, 75922 }, // ₅
-    { 10, 12, 10, -1, 7, 30, 75949 }, // ₆
-    { 8, 12, 10, 1, 7, 24, 75979 }, // ₇
-    { 11, 11, 10, -2, 6, 31, 76003 }, // ₈
-    { 10, 11, 10, -1, 6, 28, 76034 }, // ₉
-    { 17, 40, 21, 3, 30, 170, 76062 }, // ₍
-    { 16, 40, 13, -7, 30, 160, 76232 }, // ₎
-    { 28, 37, 29, 0, 31, 259, 76392 }, // ₡
-    { 25, 27, 27, 1, 26, 169, 76651 }, // ₢
-    { 23, 27, 25, 1, 27, 156, 76820 }, // ₤
-    { 30, 25, 31, 0, 25, 188, 76976 }, // ₦
-    { 25, 25, 27, 1, 25, 157, 77164 }, // ₧
-    { 33, 24, 34, 0, 24, 198, 77321 }, // ₨
-    { 24, 24, 24, -1, 24, 144, 77519 }, // ₩
-    { 27, 23, 33, 5, 23, 156, 77663 }, // ₪
-    { 22, 23, 25, 2, 23, 127, 77819 }, // ₫
-    { 22, 26, 26, 3, 23, 143, 77946 }, // €
-    { 23, 25, 30, 6, 25, 144, 78089 }, // ₮
-    { 28, 25, 30, 1, 25, 175, 78233 }, // ₱
-    { 25, 34, 29, 2, 30, 213, 78408 }, // ₲
-    { 32, 27, 36, 3, 26, 216, 78621 }, // ₴
-    { 15, 23, 20, 2, 21, 87, 78837 }, // ₵
-    { 26, 26, 33, 6, 26, 169, 78924 }, // ₸
-    { 17, 22, 22, 4, 22, 94, 79093 }, // ₹
-    { 17, 21, 21, 3, 20, 90, 79187 }, // ₺
-    { 21, 23, 24, 2, 23, 121, 79277 }, // ₼
-    { 27, 25, 25, -3, 25, 169, 79398 }, // ₽
-    { 18, 18, 22, -3, 14, 81, 79567 }, // ←
-    { 19, 18, 24, 4, 18, 86, 79648 }, // ↑
-    { 18, 18, 26, 7, 14, 81, 79734 }, // →
-    { 19, 18, 29, 9, 18, 86, 79815 }, // ↓
-    { 31, 15, 30, -2, 13, 117, 79901 }, // ↔
-    { 15, 30, 20, 4, 28, 113, 80018 }, // ↕
-    { 17, 13, 19, -3, 13, 56, 80131 }, // ↖
-    { 18, 13, 23, 4, 13, 59, 80187 }, // ↗
-    { 14, 18, 22, 7, 16, 63, 80246 }, // ↘
-    { 14, 18, 19, -2, 16, 63, 80309 }, // ↙
-    { 22, 19, 25, 0, 18, 105, 80372 }, // ⇐
-    { 23, 21, 29, 5, 21, 121, 80477 }, // ⇑
-    { 22, 19, 26, 3, 18, 105, 80598 }, // ⇒
-    { 23, 22, 34, 10, 21, 127, 80703 }, // ⇓
-    { 29, 19, 30, 0, 18, 138, 80830 }, // ⇔
-    { 18, 28, 26, 7, 18, 126, 80968 }, // ⇕
-    { 21, 23, 25, 3, 23, 121, 81094 }, // ∂
-    { 30, 27, 31, 0, 26, 203, 81215 }, // ∅
-    { 22, 22, 25, 2, 22, 121, 81418 }, // ∆
-    { 21, 21, 26, 4, 21, 111, 81539 }, // ∏
-    { 21, 21, 32, 10, 21, 111, 81650 }, // ∐
-    { 19, 22, 22, 2, 21, 105, 81761 }, // ∑
-    { 14, 4, 19, 4, 10, 14, 81866 }, // −
-    { 28, 25, 32, 3, 23, 175, 81880 }, // √
-    { 26, 15, 30, 3, 18, 98, 82055 }, // ∞
-    { 31, 33, 32, 0, 26, 256, 82153 }, // ∫
-    { 10, 18, 12, 1, 18, 45, 82409 }, // ∶
-    { 20, 14, 27, 6, 15, 70, 82454 }, // ≈
-    { 24, 24, 32, 7, 22, 144, 82524 }, // ≠
-    { 25, 22, 25, -1, 20, 138, 82668 }, // ≤
-    { 26, 22, 28, 1, 20, 143, 82806 }, // ≥
+    { 14, 29, 16, 1, 29, 58, 0 }, // !
+    { 15, 9, 22, 6, 25, 26, 58 }, // "
+    { 33, 25, 37, 3, 23, 117, 84 }, // #
+    { 26, 31, 31, 2, 27, 130, 201 }, // $
+    { 24, 25, 32, 7, 23, 97, 331 }, // %
+    { 24, 26, 29, 4, 25, 100, 428 }, // &
+    { 7, 9, 13, 5, 22, 13, 528 }, // '
+    { 17, 40, 21, 3, 30, 84, 541 }, // (
+    { 16, 40, 13, -7, 30, 79, 625 }, // )
+    { 15, 14, 22, 6, 22, 45, 704 }, // *
+    { 15, 14, 20, 4, 15, 31, 749 }, // +
+    { 10, 10, 11, 0, 5, 14, 780 }, // ,
+    { 14, 3, 19, 4, 10, 8, 794 }, // -
+    { 6, 5, 8, 1, 5, 9, 802 }, // .
+    { 29, 45, 26, -4, 32, 134, 811 }, // /
+    { 19, 22, 23, 3, 22, 80, 945 }, // 0
+    { 14, 22, 17, 2, 22, 48, 1025 }, // 1
+    { 20, 22, 23, 2, 22, 59, 1073 }, // 2
+    { 20, 22, 23, 2, 22, 63, 1132 }, // 3
+    { 16, 22, 21, 4, 22, 59, 1195 }, // 4
+    { 19, 23, 22, 2, 23, 56, 1254 }, // 5
+    { 19, 22, 23, 3, 22, 64, 1310 }, // 6
+    { 15, 22, 23, 7, 22, 47, 1374 }, // 7
+    { 20, 22, 23, 2, 22, 72, 1421 }, // 8
+    { 19, 22, 23, 3, 22, 64, 1493 }, // 9
+    { 10, 18, 12, 1, 18, 24, 1557 }, // :
+    { 12, 22, 13, 0, 17, 29, 1581 }, // ;
+    { 22, 17, 23, -1, 18, 52, 1610 }, // <
+    { 16, 10, 20, 3, 13, 22, 1662 }, // =
+    { 22, 17, 25, 2, 18, 52, 1684 }, // >
+    { 18, 33, 24, 5, 33, 71, 1736 }, // ?
+    { 29, 25, 35, 4, 23, 115, 1807 }, // @
+    { 23, 25, 29, 1, 25, 81, 1922 }, // A
+    { 22, 25, 24, 1, 25, 86, 2003 }, // B
+    { 25, 27, 27, 1, 26, 86, 2089 }, // C
+    { 25, 25, 28, 1, 25, 91, 2175 }, // D
+    { 23, 25, 25, 1, 25, 75, 2266 }, // E
+    { 21, 25, 23, 1, 25, 66, 2341 }, // F
+    { 25, 26, 29, 2, 26, 91, 2407 }, // G
+    { 27, 25, 29, 1, 25, 96, 2498 }, // H
+    { 12, 25, 14, 1, 25, 40, 2594 }, // I
+    { 21, 33, 21, -1, 26, 77, 2634 }, // J
+    { 23, 25, 26, 1, 25, 85, 2711 }, // K
+    { 18, 25, 22, 1, 25, 58, 2796 }, // L
+    { 31, 25, 33, 1, 25, 133, 2854 }, // M
+    { 28, 25, 30, 1, 25, 108, 2987 }, // N
+    { 28, 26, 31, 2, 25, 97, 3095 }, // O
+    { 23, 25, 25, 1, 25, 77, 3192 }, // P
+    { 29, 29, 31, 1, 25, 106, 3269 }, // Q
+    { 22, 25, 24, 1, 25, 87, 3375 }, // R
+    { 25, 27, 29, 1, 26, 93, 3462 }, // S
+    { 23, 25, 30, 6, 25, 72, 3555 }, // T
+    { 26, 26, 29, 2, 25, 94, 3627 }, // U
+    { 24, 25, 32, 7, 25, 83, 3721 }, // V
+    { 33, 25, 40, 6, 25, 124, 3804 }, // W
+    { 29, 25, 31, 1, 25, 98, 3928 }, // X
+    { 21, 25, 29, 7, 25, 71, 4026 }, // Y
+    { 29, 25, 31, 1, 25, 86, 4097 }, // Z
+    { 21, 41, 21, -1, 31, 106, 4183 }, // [
+    { 5, 28, 14, 7, 23, 41, 4289 }, // <backslash>
+    { 20, 41, 15, -6, 31, 98, 4330 }, // ]
+    { 13, 6, 19, 5, 26, 16, 4428 }, // ^
+    { 21, 4, 23, 0, -2, 18, 4444 }, // _
+    { 9, 5, 17, 7, 22, 8, 4462 }, // `
+    { 18, 18, 22, 1, 18, 55, 4470 }, // a
+    { 18, 26, 23, 3, 25, 72, 4525 }, // b
+    { 15, 18, 20, 2, 17, 42, 4597 }, // c
+    { 23, 26, 25, 1, 25, 79, 4639 }, // d
+    { 18, 17, 22, 2, 17, 51, 4718 }, // e
+    { 14, 24, 18, 3, 24, 51, 4769 }, // f
+    { 21, 24, 22, 0, 16, 74, 4820 }, // g
+    { 19, 25, 22, 1, 25, 66, 4894 }, // h
+    { 11, 26, 13, 1, 26, 38, 4960 }, // i
+    { 19, 32, 22, 2, 25, 65, 4998 }, // j
+    { 16, 24, 22, 1, 24, 60, 5063 }, // k
+    { 11, 24, 14, 1, 24, 40, 5123 }, // l
+    { 29, 16, 32, 1, 16, 74, 5163 }, // m
+    { 18, 17, 22, 1, 17, 52, 5237 }, // n
+    { 18, 16, 22, 2, 16, 49, 5289 }, // o
+    { 23, 24, 24, -1, 16, 79, 5338 }, // p
+    { 20, 25, 26, 2, 18, 78, 5417 }, // q
+    { 15, 17, 17, 1, 17, 38, 5495 }, // r
+    { 17, 16, 21, 1, 16, 45, 5533 }, // s
+    { 13, 22, 19, 4, 22, 45, 5578 }, // t
+    { 18, 17, 21, 2, 16, 52, 5623 }, // u
+    { 18, 16, 24, 5, 16, 50, 5675 }, // v
+    { 23, 16, 29, 5, 16, 65, 5725 }, // w
+    { 22, 16, 24, 1, 16, 51, 5790 }, // x
+    { 22, 24, 23, 0, 16, 70, 5841 }, // y
+    { 20, 16, 22, 1, 16, 42, 5911 }, // z
+    { 16, 27, 21, 4, 22, 59, 5953 }, // {
+    { 10, 25, 12, 1, 21, 39, 6012 }, // |
+    { 16, 27, 18, 0, 22, 60, 6051 }, // }
+    { 13, 6, 19, 5, 22, 20, 6111 }, // ~
+    { 0, 0, 25, 0, 0, 0, 6131 }, //  
+    { 11, 29, 15, 3, 22, 45, 6131 }, // ¡
+    { 15, 25, 20, 2, 22, 64, 6176 }, // ¢
+    { 23, 27, 25, 1, 27, 81, 6240 }, // £
+    { 18, 15, 22, 3, 18, 50, 6321 }, // ¤
+    { 22, 24, 27, 4, 22, 72, 6371 }, // ¥
+    { 10, 25, 12, 1, 21, 35, 6443 }, // ¦
+    { 23, 25, 25, 1, 22, 82, 6478 }, // §
+    { 14, 5, 21, 6, 23, 16, 6560 }, // ¨
+    { 13, 11, 21, 7, 26, 37, 6576 }, // ©
+    { 10, 10, 16, 5, 22, 26, 6613 }, // ª
+    { 19, 14, 24, 3, 14, 43, 6639 }, // «
+    { 14, 9, 19, 4, 10, 23, 6682 }, // ¬
+    { 14, 3, 19, 4, 10, 8, 6705 }, // ­
+    { 13, 11, 22, 8, 31, 41, 6713 }, // ®
+    { 11, 3, 19, 7, 21, 9, 6754 }, // ¯
+    { 15, 14, 21, 5, 23, 34, 6763 }, // °
+    { 17, 17, 21, 1, 16, 44, 6797 }, // ±
+    { 10, 11, 14, 3, 24, 19, 6841 }, // ²
+    { 10, 11, 14, 3, 23, 20, 6860 }, // ³
+    { 7, 6, 14, 6, 23, 11, 6880 }, // ´
+    { 21, 19, 21, -1, 16, 61, 6891 }, // µ
+    { 20, 24, 22, 1, 21, 80, 6952 }, // ¶
+    { 6, 5, 10, 3, 12, 9, 7032 }, // ·
+    { 8, 8, 10, 0, 1, 13, 7041 }, // ¸
+    { 8, 11, 12, 3, 24, 18, 7054 }, // ¹
+    { 10, 9, 16, 5, 21, 24, 7072 }, // º
+    { 20, 14, 19, -4, 14, 44, 7096 }, // »
+    { 24, 28, 32, 7, 26, 106, 7140 }, // ¼
+    { 25, 27, 33, 7, 25, 111, 7246 }, // ½
+    { 25, 27, 32, 6, 25, 111, 7357 }, // ¾
+    { 19, 32, 18, -2, 17, 70, 7468 }, // ¿
+    { 23, 33, 29, 1, 33, 98, 7538 }, // À
+    { 25, 38, 29, 1, 38, 112, 7636 }, // Á
+    { 25, 32, 29, 1, 32, 106, 7748 }, // Â
+    { 26, 33, 29, 1, 33, 110, 7854 }, // Ã
+    { 27, 33, 29, 1, 33, 110, 7964 }, // Ä
+    { 24, 35, 29, 1, 35, 109, 8074 }, // Å
+    { 38, 26, 42, 1, 25, 126, 8183 }, // Æ
+    { 25, 33, 27, 1, 26, 103, 8309 }, // Ç
+    { 23, 32, 25, 1, 32, 90, 8412 }, // È
+    { 23, 38, 25, 1, 38, 101, 8502 }, // É
+    { 23, 32, 25, 1, 32, 97, 8603 }, // Ê
+    { 24, 33, 26, 1, 33, 98, 8700 }, // Ë
+    { 14, 35, 16, 1, 35, 66, 8798 }, // Ì
+    { 17, 40, 19, 1, 40, 74, 8864 }, // Í
+    { 16, 34, 18, 1, 34, 72, 8938 }, // Î
+    { 18, 35, 20, 1, 35, 74, 9010 }, // Ï
+    { 26, 25, 28, 0, 25, 95, 9084 }, // Ð
+    { 28, 32, 30, 1, 32, 138, 9179 }, // Ñ
+    { 28, 34, 31, 2, 33, 117, 9317 }, // Ò
+    { 28, 39, 31, 2, 38, 126, 9434 }, // Ó
+    { 28, 33, 31, 2, 32, 118, 9560 }, // Ô
+    { 28, 34, 31, 2, 33, 123, 9678 }, // Õ
+    { 28, 34, 31, 2, 33, 120, 9801 }, // Ö
+    { 14, 8, 18, 3, 11, 23, 9921 }, // ×
+    { 50, 49, 41, -10, 37, 248, 9944 }, // Ø
+    { 26, 35, 29, 2, 34, 114, 10192 }, // Ù
+    { 26, 39, 29, 2, 38, 125, 10306 }, // Ú
+    { 26, 33, 29, 2, 32, 119, 10431 }, // Û
+    { 26, 35, 29, 2, 34, 120, 10550 }, // Ü
+    { 21, 39, 29, 7, 39, 97, 10670 }, // Ý
+    { 19, 23, 21, 1, 23, 64, 10767 }, // Þ
+    { 20, 23, 23, 2, 23, 80, 10831 }, // ß
+    { 18, 24, 22, 1, 24, 66, 10911 }, // à
+    { 18, 28, 22, 1, 28, 72, 10977 }, // á
+    { 20, 24, 22, 1, 24, 74, 11049 }, // â
+    { 19, 23, 22, 1, 23, 74, 11123 }, // ã
+    { 20, 24, 22, 1, 24, 72, 11197 }, // ä
+    { 18, 26, 22, 1, 26, 77, 11269 }, // å
+    { 30, 18, 36, 1, 18, 86, 11346 }, // æ
+    { 15, 24, 20, 2, 17, 56, 11432 }, // ç
+    { 18, 27, 22, 2, 27, 65, 11488 }, // è
+    { 19, 32, 22, 2, 32, 75, 11553 }, // é
+    { 19, 26, 22, 2, 26, 73, 11628 }, // ê
+    { 20, 27, 23, 2, 27, 74, 11701 }, // ë
+    { 11, 24, 13, 1, 24, 36, 11775 }, // ì
+    { 14, 29, 16, 1, 29, 51, 11811 }, // í
+    { 14, 23, 16, 1, 23, 49, 11862 }, // î
+    { 15, 25, 17, 1, 25, 50, 11911 }, // ï
+    { 25, 23, 29, 3, 23, 79, 11961 }, // ð
+    { 21, 25, 23, 1, 25, 76, 12040 }, // ñ
+    { 18, 26, 22, 2, 26, 66, 12116 }, // ò
+    { 19, 31, 22, 2, 31, 73, 12182 }, // ó
+    { 19, 25, 22, 2, 25, 70, 12255 }, // ô
+    { 19, 26, 22, 2, 26, 75, 12325 }, // õ
+    { 20, 26, 23, 2, 26, 73, 12400 }, // ö
+    { 19, 18, 24, 4, 18, 39, 12473 }, // ÷
+    { 29, 45, 26, -4, 30, 155, 12512 }, // ø
+    { 18, 25, 21, 2, 24, 67, 12667 }, // ù
+    { 18, 30, 21, 2, 29, 72, 12734 }, // ú
+    { 18, 24, 21, 2, 23, 71, 12806 }, // û
+    { 19, 25, 22, 2, 24, 71, 12877 }, // ü
+    { 22, 39, 23, 0, 31, 98, 12948 }, // ý
+    { 18, 30, 20, 1, 24, 76, 13046 }, // þ
+    { 23, 35, 24, 0, 27, 98, 13122 }, // ÿ
+    { 26, 32, 29, 1, 32, 101, 13220 }, // Ā
+    { 20, 22, 22, 1, 22, 64, 13321 }, // ā
+    { 26, 36, 29, 1, 36, 112, 13385 }, // Ă
+    { 20, 26, 22, 1, 26, 78, 13497 }, // ă
+    { 23, 32, 29, 1, 25, 98, 13575 }, // Ą
+    { 18, 23, 22, 1, 18, 65, 13673 }, // ą
+    { 25, 39, 27, 1, 38, 111, 13738 }, // Ć
+    { 17, 28, 20, 2, 27, 60, 13849 }, // ć
+    { 26, 37, 28, 1, 36, 113, 13909 }, // Ĉ
+    { 19, 25, 22, 2, 24, 64, 14022 }, // ĉ
+    { 25, 37, 27, 1, 36, 106, 14086 }, // Ċ
+    { 15, 26, 20, 2, 25, 55, 14192 }, // ċ
+    { 25, 39, 27, 1, 38, 113, 14247 }, // Č
+    { 17, 27, 20, 2, 26, 64, 14360 }, // č
+    { 25, 36, 28, 1, 36, 119, 14424 }, // Ď
+    { 28, 26, 30, 1, 25, 97, 14543 }, // ď
+    { 26, 25, 28, 0, 25, 95, 14640 }, // Đ
+    { 27, 26, 29, 1, 25, 88, 14735 }, // đ
+    { 23, 32, 25, 1, 32, 92, 14823 }, // Ē
+    { 20, 26, 23, 2, 26, 68, 14915 }, // ē
+    { 23, 35, 25, 1, 35, 102, 14983 }, // Ĕ
+    { 20, 30, 23, 2, 30, 80, 15085 }, // ĕ
+    { 23, 34, 25, 1, 34, 93, 15165 }, // Ė
+    { 18, 28, 22, 2, 28, 68, 15258 }, // ė
+    { 23, 31, 25, 1, 25, 90, 15326 }, // Ę
+    { 18, 24, 22, 2, 17, 65, 15416 }, // ę
+    { 23, 35, 25, 1, 35, 102, 15481 }, // Ě
+    { 19, 30, 22, 2, 30, 78, 15583 }, // ě
+    { 26, 34, 29, 2, 34, 117, 15661 }, // Ĝ
+    { 22, 32, 23, 0, 24, 97, 15778 }, // ĝ
+    { 26, 36, 29, 2, 36, 122, 15875 }, // Ğ
+    { 21, 34, 22, 0, 26, 99, 15997 }, // ğ
+    { 25, 34, 29, 2, 34, 109, 16096 }, // Ġ
+    { 21, 33, 22, 0, 25, 90, 16205 }, // ġ
+    { 25, 39, 29, 2, 26, 119, 16295 }, // Ģ
+    { 21, 35, 22, 0, 27, 96, 16414 }, // ģ
+    { 27, 33, 29, 1, 33, 121, 16510 }, // Ĥ
+    { 19, 31, 22, 1, 31, 84, 16631 }, // ĥ
+    { 27, 24, 29, 1, 24, 99, 16715 }, // Ħ
+    { 19, 25, 22, 1, 25, 71, 16814 }, // ħ
+    { 17, 36, 19, 1, 36, 75, 16885 }, // Ĩ
+    { 14, 25, 16, 1, 25, 55, 16960 }, // ĩ
+    { 18, 34, 20, 1, 34, 69, 17015 }, // Ī
+    { 15, 23, 17, 1, 23, 45, 17084 }, // ī
+    { 14, 31, 18, 3, 25, 65, 17129 }, // Į
+    { 13, 32, 13, -1, 26, 59, 17194 }, // į
+    { 14, 36, 16, 1, 36, 66, 17253 }, // İ
+    { 8, 17, 11, 1, 17, 25, 17319 }, // ı
+    { 23, 32, 27, 1, 25, 98, 17344 }, // Ĳ
+    { 27, 34, 29, 1, 26, 106, 17442 }, // ĳ
+    { 24, 40, 24, -1, 33, 107, 17548 }, // Ĵ
+    { 24, 31, 27, 2, 24, 81, 17655 }, // ĵ
+    { 23, 36, 26, 1, 25, 110, 17736 }, // Ķ
+    { 16, 38, 22, 1, 24, 82, 17846 }, // ķ
+    { 14, 16, 16, 0, 16, 45, 17928 }, // ĸ
+    { 18, 35, 22, 1, 35, 75, 17973 }, // Ĺ
+    { 16, 34, 18, 1, 34, 68, 18048 }, // ĺ
+    { 18, 38, 22, 1, 25, 81, 18116 }, // Ļ
+    { 12, 37, 14, 0, 24, 59, 18197 }, // ļ
+    { 19, 25, 22, 1, 25, 66, 18256 }, // Ľ
+    { 18, 25, 20, 1, 25, 60, 18322 }, // ľ
+    { 20, 25, 22, 1, 25, 62, 18382 }, // Ŀ
+    { 16, 25, 18, 1, 25, 55, 18444 }, // ŀ
+    { 40, 37, 27, -14, 30, 161, 18499 }, // Ł
+    { 28, 24, 19, -10, 24, 78, 18660 }, // ł
+    { 28, 35, 30, 1, 35, 130, 18738 }, // Ń
+    { 20, 28, 22, 1, 28, 73, 18868 }, // ń
+    { 28, 36, 30, 1, 25, 134, 18941 }, // Ņ
+    { 18, 28, 22, 1, 17, 72, 19075 }, // ņ
+    { 28, 35, 30, 1, 35, 136, 19147 }, // Ň
+    { 20, 28, 22, 1, 28, 76, 19283 }, // ň
+    { 20, 30, 20, -3, 30, 77, 19359 }, // ŉ
+    { 28, 32, 30, 1, 25, 130, 19436 }, // Ŋ
+    { 18, 22, 22, 1, 17, 63, 19566 }, // ŋ
+    { 28, 33, 31, 2, 32, 116, 19629 }, // Ō
+    { 20, 25, 23, 2, 25, 72, 19745 }, // ō
+    { 28, 36, 31, 2, 35, 126, 19817 }, // Ŏ
+    { 20, 29, 23, 2, 29, 76, 19943 }, // ŏ
+    { 29, 35, 32, 2, 34, 127, 20019 }, // Ő
+    { 23, 27, 26, 2, 27, 80, 20146 }, // ő
+    { 38, 25, 41, 2, 25, 129, 20226 }, // Œ
+    { 30, 17, 33, 2, 17, 84, 20355 }, // œ
+    { 22, 34, 24, 1, 34, 107, 20439 }, // Ŕ
+    { 15, 25, 17, 1, 25, 52, 20546 }, // ŕ
+    { 22, 39, 24, 1, 25, 115, 20598 }, // Ŗ
+    { 18, 32, 17, -2, 17, 64, 20713 }, // ŗ
+    { 22, 34, 24, 1, 34, 110, 20777 }, // Ř
+    { 15, 25, 17, 1, 25, 56, 20887 }, // ř
+    { 25, 38, 29, 1, 37, 117, 20943 }, // Ś
+    { 17, 27, 21, 1, 27, 63, 21060 }, // ś
+    { 26, 35, 29, 1, 34, 117, 21123 }, // Ŝ
+    { 19, 24, 21, 1, 24, 65, 21240 }, // ŝ
+    { 25, 33, 29, 1, 26, 109, 21305 }, // Ş
+    { 17, 24, 21, 1, 16, 63, 21414 }, // ş
+    { 25, 38, 29, 1, 37, 119, 21477 }, // Š
+    { 17, 27, 21, 1, 27, 66, 21596 }, // š
+    { 23, 31, 30, 6, 25, 88, 21662 }, // Ţ
+    { 13, 28, 19, 4, 22, 57, 21750 }, // ţ
+    { 23, 35, 30, 6, 35, 98, 21807 }, // Ť
+    { 17, 25, 22, 4, 25, 57, 21905 }, // ť
+    { 23, 25, 30, 6, 25, 73, 21962 }, // Ŧ
+    { 15, 22, 19, 2, 22, 47, 22035 }, // ŧ
+    { 26, 36, 29, 2, 35, 130, 22082 }, // Ũ
+    { 18, 26, 21, 2, 25, 76, 22212 }, // ũ
+    { 26, 34, 29, 2, 33, 113, 22288 }, // Ū
+    { 19, 24, 22, 2, 23, 66, 22401 }, // ū
+    { 26, 37, 29, 2, 36, 122, 22467 }, // Ŭ
+    { 19, 27, 22, 2, 26, 76, 22589 }, // ŭ
+    { 26, 38, 29, 2, 37, 126, 22665 }, // Ů
+    { 18, 28, 21, 2, 27, 79, 22791 }, // ů
+    { 28, 36, 31, 2, 35, 128, 22870 }, // Ű
+    { 22, 26, 25, 2, 25, 78, 22998 }, // ű
+    { 26, 31, 29, 2, 25, 107, 23076 }, // Ų
+    { 18, 23, 21, 2, 16, 68, 23183 }, // ų
+    { 33, 32, 40, 6, 32, 148, 23251 }, // Ŵ
+    { 23, 24, 29, 5, 24, 86, 23399 }, // ŵ
+    { 21, 33, 29, 7, 33, 92, 23485 }, // Ŷ
+    { 22, 33, 23, 0, 25, 93, 23577 }, // ŷ
+    { 21, 34, 29, 7, 34, 91, 23670 }, // Ÿ
+    { 29, 35, 31, 1, 35, 112, 23761 }, // Ź
+    { 20, 27, 22, 1, 27, 62, 23873 }, // ź
+    { 29, 33, 31, 1, 33, 105, 23935 }, // Ż
+    { 20, 25, 22, 1, 25, 58, 24040 }, // ż
+    { 29, 35, 31, 1, 35, 115, 24098 }, // Ž
+    { 20, 27, 22, 1, 27, 65, 24213 }, // ž
+    { 16, 24, 21, 4, 24, 50, 24278 }, // ſ
+    { 35, 28, 38, 2, 27, 123, 24328 }, // Ơ
+    { 21, 18, 24, 2, 18, 59, 24451 }, // ơ
+    { 23, 25, 25, 1, 25, 87, 24510 }, // Ƥ
+    { 23, 29, 24, -1, 21, 92, 24597 }, // ƥ
+    { 19, 22, 22, 2, 21, 52, 24689 }, // Ʃ
+    { 23, 25, 30, 6, 25, 72, 24741 }, // Ƭ
+    { 15, 26, 20, 4, 26, 55, 24813 }, // ƭ
+    { 23, 31, 30, 6, 25, 88, 24868 }, // Ʈ
+    { 30, 27, 33, 2, 26, 110, 24956 }, // Ư
+    { 21, 19, 24, 2, 18, 60, 25066 }, // ư
+    { 9, 5, 17, 7, 22, 8, 25126 }, // ̀
+    { 7, 6, 14, 6, 23, 11, 25134 }, // ́
+    { 13, 6, 13, -1, 0, 16, 25145 }, // ̂
+    { 13, 6, 19, 5, 22, 20, 25161 }, // ̃
+    { 14, 4, 20, 5, 20, 9, 25181 }, // ̄
+    { 19, 4, 29, 9, 26, 10, 25190 }, // ̅
+    { 13, 6, 20, 6, 21, 17, 25200 }, // ̆
+    { 6, 5, 13, 6, 22, 8, 25217 }, // ̇
+    { 14, 5, 21, 6, 23, 16, 25225 }, // ̈
+    { 7, 6, 13, 5, 19, 10, 25241 }, // ̉
+    { 8, 6, 15, 6, 22, 14, 25251 }, // ̊
+    { 20, 5, 27, 6, 22, 17, 25265 }, // ̋
+    { 12, 6, 19, 6, 22, 16, 25282 }, // ̌
+    { 21, 5, 13, -9, 24, 20, 25298 }, // ̏
+    { 10, 9, 15, 4, 22, 13, 25318 }, // ̒
+    { 10, 9, 15, 4, 22, 14, 25331 }, // ̓
+    { 10, 9, 6, -5, 22, 13, 25345 }, // ̔
+    { 7, 7, 8, 0, -1, 11, 25358 }, // ̘
+    { 7, 7, 10, 2, -1, 12, 25369 }, // ̙
+    { 12, 7, 21, 8, 23, 18, 25381 }, // ̚
+    { 6, 7, 12, 5, 19, 10, 25399 }, // ̛
+    { 5, 6, 6, 0, -2, 9, 25409 }, // ̜
+    { 7, 6, 11, 3, 5, 10, 25418 }, // ̝
+    { 7, 6, 8, 0, -1, 9, 25428 }, // ̞
+    { 7, 7, 8, 0, -2, 9, 25437 }, // ̟
+    { 14, 4, 15, 0, -4, 9, 25446 }, // ̠
+    { 6, 5, 7, 0, 1, 9, 25455 }, // ̣
+    { 15, 5, 15, -1, -1, 15, 25464 }, // ̤
+    { 8, 6, 15, 6, 22, 14, 25479 }, // ̥
+    { 10, 10, 11, 0, 5, 14, 25493 }, // ̦
+    { 8, 8, 9, 0, 1, 13, 25507 }, // ̧
+    { 8, 8, 9, 0, 1, 13, 25520 }, // ̨
+    { 6, 8, 6, -1, -2, 13, 25533 }, // ̩
+    { 11, 5, 12, 0, -1, 17, 25546 }, // ̪
+    { 12, 6, 13, 0, 0, 16, 25563 }, // ̬
+    { 12, 6, 12, -1, -1, 16, 25579 }, // ̭
+    { 13, 6, 19, 5, 22, 20, 25595 }, // ̰
+    { 11, 3, 19, 7, 21, 9, 25615 }, // ̱
+    { 13, 4, 14, 0, -2, 7, 25624 }, // ̲
+    { 13, 6, 19, 5, 22, 20, 25631 }, // ̴
+    { 14, 3, 19, 4, 10, 8, 25651 }, // ̵
+    { 5, 6, 8, 2, -2, 8, 25659 }, // ̹
+    { 11, 5, 10, -2, -1, 16, 25667 }, // ̺
+    { 11, 8, 12, 0, 0, 21, 25683 }, // ̻
+    { 11, 6, 12, 0, 0, 23, 25704 }, // ̼
+    { 8, 6, 15, 6, 22, 15, 25727 }, // ̽
+    { 13, 6, 19, 5, 22, 20, 25742 }, // ͂
+    { 5, 5, 12, 6, 24, 8, 25762 }, // ̓
+    { 14, 13, 21, 6, 31, 30, 25770 }, // ̈́
+    { 10, 5, 18, 7, 23, 16, 25800 }, // ͆
+    { 16, 11, 16, -1, 0, 24, 25816 }, // ͇
+    { 13, 8, 14, 0, 0, 26, 25840 }, // ͈
+    { 10, 7, 11, 0, -2, 16, 25866 }, // ͉
+    { 14, 17, 20, 5, 28, 41, 25882 }, // ͊
+    { 27, 13, 38, 10, 26, 46, 25923 }, // ͋
+    { 20, 14, 27, 6, 15, 48, 25969 }, // ͌
+    { 15, 9, 18, 2, -1, 15, 26017 }, // ͍
+    { 4, 4, 9, 4, 3, 6, 26032 }, // ͎
+    { 24, 6, 26, 1, 0, 23, 26038 }, // ͜
+    { 24, 5, 31, 6, 23, 22, 26061 }, // ͡
+    { 29, 7, 30, 0, -2, 23, 26083 }, // ͢
+    { 23, 25, 29, 1, 25, 81, 26106 }, // Α
+    { 22, 25, 24, 1, 25, 86, 26187 }, // Β
+    { 20, 24, 22, 1, 22, 55, 26273 }, // Γ
+    { 22, 22, 25, 2, 22, 69, 26328 }, // Δ
+    { 23, 25, 25, 1, 25, 75, 26397 }, // Ε
+    { 29, 25, 31, 1, 25, 86, 26472 }, // Ζ
+    { 27, 25, 29, 1, 25, 96, 26558 }, // Η
+    { 28, 26, 31, 2, 25, 103, 26654 }, // Θ
+    { 12, 25, 14, 1, 25, 40, 26757 }, // Ι
+    { 23, 25, 26, 1, 25, 85, 26797 }, // Κ
+    { 24, 25, 30, 1, 25, 83, 26882 }, // Λ
+    { 31, 25, 33, 1, 25, 133, 26965 }, // Μ
+    { 28, 25, 30, 1, 25, 108, 27098 }, // Ν
+    { 23, 21, 26, 2, 21, 55, 27206 }, // Ξ
+    { 28, 26, 31, 2, 25, 97, 27261 }, // Ο
+    { 20, 21, 23, 2, 21, 64, 27358 }, // Π
+    { 23, 25, 25, 1, 25, 77, 27422 }, // Ρ
+    { 19, 22, 22, 2, 21, 52, 27499 }, // Σ
+    { 23, 25, 30, 6, 25, 72, 27551 }, // Τ
+    { 21, 25, 29, 7, 25, 71, 27623 }, // Υ
+    { 34, 30, 38, 3, 27, 137, 27694 }, // Φ
+    { 29, 25, 31, 1, 25, 98, 27831 }, // Χ
+    { 23, 25, 29, 5, 23, 91, 27929 }, // Ψ
+    { 26, 23, 28, 1, 22, 87, 28020 }, // Ω
+    { 23, 19, 27, 1, 18, 67, 28107 }, // α
+    { 21, 34, 22, 0, 28, 100, 28174 }, // β
+    { 15, 25, 22, 6, 16, 65, 28274 }, // γ
+    { 19, 25, 23, 3, 25, 72, 28339 }, // δ
+    { 13, 15, 16, 2, 15, 37, 28411 }, // ε
+    { 17, 25, 21, 3, 21, 58, 28448 }, // ζ
+    { 18, 27, 23, 4, 19, 70, 28506 }, // η
+    { 19, 22, 23, 3, 22, 73, 28576 }, // θ
+    { 9, 19, 15, 1, 19, 32, 28649 }, // ι
+    { 16, 18, 18, 0, 18, 52, 28681 }, // κ
+    { 22, 24, 23, -10, 24, 72, 28733 }, // λ
+    { 21, 19, 21, -1, 16, 61, 28805 }, // μ
+    { 15, 17, 22, 6, 17, 46, 28866 }, // ν
+    { 16, 25, 20, 3, 21, 54, 28912 }, // ξ
+    { 18, 16, 22, 2, 16, 49, 28966 }, // ο
+    { 19, 16, 24, 4, 15, 49, 29015 }, // π
+    { 23, 23, 24, 0, 16, 72, 29064 }, // ρ
+    { 14, 20, 20, 5, 21, 41, 29136 }, // ς
+    { 26, 16, 29, 2, 16, 59, 29177 }, // σ
+    { 16, 16, 22, 5, 15, 34, 29236 }, // τ
+    { 15, 17, 19, 3, 16, 50, 29270 }, // υ
+    { 28, 36, 31, 2, 32, 145, 29320 }, // φ
+    { 25, 22, 26, 0, 16, 76, 29465 }, // χ
+    { 17, 28, 21, 3, 21, 92, 29541 }, // ψ
+    { 22, 16, 26, 2, 15, 63, 29633 }, // ω
+    { 23, 34, 29, 1, 25, 100, 29696 }, // Ạ
+    { 18, 26, 22, 1, 18, 69, 29796 }, // ạ
+    { 25, 37, 29, 1, 37, 112, 29865 }, // Ả
+    { 18, 26, 22, 1, 26, 72, 29977 }, // ả
+    { 30, 41, 32, 1, 41, 140, 30049 }, // Ấ
+    { 29, 32, 31, 1, 32, 109, 30189 }, // ấ
+    { 25, 37, 29, 1, 37, 119, 30298 }, // Ầ
+    { 20, 28, 22, 1, 28, 81, 30417 }, // ầ
+    { 30, 41, 32, 1, 41, 140, 30498 }, // Ẩ
+    { 20, 30, 22, 1, 30, 88, 30638 }, // ẩ
+    { 24, 40, 29, 1, 40, 130, 30726 }, // Ẫ
+    { 18, 30, 22, 1, 30, 90, 30856 }, // ẫ
+    { 25, 41, 29, 1, 32, 125, 30946 }, // Ậ
+    { 18, 30, 22, 1, 22, 85, 31071 }, // ậ
+    { 26, 47, 29, 1, 47, 136, 31156 }, // Ắ
+    { 20, 37, 22, 1, 37, 97, 31292 }, // ắ
+    { 26, 44, 29, 1, 44, 130, 31389 }, // Ằ
+    { 20, 34, 22, 1, 34, 95, 31519 }, // ằ
+    { 26, 46, 29, 1, 46, 135, 31614 }, // Ẳ
+    { 20, 38, 22, 1, 38, 102, 31749 }, // ẳ
+    { 26, 45, 29, 1, 45, 142, 31851 }, // Ẵ
+    { 20, 35, 22, 1, 35, 104, 31993 }, // ẵ
+    { 26, 45, 29, 1, 36, 132, 32097 }, // Ặ
+    { 20, 34, 22, 1, 26, 93, 32229 }, // ặ
+    { 23, 32, 25, 1, 25, 91, 32322 }, // Ẹ
+    { 18, 25, 22, 2, 17, 66, 32413 }, // ẹ
+    { 23, 36, 25, 1, 36, 98, 32479 }, // Ẻ
+    { 18, 30, 22, 2, 30, 72, 32577 }, // ẻ
+    { 23, 34, 25, 1, 34, 100, 32649 }, // Ẽ
+    { 19, 28, 22, 2, 28, 78, 32749 }, // ẽ
+    { 23, 39, 25, 1, 39, 114, 32827 }, // Ế
+    { 28, 30, 31, 2, 30, 100, 32941 }, // ế
+    { 23, 37, 25, 1, 37, 111, 33041 }, // Ề
+    { 19, 31, 22, 2, 31, 82, 33152 }, // ề
+    { 23, 39, 25, 1, 39, 114, 33234 }, // Ể
+    { 21, 34, 24, 2, 34, 95, 33348 }, // ể
+    { 23, 40, 25, 1, 40, 122, 33443 }, // Ễ
+    { 18, 34, 22, 2, 34, 93, 33565 }, // ễ
+    { 23, 39, 25, 1, 32, 113, 33658 }, // Ệ
+    { 21, 36, 24, 2, 28, 95, 33771 }, // ệ
+    { 16, 38, 18, 1, 38, 74, 33866 }, // Ỉ
+    { 13, 27, 15, 1, 27, 49, 33940 }, // ỉ
+    { 14, 32, 14, -1, 25, 63, 33989 }, // Ị
+    { 13, 33, 13, -1, 26, 57, 34052 }, // ị
+    { 28, 34, 31, 2, 25, 117, 34109 }, // Ọ
+    { 18, 25, 22, 2, 16, 64, 34226 }, // ọ
+    { 28, 37, 31, 2, 36, 123, 34290 }, // Ỏ
+    { 18, 29, 22, 2, 29, 71, 34413 }, // ỏ
+    { 34, 33, 37, 2, 32, 137, 34484 }, // Ố
+    { 29, 27, 32, 2, 27, 96, 34621 }, // ố
+    { 28, 39, 31, 2, 38, 135, 34717 }, // Ồ
+    { 19, 30, 22, 2, 30, 80, 34852 }, // ồ
+    { 34, 39, 37, 2, 38, 151, 34932 }, // Ổ
+    { 20, 33, 23, 2, 33, 89, 35083 }, // ổ
+    { 28, 41, 31, 2, 40, 150, 35172 }, // Ỗ
+    { 18, 33, 22, 2, 33, 90, 35322 }, // ỗ
+    { 28, 41, 31, 2, 32, 138, 35412 }, // Ộ
+    { 19, 33, 22, 2, 25, 84, 35550 }, // ộ
+    { 35, 37, 38, 2, 36, 149, 35634 }, // Ớ
+    { 21, 29, 24, 2, 29, 81, 35783 }, // ớ
+    { 35, 35, 38, 2, 34, 144, 35864 }, // Ờ
+    { 21, 27, 24, 2, 27, 78, 36008 }, // ờ
+    { 35, 37, 38, 2, 36, 149, 36086 }, // Ở
+    { 21, 29, 24, 2, 29, 81, 36235 }, // ở
+    { 35, 36, 38, 2, 35, 157, 36316 }, // Ỡ
+    { 21, 27, 24, 2, 27, 86, 36473 }, // ỡ
+    { 35, 36, 38, 2, 27, 146, 36559 }, // Ợ
+    { 21, 27, 24, 2, 18, 75, 36705 }, // ợ
+    { 26, 33, 29, 2, 25, 110, 36780 }, // Ụ
+    { 18, 24, 21, 2, 16, 66, 36890 }, // ụ
+    { 26, 37, 29, 2, 36, 119, 36956 }, // Ủ
+    { 18, 28, 21, 2, 27, 72, 37075 }, // ủ
+    { 30, 38, 33, 2, 37, 137, 37147 }, // Ứ
+    { 21, 28, 24, 2, 27, 80, 37284 }, // ứ
+    { 30, 36, 33, 2, 35, 131, 37364 }, // Ừ
+    { 21, 26, 24, 2, 25, 74, 37495 }, // ừ
+    { 30, 37, 33, 2, 36, 137, 37569 }, // Ử
+    { 21, 28, 24, 2, 27, 79, 37706 }, // ử
+    { 30, 36, 33, 2, 35, 143, 37785 }, // Ữ
+    { 21, 26, 24, 2, 25, 84, 37928 }, // ữ
+    { 30, 34, 33, 2, 26, 129, 38012 }, // Ự
+    { 21, 26, 24, 2, 18, 75, 38141 }, // ự
+    { 21, 34, 29, 7, 34, 90, 38216 }, // Ỳ
+    { 22, 34, 23, 0, 26, 89, 38306 }, // ỳ
+    { 24, 38, 29, 4, 25, 103, 38395 }, // Ỵ
+    { 22, 25, 23, 0, 16, 76, 38498 }, // ỵ
+    { 21, 37, 29, 7, 37, 93, 38574 }, // Ỷ
+    { 22, 37, 23, 0, 29, 96, 38667 }, // ỷ
+    { 21, 35, 29, 7, 35, 97, 38763 }, // Ỹ
+    { 22, 36, 23, 0, 28, 103, 38860 }, // ỹ
+    { 0, 0, 24, 0, 0, 0, 38963 }, //  
+    { 0, 0, 39, 0, 0, 0, 38963 }, //  
+    { 0, 0, 24, 0, 0, 0, 38963 }, //  
+    { 0, 0, 39, 0, 0, 0, 38963 }, //  
+    { 0, 0, 19, 0, 0, 0, 38963 }, //  
+    { 0, 0, 17, 0, 0, 0, 38963 }, //  
+    { 0, 0, 14, 0, 0, 0, 38963 }, //  
+    { 0, 0, 19, 0, 0, 0, 38963 }, //  
+    { 0, 0, 8, 0, 0, 0, 38963 }, //  
+    { 0, 0, 15, 0, 0, 0, 38963 }, //  
+    { 0, 0, 14, 0, 0, 0, 38963 }, //  
+    { 0, 0, 9, 0, 0, 0, 38963 }, // ​
+    { 0, 0, 1, 0, 0, 0, 38963 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 38963 }, // ‍
+    { 0, 0, 1, 0, 0, 0, 38963 }, // ‎
+    { 0, 0, 1, 0, 0, 0, 38963 }, // ‏
+    { 14, 3, 19, 4, 10, 8, 38963 }, // ‐
+    { 14, 3, 19, 4, 10, 8, 38971 }, // ‑
+    { 21, 3, 27, 5, 10, 11, 38979 }, // ‒
+    { 20, 4, 25, 4, 10, 18, 38990 }, // –
+    { 30, 4, 35, 4, 10, 26, 39008 }, // —
+    { 30, 4, 35, 4, 10, 26, 39034 }, // ―
+    { 19, 25, 21, 1, 21, 77, 39060 }, // ‖
+    { 24, 9, 25, 0, -3, 26, 39137 }, // ‗
+    { 9, 9, 16, 6, 25, 13, 39163 }, // ‘
+    { 10, 9, 16, 5, 25, 14, 39176 }, // ’
+    { 10, 10, 11, 0, 5, 14, 39190 }, // ‚
+    { 9, 9, 16, 6, 25, 13, 39204 }, // ‛
+    { 16, 9, 23, 6, 25, 25, 39217 }, // “
+    { 17, 9, 23, 5, 25, 27, 39242 }, // ”
+    { 10, 10, 11, 0, 5, 14, 39269 }, // „
+    { 17, 9, 24, 6, 25, 27, 39283 }, // ‟
+    { 16, 38, 22, 5, 30, 82, 39310 }, // †
+    { 19, 38, 22, 2, 30, 86, 39392 }, // ‡
+    { 19, 17, 20, 0, 20, 55, 39478 }, // •
+    { 9, 9, 13, 3, 13, 14, 39533 }, // ‣
+    { 6, 5, 8, 1, 5, 9, 39547 }, // ․
+    { 6, 5, 8, 1, 5, 9, 39556 }, // ‥
+    { 26, 5, 28, 1, 5, 25, 39565 }, // …
+    { 5, 3, 8, 2, 10, 4, 39590 }, // ‧
+    { 0, 0, 37, 0, 0, 0, 39594 }, //  
+    { 24, 25, 32, 7, 23, 103, 39594 }, // ‰
+    { 10, 9, 16, 5, 25, 14, 39697 }, // ′
+    { 17, 9, 23, 5, 25, 27, 39711 }, // ″
+    { 21, 9, 25, -3, 25, 35, 39738 }, // ‴
+    { 6, 9, 14, 7, 24, 11, 39773 }, // ‵
+    { 12, 9, 19, 6, 24, 23, 39784 }, // ‶
+    { 21, 9, 29, 7, 25, 33, 39807 }, // ‷
+    { 12, 5, 20, 7, 23, 14, 39840 }, // ‸
+    { 10, 14, 15, 4, 15, 21, 39854 }, // ‹
+    { 10, 14, 12, -2, 15, 21, 39875 }, // ›
+    { 37, 29, 39, 1, 26, 143, 39896 }, // ※
+    { 14, 29, 16, 1, 29, 58, 40039 }, // ‼
+    { 20, 37, 26, 5, 35, 97, 40097 }, // ‽
+    { 15, 4, 23, 7, 24, 9, 40194 }, // ‾
+    { 13, 6, 20, 6, 20, 18, 40203 }, // ‿
+    { 20, 18, 26, 5, 25, 82, 40221 }, // ⁂
+    { 24, 24, 32, 7, 22, 64, 40303 }, // ⁄
+    { 35, 33, 43, 7, 33, 143, 40367 }, // ⁇
+    { 25, 33, 33, 7, 33, 109, 40510 }, // ⁈
+    { 30, 35, 31, 0, 33, 130, 40619 }, // ⁉
+    { 29, 46, 29, -1, 32, 146, 40749 }, // ⁒
+    { 0, 0, 141, 0, 0, 0, 40895 }, //  
+    { 10, 11, 14, 3, 24, 33, 40895 }, // ⁰
+    { 8, 11, 13, 4, 24, 21, 40928 }, // ⁴
+    { 10, 12, 14, 3, 25, 23, 40949 }, // ⁵
+    { 9, 11, 14, 4, 24, 26, 40972 }, // ⁶
+    { 8, 13, 15, 6, 25, 19, 40998 }, // ⁷
+    { 10, 11, 14, 3, 24, 32, 41017 }, // ⁸
+    { 10, 11, 15, 4, 24, 30, 41049 }, // ⁹
+    { 18, 17, 22, 1, 17, 52, 41079 }, // ⁿ
+    { 14, 15, 16, 1, 15, 48, 41131 }, // ₀
+    { 8, 12, 9, -2, 7, 21, 41179 }, // ₁
+    { 11, 12, 10, -2, 7, 22, 41200 }, // ₂
+    { 10, 11, 10, -1, 6, 23, 41222 }, // ₃
+    { 9, 11, 10, -1, 6, 22, 41245 }, // ₄
+    { 9, 12, 9, -1, 7, 21, 41267 }, // ₅
+    { 10, 12, 10, -1, 7, 27, 41288 }, // ₆
+    { 8, 12, 10, 1, 7, 19, 41315 }, // ₇
+    { 11, 11, 10, -2, 6, 32, 41334 }, // ₈
+    { 10, 11, 10, -1, 6, 26, 41366 }, // ₉
+    { 17, 40, 21, 3, 30, 84, 41392 }, // ₍
+    { 16, 40, 13, -7, 30, 79, 41476 }, // ₎
+    { 28, 37, 29, 0, 31, 160, 41555 }, // ₡
+    { 25, 27, 27, 1, 26, 92, 41715 }, // ₢
+    { 23, 27, 25, 1, 27, 84, 41807 }, // ₤
+    { 30, 25, 31, 0, 25, 114, 41891 }, // ₦
+    { 25, 25, 27, 1, 25, 82, 42005 }, // ₧
+    { 33, 24, 34, 0, 24, 125, 42087 }, // ₨
+    { 24, 24, 24, -1, 24, 97, 42212 }, // ₩
+    { 27, 23, 33, 5, 23, 114, 42309 }, // ₪
+    { 22, 23, 25, 2, 23, 82, 42423 }, // ₫
+    { 22, 26, 26, 3, 23, 75, 42505 }, // €
+    { 23, 25, 30, 6, 25, 81, 42580 }, // ₮
+    { 28, 25, 30, 1, 25, 83, 42661 }, // ₱
+    { 25, 34, 29, 2, 30, 127, 42744 }, // ₲
+    { 32, 27, 36, 3, 26, 103, 42871 }, // ₴
+    { 15, 23, 20, 2, 21, 61, 42974 }, // ₵
+    { 26, 26, 33, 6, 26, 84, 43035 }, // ₸
+    { 17, 22, 22, 4, 22, 51, 43119 }, // ₹
+    { 17, 21, 21, 3, 20, 59, 43170 }, // ₺
+    { 21, 23, 24, 2, 23, 89, 43229 }, // ₼
+    { 27, 25, 25, -3, 25, 85, 43318 }, // ₽
+    { 18, 18, 22, -3, 14, 47, 43403 }, // ←
+    { 19, 18, 24, 4, 18, 50, 43450 }, // ↑
+    { 18, 18, 26, 7, 14, 46, 43500 }, // →
+    { 19, 18, 29, 9, 18, 52, 43546 }, // ↓
+    { 31, 15, 30, -2, 13, 76, 43598 }, // ↔
+    { 15, 30, 20, 4, 28, 80, 43674 }, // ↕
+    { 17, 13, 19, -3, 13, 41, 43754 }, // ↖
+    { 18, 13, 23, 4, 13, 40, 43795 }, // ↗
+    { 14, 18, 22, 7, 16, 46, 43835 }, // ↘
+    { 14, 18, 19, -2, 16, 48, 43881 }, // ↙
+    { 22, 19, 25, 0, 18, 61, 43929 }, // ⇐
+    { 23, 21, 29, 5, 21, 88, 43990 }, // ⇑
+    { 22, 19, 26, 3, 18, 59, 44078 }, // ⇒
+    { 23, 22, 34, 10, 21, 89, 44137 }, // ⇓
+    { 29, 19, 30, 0, 18, 84, 44226 }, // ⇔
+    { 18, 28, 26, 7, 18, 105, 44310 }, // ⇕
+    { 21, 23, 25, 3, 23, 70, 44415 }, // ∂
+    { 30, 27, 31, 0, 26, 120, 44485 }, // ∅
+    { 22, 22, 25, 2, 22, 69, 44605 }, // ∆
+    { 21, 21, 26, 4, 21, 66, 44674 }, // ∏
+    { 21, 21, 32, 10, 21, 73, 44740 }, // ∐
+    { 19, 22, 22, 2, 21, 52, 44813 }, // ∑
+    { 14, 4, 19, 4, 10, 9, 44865 }, // −
+    { 28, 25, 32, 3, 23, 75, 44874 }, // √
+    { 26, 15, 30, 3, 18, 69, 44949 }, // ∞
+    { 31, 33, 32, 0, 26, 105, 45018 }, // ∫
+    { 10, 18, 12, 1, 18, 24, 45123 }, // ∶
+    { 20, 14, 27, 6, 15, 48, 45147 }, // ≈
+    { 24, 24, 32, 7, 22, 69, 45195 }, // ≠
+    { 25, 22, 25, -1, 20, 76, 45264 }, // ≤
+    { 26, 22, 28, 1, 20, 77, 45340 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_14_italicIntervals[] = {
@@ -5929,4 +3583,5 @@ static const EpdFontData opendyslexic_14_italic = {
     38,
     -16,
     true,
+    true,
 };
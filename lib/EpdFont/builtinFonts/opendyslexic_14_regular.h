@@ -2,4949 +2,3330 @@
  * generated by fontconvert.py
  * name: opendyslexic_14_regular
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_14_regular 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py opendyslexic_14_regular 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_14_regularBitmaps[68339] = {
-    0x00, 0xA0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0,
-    0x0F, 0xC0, 0x3F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0xBF, 0x02, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0,
-    0xFF, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xE0, 0xFF, 0x83, 0xFF, 0x1F,
-    0xFC, 0xBF, 0xF0, 0x7F, 0xE0, 0xBF, 0xC7, 0xFD, 0x0B, 0xFC, 0x7F, 0xC0, 0xFF, 0xC7, 0xFC, 0x0F,
-    0xF8, 0x7F, 0x80, 0xFF, 0x4B, 0xF8, 0x0F, 0xF4, 0xBF, 0x80, 0xFF, 0x4B, 0xFC, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xAA, 0xBF, 0xAA, 0xAF, 0xEA, 0xAA, 0x80, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x86, 0xAA, 0xBF, 0xAA, 0xAF, 0xEA, 0xAA, 0x80, 0x00, 0x1F, 0xD0,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x05, 0x50, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC2, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xB4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xE8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0xF9, 0xF5, 0x90, 0x00, 0x03, 0xFF, 0xBC, 0x2D, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0x0B, 0x40,
-    0x00, 0x00, 0x7F, 0x47, 0xC2, 0xD0, 0x00, 0x00, 0x1F, 0xD1, 0xF0, 0xB4, 0x00, 0x00, 0x03, 0xFC,
-    0x7C, 0x2D, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xC2, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0xBB, 0xFF, 0xF0,
-    0x00, 0x00, 0x3C, 0x2D, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0x0B, 0x7F, 0xFF, 0x40, 0x3E, 0x9B, 0xD7,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x03, 0x82, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x01, 0xE0, 0x0B, 0xFF,
-    0x00, 0x0F, 0x00, 0xB4, 0x1F, 0x00, 0xB8, 0x03, 0x80, 0x1D, 0x03, 0xC0, 0x0D, 0x00, 0x34, 0x3D,
-    0x00, 0x74, 0x00, 0xE1, 0xF0, 0x01, 0xD0, 0x03, 0x4F, 0x40, 0x03, 0xC0, 0x3D, 0xB8, 0x00, 0x0B,
-    0xFF, 0xF7, 0xC0, 0x00, 0x0B, 0xFF, 0x3E, 0x00, 0x00, 0x05, 0x91, 0xF2, 0xFD, 0x00, 0x00, 0x0F,
-    0xBE, 0xBE, 0x00, 0x00, 0xBE, 0xC0, 0x2C, 0x00, 0x07, 0xDE, 0x00, 0x38, 0x00, 0x3E, 0x34, 0x00,
-    0xE0, 0x02, 0xF0, 0xE0, 0x03, 0x80, 0x0F, 0x83, 0xC0, 0x1E, 0x00, 0xFC, 0x0B, 0xEA, 0xF0, 0x07,
-    0xD0, 0x0F, 0xFF, 0x80, 0x3F, 0x00, 0x0B, 0xF4, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xFE, 0x40, 0xBF, 0x00, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00, 0x02, 0xF4, 0x00,
-    0x2F, 0x40, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF4,
-    0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xDF, 0xE0, 0x00, 0x00, 0x1F,
-    0xF0, 0x3F, 0x80, 0x06, 0x93, 0xFD, 0x00, 0xBF, 0x00, 0xFE, 0x3F, 0xC0, 0x02, 0xFC, 0x1F, 0xD7,
-    0xFC, 0x00, 0x07, 0xF7, 0xFC, 0x7F, 0xD0, 0x00, 0x1F, 0xFF, 0x47, 0xFF, 0x00, 0x00, 0xBF, 0xE0,
-    0x3F, 0xFD, 0x00, 0x7F, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0x8B,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x10, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xD7, 0xFD, 0x7F, 0xCB, 0xFC, 0xBF, 0x8B, 0xF8, 0xBF, 0x8B, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0,
-    0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02,
-    0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00,
-    0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x02,
-    0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x1F,
-    0xC0, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x2F,
-    0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x07,
-    0xC0, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x0F,
-    0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x7E, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0xBF, 0x00,
-    0x3F, 0x40, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x05, 0x03, 0xC0, 0x34, 0x7E, 0x0F, 0x0B, 0xD0, 0xBF, 0x6D, 0xF8, 0x00,
-    0x1F, 0xFF, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x7F, 0x6C, 0xBF, 0x83, 0xF0,
-    0xB0, 0x3E, 0x07, 0x02, 0xD0, 0x10, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x64, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x7F,
-    0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F, 0x43,
-    0xF8, 0x3F, 0xC3, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xF4, 0x6F, 0x00, 0x0B, 0xC0,
-    0x07, 0xC0, 0x0F, 0x40, 0x02, 0xE0, 0x2F, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0xF4, 0x7E, 0x03,
-    0x80, 0xF8, 0x7D, 0x0B, 0xC0, 0xFC, 0xBD, 0x0B, 0xC0, 0xBC, 0xBD, 0x0B, 0xC0, 0xFC, 0xBD, 0x0B,
-    0xC0, 0xFC, 0xBE, 0x03, 0x80, 0xFC, 0xBE, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x02, 0xFC, 0x7F, 0x40,
-    0x03, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xF9, 0x6F, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x7E, 0xFC, 0x00, 0x18, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07,
-    0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xE0, 0x00, 0x15, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xF0, 0x1F, 0x90, 0x1F, 0xF0, 0x50, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xBF,
-    0xF8, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xF8,
-    0x02, 0x40, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x15, 0x6F, 0x80, 0x03, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0x90, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x69, 0x55, 0xFF, 0xC3, 0xFF, 0xFF, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFE, 0x00, 0x6F, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x7F, 0x3E, 0x00, 0x00, 0xFC, 0x3E, 0x00,
-    0x03, 0xF4, 0x3E, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0x00,
-    0xBF, 0xAA, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x0F,
-    0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF9, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x14, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x0B, 0xF0, 0x40, 0x00, 0x7F, 0xC3, 0xF9, 0x6F, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0xE0, 0x02, 0xFE, 0x55, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7D, 0x7F, 0xFD, 0x00, 0xBE,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xF4, 0x1F, 0xE0, 0xBF, 0x80, 0x03, 0xF4, 0xBF, 0x00, 0x01, 0xF8, 0xBF,
-    0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x01, 0xFC, 0x2F,
-    0xD0, 0x07, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x40, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x01,
-    0x7E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x1B, 0xFE, 0x00, 0x00, 0x2F, 0x96, 0xF8, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0F, 0x40, 0x01,
-    0xF0, 0x07, 0xC0, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x7D, 0x00, 0x07, 0xD0, 0x0F, 0xC0,
-    0x03, 0xF0, 0x02, 0xFD, 0x07, 0xF8, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x07, 0xF4, 0x02, 0xFD, 0x03, 0xF4, 0x00, 0x2F, 0xC1, 0xFC, 0x00, 0x03, 0xF0,
-    0xBE, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x3F, 0x8B, 0xF4, 0x00, 0x1F, 0xD0, 0xFF, 0x80, 0x2F,
-    0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x0B, 0xC0, 0x02, 0xF8, 0x7D, 0x00, 0x03,
-    0xF2, 0xF0, 0x00, 0x0F, 0xDB, 0xC0, 0x00, 0x2F, 0xAF, 0x00, 0x00, 0xBF, 0x7C, 0x00, 0x01, 0xFD,
-    0xF8, 0x00, 0x0B, 0xF3, 0xF8, 0x00, 0x7F, 0xC3, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFC, 0x02,
-    0xBF, 0xE7, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF4, 0x10, 0x00,
-    0x1F, 0xC0, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0x80, 0x6F, 0xFF, 0xE0,
-    0x00, 0x2F, 0xC3, 0xFC, 0x3F, 0xD7, 0xFD, 0x7F, 0xE1, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC3, 0xFD, 0x7F, 0xDB, 0xFE, 0x00, 0x00, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xF4, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0,
-    0x2F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x6F, 0xFD,
-    0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xFE, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x06, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x15,
-    0x42, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xBF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC1, 0x50, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFF, 0xF8, 0x01, 0xBF, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x02, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x2F, 0xD0, 0x6F, 0xF4, 0x1E, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF9,
-    0x00, 0x7F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0x80, 0x03, 0xE0, 0x0B, 0xEA, 0x00, 0x3C, 0x00, 0xFC, 0x03,
-    0xE7, 0xF0, 0x02, 0xC0, 0x0F, 0x80, 0x70, 0x0F, 0x00, 0x1D, 0x01, 0xF8, 0x0A, 0x00, 0xF0, 0x01,
-    0xD0, 0x2F, 0x40, 0xD0, 0x0B, 0x00, 0x2D, 0x02, 0xF8, 0x0D, 0x00, 0xF0, 0x03, 0xC0, 0x2F, 0xC0,
-    0xFA, 0xBF, 0x40, 0xB8, 0x02, 0xFC, 0x07, 0xFF, 0xF4, 0x3F, 0x00, 0x2F, 0xE0, 0x1F, 0xE3, 0xFF,
-    0xC0, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x55, 0xBD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00,
-    0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4,
-    0x00, 0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
-    0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE,
-    0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x15, 0x55, 0x50, 0x00,
-    0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x7F,
-    0x00, 0x00, 0xBD, 0x01, 0xFC, 0x00, 0x00, 0xF8, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x1F, 0xC0, 0x00,
-    0x1F, 0x80, 0x7F, 0x00, 0x01, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0x41, 0xFC, 0x00, 0x00, 0xBF, 0x07, 0xF0,
-    0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x7F, 0x00, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x00,
-    0x3F, 0xC7, 0xF0, 0x00, 0x01, 0xFF, 0x1F, 0xC0, 0x00, 0x2F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xE1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x6F,
-    0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x55, 0x68, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x05, 0x0F, 0xFF, 0xFA, 0x56, 0xBE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x02, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x7F, 0x00, 0x06, 0xFF, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x07, 0xF0, 0x00, 0x00,
-    0xBF, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x7F,
-    0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFC,
-    0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0xFC, 0x00, 0x00, 0x1F,
-    0xFF, 0x07, 0xF5, 0x55, 0x5B, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x90, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF9, 0x56, 0xA4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x05, 0x56, 0xAA, 0xA4, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF,
-    0x47, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xEA, 0xA9, 0x40, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xEA, 0xBF, 0x40, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x95, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFF, 0xFE, 0x5F, 0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x3F,
-    0xC0, 0x00, 0x00, 0x6F, 0xFC, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x53, 0xFF, 0x00, 0x00, 0x00, 0xFC,
-    0x0B, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFF, 0xA5, 0x56, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x69, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00,
-    0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF9, 0x55,
-    0x55, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0x40, 0x00,
-    0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xE7, 0xFD, 0x00, 0x00,
-    0x1F, 0xF9, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0xAA, 0x4B, 0xF4,
-    0xBF, 0x4B, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F,
-    0x47, 0xF4, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0xCB, 0xFC, 0xBF, 0xCB, 0xFC, 0xFF, 0xCF,
-    0xFC, 0xFF, 0xC0, 0x00, 0x01, 0xA9, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFD, 0x00,
-    0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC,
-    0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00,
-    0x07, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F,
-    0xF0, 0x10, 0x7F, 0xF0, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x7F, 0xFE, 0x00,
-    0x7F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xFD, 0x00,
-    0x0B, 0xF0, 0x07, 0xF8, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x2F, 0xE0, 0x00, 0x0F,
-    0xF0, 0x7F, 0xC0, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x0F, 0xE1, 0xFE, 0x00, 0x00, 0x0F, 0xE3,
-    0xFC, 0x00, 0x00, 0x0F, 0xEB, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xCF, 0xFF, 0x00, 0x00,
-    0x3F, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xC1, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0xBF, 0xFC, 0x00, 0x3F,
-    0xC0, 0x3F, 0xFF, 0x00, 0x7F, 0xC0, 0x0F, 0xFF, 0xC0, 0x7F, 0xC0, 0x07, 0xFF, 0xF0, 0x7F, 0xC0,
-    0x02, 0xFF, 0xFC, 0x0A, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x7F, 0xEA, 0xAF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x0A, 0xA8, 0x00, 0x00, 0x02, 0xA9, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x7F, 0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xF0, 0x1F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x01, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xD0, 0x00, 0x7F, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x2F, 0xEF, 0xF0, 0x00, 0xFF,
-    0xBF, 0x42, 0xFD, 0xFF, 0x80, 0x2F, 0xEB, 0xF4, 0x2F, 0xCF, 0xFC, 0x03, 0xFD, 0xBF, 0x42, 0xFC,
-    0x7F, 0xD0, 0x7F, 0xCB, 0xF8, 0x3F, 0xC3, 0xFF, 0x0F, 0xF8, 0xBF, 0x83, 0xFC, 0x2F, 0xF0, 0xFF,
-    0x0F, 0xF8, 0x3F, 0xC0, 0xFF, 0xAF, 0xF0, 0xFF, 0xC3, 0xFC, 0x0F, 0xFF, 0xFD, 0x0F, 0xFC, 0x3F,
-    0xD0, 0x7F, 0xFF, 0xC0, 0xFF, 0xC3, 0xFD, 0x03, 0xFF, 0xFC, 0x0F, 0xFC, 0x3F, 0xD0, 0x2F, 0xFF,
-    0x40, 0xFF, 0xC3, 0xFD, 0x00, 0xFF, 0xF0, 0x0F, 0xFC, 0x3F, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC7,
-    0xFE, 0x00, 0x7F, 0xD0, 0x1F, 0xFD, 0x7F, 0xE0, 0x03, 0xFC, 0x01, 0xFF, 0xD7, 0xFE, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x81,
-    0xFE, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0xC0, 0x00, 0x03, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x0F,
-    0xFF, 0x00, 0x00, 0x3F, 0x83, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0xFF, 0xFC, 0x00, 0x07, 0xF8, 0x3F,
-    0xFF, 0x40, 0x01, 0xFD, 0x0F, 0xEF, 0xF0, 0x00, 0x7F, 0x43, 0xFA, 0xFD, 0x00, 0x2F, 0xD1, 0xFE,
-    0x3F, 0xC0, 0x0B, 0xF4, 0x7F, 0x8B, 0xF4, 0x02, 0xFD, 0x1F, 0xE0, 0xFF, 0x00, 0xFF, 0x0B, 0xF8,
-    0x2F, 0xD0, 0x3F, 0xC2, 0xFE, 0x03, 0xFC, 0x0F, 0xF0, 0xBF, 0x80, 0xBF, 0x43, 0xFC, 0x3F, 0xF0,
-    0x0F, 0xE0, 0xFF, 0x0F, 0xFC, 0x03, 0xFC, 0x3F, 0xC3, 0xFF, 0x00, 0x7F, 0x9F, 0xF0, 0xFF, 0xC0,
-    0x0F, 0xF7, 0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0x87, 0xFF, 0x00,
-    0x07, 0xFF, 0xE1, 0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x7F, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x01,
-    0xBF, 0xF9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xEF, 0xFF, 0xD0, 0x00,
-    0xFF, 0xE0, 0x01, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0xFF,
-    0x82, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xF5, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x02, 0xFE, 0xAF, 0xFF,
-    0xC0, 0xBE, 0x00, 0x07, 0xFC, 0x2F, 0x80, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x0B, 0xD2, 0xF8, 0x00,
-    0x02, 0xF8, 0xFE, 0x00, 0x00, 0xFD, 0x3F, 0x80, 0x00, 0x3F, 0x4F, 0xE0, 0x00, 0xBF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFE, 0xA9, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xEB, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F,
-    0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFD,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFF, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xF8, 0x00, 0x1E, 0x01, 0xFE, 0x01,
-    0xFF, 0x80, 0x0F, 0xFE, 0xFF, 0x40, 0x3F, 0xFE, 0xAB, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0A, 0xAA, 0x94, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x7F, 0x80, 0x0F, 0x00, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x0B, 0xD0,
-    0x1F, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x0B, 0xE0, 0x1F, 0x00, 0x01, 0xFD, 0x02, 0xF0, 0x00,
-    0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0x6F, 0xF8, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x00,
-    0xFE, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x3F,
-    0xD0, 0x00, 0xFF, 0x87, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F,
-    0xFD, 0x7F, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x16, 0x55, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xE4,
-    0x00, 0x50, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x10, 0x00, 0x00, 0xFF, 0xFC, 0x02, 0xFF, 0xAA, 0xBF, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1B, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0xA5, 0x50, 0xFD, 0x00, 0x55, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xFC,
-    0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0,
-    0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83,
-    0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x3F, 0xC0, 0x00, 0x02, 0xFD, 0x0F,
-    0xF4, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0xFA, 0x56, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x40, 0x00, 0x00, 0x01, 0xA8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x07,
-    0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,
-    0x00, 0x2F, 0xE0, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x03,
-    0xFD, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x2F, 0xF0, 0x00, 0x00,
-    0x1F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x4B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xF0, 0x0B, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0xFF, 0xD0,
-    0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x0B, 0xFF, 0x80, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0x00,
-    0x3F, 0xC0, 0x03, 0xFD, 0x02, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0x0B, 0xF8, 0x0F, 0xFB, 0xFC, 0x07,
-    0xF8, 0x00, 0x1F, 0xF0, 0xBF, 0xCB, 0xF8, 0x2F, 0xD0, 0x00, 0x3F, 0xC3, 0xFE, 0x1F, 0xF0, 0xFF,
-    0x00, 0x00, 0xFF, 0x2F, 0xF4, 0x3F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0xFF, 0xC0, 0xBF, 0xEF, 0xE0,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0xBF,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0x00,
-    0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xFB, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF2, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0x43, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00,
-    0x0F, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x3F,
-    0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0x81, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x0B,
-    0xF4, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x02, 0xFD, 0x00, 0x03, 0xFD, 0x01, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x3F, 0xD0,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xD0, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xD0, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0x80,
-    0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x03,
-    0xF4, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00,
-    0xBE, 0x00, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x0B, 0xFF, 0xF0, 0xBF, 0xFF, 0x0F, 0xFF, 0xF0, 0x55,
-    0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x0B, 0x00, 0x00, 0xB4, 0x00, 0x07, 0xC0,
-    0x00, 0x3C, 0x00, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0xBC, 0x00,
-    0x03, 0xD0, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00,
-    0x7E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x0B,
-    0xC0, 0x00, 0x78, 0x00, 0x03, 0x00, 0x00, 0x10, 0xBF, 0xFD, 0x0B, 0xFF, 0xE0, 0xBF, 0xFE, 0x00,
-    0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF4,
-    0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00,
-    0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F,
-    0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xFD, 0x00, 0x0F, 0xD2, 0xFF, 0xFD, 0x1F, 0xFF, 0xD1, 0xFF, 0xFD, 0x05, 0x55, 0x40, 0x00,
-    0x28, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xE7, 0xD0, 0x0F, 0x00, 0xF4, 0x38, 0x00,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A,
-    0xAA, 0xAA, 0xAA, 0xA9, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x1F, 0x00, 0x07, 0xFF, 0xFB, 0xC0, 0x07, 0xFA,
-    0xBF, 0xF0, 0x03, 0xF0, 0x02, 0xFC, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x3C,
-    0x00, 0x02, 0xF4, 0x1F, 0x00, 0x00, 0x7E, 0x07, 0xC0, 0x00, 0x2F, 0x82, 0xF0, 0x00, 0x0F, 0xF0,
-    0x7D, 0x00, 0x0B, 0xFC, 0x0F, 0xF9, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFD, 0x7D, 0x00, 0x2F, 0xF8, 0x1F, 0x40, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0F, 0xD2, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x6F, 0xE0, 0x3F, 0xF8, 0x00,
-    0xBD, 0x0B, 0xFC, 0x00, 0x0F, 0xC2, 0xFD, 0x00, 0x02, 0xF4, 0xBF, 0x00, 0x00, 0x7D, 0x2F, 0xC0,
-    0x00, 0x1F, 0x87, 0xF0, 0x00, 0x07, 0xD1, 0xFC, 0x00, 0x03, 0xF4, 0x7F, 0x80, 0x02, 0xFC, 0x0F,
-    0xFD, 0x57, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xA6, 0x80, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x95, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xF8, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xF4, 0x3F, 0x00, 0x3F,
-    0xFF, 0x8F, 0xC0, 0x3F, 0xFF, 0xFB, 0xE0, 0x2F, 0x90, 0x7F, 0xF8, 0x0F, 0x80, 0x03, 0xFE, 0x0F,
-    0xC0, 0x00, 0xBF, 0x83, 0xE0, 0x00, 0x1F, 0xE1, 0xF4, 0x00, 0x07, 0xF8, 0x7D, 0x00, 0x00, 0xFD,
-    0x1F, 0x40, 0x00, 0x7F, 0x47, 0xF0, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x2F, 0xF4, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFC, 0xF8, 0x00, 0x2F,
-    0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03,
-    0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x01, 0xFF, 0xE0, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0xBF,
-    0xFF, 0xFB, 0xFF, 0xFF, 0x6B, 0xFA, 0xA0, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0,
-    0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00,
-    0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x90, 0x68, 0x03, 0xFF, 0xF8, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x1F, 0x80, 0x7F, 0xFC, 0x3E, 0x00, 0x1F, 0xFC, 0x3D, 0x00, 0x0B, 0xFC, 0x7C,
-    0x00, 0x07, 0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x07, 0xF8, 0x3D,
-    0x00, 0x0F, 0xF8, 0x3F, 0xEA, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFA, 0xF4, 0x00, 0x7F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0E,
-    0x00, 0xBF, 0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFE, 0x00, 0x02,
-    0xBF, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x4B, 0xFE, 0x00, 0x2F, 0xBF, 0xFF, 0xD0, 0x2F,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x07, 0xF4, 0x2F, 0xD0, 0x01, 0xF8, 0x3F, 0xC0, 0x00, 0xFC, 0x3F,
-    0x80, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0xBC, 0x3F,
-    0x40, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0xFC, 0x7F, 0x40, 0x00, 0xFD, 0x7F, 0x40, 0x00, 0xFD, 0x7F,
-    0x80, 0x01, 0xFD, 0xBF, 0x80, 0x01, 0xFD, 0x2F, 0x43, 0xF8, 0x3F, 0x87, 0xFC, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xE0, 0x2E, 0x02, 0xF0, 0x2F,
-    0x02, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x47, 0xF4, 0x00, 0x02,
-    0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xF4, 0x00,
-    0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00,
-    0x0F, 0xD0, 0x00, 0x7F, 0xC0, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x7F, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x02, 0xFC, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x3F, 0x1F, 0xC0,
-    0x00, 0x3F, 0x3F, 0x40, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x7F, 0x3F, 0xE0, 0x00, 0x7F, 0x0F, 0xF8,
-    0x00, 0x7F, 0x07, 0xFE, 0x00, 0x7F, 0x02, 0xFF, 0x80, 0x7F, 0x00, 0xFF, 0xE0, 0xBF, 0x00, 0x3F,
-    0xFC, 0x05, 0x40, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0,
-    0x02, 0xF4, 0x00, 0xBD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40,
-    0x0F, 0xFF, 0xC3, 0xFF, 0xF0, 0xBF, 0xFC, 0x00, 0x01, 0xFE, 0x40, 0x1B, 0xF4, 0x00, 0xBC, 0xFF,
-    0xFE, 0x0B, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x2F, 0xFF, 0x01,
-    0xF8, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x0B, 0xC0, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x7C, 0x1F, 0xC0,
-    0x00, 0x7F, 0x00, 0x07, 0xC1, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x7D, 0x2F, 0xC0, 0x00, 0x7E, 0x00,
-    0x07, 0xD2, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x0B, 0xD3, 0xF8,
-    0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x1F, 0xC0,
-    0x00, 0xFE, 0x7F, 0x40, 0x02, 0xFC, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00,
-    0x01, 0x50, 0x00, 0x1F, 0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xF4, 0x0B, 0xE0, 0x2F,
-    0xD0, 0x03, 0xF0, 0x2F, 0xC0, 0x02, 0xF4, 0x3F, 0x40, 0x01, 0xF4, 0x3F, 0x40, 0x01, 0xF8, 0x3F,
-    0x40, 0x01, 0xF8, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F,
-    0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0xBF,
-    0xC0, 0x02, 0xFD, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F,
-    0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD,
-    0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F,
-    0xE5, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x2A, 0x90, 0x00, 0x3F, 0x2F, 0xFF, 0x80, 0x03, 0xFB, 0xFA, 0xBF,
-    0x00, 0x2F, 0xF8, 0x00, 0xF8, 0x02, 0xFF, 0x00, 0x07, 0xC0, 0x2F, 0xD0, 0x00, 0x3D, 0x02, 0xFC,
-    0x00, 0x03, 0xE0, 0x1F, 0xC0, 0x00, 0x3E, 0x01, 0xFC, 0x00, 0x03, 0xE0, 0x1F, 0xD0, 0x00, 0x3E,
-    0x02, 0xFF, 0x00, 0x07, 0xD0, 0x2F, 0xFE, 0x01, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x07, 0xF3, 0xFF, 0xFE, 0x00, 0xBF, 0x0F, 0xFF, 0x40, 0x0B, 0xE0, 0x05, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x15, 0x00, 0x00, 0xFF, 0xFD, 0x3F, 0x00, 0x07, 0xFE,
-    0xBF, 0x7F, 0x00, 0x0F, 0xD0, 0x0F, 0xFE, 0x00, 0x2F, 0x40, 0x03, 0xFE, 0x00, 0x3F, 0x00, 0x03,
-    0xFE, 0x00, 0x7D, 0x00, 0x02, 0xFD, 0x00, 0x7D, 0x00, 0x02, 0xFD, 0x00, 0xBC, 0x00, 0x02, 0xFC,
-    0x00, 0x7C, 0x00, 0x03, 0xFC, 0x00, 0x7D, 0x00, 0x03, 0xFC, 0x00, 0x3E, 0x00, 0x0B, 0xFC, 0x00,
-    0x2F, 0x90, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x01,
-    0xFF, 0xFD, 0xBC, 0x00, 0x00, 0x2F, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0x90, 0x00, 0x00, 0x01, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x86, 0xF4, 0x3E,
-    0xFF, 0xD0, 0xFF, 0xFF, 0x83, 0xFF, 0x99, 0x1F, 0xF0, 0x00, 0x7F, 0x40, 0x01, 0xFC, 0x00, 0x07,
-    0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-    0xFF, 0x40, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x0F, 0xFF, 0xFD, 0x00,
-    0xBE, 0x41, 0x50, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBF,
-    0xE4, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00,
-    0xBF, 0x00, 0xE4, 0x07, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFC,
-    0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x00, 0xFD,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F,
-    0xFF, 0xE0, 0x07, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0xBD, 0x00, 0x02, 0xF5,
-    0xF4, 0x00, 0x0B, 0xD7, 0xD0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF4, 0xF8,
-    0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0xFE, 0x3F, 0x00, 0x03, 0xF8, 0xFC, 0x00,
-    0x0F, 0xE3, 0xF8, 0x00, 0xFF, 0x8B, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xDF, 0xC0, 0x7F, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03,
-    0xE3, 0xF0, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x02, 0xF0, 0x0B, 0xE0,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x2F, 0x40,
-    0x00, 0xBE, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0xBE, 0x00, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0x01, 0xFE,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x3F,
-    0x80, 0x00, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x05, 0x00, 0x2F, 0x80,
-    0xFD, 0x01, 0xF8, 0x03, 0xF4, 0x0F, 0xE0, 0x3F, 0xD0, 0x3F, 0x00, 0xBF, 0x0F, 0xFF, 0x07, 0xF0,
-    0x07, 0xF2, 0xFF, 0xFC, 0xBE, 0x00, 0x3F, 0xBF, 0xFF, 0xEF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xEF, 0xFF, 0xC0, 0x01, 0xFF, 0xF4, 0xFF, 0xF8, 0x00, 0x0F, 0xFE, 0x07, 0xFF,
-    0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xF4, 0x01, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x2F,
-    0x80, 0x1F, 0xC0, 0x0B, 0xF0, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x3F, 0x40, 0x00, 0x1F,
-    0xDF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x0F, 0xF0,
-    0xFF, 0x40, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x2F, 0xE0, 0x1F, 0xF0, 0x00, 0xFF, 0x43,
-    0xFC, 0x00, 0x03, 0xFC, 0x7E, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0xBD,
-    0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0xFC, 0x03, 0xF4, 0x02, 0xF8, 0x01, 0xFC, 0x03, 0xF4,
-    0x00, 0xFE, 0x03, 0xF0, 0x00, 0x7F, 0x47, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x00, 0x1F, 0xEF, 0xE0,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x6F, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x2F, 0x90, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xF4, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xD0,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B,
-    0xF4, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x3F, 0xFE, 0x00, 0x01, 0xBF, 0x80, 0x2C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0xB8,
-    0xB8, 0xB4, 0xB4, 0xB4, 0xB4, 0xBF, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xFE, 0x80, 0x00, 0x0B, 0xC0, 0x2C,
-    0xBB, 0xC0, 0xB3, 0xC3, 0xC3, 0x8E, 0x07, 0xFD, 0x38, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF1,
-    0xFF, 0xC7, 0xFF, 0x0F, 0xF8, 0x3F, 0xE0, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x06, 0xF0, 0x3F, 0xC0,
-    0xFF, 0x02, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0, 0xBF, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x3F, 0x00,
-    0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x00,
-    0xB0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0x98,
-    0x02, 0xFC, 0xB8, 0x00, 0x3F, 0x0B, 0x40, 0x07, 0xF0, 0xB4, 0x00, 0x7E, 0x0B, 0x40, 0x07, 0xD0,
-    0xB4, 0x00, 0xBD, 0x0B, 0x40, 0x07, 0xF0, 0xB4, 0x00, 0x7F, 0x4B, 0x40, 0x03, 0xFD, 0xF4, 0x00,
-    0x2F, 0xFF, 0xA8, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xE0, 0x1B, 0xF0, 0x0F, 0xE0, 0x00, 0x08, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x1A, 0xFF, 0xAA, 0xA4, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x90, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x02, 0xD0, 0x2F,
-    0xEF, 0xEB, 0xF4, 0x1F, 0xFF, 0xFF, 0xF0, 0x07, 0xF4, 0x2F, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0F,
-    0xC0, 0x07, 0xD0, 0x0F, 0xC0, 0x07, 0xE0, 0x0F, 0xC0, 0x0B, 0xD0, 0x0B, 0xF4, 0x2F, 0xD0, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFC, 0x2F, 0x05, 0x41, 0xF4, 0x08,
-    0x00, 0x00, 0x50, 0x14, 0x00, 0x00, 0x01, 0x53, 0xF0, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x3F,
-    0x80, 0xBF, 0x00, 0x0B, 0xF0, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x1F, 0xF0, 0xBF, 0x40, 0x00, 0xBF,
-    0xEF, 0xE0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xD4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC1, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x78, 0x78,
-    0x78, 0x78, 0xB8, 0xB8, 0xB4, 0xB4, 0xB4, 0xB4, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xF0,
-    0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x18, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x07, 0xF4, 0x00, 0xBE, 0x0B, 0xC0, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x3F,
-    0x07, 0xFF, 0xA6, 0xFE, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x01, 0x00, 0x0B, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x2F, 0x43, 0xF8, 0x03, 0xF8, 0x3F, 0xC0, 0x3F, 0xC3, 0xFC, 0x07, 0xFC, 0x7F, 0xC0,
-    0xBF, 0xC0, 0x01, 0xBE, 0x00, 0x0E, 0x01, 0xE0, 0x24, 0xBC, 0x24, 0x62, 0x80, 0x0C, 0x93, 0x00,
-    0x0C, 0x93, 0x00, 0x09, 0x63, 0xC0, 0x0C, 0x30, 0xFE, 0x1C, 0x28, 0x04, 0x30, 0x0B, 0x41, 0xD0,
-    0x01, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xA4, 0x0B, 0x5F, 0x80, 0xD0, 0x38, 0x1C, 0x03, 0x81,
-    0x80, 0x3C, 0x2C, 0x03, 0xC1, 0xE5, 0xFC, 0x0F, 0xFF, 0xC0, 0x2F, 0x8C, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x3C, 0x01, 0xD0, 0x03, 0xE0, 0x2F, 0x40, 0x7E, 0x02, 0xF4, 0x0B, 0xE0, 0x3F, 0x40, 0xBD,
-    0x03, 0xF0, 0x07, 0xE0, 0x3F, 0x00, 0x1F, 0xD0, 0xFF, 0x00, 0x2F, 0xE0, 0xFF, 0x00, 0x2F, 0xE0,
-    0xFF, 0x00, 0x1F, 0xD0, 0xFF, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x1C, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0xA5, 0x40, 0x0B, 0xFF, 0xFF, 0xFC, 0x6B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01,
-    0x40, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0x01, 0xBE, 0x00, 0x0E,
-    0x01, 0xE0, 0x24, 0xFD, 0x34, 0x30, 0x83, 0x0C, 0x50, 0x87, 0x0C, 0x90, 0xFD, 0x09, 0x51, 0xDA,
-    0x0C, 0x71, 0xC3, 0x0C, 0x29, 0xC3, 0x74, 0x0F, 0x82, 0xE0, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xD6, 0xAA, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0xFD, 0x07, 0xF0, 0x3F, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0xBC, 0x7E, 0x00, 0x0B, 0xC7, 0xE0,
-    0x00, 0xBC, 0x3F, 0x00, 0x0F, 0xC3, 0xFD, 0x07, 0xF8, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xC0,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x06, 0xAA, 0xFE, 0xAA, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xAA, 0xBF, 0x83, 0xFF, 0xFF, 0xFC, 0x15,
-    0x50, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x09, 0x0B, 0x00, 0x0C, 0x00, 0x30, 0x03, 0xC0, 0x2D, 0x03,
-    0xE0, 0x3E, 0x02, 0xFF, 0xDF, 0xFF, 0x40, 0x2F, 0xD0, 0x00, 0x28, 0x00, 0x0C, 0x00, 0x28, 0x0F,
-    0xE0, 0x00, 0x78, 0x00, 0x2C, 0x00, 0x1C, 0x10, 0x7C, 0xBF, 0xF4, 0x7F, 0xD0, 0x01, 0x90, 0x3C,
-    0x07, 0xC0, 0xF4, 0x1F, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0xBD, 0x3F, 0x40, 0x00, 0xBD, 0x3F, 0x40,
-    0x00, 0xBD, 0x3F, 0x80, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0xBD, 0x7F, 0x80, 0x00, 0xFD, 0x7F, 0xC0,
-    0x00, 0xFE, 0x7F, 0xC0, 0x00, 0xFE, 0x7F, 0xC0, 0x00, 0xFE, 0x7F, 0xC0, 0x00, 0xFE, 0x7F, 0xE0,
-    0x03, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBB, 0xFF, 0xFF, 0xFF, 0xB6, 0xFF,
-    0xFF, 0x7F, 0xB4, 0x7F, 0xF8, 0x7F, 0xB4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x01, 0x40, 0x7F, 0xD0, 0x3C, 0x1F, 0xFD, 0x03, 0xC3, 0xFF, 0xC0, 0x3C,
-    0x7F, 0xFC, 0x03, 0xCB, 0xFF, 0xC0, 0x3C, 0xBF, 0xFC, 0x03, 0xD7, 0xFF, 0xC0, 0x3D, 0x3F, 0xFC,
-    0x03, 0xD0, 0xFF, 0xC0, 0x3D, 0x03, 0xF8, 0x03, 0xD0, 0x3F, 0x80, 0x3D, 0x03, 0xF8, 0x03, 0xD0,
-    0x7F, 0x40, 0x3D, 0x0B, 0xF4, 0x03, 0xD0, 0xFF, 0x40, 0x3D, 0x0F, 0xF4, 0x03, 0xD0, 0xFF, 0x00,
-    0x3D, 0x1F, 0xF0, 0x02, 0xD2, 0xFF, 0x00, 0x2E, 0x3F, 0xF0, 0x02, 0xE3, 0xFF, 0x00, 0x2E, 0x3F,
-    0xF0, 0x02, 0xE7, 0xFF, 0x00, 0x2E, 0x2F, 0x83, 0xFC, 0x3F, 0xC7, 0xFC, 0x7F, 0xC0, 0x10, 0x03,
-    0x00, 0x60, 0x0B, 0xF4, 0x00, 0xD0, 0x0D, 0x6B, 0xCF, 0xE0, 0x05, 0x00, 0xFC, 0x01, 0xB0, 0x02,
-    0xC0, 0x0B, 0x00, 0x2C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x03, 0xFF, 0xCF, 0xFF, 0x00, 0x00, 0x40,
-    0x03, 0xFE, 0x03, 0x80, 0xE1, 0xC0, 0x1C, 0xB0, 0x03, 0x5C, 0x01, 0xC3, 0x95, 0xF0, 0xBF, 0xF4,
-    0x0B, 0xF4, 0x00, 0x40, 0x01, 0x00, 0x02, 0xC0, 0x0E, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x0B, 0xD0,
-    0x3F, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x07, 0xE0, 0x2F, 0x40, 0x07, 0xD0, 0x3F, 0x00, 0x7F, 0x83,
-    0xFC, 0x07, 0xFC, 0x3F, 0xD0, 0x7F, 0x83, 0xFC, 0x03, 0xF8, 0x2F, 0xC0, 0x0F, 0x80, 0xBC, 0x00,
-    0x38, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x13, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x01,
-    0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xC0,
-    0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00,
-    0xAF, 0xEA, 0x00, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0xF0, 0x00, 0x40, 0xFF, 0xFF, 0x03, 0xC0,
-    0x02, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3E, 0x00, 0x2E, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x79, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0xF1, 0xD0,
-    0x00, 0x03, 0xF0, 0x03, 0xD1, 0xE0, 0x00, 0x07, 0xD0, 0x0B, 0x81, 0xE0, 0x00, 0x0F, 0x80, 0x0F,
-    0xFF, 0xFE, 0x00, 0x2F, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC,
-    0x00, 0x00, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x03, 0xF0,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x7C,
-    0x00, 0x07, 0xC0, 0x00, 0x02, 0xBF, 0xA8, 0x03, 0xD0, 0x69, 0x00, 0xFF, 0xFF, 0x02, 0xF2, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xC0, 0xF0, 0xA4, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xC0,
-    0x00, 0x0B, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x01, 0xF8, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0xBD, 0x00, 0x00,
-    0xBF, 0xFF, 0xC0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x95, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x3C, 0x00, 0x00, 0x2A, 0xF8, 0x00, 0x07, 0x80, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x2F, 0x00, 0x04, 0x03, 0xFF, 0xF8,
-    0x03, 0xC0, 0x02, 0xC0, 0x1B, 0xE9, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xE0, 0x02, 0xED, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x79, 0xD0, 0x00, 0x00,
-    0x0F, 0x40, 0x0F, 0x1D, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xD1, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0xB8,
-    0x1E, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
-    0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x18, 0x0F, 0xF8, 0x00, 0x7E, 0x03, 0xFF, 0xEB, 0xFC, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00,
-    0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00,
-    0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x0B,
-    0xF0, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80,
-    0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x07,
-    0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x00,
-    0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF4,
-    0x00, 0x03, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD,
-    0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF1, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x1E, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFB,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x2F, 0x80, 0x00, 0x00, 0x03,
-    0xF4, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00,
-    0x03, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0xC0,
-    0x00, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x02,
-    0xFC, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFD, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF1,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xF8, 0x03, 0x80, 0x00, 0x00, 0x0F, 0xB8, 0x0E,
-    0x00, 0x00, 0x00, 0x38, 0x78, 0x34, 0x00, 0x00, 0x01, 0xD0, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0x40,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xFD,
-    0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x00, 0x00,
-    0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00,
-    0x00, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0xFD, 0x00,
-    0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF,
-    0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0x03, 0x40, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD1, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00,
-    0x02, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x40,
-    0x00, 0x02, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x03,
-    0xF8, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xE0,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF3,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x01,
-    0xFF, 0x55, 0x6A, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFF, 0x55, 0x68, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0x0F, 0xFF, 0xFA, 0x55, 0xBE,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x01, 0xAF, 0x40, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x2F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x80,
-    0xFE, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xE5, 0x5A, 0x90, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x42, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xE4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x55, 0xA9, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0xF4, 0x07, 0xC0,
-    0x00, 0xA0, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x90,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF9, 0x56, 0xA4, 0x00, 0xFF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xF8, 0x01, 0xF4, 0x00, 0xBF, 0x00, 0xFE,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x07, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x90, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF9, 0x56, 0xA4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0x40, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x7F, 0x40, 0x07, 0xF4, 0x00, 0x7F, 0x40,
-    0x07, 0xF4, 0x00, 0x7F, 0x40, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x07,
-    0xF4, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x0B, 0xFC,
-    0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0x80, 0x7C,
-    0x0F, 0x41, 0xF0, 0x3F, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0xBF, 0x4B, 0xF4, 0xBF, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47,
-    0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xFC,
-    0xBF, 0xCB, 0xFC, 0xBF, 0xCF, 0xFC, 0xFF, 0xCF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0xFE, 0x00, 0x02, 0xFF, 0x80, 0x0B, 0x83, 0xE0, 0x2D, 0x00, 0xB8, 0x60, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x40, 0x00, 0xBF, 0x40,
-    0x00, 0xBF, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00,
-    0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F,
-    0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80,
-    0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xC0, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x0F, 0xC0, 0x0F, 0xC1, 0xFC, 0x01, 0xFC, 0x2F, 0xD0, 0x2F, 0xD3,
-    0xFD, 0x03, 0xFD, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x90, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x06, 0xFF,
-    0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F,
-    0xF0, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xC2, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xF5, 0x55, 0x6B, 0xFF, 0xF8,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0xE0, 0x00, 0x00, 0x3C, 0xB0, 0x34, 0x00, 0x00, 0x1D, 0x0F, 0x1D, 0x00, 0x00, 0x07,
-    0x41, 0xFF, 0x00, 0x00, 0x01, 0xD0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x00, 0x3F, 0xC2, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0xD0,
-    0x00, 0x03, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0xFE, 0x0F, 0xFF, 0x40, 0x00, 0x3F, 0x83, 0xFF, 0xF0,
-    0x00, 0x1F, 0xE0, 0xFF, 0xFD, 0x00, 0x07, 0xF4, 0x3F, 0xBF, 0xC0, 0x01, 0xFD, 0x0F, 0xEB, 0xF4,
-    0x00, 0xBF, 0x47, 0xF8, 0xFF, 0x00, 0x2F, 0xD1, 0xFE, 0x2F, 0xD0, 0x0B, 0xF4, 0x7F, 0x83, 0xFC,
-    0x03, 0xFC, 0x2F, 0xE0, 0xBF, 0x00, 0xFF, 0x0B, 0xF8, 0x0F, 0xE0, 0x3F, 0xC2, 0xFE, 0x02, 0xFC,
-    0x0F, 0xF0, 0xFF, 0xC0, 0x7F, 0x83, 0xFC, 0x3F, 0xF0, 0x0F, 0xF0, 0xFF, 0x0F, 0xFC, 0x01, 0xFE,
-    0x7F, 0xC3, 0xFF, 0x00, 0x3F, 0xDF, 0xF0, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x3F, 0xF0, 0x00, 0xFF,
-    0xFE, 0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0x87, 0xFF, 0x00, 0x03, 0xFF, 0xE1, 0xFF, 0xC0, 0x00, 0x7F,
-    0xF8, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFB, 0xFF, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF4,
-    0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0xBF, 0x80, 0x00, 0x00,
-    0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x40, 0x00,
-    0x00, 0x03, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x2F,
-    0xF0, 0xBF, 0xFD, 0x40, 0x5B, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00,
-    0x0B, 0xFF, 0xEF, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0xFF,
-    0xC0, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x82, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00,
-    0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0xFE,
-    0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0xF5, 0x01, 0x6F,
-    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01,
-    0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBE, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xEF, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xD0, 0x0B,
-    0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x82, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xD0,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC2,
-    0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x02, 0xC0, 0x00, 0x00, 0x0B, 0xBC, 0x0B, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x00, 0x00,
-    0x00, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x02, 0xFF, 0xFB, 0xFF, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF4, 0x02, 0xFF, 0x40,
-    0x00, 0x3F, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xC3, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF9,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xFD,
-    0x40, 0x5B, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0B,
-    0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x02, 0xFF, 0xFB, 0xFF, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF4, 0x02, 0xFF, 0x40, 0x00, 0x3F,
-    0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF9, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x7F,
-    0x00, 0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x8F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xFD, 0x40, 0x5B,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x02, 0xF8, 0xBD,
-    0x00, 0x2F, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0xFE, 0x2F,
-    0xD0, 0xFF, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFA,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xF8,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x2F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x02, 0xFE, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF4, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xEF, 0xE0, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0,
-    0x5B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xE6, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00,
-    0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00,
-    0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x01,
-    0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x07,
-    0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0xBF,
-    0x43, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0x2F, 0xFE, 0x95, 0xBF, 0xFC,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00, 0x6A, 0x87, 0xFD, 0x00, 0x00, 0x2F, 0xF1, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC,
-    0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0,
-    0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00,
-    0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x43, 0xFD, 0x00,
-    0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0x2F, 0xFE, 0x55, 0xBF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x4F,
-    0x80, 0x00, 0x00, 0x1E, 0x00, 0xB8, 0x00, 0x00, 0x0D, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02,
-    0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B,
-    0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F,
-    0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-    0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFD,
-    0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x43, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x1F, 0xF0,
-    0x2F, 0xFE, 0x95, 0xBF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00,
-    0x07, 0xF8, 0x07, 0xF8, 0x00, 0x02, 0xFE, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC,
-    0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0,
-    0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00,
-    0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x43, 0xFD, 0x00,
-    0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0x2F, 0xFE, 0x95, 0xBF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0xFF, 0x00, 0x00, 0x03,
-    0xF8, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0xBF,
-    0x40, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xD0, 0x1F, 0xF0,
-    0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x1F, 0xF3, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x07, 0xE5, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x7E,
-    0x0B, 0xFD, 0x07, 0xD0, 0x0B, 0xF4, 0x7D, 0x00, 0x1F, 0xC7, 0xD0, 0x00, 0x3E, 0x7D, 0x00, 0x02,
-    0xE7, 0xD0, 0x00, 0x3E, 0x7D, 0x00, 0x0F, 0xD7, 0xD0, 0x07, 0xF8, 0x7E, 0x07, 0xFF, 0x07, 0xFF,
-    0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x07, 0xFE, 0x40, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x07, 0xE0, 0x1F, 0x40, 0x0F, 0x80, 0x03, 0xC0, 0x2F, 0x00, 0x01, 0xD0, 0x2F,
-    0x00, 0x00, 0xE0, 0x3E, 0x00, 0x1F, 0xE0, 0x3E, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x3E,
-    0x01, 0xD0, 0x00, 0x3E, 0x01, 0xD0, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x7F, 0x80, 0x3F, 0x00, 0x2F, 0xF0, 0x7F, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0xBD, 0x7F,
-    0x00, 0x00, 0x3E, 0x7F, 0x00, 0x00, 0x7D, 0x7F, 0x2E, 0x56, 0xFD, 0xBF, 0x2F, 0xFF, 0xFC, 0xBF,
-    0x2F, 0xFF, 0xF0, 0xBF, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE1, 0xF0, 0x00, 0x7F, 0xFF, 0xBC, 0x00, 0x7F, 0xAB,
-    0xFF, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xBD, 0x03, 0xC0,
-    0x00, 0x2F, 0x41, 0xF0, 0x00, 0x07, 0xE0, 0x7C, 0x00, 0x02, 0xF8, 0x2F, 0x00, 0x00, 0xFF, 0x07,
-    0xD0, 0x00, 0xBF, 0xC0, 0xFF, 0x96, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xD7, 0xD0, 0x02, 0xFF, 0x81, 0xF4, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x7C,
-    0x00, 0x1F, 0xFF, 0xEF, 0x00, 0x1F, 0xEA, 0xFF, 0xC0, 0x0F, 0xC0, 0x0B, 0xF0, 0x0B, 0xC0, 0x00,
-    0xFC, 0x03, 0xE0, 0x00, 0x2F, 0x40, 0xF0, 0x00, 0x0B, 0xD0, 0x7C, 0x00, 0x01, 0xF8, 0x1F, 0x00,
-    0x00, 0xBE, 0x0B, 0xC0, 0x00, 0x3F, 0xC1, 0xF4, 0x00, 0x2F, 0xF0, 0x3F, 0xE5, 0xBF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF5, 0xF4, 0x00, 0xBF, 0xE0, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x7D, 0x2F, 0x00, 0x00, 0x78, 0x01, 0xF0, 0x00, 0x24, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x7C, 0x00, 0x1F, 0xFF, 0xEF, 0x00, 0x1F, 0xEA, 0xFF, 0xC0, 0x0F,
-    0xC0, 0x0B, 0xF0, 0x0B, 0xC0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x2F, 0x40, 0xF0, 0x00, 0x0B, 0xD0,
-    0x7C, 0x00, 0x01, 0xF8, 0x1F, 0x00, 0x00, 0xBE, 0x0B, 0xC0, 0x00, 0x3F, 0xC1, 0xF4, 0x00, 0x2F,
-    0xF0, 0x3F, 0xE5, 0xBF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xF5, 0xF4, 0x00, 0xBF, 0xE0, 0x7D, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x38, 0x00, 0x0F,
-    0x2C, 0x0D, 0x00, 0x07, 0x43, 0xC7, 0x40, 0x01, 0xD0, 0x7F, 0xC0, 0x00, 0x74, 0x02, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE1, 0xF0, 0x00, 0x7F, 0xFF, 0xBC, 0x00, 0x7F, 0xAB, 0xFF,
-    0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xBD, 0x03, 0xC0, 0x00,
-    0x2F, 0x41, 0xF0, 0x00, 0x07, 0xE0, 0x7C, 0x00, 0x02, 0xF8, 0x2F, 0x00, 0x00, 0xFF, 0x07, 0xD0,
-    0x00, 0xBF, 0xC0, 0xFF, 0x96, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFF, 0xD7, 0xD0, 0x02, 0xFF, 0x81, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x00, 0xFE, 0x00, 0xFE,
-    0x00, 0x3F, 0x80, 0x7F, 0x80, 0x1F, 0xF0, 0x1F, 0xF0, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE1, 0xF0, 0x00, 0x7F, 0xFF, 0xBC, 0x00, 0x7F,
-    0xAB, 0xFF, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xBD, 0x03,
-    0xC0, 0x00, 0x2F, 0x41, 0xF0, 0x00, 0x07, 0xE0, 0x7C, 0x00, 0x02, 0xF8, 0x2F, 0x00, 0x00, 0xFF,
-    0x07, 0xD0, 0x00, 0xBF, 0xC0, 0xFF, 0x96, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xD7, 0xD0, 0x02, 0xFF, 0x81, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03,
-    0x87, 0x00, 0x00, 0x00, 0xC0, 0xD0, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0x0D, 0x0D, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x1F, 0x00, 0x07, 0xFF, 0xFB, 0xC0, 0x07, 0xFA, 0xBF, 0xF0, 0x03, 0xF0, 0x02,
-    0xFC, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x3C, 0x00, 0x02, 0xF4, 0x1F, 0x00,
-    0x00, 0x7E, 0x07, 0xC0, 0x00, 0x2F, 0x82, 0xF0, 0x00, 0x0F, 0xF0, 0x7D, 0x00, 0x0B, 0xFC, 0x0F,
-    0xF9, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x7D,
-    0x00, 0x2F, 0xF8, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x02, 0xFE, 0x1F,
-    0x1F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFB, 0xEF, 0xD0, 0x2F, 0x00, 0x07, 0xFA, 0xBF, 0xFF, 0x40,
-    0x01, 0xE0, 0x03, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x3F, 0xC0, 0x05, 0x6F,
-    0x80, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x3C, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE8, 0x1F,
-    0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x6F, 0xFF,
-    0xF9, 0x00, 0x09, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x07, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xF8, 0x1F, 0x4A, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xA6, 0x80, 0x2F,
-    0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF,
-    0x95, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x90, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00,
-    0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE,
-    0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00,
-    0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0xB8, 0x3E, 0x00, 0x02, 0xD0, 0x07, 0x80, 0x06, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00,
-    0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE,
-    0x80, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x0B, 0xF4, 0x0B, 0xF4, 0x0F, 0xF8, 0x0F,
-    0xF4, 0x0F, 0xF8, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-    0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56,
-    0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x1A, 0x00, 0x00,
-    0xBD, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x16, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xE0, 0x00, 0x2E, 0x00, 0x02, 0xF0,
-    0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x01, 0xE0, 0x3C, 0x07, 0xC0, 0xF8, 0x1F,
-    0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x02,
-    0xF0, 0x2E, 0x02, 0xE0, 0x2F, 0x02, 0xF0, 0x2F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0,
-    0x3F, 0x03, 0xF4, 0x7F, 0x40, 0x00, 0x08, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x0B,
-    0xDF, 0x80, 0x0B, 0x80, 0xB8, 0x0B, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xC0, 0x0F, 0xC1, 0xFC, 0x01, 0xFC, 0x2F, 0xD0,
-    0x2F, 0xD3, 0xFD, 0x03, 0xFD, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x0F, 0xFF, 0x03, 0xD0, 0x00, 0x0B, 0xFF, 0xFC, 0x3D, 0x00, 0x01, 0xFE, 0x02, 0xF3, 0xC0,
-    0x00, 0x3F, 0x40, 0x0B, 0xBC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x7D, 0x00, 0x02, 0xF8,
-    0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x80, 0x0B, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0xA0, 0x00, 0x7F, 0xC0, 0xB0, 0x00, 0xF1, 0xE0, 0xB0, 0x00, 0xE0, 0x7F, 0xE0, 0x00, 0xE0,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x1F, 0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xF4, 0x0B, 0xE0, 0x2F, 0xD0,
-    0x03, 0xF0, 0x2F, 0xC0, 0x02, 0xF4, 0x3F, 0x40, 0x01, 0xF4, 0x3F, 0x40, 0x01, 0xF8, 0x3F, 0x40,
-    0x01, 0xF8, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0x80,
-    0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0xBF, 0xC0,
-    0x02, 0xFD, 0x01, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x06, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00,
-    0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE,
-    0xBF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00,
-    0x00, 0x7E, 0xBD, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00,
-    0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0xF4, 0x2E, 0x00, 0x03, 0x80, 0x07, 0x80, 0x05, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0,
-    0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00,
-    0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5,
-    0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0xBD, 0x01, 0xC0, 0x01, 0xFB, 0x41, 0xC0, 0x03, 0xC3, 0xC2, 0xC0, 0x03, 0xC0,
-    0xFF, 0x80, 0x03, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00,
-    0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x0B, 0xF0,
-    0x0B, 0xF0, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xF4, 0x0F, 0xF4, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0,
-    0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00,
-    0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5,
-    0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x42, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xBF, 0xFC, 0x01, 0xFC, 0x0F, 0xEF, 0x80,
-    0xFC, 0x07, 0xD3, 0xF0, 0x3E, 0x02, 0xF0, 0x7D, 0x1F, 0x40, 0xFC, 0x1F, 0x8B, 0xD0, 0x3E, 0x03,
-    0xE1, 0xF4, 0x2F, 0x01, 0xF8, 0x7E, 0x0F, 0xC0, 0x7E, 0x0F, 0xC3, 0xE0, 0x3F, 0x43, 0xFF, 0xF9,
-    0xBF, 0xC0, 0x7F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x02, 0xF5, 0xF4, 0x00, 0x0B, 0xD7, 0xD0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD,
-    0x7E, 0x00, 0x02, 0xF4, 0xF8, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0xFE, 0x3F,
-    0x00, 0x03, 0xF8, 0xFC, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0xFF, 0x8B, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xDF, 0xC0, 0x7F, 0xF8, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD7, 0xD0, 0x00, 0x2F, 0x5F, 0x40, 0x00, 0xBD, 0x7E, 0x00, 0x02,
-    0xF5, 0xF8, 0x00, 0x0B, 0xD3, 0xE0, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0xFE, 0x3F, 0x00, 0x03, 0xF8,
-    0xFC, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x3F, 0x8F, 0xE0, 0x03, 0xFE, 0x2F, 0xFF, 0xFF, 0xF8, 0x7F,
-    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x7F, 0x01, 0xFF, 0xE1, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x03, 0xE0, 0xBC, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD7, 0xD0, 0x00, 0x2F, 0x5F, 0x40, 0x00, 0xBD, 0x7E,
-    0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD3, 0xE0, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0xFE, 0x3F, 0x00,
-    0x03, 0xF8, 0xFC, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x3F, 0x8F, 0xE0, 0x03, 0xFE, 0x2F, 0xFF, 0xFF,
-    0xF8, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x7F, 0x01, 0xFF, 0xE1, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x7F, 0x40, 0x7F, 0x02, 0xFD, 0x02, 0xFD, 0x0B,
-    0xF8, 0x0F, 0xF8, 0x2F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x02, 0xF5, 0xF4, 0x00, 0x0B, 0xD7, 0xD0, 0x00, 0x2F, 0x5F, 0x80, 0x00,
-    0xBD, 0x7E, 0x00, 0x02, 0xF4, 0xF8, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0xFE,
-    0x3F, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0xFF, 0x8B, 0xFF, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xDF, 0xC0, 0x7F, 0xF8, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0xBD, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xF0,
-    0x00, 0xFC, 0x03, 0xF4, 0x02, 0xF8, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x7F,
-    0x47, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x00, 0x1F, 0xEF, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x2F, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0B, 0xFE, 0x40, 0x02, 0xFF, 0xFD, 0x00, 0xBC, 0x2F, 0xE0, 0x2F, 0x00, 0xBE, 0x0B, 0xC0,
-    0x0B, 0xD1, 0xF0, 0x00, 0xB8, 0x7C, 0x00, 0x0F, 0x1F, 0x00, 0x03, 0xC7, 0xC0, 0x01, 0xF1, 0xF0,
-    0x00, 0xB8, 0x7C, 0x00, 0x7D, 0x1F, 0x00, 0x3F, 0x07, 0xC0, 0x3F, 0x41, 0xF4, 0xBF, 0x80, 0x7F,
-    0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x02, 0xF4, 0x03, 0xF8, 0x03, 0xF4, 0x03, 0xF8, 0x07, 0xF8, 0x07, 0xFC, 0x0B, 0xFC,
-    0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0xBD, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0xFC,
-    0x03, 0xF4, 0x02, 0xF8, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x7F, 0x47, 0xF0,
-    0x00, 0x3F, 0xCF, 0xE0, 0x00, 0x1F, 0xEF, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x47,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x3F,
-    0x40, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0,
-    0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xD0, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x1F, 0xF0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0xAF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x87, 0xC0, 0x01, 0xFF, 0xFE, 0xF0, 0x01, 0xFE, 0xAF, 0xFC, 0x00, 0xFC, 0x00, 0xBF, 0x00, 0xBC,
-    0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x02, 0xF4, 0x0F, 0x00, 0x00, 0xBD, 0x07, 0xC0, 0x00, 0x1F, 0x81,
-    0xF0, 0x00, 0x0B, 0xE0, 0xBC, 0x00, 0x03, 0xFC, 0x1F, 0x40, 0x02, 0xFF, 0x03, 0xFE, 0x5B, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x5F, 0x40, 0x0B, 0xFE,
-    0x07, 0xD0, 0x00, 0x0A, 0x00, 0x01, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x7F, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x07,
-    0xF0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x40,
-    0x00, 0x3F, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xD0,
-    0xBF, 0x80, 0x00, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x03,
-    0xFD, 0x03, 0xC0, 0x00, 0xB0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x2E, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x1F, 0x00, 0x07, 0xFF, 0xFB, 0xC0,
-    0x07, 0xFA, 0xBF, 0xF0, 0x03, 0xF0, 0x02, 0xFC, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0B,
-    0xD0, 0x3C, 0x00, 0x02, 0xF4, 0x1F, 0x00, 0x00, 0x7E, 0x07, 0xC0, 0x00, 0x2F, 0x82, 0xF0, 0x00,
-    0x0F, 0xF0, 0x7D, 0x00, 0x0B, 0xFC, 0x0F, 0xF9, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x7D, 0x00, 0x2F, 0xF8, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00,
-    0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4,
-    0x00, 0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
-    0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE,
-    0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x1F, 0x00, 0x07, 0xFF, 0xFB,
-    0xC0, 0x07, 0xFA, 0xBF, 0xF0, 0x03, 0xF0, 0x02, 0xFC, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00,
-    0x0B, 0xD0, 0x3C, 0x00, 0x02, 0xF4, 0x1F, 0x00, 0x00, 0x7E, 0x07, 0xC0, 0x00, 0x2F, 0x82, 0xF0,
-    0x00, 0x0F, 0xF0, 0x7D, 0x00, 0x0B, 0xFC, 0x0F, 0xF9, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x7D, 0x00, 0x2F, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x55, 0x68, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x05, 0x0F, 0xFF, 0xFA,
-    0x56, 0xBE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFC, 0x00, 0xFF, 0xA6, 0x80, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x95, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x7C, 0x00,
-    0x00, 0x0E, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xF9, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF,
-    0x55, 0x68, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x05, 0x0F, 0xFF, 0xFA, 0x56, 0xBE, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0x5F, 0x40, 0x07, 0x80,
-    0x2D, 0x01, 0xD0, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x3F, 0xFF, 0xC0, 0x0F, 0xFA, 0x68, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xF9, 0x58, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0x80, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0x55, 0x68, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x05, 0x0F, 0xFF, 0xFA, 0x56, 0xBE, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xA6, 0x80, 0x2F, 0xC0, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x95, 0x80, 0x0F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01,
-    0x40, 0x00, 0x0B, 0x40, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xF9, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x55,
-    0x68, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x05, 0x0F, 0xFF, 0xFA, 0x56, 0xBE, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x07, 0x40, 0x3C, 0x02, 0xD0, 0x00, 0xF5, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFA, 0x68, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xF9, 0x58, 0x00,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x01, 0xE0, 0x00, 0x00, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x00,
-    0x02, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFA,
-    0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xC0, 0x01, 0xBF, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xF4, 0x01,
-    0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x41, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x07, 0xF0, 0x00, 0x00,
-    0x07, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x7F,
-    0x00, 0x00, 0x07, 0xFF, 0xC1, 0xFD, 0x55, 0x56, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00,
-    0x00, 0x3F, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x1F, 0xF4, 0x3F, 0x00, 0x00, 0x0F,
-    0xFF, 0xE3, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0xBE, 0x41, 0xFF, 0xE0, 0x00, 0x0F,
-    0x80, 0x03, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3E, 0x00, 0x01, 0xFE, 0x00, 0x07,
-    0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0xD0, 0x00,
-    0x7F, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF3, 0xE0,
-    0x00, 0x00, 0x2F, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE9,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x3F, 0xC2, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xF5, 0x55, 0x6B, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-    0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x1F, 0xF4, 0x3F, 0x00, 0x00, 0x3F, 0xFF, 0x8F, 0xC0, 0x00, 0x3F, 0xFF, 0xFB, 0xE0, 0x00, 0x2F,
-    0x90, 0x7F, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0x80, 0x03, 0xE0,
-    0x00, 0x1F, 0xE0, 0x01, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0x40,
-    0x00, 0x7F, 0x40, 0x07, 0xF0, 0x00, 0x2F, 0xD0, 0x01, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0xFC, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0xAF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x2F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x80, 0xFE, 0x40, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xE5, 0x5A, 0x90, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x50, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF,
-    0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00,
-    0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x03, 0xC0,
-    0x00, 0x74, 0x00, 0xB4, 0x00, 0x2C, 0x00, 0x1F, 0x40, 0x2F, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0xBF, 0xFF, 0xFF,
-    0xF8, 0x2F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x03, 0xF9, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0x95, 0x6A, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x06, 0x40, 0x00, 0xA0, 0x07, 0x80, 0x00, 0xE0, 0x03, 0xD0, 0x03, 0xD0, 0x02,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03,
-    0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x42, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xE4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x55, 0xA9, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x00, 0x01, 0x55,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x90, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF9, 0x56, 0xA4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0,
-    0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9,
-    0x7D, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xB8, 0x00,
-    0x02, 0xD0, 0x00, 0xB0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0xBF,
-    0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x03, 0xF9, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x95, 0x6A, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xC7, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x02, 0xD0, 0x00, 0xF4, 0x0F,
-    0x40, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-    0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56,
-    0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x0F, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xBF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xEA,
-    0xBF, 0x40, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x95, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFF,
-    0xFE, 0x5F, 0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x6F, 0xFC, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0x53, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFF,
-    0xA5, 0x56, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0xF8, 0x3E, 0x00, 0x03, 0xC0, 0x07, 0x80, 0x05, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x68, 0x03, 0xFF, 0xF8, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x1F, 0x80, 0x7F, 0xFC, 0x3E, 0x00, 0x1F, 0xFC, 0x3D, 0x00, 0x0B, 0xFC, 0x7C, 0x00, 0x07,
-    0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x07, 0xF8, 0x3D, 0x00, 0x0F,
-    0xF8, 0x3F, 0xEA, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFA,
-    0xF4, 0x00, 0x7F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0E, 0x00, 0xBF,
-    0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xBF, 0xE0,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0xA0, 0x00, 0x00, 0x0E, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3D, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6B, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0xAB,
-    0xF4, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x09, 0x50, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xFF,
-    0xE5, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xE3, 0xFC, 0x00, 0x00, 0x06, 0xFF, 0xCF, 0xF4, 0x00, 0x00,
-    0x03, 0xF5, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0x01, 0xFF, 0xFA,
-    0x55, 0x6B, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00,
-    0x0B, 0x40, 0x00, 0xE0, 0x07, 0x40, 0x01, 0xD0, 0x03, 0xD0, 0x07, 0xC0, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x68, 0x03, 0xFF, 0xF8, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0x80, 0x7F, 0xFC, 0x3E, 0x00, 0x1F, 0xFC, 0x3D, 0x00, 0x0B, 0xFC,
-    0x7C, 0x00, 0x07, 0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x07, 0xF8,
-    0x3D, 0x00, 0x0F, 0xF8, 0x3F, 0xEA, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFA, 0xF4, 0x00, 0x7F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xF0,
-    0x0E, 0x00, 0xBF, 0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFE, 0x00,
-    0x02, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xEA, 0xBF, 0x40, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x95, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFF, 0xFE, 0x5F, 0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x3F, 0xC0,
-    0x00, 0x00, 0x6F, 0xFC, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x53, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x0B,
-    0xFE, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFF, 0xA5, 0x56, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x68,
-    0x03, 0xFF, 0xF8, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0x80, 0x7F, 0xFC, 0x3E, 0x00, 0x1F, 0xFC,
-    0x3D, 0x00, 0x0B, 0xFC, 0x7C, 0x00, 0x07, 0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x03, 0xF8,
-    0x7C, 0x00, 0x07, 0xF8, 0x3D, 0x00, 0x0F, 0xF8, 0x3F, 0xEA, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFA, 0xF4, 0x00, 0x7F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0xF0, 0x0E, 0x00, 0xBF, 0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x40,
-    0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xBF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xEA, 0xBF, 0x40, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x95, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFF, 0xFE, 0x5F, 0xF0,
-    0x00, 0x07, 0xFF, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x6F, 0xFC, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x53,
-    0xFF, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFF, 0xA5, 0x56, 0xBF,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x68, 0x03, 0xFF, 0xF8, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x1F, 0x80, 0x7F, 0xFC, 0x3E, 0x00, 0x1F, 0xFC, 0x3D, 0x00, 0x0B, 0xFC, 0x7C, 0x00, 0x07,
-    0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x07, 0xF8, 0x3D, 0x00, 0x0F,
-    0xF8, 0x3F, 0xEA, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFA,
-    0xF4, 0x00, 0x7F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0E, 0x00, 0xBF,
-    0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x0B, 0x40, 0x7C, 0x00, 0x00, 0x0B, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x69,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x03, 0xFC,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x0F, 0xF0,
-    0xFF, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC3,
-    0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x0F,
-    0xF9, 0x55, 0x55, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF,
-    0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xE7, 0xFD,
-    0x00, 0x00, 0x1F, 0xF9, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xF4, 0xBC,
-    0x00, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x4B, 0xFE, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFE, 0x01, 0xFD, 0x00, 0x2F, 0xD0, 0x01, 0xF8, 0x00, 0xFF,
-    0x00, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0x0B, 0xC0, 0x0F, 0xD0, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00,
-    0xBC, 0x00, 0xFD, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0x00,
-    0x7F, 0x40, 0x00, 0xFD, 0x01, 0xFD, 0x00, 0x03, 0xF4, 0x07, 0xF8, 0x00, 0x1F, 0xD0, 0x2F, 0xE0,
-    0x00, 0x7F, 0x40, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2B,
-    0xFE, 0xAA, 0xAA, 0xAF, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x07,
-    0xFE, 0x55, 0x55, 0x6F, 0xF4, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x07, 0xFD, 0x00, 0x00, 0x1F,
-    0xF8, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF8, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x07, 0xFE, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0xBF, 0xE0, 0x00, 0x0B, 0xEF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xE0, 0x1F,
-    0xD0, 0x02, 0xFD, 0x00, 0x1F, 0x80, 0x0F, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00, 0xBC, 0x00,
-    0xFD, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xC0, 0x0F, 0xD0, 0x00, 0x2F, 0x00, 0x3F, 0x40,
-    0x00, 0xFC, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x1F, 0xD0, 0x00, 0x3F,
-    0x40, 0x7F, 0x80, 0x01, 0xFD, 0x02, 0xFE, 0x00, 0x07, 0xF4, 0x05, 0x00, 0x60, 0xFF, 0x01, 0xCB,
-    0x4E, 0x07, 0x3C, 0x1D, 0x3C, 0xF0, 0x2F, 0xE1, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xF4,
-    0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x7F,
-    0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07,
-    0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0x80, 0x38,
-    0xFB, 0xC0, 0xE3, 0x83, 0xC3, 0x5D, 0x07, 0xFC, 0x74, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xB8,
-    0x00, 0x02, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0x41, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x15, 0x03, 0xFF, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0A, 0xA0, 0x7F, 0xC0, 0xFE, 0x03,
-    0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xFC, 0x0F,
-    0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFD, 0x0F, 0xF4, 0x7F,
-    0xD1, 0xFF, 0x47, 0xFE, 0x2F, 0xF8, 0x2C, 0x01, 0xD0, 0x0E, 0x00, 0x38, 0x00, 0xBF, 0xC0, 0x6F,
-    0x00, 0x0B, 0xD0, 0x3F, 0x80, 0xFE, 0x07, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2E, 0x00, 0xB8, 0x02, 0xF0, 0x0B, 0xC0, 0x2F,
-    0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xD0, 0x7F, 0x41, 0xD0,
-    0x0E, 0x00, 0xB0, 0x03, 0xC0, 0x07, 0xFC, 0x02, 0xF4, 0x1F, 0xC0, 0xBF, 0x03, 0xFC, 0x0F, 0xF4,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x2F, 0xD0,
-    0xBF, 0x42, 0xFD, 0x07, 0xF4, 0x1F, 0xD0, 0x7F, 0x41, 0xFD, 0x07, 0xF4, 0x1F, 0xD0, 0x7F, 0x41,
-    0xFD, 0x07, 0xF4, 0x1F, 0xD0, 0x7F, 0x81, 0xFE, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0xC2, 0xFF, 0x0B,
-    0xFC, 0x2F, 0xF0, 0xFF, 0xC3, 0xFF, 0x0F, 0xFC, 0x00, 0x0B, 0xC2, 0xF0, 0xBC, 0x2E, 0x0B, 0x82,
-    0xF0, 0xBC, 0x2F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFD, 0x7F, 0x40, 0xAA, 0x40,
-    0x00, 0x2A, 0x8B, 0xF4, 0x00, 0x03, 0xFC, 0xBF, 0x40, 0x00, 0x3F, 0xCB, 0xF4, 0x00, 0x03, 0xFC,
-    0x7F, 0x40, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x3F, 0xC7, 0xF4, 0x00,
-    0x03, 0xFC, 0x7F, 0x40, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x3F, 0xC7,
-    0xF4, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x3F, 0x87, 0xF4, 0x00, 0x07, 0xF8, 0x7F, 0x80, 0x00,
-    0x7F, 0x87, 0xF8, 0x00, 0x07, 0xF8, 0x7F, 0x80, 0x00, 0x7F, 0x87, 0xF8, 0x00, 0x07, 0xF4, 0x7F,
-    0xC0, 0x00, 0x7F, 0x4B, 0xFC, 0x00, 0x07, 0xF4, 0xBF, 0xC0, 0x00, 0x7F, 0x4B, 0xFC, 0x00, 0x0B,
-    0xF4, 0xFF, 0xC0, 0x00, 0xBF, 0x0F, 0xFC, 0x00, 0x0B, 0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x01, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x47, 0xFC,
-    0x00, 0x00, 0x03, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x00, 0x02, 0xF0,
-    0x2F, 0x00, 0x00, 0x00, 0x2F, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x2F,
-    0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x3E, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x02, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xE0, 0xB8, 0x02, 0xD0, 0x07, 0x81, 0x80, 0x1A, 0xB4,
-    0x00, 0x0B, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0xC0, 0x10, 0x7F, 0xF0, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xFD, 0x01, 0xFF, 0xFE, 0x00, 0x7F, 0xFE,
-    0x00, 0x1F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0xB8, 0x07, 0xC0, 0x0B, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x01, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xFD, 0x00, 0x0B, 0xF0, 0x07, 0xF8, 0x00, 0x0B,
-    0xF0, 0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x0F, 0xE0,
-    0xFF, 0x40, 0x00, 0x0F, 0xE1, 0xFE, 0x00, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xEB, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xCF, 0xFF, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0xC0, 0x00, 0x3F,
-    0xC1, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0xBF, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xFF, 0x00, 0x7F, 0xC0,
-    0x0F, 0xFF, 0xC0, 0x7F, 0xC0, 0x07, 0xFF, 0xF0, 0x7F, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3F, 0x02, 0xFC, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x3F,
-    0x3F, 0x40, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x7F, 0x3F, 0xE0, 0x00, 0x7F, 0x0F, 0xF8, 0x00, 0x7F,
-    0x07, 0xFE, 0x00, 0x7F, 0x02, 0xFF, 0x80, 0x7F, 0x00, 0xFF, 0xE0, 0xBF, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x05, 0x00, 0x50, 0x07, 0xC0, 0xF8, 0x01, 0xF0, 0xBC, 0x00, 0x7C, 0x3D, 0x00,
-    0x2E, 0x3F, 0x00, 0x0B, 0x9F, 0x40, 0x02, 0xEF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0x00,
-    0x0F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xF7, 0xFC, 0x00, 0x3D, 0x3F, 0xC0, 0x1F, 0x47, 0xF8,
-    0x07, 0xC0, 0xBF, 0x81, 0xF0, 0x0F, 0xF8, 0x00, 0xA0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F,
-    0xEA, 0xAF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x2F, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7D, 0x00,
-    0x1F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x03, 0xF4, 0x00,
-    0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x0B, 0xFF, 0xC0,
-    0x0A, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x7F, 0xEA, 0xAF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x05, 0x40, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x01, 0xF4,
-    0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x3F, 0x40, 0x0F, 0xD0,
-    0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xFF, 0xC3, 0xFF, 0xF0, 0xBF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0x40, 0xBF, 0xC0, 0x2F, 0xE0,
-    0x0B, 0xF4, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0xFF, 0x80, 0x0A, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x2F, 0xC0, 0x01, 0xF0, 0x2F, 0xC0, 0x02, 0xF0, 0x2F, 0xC0, 0x02, 0xE0, 0x2F, 0xC0, 0x03,
-    0xE0, 0x3F, 0xC0, 0x03, 0xE0, 0x3F, 0xC0, 0x03, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0xEA, 0xAF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3E,
-    0x07, 0xC0, 0x3D, 0x0B, 0xC0, 0x3D, 0x0F, 0xC0, 0x3D, 0x0F, 0xC0, 0x7D, 0x0F, 0xC0, 0x7D, 0x0F,
-    0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40,
-    0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F,
-    0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x02, 0xF0,
-    0x2F, 0xC0, 0x03, 0xF4, 0x2F, 0xC0, 0x07, 0xF8, 0x2F, 0xC0, 0x0B, 0xF8, 0x2F, 0xC0, 0x0F, 0xFC,
-    0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0xEA, 0xAF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x07, 0xC0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xF8, 0x03, 0xF0, 0x7E, 0x01, 0xFC, 0x1F, 0x80, 0xBF, 0x47, 0xD0, 0x3F, 0xD1, 0xF4, 0x0F, 0xF8,
-    0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0A, 0x80,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xEA, 0xAF, 0xFF, 0x00, 0x00,
-    0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x09, 0x00, 0x00, 0x02,
-    0xFA, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x4F, 0xD0, 0x00, 0x7F, 0xD0, 0x3F, 0x40, 0x00, 0x14,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x64, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0x83,
-    0xFF, 0x80, 0x00, 0x0F, 0xE0, 0xFF, 0xF0, 0x00, 0x03, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0xFE, 0x0F,
-    0xFF, 0xC0, 0x00, 0x7F, 0x83, 0xFF, 0xF8, 0x00, 0x1F, 0xD0, 0xFE, 0xFF, 0x00, 0x07, 0xF4, 0x3F,
-    0xAF, 0xD0, 0x02, 0xFD, 0x1F, 0xE3, 0xFC, 0x00, 0xBF, 0x47, 0xF8, 0xBF, 0x40, 0x2F, 0xD1, 0xFE,
-    0x0F, 0xF0, 0x0F, 0xF0, 0xBF, 0x82, 0xFD, 0x03, 0xFC, 0x2F, 0xE0, 0x3F, 0xC0, 0xFF, 0x0B, 0xF8,
-    0x0B, 0xF4, 0x3F, 0xC3, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0xFF, 0xC0, 0x2F, 0xC3, 0xFC, 0x3F, 0xF0,
-    0x07, 0xF9, 0xFF, 0x0F, 0xFC, 0x00, 0xFF, 0x7F, 0xC3, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0xFF, 0xC0,
-    0x03, 0xFF, 0xF8, 0x7F, 0xF0, 0x00, 0x7F, 0xFE, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x87, 0xFF, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x1F, 0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xF4, 0x0B, 0xE0, 0x2F,
-    0xD0, 0x03, 0xF0, 0x2F, 0xC0, 0x02, 0xF4, 0x3F, 0x40, 0x01, 0xF4, 0x3F, 0x40, 0x01, 0xF8, 0x3F,
-    0x40, 0x01, 0xF8, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F,
-    0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0xBF,
-    0xC0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x81, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0xC0,
-    0x00, 0x03, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0x83, 0xFF, 0xE0,
-    0x00, 0x0F, 0xE0, 0xFF, 0xFC, 0x00, 0x07, 0xF8, 0x3F, 0xFF, 0x40, 0x01, 0xFD, 0x0F, 0xEF, 0xF0,
-    0x00, 0x7F, 0x43, 0xFA, 0xFD, 0x00, 0x2F, 0xD1, 0xFE, 0x3F, 0xC0, 0x0B, 0xF4, 0x7F, 0x8B, 0xF4,
-    0x02, 0xFD, 0x1F, 0xE0, 0xFF, 0x00, 0xFF, 0x0B, 0xF8, 0x2F, 0xD0, 0x3F, 0xC2, 0xFE, 0x03, 0xFC,
-    0x0F, 0xF0, 0xBF, 0x80, 0xBF, 0x43, 0xFC, 0x3F, 0xF0, 0x0F, 0xE0, 0xFF, 0x0F, 0xFC, 0x03, 0xFC,
-    0x3F, 0xC3, 0xFF, 0x00, 0x7F, 0x9F, 0xF0, 0xFF, 0xC0, 0x0F, 0xF7, 0xFC, 0x3F, 0xF0, 0x01, 0xFF,
-    0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0x87, 0xFF, 0x00, 0x07, 0xFF, 0xE1, 0xFF, 0xC0, 0x00, 0xFF,
-    0xF8, 0x7F, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x1F,
-    0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xF4, 0x0B, 0xE0, 0x2F, 0xD0, 0x03, 0xF0, 0x2F,
-    0xC0, 0x02, 0xF4, 0x3F, 0x40, 0x01, 0xF4, 0x3F, 0x40, 0x01, 0xF8, 0x3F, 0x40, 0x01, 0xF8, 0x3F,
-    0x40, 0x01, 0xFC, 0x3F, 0x40, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x7F,
-    0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0xBF, 0xC0, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x01,
-    0xE0, 0x00, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xA8, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xC2, 0xFF, 0x80, 0x00, 0x0F,
-    0xE0, 0xFF, 0xF0, 0x00, 0x03, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0xFE, 0x0F, 0xFF, 0xC0, 0x00, 0x7F,
-    0x83, 0xFF, 0xF4, 0x00, 0x1F, 0xD0, 0xFE, 0xFF, 0x00, 0x07, 0xF4, 0x3F, 0xAF, 0xD0, 0x02, 0xFD,
-    0x1F, 0xE3, 0xFC, 0x00, 0xBF, 0x47, 0xF8, 0xBF, 0x40, 0x2F, 0xD1, 0xFE, 0x0F, 0xF0, 0x0F, 0xF0,
-    0xBF, 0x82, 0xFD, 0x03, 0xFC, 0x2F, 0xE0, 0x3F, 0xC0, 0xFF, 0x0B, 0xF8, 0x0B, 0xF4, 0x3F, 0xC3,
-    0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0xFF, 0xC0, 0x3F, 0xC3, 0xFC, 0x3F, 0xF0, 0x07, 0xF9, 0xFF, 0x0F,
-    0xFC, 0x00, 0xFF, 0x7F, 0xC3, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x7F,
-    0xF0, 0x00, 0x7F, 0xFE, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x87, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x01,
-    0x80, 0x00, 0x20, 0x00, 0xF4, 0x01, 0xE0, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x1F,
-    0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xF4, 0x0B, 0xE0, 0x2F, 0xD0, 0x03, 0xF0, 0x2F,
-    0xC0, 0x02, 0xF4, 0x3F, 0x40, 0x01, 0xF4, 0x3F, 0x40, 0x01, 0xF8, 0x3F, 0x40, 0x01, 0xF8, 0x3F,
-    0x40, 0x01, 0xFC, 0x3F, 0x40, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x7F,
-    0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0xBF, 0xC0, 0x02, 0xFD, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x3E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x2E, 0x2F, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xF4, 0x0F, 0xD0, 0x3F, 0xC0, 0x03, 0xF0, 0x3F, 0x80, 0x02, 0xF0, 0x3F, 0x40, 0x02, 0xF4, 0x3F,
-    0x40, 0x02, 0xF8, 0x3F, 0x40, 0x02, 0xF8, 0x3F, 0x40, 0x02, 0xF8, 0x3F, 0x40, 0x02, 0xF8, 0x7F,
-    0x40, 0x02, 0xFC, 0x7F, 0x40, 0x02, 0xFC, 0x7F, 0x40, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0xBF,
-    0x80, 0x03, 0xFC, 0xBF, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x81, 0xFE, 0x00, 0x00,
-    0x0F, 0xF0, 0xBF, 0xC0, 0x00, 0x03, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x0F, 0xFF, 0x00, 0x00,
-    0x3F, 0x83, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0xFF, 0xFC, 0x00, 0x07, 0xF8, 0x3F, 0xFF, 0x40, 0x01,
-    0xFD, 0x0F, 0xEF, 0xF0, 0x00, 0x7F, 0x43, 0xFA, 0xFD, 0x00, 0x2F, 0xD1, 0xFE, 0x3F, 0xC0, 0x0B,
-    0xF4, 0x7F, 0x8B, 0xF4, 0x02, 0xFD, 0x1F, 0xE0, 0xFF, 0x00, 0xFF, 0x0B, 0xF8, 0x2F, 0xD0, 0x3F,
-    0xC2, 0xFE, 0x03, 0xFC, 0x0F, 0xF0, 0xBF, 0x80, 0xBF, 0x43, 0xFC, 0x3F, 0xF0, 0x0F, 0xE0, 0xFF,
-    0x0F, 0xFC, 0x03, 0xFC, 0x3F, 0xC3, 0xFF, 0x00, 0x7F, 0x9F, 0xF0, 0xFF, 0xC0, 0x0F, 0xF7, 0xFC,
-    0x3F, 0xF0, 0x01, 0xFF, 0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0x87, 0xFF, 0x00, 0x07, 0xFF, 0xE1,
-    0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x7F, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x1F, 0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xF4, 0x0B, 0xE0, 0x2F, 0xD0, 0x03, 0xF0, 0x2F, 0xC0, 0x02, 0xF4, 0x3F, 0x40, 0x01,
-    0xF4, 0x3F, 0x40, 0x01, 0xF8, 0x3F, 0x40, 0x01, 0xF8, 0x3F, 0x40, 0x02, 0xFC, 0x3F, 0x40, 0x02,
-    0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02,
-    0xFC, 0x7F, 0x80, 0x02, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0xBF, 0xFE, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
-    0x00, 0x03, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0,
-    0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE3,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0x4F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xFF, 0x50, 0x16, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1B,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xAF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x0A, 0xAA, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9,
-    0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00,
-    0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00,
-    0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x2D, 0x00, 0x07, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0xBF, 0xFE, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0xD0,
-    0x00, 0x0F, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0xFE,
-    0x7F, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x4F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xFF,
-    0x50, 0x16, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0xA0,
-    0x07, 0x40, 0x01, 0xE0, 0x03, 0xC0, 0x03, 0xD0, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x00,
-    0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4,
-    0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x3E,
-    0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0xB8, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x50, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0xFF,
-    0xFD, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF4,
-    0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8,
-    0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x2F, 0xFF, 0x50, 0x16,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x0B, 0x80, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x01, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x15, 0x40, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0xBF, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x00, 0x7E, 0x00, 0x0B,
-    0xD0, 0x00, 0x03, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
-    0x3F, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFE, 0x55, 0xBF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x55, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x1F, 0xC0, 0x00, 0x00,
-    0x0F, 0xFF, 0xA5, 0x40, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0xBF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0xC3, 0xF9, 0x02, 0xE0, 0x0B, 0xFE, 0xAF, 0xFF, 0xC0, 0x00, 0xF4, 0x1F, 0xC0, 0x02, 0xFF,
-    0x40, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x16, 0xBD, 0x3E, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFE, 0x7D, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xEA, 0xBD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE5, 0x5B, 0xFF, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xF8, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x29,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xAA, 0xA9, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x07,
-    0xF8, 0x00, 0xF0, 0x00, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0xBD, 0x01, 0xF0, 0x00, 0x07, 0xE0, 0x1F,
-    0x00, 0x00, 0xBE, 0x01, 0xF0, 0x00, 0x1F, 0xD0, 0x2F, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0xFF, 0xFF,
-    0x80, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFE,
-    0x56, 0xFF, 0x80, 0x3F, 0xC0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0xD0, 0x00, 0xFF,
-    0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xD0, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x0F, 0xF8, 0x7F, 0xE0,
-    0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xD7, 0xFE, 0x00, 0x0F, 0xFE,
-    0x00, 0x19, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1B, 0xD0, 0xFB, 0xFF, 0x43, 0xFF,
-    0xFE, 0x0F, 0xFE, 0x64, 0x7F, 0xC0, 0x01, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x1F,
-    0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x0A, 0xAA, 0x94, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x7F, 0x80, 0x0F, 0x00, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x0B, 0xD0,
-    0x1F, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x0B, 0xE0, 0x1F, 0x00, 0x01, 0xFD, 0x02, 0xF0, 0x00,
-    0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0x6F, 0xF8, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x00,
-    0xFE, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x3F,
-    0xD0, 0x00, 0xFF, 0x87, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F,
-    0xFD, 0x7F, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xBD, 0x03, 0xEF, 0xFD, 0x03, 0xFF, 0xFE, 0x03, 0xFF,
-    0x99, 0x07, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00,
-    0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x1F,
-    0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF4, 0x00,
-    0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0xBF,
-    0x80, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA9, 0x40, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x07, 0xF8, 0x00, 0xF0, 0x00, 0x0F,
-    0xC0, 0x1F, 0x00, 0x00, 0xBD, 0x01, 0xF0, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x00, 0xBE, 0x01, 0xF0,
-    0x00, 0x1F, 0xD0, 0x2F, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x56, 0xFF, 0x80, 0x3F, 0xC0,
-    0x02, 0xFD, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x0F, 0xF0,
-    0x3F, 0xD0, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x0F, 0xF8, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00,
-    0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xD7, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0x40,
-    0x07, 0x80, 0xB8, 0x0B, 0x80, 0x0B, 0xDF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1B, 0xD0, 0x0F, 0xBF, 0xF4, 0x03,
-    0xFF, 0xFE, 0x00, 0xFF, 0xE6, 0x40, 0x7F, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x95,
-    0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x14, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x04, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0xBF, 0xEA, 0xAF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x06, 0xFF, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xE4, 0x00, 0xFF, 0xFF, 0xD0, 0x0B, 0xE4, 0x15, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x1B, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x0E, 0x40, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x00, 0x78, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x59, 0x54, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x90, 0x01, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x06, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x40, 0x00, 0x03, 0xFF,
-    0xF0, 0x0B, 0xFE, 0xAA, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x6F, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x2C, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x0F, 0xFF, 0xFD, 0x00, 0xBE,
-    0x41, 0x50, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBF, 0xE4,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0xBF,
-    0x00, 0xE4, 0x07, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFC, 0x01,
-    0xBF, 0xFE, 0x40, 0x00, 0x00, 0x16, 0x55, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x50, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x10, 0x00, 0x00, 0xFF, 0xFC, 0x02, 0xFF, 0xAA, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x1B, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0x00, 0x6F, 0xFE, 0x40, 0x0F, 0xFF, 0xFD, 0x00, 0xBE, 0x41, 0x50, 0x03, 0xC0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x00, 0xE4, 0x07, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x78, 0x00, 0x00, 0x00, 0x3D, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x3E, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x95, 0x40, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x7F, 0xF9, 0x00, 0x14, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x04, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0xBF, 0xEA,
-    0xAF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x0F, 0x40, 0x3C, 0x00, 0x0B, 0x8B,
-    0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00,
-    0xFF, 0xFF, 0xD0, 0x0B, 0xE4, 0x15, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x1B,
-    0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x0E, 0x40, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0xE4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA5, 0x50, 0xFD, 0x00, 0x55, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xFF,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x30, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x3F, 0xD0, 0x00, 0x0A, 0x40, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x07, 0x80, 0x07, 0x80,
-    0x00, 0x00, 0x7C, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x55, 0x0F, 0xD0, 0x05, 0x50,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x1E, 0x07, 0xD0,
-    0x07, 0xE0, 0x7C, 0x00, 0x7E, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x03, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA9, 0x50, 0xFD, 0x00, 0x55, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0x0B, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x07, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0x40, 0x0C, 0x00, 0x00, 0x03, 0xFC, 0x03,
-    0x40, 0x00, 0x01, 0xE3, 0xC0, 0xD0, 0x00, 0x00, 0xB0, 0x38, 0xB0, 0x00, 0x00, 0x2C, 0x07, 0xFC,
-    0x00, 0x00, 0x04, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x2A,
-    0xA1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF,
-    0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xFC,
-    0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0,
-    0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x43,
-    0xFC, 0x00, 0x00, 0x2F, 0xD0, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x2F, 0xF0, 0x00, 0x07, 0xFC, 0x0B,
-    0xFF, 0x95, 0x6F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x07, 0x00, 0x1F, 0xB4, 0x1C, 0x00, 0xB0, 0xB0, 0x70, 0x02,
-    0xC0, 0xFB, 0xC0, 0x0F, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD7, 0xD0, 0x00, 0x2F, 0x5F, 0x40, 0x00,
-    0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD3, 0xE0, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0xFE,
-    0x3F, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x3F, 0x8F, 0xE0, 0x03, 0xFE, 0x2F,
-    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x7F, 0x01, 0xFF,
-    0xE1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC3,
-    0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F,
-    0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F,
-    0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF,
-    0x00, 0x00, 0x07, 0xF4, 0x3F, 0xC0, 0x00, 0x02, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x42, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0xBF, 0xFA, 0x56, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x6F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6B, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFE, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x7D, 0x00, 0x02, 0xF5, 0xF4, 0x00, 0x0B, 0xD7, 0xE0,
-    0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x3E, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x0F, 0xE3, 0xF0, 0x00,
-    0x3F, 0x8F, 0xC0, 0x00, 0xFE, 0x3F, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x3F, 0xE2, 0xFF, 0xFF, 0xFF,
-    0x87, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xF7, 0xF0, 0x1F, 0xFE, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xE0,
-    0x07, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1A,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00,
-    0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00,
-    0xBF, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x01,
-    0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07,
-    0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F,
-    0xD0, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x0B, 0xFC, 0x00, 0x01, 0xFF,
-    0x02, 0xFF, 0xE9, 0x5B, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x38, 0x00, 0x0E, 0x00, 0xF8, 0x01,
-    0xF4, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x5F,
-    0x40, 0x00, 0xBD, 0x7D, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x4F, 0x80,
-    0x00, 0xFD, 0x3F, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x3F, 0x8F, 0xC0, 0x00,
-    0xFE, 0x3F, 0x80, 0x0F, 0xF8, 0xBF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
-    0x0B, 0xFF, 0xFD, 0xFC, 0x07, 0xFF, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x34, 0xB0, 0x00, 0x00, 0x00, 0x1C, 0x0C, 0x00, 0x00, 0x00, 0x0B, 0x03, 0x40,
-    0x00, 0x00, 0x01, 0xC1, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC,
-    0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC3,
-    0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F,
-    0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x3F,
-    0xC0, 0x00, 0x02, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0xBF,
-    0xF9, 0x56, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xD2, 0x80, 0x00, 0x0B, 0x03, 0x00, 0x00,
-    0x28, 0x0C, 0x00, 0x00, 0xB0, 0x70, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0xBD, 0x7D, 0x00, 0x02, 0xF5, 0xF4, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD,
-    0x3E, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0xFE, 0x3F,
-    0x00, 0x03, 0xF8, 0xFE, 0x00, 0x3F, 0xE2, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xF7, 0xF0, 0x1F, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x01, 0x40, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x2F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x7F,
-    0xC0, 0x00, 0x02, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x07,
-    0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0,
-    0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x01, 0xFE,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0x00, 0x02,
-    0xFD, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0xE9, 0x5B,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x06, 0x90, 0x02, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0xFE,
-    0x00, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x40, 0x1A, 0x50, 0x00, 0x1A, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x00,
-    0x1F, 0x40, 0x00, 0xBD, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00,
-    0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xE0,
-    0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x03, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x07, 0xFF, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00,
-    0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00,
-    0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x01,
-    0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07,
-    0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x3F, 0xC0, 0x00, 0x02, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0xFF,
-    0x42, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0xBF, 0xFA, 0x56, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x6F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x02, 0xF5, 0xF4, 0x00, 0x0B, 0xD7, 0xD0, 0x00, 0x2F,
-    0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF4, 0xF8, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x3F, 0x8F,
-    0xC0, 0x00, 0xFE, 0x3F, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0xFF, 0x8B, 0xFF,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xDF, 0xC0, 0x7F, 0xF8,
-    0x7F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC0,
-    0x2F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0x40, 0x07, 0xF8, 0x00,
-    0xFF, 0x00, 0x2F, 0xFE, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x0F,
-    0xF4, 0x0B, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x3F, 0xEF, 0xF0, 0x1F, 0xE0, 0x00, 0x7F,
-    0xC2, 0xFF, 0x2F, 0xE0, 0xBF, 0x40, 0x00, 0xFF, 0x0F, 0xF8, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFC,
-    0xBF, 0xD0, 0xFF, 0x9F, 0xF0, 0x00, 0x0B, 0xFB, 0xFF, 0x02, 0xFF, 0xBF, 0x80, 0x00, 0x1F, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xAF, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B,
-    0xE3, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x00, 0x01,
-    0xFC, 0x1F, 0xC0, 0x05, 0x00, 0x2F, 0x80, 0xFD, 0x01, 0xF8, 0x03, 0xF4, 0x0F, 0xE0, 0x3F, 0xD0,
-    0x3F, 0x00, 0xBF, 0x0F, 0xFF, 0x07, 0xF0, 0x07, 0xF2, 0xFF, 0xFC, 0xBE, 0x00, 0x3F, 0xBF, 0xFF,
-    0xEF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xEF, 0xFF, 0xC0, 0x01, 0xFF, 0xF4,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFE, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xF4,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xAF, 0x40, 0x00, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0x00, 0x0F, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0xFF, 0x00, 0x00,
-    0x03, 0xF8, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x00,
-    0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xD0, 0x1F,
-    0xF0, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x1F, 0xF3, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x03,
-    0x80, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x7E, 0x1F,
-    0x80, 0x00, 0xBD, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0xFC, 0x03, 0xF4, 0x02, 0xF8, 0x01,
-    0xFC, 0x03, 0xF4, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x7F, 0x47, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x00,
-    0x1F, 0xEF, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0x0F, 0xE0, 0x0F,
-    0xD0, 0x00, 0x07, 0xF8, 0x07, 0xF8, 0x00, 0x02, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC3, 0xFC, 0x00, 0x00, 0x0F,
-    0xE0, 0x7F, 0x40, 0x00, 0x07, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x02, 0xFD,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x40, 0x7F, 0xC0,
-    0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xCF, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x3F, 0xFA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x3F, 0xFA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x19, 0x00, 0x02, 0x40, 0x00, 0x00, 0x1E, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x1F,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x02, 0xD0, 0x00, 0xB8, 0x0F, 0x40, 0x00, 0x2F, 0xBD, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x03, 0xFF, 0xC0,
-    0xFD, 0x08, 0x1F, 0x80, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF4, 0x00, 0x7F,
-    0x40, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xD0, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x74, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x2D, 0x00, 0xBF, 0xFE,
-    0xFF, 0xFD, 0x0F, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xDB, 0x80, 0xBF, 0xD0, 0x00, 0x0F, 0xFF, 0xC0,
-    0x3F, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x00,
-    0x03, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x7F,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xC0, 0x2F, 0xFF, 0x50, 0x16, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x2F, 0xF9, 0x00,
-    0xD0, 0x2F, 0xFF, 0xF8, 0x0D, 0x0B, 0xFE, 0xBF, 0xF2, 0xC1, 0xFC, 0x00, 0x2F, 0xF4, 0x3F, 0x00,
-    0x00, 0xFD, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x7D, 0x00, 0x00, 0x7E, 0x0B, 0xD0, 0x00, 0x03, 0xE0,
-    0xBD, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0xFD, 0x03, 0xFE, 0x55,
-    0xBF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF,
-    0xAB, 0xFF, 0xF0, 0x3F, 0xFE, 0x00, 0x07, 0xFC, 0x7E, 0xBE, 0x00, 0x00, 0xFC, 0xBC, 0xBE, 0x00,
-    0x00, 0xBD, 0xB8, 0xFE, 0x00, 0x00, 0xBE, 0xB4, 0xFE, 0x00, 0x00, 0xFD, 0x74, 0xFE, 0x00, 0x00,
-    0xFD, 0x20, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xEA, 0x90, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0x90, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xA9, 0x00, 0x03, 0xF2, 0xFF, 0xF8,
-    0x00, 0x3F, 0xBF, 0xAB, 0xF0, 0x03, 0xFF, 0x80, 0x0F, 0x80, 0x3F, 0xF0, 0x00, 0x7C, 0x03, 0xFD,
-    0x00, 0x03, 0xD0, 0x3F, 0xC0, 0x00, 0x3E, 0x03, 0xFC, 0x00, 0x03, 0xE0, 0x3F, 0xC0, 0x00, 0x3E,
-    0x03, 0xFD, 0x00, 0x03, 0xE0, 0x3F, 0xF0, 0x00, 0x7D, 0x03, 0xFF, 0xE0, 0x1F, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0x3F, 0xFF, 0xE0, 0x0B, 0xF0, 0xFF, 0xF4, 0x00,
-    0xBE, 0x00, 0x50, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0x78, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0xF9, 0x50, 0xFD, 0x00, 0x55, 0x2C, 0x00, 0x3F, 0x40, 0x00, 0x02, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x3F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x0F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA9, 0x50, 0xFD, 0x00, 0x55, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x87, 0xFC, 0x00, 0x00,
-    0x2F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x01, 0xFF, 0x00,
-    0x00, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x3F,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0,
-    0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x07,
-    0xF8, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x00,
-    0x02, 0xFD, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x0B, 0xFF,
-    0xA5, 0x6F, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x0D,
-    0xBD, 0x00, 0x02, 0xF5, 0xC7, 0xD0, 0x00, 0x2F, 0x6C, 0x7D, 0x00, 0x02, 0xFF, 0x47, 0xE0, 0x00,
-    0x2F, 0xE0, 0x7E, 0x00, 0x02, 0xF4, 0x03, 0xE0, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x03, 0xF8, 0x03,
-    0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x1F,
-    0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFD, 0xFC, 0x00, 0x1F, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0xFD, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0x40, 0x01, 0x90, 0x3C, 0x07, 0xC0, 0xF4,
-    0x1F, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0x80, 0x07, 0xC3, 0xE0, 0x1E,
-    0x00, 0x78, 0x24, 0x00, 0x09, 0x0B, 0xC0, 0x2C, 0xBB, 0xC0, 0xB3, 0xC3, 0xC3, 0x8E, 0x07, 0xFD,
-    0x38, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x42, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x0E, 0x78, 0x00, 0x1D, 0x3D, 0x00, 0x7C,
-    0x2F, 0xFF, 0xF8, 0x0B, 0xFF, 0xE0, 0x00, 0xA9, 0x00, 0x2F, 0x83, 0xFC, 0x3F, 0xC7, 0xFC, 0x7F,
-    0xC0, 0x1F, 0x40, 0x2F, 0x43, 0xF8, 0x03, 0xF8, 0x3F, 0xC0, 0x3F, 0xC3, 0xFC, 0x07, 0xFC, 0x7F,
-    0xC0, 0xBF, 0xC0, 0x2F, 0xE0, 0x81, 0xE0, 0x03, 0x80, 0x78, 0x03, 0x80, 0x00, 0x00, 0x0B, 0xD0,
-    0xB0, 0xD3, 0x41, 0xCE, 0x0B, 0x1F, 0xF4, 0x1A, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x07,
-    0xF0, 0x00, 0x07, 0xE0, 0x02, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x14,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x38, 0x00, 0x1D, 0x0F, 0x00, 0xF4, 0x03, 0xE7, 0xD0, 0x00, 0xFF,
-    0x40, 0x00, 0x7E, 0x00, 0x00, 0x28, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x02, 0xF8, 0x00, 0x02,
-    0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x6B, 0x40,
-    0x00, 0x6B, 0x40, 0xBF, 0xD1, 0xFF, 0x43, 0xFD, 0x0F, 0xF8, 0x2F, 0xE0, 0x7F, 0xC0, 0xFF, 0x42,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x2F,
-    0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x47, 0xFD, 0x0F, 0xF4, 0x3F, 0xE0, 0x7F, 0x80,
-    0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x02, 0x40, 0xE5, 0x7A, 0xFE, 0x03, 0x80, 0xE0, 0x00, 0x60, 0x2C,
-    0x0B, 0x56, 0xFE, 0xB0, 0x2C, 0x00, 0x00, 0xBE, 0xA5, 0x50, 0xBF, 0xFF, 0xFD, 0x05, 0x55, 0xBD,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x0E, 0x0A, 0x0E, 0x1D,
-    0xB8, 0x60, 0x1D, 0xCA, 0x28, 0x3C, 0x10, 0x06, 0x00, 0x1C, 0x00, 0x70, 0x2F, 0xFC, 0x6A, 0xA0,
-    0xBF, 0xF1, 0xBE, 0x80, 0x70, 0x01, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x60, 0x06, 0x0B, 0xFE, 0x06,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x15, 0x42, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0x43, 0xF8, 0x3F, 0xC3, 0xFC, 0x7F, 0xC0, 0x2F, 0x80, 0x2F, 0x83, 0xFC, 0x03,
-    0xF8, 0x3F, 0xC0, 0x3F, 0xC7, 0xFC, 0x07, 0xFC, 0x7F, 0xC0, 0x7F, 0xC0, 0x0B, 0xD0, 0xB0, 0xD3,
-    0x41, 0xCE, 0x0B, 0x1F, 0xF4, 0x1A, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x1F,
-    0xF0, 0x1F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x00, 0x10, 0x03, 0x00, 0x60, 0x0B,
-    0xF4, 0x00, 0xD0, 0x0D, 0x6B, 0xCF, 0xE0, 0x02, 0x40, 0xE0, 0x3C, 0x07, 0x00, 0xB0, 0x07, 0xFD,
-    0x0B, 0xE0, 0x00, 0x3C, 0x7C, 0x7C, 0x7C, 0xBC, 0xBC, 0xBC, 0xA8, 0xAA, 0xAA, 0x6F, 0xFF, 0xEB,
-    0x40, 0x7A, 0xD0, 0x1E, 0xA4, 0x06, 0x40, 0x24, 0x00, 0x09, 0x1E, 0x00, 0x78, 0x07, 0xC3, 0xE0,
-    0x01, 0xFF, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x07, 0xFC, 0x00, 0x07, 0xDB, 0xC0, 0x07, 0x80, 0x7C, 0x0B, 0x40, 0x02, 0xC0, 0x0B, 0xC0, 0x2C,
-    0xBB, 0xC0, 0xB3, 0xC3, 0xC3, 0x8E, 0x07, 0xFD, 0x38, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xD6, 0xAA, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x2C, 0xBB, 0xC0, 0xB3, 0xC3, 0xC3, 0x8E, 0x07, 0xFD, 0x38, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0xA0,
-    0xA0, 0xCB, 0xB5, 0x40, 0x50, 0x01, 0x6D, 0x01, 0xEB, 0x40, 0x7A, 0xFA, 0xBE, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x2F, 0xFF, 0xCA, 0x00, 0x32, 0x80, 0x0C, 0xA0, 0x03, 0x28, 0x00, 0xCB, 0xFF, 0xF0,
-    0x55, 0x54, 0x2E, 0x09, 0x1C, 0x38, 0xC6, 0x0C, 0x25, 0x83, 0x0A, 0xA0, 0xC2, 0x80, 0x10, 0x50,
-    0x24, 0x50, 0x77, 0x00, 0xB0, 0x03, 0xD0, 0x29, 0xC2, 0xC2, 0xC0, 0x0B, 0xC0, 0x2C, 0xBB, 0xC0,
-    0xB3, 0xC3, 0xC3, 0x8E, 0x07, 0xFD, 0x38, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xA0, 0xBC, 0x0D, 0x1C,
-    0x50, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x2F,
-    0x43, 0xF8, 0x03, 0xF8, 0x3F, 0xC0, 0x3F, 0xC3, 0xFC, 0x07, 0xFC, 0x7F, 0xC0, 0xBF, 0xC0, 0xAA,
-    0xAA, 0x6F, 0xFF, 0xEB, 0x40, 0x7A, 0xD0, 0x1E, 0xA4, 0x06, 0x40, 0x00, 0x00, 0x01, 0x02, 0xBF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC1, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x2F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0xF5, 0xF0, 0x03, 0xD7, 0xC0, 0x1F, 0x5F, 0x00, 0x7D, 0xBC, 0x01, 0xF6,
-    0xF0, 0x0B, 0xDB, 0xC0, 0x2F, 0x6A, 0x00, 0x69, 0x65, 0x54, 0x2F, 0xFF, 0xCB, 0xFF, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x02, 0xA0, 0x00, 0x00, 0x50, 0x00, 0x03, 0x00, 0x00, 0x1C,
-    0x00, 0x00, 0xA0, 0x00, 0x03, 0x40, 0x2F, 0x1C, 0xB2, 0xEF, 0xA2, 0xCF, 0x0F, 0x4E, 0x38, 0x1F,
-    0xF4, 0xE0, 0xBF, 0x80, 0x03, 0x80, 0x00, 0x0D, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x00, 0xFD, 0x0F, 0xFA, 0xBF, 0x40, 0x00, 0xFD, 0x3F, 0xC0, 0x0F, 0xF4, 0x01, 0xFC, 0x3F, 0x80,
-    0x01, 0xFF, 0xAF, 0xF8, 0x7F, 0x80, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x01, 0x42, 0xFA, 0xF4, 0x00, 0xF0, 0xF8,
-    0x0F, 0x40, 0x7C, 0x7D, 0x01, 0xF4, 0x3E, 0x2F, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x6A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xC3, 0xF0, 0xBC, 0x01,
-    0xF0, 0xF4, 0x0B, 0xC0, 0xBC, 0x7D, 0x00, 0xBE, 0xFD, 0x16, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x40, 0x00, 0xBF, 0x07, 0x00, 0x00,
-    0x14, 0x3F, 0xC0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x7C, 0x18,
-    0x14, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x34, 0x00, 0x00, 0x00, 0x00, 0x34, 0x0E, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x01, 0xF9, 0x00, 0x01, 0x7E, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFE, 0x90, 0x00, 0x01, 0xF9, 0x40, 0x01, 0xBE,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xD0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x34, 0x60, 0x00, 0x00,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x8B,
-    0xE0, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F,
-    0x80, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00,
-    0x2F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80,
-    0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xF4,
-    0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x15, 0x55, 0x50, 0x00, 0x01, 0xFF,
-    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x00,
-    0xBD, 0x01, 0xFC, 0x00, 0x00, 0xF8, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x1F, 0xC0, 0x00, 0x1F, 0x80,
-    0x7F, 0x00, 0x01, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0x41, 0xFC, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x00,
-    0xFD, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x7F, 0x00, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x00, 0x3F, 0xC7,
-    0xF0, 0x00, 0x01, 0xFF, 0x1F, 0xC0, 0x00, 0x2F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xE0,
-    0x00, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xF6, 0xE0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x47, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x00, 0x0F,
-    0xE0, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x02, 0xFD,
-    0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x3F, 0xC0,
-    0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC7, 0xFC, 0x00,
-    0x00, 0x0F, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x90, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF9, 0x56,
-    0xA4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1A, 0x40,
-    0x00, 0x00, 0x69, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00,
-    0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x0F, 0xF9, 0x55, 0x55, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00,
-    0x7F, 0xE7, 0xFD, 0x00, 0x00, 0x1F, 0xF9, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x7F, 0xE0, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF,
-    0xEF, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x3F,
-    0xD0, 0x00, 0x00, 0xFF, 0x82, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD,
-    0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x05, 0x50,
-    0x3F, 0x9F, 0xC0, 0xFF, 0xFF, 0xC0, 0xBF, 0x7F, 0x07, 0xFF, 0xFA, 0x02, 0xFD, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0,
-    0x00, 0x00, 0x0B, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x4B, 0xF4, 0xBF, 0x4B, 0xF4, 0x7F, 0x47,
-    0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x87, 0xF8,
-    0x7F, 0x87, 0xF8, 0x7F, 0xCB, 0xFC, 0xBF, 0xCB, 0xFC, 0xFF, 0xCF, 0xFC, 0xFF, 0xC0, 0x07, 0xF0,
-    0x01, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xFD, 0x00, 0x0B, 0xF0, 0x07, 0xF8, 0x00, 0x0B, 0xF0, 0x0F,
-    0xF0, 0x00, 0x0B, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x0F, 0xE0, 0xFF, 0x40,
-    0x00, 0x0F, 0xE1, 0xFE, 0x00, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xEB, 0xF8, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x00, 0x3F, 0xCF, 0xFF, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xC1, 0xFF,
-    0xF0, 0x00, 0x3F, 0xC0, 0xBF, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xFF, 0x00, 0x7F, 0xC0, 0x0F, 0xFF,
-    0xC0, 0x7F, 0xC0, 0x07, 0xFF, 0xF0, 0x7F, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xF0,
-    0x00, 0x00, 0x2F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xC0,
-    0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x00,
-    0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF,
-    0x80, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00,
-    0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x6A, 0x40, 0x00, 0x00, 0x01,
-    0xA8, 0x0A, 0xA8, 0x00, 0x00, 0x02, 0xA9, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x0F, 0xFE,
-    0x00, 0x00, 0x0F, 0xFF, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0x00, 0x2F,
-    0xFF, 0x01, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x02, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x2F, 0xEF, 0xF0, 0x00, 0xFF, 0xBF, 0x42, 0xFD, 0xFF, 0x80, 0x2F,
-    0xEB, 0xF4, 0x2F, 0xCF, 0xFC, 0x03, 0xFD, 0xBF, 0x42, 0xFC, 0x7F, 0xD0, 0x7F, 0xCB, 0xF8, 0x3F,
-    0xC3, 0xFF, 0x0F, 0xF8, 0xBF, 0x83, 0xFC, 0x2F, 0xF0, 0xFF, 0x0F, 0xF8, 0x3F, 0xC0, 0xFF, 0xAF,
-    0xF0, 0xFF, 0xC3, 0xFC, 0x0F, 0xFF, 0xFD, 0x0F, 0xFC, 0x3F, 0xD0, 0x7F, 0xFF, 0xC0, 0xFF, 0xC3,
-    0xFD, 0x03, 0xFF, 0xFC, 0x0F, 0xFC, 0x3F, 0xD0, 0x2F, 0xFF, 0x40, 0xFF, 0xC3, 0xFD, 0x00, 0xFF,
-    0xF0, 0x0F, 0xFC, 0x3F, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC7, 0xFE, 0x00, 0x7F, 0xD0, 0x1F, 0xFD,
-    0x7F, 0xE0, 0x03, 0xFC, 0x01, 0xFF, 0xD7, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x81, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0xBF,
-    0xC0, 0x00, 0x03, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0x83, 0xFF,
-    0xE0, 0x00, 0x0F, 0xE0, 0xFF, 0xFC, 0x00, 0x07, 0xF8, 0x3F, 0xFF, 0x40, 0x01, 0xFD, 0x0F, 0xEF,
-    0xF0, 0x00, 0x7F, 0x43, 0xFA, 0xFD, 0x00, 0x2F, 0xD1, 0xFE, 0x3F, 0xC0, 0x0B, 0xF4, 0x7F, 0x8B,
-    0xF4, 0x02, 0xFD, 0x1F, 0xE0, 0xFF, 0x00, 0xFF, 0x0B, 0xF8, 0x2F, 0xD0, 0x3F, 0xC2, 0xFE, 0x03,
-    0xFC, 0x0F, 0xF0, 0xBF, 0x80, 0xBF, 0x43, 0xFC, 0x3F, 0xF0, 0x0F, 0xE0, 0xFF, 0x0F, 0xFC, 0x03,
-    0xFC, 0x3F, 0xC3, 0xFF, 0x00, 0x7F, 0x9F, 0xF0, 0xFF, 0xC0, 0x0F, 0xF7, 0xFC, 0x3F, 0xF0, 0x01,
-    0xFF, 0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0x87, 0xFF, 0x00, 0x07, 0xFF, 0xE1, 0xFF, 0xC0, 0x00,
-    0xFF, 0xF8, 0x7F, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x05, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x50, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xEF, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xD0, 0x0B, 0xFD,
-    0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x82, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xD0, 0x00,
-    0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC2, 0xFF,
-    0xF5, 0x01, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xEB, 0xFF, 0xFF, 0xFF, 0xBC, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0x2F, 0xBC, 0x00, 0x02, 0xFB, 0xC0,
-    0x00, 0x2F, 0xBC, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0x2F, 0xBC, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0x2F,
-    0xBC, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0x2F, 0xBC, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0x2F, 0xBC, 0x00,
-    0x02, 0xFB, 0xC0, 0x00, 0x2F, 0xBC, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0x2F, 0xBC, 0x00, 0x02, 0xFB,
-    0xC0, 0x00, 0x2F, 0xBC, 0x00, 0x02, 0xF0, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x02,
-    0xFE, 0xAF, 0xFF, 0xC0, 0xBE, 0x00, 0x07, 0xFC, 0x2F, 0x80, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x0B,
-    0xD2, 0xF8, 0x00, 0x02, 0xF8, 0xFE, 0x00, 0x00, 0xFD, 0x3F, 0x80, 0x00, 0x3F, 0x4F, 0xE0, 0x00,
-    0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFE,
-    0xA9, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0x78, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA5,
-    0x50, 0xFD, 0x00, 0x55, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x81, 0xFD, 0x00,
-    0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x02, 0xFD, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0,
-    0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xD4,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0xFF, 0xF8, 0x3D, 0x0B, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x0F, 0x40, 0x3F, 0xFC, 0x00,
-    0xBF, 0xE0, 0x03, 0xD0, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0xF4, 0x00, 0x3F, 0xF0, 0x2F, 0xF0,
-    0x00, 0x3D, 0x00, 0x07, 0xFE, 0x0F, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0xFF, 0xC3, 0xFC, 0x00, 0x03,
-    0xD0, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x7C, 0x00,
-    0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xC3, 0xFD, 0x00, 0x07, 0xC0, 0x00, 0x2F,
-    0xF0, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x1F, 0xF8, 0x2F, 0xFD, 0x00, 0x7C, 0x00, 0x2F, 0xFD, 0x03,
-    0xFF, 0xFA, 0x6F, 0x56, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x40, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00,
-    0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF2, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x1F,
-    0xF8, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFC, 0x00,
-    0xBF, 0xE0, 0x00, 0x2F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x7F,
-    0xF0, 0x68, 0x00, 0x38, 0x00, 0x28, 0xBC, 0x00, 0x3C, 0x00, 0x3D, 0xBC, 0x00, 0x3C, 0x00, 0x3C,
-    0xBC, 0x00, 0x7C, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x7C, 0x00, 0x78, 0x00, 0xBC, 0x7C,
-    0x00, 0x78, 0x00, 0xFC, 0x3E, 0x00, 0x78, 0x00, 0xF8, 0x3F, 0x00, 0x78, 0x03, 0xF8, 0x2F, 0xC0,
-    0x78, 0x0B, 0xF0, 0x0F, 0xF0, 0x78, 0x2F, 0xF0, 0x0B, 0xFF, 0xFE, 0xFF, 0xC0, 0x02, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x06, 0xFD, 0x00, 0x0F, 0xE0,
-    0x00, 0x1F, 0xC0, 0x0B, 0xF0, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x41, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00,
-    0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00,
-    0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x00, 0x0F, 0xD2, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x7E, 0x00, 0x00,
-    0x03, 0xFC, 0x0F, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xE0, 0x03,
-    0xFD, 0x02, 0xFF, 0xFC, 0x01, 0xFF, 0xFE, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0xAF, 0xFF, 0xD0, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x7C,
-    0x00, 0x00, 0x7F, 0xFF, 0xBC, 0x00, 0x01, 0xFE, 0xAF, 0xFC, 0x00, 0x03, 0xF0, 0x02, 0xFC, 0x00,
-    0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xBD, 0x00, 0x0F, 0x00, 0x00, 0xBD, 0x00, 0x1F,
-    0x00, 0x00, 0x7E, 0x00, 0x1F, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0x40,
-    0x02, 0xFF, 0x00, 0x1F, 0xF9, 0x6F, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0x46, 0x01, 0xFF, 0xFF, 0x5F, 0xFF, 0x00, 0x2F, 0xF8, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x06,
-    0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x02, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x2F, 0x80, 0x7F, 0x40, 0x3F, 0x00, 0x0B, 0xC0, 0xBD, 0x00,
-    0x03, 0xE0, 0xBC, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x02, 0xE0, 0xBC, 0x00, 0x03, 0xD0, 0xBC, 0x01,
-    0x6F, 0x80, 0xBC, 0x0B, 0xFD, 0x00, 0xBC, 0x0B, 0xFF, 0x80, 0xBC, 0x00, 0x0B, 0xF4, 0xBC, 0x00,
-    0x00, 0xFC, 0xBC, 0x00, 0x00, 0xBD, 0xBD, 0x00, 0x00, 0xBE, 0xBF, 0x90, 0x00, 0xFE, 0xBF, 0xFE,
-    0x02, 0xFE, 0xBF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFC, 0xBC, 0x7F, 0xFF, 0xF8, 0xBC, 0x02,
-    0xFF, 0xF0, 0xBC, 0x00, 0x15, 0x40, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0xFC, 0x2F, 0x40, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0xFC, 0x03, 0xF0,
-    0x00, 0xFC, 0x03, 0xF4, 0x01, 0xF8, 0x01, 0xFC, 0x01, 0xF8, 0x00, 0xFE, 0x02, 0xF4, 0x00, 0x7F,
-    0x03, 0xF0, 0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x2F, 0xEF, 0xD0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0xBF,
-    0xFE, 0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x3F, 0x81, 0x6F, 0xE0, 0x3F, 0x00, 0x00, 0x10, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x05, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x1F, 0xF4, 0x1B, 0xF4, 0x3F, 0xC0, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0xFD, 0xBF, 0x00,
-    0x00, 0xBE, 0xBF, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0xBE, 0x7F, 0x80, 0x00, 0xFE, 0x3F, 0xE0,
-    0x07, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F,
-    0xF8, 0x00, 0x06, 0xFD, 0x00, 0x1E, 0x57, 0x80, 0x34, 0x01, 0xC0, 0x70, 0x00, 0x40, 0x34, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xA0, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x01, 0xE0,
-    0xB8, 0x01, 0xF0, 0x7C, 0x02, 0xF0, 0x3F, 0xEF, 0xE0, 0x1F, 0xFF, 0xC0, 0x02, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x0B, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x1B, 0xF8, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x05, 0x50, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0xBD, 0x1F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFE, 0x40, 0xBD, 0x00, 0xFD, 0x00, 0x0F,
-    0xC0, 0x7F, 0x00, 0x01, 0xF0, 0x1F, 0x80, 0x00, 0x7C, 0x07, 0xD0, 0x00, 0x0F, 0x41, 0xF4, 0x00,
-    0x07, 0xD0, 0x7E, 0x00, 0x01, 0xF4, 0x2F, 0x80, 0x00, 0x7D, 0x0B, 0xE0, 0x00, 0x1F, 0x42, 0xFC,
-    0x00, 0x07, 0xD0, 0xBF, 0x00, 0x02, 0xF8, 0x3F, 0xC0, 0x00, 0xBE, 0x0F, 0xF0, 0x00, 0x2F, 0x83,
-    0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xF4, 0x6F, 0x00, 0x07, 0xC0,
-    0x07, 0xC0, 0x0F, 0x40, 0x02, 0xE0, 0x2F, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0xF4, 0x3E, 0x00,
-    0x00, 0xF8, 0x7D, 0x00, 0x00, 0xFC, 0xBE, 0x55, 0x55, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFC, 0xBE, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x02, 0xFC, 0x7F, 0x40,
-    0x03, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xF9, 0x6F, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0A, 0x00,
-    0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00,
-    0x2F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x80, 0x7F, 0xEC,
-    0x7F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0x0F, 0x80, 0xF8, 0x00, 0xF8,
-    0x3F, 0x00, 0x0F, 0x47, 0xD0, 0x00, 0xF4, 0xFC, 0x00, 0x0F, 0x6F, 0x00, 0x01, 0xF7, 0xE0, 0x00,
-    0x1F, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x2F, 0xBF,
-    0x40, 0x03, 0xF3, 0xFD, 0x00, 0x3F, 0x0F, 0xF4, 0x03, 0xF0, 0x7F, 0xD0, 0x3F, 0x02, 0xFF, 0x43,
-    0xE0, 0x0F, 0xFD, 0x1A, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00,
-    0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFB, 0xF8, 0x00, 0x03,
-    0xFC, 0xBF, 0x00, 0x01, 0xFD, 0x1F, 0xC0, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0xFD, 0x00,
-    0x3F, 0x80, 0x1F, 0x80, 0x1F, 0xC0, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x2F,
-    0x43, 0xF0, 0x00, 0x03, 0xE1, 0xF8, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0xBD, 0x3F, 0x40, 0x00,
-    0xBD, 0x3F, 0x40, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0xBD, 0x7F, 0x80, 0x00,
-    0xFD, 0x7F, 0xC0, 0x00, 0xFE, 0x7F, 0xC0, 0x00, 0xFE, 0x7F, 0xC0, 0x00, 0xFE, 0x7F, 0xC0, 0x00,
-    0xFE, 0x7F, 0xE0, 0x03, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBB, 0xFF, 0xFF,
-    0xFF, 0xB6, 0xFF, 0xFF, 0x7F, 0xB4, 0x7F, 0xF8, 0x7F, 0xB4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0xFC, 0x2F, 0x40, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0xFC, 0x03, 0xF8, 0x01, 0xFC, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0xFE, 0x02, 0xF8, 0x00, 0x7F, 0x03,
-    0xF0, 0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x2F, 0xEF, 0xD0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFE,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFE, 0xBF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D,
-    0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F,
-    0x00, 0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01,
-    0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x2F, 0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x1F, 0x40, 0x03, 0xF0, 0x07, 0xC0, 0x00, 0xFC, 0x02, 0xF0,
-    0x00, 0x3E, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0xF4, 0x03,
-    0xE0, 0x00, 0x7D, 0x00, 0xF4, 0x00, 0x1F, 0x40, 0x7D, 0x00, 0x07, 0xC0, 0x1F, 0xD4, 0x02, 0xF0,
-    0x07, 0xFF, 0x00, 0xBC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00,
-    0x01, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFD, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x1F,
-    0x40, 0xBE, 0x00, 0x03, 0xE0, 0x3F, 0x80, 0x00, 0xF8, 0x0F, 0xD0, 0x00, 0x3F, 0x03, 0xF4, 0x00,
-    0x0F, 0xC1, 0xFE, 0x00, 0x03, 0xF0, 0xBF, 0xC0, 0x01, 0xF8, 0x3F, 0xFD, 0x01, 0xFD, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x41, 0xFD, 0xFF, 0xFF, 0x80, 0x7F, 0x0B, 0xFF, 0x40, 0x2F,
-    0xC0, 0x04, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x0F, 0xFF, 0xF4, 0x3E, 0x00, 0xBD, 0x7C, 0x00, 0x04, 0xB8, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x07, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0xBF, 0xF0, 0x00, 0x1F, 0xC0, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0x00, 0x3E,
-    0x00, 0xBD, 0x00, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00,
-    0x3F, 0xE5, 0x5B, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x01,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0xB4, 0x2E, 0x00, 0x1F, 0x0B, 0x80, 0x03, 0xD1, 0xF0,
-    0x00, 0x7C, 0x7C, 0x00, 0x1F, 0x1F, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3D,
-    0x00, 0x0F, 0x8F, 0x40, 0x03, 0xE3, 0xF0, 0x00, 0xF8, 0xFE, 0x00, 0xBE, 0x2F, 0xFF, 0xFF, 0x47,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xD0, 0x00, 0x59, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xF8, 0xB8, 0x7F, 0xF4, 0x02, 0xFF, 0x42, 0xE0,
-    0x3F, 0xF0, 0x0F, 0xF4, 0x0B, 0x40, 0x3F, 0xE0, 0xBF, 0x80, 0x2D, 0x00, 0x7F, 0xC3, 0xFC, 0x00,
-    0xB4, 0x00, 0xFF, 0x4F, 0xF0, 0x02, 0xD0, 0x01, 0xFD, 0x7F, 0x40, 0x0B, 0x40, 0x03, 0xF9, 0xFD,
-    0x00, 0x2D, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0xB4, 0x00, 0x3F, 0xDF, 0xC0, 0x02, 0xD0, 0x00, 0xBF,
-    0x7F, 0x00, 0x0B, 0x40, 0x02, 0xF9, 0xFC, 0x00, 0x2D, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0xF4, 0x00,
-    0x3F, 0x8F, 0xF0, 0x03, 0xD0, 0x02, 0xFD, 0x3F, 0xF0, 0x0F, 0x00, 0x2F, 0xF0, 0xBF, 0xF9, 0x3D,
-    0x1B, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0xAF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x40, 0x00, 0x02,
-    0xE0, 0x3F, 0xF4, 0x00, 0x07, 0xC0, 0x3F, 0xFE, 0x00, 0x0F, 0x80, 0x1B, 0xFF, 0x40, 0x3F, 0x00,
-    0x00, 0x7F, 0xC0, 0xBD, 0x00, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0xDB, 0xF0, 0x00, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x00, 0xFF, 0x43, 0xFC,
-    0x00, 0x02, 0xFE, 0x01, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0xFE, 0x0F, 0xF4, 0x00, 0x7F, 0xFE,
-    0x2F, 0xF0, 0x00, 0x2F, 0xFE, 0x7F, 0xD0, 0x00, 0x06, 0xFE, 0x00, 0x04, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x1E, 0x00, 0x02, 0xE0, 0x3C, 0x1E,
-    0x0B, 0x80, 0xF0, 0x3D, 0x1F, 0x03, 0xC0, 0x7C, 0x7C, 0x0F, 0x00, 0xF1, 0xF0, 0x3C, 0x03, 0xC7,
-    0xC0, 0xF0, 0x0F, 0x4F, 0x03, 0xC0, 0x3E, 0x3C, 0x0F, 0x00, 0xB8, 0xF4, 0x3D, 0x02, 0xE3, 0xF0,
-    0xB4, 0x0F, 0x8F, 0xD2, 0xD0, 0x7E, 0x2F, 0xFF, 0xAF, 0xF8, 0x7F, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x68, 0x00, 0x00, 0x50, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x03, 0xF0,
-    0x00, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0xF8,
-    0x00, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x0C, 0x00, 0x2F, 0x02, 0xF4, 0x01, 0xC0, 0x02, 0xF0, 0x2F,
-    0x40, 0x1D, 0x00, 0x2F, 0x02, 0xF4, 0x01, 0xD0, 0x03, 0xF0, 0x1F, 0x80, 0x2E, 0x00, 0x7E, 0x00,
-    0xFE, 0x07, 0xF4, 0x2F, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x3F, 0xFF, 0x00,
-    0x00, 0x1A, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x8B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00,
-    0x2F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00,
-    0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x3F,
-    0x80, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x0F,
-    0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x1F, 0x00, 0x07, 0xFF, 0xFB, 0xC0, 0x07, 0xFA, 0xBF, 0xF0,
-    0x03, 0xF0, 0x02, 0xFC, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x3C, 0x00, 0x02,
-    0xF4, 0x1F, 0x00, 0x00, 0x7E, 0x07, 0xC0, 0x00, 0x2F, 0x82, 0xF0, 0x00, 0x0F, 0xF0, 0x7D, 0x00,
-    0x0B, 0xFC, 0x0F, 0xF9, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xFD, 0x7D, 0x00, 0x2F, 0xF8, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x01, 0x91, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00,
-    0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00,
-    0x00, 0x02, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x02, 0x07, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x87, 0xC0, 0x01, 0xFF,
-    0xFE, 0xF0, 0x01, 0xFE, 0xAF, 0xFC, 0x00, 0xFC, 0x00, 0xBF, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x3E,
-    0x00, 0x02, 0xF4, 0x0F, 0x00, 0x00, 0xBD, 0x07, 0xC0, 0x00, 0x1F, 0x81, 0xF0, 0x00, 0x0B, 0xE0,
-    0xBC, 0x00, 0x03, 0xFC, 0x1F, 0x40, 0x02, 0xFF, 0x03, 0xFE, 0x5B, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x5F, 0x40, 0x0B, 0xFE, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0x80, 0x00, 0x00, 0x00, 0xF0,
-    0x07, 0x80, 0x00, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x8B,
-    0xE0, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F,
-    0x80, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00,
-    0x2F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80,
-    0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xF4,
-    0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x7D, 0x1F, 0x00, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x02, 0x40, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x7C, 0x00, 0x07, 0xFF, 0xFB, 0xC0, 0x01, 0xFE, 0xAF, 0xFC, 0x00,
-    0x3F, 0x00, 0x2F, 0xC0, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x0F, 0x00, 0x00,
-    0xBD, 0x01, 0xF0, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x00, 0xBE, 0x02, 0xF0, 0x00, 0x0F, 0xF0, 0x1F,
-    0x40, 0x02, 0xFF, 0x00, 0xFF, 0x96, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0x5F, 0x40, 0x02, 0xFF, 0x81, 0xF4, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0x16, 0x81, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x80, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x2F,
-    0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4B, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0xBC, 0x00, 0x00, 0x07, 0x80, 0x1F, 0x00, 0x00,
-    0x09, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE1, 0xF0, 0x00, 0x01,
-    0xFF, 0xFE, 0xF0, 0x00, 0x07, 0xFA, 0xBF, 0xF0, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00, 0x2F, 0x00,
-    0x03, 0xF0, 0x00, 0x3E, 0x00, 0x02, 0xF4, 0x00, 0x3C, 0x00, 0x02, 0xF4, 0x00, 0x7C, 0x00, 0x01,
-    0xF8, 0x00, 0x7C, 0x00, 0x02, 0xF8, 0x00, 0xBC, 0x00, 0x03, 0xFC, 0x00, 0x7D, 0x00, 0x0B, 0xFC,
-    0x00, 0x3F, 0xE5, 0xBF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xFD, 0x7D, 0x00, 0x00, 0xBF, 0xE0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x02, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x00, 0x0E,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0xFD,
-    0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x00,
-    0xFD, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x00,
-    0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xBF,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F,
-    0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0x43, 0xC0, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xAF, 0x00, 0x00, 0x1F, 0x01, 0xF0, 0x00,
-    0x1E, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x1F,
-    0x00, 0x07, 0xFF, 0xFB, 0xC0, 0x07, 0xFA, 0xBF, 0xF0, 0x03, 0xF0, 0x02, 0xFC, 0x02, 0xF0, 0x00,
-    0x3F, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x3C, 0x00, 0x02, 0xF4, 0x1F, 0x00, 0x00, 0x7E, 0x07, 0xC0,
-    0x00, 0x2F, 0x82, 0xF0, 0x00, 0x0F, 0xF0, 0x7D, 0x00, 0x0B, 0xFC, 0x0F, 0xF9, 0x6F, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x7D, 0x00, 0x2F, 0xF8, 0x1F,
-    0x40, 0x00, 0x00, 0xF8, 0x03, 0x80, 0x00, 0x00, 0x0F, 0xB8, 0x0E, 0x00, 0x00, 0x00, 0x38, 0x78,
-    0x34, 0x00, 0x00, 0x01, 0xD0, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0x40, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xDB, 0xC0, 0x00,
-    0x00, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0x40, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE2, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x47, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80,
-    0x00, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0,
-    0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x38, 0x00,
-    0x0F, 0x2C, 0x0D, 0x00, 0x07, 0x43, 0xC7, 0x40, 0x01, 0xD0, 0x7F, 0xC0, 0x00, 0x74, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xB8, 0xBC, 0x00, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0xA0,
-    0x00, 0x28, 0x00, 0x00, 0xBF, 0x87, 0xC0, 0x01, 0xFF, 0xFE, 0xF0, 0x01, 0xFE, 0xAF, 0xFC, 0x00,
-    0xFC, 0x00, 0xBF, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x02, 0xF4, 0x0F, 0x00, 0x00, 0xBD,
-    0x07, 0xC0, 0x00, 0x1F, 0x81, 0xF0, 0x00, 0x0B, 0xE0, 0xBC, 0x00, 0x03, 0xFC, 0x1F, 0x40, 0x02,
-    0xFF, 0x03, 0xFE, 0x5B, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF,
-    0xFF, 0x5F, 0x40, 0x0B, 0xFE, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x2E, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x1E, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x7E,
-    0x2F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00,
-    0xBE, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x00,
-    0x00, 0xBE, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE,
-    0x00, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x3F,
-    0xD0, 0x00, 0x00, 0x1F, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x7D, 0x2F, 0x00, 0x00, 0x78, 0x01, 0xF0, 0x00, 0x24, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x7C, 0x00, 0x1F, 0xFF, 0xEF, 0x00, 0x1F, 0xEA, 0xFF, 0xC0, 0x0F, 0xC0,
-    0x0B, 0xF0, 0x0B, 0xC0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x2F, 0x40, 0xF0, 0x00, 0x0B, 0xD0, 0x7C,
-    0x00, 0x01, 0xF8, 0x1F, 0x00, 0x00, 0xBE, 0x0B, 0xC0, 0x00, 0x3F, 0xC1, 0xF4, 0x00, 0x2F, 0xF0,
-    0x3F, 0xE5, 0xBF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF5,
-    0xF4, 0x00, 0xBF, 0xE0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x60, 0x00, 0x00, 0x0F, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x2E, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xEF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x00, 0x00, 0x0F,
-    0xD1, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0x00,
-    0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0xBF, 0x00,
-    0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x0B,
-    0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC7,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x02, 0xC0, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0xB8, 0x00,
-    0xB8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x7C, 0x00,
-    0x1F, 0xFF, 0xEF, 0x00, 0x1F, 0xEA, 0xFF, 0xC0, 0x0F, 0xC0, 0x0B, 0xF0, 0x0B, 0xC0, 0x00, 0xFC,
-    0x03, 0xE0, 0x00, 0x2F, 0x40, 0xF0, 0x00, 0x0B, 0xD0, 0x7C, 0x00, 0x01, 0xF8, 0x1F, 0x00, 0x00,
-    0xBE, 0x0B, 0xC0, 0x00, 0x3F, 0xC1, 0xF4, 0x00, 0x2F, 0xF0, 0x3F, 0xE5, 0xBF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF5, 0xF4, 0x00, 0xBF, 0xE0, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x06, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0x02,
-    0xE0, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0xFD, 0x00,
-    0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF,
-    0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x01, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x0F,
-    0x00, 0x0B, 0xC0, 0x0B, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x6A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x87, 0xC0, 0x01, 0xFF, 0xFE, 0xF0, 0x01, 0xFE, 0xAF, 0xFC, 0x00, 0xFC, 0x00, 0xBF, 0x00,
-    0xBC, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x02, 0xF4, 0x0F, 0x00, 0x00, 0xBD, 0x07, 0xC0, 0x00, 0x1F,
-    0x81, 0xF0, 0x00, 0x0B, 0xE0, 0xBC, 0x00, 0x03, 0xFC, 0x1F, 0x40, 0x02, 0xFF, 0x03, 0xFE, 0x5B,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x5F, 0x40, 0x0B,
-    0xFE, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x60, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2E,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD1, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x1F, 0xC0,
-    0x00, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xD0, 0x01,
-    0xFC, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xD0,
-    0x00, 0x0F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF4,
-    0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x0F, 0xAB, 0xE0, 0x00, 0x01, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x06, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x87, 0xC0, 0x01, 0xFF, 0xFE, 0xF0, 0x01, 0xFE, 0xAF, 0xFC, 0x00, 0xFC, 0x00, 0xBF,
-    0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x02, 0xF4, 0x0F, 0x00, 0x00, 0xBD, 0x07, 0xC0, 0x00,
-    0x1F, 0x81, 0xF0, 0x00, 0x0B, 0xE0, 0xBC, 0x00, 0x03, 0xFC, 0x1F, 0x40, 0x02, 0xFF, 0x03, 0xFE,
-    0x5B, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x5F, 0x40,
-    0x0B, 0xFE, 0x07, 0xD0, 0x00, 0x01, 0xF8, 0x03, 0x80, 0x00, 0x00, 0x0F, 0xB8, 0x0E, 0x00, 0x00,
-    0x00, 0x74, 0x78, 0x34, 0x00, 0x00, 0x01, 0xD0, 0xBF, 0xC0, 0x00, 0x00, 0x0B, 0x40, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x06, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x3C, 0x00, 0x00, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00,
-    0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00,
-    0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x0B,
-    0xF0, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80,
-    0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x07,
-    0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x7E, 0x00, 0xE0, 0x00, 0x3E, 0xF0, 0x34, 0x00,
-    0x1D, 0x1E, 0x1D, 0x00, 0x07, 0x41, 0xFF, 0x00, 0x01, 0xC0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x2C, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x0B, 0xC0, 0x0B, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFF, 0xC0, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x87, 0xC0, 0x01, 0xFF, 0xFE, 0xF0, 0x01, 0xFE, 0xAF, 0xFC,
-    0x00, 0xFC, 0x00, 0xBF, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x02, 0xF4, 0x0F, 0x00, 0x00,
-    0xBD, 0x07, 0xC0, 0x00, 0x1F, 0x81, 0xF0, 0x00, 0x0B, 0xE0, 0xBC, 0x00, 0x03, 0xFC, 0x1F, 0x40,
-    0x02, 0xFF, 0x03, 0xFE, 0x5B, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xFF, 0x5F, 0x40, 0x0B, 0xFE, 0x07, 0xD0, 0x00, 0x0A, 0x00, 0x01, 0x80, 0x00, 0x00, 0x3C,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE2, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x47, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80,
-    0x00, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0,
-    0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xB0, 0x00,
-    0xF0, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x2E, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x1F, 0x00, 0x07, 0xFF, 0xFB, 0xC0, 0x07, 0xFA, 0xBF, 0xF0, 0x03, 0xF0,
-    0x02, 0xFC, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x3C, 0x00, 0x02, 0xF4, 0x1F,
-    0x00, 0x00, 0x7E, 0x07, 0xC0, 0x00, 0x2F, 0x82, 0xF0, 0x00, 0x0F, 0xF0, 0x7D, 0x00, 0x0B, 0xFC,
-    0x0F, 0xF9, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD,
-    0x7D, 0x00, 0x2F, 0xF8, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x82, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x90, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x03, 0xF9, 0x56, 0xA4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0,
-    0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9,
-    0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1B, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x40, 0xF0,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x2F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x83,
-    0xFF, 0xFF, 0xFF, 0x80, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xE5, 0x5A,
-    0x90, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xE0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x14, 0x1D, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00,
-    0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x14, 0x00, 0x90, 0x00, 0x1F, 0xE0, 0x2C, 0x00, 0x0F, 0x1E,
-    0x0E, 0x00, 0x03, 0x82, 0xFF, 0x40, 0x01, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x42,
-    0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xE4, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x55, 0xA9, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBD, 0x01, 0xC0, 0x01, 0xFB, 0x41, 0xC0, 0x02, 0xC2,
-    0xC2, 0xC0, 0x03, 0xC0, 0xFB, 0xC0, 0x03, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0,
-    0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02,
-    0x90, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03,
-    0xD1, 0xF0, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0x90, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x95, 0x6A, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x01, 0xF0, 0x00, 0x0F, 0xE0, 0x0F, 0x80, 0x00, 0xBF,
-    0xE0, 0x7D, 0x00, 0x0B, 0x83, 0xE0, 0x00, 0x00, 0xB4, 0x01, 0xE0, 0x00, 0x06, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xFE, 0x00,
-    0xF4, 0x00, 0x0F, 0xC0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x03, 0xE0, 0x05, 0x6B, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xE9, 0x02, 0xF5, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x60, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x6F, 0xFA, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x01, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x16, 0x80, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x00, 0x0A,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x56, 0xA4, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x83,
-    0xC0, 0x00, 0x00, 0x05, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2E, 0x0F, 0x80,
-    0x00, 0x02, 0xD0, 0x07, 0x80, 0x00, 0x18, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x03, 0xF8, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x03, 0xC0,
-    0x01, 0xF0, 0x00, 0x07, 0xC0, 0x0F, 0x80, 0x15, 0xAF, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF,
-    0xFF, 0xFF, 0xA4, 0x0B, 0xD4, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x01, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xE8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x41, 0xD0, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00,
-    0x28, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x3F,
-    0x90, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x95, 0x6A, 0x40, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x90, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0xB8, 0x0B, 0x80, 0x02, 0xC0, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0,
-    0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x05, 0x00, 0xA0, 0x00, 0x1F, 0xE0, 0x2C, 0x00, 0x0F,
-    0x2D, 0x0A, 0x00, 0x03, 0x83, 0xC3, 0x80, 0x00, 0xE0, 0x3F, 0xD0, 0x00, 0x10, 0x02, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x78, 0x03, 0xC0, 0x00, 0x74, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x2F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x80, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0F, 0xE5, 0x5A, 0x90, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0xBD, 0x01, 0xC0, 0x01, 0xFB, 0x41, 0xC0, 0x02, 0xC2, 0xC1, 0xC0, 0x03, 0xC0, 0xFB, 0xC0,
-    0x03, 0xC0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x7C, 0x1F, 0x00,
-    0x01, 0xE0, 0x03, 0xC0, 0x02, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0,
-    0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0xA0, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x90, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF9, 0x56, 0xA4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0xB8, 0x2E, 0x00, 0x02, 0xD0, 0x07, 0x80, 0x06, 0x00, 0x00, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00,
-    0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B,
-    0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0x45, 0x0B, 0x40, 0x2C, 0x02, 0xD0, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x42, 0xFD, 0x0B, 0xF4, 0x2F, 0xD0,
-    0x7F, 0x41, 0xFD, 0x07, 0xF4, 0x1F, 0xD0, 0x7F, 0x41, 0xFD, 0x07, 0xF4, 0x1F, 0xD0, 0x7F, 0x41,
-    0xFD, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x81, 0xFE, 0x07, 0xFC, 0x2F, 0xF0, 0xBF, 0xC2, 0xFF, 0x0F,
-    0xFC, 0x3F, 0xF0, 0xFF, 0xC0, 0x7F, 0x88, 0x0F, 0x00, 0xE0, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2E, 0x02, 0xE0, 0x2F, 0x02, 0xF0,
-    0x2F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF4, 0x7F, 0x40, 0x2A, 0x90,
-    0xBF, 0x42, 0xFD, 0x0B, 0xF4, 0x1F, 0xD0, 0x7F, 0x41, 0xFD, 0x07, 0xF4, 0x1F, 0xD0, 0x7F, 0x41,
-    0xFD, 0x07, 0xF4, 0x1F, 0xD0, 0x7F, 0x41, 0xFE, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x81, 0xFF, 0x0B,
-    0xFC, 0x2F, 0xF0, 0xBF, 0xC3, 0xFF, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x7F, 0x42, 0xFD, 0x0F, 0xF8, 0x3F, 0xE0, 0x0B, 0xD0, 0x3F, 0x80, 0xFE, 0x07, 0xFC, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2E,
-    0x00, 0xB8, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC,
-    0x03, 0xF0, 0x0F, 0xD0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xBF, 0x03, 0xFC, 0x0F, 0xF0,
-    0x7F, 0xD0, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF,
-    0xEF, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x3F,
-    0xD0, 0x00, 0x00, 0xFF, 0x82, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD,
-    0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0,
-    0x00, 0x00, 0x0B, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE,
-    0xBF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00,
-    0x00, 0x7E, 0xBD, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00,
-    0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0xBF, 0xFE, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
-    0x00, 0x03, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0,
-    0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE3,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0x4F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xFF, 0x50, 0x16, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1B,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x14, 0x2C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9,
-    0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00,
-    0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00,
-    0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xD0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xF8, 0x00, 0x02, 0x80, 0x0B, 0xFF, 0xEF, 0xFF, 0xD0, 0x01, 0xE0, 0x0F, 0xFE, 0x00,
-    0x1F, 0xFD, 0x00, 0xF4, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x7C, 0x03, 0xFD, 0x00, 0x00, 0x0F,
-    0xF8, 0x3E, 0x02, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x1F, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1F, 0x00, 0x03, 0xC0, 0x00, 0xFE,
-    0x00, 0x1F, 0x00, 0x0F, 0xFE, 0x00, 0xF8, 0x00, 0xF4, 0x2E, 0x07, 0xC0, 0x0F, 0x00, 0x1E, 0x2A,
-    0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF,
-    0x80, 0x00, 0x2F, 0xFA, 0xFF, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x3E, 0x00, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0x03, 0xE0, 0x2F, 0x40,
-    0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x03, 0xFE, 0x55, 0xBF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0x41, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x2E, 0x00,
-    0x00, 0x00, 0x01, 0xD0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x0B, 0xFF, 0xEF, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFD, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0xFF, 0xC0, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x02, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0xFE, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x7F,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x81, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x0F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x01, 0x40, 0x00, 0x00, 0x7F, 0x87, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x2E, 0x00, 0x00, 0x03,
-    0x80, 0x07, 0x80, 0x00, 0x05, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFE, 0xBF, 0xF0, 0x00, 0x1F, 0xC0, 0x02, 0xF4,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x00, 0x7E, 0x00,
-    0xBD, 0x00, 0x00, 0x3E, 0x00, 0xBD, 0x00, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x3F,
-    0x00, 0x00, 0xFD, 0x00, 0x3F, 0xE5, 0x5B, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0xB8, 0x00, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xBF, 0xFF, 0x40, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0x2F, 0xF4,
-    0x00, 0x03, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFE, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x3F,
-    0xC0, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x9F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x40, 0x00,
-    0x00, 0x03, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD3, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xFF,
-    0xD4, 0x05, 0xBF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x04, 0x1D, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0, 0x02,
-    0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00,
-    0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5, 0x5B,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0xBC, 0x02, 0xC0, 0x00, 0x00, 0x0B, 0xBC, 0x0B, 0x00, 0x00, 0x00, 0x3C, 0x3C,
-    0x3C, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xC0, 0x00,
-    0x00, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFE,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x03, 0xFD,
-    0x00, 0x00, 0x0F, 0xF8, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD3,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x03,
-    0xF9, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0x00,
-    0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0x4F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xFF, 0x50, 0x16, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1B, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x80, 0x00, 0xFF, 0x01, 0xC0, 0x02,
-    0xD7, 0xC2, 0xC0, 0x03, 0xC1, 0xFB, 0x80, 0x03, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x2F, 0xBC, 0x00, 0x00, 0xB8, 0x1F, 0x00, 0x02, 0xD0, 0x03, 0xC0, 0x01, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02,
-    0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E,
-    0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E,
-    0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBE,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xEF, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xD0,
-    0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x82, 0xFE, 0x00, 0x00, 0x01,
-    0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F,
-    0xD0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xC2, 0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0xF4, 0x2E,
-    0x00, 0x03, 0x80, 0x07, 0x80, 0x05, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF,
-    0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00,
-    0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00,
-    0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF,
-    0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x06,
-    0xFF, 0xE4, 0x00, 0x1D, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x0B, 0x40, 0x2F, 0xFF, 0xBF, 0xFF, 0x43,
-    0xC0, 0x3F, 0xF8, 0x00, 0x7F, 0xF6, 0xE0, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0xF0, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0xF0, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0xFE, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x81, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x7F,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xFF,
-    0xD4, 0x05, 0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x02, 0xFF, 0x90, 0x0D,
-    0x02, 0xFF, 0xFF, 0x80, 0xD0, 0xBF, 0xEB, 0xFF, 0x2C, 0x1F, 0xC0, 0x02, 0xFF, 0x43, 0xF0, 0x00,
-    0x0F, 0xD0, 0x3E, 0x00, 0x00, 0x7D, 0x07, 0xD0, 0x00, 0x07, 0xE0, 0xBD, 0x00, 0x00, 0x3E, 0x0B,
-    0xD0, 0x00, 0x07, 0xE0, 0x7E, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0xE5, 0x5B,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x6F, 0xFE,
-    0x40, 0x01, 0xD0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xB4, 0x02, 0xFF, 0xFB, 0xFF, 0xF4, 0x3C, 0x03,
-    0xFF, 0x80, 0x07, 0xFF, 0x6E, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x00, 0x00, 0x01, 0xFD, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0x81, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8,
-    0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0xFD, 0x40,
-    0x5B, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x02, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xD0, 0x02, 0xFF, 0x90, 0x0D, 0x02, 0xFF, 0xFF, 0x80, 0xD0, 0xBF, 0xEB, 0xFF, 0x2C, 0x1F, 0xC0,
-    0x02, 0xFF, 0x43, 0xF0, 0x00, 0x0F, 0xD0, 0x3E, 0x00, 0x00, 0x7D, 0x07, 0xD0, 0x00, 0x07, 0xE0,
-    0xBD, 0x00, 0x00, 0x3E, 0x0B, 0xD0, 0x00, 0x07, 0xE0, 0x7E, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00,
-    0x0F, 0xD0, 0x3F, 0xE5, 0x5B, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xE0, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x06,
-    0xFF, 0xE4, 0x00, 0x1D, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x0B, 0x40, 0x2F, 0xFF, 0xBF, 0xFF, 0x43,
-    0xC0, 0x3F, 0xF8, 0x00, 0x7F, 0xF6, 0xE0, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0xF0, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0xF0, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0xFE, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x81, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x7F,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xFF,
-    0xD4, 0x05, 0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x14, 0x2C, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x02, 0xFF, 0x90, 0x0D,
-    0x02, 0xFF, 0xFF, 0x80, 0xD0, 0xBF, 0xEB, 0xFF, 0x2C, 0x1F, 0xC0, 0x02, 0xFF, 0x43, 0xF0, 0x00,
-    0x0F, 0xD0, 0x3E, 0x00, 0x00, 0x7D, 0x07, 0xD0, 0x00, 0x07, 0xE0, 0xBD, 0x00, 0x00, 0x3E, 0x0B,
-    0xD0, 0x00, 0x07, 0xE0, 0x7E, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0xE5, 0x5B,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x70, 0x00,
-    0x00, 0x00, 0x2D, 0x78, 0x2C, 0x00, 0x00, 0x00, 0x0F, 0x0B, 0x4F, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x74, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x2D, 0x00,
-    0xBF, 0xFE, 0xFF, 0xFD, 0x0F, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xDB, 0x80, 0xBF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x0F, 0xF0,
-    0x00, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0xC0, 0x2F, 0xFF, 0x50, 0x16, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x01, 0xC0, 0x00, 0x1E, 0xF0, 0x2C, 0x00, 0x03, 0xC3,
-    0xC2, 0xC0, 0x00, 0x3C, 0x0F, 0xF8, 0x00, 0x03, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x02, 0xFF, 0x90, 0x0D, 0x02, 0xFF, 0xFF, 0x80, 0xD0,
-    0xBF, 0xEB, 0xFF, 0x2C, 0x1F, 0xC0, 0x02, 0xFF, 0x43, 0xF0, 0x00, 0x0F, 0xD0, 0x3E, 0x00, 0x00,
-    0x7D, 0x07, 0xD0, 0x00, 0x07, 0xE0, 0xBD, 0x00, 0x00, 0x3E, 0x0B, 0xD0, 0x00, 0x07, 0xE0, 0x7E,
-    0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0xE5, 0x5B, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x1B, 0xFF, 0x90,
-    0x00, 0x74, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x2D, 0x00, 0xBF, 0xFE, 0xFF, 0xFD, 0x0F, 0x00, 0xFF,
-    0xE0, 0x01, 0xFF, 0xDB, 0x80, 0xBF, 0xD0, 0x00, 0x0F, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0xFF,
-    0xC0, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC1, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x2F, 0xFF, 0x50, 0x16,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x2F, 0xF9, 0x00, 0xD0, 0x2F, 0xFF,
-    0xF8, 0x0D, 0x0B, 0xFE, 0xBF, 0xF2, 0xC1, 0xFC, 0x00, 0x2F, 0xF4, 0x3F, 0x00, 0x00, 0xFD, 0x03,
-    0xE0, 0x00, 0x07, 0xD0, 0x7D, 0x00, 0x00, 0x7E, 0x0B, 0xD0, 0x00, 0x03, 0xE0, 0xBD, 0x00, 0x00,
-    0x7E, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0xFD, 0x03, 0xFE, 0x55, 0xBF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F,
-    0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F,
-    0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFC,
-    0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x3F, 0xC0,
-    0x00, 0x02, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0xFA,
-    0x56, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x02, 0xF5, 0xF4, 0x00, 0x0B, 0xD7,
-    0xD0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF4, 0xF8, 0x00, 0x0F, 0xD3, 0xF0,
-    0x00, 0x3F, 0x8F, 0xC0, 0x00, 0xFE, 0x3F, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x0F, 0xE3, 0xF8, 0x00,
-    0xFF, 0x8B, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xDF,
-    0xC0, 0x7F, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x10, 0x78, 0x00, 0x00, 0x00, 0x00, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B,
-    0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F,
-    0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF,
-    0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF8,
-    0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xD0,
-    0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x02,
-    0xFF, 0xE9, 0x5B, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0x07, 0x40,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0xBD, 0x7D, 0x00, 0x02, 0xF5, 0xF4, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00,
-    0xBD, 0x3E, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0xFE,
-    0x3F, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x3F, 0xE2, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFE, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xF7, 0xF0, 0x1F, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x87, 0xFC,
-    0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x01,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x00,
-    0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0x00,
-    0x00, 0x07, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x3F,
-    0xC0, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xC0,
-    0x0B, 0xFF, 0xA5, 0x6F, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xD0, 0x00, 0x2F, 0x5C, 0x7D,
-    0x00, 0x02, 0xF6, 0xC7, 0xD0, 0x00, 0x2F, 0xF4, 0x7E, 0x00, 0x02, 0xFE, 0x07, 0xE0, 0x00, 0x2F,
-    0x40, 0x3E, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0,
-    0x00, 0x3F, 0x80, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xDF, 0xC0, 0x01, 0xFF,
-    0xE1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xE7, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x5F, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x7F, 0xC0, 0x00, 0x02,
-    0xFF, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xF0, 0x00,
-    0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFC,
-    0x00, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00,
-    0xFF, 0x00, 0x00, 0x07, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-    0x80, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0x00,
-    0x2F, 0xD0, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0xFA,
-    0x56, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xD0,
-    0x00, 0x2F, 0x5C, 0x7D, 0x00, 0x02, 0xF6, 0xC7, 0xD0, 0x00, 0x2F, 0xF4, 0x7E, 0x00, 0x02, 0xFE,
-    0x07, 0xE0, 0x00, 0x2F, 0x40, 0x3E, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00,
-    0x03, 0xF8, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0xFF, 0x80,
-    0x2F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xDF, 0xC0, 0x01, 0xFF, 0xE1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9F, 0xF4, 0x00, 0x00, 0xBF, 0xFD,
-    0x7F, 0xC0, 0x00, 0x02, 0xFF, 0xE1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x01, 0xFF, 0x00, 0x00,
-    0x0B, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xC0,
-    0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x0F,
-    0xF0, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x3F, 0xD0, 0x00, 0x03,
-    0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0xE9, 0x5B, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x74, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0xCB, 0xD0, 0x00, 0x2F, 0x5C, 0x7D, 0x00, 0x02, 0xF6, 0xC7, 0xD0, 0x00, 0x2F, 0xF4, 0x7E,
-    0x00, 0x02, 0xFE, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x3E, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x3F,
-    0x80, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF8,
-    0x01, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xDF, 0xC0, 0x01, 0xFF, 0xE1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x0C, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x34, 0x00, 0x00, 0x01, 0xE3, 0xC0, 0xD0, 0x00, 0x00,
-    0x0B, 0x03, 0x8B, 0x00, 0x00, 0x00, 0x2C, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x40, 0x06, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE7, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x5F, 0xF0, 0x00,
-    0x00, 0xBF, 0xF8, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x07, 0xFC,
-    0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x03, 0xFC, 0x00, 0x00,
-    0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0x00,
-    0x00, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x2F,
-    0xF0, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0xFA, 0x56, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x07,
-    0x00, 0x00, 0x7E, 0xD0, 0x70, 0x00, 0x0B, 0x0B, 0x07, 0x00, 0x00, 0xB0, 0x3E, 0xF0, 0x00, 0x0F,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xD0, 0x00, 0x2F, 0x5C, 0x7D, 0x00, 0x02, 0xF6, 0xC7, 0xD0,
-    0x00, 0x2F, 0xF4, 0x7E, 0x00, 0x02, 0xFE, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x3E, 0x00, 0x03, 0xF4,
-    0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00,
-    0x03, 0xF8, 0x03, 0xF8, 0x01, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xDF, 0xC0, 0x01, 0xFF, 0xE1, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0xF5, 0xFF,
-    0x00, 0x00, 0x0B, 0xFF, 0x87, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0,
-    0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-    0x07, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0xC0,
-    0x00, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x0F,
-    0xF0, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF4,
-    0x02, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x0B, 0xFF, 0xA5, 0x6F, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x0D,
-    0xBD, 0x00, 0x02, 0xF5, 0xC7, 0xD0, 0x00, 0x2F, 0x6C, 0x7D, 0x00, 0x02, 0xFF, 0x47, 0xE0, 0x00,
-    0x2F, 0xE0, 0x7E, 0x00, 0x02, 0xF4, 0x03, 0xE0, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x03, 0xF8, 0x03,
-    0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x1F,
-    0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFD, 0xFC, 0x00, 0x1F, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x16, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F,
-    0xC3, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x40, 0x00, 0x07, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xFC,
-    0x01, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x40,
-    0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x1F, 0xF0, 0x00,
-    0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x7E, 0x1F,
-    0x80, 0x00, 0xBD, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0xFC, 0x03, 0xF4, 0x02, 0xF8, 0x01,
-    0xFC, 0x03, 0xF4, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x7F, 0x47, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x00,
-    0x1F, 0xEF, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0x81, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x0B,
-    0xF4, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x02, 0xFD, 0x00, 0x03, 0xFD, 0x01, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x3F, 0xD0,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x0F, 0xD0,
-    0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x02, 0xF8, 0x00, 0x01, 0xFC, 0x03,
-    0xF4, 0x00, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x47, 0xF0, 0x00, 0x00, 0x3F, 0xCF, 0xE0,
-    0x00, 0x00, 0x1F, 0xEF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x6F,
-    0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x01, 0xFC, 0x2F, 0xFF, 0xC0, 0x02, 0xFC, 0x2F, 0xFE, 0x00,
-    0x03, 0xFC, 0x2F, 0x90, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x81, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x02, 0xFD, 0x00,
-    0x03, 0xFD, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00,
-    0x01, 0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x08, 0x1E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0xBD, 0x0F,
-    0xD0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0xFC, 0x03, 0xF4, 0x02, 0xF8, 0x01, 0xFC, 0x03, 0xF4, 0x00,
-    0xFE, 0x03, 0xF0, 0x00, 0x7F, 0x47, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x00, 0x1F, 0xEF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x6F, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F,
-    0x90, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0D, 0x00, 0x00, 0x03, 0xEE, 0x03, 0x40, 0x00, 0x01, 0xD1,
-    0xD1, 0xD0, 0x00, 0x00, 0xB0, 0x2E, 0xF0, 0x00, 0x00, 0x2C, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0xFF, 0x00, 0x00,
-    0x03, 0xF8, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x00,
-    0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xD0, 0x1F,
-    0xF0, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x1F, 0xF3, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0xD0, 0x00, 0xE3, 0xC0, 0xD0, 0x01, 0xD0, 0xE1, 0xD0, 0x02, 0xD0, 0x7F, 0xC0, 0x01,
-    0xC0, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0xBD, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0xFC, 0x03,
-    0xF4, 0x02, 0xF8, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x7F, 0x47, 0xF0, 0x00,
-    0x3F, 0xCF, 0xE0, 0x00, 0x1F, 0xEF, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x1D,
-    0x3C, 0x00, 0x2E, 0x3C, 0x00, 0x2D, 0x3C, 0x00, 0x2D, 0x3C, 0x00, 0x2D, 0x3C, 0x00, 0x2D, 0x3C,
-    0x00, 0x2D, 0x3C, 0x00, 0x2D, 0x3C, 0x00, 0x2D, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x3C, 0x7C, 0x00,
-    0x3C, 0x78, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0x78, 0x00, 0x3C,
-    0x78, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xB4,
-    0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x3F, 0xE0, 0x3F, 0xE0, 0x2F, 0xF0,
-    0x1F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x0F, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x00,
-    0x7F, 0xD0, 0x3F, 0xE0, 0x3F, 0xE0, 0x2F, 0xF0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF8, 0x07, 0xFC,
-    0x00, 0x00, 0x7F, 0xD2, 0xFF, 0x40, 0xFF, 0x87, 0xFD, 0x03, 0xFE, 0x0F, 0xF8, 0x0B, 0xFC, 0x2F,
-    0xE0, 0x1F, 0xF0, 0x7F, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x83, 0xFD, 0x01, 0xFF, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x3F, 0xE0, 0xFF, 0x80, 0xFF, 0x43, 0xFD, 0x03,
-    0xFC, 0x1F, 0xF0, 0x0F, 0xF0, 0x7F, 0xC0, 0xBF, 0x82, 0xFE, 0x03, 0xFD, 0x0F, 0xF4, 0x1F, 0xF0,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0,
-    0x1F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE1, 0xFF, 0x80, 0xFF, 0xC3,
-    0xFF, 0x02, 0xFF, 0x0B, 0xFC, 0x07, 0xFC, 0x1F, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0xD0, 0xFF,
-    0x40, 0xBF, 0xC2, 0xFE, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x6F, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xDB, 0xFF, 0xF9, 0x55, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x5F, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0x95, 0x54, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x96, 0x40, 0x1F, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x15, 0x5F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-    0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0xAA, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x64, 0x00,
-    0xBE, 0x00, 0xBF, 0xE0, 0xBF, 0xFC, 0xBF, 0xF4, 0xBF, 0x40, 0xB4, 0x00, 0x00, 0x00, 0x1F, 0x43,
-    0xF8, 0x3F, 0xC3, 0xFC, 0x7F, 0xC0, 0x1F, 0x43, 0xF8, 0x3F, 0xC3, 0xFC, 0x7F, 0xC0, 0x1F, 0x40,
-    0x01, 0xF8, 0x00, 0x2F, 0x43, 0xF8, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xC3, 0xFC, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0xBD,
-    0xBD, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x09, 0x80, 0x00, 0x0F, 0x02,
-    0x45, 0x00, 0x01, 0xE0, 0x30, 0x30, 0x00, 0x3C, 0x03, 0x33, 0x00, 0x0B, 0x80, 0x33, 0x30, 0x00,
-    0xF0, 0x03, 0x47, 0x00, 0x3D, 0x00, 0x3F, 0xE0, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03,
-    0xF0, 0x40, 0x00, 0x00, 0x7D, 0x21, 0x08, 0x40, 0x0F, 0x86, 0x48, 0x92, 0x02, 0xF0, 0x58, 0x9A,
-    0x20, 0x3E, 0x06, 0x19, 0x82, 0x0F, 0xC0, 0x3B, 0x4E, 0xE1, 0xF4, 0x01, 0xE0, 0x7C, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x2F, 0xE0, 0x3F,
-    0xD0, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x3F, 0xE0, 0xFF, 0x80, 0xFF, 0x43, 0xFD,
-    0x03, 0xFC, 0x1F, 0xF0, 0x0F, 0xF0, 0x7F, 0xC0, 0xBF, 0x82, 0xFE, 0x03, 0xFD, 0x0F, 0xF4, 0x1F,
-    0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x03,
-    0x40, 0x09, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x7F, 0x00, 0xFD, 0x01, 0xFC, 0x03, 0xF4, 0x07, 0xE0,
-    0x0F, 0xC0, 0x2F, 0x40, 0x3F, 0x00, 0x7D, 0x00, 0xF8, 0x02, 0xF0, 0x03, 0xE0, 0x0B, 0xC0, 0x0F,
-    0x40, 0x1E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x3F,
-    0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x0A, 0x00, 0x3F, 0x03, 0xF4, 0x01, 0xF8, 0x1F, 0xC0, 0x0B, 0xD0, 0xBD, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0xF4, 0x0F, 0x40, 0x06, 0xC0, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0xB0, 0x00, 0x90, 0x03, 0xF0, 0x0F, 0xD0, 0x0F, 0xC0, 0x0B, 0xE0,
-    0x1F, 0xC0, 0x2F, 0x80, 0x0B, 0xD0, 0x1F, 0x80, 0x3F, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x3E, 0x00,
-    0x0F, 0x40, 0x3E, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x2C, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xEB, 0x80, 0x0B, 0xC3, 0xF0, 0x3F, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0x00, 0x2F, 0x00, 0xFD, 0x03, 0xF0, 0x1F, 0xC0, 0x3E, 0x00, 0xBF, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFD, 0x00, 0x2C, 0x00, 0x08, 0x00, 0x00, 0xA0, 0x00,
-    0xBC, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0xFE, 0x03, 0xFC, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x3F, 0x00, 0x3C, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x2A, 0x80, 0x00, 0xFD, 0x00, 0x0A, 0xA0, 0x02, 0xFE, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x0B,
-    0xF8, 0x02, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0xFF, 0xF0,
-    0x03, 0xF0, 0x2F, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0x7F, 0x43, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x07,
-    0xF4, 0x3F, 0xD0, 0x00, 0xFF, 0xF4, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x3F, 0xFF, 0xD0, 0x0F, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x80, 0x0B, 0xFF, 0xD0, 0x3F,
-    0x40, 0x3F, 0xFE, 0x01, 0xFF, 0xF8, 0x03, 0xF4, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xA0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC,
-    0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0xBF, 0x02, 0xFC, 0x0B, 0xF0,
-    0x2F, 0xC0, 0xFF, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xE0, 0xFF, 0x83,
-    0xFF, 0x1F, 0xFC, 0xBF, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x17, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x3F, 0x93, 0xFF,
-    0xF4, 0x1D, 0x03, 0xF3, 0xFC, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x03, 0xF0,
-    0xBE, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x07, 0xF1,
-    0xFC, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x55, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x0E, 0x74, 0x00, 0x1D, 0x3D, 0x00, 0x7C,
-    0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x0B, 0x0C, 0x2C, 0x00, 0x00, 0x1B, 0xBB, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x07, 0xCD, 0x7C, 0x00, 0x00, 0x08, 0x34, 0x00, 0x00, 0x00,
-    0x00, 0xD0, 0x04, 0x00, 0x02, 0x40, 0x00, 0xB0, 0x00, 0x0D, 0x04, 0x91, 0xC3, 0x5E, 0x34, 0xB2,
-    0xEB, 0x78, 0x1F, 0xFE, 0x00, 0x7E, 0x00, 0x07, 0xD0, 0x02, 0xFE, 0x00, 0xBE, 0xF4, 0xB9, 0xCB,
-    0x8F, 0x28, 0xB1, 0x47, 0x04, 0x10, 0xA0, 0x00, 0x1C, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD,
-    0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0xEB,
-    0xFF, 0xC0, 0x3F, 0xEB, 0xFF, 0xC0, 0x3F, 0x40, 0x0B, 0xF8, 0x2F, 0x40, 0x0B, 0xFC, 0x03, 0x00,
-    0x00, 0xBF, 0x03, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0x90, 0x6F, 0xF4,
-    0x02, 0xE1, 0xD0, 0x00, 0x3F, 0xC0, 0x3E, 0x04, 0x00, 0x00, 0xFD, 0x03, 0xE0, 0x00, 0x00, 0x0F,
-    0xE0, 0x3E, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x3E, 0x00, 0x00, 0x00,
-    0xBE, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x3E, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x00,
-    0x3F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0xBE, 0x00, 0x00,
-    0xFF, 0x80, 0x0B, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0xBE, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xE0, 0x02,
-    0xFE, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0xFE, 0x00,
-    0x2F, 0xE0, 0x00, 0x0F, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x0A, 0xE0,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x7F,
-    0xE0, 0x02, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0x00, 0x01, 0x3C, 0x00, 0x0B, 0xF4, 0x02, 0xF0, 0x00,
-    0x00, 0x2F, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xF0,
-    0x00, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0xC0, 0x07, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0x00, 0x1F, 0xFD, 0x00, 0x07,
-    0xF0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x03, 0xFC, 0x00, 0x00,
-    0xBF, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x00,
-    0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x29, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0xC0,
-    0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xF0, 0x03, 0xFD,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xF4, 0x0F, 0x80,
-    0x00, 0xFD, 0x03, 0xD0, 0x00, 0x7F, 0x81, 0xF0, 0x00, 0x2F, 0xE0, 0xBC, 0x00, 0x0B, 0xF8, 0x3E,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x2F, 0x47, 0xF0, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x03, 0xE0, 0xFF, 0x00, 0x02, 0xF4, 0x3F,
-    0xC0, 0x00, 0xFC, 0x0F, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x24, 0x70, 0x70, 0x28, 0xA2, 0x1C, 0xE3, 0x4C, 0xE3, 0x1C, 0xF0, 0x2C, 0xB0,
-    0x3C, 0x7E, 0xF8, 0x3F, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xD0, 0x02, 0xD0, 0x07, 0xA0, 0x0D,
-    0xA0, 0x38, 0xA0, 0xB4, 0xF4, 0xFF, 0xFD, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x7F,
-    0xF4, 0x60, 0x00, 0xA0, 0x00, 0xB0, 0x00, 0xBF, 0xD0, 0x10, 0x78, 0x00, 0x2C, 0x00, 0x2C, 0x65,
-    0xBC, 0xBF, 0xF4, 0x7F, 0xD0, 0x07, 0xF8, 0x2D, 0x00, 0x30, 0x00, 0xA0, 0x00, 0xAF, 0xE0, 0xF8,
-    0x3C, 0xF0, 0x1C, 0xB0, 0x0D, 0x74, 0x2C, 0x3F, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x1C, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xB4, 0x00, 0xF4, 0x00, 0xF0, 0x01,
-    0xF0, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xA4, 0x03, 0x42, 0x80, 0xC0, 0x70, 0x30, 0x1C, 0x0B, 0x5D,
-    0x00, 0xFE, 0x00, 0xE0, 0xF0, 0xB0, 0x0D, 0x3C, 0x03, 0x47, 0xDB, 0xC0, 0x7F, 0x80, 0x0B, 0xD0,
-    0x34, 0x78, 0xA0, 0x2C, 0xE0, 0x1D, 0xA0, 0x1D, 0x74, 0x2E, 0x2F, 0xFE, 0x01, 0x4D, 0x00, 0x1D,
-    0x3F, 0xFC, 0x3F, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x1F, 0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xF4, 0x0B, 0xE0, 0x2F, 0xD0, 0x03, 0xF0, 0x2F, 0xC0, 0x02, 0xF4, 0x3F, 0x40, 0x01, 0xF4,
-    0x3F, 0x40, 0x01, 0xF8, 0x3F, 0x40, 0x01, 0xF8, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40, 0x02, 0xFC,
-    0x3F, 0x80, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC,
-    0x7F, 0x80, 0x02, 0xFC, 0xBF, 0xC0, 0x02, 0xFD, 0x01, 0xBE, 0x00, 0x2C, 0x0B, 0x01, 0xC0, 0x0E,
-    0x0F, 0x00, 0x2C, 0x38, 0x34, 0x75, 0xE1, 0xE1, 0xD7, 0x87, 0x87, 0x9F, 0x0D, 0x2E, 0x7C, 0x00,
-    0xB4, 0xF0, 0x03, 0xD3, 0xF0, 0x2F, 0x0F, 0xFB, 0xFC, 0x1F, 0xFF, 0xE0, 0x2F, 0xFF, 0x00, 0x1B,
-    0xE0, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xB0, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0xB0, 0x02, 0xC0,
-    0x0B, 0x00, 0x2C, 0x0F, 0xFF, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x90, 0x78, 0x00, 0x2C, 0x00,
-    0x2C, 0x00, 0x3C, 0x00, 0xB8, 0x02, 0xF0, 0x1F, 0xC0, 0x3F, 0x00, 0xBF, 0xFC, 0xBF, 0xFD, 0x2F,
-    0xD0, 0x00, 0x28, 0x00, 0x0C, 0x00, 0x28, 0x0F, 0xE0, 0x00, 0xB4, 0x00, 0x2C, 0x00, 0x1C, 0x10,
-    0x7C, 0xBF, 0xF8, 0x7F, 0xD0, 0x00, 0x50, 0x00, 0xE0, 0x02, 0xA0, 0x06, 0x60, 0x0C, 0xB0, 0x34,
-    0xB0, 0xBF, 0xF4, 0xBF, 0xFD, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0x01, 0xFF, 0xCA, 0x00,
-    0x28, 0x00, 0xA0, 0x02, 0xFF, 0x40, 0x07, 0x40, 0x0E, 0x00, 0x7A, 0xFF, 0xCB, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x2C, 0x00, 0x30, 0x00, 0xB0, 0x00, 0xBF, 0xF0, 0xF8, 0x2C, 0xB0, 0x0D,
-    0xB0, 0x0D, 0x78, 0x2C, 0x3F, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x1C, 0x00, 0x2C,
-    0x00, 0x3C, 0x00, 0x38, 0x00, 0x74, 0x00, 0xB4, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xF0, 0x02, 0xE0,
-    0x02, 0xF8, 0x03, 0x01, 0xC0, 0xC0, 0x30, 0x38, 0x2C, 0x03, 0xFC, 0x02, 0xD7, 0x81, 0xC0, 0x34,
-    0xF0, 0x0E, 0x2E, 0x0B, 0x83, 0xFF, 0x80, 0x05, 0x00, 0x1F, 0xE0, 0x34, 0x38, 0xA0, 0x1C, 0xE0,
-    0x1D, 0xA0, 0x1D, 0x79, 0x7D, 0x1F, 0xFD, 0x00, 0x0D, 0x00, 0x2C, 0x3F, 0xFC, 0x3F, 0xE0, 0x00,
-    0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0,
-    0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02,
-    0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00,
-    0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x02,
-    0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x1F,
-    0xC0, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x2F,
-    0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x07,
-    0xC0, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x0F,
-    0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x7E, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0xBF, 0x00,
-    0x3F, 0x40, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x1A, 0x00, 0x00,
-    0x03, 0xF0, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x00, 0x07, 0xD0, 0x7C, 0x00, 0x00, 0x0B,
-    0xC0, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x97, 0xF8, 0x00, 0x3F, 0xFD, 0x07, 0xC0,
-    0x00, 0xFF, 0xFC, 0x0B, 0xC0, 0x01, 0xFF, 0xFC, 0x0F, 0x80, 0x03, 0xFC, 0xF8, 0x0F, 0x40, 0x07,
-    0xF8, 0xF4, 0x1F, 0x00, 0x0B, 0xF1, 0xF0, 0x2F, 0x00, 0x0F, 0xF3, 0xF0, 0x3E, 0x00, 0x0F, 0xE3,
-    0xE0, 0x3D, 0x00, 0x1F, 0xE7, 0xD0, 0x7C, 0x00, 0x1F, 0xEB, 0xC0, 0xBC, 0x00, 0x1F, 0xFF, 0xC0,
-    0xF8, 0x00, 0x1F, 0xFF, 0x41, 0xF4, 0x00, 0x1F, 0xFF, 0x02, 0xF0, 0x00, 0x0F, 0xFF, 0x43, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFB, 0xE5, 0xBE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x01,
-    0xF6, 0xFF, 0xFF, 0xA4, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x00, 0x03, 0xD0,
-    0x7C, 0x00, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x6F, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x95, 0x68, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x14, 0x14, 0x1F, 0xE0, 0x00, 0x7E, 0xFC, 0x1F, 0xE0, 0x00, 0x7F, 0xFD, 0x1F, 0xF0, 0x00,
-    0x7F, 0x40, 0x1F, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0xFC, 0x00, 0x7C, 0x00, 0x0F, 0xFF, 0x80, 0x7C,
-    0x00, 0x0F, 0xFF, 0xFE, 0xBE, 0xBE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xE0, 0x1B, 0xF0, 0x0F, 0xE0, 0x00, 0x09, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x1A, 0xFF, 0xAA, 0xA4, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x90, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFD, 0x00, 0x00,
-    0x3F, 0xBF, 0xC0, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xAF, 0xD0, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0x8F,
-    0xF0, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0x8B, 0xF4, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x03,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x2A, 0xFF, 0xEA, 0xFF, 0xAB, 0xFE, 0xA9, 0x00, 0xFF, 0xC0, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x2F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xE7, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFB, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xF8,
-    0x00, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0x80, 0x00, 0x02, 0xFE, 0xAF, 0xFF, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0x80,
-    0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0xEA, 0x50, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x2C, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xF8, 0x0F, 0x55, 0xBF, 0xC0, 0x00, 0x3F, 0xFF, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0x1F, 0x51, 0x40, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x03, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00,
-    0x1F, 0xE0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x7F, 0x00, 0x1F, 0x40, 0x00, 0x1F,
-    0xFD, 0x1F, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF5,
-    0xFD, 0x00, 0x7F, 0x00, 0x03, 0x90, 0xBD, 0x7F, 0x40, 0x1F, 0xD0, 0x02, 0xFF, 0xFF, 0x6F, 0xD0,
-    0x0B, 0xF8, 0x01, 0xFF, 0xFF, 0xCB, 0xF4, 0x02, 0xFF, 0x00, 0x7F, 0xFF, 0xE2, 0xFD, 0x00, 0xBF,
-    0xC0, 0x06, 0xFF, 0xD0, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF4, 0x07,
-    0xC0, 0x00, 0x00, 0x0F, 0x40, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00,
-    0x3D, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xE0, 0x01, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0xB8, 0x03, 0xE0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0F, 0x43, 0xFE, 0x0B, 0xC0, 0x00, 0xF4, 0x7F, 0xF0, 0xBC, 0x00, 0x0F, 0x8B, 0xDF, 0x4F,
-    0x80, 0x00, 0xBC, 0xFC, 0xF8, 0xF4, 0x00, 0x0B, 0xDF, 0xCF, 0xCF, 0x40, 0x00, 0x7E, 0xF8, 0xBE,
-    0xF0, 0x00, 0x07, 0xFF, 0x47, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x03,
-    0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0,
-    0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFA, 0x94,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x3E, 0x7F,
-    0xD0, 0x6F, 0xF0, 0x00, 0xF9, 0xFC, 0x00, 0x0B, 0xF0, 0x03, 0xE7, 0xE0, 0x00, 0x0B, 0xC0, 0x0F,
-    0x9F, 0x40, 0x00, 0x0F, 0x40, 0x3E, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0xF9, 0xF4, 0x05, 0x00, 0xB8,
-    0x03, 0xE7, 0xD0, 0x2F, 0x02, 0xE0, 0x0F, 0x9F, 0x40, 0xBC, 0x0B, 0xC0, 0x3E, 0x7D, 0x02, 0xF0,
-    0x2F, 0x00, 0xF9, 0xF4, 0x0B, 0xC0, 0xBC, 0x03, 0xE7, 0xD0, 0x2F, 0x00, 0x50, 0x1F, 0x9F, 0x40,
-    0x7C, 0x00, 0x00, 0x7E, 0x7D, 0x01, 0xF0, 0x00, 0x01, 0xF9, 0xF4, 0x03, 0xE0, 0x00, 0x07, 0xE7,
-    0xD0, 0x0B, 0xE0, 0x00, 0x3F, 0x9F, 0x40, 0x0F, 0xF9, 0x07, 0xFE, 0x7C, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x16, 0xAF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x15, 0x6E, 0x54,
-    0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02,
-    0xFD, 0x2D, 0x00, 0x00, 0x3F, 0xFD, 0xB4, 0x00, 0x03, 0xFA, 0xFF, 0xD0, 0x00, 0x2E, 0x00, 0xBF,
-    0x40, 0x00, 0xF0, 0x00, 0xFD, 0x00, 0x07, 0x80, 0x03, 0xF0, 0x00, 0x2E, 0x00, 0x0F, 0xC0, 0x00,
-    0xB8, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x02, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFE, 0x29, 0x00, 0x55, 0x55, 0x55, 0x54,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0F, 0xF9,
-    0x01, 0x40, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x01, 0x40, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
-    0xF5, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xA5, 0x50, 0xFD, 0x00, 0x55, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x10, 0x00, 0x00, 0x00, 0xFE, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x3E, 0x7F, 0x87, 0x40, 0x00, 0x04, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0x1B, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x03,
-    0x4B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x0B, 0xFA, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x0F, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0x50, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFE, 0xFF, 0x40, 0x07, 0xFF, 0x42, 0xD0, 0x05, 0x00, 0x3F, 0xF0, 0x0B, 0x40, 0x00,
-    0x01, 0xFF, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xB4, 0x00, 0x00, 0x3F, 0xC0, 0x02, 0xD0,
-    0x00, 0x00, 0xFF, 0x00, 0x0B, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x2D, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0xB4, 0x00, 0x00, 0x7F, 0x80, 0x02, 0xD0, 0x00, 0x01, 0xFE, 0x00, 0x0B, 0x94, 0x00, 0x07, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFE, 0x5F, 0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x3F, 0xC0, 0x03, 0xC0, 0x6F, 0xFC,
-    0xFF, 0x40, 0x0F, 0x00, 0x3F, 0x53, 0xFF, 0x00, 0x3C, 0x00, 0xFC, 0x0B, 0xFF, 0x00, 0xF0, 0x07,
-    0xF0, 0x1F, 0xFF, 0xE7, 0xD6, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0A,
-    0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0x50, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x6F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x3F, 0xFF, 0xEA,
-    0xAB, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2B,
-    0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xAC, 0x02, 0xFC, 0xB4, 0x00, 0x3F, 0x0B, 0x40, 0x07, 0xF0, 0xB4, 0x00, 0x7E, 0x0B,
-    0x40, 0x07, 0xD0, 0xB4, 0x00, 0xBD, 0x0B, 0x40, 0x07, 0xE0, 0x78, 0x00, 0x7F, 0x07, 0x80, 0x03,
-    0xFC, 0x78, 0x00, 0x2F, 0xFF, 0xE8, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x06, 0xFF,
-    0xE4, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0x6F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x3C, 0x00, 0xBF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xC0,
-    0x00, 0x07, 0xF4, 0x00, 0xBF, 0xFE, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xBF, 0xFD, 0x00, 0x05, 0x5B,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x10,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x0A, 0x00, 0x01, 0xF5,
-    0xBE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0xF4,
-    0x01, 0x00, 0xA5, 0xF4, 0x6E, 0x00, 0x01, 0xFB, 0xFE, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x2F, 0xFF,
-    0x40, 0x00, 0xBF, 0xF4, 0x00, 0x3E, 0xBA, 0xF4, 0x00, 0x7C, 0x41, 0xF4, 0x02, 0xF8, 0x01, 0xF4,
-    0x1F, 0xE0, 0x01, 0xFA, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFE, 0xF2, 0xFC, 0x00, 0x3F, 0x0F, 0x0F, 0xD0, 0x07,
-    0xE0, 0xF0, 0x7E, 0x00, 0xBC, 0x0F, 0x03, 0xE0, 0x0B, 0xC0, 0xF0, 0x2E, 0x00, 0xBC, 0x0F, 0x02,
-    0xF0, 0x0B, 0x80, 0xF0, 0x2F, 0x00, 0xB8, 0x0F, 0x02, 0xE0, 0x0B, 0x80, 0xF0, 0x2E, 0x00, 0xB8,
-    0x0F, 0x02, 0xE0, 0x0B, 0x80, 0xF0, 0x2E, 0x00, 0xBC, 0x0F, 0x02, 0xE0, 0x07, 0xC0, 0xF0, 0x2E,
-    0x00, 0x7C, 0x0F, 0x03, 0xE0, 0x07, 0xD0, 0xF0, 0x3E, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xEA, 0xFF, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x07,
-    0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x80,
-    0x00, 0x2F, 0x80, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xE0, 0x00, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFE, 0xA9, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x1F, 0xCF, 0x5F, 0xC0, 0x07, 0xE0, 0xF4, 0x3F, 0x02, 0xF8, 0x0F, 0x40, 0xFD, 0x7D,
-    0x00, 0xF4, 0x03, 0xD2, 0x40, 0x0F, 0x40, 0x04, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x24, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x14, 0x00, 0xF4, 0x00, 0x47, 0xD0, 0x0F, 0x40, 0x3D, 0x2F, 0x80, 0xF4, 0x0F, 0xD0, 0xBE,
-    0x0F, 0x43, 0xF0, 0x01, 0xFC, 0xF5, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xB0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0x80, 0x00, 0x0B,
-    0x80, 0x00, 0x2E, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xD0, 0x0F,
-    0x00, 0x00, 0x00, 0x0F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2,
-    0xF0, 0x00, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x00, 0x0C, 0x00, 0x07, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x02, 0xF7, 0xAF, 0x00, 0x3E, 0x0E, 0x2F, 0x03, 0xE0, 0x38, 0x1F,
-    0x4D, 0x00, 0xE0, 0x1D, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x38, 0x00, 0x1F, 0x00,
-    0xE0, 0x1D, 0x2F, 0x43, 0x81, 0xF4, 0x2F, 0x4E, 0x2F, 0x00, 0x1F, 0xBA, 0xF0, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xAB,
-    0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xA9, 0x50, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0xF3, 0xF4, 0x00, 0x07, 0xC3, 0xF4, 0x00, 0x1F, 0x03, 0xF4, 0x00, 0x78, 0x03, 0xF4, 0x01, 0xE0,
-    0x03, 0xF4, 0x0B, 0x80, 0x03, 0xF4, 0x2E, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x02, 0x00, 0x1F, 0xA9, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x56, 0xAF, 0xFE, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xD7, 0xC0, 0x00, 0xBD, 0x1F, 0x00, 0x0B, 0xD0, 0x3C,
-    0x00, 0xBD, 0x00, 0xF0, 0x0B, 0xD0, 0x03, 0xC0, 0xBD, 0x00, 0x0F, 0x0B, 0xD0, 0x00, 0x3C, 0x7D,
-    0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x0A, 0x03, 0xF0, 0x00, 0x3C, 0x07, 0xE0, 0x00, 0xF0, 0x07, 0xE0, 0x07, 0xC0, 0x0B, 0xD0,
-    0x2E, 0x00, 0x0B, 0xD0, 0xB4, 0x00, 0x0F, 0xC3, 0xD0, 0x00, 0x0F, 0xCF, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x0B, 0xC6, 0x40, 0x00, 0x7E, 0x2E, 0x00, 0x07, 0xE0, 0x7C,
-    0x00, 0x3F, 0x00, 0xF0, 0x03, 0xF0, 0x03, 0xC0, 0x3F, 0x00, 0x0F, 0x02, 0xF0, 0x00, 0x3D, 0x2F,
-    0x40, 0x00, 0xB9, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD5,
-    0x55, 0x55, 0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0x55,
-    0x55, 0x55, 0x40, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0x00, 0x03,
-    0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xD0, 0x00, 0x03, 0xFB, 0x80, 0xEB, 0xD0, 0x00,
-    0x2F, 0x8E, 0x03, 0x8B, 0xD0, 0x02, 0xF8, 0x38, 0x0E, 0x0B, 0xD0, 0x2F, 0x80, 0xE0, 0x38, 0x0B,
-    0xD1, 0xF8, 0x03, 0x80, 0xE0, 0x0B, 0xC3, 0x80, 0x0E, 0x03, 0x80, 0x08, 0x00, 0x00, 0x38, 0x0E,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x03, 0x80, 0xE0, 0x00, 0x00, 0x00, 0x0E,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x03, 0x80, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x55, 0x55, 0x55, 0x5F, 0xC0,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x15, 0x55, 0x55, 0x5B, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x03, 0x80, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00,
-    0x00, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x03, 0x80, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x03,
-    0x80, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0xE0, 0x00, 0x02, 0x40, 0x0E, 0x03, 0x80, 0x04, 0x1F, 0x40, 0x38, 0x0E, 0x00, 0x78, 0x3F,
-    0x40, 0xE0, 0x38, 0x07, 0xF0, 0x3F, 0x43, 0x80, 0xE0, 0x7F, 0x00, 0x3F, 0x4E, 0x03, 0x87, 0xE0,
-    0x00, 0x3F, 0x38, 0x0E, 0x3E, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0xFE,
-    0x00, 0x00, 0x00, 0x7E, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x60,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x90, 0x00, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x01, 0xF4,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x0F, 0x80, 0x03, 0xF5, 0x55, 0x55, 0x5B, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x00, 0x02,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFD, 0x55, 0x55, 0x7F, 0x80, 0x00, 0x7E, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xEF, 0xD0, 0x00, 0x00, 0x7F,
-    0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x3F, 0xE0, 0x01, 0xFF, 0xC0, 0xD7, 0xF8, 0x1F, 0xEB, 0x03, 0x43,
-    0xFC, 0x0E, 0x1C, 0x0D, 0x03, 0xC0, 0x00, 0x70, 0x34, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00,
-    0x07, 0x03, 0x40, 0x00, 0x00, 0x1C, 0x0D, 0x00, 0x00, 0x00, 0x70, 0x34, 0x00, 0x00, 0x01, 0xC0,
-    0xD0, 0x00, 0x01, 0x07, 0x03, 0x40, 0x50, 0x3F, 0x5C, 0x0D, 0x0B, 0xE0, 0xBF, 0xF0, 0x34, 0xFF,
-    0x40, 0x7F, 0xC0, 0xEF, 0xD0, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x00, 0x2F, 0x6F, 0x80, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x90, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0xFF, 0xF0, 0x2D, 0x0B, 0xFF, 0xFC, 0x3D, 0x1F, 0xE0, 0x2F, 0x3C, 0x3F, 0x40, 0x0B,
-    0xBC, 0x7E, 0x00, 0x03, 0xFC, 0x7D, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x01, 0xF4, 0xBD, 0x00, 0x01,
-    0xF0, 0xBF, 0x00, 0x03, 0xF0, 0x3F, 0x80, 0x0B, 0xD0, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x02, 0xF4, 0x00,
-    0x0B, 0xFF, 0xEF, 0xFF, 0xD3, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF7,
-    0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xE0, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x80,
-    0x01, 0xFC, 0x00, 0x07, 0xE0, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x02, 0xFC, 0x00, 0x1F,
-    0xC0, 0x07, 0xE0, 0x00, 0xBE, 0x00, 0x07, 0xF4, 0x07, 0xD0, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x0B,
-    0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xCB, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFC, 0x00, 0x01, 0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0B, 0xDF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xC0, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xC0,
-    0x01, 0xBF, 0xFE, 0x40, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x01,
-    0xFD, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x47, 0xF0, 0x00, 0x00, 0x2F,
-    0xC0, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x03, 0xF8,
-    0x00, 0xBF, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x40,
-    0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x0F, 0xF0, 0x00,
-    0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x00, 0x0F, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E,
-    0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8,
-    0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0,
-    0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80,
-    0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00,
-    0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x54, 0x00, 0x3E, 0x00, 0x0F, 0x80,
-    0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00,
-    0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00,
-    0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00,
-    0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03,
-    0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x01, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0x78, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x42, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x20, 0x03, 0xFC,
-    0x00, 0x00, 0x01, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xFB,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x19, 0x40, 0x01, 0xA4, 0x00, 0x0F, 0xFF, 0xD0, 0x7F, 0xFC, 0x00, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFC, 0x0B, 0xE4, 0x1F, 0xAF, 0x80, 0xF4, 0x3E, 0x00, 0x0F, 0xF4, 0x00, 0xF1, 0xF0, 0x00,
-    0x1F, 0xC0, 0x02, 0xCB, 0x80, 0x00, 0x3E, 0x00, 0x07, 0x2E, 0x00, 0x00, 0xF8, 0x00, 0x1D, 0xB8,
-    0x00, 0x03, 0xF0, 0x00, 0xB1, 0xF0, 0x00, 0x1F, 0xE0, 0x0B, 0xC7, 0xE0, 0x01, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xAF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFD, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0xD0, 0x3F,
-    0xF8, 0x00, 0x06, 0xE8, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x01, 0x80, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC3,
-    0xFC, 0x3F, 0xD7, 0xFD, 0x7F, 0xE1, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x3F, 0xC3, 0xFD, 0x7F, 0xDB, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x01, 0x42, 0xFA, 0xF4, 0x00, 0xF0, 0xF8, 0x0F, 0x40, 0x7C, 0x7D, 0x01, 0xF4, 0x3E, 0x2F, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x03, 0xC3, 0xF0, 0xBC, 0x01, 0xF0, 0xF4, 0x0B, 0xC0, 0xBC, 0x7D, 0x00, 0xBE, 0xFD,
-    0x16, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x50, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0x55, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFE, 0x40, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0x1B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE9, 0x50, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFE, 0x94, 0x00, 0x15, 0xAF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x56, 0x90, 0x03,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xFF, 0xE4, 0x01, 0xBF,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x5A, 0xFF, 0xE0, 0x1A, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x95, 0x00, 0x1A, 0x54, 0x00,
-    0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_14_regularBitmaps[42437] = {
+    0x3A, 0xA3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x29, 0xE2, 0x9E,
+    0x29, 0xE2, 0xAE, 0x2A, 0xE2, 0xAE, 0x2A, 0xE2, 0xF2, 0xF2, 0xAE, 0x77, 0xAE, 0x91, 0xFA, 0x1F,
+    0xA1, 0xFC, 0x09, 0xFC, 0x0A, 0xFC, 0x00, 0x9F, 0xA1, 0xAF, 0x09, 0xF9, 0x1A, 0xF0, 0x9F, 0x2F,
+    0xC0, 0x9F, 0x2F, 0xA0, 0x9E, 0xA2, 0xF9, 0x0A, 0xEA, 0x2F, 0x90, 0xAE, 0xA2, 0xF9, 0x0A, 0xF2,
+    0xF9, 0x76, 0x70, 0x9D, 0x5A, 0xCA, 0x77, 0x0A, 0xD5, 0xDA, 0x77, 0x0E, 0x5D, 0xA7, 0x70, 0xDA,
+    0x5D, 0x97, 0x70, 0xDA, 0x49, 0xD9, 0x77, 0x9D, 0xA4, 0x9D, 0x97, 0x79, 0xD9, 0x4A, 0xD7, 0x19,
+    0xFF, 0xFF, 0xFF, 0xDA, 0x0A, 0xFF, 0xFF, 0xFF, 0xD9, 0x09, 0xAA, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA,
+    0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0x70, 0xE5, 0xE7, 0x70, 0xE4, 0x9D, 0xA7, 0x79, 0xE4, 0x9D, 0xA7,
+    0x7A, 0xE4, 0xAD, 0xA7, 0x7A, 0xDA, 0x4A, 0xD9, 0x77, 0xEA, 0x4E, 0x97, 0x1F, 0xFF, 0xFF, 0xFE,
+    0x1F, 0xFF, 0xFF, 0xFD, 0xA0, 0x9A, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xA7, 0x9E, 0x93, 0x9E, 0x77, 0xAE, 0x4A, 0xE7, 0x7F, 0x4A, 0xE7, 0x7F, 0x4F, 0x77, 0xF4, 0xEA,
+    0x77, 0x99, 0x99, 0x49, 0x99, 0x72, 0x71, 0xA9, 0x19, 0x97, 0x71, 0x9D, 0x1A, 0xC9, 0x77, 0x09,
+    0xD1, 0xAC, 0x97, 0x79, 0xFF, 0xCA, 0xA7, 0x2A, 0xFF, 0xFC, 0x71, 0xAF, 0xFF, 0xCA, 0x70, 0x9F,
+    0xEA, 0x9D, 0x99, 0xA9, 0x70, 0xFC, 0xAD, 0x1A, 0xC9, 0x73, 0xF0, 0x9D, 0x1A, 0xC9, 0x72, 0x9E,
+    0x90, 0x9D, 0x1A, 0xC9, 0x72, 0x9E, 0x90, 0x9D, 0x1A, 0xC9, 0x73, 0xF0, 0x9D, 0x1A, 0xC9, 0x73,
+    0xFF, 0x1A, 0xC9, 0x74, 0xFF, 0xEA, 0x75, 0xFF, 0xFA, 0x97, 0x39, 0xAF, 0xFE, 0xA7, 0x5D, 0x9A,
+    0xFF, 0x97, 0x3D, 0x1A, 0xFF, 0x73, 0xD1, 0xAC, 0xAF, 0xE7, 0x2D, 0x1A, 0xC9, 0xFE, 0x97, 0x1D,
+    0x1A, 0xC9, 0xFE, 0x93, 0xDA, 0xA9, 0xAD, 0x99, 0xFF, 0xD3, 0xAF, 0xFF, 0xFF, 0x29, 0xFF, 0xFF,
+    0xF2, 0x9F, 0xFF, 0xFF, 0x92, 0xAF, 0xFF, 0xFD, 0xA6, 0x9A, 0xFF, 0xFA, 0x97, 0x7D, 0x1A, 0xC9,
+    0x77, 0x1D, 0x1A, 0xC9, 0x77, 0x1C, 0xA1, 0xAC, 0x97, 0x77, 0x70, 0x77, 0x77, 0x2D, 0x77, 0xAC,
+    0x59, 0x99, 0x69, 0xCA, 0x3A, 0xFC, 0x5D, 0x3A, 0xC9, 0x19, 0xD3, 0xAC, 0xA3, 0xCA, 0x39, 0xC9,
+    0x2D, 0x4C, 0x94, 0xC9, 0x1D, 0x93, 0x9C, 0x94, 0xCA, 0x09, 0xD4, 0x9C, 0x94, 0xC9, 0x0D, 0x95,
+    0xD3, 0xD9, 0xAC, 0xA6, 0xAF, 0xE9, 0xD7, 0x0A, 0xFC, 0x0D, 0xA7, 0x19, 0x9A, 0x90, 0x9D, 0x0A,
+    0xE9, 0x71, 0xDA, 0xDA, 0xAD, 0xA7, 0xAD, 0xAC, 0x3A, 0xC6, 0x9D, 0x9C, 0xA4, 0xCA, 0x5D, 0xA0,
+    0xC9, 0x4C, 0xA4, 0xAD, 0x1C, 0xA4, 0xCA, 0x4D, 0xA1, 0xD3, 0x9C, 0xA3, 0xE2, 0xAD, 0xAA, 0xAD,
+    0x39, 0xD9, 0x3F, 0xDA, 0x3E, 0x5A, 0xE9, 0x3A, 0xD9, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xFC, 0x97,
+    0x4F, 0xFD, 0x72, 0xEA, 0x92, 0xAE, 0x70, 0x9D, 0xA5, 0xAD, 0x97, 0xAD, 0x95, 0xAD, 0x97, 0xAD,
+    0xA5, 0xE9, 0x79, 0xE9, 0x3A, 0xE7, 0x1A, 0xE9, 0x09, 0xF7, 0x3A, 0xEA, 0xF7, 0x5A, 0xFC, 0xA7,
+    0x6A, 0xFC, 0x76, 0xFE, 0xA7, 0x4A, 0xF9, 0xEA, 0x72, 0x9F, 0x2E, 0xA4, 0x9A, 0xA9, 0x0F, 0x93,
+    0xAE, 0x3E, 0xA0, 0xF5, 0xAE, 0x19, 0xE9, 0x9F, 0x69, 0xE9, 0xF0, 0x9F, 0x96, 0x9F, 0xD9, 0x09,
+    0xFC, 0x7A, 0xFA, 0x2F, 0xD9, 0x39, 0xFD, 0x92, 0x9F, 0xFF, 0xFD, 0x92, 0xAF, 0xFF, 0xCA, 0x0A,
+    0xD3, 0x9F, 0xFE, 0x92, 0x96, 0x9A, 0xFC, 0xA9, 0x77, 0x75, 0x9F, 0x99, 0xF9, 0x9F, 0x0A, 0xF0,
+    0xAE, 0xA0, 0xAE, 0xA0, 0xAE, 0xA0, 0xAE, 0xA6, 0x59, 0xD6, 0xDA, 0x59, 0xD6, 0xDA, 0x59, 0xD6,
+    0xDA, 0x59, 0xD6, 0xAD, 0x6D, 0xA5, 0x9D, 0x6E, 0x6D, 0xA5, 0x9D, 0x95, 0xAD, 0x6A, 0xD6, 0xE6,
+    0xE6, 0xE6, 0xE6, 0xDA, 0x6E, 0x6E, 0x6E, 0x6E, 0x6A, 0xD6, 0x9D, 0x96, 0xDA, 0x6E, 0x6E, 0x6A,
+    0xD9, 0x59, 0xE6, 0xE6, 0xAD, 0x95, 0x9E, 0x6E, 0x6A, 0xDA, 0x6E, 0x6E, 0xA5, 0x9E, 0x00, 0x9D,
+    0x6D, 0xA5, 0x9D, 0x6D, 0xA5, 0x9D, 0x6D, 0xA5, 0xAD, 0x6D, 0x95, 0xE5, 0x9D, 0x6D, 0xA5, 0xE5,
+    0xAD, 0x59, 0xD5, 0x9D, 0x95, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xE5, 0xDA, 0x5D, 0xA5, 0xDA,
+    0x49, 0xD9, 0x49, 0xD9, 0x4A, 0xD5, 0xE5, 0xE4, 0x9D, 0xA4, 0xAD, 0x94, 0xE4, 0x9D, 0xA4, 0xAD,
+    0x94, 0xE4, 0xAE, 0x4E, 0x93, 0x9E, 0x4E, 0xA3, 0x9E, 0x40, 0x77, 0x4D, 0x74, 0xD7, 0x99, 0x2D,
+    0x3C, 0x90, 0x9D, 0xA1, 0xD1, 0xAD, 0x91, 0xAE, 0x9A, 0xC9, 0xDA, 0x59, 0xFD, 0x97, 0x0A, 0xE9,
+    0x79, 0xFE, 0x93, 0x9E, 0x9A, 0xC0, 0xAE, 0xA1, 0xE1, 0xAC, 0x2D, 0xA1, 0x9C, 0x2A, 0xC9, 0x29,
+    0x7A, 0xC9, 0x73, 0xAC, 0x95, 0x5A, 0xCA, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x72,
+    0xDA, 0x4A, 0xFF, 0xFA, 0xAF, 0xFF, 0xA5, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xDA,
+    0x72, 0x9A, 0x94, 0x71, 0xFC, 0x2F, 0xA2, 0xF9, 0x19, 0xF2, 0x9F, 0x2A, 0xEA, 0x2F, 0x91, 0x9F,
+    0x72, 0xAF, 0xFF, 0x0A, 0xFF, 0xF0, 0xAF, 0xFF, 0x00, 0x09, 0xD9, 0x1E, 0xA1, 0xF1, 0xF0, 0x9F,
+    0x00, 0x76, 0x97, 0x59, 0xD7, 0x5A, 0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x5A, 0xD7, 0x5D, 0xA7, 0x5D,
+    0x97, 0x49, 0xD7, 0x5A, 0xCA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x74, 0x9D, 0x97,
+    0x4A, 0xD7, 0x5E, 0x75, 0xDA, 0x74, 0x9D, 0x75, 0xE7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75,
+    0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x97, 0x4E, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x4E, 0x75, 0xE7, 0x49,
+    0xDA, 0x74, 0xAD, 0x97, 0x4E, 0x74, 0x9E, 0x74, 0xAD, 0xA7, 0x4E, 0x75, 0xE7, 0x49, 0xDA, 0x74,
+    0xE9, 0x74, 0xE7, 0x49, 0xE7, 0x4A, 0xD7, 0x5C, 0xA7, 0x69, 0x76, 0x4A, 0xF9, 0x7A, 0xD9, 0x09,
+    0xAD, 0x5A, 0xD4, 0x9D, 0x4D, 0x95, 0xAC, 0xA2, 0xAD, 0x69, 0xD2, 0xDA, 0x7D, 0x90, 0x9D, 0xA2,
+    0xCA, 0x2D, 0xA0, 0x9D, 0x91, 0xAD, 0x2E, 0x0A, 0xD9, 0x1A, 0xD2, 0xAD, 0x0A, 0xD9, 0x1A, 0xD2,
+    0xE0, 0xAD, 0x91, 0xAD, 0x2E, 0x0A, 0xDA, 0x2C, 0xA2, 0xE0, 0xAD, 0xA6, 0x9E, 0x0A, 0xE6, 0xAE,
+    0x09, 0xE9, 0x5E, 0xA1, 0xF4, 0xAE, 0xA1, 0xFC, 0xA9, 0x9A, 0xF9, 0x1A, 0xFF, 0xF3, 0xFF, 0xEA,
+    0x39, 0xFF, 0xD5, 0xAF, 0xF7, 0x0A, 0xF9, 0x40, 0x59, 0x70, 0x9F, 0x6F, 0xD5, 0x9D, 0xAE, 0x59,
+    0xA1, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x09, 0xE7, 0x09, 0xE7, 0x09, 0xE7, 0x09, 0xE7,
+    0x09, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE4, 0xAF, 0xFE, 0xAA, 0xFF, 0xEA, 0xAF,
+    0xFE, 0xAA, 0xFF, 0xEA, 0x49, 0x99, 0x70, 0xAF, 0xEA, 0x4F, 0xFE, 0x29, 0xDA, 0x92, 0x9F, 0x19,
+    0x97, 0xE9, 0x72, 0x9E, 0x73, 0xE7, 0x3E, 0x72, 0x9E, 0x72, 0xEA, 0x71, 0xAE, 0x97, 0x09, 0xF7,
+    0x0A, 0xF7, 0x0F, 0xC9, 0x69, 0xFC, 0x96, 0xAF, 0xCA, 0x6F, 0xD9, 0x6A, 0xFC, 0xA7, 0xFF, 0xFC,
+    0x1F, 0xFF, 0xC0, 0x9F, 0xFF, 0xC0, 0xAF, 0xFF, 0xC9, 0x19, 0xAF, 0xCA, 0x5A, 0xFF, 0xCA, 0x3A,
+    0x95, 0x9D, 0xA7, 0x4D, 0x97, 0x39, 0xCA, 0x73, 0x9D, 0x73, 0x9C, 0xA7, 0x3D, 0x95, 0x99, 0x99,
+    0xAD, 0xA5, 0xFE, 0x96, 0xFD, 0xA9, 0x72, 0x9F, 0x73, 0xAE, 0x73, 0xE7, 0x3E, 0x97, 0x2E, 0x97,
+    0x19, 0xE1, 0x9A, 0xA9, 0x99, 0x99, 0xFC, 0x1F, 0xFF, 0xA1, 0xFF, 0xF1, 0xAF, 0xFD, 0xA3, 0x9A,
+    0xFC, 0xAA, 0x40, 0x71, 0x97, 0x5D, 0x74, 0xAD, 0x73, 0x9E, 0x97, 0x2F, 0x97, 0x1F, 0xC9, 0x70,
+    0xAD, 0x9D, 0xA7, 0x9E, 0x0D, 0xA7, 0xE1, 0xDA, 0x6E, 0x91, 0xDA, 0x59, 0xE2, 0xE5, 0xE3, 0xE4,
+    0xE9, 0x3E, 0x3A, 0xEA, 0xAA, 0xAF, 0xE0, 0xAF, 0xFF, 0xD0, 0x9F, 0xFF, 0xD7, 0x09, 0xE9, 0x72,
+    0x9E, 0x97, 0x2A, 0xE9, 0x72, 0xAE, 0xA7, 0x2A, 0xEA, 0x72, 0xAE, 0xA2, 0x77, 0xFF, 0xEA, 0x2F,
+    0xFE, 0xA2, 0xD9, 0x73, 0xD9, 0x73, 0xD9, 0x73, 0xD9, 0x73, 0xD9, 0x73, 0xD9, 0x73, 0xDA, 0x99,
+    0x71, 0xFF, 0xC9, 0x39, 0xFF, 0xE3, 0x99, 0x5A, 0xE7, 0x3A, 0xDA, 0x72, 0x9E, 0x72, 0x9E, 0x72,
+    0xAE, 0x19, 0x69, 0xF1, 0xEA, 0x99, 0xAF, 0xCA, 0x1F, 0xFF, 0x19, 0xFF, 0xEA, 0x1A, 0xFF, 0xD9,
+    0x39, 0xAF, 0xCA, 0x94, 0x5A, 0xFD, 0xA5, 0xAF, 0xFA, 0x4A, 0xEA, 0x99, 0x99, 0x94, 0xAD, 0xA7,
+    0x3D, 0xA7, 0x3A, 0xD7, 0x4D, 0xA7, 0x39, 0xD9, 0x73, 0x9D, 0x99, 0xFD, 0x93, 0xAD, 0xAF, 0xFC,
+    0x2A, 0xFC, 0x91, 0x9E, 0xA1, 0xAE, 0xA5, 0xE9, 0x0A, 0xE6, 0x9D, 0xA0, 0xAE, 0x7E, 0x09, 0xE7,
+    0xE1, 0xE7, 0xE1, 0xE9, 0x59, 0xE1, 0xAE, 0x93, 0x9E, 0xA2, 0xFF, 0xF3, 0x9F, 0xFD, 0x94, 0x9F,
+    0xF9, 0x7A, 0xFA, 0x40, 0x75, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0x70, 0x99, 0xDA, 0x71, 0x9D, 0x97,
+    0x1A, 0xD9, 0x71, 0xE7, 0x2E, 0x71, 0x9E, 0x71, 0xAD, 0xA7, 0x1E, 0xA7, 0x09, 0xE9, 0x70, 0xAE,
+    0x97, 0x0F, 0x71, 0xF7, 0x09, 0xF7, 0x0A, 0xEA, 0x70, 0xFA, 0x70, 0xF9, 0x7A, 0xF7, 0x0F, 0xC7,
+    0x0F, 0xC2, 0x49, 0xAF, 0xA7, 0x0A, 0xDA, 0x99, 0xAD, 0xA5, 0xAD, 0x5D, 0x94, 0xD9, 0x59, 0xD3,
+    0x9D, 0x7D, 0x92, 0xAD, 0x7D, 0x92, 0x9D, 0x95, 0x9D, 0x93, 0xE5, 0xE4, 0xAE, 0x91, 0x9E, 0xA5,
+    0xAF, 0xFA, 0x7A, 0xFD, 0x96, 0x9F, 0xFD, 0x49, 0xE9, 0x3A, 0xE9, 0x2E, 0x95, 0xAE, 0x19, 0xE7,
+    0xE1, 0xAD, 0xA7, 0xE9, 0x0A, 0xE7, 0xEA, 0x0A, 0xE9, 0x59, 0xE9, 0x1F, 0xA3, 0xAF, 0x2A, 0xFF,
+    0xF9, 0x39, 0xFF, 0xD9, 0x69, 0xAF, 0xA9, 0x30, 0x39, 0xFC, 0x96, 0xFF, 0xC4, 0xE9, 0x2A, 0xE2,
+    0xAD, 0x5A, 0xDA, 0x09, 0xD9, 0x6E, 0x0A, 0xD7, 0xE9, 0xAD, 0x7A, 0xDA, 0xAD, 0x7A, 0xE9, 0xD7,
+    0x9E, 0x9D, 0xA6, 0xAE, 0x0E, 0xA4, 0x9F, 0x1F, 0xFF, 0xC1, 0x9F, 0xFF, 0x3A, 0xAF, 0xA9, 0xE7,
+    0x3E, 0x73, 0xDA, 0x72, 0xAD, 0x91, 0x96, 0x9E, 0x2F, 0xFF, 0x19, 0xFF, 0xE9, 0x19, 0xFF, 0xDA,
+    0x29, 0xAF, 0xEA, 0x30, 0x0A, 0xE1, 0xF1, 0xF9, 0x9F, 0x99, 0xFA, 0x09, 0x99, 0x97, 0x77, 0x77,
+    0x3A, 0xE1, 0xF1, 0xF9, 0x9F, 0x9A, 0xFA, 0x71, 0xF3, 0xF3, 0xF2, 0x9F, 0x91, 0xAF, 0x97, 0x77,
+    0x77, 0x77, 0x2F, 0xC2, 0xFA, 0x2F, 0x91, 0x9F, 0x29, 0xF2, 0xAE, 0xA2, 0xF9, 0x19, 0xF7, 0x20,
+    0x77, 0x09, 0x77, 0x09, 0xD7, 0x6A, 0xF7, 0x4A, 0xFC, 0x97, 0x19, 0xAF, 0xC9, 0x71, 0x9F, 0xD9,
+    0x71, 0xAF, 0xCA, 0x97, 0x1A, 0xFC, 0xA7, 0x2A, 0xFC, 0xA7, 0x4A, 0xF9, 0x75, 0xAF, 0xDA, 0x97,
+    0x3A, 0xFF, 0xCA, 0x97, 0x19, 0xAF, 0xFC, 0xA9, 0x72, 0xAF, 0xFD, 0xA7, 0x29, 0xAF, 0xE7, 0x59,
+    0xAF, 0x77, 0x1A, 0xC0, 0x70, 0x99, 0x99, 0x1A, 0xFF, 0xE0, 0x9F, 0xFF, 0x77, 0x77, 0x77, 0x59,
+    0x2A, 0xAF, 0xFD, 0x09, 0xFF, 0xF1, 0x99, 0x97, 0x10, 0x09, 0x77, 0x2A, 0xCA, 0x77, 0x0A, 0xEA,
+    0x97, 0x6A, 0xFC, 0x97, 0x6A, 0xFC, 0xA7, 0x6A, 0xFC, 0xA7, 0x6A, 0xFD, 0x97, 0x59, 0xFD, 0x97,
+    0x59, 0xFD, 0x76, 0xAF, 0x73, 0xAF, 0xE7, 0x9A, 0xFF, 0xCA, 0x39, 0xAF, 0xFD, 0x93, 0x9F, 0xFD,
+    0xA9, 0x6A, 0xFE, 0xA9, 0x71, 0xAF, 0x97, 0x5A, 0xA9, 0x77, 0x00, 0x77, 0x49, 0x99, 0x99, 0x70,
+    0xAF, 0xF9, 0x4F, 0xFE, 0xA2, 0xAE, 0x91, 0x9A, 0xF9, 0x19, 0xCA, 0x6F, 0x74, 0xE9, 0x73, 0xAD,
+    0xA7, 0x3A, 0xDA, 0x73, 0xAD, 0xA7, 0x3A, 0xDA, 0x73, 0xE9, 0x73, 0xE7, 0x3E, 0xA7, 0x2A, 0xE7,
+    0x2A, 0xE9, 0x71, 0xFA, 0x70, 0xAF, 0xC7, 0x09, 0xFA, 0x71, 0x9E, 0xA7, 0x29, 0xEA, 0x72, 0x9E,
+    0xA7, 0x29, 0xEA, 0x72, 0x9E, 0xA7, 0x29, 0xE9, 0x73, 0x97, 0x77, 0x77, 0x6A, 0xD9, 0x73, 0xE9,
+    0x72, 0x9E, 0xA7, 0x2A, 0xEA, 0x72, 0xAF, 0x50, 0x77, 0x77, 0x59, 0xAF, 0xA9, 0x77, 0xAF, 0xFD,
+    0x74, 0x9E, 0xA9, 0x39, 0xE9, 0x71, 0xAD, 0xA7, 0x09, 0xD7, 0x0A, 0xD7, 0x4D, 0x6A, 0xD9, 0x74,
+    0x9C, 0xA5, 0xDA, 0x3A, 0xDA, 0xAA, 0x4D, 0x4E, 0x3D, 0xA9, 0xE4, 0xAC, 0x4D, 0xA2, 0x9C, 0x3D,
+    0x49, 0xC9, 0x29, 0xDA, 0x2A, 0xA3, 0xD4, 0x9C, 0x92, 0xAD, 0x92, 0xC9, 0x3A, 0xC4, 0xAC, 0x92,
+    0xAD, 0xA2, 0xC9, 0x3D, 0x4D, 0x3A, 0xE2, 0xDA, 0xAA, 0xE9, 0x2A, 0xCA, 0x3A, 0xE2, 0x9F, 0xE9,
+    0x1E, 0x4A, 0xEA, 0x29, 0xEA, 0x0F, 0xD5, 0x9F, 0x97, 0x0E, 0xA7, 0xFC, 0x97, 0x73, 0x9F, 0xCA,
+    0x77, 0x3A, 0xFD, 0xA9, 0x99, 0x99, 0xAD, 0x97, 0x1A, 0xFF, 0xFD, 0xA7, 0x2A, 0xFF, 0xFD, 0x74,
+    0xAF, 0xFF, 0x76, 0x9A, 0xFD, 0xAA, 0x97, 0x77, 0x50, 0x71, 0xE9, 0x77, 0x1A, 0xEA, 0x77, 0x1F,
+    0xC7, 0x70, 0x9F, 0xC9, 0x77, 0xAD, 0xAE, 0x77, 0xE0, 0xE7, 0x69, 0xDA, 0x0A, 0xDA, 0x75, 0xE9,
+    0x09, 0xE7, 0x5E, 0x2E, 0x97, 0x3A, 0xDA, 0x2A, 0xDA, 0x73, 0xE9, 0x29, 0xE7, 0x29, 0xE4, 0xE9,
+    0x71, 0xAD, 0xA4, 0xAE, 0x71, 0xE9, 0x49, 0xE7, 0x09, 0xE6, 0xEA, 0x7E, 0xA6, 0xAE, 0x7E, 0x97,
+    0xE9, 0x5A, 0xFF, 0xFF, 0x5F, 0xFF, 0xFC, 0x49, 0xFF, 0xFF, 0xCA, 0x3F, 0xFF, 0xFE, 0x3F, 0x72,
+    0xF9, 0x1A, 0xEA, 0x72, 0xAE, 0xA1, 0xF9, 0x72, 0x9F, 0x09, 0xF7, 0x4F, 0x90, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x70, 0x9F, 0xFE, 0xA5, 0x9F, 0xFF, 0xC4, 0x9E, 0x6A, 0xE3, 0x9E, 0x7A, 0xD9, 0x29,
+    0xE7, 0x0D, 0xA2, 0x9E, 0x70, 0xDA, 0x29, 0xE7, 0x9D, 0xA2, 0x9E, 0x69, 0xE3, 0x9F, 0xFF, 0xC9,
+    0x39, 0xFF, 0xEA, 0x59, 0xFF, 0xFC, 0xA3, 0x9E, 0x69, 0xF9, 0x19, 0xE7, 0x0A, 0xE1, 0x9E, 0x71,
+    0xE9, 0x09, 0xE7, 0x1A, 0xDA, 0x09, 0xE7, 0x1F, 0x09, 0xE7, 0x1F, 0x09, 0xE7, 0x09, 0xF0, 0x9E,
+    0x7A, 0xFC, 0x09, 0xFF, 0xFF, 0xA0, 0x9F, 0xFF, 0xF9, 0x09, 0xFF, 0xFE, 0xA1, 0x9F, 0xFF, 0xDA,
+    0x29, 0xFF, 0xFA, 0x40, 0x77, 0x76, 0x9A, 0xFC, 0xA9, 0x79, 0xAF, 0xFC, 0xA6, 0xAF, 0xFE, 0x95,
+    0xFD, 0x99, 0x99, 0x9A, 0xA5, 0xFC, 0x97, 0x4F, 0xC7, 0x59, 0xF7, 0x6F, 0x76, 0x9E, 0xA7, 0x6A,
+    0xE7, 0x7F, 0x77, 0xEA, 0x76, 0x9E, 0xA7, 0x69, 0xEA, 0x76, 0x9F, 0x76, 0x9F, 0x97, 0x59, 0xFC,
+    0x76, 0xFD, 0xA7, 0x09, 0x91, 0xFF, 0xAA, 0x99, 0x9A, 0xAD, 0xA1, 0xAF, 0xFF, 0xFA, 0x2F, 0xFF,
+    0xFA, 0x29, 0xFF, 0xFE, 0xA3, 0xAF, 0xFF, 0xDA, 0x4A, 0xFF, 0xFC, 0xA6, 0xAF, 0xFA, 0xA9, 0x77,
+    0x40, 0x9F, 0xFA, 0xA9, 0x72, 0x9F, 0xFF, 0xA7, 0x09, 0xFF, 0xFD, 0xA6, 0x9F, 0xFF, 0xEA, 0x59,
+    0xE5, 0x9A, 0xFC, 0xA4, 0x9E, 0x70, 0xAF, 0x93, 0x9E, 0x71, 0xAF, 0x39, 0xE7, 0x2A, 0xEA, 0x29,
+    0xE7, 0x3F, 0x29, 0xE7, 0x3F, 0x91, 0x9E, 0x73, 0xAE, 0xA1, 0x9E, 0x73, 0x9F, 0x19, 0xE7, 0x4F,
+    0x19, 0xE7, 0x4F, 0x19, 0xE7, 0x4F, 0x19, 0xE7, 0x39, 0xF1, 0x9E, 0x73, 0xFC, 0x19, 0xE7, 0x19,
+    0xFD, 0x19, 0xE9, 0x99, 0x99, 0x99, 0x9A, 0xFE, 0xA1, 0x9F, 0xFF, 0xFE, 0x29, 0xFF, 0xFF, 0xDA,
+    0x29, 0xFF, 0xFF, 0xCA, 0x39, 0xFF, 0xFF, 0xA4, 0x9F, 0xFF, 0xDA, 0x69, 0xFF, 0xDA, 0xA9, 0x70,
+    0x72, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xCA, 0x1A, 0xFF, 0xFC, 0xA1, 0xFF, 0xFC, 0xA2, 0xEA, 0x97,
+    0x3E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0xA9, 0x99, 0x9A, 0xAA, 0x94,
+    0xFF, 0xE9, 0x4F, 0xFE, 0x94, 0xFF, 0xE9, 0x4E, 0xA7, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x39,
+    0xE9, 0x73, 0x9E, 0x97, 0x39, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xDA, 0x09, 0xFF, 0xFE, 0x09, 0xFF,
+    0xFE, 0x09, 0xFF, 0xFE, 0x90, 0x19, 0x99, 0x99, 0xAA, 0xAA, 0xAA, 0xA9, 0x1F, 0xFF, 0x90, 0x9F,
+    0xFF, 0x90, 0x9E, 0x97, 0x19, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x2A, 0xE7, 0x2A, 0xDA, 0x72, 0xAF,
+    0xFE, 0x2A, 0xFF, 0xE2, 0xFF, 0xF2, 0xFA, 0xAA, 0xAA, 0xA9, 0x92, 0xF7, 0x2F, 0x72, 0xF7, 0x2F,
+    0x72, 0xF7, 0x2F, 0x72, 0xF7, 0x2F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x77,
+    0x75, 0x9A, 0xAF, 0xF9, 0x70, 0xAF, 0xFF, 0xC6, 0x9F, 0xFA, 0xAA, 0xAE, 0x94, 0x9F, 0xC9, 0x77,
+    0xFC, 0x77, 0x0A, 0xF7, 0x71, 0xFA, 0x77, 0x1F, 0x77, 0x19, 0xF7, 0x71, 0x9F, 0x77, 0x19, 0xEA,
+    0x77, 0x19, 0xEA, 0x77, 0x19, 0xEA, 0x7A, 0x99, 0x95, 0x9E, 0xA7, 0xAF, 0xEA, 0x99, 0xF7, 0x9F,
+    0xFA, 0x0F, 0x72, 0x9A, 0xFC, 0x0F, 0x97, 0x3E, 0x99, 0x0F, 0xC7, 0x3E, 0x2A, 0xFA, 0x71, 0x9E,
+    0x29, 0xFD, 0xAA, 0x99, 0x99, 0x9A, 0xAF, 0x3F, 0xFF, 0xFE, 0x39, 0xFF, 0xFF, 0xD4, 0x9F, 0xFF,
+    0xFC, 0x59, 0xFF, 0xFD, 0xA7, 0x19, 0xAF, 0xEA, 0x94, 0x09, 0xAA, 0x97, 0x29, 0xAA, 0x91, 0xEA,
+    0x72, 0xEA, 0x1E, 0xA7, 0x2F, 0x1E, 0xA7, 0x2F, 0x1F, 0x72, 0xF1, 0xF7, 0x2F, 0x1F, 0x72, 0xF1,
+    0xF7, 0x2F, 0x1F, 0x72, 0xF1, 0xF7, 0x2F, 0x1F, 0x72, 0xF1, 0xF7, 0x2F, 0x1F, 0x72, 0xF1, 0xFA,
+    0x99, 0x99, 0x99, 0x99, 0x9A, 0xF1, 0xFF, 0xFF, 0xE9, 0x0F, 0xFF, 0xFE, 0x90, 0xFF, 0xFF, 0xE9,
+    0x9F, 0xFF, 0xFE, 0x99, 0xFF, 0xFF, 0xE9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F,
+    0x97, 0x09, 0xFA, 0x9F, 0x97, 0x09, 0xFA, 0x9F, 0x97, 0x0A, 0xFA, 0x9F, 0xA7, 0x0A, 0xFA, 0xAA,
+    0xAA, 0x90, 0xAE, 0x90, 0xAE, 0x90, 0xAE, 0x90, 0x9E, 0x90, 0x9E, 0x90, 0x9E, 0x90, 0x9E, 0x90,
+    0x9E, 0x90, 0x9E, 0x90, 0x9E, 0x90, 0x9E, 0x90, 0x9E, 0x90, 0x9E, 0x90, 0x9E, 0xA0, 0x9E, 0xA0,
+    0x9E, 0xA0, 0x9E, 0xA0, 0x9F, 0x0A, 0xF0, 0xAF, 0x0A, 0xF0, 0xFC, 0x0F, 0xC0, 0xFC, 0x00, 0x69,
+    0xAA, 0xA9, 0x6A, 0xE9, 0x6A, 0xE9, 0x6F, 0x96, 0xF9, 0x6F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0x7E, 0xA7, 0xEA, 0x7E, 0xA6, 0x9E, 0xA6, 0x9E, 0xA6, 0x9E, 0x96, 0x9E, 0x96,
+    0x9E, 0x96, 0x9E, 0x96, 0xAE, 0x7F, 0x29, 0x19, 0xFC, 0x19, 0xFF, 0xA1, 0x9F, 0xF9, 0x19, 0xFE,
+    0xA2, 0x9F, 0xDA, 0x39, 0xFA, 0x97, 0x70, 0x19, 0xE4, 0x9F, 0x59, 0xE4, 0xF9, 0x5A, 0xE3, 0x9E,
+    0xA6, 0xAE, 0x3F, 0x7A, 0xE2, 0xAE, 0xA7, 0xF1, 0x9F, 0x70, 0xEA, 0x1F, 0x97, 0x0E, 0xA0, 0x9E,
+    0xA7, 0x1E, 0xA0, 0xF7, 0x2E, 0xAA, 0xEA, 0x72, 0xFF, 0x72, 0x9F, 0xE9, 0x72, 0x9F, 0xDA, 0x73,
+    0x9F, 0xD9, 0x73, 0xAF, 0xE7, 0x3A, 0xFF, 0x72, 0xAF, 0xFC, 0x71, 0xF0, 0xFD, 0x70, 0xF1, 0xFD,
+    0x7F, 0x19, 0xFD, 0x6F, 0x2A, 0xFD, 0x5F, 0x3F, 0xE3, 0x9F, 0x4F, 0xE2, 0x9F, 0x49, 0xFE, 0x19,
+    0xF5, 0xAF, 0xE0, 0x1A, 0xAA, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0xAE, 0x73,
+    0xAE, 0x73, 0xAE, 0x73, 0xAE, 0x73, 0xAE, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xEA, 0x73,
+    0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x72, 0x9F, 0xAA, 0xAA, 0xAF, 0xD9, 0xFF,
+    0xFE, 0x9F, 0xFF, 0xE9, 0xFF, 0xFE, 0x9F, 0xFF, 0xE0, 0x1A, 0xAA, 0xAA, 0x73, 0xAA, 0xAA, 0x93,
+    0xFC, 0x97, 0x19, 0xFA, 0x3F, 0xCA, 0x71, 0xFD, 0x29, 0xFD, 0x71, 0xFD, 0x29, 0xFD, 0xA7, 0xAF,
+    0xD2, 0x9F, 0xE7, 0xFE, 0x29, 0xFE, 0x95, 0x9F, 0xE2, 0xAF, 0xF5, 0xFF, 0x2A, 0xEA, 0xF5, 0xFA,
+    0xE9, 0x1A, 0xE9, 0xFA, 0x3A, 0xEA, 0xAE, 0x91, 0xAE, 0x0F, 0xC3, 0xF9, 0xAE, 0x91, 0xAE, 0x09,
+    0xF9, 0x19, 0xF0, 0xAE, 0xA1, 0xF1, 0xFC, 0x1F, 0xA0, 0xAE, 0xA1, 0xF1, 0xAF, 0x1F, 0x1F, 0xA1,
+    0xF2, 0xFA, 0xAF, 0x1F, 0xC1, 0xF2, 0xFF, 0xC9, 0x1F, 0xC1, 0xF9, 0x19, 0xFF, 0x2F, 0xC1, 0xF9,
+    0x2F, 0xF2, 0xFC, 0x1F, 0x92, 0xAF, 0xD9, 0x2F, 0xC1, 0xF9, 0x3F, 0xD3, 0xFC, 0x1F, 0xA3, 0xFC,
+    0xA2, 0x9F, 0xC0, 0x9F, 0xA3, 0x9F, 0x92, 0x9F, 0xC9, 0x9F, 0xA4, 0xF3, 0x9F, 0xC9, 0x9F, 0xA7,
+    0x4A, 0xFC, 0x99, 0xFC, 0x74, 0xAF, 0xCA, 0x77, 0x0A, 0xAA, 0xA1, 0x9E, 0xA7, 0x1F, 0x1A, 0xF7,
+    0x1F, 0x1A, 0xFA, 0x70, 0xEA, 0x1F, 0xD7, 0x0E, 0xA1, 0xFD, 0xA7, 0xEA, 0x1F, 0xE6, 0x9E, 0xA1,
+    0xFE, 0x95, 0x9E, 0x91, 0xEA, 0xF5, 0x9E, 0x91, 0xEA, 0xAE, 0x94, 0xAE, 0x90, 0x9E, 0xA0, 0xF4,
+    0xAE, 0x90, 0x9E, 0xA0, 0xAE, 0x93, 0xAE, 0x90, 0x9E, 0xA1, 0xF3, 0xF1, 0xAE, 0xA1, 0xAE, 0x92,
+    0xF1, 0xAE, 0xA2, 0xF2, 0xF1, 0xAE, 0xA2, 0xAE, 0x91, 0xF1, 0xFC, 0x3E, 0xA1, 0xF1, 0xFC, 0x3F,
+    0x1F, 0x1F, 0xC3, 0x9E, 0xA9, 0xF1, 0xFC, 0x4F, 0x9F, 0x1F, 0xC4, 0x9F, 0xF1, 0xFC, 0x5F, 0xEA,
+    0x09, 0xFC, 0x59, 0xFD, 0xA0, 0x9F, 0xC6, 0xFD, 0xA0, 0x9F, 0xC6, 0x9F, 0xCA, 0x00, 0x69, 0xAF,
+    0xCA, 0x97, 0x39, 0xFF, 0xEA, 0x70, 0xAF, 0xDA, 0xFE, 0x95, 0xFC, 0xA4, 0x9F, 0xC9, 0x3A, 0xF9,
+    0x7F, 0xC3, 0xF9, 0x71, 0xFA, 0x1A, 0xEA, 0x72, 0x9F, 0x1F, 0x74, 0xF9, 0x0F, 0x74, 0x9E, 0x99,
+    0xE9, 0x75, 0xEA, 0x9E, 0x76, 0xEA, 0x9E, 0x76, 0xAE, 0x9E, 0x76, 0xAE, 0x9E, 0x76, 0xAD, 0xA9,
+    0xE7, 0x6E, 0xA9, 0xE9, 0x75, 0xEA, 0x0F, 0x74, 0xAE, 0x90, 0xFC, 0x72, 0xAF, 0x1A, 0xFD, 0x99,
+    0x29, 0x9A, 0xFD, 0x2F, 0xFF, 0xFE, 0xA2, 0xAF, 0xFF, 0xFD, 0x4F, 0xFF, 0xFC, 0xA5, 0xFF, 0xFE,
+    0xA7, 0xAF, 0xFF, 0x97, 0x29, 0xAF, 0xDA, 0x97, 0x77, 0x40, 0x09, 0xFF, 0xCA, 0x59, 0xFF, 0xEA,
+    0x3A, 0xEA, 0xAA, 0xFE, 0x2A, 0xDA, 0x59, 0xF1, 0xAD, 0xA7, 0xE1, 0xAD, 0xA7, 0xAD, 0x90, 0xAD,
+    0xA7, 0xAD, 0xA0, 0xEA, 0x7E, 0x90, 0xEA, 0x7E, 0x90, 0xEA, 0x5A, 0xF1, 0xFF, 0xFD, 0xA1, 0xFF,
+    0xFD, 0x2F, 0xFF, 0x93, 0xFC, 0xAA, 0xAA, 0x96, 0xF7, 0x4F, 0x73, 0x9F, 0x73, 0x9F, 0x73, 0x9F,
+    0x73, 0x9F, 0x73, 0xAF, 0x73, 0xAF, 0x73, 0xAF, 0x97, 0x2A, 0xF9, 0x72, 0xAF, 0x97, 0x20, 0x79,
+    0xAF, 0xCA, 0x76, 0x9F, 0xFD, 0xA7, 0x3A, 0xFC, 0xAA, 0xFD, 0x97, 0x0A, 0xF9, 0x49, 0xF9, 0x6A,
+    0xEA, 0x70, 0xF6, 0xEA, 0x72, 0xEA, 0x4A, 0xE7, 0x39, 0xE4, 0xEA, 0x74, 0xEA, 0x29, 0xE7, 0x5A,
+    0xE2, 0xAE, 0x75, 0x9E, 0x2E, 0xA7, 0x59, 0xE2, 0xEA, 0x76, 0xE2, 0xEA, 0x76, 0xE9, 0x1E, 0xA7,
+    0x6E, 0x2E, 0xA7, 0x59, 0xE2, 0xF7, 0x5A, 0xE2, 0xF7, 0x5F, 0x2A, 0xEA, 0x59, 0xCA, 0x29, 0xEA,
+    0x29, 0xFA, 0x4F, 0xCA, 0xF9, 0x3F, 0xDA, 0xAA, 0xAF, 0xFD, 0x4A, 0xFF, 0xFF, 0xD9, 0x5F, 0xFF,
+    0xFC, 0xA7, 0xFF, 0xFF, 0x71, 0xFF, 0xFD, 0xA7, 0x3A, 0xAF, 0xFE, 0xA7, 0x71, 0xFE, 0xA7, 0x70,
+    0x9F, 0xE9, 0x77, 0x09, 0xFE, 0x97, 0x70, 0x9F, 0xE0, 0x1A, 0xAA, 0xAA, 0xAA, 0x99, 0x70, 0xFF,
+    0xDA, 0x6F, 0xFF, 0x5D, 0x59, 0xEA, 0x4D, 0x7E, 0x39, 0xD7, 0xAD, 0x92, 0x9D, 0x79, 0xDA, 0x29,
+    0xD7, 0xAD, 0xA2, 0x9D, 0x69, 0xE9, 0x2A, 0xD5, 0xAF, 0x3A, 0xFF, 0xFA, 0x3A, 0xFF, 0xE9, 0x4A,
+    0xFF, 0xDA, 0x5F, 0xFF, 0xC4, 0xFA, 0x99, 0x9A, 0xFA, 0x3F, 0x5A, 0xE9, 0x2F, 0x6E, 0xA2, 0xF9,
+    0x5F, 0x2F, 0x95, 0xF2, 0xF9, 0x5F, 0x91, 0xF9, 0x5F, 0xA0, 0x9F, 0xA5, 0xFC, 0x09, 0xFA, 0x5F,
+    0xC0, 0x9F, 0xA5, 0xFC, 0x99, 0xFA, 0x5F, 0xCA, 0x70, 0x99, 0xA9, 0x99, 0x97, 0x4A, 0xFF, 0xE7,
+    0x1F, 0xFF, 0xC7, 0x0F, 0xFF, 0xD7, 0x9F, 0xCA, 0x94, 0x99, 0x7A, 0xEA, 0x77, 0x1F, 0x77, 0x2E,
+    0x97, 0x72, 0xE9, 0x77, 0x2F, 0x77, 0x2A, 0xFC, 0xA9, 0x77, 0xFF, 0xCA, 0x97, 0x4F, 0xFE, 0xA7,
+    0x39, 0xFF, 0xEA, 0x74, 0x9A, 0xFF, 0xC7, 0x79, 0xFE, 0x77, 0x0F, 0xDA, 0x77, 0x9F, 0xD7, 0x79,
+    0xFD, 0x49, 0x71, 0xFE, 0x3A, 0xFA, 0xAA, 0xAA, 0xFF, 0xC2, 0x9F, 0xFF, 0xFD, 0xA2, 0xFF, 0xFF,
+    0xE2, 0xFF, 0xFF, 0xDA, 0x3F, 0xFF, 0xFC, 0x95, 0x9A, 0xFF, 0xDA, 0x97, 0x77, 0x50, 0x9F, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9A, 0xA9, 0x99, 0x91, 0xE9, 0x39, 0x99, 0x97, 0x0E,
+    0x97, 0x70, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xEA, 0x77, 0x0E, 0xA7,
+    0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0xAE, 0xA7, 0x7A,
+    0xF7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x9F,
+    0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF,
+    0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9F,
+    0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71,
+    0x9E, 0xA1, 0xF7, 0x19, 0xE9, 0x1F, 0x71, 0xAE, 0x91, 0xF9, 0x70, 0xF9, 0x1A, 0xF7, 0x9F, 0x2A,
+    0xFC, 0xAA, 0x99, 0x9A, 0xFD, 0x29, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xE5, 0xFF,
+    0xFD, 0x96, 0x9F, 0xFD, 0xA7, 0x77, 0x10, 0x9A, 0xAA, 0x97, 0x59, 0xAA, 0xA1, 0xEA, 0x75, 0xF1,
+    0xF7, 0x49, 0xEA, 0x19, 0xE9, 0x73, 0xF3, 0xF7, 0x3F, 0x3F, 0x72, 0xAE, 0xA3, 0xAE, 0xA7, 0x1F,
+    0x5F, 0x70, 0x9F, 0x5F, 0x97, 0xFA, 0x5A, 0xEA, 0x7F, 0x7F, 0x6A, 0xF7, 0xF9, 0x5F, 0xA7, 0xAF,
+    0x49, 0xF7, 0x09, 0xF4, 0xFC, 0x71, 0xFA, 0x29, 0xFA, 0x71, 0xAF, 0x2A, 0xF7, 0x29, 0xF9, 0x1F,
+    0xC7, 0x3F, 0xA0, 0x9F, 0xA7, 0x3A, 0xFF, 0xD7, 0x49, 0xFF, 0xD7, 0x5F, 0xFC, 0xA7, 0x5F, 0xFC,
+    0x76, 0x9F, 0xF7, 0x7F, 0xEA, 0x77, 0xFE, 0x97, 0x9E, 0x97, 0x75, 0xF0, 0xEA, 0x77, 0x5E, 0xA0,
+    0xF7, 0x74, 0xAE, 0x90, 0xAE, 0x77, 0x4F, 0x1A, 0xE9, 0x77, 0x3F, 0x19, 0xEA, 0x77, 0x29, 0xEA,
+    0x2F, 0x77, 0x2A, 0xE9, 0x2F, 0x7E, 0x96, 0xF3, 0xAE, 0x95, 0xAF, 0x6F, 0x39, 0xEA, 0x5F, 0xC9,
+    0x49, 0xEA, 0x4F, 0x4A, 0xFC, 0xA4, 0xAE, 0x94, 0xF4, 0xFE, 0x4F, 0x5F, 0x92, 0xAF, 0xEA, 0x3F,
+    0x5A, 0xEA, 0x2F, 0xAF, 0x29, 0xEA, 0x59, 0xF1, 0xAF, 0x0A, 0xEA, 0x1A, 0xE9, 0x6F, 0x1F, 0xA0,
+    0x9F, 0x1F, 0x7F, 0x0A, 0xF9, 0x1F, 0xA9, 0xF7, 0xAE, 0xAF, 0xC2, 0xAF, 0xAE, 0xA7, 0x9F, 0xFA,
+    0x3F, 0xF9, 0x79, 0xFF, 0x4F, 0xF7, 0x1F, 0xF4, 0x9F, 0xE7, 0x1F, 0xE9, 0x5F, 0xE7, 0x1A, 0xFD,
+    0x6A, 0xFC, 0xA7, 0x19, 0xFC, 0xA6, 0x9F, 0xC9, 0x72, 0xFC, 0x70, 0xFC, 0x50, 0x1A, 0xD7, 0x4A,
+    0xD9, 0x29, 0xE7, 0x29, 0xE4, 0xEA, 0x71, 0xE9, 0x5E, 0x97, 0xEA, 0x6A, 0xE6, 0xAE, 0x70, 0xEA,
+    0x49, 0xE9, 0x70, 0x9E, 0x93, 0xF7, 0x2F, 0x2A, 0xE7, 0x4F, 0x09, 0xEA, 0x74, 0xAE, 0xAF, 0x76,
+    0xFE, 0x97, 0x69, 0xFC, 0xA7, 0x70, 0xAF, 0x77, 0x1F, 0xC9, 0x77, 0xFE, 0x76, 0xAF, 0xF7, 0x49,
+    0xFA, 0xFA, 0x73, 0xFC, 0x0A, 0xF9, 0x71, 0xAF, 0x91, 0xFC, 0x70, 0x9F, 0xA2, 0x9F, 0xA7, 0xFC,
+    0x4A, 0xF9, 0x5F, 0xC9, 0x5F, 0xC4, 0xAF, 0xA6, 0xAF, 0xC2, 0x9F, 0xC7, 0x0F, 0xC9, 0x1F, 0xC9,
+    0x70, 0x9F, 0xC0, 0x0E, 0x97, 0x29, 0xE1, 0xF7, 0x2E, 0xA1, 0x9E, 0x97, 0x09, 0xE3, 0xF7, 0x0F,
+    0x39, 0xEA, 0x6A, 0xE9, 0x4F, 0x6F, 0x59, 0xEA, 0x4A, 0xE9, 0x6F, 0x92, 0x9F, 0x79, 0xF2, 0xF9,
+    0x70, 0xF9, 0x09, 0xF7, 0x19, 0xF0, 0xF9, 0x72, 0xFF, 0xC7, 0x3A, 0xFE, 0x97, 0x4F, 0xE7, 0x5A,
+    0xFC, 0x97, 0x6F, 0xC7, 0x7F, 0xA7, 0x7F, 0xA7, 0x7F, 0xA7, 0x69, 0xFA, 0x76, 0xAF, 0xA7, 0x6A,
+    0xFA, 0x76, 0xFC, 0xA7, 0x6F, 0xCA, 0x75, 0x9F, 0xCA, 0x70, 0x2A, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF,
+    0xCA, 0x4F, 0xFF, 0xFC, 0xA4, 0xAF, 0xFF, 0xFA, 0x77, 0x0F, 0xC9, 0x77, 0xFD, 0x77, 0xFD, 0x77,
+    0xFD, 0x77, 0xFD, 0x97, 0x6F, 0xD9, 0x76, 0xFD, 0xA7, 0x6F, 0xDA, 0x76, 0xAF, 0xD7, 0x6A, 0xFD,
+    0x76, 0xAF, 0xD7, 0x6A, 0xFD, 0x97, 0x5A, 0xFD, 0x97, 0x5A, 0xFD, 0xA7, 0x5A, 0xFD, 0xA7, 0x5A,
+    0xFE, 0x75, 0x9F, 0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0xF9, 0x09, 0xFF, 0xFF, 0xFA, 0x09, 0xFF, 0xFF,
+    0xFC, 0x09, 0xFF, 0xFF, 0xFC, 0x00, 0x1A, 0xFD, 0x91, 0xFE, 0x91, 0xFE, 0x91, 0xE9, 0x5E, 0x6E,
+    0x6E, 0x6E, 0x6E, 0x59, 0xE5, 0x9E, 0x59, 0xE5, 0x9E, 0x59, 0xE5, 0xAD, 0xA5, 0xAD, 0xA5, 0xAD,
+    0xA5, 0xAD, 0xA5, 0xAD, 0xA5, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x6E, 0x6E, 0x6E,
+    0x6E, 0x59, 0xE5, 0x9E, 0x59, 0xE5, 0x9E, 0x59, 0xE5, 0xAD, 0xA5, 0xAD, 0xA5, 0xAD, 0xA5, 0xAF,
+    0xE1, 0xAF, 0xE1, 0xFF, 0x19, 0x99, 0x99, 0x99, 0x91, 0x72, 0x97, 0x9A, 0x7A, 0xC7, 0xAC, 0x96,
+    0x9D, 0x7D, 0x7A, 0xCA, 0x69, 0xD7, 0xD9, 0x6D, 0xA6, 0xAD, 0x7D, 0x96, 0xE6, 0xAD, 0x69, 0xDA,
+    0x6E, 0x6A, 0xD6, 0x9D, 0xA6, 0xE6, 0xE9, 0x59, 0xDA, 0x6E, 0x6E, 0x95, 0xAD, 0x69, 0xCA, 0x7C,
+    0x70, 0x91, 0xAF, 0xD9, 0x1A, 0xFD, 0xA1, 0xAF, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x59, 0xE5, 0x9E,
+    0x59, 0xE5, 0x9E, 0x59, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95,
+    0xE9, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x59, 0xE5, 0x9E, 0x59, 0xE5,
+    0x9E, 0x59, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE9, 0x5E, 0x90, 0xAF, 0xE9, 0x09, 0xFE, 0x90,
+    0x9F, 0xE9, 0x19, 0x99, 0x99, 0x99, 0x00, 0x4A, 0xA7, 0x09, 0xDA, 0x7F, 0x95, 0xDA, 0x9D, 0x93,
+    0xD3, 0xD9, 0x1C, 0xA5, 0x9C, 0x90, 0x77, 0x29, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xCA, 0x9A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x0E, 0x7E, 0x96, 0xEA, 0x6F, 0x70, 0x99, 0x00,
+    0x77, 0x6A, 0xEA, 0x09, 0xD5, 0x9F, 0xEA, 0xD4, 0x9E, 0xAA, 0xAF, 0xC4, 0xE4, 0xAE, 0x3A, 0xD6,
+    0xE3, 0xDA, 0x6A, 0xD9, 0x2D, 0x7A, 0xD9, 0x19, 0xD7, 0x9D, 0xA1, 0x9D, 0x7A, 0xDA, 0x1A, 0xD7,
+    0xF1, 0x9D, 0x95, 0xAF, 0x2F, 0xA9, 0x9A, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0x9F, 0xF9,
+    0x9D, 0x94, 0xAF, 0xA1, 0x9D, 0x90, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x74,
+    0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x0A, 0xFC, 0x5F, 0xFF, 0xA3,
+    0xFE, 0xA9, 0xAE, 0xA2, 0xFC, 0xA4, 0xAD, 0x91, 0xAF, 0x6E, 0x1A, 0xE9, 0x6A, 0xD9, 0x0A, 0xE7,
+    0x9D, 0x90, 0xAE, 0x79, 0xDA, 0x09, 0xE7, 0x9D, 0x90, 0x9E, 0x7E, 0x90, 0x9E, 0xA5, 0xAE, 0x2F,
+    0xC9, 0x99, 0x9F, 0xA2, 0xFF, 0xFC, 0x3A, 0xFF, 0xE9, 0x4F, 0xFD, 0x96, 0xAF, 0xE7, 0x39, 0x99,
+    0x60, 0x77, 0x19, 0xFD, 0x5F, 0xF4, 0xFA, 0xA9, 0xAA, 0x3A, 0xE7, 0x1E, 0x97, 0x09, 0xE7, 0x19,
+    0xDA, 0x71, 0xAD, 0x97, 0x1A, 0xD9, 0x71, 0x9D, 0xA7, 0x19, 0xE9, 0x71, 0xF9, 0x70, 0xAF, 0xA9,
+    0x99, 0xA4, 0xFF, 0xD4, 0xFF, 0xCA, 0x5A, 0xFC, 0xA9, 0x76, 0x74, 0xAD, 0x75, 0xAD, 0x75, 0xAD,
+    0x75, 0xAD, 0x75, 0xAD, 0x75, 0xE7, 0x5E, 0x75, 0xE5, 0x9F, 0x91, 0xE4, 0xFE, 0xA0, 0xE3, 0xFF,
+    0xCA, 0xDA, 0x2A, 0xDA, 0x91, 0x9F, 0xCA, 0x2D, 0xA5, 0xFA, 0x1E, 0x6A, 0xEA, 0x1D, 0xA6, 0x9E,
+    0xA0, 0x9D, 0x96, 0x9E, 0xA0, 0x9D, 0x97, 0xE9, 0x09, 0xD9, 0x69, 0xE9, 0x09, 0xE6, 0xAE, 0x90,
+    0x9E, 0xA4, 0xAF, 0x91, 0xFF, 0xFD, 0xA1, 0x9F, 0xFF, 0xCA, 0x2A, 0xFF, 0xFA, 0x3A, 0xFF, 0x0D,
+    0xA5, 0xAF, 0xA1, 0xDA, 0x77, 0x10, 0x49, 0xAE, 0xA7, 0x0F, 0xF9, 0x5E, 0xA3, 0xD9, 0x3E, 0x6D,
+    0x29, 0xD7, 0x9D, 0x1D, 0xA3, 0x99, 0x9A, 0xAD, 0x1F, 0xFF, 0xD9, 0x9F, 0xFF, 0xAA, 0x9A, 0xD9,
+    0x97, 0x29, 0xD9, 0x73, 0x9D, 0xA7, 0x4E, 0xA7, 0x3F, 0xC9, 0x59, 0xA2, 0xFF, 0xFC, 0x29, 0xFF,
+    0xF3, 0x9F, 0xFE, 0x59, 0xAF, 0xAA, 0x20, 0x75, 0x9F, 0xA2, 0x9F, 0xCA, 0x2A, 0xD6, 0xDA, 0x6D,
+    0x7D, 0x7D, 0x93, 0xAF, 0xFC, 0xAF, 0xFC, 0x9A, 0xAE, 0xAA, 0xAA, 0x2E, 0x59, 0xE5, 0x9E, 0x59,
+    0xE5, 0x9E, 0x59, 0xE5, 0x9E, 0x59, 0xE5, 0x9E, 0x5A, 0xE5, 0xAE, 0x5A, 0xE5, 0xAE, 0x30, 0x39,
+    0xEA, 0x91, 0x9A, 0xA3, 0xFE, 0xA0, 0xE2, 0xFF, 0xFC, 0x19, 0xDA, 0x29, 0xFD, 0x1D, 0xA4, 0x9F,
+    0xC1, 0xD9, 0x5A, 0xF0, 0x9D, 0x69, 0xEA, 0x09, 0xD7, 0xEA, 0x09, 0xD7, 0xEA, 0x09, 0xD6, 0x9E,
+    0xA1, 0xD9, 0x5F, 0xA1, 0xFA, 0xAA, 0xFD, 0xA1, 0x9F, 0xFF, 0x92, 0xFF, 0xF9, 0x3F, 0xEA, 0xAD,
+    0x94, 0x9F, 0x90, 0xE7, 0x39, 0xE7, 0x29, 0xF3, 0xCA, 0x3A, 0xFA, 0x29, 0xFF, 0xE3, 0xAF, 0xFD,
+    0x93, 0xAF, 0xFC, 0xA6, 0xAA, 0xFA, 0x50, 0x1E, 0x74, 0xE7, 0x4D, 0xA7, 0x4D, 0xA7, 0x4D, 0xA7,
+    0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x0A, 0xFA, 0x4A, 0xDA, 0xFF,
+    0x92, 0xAF, 0xFF, 0x2A, 0xFA, 0x29, 0xE9, 0x1A, 0xE9, 0x49, 0xDA, 0x1F, 0x6E, 0x1E, 0xA6, 0xAD,
+    0x1E, 0x96, 0xAD, 0x1E, 0x96, 0xAD, 0x1E, 0x96, 0xAD, 0x1E, 0x96, 0xE1, 0xE9, 0x6E, 0x09, 0xE9,
+    0x6E, 0x99, 0xE9, 0x6E, 0x99, 0xEA, 0x59, 0xE9, 0xAE, 0xA5, 0x9E, 0x90, 0x0A, 0xD9, 0x1E, 0xA1,
+    0xEA, 0x09, 0xF0, 0xAF, 0x77, 0x72, 0x99, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAC, 0xA2, 0xAC, 0xA2,
+    0xAD, 0x2A, 0xD2, 0xAD, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x90, 0x9E, 0x90, 0x6A, 0xDA,
+    0x7E, 0xA7, 0xF6, 0x9F, 0x69, 0xF7, 0x77, 0x77, 0x49, 0x97, 0x09, 0xD9, 0x79, 0xD9, 0x79, 0xD7,
+    0x09, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7,
+    0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x9D, 0x97, 0xE9, 0x59,
+    0xF3, 0x9F, 0xE3, 0xFE, 0x39, 0xEA, 0xA9, 0x77, 0x00, 0x77, 0x09, 0xDA, 0x73, 0x9D, 0xA7, 0x39,
+    0xD9, 0x73, 0xAD, 0x97, 0x3A, 0xD9, 0x73, 0xAD, 0x97, 0x3A, 0xD7, 0x4A, 0xD7, 0x4E, 0x2A, 0xE5,
+    0xE1, 0x9E, 0x6E, 0x09, 0xE7, 0xE0, 0xE9, 0x7F, 0xDA, 0x70, 0xFD, 0x71, 0xFC, 0xA7, 0x1F, 0xDA,
+    0x70, 0xEA, 0xEA, 0x69, 0xE0, 0xFA, 0x59, 0xE1, 0xFA, 0x49, 0xE1, 0x9F, 0xA3, 0x9E, 0x2A, 0xFA,
+    0x29, 0xE3, 0xFC, 0xA1, 0xAE, 0x4F, 0xD0, 0x19, 0x99, 0x5A, 0xD5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE4,
+    0x9D, 0xA4, 0x9D, 0xA4, 0x9D, 0x94, 0x9D, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94,
+    0xAD, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4F, 0xE1, 0xFE, 0x1A, 0xFD, 0x00, 0x69,
+    0xEA, 0x93, 0x9A, 0xE9, 0x4A, 0xD0, 0xFE, 0xA1, 0xAF, 0xD9, 0x3F, 0xFF, 0x99, 0xFF, 0x3F, 0xC3,
+    0xAF, 0xD2, 0x9D, 0xA2, 0xF5, 0xFC, 0x4A, 0xD2, 0xE9, 0x59, 0xE9, 0x49, 0xD1, 0x9E, 0x69, 0xE5,
+    0x9D, 0x19, 0xE6, 0x9D, 0xA5, 0x9D, 0x90, 0xAE, 0x69, 0xDA, 0x59, 0xD9, 0x0A, 0xE6, 0xAD, 0x95,
+    0xAD, 0x90, 0xEA, 0x6E, 0x95, 0xAD, 0x90, 0xEA, 0x6E, 0x6E, 0x90, 0xE9, 0x6E, 0x6E, 0xA0, 0xE9,
+    0x59, 0xE6, 0xEA, 0x9E, 0x95, 0xAE, 0x6E, 0xA9, 0xE6, 0xEA, 0x6E, 0xA0, 0x69, 0x99, 0x69, 0xD0,
+    0xAF, 0xCA, 0x49, 0xFF, 0xE3, 0xAF, 0x92, 0xAD, 0xA2, 0xAE, 0x94, 0xE2, 0xAE, 0x5A, 0xD9, 0x1E,
+    0x95, 0x9D, 0x91, 0xE9, 0x59, 0xDA, 0x1E, 0x95, 0x9D, 0xA1, 0xE9, 0x59, 0xE1, 0xE9, 0x5A, 0xE1,
+    0xEA, 0x5A, 0xE1, 0xEA, 0x5A, 0xE0, 0x9E, 0xA5, 0xAE, 0x09, 0xEA, 0x5A, 0xE0, 0x9E, 0xA5, 0xAE,
+    0x0A, 0xF5, 0xAE, 0x90, 0x4A, 0xFA, 0x96, 0xAF, 0xFA, 0x4A, 0xFA, 0xAF, 0xC2, 0x9E, 0x5A, 0xD9,
+    0x1E, 0x7E, 0x1D, 0xA7, 0x9D, 0x99, 0xD9, 0x79, 0xDA, 0xAD, 0x97, 0x0D, 0xAA, 0xD9, 0x79, 0xDA,
+    0x9D, 0xA7, 0x9D, 0xA0, 0xE7, 0xE9, 0x0F, 0xA9, 0x99, 0x9A, 0xF2, 0xFF, 0xF9, 0x2A, 0xFF, 0xDA,
+    0x49, 0xFF, 0xA7, 0xAF, 0xA4, 0x70, 0xAA, 0xAA, 0x96, 0xE0, 0xAF, 0xDA, 0x5E, 0xAE, 0xAA, 0xAE,
+    0x4A, 0xFA, 0x4D, 0xA3, 0xAF, 0x59, 0xD3, 0xAE, 0x96, 0xD9, 0x2A, 0xE7, 0xDA, 0x29, 0xE7, 0xDA,
+    0x29, 0xE7, 0xDA, 0x29, 0xE9, 0x6D, 0xA2, 0xAF, 0x59, 0xD9, 0x2A, 0xFC, 0xA2, 0x9E, 0x3F, 0xFF,
+    0xD3, 0xFF, 0xFC, 0x92, 0x9E, 0x0F, 0xFA, 0x3A, 0xE1, 0xFD, 0x94, 0xAD, 0xA3, 0x99, 0x7E, 0xA7,
+    0x5E, 0x97, 0x49, 0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5F, 0x77, 0x76, 0x77, 0x71, 0x9A, 0xA9, 0x29,
+    0x99, 0x7F, 0xE9, 0x0E, 0x59, 0xFA, 0xAE, 0x9E, 0x5E, 0x93, 0xFC, 0xA4, 0xAD, 0x95, 0xFA, 0x4E,
+    0x6F, 0xA3, 0x9D, 0x96, 0xAE, 0x93, 0x9D, 0x96, 0xAE, 0x93, 0xAD, 0x7A, 0xE4, 0x9D, 0x7F, 0x49,
+    0xD9, 0x6F, 0x5D, 0xA5, 0xAF, 0x5A, 0xDA, 0x91, 0x9F, 0xD6, 0xFF, 0xFC, 0x6A, 0xFF, 0xF7, 0x9F,
+    0xE9, 0xAD, 0x71, 0xAE, 0xA1, 0xDA, 0x77, 0x0D, 0xA7, 0x70, 0xDA, 0x09, 0xD7, 0x4F, 0xE7, 0x4F,
+    0xDA, 0x74, 0xFA, 0x97, 0x49, 0xCA, 0x97, 0x77, 0x00, 0x1D, 0xA0, 0x9A, 0xD9, 0x1D, 0xAF, 0xC9,
+    0x1F, 0xFA, 0x1F, 0xCA, 0x9A, 0x90, 0x9F, 0x59, 0xE9, 0x59, 0xE6, 0x9E, 0x69, 0xE6, 0xAE, 0x6A,
+    0xE6, 0xF6, 0xF6, 0xF9, 0x49, 0xFA, 0x49, 0xFA, 0x40, 0x39, 0xAF, 0xCA, 0x94, 0xFF, 0xC9, 0x3A,
+    0xDA, 0x91, 0x99, 0x94, 0xD7, 0x4D, 0x74, 0xE9, 0x72, 0xAF, 0xA9, 0x70, 0xAF, 0xDA, 0x70, 0xAF,
+    0xDA, 0x71, 0x9A, 0xEA, 0x72, 0xAE, 0x3C, 0xA9, 0x29, 0xF2, 0xFF, 0xF1, 0xFF, 0xFA, 0x1F, 0xFF,
+    0x39, 0xAF, 0xDA, 0x92, 0x77, 0x19, 0xCA, 0x70, 0x9D, 0xA7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0A,
+    0xD9, 0x5F, 0xFE, 0x09, 0xFF, 0xE4, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE7, 0x1E, 0x71, 0xE7,
+    0x1E, 0x71, 0xE7, 0x09, 0xE7, 0x09, 0xE9, 0x79, 0xFE, 0xA3, 0x9F, 0xF3, 0x9F, 0xF4, 0xFF, 0x00,
+    0xAD, 0x96, 0xAD, 0x99, 0xD9, 0x6A, 0xD9, 0x9D, 0x96, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6,
+    0xAD, 0x90, 0xDA, 0x6E, 0x90, 0xE6, 0xEA, 0x0E, 0x6E, 0xA0, 0xE6, 0xEA, 0x0E, 0x6E, 0xA0, 0xEA,
+    0x4F, 0xA0, 0xAF, 0xFF, 0xA0, 0x9F, 0xFF, 0xA1, 0xFF, 0xFC, 0x1A, 0xFF, 0x9E, 0x29, 0xFC, 0xA0,
+    0x9E, 0x76, 0x9D, 0x97, 0x2D, 0xA0, 0xE7, 0x1A, 0xD1, 0x9D, 0xA7, 0x0D, 0xA2, 0xE7, 0xAD, 0x3A,
+    0xDA, 0x6E, 0x4E, 0x5A, 0xD9, 0x4A, 0xDA, 0x4E, 0x6E, 0x3A, 0xD9, 0x6A, 0xDA, 0x2E, 0x79, 0xE1,
+    0xAD, 0xA7, 0x0E, 0xA0, 0xE7, 0x19, 0xEA, 0xDA, 0x72, 0xFD, 0x97, 0x2F, 0xD9, 0x72, 0xAF, 0xC7,
+    0x3A, 0xFC, 0x50, 0x9E, 0x75, 0xAD, 0xA0, 0xE9, 0x74, 0xE9, 0x0E, 0xA7, 0x4E, 0x1A, 0xE7, 0x39,
+    0xE1, 0x9E, 0x49, 0x94, 0xAD, 0xA2, 0xE9, 0x29, 0xDA, 0x3E, 0x92, 0xEA, 0x2F, 0x92, 0xE3, 0xAE,
+    0x1F, 0xD1, 0x9E, 0x39, 0xE0, 0xAF, 0xE0, 0xAD, 0xA4, 0xEA, 0xFF, 0xAE, 0x94, 0xFF, 0xFF, 0x5A,
+    0xFE, 0xAF, 0xE5, 0x9F, 0xD9, 0x0F, 0xDA, 0x6F, 0xCA, 0x19, 0xFC, 0x96, 0xFC, 0x3F, 0xC7, 0xAE,
+    0x93, 0x9F, 0x30, 0x2E, 0x95, 0xAD, 0xA3, 0x9E, 0x4A, 0xE5, 0xEA, 0x29, 0xE7, 0xE9, 0x1E, 0x97,
+    0x9E, 0x9E, 0xA7, 0x1F, 0xDA, 0x73, 0xFC, 0x74, 0xAE, 0xA7, 0x39, 0xFC, 0x73, 0xFE, 0x71, 0xFA,
+    0xEA, 0x7F, 0x1F, 0x95, 0xAE, 0x92, 0xF4, 0x9E, 0xA3, 0xAE, 0xA2, 0x9F, 0x5F, 0x91, 0xF7, 0xF0,
+    0x9D, 0xA7, 0x0E, 0x0E, 0x79, 0xDA, 0x09, 0xDA, 0x6A, 0xD9, 0x1E, 0x95, 0xE2, 0x9E, 0x5E, 0x3E,
+    0x93, 0xAD, 0xA3, 0x9E, 0x3E, 0x94, 0xEA, 0x2E, 0x59, 0xE9, 0x09, 0xE6, 0xF0, 0xEA, 0x69, 0xEA,
+    0xEA, 0x7F, 0xE9, 0x79, 0xFD, 0x71, 0xFD, 0x71, 0x9F, 0xA7, 0x2F, 0x97, 0x2F, 0x72, 0x9F, 0x71,
+    0x9F, 0x97, 0x9A, 0xFC, 0x5A, 0xFF, 0x6A, 0xFE, 0x7A, 0xFC, 0xA7, 0x0A, 0xDA, 0x97, 0x10, 0x2F,
+    0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x97, 0x19, 0xEA, 0x71, 0x9E, 0xA7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7,
+    0x1A, 0xEA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFC, 0xAA, 0xAA, 0xAA, 0xA9,
+    0x2F, 0xFF, 0xC1, 0x9F, 0xFF, 0xC9, 0x09, 0xFF, 0xFD, 0x00, 0x59, 0xAF, 0x5F, 0xDA, 0x49, 0xE9,
+    0x7E, 0xA7, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x09, 0xE7, 0x9E, 0x95,
+    0xAF, 0xA6, 0xAE, 0x97, 0xAF, 0xA7, 0x09, 0xE7, 0x1E, 0x97, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A,
+    0xDA, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xEA, 0x70, 0xAE, 0x97, 0x9F, 0xD9, 0x5F, 0xDA, 0x69, 0xAE,
+    0xA1, 0x0A, 0xC1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD0, 0x9D, 0x09, 0xCA,
+    0x09, 0xCA, 0x09, 0xCA, 0x09, 0xCA, 0x09, 0xCA, 0x09, 0xCA, 0x09, 0xCA, 0x0A, 0xCA, 0x0A, 0xCA,
+    0x0A, 0xC9, 0x0A, 0xC9, 0x0A, 0xC9, 0x0A, 0xC9, 0x00, 0xAF, 0xA6, 0x9F, 0xD7, 0x09, 0xF7, 0x1E,
+    0x71, 0xE7, 0x1E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x1E,
+    0x97, 0x09, 0xFC, 0x70, 0xAE, 0x7F, 0xC6, 0xEA, 0x70, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7,
+    0x1E, 0x71, 0xE7, 0x0F, 0x5F, 0xE5, 0xFD, 0x6E, 0xAA, 0x50, 0x1A, 0xD3, 0xAC, 0x0A, 0xCA, 0xD2,
+    0xAC, 0x0D, 0x1D, 0x1C, 0xA0, 0xCA, 0x19, 0xF9, 0x0C, 0xA2, 0x9D, 0xA7, 0x30, 0xAF, 0xC0, 0x9F,
+    0xC0, 0x9F, 0xC1, 0xFA, 0x1F, 0xA1, 0xAE, 0x97, 0x70, 0x9A, 0xD2, 0xF2, 0xF2, 0xAE, 0x2A, 0xE2,
+    0xAE, 0x2A, 0xE2, 0x9E, 0x29, 0xE2, 0x9E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3A, 0xD3,
+    0xAD, 0x3A, 0xD4, 0xAC, 0x00, 0x69, 0x73, 0x9D, 0x72, 0x9C, 0xA7, 0x29, 0xCA, 0x72, 0x9C, 0xA7,
+    0x29, 0xCA, 0x70, 0x9A, 0xFC, 0x49, 0xFF, 0x4F, 0xDA, 0x9A, 0x3A, 0xE0, 0xAC, 0xA5, 0xE1, 0xAC,
+    0x94, 0x9E, 0x1A, 0xC9, 0x49, 0xDA, 0x1A, 0xC9, 0x49, 0xD9, 0x1A, 0xC9, 0x4A, 0xD9, 0x1A, 0xC9,
+    0x49, 0xE1, 0xAC, 0x94, 0x9E, 0x90, 0xAC, 0x95, 0xF9, 0xD9, 0x5A, 0xFD, 0xAA, 0xA4, 0xFF, 0xD4,
+    0xFF, 0xCA, 0x5A, 0xFC, 0xA9, 0x6D, 0x73, 0xD7, 0x3D, 0x50, 0x77, 0x77, 0x73, 0x99, 0x97, 0x3A,
+    0xFE, 0x96, 0x9F, 0xFE, 0x49, 0xFA, 0x29, 0xAE, 0x3E, 0xA7, 0xA4, 0xE7, 0x6A, 0xD7, 0x69, 0xD7,
+    0x7D, 0x97, 0x6D, 0xA7, 0x69, 0xD7, 0x7D, 0x97, 0x6E, 0x76, 0xAD, 0x73, 0x9A, 0xAF, 0xAA, 0xAA,
+    0xAA, 0x93, 0x9F, 0xFF, 0xA3, 0x9F, 0xFF, 0xA7, 0xAD, 0xA7, 0x5A, 0xDA, 0x75, 0xEA, 0x74, 0xF7,
+    0x3A, 0xF9, 0x71, 0xAF, 0xA9, 0x72, 0xAF, 0xFF, 0xAA, 0x91, 0xAF, 0xFF, 0xF0, 0xAF, 0xFF, 0xF9,
+    0x77, 0x1A, 0xC6, 0xAC, 0x92, 0xAE, 0xAE, 0xAA, 0xE9, 0x19, 0xFF, 0xF3, 0x9E, 0x91, 0xAE, 0x4A,
+    0xD4, 0xAD, 0x4E, 0x49, 0xD9, 0x3E, 0x49, 0xDA, 0x3E, 0x4A, 0xD9, 0x3A, 0xE9, 0x1A, 0xE9, 0x3A,
+    0xFF, 0xD9, 0x2A, 0xFF, 0xF9, 0x09, 0xFF, 0xFD, 0x1A, 0xD1, 0x99, 0x91, 0x9D, 0x92, 0xA7, 0x09,
+    0x91, 0x09, 0x97, 0x39, 0x99, 0x0E, 0x71, 0xE9, 0x09, 0xE7, 0xEA, 0x2A, 0xE5, 0xAE, 0x4F, 0x3A,
+    0xE5, 0x9F, 0x1A, 0xE9, 0x6A, 0xFA, 0xEA, 0x70, 0xFF, 0x72, 0xFD, 0x73, 0x9F, 0x97, 0x4F, 0x75,
+    0xFE, 0xA5, 0xFF, 0xF4, 0xAF, 0xF9, 0x97, 0x3F, 0x75, 0xF7, 0x5F, 0x75, 0xF1, 0x96, 0xFF, 0xEA,
+    0x4A, 0xFF, 0xF7, 0x1E, 0xA7, 0x5E, 0xA7, 0x5E, 0xA7, 0x5E, 0xA6, 0x0A, 0xC1, 0xD1, 0xD1, 0xD1,
+    0xD1, 0xD1, 0xD1, 0xD1, 0xD7, 0x75, 0xCA, 0x09, 0xCA, 0x09, 0xCA, 0x09, 0xCA, 0x09, 0xCA, 0x0A,
+    0xCA, 0x0A, 0xCA, 0x0A, 0xC9, 0x0A, 0xC9, 0x0A, 0xC9, 0x0A, 0xC9, 0x00, 0x59, 0xAE, 0xA9, 0x7A,
+    0xFF, 0x59, 0xD4, 0x9D, 0x4D, 0x69, 0xA4, 0xCA, 0x75, 0xD7, 0x5A, 0xDA, 0x74, 0xFC, 0xA9, 0x7A,
+    0xFF, 0xA4, 0xFF, 0xF2, 0x9E, 0x94, 0xAD, 0xA1, 0xAD, 0x7E, 0x1D, 0xA7, 0xE1, 0xAD, 0x96, 0xE1,
+    0x9F, 0xCA, 0xA9, 0xAE, 0xA2, 0xAF, 0xFE, 0x93, 0x9A, 0xFF, 0x97, 0x09, 0xFC, 0x73, 0xAF, 0x73,
+    0xF3, 0x95, 0xAF, 0x2F, 0xFF, 0xC1, 0xAF, 0xFF, 0x91, 0xFF, 0xF9, 0x29, 0xAF, 0xEA, 0x97, 0x73,
+    0x09, 0xD9, 0x3A, 0xD9, 0x1E, 0xA3, 0xEA, 0x1F, 0x3F, 0x1F, 0x29, 0xF0, 0x9F, 0x2A, 0xF0, 0x29,
+    0xAD, 0xA5, 0xCA, 0x29, 0xCA, 0x2A, 0x90, 0xAD, 0x1A, 0x90, 0x9A, 0x0A, 0xA4, 0xC0, 0xA9, 0x0C,
+    0x5C, 0x0A, 0x90, 0xC5, 0xA9, 0x9A, 0x0D, 0x4C, 0x1C, 0x1E, 0xA0, 0x9C, 0x1A, 0xA2, 0x91, 0xC3,
+    0xAC, 0x91, 0x9C, 0x94, 0x9A, 0xDA, 0x30, 0x74, 0xAD, 0xAA, 0x92, 0xAC, 0x99, 0xDA, 0x2C, 0x92,
+    0xCA, 0x19, 0xC3, 0xCA, 0x19, 0xA3, 0xD1, 0xAC, 0x3D, 0x19, 0xCA, 0x99, 0xE2, 0xFE, 0x3A, 0xDA,
+    0x0C, 0x00, 0x6A, 0x74, 0xD3, 0x9C, 0x94, 0xDA, 0x2A, 0xD9, 0x29, 0xDA, 0x2A, 0xD9, 0x2A, 0xDA,
+    0x2E, 0x92, 0xAD, 0x92, 0xE3, 0x9D, 0xA2, 0xE4, 0x9E, 0x91, 0xF4, 0xAE, 0xA1, 0xF4, 0xAE, 0xA1,
+    0xF4, 0x9E, 0x91, 0xF4, 0x9D, 0x3E, 0x59, 0xC4, 0xCA, 0x77, 0xAD, 0xAA, 0xA9, 0x99, 0x4A, 0xFF,
+    0xF0, 0x9A, 0xAF, 0xFD, 0x72, 0xAD, 0x97, 0x1A, 0xD9, 0x71, 0xAD, 0x97, 0x1A, 0xD9, 0x71, 0xAD,
+    0x97, 0x29, 0x90, 0xAF, 0xFF, 0x0A, 0xFF, 0xF0, 0xAF, 0xFF, 0x00, 0x29, 0xAD, 0xA5, 0xCA, 0x29,
+    0xCA, 0x2A, 0x90, 0xE9, 0x0C, 0x91, 0xC1, 0xA1, 0xC1, 0xC0, 0x99, 0x1A, 0x09, 0xC1, 0xC0, 0xA9,
+    0x1E, 0x91, 0xA9, 0x99, 0x09, 0xC9, 0xAA, 0x1C, 0x09, 0xC0, 0x9C, 0x1C, 0x1C, 0x1A, 0xA9, 0xC1,
+    0xC9, 0xC9, 0x2D, 0xA1, 0xAC, 0xA4, 0x9A, 0xDA, 0x30, 0x73, 0xFF, 0xC9, 0x9A, 0xAA, 0xAA, 0xAA,
+    0x99, 0x00, 0x77, 0x1A, 0xF9, 0x59, 0xFF, 0x4E, 0x91, 0x9E, 0x2E, 0x5D, 0x91, 0xDA, 0x5A, 0xD0,
+    0x9D, 0xA5, 0xAD, 0x09, 0xDA, 0x5A, 0xD1, 0xE5, 0xE1, 0xF9, 0x19, 0xEA, 0x2F, 0xFD, 0x39, 0xFF,
+    0x6F, 0xCA, 0x77, 0x10, 0x69, 0x73, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x49, 0xAA, 0xAA,
+    0xAE, 0xAA, 0xAA, 0xAA, 0xFF, 0xFA, 0x5D, 0xA7, 0x2D, 0xA7, 0x2D, 0xA7, 0x2D, 0xA7, 0x29, 0xA9,
+    0x77, 0x77, 0x19, 0x99, 0xAA, 0xAA, 0xAE, 0xA1, 0xFF, 0xF1, 0x99, 0x99, 0x97, 0x69, 0xF1, 0xA9,
+    0x1A, 0xC5, 0xC5, 0xC4, 0xD3, 0xAC, 0x92, 0xDA, 0x2D, 0xA2, 0xAF, 0xC9, 0xFD, 0x90, 0x0A, 0xE9,
+    0x6A, 0xA6, 0xC5, 0xAA, 0x2E, 0xA5, 0x9C, 0xA5, 0xAC, 0x59, 0xC1, 0x91, 0x9D, 0x0A, 0xFC, 0x90,
+    0x9F, 0x91, 0x29, 0xA9, 0x2D, 0x29, 0xD2, 0xD9, 0x19, 0xD2, 0xE1, 0x0E, 0x96, 0xAD, 0x90, 0xE9,
+    0x6A, 0xD9, 0x0E, 0x96, 0xAD, 0x90, 0xEA, 0x6A, 0xD9, 0x0E, 0xA6, 0xAD, 0x99, 0xEA, 0x6E, 0x99,
+    0xF6, 0xEA, 0x9F, 0x6E, 0xA9, 0xF6, 0xEA, 0x9F, 0x6E, 0xA9, 0xFA, 0x4F, 0xAA, 0xFF, 0xFD, 0xAA,
+    0xFF, 0xFD, 0xAA, 0xCA, 0xFF, 0xFC, 0xAC, 0x9A, 0xFF, 0x9E, 0xAC, 0x90, 0x9F, 0xCA, 0x09, 0xEA,
+    0xC9, 0x74, 0xD9, 0x74, 0xAA, 0x75, 0x39, 0x99, 0x39, 0x92, 0x9F, 0x92, 0xD1, 0x9F, 0xC9, 0x2D,
+    0x1F, 0xD3, 0xD0, 0x9F, 0xD3, 0xD0, 0xAF, 0xD3, 0xD0, 0xAF, 0xD3, 0xD9, 0x9F, 0xD3, 0xD9, 0x0F,
+    0xD3, 0xD9, 0x1F, 0xC3, 0xD9, 0x2E, 0xA3, 0xD9, 0x2E, 0xA3, 0xD9, 0x2E, 0xA3, 0xD9, 0x19, 0xE9,
+    0x3D, 0x91, 0xAE, 0x93, 0xD9, 0x1F, 0x93, 0xD9, 0x1F, 0x93, 0xD9, 0x1F, 0x4D, 0x90, 0x9F, 0x4A,
+    0xC9, 0x0A, 0xF4, 0xAC, 0xA0, 0xFC, 0x4A, 0xCA, 0x0F, 0xC4, 0xAC, 0xA0, 0xFC, 0x4A, 0xCA, 0x9F,
+    0xC4, 0xAC, 0xA0, 0x0A, 0xDA, 0x1F, 0x1F, 0x09, 0xF0, 0x9F, 0x00, 0x09, 0x4C, 0x39, 0xA3, 0xAE,
+    0x94, 0xC9, 0x3C, 0x99, 0xAA, 0xD0, 0xEA, 0x10, 0x19, 0x93, 0xE3, 0x9A, 0xC4, 0xAC, 0x4A, 0xC4,
+    0xAC, 0x4D, 0x4D, 0x4D, 0x2F, 0xD0, 0xFD, 0x00, 0x39, 0x5F, 0xA2, 0xCA, 0x2C, 0xA0, 0x9C, 0x39,
+    0xC0, 0xAC, 0x4C, 0x99, 0xC3, 0x9C, 0x1C, 0xA9, 0x99, 0xD1, 0xAF, 0xC9, 0x2A, 0xE9, 0x10, 0x95,
+    0x96, 0xAC, 0x4C, 0xA5, 0xAD, 0x3E, 0x5A, 0xD9, 0x2E, 0x5A, 0xDA, 0x2E, 0x94, 0x9D, 0xA2, 0xAD,
+    0x94, 0x9D, 0x92, 0xE3, 0x9E, 0xA1, 0xF2, 0x9F, 0x1F, 0x91, 0x9E, 0xA1, 0xF3, 0xEA, 0x1A, 0xE4,
+    0xDA, 0x2A, 0xD5, 0xCA, 0x39, 0xC6, 0x97, 0x40, 0x77, 0x71, 0xAD, 0x77, 0x3F, 0x77, 0x39, 0x0D,
+    0x77, 0x5D, 0x73, 0xD7, 0xD7, 0x2A, 0xC9, 0x7D, 0x71, 0x9C, 0xA7, 0x0D, 0x71, 0xD7, 0x1D, 0x70,
+    0xAC, 0xA7, 0x1D, 0x70, 0xD7, 0x2D, 0x7A, 0xC9, 0x71, 0x9D, 0x69, 0xD7, 0x0A, 0xAE, 0xAA, 0xA3,
+    0xD9, 0x70, 0xFF, 0x2A, 0xD5, 0x92, 0xFF, 0x2D, 0x5A, 0xC7, 0x4D, 0xA4, 0x9D, 0x73, 0x9D, 0x5E,
+    0x73, 0xDA, 0x4A, 0xCA, 0xC9, 0x71, 0xAD, 0x49, 0xCA, 0x9C, 0x97, 0x1D, 0x94, 0xD0, 0x9C, 0x97,
+    0x0E, 0x4D, 0x90, 0x9C, 0xA7, 0x9D, 0x93, 0xAC, 0xA1, 0x9C, 0xA7, 0xDA, 0x4F, 0xFC, 0xA4, 0xAD,
+    0x5F, 0xFC, 0xA4, 0xDA, 0x72, 0xAD, 0x5E, 0x73, 0xAD, 0x49, 0xD9, 0x73, 0xE4, 0x99, 0x97, 0x4E,
+    0x10, 0x1A, 0xD7, 0x74, 0xF7, 0x74, 0xA0, 0xD7, 0x76, 0xD7, 0x3D, 0x70, 0xD7, 0x2A, 0xC9, 0x70,
+    0xD7, 0x19, 0xCA, 0x71, 0xD7, 0x1D, 0x72, 0xD7, 0x0A, 0xCA, 0x72, 0xD7, 0x0D, 0x73, 0xD7, 0xAC,
+    0x97, 0x29, 0xD6, 0x9D, 0x71, 0xAA, 0xEA, 0xAA, 0x3D, 0x91, 0x9A, 0xA9, 0x3F, 0xF2, 0xAD, 0x0A,
+    0xFD, 0xA1, 0xFF, 0x2D, 0x1A, 0xA9, 0x19, 0xDA, 0x72, 0xDA, 0x70, 0xD7, 0x19, 0xD7, 0x1D, 0x71,
+    0xD9, 0x71, 0xD7, 0x0A, 0xD7, 0x1A, 0xD7, 0x0D, 0x97, 0x09, 0xD9, 0x7E, 0x70, 0x9D, 0xA7, 0x9D,
+    0x70, 0xAE, 0x70, 0xDA, 0x69, 0xF7, 0x0A, 0xD7, 0xF7, 0x09, 0xDA, 0x6A, 0xFF, 0x4E, 0x7F, 0xFC,
+    0x3A, 0xD9, 0x7A, 0xFF, 0x39, 0x99, 0x77, 0x20, 0x1A, 0xF9, 0x77, 0x2A, 0xA9, 0x99, 0xAD, 0x77,
+    0x70, 0xC9, 0x77, 0x7A, 0xA7, 0x0D, 0x74, 0xCA, 0x7A, 0xC9, 0x73, 0xAC, 0x70, 0xD7, 0x0F, 0xC9,
+    0x7D, 0x71, 0xAA, 0xAD, 0xA6, 0x9C, 0xA7, 0x5A, 0xCA, 0x5D, 0x77, 0xD4, 0xAC, 0x97, 0x7D, 0x39,
+    0xD7, 0x7A, 0xD3, 0xD9, 0x71, 0xAF, 0xE9, 0x2A, 0xD5, 0x93, 0xFE, 0xA3, 0xD5, 0xAC, 0x39, 0xAD,
+    0xAA, 0x93, 0xAC, 0xA4, 0x9D, 0x75, 0x9D, 0x5E, 0x75, 0xDA, 0x4A, 0xCA, 0xC9, 0x73, 0xAD, 0x49,
+    0xCA, 0x9C, 0x97, 0x3D, 0x94, 0xD0, 0x9C, 0x97, 0x2E, 0x4D, 0x90, 0x9C, 0xA7, 0x19, 0xD9, 0x3A,
+    0xCA, 0x19, 0xCA, 0x71, 0xDA, 0x4F, 0xFC, 0xA6, 0xAD, 0x5F, 0xFC, 0xA6, 0xDA, 0x72, 0xAD, 0x7E,
+    0x73, 0xAD, 0x69, 0xD9, 0x73, 0xE6, 0x99, 0x97, 0x4E, 0x10, 0x6F, 0x97, 0x2F, 0x97, 0x2F, 0x73,
+    0xAE, 0x73, 0x9D, 0xA7, 0x77, 0x77, 0x59, 0x97, 0x3A, 0xE7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7,
+    0x3F, 0x71, 0x9F, 0xC7, 0x09, 0xFC, 0x97, 0x0F, 0x97, 0x1F, 0x72, 0x9E, 0x73, 0xE9, 0x72, 0x9E,
+    0x73, 0xEA, 0x73, 0xE9, 0x73, 0xE9, 0x73, 0xE9, 0x73, 0xAD, 0xA7, 0x39, 0xE9, 0x69, 0xA2, 0xFA,
+    0x49, 0xDA, 0x2F, 0xDA, 0xAF, 0x4F, 0xFD, 0x69, 0xAF, 0xA9, 0x77, 0x20, 0x5A, 0xD9, 0x77, 0x3A,
+    0xDA, 0x77, 0x3A, 0xE7, 0x73, 0xAE, 0x97, 0x75, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0xE9, 0x77,
+    0x1A, 0xEA, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xC9, 0x77, 0xAD, 0xAE, 0x77, 0xE0, 0xE7, 0x69, 0xDA,
+    0x0A, 0xDA, 0x75, 0xE9, 0x09, 0xE7, 0x5E, 0x2E, 0x97, 0x3A, 0xDA, 0x2A, 0xDA, 0x73, 0xE9, 0x29,
+    0xE7, 0x29, 0xE4, 0xE9, 0x71, 0xAD, 0xA4, 0xAE, 0x71, 0xE9, 0x49, 0xE7, 0x09, 0xE6, 0xEA, 0x7E,
+    0xA6, 0xAE, 0x7E, 0x97, 0xE9, 0x5A, 0xFF, 0xFF, 0x5F, 0xFF, 0xFC, 0x49, 0xFF, 0xFF, 0xCA, 0x3F,
+    0xFF, 0xFE, 0x3F, 0x72, 0xF9, 0x1A, 0xEA, 0x72, 0xAE, 0xA1, 0xF9, 0x72, 0x9F, 0x09, 0xF7, 0x4F,
+    0x90, 0x73, 0xAC, 0x97, 0x73, 0xD7, 0x73, 0xAD, 0x77, 0x3D, 0x97, 0x72, 0xAD, 0x77, 0x3A, 0xAA,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4E, 0x97, 0x71, 0xAE, 0xA7,
+    0x71, 0xFC, 0x77, 0x09, 0xFC, 0x97, 0x7A, 0xDA, 0xE7, 0x7E, 0x0E, 0x76, 0x9D, 0xA0, 0xAD, 0xA7,
+    0x5E, 0x90, 0x9E, 0x75, 0xE2, 0xE9, 0x73, 0xAD, 0xA2, 0xAD, 0xA7, 0x3E, 0x92, 0x9E, 0x72, 0x9E,
+    0x4E, 0x97, 0x1A, 0xDA, 0x4A, 0xE7, 0x1E, 0x94, 0x9E, 0x70, 0x9E, 0x6E, 0xA7, 0xEA, 0x6A, 0xE7,
+    0xE9, 0x7E, 0x95, 0xAF, 0xFF, 0xF5, 0xFF, 0xFF, 0xC4, 0x9F, 0xFF, 0xFC, 0xA3, 0xFF, 0xFF, 0xE3,
+    0xF7, 0x2F, 0x91, 0xAE, 0xA7, 0x2A, 0xEA, 0x1F, 0x97, 0x29, 0xF0, 0x9F, 0x74, 0xF9, 0x71, 0xAC,
+    0x97, 0x72, 0x9E, 0x77, 0x2F, 0xA7, 0x70, 0xD9, 0x0A, 0xCA, 0x76, 0xD3, 0x9C, 0xA7, 0x4A, 0xA6,
+    0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4E, 0x97, 0x71, 0xAE, 0xA7, 0x71, 0xFC, 0x77, 0x09, 0xFC,
+    0x97, 0x7A, 0xDA, 0xE7, 0x7E, 0x0E, 0x76, 0x9D, 0xA0, 0xAD, 0xA7, 0x5E, 0x90, 0x9E, 0x75, 0xE2,
+    0xE9, 0x73, 0xAD, 0xA2, 0xAD, 0xA7, 0x3E, 0x92, 0x9E, 0x72, 0x9E, 0x4E, 0x97, 0x1A, 0xDA, 0x4A,
+    0xE7, 0x1E, 0x94, 0x9E, 0x70, 0x9E, 0x6E, 0xA7, 0xEA, 0x6A, 0xE7, 0xE9, 0x7E, 0x95, 0xAF, 0xFF,
+    0xF5, 0xFF, 0xFF, 0xC4, 0x9F, 0xFF, 0xFC, 0xA3, 0xFF, 0xFF, 0xE3, 0xF7, 0x2F, 0x91, 0xAE, 0xA7,
+    0x2A, 0xEA, 0x1F, 0x97, 0x29, 0xF0, 0x9F, 0x74, 0xF9, 0x7D, 0xA3, 0xCA, 0x74, 0xDA, 0xCA, 0x2C,
+    0xA7, 0x4C, 0xA0, 0x9C, 0xA1, 0xC9, 0x73, 0x9C, 0x91, 0xAF, 0x74, 0x9C, 0x92, 0xAD, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x75, 0xE9, 0x77, 0x1A, 0xEA, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xC9, 0x77, 0xAD,
+    0xAE, 0x77, 0xE0, 0xE7, 0x69, 0xDA, 0x0A, 0xDA, 0x75, 0xE9, 0x09, 0xE7, 0x5E, 0x2E, 0x97, 0x3A,
+    0xDA, 0x2A, 0xDA, 0x73, 0xE9, 0x29, 0xE7, 0x29, 0xE4, 0xE9, 0x71, 0xAD, 0xA4, 0xAE, 0x71, 0xE9,
+    0x49, 0xE7, 0x09, 0xE6, 0xEA, 0x7E, 0xA6, 0xAE, 0x7E, 0x97, 0xE9, 0x5A, 0xFF, 0xFF, 0x5F, 0xFF,
+    0xFC, 0x49, 0xFF, 0xFF, 0xCA, 0x3F, 0xFF, 0xFE, 0x3F, 0x72, 0xF9, 0x1A, 0xEA, 0x72, 0xAE, 0xA1,
+    0xF9, 0x72, 0x9F, 0x09, 0xF7, 0x4F, 0x90, 0x5E, 0x93, 0xE9, 0x72, 0xEA, 0x3E, 0xA7, 0x2F, 0x29,
+    0xEA, 0x71, 0x9F, 0x2A, 0xF7, 0x19, 0xF2, 0xAF, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3E, 0x97, 0x71,
+    0xAE, 0xA7, 0x71, 0xFC, 0x77, 0x09, 0xFC, 0x97, 0x7A, 0xDA, 0xE7, 0x7E, 0x0E, 0x76, 0x9D, 0xA0,
+    0xAD, 0xA7, 0x5E, 0x90, 0x9E, 0x75, 0xE2, 0xE9, 0x73, 0xAD, 0xA2, 0xAD, 0xA7, 0x3E, 0x92, 0x9E,
+    0x72, 0x9E, 0x4E, 0x97, 0x1A, 0xDA, 0x4A, 0xE7, 0x1E, 0x94, 0x9E, 0x70, 0x9E, 0x6E, 0xA7, 0xEA,
+    0x6A, 0xE7, 0xE9, 0x7E, 0x95, 0xAF, 0xFF, 0xF5, 0xFF, 0xFF, 0xC4, 0x9F, 0xFF, 0xFC, 0xA3, 0xFF,
+    0xFF, 0xE3, 0xF7, 0x2F, 0x91, 0xAE, 0xA7, 0x2A, 0xEA, 0x1F, 0x97, 0x29, 0xF0, 0x9F, 0x74, 0xF9,
+    0x71, 0xAD, 0x77, 0x2C, 0x90, 0x9C, 0x77, 0x09, 0xC2, 0xC9, 0x77, 0x9C, 0x91, 0xC9, 0x77, 0x0F,
+    0xC7, 0x72, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7E, 0x97, 0x71, 0xAE, 0xA7, 0x71,
+    0xFC, 0x77, 0x09, 0xFC, 0x97, 0x7A, 0xDA, 0xE7, 0x7E, 0x0E, 0x76, 0x9D, 0xA0, 0xAD, 0xA7, 0x5E,
+    0x90, 0x9E, 0x75, 0xE2, 0xE9, 0x73, 0xAD, 0xA2, 0xAD, 0xA7, 0x3E, 0x92, 0x9E, 0x72, 0x9E, 0x4E,
+    0x97, 0x1A, 0xDA, 0x4A, 0xE7, 0x1E, 0x94, 0x9E, 0x70, 0x9E, 0x6E, 0xA7, 0xEA, 0x6A, 0xE7, 0xE9,
+    0x7E, 0x95, 0xAF, 0xFF, 0xF5, 0xFF, 0xFF, 0xC4, 0x9F, 0xFF, 0xFC, 0xA3, 0xFF, 0xFF, 0xE3, 0xF7,
+    0x2F, 0x91, 0xAE, 0xA7, 0x2A, 0xEA, 0x1F, 0x97, 0x29, 0xF0, 0x9F, 0x74, 0xF9, 0x77, 0x72, 0x99,
+    0x99, 0x75, 0xAF, 0xFF, 0xFC, 0x75, 0xFF, 0xFF, 0xD7, 0x4A, 0xFF, 0xFF, 0xC9, 0x73, 0x9F, 0xF9,
+    0x77, 0x5E, 0xAF, 0xA7, 0x75, 0x9E, 0x0F, 0xA7, 0x75, 0xE1, 0xFA, 0x77, 0x49, 0xDA, 0x1F, 0xA7,
+    0x74, 0xE2, 0xAE, 0xA7, 0x73, 0xAD, 0xA2, 0x9F, 0x99, 0x99, 0x9A, 0xAA, 0x73, 0xE4, 0xFF, 0xF7,
+    0x2A, 0xDA, 0x4F, 0xFF, 0x72, 0xE5, 0xFF, 0xEA, 0x71, 0xAD, 0xA5, 0xF9, 0x77, 0x9E, 0x6F, 0x77,
+    0x0E, 0xA6, 0xF9, 0x76, 0x9F, 0xAA, 0xAA, 0xAA, 0xAF, 0xA7, 0x6F, 0xFF, 0xFC, 0x75, 0x9F, 0xFF,
+    0xFC, 0x75, 0xFF, 0xFF, 0xFF, 0xF2, 0xAE, 0xA7, 0x0F, 0xFF, 0xE2, 0xF7, 0x1F, 0xFF, 0xE1, 0xAE,
+    0xA7, 0x1F, 0xFF, 0xE9, 0x0F, 0x72, 0xFF, 0xFE, 0xA7, 0x77, 0x70, 0x77, 0x76, 0x9A, 0xFC, 0xA9,
+    0x79, 0xAF, 0xFC, 0xA6, 0xAF, 0xFE, 0x95, 0xFD, 0x99, 0x99, 0x9A, 0xA5, 0xFC, 0x97, 0x4F, 0xC7,
+    0x59, 0xF7, 0x6F, 0x76, 0x9E, 0xA7, 0x6A, 0xE7, 0x7F, 0x77, 0xEA, 0x76, 0x9E, 0xA7, 0x69, 0xEA,
+    0x76, 0x9F, 0x76, 0x9F, 0x97, 0x59, 0xFC, 0x76, 0xFD, 0x97, 0x19, 0x1F, 0xFA, 0xA9, 0x99, 0x9A,
+    0xDA, 0x1A, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xA2, 0x9F, 0xFF, 0xEA, 0x3A, 0xFF, 0xFD, 0xA4, 0xAF,
+    0xFF, 0xCA, 0x6A, 0xFF, 0xCA, 0x97, 0x4A, 0x97, 0x71, 0xC7, 0x71, 0x9E, 0xA7, 0x72, 0xAA, 0x77,
+    0x1A, 0xC7, 0x59, 0xAA, 0xD9, 0x75, 0xAE, 0x93, 0x29, 0xD9, 0x75, 0x9D, 0xA7, 0x59, 0xE9, 0x74,
+    0x9E, 0xA7, 0x79, 0x77, 0x77, 0x77, 0x29, 0x99, 0x99, 0x1A, 0xFF, 0xFC, 0xA1, 0xAF, 0xFF, 0xCA,
+    0x1F, 0xFF, 0xCA, 0x2E, 0xA9, 0x73, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x74,
+    0xEA, 0x99, 0x99, 0xAA, 0xA9, 0x4F, 0xFE, 0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x94, 0xEA, 0x74, 0xE9,
+    0x74, 0xE9, 0x74, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9F, 0xFF, 0xD9, 0x09, 0xFF, 0xFD,
+    0xA0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x71, 0xAA, 0x75, 0xAC, 0x97, 0x5D,
+    0x75, 0xAC, 0xA7, 0x5D, 0x97, 0x4A, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09,
+    0x99, 0x99, 0x1A, 0xFF, 0xFC, 0xA1, 0xAF, 0xFF, 0xCA, 0x1F, 0xFF, 0xCA, 0x2E, 0xA9, 0x73, 0xE9,
+    0x74, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xEA, 0x99, 0x99, 0xAA, 0xA9, 0x4F, 0xFE,
+    0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x94, 0xEA, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x73, 0x9E, 0x97,
+    0x39, 0xE9, 0x73, 0x9F, 0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0xA0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0,
+    0x9F, 0xFF, 0xE9, 0x69, 0xC9, 0x75, 0xE7, 0x4F, 0xC7, 0x2D, 0xA0, 0xAD, 0x70, 0xD9, 0x29, 0xD6,
+    0xAA, 0x6A, 0xA7, 0x77, 0x77, 0x79, 0x99, 0x99, 0x1A, 0xFF, 0xFC, 0xA1, 0xAF, 0xFF, 0xCA, 0x1F,
+    0xFF, 0xCA, 0x2E, 0xA9, 0x73, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xEA,
+    0x99, 0x99, 0xAA, 0xA9, 0x4F, 0xFE, 0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x94, 0xEA, 0x74, 0xE9, 0x74,
+    0xE9, 0x74, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9F, 0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0xA0,
+    0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x29, 0xDA, 0x39, 0xD9, 0x4A, 0xE3, 0xEA,
+    0x4F, 0x3F, 0x4F, 0x3F, 0x39, 0xF9, 0x19, 0xF7, 0x77, 0x77, 0x77, 0x79, 0x99, 0x99, 0x1A, 0xFF,
+    0xFC, 0xA1, 0xAF, 0xFF, 0xCA, 0x1F, 0xFF, 0xCA, 0x2E, 0xA9, 0x73, 0xE9, 0x74, 0xE9, 0x74, 0xE9,
+    0x74, 0xE9, 0x74, 0xE9, 0x74, 0xEA, 0x99, 0x99, 0xAA, 0xA9, 0x4F, 0xFE, 0x94, 0xFF, 0xE9, 0x4F,
+    0xFE, 0x94, 0xEA, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9F,
+    0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0xA0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x72,
+    0xE7, 0xE9, 0x6A, 0xDA, 0x6A, 0xE9, 0x77, 0x77, 0x77, 0x6A, 0xAA, 0xA9, 0x4A, 0xE9, 0x4A, 0xE9,
+    0x4A, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9,
+    0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xEA, 0x49, 0xEA, 0x49, 0xEA, 0x49, 0xEA, 0x49, 0xF4,
+    0xAF, 0x4A, 0xF4, 0xAF, 0x4F, 0xC4, 0xFC, 0x4F, 0xC0, 0x2A, 0xA2, 0x9D, 0x2D, 0x91, 0x9D, 0x2E,
+    0x19, 0xD9, 0x77, 0x77, 0x77, 0x7A, 0xE9, 0x0A, 0xE9, 0x0A, 0xE9, 0x0A, 0xE9, 0x09, 0xE9, 0x09,
+    0xE9, 0x09, 0xE9, 0x09, 0xE9, 0x09, 0xE9, 0x09, 0xE9, 0x09, 0xE9, 0x09, 0xE9, 0x09, 0xE9, 0x09,
+    0xE9, 0x09, 0xEA, 0x09, 0xEA, 0x09, 0xEA, 0x09, 0xEA, 0x09, 0xF0, 0xAF, 0x0A, 0xF0, 0xAF, 0x0F,
+    0xC0, 0xFC, 0x0F, 0xC0, 0x77, 0x0D, 0x70, 0xEA, 0x6A, 0xFA, 0x4A, 0xCA, 0x1D, 0xA2, 0xAC, 0x93,
+    0xAC, 0xA0, 0x9A, 0x7A, 0x77, 0x77, 0x77, 0x4A, 0xAA, 0xA9, 0x6A, 0xE9, 0x6A, 0xE9, 0x6A, 0xE9,
+    0x69, 0xE9, 0x69, 0xE9, 0x69, 0xE9, 0x69, 0xE9, 0x69, 0xE9, 0x69, 0xE9, 0x69, 0xE9, 0x69, 0xE9,
+    0x69, 0xE9, 0x69, 0xE9, 0x69, 0xEA, 0x69, 0xEA, 0x69, 0xEA, 0x69, 0xEA, 0x69, 0xF6, 0xAF, 0x6A,
+    0xF6, 0xAF, 0x6F, 0xC6, 0xFC, 0x6F, 0xC2, 0x1E, 0x4E, 0x19, 0xE3, 0x9E, 0x1A, 0xE9, 0x2A, 0xE9,
+    0x0F, 0x92, 0xF9, 0x0F, 0xA2, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x72, 0xAA, 0xAA, 0x97, 0x0A, 0xE9,
+    0x70, 0xAE, 0x97, 0x0A, 0xE9, 0x70, 0x9E, 0x97, 0x09, 0xE9, 0x70, 0x9E, 0x97, 0x09, 0xE9, 0x70,
+    0x9E, 0x97, 0x09, 0xE9, 0x70, 0x9E, 0x97, 0x09, 0xE9, 0x70, 0x9E, 0x97, 0x09, 0xE9, 0x70, 0x9E,
+    0xA7, 0x09, 0xEA, 0x70, 0x9E, 0xA7, 0x09, 0xEA, 0x70, 0x9F, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF,
+    0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x30, 0x39, 0xFF, 0xAA, 0x97, 0x69, 0xFF, 0xFA, 0x74, 0x9F,
+    0xFF, 0xDA, 0x72, 0x9F, 0xFF, 0xEA, 0x71, 0x9E, 0x59, 0xAF, 0xCA, 0x70, 0x9E, 0x70, 0xAF, 0x97,
+    0x9E, 0x71, 0x9F, 0x79, 0xE7, 0x2A, 0xEA, 0x69, 0xE7, 0x3F, 0x69, 0xE7, 0x3F, 0x95, 0x9E, 0x73,
+    0xAE, 0xA1, 0xAF, 0xFF, 0x95, 0x9F, 0x1A, 0xFF, 0xF9, 0x6F, 0x1A, 0xFF, 0xF9, 0x6F, 0x59, 0xE7,
+    0x4F, 0x59, 0xE7, 0x39, 0xF5, 0x9E, 0x73, 0xFC, 0x59, 0xE7, 0x19, 0xFD, 0x59, 0xE9, 0x99, 0x99,
+    0x99, 0xAA, 0xFE, 0xA5, 0x9F, 0xFF, 0xFE, 0x69, 0xFF, 0xFF, 0xDA, 0x69, 0xFF, 0xFF, 0xCA, 0x79,
+    0xFF, 0xFF, 0xA7, 0x09, 0xFF, 0xFD, 0xA7, 0x29, 0xFF, 0xDA, 0xA9, 0x70, 0x79, 0x97, 0x71, 0xAE,
+    0x92, 0xCA, 0x72, 0xD0, 0xAC, 0x2C, 0x97, 0x19, 0xC9, 0x1D, 0x09, 0xC9, 0x71, 0x9C, 0x91, 0x9F,
+    0x72, 0x9C, 0x93, 0xAA, 0x77, 0x77, 0x73, 0x9A, 0xA9, 0x29, 0x99, 0x72, 0xF1, 0xAF, 0x71, 0xF1,
+    0xAF, 0x97, 0x0E, 0xA1, 0xFD, 0x70, 0xEA, 0x1F, 0xD9, 0x7E, 0xA1, 0xFE, 0x69, 0xEA, 0x1F, 0xE9,
+    0x59, 0xE9, 0x1E, 0xAF, 0x59, 0xE9, 0x1E, 0xAA, 0xE9, 0x4A, 0xE9, 0x09, 0xEA, 0x0F, 0x4A, 0xE9,
+    0x09, 0xEA, 0x0A, 0xE9, 0x3A, 0xE9, 0x09, 0xEA, 0x1F, 0x3F, 0x1A, 0xEA, 0x1A, 0xE3, 0xF1, 0xAE,
+    0xA2, 0xEA, 0x2F, 0x1A, 0xEA, 0x2A, 0xE2, 0xF1, 0xFC, 0x29, 0xEA, 0x1F, 0x1F, 0xC3, 0xF1, 0xF1,
+    0xFC, 0x39, 0xEA, 0x9F, 0x1F, 0xC4, 0xF9, 0xF1, 0xFC, 0x49, 0xFF, 0x1F, 0xC5, 0xFE, 0xA0, 0x9F,
+    0xC5, 0x9F, 0xDA, 0x09, 0xFC, 0x6F, 0xDA, 0x09, 0xFC, 0x69, 0xFC, 0xA0, 0x59, 0xAA, 0x77, 0x4A,
+    0xD9, 0x77, 0x3A, 0xDA, 0x77, 0x3A, 0xE7, 0x73, 0x9A, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x49, 0xAF,
+    0xCA, 0x97, 0x39, 0xFF, 0xEA, 0x70, 0xAF, 0xDA, 0xFE, 0x95, 0xFC, 0xA4, 0x9F, 0xC9, 0x3A, 0xF9,
+    0x7F, 0xC3, 0xF9, 0x71, 0xFA, 0x1A, 0xEA, 0x72, 0x9F, 0x1F, 0x74, 0xF9, 0x0F, 0x74, 0x9E, 0x99,
+    0xE9, 0x75, 0xEA, 0x9E, 0x76, 0xEA, 0x9E, 0x76, 0xAE, 0x9E, 0x76, 0xAE, 0x9E, 0x76, 0xAD, 0xA9,
+    0xE7, 0x6E, 0xA9, 0xE9, 0x75, 0xEA, 0x0F, 0x74, 0xAE, 0x90, 0xFC, 0x72, 0xAF, 0x1A, 0xFD, 0x99,
+    0x29, 0x9A, 0xFD, 0x2F, 0xFF, 0xFE, 0xA2, 0xAF, 0xFF, 0xFD, 0x4F, 0xFF, 0xFC, 0xA5, 0xFF, 0xFE,
+    0xA7, 0xAF, 0xFF, 0x97, 0x29, 0xAF, 0xDA, 0x97, 0x77, 0x40, 0x74, 0xD7, 0x73, 0xAC, 0x97, 0x73,
+    0xD7, 0x73, 0xAC, 0xA7, 0x73, 0xD9, 0x77, 0x29, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x72, 0x9A, 0xFC, 0xA9, 0x73, 0x9F, 0xFE, 0xA7, 0x0A, 0xFD, 0xAF, 0xE9, 0x5F, 0xCA,
+    0x49, 0xFC, 0x93, 0xAF, 0x97, 0xFC, 0x3F, 0x97, 0x1F, 0xA1, 0xAE, 0xA7, 0x29, 0xF1, 0xF7, 0x4F,
+    0x90, 0xF7, 0x49, 0xE9, 0x9E, 0x97, 0x5E, 0xA9, 0xE7, 0x6E, 0xA9, 0xE7, 0x6A, 0xE9, 0xE7, 0x6A,
+    0xE9, 0xE7, 0x6A, 0xDA, 0x9E, 0x76, 0xEA, 0x9E, 0x97, 0x5E, 0xA0, 0xF7, 0x4A, 0xE9, 0x0F, 0xC7,
+    0x2A, 0xF1, 0xAF, 0xD9, 0x92, 0x99, 0xAF, 0xD2, 0xFF, 0xFF, 0xEA, 0x2A, 0xFF, 0xFF, 0xD4, 0xFF,
+    0xFF, 0xCA, 0x5F, 0xFF, 0xEA, 0x7A, 0xFF, 0xF9, 0x72, 0x9A, 0xFD, 0xA9, 0x77, 0x74, 0x72, 0x99,
+    0x77, 0x3A, 0xD7, 0x72, 0x9E, 0xA7, 0x70, 0x9D, 0xAD, 0xA7, 0x69, 0xD2, 0xAC, 0xA7, 0x49, 0xC9,
+    0x49, 0xCA, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xFC, 0xA9, 0x73, 0x9F, 0xFE, 0xA7, 0x0A, 0xFD, 0xAF,
+    0xE9, 0x5F, 0xCA, 0x49, 0xFC, 0x93, 0xAF, 0x97, 0xFC, 0x3F, 0x97, 0x1F, 0xA1, 0xAE, 0xA7, 0x29,
+    0xF1, 0xF7, 0x4F, 0x90, 0xF7, 0x49, 0xE9, 0x9E, 0x97, 0x5E, 0xA9, 0xE7, 0x6E, 0xA9, 0xE7, 0x6A,
+    0xE9, 0xE7, 0x6A, 0xE9, 0xE7, 0x6A, 0xDA, 0x9E, 0x76, 0xEA, 0x9E, 0x97, 0x5E, 0xA0, 0xF7, 0x4A,
+    0xE9, 0x0F, 0xC7, 0x2A, 0xF1, 0xAF, 0xD9, 0x92, 0x99, 0xAF, 0xD2, 0xFF, 0xFF, 0xEA, 0x2A, 0xFF,
+    0xFF, 0xD4, 0xFF, 0xFF, 0xCA, 0x5F, 0xFF, 0xEA, 0x7A, 0xFF, 0xF9, 0x72, 0x9A, 0xFD, 0xA9, 0x77,
+    0x74, 0x7A, 0xD3, 0xAC, 0x74, 0xAC, 0xAD, 0x2A, 0xC7, 0x4D, 0x1D, 0x1D, 0x74, 0xCA, 0x19, 0xFA,
+    0x74, 0xCA, 0x29, 0xE7, 0x77, 0x77, 0x77, 0x39, 0xAF, 0xCA, 0x97, 0x39, 0xFF, 0xEA, 0x70, 0xAF,
+    0xDA, 0xFE, 0x95, 0xFC, 0xA4, 0x9F, 0xC9, 0x3A, 0xF9, 0x7F, 0xC3, 0xF9, 0x71, 0xFA, 0x1A, 0xEA,
+    0x72, 0x9F, 0x1F, 0x74, 0xF9, 0x0F, 0x74, 0x9E, 0x99, 0xE9, 0x75, 0xEA, 0x9E, 0x76, 0xEA, 0x9E,
+    0x76, 0xAE, 0x9E, 0x76, 0xAE, 0x9E, 0x76, 0xAD, 0xA9, 0xE7, 0x6E, 0xA9, 0xE9, 0x75, 0xEA, 0x0F,
+    0x74, 0xAE, 0x90, 0xFC, 0x72, 0xAF, 0x1A, 0xFD, 0x99, 0x29, 0x9A, 0xFD, 0x2F, 0xFF, 0xFE, 0xA2,
+    0xAF, 0xFF, 0xFD, 0x4F, 0xFF, 0xFC, 0xA5, 0xFF, 0xFE, 0xA7, 0xAF, 0xFF, 0x97, 0x29, 0xAF, 0xDA,
+    0x97, 0x77, 0x40, 0x59, 0xE3, 0xAD, 0xA7, 0x2A, 0xE3, 0xF7, 0x2F, 0x3F, 0x72, 0xF3, 0xF7, 0x2F,
+    0x91, 0x9F, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xFC, 0xA9, 0x73, 0x9F, 0xFE, 0xA7, 0x0A, 0xFD, 0xAF,
+    0xE9, 0x5F, 0xCA, 0x49, 0xFC, 0x93, 0xAF, 0x97, 0xFC, 0x3F, 0x97, 0x1F, 0xA1, 0xAE, 0xA7, 0x29,
+    0xF1, 0xF7, 0x4F, 0x90, 0xF7, 0x49, 0xE9, 0x9E, 0x97, 0x5E, 0xA9, 0xE7, 0x6E, 0xA9, 0xE7, 0x6A,
+    0xE9, 0xE7, 0x6A, 0xE9, 0xE7, 0x6A, 0xDA, 0x9E, 0x76, 0xEA, 0x9E, 0x97, 0x5E, 0xA0, 0xF7, 0x4A,
+    0xE9, 0x0F, 0xC7, 0x2A, 0xF1, 0xAF, 0xD9, 0x92, 0x99, 0xAF, 0xD2, 0xFF, 0xFF, 0xEA, 0x2A, 0xFF,
+    0xFF, 0xD4, 0xFF, 0xFF, 0xCA, 0x5F, 0xFF, 0xEA, 0x7A, 0xFF, 0xF9, 0x72, 0x9A, 0xFD, 0xA9, 0x77,
+    0x74, 0x09, 0xD9, 0x2A, 0xD3, 0xAD, 0xA0, 0xAD, 0x94, 0xAF, 0xC9, 0x6A, 0xE9, 0x7F, 0xC6, 0xFE,
+    0x4E, 0xA0, 0xAE, 0x91, 0xF2, 0xAE, 0x90, 0x77, 0x77, 0x09, 0xAA, 0x77, 0x77, 0xE7, 0x77, 0x7E,
+    0x97, 0x77, 0x69, 0xE7, 0x77, 0x7E, 0x97, 0x77, 0x6A, 0xDA, 0x77, 0x76, 0x9E, 0x77, 0x77, 0xEA,
+    0x77, 0x76, 0xAE, 0x77, 0x77, 0xE9, 0x77, 0x76, 0xEA, 0x77, 0x76, 0x9E, 0x77, 0x77, 0xEA, 0x77,
+    0x49, 0xAF, 0xDA, 0x9A, 0xE7, 0x73, 0x9F, 0xFF, 0xD9, 0x77, 0x2A, 0xFD, 0xAA, 0xFE, 0x77, 0x2A,
+    0xFA, 0x49, 0xFC, 0xA7, 0x70, 0x9F, 0xA6, 0xFD, 0x97, 0x7F, 0xA6, 0xFF, 0x77, 0xF6, 0x9E, 0x9F,
+    0x97, 0x5A, 0xEA, 0x6F, 0x0A, 0xEA, 0x75, 0xF6, 0xF2, 0xF7, 0x5E, 0xA5, 0x9E, 0xA2, 0xF7, 0x5E,
+    0x95, 0xF3, 0xAE, 0x75, 0xE9, 0x4A, 0xE9, 0x39, 0xE7, 0x5E, 0x93, 0x9E, 0xA4, 0x9E, 0x75, 0xE9,
+    0x3F, 0x59, 0xE7, 0x5E, 0x92, 0xAE, 0xA5, 0xAE, 0x75, 0xF2, 0xF6, 0xF7, 0x5F, 0x90, 0xF9, 0x59,
+    0xEA, 0x75, 0xAF, 0xAE, 0xA5, 0x9F, 0x97, 0x59, 0xFF, 0x91, 0x99, 0xAF, 0xD7, 0x7F, 0xFF, 0xFF,
+    0x77, 0x9F, 0xFF, 0xFD, 0x97, 0x70, 0xAF, 0xFF, 0xFC, 0x77, 0x1A, 0xFF, 0xFF, 0x77, 0x2F, 0xFF,
+    0xEA, 0x77, 0x2F, 0xA9, 0xAF, 0xDA, 0x97, 0x73, 0x9F, 0x77, 0x76, 0xF9, 0x77, 0x75, 0xAE, 0xA7,
+    0x77, 0x59, 0xF7, 0x77, 0x6F, 0xA7, 0x77, 0x5A, 0xF7, 0x77, 0x6F, 0x97, 0x77, 0x5F, 0xC7, 0x77,
+    0x59, 0xF7, 0x77, 0x6F, 0xA7, 0x77, 0x5A, 0xF7, 0x77, 0x59, 0xDA, 0x97, 0x77, 0x6C, 0xA7, 0x77,
+    0x77, 0x77, 0x74, 0x77, 0x71, 0xAD, 0x97, 0x71, 0xAD, 0xA7, 0x71, 0xAE, 0x77, 0x1A, 0xE9, 0x77,
+    0x39, 0x77, 0x77, 0x77, 0x77, 0x69, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0,
+    0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF1, 0xF7, 0x19,
+    0xF1, 0xF7, 0x19, 0xF1, 0xF7, 0x19, 0xF1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19,
+    0xEA, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0x91, 0xF7, 0x1A, 0xE9, 0x1F,
+    0x97, 0x0F, 0x91, 0xAF, 0x79, 0xF2, 0xAF, 0xCA, 0xA9, 0x99, 0xAF, 0xD2, 0x9F, 0xFF, 0xFC, 0x3F,
+    0xFF, 0xFA, 0x3A, 0xFF, 0xFE, 0x5F, 0xFF, 0xD9, 0x69, 0xFF, 0xDA, 0x77, 0x71, 0x72, 0xAC, 0x97,
+    0x71, 0xD7, 0x71, 0xAC, 0xA7, 0x71, 0xD9, 0x77, 0x0A, 0xD7, 0x71, 0xAA, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xAA, 0xAA, 0x71, 0x9A, 0xAA, 0xA0, 0x9F, 0x97, 0x0A,
+    0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F,
+    0x71, 0xAF, 0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9E, 0xA1, 0xF7,
+    0x19, 0xEA, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xE9,
+    0x1F, 0x71, 0xAE, 0x91, 0xF9, 0x70, 0xF9, 0x1A, 0xF7, 0x9F, 0x2A, 0xFC, 0xA9, 0x99, 0x9A, 0xFD,
+    0x29, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xE5, 0xFF, 0xFD, 0x96, 0x9F, 0xFD, 0xA7,
+    0x77, 0x10, 0x70, 0xAC, 0x77, 0x19, 0xE7, 0x79, 0xFA, 0x75, 0x9D, 0x90, 0xDA, 0x73, 0x9C, 0xA3,
+    0xAC, 0xA7, 0x2C, 0x96, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x39, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF,
+    0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7,
+    0x1A, 0xF1, 0xF7, 0x19, 0xF1, 0xF7, 0x19, 0xF1, 0xF7, 0x19, 0xF1, 0xF7, 0x19, 0xEA, 0x1F, 0x71,
+    0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0x91,
+    0xF7, 0x1A, 0xE9, 0x1F, 0x97, 0x0F, 0x91, 0xAF, 0x79, 0xF2, 0xAF, 0xCA, 0xA9, 0x99, 0xAF, 0xD2,
+    0x9F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFA, 0x3A, 0xFF, 0xFE, 0x5F, 0xFF, 0xD9, 0x69, 0xFF, 0xDA, 0x77,
+    0x71, 0x4A, 0xD4, 0xE7, 0x1E, 0x93, 0xE9, 0x79, 0xEA, 0x29, 0xEA, 0x7A, 0xEA, 0x2A, 0xEA, 0x7F,
+    0xC2, 0xFC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xF9, 0x70, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F,
+    0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF,
+    0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA,
+    0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xE9, 0x1F, 0x71,
+    0xAE, 0x91, 0xF9, 0x70, 0xF9, 0x1A, 0xF7, 0x9F, 0x2A, 0xFC, 0xAA, 0x99, 0x9A, 0xFD, 0x29, 0xFF,
+    0xFF, 0xC3, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xE5, 0xFF, 0xFD, 0x96, 0x9F, 0xFD, 0xA7, 0x77, 0x10,
+    0x72, 0x9A, 0x97, 0x71, 0xD7, 0x71, 0xAC, 0xA7, 0x71, 0xD9, 0x77, 0x0A, 0xD7, 0x71, 0xDA, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1E, 0x97, 0x29, 0xE1, 0xF7, 0x2E,
+    0xA1, 0x9E, 0x97, 0x09, 0xE3, 0xF7, 0x0F, 0x39, 0xEA, 0x6A, 0xE9, 0x4F, 0x6F, 0x59, 0xEA, 0x4A,
+    0xE9, 0x6F, 0x92, 0x9F, 0x79, 0xF2, 0xF9, 0x70, 0xF9, 0x09, 0xF7, 0x19, 0xF0, 0xF9, 0x72, 0xFF,
+    0xC7, 0x3A, 0xFE, 0x97, 0x4F, 0xE7, 0x5A, 0xFC, 0x97, 0x6F, 0xC7, 0x7F, 0xA7, 0x7F, 0xA7, 0x7F,
+    0xA7, 0x69, 0xFA, 0x76, 0xAF, 0xA7, 0x6A, 0xFA, 0x76, 0xFC, 0xA7, 0x6F, 0xCA, 0x75, 0x9F, 0xCA,
+    0x70, 0x9D, 0x97, 0x19, 0xD9, 0x71, 0x9D, 0x97, 0x19, 0xDA, 0x99, 0x79, 0xFD, 0xA5, 0x9F, 0xFA,
+    0x39, 0xDA, 0x1A, 0xF9, 0x19, 0xD9, 0x3A, 0xE9, 0x09, 0xD9, 0x49, 0xE0, 0x9D, 0x96, 0xDA, 0x9D,
+    0x96, 0xAC, 0xA9, 0xD9, 0x6D, 0xA9, 0xD9, 0x5E, 0x99, 0xD9, 0x39, 0xEA, 0x09, 0xDA, 0x19, 0xFC,
+    0x19, 0xFF, 0xCA, 0x29, 0xFE, 0xA4, 0x9F, 0xA9, 0x69, 0xD9, 0x71, 0x9D, 0x97, 0x19, 0xD9, 0x71,
+    0x9D, 0x97, 0x19, 0xD9, 0x71, 0x49, 0x9A, 0x99, 0x70, 0x9F, 0xE9, 0x59, 0xDA, 0x29, 0xD9, 0x4D,
+    0xA5, 0xD3, 0xAD, 0x69, 0xC9, 0x2A, 0xD7, 0xCA, 0x2D, 0xA4, 0x9E, 0xA2, 0xDA, 0x3A, 0xD9, 0x4D,
+    0xA3, 0xD6, 0xDA, 0x29, 0xC9, 0x6D, 0xA2, 0x9C, 0x96, 0xE2, 0x9D, 0x6E, 0x3E, 0x5E, 0x39, 0xEA,
+    0x3E, 0x4A, 0xF1, 0x9E, 0x6F, 0x09, 0xE7, 0xAD, 0x99, 0xE7, 0x0D, 0xA9, 0xE7, 0x9D, 0x99, 0xE0,
+    0xAC, 0xA9, 0x99, 0xAE, 0x9A, 0xE0, 0xAF, 0xFC, 0x0A, 0xE0, 0xAF, 0xF1, 0xAE, 0x1A, 0xFA, 0x92,
+    0x77, 0x39, 0xD9, 0x75, 0x9D, 0xA7, 0x59, 0xE9, 0x74, 0x9E, 0xA7, 0x77, 0x77, 0x5A, 0xEA, 0x09,
+    0xD5, 0x9F, 0xEA, 0xD4, 0x9E, 0xAA, 0xAF, 0xC4, 0xE4, 0xAE, 0x3A, 0xD6, 0xE3, 0xDA, 0x6A, 0xD9,
+    0x2D, 0x7A, 0xD9, 0x19, 0xD7, 0x9D, 0xA1, 0x9D, 0x7A, 0xDA, 0x1A, 0xD7, 0xF1, 0x9D, 0x95, 0xAF,
+    0x2F, 0xA9, 0x9A, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0x9F, 0xF9, 0x9D, 0x94, 0xAF, 0xA1,
+    0x9D, 0x90, 0x70, 0x9A, 0x97, 0x5D, 0x75, 0x9D, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xE7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x72, 0xAE, 0xA0, 0x9D, 0x59, 0xFE, 0xAD, 0x49, 0xEA, 0xAA, 0xFC, 0x4E,
+    0x4A, 0xE3, 0xAD, 0x6E, 0x3D, 0xA6, 0xAD, 0x92, 0xD7, 0xAD, 0x91, 0x9D, 0x79, 0xDA, 0x19, 0xD7,
+    0xAD, 0xA1, 0xAD, 0x7F, 0x19, 0xD9, 0x5A, 0xF2, 0xFA, 0x99, 0xAF, 0xD2, 0xFF, 0xFD, 0x29, 0xFF,
+    0xFC, 0x39, 0xFF, 0x99, 0xD9, 0x4A, 0xFA, 0x19, 0xD9, 0x77, 0x7A, 0xC9, 0x74, 0x9E, 0x74, 0xFC,
+    0x71, 0x9D, 0x90, 0xAD, 0x79, 0xCA, 0x39, 0xD6, 0xA9, 0x6A, 0xA7, 0x77, 0x1A, 0xEA, 0x09, 0xD5,
+    0x9F, 0xEA, 0xD4, 0x9E, 0xAA, 0xAF, 0xC4, 0xE4, 0xAE, 0x3A, 0xD6, 0xE3, 0xDA, 0x6A, 0xD9, 0x2D,
+    0x7A, 0xD9, 0x19, 0xD7, 0x9D, 0xA1, 0x9D, 0x7A, 0xDA, 0x1A, 0xD7, 0xF1, 0x9D, 0x95, 0xAF, 0x2F,
+    0xA9, 0x9A, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0x9F, 0xF9, 0x9D, 0x94, 0xAF, 0xA1, 0x9D,
+    0x90, 0x49, 0x97, 0x5A, 0xE9, 0x2C, 0xA6, 0xD0, 0xAC, 0x2C, 0x95, 0x9C, 0x91, 0xD0, 0x9C, 0x95,
+    0x9C, 0x91, 0x9F, 0x69, 0xC9, 0x3A, 0xA7, 0x77, 0x3A, 0xEA, 0x09, 0xD5, 0x9F, 0xEA, 0xD4, 0x9E,
+    0xAA, 0xAF, 0xC4, 0xE4, 0xAE, 0x3A, 0xD6, 0xE3, 0xDA, 0x6A, 0xD9, 0x2D, 0x7A, 0xD9, 0x19, 0xD7,
+    0x9D, 0xA1, 0x9D, 0x7A, 0xDA, 0x1A, 0xD7, 0xF1, 0x9D, 0x95, 0xAF, 0x2F, 0xA9, 0x9A, 0xFD, 0x2F,
+    0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0x9F, 0xF9, 0x9D, 0x94, 0xAF, 0xA1, 0x9D, 0x90, 0x2A, 0xD9, 0x3A,
+    0xD9, 0x4E, 0xA3, 0xEA, 0x4E, 0xA2, 0x9E, 0xA3, 0x9F, 0x29, 0xF3, 0xAF, 0x2A, 0xF7, 0x77, 0x77,
+    0x1A, 0xEA, 0x09, 0xD5, 0x9F, 0xEA, 0xD4, 0x9E, 0xAA, 0xAF, 0xC4, 0xE4, 0xAE, 0x3A, 0xD6, 0xE3,
+    0xDA, 0x6A, 0xD9, 0x2D, 0x7A, 0xD9, 0x19, 0xD7, 0x9D, 0xA1, 0x9D, 0x7A, 0xDA, 0x1A, 0xD7, 0xF1,
+    0x9D, 0x95, 0xAF, 0x2F, 0xA9, 0x9A, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0x9F, 0xF9, 0x9D,
+    0x94, 0xAF, 0xA1, 0x9D, 0x90, 0x6A, 0xCA, 0x74, 0xCA, 0x09, 0xC7, 0x3C, 0x2C, 0x97, 0x19, 0xC2,
+    0xCA, 0x72, 0xC9, 0x1C, 0x97, 0x2A, 0xF7, 0x4A, 0xCA, 0x77, 0x77, 0x76, 0xAE, 0xA0, 0x9D, 0x59,
+    0xFE, 0xAD, 0x49, 0xEA, 0xAA, 0xFC, 0x4E, 0x4A, 0xE3, 0xAD, 0x6E, 0x3D, 0xA6, 0xAD, 0x92, 0xD7,
+    0xAD, 0x91, 0x9D, 0x79, 0xDA, 0x19, 0xD7, 0xAD, 0xA1, 0xAD, 0x7F, 0x19, 0xD9, 0x5A, 0xF2, 0xFA,
+    0x99, 0xAF, 0xD2, 0xFF, 0xFD, 0x29, 0xFF, 0xFC, 0x39, 0xFF, 0x99, 0xD9, 0x4A, 0xFA, 0x19, 0xD9,
+    0x77, 0x19, 0xEA, 0x97, 0x2A, 0xEA, 0x09, 0xD0, 0x9F, 0xEA, 0x79, 0xFE, 0xAD, 0xAE, 0x92, 0xAD,
+    0x59, 0xEA, 0xAA, 0xFE, 0x95, 0x9C, 0xA4, 0xE4, 0xAF, 0xA7, 0xD9, 0x2A, 0xD6, 0xF4, 0x99, 0x9A,
+    0xDA, 0x2D, 0xA6, 0xAF, 0xFF, 0xE2, 0xD7, 0xAF, 0xFF, 0xCA, 0xA1, 0x9D, 0x79, 0xE9, 0x97, 0x39,
+    0xD7, 0xAE, 0x75, 0xAD, 0x7F, 0x75, 0x9D, 0x95, 0xAF, 0xC7, 0x5F, 0xA9, 0x9A, 0xFF, 0xA9, 0x5A,
+    0x92, 0xFF, 0xFF, 0xFF, 0xC9, 0x29, 0xFF, 0xFF, 0xFF, 0x93, 0x9F, 0xF9, 0x9F, 0xFF, 0xC9, 0x5A,
+    0xFA, 0x19, 0xD9, 0x0A, 0xAF, 0xA9, 0x20, 0x77, 0x19, 0xFD, 0x5F, 0xF4, 0xFA, 0xA9, 0xAA, 0x3A,
+    0xE7, 0x1E, 0x97, 0x09, 0xE7, 0x19, 0xDA, 0x71, 0xAD, 0x97, 0x1A, 0xD9, 0x71, 0x9D, 0xA7, 0x19,
+    0xE9, 0x71, 0xF9, 0x70, 0xAF, 0xA9, 0x99, 0xA4, 0xFF, 0xD4, 0xFF, 0xCA, 0x49, 0xFD, 0xA9, 0x6A,
+    0x97, 0x3E, 0xA7, 0x4A, 0xC7, 0x4C, 0x73, 0xAC, 0x70, 0xF9, 0x70, 0xAA, 0x94, 0x77, 0x2A, 0xD9,
+    0x74, 0xAD, 0xA7, 0x4A, 0xE7, 0x4A, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xEA, 0x70,
+    0xFF, 0x95, 0xEA, 0x3D, 0x93, 0xE6, 0xD2, 0x9D, 0x79, 0xD1, 0xDA, 0x39, 0x99, 0xAA, 0xD1, 0xFF,
+    0xFD, 0x99, 0xFF, 0xFA, 0xA9, 0xAD, 0x99, 0x72, 0x9D, 0x97, 0x39, 0xDA, 0x74, 0xEA, 0x73, 0xFC,
+    0x95, 0x9A, 0x2F, 0xFF, 0xC2, 0x9F, 0xFF, 0x39, 0xFF, 0xE5, 0x9A, 0xFA, 0xA2, 0x70, 0xD7, 0x49,
+    0xCA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xDA, 0x73, 0x9A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x72, 0x9A, 0xEA, 0x70, 0xFF, 0x95, 0xEA, 0x3D, 0x93, 0xE6, 0xD2, 0x9D, 0x79,
+    0xD1, 0xDA, 0x39, 0x99, 0xAA, 0xD1, 0xFF, 0xFD, 0x99, 0xFF, 0xFA, 0xA9, 0xAD, 0x99, 0x72, 0x9D,
+    0x97, 0x39, 0xDA, 0x74, 0xEA, 0x73, 0xFC, 0x95, 0x9A, 0x2F, 0xFF, 0xC2, 0x9F, 0xFF, 0x39, 0xFF,
+    0xE5, 0x9A, 0xFA, 0xA2, 0x77, 0x6D, 0x74, 0xEA, 0x72, 0xAF, 0xA7, 0x0A, 0xCA, 0x1D, 0xA6, 0xAC,
+    0x93, 0x9C, 0xA4, 0x9A, 0x7A, 0x77, 0x77, 0x77, 0x77, 0x79, 0xAE, 0xA7, 0x0F, 0xF9, 0x5E, 0xA3,
+    0xD9, 0x3E, 0x6D, 0x29, 0xD7, 0x9D, 0x1D, 0xA3, 0x99, 0x9A, 0xAD, 0x1F, 0xFF, 0xD9, 0x9F, 0xFF,
+    0xAA, 0x9A, 0xD9, 0x97, 0x29, 0xD9, 0x73, 0x9D, 0xA7, 0x4E, 0xA7, 0x3F, 0xC9, 0x59, 0xA2, 0xFF,
+    0xFC, 0x29, 0xFF, 0xF3, 0x9F, 0xFE, 0x59, 0xAF, 0xAA, 0x20, 0x2E, 0x4E, 0x39, 0xE3, 0x9E, 0x3A,
+    0xE9, 0x2A, 0xE9, 0x2F, 0xA2, 0xF9, 0x2F, 0xA2, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xAE,
+    0xA7, 0x0F, 0xF9, 0x5E, 0xA3, 0xD9, 0x3E, 0x6D, 0x29, 0xD7, 0x9D, 0x1D, 0xA3, 0x99, 0x9A, 0xAD,
+    0x1F, 0xFF, 0xD9, 0x9F, 0xFF, 0xAA, 0x9A, 0xD9, 0x97, 0x29, 0xD9, 0x73, 0x9D, 0xA7, 0x4E, 0xA7,
+    0x3F, 0xC9, 0x59, 0xA2, 0xFF, 0xFC, 0x29, 0xFF, 0xF3, 0x9F, 0xFE, 0x59, 0xAF, 0xAA, 0x20, 0x09,
+    0xAA, 0x7A, 0xD9, 0x6A, 0xDA, 0x6A, 0xE6, 0x99, 0xAA, 0x77, 0x77, 0x3A, 0xD6, 0xAD, 0x6A, 0xD6,
+    0xAC, 0xA6, 0xAC, 0xA6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x94,
+    0x9E, 0x90, 0x29, 0xCA, 0x2D, 0x29, 0xD2, 0xDA, 0x19, 0xD2, 0xAA, 0xA7, 0x77, 0x77, 0x4A, 0xD2,
+    0xAD, 0x2A, 0xD2, 0xAC, 0xA2, 0xAC, 0xA2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x90, 0x9E, 0x90, 0x5A, 0x72, 0xE7, 0x0A, 0xEA, 0x6A, 0xD9, 0xDA, 0x4A, 0xCA, 0x2A,
+    0xCA, 0x2A, 0xC5, 0x9C, 0xA7, 0x77, 0x77, 0x4A, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1A, 0xCA, 0x71,
+    0xAC, 0xA7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71,
+    0xE7, 0x1E, 0x97, 0x9E, 0x93, 0x1E, 0x4E, 0x19, 0xE3, 0x9E, 0x1A, 0xE9, 0x2A, 0xE9, 0x0F, 0x92,
+    0xF9, 0x0F, 0xA2, 0xFA, 0x77, 0x77, 0x77, 0x75, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAC, 0xA7,
+    0x2A, 0xCA, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7,
+    0x2E, 0x72, 0xE9, 0x70, 0x9E, 0x93, 0x71, 0xAC, 0xA9, 0x77, 0x1F, 0xC7, 0x72, 0xAD, 0xA7, 0x72,
+    0xAD, 0x75, 0xFF, 0xFC, 0x70, 0xFF, 0xFC, 0x70, 0xFF, 0xFC, 0x75, 0xAC, 0xA7, 0x72, 0xAC, 0xA7,
+    0x1F, 0xD2, 0xD9, 0x7A, 0xFF, 0x1D, 0x96, 0x9E, 0xA2, 0xAD, 0x0D, 0x7E, 0x94, 0xAC, 0xAD, 0x69,
+    0xDA, 0x6F, 0x69, 0xD9, 0x6A, 0xDA, 0x6A, 0xD9, 0x69, 0xD9, 0x6A, 0xD9, 0x69, 0xD7, 0xAE, 0x6E,
+    0x70, 0xEA, 0x4A, 0xD9, 0x70, 0xAF, 0xFE, 0x72, 0xFF, 0xD9, 0x73, 0xFF, 0xA7, 0x59, 0xFA, 0x73,
+    0x59, 0x93, 0xAA, 0x59, 0xF2, 0xAC, 0x5D, 0x09, 0xCA, 0x1A, 0xC5, 0xCA, 0x19, 0xFA, 0x5C, 0xA2,
+    0x9E, 0x77, 0x77, 0x77, 0x71, 0x99, 0x96, 0x9D, 0x0A, 0xFC, 0xA4, 0x9F, 0xFE, 0x3A, 0xF9, 0x2A,
+    0xDA, 0x2A, 0xE9, 0x4E, 0x2A, 0xE5, 0xAD, 0x91, 0xE9, 0x59, 0xD9, 0x1E, 0x95, 0x9D, 0xA1, 0xE9,
+    0x59, 0xDA, 0x1E, 0x95, 0x9E, 0x1E, 0x95, 0xAE, 0x1E, 0xA5, 0xAE, 0x1E, 0xA5, 0xAE, 0x09, 0xEA,
+    0x5A, 0xE0, 0x9E, 0xA5, 0xAE, 0x09, 0xEA, 0x5A, 0xE0, 0xAF, 0x5A, 0xE9, 0x29, 0x97, 0x5A, 0xD9,
+    0x74, 0xAD, 0xA7, 0x4A, 0xE7, 0x49, 0xAA, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAF, 0xA9,
+    0x6A, 0xFF, 0xA4, 0xAF, 0xAA, 0xFC, 0x29, 0xE5, 0xAD, 0x91, 0xE7, 0xE1, 0xDA, 0x79, 0xD9, 0x9D,
+    0x97, 0x9D, 0xAA, 0xD9, 0x70, 0xDA, 0xAD, 0x97, 0x9D, 0xA9, 0xDA, 0x79, 0xDA, 0x0E, 0x7E, 0x90,
+    0xFA, 0x99, 0x99, 0xAF, 0x2F, 0xFF, 0x92, 0xAF, 0xFD, 0xA4, 0x9F, 0xFA, 0x7A, 0xFA, 0x40, 0x70,
+    0xAA, 0x74, 0x9C, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4D, 0xA7, 0x39, 0xD9, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xAF, 0xA9, 0x6A, 0xFF, 0xA4, 0xAF, 0xAA, 0xFC, 0x29, 0xE5,
+    0xAD, 0x91, 0xE7, 0xE1, 0xDA, 0x79, 0xD9, 0x9D, 0x97, 0x9D, 0xAA, 0xD9, 0x70, 0xDA, 0xAD, 0x97,
+    0x9D, 0xA9, 0xDA, 0x79, 0xDA, 0x0E, 0x7E, 0x90, 0xFA, 0x99, 0x99, 0xAF, 0x2F, 0xFF, 0x92, 0xAF,
+    0xFD, 0xA4, 0x9F, 0xFA, 0x7A, 0xFA, 0x40, 0x69, 0x97, 0x49, 0xD7, 0x4E, 0xA7, 0x2D, 0xAD, 0xA7,
+    0x0D, 0x91, 0xAC, 0xA6, 0xCA, 0x49, 0xCA, 0x49, 0x97, 0x97, 0x77, 0x77, 0x77, 0x77, 0xAF, 0xA9,
+    0x6A, 0xFF, 0xA4, 0xAF, 0xAA, 0xFC, 0x29, 0xE5, 0xAD, 0x91, 0xE7, 0xE1, 0xDA, 0x79, 0xD9, 0x9D,
+    0x97, 0x9D, 0xAA, 0xD9, 0x70, 0xDA, 0xAD, 0x97, 0x9D, 0xA9, 0xDA, 0x79, 0xDA, 0x0E, 0x7E, 0x90,
+    0xFA, 0x99, 0x99, 0xAF, 0x2F, 0xFF, 0x92, 0xAF, 0xFD, 0xA4, 0x9F, 0xFA, 0x7A, 0xFA, 0x40, 0x3A,
+    0xD9, 0x29, 0xC5, 0x9D, 0xAC, 0x91, 0x9C, 0x5D, 0x1D, 0x1A, 0xC5, 0xD2, 0xFA, 0x5D, 0x3E, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x70, 0xAF, 0xA9, 0x6A, 0xFF, 0xA4, 0xAF, 0xAA, 0xFC, 0x29, 0xE5, 0xAD,
+    0x91, 0xE7, 0xE1, 0xDA, 0x79, 0xD9, 0x9D, 0x97, 0x9D, 0xAA, 0xD9, 0x70, 0xDA, 0xAD, 0x97, 0x9D,
+    0xA9, 0xDA, 0x79, 0xDA, 0x0E, 0x7E, 0x90, 0xFA, 0x99, 0x99, 0xAF, 0x2F, 0xFF, 0x92, 0xAF, 0xFD,
+    0xA4, 0x9F, 0xFA, 0x7A, 0xFA, 0x40, 0x19, 0xE3, 0x9E, 0x3A, 0xE3, 0xAE, 0x3A, 0xE3, 0xF3, 0xF9,
+    0x2F, 0x92, 0xF9, 0x2F, 0x97, 0x77, 0x77, 0x77, 0x77, 0x75, 0xAF, 0xA9, 0x6A, 0xFF, 0xA4, 0xAF,
+    0xAA, 0xFC, 0x29, 0xE5, 0xAD, 0x91, 0xE7, 0xE1, 0xDA, 0x79, 0xD9, 0x9D, 0x97, 0x9D, 0xAA, 0xD9,
+    0x70, 0xDA, 0xAD, 0x97, 0x9D, 0xA9, 0xDA, 0x79, 0xDA, 0x0E, 0x7E, 0x90, 0xFA, 0x99, 0x99, 0xAF,
+    0x2F, 0xFF, 0x92, 0xAF, 0xFD, 0xA4, 0x9F, 0xFA, 0x7A, 0xFA, 0x40, 0x6A, 0xD7, 0x6E, 0x97, 0x49,
+    0xEA, 0x74, 0xAE, 0xA7, 0x4F, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xFE,
+    0x90, 0xFF, 0xFF, 0xA7, 0x77, 0x77, 0x2A, 0xD7, 0x6E, 0x97, 0x49, 0xEA, 0x74, 0xAE, 0xA7, 0x4F,
+    0xC6, 0x76, 0x99, 0x75, 0xD7, 0x59, 0xD7, 0x5A, 0xCA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75,
+    0xDA, 0x75, 0xD9, 0x74, 0xAD, 0x75, 0xDA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x71, 0xAF, 0xCA,
+    0x7A, 0xFF, 0xA5, 0xAF, 0xAF, 0xD3, 0x9E, 0x2E, 0xAD, 0xA2, 0xE2, 0x9D, 0x90, 0xE2, 0xDA, 0x2A,
+    0xD1, 0x9D, 0x90, 0x9D, 0x92, 0xE1, 0x9D, 0xA0, 0xAD, 0x92, 0xDA, 0x2D, 0xA0, 0x9D, 0x91, 0xAD,
+    0x29, 0xDA, 0x09, 0xDA, 0x1E, 0x29, 0xDA, 0x1E, 0x1D, 0xA2, 0xE9, 0x1F, 0xEA, 0x9A, 0xF2, 0x9F,
+    0xFF, 0x93, 0xAF, 0xFD, 0xA5, 0xAF, 0xFA, 0x7F, 0xDA, 0x71, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x97,
+    0x4E, 0x75, 0xE7, 0x4A, 0xDA, 0x74, 0xE9, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xE9, 0x74, 0xE7, 0x49,
+    0xDA, 0x74, 0xAC, 0x97, 0x5C, 0x77, 0x77, 0x19, 0x97, 0x4A, 0xD9, 0x73, 0xAD, 0xA7, 0x39, 0xE9,
+    0x72, 0x9A, 0xDA, 0x77, 0x77, 0x77, 0x1A, 0xD9, 0x6A, 0xD9, 0x9D, 0x96, 0xAD, 0x99, 0xD9, 0x6A,
+    0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x0D, 0xA6, 0xE9, 0x0E, 0x6E, 0xA0, 0xE6, 0xEA,
+    0x0E, 0x6E, 0xA0, 0xE6, 0xEA, 0x0E, 0xA4, 0xFA, 0x0A, 0xFF, 0xFA, 0x09, 0xFF, 0xFA, 0x1F, 0xFF,
+    0xC1, 0xAF, 0xF9, 0xE2, 0x9F, 0xCA, 0x09, 0xE7, 0x60, 0x7A, 0xA7, 0x4D, 0x73, 0xAC, 0xA7, 0x3D,
+    0x73, 0xAD, 0x73, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xAD, 0x96, 0xAD, 0x99, 0xD9,
+    0x6A, 0xD9, 0x9D, 0x96, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x90, 0xDA, 0x6E, 0x90,
+    0xE6, 0xEA, 0x0E, 0x6E, 0xA0, 0xE6, 0xEA, 0x0E, 0x6E, 0xA0, 0xEA, 0x4F, 0xA0, 0xAF, 0xFF, 0xA0,
+    0x9F, 0xFF, 0xA1, 0xFF, 0xFC, 0x1A, 0xFF, 0x9E, 0x29, 0xFC, 0xA0, 0x9E, 0x76, 0x77, 0x4D, 0x73,
+    0xF7, 0x1F, 0xD7, 0xDA, 0x1A, 0xD5, 0xD9, 0x39, 0xD4, 0x97, 0x97, 0x77, 0x70, 0xAD, 0x96, 0xAD,
+    0x99, 0xD9, 0x6A, 0xD9, 0x9D, 0x96, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x90, 0xDA,
+    0x6E, 0x90, 0xE6, 0xEA, 0x0E, 0x6E, 0xA0, 0xE6, 0xEA, 0x0E, 0x6E, 0xA0, 0xEA, 0x4F, 0xA0, 0xAF,
+    0xFF, 0xA0, 0x9F, 0xFF, 0xA1, 0xFF, 0xFC, 0x1A, 0xFF, 0x9E, 0x29, 0xFC, 0xA0, 0x9E, 0x76, 0x1E,
+    0x4E, 0x29, 0xE9, 0x29, 0xE2, 0xAE, 0x92, 0xAE, 0x91, 0xAE, 0xA2, 0xFA, 0x1A, 0xEA, 0x2F, 0xA7,
+    0x77, 0x77, 0x5A, 0xD9, 0x6A, 0xD9, 0x9D, 0x96, 0xAD, 0x99, 0xD9, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD,
+    0x99, 0xDA, 0x6A, 0xD9, 0x0D, 0xA6, 0xE9, 0x0E, 0x6E, 0xA0, 0xE6, 0xEA, 0x0E, 0x6E, 0xA0, 0xE6,
+    0xEA, 0x0E, 0xA4, 0xFA, 0x0A, 0xFF, 0xFA, 0x09, 0xFF, 0xFA, 0x1F, 0xFF, 0xC1, 0xAF, 0xF9, 0xE2,
+    0x9F, 0xCA, 0x09, 0xE7, 0x60, 0x70, 0xAC, 0x97, 0x4D, 0x74, 0xAC, 0xA7, 0x4D, 0x97, 0x3A, 0xD7,
+    0x4A, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xDA, 0x70, 0xE0, 0xE7,
+    0x9D, 0xA0, 0x9D, 0xA6, 0xAD, 0x91, 0xE9, 0x5E, 0x29, 0xE5, 0xE3, 0xE9, 0x3A, 0xDA, 0x39, 0xE3,
+    0xE9, 0x4E, 0xA2, 0xE5, 0x9E, 0x90, 0x9E, 0x6F, 0x0E, 0xA6, 0x9E, 0xAE, 0xA7, 0xFE, 0x97, 0x9F,
+    0xD7, 0x1F, 0xD7, 0x19, 0xFA, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF7, 0x19, 0xF9, 0x79, 0xAF, 0xC5,
+    0xAF, 0xF6, 0xAF, 0xE7, 0xAF, 0xCA, 0x70, 0xAD, 0xA9, 0x71, 0x74, 0xAD, 0x71, 0xAD, 0x71, 0xAD,
+    0x71, 0xAD, 0x71, 0xAD, 0x71, 0xAF, 0xA9, 0x5A, 0xFE, 0x93, 0xAD, 0x1A, 0xEA, 0x2A, 0xD3, 0xAD,
+    0xA1, 0xAD, 0x4A, 0xD9, 0x09, 0xD5, 0xAC, 0xA0, 0x9D, 0x6D, 0x09, 0xD6, 0xD0, 0x9D, 0x59, 0xD0,
+    0x9D, 0x5A, 0xCA, 0x09, 0xD4, 0x9D, 0x90, 0x9D, 0x4E, 0x19, 0xD3, 0xE9, 0x19, 0xD9, 0x0A, 0xEA,
+    0x29, 0xFE, 0x93, 0x9F, 0xCA, 0x59, 0xDA, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x1D,
+    0x97, 0x1D, 0x97, 0x1D, 0x97, 0x75, 0x2A, 0xD9, 0x3A, 0xD9, 0x3E, 0xA3, 0xE9, 0x3E, 0xA2, 0x9E,
+    0xA2, 0x9F, 0x2A, 0xF2, 0xAF, 0x2A, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9D, 0xA7, 0x0E,
+    0x0E, 0x79, 0xDA, 0x09, 0xDA, 0x6A, 0xD9, 0x1E, 0x95, 0xE2, 0x9E, 0x5E, 0x3E, 0x93, 0xAD, 0xA3,
+    0x9E, 0x3E, 0x94, 0xEA, 0x2E, 0x59, 0xE9, 0x09, 0xE6, 0xF0, 0xEA, 0x69, 0xEA, 0xEA, 0x7F, 0xE9,
+    0x79, 0xFD, 0x71, 0xFD, 0x71, 0x9F, 0xA7, 0x2F, 0x97, 0x2F, 0x72, 0x9F, 0x71, 0x9F, 0x97, 0x9A,
+    0xFC, 0x5A, 0xFF, 0x6A, 0xFE, 0x7A, 0xFC, 0xA7, 0x0A, 0xDA, 0x97, 0x10, 0x75, 0x99, 0x97, 0x3F,
+    0xFE, 0xA7, 0x1A, 0xFF, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xE9, 0x77, 0x1A, 0xEA,
+    0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xC9, 0x77, 0xAD, 0xAE, 0x77, 0xE0, 0xE7, 0x69, 0xDA, 0x0A, 0xDA,
+    0x75, 0xE9, 0x09, 0xE7, 0x5E, 0x2E, 0x97, 0x3A, 0xDA, 0x2A, 0xDA, 0x73, 0xE9, 0x29, 0xE7, 0x29,
+    0xE4, 0xE9, 0x71, 0xAD, 0xA4, 0xAE, 0x71, 0xE9, 0x49, 0xE7, 0x09, 0xE6, 0xEA, 0x7E, 0xA6, 0xAE,
+    0x7E, 0x97, 0xE9, 0x5A, 0xFF, 0xFF, 0x5F, 0xFF, 0xFC, 0x49, 0xFF, 0xFF, 0xCA, 0x3F, 0xFF, 0xFE,
+    0x3F, 0x72, 0xF9, 0x1A, 0xEA, 0x72, 0xAE, 0xA1, 0xF9, 0x72, 0x9F, 0x09, 0xF7, 0x4F, 0x90, 0x74,
+    0x95, 0xAA, 0xFF, 0xCA, 0x3A, 0xFF, 0xF3, 0x99, 0x99, 0x77, 0x77, 0x77, 0x2A, 0xEA, 0x09, 0xD5,
+    0x9F, 0xEA, 0xD4, 0x9E, 0xAA, 0xAF, 0xC4, 0xE4, 0xAE, 0x3A, 0xD6, 0xE3, 0xDA, 0x6A, 0xD9, 0x2D,
+    0x7A, 0xD9, 0x19, 0xD7, 0x9D, 0xA1, 0x9D, 0x7A, 0xDA, 0x1A, 0xD7, 0xF1, 0x9D, 0x95, 0xAF, 0x2F,
+    0xA9, 0x9A, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0x9F, 0xF9, 0x9D, 0x94, 0xAF, 0xA1, 0x9D,
+    0x90, 0x5A, 0xA6, 0x9A, 0x73, 0xD6, 0xD7, 0x3A, 0xCA, 0x49, 0xD7, 0x4F, 0xFC, 0x75, 0x9F, 0xE9,
+    0x77, 0xAE, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xE9, 0x77, 0x1A, 0xEA, 0x77,
+    0x1F, 0xC7, 0x70, 0x9F, 0xC9, 0x77, 0xAD, 0xAE, 0x77, 0xE0, 0xE7, 0x69, 0xDA, 0x0A, 0xDA, 0x75,
+    0xE9, 0x09, 0xE7, 0x5E, 0x2E, 0x97, 0x3A, 0xDA, 0x2A, 0xDA, 0x73, 0xE9, 0x29, 0xE7, 0x29, 0xE4,
+    0xE9, 0x71, 0xAD, 0xA4, 0xAE, 0x71, 0xE9, 0x49, 0xE7, 0x09, 0xE6, 0xEA, 0x7E, 0xA6, 0xAE, 0x7E,
+    0x97, 0xE9, 0x5A, 0xFF, 0xFF, 0x5F, 0xFF, 0xFC, 0x49, 0xFF, 0xFF, 0xCA, 0x3F, 0xFF, 0xFE, 0x3F,
+    0x72, 0xF9, 0x1A, 0xEA, 0x72, 0xAE, 0xA1, 0xF9, 0x72, 0x9F, 0x09, 0xF7, 0x4F, 0x90, 0x2D, 0x6A,
+    0xC5, 0xD6, 0xD5, 0xAD, 0x4A, 0xCA, 0x6F, 0xFC, 0x79, 0xFE, 0x72, 0x9A, 0xAA, 0x97, 0x77, 0x77,
+    0x77, 0x6A, 0xEA, 0x09, 0xD5, 0x9F, 0xEA, 0xD4, 0x9E, 0xAA, 0xAF, 0xC4, 0xE4, 0xAE, 0x3A, 0xD6,
+    0xE3, 0xDA, 0x6A, 0xD9, 0x2D, 0x7A, 0xD9, 0x19, 0xD7, 0x9D, 0xA1, 0x9D, 0x7A, 0xDA, 0x1A, 0xD7,
+    0xF1, 0x9D, 0x95, 0xAF, 0x2F, 0xA9, 0x9A, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0x9F, 0xF9,
+    0x9D, 0x94, 0xAF, 0xA1, 0x9D, 0x90, 0x71, 0xE9, 0x77, 0x1A, 0xEA, 0x77, 0x1F, 0xC7, 0x70, 0x9F,
+    0xC9, 0x77, 0xAD, 0xAE, 0x77, 0xE0, 0xE7, 0x69, 0xDA, 0x0A, 0xDA, 0x75, 0xE9, 0x09, 0xE7, 0x5E,
+    0x2E, 0x97, 0x3A, 0xDA, 0x2A, 0xDA, 0x73, 0xE9, 0x29, 0xE7, 0x29, 0xE4, 0xE9, 0x71, 0xAD, 0xA4,
+    0xAE, 0x71, 0xE9, 0x49, 0xE7, 0x09, 0xE6, 0xEA, 0x7E, 0xA6, 0xAE, 0x7E, 0x97, 0xE9, 0x5A, 0xFF,
+    0xFF, 0x5F, 0xFF, 0xFC, 0x49, 0xFF, 0xFF, 0xCA, 0x3F, 0xFF, 0xFE, 0x3F, 0x72, 0xF9, 0x1A, 0xEA,
+    0x72, 0xAE, 0xA1, 0xF9, 0x72, 0x9F, 0x09, 0xF7, 0x4F, 0x97, 0x70, 0x9C, 0xA7, 0x72, 0x9C, 0xA7,
+    0x73, 0xCA, 0x77, 0x4C, 0xA7, 0x74, 0xFC, 0x77, 0x29, 0xE7, 0x77, 0x00, 0x77, 0x6A, 0xEA, 0x09,
+    0xD5, 0x9F, 0xEA, 0xD4, 0x9E, 0xAA, 0xAF, 0xC4, 0xE4, 0xAE, 0x3A, 0xD6, 0xE3, 0xDA, 0x6A, 0xD9,
+    0x2D, 0x7A, 0xD9, 0x19, 0xD7, 0x9D, 0xA1, 0x9D, 0x7A, 0xDA, 0x1A, 0xD7, 0xF1, 0x9D, 0x95, 0xAF,
+    0x2F, 0xA9, 0x9A, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0x9F, 0xF9, 0x9D, 0x94, 0xAF, 0xA1,
+    0xE9, 0x73, 0xD7, 0x59, 0xC7, 0x6A, 0xC9, 0x75, 0x9F, 0x97, 0x4A, 0xDA, 0x73, 0xD7, 0x70, 0xAC,
+    0xA7, 0x70, 0xD9, 0x77, 0xAD, 0x77, 0x0D, 0xA7, 0x79, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x59, 0xAF, 0xCA, 0x97, 0x9A, 0xFF, 0xCA, 0x6A, 0xFF, 0xE9, 0x5F, 0xD9,
+    0x99, 0x99, 0xAA, 0x5F, 0xC9, 0x74, 0xFC, 0x75, 0x9F, 0x76, 0xF7, 0x69, 0xEA, 0x76, 0xAE, 0x77,
+    0xF7, 0x7E, 0xA7, 0x69, 0xEA, 0x76, 0x9E, 0xA7, 0x69, 0xF7, 0x69, 0xF9, 0x75, 0x9F, 0xC7, 0x6F,
+    0xDA, 0x70, 0x99, 0x1F, 0xFA, 0xA9, 0x99, 0xAA, 0xDA, 0x1A, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xA2,
+    0x9F, 0xFF, 0xEA, 0x3A, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xCA, 0x6A, 0xFF, 0xAA, 0x97, 0x74, 0x7A,
+    0xA7, 0x29, 0xD7, 0x2D, 0x97, 0x19, 0xD7, 0x2E, 0x71, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x69,
+    0xFD, 0x5F, 0xF4, 0xFA, 0xA9, 0xAA, 0x3A, 0xE7, 0x1E, 0x97, 0x09, 0xE7, 0x19, 0xDA, 0x71, 0xAD,
+    0x97, 0x1A, 0xD9, 0x71, 0x9D, 0xA7, 0x19, 0xE9, 0x71, 0xF9, 0x70, 0xAF, 0xA9, 0x99, 0xA4, 0xFF,
+    0xD4, 0xFF, 0xCA, 0x5A, 0xFC, 0xA9, 0x76, 0x71, 0x99, 0x77, 0x09, 0xD9, 0x77, 0xF7, 0x6D, 0xAE,
+    0x74, 0xD9, 0x19, 0xD7, 0x2C, 0xA5, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xFC,
+    0xA9, 0x79, 0xAF, 0xFC, 0xA6, 0xAF, 0xFE, 0x95, 0xFD, 0x99, 0x99, 0x9A, 0xA5, 0xFC, 0x97, 0x4F,
+    0xC7, 0x59, 0xF7, 0x6F, 0x76, 0x9E, 0xA7, 0x6A, 0xE7, 0x7F, 0x77, 0xEA, 0x76, 0x9E, 0xA7, 0x69,
+    0xEA, 0x76, 0x9F, 0x76, 0x9F, 0x97, 0x59, 0xFC, 0x76, 0xFD, 0xA7, 0x09, 0x91, 0xFF, 0xAA, 0x99,
+    0x9A, 0xAD, 0xA1, 0xAF, 0xFF, 0xFA, 0x2F, 0xFF, 0xFA, 0x29, 0xFF, 0xFE, 0xA3, 0xAF, 0xFF, 0xDA,
+    0x4A, 0xFF, 0xFC, 0xA6, 0xAF, 0xFA, 0xA9, 0x77, 0x40, 0x5D, 0x72, 0xAD, 0xA7, 0x09, 0xF9, 0x69,
+    0xD9, 0x9D, 0x94, 0x9C, 0xA3, 0xAC, 0x92, 0x9C, 0x95, 0x9C, 0x97, 0x77, 0x70, 0x9F, 0xD5, 0xFF,
+    0x4F, 0xAA, 0x9A, 0xA3, 0xAE, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xAD,
+    0x97, 0x19, 0xDA, 0x71, 0x9E, 0x97, 0x1F, 0x97, 0x0A, 0xFA, 0x99, 0x9A, 0x4F, 0xFD, 0x4F, 0xFC,
+    0xA5, 0xAF, 0xCA, 0x97, 0x60, 0x70, 0x9E, 0x77, 0xAE, 0x77, 0xF7, 0x7F, 0x97, 0x6F, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAF, 0xCA, 0x97, 0x9A, 0xFF, 0xCA, 0x6A, 0xFF,
+    0xE9, 0x5F, 0xD9, 0x99, 0x99, 0xAA, 0x5F, 0xC9, 0x74, 0xFC, 0x75, 0x9F, 0x76, 0xF7, 0x69, 0xEA,
+    0x76, 0xAE, 0x77, 0xF7, 0x7E, 0xA7, 0x69, 0xEA, 0x76, 0x9E, 0xA7, 0x69, 0xF7, 0x69, 0xF9, 0x75,
+    0x9F, 0xC7, 0x6F, 0xDA, 0x70, 0x99, 0x1F, 0xFA, 0xA9, 0x99, 0xAA, 0xDA, 0x1A, 0xFF, 0xFF, 0xA2,
+    0xFF, 0xFF, 0xA2, 0x9F, 0xFF, 0xEA, 0x3A, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xCA, 0x6A, 0xFF, 0xAA,
+    0x97, 0x74, 0x5D, 0xA7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1F, 0x97, 0x0F, 0x97, 0x77, 0x77, 0x77, 0x79,
+    0xFD, 0x5F, 0xF4, 0xFA, 0xA9, 0xAA, 0x3A, 0xE7, 0x1E, 0x97, 0x09, 0xE7, 0x19, 0xDA, 0x71, 0xAD,
+    0x97, 0x1A, 0xD9, 0x71, 0x9D, 0xA7, 0x19, 0xE9, 0x71, 0xF9, 0x70, 0xAF, 0xA9, 0x99, 0xA4, 0xFF,
+    0xD4, 0xFF, 0xCA, 0x5A, 0xFC, 0xA9, 0x76, 0x5A, 0x79, 0x97, 0x0A, 0xC9, 0x39, 0xD7, 0x2A, 0xCA,
+    0x1A, 0xD7, 0x4A, 0xFC, 0x76, 0xAE, 0x77, 0x0D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x59, 0xAF, 0xCA, 0x97, 0x9A, 0xFF, 0xCA, 0x6A, 0xFF, 0xE9, 0x5F, 0xD9, 0x99, 0x99,
+    0xAA, 0x5F, 0xC9, 0x74, 0xFC, 0x75, 0x9F, 0x76, 0xF7, 0x69, 0xEA, 0x76, 0xAE, 0x77, 0xF7, 0x7E,
+    0xA7, 0x69, 0xEA, 0x76, 0x9E, 0xA7, 0x69, 0xF7, 0x69, 0xF9, 0x75, 0x9F, 0xC7, 0x6F, 0xDA, 0x70,
+    0x99, 0x1F, 0xFA, 0xA9, 0x99, 0xAA, 0xDA, 0x1A, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xA2, 0x9F, 0xFF,
+    0xEA, 0x3A, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xCA, 0x6A, 0xFF, 0xAA, 0x97, 0x74, 0x1C, 0xA5, 0x9C,
+    0x93, 0xD3, 0xAC, 0x95, 0xD9, 0x9D, 0x97, 0xF9, 0x70, 0x9D, 0xA7, 0x2A, 0xA7, 0x77, 0x77, 0x77,
+    0x71, 0x9F, 0xD5, 0xFF, 0x4F, 0xAA, 0x9A, 0xA3, 0xAE, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0x9D, 0xA7,
+    0x1A, 0xD9, 0x71, 0xAD, 0x97, 0x19, 0xDA, 0x71, 0x9E, 0x97, 0x1F, 0x97, 0x0A, 0xFA, 0x99, 0x9A,
+    0x4F, 0xFD, 0x4F, 0xFC, 0xA5, 0xAF, 0xCA, 0x97, 0x60, 0x77, 0x72, 0xAC, 0x94, 0x9C, 0xA7, 0x4A,
+    0xCA, 0x2A, 0xCA, 0x76, 0xAD, 0x9D, 0xA7, 0x70, 0xAE, 0xA7, 0x72, 0xE7, 0x74, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x09, 0xFF, 0xAA, 0x97, 0x29, 0xFF, 0xFA, 0x70, 0x9F, 0xFF, 0xDA, 0x69,
+    0xFF, 0xFE, 0xA5, 0x9E, 0x59, 0xAF, 0xCA, 0x49, 0xE7, 0x0A, 0xF9, 0x39, 0xE7, 0x1A, 0xF3, 0x9E,
+    0x72, 0xAE, 0xA2, 0x9E, 0x73, 0xF2, 0x9E, 0x73, 0xF9, 0x19, 0xE7, 0x3A, 0xEA, 0x19, 0xE7, 0x39,
+    0xF1, 0x9E, 0x74, 0xF1, 0x9E, 0x74, 0xF1, 0x9E, 0x74, 0xF1, 0x9E, 0x73, 0x9F, 0x19, 0xE7, 0x3F,
+    0xC1, 0x9E, 0x71, 0x9F, 0xD1, 0x9E, 0x99, 0x99, 0x99, 0x99, 0xAF, 0xEA, 0x19, 0xFF, 0xFF, 0xE2,
+    0x9F, 0xFF, 0xFD, 0xA2, 0x9F, 0xFF, 0xFC, 0xA3, 0x9F, 0xFF, 0xFA, 0x49, 0xFF, 0xFD, 0xA6, 0x9F,
+    0xFD, 0xAA, 0x97, 0x00, 0x74, 0xAD, 0x77, 0x2A, 0xD7, 0x72, 0xAD, 0x2A, 0xD7, 0x4A, 0xD2, 0xAC,
+    0xA7, 0x4A, 0xD2, 0xDA, 0x74, 0xE2, 0xDA, 0x74, 0xE2, 0xDA, 0x74, 0xE2, 0xDA, 0x49, 0xF9, 0x1E,
+    0x71, 0xFE, 0xA0, 0xE7, 0x0F, 0xFC, 0xAD, 0xA7, 0xAD, 0xA9, 0x19, 0xFC, 0xA7, 0xDA, 0x5F, 0xA6,
+    0xE6, 0xAE, 0xA6, 0xDA, 0x69, 0xEA, 0x59, 0xD9, 0x69, 0xEA, 0x59, 0xD9, 0x7E, 0x95, 0x9D, 0x96,
+    0x9E, 0x95, 0x9E, 0x6A, 0xE9, 0x59, 0xEA, 0x4A, 0xF9, 0x6F, 0xFF, 0xDA, 0x69, 0xFF, 0xFC, 0xA7,
+    0xAF, 0xFF, 0xA7, 0x0A, 0xFF, 0x0D, 0xA7, 0x2A, 0xFA, 0x1D, 0xA7, 0x77, 0x30, 0x39, 0xFF, 0xAA,
+    0x97, 0x69, 0xFF, 0xFA, 0x74, 0x9F, 0xFF, 0xDA, 0x72, 0x9F, 0xFF, 0xEA, 0x71, 0x9E, 0x59, 0xAF,
+    0xCA, 0x70, 0x9E, 0x70, 0xAF, 0x97, 0x9E, 0x71, 0x9F, 0x79, 0xE7, 0x2A, 0xEA, 0x69, 0xE7, 0x3F,
+    0x69, 0xE7, 0x3F, 0x95, 0x9E, 0x73, 0xAE, 0xA1, 0xAF, 0xFF, 0x95, 0x9F, 0x1A, 0xFF, 0xF9, 0x6F,
+    0x1A, 0xFF, 0xF9, 0x6F, 0x59, 0xE7, 0x4F, 0x59, 0xE7, 0x39, 0xF5, 0x9E, 0x73, 0xFC, 0x59, 0xE7,
+    0x19, 0xFD, 0x59, 0xE9, 0x99, 0x99, 0x99, 0xAA, 0xFE, 0xA5, 0x9F, 0xFF, 0xFE, 0x69, 0xFF, 0xFF,
+    0xDA, 0x69, 0xFF, 0xFF, 0xCA, 0x79, 0xFF, 0xFF, 0xA7, 0x09, 0xFF, 0xFD, 0xA7, 0x29, 0xFF, 0xDA,
+    0xA9, 0x70, 0x74, 0xAD, 0x77, 0x1A, 0xD7, 0x71, 0xAD, 0x77, 0x1A, 0xD7, 0x4F, 0xFF, 0xC7, 0xFF,
+    0xFC, 0x7F, 0xFF, 0xC7, 0x4E, 0x71, 0x9F, 0x91, 0xE7, 0x0F, 0xEA, 0x0E, 0x7F, 0xFC, 0xAD, 0xA6,
+    0xAD, 0xA9, 0x19, 0xFC, 0xA6, 0xDA, 0x5F, 0xA5, 0xE6, 0xAE, 0xA5, 0xDA, 0x69, 0xEA, 0x49, 0xD9,
+    0x69, 0xEA, 0x49, 0xD9, 0x7E, 0x94, 0x9D, 0x96, 0x9E, 0x94, 0x9E, 0x6A, 0xE9, 0x49, 0xEA, 0x4A,
+    0xF9, 0x5F, 0xFF, 0xDA, 0x59, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0xA7, 0xAF, 0xF0, 0xDA, 0x71, 0xAF,
+    0xA1, 0xDA, 0x77, 0x71, 0x74, 0x95, 0xAA, 0xFF, 0xD3, 0x9F, 0xFF, 0x49, 0x99, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xCA, 0x1A, 0xFF, 0xFC, 0xA1, 0xFF, 0xFC, 0xA2, 0xEA,
+    0x97, 0x3E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0xA9, 0x99, 0x9A, 0xAA,
+    0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x94, 0xFF, 0xE9, 0x4E, 0xA7, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97,
+    0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xDA, 0x09, 0xFF, 0xFE, 0x09,
+    0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x90, 0x71, 0x99, 0x99, 0x39, 0xFF, 0xE3, 0xFF, 0xF9, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x59, 0xAE, 0xA7, 0x0F, 0xF9, 0x5E, 0xA3, 0xD9, 0x3E, 0x6D, 0x29, 0xD7,
+    0x9D, 0x1D, 0xA3, 0x99, 0x9A, 0xAD, 0x1F, 0xFF, 0xD9, 0x9F, 0xFF, 0xAA, 0x9A, 0xD9, 0x97, 0x29,
+    0xD9, 0x73, 0x9D, 0xA7, 0x4E, 0xA7, 0x3F, 0xC9, 0x59, 0xA2, 0xFF, 0xFC, 0x29, 0xFF, 0xF3, 0x9F,
+    0xFE, 0x59, 0xAF, 0xAA, 0x20, 0x2D, 0x69, 0xC9, 0x4A, 0xC9, 0x5A, 0xC5, 0x9D, 0x93, 0xAD, 0x6F,
+    0xFC, 0x97, 0xFE, 0x97, 0x19, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0x99, 0x99, 0x1A,
+    0xFF, 0xFC, 0xA1, 0xAF, 0xFF, 0xCA, 0x1F, 0xFF, 0xCA, 0x2E, 0xA9, 0x73, 0xE9, 0x74, 0xE9, 0x74,
+    0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xEA, 0x99, 0x99, 0xAA, 0xA9, 0x4F, 0xFE, 0x94, 0xFF, 0xE9,
+    0x4F, 0xFE, 0x94, 0xEA, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73,
+    0x9F, 0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0xA0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9,
+    0x19, 0xA9, 0x6A, 0xA3, 0x9C, 0xA6, 0xCA, 0x4D, 0x94, 0xD9, 0x4A, 0xFF, 0xC6, 0xAF, 0xE7, 0x09,
+    0xAE, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAE, 0xA7, 0x0F, 0xF9, 0x5E, 0xA3,
+    0xD9, 0x3E, 0x6D, 0x29, 0xD7, 0x9D, 0x1D, 0xA3, 0x99, 0x9A, 0xAD, 0x1F, 0xFF, 0xD9, 0x9F, 0xFF,
+    0xAA, 0x9A, 0xD9, 0x97, 0x29, 0xD9, 0x73, 0x9D, 0xA7, 0x4E, 0xA7, 0x3F, 0xC9, 0x59, 0xA2, 0xFF,
+    0xFC, 0x29, 0xFF, 0xF3, 0x9F, 0xFE, 0x59, 0xAF, 0xAA, 0x20, 0x6A, 0xDA, 0x74, 0xEA, 0x74, 0xF7,
+    0x39, 0xF7, 0x39, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x74, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xCA, 0x1A,
+    0xFF, 0xFC, 0xA1, 0xFF, 0xFC, 0xA2, 0xEA, 0x97, 0x3E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97,
+    0x4E, 0x97, 0x4E, 0xA9, 0x99, 0x9A, 0xAA, 0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x94, 0xFF, 0xE9, 0x4E,
+    0xA7, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xFF, 0xFD, 0x90,
+    0x9F, 0xFF, 0xDA, 0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x90, 0x59, 0xE7, 0x3A,
+    0xE7, 0x3F, 0x73, 0xF9, 0x72, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xEA, 0x70,
+    0xFF, 0x95, 0xEA, 0x3D, 0x93, 0xE6, 0xD2, 0x9D, 0x79, 0xD1, 0xDA, 0x39, 0x99, 0xAA, 0xD1, 0xFF,
+    0xFD, 0x99, 0xFF, 0xFA, 0xA9, 0xAD, 0x99, 0x72, 0x9D, 0x97, 0x39, 0xDA, 0x74, 0xEA, 0x73, 0xFC,
+    0x95, 0x9A, 0x2F, 0xFF, 0xC2, 0x9F, 0xFF, 0x39, 0xFF, 0xE5, 0x9A, 0xFA, 0xA2, 0x72, 0x99, 0x99,
+    0x91, 0xAF, 0xFF, 0xCA, 0x1A, 0xFF, 0xFC, 0xA1, 0xFF, 0xFC, 0xA2, 0xEA, 0x97, 0x3E, 0x97, 0x4E,
+    0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0xA9, 0x99, 0x9A, 0xAA, 0x94, 0xFF, 0xE9, 0x4F,
+    0xFE, 0x94, 0xFF, 0xE9, 0x4E, 0xA7, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x39, 0xE9, 0x73, 0x9E,
+    0x97, 0x39, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xDA, 0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x09, 0xFF,
+    0xFE, 0x96, 0xCA, 0x75, 0xCA, 0x76, 0xCA, 0x76, 0xFC, 0x74, 0x9E, 0x77, 0x60, 0x49, 0xAE, 0xA7,
+    0x0F, 0xF9, 0x5E, 0xA3, 0xD9, 0x3E, 0x6D, 0x29, 0xD7, 0x9D, 0x1D, 0xA3, 0x99, 0x9A, 0xAD, 0x1F,
+    0xFF, 0xD9, 0x9F, 0xFF, 0xAA, 0x99, 0xD9, 0x97, 0x29, 0xD9, 0x73, 0x9D, 0xA7, 0x4E, 0xA7, 0x3A,
+    0xF9, 0x59, 0xA2, 0xFF, 0xFC, 0x29, 0xFF, 0xF4, 0xFF, 0xE5, 0x9A, 0xFC, 0xA9, 0x71, 0xCA, 0x74,
+    0xCA, 0x74, 0xD7, 0x49, 0xC9, 0x74, 0x9C, 0x97, 0x5F, 0xA7, 0x39, 0xAC, 0xA4, 0x2A, 0xC9, 0x5A,
+    0xC6, 0xAC, 0xA3, 0xD7, 0x0A, 0xD0, 0xAD, 0x72, 0xAF, 0x74, 0xAD, 0x97, 0x5A, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x75, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xCA, 0x1A, 0xFF, 0xFC, 0xA1, 0xFF, 0xFC, 0xA2,
+    0xEA, 0x97, 0x3E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0xA9, 0x99, 0x9A,
+    0xAA, 0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x94, 0xFF, 0xE9, 0x4E, 0xA7, 0x4E, 0x97, 0x4E, 0x97, 0x4E,
+    0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xDA, 0x09, 0xFF, 0xFE,
+    0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x90, 0x77, 0x2D, 0x5A, 0xC9, 0x5D, 0x92, 0xD9, 0x7D, 0xAA,
+    0xD9, 0x71, 0xF9, 0x73, 0xDA, 0x74, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9A, 0xEA,
+    0x70, 0xFF, 0x95, 0xEA, 0x3D, 0x93, 0xE6, 0xD2, 0x9D, 0x79, 0xD1, 0xDA, 0x39, 0x99, 0xAA, 0xD1,
+    0xFF, 0xFD, 0x99, 0xFF, 0xFA, 0xA9, 0xAD, 0x99, 0x72, 0x9D, 0x97, 0x39, 0xDA, 0x74, 0xEA, 0x73,
+    0xFC, 0x95, 0x9A, 0x2F, 0xFF, 0xC2, 0x9F, 0xFF, 0x39, 0xFF, 0xE5, 0x9A, 0xFA, 0xA2, 0x77, 0x77,
+    0x1D, 0x97, 0x72, 0xAE, 0x77, 0x1A, 0xFC, 0x77, 0xAC, 0xA1, 0xAD, 0x75, 0xAC, 0x94, 0xD7, 0x49,
+    0x79, 0x97, 0x77, 0x77, 0x77, 0x19, 0xAA, 0xFF, 0x97, 0x0A, 0xFF, 0xFC, 0x69, 0xFF, 0xAA, 0xAA,
+    0xE9, 0x49, 0xFC, 0x97, 0x7F, 0xC7, 0x70, 0xAF, 0x77, 0x1F, 0xA7, 0x71, 0xF7, 0x71, 0x9F, 0x77,
+    0x19, 0xF7, 0x71, 0x9E, 0xA7, 0x71, 0x9E, 0xA7, 0x71, 0x9E, 0xA7, 0xA9, 0x99, 0x59, 0xEA, 0x7A,
+    0xFE, 0xA9, 0x9F, 0x79, 0xFF, 0xA0, 0xF7, 0x29, 0xAF, 0xC0, 0xF9, 0x73, 0xE9, 0x90, 0xFC, 0x73,
+    0xE2, 0xAF, 0xA7, 0x19, 0xE2, 0x9F, 0xDA, 0xA9, 0x99, 0x99, 0xAA, 0xF3, 0xFF, 0xFF, 0xE3, 0x9F,
+    0xFF, 0xFD, 0x49, 0xFF, 0xFF, 0xC5, 0x9F, 0xFF, 0xDA, 0x71, 0x9A, 0xFE, 0xA9, 0x40, 0x77, 0x6D,
+    0x74, 0xEA, 0x72, 0xFC, 0xA7, 0x0D, 0xA1, 0xDA, 0x6D, 0x49, 0xCA, 0x49, 0x97, 0xA7, 0x77, 0x76,
+    0x9E, 0xA9, 0x19, 0xAA, 0x3F, 0xEA, 0x0E, 0x2F, 0xFF, 0xC1, 0x9D, 0xA2, 0x9F, 0xD1, 0xDA, 0x49,
+    0xFC, 0x1D, 0x95, 0xAF, 0x09, 0xD6, 0x9E, 0xA0, 0x9D, 0x7E, 0xA0, 0x9D, 0x7E, 0xA0, 0x9D, 0x69,
+    0xEA, 0x1D, 0x95, 0xFA, 0x1F, 0xAA, 0xAF, 0xDA, 0x19, 0xFF, 0xF9, 0x2F, 0xFF, 0x93, 0xFE, 0xAA,
+    0xD9, 0x49, 0xF9, 0x0E, 0x73, 0x9E, 0x72, 0x9F, 0x3C, 0xA3, 0xAF, 0xA2, 0x9F, 0xFE, 0x3A, 0xFF,
+    0xD9, 0x3A, 0xFF, 0xCA, 0x6A, 0xAF, 0xA5, 0x59, 0xA9, 0x6A, 0xA7, 0x3C, 0xA6, 0xD7, 0x3D, 0x94,
+    0xAC, 0xA7, 0x39, 0xFF, 0xC7, 0x5A, 0xFE, 0x77, 0x9A, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x19, 0xAA, 0xFF, 0x97, 0x0A, 0xFF, 0xFC, 0x69, 0xFF, 0xAA, 0xAA, 0xE9, 0x49, 0xFC,
+    0x97, 0x7F, 0xC7, 0x70, 0xAF, 0x77, 0x1F, 0xA7, 0x71, 0xF7, 0x71, 0x9F, 0x77, 0x19, 0xF7, 0x71,
+    0x9E, 0xA7, 0x71, 0x9E, 0xA7, 0x71, 0x9E, 0xA7, 0xA9, 0x99, 0x59, 0xEA, 0x7A, 0xFE, 0xA9, 0x9F,
+    0x79, 0xFF, 0xA0, 0xF7, 0x29, 0xAF, 0xC0, 0xF9, 0x73, 0xE9, 0x90, 0xFC, 0x73, 0xE2, 0xAF, 0xA7,
+    0x19, 0xE2, 0x9F, 0xDA, 0xA9, 0x99, 0x99, 0xAA, 0xF3, 0xFF, 0xFF, 0xE3, 0x9F, 0xFF, 0xFD, 0x49,
+    0xFF, 0xFF, 0xC5, 0x9F, 0xFF, 0xDA, 0x71, 0x9A, 0xFE, 0xA9, 0x40, 0x1A, 0xC9, 0x6C, 0xA3, 0x9C,
+    0x95, 0x9C, 0x94, 0xD9, 0x39, 0xD5, 0xAF, 0xFA, 0x6A, 0xFD, 0xA7, 0x1A, 0xAA, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x19, 0xEA, 0x91, 0x9A, 0xA3, 0xFE, 0xA0, 0xE2, 0xFF, 0xFC, 0x19, 0xDA, 0x29, 0xFD,
+    0x1D, 0xA4, 0x9F, 0xC1, 0xD9, 0x5A, 0xF0, 0x9D, 0x69, 0xEA, 0x09, 0xD7, 0xEA, 0x09, 0xD7, 0xEA,
+    0x09, 0xD6, 0x9E, 0xA1, 0xD9, 0x5F, 0xA1, 0xFA, 0xAA, 0xFD, 0xA1, 0x9F, 0xFF, 0x92, 0xFF, 0xF9,
+    0x3F, 0xEA, 0xAD, 0x94, 0x9F, 0x90, 0xE7, 0x39, 0xE7, 0x29, 0xF3, 0xCA, 0x3A, 0xFA, 0x29, 0xFF,
+    0xE3, 0xAF, 0xFD, 0x93, 0xAF, 0xFC, 0xA6, 0xAA, 0xFA, 0x50, 0x71, 0x9E, 0x77, 0x29, 0xE7, 0x72,
+    0xAE, 0x97, 0x71, 0xF9, 0x77, 0x1F, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0xAA, 0xFF,
+    0x97, 0x0A, 0xFF, 0xFC, 0x69, 0xFF, 0xAA, 0xAA, 0xE9, 0x49, 0xFC, 0x97, 0x7F, 0xC7, 0x70, 0xAF,
+    0x77, 0x1F, 0xA7, 0x71, 0xF7, 0x71, 0x9F, 0x77, 0x19, 0xF7, 0x71, 0x9E, 0xA7, 0x71, 0x9E, 0xA7,
+    0x71, 0x9E, 0xA7, 0xA9, 0x99, 0x59, 0xEA, 0x7A, 0xFE, 0xA9, 0x9F, 0x79, 0xFF, 0xA0, 0xF7, 0x29,
+    0xAF, 0xC0, 0xF9, 0x73, 0xE9, 0x90, 0xFC, 0x73, 0xE2, 0xAF, 0xA7, 0x19, 0xE2, 0x9F, 0xDA, 0xA9,
+    0x99, 0x99, 0xAA, 0xF3, 0xFF, 0xFF, 0xE3, 0x9F, 0xFF, 0xFD, 0x49, 0xFF, 0xFF, 0xC5, 0x9F, 0xFF,
+    0xDA, 0x71, 0x9A, 0xFE, 0xA9, 0x40, 0x5A, 0xDA, 0x73, 0xAE, 0x73, 0xF7, 0x3F, 0x72, 0x9F, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x09, 0xEA, 0x91, 0x9A, 0xA3, 0xFE, 0xA0, 0xE2, 0xFF, 0xFC, 0x19, 0xDA,
+    0x29, 0xFD, 0x1D, 0xA4, 0x9F, 0xC1, 0xD9, 0x5A, 0xF0, 0x9D, 0x69, 0xEA, 0x09, 0xD7, 0xEA, 0x09,
+    0xD7, 0xEA, 0x09, 0xD6, 0x9E, 0xA1, 0xD9, 0x5F, 0xA1, 0xFA, 0xAA, 0xFD, 0xA1, 0x9F, 0xFF, 0x92,
+    0xFF, 0xF9, 0x3F, 0xEA, 0xAD, 0x94, 0x9F, 0x90, 0xE7, 0x39, 0xE7, 0x29, 0xF3, 0xCA, 0x3A, 0xFA,
+    0x29, 0xFF, 0xE3, 0xAF, 0xFD, 0x93, 0xAF, 0xFC, 0xA6, 0xAA, 0xFA, 0x50, 0x77, 0x75, 0x9A, 0xAF,
+    0xF9, 0x70, 0xAF, 0xFF, 0xC6, 0x9F, 0xFA, 0xAA, 0xAE, 0x94, 0x9F, 0xC9, 0x77, 0xFC, 0x77, 0x0A,
+    0xF7, 0x71, 0xFA, 0x77, 0x1F, 0x77, 0x19, 0xF7, 0x71, 0x9F, 0x77, 0x19, 0xEA, 0x77, 0x19, 0xEA,
+    0x77, 0x19, 0xEA, 0x7A, 0x99, 0x95, 0x9E, 0xA7, 0xAF, 0xEA, 0x99, 0xF7, 0x9F, 0xFA, 0x0F, 0x72,
+    0x9A, 0xFC, 0x0F, 0x97, 0x3E, 0x99, 0x0F, 0xC7, 0x3E, 0x2A, 0xFA, 0x71, 0x9E, 0x29, 0xFD, 0xAA,
+    0x99, 0x99, 0x9A, 0xAF, 0x3F, 0xFF, 0xFE, 0x39, 0xFF, 0xFF, 0xD4, 0x9F, 0xFF, 0xFC, 0x59, 0xFF,
+    0xFD, 0xA7, 0x19, 0xAF, 0xEA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2F, 0xC7, 0x71, 0xFC,
+    0x77, 0x1F, 0xA7, 0x71, 0xF9, 0x77, 0x1F, 0x77, 0x19, 0xF7, 0x71, 0xAE, 0xA7, 0x71, 0xF9, 0x77,
+    0x09, 0xF7, 0x10, 0x77, 0x59, 0xFA, 0x71, 0x9F, 0x97, 0x1A, 0xF7, 0x2A, 0xEA, 0x72, 0xAE, 0x97,
+    0x2F, 0x72, 0x9F, 0x72, 0xFA, 0x77, 0x77, 0x71, 0x9E, 0xA9, 0x19, 0xAA, 0x3F, 0xEA, 0x0E, 0x2F,
+    0xFF, 0xC1, 0x9D, 0xA2, 0x9F, 0xD1, 0xDA, 0x49, 0xFC, 0x1D, 0x95, 0xAF, 0x09, 0xD6, 0x9E, 0xA0,
+    0x9D, 0x7E, 0xA0, 0x9D, 0x7E, 0xA0, 0x9D, 0x69, 0xEA, 0x1D, 0x95, 0xFA, 0x1F, 0xAA, 0xAF, 0xDA,
+    0x19, 0xFF, 0xF9, 0x2F, 0xFF, 0x93, 0xFE, 0xAA, 0xD9, 0x49, 0xF9, 0x0E, 0x73, 0x9E, 0x72, 0x9F,
+    0x3C, 0xA3, 0xAF, 0xA2, 0x9F, 0xFE, 0x3A, 0xFF, 0xD9, 0x3A, 0xFF, 0xCA, 0x6A, 0xAF, 0xA5, 0x71,
+    0xA9, 0x77, 0x1E, 0x77, 0x0A, 0xF7, 0x6A, 0xD0, 0xAD, 0x74, 0xAC, 0x92, 0x9D, 0x72, 0xAC, 0x6A,
+    0xC7, 0x77, 0x77, 0x79, 0xAA, 0x97, 0x29, 0xAA, 0x91, 0xEA, 0x72, 0xEA, 0x1E, 0xA7, 0x2F, 0x1E,
+    0xA7, 0x2F, 0x1F, 0x72, 0xF1, 0xF7, 0x2F, 0x1F, 0x72, 0xF1, 0xF7, 0x2F, 0x1F, 0x72, 0xF1, 0xF7,
+    0x2F, 0x1F, 0x72, 0xF1, 0xF7, 0x2F, 0x1F, 0x72, 0xF1, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xF1,
+    0xFF, 0xFF, 0xE9, 0x0F, 0xFF, 0xFE, 0x90, 0xFF, 0xFF, 0xE9, 0x9F, 0xFF, 0xFE, 0x99, 0xFF, 0xFF,
+    0xE9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xFA, 0x9F, 0x97, 0x09,
+    0xFA, 0x9F, 0x97, 0x0A, 0xFA, 0x9F, 0xA7, 0x0A, 0xFA, 0x4A, 0xC9, 0x77, 0xE7, 0x6F, 0xC7, 0x4D,
+    0x90, 0xAD, 0x72, 0xD3, 0x9D, 0x70, 0xAA, 0x6A, 0xA7, 0x3E, 0x77, 0xE7, 0x7D, 0xA7, 0x7D, 0xA7,
+    0x7D, 0xA7, 0x7D, 0xA7, 0x7D, 0x97, 0x69, 0xD9, 0x76, 0x9D, 0x97, 0x69, 0xD9, 0x0A, 0xFA, 0x7A,
+    0xDA, 0xFF, 0x95, 0xAF, 0xFF, 0x5A, 0xFA, 0x29, 0xE9, 0x4A, 0xE9, 0x49, 0xDA, 0x4F, 0x6E, 0x4E,
+    0xA6, 0xAD, 0x4E, 0x96, 0xAD, 0x4E, 0x96, 0xAD, 0x4E, 0x96, 0xAD, 0x4E, 0x96, 0xE4, 0xE9, 0x6E,
+    0x39, 0xE9, 0x6E, 0x92, 0x9E, 0x96, 0xE9, 0x29, 0xEA, 0x59, 0xE9, 0x2A, 0xEA, 0x59, 0xE9, 0x2A,
+    0xDA, 0x72, 0xAD, 0xA4, 0xEA, 0x72, 0xEA, 0x4E, 0xA7, 0x2F, 0x4E, 0xA7, 0x2F, 0x4F, 0x72, 0xF4,
+    0xF7, 0x2F, 0x4F, 0x72, 0xF4, 0xF7, 0x2F, 0x2F, 0xFF, 0xFF, 0xD9, 0x0F, 0xFF, 0xFF, 0xD1, 0xAA,
+    0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0x3F, 0x72, 0xF4, 0xF7, 0x2F, 0x4F, 0xFF, 0xFE, 0x4F,
+    0xFF, 0xFE, 0x93, 0xFF, 0xFF, 0xE9, 0x29, 0xFF, 0xFF, 0xE9, 0x29, 0xFF, 0xFF, 0xE9, 0x29, 0xFA,
+    0x99, 0x99, 0x99, 0x99, 0x9A, 0xF9, 0x29, 0xF9, 0x70, 0x9F, 0x92, 0x9F, 0x97, 0x09, 0xFA, 0x29,
+    0xF9, 0x70, 0x9F, 0xA2, 0x9F, 0x97, 0x0A, 0xFA, 0x29, 0xFA, 0x70, 0xAF, 0xA0, 0x4E, 0x77, 0xE7,
+    0x7D, 0xA7, 0x7F, 0xE6, 0xAF, 0xFD, 0xA6, 0xAF, 0xDA, 0x77, 0xD9, 0x76, 0x9D, 0x97, 0x69, 0xD9,
+    0x76, 0x9D, 0x90, 0xAF, 0xA7, 0xAD, 0xAF, 0xF9, 0x5A, 0xFF, 0xF5, 0xAF, 0xA2, 0x9E, 0x94, 0xAE,
+    0x94, 0x9D, 0xA4, 0xF6, 0xE4, 0xEA, 0x6A, 0xD4, 0xE9, 0x6A, 0xD4, 0xE9, 0x6A, 0xD4, 0xE9, 0x6A,
+    0xD4, 0xE9, 0x6E, 0x4E, 0x96, 0xE3, 0x9E, 0x96, 0xE9, 0x29, 0xE9, 0x6E, 0x92, 0x9E, 0xA5, 0x9E,
+    0x92, 0xAE, 0xA5, 0x9E, 0x90, 0x19, 0x93, 0x9A, 0x1F, 0x29, 0xC0, 0xAC, 0x90, 0xCA, 0x19, 0xC0,
+    0xD1, 0x9C, 0x90, 0xD0, 0xD2, 0xAE, 0xA0, 0x94, 0x9A, 0xA7, 0x77, 0x77, 0x77, 0x39, 0x99, 0x96,
+    0xAE, 0x95, 0xAE, 0x95, 0xAE, 0x95, 0x9E, 0x95, 0x9E, 0x95, 0x9E, 0x95, 0x9E, 0x95, 0x9E, 0x95,
+    0x9E, 0x95, 0x9E, 0x95, 0x9E, 0x95, 0x9E, 0x95, 0x9E, 0x95, 0x9E, 0xA5, 0x9E, 0xA5, 0x9E, 0xA5,
+    0x9E, 0xA5, 0x9F, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xFC, 0x5F, 0xC5, 0xFC, 0x20, 0x1D, 0xA3, 0xCA,
+    0x0D, 0xAD, 0x2C, 0xA0, 0xCA, 0x1D, 0x1C, 0x99, 0xC9, 0x19, 0xF0, 0x9C, 0x93, 0xAA, 0x97, 0x77,
+    0x77, 0x70, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xE7,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE9, 0x59, 0xE9, 0x20, 0x72, 0x99, 0x19, 0xAF, 0xFD, 0x1F, 0xFF,
+    0x90, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xE9, 0x70, 0xAE, 0x97, 0x0A, 0xE9, 0x70,
+    0xAE, 0x97, 0x09, 0xE9, 0x70, 0x9E, 0x97, 0x09, 0xE9, 0x70, 0x9E, 0x97, 0x09, 0xE9, 0x70, 0x9E,
+    0x97, 0x09, 0xE9, 0x70, 0x9E, 0x97, 0x09, 0xE9, 0x70, 0x9E, 0x97, 0x09, 0xEA, 0x70, 0x9E, 0xA7,
+    0x09, 0xEA, 0x70, 0x9E, 0xA7, 0x09, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0F, 0xC7, 0x0F,
+    0xC7, 0x0F, 0xC3, 0x70, 0x99, 0x92, 0xFF, 0xEA, 0x09, 0xFF, 0xF7, 0x77, 0x77, 0x77, 0x59, 0xD7,
+    0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xCA, 0x72, 0xAC, 0xA7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2E,
+    0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x97, 0x09, 0xE9, 0x40, 0x1A, 0xAA, 0xA1,
+    0x9F, 0x2E, 0xA2, 0xEA, 0x2E, 0xA2, 0xEA, 0x2E, 0xA2, 0xEA, 0x2E, 0xA2, 0xEA, 0x2E, 0xA2, 0xF2,
+    0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF9, 0x1F, 0x90, 0x9F, 0x90, 0x9F, 0x90, 0x9F, 0xA0,
+    0xAF, 0xA1, 0xAC, 0x39, 0xC9, 0x3C, 0xA4, 0xCA, 0x4A, 0xF2, 0x9A, 0xD0, 0x1A, 0xD9, 0x2E, 0xA2,
+    0xEA, 0x19, 0xF1, 0xAF, 0x77, 0x77, 0x99, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAC, 0xA3, 0xAC, 0xA3,
+    0xAD, 0x3A, 0xD3, 0xAD, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x91, 0x9E, 0x91, 0x9C, 0x93,
+    0xCA, 0x3A, 0xC4, 0xD4, 0x9F, 0x3A, 0xD9, 0x00, 0x09, 0xE2, 0xAE, 0x2F, 0x2F, 0x91, 0xF9, 0x77,
+    0x77, 0x73, 0xAA, 0xAA, 0x91, 0xAE, 0x91, 0xAE, 0x91, 0xAE, 0x91, 0x9E, 0x91, 0x9E, 0x91, 0x9E,
+    0x91, 0x9E, 0x91, 0x9E, 0x91, 0x9E, 0x91, 0x9E, 0x91, 0x9E, 0x91, 0x9E, 0x91, 0x9E, 0x91, 0x9E,
+    0xA1, 0x9E, 0xA1, 0x9E, 0xA1, 0x9E, 0xA1, 0x9F, 0x1A, 0xF1, 0xAF, 0x1A, 0xF1, 0xFC, 0x1F, 0xC1,
+    0xFC, 0x00, 0x5A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAC, 0xA1, 0xAC, 0xA1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1E,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x99, 0xE9, 0xAA, 0xAA, 0x97, 0xAA, 0xAA, 0x0A, 0xE9, 0x7F,
+    0x0A, 0xE9, 0x7F, 0x0A, 0xE9, 0x7F, 0x09, 0xE9, 0x7F, 0x09, 0xE9, 0x7F, 0x09, 0xE9, 0x7F, 0x09,
+    0xE9, 0x7F, 0x09, 0xE9, 0x7F, 0x09, 0xE9, 0x7F, 0x09, 0xE9, 0x7F, 0x09, 0xE9, 0x7F, 0x09, 0xE9,
+    0x7E, 0xA0, 0x9E, 0x96, 0x9E, 0xA0, 0x9E, 0xA6, 0x9E, 0xA0, 0x9E, 0xA6, 0x9E, 0xA0, 0x9E, 0xA6,
+    0x9E, 0xA0, 0x9E, 0xA6, 0x9E, 0x90, 0x9F, 0x69, 0xE9, 0x0A, 0xF6, 0x9E, 0x90, 0xAF, 0x69, 0xE9,
+    0x0A, 0xF6, 0xAE, 0x90, 0xFC, 0x6A, 0xE1, 0xFC, 0x6A, 0xE1, 0xFC, 0x6F, 0x74, 0x9F, 0x70, 0x91,
+    0xAF, 0xC7, 0x9F, 0xF9, 0x79, 0xFF, 0x70, 0xAF, 0xE9, 0x70, 0xAF, 0xDA, 0x71, 0xAF, 0xA5, 0x0A,
+    0xD9, 0x77, 0x1E, 0xA7, 0x71, 0xEA, 0x73, 0xE9, 0x09, 0xF7, 0x3E, 0xA0, 0xAF, 0x73, 0xEA, 0x77,
+    0x09, 0xF7, 0x70, 0xAF, 0x77, 0x77, 0x76, 0x99, 0x77, 0x2A, 0xD7, 0x49, 0xD9, 0x1A, 0xD7, 0x4A,
+    0xD2, 0xAD, 0x74, 0xAD, 0x2A, 0xCA, 0x74, 0xAD, 0x2A, 0xCA, 0x74, 0xAD, 0x2A, 0xD7, 0x4A, 0xD2,
+    0xAD, 0x74, 0xAD, 0x2A, 0xD7, 0x4A, 0xD2, 0xE7, 0x4A, 0xD2, 0xE7, 0x4A, 0xD2, 0xE7, 0x4E, 0x2E,
+    0x74, 0xDA, 0x2E, 0x74, 0xDA, 0x2E, 0x74, 0xDA, 0x2E, 0x97, 0x3D, 0xA1, 0x9E, 0x97, 0x3D, 0x97,
+    0x72, 0xD9, 0x77, 0x19, 0xD9, 0x77, 0x1E, 0x97, 0x70, 0xAE, 0x75, 0x9F, 0xE7, 0x5F, 0xE7, 0x59,
+    0xFA, 0x97, 0x77, 0x20, 0x77, 0x2D, 0x71, 0xAE, 0x7A, 0xFA, 0x5A, 0xCA, 0x1A, 0xCA, 0x3A, 0xC9,
+    0x39, 0xCA, 0x19, 0xA3, 0x9A, 0xAA, 0xC9, 0x6A, 0xE9, 0x7A, 0xE9, 0x7F, 0x97, 0xF9, 0x7F, 0x70,
+    0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0E, 0xA7, 0x0E,
+    0xA7, 0x0E, 0xA7, 0x9E, 0xA7, 0x9E, 0xA7, 0x9E, 0x97, 0x9E, 0x97, 0x9E, 0x97, 0x9E, 0x97, 0xAE,
+    0x70, 0xF3, 0x91, 0x9F, 0xC2, 0x9F, 0xFA, 0x29, 0xFF, 0x92, 0x9F, 0xEA, 0x39, 0xFD, 0xA4, 0x9F,
+    0xA9, 0x77, 0x20, 0x7A, 0x97, 0x3E, 0x72, 0xAF, 0x70, 0xAD, 0x0A, 0xD6, 0xAC, 0xA2, 0x9D, 0x4A,
+    0xC6, 0xAC, 0x77, 0x77, 0x59, 0xD9, 0x72, 0x9D, 0x97, 0x29, 0xD7, 0x39, 0xD7, 0x3A, 0xD7, 0x3A,
+    0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xCA, 0x73,
+    0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x72, 0x9D, 0x97, 0x2E, 0x97, 0x09, 0xF6, 0x9F, 0xE6,
+    0xFE, 0x69, 0xEA, 0xA9, 0x77, 0x60, 0x19, 0xE4, 0x9F, 0x59, 0xE4, 0xF9, 0x5A, 0xE3, 0x9E, 0xA6,
+    0xAE, 0x3F, 0x7A, 0xE2, 0xAE, 0xA7, 0xF1, 0x9F, 0x70, 0xEA, 0x1F, 0x97, 0x0E, 0xA0, 0x9E, 0xA7,
+    0x1E, 0xA0, 0xF7, 0x2E, 0xAA, 0xEA, 0x72, 0xFF, 0x72, 0x9F, 0xE9, 0x72, 0x9F, 0xDA, 0x73, 0x9F,
+    0xD9, 0x73, 0xAF, 0xE7, 0x3A, 0xFF, 0x72, 0xAF, 0xFC, 0x71, 0xF0, 0xFD, 0x70, 0xF1, 0xFD, 0x7F,
+    0x19, 0xFD, 0x6F, 0x2A, 0xFD, 0x5F, 0x3F, 0xE3, 0x9F, 0x4F, 0xE2, 0x9F, 0x49, 0xFE, 0x19, 0xF5,
+    0xAF, 0xE7, 0x77, 0x77, 0x5F, 0xC7, 0x6F, 0xC7, 0x6F, 0xA7, 0x6F, 0x97, 0x6F, 0x76, 0x9E, 0xA7,
+    0x6F, 0x97, 0x6F, 0x73, 0x77, 0x09, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xD9, 0x73, 0xAD, 0x97, 0x3A,
+    0xD9, 0x73, 0xAD, 0x97, 0x3A, 0xD7, 0x4A, 0xD7, 0x4E, 0x2A, 0xE5, 0xE1, 0x9E, 0x6E, 0x09, 0xE7,
+    0xE0, 0xE9, 0x7F, 0xDA, 0x70, 0xFD, 0x71, 0xFC, 0xA7, 0x1F, 0xDA, 0x70, 0xEA, 0xEA, 0x69, 0xE0,
+    0xFA, 0x59, 0xE1, 0xFA, 0x49, 0xE1, 0x9F, 0xA3, 0x9E, 0x2A, 0xFA, 0x29, 0xE3, 0xFC, 0xA1, 0xAE,
+    0x4F, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x74, 0xFC, 0x72, 0xFA, 0x71, 0x9F, 0x72, 0x9F, 0x72, 0x9E,
+    0xA7, 0x2F, 0x97, 0x2F, 0x72, 0xAF, 0x70, 0x19, 0x93, 0x99, 0x39, 0xD2, 0xDA, 0x39, 0xD1, 0xAD,
+    0x49, 0xD1, 0xD9, 0x4A, 0xCA, 0x0E, 0x5A, 0xCA, 0x9D, 0x95, 0xAC, 0xAD, 0xA6, 0xFC, 0x7F, 0x97,
+    0xFC, 0x7F, 0xD6, 0xD9, 0xF5, 0xD9, 0x0F, 0x39, 0xD9, 0x09, 0xEA, 0x29, 0xD2, 0xAE, 0xA1, 0x9D,
+    0x3F, 0xA0, 0x3A, 0xA7, 0x4A, 0xC9, 0x74, 0xD7, 0x4A, 0xD7, 0x4D, 0x97, 0x3A, 0xD7, 0x77, 0x77,
+    0x77, 0x77, 0x49, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7,
+    0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3E, 0xA7, 0x3E, 0xA7,
+    0x3E, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x29, 0xFA, 0xAA, 0xAA, 0xFD, 0x9F, 0xFF, 0xE9,
+    0xFF, 0xFE, 0x9F, 0xFF, 0xE9, 0xFF, 0xFE, 0x49, 0xCA, 0x5D, 0x59, 0xD5, 0xD9, 0x49, 0xD5, 0xAA,
+    0xA7, 0x77, 0x77, 0x09, 0x99, 0x5A, 0xD5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE4, 0x9D, 0xA4, 0x9D, 0xA4,
+    0x9D, 0x94, 0x9D, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xE9, 0x4E,
+    0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4F, 0xE1, 0xFE, 0x1A, 0xFD, 0x00, 0x1A, 0xAA, 0x73, 0x9E, 0x73,
+    0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0xAE, 0x73, 0xAE, 0x73, 0xAE, 0x73, 0xAE, 0x73, 0xAE, 0x73,
+    0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x73,
+    0xEA, 0x72, 0x9F, 0xAA, 0xAA, 0xAF, 0xD9, 0xFF, 0xFE, 0x9F, 0xFF, 0xE9, 0xFF, 0xFE, 0x9F, 0xFF,
+    0xE7, 0x77, 0x77, 0x77, 0x77, 0x75, 0xFC, 0x72, 0xFA, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0x9E, 0xA7,
+    0x2A, 0xE9, 0x72, 0xF7, 0x29, 0xF6, 0x19, 0x99, 0x5A, 0xD5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE4, 0x9D,
+    0xA4, 0x9D, 0xA4, 0x9D, 0x94, 0x9D, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD,
+    0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4F, 0xE1, 0xFE, 0x1A, 0xFD, 0x77, 0x77, 0x69,
+    0xFA, 0x29, 0xF9, 0x2A, 0xF3, 0xAE, 0xA3, 0xAE, 0x93, 0xF3, 0x9F, 0x3F, 0xA2, 0x1A, 0xAA, 0x73,
+    0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0xAE, 0x73, 0xAE, 0x59, 0xD2, 0xAE, 0x5A, 0xD2,
+    0xAE, 0x5A, 0xCA, 0x2A, 0xE5, 0xDA, 0x2F, 0x5D, 0xA2, 0xF5, 0xDA, 0x2F, 0x73, 0xF7, 0x3E, 0xA7,
+    0x3E, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x29, 0xFA, 0xAA, 0xAA, 0xFD, 0x9F,
+    0xFF, 0xE9, 0xFF, 0xFE, 0x9F, 0xFF, 0xE9, 0xFF, 0xFE, 0x70, 0xDA, 0x19, 0xD3, 0xD9, 0x1A, 0xD3,
+    0xD9, 0x1E, 0x3D, 0x91, 0xE2, 0x9D, 0x91, 0xE2, 0x9D, 0x91, 0xE7, 0x0D, 0xA7, 0x9D, 0xA7, 0x9D,
+    0xA7, 0x9D, 0x97, 0x9D, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0xE9,
+    0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7F, 0xE4, 0xFE, 0x4A, 0xFD, 0x30, 0x09, 0xE7, 0x39, 0xE7,
+    0x39, 0xE7, 0x39, 0xE7, 0x3A, 0xE7, 0x3A, 0xE5, 0xAD, 0x2A, 0xE5, 0xE9, 0x1A, 0xE4, 0x9E, 0xA1,
+    0xAE, 0x4A, 0xEA, 0x1A, 0xE4, 0xFC, 0x1F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3E, 0xA7, 0x3E, 0xA7,
+    0x3E, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x29, 0xFA, 0xAA, 0xAA, 0xFD, 0x9F, 0xFF, 0xE9,
+    0xFF, 0xFE, 0x9F, 0xFF, 0xE9, 0xFF, 0xFE, 0x19, 0xD7, 0x1A, 0xD7, 0x1E, 0x71, 0xE7, 0x1E, 0x71,
+    0xE7, 0x1D, 0xA3, 0xE1, 0x9D, 0xA2, 0x9E, 0x19, 0xDA, 0x2A, 0xE9, 0x09, 0xD9, 0x2F, 0x90, 0x9D,
+    0x92, 0xFA, 0x0A, 0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70, 0xE9,
+    0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xFE, 0x5F, 0xE5, 0xAF, 0xD4, 0x77, 0x77,
+    0x77, 0x4A, 0xC9, 0x77, 0x7D, 0xA7, 0x77, 0xAD, 0x77, 0x70, 0xD9, 0x77, 0x7E, 0x77, 0x79, 0xD9,
+    0x77, 0x0A, 0xAA, 0x3D, 0xA7, 0x70, 0x9E, 0x2A, 0xD7, 0x71, 0x9E, 0x19, 0xDA, 0x77, 0x19, 0xE1,
+    0xE7, 0x72, 0x9E, 0x09, 0xD9, 0x77, 0x2A, 0xE0, 0xE7, 0x73, 0xAE, 0xAD, 0x77, 0x4A, 0xFC, 0xA7,
+    0x74, 0xAF, 0xC7, 0x75, 0xAF, 0x97, 0x75, 0xFC, 0x77, 0x6F, 0x77, 0x7F, 0x77, 0x7F, 0x77, 0x6A,
+    0xEA, 0x77, 0x59, 0xFA, 0x77, 0x5F, 0xCA, 0x77, 0x4A, 0xFC, 0xA7, 0x74, 0xFD, 0xA7, 0x73, 0xEA,
+    0xEA, 0x77, 0x29, 0xE9, 0xFA, 0xAA, 0xAA, 0xFD, 0x7E, 0x99, 0xFF, 0xFE, 0x6A, 0xE0, 0x9F, 0xFF,
+    0xE6, 0xE1, 0x9F, 0xFF, 0xE5, 0xEA, 0x19, 0xFF, 0xFE, 0x49, 0xE7, 0x77, 0xE9, 0x77, 0x6A, 0xE7,
+    0x76, 0x9E, 0x77, 0x7E, 0xA7, 0x76, 0xAE, 0x77, 0x7D, 0xA9, 0x77, 0x6A, 0xA7, 0x77, 0x77, 0x74,
+    0x72, 0x99, 0x97, 0x7A, 0xD7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7D, 0xA7, 0x69, 0xDA, 0x76,
+    0x9D, 0xA7, 0x69, 0xD9, 0x76, 0x9D, 0x91, 0xA9, 0x72, 0xAD, 0xAA, 0xDA, 0x72, 0xAF, 0xA7, 0x39,
+    0xEA, 0x73, 0x9F, 0xC9, 0x71, 0x9F, 0xE9, 0x79, 0xF9, 0x0E, 0x95, 0x9F, 0x92, 0xE9, 0x79, 0x94,
+    0xE9, 0x76, 0xE9, 0x76, 0xE9, 0x76, 0xFE, 0x73, 0xFE, 0x73, 0xAF, 0xD1, 0x73, 0x9A, 0x97, 0x71,
+    0xD7, 0x71, 0x9D, 0x77, 0x1D, 0x97, 0x70, 0x9D, 0x77, 0x1E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x74, 0xAD, 0xA1, 0xAE, 0xA7, 0x1F, 0x1A, 0xF7, 0x1E, 0xA1, 0xFC, 0xA7, 0x0E, 0xA1, 0xFD, 0x70,
+    0xEA, 0x1F, 0xDA, 0x7E, 0xA1, 0xFE, 0x69, 0xEA, 0x1F, 0xEA, 0x59, 0xE9, 0x1E, 0xAF, 0x59, 0xE9,
+    0x1E, 0xAA, 0xE9, 0x4A, 0xE9, 0x09, 0xEA, 0x0F, 0x4A, 0xE9, 0x09, 0xEA, 0x0A, 0xE9, 0x3A, 0xE9,
+    0x09, 0xEA, 0x1F, 0x3F, 0x1A, 0xEA, 0x1A, 0xE9, 0x2F, 0x1A, 0xEA, 0x2F, 0x2F, 0x1A, 0xEA, 0x2A,
+    0xE9, 0x1F, 0x1F, 0xC3, 0xEA, 0x1F, 0x1F, 0xC3, 0xAE, 0x1F, 0x1F, 0xC3, 0x9E, 0xA9, 0xF1, 0xFC,
+    0x4F, 0x9F, 0x1F, 0xC4, 0x9F, 0xF1, 0xFC, 0x5F, 0xEA, 0x09, 0xFC, 0x59, 0xFD, 0xA0, 0x9F, 0xC6,
+    0xFD, 0xA0, 0x9F, 0xC6, 0x9F, 0xCA, 0x00, 0x71, 0xAA, 0x74, 0xAC, 0xA7, 0x4D, 0x74, 0xAD, 0x74,
+    0xD9, 0x73, 0xAD, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x99, 0x96, 0x9D, 0x0A, 0xFC, 0xA4, 0x9F,
+    0xFE, 0x3A, 0xF9, 0x2A, 0xDA, 0x2A, 0xE9, 0x4E, 0x2A, 0xE5, 0xAD, 0x91, 0xE9, 0x59, 0xD9, 0x1E,
+    0x95, 0x9D, 0xA1, 0xE9, 0x59, 0xDA, 0x1E, 0x95, 0x9E, 0x1E, 0x95, 0xAE, 0x1E, 0xA5, 0xAE, 0x1E,
+    0xA5, 0xAE, 0x09, 0xEA, 0x5A, 0xE0, 0x9E, 0xA5, 0xAE, 0x09, 0xEA, 0x5A, 0xE0, 0xAF, 0x5A, 0xE9,
+    0x77, 0x0A, 0xAA, 0xA1, 0x9E, 0xA7, 0x1F, 0x1A, 0xF7, 0x1F, 0x1A, 0xFA, 0x70, 0xEA, 0x1F, 0xD7,
+    0x0E, 0xA1, 0xFD, 0xA7, 0xEA, 0x1F, 0xE6, 0x9E, 0xA1, 0xFE, 0x95, 0x9E, 0x91, 0xEA, 0xF5, 0x9E,
+    0x91, 0xEA, 0xAE, 0x94, 0xAE, 0x90, 0x9E, 0xA0, 0xF4, 0xAE, 0x90, 0x9E, 0xA0, 0xAE, 0x93, 0xAE,
+    0x90, 0x9E, 0xA1, 0xF3, 0xF1, 0xAE, 0xA1, 0xAE, 0x92, 0xF1, 0xAE, 0xA2, 0xF2, 0xF1, 0xAE, 0xA2,
+    0xAE, 0x91, 0xF1, 0xFC, 0x3E, 0xA1, 0xF1, 0xFC, 0x3F, 0x1F, 0x1F, 0xC3, 0x9E, 0xA9, 0xF1, 0xFC,
+    0x4F, 0x9F, 0x1F, 0xC4, 0x9F, 0xF1, 0xFC, 0x5F, 0xEA, 0x09, 0xFC, 0x59, 0xFD, 0xA0, 0x9F, 0xC6,
+    0xFD, 0xA0, 0x9F, 0xC6, 0x9F, 0xCA, 0x77, 0x77, 0x77, 0x2F, 0xA7, 0x69, 0xF9, 0x76, 0x9F, 0x77,
+    0xAF, 0x77, 0xAE, 0xA7, 0x7F, 0x97, 0x69, 0xF7, 0x7A, 0xEA, 0x71, 0x69, 0x99, 0x69, 0xD0, 0xAF,
+    0xCA, 0x49, 0xFF, 0xE3, 0xAF, 0x92, 0xAD, 0xA2, 0xAE, 0x94, 0xE2, 0xAE, 0x5A, 0xD9, 0x1E, 0x95,
+    0x9D, 0x91, 0xE9, 0x59, 0xDA, 0x1E, 0x95, 0x9D, 0xA1, 0xE9, 0x59, 0xE1, 0xE9, 0x5A, 0xE1, 0xEA,
+    0x5A, 0xE1, 0xEA, 0x5A, 0xE0, 0x9E, 0xA5, 0xAE, 0x09, 0xEA, 0x5A, 0xE0, 0x9E, 0xA5, 0xAE, 0x0A,
+    0xF5, 0xAE, 0x97, 0x77, 0x74, 0xFC, 0x72, 0xFC, 0x72, 0xFA, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xEA,
+    0x72, 0xF9, 0x72, 0xF7, 0x77, 0x72, 0xAC, 0x94, 0x9C, 0xA7, 0x2A, 0xCA, 0x2A, 0xCA, 0x74, 0xAD,
+    0x9D, 0xA7, 0x6A, 0xEA, 0x77, 0x0E, 0x77, 0x2A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0xAA, 0xAA,
+    0x19, 0xEA, 0x71, 0xF1, 0xAF, 0x71, 0xF1, 0xAF, 0xA7, 0x0E, 0xA1, 0xFD, 0x70, 0xEA, 0x1F, 0xDA,
+    0x7E, 0xA1, 0xFE, 0x69, 0xEA, 0x1F, 0xE9, 0x59, 0xE9, 0x1E, 0xAF, 0x59, 0xE9, 0x1E, 0xAA, 0xE9,
+    0x4A, 0xE9, 0x09, 0xEA, 0x0F, 0x4A, 0xE9, 0x09, 0xEA, 0x0A, 0xE9, 0x3A, 0xE9, 0x09, 0xEA, 0x1F,
+    0x3F, 0x1A, 0xEA, 0x1A, 0xE9, 0x2F, 0x1A, 0xEA, 0x2F, 0x2F, 0x1A, 0xEA, 0x2A, 0xE9, 0x1F, 0x1F,
+    0xC3, 0xEA, 0x1F, 0x1F, 0xC3, 0xF1, 0xF1, 0xFC, 0x39, 0xEA, 0x9F, 0x1F, 0xC4, 0xF9, 0xF1, 0xFC,
+    0x49, 0xFF, 0x1F, 0xC5, 0xFE, 0xA0, 0x9F, 0xC5, 0x9F, 0xDA, 0x09, 0xFC, 0x6F, 0xDA, 0x09, 0xFC,
+    0x69, 0xFC, 0xA0, 0x29, 0xA7, 0xA5, 0xD9, 0x39, 0xCA, 0x6D, 0xA1, 0xDA, 0x70, 0xFC, 0xA7, 0x2E,
+    0xA7, 0x4D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0x99, 0x96, 0x9D, 0x0A, 0xFC, 0xA4, 0x9F, 0xFE,
+    0x3A, 0xF9, 0x2A, 0xDA, 0x2A, 0xE9, 0x4E, 0x2A, 0xE5, 0xAD, 0x91, 0xE9, 0x59, 0xD9, 0x1E, 0x95,
+    0x9D, 0xA1, 0xE9, 0x59, 0xDA, 0x1E, 0x95, 0x9E, 0x1E, 0x95, 0xAE, 0x1E, 0xA5, 0xAE, 0x1E, 0xA5,
+    0xAE, 0x09, 0xEA, 0x5A, 0xE0, 0x9E, 0xA5, 0xAE, 0x09, 0xEA, 0x5A, 0xE0, 0xAF, 0x5A, 0xE9, 0x71,
+    0xAD, 0x73, 0xE9, 0x72, 0xEA, 0x72, 0xEA, 0x72, 0xF7, 0x2D, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x75, 0x99, 0x96, 0xAC, 0xA0, 0xAF, 0xCA, 0x4A, 0xFF, 0xE3, 0xAF, 0x92, 0xE9, 0x2F,
+    0x5E, 0x2E, 0xA5, 0xAD, 0x2E, 0x95, 0xAD, 0x91, 0xE9, 0x5A, 0xDA, 0x1E, 0x95, 0xAD, 0xA1, 0xE9,
+    0x5A, 0xDA, 0x1E, 0x95, 0xAD, 0xA0, 0x9E, 0x95, 0xAE, 0x09, 0xE9, 0x5A, 0xE0, 0x9E, 0x95, 0xF0,
+    0x9E, 0xA5, 0xF0, 0xAE, 0xA5, 0xF0, 0xAE, 0xA5, 0xF0, 0x77, 0x0A, 0xAA, 0xA1, 0x9E, 0xA7, 0x1F,
+    0x1A, 0xF7, 0x1F, 0x1A, 0xFA, 0x70, 0xEA, 0x1F, 0xD7, 0x0E, 0xA1, 0xFD, 0xA7, 0xEA, 0x1F, 0xE6,
+    0x9E, 0xA1, 0xFE, 0x95, 0x9E, 0x91, 0xEA, 0xF5, 0x9E, 0x91, 0xEA, 0xAE, 0x94, 0xAE, 0x90, 0x9E,
+    0xA0, 0xF4, 0xAE, 0x90, 0x9E, 0xA0, 0xAE, 0x93, 0xAE, 0x90, 0x9E, 0xA1, 0xF3, 0xF1, 0xAE, 0xA1,
+    0xAE, 0x92, 0xF1, 0xAE, 0xA2, 0xF2, 0xF1, 0xAE, 0xA2, 0xAE, 0x91, 0xF1, 0xFC, 0x3E, 0xA1, 0xF1,
+    0xFC, 0x3F, 0x1F, 0x1F, 0xC3, 0x9E, 0xA9, 0xF1, 0xFC, 0x4F, 0x9F, 0x1F, 0xC4, 0x9F, 0xF1, 0xFC,
+    0x5F, 0xEA, 0x09, 0xFC, 0x59, 0xFD, 0xA0, 0x9F, 0xC6, 0xFD, 0xA0, 0x9F, 0xC6, 0x9F, 0xCA, 0x75,
+    0xAF, 0xC7, 0x39, 0xAF, 0xDA, 0x72, 0xFF, 0x97, 0x29, 0xFA, 0x97, 0x69, 0x72, 0x69, 0x99, 0x69,
+    0xD0, 0xAF, 0xCA, 0x49, 0xFF, 0xE3, 0xAF, 0x92, 0xAD, 0xA2, 0xAE, 0x94, 0xE2, 0xAE, 0x5A, 0xD9,
+    0x1E, 0x95, 0x9D, 0x91, 0xE9, 0x59, 0xDA, 0x1E, 0x95, 0x9D, 0xA1, 0xE9, 0x5A, 0xE1, 0xE9, 0x5A,
+    0xE1, 0xEA, 0x5A, 0xE1, 0xEA, 0x5A, 0xE0, 0x9E, 0xA5, 0xAE, 0x09, 0xEA, 0x5A, 0xE0, 0x9E, 0xA5,
+    0xAE, 0x9A, 0xF5, 0xF9, 0x72, 0xF7, 0x3F, 0x70, 0xFE, 0x79, 0xFD, 0xA7, 0x9F, 0xA9, 0x77, 0x10,
+    0x75, 0x99, 0x99, 0x72, 0xAF, 0xFE, 0x71, 0x9F, 0xFF, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAF,
+    0xCA, 0x97, 0x39, 0xFF, 0xEA, 0x70, 0xAF, 0xDA, 0xFE, 0x95, 0xFC, 0xA4, 0x9F, 0xC9, 0x3A, 0xF9,
+    0x7F, 0xC3, 0xF9, 0x71, 0xFA, 0x1A, 0xEA, 0x72, 0x9F, 0x1F, 0x74, 0xF9, 0x0F, 0x74, 0x9E, 0x99,
+    0xE9, 0x75, 0xEA, 0x9E, 0x76, 0xEA, 0x9E, 0x76, 0xAE, 0x9E, 0x76, 0xAE, 0x9E, 0x76, 0xAD, 0xA9,
+    0xE7, 0x6E, 0xA9, 0xE9, 0x75, 0xEA, 0x0F, 0x74, 0xAE, 0x90, 0xFC, 0x72, 0xAF, 0x1A, 0xFD, 0x99,
+    0x29, 0x9A, 0xFD, 0x2F, 0xFF, 0xFE, 0xA2, 0xAF, 0xFF, 0xFD, 0x4F, 0xFF, 0xFC, 0xA5, 0xFF, 0xFE,
+    0xA7, 0xAF, 0xFF, 0x97, 0x29, 0xAF, 0xDA, 0x97, 0x77, 0x40, 0x29, 0x99, 0xAA, 0xAA, 0xF3, 0xFF,
+    0xF9, 0x2A, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xAF, 0xA9,
+    0x6A, 0xFF, 0xA4, 0xAF, 0xAA, 0xFC, 0x29, 0xE5, 0xAD, 0x91, 0xE7, 0xE1, 0xDA, 0x79, 0xD9, 0x9D,
+    0x97, 0x9D, 0xAA, 0xD9, 0x70, 0xDA, 0xAD, 0x97, 0x9D, 0xA9, 0xDA, 0x79, 0xDA, 0x0E, 0x7E, 0x90,
+    0xFA, 0x99, 0x99, 0xAF, 0x2F, 0xFF, 0x92, 0xAF, 0xFD, 0xA4, 0x9F, 0xFA, 0x7A, 0xFA, 0x40, 0x5A,
+    0xA7, 0xA9, 0x72, 0xAC, 0x95, 0x9C, 0x97, 0x29, 0xD5, 0xD7, 0x4F, 0xFC, 0xA7, 0x5F, 0xEA, 0x77,
+    0xAE, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xFC, 0xA9, 0x73, 0x9F, 0xFE, 0xA7,
+    0x0A, 0xFD, 0xAF, 0xE9, 0x5F, 0xCA, 0x49, 0xFC, 0x93, 0xAF, 0x97, 0xFC, 0x3F, 0x97, 0x1F, 0xA1,
+    0xAE, 0xA7, 0x29, 0xF1, 0xF7, 0x4F, 0x90, 0xF7, 0x49, 0xE9, 0x9E, 0x97, 0x5E, 0xA9, 0xE7, 0x6E,
+    0xA9, 0xE7, 0x6A, 0xE9, 0xE7, 0x6A, 0xE9, 0xE7, 0x6A, 0xDA, 0x9E, 0x76, 0xEA, 0x9E, 0x97, 0x5E,
+    0xA0, 0xF7, 0x4A, 0xE9, 0x0F, 0xC7, 0x2A, 0xF1, 0xAF, 0xD9, 0x92, 0x99, 0xAF, 0xD2, 0xFF, 0xFF,
+    0xEA, 0x2A, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xCA, 0x5F, 0xFF, 0xEA, 0x7A, 0xFF, 0xF9, 0x72, 0x9A,
+    0xFD, 0xA9, 0x77, 0x74, 0x19, 0xA7, 0xAA, 0x39, 0xC9, 0x59, 0xCA, 0x4D, 0x5D, 0x94, 0xAF, 0xFA,
+    0x6F, 0xF7, 0x09, 0xAD, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAF, 0xA9, 0x6A,
+    0xFF, 0xA4, 0xAF, 0xAA, 0xFC, 0x29, 0xE5, 0xAD, 0x91, 0xE7, 0xE1, 0xDA, 0x79, 0xD9, 0x9D, 0x97,
+    0x9D, 0xAA, 0xD9, 0x70, 0xDA, 0xAD, 0x97, 0x9D, 0xA9, 0xDA, 0x79, 0xDA, 0x0E, 0x7E, 0x90, 0xFA,
+    0x99, 0x99, 0xAF, 0x2F, 0xFF, 0x92, 0xAF, 0xFD, 0xA4, 0x9F, 0xFA, 0x7A, 0xFA, 0x40, 0x7A, 0xD7,
+    0x0A, 0xCA, 0x69, 0xE7, 0x9E, 0x6A, 0xE7, 0xAE, 0x6F, 0x7F, 0x69, 0x99, 0x70, 0x99, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x74, 0x9A, 0xFC, 0xA9, 0x74, 0x9F, 0xFE, 0xA7, 0x1A, 0xFD, 0xAF, 0xE9, 0x6F,
+    0xCA, 0x49, 0xFC, 0x94, 0xAF, 0x97, 0xFC, 0x4F, 0x97, 0x1F, 0xA2, 0xAE, 0xA7, 0x29, 0xF2, 0xF7,
+    0x4F, 0x91, 0xF7, 0x49, 0xE9, 0x09, 0xE9, 0x75, 0xEA, 0x09, 0xE7, 0x6E, 0xA0, 0x9E, 0x76, 0xAE,
+    0x09, 0xE7, 0x6A, 0xE0, 0x9E, 0x76, 0xAD, 0xA0, 0x9E, 0x76, 0xEA, 0x09, 0xE9, 0x75, 0xEA, 0x1F,
+    0x74, 0xAE, 0x91, 0xFC, 0x72, 0xAF, 0x2A, 0xFD, 0x99, 0x29, 0x9A, 0xFD, 0x3F, 0xFF, 0xFE, 0xA3,
+    0xAF, 0xFF, 0xFD, 0x5F, 0xFF, 0xFC, 0xA6, 0xFF, 0xFE, 0xA7, 0x0A, 0xFF, 0xF9, 0x73, 0x9A, 0xFD,
+    0xA9, 0x77, 0x76, 0x5A, 0xD7, 0x0A, 0xCA, 0x5E, 0x97, 0xE9, 0x39, 0xE9, 0x69, 0xE4, 0xAE, 0x7A,
+    0xE4, 0x99, 0x99, 0x79, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7A, 0xFA,
+    0x97, 0x4A, 0xFF, 0xA7, 0x2A, 0xFA, 0xAF, 0xC7, 0x09, 0xE5, 0xAD, 0x97, 0xE7, 0xE7, 0xDA, 0x79,
+    0xD9, 0x59, 0xD9, 0x79, 0xDA, 0x5A, 0xD9, 0x70, 0xDA, 0x5A, 0xD9, 0x79, 0xDA, 0x59, 0xDA, 0x79,
+    0xDA, 0x6E, 0x7E, 0x96, 0xFA, 0x99, 0x99, 0xAF, 0x70, 0xFF, 0xF9, 0x70, 0xAF, 0xFD, 0xA7, 0x29,
+    0xFF, 0xA7, 0x5A, 0xFA, 0x70, 0x69, 0xAF, 0xCA, 0x97, 0x39, 0x99, 0x95, 0x9F, 0xFF, 0xFF, 0xFD,
+    0x4F, 0xEA, 0xFF, 0xFF, 0xF3, 0xFC, 0xA4, 0x9F, 0xFF, 0xF9, 0x2A, 0xF7, 0x0F, 0xC9, 0x74, 0xF9,
+    0x71, 0xF9, 0x73, 0xAE, 0xA7, 0x2A, 0xF7, 0x3F, 0x73, 0xAF, 0x73, 0xEA, 0x73, 0xAF, 0x97, 0x19,
+    0xE9, 0x73, 0xAF, 0xA7, 0x19, 0xE7, 0x4A, 0xFF, 0xE3, 0x9E, 0x74, 0xAF, 0xFE, 0x39, 0xE7, 0x4A,
+    0xFF, 0xE3, 0x9E, 0x74, 0xFD, 0xAA, 0x99, 0x94, 0x9E, 0x74, 0xFC, 0xA7, 0x2E, 0xA7, 0x3F, 0xCA,
+    0x72, 0xF7, 0x3F, 0xC9, 0x72, 0xFC, 0x97, 0x1F, 0xC7, 0x3A, 0xFD, 0x99, 0x29, 0x9A, 0xFD, 0x74,
+    0xFF, 0xFF, 0xEA, 0x74, 0xAF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x4F, 0xFF, 0xFF,
+    0xFF, 0x5A, 0xFF, 0xFF, 0xFF, 0xD9, 0x69, 0xAF, 0xDA, 0x9F, 0xFF, 0xEA, 0x77, 0x1A, 0xEA, 0x71,
+    0xAF, 0xA9, 0x3A, 0xFE, 0x95, 0xAF, 0xFC, 0x1E, 0xA9, 0x2A, 0xCA, 0x3A, 0xFA, 0xAA, 0xFE, 0x6D,
+    0x91, 0x9E, 0x5A, 0xF9, 0x69, 0xD1, 0xE7, 0xF4, 0x99, 0xAA, 0xD9, 0x0D, 0xA7, 0xAF, 0xFF, 0xDA,
+    0x9D, 0x97, 0x9F, 0xFF, 0xAA, 0xAA, 0xD9, 0x79, 0xE9, 0x72, 0xAD, 0x97, 0x9D, 0xA7, 0x39, 0xDA,
+    0x79, 0xE7, 0x4E, 0x7F, 0xA7, 0x3F, 0xA9, 0x99, 0x9A, 0xFE, 0x95, 0x9A, 0x2F, 0xFF, 0xFF, 0xFC,
+    0x2A, 0xFF, 0xDA, 0x9F, 0xFF, 0x39, 0xFF, 0xA2, 0xFF, 0xE5, 0xAF, 0xA5, 0x9A, 0xFC, 0xA9, 0x10,
+    0x70, 0xAC, 0x97, 0x6D, 0x76, 0xAC, 0xA7, 0x6D, 0x97, 0x5A, 0xD7, 0x6A, 0xA9, 0x77, 0x77, 0x77,
+    0x77, 0xAA, 0xAA, 0xAA, 0xA9, 0x97, 0x0F, 0xFD, 0xA6, 0xFF, 0xF5, 0xD5, 0x9E, 0xA4, 0xD7, 0xE3,
+    0x9D, 0x7A, 0xD9, 0x29, 0xD7, 0x9D, 0xA2, 0x9D, 0x7A, 0xDA, 0x29, 0xD6, 0x9E, 0x92, 0xAD, 0x5A,
+    0xF3, 0xAF, 0xFF, 0xA3, 0xAF, 0xFE, 0x94, 0xAF, 0xFD, 0xA5, 0xFF, 0xFC, 0x4F, 0xA9, 0x99, 0xAF,
+    0xA3, 0xF5, 0xAE, 0x92, 0xF6, 0xEA, 0x2F, 0x95, 0xF2, 0xF9, 0x5F, 0x2F, 0x95, 0xF9, 0x1F, 0x95,
+    0xFA, 0x09, 0xFA, 0x5F, 0xC0, 0x9F, 0xA5, 0xFC, 0x09, 0xFA, 0x5F, 0xC9, 0x9F, 0xA5, 0xFC, 0xA0,
+    0x49, 0xA9, 0x7D, 0x79, 0xD7, 0xD9, 0x69, 0xD7, 0xE7, 0x77, 0x77, 0xDA, 0x09, 0xAD, 0x91, 0xDA,
+    0xFC, 0x91, 0xFF, 0xA1, 0xFC, 0xA9, 0xA9, 0x09, 0xF5, 0x9E, 0x95, 0x9E, 0x69, 0xE6, 0x9E, 0x6A,
+    0xE6, 0xAE, 0x6F, 0x6F, 0x6F, 0x94, 0x9F, 0xA4, 0x9F, 0xA4, 0x1A, 0xAA, 0xAA, 0xAA, 0x99, 0x70,
+    0xFF, 0xDA, 0x6F, 0xFF, 0x5D, 0x59, 0xEA, 0x4D, 0x7E, 0x39, 0xD7, 0xAD, 0x92, 0x9D, 0x79, 0xDA,
+    0x29, 0xD7, 0xAD, 0xA2, 0x9D, 0x69, 0xE9, 0x2A, 0xD5, 0xAF, 0x3A, 0xFF, 0xFA, 0x3A, 0xFF, 0xE9,
+    0x4A, 0xFF, 0xDA, 0x5F, 0xFF, 0xC4, 0xFA, 0x99, 0x9A, 0xFA, 0x3F, 0x5A, 0xE9, 0x2F, 0x6E, 0xA2,
+    0xF9, 0x5F, 0x2F, 0x95, 0xF2, 0xF9, 0x5F, 0x91, 0xF9, 0x5F, 0xA0, 0x9F, 0xA5, 0xFC, 0x09, 0xFA,
+    0x5F, 0xC0, 0x9F, 0xA5, 0xFC, 0x99, 0xFA, 0x5F, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xFC,
+    0x74, 0xFA, 0x74, 0xF9, 0x74, 0xF7, 0x5F, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x39, 0xF7, 0x77, 0x20,
+    0x2D, 0xA0, 0x9A, 0xD9, 0x2D, 0xAF, 0xC9, 0x2F, 0xFA, 0x2F, 0xCA, 0x9A, 0x91, 0x9F, 0x69, 0xE9,
+    0x69, 0xE7, 0x9E, 0x79, 0xE7, 0xAE, 0x7A, 0xE7, 0xF7, 0xF7, 0xF9, 0x59, 0xFA, 0x59, 0xFA, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x72, 0xFA, 0x59, 0xF9, 0x59, 0xF6, 0xAF, 0x6A, 0xEA, 0x6F, 0x95, 0x9F,
+    0x6A, 0xEA, 0x60, 0x2A, 0xA6, 0xAA, 0x7D, 0x39, 0xD7, 0x1D, 0xA0, 0xAD, 0x73, 0xFC, 0x75, 0xE7,
+    0x69, 0xC9, 0x77, 0x77, 0x77, 0x77, 0xAA, 0xAA, 0xAA, 0xA9, 0x97, 0x0F, 0xFD, 0xA6, 0xFF, 0xF5,
+    0xD5, 0x9E, 0xA4, 0xD7, 0xE3, 0x9D, 0x7A, 0xD9, 0x29, 0xD7, 0x9D, 0xA2, 0x9D, 0x7A, 0xDA, 0x29,
+    0xD6, 0x9E, 0x92, 0xAD, 0x5A, 0xF3, 0xAF, 0xFF, 0xA3, 0xAF, 0xFE, 0x94, 0xAF, 0xFD, 0xA5, 0xFF,
+    0xFC, 0x4F, 0xA9, 0x99, 0xAF, 0xA3, 0xF5, 0xAE, 0x92, 0xF6, 0xEA, 0x2F, 0x95, 0xF2, 0xF9, 0x5F,
+    0x2F, 0x95, 0xF9, 0x1F, 0x95, 0xFA, 0x09, 0xFA, 0x5F, 0xC0, 0x9F, 0xA5, 0xFC, 0x09, 0xFA, 0x5F,
+    0xC9, 0x9F, 0xA5, 0xFC, 0xA0, 0x75, 0xAC, 0x94, 0x9C, 0xA2, 0xAC, 0xA2, 0xAC, 0xA4, 0xAD, 0x9D,
+    0xA6, 0xAE, 0xA7, 0x0E, 0x72, 0x97, 0x77, 0x73, 0xDA, 0x09, 0xAD, 0x93, 0xDA, 0xFC, 0x93, 0xFF,
+    0xA3, 0xFC, 0xA9, 0xA9, 0x29, 0xF7, 0x9E, 0x97, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0xAE, 0x70,
+    0xAE, 0x70, 0xF7, 0x0F, 0x70, 0xF9, 0x69, 0xFA, 0x69, 0xFA, 0x40, 0x73, 0xAA, 0x77, 0x3A, 0xC9,
+    0x77, 0x3D, 0x77, 0x3A, 0xD7, 0x73, 0xD9, 0x77, 0x2A, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x76, 0x99, 0xA9, 0x99, 0x97, 0x4A, 0xFF, 0xE7, 0x1F, 0xFF, 0xC7, 0x0F, 0xFF, 0xD7, 0x9F,
+    0xCA, 0x94, 0x99, 0x7A, 0xEA, 0x77, 0x1F, 0x77, 0x2E, 0x97, 0x72, 0xE9, 0x77, 0x2F, 0x77, 0x2A,
+    0xFC, 0xA9, 0x77, 0xFF, 0xCA, 0x97, 0x4F, 0xFE, 0xA7, 0x39, 0xFF, 0xEA, 0x74, 0x9A, 0xFF, 0xC7,
+    0x79, 0xFE, 0x77, 0x0F, 0xDA, 0x77, 0x9F, 0xD7, 0x79, 0xFD, 0x49, 0x71, 0xFE, 0x3A, 0xFA, 0xAA,
+    0xAA, 0xFF, 0xC2, 0x9F, 0xFF, 0xFD, 0xA2, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xDA, 0x3F, 0xFF, 0xFC,
+    0x95, 0x9A, 0xFF, 0xDA, 0x97, 0x77, 0x50, 0x79, 0xCA, 0x73, 0xD7, 0x39, 0xD7, 0x3D, 0xA7, 0x29,
+    0xD7, 0x3A, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x59, 0xAF, 0xCA, 0x94, 0xFF, 0xC9, 0x3A, 0xDA, 0x91,
+    0x99, 0x94, 0xD7, 0x4D, 0x74, 0xE9, 0x72, 0xAF, 0xA9, 0x70, 0xAF, 0xDA, 0x70, 0xAF, 0xDA, 0x71,
+    0x9A, 0xEA, 0x72, 0xAE, 0x3C, 0xA9, 0x29, 0xF2, 0xFF, 0xF1, 0xFF, 0xFA, 0x1F, 0xFF, 0x39, 0xAF,
+    0xDA, 0x92, 0x77, 0x77, 0x9D, 0x77, 0x3E, 0xA7, 0x71, 0xFC, 0x97, 0x7D, 0x91, 0xDA, 0x75, 0xCA,
+    0x49, 0xCA, 0x73, 0x99, 0x79, 0x77, 0x77, 0x77, 0x75, 0x99, 0xA9, 0x99, 0x97, 0x4A, 0xFF, 0xE7,
+    0x1F, 0xFF, 0xC7, 0x0F, 0xFF, 0xD7, 0x9F, 0xCA, 0x94, 0x99, 0x7A, 0xEA, 0x77, 0x1F, 0x77, 0x2E,
+    0x97, 0x72, 0xE9, 0x77, 0x2F, 0x77, 0x2A, 0xFC, 0xA9, 0x77, 0xFF, 0xCA, 0x97, 0x4F, 0xFE, 0xA7,
+    0x39, 0xFF, 0xEA, 0x74, 0x9A, 0xFF, 0xC7, 0x79, 0xFE, 0x77, 0x0F, 0xDA, 0x77, 0x9F, 0xD7, 0x79,
+    0xFD, 0x49, 0x71, 0xFE, 0x3A, 0xFA, 0xAA, 0xAA, 0xFF, 0xC2, 0x9F, 0xFF, 0xFD, 0xA2, 0xFF, 0xFF,
+    0xE2, 0xFF, 0xFF, 0xDA, 0x3F, 0xFF, 0xFC, 0x95, 0x9A, 0xFF, 0xDA, 0x97, 0x77, 0x50, 0x59, 0xA9,
+    0x73, 0xE7, 0x2F, 0xC7, 0x0D, 0xA0, 0xE6, 0xD9, 0x29, 0xD4, 0xAC, 0x6C, 0xA7, 0x77, 0x73, 0x9A,
+    0xFC, 0xA9, 0x4F, 0xFC, 0x93, 0xAD, 0xA9, 0x19, 0x99, 0x4D, 0x74, 0xD7, 0x4E, 0x97, 0x2A, 0xFA,
+    0x97, 0x0A, 0xFD, 0xA7, 0x0A, 0xFD, 0xA7, 0x19, 0xAE, 0xA7, 0x2A, 0xE3, 0xCA, 0x92, 0x9F, 0x2F,
+    0xFF, 0x1F, 0xFF, 0xA1, 0xFF, 0xF3, 0x9A, 0xFD, 0xA9, 0x20, 0x70, 0x99, 0xA9, 0x99, 0x97, 0x4A,
+    0xFF, 0xE7, 0x1F, 0xFF, 0xC7, 0x0F, 0xFF, 0xD7, 0x9F, 0xCA, 0x94, 0x99, 0x7A, 0xEA, 0x77, 0x1F,
+    0x77, 0x2E, 0x97, 0x72, 0xE9, 0x77, 0x2F, 0x77, 0x2A, 0xFC, 0xA9, 0x77, 0xFF, 0xCA, 0x97, 0x4F,
+    0xFE, 0xA7, 0x39, 0xFF, 0xEA, 0x74, 0x9A, 0xFF, 0xC7, 0x79, 0xFE, 0x77, 0x0F, 0xDA, 0x77, 0x9F,
+    0xD7, 0x79, 0xFD, 0x49, 0x71, 0xFE, 0x3A, 0xFA, 0xAA, 0xAA, 0xFF, 0xC2, 0x9F, 0xFF, 0xFD, 0xA2,
+    0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xDA, 0x3F, 0xFF, 0xFC, 0x95, 0x9A, 0xFF, 0xDA, 0x97, 0x70, 0xA9,
+    0x77, 0x4E, 0xA7, 0x75, 0xAC, 0x77, 0x5C, 0x77, 0x4A, 0xC7, 0x71, 0xF9, 0x77, 0x1A, 0xA9, 0x71,
+    0x39, 0xAF, 0xCA, 0x94, 0xFF, 0xC9, 0x3A, 0xDA, 0x91, 0x99, 0x94, 0xD7, 0x4D, 0x74, 0xE9, 0x72,
+    0xAF, 0xA9, 0x70, 0xAF, 0xDA, 0x70, 0xAF, 0xDA, 0x71, 0x9A, 0xEA, 0x72, 0xAE, 0x3C, 0xA9, 0x29,
+    0xF2, 0xFF, 0xF1, 0xFF, 0xFA, 0x1F, 0xFF, 0x39, 0xAF, 0xDA, 0x97, 0x1C, 0x74, 0x9A, 0x74, 0xAD,
+    0xA7, 0x59, 0xC7, 0x5C, 0x97, 0x39, 0xC7, 0x1F, 0xA7, 0x1A, 0xAA, 0x94, 0x59, 0x79, 0x74, 0xCA,
+    0x49, 0xCA, 0x75, 0xD9, 0x1A, 0xCA, 0x77, 0xDA, 0xDA, 0x77, 0x1F, 0x77, 0x29, 0xD7, 0x74, 0x99,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x99, 0xA9, 0x99, 0x97, 0x4A, 0xFF, 0xE7, 0x1F, 0xFF,
+    0xC7, 0x0F, 0xFF, 0xD7, 0x9F, 0xCA, 0x94, 0x99, 0x7A, 0xEA, 0x77, 0x1F, 0x77, 0x2E, 0x97, 0x72,
+    0xE9, 0x77, 0x2F, 0x77, 0x2A, 0xFC, 0xA9, 0x77, 0xFF, 0xCA, 0x97, 0x4F, 0xFE, 0xA7, 0x39, 0xFF,
+    0xEA, 0x74, 0x9A, 0xFF, 0xC7, 0x79, 0xFE, 0x77, 0x0F, 0xDA, 0x77, 0x9F, 0xD7, 0x79, 0xFD, 0x49,
+    0x71, 0xFE, 0x3A, 0xFA, 0xAA, 0xAA, 0xFF, 0xC2, 0x9F, 0xFF, 0xFD, 0xA2, 0xFF, 0xFF, 0xE2, 0xFF,
+    0xFF, 0xDA, 0x3F, 0xFF, 0xFC, 0x95, 0x9A, 0xFF, 0xDA, 0x97, 0x77, 0x50, 0x1A, 0xA6, 0xAA, 0x4D,
+    0x93, 0xD6, 0xAC, 0xA0, 0xAD, 0x70, 0xAF, 0x72, 0xE9, 0x73, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x59,
+    0xAF, 0xCA, 0x94, 0xFF, 0xC9, 0x3A, 0xDA, 0x91, 0x99, 0x94, 0xD7, 0x4D, 0x74, 0xE9, 0x72, 0xAF,
+    0xA9, 0x70, 0xAF, 0xDA, 0x70, 0xAF, 0xDA, 0x71, 0x9A, 0xEA, 0x72, 0xAE, 0x3C, 0xA9, 0x29, 0xF2,
+    0xFF, 0xF1, 0xFF, 0xFA, 0x1F, 0xFF, 0x39, 0xAF, 0xDA, 0x92, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0x9A, 0xA9, 0x99, 0x91, 0xE9, 0x39, 0x99, 0x97, 0x0E, 0x97, 0x70, 0xE9, 0x77,
+    0x0E, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xEA, 0x77, 0x0E, 0xA7, 0x79, 0xEA, 0x77, 0x9E,
+    0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0xAE, 0xA7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7A,
+    0xF7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x72, 0xC7, 0x73, 0xEA, 0x77,
+    0x3A, 0xC7, 0x72, 0xAC, 0x76, 0x9F, 0x97, 0x69, 0xAA, 0x96, 0x77, 0x19, 0xCA, 0x70, 0x9D, 0xA7,
+    0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x5F, 0xFE, 0x09, 0xFF, 0xE4, 0xE9, 0x70, 0xE9, 0x70,
+    0xE9, 0x70, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x09, 0xE7, 0x09, 0xE9, 0x79, 0xFE, 0xA3,
+    0x9F, 0xF3, 0x9F, 0xF4, 0xFF, 0x7C, 0x73, 0xF9, 0x72, 0x9C, 0x72, 0xAC, 0x7F, 0x97, 0xAA, 0x92,
+    0x49, 0x70, 0x97, 0x19, 0xCA, 0x49, 0xCA, 0x72, 0x9D, 0x2A, 0xCA, 0x74, 0x9D, 0xAD, 0xA7, 0x69,
+    0xEA, 0x77, 0x0A, 0xD7, 0x72, 0x97, 0x77, 0x77, 0x77, 0x77, 0x09, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF,
+    0xF9, 0xFF, 0xFF, 0xF9, 0xAA, 0x99, 0x99, 0x1E, 0x93, 0x99, 0x99, 0x70, 0xE9, 0x77, 0x0E, 0x97,
+    0x70, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0xA7, 0x70, 0xEA, 0x77, 0x9E, 0xA7, 0x79,
+    0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x7A, 0xEA, 0x77, 0xAF, 0x77, 0xAF, 0x77,
+    0xAF, 0x77, 0xAF, 0x77, 0xAF, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x70, 0x77, 0x70, 0xD9, 0x72,
+    0xD9, 0x72, 0xD9, 0x49, 0xCA, 0x19, 0xD9, 0x39, 0xDA, 0x19, 0xD4, 0x9D, 0xA1, 0xAD, 0x4A, 0xD9,
+    0x71, 0xAD, 0x96, 0xFF, 0xE1, 0x9F, 0xFE, 0x5E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x72, 0xE7,
+    0x2E, 0x72, 0xE7, 0x2E, 0x71, 0x9E, 0x71, 0x9E, 0x97, 0x09, 0xFE, 0xA4, 0x9F, 0xF4, 0x9F, 0xF5,
+    0xFF, 0x10, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9A, 0xAA, 0x99, 0x91, 0xE9,
+    0x39, 0x99, 0x97, 0x0E, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0x97, 0x70,
+    0xEA, 0x77, 0x0E, 0xA7, 0x79, 0xEA, 0x73, 0xFF, 0xFC, 0x7F, 0xFF, 0xC7, 0xFF, 0xFC, 0x73, 0x9E,
+    0xA7, 0x79, 0xEA, 0x77, 0xAF, 0x77, 0xAF, 0x77, 0xAF, 0x77, 0xAF, 0x77, 0xAF, 0x77, 0xFC, 0x77,
+    0xFC, 0x77, 0xFC, 0x70, 0x77, 0x39, 0xCA, 0x71, 0x9D, 0xA7, 0x19, 0xDA, 0x71, 0xAD, 0x97, 0x1A,
+    0xD9, 0x6F, 0xFE, 0x19, 0xFF, 0xE5, 0xE9, 0x71, 0xE9, 0x71, 0xE9, 0x4A, 0xFF, 0xF0, 0xAF, 0xFF,
+    0x0A, 0xFF, 0xF5, 0xE7, 0x2E, 0x71, 0x9E, 0x71, 0x9E, 0x97, 0x09, 0xFE, 0xA4, 0x9F, 0xF4, 0x9F,
+    0xF5, 0xFF, 0x00, 0x69, 0x94, 0xC7, 0x3F, 0x3C, 0x97, 0x19, 0xCA, 0x0D, 0x2C, 0x97, 0x1A, 0xC2,
+    0xCA, 0x0A, 0xC7, 0x2A, 0xC2, 0x9F, 0x72, 0x94, 0x9A, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29,
+    0xAA, 0xAA, 0x71, 0xAA, 0xAA, 0xA0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF,
+    0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF1, 0xF7, 0x19, 0xF1, 0xF7, 0x19,
+    0xF1, 0xF7, 0x19, 0xF1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71,
+    0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0x91, 0xF7, 0x1A, 0xE9, 0x1F, 0x97, 0x0F, 0x91,
+    0xAF, 0x79, 0xF2, 0xAF, 0xCA, 0x99, 0x99, 0xAF, 0xD2, 0x9F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFA, 0x3A,
+    0xFF, 0xFE, 0x5F, 0xFF, 0xD9, 0x69, 0xFF, 0xDA, 0x77, 0x71, 0x29, 0xD9, 0x29, 0xC4, 0x9D, 0xAC,
+    0x91, 0x9C, 0x4A, 0xC1, 0xAC, 0x19, 0xC4, 0xAC, 0x2D, 0xAD, 0x4D, 0x3E, 0x97, 0x77, 0x77, 0x77,
+    0x6A, 0xD9, 0x6A, 0xD9, 0x9D, 0x96, 0xAD, 0x99, 0xD9, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA,
+    0x6A, 0xD9, 0x0D, 0xA6, 0xE9, 0x0E, 0x6E, 0xA0, 0xE6, 0xEA, 0x0E, 0x6E, 0xA0, 0xE6, 0xEA, 0x0E,
+    0xA4, 0xFA, 0x0A, 0xFF, 0xFA, 0x09, 0xFF, 0xFA, 0x1F, 0xFF, 0xC1, 0xAF, 0xF9, 0xE2, 0x9F, 0xCA,
+    0x09, 0xE7, 0x60, 0x76, 0x97, 0x1A, 0xAF, 0xFC, 0x97, 0xAF, 0xFE, 0xA7, 0x99, 0x99, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x09, 0xF9, 0x70, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09,
+    0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF1, 0xF7, 0x1A, 0xF1, 0xF7, 0x19, 0xF1,
+    0xF7, 0x19, 0xF1, 0xF7, 0x19, 0xF1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA,
+    0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0x91, 0xF7, 0x1A, 0xE9, 0x1F, 0x97,
+    0x0F, 0x91, 0xAF, 0x79, 0xF2, 0xAF, 0xCA, 0xA9, 0x99, 0xAF, 0xD2, 0x9F, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xFA, 0x3A, 0xFF, 0xFE, 0x5F, 0xFF, 0xD9, 0x69, 0xAF, 0xFC, 0xA7, 0x77, 0x10, 0x73, 0x92, 0x9A,
+    0xAF, 0xFC, 0x2F, 0xFF, 0xA1, 0x99, 0x99, 0x77, 0x77, 0x77, 0x6A, 0xD9, 0x6A, 0xD9, 0x9D, 0x96,
+    0xAD, 0x99, 0xD9, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x0D, 0xA6, 0xE9, 0x0E,
+    0x6E, 0xA0, 0xE6, 0xEA, 0x0E, 0x6E, 0xA0, 0xE6, 0xEA, 0x0E, 0xA4, 0xFA, 0x0A, 0xFF, 0xFA, 0x09,
+    0xFF, 0xFA, 0x1F, 0xFF, 0xC1, 0xAF, 0xF9, 0xE2, 0x9F, 0xCA, 0x09, 0xE7, 0x60, 0x4C, 0xA6, 0xD7,
+    0x1D, 0x6D, 0x71, 0xDA, 0x39, 0xDA, 0x72, 0xFF, 0xC7, 0x39, 0xFE, 0x76, 0x9A, 0xAA, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF,
+    0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x1F, 0x71,
+    0x9F, 0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71,
+    0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xE9, 0x1F, 0x71, 0xAE, 0x91,
+    0xF9, 0x70, 0xF9, 0x1A, 0xF7, 0x9F, 0x2A, 0xFC, 0xAA, 0x99, 0x9A, 0xFD, 0x29, 0xFF, 0xFF, 0xC3,
+    0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xE5, 0xFF, 0xFD, 0x96, 0x9F, 0xFD, 0xA7, 0x77, 0x10, 0x09, 0xCA,
+    0x6D, 0x3C, 0xA6, 0xCA, 0x3D, 0xA3, 0x9D, 0x93, 0x9F, 0xFA, 0x59, 0xFD, 0xA7, 0x09, 0xAA, 0xA9,
+    0x77, 0x77, 0x77, 0x77, 0x0A, 0xD9, 0x6A, 0xD9, 0x9D, 0x96, 0xAD, 0x99, 0xD9, 0x6A, 0xD9, 0x9D,
+    0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x0D, 0xA6, 0xE9, 0x0E, 0x6E, 0xA0, 0xE6, 0xEA, 0x0E, 0x6E,
+    0xA0, 0xE6, 0xEA, 0x0E, 0xA4, 0xFA, 0x0A, 0xFF, 0xFA, 0x09, 0xFF, 0xFA, 0x1F, 0xFF, 0xC1, 0xAF,
+    0xF9, 0xE2, 0x9F, 0xCA, 0x09, 0xE7, 0x60, 0x70, 0xAC, 0xA7, 0x70, 0xC9, 0x0A, 0xC7, 0x69, 0xC2,
+    0xC7, 0x6A, 0xC2, 0xC9, 0x75, 0x9C, 0x19, 0xC7, 0x7F, 0xA7, 0x70, 0xAC, 0xA7, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x71, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7,
+    0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x1F, 0x71, 0x9F, 0x1F,
+    0x71, 0x9F, 0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0xA1,
+    0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xE9, 0x1F, 0x71, 0xAE, 0x91, 0xF9, 0x70,
+    0xF9, 0x1A, 0xF7, 0x9F, 0x2A, 0xFC, 0xA9, 0x99, 0x9A, 0xFD, 0x29, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
+    0xA3, 0xAF, 0xFF, 0xE5, 0xFF, 0xFD, 0x96, 0x9F, 0xFD, 0xA7, 0x77, 0x10, 0x5D, 0xA7, 0x2C, 0x90,
+    0xAA, 0x70, 0xAC, 0x2C, 0x70, 0xAA, 0x2C, 0x70, 0xAC, 0x19, 0xC7, 0x1F, 0xA7, 0x2A, 0xA9, 0x77,
+    0x77, 0x77, 0x77, 0x1A, 0xD9, 0x6A, 0xD9, 0x9D, 0x96, 0xAD, 0x99, 0xD9, 0x6A, 0xD9, 0x9D, 0xA6,
+    0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x0D, 0xA6, 0xE9, 0x0E, 0x6E, 0xA0, 0xE6, 0xEA, 0x0E, 0x6E, 0xA0,
+    0xE6, 0xEA, 0x0E, 0xA4, 0xFA, 0x0A, 0xFF, 0xFA, 0x09, 0xFF, 0xFA, 0x1F, 0xFF, 0xC1, 0xAF, 0xF9,
+    0xE2, 0x9F, 0xCA, 0x09, 0xE7, 0x60, 0x69, 0x99, 0x70, 0x99, 0x6E, 0x70, 0xE4, 0x9E, 0x79, 0xE4,
+    0xAE, 0x7A, 0xE4, 0xEA, 0x7E, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9F, 0x71, 0xAF,
+    0x19, 0xF7, 0x1A, 0xF1, 0x9F, 0x71, 0xAF, 0x19, 0xF7, 0x1A, 0xF1, 0x9F, 0x71, 0xAF, 0x19, 0xF7,
+    0x1A, 0xF1, 0x9F, 0x71, 0xAF, 0x2F, 0x71, 0x9F, 0x2F, 0x71, 0x9F, 0x2F, 0x71, 0x9F, 0x2F, 0x71,
+    0x9E, 0xA2, 0xF7, 0x19, 0xEA, 0x2F, 0x71, 0x9E, 0xA2, 0xF7, 0x19, 0xEA, 0x2F, 0x71, 0x9E, 0xA2,
+    0xF7, 0x19, 0xE9, 0x2F, 0x71, 0xAE, 0x92, 0xF9, 0x70, 0xF9, 0x2A, 0xF7, 0x9F, 0x3A, 0xFC, 0xAA,
+    0x99, 0x9A, 0xFD, 0x39, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF, 0xA4, 0xAF, 0xFF, 0xE6, 0xFF, 0xFD, 0x97,
+    0x9F, 0xFD, 0xA7, 0x77, 0x30, 0x59, 0xAA, 0x97, 0x9A, 0xA9, 0x4A, 0xDA, 0x7A, 0xDA, 0x4E, 0xA7,
+    0xEA, 0x39, 0xEA, 0x69, 0xE9, 0x39, 0xAA, 0x99, 0x69, 0xAA, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x76, 0xAD, 0x96, 0xAD, 0x96, 0x9D, 0x96, 0xAD, 0x96, 0x9D, 0x96, 0xAD, 0x96, 0x9D, 0xA6, 0xAD,
+    0x96, 0x9D, 0xA6, 0xAD, 0x97, 0xDA, 0x6E, 0x97, 0xE6, 0xEA, 0x7E, 0x6E, 0xA7, 0xE6, 0xEA, 0x7E,
+    0x6E, 0xA7, 0xEA, 0x4F, 0xA7, 0xAF, 0xFF, 0xA7, 0x9F, 0xFF, 0xA7, 0x0F, 0xFF, 0xC7, 0x0A, 0xFF,
+    0x9E, 0x71, 0x9F, 0xCA, 0x09, 0xE7, 0x77, 0x10, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F,
+    0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF,
+    0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA,
+    0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xE9, 0x1F, 0x71,
+    0xAE, 0x91, 0xF9, 0x70, 0xF9, 0x1A, 0xF7, 0x9F, 0x91, 0xAF, 0xCA, 0xA9, 0x99, 0xAF, 0xD2, 0x9F,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xFA, 0x3A, 0xFF, 0xFE, 0x5F, 0xFF, 0xD9, 0x69, 0xAF, 0xFC, 0xA9, 0x77,
+    0xD7, 0x71, 0xAC, 0x77, 0x2D, 0x77, 0x2A, 0xF7, 0x70, 0x9A, 0xD9, 0x77, 0x70, 0xAD, 0x96, 0xAD,
+    0x99, 0xD9, 0x6A, 0xD9, 0x9D, 0x96, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x90, 0xDA,
+    0x6E, 0x90, 0xE6, 0xEA, 0x0E, 0x6E, 0xA0, 0xE6, 0xEA, 0x0E, 0x6E, 0xA0, 0xEA, 0x4F, 0xA0, 0xAF,
+    0xFF, 0xA0, 0x9F, 0xFF, 0xA1, 0xFF, 0xFC, 0x1A, 0xFF, 0x9E, 0x29, 0xFC, 0xA0, 0x9E, 0x71, 0x9D,
+    0x73, 0xD7, 0x3A, 0xC7, 0x4C, 0xA7, 0x4D, 0x74, 0xAF, 0x72, 0x9A, 0xD0, 0x77, 0x77, 0x74, 0xAC,
+    0xA7, 0x77, 0x29, 0xE7, 0x77, 0x19, 0xFC, 0x77, 0x79, 0xD1, 0x9D, 0x77, 0x59, 0xCA, 0x4D, 0x77,
+    0x4A, 0x96, 0x99, 0x77, 0x77, 0x77, 0x77, 0x79, 0xE9, 0x77, 0x5F, 0x0E, 0xA7, 0x75, 0xEA, 0x0F,
+    0x77, 0x4A, 0xE9, 0x0A, 0xE7, 0x74, 0xF1, 0xAE, 0x97, 0x73, 0xF1, 0x9E, 0xA7, 0x72, 0x9E, 0xA2,
+    0xF7, 0x72, 0xAE, 0x92, 0xF7, 0xE9, 0x6F, 0x3A, 0xE9, 0x5A, 0xF6, 0xF3, 0x9E, 0xA5, 0xFC, 0x94,
+    0x9E, 0xA4, 0xF4, 0xAF, 0xCA, 0x4A, 0xE9, 0x4F, 0x4F, 0xE4, 0xF5, 0xF9, 0x2A, 0xFE, 0xA3, 0xF5,
+    0xAE, 0xA2, 0xFA, 0xF2, 0x9E, 0xA5, 0x9F, 0x1A, 0xF0, 0xAE, 0xA1, 0xAE, 0x96, 0xF1, 0xFA, 0x09,
+    0xF1, 0xF7, 0xF0, 0xAF, 0x91, 0xFA, 0x9F, 0x7A, 0xEA, 0xFC, 0x2A, 0xFA, 0xEA, 0x79, 0xFF, 0xA3,
+    0xFF, 0x97, 0x9F, 0xF4, 0xFF, 0x71, 0xFF, 0x49, 0xFE, 0x71, 0xFE, 0x95, 0xFE, 0x71, 0xAF, 0xD6,
+    0xAF, 0xCA, 0x71, 0x9F, 0xCA, 0x69, 0xFC, 0x97, 0x2F, 0xC7, 0x0F, 0xC5, 0x71, 0x99, 0x77, 0x29,
+    0xD9, 0x77, 0x09, 0xF7, 0x79, 0xDA, 0xAD, 0x75, 0x9D, 0x29, 0xD7, 0x39, 0xCA, 0x5A, 0xC7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x59, 0xE7, 0x5A, 0xDA, 0x0E, 0x97, 0x4E, 0x90, 0xEA, 0x74, 0xE1, 0xAE,
+    0x73, 0x9E, 0x19, 0xE4, 0x99, 0x4A, 0xDA, 0x2E, 0x92, 0x9D, 0xA3, 0xE9, 0x2E, 0xA2, 0xF9, 0x2E,
+    0x3A, 0xE1, 0xFD, 0x19, 0xE3, 0x9E, 0x0A, 0xFE, 0x0A, 0xDA, 0x4E, 0xAF, 0xFA, 0xE9, 0x4F, 0xFF,
+    0xF5, 0xAF, 0xEA, 0xFE, 0x59, 0xFD, 0x90, 0xFD, 0xA6, 0xFC, 0xA1, 0x9F, 0xC9, 0x6F, 0xC3, 0xFC,
+    0x7A, 0xE9, 0x39, 0xF3, 0x70, 0x9A, 0x77, 0x2D, 0xA7, 0x70, 0xF9, 0x76, 0xDA, 0xAD, 0x97, 0x4D,
+    0x92, 0xD9, 0x72, 0xD5, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1E, 0x97, 0x29, 0xE1, 0xF7,
+    0x2E, 0xA1, 0x9E, 0x97, 0x09, 0xE3, 0xF7, 0x0F, 0x39, 0xEA, 0x6A, 0xE9, 0x4F, 0x6F, 0x59, 0xEA,
+    0x4A, 0xE9, 0x6F, 0x92, 0x9F, 0x79, 0xF2, 0xF9, 0x70, 0xF9, 0x09, 0xF7, 0x19, 0xF0, 0xF9, 0x72,
+    0xFF, 0xC7, 0x3A, 0xFE, 0x97, 0x4F, 0xE7, 0x5A, 0xFC, 0x97, 0x6F, 0xC7, 0x7F, 0xA7, 0x7F, 0xA7,
+    0x7F, 0xA7, 0x69, 0xFA, 0x76, 0xAF, 0xA7, 0x6A, 0xFA, 0x76, 0xFC, 0xA7, 0x6F, 0xCA, 0x75, 0x9F,
+    0xCA, 0x70, 0x69, 0xA7, 0x5E, 0x73, 0xFA, 0x71, 0xDA, 0x9D, 0xA7, 0xD9, 0x2A, 0xCA, 0x5C, 0xA5,
+    0x9C, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9D, 0xA7, 0x0E, 0x0E, 0x79, 0xDA, 0x09, 0xDA, 0x6A,
+    0xD9, 0x1E, 0x95, 0xE2, 0x9E, 0x5E, 0x3E, 0x93, 0xAD, 0xA3, 0x9E, 0x3E, 0x94, 0xEA, 0x2E, 0x59,
+    0xE9, 0x09, 0xE6, 0xF0, 0xEA, 0x69, 0xEA, 0xEA, 0x7F, 0xE9, 0x79, 0xFD, 0x71, 0xFD, 0x71, 0x9F,
+    0xA7, 0x2F, 0x97, 0x2F, 0x72, 0x9F, 0x71, 0x9F, 0x97, 0x9A, 0xFC, 0x5A, 0xFF, 0x6A, 0xFE, 0x7A,
+    0xFC, 0xA7, 0x0A, 0xDA, 0x97, 0x10, 0x4E, 0x93, 0xE9, 0x70, 0xEA, 0x3E, 0x97, 0x9E, 0xA2, 0x9E,
+    0xA7, 0xAF, 0x2A, 0xEA, 0x7A, 0xEA, 0x2A, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0xE9, 0x72,
+    0x9E, 0x1F, 0x72, 0xEA, 0x19, 0xE9, 0x70, 0x9E, 0x3F, 0x70, 0xF3, 0x9E, 0xA6, 0xAE, 0x94, 0xF6,
+    0xF5, 0x9E, 0xA4, 0xAE, 0x96, 0xF9, 0x29, 0xF7, 0x9F, 0x2F, 0x97, 0x0F, 0x90, 0x9F, 0x71, 0x9F,
+    0x0F, 0x97, 0x2F, 0xFC, 0x73, 0xAF, 0xE9, 0x74, 0xFE, 0x75, 0xAF, 0xC9, 0x76, 0xFC, 0x77, 0xFA,
+    0x77, 0xFA, 0x77, 0xFA, 0x76, 0x9F, 0xA7, 0x6A, 0xFA, 0x76, 0xAF, 0xA7, 0x6F, 0xCA, 0x76, 0xFC,
+    0xA7, 0x59, 0xFC, 0xA7, 0x73, 0xD7, 0x73, 0xAC, 0xA7, 0x73, 0xD9, 0x77, 0x2A, 0xD7, 0x73, 0xDA,
+    0x77, 0x29, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAF, 0xFF, 0xFD, 0x4F, 0xFF, 0xFC,
+    0xA4, 0xFF, 0xFF, 0xCA, 0x4A, 0xFF, 0xFF, 0xA7, 0x70, 0xFC, 0x97, 0x7F, 0xD7, 0x7F, 0xD7, 0x7F,
+    0xD7, 0x7F, 0xD9, 0x76, 0xFD, 0x97, 0x6F, 0xDA, 0x76, 0xFD, 0xA7, 0x6A, 0xFD, 0x76, 0xAF, 0xD7,
+    0x6A, 0xFD, 0x76, 0xAF, 0xD9, 0x75, 0xAF, 0xD9, 0x75, 0xAF, 0xDA, 0x75, 0xAF, 0xDA, 0x75, 0xAF,
+    0xE7, 0x59, 0xFF, 0xFF, 0xF1, 0x9F, 0xFF, 0xFF, 0x90, 0x9F, 0xFF, 0xFF, 0xA0, 0x9F, 0xFF, 0xFF,
+    0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x70, 0xAA, 0x75, 0xD7, 0x4A, 0xCA, 0x74, 0xD7, 0x4A, 0xD7, 0x4D,
+    0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0F, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x97, 0x19, 0xEA, 0x71,
+    0x9E, 0xA7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7, 0x1A, 0xEA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71,
+    0xFA, 0x71, 0xFC, 0xAA, 0xAA, 0xAA, 0xA9, 0x2F, 0xFF, 0xC1, 0x9F, 0xFF, 0xC9, 0x09, 0xFF, 0xFD,
+    0x00, 0x70, 0x9E, 0x77, 0x2A, 0xE7, 0x72, 0xF7, 0x72, 0xF7, 0x72, 0xF9, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x0A, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xCA, 0x4F, 0xFF, 0xFC, 0xA4, 0xAF, 0xFF, 0xFA, 0x77,
+    0x0F, 0xC9, 0x77, 0xFD, 0x77, 0xFD, 0x77, 0xFD, 0x77, 0xFD, 0x97, 0x6F, 0xD9, 0x76, 0xFD, 0xA7,
+    0x6F, 0xDA, 0x76, 0xAF, 0xD7, 0x6A, 0xFD, 0x76, 0xAF, 0xD7, 0x6A, 0xFD, 0x97, 0x5A, 0xFD, 0x97,
+    0x5A, 0xFD, 0xA7, 0x5A, 0xFD, 0xA7, 0x5A, 0xFE, 0x75, 0x9F, 0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0xF9,
+    0x09, 0xFF, 0xFF, 0xFA, 0x09, 0xFF, 0xFF, 0xFC, 0x09, 0xFF, 0xFF, 0xFC, 0x00, 0x59, 0xE7, 0x39,
+    0xE7, 0x3A, 0xE9, 0x72, 0xF9, 0x72, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x7F, 0xFF, 0x3F, 0xFF, 0x3F,
+    0xFF, 0x97, 0x19, 0xEA, 0x71, 0x9E, 0xA7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7, 0x1A, 0xEA, 0x71, 0xFA,
+    0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFC, 0xAA, 0xAA, 0xAA, 0xA9, 0x2F, 0xFF, 0xC1, 0x9F,
+    0xFF, 0xC9, 0x09, 0xFF, 0xFD, 0x00, 0x49, 0xA9, 0x6A, 0x97, 0x39, 0xCA, 0x3A, 0xCA, 0x75, 0x9D,
+    0x1D, 0xA7, 0x79, 0xFA, 0x77, 0x1A, 0xDA, 0x77, 0x3D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71,
+    0xAF, 0xFF, 0xFD, 0x4F, 0xFF, 0xFC, 0xA4, 0xFF, 0xFF, 0xCA, 0x4A, 0xFF, 0xFF, 0xA7, 0x70, 0xFC,
+    0x97, 0x7F, 0xD7, 0x7F, 0xD7, 0x7F, 0xD7, 0x7F, 0xD9, 0x76, 0xFD, 0x97, 0x6F, 0xDA, 0x76, 0xFD,
+    0xA7, 0x6A, 0xFD, 0x76, 0xAF, 0xD7, 0x6A, 0xFD, 0x76, 0xAF, 0xD9, 0x75, 0xAF, 0xD9, 0x75, 0xAF,
+    0xDA, 0x75, 0xAF, 0xDA, 0x75, 0xAF, 0xE7, 0x59, 0xFF, 0xFF, 0xF1, 0x9F, 0xFF, 0xFF, 0x90, 0x9F,
+    0xFF, 0xFF, 0xA0, 0x9F, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFF, 0xC0, 0x77, 0x2A, 0xC5, 0xAC, 0x95,
+    0xAC, 0xA2, 0xD9, 0x7A, 0xDA, 0xD9, 0x71, 0xAE, 0x97, 0x3D, 0xA7, 0x59, 0x77, 0x77, 0x77, 0x77,
+    0x71, 0xFF, 0xF3, 0xFF, 0xF3, 0xFF, 0xF9, 0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0xAE, 0xA7, 0x1A,
+    0xEA, 0x71, 0xAE, 0xA7, 0x1F, 0xA7, 0x1F, 0xA7, 0x1F, 0xA7, 0x1F, 0xA7, 0x1F, 0xCA, 0xAA, 0xAA,
+    0xAA, 0x92, 0xFF, 0xFC, 0x19, 0xFF, 0xFC, 0x90, 0x9F, 0xFF, 0xD0, 0x75, 0xFA, 0x3F, 0xD2, 0xE9,
+    0x1A, 0x19, 0xDA, 0x5A, 0xD6, 0xE6, 0xE6, 0xDA, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E,
+    0x6E, 0x59, 0xE5, 0x9E, 0x59, 0xE5, 0x9E, 0x94, 0x9E, 0x94, 0x9E, 0x94, 0x77, 0x59, 0x97, 0x76,
+    0x9C, 0x96, 0x9A, 0xFC, 0xA9, 0x59, 0xC9, 0x49, 0xFF, 0xEA, 0x3A, 0xC9, 0x3A, 0xFD, 0xAF, 0xE9,
+    0x1D, 0x3F, 0xCA, 0x49, 0xFC, 0x9A, 0xCA, 0x2A, 0xF9, 0x7F, 0xE3, 0xF9, 0x71, 0xFC, 0x3A, 0xEA,
+    0x72, 0x9F, 0x3F, 0x74, 0xF3, 0xF7, 0x49, 0xE9, 0x19, 0xE9, 0x75, 0xEA, 0x19, 0xE7, 0x6E, 0xA1,
+    0x9E, 0x76, 0xAD, 0xA1, 0x9E, 0x76, 0xAE, 0x19, 0xE7, 0x6A, 0xDA, 0x19, 0xE7, 0x6E, 0xA1, 0x9E,
+    0x97, 0x5E, 0xA2, 0xF7, 0x4A, 0xE9, 0x2F, 0xC7, 0x2A, 0xF3, 0xAF, 0xD9, 0x92, 0x99, 0xAF, 0xD4,
+    0xFF, 0xFF, 0xEA, 0x4A, 0xFF, 0xFF, 0xD6, 0xFF, 0xFF, 0xCA, 0x7F, 0xFF, 0xEA, 0x71, 0xAF, 0xFF,
+    0x97, 0x49, 0xAF, 0xDA, 0x97, 0x77, 0x70, 0x77, 0x77, 0x1C, 0x94, 0xAF, 0xA9, 0x3C, 0x92, 0xAF,
+    0xFA, 0x2C, 0x91, 0xAF, 0xAA, 0xFC, 0x0A, 0xC1, 0x9E, 0x5A, 0xF9, 0x1E, 0x7E, 0x92, 0xDA, 0x79,
+    0xD9, 0x19, 0xD9, 0x79, 0xDA, 0x1A, 0xD9, 0x70, 0xDA, 0x1A, 0xD9, 0x79, 0xDA, 0x19, 0xDA, 0x79,
+    0xDA, 0x2E, 0x7E, 0x92, 0xFA, 0x99, 0x99, 0xAF, 0x4F, 0xFF, 0x94, 0xAF, 0xFD, 0xA6, 0x9F, 0xFA,
+    0x71, 0xAF, 0xA6, 0x29, 0xFF, 0xDA, 0x6A, 0xFF, 0xFC, 0xA3, 0xAF, 0xDA, 0xAA, 0xFE, 0x2F, 0xDA,
+    0x59, 0xF0, 0x9D, 0xAA, 0xDA, 0x7E, 0x0A, 0xD0, 0xAD, 0xA7, 0xAD, 0x9A, 0xCA, 0x0E, 0xA7, 0xAD,
+    0xAA, 0xC9, 0x0E, 0xA7, 0xE9, 0x9C, 0x90, 0xEA, 0x7E, 0x90, 0xA1, 0xEA, 0x5A, 0xF4, 0xFF, 0xFD,
+    0xA4, 0xFF, 0xFD, 0x5F, 0xFF, 0x96, 0xFC, 0xAA, 0xAA, 0x97, 0x1F, 0x77, 0xF7, 0x69, 0xF7, 0x69,
+    0xF7, 0x69, 0xF7, 0x69, 0xF7, 0x6A, 0xF7, 0x6A, 0xF7, 0x6A, 0xF9, 0x75, 0xAF, 0x97, 0x5A, 0xF9,
+    0x72, 0x77, 0x5A, 0xE7, 0x4A, 0xF7, 0x4E, 0xA9, 0x74, 0xDA, 0x76, 0xDA, 0x2A, 0xAA, 0xA9, 0x6E,
+    0x0A, 0xFD, 0xA5, 0xEA, 0xEA, 0xAA, 0xE4, 0xFC, 0xA4, 0xDA, 0x3F, 0xC5, 0x9D, 0x3F, 0x96, 0xD9,
+    0x2F, 0x7D, 0xA2, 0xF7, 0xDA, 0x2F, 0x7D, 0xA2, 0xF9, 0x6D, 0xA2, 0xFC, 0x59, 0xD9, 0x2F, 0xDA,
+    0x29, 0xE3, 0xFF, 0xFD, 0x3F, 0xFF, 0xC9, 0x29, 0xE0, 0xFF, 0xA3, 0xAE, 0x1F, 0xD9, 0x4A, 0xDA,
+    0x39, 0x97, 0xEA, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xAE, 0x75, 0xAE, 0x75, 0xF7, 0x77, 0x60, 0xAF,
+    0xFF, 0x0A, 0xFF, 0xF0, 0x9C, 0xA7, 0x39, 0xCA, 0x73, 0x9C, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0x97,
+    0x3A, 0xC9, 0x73, 0xAC, 0x97, 0x3A, 0xC7, 0x4C, 0x73, 0xD7, 0x2D, 0x97, 0x1D, 0x97, 0x1D, 0xA7,
+    0x09, 0xDA, 0x70, 0x9D, 0xA7, 0x09, 0xE7, 0x1A, 0xFF, 0xF0, 0xAF, 0xFF, 0x0A, 0xFF, 0xF7, 0x60,
+    0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9D, 0xA9, 0x99, 0x1E, 0x93, 0x99, 0x99,
+    0x0A, 0xC5, 0xE9, 0x71, 0xA5, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xEA,
+    0x77, 0x0E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77,
+    0xAE, 0xA7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7F, 0xC7, 0x7F, 0xC7,
+    0x7F, 0xC7, 0x79, 0xAA, 0x70, 0xEA, 0x7A, 0xEA, 0x7F, 0x96, 0xAD, 0xA7, 0x9D, 0xA7, 0x09, 0xDA,
+    0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x5F, 0xFE, 0x09, 0xFF, 0xE4, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70,
+    0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x09, 0xE7, 0x09, 0xE9, 0x79, 0xFE, 0xA3, 0x9F, 0xF3,
+    0x9F, 0xF4, 0xFF, 0x00, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9A, 0xAA, 0x99,
+    0x91, 0xE9, 0x39, 0x99, 0x97, 0x0E, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xE9, 0x77, 0x0E,
+    0x97, 0x70, 0xEA, 0x77, 0x0E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7,
+    0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7F,
+    0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xCA, 0x76, 0xFE, 0x97, 0x5F, 0xEA, 0x74, 0x9F, 0xDA, 0x76,
+    0xAF, 0xA7, 0x70, 0x9A, 0xCA, 0x30, 0x77, 0x49, 0x77, 0x5C, 0x97, 0x74, 0xCA, 0x77, 0x39, 0xCA,
+    0x9F, 0x97, 0x0A, 0xFD, 0x99, 0xF7, 0x1A, 0xFC, 0xA0, 0x9F, 0x71, 0xAF, 0x29, 0xF7, 0x1A, 0xF2,
+    0x9F, 0x71, 0xAF, 0x29, 0xF7, 0x1A, 0xF2, 0x9F, 0x71, 0xAF, 0x3F, 0x71, 0x9F, 0x3F, 0x71, 0x9F,
+    0x3F, 0x71, 0x9F, 0x3F, 0x71, 0x9E, 0xA3, 0xF7, 0x19, 0xEA, 0x3F, 0x71, 0x9E, 0xA3, 0xF7, 0x19,
+    0xEA, 0x3F, 0x71, 0x9E, 0xA3, 0xF7, 0x19, 0xE9, 0x3F, 0x71, 0xAE, 0x93, 0xF9, 0x70, 0xF9, 0x3A,
+    0xF7, 0x9F, 0x4A, 0xFC, 0xAA, 0x99, 0x9A, 0xFD, 0x49, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 0xA5, 0xAF,
+    0xFF, 0xE7, 0xFF, 0xFD, 0x97, 0x09, 0xFF, 0xDA, 0x77, 0x75, 0x77, 0xA7, 0x70, 0xC9, 0xAD, 0x96,
+    0xAD, 0x99, 0xC0, 0x9D, 0x96, 0xAD, 0x9A, 0xC0, 0x9D, 0x96, 0xAF, 0x90, 0x9D, 0xA6, 0xAE, 0xA1,
+    0x9D, 0xA6, 0xAD, 0x93, 0xDA, 0x6E, 0x93, 0xE6, 0xEA, 0x3E, 0x6E, 0xA3, 0xE6, 0xEA, 0x3E, 0x6E,
+    0xA3, 0xEA, 0x39, 0xFA, 0x3A, 0xFF, 0xFA, 0x39, 0xFF, 0xFA, 0x4F, 0xFF, 0xC4, 0xAF, 0xF9, 0xE5,
+    0x9F, 0xCA, 0x09, 0xE7, 0x74, 0x0E, 0x7E, 0x96, 0xEA, 0x6F, 0x70, 0x99, 0x00, 0x29, 0xA9, 0x2D,
+    0x29, 0xD2, 0xD9, 0x19, 0xD2, 0xE1, 0x4D, 0x70, 0xAE, 0x69, 0xFA, 0x49, 0xD1, 0xDA, 0x29, 0xCA,
+    0x39, 0xCA, 0x1A, 0x96, 0xA9, 0x1A, 0xD3, 0xAC, 0x0A, 0xCA, 0xD2, 0xAC, 0x0D, 0x1D, 0x1C, 0xA0,
+    0xCA, 0x19, 0xF9, 0x0C, 0xA2, 0x9D, 0xA7, 0x30, 0x70, 0x99, 0x99, 0x1A, 0xFF, 0xE1, 0xFF, 0xF9,
+    0x75, 0x77, 0x39, 0xAA, 0xAA, 0xAF, 0xFD, 0x91, 0xFF, 0xFF, 0xA7, 0x73, 0xAC, 0x96, 0xCA, 0x9C,
+    0xA5, 0x9C, 0x90, 0xD9, 0x39, 0xD1, 0xAF, 0xFA, 0x2A, 0xFD, 0xA5, 0xAA, 0xA9, 0x30, 0x0A, 0xDA,
+    0x1F, 0x1F, 0x09, 0xF0, 0x9F, 0x00, 0x09, 0xD9, 0x3A, 0xD9, 0x1E, 0xA3, 0xEA, 0x1F, 0x3F, 0x1F,
+    0x29, 0xF0, 0x9F, 0x2A, 0xF0, 0x0A, 0xEA, 0x1A, 0x19, 0xCA, 0x4C, 0xA2, 0x9C, 0xA3, 0xCA, 0x70,
+    0x1A, 0xD9, 0x1A, 0xC1, 0xC9, 0x0C, 0x91, 0x9C, 0x0C, 0xA1, 0xAC, 0x09, 0xF9, 0x19, 0xAA, 0x90,
+    0x5E, 0x70, 0xE4, 0x9E, 0x79, 0xDA, 0x4A, 0xDA, 0x7A, 0xDA, 0x4E, 0xA6, 0x9E, 0xA4, 0x99, 0x71,
+    0x99, 0x60, 0x0C, 0xA5, 0x9C, 0x91, 0xD3, 0xD9, 0x3D, 0xA9, 0xD9, 0x5F, 0x96, 0x9D, 0xA7, 0x0A,
+    0xA4, 0x09, 0x97, 0x19, 0x97, 0xAD, 0xA7, 0xAD, 0x96, 0xAE, 0x7A, 0xDA, 0x69, 0xE9, 0x6A, 0xE9,
+    0x59, 0xAA, 0xC9, 0x69, 0xAA, 0xC9, 0x00, 0xAF, 0x90, 0x9F, 0x91, 0xF9, 0x1F, 0xA1, 0xAE, 0xA1,
+    0x9F, 0x2F, 0x91, 0xAE, 0xA6, 0x71, 0xFC, 0x2F, 0xA2, 0xF9, 0x19, 0xF2, 0x9F, 0x2A, 0xEA, 0x2F,
+    0x91, 0x9F, 0x20, 0x6A, 0xF9, 0x09, 0xF9, 0x1F, 0x91, 0xFA, 0x19, 0xEA, 0x2F, 0x2F, 0x91, 0xAE,
+    0xA0, 0x2A, 0x92, 0xCA, 0x99, 0x9C, 0xAA, 0xEA, 0x2C, 0xA2, 0xCA, 0x40, 0x9A, 0x2A, 0xC2, 0xAC,
+    0x99, 0x9A, 0xEA, 0xAC, 0x2A, 0xC7, 0xAD, 0xAA, 0xA9, 0x99, 0x91, 0xAF, 0xFD, 0x91, 0x99, 0x99,
+    0x99, 0xAD, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0xA7, 0x0D, 0xA0, 0x1C, 0xA1, 0xAA, 0x1C, 0xA0,
+    0x9C, 0x9A, 0xCA, 0x09, 0xA1, 0x09, 0xC9, 0xC0, 0xAA, 0x0A, 0xA1, 0xD1, 0x90, 0x19, 0xA4, 0x9C,
+    0x49, 0xC2, 0xAF, 0xC0, 0x9A, 0xAA, 0xAA, 0x00, 0xAF, 0xC0, 0x9A, 0xDA, 0xA2, 0x9C, 0x49, 0xC5,
+    0x92, 0x79, 0xA3, 0x9A, 0x1A, 0xFA, 0x19, 0xA3, 0x9A, 0x70, 0x70, 0x99, 0x99, 0x1A, 0xFF, 0xE0,
+    0x9F, 0xFF, 0x76, 0x09, 0xD9, 0x1E, 0xA1, 0xF1, 0xF0, 0x9F, 0x00, 0x0A, 0xDA, 0x3A, 0xDA, 0x1F,
+    0x3E, 0xA1, 0xF3, 0xF0, 0x9F, 0x29, 0xF0, 0x9F, 0x29, 0xF0, 0x1A, 0xD9, 0x1A, 0xC1, 0xC9, 0x0C,
+    0x91, 0x9C, 0x0C, 0xA1, 0xAC, 0x09, 0xF9, 0x19, 0xAA, 0x90, 0x71, 0xFC, 0x2F, 0xA2, 0xF9, 0x19,
+    0xF2, 0x9F, 0x2A, 0xEA, 0x2F, 0x91, 0x9F, 0x72, 0x09, 0x4C, 0x39, 0xA3, 0xAE, 0x94, 0xC9, 0x3C,
+    0x99, 0xAA, 0xD0, 0xEA, 0x10, 0x2A, 0x92, 0xCA, 0x2D, 0x29, 0xC3, 0xAC, 0x39, 0xF9, 0x1A, 0xDA,
+    0x50, 0x0D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xAA, 0x00, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x9A, 0xFE, 0xAA, 0xC9, 0x29, 0xCA, 0xAC, 0x92, 0x9C, 0xAA, 0xA9, 0x29, 0xA9, 0x0A,
+    0x96, 0xA9, 0x09, 0xCA, 0x39, 0xCA, 0x29, 0xD1, 0xDA, 0x49, 0xFA, 0x6A, 0xE7, 0x0D, 0x40, 0x5A,
+    0xA7, 0x1A, 0xD9, 0x79, 0xF6, 0x9D, 0x9A, 0xD4, 0x9C, 0xA2, 0x9D, 0x2A, 0xC9, 0x5A, 0xC0, 0x1A,
+    0xD3, 0xAC, 0x0A, 0xCA, 0xD2, 0xAC, 0x0D, 0x1D, 0x1C, 0xA0, 0xCA, 0x19, 0xF9, 0x0C, 0xA2, 0x9D,
+    0xA7, 0x30, 0x73, 0xFF, 0xC9, 0x9A, 0xAA, 0xAA, 0xAA, 0x99, 0x00, 0x74, 0xAF, 0xFC, 0x09, 0xFF,
+    0xCA, 0x74, 0x1A, 0xD3, 0xAC, 0x0A, 0xCA, 0xD2, 0xAC, 0x0D, 0x1D, 0x1C, 0xA0, 0xCA, 0x19, 0xF9,
+    0x0C, 0xA2, 0x9D, 0xA7, 0x30, 0xAF, 0xFF, 0x0A, 0xFF, 0xF0, 0xAF, 0xFF, 0x00, 0xAA, 0x1A, 0xA1,
+    0xC0, 0xAC, 0xAC, 0x99, 0x90, 0x99, 0x49, 0x9A, 0xC9, 0x29, 0xCA, 0xAC, 0x92, 0x9C, 0xAA, 0xDA,
+    0xAA, 0xDA, 0xAF, 0xEA, 0x70, 0xAF, 0xE0, 0xAA, 0x4C, 0x0A, 0xA4, 0xC0, 0xAA, 0x4C, 0x0A, 0xA4,
+    0xC0, 0xAF, 0xE1, 0x99, 0x99, 0x99, 0x90, 0x0A, 0xCA, 0x1A, 0x90, 0x9C, 0x1C, 0xA0, 0xC0, 0x9A,
+    0x1C, 0x1A, 0x99, 0xA1, 0xC1, 0xAA, 0xAA, 0x1C, 0x1A, 0xA3, 0x91, 0x99, 0x0A, 0x90, 0x99, 0x19,
+    0xC9, 0xC3, 0xAC, 0x4D, 0x92, 0xAA, 0x9C, 0x1A, 0xC1, 0xAC, 0x00, 0x1A, 0xD3, 0xAC, 0x0A, 0xCA,
+    0xD2, 0xAC, 0x0D, 0x1D, 0x1C, 0xA0, 0xCA, 0x19, 0xF9, 0x0C, 0xA2, 0x9D, 0xA7, 0x30, 0xAA, 0x1A,
+    0xD2, 0xC9, 0x09, 0xC0, 0x99, 0x10, 0x7A, 0xA7, 0x2A, 0xCA, 0x72, 0xD9, 0x71, 0xAD, 0x72, 0xDA,
+    0x71, 0x9D, 0x97, 0x77, 0x71, 0x9D, 0x93, 0xAD, 0x91, 0xEA, 0x3E, 0xA1, 0xF3, 0xF1, 0xF2, 0x9F,
+    0x09, 0xF2, 0xAF, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xFE, 0xAA, 0xC9, 0x29, 0xCA, 0xAC, 0x92,
+    0x9C, 0xAA, 0xA9, 0x29, 0xA9, 0x72, 0x92, 0xAA, 0xFF, 0xD0, 0x9F, 0xFF, 0x19, 0x99, 0x97, 0x77,
+    0x77, 0x77, 0x29, 0x99, 0x99, 0x1A, 0xFF, 0xE0, 0x9F, 0xFF, 0x76, 0x0D, 0x4D, 0x99, 0xD4, 0xD9,
+    0x9D, 0x39, 0xD9, 0x9D, 0x39, 0xD9, 0xAD, 0x39, 0xD9, 0xAD, 0x3A, 0xD9, 0xAD, 0x3A, 0xD9, 0xAA,
+    0xA3, 0x9A, 0xA9, 0x9A, 0x99, 0x99, 0x91, 0xAF, 0xE0, 0xAF, 0xE5, 0xE5, 0xE9, 0x4E, 0x94, 0xAA,
+    0xA0, 0x79, 0x97, 0x0C, 0x70, 0x9C, 0x70, 0xAA, 0x70, 0xC9, 0x3A, 0xD0, 0x9C, 0x0A, 0xC0, 0xAC,
+    0xAD, 0xAA, 0x0A, 0xC0, 0xD1, 0xD9, 0x0C, 0xA0, 0xCA, 0x19, 0xF9, 0x0C, 0xA1, 0xAE, 0xA5, 0xCA,
+    0x70, 0xC9, 0x79, 0xC7, 0x0C, 0xA7, 0x0C, 0x97, 0x70, 0x75, 0x9D, 0x97, 0x73, 0xAD, 0xA7, 0x73,
+    0xEA, 0x77, 0x3F, 0x70, 0xAF, 0xD9, 0x70, 0xE9, 0x1F, 0xAA, 0xAE, 0x96, 0xE9, 0x0F, 0x4F, 0x93,
+    0x9E, 0x1E, 0xA5, 0x9F, 0xAA, 0xFA, 0x09, 0xEA, 0x79, 0xAF, 0xCA, 0x97, 0x9D, 0x97, 0x73, 0xAD,
+    0xA7, 0x73, 0xEA, 0x77, 0x3F, 0x75, 0x77, 0x2A, 0xEA, 0x69, 0x91, 0xAD, 0xAA, 0xD9, 0x4D, 0x1D,
+    0xA2, 0xD9, 0x29, 0xD0, 0x9D, 0x92, 0x9D, 0x91, 0xDA, 0x0A, 0xD5, 0xFD, 0x97, 0x29, 0xAA, 0xA7,
+    0x76, 0x99, 0x97, 0x4F, 0xD5, 0xD1, 0xE1, 0xAD, 0x39, 0xD1, 0xD9, 0x2A, 0xD2, 0xAD, 0x09, 0xD9,
+    0x3A, 0xDA, 0xE9, 0x09, 0x9A, 0x59, 0xFA, 0x77, 0x20, 0x77, 0x72, 0x99, 0x29, 0x6A, 0xE1, 0x9C,
+    0x70, 0x99, 0x1F, 0x73, 0xA7, 0x77, 0x20, 0x09, 0x90, 0x9D, 0x19, 0xA1, 0x99, 0x00, 0x99, 0x77,
+    0x3A, 0x1C, 0x97, 0x71, 0xC9, 0x2C, 0xA7, 0x6A, 0xC9, 0x49, 0xDA, 0x96, 0x99, 0xDA, 0x70, 0x9A,
+    0xFF, 0xCA, 0x97, 0x77, 0x50, 0x49, 0xAA, 0xFE, 0xAA, 0x97, 0x09, 0xDA, 0x99, 0x59, 0xAD, 0xA5,
+    0xD9, 0x75, 0xAC, 0x92, 0xCA, 0x77, 0x1C, 0x90, 0x9A, 0x77, 0x3C, 0x77, 0x70, 0x77, 0x59, 0x77,
+    0x72, 0xDA, 0x2A, 0xFF, 0xFF, 0xFF, 0xCA, 0x0A, 0xFF, 0xFF, 0xFF, 0xD7, 0x76, 0xE9, 0x77, 0x7C,
+    0x97, 0x77, 0x70, 0x71, 0xE9, 0x77, 0x1A, 0xEA, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xC9, 0x77, 0xAD,
+    0xAE, 0x77, 0xE0, 0xE7, 0x69, 0xDA, 0x0A, 0xDA, 0x75, 0xE9, 0x09, 0xE7, 0x5E, 0x2E, 0x97, 0x3A,
+    0xDA, 0x2A, 0xDA, 0x73, 0xE9, 0x29, 0xE7, 0x29, 0xE4, 0xE9, 0x71, 0xAD, 0xA4, 0xAE, 0x71, 0xE9,
+    0x49, 0xE7, 0x09, 0xE6, 0xEA, 0x7E, 0xA6, 0xAE, 0x7E, 0x97, 0xE9, 0x5A, 0xFF, 0xFF, 0x5F, 0xFF,
+    0xFC, 0x49, 0xFF, 0xFF, 0xCA, 0x3F, 0xFF, 0xFE, 0x3F, 0x72, 0xF9, 0x1A, 0xEA, 0x72, 0xAE, 0xA1,
+    0xF9, 0x72, 0x9F, 0x09, 0xF7, 0x4F, 0x90, 0x09, 0x99, 0x99, 0x99, 0x99, 0x70, 0x9F, 0xFE, 0xA5,
+    0x9F, 0xFF, 0xC4, 0x9E, 0x6A, 0xE3, 0x9E, 0x7A, 0xD9, 0x29, 0xE7, 0x0D, 0xA2, 0x9E, 0x70, 0xDA,
+    0x29, 0xE7, 0x9D, 0xA2, 0x9E, 0x69, 0xE3, 0x9F, 0xFF, 0xC9, 0x39, 0xFF, 0xEA, 0x59, 0xFF, 0xFC,
+    0xA3, 0x9E, 0x69, 0xF9, 0x19, 0xE7, 0x0A, 0xE1, 0x9E, 0x71, 0xE9, 0x09, 0xE7, 0x1A, 0xDA, 0x09,
+    0xE7, 0x1F, 0x09, 0xE7, 0x1F, 0x09, 0xE7, 0x09, 0xF0, 0x9E, 0x7A, 0xFC, 0x09, 0xFF, 0xFF, 0xA0,
+    0x9F, 0xFF, 0xF9, 0x09, 0xFF, 0xFE, 0xA1, 0x9F, 0xFF, 0xDA, 0x29, 0xFF, 0xFA, 0x40, 0xAF, 0xFE,
+    0x9A, 0xFF, 0xE9, 0xAF, 0xFE, 0x9A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A,
+    0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1A,
+    0xD7, 0x1A, 0xD7, 0x1A, 0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70,
+    0xAD, 0xA7, 0x75, 0x77, 0x74, 0x9E, 0x97, 0x7F, 0xC7, 0x69, 0xFC, 0x76, 0xFD, 0xA7, 0x49, 0xE9,
+    0xE7, 0x4A, 0xE0, 0xEA, 0x73, 0xE9, 0x09, 0xE7, 0x2A, 0xE2, 0xEA, 0x71, 0xEA, 0x2A, 0xE7, 0x0A,
+    0xE4, 0xEA, 0x7E, 0xA4, 0xAE, 0x6A, 0xE9, 0x49, 0xEA, 0x5F, 0x6F, 0x49, 0xE9, 0x69, 0xEA, 0x3F,
+    0x70, 0xF2, 0x9E, 0xA7, 0x0A, 0xE9, 0x1F, 0x71, 0x9F, 0x09, 0xF7, 0x2F, 0x9A, 0xFF, 0xFF, 0xEA,
+    0xAF, 0xFF, 0xFE, 0xAA, 0xFF, 0xFF, 0xEA, 0x72, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xCA, 0x1A, 0xFF,
+    0xFC, 0xA1, 0xFF, 0xFC, 0xA2, 0xEA, 0x97, 0x3E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E,
+    0x97, 0x4E, 0xA9, 0x99, 0x9A, 0xAA, 0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x94, 0xFF, 0xE9, 0x4E, 0xA7,
+    0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xFF, 0xFD, 0x90, 0x9F,
+    0xFF, 0xDA, 0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x90, 0x2A, 0xFF, 0xFF, 0xD4,
+    0xFF, 0xFF, 0xCA, 0x4F, 0xFF, 0xFC, 0xA4, 0xAF, 0xFF, 0xFA, 0x77, 0x0F, 0xC9, 0x77, 0xFD, 0x77,
+    0xFD, 0x77, 0xFD, 0x77, 0xFD, 0x97, 0x6F, 0xD9, 0x76, 0xFD, 0xA7, 0x6F, 0xDA, 0x76, 0xAF, 0xD7,
+    0x6A, 0xFD, 0x76, 0xAF, 0xD7, 0x6A, 0xFD, 0x97, 0x5A, 0xFD, 0x97, 0x5A, 0xFD, 0xA7, 0x5A, 0xFD,
+    0xA7, 0x5A, 0xFE, 0x75, 0x9F, 0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0xF9, 0x09, 0xFF, 0xFF, 0xFA, 0x09,
+    0xFF, 0xFF, 0xFC, 0x09, 0xFF, 0xFF, 0xFC, 0x00, 0x09, 0xAA, 0x97, 0x29, 0xAA, 0x91, 0xEA, 0x72,
+    0xEA, 0x1E, 0xA7, 0x2F, 0x1E, 0xA7, 0x2F, 0x1F, 0x72, 0xF1, 0xF7, 0x2F, 0x1F, 0x72, 0xF1, 0xF7,
+    0x2F, 0x1F, 0x72, 0xF1, 0xF7, 0x2F, 0x1F, 0x72, 0xF1, 0xF7, 0x2F, 0x1F, 0x72, 0xF1, 0xFA, 0x99,
+    0x99, 0x99, 0x99, 0x9A, 0xF1, 0xFF, 0xFF, 0xE9, 0x0F, 0xFF, 0xFE, 0x90, 0xFF, 0xFF, 0xE9, 0x9F,
+    0xFF, 0xFE, 0x99, 0xFF, 0xFF, 0xE9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97,
+    0x09, 0xFA, 0x9F, 0x97, 0x09, 0xFA, 0x9F, 0x97, 0x0A, 0xFA, 0x9F, 0xA7, 0x0A, 0xFA, 0x69, 0xAF,
+    0xCA, 0x97, 0x39, 0xFF, 0xEA, 0x70, 0xAF, 0xDA, 0xFE, 0x95, 0xFC, 0xA4, 0x9F, 0xC9, 0x3A, 0xF9,
+    0x7F, 0xC3, 0xF9, 0x71, 0xFA, 0x1A, 0xEA, 0x72, 0x9F, 0x1F, 0x74, 0xF9, 0x0F, 0x74, 0x9E, 0x99,
+    0xE9, 0x75, 0xEA, 0x9E, 0x79, 0x99, 0x92, 0xEA, 0x9E, 0x2F, 0xFC, 0x2A, 0xE9, 0xE1, 0x9F, 0xEA,
+    0xA2, 0xAE, 0x9E, 0x76, 0xAD, 0xA9, 0xE7, 0x6E, 0xA9, 0xE9, 0x75, 0xEA, 0x0F, 0x74, 0xAE, 0x90,
+    0xFC, 0x72, 0xAF, 0x1A, 0xFD, 0x99, 0x29, 0x9A, 0xFD, 0x2F, 0xFF, 0xFE, 0xA2, 0xAF, 0xFF, 0xFD,
+    0x4F, 0xFF, 0xFC, 0xA5, 0xFF, 0xFE, 0xA7, 0xAF, 0xFF, 0x97, 0x29, 0xAF, 0xDA, 0x97, 0x77, 0x40,
+    0xAA, 0xAA, 0x90, 0xAE, 0x90, 0xAE, 0x90, 0xAE, 0x90, 0x9E, 0x90, 0x9E, 0x90, 0x9E, 0x90, 0x9E,
+    0x90, 0x9E, 0x90, 0x9E, 0x90, 0x9E, 0x90, 0x9E, 0x90, 0x9E, 0x90, 0x9E, 0x90, 0x9E, 0xA0, 0x9E,
+    0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9F, 0x0A, 0xF0, 0xAF, 0x0A, 0xF0, 0xFC, 0x0F, 0xC0, 0xFC, 0x00,
+    0x19, 0xE4, 0x9F, 0x59, 0xE4, 0xF9, 0x5A, 0xE3, 0x9E, 0xA6, 0xAE, 0x3F, 0x7A, 0xE2, 0xAE, 0xA7,
+    0xF1, 0x9F, 0x70, 0xEA, 0x1F, 0x97, 0x0E, 0xA0, 0x9E, 0xA7, 0x1E, 0xA0, 0xF7, 0x2E, 0xAA, 0xEA,
+    0x72, 0xFF, 0x72, 0x9F, 0xE9, 0x72, 0x9F, 0xDA, 0x73, 0x9F, 0xD9, 0x73, 0xAF, 0xE7, 0x3A, 0xFF,
+    0x72, 0xAF, 0xFC, 0x71, 0xF0, 0xFD, 0x70, 0xF1, 0xFD, 0x7F, 0x19, 0xFD, 0x6F, 0x2A, 0xFD, 0x5F,
+    0x3F, 0xE3, 0x9F, 0x4F, 0xE2, 0x9F, 0x49, 0xFE, 0x19, 0xF5, 0xAF, 0xE0, 0x7F, 0xE9, 0x77, 0xFE,
+    0xA7, 0x69, 0xFF, 0x76, 0xFF, 0xC7, 0x6F, 0xFC, 0xA7, 0x49, 0xFF, 0xD7, 0x4A, 0xFF, 0xD7, 0x4F,
+    0xA0, 0xAF, 0xA7, 0x29, 0xF9, 0x1F, 0xC7, 0x2A, 0xF2, 0xAF, 0x72, 0xFA, 0x29, 0xFA, 0x70, 0x9F,
+    0x4F, 0xC7, 0x0A, 0xF4, 0x9F, 0x70, 0xF9, 0x5F, 0xA7, 0xF6, 0xAF, 0x6A, 0xEA, 0x7F, 0x6F, 0x97,
+    0xFA, 0x5F, 0x70, 0x9F, 0x4A, 0xEA, 0x71, 0xF4, 0xF7, 0x2A, 0xEA, 0x3F, 0x73, 0xF2, 0x9E, 0x97,
+    0x3F, 0x2F, 0x74, 0x9E, 0xA1, 0xEA, 0x75, 0xF0, 0x9A, 0xAA, 0x97, 0x59, 0xAA, 0xA0, 0x1A, 0xAA,
+    0xAA, 0x73, 0xAA, 0xAA, 0x93, 0xFC, 0x97, 0x19, 0xFA, 0x3F, 0xCA, 0x71, 0xFD, 0x29, 0xFD, 0x71,
+    0xFD, 0x29, 0xFD, 0xA7, 0xAF, 0xD2, 0x9F, 0xE7, 0xFE, 0x29, 0xFE, 0x95, 0x9F, 0xE2, 0xAF, 0xF5,
+    0xFF, 0x2A, 0xEA, 0xF5, 0xFA, 0xE9, 0x1A, 0xE9, 0xFA, 0x3A, 0xEA, 0xAE, 0x91, 0xAE, 0x0F, 0xC3,
+    0xF9, 0xAE, 0x91, 0xAE, 0x09, 0xF9, 0x19, 0xF0, 0xAE, 0xA1, 0xF1, 0xFC, 0x1F, 0xA0, 0xAE, 0xA1,
+    0xF1, 0xAF, 0x1F, 0x1F, 0xA1, 0xF2, 0xFA, 0xAF, 0x1F, 0xC1, 0xF2, 0xFF, 0xC9, 0x1F, 0xC1, 0xF9,
+    0x19, 0xFF, 0x2F, 0xC1, 0xF9, 0x2F, 0xF2, 0xFC, 0x1F, 0x92, 0xAF, 0xD9, 0x2F, 0xC1, 0xF9, 0x3F,
+    0xD3, 0xFC, 0x1F, 0xA3, 0xFC, 0xA2, 0x9F, 0xC0, 0x9F, 0xA3, 0x9F, 0x92, 0x9F, 0xC9, 0x9F, 0xA4,
+    0xF3, 0x9F, 0xC9, 0x9F, 0xA7, 0x4A, 0xFC, 0x99, 0xFC, 0x74, 0xAF, 0xCA, 0x77, 0x0A, 0xAA, 0xA1,
+    0x9E, 0xA7, 0x1F, 0x1A, 0xF7, 0x1F, 0x1A, 0xFA, 0x70, 0xEA, 0x1F, 0xD7, 0x0E, 0xA1, 0xFD, 0xA7,
+    0xEA, 0x1F, 0xE6, 0x9E, 0xA1, 0xFE, 0x95, 0x9E, 0x91, 0xEA, 0xF5, 0x9E, 0x91, 0xEA, 0xAE, 0x94,
+    0xAE, 0x90, 0x9E, 0xA0, 0xF4, 0xAE, 0x90, 0x9E, 0xA0, 0xAE, 0x93, 0xAE, 0x90, 0x9E, 0xA1, 0xF3,
+    0xF1, 0xAE, 0xA1, 0xAE, 0x92, 0xF1, 0xAE, 0xA2, 0xF2, 0xF1, 0xAE, 0xA2, 0xAE, 0x91, 0xF1, 0xFC,
+    0x3E, 0xA1, 0xF1, 0xFC, 0x3F, 0x1F, 0x1F, 0xC3, 0x9E, 0xA9, 0xF1, 0xFC, 0x4F, 0x9F, 0x1F, 0xC4,
+    0x9F, 0xF1, 0xFC, 0x5F, 0xEA, 0x09, 0xFC, 0x59, 0xFD, 0xA0, 0x9F, 0xC6, 0xFD, 0xA0, 0x9F, 0xC6,
+    0x9F, 0xCA, 0x00, 0x0A, 0xFF, 0xFE, 0x1A, 0xFF, 0xFE, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0x99, 0x99, 0x99, 0x99, 0x97, 0xFF,
+    0xD7, 0xFF, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5A, 0xFF, 0xFF, 0xCA, 0xFF, 0xFF, 0xCA, 0xFF,
+    0xFF, 0xC0, 0x69, 0xAF, 0xCA, 0x97, 0x39, 0xFF, 0xEA, 0x70, 0xAF, 0xDA, 0xFE, 0x95, 0xFC, 0xA4,
+    0x9F, 0xC9, 0x3A, 0xF9, 0x7F, 0xC3, 0xF9, 0x71, 0xFA, 0x1A, 0xEA, 0x72, 0x9F, 0x1F, 0x74, 0xF9,
+    0x0F, 0x74, 0x9E, 0x99, 0xE9, 0x75, 0xEA, 0x9E, 0x76, 0xEA, 0x9E, 0x76, 0xAE, 0x9E, 0x76, 0xAE,
+    0x9E, 0x76, 0xAD, 0xA9, 0xE7, 0x6E, 0xA9, 0xE9, 0x75, 0xEA, 0x0F, 0x74, 0xAE, 0x90, 0xFC, 0x72,
+    0xAF, 0x1A, 0xFD, 0x99, 0x29, 0x9A, 0xFD, 0x2F, 0xFF, 0xFE, 0xA2, 0xAF, 0xFF, 0xFD, 0x4F, 0xFF,
+    0xFC, 0xA5, 0xFF, 0xFE, 0xA7, 0xAF, 0xFF, 0x97, 0x29, 0xAF, 0xDA, 0x97, 0x77, 0x40, 0xAF, 0xFF,
+    0xAA, 0xFF, 0xFC, 0xAD, 0x7A, 0xDA, 0xD7, 0xAD, 0xAD, 0x7A, 0xDA, 0xD7, 0xAD, 0xAD, 0x7A, 0xDA,
+    0xD7, 0xAD, 0xAD, 0x7A, 0xDA, 0xD7, 0xAD, 0xAD, 0x7A, 0xDA, 0xD7, 0xAD, 0xAD, 0x7A, 0xDA, 0xD7,
+    0xAD, 0xAD, 0x7A, 0xDA, 0xD7, 0xAD, 0xAD, 0x7A, 0xDA, 0xD7, 0xAD, 0xAD, 0x7A, 0xDA, 0xD7, 0xAD,
+    0xAD, 0x7A, 0xD0, 0x09, 0xFF, 0xCA, 0x59, 0xFF, 0xEA, 0x3A, 0xEA, 0xAA, 0xFE, 0x2A, 0xDA, 0x59,
+    0xF1, 0xAD, 0xA7, 0xE1, 0xAD, 0xA7, 0xAD, 0x90, 0xAD, 0xA7, 0xAD, 0xA0, 0xEA, 0x7E, 0x90, 0xEA,
+    0x7E, 0x90, 0xEA, 0x5A, 0xF1, 0xFF, 0xFD, 0xA1, 0xFF, 0xFD, 0x2F, 0xFF, 0x93, 0xFC, 0xAA, 0xAA,
+    0x96, 0xF7, 0x4F, 0x73, 0x9F, 0x73, 0x9F, 0x73, 0x9F, 0x73, 0x9F, 0x73, 0xAF, 0x73, 0xAF, 0x73,
+    0xAF, 0x97, 0x2A, 0xF9, 0x72, 0xAF, 0x97, 0x20, 0xAF, 0xFF, 0x0A, 0xFF, 0xF0, 0x9C, 0xA7, 0x39,
+    0xCA, 0x73, 0x9C, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0x97, 0x3A, 0xC9, 0x73, 0xAC, 0x97, 0x3A, 0xC7,
+    0x4C, 0x73, 0xD7, 0x2D, 0x97, 0x1D, 0x97, 0x1D, 0xA7, 0x09, 0xDA, 0x70, 0x9D, 0xA7, 0x09, 0xE7,
+    0x1A, 0xFF, 0xF0, 0xAF, 0xFF, 0x0A, 0xFF, 0xF7, 0x60, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9F,
+    0xFF, 0xFF, 0x9A, 0xA9, 0x99, 0x91, 0xE9, 0x39, 0x99, 0x97, 0x0E, 0x97, 0x70, 0xE9, 0x77, 0x0E,
+    0x97, 0x70, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xEA, 0x77, 0x0E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7,
+    0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0xAE, 0xA7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7A, 0xF7,
+    0x7A, 0xF7, 0x7A, 0xF7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x0E, 0x97, 0x29, 0xE1, 0xF7, 0x2E,
+    0xA1, 0x9E, 0x97, 0x09, 0xE3, 0xF7, 0x0F, 0x39, 0xEA, 0x6A, 0xE9, 0x4F, 0x6F, 0x59, 0xEA, 0x4A,
+    0xE9, 0x6F, 0x92, 0x9F, 0x79, 0xF2, 0xF9, 0x70, 0xF9, 0x09, 0xF7, 0x19, 0xF0, 0xF9, 0x72, 0xFF,
+    0xC7, 0x3A, 0xFE, 0x97, 0x4F, 0xE7, 0x5A, 0xFC, 0x97, 0x6F, 0xC7, 0x7F, 0xA7, 0x7F, 0xA7, 0x7F,
+    0xA7, 0x69, 0xFA, 0x76, 0xAF, 0xA7, 0x6A, 0xFA, 0x76, 0xFC, 0xA7, 0x6F, 0xCA, 0x75, 0x9F, 0xCA,
+    0x70, 0x74, 0xAC, 0xA7, 0x77, 0x1D, 0xA7, 0x77, 0x1D, 0xA7, 0x77, 0x1D, 0xA7, 0x77, 0x1D, 0xA7,
+    0x77, 0x99, 0xE9, 0x97, 0x71, 0x9F, 0xFF, 0xC9, 0x73, 0xAF, 0xFF, 0xFC, 0xA7, 0x0F, 0xDA, 0x1D,
+    0x91, 0xAF, 0xD6, 0xFD, 0x3D, 0x93, 0xFD, 0x4A, 0xFA, 0x4D, 0x94, 0xAF, 0xA2, 0x9F, 0xA5, 0xD9,
+    0x5F, 0xC2, 0xAF, 0x6D, 0x95, 0x9F, 0xA1, 0xFA, 0x6D, 0x96, 0xFC, 0x1F, 0x7D, 0x96, 0x9F, 0x1F,
+    0x69, 0xD9, 0x69, 0xF1, 0xF6, 0x9D, 0x70, 0xF1, 0xF6, 0x9D, 0x79, 0xF1, 0xF9, 0x59, 0xD7, 0xAF,
+    0x1F, 0xC5, 0x9D, 0x69, 0xFA, 0x1A, 0xFC, 0x93, 0x9D, 0x5A, 0xFC, 0x92, 0xFE, 0xAA, 0x9A, 0xD9,
+    0x99, 0xAF, 0xF3, 0xAF, 0xFF, 0xFF, 0xE9, 0x4A, 0xFF, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0xFE, 0xA7,
+    0x1A, 0xFF, 0xFE, 0xA9, 0x74, 0x9A, 0xAF, 0xFA, 0x97, 0x73, 0xAD, 0x77, 0x71, 0xAD, 0x77, 0x71,
+    0x9A, 0xA7, 0x50, 0x1A, 0xD7, 0x4A, 0xD9, 0x29, 0xE7, 0x29, 0xE4, 0xEA, 0x71, 0xE9, 0x5E, 0x97,
+    0xEA, 0x6A, 0xE6, 0xAE, 0x70, 0xEA, 0x49, 0xE9, 0x70, 0x9E, 0x93, 0xF7, 0x2F, 0x2A, 0xE7, 0x4F,
+    0x09, 0xEA, 0x74, 0xAE, 0xAF, 0x76, 0xFE, 0x97, 0x69, 0xFC, 0xA7, 0x70, 0xAF, 0x77, 0x1F, 0xC9,
+    0x77, 0xFE, 0x76, 0xAF, 0xF7, 0x49, 0xFA, 0xFA, 0x73, 0xFC, 0x0A, 0xF9, 0x71, 0xAF, 0x91, 0xFC,
+    0x70, 0x9F, 0xA2, 0x9F, 0xA7, 0xFC, 0x4A, 0xF9, 0x5F, 0xC9, 0x5F, 0xC4, 0xAF, 0xA6, 0xAF, 0xC2,
+    0x9F, 0xC7, 0x0F, 0xC9, 0x1F, 0xC9, 0x70, 0x9F, 0xC0, 0x9A, 0xA5, 0xCA, 0x5A, 0xA0, 0xAD, 0x5D,
+    0x5D, 0x9A, 0xD5, 0xD5, 0xD0, 0xAD, 0x49, 0xD5, 0xD0, 0x9D, 0x49, 0xD4, 0x9D, 0x09, 0xD4, 0x9C,
+    0xA4, 0xAD, 0x09, 0xD4, 0x9C, 0xA4, 0xE1, 0xDA, 0x39, 0xCA, 0x4D, 0xA1, 0xE3, 0x9C, 0xA3, 0xEA,
+    0x1A, 0xE2, 0x9C, 0xA2, 0xAE, 0x3F, 0x19, 0xCA, 0x1A, 0xF3, 0xAF, 0xFA, 0xFC, 0x5A, 0xFF, 0xF9,
+    0x69, 0xFF, 0xD9, 0x71, 0x99, 0xEA, 0x97, 0x6A, 0xC9, 0x77, 0x0A, 0xC9, 0x77, 0x0A, 0xC9, 0x77,
+    0x0A, 0xC9, 0x77, 0x0A, 0xC9, 0x77, 0x0D, 0x97, 0x70, 0xD7, 0x71, 0xD7, 0x71, 0xD7, 0x71, 0xD7,
+    0x10, 0x69, 0xFC, 0xA9, 0x72, 0xAF, 0xFD, 0x70, 0xF9, 0x29, 0xAE, 0x95, 0xEA, 0x69, 0xE4, 0xAE,
+    0x70, 0x9E, 0x3E, 0x97, 0x1E, 0x91, 0x9E, 0x72, 0x9E, 0x1A, 0xD9, 0x73, 0xE1, 0xE7, 0x4E, 0x90,
+    0xE7, 0x4A, 0xD9, 0x0E, 0x74, 0xAD, 0xA0, 0xE7, 0x4A, 0xDA, 0x0E, 0x74, 0xAD, 0x90, 0xE7, 0x4E,
+    0x90, 0xAD, 0x97, 0x29, 0xE1, 0x9D, 0xA7, 0x2F, 0x2E, 0x71, 0xAE, 0x93, 0xE7, 0xAE, 0x94, 0x9E,
+    0xA4, 0xF9, 0x2A, 0xFE, 0x39, 0xFE, 0xAA, 0xFE, 0x92, 0x9F, 0xEA, 0xAF, 0xE9, 0x2A, 0xFE, 0xA7,
+    0x74, 0x77, 0x71, 0xAE, 0xA0, 0x9D, 0x70, 0x9F, 0xEA, 0xD7, 0x9E, 0xAA, 0xAF, 0xC7, 0xE4, 0xAE,
+    0x6A, 0xD6, 0xE6, 0xDA, 0x6A, 0xD9, 0x5D, 0x7A, 0xD9, 0x49, 0xD7, 0x9D, 0xA4, 0x9D, 0x7A, 0xDA,
+    0x4A, 0xD7, 0xF4, 0x9D, 0x95, 0xAF, 0x49, 0xFA, 0x99, 0xAF, 0xD5, 0xFF, 0xFD, 0x59, 0xFF, 0xFC,
+    0x90, 0x9A, 0x29, 0xFF, 0x99, 0xFD, 0x4A, 0xFA, 0x19, 0xFD, 0x75, 0x9A, 0xAA, 0xA9, 0x77, 0x30,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0xA9, 0x72, 0xAF, 0xD7, 0xFF, 0xC9, 0x4A, 0xDA, 0x29, 0xE9,
+    0x3E, 0x5A, 0xD2, 0xAD, 0x96, 0xDA, 0x1A, 0xD7, 0x9D, 0x1A, 0xD7, 0xAC, 0xA1, 0xAD, 0x7D, 0x91,
+    0xAD, 0x39, 0x9A, 0xDA, 0x2A, 0xD2, 0xAF, 0x93, 0xAD, 0x2A, 0xFC, 0xA2, 0xAD, 0x6A, 0xE9, 0x0A,
+    0xD7, 0x0E, 0x0A, 0xD7, 0x0A, 0xD9, 0xAD, 0x97, 0xAD, 0xAA, 0xEA, 0x95, 0xEA, 0xAF, 0xDA, 0x2A,
+    0xEA, 0xAF, 0xFF, 0xD9, 0xAF, 0xFF, 0xD0, 0xAD, 0x09, 0xFF, 0xCA, 0x0A, 0xD3, 0xAF, 0xD1, 0xAD,
+    0x59, 0x99, 0x92, 0xAD, 0x74, 0xAD, 0x74, 0xAD, 0x74, 0xAD, 0x74, 0x9A, 0xA7, 0x40, 0x9D, 0x97,
+    0xE1, 0xE7, 0xE1, 0xAD, 0x96, 0xE2, 0xE6, 0xE2, 0xAD, 0x95, 0xE3, 0xE5, 0xE3, 0xE9, 0x39, 0xDA,
+    0x39, 0xE3, 0x9D, 0xA4, 0xEA, 0x2A, 0xD9, 0x49, 0xE2, 0xE6, 0xEA, 0x0A, 0xE6, 0xAE, 0xAE, 0x97,
+    0xFE, 0x70, 0xFD, 0xA7, 0x0F, 0xD7, 0x1A, 0xFA, 0x71, 0xAF, 0x72, 0x9F, 0x73, 0xF7, 0x3F, 0x73,
+    0xF7, 0x3F, 0x97, 0x2A, 0xE9, 0x72, 0xAE, 0xA7, 0x39, 0x95, 0x29, 0xAF, 0xDA, 0x94, 0xFF, 0xEA,
+    0x2E, 0xA1, 0x99, 0xAE, 0xA2, 0xE7, 0x09, 0x2A, 0xD7, 0x5E, 0x97, 0x39, 0xEA, 0x73, 0x9F, 0x74,
+    0xF9, 0x73, 0xAE, 0xA7, 0x29, 0x9E, 0xA6, 0x9F, 0xFA, 0x4A, 0xFF, 0xDA, 0x29, 0xF9, 0x19, 0xAE,
+    0x91, 0xF5, 0xAE, 0x09, 0xE9, 0x6E, 0x9A, 0xE7, 0xAD, 0xAA, 0xE7, 0xAE, 0x9E, 0x7A, 0xDA, 0x9E,
+    0xA6, 0xEA, 0x0F, 0xA3, 0x9F, 0x19, 0xFF, 0xFA, 0x2A, 0xFF, 0xE4, 0x9F, 0xFA, 0x7A, 0xFA, 0x40,
+    0x19, 0xAE, 0x94, 0x9C, 0xA9, 0x99, 0xCA, 0x3C, 0x93, 0x9C, 0x29, 0xC5, 0x93, 0xC9, 0x71, 0xD9,
+    0x71, 0xAE, 0x69, 0xDA, 0xA5, 0x9D, 0x70, 0xAC, 0xA3, 0x9C, 0xA1, 0xAC, 0xA3, 0x9D, 0x19, 0xD3,
+    0xAD, 0x2F, 0xAE, 0xA2, 0x9F, 0xE5, 0xAE, 0x93, 0x2F, 0xFD, 0x92, 0xFF, 0xD9, 0x69, 0xE9, 0x7A,
+    0xDA, 0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70, 0xAD, 0xA7, 0x1D, 0xA7, 0x1A, 0xD7, 0x2D, 0xA7, 0x19,
+    0xD9, 0x71, 0xAD, 0x72, 0xAD, 0x72, 0x9E, 0x72, 0xAE, 0xA9, 0x70, 0x9F, 0xDA, 0x96, 0xAF, 0xD9,
+    0x79, 0xAE, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x09, 0xE9, 0x70, 0xF7, 0x0F, 0x97, 0xFA, 0x70, 0x99,
+    0x99, 0x30, 0x9D, 0xA7, 0x4A, 0xF7, 0x5A, 0xD9, 0x09, 0xFC, 0x95, 0xFF, 0xEA, 0x4F, 0xA9, 0x2A,
+    0xD9, 0x3E, 0x95, 0xE2, 0x9E, 0x69, 0xD2, 0x9D, 0xA6, 0x9D, 0x29, 0xD9, 0x7D, 0x91, 0x9D, 0x96,
+    0x9D, 0x91, 0x9D, 0xA6, 0x9D, 0x91, 0xAD, 0xA6, 0x9D, 0x91, 0xAD, 0xA6, 0x9D, 0x91, 0xAE, 0x69,
+    0xD9, 0x1A, 0xE6, 0xAD, 0xA1, 0xF6, 0xAD, 0xA1, 0xF6, 0xAD, 0xA1, 0xF6, 0xAD, 0xA7, 0x4A, 0xDA,
+    0x74, 0xEA, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x70, 0x4A, 0xF9, 0x7A, 0xD9, 0x09,
+    0xAD, 0x59, 0xD4, 0x9D, 0x4D, 0x95, 0xAC, 0xA2, 0xAD, 0x69, 0xD2, 0xDA, 0x7D, 0x91, 0xDA, 0x7D,
+    0xA0, 0x9D, 0x97, 0xE0, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x9E, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD,
+    0x0A, 0xDA, 0x7E, 0x0A, 0xDA, 0x69, 0xE0, 0xAE, 0x6A, 0xE0, 0x9E, 0x95, 0xEA, 0x1F, 0x4A, 0xEA,
+    0x1F, 0xCA, 0x99, 0xAF, 0x91, 0xAF, 0xFF, 0x3F, 0xFE, 0xA3, 0x9F, 0xFD, 0x5A, 0xFF, 0x70, 0xAF,
+    0x94, 0x1A, 0xA4, 0x9D, 0x49, 0xD4, 0x9D, 0x49, 0xD4, 0x9D, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD,
+    0x4E, 0x4E, 0x4E, 0x4E, 0x93, 0xE9, 0x3E, 0xA2, 0x9F, 0xAC, 0x09, 0xFD, 0x09, 0xFC, 0xA0, 0x77,
+    0xDA, 0x2A, 0xD9, 0x3D, 0xA2, 0xDA, 0x4D, 0xA1, 0xE5, 0xD9, 0x09, 0xD9, 0x5D, 0x90, 0xE6, 0xD9,
+    0xAD, 0x69, 0xD9, 0xDA, 0x69, 0xFC, 0x79, 0xF9, 0x7A, 0xF9, 0x7A, 0xFC, 0x96, 0xAD, 0xAE, 0x95,
+    0xE0, 0xF9, 0x4E, 0x1F, 0x93, 0xE1, 0x9F, 0x92, 0xE2, 0xAF, 0x91, 0xDA, 0x3F, 0xC9, 0x09, 0xAA,
+    0xA9, 0x73, 0xAF, 0xCA, 0x71, 0xAF, 0xE7, 0x0A, 0xFF, 0x97, 0x19, 0xAF, 0xC7, 0x39, 0xF9, 0x73,
+    0x9F, 0x74, 0xF7, 0x4F, 0x97, 0x29, 0xFA, 0x72, 0xFD, 0x71, 0x9F, 0xD7, 0x1F, 0xE9, 0x79, 0xEA,
+    0xEA, 0x7F, 0x0A, 0xE6, 0x9E, 0x90, 0x9E, 0x6E, 0xA2, 0xE5, 0x9E, 0x3E, 0x94, 0xEA, 0x39, 0xDA,
+    0x39, 0xE5, 0xE3, 0xE9, 0x5E, 0x29, 0xDA, 0x6A, 0xD9, 0x1E, 0x70, 0xDA, 0x09, 0xDA, 0x70, 0xE0,
+    0x0E, 0x96, 0xAD, 0x90, 0xE9, 0x6A, 0xD9, 0x0E, 0x96, 0xAD, 0x90, 0xEA, 0x6A, 0xD9, 0x0E, 0xA6,
+    0xAD, 0x99, 0xEA, 0x6E, 0x99, 0xF6, 0xEA, 0x9F, 0x6E, 0xA9, 0xF6, 0xEA, 0x9F, 0x6E, 0xA9, 0xFA,
+    0x4F, 0xAA, 0xFF, 0xFD, 0xAA, 0xFF, 0xFD, 0xAA, 0xCA, 0xFF, 0xFC, 0xAC, 0x9A, 0xFF, 0x9E, 0xAC,
+    0x90, 0x9F, 0xCA, 0x09, 0xEA, 0xC9, 0x74, 0xD9, 0x74, 0xAA, 0x75, 0x77, 0x9D, 0x97, 0xE1, 0xE7,
+    0xE1, 0xAD, 0x96, 0xE2, 0xE6, 0xE2, 0xAD, 0x95, 0xE3, 0xE5, 0xE3, 0xEA, 0x39, 0xE3, 0x9E, 0x39,
+    0xE4, 0xEA, 0x2A, 0xDA, 0x49, 0xE2, 0xE6, 0xEA, 0x0A, 0xE6, 0xAE, 0xAE, 0x97, 0xFE, 0x70, 0xFD,
+    0xA7, 0x0F, 0xD9, 0x70, 0xAF, 0xC3, 0x1A, 0xFF, 0xCA, 0x3A, 0xFF, 0xCA, 0x79, 0xEA, 0x70, 0x9D,
+    0xA7, 0x2D, 0xA7, 0x2A, 0xCA, 0x73, 0xD9, 0x73, 0xDA, 0x73, 0x9E, 0x97, 0x29, 0xFD, 0x70, 0xFC,
+    0xA7, 0xE9, 0x71, 0x9D, 0x73, 0xAD, 0x73, 0x9E, 0x73, 0xFD, 0xA7, 0x0F, 0xE7, 0x29, 0xAD, 0x97,
+    0x3E, 0x73, 0xE7, 0x2A, 0xDA, 0x71, 0x9E, 0x97, 0x09, 0xEA, 0x70, 0x9F, 0x77, 0x10, 0x4A, 0xFA,
+    0x96, 0xAF, 0xFA, 0x4A, 0xFA, 0xAF, 0xC2, 0x9E, 0x5A, 0xD9, 0x1E, 0x7E, 0x1D, 0xA7, 0x9D, 0x99,
+    0xD9, 0x79, 0xDA, 0xAD, 0x97, 0x0D, 0xAA, 0xD9, 0x79, 0xDA, 0x9D, 0xA7, 0x9D, 0xA0, 0xE7, 0xE9,
+    0x0F, 0xA9, 0x99, 0x9A, 0xF2, 0xFF, 0xF9, 0x2A, 0xFF, 0xDA, 0x49, 0xFF, 0xA7, 0xAF, 0xA4, 0xAF,
+    0xFF, 0xEA, 0xAF, 0xFF, 0xEA, 0x2A, 0xD3, 0x9D, 0xA5, 0xAD, 0x39, 0xD9, 0x5E, 0x39, 0xD6, 0xE3,
+    0xAD, 0x6D, 0xA3, 0xAD, 0x6D, 0xA3, 0xE6, 0xDA, 0x3D, 0xA6, 0xD9, 0x3D, 0xA5, 0x9D, 0x93, 0xD9,
+    0x59, 0xD9, 0x29, 0xD9, 0x59, 0xD3, 0x9E, 0x99, 0x3A, 0xD3, 0x9F, 0xC3, 0xAD, 0x4F, 0xC7, 0x72,
+    0x79, 0xAA, 0xA9, 0x71, 0x9F, 0xE7, 0xAF, 0xFC, 0x5A, 0xE9, 0x29, 0xDA, 0x4E, 0x59, 0xD9, 0x2A,
+    0xDA, 0x6D, 0xA2, 0xEA, 0x6D, 0xA2, 0xE9, 0x6E, 0x2E, 0x96, 0xE1, 0x9E, 0xA6, 0xE1, 0xAF, 0x59,
+    0xDA, 0x1F, 0xD9, 0x29, 0xE9, 0x1F, 0xFF, 0xD2, 0xFF, 0xFC, 0x91, 0x9E, 0x9F, 0xFA, 0x29, 0xE1,
+    0xAF, 0xC9, 0x3A, 0xE4, 0x96, 0xEA, 0x74, 0xEA, 0x74, 0xE9, 0x73, 0x9E, 0x97, 0x3A, 0xE7, 0x77,
+    0x50, 0x76, 0x9F, 0xA4, 0xFF, 0x91, 0xDA, 0x3A, 0xD9, 0x9D, 0x69, 0x0A, 0xCA, 0x70, 0xAC, 0x97,
+    0x0A, 0xC9, 0x70, 0xAC, 0xA7, 0x09, 0xD7, 0x1E, 0x71, 0xE7, 0x09, 0xE9, 0x79, 0xE9, 0x7A, 0xDA,
+    0x7A, 0xDA, 0x7A, 0xDA, 0x7A, 0xDA, 0x7A, 0xDA, 0x71, 0x99, 0x30, 0x4A, 0xFF, 0xFC, 0x92, 0xAF,
+    0xFF, 0xDA, 0x2A, 0xFA, 0xAF, 0xC6, 0x9E, 0x5A, 0xD9, 0x5E, 0x7E, 0x5D, 0xA7, 0x9D, 0x93, 0x9D,
+    0x97, 0x9D, 0xA3, 0xAD, 0x97, 0x0D, 0xA3, 0xAD, 0x97, 0x9D, 0xA3, 0x9D, 0xA7, 0x9D, 0xA4, 0xE7,
+    0xE9, 0x4F, 0xA9, 0x99, 0x9A, 0xF6, 0xFF, 0xF9, 0x6A, 0xFF, 0xDA, 0x70, 0x9F, 0xFA, 0x73, 0xAF,
+    0xA7, 0x00, 0xAF, 0xFF, 0xDA, 0xFF, 0xFD, 0x59, 0xD9, 0x72, 0x9D, 0x73, 0xAD, 0x73, 0xAD, 0x73,
+    0xE7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3D, 0x97, 0x29, 0xD9, 0x72, 0x9D, 0x97, 0x2A, 0xDA, 0x97, 0x1A,
+    0xFC, 0x71, 0xFC, 0x77, 0x20, 0xAC, 0x94, 0xAC, 0x91, 0xAC, 0xA4, 0x9D, 0x1A, 0xCA, 0x5D, 0x90,
+    0x9D, 0x59, 0xD0, 0x9D, 0x59, 0xD0, 0x9D, 0x6D, 0x09, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD9, 0x5D,
+    0xA0, 0xD9, 0x5D, 0xA0, 0xE5, 0xDA, 0x0E, 0xA3, 0xAD, 0xA0, 0xAF, 0xFD, 0x90, 0x9F, 0xFD, 0x2F,
+    0xFC, 0xA3, 0xFE, 0x95, 0x99, 0xA9, 0x93, 0x72, 0x97, 0x74, 0x9C, 0xA7, 0x73, 0x9C, 0xA7, 0x73,
+    0x9C, 0xA7, 0x73, 0x9C, 0xA7, 0x73, 0x9C, 0xA7, 0x73, 0x9C, 0xA7, 0x70, 0x9A, 0xFD, 0xA7, 0x39,
+    0xFF, 0xF7, 0x0F, 0xFF, 0xE9, 0x5F, 0xCA, 0x0A, 0xCA, 0x09, 0xFC, 0x93, 0xAF, 0x91, 0xAC, 0xA2,
+    0xFC, 0x3F, 0x92, 0xAC, 0x93, 0xFA, 0x1A, 0xEA, 0x3A, 0xC9, 0x39, 0xF1, 0xF4, 0xAC, 0x94, 0xF9,
+    0x0F, 0x4A, 0xC9, 0x49, 0xE9, 0x9E, 0x94, 0xAC, 0x95, 0xEA, 0x9E, 0x94, 0xAC, 0x95, 0xEA, 0x9E,
+    0x5A, 0xC9, 0x5F, 0x9E, 0x5A, 0xC9, 0x5A, 0xE9, 0xE5, 0xAC, 0x95, 0xAD, 0xA9, 0xE5, 0xAC, 0x95,
+    0xEA, 0x9E, 0x94, 0xD9, 0x5E, 0xA0, 0xF4, 0xD9, 0x4A, 0xE9, 0x0F, 0xC3, 0xD4, 0xAF, 0x1A, 0xFC,
+    0xA9, 0x0D, 0x90, 0x9A, 0xFD, 0x2F, 0xFF, 0xFE, 0xA2, 0xAF, 0xFF, 0xFD, 0x4F, 0xFF, 0xFC, 0xA5,
+    0xFF, 0xFE, 0xA7, 0xAF, 0xFF, 0x97, 0x2A, 0xAF, 0xDA, 0x97, 0x7D, 0x77, 0x4D, 0x77, 0x4D, 0x77,
+    0x77, 0x10, 0x0D, 0xA9, 0x71, 0xAC, 0xA2, 0xFC, 0x96, 0x9D, 0x3F, 0xDA, 0x5D, 0xA3, 0x9A, 0xFC,
+    0x93, 0xE7, 0x9F, 0x2A, 0xD9, 0x71, 0xEA, 0x09, 0xE7, 0x29, 0xE0, 0xE7, 0x4F, 0xDA, 0x74, 0x9F,
+    0xC7, 0x6F, 0x97, 0x6F, 0x76, 0x9F, 0xA7, 0x5F, 0xD7, 0x4F, 0xEA, 0x72, 0xAE, 0x9A, 0xE7, 0x2F,
+    0x09, 0xE9, 0x70, 0xF9, 0x1F, 0x7A, 0xEA, 0x29, 0xF9, 0x49, 0xF4, 0xFE, 0xA1, 0xF9, 0x49, 0xFD,
+    0xA0, 0xAF, 0x6A, 0xFC, 0xA9, 0xF9, 0x79, 0xAE, 0xA0, 0x59, 0x74, 0x9C, 0xA7, 0x39, 0xCA, 0x73,
+    0x9C, 0xA7, 0x92, 0x9C, 0xA6, 0xAC, 0xA2, 0xD1, 0x9C, 0xA1, 0xAC, 0xA2, 0xD2, 0xD9, 0x09, 0xD2,
+    0xD2, 0x9D, 0x09, 0xD2, 0xD3, 0xD0, 0x9D, 0x2D, 0x3D, 0x09, 0xD2, 0xD3, 0xD9, 0x0D, 0x2D, 0x3D,
+    0xA0, 0xD2, 0xD3, 0xAC, 0xA0, 0xD9, 0x1D, 0x92, 0xAC, 0xA0, 0xE1, 0xAC, 0x92, 0xDA, 0x0E, 0x90,
+    0xAC, 0x91, 0x9D, 0xA0, 0xAF, 0xDA, 0xAF, 0xA0, 0x9F, 0xFF, 0x91, 0xFF, 0xF3, 0xFF, 0xD5, 0x9F,
+    0xCA, 0x97, 0x09, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x74, 0x99, 0x50, 0x39, 0xAA,
+    0x70, 0x99, 0x7D, 0xA7, 0x0D, 0xA5, 0xE7, 0x1E, 0x49, 0xD9, 0x71, 0x9D, 0x93, 0xE7, 0x3D, 0xA3,
+    0xDA, 0x73, 0xDA, 0x29, 0xD9, 0x4C, 0x5A, 0xD2, 0xAD, 0x93, 0x9C, 0x5A, 0xD2, 0xAD, 0x93, 0x9C,
+    0x94, 0xAD, 0x2A, 0xD9, 0x39, 0xC9, 0x4E, 0x29, 0xDA, 0x3A, 0xCA, 0x39, 0xDA, 0x3E, 0xA1, 0x9E,
+    0x91, 0xAE, 0x93, 0x9F, 0xFF, 0xEA, 0x59, 0xFD, 0x0F, 0xE7, 0x09, 0xAA, 0xA2, 0xF9, 0x77, 0x72,
+    0x71, 0xE9, 0x77, 0x1A, 0xEA, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xC9, 0x77, 0xAD, 0xAE, 0x77, 0xE0,
+    0xE7, 0x69, 0xDA, 0x0A, 0xDA, 0x75, 0xE9, 0x09, 0xE7, 0x5E, 0x2E, 0x97, 0x3A, 0xDA, 0x2A, 0xDA,
+    0x73, 0xE9, 0x29, 0xE7, 0x29, 0xE4, 0xE9, 0x71, 0xAD, 0xA4, 0xAE, 0x71, 0xE9, 0x49, 0xE7, 0x09,
+    0xE6, 0xEA, 0x7E, 0xA6, 0xAE, 0x7E, 0x97, 0xE9, 0x5A, 0xFF, 0xFF, 0x5F, 0xFF, 0xFC, 0x49, 0xFF,
+    0xFF, 0xCA, 0x3F, 0xFF, 0xFE, 0x3F, 0x72, 0xF9, 0x1A, 0xEA, 0x72, 0xAE, 0xA1, 0xF9, 0x72, 0x9F,
+    0x09, 0xF7, 0x4F, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xE7, 0x72, 0x9E, 0x77, 0x2A, 0xE9,
+    0x77, 0x1A, 0xEA, 0x77, 0x1F, 0xA7, 0x00, 0x77, 0x6A, 0xEA, 0x09, 0xD5, 0x9F, 0xEA, 0xD4, 0x9E,
+    0xAA, 0xAF, 0xC4, 0xE4, 0xAE, 0x3A, 0xD6, 0xE3, 0xDA, 0x6A, 0xD9, 0x2D, 0x7A, 0xD9, 0x19, 0xD7,
+    0x9D, 0xA1, 0x9D, 0x7A, 0xDA, 0x1A, 0xD7, 0xF1, 0x9D, 0x95, 0xAF, 0x2F, 0xA9, 0x9A, 0xFD, 0x2F,
+    0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0x9F, 0xF9, 0x9D, 0x94, 0xAF, 0xA1, 0x9D, 0x97, 0x77, 0x77, 0x77,
+    0x09, 0xE7, 0x4A, 0xE7, 0x4F, 0x74, 0xF9, 0x73, 0xF9, 0x50, 0x70, 0xAE, 0xA7, 0x70, 0x9A, 0x90,
+    0x9D, 0x77, 0x4D, 0x77, 0x3A, 0xCA, 0x77, 0x2D, 0x97, 0x73, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x75, 0xE9, 0x77, 0x1A, 0xEA, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xC9, 0x77,
+    0xAD, 0xAE, 0x77, 0xE0, 0xE7, 0x69, 0xDA, 0x0A, 0xDA, 0x75, 0xE9, 0x09, 0xE7, 0x5E, 0x2E, 0x97,
+    0x3A, 0xDA, 0x2A, 0xDA, 0x73, 0xE9, 0x29, 0xE7, 0x29, 0xE4, 0xE9, 0x71, 0xAD, 0xA4, 0xAE, 0x71,
+    0xE9, 0x49, 0xE7, 0x09, 0xE6, 0xEA, 0x7E, 0xA6, 0xAE, 0x7E, 0x97, 0xE9, 0x5A, 0xFF, 0xFF, 0x5F,
+    0xFF, 0xFC, 0x49, 0xFF, 0xFF, 0xCA, 0x3F, 0xFF, 0xFE, 0x3F, 0x72, 0xF9, 0x1A, 0xEA, 0x72, 0xAE,
+    0xA1, 0xF9, 0x72, 0x9F, 0x09, 0xF7, 0x4F, 0x90, 0x5A, 0xEA, 0x73, 0xA1, 0x9C, 0xA7, 0x6C, 0xA7,
+    0x5D, 0x75, 0xAC, 0x76, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xEA, 0x09, 0xD5, 0x9F, 0xEA,
+    0xD4, 0x9E, 0xAA, 0xAF, 0xC4, 0xE4, 0xAE, 0x3A, 0xD6, 0xE3, 0xDA, 0x6A, 0xD9, 0x2D, 0x7A, 0xD9,
+    0x19, 0xD7, 0x9D, 0xA1, 0x9D, 0x7A, 0xDA, 0x1A, 0xD7, 0xF1, 0x9D, 0x95, 0xAF, 0x2F, 0xA9, 0x9A,
+    0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0x9F, 0xF9, 0x9D, 0x94, 0xAF, 0xA1, 0x9D, 0x90, 0x73,
+    0x9A, 0x97, 0x73, 0xD7, 0x73, 0x9D, 0x77, 0x3D, 0xA7, 0x72, 0x9D, 0x77, 0x3E, 0x77, 0x77, 0x72,
+    0xAC, 0x97, 0x72, 0x9E, 0x77, 0x2F, 0xA7, 0x70, 0xD9, 0x0A, 0xCA, 0x76, 0xD3, 0x9C, 0xA7, 0x4A,
+    0xA6, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4E, 0x97, 0x71, 0xAE, 0xA7, 0x71, 0xFC, 0x77, 0x09,
+    0xFC, 0x97, 0x7A, 0xDA, 0xE7, 0x7E, 0x0E, 0x76, 0x9D, 0xA0, 0xAD, 0xA7, 0x5E, 0x90, 0x9E, 0x75,
+    0xE2, 0xE9, 0x73, 0xAD, 0xA2, 0xAD, 0xA7, 0x3E, 0x92, 0x9E, 0x72, 0x9E, 0x4E, 0x97, 0x1A, 0xDA,
+    0x4A, 0xE7, 0x1E, 0x94, 0x9E, 0x70, 0x9E, 0x6E, 0xA7, 0xEA, 0x6A, 0xE7, 0xE9, 0x7E, 0x95, 0xAF,
+    0xFF, 0xF5, 0xFF, 0xFF, 0xC4, 0x9F, 0xFF, 0xFC, 0xA3, 0xFF, 0xFF, 0xE3, 0xF7, 0x2F, 0x91, 0xAE,
+    0xA7, 0x2A, 0xEA, 0x1F, 0x97, 0x29, 0xF0, 0x9F, 0x74, 0xF9, 0x77, 0xAA, 0x76, 0xAC, 0xA7, 0x6D,
+    0x76, 0xAD, 0x76, 0xDA, 0x75, 0xAD, 0x77, 0x77, 0x77, 0x76, 0xAC, 0xA7, 0x59, 0xE7, 0x49, 0xFC,
+    0x72, 0x9D, 0x90, 0x9D, 0x70, 0x9C, 0xA4, 0xD7, 0xA9, 0x6A, 0xA7, 0x77, 0x3A, 0xEA, 0x09, 0xD6,
+    0x9F, 0xEA, 0xD5, 0x9E, 0xAA, 0xAF, 0xC5, 0xE4, 0xAE, 0x4A, 0xD6, 0xE4, 0xDA, 0x6A, 0xD9, 0x3D,
+    0x7A, 0xD9, 0x29, 0xD7, 0x9D, 0xA2, 0x9D, 0x7A, 0xDA, 0x2A, 0xD7, 0xF2, 0x9D, 0x95, 0xAF, 0x3F,
+    0xA9, 0x9A, 0xFD, 0x3F, 0xFF, 0xD3, 0x9F, 0xFF, 0xC4, 0x9F, 0xF9, 0x9D, 0x95, 0xAF, 0xA1, 0x9D,
+    0x90, 0x0A, 0xAA, 0x77, 0x6E, 0x77, 0x6E, 0x97, 0x75, 0xEA, 0x3A, 0xC9, 0x76, 0x99, 0xAA, 0x19,
+    0xE7, 0x74, 0xFA, 0x77, 0x2D, 0x90, 0xAC, 0xA7, 0x70, 0xD3, 0x9C, 0xA7, 0x6A, 0xA6, 0xAA, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x74, 0xE9, 0x77, 0x3A, 0xEA, 0x77, 0x3F, 0xC7, 0x72, 0x9F, 0xC9, 0x77,
+    0x1A, 0xDA, 0xE7, 0x71, 0xE0, 0xE7, 0x70, 0x9D, 0xA0, 0xAD, 0xA7, 0x7E, 0x90, 0x9E, 0x77, 0xE2,
+    0xE9, 0x75, 0xAD, 0xA2, 0xAD, 0xA7, 0x5E, 0x92, 0x9E, 0x74, 0x9E, 0x4E, 0x97, 0x3A, 0xDA, 0x4A,
+    0xE7, 0x3E, 0x94, 0x9E, 0x72, 0x9E, 0x6E, 0xA7, 0x1E, 0xA6, 0xAE, 0x71, 0xE9, 0x7E, 0x97, 0xAF,
+    0xFF, 0xF7, 0xFF, 0xFF, 0xC6, 0x9F, 0xFF, 0xFC, 0xA5, 0xFF, 0xFF, 0xE5, 0xF7, 0x2F, 0x93, 0xAE,
+    0xA7, 0x2A, 0xEA, 0x3F, 0x97, 0x29, 0xF2, 0x9F, 0x74, 0xF9, 0x0D, 0xA7, 0x71, 0xE9, 0x77, 0x0E,
+    0xA7, 0x70, 0xF7, 0x72, 0x99, 0x0A, 0xC9, 0x77, 0x9E, 0x77, 0xFC, 0x74, 0x9D, 0x90, 0xAD, 0x72,
+    0x9C, 0xA3, 0x9D, 0x71, 0xA9, 0x6A, 0xA7, 0x77, 0x7A, 0xEA, 0x09, 0xD7, 0x09, 0xFE, 0xAD, 0x79,
+    0xEA, 0xAA, 0xFC, 0x7E, 0x4A, 0xE6, 0xAD, 0x6E, 0x6D, 0xA6, 0xAD, 0x95, 0xD7, 0xAD, 0x94, 0x9D,
+    0x79, 0xDA, 0x49, 0xD7, 0xAD, 0xA4, 0xAD, 0x7F, 0x49, 0xD9, 0x5A, 0xF5, 0xFA, 0x99, 0xAF, 0xD5,
+    0xFF, 0xFD, 0x59, 0xFF, 0xFC, 0x69, 0xFF, 0x99, 0xD9, 0x7A, 0xFA, 0x19, 0xD9, 0x77, 0x77, 0xAE,
+    0xA7, 0x71, 0xA2, 0xCA, 0x77, 0x39, 0xCA, 0x77, 0x29, 0xCA, 0x77, 0x3C, 0xA7, 0x77, 0x77, 0x29,
+    0xA7, 0x74, 0xE7, 0x72, 0xFA, 0x77, 0x0D, 0xA0, 0xDA, 0x76, 0xD3, 0xAC, 0xA7, 0x4C, 0xA6, 0xCA,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x4E, 0x97, 0x71, 0xAE, 0xA7, 0x71, 0xFC, 0x77, 0x09, 0xFC, 0x97,
+    0x7A, 0xDA, 0xE7, 0x7E, 0x0E, 0x76, 0x9D, 0xA0, 0xAD, 0xA7, 0x5E, 0x90, 0x9E, 0x75, 0xE2, 0xE9,
+    0x73, 0xAD, 0xA2, 0xAD, 0xA7, 0x3E, 0x92, 0x9E, 0x72, 0x9E, 0x4E, 0x97, 0x1A, 0xDA, 0x4A, 0xE7,
+    0x1E, 0x94, 0x9E, 0x70, 0x9E, 0x6E, 0xA7, 0xEA, 0x6A, 0xE7, 0xE9, 0x7E, 0x95, 0xAF, 0xFF, 0xF5,
+    0xFF, 0xFF, 0xC4, 0x9F, 0xFF, 0xFC, 0xA3, 0xFF, 0xFF, 0xE3, 0xF7, 0x2F, 0x91, 0xAE, 0xA7, 0x2A,
+    0xEA, 0x1F, 0x97, 0x29, 0xF0, 0x9F, 0x74, 0xF9, 0x71, 0x9F, 0x97, 0x29, 0x91, 0xD7, 0x6D, 0x75,
+    0xD7, 0x5A, 0xC7, 0x2A, 0x97, 0x59, 0xD9, 0x73, 0x9F, 0x72, 0x9D, 0xAA, 0xD7, 0x09, 0xD2, 0x9D,
+    0x69, 0xCA, 0x5D, 0x77, 0x77, 0x72, 0xAE, 0xA0, 0x9D, 0x59, 0xFE, 0xAD, 0x49, 0xEA, 0xAA, 0xFC,
+    0x4E, 0x4A, 0xE3, 0xAD, 0x6E, 0x3D, 0xA6, 0xAD, 0x92, 0xD7, 0xAD, 0x91, 0x9D, 0x79, 0xDA, 0x19,
+    0xD7, 0xAD, 0xA1, 0xAD, 0x7F, 0x19, 0xD9, 0x5A, 0xF2, 0xFA, 0x99, 0xAF, 0xD2, 0xFF, 0xFD, 0x29,
+    0xFF, 0xFC, 0x39, 0xFF, 0x99, 0xD9, 0x4A, 0xFA, 0x19, 0xD9, 0x7D, 0xA3, 0xCA, 0x74, 0xDA, 0xCA,
+    0x2C, 0xA7, 0x4C, 0xA0, 0x9C, 0xA1, 0xC9, 0x73, 0x9C, 0x91, 0xAF, 0x74, 0x9C, 0x92, 0xAD, 0xA7,
+    0x77, 0x77, 0x77, 0x7A, 0x97, 0x73, 0xAD, 0x77, 0x2A, 0xF7, 0x70, 0xAD, 0x9A, 0xD7, 0x6A, 0xCA,
+    0x29, 0xD7, 0x4A, 0xC9, 0x5A, 0xC7, 0x77, 0x77, 0x77, 0x5E, 0x97, 0x71, 0xAE, 0xA7, 0x71, 0xFC,
+    0x77, 0x09, 0xFC, 0x97, 0x7A, 0xDA, 0xE7, 0x7E, 0x0E, 0x76, 0x9D, 0xA0, 0xAD, 0xA7, 0x5E, 0x90,
+    0x9E, 0x75, 0xE2, 0xE9, 0x73, 0xAD, 0xA2, 0xAD, 0xA7, 0x3E, 0x92, 0x9E, 0x72, 0x9E, 0x4E, 0x97,
+    0x1A, 0xDA, 0x4A, 0xE7, 0x1E, 0x94, 0x9E, 0x70, 0x9E, 0x6E, 0xA7, 0xEA, 0x6A, 0xE7, 0xE9, 0x7E,
+    0x95, 0xAF, 0xFF, 0xF5, 0xFF, 0xFF, 0xC4, 0x9F, 0xFF, 0xFC, 0xA3, 0xFF, 0xFF, 0xE3, 0xF7, 0x2F,
+    0x91, 0xAE, 0xA7, 0x2A, 0xEA, 0x1F, 0x97, 0x29, 0xF0, 0x9F, 0x74, 0xF9, 0x49, 0x97, 0x5A, 0xE9,
+    0x2C, 0xA6, 0xD0, 0xAC, 0x2C, 0x95, 0x9C, 0x91, 0xD0, 0x9C, 0x95, 0x9C, 0x91, 0x9F, 0x69, 0xC9,
+    0x3A, 0xA7, 0x77, 0x77, 0x6C, 0xA7, 0x5E, 0x74, 0xAF, 0x72, 0xAC, 0xA0, 0xAD, 0x70, 0xD9, 0x3D,
+    0x6A, 0xA6, 0xAA, 0x70, 0xAE, 0xA0, 0x9D, 0x59, 0xFE, 0xAD, 0x49, 0xEA, 0xAA, 0xFC, 0x4E, 0x4A,
+    0xE3, 0xAD, 0x6E, 0x3D, 0xA6, 0xAD, 0x92, 0xD7, 0xAD, 0x91, 0x9D, 0x79, 0xDA, 0x19, 0xD7, 0xAD,
+    0xA1, 0xAD, 0x7F, 0x19, 0xD9, 0x5A, 0xF2, 0xFA, 0x99, 0xAF, 0xD2, 0xFF, 0xFD, 0x29, 0xFF, 0xFC,
+    0x39, 0xFF, 0x99, 0xD9, 0x4A, 0xFA, 0x19, 0xD9, 0x71, 0xAC, 0x97, 0x72, 0x9E, 0x77, 0x2F, 0xA7,
+    0x70, 0xD9, 0x0A, 0xCA, 0x76, 0xD3, 0x9C, 0xA7, 0x4A, 0xA6, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x4E, 0x97, 0x71, 0xAE, 0xA7, 0x71, 0xFC, 0x77, 0x09, 0xFC, 0x97, 0x7A, 0xDA, 0xE7, 0x7E, 0x0E,
+    0x76, 0x9D, 0xA0, 0xAD, 0xA7, 0x5E, 0x90, 0x9E, 0x75, 0xE2, 0xE9, 0x73, 0xAD, 0xA2, 0xAD, 0xA7,
+    0x3E, 0x92, 0x9E, 0x72, 0x9E, 0x4E, 0x97, 0x1A, 0xDA, 0x4A, 0xE7, 0x1E, 0x94, 0x9E, 0x70, 0x9E,
+    0x6E, 0xA7, 0xEA, 0x6A, 0xE7, 0xE9, 0x7E, 0x95, 0xAF, 0xFF, 0xF5, 0xFF, 0xFF, 0xC4, 0x9F, 0xFF,
+    0xFC, 0xA3, 0xFF, 0xFF, 0xE3, 0xF7, 0x2F, 0x91, 0xAE, 0xA7, 0x2A, 0xEA, 0x1F, 0x97, 0x29, 0xF0,
+    0x9F, 0x74, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5E, 0x77, 0x29, 0xE7, 0x72, 0xAE, 0x97,
+    0x71, 0xAE, 0xA7, 0x71, 0xFA, 0x70, 0x77, 0x7A, 0xC9, 0x74, 0x9E, 0x73, 0x9F, 0xC7, 0x19, 0xD9,
+    0x0A, 0xD7, 0x9C, 0xA3, 0x9D, 0x6A, 0x96, 0xA9, 0x77, 0x71, 0xAE, 0xA0, 0x9D, 0x59, 0xFE, 0xAD,
+    0x49, 0xEA, 0xAA, 0xFC, 0x4E, 0x4A, 0xE3, 0xAD, 0x6E, 0x3D, 0xA6, 0xAD, 0x92, 0xD7, 0xAD, 0x91,
+    0x9D, 0x79, 0xDA, 0x19, 0xD7, 0xAD, 0xA1, 0xAD, 0x7F, 0x19, 0xD9, 0x5A, 0xF2, 0xFA, 0x99, 0xAF,
+    0xD2, 0xFF, 0xFD, 0x29, 0xFF, 0xFC, 0x39, 0xFF, 0x99, 0xD9, 0x4A, 0xFA, 0x19, 0xD9, 0x77, 0x77,
+    0x77, 0x70, 0x9E, 0x74, 0xAE, 0x74, 0xF7, 0x4F, 0x97, 0x3F, 0x95, 0x73, 0x9A, 0x97, 0x73, 0xD7,
+    0x73, 0x9D, 0x77, 0x3D, 0xA7, 0x72, 0x9D, 0x77, 0x3E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x2A, 0xA6, 0x9A, 0x73, 0xD6, 0xD7, 0x3A, 0xCA, 0x49, 0xD7, 0x4F, 0xFC, 0x75, 0x9F, 0xE9,
+    0x77, 0xAE, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xE9, 0x77, 0x1A, 0xEA, 0x77,
+    0x1F, 0xC7, 0x70, 0x9F, 0xC9, 0x77, 0xAD, 0xAE, 0x77, 0xE0, 0xE7, 0x69, 0xDA, 0x0A, 0xDA, 0x75,
+    0xE9, 0x09, 0xE7, 0x5E, 0x2E, 0x97, 0x3A, 0xDA, 0x2A, 0xDA, 0x73, 0xE9, 0x29, 0xE7, 0x29, 0xE4,
+    0xE9, 0x71, 0xAD, 0xA4, 0xAE, 0x71, 0xE9, 0x49, 0xE7, 0x09, 0xE6, 0xEA, 0x7E, 0xA6, 0xAE, 0x7E,
+    0x97, 0xE9, 0x5A, 0xFF, 0xFF, 0x5F, 0xFF, 0xFC, 0x49, 0xFF, 0xFF, 0xCA, 0x3F, 0xFF, 0xFE, 0x3F,
+    0x72, 0xF9, 0x1A, 0xEA, 0x72, 0xAE, 0xA1, 0xF9, 0x72, 0x9F, 0x09, 0xF7, 0x4F, 0x90, 0x70, 0xAC,
+    0x97, 0x5D, 0x75, 0xAC, 0xA7, 0x5D, 0x97, 0x4A, 0xD7, 0x5A, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x76, 0xD6, 0xAC, 0x5D, 0x6D, 0x5A, 0xCA, 0x4A, 0xCA, 0x6F, 0xFC, 0x79, 0xFE, 0x72, 0x9A, 0xAA,
+    0x97, 0x77, 0x77, 0x77, 0x6A, 0xEA, 0x09, 0xD5, 0x9F, 0xEA, 0xD4, 0x9E, 0xAA, 0xAF, 0xC4, 0xE4,
+    0xAE, 0x3A, 0xD6, 0xE3, 0xDA, 0x6A, 0xD9, 0x2D, 0x7A, 0xD9, 0x19, 0xD7, 0x9D, 0xA1, 0x9D, 0x7A,
+    0xDA, 0x1A, 0xD7, 0xF1, 0x9D, 0x95, 0xAF, 0x2F, 0xA9, 0x9A, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF,
+    0xC3, 0x9F, 0xF9, 0x9D, 0x94, 0xAF, 0xA1, 0x9D, 0x90, 0x77, 0x75, 0xAD, 0x97, 0x73, 0xAD, 0xA7,
+    0x73, 0xAE, 0x77, 0x3A, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAA, 0x69, 0xA7, 0x3D,
+    0x6D, 0x73, 0xAC, 0xA4, 0x9D, 0x74, 0xFF, 0xC7, 0x59, 0xFE, 0x97, 0x7A, 0xEA, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x5E, 0x97, 0x71, 0xAE, 0xA7, 0x71, 0xFC, 0x77, 0x09, 0xFC, 0x97,
+    0x7A, 0xDA, 0xE7, 0x7E, 0x0E, 0x76, 0x9D, 0xA0, 0xAD, 0xA7, 0x5E, 0x90, 0x9E, 0x75, 0xE2, 0xE9,
+    0x73, 0xAD, 0xA2, 0xAD, 0xA7, 0x3E, 0x92, 0x9E, 0x72, 0x9E, 0x4E, 0x97, 0x1A, 0xDA, 0x4A, 0xE7,
+    0x1E, 0x94, 0x9E, 0x70, 0x9E, 0x6E, 0xA7, 0xEA, 0x6A, 0xE7, 0xE9, 0x7E, 0x95, 0xAF, 0xFF, 0xF5,
+    0xFF, 0xFF, 0xC4, 0x9F, 0xFF, 0xFC, 0xA3, 0xFF, 0xFF, 0xE3, 0xF7, 0x2F, 0x91, 0xAE, 0xA7, 0x2A,
+    0xEA, 0x1F, 0x97, 0x29, 0xF0, 0x9F, 0x74, 0xF9, 0x39, 0x99, 0x75, 0xAD, 0xA7, 0x59, 0xE7, 0x59,
+    0xE9, 0x74, 0x9A, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x3D, 0x6A, 0xC5, 0xD6, 0xD5, 0xAD, 0x4A,
+    0xCA, 0x6F, 0xFC, 0x79, 0xFE, 0x72, 0x9A, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x6A, 0xEA, 0x09, 0xD5,
+    0x9F, 0xEA, 0xD4, 0x9E, 0xAA, 0xAF, 0xC4, 0xE4, 0xAE, 0x3A, 0xD6, 0xE3, 0xDA, 0x6A, 0xD9, 0x2D,
+    0x7A, 0xD9, 0x19, 0xD7, 0x9D, 0xA1, 0x9D, 0x7A, 0xDA, 0x1A, 0xD7, 0xF1, 0x9D, 0x95, 0xAF, 0x2F,
+    0xA9, 0x9A, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0x9F, 0xF9, 0x9D, 0x94, 0xAF, 0xA1, 0x9D,
+    0x90, 0x77, 0x77, 0xAE, 0xA7, 0x71, 0x92, 0xCA, 0x77, 0x39, 0xCA, 0x77, 0x29, 0xCA, 0x77, 0x3C,
+    0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xAA, 0x69, 0xA7, 0x3D, 0x6D, 0x73, 0xAC,
+    0xA4, 0x9D, 0x74, 0xFF, 0xC7, 0x59, 0xFE, 0x97, 0x7A, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x5E, 0x97, 0x71, 0xAE, 0xA7, 0x71, 0xFC, 0x77, 0x09, 0xFC, 0x97, 0x7A, 0xDA, 0xE7,
+    0x7E, 0x0E, 0x76, 0x9D, 0xA0, 0xAD, 0xA7, 0x5E, 0x90, 0x9E, 0x75, 0xE2, 0xE9, 0x73, 0xAD, 0xA2,
+    0xAD, 0xA7, 0x3E, 0x92, 0x9E, 0x72, 0x9E, 0x4E, 0x97, 0x1A, 0xDA, 0x4A, 0xE7, 0x1E, 0x94, 0x9E,
+    0x70, 0x9E, 0x6E, 0xA7, 0xEA, 0x6A, 0xE7, 0xE9, 0x7E, 0x95, 0xAF, 0xFF, 0xF5, 0xFF, 0xFF, 0xC4,
+    0x9F, 0xFF, 0xFC, 0xA3, 0xFF, 0xFF, 0xE3, 0xF7, 0x2F, 0x91, 0xAE, 0xA7, 0x2A, 0xEA, 0x1F, 0x97,
+    0x29, 0xF0, 0x9F, 0x74, 0xF9, 0x49, 0xAF, 0x97, 0x1D, 0xAA, 0xAD, 0xA7, 0x09, 0x4D, 0x75, 0xAD,
+    0x74, 0xAD, 0x97, 0x3A, 0xD7, 0x5D, 0x76, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xAA,
+    0x69, 0xA5, 0xD6, 0xD5, 0xAC, 0xA4, 0x9D, 0x6F, 0xFC, 0x79, 0xFE, 0x97, 0x1A, 0xEA, 0x77, 0x77,
+    0x75, 0xAE, 0xA0, 0x9D, 0x59, 0xFE, 0xAD, 0x49, 0xEA, 0xAA, 0xFC, 0x4E, 0x4A, 0xE3, 0xAD, 0x6E,
+    0x3D, 0xA6, 0xAD, 0x92, 0xD7, 0xAD, 0x91, 0x9D, 0x79, 0xDA, 0x19, 0xD7, 0xAD, 0xA1, 0xAD, 0x7F,
+    0x19, 0xD9, 0x5A, 0xF2, 0xFA, 0x99, 0xAF, 0xD2, 0xFF, 0xFD, 0x29, 0xFF, 0xFC, 0x39, 0xFF, 0x99,
+    0xD9, 0x4A, 0xFA, 0x19, 0xD9, 0x69, 0xDA, 0x3C, 0xA7, 0x4D, 0xAC, 0xA2, 0xCA, 0x73, 0x9C, 0x90,
+    0x9C, 0xA1, 0xC9, 0x73, 0x9C, 0x91, 0xAF, 0x74, 0xAC, 0x92, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x0A, 0xA6, 0x9A, 0x73, 0xD6, 0xD7, 0x3A, 0xCA, 0x49, 0xD7, 0x4F, 0xFC, 0x75, 0x9F,
+    0xE9, 0x77, 0xAE, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xE9, 0x77, 0x1A, 0xEA,
+    0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xC9, 0x77, 0xAD, 0xAE, 0x77, 0xE0, 0xE7, 0x69, 0xDA, 0x0A, 0xDA,
+    0x75, 0xE9, 0x09, 0xE7, 0x5E, 0x2E, 0x97, 0x3A, 0xDA, 0x2A, 0xDA, 0x73, 0xE9, 0x29, 0xE7, 0x29,
+    0xE4, 0xE9, 0x71, 0xAD, 0xA4, 0xAE, 0x71, 0xE9, 0x49, 0xE7, 0x09, 0xE6, 0xEA, 0x7E, 0xA6, 0xAE,
+    0x7E, 0x97, 0xE9, 0x5A, 0xFF, 0xFF, 0x5F, 0xFF, 0xFC, 0x49, 0xFF, 0xFF, 0xCA, 0x3F, 0xFF, 0xFE,
+    0x3F, 0x72, 0xF9, 0x1A, 0xEA, 0x72, 0xAE, 0xA1, 0xF9, 0x72, 0x9F, 0x09, 0xF7, 0x4F, 0x90, 0x39,
+    0xDA, 0x3C, 0xA6, 0xDA, 0xD2, 0xC9, 0x59, 0xC9, 0x09, 0xCA, 0x09, 0xC9, 0x59, 0xC9, 0x19, 0xF6,
+    0x9C, 0x4A, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x3D, 0x6A, 0xC5, 0xD6, 0xD5, 0xAD, 0x4A, 0xCA, 0x6F,
+    0xFC, 0x79, 0xFE, 0x72, 0x9A, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x6A, 0xEA, 0x09, 0xD5, 0x9F, 0xEA,
+    0xD4, 0x9E, 0xAA, 0xAF, 0xC4, 0xE4, 0xAE, 0x3A, 0xD6, 0xE3, 0xDA, 0x6A, 0xD9, 0x2D, 0x7A, 0xD9,
+    0x19, 0xD7, 0x9D, 0xA1, 0x9D, 0x7A, 0xDA, 0x1A, 0xD7, 0xF1, 0x9D, 0x95, 0xAF, 0x2F, 0xA9, 0x9A,
+    0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0x9F, 0xF9, 0x9D, 0x94, 0xAF, 0xA1, 0x9D, 0x90, 0x5A,
+    0xA6, 0x9A, 0x73, 0xD6, 0xD7, 0x3A, 0xCA, 0x49, 0xD7, 0x4F, 0xFC, 0x75, 0x9F, 0xE9, 0x77, 0xAE,
+    0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xE9, 0x77, 0x1A, 0xEA, 0x77, 0x1F, 0xC7,
+    0x70, 0x9F, 0xC9, 0x77, 0xAD, 0xAE, 0x77, 0xE0, 0xE7, 0x69, 0xDA, 0x0A, 0xDA, 0x75, 0xE9, 0x09,
+    0xE7, 0x5E, 0x2E, 0x97, 0x3A, 0xDA, 0x2A, 0xDA, 0x73, 0xE9, 0x29, 0xE7, 0x29, 0xE4, 0xE9, 0x71,
+    0xAD, 0xA4, 0xAE, 0x71, 0xE9, 0x49, 0xE7, 0x09, 0xE6, 0xEA, 0x7E, 0xA6, 0xAE, 0x7E, 0x97, 0xE9,
+    0x5A, 0xFF, 0xFF, 0x5F, 0xFF, 0xFC, 0x49, 0xFF, 0xFF, 0xCA, 0x3F, 0xFF, 0xFE, 0x3F, 0x72, 0xF9,
+    0x1A, 0xEA, 0x72, 0xAE, 0xA1, 0xF9, 0x72, 0x9F, 0x09, 0xF7, 0x4F, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x75, 0xE7, 0x72, 0x9E, 0x77, 0x2A, 0xE9, 0x77, 0x1A, 0xEA, 0x77, 0x1F, 0xA7, 0x00, 0x2D,
+    0x6A, 0xC5, 0xD6, 0xD5, 0xAD, 0x4A, 0xCA, 0x6F, 0xFC, 0x79, 0xFE, 0x72, 0x9A, 0xAA, 0x97, 0x77,
+    0x77, 0x77, 0x6A, 0xEA, 0x09, 0xD5, 0x9F, 0xEA, 0xD4, 0x9E, 0xAA, 0xAF, 0xC4, 0xE4, 0xAE, 0x3A,
+    0xD6, 0xE3, 0xDA, 0x6A, 0xD9, 0x2D, 0x7A, 0xD9, 0x19, 0xD7, 0x9D, 0xA1, 0x9D, 0x7A, 0xDA, 0x1A,
+    0xD7, 0xF1, 0x9D, 0x95, 0xAF, 0x2F, 0xA9, 0x9A, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0x9F,
+    0xF9, 0x9D, 0x94, 0xAF, 0xA1, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x09, 0xE7, 0x4A, 0xE7, 0x4F, 0x74,
+    0xF9, 0x73, 0xF9, 0x50, 0x72, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xCA, 0x1A, 0xFF, 0xFC, 0xA1, 0xFF,
+    0xFC, 0xA2, 0xEA, 0x97, 0x3E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0xA9,
+    0x99, 0x9A, 0xAA, 0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x94, 0xFF, 0xE9, 0x4E, 0xA7, 0x4E, 0x97, 0x4E,
+    0x97, 0x4E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xDA, 0x09,
+    0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x97, 0x77, 0x77, 0x0E, 0x97, 0x4E, 0xA7, 0x39,
+    0xEA, 0x73, 0xAF, 0x73, 0xAF, 0x50, 0x49, 0xAE, 0xA7, 0x0F, 0xF9, 0x5E, 0xA3, 0xD9, 0x3E, 0x6D,
+    0x29, 0xD7, 0x9D, 0x1D, 0xA3, 0x99, 0x9A, 0xAD, 0x1F, 0xFF, 0xD9, 0x9F, 0xFF, 0xAA, 0x9A, 0xD9,
+    0x97, 0x29, 0xD9, 0x73, 0x9D, 0xA7, 0x4E, 0xA7, 0x3F, 0xC9, 0x59, 0xA2, 0xFF, 0xFC, 0x29, 0xFF,
+    0xF3, 0x9F, 0xFE, 0x59, 0xAF, 0xAA, 0x77, 0x77, 0x77, 0x71, 0xE7, 0x39, 0xE9, 0x72, 0x9E, 0x97,
+    0x2A, 0xEA, 0x72, 0xFA, 0x40, 0x77, 0x69, 0xF9, 0x72, 0x92, 0xD7, 0x6D, 0x75, 0xD7, 0x5A, 0xC7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xCA, 0x1A, 0xFF, 0xFC, 0xA1,
+    0xFF, 0xFC, 0xA2, 0xEA, 0x97, 0x3E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E,
+    0xA9, 0x99, 0x9A, 0xAA, 0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x94, 0xFF, 0xE9, 0x4E, 0xA7, 0x4E, 0x97,
+    0x4E, 0x97, 0x4E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xDA,
+    0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x90, 0x77, 0x5A, 0xEA, 0x71, 0x99, 0x19,
+    0xC9, 0x74, 0xAC, 0x74, 0xAC, 0x97, 0x39, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39,
+    0xAE, 0xA7, 0x0F, 0xF9, 0x5E, 0xA3, 0xD9, 0x3E, 0x6D, 0x29, 0xD7, 0x9D, 0x1D, 0xA3, 0x99, 0x9A,
+    0xAD, 0x1F, 0xFF, 0xD9, 0x9F, 0xFF, 0xAA, 0x9A, 0xD9, 0x97, 0x29, 0xD9, 0x73, 0x9D, 0xA7, 0x4E,
+    0xA7, 0x3F, 0xC9, 0x59, 0xA2, 0xFF, 0xFC, 0x29, 0xFF, 0xF3, 0x9F, 0xFE, 0x59, 0xAF, 0xAA, 0x20,
+    0x49, 0x94, 0xA9, 0x69, 0xEA, 0x2A, 0xC6, 0xD0, 0x9C, 0xA1, 0xCA, 0x6C, 0xA1, 0xAF, 0x95, 0x9C,
+    0xA2, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x72, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xCA, 0x1A, 0xFF,
+    0xFC, 0xA1, 0xFF, 0xFC, 0xA2, 0xEA, 0x97, 0x3E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E,
+    0x97, 0x4E, 0xA9, 0x99, 0x9A, 0xAA, 0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x94, 0xFF, 0xE9, 0x4E, 0xA7,
+    0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xFF, 0xFD, 0x90, 0x9F,
+    0xFF, 0xDA, 0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x90, 0x3A, 0xD9, 0x29, 0xC5,
+    0x9D, 0xAC, 0x91, 0x9C, 0x5A, 0xC1, 0xAC, 0x1A, 0xC5, 0xD2, 0xDA, 0xD5, 0xD3, 0xE7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x09, 0xAE, 0xA7, 0x0F, 0xF9, 0x5E, 0xA3, 0xD9, 0x3E, 0x6D, 0x29, 0xD7,
+    0x9D, 0x1D, 0xA3, 0x99, 0x9A, 0xAD, 0x1F, 0xFF, 0xD9, 0x9F, 0xFF, 0xAA, 0x9A, 0xD9, 0x97, 0x29,
+    0xD9, 0x73, 0x9D, 0xA7, 0x4E, 0xA7, 0x3F, 0xC9, 0x59, 0xA2, 0xFF, 0xFC, 0x29, 0xFF, 0xF3, 0x9F,
+    0xFE, 0x59, 0xAF, 0xAA, 0x20, 0x76, 0xD7, 0x69, 0xD7, 0x6D, 0xA7, 0x59, 0xD7, 0x6E, 0x76, 0xAA,
+    0x97, 0x0A, 0xCA, 0x76, 0xE9, 0x74, 0xFC, 0x97, 0x2D, 0x90, 0x9D, 0x71, 0xD4, 0xD7, 0xAA, 0x6A,
+    0xA7, 0x77, 0x77, 0x72, 0x99, 0x99, 0x92, 0xAF, 0xFF, 0xCA, 0x2A, 0xFF, 0xFC, 0xA2, 0xFF, 0xFC,
+    0xA3, 0xEA, 0x97, 0x4E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0xA9, 0x99,
+    0x9A, 0xAA, 0x95, 0xFF, 0xE9, 0x5F, 0xFE, 0x95, 0xFF, 0xE9, 0x5E, 0xA7, 0x5E, 0x97, 0x5E, 0x97,
+    0x5E, 0x97, 0x49, 0xE9, 0x74, 0x9E, 0x97, 0x49, 0xFF, 0xFD, 0x91, 0x9F, 0xFF, 0xDA, 0x19, 0xFF,
+    0xFE, 0x19, 0xFF, 0xFE, 0x19, 0xFF, 0xFE, 0x90, 0x77, 0xAA, 0x77, 0x9C, 0xA7, 0x7D, 0x97, 0xD4,
+    0x9D, 0x7E, 0xA3, 0xDA, 0x6A, 0xFA, 0x19, 0xD9, 0x5A, 0xCA, 0x1D, 0xA7, 0x1A, 0xC9, 0x39, 0xCA,
+    0x79, 0xA7, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xEA, 0x73, 0xFF, 0x97, 0x0E, 0xA3, 0xD9,
+    0x6E, 0x6D, 0x59, 0xD7, 0x9D, 0x4D, 0xA3, 0x99, 0x9A, 0xAD, 0x4F, 0xFF, 0xD9, 0x29, 0xFF, 0xFA,
+    0xA9, 0x2A, 0xD9, 0x97, 0x59, 0xD9, 0x76, 0x9D, 0xA7, 0x7E, 0xA7, 0x6F, 0xC9, 0x59, 0xA5, 0xFF,
+    0xFC, 0x59, 0xFF, 0xF6, 0x9F, 0xFE, 0x70, 0x9A, 0xFA, 0xA5, 0x0A, 0xAA, 0x77, 0x4E, 0x97, 0x73,
+    0xEA, 0x59, 0xC9, 0x72, 0xAE, 0x4E, 0x73, 0x99, 0xAA, 0x2F, 0xC7, 0x70, 0xDA, 0x0A, 0xD7, 0x6D,
+    0x92, 0x9D, 0x74, 0xAA, 0x6A, 0xA7, 0x77, 0x77, 0x77, 0x71, 0x99, 0x99, 0x97, 0xAF, 0xFF, 0xCA,
+    0x7A, 0xFF, 0xFC, 0xA7, 0xFF, 0xFC, 0xA7, 0x0E, 0xA9, 0x77, 0x1E, 0x97, 0x72, 0xE9, 0x77, 0x2E,
+    0x97, 0x72, 0xE9, 0x77, 0x2E, 0x97, 0x72, 0xEA, 0x99, 0x99, 0xAA, 0xA9, 0x72, 0xFF, 0xE9, 0x72,
+    0xFF, 0xE9, 0x72, 0xFF, 0xE9, 0x72, 0xEA, 0x77, 0x2E, 0x97, 0x72, 0xE9, 0x77, 0x2E, 0x97, 0x71,
+    0x9E, 0x97, 0x71, 0x9E, 0x97, 0x71, 0x9F, 0xFF, 0xD9, 0x69, 0xFF, 0xFD, 0xA6, 0x9F, 0xFF, 0xE6,
+    0x9F, 0xFF, 0xE6, 0x9F, 0xFF, 0xE9, 0x9D, 0xA7, 0x79, 0xE7, 0x79, 0xE9, 0x76, 0x9E, 0xA1, 0xD7,
+    0x49, 0x99, 0xEA, 0x75, 0xAF, 0xA7, 0x3A, 0xCA, 0x1D, 0xA7, 0x1A, 0xC9, 0x39, 0xCA, 0x79, 0xA7,
+    0xA7, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xEA, 0x73, 0xFF, 0x97, 0x0E, 0xA3, 0xD9, 0x6E, 0x6D,
+    0x59, 0xD7, 0x9D, 0x4D, 0xA3, 0x99, 0x9A, 0xAD, 0x4F, 0xFF, 0xD9, 0x29, 0xFF, 0xFA, 0xA9, 0x2A,
+    0xD9, 0x97, 0x59, 0xD9, 0x76, 0x9D, 0xA7, 0x7E, 0xA7, 0x6F, 0xC9, 0x59, 0xA5, 0xFF, 0xFC, 0x59,
+    0xFF, 0xF6, 0x9F, 0xFE, 0x70, 0x9A, 0xFA, 0xA2, 0x77, 0x75, 0xAE, 0xA7, 0x49, 0x19, 0xC9, 0x76,
+    0xAC, 0x97, 0x5A, 0xC9, 0x76, 0xC9, 0x70, 0x9C, 0x97, 0x6E, 0x75, 0xFC, 0x73, 0xDA, 0x0A, 0xD7,
+    0x1D, 0x92, 0x9D, 0x7A, 0xA6, 0xAA, 0x77, 0x77, 0x77, 0x29, 0x99, 0x99, 0x2A, 0xFF, 0xFC, 0xA2,
+    0xAF, 0xFF, 0xCA, 0x2F, 0xFF, 0xCA, 0x3E, 0xA9, 0x74, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9,
+    0x75, 0xE9, 0x75, 0xEA, 0x99, 0x99, 0xAA, 0xA9, 0x5F, 0xFE, 0x95, 0xFF, 0xE9, 0x5F, 0xFE, 0x95,
+    0xEA, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x74, 0x9E, 0x97, 0x49, 0xE9, 0x74, 0x9F, 0xFF, 0xD9,
+    0x19, 0xFF, 0xFD, 0xA1, 0x9F, 0xFF, 0xE1, 0x9F, 0xFF, 0xE1, 0x9F, 0xFF, 0xE9, 0x00, 0x77, 0x71,
+    0xAE, 0xA7, 0x29, 0x2C, 0xA7, 0x49, 0xCA, 0x73, 0x9C, 0xA7, 0x4C, 0xA7, 0x1A, 0x97, 0x4E, 0x73,
+    0xAE, 0xA7, 0x1A, 0xD9, 0xDA, 0x7A, 0xCA, 0x2A, 0xCA, 0x5A, 0xC6, 0xCA, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x69, 0xAE, 0xA7, 0x0F, 0xF9, 0x5E, 0xA3, 0xD9, 0x3E, 0x6D, 0x29, 0xD7, 0x9D, 0x1D, 0xA3,
+    0x99, 0x9A, 0xAD, 0x1F, 0xFF, 0xD9, 0x9F, 0xFF, 0xAA, 0x9A, 0xD9, 0x97, 0x29, 0xD9, 0x73, 0x9D,
+    0xA7, 0x4E, 0xA7, 0x3F, 0xC9, 0x59, 0xA2, 0xFF, 0xFC, 0x29, 0xFF, 0xF3, 0x9F, 0xFE, 0x59, 0xAF,
+    0xAA, 0x20, 0x59, 0x93, 0xAA, 0x69, 0xEA, 0x2A, 0xC6, 0xD0, 0xAC, 0x91, 0xAA, 0x6C, 0xA1, 0xD1,
+    0xCA, 0x6C, 0xA2, 0xF9, 0x69, 0x4A, 0xA9, 0x77, 0x77, 0x75, 0xAA, 0x75, 0xAD, 0x97, 0x39, 0xF9,
+    0x71, 0x9D, 0x99, 0xD9, 0x79, 0xCA, 0x3D, 0x69, 0xC9, 0x5A, 0xC7, 0x77, 0x69, 0x99, 0x99, 0x1A,
+    0xFF, 0xFC, 0xA1, 0xAF, 0xFF, 0xCA, 0x1F, 0xFF, 0xCA, 0x2E, 0xA9, 0x73, 0xE9, 0x74, 0xE9, 0x74,
+    0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xEA, 0x99, 0x99, 0xAA, 0xA9, 0x4F, 0xFE, 0x94, 0xFF, 0xE9,
+    0x4F, 0xFE, 0x94, 0xEA, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73,
+    0x9F, 0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0xA0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9,
+    0x3A, 0xD9, 0x29, 0xC5, 0x9D, 0xAC, 0x91, 0x9C, 0x5A, 0xC1, 0xAC, 0x19, 0xC5, 0xD2, 0xDA, 0xD5,
+    0xD3, 0xE9, 0x77, 0x77, 0x72, 0x97, 0x5D, 0xA7, 0x3A, 0xE7, 0x2A, 0xFC, 0x70, 0x9D, 0x19, 0xD6,
+    0x9C, 0xA4, 0xD5, 0xA9, 0x69, 0x97, 0x77, 0x77, 0x76, 0x9A, 0xEA, 0x70, 0xFF, 0x95, 0xEA, 0x3D,
+    0x93, 0xE6, 0xD2, 0x9D, 0x79, 0xD1, 0xDA, 0x39, 0x99, 0xAA, 0xD1, 0xFF, 0xFD, 0x99, 0xFF, 0xFA,
+    0xA9, 0xAD, 0x99, 0x72, 0x9D, 0x97, 0x39, 0xDA, 0x74, 0xEA, 0x73, 0xFC, 0x95, 0x9A, 0x2F, 0xFF,
+    0xC2, 0x9F, 0xFF, 0x39, 0xFF, 0xE5, 0x9A, 0xFA, 0xA2, 0x69, 0xC9, 0x75, 0xE7, 0x4F, 0xC7, 0x2D,
+    0xA0, 0xAD, 0x70, 0xD9, 0x29, 0xD6, 0xAA, 0x6A, 0xA7, 0x77, 0x77, 0x79, 0x99, 0x99, 0x1A, 0xFF,
+    0xFC, 0xA1, 0xAF, 0xFF, 0xCA, 0x1F, 0xFF, 0xCA, 0x2E, 0xA9, 0x73, 0xE9, 0x74, 0xE9, 0x74, 0xE9,
+    0x74, 0xE9, 0x74, 0xE9, 0x74, 0xEA, 0x99, 0x99, 0xAA, 0xA9, 0x4F, 0xFE, 0x94, 0xFF, 0xE9, 0x4F,
+    0xFE, 0x94, 0xEA, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9F,
+    0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0xA0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x77,
+    0x77, 0x70, 0xE9, 0x74, 0xEA, 0x73, 0x9E, 0xA7, 0x3A, 0xF7, 0x3A, 0xF5, 0x77, 0x6D, 0x74, 0xAE,
+    0x72, 0xAF, 0xA7, 0x0A, 0xCA, 0x1A, 0xCA, 0x6A, 0xC9, 0x39, 0xCA, 0x49, 0xA7, 0xA9, 0x77, 0x77,
+    0x77, 0x77, 0x69, 0xAE, 0xA7, 0x0F, 0xF9, 0x5E, 0xA3, 0xD9, 0x3E, 0x6D, 0x29, 0xD7, 0x9D, 0x1D,
+    0xA3, 0x99, 0x9A, 0xAD, 0x1F, 0xFF, 0xD9, 0x9F, 0xFF, 0xAA, 0x9A, 0xD9, 0x97, 0x29, 0xD9, 0x73,
+    0x9D, 0xA7, 0x4E, 0xA7, 0x3F, 0xC9, 0x59, 0xA2, 0xFF, 0xFC, 0x29, 0xFF, 0xF3, 0x9F, 0xFE, 0x59,
+    0xAF, 0xAA, 0x77, 0x77, 0x77, 0x71, 0xE7, 0x39, 0xE9, 0x72, 0x9E, 0x97, 0x2A, 0xEA, 0x72, 0xFA,
+    0x40, 0x7A, 0xE9, 0x09, 0x91, 0xAC, 0x93, 0xAC, 0x3A, 0xC9, 0x29, 0xC7, 0x77, 0x77, 0x74, 0x9A,
+    0xAA, 0x91, 0xAE, 0x91, 0xAE, 0x91, 0xAE, 0x91, 0x9E, 0x91, 0x9E, 0x91, 0x9E, 0x91, 0x9E, 0x91,
+    0x9E, 0x91, 0x9E, 0x91, 0x9E, 0x91, 0x9E, 0x91, 0x9E, 0x91, 0x9E, 0x91, 0x9E, 0xA1, 0x9E, 0xA1,
+    0x9E, 0xA1, 0x9E, 0xA1, 0x9F, 0x1A, 0xF1, 0xAF, 0x1A, 0xF1, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x9E,
+    0xA0, 0xA2, 0xD3, 0xCA, 0x2D, 0x2D, 0x77, 0x77, 0x19, 0x3A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAC, 0xA2,
+    0xAC, 0xA2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x90, 0x9E, 0x90,
+    0x0A, 0xAA, 0xA9, 0x1A, 0xE9, 0x1A, 0xE9, 0x1A, 0xE9, 0x19, 0xE9, 0x19, 0xE9, 0x19, 0xE9, 0x19,
+    0xE9, 0x19, 0xE9, 0x19, 0xE9, 0x19, 0xE9, 0x19, 0xE9, 0x19, 0xE9, 0x19, 0xE9, 0x19, 0xEA, 0x19,
+    0xEA, 0x19, 0xEA, 0x19, 0xEA, 0x19, 0xF1, 0xAF, 0x1A, 0xF1, 0xAF, 0x1F, 0xC1, 0xFC, 0x1F, 0xC7,
+    0x77, 0xE2, 0x9E, 0x91, 0xAE, 0x91, 0xFA, 0x1F, 0xA0, 0x1A, 0xD9, 0x2E, 0xA2, 0xEA, 0x19, 0xF1,
+    0xAF, 0x77, 0x77, 0x99, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAC, 0xA3, 0xAC, 0xA3, 0xAD, 0x3A, 0xD3,
+    0xAD, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x91, 0x9E, 0x97, 0x79, 0xDA, 0x2A, 0xE2, 0xF2,
+    0xF1, 0x9F, 0x90, 0x69, 0xAF, 0xCA, 0x97, 0x39, 0xFF, 0xEA, 0x70, 0xAF, 0xDA, 0xFE, 0x95, 0xFC,
+    0xA4, 0x9F, 0xC9, 0x3A, 0xF9, 0x7F, 0xC3, 0xF9, 0x71, 0xFA, 0x1A, 0xEA, 0x72, 0x9F, 0x1F, 0x74,
+    0xF9, 0x0F, 0x74, 0x9E, 0x99, 0xE9, 0x75, 0xEA, 0x9E, 0x76, 0xEA, 0x9E, 0x76, 0xAE, 0x9E, 0x76,
+    0xAE, 0x9E, 0x76, 0xAD, 0xA9, 0xE7, 0x6E, 0xA9, 0xE9, 0x75, 0xEA, 0x0F, 0x74, 0xAE, 0x90, 0xFC,
+    0x72, 0xAF, 0x1A, 0xFD, 0x99, 0x29, 0x9A, 0xFD, 0x2F, 0xFF, 0xFE, 0xA2, 0xAF, 0xFF, 0xFD, 0x4F,
+    0xFF, 0xFC, 0xA5, 0xFF, 0xFE, 0xA7, 0xAF, 0xFF, 0x97, 0x29, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x3E, 0x97, 0x72, 0xEA, 0x77, 0x2E, 0xA7, 0x71, 0x9F, 0x77, 0x1A, 0xF7, 0x00,
+    0x4A, 0xFA, 0x96, 0xAF, 0xFA, 0x4A, 0xFA, 0xAF, 0xC2, 0x9E, 0x5A, 0xD9, 0x1E, 0x7E, 0x1D, 0xA7,
+    0x9D, 0x99, 0xD9, 0x79, 0xDA, 0xAD, 0x97, 0x0D, 0xAA, 0xD9, 0x79, 0xDA, 0x9D, 0xA7, 0x9D, 0xA0,
+    0xE7, 0xE9, 0x0F, 0xA9, 0x99, 0x9A, 0xF2, 0xFF, 0xF9, 0x2A, 0xFF, 0xDA, 0x49, 0xFF, 0xA7, 0xAF,
+    0xA7, 0x77, 0x77, 0x77, 0x77, 0x29, 0xDA, 0x73, 0xAE, 0x73, 0xF7, 0x3F, 0x72, 0x9F, 0x94, 0x70,
+    0x9F, 0x97, 0x70, 0x99, 0x1D, 0x77, 0x4D, 0x77, 0x3D, 0x97, 0x72, 0xAC, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x39, 0xAF, 0xCA, 0x97, 0x39, 0xFF, 0xEA, 0x70, 0xAF, 0xDA, 0xFE, 0x95,
+    0xFC, 0xA4, 0x9F, 0xC9, 0x3A, 0xF9, 0x7F, 0xC3, 0xF9, 0x71, 0xFA, 0x1A, 0xEA, 0x72, 0x9F, 0x1F,
+    0x74, 0xF9, 0x0F, 0x74, 0x9E, 0x99, 0xE9, 0x75, 0xEA, 0x9E, 0x76, 0xEA, 0x9E, 0x76, 0xAE, 0x9E,
+    0x76, 0xAE, 0x9E, 0x76, 0xAD, 0xA9, 0xE7, 0x6E, 0xA9, 0xE9, 0x75, 0xEA, 0x0F, 0x74, 0xAE, 0x90,
+    0xFC, 0x72, 0xAF, 0x1A, 0xFD, 0x99, 0x29, 0x9A, 0xFD, 0x2F, 0xFF, 0xFE, 0xA2, 0xAF, 0xFF, 0xFD,
+    0x4F, 0xFF, 0xFC, 0xA5, 0xFF, 0xFE, 0xA7, 0xAF, 0xFF, 0x97, 0x29, 0xAF, 0xDA, 0x97, 0x77, 0x40,
+    0x77, 0x49, 0xF9, 0x71, 0x99, 0x1A, 0xC7, 0x5D, 0x74, 0xD7, 0x49, 0xC7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x3A, 0xFA, 0x96, 0xAF, 0xFA, 0x4A, 0xFA, 0xAF, 0xC2, 0x9E, 0x5A, 0xD9, 0x1E,
+    0x7E, 0x1D, 0xA7, 0x9D, 0x99, 0xD9, 0x79, 0xDA, 0xAD, 0x97, 0x0D, 0xAA, 0xD9, 0x79, 0xDA, 0x9D,
+    0xA7, 0x9D, 0xA0, 0xE7, 0xE9, 0x0F, 0xA9, 0x99, 0x9A, 0xF2, 0xFF, 0xF9, 0x2A, 0xFF, 0xDA, 0x49,
+    0xFF, 0xA7, 0xAF, 0xA4, 0x72, 0x99, 0x77, 0x71, 0xAD, 0x77, 0x70, 0x9E, 0xA7, 0x76, 0x9D, 0xAD,
+    0xA7, 0x74, 0x9D, 0x2A, 0xCA, 0x77, 0x29, 0xC9, 0x49, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9A,
+    0xFC, 0xA9, 0x77, 0x19, 0xFF, 0xEA, 0x7A, 0xA4, 0xAF, 0xDA, 0xFE, 0x94, 0x9C, 0xA3, 0xFC, 0xA4,
+    0x9F, 0xC9, 0x3D, 0x92, 0xAF, 0x97, 0xFC, 0x29, 0xD3, 0xF9, 0x71, 0xFA, 0x1D, 0xA2, 0xAE, 0xA7,
+    0x29, 0xF0, 0x9D, 0x92, 0xF7, 0x4F, 0x96, 0xF7, 0x49, 0xE9, 0x59, 0xE9, 0x75, 0xEA, 0x59, 0xE7,
+    0x6E, 0xA5, 0x9E, 0x76, 0xAE, 0x59, 0xE7, 0x6A, 0xE5, 0x9E, 0x76, 0xAD, 0xA5, 0x9E, 0x76, 0xEA,
+    0x59, 0xE9, 0x75, 0xEA, 0x6F, 0x74, 0xAE, 0x96, 0xFC, 0x72, 0xAF, 0x7A, 0xFD, 0x99, 0x29, 0x9A,
+    0xFD, 0x70, 0xFF, 0xFF, 0xEA, 0x70, 0xAF, 0xFF, 0xFD, 0x72, 0xFF, 0xFF, 0xCA, 0x73, 0xFF, 0xFE,
+    0xA7, 0x5A, 0xFF, 0xF9, 0x77, 0x09, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x00, 0x77, 0x9C, 0xA5, 0x9D,
+    0x6D, 0x6E, 0xA4, 0x9D, 0x5F, 0xCA, 0x3D, 0xA4, 0xD9, 0x1A, 0xCA, 0x19, 0xD4, 0xD4, 0x9C, 0xA0,
+    0xAA, 0xA3, 0x99, 0x79, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6A, 0xFA, 0x97, 0x1A, 0xFF, 0xA7, 0xAF,
+    0xAA, 0xFC, 0x59, 0xE5, 0xAD, 0x94, 0xE7, 0xE4, 0xDA, 0x79, 0xD9, 0x29, 0xD9, 0x79, 0xDA, 0x2A,
+    0xD9, 0x70, 0xDA, 0x2A, 0xD9, 0x79, 0xDA, 0x29, 0xDA, 0x79, 0xDA, 0x3E, 0x7E, 0x93, 0xFA, 0x99,
+    0x99, 0xAF, 0x5F, 0xFF, 0x95, 0xAF, 0xFD, 0xA7, 0x9F, 0xFA, 0x72, 0xAF, 0xA7, 0x77, 0x71, 0xAD,
+    0x97, 0x75, 0xAD, 0xA6, 0x99, 0x74, 0xAE, 0x4A, 0xD7, 0x5A, 0xE9, 0x19, 0xEA, 0x77, 0x29, 0xDA,
+    0xDA, 0x77, 0x09, 0xD2, 0xAC, 0xA7, 0x69, 0xC9, 0x49, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAF,
+    0xCA, 0x97, 0x59, 0xFF, 0xEA, 0x72, 0xAF, 0xDA, 0xFE, 0x97, 0xFC, 0xA4, 0x9F, 0xC9, 0x5A, 0xF9,
+    0x7F, 0xC5, 0xF9, 0x71, 0xFA, 0x3A, 0xEA, 0x72, 0x9F, 0x3F, 0x74, 0xF9, 0x2F, 0x74, 0x9E, 0x91,
+    0x9E, 0x97, 0x5E, 0xA1, 0x9E, 0x76, 0xEA, 0x19, 0xE7, 0x6A, 0xE1, 0x9E, 0x76, 0xAE, 0x19, 0xE7,
+    0x6A, 0xDA, 0x19, 0xE7, 0x6E, 0xA1, 0x9E, 0x97, 0x5E, 0xA2, 0xF7, 0x4A, 0xE9, 0x2F, 0xC7, 0x2A,
+    0xF3, 0xAF, 0xD9, 0x92, 0x99, 0xAF, 0xD4, 0xFF, 0xFF, 0xEA, 0x4A, 0xFF, 0xFF, 0xD6, 0xFF, 0xFF,
+    0xCA, 0x7F, 0xFF, 0xEA, 0x71, 0xAF, 0xFF, 0x97, 0x49, 0xAF, 0xDA, 0x97, 0x77, 0x60, 0x77, 0x49,
+    0xDA, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x92, 0x99, 0x72, 0x9E, 0xA0, 0x9D, 0x77, 0x9E, 0xA7, 0x6D,
+    0xAD, 0xA7, 0x4D, 0x91, 0xAC, 0xA7, 0x2C, 0xA4, 0x9C, 0xA7, 0x09, 0x97, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x3A, 0xFA, 0x97, 0x2A, 0xFF, 0xA7, 0x0A, 0xFA, 0xAF, 0xC6, 0x9E, 0x5A, 0xD9, 0x5E,
+    0x7E, 0x5D, 0xA7, 0x9D, 0x93, 0x9D, 0x97, 0x9D, 0xA3, 0xAD, 0x97, 0x0D, 0xA3, 0xAD, 0x97, 0x9D,
+    0xA3, 0x9D, 0xA7, 0x9D, 0xA4, 0xE7, 0xE9, 0x4F, 0xA9, 0x99, 0x9A, 0xF6, 0xFF, 0xF9, 0x6A, 0xFF,
+    0xDA, 0x70, 0x9F, 0xFA, 0x73, 0xAF, 0xA4, 0x77, 0x77, 0x5A, 0xEA, 0x77, 0x19, 0x19, 0xC9, 0x77,
+    0x3A, 0xC9, 0x77, 0x2A, 0xC9, 0x77, 0x3C, 0x97, 0x5A, 0xD7, 0x72, 0x9E, 0xA7, 0x70, 0x9D, 0xAD,
+    0x97, 0x69, 0xD2, 0xAC, 0xA7, 0x49, 0xCA, 0x49, 0xCA, 0x73, 0x97, 0x09, 0x77, 0x77, 0x39, 0xAF,
+    0xCA, 0x97, 0x39, 0xFF, 0xEA, 0x70, 0xAF, 0xDA, 0xFE, 0x95, 0xFC, 0xA4, 0x9F, 0xC9, 0x3A, 0xF9,
+    0x7F, 0xC3, 0xF9, 0x71, 0xFA, 0x1A, 0xEA, 0x72, 0x9F, 0x1F, 0x74, 0xF9, 0x0F, 0x74, 0x9E, 0x99,
+    0xE9, 0x75, 0xEA, 0x9E, 0x76, 0xEA, 0x9E, 0x76, 0xAE, 0x9E, 0x76, 0xAE, 0x9E, 0x76, 0xAD, 0xA9,
+    0xE7, 0x6E, 0xA9, 0xE9, 0x75, 0xEA, 0x0F, 0x74, 0xAE, 0x90, 0xFC, 0x72, 0xAF, 0x1A, 0xFD, 0x99,
+    0x29, 0x9A, 0xFD, 0x2F, 0xFF, 0xFE, 0xA2, 0xAF, 0xFF, 0xFD, 0x4F, 0xFF, 0xFC, 0xA5, 0xFF, 0xFE,
+    0xA7, 0xAF, 0xFF, 0x97, 0x29, 0xAF, 0xDA, 0x97, 0x77, 0x40, 0x77, 0x71, 0xAE, 0xA7, 0x29, 0x19,
+    0xC9, 0x74, 0x9C, 0x97, 0x3A, 0xC9, 0x74, 0xC9, 0x70, 0x9A, 0x97, 0x4E, 0x73, 0xFA, 0x71, 0xDA,
+    0x0D, 0xA7, 0xD9, 0x2A, 0xCA, 0x5C, 0xA6, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6A, 0xFA, 0x96,
+    0xAF, 0xFA, 0x4A, 0xFA, 0xAF, 0xC2, 0x9E, 0x5A, 0xD9, 0x1E, 0x7E, 0x1D, 0xA7, 0x9D, 0x99, 0xD9,
+    0x79, 0xDA, 0xAD, 0x97, 0x0D, 0xAA, 0xD9, 0x79, 0xDA, 0x9D, 0xA7, 0x9D, 0xA0, 0xE7, 0xE9, 0x0F,
+    0xA9, 0x99, 0x9A, 0xF2, 0xFF, 0xF9, 0x2A, 0xFF, 0xDA, 0x49, 0xFF, 0xA7, 0xAF, 0xA4, 0x7A, 0xD3,
+    0xAC, 0x74, 0xAC, 0xAD, 0x2A, 0xC7, 0x4D, 0x1D, 0x1D, 0x74, 0xCA, 0x19, 0xFA, 0x74, 0xCA, 0x29,
+    0xE7, 0x77, 0x77, 0x77, 0x79, 0x97, 0x73, 0x9D, 0x97, 0x72, 0xF7, 0x71, 0xDA, 0xE7, 0x7D, 0x91,
+    0x9D, 0x75, 0xD5, 0xD7, 0x49, 0x79, 0x74, 0x9A, 0xFC, 0xA9, 0x73, 0x9F, 0xFE, 0xA7, 0x0A, 0xFD,
+    0xAF, 0xE9, 0x5F, 0xCA, 0x49, 0xFC, 0x93, 0xAF, 0x97, 0xFC, 0x3F, 0x97, 0x1F, 0xA1, 0xAE, 0xA7,
+    0x29, 0xF1, 0xF7, 0x4F, 0x90, 0xF7, 0x49, 0xE9, 0x9E, 0x97, 0x5E, 0xA9, 0xE7, 0x6E, 0xA9, 0xE7,
+    0x6A, 0xE9, 0xE7, 0x6A, 0xE9, 0xE7, 0x6A, 0xDA, 0x9E, 0x76, 0xEA, 0x9E, 0x97, 0x5E, 0xA0, 0xF7,
+    0x4A, 0xE9, 0x0F, 0xC7, 0x2A, 0xF1, 0xAF, 0xD9, 0x92, 0x99, 0xAF, 0xD2, 0xFF, 0xFF, 0xEA, 0x2A,
+    0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xCA, 0x5F, 0xFF, 0xEA, 0x7A, 0xFF, 0xF9, 0x72, 0x9A, 0xFD, 0xA9,
+    0x77, 0x74, 0x49, 0x93, 0x9A, 0x6F, 0x29, 0xC5, 0xAC, 0x99, 0xD1, 0xAC, 0x5D, 0x19, 0xDA, 0xCA,
+    0x5D, 0x29, 0xE7, 0x77, 0x77, 0x29, 0x97, 0x5D, 0x97, 0x3F, 0x72, 0xAD, 0xAD, 0x70, 0xAC, 0xA1,
+    0x9D, 0x6A, 0xC9, 0x4D, 0x59, 0x79, 0x97, 0x77, 0x77, 0x76, 0xAF, 0xA9, 0x6A, 0xFF, 0xA4, 0xAF,
+    0xAA, 0xFC, 0x29, 0xE5, 0xAD, 0x91, 0xE7, 0xE1, 0xDA, 0x79, 0xD9, 0x9D, 0x97, 0x9D, 0xAA, 0xD9,
+    0x70, 0xDA, 0xAD, 0x97, 0x9D, 0xA9, 0xDA, 0x79, 0xDA, 0x0E, 0x7E, 0x90, 0xFA, 0x99, 0x99, 0xAF,
+    0x2F, 0xFF, 0x92, 0xAF, 0xFD, 0xA4, 0x9F, 0xFA, 0x7A, 0xFA, 0x40, 0x72, 0x99, 0x77, 0x3A, 0xD7,
+    0x72, 0x9E, 0xA7, 0x70, 0x9D, 0xAD, 0xA7, 0x69, 0xD2, 0xAC, 0xA7, 0x49, 0xC9, 0x49, 0xCA, 0x77,
+    0x77, 0x77, 0x72, 0x9A, 0xFC, 0xA9, 0x73, 0x9F, 0xFE, 0xA7, 0x0A, 0xFD, 0xAF, 0xE9, 0x5F, 0xCA,
+    0x49, 0xFC, 0x93, 0xAF, 0x97, 0xFC, 0x3F, 0x97, 0x1F, 0xA1, 0xAE, 0xA7, 0x29, 0xF1, 0xF7, 0x4F,
+    0x90, 0xF7, 0x49, 0xE9, 0x9E, 0x97, 0x5E, 0xA9, 0xE7, 0x6E, 0xA9, 0xE7, 0x6A, 0xE9, 0xE7, 0x6A,
+    0xE9, 0xE7, 0x6A, 0xDA, 0x9E, 0x76, 0xEA, 0x9E, 0x97, 0x5E, 0xA0, 0xF7, 0x4A, 0xE9, 0x0F, 0xC7,
+    0x2A, 0xF1, 0xAF, 0xD9, 0x92, 0x99, 0xAF, 0xD2, 0xFF, 0xFF, 0xEA, 0x2A, 0xFF, 0xFF, 0xD4, 0xFF,
+    0xFF, 0xCA, 0x5F, 0xFF, 0xEA, 0x7A, 0xFF, 0xF9, 0x72, 0x9A, 0xFD, 0xA9, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x73, 0xE9, 0x77, 0x2E, 0xA7, 0x72, 0xEA, 0x77, 0x19, 0xF7, 0x71, 0xAF, 0x70, 0x69,
+    0x97, 0x49, 0xD7, 0x4E, 0xA7, 0x2D, 0xAD, 0xA7, 0x0D, 0x91, 0xAC, 0xA6, 0xCA, 0x49, 0xCA, 0x49,
+    0x97, 0x97, 0x77, 0x77, 0x77, 0x77, 0xAF, 0xA9, 0x6A, 0xFF, 0xA4, 0xAF, 0xAA, 0xFC, 0x29, 0xE5,
+    0xAD, 0x91, 0xE7, 0xE1, 0xDA, 0x79, 0xD9, 0x9D, 0x97, 0x9D, 0xAA, 0xD9, 0x70, 0xDA, 0xAD, 0x97,
+    0x9D, 0xA9, 0xDA, 0x79, 0xDA, 0x0E, 0x7E, 0x90, 0xFA, 0x99, 0x99, 0xAF, 0x2F, 0xFF, 0x92, 0xAF,
+    0xFD, 0xA4, 0x9F, 0xFA, 0x7A, 0xFA, 0x77, 0x77, 0x77, 0x72, 0xAD, 0x97, 0x3E, 0x97, 0x29, 0xEA,
+    0x72, 0x9F, 0x72, 0xAF, 0x50, 0x74, 0xD7, 0x75, 0xAC, 0xA7, 0x75, 0xD9, 0x77, 0x4A, 0xD7, 0x75,
+    0xDA, 0x77, 0x49, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x97, 0x76, 0x9C, 0x96, 0x9A,
+    0xFC, 0xA9, 0x59, 0xC9, 0x49, 0xFF, 0xEA, 0x3A, 0xC9, 0x3A, 0xFD, 0xAF, 0xE9, 0x1D, 0x3F, 0xCA,
+    0x49, 0xFC, 0x9A, 0xCA, 0x2A, 0xF9, 0x7F, 0xE3, 0xF9, 0x71, 0xFC, 0x3A, 0xEA, 0x72, 0x9F, 0x3F,
+    0x74, 0xF3, 0xF7, 0x49, 0xE9, 0x19, 0xE9, 0x75, 0xEA, 0x19, 0xE7, 0x6E, 0xA1, 0x9E, 0x76, 0xAD,
+    0xA1, 0x9E, 0x76, 0xAE, 0x19, 0xE7, 0x6A, 0xDA, 0x19, 0xE7, 0x6E, 0xA1, 0x9E, 0x97, 0x5E, 0xA2,
+    0xF7, 0x4A, 0xE9, 0x2F, 0xC7, 0x2A, 0xF3, 0xAF, 0xD9, 0x92, 0x99, 0xAF, 0xD4, 0xFF, 0xFF, 0xEA,
+    0x4A, 0xFF, 0xFF, 0xD6, 0xFF, 0xFF, 0xCA, 0x7F, 0xFF, 0xEA, 0x71, 0xAF, 0xFF, 0x97, 0x49, 0xAF,
+    0xDA, 0x97, 0x77, 0x70, 0x70, 0xD7, 0x6A, 0xCA, 0x76, 0xD7, 0x6A, 0xD7, 0x6D, 0xA7, 0x59, 0xAA,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4C, 0x94, 0xAF, 0xA9, 0x3C, 0x92, 0xAF, 0xFA,
+    0x2C, 0x91, 0xAF, 0xAA, 0xFC, 0x0A, 0xC1, 0x9E, 0x5A, 0xF9, 0x1E, 0x7E, 0x92, 0xDA, 0x79, 0xD9,
+    0x19, 0xD9, 0x79, 0xDA, 0x1A, 0xD9, 0x70, 0xDA, 0x1A, 0xD9, 0x79, 0xDA, 0x19, 0xDA, 0x79, 0xDA,
+    0x2E, 0x7E, 0x92, 0xFA, 0x99, 0x99, 0xAF, 0x4F, 0xFF, 0x94, 0xAF, 0xFD, 0xA6, 0x9F, 0xFA, 0x71,
+    0xAF, 0xA6, 0x69, 0xD9, 0x77, 0x5A, 0xDA, 0x77, 0x5A, 0xE7, 0x75, 0xAE, 0x97, 0x75, 0x99, 0xA7,
+    0x77, 0x77, 0x77, 0x77, 0x71, 0x99, 0x77, 0x69, 0xC9, 0x69, 0xAF, 0xCA, 0x95, 0x9C, 0x94, 0x9F,
+    0xFE, 0xA3, 0xAC, 0x93, 0xAF, 0xDA, 0xFE, 0x91, 0xD3, 0xFC, 0xA4, 0x9F, 0xC9, 0xAC, 0xA2, 0xAF,
+    0x97, 0xFE, 0x3F, 0x97, 0x1F, 0xC3, 0xAE, 0xA7, 0x29, 0xF3, 0xF7, 0x4F, 0x3F, 0x74, 0x9E, 0x91,
+    0x9E, 0x97, 0x5E, 0xA1, 0x9E, 0x76, 0xEA, 0x19, 0xE7, 0x6A, 0xDA, 0x19, 0xE7, 0x6A, 0xE1, 0x9E,
+    0x76, 0xAD, 0xA1, 0x9E, 0x76, 0xEA, 0x19, 0xE9, 0x75, 0xEA, 0x2F, 0x74, 0xAE, 0x92, 0xFC, 0x72,
+    0xAF, 0x3A, 0xFD, 0x99, 0x29, 0x9A, 0xFD, 0x4F, 0xFF, 0xFE, 0xA4, 0xAF, 0xFF, 0xFD, 0x6F, 0xFF,
+    0xFC, 0xA7, 0xFF, 0xFE, 0xA7, 0x1A, 0xFF, 0xF9, 0x74, 0x9A, 0xFD, 0xA9, 0x77, 0x77, 0x00, 0x29,
+    0x99, 0x77, 0xE7, 0x7E, 0x97, 0x6E, 0xA7, 0x6A, 0xAD, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x0C, 0x94, 0xAF, 0xA9, 0x3C, 0x92, 0xAF, 0xFA, 0x2C, 0x91, 0xAF, 0xAA, 0xFC, 0x0A, 0xC1, 0x9E,
+    0x5A, 0xF9, 0x1E, 0x7E, 0x92, 0xDA, 0x79, 0xD9, 0x19, 0xD9, 0x79, 0xDA, 0x1A, 0xD9, 0x70, 0xDA,
+    0x1A, 0xD9, 0x79, 0xDA, 0x19, 0xDA, 0x79, 0xDA, 0x2E, 0x7E, 0x92, 0xFA, 0x99, 0x99, 0xAF, 0x4F,
+    0xFF, 0x94, 0xAF, 0xFD, 0xA6, 0x9F, 0xFA, 0x71, 0xAF, 0xA6, 0x71, 0xAE, 0x97, 0x72, 0x99, 0x1A,
+    0xC7, 0x76, 0xAC, 0x77, 0x5A, 0xC9, 0x77, 0x49, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x75, 0x99, 0x77, 0x69, 0xC9, 0x69, 0xAF, 0xCA, 0x95, 0x9C, 0x94, 0x9F, 0xFE, 0xA3, 0xAC, 0x93,
+    0xAF, 0xDA, 0xFE, 0x91, 0xD3, 0xFC, 0xA4, 0x9F, 0xC9, 0xAC, 0xA2, 0xAF, 0x97, 0xFE, 0x3F, 0x97,
+    0x1F, 0xC3, 0xAE, 0xA7, 0x29, 0xF3, 0xF7, 0x4F, 0x3F, 0x74, 0x9E, 0x91, 0x9E, 0x97, 0x5E, 0xA1,
+    0x9E, 0x76, 0xEA, 0x19, 0xE7, 0x6A, 0xDA, 0x19, 0xE7, 0x6A, 0xE1, 0x9E, 0x76, 0xAD, 0xA1, 0x9E,
+    0x76, 0xEA, 0x19, 0xE9, 0x75, 0xEA, 0x2F, 0x74, 0xAE, 0x92, 0xFC, 0x72, 0xAF, 0x3A, 0xFD, 0x99,
+    0x29, 0x9A, 0xFD, 0x4F, 0xFF, 0xFE, 0xA4, 0xAF, 0xFF, 0xFD, 0x6F, 0xFF, 0xFC, 0xA7, 0xFF, 0xFE,
+    0xA7, 0x1A, 0xFF, 0xF9, 0x74, 0x9A, 0xFD, 0xA9, 0x77, 0x77, 0x00, 0x77, 0x69, 0xF9, 0x73, 0x99,
+    0x1A, 0xC7, 0x7D, 0x76, 0xD7, 0x69, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xC9,
+    0x4A, 0xFA, 0x93, 0xC9, 0x2A, 0xFF, 0xA2, 0xC9, 0x1A, 0xFA, 0xAF, 0xC0, 0xAC, 0x19, 0xE5, 0xAF,
+    0x91, 0xE7, 0xE9, 0x2D, 0xA7, 0x9D, 0x91, 0x9D, 0x97, 0x9D, 0xA1, 0xAD, 0x97, 0x0D, 0xA1, 0xAD,
+    0x97, 0x9D, 0xA1, 0x9D, 0xA7, 0x9D, 0xA2, 0xE7, 0xE9, 0x2F, 0xA9, 0x99, 0x9A, 0xF4, 0xFF, 0xF9,
+    0x4A, 0xFF, 0xDA, 0x69, 0xFF, 0xA7, 0x1A, 0xFA, 0x60, 0x70, 0x99, 0x49, 0x77, 0xEA, 0x29, 0xC7,
+    0x6A, 0xC9, 0x9C, 0xA1, 0xAC, 0x76, 0xD1, 0xAC, 0x90, 0xD7, 0x6D, 0x2A, 0xEA, 0x76, 0xCA, 0x39,
+    0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0x97, 0x76, 0x9C, 0x96, 0x9A, 0xFC, 0xA9, 0x59, 0xC9,
+    0x49, 0xFF, 0xEA, 0x3A, 0xC9, 0x3A, 0xFD, 0xAF, 0xE9, 0x1D, 0x3F, 0xCA, 0x49, 0xFC, 0x9A, 0xCA,
+    0x2A, 0xF9, 0x7F, 0xE3, 0xF9, 0x71, 0xFC, 0x3A, 0xEA, 0x72, 0x9F, 0x3F, 0x74, 0xF3, 0xF7, 0x49,
+    0xE9, 0x19, 0xE9, 0x75, 0xEA, 0x19, 0xE7, 0x6E, 0xA1, 0x9E, 0x76, 0xAD, 0xA1, 0x9E, 0x76, 0xAE,
+    0x19, 0xE7, 0x6A, 0xDA, 0x19, 0xE7, 0x6E, 0xA1, 0x9E, 0x97, 0x5E, 0xA2, 0xF7, 0x4A, 0xE9, 0x2F,
+    0xC7, 0x2A, 0xF3, 0xAF, 0xD9, 0x92, 0x99, 0xAF, 0xD4, 0xFF, 0xFF, 0xEA, 0x4A, 0xFF, 0xFF, 0xD6,
+    0xFF, 0xFF, 0xCA, 0x7F, 0xFF, 0xEA, 0x71, 0xAF, 0xFF, 0x97, 0x49, 0xAF, 0xDA, 0x97, 0x77, 0x70,
+    0x3A, 0xD9, 0x29, 0xC7, 0x9C, 0xAD, 0x2A, 0xC7, 0xD1, 0xD1, 0xAC, 0x7D, 0x2F, 0xA7, 0xD3, 0xE7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7C, 0x94, 0xAF, 0xA9, 0x3C, 0x92, 0xAF, 0xFA, 0x2C, 0x91,
+    0xAF, 0xAA, 0xFC, 0x0A, 0xC1, 0x9E, 0x5A, 0xF9, 0x1E, 0x7E, 0x92, 0xDA, 0x79, 0xD9, 0x19, 0xD9,
+    0x79, 0xDA, 0x1A, 0xD9, 0x70, 0xDA, 0x1A, 0xD9, 0x79, 0xDA, 0x19, 0xDA, 0x79, 0xDA, 0x2E, 0x7E,
+    0x92, 0xFA, 0x99, 0x99, 0xAF, 0x4F, 0xFF, 0x94, 0xAF, 0xFD, 0xA6, 0x9F, 0xFA, 0x71, 0xAF, 0xA6,
+    0x77, 0x59, 0x97, 0x76, 0x9C, 0x96, 0x9A, 0xFC, 0xA9, 0x59, 0xC9, 0x49, 0xFF, 0xEA, 0x3A, 0xC9,
+    0x3A, 0xFD, 0xAF, 0xE9, 0x1D, 0x3F, 0xCA, 0x49, 0xFC, 0x9A, 0xCA, 0x2A, 0xF9, 0x7F, 0xE3, 0xF9,
+    0x71, 0xFC, 0x3A, 0xEA, 0x72, 0x9F, 0x3F, 0x74, 0xF3, 0xF7, 0x49, 0xE9, 0x19, 0xE9, 0x75, 0xEA,
+    0x19, 0xE7, 0x6E, 0xA1, 0x9E, 0x76, 0xAD, 0xA1, 0x9E, 0x76, 0xAE, 0x19, 0xE7, 0x6A, 0xDA, 0x19,
+    0xE7, 0x6E, 0xA1, 0x9E, 0x97, 0x5E, 0xA2, 0xF7, 0x4A, 0xE9, 0x2F, 0xC7, 0x2A, 0xF3, 0xAF, 0xD9,
+    0x92, 0x99, 0xAF, 0xD4, 0xFF, 0xFF, 0xEA, 0x4A, 0xFF, 0xFF, 0xD6, 0xFF, 0xFF, 0xCA, 0x7F, 0xFF,
+    0xEA, 0x71, 0xAF, 0xFF, 0x97, 0x49, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75,
+    0xE9, 0x77, 0x4E, 0xA7, 0x74, 0xEA, 0x77, 0x39, 0xF7, 0x73, 0xAF, 0x72, 0x77, 0x77, 0x1C, 0x94,
+    0xAF, 0xA9, 0x3C, 0x92, 0xAF, 0xFA, 0x2C, 0x91, 0xAF, 0xAA, 0xFC, 0x0A, 0xC1, 0x9E, 0x5A, 0xF9,
+    0x1E, 0x7E, 0x92, 0xDA, 0x79, 0xD9, 0x19, 0xD9, 0x79, 0xDA, 0x1A, 0xD9, 0x70, 0xDA, 0x1A, 0xD9,
+    0x79, 0xDA, 0x19, 0xDA, 0x79, 0xDA, 0x2E, 0x7E, 0x92, 0xFA, 0x99, 0x99, 0xAF, 0x4F, 0xFF, 0x94,
+    0xAF, 0xFD, 0xA6, 0x9F, 0xFA, 0x71, 0xAF, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9D, 0xA7, 0x5A,
+    0xE7, 0x5F, 0x75, 0xF7, 0x49, 0xF9, 0x60, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71,
+    0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x1F,
+    0x71, 0x9F, 0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9F, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F,
+    0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xE9, 0x1F, 0x71, 0xAE,
+    0x91, 0xF9, 0x70, 0xF9, 0x1A, 0xF7, 0x9F, 0x2A, 0xFC, 0xAA, 0x99, 0x9A, 0xFD, 0x29, 0xFF, 0xFF,
+    0xC3, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xE5, 0xFF, 0xFD, 0x96, 0x9F, 0xFD, 0xA7, 0x77, 0x77, 0x77,
+    0x77, 0x39, 0xDA, 0x77, 0x0A, 0xE7, 0x70, 0xF7, 0x70, 0xF9, 0x77, 0xF9, 0x70, 0xAD, 0x96, 0xAD,
+    0x99, 0xD9, 0x6A, 0xD9, 0x9D, 0x96, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x90, 0xDA,
+    0x6E, 0x90, 0xE6, 0xEA, 0x0E, 0x6E, 0xA0, 0xE6, 0xEA, 0x0E, 0x6E, 0xA0, 0xEA, 0x4F, 0xA0, 0xAF,
+    0xFF, 0xA0, 0x9F, 0xFF, 0xA1, 0xFF, 0xFC, 0x1A, 0xFF, 0x9E, 0x29, 0xFC, 0xA0, 0x9E, 0x77, 0x77,
+    0x77, 0x19, 0xE7, 0x2A, 0xE7, 0x2A, 0xE9, 0x71, 0xF9, 0x71, 0xF9, 0x40, 0x7A, 0xEA, 0x77, 0x91,
+    0x9C, 0xA7, 0x71, 0x9C, 0x97, 0x70, 0x9C, 0xA7, 0x71, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x69, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF,
+    0x09, 0xF7, 0x1A, 0xF0, 0x9F, 0x71, 0xAF, 0x09, 0xF7, 0x1A, 0xF1, 0xF7, 0x19, 0xF1, 0xF7, 0x19,
+    0xF1, 0xF7, 0x19, 0xF1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71,
+    0x9E, 0xA1, 0xF7, 0x19, 0xEA, 0x1F, 0x71, 0x9E, 0x91, 0xF7, 0x1A, 0xE9, 0x1F, 0x97, 0x0F, 0x91,
+    0xAF, 0x79, 0xF2, 0xAF, 0xCA, 0xA9, 0x99, 0xAF, 0xD2, 0x9F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFA, 0x3A,
+    0xFF, 0xFE, 0x5F, 0xFF, 0xD9, 0x69, 0xFF, 0xDA, 0x77, 0x71, 0x77, 0x3A, 0xEA, 0x71, 0x91, 0x9C,
+    0x97, 0x3A, 0xC9, 0x72, 0xAC, 0x97, 0x29, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xD9, 0x6A,
+    0xD9, 0x9D, 0x96, 0xAD, 0x99, 0xD9, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x0D,
+    0xA6, 0xE9, 0x0E, 0x6E, 0xA0, 0xE6, 0xEA, 0x0E, 0x6E, 0xA0, 0xE6, 0xEA, 0x0E, 0xA4, 0xFA, 0x0A,
+    0xFF, 0xFA, 0x09, 0xFF, 0xFA, 0x1F, 0xFF, 0xC1, 0xAF, 0xF9, 0xE2, 0x9F, 0xCA, 0x09, 0xE7, 0x60,
+    0x72, 0xAA, 0x77, 0x4D, 0x77, 0x3A, 0xCA, 0x77, 0x3D, 0x97, 0x72, 0xAD, 0x77, 0x3D, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x59, 0x77, 0x5C, 0x97, 0x74, 0xCA, 0x77, 0x39, 0xCA, 0x9F, 0x97, 0x0A, 0xFD,
+    0x99, 0xF7, 0x1A, 0xFC, 0xA0, 0x9F, 0x71, 0xAF, 0x29, 0xF7, 0x1A, 0xF2, 0x9F, 0x71, 0xAF, 0x29,
+    0xF7, 0x1A, 0xF2, 0x9F, 0x71, 0xAF, 0x3F, 0x71, 0x9F, 0x3F, 0x71, 0x9F, 0x3F, 0x71, 0x9F, 0x3F,
+    0x71, 0x9E, 0xA3, 0xF7, 0x19, 0xEA, 0x3F, 0x71, 0x9E, 0xA3, 0xF7, 0x19, 0xEA, 0x3F, 0x71, 0x9E,
+    0xA3, 0xF7, 0x19, 0xE9, 0x3F, 0x71, 0xAE, 0x93, 0xF9, 0x70, 0xF9, 0x3A, 0xF7, 0x9F, 0x4A, 0xFC,
+    0xAA, 0x99, 0x9A, 0xFD, 0x49, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 0xA5, 0xAF, 0xFF, 0xE7, 0xFF, 0xFD,
+    0x97, 0x09, 0xFF, 0xDA, 0x77, 0x75, 0x7A, 0xA7, 0x7D, 0x76, 0xAC, 0xA7, 0x6D, 0x76, 0xAD, 0x76,
+    0xDA, 0x77, 0x77, 0x77, 0x77, 0x76, 0xA7, 0x70, 0xC9, 0xAD, 0x96, 0xAD, 0x99, 0xC0, 0x9D, 0x96,
+    0xAD, 0x9A, 0xC0, 0x9D, 0x96, 0xAF, 0x90, 0x9D, 0xA6, 0xAE, 0xA1, 0x9D, 0xA6, 0xAD, 0x93, 0xDA,
+    0x6E, 0x93, 0xE6, 0xEA, 0x3E, 0x6E, 0xA3, 0xE6, 0xEA, 0x3E, 0x6E, 0xA3, 0xEA, 0x39, 0xFA, 0x3A,
+    0xFF, 0xFA, 0x39, 0xFF, 0xFA, 0x4F, 0xFF, 0xC4, 0xAF, 0xF9, 0xE5, 0x9F, 0xCA, 0x09, 0xE7, 0x74,
+    0x77, 0x74, 0xE7, 0x74, 0xE9, 0x77, 0x3E, 0xA7, 0x73, 0xF7, 0x76, 0x97, 0x77, 0x59, 0x77, 0x5C,
+    0x97, 0x74, 0xCA, 0x77, 0x39, 0xCA, 0x9F, 0x97, 0x0A, 0xFD, 0x99, 0xF7, 0x1A, 0xFC, 0xA0, 0x9F,
+    0x71, 0xAF, 0x29, 0xF7, 0x1A, 0xF2, 0x9F, 0x71, 0xAF, 0x29, 0xF7, 0x1A, 0xF2, 0x9F, 0x71, 0xAF,
+    0x3F, 0x71, 0x9F, 0x3F, 0x71, 0x9F, 0x3F, 0x71, 0x9F, 0x3F, 0x71, 0x9E, 0xA3, 0xF7, 0x19, 0xEA,
+    0x3F, 0x71, 0x9E, 0xA3, 0xF7, 0x19, 0xEA, 0x3F, 0x71, 0x9E, 0xA3, 0xF7, 0x19, 0xE9, 0x3F, 0x71,
+    0xAE, 0x93, 0xF9, 0x70, 0xF9, 0x3A, 0xF7, 0x9F, 0x4A, 0xFC, 0xAA, 0x99, 0x9A, 0xFD, 0x49, 0xFF,
+    0xFF, 0xC5, 0xFF, 0xFF, 0xA5, 0xAF, 0xFF, 0xE7, 0xFF, 0xFD, 0x97, 0x09, 0xFF, 0xDA, 0x77, 0x75,
+    0x77, 0x4E, 0x77, 0xE9, 0x76, 0xEA, 0x76, 0xAE, 0x77, 0x77, 0x77, 0x73, 0xA7, 0x70, 0xC9, 0xAD,
+    0x96, 0xAD, 0x99, 0xC0, 0x9D, 0x96, 0xAD, 0x9A, 0xC0, 0x9D, 0x96, 0xAF, 0x90, 0x9D, 0xA6, 0xAE,
+    0xA1, 0x9D, 0xA6, 0xAD, 0x93, 0xDA, 0x6E, 0x93, 0xE6, 0xEA, 0x3E, 0x6E, 0xA3, 0xE6, 0xEA, 0x3E,
+    0x6E, 0xA3, 0xEA, 0x39, 0xFA, 0x3A, 0xFF, 0xFA, 0x39, 0xFF, 0xFA, 0x4F, 0xFF, 0xC4, 0xAF, 0xF9,
+    0xE5, 0x9F, 0xCA, 0x09, 0xE7, 0x74, 0x7A, 0xEA, 0x77, 0x19, 0x19, 0xCA, 0x77, 0x39, 0xC9, 0x77,
+    0x29, 0xCA, 0x77, 0x3C, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xC9, 0x77, 0x4C, 0xA7, 0x73,
+    0x9C, 0xA9, 0xF9, 0x70, 0xAF, 0xD9, 0x9F, 0x71, 0xAF, 0xCA, 0x09, 0xF7, 0x1A, 0xF2, 0x9F, 0x71,
+    0xAF, 0x29, 0xF7, 0x1A, 0xF2, 0x9F, 0x71, 0xAF, 0x29, 0xF7, 0x1A, 0xF3, 0xF7, 0x19, 0xF3, 0xF7,
+    0x19, 0xF3, 0xF7, 0x19, 0xF3, 0xF7, 0x19, 0xEA, 0x3F, 0x71, 0x9E, 0xA3, 0xF7, 0x19, 0xEA, 0x3F,
+    0x71, 0x9E, 0xA3, 0xF7, 0x19, 0xEA, 0x3F, 0x71, 0x9E, 0x93, 0xF7, 0x1A, 0xE9, 0x3F, 0x97, 0x0F,
+    0x93, 0xAF, 0x79, 0xF4, 0xAF, 0xCA, 0xA9, 0x99, 0xAF, 0xD4, 0x9F, 0xFF, 0xFC, 0x5F, 0xFF, 0xFA,
+    0x5A, 0xFF, 0xFE, 0x7F, 0xFF, 0xD9, 0x70, 0x9F, 0xFD, 0xA7, 0x77, 0x50, 0x77, 0x6A, 0xEA, 0x74,
+    0x91, 0x9C, 0x97, 0x6A, 0xC9, 0x75, 0xAC, 0x97, 0x59, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x76, 0x97,
+    0x70, 0xC0, 0xAD, 0x96, 0xAD, 0x99, 0xC0, 0x9D, 0x96, 0xAD, 0x9A, 0xC0, 0x9D, 0x96, 0xAF, 0x90,
+    0x9D, 0xA6, 0xAE, 0xA1, 0x9D, 0xA6, 0xAD, 0x93, 0xDA, 0x6E, 0x93, 0xE6, 0xEA, 0x3E, 0x6E, 0xA3,
+    0xE6, 0xEA, 0x3E, 0x6E, 0xA3, 0xEA, 0x39, 0xFA, 0x3A, 0xFF, 0xFA, 0x39, 0xFF, 0xFA, 0x4F, 0xFF,
+    0xC4, 0xAF, 0xF9, 0xE5, 0x9F, 0xCA, 0x09, 0xE7, 0x74, 0x69, 0x94, 0xC7, 0x5F, 0x3C, 0x97, 0x39,
+    0xCA, 0x0D, 0x2C, 0x97, 0x3A, 0xC2, 0xCA, 0x0A, 0xC7, 0x4A, 0xC2, 0x9F, 0x74, 0x94, 0x9A, 0xA7,
+    0x77, 0x77, 0x74, 0xC9, 0x77, 0x4C, 0xA7, 0x73, 0x9C, 0xA9, 0xF9, 0x70, 0xAF, 0xD9, 0x9F, 0x71,
+    0xAF, 0xCA, 0x09, 0xF7, 0x1A, 0xF2, 0x9F, 0x71, 0xAF, 0x29, 0xF7, 0x1A, 0xF2, 0x9F, 0x71, 0xAF,
+    0x29, 0xF7, 0x1A, 0xF3, 0xF7, 0x19, 0xF3, 0xF7, 0x19, 0xF3, 0xF7, 0x19, 0xF3, 0xF7, 0x19, 0xEA,
+    0x3F, 0x71, 0x9E, 0xA3, 0xF7, 0x19, 0xEA, 0x3F, 0x71, 0x9E, 0xA3, 0xF7, 0x19, 0xEA, 0x3F, 0x71,
+    0x9E, 0x93, 0xF7, 0x1A, 0xE9, 0x3F, 0x97, 0x0F, 0x93, 0xAF, 0x79, 0xF4, 0xAF, 0xCA, 0xA9, 0x99,
+    0xAF, 0xD4, 0x9F, 0xFF, 0xFC, 0x5F, 0xFF, 0xFA, 0x5A, 0xFF, 0xFE, 0x7F, 0xFF, 0xD9, 0x70, 0x9F,
+    0xFD, 0xA7, 0x77, 0x50, 0x29, 0xD9, 0x29, 0xC7, 0x9D, 0xAC, 0x91, 0x9C, 0x7A, 0xC1, 0xAC, 0x19,
+    0xC7, 0xAC, 0x2D, 0xAD, 0x7D, 0x3E, 0x97, 0x77, 0x77, 0x77, 0x1A, 0x77, 0x0C, 0x9A, 0xD9, 0x6A,
+    0xD9, 0x9C, 0x09, 0xD9, 0x6A, 0xD9, 0xAC, 0x09, 0xD9, 0x6A, 0xF9, 0x09, 0xDA, 0x6A, 0xEA, 0x19,
+    0xDA, 0x6A, 0xD9, 0x3D, 0xA6, 0xE9, 0x3E, 0x6E, 0xA3, 0xE6, 0xEA, 0x3E, 0x6E, 0xA3, 0xE6, 0xEA,
+    0x3E, 0xA3, 0x9F, 0xA3, 0xAF, 0xFF, 0xA3, 0x9F, 0xFF, 0xA4, 0xFF, 0xFC, 0x4A, 0xFF, 0x9E, 0x59,
+    0xFC, 0xA0, 0x9E, 0x77, 0x40, 0x77, 0x49, 0x77, 0x5C, 0x97, 0x74, 0xCA, 0x77, 0x39, 0xCA, 0x9F,
+    0x97, 0x0A, 0xFD, 0x99, 0xF7, 0x1A, 0xFC, 0xA0, 0x9F, 0x71, 0xAF, 0x29, 0xF7, 0x1A, 0xF2, 0x9F,
+    0x71, 0xAF, 0x29, 0xF7, 0x1A, 0xF2, 0x9F, 0x71, 0xAF, 0x3F, 0x71, 0x9F, 0x3F, 0x71, 0x9F, 0x3F,
+    0x71, 0x9F, 0x3F, 0x71, 0x9E, 0xA3, 0xF7, 0x19, 0xEA, 0x3F, 0x71, 0x9E, 0xA3, 0xF7, 0x19, 0xEA,
+    0x3F, 0x71, 0x9E, 0xA3, 0xF7, 0x19, 0xE9, 0x3F, 0x71, 0xAE, 0x93, 0xF9, 0x70, 0xF9, 0x3A, 0xF7,
+    0x9F, 0x4A, 0xFC, 0xAA, 0x99, 0x9A, 0xFD, 0x49, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 0xA5, 0xAF, 0xFF,
+    0xE7, 0xFF, 0xFD, 0x97, 0x09, 0xFF, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xDA, 0x77, 0x2A,
+    0xE7, 0x72, 0xF7, 0x72, 0xF9, 0x77, 0x1F, 0x97, 0x10, 0x77, 0xA7, 0x70, 0xC9, 0xAD, 0x96, 0xAD,
+    0x99, 0xC0, 0x9D, 0x96, 0xAD, 0x9A, 0xC0, 0x9D, 0x96, 0xAF, 0x90, 0x9D, 0xA6, 0xAE, 0xA1, 0x9D,
+    0xA6, 0xAD, 0x93, 0xDA, 0x6E, 0x93, 0xE6, 0xEA, 0x3E, 0x6E, 0xA3, 0xE6, 0xEA, 0x3E, 0x6E, 0xA3,
+    0xEA, 0x39, 0xFA, 0x3A, 0xFF, 0xFA, 0x39, 0xFF, 0xFA, 0x4F, 0xFF, 0xC4, 0xAF, 0xF9, 0xE5, 0x9F,
+    0xCA, 0x09, 0xE7, 0x77, 0x77, 0x77, 0x59, 0xE7, 0x5A, 0xE7, 0x5A, 0xE9, 0x74, 0xF9, 0x74, 0xF9,
+    0x70, 0x4A, 0xAA, 0x77, 0x2E, 0x77, 0x2E, 0x97, 0x71, 0xEA, 0x77, 0x19, 0x9A, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x4E, 0x97, 0x29, 0xE1, 0xF7, 0x2E, 0xA1, 0x9E, 0x97, 0x09, 0xE3, 0xF7, 0x0F,
+    0x39, 0xEA, 0x6A, 0xE9, 0x4F, 0x6F, 0x59, 0xEA, 0x4A, 0xE9, 0x6F, 0x92, 0x9F, 0x79, 0xF2, 0xF9,
+    0x70, 0xF9, 0x09, 0xF7, 0x19, 0xF0, 0xF9, 0x72, 0xFF, 0xC7, 0x3A, 0xFE, 0x97, 0x4F, 0xE7, 0x5A,
+    0xFC, 0x97, 0x6F, 0xC7, 0x7F, 0xA7, 0x7F, 0xA7, 0x7F, 0xA7, 0x69, 0xFA, 0x76, 0xAF, 0xA7, 0x6A,
+    0xFA, 0x76, 0xFC, 0xA7, 0x6F, 0xCA, 0x75, 0x9F, 0xCA, 0x70, 0x2A, 0xCA, 0x75, 0xE9, 0x74, 0xEA,
+    0x74, 0xAE, 0x75, 0x99, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9D, 0xA7, 0x0E, 0x0E, 0x79, 0xDA,
+    0x09, 0xDA, 0x6A, 0xD9, 0x1E, 0x95, 0xE2, 0x9E, 0x5E, 0x3E, 0x93, 0xAD, 0xA3, 0x9E, 0x3E, 0x94,
+    0xEA, 0x2E, 0x59, 0xE9, 0x09, 0xE6, 0xF0, 0xEA, 0x69, 0xEA, 0xEA, 0x7F, 0xE9, 0x79, 0xFD, 0x71,
+    0xFD, 0x71, 0x9F, 0xA7, 0x2F, 0x97, 0x2F, 0x72, 0x9F, 0x71, 0x9F, 0x97, 0x9A, 0xFC, 0x5A, 0xFF,
+    0x6A, 0xFE, 0x7A, 0xFC, 0xA7, 0x0A, 0xDA, 0x97, 0x10, 0x0E, 0x97, 0x29, 0xE1, 0xF7, 0x2E, 0xA1,
+    0x9E, 0x97, 0x09, 0xE3, 0xF7, 0x0F, 0x39, 0xEA, 0x6A, 0xE9, 0x4F, 0x6F, 0x59, 0xEA, 0x4A, 0xE9,
+    0x6F, 0x92, 0x9F, 0x79, 0xF2, 0xF9, 0x70, 0xF9, 0x09, 0xF7, 0x19, 0xF0, 0xF9, 0x72, 0xFF, 0xC7,
+    0x3A, 0xFE, 0x97, 0x4F, 0xE7, 0x5A, 0xFC, 0x97, 0x6F, 0xC7, 0x7F, 0xA7, 0x7F, 0xA7, 0x7F, 0xA7,
+    0x69, 0xFA, 0x76, 0xAF, 0xA7, 0x6A, 0xFA, 0x76, 0xFC, 0xA7, 0x6F, 0xCA, 0x75, 0x9F, 0xCA, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7E, 0x97, 0x70, 0xE9, 0x77, 0x9E,
+    0xA7, 0x7A, 0xEA, 0x77, 0xAE, 0xA7, 0x00, 0x9D, 0xA7, 0x0E, 0x4E, 0x79, 0xDA, 0x49, 0xDA, 0x6A,
+    0xD9, 0x5E, 0x95, 0xE6, 0x9E, 0x5E, 0x7E, 0x93, 0xAD, 0xA7, 0x9E, 0x3E, 0x97, 0x0E, 0xA2, 0xE7,
+    0x19, 0xE9, 0x09, 0xE7, 0x2F, 0x0E, 0xA7, 0x29, 0xEA, 0xEA, 0x73, 0xFE, 0x97, 0x39, 0xFD, 0x75,
+    0xFD, 0x75, 0x9F, 0xA7, 0x6F, 0x97, 0x6F, 0x76, 0x9F, 0x75, 0x9F, 0x97, 0x39, 0xAF, 0xC7, 0x1A,
+    0xFF, 0x49, 0xE1, 0xAF, 0xE5, 0xAE, 0x1A, 0xFC, 0xA6, 0xF1, 0xAD, 0xA9, 0x70, 0xF9, 0x76, 0xF9,
+    0x77, 0x74, 0xAE, 0xA7, 0x79, 0x2C, 0xA7, 0x71, 0x9C, 0x97, 0x70, 0xAC, 0x97, 0x71, 0xC9, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7E, 0x97, 0x29, 0xE1, 0xF7, 0x2E, 0xA1, 0x9E, 0x97,
+    0x09, 0xE3, 0xF7, 0x0F, 0x39, 0xEA, 0x6A, 0xE9, 0x4F, 0x6F, 0x59, 0xEA, 0x4A, 0xE9, 0x6F, 0x92,
+    0x9F, 0x79, 0xF2, 0xF9, 0x70, 0xF9, 0x09, 0xF7, 0x19, 0xF0, 0xF9, 0x72, 0xFF, 0xC7, 0x3A, 0xFE,
+    0x97, 0x4F, 0xE7, 0x5A, 0xFC, 0x97, 0x6F, 0xC7, 0x7F, 0xA7, 0x7F, 0xA7, 0x7F, 0xA7, 0x69, 0xFA,
+    0x76, 0xAF, 0xA7, 0x6A, 0xFA, 0x76, 0xFC, 0xA7, 0x6F, 0xCA, 0x75, 0x9F, 0xCA, 0x70, 0x5A, 0xEA,
+    0x72, 0xA1, 0x9C, 0xA7, 0x5C, 0xA7, 0x39, 0xCA, 0x74, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x59, 0xDA, 0x70, 0xE0, 0xE7, 0x9D, 0xA0, 0x9D, 0xA6, 0xAD, 0x91, 0xE9, 0x5E, 0x29,
+    0xE5, 0xE3, 0xE9, 0x3A, 0xDA, 0x39, 0xE3, 0xE9, 0x4E, 0xA2, 0xE5, 0x9E, 0x90, 0x9E, 0x6F, 0x0E,
+    0xA6, 0x9E, 0xAE, 0xA7, 0xFE, 0x97, 0x9F, 0xD7, 0x1F, 0xD7, 0x19, 0xFA, 0x72, 0xF9, 0x72, 0xF7,
+    0x29, 0xF7, 0x19, 0xF9, 0x79, 0xAF, 0xC5, 0xAF, 0xF6, 0xAF, 0xE7, 0xAF, 0xCA, 0x70, 0xAD, 0xA9,
+    0x71, 0x59, 0xDA, 0x3C, 0x97, 0x2D, 0xAC, 0xA2, 0xC9, 0x71, 0x9C, 0x90, 0x9C, 0x90, 0x9C, 0x97,
+    0x1A, 0xC2, 0xAC, 0xAD, 0x72, 0xAC, 0x3A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xE9,
+    0x72, 0x9E, 0x1F, 0x72, 0xEA, 0x19, 0xE9, 0x70, 0x9E, 0x3F, 0x70, 0xF3, 0x9E, 0xA6, 0xAE, 0x94,
+    0xF6, 0xF5, 0x9E, 0xA4, 0xAE, 0x96, 0xF9, 0x29, 0xF7, 0x9F, 0x2F, 0x97, 0x0F, 0x90, 0x9F, 0x71,
+    0x9F, 0x0F, 0x97, 0x2F, 0xFC, 0x73, 0xAF, 0xE9, 0x74, 0xFE, 0x75, 0xAF, 0xC9, 0x76, 0xFC, 0x77,
+    0xFA, 0x77, 0xFA, 0x77, 0xFA, 0x76, 0x9F, 0xA7, 0x6A, 0xFA, 0x76, 0xAF, 0xA7, 0x6F, 0xCA, 0x76,
+    0xFC, 0xA7, 0x59, 0xFC, 0xA7, 0x49, 0x97, 0x4A, 0xE3, 0xC9, 0x5C, 0xA0, 0xD2, 0xC9, 0x49, 0xC9,
+    0x1C, 0xA0, 0x9C, 0x94, 0xAC, 0x91, 0x9F, 0x59, 0xC3, 0x9A, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x73, 0x9D, 0xA7, 0x0E, 0x0E, 0x79, 0xDA, 0x09, 0xDA, 0x6A, 0xD9, 0x1E, 0x95, 0xE2, 0x9E, 0x5E,
+    0x3E, 0x93, 0xAD, 0xA3, 0x9E, 0x3E, 0x94, 0xEA, 0x2E, 0x59, 0xE9, 0x09, 0xE6, 0xF0, 0xEA, 0x69,
+    0xEA, 0xEA, 0x7F, 0xE9, 0x79, 0xFD, 0x71, 0xFD, 0x71, 0x9F, 0xA7, 0x2F, 0x97, 0x2F, 0x72, 0x9F,
+    0x71, 0x9F, 0x97, 0x9A, 0xFC, 0x5A, 0xFF, 0x6A, 0xFE, 0x7A, 0xFC, 0xA7, 0x0A, 0xDA, 0x97, 0x10,
+    0xAF, 0xFF, 0x0A, 0xFF, 0xF0, 0xAF, 0xFF, 0x00, 0xAF, 0xFF, 0x0A, 0xFF, 0xF0, 0xAF, 0xFF, 0x00,
+    0xAF, 0xFF, 0xFD, 0xAA, 0xFF, 0xFF, 0xDA, 0xAF, 0xFF, 0xFD, 0xA0, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xCA, 0x77, 0x20, 0x9A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xFF, 0xFF, 0xFF, 0xE9,
+    0xAF, 0xFF, 0xFF, 0xFE, 0x97, 0x77, 0x40, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xFF, 0xFF, 0xFF, 0xE9, 0xAF, 0xFF, 0xFF, 0xFE, 0x97, 0x77,
+    0x40, 0x0A, 0xC5, 0x9C, 0x90, 0xD5, 0xAC, 0xA0, 0xD5, 0xAC, 0x90, 0xD5, 0xAC, 0x90, 0xD5, 0xAC,
+    0x90, 0xD5, 0xAC, 0x90, 0xD5, 0xAC, 0x90, 0xD5, 0xAC, 0x90, 0xD5, 0xAC, 0x90, 0xD5, 0xD9, 0x0D,
+    0x5D, 0x09, 0xD5, 0xD0, 0x9C, 0xA5, 0xD0, 0x9C, 0xA5, 0xD0, 0x9C, 0xA5, 0xD0, 0x9C, 0xA5, 0xD0,
+    0x9C, 0xA5, 0xD0, 0x9C, 0xA5, 0xD0, 0x9C, 0xA5, 0xD0, 0xAC, 0xA5, 0xD0, 0xAC, 0xA5, 0xD0, 0xAC,
+    0x95, 0xD0, 0xAC, 0x95, 0xD0, 0xAC, 0x95, 0xD0, 0xAC, 0x95, 0xD0, 0xAF, 0xFF, 0xFF, 0xAF, 0xFF,
+    0xFF, 0xAF, 0xFF, 0xFF, 0x77, 0x77, 0x77, 0x76, 0xAF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xAF, 0xFF,
+    0xFF, 0x9F, 0x92, 0xFA, 0x2F, 0xA2, 0xAF, 0x29, 0xF3, 0xF3, 0xAE, 0xA2, 0x9F, 0x70, 0x1F, 0xC2,
+    0xFA, 0x2F, 0x92, 0xF3, 0xF2, 0xAE, 0xA2, 0xF9, 0x19, 0xF7, 0x20, 0x71, 0xFC, 0x2F, 0xA2, 0xF9,
+    0x19, 0xF2, 0x9F, 0x2A, 0xEA, 0x2F, 0x91, 0x9F, 0x72, 0x9F, 0x92, 0xFA, 0x2F, 0xA2, 0xAF, 0x29,
+    0xF3, 0xF3, 0xAE, 0xA2, 0x9F, 0x70, 0x9F, 0x90, 0xAF, 0x92, 0xFA, 0x09, 0xF9, 0x2F, 0xA1, 0xFA,
+    0x2A, 0xF1, 0xAE, 0xA2, 0x9F, 0x19, 0xEA, 0x3F, 0x2F, 0x3A, 0xEA, 0x1F, 0x92, 0x9F, 0x1A, 0xF7,
+    0x70, 0x1F, 0xC1, 0xFC, 0x2F, 0xA1, 0xFA, 0x2F, 0x91, 0xF9, 0x2F, 0x19, 0xF3, 0xF1, 0x9F, 0x2A,
+    0xEA, 0x1A, 0xEA, 0x2F, 0x91, 0xF9, 0x19, 0xF1, 0x9F, 0x77, 0x10, 0x71, 0xFC, 0x2F, 0xA2, 0xF9,
+    0x19, 0xF2, 0x9F, 0x2A, 0xEA, 0x2F, 0x91, 0x9F, 0x72, 0x0F, 0xA0, 0x9F, 0xA2, 0xFC, 0x1F, 0xC2,
+    0xAF, 0x1A, 0xF2, 0x9F, 0x19, 0xF3, 0xF2, 0xF3, 0xF9, 0x1F, 0x92, 0xAF, 0x1A, 0xEA, 0x3F, 0x19,
+    0xF7, 0x70, 0x59, 0xA7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7,
+    0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x29, 0xAF, 0xF1, 0xFF, 0xFC, 0x9A,
+    0xFE, 0xA9, 0x99, 0x99, 0x6D, 0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x97, 0x3D, 0x97, 0x3D, 0x97,
+    0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97,
+    0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3A, 0xC9, 0x74, 0xC9, 0x74, 0x99, 0x75, 0x95,
+    0x59, 0x97, 0x5D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97,
+    0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x29, 0x9F, 0xF9, 0x1F, 0xFF, 0xCA, 0x09, 0xFE,
+    0xA9, 0x99, 0x99, 0x96, 0xD9, 0x74, 0xD9, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xDA, 0x74,
+    0xDA, 0x74, 0xDA, 0x74, 0xDA, 0x99, 0xA9, 0x39, 0xFF, 0xE3, 0xFF, 0xF3, 0x99, 0x99, 0x9D, 0xA7,
+    0x4D, 0xA7, 0x4D, 0xA7, 0x4D, 0xA7, 0x4D, 0xA7, 0x4D, 0xA7, 0x4D, 0xA7, 0x4A, 0xCA, 0x75, 0xCA,
+    0x75, 0xAC, 0x76, 0xA7, 0x76, 0x29, 0xFF, 0xDA, 0x49, 0xFF, 0xDA, 0x4A, 0xFF, 0xE4, 0xFF, 0xF4,
+    0xFF, 0xF3, 0x9F, 0xFF, 0x92, 0xAF, 0xFF, 0x92, 0xFF, 0xFC, 0xA2, 0xFF, 0xFC, 0xA2, 0xFF, 0xFD,
+    0x19, 0xFF, 0xFD, 0x1A, 0xFF, 0xFD, 0x1F, 0xFF, 0xE9, 0x0F, 0xFF, 0xE9, 0x0F, 0xFF, 0xEA, 0x9F,
+    0xFF, 0xF9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x79, 0xA9, 0x4A, 0xDA, 0x3A, 0xFA,
+    0x1A, 0xFD, 0x0A, 0xFC, 0x90, 0xAE, 0x92, 0xAC, 0x97, 0x40, 0x09, 0xD9, 0x1E, 0xA1, 0xF1, 0xF0,
+    0x9F, 0x00, 0x09, 0xD9, 0x1E, 0xA1, 0xF1, 0xF0, 0x9F, 0x00, 0x09, 0xD9, 0x59, 0xDA, 0x5A, 0xD9,
+    0x1E, 0xA5, 0xAE, 0x5E, 0xA1, 0xF5, 0xF5, 0xF1, 0xF5, 0xF9, 0x39, 0xF0, 0x9F, 0x5F, 0x93, 0xAF,
+    0x00, 0xAD, 0x9A, 0xD9, 0xAD, 0x90, 0x77, 0x77, 0x0D, 0x2A, 0x9A, 0x70, 0xD2, 0xA9, 0x09, 0x96,
+    0x9C, 0xA2, 0xC2, 0xC6, 0xD3, 0xC0, 0xC0, 0xC5, 0xAC, 0xA3, 0xC0, 0xC0, 0xC5, 0xD4, 0xC9, 0x09,
+    0xC4, 0xD9, 0x4F, 0xA3, 0x9D, 0x6D, 0xA4, 0xD9, 0x75, 0xAC, 0xA7, 0x6D, 0x76, 0xDA, 0x75, 0x9D,
+    0x76, 0xD9, 0x75, 0xAD, 0x76, 0xD9, 0x75, 0xE1, 0x97, 0x29, 0xD9, 0x0A, 0x09, 0x1A, 0x09, 0x4D,
+    0xA0, 0x9A, 0x90, 0xA0, 0xA9, 0x0A, 0x2A, 0xD1, 0x99, 0xA0, 0xA9, 0xAA, 0x0A, 0x2D, 0xA1, 0x9A,
+    0x09, 0xA9, 0xA1, 0xA1, 0xE3, 0xCA, 0xC9, 0x0C, 0xAC, 0xA0, 0x9D, 0x93, 0x9C, 0xA1, 0x9D, 0x19,
+    0x99, 0x75, 0x1F, 0xC2, 0xFA, 0x2F, 0x92, 0xF3, 0xF2, 0xAE, 0xA2, 0xF9, 0x19, 0xF7, 0x20, 0x1F,
+    0xC1, 0xFC, 0x2F, 0xA1, 0xFA, 0x2F, 0x91, 0xF9, 0x2F, 0x19, 0xF3, 0xF1, 0x9F, 0x2A, 0xEA, 0x1A,
+    0xEA, 0x2F, 0x91, 0xF9, 0x19, 0xF1, 0x9F, 0x77, 0x10, 0x77, 0x72, 0xA9, 0x5C, 0x94, 0xA9, 0x49,
+    0xE3, 0xAD, 0xA2, 0x9E, 0x3E, 0x92, 0x9E, 0x3E, 0x92, 0x9D, 0xA3, 0xE3, 0xAD, 0x93, 0xE3, 0x9D,
+    0x93, 0xDA, 0x3A, 0xD4, 0xDA, 0x3A, 0xD4, 0xD9, 0x39, 0xCA, 0x4D, 0x77, 0x73, 0x71, 0xAA, 0x4E,
+    0x49, 0xE4, 0xAD, 0x94, 0xE5, 0xD9, 0x49, 0xAC, 0x70, 0x77, 0xAA, 0x3A, 0xA4, 0xE2, 0xE9, 0x39,
+    0xDA, 0x19, 0xE4, 0xAD, 0x91, 0xAD, 0x94, 0xE2, 0xE5, 0xD9, 0x2D, 0x94, 0x9A, 0xC2, 0x9A, 0xC7,
+    0x60, 0x77, 0x70, 0xAA, 0x4A, 0xC5, 0xA9, 0x4E, 0x3E, 0x93, 0xE4, 0xAD, 0xA2, 0x9E, 0x3A, 0xDA,
+    0x4A, 0xD9, 0x29, 0xDA, 0x3E, 0x5E, 0x3A, 0xD4, 0xDA, 0x5D, 0x93, 0xDA, 0x39, 0xD9, 0x49, 0xD4,
+    0xAC, 0x49, 0xD7, 0x77, 0x4D, 0x70, 0xAE, 0x6A, 0xCA, 0xAC, 0xA4, 0xAD, 0x1E, 0x2E, 0x3E, 0x90,
+    0x75, 0xAC, 0x4A, 0xD3, 0xE9, 0x2E, 0x29, 0xE3, 0xDA, 0x3A, 0xE4, 0xF4, 0xF4, 0xF4, 0xE9, 0x4A,
+    0xC6, 0xA0, 0x7A, 0xA5, 0xAD, 0x5E, 0x5E, 0x94, 0xAD, 0x94, 0xAD, 0x93, 0xEA, 0x2F, 0x2F, 0x2F,
+    0x3E, 0x4D, 0x5A, 0x50, 0x75, 0xE7, 0x7A, 0xAA, 0xA6, 0xE9, 0x5A, 0xAA, 0xA4, 0xAE, 0xA4, 0x9E,
+    0xA4, 0xF6, 0xAE, 0xA3, 0xAE, 0xA3, 0xF9, 0x7F, 0x92, 0xFC, 0x2F, 0xA7, 0x1F, 0x97, 0x0F, 0xC7,
+    0x29, 0xF9, 0x6A, 0xF7, 0x4A, 0xF5, 0xAF, 0x76, 0xFC, 0x39, 0xF9, 0x77, 0xFC, 0x19, 0xFA, 0x77,
+    0x09, 0xFA, 0x9F, 0xC7, 0x19, 0xE4, 0xAF, 0xFC, 0x4E, 0x2A, 0xE5, 0xFF, 0x93, 0x9E, 0x91, 0xF6,
+    0xFD, 0x94, 0x9E, 0x91, 0xF9, 0x5F, 0xD9, 0x4A, 0xEA, 0x1F, 0x94, 0xFF, 0x93, 0xFA, 0x72, 0xFF,
+    0xD7, 0x72, 0xFF, 0xF7, 0x70, 0xAF, 0xC9, 0x0F, 0xD7, 0x6A, 0xFC, 0xA1, 0x9F, 0xD7, 0x4A, 0xFC,
+    0xA3, 0x9F, 0xD7, 0x2A, 0xFD, 0x5A, 0xFD, 0x70, 0xAF, 0xD7, 0xFE, 0x6A, 0xFD, 0x97, 0x0F, 0xDA,
+    0x4A, 0xFD, 0x92, 0xE9, 0x3F, 0xDA, 0x29, 0xFD, 0xA3, 0xE9, 0x39, 0xFD, 0xA7, 0x49, 0xEA, 0x77,
+    0x70, 0xAE, 0xA7, 0x77, 0x0A, 0xEA, 0x74, 0x3A, 0xA3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3E, 0x3E, 0x3E,
+    0x3E, 0x3E, 0x3E, 0x3E, 0x29, 0xE2, 0x9E, 0x29, 0xE2, 0xAE, 0x2A, 0xE2, 0xAE, 0x2A, 0xE2, 0xF2,
+    0xF2, 0xAE, 0x77, 0xAE, 0x91, 0xFA, 0x1F, 0xA1, 0xFC, 0x09, 0xFC, 0x0A, 0xFC, 0x00, 0x70, 0x97,
+    0x49, 0xD7, 0x4A, 0xD7, 0x29, 0x9E, 0x70, 0xAF, 0xF9, 0x4F, 0xFE, 0xA2, 0xEA, 0x90, 0xFE, 0x91,
+    0x9C, 0x92, 0xE0, 0xF7, 0xE1, 0xE9, 0x6E, 0x1A, 0xDA, 0x6E, 0x1A, 0xDA, 0x6E, 0x1A, 0xDA, 0x6E,
+    0x1A, 0xDA, 0x6E, 0x1E, 0x95, 0x9E, 0x09, 0xE6, 0x9E, 0x0E, 0x96, 0x9E, 0xAE, 0x79, 0xFD, 0x97,
+    0xAF, 0xCA, 0x79, 0xFC, 0xA7, 0x09, 0xF9, 0x71, 0x9F, 0x72, 0x9F, 0x72, 0x9F, 0x72, 0x9F, 0x72,
+    0x9F, 0x72, 0x9E, 0xA7, 0x77, 0x77, 0x2A, 0xE9, 0x72, 0xAE, 0xA7, 0x2F, 0xA7, 0x2F, 0xC7, 0x19,
+    0xFC, 0x71, 0x9F, 0xC7, 0x1A, 0xFC, 0x71, 0x99, 0x99, 0x99, 0x50, 0xAF, 0xFF, 0x0A, 0xFF, 0xF0,
+    0xAF, 0xFF, 0x76, 0xAC, 0x96, 0xCA, 0x9C, 0x95, 0x9C, 0x90, 0xD9, 0x39, 0xD1, 0x9F, 0xF9, 0x29,
+    0xFD, 0x79, 0x94, 0x7A, 0x77, 0x1C, 0x75, 0xAC, 0x1C, 0x1A, 0xC7, 0x19, 0xAC, 0xAC, 0xAC, 0xA7,
+    0x5A, 0xD7, 0x6A, 0xFA, 0x72, 0x9D, 0x0C, 0x99, 0xD7, 0x2A, 0x1C, 0x97, 0x70, 0xC9, 0x39, 0x7A,
+    0x96, 0xAC, 0x7C, 0x91, 0x90, 0xA9, 0x09, 0xC1, 0xC9, 0x9C, 0xA0, 0xC9, 0x0A, 0xC0, 0xAC, 0xAA,
+    0xC9, 0xCA, 0x19, 0xFC, 0xA3, 0x9D, 0xA5, 0x9D, 0x94, 0xAE, 0xA3, 0xAD, 0xAD, 0x90, 0xAC, 0xA9,
+    0xC0, 0xAC, 0xA0, 0xD0, 0xAA, 0x0A, 0xC0, 0x99, 0x09, 0xC1, 0x91, 0x91, 0xAA, 0x69, 0xC7, 0xAA,
+    0x74, 0x75, 0xD7, 0x5A, 0xC9, 0x74, 0x9C, 0xA7, 0x5D, 0x75, 0x9C, 0xA7, 0x5D, 0x75, 0xAC, 0x97,
+    0x49, 0xD7, 0x5D, 0x97, 0x4A, 0xD7, 0x5D, 0x75, 0xDA, 0x74, 0x9D, 0x75, 0xDA, 0x74, 0xAD, 0x75,
+    0xD9, 0x74, 0xE7, 0x49, 0xD7, 0x5D, 0xA7, 0x4A, 0xD7, 0x49, 0xDA, 0x74, 0xE7, 0x4A, 0xD9, 0x75,
+    0x99, 0x75, 0x77, 0x77, 0x49, 0xAF, 0x97, 0x09, 0xAF, 0xA9, 0x69, 0xFF, 0xCA, 0x5F, 0xFD, 0x49,
+    0xFA, 0xAF, 0xD3, 0xFA, 0xAF, 0xD3, 0xE9, 0x4A, 0xEA, 0x1A, 0xD9, 0x4A, 0xF3, 0xC7, 0xAE, 0x2C,
+    0x96, 0x9E, 0x97, 0x4E, 0x97, 0x3A, 0xDA, 0x74, 0xAD, 0xA7, 0x39, 0xE7, 0x4A, 0xDA, 0x73, 0x9E,
+    0x74, 0xAD, 0xA7, 0x39, 0xE7, 0x4E, 0xA7, 0x3A, 0xDA, 0x74, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x4E,
+    0x73, 0x9E, 0x97, 0x3E, 0x97, 0x29, 0xF7, 0x3A, 0xE7, 0x2A, 0xF7, 0x3A, 0xE7, 0x19, 0xFC, 0x97,
+    0x19, 0xF9, 0x70, 0x9F, 0xC9, 0x71, 0xFC, 0x97, 0x19, 0xF9, 0x71, 0x9F, 0x73, 0x9E, 0xA7, 0x29,
+    0xF7, 0x39, 0xEA, 0x72, 0x9F, 0x73, 0x9E, 0xA7, 0x29, 0xF7, 0x39, 0xEA, 0x72, 0x9F, 0x73, 0x9E,
+    0xA7, 0x29, 0xEA, 0x73, 0x9D, 0xA7, 0x4A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x70, 0xAD, 0x77, 0x75,
+    0xE9, 0x73, 0xEA, 0x73, 0x9E, 0xA7, 0x3E, 0xA7, 0x3A, 0xEA, 0x73, 0xF7, 0x3F, 0xC7, 0x29, 0xF7,
+    0x77, 0x39, 0xF6, 0x77, 0x72, 0x99, 0x99, 0x97, 0x6A, 0xFF, 0x73, 0xFF, 0xE9, 0x70, 0xEA, 0x91,
+    0x9A, 0xF9, 0x3A, 0xCA, 0x09, 0xC9, 0x6F, 0x3D, 0xA1, 0x97, 0x0E, 0x92, 0xDA, 0x73, 0xEA, 0x2D,
+    0xA7, 0x3A, 0xDA, 0x2D, 0xA7, 0x3A, 0xDA, 0x2D, 0xA7, 0x3A, 0xDA, 0x2D, 0xA7, 0x3E, 0x92, 0xDA,
+    0x72, 0x9E, 0x29, 0xDA, 0x72, 0xEA, 0x29, 0xDA, 0x71, 0xAE, 0x39, 0xDA, 0x70, 0xAE, 0x93, 0xAD,
+    0xA7, 0xFA, 0x4A, 0xDA, 0x5A, 0xFC, 0x5A, 0xDA, 0x4A, 0xFA, 0x6E, 0xA4, 0xAE, 0xA7, 0xEA, 0x4A,
+    0xEA, 0x7E, 0xA4, 0xAE, 0xA7, 0xEA, 0x4A, 0xEA, 0x7E, 0xA4, 0xAE, 0xA7, 0xEA, 0x4A, 0xE9, 0x7A,
+    0xAC, 0xA4, 0x99, 0x77, 0x77, 0x77, 0x5F, 0x6E, 0x7F, 0x95, 0xE9, 0x59, 0xF9, 0x49, 0xEA, 0x59,
+    0xFA, 0x4A, 0xEA, 0x5A, 0xFC, 0x4F, 0xC5, 0xFD, 0x77, 0x77, 0x09, 0x99, 0x99, 0x75, 0x9F, 0xFA,
+    0x72, 0x9F, 0xFE, 0x71, 0xEA, 0x29, 0xFC, 0x69, 0x0D, 0x6A, 0xE9, 0x3A, 0xD7, 0x2A, 0xE3, 0xAD,
+    0x73, 0xE3, 0xAD, 0x73, 0xE3, 0xE7, 0x3E, 0x3E, 0x73, 0xE3, 0xE7, 0x29, 0xE3, 0xE7, 0x2A, 0xDA,
+    0x3E, 0x72, 0xE4, 0xE7, 0x1E, 0xA4, 0xE7, 0x0F, 0x49, 0xE6, 0x9F, 0x94, 0x9E, 0x49, 0xFC, 0x95,
+    0x9E, 0x4F, 0xC9, 0x69, 0xE4, 0xF7, 0x0A, 0xE4, 0xF7, 0x0A, 0xE4, 0xF7, 0x0A, 0xE4, 0xF7, 0x0F,
+    0x4F, 0x70, 0xF4, 0xF7, 0x0F, 0x4A, 0xA9, 0x72, 0x9A, 0xC7, 0x77, 0x77, 0x70, 0x9D, 0xA7, 0xAE,
+    0x94, 0xAE, 0x7F, 0xA4, 0xF7, 0xFA, 0x4F, 0x95, 0x9F, 0xC4, 0xF9, 0x59, 0xFC, 0x77, 0xAF, 0xC7,
+    0x70, 0x77, 0x77, 0xC9, 0x75, 0xD7, 0x59, 0xD7, 0x5A, 0xCA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD,
+    0x75, 0xDA, 0x75, 0xD7, 0x5A, 0xD6, 0xE9, 0x2D, 0xA6, 0xE9, 0x2D, 0x95, 0x9E, 0xA1, 0x9D, 0x6A,
+    0xEA, 0x1A, 0xD6, 0xAE, 0xA1, 0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD7, 0x5D, 0xA7, 0x5D, 0x97, 0x4A,
+    0xD7, 0x5E, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD7, 0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x09,
+    0xE7, 0xE1, 0xAE, 0x7D, 0xA1, 0xF6, 0xAD, 0x91, 0xF6, 0xE2, 0xF9, 0x5E, 0x74, 0x9D, 0xA7, 0x4A,
+    0xD9, 0x74, 0xE7, 0x49, 0xE7, 0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x74, 0xAD, 0xA7, 0x4E, 0x97, 0x4E,
+    0x74, 0x9D, 0x75, 0xAA, 0x76, 0x97, 0x60, 0x19, 0x99, 0x3A, 0x90, 0x9C, 0x19, 0xC2, 0xAA, 0x0A,
+    0xA0, 0xA0, 0x9C, 0x0C, 0xA0, 0xC9, 0x0C, 0x0C, 0xA0, 0xC0, 0x9C, 0x0D, 0x2A, 0xC0, 0xAC, 0x2D,
+    0x09, 0xDA, 0xDA, 0x1F, 0xC3, 0xAD, 0x91, 0x73, 0xC9, 0x4A, 0xC9, 0x39, 0xCA, 0xA3, 0xC9, 0xAA,
+    0x2C, 0xA0, 0xAA, 0x1A, 0xC9, 0x0D, 0x90, 0xFE, 0x93, 0xD5, 0xD5, 0xD1, 0x79, 0xFC, 0x90, 0x9A,
+    0x5A, 0xA5, 0xAC, 0x5A, 0xF9, 0x29, 0x19, 0xCA, 0x5A, 0xC5, 0xAC, 0x09, 0xA9, 0x9A, 0xD0, 0xAF,
+    0xC9, 0x09, 0xF9, 0x10, 0x19, 0xEA, 0x1A, 0xC9, 0x4C, 0x5A, 0xA5, 0xAA, 0xEA, 0x1D, 0xA1, 0xD0,
+    0xD2, 0x9C, 0x0A, 0xC3, 0xC9, 0x9C, 0x91, 0xAC, 0x1F, 0xCA, 0x2A, 0xD9, 0x10, 0x7F, 0xE9, 0x49,
+    0xC5, 0x9C, 0x5D, 0x5D, 0x49, 0xCA, 0x4A, 0xC9, 0x4D, 0x94, 0xD4, 0x9D, 0x4A, 0xD7, 0x10, 0x29,
+    0xAA, 0x93, 0xC9, 0x1A, 0xA2, 0xC2, 0x9C, 0x2C, 0x29, 0xC2, 0xAC, 0x99, 0xC9, 0x3E, 0xA3, 0xCA,
+    0x1D, 0x1A, 0xC3, 0xC9, 0x0D, 0x3C, 0x90, 0x9D, 0x9A, 0xD2, 0x9E, 0xA1, 0x1A, 0xD9, 0x2C, 0x90,
+    0x9C, 0xA0, 0xAA, 0x2A, 0xC0, 0xCA, 0x29, 0xC9, 0xAA, 0x29, 0xC9, 0x9C, 0x91, 0xAC, 0xA0, 0xAF,
+    0xCA, 0x29, 0x90, 0xC9, 0x49, 0xC9, 0x0F, 0xD1, 0xFA, 0x10, 0x69, 0x99, 0x69, 0xD0, 0xAF, 0xCA,
+    0x49, 0xFF, 0xE3, 0xAF, 0x92, 0xAD, 0xA2, 0xAE, 0x94, 0xE2, 0xAE, 0x5A, 0xD9, 0x1E, 0x95, 0x9D,
+    0x91, 0xE9, 0x59, 0xDA, 0x1E, 0x95, 0x9D, 0xA1, 0xE9, 0x59, 0xE1, 0xE9, 0x5A, 0xE1, 0xEA, 0x5A,
+    0xE1, 0xEA, 0x5A, 0xE0, 0x9E, 0xA5, 0xAE, 0x09, 0xEA, 0x5A, 0xE0, 0x9E, 0xA5, 0xAE, 0x0A, 0xF5,
+    0xAE, 0x90, 0x29, 0xAD, 0xA4, 0xAC, 0x2A, 0xC2, 0x9C, 0x4C, 0xA1, 0xD4, 0xAC, 0x1C, 0xA1, 0xC9,
+    0x09, 0xC9, 0x9C, 0xA0, 0x9C, 0xA0, 0x9C, 0x99, 0xCA, 0x09, 0xCA, 0x09, 0xCA, 0x9D, 0x1C, 0x90,
+    0xAC, 0xA9, 0xD4, 0xAC, 0x90, 0xD4, 0xD9, 0x0E, 0x2A, 0xD1, 0xFA, 0xF1, 0x9F, 0xEA, 0x2A, 0xFD,
+    0x49, 0xAD, 0xA2, 0x79, 0xD3, 0xCA, 0xC4, 0x9C, 0x49, 0xC4, 0x9C, 0x4A, 0xC4, 0xAC, 0x4A, 0xC4,
+    0xAC, 0x2F, 0xDA, 0xFD, 0xA0, 0x79, 0xFA, 0x1A, 0x91, 0x9C, 0xA5, 0xAC, 0x5A, 0xC5, 0xD4, 0xAC,
+    0xA3, 0xAD, 0x29, 0xE3, 0xE3, 0xAF, 0xD0, 0xAF, 0xD9, 0x0A, 0xE9, 0x6A, 0xA6, 0xC5, 0xAA, 0x2E,
+    0xA5, 0xAC, 0x95, 0xAC, 0x59, 0xC1, 0x91, 0x9D, 0x0A, 0xFC, 0xA0, 0x9F, 0x91, 0x39, 0x95, 0xCA,
+    0x4A, 0xAA, 0x39, 0xA9, 0xA3, 0xC0, 0xAC, 0x2C, 0x90, 0xAC, 0x1A, 0xFC, 0x90, 0xAF, 0xD9, 0x3D,
+    0x5D, 0x5D, 0x90, 0x69, 0xFC, 0x0A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAF, 0x94, 0x9C, 0x94, 0xCA, 0x39,
+    0xCA, 0xAF, 0xC0, 0xAF, 0x97, 0x71, 0xAE, 0xA1, 0xAC, 0x5C, 0x5A, 0xC5, 0xAF, 0xC1, 0xDA, 0x1A,
+    0xC0, 0xAC, 0x3C, 0x9A, 0xC3, 0xC9, 0x9C, 0xA1, 0xAC, 0x1F, 0xD2, 0xAD, 0xA1, 0x7A, 0xFD, 0x59,
+    0xC5, 0xAC, 0x5D, 0x5C, 0xA4, 0x9C, 0x94, 0xAC, 0x94, 0xD4, 0x9D, 0x4A, 0xD4, 0xAC, 0xA1, 0x2A,
+    0xDA, 0x3C, 0x29, 0xC2, 0xC3, 0xC2, 0xCA, 0x1A, 0xC3, 0xF3, 0xAC, 0x99, 0xCA, 0x19, 0xC3, 0xC9,
+    0x0D, 0x3C, 0xA0, 0xAC, 0xA1, 0xAC, 0xA1, 0xFC, 0xA4, 0x99, 0x20, 0x09, 0xEA, 0x2C, 0x91, 0xCA,
+    0x0A, 0xA2, 0x9C, 0x0C, 0xA2, 0x9C, 0x9A, 0xA2, 0x9C, 0x99, 0xCA, 0x99, 0xD9, 0x09, 0xFC, 0x95,
+    0xC9, 0x4A, 0xC1, 0xFD, 0x1F, 0xA1, 0x59, 0xD6, 0xDA, 0x59, 0xD6, 0xDA, 0x59, 0xD6, 0xDA, 0x59,
+    0xD6, 0xAD, 0x6D, 0xA5, 0x9D, 0x6E, 0x6D, 0xA5, 0x9D, 0x95, 0xAD, 0x6A, 0xD6, 0xE6, 0xE6, 0xE6,
+    0xE6, 0xDA, 0x6E, 0x6E, 0x6E, 0x6E, 0x6A, 0xD6, 0x9D, 0x96, 0xDA, 0x6E, 0x6E, 0x6A, 0xD9, 0x59,
+    0xE6, 0xE6, 0xAD, 0x95, 0x9E, 0x6E, 0x6A, 0xDA, 0x6E, 0x6E, 0xA5, 0x9E, 0x00, 0x9D, 0x6D, 0xA5,
+    0x9D, 0x6D, 0xA5, 0x9D, 0x6D, 0xA5, 0xAD, 0x6D, 0x95, 0xE5, 0x9D, 0x6D, 0xA5, 0xE5, 0xAD, 0x59,
+    0xD5, 0x9D, 0x95, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xE5, 0xDA, 0x5D, 0xA5, 0xDA, 0x49, 0xD9,
+    0x49, 0xD9, 0x4A, 0xD5, 0xE5, 0xE4, 0x9D, 0xA4, 0xAD, 0x94, 0xE4, 0x9D, 0xA4, 0xAD, 0x94, 0xE4,
+    0xAE, 0x4E, 0x93, 0x9E, 0x4E, 0xA3, 0x9E, 0x40, 0x72, 0x9A, 0xA2, 0x9A, 0xA7, 0x2E, 0x2D, 0xA7,
+    0x2D, 0xA2, 0xD9, 0x71, 0x9D, 0x91, 0x9D, 0x72, 0xAD, 0x2A, 0xD7, 0x2D, 0xA2, 0xDA, 0x72, 0xFF,
+    0xA9, 0x79, 0xFF, 0xDA, 0x6A, 0xFF, 0xE9, 0x5F, 0xDA, 0x99, 0xEA, 0x5F, 0xD9, 0x19, 0xD6, 0xFE,
+    0x2A, 0xD5, 0x9F, 0xE2, 0xDA, 0x5F, 0x0D, 0xA2, 0xD9, 0x49, 0xEA, 0x0D, 0x91, 0x9D, 0x5A, 0xE0,
+    0x9D, 0x2A, 0xD5, 0xF0, 0xE2, 0xDA, 0x5E, 0xA0, 0xDA, 0x2D, 0x94, 0x9E, 0xA9, 0xD9, 0x19, 0xD5,
+    0x9E, 0xAA, 0xD2, 0xAD, 0x59, 0xFE, 0x2D, 0xA5, 0x9F, 0xD9, 0x19, 0xD9, 0x59, 0xFD, 0x2A, 0xD7,
+    0xFD, 0x91, 0xE7, 0xFF, 0xAD, 0xA9, 0x9A, 0xDA, 0x1A, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xA2, 0x9F,
+    0xFF, 0xEA, 0x3F, 0xFF, 0xEA, 0x3F, 0xFF, 0xEA, 0x29, 0xD9, 0xAF, 0xFA, 0xA9, 0x3A, 0xD2, 0xDA,
+    0x72, 0xDA, 0x2D, 0x97, 0x2D, 0x91, 0x9D, 0x72, 0xAD, 0x2A, 0xD7, 0x2E, 0x2D, 0xA7, 0x2D, 0x92,
+    0xD9, 0x70, 0x77, 0x76, 0x9A, 0xFC, 0xA9, 0x79, 0xAF, 0xFC, 0xA6, 0xAF, 0xFE, 0x95, 0xFD, 0xA9,
+    0x99, 0x9A, 0xA5, 0xFC, 0x97, 0x4F, 0xC7, 0x59, 0xF7, 0x6F, 0x97, 0x59, 0xEA, 0x76, 0xAE, 0x77,
+    0xF7, 0x7E, 0xA6, 0x99, 0x19, 0x91, 0x9E, 0xA5, 0x9D, 0xAE, 0x19, 0xEA, 0x59, 0xFD, 0x90, 0x9F,
+    0x59, 0xE9, 0x39, 0xF9, 0x49, 0xD9, 0x49, 0xFC, 0x49, 0xD6, 0xFD, 0xA2, 0x9D, 0x6F, 0xFC, 0xAA,
+    0xDA, 0xAD, 0xA1, 0xAF, 0xFF, 0xFA, 0x2F, 0xFF, 0xFA, 0x2A, 0xFF, 0xFE, 0xA3, 0xAF, 0xFF, 0xDA,
+    0x4A, 0xFF, 0xFC, 0xA6, 0xAF, 0xFA, 0xA9, 0x77, 0x40, 0x77, 0x77, 0x73, 0x99, 0x97, 0x3A, 0xFE,
+    0x96, 0x9F, 0xFE, 0x49, 0xFA, 0x29, 0xAE, 0x3E, 0xA7, 0xA9, 0x3E, 0x76, 0xAD, 0x76, 0x9D, 0x77,
+    0xD9, 0x74, 0xAF, 0xFF, 0x4A, 0xFF, 0xF4, 0xAF, 0xFF, 0x7E, 0x76, 0xAD, 0x73, 0x9A, 0xAF, 0xAA,
+    0xAA, 0xAA, 0x93, 0x9F, 0xFF, 0xA3, 0x9F, 0xFF, 0xA7, 0xAD, 0xA7, 0x5A, 0xDA, 0x75, 0xEA, 0x74,
+    0xF7, 0x3A, 0xF9, 0x71, 0xAF, 0xA9, 0x72, 0xAF, 0xFF, 0xAA, 0x91, 0xAF, 0xFF, 0xF0, 0xAF, 0xFF,
+    0xF9, 0x77, 0x3A, 0xDA, 0x70, 0xAE, 0xA7, 0x1F, 0x70, 0xAF, 0x71, 0xF7, 0x0F, 0xCA, 0x70, 0xEA,
+    0x70, 0xFD, 0x70, 0xEA, 0x70, 0xFD, 0xA7, 0xEA, 0x70, 0xFE, 0x69, 0xEA, 0x70, 0xFE, 0xA5, 0x9E,
+    0x97, 0x0E, 0xAF, 0x59, 0xE9, 0x70, 0xEA, 0xAE, 0x94, 0xAE, 0x97, 0x9E, 0xA0, 0xF4, 0xAE, 0x97,
+    0x9E, 0xA0, 0xAE, 0x93, 0xAE, 0x97, 0x9E, 0xA1, 0xF3, 0xF5, 0xFF, 0xFF, 0xFF, 0xDA, 0x0F, 0xFF,
+    0xFF, 0xFD, 0xA0, 0xAA, 0xAF, 0xCA, 0xAA, 0xFA, 0xAA, 0xFA, 0xAA, 0xA9, 0x3F, 0xC3, 0xF1, 0xF7,
+    0x0F, 0xC3, 0xAE, 0x1F, 0x70, 0xFC, 0x4E, 0xA9, 0xF7, 0x0F, 0xC4, 0xFA, 0xF7, 0x0F, 0xC4, 0x9F,
+    0xF7, 0x0F, 0xC5, 0xFE, 0xA7, 0x9F, 0xC5, 0x9F, 0xDA, 0x79, 0xFC, 0x6F, 0xDA, 0x79, 0xFC, 0x69,
+    0xFC, 0xA4, 0x49, 0xFF, 0xCA, 0x73, 0x9F, 0xFE, 0xA7, 0x1A, 0xEA, 0xAA, 0xFE, 0x70, 0xAD, 0xA5,
+    0xAE, 0xA7, 0xAD, 0xA6, 0x9E, 0x7A, 0xDA, 0x7E, 0x92, 0xFF, 0xFF, 0xFC, 0x90, 0xFF, 0xFF, 0xFC,
+    0x94, 0xEA, 0x7E, 0x96, 0xEA, 0x59, 0xF7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFC, 0xA7, 0x0F, 0xFF, 0x97,
+    0x1F, 0xCA, 0xAA, 0x99, 0x74, 0xF7, 0x72, 0xF7, 0x71, 0x9F, 0x77, 0x19, 0xF7, 0x71, 0x9F, 0x77,
+    0x19, 0xF7, 0x71, 0x9F, 0x77, 0x1A, 0xF7, 0x71, 0xAF, 0x97, 0x70, 0xAF, 0x97, 0x70, 0xAF, 0x97,
+    0x40, 0x09, 0xFD, 0xA7, 0x74, 0xAF, 0xF9, 0x77, 0x2A, 0xDA, 0xAA, 0xF7, 0x72, 0xAC, 0x5D, 0xA7,
+    0x71, 0xAC, 0x59, 0xD7, 0x71, 0xAC, 0x6D, 0x77, 0x1D, 0x6D, 0x77, 0x1D, 0x59, 0xD7, 0x71, 0xD5,
+    0xE7, 0x0A, 0xFA, 0x2D, 0x99, 0x99, 0xAF, 0x7F, 0xE2, 0xFF, 0xD9, 0x69, 0xD9, 0x90, 0x99, 0x2F,
+    0xFC, 0xA7, 0xAC, 0x70, 0xFF, 0xC7, 0x0D, 0x70, 0xFF, 0xD7, 0xAC, 0xA7, 0xE9, 0x2A, 0xDA, 0x69,
+    0xEA, 0x5E, 0x4E, 0x7A, 0xFC, 0x29, 0xE4, 0x9D, 0x97, 0x9F, 0xC9, 0x09, 0xE4, 0x9D, 0xA7, 0x29,
+    0xE0, 0x9E, 0x49, 0xE7, 0x39, 0xD9, 0x9E, 0x93, 0x9E, 0x6C, 0xA9, 0x1A, 0xD9, 0x9E, 0x93, 0x9E,
+    0x94, 0xAF, 0xF9, 0xAE, 0x93, 0xAE, 0xA3, 0x9F, 0xFC, 0x0A, 0xE9, 0x3A, 0xF3, 0x9F, 0xFA, 0x0A,
+    0xE9, 0x3A, 0xF4, 0x9A, 0xFC, 0x91, 0x1A, 0xCA, 0x74, 0xAC, 0xA2, 0x9D, 0x74, 0xD9, 0x29, 0xD7,
+    0x4D, 0x93, 0xD7, 0x4D, 0x4D, 0x97, 0x29, 0xD4, 0xD9, 0x72, 0xAD, 0x4D, 0xA4, 0x94, 0xAC, 0xA4,
+    0xAC, 0xA3, 0xAC, 0xA3, 0xDA, 0x19, 0xFF, 0xFF, 0xFC, 0x9F, 0xFF, 0xFF, 0xC9, 0xFF, 0xFF, 0xFA,
+    0x3D, 0x91, 0xFA, 0x1A, 0xD6, 0xD9, 0x09, 0xFC, 0x1A, 0xD6, 0xDA, 0x0A, 0xD9, 0xD9, 0x0D, 0xA6,
+    0xAD, 0x0E, 0x0D, 0xA0, 0xD9, 0x6A, 0xD9, 0xE0, 0xE0, 0xD9, 0x69, 0xDA, 0xDA, 0x0A, 0xDA, 0xD7,
+    0x9F, 0xC9, 0x09, 0xFC, 0x70, 0xFC, 0x2F, 0xC7, 0x0F, 0xC2, 0xFA, 0x70, 0xFA, 0x2A, 0xEA, 0x70,
+    0xF9, 0x29, 0xE9, 0x70, 0xAE, 0x4E, 0x97, 0x09, 0xE4, 0xE4, 0x77, 0x69, 0xDA, 0xAA, 0x99, 0x76,
+    0x9F, 0xFD, 0x97, 0x29, 0xFF, 0xF6, 0xDA, 0x9F, 0x91, 0x9A, 0xF5, 0xDA, 0x9E, 0x6A, 0xE4, 0xDA,
+    0x9D, 0xA7, 0xAD, 0x4D, 0xA9, 0xD9, 0x70, 0xD9, 0x3D, 0xA9, 0xD9, 0x70, 0xDA, 0x3D, 0xA9, 0xD9,
+    0x29, 0x93, 0xAC, 0xA3, 0xDA, 0x9D, 0x92, 0xAD, 0x2A, 0xCA, 0x3D, 0xA9, 0xD9, 0x2A, 0xD2, 0xAD,
+    0x3D, 0xA9, 0xD9, 0x2A, 0xD2, 0xAD, 0x3D, 0xA9, 0xD9, 0x2A, 0xD2, 0xAD, 0x3D, 0xA9, 0xD9, 0x2A,
+    0xD3, 0x99, 0x29, 0xDA, 0x9D, 0x92, 0x9D, 0x70, 0x9D, 0xA9, 0xD9, 0x29, 0xD7, 0x09, 0xDA, 0x9D,
+    0x93, 0xDA, 0x79, 0xDA, 0x9D, 0x93, 0xAD, 0xA6, 0xEA, 0x9D, 0x94, 0xFA, 0x91, 0x9F, 0xA9, 0xD6,
+    0xFF, 0xFA, 0x72, 0x9A, 0xFF, 0xCA, 0x76, 0x99, 0xAA, 0xAD, 0xA0, 0x77, 0x76, 0x9C, 0xA7, 0x79,
+    0xCA, 0x73, 0x99, 0x99, 0xAC, 0xA9, 0x99, 0x70, 0xFF, 0xD9, 0x7F, 0xFD, 0x97, 0x3A, 0xC9, 0x71,
+    0xAE, 0x90, 0xAC, 0x97, 0x0F, 0xD9, 0xAC, 0x97, 0xEA, 0xAF, 0xC9, 0x6A, 0xCA, 0x3A, 0xE9, 0x6D,
+    0x5E, 0x95, 0x9C, 0xA5, 0xE6, 0xAC, 0xA5, 0xE6, 0xAC, 0xA5, 0xE6, 0x9D, 0x93, 0xAE, 0x7F, 0xFE,
+    0x96, 0xAF, 0xFD, 0x97, 0xAF, 0xFC, 0x97, 0x09, 0xAE, 0xA0, 0xAA, 0x93, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x93, 0xAF, 0xFF, 0xD3, 0xAF, 0xFF, 0xD3, 0x77, 0x72, 0x9A, 0xFD, 0x96, 0x9F,
+    0xFC, 0x95, 0x9F, 0xFD, 0x95, 0xFA, 0x92, 0x99, 0x59, 0xEA, 0x74, 0xAE, 0x75, 0xAD, 0x97, 0x5E,
+    0x29, 0x95, 0x9F, 0xFE, 0x94, 0xFF, 0xFA, 0x70, 0xE7, 0x6E, 0x76, 0xFF, 0x5F, 0xFF, 0x49, 0xFE,
+    0x99, 0x74, 0xE9, 0x75, 0xE9, 0x75, 0xAE, 0x75, 0x9E, 0x97, 0x49, 0xFA, 0x97, 0x3F, 0xFE, 0x95,
+    0x9F, 0xFD, 0x96, 0x9F, 0xFC, 0x97, 0x09, 0xAF, 0xD9, 0x77, 0x10, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xFF, 0x9A, 0xA9, 0x99, 0x91, 0xE9, 0x39, 0x99, 0x97, 0x0E, 0x97, 0x70, 0xE9,
+    0x77, 0x0E, 0x91, 0x97, 0x5E, 0xAA, 0xD9, 0x74, 0xFE, 0x97, 0x3A, 0xFD, 0x97, 0x19, 0xFE, 0x74,
+    0xFE, 0xA7, 0x4D, 0xA9, 0xEA, 0x09, 0xC9, 0x70, 0x91, 0x9F, 0xE9, 0x73, 0x9F, 0xE9, 0x71, 0x9A,
+    0xFC, 0xA9, 0x72, 0xFE, 0xA7, 0x4F, 0xF7, 0x4C, 0x90, 0xAF, 0x77, 0xAF, 0x77, 0xAF, 0x77, 0xAF,
+    0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x70, 0x59, 0xFF, 0xCA, 0x76, 0x9F, 0xFE, 0xA7, 0x4A, 0xEA,
+    0xAA, 0xFE, 0x73, 0xAD, 0xA5, 0x9F, 0x72, 0xAD, 0xA7, 0xE4, 0x9F, 0xFF, 0xFF, 0xF6, 0xEA, 0x7A,
+    0xDA, 0x71, 0xEA, 0x7A, 0xDA, 0x39, 0xFF, 0xFF, 0xFF, 0x6E, 0xA5, 0x9F, 0x72, 0xFF, 0xFD, 0xA7,
+    0x2F, 0xFF, 0xCA, 0x73, 0xFF, 0xF9, 0x74, 0xFC, 0xAA, 0xA9, 0x97, 0x7F, 0x77, 0x5F, 0x77, 0x49,
+    0xF7, 0x74, 0x9F, 0x77, 0x49, 0xF7, 0x74, 0x9F, 0x77, 0x4A, 0xF7, 0x74, 0xAF, 0x77, 0x4A, 0xF9,
+    0x77, 0x3A, 0xF9, 0x77, 0x3A, 0xF9, 0x76, 0x72, 0x9A, 0xA7, 0x73, 0x9C, 0xA7, 0x73, 0x9C, 0xA7,
+    0x73, 0x9C, 0xA7, 0x73, 0x9C, 0xA7, 0x79, 0x9A, 0xFF, 0x97, 0x0A, 0xFF, 0xFC, 0x69, 0xFF, 0xDA,
+    0xF9, 0x49, 0xFC, 0x91, 0xAC, 0x93, 0x99, 0x4F, 0xC3, 0xAC, 0x97, 0x19, 0xF4, 0xAC, 0x97, 0x1F,
+    0xA4, 0xAC, 0x97, 0x1F, 0x5A, 0xC9, 0x71, 0xF5, 0xAC, 0x97, 0x09, 0xF5, 0xAC, 0x97, 0x09, 0xEA,
+    0x5A, 0xC9, 0x70, 0x9E, 0xA5, 0xAC, 0x97, 0x09, 0xEA, 0x5A, 0xCA, 0x99, 0x69, 0xEA, 0x5F, 0xFD,
+    0xA9, 0x9F, 0x5F, 0xFE, 0xA0, 0xF5, 0xD2, 0x9A, 0xFC, 0x0F, 0x94, 0xD4, 0xE9, 0x90, 0xFC, 0x4D,
+    0x4E, 0x2A, 0xFC, 0x3D, 0x39, 0xE2, 0x9F, 0xEA, 0x9D, 0x99, 0xAA, 0xF3, 0xFF, 0xFF, 0xE3, 0x9F,
+    0xFF, 0xFD, 0x49, 0xFF, 0xFF, 0xC5, 0x9F, 0xFF, 0xDA, 0x71, 0xAA, 0xFD, 0xAA, 0x97, 0x7D, 0x77,
+    0x4D, 0x77, 0x4D, 0x77, 0x4A, 0xA7, 0x10, 0x69, 0x99, 0x9A, 0x99, 0x77, 0x9F, 0xFE, 0x97, 0x5F,
+    0xFF, 0xA7, 0x4F, 0xFF, 0xCA, 0x73, 0x99, 0x49, 0xAF, 0xC7, 0x75, 0xF9, 0x77, 0x5E, 0xA7, 0x75,
+    0xAD, 0xA7, 0x75, 0xAE, 0x77, 0x5E, 0xA5, 0xAF, 0xFF, 0xFF, 0xF9, 0xAF, 0xFF, 0xFF, 0xF9, 0xAF,
+    0xFF, 0xFF, 0xF9, 0x77, 0x77, 0x77, 0x3A, 0xFF, 0xFF, 0xFF, 0x9A, 0xFF, 0xFF, 0xFF, 0x9A, 0xFF,
+    0xFF, 0xFF, 0x99, 0xFD, 0x77, 0x29, 0xFD, 0xA7, 0x19, 0x7F, 0xFA, 0xAA, 0xAA, 0xAF, 0x96, 0xFF,
+    0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xDA, 0x79, 0xFF, 0xFF, 0xA7, 0x2A, 0xAF, 0xFC, 0xAA,
+    0x77, 0x77, 0x69, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x19, 0xFD, 0x49, 0xFF, 0x4F, 0xDA, 0xAC, 0x3A,
+    0xE0, 0xAC, 0x95, 0xE1, 0xAC, 0x94, 0x9E, 0x1A, 0xC9, 0x49, 0xDA, 0x1A, 0xC9, 0x49, 0xD9, 0x1A,
+    0xC9, 0x4A, 0xD9, 0x1A, 0xC9, 0x49, 0xDA, 0x19, 0xCA, 0x49, 0xE1, 0x9C, 0xA5, 0xF0, 0x9C, 0xA5,
+    0xAF, 0xEA, 0xA4, 0xFF, 0xD4, 0xFF, 0xCA, 0x49, 0xAF, 0xCA, 0x97, 0xD7, 0x72, 0x9A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xFF, 0xFF, 0xEA, 0x77, 0x77, 0x77, 0x76, 0x9A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF7,
+    0x0E, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xEA, 0x77, 0x9E,
+    0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7A,
+    0xF7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7F, 0xC7, 0x7F, 0xC7, 0xAF, 0xFF, 0x0A, 0xFF, 0xF5, 0xE7, 0x3D,
+    0x97, 0x29, 0xCA, 0x73, 0xD4, 0xAF, 0xFF, 0x99, 0xFF, 0xF9, 0x5A, 0xD7, 0x09, 0xE9, 0x4A, 0xFD,
+    0xA5, 0xAF, 0xC9, 0x6A, 0xFD, 0x95, 0x99, 0x99, 0xAE, 0x72, 0x9E, 0x72, 0xE7, 0x2E, 0xA7, 0x1F,
+    0x71, 0xF7, 0x1F, 0x97, 0x0F, 0xA7, 0x0F, 0xC2, 0x49, 0x74, 0x9D, 0x74, 0x9D, 0x97, 0x39, 0xD9,
+    0x2A, 0xA6, 0x9D, 0x99, 0xAD, 0xA6, 0x9F, 0xEA, 0x59, 0xFD, 0xA5, 0x9F, 0xD9, 0x7A, 0xFC, 0x93,
+    0x93, 0xAA, 0x99, 0xD9, 0x09, 0xAC, 0xA6, 0x9D, 0xAF, 0xA6, 0xAF, 0xDA, 0x5A, 0xFD, 0x96, 0xAF,
+    0xC9, 0x5D, 0xAA, 0xCA, 0xAD, 0x94, 0x9D, 0x09, 0x19, 0xD9, 0x3A, 0xDA, 0x39, 0xD9, 0x19, 0xEA,
+    0x49, 0xDA, 0xAF, 0xA5, 0x9F, 0xDA, 0x79, 0xEA, 0x97, 0x76, 0x77, 0x70, 0x9C, 0xA7, 0x69, 0xCA,
+    0x76, 0x9C, 0xA7, 0x69, 0xD7, 0x49, 0xFD, 0xA7, 0x0A, 0xFF, 0xA6, 0x9F, 0xFD, 0x95, 0xFA, 0xD0,
+    0xAE, 0x5E, 0x1D, 0x1E, 0x93, 0x9D, 0xA1, 0xD1, 0x9D, 0xA3, 0xAD, 0x2D, 0x2D, 0xA3, 0xAD, 0x2D,
+    0x2A, 0xCA, 0x3A, 0xD2, 0xD2, 0xAD, 0x3A, 0xCA, 0x2D, 0x2A, 0xD3, 0xAC, 0xA2, 0xD2, 0xAC, 0xA3,
+    0xAC, 0xA2, 0xD2, 0xAC, 0xA3, 0xAC, 0xA2, 0xD2, 0xAC, 0xA3, 0xAC, 0xA2, 0xD2, 0xAC, 0xA3, 0xAD,
+    0x2D, 0x2A, 0xCA, 0x39, 0xD2, 0xD2, 0xAC, 0xA3, 0x9D, 0x2D, 0x2D, 0xA3, 0x9D, 0x91, 0xD2, 0xDA,
+    0x10, 0x69, 0xFF, 0xCA, 0x73, 0x9F, 0xFE, 0xA7, 0x1A, 0xEA, 0xAA, 0xFE, 0x70, 0xAD, 0xA5, 0x9F,
+    0x7A, 0xDA, 0x7E, 0x7A, 0xDA, 0x7A, 0xD9, 0x6A, 0xDA, 0x7A, 0xDA, 0x6E, 0xA7, 0xE9, 0x6E, 0xA7,
+    0xE9, 0x6E, 0xA5, 0xAF, 0x2F, 0xFF, 0xFE, 0xA2, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC9, 0x4F, 0xFD,
+    0xAA, 0xAA, 0x97, 0x39, 0xF7, 0x72, 0xF7, 0x39, 0xFF, 0xFF, 0x59, 0xFF, 0xFF, 0x59, 0xFF, 0xFF,
+    0x73, 0x9F, 0x77, 0x1A, 0xF7, 0x71, 0xAF, 0x77, 0x1A, 0xF9, 0x77, 0x0A, 0xF9, 0x77, 0x0A, 0xF9,
+    0x72, 0x69, 0xA7, 0x7D, 0x97, 0x5D, 0xA7, 0x5E, 0x75, 0xE7, 0x5A, 0xD7, 0x5A, 0xD9, 0x74, 0x9D,
+    0xA7, 0x49, 0xFF, 0xFF, 0xA0, 0xFF, 0xFF, 0xA0, 0x9D, 0x97, 0x69, 0xD9, 0x76, 0xAD, 0x97, 0x6A,
+    0xD7, 0x7E, 0x77, 0xE7, 0x7C, 0xA7, 0x77, 0x20, 0x77, 0x71, 0xAC, 0x97, 0x5F, 0x97, 0x3F, 0xDA,
+    0x71, 0xFF, 0xA6, 0x9E, 0x0D, 0x99, 0xE4, 0x9D, 0xA1, 0xD9, 0x1E, 0x2A, 0xDA, 0x2D, 0x92, 0xE9,
+    0x9D, 0x93, 0xD9, 0x3D, 0x90, 0xA9, 0x4D, 0x94, 0x97, 0x0D, 0x97, 0x6D, 0x97, 0x6D, 0x97, 0x6D,
+    0x97, 0x6D, 0x97, 0x6D, 0x97, 0x6D, 0x97, 0x6D, 0x96, 0x70, 0xA9, 0x76, 0x9D, 0x97, 0x6A, 0xD7,
+    0x7E, 0x77, 0xE7, 0x7D, 0xA7, 0x69, 0xDA, 0x76, 0xAD, 0x90, 0xAF, 0xFF, 0xF9, 0xAF, 0xFF, 0xF9,
+    0x74, 0x9D, 0x97, 0x49, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xE7, 0x5E, 0x76, 0xAC, 0x77, 0x70,
+    0x7D, 0x97, 0x6D, 0x97, 0x6D, 0x97, 0x6D, 0x97, 0x6D, 0x97, 0x6D, 0x97, 0x6D, 0x97, 0x6D, 0x97,
+    0x99, 0x4D, 0x94, 0x90, 0x9D, 0x93, 0xD9, 0x3D, 0x90, 0xAD, 0xA2, 0xD9, 0x2E, 0x91, 0xAD, 0xA1,
+    0xD9, 0x1E, 0x49, 0xE0, 0xD9, 0x9E, 0x69, 0xFF, 0xA7, 0x1F, 0xDA, 0x73, 0xF9, 0x75, 0xAC, 0x97,
+    0x77, 0x00, 0x77, 0x73, 0xCA, 0x5A, 0xC7, 0x2D, 0xA5, 0xAC, 0xA7, 0x0A, 0xCA, 0x7A, 0xCA, 0x6A,
+    0xD7, 0x1D, 0x94, 0x9D, 0x73, 0xD9, 0x3D, 0x75, 0xD2, 0xFF, 0xFF, 0xF0, 0x9F, 0xFF, 0xFF, 0x90,
+    0xAD, 0x75, 0xD9, 0x2A, 0xCA, 0x73, 0xAC, 0xA4, 0xAC, 0xA7, 0x1A, 0xCA, 0x6D, 0x97, 0xAD, 0x70,
+    0xD9, 0x59, 0xD7, 0x2C, 0x69, 0xC7, 0x77, 0x30, 0x77, 0x5C, 0x97, 0x29, 0xEA, 0x70, 0x9F, 0xCA,
+    0x6A, 0xD9, 0xCA, 0xAD, 0x4D, 0xA1, 0xCA, 0x0A, 0xD2, 0xDA, 0x2C, 0xA1, 0x9D, 0x90, 0xC9, 0x3C,
+    0xA2, 0x9C, 0x96, 0xCA, 0x74, 0xCA, 0x74, 0xCA, 0x74, 0xCA, 0x74, 0xCA, 0x74, 0xCA, 0x6A, 0x4C,
+    0xA5, 0x9D, 0x3C, 0xA2, 0x9C, 0x90, 0xAD, 0x91, 0xCA, 0x19, 0xD9, 0x1A, 0xD9, 0x0C, 0xA0, 0xAD,
+    0x49, 0xDA, 0xCA, 0xAD, 0x69, 0xFC, 0xA7, 0x1E, 0xA7, 0x3C, 0x97, 0x74, 0x39, 0x99, 0x9A, 0xAA,
+    0xD2, 0xFF, 0xF2, 0xFC, 0xAA, 0xA9, 0x99, 0x3F, 0x97, 0x1F, 0xC9, 0x70, 0xD0, 0xE9, 0x69, 0xD1,
+    0xE9, 0x59, 0xD2, 0xE9, 0x49, 0xCA, 0x3E, 0x93, 0x9C, 0xA4, 0xE9, 0x2A, 0xCA, 0x5E, 0x91, 0xAC,
+    0xA6, 0xE9, 0x73, 0xE7, 0x4A, 0x10, 0x09, 0xDA, 0xAA, 0x99, 0x95, 0x9F, 0xFE, 0xA2, 0x99, 0x9A,
+    0xAA, 0xFC, 0xA7, 0x1A, 0xEA, 0x70, 0xAF, 0xA7, 0xAD, 0x99, 0xD6, 0xAD, 0x90, 0x9D, 0x5A, 0xD9,
+    0x2D, 0x4A, 0xD9, 0x3D, 0x3A, 0xD9, 0x4D, 0x2A, 0xD9, 0x5D, 0x1A, 0xD9, 0x6D, 0x09, 0xD9, 0x73,
+    0xA9, 0x73, 0x09, 0x97, 0x39, 0xD7, 0x4E, 0x7A, 0xA2, 0xE6, 0xD2, 0x9D, 0xA5, 0xD3, 0x9D, 0xA3,
+    0x9D, 0x4A, 0xD9, 0x2A, 0xCA, 0x5A, 0xD9, 0x1A, 0xC9, 0x6E, 0x1D, 0x97, 0xE0, 0xD7, 0x1F, 0xC7,
+    0x2F, 0x2A, 0xFF, 0xDA, 0x2F, 0xFE, 0xA7, 0x70, 0x73, 0xA7, 0x4A, 0xD0, 0x9A, 0x96, 0x9D, 0xA0,
+    0xAC, 0xA5, 0x9D, 0xA1, 0x9D, 0x5E, 0x3D, 0x4E, 0x4D, 0x3E, 0x5D, 0x2A, 0xD6, 0xD9, 0x0A, 0xD9,
+    0x6A, 0xCA, 0x9D, 0x97, 0x9F, 0xA7, 0x09, 0xEA, 0x72, 0xFF, 0xE9, 0x2F, 0xFE, 0x97, 0x70, 0x77,
+    0x73, 0xC7, 0x72, 0xAD, 0x77, 0x1D, 0xA7, 0x70, 0xE7, 0x70, 0xAD, 0x77, 0x09, 0xD9, 0x77, 0x0E,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xFD, 0xA0, 0xE7, 0x70, 0x9D, 0xA7, 0x72,
+    0xE7, 0x72, 0xFF, 0xFF, 0xCA, 0x29, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x49, 0xDA, 0x77,
+    0x1A, 0xDA, 0x77, 0x1E, 0x77, 0x19, 0xC7, 0x77, 0x71, 0x70, 0x97, 0x74, 0xCA, 0x2C, 0x77, 0xDA,
+    0x2D, 0x75, 0xEA, 0x2E, 0x73, 0xFA, 0x2F, 0x97, 0x0E, 0xAC, 0xA2, 0xCA, 0xAD, 0x96, 0xAD, 0xA0,
+    0xCA, 0x2C, 0xA0, 0xAD, 0x94, 0xAD, 0xA1, 0xCA, 0x2C, 0xA1, 0xAD, 0x92, 0xAD, 0xA2, 0xCA, 0x2C,
+    0xA2, 0xAD, 0x90, 0x9D, 0xA3, 0xCA, 0x2C, 0xA3, 0xAD, 0x1C, 0xA4, 0xCA, 0x2C, 0xA4, 0xA7, 0x1C,
+    0xA2, 0xCA, 0x77, 0xCA, 0x2C, 0xA7, 0x7C, 0xA2, 0xCA, 0x77, 0xCA, 0x2C, 0xA7, 0x7C, 0xA2, 0xCA,
+    0x77, 0xCA, 0x2C, 0xA7, 0x7C, 0xA2, 0xCA, 0x77, 0xCA, 0x2C, 0xA7, 0x7C, 0xA2, 0xCA, 0x77, 0xCA,
+    0x2C, 0xA7, 0x77, 0x77, 0x1C, 0x77, 0x2D, 0x97, 0x71, 0xE7, 0x72, 0xDA, 0x77, 0x2D, 0x97, 0x71,
+    0x9D, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE2, 0xAF, 0xFF, 0xFD, 0x77, 0x2E, 0x77,
+    0x1E, 0x77, 0x0E, 0x1A, 0xFF, 0xFF, 0xC2, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xE7, 0x70,
+    0xE9, 0x77, 0xAD, 0xA7, 0x70, 0xE7, 0x71, 0x9C, 0x77, 0x73, 0x7A, 0x92, 0xA9, 0x77, 0xCA, 0x2C,
+    0xA7, 0x7C, 0xA2, 0xCA, 0x77, 0xCA, 0x2C, 0xA7, 0x7C, 0xA2, 0xCA, 0x77, 0xCA, 0x2C, 0xA7, 0x7C,
+    0xA2, 0xCA, 0x77, 0xCA, 0x2C, 0xA7, 0x7C, 0xA2, 0xCA, 0x77, 0xCA, 0x2C, 0xA7, 0x0A, 0x94, 0xCA,
+    0x2C, 0xA4, 0x91, 0x9D, 0x93, 0xCA, 0x2C, 0xA3, 0x9C, 0xA1, 0xE9, 0x2C, 0xA2, 0xCA, 0x29, 0xE2,
+    0xE9, 0x1C, 0xA2, 0xCA, 0x19, 0xE4, 0xE9, 0x0C, 0xA2, 0xCA, 0x09, 0xDA, 0x6E, 0x0C, 0xA2, 0xCA,
+    0x0D, 0xA7, 0x9F, 0xA2, 0xFA, 0x71, 0x9E, 0xA2, 0xEA, 0x73, 0x9D, 0xA2, 0xDA, 0x75, 0x9C, 0xA2,
+    0xC9, 0x77, 0x9A, 0x29, 0x77, 0x77, 0x77, 0x76, 0xC7, 0xA9, 0x73, 0xAD, 0x5A, 0xD7, 0x3D, 0xA5,
+    0x9D, 0x97, 0x1E, 0x7A, 0xD7, 0x0A, 0xD7, 0x1E, 0x69, 0xD9, 0x72, 0xDA, 0x5E, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0xAD, 0x93, 0xFF, 0xFF, 0xF9, 0x1E, 0x77, 0xAD, 0x99, 0xDA, 0x77, 0x9D, 0xA1,
+    0xE7, 0x5A, 0xD9, 0x3F, 0xFF, 0xFD, 0x94, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0xEA, 0x69, 0xDA,
+    0x79, 0xDA, 0x70, 0xAD, 0xA5, 0x9E, 0x72, 0xE5, 0xAD, 0x97, 0x29, 0xC7, 0xCA, 0x77, 0x75, 0x79,
+    0x77, 0x1D, 0x77, 0xF7, 0x49, 0xDA, 0xE9, 0x71, 0x9E, 0x1E, 0x97, 0xAE, 0x2F, 0xA4, 0x9F, 0xC2,
+    0xC9, 0x9E, 0xA1, 0x9E, 0xAA, 0xC2, 0xC9, 0x1F, 0x2C, 0xA0, 0x9C, 0x2C, 0x92, 0xD6, 0x9C, 0x2C,
+    0x97, 0x39, 0xC2, 0xC9, 0x73, 0x9C, 0x2C, 0x97, 0x39, 0xC2, 0xC9, 0x73, 0x9C, 0x2C, 0x97, 0x39,
+    0xC2, 0xC9, 0x70, 0x91, 0x9C, 0x2C, 0x92, 0x99, 0x2E, 0x99, 0xC2, 0xC9, 0x1A, 0xDA, 0x1A, 0xFC,
+    0x2C, 0x90, 0xF9, 0x29, 0xF2, 0xCA, 0xE9, 0x6E, 0xA1, 0xF7, 0x1A, 0xD9, 0xAD, 0xA7, 0x3A, 0xF9,
+    0x75, 0xAD, 0x97, 0x7A, 0x97, 0x00, 0x71, 0xAC, 0xA9, 0x73, 0xFA, 0x74, 0xAD, 0x97, 0x4D, 0xA7,
+    0x4A, 0xD7, 0x49, 0xD7, 0x49, 0xCA, 0x74, 0x9C, 0xA7, 0x4A, 0xCA, 0x3F, 0xD2, 0xAC, 0x91, 0xAF,
+    0xF1, 0xD9, 0x09, 0xEA, 0x2A, 0xD0, 0xD1, 0xE9, 0x4A, 0xCA, 0xD0, 0x9D, 0xA6, 0xF0, 0x9D, 0x96,
+    0xAD, 0xA0, 0xAD, 0x96, 0x9D, 0x90, 0xAD, 0x96, 0x9D, 0x1A, 0xE6, 0xE2, 0xEA, 0x4A, 0xD9, 0x2A,
+    0xFF, 0xE4, 0xFF, 0xD9, 0x5F, 0xFA, 0x79, 0xFA, 0x50, 0x77, 0x72, 0x97, 0x29, 0xAF, 0xCA, 0x96,
+    0xAC, 0xA7, 0x9F, 0xFE, 0xA3, 0xAD, 0x96, 0xAF, 0xDA, 0xFE, 0x90, 0xE7, 0xFC, 0xA4, 0x9F, 0xF7,
+    0xAF, 0x97, 0xFD, 0x70, 0xF9, 0x71, 0xFA, 0x7A, 0xEA, 0x72, 0xFC, 0x7F, 0x72, 0xFD, 0x7F, 0x71,
+    0xE9, 0xE9, 0x59, 0xE9, 0x70, 0xDA, 0x1E, 0xA5, 0x9E, 0x79, 0xDA, 0x2E, 0xA5, 0x9E, 0x69, 0xDA,
+    0x3E, 0xA5, 0x9E, 0x59, 0xDA, 0x4A, 0xE5, 0x9E, 0x49, 0xDA, 0x5A, 0xDA, 0x59, 0xE9, 0x29, 0xD9,
+    0x6E, 0xA5, 0x9E, 0x91, 0xAD, 0x97, 0xEA, 0x6F, 0x0A, 0xD9, 0x7A, 0xE9, 0x6F, 0xE9, 0x7A, 0xF7,
+    0x9F, 0xD9, 0x92, 0x99, 0xAF, 0xD7, 0x0F, 0xFF, 0xFE, 0xA7, 0x0F, 0xFF, 0xFE, 0x70, 0xAF, 0xFF,
+    0xFD, 0xA7, 0xAD, 0x9F, 0xFF, 0xEA, 0x7A, 0xD2, 0xAF, 0xFF, 0x97, 0xAD, 0x59, 0xAF, 0xDA, 0x97,
+    0x19, 0xC7, 0x77, 0x77, 0x76, 0x77, 0x74, 0x9E, 0x97, 0x7F, 0xC7, 0x69, 0xFC, 0x76, 0xFD, 0xA7,
+    0x49, 0xE9, 0xE7, 0x4A, 0xE0, 0xEA, 0x73, 0xE9, 0x09, 0xE7, 0x2A, 0xE2, 0xEA, 0x71, 0xEA, 0x2A,
+    0xE7, 0x0A, 0xE4, 0xEA, 0x7E, 0xA4, 0xAE, 0x6A, 0xE9, 0x49, 0xEA, 0x5F, 0x6F, 0x49, 0xE9, 0x69,
+    0xEA, 0x3F, 0x70, 0xF2, 0x9E, 0xA7, 0x0A, 0xE9, 0x1F, 0x71, 0x9F, 0x09, 0xF7, 0x2F, 0x9A, 0xFF,
+    0xFF, 0xEA, 0xAF, 0xFF, 0xFE, 0xAA, 0xFF, 0xFF, 0xEA, 0x77, 0x1A, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF,
+    0x3D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D,
+    0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5,
+    0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA,
+    0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x20, 0x29, 0x99, 0x59, 0x99, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5,
+    0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA,
+    0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D,
+    0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5E, 0x49,
+    0xDA, 0x2A, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x00, 0xAF, 0xFF, 0x0A, 0xFF, 0xF0, 0x9C, 0xA7, 0x39,
+    0xCA, 0x73, 0x9C, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0x97, 0x3A, 0xC9, 0x73, 0xAC, 0x97, 0x3A, 0xC7,
+    0x4C, 0x73, 0xD7, 0x2D, 0x97, 0x1D, 0x97, 0x1D, 0xA7, 0x09, 0xDA, 0x70, 0x9D, 0xA7, 0x09, 0xE7,
+    0x1A, 0xFF, 0xF0, 0xAF, 0xFF, 0x0A, 0xFF, 0xF7, 0x60, 0x70, 0x99, 0x99, 0x1A, 0xFF, 0xE0, 0x9F,
+    0xFF, 0x76, 0x74, 0xFF, 0xD7, 0x39, 0xFE, 0xAA, 0x97, 0x3A, 0xD9, 0x77, 0x2E, 0x77, 0x29, 0xDA,
+    0x77, 0x2E, 0x77, 0x3E, 0x77, 0x29, 0xDA, 0x77, 0x2E, 0x97, 0x72, 0xE7, 0x72, 0xAE, 0x77, 0x2E,
+    0xA7, 0x71, 0x9E, 0x97, 0x71, 0xAE, 0x77, 0x2F, 0x77, 0x19, 0xEA, 0x73, 0xA4, 0xF7, 0x39, 0xD9,
+    0x2F, 0x74, 0xE9, 0x0A, 0xEA, 0x74, 0xAE, 0xAF, 0x97, 0x5F, 0xF7, 0x6A, 0xFE, 0x77, 0xFD, 0xA7,
+    0x7A, 0xFC, 0x97, 0x70, 0x99, 0x99, 0x97, 0x50, 0x49, 0xA9, 0x95, 0x9A, 0xA9, 0x6F, 0xE9, 0x19,
+    0xFD, 0x4F, 0xFC, 0x1F, 0xF2, 0xAD, 0xA9, 0x19, 0xDA, 0xAD, 0xA2, 0xD9, 0x1D, 0xA5, 0xF9, 0x4D,
+    0x09, 0xD6, 0x9E, 0x5A, 0xC0, 0xAC, 0xA7, 0xDA, 0x59, 0xC0, 0xAC, 0xA7, 0xDA, 0x59, 0xC9, 0xAC,
+    0xA7, 0xE5, 0xAC, 0x09, 0xD6, 0x9E, 0xA3, 0xAD, 0x09, 0xDA, 0x49, 0xFF, 0xF1, 0xFF, 0xDA, 0xAF,
+    0xF9, 0x19, 0xFF, 0xC9, 0x0F, 0xEA, 0x39, 0xFE, 0x92, 0xFC, 0xA6, 0x9A, 0xCA, 0xA6, 0x99, 0x40,
+    0x77, 0x09, 0xAE, 0xA7, 0x70, 0xFE, 0x77, 0xEA, 0x2A, 0x76, 0x9D, 0xA7, 0x73, 0xE7, 0x74, 0xE7,
+    0x73, 0x9D, 0xA7, 0x73, 0xAD, 0x97, 0x73, 0xE9, 0x77, 0x3E, 0x77, 0x4E, 0x77, 0x39, 0xE7, 0x73,
+    0x9D, 0xA7, 0x73, 0xAD, 0x97, 0x73, 0xAD, 0x97, 0x73, 0xE7, 0x74, 0xE7, 0x74, 0xE7, 0x73, 0x9E,
+    0x77, 0x39, 0xDA, 0x77, 0x3A, 0xDA, 0x77, 0x3E, 0x97, 0x73, 0xE7, 0x74, 0xE7, 0x73, 0x9E, 0x77,
+    0x3E, 0xA7, 0x49, 0xA3, 0xAE, 0x97, 0x29, 0xFF, 0xE7, 0x2A, 0xFF, 0xEA, 0x73, 0xFF, 0xE7, 0x5A,
+    0xFF, 0x97, 0x7A, 0xFA, 0x97, 0x77, 0x74, 0x0A, 0xE1, 0xF1, 0xF9, 0x9F, 0x99, 0xFA, 0x09, 0x99,
+    0x97, 0x77, 0x77, 0x3A, 0xE1, 0xF1, 0xF9, 0x9F, 0x9A, 0xFA, 0x77, 0x2A, 0xEA, 0x69, 0x91, 0xAD,
+    0xAA, 0xD9, 0x4D, 0x1D, 0xA2, 0xD9, 0x29, 0xD0, 0x9D, 0x92, 0x9D, 0x91, 0xDA, 0x0A, 0xD5, 0xFD,
+    0x97, 0x29, 0xAA, 0xA7, 0x76, 0x99, 0x97, 0x4F, 0xD5, 0xD1, 0xE1, 0xAD, 0x39, 0xD1, 0xD9, 0x2A,
+    0xD2, 0xAD, 0x09, 0xD9, 0x3A, 0xDA, 0xE9, 0x09, 0x9A, 0x59, 0xFA, 0x77, 0x20, 0x76, 0xAA, 0x77,
+    0x9C, 0xA7, 0x7D, 0x77, 0xAC, 0x97, 0x69, 0xD7, 0x7D, 0x97, 0x6A, 0xCA, 0x75, 0x99, 0xD9, 0x09,
+    0x92, 0xAF, 0xFF, 0xEA, 0x09, 0xFF, 0xFF, 0xC7, 0x1D, 0x97, 0x6A, 0xD7, 0x7D, 0x77, 0xDA, 0x76,
+    0x9F, 0xFD, 0x91, 0xFF, 0xFF, 0xC0, 0x9F, 0xE9, 0x99, 0x97, 0x3D, 0x77, 0xDA, 0x76, 0xAD, 0x77,
+    0xDA, 0x76, 0xE7, 0x69, 0xD9, 0x77, 0x77, 0x00, 0x77, 0x9A, 0x77, 0x09, 0xE7, 0x6A, 0xFC, 0x74,
+    0xAF, 0xC9, 0x72, 0x9F, 0xD9, 0x72, 0x9F, 0xD9, 0x72, 0xAF, 0xD9, 0x72, 0xAF, 0xCA, 0x74, 0xAF,
+    0xA7, 0x6A, 0xFA, 0x97, 0x59, 0xFF, 0xA9, 0x72, 0x9A, 0xFF, 0xCA, 0x97, 0x39, 0xFF, 0xDA, 0x97,
+    0x29, 0xAF, 0xFC, 0x74, 0x9A, 0xFD, 0x77, 0x09, 0xE7, 0x73, 0x93, 0x97, 0x72, 0x9F, 0xCA, 0xA9,
+    0x99, 0x71, 0xAF, 0xFF, 0xDA, 0xA9, 0x95, 0x99, 0x9A, 0xAF, 0xFD, 0x77, 0x99, 0x9A, 0xA9, 0x2C,
+    0x97, 0x72, 0xE9, 0x77, 0x0F, 0xCA, 0x77, 0x9F, 0xCA, 0x97, 0x69, 0xFD, 0x97, 0x69, 0xFD, 0x97,
+    0x7A, 0xFC, 0xA7, 0x7A, 0xFC, 0xA9, 0x76, 0xAF, 0xA7, 0x59, 0xAF, 0xA7, 0x19, 0xAF, 0xFA, 0x69,
+    0xAF, 0xFC, 0xA9, 0x39, 0xAF, 0xFD, 0x96, 0xFF, 0xCA, 0x97, 0x1F, 0xDA, 0x97, 0x4E, 0x97, 0x70,
+    0x97, 0x77, 0x73, 0x97, 0x39, 0x9A, 0xAF, 0xCA, 0x29, 0xAA, 0xFF, 0xFE, 0x1F, 0xFD, 0xAA, 0x99,
+    0x94, 0x9A, 0xA9, 0x99, 0x76,
 };
 
 static const EpdGlyph opendyslexic_14_regularGlyphs[] = {
     { 0, 0, 25, 0, 0, 0, 0 }, //  
-    { 7, 29, 10, 1, 29, 51, 0 }, // !
-    { 14, 9, 16, 1, 25, 32, 51 }, // "
-    { 29, 25, 33, 2, 23, 182, 83 }, // #
-    { 25, 31, 35, 5, 27, 194, 265 }, // $
-    { 19, 25, 29, 6, 23, 119, 459 }, // %
-    { 22, 26, 28, 3, 25, 143, 578 }, // &
-    { 6, 9, 8, 1, 22, 14, 721 }, // '
-    { 10, 39, 13, 2, 29, 98, 735 }, // (
-    { 9, 39, 13, 1, 29, 88, 833 }, // )
-    { 15, 14, 19, 2, 22, 53, 921 }, // *
-    { 14, 14, 18, 2, 15, 49, 974 }, // +
-    { 8, 10, 10, 1, 5, 20, 1023 }, // ,
-    { 14, 3, 18, 2, 10, 11, 1043 }, // -
-    { 6, 5, 8, 1, 5, 8, 1054 }, // .
-    { 17, 45, 18, 0, 32, 192, 1062 }, // /
-    { 16, 22, 19, 2, 22, 88, 1254 }, // 0
-    { 13, 22, 17, 2, 22, 72, 1342 }, // 1
-    { 15, 22, 19, 2, 22, 83, 1414 }, // 2
-    { 15, 22, 19, 2, 22, 83, 1497 }, // 3
-    { 16, 22, 19, 2, 22, 88, 1580 }, // 4
-    { 15, 23, 18, 2, 23, 87, 1668 }, // 5
-    { 16, 22, 19, 2, 22, 88, 1755 }, // 6
-    { 14, 22, 18, 2, 22, 77, 1843 }, // 7
-    { 17, 22, 20, 1, 22, 94, 1920 }, // 8
-    { 15, 22, 19, 2, 22, 83, 2014 }, // 9
-    { 6, 18, 8, 1, 18, 27, 2097 }, // :
-    { 8, 22, 10, 1, 17, 44, 2124 }, // ;
-    { 20, 17, 23, 2, 18, 85, 2168 }, // <
-    { 14, 10, 18, 2, 13, 35, 2253 }, // =
-    { 20, 17, 23, 2, 18, 85, 2288 }, // >
-    { 16, 33, 17, 0, 33, 132, 2373 }, // ?
-    { 26, 25, 35, 3, 23, 163, 2505 }, // @
-    { 23, 25, 33, 5, 25, 144, 2668 }, // A
-    { 19, 25, 28, 5, 25, 119, 2812 }, // B
-    { 20, 27, 29, 4, 26, 135, 2931 }, // C
-    { 23, 25, 32, 5, 25, 144, 3066 }, // D
-    { 17, 25, 27, 5, 25, 107, 3210 }, // E
-    { 15, 25, 25, 5, 25, 94, 3317 }, // F
-    { 23, 26, 33, 5, 26, 150, 3411 }, // G
-    { 21, 25, 31, 5, 25, 132, 3561 }, // H
-    { 6, 25, 13, 4, 25, 38, 3693 }, // I
-    { 12, 33, 22, 5, 26, 99, 3731 }, // J
-    { 20, 25, 30, 5, 25, 125, 3830 }, // K
-    { 16, 25, 27, 5, 25, 100, 3955 }, // L
-    { 26, 25, 36, 5, 25, 163, 4055 }, // M
-    { 21, 25, 31, 5, 25, 132, 4218 }, // N
-    { 23, 26, 33, 5, 25, 150, 4350 }, // O
-    { 17, 25, 27, 5, 25, 107, 4500 }, // P
-    { 25, 29, 30, 2, 25, 182, 4607 }, // Q
-    { 18, 25, 28, 5, 25, 113, 4789 }, // R
-    { 23, 27, 33, 5, 26, 156, 4902 }, // S
-    { 21, 25, 31, 5, 25, 132, 5058 }, // T
-    { 21, 26, 31, 5, 25, 137, 5190 }, // U
-    { 24, 25, 34, 5, 25, 150, 5327 }, // V
-    { 31, 25, 42, 5, 25, 194, 5477 }, // W
-    { 23, 25, 33, 5, 25, 144, 5671 }, // X
-    { 21, 25, 31, 5, 25, 132, 5815 }, // Y
-    { 23, 25, 33, 5, 25, 144, 5947 }, // Z
-    { 10, 41, 14, 2, 31, 103, 6091 }, // [
-    { 10, 28, 14, 2, 23, 70, 6194 }, // <backslash>
-    { 10, 41, 14, 2, 31, 103, 6264 }, // ]
-    { 12, 6, 16, 2, 27, 18, 6367 }, // ^
-    { 19, 4, 23, 2, -2, 19, 6385 }, // _
-    { 10, 5, 12, 1, 22, 13, 6404 }, // `
-    { 17, 17, 24, 3, 17, 73, 6417 }, // a
-    { 17, 26, 25, 4, 25, 111, 6490 }, // b
-    { 14, 18, 22, 4, 17, 63, 6601 }, // c
-    { 17, 26, 25, 4, 25, 111, 6664 }, // d
-    { 16, 17, 24, 4, 17, 68, 6775 }, // e
-    { 10, 24, 18, 4, 24, 60, 6843 }, // f
-    { 16, 23, 23, 4, 16, 92, 6903 }, // g
-    { 16, 25, 24, 4, 25, 100, 6995 }, // h
-    { 6, 26, 13, 4, 26, 39, 7095 }, // i
-    { 12, 33, 19, 4, 25, 99, 7134 }, // j
-    { 16, 24, 24, 4, 24, 96, 7233 }, // k
-    { 9, 24, 16, 3, 24, 54, 7329 }, // l
-    { 26, 16, 34, 4, 16, 104, 7383 }, // m
-    { 16, 17, 24, 4, 17, 68, 7487 }, // n
-    { 16, 16, 24, 4, 16, 64, 7555 }, // o
-    { 18, 24, 24, 2, 16, 108, 7619 }, // p
-    { 20, 25, 28, 4, 18, 125, 7727 }, // q
-    { 11, 16, 19, 4, 16, 44, 7852 }, // r
-    { 15, 16, 23, 4, 16, 60, 7896 }, // s
-    { 13, 22, 21, 4, 22, 72, 7956 }, // t
-    { 15, 17, 23, 4, 16, 64, 8028 }, // u
-    { 18, 16, 26, 4, 16, 72, 8092 }, // v
-    { 22, 16, 30, 4, 16, 88, 8164 }, // w
-    { 18, 16, 26, 4, 16, 72, 8252 }, // x
-    { 16, 24, 24, 4, 16, 96, 8324 }, // y
-    { 16, 16, 24, 4, 16, 64, 8420 }, // z
-    { 13, 27, 16, 2, 22, 88, 8484 }, // {
-    { 4, 25, 7, 2, 21, 25, 8572 }, // |
-    { 13, 27, 16, 2, 22, 88, 8597 }, // }
-    { 11, 6, 14, 1, 22, 17, 8685 }, // ~
-    { 0, 0, 25, 0, 0, 0, 8702 }, //  
-    { 7, 29, 10, 1, 22, 51, 8702 }, // ¡
-    { 14, 25, 22, 4, 22, 88, 8753 }, // ¢
-    { 18, 28, 20, 1, 28, 126, 8841 }, // £
-    { 16, 15, 20, 2, 18, 60, 8967 }, // ¤
-    { 18, 24, 22, 2, 22, 108, 9027 }, // ¥
-    { 4, 25, 7, 2, 21, 25, 9135 }, // ¦
-    { 16, 26, 24, 4, 23, 104, 9160 }, // §
-    { 14, 5, 16, 1, 23, 18, 9264 }, // ¨
-    { 12, 11, 16, 2, 26, 33, 9282 }, // ©
-    { 10, 10, 13, 2, 22, 25, 9315 }, // ª
-    { 15, 14, 19, 2, 14, 53, 9340 }, // «
-    { 14, 9, 18, 2, 10, 32, 9393 }, // ¬
-    { 14, 3, 17, 2, 10, 11, 9425 }, // ­
-    { 12, 11, 16, 2, 31, 33, 9436 }, // ®
-    { 11, 3, 15, 2, 21, 9, 9469 }, // ¯
-    { 14, 14, 16, 1, 23, 49, 9478 }, // °
-    { 14, 17, 18, 2, 16, 60, 9527 }, // ±
-    { 7, 11, 9, 1, 24, 20, 9587 }, // ²
-    { 8, 11, 10, 1, 23, 22, 9607 }, // ³
-    { 6, 6, 8, 1, 23, 9, 9629 }, // ´
-    { 16, 19, 23, 3, 16, 76, 9638 }, // µ
-    { 14, 24, 18, 2, 21, 84, 9714 }, // ¶
-    { 6, 5, 8, 1, 12, 8, 9798 }, // ·
-    { 6, 8, 10, 2, 1, 12, 9806 }, // ¸
-    { 7, 11, 9, 1, 24, 20, 9818 }, // ¹
-    { 9, 9, 13, 3, 21, 21, 9838 }, // º
-    { 15, 14, 19, 2, 14, 53, 9859 }, // »
-    { 24, 28, 32, 5, 26, 168, 9912 }, // ¼
-    { 25, 27, 32, 5, 25, 169, 10080 }, // ½
-    { 26, 27, 32, 3, 25, 176, 10249 }, // ¾
-    { 16, 32, 17, 0, 17, 128, 10425 }, // ¿
-    { 23, 33, 33, 5, 33, 190, 10553 }, // À
-    { 23, 38, 33, 5, 38, 219, 10743 }, // Á
-    { 23, 34, 33, 5, 34, 196, 10962 }, // Â
-    { 23, 33, 33, 5, 33, 190, 11158 }, // Ã
-    { 23, 33, 33, 5, 33, 190, 11348 }, // Ä
-    { 23, 35, 33, 5, 35, 202, 11538 }, // Å
-    { 32, 26, 42, 5, 25, 208, 11740 }, // Æ
-    { 20, 33, 29, 4, 26, 165, 11948 }, // Ç
-    { 17, 32, 27, 5, 32, 136, 12113 }, // È
-    { 17, 38, 27, 5, 38, 162, 12249 }, // É
-    { 17, 33, 27, 5, 33, 141, 12411 }, // Ê
-    { 17, 33, 27, 5, 33, 141, 12552 }, // Ë
-    { 10, 35, 13, 0, 35, 88, 12693 }, // Ì
-    { 6, 40, 13, 4, 40, 60, 12781 }, // Í
-    { 12, 36, 13, 0, 36, 108, 12841 }, // Î
-    { 14, 35, 14, -1, 35, 123, 12949 }, // Ï
-    { 27, 25, 32, 1, 25, 169, 13072 }, // Ð
-    { 21, 32, 31, 5, 32, 168, 13241 }, // Ñ
-    { 23, 33, 33, 5, 32, 190, 13409 }, // Ò
-    { 23, 38, 33, 5, 37, 219, 13599 }, // Ó
-    { 23, 34, 33, 5, 33, 196, 13818 }, // Ô
-    { 23, 33, 33, 5, 32, 190, 14014 }, // Õ
-    { 23, 33, 33, 5, 32, 190, 14204 }, // Ö
-    { 13, 8, 17, 2, 11, 26, 14394 }, // ×
-    { 36, 52, 36, -1, 38, 468, 14420 }, // Ø
-    { 21, 35, 31, 5, 34, 184, 14888 }, // Ù
-    { 21, 39, 31, 5, 38, 205, 15072 }, // Ú
-    { 21, 35, 31, 5, 34, 184, 15277 }, // Û
-    { 21, 35, 31, 5, 34, 184, 15461 }, // Ü
-    { 21, 39, 31, 5, 39, 205, 15645 }, // Ý
-    { 14, 23, 16, 1, 23, 81, 15850 }, // Þ
-    { 16, 23, 20, 2, 23, 92, 15931 }, // ß
-    { 17, 23, 24, 3, 23, 98, 16023 }, // à
-    { 17, 28, 24, 3, 28, 119, 16121 }, // á
-    { 17, 24, 24, 3, 24, 102, 16240 }, // â
-    { 17, 23, 24, 3, 23, 98, 16342 }, // ã
-    { 17, 23, 24, 3, 23, 98, 16440 }, // ä
-    { 17, 25, 24, 3, 25, 107, 16538 }, // å
-    { 29, 17, 36, 3, 17, 124, 16645 }, // æ
-    { 14, 24, 22, 4, 17, 84, 16769 }, // ç
-    { 16, 27, 24, 4, 27, 108, 16853 }, // è
-    { 16, 32, 24, 4, 32, 128, 16961 }, // é
-    { 16, 28, 24, 4, 28, 112, 17089 }, // ê
-    { 16, 27, 24, 4, 27, 108, 17201 }, // ë
-    { 10, 24, 13, 0, 24, 60, 17309 }, // ì
-    { 6, 29, 13, 4, 29, 44, 17369 }, // í
-    { 13, 25, 14, 0, 25, 82, 17413 }, // î
-    { 14, 25, 14, -1, 25, 88, 17495 }, // ï
-    { 22, 23, 25, 2, 23, 127, 17583 }, // ð
-    { 16, 25, 24, 4, 25, 100, 17710 }, // ñ
-    { 16, 26, 24, 4, 26, 104, 17810 }, // ò
-    { 16, 31, 24, 4, 31, 124, 17914 }, // ó
-    { 16, 27, 24, 4, 27, 108, 18038 }, // ô
-    { 16, 26, 24, 4, 26, 104, 18146 }, // õ
-    { 16, 26, 24, 4, 26, 104, 18250 }, // ö
-    { 18, 18, 22, 2, 18, 81, 18354 }, // ÷
-    { 17, 45, 24, 3, 30, 192, 18435 }, // ø
-    { 15, 25, 23, 4, 24, 94, 18627 }, // ù
-    { 15, 30, 23, 4, 29, 113, 18721 }, // ú
-    { 15, 26, 23, 4, 25, 98, 18834 }, // û
-    { 15, 25, 23, 4, 24, 94, 18932 }, // ü
-    { 16, 39, 24, 4, 31, 156, 19026 }, // ý
-    { 13, 30, 16, 2, 24, 98, 19182 }, // þ
-    { 16, 35, 24, 4, 27, 140, 19280 }, // ÿ
-    { 23, 32, 33, 5, 32, 184, 19420 }, // Ā
-    { 17, 22, 24, 3, 22, 94, 19604 }, // ā
-    { 23, 36, 33, 5, 36, 207, 19698 }, // Ă
-    { 17, 25, 24, 3, 25, 107, 19905 }, // ă
-    { 23, 32, 33, 5, 25, 184, 20012 }, // Ą
-    { 17, 22, 24, 3, 17, 94, 20196 }, // ą
-    { 20, 39, 29, 4, 38, 195, 20290 }, // Ć
-    { 14, 28, 22, 4, 27, 98, 20485 }, // ć
-    { 20, 37, 29, 4, 36, 185, 20583 }, // Ĉ
-    { 14, 25, 22, 4, 24, 88, 20768 }, // ĉ
-    { 20, 37, 29, 4, 36, 185, 20856 }, // Ċ
-    { 14, 26, 22, 4, 25, 91, 21041 }, // ċ
-    { 20, 39, 29, 4, 38, 195, 21132 }, // Č
-    { 14, 27, 22, 4, 26, 95, 21327 }, // č
-    { 23, 36, 32, 5, 36, 207, 21422 }, // Ď
-    { 22, 26, 27, 4, 25, 143, 21629 }, // ď
-    { 27, 25, 32, 1, 25, 169, 21772 }, // Đ
-    { 21, 26, 26, 4, 25, 137, 21941 }, // đ
-    { 17, 32, 27, 5, 32, 136, 22078 }, // Ē
-    { 16, 26, 24, 4, 26, 104, 22214 }, // ē
-    { 17, 35, 27, 5, 35, 149, 22318 }, // Ĕ
-    { 16, 30, 24, 4, 30, 120, 22467 }, // ĕ
-    { 17, 34, 27, 5, 34, 145, 22587 }, // Ė
-    { 16, 28, 24, 4, 28, 112, 22732 }, // ė
-    { 17, 31, 27, 5, 25, 132, 22844 }, // Ę
-    { 16, 24, 24, 4, 17, 96, 22976 }, // ę
-    { 17, 35, 27, 5, 35, 149, 23072 }, // Ě
-    { 16, 30, 24, 4, 30, 120, 23221 }, // ě
-    { 23, 34, 33, 5, 34, 196, 23341 }, // Ĝ
-    { 16, 32, 23, 4, 25, 128, 23537 }, // ĝ
-    { 23, 36, 33, 5, 36, 207, 23665 }, // Ğ
-    { 16, 33, 23, 4, 26, 132, 23872 }, // ğ
-    { 23, 34, 33, 5, 34, 196, 24004 }, // Ġ
-    { 16, 32, 23, 4, 25, 128, 24200 }, // ġ
-    { 23, 39, 33, 5, 26, 225, 24328 }, // Ģ
-    { 16, 34, 23, 4, 27, 136, 24553 }, // ģ
-    { 21, 33, 31, 5, 33, 174, 24689 }, // Ĥ
-    { 19, 31, 24, 1, 31, 148, 24863 }, // ĥ
-    { 24, 24, 31, 3, 24, 144, 25011 }, // Ħ
-    { 19, 25, 24, 1, 25, 119, 25155 }, // ħ
-    { 11, 36, 13, 1, 36, 99, 25274 }, // Ĩ
-    { 11, 25, 13, 1, 25, 69, 25373 }, // ĩ
-    { 14, 34, 14, -1, 34, 119, 25442 }, // Ī
-    { 14, 23, 15, 0, 23, 81, 25561 }, // ī
-    { 7, 31, 18, 7, 25, 55, 25642 }, // Į
-    { 7, 32, 13, 3, 26, 56, 25697 }, // į
-    { 7, 36, 13, 3, 36, 63, 25753 }, // İ
-    { 5, 17, 13, 4, 17, 22, 25816 }, // ı
-    { 18, 32, 27, 4, 25, 144, 25838 }, // Ĳ
-    { 22, 34, 27, 4, 26, 187, 25982 }, // ĳ
-    { 13, 39, 22, 5, 32, 127, 26169 }, // Ĵ
-    { 15, 32, 20, 4, 24, 120, 26296 }, // ĵ
-    { 20, 35, 30, 5, 25, 175, 26416 }, // Ķ
-    { 16, 37, 24, 4, 24, 148, 26591 }, // ķ
-    { 13, 16, 19, 3, 16, 52, 26739 }, // ĸ
-    { 16, 35, 27, 5, 35, 140, 26791 }, // Ĺ
-    { 9, 34, 16, 3, 34, 77, 26931 }, // ĺ
-    { 16, 38, 27, 5, 25, 152, 27008 }, // Ļ
-    { 9, 36, 16, 3, 24, 81, 27160 }, // ļ
-    { 16, 25, 27, 5, 25, 100, 27241 }, // Ľ
-    { 12, 25, 16, 3, 25, 75, 27341 }, // ľ
-    { 16, 25, 27, 5, 25, 100, 27416 }, // Ŀ
-    { 13, 24, 17, 3, 24, 78, 27516 }, // ŀ
-    { 28, 41, 27, -7, 32, 287, 27594 }, // Ł
-    { 19, 24, 16, -6, 24, 114, 27881 }, // ł
-    { 21, 35, 31, 5, 35, 184, 27995 }, // Ń
-    { 16, 28, 24, 4, 28, 112, 28179 }, // ń
-    { 21, 35, 31, 5, 25, 184, 28291 }, // Ņ
-    { 16, 27, 24, 4, 17, 108, 28475 }, // ņ
-    { 21, 35, 31, 5, 35, 184, 28583 }, // Ň
-    { 16, 28, 24, 4, 28, 112, 28767 }, // ň
-    { 16, 30, 20, 2, 30, 120, 28879 }, // ŉ
-    { 21, 30, 31, 5, 25, 158, 28999 }, // Ŋ
-    { 16, 23, 24, 4, 17, 92, 29157 }, // ŋ
-    { 23, 32, 33, 5, 31, 184, 29249 }, // Ō
-    { 16, 25, 24, 4, 25, 100, 29433 }, // ō
-    { 23, 36, 33, 5, 35, 207, 29533 }, // Ŏ
-    { 16, 29, 24, 4, 29, 116, 29740 }, // ŏ
-    { 24, 34, 33, 5, 33, 204, 29856 }, // Ő
-    { 22, 27, 25, 2, 27, 149, 30060 }, // ő
-    { 33, 25, 39, 5, 25, 207, 30209 }, // Œ
-    { 28, 17, 33, 4, 17, 119, 30416 }, // œ
-    { 18, 34, 28, 5, 34, 153, 30535 }, // Ŕ
-    { 11, 25, 19, 4, 25, 69, 30688 }, // ŕ
-    { 18, 39, 28, 5, 25, 176, 30757 }, // Ŗ
-    { 12, 31, 19, 3, 16, 93, 30933 }, // ŗ
-    { 18, 34, 28, 5, 34, 153, 31026 }, // Ř
-    { 13, 25, 19, 2, 25, 82, 31179 }, // ř
-    { 23, 38, 33, 5, 37, 219, 31261 }, // Ś
-    { 15, 26, 23, 4, 26, 98, 31480 }, // ś
-    { 23, 36, 33, 5, 35, 207, 31578 }, // Ŝ
-    { 15, 24, 23, 4, 24, 90, 31785 }, // ŝ
-    { 23, 33, 33, 5, 26, 190, 31875 }, // Ş
-    { 15, 24, 23, 4, 16, 90, 32065 }, // ş
-    { 23, 38, 33, 5, 37, 219, 32155 }, // Š
-    { 15, 26, 23, 4, 26, 98, 32374 }, // š
-    { 21, 31, 31, 5, 25, 163, 32472 }, // Ţ
-    { 13, 28, 21, 4, 22, 91, 32635 }, // ţ
-    { 21, 35, 31, 5, 35, 184, 32726 }, // Ť
-    { 14, 25, 21, 4, 25, 88, 32910 }, // ť
-    { 21, 25, 31, 5, 25, 132, 32998 }, // Ŧ
-    { 14, 22, 21, 3, 22, 77, 33130 }, // ŧ
-    { 21, 36, 31, 5, 35, 189, 33207 }, // Ũ
-    { 15, 26, 23, 4, 25, 98, 33396 }, // ũ
-    { 21, 34, 31, 5, 33, 179, 33494 }, // Ū
-    { 15, 24, 23, 4, 23, 90, 33673 }, // ū
-    { 21, 37, 31, 5, 36, 195, 33763 }, // Ŭ
-    { 15, 27, 23, 4, 26, 102, 33958 }, // ŭ
-    { 21, 38, 31, 5, 37, 200, 34060 }, // Ů
-    { 15, 28, 23, 4, 27, 105, 34260 }, // ů
-    { 22, 36, 31, 5, 35, 198, 34365 }, // Ű
-    { 22, 26, 24, 1, 25, 143, 34563 }, // ű
-    { 21, 31, 31, 5, 25, 163, 34706 }, // Ų
-    { 15, 23, 23, 4, 16, 87, 34869 }, // ų
-    { 31, 34, 42, 5, 34, 264, 34956 }, // Ŵ
-    { 22, 26, 30, 4, 26, 143, 35220 }, // ŵ
-    { 21, 35, 31, 5, 35, 184, 35363 }, // Ŷ
-    { 16, 35, 24, 4, 27, 140, 35547 }, // ŷ
-    { 21, 34, 31, 5, 34, 179, 35687 }, // Ÿ
-    { 23, 35, 33, 5, 35, 202, 35866 }, // Ź
-    { 16, 27, 24, 4, 27, 108, 36068 }, // ź
-    { 23, 33, 33, 5, 33, 190, 36176 }, // Ż
-    { 16, 25, 24, 4, 25, 100, 36366 }, // ż
-    { 23, 35, 33, 5, 35, 202, 36466 }, // Ž
-    { 16, 27, 24, 4, 27, 108, 36668 }, // ž
-    { 10, 24, 15, 4, 24, 60, 36776 }, // ſ
-    { 25, 28, 33, 5, 27, 175, 36836 }, // Ơ
-    { 18, 18, 24, 4, 18, 81, 37011 }, // ơ
-    { 20, 25, 27, 2, 25, 125, 37092 }, // Ƥ
-    { 18, 29, 24, 2, 21, 131, 37217 }, // ƥ
-    { 14, 22, 17, 2, 21, 77, 37348 }, // Ʃ
-    { 21, 25, 31, 5, 25, 132, 37425 }, // Ƭ
-    { 13, 25, 21, 4, 25, 82, 37557 }, // ƭ
-    { 21, 31, 31, 5, 25, 163, 37639 }, // Ʈ
-    { 23, 30, 31, 5, 29, 173, 37802 }, // Ư
-    { 18, 19, 23, 4, 18, 86, 37975 }, // ư
-    { 10, 5, 12, 1, 22, 13, 38061 }, // ̀
-    { 6, 6, 8, 1, 23, 9, 38074 }, // ́
-    { 12, 6, 15, 2, 0, 18, 38083 }, // ̂
-    { 11, 6, 13, 1, 22, 17, 38101 }, // ̃
-    { 14, 4, 17, 2, 20, 14, 38118 }, // ̄
-    { 19, 4, 22, 2, 26, 19, 38132 }, // ̅
-    { 12, 6, 15, 2, 21, 18, 38151 }, // ̆
-    { 6, 5, 8, 1, 22, 8, 38169 }, // ̇
-    { 14, 5, 16, 1, 23, 18, 38177 }, // ̈
-    { 7, 6, 8, 0, 19, 11, 38195 }, // ̉
-    { 7, 6, 9, 1, 22, 11, 38206 }, // ̊
-    { 22, 5, 24, 1, 22, 28, 38217 }, // ̋
-    { 12, 6, 15, 2, 22, 18, 38245 }, // ̌
-    { 22, 5, 17, -6, 24, 28, 38263 }, // ̏
-    { 7, 9, 9, 1, 22, 16, 38291 }, // ̒
-    { 8, 9, 10, 1, 22, 18, 38307 }, // ̓
-    { 7, 9, 9, 1, 22, 16, 38325 }, // ̔
-    { 5, 7, 8, 2, -1, 9, 38341 }, // ̘
-    { 5, 7, 8, 2, -1, 9, 38350 }, // ̙
-    { 12, 7, 15, 2, 23, 21, 38359 }, // ̚
-    { 4, 6, 7, 2, 18, 6, 38380 }, // ̛
-    { 3, 6, 6, 2, -2, 5, 38386 }, // ̜
-    { 7, 5, 10, 2, 3, 9, 38391 }, // ̝
-    { 7, 5, 10, 2, -1, 9, 38400 }, // ̞
-    { 6, 7, 9, 2, -2, 11, 38409 }, // ̟
-    { 14, 4, 17, 2, -4, 14, 38420 }, // ̠
-    { 6, 5, 8, 1, 1, 8, 38434 }, // ̣
-    { 14, 5, 16, 1, -1, 18, 38442 }, // ̤
-    { 7, 6, 9, 1, 22, 11, 38460 }, // ̥
-    { 8, 10, 10, 1, 5, 20, 38471 }, // ̦
-    { 6, 8, 9, 2, 1, 12, 38491 }, // ̧
-    { 6, 8, 9, 2, 1, 12, 38503 }, // ̨
-    { 4, 8, 7, 2, -2, 8, 38515 }, // ̩
-    { 9, 5, 12, 2, -1, 12, 38523 }, // ̪
-    { 12, 6, 15, 2, 0, 18, 38535 }, // ̬
-    { 13, 6, 15, 1, -1, 20, 38553 }, // ̭
-    { 11, 6, 13, 1, 22, 17, 38573 }, // ̰
-    { 11, 3, 14, 2, 21, 9, 38590 }, // ̱
-    { 12, 4, 15, 2, -2, 12, 38599 }, // ̲
-    { 11, 6, 13, 1, 22, 17, 38611 }, // ̴
-    { 14, 3, 17, 2, 10, 11, 38628 }, // ̵
-    { 3, 6, 6, 2, -2, 5, 38639 }, // ̹
-    { 9, 5, 12, 2, -1, 12, 38644 }, // ̺
-    { 9, 8, 12, 2, 0, 18, 38656 }, // ̻
-    { 9, 6, 12, 2, 0, 14, 38674 }, // ̼
-    { 7, 6, 11, 3, 22, 11, 38688 }, // ̽
-    { 11, 6, 13, 1, 22, 17, 38699 }, // ͂
-    { 4, 5, 7, 2, 24, 5, 38716 }, // ̓
-    { 14, 13, 16, 1, 31, 46, 38721 }, // ̈́
-    { 9, 5, 12, 2, 23, 12, 38767 }, // ͆
-    { 14, 11, 17, 2, 0, 39, 38779 }, // ͇
-    { 11, 8, 14, 2, 0, 22, 38818 }, // ͈
-    { 9, 7, 12, 2, -2, 16, 38840 }, // ͉
-    { 11, 16, 13, 1, 27, 44, 38856 }, // ͊
-    { 24, 13, 26, 1, 26, 78, 38900 }, // ͋
-    { 17, 15, 21, 3, 16, 64, 38978 }, // ͌
-    { 15, 7, 18, 2, -3, 27, 39042 }, // ͍
-    { 4, 4, 7, 2, 3, 4, 39069 }, // ͎
-    { 24, 6, 27, 2, 0, 36, 39073 }, // ͜
-    { 24, 6, 27, 2, 23, 36, 39109 }, // ͡
-    { 28, 7, 31, 2, -2, 49, 39145 }, // ͢
-    { 23, 25, 33, 5, 25, 144, 39194 }, // Α
-    { 19, 25, 28, 5, 25, 119, 39338 }, // Β
-    { 13, 24, 17, 2, 22, 78, 39457 }, // Γ
-    { 21, 22, 25, 2, 22, 116, 39535 }, // Δ
-    { 17, 25, 27, 5, 25, 107, 39651 }, // Ε
-    { 23, 25, 33, 5, 25, 144, 39758 }, // Ζ
-    { 21, 25, 31, 5, 25, 132, 39902 }, // Η
-    { 23, 26, 33, 5, 25, 150, 40034 }, // Θ
-    { 6, 25, 13, 4, 25, 38, 40184 }, // Ι
-    { 20, 25, 30, 5, 25, 125, 40222 }, // Κ
-    { 24, 25, 34, 5, 25, 150, 40347 }, // Λ
-    { 26, 25, 36, 5, 25, 163, 40497 }, // Μ
-    { 21, 25, 31, 5, 25, 132, 40660 }, // Ν
-    { 18, 21, 22, 2, 21, 95, 40792 }, // Ξ
-    { 23, 26, 33, 5, 25, 150, 40887 }, // Ο
-    { 14, 21, 18, 2, 21, 74, 41037 }, // Π
-    { 17, 25, 27, 5, 25, 107, 41111 }, // Ρ
-    { 14, 22, 17, 2, 21, 77, 41218 }, // Σ
-    { 21, 25, 31, 5, 25, 132, 41295 }, // Τ
-    { 21, 25, 31, 5, 25, 132, 41427 }, // Υ
-    { 29, 30, 41, 6, 27, 218, 41559 }, // Φ
-    { 23, 25, 33, 5, 25, 144, 41777 }, // Χ
-    { 20, 25, 24, 2, 23, 125, 41921 }, // Ψ
-    { 21, 23, 25, 2, 22, 121, 42046 }, // Ω
-    { 20, 19, 27, 3, 17, 95, 42167 }, // α
-    { 16, 33, 20, 2, 27, 132, 42262 }, // β
-    { 16, 25, 19, 2, 16, 100, 42394 }, // γ
-    { 16, 25, 20, 2, 25, 100, 42494 }, // δ
-    { 12, 15, 15, 2, 15, 45, 42594 }, // ε
-    { 14, 25, 17, 1, 21, 88, 42639 }, // ζ
-    { 17, 26, 21, 2, 18, 111, 42727 }, // η
-    { 16, 22, 19, 2, 22, 88, 42838 }, // θ
-    { 8, 19, 15, 4, 19, 38, 42926 }, // ι
-    { 14, 18, 21, 3, 18, 63, 42964 }, // κ
-    { 17, 24, 23, 3, 24, 102, 43027 }, // λ
-    { 16, 19, 23, 3, 16, 76, 43129 }, // μ
-    { 16, 17, 19, 2, 17, 68, 43205 }, // ν
-    { 15, 25, 16, 0, 21, 94, 43273 }, // ξ
-    { 16, 16, 24, 4, 16, 64, 43367 }, // ο
-    { 17, 16, 21, 2, 15, 68, 43431 }, // π
-    { 17, 23, 21, 2, 16, 98, 43499 }, // ρ
-    { 12, 20, 16, 2, 21, 60, 43597 }, // ς
-    { 20, 16, 25, 4, 16, 80, 43657 }, // σ
-    { 15, 16, 19, 2, 15, 60, 43737 }, // τ
-    { 13, 17, 17, 2, 16, 56, 43797 }, // υ
-    { 23, 36, 33, 5, 32, 207, 43853 }, // φ
-    { 20, 22, 24, 2, 16, 110, 44060 }, // χ
-    { 15, 28, 19, 2, 21, 105, 44170 }, // ψ
-    { 22, 16, 24, 1, 15, 88, 44275 }, // ω
-    { 23, 34, 33, 5, 25, 196, 44363 }, // Ạ
-    { 17, 25, 24, 3, 17, 107, 44559 }, // ạ
-    { 23, 37, 33, 5, 37, 213, 44666 }, // Ả
-    { 17, 26, 24, 3, 26, 111, 44879 }, // ả
-    { 23, 41, 33, 5, 41, 236, 44990 }, // Ấ
-    { 18, 32, 24, 3, 32, 144, 45226 }, // ấ
-    { 25, 37, 33, 3, 37, 232, 45370 }, // Ầ
-    { 20, 27, 24, 0, 27, 135, 45602 }, // ầ
-    { 23, 41, 33, 5, 41, 236, 45737 }, // Ẩ
-    { 17, 29, 24, 3, 29, 124, 45973 }, // ẩ
-    { 23, 40, 33, 5, 40, 230, 46097 }, // Ẫ
-    { 17, 30, 24, 3, 30, 128, 46327 }, // ẫ
-    { 23, 43, 33, 5, 34, 248, 46455 }, // Ậ
-    { 17, 32, 24, 3, 24, 136, 46703 }, // ậ
-    { 23, 47, 33, 5, 47, 271, 46839 }, // Ắ
-    { 17, 36, 24, 3, 36, 153, 47110 }, // ắ
-    { 23, 45, 33, 5, 45, 259, 47263 }, // Ằ
-    { 17, 34, 24, 3, 34, 145, 47522 }, // ằ
-    { 23, 47, 33, 5, 47, 271, 47667 }, // Ẳ
-    { 17, 38, 24, 3, 38, 162, 47938 }, // ẳ
-    { 23, 45, 33, 5, 45, 259, 48100 }, // Ẵ
-    { 17, 34, 24, 3, 34, 145, 48359 }, // ẵ
-    { 23, 45, 33, 5, 36, 259, 48504 }, // Ặ
-    { 17, 33, 24, 3, 25, 141, 48763 }, // ặ
-    { 17, 32, 27, 5, 25, 136, 48904 }, // Ẹ
-    { 16, 25, 24, 4, 17, 100, 49040 }, // ẹ
-    { 17, 36, 27, 5, 36, 153, 49140 }, // Ẻ
-    { 16, 30, 24, 4, 30, 120, 49293 }, // ẻ
-    { 17, 34, 27, 5, 34, 145, 49413 }, // Ẽ
-    { 16, 28, 24, 4, 28, 112, 49558 }, // ẽ
-    { 18, 39, 27, 5, 39, 176, 49670 }, // Ế
-    { 19, 30, 24, 4, 30, 143, 49846 }, // ế
-    { 23, 35, 27, -1, 35, 202, 49989 }, // Ề
-    { 19, 30, 24, 1, 30, 143, 50191 }, // ề
-    { 18, 39, 27, 5, 39, 176, 50334 }, // Ể
-    { 16, 34, 24, 4, 34, 136, 50510 }, // ể
-    { 17, 40, 27, 5, 40, 170, 50646 }, // Ễ
-    { 16, 34, 24, 4, 34, 136, 50816 }, // ễ
-    { 17, 40, 27, 5, 33, 170, 50952 }, // Ệ
-    { 16, 36, 24, 4, 28, 144, 51122 }, // ệ
-    { 7, 38, 13, 3, 38, 67, 51266 }, // Ỉ
-    { 6, 27, 13, 4, 27, 41, 51333 }, // ỉ
-    { 7, 33, 13, 3, 25, 58, 51374 }, // Ị
-    { 7, 33, 13, 3, 26, 58, 51432 }, // ị
-    { 23, 34, 33, 5, 25, 196, 51490 }, // Ọ
-    { 16, 25, 24, 4, 16, 100, 51686 }, // ọ
-    { 23, 36, 33, 5, 35, 207, 51786 }, // Ỏ
-    { 16, 29, 24, 4, 29, 116, 51993 }, // ỏ
-    { 29, 34, 35, 5, 33, 247, 52109 }, // Ố
-    { 19, 27, 24, 4, 27, 129, 52356 }, // ố
-    { 25, 36, 33, 3, 35, 225, 52485 }, // Ồ
-    { 20, 30, 24, 0, 30, 150, 52710 }, // ồ
-    { 23, 39, 33, 5, 38, 225, 52860 }, // Ổ
-    { 16, 33, 24, 4, 33, 132, 53085 }, // ổ
-    { 23, 40, 33, 5, 39, 230, 53217 }, // Ỗ
-    { 16, 33, 24, 4, 33, 132, 53447 }, // ỗ
-    { 23, 42, 33, 5, 33, 242, 53579 }, // Ộ
-    { 16, 35, 24, 4, 27, 140, 53821 }, // ộ
-    { 25, 37, 33, 5, 36, 232, 53961 }, // Ớ
-    { 18, 29, 24, 4, 29, 131, 54193 }, // ớ
-    { 25, 35, 33, 5, 34, 219, 54324 }, // Ờ
-    { 18, 27, 24, 4, 27, 122, 54543 }, // ờ
-    { 25, 37, 33, 5, 36, 232, 54665 }, // Ở
-    { 18, 29, 24, 4, 29, 131, 54897 }, // ở
-    { 25, 36, 33, 5, 35, 225, 55028 }, // Ỡ
-    { 18, 27, 24, 4, 27, 122, 55253 }, // ỡ
-    { 25, 36, 33, 5, 27, 225, 55375 }, // Ợ
-    { 18, 27, 24, 4, 18, 122, 55600 }, // ợ
-    { 21, 33, 31, 5, 25, 174, 55722 }, // Ụ
-    { 15, 24, 23, 4, 16, 90, 55896 }, // ụ
-    { 21, 37, 31, 5, 36, 195, 55986 }, // Ủ
-    { 15, 28, 23, 4, 27, 105, 56181 }, // ủ
-    { 23, 38, 31, 5, 37, 219, 56286 }, // Ứ
-    { 18, 28, 23, 4, 27, 126, 56505 }, // ứ
-    { 23, 36, 31, 5, 35, 207, 56631 }, // Ừ
-    { 18, 26, 23, 4, 25, 117, 56838 }, // ừ
-    { 23, 37, 31, 5, 36, 213, 56955 }, // Ử
-    { 18, 28, 23, 4, 27, 126, 57168 }, // ử
-    { 23, 36, 31, 5, 35, 207, 57294 }, // Ữ
-    { 18, 26, 23, 4, 25, 117, 57501 }, // ữ
-    { 23, 37, 31, 5, 29, 213, 57618 }, // Ự
-    { 18, 26, 23, 4, 18, 117, 57831 }, // ự
-    { 21, 34, 31, 5, 34, 179, 57948 }, // Ỳ
-    { 16, 34, 24, 4, 26, 136, 58127 }, // ỳ
-    { 21, 38, 31, 5, 25, 200, 58263 }, // Ỵ
-    { 20, 25, 25, 4, 16, 125, 58463 }, // ỵ
-    { 21, 37, 31, 5, 37, 195, 58588 }, // Ỷ
-    { 16, 37, 24, 4, 29, 148, 58783 }, // ỷ
-    { 21, 35, 31, 5, 35, 184, 58931 }, // Ỹ
-    { 16, 36, 24, 4, 28, 144, 59115 }, // ỹ
-    { 0, 0, 24, 0, 0, 0, 59259 }, //  
-    { 0, 0, 39, 0, 0, 0, 59259 }, //  
-    { 0, 0, 24, 0, 0, 0, 59259 }, //  
-    { 0, 0, 39, 0, 0, 0, 59259 }, //  
-    { 0, 0, 19, 0, 0, 0, 59259 }, //  
-    { 0, 0, 17, 0, 0, 0, 59259 }, //  
-    { 0, 0, 14, 0, 0, 0, 59259 }, //  
-    { 0, 0, 19, 0, 0, 0, 59259 }, //  
-    { 0, 0, 8, 0, 0, 0, 59259 }, //  
-    { 0, 0, 15, 0, 0, 0, 59259 }, //  
-    { 0, 0, 14, 0, 0, 0, 59259 }, //  
-    { 0, 0, 9, 0, 0, 0, 59259 }, // ​
-    { 0, 0, 1, 0, 0, 0, 59259 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 59259 }, // ‍
-    { 0, 0, 1, 0, 0, 0, 59259 }, // ‎
-    { 0, 0, 1, 0, 0, 0, 59259 }, // ‏
-    { 14, 3, 17, 2, 10, 11, 59259 }, // ‐
-    { 14, 3, 17, 2, 10, 11, 59270 }, // ‑
-    { 20, 3, 23, 2, 10, 15, 59281 }, // ‒
-    { 19, 4, 23, 2, 10, 19, 59296 }, // –
-    { 29, 4, 33, 2, 10, 29, 59315 }, // —
-    { 29, 4, 33, 2, 10, 29, 59344 }, // ―
-    { 12, 25, 16, 2, 21, 75, 59373 }, // ‖
-    { 21, 9, 24, 2, -3, 48, 59448 }, // ‗
-    { 8, 9, 10, 1, 25, 18, 59496 }, // ‘
-    { 8, 9, 10, 1, 25, 18, 59514 }, // ’
-    { 8, 10, 10, 1, 5, 20, 59532 }, // ‚
-    { 8, 9, 10, 1, 25, 18, 59552 }, // ‛
-    { 15, 9, 17, 1, 25, 34, 59570 }, // “
-    { 15, 9, 17, 1, 25, 34, 59604 }, // ”
-    { 8, 10, 10, 1, 5, 20, 59638 }, // „
-    { 15, 9, 17, 1, 25, 34, 59658 }, // ‟
-    { 15, 38, 17, 1, 30, 143, 59692 }, // †
-    { 16, 38, 18, 1, 30, 152, 59835 }, // ‡
-    { 17, 17, 17, -1, 20, 73, 59987 }, // •
-    { 8, 9, 11, 2, 13, 18, 60060 }, // ‣
-    { 6, 5, 8, 1, 5, 8, 60078 }, // ․
-    { 6, 5, 8, 1, 5, 8, 60086 }, // ‥
-    { 26, 5, 28, 1, 5, 33, 60094 }, // …
-    { 4, 3, 7, 2, 10, 3, 60127 }, // ‧
-    { 0, 0, 37, 0, 0, 0, 60130 }, //  
-    { 18, 25, 32, 7, 23, 113, 60130 }, // ‰
-    { 8, 9, 10, 1, 25, 18, 60243 }, // ′
-    { 15, 9, 17, 1, 25, 34, 60261 }, // ″
-    { 23, 9, 25, 1, 25, 52, 60295 }, // ‴
-    { 8, 9, 10, 1, 24, 18, 60347 }, // ‵
-    { 14, 9, 15, 0, 24, 32, 60365 }, // ‶
-    { 23, 9, 25, 1, 25, 52, 60397 }, // ‷
-    { 12, 5, 16, 2, 23, 15, 60449 }, // ‸
-    { 8, 14, 12, 2, 15, 28, 60464 }, // ‹
-    { 8, 14, 12, 2, 15, 28, 60492 }, // ›
-    { 30, 29, 39, 6, 26, 218, 60520 }, // ※
-    { 7, 29, 10, 1, 29, 51, 60738 }, // ‼
-    { 16, 37, 22, 2, 35, 148, 60789 }, // ‽
-    { 14, 4, 17, 2, 24, 14, 60937 }, // ‾
-    { 12, 6, 16, 2, 20, 18, 60951 }, // ‿
-    { 19, 18, 23, 2, 25, 86, 60969 }, // ⁂
-    { 17, 24, 32, 8, 22, 102, 61055 }, // ⁄
-    { 33, 33, 37, 2, 33, 273, 61157 }, // ⁇
-    { 22, 33, 29, 2, 33, 182, 61430 }, // ⁈
-    { 22, 35, 24, 1, 33, 193, 61612 }, // ⁉
-    { 17, 46, 22, 2, 32, 196, 61805 }, // ⁒
-    { 0, 0, 141, 0, 0, 0, 62001 }, //  
-    { 8, 11, 10, 1, 24, 22, 62001 }, // ⁰
-    { 8, 11, 10, 1, 24, 22, 62023 }, // ⁴
-    { 8, 12, 10, 1, 25, 24, 62045 }, // ⁵
-    { 8, 11, 10, 1, 24, 22, 62069 }, // ⁶
-    { 8, 13, 10, 1, 25, 26, 62091 }, // ⁷
-    { 9, 11, 10, 0, 24, 25, 62117 }, // ⁸
-    { 8, 11, 10, 1, 24, 22, 62142 }, // ⁹
-    { 16, 17, 24, 4, 17, 68, 62164 }, // ⁿ
-    { 11, 15, 13, 1, 15, 42, 62232 }, // ₀
-    { 7, 12, 9, 1, 7, 21, 62274 }, // ₁
-    { 8, 12, 10, 1, 7, 24, 62295 }, // ₂
-    { 8, 11, 10, 1, 6, 22, 62319 }, // ₃
-    { 8, 11, 10, 1, 6, 22, 62341 }, // ₄
-    { 7, 12, 9, 1, 7, 21, 62363 }, // ₅
-    { 8, 12, 10, 1, 7, 24, 62384 }, // ₆
-    { 8, 12, 10, 1, 7, 24, 62408 }, // ₇
-    { 9, 11, 10, 0, 6, 25, 62432 }, // ₈
-    { 8, 11, 10, 1, 6, 22, 62457 }, // ₉
-    { 10, 39, 13, 2, 29, 98, 62479 }, // ₍
-    { 9, 39, 13, 1, 29, 88, 62577 }, // ₎
-    { 20, 37, 29, 4, 31, 185, 62665 }, // ₡
-    { 20, 27, 29, 4, 26, 135, 62850 }, // ₢
-    { 18, 28, 20, 1, 28, 126, 62985 }, // ₤
-    { 28, 25, 31, 2, 25, 175, 63111 }, // ₦
-    { 23, 25, 27, 1, 25, 144, 63286 }, // ₧
-    { 29, 24, 34, 4, 24, 174, 63430 }, // ₨
-    { 22, 24, 25, 1, 24, 132, 63604 }, // ₩
-    { 23, 23, 31, 4, 23, 133, 63736 }, // ₪
-    { 19, 23, 22, 2, 23, 110, 63869 }, // ₫
-    { 18, 26, 22, 2, 23, 117, 63979 }, // €
-    { 21, 25, 31, 5, 25, 132, 64096 }, // ₮
-    { 26, 25, 27, 0, 25, 163, 64228 }, // ₱
-    { 23, 34, 33, 5, 30, 196, 64391 }, // ₲
-    { 26, 27, 29, 2, 26, 176, 64587 }, // ₴
-    { 14, 22, 22, 4, 20, 77, 64763 }, // ₵
-    { 21, 26, 31, 5, 26, 137, 64840 }, // ₸
-    { 14, 22, 18, 2, 22, 77, 64977 }, // ₹
-    { 16, 21, 20, 2, 20, 84, 65054 }, // ₺
-    { 18, 23, 19, 0, 23, 104, 65138 }, // ₼
-    { 23, 25, 27, -1, 25, 144, 65242 }, // ₽
-    { 18, 18, 22, 2, 16, 81, 65386 }, // ←
-    { 18, 18, 22, 2, 18, 81, 65467 }, // ↑
-    { 18, 18, 22, 2, 16, 81, 65548 }, // →
-    { 18, 18, 22, 2, 18, 81, 65629 }, // ↓
-    { 22, 16, 26, 2, 16, 88, 65710 }, // ↔
-    { 15, 23, 19, 2, 23, 87, 65798 }, // ↕
-    { 15, 14, 19, 2, 15, 53, 65885 }, // ↖
-    { 15, 14, 19, 2, 15, 53, 65938 }, // ↗
-    { 15, 15, 19, 2, 16, 57, 65991 }, // ↘
-    { 15, 15, 19, 2, 16, 57, 66048 }, // ↙
-    { 21, 19, 25, 2, 18, 100, 66105 }, // ⇐
-    { 23, 21, 27, 2, 21, 121, 66205 }, // ⇑
-    { 21, 19, 25, 2, 18, 100, 66326 }, // ⇒
-    { 23, 22, 27, 2, 21, 127, 66426 }, // ⇓
-    { 24, 19, 28, 2, 18, 114, 66553 }, // ⇔
-    { 19, 24, 23, 2, 16, 114, 66667 }, // ⇕
-    { 16, 23, 20, 2, 23, 92, 66781 }, // ∂
-    { 29, 28, 33, 2, 26, 203, 66873 }, // ∅
-    { 21, 22, 25, 2, 22, 116, 67076 }, // ∆
-    { 18, 21, 22, 2, 21, 95, 67192 }, // ∏
-    { 18, 21, 22, 2, 21, 95, 67287 }, // ∐
-    { 14, 22, 17, 2, 21, 77, 67382 }, // ∑
-    { 14, 4, 18, 2, 10, 14, 67459 }, // −
-    { 23, 25, 27, 2, 23, 144, 67473 }, // √
-    { 23, 15, 27, 2, 18, 87, 67617 }, // ∞
-    { 24, 33, 26, 1, 26, 198, 67704 }, // ∫
-    { 6, 18, 8, 1, 18, 27, 67902 }, // ∶
-    { 17, 15, 23, 3, 16, 64, 67929 }, // ≈
-    { 19, 24, 32, 7, 22, 114, 67993 }, // ≠
-    { 21, 22, 25, 2, 20, 116, 68107 }, // ≤
-    { 21, 22, 25, 2, 20, 116, 68223 }, // ≥
+    { 7, 29, 10, 1, 29, 39, 0 }, // !
+    { 14, 9, 16, 1, 25, 27, 39 }, // "
+    { 29, 25, 33, 2, 23, 116, 66 }, // #
+    { 25, 31, 35, 5, 27, 133, 182 }, // $
+    { 19, 25, 29, 6, 23, 96, 315 }, // %
+    { 22, 26, 28, 3, 25, 95, 411 }, // &
+    { 6, 9, 8, 1, 22, 14, 506 }, // '
+    { 10, 39, 13, 2, 29, 55, 520 }, // (
+    { 9, 39, 13, 1, 29, 59, 575 }, // )
+    { 15, 14, 19, 2, 22, 43, 634 }, // *
+    { 14, 14, 18, 2, 15, 30, 677 }, // +
+    { 8, 10, 10, 1, 5, 14, 707 }, // ,
+    { 14, 3, 18, 2, 10, 8, 721 }, // -
+    { 6, 5, 8, 1, 5, 8, 729 }, // .
+    { 17, 45, 18, 0, 32, 90, 737 }, // /
+    { 16, 22, 19, 2, 22, 77, 827 }, // 0
+    { 13, 22, 17, 2, 22, 44, 904 }, // 1
+    { 15, 22, 19, 2, 22, 53, 948 }, // 2
+    { 15, 22, 19, 2, 22, 58, 1001 }, // 3
+    { 16, 22, 19, 2, 22, 57, 1059 }, // 4
+    { 15, 23, 18, 2, 23, 56, 1116 }, // 5
+    { 16, 22, 19, 2, 22, 64, 1172 }, // 6
+    { 14, 22, 18, 2, 22, 46, 1236 }, // 7
+    { 17, 22, 20, 1, 22, 70, 1282 }, // 8
+    { 15, 22, 19, 2, 22, 60, 1352 }, // 9
+    { 6, 18, 8, 1, 18, 19, 1412 }, // :
+    { 8, 22, 10, 1, 17, 25, 1431 }, // ;
+    { 20, 17, 23, 2, 18, 52, 1456 }, // <
+    { 14, 10, 18, 2, 13, 21, 1508 }, // =
+    { 20, 17, 23, 2, 18, 50, 1529 }, // >
+    { 16, 33, 17, 0, 33, 77, 1579 }, // ?
+    { 26, 25, 35, 3, 23, 113, 1656 }, // @
+    { 23, 25, 33, 5, 25, 84, 1769 }, // A
+    { 19, 25, 28, 5, 25, 87, 1853 }, // B
+    { 20, 27, 29, 4, 26, 77, 1940 }, // C
+    { 23, 25, 32, 5, 25, 95, 2017 }, // D
+    { 17, 25, 27, 5, 25, 69, 2112 }, // E
+    { 15, 25, 25, 5, 25, 58, 2181 }, // F
+    { 23, 26, 33, 5, 26, 90, 2239 }, // G
+    { 21, 25, 31, 5, 25, 86, 2329 }, // H
+    { 6, 25, 13, 4, 25, 48, 2415 }, // I
+    { 12, 33, 22, 5, 26, 56, 2463 }, // J
+    { 20, 25, 30, 5, 25, 76, 2519 }, // K
+    { 16, 25, 27, 5, 25, 54, 2595 }, // L
+    { 26, 25, 36, 5, 25, 126, 2649 }, // M
+    { 21, 25, 31, 5, 25, 103, 2775 }, // N
+    { 23, 26, 33, 5, 25, 92, 2878 }, // O
+    { 17, 25, 27, 5, 25, 69, 2970 }, // P
+    { 25, 29, 30, 2, 25, 106, 3039 }, // Q
+    { 18, 25, 28, 5, 25, 79, 3145 }, // R
+    { 23, 27, 33, 5, 26, 86, 3224 }, // S
+    { 21, 25, 31, 5, 25, 65, 3310 }, // T
+    { 21, 26, 31, 5, 25, 88, 3375 }, // U
+    { 24, 25, 34, 5, 25, 81, 3463 }, // V
+    { 31, 25, 42, 5, 25, 117, 3544 }, // W
+    { 23, 25, 33, 5, 25, 86, 3661 }, // X
+    { 21, 25, 31, 5, 25, 71, 3747 }, // Y
+    { 23, 25, 33, 5, 25, 76, 3818 }, // Z
+    { 10, 41, 14, 2, 31, 67, 3894 }, // [
+    { 10, 28, 14, 2, 23, 41, 3961 }, // <backslash>
+    { 10, 41, 14, 2, 31, 69, 4002 }, // ]
+    { 12, 6, 16, 2, 27, 15, 4071 }, // ^
+    { 19, 4, 23, 2, -2, 18, 4086 }, // _
+    { 10, 5, 12, 1, 22, 8, 4104 }, // `
+    { 17, 17, 24, 3, 17, 54, 4112 }, // a
+    { 17, 26, 25, 4, 25, 75, 4166 }, // b
+    { 14, 18, 22, 4, 17, 41, 4241 }, // c
+    { 17, 26, 25, 4, 25, 76, 4282 }, // d
+    { 16, 17, 24, 4, 17, 49, 4358 }, // e
+    { 10, 24, 18, 4, 24, 40, 4407 }, // f
+    { 16, 23, 23, 4, 16, 72, 4447 }, // g
+    { 16, 25, 24, 4, 25, 69, 4519 }, // h
+    { 6, 26, 13, 4, 26, 34, 4588 }, // i
+    { 12, 33, 19, 4, 25, 59, 4622 }, // j
+    { 16, 24, 24, 4, 24, 62, 4681 }, // k
+    { 9, 24, 16, 3, 24, 40, 4743 }, // l
+    { 26, 16, 34, 4, 16, 77, 4783 }, // m
+    { 16, 17, 24, 4, 17, 56, 4860 }, // n
+    { 16, 16, 24, 4, 16, 49, 4916 }, // o
+    { 18, 24, 24, 2, 16, 70, 4965 }, // p
+    { 20, 25, 28, 4, 18, 78, 5035 }, // q
+    { 11, 16, 19, 4, 16, 32, 5113 }, // r
+    { 15, 16, 23, 4, 16, 43, 5145 }, // s
+    { 13, 22, 21, 4, 22, 44, 5188 }, // t
+    { 15, 17, 23, 4, 16, 50, 5232 }, // u
+    { 18, 16, 26, 4, 16, 49, 5282 }, // v
+    { 22, 16, 30, 4, 16, 64, 5331 }, // w
+    { 18, 16, 26, 4, 16, 45, 5395 }, // x
+    { 16, 24, 24, 4, 16, 63, 5440 }, // y
+    { 16, 16, 24, 4, 16, 43, 5503 }, // z
+    { 13, 27, 16, 2, 22, 55, 5546 }, // {
+    { 4, 25, 7, 2, 21, 40, 5601 }, // |
+    { 13, 27, 16, 2, 22, 49, 5641 }, // }
+    { 11, 6, 14, 1, 22, 19, 5690 }, // ~
+    { 0, 0, 25, 0, 0, 0, 5709 }, //  
+    { 7, 29, 10, 1, 22, 40, 5709 }, // ¡
+    { 14, 25, 22, 4, 22, 69, 5749 }, // ¢
+    { 18, 28, 20, 1, 28, 70, 5818 }, // £
+    { 16, 15, 20, 2, 18, 49, 5888 }, // ¤
+    { 18, 24, 22, 2, 22, 58, 5937 }, // ¥
+    { 4, 25, 7, 2, 21, 33, 5995 }, // ¦
+    { 16, 26, 24, 4, 23, 68, 6028 }, // §
+    { 14, 5, 16, 1, 23, 15, 6096 }, // ¨
+    { 12, 11, 16, 2, 26, 40, 6111 }, // ©
+    { 10, 10, 13, 2, 22, 27, 6151 }, // ª
+    { 15, 14, 19, 2, 14, 40, 6178 }, // «
+    { 14, 9, 18, 2, 10, 25, 6218 }, // ¬
+    { 14, 3, 17, 2, 10, 8, 6243 }, // ­
+    { 12, 11, 16, 2, 31, 46, 6251 }, // ®
+    { 11, 3, 15, 2, 21, 9, 6297 }, // ¯
+    { 14, 14, 16, 1, 23, 34, 6306 }, // °
+    { 14, 17, 18, 2, 16, 41, 6340 }, // ±
+    { 7, 11, 9, 1, 24, 17, 6381 }, // ²
+    { 8, 11, 10, 1, 23, 20, 6398 }, // ³
+    { 6, 6, 8, 1, 23, 9, 6418 }, // ´
+    { 16, 19, 23, 3, 16, 59, 6427 }, // µ
+    { 14, 24, 18, 2, 21, 77, 6486 }, // ¶
+    { 6, 5, 8, 1, 12, 8, 6563 }, // ·
+    { 6, 8, 10, 2, 1, 13, 6571 }, // ¸
+    { 7, 11, 9, 1, 24, 16, 6584 }, // ¹
+    { 9, 9, 13, 3, 21, 23, 6600 }, // º
+    { 15, 14, 19, 2, 14, 41, 6623 }, // »
+    { 24, 28, 32, 5, 26, 105, 6664 }, // ¼
+    { 25, 27, 32, 5, 25, 103, 6769 }, // ½
+    { 26, 27, 32, 3, 25, 114, 6872 }, // ¾
+    { 16, 32, 17, 0, 17, 66, 6986 }, // ¿
+    { 23, 33, 33, 5, 33, 101, 7052 }, // À
+    { 23, 38, 33, 5, 38, 109, 7153 }, // Á
+    { 23, 34, 33, 5, 34, 107, 7262 }, // Â
+    { 23, 33, 33, 5, 33, 110, 7369 }, // Ã
+    { 23, 33, 33, 5, 33, 105, 7479 }, // Ä
+    { 23, 35, 33, 5, 35, 109, 7584 }, // Å
+    { 32, 26, 42, 5, 25, 110, 7693 }, // Æ
+    { 20, 33, 29, 4, 26, 93, 7803 }, // Ç
+    { 17, 32, 27, 5, 32, 82, 7896 }, // È
+    { 17, 38, 27, 5, 38, 89, 7978 }, // É
+    { 17, 33, 27, 5, 33, 86, 8067 }, // Ê
+    { 17, 33, 27, 5, 33, 86, 8153 }, // Ë
+    { 10, 35, 13, 0, 35, 58, 8239 }, // Ì
+    { 6, 40, 13, 4, 40, 59, 8297 }, // Í
+    { 12, 36, 13, 0, 36, 67, 8356 }, // Î
+    { 14, 35, 14, -1, 35, 80, 8423 }, // Ï
+    { 27, 25, 32, 1, 25, 101, 8503 }, // Ð
+    { 21, 32, 31, 5, 32, 128, 8604 }, // Ñ
+    { 23, 33, 33, 5, 32, 110, 8732 }, // Ò
+    { 23, 38, 33, 5, 37, 116, 8842 }, // Ó
+    { 23, 34, 33, 5, 33, 115, 8958 }, // Ô
+    { 23, 33, 33, 5, 32, 114, 9073 }, // Õ
+    { 23, 33, 33, 5, 32, 110, 9187 }, // Ö
+    { 13, 8, 17, 2, 11, 22, 9297 }, // ×
+    { 36, 52, 36, -1, 38, 204, 9319 }, // Ø
+    { 21, 35, 31, 5, 34, 106, 9523 }, // Ù
+    { 21, 39, 31, 5, 38, 117, 9629 }, // Ú
+    { 21, 35, 31, 5, 34, 111, 9746 }, // Û
+    { 21, 35, 31, 5, 34, 111, 9857 }, // Ü
+    { 21, 39, 31, 5, 39, 97, 9968 }, // Ý
+    { 14, 23, 16, 1, 23, 68, 10065 }, // Þ
+    { 16, 23, 20, 2, 23, 75, 10133 }, // ß
+    { 17, 23, 24, 3, 23, 66, 10208 }, // à
+    { 17, 28, 24, 3, 28, 71, 10274 }, // á
+    { 17, 24, 24, 3, 24, 72, 10345 }, // â
+    { 17, 23, 24, 3, 23, 76, 10417 }, // ã
+    { 17, 23, 24, 3, 23, 72, 10493 }, // ä
+    { 17, 25, 24, 3, 25, 75, 10565 }, // å
+    { 29, 17, 36, 3, 17, 87, 10640 }, // æ
+    { 14, 24, 22, 4, 17, 54, 10727 }, // ç
+    { 16, 27, 24, 4, 27, 64, 10781 }, // è
+    { 16, 32, 24, 4, 32, 71, 10845 }, // é
+    { 16, 28, 24, 4, 28, 70, 10916 }, // ê
+    { 16, 27, 24, 4, 27, 69, 10986 }, // ë
+    { 10, 24, 13, 0, 24, 35, 11055 }, // ì
+    { 6, 29, 13, 4, 29, 35, 11090 }, // í
+    { 13, 25, 14, 0, 25, 48, 11125 }, // î
+    { 14, 25, 14, -1, 25, 49, 11173 }, // ï
+    { 22, 23, 25, 2, 23, 74, 11222 }, // ð
+    { 16, 25, 24, 4, 25, 76, 11296 }, // ñ
+    { 16, 26, 24, 4, 26, 67, 11372 }, // ò
+    { 16, 31, 24, 4, 31, 72, 11439 }, // ó
+    { 16, 27, 24, 4, 27, 72, 11511 }, // ô
+    { 16, 26, 24, 4, 26, 71, 11583 }, // õ
+    { 16, 26, 24, 4, 26, 69, 11654 }, // ö
+    { 18, 18, 22, 2, 18, 38, 11723 }, // ÷
+    { 17, 45, 24, 3, 30, 118, 11761 }, // ø
+    { 15, 25, 23, 4, 24, 66, 11879 }, // ù
+    { 15, 30, 23, 4, 29, 68, 11945 }, // ú
+    { 15, 26, 23, 4, 25, 66, 12013 }, // û
+    { 15, 25, 23, 4, 24, 70, 12079 }, // ü
+    { 16, 39, 24, 4, 31, 85, 12149 }, // ý
+    { 13, 30, 16, 2, 24, 76, 12234 }, // þ
+    { 16, 35, 24, 4, 27, 86, 12310 }, // ÿ
+    { 23, 32, 33, 5, 32, 99, 12396 }, // Ā
+    { 17, 22, 24, 3, 22, 66, 12495 }, // ā
+    { 23, 36, 33, 5, 36, 109, 12561 }, // Ă
+    { 17, 25, 24, 3, 25, 72, 12670 }, // ă
+    { 23, 32, 33, 5, 25, 102, 12742 }, // Ą
+    { 17, 22, 24, 3, 17, 64, 12844 }, // ą
+    { 20, 39, 29, 4, 38, 99, 12908 }, // Ć
+    { 14, 28, 22, 4, 27, 56, 13007 }, // ć
+    { 20, 37, 29, 4, 36, 98, 13063 }, // Ĉ
+    { 14, 25, 22, 4, 24, 60, 13161 }, // ĉ
+    { 20, 37, 29, 4, 36, 93, 13221 }, // Ċ
+    { 14, 26, 22, 4, 25, 53, 13314 }, // ċ
+    { 20, 39, 29, 4, 38, 102, 13367 }, // Č
+    { 14, 27, 22, 4, 26, 60, 13469 }, // č
+    { 23, 36, 32, 5, 36, 123, 13529 }, // Ď
+    { 22, 26, 27, 4, 25, 89, 13652 }, // ď
+    { 27, 25, 32, 1, 25, 101, 13741 }, // Đ
+    { 21, 26, 26, 4, 25, 82, 13842 }, // đ
+    { 17, 32, 27, 5, 32, 82, 13924 }, // Ē
+    { 16, 26, 24, 4, 26, 63, 14006 }, // ē
+    { 17, 35, 27, 5, 35, 91, 14069 }, // Ĕ
+    { 16, 30, 24, 4, 30, 74, 14160 }, // ĕ
+    { 17, 34, 27, 5, 34, 83, 14234 }, // Ė
+    { 16, 28, 24, 4, 28, 64, 14317 }, // ė
+    { 17, 31, 27, 5, 25, 80, 14381 }, // Ę
+    { 16, 24, 24, 4, 17, 64, 14461 }, // ę
+    { 17, 35, 27, 5, 35, 90, 14525 }, // Ě
+    { 16, 30, 24, 4, 30, 71, 14615 }, // ě
+    { 23, 34, 33, 5, 34, 112, 14686 }, // Ĝ
+    { 16, 32, 23, 4, 25, 89, 14798 }, // ĝ
+    { 23, 36, 33, 5, 36, 116, 14887 }, // Ğ
+    { 16, 33, 23, 4, 26, 95, 15003 }, // ğ
+    { 23, 34, 33, 5, 34, 108, 15098 }, // Ġ
+    { 16, 32, 23, 4, 25, 86, 15206 }, // ġ
+    { 23, 39, 33, 5, 26, 119, 15292 }, // Ģ
+    { 16, 34, 23, 4, 27, 92, 15411 }, // ģ
+    { 21, 33, 31, 5, 33, 106, 15503 }, // Ĥ
+    { 19, 31, 24, 1, 31, 86, 15609 }, // ĥ
+    { 24, 24, 31, 3, 24, 94, 15695 }, // Ħ
+    { 19, 25, 24, 1, 25, 72, 15789 }, // ħ
+    { 11, 36, 13, 1, 36, 72, 15861 }, // Ĩ
+    { 11, 25, 13, 1, 25, 44, 15933 }, // ĩ
+    { 14, 34, 14, -1, 34, 74, 15977 }, // Ī
+    { 14, 23, 15, 0, 23, 42, 16051 }, // ī
+    { 7, 31, 18, 7, 25, 47, 16093 }, // Į
+    { 7, 32, 13, 3, 26, 44, 16140 }, // į
+    { 7, 36, 13, 3, 36, 58, 16184 }, // İ
+    { 5, 17, 13, 4, 17, 22, 16242 }, // ı
+    { 18, 32, 27, 4, 25, 103, 16264 }, // Ĳ
+    { 22, 34, 27, 4, 26, 101, 16367 }, // ĳ
+    { 13, 39, 22, 5, 32, 79, 16468 }, // Ĵ
+    { 15, 32, 20, 4, 24, 67, 16547 }, // ĵ
+    { 20, 35, 30, 5, 25, 94, 16614 }, // Ķ
+    { 16, 37, 24, 4, 24, 83, 16708 }, // ķ
+    { 13, 16, 19, 3, 16, 43, 16791 }, // ĸ
+    { 16, 35, 27, 5, 35, 69, 16834 }, // Ĺ
+    { 9, 34, 16, 3, 34, 52, 16903 }, // ĺ
+    { 16, 38, 27, 5, 25, 75, 16955 }, // Ļ
+    { 9, 36, 16, 3, 24, 55, 17030 }, // ļ
+    { 16, 25, 27, 5, 25, 60, 17085 }, // Ľ
+    { 12, 25, 16, 3, 25, 51, 17145 }, // ľ
+    { 16, 25, 27, 5, 25, 59, 17196 }, // Ŀ
+    { 13, 24, 17, 3, 24, 55, 17255 }, // ŀ
+    { 28, 41, 27, -7, 32, 130, 17310 }, // Ł
+    { 19, 24, 16, -6, 24, 60, 17440 }, // ł
+    { 21, 35, 31, 5, 35, 123, 17500 }, // Ń
+    { 16, 28, 24, 4, 28, 73, 17623 }, // ń
+    { 21, 35, 31, 5, 25, 123, 17696 }, // Ņ
+    { 16, 27, 24, 4, 17, 73, 17819 }, // ņ
+    { 21, 35, 31, 5, 35, 127, 17892 }, // Ň
+    { 16, 28, 24, 4, 28, 76, 18019 }, // ň
+    { 16, 30, 20, 2, 30, 74, 18095 }, // ŉ
+    { 21, 30, 31, 5, 25, 116, 18169 }, // Ŋ
+    { 16, 23, 24, 4, 17, 67, 18285 }, // ŋ
+    { 23, 32, 33, 5, 31, 106, 18352 }, // Ō
+    { 16, 25, 24, 4, 25, 69, 18458 }, // ō
+    { 23, 36, 33, 5, 35, 117, 18527 }, // Ŏ
+    { 16, 29, 24, 4, 29, 74, 18644 }, // ŏ
+    { 24, 34, 33, 5, 33, 117, 18718 }, // Ő
+    { 22, 27, 25, 2, 27, 82, 18835 }, // ő
+    { 33, 25, 39, 5, 25, 119, 18917 }, // Œ
+    { 28, 17, 33, 4, 17, 84, 19036 }, // œ
+    { 18, 34, 28, 5, 34, 96, 19120 }, // Ŕ
+    { 11, 25, 19, 4, 25, 42, 19216 }, // ŕ
+    { 18, 39, 28, 5, 25, 102, 19258 }, // Ŗ
+    { 12, 31, 19, 3, 16, 51, 19360 }, // ŗ
+    { 18, 34, 28, 5, 34, 98, 19411 }, // Ř
+    { 13, 25, 19, 2, 25, 54, 19509 }, // ř
+    { 23, 38, 33, 5, 37, 108, 19563 }, // Ś
+    { 15, 26, 23, 4, 26, 59, 19671 }, // ś
+    { 23, 36, 33, 5, 35, 108, 19730 }, // Ŝ
+    { 15, 24, 23, 4, 24, 60, 19838 }, // ŝ
+    { 23, 33, 33, 5, 26, 102, 19898 }, // Ş
+    { 15, 24, 23, 4, 16, 60, 20000 }, // ş
+    { 23, 38, 33, 5, 37, 112, 20060 }, // Š
+    { 15, 26, 23, 4, 26, 62, 20172 }, // š
+    { 21, 31, 31, 5, 25, 80, 20234 }, // Ţ
+    { 13, 28, 21, 4, 22, 54, 20314 }, // ţ
+    { 21, 35, 31, 5, 35, 92, 20368 }, // Ť
+    { 14, 25, 21, 4, 25, 54, 20460 }, // ť
+    { 21, 25, 31, 5, 25, 66, 20514 }, // Ŧ
+    { 14, 22, 21, 3, 22, 47, 20580 }, // ŧ
+    { 21, 36, 31, 5, 35, 119, 20627 }, // Ũ
+    { 15, 26, 23, 4, 25, 73, 20746 }, // ũ
+    { 21, 34, 31, 5, 33, 106, 20819 }, // Ū
+    { 15, 24, 23, 4, 23, 64, 20925 }, // ū
+    { 21, 37, 31, 5, 36, 113, 20989 }, // Ŭ
+    { 15, 27, 23, 4, 26, 73, 21102 }, // ŭ
+    { 21, 38, 31, 5, 37, 117, 21175 }, // Ů
+    { 15, 28, 23, 4, 27, 74, 21292 }, // ů
+    { 22, 36, 31, 5, 35, 111, 21366 }, // Ű
+    { 22, 26, 24, 1, 25, 83, 21477 }, // ű
+    { 21, 31, 31, 5, 25, 101, 21560 }, // Ų
+    { 15, 23, 23, 4, 16, 63, 21661 }, // ų
+    { 31, 34, 42, 5, 34, 144, 21724 }, // Ŵ
+    { 22, 26, 30, 4, 26, 88, 21868 }, // ŵ
+    { 21, 35, 31, 5, 35, 94, 21956 }, // Ŷ
+    { 16, 35, 24, 4, 27, 84, 22050 }, // ŷ
+    { 21, 34, 31, 5, 34, 94, 22134 }, // Ÿ
+    { 23, 35, 33, 5, 35, 97, 22228 }, // Ź
+    { 16, 27, 24, 4, 27, 60, 22325 }, // ź
+    { 23, 33, 33, 5, 33, 92, 22385 }, // Ż
+    { 16, 25, 24, 4, 25, 57, 22477 }, // ż
+    { 23, 35, 33, 5, 35, 101, 22534 }, // Ž
+    { 16, 27, 24, 4, 27, 64, 22635 }, // ž
+    { 10, 24, 15, 4, 24, 33, 22699 }, // ſ
+    { 25, 28, 33, 5, 27, 107, 22732 }, // Ơ
+    { 18, 18, 24, 4, 18, 60, 22839 }, // ơ
+    { 20, 25, 27, 2, 25, 78, 22899 }, // Ƥ
+    { 18, 29, 24, 2, 21, 78, 22977 }, // ƥ
+    { 14, 22, 17, 2, 21, 49, 23055 }, // Ʃ
+    { 21, 25, 31, 5, 25, 66, 23104 }, // Ƭ
+    { 13, 25, 21, 4, 25, 50, 23170 }, // ƭ
+    { 21, 31, 31, 5, 25, 82, 23220 }, // Ʈ
+    { 23, 30, 31, 5, 29, 100, 23302 }, // Ư
+    { 18, 19, 23, 4, 18, 59, 23402 }, // ư
+    { 10, 5, 12, 1, 22, 8, 23461 }, // ̀
+    { 6, 6, 8, 1, 23, 9, 23469 }, // ́
+    { 12, 6, 15, 2, 0, 15, 23478 }, // ̂
+    { 11, 6, 13, 1, 22, 19, 23493 }, // ̃
+    { 14, 4, 17, 2, 20, 9, 23512 }, // ̄
+    { 19, 4, 22, 2, 26, 11, 23521 }, // ̅
+    { 12, 6, 15, 2, 21, 18, 23532 }, // ̆
+    { 6, 5, 8, 1, 22, 8, 23550 }, // ̇
+    { 14, 5, 16, 1, 23, 15, 23558 }, // ̈
+    { 7, 6, 8, 0, 19, 11, 23573 }, // ̉
+    { 7, 6, 9, 1, 22, 16, 23584 }, // ̊
+    { 22, 5, 24, 1, 22, 18, 23600 }, // ̋
+    { 12, 6, 15, 2, 22, 15, 23618 }, // ̌
+    { 22, 5, 17, -6, 24, 22, 23633 }, // ̏
+    { 7, 9, 9, 1, 22, 14, 23655 }, // ̒
+    { 8, 9, 10, 1, 22, 14, 23669 }, // ̓
+    { 7, 9, 9, 1, 22, 14, 23683 }, // ̔
+    { 5, 7, 8, 2, -1, 11, 23697 }, // ̘
+    { 5, 7, 8, 2, -1, 10, 23708 }, // ̙
+    { 12, 7, 15, 2, 23, 21, 23718 }, // ̚
+    { 4, 6, 7, 2, 18, 10, 23739 }, // ̛
+    { 3, 6, 6, 2, -2, 8, 23749 }, // ̜
+    { 7, 5, 10, 2, 3, 11, 23757 }, // ̝
+    { 7, 5, 10, 2, -1, 9, 23768 }, // ̞
+    { 6, 7, 9, 2, -2, 9, 23777 }, // ̟
+    { 14, 4, 17, 2, -4, 9, 23786 }, // ̠
+    { 6, 5, 8, 1, 1, 8, 23795 }, // ̣
+    { 14, 5, 16, 1, -1, 15, 23803 }, // ̤
+    { 7, 6, 9, 1, 22, 16, 23818 }, // ̥
+    { 8, 10, 10, 1, 5, 14, 23834 }, // ̦
+    { 6, 8, 9, 2, 1, 13, 23848 }, // ̧
+    { 6, 8, 9, 2, 1, 12, 23861 }, // ̨
+    { 4, 8, 7, 2, -2, 13, 23873 }, // ̩
+    { 9, 5, 12, 2, -1, 17, 23886 }, // ̪
+    { 12, 6, 15, 2, 0, 16, 23903 }, // ̬
+    { 13, 6, 15, 1, -1, 16, 23919 }, // ̭
+    { 11, 6, 13, 1, 22, 19, 23935 }, // ̰
+    { 11, 3, 14, 2, 21, 9, 23954 }, // ̱
+    { 12, 4, 15, 2, -2, 7, 23963 }, // ̲
+    { 11, 6, 13, 1, 22, 19, 23970 }, // ̴
+    { 14, 3, 17, 2, 10, 8, 23989 }, // ̵
+    { 3, 6, 6, 2, -2, 8, 23997 }, // ̹
+    { 9, 5, 12, 2, -1, 15, 24005 }, // ̺
+    { 9, 8, 12, 2, 0, 19, 24020 }, // ̻
+    { 9, 6, 12, 2, 0, 21, 24039 }, // ̼
+    { 7, 6, 11, 3, 22, 15, 24060 }, // ̽
+    { 11, 6, 13, 1, 22, 19, 24075 }, // ͂
+    { 4, 5, 7, 2, 24, 8, 24094 }, // ̓
+    { 14, 13, 16, 1, 31, 30, 24102 }, // ̈́
+    { 9, 5, 12, 2, 23, 17, 24132 }, // ͆
+    { 14, 11, 17, 2, 0, 22, 24149 }, // ͇
+    { 11, 8, 14, 2, 0, 24, 24171 }, // ͈
+    { 9, 7, 12, 2, -2, 14, 24195 }, // ͉
+    { 11, 16, 13, 1, 27, 40, 24209 }, // ͊
+    { 24, 13, 26, 1, 26, 45, 24249 }, // ͋
+    { 17, 15, 21, 3, 16, 51, 24294 }, // ͌
+    { 15, 7, 18, 2, -3, 14, 24345 }, // ͍
+    { 4, 4, 7, 2, 3, 7, 24359 }, // ͎
+    { 24, 6, 27, 2, 0, 23, 24366 }, // ͜
+    { 24, 6, 27, 2, 23, 24, 24389 }, // ͡
+    { 28, 7, 31, 2, -2, 22, 24413 }, // ͢
+    { 23, 25, 33, 5, 25, 84, 24435 }, // Α
+    { 19, 25, 28, 5, 25, 87, 24519 }, // Β
+    { 13, 24, 17, 2, 22, 53, 24606 }, // Γ
+    { 21, 22, 25, 2, 22, 68, 24659 }, // Δ
+    { 17, 25, 27, 5, 25, 69, 24727 }, // Ε
+    { 23, 25, 33, 5, 25, 76, 24796 }, // Ζ
+    { 21, 25, 31, 5, 25, 86, 24872 }, // Η
+    { 23, 26, 33, 5, 25, 98, 24958 }, // Θ
+    { 6, 25, 13, 4, 25, 48, 25056 }, // Ι
+    { 20, 25, 30, 5, 25, 76, 25104 }, // Κ
+    { 24, 25, 34, 5, 25, 82, 25180 }, // Λ
+    { 26, 25, 36, 5, 25, 126, 25262 }, // Μ
+    { 21, 25, 31, 5, 25, 103, 25388 }, // Ν
+    { 18, 21, 22, 2, 21, 47, 25491 }, // Ξ
+    { 23, 26, 33, 5, 25, 92, 25538 }, // Ο
+    { 14, 21, 18, 2, 21, 53, 25630 }, // Π
+    { 17, 25, 27, 5, 25, 69, 25683 }, // Ρ
+    { 14, 22, 17, 2, 21, 49, 25752 }, // Σ
+    { 21, 25, 31, 5, 25, 65, 25801 }, // Τ
+    { 21, 25, 31, 5, 25, 71, 25866 }, // Υ
+    { 29, 30, 41, 6, 27, 130, 25937 }, // Φ
+    { 23, 25, 33, 5, 25, 86, 26067 }, // Χ
+    { 20, 25, 24, 2, 23, 88, 26153 }, // Ψ
+    { 21, 23, 25, 2, 22, 80, 26241 }, // Ω
+    { 20, 19, 27, 3, 17, 63, 26321 }, // α
+    { 16, 33, 20, 2, 27, 94, 26384 }, // β
+    { 16, 25, 19, 2, 16, 60, 26478 }, // γ
+    { 16, 25, 20, 2, 25, 70, 26538 }, // δ
+    { 12, 15, 15, 2, 15, 40, 26608 }, // ε
+    { 14, 25, 17, 1, 21, 58, 26648 }, // ζ
+    { 17, 26, 21, 2, 18, 73, 26706 }, // η
+    { 16, 22, 19, 2, 22, 70, 26779 }, // θ
+    { 8, 19, 15, 4, 19, 30, 26849 }, // ι
+    { 14, 18, 21, 3, 18, 47, 26879 }, // κ
+    { 17, 24, 23, 3, 24, 66, 26926 }, // λ
+    { 16, 19, 23, 3, 16, 59, 26992 }, // μ
+    { 16, 17, 19, 2, 17, 43, 27051 }, // ν
+    { 15, 25, 16, 0, 21, 56, 27094 }, // ξ
+    { 16, 16, 24, 4, 16, 49, 27150 }, // ο
+    { 17, 16, 21, 2, 15, 49, 27199 }, // π
+    { 17, 23, 21, 2, 16, 65, 27248 }, // ρ
+    { 12, 20, 16, 2, 21, 42, 27313 }, // ς
+    { 20, 16, 25, 4, 16, 55, 27355 }, // σ
+    { 15, 16, 19, 2, 15, 35, 27410 }, // τ
+    { 13, 17, 17, 2, 16, 50, 27445 }, // υ
+    { 23, 36, 33, 5, 32, 139, 27495 }, // φ
+    { 20, 22, 24, 2, 16, 71, 27634 }, // χ
+    { 15, 28, 19, 2, 21, 85, 27705 }, // ψ
+    { 22, 16, 24, 1, 15, 66, 27790 }, // ω
+    { 23, 34, 33, 5, 25, 103, 27856 }, // Ạ
+    { 17, 25, 24, 3, 17, 67, 27959 }, // ạ
+    { 23, 37, 33, 5, 37, 110, 28026 }, // Ả
+    { 17, 26, 24, 3, 26, 71, 28136 }, // ả
+    { 23, 41, 33, 5, 41, 123, 28207 }, // Ấ
+    { 18, 32, 24, 3, 32, 87, 28330 }, // ấ
+    { 25, 37, 33, 3, 37, 121, 28417 }, // Ầ
+    { 20, 27, 24, 0, 27, 83, 28538 }, // ầ
+    { 23, 41, 33, 5, 41, 123, 28621 }, // Ẩ
+    { 17, 29, 24, 3, 29, 82, 28744 }, // ẩ
+    { 23, 40, 33, 5, 40, 130, 28826 }, // Ẫ
+    { 17, 30, 24, 3, 30, 92, 28956 }, // ẫ
+    { 23, 43, 33, 5, 34, 126, 29048 }, // Ậ
+    { 17, 32, 24, 3, 24, 85, 29174 }, // ậ
+    { 23, 47, 33, 5, 47, 131, 29259 }, // Ắ
+    { 17, 36, 24, 3, 36, 91, 29390 }, // ắ
+    { 23, 45, 33, 5, 45, 127, 29481 }, // Ằ
+    { 17, 34, 24, 3, 34, 89, 29608 }, // ằ
+    { 23, 47, 33, 5, 47, 132, 29697 }, // Ẳ
+    { 17, 38, 24, 3, 38, 96, 29829 }, // ẳ
+    { 23, 45, 33, 5, 45, 138, 29925 }, // Ẵ
+    { 17, 34, 24, 3, 34, 96, 30063 }, // ẵ
+    { 23, 45, 33, 5, 36, 128, 30159 }, // Ặ
+    { 17, 33, 24, 3, 25, 85, 30287 }, // ặ
+    { 17, 32, 27, 5, 25, 82, 30372 }, // Ẹ
+    { 16, 25, 24, 4, 17, 63, 30454 }, // ẹ
+    { 17, 36, 27, 5, 36, 85, 30517 }, // Ẻ
+    { 16, 30, 24, 4, 30, 70, 30602 }, // ẻ
+    { 17, 34, 27, 5, 34, 92, 30672 }, // Ẽ
+    { 16, 28, 24, 4, 28, 73, 30764 }, // ẽ
+    { 18, 39, 27, 5, 39, 99, 30837 }, // Ế
+    { 19, 30, 24, 4, 30, 82, 30936 }, // ế
+    { 23, 35, 27, -1, 35, 108, 31018 }, // Ề
+    { 19, 30, 24, 1, 30, 82, 31126 }, // ề
+    { 18, 39, 27, 5, 39, 102, 31208 }, // Ể
+    { 16, 34, 24, 4, 34, 84, 31310 }, // ể
+    { 17, 40, 27, 5, 40, 110, 31394 }, // Ễ
+    { 16, 34, 24, 4, 34, 89, 31504 }, // ễ
+    { 17, 40, 27, 5, 33, 99, 31593 }, // Ệ
+    { 16, 36, 24, 4, 28, 85, 31692 }, // ệ
+    { 7, 38, 13, 3, 38, 62, 31777 }, // Ỉ
+    { 6, 27, 13, 4, 27, 33, 31839 }, // ỉ
+    { 7, 33, 13, 3, 25, 57, 31872 }, // Ị
+    { 7, 33, 13, 3, 26, 42, 31929 }, // ị
+    { 23, 34, 33, 5, 25, 109, 31971 }, // Ọ
+    { 16, 25, 24, 4, 16, 63, 32080 }, // ọ
+    { 23, 36, 33, 5, 35, 113, 32143 }, // Ỏ
+    { 16, 29, 24, 4, 29, 68, 32256 }, // ỏ
+    { 29, 34, 35, 5, 33, 136, 32324 }, // Ố
+    { 19, 27, 24, 4, 27, 81, 32460 }, // ố
+    { 25, 36, 33, 3, 35, 129, 32541 }, // Ồ
+    { 20, 30, 24, 0, 30, 89, 32670 }, // ồ
+    { 23, 39, 33, 5, 38, 131, 32759 }, // Ổ
+    { 16, 33, 24, 4, 33, 84, 32890 }, // ổ
+    { 23, 40, 33, 5, 39, 132, 32974 }, // Ỗ
+    { 16, 33, 24, 4, 33, 89, 33106 }, // ỗ
+    { 23, 42, 33, 5, 33, 132, 33195 }, // Ộ
+    { 16, 35, 24, 4, 27, 86, 33327 }, // ộ
+    { 25, 37, 33, 5, 36, 127, 33413 }, // Ớ
+    { 18, 29, 24, 4, 29, 78, 33540 }, // ớ
+    { 25, 35, 33, 5, 34, 125, 33618 }, // Ờ
+    { 18, 27, 24, 4, 27, 75, 33743 }, // ờ
+    { 25, 37, 33, 5, 36, 129, 33818 }, // Ở
+    { 18, 29, 24, 4, 29, 78, 33947 }, // ở
+    { 25, 36, 33, 5, 35, 135, 34025 }, // Ỡ
+    { 18, 27, 24, 4, 27, 80, 34160 }, // ỡ
+    { 25, 36, 33, 5, 27, 124, 34240 }, // Ợ
+    { 18, 27, 24, 4, 18, 75, 34364 }, // ợ
+    { 21, 33, 31, 5, 25, 102, 34439 }, // Ụ
+    { 15, 24, 23, 4, 16, 63, 34541 }, // ụ
+    { 21, 37, 31, 5, 36, 110, 34604 }, // Ủ
+    { 15, 28, 23, 4, 27, 70, 34714 }, // ủ
+    { 23, 38, 31, 5, 37, 118, 34784 }, // Ứ
+    { 18, 28, 23, 4, 27, 74, 34902 }, // ứ
+    { 23, 36, 31, 5, 35, 112, 34976 }, // Ừ
+    { 18, 26, 23, 4, 25, 70, 35088 }, // ừ
+    { 23, 37, 31, 5, 36, 118, 35158 }, // Ử
+    { 18, 28, 23, 4, 27, 77, 35276 }, // ử
+    { 23, 36, 31, 5, 35, 123, 35353 }, // Ữ
+    { 18, 26, 23, 4, 25, 81, 35476 }, // ữ
+    { 23, 37, 31, 5, 29, 116, 35557 }, // Ự
+    { 18, 26, 23, 4, 18, 72, 35673 }, // ự
+    { 21, 34, 31, 5, 34, 89, 35745 }, // Ỳ
+    { 16, 34, 24, 4, 26, 79, 35834 }, // ỳ
+    { 21, 38, 31, 5, 25, 94, 35913 }, // Ỵ
+    { 20, 25, 25, 4, 16, 73, 36007 }, // ỵ
+    { 21, 37, 31, 5, 37, 94, 36080 }, // Ỷ
+    { 16, 37, 24, 4, 29, 83, 36174 }, // ỷ
+    { 21, 35, 31, 5, 35, 100, 36257 }, // Ỹ
+    { 16, 36, 24, 4, 28, 91, 36357 }, // ỹ
+    { 0, 0, 24, 0, 0, 0, 36448 }, //  
+    { 0, 0, 39, 0, 0, 0, 36448 }, //  
+    { 0, 0, 24, 0, 0, 0, 36448 }, //  
+    { 0, 0, 39, 0, 0, 0, 36448 }, //  
+    { 0, 0, 19, 0, 0, 0, 36448 }, //  
+    { 0, 0, 17, 0, 0, 0, 36448 }, //  
+    { 0, 0, 14, 0, 0, 0, 36448 }, //  
+    { 0, 0, 19, 0, 0, 0, 36448 }, //  
+    { 0, 0, 8, 0, 0, 0, 36448 }, //  
+    { 0, 0, 15, 0, 0, 0, 36448 }, //  
+    { 0, 0, 14, 0, 0, 0, 36448 }, //  
+    { 0, 0, 9, 0, 0, 0, 36448 }, // ​
+    { 0, 0, 1, 0, 0, 0, 36448 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 36448 }, // ‍
+    { 0, 0, 1, 0, 0, 0, 36448 }, // ‎
+    { 0, 0, 1, 0, 0, 0, 36448 }, // ‏
+    { 14, 3, 17, 2, 10, 8, 36448 }, // ‐
+    { 14, 3, 17, 2, 10, 8, 36456 }, // ‑
+    { 20, 3, 23, 2, 10, 11, 36464 }, // ‒
+    { 19, 4, 23, 2, 10, 18, 36475 }, // –
+    { 29, 4, 33, 2, 10, 26, 36493 }, // —
+    { 29, 4, 33, 2, 10, 26, 36519 }, // ―
+    { 12, 25, 16, 2, 21, 74, 36545 }, // ‖
+    { 21, 9, 24, 2, -3, 22, 36619 }, // ‗
+    { 8, 9, 10, 1, 25, 13, 36641 }, // ‘
+    { 8, 9, 10, 1, 25, 13, 36654 }, // ’
+    { 8, 10, 10, 1, 5, 14, 36667 }, // ‚
+    { 8, 9, 10, 1, 25, 13, 36681 }, // ‛
+    { 15, 9, 17, 1, 25, 27, 36694 }, // “
+    { 15, 9, 17, 1, 25, 26, 36721 }, // ”
+    { 8, 10, 10, 1, 5, 14, 36747 }, // „
+    { 15, 9, 17, 1, 25, 25, 36761 }, // ‟
+    { 15, 38, 17, 1, 30, 78, 36786 }, // †
+    { 16, 38, 18, 1, 30, 85, 36864 }, // ‡
+    { 17, 17, 17, -1, 20, 53, 36949 }, // •
+    { 8, 9, 11, 2, 13, 16, 37002 }, // ‣
+    { 6, 5, 8, 1, 5, 8, 37018 }, // ․
+    { 6, 5, 8, 1, 5, 8, 37026 }, // ‥
+    { 26, 5, 28, 1, 5, 23, 37034 }, // …
+    { 4, 3, 7, 2, 10, 5, 37057 }, // ‧
+    { 0, 0, 37, 0, 0, 0, 37062 }, //  
+    { 18, 25, 32, 7, 23, 92, 37062 }, // ‰
+    { 8, 9, 10, 1, 25, 13, 37154 }, // ′
+    { 15, 9, 17, 1, 25, 26, 37167 }, // ″
+    { 23, 9, 25, 1, 25, 36, 37193 }, // ‴
+    { 8, 9, 10, 1, 24, 12, 37229 }, // ‵
+    { 14, 9, 15, 0, 24, 24, 37241 }, // ‶
+    { 23, 9, 25, 1, 25, 35, 37265 }, // ‷
+    { 12, 5, 16, 2, 23, 12, 37300 }, // ‸
+    { 8, 14, 12, 2, 15, 18, 37312 }, // ‹
+    { 8, 14, 12, 2, 15, 18, 37330 }, // ›
+    { 30, 29, 39, 6, 26, 131, 37348 }, // ※
+    { 7, 29, 10, 1, 29, 39, 37479 }, // ‼
+    { 16, 37, 22, 2, 35, 93, 37518 }, // ‽
+    { 14, 4, 17, 2, 24, 8, 37611 }, // ‾
+    { 12, 6, 16, 2, 20, 16, 37619 }, // ‿
+    { 19, 18, 23, 2, 25, 78, 37635 }, // ⁂
+    { 17, 24, 32, 8, 22, 49, 37713 }, // ⁄
+    { 33, 33, 37, 2, 33, 145, 37762 }, // ⁇
+    { 22, 33, 29, 2, 33, 117, 37907 }, // ⁈
+    { 22, 35, 24, 1, 33, 105, 38024 }, // ⁉
+    { 17, 46, 22, 2, 32, 102, 38129 }, // ⁒
+    { 0, 0, 141, 0, 0, 0, 38231 }, //  
+    { 8, 11, 10, 1, 24, 32, 38231 }, // ⁰
+    { 8, 11, 10, 1, 24, 21, 38263 }, // ⁴
+    { 8, 12, 10, 1, 25, 24, 38284 }, // ⁵
+    { 8, 11, 10, 1, 24, 25, 38308 }, // ⁶
+    { 8, 13, 10, 1, 25, 18, 38333 }, // ⁷
+    { 9, 11, 10, 0, 24, 29, 38351 }, // ⁸
+    { 8, 11, 10, 1, 24, 30, 38380 }, // ⁹
+    { 16, 17, 24, 4, 17, 56, 38410 }, // ⁿ
+    { 11, 15, 13, 1, 15, 49, 38466 }, // ₀
+    { 7, 12, 9, 1, 7, 18, 38515 }, // ₁
+    { 8, 12, 10, 1, 7, 20, 38533 }, // ₂
+    { 8, 11, 10, 1, 6, 20, 38553 }, // ₃
+    { 8, 11, 10, 1, 6, 22, 38573 }, // ₄
+    { 7, 12, 9, 1, 7, 18, 38595 }, // ₅
+    { 8, 12, 10, 1, 7, 24, 38613 }, // ₆
+    { 8, 12, 10, 1, 7, 18, 38637 }, // ₇
+    { 9, 11, 10, 0, 6, 28, 38655 }, // ₈
+    { 8, 11, 10, 1, 6, 27, 38683 }, // ₉
+    { 10, 39, 13, 2, 29, 55, 38710 }, // ₍
+    { 9, 39, 13, 1, 29, 59, 38765 }, // ₎
+    { 20, 37, 29, 4, 31, 138, 38824 }, // ₡
+    { 20, 27, 29, 4, 26, 87, 38962 }, // ₢
+    { 18, 28, 20, 1, 28, 72, 39049 }, // ₤
+    { 28, 25, 31, 2, 25, 113, 39121 }, // ₦
+    { 23, 25, 27, 1, 25, 79, 39234 }, // ₧
+    { 29, 24, 34, 4, 24, 117, 39313 }, // ₨
+    { 22, 24, 25, 1, 24, 100, 39430 }, // ₩
+    { 23, 23, 31, 4, 23, 113, 39530 }, // ₪
+    { 19, 23, 22, 2, 23, 79, 39643 }, // ₫
+    { 18, 26, 22, 2, 23, 65, 39722 }, // €
+    { 21, 25, 31, 5, 25, 76, 39787 }, // ₮
+    { 26, 25, 27, 0, 25, 80, 39863 }, // ₱
+    { 23, 34, 33, 5, 30, 128, 39943 }, // ₲
+    { 26, 27, 29, 2, 26, 91, 40071 }, // ₴
+    { 14, 22, 22, 4, 20, 59, 40162 }, // ₵
+    { 21, 26, 31, 5, 26, 76, 40221 }, // ₸
+    { 14, 22, 18, 2, 22, 47, 40297 }, // ₹
+    { 16, 21, 20, 2, 20, 66, 40344 }, // ₺
+    { 18, 23, 19, 0, 23, 87, 40410 }, // ₼
+    { 23, 25, 27, -1, 25, 80, 40497 }, // ₽
+    { 18, 18, 22, 2, 16, 39, 40577 }, // ←
+    { 18, 18, 22, 2, 18, 49, 40616 }, // ↑
+    { 18, 18, 22, 2, 16, 39, 40665 }, // →
+    { 18, 18, 22, 2, 18, 50, 40704 }, // ↓
+    { 22, 16, 26, 2, 16, 54, 40754 }, // ↔
+    { 15, 23, 19, 2, 23, 68, 40808 }, // ↕
+    { 15, 14, 19, 2, 15, 42, 40876 }, // ↖
+    { 15, 14, 19, 2, 15, 44, 40918 }, // ↗
+    { 15, 15, 19, 2, 16, 38, 40962 }, // ↘
+    { 15, 15, 19, 2, 16, 39, 41000 }, // ↙
+    { 21, 19, 25, 2, 18, 58, 41039 }, // ⇐
+    { 23, 21, 27, 2, 21, 89, 41097 }, // ⇑
+    { 21, 19, 25, 2, 18, 56, 41186 }, // ⇒
+    { 23, 22, 27, 2, 21, 92, 41242 }, // ⇓
+    { 24, 19, 28, 2, 18, 73, 41334 }, // ⇔
+    { 19, 24, 23, 2, 16, 87, 41407 }, // ⇕
+    { 16, 23, 20, 2, 23, 67, 41494 }, // ∂
+    { 29, 28, 33, 2, 26, 124, 41561 }, // ∅
+    { 21, 22, 25, 2, 22, 68, 41685 }, // ∆
+    { 18, 21, 22, 2, 21, 62, 41753 }, // ∏
+    { 18, 21, 22, 2, 21, 65, 41815 }, // ∐
+    { 14, 22, 17, 2, 21, 49, 41880 }, // ∑
+    { 14, 4, 18, 2, 10, 9, 41929 }, // −
+    { 23, 25, 27, 2, 23, 70, 41938 }, // √
+    { 23, 15, 27, 2, 18, 72, 42008 }, // ∞
+    { 24, 33, 26, 1, 26, 87, 42080 }, // ∫
+    { 6, 18, 8, 1, 18, 19, 42167 }, // ∶
+    { 17, 15, 23, 3, 16, 51, 42186 }, // ≈
+    { 19, 24, 32, 7, 22, 59, 42237 }, // ≠
+    { 21, 22, 25, 2, 20, 71, 42296 }, // ≤
+    { 21, 22, 25, 2, 20, 70, 42367 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_14_regularIntervals[] = {
@@ -5016,4 +3397,5 @@ static const EpdFontData opendyslexic_14_regular = {
     38,
     -16,
     true,
+    true,
 };
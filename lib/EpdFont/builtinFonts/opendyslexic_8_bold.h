@@ -2,2381 +2,1989 @@
  * generated by fontconvert.py
  * name: opendyslexic_8_bold
  * size: 8
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_8_bold 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py opendyslexic_8_bold 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_boldBitmaps[27258] = {
-    0x00, 0x03, 0x00, 0xF0, 0x3C, 0x0F, 0x03, 0xC1, 0xF0, 0x7C, 0x1F, 0x0B, 0xC2, 0xF0, 0x7C, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF5, 0xFE, 0xBF, 0x9A, 0x90, 0x2A, 0x86, 0xA4, 0xFF,
-    0x1F, 0xD3, 0xF4, 0x7F, 0x0F, 0xD1, 0xFC, 0x3F, 0x47, 0xF0, 0xFE, 0x2F, 0xC0, 0x00, 0x0B, 0x82,
-    0xE0, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0xF4, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x57, 0xF5, 0xBD, 0x54, 0x00, 0x0F,
-    0xC2, 0xF0, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x05, 0x6F, 0x9B, 0xE5, 0x50, 0x00, 0xBE, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0xBD, 0x00, 0x00,
-    0x0A, 0x91, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x06, 0xF9, 0x40, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xBE, 0x7C, 0x00, 0x02,
-    0xF5, 0xF0, 0x00, 0x0B, 0xFB, 0xC0, 0x00, 0x0F, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x07, 0x9F, 0xF0, 0x0E, 0x1E, 0x1F, 0xC0, 0xFF, 0xFE, 0xFF, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xF0, 0x2F, 0x80, 0x2E, 0x0B, 0x1D, 0x03, 0xC0, 0xE0, 0xE0,
-    0xF4, 0x0B, 0x0E, 0x1F, 0x00, 0x7F, 0xD3, 0xD0, 0x02, 0xF4, 0xBC, 0x00, 0x00, 0x1F, 0x2F, 0x80,
-    0x03, 0xE7, 0x4D, 0x00, 0x7C, 0xB0, 0xE0, 0x0F, 0x8B, 0x0E, 0x02, 0xF0, 0x7F, 0xD0, 0x7D, 0x01,
-    0xF8, 0x0A, 0x80, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x7D, 0x7D, 0x00, 0xB0, 0x0F, 0x00, 0xB0, 0x0F,
-    0x00, 0xBC, 0x2F, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xF0, 0x14, 0xBC, 0xBC, 0x3D,
-    0xFC, 0x1F, 0xBD, 0xFD, 0x07, 0xFC, 0xBF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x0B, 0xF9, 0x00, 0x3F,
-    0xC3, 0xF8, 0x3F, 0x43, 0xF4, 0x3F, 0x42, 0xA0, 0x00, 0xF0, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x1F,
-    0x00, 0xFC, 0x03, 0xD0, 0x1F, 0x00, 0xBC, 0x02, 0xF0, 0x0F, 0x80, 0x3E, 0x00, 0xFC, 0x03, 0xF0,
-    0x0B, 0xC0, 0x1F, 0x40, 0x3E, 0x00, 0xFC, 0x02, 0xF8, 0x03, 0xF0, 0x0B, 0xE0, 0x0F, 0xC0, 0x1A,
-    0x40, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x00,
-    0xF8, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xFC, 0x00,
-    0xF8, 0x01, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x0B, 0xD0, 0x1F, 0xC0, 0x3F, 0x40, 0x6A, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x18, 0xF1, 0xC3, 0xFF, 0xFD, 0x1B, 0xFE, 0x00, 0x7F, 0xF4, 0x3F, 0xFF,
-    0xE1, 0xDB, 0x5C, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00,
-    0x0B, 0x80, 0x3F, 0xFF, 0xD3, 0xFF, 0xFD, 0x00, 0xF8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x01,
-    0x00, 0x2A, 0x83, 0xFC, 0x3F, 0x83, 0xF4, 0x7F, 0x0F, 0xE0, 0xBF, 0xFF, 0xEF, 0xFF, 0xF0, 0x29,
-    0x3E, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00,
-    0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x34, 0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xFA, 0xF4, 0x2E,
-    0x07, 0xC3, 0xD0, 0x3C, 0x7C, 0xF3, 0xD7, 0xCF, 0x7E, 0xBC, 0xF7, 0xEB, 0xCF, 0x3E, 0x7D, 0x07,
-    0xE7, 0xF0, 0xFD, 0x3F, 0xFF, 0xC2, 0xFF, 0xFC, 0x0F, 0xFF, 0x00, 0x2F, 0x80, 0x01, 0x90, 0x07,
-    0xF8, 0x03, 0xFE, 0x00, 0xDF, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03,
-    0xE0, 0x00, 0xF8, 0x07, 0xFF, 0xF2, 0xFF, 0xFD, 0xBF, 0xFF, 0x40, 0x1B, 0xF8, 0x03, 0xFF, 0xF0,
-    0x7E, 0x6F, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x07,
-    0xFD, 0x01, 0xFF, 0x80, 0x3F, 0xFF, 0xC7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD0, 0x1B, 0xF8, 0x03, 0xFF,
-    0xF4, 0x10, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x7F, 0xF4, 0x0B, 0xFF, 0x40, 0x01, 0xFC,
-    0x00, 0x07, 0xD2, 0x95, 0xFD, 0x3F, 0xFF, 0xC7, 0xFF, 0xF8, 0x2F, 0xFD, 0x00, 0x00, 0x0F, 0x00,
-    0x03, 0xF0, 0x00, 0xBF, 0x00, 0x1F, 0xF0, 0x03, 0xDF, 0x00, 0xB4, 0xF4, 0x1F, 0x0F, 0x43, 0xEA,
-    0xFE, 0xBF, 0xFF, 0xF6, 0xAB, 0xFF, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xF4, 0x3F, 0xFF, 0x43, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3F,
-    0xF8, 0x07, 0xFF, 0xF4, 0x14, 0x1F, 0xC0, 0x00, 0xBC, 0x24, 0x1F, 0xC3, 0xFF, 0xFC, 0x7F, 0xFF,
-    0x47, 0xFF, 0xD0, 0x01, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xFC, 0x2F, 0x55, 0x43, 0xC0, 0x00,
-    0x7D, 0xFD, 0x07, 0xFF, 0xF8, 0xBF, 0x5F, 0xCB, 0xD0, 0x3E, 0xBD, 0x03, 0xE7, 0xE0, 0x3E, 0x3F,
-    0xEF, 0xD1, 0xFF, 0xFC, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0xBF, 0xFF, 0xC0, 0x00,
-    0xFC, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xF0,
-    0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x01, 0xA8, 0x00, 0x3F, 0xFD, 0x02, 0xF0, 0xBC,
-    0x0F, 0x40, 0xF4, 0x3F, 0x0B, 0xC0, 0x7F, 0xFE, 0x00, 0x7F, 0xF4, 0x0F, 0xD6, 0xF4, 0x7D, 0x03,
-    0xF2, 0xF0, 0x0F, 0xC7, 0xE0, 0x7F, 0x0F, 0xFF, 0xF8, 0x2F, 0xFF, 0xC0, 0x0B, 0xE4, 0x00, 0x07,
-    0xF8, 0x02, 0xFF, 0xF4, 0x3C, 0x0B, 0xC7, 0x40, 0x3D, 0xB4, 0x03, 0xD7, 0x80, 0x3E, 0x3E, 0x6F,
-    0xE2, 0xFF, 0xFE, 0x06, 0xFF, 0xE0, 0x00, 0x3D, 0x3E, 0xAF, 0xC3, 0xFF, 0xF8, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF1, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xC7, 0xF2,
-    0xFC, 0x00, 0x01, 0xF8, 0x2F, 0x83, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x42, 0xFC,
-    0x2F, 0xC2, 0xF8, 0x3F, 0x47, 0xF0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xF8, 0x00,
-    0x01, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x02, 0xFF, 0x90, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00,
-    0x01, 0xFF, 0xFF, 0x90, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x02, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x55, 0x42, 0xFF, 0xFC, 0x3F, 0xFE,
-    0x80, 0x14, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x07, 0xFF, 0x40, 0x6F, 0xFF, 0xF8, 0x3F, 0xFF, 0x90,
-    0x03, 0xFE, 0x40, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x01, 0xFF, 0xFC,
-    0x0F, 0xD1, 0xF8, 0x18, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x03,
-    0xF0, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x09,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xBD, 0x02, 0xE0, 0x02, 0xE0,
-    0x00, 0x34, 0x03, 0xC3, 0xFC, 0x2C, 0x0B, 0x4A, 0x2C, 0x1C, 0x0F, 0x4C, 0x1C, 0x1C, 0x0F, 0x8F,
-    0xFC, 0x38, 0x0F, 0xC3, 0xEF, 0xF0, 0x0B, 0xE0, 0x06, 0x40, 0x03, 0xFD, 0x01, 0x40, 0x01, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x06, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00,
-    0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x7F,
-    0xFE, 0x00, 0x7F, 0xFF, 0xC0, 0x7E, 0x07, 0xF0, 0x7D, 0x01, 0xF0, 0x7D, 0x01, 0xF0, 0x7E, 0x5B,
-    0xE0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xF4, 0x7D, 0x01, 0xFC, 0x7D, 0x00, 0xFC, 0x7F, 0xAB, 0xFC,
-    0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01,
-    0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F, 0xF4, 0x04, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40,
-    0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xE0, 0x05, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD,
-    0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x7F, 0xFE, 0x80, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xE1,
-    0xF8, 0x02, 0xFC, 0x7E, 0x00, 0x2F, 0x5F, 0x80, 0x03, 0xE7, 0xE0, 0x00, 0xF9, 0xF8, 0x00, 0x3F,
-    0x7E, 0x00, 0x0F, 0x9F, 0x80, 0x6F, 0xE7, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xF8, 0x00, 0x2B, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFA, 0x55, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0xFD, 0x68, 0x03, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xFA, 0xAA, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF5, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xD2, 0xFF, 0xFD,
-    0x2F, 0x95, 0x42, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0xF8, 0x3F, 0xFF, 0x83, 0xFF, 0xF4, 0x3F,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1A,
-    0xA9, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF8, 0x0B, 0xF9, 0x00, 0x50, 0x3F, 0xC0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x3A, 0x50, 0x7F, 0x00, 0xFF, 0xF0,
-    0xFD, 0x01, 0xBF, 0xD3, 0xFC, 0x00, 0x7E, 0x0B, 0xFE, 0xAB, 0xF4, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFF, 0x40, 0x06, 0xFF, 0x90, 0x00, 0x3F, 0x00, 0x2F, 0x0F, 0xC0, 0x0B, 0xD3, 0xF0, 0x02,
-    0xF4, 0xFC, 0x00, 0xBD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFE, 0xAA,
-    0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8, 0xFD, 0x00, 0xFE, 0x7F, 0x40,
-    0x3F, 0x9F, 0xD0, 0x0F, 0xF0, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F,
-    0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x1F, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0,
-    0x00, 0x2F, 0x40, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x50, 0x7F, 0x03, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xD0, 0x3F, 0xFD, 0x00, 0x05, 0x40, 0x00, 0x0F, 0xC3, 0xF8, 0x03, 0xF1, 0xFC, 0x00,
-    0xF8, 0xFD, 0x00, 0x3E, 0x7F, 0x00, 0x1F, 0xBF, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00,
-    0xBF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0xFC, 0xFF, 0xC0,
-    0x3F, 0x0F, 0xFC, 0x1F, 0xC1, 0xFF, 0xD0, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x15, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF5, 0xFF, 0xFF, 0xD0, 0x3F, 0xC0,
-    0x07, 0xF0, 0xFF, 0x40, 0x3F, 0xC3, 0xFE, 0x00, 0xFF, 0x0F, 0xFC, 0x0B, 0xFD, 0x3F, 0xF8, 0x3F,
-    0xF4, 0xFF, 0xF1, 0xFF, 0xD3, 0xFF, 0xDF, 0xFF, 0x4F, 0xEF, 0xFF, 0xBD, 0x3F, 0x3F, 0xFA, 0xF4,
-    0xFC, 0xFF, 0xDF, 0xE3, 0xF1, 0xFF, 0x3F, 0x8F, 0xC3, 0xF8, 0xFE, 0x7F, 0x0F, 0xD3, 0xF9, 0xFD,
-    0x05, 0x0F, 0xE0, 0x05, 0x40, 0x0F, 0x87, 0xF0, 0x03, 0xD1, 0xFE, 0x01, 0xF4, 0x7F, 0xC0, 0x7D,
-    0x2F, 0xF8, 0x1F, 0x4B, 0xFF, 0x07, 0xD2, 0xFB, 0xE2, 0xF0, 0xFE, 0xBC, 0xBC, 0x3F, 0x9F, 0xAF,
-    0x0F, 0xE3, 0xFF, 0xC3, 0xF8, 0x7F, 0xF0, 0xFE, 0x0F, 0xFC, 0x3F, 0xC2, 0xFF, 0x1F, 0xF0, 0x3F,
-    0xC0, 0x00, 0x6F, 0xE4, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0x9B, 0xF8, 0x07, 0xF0, 0x03, 0xF4,
-    0x3F, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0xFC, 0x3F,
-    0x00, 0x03, 0xF0, 0xFF, 0x40, 0x7F, 0xC3, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xFF, 0x80, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x02,
-    0xFF, 0xFD, 0x0B, 0xC0, 0xBC, 0x2F, 0x00, 0xF4, 0xFC, 0x07, 0xD3, 0xFF, 0xFF, 0x4F, 0xFF, 0xFC,
-    0x3F, 0xFF, 0x80, 0xFE, 0x90, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x0F, 0xE0, 0x7F, 0x80, 0x2F, 0x80, 0x0F, 0xC0, 0x3F, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x03, 0xE0,
-    0x7E, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x03, 0xF0, 0x3F, 0x01, 0x03, 0xE0, 0x3F, 0x43, 0xEB, 0xD0,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x2F,
-    0xFF, 0xC0, 0x2E, 0x02, 0xE0, 0x2E, 0x01, 0xF0, 0x2E, 0x01, 0xF0, 0x3E, 0x03, 0xF0, 0x3F, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xD0, 0x3F, 0x43, 0xF0, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF8,
-    0x3F, 0x43, 0xFC, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x1F, 0xFF, 0xC0,
-    0x03, 0xFF, 0xF4, 0x00, 0xBE, 0x01, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF9,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xC0,
-    0xB8, 0x02, 0xFC, 0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0x0A, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F,
-    0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x7F,
-    0x40, 0x3F, 0x9F, 0xD0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F,
-    0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x3F, 0x00, 0x3F, 0x0F, 0xD0, 0x1F, 0xC3,
-    0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x1F, 0x82, 0xF8, 0x00, 0xFD, 0x03, 0xF0, 0x03, 0xF0, 0x0F,
-    0xD0, 0x2F, 0x80, 0x2F, 0xC0, 0xFD, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0xFE, 0x3F, 0x80, 0x02, 0xFE,
-    0xFD, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x3F,
-    0x40, 0x00, 0x02, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x14, 0x03, 0xF0, 0x1F, 0xC0,
-    0xBD, 0x07, 0xF0, 0x0F, 0xD0, 0xFF, 0x0B, 0xE0, 0x0F, 0xE2, 0xFF, 0x4F, 0xD0, 0x0B, 0xF3, 0xFF,
-    0xCF, 0xC0, 0x07, 0xFB, 0xFF, 0xEF, 0xC0, 0x07, 0xFF, 0xEB, 0xFF, 0x80, 0x03, 0xFF, 0xD7, 0xFF,
-    0x40, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x02, 0xFF, 0x82, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00,
-    0x1F, 0x80, 0x0B, 0xC0, 0xFC, 0x00, 0xF8, 0x07, 0xF0, 0x3F, 0x00, 0x2F, 0x4B, 0xD0, 0x00, 0xFD,
-    0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x0F, 0xFF, 0x80, 0x02, 0xFE, 0xFD, 0x00, 0x7F, 0x4F, 0xF0, 0x0F, 0xF0, 0x3F, 0xC3, 0xFC, 0x02,
-    0xFE, 0x3F, 0x00, 0x0F, 0xC2, 0xF4, 0x02, 0xF8, 0x0F, 0xC0, 0x3F, 0x00, 0xBE, 0x0B, 0xE0, 0x03,
-    0xF0, 0xFC, 0x00, 0x2F, 0xAF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xF8,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0xAA, 0x07, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0x87,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFC, 0x3F, 0xF0, 0xF4, 0x03, 0xD0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07,
-    0xC0, 0x1F, 0x00, 0x7C, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0F, 0x80, 0x3E,
-    0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3D, 0x00, 0xFF, 0xD3, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x0F,
-    0x80, 0x0B, 0xC0, 0x03, 0xD0, 0x03, 0xE0, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0xBC, 0x00,
-    0x74, 0x00, 0x30, 0x00, 0x10, 0x3F, 0xF0, 0xFF, 0xC0, 0x2F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0,
-    0x1F, 0x00, 0x3C, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xE0, 0x0F, 0x80,
-    0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0B, 0x80, 0x2F, 0x00, 0xBC, 0x7F, 0xF1, 0xFF, 0xC7, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xFC, 0x00, 0xFB, 0xF0, 0x3D, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF4, 0x55, 0x55, 0x54, 0x7D, 0x00, 0x7E, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x1F, 0xFF, 0xC3, 0xD0, 0xFC, 0x38, 0x07, 0xC7, 0x40,
-    0x3C, 0x74, 0x07, 0xD3, 0xFF, 0xFD, 0x2F, 0xFF, 0xE0, 0xBF, 0x7E, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF1, 0x90, 0x03, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xF0, 0x3F, 0x42, 0xE0, 0xFC, 0x03, 0xC3, 0xF0, 0x0F, 0x0B, 0xC0, 0xBC, 0x2F, 0xFF, 0xE0, 0x7F,
-    0xFF, 0x00, 0xBF, 0xF0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x41, 0xFF, 0xE0, 0xFD, 0x00,
-    0x3C, 0x00, 0x1F, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x60, 0x1F, 0xFF, 0x01, 0xBF, 0x80, 0x00, 0x00,
-    0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x0B, 0xEB, 0xC0, 0xFF,
-    0xFF, 0x0F, 0xDB, 0xFC, 0x3C, 0x07, 0xF1, 0xE0, 0x1F, 0x87, 0xD0, 0xBE, 0x0F, 0xFF, 0xF8, 0x1F,
-    0xFF, 0xF0, 0x1B, 0xEB, 0xC0, 0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E,
-    0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xE0,
-    0xBF, 0x83, 0xD0, 0x0F, 0x01, 0xFF, 0xF7, 0xFF, 0xC7, 0xE5, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x07,
-    0xE0, 0x1F, 0x80, 0x7E, 0x00, 0x06, 0xF6, 0xF1, 0xFF, 0xFE, 0x3D, 0x1F, 0xE7, 0x80, 0xBE, 0x74,
-    0x07, 0xE7, 0x80, 0xBE, 0x3F, 0xFF, 0xD2, 0xFF, 0xFD, 0x0B, 0xFF, 0xD0, 0x04, 0x3C, 0x00, 0x0B,
-    0xC2, 0xFB, 0xF8, 0x3F, 0xFF, 0x02, 0xFF, 0x80, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xFE, 0xFD, 0x03, 0xFF, 0xFC, 0x0F, 0xD1, 0xF4, 0x3E, 0x01,
-    0xE0, 0xF8, 0x07, 0xC3, 0xE0, 0x2F, 0x1F, 0x80, 0xBC, 0x7F, 0x03, 0xF1, 0xFC, 0x0F, 0xC0, 0x7D,
-    0xBD, 0xBE, 0xA9, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x7C, 0x7D, 0x7D, 0x00, 0xA0,
-    0x07, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80,
-    0x2E, 0x00, 0xB4, 0x02, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x3F, 0xC0, 0xFF, 0x07, 0xF4, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF4,
-    0xA4, 0x03, 0xDF, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x1F,
-    0xFF, 0x80, 0x7D, 0xBF, 0x81, 0xF4, 0xBF, 0xC0, 0x2E, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03,
-    0xC0, 0x3C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xD4, 0x7F, 0xC7, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xBE, 0x4B, 0xE0, 0x1F, 0xFF, 0xEF, 0xF8, 0x2F, 0x83, 0xF8, 0x7D, 0x2F, 0x02, 0xF4,
-    0x3E, 0x3F, 0x02, 0xF0, 0x3E, 0x3F, 0x03, 0xF0, 0x3F, 0x3F, 0x03, 0xF0, 0x3F, 0x7E, 0x07, 0xE0,
-    0x3F, 0x7E, 0x0B, 0xD0, 0x3F, 0x00, 0x00, 0x03, 0xEF, 0xE0, 0x3F, 0xFF, 0xC3, 0xF4, 0x7D, 0x3D,
-    0x03, 0xD3, 0xD0, 0x3E, 0x3D, 0x03, 0xE7, 0xE0, 0x3F, 0x7E, 0x03, 0xF7, 0xF0, 0x3F, 0x02, 0xFD,
-    0x01, 0xFF, 0xF8, 0x3E, 0x07, 0xD7, 0xC0, 0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F, 0xFF, 0xD1,
-    0xFF, 0xF8, 0x02, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x1F, 0xBF, 0xC0, 0x0F, 0xFA, 0xF0, 0x0F, 0xD0,
-    0x38, 0x0F, 0xC0, 0x3C, 0x0F, 0xC0, 0x3C, 0x0F, 0xD0, 0x3C, 0x0F, 0xFE, 0xFC, 0x1F, 0xFF, 0xF4,
-    0x1F, 0xFF, 0xD0, 0x2F, 0x05, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x69,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xF0, 0x1F, 0xFF, 0xE0, 0x3C, 0x0F, 0xE0, 0x78, 0x0B,
-    0xD0, 0x74, 0x07, 0xD0, 0x7C, 0x0B, 0xC0, 0x3F, 0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x0B, 0xFF, 0xC1,
-    0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xF9, 0x00, 0x02, 0x40, 0x2F, 0xBC, 0x2F, 0xFD,
-    0x2F, 0xD4, 0x2F, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x0F, 0xAB, 0x00, 0xF0, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xE0,
-    0xFE, 0xFE, 0x3F, 0xFF, 0xC1, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3E,
-    0x00, 0x0F, 0x80, 0x3F, 0xFF, 0x0F, 0xFF, 0xD0, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4,
-    0x00, 0x3E, 0xA0, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x78, 0x03, 0xD7, 0xC0, 0x3D, 0x7C,
-    0x03, 0xD3, 0xC0, 0x3E, 0x3C, 0x07, 0xE3, 0xD0, 0xBE, 0x3F, 0xFF, 0xE2, 0xFF, 0xFE, 0x0B, 0xFB,
-    0xE0, 0x3D, 0x00, 0x3E, 0x2F, 0x00, 0x7C, 0x1F, 0x40, 0xF8, 0x0F, 0xC2, 0xF0, 0x07, 0xE3, 0xE0,
-    0x03, 0xFB, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x40, 0x7D, 0x00, 0x03, 0xF3,
-    0xE0, 0x00, 0x3E, 0x3F, 0x0B, 0x07, 0xD2, 0xF1, 0xFC, 0xBC, 0x1F, 0x7F, 0xDF, 0xC0, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF0, 0x03, 0xF8, 0xFE, 0x00, 0x3F, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x03, 0xE2, 0xF0, 0x01, 0xFF, 0xD0, 0x00, 0xBF, 0x80, 0x00,
-    0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0xFB, 0xF0, 0x0F, 0xD3, 0xF8, 0x3F, 0x80, 0xFD, 0x3D, 0x00,
-    0xF8, 0xBC, 0x03, 0xD0, 0xF8, 0x1F, 0x02, 0xF4, 0xF8, 0x03, 0xF3, 0xD0, 0x0B, 0xFF, 0x00, 0x0F,
-    0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0x00, 0x2F,
-    0xF4, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x0F, 0xC0,
-    0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFE, 0x54, 0x0F, 0xFF, 0xF4, 0x7F, 0xFF, 0xF0, 0x00, 0xBF,
-    0x40, 0xBF, 0xD0, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0xFF, 0x00,
-    0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7F, 0xE0,
-    0x0F, 0xF8, 0x00, 0x59, 0x00, 0x02, 0xEB, 0x6D, 0xB6, 0xDB, 0x6D, 0xF7, 0xDF, 0x3C, 0xF3, 0xCF,
-    0x3C, 0x3F, 0x80, 0x0F, 0xFC, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x0F,
-    0x80, 0x03, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xD0, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x0A, 0x40, 0x00, 0x1F, 0x2C, 0xFE, 0xB3, 0x9F, 0x85, 0x14, 0x2A,
-    0x83, 0xFC, 0x3F, 0xC2, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x0F, 0x41,
-    0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF8, 0x0F, 0x80, 0xB8, 0x0B, 0x80, 0xB4, 0x06, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x1C, 0x00, 0x0B, 0x00, 0x0B, 0xF4, 0x1F, 0xFE, 0x0F, 0xAC, 0x07, 0xCB, 0x01,
-    0xF2, 0xC0, 0x7D, 0xB0, 0x0F, 0xFD, 0x02, 0xFF, 0xE0, 0x1F, 0xF8, 0x00, 0xE0, 0x00, 0x38, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x00, 0x0B, 0xFF, 0xD0, 0x0F, 0x01, 0x90, 0x0F, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x02, 0xE0, 0x00,
-    0x02, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0x90, 0x3F, 0xFF, 0xF4, 0x2A, 0xAA, 0xA4, 0x00,
-    0x00, 0x00, 0x24, 0x0B, 0x02, 0xFF, 0xFF, 0x07, 0xFF, 0xF4, 0x0F, 0x8B, 0xC0, 0x3E, 0x1F, 0x40,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x20, 0x02, 0x00, 0x3E, 0x00, 0x3F, 0x0B, 0xE0,
-    0x3F, 0x00, 0xFE, 0x3F, 0x40, 0x0F, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x07,
-    0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x2F,
-    0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0xF3, 0xCF, 0x3C, 0x40, 0x00, 0x28, 0xE3, 0x8E, 0x38, 0xE1, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0xC1,
-    0xD0, 0x60, 0x7E, 0x40, 0x0F, 0xFD, 0x0B, 0xEF, 0xC3, 0xC0, 0xF4, 0xFF, 0xFD, 0x2F, 0xFF, 0x01,
-    0xFF, 0x80, 0x02, 0xF4, 0xE0, 0x3D, 0xBF, 0xFF, 0x0B, 0xFE, 0x00, 0x29, 0x1A, 0x0F, 0x8B, 0xC7,
-    0xF3, 0xF6, 0xFC, 0xFD, 0x1F, 0xD0, 0x79, 0xB4, 0xF6, 0x6C, 0xDC, 0x1C, 0xFB, 0x6C, 0x7E, 0xB4,
-    0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x24, 0xD3, 0x09, 0x3A, 0xE1, 0xFA, 0x00, 0x00, 0x00, 0x20, 0x20,
-    0x2C, 0x38, 0x3E, 0x7D, 0x3E, 0x7D, 0x2F, 0x3E, 0x07, 0xFB, 0xE0, 0x7E, 0xBD, 0x07, 0x8B, 0x40,
-    0x50, 0x40, 0x3F, 0xA9, 0x43, 0xFF, 0xFC, 0x16, 0xAF, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x00,
-    0x68, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x1F, 0xD0, 0x7F, 0xF4, 0xE8, 0xAC, 0xDF, 0x9C, 0xFC, 0xEC,
-    0x7E, 0xF4, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xFD, 0x2A, 0xA5, 0x00, 0x00, 0x1F, 0xD0, 0x7F, 0xF4,
-    0xF8, 0x7C, 0xF4, 0x3C, 0xFE, 0xFC, 0x7F, 0xF4, 0x1F, 0xD0, 0x00, 0x64, 0x00, 0x0B, 0x80, 0x00,
-    0xB8, 0x03, 0xFF, 0xFD, 0x2A, 0xFE, 0x90, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xC3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2E, 0x04, 0xD0, 0x34, 0x2C, 0x2D, 0x0F, 0xE1, 0x50, 0x2E,
-    0x00, 0x60, 0x18, 0x7D, 0x02, 0xCF, 0xE1, 0x90, 0x05, 0x03, 0x82, 0xD0, 0xF0, 0x2E, 0x00, 0xF4,
-    0xFC, 0x03, 0xD3, 0xF0, 0x0F, 0x4F, 0xC0, 0x3E, 0x3F, 0x01, 0xF8, 0xFD, 0x0B, 0xE3, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xFE, 0x3E, 0xFE, 0xF8, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0B, 0xF3, 0xC2, 0xFF,
-    0x3C, 0x3F, 0xF3, 0xD7, 0xFE, 0x3D, 0x3F, 0xE3, 0xD1, 0xFE, 0x3D, 0x07, 0xE3, 0xD0, 0xBD, 0x3D,
-    0x0F, 0xD3, 0xD0, 0xFD, 0x3D, 0x0F, 0xC3, 0xD1, 0xFC, 0x2D, 0x2F, 0xC2, 0xD3, 0xFC, 0x2D, 0x15,
-    0x40, 0x40, 0x3E, 0x7E, 0x7F, 0x6A, 0x04, 0x0B, 0x03, 0xF0, 0x9E, 0x3F, 0x4A, 0x40, 0x18, 0x0F,
-    0x00, 0xC0, 0x30, 0x0C, 0x1F, 0xD1, 0x50, 0x00, 0x00, 0xF8, 0x38, 0xE3, 0x4A, 0x3F, 0xE0, 0xF8,
-    0x00, 0x00, 0x01, 0x05, 0x00, 0x38, 0x74, 0x03, 0xF7, 0xE0, 0x0B, 0xDF, 0x80, 0x3E, 0x7D, 0x0F,
-    0xEF, 0xC3, 0xF7, 0xF0, 0x2C, 0x3C, 0x01, 0x02, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x02,
-    0xD0, 0x2B, 0x40, 0x07, 0xC0, 0x07, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x2E, 0x00, 0x0B, 0x40, 0x3C,
-    0x00, 0x0B, 0x40, 0xB8, 0x00, 0x3F, 0xF1, 0xF0, 0xB0, 0x3F, 0xF3, 0xE1, 0xF4, 0x00, 0x07, 0xC3,
-    0xB4, 0x00, 0x0F, 0x4E, 0x74, 0x00, 0x2F, 0x2E, 0xB9, 0x00, 0x7D, 0x3F, 0xFD, 0x00, 0xFC, 0x00,
-    0x78, 0x01, 0xF4, 0x00, 0xB8, 0x01, 0x50, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x05, 0x00, 0x2B, 0x40, 0x03, 0xD0, 0x00, 0x74, 0x00, 0x78, 0x00, 0x07, 0x40, 0x0F, 0x00, 0x00,
-    0xB4, 0x02, 0xE0, 0x00, 0x0B, 0x40, 0x3C, 0x00, 0x00, 0xBF, 0x0F, 0x85, 0x40, 0x3F, 0xF1, 0xF2,
-    0xFF, 0x40, 0x00, 0x3D, 0x14, 0x38, 0x00, 0x0B, 0xC0, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0x7C, 0x00,
-    0x3F, 0x00, 0x2F, 0x00, 0x07, 0xC0, 0x0F, 0xD0, 0x00, 0xF8, 0x02, 0xFF, 0xC0, 0x2F, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x25, 0xB4, 0x02, 0xD0, 0x00, 0x38,
-    0x07, 0xC0, 0x05, 0xB0, 0x0F, 0x40, 0x0F, 0xF4, 0x2E, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x2F, 0xF8,
-    0xF4, 0xB0, 0x3F, 0xF2, 0xF1, 0xF4, 0x00, 0x03, 0xD3, 0xB4, 0x00, 0x0F, 0x8E, 0x74, 0x00, 0x1F,
-    0x2E, 0xB8, 0x00, 0x3E, 0x3F, 0xFD, 0x00, 0xBC, 0x00, 0x78, 0x01, 0xF4, 0x00, 0xB8, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0xC0,
-    0x07, 0xF9, 0x00, 0x3F, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3D, 0x00,
-    0x40, 0xFD, 0x0B, 0xC0, 0xFF, 0xFE, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xAF, 0x00, 0x01,
-    0xF4, 0xF4, 0x00, 0x2F, 0x0F, 0xC0, 0x03, 0xF0, 0xBD, 0x00, 0x7E, 0x07, 0xE0, 0x0F, 0xFF, 0xFF,
-    0x01, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xC3, 0xF4, 0x00, 0xFD, 0x7F, 0x00, 0x0F, 0xE0, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x1F, 0x4F, 0x40,
-    0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x00, 0x07, 0x40, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0xFA, 0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E,
-    0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0,
-    0x00, 0xFE, 0x00, 0x3C, 0x70, 0x00, 0x0B, 0xF7, 0x00, 0x00, 0xE7, 0xF0, 0x00, 0x0A, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x0F, 0xAF, 0x00, 0x01, 0xF4, 0xF4, 0x00, 0x2F, 0x0F, 0xC0, 0x03, 0xF0, 0xBD, 0x00,
-    0x7E, 0x07, 0xE0, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xC3, 0xF4, 0x00,
-    0xFD, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0xA0, 0x68, 0x00, 0x1F, 0x4F, 0xC0, 0x02, 0xF8, 0xFC, 0x00,
-    0x3F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02,
-    0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0x40, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA,
-    0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00,
-    0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00,
-    0xFE, 0x00, 0x00, 0xA6, 0xBF, 0xFF, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xA5,
-    0x40, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0x8F, 0xFD, 0x68,
-    0x00, 0x07, 0xD3, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0xBF, 0xFF, 0xC0, 0x02, 0xF4, 0x1F, 0xE0, 0x00,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xAA, 0x90, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0x80, 0x0F, 0xFF, 0xFF, 0x1F, 0xC0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F, 0xF4, 0x04, 0x1F,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xE0,
-    0x05, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x00, 0x0B, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x0A, 0xE0, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xE9, 0x54, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xF5, 0xA0, 0x0F, 0xFF, 0xD0, 0x3F, 0xFF, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xEA, 0xA8, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x80, 0x00, 0x1D,
-    0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFA, 0x55, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0xFD, 0x68, 0x03, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xFA, 0xAA, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF5, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0xE0, 0x00, 0xFB, 0xF0, 0x0F, 0x42, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xF0, 0xFE, 0x95, 0x43, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x5A, 0x00, 0xFF,
-    0xFD, 0x03, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFE, 0xAA, 0x83, 0xFF, 0xFF, 0x1F,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xF8, 0x0F, 0xC7, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBE, 0x06, 0xA2, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xA5, 0x50, 0xFC, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0xD6, 0x80, 0x3F, 0xFF, 0x40, 0xFF, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0xAA, 0xA0, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0xFF, 0xFE, 0x3E, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0,
-    0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0,
-    0x03, 0xF0, 0x07, 0xF4, 0x01, 0x03, 0xC1, 0xE0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC7,
-    0xF4, 0x00, 0xE0, 0x00, 0x3F, 0x40, 0x0F, 0xFD, 0x03, 0xD0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x07, 0xF4, 0x00, 0x3E, 0x2F, 0x1F, 0x8F, 0xC7, 0xF3, 0xF5, 0xA8, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x07, 0xF4, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0xF8, 0x01, 0xF8, 0x02, 0xFC, 0x01, 0xF8, 0x00, 0x7D, 0x01, 0xF8, 0x00, 0x3E, 0x3F, 0xFF,
-    0xD0, 0x3F, 0x3F, 0xFF, 0xD0, 0x3F, 0x01, 0xF8, 0x00, 0x7E, 0x01, 0xF8, 0x06, 0xFE, 0x01, 0xFF,
-    0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x3D,
-    0x70, 0x00, 0x2F, 0xFC, 0x00, 0x0B, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x03, 0xE1, 0xFC, 0x00, 0xF4, 0x7F, 0x80, 0x7D, 0x1F, 0xF0, 0x1F, 0x4B, 0xFE, 0x07, 0xD2, 0xFF,
-    0xC1, 0xF4, 0xBE, 0xF8, 0xBC, 0x3F, 0xAF, 0x2F, 0x0F, 0xE7, 0xEB, 0xC3, 0xF8, 0xFF, 0xF0, 0xFE,
-    0x1F, 0xFC, 0x3F, 0x83, 0xFF, 0x0F, 0xF0, 0xBF, 0xC7, 0xFC, 0x0F, 0xF0, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x90, 0x00, 0x2F, 0xFF, 0xE0, 0x03, 0xFE, 0x6F, 0xE0, 0x1F, 0xC0, 0x0F, 0xD0, 0xFC, 0x00,
-    0x1F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0xFC, 0x7E, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x0F,
-    0xC3, 0xFD, 0x01, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE, 0x00,
-    0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0x9B, 0xF8,
-    0x07, 0xF0, 0x03, 0xF4, 0x3F, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x3F, 0x1F,
-    0x80, 0x00, 0xFC, 0x3F, 0x00, 0x03, 0xF0, 0xFF, 0x40, 0x7F, 0xC3, 0xFF, 0xFF, 0xFF, 0x07, 0xFF,
-    0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x80, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3D, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xF9, 0xBF, 0x80,
-    0x7F, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x03, 0xF1, 0xF8,
-    0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0xF4, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xFF, 0x40, 0xBF, 0xFF, 0xF8, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x34,
-    0x00, 0x01, 0xFD, 0xD0, 0x00, 0x0B, 0x3F, 0x00, 0x00, 0x18, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0x90, 0x00, 0x2F, 0xFF, 0xE0, 0x03, 0xFE, 0x6F, 0xE0, 0x1F, 0xC0, 0x0F, 0xD0, 0xFC,
-    0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0xFC, 0x7E, 0x00, 0x03, 0xF0, 0xFC, 0x00,
-    0x0F, 0xC3, 0xFD, 0x01, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE,
-    0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x68, 0x00, 0x03, 0xE2, 0xF0, 0x00,
-    0x1F, 0xCF, 0xD0, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xF9, 0xBF, 0x80, 0x7F, 0x00, 0x3F, 0x43, 0xF0, 0x00,
-    0x7F, 0x0F, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x3F,
-    0x0F, 0xF4, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF8, 0x00,
-    0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0x40, 0xFF, 0xD0, 0x03, 0xF8, 0x00, 0xBF,
-    0xD0, 0x2F, 0xBF, 0x85, 0x50, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFE, 0x6F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFC,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0x07, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0x83, 0xF8, 0xFC, 0x00,
-    0x00, 0x07, 0xE3, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xFE,
-    0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xF9, 0xFD, 0x00, 0xFD, 0x3F,
-    0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x0F,
-    0xC0, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0xFD, 0x01, 0xFC, 0x3F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x81,
-    0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x0F, 0xE7, 0xF4, 0x03, 0xF4, 0xFC, 0x00,
-    0xFD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFC, 0x3F, 0x00,
-    0x3F, 0x0F, 0xC0, 0x0F, 0xC3, 0xF4, 0x07, 0xF0, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFE, 0x07, 0xFF,
-    0xFF, 0x40, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x0B,
-    0xFE, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0xFE, 0x7F, 0x40, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFD, 0x3F,
-    0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x3F, 0x40, 0x7F, 0x0F,
-    0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF4, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x90, 0xA0, 0x00, 0xFC, 0x7D, 0x00, 0x3F, 0x2F, 0x80, 0x1F, 0xCF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xFE, 0x7F, 0x40, 0x3F, 0x4F, 0xC0, 0x0F,
-    0xD3, 0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xC3, 0xF0, 0x03,
-    0xF0, 0xFC, 0x00, 0xFC, 0x3F, 0x40, 0x7F, 0x0F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
-    0xF4, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC2, 0xF4,
-    0x02, 0xF8, 0x0F, 0xC0, 0x3F, 0x00, 0xBE, 0x0B, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0xAF, 0x80,
-    0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x03, 0xC0, 0x00, 0xFF, 0x40, 0x3F, 0xFC, 0x0F, 0x6F, 0x83, 0xC0, 0xF0, 0xF0, 0x7C, 0x3D, 0x7F,
-    0x0F, 0xFF, 0x03, 0xFE, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x3F,
-    0xFE, 0x01, 0xF0, 0x3C, 0x0B, 0x82, 0xF4, 0x2E, 0x2E, 0x40, 0xB8, 0xF0, 0x03, 0xF2, 0xE0, 0x0F,
-    0xC3, 0xF4, 0x3F, 0x03, 0xF0, 0xFD, 0x03, 0xD3, 0xFF, 0xFF, 0x4F, 0xFF, 0xFC, 0x2A, 0x6E, 0x40,
-    0x1F, 0x40, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x1F,
-    0xFF, 0xC3, 0xD0, 0xFC, 0x38, 0x07, 0xC7, 0x40, 0x3C, 0x74, 0x07, 0xD3, 0xFF, 0xFD, 0x2F, 0xFF,
-    0xE0, 0xBF, 0x7E, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x81, 0xFF, 0xFC, 0x3D, 0x0F, 0xC3, 0x80,
-    0x7C, 0x74, 0x03, 0xC7, 0x40, 0x7D, 0x3F, 0xFF, 0xD2, 0xFF, 0xFE, 0x0B, 0xF7, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x01, 0xFD, 0x00, 0x7E, 0xF4, 0x1F, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xB8, 0x1F, 0xFF, 0xC3, 0xD0, 0xFC, 0x38, 0x07, 0xC7, 0x40, 0x3C, 0x74, 0x07, 0xD3, 0xFF,
-    0xFD, 0x2F, 0xFF, 0xE0, 0xBF, 0x7E, 0x02, 0x46, 0x00, 0xBE, 0x70, 0x0E, 0xBF, 0x00, 0xF2, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x81, 0xFF, 0xFC, 0x3D, 0x0F, 0xC3, 0x80, 0x7C, 0x74,
-    0x03, 0xC7, 0x40, 0x7D, 0x3F, 0xFF, 0xD2, 0xFF, 0xFE, 0x0B, 0xF7, 0xE0, 0x1F, 0x4F, 0xC2, 0xF4,
-    0xFC, 0x2F, 0x8F, 0xC2, 0xA4, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x81, 0xFF, 0xFC,
-    0x3D, 0x0F, 0xC3, 0x80, 0x7C, 0x74, 0x03, 0xC7, 0x40, 0x7D, 0x3F, 0xFF, 0xD2, 0xFF, 0xFE, 0x0B,
-    0xF7, 0xE0, 0x00, 0x10, 0x00, 0x1F, 0x80, 0x02, 0xEC, 0x00, 0x2F, 0xC0, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x1F, 0xFF, 0xC3, 0xD0, 0xFC, 0x38, 0x07, 0xC7, 0x40, 0x3C,
-    0x74, 0x07, 0xD3, 0xFF, 0xFD, 0x2F, 0xFF, 0xE0, 0xBF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0xE6, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0xF4, 0x3F, 0xD1, 0xB8, 0x38, 0x07, 0xFF, 0xFF, 0x1D,
-    0x00, 0xFE, 0x95, 0x47, 0x40, 0x7F, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x02, 0xFD, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x41, 0xFF, 0xE0, 0xFD, 0x00, 0x3C, 0x00,
-    0x1F, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x60, 0x2F, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0x40, 0x06, 0xF0,
-    0x00, 0xFC, 0x00, 0x7D, 0x00, 0x0F, 0x40, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0xEF, 0x83, 0xE1, 0x7C, 0x3F, 0xFF,
-    0xE7, 0xEA, 0x54, 0x7D, 0x00, 0x03, 0xFF, 0xFE, 0x1F, 0xFF, 0xE0, 0x2F, 0xF4, 0x00, 0x14, 0x00,
-    0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE,
-    0x7E, 0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x78, 0x00,
-    0x0F, 0xD0, 0x03, 0xFF, 0x40, 0xF4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47, 0xD0, 0x00,
-    0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x0A, 0x06, 0x81, 0xF4, 0xFC, 0x2F, 0x8F, 0xC3,
-    0xF8, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xFE,
-    0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE,
-    0x02, 0xFF, 0x40, 0x7D, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00,
-    0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xD0, 0x1F, 0x40, 0x0E, 0x2D, 0x3C, 0x14,
-    0x00, 0x00, 0x00, 0x14, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x7C, 0x7D, 0x7D, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x02, 0xFC, 0x00, 0xBE, 0xF0, 0x2E, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3C, 0x7C, 0x7D, 0x7D, 0xBD, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07,
-    0xD0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xF4, 0x00, 0x7F, 0xCF, 0x00, 0x1F,
-    0xFF, 0xF0, 0x03, 0xF0, 0xBF, 0x00, 0x3D, 0x03, 0xE0, 0x07, 0xD0, 0x3E, 0x00, 0x3F, 0x4B, 0xC0,
-    0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xE2, 0x80, 0x3F, 0xAC,
-    0x03, 0x6F, 0x80, 0x24, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFE, 0x03, 0xFF, 0xFC, 0x3F,
-    0x47, 0xD3, 0xD0, 0x3D, 0x3D, 0x03, 0xE3, 0xD0, 0x3E, 0x7E, 0x03, 0xF7, 0xE0, 0x3F, 0x7F, 0x03,
-    0xF0, 0x1F, 0x40, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x1F, 0xFF, 0x83, 0xE0, 0x7D, 0x7C, 0x03, 0xE7, 0xC0, 0x3F, 0x3F, 0x5B, 0xE3, 0xFF, 0xFD, 0x1F,
-    0xFF, 0x80, 0x2F, 0xD0, 0x00, 0x14, 0x00, 0x03, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xF8, 0x3E, 0x07, 0xD7,
-    0xC0, 0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F, 0xFF, 0xD1, 0xFF, 0xF8, 0x02, 0xFD, 0x00, 0x00,
-    0x74, 0x00, 0x1F, 0xC0, 0x07, 0xFF, 0x41, 0xF4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x01, 0xFF, 0xF8, 0x3E, 0x07, 0xD7, 0xC0, 0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F, 0xFF, 0xD1,
-    0xFF, 0xF8, 0x02, 0xFD, 0x00, 0x03, 0xC7, 0x00, 0xBF, 0x70, 0x0E, 0x7F, 0x00, 0xA1, 0x90, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xFF, 0x83, 0xE0, 0x7D, 0x7C, 0x03, 0xE7, 0xC0, 0x3F, 0x3F, 0x5B,
-    0xE3, 0xFF, 0xFD, 0x1F, 0xFF, 0x80, 0x2F, 0xD0, 0x0A, 0x06, 0x81, 0xF4, 0xFC, 0x2F, 0x8F, 0xC3,
-    0xF9, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xF8, 0x3E, 0x07, 0xD7, 0xC0,
-    0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F, 0xFF, 0xD1, 0xFF, 0xF8, 0x02, 0xFD, 0x00, 0x00, 0x29,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0x50, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07,
-    0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0,
-    0x00, 0x07, 0xC0, 0x00, 0xBF, 0xC0, 0x07, 0xFF, 0xE0, 0x0F, 0xAF, 0xF4, 0x1F, 0x3E, 0xF8, 0x1F,
-    0x3D, 0xBC, 0x1F, 0xFD, 0xF8, 0x0F, 0xFF, 0xF4, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x03, 0xF0,
-    0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00,
-    0x2F, 0x00, 0x00, 0x38, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x7E, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x3D, 0x7C, 0x03, 0xD7, 0xC0, 0x3D, 0x3C, 0x03, 0xE3,
-    0xC0, 0x7E, 0x3D, 0x0B, 0xE3, 0xFF, 0xFE, 0x2F, 0xFF, 0xE0, 0xBF, 0xBE, 0x00, 0x14, 0x00, 0x03,
-    0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x03, 0xD7, 0xC0, 0x3D, 0x7C, 0x03, 0xD3, 0xC0, 0x3E, 0x3C, 0x07, 0xE3, 0xD0, 0xBE, 0x3F,
-    0xFF, 0xE2, 0xFF, 0xFE, 0x0B, 0xFB, 0xE0, 0x00, 0x78, 0x00, 0x0F, 0xD0, 0x07, 0xFF, 0x41, 0xF4,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xD7, 0xC0, 0x3D, 0x7C, 0x03, 0xD3, 0xC0, 0x3E,
-    0x3C, 0x07, 0xE3, 0xD0, 0xBE, 0x3F, 0xFF, 0xE2, 0xFF, 0xFE, 0x0B, 0xFB, 0xE0, 0x1F, 0x4F, 0xC1,
-    0xF4, 0xFC, 0x2F, 0x8F, 0xC2, 0xA4, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xD7, 0xC0,
-    0x3D, 0x7C, 0x03, 0xD3, 0xC0, 0x3E, 0x3C, 0x07, 0xE3, 0xD0, 0xBE, 0x3F, 0xFF, 0xE2, 0xFF, 0xFE,
-    0x0B, 0xFB, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x0F, 0x8B, 0xC0, 0x3D, 0x0F, 0x81, 0xF0, 0x2F, 0x4F, 0x80, 0x3F, 0x3D, 0x00, 0xBF, 0xF0, 0x00,
-    0xFF, 0x80, 0x02, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0xBF, 0xF0, 0x02,
-    0xFF, 0x40, 0x0B, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xFF, 0x80, 0x3F, 0xFC,
-    0x0F, 0x5F, 0xC3, 0xD0, 0xF0, 0xF4, 0x2D, 0x3D, 0x0F, 0x4F, 0x47, 0xC3, 0xD7, 0xE0, 0xFF, 0xF0,
-    0x3F, 0xE0, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC3,
-    0xF0, 0x2F, 0x4F, 0xC0, 0xFD, 0x7F, 0x02, 0xA5, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0xBC, 0x03, 0xD0, 0xF8, 0x1F, 0x02, 0xF4, 0xF8, 0x03,
-    0xF3, 0xD0, 0x0B, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x0B, 0xD0, 0x0B, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2F,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA,
-    0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00,
-    0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00,
-    0xFE, 0x16, 0xAB, 0x83, 0xFF, 0xFC, 0x2A, 0x95, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFB, 0x81, 0xFF, 0xFC, 0x3D, 0x0F, 0xC3, 0x80, 0x7C, 0x74, 0x03, 0xC7, 0x40, 0x7D, 0x3F,
-    0xFF, 0xD2, 0xFF, 0xFE, 0x0B, 0xF7, 0xE0, 0x00, 0x40, 0x14, 0x00, 0x1F, 0xAF, 0xC0, 0x00, 0xFF,
-    0xF4, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x1F, 0x4F,
-    0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x02,
-    0xF0, 0x7C, 0x1F, 0xFF, 0x80, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xB8, 0x1F, 0xFF, 0xC3, 0xD0, 0xFC, 0x38, 0x07, 0xC7, 0x40, 0x3C, 0x74, 0x07, 0xD3, 0xFF, 0xFD,
-    0x2F, 0xFF, 0xE0, 0xBF, 0x7E, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B,
-    0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F,
-    0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF5, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEE, 0x01, 0xFF, 0xFC,
-    0x0F, 0x43, 0xF0, 0x38, 0x07, 0xC1, 0xD0, 0x0F, 0x07, 0x40, 0x7D, 0x0F, 0xFF, 0xF4, 0x2F, 0xFF,
-    0xE0, 0x2F, 0xDF, 0xC0, 0x00, 0x2D, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F, 0xF4, 0x04,
-    0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x3F,
-    0xE0, 0x05, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x00, 0x74,
-    0x00, 0x3C, 0x00, 0x1F, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x41, 0xFF, 0xE0, 0xFD, 0x00,
-    0x3C, 0x00, 0x1F, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x60, 0x1F, 0xFF, 0x01, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFB, 0xE0, 0x03, 0xD0, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F, 0xF4, 0x04, 0x1F,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xE0,
-    0x05, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x03, 0xF8, 0x01, 0xFB, 0xE0, 0x7C, 0x0B, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF,
-    0xE0, 0x3F, 0x40, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x58, 0x01, 0xFF, 0xF0,
-    0x06, 0xFE, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F, 0xF4,
-    0x04, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x00,
-    0x3F, 0xE0, 0x05, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x01,
-    0xA0, 0x00, 0xBD, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x41, 0xFF, 0xE0, 0xFD,
-    0x00, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x60, 0x1F, 0xFF, 0x01, 0xBF, 0x80, 0x03,
-    0xC0, 0x78, 0x00, 0xFA, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F, 0xF4, 0x04,
-    0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x3F,
-    0xE0, 0x05, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x28, 0x06,
-    0x81, 0xF6, 0xF0, 0x07, 0xFC, 0x00, 0x1F, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01,
-    0xFF, 0xE0, 0x3F, 0x40, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x58, 0x01, 0xFF,
-    0xF0, 0x06, 0xFE, 0x00, 0x05, 0x00, 0x50, 0x01, 0xF4, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x7F, 0xFF,
-    0xF8, 0x1F, 0xFF, 0xFF, 0x87, 0xE0, 0x0B, 0xF1, 0xF8, 0x00, 0xBD, 0x7E, 0x00, 0x0F, 0x9F, 0x80,
-    0x03, 0xE7, 0xE0, 0x00, 0xFD, 0xF8, 0x00, 0x3E, 0x7E, 0x01, 0xBF, 0x9F, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x14,
-    0x00, 0x01, 0xF3, 0xD0, 0x00, 0x1F, 0x3C, 0x00, 0x01, 0xF7, 0xC0, 0x2F, 0xAF, 0x7C, 0x0F, 0xFF,
-    0xF0, 0x03, 0xF6, 0xFF, 0x00, 0x3C, 0x07, 0xF0, 0x07, 0x80, 0x7E, 0x00, 0x7D, 0x0B, 0xE0, 0x03,
-    0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x6F, 0xAF, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF,
-    0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xF8, 0x02, 0xFC, 0x01, 0xF8, 0x00, 0x7D, 0x01, 0xF8,
-    0x00, 0x3E, 0x3F, 0xFF, 0xD0, 0x3F, 0x3F, 0xFF, 0xD0, 0x3F, 0x01, 0xF8, 0x00, 0x7E, 0x01, 0xF8,
-    0x06, 0xFE, 0x01, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x0B, 0xFF, 0xFC, 0x01, 0xAF, 0xEA, 0x00,
-    0x01, 0xF0, 0x00, 0xBE, 0xBC, 0x00, 0xFF, 0xFF, 0x00, 0xFD, 0xBF, 0xC0, 0x3C, 0x07, 0xF0, 0x1E,
-    0x01, 0xF8, 0x07, 0xD0, 0xBE, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF0, 0x01, 0xBE, 0xBC, 0x00,
-    0x0A, 0xAF, 0xC0, 0xBF, 0xFF, 0x41, 0x95, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xBF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xA5, 0x50, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD6,
-    0x80, 0x3F, 0xFF, 0x40, 0xFF, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xAA, 0xA0, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0xFF, 0xFE, 0x00, 0x15, 0x42, 0xFF, 0xFC, 0x3F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0xF8,
-    0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0x40, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFE, 0x95, 0x43, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x5A, 0x00, 0xFF, 0xFD, 0x03, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xFE, 0xAA, 0x83, 0xFF, 0xFF, 0x1F, 0xFF, 0xFD, 0x7F, 0xFF, 0xF8, 0x04, 0x41, 0x41, 0xFF,
-    0xFC, 0x0F, 0xFF, 0x40, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47, 0xD0, 0x00, 0x3F,
-    0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xA5, 0x50,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD6, 0x80, 0x3F, 0xFF, 0x40, 0xFF, 0xFC, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0xAA, 0xA0, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0xFF, 0xFE, 0x00, 0xF8,
-    0x00, 0x0F, 0x80, 0x01, 0xFC, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47, 0xD0,
-    0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x2B, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFA,
-    0x55, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x68, 0x03, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xFA, 0xAA, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF5, 0xFF, 0xFF, 0xE0,
-    0x2E, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF, 0xE1,
-    0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x38, 0x00, 0x0F, 0x40, 0x01, 0xE0, 0x00, 0x1F,
-    0xD0, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x04, 0x00, 0x50, 0x3E, 0x1F, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xF0, 0xFF,
-    0xFF, 0xC3, 0xFA, 0x55, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x68, 0x03, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFA, 0xAA, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF5,
-    0xFF, 0xFF, 0xE0, 0x2E, 0x03, 0xC0, 0xBE, 0xF0, 0x02, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0xEF, 0x83, 0xE1,
-    0x7C, 0x3F, 0xFF, 0xE7, 0xEA, 0x54, 0x7D, 0x00, 0x03, 0xFF, 0xFE, 0x1F, 0xFF, 0xE0, 0x2F, 0xF4,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x2E, 0x0B, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0xA9, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF8, 0x0B, 0xF9, 0x00, 0x50, 0x3F, 0xC0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x3A, 0x50, 0x7F, 0x00, 0xFF, 0xF0,
-    0xFD, 0x01, 0xBF, 0xD3, 0xFC, 0x00, 0x7E, 0x0B, 0xFE, 0xAB, 0xF4, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFF, 0x40, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0xF4, 0x03,
-    0xD0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBD, 0xBC, 0x1F, 0xFF, 0xE0,
-    0xF4, 0x7F, 0x87, 0x80, 0xBE, 0x1D, 0x01, 0xF8, 0x78, 0x0B, 0xE0, 0xFF, 0xFF, 0x42, 0xFF, 0xFD,
-    0x02, 0xFF, 0xF4, 0x00, 0x43, 0xC0, 0x00, 0x2F, 0x02, 0xFB, 0xF8, 0x0F, 0xFF, 0xC0, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0xA9, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF8, 0x0B, 0xF9, 0x00, 0x50, 0x3F, 0xC0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x3A, 0x50, 0x7F, 0x00, 0xFF,
-    0xF0, 0xFD, 0x01, 0xBF, 0xD3, 0xFC, 0x00, 0x7E, 0x0B, 0xFE, 0xAB, 0xF4, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x2E, 0x0B, 0xFF, 0xD0,
-    0x2F, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x6F, 0x1F, 0xFF, 0xE3, 0xD1,
-    0xFE, 0x78, 0x0B, 0xE7, 0x40, 0x7E, 0x78, 0x0B, 0xE3, 0xFF, 0xFD, 0x2F, 0xFF, 0xD0, 0xBF, 0xFD,
-    0x00, 0x43, 0xC0, 0x00, 0xBC, 0x2F, 0xBF, 0x83, 0xFF, 0xF0, 0x2F, 0xF8, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x02, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xFE, 0x02, 0xFE, 0x40, 0x14, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x0E, 0x94, 0x1F, 0xC0, 0x3F, 0xFC, 0x3F, 0x40, 0x6F, 0xF4, 0xFF, 0x00, 0x1F,
-    0x82, 0xFF, 0xAA, 0xFD, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x01, 0xBF, 0xE4, 0x00,
-    0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x00, 0xBE, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xF6, 0xF1, 0xFF, 0xFE, 0x3D, 0x1F, 0xE7, 0x80, 0xBE, 0x74, 0x07, 0xE7, 0x80, 0xBE, 0x3F, 0xFF,
-    0xD2, 0xFF, 0xFD, 0x0B, 0xFF, 0xD0, 0x04, 0x3C, 0x00, 0x0B, 0xC2, 0xFB, 0xF8, 0x3F, 0xFF, 0x02,
-    0xFF, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x90, 0x00, 0xBF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFF, 0x80, 0xBF, 0x90, 0x05, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x01, 0xFC, 0x03, 0xA5, 0x07, 0xF0, 0x0F, 0xFF, 0x0F, 0xD0, 0x1B, 0xFD, 0x3F, 0xC0, 0x07,
-    0xE0, 0xBF, 0xEA, 0xBF, 0x40, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x6F, 0xF9, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x2A, 0x40, 0x00,
-    0x00, 0x00, 0x6F, 0x6F, 0x1F, 0xFF, 0xE3, 0xD1, 0xFE, 0x78, 0x0B, 0xE7, 0x40, 0x7E, 0x78, 0x0B,
-    0xE3, 0xFF, 0xFD, 0x2F, 0xFF, 0xD0, 0xBF, 0xFD, 0x00, 0x43, 0xC0, 0x00, 0xBC, 0x2F, 0xBF, 0x83,
-    0xFF, 0xF0, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x07,
-    0xEF, 0x80, 0x07, 0xC0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x3F,
-    0x00, 0x2F, 0x4F, 0xC0, 0x0B, 0xD3, 0xF0, 0x02, 0xF4, 0xFC, 0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F,
-    0xC0, 0x0F, 0xD3, 0xFA, 0xAB, 0xF8, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3,
-    0xF4, 0x03, 0xF9, 0xFD, 0x00, 0xFE, 0x7F, 0x40, 0x3F, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xEF,
-    0xD0, 0x03, 0xFF, 0xFC, 0x00, 0xFD, 0x1F, 0x40, 0x3E, 0x01, 0xE0, 0x0F, 0x80, 0x7C, 0x03, 0xE0,
-    0x2F, 0x01, 0xF8, 0x0B, 0xC0, 0x7F, 0x03, 0xF0, 0x1F, 0xC0, 0xFC, 0x0F, 0xC0, 0x0B, 0xC0, 0x3F,
-    0x00, 0x2F, 0x40, 0xFC, 0x00, 0xBD, 0x07, 0xF5, 0x57, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF,
-    0xFF, 0xD0, 0xFC, 0x00, 0xFE, 0x03, 0xFA, 0xAB, 0xF8, 0x0F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF,
-    0x80, 0xFF, 0xFF, 0xFE, 0x03, 0xF4, 0x03, 0xF8, 0x1F, 0xD0, 0x0F, 0xE0, 0x7F, 0x40, 0x3F, 0xC0,
-    0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xF4, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xFE, 0xFD, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xD1, 0xF4, 0x03, 0xE0, 0x1E, 0x00, 0xF8, 0x07,
-    0xC0, 0x3E, 0x02, 0xF0, 0x1F, 0x80, 0xBC, 0x07, 0xF0, 0x3F, 0x01, 0xFC, 0x0F, 0xC0, 0x3D, 0x31,
-    0xFF, 0xCB, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00,
-    0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03,
-    0xF0, 0x1F, 0xD0, 0x09, 0x14, 0xFD, 0xB3, 0xBF, 0xCE, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7D, 0x01, 0xF4, 0x05,
-    0x5A, 0x82, 0xFF, 0xFC, 0x3F, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x01, 0xFD, 0x00, 0x1A, 0xAF, 0x43, 0xFF, 0xFC, 0x69, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC,
-    0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC1, 0xFD, 0x1E,
-    0x03, 0xC0, 0x3F, 0x81, 0xF8, 0x00, 0x00, 0x1F, 0x42, 0xF4, 0x2F, 0x82, 0xA4, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x01, 0xF0, 0x1F, 0x01, 0xF4, 0x1F, 0x41, 0xF0, 0x3C,
-    0x03, 0xFC, 0x1F, 0xC0, 0x00, 0x3E, 0x0F, 0xC7, 0xF1, 0xA8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F,
-    0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x7F, 0x40,
-    0x14, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x7C, 0x7D, 0x7D, 0xBD, 0x00, 0x0F, 0xC7, 0xD0, 0x00,
-    0xFC, 0x7D, 0x00, 0x1F, 0xC7, 0xD0, 0x01, 0xF8, 0x7D, 0x00, 0x1F, 0x87, 0xD0, 0x02, 0xF8, 0x7D,
-    0x00, 0x2F, 0x47, 0xD0, 0x02, 0xF4, 0x7E, 0x00, 0x3F, 0x07, 0xE0, 0x03, 0xF0, 0x7E, 0x00, 0x3F,
-    0x07, 0xF0, 0x03, 0xF0, 0xBF, 0x00, 0x3F, 0x0B, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x09,
-    0x0F, 0xE0, 0x00, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x00, 0x1A, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x02, 0x87, 0xD0, 0x3D, 0xBE, 0x03, 0xDF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x03, 0xD3, 0xC0, 0x3C, 0x3C, 0x03, 0xC3, 0xC0, 0x3C, 0x3C, 0x03, 0xC7,
-    0xC0, 0x3C, 0x7D, 0x07, 0xC7, 0xD0, 0x7C, 0x7E, 0x0B, 0x80, 0x00, 0xF8, 0x00, 0xBF, 0x80, 0x0F,
-    0xF0, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xF0,
-    0x03, 0xD0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07,
-    0xE0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x14, 0x1F, 0xC0, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x40, 0x3F, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x7F, 0x40, 0x7E, 0xF4, 0x7C, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB4, 0x00, 0x2D,
-    0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0xFE, 0x00, 0xFC, 0x7F, 0x00, 0x3E, 0x3F, 0x40, 0x0F, 0x9F, 0xC0, 0x07, 0xEF, 0xC0, 0x01, 0xFF,
-    0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0x00, 0x3F, 0x3F, 0xF0, 0x0F, 0xC3, 0xFF, 0x07, 0xF0, 0x7F, 0xF4, 0x2F, 0x00, 0x00, 0xBC,
-    0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0xA4, 0x03, 0xDF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x1F, 0xFF, 0x80, 0x7D, 0xBF, 0x81,
-    0xF4, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x00,
-    0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x01, 0x54, 0x00, 0x00, 0x1D, 0x38, 0x0B, 0x3D,
-    0x02, 0xDE, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xFD, 0x00, 0xFB, 0xE0, 0x7C, 0xBE,
-    0x00, 0x01, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x54, 0x3F, 0xFF, 0xF4,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x40, 0x07, 0x40, 0xF0, 0x1F, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3C, 0x03, 0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x07,
-    0xC0, 0x7D, 0x47, 0xFC, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F,
-    0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x54, 0x0F,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0x80, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F,
-    0x40, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xD4, 0x1F, 0xF0, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x41, 0xFD, 0x07, 0xF0, 0x2F, 0x80, 0xFD, 0x07, 0xF0,
-    0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x14, 0x0B, 0xC0, 0xF4, 0x3F, 0x03, 0xC0, 0xFC,
-    0x0F, 0x03, 0xF0, 0x7C, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x15, 0x0F,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xF5, 0xFF, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x1F, 0x00, 0x2E, 0x2E, 0x3E,
-    0x3D, 0x3E, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0x7C, 0x00, 0x7D, 0x40, 0x7F, 0xC0, 0x7F, 0xD0, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x3E, 0x0B, 0xC1, 0xF8, 0x3F, 0x07, 0xF0, 0xFC, 0x1A, 0x83, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x15, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF5, 0xFF, 0xFF,
-    0xD0, 0x2E, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x3D, 0x3D, 0x7E, 0x3C, 0xBE, 0x3C, 0x6A, 0x7C,
-    0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7D, 0x40, 0x7F, 0xC0, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00,
-    0x2F, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x05, 0x40, 0x00, 0xBF,
-    0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x7F, 0xFF, 0xF4, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3E, 0xF0,
-    0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xF0, 0x01, 0xFD, 0x7C, 0x00, 0x00, 0x1F, 0x50,
-    0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0xF8, 0x7F, 0x00,
-    0x3D, 0x1F, 0xE0, 0x1F, 0x47, 0xFC, 0x07, 0xD2, 0xFF, 0x81, 0xF4, 0xBF, 0xF0, 0x7D, 0x2F, 0xBE,
-    0x2F, 0x0F, 0xEB, 0xCB, 0xC3, 0xF9, 0xFA, 0xF0, 0xFE, 0x3F, 0xFC, 0x3F, 0x87, 0xFF, 0x0F, 0xE0,
-    0xFF, 0xC3, 0xFC, 0x2F, 0xF1, 0xFF, 0x03, 0xFC, 0x00, 0x05, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xE0, 0x3F, 0xFF, 0xC3, 0xF4,
-    0x7D, 0x3D, 0x03, 0xD3, 0xD0, 0x3E, 0x3D, 0x03, 0xE7, 0xE0, 0x3F, 0x7E, 0x03, 0xF7, 0xF0, 0x3F,
-    0x05, 0x40, 0x0F, 0x87, 0xF0, 0x03, 0xD1, 0xFE, 0x01, 0xF4, 0x7F, 0xC0, 0x7D, 0x2F, 0xF8, 0x1F,
-    0x4B, 0xFF, 0x07, 0xD2, 0xFB, 0xE2, 0xF0, 0xFE, 0xBC, 0xBC, 0x3F, 0x9F, 0xAF, 0x0F, 0xE3, 0xFF,
-    0xC3, 0xF8, 0x7F, 0xF0, 0xFE, 0x0F, 0xFC, 0x3F, 0xC2, 0xFF, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xE0, 0x3F, 0xFF, 0xC3, 0xF4, 0x7D, 0x3D,
-    0x03, 0xD3, 0xD0, 0x3E, 0x3D, 0x03, 0xE7, 0xE0, 0x3F, 0x7E, 0x03, 0xF7, 0xF0, 0x3F, 0x00, 0x54,
-    0x00, 0x1F, 0xD0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x01, 0x50, 0x00,
-    0x02, 0xE0, 0x7C, 0x00, 0x2F, 0xBC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x3E, 0x1F, 0xC0, 0x0F, 0x47, 0xF8, 0x07,
-    0xD1, 0xFF, 0x01, 0xF4, 0xBF, 0xE0, 0x7D, 0x2F, 0xFC, 0x1F, 0x4B, 0xEF, 0x8B, 0xC3, 0xFA, 0xF2,
-    0xF0, 0xFE, 0x7E, 0xBC, 0x3F, 0x8F, 0xFF, 0x0F, 0xE1, 0xFF, 0xC3, 0xF8, 0x3F, 0xF0, 0xFF, 0x0B,
-    0xFC, 0x7F, 0xC0, 0xFF, 0x00, 0x0E, 0x01, 0xE0, 0x0F, 0xAF, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFE, 0x00, 0xFF, 0xFF,
-    0x03, 0xF4, 0x7D, 0x0F, 0x40, 0xF4, 0x3D, 0x03, 0xE0, 0xF4, 0x0F, 0x87, 0xE0, 0x3F, 0x1F, 0x80,
-    0xFC, 0x7F, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xBD, 0x00, 0x2F, 0x80, 0x07, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFE, 0x03, 0xFF, 0xFC, 0x3F, 0x47, 0xD3,
-    0xD0, 0x3D, 0x3D, 0x03, 0xE3, 0xD0, 0x3E, 0x7E, 0x03, 0xF7, 0xE0, 0x3F, 0x7F, 0x03, 0xF0, 0x05,
-    0x40, 0x0F, 0x87, 0xF0, 0x03, 0xD1, 0xFE, 0x01, 0xF4, 0x7F, 0xC0, 0x7D, 0x2F, 0xF8, 0x1F, 0x4B,
-    0xFF, 0x07, 0xD2, 0xFB, 0xE2, 0xF0, 0xFE, 0xBC, 0xBC, 0x3F, 0x9F, 0xAF, 0x0F, 0xE3, 0xFF, 0xC3,
-    0xF8, 0x7F, 0xF0, 0xFE, 0x0F, 0xFC, 0x3F, 0xC2, 0xFF, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xE0, 0x3F,
-    0xFF, 0xC3, 0xF4, 0x7D, 0x3D, 0x03, 0xD3, 0xD0, 0x3E, 0x3D, 0x03, 0xE7, 0xE0, 0x3F, 0x7E, 0x03,
-    0xF7, 0xF0, 0x3F, 0x00, 0x07, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xF9, 0xBF, 0x80, 0x7F,
-    0x00, 0x3F, 0x43, 0xF0, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x03, 0xF1, 0xF8, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0xF4, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-    0x40, 0xBF, 0xFF, 0xF8, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xF8,
-    0x3E, 0x07, 0xD7, 0xC0, 0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F, 0xFF, 0xD1, 0xFF, 0xF8, 0x02,
-    0xFD, 0x00, 0x00, 0x40, 0x14, 0x00, 0x03, 0xEA, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x80,
-    0x0F, 0xF9, 0xBF, 0x80, 0x7F, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0xFC, 0x3E,
-    0x00, 0x03, 0xF1, 0xF8, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0xF4, 0x07, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF8, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x01, 0x41, 0xFA, 0xFC, 0x0F, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0x01, 0xFF, 0xF8, 0x3E, 0x07, 0xD7, 0xC0, 0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F,
-    0xFF, 0xD1, 0xFF, 0xF8, 0x02, 0xFD, 0x00, 0x00, 0x3D, 0x00, 0xBC, 0x01, 0xF8, 0x03, 0xF0, 0x0B,
-    0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x0F, 0xF9, 0xBF, 0x80, 0x1F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x07, 0xF0, 0x3F,
-    0x00, 0x03, 0xF0, 0x3E, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x3F,
-    0xD0, 0x1F, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x80, 0x01,
-    0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x2F, 0x40, 0x7E, 0x03, 0xF4,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x03, 0xE0, 0x7D, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0xFD, 0x6F, 0x80,
-    0x03, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x15,
-    0x55, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xF9, 0xBF, 0xFF, 0xFC, 0x1F, 0xC0, 0x0F, 0xD0, 0x00,
-    0x3F, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xF5, 0x90, 0x3E, 0x00, 0x0B, 0xFF, 0xE0, 0x7E,
-    0x00, 0x0B, 0xFF, 0xE0, 0x7F, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFA, 0xA8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x0B, 0xE4, 0x07, 0xFF, 0xFF, 0xEF, 0x43,
-    0xE0, 0x7F, 0x85, 0xF1, 0xF0, 0x0F, 0xFF, 0xFD, 0x7C, 0x03, 0xFA, 0x95, 0x0F, 0xD6, 0xFD, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFD, 0x02, 0xFD, 0x0B, 0xFD, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x2F, 0xFF, 0xC0, 0x2E, 0x02, 0xE0, 0x2E, 0x01, 0xF0, 0x2E, 0x01, 0xF0, 0x3E, 0x03, 0xF0, 0x3F,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xD0, 0x3F, 0x43, 0xF0, 0x3F, 0x43, 0xF4, 0x3F, 0x43,
-    0xF8, 0x3F, 0x43, 0xFC, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x0B, 0x80,
-    0x0F, 0x00, 0x00, 0x00, 0x2F, 0xBC, 0x2F, 0xFD, 0x2F, 0xD4, 0x2F, 0x00, 0x2F, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03,
-    0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x2F, 0xFF, 0xC0, 0x2E, 0x02, 0xE0, 0x2E, 0x01, 0xF0, 0x2E, 0x01, 0xF0,
-    0x3E, 0x03, 0xF0, 0x3F, 0xFF, 0xD0, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xD0, 0x3F, 0x43, 0xF0, 0x3F,
-    0x43, 0xF4, 0x3F, 0x43, 0xF8, 0x3F, 0x43, 0xFC, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x3F, 0xC0, 0x2F, 0x80, 0x3F, 0x40, 0x7F, 0x00, 0xBF, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xBC,
-    0x2F, 0xFD, 0x2F, 0xD4, 0x2F, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x40,
-    0x14, 0x01, 0x40, 0x1F, 0x4B, 0x80, 0x07, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x2F, 0xFF, 0xC0, 0x2E, 0x02, 0xE0, 0x2E, 0x01,
-    0xF0, 0x2E, 0x01, 0xF0, 0x3E, 0x03, 0xF0, 0x3F, 0xFF, 0xD0, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xD0,
-    0x3F, 0x43, 0xF0, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF8, 0x3F, 0x43, 0xFC, 0x7F, 0x83, 0xFC, 0x00,
-    0x00, 0x00, 0x64, 0x06, 0x4F, 0x8F, 0x80, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0xBE, 0xF0, 0x2F, 0xFD, 0x0B, 0xF5, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x01, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x40,
-    0x0B, 0xE0, 0x10, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x02, 0xFC, 0x0B, 0x80, 0x2F, 0xC1,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x00, 0xAF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x0F, 0xAB, 0x00,
-    0xF0, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xE0, 0xFE, 0xFE, 0x3F, 0xFF, 0xC1, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3D,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x1F, 0xFF, 0xC0,
-    0x03, 0xFF, 0xF4, 0x00, 0xBE, 0x01, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF9,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xC0,
-    0xB8, 0x02, 0xFC, 0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0x0A, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x02, 0xFC, 0x00, 0xBE, 0xF0, 0x2E, 0x07, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0xFA, 0xB0, 0x0F, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xC0, 0x00, 0x7E, 0x0F,
-    0xEF, 0xE3, 0xFF, 0xFC, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x1F, 0xFF, 0xC0,
-    0x03, 0xFF, 0xF4, 0x00, 0xBE, 0x01, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF9,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xC0,
-    0xB8, 0x02, 0xFC, 0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0x1B, 0xFF, 0xE4, 0x00, 0x0F, 0x40,
-    0x00, 0x01, 0xBC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x0F, 0xAB, 0x00, 0xF0, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xE0, 0xFE, 0xFE,
-    0x3F, 0xFF, 0xC2, 0xFF, 0xE0, 0x07, 0x00, 0x00, 0xBE, 0x00, 0x0A, 0xE0, 0x00, 0xF8, 0x00, 0x02,
-    0x80, 0x68, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0xBE,
-    0x01, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0x40,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0xB8, 0x02, 0xFC, 0x1F, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0x0A, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x02, 0xD0, 0xBD,
-    0xF8, 0x02, 0xFE, 0x00, 0x0B, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0xFA, 0xB0,
-    0x0F, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xC0, 0x00, 0x7E, 0x0F, 0xEF, 0xE3, 0xFF, 0xFC, 0x1B,
-    0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFC, 0x00, 0xBC,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x17, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x02,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x3F, 0xFF, 0x0F, 0xFF, 0xD0,
-    0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3E, 0xA0, 0x0F, 0xFC, 0x03, 0xFF, 0x40,
-    0xE0, 0x00, 0x7F, 0x00, 0x1B, 0xC0, 0x07, 0xD0, 0x00, 0x02, 0x40, 0x24, 0x00, 0xBC, 0xBC, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x01, 0xE0, 0xBC, 0x03, 0xE0, 0x54, 0x03, 0xE0, 0x00,
-    0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x40, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03,
-    0xD0, 0x00, 0x03, 0xEA, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B,
-    0xD0, 0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x0F, 0xFF, 0xC0, 0xFF, 0xFD, 0x00, 0xF4, 0x03, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xD0, 0x0F, 0x40, 0x00, 0xFA, 0x80, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0xB8, 0xD0, 0x00, 0x3F, 0x78, 0x00, 0x1D, 0xFD, 0x00, 0x02, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xFE, 0x7F, 0x40, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3,
-    0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xC3, 0xF0, 0x03, 0xF0,
-    0xFC, 0x00, 0xFC, 0x3F, 0x40, 0x7F, 0x0F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF4,
-    0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD7, 0x00, 0xBF, 0xF0, 0x0F, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xD7, 0xC0, 0x3D, 0x7C, 0x03, 0xD3, 0xC0, 0x3E,
-    0x3C, 0x07, 0xE3, 0xD0, 0xBE, 0x3F, 0xFF, 0xE2, 0xFF, 0xFE, 0x0B, 0xFB, 0xE0, 0x00, 0x01, 0x50,
-    0x01, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xFE, 0x7F, 0x40, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03,
-    0xF4, 0xFC, 0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0xFC, 0x00,
-    0xFC, 0x3F, 0x40, 0x7F, 0x0F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF4, 0x07, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x43, 0xFF, 0xFC, 0x3F, 0xFA, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xD7, 0xC0, 0x3D, 0x7C, 0x03, 0xD3, 0xC0, 0x3E, 0x3C, 0x07,
-    0xE3, 0xD0, 0xBE, 0x3F, 0xFF, 0xE2, 0xFF, 0xFE, 0x0B, 0xFB, 0xE0, 0x01, 0x44, 0x10, 0x00, 0xFF,
-    0xFC, 0x00, 0x2F, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0xFE, 0x7F, 0x40, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFC,
-    0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x3F,
-    0x40, 0x7F, 0x0F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF4, 0x07, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x7C, 0x1F, 0xFF, 0x80, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x3D, 0x7C, 0x03, 0xD7, 0xC0, 0x3D, 0x3C, 0x03, 0xE3, 0xC0,
-    0x7E, 0x3D, 0x0B, 0xE3, 0xFF, 0xFE, 0x2F, 0xFF, 0xE0, 0xBF, 0xBE, 0x00, 0x2E, 0x00, 0x00, 0x1E,
-    0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0x9F, 0xD0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFC,
-    0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x3F,
-    0x00, 0x3F, 0x0F, 0xD0, 0x1F, 0xC3, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFD, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x3D, 0x7C, 0x03, 0xD7, 0xC0, 0x3D, 0x3C,
-    0x03, 0xE3, 0xC0, 0x7E, 0x3D, 0x0B, 0xE3, 0xFF, 0xFE, 0x2F, 0xFF, 0xE0, 0xBF, 0xBE, 0x00, 0xF8,
-    0x02, 0xF0, 0x1F, 0x80, 0x3F, 0x02, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xF8, 0x1F, 0xD0, 0x0F, 0xD0, 0x3F, 0x00, 0x3F, 0x40,
-    0xFC, 0x00, 0xFD, 0x03, 0xF0, 0x03, 0xF4, 0x0F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x3F, 0x00, 0xFC,
-    0x00, 0xFC, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xD0, 0x1F, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0xF8, 0x01, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x03,
-    0xE0, 0x2F, 0x40, 0x7E, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x03, 0xD0, 0x01, 0xF0, 0x0F, 0x40, 0x07, 0xC0, 0x3D, 0x00, 0x0F, 0x00, 0xF8, 0x00, 0x3C,
-    0x07, 0xE0, 0x00, 0xF4, 0x2F, 0x80, 0x03, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x0B, 0xFB,
-    0xE0, 0x00, 0x7F, 0x40, 0x3F, 0x9F, 0xD0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFD, 0x3F,
-    0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x3F, 0x00, 0x3F, 0x0F,
-    0xD0, 0x1F, 0xC3, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x03, 0xD7, 0xC0, 0x3D, 0x7C, 0x03, 0xD3, 0xC0, 0x3E, 0x3C, 0x07, 0xE3, 0xE0, 0xBE, 0x3F,
-    0xFF, 0xE1, 0xFF, 0xFE, 0x07, 0xFB, 0xE0, 0x00, 0xB8, 0x00, 0x1E, 0x00, 0x01, 0xFC, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x0B, 0x82, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x02, 0xF8,
-    0x2F, 0x80, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x28, 0x03, 0xF0, 0x1F, 0xC0, 0xBE, 0x07, 0xF0, 0x0F,
-    0xD0, 0xFF, 0x0B, 0xE0, 0x0F, 0xE2, 0xFF, 0x4F, 0xD0, 0x0B, 0xF3, 0xFF, 0xCF, 0xC0, 0x07, 0xFB,
-    0xFF, 0xEF, 0xC0, 0x03, 0xFF, 0xEB, 0xFF, 0x80, 0x03, 0xFF, 0xD7, 0xFF, 0x40, 0x03, 0xFF, 0xC3,
-    0xFF, 0x00, 0x02, 0xFF, 0x42, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xEF, 0x40, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x03, 0xF3, 0xE0, 0x00, 0x3E, 0x3F,
-    0x0B, 0x07, 0xD2, 0xF1, 0xFC, 0xBC, 0x1F, 0x7F, 0xDF, 0xC0, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0x40, 0xBF, 0xFF, 0xF0, 0x03, 0xF8, 0xFE, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2E, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC2, 0xF4,
-    0x02, 0xF8, 0x0F, 0xC0, 0x3F, 0x00, 0xBE, 0x0B, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0xAF, 0x80,
-    0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x07, 0xF4, 0x00, 0x7E, 0xF4, 0x0B, 0x80, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x03, 0xE2, 0xF0, 0x0F, 0x43, 0xE0, 0x7C, 0x0B, 0xD3, 0xE0,
-    0x0F, 0xCF, 0x40, 0x2F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x2F, 0x40, 0x2F, 0xFC, 0x00, 0xBF, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0xF8, 0x00,
-    0x3F, 0x1F, 0x80, 0x03, 0xF2, 0xFC, 0x00, 0x2A, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC2, 0xF4, 0x02, 0xF8, 0x0F,
-    0xC0, 0x3F, 0x00, 0xBE, 0x0B, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0xAF, 0x80, 0x00, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x74, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xEA,
-    0xA0, 0x7F, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x1D, 0x00, 0x00,
-    0xF0, 0x00, 0x07, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0xE5, 0x40,
-    0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xEA, 0xA0, 0x7F, 0xFF,
-    0xFF, 0x47, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xBC, 0x00, 0x02, 0xF4, 0x00, 0x0F,
-    0xD0, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x00,
-    0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0xE5, 0x40, 0xFF, 0xFF, 0x47,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF,
-    0xEA, 0xA0, 0x7F, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x3E, 0x0F, 0x40, 0x3F, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xFC,
-    0x00, 0x2F, 0xC0, 0x03, 0xFE, 0x54, 0x0F, 0xFF, 0xF4, 0x7F, 0xFF, 0xF0, 0x00, 0x40, 0x3F, 0xE1,
-    0xFF, 0x8B, 0xD0, 0x3F, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F,
-    0xC0, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x6F, 0xE4, 0x3C, 0x02, 0xFF, 0xFE, 0xB8, 0x0F, 0xF9, 0xBF, 0xF0, 0x1F, 0xC0, 0x0F, 0xD0, 0x3F,
-    0x00, 0x07, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x03, 0xF0, 0x3F, 0xD0, 0x1F, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x02, 0xF9, 0x3C, 0x1F, 0xFF, 0xBC, 0x3E, 0x07, 0xF0, 0x7C, 0x03, 0xE0, 0x7C, 0x03, 0xF0,
-    0x3F, 0x5B, 0xE0, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x43, 0xFF, 0xC0, 0xBC, 0x3D, 0xBC, 0x03, 0xD3, 0xCF, 0xC0,
-    0x7D, 0x2C, 0xFF, 0xFF, 0xD0, 0xCF, 0xFF, 0xFC, 0x04, 0xFF, 0xFE, 0x00, 0x0F, 0xE9, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x55, 0x00, 0x1F, 0xBF, 0xD0,
-    0x1F, 0xFA, 0xF0, 0x1F, 0xD0, 0x38, 0x1F, 0xC0, 0x3C, 0x1F, 0xC0, 0x3C, 0x1F, 0xD0, 0x3C, 0x1F,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xF4, 0x1F, 0xFF, 0xD0, 0x2F, 0x05, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0xC2, 0xF4,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x3E, 0x00,
-    0x1F, 0xC0, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0xC2, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xF1, 0x40, 0xBC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2C, 0x00, 0x3F, 0x00,
-    0x2F, 0xC0, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x40,
-    0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xFA, 0x80, 0x3F, 0xF0, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFC, 0x00, 0xBC, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xFC, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x0F, 0x1F, 0xD0, 0x0F, 0xF4, 0x7F, 0x40, 0x3F, 0x80, 0xFC, 0x00, 0xFD,
-    0x03, 0xF0, 0x03, 0xF4, 0x0F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0xFC, 0x03,
-    0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0xC0, 0x3F, 0x40, 0x7F, 0x00, 0xFF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x2D, 0x78, 0x03, 0xFC, 0x7C, 0x03, 0xF0, 0x7C, 0x03, 0xD0,
-    0x3C, 0x03, 0xE0, 0x3C, 0x07, 0xE0, 0x3D, 0x0B, 0xE0, 0x3F, 0xFF, 0xE0, 0x2F, 0xFF, 0xE0, 0x0B,
-    0xFB, 0xE0, 0x7D, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x00, 0x05, 0x03, 0x82, 0xD0, 0xF0, 0x00, 0x00,
-    0x00, 0x1E, 0x00, 0x07, 0xF4, 0x01, 0xFB, 0xE0, 0x7C, 0x0B, 0x80, 0x1F, 0x2C, 0xFE, 0xB3, 0x9F,
-    0x85, 0x14, 0x00, 0x55, 0x42, 0xFF, 0xFC, 0x3F, 0xFE, 0x80, 0x00, 0x00, 0x54, 0x2F, 0xFF, 0xFD,
-    0x7F, 0xAA, 0xA9, 0x00, 0x00, 0x0F, 0x43, 0xC3, 0xFF, 0xF0, 0x7F, 0xF0, 0x00, 0x40, 0x00, 0x29,
-    0x0F, 0xC3, 0xF1, 0xFC, 0x00, 0x00, 0x3C, 0x7C, 0x7D, 0x7D, 0xBD, 0xBD, 0x38, 0x09, 0x2C, 0x10,
-    0x1F, 0x0E, 0xE3, 0xF8, 0x7C, 0x00, 0xF8, 0x02, 0xF0, 0x1F, 0x80, 0x2F, 0x02, 0xF8, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x0B, 0x81, 0xFB, 0xE0, 0x07, 0xF8, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x07, 0xF0, 0x3F, 0x03, 0xF8, 0x2F, 0xC0, 0xA8, 0x1A, 0x91, 0xFD, 0x1F, 0xC2, 0xF8, 0x3F,
-    0x47, 0xF0, 0x2A, 0x83, 0xFC, 0x2F, 0x81, 0xFC, 0x0F, 0xD0, 0xFE, 0x0B, 0x4B, 0xD3, 0xF4, 0x2D,
-    0x01, 0x00, 0x38, 0x0F, 0x83, 0xF4, 0xE0, 0x10, 0x00, 0x29, 0x50, 0x0F, 0xFF, 0xC1, 0x56, 0xF0,
-    0x00, 0x3C, 0x00, 0x0F, 0x00, 0x1D, 0x1E, 0x2D, 0x7C, 0x20, 0x04, 0x2D, 0x38, 0x3D, 0x08, 0x00,
-    0x05, 0x00, 0xF0, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x0F, 0x00, 0x50, 0x00, 0x14, 0xBE, 0x14,
-    0x00, 0x1A, 0xBF, 0x83, 0xFF, 0xFC, 0x15, 0x55, 0x00, 0x29, 0x0F, 0x87, 0xF2, 0xFC, 0x3C, 0x3C,
-    0x7D, 0x7D, 0xBD, 0xBD, 0x00, 0x00, 0x1F, 0x0E, 0xE3, 0xF8, 0x7C, 0x2A, 0x83, 0xFC, 0x3F, 0x83,
-    0xF4, 0x7F, 0x0F, 0xE0, 0x04, 0x0B, 0x03, 0xF0, 0x9E, 0x3F, 0x4A, 0x40, 0x1E, 0x1F, 0x4F, 0x43,
-    0xFD, 0x7F, 0x40, 0x00, 0x15, 0x3E, 0x3E, 0x3E, 0x3E, 0x7E, 0x7F, 0xFD, 0xFF, 0xF7, 0xCB, 0xDF,
-    0x1F, 0x29, 0x00, 0xA0, 0x3E, 0x2F, 0x40, 0x3F, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x78, 0x00, 0x00,
-    0x24, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xF0, 0x03, 0xF7, 0xF0, 0x3E, 0x02, 0xF0, 0x3D, 0x3A, 0xFD,
-    0xEF, 0x3F, 0xBC, 0x7C, 0x1A, 0xFF, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x2A, 0xFF, 0x1F, 0xFF, 0xD5,
-    0x55, 0x40, 0x3D, 0x3A, 0xFD, 0xEF, 0x3F, 0xBC, 0x7C, 0xBF, 0xFF, 0xEF, 0xFF, 0xF0, 0x10, 0x7C,
-    0x1D, 0x7C, 0x74, 0x00, 0x00, 0x00, 0xF8, 0x7D, 0xF8, 0x7D, 0xFF, 0xFD, 0xFF, 0xFD, 0x55, 0x54,
-    0x7F, 0xF9, 0xFF, 0xE7, 0x47, 0x9D, 0x1E, 0x7F, 0xF9, 0xFF, 0xE0, 0x05, 0x60, 0xFF, 0xD3, 0x7B,
-    0x8C, 0xEA, 0x11, 0x00, 0x25, 0x40, 0xF0, 0x0F, 0x03, 0x68, 0x1F, 0x2C, 0xFE, 0xB3, 0x9F, 0x85,
-    0x14, 0x03, 0x8F, 0xAE, 0x90, 0x00, 0x74, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x8B, 0x83, 0xF3, 0xF0, 0xFC, 0xFC,
-    0x7F, 0xFD, 0xFF, 0xF7, 0xCB, 0xDF, 0x1F, 0x1A, 0xBF, 0xC3, 0xFF, 0xFC, 0x15, 0x55, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x2D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x45, 0xBD, 0x01, 0xF4, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x30, 0x3F, 0xBE, 0xBF, 0xEF, 0xF6, 0xFE, 0xB6, 0xFC, 0x03, 0x80, 0x03, 0x40, 0x0B, 0x00,
-    0x0F, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x01, 0xFC, 0x1F, 0xFF, 0xD1, 0xFC, 0x3F, 0xCB, 0xF6, 0xFC, 0x3F, 0xC1, 0xFF, 0xF4,
-    0x15, 0x5E, 0x1A, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x29, 0x7F, 0xF2, 0xEB, 0xCB, 0xFD, 0x14, 0x1A, 0x41, 0xA4, 0x14, 0x7F, 0xE3, 0xEB, 0xDF, 0x7D,
-    0x68, 0x7F, 0xC0, 0x01, 0xA4, 0x00, 0x01, 0x04, 0x03, 0xD7, 0xC0, 0x10, 0x40, 0x00, 0x18, 0x2C,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE1, 0xF4, 0x00, 0x6F, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x15, 0x54, 0x00, 0x00, 0x15, 0x50, 0x00, 0x0F, 0xFF, 0xFE, 0x01, 0xF4, 0x00, 0x6F, 0x0E,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0,
-    0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40,
-    0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0xC0, 0x7E, 0x07, 0xF0, 0x7D, 0x01,
-    0xF0, 0x7D, 0x01, 0xF0, 0x7E, 0x5B, 0xE0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xF4, 0x7D, 0x01, 0xFC,
-    0x7D, 0x00, 0xFC, 0x7F, 0xAB, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0x90, 0x3F,
-    0xFF, 0x8F, 0xFF, 0xE3, 0xEA, 0xA4, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0xF4,
-    0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0xFE, 0xF4, 0x00, 0x1F, 0x8F, 0xC0, 0x03, 0xF0, 0xBD, 0x00, 0x7E, 0x07, 0xF0, 0x0F, 0xD0, 0x3F,
-    0x41, 0xFC, 0x02, 0xFC, 0x3F, 0x40, 0x0F, 0xC3, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xD2, 0xAA,
-    0xAA, 0xA9, 0x2B, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFA, 0x55, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFD, 0x68, 0x03, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFA, 0xAA,
-    0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF5, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFD,
-    0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0xAA, 0x07,
-    0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFC, 0x3F, 0x00, 0x2F, 0x0F, 0xC0, 0x0B,
-    0xD3, 0xF0, 0x02, 0xF4, 0xFC, 0x00, 0xBD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03,
-    0xF4, 0xFE, 0xAA, 0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8, 0xFD, 0x00,
-    0xFE, 0x7F, 0x40, 0x3F, 0x9F, 0xD0, 0x0F, 0xF0, 0x00, 0x6F, 0xE4, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
-    0xFF, 0x9B, 0xF8, 0x07, 0xF0, 0x03, 0xF4, 0x3F, 0x00, 0x07, 0xF0, 0xFC, 0x6A, 0xCF, 0xC3, 0xEB,
-    0xFF, 0xBF, 0x1F, 0x95, 0x50, 0xFC, 0x3F, 0x00, 0x03, 0xF0, 0xFF, 0x40, 0x7F, 0xC3, 0xFF, 0xFF,
-    0xFF, 0x07, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x80, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC,
-    0x3F, 0x1F, 0xD0, 0x0F, 0xC3, 0xF8, 0x03, 0xF1, 0xFC, 0x00, 0xF8, 0xFD, 0x00, 0x3E, 0x7F, 0x00,
-    0x1F, 0xBF, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF8, 0x00,
-    0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0xFC, 0xFF, 0xC0, 0x3F, 0x0F, 0xFC, 0x1F, 0xC1, 0xFF,
-    0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xFE, 0x00,
-    0x01, 0xFF, 0xFC, 0x00, 0x0B, 0xFB, 0xF4, 0x00, 0x3F, 0x8F, 0xE0, 0x01, 0xFC, 0x2F, 0xC0, 0x0B,
-    0xF0, 0x3F, 0x40, 0x3F, 0x40, 0xBE, 0x00, 0xFC, 0x01, 0xFC, 0x0B, 0xE0, 0x03, 0xF4, 0x3F, 0x00,
-    0x07, 0xE0, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0xC0, 0x07, 0xF0, 0xFF, 0x40, 0x3F, 0xC3, 0xFE, 0x00,
-    0xFF, 0x0F, 0xFC, 0x0B, 0xFD, 0x3F, 0xF8, 0x3F, 0xF4, 0xFF, 0xF1, 0xFF, 0xD3, 0xFF, 0xDF, 0xFF,
-    0x4F, 0xEF, 0xFF, 0xBD, 0x3F, 0x3F, 0xFA, 0xF4, 0xFC, 0xFF, 0xDF, 0xE3, 0xF1, 0xFF, 0x3F, 0x8F,
-    0xC3, 0xF8, 0xFE, 0x7F, 0x0F, 0xD3, 0xF9, 0xFD, 0x05, 0x0F, 0xE0, 0x05, 0x40, 0x0F, 0x87, 0xF0,
-    0x03, 0xD1, 0xFE, 0x01, 0xF4, 0x7F, 0xC0, 0x7D, 0x2F, 0xF8, 0x1F, 0x4B, 0xFF, 0x07, 0xD2, 0xFB,
-    0xE2, 0xF0, 0xFE, 0xBC, 0xBC, 0x3F, 0x9F, 0xAF, 0x0F, 0xE3, 0xFF, 0xC3, 0xF8, 0x7F, 0xF0, 0xFE,
-    0x0F, 0xFC, 0x3F, 0xC2, 0xFF, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
-    0x2A, 0xAA, 0xAA, 0x00, 0x6F, 0xE4, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0x9B, 0xF8, 0x07, 0xF0,
-    0x03, 0xF4, 0x3F, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x3F, 0x1F, 0x80, 0x00,
-    0xFC, 0x3F, 0x00, 0x03, 0xF0, 0xFF, 0x40, 0x7F, 0xC3, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xFF, 0x80, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE3, 0xFF,
-    0xFE, 0x3C, 0x03, 0xE3, 0xC0, 0x3E, 0x3C, 0x03, 0xE3, 0xC0, 0x3E, 0x3C, 0x03, 0xE3, 0xC0, 0x3E,
-    0x3C, 0x03, 0xE3, 0xC0, 0x3E, 0x3C, 0x03, 0xE3, 0xC0, 0x3E, 0x28, 0x01, 0x90, 0x00, 0x00, 0x00,
-    0xBF, 0xF8, 0x02, 0xFF, 0xFD, 0x0B, 0xC0, 0xBC, 0x2F, 0x00, 0xF4, 0xFC, 0x07, 0xD3, 0xFF, 0xFF,
-    0x4F, 0xFF, 0xFC, 0x3F, 0xFF, 0x80, 0xFE, 0x90, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40,
-    0x00, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x7E, 0x00,
-    0x2F, 0x80, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0xC2, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xF7, 0xFF, 0xFF, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x0F, 0xC2, 0xF4, 0x02, 0xF8, 0x0F,
-    0xC0, 0x3F, 0x00, 0xBE, 0x0B, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0xAF, 0x80, 0x00, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xFF, 0x01, 0xFD, 0x3E, 0x1F, 0xE0, 0xFE, 0x0F, 0x81, 0xFD, 0x7F, 0x03, 0xE0, 0x3F, 0xAF,
-    0xC0, 0xF8, 0x0F, 0xFB, 0xF0, 0x3E, 0x03, 0xFD, 0xFD, 0x0F, 0x81, 0xFE, 0x7F, 0xFB, 0xFB, 0xFF,
-    0x4F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x80, 0x0B, 0xC0, 0xFC, 0x00,
-    0xF8, 0x07, 0xF0, 0x3F, 0x00, 0x2F, 0x4B, 0xD0, 0x00, 0xFD, 0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x3F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x02, 0xFE, 0xFD,
-    0x00, 0x7F, 0x4F, 0xF0, 0x0F, 0xF0, 0x3F, 0xC3, 0xFC, 0x02, 0xFE, 0x14, 0x02, 0x45, 0x4F, 0x40,
-    0xF2, 0xE3, 0xD0, 0x3C, 0xB8, 0xF4, 0x0F, 0x3D, 0x3E, 0x03, 0xCF, 0x4B, 0xC1, 0xFB, 0xC1, 0xFD,
-    0x7F, 0xF0, 0x3F, 0xFF, 0xF4, 0x03, 0xFF, 0xF8, 0x00, 0x1B, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x19, 0x00, 0x01,
-    0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x01, 0xFD, 0x1F, 0xC0, 0xFC, 0x00, 0xF8, 0x7D, 0x00, 0x2F, 0x1F,
-    0x00, 0x07, 0xCB, 0xC0, 0x01, 0xF6, 0xF0, 0x00, 0x7D, 0xBC, 0x00, 0x1F, 0x5F, 0x40, 0x0F, 0xC2,
-    0xF0, 0x0B, 0xD3, 0xFF, 0x4F, 0xFD, 0xFF, 0xD3, 0xFF, 0xBF, 0xF4, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFB, 0x80, 0x1F, 0xFF, 0xC0, 0x3D, 0x0F, 0xC0, 0x38, 0x07, 0xC0, 0x74,
-    0x03, 0xC0, 0x74, 0x07, 0xD0, 0x3F, 0xFF, 0xD1, 0x2F, 0xFF, 0xFE, 0x0B, 0xF7, 0xFE, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x0F, 0xFD, 0x00, 0xBF,
-    0xFD, 0x02, 0xF9, 0xFC, 0x0F, 0x80, 0xF4, 0x3D, 0x03, 0xD0, 0xF6, 0xFF, 0x03, 0xDB, 0xFD, 0x0F,
-    0x45, 0xFC, 0x3E, 0x00, 0xF8, 0xFF, 0xEF, 0xD3, 0xFF, 0xFF, 0x4F, 0xFF, 0xFC, 0x3D, 0x2F, 0x80,
-    0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x02, 0xF0, 0xBC, 0x07, 0xC0, 0xF4, 0x1F,
-    0x03, 0xF0, 0x7C, 0x07, 0xE2, 0xF0, 0x0F, 0xCF, 0xC0, 0x1F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0x80, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x42, 0xFF, 0xFD, 0x0B, 0xC1, 0x64, 0x1F, 0xC0, 0x00,
-    0x2F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0xE0, 0x0F, 0xFF, 0xE0, 0xBF, 0x5F, 0xC3, 0xF0, 0x1F,
-    0x8F, 0xC0, 0x7E, 0x3F, 0x86, 0xF4, 0xBF, 0xFF, 0xC0, 0xBF, 0xFD, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x3F, 0xC0, 0xB0, 0xE0, 0xB0, 0x00, 0x3F, 0x00, 0xB9, 0x50, 0xF0, 0xF0, 0xBF, 0xF0, 0x2F, 0x80,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0xFF, 0xF8, 0x0B, 0xE0, 0x0B, 0xD0, 0x07, 0xD0, 0x03, 0xF0, 0x00,
-    0xF4, 0x00, 0x3E, 0x00, 0x07, 0xFE, 0x40, 0x7F, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x80,
-    0x2F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x0B, 0xFF, 0xF0, 0x0B, 0xE1, 0xF8,
-    0x0F, 0xC0, 0xBC, 0x0F, 0x80, 0x7C, 0x0F, 0xC0, 0x7C, 0x0F, 0xC0, 0xBC, 0x0F, 0xC0, 0xBC, 0x0F,
-    0xC0, 0xBC, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xBE, 0x00, 0xF0, 0x3D, 0x0B, 0x80, 0xB8, 0x3E,
-    0x01, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xC0, 0xBC, 0x3F, 0x03, 0xF0, 0xFD, 0x1F, 0xC2,
-    0xFF, 0xFE, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x06, 0xE4, 0x00, 0x29, 0x03, 0xD0, 0x3D, 0x03,
-    0xD0, 0x3D, 0x03, 0xD0, 0x3E, 0x03, 0xE0, 0x3F, 0x03, 0xF5, 0x3F, 0xE3, 0xFD, 0x0E, 0x3E, 0x01,
-    0xE7, 0xC0, 0x1E, 0xF4, 0x02, 0xFE, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xDF,
-    0xD0, 0x3C, 0x3F, 0x80, 0x3E, 0x40, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0x00, 0x00,
-    0xBC, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x80, 0x2F, 0x6F, 0x00,
-    0xF8, 0x7C, 0x0B, 0xC0, 0xF4, 0x3E, 0x02, 0xF2, 0xF0, 0x07, 0xC0, 0x2E, 0x00, 0xF4, 0xFC, 0x03,
-    0xD3, 0xF0, 0x0F, 0x4F, 0xC0, 0x3E, 0x3F, 0x01, 0xF8, 0xFD, 0x0B, 0xE3, 0xFF, 0xFF, 0x8F, 0xFF,
-    0xFE, 0x3E, 0xFE, 0xF8, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x3D, 0x02, 0xF0, 0xBC, 0x07, 0xC0,
-    0xF4, 0x1F, 0x03, 0xF0, 0x7C, 0x07, 0xE2, 0xF0, 0x0F, 0xCF, 0xC0, 0x1F, 0xFE, 0x00, 0x3F, 0xF0,
-    0x00, 0xFF, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x83, 0xFF, 0xE0,
-    0x1F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x7F, 0xC0, 0x2F, 0x90, 0x0F, 0x80, 0x02, 0xFF, 0x00,
-    0x3F, 0xF0, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x2F, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x01,
-    0xFF, 0xF8, 0x3E, 0x07, 0xD7, 0xC0, 0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F, 0xFF, 0xD1, 0xFF,
-    0xF8, 0x02, 0xFD, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x0B, 0xC7, 0xD0, 0x0B, 0xC7, 0xC0,
-    0x0B, 0xC7, 0xC0, 0x0B, 0x8B, 0xC0, 0x0F, 0x8B, 0x80, 0x0F, 0x8F, 0xF0, 0x0F, 0x4B, 0xF0, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x01, 0xFE, 0xF4, 0x03, 0xE0, 0x3C, 0x07, 0xD0,
-    0x2C, 0x0B, 0xD0, 0x2D, 0x0F, 0xE0, 0x3C, 0x0F, 0xFE, 0xFC, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0,
-    0x2F, 0x5A, 0x40, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x01, 0xFF, 0xE0, 0xF8, 0x3C, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0B, 0xE0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x02, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD,
-    0x3E, 0x07, 0xD0, 0x7C, 0x03, 0xE0, 0x7C, 0x03, 0xF0, 0x3F, 0x5B, 0xE0, 0x3F, 0xFF, 0xD0, 0x1F,
-    0xFF, 0x80, 0x02, 0xFD, 0x00, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0x0B, 0xC0, 0x00, 0x2E, 0x00,
-    0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x3E, 0x0F, 0x07, 0xC3, 0xC0, 0xF4, 0xF4, 0x2E, 0x3D, 0x0B, 0x8F, 0x82, 0xF2, 0xFA,
-    0xFC, 0xBF, 0xFE, 0x0F, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFB, 0xFC, 0x07, 0xE2, 0xD3, 0xF4, 0x3F, 0x0B, 0x43, 0xF0, 0xFC, 0x2D, 0x0F, 0xC3, 0xE0, 0xB4,
-    0x3F, 0x1F, 0x83, 0xD0, 0xFC, 0x3F, 0x0F, 0x43, 0xF0, 0xFE, 0x3D, 0x2F, 0xC3, 0xFF, 0xFF, 0xFF,
-    0x07, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x80, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x90,
-    0x0B, 0xC2, 0xFE, 0x07, 0xD0, 0xBF, 0xE3, 0xE0, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0x7F, 0x80, 0x3F,
-    0xCB, 0xFF, 0x2F, 0xC0, 0xFF, 0xCF, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x00, 0x0E, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0xF7, 0x80, 0xF3, 0xCF, 0x03, 0xCB, 0x2D, 0x0F,
-    0x6C, 0x78, 0x3D, 0xB1, 0xF0, 0xF9, 0xC7, 0xC2, 0xFB, 0x6F, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xD0,
-    0x0F, 0xFD, 0x00, 0x07, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x03, 0xD0, 0x0F, 0x80, 0x2F, 0x02, 0xF0, 0x00,
-    0xF0, 0x3E, 0x1D, 0x0F, 0x43, 0xE1, 0xD0, 0xF4, 0x3E, 0x1E, 0x0F, 0x43, 0xFB, 0xFB, 0xF0, 0x1F,
-    0xFF, 0xFE, 0x00, 0x7F, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02,
-    0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xB8, 0x1F, 0xFF, 0xC3, 0xD0, 0xFC, 0x38, 0x07, 0xC7, 0x40, 0x3C, 0x74, 0x07, 0xD3, 0xFF,
-    0xFD, 0x2F, 0xFF, 0xE0, 0xBF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x1F, 0x40,
-    0x02, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x40, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02,
-    0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x1C, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x1F,
-    0xFF, 0xC3, 0xD0, 0xFC, 0x38, 0x07, 0xC7, 0x40, 0x3C, 0x74, 0x07, 0xD3, 0xFF, 0xFD, 0x2F, 0xFF,
-    0xE0, 0xBF, 0x7E, 0x00, 0x01, 0x40, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x01,
-    0xF4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xAF, 0x00, 0x01, 0xF4, 0xF4, 0x00, 0x2F,
-    0x0F, 0xC0, 0x03, 0xF0, 0xBD, 0x00, 0x7E, 0x07, 0xE0, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8,
-    0x2F, 0xFF, 0xFF, 0xC3, 0xF4, 0x00, 0xFD, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x02,
-    0xC0, 0x01, 0x0F, 0x00, 0x2E, 0xB8, 0x02, 0xFD, 0x00, 0x2F, 0xBD, 0x01, 0xE0, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xEE, 0x01, 0xFF, 0xFC, 0x0F, 0x43, 0xF0, 0x38, 0x07, 0xC1, 0xD0,
-    0x0F, 0x07, 0x40, 0x7D, 0x0F, 0xFF, 0xF4, 0x2F, 0xFF, 0xE0, 0x2F, 0xDF, 0x80, 0x3E, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x74, 0x00, 0x02, 0xF5, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0x47,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x1F, 0x4F,
-    0x40, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFC, 0x03, 0xF4, 0x00, 0xFD, 0x07, 0xF0, 0x00,
-    0xFE, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xEF, 0x40, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x0E,
-    0x01, 0xF0, 0x00, 0x74, 0x03, 0xC0, 0x01, 0xD0, 0x1F, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x0B, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0xC0, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0,
-    0x00, 0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF,
-    0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE,
-    0x00, 0x00, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x74, 0x00, 0xB0, 0x90, 0x02,
-    0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x2E, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB,
-    0x80, 0x1F, 0xFF, 0xC0, 0x3D, 0x0F, 0xC0, 0x38, 0x07, 0xC0, 0x74, 0x03, 0xC0, 0x74, 0x07, 0xD0,
-    0x3F, 0xFF, 0xD0, 0x2F, 0xFF, 0xE0, 0x0B, 0xF7, 0xE0, 0x00, 0x28, 0x60, 0x00, 0x0B, 0xE7, 0x00,
-    0x00, 0xF7, 0xF0, 0x00, 0x06, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x1F, 0x4F,
-    0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x03, 0xC7, 0x00,
-    0xBF, 0x70, 0x0F, 0x7F, 0x00, 0x61, 0x90, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x02, 0xFC, 0x00, 0xFF,
-    0xF0, 0x3E, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0x81, 0xFF, 0xFC, 0x3D, 0x0F, 0xC3, 0x80, 0x7C,
-    0x74, 0x03, 0xC7, 0x40, 0x7D, 0x3F, 0xFF, 0xD2, 0xFF, 0xFE, 0x0B, 0xF7, 0xE0, 0x00, 0x07, 0x40,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0xFA, 0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0,
-    0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7,
-    0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x01, 0xFD, 0x00, 0x7E, 0xF4, 0x1F,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x1F, 0xFF, 0xC3, 0xD0, 0xFC, 0x38, 0x07,
-    0xC7, 0x40, 0x3C, 0x74, 0x07, 0xD3, 0xFF, 0xFD, 0x2F, 0xFF, 0xE0, 0xBF, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x1F, 0x40, 0x02, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
-    0x40, 0x01, 0xFA, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x0F, 0xAF, 0x00, 0x01, 0xF4, 0xF4, 0x00, 0x2F, 0x0F, 0xC0, 0x03, 0xF0, 0xBD, 0x00, 0x7E,
-    0x07, 0xE0, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xC3, 0xF4, 0x00, 0xFD,
-    0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x3C, 0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x07, 0xC1, 0xFF, 0xF8, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFB, 0x81, 0xFF, 0xFC, 0x3D, 0x0F, 0xC3, 0x80, 0x7C, 0x74, 0x03, 0xC7, 0x40,
-    0x7D, 0x3F, 0xFF, 0xD2, 0xFF, 0xFE, 0x0B, 0xF7, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x40, 0x01, 0xFA,
-    0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xAF,
-    0x00, 0x01, 0xF4, 0xF4, 0x00, 0x2F, 0x0F, 0xC0, 0x03, 0xF0, 0xBD, 0x00, 0x7E, 0x07, 0xE0, 0x0F,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xC3, 0xF4, 0x00, 0xFD, 0x7F, 0x00, 0x0F,
-    0xE0, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x07, 0xC1, 0xFF, 0xF8, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFB, 0x81, 0xFF, 0xFC, 0x3D, 0x0F, 0xC3, 0x80, 0x7C, 0x74, 0x03, 0xC7, 0x40, 0x7D, 0x3F, 0xFF,
-    0xD2, 0xFF, 0xFE, 0x0B, 0xF7, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x14, 0x00, 0x1F,
-    0xAF, 0xC0, 0x00, 0xFF, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA,
-    0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00,
-    0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xFD, 0x00, 0x01, 0xC0, 0x00, 0x74, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x02, 0xFA, 0xF8, 0x0F, 0xFF, 0x40, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x81, 0xFF, 0xFC, 0x3D, 0x0F, 0xC3, 0x80, 0x7C, 0x74, 0x03,
-    0xC7, 0x40, 0x7D, 0x3F, 0xFF, 0xD2, 0xFF, 0xFE, 0x0B, 0xF7, 0xE0, 0x00, 0x28, 0x60, 0x00, 0x0B,
-    0xE7, 0x00, 0x00, 0xF7, 0xF0, 0x00, 0x0A, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x14, 0x00, 0x1F, 0xAF, 0xC0, 0x00, 0xFF, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B,
-    0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F,
-    0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x07, 0xC7, 0x00, 0xBF, 0xF0, 0x0F, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x07, 0xC1, 0xFF, 0xF8, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x81, 0xFF, 0xFC, 0x3D, 0x0F, 0xC3, 0x80, 0x7C, 0x74, 0x03,
-    0xC7, 0x40, 0x7D, 0x3F, 0xFF, 0xD2, 0xFF, 0xFE, 0x0B, 0xF7, 0xE0, 0x00, 0x40, 0x14, 0x00, 0x1F,
-    0xAF, 0xC0, 0x00, 0xFF, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA,
-    0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00,
-    0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x1A, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x7C, 0x1F, 0xFF, 0x80, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x1F, 0xFF, 0xC3, 0xD0, 0xFC, 0x38, 0x07, 0xC7, 0x40,
-    0x3C, 0x74, 0x07, 0xD3, 0xFF, 0xFD, 0x2F, 0xFF, 0xE0, 0xBF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x1F, 0x40, 0x02, 0xF8, 0x00, 0x3F, 0x80, 0x2B, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3,
-    0xFA, 0x55, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x68, 0x03, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFA, 0xAA, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF5, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3F,
-    0x40, 0x00, 0xA9, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5,
-    0x47, 0xD0, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0xD0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFE, 0x95, 0x43, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x5A, 0x00,
-    0xFF, 0xFD, 0x03, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFE, 0xAA, 0x83, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xFD, 0x7F, 0xFF, 0xF8, 0x00, 0xB4, 0x00, 0x01, 0xC0, 0x00, 0x34, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E,
-    0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF,
-    0x40, 0x01, 0x82, 0x00, 0x0F, 0xCE, 0x00, 0x77, 0xF4, 0x01, 0xD7, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFE, 0x95, 0x43, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x5A, 0x00, 0xFF, 0xFD, 0x03, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFE, 0xAA, 0x83, 0xFF, 0xFF, 0x1F, 0xFF, 0xFD, 0x7F, 0xFF, 0xF8, 0x03, 0xC7, 0x00, 0xBF, 0x70,
-    0x0F, 0x7F, 0x00, 0x61, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF,
-    0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xFE, 0x01,
-    0x40, 0x3E, 0xFC, 0x38, 0x0F, 0x42, 0xFB, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xBF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFA, 0x55, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x5A, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xFA, 0xAA, 0x00, 0x3F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF8, 0x00,
-    0x00, 0x78, 0x01, 0x40, 0x3F, 0x41, 0xE0, 0x3F, 0xF4, 0xF4, 0x3D, 0x1F, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFB, 0xE0,
-    0x03, 0xE1, 0x7C, 0x00, 0xFF, 0xFF, 0x80, 0x7E, 0xA5, 0x40, 0x1F, 0x40, 0x00, 0x03, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B,
-    0xE0, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xBF, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x00, 0xFE, 0x95, 0x40, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD6, 0x80, 0x00, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0xAA, 0x80, 0x0F, 0xFF, 0xFC, 0x01, 0xFF,
-    0xFF, 0xD0, 0x1F, 0xFF, 0xFE, 0x3D, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x1E, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0x47, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFE, 0xF8, 0x00, 0xF8, 0x5F, 0x00,
-    0x3F, 0xFF, 0xE0, 0x1F, 0xA9, 0x50, 0x07, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xE0,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x0F, 0x18, 0x00, 0xFE,
-    0x00, 0x0F, 0xBF, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0x0F, 0xE9, 0x54, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF5, 0xA0, 0x0F, 0xFF, 0xD0, 0x3F,
-    0xFF, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xEA, 0xA8, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x28, 0x00, 0xB4, 0x90, 0x01,
-    0xFC, 0x00, 0x07, 0xFF, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x0F, 0xEF, 0x80, 0x3E, 0x17, 0xC0, 0x3F, 0xFF, 0xE0,
-    0x7E, 0xA5, 0x40, 0x7D, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x02,
-    0xE3, 0x40, 0x0F, 0xDE, 0x00, 0x77, 0xF4, 0x00, 0x92, 0x80, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x1F, 0xD0, 0x01, 0xFB, 0xD0, 0x1F, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0x0F, 0xFF, 0xFC,
-    0x3F, 0xA5, 0x50, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD6, 0x80, 0x3F, 0xFF, 0x40, 0xFF, 0xFC,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xAA, 0xA0, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0xFF,
-    0xFE, 0x02, 0x86, 0x00, 0xBF, 0xF0, 0x0F, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x0F, 0xD0,
-    0x03, 0xFF, 0x40, 0xF4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF,
-    0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0xFB,
-    0xF0, 0x0F, 0x42, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFE,
-    0x95, 0x43, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x5A, 0x00, 0xFF, 0xFD, 0x03, 0xFF, 0xF0, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFE, 0xAA, 0x83, 0xFF, 0xFF, 0x1F, 0xFF, 0xFD, 0x7F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xD0,
-    0x00, 0x2A, 0x40, 0x00, 0x78, 0x00, 0x0F, 0xD0, 0x03, 0xFF, 0x40, 0xF4, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF,
-    0xFE, 0x7E, 0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x0A, 0x90, 0x00,
-    0x07, 0xC0, 0x30, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F,
-    0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x1F, 0xD0, 0x00, 0x3D, 0x0A, 0x1C, 0x00,
-    0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x7C, 0x7D, 0x7D, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC,
-    0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x06, 0x83, 0xF0, 0xFC, 0x7F, 0x00, 0x7D, 0xBD, 0xBE, 0xA9, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x7C, 0x7C, 0x7D, 0x7D, 0x00, 0x00, 0x00, 0x28, 0x7D, 0xBE, 0xFE, 0x00, 0x6F, 0xE4, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0x9B, 0xF8, 0x07, 0xF0, 0x03, 0xF4, 0x3F, 0x00, 0x07, 0xF0, 0xFC,
-    0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0xFC, 0x3F, 0x00, 0x03, 0xF0, 0xFF, 0x40,
-    0x7F, 0xC3, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x80, 0x06, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x02,
-    0xFD, 0x01, 0xFF, 0xF8, 0x3E, 0x07, 0xD7, 0xC0, 0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F, 0xFF,
-    0xD1, 0xFF, 0xF8, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1A, 0x80, 0x00, 0x07, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE,
-    0x40, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xF9, 0xBF, 0x80, 0x7F, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x7F,
-    0x0F, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F,
-    0xF4, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF8, 0x00, 0x6F,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xC0, 0x00, 0x34, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xF8, 0x3E, 0x07, 0xD7, 0xC0, 0x3E, 0x7C,
-    0x03, 0xF3, 0xF5, 0xBE, 0x3F, 0xFF, 0xD1, 0xFF, 0xF8, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x3F, 0x40, 0x50, 0x03, 0xFF, 0x47, 0x80, 0x3D, 0x0F, 0x7D, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x01, 0x40, 0x06, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xF9, 0xBF, 0x80, 0x7F, 0x00,
-    0x3F, 0x43, 0xF0, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x0F,
-    0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0xF4, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x40,
-    0xBF, 0xFF, 0xF8, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1D,
-    0x03, 0x80, 0x1F, 0xC2, 0xD0, 0x1F, 0xFD, 0xF0, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0x81, 0xF4, 0x07, 0xC0, 0x3E, 0x01, 0xF0,
-    0x0F, 0xC0, 0x3F, 0x5B, 0xE0, 0x0F, 0xFF, 0xF4, 0x01, 0xFF, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0x00, 0x00, 0x2F, 0x8F, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x0F, 0x43, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9,
-    0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x3F, 0xE6, 0xFE, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x0F, 0xC0,
-    0x01, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x03, 0xF0, 0x0F,
-    0xC0, 0x00, 0xFC, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x7F, 0x1D, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x1F, 0x47,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0x81,
-    0xF4, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0xC0, 0x3F, 0x5B, 0xE0, 0x0F, 0xFF, 0xF4, 0x01, 0xFF,
-    0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xE1, 0xF4, 0x00, 0x05, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0x9B, 0xF8, 0x07, 0xF0,
-    0x03, 0xF4, 0x3F, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x3F, 0x1F, 0x80, 0x00,
-    0xFC, 0x3F, 0x00, 0x03, 0xF0, 0xFF, 0x40, 0x7F, 0xC3, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xFF, 0x80, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x00,
-    0x00, 0xAC, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xB4, 0x00, 0xF4, 0x80, 0x02, 0xFC, 0x00, 0x0B, 0xEF,
-    0x00, 0x2E, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x3E, 0x07, 0xD0,
-    0x7C, 0x03, 0xE0, 0x7C, 0x03, 0xF0, 0x3F, 0x5B, 0xE0, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x02,
-    0xFD, 0x00, 0x00, 0x14, 0x20, 0x00, 0x01, 0xFC, 0xD0, 0x00, 0x0B, 0x7F, 0x40, 0x00, 0x18, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x01, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x0F,
-    0xF9, 0xBF, 0x80, 0x7F, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0xFC, 0x3E, 0x00,
-    0x03, 0xF1, 0xF8, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0xF4, 0x07, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF8, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x86, 0x00, 0xBE, 0x70, 0x0F, 0xBF, 0x00, 0xF2, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x02,
-    0xFC, 0x00, 0xBF, 0xF0, 0x2E, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xF8, 0x3E, 0x07,
-    0xD7, 0xC0, 0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F, 0xFF, 0xD1, 0xFF, 0xF8, 0x02, 0xFD, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3D, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xF9,
-    0xBF, 0x80, 0x7F, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x03,
-    0xF1, 0xF8, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0xF4, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF8, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x74, 0x00, 0x1F, 0xC0, 0x07, 0xFF,
-    0x41, 0xF4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xF8, 0x3E, 0x07, 0xD7,
-    0xC0, 0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F, 0xFF, 0xD1, 0xFF, 0xF8, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x2A, 0x40,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x6F, 0xE4, 0x3C, 0x02, 0xFF, 0xFE, 0xB8,
-    0x0F, 0xF9, 0xBF, 0xF0, 0x1F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x03, 0xF0,
-    0x3E, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x3F, 0xD0, 0x1F, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x02, 0xF9, 0x3C, 0x1F, 0xFF, 0xBC, 0x3E, 0x07, 0xF0, 0x7C,
-    0x03, 0xE0, 0x7C, 0x03, 0xF0, 0x3F, 0x5B, 0xE0, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x02, 0xFD,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x6F, 0xE4, 0x3C, 0x02, 0xFF, 0xFE,
-    0xB8, 0x0F, 0xF9, 0xBF, 0xF0, 0x1F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x03,
-    0xF0, 0x3E, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x3F, 0xD0, 0x1F,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x02, 0xF9, 0x3C, 0x1F, 0xFF, 0xBC, 0x3E, 0x07, 0xF0,
-    0x7C, 0x03, 0xE0, 0x7C, 0x03, 0xF0, 0x3F, 0x5B, 0xE0, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x02,
-    0xFD, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x6F, 0xE4, 0x3C, 0x02, 0xFF,
-    0xFE, 0xB8, 0x0F, 0xF9, 0xBF, 0xF0, 0x1F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x07, 0xF0, 0x3F, 0x00,
-    0x03, 0xF0, 0x3E, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x3F, 0xD0,
-    0x1F, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xBF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x02, 0xF9, 0x3C, 0x1F, 0xFF, 0xBC, 0x3E, 0x07,
-    0xF0, 0x7C, 0x03, 0xE0, 0x7C, 0x03, 0xF0, 0x3F, 0x5B, 0xE0, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0x80,
-    0x02, 0xFD, 0x00, 0x00, 0x2E, 0x38, 0x00, 0x00, 0x3F, 0x78, 0x00, 0x00, 0x36, 0xF4, 0x00, 0x00,
-    0x24, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x6F, 0xE4, 0x3C, 0x02,
-    0xFF, 0xFE, 0xB8, 0x0F, 0xF9, 0xBF, 0xF0, 0x1F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x07, 0xF0, 0x3F,
-    0x00, 0x03, 0xF0, 0x3E, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x3F,
-    0xD0, 0x1F, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x80, 0x01,
-    0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x46, 0x00, 0x0B, 0xE7, 0x00, 0x0F, 0x7F, 0x00,
-    0x06, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3C, 0x02, 0xF9, 0x3C, 0x1F,
-    0xFF, 0xBC, 0x3E, 0x07, 0xF0, 0x7C, 0x03, 0xE0, 0x7C, 0x03, 0xF0, 0x3F, 0x5B, 0xE0, 0x3F, 0xFF,
-    0xD0, 0x1F, 0xFF, 0x80, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x6F, 0xE4, 0x3C, 0x02, 0xFF, 0xFE, 0xB8, 0x0F, 0xF9, 0xBF, 0xF0, 0x1F, 0xC0, 0x0F, 0xD0, 0x3F,
-    0x00, 0x07, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x03, 0xF0, 0x3F, 0xD0, 0x1F, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x02, 0xF9, 0x3C,
-    0x1F, 0xFF, 0xBC, 0x3E, 0x07, 0xF0, 0x7C, 0x03, 0xE0, 0x7C, 0x03, 0xF0, 0x3F, 0x5B, 0xE0, 0x3F,
-    0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xA8, 0x00, 0x7F, 0x40, 0x3F,
-    0x9F, 0xD0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F,
-    0xD3, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x3F, 0x00, 0x3F, 0x0F, 0xD0, 0x1F, 0xC3, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0A, 0x80, 0x00, 0x78, 0x03, 0xD7, 0xC0, 0x3D, 0x7C, 0x03, 0xD3, 0xC0, 0x3E, 0x3C,
-    0x07, 0xE3, 0xD0, 0xBE, 0x3F, 0xFF, 0xE2, 0xFF, 0xFE, 0x0B, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x01, 0xF8, 0x00, 0x2F, 0x80, 0x01, 0xA8, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xFE, 0x7F, 0x40, 0x3F, 0x4F, 0xC0, 0x0F,
-    0xD3, 0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xC3, 0xF0, 0x03,
-    0xF0, 0xFC, 0x00, 0xFC, 0x3F, 0x40, 0x7F, 0x0F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
-    0xF4, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xC0, 0x00, 0x34, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xD7, 0xC0, 0x3D, 0x7C, 0x03, 0xD3, 0xC0,
-    0x3E, 0x3C, 0x07, 0xE3, 0xD0, 0xBE, 0x3F, 0xFF, 0xE2, 0xFF, 0xFE, 0x0B, 0xFB, 0xE0, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x1F, 0xD0, 0x0F, 0xF4, 0x7F, 0x40, 0x3F, 0x80,
-    0xFC, 0x00, 0xFD, 0x03, 0xF0, 0x03, 0xF4, 0x0F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x3F, 0x40, 0xFC,
-    0x00, 0xFC, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0xC0, 0x3F, 0x40, 0x7F, 0x00, 0xFF, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xF0, 0x14, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x2D, 0x78, 0x03, 0xFC, 0x7C, 0x03, 0xF0, 0x7C, 0x03, 0xD0, 0x3C, 0x03, 0xE0, 0x3C,
-    0x07, 0xE0, 0x3D, 0x0B, 0xE0, 0x3F, 0xFF, 0xE0, 0x2F, 0xFF, 0xE0, 0x0B, 0xFB, 0xE0, 0x01, 0xF4,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x1F, 0xD0, 0x0F, 0xF4, 0x7F, 0x40, 0x3F, 0x80,
-    0xFC, 0x00, 0xFD, 0x03, 0xF0, 0x03, 0xF4, 0x0F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x3F, 0x40, 0xFC,
-    0x00, 0xFC, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0xC0, 0x3F, 0x40, 0x7F, 0x00, 0xFF, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x1D,
-    0x00, 0x00, 0x2D, 0x78, 0x03, 0xFC, 0x7C, 0x03, 0xF0, 0x7C, 0x03, 0xD0, 0x3C, 0x03, 0xE0, 0x3C,
-    0x07, 0xE0, 0x3D, 0x0B, 0xE0, 0x3F, 0xFF, 0xE0, 0x2F, 0xFF, 0xE0, 0x0B, 0xFB, 0xE0, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x1F, 0xD0, 0x0F, 0xF4, 0x7F, 0x40, 0x3F, 0x80,
-    0xFC, 0x00, 0xFD, 0x03, 0xF0, 0x03, 0xF4, 0x0F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x3F, 0x40, 0xFC,
-    0x00, 0xFC, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0xC0, 0x3F, 0x40, 0x7F, 0x00, 0xFF, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x34, 0x00, 0x00, 0x10, 0x14, 0x00, 0x00, 0x1D,
-    0x00, 0x00, 0x2D, 0x78, 0x03, 0xFC, 0x7C, 0x03, 0xF0, 0x7C, 0x03, 0xD0, 0x3C, 0x03, 0xE0, 0x3C,
-    0x07, 0xE0, 0x3D, 0x0B, 0xE0, 0x3F, 0xFF, 0xE0, 0x2F, 0xFF, 0xE0, 0x0B, 0xFB, 0xE0, 0x00, 0xB8,
-    0xD0, 0x00, 0x03, 0xF7, 0x80, 0x00, 0x1D, 0xFD, 0x00, 0x00, 0x24, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x1F, 0xD0, 0x0F, 0xF4, 0x7F, 0x40, 0x3F, 0x80,
-    0xFC, 0x00, 0xFD, 0x03, 0xF0, 0x03, 0xF4, 0x0F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x3F, 0x40, 0xFC,
-    0x00, 0xFC, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0xC0, 0x3F, 0x40, 0x7F, 0x00, 0xFF, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xD7, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x2D, 0x78, 0x03, 0xFC, 0x7C, 0x03, 0xF0, 0x7C, 0x03, 0xD0, 0x3C, 0x03, 0xE0, 0x3C,
-    0x07, 0xE0, 0x3D, 0x0B, 0xE0, 0x3F, 0xFF, 0xE0, 0x2F, 0xFF, 0xE0, 0x0B, 0xFB, 0xE0, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x1F, 0xD0, 0x0F, 0xF4, 0x7F, 0x40, 0x3F,
-    0x80, 0xFC, 0x00, 0xFD, 0x03, 0xF0, 0x03, 0xF4, 0x0F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x3F, 0x40,
-    0xFC, 0x00, 0xFC, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0xC0, 0x3F, 0x40, 0x7F, 0x00, 0xFF,
-    0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x2D, 0x78, 0x03, 0xFC, 0x7C, 0x03, 0xF0, 0x7C, 0x03, 0xD0, 0x3C, 0x03,
-    0xE0, 0x3C, 0x07, 0xE0, 0x3D, 0x0B, 0xE0, 0x3F, 0xFF, 0xE0, 0x2F, 0xFF, 0xE0, 0x0B, 0xFB, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x01,
-    0xF8, 0x00, 0x02, 0xF8, 0x00, 0x01, 0xA8, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0xFC, 0x2F, 0x40, 0x2F, 0x80, 0xFC, 0x03, 0xF0, 0x0B, 0xE0, 0xBE, 0x00, 0x3F,
-    0x0F, 0xC0, 0x02, 0xFA, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x3E, 0x2F, 0x00, 0xF4, 0x3E, 0x07, 0xC0, 0xBD, 0x3E,
-    0x00, 0xFC, 0xF4, 0x02, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x02, 0xF4, 0x02, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x0F, 0xC2,
-    0xF4, 0x02, 0xF8, 0x0F, 0xC0, 0x3F, 0x00, 0xBE, 0x0B, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0xAF,
-    0x80, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x3D, 0x00, 0xF8,
-    0x0B, 0xC0, 0x3D, 0x00, 0xF8, 0x1F, 0x00, 0x2F, 0x4F, 0x80, 0x03, 0xF3, 0xD0, 0x00, 0xBF, 0xF0,
-    0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0,
-    0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xF4, 0x3E, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01,
-    0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0xFC, 0x2F, 0x40, 0x2F, 0x80, 0xFC, 0x03, 0xF0, 0x0B, 0xE0, 0xBE, 0x00, 0x3F,
-    0x0F, 0xC0, 0x02, 0xFA, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x03, 0xE2, 0xF0, 0x0F,
-    0x43, 0xE0, 0x7C, 0x0B, 0xD3, 0xE0, 0x0F, 0xCF, 0x40, 0x2F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xBF,
-    0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x2F, 0xFC, 0x00, 0xBF, 0xD0, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x24, 0x90, 0x00, 0x0F, 0xDB, 0x00, 0x00, 0xEF, 0xE0, 0x00, 0x0D, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0xFC, 0x2F, 0x40, 0x2F, 0x80, 0xFC, 0x03, 0xF0, 0x0B, 0xE0, 0xBE, 0x00,
-    0x3F, 0x0F, 0xC0, 0x02, 0xFA, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x01, 0xF2, 0xC0, 0x0F, 0xFF, 0x00, 0x38, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0xBC, 0x03, 0xD0, 0xF8,
-    0x1F, 0x02, 0xF4, 0xF8, 0x03, 0xF3, 0xD0, 0x0B, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xD0, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0xBE, 0x00, 0x00,
-    0xBF, 0xFF, 0xEF, 0xFF, 0xF0, 0xBF, 0xFF, 0xEF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF4, 0x55, 0x55, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF1, 0x55, 0x55, 0x55, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF1, 0x55, 0x55,
-    0x55, 0x55, 0x00, 0x00, 0xB8, 0x2D, 0xB4, 0x3D, 0xB4, 0x3D, 0xB4, 0x3C, 0xB4, 0x3C, 0xB4, 0x3C,
-    0xB4, 0x3C, 0xF4, 0x3C, 0xF4, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C,
-    0xF0, 0x3C, 0x3F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xD0, 0xAA, 0x0B, 0xF0, 0x7F, 0x03, 0xF4, 0x3F,
-    0x82, 0xFC, 0x2A, 0x83, 0xFC, 0x3F, 0x83, 0xF4, 0x7F, 0x0F, 0xE0, 0x2A, 0x83, 0xFC, 0x3F, 0x83,
-    0xF4, 0x7F, 0x0F, 0xE0, 0xAA, 0x0B, 0xF0, 0x7F, 0x03, 0xF4, 0x3F, 0x82, 0xFC, 0xAA, 0x1A, 0x92,
-    0xFC, 0x3F, 0x87, 0xF0, 0xFD, 0x0F, 0xD2, 0xF8, 0x3F, 0x87, 0xF0, 0xBF, 0x0F, 0xD0, 0x2A, 0x86,
-    0xA4, 0xFF, 0x1F, 0xD3, 0xF8, 0x7F, 0x0F, 0xD2, 0xF8, 0x7F, 0x0F, 0xD3, 0xF8, 0x7F, 0x00, 0x2A,
-    0x83, 0xFC, 0x3F, 0x83, 0xF4, 0x7F, 0x0F, 0xE0, 0xAA, 0x1A, 0x92, 0xFC, 0x3F, 0x87, 0xF0, 0xFD,
-    0x0F, 0xD2, 0xF8, 0x3F, 0x87, 0xF0, 0xBF, 0x0F, 0xD0, 0x00, 0x40, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0xC5,
-    0x2F, 0x54, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F,
-    0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xE0, 0x00, 0x2E, 0x00, 0x00, 0xE0, 0x00, 0x06, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01,
-    0xF0, 0x00, 0x1F, 0x00, 0x02, 0xF5, 0x47, 0xFF, 0xFC, 0xBF, 0xFF, 0xD0, 0x1F, 0x00, 0x01, 0xF0,
-    0x00, 0x1F, 0x00, 0x01, 0xF0, 0x03, 0xFF, 0xF8, 0xBF, 0xFF, 0xC0, 0x2F, 0x40, 0x02, 0xF0, 0x00,
-    0x2F, 0x00, 0x02, 0xF0, 0x00, 0x0E, 0x00, 0x00, 0x60, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF,
-    0x40, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xC2, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x2A, 0xAA, 0xAA, 0x90, 0x00, 0x03, 0x80,
-    0x7F, 0x87, 0xFD, 0x7F, 0x43, 0x40, 0x00, 0x00, 0x28, 0x7D, 0xBE, 0xBF, 0x28, 0x7D, 0xBE, 0xBF,
-    0x29, 0x02, 0x90, 0x68, 0x3E, 0x07, 0xE0, 0xFC, 0x7F, 0x0B, 0xE0, 0xFC, 0xBF, 0x0B, 0xF0, 0xFD,
-    0x79, 0xE0, 0x05, 0x00, 0x2C, 0x06, 0x50, 0x1E, 0x02, 0xA8, 0x0F, 0x00, 0xA6, 0x0B, 0x80, 0x1E,
-    0x87, 0xC0, 0x03, 0xC3, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x3E, 0x28, 0xA0, 0x1F, 0x1E, 0x39, 0x0F, 0x85, 0xCA, 0x4B, 0xC0, 0xE2, 0xC2,
-    0x90, 0x00, 0x00, 0x0A, 0xA0, 0x3F, 0xC0, 0xFE, 0x03, 0xF0, 0x1F, 0xC0, 0xFE, 0x00, 0x0A, 0xA1,
-    0xA9, 0x0F, 0xF1, 0xFD, 0x0F, 0xE1, 0xFC, 0x0F, 0xC2, 0xF8, 0x1F, 0xC3, 0xF4, 0x3F, 0x87, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xC2, 0xD1, 0xD2, 0xF0, 0xF4, 0xF8, 0xF4, 0xB8, 0xBC, 0x74, 0x38, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x7C, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x78, 0xF0,
-    0x7C, 0xF8, 0x2E, 0x3C, 0x0F, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x0F, 0x07, 0xC7,
-    0xD3, 0xE0, 0xB8, 0xBC, 0x3C, 0x0F, 0x0B, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x1F,
-    0xD0, 0x0B, 0xEF, 0x42, 0xA4, 0xA9, 0x00, 0x00, 0x20, 0x3C, 0x3E, 0x7D, 0x3F, 0x07, 0xE0, 0x7E,
-    0x07, 0x80, 0x50, 0x00, 0x02, 0x00, 0x38, 0x02, 0xF0, 0x0B, 0xD0, 0x3F, 0x0F, 0xD2, 0xF4, 0x2D,
-    0x01, 0x40, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01,
-    0xFD, 0x2F, 0xC3, 0xF4, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0xFE, 0x0B,
-    0xF0, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x3E, 0x2F, 0xFF, 0x87, 0xD7, 0xE0, 0xFF, 0xF0, 0xBD, 0x7F,
-    0x0B, 0xFD, 0x0B, 0xE6, 0xA1, 0xFF, 0xF0, 0xA9, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xFB, 0xFF,
-    0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0F, 0x00, 0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40,
-    0xF4, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x3F, 0x83, 0xF8, 0x7F, 0xC6, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03, 0x40, 0x00, 0x0F,
-    0x00, 0x00, 0x7C, 0x00, 0x1F, 0xFD, 0x02, 0xFF, 0xFD, 0x0B, 0x6F, 0xFC, 0x00, 0xBD, 0xF4, 0x02,
-    0xF3, 0xD0, 0x0B, 0xCF, 0x40, 0x3F, 0x7C, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
-    0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xE0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0,
-    0x00, 0xBF, 0xFF, 0xEF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x43, 0xC3, 0xFF, 0xF0, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x4D, 0x50, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x9E, 0x90, 0x00, 0x32, 0x8E, 0x10, 0xEE, 0xFF, 0xF4, 0x2F, 0xD3, 0xF8, 0x0B,
-    0xFF, 0xFF, 0x83, 0x76, 0x5A, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00,
-    0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x02,
-    0xF0, 0x00, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x00, 0x3E, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x0B, 0xF8, 0x02, 0xFF, 0xF8,
-    0x1F, 0xFF, 0xC0, 0xF9, 0x1F, 0x8F, 0xD1, 0xFC, 0x14, 0x02, 0xF0, 0x80, 0x1F, 0x00, 0x00, 0x7C,
-    0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x03, 0xE0,
-    0x00, 0x3F, 0x00, 0x1B, 0xF0, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0xBF, 0x40, 0x03, 0xF0, 0x00,
-    0x3F, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x19, 0x00, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x02,
-    0x90, 0x00, 0x1F, 0x40, 0x00, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x20, 0x1F, 0xFF, 0xC0, 0x03, 0x83,
-    0xF4, 0x7E, 0x00, 0x3C, 0x14, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0xF4,
-    0x0B, 0xC0, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x02, 0xFD, 0x00, 0xFC, 0x00,
-    0xFF, 0x40, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x02, 0x80, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x02, 0xFD, 0x02, 0xFC, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x02, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x50, 0x7F, 0x80, 0x07, 0xBF, 0xFF, 0x40,
-    0xBF, 0xD1, 0xFC, 0x0B, 0xA0, 0x03, 0xD0, 0xB8, 0x00, 0x3E, 0x0F, 0x80, 0x03, 0xE0, 0xF8, 0x00,
-    0x3D, 0x0F, 0x80, 0x0B, 0xC0, 0xF4, 0x07, 0xF8, 0x0F, 0x42, 0xFE, 0x00, 0xF4, 0x2F, 0x80, 0x03,
-    0x42, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x2A, 0x00, 0x2F, 0xC3, 0xF0, 0x03, 0xFC, 0x3F, 0x00, 0x3F, 0xC7, 0xF0, 0x02, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0xBC, 0x0F, 0x40, 0x2F, 0x43, 0xC0, 0x0F,
-    0xD2, 0xF0, 0x02, 0xA4, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x0F, 0x42, 0xF4,
-    0x0B, 0xC0, 0xFD, 0x03, 0xF0, 0x2A, 0x40, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x0A, 0x0C, 0xA3, 0x9D, 0xEB, 0x72, 0xCF, 0xE1, 0xA0, 0x01, 0x00, 0x74, 0x0F, 0x43, 0x78,
-    0x7F, 0xC0, 0x38, 0x00, 0x03, 0xF8, 0x30, 0x03, 0xF4, 0x02, 0xC2, 0x2C, 0x3F, 0x81, 0x90, 0x0F,
-    0xC3, 0x40, 0x3F, 0x47, 0x5C, 0x34, 0xC2, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x01, 0xC0, 0x2C,
-    0x03, 0xC0, 0x38, 0x07, 0x40, 0x50, 0x0A, 0x43, 0x5C, 0x35, 0xC1, 0xF8, 0x35, 0xC3, 0xFC, 0x00,
-    0x00, 0x1F, 0x43, 0x1C, 0x60, 0xC3, 0x5D, 0x1F, 0xC1, 0x5C, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03,
-    0xEF, 0xE0, 0x3F, 0xFF, 0xC3, 0xF4, 0x7D, 0x3D, 0x03, 0xD3, 0xD0, 0x3E, 0x3D, 0x03, 0xE7, 0xE0,
-    0x3F, 0x7E, 0x03, 0xF7, 0xF0, 0x3F, 0x0A, 0x03, 0x5C, 0x39, 0xC7, 0xAC, 0x35, 0xC3, 0xFC, 0x1F,
-    0x00, 0x08, 0x0F, 0x40, 0xD0, 0x34, 0x0D, 0x07, 0x97, 0xFC, 0x2F, 0x42, 0x6C, 0x00, 0xC0, 0x3C,
-    0x0F, 0x43, 0xF4, 0x3F, 0xD0, 0x2F, 0x40, 0x0C, 0x01, 0xC0, 0xF8, 0x01, 0xC3, 0xFC, 0x2A, 0x40,
-    0x01, 0x40, 0x38, 0x0E, 0x82, 0x68, 0x7F, 0xD0, 0x3C, 0x03, 0xC0, 0x00, 0x0F, 0xE3, 0x00, 0xC0,
-    0x3F, 0x40, 0xB3, 0xF8, 0x64, 0x0B, 0xC3, 0x40, 0x3F, 0x47, 0x9C, 0x30, 0xD3, 0x9C, 0x1F, 0x80,
-    0x00, 0x07, 0xFC, 0x01, 0xC0, 0x2C, 0x03, 0xC0, 0x38, 0x07, 0x40, 0x60, 0x0B, 0x43, 0x4C, 0x39,
-    0xC1, 0xF8, 0x34, 0xD3, 0xAD, 0x2F, 0x80, 0x1F, 0x43, 0x1C, 0x60, 0xC3, 0x5D, 0x1F, 0xD1, 0x5C,
-    0x3F, 0x40, 0x00, 0x00, 0xF0, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xFC, 0x03, 0xD0, 0x1F,
-    0x00, 0xBC, 0x02, 0xF0, 0x0F, 0x80, 0x3E, 0x00, 0xFC, 0x03, 0xF0, 0x0B, 0xC0, 0x1F, 0x40, 0x3E,
-    0x00, 0xFC, 0x02, 0xF8, 0x03, 0xF0, 0x0B, 0xE0, 0x0F, 0xC0, 0x1A, 0x40, 0x3D, 0x00, 0x2F, 0x00,
-    0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0xBC,
-    0x00, 0x7C, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF4, 0x03, 0xF0,
-    0x03, 0xF0, 0x0B, 0xD0, 0x1F, 0xC0, 0x3F, 0x40, 0x6A, 0x00, 0x00, 0x03, 0x8E, 0x00, 0x03, 0x8E,
-    0x00, 0x07, 0x5D, 0x00, 0x0B, 0x2C, 0x00, 0x1F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F,
-    0xFE, 0x78, 0x2F, 0xEC, 0xB0, 0x3F, 0xBC, 0xF0, 0x3F, 0x7C, 0xF0, 0x3F, 0x78, 0xE0, 0x3F, 0xF5,
-    0xD0, 0x3F, 0xF6, 0xD4, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0x02, 0xFF, 0xFD,
-    0x02, 0xCB, 0x00, 0x03, 0xCF, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F, 0xF4, 0x04, 0x1F, 0xC0, 0x00, 0x3F, 0x80,
-    0x00, 0x3F, 0x42, 0xA8, 0x7F, 0x43, 0xFD, 0x7F, 0x43, 0xC0, 0x3F, 0xD3, 0xC4, 0x3F, 0xFF, 0xFD,
-    0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x00, 0x0B,
-    0xFF, 0xD0, 0x0F, 0x01, 0x90, 0xBF, 0xFF, 0xC0, 0xBF, 0xFF, 0xC0, 0x07, 0x80, 0x00, 0x7F, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xC0, 0x02, 0xE0, 0x00, 0x1B, 0xE0, 0x00, 0x3F, 0xFF, 0x90, 0x3F, 0xFF, 0xF4,
-    0x2A, 0xAA, 0xA4, 0x00, 0x15, 0x00, 0x3E, 0x00, 0x01, 0xFC, 0x00, 0xF4, 0x00, 0x07, 0xFC, 0x07,
-    0xD0, 0x00, 0x1F, 0xF4, 0x1F, 0x40, 0x00, 0xBF, 0xF0, 0x7D, 0x00, 0x02, 0xFF, 0xD2, 0xF4, 0x02,
-    0xAF, 0xFF, 0xEF, 0xEA, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFE, 0x3E, 0xFC, 0x00, 0x03, 0xF8,
-    0xFF, 0xF0, 0x00, 0x0F, 0xE1, 0xFF, 0xC0, 0x00, 0x3F, 0x83, 0xFF, 0x00, 0x00, 0xFF, 0x0B, 0xFC,
-    0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x2F, 0xFF,
-    0xD0, 0x05, 0xBD, 0x5F, 0xD4, 0x7F, 0xFF, 0xFF, 0xF8, 0x0F, 0xC0, 0x7D, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xE9, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x78, 0x2C, 0x00, 0x00, 0x07, 0x81, 0xD0, 0x00,
-    0x00, 0x78, 0x1D, 0x00, 0x00, 0x07, 0x82, 0xD0, 0x0B, 0xF0, 0xBE, 0xFC, 0x01, 0xEB, 0x0B, 0xFF,
-    0x80, 0x2C, 0x00, 0xBF, 0xFC, 0x00, 0xF9, 0x0B, 0xC3, 0xD0, 0x02, 0xF8, 0xBC, 0x3F, 0x00, 0x03,
-    0xDF, 0xC3, 0xF0, 0x2F, 0xBD, 0xFC, 0x3F, 0x47, 0xFF, 0xCA, 0x82, 0xA4, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x40, 0xF0, 0x00, 0x78, 0x0F, 0x00, 0x0B, 0x40, 0xF0, 0x00,
-    0xB0, 0x0F, 0x07, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF0, 0x79, 0xFD, 0xE0, 0x07,
-    0xFF, 0xEE, 0x00, 0x3F, 0xFF, 0xD0, 0x03, 0xFD, 0xFC, 0x00, 0x3F, 0x8F, 0xC0, 0x03, 0xF4, 0xFC,
-    0x00, 0x2F, 0x0B, 0x80, 0x15, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x14, 0x7F, 0xFF, 0x43, 0xC7, 0xD0,
-    0x7C, 0x3C, 0x78, 0x02, 0xC3, 0xC7, 0x4A, 0x2D, 0x3C, 0x75, 0xF2, 0xD3, 0xC7, 0x4F, 0x2D, 0x3C,
-    0x74, 0xF0, 0x03, 0xC7, 0x4F, 0x80, 0x3C, 0x74, 0xBF, 0x9F, 0xC7, 0x42, 0xFF, 0xFC, 0x00, 0x01,
-    0xAF, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x1A, 0xFA, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xE0, 0x00, 0xBE,
-    0xE0, 0x03, 0xFF, 0xE0, 0x0B, 0x47, 0xE0, 0x0B, 0x03, 0xD0, 0x0B, 0x47, 0xD0, 0x07, 0xFF, 0xD0,
-    0x02, 0xFF, 0xE0, 0x00, 0x54, 0x40, 0xAA, 0xAA, 0x90, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xAD, 0x00, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xC0, 0x01, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x00, 0xFC, 0x00,
-    0x00, 0xFE, 0x40, 0x00, 0xBF, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFC, 0x00, 0xBD, 0x50, 0x00, 0x2F, 0xF8, 0x00,
-    0x2F, 0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFD, 0x10, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFD, 0x00,
-    0x3F, 0xF8, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x0B, 0xC7, 0xF8, 0x01, 0xAB, 0xFA, 0xFF, 0xE9, 0x00, 0xFC,
-    0x03, 0xE0, 0x05, 0x7F, 0x5B, 0xF9, 0x40, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xA4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF8, 0x0B, 0xF5, 0xF0, 0x00, 0x3F, 0x87, 0x80, 0x00, 0xFC,
-    0x1E, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x1F, 0xC1, 0xFF, 0xFC, 0x3F, 0x07, 0xFF, 0xF4, 0xFE, 0x1E,
-    0x1F, 0x92, 0xFF, 0xB9, 0xBD, 0x03, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xE8,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x41, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFC, 0x00, 0x90, 0x00, 0x3F, 0xEB, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x3C,
-    0x00, 0x7F, 0xD0, 0x7F, 0xF8, 0x3E, 0xF0, 0x1F, 0x3C, 0x07, 0xCF, 0x01, 0xF7, 0xC0, 0x3F, 0xF8,
-    0x0B, 0xFF, 0x80, 0x7F, 0xE0, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x15,
-    0x7F, 0x95, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xF8, 0x00, 0x7F, 0xFF, 0xDF, 0xFF, 0xF0, 0x0F, 0x01, 0xFF, 0xFF, 0x7F, 0xFF, 0xDF, 0xFC, 0x07,
-    0xFD, 0x01, 0xFF, 0xC0, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0xFE, 0x00,
-    0x03, 0xC0, 0x00, 0x0F, 0x04, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0xC0, 0x3F, 0xF5, 0x00, 0xFF, 0xBD,
-    0x01, 0xBF, 0xF4, 0x0F, 0xFE, 0x2E, 0x3F, 0xC1, 0xF4, 0x4F, 0xBF, 0x80, 0x3F, 0xF4, 0x00, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xFF, 0x40,
-    0x0F, 0xFF, 0xD0, 0x0F, 0xFF, 0xE0, 0x1F, 0xBA, 0xF0, 0x2F, 0x79, 0xF0, 0x2E, 0x78, 0xF0, 0x1E,
-    0x78, 0xF0, 0x1E, 0x7C, 0xF0, 0x1F, 0x3D, 0xF0, 0x1F, 0x3D, 0xF0, 0x1F, 0x7D, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x2F, 0x00,
-    0xF4, 0x00, 0xBC, 0x07, 0xD0, 0x17, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFE, 0x90, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFD, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00,
-    0x0F, 0x80, 0x00, 0x3F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFD, 0x1F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0xFD, 0x00, 0x1F, 0xFF, 0xD0, 0x2F, 0xAE, 0xBE, 0x0F, 0x4B, 0x8B, 0x40, 0x42, 0xE0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFE, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00,
-    0x0F, 0x4B, 0x87, 0x42, 0xFA, 0xEB, 0xE0, 0x2F, 0xFF, 0xD0, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x50, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x40,
-    0x7C, 0x02, 0xE0, 0x01, 0xF0, 0xBF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF8, 0x1E, 0x00, 0x2E, 0x00,
-    0x78, 0x0B, 0x80, 0x01, 0x80, 0x60, 0x00, 0x00, 0x90, 0x00, 0x3F, 0x40, 0x0F, 0xFE, 0x07, 0xEE,
-    0xF8, 0xB4, 0xE2, 0xC0, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x70, 0xE2, 0x87, 0xDE, 0xBC,
-    0x1F, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAF, 0xF0, 0xBF,
-    0xFF, 0x0B, 0xF9, 0x00, 0xBF, 0xC0, 0x0F, 0x7F, 0x00, 0xF4, 0xFC, 0x0F, 0x03, 0xF0, 0xF0, 0x0F,
-    0xC0, 0x00, 0x30, 0x00, 0x00, 0x01, 0xFF, 0xA8, 0x1F, 0xFF, 0xD0, 0x06, 0xFD, 0x00, 0x7F, 0xD0,
-    0x1F, 0xAE, 0x07, 0xE2, 0xE1, 0xF8, 0x1E, 0x3E, 0x01, 0xE1, 0x80, 0x00, 0x18, 0x00, 0x03, 0xE0,
-    0x09, 0x1F, 0x82, 0xE0, 0xBD, 0x2D, 0x02, 0xF7, 0xD0, 0x0F, 0xFC, 0x00, 0x3F, 0xC2, 0xFF, 0xFC,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x82, 0x80, 0x3E, 0x3C, 0x0F, 0xC3, 0xC3, 0xF0, 0x2D,
-    0xBD, 0x02, 0xFF, 0x40, 0x1F, 0xE0, 0x01, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x2F, 0xFF,
-    0xFF, 0xDF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x1F, 0xEA, 0xAA, 0x01, 0xF8, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x07, 0x6C, 0x00, 0x01, 0xF6, 0xF0, 0x00,
-    0x7F, 0x6F, 0xC0, 0x1F, 0xF6, 0xFF, 0x07, 0xF7, 0x6D, 0xFC, 0xBC, 0x76, 0xD3, 0xD2, 0x07, 0x6D,
-    0x04, 0x00, 0x76, 0xD0, 0x00, 0x07, 0x6D, 0x00, 0x00, 0x76, 0xD0, 0x00, 0x07, 0x6D, 0x00, 0x00,
-    0x76, 0xD0, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x0B, 0xC0, 0xAA, 0xAA, 0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xF3, 0xFF, 0xFF, 0xF4,
-    0xAA, 0xAB, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x40,
-    0x00, 0x07, 0x6D, 0x00, 0x00, 0x76, 0xD0, 0x00, 0x07, 0x6D, 0x00, 0x00, 0x76, 0xD0, 0x00, 0x07,
-    0x6D, 0x00, 0x20, 0x76, 0xD0, 0x4B, 0xC7, 0x6D, 0x3D, 0x7F, 0x76, 0xDF, 0xC1, 0xFF, 0x6F, 0xF0,
-    0x07, 0xF6, 0xFC, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x76, 0xC0, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x3E, 0x07, 0xD0, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0xEA, 0xAF,
-    0xC2, 0xFF, 0xFF, 0xFF, 0xCF, 0xC0, 0x00, 0x2F, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xEA, 0xBF, 0x80,
-    0x1F, 0x81, 0xF8, 0x00, 0x2D, 0x03, 0xC0, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x3F, 0xD0, 0x07, 0xFF, 0xE0, 0xBF, 0x6F, 0xF7, 0xFD, 0xB7, 0xE1, 0x76, 0xC1, 0x00, 0xDB,
-    0x00, 0x03, 0x6C, 0x00, 0x9D, 0xB1, 0x8F, 0xF6, 0xEF, 0x9F, 0xEB, 0xFC, 0x0F, 0xFF, 0x40, 0x0B,
-    0xF0, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x40, 0xFF, 0x6D, 0x0F, 0xFF, 0xF4, 0xFD, 0x2F,
-    0xC3, 0xE0, 0x3F, 0x0F, 0x40, 0xB8, 0x3F, 0x47, 0xD0, 0xBF, 0xFF, 0x00, 0xFF, 0xF4, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x3C, 0x00, 0x2F, 0xFF, 0xEF, 0xC0, 0x0F,
-    0xF9, 0x7F, 0xE0, 0x01, 0xFC, 0x01, 0xFD, 0x00, 0x3F, 0x00, 0x7F, 0xF0, 0x03, 0xF0, 0x2F, 0x7F,
-    0x00, 0x3E, 0x0B, 0xD3, 0xF0, 0x07, 0xE3, 0xF0, 0x3F, 0x00, 0x3F, 0xFC, 0x03, 0xF0, 0x03, 0xFF,
-    0x41, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x80,
-    0x3E, 0x0B, 0xFF, 0x90, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFE, 0xF4, 0x00, 0x1F, 0x8F, 0xC0, 0x03, 0xF0,
-    0xBD, 0x00, 0x7E, 0x07, 0xF0, 0x0F, 0xD0, 0x3F, 0x41, 0xFC, 0x02, 0xFC, 0x3F, 0x40, 0x0F, 0xC3,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xD2, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFD, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B,
-    0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2,
-    0xF0, 0x05, 0x41, 0x50, 0x05, 0x41, 0x50, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0,
-    0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B,
-    0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0xC2, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00,
-    0x07, 0xC0, 0x00, 0xB8, 0x00, 0x3E, 0x00, 0x1F, 0xC0, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0xC2, 0xAA,
-    0xA8, 0x1A, 0xBF, 0xC3, 0xFF, 0xFC, 0x15, 0x55, 0x00, 0x00, 0x02, 0xAA, 0x90, 0x00, 0x3F, 0xFC,
-    0x00, 0x07, 0xD4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xB0, 0xFC, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x50,
-    0x04, 0x00, 0x2F, 0xF5, 0xFF, 0x02, 0xFF, 0xFF, 0xFE, 0x0F, 0x81, 0xF8, 0x3C, 0x3C, 0x02, 0xC0,
-    0xB4, 0xF4, 0x0F, 0x43, 0xD3, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x07, 0xF8, 0x7F, 0xC0,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xF8, 0x10, 0x00,
-    0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x65, 0xF8, 0x00, 0x3F, 0xFF, 0x40, 0x02, 0xFF, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xD3,
-    0xF8, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x29, 0x7F, 0xF2, 0xEB, 0xCB, 0xFD, 0x14, 0x1A, 0x41, 0xA4,
-    0x14, 0x7F, 0xE3, 0xEB, 0xDF, 0x7D, 0x68, 0x7F, 0xC0, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xFF, 0x43, 0xFF,
-    0xFF, 0xF2, 0xFF, 0xFD, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xD0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0x7F,
-    0xF4, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x1B,
-    0xFF, 0x00, 0x00, 0x01, 0xBC, 0x03, 0xFE, 0x94, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x01, 0x6A, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x6F, 0xFD, 0x01,
-    0xBF, 0xFF, 0xE4, 0x0F, 0xFF, 0x90, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x40, 0x5A, 0xB8, 0x07, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFA, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_8_boldBitmaps[20987] = {
+    0x6C, 0x3D, 0x2D, 0x2D, 0x2D, 0x19, 0xD1, 0x9D, 0x19, 0xD1, 0xAD, 0x1A, 0xD1, 0x9D, 0x29, 0xC7,
+    0x75, 0xE1, 0xE9, 0x9E, 0xAA, 0xEA, 0x9A, 0xAA, 0x90, 0x0A, 0xAA, 0xA0, 0x9A, 0xAA, 0x90, 0xF0,
+    0x9E, 0x90, 0xE9, 0x09, 0xE1, 0xE9, 0x09, 0xE1, 0xE9, 0x09, 0xE1, 0xEA, 0x0A, 0xE0, 0x5A, 0xCA,
+    0x1A, 0xCA, 0x72, 0xDA, 0x1D, 0xA7, 0x2D, 0x91, 0xD9, 0x72, 0xD9, 0x1D, 0x96, 0xFF, 0xFF, 0x90,
+    0x9F, 0xFF, 0xF2, 0x99, 0x9E, 0x99, 0xAD, 0x99, 0x99, 0x6E, 0x1A, 0xD7, 0x2E, 0x1E, 0x69, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xF9, 0x19, 0x99, 0xAD, 0xA9, 0xAD, 0xA9, 0x99, 0x95, 0xAD, 0xA0, 0x9D, 0xA7,
+    0x1A, 0xD9, 0x0A, 0xD9, 0x71, 0xAA, 0xA9, 0x09, 0xAA, 0x95, 0x77, 0x5D, 0x74, 0xD7, 0x29, 0xAD,
+    0xA9, 0x95, 0x9F, 0xF5, 0xFF, 0x5A, 0xDA, 0x9D, 0x7A, 0xD9, 0x9D, 0x7A, 0xEA, 0xD7, 0x0F, 0xDA,
+    0x97, 0xFF, 0xA7, 0xAF, 0xDA, 0x69, 0xCA, 0x9F, 0x3C, 0xA0, 0x9C, 0xA0, 0x9E, 0x2F, 0xEA, 0xF1,
+    0xAF, 0xFE, 0x39, 0xAF, 0xDA, 0x97, 0x0A, 0xCA, 0x73, 0xAC, 0xA7, 0x39, 0xC9, 0x50, 0x71, 0x9A,
+    0x97, 0x2D, 0x2A, 0xDA, 0x3A, 0xCA, 0x1A, 0xC0, 0x9C, 0x92, 0xD2, 0xCA, 0x1C, 0xA1, 0xD9, 0x2A,
+    0xC1, 0xCA, 0x09, 0xD3, 0x9F, 0x90, 0xD9, 0x4A, 0xD9, 0x0A, 0xD7, 0x19, 0xD0, 0xAD, 0xA5, 0xDA,
+    0x9C, 0x90, 0xC9, 0x39, 0xD0, 0xAC, 0x1C, 0xA3, 0xDA, 0x0A, 0xC1, 0xCA, 0x2A, 0xD1, 0x9F, 0x91,
+    0x9D, 0x92, 0x9D, 0xA2, 0xAA, 0xA7, 0x00, 0x09, 0xEA, 0x94, 0x9D, 0x99, 0xD9, 0x3A, 0xC3, 0xD3,
+    0xAC, 0x3D, 0x3A, 0xD1, 0xAD, 0x4F, 0xD6, 0xEA, 0x6F, 0xC2, 0x99, 0x0A, 0xD0, 0xAD, 0x1D, 0x9E,
+    0x19, 0xDA, 0xD9, 0xE9, 0x19, 0xF0, 0xAF, 0xFC, 0xA1, 0xFF, 0xD2, 0xAE, 0xA9, 0x30, 0x0F, 0x1E,
+    0xA1, 0xE9, 0x1E, 0x91, 0xE9, 0x1A, 0xAA, 0x10, 0x3D, 0x3A, 0xD2, 0x9D, 0x3D, 0xA2, 0x9D, 0x3E,
+    0x3D, 0x92, 0x9D, 0x3A, 0xD3, 0xAD, 0x3D, 0xA3, 0xDA, 0x3E, 0x3E, 0x3A, 0xD3, 0x9D, 0x93, 0xDA,
+    0x3E, 0x3A, 0xDA, 0x3E, 0x3A, 0xDA, 0x3E, 0x39, 0xAA, 0x90, 0x0D, 0x94, 0xAD, 0x5D, 0xA4, 0x9D,
+    0x5D, 0xA4, 0xAD, 0x5D, 0x94, 0xDA, 0x4A, 0xD4, 0xAD, 0x49, 0xD4, 0x9D, 0x4A, 0xD4, 0xAD, 0x4E,
+    0x4D, 0xA3, 0x9D, 0x93, 0xE4, 0xE3, 0xAD, 0x92, 0x9E, 0x3E, 0x92, 0x9A, 0xAA, 0x30, 0x75, 0xD4,
+    0x9A, 0x0D, 0x09, 0xC1, 0xFF, 0x90, 0x9A, 0xFA, 0x39, 0xFC, 0x91, 0xFF, 0xA0, 0x9C, 0x9A, 0xC9,
+    0x9C, 0x4A, 0xC9, 0x74, 0x49, 0x7A, 0xCA, 0x6A, 0xCA, 0x6A, 0xCA, 0x3F, 0xF9, 0x0F, 0xF9, 0x3D,
+    0xA6, 0xAC, 0xA6, 0xAC, 0xA7, 0x93, 0x0A, 0xAA, 0xA1, 0xF1, 0xEA, 0x1E, 0x90, 0x9E, 0x1E, 0xA1,
+    0xAF, 0xFA, 0xFF, 0x0A, 0xA9, 0x0D, 0xA9, 0xEA, 0xE0, 0x77, 0x4A, 0xC7, 0x0D, 0x97, 0x0D, 0x70,
+    0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xD9, 0x79, 0xD7, 0x0A,
+    0xCA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0xAD, 0x70, 0xE7, 0x0D, 0xA7,
+    0x9D, 0x97, 0xAD, 0x70, 0xDA, 0x79, 0xD9, 0x7A, 0xD7, 0x0D, 0xA7, 0x0C, 0x97, 0x09, 0x72, 0x2A,
+    0xDA, 0x4D, 0xAA, 0xD9, 0x1A, 0xCA, 0x19, 0xD1, 0xD9, 0x2D, 0x09, 0xD0, 0xD0, 0xD9, 0x9D, 0x0D,
+    0x9D, 0xAA, 0xD0, 0xD9, 0xDA, 0xAD, 0x0D, 0x0D, 0xA9, 0xD9, 0x19, 0xDA, 0x9E, 0x1E, 0x90, 0xFF,
+    0x1A, 0xFE, 0x2F, 0xD4, 0xAD, 0xA2, 0x29, 0xA9, 0x39, 0xEA, 0x3F, 0xA3, 0xC9, 0xDA, 0x5D, 0xA5,
+    0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x29, 0xFE, 0x0A, 0xFE, 0x9A, 0xFE, 0x90, 0x09, 0xAE,
+    0xA3, 0xFE, 0x19, 0xDA, 0x9A, 0xE6, 0xAD, 0x6A, 0xD6, 0xE5, 0xAD, 0xA4, 0xAE, 0x39, 0xF9, 0x29,
+    0xFA, 0x3F, 0xF0, 0x9F, 0xF9, 0x9F, 0xF9, 0x09, 0xAE, 0xA3, 0xFE, 0x91, 0x93, 0x9D, 0x7D, 0x69,
+    0xD2, 0x9F, 0xC9, 0x2A, 0xFC, 0x95, 0x9E, 0x69, 0xD9, 0x0A, 0xA9, 0x99, 0xE9, 0x0F, 0xF0, 0x9F,
+    0xEA, 0x1A, 0xFC, 0x91, 0x5D, 0x6E, 0x5A, 0xE4, 0x9F, 0x4D, 0x9D, 0x3A, 0xC9, 0x0D, 0x91, 0x9D,
+    0x1D, 0x91, 0xDA, 0xAA, 0xEA, 0xAF, 0xFC, 0x9A, 0xAA, 0xAF, 0xC4, 0x9D, 0xA5, 0x9D, 0xA5, 0xAD,
+    0xA7, 0x20, 0x72, 0xFE, 0x91, 0xFE, 0x91, 0xD7, 0xD7, 0xD7, 0xFC, 0xA2, 0x9F, 0xE9, 0x19, 0x91,
+    0x9E, 0x6A, 0xD1, 0xA9, 0x19, 0xE1, 0xFF, 0x09, 0xFE, 0x90, 0x9F, 0xD9, 0x49, 0x94, 0x29, 0xFC,
+    0x2F, 0xE1, 0xAD, 0x99, 0x99, 0x91, 0xD6, 0x9D, 0x9E, 0x91, 0x9F, 0xEA, 0x0A, 0xE9, 0x9E, 0x0A,
+    0xD9, 0x2D, 0xAA, 0xD9, 0x2D, 0xA9, 0xDA, 0x2D, 0xA0, 0xFA, 0xE9, 0x09, 0xFE, 0x29, 0xFA, 0x10,
+    0x71, 0xAF, 0xF0, 0xAF, 0xF6, 0xE6, 0xDA, 0x59, 0xD9, 0x5A, 0xD9, 0x5E, 0x59, 0xE5, 0xAE, 0x5E,
+    0xA5, 0xEA, 0x49, 0xE9, 0x10, 0x29, 0xAA, 0xA5, 0xFD, 0x92, 0xAD, 0x1A, 0xD2, 0xD9, 0x2D, 0x91,
+    0xE1, 0xAD, 0x29, 0xFD, 0xA3, 0x9F, 0xC9, 0x2E, 0x99, 0xAD, 0x90, 0x9D, 0x92, 0xE0, 0xAD, 0x3E,
+    0x09, 0xDA, 0x19, 0xE1, 0xFF, 0xA1, 0xAF, 0xE4, 0xAD, 0xA9, 0x20, 0x19, 0xEA, 0x3A, 0xFD, 0x91,
+    0xD2, 0xAD, 0x09, 0xC9, 0x3D, 0x9A, 0xC9, 0x3D, 0x99, 0xCA, 0x3D, 0xA0, 0xDA, 0x9A, 0xEA, 0x0A,
+    0xFE, 0xA1, 0x9A, 0xFC, 0xA6, 0xD9, 0x0D, 0xAA, 0xAE, 0x1F, 0xEA, 0x1F, 0xD9, 0x73, 0x5E, 0x09,
+    0xE0, 0x9E, 0x0A, 0xE7, 0x70, 0xE0, 0x9E, 0x09, 0xE0, 0xAE, 0x00, 0x69, 0xDA, 0x1A, 0xDA, 0x1F,
+    0x1F, 0x77, 0x49, 0x99, 0x1A, 0xE1, 0xAE, 0x1A, 0xDA, 0x1E, 0x90, 0x9E, 0x29, 0x99, 0x10, 0x73,
+    0x97, 0x19, 0xDA, 0x79, 0xFA, 0x5A, 0xFC, 0x94, 0xAF, 0xA9, 0x49, 0xFA, 0x79, 0xFC, 0xA6, 0x9F,
+    0xFA, 0x95, 0x9A, 0xFE, 0x96, 0x9A, 0xF9, 0x72, 0x9C, 0x90, 0x72, 0xAF, 0xE1, 0xFF, 0x76, 0x99,
+    0x99, 0x91, 0xAF, 0xE1, 0xFD, 0xAA, 0x00, 0x09, 0x97, 0x3A, 0xD9, 0x71, 0xAF, 0xA7, 0x1A, 0xFA,
+    0x71, 0xAF, 0xC9, 0x70, 0xAF, 0xA6, 0x9F, 0xC9, 0x29, 0xAF, 0xFA, 0x1F, 0xEA, 0x94, 0xFA, 0x97,
+    0xCA, 0x72, 0x75, 0xAE, 0x93, 0x9F, 0xE2, 0xE9, 0x09, 0xDA, 0x19, 0xA3, 0x9D, 0x70, 0xD9, 0x7D,
+    0x96, 0x9D, 0x7E, 0x5A, 0xE9, 0x4F, 0x95, 0xE9, 0x6E, 0x7E, 0x7A, 0x97, 0x77, 0x6A, 0xA9, 0x7D,
+    0xA6, 0x9E, 0x6A, 0xE3, 0x79, 0xA9, 0x71, 0x9F, 0xDA, 0x6A, 0xD9, 0x2A, 0xCA, 0x4A, 0xCA, 0x6C,
+    0x93, 0xD1, 0xF1, 0xAC, 0x2A, 0xC9, 0x0A, 0xA0, 0xAC, 0x19, 0xC2, 0xD9, 0x0C, 0x19, 0xC1, 0x9C,
+    0x2D, 0xA0, 0xFC, 0x1C, 0xA2, 0xE1, 0xDA, 0xF3, 0xAD, 0xA3, 0x9A, 0x95, 0xF9, 0x29, 0x95, 0x9F,
+    0xFC, 0x69, 0xFF, 0x70, 0x9A, 0xEA, 0xA7, 0x72, 0x5D, 0x97, 0x1A, 0xE7, 0x1F, 0x97, 0x9F, 0xA7,
+    0xDA, 0xAD, 0x69, 0xD9, 0x0D, 0x95, 0xAD, 0x1E, 0x5E, 0x1A, 0xD9, 0x39, 0xDA, 0x19, 0xDA, 0x3F,
+    0xFD, 0x29, 0xFF, 0xDA, 0x1A, 0xFF, 0xE1, 0xE9, 0x4E, 0x99, 0xE5, 0xEA, 0x9F, 0xDA, 0x39, 0xFF,
+    0x29, 0xDA, 0x19, 0xE1, 0x9D, 0x92, 0x9D, 0x19, 0xD9, 0x29, 0xD1, 0x9D, 0xA9, 0x9A, 0xDA, 0x19,
+    0xFF, 0x29, 0xFF, 0xC9, 0x09, 0xD9, 0x29, 0xE0, 0x9D, 0x93, 0xE0, 0x9E, 0xAA, 0xAF, 0x09, 0xFF,
+    0xD0, 0x9F, 0xFC, 0x90, 0x9F, 0xEA, 0x91, 0x77, 0x0A, 0xFC, 0xA2, 0x9F, 0xEA, 0x19, 0xFF, 0x91,
+    0xF9, 0x29, 0x19, 0xE7, 0xE9, 0x7E, 0x96, 0x9E, 0x96, 0x9E, 0xA7, 0xFA, 0x39, 0x90, 0xFF, 0xD9,
+    0x09, 0xFF, 0xC9, 0x1A, 0xFF, 0x92, 0x9F, 0xE9, 0x9F, 0xDA, 0xA3, 0x9F, 0xFC, 0xA1, 0x9F, 0xFD,
+    0xA0, 0x9D, 0xA3, 0xAE, 0x09, 0xDA, 0x4A, 0xD9, 0x9D, 0xA5, 0xDA, 0x9D, 0xA5, 0xDA, 0x9D, 0xA5,
+    0xE9, 0xDA, 0x5D, 0xA9, 0xDA, 0x29, 0xAE, 0xA9, 0xFF, 0xE9, 0x9F, 0xFE, 0x09, 0xFF, 0xD1, 0x9F,
+    0xFA, 0x20, 0x0A, 0xAF, 0xE1, 0xFF, 0xC1, 0xEA, 0xA9, 0x99, 0x91, 0xE7, 0xE7, 0xE9, 0x9A, 0xA3,
+    0xFE, 0x92, 0xFE, 0x3E, 0x7E, 0x7E, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC, 0x09, 0xFF, 0xC9, 0x9F, 0xFC,
+    0xA0, 0x09, 0xFE, 0x90, 0xAF, 0xE9, 0x0A, 0xDA, 0x99, 0x99, 0x1A, 0xD6, 0xE6, 0xFE, 0xA1, 0xFE,
+    0xA1, 0xFE, 0x91, 0xE6, 0xE6, 0xE6, 0xE6, 0xE5, 0x9E, 0x50, 0x49, 0xAA, 0xAA, 0xA9, 0x5A, 0xFF,
+    0x93, 0xFF, 0xDA, 0x2A, 0xEA, 0x93, 0x99, 0x2F, 0x72, 0xE9, 0x72, 0xE7, 0x29, 0xE3, 0xCA, 0xA9,
+    0x91, 0x9E, 0x3F, 0xD1, 0xE9, 0x29, 0xAF, 0x90, 0xF4, 0x9D, 0xA1, 0xAF, 0xAA, 0xAA, 0xE9, 0x2F,
+    0xFE, 0x93, 0xFF, 0xD9, 0x49, 0xAF, 0xA9, 0x20, 0x0E, 0x4A, 0xD1, 0xE4, 0xAD, 0x90, 0xE4, 0xAD,
+    0x90, 0xE4, 0xAD, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0xAA, 0xAA, 0xAE, 0xA0,
+    0xFF, 0xEA, 0x0F, 0xFE, 0xA0, 0xFF, 0xEA, 0x0E, 0x93, 0xEA, 0x9E, 0x93, 0xEA, 0x9E, 0x93, 0xF0,
+    0x0E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x09, 0xE9, 0x6A,
+    0xD9, 0x6E, 0x96, 0xE7, 0xE7, 0xE7, 0xE6, 0x9D, 0xA6, 0x9D, 0xA6, 0x9D, 0xA6, 0xAD, 0x96, 0xAD,
+    0x96, 0xE7, 0xE2, 0x99, 0x19, 0xE2, 0xFE, 0xA2, 0xFE, 0x92, 0xFD, 0x95, 0x99, 0x94, 0x1E, 0x1E,
+    0xA3, 0xE0, 0x9E, 0x4D, 0xA0, 0xE9, 0x4D, 0xA9, 0xE4, 0x9D, 0xAE, 0x59, 0xFC, 0xA5, 0x9F, 0xC6,
+    0xAF, 0x96, 0xAF, 0xA6, 0xFD, 0xA5, 0xFF, 0x4E, 0x0F, 0xC3, 0xE1, 0xFC, 0x19, 0xE1, 0x9F, 0xC9,
+    0x0A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x29, 0x99, 0x1F,
+    0xFC, 0x90, 0xFF, 0xC9, 0x9F, 0xFC, 0x90, 0x0F, 0x49, 0xE1, 0xF9, 0x3F, 0x1F, 0xA3, 0xF1, 0xFC,
+    0x2A, 0xF9, 0x0F, 0xCA, 0x1F, 0xC9, 0x0F, 0xD0, 0x9F, 0xC9, 0x0F, 0xD9, 0xFD, 0x90, 0xEA, 0xFD,
+    0xAD, 0x90, 0xE0, 0xFC, 0xAA, 0xD9, 0x0E, 0x0F, 0xC9, 0xEA, 0x0E, 0x09, 0xF0, 0xEA, 0x0E, 0x1E,
+    0xA0, 0xEA, 0x9E, 0x1E, 0x90, 0xEA, 0x9E, 0x91, 0x99, 0x1E, 0xA0, 0x19, 0x99, 0x4D, 0xA0, 0x9E,
+    0x4D, 0x90, 0x9E, 0xA2, 0x9D, 0x90, 0x9F, 0x29, 0xD9, 0x0A, 0xFA, 0x19, 0xD9, 0x0A, 0xFC, 0x19,
+    0xD9, 0x0A, 0xDA, 0xDA, 0x0A, 0xD1, 0xEA, 0xAD, 0x0A, 0xD1, 0xEA, 0x9D, 0xAA, 0xD1, 0xEA, 0x0F,
+    0xD1, 0xEA, 0x09, 0xFC, 0x1E, 0xA1, 0xFC, 0x1F, 0x1A, 0xF0, 0x9F, 0x2F, 0x00, 0x39, 0xAE, 0xA9,
+    0x6A, 0xFE, 0xA4, 0xFA, 0x9A, 0xEA, 0x29, 0xE4, 0xE9, 0x1E, 0x59, 0xE1, 0xE6, 0xE1, 0xDA, 0x6E,
+    0x09, 0xDA, 0x6E, 0x1E, 0x6E, 0x1F, 0x92, 0x9F, 0x1F, 0xFF, 0xC1, 0x9F, 0xFE, 0x92, 0xAF, 0xFC,
+    0xA4, 0x9A, 0xFC, 0xA9, 0x77, 0x10, 0x73, 0xAF, 0xCA, 0x3A, 0xFE, 0x91, 0xAD, 0x2A, 0xD1, 0xAD,
+    0x3D, 0x90, 0xE2, 0x9D, 0x90, 0xFF, 0xC9, 0x0F, 0xFC, 0x1F, 0xEA, 0x2E, 0xAA, 0x94, 0xE7, 0xE7,
+    0xE9, 0x6E, 0x95, 0x9E, 0x95, 0x59, 0x99, 0x72, 0xAF, 0xCA, 0x69, 0xFF, 0xC5, 0xEA, 0x19, 0xEA,
+    0x3A, 0xDA, 0x4E, 0x3E, 0x59, 0xD9, 0x2E, 0x6D, 0xA1, 0x9D, 0xA6, 0xE2, 0xDA, 0x6E, 0x2E, 0x29,
+    0x2D, 0xA2, 0xE9, 0x1D, 0xAA, 0xD9, 0x2A, 0xFF, 0xE4, 0xFF, 0xDA, 0x49, 0xFF, 0xC7, 0xAF, 0xEA,
+    0x72, 0xFC, 0xA7, 0x2F, 0xCA, 0x77, 0x00, 0x09, 0xFC, 0xA4, 0xAF, 0xE3, 0xAC, 0xA2, 0xAC, 0xA2,
+    0xAC, 0xA2, 0x9D, 0x2A, 0xCA, 0x29, 0xD2, 0xDA, 0x2E, 0x2F, 0xF9, 0x2F, 0xF3, 0xFF, 0x92, 0xE9,
+    0x1E, 0x2E, 0x91, 0xE9, 0x1E, 0x91, 0xEA, 0x1E, 0x91, 0xF0, 0x9E, 0xA1, 0xF7, 0x40, 0x59, 0x99,
+    0x79, 0xFE, 0x5F, 0xE9, 0x4A, 0xDA, 0x29, 0x5E, 0x72, 0xE7, 0x2A, 0xEA, 0x97, 0x0F, 0xE9, 0x6A,
+    0xFE, 0x70, 0x9F, 0xA7, 0x1A, 0xE2, 0xAC, 0xA3, 0xAE, 0x19, 0xFF, 0xDA, 0x1F, 0xFE, 0x3A, 0xAF,
+    0xCA, 0x97, 0x70, 0x9F, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x4A, 0xD7, 0x1A, 0xD9, 0x70, 0xAD, 0x97,
+    0x0A, 0xD9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xEA, 0x70, 0xEA,
+    0x30, 0x9E, 0x93, 0xEA, 0x9E, 0x93, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x90, 0xE4,
+    0xE9, 0x0E, 0x4E, 0x1E, 0x4E, 0x1E, 0x4E, 0x1E, 0x92, 0x9E, 0x1F, 0xFE, 0x1A, 0xFF, 0xCA, 0x19,
+    0xFF, 0xC9, 0x29, 0xFE, 0x97, 0x60, 0x0E, 0x6E, 0x1E, 0x59, 0xDA, 0x1A, 0xDA, 0x4E, 0x92, 0xE4,
+    0xE3, 0xE9, 0x2A, 0xDA, 0x3A, 0xE2, 0xE9, 0x39, 0xE1, 0xAE, 0x5E, 0xA0, 0xEA, 0x5A, 0xEA, 0xE9,
+    0x59, 0xFE, 0x7F, 0xDA, 0x7A, 0xFC, 0x97, 0x9F, 0xC7, 0x1F, 0xA4, 0x77, 0x4E, 0x72, 0x9E, 0x1E,
+    0x97, 0x1A, 0xDA, 0x1E, 0xA7, 0x1E, 0x91, 0xAE, 0x39, 0x93, 0xE2, 0x9E, 0x2A, 0xD9, 0x19, 0xE3,
+    0xE9, 0x1F, 0x1A, 0xDA, 0x3E, 0xA0, 0xAF, 0x90, 0xE9, 0x3A, 0xE0, 0xFD, 0x0E, 0x49, 0xEA, 0xFD,
+    0xAE, 0x49, 0xFD, 0xAA, 0xFC, 0xA5, 0xFD, 0x99, 0xFC, 0x95, 0xFD, 0x1F, 0xC6, 0xAF, 0xA1, 0xAF,
+    0x69, 0xF3, 0xF3, 0x09, 0xDA, 0x4A, 0xD2, 0xE4, 0xDA, 0x29, 0xE2, 0xE4, 0xAD, 0x90, 0xAD, 0x95,
+    0xE9, 0xE6, 0xAF, 0xC9, 0x7F, 0xA7, 0x0A, 0xE9, 0x70, 0xFC, 0x7F, 0xDA, 0x5A, 0xEA, 0xE9, 0x39,
+    0xE9, 0x0F, 0x3F, 0x2F, 0x1F, 0x3A, 0xEA, 0x0E, 0x5E, 0x1A, 0xD9, 0x3A, 0xDA, 0x2E, 0x3E, 0x3A,
+    0xDA, 0x1A, 0xDA, 0x4E, 0x1E, 0x5A, 0xDA, 0xAD, 0xA6, 0xFD, 0x7F, 0xCA, 0x79, 0xF7, 0x1E, 0xA7,
+    0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1F, 0x40, 0x1F, 0xFE, 0x91, 0xAF, 0xFD, 0x91, 0x9F, 0xFD,
+    0x96, 0x9F, 0xA7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC9, 0x6F, 0xCA, 0x6F, 0xCA, 0x6F, 0xDA, 0xAA,
+    0xAA, 0x19, 0xFF, 0xE9, 0x09, 0xFF, 0xEA, 0x09, 0xFF, 0xF0, 0x1F, 0xC1, 0xFC, 0x1D, 0x93, 0xD9,
+    0x29, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A,
+    0xD3, 0xDA, 0x3D, 0xA3, 0xDA, 0x3D, 0xA3, 0xDA, 0x3D, 0x93, 0xFC, 0x90, 0xFC, 0x90, 0xFC, 0x96,
+    0x70, 0xA6, 0xC9, 0x5C, 0xA5, 0xD5, 0xAC, 0x94, 0x9D, 0x5D, 0x5D, 0xA4, 0xAD, 0x5D, 0x94, 0xDA,
+    0x4A, 0xD4, 0x9D, 0x94, 0xE4, 0xAD, 0x49, 0xC9, 0x5C, 0x69, 0x10, 0x0F, 0xC1, 0xFC, 0x3A, 0xD3,
+    0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD4, 0xD4, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0xA3,
+    0xDA, 0x3D, 0xA3, 0xDA, 0x3D, 0xA3, 0xAC, 0xA3, 0xAD, 0x3A, 0xD0, 0x9F, 0xC0, 0x9F, 0xC0, 0x9F,
+    0xC6, 0x75, 0xD6, 0xF4, 0xDA, 0xE2, 0xD9, 0x1A, 0xD0, 0x75, 0xFF, 0xE9, 0x0F, 0xFE, 0x90, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0x9D, 0x93, 0x9D, 0xA3, 0x9E, 0x70, 0x73, 0x9E, 0xAC, 0xA1, 0x9F,
+    0xE1, 0xD9, 0x1E, 0x1C, 0xA2, 0x9D, 0x09, 0xC9, 0x3D, 0x09, 0xC9, 0x29, 0xD9, 0x0F, 0xF9, 0x0A,
+    0xFE, 0xA1, 0xAE, 0x9D, 0xA0, 0x72, 0x9D, 0x79, 0xD7, 0x9D, 0x70, 0xD7, 0x0D, 0x09, 0xA9, 0x4F,
+    0xE9, 0x2F, 0xF2, 0xE9, 0x1A, 0xCA, 0x1E, 0x3D, 0x1E, 0x3D, 0x1A, 0xD2, 0xAD, 0x1A, 0xFE, 0xA1,
+    0x9F, 0xE3, 0xAF, 0xC6, 0x99, 0x40, 0x73, 0xAE, 0x91, 0x9F, 0xCA, 0x1E, 0x94, 0xD5, 0x9D, 0x59,
+    0xD9, 0x5E, 0x99, 0xA2, 0x9F, 0xD2, 0x9A, 0xEA, 0x00, 0x7D, 0x79, 0xD7, 0x9D, 0x79, 0xD7, 0x9D,
+    0x3A, 0xDA, 0xAD, 0x2F, 0xF1, 0xE9, 0xAF, 0x1D, 0x29, 0xE0, 0x9C, 0xA2, 0x9D, 0xA0, 0x9D, 0x91,
+    0xAD, 0xA1, 0xFF, 0xA1, 0x9F, 0xF2, 0x9A, 0xDA, 0xAD, 0x00, 0x2A, 0xE9, 0x3E, 0xAD, 0xA1, 0xDA,
+    0x09, 0x9D, 0x1F, 0xFA, 0x9D, 0xAA, 0xA9, 0x99, 0x09, 0xD9, 0x6F, 0xFA, 0x09, 0xFE, 0xA2, 0xAF,
+    0x90, 0x71, 0xEA, 0x1A, 0xEA, 0x1D, 0x93, 0xD2, 0x9F, 0xD9, 0xFD, 0x09, 0xDA, 0x99, 0x1D, 0xA3,
+    0xDA, 0x3D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA1, 0x19, 0xAD, 0x9A, 0xD0, 0x9F, 0xEA, 0x0D,
+    0x90, 0x9E, 0xA9, 0xCA, 0x2A, 0xDA, 0x9C, 0x92, 0x9D, 0xA9, 0xCA, 0x2A, 0xDA, 0x0F, 0xF9, 0x0A,
+    0xFE, 0x91, 0xAF, 0xD9, 0x39, 0x1D, 0x6A, 0xD1, 0xAD, 0xAE, 0xA1, 0xFE, 0x2A, 0xFA, 0x20, 0x09,
+    0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7D, 0xA7, 0xEA, 0xE9, 0x2F, 0xF2, 0xE9, 0x09, 0xD9, 0x1D, 0xA2,
+    0x9C, 0xA1, 0xDA, 0x29, 0xD1, 0xDA, 0x2A, 0xD0, 0x9D, 0xA2, 0xAD, 0x09, 0xE2, 0xE0, 0x9E, 0x2E,
+    0x00, 0x9D, 0x9A, 0xD9, 0xAD, 0xAA, 0xAA, 0x97, 0x0D, 0x1D, 0x1D, 0x1D, 0x1D, 0x09, 0xD0, 0x9D,
+    0x09, 0xD9, 0x9D, 0x90, 0x3A, 0xA3, 0x9D, 0x3A, 0xD7, 0x77, 0x0A, 0xD3, 0xAC, 0xA3, 0xAC, 0xA3,
+    0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0x93, 0xAC, 0x93, 0xD9, 0x3D, 0x93, 0xD2, 0xF2, 0xF1, 0x9E, 0x97,
+    0x00, 0x0A, 0xD7, 0xAD, 0x7A, 0xCA, 0x7A, 0xCA, 0x7D, 0xA7, 0xD9, 0x0A, 0xA9, 0x3D, 0x9E, 0x4F,
+    0xC5, 0xF6, 0xF9, 0x5F, 0xC9, 0x39, 0xFD, 0xA2, 0x9D, 0x9A, 0xEA, 0x19, 0xD9, 0x0A, 0xF0, 0x0A,
+    0xCA, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x3D, 0x29, 0xD2, 0x9D, 0x29, 0xD2, 0x9D, 0x29,
+    0xD9, 0x90, 0x9F, 0x09, 0xF9, 0x77, 0x09, 0xDA, 0xDA, 0x90, 0xAD, 0xA2, 0x9F, 0xEA, 0xFA, 0x1A,
+    0xDA, 0x1E, 0xA0, 0x9D, 0x90, 0xAD, 0x2A, 0xD9, 0x1D, 0xA0, 0xE2, 0xAD, 0x2D, 0xA0, 0xE2, 0xE2,
+    0xE0, 0xE2, 0xE2, 0xE9, 0xDA, 0x19, 0xDA, 0x2E, 0x9D, 0xA1, 0xAD, 0x92, 0xE0, 0x72, 0xDA, 0xEA,
+    0x2F, 0xF1, 0xE9, 0x09, 0xD9, 0x0D, 0x92, 0xD9, 0x0D, 0x92, 0xDA, 0x0D, 0x92, 0xDA, 0x9D, 0xA2,
+    0xE9, 0xDA, 0x2E, 0x9E, 0x2E, 0x2A, 0xE9, 0x29, 0xFD, 0xA1, 0xDA, 0x19, 0xD9, 0x9D, 0x3D, 0xA9,
+    0xD3, 0xE0, 0xE9, 0x9A, 0xDA, 0x0F, 0xF9, 0x09, 0xFD, 0xA3, 0xAE, 0x91, 0x59, 0x59, 0xDA, 0xF4,
+    0xFA, 0xAD, 0x3E, 0x92, 0xCA, 0x2E, 0x3D, 0x2E, 0x3D, 0x2E, 0x92, 0xD2, 0xFC, 0xAE, 0x19, 0xFF,
+    0x91, 0x9F, 0xE9, 0x2A, 0xD1, 0x99, 0x4E, 0x70, 0xE7, 0x9D, 0xA7, 0x9A, 0xA9, 0x70, 0x76, 0xAD,
+    0xAA, 0xD2, 0x9F, 0xEA, 0x2D, 0x2E, 0xA1, 0x9C, 0xA2, 0xAD, 0x91, 0x9C, 0x92, 0x9D, 0x91, 0x9D,
+    0x2A, 0xD3, 0xFF, 0x3A, 0xFE, 0x4A, 0xFD, 0x19, 0x6F, 0xA6, 0xFA, 0x6E, 0xA9, 0x6A, 0x92, 0x0A,
+    0xDA, 0xD1, 0xAF, 0xC9, 0x0A, 0xE9, 0x91, 0xAD, 0x4A, 0xD4, 0xE4, 0xE4, 0xE3, 0x9E, 0x92, 0x74,
+    0xAF, 0x92, 0xDA, 0xAA, 0xC3, 0xD7, 0xAE, 0xA9, 0x5A, 0xF6, 0x9D, 0xA1, 0xEA, 0xEA, 0x0F, 0xF1,
+    0x9A, 0xFA, 0x73, 0x73, 0x9C, 0xA5, 0xDA, 0x5D, 0xA3, 0xFE, 0x1F, 0xE9, 0x2D, 0x95, 0xD9, 0x5D,
+    0x95, 0xD9, 0x5D, 0xAA, 0xA3, 0xFC, 0x3F, 0xC9, 0x70, 0x9C, 0xA3, 0xD9, 0x9D, 0x3D, 0x99, 0xD3,
+    0xD9, 0x0D, 0x3D, 0xA0, 0xD2, 0x9D, 0xA0, 0xD9, 0x1A, 0xDA, 0x0F, 0xFA, 0x0A, 0xFE, 0xA1, 0xAE,
+    0xAD, 0xA0, 0x0D, 0x94, 0xDA, 0x0A, 0xD3, 0x9D, 0x19, 0xD9, 0x2D, 0xA2, 0xE1, 0xAD, 0x39, 0xDA,
+    0x0D, 0xA4, 0xEA, 0xD5, 0x9F, 0xC6, 0xF9, 0x6A, 0xE9, 0x20, 0x9D, 0x96, 0xE0, 0xDA, 0x6D, 0xA0,
+    0xE1, 0xAC, 0x19, 0xD9, 0x0A, 0xD0, 0x9E, 0x0A, 0xD1, 0x9D, 0x9F, 0x9E, 0x2F, 0xFD, 0xA2, 0xFF,
+    0xD9, 0x2A, 0xFF, 0xC4, 0xEA, 0x0E, 0xA4, 0xE1, 0xAD, 0x97, 0x70, 0x1E, 0x2E, 0x3D, 0xA0, 0xAD,
+    0x49, 0xFC, 0x95, 0xAE, 0xA6, 0x9E, 0x69, 0xFC, 0x5E, 0xAE, 0x3E, 0x90, 0xEA, 0x1E, 0xA2, 0xE9,
+    0x0D, 0x93, 0xDA, 0x0A, 0xD3, 0xD9, 0x1D, 0xA1, 0x9D, 0x2A, 0xD9, 0x0D, 0xA3, 0xE0, 0xD9, 0x3A,
+    0xFC, 0x5F, 0xA5, 0xAE, 0x96, 0xE7, 0xE6, 0xAD, 0x93, 0xAF, 0xC4, 0xAF, 0x94, 0xAD, 0xA5, 0x1F,
+    0xF2, 0xFF, 0x6E, 0x95, 0xE5, 0x9E, 0x5A, 0xE5, 0xFA, 0x99, 0x92, 0xFF, 0x90, 0x9F, 0xFC, 0x00,
+    0x3A, 0xE9, 0x2A, 0xF9, 0x2E, 0x5E, 0x5D, 0xA5, 0xDA, 0x49, 0xDA, 0x3F, 0x4E, 0xA4, 0xAE, 0x59,
+    0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xFA, 0x3F, 0xA4, 0x99, 0xA9, 0x00, 0x2A, 0xCA,
+    0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xD9, 0xD9, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0,
+    0xD0, 0x0E, 0xA4, 0xFC, 0x5A, 0xD5, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x95, 0xDA, 0x5F, 0xA3, 0x9E,
+    0xA3, 0xF9, 0x3E, 0x5E, 0x5E, 0x5E, 0x3F, 0xA2, 0x9F, 0x4A, 0xA9, 0x30, 0x09, 0xD0, 0xAC, 0x0E,
+    0xAA, 0xC0, 0xCA, 0x9D, 0xA0, 0x99, 0x09, 0x90, 0x0A, 0xAA, 0xA1, 0xF1, 0xF1, 0xAE, 0x1A, 0xDA,
+    0x77, 0x73, 0xA9, 0x2D, 0x91, 0x9D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0xA2, 0xDA, 0x2A, 0xCA,
+    0x2A, 0xCA, 0x2A, 0xC9, 0x29, 0xA7, 0x39, 0xC6, 0x9C, 0x6A, 0xC5, 0xAE, 0x91, 0x9F, 0xCA, 0x1D,
+    0xAA, 0xC2, 0x9D, 0x0A, 0xC2, 0x9D, 0x0A, 0xC2, 0x9D, 0x9A, 0xC3, 0xFC, 0x92, 0xAF, 0xCA, 0x29,
+    0xFA, 0x4C, 0xA6, 0xCA, 0x69, 0x92, 0x76, 0x9A, 0xDA, 0x5A, 0xFD, 0x93, 0xD2, 0x9A, 0x93, 0xD7,
+    0x1D, 0x71, 0x9C, 0xA6, 0x9F, 0xF2, 0x9F, 0xF5, 0xAC, 0xA7, 0x0A, 0xD6, 0x9E, 0xA6, 0xFE, 0xA9,
+    0x2F, 0xFC, 0x91, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x74, 0xA9, 0x2A, 0xC2, 0xAF, 0xF1, 0x9F,
+    0xE9, 0x2D, 0xA0, 0xAD, 0x3D, 0xA0, 0x9D, 0x92, 0xFE, 0x2F, 0xFC, 0x1F, 0xFC, 0x2A, 0x4A, 0x10,
+    0x0D, 0xA4, 0xE1, 0xAD, 0xA2, 0xE3, 0xEA, 0x0E, 0x94, 0xFD, 0xA5, 0xAF, 0xC7, 0xF7, 0x09, 0xFC,
+    0x4A, 0xFE, 0x4F, 0xD7, 0x09, 0xE7, 0x09, 0xFC, 0x4A, 0xFE, 0x4F, 0xD7, 0x09, 0xDA, 0x70, 0x9D,
+    0xA7, 0x71, 0x0A, 0xC0, 0xD0, 0xD0, 0xD0, 0xD0, 0x97, 0xAA, 0x0C, 0xA0, 0xCA, 0x0C, 0xA0, 0xCA,
+    0x0C, 0xA0, 0x90, 0x2E, 0xA3, 0xFD, 0x19, 0xC9, 0x19, 0xA1, 0x9D, 0xA9, 0x4F, 0xC9, 0x1A, 0xDA,
+    0xE1, 0xD2, 0xD9, 0x0F, 0xE9, 0x0A, 0xFD, 0x29, 0xFA, 0x5A, 0xD9, 0x0C, 0xA2, 0xD9, 0xAF, 0xE1,
+    0xAF, 0xA1, 0x0A, 0xA9, 0x09, 0xAA, 0x1D, 0xA0, 0xAD, 0x09, 0xE0, 0xE9, 0xAE, 0x0E, 0x90, 0x09,
+    0xE9, 0x19, 0xCA, 0x9A, 0xC9, 0x0D, 0x9A, 0x9A, 0xC0, 0xC9, 0xC1, 0x9C, 0x0D, 0xAC, 0x9A, 0xC0,
+    0x9D, 0xAA, 0xC9, 0x2E, 0x91, 0x7E, 0x1A, 0x90, 0xC9, 0x0C, 0x1A, 0x90, 0xCA, 0xAC, 0xA0, 0x9D,
+    0xAA, 0x74, 0xA2, 0xA2, 0xAC, 0x1C, 0xA1, 0xDA, 0x9D, 0x90, 0xDA, 0x9D, 0x90, 0xAD, 0x0D, 0xA1,
+    0x9E, 0xAD, 0xA1, 0x9D, 0xAA, 0xD9, 0x19, 0xCA, 0x0A, 0xC9, 0x29, 0x91, 0x90, 0x0E, 0xAA, 0xA9,
+    0x91, 0xFF, 0x19, 0x9A, 0xAA, 0xE6, 0x9D, 0x69, 0xD9, 0x59, 0xAA, 0x00, 0x0F, 0xF1, 0xFF, 0x00,
+    0x09, 0xE9, 0x19, 0xFC, 0x90, 0xCA, 0xA0, 0xAA, 0xC0, 0xC9, 0xDA, 0x9C, 0x0E, 0x0C, 0xAC, 0x09,
+    0xDA, 0xD9, 0x19, 0xE9, 0x10, 0x70, 0xAF, 0xC9, 0x0A, 0xAA, 0xAA, 0x99, 0x70, 0x9E, 0x91, 0x9F,
+    0xC9, 0x0D, 0xA0, 0x9D, 0x0D, 0x91, 0xD0, 0xEA, 0xE0, 0x9F, 0xC9, 0x19, 0xE9, 0x10, 0x39, 0xA9,
+    0x6A, 0xCA, 0x6A, 0xCA, 0x3F, 0xF9, 0x0A, 0xAA, 0xEA, 0xA9, 0x3A, 0xCA, 0x6A, 0xCA, 0x75, 0xAF,
+    0xE1, 0xFF, 0x72, 0x0A, 0xCA, 0x19, 0x0C, 0x92, 0xC9, 0x1A, 0xC1, 0xAC, 0x91, 0xEA, 0x09, 0x99,
+    0x00, 0x0A, 0xCA, 0x39, 0xA2, 0x9A, 0x09, 0xD9, 0x2A, 0xC0, 0xEA, 0x09, 0xA9, 0x00, 0x19, 0x92,
+    0xCA, 0x1A, 0xC9, 0x1D, 0x10, 0x0A, 0xCA, 0x3D, 0x90, 0xE3, 0xD9, 0x0E, 0x3D, 0x90, 0xE3, 0xDA,
+    0x0E, 0x29, 0xDA, 0x0E, 0x91, 0xAD, 0xA0, 0xFF, 0xCA, 0x0F, 0xFC, 0xA0, 0xDA, 0xEA, 0xDA, 0x0D,
+    0x70, 0xCA, 0x70, 0x1A, 0xE0, 0xD1, 0xAF, 0x0D, 0x1F, 0xC0, 0xD9, 0x9F, 0xA0, 0xD9, 0x0F, 0xA0,
+    0xD9, 0x09, 0xEA, 0x0D, 0x91, 0x9D, 0xA0, 0xD9, 0x1A, 0xD9, 0x0D, 0x91, 0xE9, 0x0D, 0x91, 0xE9,
+    0x0D, 0x91, 0xE1, 0xD9, 0x09, 0xE1, 0xAC, 0x90, 0xAE, 0x1A, 0xC9, 0x0F, 0x1A, 0xC9, 0x09, 0x99,
+    0x92, 0x90, 0x0D, 0xA9, 0xDA, 0x9E, 0x9A, 0xAA, 0x19, 0x2A, 0xC2, 0xE1, 0xA9, 0xCA, 0x0E, 0x90,
+    0xAA, 0x90, 0x09, 0xA2, 0xD3, 0xC3, 0xC3, 0xC1, 0x9E, 0x90, 0x99, 0x90, 0x7D, 0xA1, 0xCA, 0x0C,
+    0xA0, 0xC9, 0x0A, 0xA0, 0xFA, 0x1D, 0xA0, 0x72, 0x91, 0x99, 0x4C, 0xA0, 0x9C, 0x93, 0xE9, 0xDA,
+    0x3A, 0xD9, 0xDA, 0x3D, 0xA9, 0xD9, 0x1E, 0xAE, 0x1E, 0x9E, 0x2A, 0xC1, 0xD3, 0x92, 0xA3, 0x19,
+    0xA7, 0x4A, 0xD9, 0x5A, 0xC9, 0x2A, 0xAC, 0x94, 0x9D, 0x49, 0xC9, 0x4D, 0x94, 0xAC, 0x93, 0xAC,
+    0xA5, 0xAC, 0x93, 0xD6, 0xAC, 0x92, 0xAC, 0xA5, 0xFC, 0x09, 0xD1, 0xAC, 0x2F, 0xC0, 0xDA, 0x09,
+    0xD9, 0x69, 0xD1, 0xCA, 0xC9, 0x6D, 0x90, 0xCA, 0x9C, 0x95, 0xAD, 0x0A, 0xCA, 0xAC, 0xA9, 0x39,
+    0xD9, 0x0F, 0xD9, 0x3E, 0x49, 0xCA, 0x39, 0xD9, 0x4A, 0xCA, 0x39, 0x99, 0x71, 0x29, 0x76, 0x9D,
+    0x96, 0x99, 0x4A, 0xAC, 0x95, 0xD9, 0x59, 0xC9, 0x49, 0xCA, 0x69, 0xC9, 0x4D, 0x7A, 0xC9, 0x3A,
+    0xCA, 0x7A, 0xC9, 0x3D, 0x70, 0xAE, 0x1D, 0xA0, 0x99, 0x93, 0xFC, 0x09, 0xD0, 0xAF, 0x97, 0xD9,
+    0x09, 0x91, 0xCA, 0x6A, 0xD5, 0xD6, 0xD9, 0x49, 0xD5, 0xE4, 0xAD, 0x59, 0xD4, 0xE9, 0x5D, 0xA3,
+    0xAF, 0xC3, 0xAD, 0x4A, 0xFC, 0x77, 0x20, 0x09, 0xEA, 0x72, 0xA9, 0x9A, 0xC9, 0x3A, 0xC9, 0x6C,
+    0xA2, 0x9D, 0x49, 0x9A, 0xC3, 0xD9, 0x4F, 0x91, 0xAC, 0xA7, 0x9D, 0x1D, 0x5A, 0xFA, 0x0D, 0x90,
+    0xAC, 0x2F, 0xC0, 0xAD, 0x09, 0xD9, 0x7D, 0x90, 0xCA, 0xC9, 0x6D, 0xA0, 0xCA, 0x9C, 0x95, 0x9D,
+    0x0A, 0xCA, 0xAC, 0xA5, 0xDA, 0x0F, 0xD9, 0x3A, 0xD4, 0x9C, 0xA3, 0x9D, 0x94, 0xAC, 0xA3, 0x99,
+    0x97, 0x10, 0x3E, 0xA6, 0xAD, 0x96, 0xAD, 0x96, 0x9A, 0xA7, 0x77, 0x69, 0xA7, 0xE7, 0xE7, 0xE5,
+    0x9F, 0x49, 0xEA, 0x94, 0xE7, 0xD9, 0x69, 0xD7, 0x9D, 0x70, 0xD9, 0x39, 0x2E, 0x91, 0xAD, 0x2F,
+    0xEA, 0x3A, 0xEA, 0x97, 0x40, 0x29, 0xD9, 0x72, 0x9D, 0xA7, 0x29, 0xE7, 0x77, 0x76, 0xD9, 0x71,
+    0xAE, 0x71, 0xF9, 0x79, 0xFA, 0x7D, 0xAA, 0xD6, 0x9D, 0x90, 0xD9, 0x5A, 0xD1, 0xE5, 0xE1, 0xAD,
+    0x93, 0x9D, 0xA1, 0x9D, 0xA3, 0xFF, 0xD2, 0x9F, 0xFD, 0xA1, 0xAF, 0xFE, 0x1E, 0x94, 0xE9, 0x9E,
+    0x5E, 0xA0, 0x69, 0x97, 0x3D, 0x72, 0xAC, 0x97, 0x2D, 0x77, 0x77, 0x77, 0x77, 0x3D, 0x97, 0x1A,
+    0xE7, 0x1F, 0x97, 0x9F, 0xA7, 0xDA, 0xAD, 0x69, 0xD9, 0x0D, 0x95, 0xAD, 0x1E, 0x5E, 0x1A, 0xD9,
+    0x39, 0xDA, 0x19, 0xDA, 0x3F, 0xFD, 0x29, 0xFF, 0xDA, 0x1A, 0xFF, 0xE1, 0xE9, 0x4E, 0x99, 0xE5,
+    0xEA, 0x59, 0xC9, 0x71, 0x9E, 0x70, 0x9F, 0xC6, 0x9D, 0x90, 0x9D, 0x97, 0x77, 0x73, 0xD9, 0x71,
+    0xAE, 0x71, 0xF9, 0x79, 0xFA, 0x7D, 0xAA, 0xD6, 0x9D, 0x90, 0xD9, 0x5A, 0xD1, 0xE5, 0xE1, 0xAD,
+    0x93, 0x9D, 0xA1, 0x9D, 0xA3, 0xFF, 0xD2, 0x9F, 0xFD, 0xA1, 0xAF, 0xFE, 0x1E, 0x94, 0xE9, 0x9E,
+    0x5E, 0xA0, 0x4D, 0x09, 0xC7, 0xAE, 0x9C, 0x7C, 0xA9, 0xE7, 0xAA, 0x09, 0xA9, 0x77, 0x7D, 0x97,
+    0x1A, 0xE7, 0x1F, 0x97, 0x9F, 0xA7, 0xDA, 0xAD, 0x69, 0xD9, 0x0D, 0x95, 0xAD, 0x1E, 0x5E, 0x1A,
+    0xD9, 0x39, 0xDA, 0x19, 0xDA, 0x3F, 0xFD, 0x29, 0xFF, 0xDA, 0x1A, 0xFF, 0xE1, 0xE9, 0x4E, 0x99,
+    0xE5, 0xEA, 0x3A, 0xA1, 0x9A, 0xA5, 0x9D, 0x90, 0xE5, 0xAD, 0xA0, 0xE5, 0xEA, 0x9E, 0x77, 0x77,
+    0x4D, 0x97, 0x1A, 0xE7, 0x1F, 0x97, 0x9F, 0xA7, 0xDA, 0xAD, 0x69, 0xD9, 0x0D, 0x95, 0xAD, 0x1E,
+    0x5E, 0x1A, 0xD9, 0x39, 0xDA, 0x19, 0xDA, 0x3F, 0xFD, 0x29, 0xFF, 0xDA, 0x1A, 0xFF, 0xE1, 0xE9,
+    0x4E, 0x99, 0xE5, 0xEA, 0x5D, 0x97, 0x1A, 0xE7, 0x1A, 0xE7, 0x2D, 0x97, 0x77, 0x76, 0xD9, 0x71,
+    0xAE, 0x71, 0xF9, 0x79, 0xFA, 0x7D, 0xAA, 0xD6, 0x9D, 0x90, 0xD9, 0x5A, 0xD1, 0xE5, 0xE1, 0xAD,
+    0x93, 0x9D, 0xA1, 0x9D, 0xA3, 0xFF, 0xD2, 0x9F, 0xFD, 0xA1, 0xAF, 0xFE, 0x1E, 0x94, 0xE9, 0x9E,
+    0x5E, 0xA0, 0x7A, 0xA9, 0xAA, 0xFE, 0x7A, 0xDA, 0xFF, 0xA7, 0xFE, 0xAA, 0x99, 0x97, 0xFE, 0xA7,
+    0x39, 0xD9, 0xFA, 0x73, 0xDA, 0x0F, 0xC9, 0x9A, 0xA6, 0x9D, 0x90, 0xFF, 0xC6, 0xE1, 0xAF, 0xF5,
+    0xAD, 0x91, 0x9E, 0xA7, 0x1F, 0xFD, 0xA7, 0x0A, 0xFF, 0xEA, 0xAA, 0xAA, 0x91, 0x9F, 0xFF, 0xFD,
+    0x1E, 0xA4, 0xFF, 0xD0, 0x9E, 0x5F, 0xFD, 0x97, 0x74, 0x77, 0x0A, 0xFC, 0xA2, 0x9F, 0xEA, 0x19,
+    0xFF, 0x91, 0xF9, 0x29, 0x19, 0xE7, 0xE9, 0x7E, 0x96, 0x9E, 0x96, 0x9E, 0xA7, 0xFA, 0x39, 0x90,
+    0xFF, 0xD9, 0x09, 0xFF, 0xC9, 0x1A, 0xFF, 0x92, 0x9F, 0xE9, 0x5A, 0xC7, 0x1E, 0x97, 0xAA, 0xCA,
+    0x7D, 0xA2, 0x1E, 0x70, 0xAD, 0x97, 0xAD, 0xA7, 0x77, 0x1A, 0xAF, 0xE1, 0xFF, 0xC1, 0xEA, 0xA9,
+    0x99, 0x91, 0xE7, 0xE7, 0xE9, 0x9A, 0xA3, 0xFE, 0x92, 0xFE, 0x3E, 0x7E, 0x7E, 0xAA, 0xAA, 0xAA,
+    0x1F, 0xFC, 0x09, 0xFF, 0xC9, 0x9F, 0xFC, 0xA0, 0x49, 0xC9, 0x7D, 0x79, 0xD7, 0x99, 0x97, 0x77,
+    0x77, 0x70, 0xAA, 0xFE, 0x1F, 0xFC, 0x1E, 0xAA, 0x99, 0x99, 0x1E, 0x7E, 0x7E, 0x99, 0xAA, 0x3F,
+    0xE9, 0x2F, 0xE3, 0xE7, 0xE7, 0xEA, 0xAA, 0xAA, 0xA1, 0xFF, 0xC0, 0x9F, 0xFC, 0x99, 0xFF, 0xCA,
+    0x77, 0xD7, 0xEA, 0x5D, 0xAE, 0x3D, 0x91, 0xAD, 0x77, 0x7A, 0xAF, 0xE1, 0xFF, 0xC1, 0xEA, 0xA9,
+    0x99, 0x91, 0xE7, 0xE7, 0xE9, 0x9A, 0xA3, 0xFE, 0x92, 0xFE, 0x3E, 0x7E, 0x7E, 0xAA, 0xAA, 0xAA,
+    0x1F, 0xFC, 0x09, 0xFF, 0xC9, 0x9F, 0xFC, 0xA0, 0x1E, 0x09, 0xD9, 0x2E, 0x0A, 0xD9, 0x2E, 0x0A,
+    0xDA, 0x19, 0xAA, 0xA0, 0xAA, 0xA9, 0x77, 0x7A, 0xAF, 0xE1, 0xFF, 0xC1, 0xEA, 0xA9, 0x99, 0x91,
+    0xE7, 0xE7, 0xE9, 0x9A, 0xA3, 0xFE, 0x92, 0xFE, 0x3E, 0x7E, 0x7E, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC,
+    0x09, 0xFF, 0xC9, 0x9F, 0xFC, 0xA0, 0x0D, 0xA5, 0xE5, 0xE7, 0x77, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+    0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x39, 0xE9, 0x00, 0x29, 0x2D, 0x19, 0xCA, 0x1D,
+    0x97, 0x77, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x09,
+    0xE9, 0x3C, 0xA6, 0xE9, 0x4F, 0xC9, 0x2D, 0x91, 0xD9, 0x77, 0x77, 0x1E, 0x6E, 0x6E, 0x6E, 0x6E,
+    0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x59, 0xE9, 0x20, 0x0D, 0xA0, 0xAD, 0x09, 0xDA,
+    0x0E, 0x09, 0xE0, 0xE9, 0x9A, 0xAA, 0x0A, 0xAA, 0x97, 0x77, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x49, 0xE9, 0x10, 0x29, 0xFE, 0xA6, 0x9F, 0xFC, 0xA4,
+    0x9F, 0xFD, 0xA3, 0x9D, 0xA3, 0xAE, 0x39, 0xDA, 0x49, 0xD9, 0x29, 0xDA, 0x5D, 0xA0, 0xFF, 0x92,
+    0xE0, 0xFF, 0x92, 0xE2, 0x9D, 0xA4, 0x9D, 0xA2, 0x9D, 0xA2, 0x9A, 0xEA, 0x29, 0xFF, 0xE9, 0x29,
+    0xFF, 0xE3, 0x9F, 0xFD, 0x49, 0xFF, 0x92, 0x4D, 0x99, 0xC6, 0xAF, 0xC6, 0xAC, 0x0A, 0xCA, 0x77,
+    0x76, 0x99, 0x94, 0xDA, 0x09, 0xE4, 0xD9, 0x09, 0xEA, 0x29, 0xD9, 0x09, 0xF2, 0x9D, 0x90, 0xAF,
+    0xA1, 0x9D, 0x90, 0xAF, 0xC1, 0x9D, 0x90, 0xAD, 0xAD, 0xA0, 0xAD, 0x1E, 0xAA, 0xD0, 0xAD, 0x1E,
+    0xA9, 0xDA, 0xAD, 0x1E, 0xA0, 0xFD, 0x1E, 0xA0, 0x9F, 0xC1, 0xEA, 0x1F, 0xC1, 0xF1, 0xAF, 0x09,
+    0xF2, 0xF0, 0x3D, 0xA7, 0x4E, 0x74, 0xE9, 0x77, 0x77, 0x69, 0xAE, 0xA9, 0x6A, 0xFE, 0xA4, 0xFA,
+    0x9A, 0xEA, 0x29, 0xE4, 0xE9, 0x1E, 0x59, 0xE1, 0xE6, 0xE1, 0xDA, 0x6E, 0x09, 0xDA, 0x6E, 0x1E,
+    0x6E, 0x1F, 0x92, 0x9F, 0x1F, 0xFF, 0xC1, 0x9F, 0xFE, 0x92, 0xAF, 0xFC, 0xA4, 0x9A, 0xFC, 0xA9,
+    0x77, 0x10, 0x79, 0x74, 0xD7, 0x39, 0xD7, 0x3D, 0x97, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xEA, 0x96,
+    0xAF, 0xEA, 0x4F, 0xA9, 0xAE, 0xA2, 0x9E, 0x4E, 0x91, 0xE5, 0x9E, 0x1E, 0x6E, 0x1D, 0xA6, 0xE0,
+    0x9D, 0xA6, 0xE1, 0xE6, 0xE1, 0xF9, 0x29, 0xF1, 0xFF, 0xFC, 0x19, 0xFF, 0xE9, 0x2A, 0xFF, 0xCA,
+    0x49, 0xAF, 0xCA, 0x97, 0x71, 0x6D, 0x73, 0xE9, 0x71, 0xFC, 0x97, 0xD9, 0x1D, 0xA7, 0x77, 0x74,
+    0x9A, 0xEA, 0x96, 0xAF, 0xEA, 0x4F, 0xA9, 0xAE, 0xA2, 0x9E, 0x4E, 0x91, 0xE5, 0x9E, 0x1E, 0x6E,
+    0x1D, 0xA6, 0xE0, 0x9D, 0xA6, 0xE1, 0xE6, 0xE1, 0xF9, 0x29, 0xF1, 0xFF, 0xFC, 0x19, 0xFF, 0xE9,
+    0x2A, 0xFF, 0xCA, 0x49, 0xAF, 0xCA, 0x97, 0x71, 0x4D, 0x90, 0xC9, 0x79, 0xE9, 0xC9, 0x7A, 0xC0,
+    0xE7, 0x09, 0xA1, 0xA9, 0x77, 0x79, 0xAE, 0xA9, 0x6A, 0xFE, 0xA4, 0xFA, 0x9A, 0xEA, 0x29, 0xE4,
+    0xE9, 0x1E, 0x59, 0xE1, 0xE6, 0xE1, 0xDA, 0x6E, 0x09, 0xDA, 0x6E, 0x1E, 0x6E, 0x1F, 0x92, 0x9F,
+    0x1F, 0xFF, 0xC1, 0x9F, 0xFE, 0x92, 0xAF, 0xFC, 0xA4, 0x9A, 0xFC, 0xA9, 0x77, 0x10, 0x3A, 0xA9,
+    0x09, 0xAA, 0x7D, 0xA0, 0xAD, 0x69, 0xE0, 0xE9, 0x5A, 0xE0, 0xE9, 0x77, 0x77, 0x49, 0xAE, 0xA9,
+    0x6A, 0xFE, 0xA4, 0xFA, 0x9A, 0xEA, 0x29, 0xE4, 0xE9, 0x1E, 0x59, 0xE1, 0xE6, 0xE1, 0xDA, 0x6E,
+    0x09, 0xDA, 0x6E, 0x1E, 0x6E, 0x1F, 0x92, 0x9F, 0x1F, 0xFF, 0xC1, 0x9F, 0xFE, 0x92, 0xAF, 0xFC,
+    0xA4, 0x9A, 0xFC, 0xA9, 0x77, 0x10, 0x0E, 0x09, 0xD9, 0x2F, 0xC9, 0x4E, 0xA4, 0xAF, 0x92, 0xAD,
+    0xAE, 0xA0, 0x99, 0x99, 0x19, 0x99, 0x00, 0x77, 0x77, 0x74, 0x9A, 0xCA, 0x77, 0x4E, 0x77, 0x4E,
+    0x97, 0x73, 0x9E, 0x77, 0x4E, 0x77, 0x4A, 0xDA, 0x77, 0x39, 0xE7, 0x74, 0xE9, 0x77, 0x3A, 0xE7,
+    0x69, 0xAE, 0xAE, 0x97, 0x5A, 0xFF, 0xA7, 0x5F, 0xA9, 0xAE, 0xA7, 0x49, 0xE2, 0xFC, 0x97, 0x3E,
+    0x2F, 0xE7, 0x3E, 0x19, 0xE0, 0xE7, 0x3D, 0xA1, 0xEA, 0x0E, 0x72, 0x9D, 0xA0, 0xF1, 0xE7, 0x3E,
+    0xAE, 0x2E, 0x73, 0xFD, 0xA0, 0x9F, 0x73, 0xFF, 0xFC, 0x73, 0x9F, 0xFE, 0x97, 0x4F, 0xFD, 0xA7,
+    0x4A, 0xFF, 0xA9, 0x75, 0xEA, 0x77, 0x3F, 0x77, 0x39, 0xEA, 0x77, 0x3F, 0x77, 0x3A, 0xE9, 0x77,
+    0x3F, 0x77, 0x3A, 0xE9, 0x77, 0x29, 0xD9, 0x77, 0x4A, 0x97, 0x75, 0x2A, 0xCA, 0x72, 0xE7, 0x2A,
+    0xD9, 0x77, 0x77, 0x72, 0x9E, 0x93, 0xEA, 0x9E, 0x93, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E,
+    0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x1E, 0x4E, 0x1E, 0x4E, 0x1E, 0x92, 0x9E, 0x1F, 0xFE, 0x1A,
+    0xFF, 0xCA, 0x19, 0xFF, 0xC9, 0x29, 0xFE, 0x97, 0x60, 0x69, 0x72, 0xAC, 0x97, 0x1D, 0x71, 0xAC,
+    0xA7, 0x77, 0x77, 0x77, 0x75, 0x9E, 0x93, 0xEA, 0x9E, 0x93, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE9,
+    0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x1E, 0x4E, 0x1E, 0x4E, 0x1E, 0x92, 0x9E, 0x1F, 0xFE,
+    0x1A, 0xFF, 0xCA, 0x19, 0xFF, 0xC9, 0x29, 0xFE, 0x97, 0x60, 0x5D, 0x71, 0xAD, 0xA7, 0xAF, 0xA5,
+    0xAC, 0xA1, 0xAC, 0xA7, 0x77, 0x77, 0x09, 0xE9, 0x3E, 0xA9, 0xE9, 0x3E, 0x90, 0xE4, 0xE9, 0x0E,
+    0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE1, 0xE4, 0xE1, 0xE4, 0xE1, 0xE9, 0x29, 0xE1,
+    0xFF, 0xE1, 0xAF, 0xFC, 0xA1, 0x9F, 0xFC, 0x92, 0x9F, 0xE9, 0x76, 0x2A, 0xA9, 0x1A, 0xA5, 0xE0,
+    0x9D, 0x94, 0xE0, 0xAD, 0xA3, 0x9E, 0x0E, 0xA7, 0x77, 0x77, 0x09, 0xE9, 0x3E, 0xA9, 0xE9, 0x3E,
+    0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE1, 0xE4, 0xE1, 0xE4,
+    0xE1, 0xE9, 0x29, 0xE1, 0xFF, 0xE1, 0xAF, 0xFC, 0xA1, 0x9F, 0xFC, 0x92, 0x9F, 0xE9, 0x76, 0x69,
+    0x97, 0x29, 0xC9, 0x72, 0xD7, 0x29, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2E, 0x5E, 0x1A, 0xD9,
+    0x3A, 0xDA, 0x2E, 0x3E, 0x3A, 0xDA, 0x1A, 0xDA, 0x4E, 0x1E, 0x5A, 0xDA, 0xAD, 0xA6, 0xFD, 0x7F,
+    0xCA, 0x79, 0xF7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1F, 0x40, 0x71, 0xD6, 0xD6,
+    0xF9, 0x3F, 0xD2, 0xD9, 0xAD, 0xA1, 0xD2, 0xD1, 0xD1, 0x9D, 0x1D, 0x99, 0xE1, 0xFD, 0x2F, 0xA3,
+    0xD6, 0xD6, 0xD5, 0x2A, 0xEA, 0x4F, 0xDA, 0x29, 0xD2, 0xD2, 0xAC, 0xA1, 0xAD, 0x91, 0xAC, 0xA0,
+    0xAC, 0xA9, 0x2A, 0xCA, 0x0D, 0x4E, 0x0A, 0xCA, 0x3E, 0x1E, 0x91, 0xE2, 0xE1, 0xE9, 0x2D, 0x90,
+    0xFF, 0xC9, 0x0F, 0xFC, 0x1A, 0xAA, 0x9A, 0xCA, 0x91, 0x09, 0xD9, 0x69, 0xDA, 0x69, 0xE7, 0x77,
+    0x09, 0xEA, 0xCA, 0x19, 0xFE, 0x1D, 0x91, 0xE1, 0xCA, 0x29, 0xD0, 0x9C, 0x93, 0xD0, 0x9C, 0x92,
+    0x9D, 0x90, 0xFF, 0x90, 0xAF, 0xEA, 0x1A, 0xE9, 0xDA, 0x4D, 0x69, 0xCA, 0x6D, 0x96, 0x99, 0x77,
+    0x77, 0x75, 0x9E, 0xAC, 0xA1, 0x9F, 0xE1, 0xD9, 0x1E, 0x1C, 0xA2, 0x9D, 0x09, 0xC9, 0x3D, 0x09,
+    0xC9, 0x29, 0xD9, 0x0F, 0xF9, 0x0A, 0xFE, 0xA1, 0xAE, 0x9D, 0xA0, 0x75, 0xAC, 0xA5, 0x9E, 0x93,
+    0x9D, 0xAD, 0x91, 0x9D, 0x2D, 0x97, 0x75, 0x9E, 0xAC, 0xA1, 0x9F, 0xE1, 0xD9, 0x1E, 0x1C, 0xA2,
+    0x9D, 0x09, 0xC9, 0x3D, 0x09, 0xC9, 0x29, 0xD9, 0x0F, 0xF9, 0x0A, 0xFE, 0xA1, 0xAE, 0x9D, 0xA0,
+    0x2A, 0x90, 0x9A, 0x3A, 0xDA, 0x9C, 0x3C, 0xAA, 0xE3, 0xD0, 0xAC, 0xA7, 0x77, 0x9E, 0xAC, 0xA1,
+    0x9F, 0xE1, 0xD9, 0x1E, 0x1C, 0xA2, 0x9D, 0x09, 0xC9, 0x3D, 0x09, 0xC9, 0x29, 0xD9, 0x0F, 0xF9,
+    0x0A, 0xFE, 0xA1, 0xAE, 0x9D, 0xA0, 0x09, 0xD9, 0x0E, 0x1A, 0xD9, 0x0E, 0x1A, 0xDA, 0x0E, 0x1A,
+    0xAA, 0x90, 0xAA, 0xA7, 0x76, 0x9E, 0xAC, 0xA1, 0x9F, 0xE1, 0xD9, 0x1E, 0x1C, 0xA2, 0x9D, 0x09,
+    0xC9, 0x3D, 0x09, 0xC9, 0x29, 0xD9, 0x0F, 0xF9, 0x0A, 0xFE, 0xA1, 0xAE, 0x9D, 0xA0, 0x49, 0x69,
+    0xDA, 0x5A, 0xCA, 0xC5, 0xAE, 0x6A, 0xA7, 0x77, 0x19, 0xEA, 0xCA, 0x19, 0xFE, 0x1D, 0x91, 0xE1,
+    0xCA, 0x29, 0xD0, 0x9C, 0x93, 0xD0, 0x9C, 0x92, 0x9D, 0x90, 0xFF, 0x90, 0xAF, 0xEA, 0x1A, 0xE9,
+    0xDA, 0x77, 0x29, 0xEA, 0xCA, 0x9A, 0xDA, 0x39, 0xFF, 0xFC, 0x2D, 0x91, 0xF9, 0x09, 0xAC, 0xA1,
+    0xCA, 0x29, 0xFF, 0xC0, 0x9C, 0x93, 0xEA, 0xA9, 0x99, 0x90, 0x9C, 0x92, 0x9E, 0x49, 0x1F, 0xFF,
+    0xE1, 0xAF, 0xFF, 0xD2, 0xAE, 0x9F, 0xEA, 0x90, 0x73, 0xAE, 0x91, 0x9F, 0xCA, 0x1E, 0x94, 0xD5,
+    0x9D, 0x59, 0xD9, 0x5E, 0x99, 0xA2, 0xAF, 0xD2, 0x9F, 0xA4, 0xD9, 0x49, 0xAD, 0x5E, 0x49, 0xD9,
+    0x10, 0x1D, 0x96, 0x9D, 0xA6, 0x9E, 0x77, 0x77, 0x75, 0xAE, 0x93, 0xEA, 0xDA, 0x1D, 0xA0, 0x99,
+    0xD1, 0xFF, 0xA9, 0xDA, 0xAA, 0x99, 0x90, 0x9D, 0x96, 0xFF, 0xA0, 0x9F, 0xEA, 0x2A, 0xF9, 0x00,
+    0x49, 0x97, 0xD6, 0x9C, 0xA6, 0xD7, 0x77, 0x77, 0x77, 0x72, 0xAE, 0x93, 0xEA, 0xDA, 0x1D, 0xA0,
+    0x99, 0xD1, 0xFF, 0xA9, 0xDA, 0xAA, 0x99, 0x90, 0x9D, 0x96, 0xFF, 0xA0, 0x9F, 0xEA, 0x2A, 0xF9,
+    0x00, 0x39, 0xCA, 0x6E, 0x94, 0xFC, 0x92, 0xD9, 0x09, 0xD9, 0x77, 0x77, 0x72, 0xAE, 0x93, 0xEA,
+    0xDA, 0x1D, 0xA0, 0x99, 0xD1, 0xFF, 0xA9, 0xDA, 0xAA, 0x99, 0x90, 0x9D, 0x96, 0xFF, 0xA0, 0x9F,
+    0xEA, 0x2A, 0xF9, 0x00, 0x1A, 0xA1, 0x9A, 0xA1, 0x9D, 0x90, 0xE1, 0xAD, 0xA0, 0xE1, 0xEA, 0x0E,
+    0x97, 0x77, 0x77, 0x2A, 0xE9, 0x3E, 0xAD, 0xA1, 0xDA, 0x09, 0x9D, 0x1F, 0xFA, 0x9D, 0xAA, 0xA9,
+    0x99, 0x09, 0xD9, 0x6F, 0xFA, 0x09, 0xFE, 0xA2, 0xAF, 0x90, 0x9D, 0x93, 0x9D, 0xA3, 0x9D, 0xA7,
+    0x71, 0xD4, 0xD4, 0xD4, 0xD4, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x92, 0x9D, 0x90, 0x1C, 0xA0, 0xAC,
+    0x90, 0xD1, 0x99, 0x75, 0x99, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x09, 0xD0, 0x9D, 0x09, 0xD9, 0x9D,
+    0x90, 0x75, 0xD9, 0x5A, 0xE4, 0xAD, 0xAD, 0x2A, 0xCA, 0x19, 0xD7, 0x77, 0x0D, 0x7D, 0x7D, 0x7D,
+    0x7D, 0x69, 0xD6, 0x9D, 0x69, 0xD9, 0x59, 0xD9, 0x20, 0x70, 0xD0, 0x9D, 0x09, 0xD9, 0x9D, 0x9A,
+    0xD9, 0xAD, 0x97, 0x72, 0xD5, 0xD5, 0xD5, 0xD5, 0xD4, 0x9D, 0x49, 0xD4, 0x9D, 0x93, 0x9D, 0x91,
+    0x77, 0x39, 0xCA, 0x72, 0xF7, 0x29, 0xD9, 0x7F, 0xF9, 0x4F, 0xF9, 0x7D, 0x94, 0x9F, 0x0D, 0x49,
+    0xFF, 0x4E, 0x1A, 0xE4, 0xD9, 0x2D, 0xA3, 0x9D, 0x92, 0xDA, 0x4E, 0x90, 0xAD, 0x5F, 0xF6, 0xFD,
+    0x97, 0xAD, 0xA6, 0x29, 0xCA, 0x0A, 0xA3, 0xEA, 0xAC, 0x3C, 0x9A, 0xDA, 0x3A, 0x90, 0xAA, 0x77,
+    0x6D, 0xAE, 0xA2, 0xFF, 0x1E, 0x90, 0x9D, 0x90, 0xD9, 0x2D, 0x90, 0xD9, 0x2D, 0xA0, 0xD9, 0x2D,
+    0xA9, 0xDA, 0x2E, 0x9D, 0xA2, 0xE9, 0xE2, 0xE0, 0x09, 0xD9, 0x69, 0xDA, 0x69, 0xE7, 0x77, 0x1A,
+    0xE9, 0x29, 0xFD, 0xA1, 0xDA, 0x19, 0xD9, 0x9D, 0x3D, 0xA9, 0xD3, 0xE0, 0xE9, 0x9A, 0xDA, 0x0F,
+    0xF9, 0x09, 0xFD, 0xA3, 0xAE, 0x91, 0x49, 0x97, 0xD6, 0xAC, 0xA6, 0xD7, 0x77, 0x77, 0x6A, 0xE9,
+    0x29, 0xFD, 0xA1, 0xDA, 0x19, 0xD9, 0x9D, 0x3D, 0xA9, 0xD3, 0xE0, 0xE9, 0x9A, 0xDA, 0x0F, 0xF9,
+    0x09, 0xFD, 0xA3, 0xAE, 0x91, 0x39, 0xC9, 0x59, 0xE4, 0x9F, 0xC9, 0x19, 0xD9, 0x09, 0xD9, 0x77,
+    0x6A, 0xE9, 0x29, 0xFD, 0xA1, 0xDA, 0x19, 0xD9, 0x9D, 0x3D, 0xA9, 0xD3, 0xE0, 0xE9, 0x9A, 0xDA,
+    0x0F, 0xF9, 0x09, 0xFD, 0xA3, 0xAE, 0x91, 0x2D, 0x09, 0xC3, 0xAE, 0x9C, 0x3C, 0xA9, 0xE3, 0xAA,
+    0x09, 0xA9, 0x76, 0xAE, 0x92, 0x9F, 0xDA, 0x1D, 0xA1, 0x9D, 0x99, 0xD3, 0xDA, 0x9D, 0x3E, 0x0E,
+    0x99, 0xAD, 0xA0, 0xFF, 0x90, 0x9F, 0xDA, 0x3A, 0xE9, 0x10, 0x1A, 0xA1, 0x9A, 0xA1, 0x9D, 0x90,
+    0xE1, 0xAD, 0xA0, 0xE1, 0xEA, 0x9E, 0x77, 0x7A, 0xE9, 0x29, 0xFD, 0xA1, 0xDA, 0x19, 0xD9, 0x9D,
+    0x3D, 0xA9, 0xD3, 0xE0, 0xE9, 0x9A, 0xDA, 0x0F, 0xF9, 0x09, 0xFD, 0xA3, 0xAE, 0x91, 0x4A, 0xA9,
+    0x70, 0x9D, 0xA7, 0x09, 0xDA, 0x70, 0xAE, 0x77, 0x29, 0xFF, 0xCA, 0x1F, 0xFE, 0x19, 0x97, 0x6A,
+    0xA9, 0x70, 0x9D, 0xA7, 0x09, 0xDA, 0x70, 0xAE, 0x40, 0x77, 0x49, 0xC7, 0x09, 0xD7, 0x0A, 0xCA,
+    0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0x70, 0x9D, 0x6A, 0xF4, 0x9F, 0xDA, 0x3D,
+    0xAA, 0xF9, 0x19, 0xD0, 0xDA, 0xDA, 0x19, 0xD0, 0xD9, 0xAD, 0x19, 0xFC, 0x9D, 0xA2, 0xFF, 0x92,
+    0x9F, 0xDA, 0x4A, 0xF9, 0x5E, 0x70, 0xDA, 0x79, 0xD9, 0x7A, 0xD7, 0x0E, 0x70, 0xDA, 0x7A, 0xD7,
+    0x0C, 0xA7, 0x19, 0x71, 0x09, 0xD9, 0x69, 0xDA, 0x69, 0xE7, 0x76, 0x9C, 0xA3, 0xD9, 0x9D, 0x3D,
+    0x99, 0xD3, 0xD9, 0x0D, 0x3D, 0xA0, 0xD2, 0x9D, 0xA0, 0xD9, 0x1A, 0xDA, 0x0F, 0xFA, 0x0A, 0xFE,
+    0xA1, 0xAE, 0xAD, 0xA0, 0x49, 0x97, 0xD6, 0xAC, 0xA6, 0xD7, 0x77, 0x77, 0x39, 0xCA, 0x3D, 0x99,
+    0xD3, 0xD9, 0x9D, 0x3D, 0x90, 0xD3, 0xDA, 0x0D, 0x29, 0xDA, 0x0D, 0x91, 0xAD, 0xA0, 0xFF, 0xA0,
+    0xAF, 0xEA, 0x1A, 0xEA, 0xDA, 0x39, 0xCA, 0x6E, 0x93, 0x9F, 0xC9, 0x19, 0xD9, 0x09, 0xD9, 0x77,
+    0x39, 0xCA, 0x3D, 0x99, 0xD3, 0xD9, 0x9D, 0x3D, 0x90, 0xD3, 0xDA, 0x0D, 0x29, 0xDA, 0x0D, 0x91,
+    0xAD, 0xA0, 0xFF, 0xA0, 0xAF, 0xEA, 0x1A, 0xEA, 0xDA, 0x09, 0xD9, 0x0E, 0x19, 0xD9, 0x0E, 0x1A,
+    0xDA, 0x0E, 0x1A, 0xAA, 0x90, 0xAA, 0xA7, 0x74, 0x9C, 0xA3, 0xD9, 0x9D, 0x3D, 0x99, 0xD3, 0xD9,
+    0x0D, 0x3D, 0xA0, 0xD2, 0x9D, 0xA0, 0xD9, 0x1A, 0xDA, 0x0F, 0xFA, 0x0A, 0xFE, 0xA1, 0xAE, 0xAD,
+    0xA0, 0x5D, 0x79, 0xCA, 0x7D, 0x70, 0x99, 0x77, 0x77, 0x77, 0x77, 0x6D, 0x93, 0xDA, 0x0A, 0xD3,
+    0xD9, 0x1D, 0xA1, 0x9D, 0x2A, 0xD9, 0x0D, 0xA3, 0xE0, 0xD9, 0x3A, 0xFC, 0x5F, 0xA5, 0xAE, 0x96,
+    0xE7, 0xE6, 0xAD, 0x93, 0xAF, 0xC4, 0xAF, 0x94, 0xAD, 0xA5, 0x0D, 0x95, 0xD9, 0x5D, 0x95, 0xFA,
+    0x3F, 0xD2, 0xD9, 0x9E, 0x1D, 0x91, 0xD1, 0xD9, 0x1A, 0xC9, 0x0D, 0x91, 0xD9, 0x0D, 0x90, 0x9D,
+    0x1D, 0x99, 0xDA, 0x1F, 0xD2, 0xFA, 0x3D, 0xA5, 0xD9, 0x5D, 0x95, 0xD9, 0x75, 0x19, 0xD1, 0xE2,
+    0xAD, 0x90, 0xE2, 0xE9, 0x9E, 0x2A, 0xAA, 0x99, 0xAA, 0xA7, 0x77, 0x77, 0x5D, 0x93, 0xDA, 0x0A,
+    0xD3, 0xD9, 0x1D, 0xA1, 0x9D, 0x2A, 0xD9, 0x0D, 0xA3, 0xE0, 0xD9, 0x3A, 0xFC, 0x5F, 0xA5, 0xAE,
+    0x96, 0xE7, 0xE6, 0xAD, 0x93, 0xAF, 0xC4, 0xAF, 0x94, 0xAD, 0xA5, 0x70, 0x96, 0xAF, 0xE5, 0xFF,
+    0x77, 0x77, 0x77, 0x2D, 0x97, 0x1A, 0xE7, 0x1F, 0x97, 0x9F, 0xA7, 0xDA, 0xAD, 0x69, 0xD9, 0x0D,
+    0x95, 0xAD, 0x1E, 0x5E, 0x1A, 0xD9, 0x39, 0xDA, 0x19, 0xDA, 0x3F, 0xFD, 0x29, 0xFF, 0xDA, 0x1A,
+    0xFF, 0xE1, 0xE9, 0x4E, 0x99, 0xE5, 0xEA, 0x09, 0x9A, 0xAA, 0xAC, 0xA1, 0xFF, 0x1A, 0xAA, 0xA9,
+    0x99, 0x97, 0x77, 0x70, 0x9E, 0xAC, 0xA1, 0x9F, 0xE1, 0xD9, 0x1E, 0x1C, 0xA2, 0x9D, 0x09, 0xC9,
+    0x3D, 0x09, 0xC9, 0x29, 0xD9, 0x0F, 0xF9, 0x0A, 0xFE, 0xA1, 0xAE, 0x9D, 0xA0, 0x39, 0x39, 0x95,
+    0x9D, 0xAA, 0xE6, 0xFD, 0x96, 0x9F, 0x97, 0x77, 0x75, 0xD9, 0x71, 0xAE, 0x71, 0xF9, 0x79, 0xFA,
+    0x7D, 0xAA, 0xD6, 0x9D, 0x90, 0xD9, 0x5A, 0xD1, 0xE5, 0xE1, 0xAD, 0x93, 0x9D, 0xA1, 0x9D, 0xA3,
+    0xFF, 0xD2, 0x9F, 0xFD, 0xA1, 0xAF, 0xFE, 0x1E, 0x94, 0xE9, 0x9E, 0x5E, 0xA0, 0x72, 0xAD, 0x19,
+    0xD1, 0x9F, 0xDA, 0x2A, 0xFA, 0x77, 0x77, 0x19, 0xEA, 0xCA, 0x19, 0xFE, 0x1D, 0x91, 0xE1, 0xCA,
+    0x29, 0xD0, 0x9C, 0x93, 0xD0, 0x9C, 0x92, 0x9D, 0x90, 0xFF, 0x90, 0xAF, 0xEA, 0x1A, 0xE9, 0xDA,
+    0x5D, 0x97, 0x1A, 0xE7, 0x1F, 0x97, 0x9F, 0xA7, 0xDA, 0xAD, 0x69, 0xD9, 0x0D, 0x95, 0xAD, 0x1E,
+    0x5E, 0x1A, 0xD9, 0x39, 0xDA, 0x19, 0xDA, 0x3F, 0xFD, 0x29, 0xFF, 0xDA, 0x1A, 0xFF, 0xE1, 0xE9,
+    0x4E, 0x99, 0xE5, 0xEA, 0x71, 0xD9, 0x71, 0x9D, 0x99, 0x70, 0x9F, 0x71, 0x9E, 0x75, 0x74, 0x9E,
+    0xAC, 0xA2, 0x9F, 0xE2, 0xD9, 0x1E, 0x2C, 0xA2, 0x9D, 0x19, 0xC9, 0x3D, 0x19, 0xC9, 0x29, 0xD9,
+    0x1F, 0xF9, 0x1A, 0xFE, 0xA2, 0xAE, 0x9E, 0x7A, 0xC9, 0x6A, 0xCA, 0x7A, 0xE9, 0x6E, 0xA7, 0x20,
+    0x69, 0x97, 0x0A, 0xC9, 0x70, 0xD7, 0x0A, 0xCA, 0x77, 0x77, 0x0A, 0xFC, 0xA2, 0x9F, 0xEA, 0x19,
+    0xFF, 0x91, 0xF9, 0x29, 0x19, 0xE7, 0xE9, 0x7E, 0x96, 0x9E, 0x96, 0x9E, 0xA7, 0xFA, 0x39, 0x90,
+    0xFF, 0xD9, 0x09, 0xFF, 0xC9, 0x1A, 0xFF, 0x92, 0x9F, 0xE9, 0x39, 0xC9, 0x5D, 0x59, 0xD5, 0x99,
+    0x97, 0x6A, 0xE9, 0x19, 0xFC, 0xA1, 0xE9, 0x4D, 0x59, 0xD5, 0x9D, 0x95, 0xE9, 0x9A, 0x29, 0xFD,
+    0x29, 0xAE, 0xA0, 0x77, 0x09, 0xD7, 0x0E, 0xA6, 0xDA, 0xDA, 0x4D, 0x91, 0xAC, 0xA7, 0x77, 0x5A,
+    0xFC, 0xA2, 0x9F, 0xEA, 0x19, 0xFF, 0x91, 0xF9, 0x29, 0x19, 0xE7, 0xE9, 0x7E, 0x96, 0x9E, 0x96,
+    0x9E, 0xA7, 0xFA, 0x39, 0x90, 0xFF, 0xD9, 0x09, 0xFF, 0xC9, 0x1A, 0xFF, 0x92, 0x9F, 0xE9, 0x74,
+    0x9C, 0xA6, 0xEA, 0x39, 0xDA, 0xDA, 0x19, 0xD2, 0xAC, 0xA7, 0x5A, 0xE9, 0x29, 0xFC, 0xA2, 0xE9,
+    0x5D, 0x69, 0xD6, 0x9D, 0x96, 0xE9, 0x9A, 0x39, 0xFD, 0x39, 0xAE, 0xA1, 0x5A, 0xA7, 0x0A, 0xD9,
+    0x7A, 0xD9, 0x7E, 0xA7, 0x77, 0x7A, 0xFC, 0xA2, 0x9F, 0xEA, 0x19, 0xFF, 0x91, 0xF9, 0x29, 0x19,
+    0xE7, 0xE9, 0x7E, 0x96, 0x9E, 0x96, 0x9E, 0xA7, 0xFA, 0x39, 0x90, 0xFF, 0xD9, 0x09, 0xFF, 0xC9,
+    0x1A, 0xFF, 0x92, 0x9F, 0xE9, 0x29, 0xAA, 0x5A, 0xD9, 0x4E, 0x94, 0xEA, 0x75, 0xAE, 0x91, 0x9F,
+    0xCA, 0x1E, 0x94, 0xD5, 0x9D, 0x59, 0xD9, 0x5E, 0x99, 0xA2, 0x9F, 0xD2, 0x9A, 0xEA, 0x00, 0x2D,
+    0x29, 0xCA, 0x4D, 0xAA, 0xD6, 0xF7, 0x9D, 0x71, 0x97, 0x77, 0x71, 0xAF, 0xCA, 0x29, 0xFE, 0xA1,
+    0x9F, 0xF9, 0x1F, 0x92, 0x91, 0x9E, 0x7E, 0x97, 0xE9, 0x69, 0xE9, 0x69, 0xEA, 0x7F, 0xA3, 0x99,
+    0x0F, 0xFD, 0x90, 0x9F, 0xFC, 0x91, 0xAF, 0xF9, 0x29, 0xFE, 0x90, 0x0A, 0xA2, 0x9A, 0xA1, 0x9D,
+    0x9A, 0xD3, 0x9F, 0x59, 0xD7, 0x99, 0x77, 0x0A, 0xE9, 0x29, 0xFC, 0xA2, 0xE9, 0x5D, 0x69, 0xD6,
+    0x9D, 0x96, 0xE9, 0x9A, 0x39, 0xFD, 0x39, 0xAE, 0xA1, 0x19, 0x93, 0x99, 0x49, 0xD9, 0x0D, 0xA5,
+    0x9F, 0xA7, 0x9D, 0xA7, 0x19, 0xA7, 0x77, 0x79, 0xFD, 0xAA, 0x39, 0xFF, 0xCA, 0x19, 0xFF, 0xDA,
+    0x09, 0xDA, 0x3A, 0xE0, 0x9D, 0xA4, 0xAD, 0x99, 0xDA, 0x5D, 0xA9, 0xDA, 0x5D, 0xA9, 0xDA, 0x5E,
+    0x9D, 0xA5, 0xDA, 0x9D, 0xA2, 0x9A, 0xEA, 0x9F, 0xFE, 0x99, 0xFF, 0xE0, 0x9F, 0xFD, 0x19, 0xFF,
+    0xA2, 0x7D, 0x72, 0x9D, 0x09, 0x97, 0x9D, 0x0D, 0x96, 0x9D, 0x0D, 0x79, 0xD9, 0xD3, 0xAD, 0xAA,
+    0xD9, 0xD2, 0xFF, 0x4E, 0x9A, 0xF4, 0xD2, 0x9E, 0x39, 0xCA, 0x29, 0xDA, 0x39, 0xD9, 0x1A, 0xDA,
+    0x4F, 0xFA, 0x49, 0xFF, 0x59, 0xAD, 0xAA, 0xD3, 0x29, 0xFE, 0xA6, 0x9F, 0xFC, 0xA4, 0x9F, 0xFD,
+    0xA3, 0x9D, 0xA3, 0xAE, 0x39, 0xDA, 0x49, 0xD9, 0x29, 0xDA, 0x5D, 0xA0, 0xFF, 0x92, 0xE0, 0xFF,
+    0x92, 0xE2, 0x9D, 0xA4, 0x9D, 0xA2, 0x9D, 0xA2, 0x9A, 0xEA, 0x29, 0xFF, 0xE9, 0x29, 0xFF, 0xE3,
+    0x9F, 0xFD, 0x49, 0xFF, 0x92, 0x7D, 0x71, 0x9D, 0x6A, 0xFF, 0x39, 0xAA, 0xEA, 0xAA, 0x69, 0xD5,
+    0xAD, 0xAA, 0xD4, 0xFF, 0x3E, 0x9A, 0xF3, 0xD2, 0x9E, 0x29, 0xCA, 0x29, 0xDA, 0x29, 0xD9, 0x1A,
+    0xDA, 0x3F, 0xFA, 0x39, 0xFF, 0x49, 0xAD, 0xAA, 0xD2, 0x1A, 0xAA, 0xAE, 0x2A, 0xFE, 0x91, 0x9A,
+    0x99, 0x99, 0x99, 0x77, 0x77, 0x3A, 0xAF, 0xE1, 0xFF, 0xC1, 0xEA, 0xA9, 0x99, 0x91, 0xE7, 0xE7,
+    0xE9, 0x9A, 0xA3, 0xFE, 0x92, 0xFE, 0x3E, 0x7E, 0x7E, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC, 0x09, 0xFF,
+    0xC9, 0x9F, 0xFC, 0xA0, 0x49, 0x99, 0x91, 0xAF, 0xE1, 0xFE, 0xA7, 0x77, 0x77, 0x75, 0xAE, 0x93,
+    0xEA, 0xDA, 0x1D, 0xA0, 0x99, 0xD1, 0xFF, 0xA9, 0xDA, 0xAA, 0x99, 0x90, 0x9D, 0x96, 0xFF, 0xA0,
+    0x9F, 0xEA, 0x2A, 0xF9, 0x00, 0x74, 0xD9, 0x1D, 0x92, 0xFE, 0x4F, 0xC7, 0x97, 0x77, 0x3A, 0xAF,
+    0xE1, 0xFF, 0xC1, 0xEA, 0xA9, 0x99, 0x91, 0xE7, 0xE7, 0xE9, 0x9A, 0xA3, 0xFE, 0x92, 0xFE, 0x3E,
+    0x7E, 0x7E, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC, 0x09, 0xFF, 0xC9, 0x9F, 0xFC, 0xA0, 0x19, 0x09, 0x19,
+    0x91, 0x9F, 0xE2, 0xFD, 0x92, 0x9A, 0xE9, 0x77, 0x77, 0x74, 0xAE, 0x93, 0xEA, 0xDA, 0x1D, 0xA0,
+    0x99, 0xD1, 0xFF, 0xA9, 0xDA, 0xAA, 0x99, 0x90, 0x9D, 0x96, 0xFF, 0xA0, 0x9F, 0xEA, 0x2A, 0xF9,
+    0x00, 0x3A, 0xD7, 0xE7, 0xE7, 0xAA, 0xA7, 0x77, 0x2A, 0xAF, 0xE1, 0xFF, 0xC1, 0xEA, 0xA9, 0x99,
+    0x91, 0xE7, 0xE7, 0xE9, 0x9A, 0xA3, 0xFE, 0x92, 0xFE, 0x3E, 0x7E, 0x7E, 0xAA, 0xAA, 0xAA, 0x1F,
+    0xFC, 0x09, 0xFF, 0xC9, 0x9F, 0xFC, 0xA0, 0x3D, 0xA6, 0xDA, 0x59, 0xE5, 0x9A, 0xAA, 0x77, 0x77,
+    0x75, 0xAE, 0x93, 0xEA, 0xDA, 0x1D, 0xA0, 0x99, 0xD1, 0xFF, 0xA9, 0xDA, 0xAA, 0x99, 0x90, 0x9D,
+    0x96, 0xFF, 0xA0, 0x9F, 0xEA, 0x2A, 0xF9, 0x00, 0x0A, 0xAF, 0xE1, 0xFF, 0xC1, 0xEA, 0xA9, 0x99,
+    0x91, 0xE7, 0xE7, 0xE9, 0x9A, 0xA3, 0xFE, 0x92, 0xFE, 0x3E, 0x7E, 0x7E, 0xAA, 0xAA, 0xAA, 0x1F,
+    0xFC, 0x09, 0xFF, 0xC9, 0x9F, 0xFC, 0xA2, 0xAC, 0xA7, 0xD7, 0x0E, 0xA6, 0x9D, 0xA7, 0x60, 0x2A,
+    0xE9, 0x3E, 0xAD, 0xA1, 0xDA, 0x09, 0x9D, 0x1F, 0xFA, 0x9D, 0xAA, 0xA9, 0x99, 0x09, 0xD9, 0x6F,
+    0xFA, 0x09, 0xFE, 0xA2, 0xAF, 0x97, 0x7C, 0xA6, 0xD9, 0x59, 0xCA, 0x69, 0xE9, 0x5A, 0xD9, 0x73,
+    0x19, 0x49, 0x92, 0xDA, 0x09, 0xD4, 0xFC, 0x6E, 0x70, 0xC9, 0x77, 0x77, 0x5A, 0xAF, 0xE1, 0xFF,
+    0xC1, 0xEA, 0xA9, 0x99, 0x91, 0xE7, 0xE7, 0xE9, 0x9A, 0xA3, 0xFE, 0x92, 0xFE, 0x3E, 0x7E, 0x7E,
+    0xAA, 0xAA, 0xAA, 0x1F, 0xFC, 0x09, 0xFF, 0xC9, 0x9F, 0xFC, 0xA0, 0x0A, 0xCA, 0x2D, 0x2A, 0xDA,
+    0xD4, 0xAE, 0x6D, 0x97, 0x77, 0x77, 0x77, 0xAE, 0x93, 0xEA, 0xDA, 0x1D, 0xA0, 0x99, 0xD1, 0xFF,
+    0xA9, 0xDA, 0xAA, 0x99, 0x90, 0x9D, 0x96, 0xFF, 0xA0, 0x9F, 0xEA, 0x2A, 0xF9, 0x00, 0x6D, 0x73,
+    0xAD, 0xA7, 0x1A, 0xFA, 0x7A, 0xCA, 0x1A, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x39, 0xAA, 0xAA, 0xA9,
+    0x5A, 0xFF, 0x93, 0xFF, 0xDA, 0x2A, 0xEA, 0x93, 0x99, 0x2F, 0x72, 0xE9, 0x72, 0xE7, 0x29, 0xE3,
+    0xCA, 0xA9, 0x91, 0x9E, 0x3F, 0xD1, 0xE9, 0x29, 0xAF, 0x90, 0xF4, 0x9D, 0xA1, 0xAF, 0xAA, 0xAA,
+    0xE9, 0x2F, 0xFE, 0x93, 0xFF, 0xD9, 0x49, 0xAF, 0xA9, 0x20, 0x4D, 0x7E, 0x95, 0xFC, 0x93, 0xD9,
+    0x1D, 0xA7, 0x77, 0x73, 0x9A, 0xD9, 0xAD, 0x19, 0xFE, 0xA1, 0xD9, 0x09, 0xEA, 0x09, 0xCA, 0x2A,
+    0xDA, 0x09, 0xC9, 0x29, 0xDA, 0x09, 0xCA, 0x2A, 0xDA, 0x1F, 0xF9, 0x1A, 0xFE, 0x92, 0xAF, 0xD9,
+    0x49, 0x1D, 0x7A, 0xD2, 0xAD, 0xAE, 0xA2, 0xFE, 0x3A, 0xFA, 0x30, 0x77, 0x29, 0xD1, 0x9D, 0x69,
+    0xFD, 0xA7, 0xAF, 0xA7, 0x77, 0x77, 0x77, 0x74, 0x9A, 0xAA, 0xAA, 0x95, 0xAF, 0xF9, 0x3F, 0xFD,
+    0xA2, 0xAE, 0xA9, 0x39, 0x92, 0xF7, 0x2E, 0x97, 0x2E, 0x72, 0x9E, 0x3C, 0xAA, 0x99, 0x19, 0xE3,
+    0xFD, 0x1E, 0x92, 0x9A, 0xF9, 0x0F, 0x49, 0xDA, 0x1A, 0xFA, 0xAA, 0xAE, 0x92, 0xFF, 0xE9, 0x3F,
+    0xFD, 0x94, 0x9A, 0xFA, 0x92, 0x73, 0xAC, 0xA1, 0xAC, 0xA1, 0xAF, 0xD9, 0x2A, 0xF9, 0x59, 0x77,
+    0x71, 0x9A, 0xD9, 0xAD, 0x09, 0xFE, 0xA0, 0xD9, 0x09, 0xEA, 0x9C, 0xA2, 0xAD, 0xA9, 0xC9, 0x29,
+    0xDA, 0x9C, 0xA2, 0xAD, 0xA0, 0xFF, 0x90, 0xAF, 0xE9, 0x1A, 0xFD, 0x93, 0x91, 0xD6, 0xAD, 0x1A,
+    0xDA, 0xEA, 0x1F, 0xE2, 0xAF, 0xA2, 0x6D, 0xA7, 0x29, 0xDA, 0x72, 0x9E, 0x72, 0x9A, 0xAA, 0x77,
+    0x77, 0x77, 0x69, 0xAA, 0xAA, 0xA9, 0x5A, 0xFF, 0x93, 0xFF, 0xDA, 0x2A, 0xEA, 0x93, 0x99, 0x2F,
+    0x72, 0xE9, 0x72, 0xE7, 0x29, 0xE3, 0xCA, 0xA9, 0x91, 0x9E, 0x3F, 0xD1, 0xE9, 0x29, 0xAF, 0x90,
+    0xF4, 0x9D, 0xA1, 0xAF, 0xAA, 0xAA, 0xE9, 0x2F, 0xFE, 0x93, 0xFF, 0xD9, 0x49, 0xAF, 0xA9, 0x20,
+    0x39, 0xD9, 0x5A, 0xD9, 0x5A, 0xDA, 0x5A, 0xAA, 0x97, 0x77, 0x9A, 0xD9, 0xAD, 0x09, 0xFE, 0xA0,
+    0xD9, 0x09, 0xEA, 0x9C, 0xA2, 0xAD, 0xA9, 0xC9, 0x29, 0xDA, 0x9C, 0xA2, 0xAD, 0xA0, 0xFF, 0x90,
+    0xAF, 0xE9, 0x1A, 0xFD, 0x93, 0x91, 0xD6, 0xAD, 0x1A, 0xDA, 0xEA, 0x1F, 0xE2, 0xAF, 0xA2, 0x5E,
+    0xA7, 0x2E, 0xA7, 0x2E, 0x97, 0x19, 0xE7, 0x2A, 0xE7, 0x2E, 0x97, 0x77, 0x77, 0x77, 0x76, 0x9A,
+    0xAA, 0xAA, 0x95, 0xAF, 0xF9, 0x3F, 0xFD, 0xA2, 0xAE, 0xA9, 0x39, 0x92, 0xF7, 0x2E, 0x97, 0x2E,
+    0x72, 0x9E, 0x3C, 0xAA, 0x99, 0x19, 0xE3, 0xFD, 0x1E, 0x92, 0x9A, 0xF9, 0x0F, 0x49, 0xDA, 0x1A,
+    0xFA, 0xAA, 0xAE, 0x92, 0xFF, 0xE9, 0x3F, 0xFD, 0x94, 0x9A, 0xFA, 0x92, 0x3F, 0x5E, 0xA5, 0xE9,
+    0x5E, 0x5A, 0xE5, 0xAA, 0xA9, 0x76, 0x9A, 0xD9, 0xAD, 0x09, 0xFE, 0xA0, 0xD9, 0x09, 0xEA, 0x9C,
+    0xA2, 0xAD, 0xA9, 0xC9, 0x29, 0xDA, 0x9C, 0xA2, 0xAD, 0xA0, 0xFF, 0x90, 0xAF, 0xE9, 0x1A, 0xFD,
+    0x93, 0x91, 0xD6, 0xAD, 0x1A, 0xDA, 0xEA, 0x1F, 0xE2, 0xAF, 0xA2, 0x77, 0x19, 0xCA, 0x71, 0xEA,
+    0x69, 0xDA, 0xDA, 0x49, 0xD2, 0xAC, 0xA7, 0x77, 0x4E, 0x4A, 0xD1, 0xE4, 0xAD, 0x90, 0xE4, 0xAD,
+    0x90, 0xE4, 0xAD, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0xAA, 0xAA, 0xAE, 0xA0,
+    0xFF, 0xEA, 0x0F, 0xFE, 0xA0, 0xFF, 0xEA, 0x0E, 0x93, 0xEA, 0x9E, 0x93, 0xEA, 0x9E, 0x93, 0xF0,
+    0x3C, 0xA7, 0x1E, 0x97, 0xFC, 0x95, 0xD9, 0x1D, 0x97, 0x77, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xAD,
+    0x71, 0xAD, 0x71, 0xDA, 0x71, 0xEA, 0xE9, 0x4F, 0xF4, 0xE9, 0x09, 0xD9, 0x3D, 0xA2, 0x9C, 0xA3,
+    0xDA, 0x29, 0xD3, 0xDA, 0x2A, 0xD2, 0x9D, 0xA2, 0xAD, 0x29, 0xE2, 0xE2, 0x9E, 0x2E, 0x00, 0x1E,
+    0x4A, 0xD3, 0xE4, 0xAD, 0x92, 0xE4, 0xAD, 0x91, 0x9E, 0x99, 0x99, 0x9E, 0xA1, 0xFF, 0xFC, 0x90,
+    0xFF, 0xFC, 0x91, 0xE4, 0xEA, 0x2E, 0xAA, 0xAA, 0xAE, 0xA2, 0xFF, 0xEA, 0x2F, 0xFE, 0xA2, 0xFF,
+    0xEA, 0x2E, 0x93, 0xEA, 0x19, 0xE9, 0x3E, 0xA1, 0x9E, 0x93, 0xF0, 0x29, 0xD7, 0x1A, 0xD7, 0x9A,
+    0xFA, 0x4A, 0xFD, 0x97, 0xAD, 0x71, 0xEA, 0xE9, 0x4F, 0xF4, 0xE9, 0x09, 0xD9, 0x3D, 0xA2, 0x9C,
+    0xA3, 0xDA, 0x29, 0xD3, 0xDA, 0x2A, 0xD2, 0x9D, 0xA2, 0xAD, 0x29, 0xE2, 0xE2, 0x9E, 0x2E, 0x00,
+    0x0D, 0x90, 0xC0, 0x9F, 0xC0, 0xAC, 0x0A, 0xCA, 0x77, 0x76, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+    0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE2, 0x9E, 0x90, 0x1A, 0x90, 0x99, 0x0E, 0x9A, 0xC0, 0xCA,
+    0xF0, 0xCA, 0x0D, 0x97, 0x70, 0x99, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x39, 0xD3, 0x9D, 0x39, 0xD9,
+    0x29, 0xD9, 0x00, 0x19, 0x99, 0x9A, 0xAA, 0x1A, 0xFE, 0x1E, 0xAA, 0xAA, 0xA7, 0x77, 0x77, 0x4E,
+    0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x59, 0xE9, 0x10, 0x09,
+    0xAA, 0xAA, 0xD9, 0x1F, 0xF0, 0x9A, 0xA9, 0x99, 0x99, 0x97, 0x77, 0x09, 0x97, 0xD7, 0xD7, 0xD7,
+    0xD7, 0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x95, 0x9D, 0x92, 0x1E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x19, 0xE9, 0x09, 0xCA, 0x2D, 0x3E, 0xA1, 0x9D, 0xA6, 0x09,
+    0xD9, 0x1A, 0xD9, 0x1A, 0xDA, 0x1A, 0xAA, 0x97, 0x6D, 0x3D, 0x3D, 0x3D, 0x3D, 0x29, 0xD2, 0x9D,
+    0x29, 0xD9, 0x19, 0xD9, 0x19, 0xD2, 0xD3, 0xF1, 0x9E, 0x60, 0x0D, 0xA1, 0xE0, 0x9E, 0x09, 0xAA,
+    0xA7, 0x70, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE0, 0x9E,
+    0x90, 0x09, 0x91, 0xD1, 0xD1, 0xD1, 0xD1, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x99, 0xD9, 0xAD, 0x95,
+    0xE0, 0x9D, 0x95, 0xE0, 0x9D, 0x94, 0x9E, 0x09, 0xD9, 0x49, 0xDA, 0x09, 0xD9, 0x49, 0xDA, 0x09,
+    0xD9, 0x4A, 0xDA, 0x09, 0xD9, 0x4A, 0xD9, 0x09, 0xD9, 0x4A, 0xD9, 0x09, 0xDA, 0x4E, 0x19, 0xDA,
+    0x4E, 0x19, 0xDA, 0x4E, 0x19, 0xE4, 0xE1, 0xAE, 0x4E, 0x1A, 0xE4, 0xE7, 0x19, 0xDA, 0x5A, 0x91,
+    0xEA, 0x5F, 0xE9, 0x49, 0xFE, 0x5A, 0xFD, 0x95, 0x9A, 0xAE, 0x97, 0x71, 0x0A, 0xA3, 0xAA, 0x09,
+    0xD9, 0x2D, 0x9A, 0xDA, 0x2D, 0x9E, 0xA7, 0x77, 0x2A, 0xA3, 0xD9, 0x0D, 0x3D, 0x1D, 0x3D, 0x1D,
+    0x3D, 0x1D, 0x3D, 0x09, 0xD3, 0xD0, 0x9D, 0x91, 0x9D, 0x09, 0xD9, 0x19, 0xD0, 0x9D, 0xA1, 0xAC,
+    0xA6, 0xDA, 0x4A, 0xEA, 0x4F, 0x5A, 0xAA, 0x91, 0x77, 0x1D, 0x70, 0xF6, 0xFD, 0x4D, 0x91, 0x9D,
+    0x77, 0x77, 0xAD, 0x97, 0xE9, 0x7E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x9D, 0xA7, 0x9D, 0xA7, 0x9D,
+    0xA7, 0xAD, 0x97, 0xAD, 0x97, 0xE7, 0x0E, 0x39, 0x91, 0x9E, 0x3F, 0xEA, 0x3F, 0xE9, 0x3F, 0xD9,
+    0x69, 0x99, 0x50, 0x73, 0x9C, 0xA4, 0x9E, 0x92, 0x9D, 0xAD, 0x90, 0x9D, 0x2D, 0x97, 0x77, 0x5A,
+    0xD5, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0x95, 0xAC, 0x95, 0xD9, 0x5D, 0x95,
+    0xD4, 0xF4, 0xF3, 0x9E, 0x97, 0x40, 0x77, 0x0A, 0xE7, 0x0A, 0xE7, 0x0E, 0xA7, 0x0E, 0x97, 0x9E,
+    0x70, 0x9A, 0xA9, 0x77, 0x77, 0x1E, 0x1E, 0xA3, 0xE0, 0x9E, 0x4D, 0xA0, 0xE9, 0x4D, 0xA9, 0xE4,
+    0x9D, 0xAE, 0x59, 0xFC, 0xA5, 0x9F, 0xC6, 0xAF, 0x96, 0xAF, 0xA6, 0xFD, 0xA5, 0xFF, 0x4E, 0x0F,
+    0xC3, 0xE1, 0xFC, 0x19, 0xE1, 0x9F, 0xC9, 0x0A, 0xD7, 0xAD, 0x7A, 0xCA, 0x7A, 0xCA, 0x7D, 0xA7,
+    0xD9, 0x0A, 0xA9, 0x3D, 0x9E, 0x4F, 0xC5, 0xF6, 0xF9, 0x5F, 0xC9, 0x39, 0xFD, 0xA2, 0x9D, 0x9A,
+    0xEA, 0x19, 0xD9, 0x0A, 0xF7, 0x77, 0x73, 0xAE, 0x95, 0x9E, 0x6A, 0xE6, 0xE9, 0x59, 0xE6, 0x99,
+    0x99, 0x50, 0x09, 0xC9, 0x0C, 0xA2, 0xAC, 0x0D, 0x92, 0xAC, 0x9C, 0xA3, 0xAE, 0x4E, 0x94, 0xE9,
+    0x4F, 0x93, 0xDA, 0xDA, 0x19, 0xD0, 0xAD, 0xA0, 0x29, 0x70, 0xAC, 0x70, 0xD7, 0xAC, 0xA7, 0x72,
+    0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE2, 0x99, 0x91, 0xFF,
+    0xC9, 0x0F, 0xFC, 0x99, 0xFF, 0xC9, 0x19, 0xC9, 0x2D, 0x29, 0xD2, 0x99, 0x97, 0x74, 0xAC, 0xA2,
+    0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD3, 0xD2, 0x9D, 0x29, 0xD2, 0x9D, 0x29, 0xD2, 0x9D, 0x99,
+    0x09, 0xF0, 0x9F, 0x90, 0x09, 0xE9, 0x69, 0xE7, 0x9E, 0x7A, 0xDA, 0x7E, 0x96, 0x9E, 0x77, 0x77,
+    0x1A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70,
+    0xE7, 0x0E, 0x29, 0x99, 0x2F, 0xFC, 0x91, 0xFF, 0xC9, 0x09, 0xFF, 0xC9, 0x1A, 0xCA, 0x3D, 0x93,
+    0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x4D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD9, 0x91, 0x9F,
+    0x19, 0xF9, 0x77, 0x59, 0xAA, 0xA9, 0x19, 0xE9, 0x19, 0xE2, 0xAD, 0xA2, 0xE9, 0x19, 0xE2, 0x0A,
+    0xD7, 0xAD, 0x7A, 0xD2, 0x99, 0x2A, 0xD2, 0xD9, 0x1E, 0x2D, 0x2E, 0x2D, 0x2E, 0x19, 0xD2, 0xE7,
+    0xE7, 0xE7, 0xE2, 0x99, 0x91, 0xFF, 0xC9, 0x0F, 0xFC, 0x99, 0xFF, 0xC9, 0x59, 0x94, 0x9D, 0x4A,
+    0xCA, 0x0A, 0xCA, 0x0D, 0xA0, 0xD9, 0x0D, 0xA0, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x5D, 0x49, 0xD4,
+    0x9D, 0x49, 0xD4, 0x9D, 0x49, 0xD9, 0x92, 0x9F, 0x29, 0xF9, 0x10, 0x0A, 0xD7, 0xAD, 0x7A, 0xD2,
+    0xDA, 0x1A, 0xD1, 0x9D, 0xA1, 0xE1, 0x9E, 0x1E, 0x19, 0xAA, 0xA1, 0xE7, 0xE7, 0xE7, 0xE7, 0xE2,
+    0x99, 0x91, 0xFF, 0xC9, 0x0F, 0xFC, 0x99, 0xFF, 0xC9, 0x0A, 0xCA, 0x4D, 0x94, 0xD9, 0x4D, 0x90,
+    0xD9, 0x0D, 0x99, 0xDA, 0x0D, 0x0A, 0xDA, 0x0D, 0x09, 0xAA, 0xA9, 0xD4, 0x9D, 0x49, 0xD4, 0x9D,
+    0x49, 0xD9, 0x92, 0x9F, 0x29, 0xF9, 0x10, 0x77, 0x77, 0x1A, 0xCA, 0x76, 0x9D, 0x77, 0xDA, 0x76,
+    0xAD, 0x76, 0x9D, 0x97, 0x2A, 0xD0, 0xE7, 0x3A, 0xDA, 0xD7, 0x4A, 0xFA, 0x74, 0xAF, 0x75, 0xF9,
+    0x75, 0xF7, 0x6E, 0x77, 0xE7, 0x6F, 0x75, 0x9F, 0x75, 0xFC, 0x29, 0x99, 0x6A, 0xFF, 0xE9, 0x49,
+    0xFF, 0xF9, 0x4E, 0x9F, 0xFC, 0x93, 0xAD, 0x97, 0x6E, 0x76, 0xE9, 0x75, 0x9D, 0xA7, 0x6C, 0xA7,
+    0x77, 0x72, 0x6A, 0xCA, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD7, 0x2D, 0xAD,
+    0x69, 0xEA, 0x6A, 0xE9, 0x5A, 0xFC, 0x49, 0xE9, 0x9D, 0x71, 0x9D, 0x99, 0x79, 0xF7, 0x9F, 0x90,
+    0x6D, 0x71, 0x9C, 0xA7, 0x1D, 0x72, 0x99, 0x77, 0x77, 0x09, 0x99, 0x4D, 0xA0, 0x9E, 0x4D, 0x90,
+    0x9E, 0xA2, 0x9D, 0x90, 0x9F, 0x29, 0xD9, 0x0A, 0xFA, 0x19, 0xD9, 0x0A, 0xFC, 0x19, 0xD9, 0x0A,
+    0xDA, 0xDA, 0x0A, 0xD1, 0xEA, 0xAD, 0x0A, 0xD1, 0xEA, 0x9D, 0xAA, 0xD1, 0xEA, 0x0F, 0xD1, 0xEA,
+    0x09, 0xFC, 0x1E, 0xA1, 0xFC, 0x1F, 0x1A, 0xF0, 0x9F, 0x2F, 0x00, 0x59, 0x96, 0xAC, 0x96, 0xD6,
+    0xAC, 0xA7, 0x77, 0x71, 0xDA, 0xEA, 0x2F, 0xF1, 0xE9, 0x09, 0xD9, 0x0D, 0x92, 0xD9, 0x0D, 0x92,
+    0xDA, 0x0D, 0x92, 0xDA, 0x9D, 0xA2, 0xE9, 0xDA, 0x2E, 0x9E, 0x2E, 0x19, 0x99, 0x4D, 0xA0, 0x9E,
+    0x4D, 0x90, 0x9E, 0xA2, 0x9D, 0x90, 0x9F, 0x29, 0xD9, 0x0A, 0xFA, 0x19, 0xD9, 0x0A, 0xFC, 0x19,
+    0xD9, 0x0A, 0xDA, 0xDA, 0x0A, 0xD1, 0xEA, 0xAD, 0x0A, 0xD1, 0xEA, 0x9D, 0xAA, 0xD1, 0xEA, 0x0F,
+    0xD1, 0xEA, 0x09, 0xFC, 0x1E, 0xA1, 0xFC, 0x1F, 0x1A, 0xF0, 0x9F, 0x2F, 0x77, 0x2E, 0xA7, 0x0E,
+    0x97, 0x0E, 0x70, 0xAE, 0x70, 0xEA, 0x70, 0x99, 0x95, 0x72, 0xDA, 0xEA, 0x2F, 0xF1, 0xE9, 0x09,
+    0xD9, 0x0D, 0x92, 0xD9, 0x0D, 0x92, 0xDA, 0x0D, 0x92, 0xDA, 0x9D, 0xA2, 0xE9, 0xDA, 0x2E, 0x9E,
+    0x2E, 0x39, 0x99, 0x59, 0xE9, 0x49, 0xE5, 0xAE, 0x5E, 0x94, 0x9E, 0x69, 0x99, 0x30, 0x2A, 0xCA,
+    0x19, 0xD5, 0xAD, 0xAD, 0x7A, 0xE7, 0x1D, 0x97, 0x77, 0x77, 0x49, 0x99, 0x4D, 0xA0, 0x9E, 0x4D,
+    0x90, 0x9E, 0xA2, 0x9D, 0x90, 0x9F, 0x29, 0xD9, 0x0A, 0xFA, 0x19, 0xD9, 0x0A, 0xFC, 0x19, 0xD9,
+    0x0A, 0xDA, 0xDA, 0x0A, 0xD1, 0xEA, 0xAD, 0x0A, 0xD1, 0xEA, 0x9D, 0xAA, 0xD1, 0xEA, 0x0F, 0xD1,
+    0xEA, 0x09, 0xFC, 0x1E, 0xA1, 0xFC, 0x1F, 0x1A, 0xF0, 0x9F, 0x2F, 0x00, 0x1C, 0xA2, 0x9C, 0xA3,
+    0xDA, 0xAD, 0x5F, 0x69, 0xD7, 0x09, 0x77, 0x77, 0x6D, 0xAE, 0xA3, 0xFF, 0x2E, 0x90, 0x9D, 0x91,
+    0xD9, 0x2D, 0x91, 0xD9, 0x2D, 0xA1, 0xD9, 0x2D, 0xA0, 0x9D, 0xA2, 0xE0, 0x9D, 0xA2, 0xE0, 0x9E,
+    0x2E, 0x00, 0x76, 0xAD, 0x5A, 0xD9, 0x4A, 0xDA, 0x49, 0xCA, 0xA7, 0x77, 0x72, 0xDA, 0xEA, 0x2F,
+    0xF1, 0xE9, 0x09, 0xD9, 0x0D, 0x92, 0xD9, 0x0D, 0x92, 0xDA, 0x0D, 0x92, 0xDA, 0x9D, 0xA2, 0xE9,
+    0xDA, 0x2E, 0x9E, 0x2E, 0x19, 0x99, 0x4D, 0xA0, 0x9E, 0x4D, 0x90, 0x9E, 0xA2, 0x9D, 0x90, 0x9F,
+    0x29, 0xD9, 0x0A, 0xFA, 0x19, 0xD9, 0x0A, 0xFC, 0x19, 0xD9, 0x0A, 0xDA, 0xDA, 0x0A, 0xD1, 0xEA,
+    0xAD, 0x0A, 0xD1, 0xEA, 0x9D, 0xAA, 0xD1, 0xEA, 0x0F, 0xD1, 0xEA, 0x09, 0xFC, 0x1E, 0xA1, 0xFC,
+    0x1F, 0x1A, 0xF0, 0x9F, 0x2F, 0x70, 0xEA, 0x6F, 0xCA, 0x59, 0xFC, 0x76, 0x72, 0xDA, 0xEA, 0x2F,
+    0xF1, 0xE9, 0x09, 0xD9, 0x0D, 0x92, 0xD9, 0x0D, 0x92, 0xDA, 0x0D, 0x92, 0xDA, 0x9D, 0xA2, 0xE9,
+    0xDA, 0x2E, 0x9E, 0x2E, 0x59, 0xE4, 0xFA, 0x39, 0xEA, 0x72, 0x77, 0x19, 0xFE, 0x6F, 0xF9, 0x77,
+    0x77, 0x77, 0x39, 0xAE, 0xA9, 0x6A, 0xFE, 0xA4, 0xFA, 0x9A, 0xEA, 0x29, 0xE4, 0xE9, 0x1E, 0x59,
+    0xE1, 0xE6, 0xE1, 0xDA, 0x6E, 0x09, 0xDA, 0x6E, 0x1E, 0x6E, 0x1F, 0x92, 0x9F, 0x1F, 0xFF, 0xC1,
+    0x9F, 0xFE, 0x92, 0xAF, 0xFC, 0xA4, 0x9A, 0xFC, 0xA9, 0x77, 0x10, 0x69, 0x2A, 0xFE, 0x1F, 0xF7,
+    0x77, 0x71, 0xAE, 0x92, 0x9F, 0xDA, 0x1D, 0xA1, 0x9D, 0x99, 0xD3, 0xDA, 0x9D, 0x3E, 0x0E, 0x99,
+    0xAD, 0xA0, 0xFF, 0x90, 0x9F, 0xDA, 0x3A, 0xE9, 0x10, 0x39, 0x39, 0x97, 0xDA, 0xAA, 0xD7, 0xFD,
+    0xA7, 0x0A, 0xE9, 0x77, 0x77, 0x69, 0xAE, 0xA9, 0x6A, 0xFE, 0xA4, 0xFA, 0x9A, 0xEA, 0x29, 0xE4,
+    0xE9, 0x1E, 0x59, 0xE1, 0xE6, 0xE1, 0xDA, 0x6E, 0x09, 0xDA, 0x6E, 0x1E, 0x6E, 0x1F, 0x92, 0x9F,
+    0x1F, 0xFF, 0xC1, 0x9F, 0xFE, 0x92, 0xAF, 0xFC, 0xA4, 0x9A, 0xFC, 0xA9, 0x77, 0x10, 0x19, 0x39,
+    0x91, 0x9D, 0xAA, 0xE2, 0xFD, 0x92, 0x9F, 0x97, 0x77, 0x0A, 0xE9, 0x29, 0xFD, 0xA1, 0xDA, 0x19,
+    0xD9, 0x9D, 0x3D, 0xA9, 0xD3, 0xE0, 0xE9, 0x9A, 0xDA, 0x0F, 0xF9, 0x09, 0xFD, 0xA3, 0xAE, 0x91,
+    0x4D, 0x93, 0xAD, 0x39, 0xDA, 0x3E, 0x3A, 0xDA, 0x29, 0xE7, 0x77, 0x76, 0x9A, 0xEA, 0x97, 0xAF,
+    0xEA, 0x5F, 0xA9, 0xAE, 0xA3, 0x9E, 0x4E, 0x92, 0xE5, 0x9E, 0x2E, 0x6E, 0x2D, 0xA6, 0xE1, 0x9D,
+    0xA6, 0xE2, 0xE6, 0xE2, 0xF9, 0x29, 0xF2, 0xFF, 0xFC, 0x29, 0xFF, 0xE9, 0x3A, 0xFF, 0xCA, 0x59,
+    0xAF, 0xCA, 0x97, 0x73, 0x29, 0xD9, 0x3D, 0xA2, 0xAD, 0x92, 0x9D, 0xA2, 0xE9, 0x2A, 0xDA, 0x77,
+    0x77, 0x4A, 0xE9, 0x79, 0xFD, 0xA6, 0xDA, 0x19, 0xD9, 0x49, 0xD3, 0xDA, 0x49, 0xD3, 0xE5, 0xE9,
+    0x9A, 0xDA, 0x5F, 0xF9, 0x59, 0xFD, 0xA7, 0x0A, 0xE9, 0x50, 0x39, 0xAE, 0xA2, 0x99, 0x99, 0x99,
+    0x92, 0xAF, 0xFF, 0xE9, 0x1F, 0xA9, 0xAF, 0xFD, 0x19, 0xE4, 0xE9, 0x6E, 0x5A, 0xDA, 0x6E, 0x5A,
+    0xE9, 0x9A, 0x92, 0xDA, 0x5A, 0xFD, 0xA1, 0x9D, 0xA5, 0xAF, 0xDA, 0x19, 0xE5, 0xF6, 0xEA, 0x4F,
+    0x6F, 0xFF, 0xCA, 0xAA, 0xAA, 0x19, 0xFF, 0xFF, 0xC9, 0x1A, 0xFF, 0xFF, 0xA2, 0x9A, 0xFF, 0xFE,
+    0x77, 0x30, 0x2A, 0xDA, 0x91, 0xAD, 0xA9, 0x29, 0xFF, 0xDA, 0xD9, 0x1D, 0xA1, 0x9E, 0xA0, 0x99,
+    0xD0, 0x9D, 0x3F, 0xFC, 0x99, 0xD3, 0xEA, 0xAA, 0x99, 0x91, 0xE9, 0x9A, 0xE9, 0x6F, 0xFF, 0xE9,
+    0x09, 0xFF, 0xFD, 0x92, 0xAE, 0x91, 0xAF, 0x90, 0x4D, 0x70, 0x9C, 0xA7, 0x0D, 0x71, 0x99, 0x77,
+    0x29, 0xFC, 0xA4, 0xAF, 0xE3, 0xAC, 0xA2, 0xAC, 0xA2, 0xAC, 0xA2, 0x9D, 0x2A, 0xCA, 0x29, 0xD2,
+    0xDA, 0x2E, 0x2F, 0xF9, 0x2F, 0xF3, 0xFF, 0x92, 0xE9, 0x1E, 0x2E, 0x91, 0xE9, 0x1E, 0x91, 0xEA,
+    0x1E, 0x91, 0xF0, 0x9E, 0xA1, 0xF7, 0x40, 0x29, 0x95, 0xD4, 0xAC, 0xA4, 0xD7, 0x4A, 0xDA, 0xD1,
+    0xAF, 0xC9, 0x0A, 0xE9, 0x91, 0xAD, 0x4A, 0xD4, 0xE4, 0xE4, 0xE3, 0x9E, 0x92, 0x76, 0xF7, 0xEA,
+    0x7E, 0x96, 0x9E, 0x7A, 0xE7, 0xAA, 0xA9, 0x77, 0x76, 0x9F, 0xCA, 0x4A, 0xFE, 0x3A, 0xCA, 0x2A,
+    0xCA, 0x2A, 0xCA, 0x29, 0xD2, 0xAC, 0xA2, 0x9D, 0x2D, 0xA2, 0xE2, 0xFF, 0x92, 0xFF, 0x3F, 0xF9,
+    0x2E, 0x91, 0xE2, 0xE9, 0x1E, 0x91, 0xE9, 0x1E, 0xA1, 0xE9, 0x1F, 0x09, 0xEA, 0x1F, 0x74, 0x09,
+    0x99, 0x93, 0xF3, 0xAD, 0xA3, 0xE9, 0x29, 0xE3, 0xAE, 0x39, 0x99, 0x75, 0xAD, 0xAD, 0x1A, 0xFC,
+    0x90, 0xAE, 0x99, 0x1A, 0xD4, 0xAD, 0x4E, 0x4E, 0x4E, 0x39, 0xE9, 0x20, 0x09, 0x93, 0x99, 0x39,
+    0xD9, 0x0A, 0xCA, 0x49, 0xFA, 0x69, 0xE7, 0x09, 0xC7, 0x77, 0x69, 0xFC, 0xA4, 0xAF, 0xE3, 0xAC,
+    0xA2, 0xAC, 0xA2, 0xAC, 0xA2, 0x9D, 0x2A, 0xCA, 0x29, 0xD2, 0xDA, 0x2E, 0x2F, 0xF9, 0x2F, 0xF3,
+    0xFF, 0x92, 0xE9, 0x1E, 0x2E, 0x91, 0xE9, 0x1E, 0x91, 0xEA, 0x1E, 0x91, 0xF0, 0x9E, 0xA1, 0xF7,
+    0x40, 0x9A, 0x92, 0x9A, 0x90, 0xDA, 0x0D, 0xA2, 0xFA, 0x4E, 0x6A, 0x76, 0xAD, 0xAD, 0x2A, 0xFC,
+    0x91, 0xAE, 0x99, 0x2A, 0xD5, 0xAD, 0x5E, 0x5E, 0x5E, 0x49, 0xE9, 0x20, 0x69, 0x97, 0x2A, 0xC9,
+    0x72, 0xD7, 0x2A, 0xCA, 0x77, 0x71, 0x99, 0x97, 0x9F, 0xE5, 0xFE, 0x94, 0xAD, 0xA2, 0x95, 0xE7,
+    0x2E, 0x72, 0xAE, 0xA9, 0x70, 0xFE, 0x96, 0xAF, 0xE7, 0x09, 0xFA, 0x71, 0xAE, 0x2A, 0xCA, 0x3A,
+    0xE1, 0x9F, 0xFD, 0xA1, 0xFF, 0xE3, 0xAA, 0xFC, 0xA9, 0x77, 0x00, 0x49, 0x97, 0xD6, 0x9C, 0xA6,
+    0xD9, 0x77, 0xAF, 0x92, 0xDA, 0xAA, 0xC3, 0xD7, 0xAE, 0xA9, 0x5A, 0xF6, 0x9D, 0xA1, 0xEA, 0xEA,
+    0x0F, 0xF1, 0x9A, 0xFA, 0x73, 0x5C, 0xA7, 0x2E, 0x97, 0x0F, 0xC9, 0x6D, 0x91, 0xD9, 0x77, 0x77,
+    0x49, 0x99, 0x79, 0xFE, 0x5F, 0xE9, 0x4A, 0xDA, 0x29, 0x5E, 0x72, 0xE7, 0x2A, 0xEA, 0x97, 0x0F,
+    0xE9, 0x6A, 0xFE, 0x70, 0x9F, 0xA7, 0x1A, 0xE2, 0xAC, 0xA3, 0xAE, 0x19, 0xFF, 0xDA, 0x1F, 0xFE,
+    0x3A, 0xAF, 0xCA, 0x97, 0x70, 0x75, 0xAC, 0x95, 0xAE, 0x4A, 0xDA, 0xD2, 0xAC, 0xA1, 0x9D, 0x75,
+    0xAF, 0x92, 0xDA, 0xAA, 0xC3, 0xD7, 0xAE, 0xA9, 0x5A, 0xF6, 0x9D, 0xA1, 0xEA, 0xEA, 0x0F, 0xF1,
+    0x9A, 0xFA, 0x73, 0x59, 0x99, 0x79, 0xFE, 0x5F, 0xE9, 0x4A, 0xDA, 0x29, 0x5E, 0x72, 0xE7, 0x2A,
+    0xEA, 0x97, 0x0F, 0xE9, 0x6A, 0xFE, 0x70, 0x9F, 0xA7, 0x1A, 0xE2, 0xAC, 0xA3, 0xAE, 0x19, 0xFF,
+    0xDA, 0x1F, 0xFE, 0x29, 0xAF, 0xDA, 0x96, 0xD9, 0x71, 0x9A, 0xD7, 0x19, 0xE7, 0x19, 0xAA, 0x70,
+    0x74, 0xAF, 0x92, 0xDA, 0xAA, 0xC3, 0xD7, 0xAE, 0xA9, 0x5A, 0xF6, 0x9D, 0xA1, 0xEA, 0xEA, 0x0F,
+    0xF1, 0xAF, 0xCA, 0x39, 0xC7, 0xAD, 0xA5, 0xAA, 0xCA, 0x5D, 0xA4, 0x2A, 0xA2, 0x9A, 0xA5, 0x9D,
+    0x9A, 0xD7, 0x9F, 0x71, 0x9D, 0x73, 0x99, 0x77, 0x71, 0x99, 0x97, 0x9F, 0xE5, 0xFE, 0x94, 0xAD,
+    0xA2, 0x95, 0xE7, 0x2E, 0x72, 0xAE, 0xA9, 0x70, 0xFE, 0x96, 0xAF, 0xE7, 0x09, 0xFA, 0x71, 0xAE,
+    0x2A, 0xCA, 0x3A, 0xE1, 0x9F, 0xFD, 0xA1, 0xFF, 0xE3, 0xAA, 0xFC, 0xA9, 0x77, 0x00, 0x09, 0xCA,
+    0x2A, 0xC9, 0x1A, 0xD9, 0xDA, 0x3A, 0xEA, 0x5A, 0xCA, 0x79, 0x77, 0x0A, 0xF9, 0x2D, 0xAA, 0xAC,
+    0x3D, 0x7A, 0xEA, 0x95, 0xAF, 0x69, 0xDA, 0x1E, 0xAE, 0xA0, 0xFF, 0x19, 0xAF, 0xA7, 0x30, 0x9F,
+    0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x4A, 0xD7, 0x1A, 0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70, 0xE9,
+    0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xEA, 0x70, 0xEA, 0x71, 0xC9, 0x71, 0x9D,
+    0x97, 0x09, 0x9D, 0x70, 0xAD, 0xA7, 0x0A, 0xA9, 0x40, 0x73, 0x9C, 0xA5, 0xDA, 0x5D, 0xA3, 0xFE,
+    0x1F, 0xE9, 0x2D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0xAA, 0xA3, 0xFC, 0x3F, 0xC9, 0x2C, 0xA5,
+    0x9E, 0x49, 0xAD, 0x49, 0xD9, 0x20, 0x2A, 0x93, 0xA9, 0x4A, 0xD0, 0xAD, 0x6A, 0xF7, 0x0A, 0xD7,
+    0x2A, 0x97, 0x77, 0x69, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xF4, 0xAD, 0x71, 0xAD, 0x97, 0x0A, 0xD9,
+    0x70, 0xAD, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0xA7, 0x0E,
+    0xA3, 0x70, 0xD7, 0x09, 0xD7, 0x09, 0xD3, 0x9C, 0xA1, 0xAD, 0x3D, 0xA1, 0x99, 0x93, 0xDA, 0x6F,
+    0xE4, 0xFE, 0x95, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xDA, 0xAA, 0x6F, 0xC6, 0xFC,
+    0x97, 0x60, 0x9F, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x4A, 0xD7, 0x1A, 0xD9, 0x70, 0xAD, 0x95, 0xAF,
+    0xF3, 0xAF, 0xF6, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xEA, 0x70, 0xEA, 0x30, 0x75,
+    0x9C, 0xA6, 0xDA, 0x6D, 0xA4, 0xFE, 0x2F, 0xE9, 0x3D, 0x93, 0xFF, 0x90, 0xFF, 0x93, 0xD9, 0x6D,
+    0xAA, 0xA4, 0xFC, 0x4F, 0xC9, 0x71, 0x3A, 0xCA, 0x0C, 0x96, 0xE9, 0xCA, 0x59, 0xC9, 0xE9, 0x6A,
+    0x90, 0xAA, 0x77, 0x77, 0x72, 0x9E, 0x93, 0xEA, 0x9E, 0x93, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE9,
+    0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x1E, 0x4E, 0x1E, 0x4E, 0x1E, 0x92, 0x9E, 0x1F, 0xFE,
+    0x1A, 0xFF, 0xCA, 0x19, 0xFF, 0xC9, 0x29, 0xFE, 0x97, 0x60, 0x2D, 0x99, 0xC3, 0xAF, 0xC3, 0xD0,
+    0xAC, 0xA7, 0x77, 0x79, 0xCA, 0x3D, 0x99, 0xD3, 0xD9, 0x9D, 0x3D, 0x90, 0xD3, 0xDA, 0x0D, 0x29,
+    0xDA, 0x0D, 0x91, 0xAD, 0xA0, 0xFF, 0xA0, 0xAF, 0xEA, 0x1A, 0xEA, 0xDA, 0x69, 0x99, 0x49, 0xFE,
+    0x93, 0xAF, 0xE9, 0x77, 0x77, 0x77, 0x59, 0xE9, 0x3E, 0xA9, 0xE9, 0x3E, 0x90, 0xE4, 0xE9, 0x0E,
+    0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE1, 0xE4, 0xE1, 0xE4, 0xE1, 0xE9, 0x29, 0xE1,
+    0xFF, 0xE1, 0xAF, 0xFC, 0xA1, 0x9F, 0xFC, 0x92, 0x9F, 0xE9, 0x76, 0x39, 0x99, 0x99, 0x1F, 0xF1,
+    0xFC, 0xAA, 0xA7, 0x77, 0x69, 0xCA, 0x3D, 0x99, 0xD3, 0xD9, 0x9D, 0x3D, 0x90, 0xD3, 0xDA, 0x0D,
+    0x29, 0xDA, 0x0D, 0x91, 0xAD, 0xA0, 0xFF, 0xA0, 0xAF, 0xEA, 0x1A, 0xEA, 0xDA, 0x29, 0x90, 0x91,
+    0x95, 0xFE, 0x5A, 0xFD, 0x6A, 0xEA, 0x77, 0x77, 0x72, 0x9E, 0x93, 0xEA, 0x9E, 0x93, 0xE9, 0x0E,
+    0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x1E, 0x4E, 0x1E, 0x4E, 0x1E,
+    0x92, 0x9E, 0x1F, 0xFE, 0x1A, 0xFF, 0xCA, 0x19, 0xFF, 0xC9, 0x29, 0xFE, 0x97, 0x60, 0x72, 0x9D,
+    0x19, 0xD1, 0x9F, 0xDA, 0x2A, 0xFA, 0x77, 0x77, 0x9C, 0xA3, 0xD9, 0x9D, 0x3D, 0x99, 0xD3, 0xD9,
+    0x0D, 0x3D, 0xA0, 0xD2, 0x9D, 0xA0, 0xD9, 0x1A, 0xDA, 0x0F, 0xFA, 0x0A, 0xFE, 0xA1, 0xAE, 0xAD,
+    0xA0, 0x4A, 0xCA, 0x70, 0x9C, 0xAC, 0x97, 0x9E, 0x71, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x09, 0xE9,
+    0x3E, 0xA9, 0xE9, 0x3E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x90, 0xE4,
+    0xE1, 0xE4, 0xE1, 0xE4, 0xE1, 0xE9, 0x29, 0xE1, 0xFF, 0xE1, 0xAF, 0xFC, 0xA1, 0x9F, 0xFC, 0x92,
+    0x9F, 0xE9, 0x76, 0x29, 0xD6, 0xF5, 0xF5, 0x9D, 0x77, 0x77, 0x19, 0xCA, 0x3D, 0x99, 0xD3, 0xD9,
+    0x9D, 0x3D, 0x90, 0xD3, 0xDA, 0x0D, 0x29, 0xDA, 0x0D, 0x91, 0xAD, 0xA0, 0xFF, 0xA0, 0xAF, 0xEA,
+    0x1A, 0xEA, 0xDA, 0x3D, 0xA3, 0xAD, 0x29, 0xDA, 0x3E, 0x2A, 0xDA, 0x29, 0xE7, 0x77, 0x77, 0x79,
+    0xE9, 0x3E, 0xA1, 0x9E, 0x93, 0xE9, 0x2E, 0x4E, 0x92, 0xE4, 0xE9, 0x2E, 0x4E, 0x92, 0xE4, 0xE9,
+    0x2E, 0x4E, 0x3E, 0x4E, 0x3E, 0x4E, 0x3E, 0x92, 0x9E, 0x3F, 0xFE, 0x3A, 0xFF, 0xCA, 0x39, 0xFF,
+    0xC9, 0x49, 0xFE, 0x97, 0x72, 0x29, 0xD9, 0x3D, 0xA2, 0xAD, 0x92, 0x9D, 0xA2, 0xE3, 0xAD, 0xA7,
+    0x77, 0x71, 0x9C, 0xA3, 0xD9, 0x49, 0xD3, 0xD9, 0x49, 0xD3, 0xD9, 0x5D, 0x3D, 0xA5, 0xD2, 0x9D,
+    0xA5, 0xD9, 0x1A, 0xDA, 0x5F, 0xFA, 0x5A, 0xFE, 0xA6, 0xAE, 0xAD, 0xA3, 0x9E, 0x93, 0xEA, 0x9E,
+    0x93, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x1E, 0x4E,
+    0x1E, 0x4E, 0x1E, 0x92, 0x9E, 0x1F, 0xFE, 0x1A, 0xFF, 0xCA, 0x19, 0xFF, 0xC9, 0x29, 0xFE, 0x97,
+    0x0D, 0x71, 0xAC, 0x97, 0x1A, 0xE7, 0x1A, 0xD7, 0x70, 0x9C, 0xA3, 0xD9, 0x9D, 0x3D, 0x99, 0xD3,
+    0xD9, 0x0D, 0x3D, 0xA0, 0xD2, 0x9D, 0xA0, 0xDA, 0x1A, 0xDA, 0x0F, 0xFA, 0x09, 0xFE, 0xA1, 0x9E,
+    0xAD, 0xA5, 0xAC, 0xA5, 0x9C, 0xA6, 0x9E, 0x6A, 0xD7, 0x20, 0x70, 0xD7, 0x70, 0xAE, 0x76, 0xAF,
+    0xC7, 0x4A, 0xCA, 0x1A, 0xD7, 0x77, 0x77, 0x69, 0x99, 0x73, 0x99, 0x91, 0xE9, 0x71, 0x9E, 0x1E,
+    0xA7, 0x1A, 0xDA, 0x1A, 0xDA, 0x71, 0xE9, 0x1A, 0xE3, 0xAA, 0x3E, 0x29, 0xE2, 0xAD, 0xA1, 0x9E,
+    0x3E, 0x91, 0xF1, 0xAD, 0xA3, 0xEA, 0x0A, 0xF9, 0x0E, 0x93, 0xAE, 0x0F, 0xD0, 0xE4, 0x9E, 0xAF,
+    0xDA, 0xE5, 0xFD, 0xAA, 0xFC, 0xA5, 0xFD, 0x99, 0xFC, 0x95, 0xFD, 0x1F, 0xC6, 0xAF, 0x91, 0xAF,
+    0x69, 0xF3, 0xF3, 0x77, 0x39, 0xCA, 0x71, 0x9E, 0x97, 0x9D, 0xAD, 0x95, 0x9D, 0x2D, 0x97, 0x77,
+    0x77, 0x39, 0xD9, 0x6E, 0x0D, 0xA6, 0xDA, 0x0E, 0x1A, 0xC1, 0x9D, 0x90, 0xAD, 0x09, 0xE0, 0xAD,
+    0x19, 0xD9, 0xF9, 0xE2, 0xFF, 0xDA, 0x2F, 0xFD, 0x92, 0xAF, 0xFC, 0x4E, 0xA0, 0xEA, 0x4E, 0x1A,
+    0xD9, 0x77, 0x5D, 0x72, 0xAE, 0x70, 0xAF, 0xC6, 0xAC, 0xA1, 0xAD, 0x77, 0x77, 0x77, 0x73, 0xE5,
+    0xE1, 0xAD, 0x93, 0xAD, 0xA2, 0xE3, 0xE3, 0xAD, 0xA1, 0xAD, 0xA4, 0xE1, 0xE5, 0xAD, 0xAA, 0xDA,
+    0x6F, 0xD7, 0xFC, 0xA7, 0x9F, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xF4, 0x77,
+    0xAC, 0x96, 0x9E, 0x94, 0x9D, 0xAD, 0x92, 0xAC, 0xA2, 0xD9, 0x77, 0x77, 0x74, 0xD9, 0x3D, 0xA0,
+    0xAD, 0x3D, 0x91, 0xDA, 0x19, 0xD2, 0xAD, 0x90, 0xDA, 0x3E, 0x0D, 0x93, 0xAF, 0xC5, 0xFA, 0x5A,
+    0xE9, 0x6E, 0x7E, 0x6A, 0xD9, 0x3A, 0xFC, 0x4A, 0xF9, 0x4A, 0xDA, 0x50, 0x2A, 0xD1, 0xDA, 0x5E,
+    0x09, 0xDA, 0x5E, 0x0A, 0xE5, 0xAA, 0xA0, 0x9A, 0xAA, 0x77, 0x77, 0x77, 0x73, 0xE5, 0xE1, 0xAD,
+    0x93, 0xAD, 0xA2, 0xE3, 0xE3, 0xAD, 0xA1, 0xAD, 0xA4, 0xE1, 0xE5, 0xAD, 0xAA, 0xDA, 0x6F, 0xD7,
+    0xFC, 0xA7, 0x9F, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xF4, 0x69, 0x97, 0x29,
+    0xC9, 0x72, 0xD7, 0x29, 0xD7, 0x75, 0xFF, 0xE9, 0x1A, 0xFF, 0xD9, 0x19, 0xFF, 0xD9, 0x69, 0xFA,
+    0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x96, 0xFC, 0xA6, 0xFC, 0xA6, 0xFD, 0xAA, 0xAA, 0xA1, 0x9F,
+    0xFE, 0x90, 0x9F, 0xFE, 0xA0, 0x9F, 0xFF, 0x00, 0x49, 0xC9, 0x7D, 0x79, 0xCA, 0x79, 0x97, 0x77,
+    0x4F, 0xF2, 0xFF, 0x6E, 0x95, 0xE5, 0x9E, 0x5A, 0xE5, 0xFA, 0x99, 0x92, 0xFF, 0x90, 0x9F, 0xFC,
+    0x00, 0x49, 0xD9, 0x71, 0x9D, 0x97, 0x1A, 0xDA, 0x71, 0xAA, 0xA9, 0x77, 0x4F, 0xFE, 0x91, 0xAF,
+    0xFD, 0x91, 0x9F, 0xFD, 0x96, 0x9F, 0xA7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC9, 0x6F, 0xCA, 0x6F,
+    0xCA, 0x6F, 0xDA, 0xAA, 0xAA, 0x19, 0xFF, 0xE9, 0x09, 0xFF, 0xEA, 0x09, 0xFF, 0xF0, 0x3A, 0xD7,
+    0xAD, 0x96, 0xE9, 0x6A, 0xAA, 0x97, 0x77, 0x2F, 0xF2, 0xFF, 0x6E, 0x95, 0xE5, 0x9E, 0x5A, 0xE5,
+    0xFA, 0x99, 0x92, 0xFF, 0x90, 0x9F, 0xFC, 0x00, 0x77, 0x0D, 0x91, 0xAD, 0x6F, 0xD7, 0x0F, 0x72,
+    0xD7, 0x77, 0x73, 0xFF, 0xE9, 0x1A, 0xFF, 0xD9, 0x19, 0xFF, 0xD9, 0x69, 0xFA, 0x7F, 0xC7, 0xFC,
+    0x7F, 0xC7, 0xFC, 0x96, 0xFC, 0xA6, 0xFC, 0xA6, 0xFD, 0xAA, 0xAA, 0xA1, 0x9F, 0xFE, 0x90, 0x9F,
+    0xFE, 0xA0, 0x9F, 0xFF, 0x00, 0x74, 0xDA, 0x1D, 0x93, 0xFC, 0x95, 0xE9, 0x7C, 0xA7, 0x77, 0x76,
+    0xFF, 0x2F, 0xF6, 0xE9, 0x5E, 0x59, 0xE5, 0xAE, 0x5F, 0xA9, 0x99, 0x2F, 0xF9, 0x09, 0xFF, 0xC0,
+    0x39, 0x3F, 0xA0, 0x9F, 0xA0, 0xAD, 0x92, 0xE3, 0xDA, 0x3D, 0xA3, 0xDA, 0x3E, 0x3E, 0x3E, 0x3E,
+    0x3E, 0x3E, 0x71, 0x74, 0x97, 0x6D, 0x49, 0xAE, 0xA9, 0x1D, 0x3A, 0xFE, 0xAA, 0xCA, 0x2F, 0xA9,
+    0xAF, 0xC2, 0x9E, 0x4E, 0x92, 0xE5, 0x9E, 0x2E, 0x6E, 0x2D, 0xA6, 0xE1, 0x9D, 0xA6, 0xE2, 0xE6,
+    0xE2, 0xF9, 0x29, 0xF2, 0xFF, 0xFC, 0x29, 0xFF, 0xE9, 0x3A, 0xFF, 0xCA, 0x59, 0xAF, 0xCA, 0x97,
+    0x73, 0x77, 0x4D, 0x3A, 0xDA, 0x90, 0xD1, 0x9F, 0xDA, 0xD1, 0xDA, 0x19, 0xE1, 0x9D, 0x3D, 0xA1,
+    0x9D, 0x3E, 0x2E, 0x99, 0xAD, 0xA2, 0xFF, 0x92, 0x9F, 0xDA, 0x5A, 0xE9, 0x30, 0x77, 0x9F, 0xEA,
+    0x39, 0xFF, 0xD9, 0x1F, 0xD2, 0xAD, 0x1D, 0x9A, 0xD3, 0xD9, 0x0D, 0x0E, 0x29, 0xD9, 0x0A, 0xC0,
+    0xFF, 0xC9, 0x1C, 0x0F, 0xFC, 0x29, 0x0F, 0xEA, 0x5E, 0xAA, 0x97, 0xE7, 0x2E, 0x72, 0xE9, 0x71,
+    0xE9, 0x70, 0x9E, 0x95, 0x75, 0xAD, 0x97, 0xE9, 0x69, 0xD9, 0x99, 0x94, 0x9D, 0xAF, 0x92, 0x9F,
+    0xAA, 0xD2, 0x9E, 0x92, 0xCA, 0x19, 0xE3, 0xD1, 0x9E, 0x3D, 0x19, 0xE9, 0x2D, 0x19, 0xFF, 0xC1,
+    0x9F, 0xF9, 0x19, 0xFE, 0x92, 0xAD, 0x19, 0x94, 0xE7, 0x0E, 0x79, 0xDA, 0x79, 0xAA, 0x97, 0x72,
+    0xFF, 0x1F, 0xF1, 0xAD, 0x96, 0xE7, 0xE6, 0x9D, 0xA6, 0x9D, 0x6A, 0xCA, 0x5D, 0xA4, 0x9E, 0x5F,
+    0xF1, 0xFF, 0x1A, 0xAA, 0xAA, 0xAA, 0xA0, 0x0F, 0xFF, 0xCA, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x99,
+    0x2A, 0xD7, 0x2A, 0xD9, 0x71, 0xAD, 0x97, 0x1A, 0xD9, 0x71, 0xE9, 0x71, 0xE9, 0x71, 0xE9, 0x71,
+    0xE9, 0x71, 0xE9, 0x71, 0xEA, 0x71, 0xEA, 0x30, 0x4A, 0xC5, 0xE4, 0xAE, 0x4A, 0xD5, 0xDA, 0x5D,
+    0xA5, 0xDA, 0x3F, 0xE1, 0xFE, 0x92, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xDA, 0xAA, 0x3F, 0xC3,
+    0xFC, 0x97, 0x00, 0x9F, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x4A, 0xD7, 0x1A, 0xD9, 0x70, 0xAD, 0x97,
+    0x0A, 0xD9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xEA, 0x70, 0xFC,
+    0x79, 0xF9, 0x70, 0xAD, 0x97, 0x60, 0x73, 0xCA, 0x74, 0xD7, 0x4D, 0x09, 0xE9, 0x3F, 0x90, 0x9E,
+    0x93, 0xEA, 0x2E, 0x4E, 0x92, 0xE4, 0xE9, 0x2E, 0x4E, 0x92, 0xE4, 0xE9, 0x2E, 0x4E, 0x3E, 0x4E,
+    0x3E, 0x4E, 0x3E, 0x92, 0x9E, 0x3F, 0xFE, 0x3A, 0xFF, 0xCA, 0x39, 0xFF, 0xC9, 0x49, 0xFE, 0x97,
+    0x72, 0x70, 0x99, 0x71, 0x9C, 0x97, 0x0A, 0xC9, 0x9C, 0xA3, 0xF0, 0x9D, 0x3E, 0x19, 0xD3, 0xD9,
+    0x2D, 0x3D, 0xA2, 0xD2, 0x9D, 0xA2, 0xD9, 0x1A, 0xDA, 0x2F, 0xFA, 0x2A, 0xFE, 0xA3, 0xAE, 0xAD,
+    0xA1, 0x9D, 0x93, 0x9D, 0xA3, 0x9E, 0x70, 0x19, 0x92, 0xCA, 0x1A, 0xC9, 0x1D, 0x10, 0x74, 0x9C,
+    0xA5, 0x9E, 0x93, 0x9D, 0xAD, 0xA1, 0x9D, 0x2A, 0xCA, 0x00, 0x09, 0xD0, 0xAC, 0x0E, 0xAA, 0xC0,
+    0xCA, 0x9D, 0xA0, 0x99, 0x09, 0x90, 0x39, 0x99, 0x99, 0x1A, 0xFE, 0x1F, 0xDA, 0xA0, 0x79, 0x99,
+    0x1A, 0xFF, 0xC9, 0x9E, 0xAA, 0xAA, 0xAA, 0xA9, 0x71, 0xD9, 0x1D, 0x1F, 0xE1, 0x9F, 0xC5, 0x93,
+    0x0A, 0xA9, 0x1E, 0x1E, 0x09, 0xE0, 0x70, 0xD0, 0x9D, 0x09, 0xD9, 0x9D, 0x9A, 0xD9, 0xAD, 0x90,
+    0x0C, 0xA2, 0xA9, 0x0A, 0xC1, 0x91, 0x09, 0xD1, 0xCA, 0xCA, 0x0E, 0xA0, 0x9D, 0x00, 0x3D, 0xA3,
+    0xAD, 0x29, 0xDA, 0x3A, 0xD2, 0xAD, 0xA3, 0xE7, 0x71, 0x9D, 0x2A, 0xCA, 0x19, 0xDA, 0xDA, 0x39,
+    0xEA, 0x59, 0xCA, 0x75, 0x9D, 0x93, 0xDA, 0x49, 0xDA, 0x3E, 0x49, 0xE3, 0xE9, 0x77, 0xAE, 0x19,
+    0xE2, 0xE2, 0xEA, 0x1A, 0xE2, 0xAA, 0xA0, 0x09, 0xAA, 0xA9, 0x09, 0xE9, 0x09, 0xE1, 0xAD, 0xA1,
+    0xE9, 0x09, 0xE1, 0x0A, 0xAA, 0xA1, 0xF1, 0xAD, 0xA1, 0x9E, 0x2E, 0x91, 0xEA, 0x1A, 0xC9, 0x0A,
+    0xD9, 0x0E, 0x91, 0xAC, 0x92, 0x90, 0x0C, 0xA2, 0xDA, 0x1E, 0x90, 0xCA, 0x29, 0x20, 0x0A, 0xA9,
+    0x99, 0x3F, 0xE1, 0x99, 0x99, 0xAD, 0x6D, 0x6D, 0x00, 0x09, 0xC9, 0x09, 0xCA, 0x0A, 0xC9, 0x9D,
+    0x1A, 0x10, 0x19, 0x1A, 0xC9, 0x0C, 0xA1, 0xD9, 0x1A, 0x40, 0x19, 0x93, 0xD2, 0xF1, 0xF0, 0x0F,
+    0x1F, 0x2D, 0x39, 0x91, 0x49, 0x90, 0xAD, 0xA0, 0x99, 0x40, 0x09, 0xAA, 0xAE, 0xA1, 0xFF, 0x19,
+    0x99, 0x99, 0x99, 0x10, 0x0A, 0xA9, 0x1D, 0xA0, 0x9E, 0x0A, 0xE0, 0x0D, 0x1D, 0x09, 0xD9, 0x9D,
+    0x9A, 0xD9, 0xAD, 0x97, 0x09, 0xD1, 0xCA, 0xCA, 0x0E, 0xA0, 0x9D, 0x00, 0x0A, 0xAA, 0xA1, 0xF1,
+    0xEA, 0x1E, 0x90, 0x9E, 0x1E, 0xA1, 0x19, 0x2A, 0xC2, 0xE1, 0xA9, 0xCA, 0x0E, 0x90, 0xAA, 0x90,
+    0x09, 0xCA, 0x09, 0xD9, 0x0D, 0x91, 0xF9, 0x9E, 0x94, 0x09, 0x99, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0,
+    0xDA, 0x9D, 0xA0, 0x9F, 0xD9, 0xFD, 0x9D, 0x0A, 0xD9, 0xD0, 0x9D, 0x0A, 0xA9, 0x3A, 0xA2, 0xDA,
+    0x0A, 0xD9, 0x3F, 0xC9, 0x5E, 0x96, 0x9C, 0xA3, 0x4A, 0x97, 0xE6, 0xFC, 0x4E, 0x9E, 0x2D, 0xA2,
+    0xAD, 0x00, 0x0D, 0x90, 0xCA, 0xAE, 0x9C, 0xAD, 0x0E, 0xAD, 0x09, 0xD0, 0x09, 0xAA, 0xF1, 0xFE,
+    0xA7, 0x00, 0x0A, 0xAA, 0xF0, 0x9F, 0xE9, 0x99, 0x99, 0x99, 0x91, 0x0D, 0x90, 0xCA, 0xAE, 0x9C,
+    0xAD, 0x0E, 0xAD, 0x09, 0xD0, 0xAF, 0xFA, 0xFF, 0x09, 0x19, 0xD1, 0x9C, 0x99, 0xD0, 0x9C, 0x94,
+    0x7D, 0xA0, 0x9D, 0x9D, 0xA0, 0x9D, 0x9F, 0xE9, 0xFE, 0x99, 0x99, 0x99, 0x99, 0x00, 0x9F, 0xCA,
+    0x9F, 0xCA, 0x9C, 0x90, 0x9C, 0xA9, 0xC9, 0x09, 0xCA, 0x9F, 0xCA, 0x9F, 0xCA, 0x19, 0x99, 0xA1,
+    0xFC, 0x90, 0xC9, 0xCA, 0xCA, 0x0C, 0x0C, 0xAA, 0xA0, 0x90, 0x92, 0x0A, 0x99, 0x92, 0xD3, 0xD2,
+    0xC9, 0xAA, 0x00, 0x09, 0xD0, 0xAC, 0x0E, 0xAA, 0xC0, 0xCA, 0x9D, 0xA0, 0x99, 0x09, 0x90, 0x2C,
+    0xA0, 0xDA, 0xAC, 0xAA, 0x90, 0x39, 0xC9, 0x5D, 0x59, 0xD5, 0x99, 0x97, 0x77, 0x77, 0x70, 0xAC,
+    0xA0, 0xAC, 0xA1, 0xE0, 0xE1, 0xE0, 0xE0, 0x9F, 0xD9, 0xFD, 0x9D, 0x0A, 0xD9, 0xD0, 0x9D, 0x09,
+    0xAA, 0xAF, 0x1F, 0xF1, 0x99, 0x99, 0x99, 0x97, 0x4A, 0xFE, 0x1F, 0xF7, 0x20, 0x0D, 0x90, 0xAC,
+    0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0x7F, 0xC1, 0xFC,
+    0x90, 0x99, 0xAD, 0x92, 0x9D, 0x93, 0x99, 0x00, 0x74, 0xC2, 0xEA, 0xDA, 0xAF, 0xAF, 0x9A, 0xEA,
+    0xAC, 0x9A, 0xE3, 0xCA, 0x5C, 0x94, 0xAC, 0x5D, 0x5C, 0xA4, 0x9C, 0x59, 0x50, 0x77, 0x6A, 0xCA,
+    0x74, 0xDA, 0x74, 0xE7, 0x77, 0x77, 0x9F, 0xA2, 0x9E, 0x19, 0xFE, 0x90, 0x9E, 0x1F, 0x0A, 0xE9,
+    0xAE, 0x1F, 0x19, 0xFD, 0x91, 0x99, 0x99, 0x9C, 0xA0, 0x9A, 0xA9, 0x79, 0xD7, 0x49, 0xAA, 0x70,
+    0x72, 0xAD, 0xA1, 0xAA, 0x99, 0xFC, 0x0A, 0xCA, 0xAD, 0x0A, 0xF9, 0x09, 0x91, 0x9A, 0xA9, 0x19,
+    0xAA, 0x91, 0x99, 0x09, 0xFA, 0x0D, 0xAA, 0xD9, 0xD9, 0xD9, 0x9A, 0xA0, 0x9F, 0x59, 0xAA, 0x90,
+    0x69, 0x19, 0x3D, 0x99, 0xD3, 0x91, 0x96, 0x09, 0xA1, 0xAC, 0x29, 0x00, 0x77, 0xCA, 0x71, 0xCA,
+    0x09, 0xD9, 0x49, 0xAD, 0x29, 0xFF, 0xCA, 0x69, 0x99, 0x99, 0x93, 0x49, 0x99, 0x99, 0x7F, 0xFC,
+    0xA2, 0x9D, 0x94, 0x9A, 0xD1, 0xCA, 0x71, 0xCA, 0x76, 0x77, 0x77, 0xAA, 0x4F, 0xFF, 0xF9, 0x1F,
+    0xFF, 0xF9, 0x75, 0xAC, 0x97, 0x75, 0x5D, 0x97, 0x1A, 0xE7, 0x1F, 0x97, 0x9F, 0xA7, 0xDA, 0xAD,
+    0x69, 0xD9, 0x0D, 0x95, 0xAD, 0x1E, 0x5E, 0x1A, 0xD9, 0x39, 0xDA, 0x19, 0xDA, 0x3F, 0xFD, 0x29,
+    0xFF, 0xDA, 0x1A, 0xFF, 0xE1, 0xE9, 0x4E, 0x99, 0xE5, 0xEA, 0x9F, 0xDA, 0x39, 0xFF, 0x29, 0xDA,
+    0x19, 0xE1, 0x9D, 0x92, 0x9D, 0x19, 0xD9, 0x29, 0xD1, 0x9D, 0xA9, 0x9A, 0xDA, 0x19, 0xFF, 0x29,
+    0xFF, 0xC9, 0x09, 0xD9, 0x29, 0xE0, 0x9D, 0x93, 0xE0, 0x9E, 0xAA, 0xAF, 0x09, 0xFF, 0xD0, 0x9F,
+    0xFC, 0x90, 0x9F, 0xEA, 0x91, 0x0F, 0xEA, 0x0F, 0xEA, 0x0D, 0xAA, 0xAA, 0xA9, 0x0D, 0x6D, 0x6D,
+    0x6D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xDA, 0x5D, 0xA5, 0xDA, 0x75, 0x59, 0x97, 0x29,
+    0xE7, 0x1F, 0x97, 0x9F, 0xC7, 0xEA, 0xD9, 0x59, 0xDA, 0x0E, 0x5E, 0x1A, 0xD9, 0x39, 0xDA, 0x19,
+    0xE3, 0xE9, 0x2E, 0x91, 0x9E, 0x3A, 0xE1, 0xE9, 0x4E, 0x1F, 0xFF, 0x90, 0xFF, 0xF9, 0x0A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0A, 0xAF, 0xE1, 0xFF, 0xC1, 0xEA, 0xA9, 0x99, 0x91, 0xE7, 0xE7,
+    0xE9, 0x9A, 0xA3, 0xFE, 0x92, 0xFE, 0x3E, 0x7E, 0x7E, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC, 0x09, 0xFF,
+    0xC9, 0x9F, 0xFC, 0xA0, 0x1F, 0xFE, 0x91, 0xAF, 0xFD, 0x91, 0x9F, 0xFD, 0x96, 0x9F, 0xA7, 0xFC,
+    0x7F, 0xC7, 0xFC, 0x7F, 0xC9, 0x6F, 0xCA, 0x6F, 0xCA, 0x6F, 0xDA, 0xAA, 0xAA, 0x19, 0xFF, 0xE9,
+    0x09, 0xFF, 0xEA, 0x09, 0xFF, 0xF0, 0x0E, 0x4A, 0xD1, 0xE4, 0xAD, 0x90, 0xE4, 0xAD, 0x90, 0xE4,
+    0xAD, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0xAA, 0xAA, 0xAE, 0xA0, 0xFF, 0xEA,
+    0x0F, 0xFE, 0xA0, 0xFF, 0xEA, 0x0E, 0x93, 0xEA, 0x9E, 0x93, 0xEA, 0x9E, 0x93, 0xF0, 0x39, 0xAE,
+    0xA9, 0x6A, 0xFE, 0xA4, 0xFA, 0x9A, 0xEA, 0x29, 0xE4, 0xE9, 0x1E, 0x59, 0xE1, 0xE0, 0x9A, 0xAA,
+    0xC0, 0xE1, 0xDA, 0xAF, 0xCA, 0xE0, 0x9D, 0xA9, 0x99, 0x99, 0x1E, 0x1E, 0x6E, 0x1F, 0x92, 0x9F,
+    0x1F, 0xFF, 0xC1, 0x9F, 0xFE, 0x92, 0xAF, 0xFC, 0xA4, 0x9A, 0xFC, 0xA9, 0x77, 0x10, 0x0E, 0x1E,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x09, 0xE9, 0x1E, 0x1E, 0xA3,
+    0xE0, 0x9E, 0x4D, 0xA0, 0xE9, 0x4D, 0xA9, 0xE4, 0x9D, 0xAE, 0x59, 0xFC, 0xA5, 0x9F, 0xC6, 0xAF,
+    0x96, 0xAF, 0xA6, 0xFD, 0xA5, 0xFF, 0x4E, 0x0F, 0xC3, 0xE1, 0xFC, 0x19, 0xE1, 0x9F, 0xC9, 0x4F,
+    0xA7, 0x09, 0xFC, 0x70, 0xAF, 0xC9, 0x7F, 0xDA, 0x69, 0xFE, 0x6A, 0xEA, 0xE9, 0x5E, 0xA0, 0xEA,
+    0x49, 0xE1, 0xAE, 0x4A, 0xE2, 0xE9, 0x3E, 0x92, 0xAD, 0xA3, 0xE3, 0x9E, 0x2A, 0xDA, 0x4E, 0x91,
+    0xE5, 0x9D, 0xA1, 0xE6, 0xE0, 0x0F, 0x49, 0xE1, 0xF9, 0x3F, 0x1F, 0xA3, 0xF1, 0xFC, 0x2A, 0xF9,
+    0x0F, 0xCA, 0x1F, 0xC9, 0x0F, 0xD0, 0x9F, 0xC9, 0x0F, 0xD9, 0xFD, 0x90, 0xEA, 0xFD, 0xAD, 0x90,
+    0xE0, 0xFC, 0xAA, 0xD9, 0x0E, 0x0F, 0xC9, 0xEA, 0x0E, 0x09, 0xF0, 0xEA, 0x0E, 0x1E, 0xA0, 0xEA,
+    0x9E, 0x1E, 0x90, 0xEA, 0x9E, 0x91, 0x99, 0x1E, 0xA0, 0x19, 0x99, 0x4D, 0xA0, 0x9E, 0x4D, 0x90,
+    0x9E, 0xA2, 0x9D, 0x90, 0x9F, 0x29, 0xD9, 0x0A, 0xFA, 0x19, 0xD9, 0x0A, 0xFC, 0x19, 0xD9, 0x0A,
+    0xDA, 0xDA, 0x0A, 0xD1, 0xEA, 0xAD, 0x0A, 0xD1, 0xEA, 0x9D, 0xAA, 0xD1, 0xEA, 0x0F, 0xD1, 0xEA,
+    0x09, 0xFC, 0x1E, 0xA1, 0xFC, 0x1F, 0x1A, 0xF0, 0x9F, 0x2F, 0x00, 0x74, 0x9F, 0xFC, 0x19, 0xFF,
+    0xC7, 0x77, 0x77, 0x73, 0xFD, 0xA4, 0xFD, 0xA7, 0x77, 0x2F, 0xFE, 0x0F, 0xFE, 0x0A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x39, 0xAE, 0xA9, 0x6A, 0xFE, 0xA4, 0xFA, 0x9A, 0xEA, 0x29, 0xE4, 0xE9, 0x1E,
+    0x59, 0xE1, 0xE6, 0xE1, 0xDA, 0x6E, 0x09, 0xDA, 0x6E, 0x1E, 0x6E, 0x1F, 0x92, 0x9F, 0x1F, 0xFF,
+    0xC1, 0x9F, 0xFE, 0x92, 0xAF, 0xFC, 0xA4, 0x9A, 0xFC, 0xA9, 0x77, 0x10, 0x0F, 0xFA, 0x0F, 0xFA,
+    0x0D, 0x3D, 0xA0, 0xD3, 0xDA, 0x0D, 0x3D, 0xA0, 0xD3, 0xDA, 0x0D, 0x3D, 0xA0, 0xD3, 0xDA, 0x0D,
+    0x3D, 0xA0, 0xD3, 0xDA, 0x0D, 0x3D, 0xA0, 0xD3, 0xDA, 0x0A, 0xA3, 0x9A, 0x90, 0x73, 0xAF, 0xCA,
+    0x3A, 0xFE, 0x91, 0xAD, 0x2A, 0xD1, 0xAD, 0x3D, 0x90, 0xE2, 0x9D, 0x90, 0xFF, 0xC9, 0x0F, 0xFC,
+    0x1F, 0xEA, 0x2E, 0xAA, 0x94, 0xE7, 0xE7, 0xE9, 0x6E, 0x95, 0x9E, 0x95, 0x72, 0xFF, 0x1F, 0xF1,
+    0xE7, 0xE7, 0xE6, 0x9D, 0xA6, 0x9D, 0x6D, 0x94, 0x9D, 0xA4, 0xAD, 0xA5, 0xFF, 0x1F, 0xF1, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x00, 0x9F, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x4A, 0xD7, 0x1A, 0xD9, 0x70, 0xAD,
+    0x97, 0x0A, 0xD9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xEA, 0x70,
+    0xEA, 0x30, 0x0E, 0x5E, 0x1A, 0xD9, 0x3A, 0xDA, 0x2E, 0x3E, 0x3A, 0xDA, 0x1A, 0xDA, 0x4E, 0x1E,
+    0x5A, 0xDA, 0xAD, 0xA6, 0xFD, 0x7F, 0xCA, 0x79, 0xF7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E,
+    0xA7, 0x1F, 0x40, 0x77, 0x7A, 0xD7, 0x5A, 0xD7, 0x5E, 0x97, 0x1A, 0xFF, 0x94, 0xAF, 0xFF, 0x29,
+    0xE9, 0x0D, 0xA0, 0x9E, 0xA1, 0xEA, 0x1D, 0xA1, 0x9E, 0x99, 0xE2, 0xDA, 0x2E, 0xAA, 0xE2, 0xDA,
+    0x2F, 0xAE, 0x2D, 0xA2, 0xF9, 0xE9, 0x1D, 0xA1, 0x9E, 0xA9, 0xFC, 0xAE, 0xAF, 0xC9, 0x0F, 0xFF,
+    0xE2, 0xFF, 0xFC, 0x49, 0xAF, 0xEA, 0x97, 0x1D, 0x97, 0x5D, 0x97, 0x5D, 0x96, 0x09, 0xDA, 0x4A,
+    0xD2, 0xE4, 0xDA, 0x29, 0xE2, 0xE4, 0xAD, 0x90, 0xAD, 0x95, 0xE9, 0xE6, 0xAF, 0xC9, 0x7F, 0xA7,
+    0x0A, 0xE9, 0x70, 0xFC, 0x7F, 0xDA, 0x5A, 0xEA, 0xE9, 0x39, 0xE9, 0x0F, 0x3F, 0x2F, 0x1F, 0x3A,
+    0xEA, 0x09, 0x93, 0xA9, 0x09, 0x99, 0x0D, 0x92, 0xD0, 0xAC, 0xA0, 0xD9, 0x2D, 0x0A, 0xCA, 0x0D,
+    0x92, 0xD0, 0xD9, 0x0D, 0xA2, 0xD0, 0xD9, 0x0A, 0xD1, 0x9D, 0xAD, 0x19, 0xE9, 0x9F, 0xC2, 0xFF,
+    0xC9, 0x3F, 0xEA, 0x59, 0xAE, 0x71, 0x9C, 0xA7, 0x19, 0xCA, 0x71, 0x9C, 0xA7, 0x1A, 0xCA, 0x71,
+    0xAC, 0xA7, 0x19, 0xA9, 0x30, 0x29, 0xAE, 0xA5, 0xAF, 0xE9, 0x29, 0xE9, 0x09, 0xE2, 0xE4, 0xDA,
+    0x09, 0xD9, 0x4A, 0xD0, 0x9D, 0x59, 0xD0, 0xAD, 0x59, 0xD9, 0xAD, 0x59, 0xD9, 0xAD, 0x59, 0xD9,
+    0x9D, 0x94, 0xE1, 0xAD, 0x3A, 0xD9, 0x0F, 0xC9, 0x0F, 0xC9, 0xFC, 0x90, 0xFC, 0xAF, 0xC9, 0x0F,
+    0xCA, 0x74, 0x75, 0x9E, 0xAC, 0xA3, 0x9F, 0xE3, 0xD9, 0x1E, 0x3C, 0xA2, 0x9D, 0x29, 0xC9, 0x3D,
+    0x29, 0xC9, 0x29, 0xD9, 0x2F, 0xF9, 0x09, 0x0A, 0xFF, 0xCA, 0x1A, 0xE9, 0xFA, 0x79, 0x99, 0x00,
+    0x77, 0x77, 0x3A, 0xAA, 0x6F, 0xC9, 0x3A, 0xFD, 0x92, 0xAD, 0xA9, 0xE2, 0xDA, 0x2D, 0x91, 0xD9,
+    0x2D, 0x91, 0xD9, 0xAF, 0x2D, 0x9A, 0xF9, 0x1D, 0x90, 0x99, 0xE1, 0xDA, 0x3D, 0xA0, 0xFC, 0xAE,
+    0x90, 0xFF, 0xC9, 0x0F, 0xFC, 0x1D, 0x90, 0xAD, 0xA2, 0xD9, 0x7D, 0x97, 0xD9, 0x60, 0x0D, 0x92,
+    0xAD, 0x1A, 0xD2, 0x9D, 0x2D, 0x91, 0x9D, 0x2E, 0x19, 0xD2, 0x9D, 0xA0, 0xAD, 0x3E, 0x0E, 0x39,
+    0xFC, 0x94, 0xFC, 0x5F, 0xA5, 0xAE, 0x6A, 0xE6, 0x9E, 0x7E, 0x7E, 0x7D, 0xA2, 0x74, 0xAF, 0xD9,
+    0x1A, 0xFE, 0x91, 0xAD, 0x19, 0x9A, 0x91, 0x9E, 0x7A, 0xE9, 0x69, 0xEA, 0x5A, 0xFA, 0x3F, 0xEA,
+    0x1A, 0xE9, 0x9E, 0x1E, 0x29, 0xDA, 0x0E, 0x29, 0xDA, 0x0E, 0xA0, 0x9A, 0xD9, 0x0A, 0xFF, 0x2A,
+    0xFD, 0x93, 0x9E, 0xA2, 0x70, 0xF2, 0xAC, 0x1C, 0xA1, 0xAC, 0x6E, 0x3A, 0xCA, 0x99, 0x91, 0xD1,
+    0xD1, 0xAF, 0xC2, 0xAD, 0xA2, 0x72, 0xFD, 0xA1, 0xFD, 0xA2, 0xAD, 0xA3, 0xAD, 0x93, 0x9D, 0x94,
+    0xE5, 0xD9, 0x5D, 0xA5, 0x9F, 0xA9, 0x29, 0xFC, 0x49, 0xE5, 0xE4, 0xEA, 0x3A, 0xE7, 0x20, 0x0D,
+    0xA7, 0x0E, 0xAA, 0xE4, 0xAF, 0xE3, 0xAD, 0xA0, 0x9D, 0xA2, 0xE2, 0xAD, 0x2D, 0xA2, 0x9D, 0x2E,
+    0x29, 0xD2, 0xE2, 0xAD, 0x2E, 0x2A, 0xD2, 0xE2, 0xAD, 0x2E, 0x2A, 0xD7, 0x0E, 0x70, 0xE7, 0x0E,
+    0x70, 0xE9, 0x73, 0x29, 0xEA, 0x4A, 0xDA, 0xDA, 0x3D, 0x2D, 0x91, 0xAC, 0xA2, 0xAC, 0xA1, 0xDA,
+    0x29, 0xD1, 0xFF, 0xC1, 0xFF, 0xC1, 0xE2, 0xAD, 0x1E, 0x2E, 0x1E, 0x90, 0x9E, 0x1A, 0xFE, 0xA2,
+    0xFE, 0x39, 0xFC, 0xA4, 0x9A, 0xCA, 0x92, 0x0A, 0xA9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D,
+    0x92, 0xDA, 0x2D, 0xA2, 0xE2, 0xE9, 0x90, 0xFA, 0x0F, 0x90, 0x1C, 0xA0, 0xDA, 0x29, 0xCA, 0x9D,
+    0x39, 0xCA, 0xD9, 0x3A, 0xEA, 0x4A, 0xE5, 0xAE, 0x5F, 0xC4, 0xD9, 0xE9, 0x2D, 0x1E, 0xA0, 0x0D,
+    0xA9, 0x6F, 0xC5, 0xFC, 0x96, 0x9E, 0x7A, 0xD7, 0xAD, 0xA6, 0xF5, 0xAF, 0x5F, 0xCA, 0x3A, 0xD9,
+    0xAD, 0x3D, 0xA0, 0x9D, 0x2A, 0xD2, 0xD9, 0x1D, 0xA2, 0xAD, 0x0A, 0xD3, 0x9D, 0x00, 0x0A, 0xCA,
+    0x3D, 0x90, 0xE3, 0xD9, 0x0E, 0x3D, 0x90, 0xE3, 0xDA, 0x0E, 0x29, 0xDA, 0x0E, 0x91, 0xAD, 0xA0,
+    0xFF, 0xCA, 0x0F, 0xFC, 0xA0, 0xDA, 0xEA, 0xDA, 0x0D, 0x70, 0xCA, 0x70, 0x0D, 0x92, 0xAD, 0x1A,
+    0xD2, 0x9D, 0x2D, 0x91, 0x9D, 0x2E, 0x19, 0xD2, 0x9D, 0xA0, 0xAD, 0x3E, 0x0E, 0x39, 0xFC, 0xA4,
+    0xFC, 0x5F, 0xC5, 0xAE, 0x97, 0x40, 0x71, 0xFD, 0xA1, 0xFD, 0xA2, 0x9F, 0x3F, 0xC3, 0xFC, 0x39,
+    0xF3, 0xAD, 0xA9, 0x3D, 0xA5, 0xAF, 0x4F, 0xC5, 0x9D, 0x94, 0xAD, 0x93, 0xAE, 0x4E, 0x97, 0x10,
+    0x2A, 0xE9, 0x29, 0xFD, 0xA1, 0xDA, 0x19, 0xD9, 0x9D, 0x3D, 0xA9, 0xD3, 0xE0, 0xE9, 0x9A, 0xDA,
+    0x0F, 0xF9, 0x09, 0xFD, 0xA3, 0xAE, 0x91, 0x0F, 0xFD, 0x1F, 0xFD, 0x2A, 0xD0, 0x9D, 0x93, 0xAD,
+    0x09, 0xD4, 0xAD, 0x09, 0xD4, 0xAC, 0xA0, 0xAD, 0x4D, 0xA0, 0xAC, 0xA4, 0xDA, 0x0F, 0x3D, 0x90,
+    0xAE, 0x39, 0x97, 0x77, 0x9F, 0x94, 0x9E, 0xAD, 0x93, 0xDA, 0x2D, 0x29, 0xD9, 0x2A, 0xC2, 0xAD,
+    0x92, 0xAC, 0x91, 0xEA, 0x2D, 0x2F, 0xCA, 0xE2, 0xFF, 0xA1, 0x9F, 0xEA, 0x2A, 0xD9, 0x9A, 0xA9,
+    0x3E, 0x70, 0xE7, 0x0E, 0x70, 0x73, 0xAD, 0x92, 0x9F, 0xCA, 0x1D, 0xA1, 0xD1, 0xD6, 0xD6, 0xDA,
+    0x59, 0xDA, 0x5A, 0xDA, 0x5E, 0x5E, 0x5E, 0x69, 0xA2, 0x2A, 0xFE, 0x90, 0x9F, 0xFC, 0x90, 0xDA,
+    0x19, 0xD9, 0x19, 0xD3, 0xDA, 0x19, 0xD3, 0xE2, 0xE9, 0x9A, 0xDA, 0x2F, 0xF9, 0x29, 0xFD, 0xA5,
+    0xAE, 0x93, 0x0F, 0xFC, 0x1F, 0xFC, 0x4A, 0xD7, 0xAC, 0xA7, 0xDA, 0x7D, 0x97, 0xD9, 0x7F, 0x6F,
+    0x75, 0x0D, 0x1D, 0xA1, 0xD1, 0x9D, 0x1D, 0x2D, 0x90, 0xD9, 0x1A, 0xCA, 0x0D, 0x91, 0xAC, 0xA0,
+    0xDA, 0x1A, 0xD0, 0xAD, 0xAA, 0xE0, 0xAF, 0xDA, 0x1F, 0xD2, 0x9E, 0xA1, 0x77, 0x4A, 0xCA, 0x73,
+    0xAC, 0xA7, 0x3A, 0xC9, 0x71, 0x9A, 0xEA, 0x96, 0xFF, 0xA4, 0xFD, 0xAF, 0x29, 0xDA, 0x0A, 0xC9,
+    0x0E, 0x91, 0xE1, 0xAC, 0x91, 0xE1, 0xE1, 0xAC, 0x91, 0xE1, 0xDA, 0x1A, 0xC9, 0x1E, 0x09, 0xDA,
+    0x1D, 0x91, 0xE1, 0xE1, 0xD9, 0x1E, 0x1E, 0xA0, 0xD9, 0x0A, 0xE1, 0xFF, 0xFC, 0x19, 0xFF, 0xE9,
+    0x2A, 0xFF, 0xCA, 0x49, 0xAF, 0xCA, 0x97, 0x0D, 0x74, 0xD7, 0x4D, 0x74, 0x99, 0x60, 0x75, 0xAC,
+    0xA9, 0x3A, 0xD1, 0xAE, 0xA1, 0x9D, 0x91, 0xAF, 0xA0, 0xDA, 0x49, 0xFD, 0x69, 0xFA, 0x7F, 0x70,
+    0xEA, 0x7A, 0xF6, 0x9F, 0xCA, 0x5E, 0x9E, 0xA3, 0xF0, 0xAF, 0xC0, 0xAE, 0x2F, 0xC0, 0xEA, 0x3A,
+    0xE7, 0x40, 0x76, 0xCA, 0x70, 0xCA, 0x70, 0xD5, 0xD0, 0xD9, 0xCA, 0x2D, 0x0D, 0x0D, 0x2D, 0x0A,
+    0xC0, 0xAC, 0x91, 0xD9, 0xAC, 0x09, 0xCA, 0x1D, 0x9A, 0xC0, 0x9D, 0x1D, 0xA9, 0xC0, 0x9D, 0x1A,
+    0xDA, 0xC9, 0xAD, 0x19, 0xFF, 0x2F, 0xE9, 0x3F, 0xC9, 0x59, 0xCA, 0x70, 0xCA, 0x70, 0xCA, 0x70,
+    0xCA, 0x70, 0xD7, 0x60, 0x77, 0x9D, 0x92, 0xD9, 0x3D, 0xA3, 0xAD, 0x2A, 0xD5, 0xD2, 0xDA, 0x09,
+    0xC9, 0x1D, 0x91, 0xDA, 0x09, 0xC9, 0x1D, 0x91, 0xDA, 0x09, 0xCA, 0x1D, 0x91, 0xEA, 0xEA, 0xE2,
+    0x9F, 0xFC, 0xA3, 0x9E, 0x9E, 0x97, 0x70, 0x5D, 0x97, 0x1A, 0xE7, 0x1F, 0x97, 0x9F, 0xA7, 0xDA,
+    0xAD, 0x69, 0xD9, 0x0D, 0x95, 0xAD, 0x1E, 0x5E, 0x1A, 0xD9, 0x39, 0xDA, 0x19, 0xDA, 0x3F, 0xFD,
+    0x29, 0xFF, 0xDA, 0x1A, 0xFF, 0xE1, 0xE9, 0x4E, 0x99, 0xE5, 0xEA, 0x77, 0x3D, 0x97, 0x19, 0xDA,
+    0x71, 0xAD, 0xA7, 0x19, 0xAA, 0xA4, 0x73, 0x9E, 0xAC, 0xA1, 0x9F, 0xE1, 0xD9, 0x1E, 0x1C, 0xA2,
+    0x9D, 0x09, 0xC9, 0x3D, 0x09, 0xC9, 0x29, 0xD9, 0x0F, 0xF9, 0x0A, 0xFE, 0xA1, 0xAE, 0x9D, 0xA7,
+    0x77, 0xAA, 0x69, 0xD9, 0x5A, 0xDA, 0x5E, 0xA2, 0x5A, 0xC9, 0x73, 0x9C, 0x73, 0xC9, 0x73, 0x97,
+    0x77, 0x77, 0xD9, 0x71, 0xAE, 0x71, 0xF9, 0x79, 0xFA, 0x7D, 0xAA, 0xD6, 0x9D, 0x90, 0xD9, 0x5A,
+    0xD1, 0xE5, 0xE1, 0xAD, 0x93, 0x9D, 0xA1, 0x9D, 0xA3, 0xFF, 0xD2, 0x9F, 0xFD, 0xA1, 0xAF, 0xFE,
+    0x1E, 0x94, 0xE9, 0x9E, 0x5E, 0xA0, 0x75, 0xAC, 0xA7, 0x9C, 0x69, 0xC7, 0x77, 0x73, 0x9E, 0xAC,
+    0xA1, 0x9F, 0xE1, 0xD9, 0x1E, 0x1C, 0xA2, 0x9D, 0x09, 0xC9, 0x3D, 0x09, 0xC9, 0x29, 0xD9, 0x0F,
+    0xF9, 0x0A, 0xFE, 0xA1, 0xAE, 0x9D, 0xA0, 0x69, 0x97, 0x29, 0xCA, 0x72, 0xD7, 0x29, 0xD7, 0x77,
+    0x19, 0xC9, 0x71, 0x9E, 0x70, 0x9F, 0xC6, 0x9D, 0x90, 0x9D, 0x97, 0x77, 0x73, 0xD9, 0x71, 0xAE,
+    0x71, 0xF9, 0x79, 0xFA, 0x7D, 0xAA, 0xD6, 0x9D, 0x90, 0xD9, 0x5A, 0xD1, 0xE5, 0xE1, 0xAD, 0x93,
+    0x9D, 0xA1, 0x9D, 0xA3, 0xFF, 0xD2, 0x9F, 0xFD, 0xA1, 0xAF, 0xFE, 0x1E, 0x94, 0xE9, 0x9E, 0x5E,
+    0xA0, 0x70, 0x97, 0x0A, 0xC5, 0x91, 0xD4, 0xAC, 0xAA, 0xCA, 0x3A, 0xE9, 0x4A, 0xDA, 0xD9, 0x29,
+    0xCA, 0x2A, 0xC9, 0x77, 0x70, 0x9E, 0xAC, 0xA2, 0x9F, 0xE2, 0xD9, 0x1E, 0x2C, 0xA2, 0x9D, 0x19,
+    0xC9, 0x3D, 0x19, 0xC9, 0x29, 0xD9, 0x1F, 0xF9, 0x1A, 0xFE, 0xA2, 0xAE, 0x9D, 0xA0, 0x0D, 0xA7,
+    0x5E, 0x29, 0xC9, 0x7A, 0xD9, 0x9E, 0x72, 0x9F, 0xC7, 0x09, 0xD9, 0x09, 0xD9, 0x77, 0x77, 0x71,
+    0xD9, 0x73, 0xAE, 0x73, 0xF9, 0x71, 0x9F, 0xA7, 0x1D, 0xAA, 0xD7, 0x09, 0xD9, 0x0D, 0x97, 0xAD,
+    0x1E, 0x7E, 0x1A, 0xD9, 0x59, 0xDA, 0x19, 0xDA, 0x5F, 0xFD, 0x49, 0xFF, 0xDA, 0x3A, 0xFF, 0xE3,
+    0xE9, 0x4E, 0x91, 0x9E, 0x5E, 0xA0, 0x0A, 0xD7, 0x4A, 0xD9, 0x73, 0xAD, 0xA7, 0x70, 0xAC, 0xA7,
+    0x29, 0xE9, 0x70, 0x9D, 0xAD, 0x96, 0x9D, 0x2D, 0x97, 0x77, 0x74, 0x9E, 0xAC, 0xA6, 0x9F, 0xE6,
+    0xD9, 0x1E, 0x6C, 0xA2, 0x9D, 0x59, 0xC9, 0x3D, 0x59, 0xC9, 0x29, 0xD9, 0x5F, 0xF9, 0x5A, 0xFE,
+    0xA6, 0xAE, 0x9D, 0xA0, 0x77, 0x3A, 0xCA, 0x73, 0x9C, 0x72, 0x9C, 0x77, 0x77, 0x79, 0xC9, 0x71,
+    0x9E, 0x70, 0x9F, 0xC6, 0x9D, 0x90, 0x9D, 0x97, 0x77, 0x73, 0xD9, 0x71, 0xAE, 0x71, 0xF9, 0x79,
+    0xFA, 0x7D, 0xAA, 0xD6, 0x9D, 0x90, 0xD9, 0x5A, 0xD1, 0xE5, 0xE1, 0xAD, 0x93, 0x9D, 0xA1, 0x9D,
+    0xA3, 0xFF, 0xD2, 0x9F, 0xFD, 0xA1, 0xAF, 0xFE, 0x1E, 0x94, 0xE9, 0x9E, 0x5E, 0xA0, 0x79, 0x71,
+    0x9D, 0xA7, 0x19, 0xC7, 0x09, 0xC9, 0x4A, 0xC1, 0xA9, 0x4A, 0xE6, 0xAF, 0xC4, 0xAC, 0xA1, 0xAD,
+    0x77, 0x74, 0x9E, 0xAC, 0xA3, 0x9F, 0xE3, 0xD9, 0x1E, 0x3C, 0xA2, 0x9D, 0x29, 0xC9, 0x3D, 0x29,
+    0xC9, 0x29, 0xD9, 0x2F, 0xF9, 0x2A, 0xFE, 0xA3, 0xAE, 0x9D, 0xA1, 0x4A, 0xA0, 0x9A, 0x7A, 0xDA,
+    0x9C, 0x7D, 0x9E, 0x79, 0xA0, 0x9A, 0x97, 0x77, 0xD7, 0x2A, 0xE7, 0x0A, 0xFC, 0x6A, 0xCA, 0x1A,
+    0xD7, 0x76, 0xD9, 0x71, 0xAE, 0x71, 0xF9, 0x79, 0xFA, 0x7D, 0xAA, 0xD6, 0x9D, 0x90, 0xD9, 0x5A,
+    0xD1, 0xE5, 0xE1, 0xAD, 0x93, 0x9D, 0xA1, 0x9D, 0xA3, 0xFF, 0xD2, 0x9F, 0xFD, 0xA1, 0xAF, 0xFE,
+    0x1E, 0x94, 0xE9, 0x9E, 0x5E, 0xA0, 0x2D, 0x09, 0xC3, 0xAE, 0x9C, 0x3D, 0x9E, 0x39, 0xA0, 0x9A,
+    0x97, 0x7D, 0x6A, 0xE4, 0xFD, 0x2D, 0xA1, 0x9D, 0x74, 0x9E, 0xAC, 0xA1, 0x9F, 0xE1, 0xD9, 0x1E,
+    0x1C, 0xA2, 0x9D, 0x09, 0xC9, 0x3D, 0x09, 0xC9, 0x29, 0xD9, 0x0F, 0xF9, 0x0A, 0xFE, 0xA1, 0xAE,
+    0x9D, 0xA0, 0x59, 0xC9, 0x71, 0x9E, 0x70, 0x9F, 0xC6, 0x9D, 0x90, 0x9D, 0x97, 0x77, 0x73, 0xD9,
+    0x71, 0xAE, 0x71, 0xF9, 0x79, 0xFA, 0x7D, 0xAA, 0xD6, 0x9D, 0x90, 0xD9, 0x5A, 0xD1, 0xE5, 0xE1,
+    0xAD, 0x93, 0x9D, 0xA1, 0x9D, 0xA3, 0xFF, 0xD2, 0x9F, 0xFD, 0xA1, 0xAF, 0xFE, 0x1E, 0x94, 0xE9,
+    0x9E, 0x5E, 0xA7, 0x73, 0xD9, 0x71, 0x9D, 0xA7, 0x1A, 0xDA, 0x71, 0x9A, 0xAA, 0x40, 0x75, 0xAC,
+    0xA5, 0x9E, 0x93, 0x9D, 0xAD, 0x91, 0x9D, 0x2D, 0x97, 0x75, 0x9E, 0xAC, 0xA1, 0x9F, 0xE1, 0xD9,
+    0x1E, 0x1C, 0xA2, 0x9D, 0x09, 0xC9, 0x3D, 0x09, 0xC9, 0x29, 0xD9, 0x0F, 0xF9, 0x0A, 0xFE, 0xA1,
+    0xAE, 0x9D, 0xA7, 0x77, 0xAA, 0x69, 0xD9, 0x5A, 0xDA, 0x5E, 0xA2, 0x6D, 0x72, 0xAC, 0x97, 0x2D,
+    0x73, 0x99, 0x77, 0x79, 0x39, 0x95, 0x9D, 0xAA, 0xE6, 0xFD, 0x96, 0x9F, 0x97, 0x77, 0x75, 0xD9,
+    0x71, 0xAE, 0x71, 0xF9, 0x79, 0xFA, 0x7D, 0xAA, 0xD6, 0x9D, 0x90, 0xD9, 0x5A, 0xD1, 0xE5, 0xE1,
+    0xAD, 0x93, 0x9D, 0xA1, 0x9D, 0xA3, 0xFF, 0xD2, 0x9F, 0xFD, 0xA1, 0xAF, 0xFE, 0x1E, 0x94, 0xE9,
+    0x9E, 0x5E, 0xA0, 0x4D, 0x6A, 0xC9, 0x6D, 0x79, 0x97, 0x77, 0x0A, 0xD1, 0x9D, 0x19, 0xFD, 0xA2,
+    0xAF, 0xA7, 0x77, 0x71, 0x9E, 0xAC, 0xA1, 0x9F, 0xE1, 0xD9, 0x1E, 0x1C, 0xA2, 0x9D, 0x09, 0xC9,
+    0x3D, 0x09, 0xC9, 0x29, 0xD9, 0x0F, 0xF9, 0x0A, 0xFE, 0xA1, 0xAE, 0x9D, 0xA0, 0x3E, 0x73, 0xAD,
+    0x97, 0x2A, 0xDA, 0x77, 0x77, 0x39, 0x39, 0x95, 0x9D, 0xAA, 0xE6, 0xFD, 0x96, 0x9F, 0x97, 0x77,
+    0x75, 0xD9, 0x71, 0xAE, 0x71, 0xF9, 0x79, 0xFA, 0x7D, 0xAA, 0xD6, 0x9D, 0x90, 0xD9, 0x5A, 0xD1,
+    0xE5, 0xE1, 0xAD, 0x93, 0x9D, 0xA1, 0x9D, 0xA3, 0xFF, 0xD2, 0x9F, 0xFD, 0xA1, 0xAF, 0xFE, 0x1E,
+    0x94, 0xE9, 0x9E, 0x5E, 0xA0, 0x1A, 0xCA, 0x7E, 0x7A, 0xD9, 0x77, 0x77, 0x0A, 0xD1, 0x9D, 0x19,
+    0xFD, 0xA2, 0xAF, 0xA7, 0x77, 0x71, 0x9E, 0xAC, 0xA1, 0x9F, 0xE1, 0xD9, 0x1E, 0x1C, 0xA2, 0x9D,
+    0x09, 0xC9, 0x3D, 0x09, 0xC9, 0x29, 0xD9, 0x0F, 0xF9, 0x0A, 0xFE, 0xA1, 0xAE, 0x9D, 0xA0, 0x5A,
+    0xC9, 0x73, 0x9C, 0x73, 0xCA, 0x73, 0x97, 0x77, 0x75, 0x93, 0x99, 0x59, 0xDA, 0xAE, 0x6F, 0xD9,
+    0x69, 0xF9, 0x77, 0x77, 0x5D, 0x97, 0x1A, 0xE7, 0x1F, 0x97, 0x9F, 0xA7, 0xDA, 0xAD, 0x69, 0xD9,
+    0x0D, 0x95, 0xAD, 0x1E, 0x5E, 0x1A, 0xD9, 0x39, 0xDA, 0x19, 0xDA, 0x3F, 0xFD, 0x29, 0xFF, 0xDA,
+    0x1A, 0xFF, 0xE1, 0xE9, 0x4E, 0x99, 0xE5, 0xEA, 0x75, 0xDA, 0x6E, 0x96, 0x9C, 0x69, 0xC9, 0x79,
+    0x77, 0x71, 0x93, 0x92, 0xAD, 0xAA, 0xDA, 0x2F, 0xD9, 0x29, 0xF9, 0x77, 0x79, 0xEA, 0xCA, 0x19,
+    0xFE, 0x1D, 0x91, 0xE1, 0xCA, 0x29, 0xD0, 0x9C, 0x93, 0xD0, 0x9C, 0x92, 0x9D, 0x90, 0xFF, 0x90,
+    0xAF, 0xEA, 0x1A, 0xE9, 0xDA, 0x4A, 0xA0, 0x9A, 0x7A, 0xDA, 0x9C, 0x7D, 0x9E, 0x7A, 0xA0, 0x9A,
+    0x97, 0x77, 0x73, 0x93, 0x99, 0x59, 0xDA, 0xAE, 0x6F, 0xD9, 0x69, 0xF9, 0x77, 0x77, 0x5D, 0x97,
+    0x1A, 0xE7, 0x1F, 0x97, 0x9F, 0xA7, 0xDA, 0xAD, 0x69, 0xD9, 0x0D, 0x95, 0xAD, 0x1E, 0x5E, 0x1A,
+    0xD9, 0x39, 0xDA, 0x19, 0xDA, 0x3F, 0xFD, 0x29, 0xFF, 0xDA, 0x1A, 0xFF, 0xE1, 0xE9, 0x4E, 0x99,
+    0xE5, 0xEA, 0x19, 0xD0, 0x9C, 0x3A, 0xFC, 0x3D, 0x0A, 0xCA, 0x77, 0x77, 0x0A, 0xD1, 0x9D, 0x19,
+    0xFD, 0xA2, 0xAF, 0xA7, 0x77, 0x71, 0x9E, 0xAC, 0xA1, 0x9F, 0xE1, 0xD9, 0x1E, 0x1C, 0xA2, 0x9D,
+    0x09, 0xC9, 0x3D, 0x09, 0xC9, 0x29, 0xD9, 0x0F, 0xF9, 0x0A, 0xFE, 0xA1, 0xAE, 0x9D, 0xA0, 0x39,
+    0x39, 0x95, 0x9D, 0xAA, 0xE6, 0xFD, 0x96, 0x9F, 0x97, 0x77, 0x75, 0xD9, 0x71, 0xAE, 0x71, 0xF9,
+    0x79, 0xFA, 0x7D, 0xAA, 0xD6, 0x9D, 0x90, 0xD9, 0x5A, 0xD1, 0xE5, 0xE1, 0xAD, 0x93, 0x9D, 0xA1,
+    0x9D, 0xA3, 0xFF, 0xD2, 0x9F, 0xFD, 0xA1, 0xAF, 0xFE, 0x1E, 0x94, 0xE9, 0x9E, 0x5E, 0xA7, 0x73,
+    0xD9, 0x71, 0x9D, 0xA7, 0x1A, 0xDA, 0x71, 0x9A, 0xAA, 0x40, 0x72, 0xAD, 0x19, 0xD1, 0x9F, 0xDA,
+    0x2A, 0xFA, 0x77, 0x77, 0x19, 0xEA, 0xCA, 0x19, 0xFE, 0x1D, 0x91, 0xE1, 0xCA, 0x29, 0xD0, 0x9C,
+    0x93, 0xD0, 0x9C, 0x92, 0x9D, 0x90, 0xFF, 0x90, 0xAF, 0xEA, 0x1A, 0xE9, 0xDA, 0x77, 0x7A, 0xA6,
+    0x9D, 0x95, 0xAD, 0xA5, 0xEA, 0x20, 0x0A, 0xAF, 0xE1, 0xFF, 0xC1, 0xEA, 0xA9, 0x99, 0x91, 0xE7,
+    0xE7, 0xE9, 0x9A, 0xA3, 0xFE, 0x92, 0xFE, 0x3E, 0x7E, 0x7E, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC, 0x09,
+    0xFF, 0xC9, 0x9F, 0xFC, 0xA7, 0x77, 0x74, 0xAD, 0x7A, 0xD7, 0xE9, 0x6A, 0xAA, 0x92, 0x2A, 0xE9,
+    0x3E, 0xAD, 0xA1, 0xDA, 0x09, 0x9D, 0x1F, 0xFA, 0x9D, 0xAA, 0xA9, 0x99, 0x09, 0xD9, 0x6F, 0xFA,
+    0x09, 0xFE, 0xA2, 0xAF, 0x97, 0x77, 0x72, 0xAD, 0x6E, 0x6E, 0x95, 0xAA, 0xA9, 0x10, 0x77, 0xD7,
+    0x1C, 0x97, 0xCA, 0x77, 0x77, 0x5A, 0xAF, 0xE1, 0xFF, 0xC1, 0xEA, 0xA9, 0x99, 0x91, 0xE7, 0xE7,
+    0xE9, 0x9A, 0xA3, 0xFE, 0x92, 0xFE, 0x3E, 0x7E, 0x7E, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC, 0x09, 0xFF,
+    0xC9, 0x9F, 0xFC, 0xA0, 0x3A, 0xC9, 0x79, 0xC7, 0xC9, 0x79, 0x77, 0x77, 0x76, 0xAE, 0x93, 0xEA,
+    0xDA, 0x1D, 0xA0, 0x99, 0xD1, 0xFF, 0xA9, 0xDA, 0xAA, 0x99, 0x90, 0x9D, 0x96, 0xFF, 0xA0, 0x9F,
+    0xEA, 0x2A, 0xF9, 0x00, 0x29, 0xA1, 0xA5, 0xE0, 0xCA, 0x39, 0xC9, 0xE9, 0x39, 0xC9, 0x9D, 0x77,
+    0x77, 0x4A, 0xAF, 0xE1, 0xFF, 0xC1, 0xEA, 0xA9, 0x99, 0x91, 0xE7, 0xE7, 0xE9, 0x9A, 0xA3, 0xFE,
+    0x92, 0xFE, 0x3E, 0x7E, 0x7E, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC, 0x09, 0xFF, 0xC9, 0x9F, 0xFC, 0xA0,
+    0x2D, 0x09, 0xC3, 0xAE, 0x9C, 0x3D, 0x9E, 0x39, 0xA0, 0x9A, 0x97, 0x77, 0x77, 0x4A, 0xE9, 0x3E,
+    0xAD, 0xA1, 0xDA, 0x09, 0x9D, 0x1F, 0xFA, 0x9D, 0xAA, 0xA9, 0x99, 0x09, 0xD9, 0x6F, 0xFA, 0x09,
+    0xFE, 0xA2, 0xAF, 0x90, 0x77, 0x2D, 0x72, 0xEA, 0x29, 0x93, 0xDA, 0xE1, 0xCA, 0x2D, 0x91, 0xAD,
+    0xAC, 0x97, 0x2D, 0x77, 0x0A, 0xAF, 0xE4, 0xFF, 0xC4, 0xEA, 0xA9, 0x99, 0x94, 0xE7, 0x2E, 0x72,
+    0xE9, 0x9A, 0xA6, 0xFE, 0x95, 0xFE, 0x6E, 0x72, 0xE7, 0x2E, 0xAA, 0xAA, 0xAA, 0x4F, 0xFC, 0x39,
+    0xFF, 0xC9, 0x29, 0xFF, 0xCA, 0x20, 0x39, 0xCA, 0x39, 0x93, 0xE9, 0x19, 0xCA, 0x2F, 0xC9, 0x0D,
+    0x91, 0xD9, 0x09, 0xDA, 0xD7, 0x77, 0x77, 0x77, 0xAE, 0x96, 0xEA, 0xDA, 0x4D, 0xA0, 0x99, 0xD4,
+    0xFF, 0xA2, 0x9D, 0xAA, 0xA9, 0x99, 0x39, 0xD9, 0x71, 0xFF, 0xA3, 0x9F, 0xEA, 0x5A, 0xF9, 0x30,
+    0x9D, 0x73, 0xAD, 0x97, 0x2A, 0xDA, 0x1D, 0x72, 0xEA, 0x70, 0xDA, 0xE6, 0xD9, 0x1A, 0xD7, 0x77,
+    0x70, 0xAA, 0xFE, 0x4F, 0xFC, 0x4E, 0xAA, 0x99, 0x99, 0x4E, 0x72, 0xE7, 0x2E, 0x99, 0xAA, 0x6F,
+    0xE9, 0x5F, 0xE6, 0xE7, 0x2E, 0x72, 0xEA, 0xAA, 0xAA, 0xA4, 0xFF, 0xC3, 0x9F, 0xFC, 0x92, 0x9F,
+    0xFC, 0xA0, 0x0D, 0x97, 0x19, 0xDA, 0x72, 0xE0, 0x9C, 0xA7, 0x09, 0xE9, 0x7F, 0xC9, 0x5D, 0x90,
+    0x9D, 0x97, 0x77, 0x77, 0x77, 0x1A, 0xE9, 0x6E, 0xAD, 0xA4, 0xDA, 0x09, 0x9D, 0x4F, 0xFA, 0x29,
+    0xDA, 0xAA, 0x99, 0x93, 0x9D, 0x97, 0x1F, 0xFA, 0x39, 0xFE, 0xA5, 0xAF, 0x90, 0x7A, 0xC9, 0x70,
+    0x9C, 0x70, 0xCA, 0x4D, 0x09, 0xA4, 0xEA, 0x5D, 0xAE, 0x3D, 0x91, 0xAD, 0x77, 0x7A, 0xAF, 0xE1,
+    0xFF, 0xC1, 0xEA, 0xA9, 0x99, 0x91, 0xE7, 0xE7, 0xE9, 0x9A, 0xA3, 0xFE, 0x92, 0xFE, 0x3E, 0x7E,
+    0x7E, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC, 0x09, 0xFF, 0xC9, 0x9F, 0xFC, 0xA0, 0x7D, 0x97, 0x0A, 0xAC,
+    0x71, 0xAA, 0x4A, 0xC9, 0x0A, 0x94, 0x9E, 0x69, 0xFC, 0x49, 0xD1, 0x9D, 0x77, 0x77, 0x77, 0x5A,
+    0xE9, 0x5E, 0xAD, 0xA3, 0xDA, 0x09, 0x9D, 0x3F, 0xFA, 0x19, 0xDA, 0xAA, 0x99, 0x92, 0x9D, 0x97,
+    0x0F, 0xFA, 0x29, 0xFE, 0xA4, 0xAF, 0x92, 0x2A, 0xCA, 0x0C, 0x94, 0xE9, 0xCA, 0x39, 0xC9, 0xE9,
+    0x4A, 0x90, 0xAA, 0x77, 0x19, 0xCA, 0x69, 0xE9, 0x49, 0xDA, 0xD9, 0x29, 0xD2, 0xD9, 0x74, 0xAA,
+    0xFE, 0x1F, 0xFC, 0x1E, 0xAA, 0x99, 0x99, 0x1E, 0x7E, 0x7E, 0x99, 0xAA, 0x3F, 0xE9, 0x2F, 0xE3,
+    0xE7, 0xE7, 0xEA, 0xAA, 0xAA, 0xA1, 0xFF, 0xC0, 0x9F, 0xFC, 0x99, 0xFF, 0xCA, 0x2A, 0xA0, 0x9A,
+    0x3A, 0xFC, 0x3D, 0x0A, 0xCA, 0x77, 0x9C, 0xA6, 0xE9, 0x4F, 0xC9, 0x2D, 0x90, 0x9D, 0x97, 0x77,
+    0x77, 0x2A, 0xE9, 0x3E, 0xAD, 0xA1, 0xDA, 0x09, 0x9D, 0x1F, 0xFA, 0x9D, 0xAA, 0xA9, 0x99, 0x09,
+    0xD9, 0x6F, 0xFA, 0x09, 0xFE, 0xA2, 0xAF, 0x90, 0x77, 0xD7, 0xEA, 0x5D, 0xAE, 0x3D, 0x91, 0xAD,
+    0x77, 0x7A, 0xAF, 0xE1, 0xFF, 0xC1, 0xEA, 0xA9, 0x99, 0x91, 0xE7, 0xE7, 0xE9, 0x9A, 0xA3, 0xFE,
+    0x92, 0xFE, 0x3E, 0x7E, 0x7E, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC, 0x09, 0xFF, 0xC9, 0x9F, 0xFC, 0xA7,
+    0x77, 0x74, 0xAD, 0x7A, 0xD7, 0xE9, 0x6A, 0xAA, 0x92, 0x39, 0xCA, 0x6E, 0x94, 0xFC, 0x92, 0xD9,
+    0x09, 0xD9, 0x77, 0x77, 0x72, 0xAE, 0x93, 0xEA, 0xDA, 0x1D, 0xA0, 0x99, 0xD1, 0xFF, 0xA9, 0xDA,
+    0xAA, 0x99, 0x90, 0x9D, 0x96, 0xFF, 0xA0, 0x9F, 0xEA, 0x2A, 0xF9, 0x77, 0x77, 0x2A, 0xD6, 0xE6,
+    0xE9, 0x5A, 0xAA, 0x91, 0x59, 0xD3, 0xC2, 0xC9, 0x77, 0x5E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x09, 0xE9, 0x4D, 0x91, 0xAA, 0x09, 0xC7, 0x5D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x09, 0xD0, 0x9D, 0x09, 0xD9, 0x9D, 0x90, 0x0E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x09, 0xE9, 0x77, 0x9A, 0xA1, 0xE1, 0xE0, 0x9E, 0x00, 0x9D,
+    0x9A, 0xD9, 0xAD, 0xAA, 0xAA, 0x97, 0x0D, 0x1D, 0x1D, 0x1D, 0x1D, 0x09, 0xD0, 0x9D, 0x09, 0xD9,
+    0x9D, 0x97, 0x4A, 0xA0, 0x9D, 0x9A, 0xDA, 0xEA, 0x39, 0xAE, 0xA9, 0x6A, 0xFE, 0xA4, 0xFA, 0x9A,
+    0xEA, 0x29, 0xE4, 0xE9, 0x1E, 0x59, 0xE1, 0xE6, 0xE1, 0xDA, 0x6E, 0x09, 0xDA, 0x6E, 0x1E, 0x6E,
+    0x1F, 0x92, 0x9F, 0x1F, 0xFF, 0xC1, 0x9F, 0xFE, 0x92, 0xAF, 0xFC, 0xA4, 0x9A, 0xFC, 0xA9, 0x77,
+    0x77, 0x77, 0x77, 0x4E, 0x73, 0xE7, 0x3E, 0x72, 0x9A, 0xAA, 0x50, 0x2A, 0xE9, 0x29, 0xFD, 0xA1,
+    0xDA, 0x19, 0xD9, 0x9D, 0x3D, 0xA9, 0xD3, 0xE0, 0xE9, 0x9A, 0xDA, 0x0F, 0xF9, 0x09, 0xFD, 0xA3,
+    0xAE, 0x97, 0x77, 0x73, 0xDA, 0x6E, 0x59, 0xE5, 0x9A, 0xAA, 0x20, 0x59, 0xCA, 0x75, 0xC7, 0x4A,
+    0xA7, 0x49, 0x77, 0x77, 0x70, 0x9A, 0xEA, 0x96, 0xAF, 0xEA, 0x4F, 0xA9, 0xAE, 0xA2, 0x9E, 0x4E,
+    0x91, 0xE5, 0x9E, 0x1E, 0x6E, 0x1D, 0xA6, 0xE0, 0x9D, 0xA6, 0xE1, 0xE6, 0xE1, 0xF9, 0x29, 0xF1,
+    0xFF, 0xFC, 0x19, 0xFF, 0xE9, 0x2A, 0xFF, 0xCA, 0x49, 0xAF, 0xCA, 0x97, 0x71, 0x3A, 0xC9, 0x79,
+    0xC7, 0xC9, 0x79, 0x77, 0x72, 0xAE, 0x92, 0x9F, 0xDA, 0x1D, 0xA1, 0x9D, 0x99, 0xD3, 0xDA, 0x9D,
+    0x3E, 0x0E, 0x99, 0xAD, 0xA0, 0xFF, 0x90, 0x9F, 0xDA, 0x3A, 0xE9, 0x10, 0x6D, 0x73, 0xE9, 0x29,
+    0x94, 0xFC, 0x90, 0x9C, 0xA3, 0xD9, 0x1D, 0x9D, 0x97, 0x29, 0xD7, 0x49, 0x94, 0x9A, 0xEA, 0x96,
+    0xAF, 0xEA, 0x4F, 0xA9, 0xAE, 0xA2, 0x9E, 0x4E, 0x91, 0xE5, 0x9E, 0x1E, 0x6E, 0x1D, 0xA6, 0xE0,
+    0x9D, 0xA6, 0xE1, 0xE6, 0xE1, 0xF9, 0x29, 0xF1, 0xFF, 0xFC, 0x19, 0xFF, 0xE9, 0x2A, 0xFF, 0xCA,
+    0x49, 0xAF, 0xCA, 0x97, 0x71, 0x71, 0x99, 0x49, 0xC9, 0x2C, 0xA3, 0x9E, 0x1A, 0xC9, 0x29, 0xFC,
+    0x9D, 0x29, 0xD9, 0x09, 0xD9, 0x77, 0x77, 0xAE, 0x95, 0x9F, 0xDA, 0x4D, 0xA1, 0x9D, 0x92, 0x9D,
+    0x3D, 0xA2, 0x9D, 0x3E, 0x3E, 0x99, 0xAD, 0xA3, 0xFF, 0x93, 0x9F, 0xDA, 0x6A, 0xE9, 0x40, 0x0A,
+    0xD7, 0x6A, 0xD9, 0x2D, 0x70, 0xAD, 0xA0, 0xE9, 0x73, 0xFC, 0x97, 0x1D, 0x91, 0xDA, 0x77, 0x77,
+    0x72, 0x9A, 0xEA, 0x97, 0x0A, 0xFE, 0xA6, 0xFA, 0x9A, 0xEA, 0x49, 0xE4, 0xE9, 0x3E, 0x59, 0xE3,
+    0xE6, 0xE3, 0xDA, 0x6E, 0x29, 0xDA, 0x6E, 0x3E, 0x6E, 0x3F, 0x92, 0x9F, 0x3F, 0xFF, 0xC3, 0x9F,
+    0xFE, 0x94, 0xAF, 0xFC, 0xA6, 0x9A, 0xFC, 0xA9, 0x77, 0x30, 0x9D, 0x97, 0x19, 0xDA, 0x71, 0x9E,
+    0x09, 0xC9, 0x70, 0x9E, 0x79, 0xFC, 0x94, 0x9D, 0x90, 0x9D, 0x97, 0x77, 0x7A, 0xE9, 0x59, 0xFD,
+    0xA4, 0xDA, 0x19, 0xD9, 0x29, 0xD3, 0xDA, 0x29, 0xD3, 0xE3, 0xE9, 0x9A, 0xDA, 0x3F, 0xF9, 0x39,
+    0xFD, 0xA6, 0xAE, 0x91, 0x59, 0xCA, 0x75, 0xC7, 0x4D, 0x73, 0xE9, 0x71, 0xAF, 0x97, 0xAC, 0xA0,
+    0x9D, 0x96, 0x99, 0x39, 0x97, 0x75, 0x9A, 0xEA, 0x96, 0xAF, 0xEA, 0x4F, 0xA9, 0xAE, 0xA2, 0x9E,
+    0x4E, 0x91, 0xE5, 0x9E, 0x1E, 0x6E, 0x1D, 0xA6, 0xE0, 0x9D, 0xA6, 0xE1, 0xE6, 0xE1, 0xF9, 0x29,
+    0xF1, 0xFF, 0xFC, 0x19, 0xFF, 0xE9, 0x2A, 0xFF, 0xCA, 0x49, 0xAF, 0xCA, 0x97, 0x71, 0x7C, 0xA9,
+    0x70, 0xAA, 0xC7, 0x1A, 0xC7, 0x0A, 0xC9, 0x4D, 0x90, 0xA5, 0xAE, 0x6A, 0xDA, 0xD4, 0xAC, 0xA1,
+    0x9D, 0x77, 0x1A, 0xE9, 0x49, 0xFD, 0xA3, 0xDA, 0x19, 0xD9, 0x19, 0xD3, 0xDA, 0x19, 0xD3, 0xE2,
+    0xE9, 0x9A, 0xDA, 0x2F, 0xF9, 0x29, 0xFD, 0xA5, 0xAE, 0x93, 0x49, 0x91, 0xA7, 0x09, 0xE0, 0xC9,
+    0x7A, 0xC9, 0xE9, 0x79, 0xA1, 0xAA, 0x77, 0x71, 0xAC, 0x97, 0x29, 0xE7, 0x19, 0xFC, 0x79, 0xD1,
+    0x9D, 0x77, 0x69, 0xAE, 0xA9, 0x6A, 0xFE, 0xA4, 0xFA, 0x9A, 0xEA, 0x29, 0xE4, 0xE9, 0x1E, 0x59,
+    0xE1, 0xE6, 0xE1, 0xDA, 0x6E, 0x09, 0xDA, 0x6E, 0x1E, 0x6E, 0x1F, 0x92, 0x9F, 0x1F, 0xFF, 0xC1,
+    0x9F, 0xFE, 0x92, 0xAF, 0xFC, 0xA4, 0x9A, 0xFC, 0xA9, 0x77, 0x10, 0x2A, 0xA0, 0x9A, 0x3A, 0xDA,
+    0x9C, 0x3D, 0xAE, 0x3D, 0x0A, 0xCA, 0x77, 0xD6, 0xAE, 0x4A, 0xFC, 0x2A, 0xCA, 0x1A, 0xD7, 0x5A,
+    0xE9, 0x29, 0xFD, 0xA1, 0xDA, 0x19, 0xD9, 0x9D, 0x3D, 0xA9, 0xD3, 0xE0, 0xE9, 0x9A, 0xDA, 0x0F,
+    0xF9, 0x09, 0xFD, 0xA3, 0xAE, 0x91, 0x6D, 0x73, 0xE9, 0x71, 0xFC, 0x97, 0xD9, 0x1D, 0xA7, 0x77,
+    0x74, 0x9A, 0xEA, 0x96, 0xAF, 0xEA, 0x4F, 0xA9, 0xAE, 0xA2, 0x9E, 0x4E, 0x91, 0xE5, 0x9E, 0x1E,
+    0x6E, 0x1D, 0xA6, 0xE0, 0x9D, 0xA6, 0xE1, 0xE6, 0xE1, 0xF9, 0x29, 0xF1, 0xFF, 0xFC, 0x19, 0xFF,
+    0xE9, 0x2A, 0xFF, 0xCA, 0x49, 0xAF, 0xCA, 0x97, 0x77, 0x77, 0x77, 0x74, 0xE7, 0x3E, 0x73, 0xE7,
+    0x29, 0xAA, 0xA5, 0x39, 0xC9, 0x59, 0xE4, 0x9F, 0xC9, 0x19, 0xD9, 0x09, 0xD9, 0x77, 0x6A, 0xE9,
+    0x29, 0xFD, 0xA1, 0xDA, 0x19, 0xD9, 0x9D, 0x3D, 0xA9, 0xD3, 0xE0, 0xE9, 0x9A, 0xDA, 0x0F, 0xF9,
+    0x09, 0xFD, 0xA3, 0xAE, 0x97, 0x77, 0x72, 0xAD, 0x6E, 0x6E, 0x95, 0xAA, 0xA9, 0x20, 0x79, 0x75,
+    0xAC, 0x75, 0xD7, 0x4A, 0xCA, 0x77, 0x39, 0x76, 0xD4, 0x9A, 0xEA, 0x91, 0xD3, 0xAF, 0xEA, 0xAC,
+    0xA2, 0xFA, 0x9A, 0xFC, 0x29, 0xE4, 0xE9, 0x2E, 0x59, 0xE2, 0xE6, 0xE2, 0xDA, 0x6E, 0x19, 0xDA,
+    0x6E, 0x2E, 0x6E, 0x2F, 0x92, 0x9F, 0x2F, 0xFF, 0xC2, 0x9F, 0xFE, 0x93, 0xAF, 0xFC, 0xA5, 0x9A,
+    0xFC, 0xA9, 0x77, 0x30, 0x49, 0x97, 0x09, 0xCA, 0x70, 0xD9, 0x79, 0xD7, 0x77, 0x2D, 0x3A, 0xDA,
+    0x90, 0xD1, 0x9F, 0xDA, 0xD1, 0xDA, 0x19, 0xE1, 0x9D, 0x3D, 0xA1, 0x9D, 0x3E, 0x2E, 0x99, 0xAD,
+    0xA2, 0xFF, 0x92, 0x9F, 0xDA, 0x5A, 0xE9, 0x30, 0x39, 0xD9, 0x74, 0x9D, 0xA7, 0x49, 0xE7, 0x77,
+    0x72, 0x99, 0x75, 0xD4, 0x9A, 0xEA, 0x91, 0xD3, 0xAF, 0xEA, 0xAC, 0xA2, 0xFA, 0x9A, 0xFC, 0x29,
+    0xE4, 0xE9, 0x2E, 0x59, 0xE2, 0xE6, 0xE2, 0xDA, 0x6E, 0x19, 0xDA, 0x6E, 0x2E, 0x6E, 0x2F, 0x92,
+    0x9F, 0x2F, 0xFF, 0xC2, 0x9F, 0xFE, 0x93, 0xAF, 0xFC, 0xA5, 0x9A, 0xFC, 0xA9, 0x77, 0x30, 0x1A,
+    0xCA, 0x71, 0xE7, 0x1A, 0xD9, 0x77, 0x77, 0x4D, 0x3A, 0xDA, 0x90, 0xD1, 0x9F, 0xDA, 0xD1, 0xDA,
+    0x19, 0xE1, 0x9D, 0x3D, 0xA1, 0x9D, 0x3E, 0x2E, 0x99, 0xAD, 0xA2, 0xFF, 0x92, 0x9F, 0xDA, 0x5A,
+    0xE9, 0x30, 0x6D, 0x76, 0xA9, 0x74, 0x9C, 0x75, 0x97, 0x74, 0x97, 0x6D, 0x49, 0xAE, 0xA9, 0x1D,
+    0x3A, 0xFE, 0xAA, 0xCA, 0x2F, 0xA9, 0xAF, 0xC2, 0x9E, 0x4E, 0x92, 0xE5, 0x9E, 0x2E, 0x6E, 0x2D,
+    0xA6, 0xE1, 0x9D, 0xA6, 0xE2, 0xE6, 0xE2, 0xF9, 0x29, 0xF2, 0xFF, 0xFC, 0x29, 0xFF, 0xE9, 0x3A,
+    0xFF, 0xCA, 0x59, 0xAF, 0xCA, 0x97, 0x73, 0x3A, 0xC9, 0x71, 0x9C, 0x71, 0xC9, 0x71, 0x97, 0x77,
+    0x2D, 0x3A, 0xDA, 0x90, 0xD1, 0x9F, 0xDA, 0xD1, 0xDA, 0x19, 0xE1, 0x9D, 0x3D, 0xA1, 0x9D, 0x3E,
+    0x2E, 0x99, 0xAD, 0xA2, 0xFF, 0x92, 0x9F, 0xDA, 0x5A, 0xE9, 0x30, 0x4A, 0xCA, 0x0C, 0xA7, 0x1E,
+    0x9C, 0xA7, 0x1C, 0x9A, 0xD9, 0x71, 0xA9, 0x0A, 0xA7, 0x72, 0x97, 0x6D, 0x49, 0xAE, 0xA9, 0x1D,
+    0x3A, 0xFE, 0xAA, 0xCA, 0x2F, 0xA9, 0xAF, 0xC2, 0x9E, 0x4E, 0x92, 0xE5, 0x9E, 0x2E, 0x6E, 0x2D,
+    0xA6, 0xE1, 0x9D, 0xA6, 0xE2, 0xE6, 0xE2, 0xF9, 0x29, 0xF2, 0xFF, 0xFC, 0x29, 0xFF, 0xE9, 0x3A,
+    0xFF, 0xCA, 0x59, 0xAF, 0xCA, 0x97, 0x73, 0x29, 0x90, 0x9A, 0x5A, 0xDA, 0x9C, 0x5D, 0x9E, 0x59,
+    0xA0, 0x9A, 0x97, 0x77, 0x09, 0x72, 0xD3, 0xAD, 0xA9, 0x0D, 0x19, 0xFD, 0xAD, 0x1D, 0xA1, 0x9E,
+    0x19, 0xD3, 0xDA, 0x19, 0xD3, 0xE2, 0xE9, 0x9A, 0xDA, 0x2F, 0xF9, 0x29, 0xFD, 0xA5, 0xAE, 0x93,
+    0x74, 0x97, 0x6D, 0x49, 0xAE, 0xA9, 0x1D, 0x3A, 0xFE, 0xAA, 0xCA, 0x2F, 0xA9, 0xAF, 0xC2, 0x9E,
+    0x4E, 0x92, 0xE5, 0x9E, 0x2E, 0x6E, 0x2D, 0xA6, 0xE1, 0x9D, 0xA6, 0xE2, 0xE6, 0xE2, 0xF9, 0x29,
+    0xF2, 0xFF, 0xFC, 0x29, 0xFF, 0xE9, 0x3A, 0xFF, 0xCA, 0x59, 0xAF, 0xCA, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x1E, 0x74, 0xE7, 0x4E, 0x73, 0x9A, 0xAA, 0x60, 0x77, 0x4D, 0x3A, 0xDA, 0x90, 0xD1, 0x9F,
+    0xDA, 0xD1, 0xDA, 0x19, 0xE1, 0x9D, 0x3D, 0xA1, 0x9D, 0x3E, 0x2E, 0x99, 0xAD, 0xA2, 0xFF, 0x92,
+    0x9F, 0xDA, 0x5A, 0xE9, 0x77, 0x77, 0x73, 0xDA, 0x70, 0xE7, 0x9E, 0x79, 0xAA, 0xA4, 0x9E, 0x93,
+    0xEA, 0x9E, 0x93, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E,
+    0x1E, 0x4E, 0x1E, 0x4E, 0x1E, 0x92, 0x9E, 0x1F, 0xFE, 0x1A, 0xFF, 0xCA, 0x19, 0xFF, 0xC9, 0x29,
+    0xFE, 0x97, 0x77, 0x77, 0x77, 0x2E, 0x71, 0xE7, 0x1E, 0x71, 0xAA, 0xA4, 0x9C, 0xA3, 0xD9, 0x9D,
+    0x3D, 0x99, 0xD3, 0xD9, 0x0D, 0x3D, 0xA0, 0xD2, 0x9D, 0xA0, 0xD9, 0x1A, 0xDA, 0x0F, 0xFA, 0x0A,
+    0xFE, 0xA1, 0xAE, 0xAD, 0xA7, 0x77, 0x77, 0x3D, 0x95, 0x9D, 0xA5, 0xAD, 0xA5, 0x9A, 0xAA, 0x20,
+    0x5C, 0xA7, 0x3A, 0x97, 0x1A, 0xC7, 0x29, 0x77, 0x77, 0x74, 0x9E, 0x93, 0xEA, 0x9E, 0x93, 0xE9,
+    0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x90, 0xE4, 0xE9, 0x0E, 0x4E, 0x1E, 0x4E, 0x1E, 0x4E,
+    0x1E, 0x92, 0x9E, 0x1F, 0xFE, 0x1A, 0xFF, 0xCA, 0x19, 0xFF, 0xC9, 0x29, 0xFE, 0x97, 0x60, 0x3A,
+    0xC9, 0x79, 0xC7, 0xC9, 0x79, 0x77, 0x79, 0xCA, 0x3D, 0x99, 0xD3, 0xD9, 0x9D, 0x3D, 0x90, 0xD3,
+    0xDA, 0x0D, 0x29, 0xDA, 0x0D, 0x91, 0xAD, 0xA0, 0xFF, 0xA0, 0xAF, 0xEA, 0x1A, 0xEA, 0xDA, 0x69,
+    0x74, 0xD7, 0x39, 0xD7, 0x3D, 0x97, 0x72, 0xAA, 0x74, 0xD7, 0x4D, 0x09, 0xE9, 0x3F, 0x90, 0x9E,
+    0x93, 0xEA, 0x2E, 0x4E, 0x92, 0xE4, 0xE9, 0x2E, 0x4E, 0x92, 0xE4, 0xE9, 0x2E, 0x4E, 0x3E, 0x4E,
+    0x3E, 0x4E, 0x3E, 0x92, 0x9E, 0x3F, 0xFE, 0x3A, 0xFF, 0xCA, 0x39, 0xFF, 0xC9, 0x49, 0xFE, 0x97,
+    0x72, 0x49, 0x97, 0x09, 0xCA, 0x70, 0xAC, 0x97, 0x0D, 0x29, 0x97, 0x1A, 0xC9, 0x70, 0xAC, 0x99,
+    0xCA, 0x3F, 0x09, 0xD3, 0xE1, 0x9D, 0x3D, 0x92, 0xD3, 0xDA, 0x2D, 0x29, 0xDA, 0x2D, 0x91, 0xAD,
+    0xA2, 0xFF, 0xA2, 0xAF, 0xEA, 0x3A, 0xEA, 0xDA, 0x10, 0x29, 0xD9, 0x73, 0x9D, 0xA7, 0x39, 0xE7,
+    0x77, 0x70, 0xD7, 0x4D, 0x74, 0xD0, 0x9E, 0x93, 0xF9, 0x09, 0xE9, 0x3E, 0xA2, 0xE4, 0xE9, 0x2E,
+    0x4E, 0x92, 0xE4, 0xE9, 0x2E, 0x4E, 0x92, 0xE4, 0xE3, 0xE4, 0xE3, 0xE4, 0xE3, 0xE9, 0x29, 0xE3,
+    0xFF, 0xE3, 0xAF, 0xFC, 0xA3, 0x9F, 0xFC, 0x94, 0x9F, 0xE9, 0x77, 0x20, 0x1A, 0xCA, 0x71, 0xE7,
+    0x1A, 0xD9, 0x74, 0xAA, 0x71, 0x9C, 0x97, 0x0A, 0xC9, 0x9C, 0xA3, 0xF0, 0x9D, 0x3E, 0x19, 0xD3,
+    0xD9, 0x2D, 0x3D, 0xA2, 0xD2, 0x9D, 0xA2, 0xD9, 0x1A, 0xDA, 0x2F, 0xFA, 0x2A, 0xFE, 0xA3, 0xAE,
+    0xAD, 0xA1, 0x5C, 0xA7, 0x5A, 0x97, 0x3A, 0xC7, 0x49, 0x77, 0x3C, 0xA7, 0x4D, 0x74, 0xD0, 0x9E,
+    0x93, 0xF9, 0x09, 0xE9, 0x3E, 0xA2, 0xE4, 0xE9, 0x2E, 0x4E, 0x92, 0xE4, 0xE9, 0x2E, 0x4E, 0x92,
+    0xE4, 0xE3, 0xE4, 0xE3, 0xE4, 0xE3, 0xE9, 0x29, 0xE3, 0xFF, 0xE3, 0xAF, 0xFC, 0xA3, 0x9F, 0xFC,
+    0x94, 0x9F, 0xE9, 0x77, 0x20, 0x3A, 0xC9, 0x71, 0x9C, 0x71, 0xC9, 0x71, 0x92, 0x99, 0x71, 0x9C,
+    0x97, 0x0A, 0xC9, 0x9C, 0xA3, 0xF0, 0x9D, 0x3E, 0x19, 0xD3, 0xD9, 0x2D, 0x3D, 0xA2, 0xD2, 0x9D,
+    0xA2, 0xD9, 0x1A, 0xDA, 0x2F, 0xFA, 0x2A, 0xFE, 0xA3, 0xAE, 0xAD, 0xA1, 0x3A, 0xCA, 0x0C, 0x97,
+    0x0E, 0x9C, 0xA7, 0x9C, 0x9E, 0x97, 0x0A, 0x90, 0xAA, 0x77, 0x1A, 0xA7, 0x4D, 0x74, 0xD0, 0x9E,
+    0x93, 0xF9, 0x09, 0xE9, 0x3E, 0xA2, 0xE4, 0xE9, 0x2E, 0x4E, 0x92, 0xE4, 0xE9, 0x2E, 0x4E, 0x92,
+    0xE4, 0xE3, 0xE4, 0xE3, 0xE4, 0xE3, 0xE9, 0x29, 0xE3, 0xFF, 0xE3, 0xAF, 0xFC, 0xA3, 0x9F, 0xFC,
+    0x94, 0x9F, 0xE9, 0x77, 0x20, 0x2D, 0x99, 0xC5, 0xAF, 0xC5, 0xD0, 0xAC, 0xA7, 0x49, 0x97, 0x1A,
+    0xC9, 0x70, 0xAC, 0x99, 0xCA, 0x3F, 0x09, 0xD3, 0xE1, 0x9D, 0x3D, 0x92, 0xD3, 0xDA, 0x2D, 0x29,
+    0xDA, 0x2D, 0x91, 0xAD, 0xA2, 0xFF, 0xA2, 0xAF, 0xEA, 0x3A, 0xEA, 0xDA, 0x10, 0x73, 0xCA, 0x74,
+    0xD7, 0x4D, 0x09, 0xE9, 0x3F, 0x90, 0x9E, 0x93, 0xEA, 0x2E, 0x4E, 0x92, 0xE4, 0xE9, 0x2E, 0x4E,
+    0x92, 0xE4, 0xE9, 0x2E, 0x4E, 0x3E, 0x4E, 0x3E, 0x4E, 0x3E, 0x92, 0x9E, 0x3F, 0xFE, 0x3A, 0xFF,
+    0xCA, 0x39, 0xFF, 0xC9, 0x49, 0xFE, 0x97, 0x77, 0x77, 0x77, 0x74, 0xE7, 0x3E, 0x73, 0xE7, 0x3A,
+    0xAA, 0x60, 0x70, 0x99, 0x71, 0x9C, 0x97, 0x0A, 0xC9, 0x9C, 0xA3, 0xF0, 0x9D, 0x3E, 0x19, 0xD3,
+    0xD9, 0x2D, 0x3D, 0xA2, 0xD2, 0x9D, 0xA2, 0xD9, 0x1A, 0xDA, 0x2F, 0xFA, 0x2A, 0xFE, 0xA3, 0xAE,
+    0xAD, 0xA7, 0x77, 0x77, 0x75, 0xD9, 0x79, 0xDA, 0x7A, 0xDA, 0x79, 0xAA, 0xA4, 0x2A, 0xD7, 0x3A,
+    0xD9, 0x72, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x5E, 0x5E, 0x1A, 0xD9, 0x3A, 0xDA, 0x2E, 0x3E, 0x3A,
+    0xDA, 0x1A, 0xDA, 0x4E, 0x1E, 0x5A, 0xDA, 0xAD, 0xA6, 0xFD, 0x7F, 0xCA, 0x79, 0xF7, 0x1E, 0xA7,
+    0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1F, 0x40, 0x19, 0xD9, 0x79, 0xDA, 0x79, 0xE7, 0x77, 0x77,
+    0x7D, 0x93, 0xDA, 0x0A, 0xD3, 0xD9, 0x1D, 0xA1, 0x9D, 0x2A, 0xD9, 0x0D, 0xA3, 0xE0, 0xD9, 0x3A,
+    0xFC, 0x5F, 0xA5, 0xAE, 0x96, 0xE7, 0xE6, 0xAD, 0x93, 0xAF, 0xC4, 0xAF, 0x94, 0xAD, 0xA5, 0x0E,
+    0x5E, 0x1A, 0xD9, 0x3A, 0xDA, 0x2E, 0x3E, 0x3A, 0xDA, 0x1A, 0xDA, 0x4E, 0x1E, 0x5A, 0xDA, 0xAD,
+    0xA6, 0xFD, 0x7F, 0xCA, 0x79, 0xF7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1F, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x9D, 0x97, 0x19, 0xD9, 0x71, 0xAD, 0xA7, 0x1A, 0xAA, 0x94, 0x0D, 0x93,
+    0xDA, 0x2A, 0xD3, 0xD9, 0x3D, 0xA1, 0x9D, 0x4A, 0xD9, 0x0D, 0xA5, 0xE0, 0xD9, 0x5A, 0xFC, 0x7F,
+    0xA7, 0xAE, 0x97, 0x0E, 0x71, 0xE7, 0x0A, 0xD9, 0x5A, 0xFC, 0x6A, 0xF9, 0x1D, 0xA1, 0xAD, 0xA3,
+    0xE7, 0x09, 0xE7, 0x09, 0xAA, 0xA0, 0x77, 0x3D, 0x97, 0x3A, 0xA7, 0x2A, 0xC7, 0x77, 0x77, 0x77,
+    0x77, 0x4E, 0x5E, 0x1A, 0xD9, 0x3A, 0xDA, 0x2E, 0x3E, 0x3A, 0xDA, 0x1A, 0xDA, 0x4E, 0x1E, 0x5A,
+    0xDA, 0xAD, 0xA6, 0xFD, 0x7F, 0xCA, 0x79, 0xF7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7,
+    0x1F, 0x40, 0x77, 0xAC, 0x97, 0x09, 0xC7, 0x9C, 0x77, 0x77, 0x77, 0x73, 0xD9, 0x3D, 0xA0, 0xAD,
+    0x3D, 0x91, 0xDA, 0x19, 0xD2, 0xAD, 0x90, 0xDA, 0x3E, 0x0D, 0x93, 0xAF, 0xC5, 0xFA, 0x5A, 0xE9,
+    0x6E, 0x7E, 0x6A, 0xD9, 0x3A, 0xFC, 0x4A, 0xF9, 0x4A, 0xDA, 0x50, 0x4A, 0x90, 0xA9, 0x7E, 0x9A,
+    0xC7, 0xCA, 0xEA, 0x7C, 0x90, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x3E, 0x5E, 0x1A, 0xD9, 0x3A, 0xDA,
+    0x2E, 0x3E, 0x3A, 0xDA, 0x1A, 0xDA, 0x4E, 0x1E, 0x5A, 0xDA, 0xAD, 0xA6, 0xFD, 0x7F, 0xCA, 0x79,
+    0xF7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1F, 0x40, 0x29, 0xD0, 0xAC, 0x4F, 0xD4,
+    0xCA, 0x0A, 0xC9, 0x77, 0x77, 0x77, 0x71, 0xD9, 0x3D, 0xA0, 0xAD, 0x3D, 0x91, 0xDA, 0x19, 0xD2,
+    0xAD, 0x90, 0xDA, 0x3E, 0x0D, 0x93, 0xAF, 0xC5, 0xFA, 0x5A, 0xE9, 0x6E, 0x7E, 0x6A, 0xD9, 0x3A,
+    0xFC, 0x4A, 0xF9, 0x4A, 0xDA, 0x50, 0xAF, 0xFA, 0xFF, 0xAF, 0xFA, 0xFF, 0xAF, 0xFF, 0xAF, 0xFF,
+    0x75, 0xFF, 0xE9, 0x0F, 0xFE, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x77, 0x2F, 0xFF, 0xFC,
+    0x0F, 0xFF, 0xFC, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x2F, 0xFF, 0xFC,
+    0x0F, 0xFF, 0xFC, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x7A, 0xCA, 0x1A, 0xC9,
+    0xAC, 0x91, 0xD9, 0xAC, 0x91, 0xD9, 0xAC, 0x91, 0xD0, 0xAC, 0x91, 0xD0, 0xAC, 0x91, 0xD0, 0xAC,
+    0x91, 0xD0, 0xD9, 0x1D, 0x0D, 0x91, 0xD0, 0xD2, 0xD0, 0xD2, 0xD0, 0xD2, 0xD0, 0xD2, 0xD0, 0xD2,
+    0xD0, 0xD2, 0xD0, 0x0F, 0xFF, 0xC9, 0x0F, 0xFF, 0xC9, 0x77, 0x76, 0xFF, 0xFC, 0x90, 0xFF, 0xFC,
+    0x90, 0xAA, 0xAA, 0x1A, 0xE1, 0x9E, 0x2E, 0x91, 0xEA, 0x1A, 0xE0, 0x0A, 0xAA, 0xA1, 0xF1, 0xEA,
+    0x1E, 0x90, 0x9E, 0x1E, 0xA1, 0x0A, 0xAA, 0xA1, 0xF1, 0xEA, 0x1E, 0x90, 0x9E, 0x1E, 0xA1, 0xAA,
+    0xAA, 0x1A, 0xE1, 0x9E, 0x2E, 0x91, 0xEA, 0x1A, 0xE0, 0xAA, 0xAA, 0x09, 0xAA, 0xA9, 0x0A, 0xE1,
+    0xEA, 0x09, 0xE1, 0xE9, 0x1E, 0x90, 0xAD, 0xA1, 0xEA, 0x09, 0xE1, 0xAE, 0x1E, 0x90, 0x0A, 0xAA,
+    0xA0, 0x9A, 0xAA, 0x90, 0xF0, 0x9E, 0x90, 0xEA, 0x09, 0xE1, 0xE9, 0x0A, 0xDA, 0x09, 0xE1, 0xE9,
+    0x0E, 0xA0, 0x9E, 0x10, 0x0A, 0xAA, 0xA1, 0xF1, 0xEA, 0x1E, 0x90, 0x9E, 0x1E, 0xA1, 0xAA, 0xAA,
+    0x09, 0xAA, 0xA9, 0x0A, 0xE1, 0xEA, 0x09, 0xE1, 0xE9, 0x1E, 0x90, 0xAD, 0xA1, 0xEA, 0x09, 0xE1,
+    0xAE, 0x1E, 0x90, 0x39, 0x70, 0xD7, 0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x69, 0xD4, 0xFF, 0x0A, 0xFF,
+    0x09, 0x90, 0xAD, 0x99, 0x93, 0x9D, 0x69, 0xD6, 0x9D, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A,
+    0xD6, 0xAC, 0xA6, 0xAC, 0xA7, 0xCA, 0x79, 0xA7, 0x09, 0x75, 0x3A, 0x97, 0xD7, 0xD7, 0xD6, 0x9D,
+    0x69, 0xD6, 0xAD, 0x99, 0x90, 0x9F, 0xF0, 0xAF, 0xF9, 0x29, 0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x4F,
+    0xEA, 0x0A, 0xFF, 0x3A, 0xD9, 0x5A, 0xD6, 0xAD, 0x6A, 0xD7, 0xCA, 0x79, 0xA7, 0x0A, 0x75, 0x2F,
+    0xFC, 0x4F, 0xFC, 0x4F, 0xFC, 0x39, 0xFF, 0xC9, 0x2A, 0xFF, 0xC9, 0x2F, 0xFD, 0xA2, 0xFF, 0xDA,
+    0x2F, 0xFE, 0x19, 0xFF, 0xE1, 0xAF, 0xFE, 0x1A, 0xFF, 0xE9, 0x0F, 0xFF, 0x90, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x90, 0x6C, 0xA2, 0x9E, 0xA0, 0x9F, 0x99, 0xE9, 0x1C, 0x97, 0x00, 0x0A, 0xA0,
+    0x9D, 0x9A, 0xDA, 0xAE, 0x0A, 0xA0, 0x9D, 0x9A, 0xDA, 0xAE, 0x0A, 0xA9, 0x2A, 0xA9, 0x19, 0xAA,
+    0x1D, 0xA1, 0x9D, 0xA1, 0xE0, 0x9E, 0x1A, 0xDA, 0x1E, 0x0A, 0xE1, 0xAE, 0x1E, 0x90, 0x9C, 0xA9,
+    0xCA, 0x19, 0x94, 0xAC, 0x29, 0xA9, 0x92, 0x9C, 0xA2, 0xAA, 0xAA, 0x2D, 0x3A, 0xA9, 0xA1, 0xAC,
+    0xA3, 0x9C, 0xAA, 0x09, 0xD5, 0xD1, 0xD9, 0x70, 0x9D, 0x71, 0xD9, 0x70, 0xAD, 0x70, 0x9D, 0x71,
+    0xDA, 0x0A, 0xA0, 0xAA, 0x29, 0xD0, 0x9C, 0xA0, 0xCA, 0x91, 0xDA, 0x09, 0x9C, 0x0A, 0xA9, 0x0A,
+    0xD2, 0xCA, 0x0A, 0xC1, 0xAA, 0x97, 0x00, 0x1A, 0xAA, 0xA2, 0xF2, 0xEA, 0x2E, 0x29, 0xE2, 0xEA,
+    0x10, 0x1A, 0xAA, 0xA0, 0x9A, 0xAA, 0x91, 0xF0, 0x9E, 0x91, 0xEA, 0x09, 0xE2, 0xE1, 0xAD, 0xA1,
+    0x9E, 0x1E, 0x91, 0xEA, 0x09, 0xE1, 0x76, 0xD1, 0xAC, 0x90, 0x9C, 0x90, 0xAD, 0x1D, 0x90, 0xDA,
+    0x0D, 0x90, 0xAC, 0xA0, 0xAD, 0x09, 0xC9, 0x1C, 0xA1, 0xD7, 0x60, 0x5D, 0x2D, 0x91, 0x9D, 0x2A,
+    0xC5, 0x79, 0xCA, 0x0D, 0x19, 0xD0, 0xDA, 0x1A, 0xCA, 0x0D, 0x2D, 0x09, 0xC9, 0x70, 0x74, 0x9C,
+    0xA0, 0x9C, 0xA1, 0xD1, 0x9D, 0x09, 0xD9, 0x0D, 0xA1, 0xAC, 0xA0, 0xAD, 0x1D, 0x2D, 0x1A, 0xC1,
+    0x9C, 0x97, 0x40, 0x3A, 0xC9, 0x59, 0xE9, 0x3A, 0xDA, 0xD9, 0x1A, 0xAA, 0x90, 0xAA, 0xA9, 0x70,
+    0xA2, 0xD1, 0xDA, 0x9D, 0x90, 0xE1, 0x9D, 0xA1, 0x9D, 0xA1, 0x9C, 0xA2, 0x99, 0x6A, 0x4C, 0xA3,
+    0xAD, 0x3A, 0xD9, 0x2E, 0x1E, 0x90, 0xAD, 0x91, 0xAC, 0x92, 0x99, 0x20, 0x7A, 0xA9, 0x76, 0xDA,
+    0x75, 0x9E, 0x79, 0xE9, 0x0A, 0xE1, 0xE9, 0x2A, 0xE5, 0xEA, 0x4F, 0x3F, 0x6E, 0xA1, 0xAE, 0x79,
+    0xEA, 0xAE, 0x94, 0xDA, 0x0A, 0xFD, 0xA0, 0x9D, 0x99, 0xDA, 0x1F, 0xD1, 0xAD, 0x99, 0xE1, 0xAF,
+    0x91, 0xAD, 0xA9, 0xAA, 0xA0, 0x9F, 0xD1, 0xAA, 0xA9, 0x39, 0xFF, 0x79, 0xFA, 0xFC, 0x6F, 0xC1,
+    0xFC, 0x4F, 0xC2, 0x9F, 0xC2, 0xFC, 0x49, 0xFC, 0x77, 0x71, 0xDA, 0x75, 0x9D, 0xA7, 0x59, 0xE7,
+    0x59, 0xAA, 0xA7, 0x7A, 0x93, 0xD3, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x19, 0xD2, 0x9D,
+    0x29, 0xD2, 0x9D, 0x4C, 0x77, 0x72, 0xE9, 0x1E, 0xA1, 0xEA, 0x09, 0xF0, 0x9A, 0xAA, 0xA0, 0x77,
+    0xA7, 0x1C, 0x97, 0x0D, 0x79, 0xD5, 0x9F, 0xC9, 0x2A, 0xFE, 0x91, 0xAC, 0x9A, 0xFC, 0x4A, 0xD9,
+    0xD9, 0x3A, 0xD0, 0xD9, 0x3A, 0xD0, 0xD9, 0x3E, 0x9D, 0x4F, 0xD4, 0xFC, 0x5F, 0x6E, 0x96, 0xE9,
+    0x6D, 0xA7, 0x97, 0x77, 0x7E, 0x69, 0xE6, 0x9E, 0x6A, 0xE9, 0x5F, 0x95, 0xFA, 0x20, 0xAF, 0xFA,
+    0xFF, 0x71, 0xD9, 0x1D, 0x1F, 0xE2, 0xAE, 0xA7, 0x20, 0x49, 0x71, 0x90, 0xC9, 0x99, 0x6F, 0xC9,
+    0x7E, 0x97, 0xAF, 0xA6, 0xA9, 0xCA, 0xA9, 0x6C, 0x0A, 0xA0, 0xCA, 0x09, 0x1C, 0xAC, 0xAF, 0xD9,
+    0x1A, 0xE9, 0x0E, 0xA2, 0xAF, 0xFC, 0xA1, 0xC9, 0xC9, 0xA9, 0x9A, 0xA5, 0xA7, 0x00, 0x7A, 0xC9,
+    0x7D, 0x7D, 0x96, 0x9D, 0x7D, 0x7A, 0xCA, 0x69, 0xD7, 0xDA, 0x6A, 0xD7, 0xD9, 0x6A, 0xD6, 0x9D,
+    0x96, 0xDA, 0x6A, 0xD7, 0x72, 0x77, 0x7A, 0xDA, 0x94, 0xAE, 0xA3, 0xAF, 0xDA, 0x19, 0xFE, 0x2D,
+    0xA9, 0x09, 0xDA, 0x0E, 0x90, 0x9E, 0x19, 0x93, 0xAD, 0x1A, 0x39, 0xD7, 0x9D, 0x7D, 0x96, 0x9D,
+    0x7D, 0x96, 0x9D, 0x7D, 0x96, 0xDA, 0x6E, 0x49, 0xAE, 0x5A, 0xE9, 0x4F, 0x94, 0xAE, 0x95, 0xE6,
+    0xE9, 0x6E, 0x6E, 0x96, 0xE6, 0xE6, 0x9A, 0x97, 0xA9, 0x77, 0x77, 0x77, 0x2A, 0xA7, 0xAA, 0x96,
+    0x9D, 0x96, 0xDA, 0x6A, 0xDA, 0x59, 0xE6, 0xEA, 0x59, 0xE3, 0x77, 0x4A, 0xE9, 0x6A, 0x29, 0xFE,
+    0x5C, 0xA1, 0xE9, 0x09, 0xDA, 0x4D, 0x19, 0x93, 0x9D, 0x39, 0xD7, 0x0D, 0x92, 0x9D, 0x70, 0xD9,
+    0x2A, 0xD7, 0x9D, 0x3A, 0xD7, 0xE3, 0xAD, 0x5A, 0xE9, 0x3E, 0x4F, 0x94, 0xE4, 0xE9, 0x5E, 0x4E,
+    0x7A, 0xA4, 0xE7, 0x6A, 0x77, 0x77, 0x77, 0x4A, 0xA9, 0x6E, 0x4D, 0xA5, 0x9E, 0x39, 0xE5, 0xAE,
+    0x92, 0xAE, 0x5F, 0x97, 0x4A, 0xAA, 0xA9, 0x77, 0x99, 0x19, 0xEA, 0x49, 0xCA, 0xFE, 0x92, 0xAF,
+    0x90, 0x9E, 0x2A, 0xCA, 0xA4, 0xD9, 0x1A, 0xCA, 0x5D, 0xA1, 0xDA, 0x5D, 0xA1, 0xDA, 0x5D, 0x91,
+    0xDA, 0x4A, 0xD2, 0xD9, 0x29, 0xEA, 0x2D, 0x91, 0xAE, 0xA3, 0xD9, 0x1A, 0xDA, 0x5C, 0x91, 0xAD,
+    0x97, 0x1E, 0x97, 0x1A, 0x97, 0x77, 0x71, 0xAD, 0xA1, 0xAA, 0xA4, 0xAE, 0x1E, 0x4F, 0x1E, 0x4F,
+    0x09, 0xE4, 0xAA, 0xAA, 0x70, 0x77, 0x5A, 0xC7, 0x19, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x70, 0x9D,
+    0x71, 0xAC, 0xA3, 0xAD, 0x2D, 0x93, 0xAD, 0x91, 0xD4, 0xE9, 0x0A, 0xD4, 0xAA, 0xA9, 0x0D, 0xA7,
+    0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0xA1, 0x9D, 0x4D,
+    0x91, 0xAD, 0x92, 0xAD, 0x2E, 0x92, 0xE2, 0xAA, 0xA9, 0x2D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71,
+    0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x71, 0xCA, 0x72, 0x97, 0x20, 0x1A, 0xA1, 0xC0, 0xAA, 0x0C, 0xA9,
+    0xC9, 0xCA, 0xAC, 0x9C, 0x0A, 0xC0, 0xEA, 0x09, 0xAA, 0x00, 0x29, 0x39, 0xC9, 0x2D, 0x91, 0xC9,
+    0xCA, 0x09, 0xF3, 0xCA, 0x00, 0x6E, 0xA1, 0xC4, 0xE9, 0x3A, 0xC1, 0xA0, 0xAC, 0x1E, 0xA1, 0x9A,
+    0x91, 0x1E, 0x1C, 0x93, 0xE9, 0x09, 0xC9, 0x9C, 0x1C, 0x90, 0xC1, 0xAD, 0xA6, 0x59, 0xF3, 0x9C,
+    0x3A, 0xC3, 0xD3, 0xCA, 0x29, 0xC9, 0x29, 0x91, 0x1A, 0xA9, 0x1C, 0x99, 0xC1, 0xC9, 0x9C, 0x19,
+    0xDA, 0x1C, 0x99, 0xC1, 0xF6, 0x09, 0xD9, 0x1C, 0x09, 0xC0, 0x9A, 0x1C, 0x1C, 0x99, 0xC9, 0x09,
+    0xE1, 0x99, 0x9C, 0x1E, 0x96, 0x72, 0xDA, 0xEA, 0x2F, 0xF1, 0xE9, 0x09, 0xD9, 0x0D, 0x92, 0xD9,
+    0x0D, 0x92, 0xDA, 0x0D, 0x92, 0xDA, 0x9D, 0xA2, 0xE9, 0xDA, 0x2E, 0x9E, 0x2E, 0x1A, 0xA2, 0xC9,
+    0x9C, 0x1C, 0xA9, 0xC0, 0x9C, 0xAA, 0xC1, 0xC9, 0x9C, 0x1F, 0x19, 0xD1, 0x1A, 0x2D, 0x92, 0xC9,
+    0x2C, 0x92, 0xC9, 0x19, 0xCA, 0x99, 0xF0, 0x0A, 0xD9, 0x1A, 0x9A, 0xC4, 0xC3, 0xD2, 0xD9, 0x1E,
+    0x91, 0xF9, 0x0A, 0xD9, 0x4C, 0x39, 0xC2, 0xDA, 0x39, 0xC1, 0xF1, 0xAA, 0xA9, 0x00, 0x29, 0x93,
+    0xCA, 0x2C, 0xAA, 0x1A, 0x9A, 0xA0, 0x9F, 0x92, 0xD3, 0xD0, 0x5E, 0xA0, 0xC3, 0xC3, 0xE9, 0x2A,
+    0xC0, 0xEA, 0x09, 0xA9, 0x00, 0x1A, 0xD1, 0xC9, 0x3E, 0x90, 0x9C, 0xA9, 0xC1, 0xC1, 0xC9, 0x0C,
+    0xA9, 0xC1, 0x9D, 0xA0, 0x59, 0xF3, 0x9C, 0x3A, 0xC3, 0xD3, 0xCA, 0x29, 0xC9, 0x29, 0xA1, 0x1A,
+    0xC9, 0x1C, 0x90, 0xC1, 0xCA, 0x9C, 0x19, 0xDA, 0x1C, 0x90, 0xC9, 0x0C, 0xAA, 0xC9, 0x0A, 0xDA,
+    0x00, 0x09, 0xD9, 0x1C, 0x09, 0xC0, 0x9A, 0x1C, 0x1C, 0x99, 0xC9, 0x09, 0xE9, 0x09, 0x99, 0xC1,
+    0xE9, 0x60, 0x3D, 0x3A, 0xD2, 0x9D, 0x3D, 0xA2, 0x9D, 0x3E, 0x3D, 0x92, 0x9D, 0x3A, 0xD3, 0xAD,
+    0x3D, 0xA3, 0xDA, 0x3E, 0x3E, 0x3A, 0xD3, 0x9D, 0x93, 0xDA, 0x3E, 0x3A, 0xDA, 0x3E, 0x3A, 0xDA,
+    0x3E, 0x39, 0xAA, 0x90, 0x0D, 0x94, 0xAD, 0x5D, 0xA4, 0x9D, 0x5D, 0xA4, 0xAD, 0x5D, 0x94, 0xDA,
+    0x4A, 0xD4, 0xAD, 0x49, 0xD4, 0x9D, 0x4A, 0xD4, 0xAD, 0x4E, 0x4D, 0xA3, 0x9D, 0x93, 0xE4, 0xE3,
+    0xAD, 0x92, 0x9E, 0x3E, 0x92, 0x9A, 0xAA, 0x30, 0x6C, 0xA0, 0xCA, 0x6C, 0xA0, 0xCA, 0x59, 0xC9,
+    0x9C, 0x95, 0xAC, 0x0A, 0xC5, 0x9F, 0xCA, 0x29, 0xFE, 0xA1, 0x9F, 0xF9, 0x1F, 0xCA, 0x9C, 0xA1,
+    0xAE, 0xAC, 0x0A, 0xC2, 0xEA, 0xD0, 0xD2, 0xE9, 0xD0, 0xD2, 0xE9, 0xCA, 0x0C, 0xA2, 0xFC, 0x99,
+    0xC9, 0x2F, 0xC9, 0xAC, 0x99, 0x1F, 0xFD, 0x90, 0x9F, 0xFC, 0x91, 0xAF, 0xF9, 0x2A, 0xFE, 0x92,
+    0xAC, 0x0A, 0xC6, 0xD0, 0xD6, 0xD0, 0xD7, 0x70, 0x77, 0x0A, 0xFC, 0xA2, 0x9F, 0xEA, 0x19, 0xFF,
+    0x91, 0xF9, 0x29, 0x19, 0xE7, 0xEA, 0x7E, 0x91, 0xAA, 0xAA, 0x09, 0xE9, 0x1F, 0x99, 0xE9, 0x1D,
+    0x3F, 0x90, 0xD0, 0x91, 0xFF, 0xD9, 0x09, 0xFF, 0xC9, 0x1A, 0xFF, 0x92, 0x9F, 0xE9, 0x76, 0x9A,
+    0xDA, 0x5A, 0xFD, 0x93, 0xD2, 0x9A, 0x91, 0xAF, 0xF2, 0xAF, 0xF4, 0x9C, 0xA6, 0x9F, 0xF2, 0x9F,
+    0xF5, 0xAC, 0xA6, 0x9A, 0xDA, 0x6F, 0xEA, 0x92, 0xFF, 0xC9, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0x90,
+    0x49, 0x99, 0x4D, 0xA6, 0x9E, 0x4D, 0x96, 0x9F, 0x29, 0xD9, 0x69, 0xF9, 0x19, 0xD9, 0x6A, 0xFC,
+    0x19, 0xD9, 0x6A, 0xFC, 0x90, 0xAD, 0x93, 0xAA, 0xAF, 0xEA, 0xEA, 0xAA, 0x1F, 0xFF, 0xFC, 0x93,
+    0xEA, 0x0D, 0xAE, 0x7E, 0xA0, 0xFD, 0x7E, 0xA0, 0x9F, 0xC7, 0xEA, 0x1F, 0xC7, 0xF1, 0xAF, 0x69,
+    0xF2, 0xF3, 0x77, 0x1A, 0xFC, 0xA9, 0x6A, 0xFE, 0x93, 0x99, 0xAD, 0x99, 0x9E, 0x99, 0x09, 0xFF,
+    0xFC, 0xA2, 0xE2, 0x9D, 0x94, 0xFF, 0xC9, 0x4F, 0xFC, 0x5F, 0xEA, 0x6E, 0xAA, 0x97, 0x0E, 0x73,
+    0xE7, 0x3E, 0x97, 0x2E, 0x97, 0x19, 0xE9, 0x70, 0x0F, 0xA7, 0x4F, 0xCA, 0x72, 0x9C, 0xA1, 0xAC,
+    0x72, 0x9C, 0xA1, 0x9C, 0x97, 0x19, 0xCA, 0x19, 0xC9, 0x71, 0x9C, 0xA1, 0xAC, 0x93, 0xAE, 0x1A,
+    0xDA, 0xE3, 0x9C, 0xAA, 0xC1, 0xAF, 0xCA, 0x3A, 0xC4, 0xAF, 0xD4, 0xDA, 0x91, 0xAD, 0x1D, 0x94,
+    0xAD, 0xA0, 0xAD, 0x1E, 0x6D, 0x9E, 0x1E, 0x2A, 0xDA, 0xD9, 0xE1, 0xE9, 0x09, 0xFD, 0x0A, 0xAA,
+    0x1A, 0xAA, 0x91, 0x9E, 0xA7, 0x73, 0x1A, 0x96, 0xA9, 0x2D, 0x59, 0xCA, 0x2D, 0x5A, 0xC9, 0x2D,
+    0x5A, 0xC3, 0xD1, 0x9C, 0x1D, 0x1F, 0xFF, 0xDA, 0xFF, 0xFC, 0x19, 0xCA, 0x9E, 0x9C, 0xA3, 0x9F,
+    0xDA, 0xCA, 0x4F, 0xF9, 0x4F, 0x9E, 0x5E, 0xA0, 0xE5, 0xE9, 0x0E, 0x5A, 0xD1, 0xAC, 0xA2, 0x09,
+    0x99, 0x71, 0x9F, 0xD9, 0x29, 0x90, 0x9F, 0xE9, 0x1D, 0x09, 0xD9, 0x19, 0xD1, 0xD0, 0x9C, 0xA3,
+    0xAC, 0x1D, 0x09, 0xC9, 0x0A, 0xA0, 0xAC, 0x90, 0xD0, 0x9C, 0x99, 0xD0, 0xAC, 0x90, 0xD0, 0x9C,
+    0x90, 0xD0, 0xAC, 0x90, 0xD0, 0x9C, 0x90, 0xD4, 0xD0, 0x9C, 0x90, 0xDA, 0x3D, 0x09, 0xC9, 0x0A,
+    0xEA, 0x9E, 0x09, 0xC9, 0x1A, 0xFE, 0x79, 0xAA, 0xE0, 0x7C, 0xA6, 0x9A, 0xAD, 0xAA, 0x4A, 0xFD,
+    0x7C, 0xA5, 0xAD, 0xAC, 0xA4, 0xFD, 0xA3, 0xAC, 0x90, 0x9D, 0xA3, 0xAC, 0x2D, 0x93, 0xAC, 0x90,
+    0x9D, 0x93, 0x9F, 0xD9, 0x4A, 0xFC, 0xA5, 0x99, 0x90, 0x92, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x1F,
+    0xFC, 0xA1, 0x77, 0x1A, 0xF9, 0x39, 0xFD, 0xA3, 0xFA, 0xAC, 0x93, 0xE5, 0xAF, 0xE3, 0xFF, 0x59,
+    0xD9, 0x79, 0xD6, 0xAF, 0xE3, 0xFF, 0x6E, 0x70, 0xEA, 0x96, 0xAF, 0xDA, 0x4F, 0xDA, 0x5A, 0xF9,
+    0x73, 0x9F, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x4A, 0xD9, 0x99, 0x6A, 0xFA, 0x5A, 0xFC, 0x94, 0xFC,
+    0xA6, 0xFC, 0x90, 0x96, 0xFC, 0xA5, 0x9F, 0xC9, 0x4F, 0xCA, 0x6F, 0xC9, 0x69, 0x0E, 0xA7, 0x0E,
+    0xA3, 0x3A, 0xFC, 0xA7, 0x1A, 0xFE, 0x70, 0xAD, 0x09, 0xEA, 0x39, 0xAA, 0xAE, 0xAA, 0xFC, 0xAA,
+    0x93, 0xE3, 0xDA, 0x39, 0x99, 0xE9, 0x9A, 0xEA, 0x99, 0x4F, 0xFC, 0x96, 0xFF, 0xC7, 0xFE, 0xA7,
+    0x0E, 0xAA, 0x97, 0x2E, 0x75, 0xE7, 0x5E, 0x97, 0x4E, 0x97, 0x39, 0xE9, 0x70, 0x69, 0x97, 0x4D,
+    0x74, 0xD7, 0x4D, 0x71, 0xAF, 0xDA, 0x49, 0xFF, 0xC9, 0x3F, 0xFD, 0xA2, 0xAE, 0x99, 0xD6, 0xEA,
+    0x09, 0xCA, 0x6E, 0x19, 0xCA, 0x6E, 0x19, 0xD5, 0x9E, 0x19, 0xFE, 0x1E, 0x19, 0xFE, 0x90, 0xEA,
+    0x09, 0xCA, 0x09, 0xDA, 0x90, 0xAF, 0xAC, 0xA9, 0xAD, 0x92, 0xFF, 0xE9, 0x29, 0xFF, 0xD9, 0x4A,
+    0xFC, 0xAA, 0x70, 0xAC, 0x97, 0x3A, 0xC9, 0x73, 0x99, 0x60, 0x77, 0x4A, 0xFA, 0x97, 0x1A, 0xFD,
+    0x97, 0x19, 0x19, 0xE7, 0x59, 0xD4, 0xAF, 0xFF, 0xEA, 0xAF, 0xFF, 0xEA, 0x77, 0x0A, 0xFF, 0xFE,
+    0xAA, 0xFF, 0xFE, 0xA1, 0xE4, 0xA9, 0x6F, 0xAA, 0xF9, 0x6F, 0xFD, 0x79, 0xFD, 0xA7, 0x75, 0x3C,
+    0xA6, 0xD4, 0x9F, 0x91, 0x9F, 0xCA, 0x1D, 0xAD, 0x29, 0xD0, 0xD2, 0x9D, 0x0D, 0x29, 0xD9, 0xD3,
+    0xFC, 0xA2, 0xAF, 0xCA, 0x29, 0xFA, 0x4A, 0xC9, 0x72, 0x75, 0xFF, 0xFC, 0x97, 0x77, 0x39, 0xFF,
+    0xF0, 0x9F, 0xFF, 0x19, 0x99, 0x9E, 0xA9, 0x99, 0x95, 0xAD, 0x72, 0xAD, 0x97, 0x1A, 0xD9, 0x71,
+    0xE9, 0x71, 0xE9, 0x71, 0xE9, 0x71, 0xE9, 0x71, 0xEA, 0x71, 0xEA, 0x40, 0x9F, 0xF9, 0xFF, 0x3D,
+    0x29, 0xFF, 0x9F, 0xF9, 0xFC, 0x29, 0xF9, 0x29, 0xFC, 0x59, 0xD9, 0x5E, 0x5E, 0x5E, 0x94, 0xEA,
+    0x00, 0x2D, 0x70, 0xD1, 0x95, 0xFC, 0x93, 0xAF, 0xC3, 0xFC, 0x99, 0x3F, 0xAD, 0x92, 0x9A, 0xFC,
+    0x92, 0xFC, 0xA0, 0xAC, 0xA0, 0xF1, 0x9D, 0x90, 0x90, 0xDA, 0xEA, 0x3F, 0xC9, 0x4D, 0xA9, 0x76,
+    0x39, 0x97, 0x1A, 0xCA, 0x70, 0xAC, 0xA7, 0xFC, 0x94, 0xFE, 0x93, 0xFE, 0xA2, 0x9D, 0xAC, 0xAA,
+    0xD2, 0xAD, 0x9C, 0xA9, 0xD2, 0xAC, 0xA9, 0xCA, 0x0D, 0x29, 0xCA, 0x9C, 0xA0, 0xD2, 0x9C, 0xA9,
+    0xD0, 0xD2, 0x9D, 0x0D, 0x9D, 0x29, 0xD0, 0xD9, 0xD2, 0x9D, 0x9D, 0x9D, 0x10, 0x77, 0x3A, 0xFC,
+    0xA7, 0xAF, 0xE9, 0x5A, 0xD2, 0xAD, 0x5A, 0xD3, 0xD9, 0x4A, 0xD2, 0x9D, 0x92, 0x99, 0xFF, 0xC9,
+    0x19, 0xFF, 0xE2, 0x9F, 0xFC, 0xA3, 0x9F, 0xCA, 0xA9, 0x70, 0xE7, 0xFF, 0xD9, 0x3F, 0xFD, 0x97,
+    0xE9, 0x71, 0x9E, 0x95, 0x4C, 0x71, 0xDA, 0x7D, 0xA7, 0xDA, 0x7F, 0xFD, 0x99, 0xFF, 0xD9, 0x09,
+    0xDA, 0x70, 0xAD, 0x71, 0xAD, 0x71, 0xD9, 0x71, 0x95, 0x5A, 0x72, 0xE7, 0x9F, 0xC9, 0x49, 0xFE,
+    0x92, 0xAD, 0xAA, 0xCA, 0xAD, 0xA1, 0xD9, 0x0A, 0xCA, 0x0A, 0xC9, 0x29, 0x1A, 0xCA, 0x71, 0xAC,
+    0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x77, 0x10, 0x5A, 0x97, 0x09, 0xD9, 0x70, 0x9D,
+    0x97, 0x09, 0xD9, 0x1F, 0xFD, 0x90, 0xFF, 0xDA, 0x69, 0xDA, 0x7E, 0x7E, 0x70, 0xD7, 0x70, 0x4A,
+    0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x5D, 0x90, 0xAC, 0xA0, 0x9C,
+    0x91, 0xAD, 0xAA, 0xCA, 0xAD, 0xA2, 0xAF, 0xE9, 0x49, 0xFC, 0x96, 0x9E, 0x97, 0x1C, 0x77, 0x20,
+    0x39, 0x29, 0x96, 0xD2, 0xD5, 0xD9, 0x29, 0xD3, 0xAC, 0xA4, 0x9D, 0x1A, 0xFF, 0xEA, 0x09, 0xFF,
+    0xEA, 0x19, 0xCA, 0x4A, 0xCA, 0x39, 0xCA, 0x2A, 0xCA, 0x59, 0xA2, 0x9A, 0x30, 0x3A, 0x96, 0xE9,
+    0x4F, 0xCA, 0x19, 0xDA, 0xCA, 0xDA, 0x0A, 0xC9, 0x0C, 0xA0, 0xAC, 0x4C, 0xA7, 0xCA, 0x7C, 0xA3,
+    0x9C, 0x1C, 0xA0, 0xAA, 0x09, 0xD9, 0xCA, 0xAD, 0x19, 0xFD, 0x4E, 0xA6, 0xCA, 0x75, 0x71, 0x9A,
+    0xAA, 0xF1, 0xAF, 0xE1, 0xAE, 0xA9, 0x3A, 0xF4, 0xD9, 0xE3, 0xD9, 0x0E, 0x2D, 0x2E, 0x1D, 0x3E,
+    0x7C, 0x10, 0x72, 0x9F, 0xAA, 0xA1, 0x9F, 0xE9, 0x39, 0xAE, 0x93, 0x9F, 0x92, 0x9D, 0xAA, 0xCA,
+    0x19, 0xDA, 0x0A, 0xCA, 0x09, 0xDA, 0x19, 0xCA, 0x0D, 0xA2, 0x9C, 0xA0, 0x9A, 0x60, 0x09, 0xA7,
+    0xDA, 0x3A, 0x90, 0x9D, 0xA1, 0xAC, 0xA1, 0xAD, 0x90, 0xAC, 0x92, 0xAD, 0x9D, 0x93, 0xFC, 0x5F,
+    0x1A, 0xFE, 0x1A, 0xFD, 0xA7, 0x20, 0x7A, 0x1A, 0xA3, 0xDA, 0x0D, 0x2E, 0x1D, 0x1E, 0x2A, 0xC9,
+    0xAD, 0x92, 0xAF, 0x93, 0x9E, 0xA4, 0x9F, 0xE2, 0xFE, 0x72, 0x77, 0x9C, 0x72, 0xDA, 0x70, 0xAD,
+    0x70, 0xAE, 0xAA, 0xAA, 0xAA, 0xA0, 0xAF, 0xFE, 0x9E, 0x72, 0xFF, 0xE9, 0x09, 0xEA, 0xAA, 0xAA,
+    0xAA, 0x29, 0xDA, 0x71, 0xAC, 0x97, 0x29, 0x70, 0x49, 0x09, 0x71, 0x9C, 0x9A, 0xC7, 0x9D, 0x9A,
+    0xD5, 0x9E, 0x9A, 0xE3, 0x9F, 0x9A, 0xF1, 0x9E, 0x9C, 0x9A, 0xC9, 0xE0, 0xAD, 0x09, 0xC9, 0xAC,
+    0x90, 0xD9, 0x0A, 0x19, 0xC9, 0xAC, 0x91, 0x94, 0x9C, 0x9A, 0xC9, 0x79, 0xC9, 0xAC, 0x97, 0x9C,
+    0x9A, 0xC9, 0x79, 0xC9, 0xAC, 0x97, 0x9C, 0x9A, 0xC9, 0x70, 0x91, 0x94, 0x77, 0x3C, 0xA7, 0x19,
+    0xD9, 0x71, 0xAD, 0x2A, 0xAA, 0xAA, 0xAA, 0xAE, 0x1F, 0xFF, 0x71, 0xAD, 0x0F, 0xFE, 0x90, 0xAA,
+    0xAA, 0xAA, 0xAE, 0xA7, 0x0D, 0xA7, 0x1D, 0x72, 0x94, 0x49, 0x19, 0x70, 0x9C, 0x9A, 0xC9, 0x79,
+    0xC9, 0xAC, 0x97, 0x9C, 0x9A, 0xC9, 0x79, 0xC9, 0xAC, 0x97, 0x9C, 0x9A, 0xC9, 0x4A, 0x19, 0xC9,
+    0xAC, 0x91, 0x90, 0xAD, 0x09, 0xC9, 0xAC, 0x90, 0xD9, 0x9E, 0x9C, 0x9A, 0xC9, 0xE1, 0x9F, 0x9A,
+    0xF3, 0x9E, 0x9A, 0xE5, 0x9D, 0x9A, 0xD7, 0x9C, 0x9A, 0xC7, 0x19, 0x09, 0x50, 0x77, 0x19, 0xC3,
+    0xCA, 0x6D, 0xA1, 0x9D, 0x94, 0xAD, 0x3A, 0xD3, 0xAE, 0xAA, 0xAA, 0xAE, 0x1A, 0xFF, 0xFC, 0x0E,
+    0x7A, 0xD1, 0xFF, 0xF9, 0x19, 0xEA, 0xAA, 0xAE, 0xA3, 0x9D, 0xA1, 0x9D, 0xA5, 0xAC, 0x92, 0xD7,
+    0x93, 0x94, 0x76, 0xD9, 0x6F, 0x93, 0x9F, 0xDA, 0x1A, 0xE9, 0xAF, 0x9F, 0x9A, 0xC9, 0xDA, 0x09,
+    0x9C, 0x9A, 0xC1, 0x93, 0xC9, 0xAC, 0x6C, 0x9A, 0xC4, 0xA9, 0xC9, 0xAC, 0x09, 0xA0, 0xF9, 0xAC,
+    0xAD, 0xA9, 0xEA, 0xAF, 0x2F, 0xD9, 0x4A, 0xE7, 0xAC, 0x40, 0x77, 0x09, 0xD9, 0x6F, 0x70, 0xDA,
+    0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xC9, 0x2F, 0x9A, 0xC9, 0x1F, 0xF9, 0x0E, 0x90, 0xAE, 0x1D, 0xA2,
+    0xE1, 0xD9, 0x2A, 0xCA, 0x1E, 0x90, 0x9D, 0x91, 0xAF, 0xE3, 0xFD, 0x94, 0xAE, 0x92, 0x77, 0x79,
+    0xAE, 0xA9, 0x1D, 0x5A, 0xFE, 0xAE, 0x4F, 0xA9, 0x9F, 0xA4, 0x9E, 0x39, 0xE9, 0x4E, 0x39, 0xFC,
+    0x4E, 0x2A, 0xD9, 0xE4, 0xDA, 0x1A, 0xD9, 0x0E, 0x39, 0xDA, 0x0E, 0x2E, 0x4F, 0xD3, 0xE4, 0xFC,
+    0x91, 0x9F, 0x4F, 0xFF, 0xC3, 0x9F, 0xFF, 0x92, 0x9F, 0xFF, 0xA3, 0xDA, 0x1A, 0xFC, 0xA9, 0x59,
+    0x76, 0x59, 0x97, 0x29, 0xE7, 0x1F, 0x97, 0x9F, 0xC7, 0xEA, 0xD9, 0x59, 0xDA, 0x0E, 0x5E, 0x1A,
+    0xD9, 0x39, 0xDA, 0x19, 0xE3, 0xE9, 0x2E, 0x91, 0x9E, 0x3A, 0xE1, 0xE9, 0x4E, 0x1F, 0xFF, 0x90,
+    0xFF, 0xF9, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x74, 0xFF, 0xD9, 0x0F, 0xFD, 0x91, 0xAD,
+    0x1A, 0xD3, 0xAD, 0x1A, 0xD3, 0xAD, 0x1A, 0xD3, 0xAD, 0x1A, 0xD3, 0xAD, 0x1A, 0xD3, 0xAD, 0x1A,
+    0xD3, 0xAD, 0x1A, 0xD3, 0xAD, 0x1A, 0xD3, 0xAD, 0x1A, 0xD3, 0xAD, 0x1A, 0xD3, 0x99, 0x91, 0x99,
+    0x91, 0x19, 0x99, 0x19, 0x99, 0x3A, 0xD1, 0xAD, 0x3A, 0xD1, 0xAD, 0x3A, 0xD1, 0xAD, 0x3A, 0xD1,
+    0xAD, 0x3A, 0xD1, 0xAD, 0x3A, 0xD1, 0xAD, 0x3A, 0xD1, 0xAD, 0x3A, 0xD1, 0xAD, 0x3A, 0xD1, 0xAD,
+    0x3A, 0xD1, 0xAD, 0x2F, 0xFD, 0x90, 0xFF, 0xD9, 0x73, 0x72, 0xFF, 0x1F, 0xF1, 0xAD, 0x96, 0xE7,
+    0xE6, 0x9D, 0xA6, 0x9D, 0x6A, 0xCA, 0x5D, 0xA4, 0x9E, 0x5F, 0xF1, 0xFF, 0x1A, 0xAA, 0xAA, 0xAA,
+    0xA0, 0x09, 0xAA, 0xAF, 0x1F, 0xF1, 0x99, 0x99, 0x99, 0x91, 0x6A, 0xAA, 0xAA, 0xA9, 0x6F, 0xD6,
+    0x9D, 0x99, 0x70, 0xDA, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xE6,
+    0xAC, 0x1E, 0x69, 0xFC, 0xA7, 0xFC, 0x97, 0x9F, 0x71, 0xF7, 0x39, 0x93, 0x95, 0xAF, 0x99, 0xF2,
+    0xAF, 0xFE, 0xA1, 0xDA, 0x19, 0xDA, 0x1D, 0x1D, 0x3A, 0xC2, 0xAC, 0x90, 0xD9, 0x2D, 0x91, 0xD9,
+    0x0F, 0xFF, 0xC1, 0x9F, 0xFE, 0xA2, 0x9E, 0xA0, 0x9F, 0x73, 0x99, 0x20, 0x70, 0x9D, 0xA9, 0x79,
+    0xF9, 0x7D, 0xA1, 0x97, 0xD9, 0x71, 0x9D, 0x72, 0xAD, 0x72, 0xAC, 0xA7, 0x2D, 0xA7, 0x2D, 0x97,
+    0x2D, 0x97, 0x19, 0xD7, 0x29, 0xD7, 0x2A, 0xD6, 0x9A, 0x99, 0xDA, 0x5F, 0xE9, 0x5A, 0xFD, 0x79,
+    0xEA, 0x77, 0x40, 0x5A, 0xD1, 0xE9, 0x0E, 0xA0, 0xEA, 0x77, 0xAD, 0x1E, 0x90, 0xEA, 0x0E, 0xA0,
+    0x72, 0xAD, 0xA1, 0xAA, 0x99, 0xFC, 0x0A, 0xCA, 0xAD, 0x0A, 0xF9, 0x09, 0x91, 0x9A, 0xA9, 0x19,
+    0xAA, 0x91, 0x99, 0x09, 0xFA, 0x0D, 0xAA, 0xD9, 0xD9, 0xD9, 0x9A, 0xA0, 0x9F, 0x59, 0xAA, 0x90,
+    0x77, 0x59, 0xC9, 0x71, 0xD7, 0x1A, 0xC9, 0x71, 0xCA, 0x71, 0xF9, 0x1F, 0xFE, 0x0A, 0xFE, 0x97,
+    0x0D, 0xA5, 0xFF, 0xD9, 0x09, 0xFF, 0xE3, 0xE9, 0x79, 0xD7, 0x1D, 0xA7, 0x0A, 0xD7, 0x00, 0x77,
+    0x70, 0xAC, 0x97, 0x1A, 0xE9, 0x69, 0xFC, 0xA5, 0x9F, 0xC9, 0x59, 0xFC, 0x97, 0xAF, 0x97, 0x0F,
+    0xFA, 0x96, 0x9F, 0xFA, 0x79, 0xAF, 0xC7, 0x29, 0xAD, 0x3F, 0xAA, 0x99, 0x6F, 0xFE, 0x94, 0x99,
+    0xAA, 0xAF, 0xC7, 0x70, 0x77, 0x0A, 0xCA, 0x73, 0xAE, 0xA9, 0x71, 0xAF, 0xC9, 0x71, 0x9F, 0xCA,
+    0x72, 0xAF, 0x96, 0x9A, 0xFC, 0x92, 0x9A, 0xFF, 0xA9, 0x2F, 0xDA, 0x96, 0xEA, 0x72, 0x92, 0x99,
+    0xAA, 0xAC, 0xA2, 0x9F, 0xFE, 0x2F, 0xCA, 0xA9, 0x99, 0x77, 0x20,
 };
 
 static const EpdGlyph opendyslexic_8_boldGlyphs[] = {
     { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 5, 22, 6, 0, 19, 28, 0 }, // !
-    { 11, 6, 12, -2, 15, 17, 28 }, // "
-    { 19, 15, 19, -1, 13, 72, 45 }, // #
-    { 15, 20, 19, 2, 17, 75, 117 }, // $
-    { 14, 15, 18, 3, 13, 53, 192 }, // %
-    { 12, 14, 16, 2, 14, 42, 245 }, // &
-    { 6, 6, 7, 0, 13, 9, 287 }, // '
-    { 7, 23, 9, 1, 17, 41, 296 }, // (
-    { 8, 23, 8, -1, 17, 46, 337 }, // )
-    { 10, 10, 11, 0, 13, 25, 383 }, // *
-    { 10, 10, 11, 0, 10, 25, 408 }, // +
-    { 6, 6, 7, 0, 3, 9, 433 }, // ,
-    { 9, 2, 10, 0, 6, 5, 442 }, // -
-    { 4, 4, 5, 0, 4, 4, 447 }, // .
-    { 12, 29, 13, 0, 20, 87, 451 }, // /
-    { 10, 14, 12, 1, 13, 35, 538 }, // 0
-    { 9, 13, 11, 1, 13, 30, 573 }, // 1
-    { 10, 13, 12, 1, 13, 33, 603 }, // 2
-    { 10, 13, 12, 1, 13, 33, 636 }, // 3
-    { 10, 14, 12, 1, 13, 35, 669 }, // 4
-    { 10, 15, 12, 1, 14, 38, 704 }, // 5
-    { 10, 13, 12, 1, 13, 33, 742 }, // 6
-    { 10, 13, 12, 1, 13, 33, 775 }, // 7
-    { 11, 14, 13, 1, 13, 39, 808 }, // 8
-    { 10, 14, 12, 1, 13, 35, 847 }, // 9
-    { 5, 12, 6, 0, 12, 15, 882 }, // :
-    { 6, 15, 7, 0, 11, 23, 897 }, // ;
-    { 14, 11, 14, -1, 11, 39, 920 }, // <
-    { 10, 7, 11, 0, 8, 18, 959 }, // =
-    { 14, 11, 15, 0, 11, 39, 977 }, // >
-    { 11, 21, 12, 0, 19, 58, 1016 }, // ?
-    { 16, 15, 17, 0, 13, 60, 1074 }, // @
-    { 14, 14, 16, 1, 14, 49, 1134 }, // A
-    { 12, 14, 16, 2, 14, 42, 1183 }, // B
-    { 12, 15, 17, 2, 15, 45, 1225 }, // C
-    { 13, 14, 18, 2, 14, 46, 1270 }, // D
-    { 11, 14, 15, 2, 14, 39, 1316 }, // E
-    { 10, 14, 14, 2, 14, 35, 1355 }, // F
-    { 15, 15, 19, 2, 15, 57, 1390 }, // G
-    { 13, 14, 18, 2, 14, 46, 1447 }, // H
-    { 5, 14, 9, 2, 14, 18, 1493 }, // I
-    { 11, 18, 15, 2, 14, 50, 1511 }, // J
-    { 13, 14, 18, 2, 14, 46, 1561 }, // K
-    { 11, 14, 15, 2, 14, 39, 1607 }, // L
-    { 15, 14, 19, 2, 14, 53, 1646 }, // M
-    { 13, 14, 17, 2, 14, 46, 1699 }, // N
-    { 15, 15, 19, 2, 14, 57, 1745 }, // O
-    { 11, 15, 15, 2, 15, 42, 1802 }, // P
-    { 16, 18, 18, 1, 15, 72, 1844 }, // Q
-    { 12, 15, 16, 2, 14, 45, 1916 }, // R
-    { 14, 16, 18, 2, 15, 56, 1961 }, // S
-    { 13, 14, 18, 2, 14, 46, 2017 }, // T
-    { 13, 15, 17, 2, 14, 49, 2063 }, // U
-    { 15, 14, 19, 2, 14, 53, 2112 }, // V
-    { 20, 15, 24, 2, 15, 75, 2165 }, // W
-    { 14, 14, 19, 2, 14, 49, 2240 }, // X
-    { 14, 14, 18, 2, 14, 49, 2289 }, // Y
-    { 14, 14, 18, 2, 14, 49, 2338 }, // Z
-    { 7, 25, 8, 0, 18, 44, 2387 }, // [
-    { 8, 19, 9, 0, 15, 38, 2431 }, // <backslash>
-    { 7, 25, 8, 0, 18, 44, 2469 }, // ]
-    { 10, 5, 11, 0, 17, 13, 2513 }, // ^
-    { 13, 4, 13, -1, 0, 13, 2526 }, // _
-    { 7, 4, 8, 0, 13, 7, 2539 }, // `
-    { 10, 10, 14, 2, 10, 25, 2546 }, // a
-    { 11, 16, 15, 2, 15, 44, 2571 }, // b
-    { 9, 10, 13, 2, 10, 23, 2615 }, // c
-    { 11, 14, 15, 2, 14, 39, 2638 }, // d
-    { 10, 9, 14, 2, 9, 23, 2677 }, // e
-    { 7, 14, 11, 2, 14, 25, 2700 }, // f
-    { 10, 14, 14, 2, 9, 35, 2725 }, // g
-    { 11, 14, 15, 2, 14, 39, 2760 }, // h
-    { 4, 15, 8, 2, 15, 15, 2799 }, // i
-    { 7, 20, 10, 2, 15, 35, 2814 }, // j
-    { 11, 14, 15, 2, 14, 39, 2849 }, // k
-    { 6, 14, 10, 2, 14, 21, 2888 }, // l
-    { 16, 10, 20, 2, 10, 40, 2909 }, // m
-    { 10, 10, 15, 2, 10, 25, 2949 }, // n
-    { 10, 9, 14, 2, 9, 23, 2974 }, // o
-    { 12, 15, 16, 2, 10, 45, 2997 }, // p
-    { 12, 14, 16, 2, 10, 42, 3042 }, // q
-    { 8, 9, 12, 2, 9, 18, 3084 }, // r
-    { 10, 11, 14, 2, 10, 28, 3102 }, // s
-    { 9, 14, 13, 2, 13, 32, 3130 }, // t
-    { 10, 9, 14, 2, 9, 23, 3162 }, // u
-    { 12, 9, 16, 2, 9, 27, 3185 }, // v
-    { 14, 11, 19, 2, 9, 39, 3212 }, // w
-    { 12, 9, 16, 2, 9, 27, 3251 }, // x
-    { 11, 14, 15, 2, 9, 39, 3278 }, // y
-    { 11, 9, 15, 2, 9, 25, 3317 }, // z
-    { 9, 17, 10, 0, 13, 39, 3342 }, // {
-    { 3, 16, 7, 2, 13, 12, 3381 }, // |
-    { 9, 17, 10, 0, 13, 39, 3393 }, // }
-    { 7, 4, 8, 0, 12, 7, 3432 }, // ~
-    { 0, 0, 14, 0, 0, 0, 3439 }, //  
-    { 6, 22, 12, 3, 19, 33, 3439 }, // ¡
-    { 9, 15, 13, 2, 12, 34, 3472 }, // ¢
-    { 12, 15, 13, 0, 14, 45, 3506 }, // £
-    { 11, 10, 12, 0, 11, 28, 3551 }, // ¤
-    { 13, 16, 14, 0, 13, 52, 3579 }, // ¥
-    { 3, 15, 7, 1, 12, 12, 3631 }, // ¦
-    { 9, 14, 13, 2, 13, 32, 3643 }, // §
-    { 9, 4, 10, 0, 14, 9, 3675 }, // ¨
-    { 8, 7, 11, 2, 16, 14, 3684 }, // ©
-    { 6, 6, 11, 3, 13, 9, 3698 }, // ª
-    { 9, 10, 10, 0, 10, 23, 3707 }, // «
-    { 10, 6, 11, 0, 6, 15, 3730 }, // ¬
-    { 10, 2, 11, 0, 6, 5, 3745 }, // ­
-    { 8, 7, 11, 2, 18, 14, 3750 }, // ®
-    { 8, 3, 9, 0, 13, 6, 3764 }, // ¯
-    { 8, 8, 11, 2, 13, 16, 3770 }, // °
-    { 10, 11, 11, 0, 9, 28, 3786 }, // ±
-    { 5, 7, 6, 0, 14, 9, 3814 }, // ²
-    { 5, 7, 6, 0, 14, 9, 3823 }, // ³
-    { 5, 4, 6, 0, 13, 5, 3832 }, // ´
-    { 11, 11, 14, 1, 9, 31, 3837 }, // µ
-    { 10, 15, 13, 1, 12, 38, 3868 }, // ¶
-    { 4, 4, 5, 0, 8, 4, 3906 }, // ·
-    { 5, 6, 6, 0, 1, 8, 3910 }, // ¸
-    { 5, 7, 6, 0, 14, 9, 3918 }, // ¹
-    { 6, 6, 11, 3, 13, 9, 3927 }, // º
-    { 10, 10, 12, 1, 10, 25, 3936 }, // »
-    { 16, 16, 21, 2, 14, 64, 3961 }, // ¼
-    { 18, 17, 21, 2, 15, 77, 4025 }, // ½
-    { 16, 15, 21, 2, 13, 60, 4102 }, // ¾
-    { 11, 21, 12, 0, 12, 58, 4162 }, // ¿
-    { 14, 19, 16, 1, 19, 67, 4220 }, // À
-    { 14, 22, 16, 1, 22, 77, 4287 }, // Á
-    { 14, 20, 16, 1, 20, 70, 4364 }, // Â
-    { 14, 19, 16, 1, 19, 67, 4434 }, // Ã
-    { 14, 20, 16, 1, 20, 70, 4501 }, // Ä
-    { 14, 20, 16, 1, 20, 70, 4571 }, // Å
-    { 21, 15, 23, 1, 14, 79, 4641 }, // Æ
-    { 12, 19, 17, 2, 15, 57, 4720 }, // Ç
-    { 11, 19, 15, 2, 19, 53, 4777 }, // È
-    { 11, 22, 15, 2, 22, 61, 4830 }, // É
-    { 11, 21, 15, 2, 21, 58, 4891 }, // Ê
-    { 11, 20, 15, 2, 20, 55, 4949 }, // Ë
-    { 8, 20, 9, 0, 20, 40, 5004 }, // Ì
-    { 5, 23, 9, 2, 23, 29, 5044 }, // Í
-    { 10, 21, 11, 0, 21, 53, 5073 }, // Î
-    { 9, 21, 10, 0, 21, 48, 5126 }, // Ï
-    { 16, 14, 18, -1, 14, 56, 5174 }, // Ð
-    { 13, 19, 17, 2, 19, 62, 5230 }, // Ñ
-    { 15, 20, 19, 2, 19, 75, 5292 }, // Ò
-    { 15, 23, 19, 2, 22, 87, 5367 }, // Ó
-    { 15, 21, 19, 2, 20, 79, 5454 }, // Ô
-    { 15, 20, 19, 2, 19, 75, 5533 }, // Õ
-    { 15, 21, 19, 2, 20, 79, 5608 }, // Ö
-    { 10, 6, 11, 0, 7, 15, 5687 }, // ×
-    { 25, 33, 23, -3, 24, 207, 5702 }, // Ø
-    { 13, 21, 17, 2, 20, 69, 5909 }, // Ù
-    { 13, 24, 17, 2, 23, 78, 5978 }, // Ú
-    { 13, 22, 17, 2, 21, 72, 6056 }, // Û
-    { 13, 22, 17, 2, 21, 72, 6128 }, // Ü
-    { 14, 24, 18, 2, 24, 84, 6200 }, // Ý
-    { 9, 14, 10, 0, 14, 32, 6284 }, // Þ
-    { 11, 13, 12, 0, 12, 36, 6316 }, // ß
-    { 10, 14, 14, 2, 14, 35, 6352 }, // à
-    { 10, 17, 14, 2, 17, 43, 6387 }, // á
-    { 10, 16, 14, 2, 16, 40, 6430 }, // â
-    { 10, 15, 14, 2, 15, 38, 6470 }, // ã
-    { 10, 15, 14, 2, 15, 38, 6508 }, // ä
-    { 10, 16, 14, 2, 16, 40, 6546 }, // å
-    { 17, 10, 21, 2, 10, 43, 6586 }, // æ
-    { 9, 14, 13, 2, 10, 32, 6629 }, // ç
-    { 10, 16, 14, 2, 16, 40, 6661 }, // è
-    { 10, 19, 14, 2, 19, 48, 6701 }, // é
-    { 10, 17, 14, 2, 17, 43, 6749 }, // ê
-    { 10, 17, 14, 2, 17, 43, 6792 }, // ë
-    { 7, 14, 8, 0, 14, 25, 6835 }, // ì
-    { 4, 17, 8, 2, 17, 17, 6860 }, // í
-    { 10, 16, 10, -1, 16, 40, 6877 }, // î
-    { 8, 15, 9, 0, 15, 30, 6917 }, // ï
-    { 14, 16, 14, -1, 15, 56, 6947 }, // ð
-    { 10, 15, 15, 2, 15, 38, 7003 }, // ñ
-    { 10, 14, 14, 2, 14, 35, 7041 }, // ò
-    { 10, 17, 14, 2, 17, 43, 7076 }, // ó
-    { 10, 15, 14, 2, 15, 38, 7119 }, // ô
-    { 10, 14, 14, 2, 14, 35, 7157 }, // õ
-    { 10, 15, 14, 2, 15, 38, 7192 }, // ö
-    { 13, 12, 15, 1, 12, 39, 7230 }, // ÷
-    { 12, 28, 14, 1, 19, 84, 7269 }, // ø
-    { 10, 14, 14, 2, 14, 35, 7353 }, // ù
-    { 10, 17, 14, 2, 17, 43, 7388 }, // ú
-    { 10, 15, 14, 2, 15, 38, 7431 }, // û
-    { 10, 15, 14, 2, 15, 38, 7469 }, // ü
-    { 11, 24, 15, 2, 19, 66, 7507 }, // ý
-    { 9, 18, 10, 0, 14, 41, 7573 }, // þ
-    { 11, 22, 15, 2, 17, 61, 7614 }, // ÿ
-    { 14, 20, 16, 1, 20, 70, 7675 }, // Ā
-    { 10, 15, 14, 2, 15, 38, 7745 }, // ā
-    { 14, 20, 16, 1, 20, 70, 7783 }, // Ă
-    { 10, 16, 14, 2, 16, 40, 7853 }, // ă
-    { 14, 19, 16, 1, 14, 67, 7893 }, // Ą
-    { 11, 15, 14, 2, 10, 42, 7960 }, // ą
-    { 12, 20, 17, 2, 20, 60, 8002 }, // Ć
-    { 9, 14, 13, 2, 14, 32, 8062 }, // ć
-    { 12, 21, 17, 2, 21, 63, 8094 }, // Ĉ
-    { 10, 15, 13, 2, 15, 38, 8157 }, // ĉ
-    { 12, 20, 17, 2, 20, 60, 8195 }, // Ċ
-    { 9, 14, 13, 2, 14, 32, 8255 }, // ċ
-    { 12, 21, 17, 2, 21, 63, 8287 }, // Č
-    { 10, 15, 13, 2, 15, 38, 8350 }, // č
-    { 13, 21, 18, 2, 21, 69, 8388 }, // Ď
-    { 14, 14, 17, 2, 14, 49, 8457 }, // ď
-    { 16, 14, 18, -1, 14, 56, 8506 }, // Đ
-    { 13, 14, 16, 2, 14, 46, 8562 }, // đ
-    { 11, 20, 15, 2, 20, 55, 8608 }, // Ē
-    { 10, 17, 14, 2, 17, 43, 8663 }, // ē
-    { 11, 21, 15, 2, 21, 58, 8706 }, // Ĕ
-    { 10, 17, 14, 2, 17, 43, 8764 }, // ĕ
-    { 11, 20, 15, 2, 20, 55, 8807 }, // Ė
-    { 10, 17, 14, 2, 17, 43, 8862 }, // ė
-    { 11, 19, 15, 2, 14, 53, 8905 }, // Ę
-    { 10, 16, 14, 2, 9, 40, 8958 }, // ę
-    { 11, 22, 15, 2, 22, 61, 8998 }, // Ě
-    { 10, 18, 14, 2, 18, 45, 9059 }, // ě
-    { 15, 23, 19, 2, 23, 87, 9104 }, // Ĝ
-    { 11, 21, 14, 2, 16, 58, 9191 }, // ĝ
-    { 15, 23, 19, 2, 23, 87, 9249 }, // Ğ
-    { 10, 21, 14, 2, 16, 53, 9336 }, // ğ
-    { 15, 22, 19, 2, 22, 83, 9389 }, // Ġ
-    { 10, 20, 14, 2, 15, 50, 9472 }, // ġ
-    { 15, 25, 19, 2, 25, 94, 9522 }, // Ģ
-    { 10, 21, 14, 2, 16, 53, 9616 }, // ģ
-    { 13, 21, 18, 2, 21, 69, 9669 }, // Ĥ
-    { 13, 20, 15, 0, 20, 65, 9738 }, // ĥ
-    { 15, 14, 18, 1, 14, 53, 9803 }, // Ħ
-    { 13, 14, 15, 0, 14, 46, 9856 }, // ħ
-    { 7, 21, 9, 1, 21, 37, 9902 }, // Ĩ
-    { 7, 16, 8, 0, 16, 28, 9939 }, // ĩ
-    { 10, 21, 10, -1, 21, 53, 9967 }, // Ī
-    { 10, 15, 10, -1, 15, 38, 10020 }, // ī
-    { 6, 19, 9, 1, 14, 29, 10058 }, // Į
-    { 6, 20, 8, 1, 15, 30, 10087 }, // į
-    { 5, 21, 9, 2, 21, 27, 10117 }, // İ
-    { 4, 10, 8, 2, 10, 10, 10144 }, // ı
-    { 14, 21, 26, 6, 14, 74, 10154 }, // Ĳ
-    { 10, 19, 13, 2, 15, 48, 10228 }, // ĳ
-    { 12, 25, 15, 2, 21, 75, 10276 }, // Ĵ
-    { 9, 22, 12, 2, 17, 50, 10351 }, // ĵ
-    { 13, 23, 18, 2, 23, 75, 10401 }, // Ķ
-    { 11, 23, 15, 2, 14, 64, 10476 }, // ķ
-    { 9, 9, 11, 1, 9, 21, 10540 }, // ĸ
-    { 11, 19, 15, 2, 19, 53, 10561 }, // Ĺ
-    { 6, 21, 10, 2, 21, 32, 10614 }, // ĺ
-    { 12, 22, 15, 1, 22, 66, 10646 }, // Ļ
-    { 7, 23, 10, 1, 14, 41, 10712 }, // ļ
-    { 11, 14, 15, 2, 14, 39, 10753 }, // Ľ
-    { 8, 17, 11, 2, 17, 34, 10792 }, // ľ
-    { 11, 14, 15, 2, 14, 39, 10826 }, // Ŀ
-    { 8, 14, 11, 2, 14, 28, 10865 }, // ŀ
-    { 19, 26, 15, -5, 20, 124, 10893 }, // Ł
-    { 13, 14, 10, -4, 14, 46, 11017 }, // ł
-    { 13, 20, 17, 2, 20, 65, 11063 }, // Ń
-    { 10, 16, 15, 2, 16, 40, 11128 }, // ń
-    { 13, 21, 17, 2, 14, 69, 11168 }, // Ņ
-    { 10, 17, 15, 2, 10, 43, 11237 }, // ņ
-    { 13, 21, 17, 2, 21, 69, 11280 }, // Ň
-    { 11, 17, 15, 2, 17, 47, 11349 }, // ň
-    { 10, 17, 15, 2, 17, 43, 11396 }, // ŉ
-    { 13, 18, 17, 2, 14, 59, 11439 }, // Ŋ
-    { 10, 14, 15, 2, 10, 35, 11498 }, // ŋ
-    { 15, 21, 19, 2, 20, 79, 11533 }, // Ō
-    { 10, 15, 14, 2, 15, 38, 11612 }, // ō
-    { 15, 21, 19, 2, 20, 79, 11650 }, // Ŏ
-    { 10, 15, 14, 2, 15, 38, 11729 }, // ŏ
-    { 16, 20, 19, 2, 19, 80, 11767 }, // Ő
-    { 15, 14, 17, 1, 14, 53, 11847 }, // ő
-    { 20, 15, 23, 2, 14, 75, 11900 }, // Œ
-    { 17, 9, 20, 2, 9, 39, 11975 }, // œ
-    { 12, 20, 16, 2, 19, 60, 12014 }, // Ŕ
-    { 8, 14, 12, 2, 14, 28, 12074 }, // ŕ
-    { 12, 24, 16, 2, 23, 72, 12102 }, // Ŗ
-    { 8, 17, 12, 2, 17, 34, 12174 }, // ŗ
-    { 12, 22, 16, 2, 21, 66, 12208 }, // Ř
-    { 9, 15, 12, 1, 15, 34, 12274 }, // ř
-    { 14, 21, 18, 2, 20, 74, 12308 }, // Ś
-    { 10, 15, 14, 2, 14, 38, 12382 }, // ś
-    { 14, 22, 18, 2, 21, 77, 12420 }, // Ŝ
-    { 10, 16, 14, 2, 15, 40, 12497 }, // ŝ
-    { 14, 19, 18, 2, 15, 67, 12537 }, // Ş
-    { 10, 14, 14, 2, 10, 35, 12604 }, // ş
-    { 14, 22, 18, 2, 21, 77, 12639 }, // Š
-    { 10, 16, 14, 2, 15, 40, 12716 }, // š
-    { 13, 19, 18, 2, 14, 62, 12756 }, // Ţ
-    { 9, 17, 13, 2, 13, 39, 12818 }, // ţ
-    { 13, 21, 18, 2, 21, 69, 12857 }, // Ť
-    { 12, 16, 15, 2, 15, 48, 12926 }, // ť
-    { 13, 14, 18, 2, 14, 46, 12974 }, // Ŧ
-    { 10, 14, 13, 1, 13, 35, 13020 }, // ŧ
-    { 13, 22, 17, 2, 21, 72, 13055 }, // Ũ
-    { 10, 15, 14, 2, 15, 38, 13127 }, // ũ
-    { 13, 22, 17, 2, 21, 72, 13165 }, // Ū
-    { 10, 15, 14, 2, 15, 38, 13237 }, // ū
-    { 13, 22, 17, 2, 21, 72, 13275 }, // Ŭ
-    { 10, 16, 14, 2, 16, 40, 13347 }, // ŭ
-    { 13, 23, 17, 2, 22, 75, 13387 }, // Ů
-    { 10, 16, 14, 2, 16, 40, 13462 }, // ů
-    { 15, 21, 18, 2, 20, 79, 13502 }, // Ű
-    { 15, 14, 17, 1, 14, 53, 13581 }, // ű
-    { 13, 19, 17, 2, 14, 62, 13634 }, // Ų
-    { 10, 14, 14, 2, 9, 35, 13696 }, // ų
-    { 20, 21, 24, 2, 21, 105, 13731 }, // Ŵ
-    { 14, 19, 19, 2, 17, 67, 13836 }, // ŵ
-    { 14, 22, 18, 2, 22, 77, 13903 }, // Ŷ
-    { 11, 23, 15, 2, 18, 64, 13980 }, // ŷ
-    { 14, 22, 18, 2, 22, 77, 14044 }, // Ÿ
-    { 14, 19, 18, 2, 19, 67, 14121 }, // Ź
-    { 11, 15, 15, 2, 15, 42, 14188 }, // ź
-    { 14, 19, 18, 2, 19, 67, 14230 }, // Ż
-    { 11, 15, 15, 2, 15, 42, 14297 }, // ż
-    { 14, 21, 18, 2, 21, 74, 14339 }, // Ž
-    { 11, 17, 15, 2, 17, 47, 14413 }, // ž
-    { 7, 15, 10, 1, 14, 27, 14460 }, // ſ
-    { 16, 17, 19, 2, 16, 68, 14487 }, // Ơ
-    { 12, 11, 15, 2, 11, 33, 14555 }, // ơ
-    { 14, 15, 15, -1, 15, 53, 14588 }, // Ƥ
-    { 12, 18, 16, 2, 13, 54, 14641 }, // ƥ
-    { 10, 14, 11, 0, 13, 35, 14695 }, // Ʃ
-    { 14, 14, 18, 1, 14, 49, 14730 }, // Ƭ
-    { 9, 17, 13, 2, 16, 39, 14779 }, // ƭ
-    { 13, 17, 18, 2, 14, 56, 14818 }, // Ʈ
-    { 15, 18, 18, 2, 17, 68, 14874 }, // Ư
-    { 12, 12, 15, 2, 12, 36, 14942 }, // ư
-    { 7, 4, 8, 0, 13, 7, 14978 }, // ̀
-    { 5, 4, 6, 0, 13, 5, 14985 }, // ́
-    { 10, 5, 11, 0, 1, 13, 14990 }, // ̂
-    { 7, 4, 8, 0, 12, 7, 15003 }, // ̃
-    { 10, 3, 11, 0, 12, 8, 15010 }, // ̄
-    { 12, 3, 13, 0, 15, 9, 15018 }, // ̅
-    { 9, 5, 10, 0, 13, 12, 15027 }, // ̆
-    { 5, 4, 8, 2, 14, 5, 15039 }, // ̇
-    { 8, 4, 9, 0, 13, 8, 15044 }, // ̈
-    { 4, 4, 8, 3, 11, 4, 15052 }, // ̉
-    { 5, 4, 6, 0, 13, 5, 15056 }, // ̊
-    { 15, 4, 16, 0, 13, 15, 15061 }, // ̋
-    { 10, 5, 11, 0, 13, 13, 15076 }, // ̌
-    { 15, 4, 12, -4, 13, 15, 15089 }, // ̏
-    { 6, 6, 7, 0, 13, 9, 15104 }, // ̒
-    { 6, 6, 7, 0, 13, 9, 15113 }, // ̓
-    { 6, 6, 6, -1, 13, 9, 15122 }, // ̔
-    { 5, 5, 6, 0, 0, 7, 15131 }, // ̘
-    { 5, 5, 6, 0, 0, 7, 15138 }, // ̙
-    { 9, 5, 10, 0, 14, 12, 15145 }, // ̚
-    { 4, 5, 5, 0, 11, 5, 15157 }, // ̛
-    { 4, 6, 5, 0, 0, 6, 15162 }, // ̜
-    { 6, 4, 7, 0, 3, 6, 15168 }, // ̝
-    { 6, 4, 7, 0, 0, 6, 15174 }, // ̞
-    { 4, 5, 6, 1, -1, 5, 15180 }, // ̟
-    { 10, 3, 11, 0, -2, 8, 15185 }, // ̠
-    { 5, 4, 6, 0, 2, 5, 15193 }, // ̣
-    { 8, 4, 9, 0, -1, 8, 15198 }, // ̤
-    { 5, 4, 6, 0, 13, 5, 15206 }, // ̥
-    { 6, 6, 7, 0, 3, 9, 15211 }, // ̦
-    { 5, 6, 6, 0, 1, 8, 15220 }, // ̧
-    { 5, 6, 7, 1, 1, 8, 15228 }, // ̨
-    { 4, 6, 5, 0, 0, 6, 15236 }, // ̩
-    { 7, 4, 8, 0, 0, 7, 15242 }, // ̪
-    { 11, 5, 11, -1, 1, 14, 15249 }, // ̬
-    { 11, 5, 11, -1, 1, 14, 15263 }, // ̭
-    { 7, 4, 9, 1, 14, 7, 15277 }, // ̰
-    { 9, 3, 10, 0, 14, 7, 15284 }, // ̱
-    { 9, 3, 10, 0, -1, 7, 15291 }, // ̲
-    { 7, 4, 9, 1, 14, 7, 15298 }, // ̴
-    { 9, 2, 10, 0, 6, 5, 15305 }, // ̵
-    { 4, 6, 5, 0, 0, 6, 15310 }, // ̹
-    { 8, 6, 9, 0, 1, 12, 15316 }, // ̺
-    { 7, 6, 8, 0, 1, 11, 15328 }, // ̻
-    { 7, 5, 8, 0, 1, 9, 15339 }, // ̼
-    { 6, 4, 8, 1, 13, 6, 15348 }, // ̽
-    { 7, 4, 8, 0, 12, 7, 15354 }, // ͂
-    { 3, 5, 8, 4, 15, 4, 15361 }, // ̓
-    { 9, 12, 10, 0, 21, 27, 15365 }, // ̈́
-    { 7, 4, 8, 0, 14, 7, 15392 }, // ͆
-    { 10, 7, 11, 0, 0, 18, 15399 }, // ͇
-    { 8, 5, 9, 0, 0, 10, 15417 }, // ͈
-    { 7, 6, 8, 0, 0, 11, 15427 }, // ͉
-    { 8, 13, 10, 1, 18, 26, 15438 }, // ͊
-    { 16, 13, 17, 0, 19, 52, 15464 }, // ͋
-    { 10, 10, 18, 7, 10, 25, 15516 }, // ͌
-    { 9, 4, 11, 1, -2, 9, 15541 }, // ͍
-    { 4, 3, 5, 0, 2, 3, 15550 }, // ͎
-    { 15, 5, 16, 0, 1, 19, 15553 }, // ͜
-    { 15, 5, 16, 0, 14, 19, 15572 }, // ͡
-    { 19, 6, 20, 0, 0, 29, 15591 }, // ͢
-    { 14, 14, 16, 1, 14, 49, 15620 }, // Α
-    { 12, 14, 16, 2, 14, 42, 15669 }, // Β
-    { 9, 15, 10, 0, 13, 34, 15711 }, // Γ
-    { 14, 14, 15, 0, 13, 49, 15745 }, // Δ
-    { 11, 14, 15, 2, 14, 39, 15794 }, // Ε
-    { 14, 14, 18, 2, 14, 49, 15833 }, // Ζ
-    { 13, 14, 18, 2, 14, 46, 15882 }, // Η
-    { 15, 15, 19, 2, 14, 57, 15928 }, // Θ
-    { 5, 14, 9, 2, 14, 18, 15985 }, // Ι
-    { 13, 14, 18, 2, 14, 46, 16003 }, // Κ
-    { 15, 14, 19, 2, 14, 53, 16049 }, // Λ
-    { 15, 14, 19, 2, 14, 53, 16102 }, // Μ
-    { 13, 14, 17, 2, 14, 46, 16155 }, // Ν
-    { 12, 14, 13, 0, 13, 42, 16201 }, // Ξ
-    { 15, 15, 19, 2, 14, 57, 16243 }, // Ο
-    { 10, 13, 11, 0, 12, 33, 16300 }, // Π
-    { 11, 15, 15, 2, 15, 42, 16333 }, // Ρ
-    { 10, 14, 11, 0, 13, 35, 16375 }, // Σ
-    { 13, 14, 18, 2, 14, 46, 16410 }, // Τ
-    { 14, 14, 18, 2, 14, 49, 16456 }, // Υ
-    { 17, 19, 23, 3, 16, 81, 16505 }, // Φ
-    { 14, 14, 19, 2, 14, 49, 16586 }, // Χ
-    { 13, 16, 14, 0, 14, 52, 16635 }, // Ψ
-    { 13, 15, 15, 1, 13, 49, 16687 }, // Ω
-    { 12, 11, 16, 2, 10, 33, 16736 }, // α
-    { 11, 20, 12, 0, 16, 55, 16769 }, // β
-    { 11, 15, 12, 0, 9, 42, 16824 }, // γ
-    { 11, 16, 12, 0, 15, 44, 16866 }, // δ
-    { 8, 9, 10, 1, 9, 18, 16910 }, // ε
-    { 9, 16, 10, 0, 13, 36, 16928 }, // ζ
-    { 12, 16, 13, 0, 10, 48, 16964 }, // η
-    { 11, 14, 12, 0, 13, 39, 17012 }, // θ
-    { 6, 12, 10, 2, 12, 18, 17051 }, // ι
-    { 10, 9, 12, 1, 9, 23, 17069 }, // κ
-    { 11, 14, 14, 2, 14, 39, 17092 }, // λ
-    { 11, 11, 14, 1, 9, 31, 17131 }, // μ
-    { 11, 11, 12, 0, 9, 31, 17162 }, // ν
-    { 9, 16, 10, 0, 13, 36, 17193 }, // ξ
-    { 10, 9, 14, 2, 9, 23, 17229 }, // ο
-    { 12, 10, 13, 0, 9, 30, 17252 }, // π
-    { 12, 14, 13, 0, 10, 42, 17282 }, // ρ
-    { 9, 13, 10, 0, 13, 30, 17324 }, // ς
-    { 12, 9, 16, 2, 9, 27, 17354 }, // σ
-    { 11, 10, 12, 0, 9, 28, 17381 }, // τ
-    { 9, 10, 10, 0, 9, 23, 17409 }, // υ
-    { 15, 22, 19, 2, 18, 83, 17432 }, // φ
-    { 13, 15, 14, 0, 10, 49, 17515 }, // χ
-    { 11, 20, 12, 0, 13, 55, 17564 }, // ψ
-    { 14, 11, 15, 0, 10, 39, 17619 }, // ω
-    { 14, 19, 16, 1, 14, 67, 17658 }, // Ạ
-    { 10, 16, 14, 2, 10, 40, 17725 }, // ạ
-    { 14, 20, 16, 1, 20, 70, 17765 }, // Ả
-    { 10, 16, 14, 2, 16, 40, 17835 }, // ả
-    { 14, 25, 16, 1, 25, 88, 17875 }, // Ấ
-    { 11, 18, 14, 2, 18, 50, 17963 }, // ấ
-    { 16, 21, 16, -1, 21, 84, 18013 }, // Ầ
-    { 15, 18, 14, -3, 18, 68, 18097 }, // ầ
-    { 14, 26, 16, 1, 26, 91, 18165 }, // Ẩ
-    { 12, 19, 15, 2, 19, 57, 18256 }, // ẩ
-    { 14, 24, 16, 1, 24, 84, 18313 }, // Ẫ
-    { 10, 19, 14, 2, 19, 48, 18397 }, // ẫ
-    { 14, 25, 16, 1, 20, 88, 18445 }, // Ậ
-    { 10, 22, 14, 2, 16, 55, 18533 }, // ậ
-    { 14, 25, 16, 1, 25, 88, 18588 }, // Ắ
-    { 10, 21, 14, 2, 21, 53, 18676 }, // ắ
-    { 14, 25, 16, 1, 25, 88, 18729 }, // Ằ
-    { 10, 21, 14, 2, 21, 53, 18817 }, // ằ
-    { 14, 26, 16, 1, 26, 91, 18870 }, // Ẳ
-    { 10, 23, 14, 2, 23, 58, 18961 }, // ẳ
-    { 14, 26, 16, 1, 26, 91, 19019 }, // Ẵ
-    { 10, 21, 14, 2, 21, 53, 19110 }, // ẵ
-    { 14, 25, 16, 1, 20, 88, 19163 }, // Ặ
-    { 10, 22, 14, 2, 16, 55, 19251 }, // ặ
-    { 11, 21, 15, 2, 14, 58, 19306 }, // Ẹ
-    { 10, 16, 14, 2, 9, 40, 19364 }, // ẹ
-    { 11, 21, 15, 2, 21, 58, 19404 }, // Ẻ
-    { 10, 17, 14, 2, 17, 43, 19462 }, // ẻ
-    { 11, 21, 15, 2, 21, 58, 19505 }, // Ẽ
-    { 10, 17, 14, 2, 17, 43, 19563 }, // ẽ
-    { 14, 21, 17, 2, 21, 74, 19606 }, // Ế
-    { 13, 17, 16, 2, 17, 56, 19680 }, // ế
-    { 14, 22, 15, -1, 22, 77, 19736 }, // Ề
-    { 13, 19, 14, -1, 19, 62, 19813 }, // ề
-    { 11, 23, 15, 2, 23, 64, 19875 }, // Ể
-    { 12, 20, 15, 2, 20, 60, 19939 }, // ể
-    { 11, 24, 15, 2, 24, 66, 19999 }, // Ễ
-    { 10, 21, 14, 2, 21, 53, 20065 }, // ễ
-    { 11, 28, 15, 2, 21, 77, 20118 }, // Ệ
-    { 10, 24, 14, 2, 17, 60, 20195 }, // ệ
-    { 5, 22, 9, 2, 22, 28, 20255 }, // Ỉ
-    { 4, 16, 8, 2, 16, 16, 20283 }, // ỉ
-    { 5, 21, 9, 2, 14, 27, 20299 }, // Ị
-    { 4, 22, 8, 2, 15, 22, 20326 }, // ị
-    { 15, 22, 19, 2, 14, 83, 20348 }, // Ọ
-    { 10, 16, 14, 2, 9, 40, 20431 }, // ọ
-    { 15, 21, 19, 2, 20, 79, 20471 }, // Ỏ
-    { 10, 15, 14, 2, 15, 38, 20550 }, // ỏ
-    { 15, 21, 19, 2, 20, 79, 20588 }, // Ố
-    { 13, 16, 16, 2, 16, 52, 20667 }, // ố
-    { 17, 22, 19, 0, 21, 94, 20719 }, // Ồ
-    { 13, 17, 14, -1, 17, 56, 20813 }, // ồ
-    { 15, 23, 19, 2, 22, 87, 20869 }, // Ổ
-    { 12, 18, 15, 2, 18, 54, 20956 }, // ổ
-    { 15, 25, 19, 2, 24, 94, 21010 }, // Ỗ
-    { 10, 19, 14, 2, 19, 48, 21104 }, // ỗ
-    { 15, 28, 19, 2, 20, 105, 21152 }, // Ộ
-    { 10, 22, 14, 2, 15, 55, 21257 }, // ộ
-    { 16, 21, 19, 2, 20, 84, 21312 }, // Ớ
-    { 12, 15, 15, 2, 15, 45, 21396 }, // ớ
-    { 16, 21, 19, 2, 20, 84, 21441 }, // Ờ
-    { 12, 15, 15, 2, 15, 45, 21525 }, // ờ
-    { 16, 21, 19, 2, 20, 84, 21570 }, // Ở
-    { 12, 15, 15, 2, 15, 45, 21654 }, // ở
-    { 16, 21, 19, 2, 20, 84, 21699 }, // Ỡ
-    { 12, 16, 15, 2, 16, 48, 21783 }, // ỡ
-    { 16, 24, 19, 2, 16, 96, 21831 }, // Ợ
-    { 12, 18, 15, 2, 11, 54, 21927 }, // ợ
-    { 13, 22, 17, 2, 14, 72, 21981 }, // Ụ
-    { 10, 17, 14, 2, 9, 43, 22053 }, // ụ
-    { 13, 22, 17, 2, 21, 72, 22096 }, // Ủ
-    { 10, 15, 14, 2, 15, 38, 22168 }, // ủ
-    { 15, 22, 18, 2, 21, 83, 22206 }, // Ứ
-    { 12, 15, 15, 2, 15, 45, 22289 }, // ứ
-    { 15, 22, 18, 2, 21, 83, 22334 }, // Ừ
-    { 12, 15, 15, 2, 15, 45, 22417 }, // ừ
-    { 15, 22, 18, 2, 21, 83, 22462 }, // Ử
-    { 12, 15, 15, 2, 15, 45, 22545 }, // ử
-    { 15, 22, 18, 2, 21, 83, 22590 }, // Ữ
-    { 12, 15, 15, 2, 15, 45, 22673 }, // ữ
-    { 15, 25, 18, 2, 17, 94, 22718 }, // Ự
-    { 12, 20, 15, 2, 12, 60, 22812 }, // ự
-    { 14, 21, 18, 2, 21, 74, 22872 }, // Ỳ
-    { 11, 21, 15, 2, 16, 58, 22946 }, // ỳ
-    { 14, 23, 18, 2, 14, 81, 23004 }, // Ỵ
-    { 13, 16, 16, 2, 9, 52, 23085 }, // ỵ
-    { 14, 23, 18, 2, 23, 81, 23137 }, // Ỷ
-    { 11, 23, 15, 2, 18, 64, 23218 }, // ỷ
-    { 14, 23, 18, 2, 23, 81, 23282 }, // Ỹ
-    { 11, 22, 15, 2, 17, 61, 23363 }, // ỹ
-    { 0, 0, 11, 0, 0, 0, 23424 }, //  
-    { 0, 0, 19, 0, 0, 0, 23424 }, //  
-    { 0, 0, 11, 0, 0, 0, 23424 }, //  
-    { 0, 0, 19, 0, 0, 0, 23424 }, //  
-    { 0, 0, 8, 0, 0, 0, 23424 }, //  
-    { 0, 0, 7, 0, 0, 0, 23424 }, //  
-    { 0, 0, 5, 0, 0, 0, 23424 }, //  
-    { 0, 0, 12, 0, 0, 0, 23424 }, //  
-    { 0, 0, 4, 0, 0, 0, 23424 }, //  
-    { 0, 0, 6, 0, 0, 0, 23424 }, //  
-    { 0, 0, 5, 0, 0, 0, 23424 }, //  
-    { 0, 0, 3, 0, 0, 0, 23424 }, // ​
-    { 0, 0, 1, 0, 0, 0, 23424 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 23424 }, // ‍
-    { 0, 0, 1, 0, 0, 0, 23424 }, // ‎
-    { 0, 0, 1, 0, 0, 0, 23424 }, // ‏
-    { 9, 2, 10, 0, 6, 5, 23424 }, // ‐
-    { 9, 2, 10, 0, 6, 5, 23429 }, // ‑
-    { 13, 2, 12, -2, 6, 7, 23434 }, // ‒
-    { 13, 4, 14, 0, 7, 13, 23441 }, // –
-    { 18, 4, 19, 0, 7, 18, 23454 }, // —
-    { 18, 4, 19, 0, 7, 18, 23472 }, // ―
-    { 8, 16, 11, 2, 13, 32, 23490 }, // ‖
-    { 15, 6, 13, -3, -1, 23, 23522 }, // ‗
-    { 6, 6, 8, 1, 15, 9, 23545 }, // ‘
-    { 6, 6, 8, 1, 15, 9, 23554 }, // ’
-    { 6, 6, 7, 0, 3, 9, 23563 }, // ‚
-    { 6, 6, 8, 1, 15, 9, 23572 }, // ‛
-    { 11, 6, 13, 1, 15, 17, 23581 }, // “
-    { 11, 6, 13, 1, 15, 17, 23598 }, // ”
-    { 6, 6, 7, 0, 3, 9, 23615 }, // „
-    { 11, 6, 13, 1, 15, 17, 23624 }, // ‟
-    { 10, 24, 13, 2, 18, 60, 23641 }, // †
-    { 10, 23, 14, 3, 17, 58, 23701 }, // ‡
-    { 14, 13, 12, -3, 15, 46, 23759 }, // •
-    { 6, 7, 10, 2, 8, 11, 23805 }, // ‣
-    { 4, 4, 10, 3, 4, 4, 23816 }, // ․
-    { 4, 4, 10, 3, 4, 4, 23820 }, // ‥
-    { 16, 4, 17, 0, 4, 16, 23824 }, // …
-    { 3, 2, 9, 3, 6, 2, 23840 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 23842 }, //  
-    { 13, 15, 19, 3, 13, 49, 23842 }, // ‰
-    { 7, 6, 10, 2, 15, 11, 23891 }, // ′
-    { 12, 6, 15, 2, 15, 18, 23902 }, // ″
-    { 13, 6, 15, 1, 14, 20, 23920 }, // ‴
-    { 5, 6, 7, 1, 14, 8, 23940 }, // ‵
-    { 8, 6, 9, 0, 14, 12, 23948 }, // ‶
-    { 13, 6, 11, -3, 14, 20, 23960 }, // ‷
-    { 10, 4, 11, 0, 14, 10, 23980 }, // ‸
-    { 5, 10, 7, 1, 10, 13, 23990 }, // ‹
-    { 6, 10, 7, 0, 10, 15, 24003 }, // ›
-    { 18, 22, 23, 3, 17, 99, 24018 }, // ※
-    { 6, 22, 10, 2, 19, 33, 24117 }, // ‼
-    { 11, 27, 14, 1, 23, 75, 24150 }, // ‽
-    { 9, 2, 10, 0, 14, 5, 24225 }, // ‾
-    { 9, 5, 10, 0, 12, 12, 24230 }, // ‿
-    { 13, 12, 13, -1, 15, 39, 24242 }, // ⁂
-    { 11, 15, 21, 5, 13, 42, 24281 }, // ⁄
-    { 21, 21, 25, 2, 19, 111, 24323 }, // ⁇
-    { 18, 22, 20, 1, 19, 99, 24434 }, // ⁈
-    { 14, 22, 14, -1, 19, 77, 24533 }, // ⁉
-    { 13, 29, 15, 1, 20, 95, 24610 }, // ⁒
-    { 0, 0, 78, 0, 0, 0, 24705 }, //  
-    { 5, 7, 6, 0, 14, 9, 24705 }, // ⁰
-    { 6, 6, 7, 0, 14, 9, 24714 }, // ⁴
-    { 6, 8, 7, 0, 14, 12, 24723 }, // ⁵
-    { 6, 7, 7, 0, 14, 11, 24735 }, // ⁶
-    { 6, 8, 7, 0, 15, 12, 24746 }, // ⁷
-    { 6, 7, 7, 0, 14, 11, 24758 }, // ⁸
-    { 6, 8, 7, 0, 14, 12, 24769 }, // ⁹
-    { 10, 10, 15, 2, 10, 25, 24781 }, // ⁿ
-    { 6, 7, 7, 0, 4, 11, 24806 }, // ₀
-    { 5, 7, 6, 0, 4, 9, 24817 }, // ₁
-    { 6, 7, 7, 0, 4, 11, 24826 }, // ₂
-    { 6, 7, 7, 0, 4, 11, 24837 }, // ₃
-    { 6, 7, 7, 0, 4, 11, 24848 }, // ₄
-    { 5, 8, 6, 0, 5, 10, 24859 }, // ₅
-    { 6, 7, 7, 0, 4, 11, 24869 }, // ₆
-    { 6, 8, 7, 0, 5, 12, 24880 }, // ₇
-    { 6, 7, 7, 0, 4, 11, 24892 }, // ₈
-    { 6, 8, 7, 0, 4, 12, 24903 }, // ₉
-    { 7, 23, 9, 1, 17, 41, 24915 }, // ₍
-    { 8, 23, 8, -1, 17, 46, 24956 }, // ₎
-    { 12, 22, 17, 2, 18, 66, 25002 }, // ₡
-    { 12, 15, 17, 2, 15, 45, 25068 }, // ₢
-    { 12, 14, 13, 0, 13, 42, 25113 }, // ₤
-    { 19, 14, 19, -1, 14, 67, 25155 }, // ₦
-    { 15, 15, 16, 0, 15, 57, 25222 }, // ₧
-    { 18, 15, 22, 2, 14, 68, 25279 }, // ₨
-    { 14, 14, 15, 0, 14, 49, 25347 }, // ₩
-    { 14, 13, 18, 2, 13, 46, 25396 }, // ₪
-    { 12, 14, 12, -1, 13, 42, 25442 }, // ₫
-    { 12, 17, 13, 0, 14, 51, 25484 }, // €
-    { 13, 14, 18, 2, 14, 46, 25535 }, // ₮
-    { 17, 15, 17, -1, 15, 64, 25581 }, // ₱
-    { 15, 21, 19, 2, 18, 79, 25645 }, // ₲
-    { 17, 15, 21, 3, 14, 64, 25724 }, // ₴
-    { 9, 13, 12, 2, 11, 30, 25788 }, // ₵
-    { 14, 16, 18, 2, 16, 56, 25818 }, // ₸
-    { 9, 13, 12, 1, 12, 30, 25874 }, // ₹
-    { 11, 13, 12, 0, 11, 36, 25904 }, // ₺
-    { 12, 14, 14, 1, 14, 42, 25940 }, // ₼
-    { 15, 15, 15, -2, 15, 57, 25982 }, // ₽
-    { 12, 11, 13, 0, 9, 33, 26039 }, // ←
-    { 13, 12, 14, 0, 10, 39, 26072 }, // ↑
-    { 12, 11, 13, 0, 9, 33, 26111 }, // →
-    { 13, 12, 14, 0, 11, 39, 26144 }, // ↓
-    { 14, 9, 17, 2, 9, 32, 26183 }, // ↔
-    { 10, 14, 13, 2, 15, 35, 26215 }, // ↕
-    { 10, 10, 13, 2, 10, 25, 26250 }, // ↖
-    { 10, 10, 11, 0, 10, 25, 26275 }, // ↗
-    { 10, 10, 11, 0, 9, 25, 26300 }, // ↘
-    { 10, 10, 11, 0, 9, 25, 26325 }, // ↙
-    { 13, 12, 16, 2, 10, 39, 26350 }, // ⇐
-    { 14, 14, 18, 2, 13, 49, 26389 }, // ⇑
-    { 13, 12, 16, 2, 10, 39, 26438 }, // ⇒
-    { 14, 14, 18, 2, 13, 49, 26477 }, // ⇓
-    { 15, 12, 18, 2, 10, 45, 26526 }, // ⇔
-    { 11, 15, 15, 2, 9, 42, 26571 }, // ⇕
-    { 11, 16, 12, 0, 15, 44, 26613 }, // ∂
-    { 18, 16, 19, 0, 15, 72, 26657 }, // ∅
-    { 14, 14, 15, 0, 13, 49, 26729 }, // ∆
-    { 12, 14, 13, 0, 13, 42, 26778 }, // ∏
-    { 12, 14, 13, 0, 13, 42, 26820 }, // ∐
-    { 10, 14, 11, 0, 13, 35, 26862 }, // ∑
-    { 10, 3, 11, 0, 6, 8, 26897 }, // −
-    { 14, 15, 16, 1, 14, 53, 26905 }, // √
-    { 15, 10, 16, 0, 11, 38, 26958 }, // ∞
-    { 14, 18, 15, 0, 13, 63, 26996 }, // ∫
-    { 5, 12, 6, 0, 12, 15, 27059 }, // ∶
-    { 10, 10, 24, 7, 10, 25, 27074 }, // ≈
-    { 13, 15, 21, 4, 14, 49, 27099 }, // ≠
-    { 15, 15, 15, -1, 13, 57, 27148 }, // ≤
-    { 15, 14, 16, 0, 12, 53, 27205 }, // ≥
+    { 5, 22, 6, 0, 19, 25, 0 }, // !
+    { 11, 6, 12, -2, 15, 21, 25 }, // "
+    { 19, 15, 19, -1, 13, 60, 46 }, // #
+    { 15, 20, 19, 2, 17, 52, 106 }, // $
+    { 14, 15, 18, 3, 13, 57, 158 }, // %
+    { 12, 14, 16, 2, 14, 39, 215 }, // &
+    { 6, 6, 7, 0, 13, 10, 254 }, // '
+    { 7, 23, 9, 1, 17, 34, 264 }, // (
+    { 8, 23, 8, -1, 17, 36, 298 }, // )
+    { 10, 10, 11, 0, 13, 22, 334 }, // *
+    { 10, 10, 11, 0, 10, 18, 356 }, // +
+    { 6, 6, 7, 0, 3, 10, 374 }, // ,
+    { 9, 2, 10, 0, 6, 3, 384 }, // -
+    { 4, 4, 5, 0, 4, 6, 387 }, // .
+    { 12, 29, 13, 0, 20, 54, 393 }, // /
+    { 10, 14, 12, 1, 13, 39, 447 }, // 0
+    { 9, 13, 11, 1, 13, 24, 486 }, // 1
+    { 10, 13, 12, 1, 13, 25, 510 }, // 2
+    { 10, 13, 12, 1, 13, 29, 535 }, // 3
+    { 10, 14, 12, 1, 13, 30, 564 }, // 4
+    { 10, 15, 12, 1, 14, 28, 594 }, // 5
+    { 10, 13, 12, 1, 13, 34, 622 }, // 6
+    { 10, 13, 12, 1, 13, 21, 656 }, // 7
+    { 11, 14, 13, 1, 13, 38, 677 }, // 8
+    { 10, 14, 12, 1, 13, 35, 715 }, // 9
+    { 5, 12, 6, 0, 12, 13, 750 }, // :
+    { 6, 15, 7, 0, 11, 20, 763 }, // ;
+    { 14, 11, 14, -1, 11, 27, 783 }, // <
+    { 10, 7, 11, 0, 8, 13, 810 }, // =
+    { 14, 11, 15, 0, 11, 27, 823 }, // >
+    { 11, 21, 12, 0, 19, 34, 850 }, // ?
+    { 16, 15, 17, 0, 13, 52, 884 }, // @
+    { 14, 14, 16, 1, 14, 36, 936 }, // A
+    { 12, 14, 16, 2, 14, 43, 972 }, // B
+    { 12, 15, 17, 2, 15, 33, 1015 }, // C
+    { 13, 14, 18, 2, 14, 42, 1048 }, // D
+    { 11, 14, 15, 2, 14, 31, 1090 }, // E
+    { 10, 14, 14, 2, 14, 25, 1121 }, // F
+    { 15, 15, 19, 2, 15, 46, 1146 }, // G
+    { 13, 14, 18, 2, 14, 40, 1192 }, // H
+    { 5, 14, 9, 2, 14, 15, 1232 }, // I
+    { 11, 18, 15, 2, 14, 31, 1247 }, // J
+    { 13, 14, 18, 2, 14, 34, 1278 }, // K
+    { 11, 14, 15, 2, 14, 23, 1312 }, // L
+    { 15, 14, 19, 2, 14, 52, 1335 }, // M
+    { 13, 14, 17, 2, 14, 50, 1387 }, // N
+    { 15, 15, 19, 2, 14, 41, 1437 }, // O
+    { 11, 15, 15, 2, 15, 31, 1478 }, // P
+    { 16, 18, 18, 1, 15, 50, 1509 }, // Q
+    { 12, 15, 16, 2, 14, 39, 1559 }, // R
+    { 14, 16, 18, 2, 15, 37, 1598 }, // S
+    { 13, 14, 18, 2, 14, 30, 1635 }, // T
+    { 13, 15, 17, 2, 14, 37, 1665 }, // U
+    { 15, 14, 19, 2, 14, 37, 1702 }, // V
+    { 20, 15, 24, 2, 15, 56, 1739 }, // W
+    { 14, 14, 19, 2, 14, 36, 1795 }, // X
+    { 14, 14, 18, 2, 14, 33, 1831 }, // Y
+    { 14, 14, 18, 2, 14, 34, 1864 }, // Z
+    { 7, 25, 8, 0, 18, 38, 1898 }, // [
+    { 8, 19, 9, 0, 15, 27, 1936 }, // <backslash>
+    { 7, 25, 8, 0, 18, 38, 1963 }, // ]
+    { 10, 5, 11, 0, 17, 8, 2001 }, // ^
+    { 13, 4, 13, -1, 0, 12, 2009 }, // _
+    { 7, 4, 8, 0, 13, 6, 2021 }, // `
+    { 10, 10, 14, 2, 10, 26, 2027 }, // a
+    { 11, 16, 15, 2, 15, 33, 2053 }, // b
+    { 9, 10, 13, 2, 10, 19, 2086 }, // c
+    { 11, 14, 15, 2, 14, 33, 2105 }, // d
+    { 10, 9, 14, 2, 9, 23, 2138 }, // e
+    { 7, 14, 11, 2, 14, 24, 2161 }, // f
+    { 10, 14, 14, 2, 9, 38, 2185 }, // g
+    { 11, 14, 15, 2, 14, 34, 2223 }, // h
+    { 4, 15, 8, 2, 15, 19, 2257 }, // i
+    { 7, 20, 10, 2, 15, 29, 2276 }, // j
+    { 11, 14, 15, 2, 14, 30, 2305 }, // k
+    { 6, 14, 10, 2, 14, 22, 2335 }, // l
+    { 16, 10, 20, 2, 10, 40, 2357 }, // m
+    { 10, 10, 15, 2, 10, 24, 2397 }, // n
+    { 10, 9, 14, 2, 9, 23, 2421 }, // o
+    { 12, 15, 16, 2, 10, 34, 2444 }, // p
+    { 12, 14, 16, 2, 10, 33, 2478 }, // q
+    { 8, 9, 12, 2, 9, 16, 2511 }, // r
+    { 10, 11, 14, 2, 10, 20, 2527 }, // s
+    { 9, 14, 13, 2, 13, 22, 2547 }, // t
+    { 10, 9, 14, 2, 9, 25, 2569 }, // u
+    { 12, 9, 16, 2, 9, 24, 2594 }, // v
+    { 14, 11, 19, 2, 9, 33, 2618 }, // w
+    { 12, 9, 16, 2, 9, 21, 2651 }, // x
+    { 11, 14, 15, 2, 9, 31, 2672 }, // y
+    { 11, 9, 15, 2, 9, 17, 2703 }, // z
+    { 9, 17, 10, 0, 13, 30, 2720 }, // {
+    { 3, 16, 7, 2, 13, 19, 2750 }, // |
+    { 9, 17, 10, 0, 13, 27, 2769 }, // }
+    { 7, 4, 8, 0, 12, 12, 2796 }, // ~
+    { 0, 0, 14, 0, 0, 0, 2808 }, //  
+    { 6, 22, 12, 3, 19, 30, 2808 }, // ¡
+    { 9, 15, 13, 2, 12, 32, 2838 }, // ¢
+    { 12, 15, 13, 0, 14, 35, 2870 }, // £
+    { 11, 10, 12, 0, 11, 23, 2905 }, // ¤
+    { 13, 16, 14, 0, 13, 34, 2928 }, // ¥
+    { 3, 15, 7, 1, 12, 17, 2962 }, // ¦
+    { 9, 14, 13, 2, 13, 31, 2979 }, // §
+    { 9, 4, 10, 0, 14, 13, 3010 }, // ¨
+    { 8, 7, 11, 2, 16, 22, 3023 }, // ©
+    { 6, 6, 11, 3, 13, 12, 3045 }, // ª
+    { 9, 10, 10, 0, 10, 28, 3057 }, // «
+    { 10, 6, 11, 0, 6, 15, 3085 }, // ¬
+    { 10, 2, 11, 0, 6, 4, 3100 }, // ­
+    { 8, 7, 11, 2, 18, 21, 3104 }, // ®
+    { 8, 3, 9, 0, 13, 7, 3125 }, // ¯
+    { 8, 8, 11, 2, 13, 18, 3132 }, // °
+    { 10, 11, 11, 0, 9, 21, 3150 }, // ±
+    { 5, 7, 6, 0, 14, 14, 3171 }, // ²
+    { 5, 7, 6, 0, 14, 13, 3185 }, // ³
+    { 5, 4, 6, 0, 13, 7, 3198 }, // ´
+    { 11, 11, 14, 1, 9, 30, 3205 }, // µ
+    { 10, 15, 13, 1, 12, 47, 3235 }, // ¶
+    { 4, 4, 5, 0, 8, 6, 3282 }, // ·
+    { 5, 6, 6, 0, 1, 10, 3288 }, // ¸
+    { 5, 7, 6, 0, 14, 10, 3298 }, // ¹
+    { 6, 6, 11, 3, 13, 11, 3308 }, // º
+    { 10, 10, 12, 1, 10, 24, 3319 }, // »
+    { 16, 16, 21, 2, 14, 62, 3343 }, // ¼
+    { 18, 17, 21, 2, 15, 58, 3405 }, // ½
+    { 16, 15, 21, 2, 13, 59, 3463 }, // ¾
+    { 11, 21, 12, 0, 12, 35, 3522 }, // ¿
+    { 14, 19, 16, 1, 19, 45, 3557 }, // À
+    { 14, 22, 16, 1, 22, 47, 3602 }, // Á
+    { 14, 20, 16, 1, 20, 49, 3649 }, // Â
+    { 14, 19, 16, 1, 19, 48, 3698 }, // Ã
+    { 14, 20, 16, 1, 20, 50, 3746 }, // Ä
+    { 14, 20, 16, 1, 20, 46, 3796 }, // Å
+    { 21, 15, 23, 1, 14, 55, 3842 }, // Æ
+    { 12, 19, 17, 2, 15, 41, 3897 }, // Ç
+    { 11, 19, 15, 2, 19, 38, 3938 }, // È
+    { 11, 22, 15, 2, 22, 40, 3976 }, // É
+    { 11, 21, 15, 2, 21, 40, 4016 }, // Ê
+    { 11, 20, 15, 2, 20, 46, 4056 }, // Ë
+    { 8, 20, 9, 0, 20, 21, 4102 }, // Ì
+    { 5, 23, 9, 2, 23, 22, 4123 }, // Í
+    { 10, 21, 11, 0, 21, 26, 4145 }, // Î
+    { 9, 21, 10, 0, 21, 31, 4171 }, // Ï
+    { 16, 14, 18, -1, 14, 45, 4202 }, // Ð
+    { 13, 19, 17, 2, 19, 59, 4247 }, // Ñ
+    { 15, 20, 19, 2, 19, 48, 4306 }, // Ò
+    { 15, 23, 19, 2, 22, 51, 4354 }, // Ó
+    { 15, 21, 19, 2, 20, 51, 4405 }, // Ô
+    { 15, 20, 19, 2, 19, 54, 4456 }, // Õ
+    { 15, 21, 19, 2, 20, 56, 4510 }, // Ö
+    { 10, 6, 11, 0, 7, 17, 4566 }, // ×
+    { 25, 33, 23, -3, 24, 100, 4583 }, // Ø
+    { 13, 21, 17, 2, 20, 46, 4683 }, // Ù
+    { 13, 24, 17, 2, 23, 49, 4729 }, // Ú
+    { 13, 22, 17, 2, 21, 49, 4778 }, // Û
+    { 13, 22, 17, 2, 21, 52, 4827 }, // Ü
+    { 14, 24, 18, 2, 24, 46, 4879 }, // Ý
+    { 9, 14, 10, 0, 14, 22, 4925 }, // Þ
+    { 11, 13, 12, 0, 12, 38, 4947 }, // ß
+    { 10, 14, 14, 2, 14, 32, 4985 }, // à
+    { 10, 17, 14, 2, 17, 34, 5017 }, // á
+    { 10, 16, 14, 2, 16, 37, 5051 }, // â
+    { 10, 15, 14, 2, 15, 38, 5088 }, // ã
+    { 10, 15, 14, 2, 15, 40, 5126 }, // ä
+    { 10, 16, 14, 2, 16, 35, 5166 }, // å
+    { 17, 10, 21, 2, 10, 39, 5201 }, // æ
+    { 9, 14, 13, 2, 10, 25, 5240 }, // ç
+    { 10, 16, 14, 2, 16, 31, 5265 }, // è
+    { 10, 19, 14, 2, 19, 33, 5296 }, // é
+    { 10, 17, 14, 2, 17, 35, 5329 }, // ê
+    { 10, 17, 14, 2, 17, 38, 5364 }, // ë
+    { 7, 14, 8, 0, 14, 19, 5402 }, // ì
+    { 4, 17, 8, 2, 17, 20, 5421 }, // í
+    { 10, 16, 10, -1, 16, 24, 5441 }, // î
+    { 8, 15, 9, 0, 15, 23, 5465 }, // ï
+    { 14, 16, 14, -1, 15, 35, 5488 }, // ð
+    { 10, 15, 15, 2, 15, 37, 5523 }, // ñ
+    { 10, 14, 14, 2, 14, 30, 5560 }, // ò
+    { 10, 17, 14, 2, 17, 31, 5590 }, // ó
+    { 10, 15, 14, 2, 15, 34, 5621 }, // ô
+    { 10, 14, 14, 2, 14, 35, 5655 }, // õ
+    { 10, 15, 14, 2, 15, 36, 5690 }, // ö
+    { 13, 12, 15, 1, 12, 27, 5726 }, // ÷
+    { 12, 28, 14, 1, 19, 59, 5753 }, // ø
+    { 10, 14, 14, 2, 14, 32, 5812 }, // ù
+    { 10, 17, 14, 2, 17, 33, 5844 }, // ú
+    { 10, 15, 14, 2, 15, 36, 5877 }, // û
+    { 10, 15, 14, 2, 15, 40, 5913 }, // ü
+    { 11, 24, 15, 2, 19, 41, 5953 }, // ý
+    { 9, 18, 10, 0, 14, 35, 5994 }, // þ
+    { 11, 22, 15, 2, 17, 46, 6029 }, // ÿ
+    { 14, 20, 16, 1, 20, 44, 6075 }, // Ā
+    { 10, 15, 14, 2, 15, 38, 6119 }, // ā
+    { 14, 20, 16, 1, 20, 48, 6157 }, // Ă
+    { 10, 16, 14, 2, 16, 35, 6205 }, // ă
+    { 14, 19, 16, 1, 14, 46, 6240 }, // Ą
+    { 11, 15, 14, 2, 10, 34, 6286 }, // ą
+    { 12, 20, 17, 2, 20, 42, 6320 }, // Ć
+    { 9, 14, 13, 2, 14, 25, 6362 }, // ć
+    { 12, 21, 17, 2, 21, 44, 6387 }, // Ĉ
+    { 10, 15, 13, 2, 15, 29, 6431 }, // ĉ
+    { 12, 20, 17, 2, 20, 41, 6460 }, // Ċ
+    { 9, 14, 13, 2, 14, 26, 6501 }, // ċ
+    { 12, 21, 17, 2, 21, 44, 6527 }, // Č
+    { 10, 15, 13, 2, 15, 30, 6571 }, // č
+    { 13, 21, 18, 2, 21, 56, 6601 }, // Ď
+    { 14, 14, 17, 2, 14, 39, 6657 }, // ď
+    { 16, 14, 18, -1, 14, 45, 6696 }, // Đ
+    { 13, 14, 16, 2, 14, 36, 6741 }, // đ
+    { 11, 20, 15, 2, 20, 43, 6777 }, // Ē
+    { 10, 17, 14, 2, 17, 33, 6820 }, // ē
+    { 11, 21, 15, 2, 21, 40, 6853 }, // Ĕ
+    { 10, 17, 14, 2, 17, 36, 6893 }, // ĕ
+    { 11, 20, 15, 2, 20, 38, 6929 }, // Ė
+    { 10, 17, 14, 2, 17, 33, 6967 }, // ė
+    { 11, 19, 15, 2, 14, 39, 7000 }, // Ę
+    { 10, 16, 14, 2, 9, 33, 7039 }, // ę
+    { 11, 22, 15, 2, 22, 43, 7072 }, // Ě
+    { 10, 18, 14, 2, 18, 35, 7115 }, // ě
+    { 15, 23, 19, 2, 23, 60, 7150 }, // Ĝ
+    { 11, 21, 14, 2, 16, 49, 7210 }, // ĝ
+    { 15, 23, 19, 2, 23, 58, 7259 }, // Ğ
+    { 10, 21, 14, 2, 16, 49, 7317 }, // ğ
+    { 15, 22, 19, 2, 22, 58, 7366 }, // Ġ
+    { 10, 20, 14, 2, 15, 47, 7424 }, // ġ
+    { 15, 25, 19, 2, 25, 61, 7471 }, // Ģ
+    { 10, 21, 14, 2, 16, 47, 7532 }, // ģ
+    { 13, 21, 18, 2, 21, 53, 7579 }, // Ĥ
+    { 13, 20, 15, 0, 20, 47, 7632 }, // ĥ
+    { 15, 14, 18, 1, 14, 44, 7679 }, // Ħ
+    { 13, 14, 15, 0, 14, 37, 7723 }, // ħ
+    { 7, 21, 9, 1, 21, 25, 7760 }, // Ĩ
+    { 7, 16, 8, 0, 16, 26, 7785 }, // ĩ
+    { 10, 21, 10, -1, 21, 28, 7811 }, // Ī
+    { 10, 15, 10, -1, 15, 26, 7839 }, // ī
+    { 6, 19, 9, 1, 14, 22, 7865 }, // Į
+    { 6, 20, 8, 1, 15, 27, 7887 }, // į
+    { 5, 21, 9, 2, 21, 23, 7914 }, // İ
+    { 4, 10, 8, 2, 10, 13, 7937 }, // ı
+    { 14, 21, 26, 6, 14, 62, 7950 }, // Ĳ
+    { 10, 19, 13, 2, 15, 44, 8012 }, // ĳ
+    { 12, 25, 15, 2, 21, 43, 8056 }, // Ĵ
+    { 9, 22, 12, 2, 17, 35, 8099 }, // ĵ
+    { 13, 23, 18, 2, 23, 49, 8134 }, // Ķ
+    { 11, 23, 15, 2, 14, 43, 8183 }, // ķ
+    { 9, 9, 11, 1, 9, 22, 8226 }, // ĸ
+    { 11, 19, 15, 2, 19, 30, 8248 }, // Ĺ
+    { 6, 21, 10, 2, 21, 30, 8278 }, // ĺ
+    { 12, 22, 15, 1, 22, 40, 8308 }, // Ļ
+    { 7, 23, 10, 1, 14, 35, 8348 }, // ļ
+    { 11, 14, 15, 2, 14, 29, 8383 }, // Ľ
+    { 8, 17, 11, 2, 17, 31, 8412 }, // ľ
+    { 11, 14, 15, 2, 14, 30, 8443 }, // Ŀ
+    { 8, 14, 11, 2, 14, 30, 8473 }, // ŀ
+    { 19, 26, 15, -5, 20, 59, 8503 }, // Ł
+    { 13, 14, 10, -4, 14, 30, 8562 }, // ł
+    { 13, 20, 17, 2, 20, 59, 8592 }, // Ń
+    { 10, 16, 15, 2, 16, 32, 8651 }, // ń
+    { 13, 21, 17, 2, 14, 62, 8683 }, // Ņ
+    { 10, 17, 15, 2, 10, 37, 8745 }, // ņ
+    { 13, 21, 17, 2, 21, 62, 8782 }, // Ň
+    { 11, 17, 15, 2, 17, 38, 8844 }, // ň
+    { 10, 17, 15, 2, 17, 34, 8882 }, // ŉ
+    { 13, 18, 17, 2, 14, 56, 8916 }, // Ŋ
+    { 10, 14, 15, 2, 10, 30, 8972 }, // ŋ
+    { 15, 21, 19, 2, 20, 49, 9002 }, // Ō
+    { 10, 15, 14, 2, 15, 30, 9051 }, // ō
+    { 15, 21, 19, 2, 20, 53, 9081 }, // Ŏ
+    { 10, 15, 14, 2, 15, 34, 9134 }, // ŏ
+    { 16, 20, 19, 2, 19, 52, 9168 }, // Ő
+    { 15, 14, 17, 1, 14, 38, 9220 }, // ő
+    { 20, 15, 23, 2, 14, 56, 9258 }, // Œ
+    { 17, 9, 20, 2, 9, 38, 9314 }, // œ
+    { 12, 20, 16, 2, 19, 47, 9352 }, // Ŕ
+    { 8, 14, 12, 2, 14, 22, 9399 }, // ŕ
+    { 12, 24, 16, 2, 23, 50, 9421 }, // Ŗ
+    { 8, 17, 12, 2, 17, 29, 9471 }, // ŗ
+    { 12, 22, 16, 2, 21, 53, 9500 }, // Ř
+    { 9, 15, 12, 1, 15, 27, 9553 }, // ř
+    { 14, 21, 18, 2, 20, 47, 9580 }, // Ś
+    { 10, 15, 14, 2, 14, 26, 9627 }, // ś
+    { 14, 22, 18, 2, 21, 48, 9653 }, // Ŝ
+    { 10, 16, 14, 2, 15, 30, 9701 }, // ŝ
+    { 14, 19, 18, 2, 15, 45, 9731 }, // Ş
+    { 10, 14, 14, 2, 10, 27, 9776 }, // ş
+    { 14, 22, 18, 2, 21, 51, 9803 }, // Š
+    { 10, 16, 14, 2, 15, 33, 9854 }, // š
+    { 13, 19, 18, 2, 14, 42, 9887 }, // Ţ
+    { 9, 17, 13, 2, 13, 29, 9929 }, // ţ
+    { 13, 21, 18, 2, 21, 43, 9958 }, // Ť
+    { 12, 16, 15, 2, 15, 33, 10001 }, // ť
+    { 13, 14, 18, 2, 14, 29, 10034 }, // Ŧ
+    { 10, 14, 13, 1, 13, 23, 10063 }, // ŧ
+    { 13, 22, 17, 2, 21, 52, 10086 }, // Ũ
+    { 10, 15, 14, 2, 15, 34, 10138 }, // ũ
+    { 13, 22, 17, 2, 21, 47, 10172 }, // Ū
+    { 10, 15, 14, 2, 15, 34, 10219 }, // ū
+    { 13, 22, 17, 2, 21, 49, 10253 }, // Ŭ
+    { 10, 16, 14, 2, 16, 35, 10302 }, // ŭ
+    { 13, 23, 17, 2, 22, 50, 10337 }, // Ů
+    { 10, 16, 14, 2, 16, 32, 10387 }, // ů
+    { 15, 21, 18, 2, 20, 50, 10419 }, // Ű
+    { 15, 14, 17, 1, 14, 39, 10469 }, // ű
+    { 13, 19, 17, 2, 14, 45, 10508 }, // Ų
+    { 10, 14, 14, 2, 9, 33, 10553 }, // ų
+    { 20, 21, 24, 2, 21, 73, 10586 }, // Ŵ
+    { 14, 19, 19, 2, 17, 47, 10659 }, // ŵ
+    { 14, 22, 18, 2, 22, 45, 10706 }, // Ŷ
+    { 11, 23, 15, 2, 18, 45, 10751 }, // ŷ
+    { 14, 22, 18, 2, 22, 49, 10796 }, // Ÿ
+    { 14, 19, 18, 2, 19, 43, 10845 }, // Ź
+    { 11, 15, 15, 2, 15, 25, 10888 }, // ź
+    { 14, 19, 18, 2, 19, 45, 10913 }, // Ż
+    { 11, 15, 15, 2, 15, 26, 10958 }, // ż
+    { 14, 21, 18, 2, 21, 45, 10984 }, // Ž
+    { 11, 17, 15, 2, 17, 27, 11029 }, // ž
+    { 7, 15, 10, 1, 14, 19, 11056 }, // ſ
+    { 16, 17, 19, 2, 16, 46, 11075 }, // Ơ
+    { 12, 11, 15, 2, 11, 28, 11121 }, // ơ
+    { 14, 15, 15, -1, 15, 39, 11149 }, // Ƥ
+    { 12, 18, 16, 2, 13, 43, 11188 }, // ƥ
+    { 10, 14, 11, 0, 13, 24, 11231 }, // Ʃ
+    { 14, 14, 18, 1, 14, 33, 11255 }, // Ƭ
+    { 9, 17, 13, 2, 16, 27, 11288 }, // ƭ
+    { 13, 17, 18, 2, 14, 35, 11315 }, // Ʈ
+    { 15, 18, 18, 2, 17, 43, 11350 }, // Ư
+    { 12, 12, 15, 2, 12, 32, 11393 }, // ư
+    { 7, 4, 8, 0, 13, 6, 11425 }, // ̀
+    { 5, 4, 6, 0, 13, 7, 11431 }, // ́
+    { 10, 5, 11, 0, 1, 12, 11438 }, // ̂
+    { 7, 4, 8, 0, 12, 12, 11450 }, // ̃
+    { 10, 3, 11, 0, 12, 8, 11462 }, // ̄
+    { 12, 3, 13, 0, 15, 10, 11470 }, // ̅
+    { 9, 5, 10, 0, 13, 8, 11480 }, // ̆
+    { 5, 4, 8, 2, 14, 6, 11488 }, // ̇
+    { 8, 4, 9, 0, 13, 10, 11494 }, // ̈
+    { 4, 4, 8, 3, 11, 6, 11504 }, // ̉
+    { 5, 4, 6, 0, 13, 8, 11510 }, // ̊
+    { 15, 4, 16, 0, 13, 11, 11518 }, // ̋
+    { 10, 5, 11, 0, 13, 11, 11529 }, // ̌
+    { 15, 4, 12, -4, 13, 10, 11540 }, // ̏
+    { 6, 6, 7, 0, 13, 9, 11550 }, // ̒
+    { 6, 6, 7, 0, 13, 12, 11559 }, // ̓
+    { 6, 6, 6, -1, 13, 10, 11571 }, // ̔
+    { 5, 5, 6, 0, 0, 9, 11581 }, // ̘
+    { 5, 5, 6, 0, 0, 8, 11590 }, // ̙
+    { 9, 5, 10, 0, 14, 11, 11598 }, // ̚
+    { 4, 5, 5, 0, 11, 9, 11609 }, // ̛
+    { 4, 6, 5, 0, 0, 8, 11618 }, // ̜
+    { 6, 4, 7, 0, 3, 5, 11626 }, // ̝
+    { 6, 4, 7, 0, 0, 5, 11631 }, // ̞
+    { 4, 5, 6, 1, -1, 6, 11636 }, // ̟
+    { 10, 3, 11, 0, -2, 10, 11642 }, // ̠
+    { 5, 4, 6, 0, 2, 7, 11652 }, // ̣
+    { 8, 4, 9, 0, -1, 9, 11659 }, // ̤
+    { 5, 4, 6, 0, 13, 8, 11668 }, // ̥
+    { 6, 6, 7, 0, 3, 10, 11676 }, // ̦
+    { 5, 6, 6, 0, 1, 10, 11686 }, // ̧
+    { 5, 6, 7, 1, 1, 9, 11696 }, // ̨
+    { 4, 6, 5, 0, 0, 10, 11705 }, // ̩
+    { 7, 4, 8, 0, 0, 8, 11715 }, // ̪
+    { 11, 5, 11, -1, 1, 13, 11723 }, // ̬
+    { 11, 5, 11, -1, 1, 10, 11736 }, // ̭
+    { 7, 4, 9, 1, 14, 10, 11746 }, // ̰
+    { 9, 3, 10, 0, 14, 6, 11756 }, // ̱
+    { 9, 3, 10, 0, -1, 9, 11762 }, // ̲
+    { 7, 4, 9, 1, 14, 10, 11771 }, // ̴
+    { 9, 2, 10, 0, 6, 3, 11781 }, // ̵
+    { 4, 6, 5, 0, 0, 8, 11784 }, // ̹
+    { 8, 6, 9, 0, 1, 14, 11792 }, // ̺
+    { 7, 6, 8, 0, 1, 15, 11806 }, // ̻
+    { 7, 5, 8, 0, 1, 14, 11821 }, // ̼
+    { 6, 4, 8, 1, 13, 8, 11835 }, // ̽
+    { 7, 4, 8, 0, 12, 12, 11843 }, // ͂
+    { 3, 5, 8, 4, 15, 6, 11855 }, // ̓
+    { 9, 12, 10, 0, 21, 18, 11861 }, // ̈́
+    { 7, 4, 8, 0, 14, 8, 11879 }, // ͆
+    { 10, 7, 11, 0, 0, 14, 11887 }, // ͇
+    { 8, 5, 9, 0, 0, 16, 11901 }, // ͈
+    { 7, 6, 8, 0, 0, 11, 11917 }, // ͉
+    { 8, 13, 10, 1, 18, 21, 11928 }, // ͊
+    { 16, 13, 17, 0, 19, 35, 11949 }, // ͋
+    { 10, 10, 18, 7, 10, 32, 11984 }, // ͌
+    { 9, 4, 11, 1, -2, 7, 12016 }, // ͍
+    { 4, 3, 5, 0, 2, 5, 12023 }, // ͎
+    { 15, 5, 16, 0, 1, 15, 12028 }, // ͜
+    { 15, 5, 16, 0, 14, 14, 12043 }, // ͡
+    { 19, 6, 20, 0, 0, 13, 12057 }, // ͢
+    { 14, 14, 16, 1, 14, 36, 12070 }, // Α
+    { 12, 14, 16, 2, 14, 43, 12106 }, // Β
+    { 9, 15, 10, 0, 13, 24, 12149 }, // Γ
+    { 14, 14, 15, 0, 13, 40, 12173 }, // Δ
+    { 11, 14, 15, 2, 14, 31, 12213 }, // Ε
+    { 14, 14, 18, 2, 14, 34, 12244 }, // Ζ
+    { 13, 14, 18, 2, 14, 40, 12278 }, // Η
+    { 15, 15, 19, 2, 14, 48, 12318 }, // Θ
+    { 5, 14, 9, 2, 14, 15, 12366 }, // Ι
+    { 13, 14, 18, 2, 14, 34, 12381 }, // Κ
+    { 15, 14, 19, 2, 14, 38, 12415 }, // Λ
+    { 15, 14, 19, 2, 14, 52, 12453 }, // Μ
+    { 13, 14, 17, 2, 14, 50, 12505 }, // Ν
+    { 12, 14, 13, 0, 13, 24, 12555 }, // Ξ
+    { 15, 15, 19, 2, 14, 41, 12579 }, // Ο
+    { 10, 13, 11, 0, 12, 33, 12620 }, // Π
+    { 11, 15, 15, 2, 15, 31, 12653 }, // Ρ
+    { 10, 14, 11, 0, 13, 24, 12684 }, // Σ
+    { 13, 14, 18, 2, 14, 30, 12708 }, // Τ
+    { 14, 14, 18, 2, 14, 33, 12738 }, // Υ
+    { 17, 19, 23, 3, 16, 58, 12771 }, // Φ
+    { 14, 14, 19, 2, 14, 36, 12829 }, // Χ
+    { 13, 16, 14, 0, 14, 52, 12865 }, // Ψ
+    { 13, 15, 15, 1, 13, 45, 12917 }, // Ω
+    { 12, 11, 16, 2, 10, 30, 12962 }, // α
+    { 11, 20, 12, 0, 16, 46, 12992 }, // β
+    { 11, 15, 12, 0, 9, 31, 13038 }, // γ
+    { 11, 16, 12, 0, 15, 39, 13069 }, // δ
+    { 8, 9, 10, 1, 9, 17, 13108 }, // ε
+    { 9, 16, 10, 0, 13, 26, 13125 }, // ζ
+    { 12, 16, 13, 0, 10, 36, 13151 }, // η
+    { 11, 14, 12, 0, 13, 36, 13187 }, // θ
+    { 6, 12, 10, 2, 12, 19, 13223 }, // ι
+    { 10, 9, 12, 1, 9, 21, 13242 }, // κ
+    { 11, 14, 14, 2, 14, 31, 13263 }, // λ
+    { 11, 11, 14, 1, 9, 30, 13294 }, // μ
+    { 11, 11, 12, 0, 9, 26, 13324 }, // ν
+    { 9, 16, 10, 0, 13, 26, 13350 }, // ξ
+    { 10, 9, 14, 2, 9, 23, 13376 }, // ο
+    { 12, 10, 13, 0, 9, 28, 13399 }, // π
+    { 12, 14, 13, 0, 10, 34, 13427 }, // ρ
+    { 9, 13, 10, 0, 13, 20, 13461 }, // ς
+    { 12, 9, 16, 2, 9, 25, 13481 }, // σ
+    { 11, 10, 12, 0, 9, 15, 13506 }, // τ
+    { 9, 10, 10, 0, 9, 27, 13521 }, // υ
+    { 15, 22, 19, 2, 18, 66, 13548 }, // φ
+    { 13, 15, 14, 0, 10, 36, 13614 }, // χ
+    { 11, 20, 12, 0, 13, 50, 13650 }, // ψ
+    { 14, 11, 15, 0, 10, 35, 13700 }, // ω
+    { 14, 19, 16, 1, 14, 47, 13735 }, // Ạ
+    { 10, 16, 14, 2, 10, 34, 13782 }, // ạ
+    { 14, 20, 16, 1, 20, 46, 13816 }, // Ả
+    { 10, 16, 14, 2, 16, 33, 13862 }, // ả
+    { 14, 25, 16, 1, 25, 58, 13895 }, // Ấ
+    { 11, 18, 14, 2, 18, 45, 13953 }, // ấ
+    { 16, 21, 16, -1, 21, 56, 13998 }, // Ầ
+    { 15, 18, 14, -3, 18, 46, 14054 }, // ầ
+    { 14, 26, 16, 1, 26, 58, 14100 }, // Ẩ
+    { 12, 19, 15, 2, 19, 45, 14158 }, // ẩ
+    { 14, 24, 16, 1, 24, 59, 14203 }, // Ẫ
+    { 10, 19, 14, 2, 19, 44, 14262 }, // ẫ
+    { 14, 25, 16, 1, 20, 60, 14306 }, // Ậ
+    { 10, 22, 14, 2, 16, 45, 14366 }, // ậ
+    { 14, 25, 16, 1, 25, 56, 14411 }, // Ắ
+    { 10, 21, 14, 2, 21, 42, 14467 }, // ắ
+    { 14, 25, 16, 1, 25, 56, 14509 }, // Ằ
+    { 10, 21, 14, 2, 21, 42, 14565 }, // ằ
+    { 14, 26, 16, 1, 26, 57, 14607 }, // Ẳ
+    { 10, 23, 14, 2, 23, 45, 14664 }, // ẳ
+    { 14, 26, 16, 1, 26, 61, 14709 }, // Ẵ
+    { 10, 21, 14, 2, 21, 45, 14770 }, // ẵ
+    { 14, 25, 16, 1, 20, 59, 14815 }, // Ặ
+    { 10, 22, 14, 2, 16, 44, 14874 }, // ặ
+    { 11, 21, 15, 2, 14, 40, 14918 }, // Ẹ
+    { 10, 16, 14, 2, 9, 32, 14958 }, // ẹ
+    { 11, 21, 15, 2, 21, 38, 14990 }, // Ẻ
+    { 10, 17, 14, 2, 17, 32, 15028 }, // ẻ
+    { 11, 21, 15, 2, 21, 44, 15060 }, // Ẽ
+    { 10, 17, 14, 2, 17, 36, 15104 }, // ẽ
+    { 14, 21, 17, 2, 21, 50, 15140 }, // Ế
+    { 13, 17, 16, 2, 17, 42, 15190 }, // ế
+    { 14, 22, 15, -1, 22, 50, 15232 }, // Ề
+    { 13, 19, 14, -1, 19, 43, 15282 }, // ề
+    { 11, 23, 15, 2, 23, 47, 15325 }, // Ể
+    { 12, 20, 15, 2, 20, 43, 15372 }, // ể
+    { 11, 24, 15, 2, 24, 54, 15415 }, // Ễ
+    { 10, 21, 14, 2, 21, 43, 15469 }, // ễ
+    { 11, 28, 15, 2, 21, 49, 15512 }, // Ệ
+    { 10, 24, 14, 2, 17, 43, 15561 }, // ệ
+    { 5, 22, 9, 2, 22, 20, 15604 }, // Ỉ
+    { 4, 16, 8, 2, 16, 17, 15624 }, // ỉ
+    { 5, 21, 9, 2, 14, 22, 15641 }, // Ị
+    { 4, 22, 8, 2, 15, 25, 15663 }, // ị
+    { 15, 22, 19, 2, 14, 51, 15688 }, // Ọ
+    { 10, 16, 14, 2, 9, 32, 15739 }, // ọ
+    { 15, 21, 19, 2, 20, 50, 15771 }, // Ỏ
+    { 10, 15, 14, 2, 15, 31, 15821 }, // ỏ
+    { 15, 21, 19, 2, 20, 57, 15852 }, // Ố
+    { 13, 16, 16, 2, 16, 42, 15909 }, // ố
+    { 17, 22, 19, 0, 21, 59, 15951 }, // Ồ
+    { 13, 17, 14, -1, 17, 42, 16010 }, // ồ
+    { 15, 23, 19, 2, 22, 58, 16052 }, // Ổ
+    { 12, 18, 15, 2, 18, 44, 16110 }, // ổ
+    { 15, 25, 19, 2, 24, 65, 16154 }, // Ỗ
+    { 10, 19, 14, 2, 19, 43, 16219 }, // ỗ
+    { 15, 28, 19, 2, 20, 61, 16262 }, // Ộ
+    { 10, 22, 14, 2, 15, 43, 16323 }, // ộ
+    { 16, 21, 19, 2, 20, 54, 16366 }, // Ớ
+    { 12, 15, 15, 2, 15, 36, 16420 }, // ớ
+    { 16, 21, 19, 2, 20, 55, 16456 }, // Ờ
+    { 12, 15, 15, 2, 15, 35, 16511 }, // ờ
+    { 16, 21, 19, 2, 20, 53, 16546 }, // Ở
+    { 12, 15, 15, 2, 15, 36, 16599 }, // ở
+    { 16, 21, 19, 2, 20, 60, 16635 }, // Ỡ
+    { 12, 16, 15, 2, 16, 41, 16695 }, // ỡ
+    { 16, 24, 19, 2, 16, 57, 16736 }, // Ợ
+    { 12, 18, 15, 2, 11, 37, 16793 }, // ợ
+    { 13, 22, 17, 2, 14, 46, 16830 }, // Ụ
+    { 10, 17, 14, 2, 9, 36, 16876 }, // ụ
+    { 13, 22, 17, 2, 21, 47, 16912 }, // Ủ
+    { 10, 15, 14, 2, 15, 32, 16959 }, // ủ
+    { 15, 22, 18, 2, 21, 50, 16991 }, // Ứ
+    { 12, 15, 15, 2, 15, 40, 17041 }, // ứ
+    { 15, 22, 18, 2, 21, 51, 17081 }, // Ừ
+    { 12, 15, 15, 2, 15, 38, 17132 }, // ừ
+    { 15, 22, 18, 2, 21, 51, 17170 }, // Ử
+    { 12, 15, 15, 2, 15, 39, 17221 }, // ử
+    { 15, 22, 18, 2, 21, 57, 17260 }, // Ữ
+    { 12, 15, 15, 2, 15, 40, 17317 }, // ữ
+    { 15, 25, 18, 2, 17, 53, 17357 }, // Ự
+    { 12, 20, 15, 2, 12, 43, 17410 }, // ự
+    { 14, 21, 18, 2, 21, 43, 17453 }, // Ỳ
+    { 11, 21, 15, 2, 16, 39, 17496 }, // ỳ
+    { 14, 23, 18, 2, 14, 47, 17535 }, // Ỵ
+    { 13, 16, 16, 2, 9, 40, 17582 }, // ỵ
+    { 14, 23, 18, 2, 23, 44, 17622 }, // Ỷ
+    { 11, 23, 15, 2, 18, 41, 17666 }, // ỷ
+    { 14, 23, 18, 2, 23, 48, 17707 }, // Ỹ
+    { 11, 22, 15, 2, 17, 43, 17755 }, // ỹ
+    { 0, 0, 11, 0, 0, 0, 17798 }, //  
+    { 0, 0, 19, 0, 0, 0, 17798 }, //  
+    { 0, 0, 11, 0, 0, 0, 17798 }, //  
+    { 0, 0, 19, 0, 0, 0, 17798 }, //  
+    { 0, 0, 8, 0, 0, 0, 17798 }, //  
+    { 0, 0, 7, 0, 0, 0, 17798 }, //  
+    { 0, 0, 5, 0, 0, 0, 17798 }, //  
+    { 0, 0, 12, 0, 0, 0, 17798 }, //  
+    { 0, 0, 4, 0, 0, 0, 17798 }, //  
+    { 0, 0, 6, 0, 0, 0, 17798 }, //  
+    { 0, 0, 5, 0, 0, 0, 17798 }, //  
+    { 0, 0, 3, 0, 0, 0, 17798 }, // ​
+    { 0, 0, 1, 0, 0, 0, 17798 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 17798 }, // ‍
+    { 0, 0, 1, 0, 0, 0, 17798 }, // ‎
+    { 0, 0, 1, 0, 0, 0, 17798 }, // ‏
+    { 9, 2, 10, 0, 6, 3, 17798 }, // ‐
+    { 9, 2, 10, 0, 6, 3, 17801 }, // ‑
+    { 13, 2, 12, -2, 6, 4, 17804 }, // ‒
+    { 13, 4, 14, 0, 7, 12, 17808 }, // –
+    { 18, 4, 19, 0, 7, 16, 17820 }, // —
+    { 18, 4, 19, 0, 7, 16, 17836 }, // ―
+    { 8, 16, 11, 2, 13, 39, 17852 }, // ‖
+    { 15, 6, 13, -3, -1, 14, 17891 }, // ‗
+    { 6, 6, 8, 1, 15, 10, 17905 }, // ‘
+    { 6, 6, 8, 1, 15, 10, 17915 }, // ’
+    { 6, 6, 7, 0, 3, 10, 17925 }, // ‚
+    { 6, 6, 8, 1, 15, 10, 17935 }, // ‛
+    { 11, 6, 13, 1, 15, 21, 17945 }, // “
+    { 11, 6, 13, 1, 15, 22, 17966 }, // ”
+    { 6, 6, 7, 0, 3, 10, 17988 }, // „
+    { 11, 6, 13, 1, 15, 21, 17998 }, // ‟
+    { 10, 24, 13, 2, 18, 39, 18019 }, // †
+    { 10, 23, 14, 3, 17, 37, 18058 }, // ‡
+    { 14, 13, 12, -3, 15, 37, 18095 }, // •
+    { 6, 7, 10, 2, 8, 10, 18132 }, // ‣
+    { 4, 4, 10, 3, 4, 6, 18142 }, // ․
+    { 4, 4, 10, 3, 4, 6, 18148 }, // ‥
+    { 16, 4, 17, 0, 4, 20, 18154 }, // …
+    { 3, 2, 9, 3, 6, 3, 18174 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 18177 }, //  
+    { 13, 15, 19, 3, 13, 54, 18177 }, // ‰
+    { 7, 6, 10, 2, 15, 10, 18231 }, // ′
+    { 12, 6, 15, 2, 15, 21, 18241 }, // ″
+    { 13, 6, 15, 1, 14, 21, 18262 }, // ‴
+    { 5, 6, 7, 1, 14, 6, 18283 }, // ‵
+    { 8, 6, 9, 0, 14, 13, 18289 }, // ‶
+    { 13, 6, 11, -3, 14, 21, 18302 }, // ‷
+    { 10, 4, 11, 0, 14, 12, 18323 }, // ‸
+    { 5, 10, 7, 1, 10, 14, 18335 }, // ‹
+    { 6, 10, 7, 0, 10, 15, 18349 }, // ›
+    { 18, 22, 23, 3, 17, 71, 18364 }, // ※
+    { 6, 22, 10, 2, 19, 28, 18435 }, // ‼
+    { 11, 27, 14, 1, 23, 47, 18463 }, // ‽
+    { 9, 2, 10, 0, 14, 3, 18510 }, // ‾
+    { 9, 5, 10, 0, 12, 8, 18513 }, // ‿
+    { 13, 12, 13, -1, 15, 37, 18521 }, // ⁂
+    { 11, 15, 21, 5, 13, 23, 18558 }, // ⁄
+    { 21, 21, 25, 2, 19, 69, 18581 }, // ⁇
+    { 18, 22, 20, 1, 19, 61, 18650 }, // ⁈
+    { 14, 22, 14, -1, 19, 62, 18711 }, // ⁉
+    { 13, 29, 15, 1, 20, 69, 18773 }, // ⁒
+    { 0, 0, 78, 0, 0, 0, 18842 }, //  
+    { 5, 7, 6, 0, 14, 16, 18842 }, // ⁰
+    { 6, 6, 7, 0, 14, 11, 18858 }, // ⁴
+    { 6, 8, 7, 0, 14, 12, 18869 }, // ⁵
+    { 6, 7, 7, 0, 14, 12, 18881 }, // ⁶
+    { 6, 8, 7, 0, 15, 11, 18893 }, // ⁷
+    { 6, 7, 7, 0, 14, 13, 18904 }, // ⁸
+    { 6, 8, 7, 0, 14, 16, 18917 }, // ⁹
+    { 10, 10, 15, 2, 10, 24, 18933 }, // ⁿ
+    { 6, 7, 7, 0, 4, 15, 18957 }, // ₀
+    { 5, 7, 6, 0, 4, 11, 18972 }, // ₁
+    { 6, 7, 7, 0, 4, 11, 18983 }, // ₂
+    { 6, 7, 7, 0, 4, 12, 18994 }, // ₃
+    { 6, 7, 7, 0, 4, 12, 19006 }, // ₄
+    { 5, 8, 6, 0, 5, 11, 19018 }, // ₅
+    { 6, 7, 7, 0, 4, 15, 19029 }, // ₆
+    { 6, 8, 7, 0, 5, 11, 19044 }, // ₇
+    { 6, 7, 7, 0, 4, 18, 19055 }, // ₈
+    { 6, 8, 7, 0, 4, 17, 19073 }, // ₉
+    { 7, 23, 9, 1, 17, 34, 19090 }, // ₍
+    { 8, 23, 8, -1, 17, 36, 19124 }, // ₎
+    { 12, 22, 17, 2, 18, 64, 19160 }, // ₡
+    { 12, 15, 17, 2, 15, 38, 19224 }, // ₢
+    { 12, 14, 13, 0, 13, 34, 19262 }, // ₤
+    { 19, 14, 19, -1, 14, 50, 19296 }, // ₦
+    { 15, 15, 16, 0, 15, 38, 19346 }, // ₧
+    { 18, 15, 22, 2, 14, 62, 19384 }, // ₨
+    { 14, 14, 15, 0, 14, 41, 19446 }, // ₩
+    { 14, 13, 18, 2, 13, 58, 19487 }, // ₪
+    { 12, 14, 12, -1, 13, 41, 19545 }, // ₫
+    { 12, 17, 13, 0, 14, 31, 19586 }, // €
+    { 13, 14, 18, 2, 14, 32, 19617 }, // ₮
+    { 17, 15, 17, -1, 15, 44, 19649 }, // ₱
+    { 15, 21, 19, 2, 18, 61, 19693 }, // ₲
+    { 17, 15, 21, 3, 14, 37, 19754 }, // ₴
+    { 9, 13, 12, 2, 11, 26, 19791 }, // ₵
+    { 14, 16, 18, 2, 16, 35, 19817 }, // ₸
+    { 9, 13, 12, 1, 12, 21, 19852 }, // ₹
+    { 11, 13, 12, 0, 11, 31, 19873 }, // ₺
+    { 12, 14, 14, 1, 14, 45, 19904 }, // ₼
+    { 15, 15, 15, -2, 15, 39, 19949 }, // ₽
+    { 12, 11, 13, 0, 9, 21, 19988 }, // ←
+    { 13, 12, 14, 0, 10, 33, 20009 }, // ↑
+    { 12, 11, 13, 0, 9, 21, 20042 }, // →
+    { 13, 12, 14, 0, 11, 33, 20063 }, // ↓
+    { 14, 9, 17, 2, 9, 29, 20096 }, // ↔
+    { 10, 14, 13, 2, 15, 33, 20125 }, // ↕
+    { 10, 10, 13, 2, 10, 20, 20158 }, // ↖
+    { 10, 10, 11, 0, 10, 28, 20178 }, // ↗
+    { 10, 10, 11, 0, 9, 24, 20206 }, // ↘
+    { 10, 10, 11, 0, 9, 20, 20230 }, // ↙
+    { 13, 12, 16, 2, 10, 30, 20250 }, // ⇐
+    { 14, 14, 18, 2, 13, 52, 20280 }, // ⇑
+    { 13, 12, 16, 2, 10, 29, 20332 }, // ⇒
+    { 14, 14, 18, 2, 13, 52, 20361 }, // ⇓
+    { 15, 12, 18, 2, 10, 37, 20413 }, // ⇔
+    { 11, 15, 15, 2, 9, 40, 20450 }, // ⇕
+    { 11, 16, 12, 0, 15, 36, 20490 }, // ∂
+    { 18, 16, 19, 0, 15, 51, 20526 }, // ∅
+    { 14, 14, 15, 0, 13, 40, 20577 }, // ∆
+    { 12, 14, 13, 0, 13, 40, 20617 }, // ∏
+    { 12, 14, 13, 0, 13, 40, 20657 }, // ∐
+    { 10, 14, 11, 0, 13, 24, 20697 }, // ∑
+    { 10, 3, 11, 0, 6, 9, 20721 }, // −
+    { 14, 15, 16, 1, 14, 32, 20730 }, // √
+    { 15, 10, 16, 0, 11, 34, 20762 }, // ∞
+    { 14, 18, 15, 0, 13, 39, 20796 }, // ∫
+    { 5, 12, 6, 0, 12, 13, 20835 }, // ∶
+    { 10, 10, 24, 7, 10, 32, 20848 }, // ≈
+    { 13, 15, 21, 4, 14, 31, 20880 }, // ≠
+    { 15, 15, 15, -1, 13, 37, 20911 }, // ≤
+    { 15, 14, 16, 0, 12, 39, 20948 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_8_boldIntervals[] = {
@@ -2448,4 +2056,5 @@ static const EpdFontData opendyslexic_8_bold = {
     22,
     -9,
     true,
+    true,
 };
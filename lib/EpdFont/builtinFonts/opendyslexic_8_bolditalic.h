@@ -2,2723 +2,2081 @@
  * generated by fontconvert.py
  * name: opendyslexic_8_bolditalic
  * size: 8
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_8_bolditalic 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py opendyslexic_8_bolditalic 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_bolditalicBitmaps[32735] = {
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0xD0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00,
-    0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xD0, 0x02,
-    0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xA8, 0x00, 0x2A, 0x4A, 0xA0, 0x3F, 0x8B, 0xF0, 0x3F, 0x87, 0xF0,
-    0x2F, 0xC3, 0xF0, 0x1F, 0xC3, 0xF8, 0x0F, 0xD2, 0xFC, 0x00, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x00,
-    0x2F, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x15, 0xFD, 0x6F, 0x55, 0x40, 0x00, 0x3E,
-    0x0F, 0x80, 0x00, 0x00, 0x2F, 0x47, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x57, 0xF5, 0xFD, 0x55, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x1F,
-    0x40, 0x00, 0x00, 0x2A, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0x7E, 0x00, 0x0F,
-    0xD0, 0xF0, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0xFE, 0x6E, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x1D, 0x02, 0xFF, 0xC1, 0xFF, 0xAF, 0xFD,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x1B, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xB4, 0x02, 0xF8, 0x02, 0xE0, 0x0B,
-    0x1C, 0x07, 0xC0, 0x0D, 0x1C, 0x1F, 0x00, 0x1C, 0x3C, 0x3C, 0x00, 0x1F, 0xF4, 0xF4, 0x00, 0x0B,
-    0xD3, 0xD0, 0x00, 0x00, 0x0F, 0x9F, 0xD0, 0x00, 0x2F, 0x78, 0xE0, 0x00, 0xBC, 0xB0, 0xE0, 0x01,
-    0xF0, 0xE1, 0xD0, 0x07, 0xD0, 0xFF, 0xC0, 0x0F, 0x80, 0x3E, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x0F, 0x5B, 0x40, 0x03, 0xC0, 0x3C, 0x00, 0x3C, 0x03, 0x80, 0x03, 0xC1, 0xF4,
-    0x00, 0x1F, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x14, 0x1F, 0x8F, 0x4B, 0xC3, 0xF0,
-    0x3E, 0xF4, 0x3F, 0x01, 0xFF, 0x03, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFD, 0x00, 0x7F, 0xE0, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x2F, 0xC7, 0xF0, 0xFC, 0x3F, 0x86, 0xA0, 0x00, 0x00, 0xB8, 0x00,
-    0x02, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF4,
-    0x00, 0x03, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0,
-    0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0,
-    0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x63, 0xC7, 0x07, 0xFF, 0xFC, 0x0B, 0xFF, 0x40, 0x1F,
-    0xFE, 0x03, 0xFF, 0xFE, 0x0B, 0x3C, 0xA0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x2F, 0xFF, 0xF3, 0xFF, 0xFE, 0x00, 0xF4, 0x00, 0x0F,
-    0x00, 0x01, 0xF0, 0x00, 0x04, 0x00, 0x02, 0xA4, 0x1F, 0xD0, 0xBE, 0x03, 0xF0, 0x3F, 0x81, 0xFC,
-    0x00, 0x3F, 0xFF, 0xC7, 0xFF, 0xFC, 0x0A, 0x4B, 0xD3, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x00,
-    0xBE, 0xF4, 0x02, 0xF0, 0x3C, 0x07, 0xC0, 0x3C, 0x0F, 0xDE, 0x3C, 0x0F, 0x7E, 0x7C, 0x1F, 0x3D,
-    0xF8, 0x2F, 0x3C, 0xF8, 0x3F, 0x02, 0xF0, 0x3F, 0x4B, 0xF0, 0x3F, 0xFF, 0xD0, 0x3F, 0xFF, 0x80,
-    0x1F, 0xFE, 0x00, 0x06, 0xE4, 0x00, 0x00, 0x06, 0x80, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x0D, 0xF4,
-    0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x1F,
-    0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xFF, 0x40, 0x0F, 0x97,
-    0xF0, 0x01, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x7F,
-    0xC0, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xFF, 0x40, 0x09, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x7D, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xF8, 0x02,
-    0xE6, 0xFD, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x40, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x07, 0xD0, 0x00, 0x7F, 0x00, 0x07, 0xFC, 0x00, 0x7A, 0xF0, 0x07, 0x8F, 0x80, 0x7C, 0x3D,
-    0x07, 0xEB, 0xFD, 0x3F, 0xFF, 0xF4, 0xAA, 0xFF, 0xC0, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0xF0, 0x00,
-    0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x01, 0x41, 0xF8, 0x00,
-    0x00, 0xF8, 0x09, 0x07, 0xF4, 0x1F, 0xFF, 0xF0, 0x2F, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x7F, 0xFD, 0x02, 0xF9, 0x54, 0x03, 0xC0, 0x00, 0x0F, 0xBF, 0x80,
-    0x1F, 0xFF, 0xE0, 0x2F, 0xD7, 0xF0, 0x3F, 0x41, 0xF0, 0x3E, 0x01, 0xF0, 0x3E, 0x03, 0xF0, 0x3F,
-    0xAF, 0xD0, 0x2F, 0xFF, 0x80, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x7F, 0xFF, 0xC0,
-    0x00, 0xFC, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x3F,
-    0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x0B, 0xFF, 0xC0,
-    0x0B, 0xD1, 0xF0, 0x03, 0xD0, 0x3C, 0x01, 0xF4, 0x7F, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0x40,
-    0x0F, 0xD7, 0xF0, 0x0F, 0xC0, 0x7D, 0x07, 0xE0, 0x2F, 0x01, 0xF8, 0x1F, 0xC0, 0x7F, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xE0, 0x00, 0x6E, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0xF8, 0x03, 0xD0, 0x7C,
-    0x0B, 0x40, 0x3C, 0x0F, 0x00, 0x3C, 0x0E, 0x00, 0xFC, 0x0F, 0x9B, 0xF8, 0x0F, 0xFF, 0xF4, 0x02,
-    0xFF, 0xF0, 0x00, 0x03, 0xE0, 0x3A, 0xAF, 0xC0, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x80, 0xFD, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0xBE, 0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x02, 0xFC, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F,
-    0x80, 0x1F, 0xC0, 0x0F, 0xD0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0x90, 0x00, 0x07, 0xFF, 0xFE, 0x40, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x15, 0x50,
-    0x3F, 0xFF, 0x82, 0xFF, 0xFA, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1B, 0xFE,
-    0x00, 0x6F, 0xFF, 0xF8, 0x1F, 0xFF, 0xE4, 0x00, 0xBF, 0x90, 0x00, 0x03, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xD0, 0xFC, 0x00, 0x40, 0x1F,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xFC,
-    0x00, 0x0B, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x24, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0xBE, 0xAF, 0x00, 0x00, 0x3E, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x01, 0xC0, 0x03, 0xC7, 0xF4, 0x0C,
-    0x00, 0xB4, 0xD7, 0x00, 0xC0, 0x0F, 0x30, 0x70, 0x2C, 0x01, 0xF3, 0xFF, 0x0B, 0x40, 0x2F, 0x2F,
-    0xFB, 0xD0, 0x02, 0xF4, 0x01, 0x90, 0x00, 0x1F, 0xE0, 0x14, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xCF, 0x80, 0x00,
-    0xF8, 0xF8, 0x00, 0x2F, 0x0F, 0xC0, 0x07, 0xE0, 0xFC, 0x00, 0xFC, 0x0F, 0xC0, 0x2F, 0xFF, 0xFC,
-    0x07, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x3F, 0x80, 0x0F, 0xE7, 0xF0, 0x00, 0xFE, 0x00, 0xFF,
-    0xF8, 0x00, 0x1F, 0xFF, 0xF0, 0x02, 0xF4, 0x1F, 0x40, 0x3F, 0x00, 0xF4, 0x03, 0xE0, 0x1F, 0x00,
-    0x7E, 0x5B, 0xE0, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x1F, 0x80, 0x3F, 0x02, 0xF4, 0x03,
-    0xF0, 0x3F, 0xAA, 0xFE, 0x03, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF8, 0x0B, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0xBF,
-    0x90, 0x10, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x20, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0xFF, 0xF0, 0x03, 0xF0, 0x07, 0xF4, 0x03, 0xF0, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0xF8,
-    0x0B, 0xD0, 0x00, 0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x1F, 0x80, 0x07, 0xF0, 0x2F, 0x80, 0x6F, 0xD0,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x90, 0x00,
-    0x00, 0x6F, 0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0xFE, 0x95, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x5A, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x2F, 0xEA, 0xA0, 0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF,
-    0x00, 0x00, 0x6F, 0xFF, 0x80, 0x2F, 0xFF, 0xD0, 0x0F, 0xE5, 0x50, 0x07, 0xD0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0x2F, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x07, 0xE0,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0xA4, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x04, 0x02,
-    0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x1E, 0x94, 0x0F,
-    0xD0, 0x2F, 0xFD, 0x0F, 0xC0, 0x1B, 0xFD, 0x1F, 0xD0, 0x02, 0xF4, 0x0F, 0xFE, 0xAF, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xAF, 0xF9, 0x00, 0x00, 0xBC, 0x00, 0x7D, 0x00,
-    0xFC, 0x00, 0xBC, 0x01, 0xF8, 0x00, 0xFC, 0x02, 0xF4, 0x01, 0xFC, 0x03, 0xF0, 0x02, 0xF8, 0x03,
-    0xF0, 0x03, 0xF4, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xFA, 0xAF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F,
-    0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xC0, 0x3F, 0x80, 0x3F, 0xC0, 0x7F, 0x40, 0x3F, 0x80, 0xBF,
-    0x00, 0x7F, 0x40, 0x00, 0xFC, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x03, 0xF0, 0x03, 0xE0, 0x07,
-    0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x2F, 0x80, 0x3F, 0x40, 0x7F, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x10, 0x2F, 0x80, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0x0B, 0xF0, 0x00, 0xFC, 0x7F, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x3F,
-    0x3F, 0x40, 0x00, 0xFB, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x0F, 0xDB, 0xFC, 0x00,
-    0x3F, 0x0F, 0xFC, 0x02, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x7E, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0,
-    0x00, 0x7E, 0x00, 0x02, 0xF8, 0x15, 0x4F, 0xFF, 0xFD, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0xC0, 0x00,
-    0xBF, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0xBF, 0xC0, 0x2F, 0xF8, 0x0F,
-    0xF8, 0x03, 0xFF, 0x83, 0xFF, 0x40, 0x3F, 0xFC, 0xBF, 0xF0, 0x07, 0xEF, 0xCF, 0xFF, 0x00, 0xBD,
-    0xFF, 0xFB, 0xE0, 0x0F, 0xCF, 0xFE, 0xBE, 0x01, 0xF8, 0xFF, 0xCF, 0xD0, 0x2F, 0x8F, 0xF5, 0xFC,
-    0x03, 0xF4, 0xFF, 0x3F, 0xC0, 0x7F, 0x0F, 0xD3, 0xF8, 0x0B, 0xF0, 0x54, 0xBF, 0x40, 0x00, 0x15,
-    0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7D, 0x00, 0xBF, 0x40, 0xBC, 0x00, 0xFF, 0x80, 0xFC, 0x01, 0xFF,
-    0xC1, 0xF4, 0x02, 0xFF, 0xC2, 0xF0, 0x03, 0xFB, 0xC3, 0xF0, 0x07, 0xF7, 0xD7, 0xD0, 0x0F, 0xE7,
-    0xEB, 0xC0, 0x0F, 0xD3, 0xFF, 0xC0, 0x2F, 0xC3, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0x00, 0x3F, 0x82,
-    0xFF, 0x00, 0xBF, 0x41, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x03,
-    0xFD, 0x6F, 0xD0, 0x03, 0xF4, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F, 0xC0,
-    0xBD, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xFC, 0x07, 0xF8, 0x06, 0xFE,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0x00, 0x0F, 0x80, 0xF8, 0x01, 0xF4, 0x0B, 0x80, 0x2F, 0x02, 0xF8, 0x03, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xF4, 0x00, 0xFE, 0x94, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFD, 0x07, 0xF4, 0x01, 0xFC, 0x00, 0x7E,
-    0x00, 0xFD, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x01, 0xF4, 0x0F, 0xC0, 0x00,
-    0xFC, 0x03, 0xF0, 0x10, 0x3E, 0x00, 0xFC, 0x0F, 0xBF, 0x40, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x0F,
-    0x40, 0xF4, 0x03, 0xC0, 0x3C, 0x02, 0xF0, 0x1F, 0x00, 0xF8, 0x1F, 0x80, 0x3F, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xF4, 0x03, 0xF0, 0x3E, 0x02, 0xFC, 0x1F, 0x80, 0xFE, 0x0B, 0xF0, 0x3F,
-    0x43, 0xFC, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x10, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0xFE, 0x01, 0xE0, 0x07, 0xF4, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xE0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03,
-    0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07, 0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F,
-    0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x0B, 0xCF, 0xC0, 0x01, 0xF8, 0xFD, 0x00, 0x3F, 0x0F, 0xD0, 0x0F, 0xD0, 0xFE, 0x02, 0xFC,
-    0x0B, 0xE0, 0x7F, 0x00, 0xBF, 0x0F, 0xE0, 0x0B, 0xF2, 0xFC, 0x00, 0xBF, 0xBF, 0x40, 0x0B, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x3F,
-    0x40, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x50, 0x0B, 0xE0, 0x3F, 0x41, 0xF8, 0x1F, 0xC0, 0x7F, 0x03,
-    0xF8, 0x3F, 0x80, 0x7F, 0x0F, 0xFC, 0x7F, 0x00, 0x7F, 0x3F, 0xFC, 0xFD, 0x00, 0x7F, 0xBF, 0xFE,
-    0xFC, 0x00, 0xBF, 0xFD, 0xFF, 0xF4, 0x00, 0xBF, 0xFC, 0xFF, 0xF0, 0x00, 0xBF, 0xF0, 0xBF, 0xD0,
-    0x00, 0xBF, 0xD0, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0xBF, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x40,
-    0x0F, 0xC0, 0x1F, 0x80, 0x02, 0xF8, 0x0F, 0x80, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xDF, 0xC0,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x0F, 0xE2, 0xFD, 0x00, 0x1F, 0xF0,
-    0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x2F, 0x40, 0x2F, 0x47, 0xE0, 0x1F,
-    0x81, 0xFC, 0x0F, 0xC0, 0x3F, 0x0F, 0xC0, 0x0F, 0xDF, 0xD0, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xF0,
-    0x00, 0x1F, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xFA, 0xA4, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x28, 0x38, 0x7C, 0x7C, 0x3C, 0x3C, 0x3C, 0x3D, 0x3D, 0x3E, 0x3E,
-    0x3F, 0x3F, 0x3E, 0x3C, 0x30, 0x10, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x7F,
-    0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0B, 0xF0, 0x01,
-    0xFB, 0xD0, 0x3D, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x81,
-    0x55, 0x55, 0x50, 0x3E, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xE0,
-    0x2F, 0xFF, 0x81, 0xF0, 0x7D, 0x0F, 0x00, 0xF4, 0xB4, 0x03, 0xC3, 0xC0, 0x7F, 0x0F, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xE0, 0x2F, 0xDF, 0x40, 0x01, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x01, 0xF0,
-    0x00, 0x0B, 0x80, 0x00, 0x3D, 0x64, 0x00, 0xFF, 0xFC, 0x07, 0xFE, 0xF8, 0x1F, 0xC0, 0xF0, 0xBC,
-    0x03, 0xC3, 0xF0, 0x1F, 0x0F, 0x81, 0xF8, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x02, 0xFF, 0xD0, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xD0, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF0,
-    0x00, 0x2F, 0x00, 0x02, 0xF9, 0x90, 0x1F, 0xFF, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x02, 0xFA, 0xF0,
-    0x01, 0xFF, 0xFE, 0x00, 0x7E, 0x6F, 0xD0, 0x0F, 0x40, 0xFC, 0x01, 0xE0, 0x1F, 0x80, 0x2E, 0x07,
-    0xF4, 0x02, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x2F, 0xD0, 0x01,
-    0xFE, 0xF4, 0x07, 0xE1, 0x78, 0x0F, 0xFF, 0xF8, 0x1F, 0xAA, 0x94, 0x2F, 0x00, 0x10, 0x2F, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x1F,
-    0x00, 0x02, 0xE0, 0x01, 0xFF, 0xF0, 0x2F, 0xFE, 0x01, 0xFD, 0x40, 0x0F, 0xC0, 0x00, 0xF8, 0x00,
-    0x2F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1B, 0xDB, 0xC0, 0x0B, 0xFF,
-    0xF8, 0x01, 0xF4, 0xBF, 0x00, 0x3C, 0x07, 0xF0, 0x07, 0x40, 0xBE, 0x00, 0xB4, 0x1F, 0xC0, 0x0B,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x02, 0xFF, 0xF0, 0x00, 0x01, 0x2F, 0x00, 0x00, 0x0B, 0xD0,
-    0x02, 0xFB, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xFB, 0xF4, 0x03, 0xFF, 0xFC,
-    0x0B, 0xF4, 0x7C, 0x0F, 0xC0, 0x3C, 0x0F, 0x80, 0x7C, 0x2F, 0x40, 0xF8, 0x3F, 0x01, 0xF4, 0x7F,
-    0x03, 0xF0, 0xBE, 0x03, 0xF0, 0x00, 0x0A, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x3D, 0x00,
-    0x1F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x64, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40,
-    0x00, 0x3C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x40,
-    0x00, 0x7C, 0x00, 0x1B, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x4A, 0x40, 0x3D,
-    0xF8, 0x02, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x7E,
-    0x7F, 0xC2, 0xF4, 0xFF, 0x80, 0x00, 0x78, 0x00, 0xB8, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0xE0, 0x03,
-    0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x2E, 0x00, 0x3E, 0x00, 0x7F, 0xC0, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xBF, 0x4B, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x3F,
-    0x43, 0xF4, 0x7C, 0x07, 0xD0, 0x3E, 0x07, 0xC0, 0xFC, 0x0B, 0xC0, 0xF8, 0x1F, 0x80, 0xF8, 0x0F,
-    0x42, 0xF0, 0x2F, 0x02, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x0B, 0xD0, 0xBD, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x02, 0xEF, 0xE0, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0xBC, 0x0B, 0xC0, 0x7C, 0x0F, 0x40, 0xF8,
-    0x1F, 0x00, 0xF4, 0x3F, 0x02, 0xF0, 0x3F, 0x03, 0xF0, 0xBE, 0x07, 0xF0, 0x00, 0x2F, 0xD0, 0x01,
-    0xFF, 0xF8, 0x07, 0xE0, 0xBC, 0x0F, 0x40, 0x7C, 0x1F, 0x00, 0xF8, 0x2F, 0x5B, 0xF4, 0x1F, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xC0, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x00, 0x01,
-    0xFF, 0xAF, 0x00, 0x0B, 0xF0, 0x2C, 0x00, 0x3F, 0x40, 0xB0, 0x00, 0xFC, 0x03, 0xC0, 0x07, 0xF0,
-    0x1E, 0x00, 0x2F, 0xFB, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x00, 0x3F, 0x15, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xD7, 0xC0, 0x2F, 0xFF, 0xE0, 0x1E, 0x07, 0xF0, 0x0F, 0x00, 0xFC,
-    0x07, 0x40, 0x7D, 0x02, 0xD0, 0x7F, 0x00, 0xBF, 0xFF, 0x80, 0x1F, 0xFF, 0xD0, 0x02, 0xFF, 0xF0,
-    0x00, 0x05, 0x7E, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFB, 0xD0, 0x2F, 0xFD, 0x03, 0xF9, 0x40, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00,
-    0x2F, 0x40, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xAB,
-    0x00, 0xB4, 0x00, 0x01, 0xFA, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0x03, 0xFB, 0xFC, 0x3F, 0xFF,
-    0xD0, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x1F, 0x00, 0x0B, 0xC0,
-    0x2F, 0xFF, 0x5F, 0xFF, 0xD0, 0xBC, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x03, 0xFA, 0x00,
-    0xFF, 0xD0, 0x3F, 0xF4, 0x00, 0x1F, 0x00, 0xF8, 0xB8, 0x03, 0xD2, 0xD0, 0x2F, 0x0F, 0x00, 0xFC,
-    0x3C, 0x07, 0xE1, 0xF0, 0x3F, 0x47, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x3D, 0x00,
-    0x3E, 0x0F, 0xC0, 0x2F, 0x02, 0xF0, 0x1F, 0x00, 0xBD, 0x0F, 0x40, 0x1F, 0x8F, 0x80, 0x03, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xF0,
-    0xF4, 0x00, 0x0F, 0x43, 0xD0, 0xF0, 0xFC, 0x0F, 0x4F, 0xC7, 0xD0, 0x3E, 0xFF, 0x7F, 0x00, 0xFF,
-    0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x07, 0xE3, 0xF0, 0x00, 0x3F, 0xFC,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0xFD,
-    0x2F, 0x80, 0x3F, 0x41, 0xFC, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xC0,
-    0xF8, 0x00, 0x1F, 0x8B, 0xC0, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFF,
-    0x54, 0x00, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF4, 0x00,
-    0x3F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x2F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00,
-    0x1F, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x0F, 0x40, 0x3C, 0x01, 0xE0, 0x0B, 0x40, 0x3C, 0x01, 0xF0, 0x0B, 0x80, 0x3C, 0x00, 0xF0, 0x07,
-    0x80, 0x2D, 0x00, 0xF0, 0x07, 0x80, 0x2D, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x02, 0xFE, 0x00, 0x07,
-    0xF4, 0x00, 0x3F, 0x80, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x01, 0xFF,
-    0x80, 0x0B, 0xF8, 0x00, 0x29, 0x00, 0x00, 0x09, 0x18, 0x3F, 0x6C, 0x76, 0xF8, 0x20, 0x90, 0x00,
-    0xAA, 0x00, 0x7F, 0xC0, 0x1F, 0xD0, 0x0B, 0xF0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x02, 0xF0,
-    0x00, 0xF8, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x70, 0x00, 0x07, 0x00, 0x02, 0xFD, 0x02, 0xFF, 0xD0, 0x7F, 0xD4,
-    0x0F, 0x9C, 0x01, 0xF2, 0xC0, 0x2F, 0x38, 0x02, 0xF7, 0x80, 0x1F, 0xFF, 0x00, 0x7F, 0xE0, 0x00,
-    0xA0, 0x00, 0x0E, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF,
-    0xF4, 0x01, 0xF4, 0x19, 0x00, 0x74, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x07, 0x80, 0x00, 0x1F, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xFF,
-    0xA0, 0x0F, 0xFF, 0xFD, 0x02, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x80, 0x38, 0x03, 0xFF,
-    0xFC, 0x03, 0xFF, 0xF4, 0x03, 0xE2, 0xF0, 0x0B, 0xC3, 0xF0, 0x0F, 0xFF, 0xD0, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xE0, 0x14, 0x01, 0x40, 0x03, 0xF0, 0x02, 0xF0, 0x0B, 0xE0, 0x3F, 0x00, 0x0F, 0xD3,
-    0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x03, 0xC0, 0x0D, 0x00, 0xB0, 0x03, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x74, 0x02, 0xC0, 0x0F, 0x00, 0x34, 0x02, 0xC0, 0x05, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x0B, 0x42, 0x40, 0x00, 0xF9, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x0F,
-    0xEF, 0xF0, 0x01, 0xE0, 0x0B, 0x00, 0x2E, 0x55, 0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0xA4, 0x2E, 0x00, 0x2F, 0xFF, 0xC0, 0x01, 0xBF, 0x90, 0x00, 0x1A, 0x0A,
-    0x4F, 0xC7, 0xE7, 0xF2, 0xF6, 0xFC, 0xFD, 0x01, 0xFD, 0x00, 0x79, 0xB0, 0x0F, 0xA3, 0x82, 0xF0,
-    0x34, 0x2F, 0xCB, 0x01, 0xEB, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x28, 0xD3, 0x0D, 0x7B,
-    0xC3, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x78, 0x1D, 0x02, 0xF0, 0xBC, 0x0F, 0x87,
-    0xD0, 0x3E, 0x0F, 0x80, 0x3F, 0x4F, 0xC0, 0x0F, 0xC3, 0xF0, 0x07, 0x81, 0xD0, 0x02, 0x00, 0x80,
-    0x2F, 0xE9, 0x43, 0xFF, 0xFD, 0x16, 0xAF, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xA4, 0x2F,
-    0xFF, 0xE3, 0xFF, 0xFD, 0x02, 0xF8, 0x03, 0xFB, 0xC2, 0xE5, 0x70, 0xEF, 0x1C, 0x3D, 0xDE, 0x0F,
-    0xBF, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x2A, 0xA5, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x07,
-    0xFF, 0x00, 0xF4, 0xB8, 0x2F, 0x0F, 0x42, 0xFB, 0xF0, 0x1F, 0xFD, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x0B, 0xFF, 0xFC, 0x02, 0xAF, 0xE9, 0x00, 0x03,
-    0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF0, 0x07, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x81, 0x4C, 0x01, 0xC0, 0x74, 0x3D, 0x0B, 0xF4, 0x00, 0x00,
-    0x0F, 0x80, 0x0C, 0x01, 0xC1, 0xF4, 0x03, 0x8B, 0xF0, 0x64, 0x00, 0x01, 0x03, 0xC3, 0xD2, 0xE0,
-    0x00, 0x7C, 0x03, 0xE0, 0x0B, 0x80, 0x3D, 0x00, 0xF4, 0x0B, 0xC0, 0x0F, 0x00, 0xFC, 0x02, 0xF0,
-    0x1F, 0x80, 0x3F, 0x03, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xBF, 0xFE, 0x02,
-    0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xCF, 0x40, 0x3F, 0xE3,
-    0xC0, 0x2F, 0xF5, 0xF0, 0x0F, 0xFC, 0xB8, 0x03, 0xFE, 0x3D, 0x00, 0x7F, 0x4F, 0x00, 0x0F, 0xC7,
-    0xC0, 0x07, 0xE2, 0xE0, 0x03, 0xF4, 0xF4, 0x01, 0xFC, 0x3C, 0x00, 0xFE, 0x1F, 0x00, 0x7F, 0x4B,
-    0x80, 0x3F, 0xC3, 0xD0, 0x0F, 0xE0, 0xF0, 0x01, 0x50, 0x14, 0x00, 0x0F, 0x8B, 0xD3, 0xF5, 0xA8,
-    0x01, 0x00, 0xB0, 0x0F, 0x41, 0x7C, 0x3F, 0x82, 0x90, 0x06, 0x03, 0xC0, 0xA0, 0x34, 0x0C, 0x2F,
-    0xC1, 0x50, 0x00, 0x00, 0x2F, 0x02, 0x8A, 0x0C, 0x38, 0x3F, 0xC0, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x04, 0x00, 0x3C, 0x0E, 0x00, 0x1F, 0x47, 0xD0, 0x02, 0xF0, 0xF8, 0x00, 0xF8, 0x3E, 0x02,
-    0xF8, 0xBE, 0x03, 0xF1, 0xF8, 0x03, 0xC0, 0xF0, 0x01, 0x40, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0x0E, 0x00, 0x00, 0xF0, 0x01, 0xD0, 0x00,
-    0x3C, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x02, 0xE0, 0x03, 0xFF, 0x40, 0xBC, 0x34, 0x3F,
-    0xF0, 0x1F, 0x0F, 0x00, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x00, 0xF4, 0xDF, 0x00, 0x00, 0x3E, 0x38,
-    0xE0, 0x00, 0x0F, 0xCF, 0xFF, 0x40, 0x02, 0xF0, 0xBF, 0xF0, 0x00, 0xBC, 0x00, 0x3C, 0x00, 0x1F,
-    0x40, 0x07, 0x80, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x01, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x01, 0xD0, 0x00, 0x3C, 0x00,
-    0x0F, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x0F, 0xFD, 0x02, 0xE0, 0x50, 0x3F, 0xF0,
-    0x2F, 0x2F, 0xF4, 0x00, 0x01, 0xF0, 0x91, 0xE0, 0x00, 0x1F, 0x40, 0x07, 0x40, 0x00, 0xF4, 0x00,
-    0x7C, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x0B, 0xC0, 0x0F, 0xFD, 0x00,
-    0xBC, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x25, 0xB0,
-    0x00, 0x7C, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x2F, 0xC0, 0x03, 0xC0, 0x03, 0xFC, 0x00, 0xF0, 0x00,
-    0x43, 0xC0, 0x3D, 0x00, 0x2F, 0xF8, 0x0F, 0x43, 0x43, 0xFF, 0x03, 0xE0, 0xF0, 0x00, 0x00, 0xB8,
-    0x3F, 0x00, 0x00, 0x2F, 0x0C, 0xE0, 0x00, 0x0B, 0xC3, 0xAE, 0x00, 0x01, 0xF0, 0xFF, 0xF4, 0x00,
-    0x7D, 0x05, 0x7E, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0x40, 0x07, 0xFD,
-    0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x40,
-    0x3D, 0x07, 0xD0, 0x2F, 0xFF, 0xC0, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x7C, 0xF8, 0x00,
-    0x0F, 0x8F, 0x80, 0x02, 0xF0, 0xFC, 0x00, 0x7E, 0x0F, 0xC0, 0x0F, 0xC0, 0xFC, 0x02, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xD3, 0xF8, 0x00, 0xFE, 0x7F, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xCF, 0x80,
-    0x00, 0x3E, 0x3E, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0xFC, 0x0F, 0xC0, 0x0B,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF4, 0x3F, 0x80, 0x0F, 0xE1, 0xFC, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x0B, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x03, 0xE3, 0xE0, 0x00,
-    0x2F, 0x0F, 0xC0, 0x01, 0xF8, 0x3F, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x07, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x43, 0xF8, 0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x1F,
-    0x2C, 0x00, 0x00, 0xFD, 0xE0, 0x00, 0x0B, 0x3F, 0x40, 0x00, 0x18, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x1F, 0x3E, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x7E, 0x0F, 0xC0, 0x03, 0xF0,
-    0x3F, 0x00, 0x2F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xD0, 0xFE, 0x00, 0x3F,
-    0x87, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x29, 0x1A, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xFC,
-    0x7E, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x07, 0xCF,
-    0x80, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0xFC, 0x0F,
-    0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0x80, 0x0F,
-    0xE0, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x03,
-    0xE3, 0xE0, 0x00, 0x2F, 0x0F, 0xC0, 0x01, 0xF8, 0x3F, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0xBF, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x43, 0xF8, 0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xF8,
-    0x00, 0x00, 0x01, 0xAB, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xEA,
-    0x54, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xCB,
-    0xE5, 0xA0, 0x00, 0x00, 0x7D, 0x3F, 0xFF, 0x80, 0x00, 0x07, 0xE0, 0xFF, 0xFD, 0x00, 0x00, 0x3F,
-    0x07, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xAA, 0x80, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xC0, 0x2F, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00,
-    0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0x90, 0x10, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x60,
-    0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xED, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xE9, 0x50, 0x02, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF5, 0xA0, 0x00, 0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xFC, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x02, 0xFE, 0xAA, 0x00, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0xFE, 0x95, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x5A, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x2F, 0xEA, 0xA0, 0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xD1, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0xFE, 0x95, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x5A, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0xEA, 0xA0, 0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF,
-    0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0xFD, 0x7F,
-    0x00, 0x02, 0xA1, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x95, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD,
-    0x68, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x2F, 0xEA, 0xA0, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xD0,
-    0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x40, 0x00, 0x3C, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xFB, 0xC0, 0x1F, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80,
-    0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xA4, 0x68, 0x01,
-    0xF8, 0xFC, 0x03, 0xF4, 0xFC, 0x03, 0xF6, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F,
-    0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xF0, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x3E,
-    0x00, 0xBD, 0x00, 0x0F, 0x4B, 0xFF, 0xFC, 0x07, 0xD3, 0xFF, 0xFE, 0x02, 0xF0, 0x07, 0xE0, 0x01,
-    0xF8, 0x02, 0xF4, 0x07, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x38, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0xB2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x3E, 0x00,
-    0x7F, 0x00, 0x7D, 0x00, 0xBF, 0x40, 0xBC, 0x00, 0xFF, 0x80, 0xFC, 0x01, 0xFF, 0xC1, 0xF4, 0x02,
-    0xFF, 0xC2, 0xF0, 0x03, 0xFB, 0xC3, 0xF0, 0x07, 0xF7, 0xD7, 0xD0, 0x0F, 0xE7, 0xEB, 0xC0, 0x0F,
-    0xD3, 0xFF, 0xC0, 0x2F, 0xC3, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0x00, 0x3F, 0x82, 0xFF, 0x00, 0xBF,
-    0x41, 0xFE, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0x5B, 0xF4, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x3E, 0x00,
-    0x03, 0xF0, 0x2F, 0x40, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x3F, 0x01, 0xFE,
-    0x01, 0xBF, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x03, 0xFD, 0x6F, 0xD0, 0x03, 0xF4, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x3F, 0x00,
-    0xF8, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xFC,
-    0x07, 0xF8, 0x06, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0x81, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xD6, 0xFD,
-    0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xFC, 0x0B, 0xD0, 0x00,
-    0x3E, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x6F, 0xE0, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x2C, 0x00, 0x00, 0x0F, 0xDE, 0x00, 0x00, 0x0B, 0x3F,
-    0x40, 0x00, 0x01, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x00, 0xFF, 0x5B, 0xF4, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x3E,
-    0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x3F, 0x01,
-    0xFE, 0x01, 0xBF, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x1A, 0x00, 0x00, 0x2F,
-    0x4F, 0xC0, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xD6, 0xFD, 0x00,
-    0x3F, 0x40, 0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x3E,
-    0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x6F, 0xE0, 0x1F, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE2, 0xF0, 0x07, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xD0, 0x0F, 0xEF,
-    0xC0, 0x54, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xAF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD7, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD2, 0xFD,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF5, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01,
-    0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07,
-    0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01,
-    0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07,
-    0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x07, 0xEF, 0x40, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03,
-    0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07, 0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F,
-    0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x28, 0x00, 0x00, 0xF8, 0xBD, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x03, 0xF5, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01,
-    0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07,
-    0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF2, 0xF4, 0x02, 0xF4, 0x7E, 0x01,
-    0xF8, 0x1F, 0xC0, 0xFC, 0x03, 0xF0, 0xFC, 0x00, 0xFD, 0xFD, 0x00, 0x2F, 0xFE, 0x00, 0x07, 0xFF,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x7F, 0xD0,
-    0x02, 0xFF, 0xE0, 0x0F, 0x47, 0xC0, 0x3C, 0x0F, 0x01, 0xE0, 0xFC, 0x0B, 0xEF, 0xC0, 0x3F, 0xFC,
-    0x01, 0xFE, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x0F, 0xFF, 0x80, 0x0B, 0xC0, 0xF0, 0x03, 0xD1, 0xBC, 0x01, 0xF1, 0xFD, 0x00, 0xB8, 0xF0, 0x00,
-    0x3E, 0x3C, 0x00, 0x1F, 0x4F, 0x80, 0x0B, 0xC2, 0xF8, 0x03, 0xF0, 0x2F, 0x01, 0xFC, 0x07, 0xC0,
-    0xBF, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x05, 0x5B, 0x90, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xE0, 0x2F, 0xFF, 0x81, 0xF0, 0x7D,
-    0x0F, 0x00, 0xF4, 0xB4, 0x03, 0xC3, 0xC0, 0x7F, 0x0F, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0, 0x2F, 0xDF,
-    0x40, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x02, 0xFF, 0xF8, 0x07,
-    0xC1, 0xF4, 0x0F, 0x00, 0xF4, 0x2D, 0x00, 0xF0, 0x3C, 0x07, 0xF0, 0x3F, 0xFF, 0xF0, 0x2F, 0xFF,
-    0xE0, 0x0B, 0xF7, 0xD0, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xD0, 0x03, 0xE0, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x02, 0xFF, 0xF8, 0x07, 0xC1, 0xF4, 0x0F,
-    0x00, 0xF4, 0x2D, 0x00, 0xF0, 0x3C, 0x07, 0xF0, 0x3F, 0xFF, 0xF0, 0x2F, 0xFF, 0xE0, 0x0B, 0xF7,
-    0xD0, 0x00, 0x06, 0x09, 0x00, 0x1F, 0xCD, 0x00, 0x2D, 0xFC, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x02, 0xFF, 0xF8, 0x07, 0xC1, 0xF4, 0x0F, 0x00, 0xF4, 0x2D,
-    0x00, 0xF0, 0x3C, 0x07, 0xF0, 0x3F, 0xFF, 0xF0, 0x2F, 0xFF, 0xE0, 0x0B, 0xF7, 0xD0, 0x00, 0x2F,
-    0x0F, 0x80, 0x0F, 0xCB, 0xD0, 0x07, 0xF3, 0xF4, 0x02, 0xA4, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFB, 0x80, 0x0B, 0xFF, 0xE0, 0x07, 0xC1, 0xF4, 0x03, 0xC0, 0x3D, 0x02, 0xD0,
-    0x0F, 0x00, 0xF0, 0x1F, 0xC0, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0xF8, 0x00, 0xBF, 0x7D, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x77, 0x40, 0x01, 0xFC, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xEE, 0x02, 0xFF, 0xF8, 0x1F, 0x07, 0xD0, 0xF0, 0x0F, 0x4B, 0x40, 0x3C,
-    0x3C, 0x07, 0xF0, 0xFF, 0xFF, 0xC2, 0xFF, 0xFE, 0x02, 0xFD, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFB, 0xDB, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x7C, 0x1F, 0xF4, 0x6C, 0x0F, 0x00, 0xFF,
-    0xFF, 0xD2, 0xD0, 0x0F, 0xEA, 0xA4, 0x3C, 0x07, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0x7E, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xD0,
-    0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF9, 0x90, 0x1F, 0xFF, 0x00, 0x7F,
-    0xE0, 0x01, 0xF0, 0x00, 0x17, 0x40, 0x07, 0xF0, 0x00, 0x68, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B,
-    0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x01, 0xFE, 0xF4, 0x07, 0xE1, 0x78, 0x0F, 0xFF, 0xF8, 0x1F, 0xAA, 0x94, 0x2F,
-    0x00, 0x10, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x07,
-    0xFB, 0xD0, 0x07, 0xE1, 0x78, 0x03, 0xFF, 0xFE, 0x01, 0xFA, 0xA9, 0x40, 0xBC, 0x00, 0x40, 0x2F,
-    0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x03, 0xFC, 0x00, 0x02, 0xFB, 0xC0, 0x01, 0xF0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xBD, 0x00, 0x7E, 0x17, 0x80, 0x3F, 0xFF, 0xE0,
-    0x1F, 0xAA, 0x94, 0x0B, 0xC0, 0x04, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x0A, 0x42, 0x80, 0x01, 0xF8, 0xBC, 0x00, 0x2F, 0x4F, 0xC0, 0x03, 0xF6, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x1F, 0xEF, 0x40, 0x07, 0xE1, 0x78, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xAA, 0x94, 0x02, 0xF0,
-    0x01, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x0B,
-    0x80, 0x0F, 0x40, 0x1F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x02, 0xE0,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xF4, 0x00,
-    0x3C, 0x00, 0x1F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x07, 0xF4, 0x00, 0xFB, 0xE0, 0x2E, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x07, 0xC0,
-    0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC7, 0xC0, 0xFC, 0xFC, 0x1F, 0x9F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F,
-    0x40, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0x00, 0x2E, 0x00, 0x01, 0xFF, 0x3C, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x1F, 0x83, 0xF4,
-    0x00, 0x3F, 0x02, 0xF0, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xD3, 0x40, 0x02, 0xFD, 0xD0,
-    0x00, 0xF3, 0xF0, 0x00, 0x28, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFE, 0x00,
-    0x0F, 0xFF, 0xE0, 0x07, 0xF4, 0xBC, 0x02, 0xF0, 0x1F, 0x00, 0xF4, 0x0F, 0x80, 0x7C, 0x03, 0xD0,
-    0x3F, 0x02, 0xF0, 0x0F, 0xC0, 0xFC, 0x0B, 0xE0, 0x7F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x07,
-    0xE0, 0xBC, 0x0F, 0x40, 0x7C, 0x1F, 0x00, 0xF8, 0x2F, 0x5B, 0xF4, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xC0, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01,
-    0xFF, 0xF8, 0x07, 0xE0, 0xBC, 0x0F, 0x40, 0x7C, 0x1F, 0x00, 0xF8, 0x2F, 0x5B, 0xF4, 0x1F, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xC0, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0xFB, 0xE0, 0x03, 0xD0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x07,
-    0xE0, 0xBC, 0x0F, 0x40, 0x7C, 0x1F, 0x00, 0xF8, 0x2F, 0x5B, 0xF4, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xC0, 0x02, 0xF9, 0x00, 0x00, 0x0B, 0x8E, 0x00, 0x1F, 0xDD, 0x00, 0x3C, 0xFC, 0x00, 0x28, 0x64,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x07, 0xE0, 0xBC, 0x0F, 0x40, 0x7C, 0x1F,
-    0x00, 0xF8, 0x2F, 0x5B, 0xF4, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x02, 0xF9, 0x00, 0x00, 0x1A,
-    0x0A, 0x40, 0x0F, 0xC7, 0xE0, 0x07, 0xF3, 0xF4, 0x02, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xE0, 0xBC, 0x03, 0xD0, 0x1F, 0x01, 0xF0,
-    0x0F, 0x80, 0xBD, 0x6F, 0xD0, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0x2F, 0x90, 0x00, 0x00,
-    0x0A, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x1F, 0x7F, 0xF0, 0x00, 0x00, 0xF9, 0xFB, 0xC0, 0x00, 0x07, 0xCF, 0x7F, 0x00, 0x00, 0x2F, 0xFE,
-    0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xFC,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xE2, 0xE0, 0x0F, 0x4B, 0x40,
-    0xBC, 0x3C, 0x03, 0xF0, 0xF0, 0x1F, 0x87, 0xC0, 0xFD, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xF8, 0xB8, 0x03, 0xD2, 0xD0, 0x2F,
-    0x0F, 0x00, 0xFC, 0x3C, 0x07, 0xE1, 0xF0, 0x3F, 0x47, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0xFB, 0xE0, 0x0F, 0x42, 0xE0, 0x00,
-    0x00, 0x01, 0xF0, 0x0F, 0x8B, 0x80, 0x3D, 0x2D, 0x02, 0xF0, 0xF0, 0x0F, 0xC3, 0xC0, 0x7E, 0x1F,
-    0x03, 0xF4, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0xFC,
-    0xBD, 0x01, 0xFC, 0xFD, 0x02, 0xA4, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xF8,
-    0x2E, 0x00, 0xF4, 0x2D, 0x02, 0xF0, 0x3C, 0x03, 0xF0, 0x3C, 0x07, 0xE0, 0x7C, 0x0F, 0xD0, 0x7F,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x2F, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0xBC, 0x0F, 0x80, 0x01, 0xF8, 0xBC, 0x00, 0x03, 0xF3, 0xD0,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0xD0,
-    0x0F, 0x8F, 0xC0, 0x3D, 0x0F, 0x01, 0xF0, 0x3C, 0x0B, 0xC2, 0xE0, 0x3E, 0x1F, 0x40, 0xF6, 0xF8,
-    0x07, 0xFF, 0x80, 0x2F, 0xF4, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x03, 0xF2, 0xF8,
-    0x00, 0x06, 0xA2, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0xBC, 0x0F, 0x80,
-    0x00, 0x7E, 0x2F, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00,
-    0x2F, 0x0F, 0xC0, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xF8, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x3F,
-    0x80, 0x00, 0x16, 0xAB, 0x40, 0x1F, 0xFF, 0xE0, 0x0A, 0xA9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x80, 0x0B, 0xFF, 0xE0, 0x07, 0xC1, 0xF4, 0x03, 0xC0,
-    0x3D, 0x02, 0xD0, 0x0F, 0x00, 0xF0, 0x1F, 0xC0, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0xF8, 0x00, 0xBF,
-    0x7D, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x0F, 0xAB, 0xD0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7C, 0xF8,
-    0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x0F, 0xC0,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xF8,
-    0x00, 0xFE, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x1E, 0x06, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x00,
-    0x2F, 0xFF, 0x80, 0x07, 0xC1, 0xF4, 0x00, 0xF0, 0x0F, 0x40, 0x2D, 0x00, 0xF0, 0x03, 0xC0, 0x7F,
-    0x00, 0x3F, 0xFF, 0xF0, 0x02, 0xFF, 0xFE, 0x00, 0x0B, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xCF, 0x80, 0x00, 0xF8,
-    0xF8, 0x00, 0x2F, 0x0F, 0xC0, 0x07, 0xE0, 0xFC, 0x00, 0xFC, 0x0F, 0xC0, 0x2F, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x3F, 0x80, 0x0F, 0xE7, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0xE0, 0x2F, 0xFF, 0x81, 0xF0, 0x7D, 0x0F, 0x00, 0xF4, 0xB4, 0x03, 0xC3,
-    0xC0, 0x7F, 0x0F, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0, 0x2F, 0xDF, 0x80, 0x00, 0x7E, 0x00, 0x07, 0xC0,
-    0x00, 0x2F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF0, 0x02, 0xFE, 0x40, 0x40, 0x1F,
-    0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x2F, 0xFD, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x02,
-    0xF0, 0x00, 0x0B, 0xE6, 0x40, 0x1F, 0xFF, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x02, 0xE0, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0xBF, 0x90, 0x10, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x02, 0x00, 0x0F,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFB, 0xD0, 0x00, 0xF4, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x99, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x6F, 0xE0, 0x00,
-    0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xF0, 0x02, 0xFE, 0x40, 0x40, 0x1F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x80, 0x0F, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0xA4, 0x00, 0x07,
-    0xD0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x1F, 0xFD, 0x01, 0xF8,
-    0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xE6, 0x40, 0x1F, 0xFF, 0x00, 0x1B,
-    0xF8, 0x00, 0x00, 0x00, 0xF4, 0x1E, 0x00, 0x00, 0x1F, 0xBE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0B, 0xF9, 0x01,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x02, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x68, 0x06, 0x40,
-    0x03, 0xF7, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x99, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x06, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x14, 0x00, 0x01, 0xF1, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF0, 0x03, 0xF0, 0x07, 0xF4, 0x03, 0xF0, 0x01,
-    0xF8, 0x07, 0xE0, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x1F, 0x80, 0x07,
-    0xF0, 0x2F, 0x80, 0x6F, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF1, 0x40, 0x00, 0x00,
-    0x7C, 0xF4, 0x00, 0x00, 0x2E, 0x7C, 0x00, 0x00, 0x0F, 0x7E, 0x00, 0x0B, 0xEB, 0xCF, 0x40, 0x1F,
-    0xFF, 0xE0, 0x00, 0x1F, 0x9B, 0xF4, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x07, 0x80, 0x7E, 0x00, 0x02,
-    0xE0, 0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x01, 0xFE, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xF0,
-    0x03, 0xF4, 0x01, 0xFC, 0x00, 0x3E, 0x00, 0xBD, 0x00, 0x0F, 0x4B, 0xFF, 0xFC, 0x07, 0xD3, 0xFF,
-    0xFE, 0x02, 0xF0, 0x07, 0xE0, 0x01, 0xF8, 0x02, 0xF4, 0x07, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x02, 0xAF, 0xE9, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x2F, 0xAF, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xE6, 0xFD, 0x00, 0x0F, 0x40, 0xFC,
-    0x00, 0x1E, 0x01, 0xF8, 0x00, 0x2E, 0x07, 0xF4, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF0,
-    0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x02, 0xAB, 0xF0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xA5, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x95, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD,
-    0x68, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x2F, 0xEA, 0xA0, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x15, 0x40, 0x01, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x1F, 0xEF, 0x40, 0x07, 0xE1, 0x78, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xAA, 0x94, 0x02, 0xF0, 0x01,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xD0, 0x78,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x95, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x68, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0xEA, 0xA0, 0x00, 0xFF, 0xFF, 0xD0, 0x07,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0x41, 0xD0, 0x00, 0xFF, 0xFD, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xEF, 0x40, 0x07, 0xE1, 0x78, 0x00, 0xFF, 0xFF,
-    0x80, 0x1F, 0xAA, 0x94, 0x02, 0xF0, 0x01, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00,
-    0xFE, 0x95, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x5A, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0xEA, 0xA0, 0x03, 0xFF,
-    0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFE, 0xF4, 0x07, 0xE1, 0x78, 0x0F, 0xFF, 0xF8, 0x1F, 0xAA, 0x94,
-    0x2F, 0x00, 0x10, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFC, 0x00, 0xFE, 0x95, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x5A,
-    0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F,
-    0xEA, 0xA0, 0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x01, 0xFE, 0xF4, 0x07, 0xE1, 0x78, 0x0F, 0xFF, 0xF8, 0x1F, 0xAA, 0x94, 0x2F, 0x00,
-    0x10, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x03, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x14, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFE, 0x95, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x03, 0xF5, 0xA0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0xEA, 0xA0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x7F,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x01, 0xE0, 0x00, 0x1F, 0xBE, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xEF, 0x40,
-    0x01, 0xF8, 0x5E, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x7E, 0xAA, 0x50, 0x02, 0xF0, 0x01, 0x00, 0x0B,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xE0, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xF8, 0x00,
-    0x40, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE,
-    0x01, 0xE9, 0x40, 0x0F, 0xD0, 0x2F, 0xFD, 0x00, 0xFC, 0x01, 0xBF, 0xD0, 0x1F, 0xD0, 0x02, 0xF4,
-    0x00, 0xFF, 0xEA, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0xAF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x01,
-    0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF6,
-    0xF0, 0x00, 0xBF, 0xFF, 0x80, 0x07, 0xD2, 0xFC, 0x00, 0x3C, 0x07, 0xF0, 0x01, 0xD0, 0x2F, 0x80,
-    0x0B, 0x41, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x12, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x02, 0xFB, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x6F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x02, 0xD0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFF, 0x80, 0x04, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x1E, 0x94, 0x00, 0xFD, 0x02, 0xFF, 0xD0, 0x0F, 0xC0, 0x1B, 0xFD, 0x01, 0xFD,
-    0x00, 0x2F, 0x40, 0x0F, 0xFE, 0xAF, 0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0A, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xE0, 0x78, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xDB,
-    0xC0, 0x00, 0xBF, 0xFF, 0x80, 0x01, 0xF4, 0xBF, 0x00, 0x03, 0xC0, 0x7F, 0x00, 0x07, 0x40, 0xBE,
-    0x00, 0x0B, 0x41, 0xFC, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0x12, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xBF, 0x80, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0xA4, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0x80,
-    0x04, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x1E,
-    0x94, 0x0F, 0xD0, 0x2F, 0xFD, 0x0F, 0xC0, 0x1B, 0xFD, 0x1F, 0xD0, 0x02, 0xF4, 0x0F, 0xFE, 0xAF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xDB, 0xC0, 0x0B, 0xFF, 0xF8, 0x01, 0xF4, 0xBF, 0x00, 0x3C, 0x07, 0xF0,
-    0x07, 0x40, 0xBE, 0x00, 0xB4, 0x1F, 0xC0, 0x0B, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x02, 0xFF,
-    0xF0, 0x00, 0x01, 0x2F, 0x00, 0x00, 0x0B, 0xD0, 0x02, 0xFB, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x06,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xAA, 0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xE0, 0x01, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x07, 0xA5, 0x00,
-    0xFD, 0x02, 0xFF, 0xD0, 0x3F, 0x00, 0x6F, 0xF4, 0x1F, 0xD0, 0x02, 0xF4, 0x03, 0xFF, 0xAB, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBD, 0xBC, 0x00, 0xBF, 0xFF, 0x80, 0x1F, 0x4B,
-    0xF0, 0x03, 0xC0, 0x7F, 0x00, 0x74, 0x0B, 0xE0, 0x0B, 0x41, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x12, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0xBF, 0x80,
-    0x03, 0xFF, 0xF0, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0xBC, 0x01, 0xF8, 0x00, 0xFC,
-    0x02, 0xF4, 0x01, 0xFC, 0x03, 0xF0, 0x02, 0xF8, 0x03, 0xF0, 0x03, 0xF4, 0x0B, 0xE0, 0x07, 0xF0,
-    0x0F, 0xFA, 0xAF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x3F, 0x80, 0x3F, 0xC0, 0x7F, 0x40, 0x3F, 0x80, 0xBF, 0x00, 0x7F, 0x40, 0x00, 0x2D, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0xFF, 0xD0, 0x02, 0xE0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xFB, 0xF4,
-    0x03, 0xFF, 0xFC, 0x0B, 0xF4, 0x7C, 0x0F, 0xC0, 0x3C, 0x0F, 0x80, 0x7C, 0x2F, 0x40, 0xF8, 0x3F,
-    0x01, 0xF4, 0x7F, 0x03, 0xF0, 0xBE, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0xBC,
-    0x01, 0xF8, 0x00, 0xFC, 0x06, 0xF9, 0x56, 0xFD, 0x0F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xFA, 0xAF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x3F, 0x80, 0x3F, 0xC0, 0x7F, 0x40, 0x3F, 0x80, 0xBF, 0x00, 0x7F, 0x40,
-    0x00, 0x3D, 0x00, 0x00, 0x7D, 0x50, 0x07, 0xFF, 0xE0, 0x0B, 0xFE, 0x40, 0x01, 0xF0, 0x00, 0x02,
-    0xFB, 0xF4, 0x03, 0xFF, 0xFC, 0x07, 0xF4, 0x7C, 0x0F, 0xC0, 0x3C, 0x0F, 0x80, 0x7C, 0x2F, 0x40,
-    0xF8, 0x3F, 0x01, 0xF4, 0x3F, 0x03, 0xF0, 0xBE, 0x03, 0xF0, 0x00, 0x3D, 0x34, 0x02, 0xFD, 0xC0,
-    0x0E, 0x7F, 0x00, 0x24, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40,
-    0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0,
-    0x00, 0x7F, 0x00, 0x00, 0x01, 0xF2, 0xC0, 0x3F, 0xAC, 0x07, 0x6F, 0x40, 0x20, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00,
-    0xF4, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x54, 0x01, 0xFF, 0xFC,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0,
-    0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x80, 0x00,
-    0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0x50, 0xBF, 0xFF, 0x1F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00,
-    0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7D,
-    0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00,
-    0xBF, 0x00, 0x1F, 0x40, 0x03, 0xC0, 0x00, 0x3F, 0x80, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00,
-    0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x2E, 0x00, 0x00, 0xFF, 0x40,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x02,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x80,
-    0x02, 0xF8, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xE0, 0x3D, 0x03, 0xC0,
-    0x7C, 0x0B, 0x80, 0xF4, 0x1F, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x07, 0xD0,
-    0x01, 0xF8, 0x00, 0xBC, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7E, 0x00,
-    0x1F, 0x40, 0x0F, 0xD0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x03,
-    0xF4, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x2F,
-    0xC0, 0x0F, 0xC0, 0x02, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x09, 0x0B, 0xF0,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x2B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x07, 0xD0, 0x07,
-    0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xF0, 0x01, 0xF0,
-    0x00, 0xB4, 0x00, 0xB8, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x0F,
-    0xC0, 0x03, 0xC0, 0x03, 0xF0, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0xF0, 0x00, 0x00, 0xB8, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x04, 0x0B,
-    0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x2E, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x2F, 0xC0, 0x03, 0xF1, 0xFC, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0xFC,
-    0xFD, 0x00, 0x03, 0xEF, 0xD0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x3F, 0x6F, 0xF0, 0x00,
-    0xFC, 0x3F, 0xF0, 0x0B, 0xE0, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x4A, 0x40, 0x03, 0xDF, 0x80, 0x02,
-    0xFF, 0x80, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x07,
-    0xE7, 0xFC, 0x02, 0xF4, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0xE2, 0xC0, 0x1D, 0xB4, 0x02, 0xEE, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00,
-    0xFD, 0x00, 0x0F, 0xF4, 0x02, 0xDF, 0xC0, 0x3C, 0x7F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x1E, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00,
-    0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00,
-    0x01, 0xF8, 0x00, 0x0B, 0xE0, 0x55, 0x3F, 0xFF, 0xF5, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x3C, 0x00, 0x0B, 0x80, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x00,
-    0x7C, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x3E, 0x00, 0x07, 0xFC,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07,
-    0xE0, 0x00, 0x0B, 0xE0, 0x55, 0x0F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x15, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x80, 0x00,
-    0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00,
-    0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x3F, 0xC0, 0x00, 0xFD, 0x00,
-    0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xFC, 0x05, 0x01, 0xF8, 0x2E, 0x02, 0xF0, 0x3D, 0x03, 0xF0, 0x7C, 0x07, 0xE0, 0xF8, 0x0B, 0xD0,
-    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x81, 0x54, 0x3F, 0xFF, 0xF4, 0x7F, 0xFF, 0xF0,
-    0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x01, 0xE1, 0xF0,
-    0x00, 0xB8, 0xF8, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xC0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x03, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x0F, 0xC1, 0xF0, 0x07, 0xE0, 0xFC, 0x02, 0xF0, 0x7F, 0x00, 0xFC, 0x1A, 0x80, 0x7E,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x15, 0x40, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x78, 0x00, 0x0B, 0x80, 0x00, 0xF4,
-    0x00, 0x1F, 0x1A, 0x03, 0xE3, 0xF0, 0x3D, 0x7E, 0x07, 0xCF, 0xE0, 0xF8, 0x00, 0x0F, 0x40, 0x01,
-    0xF0, 0x00, 0x2E, 0x00, 0x03, 0xE0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x05, 0x50, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0x6F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x10, 0x00, 0x01, 0x7F, 0xFE,
-    0x81, 0xBF, 0xFF, 0xD0, 0x00, 0x01, 0x40, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7D, 0x00, 0xBF, 0x40, 0xBC, 0x00, 0xFF, 0x80, 0xFC, 0x01,
-    0xFF, 0xC1, 0xF4, 0x02, 0xFF, 0xC2, 0xF0, 0x03, 0xFB, 0xC3, 0xF0, 0x07, 0xF7, 0xD7, 0xD0, 0x0F,
-    0xE7, 0xEB, 0xC0, 0x0F, 0xD3, 0xFF, 0xC0, 0x2F, 0xC3, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0x00, 0x3F,
-    0x82, 0xFF, 0x00, 0xBF, 0x41, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB8,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xE0, 0x03,
-    0xFF, 0xF8, 0x07, 0xF4, 0xBC, 0x0B, 0xC0, 0x7C, 0x0F, 0x40, 0xF8, 0x1F, 0x00, 0xF4, 0x3F, 0x02,
-    0xF0, 0x3F, 0x03, 0xF0, 0xBE, 0x07, 0xF0, 0x00, 0x15, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7D, 0x00,
-    0xBF, 0x40, 0xBC, 0x00, 0xFF, 0x80, 0xFC, 0x01, 0xFF, 0xC1, 0xF4, 0x02, 0xFF, 0xC2, 0xF0, 0x03,
-    0xFB, 0xC3, 0xF0, 0x07, 0xF7, 0xD7, 0xD0, 0x0F, 0xE7, 0xEB, 0xC0, 0x0F, 0xD3, 0xFF, 0xC0, 0x2F,
-    0xC3, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0x00, 0x3F, 0x82, 0xFF, 0x00, 0xBF, 0x41, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF,
-    0xE0, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0xBC, 0x0B, 0xC0, 0x7C, 0x0F, 0x40, 0xF8, 0x1F, 0x00, 0xF4,
-    0x3F, 0x02, 0xF0, 0x3F, 0x03, 0xF0, 0xBE, 0x07, 0xF0, 0x01, 0x54, 0x00, 0x03, 0xF8, 0x00, 0x07,
-    0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0xB8, 0x1F, 0x40, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0xF8,
-    0x00, 0x7F, 0x00, 0x7D, 0x00, 0x2F, 0xD0, 0x2F, 0x00, 0x0F, 0xF8, 0x0F, 0xC0, 0x07, 0xFF, 0x07,
-    0xD0, 0x02, 0xFF, 0xC2, 0xF0, 0x00, 0xFE, 0xF0, 0xFC, 0x00, 0x7F, 0x7D, 0x7D, 0x00, 0x3F, 0x9F,
-    0xAF, 0x00, 0x0F, 0xD3, 0xFF, 0xC0, 0x0B, 0xF0, 0xFF, 0xD0, 0x03, 0xFC, 0x3F, 0xF0, 0x00, 0xFE,
-    0x0B, 0xFC, 0x00, 0xBF, 0x41, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0x40, 0xB0, 0x00, 0x0F, 0xAF, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0x4B,
-    0xC0, 0x02, 0xF0, 0x1F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03, 0xD0, 0x03, 0xF0, 0x2F, 0x00,
-    0x0F, 0xC0, 0xFC, 0x00, 0xBE, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x00, 0x00,
-    0x3D, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00,
-    0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xC0, 0x00, 0x15, 0x00, 0x3E, 0x00, 0x7F,
-    0x00, 0x7D, 0x00, 0xBF, 0x40, 0xBC, 0x00, 0xFF, 0x80, 0xFC, 0x01, 0xFF, 0xC1, 0xF4, 0x02, 0xFF,
-    0xC2, 0xF0, 0x03, 0xFB, 0xC3, 0xF0, 0x07, 0xF7, 0xD7, 0xD0, 0x0F, 0xE7, 0xEB, 0xC0, 0x0F, 0xD3,
-    0xFF, 0xC0, 0x2F, 0xC3, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0x00, 0x3F, 0x82, 0xFF, 0x00, 0xBF, 0x41,
-    0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xE0, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0xBC, 0x0B, 0xC0,
-    0x7C, 0x0F, 0x40, 0xF8, 0x1F, 0x00, 0xF4, 0x3F, 0x02, 0xF0, 0x3F, 0x03, 0xF0, 0xBE, 0x07, 0xF0,
-    0x00, 0x0B, 0xD0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F,
-    0xD6, 0xFD, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xFC, 0x0B,
-    0xD0, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x6F, 0xE0,
-    0x1F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0F, 0xFF, 0xE0, 0x0B, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0xE0,
-    0x07, 0xE0, 0xBC, 0x03, 0xD0, 0x1F, 0x01, 0xF0, 0x0F, 0x80, 0xBD, 0x6F, 0xD0, 0x1F, 0xFF, 0xE0,
-    0x03, 0xFF, 0xF0, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x0F, 0xAB, 0xC0,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xD6, 0xFD, 0x00, 0x3F, 0x40,
-    0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x3E, 0x03, 0xF0,
-    0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x6F, 0xE0, 0x1F, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFA, 0xBC, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x7F, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xE0, 0xBC,
-    0x00, 0xF4, 0x07, 0xC0, 0x1F, 0x00, 0xF8, 0x02, 0xF5, 0xBF, 0x40, 0x1F, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFC, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x1F, 0x80,
-    0x00, 0xFD, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFE, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xF5, 0xBF, 0x40, 0x00, 0xFD, 0x00, 0x7F,
-    0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x0F, 0x80, 0x0F,
-    0xC0, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x01, 0xFE, 0x01, 0xBF, 0x80, 0x07, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0xFC, 0x02, 0xF4, 0x03, 0xF0, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x07, 0xE0, 0xBC, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x2F, 0x5B, 0xF4,
-    0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x55, 0x54, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD6, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFD, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x58,
-    0x00, 0x0B, 0xD0, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xC0, 0x03,
-    0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0xA9, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0xBE, 0x40, 0x07, 0xFF, 0xFF, 0xEF,
-    0x00, 0x7E, 0x0B, 0xF4, 0x6E, 0x03, 0xE0, 0x1F, 0xFF, 0xF8, 0x1F, 0x00, 0xFE, 0xAA, 0x50, 0xBD,
-    0x6F, 0xF0, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xF9, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0xF0, 0x03, 0xD0, 0x3D, 0x00, 0xF0, 0x0F, 0x00,
-    0xBC, 0x07, 0xC0, 0x3E, 0x07, 0xE0, 0x0F, 0xFF, 0xF0, 0x0B, 0xFF, 0xF0, 0x03, 0xFF, 0xFD, 0x00,
-    0xFC, 0x0F, 0x80, 0xBF, 0x07, 0xE0, 0x3F, 0x82, 0xFC, 0x0F, 0xD0, 0xFF, 0x0B, 0xF4, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x05, 0x40, 0x01, 0xFB, 0xD0,
-    0x2F, 0xFD, 0x03, 0xF9, 0x40, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x03, 0xF4,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0xF0, 0x03, 0xD0, 0x3D, 0x00, 0xF0, 0x0F, 0x00, 0xBC,
-    0x07, 0xC0, 0x3E, 0x07, 0xE0, 0x0F, 0xFF, 0xF0, 0x0B, 0xFF, 0xF0, 0x03, 0xFF, 0xFD, 0x00, 0xFC,
-    0x0F, 0x80, 0xBF, 0x07, 0xE0, 0x3F, 0x82, 0xFC, 0x0F, 0xD0, 0xFF, 0x0B, 0xF4, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x2F,
-    0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xD0, 0x2F, 0xFD, 0x03, 0xF9, 0x40, 0x7D, 0x00,
-    0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x50, 0x00, 0x1F, 0x0F, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x03,
-    0xD0, 0x3D, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xBC, 0x07, 0xC0, 0x03, 0xE0, 0x7E, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0xBF, 0x07, 0xE0,
-    0x03, 0xF8, 0x2F, 0xC0, 0x0F, 0xD0, 0xFF, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x28, 0x01, 0xF5, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFB, 0xD0, 0x02, 0xFF, 0xD0, 0x03, 0xF9, 0x40, 0x07, 0xD0, 0x00, 0x0B, 0xC0,
-    0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x7F, 0x40, 0x40, 0x02,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x07, 0x80, 0x1F, 0xD0, 0x7F, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0xC0, 0x00, 0x2D,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xAB, 0x00, 0xB4, 0x00, 0x01, 0xFA,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0x03, 0xFB, 0xFC, 0x3F, 0xFF, 0xD0, 0x6F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03,
-    0xE0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x07,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x7F, 0x40, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0x80, 0x1F, 0xD0, 0x1F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0xB8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x07, 0xEA, 0xC0,
-    0x02, 0xD0, 0x00, 0x00, 0x7E, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xEF, 0xF0,
-    0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1F,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x10, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0xFE, 0x00, 0xE0, 0x07, 0xF4, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x01, 0xBF,
-    0xFE, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xAB, 0x00, 0xB4, 0x00, 0x01, 0xFA, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x3F, 0x03, 0xFB, 0xFC, 0x3F, 0xFF, 0xD0, 0xBF, 0xF8, 0x00, 0xE0, 0x00,
-    0x0B, 0xE0, 0x00, 0x3B, 0x40, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x1A, 0x00, 0x00, 0x2F,
-    0x7E, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0x1F, 0xD0, 0x10, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xE0, 0x01, 0xE0, 0x07, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x2D, 0x02, 0x80, 0x01, 0xF6, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xAB, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xEF, 0xF0,
-    0x03, 0xFF, 0xFD, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x17, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x0B, 0xFF, 0xD1, 0xFF, 0xFD, 0x02, 0xF0, 0x00,
-    0x3E, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0xE8, 0x00, 0xFF, 0xD0, 0x0F, 0xFD, 0x01, 0xD0,
-    0x00, 0x3F, 0x00, 0x06, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x24, 0x02, 0x40, 0x03, 0xE2, 0xF0,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xF8, 0x00, 0x3E, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x02, 0xE0, 0xBC,
-    0x01, 0xF0, 0x15, 0x00, 0xBC, 0x00, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0xFD, 0x00, 0x0B, 0xC0, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x0F, 0xFD, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x80, 0x07,
-    0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xFF, 0xD0, 0x07, 0xFF, 0xFC, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0,
-    0x02, 0xFF, 0xF4, 0x1F, 0xFF, 0xD0, 0x0B, 0xC0, 0x0B, 0xFF, 0xF8, 0x3F, 0xFF, 0xD0, 0x07, 0xC0,
-    0x00, 0x3F, 0xA0, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2E, 0x38, 0x00, 0x00, 0x7F,
-    0x74, 0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0xA1, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01,
-    0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07, 0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07,
-    0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF,
-    0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x38, 0x00, 0xFF, 0xE0, 0x0B, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x0F, 0x8B, 0x80, 0x3D, 0x2D, 0x02, 0xF0, 0xF0, 0x0F, 0xC3, 0xC0, 0x7E, 0x1F,
-    0x03, 0xF4, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xFD, 0x02,
-    0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07, 0xF0, 0x03, 0xF0, 0x0B,
-    0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F, 0xC0, 0x1F,
-    0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0xFF, 0xFE, 0x02, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xF8, 0x2E, 0x00, 0xF4, 0x2D, 0x02, 0xF0, 0x3C, 0x03,
-    0xF0, 0x3C, 0x07, 0xE0, 0x7C, 0x0F, 0xD0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x74, 0x1E, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE,
-    0x01, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4,
-    0x07, 0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1A, 0x00, 0x1F, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0x80, 0xB8,
-    0x03, 0xD0, 0x2D, 0x02, 0xF0, 0x0F, 0x00, 0xFC, 0x03, 0xC0, 0x7E, 0x01, 0xF0, 0x3F, 0x40, 0x7F,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x1E,
-    0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01, 0xFC, 0x00,
-    0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07, 0xF0, 0x03,
-    0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F,
-    0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x3B, 0x80, 0x01, 0xFD, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x3E, 0x2E, 0x00, 0xF4, 0xB4, 0x0B,
-    0xC3, 0xC0, 0x3F, 0x0F, 0x01, 0xF8, 0x7C, 0x0F, 0xD1, 0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xE0, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x01, 0xF8, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x0B, 0xF0,
-    0x00, 0x3F, 0x40, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x3F,
-    0x40, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x1F, 0xC0, 0x3F, 0x01, 0xFC, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xE0, 0x02, 0xE0, 0x0F, 0x40, 0x0B,
-    0x40, 0xBC, 0x00, 0x3C, 0x03, 0xF0, 0x00, 0xF0, 0x1F, 0x80, 0x07, 0xC0, 0xFD, 0x00, 0x1F, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01, 0xFC,
-    0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07, 0xF0,
-    0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF,
-    0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xF8, 0xB8, 0x03, 0xD3, 0xD0, 0x2F, 0x0F, 0x00,
-    0xFC, 0x3C, 0x07, 0xE1, 0xF0, 0x7F, 0x47, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x01,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xEF, 0x40,
-    0x00, 0x00, 0x0F, 0x42, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x3F,
-    0x40, 0x50, 0x0F, 0xE0, 0x3F, 0x01, 0xF8, 0x1F, 0xC0, 0x7F, 0x07, 0xF8, 0x3F, 0x40, 0x7F, 0x0F,
-    0xFC, 0x7F, 0x00, 0x7F, 0x3F, 0xFC, 0xFD, 0x00, 0x7F, 0xBF, 0xFE, 0xFC, 0x00, 0xBF, 0xFD, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFC, 0xFF, 0xF0, 0x00, 0xBF, 0xF0, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0xBF, 0xC0,
-    0x00, 0xBF, 0xC0, 0xBF, 0x40, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x7C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0xBC, 0x3D, 0x00, 0x03, 0xD0, 0xF4, 0x3C, 0x3F, 0x03, 0xD3, 0xF1, 0xF4, 0x0F,
-    0xBF, 0xDF, 0xC0, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x40, 0x0F, 0xE3,
-    0xF8, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x2F, 0x40, 0x2F, 0x47, 0xE0, 0x1F, 0x81, 0xFC, 0x0F,
-    0xC0, 0x3F, 0x0F, 0xC0, 0x0F, 0xDF, 0xD0, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFB,
-    0xC0, 0x00, 0x2E, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x02, 0xF0, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x1F, 0x8B, 0xC0, 0x00,
-    0x3F, 0x3D, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x3F, 0x0F, 0x80, 0x0F, 0xCB, 0xE0, 0x06,
-    0xA2, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x3F, 0x2F, 0x40, 0x2F, 0x47, 0xE0, 0x1F, 0x81, 0xFC, 0x0F, 0xC0, 0x3F, 0x0F, 0xC0, 0x0F,
-    0xDF, 0xD0, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xBF, 0xFE, 0xA9,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x07,
-    0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF5, 0x40, 0x0F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xBF,
-    0xFE, 0xA9, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4,
-    0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF5, 0x40, 0x0F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0B, 0x80, 0x00, 0x07, 0xEF, 0x40, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xEA, 0x90, 0x03, 0xFF, 0xFF,
-    0xF8, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x0F, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01,
-    0xFF, 0x54, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0xBF,
-    0xC0, 0x07, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4,
-    0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x01, 0xBF, 0x90, 0x1E, 0x00, 0x0F, 0xFF, 0xF8, 0xBD, 0x00, 0x3F, 0xD6, 0xFD, 0xB4, 0x00, 0xFD,
-    0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00,
-    0x3E, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0xE0, 0x1B, 0xF8,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00,
-    0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1D, 0x00, 0x2F, 0xD2, 0xD0, 0x1F, 0xFF, 0xFC, 0x07, 0xE0, 0xBF, 0x00, 0xF4, 0x07, 0xC0, 0x1F,
-    0x00, 0xF8, 0x02, 0xF5, 0xBF, 0x40, 0x1F, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x02, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x07, 0xFF, 0x80, 0xF8,
-    0x3E, 0x7D, 0x02, 0xE0, 0xF2, 0xF0, 0x2F, 0x83, 0x8F, 0xFF, 0xFC, 0x09, 0x7F, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFD, 0x00, 0x0F, 0xE9, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xF5, 0x40, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xEB,
-    0xC0, 0x02, 0xFC, 0x0B, 0x00, 0x0F, 0xD0, 0x2C, 0x00, 0x7F, 0x00, 0xF0, 0x02, 0xFC, 0x07, 0x80,
-    0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x02, 0xFF, 0xFE, 0x00, 0x0F, 0xC5, 0x40, 0x00, 0xBD,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x3F, 0xFF, 0xD0, 0x0A, 0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFE, 0x0C, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xC0, 0x00, 0xF4, 0x00, 0x1F, 0x00,
-    0x02, 0xF0, 0x02, 0xFF, 0xF4, 0x7F, 0xFF, 0x40, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x1F,
-    0x00, 0x03, 0xFA, 0x00, 0x3F, 0xF4, 0x03, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2D, 0x00, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xC0, 0x0F, 0xE0,
-    0x02, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x7F, 0x00,
-    0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00,
-    0xFC, 0x02, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x07, 0xC1, 0xF0, 0x0F, 0xF0, 0x2E, 0x00, 0xFD, 0x02, 0xD0, 0x2F, 0x00,
-    0x3C, 0x03, 0xF0, 0x03, 0xC0, 0x7E, 0x00, 0x7C, 0x0F, 0xD0, 0x07, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
-    0xC0, 0x02, 0xFF, 0xF8, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0x01, 0x03, 0xC3, 0xD2,
-    0xE0, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x07, 0xF4, 0x00, 0xFB, 0xE0, 0x3E, 0x07, 0xC0, 0x09, 0x18,
-    0x3F, 0x6C, 0x76, 0xF8, 0x20, 0x90, 0x00, 0x15, 0x41, 0xFF, 0xFD, 0x3F, 0xFE, 0x90, 0x00, 0x00,
-    0x54, 0x1F, 0xFF, 0xFE, 0x7F, 0xAA, 0xA9, 0x2D, 0x07, 0x8B, 0xFF, 0xD1, 0xFF, 0xD0, 0x05, 0x40,
-    0x0A, 0x47, 0xD3, 0xF5, 0xFC, 0x00, 0x00, 0x07, 0xC7, 0xC3, 0xF3, 0xF0, 0xFC, 0xFC, 0x78, 0x1C,
-    0x38, 0xA0, 0x00, 0x0F, 0x0E, 0xE3, 0xF4, 0xB8, 0x02, 0xE0, 0x07, 0xC0, 0xFC, 0x01, 0xF4, 0x3F,
-    0x40, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xC0, 0xFB, 0xE0, 0x07, 0xF4, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x02, 0xF4, 0x07, 0xE0, 0x0F, 0xD0, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0xFE, 0x01, 0xFC, 0x03, 0xF4, 0x07, 0xF0, 0x0A, 0x90, 0x02, 0xA8, 0x1F, 0xD0,
-    0xBF, 0x03, 0xF0, 0x3F, 0x81, 0xFC, 0x00, 0x6A, 0x40, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xD0, 0x07,
-    0xF0, 0x03, 0xF8, 0x0F, 0x1B, 0xCF, 0xE0, 0xB0, 0x04, 0x00, 0x3C, 0x02, 0xF8, 0x1F, 0xC0, 0xF0,
-    0x05, 0x00, 0x69, 0x50, 0xBF, 0xFD, 0x55, 0xBC, 0x00, 0x7C, 0x00, 0xB8, 0x0A, 0x02, 0xC1, 0xF1,
-    0xF4, 0x30, 0x00, 0x01, 0x0F, 0x2C, 0x3D, 0x08, 0x00, 0x00, 0x03, 0x46, 0xE1, 0xFF, 0x0B, 0xC0,
-    0x00, 0x78, 0x1F, 0xF0, 0xFC, 0x38, 0x00, 0x00, 0x04, 0x0C, 0xBE, 0x24, 0x00, 0x0A, 0xBF, 0xC3,
-    0xFF, 0xFC, 0x15, 0x55, 0x00, 0x1A, 0x0F, 0xC7, 0xF2, 0xF8, 0x0F, 0x8F, 0x87, 0xD7, 0xD2, 0xF6,
-    0xF0, 0x00, 0x00, 0x0F, 0x0E, 0xE3, 0xF4, 0xB8, 0x01, 0xA9, 0x02, 0xFC, 0x03, 0xF4, 0x07, 0xF0,
-    0x0F, 0xD0, 0x3F, 0xC0, 0x01, 0x00, 0xB0, 0x0F, 0x41, 0x7C, 0x3F, 0x82, 0x90, 0x00, 0x01, 0xF1,
-    0xF4, 0xF0, 0x7F, 0x8B, 0xE0, 0x00, 0x05, 0x07, 0xC2, 0xF0, 0xF8, 0x7D, 0x2F, 0x00, 0x2F, 0xFE,
-    0x3F, 0xFD, 0x3D, 0x7C, 0x7C, 0x7C, 0x29, 0x00, 0xA0, 0x7E, 0x2F, 0x40, 0xBF, 0xF0, 0x00, 0xFE,
-    0x00, 0x01, 0xE0, 0x00, 0x01, 0x90, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0xD0, 0x07, 0xE7, 0xE0, 0x3E,
-    0x02, 0xF0, 0x1F, 0x0D, 0x3F, 0x9D, 0xB7, 0xFC, 0xB0, 0xF4, 0x1A, 0xFF, 0x1F, 0xFF, 0xC0, 0x00,
-    0x00, 0x1A, 0xBF, 0x8F, 0xFF, 0xE5, 0x55, 0x40, 0x0F, 0x8B, 0x0B, 0xF3, 0xC3, 0xDF, 0xD0, 0xE2,
-    0xE0, 0x3F, 0xFF, 0xC7, 0xFF, 0xFC, 0x50, 0xB8, 0x2C, 0x3D, 0x38, 0x00, 0x00, 0x00, 0x03, 0xD2,
-    0xF0, 0x3E, 0x1F, 0x42, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0x55, 0x54, 0x1F, 0xFE, 0x2F, 0xFD, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x7F, 0xF8, 0xBF, 0xF4, 0x01, 0x54, 0x0F, 0xFC, 0x2D, 0xEC, 0x3A, 0xDC, 0x10,
-    0x00, 0x08, 0x90, 0xB4, 0x0F, 0x03, 0x68, 0x09, 0x18, 0x3F, 0x6C, 0x76, 0xF8, 0x20, 0x90, 0x00,
-    0x34, 0x7C, 0xBC, 0xA0, 0x00, 0x03, 0xC0, 0x00, 0xB4, 0x00, 0x1E, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x0B,
-    0xDB, 0xD0, 0x3F, 0xFD, 0x3F, 0xFC, 0xBC, 0xBC, 0xF8, 0xB8, 0x01, 0xAB, 0xF8, 0x1F, 0xFF, 0xF0,
-    0x55, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x4F,
-    0x43, 0xC3, 0xC2, 0xF1, 0xF0, 0xF4, 0xF8, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0xBF, 0xE3, 0xFF, 0x85,
-    0xBD, 0x02, 0xF0, 0x05, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x02, 0xFD, 0xB0, 0x01,
-    0xFF, 0x3C, 0x00, 0xBB, 0xFE, 0x00, 0x3F, 0xBF, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x38, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x05, 0x00, 0x0B, 0xFF, 0x02, 0xFC, 0x07, 0xFF, 0xFD, 0x7F, 0x81, 0xFF, 0x0F, 0xFF, 0xF0,
-    0x0F, 0xD0, 0x2F, 0xE4, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4,
-    0x14, 0x0B, 0xFD, 0x3D, 0x1F, 0x5F, 0xFC, 0x0B, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xE0,
-    0x3F, 0xF5, 0xF0, 0xBC, 0x7F, 0xD0, 0x14, 0x1A, 0x40, 0x14, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x20, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x01, 0xD2, 0xE4,
-    0x00, 0x7F, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x55, 0x50, 0x00, 0x00, 0x55, 0x40, 0x00, 0x3F, 0xFF,
-    0xF8, 0x03, 0xD0, 0x01, 0xBE, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xCF, 0x80, 0x00, 0xF8, 0xF8, 0x00,
-    0x2F, 0x0F, 0xC0, 0x07, 0xE0, 0xFC, 0x00, 0xFC, 0x0F, 0xC0, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xD0, 0xFF, 0xFF, 0xFD, 0x3F, 0x80, 0x0F, 0xE7, 0xF0, 0x00, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x1F,
-    0xFF, 0xF0, 0x02, 0xF4, 0x1F, 0x40, 0x3F, 0x00, 0xF4, 0x03, 0xE0, 0x1F, 0x00, 0x7E, 0x5B, 0xE0,
-    0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x1F, 0x80, 0x3F, 0x02, 0xF4, 0x03, 0xF0, 0x3F, 0xAA,
-    0xFE, 0x03, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF8, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0x80, 0x1F, 0xAA, 0x90, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xEF, 0x80, 0x01,
-    0xF8, 0xFC, 0x00, 0x3F, 0x0F, 0xC0, 0x0F, 0xC0, 0xFD, 0x02, 0xF8, 0x0F, 0xD0, 0x7F, 0x00, 0xBE,
-    0x0F, 0xC0, 0x0B, 0xF2, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xE2, 0xAA, 0xAA, 0xA8, 0x00, 0x6F,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0xFE, 0x95, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x5A, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x2F, 0xEA, 0xA0, 0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFA, 0xA4, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x7D, 0x00,
-    0xFC, 0x00, 0xBC, 0x01, 0xF8, 0x00, 0xFC, 0x02, 0xF4, 0x01, 0xFC, 0x03, 0xF0, 0x02, 0xF8, 0x03,
-    0xF0, 0x03, 0xF4, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xFA, 0xAF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F,
-    0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xC0, 0x3F, 0x80, 0x3F, 0xC0, 0x7F, 0x40, 0x3F, 0x80, 0xBF,
-    0x00, 0x7F, 0x40, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x03, 0xFD, 0x6F, 0xD0,
-    0x03, 0xF4, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0xF9, 0xAA, 0xCF, 0xC0, 0xBD, 0xFF, 0xF7,
-    0xE0, 0x3F, 0x15, 0x42, 0xF4, 0x0F, 0xC0, 0x00, 0xFC, 0x07, 0xF8, 0x06, 0xFE, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x03, 0xF0, 0x03, 0xE0, 0x07,
-    0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x2F, 0x80, 0x3F, 0x40, 0x7F, 0x00, 0x7F, 0x00, 0x00,
-    0x2F, 0x0B, 0xF0, 0x00, 0xFC, 0x7F, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0xFB,
-    0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x0F, 0xDB, 0xFC, 0x00, 0x3F, 0x0F, 0xFC, 0x02,
-    0xF8, 0x2F, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xBF, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0x0F, 0xE1,
-    0xFD, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0xFD, 0x03, 0xF8, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x07,
-    0xF0, 0x3F, 0x00, 0x0B, 0xD0, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0x0F, 0xF0,
-    0x03, 0xFC, 0x00, 0xFF, 0x40, 0xBF, 0xC0, 0x2F, 0xF8, 0x0F, 0xF8, 0x03, 0xFF, 0x83, 0xFF, 0x40,
-    0x3F, 0xFC, 0xBF, 0xF0, 0x07, 0xEF, 0xCF, 0xFF, 0x00, 0xBD, 0xFF, 0xFB, 0xE0, 0x0F, 0xCF, 0xFE,
-    0xBE, 0x01, 0xF8, 0xFF, 0xCF, 0xD0, 0x2F, 0x8F, 0xF5, 0xFC, 0x03, 0xF4, 0xFF, 0x3F, 0xC0, 0x7F,
-    0x0F, 0xD3, 0xF8, 0x0B, 0xF0, 0x54, 0xBF, 0x40, 0x00, 0x15, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7D,
-    0x00, 0xBF, 0x40, 0xBC, 0x00, 0xFF, 0x80, 0xFC, 0x01, 0xFF, 0xC1, 0xF4, 0x02, 0xFF, 0xC2, 0xF0,
-    0x03, 0xFB, 0xC3, 0xF0, 0x07, 0xF7, 0xD7, 0xD0, 0x0F, 0xE7, 0xEB, 0xC0, 0x0F, 0xD3, 0xFF, 0xC0,
-    0x2F, 0xC3, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0x00, 0x3F, 0x82, 0xFF, 0x00, 0xBF, 0x41, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF,
-    0x00, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x03, 0xFD,
-    0x6F, 0xD0, 0x03, 0xF4, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0xBD,
-    0x00, 0x03, 0xE0, 0x3F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xFC, 0x07, 0xF8, 0x06, 0xFE, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xD0, 0x2F, 0x00, 0xF0, 0x0F,
-    0x80, 0xBC, 0x03, 0xD0, 0x3E, 0x01, 0xF0, 0x0F, 0x40, 0xB8, 0x07, 0xC0, 0x3D, 0x02, 0xF0, 0x0F,
-    0x00, 0xF4, 0x07, 0xC0, 0x3C, 0x02, 0xE0, 0x1F, 0x00, 0xF4, 0x0B, 0x80, 0x28, 0x02, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x00, 0x0F, 0x80, 0xF8, 0x01, 0xF4,
-    0x0B, 0x80, 0x2F, 0x02, 0xF8, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xD0, 0x0B, 0xFF, 0xF4, 0x00,
-    0xFE, 0x94, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x03,
-    0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xC0, 0x0A,
-    0xAA, 0xA0, 0x00, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xE0,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x2F, 0x40, 0x2F, 0x47, 0xE0, 0x1F, 0x81, 0xFC, 0x0F,
-    0xC0, 0x3F, 0x0F, 0xC0, 0x0F, 0xDF, 0xD0, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xEF, 0xF0,
-    0x00, 0xBF, 0x5F, 0x47, 0xF8, 0x02, 0xFC, 0x2F, 0x03, 0xFC, 0x07, 0xF4, 0x3E, 0x03, 0xFC, 0x0F,
-    0xE0, 0x3D, 0x03, 0xF8, 0x1F, 0xD0, 0x7C, 0x07, 0xF0, 0x2F, 0xD0, 0xFC, 0x1F, 0xE0, 0x2F, 0xFA,
-    0xFE, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xFF,
-    0x90, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x1F, 0x80, 0x02, 0xF8, 0x0F, 0x80, 0x00, 0x3F,
-    0x0F, 0xC0, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xEF, 0xF0, 0x00,
-    0x0F, 0xE2, 0xFD, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF4, 0x00, 0x05, 0x40, 0x64,
-    0x90, 0x2F, 0x03, 0xD7, 0xC0, 0xF4, 0x0F, 0x2E, 0x03, 0xC0, 0x78, 0xF4, 0x1F, 0x02, 0xDB, 0xC0,
-    0x7C, 0x0F, 0xBD, 0x01, 0xFD, 0x7F, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x01,
-    0xBD, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x02, 0xF9, 0x1F, 0xC0, 0x02, 0xF8, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0xBC,
-    0x00, 0x1F, 0x40, 0x3F, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x03, 0xF0, 0x07, 0xD0, 0x01, 0xF4, 0x00,
-    0xF4, 0x00, 0xFC, 0x00, 0x3E, 0x01, 0xFC, 0x00, 0xBF, 0xF1, 0xFF, 0x80, 0x3F, 0xF8, 0xBF, 0xE0,
-    0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x80,
-    0x02, 0xFF, 0xF8, 0x00, 0x7C, 0x1F, 0x40, 0x0F, 0x00, 0xF0, 0x02, 0xD0, 0x0F, 0x00, 0x3C, 0x07,
-    0xF0, 0x03, 0xFF, 0xFF, 0x44, 0x2F, 0xFF, 0xFF, 0xC0, 0xBF, 0x7F, 0xF8, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x0F,
-    0xFE, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x3F, 0x9F, 0xC0, 0x0B, 0xC0, 0x7C, 0x00, 0xF8, 0x0F, 0x80,
-    0x0F, 0x7F, 0xE0, 0x02, 0xF3, 0xFE, 0x00, 0x3F, 0x05, 0xF4, 0x03, 0xE0, 0x1F, 0x80, 0x7F, 0xE7,
-    0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0x47, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0x7D, 0x0B, 0xC3, 0xE0, 0xFC,
-    0x3F, 0x1F, 0x43, 0xF3, 0xF0, 0x2F, 0xFD, 0x01, 0xFF, 0xC0, 0x2F, 0xF0, 0x02, 0xFD, 0x00, 0x3F,
-    0x80, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x07, 0xC0, 0x68, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x02, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x07, 0xF8, 0xBE, 0x02, 0xF4, 0x0F, 0xC0,
-    0xFC, 0x07, 0xE0, 0x3F, 0x07, 0xF0, 0x0F, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0x1B, 0xE4, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x0E, 0x0D, 0x0D, 0x00, 0x0B, 0xC0, 0x2E, 0x50, 0x38, 0x78, 0x3F, 0xF4,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0x0F, 0xE0, 0x01, 0xFC, 0x00,
-    0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBE, 0x50, 0x00, 0xBF, 0xE0,
-    0x00, 0x7F, 0x80, 0x00, 0x7D, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x40, 0x06, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x0B, 0xFB, 0xF4, 0x01, 0xFF, 0xFC, 0x03, 0xF8, 0x3D, 0x03, 0xE0, 0x3D,
-    0x07, 0xC0, 0x3D, 0x0F, 0xC0, 0x7C, 0x0F, 0x80, 0xBC, 0x1F, 0x80, 0xF8, 0x2F, 0x41, 0xF4, 0x3F,
-    0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xE0, 0x00, 0xBE, 0xF8, 0x02, 0xF0, 0x3C, 0x03, 0xD0, 0x3C, 0x0B, 0xC0, 0x3C,
-    0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x2F, 0x01, 0xF8, 0x2F, 0x02, 0xF0, 0x3F, 0x4B, 0xF0, 0x3F,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x06, 0xE4, 0x00, 0x00, 0x64, 0x03, 0xD0, 0x0F,
-    0x00, 0x7C, 0x02, 0xE0, 0x0F, 0x40, 0x3C, 0x02, 0xF0, 0x0F, 0xC0, 0x7F, 0x42, 0xFF, 0x0F, 0xFC,
-    0x01, 0xE3, 0xD0, 0x2C, 0xF8, 0x03, 0xEE, 0x00, 0xBF, 0x80, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x3F,
-    0xF4, 0x03, 0xDF, 0xC0, 0xB8, 0xBF, 0x00, 0x7E, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0B, 0xD7, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC1,
-    0xF0, 0x00, 0xF8, 0x0B, 0xC0, 0x1F, 0x00, 0x3D, 0x00, 0x7C, 0x03, 0xE0, 0x0B, 0x80, 0x3D, 0x00,
-    0xF4, 0x0B, 0xC0, 0x0F, 0x00, 0xFC, 0x02, 0xF0, 0x1F, 0x80, 0x3F, 0x03, 0xF4, 0x07, 0xFF, 0xFF,
-    0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xBF, 0xFE, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0x7D, 0x0B, 0xC3, 0xE0, 0xFC, 0x3F, 0x1F, 0x43, 0xF3,
-    0xF0, 0x2F, 0xFE, 0x01, 0xFF, 0xC0, 0x2F, 0xF4, 0x02, 0xFE, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x3F, 0xD0, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x00,
-    0xF9, 0x00, 0x2F, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0xFF,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x07, 0xE0, 0xBC, 0x0F,
-    0x40, 0x7C, 0x1F, 0x00, 0xF8, 0x2F, 0x5B, 0xF4, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x02, 0xF9,
-    0x00, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xC0, 0x3E, 0x2F, 0x00, 0x0F, 0x4F, 0x40, 0x07, 0xC7,
-    0xC0, 0x03, 0xE2, 0xE0, 0x00, 0xF4, 0xF4, 0x00, 0xBC, 0xBF, 0x80, 0x3E, 0x1F, 0xC0, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xBD, 0x00, 0x07, 0xE0,
-    0x38, 0x00, 0x3F, 0x00, 0xE0, 0x01, 0xF8, 0x07, 0x40, 0x0F, 0xD0, 0x3C, 0x00, 0x7F, 0xEF, 0xE0,
-    0x03, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0xBD, 0x29, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0xBF, 0xF4, 0x7D, 0x1F,
-    0x3D, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00,
-    0x7D, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x7E, 0x0B, 0xC0,
-    0x03, 0xD0, 0x1F, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0xBD, 0x6F, 0xD0, 0x01, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xC0, 0x0F, 0x80, 0x00,
-    0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x47, 0x80, 0xF4, 0x3C, 0x0F, 0x03, 0xC1, 0xF0, 0x3C, 0x2E, 0x03, 0xC2,
-    0xE0, 0xBC, 0x3F, 0xAF, 0x83, 0xFF, 0xF0, 0x3F, 0xFD, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x01, 0xBF,
-    0x90, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xDF, 0xD0, 0x03, 0xF6, 0xE1, 0xF8, 0x03, 0xF4,
-    0xB4, 0x3F, 0x01, 0xF8, 0x3C, 0x0F, 0xC0, 0xBD, 0x0F, 0x03, 0xE0, 0x3F, 0x07, 0x81, 0xF4, 0x0F,
-    0xC2, 0xD0, 0xFC, 0x07, 0xF4, 0xF5, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x3D, 0x00, 0xBF, 0x80, 0xF4, 0x00, 0xBF, 0xD3, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x03, 0xF4, 0xBF, 0xD0, 0x0F, 0xE0, 0x7F, 0xD0, 0x3F, 0x80,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x40, 0x00, 0x1D, 0x00, 0x0B, 0xF0, 0xF0,
-    0x3F, 0xC2, 0xC0, 0xFB, 0x0B, 0x47, 0xEC, 0x3C, 0x1E, 0xF0, 0xF0, 0xBB, 0x83, 0xC3, 0xEE, 0x2F,
-    0x0F, 0xFF, 0xF4, 0x2F, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0x2C, 0x00, 0x00, 0xB0, 0x00, 0x02, 0xC0,
-    0x00, 0x0F, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xF4,
-    0x07, 0xE0, 0x0B, 0x80, 0xFC, 0x00, 0xB8, 0x2F, 0x0F, 0x0B, 0x83, 0xE0, 0xE0, 0xF4, 0x3D, 0x2D,
-    0x2F, 0x03, 0xEB, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x07,
-    0xCF, 0x80, 0x00, 0xF8, 0xF8, 0x00, 0x2F, 0x0F, 0xC0, 0x07, 0xE0, 0xFC, 0x00, 0xFC, 0x0F, 0xC0,
-    0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x3F, 0x80, 0x0F, 0xE7, 0xF0, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0A,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEE, 0x00, 0xBF, 0xFE, 0x01, 0xF0, 0x7D, 0x03,
-    0xC0, 0x3D, 0x0B, 0x40, 0x3C, 0x0F, 0x01, 0xFC, 0x0F, 0xFF, 0xFC, 0x0B, 0xFF, 0xF8, 0x02, 0xFD,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x03, 0xE3, 0xE0,
-    0x00, 0x2F, 0x0F, 0xC0, 0x01, 0xF8, 0x3F, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x43, 0xF8, 0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x40, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xEE, 0x02, 0xFF, 0xF8, 0x1F, 0x07, 0xD0, 0xF0, 0x0F, 0x4B, 0x40, 0x3C, 0x3C,
-    0x07, 0xF0, 0xFF, 0xFF, 0xC2, 0xFF, 0xFE, 0x02, 0xFD, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0B,
-    0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x2F,
-    0x0F, 0xC0, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0xFC, 0x0F, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0x80, 0x0F, 0xE0, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x02, 0xE0, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3E, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEE, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0x07, 0xD0,
-    0x00, 0x0F, 0x00, 0xF4, 0x00, 0x0B, 0x40, 0x3C, 0x00, 0x03, 0xC0, 0x7F, 0x00, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x02, 0xFD, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x0B, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x07, 0xCF, 0x80, 0x00,
-    0x0F, 0x8F, 0x80, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0xFC, 0x0F, 0xC0, 0x02,
-    0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0x80, 0x0F, 0xE0, 0x7F,
-    0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x7F, 0x40, 0x00, 0xFB, 0xE0, 0x03, 0xD0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xB8, 0x02, 0xFF, 0xF8, 0x07, 0xC1, 0xF4, 0x0F, 0x00, 0xF4, 0x2D, 0x00, 0xF0, 0x3C, 0x07, 0xF0,
-    0x3F, 0xFF, 0xF0, 0x2F, 0xFF, 0xE0, 0x0B, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x0B, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x0F, 0x8F,
-    0x80, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0xFC, 0x0F, 0xC0, 0x02, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0x80, 0x0F, 0xE0, 0x7F, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x07, 0x80, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x7C, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x07, 0xC1, 0xF4, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0x2D, 0x00, 0xF0, 0x00, 0x3C, 0x07, 0xF0,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x0B, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x18,
-    0x24, 0x00, 0x00, 0x7F, 0x34, 0x00, 0x00, 0xB7, 0xF0, 0x00, 0x00, 0xA1, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x01, 0xF0,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x2F, 0x0F,
-    0xC0, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0xFC, 0x0F, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0x80, 0x0F, 0xE0, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0x1C,
-    0x00, 0x0F, 0xEB, 0x00, 0x03, 0x6F, 0x80, 0x00, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0xF4, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB,
-    0x80, 0x0B, 0xFF, 0xE0, 0x07, 0xC1, 0xF4, 0x03, 0xC0, 0x3D, 0x02, 0xD0, 0x0F, 0x00, 0xF0, 0x1F,
-    0xC0, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0xF8, 0x00, 0xBF, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0B, 0x81, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x7C, 0xF8, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x2F, 0x0F, 0xC0, 0x01, 0xF8, 0x3F, 0x00,
-    0x0F, 0xC0, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x43, 0xF8,
-    0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x03, 0xFF, 0x40, 0x03, 0xE0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xE0,
-    0x02, 0xFF, 0xF8, 0x01, 0xF0, 0x7D, 0x00, 0xF0, 0x0F, 0x40, 0xB4, 0x03, 0xC0, 0x3C, 0x07, 0xF0,
-    0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xFE, 0x00, 0x2F, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x03, 0xEA, 0xF4, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F,
-    0x3E, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x03,
-    0xF0, 0x3F, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFD, 0x00,
-    0xFE, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x02, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x00, 0x2F, 0xFF, 0x80, 0x07, 0xC1, 0xF4, 0x00, 0xF0, 0x0F,
-    0x40, 0x2D, 0x00, 0xF0, 0x03, 0xC0, 0x7F, 0x00, 0x3F, 0xFF, 0xF0, 0x02, 0xFF, 0xFE, 0x00, 0x0B,
-    0xF7, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEA,
-    0xF4, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x1F, 0x3E, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x0B, 0xC3, 0xF0, 0x00,
-    0x07, 0xE0, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x07, 0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x00, 0x2F, 0xFF, 0x80, 0x07,
-    0xC1, 0xF4, 0x00, 0xF0, 0x0F, 0x40, 0x2D, 0x00, 0xF0, 0x03, 0xC0, 0x7F, 0x00, 0x3F, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFE, 0x00, 0x0B, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x03,
-    0x40, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0xFA, 0xBD, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xCF, 0x80,
-    0x00, 0x03, 0xE3, 0xE0, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0xFC, 0x0F,
-    0xC0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0x80,
-    0x0F, 0xE0, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xAF, 0x80, 0x0B, 0xFF, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xEE, 0x00, 0x2F, 0xFF, 0x80, 0x1F, 0x07, 0xD0, 0x0F, 0x00, 0xF4, 0x0B, 0x40,
-    0x3C, 0x03, 0xC0, 0x7F, 0x00, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0x02, 0xFD, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x91, 0x40, 0x00, 0x00, 0xFC, 0xE0, 0x00, 0x00, 0xB3, 0xF4, 0x00, 0x00, 0x18, 0x64,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x10, 0x00, 0x00, 0xFA,
-    0xBD, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x02, 0xF0, 0xFC, 0x00,
-    0x01, 0xF8, 0x3F, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0x80, 0x0F, 0xE0, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0xF4, 0xD0, 0x00, 0x2F, 0xFC, 0x00, 0x03, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x06, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x00, 0x2F, 0xFF, 0x80, 0x07,
-    0xC1, 0xF4, 0x00, 0xF0, 0x0F, 0x40, 0x2D, 0x00, 0xF0, 0x03, 0xC0, 0x7F, 0x00, 0x3F, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFE, 0x00, 0x0B, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x0F, 0xAB,
-    0xD0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00,
-    0x1F, 0x83, 0xF0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xF8, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0A, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x81, 0xA0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xE0, 0x00, 0x2F, 0xFF,
-    0x80, 0x01, 0xF0, 0x7D, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0xB4, 0x03, 0xC0, 0x03, 0xC0, 0x7F, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x2F, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFA, 0x54, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF5, 0xA0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBF, 0xAA, 0x80, 0x03, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2A, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xEF, 0x40, 0x1F, 0x85, 0xE0, 0x0F, 0xFF, 0xF8, 0x07, 0xEA,
-    0xA5, 0x02, 0xF0, 0x01, 0x00, 0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xE9, 0x50, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xF5, 0xA0, 0x00, 0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x02, 0xFE, 0xAA, 0x00, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFE, 0xF4, 0x07, 0xE1, 0x78,
-    0x0F, 0xFF, 0xF8, 0x1F, 0xAA, 0x94, 0x2F, 0x00, 0x10, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x60, 0x80, 0x00, 0x1F, 0xCD, 0x00, 0x03, 0xDF, 0xC0, 0x00, 0x38, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xE9, 0x50, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF5, 0xA0, 0x00,
-    0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xFE, 0xAA,
-    0x00, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xD3, 0x40,
-    0x02, 0xFD, 0xD0, 0x00, 0xE7, 0xF0, 0x00, 0x28, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xBD, 0x00, 0x7E, 0x17, 0x80,
-    0x3F, 0xFF, 0xE0, 0x1F, 0xAA, 0x94, 0x0B, 0xC0, 0x04, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x80,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x0E, 0x01, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xD1,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x03, 0xFA, 0x54, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x5A, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xAA, 0x80, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7C, 0x00, 0x03, 0xC0,
-    0x03, 0xFC, 0x00, 0x2D, 0x00, 0x2F, 0xBC, 0x01, 0xF0, 0x01, 0xF0, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x07, 0xFB, 0xD0, 0x00, 0x00, 0x7E, 0x17, 0x80, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x1F,
-    0xAA, 0x94, 0x00, 0x00, 0xBC, 0x00, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x03, 0x80, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xD1,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0x95, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x5A, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xEA, 0xA0, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xBD, 0x00, 0x1E, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xFB,
-    0xD0, 0x07, 0xE1, 0x78, 0x03, 0xFF, 0xFE, 0x01, 0xFA, 0xA9, 0x40, 0xBC, 0x00, 0x40, 0x2F, 0xFF,
-    0xF0, 0x03, 0xFF, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0x70, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x03, 0xD1, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x03, 0xFA, 0x54, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x5A, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xAA, 0x80, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x0A, 0xC0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x01, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x03, 0xE0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0xF4,
-    0x00, 0x01, 0xF8, 0x5E, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7E, 0xAA, 0x50, 0x00, 0x2F, 0x00,
-    0x10, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0xE2, 0xC0, 0x00, 0x0F, 0xDE, 0x00, 0x00, 0xB3, 0xF4, 0x00, 0x01, 0x86, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFB, 0xD0, 0x00, 0x1F, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x95, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x68, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x2F,
-    0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0xEA, 0xA0, 0x00, 0xFF, 0xFF,
-    0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x19, 0x38, 0x00, 0x00, 0xFC,
-    0xE0, 0x00, 0x0B, 0x3F, 0x00, 0x00, 0x28, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x2F, 0xBC, 0x00, 0x01, 0xF0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFB, 0xD0, 0x00, 0x7E, 0x17,
-    0x80, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xAA, 0x94, 0x00, 0xBC, 0x00, 0x40, 0x02, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x03, 0xD1, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0x40, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xA5, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x5A, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x3F, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x0B, 0xFA, 0xA8, 0x00, 0x3F, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0x7C, 0x0B, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x07, 0xFB,
-    0xD0, 0x01, 0xF8, 0x5E, 0x00, 0x3F, 0xFF, 0xE0, 0x07, 0xEA, 0xA5, 0x00, 0xBC, 0x00, 0x40, 0x0B,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xA4,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x1C, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00,
-    0x03, 0xE0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x02, 0xF8, 0x00, 0x3F,
-    0x40, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x0A, 0x00, 0x1D, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x1F,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x02,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x40,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00,
-    0x0B, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xA8, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x03, 0xFD, 0x6F, 0xD0, 0x03, 0xF4,
-    0x01, 0xFC, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x03, 0xE0, 0x3F,
-    0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xFC, 0x07, 0xF8, 0x06, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x3F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0x82, 0xF0, 0x0F, 0x40, 0x7C, 0x07, 0xC0, 0x3E, 0x02,
-    0xF5, 0xBF, 0x40, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0xA8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1D, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xD6, 0xFD, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x3F, 0x40,
-    0x03, 0xF0, 0x0F, 0x80, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC,
-    0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x6F, 0xE0, 0x1F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x07, 0xE0, 0xBC, 0x0F, 0x40, 0x7C, 0x1F, 0x00, 0xF8, 0x2F, 0x5B,
-    0xF4, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x2C, 0x00, 0x03, 0xFF, 0xC0, 0xB4, 0x00, 0x0B,
-    0x81, 0xF1, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xD6, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00, 0x3F,
-    0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00,
-    0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0xE0, 0x1B, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x0F,
-    0x40, 0x07, 0xF4, 0x02, 0xE0, 0x00, 0xFB, 0xE0, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00,
-    0x0F, 0x40, 0x7C, 0x00, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x2F, 0x5B, 0xF4, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x02, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x0F, 0xF5, 0xBF, 0x40, 0x0F, 0xD0, 0x07, 0xF0, 0x0F, 0xD0, 0x00, 0xFC, 0x03, 0xE0,
-    0x00, 0x3F, 0x02, 0xF4, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x03, 0xF0, 0x1F,
-    0xE0, 0x1B, 0xF8, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFE, 0x00,
-    0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x28, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0xD0, 0x03, 0xE0, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x07, 0xE0, 0xBC, 0x0F, 0x40, 0x7C, 0x1F, 0x00, 0xF8,
-    0x2F, 0x5B, 0xF4, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x02, 0xE0, 0xD0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xB8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x90, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x03, 0xFD, 0x6F, 0xD0, 0x03, 0xF4, 0x01, 0xFC, 0x03,
-    0xF4, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x02, 0xF4,
-    0x0F, 0xC0, 0x00, 0xFC, 0x07, 0xF8, 0x06, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x07,
-    0x80, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xBC, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xE0, 0xBC, 0x00, 0x0F, 0x40,
-    0x7C, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x2F, 0x5B, 0xF4, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x18, 0x20, 0x00, 0x00, 0x1F, 0xDD, 0x00, 0x00,
-    0x0F, 0x7F, 0x00, 0x00, 0x02, 0x86, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xD6, 0xFD, 0x00, 0x3F, 0x40,
-    0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x3E, 0x03, 0xF0,
-    0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x6F, 0xE0, 0x1F, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x08, 0x00, 0x0B, 0xE7, 0x00, 0x03, 0xAF, 0xC0, 0x00, 0xD3, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0xB8, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xE0, 0xBC, 0x03, 0xD0, 0x1F, 0x01, 0xF0,
-    0x0F, 0x80, 0xBD, 0x6F, 0xD0, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0x2F, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x0B, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x3F, 0xD6, 0xFD, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xF0, 0x0F, 0x80,
-    0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0F, 0xC0, 0x7F,
-    0x80, 0x6F, 0xE0, 0x1F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00,
-    0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0xFB, 0xE0, 0x03, 0xD0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x07, 0xE0,
-    0xBC, 0x0F, 0x40, 0x7C, 0x1F, 0x00, 0xF8, 0x2F, 0x5B, 0xF4, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0,
-    0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x3F,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0xBF, 0x90, 0x1E, 0x00, 0x0F, 0xFF, 0xF8, 0xBD,
-    0x00, 0x3F, 0xD6, 0xFD, 0xB4, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x03,
-    0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x0F, 0xC0,
-    0x00, 0xFC, 0x00, 0x1F, 0xE0, 0x1B, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x2F, 0xD2, 0xD0, 0x1F, 0xFF, 0xFC, 0x07, 0xE0, 0xBF,
-    0x00, 0xF4, 0x07, 0xC0, 0x1F, 0x00, 0xF8, 0x02, 0xF5, 0xBF, 0x40, 0x1F, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFC, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0xBF, 0x90, 0x1E, 0x00, 0x0F, 0xFF, 0xF8, 0xBD, 0x00, 0x3F,
-    0xD6, 0xFD, 0xB4, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00,
-    0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-    0x00, 0x1F, 0xE0, 0x1B, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1D, 0x00, 0x2F, 0xD2, 0xD0, 0x1F, 0xFF, 0xFC, 0x07, 0xE0, 0xBF, 0x00, 0xF4,
-    0x07, 0xC0, 0x1F, 0x00, 0xF8, 0x02, 0xF5, 0xBF, 0x40, 0x1F, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00,
-    0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x01, 0xBF, 0x90, 0x1E, 0x00, 0x0F, 0xFF, 0xF8, 0xBD, 0x00, 0x3F, 0xD6, 0xFD,
-    0xB4, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00,
-    0x0B, 0xD0, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F,
-    0xE0, 0x1B, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x2F, 0xD2, 0xD0, 0x1F, 0xFF, 0xFC, 0x07, 0xE0, 0xBF, 0x00, 0xF4, 0x07, 0xC0,
-    0x1F, 0x00, 0xF8, 0x02, 0xF5, 0xBF, 0x40, 0x1F, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x02, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF2, 0xC0, 0x00, 0x00, 0x03, 0xF7, 0x80, 0x00, 0x00, 0x0B, 0x3F,
-    0x40, 0x00, 0x00, 0x06, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x01, 0xBF, 0x90, 0x1E, 0x00, 0x0F, 0xFF, 0xF8, 0xBD, 0x00, 0x3F, 0xD6, 0xFD, 0xB4, 0x00,
-    0xFD, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xD0,
-    0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0xE0, 0x1B,
-    0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x80,
-    0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45, 0x00, 0x00,
-    0xFD, 0xF0, 0x00, 0x1D, 0xFD, 0x00, 0x01, 0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x01, 0xD0, 0x02, 0xFD, 0x2D, 0x01, 0xFF, 0xFF, 0xC0, 0x7E, 0x0B, 0xF0, 0x0F, 0x40,
-    0x7C, 0x01, 0xF0, 0x0F, 0x80, 0x2F, 0x5B, 0xF4, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0xBF,
-    0x90, 0x1E, 0x00, 0x0F, 0xFF, 0xF8, 0xBD, 0x00, 0x3F, 0xD6, 0xFD, 0xB4, 0x00, 0xFD, 0x00, 0x7F,
-    0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x3E, 0x00,
-    0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0xE0, 0x1B, 0xF8, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0xBF, 0x4B, 0x40, 0x1F, 0xFF, 0xFC, 0x01, 0xF8, 0x2F, 0xC0, 0x0F, 0x40,
-    0x7C, 0x00, 0x7C, 0x03, 0xE0, 0x02, 0xF5, 0xBF, 0x40, 0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03,
-    0xF4, 0x03, 0xF4, 0x07, 0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F,
-    0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0x80, 0xB8, 0x03, 0xD0, 0x2D, 0x02,
-    0xF0, 0x0F, 0x00, 0xFC, 0x03, 0xC0, 0x7E, 0x01, 0xF0, 0x3F, 0x40, 0x7F, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01,
-    0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07,
-    0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x40, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0x8B, 0x80, 0x3D, 0x2D, 0x02, 0xF0,
-    0xF0, 0x0F, 0xC3, 0xC0, 0x7E, 0x1F, 0x03, 0xF4, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02,
-    0xD0, 0x0F, 0xE0, 0x0F, 0xFC, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x03, 0xF8,
-    0x02, 0xFC, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00,
-    0x0F, 0xD0, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0x01, 0xFF, 0xFF,
-    0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x01,
-    0xF0, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x1F, 0x00, 0xFF, 0x42, 0xE0, 0x0F, 0xD0,
-    0x2D, 0x02, 0xF0, 0x03, 0xC0, 0x3F, 0x00, 0x3C, 0x07, 0xE0, 0x07, 0xC0, 0xFD, 0x00, 0x7F, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x0F, 0xE0, 0x0F, 0xFC, 0x01, 0xFC, 0x00,
-    0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x07,
-    0xF0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x78, 0x1F, 0x00, 0xFF, 0x02, 0xE0, 0x0F, 0xD0, 0x2D, 0x02, 0xF0, 0x03, 0xC0, 0x3F, 0x00, 0x3C,
-    0x07, 0xE0, 0x07, 0xC0, 0xFD, 0x00, 0x7F, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x0F, 0xE0, 0x0F, 0xFC, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x03, 0xF8,
-    0x02, 0xFC, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00,
-    0x0F, 0xD0, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0x01, 0xFF, 0xFF,
-    0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x1F, 0x00, 0xFF, 0x02, 0xE0, 0x0F, 0xD0,
-    0x2D, 0x02, 0xF0, 0x03, 0xC0, 0x3F, 0x00, 0x3C, 0x07, 0xE0, 0x07, 0xC0, 0xFD, 0x00, 0x7F, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2E, 0x38, 0x00, 0x00, 0x07,
-    0xF7, 0x40, 0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0x0A, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x0F, 0xE0, 0x0F, 0xFC, 0x01, 0xFC, 0x00,
-    0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x07,
-    0xF0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x38, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0xB1, 0xF0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x7C, 0x1F, 0x00, 0xFF, 0x42, 0xE0, 0x0F, 0xD0, 0x2D, 0x02, 0xF0, 0x03, 0xC0, 0x3F, 0x00, 0x3C,
-    0x07, 0xE0, 0x07, 0xC0, 0xFD, 0x00, 0x7F, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xC0, 0x0F, 0xE0, 0x02, 0xFC, 0x01, 0xFC,
-    0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x0B, 0xE0,
-    0x07, 0xF0, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x02, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x7C, 0x01, 0xF0, 0x0F, 0xF0, 0x02, 0xE0, 0x0F, 0xD0, 0x02, 0xD0, 0x2F, 0x00, 0x03, 0xC0,
-    0x3F, 0x00, 0x03, 0xC0, 0x7E, 0x00, 0x07, 0xC0, 0xFD, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xFC, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC,
-    0xBD, 0x00, 0xBD, 0x1F, 0x80, 0x7E, 0x07, 0xF0, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0x3F, 0x7F, 0x40,
-    0x0B, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0xFC, 0x07, 0xC0, 0x02, 0xF0, 0x3E,
-    0x00, 0x07, 0xE2, 0xF0, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x2F,
-    0x40, 0x2F, 0x40, 0x07, 0xE0, 0x1F, 0x80, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x3F, 0x0F, 0xC0, 0x00,
-    0x0F, 0xDF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF0,
-    0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x1F, 0x8B, 0xC0, 0x00, 0x3F, 0x3D, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF7, 0xF0, 0x00, 0xFE, 0x1F, 0x80,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xCB, 0xD0, 0x0B, 0xD1, 0xF8, 0x07, 0xE0, 0x7F,
-    0x03, 0xF0, 0x0F, 0xC3, 0xF0, 0x03, 0xF7, 0xF4, 0x00, 0xBF, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x0F, 0xC0, 0x7C, 0x00, 0x2F, 0x03, 0xE0,
-    0x00, 0x7E, 0x2F, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x18, 0x00, 0x0B, 0xDB,
-    0x00, 0x03, 0xBF, 0x80, 0x01, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xCB, 0xD0, 0x0B, 0xD1, 0xF8, 0x07,
-    0xE0, 0x7F, 0x03, 0xF0, 0x0F, 0xC3, 0xF0, 0x03, 0xF7, 0xF4, 0x00, 0xBF, 0xF8, 0x00, 0x1F, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x70, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0E, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x1F,
-    0x8B, 0xC0, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC7, 0xFF, 0xFC, 0x3F, 0xFF, 0xC7,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0x41, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x2D, 0x00, 0xF4, 0x3C, 0x00, 0xF0, 0x3C, 0x01, 0xE0, 0xB8, 0x02, 0xD0, 0xF0,
-    0x03, 0xC0, 0xF0, 0x07, 0xC1, 0xE0, 0x0B, 0x82, 0xD0, 0x0F, 0x03, 0xC0, 0x0F, 0x07, 0x80, 0x1E,
-    0x0B, 0x40, 0x2D, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x78, 0x2E, 0x00, 0xB4, 0x3C, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x2A, 0x40, 0x3F, 0xC0, 0x1F, 0xC0, 0x0B, 0xE0, 0x03, 0xF4,
-    0x02, 0xFC, 0x02, 0xA8, 0x03, 0xF4, 0x07, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x7F, 0x00, 0x02, 0xA4,
-    0x1F, 0xD0, 0xBE, 0x03, 0xF0, 0x3F, 0x81, 0xFC, 0x00, 0x2A, 0x40, 0x3F, 0xC0, 0x1F, 0xC0, 0x0B,
-    0xE0, 0x03, 0xF4, 0x02, 0xFC, 0x2A, 0x4A, 0xA0, 0x0F, 0xF1, 0xFD, 0x01, 0xFC, 0x3F, 0x80, 0x2F,
-    0x87, 0xF0, 0x03, 0xF4, 0xBE, 0x00, 0xBF, 0x0F, 0xD0, 0x02, 0xA8, 0x6A, 0x40, 0xFD, 0x3F, 0xC0,
-    0x7F, 0x0F, 0xD0, 0x3F, 0x4B, 0xF0, 0x2F, 0xC3, 0xF4, 0x1F, 0xC3, 0xF8, 0x00, 0x02, 0xA4, 0x1F,
-    0xD0, 0xBE, 0x03, 0xF0, 0x3F, 0x81, 0xFC, 0x00, 0x2A, 0x4A, 0xA0, 0x0F, 0xF1, 0xFD, 0x01, 0xFC,
-    0x3F, 0x80, 0x3F, 0x83, 0xF0, 0x03, 0xF0, 0xBE, 0x00, 0xBF, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x01, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xE1, 0x1F, 0x54, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0B,
-    0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x2C, 0x00,
-    0x01, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xF4, 0x00, 0x01,
-    0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x1B, 0xD4, 0x02, 0xFF, 0xFE,
-    0x07, 0xFF, 0xFE, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x1F,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xE0, 0x01, 0xF5, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0,
-    0x00, 0x03, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xE0, 0x3F,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF0, 0x2A, 0xAA, 0xAA, 0x80, 0x00, 0x01,
-    0xD0, 0x3F, 0x83, 0xFE, 0x7F, 0x87, 0x40, 0x00, 0x00, 0x0A, 0x0B, 0xC3, 0xF2, 0xFC, 0x0A, 0x0B,
-    0xC3, 0xF2, 0xFC, 0x0A, 0x40, 0xA0, 0x1A, 0x2F, 0x42, 0xF0, 0x3E, 0x3F, 0x03, 0xF0, 0xBE, 0x7F,
-    0x0B, 0xF0, 0xFD, 0x3C, 0xF0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x0A, 0x00, 0xF0, 0x00, 0x3E, 0x03,
-    0xC0, 0x00, 0x37, 0x0F, 0x40, 0x00, 0x7A, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8, 0x61,
-    0x90, 0x03, 0xF0, 0xE6, 0xA0, 0x0B, 0xC1, 0xA3, 0x90, 0x2F, 0x00, 0xD3, 0x80, 0x29, 0x00, 0x00,
-    0x00, 0x02, 0xA8, 0x07, 0xF4, 0x0B, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x7F, 0x00, 0x02, 0xA8, 0x6A,
-    0x01, 0xFD, 0x3F, 0xC0, 0xBF, 0x0F, 0xD0, 0x3F, 0x4B, 0xF0, 0x2F, 0xC3, 0xF0, 0x1F, 0xC3, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0xC2, 0xC2, 0xE0, 0xF0, 0xF0, 0xF0, 0xB8, 0x78, 0x38, 0x2C,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x78, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0xB4, 0x3C, 0xB8, 0x2D, 0x3C, 0x0E, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0B, 0x43,
-    0xC3, 0xD2, 0xE0, 0xB4, 0xB8, 0x3C, 0x0E, 0x0E, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x0F, 0xE0, 0x0B, 0xEF, 0x82, 0xA4, 0xA9, 0x00, 0x00, 0x00, 0x40, 0x0F, 0x01, 0xF4, 0x2F, 0x02,
-    0xF0, 0x0B, 0xE0, 0x0B, 0xD0, 0x0F, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x80, 0x07, 0xD0,
-    0x03, 0xE0, 0x03, 0xE0, 0x2F, 0x41, 0xF8, 0x03, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x03, 0xF9,
-    0xFC, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x01, 0xFE, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF7, 0xFC, 0x00, 0x00, 0x2F, 0xBF, 0xFE, 0x03, 0xE0, 0x03, 0xF3, 0xFF,
-    0x80, 0x7E, 0x00, 0xBE, 0x3F, 0xF0, 0x0F, 0xD0, 0x0A, 0xAF, 0xFF, 0x40, 0xA8, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x7F, 0xE0,
-    0x2F, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x03,
-    0xC0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00,
-    0x07, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x3F, 0xD0, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x2F,
-    0xFF, 0xE0, 0x07, 0xFC, 0x7C, 0x00, 0x1F, 0x0F, 0x00, 0x0F, 0x87, 0xC0, 0x03, 0xD2, 0xF0, 0x01,
-    0xF5, 0xF4, 0x00, 0xBE, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xD7, 0xFF, 0xFC, 0x29, 0x06, 0x8B, 0xFF, 0xD1, 0xFF, 0xD0, 0x01,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0xC8, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x27, 0x68, 0x00, 0x29, 0xD7, 0x20, 0xEF, 0xFF, 0xF8, 0x2F, 0xD3, 0xF8, 0x1F, 0xFF,
-    0xFF, 0x46, 0xA5, 0x5C, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x06, 0xF9, 0x00,
-    0x1F, 0xFF, 0xC1, 0xFF, 0xFD, 0x00, 0xF9, 0x0F, 0x8B, 0xD0, 0xBC, 0x01, 0x40, 0x2F, 0x04, 0x01,
-    0xF0, 0x00, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x0F, 0xF8,
-    0x00, 0xBF, 0x80, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0xD0, 0x00, 0xBF, 0x00, 0x00, 0x24, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x01, 0xA0, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0,
-    0x00, 0x0B, 0xD0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x14, 0x01, 0xFF, 0xFC, 0x00, 0x2C, 0x03, 0xF4, 0x3F, 0x00,
-    0x3C, 0x00, 0x40, 0x1F, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0xF0,
-    0x00, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0x2F, 0xF0, 0x03, 0xD0, 0x00,
-    0xBF, 0x80, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x03, 0x40, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x80, 0x00, 0xFD, 0x00, 0x0F, 0x80, 0x01, 0xFD, 0x00, 0x2F, 0x80, 0x03, 0xFC,
-    0x00, 0x3F, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x6F, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0xBC, 0x00, 0x0F, 0xA0,
-    0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00,
-    0x3D, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x7F, 0xC0, 0x00, 0xF8, 0x1F, 0xF0, 0x00, 0x0F, 0x42, 0xF8,
-    0x00, 0x00, 0x30, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1A, 0x00, 0x00, 0x2F, 0xC3, 0xF0, 0x00,
-    0x03, 0xFC, 0x7F, 0x00, 0x00, 0x7F, 0x8B, 0xF0, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x0F, 0x80, 0x2F, 0x00, 0x00, 0x7E, 0x00, 0xF4, 0x00, 0x03, 0xF4, 0x0B, 0x80, 0x00, 0x0A, 0x80,
-    0x3C, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0x5F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x07, 0xD7, 0xF0, 0x00, 0x00, 0x3F, 0x1A,
-    0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0xC9, 0x2B, 0xA3, 0xAD, 0x35, 0xC3,
-    0xF8, 0x1E, 0x00, 0x00, 0x50, 0x1D, 0x06, 0xC1, 0x9C, 0x3F, 0xD0, 0x34, 0x00, 0x00, 0xFE, 0x18,
-    0x02, 0xF8, 0x01, 0xC2, 0x3C, 0x7F, 0x46, 0x90, 0x07, 0xF1, 0xD0, 0x3F, 0x83, 0x9C, 0x71, 0xC3,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xC0, 0x34, 0x0B, 0x00, 0xE0, 0x2C, 0x01, 0x40, 0x06,
-    0x80, 0xCA, 0x1C, 0xD0, 0xFC, 0x71, 0xC7, 0xF8, 0x04, 0x00, 0x0B, 0xC2, 0x89, 0x30, 0x93, 0x5D,
-    0x2F, 0xC1, 0x68, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xE0, 0x03, 0xFF, 0xF8, 0x07,
-    0xF4, 0xBC, 0x0B, 0xC0, 0x7C, 0x0F, 0x40, 0xF8, 0x1F, 0x00, 0xF4, 0x3F, 0x02, 0xF0, 0x3F, 0x03,
-    0xF0, 0xBE, 0x07, 0xF0, 0x06, 0x81, 0xC9, 0x3A, 0x93, 0x6D, 0x72, 0xC7, 0xF4, 0x2E, 0x00, 0x01,
-    0x80, 0x7C, 0x02, 0x80, 0x34, 0x07, 0x01, 0xB4, 0x3F, 0xC0, 0x07, 0xF0, 0x24, 0xD0, 0x03, 0x40,
-    0x3C, 0x07, 0xC0, 0x7E, 0x43, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x90, 0x07, 0x01, 0xF8, 0x00, 0xB0,
-    0xBF, 0x41, 0xA4, 0x00, 0x00, 0x80, 0x3C, 0x0E, 0xC3, 0x68, 0xBF, 0xC0, 0x74, 0x0B, 0x00, 0x00,
-    0x01, 0xFD, 0x28, 0x03, 0x40, 0x3F, 0x40, 0x38, 0xBF, 0x06, 0x80, 0x01, 0xF8, 0x19, 0x00, 0xFD,
-    0x07, 0x6C, 0x2C, 0x70, 0xB7, 0x80, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x03, 0x80, 0x70, 0x0E, 0x01,
-    0xD0, 0x3C, 0x02, 0x40, 0x06, 0xC0, 0xCA, 0x1C, 0xD0, 0xFC, 0x34, 0xCB, 0x6C, 0x3E, 0x40, 0x0B,
-    0xC2, 0x89, 0x30, 0xA3, 0x5D, 0x2F, 0xC1, 0x68, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x02,
-    0xF4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00,
-    0x7C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x03, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0xF8, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0x2C, 0x00, 0x00, 0x0E, 0x38, 0x00, 0x00, 0x2C, 0xB0, 0x00, 0x00, 0x38, 0xE0,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xC0, 0x02, 0xFF, 0xCF, 0x40,
-    0x07, 0xFF, 0x5D, 0x00, 0x0F, 0xDF, 0x3C, 0x00, 0x2F, 0xDD, 0x74, 0x00, 0x3F, 0xBC, 0xF0, 0x00,
-    0x3F, 0xF5, 0xD0, 0x00, 0x7F, 0xF3, 0xD8, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-    0x2F, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x0E, 0x38, 0x00, 0x00, 0x2C, 0xB0, 0x00, 0x00,
-    0x38, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0,
-    0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0x90, 0x10, 0x07, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x02, 0xFC, 0x1A, 0xA0, 0x0F, 0xE0, 0xBF, 0xC0, 0x3F, 0x83, 0xD0, 0x01, 0xFF, 0x1E,
-    0x60, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xF4, 0x01, 0xF0, 0x05, 0x03, 0xFF,
-    0xFD, 0x01, 0xFF, 0xFF, 0x00, 0x07, 0x80, 0x00, 0x1F, 0xFF, 0xF0, 0x0B, 0xFF, 0xF8, 0x00, 0x1F,
-    0x00, 0x00, 0x6F, 0x40, 0x00, 0xFF, 0xFE, 0x80, 0x3F, 0xFF, 0xF4, 0x0A, 0xAA, 0xA9, 0x00, 0x00,
-    0x01, 0x50, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0x07, 0xD0, 0x00, 0x0B, 0xF4, 0x0B, 0xC0, 0x00, 0x0F,
-    0xF8, 0x0F, 0x80, 0x00, 0x1F, 0xFC, 0x1F, 0x40, 0x00, 0x3F, 0xFC, 0x2F, 0x00, 0x1A, 0xBF, 0xFE,
-    0xBF, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFE, 0x3E, 0xFC, 0x00, 0x01, 0xFD, 0x3F, 0xF8,
-    0x00, 0x02, 0xFC, 0x3F, 0xF4, 0x00, 0x03, 0xFC, 0x3F, 0xF0, 0x00, 0x07, 0xF8, 0x2F, 0xF0, 0x00,
-    0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xFF,
-    0x00, 0x05, 0xFD, 0x6F, 0x94, 0x3F, 0xFF, 0xFF, 0xFC, 0x02, 0xF0, 0x1F, 0x80, 0x03, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0F, 0xE9, 0x40, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x07, 0x40, 0x00,
-    0x00, 0x07, 0x81, 0xD0, 0x00, 0x00, 0x02, 0xD0, 0xB4, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x3F,
-    0x80, 0x3E, 0xFF, 0x00, 0x3E, 0xA0, 0x1F, 0xFF, 0x00, 0x0C, 0x00, 0x0B, 0xFF, 0xC0, 0x03, 0xE4,
-    0x03, 0xF0, 0xF0, 0x00, 0x2F, 0x40, 0xF8, 0x7C, 0x00, 0x01, 0xF0, 0xBD, 0x2F, 0x40, 0x7E, 0xF8,
-    0x3F, 0x0F, 0xD0, 0x3F, 0xFC, 0x0A, 0x82, 0xA0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x02, 0x80, 0x3C, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0xB4, 0x03, 0xC0, 0x03, 0xC0, 0x0F,
-    0x0A, 0x0F, 0x01, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0x07, 0xDF, 0xCF, 0x00, 0x1F, 0xFF,
-    0xB8, 0x00, 0x7F, 0xFF, 0xC0, 0x01, 0xFE, 0xBF, 0x00, 0x07, 0xF2, 0xF8, 0x00, 0x1F, 0x8B, 0xC0,
-    0x00, 0x7D, 0x2F, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x01, 0x40, 0x2F, 0xFF,
-    0xC0, 0xF0, 0x0F, 0xC0, 0xB4, 0x78, 0x03, 0xC0, 0x1D, 0x2D, 0x01, 0xD2, 0x8B, 0x4F, 0x00, 0xB2,
-    0xE3, 0xC3, 0xC0, 0x3C, 0xB4, 0xF2, 0xE0, 0x0E, 0x3C, 0x00, 0xF4, 0x07, 0x4F, 0x40, 0x7C, 0x02,
-    0xC3, 0xF9, 0xBF, 0x00, 0xF0, 0x3F, 0xFF, 0x80, 0x00, 0x01, 0xAB, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x06, 0xBE, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x2F, 0xBC, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x2D, 0x1F, 0x40, 0x00, 0xE0, 0x7C, 0x00, 0x07, 0x43, 0xE0, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x14, 0x50, 0x00, 0x2A, 0xAA, 0xA0, 0x02, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFE, 0xA4,
-    0x00, 0xBE, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xE0,
-    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xE6, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x2F, 0xFD, 0x00, 0x1F, 0xFD, 0x00, 0x02, 0xFF, 0x84, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF4,
-    0x00, 0x7F, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x4F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x3E, 0x1F, 0xD0, 0x01, 0xAB, 0xFA, 0xFF,
-    0xA9, 0x00, 0x7D, 0x02, 0xF0, 0x01, 0x5F, 0xD6, 0xFF, 0x54, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xA5, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x6F, 0xA4, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0xFF, 0xBC, 0x04, 0x02, 0xFC, 0x3C, 0x00, 0x03, 0xF4, 0x78, 0x00, 0x07, 0xF0, 0xB4, 0x00, 0x0F,
-    0xE0, 0xFE, 0x94, 0x0F, 0xD0, 0xFF, 0xFD, 0x0F, 0xC1, 0xFF, 0xFD, 0x1F, 0xD2, 0xE2, 0xF4, 0x0F,
-    0xFB, 0xEB, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xF9, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0x06, 0x40, 0x00, 0x0F,
-    0xEA, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x74, 0x00, 0x6F, 0xD0, 0x2F, 0xFD, 0x07, 0xEE, 0x00,
-    0xFA, 0xD0, 0x1F, 0x3C, 0x02, 0xF3, 0xC0, 0x2F, 0xFC, 0x01, 0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x1E,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x55, 0x7F, 0x55, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0x00, 0x0F, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x01,
-    0xF8, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xF1,
-    0x80, 0x0F, 0xFE, 0x01, 0xBF, 0xF4, 0x1F, 0xF9, 0x80, 0xBF, 0xFF, 0x01, 0x7F, 0xF8, 0x0F, 0xF9,
-    0x2E, 0x7F, 0xC3, 0xF0, 0x1F, 0xBF, 0x00, 0xBF, 0xE0, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xC0, 0x0B, 0xFE, 0xBC, 0x00, 0xFA, 0xDB, 0x80, 0x0F, 0x3C, 0xF4, 0x01, 0xF3,
-    0xCF, 0x00, 0x2E, 0x79, 0xF0, 0x03, 0xDB, 0x6E, 0x00, 0x3C, 0xF3, 0xD0, 0x07, 0xDF, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x07, 0xD0, 0x2E, 0x00, 0x02, 0xF0, 0x2F, 0x80, 0x05, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xE9, 0x40, 0x00, 0x03,
-    0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00,
-    0x03, 0xC1, 0xBD, 0x0F, 0xEF, 0xFD, 0x2F, 0xFF, 0x90, 0x7F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x60, 0x00, 0x00, 0x06, 0x00, 0x00, 0x2F, 0x80, 0x01, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xF4, 0x3F, 0x7D, 0xFC, 0xB8, 0x7C, 0x38, 0x10, 0xB8, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x7E, 0x43, 0xD0, 0x3F, 0xFE, 0xF0, 0x06, 0xFF,
-    0xFC, 0x00, 0x06, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x09, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3D, 0x00,
-    0x0B, 0x4B, 0x87, 0x41, 0xF9, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0, 0x00, 0xBF, 0xF4, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x38,
-    0x00, 0x2C, 0x01, 0x00, 0xB4, 0x01, 0xE6, 0xFF, 0xE4, 0xF0, 0x0F, 0xFF, 0x9B, 0xFF, 0xF0, 0xFF,
-    0x90, 0x00, 0x6F, 0xD1, 0xF8, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xE0, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x01, 0xFD, 0x00, 0xBF,
-    0xF4, 0x3E, 0xFB, 0xCB, 0x4E, 0x28, 0x01, 0xD0, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00,
-    0x03, 0x80, 0x00, 0x3C, 0x00, 0x02, 0xC0, 0x01, 0x1D, 0x00, 0xB8, 0xE3, 0xC2, 0xFF, 0xFC, 0x07,
-    0xFF, 0x00, 0x0B, 0xC0, 0x00, 0x14, 0x00, 0x00, 0x1A, 0x81, 0xBF, 0xFF, 0x0F, 0xFE, 0x40, 0x3F,
-    0xF8, 0x00, 0xFE, 0xFD, 0x02, 0xE1, 0xFF, 0x4B, 0xC0, 0x7F, 0x6E, 0x00, 0x28, 0x0E, 0x90, 0x00,
-    0x3F, 0xFF, 0x90, 0x06, 0xFF, 0x80, 0x0B, 0xFE, 0x02, 0xFE, 0xF8, 0x7F, 0xC3, 0xDB, 0xF4, 0x0F,
-    0x4D, 0x00, 0x3D, 0x08, 0x00, 0x02, 0xE0, 0x00, 0x1F, 0x02, 0x80, 0xF4, 0x3C, 0x07, 0xC7, 0x80,
-    0x3D, 0xB4, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0xFE, 0x07, 0xFF, 0xD0, 0x06, 0xBC, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0xF4, 0x24, 0x1F, 0x03, 0x83, 0xD0, 0x3C, 0x7C, 0x02, 0xCF, 0x40, 0x1F, 0xF0,
-    0x00, 0xFD, 0x00, 0x0F, 0xFF, 0xC0, 0xBF, 0xFC, 0x07, 0xE5, 0x00, 0x02, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x83, 0xFA, 0xAA, 0xA8,
-    0x2F, 0xEA, 0xAA, 0x90, 0x7F, 0xFF, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1D, 0xB0, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x3F, 0xCF,
-    0xE0, 0x03, 0xFE, 0x7F, 0xD0, 0x7F, 0xB6, 0xDF, 0xC3, 0xE2, 0xCF, 0x1F, 0x09, 0x0F, 0x38, 0x10,
-    0x00, 0x3A, 0xD0, 0x00, 0x02, 0xDF, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x3D, 0xE0, 0x00, 0x01,
-    0xDB, 0x40, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x01, 0xF0, 0x1F, 0xFF, 0xFF, 0x81, 0xAA, 0xAA, 0xFD, 0x2A, 0xAA, 0xAF, 0xC7,
-    0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x41,
-    0x00, 0x00, 0x03, 0x9E, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x2C, 0xF0, 0x00, 0x00, 0x76, 0xD0,
-    0x00, 0x00, 0xE7, 0x80, 0x01, 0x43, 0xCF, 0x04, 0x0F, 0x8B, 0x3C, 0x3C, 0x0F, 0xDE, 0xB7, 0xF4,
-    0x0F, 0xFD, 0xFF, 0x40, 0x0B, 0xF3, 0xF8, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x07, 0x9C, 0x00, 0x00,
-    0x01, 0x10, 0x00, 0x02, 0x40, 0x00, 0x0C, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0x3E,
-    0x00, 0xF8, 0x00, 0x01, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x83, 0xFA, 0xAA, 0xAA, 0xFD, 0x2F, 0xEA,
-    0xAA, 0xAF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x03, 0xC0, 0x3D, 0x00,
-    0x00, 0x18, 0x01, 0x80, 0x00, 0x00, 0x38, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xF9, 0x0B, 0xDF,
-    0xFD, 0x2F, 0xCE, 0x14, 0x3F, 0xCE, 0x00, 0x0A, 0xCE, 0x00, 0x01, 0xCE, 0x00, 0x01, 0xCE, 0x00,
-    0x01, 0xCE, 0x00, 0x2E, 0xCE, 0x00, 0x3F, 0xCE, 0x00, 0x0F, 0xCE, 0x78, 0x03, 0xEF, 0xFD, 0x01,
-    0xFF, 0xE4, 0x00, 0x7E, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x07,
-    0xFD, 0xB4, 0x07, 0xFF, 0xFC, 0x07, 0xF0, 0xFE, 0x02, 0xF0, 0x2F, 0x40, 0xF8, 0x0B, 0xC0, 0x3E,
-    0x0B, 0xD0, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x06, 0xFE, 0xBD, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x5F, 0xF4, 0x00, 0x3F,
-    0x42, 0xFF, 0x80, 0x0F, 0xD0, 0xBD, 0xFC, 0x00, 0xF8, 0x2F, 0x0F, 0xC0, 0x2F, 0x4F, 0xC0, 0xF8,
-    0x03, 0xF3, 0xF0, 0x2F, 0x40, 0x3F, 0xF8, 0x03, 0xF0, 0x07, 0xFE, 0x06, 0xFE, 0x00, 0x7F, 0xFF,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3D, 0x6F, 0xFE, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x3F, 0xF4, 0x00, 0x0B, 0xEF, 0x80, 0x01, 0xF8, 0xFC, 0x00, 0x3F, 0x0F, 0xC0, 0x0F, 0xC0, 0xFD,
-    0x02, 0xF8, 0x0F, 0xD0, 0x7F, 0x00, 0xBE, 0x0F, 0xC0, 0x0B, 0xF2, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0xE2, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF0, 0x0F,
-    0x43, 0xE0, 0x07, 0xC1, 0xF4, 0x02, 0xF0, 0xBC, 0x00, 0xF8, 0x3E, 0x00, 0x3D, 0x0F, 0x40, 0x1F,
-    0x07, 0xC0, 0x0B, 0xC2, 0xF0, 0x03, 0xE0, 0xF8, 0x01, 0xF4, 0x3D, 0x00, 0xBC, 0x1F, 0x00, 0x15,
-    0x05, 0x40, 0x00, 0x54, 0x05, 0x00, 0x1F, 0x07, 0xC0, 0x03, 0xD0, 0xF4, 0x00, 0xF8, 0x3F, 0x00,
-    0x2F, 0x0B, 0xC0, 0x07, 0xC0, 0xF4, 0x00, 0xF4, 0x3E, 0x00, 0x3E, 0x0B, 0xC0, 0x0B, 0xC1, 0xF0,
-    0x01, 0xF4, 0x3D, 0x00, 0x3E, 0x0F, 0x80, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x3F, 0xFF, 0xD0, 0x0A, 0xAA, 0xA0, 0x00, 0x0A,
-    0xBF, 0xC2, 0xFF, 0xFD, 0x15, 0x55, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x07, 0xD4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x0B, 0x0F, 0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x01, 0xFF, 0xCF, 0xF4, 0x07,
-    0xFF, 0xFF, 0xFC, 0x0F, 0x81, 0xF8, 0x3C, 0x1F, 0x00, 0xE0, 0x3C, 0x2E, 0x02, 0xE0, 0x7C, 0x2F,
-    0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xE0, 0x0B, 0xF8, 0xBF, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3E, 0x04, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0x9B, 0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x01, 0xFC, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x0F, 0xC0,
-    0x2F, 0xC0, 0x3F, 0xC0, 0x01, 0xA4, 0x14, 0x0B, 0xFD, 0x3D, 0x1F, 0x5F, 0xFC, 0x0B, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0xE0, 0x3F, 0xF5, 0xF0, 0xBC, 0x7F, 0xD0, 0x14, 0x1A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xF9, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00,
-    0x06, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x03, 0xFA, 0x50, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00,
-    0x15, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x6F, 0xFC, 0x01, 0x6F, 0xFF, 0xE8, 0x03, 0xFF, 0xE4, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x04,
-    0x05, 0x6B, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFA, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_8_bolditalicBitmaps[22455] = {
+    0x77, 0x1A, 0x7A, 0xC9, 0x6D, 0x95, 0x9D, 0x6A, 0xCA, 0x6D, 0x95, 0x9D, 0x6A, 0xD6, 0xDA, 0x59,
+    0xD6, 0x9D, 0x7A, 0xA7, 0x77, 0x77, 0x4A, 0xDA, 0x5E, 0x94, 0xAE, 0x94, 0xF5, 0xAA, 0xAA, 0x40,
+    0x0A, 0xAA, 0x90, 0xAA, 0xAA, 0x2E, 0xA0, 0xAE, 0x2E, 0xA0, 0x9E, 0x2A, 0xE1, 0xE2, 0x9E, 0x1E,
+    0xA2, 0xE9, 0x0A, 0xE0, 0x70, 0xD2, 0xD7, 0x4A, 0xD1, 0xAD, 0x74, 0xDA, 0x1D, 0xA7, 0x39, 0xD1,
+    0x9D, 0x70, 0xAF, 0xFF, 0xF3, 0xFF, 0xFF, 0x49, 0x99, 0xE9, 0x9A, 0xD9, 0x99, 0x99, 0x7D, 0xA1,
+    0xDA, 0x73, 0xAD, 0x90, 0x9D, 0x97, 0x9F, 0xFF, 0xF3, 0xFF, 0xFF, 0x93, 0x99, 0x9E, 0x99, 0xE9,
+    0x99, 0x99, 0x69, 0xE1, 0xE7, 0x3A, 0xD9, 0x09, 0xD9, 0x73, 0xAA, 0xA1, 0xAA, 0xA7, 0x10, 0x72,
+    0x99, 0x74, 0xD7, 0x4D, 0x70, 0x9F, 0xCA, 0x94, 0x9F, 0xF4, 0x9F, 0x9D, 0xA5, 0xE9, 0x1D, 0x6E,
+    0x19, 0xD6, 0xEA, 0x9A, 0xCA, 0x6F, 0xEA, 0x7A, 0xFE, 0x70, 0x9A, 0xFC, 0x70, 0x9F, 0xC2, 0x9C,
+    0x92, 0xAF, 0xC1, 0x9F, 0xAA, 0xFC, 0x90, 0xAF, 0xFE, 0x92, 0x9A, 0xFE, 0x97, 0x2A, 0xC9, 0x73,
+    0xD7, 0x4D, 0x50, 0x74, 0xAA, 0x74, 0xAC, 0x93, 0xAD, 0xA3, 0xAC, 0xA3, 0xAC, 0x09, 0xC2, 0x9D,
+    0x4C, 0x90, 0x9C, 0x19, 0xD4, 0x9C, 0x1D, 0x1D, 0x59, 0xF9, 0x0D, 0x96, 0xAD, 0x90, 0xD9, 0x73,
+    0xDA, 0x9E, 0x96, 0xAD, 0x9C, 0xA0, 0xCA, 0x5A, 0xD0, 0xAC, 0x1C, 0xA4, 0x9D, 0x1C, 0xA0, 0x9C,
+    0x93, 0x9D, 0x91, 0xFC, 0x4D, 0xA3, 0xDA, 0x4A, 0xAA, 0x73, 0x4A, 0xE9, 0x7D, 0x99, 0xAC, 0x95,
+    0xD3, 0xD5, 0xD3, 0xCA, 0x5D, 0x19, 0xD9, 0x59, 0xFC, 0x96, 0x9F, 0x79, 0xF9, 0x29, 0x91, 0x9D,
+    0xA0, 0xD9, 0x0A, 0xD1, 0xE2, 0xDA, 0xD9, 0x1E, 0x29, 0xF2, 0xFF, 0xD9, 0x2A, 0xFF, 0xC9, 0x39,
+    0xFA, 0x19, 0x77, 0x00, 0xF0, 0xAE, 0x09, 0xE1, 0xE1, 0xEA, 0x09, 0xAA, 0xA0, 0x7A, 0xCA, 0x7A,
+    0xD9, 0x69, 0xD9, 0x69, 0xDA, 0x7E, 0x7A, 0xD7, 0x0D, 0x97, 0xE7, 0x9D, 0x97, 0xAD, 0x70, 0xDA,
+    0x79, 0xD7, 0x0A, 0xD7, 0x0E, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xE7, 0x0E, 0x70, 0xAD,
+    0x70, 0x9D, 0x97, 0x0E, 0x70, 0xAD, 0x60, 0x9D, 0x70, 0xE7, 0x0D, 0xA7, 0x9D, 0xA7, 0xAD, 0x70,
+    0xE7, 0x0D, 0x97, 0xAD, 0x70, 0xDA, 0x7A, 0xD7, 0x9D, 0x97, 0xDA, 0x7A, 0xD7, 0xAD, 0x79, 0xD7,
+    0x9D, 0x79, 0xD7, 0xAD, 0x7A, 0xD7, 0xE7, 0xDA, 0x6A, 0xD9, 0x6D, 0xA1, 0x77, 0xAC, 0x94, 0x9A,
+    0x0D, 0x09, 0xC1, 0x9F, 0xF2, 0xAF, 0xC9, 0x39, 0xFC, 0xA2, 0xFF, 0xA1, 0xAC, 0x0D, 0x0A, 0xA4,
+    0x9D, 0x77, 0x59, 0x96, 0xAC, 0xA6, 0xD9, 0x6D, 0x3A, 0xFF, 0x0F, 0xFA, 0x3D, 0x96, 0xD6, 0x9D,
+    0x79, 0x40, 0x2A, 0xAA, 0x91, 0x9E, 0x91, 0xAD, 0xA2, 0xE2, 0xEA, 0x19, 0xE2, 0x0F, 0xF0, 0x9F,
+    0xF0, 0x1A, 0xA9, 0x0A, 0xD9, 0x0E, 0x09, 0xE0, 0x77, 0x77, 0x4A, 0xA7, 0x70, 0xD7, 0x70, 0xAC,
+    0xA7, 0x70, 0xD7, 0x70, 0xAC, 0xA7, 0x79, 0xD7, 0x70, 0xD9, 0x77, 0x9D, 0x77, 0x0D, 0x97, 0x7A,
+    0xD7, 0x70, 0xD9, 0x77, 0xAD, 0x77, 0x9D, 0x77, 0x0D, 0xA7, 0x79, 0xD7, 0x70, 0xDA, 0x77, 0xAD,
+    0x77, 0x0D, 0xA7, 0x7A, 0xD7, 0x70, 0xD9, 0x77, 0xE7, 0x79, 0xD9, 0x77, 0xE7, 0x79, 0xD9, 0x77,
+    0xDA, 0x77, 0xAD, 0x77, 0x0C, 0x97, 0x70, 0x97, 0x71, 0x49, 0xAD, 0x95, 0xAD, 0xAD, 0x93, 0xAD,
+    0x2D, 0x29, 0xD3, 0xD2, 0xE9, 0xCA, 0x0D, 0x2D, 0x9D, 0xA9, 0xD1, 0x9D, 0x0D, 0x9D, 0xA1, 0xAD,
+    0x0D, 0x0D, 0xA1, 0xE2, 0xAD, 0x2E, 0x90, 0xAE, 0x2F, 0xF9, 0x2F, 0xEA, 0x39, 0xFC, 0xA5, 0x9A,
+    0xCA, 0x94, 0x59, 0xAA, 0x49, 0xF4, 0xFA, 0x4C, 0x9D, 0x95, 0x9D, 0x6A, 0xD6, 0xDA, 0x59, 0xD9,
+    0x5A, 0xD6, 0xE3, 0x9F, 0xE1, 0xFF, 0x1F, 0xF0, 0x4A, 0xF9, 0x5F, 0xE9, 0x4D, 0xA9, 0x9E, 0x49,
+    0x3A, 0xD7, 0x1D, 0xA7, 0x0A, 0xD9, 0x7A, 0xDA, 0x69, 0xF6, 0xAF, 0x59, 0xFC, 0x6F, 0xF3, 0xAF,
+    0xF3, 0xFF, 0xC2, 0x4A, 0xF9, 0x5A, 0xFD, 0x94, 0xA9, 0x29, 0xD7, 0x19, 0xD7, 0x09, 0xD9, 0x5F,
+    0xCA, 0x5A, 0xFC, 0x71, 0x9D, 0xA7, 0x1D, 0xA3, 0xAC, 0xA9, 0xAE, 0x93, 0xFF, 0x3A, 0xFE, 0x93,
+    0x9A, 0xFA, 0x40, 0x79, 0xCA, 0x69, 0xD9, 0x59, 0xE5, 0x9F, 0x49, 0xCA, 0xAD, 0x39, 0xCA, 0x0D,
+    0xA2, 0x9D, 0x1D, 0x91, 0x9D, 0xAA, 0xF9, 0x0F, 0xFC, 0x90, 0xAA, 0xAA, 0xFC, 0x59, 0xDA, 0x6A,
+    0xD9, 0x6E, 0x75, 0x77, 0xAF, 0xE3, 0xFE, 0xA3, 0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xFC, 0xA4,
+    0x9F, 0xE4, 0x99, 0x19, 0xDA, 0x70, 0xDA, 0x2A, 0x91, 0x9E, 0x91, 0x9F, 0xF2, 0xAF, 0xE3, 0xFD,
+    0xA6, 0x99, 0x95, 0x5A, 0xFA, 0x39, 0xFD, 0x92, 0xAD, 0xA9, 0x99, 0x93, 0xD7, 0x0D, 0xAE, 0xA3,
+    0x9F, 0xEA, 0x2A, 0xE9, 0x9E, 0x2E, 0x91, 0x9D, 0x2D, 0xA2, 0x9D, 0x2D, 0xA2, 0xE2, 0xEA, 0xAE,
+    0x92, 0xAF, 0xDA, 0x4A, 0xEA, 0x93, 0x72, 0xFF, 0xA9, 0xFF, 0x6E, 0x59, 0xD9, 0x5E, 0x5A, 0xD9,
+    0x5E, 0x5A, 0xDA, 0x5E, 0x5E, 0xA4, 0x9E, 0x94, 0xF4, 0x6A, 0xAA, 0x96, 0xAF, 0xD4, 0xAD, 0x90,
+    0x9D, 0x4D, 0x92, 0xD3, 0x9D, 0x90, 0x9E, 0x4F, 0xE5, 0x9F, 0xC9, 0x4E, 0x99, 0xE3, 0xE2, 0x9D,
+    0x91, 0x9D, 0xA2, 0xAD, 0x29, 0xDA, 0x19, 0xE2, 0x9F, 0xFA, 0x3F, 0xEA, 0x59, 0xAC, 0xAA, 0x40,
+    0x4A, 0xEA, 0x49, 0xFD, 0xA3, 0xD9, 0x19, 0xD2, 0xAC, 0x93, 0xD2, 0xD4, 0xD2, 0xCA, 0x3E, 0x2D,
+    0xA9, 0xAE, 0xA2, 0xFF, 0x93, 0xAF, 0xD7, 0x0D, 0xA2, 0xCA, 0xAA, 0xAE, 0x29, 0xFE, 0x92, 0xAF,
+    0xCA, 0x77, 0x00, 0x71, 0x9D, 0xA2, 0xAD, 0xA2, 0xE9, 0x1A, 0xE7, 0x77, 0xDA, 0x2A, 0xDA, 0x2E,
+    0x91, 0xAE, 0x91, 0x75, 0xE5, 0xE4, 0xAE, 0x4F, 0x77, 0x76, 0x99, 0x99, 0x4E, 0xA3, 0x9E, 0x4E,
+    0xA3, 0x9E, 0x4E, 0x94, 0x99, 0x94, 0x71, 0x97, 0x3A, 0xD7, 0x1A, 0xF9, 0x6A, 0xFC, 0x95, 0xAF,
+    0xC9, 0x6F, 0xC9, 0x70, 0xAF, 0xA9, 0x79, 0xFF, 0xA9, 0x69, 0xAF, 0xEA, 0x70, 0x9A, 0xF7, 0x4A,
+    0xC0, 0x75, 0xAF, 0xDA, 0x1A, 0xFE, 0xA7, 0x79, 0x99, 0x99, 0x2F, 0xEA, 0x1A, 0xFD, 0xAA, 0x00,
+    0x39, 0x75, 0xDA, 0x73, 0xFA, 0x72, 0xAF, 0xA7, 0x19, 0xFC, 0xA7, 0x19, 0xFC, 0x79, 0xAF, 0xA3,
+    0x9A, 0xFF, 0xA1, 0x9F, 0xEA, 0x94, 0xAE, 0xA9, 0x70, 0xCA, 0x97, 0x20, 0x77, 0x19, 0xAD, 0xA5,
+    0x9F, 0xE4, 0xE9, 0x1E, 0x49, 0x39, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x09, 0xD9, 0x79, 0xE6, 0xAF,
+    0x6A, 0xEA, 0x7E, 0x97, 0x9E, 0x70, 0xAD, 0xA7, 0x0A, 0x97, 0x77, 0x73, 0x9A, 0xA7, 0x1D, 0xA7,
+    0x0A, 0xDA, 0x70, 0xE9, 0x70, 0x77, 0x73, 0xAE, 0xA7, 0x2A, 0xDA, 0xAA, 0xD7, 0x0D, 0xA4, 0xCA,
+    0x6D, 0x69, 0xC5, 0xD0, 0x9E, 0x92, 0xC4, 0xAC, 0x90, 0xC9, 0x9C, 0x3C, 0x4D, 0x0C, 0x19, 0xC2,
+    0xAC, 0x39, 0xD0, 0xFC, 0x1A, 0xC9, 0x3A, 0xD0, 0xAF, 0xAD, 0x94, 0xAD, 0x93, 0x9A, 0x96, 0x9E,
+    0xA2, 0x99, 0x70, 0xFF, 0xC9, 0x70, 0xAF, 0xE9, 0x72, 0x9A, 0xCA, 0xA9, 0x77, 0x60, 0x70, 0xAD,
+    0x71, 0x9E, 0x71, 0xF9, 0x7A, 0xF9, 0x69, 0xD0, 0xDA, 0x6D, 0xA0, 0xDA, 0x5A, 0xD1, 0xE4, 0x9D,
+    0xA1, 0xE4, 0xE2, 0xE3, 0xAF, 0xFC, 0x29, 0xFF, 0xD9, 0x1F, 0xFE, 0x90, 0xEA, 0x4E, 0xA9, 0xE5,
+    0xEA, 0x3F, 0xDA, 0x59, 0xFF, 0x4A, 0xD9, 0x19, 0xD9, 0x3E, 0x3D, 0x93, 0xDA, 0x29, 0xD3, 0x9D,
+    0xA9, 0x9A, 0xDA, 0x3A, 0xFE, 0xA4, 0xFF, 0xC9, 0x29, 0xDA, 0x3E, 0x2A, 0xD9, 0x3E, 0x2E, 0xAA,
+    0xAA, 0xEA, 0x2F, 0xFD, 0x91, 0x9F, 0xFC, 0xA2, 0xAF, 0xEA, 0x93, 0x77, 0x69, 0xAF, 0xA5, 0x9F,
+    0xEA, 0x4A, 0xFF, 0x4A, 0xEA, 0x92, 0x93, 0x9E, 0x97, 0x1E, 0x97, 0x1A, 0xE7, 0x2E, 0xA7, 0x2E,
+    0xA7, 0x19, 0xF4, 0xA4, 0xFF, 0xD4, 0xFF, 0xCA, 0x49, 0xFF, 0x95, 0xAF, 0xE9, 0x20, 0x3F, 0xEA,
+    0x69, 0xFF, 0xC9, 0x4A, 0xFF, 0xD4, 0xE3, 0x9E, 0x93, 0xE4, 0x9D, 0xA2, 0x9D, 0xA5, 0xDA, 0x2A,
+    0xD9, 0x5D, 0x92, 0xE5, 0xAD, 0x29, 0xDA, 0x49, 0xE2, 0xAD, 0xA2, 0x9A, 0xE9, 0x2F, 0xFF, 0x3F,
+    0xFE, 0x92, 0x9F, 0xFD, 0x93, 0xAF, 0xEA, 0x95, 0x39, 0xAF, 0xE9, 0x3F, 0xFC, 0x4E, 0xAA, 0x99,
+    0x94, 0xAD, 0x72, 0xE7, 0x2E, 0x99, 0xAA, 0x59, 0xFE, 0x5A, 0xFD, 0xA5, 0xE7, 0x19, 0xDA, 0x71,
+    0xAE, 0xAA, 0xAA, 0xA4, 0xFF, 0xC9, 0x29, 0xFF, 0xC3, 0xAF, 0xFC, 0x30, 0x39, 0xAF, 0xDA, 0x3A,
+    0xFE, 0x93, 0xEA, 0x99, 0x99, 0x39, 0xD9, 0x70, 0xAD, 0x71, 0xFE, 0xA3, 0x9F, 0xE9, 0x3A, 0xFE,
+    0x4E, 0x70, 0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xE9, 0x79, 0xE7, 0x0A, 0xE7, 0x00, 0x79, 0xAA, 0xAA,
+    0xA9, 0x6A, 0xFF, 0x94, 0xFF, 0xD9, 0x3F, 0xA4, 0x93, 0xAE, 0x73, 0xE9, 0x72, 0x9E, 0x73, 0xEA,
+    0x29, 0xCA, 0xA9, 0x92, 0xE9, 0x2A, 0xFC, 0x91, 0xE3, 0x9A, 0xF9, 0x09, 0xE9, 0x4A, 0xD9, 0x2F,
+    0xCA, 0xAA, 0xF3, 0xFF, 0xEA, 0x4F, 0xFD, 0x95, 0xAA, 0xFA, 0x93, 0x3A, 0xD4, 0x9D, 0x93, 0xE4,
+    0xAD, 0x39, 0xDA, 0x4E, 0x3A, 0xD9, 0x39, 0xE3, 0xE4, 0xAD, 0xA3, 0xE4, 0xE9, 0x2A, 0xDA, 0x39,
+    0xE3, 0xFA, 0xAA, 0xAF, 0x3F, 0xFE, 0xA2, 0x9F, 0xFE, 0x92, 0xAF, 0xFE, 0x3E, 0xA3, 0xF2, 0x9E,
+    0x93, 0xEA, 0x2A, 0xE3, 0x9E, 0x92, 0x3E, 0x4E, 0x39, 0xD9, 0x3A, 0xD4, 0xE4, 0xDA, 0x39, 0xD9,
+    0x3A, 0xD4, 0xE4, 0xDA, 0x3A, 0xDA, 0x3E, 0x92, 0x9E, 0x39, 0xE3, 0x72, 0x9D, 0xA7, 0x2E, 0x73,
+    0xE7, 0x2A, 0xD9, 0x72, 0xE7, 0x29, 0xDA, 0x72, 0xAD, 0x97, 0x2E, 0x72, 0x9D, 0xA7, 0x2E, 0x73,
+    0xE7, 0x2A, 0xD9, 0x72, 0xE6, 0x92, 0xAD, 0xA5, 0x9F, 0xE6, 0xFE, 0xA5, 0x9F, 0xDA, 0x70, 0x99,
+    0x99, 0x70, 0x4A, 0xD1, 0xAE, 0x5E, 0x09, 0xE5, 0x9D, 0x90, 0xE6, 0xE0, 0xE9, 0x6D, 0xAE, 0x96,
+    0xAF, 0xC9, 0x7F, 0xCA, 0x79, 0xFA, 0x70, 0xAF, 0xA7, 0x0F, 0xD9, 0x69, 0xFE, 0x95, 0xE9, 0xAF,
+    0x5E, 0x1F, 0xC3, 0xAD, 0xA1, 0xAF, 0xC2, 0x39, 0xD9, 0x6A, 0xD7, 0xE6, 0x9D, 0xA6, 0xAD, 0x7E,
+    0x69, 0xDA, 0x6A, 0xD9, 0x6E, 0x69, 0xDA, 0x6A, 0xDA, 0x19, 0x99, 0x90, 0xFF, 0xC9, 0x9F, 0xFC,
+    0x0A, 0xFF, 0xC0, 0x3A, 0xE5, 0xE9, 0x3F, 0x4F, 0x4F, 0x92, 0xAF, 0x3A, 0xFA, 0x2F, 0xA3, 0xFC,
+    0xA1, 0xFC, 0x93, 0xFD, 0x0A, 0xFC, 0x39, 0xDA, 0xE0, 0xFD, 0x3A, 0xD9, 0xFD, 0xAD, 0xA3, 0xE0,
+    0xFC, 0xAA, 0xDA, 0x29, 0xDA, 0x0F, 0xC0, 0xE9, 0x2A, 0xDA, 0x0F, 0x99, 0xE3, 0xE9, 0x0F, 0x0F,
+    0x29, 0xE1, 0xE9, 0x0E, 0xA2, 0xAE, 0x19, 0x99, 0x0A, 0xE9, 0x20, 0x49, 0x99, 0x4D, 0xA3, 0x9E,
+    0x39, 0xD9, 0x3A, 0xE9, 0x2A, 0xD4, 0xFA, 0x2E, 0x39, 0xFC, 0x19, 0xD9, 0x3A, 0xFC, 0x1A, 0xD4,
+    0xEA, 0xD1, 0xE3, 0x9E, 0x9D, 0x99, 0xD9, 0x3E, 0xA9, 0xDA, 0xAD, 0x4E, 0x90, 0xFD, 0x3A, 0xE1,
+    0xFC, 0x93, 0xF1, 0xFC, 0x4E, 0xA1, 0xAF, 0x3A, 0xE9, 0x19, 0xEA, 0x30, 0x69, 0xAE, 0xA9, 0x70,
+    0xFF, 0xA6, 0xF9, 0x9A, 0xE9, 0x4E, 0x93, 0x9E, 0x3E, 0x95, 0xE3, 0xDA, 0x6E, 0x2A, 0xD9, 0x6D,
+    0xA2, 0xE6, 0xAD, 0x92, 0xE6, 0xE2, 0x9E, 0xA2, 0x9A, 0xEA, 0x29, 0xFF, 0xF9, 0x3F, 0xFE, 0xA4,
+    0xAF, 0xFC, 0xA6, 0x9A, 0xFC, 0xA7, 0x76, 0x77, 0x19, 0xFD, 0x6A, 0xFE, 0x5D, 0xA2, 0xDA, 0x39,
+    0xD9, 0x2A, 0xCA, 0x3A, 0xD2, 0xAD, 0xA3, 0xFF, 0xC3, 0x9F, 0xF9, 0x3A, 0xFE, 0x94, 0xEA, 0xA9,
+    0x95, 0x9E, 0x71, 0xAD, 0xA7, 0x1E, 0x97, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0x70, 0x99, 0x97, 0x3A,
+    0xFC, 0xA7, 0x9F, 0xFA, 0x59, 0xE9, 0x19, 0xE9, 0x39, 0xE4, 0x9D, 0xA3, 0xE9, 0x5D, 0xA2, 0x9D,
+    0xA5, 0x9D, 0xA2, 0xAD, 0x95, 0x9D, 0x92, 0xE6, 0xE3, 0xE2, 0x92, 0xDA, 0x3E, 0x2D, 0xAE, 0x93,
+    0xFF, 0xEA, 0x4F, 0xFE, 0x59, 0xFF, 0xC7, 0x0A, 0xFE, 0x97, 0x29, 0xFC, 0x73, 0xFC, 0xA7, 0x73,
+    0x4F, 0xCA, 0x5A, 0xFE, 0x4D, 0x92, 0xD9, 0x3D, 0x3D, 0x3A, 0xD2, 0x9D, 0x3D, 0xA1, 0x9D, 0xA3,
+    0xFF, 0x3A, 0xFE, 0x4F, 0xF9, 0x3E, 0x2D, 0xA2, 0xAE, 0x19, 0xDA, 0x2E, 0xA1, 0xAE, 0x2E, 0x91,
+    0xF1, 0xAE, 0x91, 0xF7, 0x60, 0x70, 0x99, 0x97, 0x09, 0xFE, 0x5A, 0xFE, 0x59, 0xE9, 0x29, 0x5A,
+    0xD7, 0x3E, 0x73, 0xFA, 0x97, 0x0A, 0xFD, 0xA7, 0x9F, 0xE7, 0x19, 0xF9, 0x72, 0xEA, 0x29, 0xCA,
+    0x39, 0xE9, 0x19, 0xFF, 0xE2, 0xFF, 0xDA, 0x4A, 0xFD, 0xA4, 0x0F, 0xFF, 0x09, 0xFF, 0xF0, 0xAF,
+    0xFE, 0xA5, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xE9, 0x71, 0xE7, 0x19,
+    0xE7, 0x1A, 0xDA, 0x71, 0xE9, 0x70, 0x9E, 0x70, 0x3E, 0xA3, 0xEA, 0x29, 0xE4, 0xE9, 0x2A, 0xE3,
+    0x9E, 0x3E, 0xA3, 0xAE, 0x3E, 0x93, 0xE9, 0x29, 0xE4, 0xE3, 0xAD, 0xA3, 0x9E, 0x3E, 0x93, 0xAD,
+    0x93, 0xE4, 0xE4, 0xE3, 0xAE, 0x39, 0xFF, 0xD9, 0x39, 0xFF, 0xD4, 0x9F, 0xFC, 0x95, 0xAF, 0xE9,
+    0x77, 0x40, 0xE6, 0xAD, 0x0E, 0x59, 0xDA, 0x0E, 0x94, 0xE1, 0xE9, 0x3E, 0x91, 0xEA, 0x2A, 0xE2,
+    0xAD, 0xA1, 0x9E, 0x3A, 0xE1, 0xEA, 0x3A, 0xE0, 0xAE, 0x4A, 0xEA, 0xE9, 0x4A, 0xFE, 0x59, 0xFD,
+    0x69, 0xFC, 0xA6, 0x9F, 0xC7, 0x9F, 0x97, 0x77, 0x4E, 0x97, 0x2E, 0x1E, 0x97, 0x1A, 0xDA, 0x1E,
+    0x97, 0x1E, 0x2E, 0x92, 0x99, 0x3A, 0xDA, 0x2E, 0x91, 0x9D, 0xA1, 0x9E, 0x29, 0xE2, 0xEA, 0x1E,
+    0xA2, 0x9E, 0x1F, 0xC0, 0x9E, 0x39, 0xE0, 0xFD, 0x0E, 0x93, 0x9E, 0xAF, 0xDA, 0xE4, 0xAF, 0xD9,
+    0xFD, 0x94, 0xAF, 0xD0, 0xFD, 0x5A, 0xFC, 0x1A, 0xF9, 0x5A, 0xF9, 0x1A, 0xF6, 0xAF, 0x2A, 0xE9,
+    0x60, 0x4D, 0xA4, 0x9D, 0x94, 0xE3, 0x9D, 0xA5, 0xAD, 0xA2, 0xDA, 0x7E, 0x1E, 0x70, 0xE9, 0xE7,
+    0x1A, 0xFC, 0x72, 0x9F, 0x97, 0x3E, 0xA7, 0x3F, 0xC7, 0x2F, 0xDA, 0x70, 0xEA, 0xF7, 0xEA, 0x0A,
+    0xE9, 0x49, 0xF2, 0xF3, 0x9F, 0x3F, 0x92, 0xE5, 0xE0, 0xAD, 0x93, 0xAD, 0x90, 0x9D, 0xA2, 0x9D,
+    0xA1, 0x9E, 0x2E, 0x3E, 0x1E, 0x4E, 0x9E, 0x94, 0xAF, 0xCA, 0x59, 0xFC, 0x69, 0xF7, 0x0E, 0x97,
+    0x9E, 0x70, 0xAE, 0x70, 0xEA, 0x79, 0xE9, 0x70, 0x4F, 0xFE, 0xA4, 0xFF, 0xE9, 0x4A, 0xFF, 0xD7,
+    0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0xA7, 0x1F, 0xCA, 0x70, 0x9F, 0xC9,
+    0x70, 0xAF, 0xDA, 0xAA, 0xA9, 0x4F, 0xFE, 0xA3, 0x9F, 0xFE, 0xA3, 0xAF, 0xFE, 0xA3, 0x69, 0xFA,
+    0x6A, 0xF9, 0x6D, 0xA7, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x1D, 0x71, 0xAD, 0x71, 0xDA, 0x71,
+    0xD9, 0x70, 0x9D, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x09, 0xD7,
+    0x1A, 0xD7, 0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1F, 0xC9, 0x6F, 0xC6, 0xAF, 0xC7, 0x73, 0x5A,
+    0x1A, 0xA1, 0xCA, 0x09, 0xD0, 0x9D, 0x1D, 0x1D, 0x1D, 0x1D, 0x90, 0xD9, 0x0D, 0xA0, 0xDA, 0x0E,
+    0x0E, 0x0D, 0xA0, 0xD1, 0xC2, 0x91, 0xFC, 0x7A, 0xFA, 0x71, 0xAD, 0x71, 0x9D, 0x72, 0xD9, 0x71,
+    0xAD, 0x71, 0x9D, 0x72, 0xD9, 0x71, 0xDA, 0x71, 0x9D, 0x72, 0xD9, 0x71, 0xDA, 0x71, 0xAD, 0x72,
+    0xD9, 0x71, 0xDA, 0x71, 0xAD, 0x71, 0x9D, 0x72, 0xDA, 0x71, 0xAD, 0x71, 0x9D, 0x72, 0xD9, 0x6A,
+    0xFC, 0x69, 0xFC, 0x7F, 0xC9, 0x74, 0x74, 0xD6, 0xAE, 0x49, 0xDA, 0xD9, 0x2D, 0x91, 0xAC, 0xA0,
+    0x76, 0x9F, 0xFE, 0x1F, 0xFE, 0xA1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0x0D, 0xA4, 0xDA, 0x39,
+    0xDA, 0x70, 0x76, 0x9E, 0xAC, 0xA2, 0xAF, 0xDA, 0x19, 0xD1, 0x9D, 0x91, 0xD3, 0xD9, 0x0A, 0xC9,
+    0x3D, 0x1D, 0x29, 0xE1, 0xFF, 0xC1, 0xAF, 0xEA, 0x2A, 0xE9, 0xD9, 0x00, 0x29, 0x71, 0xD9, 0x69,
+    0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x99, 0xA9, 0x4F, 0xE2, 0x9F, 0xAD, 0xA1, 0x9E, 0x2D, 0x1A, 0xD3,
+    0xD1, 0xE2, 0x9D, 0x1D, 0xA1, 0x9D, 0xA1, 0xFF, 0x2F, 0xE9, 0x2A, 0xFC, 0x95, 0x99, 0x50, 0x76,
+    0xAE, 0x92, 0x9F, 0xC9, 0x19, 0xDA, 0x5D, 0xA5, 0x9D, 0x6A, 0xD6, 0xAD, 0xA9, 0xA9, 0x29, 0xFD,
+    0x39, 0xAE, 0xA1, 0x72, 0xDA, 0x72, 0xD7, 0x29, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x5A, 0xDA, 0xAD,
+    0x49, 0xFE, 0xA3, 0x9D, 0xA9, 0xAE, 0x93, 0xD9, 0x2E, 0x39, 0xCA, 0x29, 0xDA, 0x3A, 0xCA, 0x19,
+    0xE9, 0x3A, 0xFF, 0x49, 0xFF, 0x59, 0xEA, 0xDA, 0x30, 0x4A, 0xE9, 0x49, 0xEA, 0xD9, 0x29, 0xDA,
+    0x09, 0x9C, 0xA2, 0xFF, 0xA1, 0x9D, 0xAA, 0xAA, 0xA9, 0x91, 0xAD, 0x49, 0x2A, 0xFF, 0x3F, 0xEA,
+    0x4A, 0xF9, 0x20, 0x76, 0xF4, 0xFA, 0x39, 0xD6, 0xAC, 0xA4, 0x9F, 0xD2, 0xAF, 0xCA, 0x29, 0xE9,
+    0x94, 0xE6, 0xDA, 0x5A, 0xD9, 0x5E, 0x6E, 0x5A, 0xDA, 0x50, 0x49, 0xAD, 0x9A, 0xD4, 0xAF, 0xEA,
+    0x39, 0xD9, 0x0A, 0xE4, 0xD2, 0x9E, 0x39, 0xC9, 0x2A, 0xDA, 0x3A, 0xC9, 0x19, 0xE4, 0xAF, 0xF4,
+    0x9F, 0xEA, 0x5A, 0xFD, 0x70, 0x90, 0xAD, 0x71, 0xAD, 0x94, 0xAD, 0xAE, 0xA5, 0xFE, 0x59, 0xAF,
+    0xA6, 0x4D, 0x97, 0x9D, 0x70, 0xDA, 0x70, 0xD9, 0x79, 0xD7, 0x0E, 0xAE, 0x93, 0xFF, 0x2A, 0xE9,
+    0x09, 0xD2, 0xE3, 0xD2, 0xDA, 0x29, 0xD1, 0xAD, 0x92, 0xDA, 0x1E, 0x29, 0xD9, 0x09, 0xE2, 0xE1,
+    0xAD, 0xA2, 0xE1, 0x5A, 0xA5, 0xAD, 0x5E, 0x4A, 0xE7, 0x75, 0x9C, 0xA5, 0xD9, 0x5D, 0x59, 0xD5,
+    0xAC, 0xA5, 0xD9, 0x49, 0xD5, 0xE5, 0xE4, 0x79, 0xA9, 0x7D, 0xA6, 0x9D, 0x97, 0x77, 0x49, 0x97,
+    0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD7, 0xAC, 0xA7, 0xD9, 0x7D, 0x79, 0xCA, 0x7D, 0x96, 0x9D, 0x59,
+    0xAD, 0xA5, 0xF9, 0x5E, 0xA7, 0x70, 0x4D, 0x7A, 0xD7, 0xDA, 0x7D, 0x7A, 0xD7, 0xD9, 0x0A, 0xA9,
+    0x3D, 0x9D, 0xA3, 0xAF, 0xA4, 0xF9, 0x49, 0xF5, 0xAF, 0xC4, 0xFE, 0x29, 0xDA, 0x9F, 0x1A, 0xD9,
+    0x0F, 0xA0, 0x39, 0xCA, 0x4A, 0xCA, 0x4D, 0x93, 0x9D, 0x4D, 0xA4, 0xD4, 0x9D, 0x4D, 0xA4, 0xD9,
+    0x39, 0xD4, 0xAC, 0xA4, 0xDA, 0x39, 0xF2, 0xAF, 0x20, 0x77, 0x5D, 0xAE, 0x90, 0xAD, 0xA4, 0xAF,
+    0xFF, 0xA3, 0xE9, 0x1E, 0x90, 0x9D, 0x29, 0xD9, 0x2D, 0xA1, 0x9D, 0x2E, 0x2A, 0xD2, 0xDA, 0x19,
+    0xDA, 0x2D, 0xA2, 0xD9, 0x1A, 0xD2, 0xAD, 0x2A, 0xD2, 0xE2, 0xE2, 0xE1, 0xAD, 0x91, 0xAD, 0x91,
+    0x9D, 0xA1, 0x76, 0xAC, 0xAE, 0xA4, 0xFE, 0xA2, 0x9E, 0x90, 0xAD, 0x2A, 0xD2, 0x9D, 0x2D, 0x92,
+    0xDA, 0x19, 0xD3, 0xD9, 0x1E, 0x2A, 0xD2, 0xE2, 0xE1, 0xAD, 0xA1, 0x9E, 0x10, 0x4A, 0xE9, 0x49,
+    0xFD, 0xA2, 0x9D, 0xA1, 0xAD, 0x2D, 0x92, 0x9D, 0x19, 0xD3, 0xDA, 0x1A, 0xD9, 0x9A, 0xE9, 0x19,
+    0xFE, 0xA3, 0xFE, 0x5A, 0xDA, 0x93, 0x77, 0x4D, 0xAF, 0x69, 0xFA, 0xAD, 0x5A, 0xE2, 0xAC, 0x5E,
+    0x92, 0xAC, 0x5E, 0x3D, 0x49, 0xE2, 0x9C, 0xA4, 0xAF, 0xAE, 0x94, 0xFF, 0xA4, 0xAF, 0xEA, 0x5E,
+    0x09, 0x99, 0x6A, 0xD9, 0x72, 0xE7, 0x29, 0xDA, 0x72, 0xAA, 0xA7, 0x20, 0x77, 0x09, 0xAD, 0x99,
+    0xD3, 0xAF, 0xEA, 0x29, 0xCA, 0x19, 0xE3, 0xD3, 0xE2, 0x9C, 0x92, 0x9D, 0x92, 0xAC, 0x91, 0x9E,
+    0x3A, 0xFE, 0xA3, 0x9F, 0xE9, 0x4A, 0xFD, 0x79, 0x99, 0xDA, 0xC7, 0xAF, 0x7F, 0x96, 0x9A, 0x97,
+    0x71, 0x29, 0xDA, 0xD9, 0x2A, 0xFC, 0x92, 0xEA, 0x99, 0x29, 0xD9, 0x5A, 0xD6, 0xDA, 0x5A, 0xD9,
+    0x5E, 0x94, 0x9E, 0x50, 0x76, 0x9F, 0xA3, 0x9D, 0xAA, 0xAC, 0x3A, 0xC9, 0x79, 0xDA, 0xA7, 0xAE,
+    0xA7, 0xE2, 0xEA, 0xF1, 0xFF, 0x91, 0x9A, 0xFA, 0x75, 0x74, 0xAC, 0x94, 0x9D, 0x5A, 0xD3, 0xAF,
+    0xD9, 0x9F, 0xE9, 0x1A, 0xD5, 0xDA, 0x5D, 0x59, 0xD5, 0xEA, 0xA3, 0xFC, 0x92, 0xFC, 0x91, 0x09,
+    0xD3, 0xDA, 0x0A, 0xCA, 0x3D, 0x90, 0xAC, 0x92, 0xAD, 0x1D, 0x3E, 0x1D, 0x29, 0xDA, 0x09, 0xD2,
+    0xE9, 0x09, 0xFF, 0x19, 0xFF, 0x2A, 0xFD, 0xA1, 0x0D, 0x94, 0xDA, 0x1E, 0x3A, 0xD2, 0xAD, 0x29,
+    0xD3, 0xAD, 0x91, 0xD9, 0x39, 0xDA, 0x0D, 0xA5, 0xFD, 0x6F, 0xC7, 0xFA, 0x7F, 0x60, 0x0D, 0x96,
+    0xAD, 0x1D, 0x96, 0xD9, 0x1D, 0x91, 0xD1, 0xE2, 0xD9, 0x0E, 0x09, 0xD9, 0x2D, 0xAF, 0x9E, 0x3F,
+    0xFD, 0x93, 0xFF, 0xD4, 0xFF, 0xC9, 0x4E, 0xA0, 0xEA, 0x5E, 0x1E, 0x77, 0x40, 0x3E, 0x2A, 0xD4,
+    0x9D, 0xA0, 0xE6, 0xFD, 0x7A, 0xEA, 0x70, 0xAE, 0x70, 0xAF, 0xA6, 0xAD, 0xAE, 0x5E, 0x90, 0xAD,
+    0xA3, 0xE9, 0x19, 0xE2, 0x3D, 0xA3, 0xAD, 0x4E, 0x29, 0xD5, 0xAD, 0x2D, 0xA5, 0x9D, 0xA0, 0xAD,
+    0x7E, 0x0D, 0x97, 0xFD, 0x70, 0xAF, 0x71, 0x9E, 0xA7, 0x2E, 0x72, 0x9D, 0x97, 0x19, 0xE7, 0xAF,
+    0xC7, 0x0F, 0xC9, 0x70, 0xEA, 0x71, 0x3F, 0xF4, 0xFF, 0x79, 0xDA, 0x7A, 0xD9, 0x69, 0xE7, 0xEA,
+    0x69, 0xF9, 0x99, 0x4F, 0xF9, 0x2A, 0xFF, 0xA2, 0x59, 0xF5, 0xAF, 0x95, 0xE7, 0x9D, 0x97, 0xAD,
+    0x70, 0xE7, 0x9D, 0x95, 0xAF, 0x6F, 0x7A, 0xE7, 0x0A, 0xD7, 0x0E, 0x70, 0xDA, 0x79, 0xD9, 0x7A,
+    0xF9, 0x59, 0xF7, 0x09, 0xAA, 0x50, 0x72, 0x9C, 0xA3, 0xD9, 0x3D, 0x39, 0xCA, 0x3A, 0xC9, 0x3D,
+    0x39, 0xD3, 0xAC, 0xA3, 0xD4, 0xD3, 0x9C, 0xA3, 0xAC, 0x93, 0xD3, 0x9C, 0xA3, 0xAC, 0x93, 0x49,
+    0xEA, 0x5A, 0xF9, 0x6E, 0x7E, 0x7D, 0xA6, 0x9D, 0x96, 0xAD, 0x96, 0xAE, 0xA5, 0x9E, 0x95, 0xEA,
+    0x5A, 0xD7, 0xDA, 0x69, 0xD9, 0x6A, 0xD4, 0x9F, 0xA4, 0xAE, 0xA5, 0xAA, 0x96, 0x1A, 0x90, 0x9A,
+    0x1E, 0x9A, 0xC0, 0x9C, 0x9A, 0xDA, 0x1A, 0x1A, 0x91, 0x3A, 0xAA, 0xA3, 0x9F, 0x39, 0xE9, 0x3A,
+    0xE4, 0xAD, 0xA7, 0x77, 0x77, 0x09, 0xC5, 0xAD, 0x5D, 0xA4, 0x9D, 0x94, 0x9D, 0x5A, 0xD5, 0xDA,
+    0x5D, 0x95, 0xD5, 0x9D, 0x59, 0xCA, 0x5A, 0x97, 0x70, 0x6C, 0x96, 0x9C, 0x79, 0xC6, 0xAE, 0x92,
+    0xAF, 0xC9, 0x19, 0xF9, 0x92, 0xDA, 0x9C, 0x39, 0xD0, 0xAC, 0x3A, 0xD0, 0xCA, 0x3A, 0xD9, 0xCA,
+    0x39, 0xFD, 0x39, 0xFA, 0x5A, 0xA7, 0xCA, 0x79, 0x40, 0x77, 0x3A, 0xE9, 0x5A, 0xFD, 0x93, 0x9D,
+    0x91, 0x9A, 0x93, 0x9C, 0x97, 0x19, 0xC9, 0x71, 0x9C, 0xA7, 0x9F, 0xEA, 0x3A, 0xFE, 0xA5, 0x9D,
+    0x71, 0xAD, 0x7A, 0xE9, 0x6F, 0xEA, 0xA3, 0xFF, 0xC9, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0x91, 0x77,
+    0xA3, 0xCA, 0x3F, 0xF3, 0xFE, 0x93, 0xDA, 0x0A, 0xD3, 0xAD, 0x1E, 0x3F, 0xE9, 0x2F, 0xFC, 0x2F,
+    0xFA, 0x29, 0x93, 0x99, 0x20, 0x2E, 0x4A, 0xD3, 0xAD, 0xA2, 0xE5, 0xE9, 0x0E, 0x6A, 0xFD, 0x79,
+    0xFC, 0x71, 0xF7, 0x2A, 0xF9, 0x6F, 0xEA, 0x5F, 0xD7, 0x29, 0xDA, 0x72, 0xAF, 0x96, 0xFE, 0xA5,
+    0xFD, 0x72, 0x9D, 0xA7, 0x2A, 0xD9, 0x77, 0x60, 0x39, 0xC4, 0xD4, 0xC9, 0x3A, 0xC4, 0xD4, 0x97,
+    0x72, 0xAA, 0x39, 0xC9, 0x3A, 0xC4, 0xD4, 0xC9, 0x3A, 0xC4, 0x99, 0x40, 0x7A, 0xDA, 0x70, 0xFD,
+    0x6A, 0xC9, 0x1A, 0x96, 0xDA, 0x97, 0x09, 0xFC, 0x95, 0xEA, 0xF4, 0x9C, 0xA3, 0xAC, 0x4A, 0xCA,
+    0x99, 0x99, 0xD4, 0xAF, 0xE9, 0x59, 0xFC, 0x72, 0xAD, 0x5A, 0xA9, 0x1A, 0xCA, 0x4A, 0xFE, 0x59,
+    0xAE, 0xA9, 0x50, 0x09, 0xAA, 0x1A, 0xA9, 0x0E, 0x09, 0xDA, 0x9E, 0x0A, 0xD9, 0xAE, 0x0E, 0x90,
+    0x29, 0xE9, 0x39, 0xCA, 0x9A, 0xC3, 0xDA, 0xA0, 0xCA, 0x1A, 0xD2, 0xC9, 0x1A, 0xE0, 0xAC, 0x29,
+    0xCA, 0xAD, 0x93, 0x9D, 0xA3, 0x7A, 0xDA, 0x0A, 0xA0, 0xC9, 0x0C, 0x1C, 0x99, 0xCA, 0xD1, 0xDA,
+    0xC0, 0x77, 0x1A, 0x3A, 0x39, 0xCA, 0x19, 0xC9, 0x2A, 0xD1, 0xAD, 0x2D, 0xA0, 0x9D, 0x92, 0xDA,
+    0x1D, 0xA3, 0xE9, 0x0E, 0x4E, 0x1E, 0x39, 0xCA, 0x19, 0xC9, 0x4A, 0x3A, 0x20, 0x0A, 0xEA, 0xA9,
+    0x91, 0xFF, 0x90, 0x99, 0xAA, 0xAE, 0x6A, 0xD6, 0xDA, 0x6A, 0xA9, 0x00, 0x0A, 0xFE, 0xA0, 0xFF,
+    0x90, 0x2A, 0xDA, 0x3E, 0xAD, 0x1A, 0xCA, 0x99, 0x9C, 0x1C, 0xAD, 0x09, 0xC1, 0xD9, 0xC9, 0xCA,
+    0x1D, 0xAE, 0x3A, 0xDA, 0x20, 0x70, 0x9F, 0xC9, 0x0A, 0xAA, 0xAA, 0x99, 0x74, 0x9A, 0xD9, 0x39,
+    0xFC, 0x3D, 0x90, 0xAC, 0xA1, 0xAD, 0x1D, 0x91, 0xAD, 0xAE, 0x29, 0xFC, 0x93, 0x9D, 0xA3, 0x7A,
+    0xA7, 0x1A, 0xCA, 0x71, 0xD9, 0x5A, 0xFF, 0x3A, 0xAA, 0xEA, 0xA9, 0x6D, 0x97, 0x09, 0xD7, 0x77,
+    0x79, 0xAF, 0xD3, 0x9F, 0xF7, 0x70, 0x09, 0xDA, 0x19, 0x90, 0xC3, 0x9C, 0x29, 0xC9, 0x1D, 0x91,
+    0xAE, 0x96, 0x1D, 0xA4, 0xC3, 0x9C, 0x19, 0xD9, 0x3C, 0xA0, 0xAE, 0x19, 0xA9, 0x20, 0x29, 0x2D,
+    0x1D, 0x90, 0xAC, 0xA1, 0x39, 0xD3, 0xDA, 0x3A, 0xCA, 0x3D, 0x93, 0xD9, 0x2A, 0xD4, 0xD3, 0xE3,
+    0xAD, 0x29, 0xDA, 0x3E, 0x2E, 0x92, 0x9F, 0xFC, 0x3A, 0xFF, 0xC3, 0xDA, 0xFD, 0xA2, 0xAC, 0x97,
+    0x2D, 0x77, 0x70, 0x4A, 0xE0, 0xD9, 0x3F, 0xA0, 0xD3, 0xAF, 0x99, 0xD3, 0xFC, 0x0A, 0xCA, 0x3F,
+    0xA0, 0xD9, 0x39, 0xE9, 0x0D, 0x5E, 0x09, 0xD4, 0x9D, 0xA0, 0xAC, 0xA4, 0xE9, 0x0D, 0x93, 0x9E,
+    0x1D, 0x4E, 0xA0, 0x9D, 0x39, 0xE9, 0x0A, 0xCA, 0x3F, 0x1D, 0x93, 0xEA, 0x1D, 0x49, 0x99, 0x29,
+    0x93, 0x1D, 0xA0, 0xAD, 0x90, 0xE9, 0x9A, 0xAA, 0x00, 0x29, 0x3A, 0xC3, 0xD9, 0x19, 0x9D, 0x1E,
+    0xA1, 0xAA, 0x91, 0x19, 0xA2, 0xD2, 0xAA, 0x2C, 0x92, 0xC1, 0xAE, 0x19, 0x99, 0x00, 0x70, 0xAD,
+    0x2A, 0xA0, 0xAA, 0x1C, 0x1C, 0xA1, 0xF2, 0xAD, 0x91, 0x74, 0xA3, 0x95, 0xD2, 0xCA, 0x49, 0xD9,
+    0x09, 0xD9, 0x4A, 0xD1, 0xDA, 0x4D, 0xA1, 0xDA, 0x2A, 0xDA, 0x0A, 0xDA, 0x2E, 0x09, 0xDA, 0x3D,
+    0x2D, 0x49, 0x92, 0x92, 0x49, 0x76, 0xAD, 0x76, 0xAD, 0x79, 0xD4, 0xCA, 0x7D, 0x49, 0xC9, 0x6D,
+    0x5D, 0x6D, 0x95, 0xD5, 0xAC, 0xA4, 0xFC, 0x92, 0xAD, 0x1C, 0x91, 0xFC, 0x29, 0xD1, 0xD7, 0x19,
+    0xD1, 0xE7, 0x1D, 0x90, 0xC9, 0xD7, 0x0D, 0xA0, 0xCA, 0x0C, 0xA7, 0xE0, 0xFD, 0x95, 0xAD, 0x1A,
+    0xFC, 0x5A, 0xD5, 0xD5, 0x9D, 0x94, 0x9C, 0xA5, 0x99, 0x97, 0x30, 0x49, 0x77, 0xAD, 0x71, 0x94,
+    0xAD, 0x79, 0xD5, 0xCA, 0x7D, 0x59, 0xC9, 0x6D, 0x6D, 0x6D, 0x96, 0xD5, 0xDA, 0x5F, 0xC9, 0x2A,
+    0xCA, 0x19, 0x92, 0xFC, 0x2A, 0xD0, 0xAF, 0x97, 0x9D, 0x1A, 0x90, 0x9C, 0xA6, 0x9D, 0x94, 0x9C,
+    0x96, 0xD9, 0x49, 0xD6, 0xDA, 0x4A, 0xD6, 0xE3, 0x9E, 0x6A, 0xD4, 0xFC, 0x93, 0xAD, 0x4A, 0xFC,
+    0x77, 0x40, 0x2A, 0xE9, 0x74, 0xA9, 0x9A, 0xC5, 0x9D, 0x6D, 0x49, 0xD4, 0xAE, 0x5D, 0x5F, 0x4D,
+    0x59, 0x1D, 0x3D, 0x94, 0xAF, 0xA2, 0xD9, 0x1C, 0x91, 0xFC, 0x2D, 0xA1, 0xD7, 0x1A, 0xCA, 0x1E,
+    0x70, 0xAD, 0x1C, 0x0C, 0xA7, 0xAD, 0x1C, 0xAA, 0xCA, 0x69, 0xD1, 0xFD, 0x94, 0x9D, 0x91, 0x99,
+    0x9D, 0xA4, 0x9D, 0x94, 0x9D, 0x59, 0x99, 0x73, 0x7E, 0xA7, 0xE7, 0x0E, 0x70, 0xAA, 0x97, 0x77,
+    0x70, 0xA9, 0x7E, 0x96, 0x9E, 0x7A, 0xDA, 0x6F, 0x94, 0x9F, 0x95, 0xE9, 0x6A, 0xD7, 0x0D, 0x97,
+    0x0D, 0x70, 0x9D, 0x49, 0x3D, 0x91, 0x9D, 0x92, 0xAF, 0xE4, 0x9E, 0xA9, 0x77, 0x79, 0xD7, 0x3E,
+    0x73, 0xE9, 0x77, 0x77, 0x4A, 0xD7, 0x19, 0xE7, 0x1F, 0x97, 0xAF, 0x96, 0x9D, 0x0D, 0xA6, 0xDA,
+    0x0D, 0xA5, 0xAD, 0x1E, 0x49, 0xDA, 0x1E, 0x4E, 0x2E, 0x3A, 0xFF, 0xC2, 0x9F, 0xFD, 0x91, 0xFF,
+    0xE9, 0x0E, 0xA4, 0xEA, 0x9E, 0x5E, 0xA0, 0x74, 0x99, 0x73, 0xAC, 0x73, 0x9C, 0xA7, 0x3D, 0x77,
+    0x77, 0x77, 0x77, 0x6A, 0xD7, 0x29, 0xE7, 0x2F, 0x97, 0x0A, 0xF9, 0x79, 0xD0, 0xDA, 0x7D, 0xA0,
+    0xDA, 0x6A, 0xD1, 0xE5, 0x9D, 0xA1, 0xE5, 0xE2, 0xE4, 0xAF, 0xFC, 0x39, 0xFF, 0xD9, 0x2F, 0xFE,
+    0x91, 0xEA, 0x4E, 0xA0, 0x9E, 0x5E, 0xA0, 0x77, 0x6A, 0xCA, 0x73, 0xEA, 0x71, 0xFD, 0x7A, 0xCA,
+    0x19, 0xD7, 0x77, 0x0A, 0xD7, 0x29, 0xE7, 0x2F, 0x97, 0x0A, 0xF9, 0x79, 0xD0, 0xDA, 0x7D, 0xA0,
+    0xDA, 0x6A, 0xD1, 0xE5, 0x9D, 0xA1, 0xE5, 0xE2, 0xE4, 0xAF, 0xFC, 0x39, 0xFF, 0xD9, 0x2F, 0xFE,
+    0x91, 0xEA, 0x4E, 0xA0, 0x9E, 0x5E, 0xA0, 0x70, 0x9D, 0x0A, 0xC7, 0x0E, 0x9C, 0xA7, 0xAC, 0x0E,
+    0x97, 0x9A, 0x1A, 0xA7, 0x77, 0x0A, 0xD7, 0x29, 0xE7, 0x2F, 0x97, 0x0A, 0xF9, 0x79, 0xD0, 0xDA,
+    0x7D, 0xA0, 0xDA, 0x6A, 0xD1, 0xE5, 0x9D, 0xA1, 0xE5, 0xE2, 0xE4, 0xAF, 0xFC, 0x39, 0xFF, 0xD9,
+    0x2F, 0xFE, 0x91, 0xEA, 0x4E, 0xA0, 0x9E, 0x5E, 0xA0, 0x70, 0xAA, 0x90, 0x9A, 0xA7, 0xAD, 0x90,
+    0xE7, 0xE0, 0x9D, 0xA6, 0x9E, 0x0E, 0xA7, 0x77, 0x77, 0x0A, 0xD7, 0x39, 0xE7, 0x3F, 0x97, 0x1A,
+    0xF9, 0x70, 0x9D, 0x0D, 0xA7, 0x0D, 0xA0, 0xDA, 0x7A, 0xD1, 0xE6, 0x9D, 0xA1, 0xE6, 0xE2, 0xE5,
+    0xAF, 0xFC, 0x49, 0xFF, 0xD9, 0x3F, 0xFE, 0x92, 0xEA, 0x4E, 0xA1, 0x9E, 0x5E, 0xA1, 0x72, 0xD9,
+    0x72, 0xF7, 0x2E, 0xA7, 0x2A, 0xCA, 0x77, 0x77, 0x70, 0xAD, 0x72, 0x9E, 0x72, 0xF9, 0x70, 0xAF,
+    0x97, 0x9D, 0x0D, 0xA7, 0xDA, 0x0D, 0xA6, 0xAD, 0x1E, 0x59, 0xDA, 0x1E, 0x5E, 0x2E, 0x4A, 0xFF,
+    0xC3, 0x9F, 0xFD, 0x92, 0xFF, 0xE9, 0x1E, 0xA4, 0xEA, 0x09, 0xE5, 0xEA, 0x00, 0x72, 0x9A, 0xAA,
+    0xFE, 0x72, 0x9F, 0xFD, 0xA7, 0x2F, 0xCA, 0xAA, 0x99, 0x97, 0x2F, 0xD7, 0x7E, 0xAD, 0xA7, 0x6A,
+    0xD0, 0xAD, 0xA9, 0x9A, 0xA7, 0x19, 0xD9, 0x0F, 0xEA, 0x70, 0x9D, 0xA1, 0xFE, 0x97, 0x0E, 0x19,
+    0xE7, 0x4F, 0xFD, 0x73, 0xFF, 0xEA, 0xAA, 0xAA, 0x5A, 0xFF, 0xFF, 0x4A, 0xE3, 0xAF, 0xFC, 0x39,
+    0xE4, 0xFF, 0xD7, 0x77, 0x20, 0x77, 0x69, 0xAF, 0xA5, 0x9F, 0xEA, 0x4A, 0xFF, 0x4A, 0xEA, 0x92,
+    0x93, 0x9E, 0x97, 0x1E, 0x97, 0x1A, 0xE7, 0x2E, 0xA7, 0x2E, 0xA7, 0x19, 0xF9, 0x29, 0xA4, 0xFF,
+    0xD4, 0xFF, 0xCA, 0x49, 0xFF, 0x95, 0xAF, 0xE9, 0x70, 0xCA, 0x73, 0xAD, 0x97, 0x2C, 0xAC, 0x97,
+    0x19, 0xDA, 0x60, 0x6D, 0xA7, 0x29, 0xDA, 0x72, 0xAD, 0xA7, 0x77, 0x71, 0x9A, 0xFE, 0x93, 0xFF,
+    0xC4, 0xEA, 0xA9, 0x99, 0x4A, 0xD7, 0x2E, 0x72, 0xE9, 0x9A, 0xA5, 0x9F, 0xE5, 0xAF, 0xDA, 0x5E,
+    0x71, 0x9D, 0xA7, 0x1A, 0xEA, 0xAA, 0xAA, 0x4F, 0xFC, 0x92, 0x9F, 0xFC, 0x3A, 0xFF, 0xC3, 0x72,
+    0xD7, 0x2D, 0x72, 0xAC, 0xA7, 0x29, 0x97, 0x77, 0x77, 0x77, 0x69, 0xAF, 0xE9, 0x3F, 0xFC, 0x4E,
+    0xAA, 0x99, 0x94, 0xAD, 0x72, 0xE7, 0x2E, 0x99, 0xAA, 0x59, 0xFE, 0x5A, 0xFD, 0xA5, 0xE7, 0x19,
+    0xDA, 0x71, 0xAE, 0xAA, 0xAA, 0xA4, 0xFF, 0xC9, 0x29, 0xFF, 0xC3, 0xAF, 0xFC, 0x30, 0x6C, 0xA7,
+    0x2A, 0xDA, 0x70, 0x9F, 0xC7, 0xD9, 0x09, 0xD9, 0x77, 0x77, 0x09, 0xAF, 0xE9, 0x3F, 0xFC, 0x4E,
+    0xAA, 0x99, 0x94, 0xAD, 0x72, 0xE7, 0x2E, 0x99, 0xAA, 0x59, 0xFE, 0x5A, 0xFD, 0xA5, 0xE7, 0x19,
+    0xDA, 0x71, 0xAE, 0xAA, 0xAA, 0xA4, 0xFF, 0xC9, 0x29, 0xFF, 0xC3, 0xAF, 0xFC, 0x30, 0x6D, 0xA0,
+    0x9D, 0x69, 0xDA, 0x0E, 0x6E, 0x99, 0xE6, 0xAA, 0xA0, 0x9A, 0xAA, 0x77, 0x77, 0x29, 0xAF, 0xE9,
+    0x4F, 0xFC, 0x5E, 0xAA, 0x99, 0x95, 0xAD, 0x73, 0xE7, 0x3E, 0x99, 0xAA, 0x69, 0xFE, 0x6A, 0xFD,
+    0xA6, 0xE7, 0x29, 0xDA, 0x72, 0xAE, 0xAA, 0xAA, 0xA5, 0xFF, 0xC9, 0x39, 0xFF, 0xC4, 0xAF, 0xFC,
+    0x40, 0x29, 0xD9, 0x6A, 0xD9, 0x6A, 0xD9, 0x77, 0x77, 0x2E, 0x6E, 0x59, 0xD9, 0x5A, 0xD6, 0xE6,
+    0xDA, 0x59, 0xD9, 0x5A, 0xD6, 0xE6, 0xDA, 0x5A, 0xDA, 0x5E, 0x94, 0x9E, 0x59, 0xE5, 0x79, 0x97,
+    0x9C, 0x97, 0xD7, 0xD9, 0x77, 0x77, 0x77, 0x74, 0xE7, 0xE6, 0x9D, 0x96, 0xAD, 0x7E, 0x7D, 0xA6,
+    0x9D, 0x96, 0xAD, 0x7E, 0x7D, 0xA6, 0xAD, 0xA6, 0xE9, 0x59, 0xE6, 0x9E, 0x60, 0x75, 0x9D, 0x7E,
+    0xA5, 0xAD, 0xAD, 0x39, 0xD2, 0xD9, 0x77, 0x72, 0xE7, 0xE6, 0x9D, 0x96, 0xAD, 0x7E, 0x7D, 0xA6,
+    0x9D, 0x96, 0xAD, 0x7E, 0x7D, 0xA6, 0xAD, 0xA6, 0xE9, 0x59, 0xE6, 0x9E, 0x60, 0x3A, 0xA9, 0x09,
+    0xAA, 0x39, 0xDA, 0x0E, 0x3E, 0x90, 0xE3, 0xE9, 0xAE, 0x77, 0x77, 0x70, 0xE7, 0x0E, 0x79, 0xD9,
+    0x7A, 0xD7, 0x0E, 0x70, 0xDA, 0x79, 0xD9, 0x7A, 0xD7, 0x0E, 0x70, 0xDA, 0x7A, 0xDA, 0x7E, 0x96,
+    0x9E, 0x79, 0xE7, 0x4F, 0xEA, 0x79, 0xFF, 0xC9, 0x5A, 0xFF, 0xD5, 0xE4, 0xE9, 0x39, 0xE5, 0xDA,
+    0x3A, 0xD9, 0x5D, 0x90, 0xAF, 0xF2, 0x9D, 0x90, 0xFF, 0xA2, 0xAD, 0x39, 0xDA, 0x49, 0xDA, 0x3A,
+    0xD9, 0x29, 0xF9, 0x3F, 0xFF, 0x4F, 0xFE, 0x49, 0xFF, 0xD9, 0x4A, 0xFE, 0xA9, 0x50, 0x70, 0xAC,
+    0xA0, 0xCA, 0x70, 0x9F, 0xC9, 0x70, 0xAC, 0x0A, 0xCA, 0x77, 0x77, 0x69, 0x99, 0x4D, 0xA3, 0x9E,
+    0x39, 0xD9, 0x3A, 0xE9, 0x2A, 0xD4, 0xFA, 0x2E, 0x39, 0xFC, 0x19, 0xD9, 0x3A, 0xFC, 0x1A, 0xD4,
+    0xEA, 0xD1, 0xE3, 0x9E, 0x9D, 0x99, 0xD9, 0x3E, 0xA9, 0xDA, 0xAD, 0x4E, 0x90, 0xFD, 0x3A, 0xE1,
+    0xFC, 0x93, 0xF1, 0xFC, 0x4E, 0xA1, 0xAF, 0x3A, 0xE9, 0x19, 0xEA, 0x30, 0x79, 0xD7, 0x6E, 0x76,
+    0xE7, 0x77, 0x77, 0x49, 0xAE, 0xA9, 0x70, 0xFF, 0xA6, 0xF9, 0x9A, 0xE9, 0x4E, 0x93, 0x9E, 0x3E,
+    0x95, 0xE3, 0xDA, 0x6E, 0x2A, 0xD9, 0x6D, 0xA2, 0xE6, 0xAD, 0x92, 0xE6, 0xE2, 0x9E, 0xA2, 0x9A,
+    0xEA, 0x29, 0xFF, 0xF9, 0x3F, 0xFE, 0xA4, 0xAF, 0xFC, 0xA6, 0x9A, 0xFC, 0xA7, 0x76, 0x74, 0x99,
+    0x75, 0xAC, 0x75, 0x9C, 0xA7, 0x5D, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xEA, 0x97, 0x0F, 0xFA,
+    0x6F, 0x99, 0xAE, 0x94, 0xE9, 0x39, 0xE3, 0xE9, 0x5E, 0x3D, 0xA6, 0xE2, 0xAD, 0x96, 0xDA, 0x2E,
+    0x6A, 0xD9, 0x2E, 0x6E, 0x29, 0xEA, 0x29, 0xAE, 0xA2, 0x9F, 0xFF, 0x93, 0xFF, 0xEA, 0x4A, 0xFF,
+    0xCA, 0x69, 0xAF, 0xCA, 0x77, 0x60, 0x77, 0x70, 0xAC, 0xA7, 0x5E, 0xA7, 0x3F, 0xD7, 0x1A, 0xCA,
+    0x19, 0xD7, 0x77, 0x29, 0xAE, 0xA9, 0x70, 0xFF, 0xA6, 0xF9, 0x9A, 0xE9, 0x4E, 0x93, 0x9E, 0x3E,
+    0x95, 0xE3, 0xDA, 0x6E, 0x2A, 0xD9, 0x6D, 0xA2, 0xE6, 0xAD, 0x92, 0xE6, 0xE2, 0x9E, 0xA2, 0x9A,
+    0xEA, 0x29, 0xFF, 0xF9, 0x3F, 0xFE, 0xA4, 0xAF, 0xFC, 0xA6, 0x9A, 0xFC, 0xA7, 0x76, 0x70, 0x9C,
+    0xA0, 0xAC, 0x72, 0xE9, 0xCA, 0x71, 0xAC, 0x0E, 0x97, 0x19, 0xA1, 0xA9, 0x77, 0x72, 0x9A, 0xEA,
+    0x97, 0x0F, 0xFA, 0x6F, 0x99, 0xAE, 0x94, 0xE9, 0x39, 0xE3, 0xE9, 0x5E, 0x3D, 0xA6, 0xE2, 0xAD,
+    0x96, 0xDA, 0x2E, 0x6A, 0xD9, 0x2E, 0x6E, 0x29, 0xEA, 0x29, 0xAE, 0xA2, 0x9F, 0xFF, 0x93, 0xFF,
+    0xEA, 0x4A, 0xFF, 0xCA, 0x69, 0xAF, 0xCA, 0x77, 0x60, 0x70, 0xAA, 0x90, 0x9A, 0xA7, 0x0A, 0xD9,
+    0x0E, 0x70, 0xE0, 0x9D, 0xA7, 0x9E, 0x0E, 0xA7, 0x77, 0x77, 0x19, 0xAE, 0xA9, 0x70, 0xFF, 0xA6,
+    0xF9, 0x9A, 0xE9, 0x4E, 0x93, 0x9E, 0x3E, 0x95, 0xE3, 0xDA, 0x6E, 0x2A, 0xD9, 0x6D, 0xA2, 0xE6,
+    0xAD, 0x92, 0xE6, 0xE2, 0x9E, 0xA2, 0x9A, 0xEA, 0x29, 0xFF, 0xF9, 0x3F, 0xFE, 0xA4, 0xAF, 0xFC,
+    0xA6, 0x9A, 0xFC, 0xA7, 0x76, 0x2D, 0xA0, 0xAD, 0x39, 0xFC, 0x5F, 0x5A, 0xF9, 0x3E, 0xAE, 0x29,
+    0x99, 0x19, 0x99, 0x90, 0x77, 0x74, 0x9A, 0xAA, 0x77, 0x74, 0xAE, 0x77, 0x74, 0xAE, 0x77, 0x74,
+    0xAE, 0x77, 0x74, 0xAE, 0x77, 0x74, 0xAE, 0x77, 0x74, 0xAE, 0x77, 0x74, 0x9E, 0x77, 0x69, 0xAE,
+    0xAA, 0xE9, 0x77, 0x5F, 0xFD, 0x97, 0x75, 0xF9, 0x9F, 0xA7, 0x75, 0xE9, 0x1A, 0xFA, 0x77, 0x4E,
+    0x91, 0xAF, 0xD7, 0x74, 0xDA, 0x1A, 0xE9, 0xE7, 0x73, 0xAD, 0x90, 0xAE, 0x90, 0xDA, 0x77, 0x3E,
+    0x0A, 0xE1, 0xAD, 0x97, 0x73, 0xFE, 0x2E, 0x77, 0x39, 0xFD, 0x99, 0xAE, 0xA7, 0x73, 0x9F, 0xFF,
+    0x97, 0x74, 0xFF, 0xEA, 0x77, 0x4F, 0xFE, 0xA7, 0x74, 0xFF, 0xDA, 0x77, 0x5F, 0xA7, 0x77, 0x3F,
+    0xA7, 0x77, 0x3A, 0xEA, 0x77, 0x73, 0xAE, 0xA7, 0x77, 0x3A, 0xEA, 0x77, 0x73, 0xAD, 0xA9, 0x77,
+    0x73, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x70, 0x7D, 0xA7, 0x49, 0xDA, 0x74, 0xAD, 0xA7, 0x77, 0x77,
+    0x76, 0xEA, 0x3E, 0xA2, 0x9E, 0x4E, 0x92, 0xAE, 0x39, 0xE3, 0xEA, 0x3A, 0xE3, 0xE9, 0x3E, 0x92,
+    0x9E, 0x4E, 0x3A, 0xDA, 0x39, 0xE3, 0xE9, 0x3A, 0xD9, 0x3E, 0x4E, 0x4E, 0x3A, 0xE3, 0x9F, 0xFD,
+    0x93, 0x9F, 0xFD, 0x49, 0xFF, 0xC9, 0x5A, 0xFE, 0x97, 0x74, 0x73, 0x99, 0x74, 0x9C, 0xA7, 0x4D,
+    0x74, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6E, 0xA3, 0xEA, 0x29, 0xE4, 0xE9, 0x2A, 0xE3, 0x9E,
+    0x3E, 0xA3, 0xAE, 0x3E, 0x93, 0xE9, 0x29, 0xE4, 0xE3, 0xAD, 0xA3, 0x9E, 0x3E, 0x93, 0xAD, 0x93,
+    0xE4, 0xE4, 0xE3, 0xAE, 0x39, 0xFF, 0xD9, 0x39, 0xFF, 0xD4, 0x9F, 0xFC, 0x95, 0xAF, 0xE9, 0x77,
+    0x40, 0x77, 0x7D, 0x74, 0xAE, 0x72, 0x9D, 0xAD, 0x97, 0x0D, 0x2A, 0xCA, 0x77, 0x77, 0x5E, 0xA3,
+    0xEA, 0x29, 0xE4, 0xE9, 0x2A, 0xE3, 0x9E, 0x3E, 0xA3, 0xAE, 0x3E, 0x93, 0xE9, 0x29, 0xE4, 0xE3,
+    0xAD, 0xA3, 0x9E, 0x3E, 0x93, 0xAD, 0x93, 0xE4, 0xE4, 0xE3, 0xAE, 0x39, 0xFF, 0xD9, 0x39, 0xFF,
+    0xD4, 0x9F, 0xFC, 0x95, 0xAF, 0xE9, 0x77, 0x40, 0x79, 0xAA, 0x1A, 0xA7, 0x0D, 0xA0, 0xAD, 0x96,
+    0xAD, 0xA0, 0xE7, 0xE9, 0x9E, 0x77, 0x77, 0x77, 0x4E, 0xA3, 0xEA, 0x29, 0xE4, 0xE9, 0x2A, 0xE3,
+    0x9E, 0x3E, 0xA3, 0xAE, 0x3E, 0x93, 0xE9, 0x29, 0xE4, 0xE3, 0xAD, 0xA3, 0x9E, 0x3E, 0x93, 0xAD,
+    0x93, 0xE4, 0xE4, 0xE3, 0xAE, 0x39, 0xFF, 0xD9, 0x39, 0xFF, 0xD4, 0x9F, 0xFC, 0x95, 0xAF, 0xE9,
+    0x77, 0x40, 0x70, 0x99, 0x71, 0xAC, 0x71, 0xAC, 0xA7, 0x09, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x71,
+    0xE5, 0xE0, 0xAD, 0x93, 0xAD, 0x90, 0x9D, 0xA2, 0x9D, 0xA1, 0x9E, 0x2E, 0x3E, 0x1E, 0x4E, 0x9E,
+    0x94, 0xAF, 0xCA, 0x59, 0xFC, 0x69, 0xF7, 0x0E, 0x97, 0x9E, 0x70, 0xAE, 0x70, 0xEA, 0x79, 0xE9,
+    0x70, 0x39, 0x97, 0x0D, 0x70, 0xD9, 0x69, 0xF9, 0x4A, 0xFC, 0xA3, 0xD9, 0x09, 0xD3, 0xD2, 0xD2,
+    0x9C, 0xA1, 0xE2, 0xAD, 0xAE, 0x3F, 0xD3, 0x9E, 0xA5, 0xAC, 0xA7, 0xD7, 0x0A, 0xA7, 0x59, 0xEA,
+    0x6F, 0xDA, 0x4A, 0xD2, 0xD4, 0xD9, 0x09, 0xAD, 0x39, 0xD0, 0x9E, 0x93, 0xAC, 0xA0, 0xD6, 0xDA,
+    0x0D, 0x59, 0xD9, 0x0D, 0xA4, 0xAD, 0x1A, 0xDA, 0x3E, 0x2A, 0xD2, 0x9E, 0x29, 0xD2, 0xAF, 0xFC,
+    0x2F, 0xFC, 0x39, 0x99, 0x9A, 0xCA, 0x93, 0x4E, 0x70, 0xE7, 0x9E, 0x77, 0x72, 0x9E, 0xAC, 0xA2,
+    0xAF, 0xDA, 0x19, 0xD1, 0x9D, 0x91, 0xD3, 0xD9, 0x0A, 0xC9, 0x3D, 0x1D, 0x29, 0xE1, 0xFF, 0xC1,
+    0xAF, 0xEA, 0x2A, 0xE9, 0xD9, 0x00, 0x70, 0xAC, 0x70, 0x9C, 0xA7, 0x0D, 0x70, 0x99, 0x97, 0x77,
+    0x77, 0x75, 0x9E, 0xAC, 0xA3, 0xAF, 0xDA, 0x29, 0xD1, 0x9D, 0x92, 0xD3, 0xD9, 0x1A, 0xC9, 0x3D,
+    0x2D, 0x29, 0xE2, 0xFF, 0xC2, 0xAF, 0xEA, 0x3A, 0xE9, 0xD9, 0x10, 0x4D, 0x70, 0x9E, 0x7F, 0xC9,
+    0x4D, 0xA1, 0xAC, 0xA7, 0x77, 0x49, 0xEA, 0xCA, 0x3A, 0xFD, 0xA2, 0x9D, 0x19, 0xD9, 0x2D, 0x3D,
+    0x91, 0xAC, 0x93, 0xD2, 0xD2, 0x9E, 0x2F, 0xFC, 0x2A, 0xFE, 0xA3, 0xAE, 0x9D, 0x91, 0x59, 0xA1,
+    0xA9, 0x49, 0xE0, 0xC9, 0x4A, 0xC9, 0xE5, 0xD0, 0xAC, 0xA7, 0x77, 0x49, 0xEA, 0xCA, 0x3A, 0xFD,
+    0xA2, 0x9D, 0x19, 0xD9, 0x2D, 0x3D, 0x91, 0xAC, 0x93, 0xD2, 0xD2, 0x9E, 0x2F, 0xFC, 0x2A, 0xFE,
+    0xA3, 0xAE, 0x9D, 0x91, 0x4A, 0xD1, 0xDA, 0x4E, 0x0A, 0xD9, 0x39, 0xE0, 0xE9, 0x3A, 0xAA, 0x90,
+    0xAA, 0xA7, 0x77, 0x69, 0xEA, 0xCA, 0x4A, 0xFD, 0xA3, 0x9D, 0x19, 0xD9, 0x3D, 0x3D, 0x92, 0xAC,
+    0x93, 0xD3, 0xD2, 0x9E, 0x3F, 0xFC, 0x3A, 0xFE, 0xA4, 0xAE, 0x9D, 0x92, 0x79, 0x70, 0xAD, 0x95,
+    0x9C, 0x9C, 0x95, 0x9E, 0x7A, 0xC9, 0x77, 0x72, 0x9E, 0xAC, 0xA2, 0xAF, 0xDA, 0x19, 0xD1, 0x9D,
+    0x91, 0xD3, 0xD9, 0x0A, 0xC9, 0x3D, 0x1D, 0x29, 0xE1, 0xFF, 0xC1, 0xAF, 0xEA, 0x2A, 0xE9, 0xD9,
+    0x00, 0x77, 0x59, 0xEA, 0xD9, 0xAD, 0xA4, 0xAF, 0xFF, 0xC2, 0x9D, 0x19, 0xF9, 0x09, 0xAC, 0x2D,
+    0x3F, 0xFC, 0x90, 0xAC, 0x93, 0xEA, 0xAA, 0xAA, 0x91, 0xD2, 0x9E, 0x97, 0xFF, 0xFE, 0x91, 0xAF,
+    0xFF, 0xD3, 0xAE, 0x9D, 0xAF, 0xA9, 0x10, 0x76, 0xAE, 0x92, 0x9F, 0xC9, 0x19, 0xDA, 0x5D, 0xA5,
+    0x9D, 0x6A, 0xD6, 0xAD, 0xA9, 0xA9, 0x29, 0xFD, 0x39, 0xFA, 0x49, 0xD6, 0x99, 0xC9, 0x49, 0xE5,
+    0x9A, 0xA4, 0x5D, 0x97, 0x0A, 0xD9, 0x70, 0xAD, 0x97, 0x77, 0x77, 0x75, 0xAE, 0x94, 0x9E, 0xAD,
+    0x92, 0x9D, 0xA0, 0x99, 0xCA, 0x2F, 0xFA, 0x19, 0xDA, 0xAA, 0xAA, 0x99, 0x1A, 0xD4, 0x92, 0xAF,
+    0xF3, 0xFE, 0xA4, 0xAF, 0x92, 0x71, 0x99, 0x71, 0x9C, 0x97, 0x1D, 0x71, 0xD9, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x4A, 0xE9, 0x59, 0xEA, 0xD9, 0x39, 0xDA, 0x09, 0x9C, 0xA3, 0xFF, 0xA2, 0x9D, 0xAA,
+    0xAA, 0xA9, 0x92, 0xAD, 0x49, 0x3A, 0xFF, 0x4F, 0xEA, 0x5A, 0xF9, 0x30, 0x77, 0x19, 0xD7, 0x1F,
+    0x7A, 0xDA, 0xD5, 0x9D, 0x2A, 0xC9, 0x77, 0x77, 0x74, 0xAE, 0x95, 0x9E, 0xAD, 0x93, 0x9D, 0xA0,
+    0x99, 0xCA, 0x3F, 0xFA, 0x29, 0xDA, 0xAA, 0xAA, 0x99, 0x2A, 0xD4, 0x93, 0xAF, 0xF4, 0xFE, 0xA5,
+    0xAF, 0x93, 0x5A, 0xA9, 0x1A, 0xA5, 0x9D, 0xA0, 0xAD, 0x5A, 0xD9, 0x0E, 0x5E, 0x9A, 0xE7, 0x77,
+    0x77, 0x77, 0x5A, 0xE9, 0x69, 0xEA, 0xD9, 0x49, 0xDA, 0x09, 0x9C, 0xA4, 0xFF, 0xA3, 0x9D, 0xAA,
+    0xAA, 0xA9, 0x93, 0xAD, 0x49, 0x4A, 0xFF, 0x5F, 0xEA, 0x6A, 0xF9, 0x40, 0x1A, 0xD5, 0xE5, 0xE7,
+    0x73, 0x9C, 0xA4, 0xD9, 0x4D, 0x49, 0xD4, 0xAC, 0xA4, 0xD9, 0x39, 0xD4, 0xE4, 0xE3, 0x69, 0x95,
+    0xD5, 0xAC, 0xA4, 0x9D, 0x77, 0x77, 0x70, 0x9C, 0xA5, 0xD9, 0x5D, 0x59, 0xD5, 0xAC, 0xA5, 0xD9,
+    0x49, 0xD5, 0xE5, 0xE4, 0x74, 0xAC, 0x95, 0x9E, 0x94, 0xDA, 0xDA, 0x2A, 0xCA, 0x19, 0xD7, 0x69,
+    0xCA, 0x6D, 0x96, 0xD6, 0x9D, 0x6A, 0xCA, 0x6D, 0x95, 0x9D, 0x6E, 0x6E, 0x40, 0x19, 0xD0, 0x9D,
+    0x2E, 0x0E, 0x19, 0xDA, 0x9D, 0xA7, 0x77, 0x9C, 0xA6, 0xD9, 0x6D, 0x69, 0xD6, 0xAC, 0xA6, 0xD9,
+    0x59, 0xD6, 0xE6, 0xE5, 0x77, 0x70, 0xD9, 0x73, 0xAE, 0x75, 0xD9, 0x70, 0x9F, 0xF6, 0xAF, 0xF7,
+    0x1A, 0xCA, 0x69, 0xF0, 0xD6, 0xAF, 0xF5, 0x9D, 0xA1, 0xE9, 0x5E, 0x2A, 0xD6, 0xD9, 0x2D, 0xA5,
+    0x9D, 0xA1, 0xAD, 0x69, 0xFE, 0x97, 0xFD, 0xA7, 0x1A, 0xE9, 0x70, 0x6A, 0xC9, 0x0C, 0x95, 0xAE,
+    0x9C, 0x95, 0xD0, 0xE6, 0xAA, 0x09, 0xA9, 0x77, 0x75, 0xAC, 0xAE, 0xA5, 0xFE, 0xA3, 0x9E, 0x90,
+    0xAD, 0x3A, 0xD2, 0x9D, 0x3D, 0x92, 0xDA, 0x29, 0xD3, 0xD9, 0x2E, 0x2A, 0xD3, 0xE2, 0xE2, 0xAD,
+    0xA1, 0x9E, 0x20, 0x4A, 0xCA, 0x71, 0xE7, 0x09, 0xE7, 0x77, 0x6A, 0xE9, 0x49, 0xFD, 0xA2, 0x9D,
+    0xA1, 0xAD, 0x2D, 0x92, 0x9D, 0x19, 0xD3, 0xDA, 0x1A, 0xD9, 0x9A, 0xE9, 0x19, 0xFE, 0xA3, 0xFE,
+    0x5A, 0xDA, 0x93, 0x71, 0x97, 0x1D, 0x70, 0xAC, 0x97, 0x9C, 0xA7, 0x77, 0x77, 0x76, 0xAE, 0x94,
+    0x9F, 0xDA, 0x29, 0xDA, 0x1A, 0xD2, 0xD9, 0x29, 0xD1, 0x9D, 0x3D, 0xA1, 0xAD, 0x99, 0xAE, 0x91,
+    0x9F, 0xEA, 0x3F, 0xE5, 0xAD, 0xA9, 0x30, 0x77, 0x0D, 0x97, 0x9E, 0x96, 0xDA, 0xDA, 0x4D, 0x91,
+    0xAD, 0x77, 0x1A, 0xE9, 0x49, 0xFD, 0xA2, 0x9D, 0xA1, 0xAD, 0x2D, 0x92, 0x9D, 0x19, 0xD3, 0xDA,
+    0x1A, 0xD9, 0x9A, 0xE9, 0x19, 0xFE, 0xA3, 0xFE, 0x5A, 0xDA, 0x93, 0x5A, 0xCA, 0x0C, 0xA4, 0x9E,
+    0x9C, 0x94, 0xD0, 0xE5, 0xAA, 0x09, 0xA9, 0x77, 0x1A, 0xE9, 0x49, 0xFD, 0xA2, 0x9D, 0xA1, 0xAD,
+    0x2D, 0x92, 0x9D, 0x19, 0xD3, 0xDA, 0x1A, 0xD9, 0x9A, 0xE9, 0x19, 0xFE, 0xA3, 0xFE, 0x5A, 0xDA,
+    0x93, 0x49, 0xAA, 0x1A, 0xA9, 0x4E, 0x09, 0xDA, 0x39, 0xE0, 0xE9, 0x3A, 0xE0, 0xE9, 0x77, 0x76,
+    0xAE, 0x95, 0x9F, 0xDA, 0x39, 0xDA, 0x1A, 0xD3, 0xD9, 0x29, 0xD2, 0x9D, 0x3D, 0xA2, 0xAD, 0x99,
+    0xAE, 0x92, 0x9F, 0xEA, 0x4F, 0xE6, 0xAD, 0xA9, 0x40, 0x5A, 0xA9, 0x70, 0x9D, 0x97, 0x0E, 0x97,
+    0x9E, 0x77, 0x29, 0xFF, 0xD1, 0xFF, 0xE1, 0x97, 0x6A, 0xA7, 0x1A, 0xD7, 0x1E, 0x70, 0xAE, 0x60,
+    0x77, 0x77, 0x2A, 0xC7, 0x7D, 0x97, 0x6A, 0xCA, 0x77, 0xD7, 0x7A, 0xCA, 0x77, 0xD7, 0x7D, 0xA7,
+    0x69, 0xD7, 0x7D, 0x97, 0x4A, 0xF7, 0x3A, 0xFD, 0xA7, 0x19, 0xD9, 0xFC, 0x71, 0xDA, 0x9D, 0xAD,
+    0x70, 0x9D, 0x0D, 0x9E, 0x70, 0xAF, 0xCA, 0xD9, 0x70, 0xAF, 0xF7, 0x2F, 0xE7, 0x3A, 0xF9, 0x74,
+    0xD9, 0x76, 0xE7, 0x69, 0xD9, 0x76, 0xE7, 0x69, 0xD9, 0x76, 0xE7, 0x6A, 0xD7, 0x7C, 0x97, 0x79,
+    0x77, 0x10, 0x3A, 0xCA, 0x70, 0xE7, 0x9E, 0x77, 0x70, 0x9D, 0x3D, 0xA0, 0xAC, 0xA3, 0xD9, 0x0A,
+    0xC9, 0x2A, 0xD1, 0xD3, 0xE1, 0xD2, 0x9D, 0xA0, 0x9D, 0x2E, 0x90, 0x9F, 0xF1, 0x9F, 0xF2, 0xAF,
+    0xDA, 0x10, 0x70, 0x97, 0x0D, 0x7D, 0x96, 0xAC, 0xA7, 0x77, 0x77, 0x69, 0xD3, 0xDA, 0x0A, 0xCA,
+    0x3D, 0x90, 0xAC, 0x92, 0xAD, 0x1D, 0x3E, 0x1D, 0x29, 0xDA, 0x09, 0xD2, 0xE9, 0x09, 0xFF, 0x19,
+    0xFF, 0x2A, 0xFD, 0xA1, 0x76, 0xD7, 0x9E, 0x95, 0xDA, 0xDA, 0x3D, 0x91, 0xAC, 0xA7, 0x49, 0xD3,
+    0xDA, 0x0A, 0xCA, 0x3D, 0x90, 0xAC, 0x92, 0xAD, 0x1D, 0x3E, 0x1D, 0x29, 0xDA, 0x09, 0xD2, 0xE9,
+    0x09, 0xFF, 0x19, 0xFF, 0x2A, 0xFD, 0xA1, 0x3A, 0xD1, 0xDA, 0x3E, 0x0A, 0xD9, 0x29, 0xE0, 0xE9,
+    0x2A, 0xAA, 0x90, 0xAA, 0xA7, 0x77, 0x19, 0xD3, 0xDA, 0x1A, 0xCA, 0x3D, 0x91, 0xAC, 0x92, 0xAD,
+    0x2D, 0x3E, 0x2D, 0x29, 0xDA, 0x19, 0xD2, 0xE9, 0x19, 0xFF, 0x29, 0xFF, 0x3A, 0xFD, 0xA2, 0x72,
+    0x9C, 0xA7, 0x3D, 0x73, 0xAC, 0x97, 0x39, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0xDA, 0x3A,
+    0xD4, 0xE2, 0x9D, 0x5A, 0xD2, 0xDA, 0x59, 0xDA, 0x0A, 0xD7, 0xE0, 0xD9, 0x7F, 0xD7, 0x0A, 0xF7,
+    0x19, 0xEA, 0x72, 0xE7, 0x29, 0xD9, 0x71, 0x9E, 0x7A, 0xFC, 0x70, 0xFC, 0x97, 0x0E, 0xA7, 0x10,
+    0x3A, 0xD7, 0xDA, 0x7D, 0x96, 0x9F, 0x94, 0xAF, 0xC9, 0x3D, 0xA0, 0xE3, 0xD9, 0x1D, 0x29, 0xD2,
+    0xD2, 0xAD, 0x1A, 0xCA, 0x2D, 0xA0, 0x9D, 0x92, 0xD9, 0xAD, 0xA2, 0x9F, 0xCA, 0x3A, 0xF9, 0x4D,
+    0xA7, 0xD9, 0x69, 0xD7, 0xAD, 0x77, 0x20, 0x7D, 0x90, 0xAD, 0x7A, 0xD9, 0x0E, 0x7E, 0x0A, 0xDA,
+    0x69, 0xAA, 0xA0, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x4D, 0xA3, 0xAD, 0x5E, 0x29, 0xD6, 0xAD,
+    0x2D, 0xA6, 0x9D, 0xA0, 0xAD, 0x70, 0xE0, 0xD9, 0x70, 0xFD, 0x71, 0xAF, 0x72, 0x9E, 0xA7, 0x3E,
+    0x73, 0x9D, 0x97, 0x29, 0xE7, 0x0A, 0xFC, 0x71, 0xFC, 0x97, 0x1E, 0xA7, 0x20, 0x76, 0x97, 0x0A,
+    0xFE, 0x79, 0xFF, 0x77, 0x77, 0x77, 0x74, 0xAD, 0x74, 0x9E, 0x74, 0xF9, 0x72, 0xAF, 0x97, 0x19,
+    0xD0, 0xDA, 0x71, 0xDA, 0x0D, 0xA7, 0x0A, 0xD1, 0xE7, 0x9D, 0xA1, 0xE7, 0xE2, 0xE6, 0xAF, 0xFC,
+    0x59, 0xFF, 0xD9, 0x4F, 0xFE, 0x93, 0xEA, 0x4E, 0xA2, 0x9E, 0x5E, 0xA2, 0x49, 0x9A, 0xAA, 0xAC,
+    0x93, 0x9F, 0xEA, 0x3A, 0xAA, 0xAA, 0x99, 0x99, 0x77, 0x77, 0x72, 0x9E, 0xAC, 0xA4, 0xAF, 0xDA,
+    0x39, 0xD1, 0x9D, 0x93, 0xD3, 0xD9, 0x2A, 0xC9, 0x3D, 0x3D, 0x29, 0xE3, 0xFF, 0xC3, 0xAF, 0xEA,
+    0x4A, 0xE9, 0xD9, 0x20, 0x70, 0x94, 0x97, 0x1D, 0xAA, 0xAD, 0x97, 0x0F, 0xDA, 0x72, 0xF9, 0x77,
+    0x77, 0x74, 0xAD, 0x74, 0x9E, 0x74, 0xF9, 0x72, 0xAF, 0x97, 0x19, 0xD0, 0xDA, 0x71, 0xDA, 0x0D,
+    0xA7, 0x0A, 0xD1, 0xE7, 0x9D, 0xA1, 0xE7, 0xE2, 0xE6, 0xAF, 0xFC, 0x59, 0xFF, 0xD9, 0x4F, 0xFE,
+    0x93, 0xEA, 0x4E, 0xA2, 0x9E, 0x5E, 0xA2, 0x49, 0xCA, 0x19, 0xAA, 0x59, 0xFD, 0xA6, 0xFC, 0xA7,
+    0x09, 0x99, 0x77, 0x77, 0x39, 0xEA, 0xCA, 0x5A, 0xFD, 0xA4, 0x9D, 0x19, 0xD9, 0x4D, 0x3D, 0x93,
+    0xAC, 0x93, 0xD4, 0xD2, 0x9E, 0x4F, 0xFC, 0x4A, 0xFE, 0xA5, 0xAE, 0x9D, 0x93, 0x70, 0xAD, 0x71,
+    0x9E, 0x71, 0xF9, 0x7A, 0xF9, 0x69, 0xD0, 0xDA, 0x6D, 0xA0, 0xDA, 0x5A, 0xD1, 0xE4, 0x9D, 0xA1,
+    0xE4, 0xE2, 0xE3, 0xAF, 0xFC, 0x29, 0xFF, 0xD9, 0x1F, 0xFE, 0x90, 0xEA, 0x4E, 0xA9, 0xE5, 0xEA,
+    0x71, 0xDA, 0x71, 0xAC, 0xA9, 0x71, 0xF7, 0x2A, 0xD7, 0x60, 0x76, 0x9E, 0xAC, 0xA2, 0xAF, 0xDA,
+    0x19, 0xD1, 0x9D, 0x91, 0xD3, 0xD9, 0x0A, 0xC9, 0x3D, 0x1D, 0x29, 0xE1, 0xFF, 0xC1, 0xAF, 0xEA,
+    0x2A, 0xE9, 0xDA, 0x69, 0xDA, 0x59, 0xD7, 0xAE, 0xA6, 0xE9, 0x73, 0x73, 0x97, 0x4D, 0x73, 0xAC,
+    0x97, 0x29, 0xCA, 0x77, 0x77, 0x70, 0x9A, 0xFA, 0x59, 0xFE, 0xA4, 0xAF, 0xF4, 0xAE, 0xA9, 0x29,
+    0x39, 0xE9, 0x71, 0xE9, 0x71, 0xAE, 0x72, 0xEA, 0x72, 0xEA, 0x71, 0x9F, 0x4A, 0x4F, 0xFD, 0x4F,
+    0xFC, 0xA4, 0x9F, 0xF9, 0x5A, 0xFE, 0x92, 0x7D, 0x7D, 0x7A, 0xCA, 0x79, 0x97, 0x72, 0xAE, 0x93,
+    0xAF, 0xC9, 0x29, 0xDA, 0x6D, 0xA6, 0x9D, 0x7A, 0xD7, 0xAD, 0xA9, 0xA9, 0x39, 0xFD, 0x49, 0xAE,
+    0xA2, 0x77, 0x70, 0xAC, 0x97, 0x4E, 0xA7, 0x2F, 0xCA, 0x70, 0xAC, 0xA1, 0x9D, 0x77, 0x77, 0x70,
+    0x9A, 0xFA, 0x69, 0xFE, 0xA5, 0xAF, 0xF5, 0xAE, 0xA9, 0x29, 0x49, 0xE9, 0x72, 0xE9, 0x72, 0xAE,
+    0x73, 0xEA, 0x73, 0xEA, 0x72, 0x9F, 0x4A, 0x5F, 0xFD, 0x5F, 0xFC, 0xA5, 0x9F, 0xF9, 0x6A, 0xFE,
+    0x93, 0x77, 0x2D, 0x71, 0xAE, 0x79, 0xDA, 0xD9, 0x5D, 0x91, 0xAC, 0xA7, 0x72, 0xAE, 0x95, 0x9F,
+    0xC9, 0x49, 0xDA, 0x70, 0xDA, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xAD, 0xA9, 0xA9, 0x59, 0xFD, 0x69,
+    0xAE, 0xA4, 0x72, 0x9A, 0xA7, 0x3E, 0x72, 0xAD, 0xA7, 0x2E, 0xA7, 0x77, 0x76, 0x9A, 0xFA, 0x59,
+    0xFE, 0xA4, 0xAF, 0xF4, 0xAE, 0xA9, 0x29, 0x39, 0xE9, 0x71, 0xE9, 0x71, 0xAE, 0x72, 0xEA, 0x72,
+    0xEA, 0x71, 0x9F, 0x4A, 0x4F, 0xFD, 0x4F, 0xFC, 0xA4, 0x9F, 0xF9, 0x5A, 0xFE, 0x92, 0x7A, 0xA9,
+    0x69, 0xD9, 0x6E, 0x69, 0xE7, 0x70, 0xAE, 0x93, 0x9F, 0xC9, 0x29, 0xDA, 0x6D, 0xA6, 0x9D, 0x7A,
+    0xD7, 0xAD, 0xA9, 0xA9, 0x39, 0xFD, 0x49, 0xAE, 0xA2, 0x7D, 0x91, 0x9C, 0xA7, 0x09, 0xDA, 0xDA,
+    0x72, 0xAE, 0xA7, 0x4D, 0x97, 0x69, 0x77, 0x77, 0x76, 0x9A, 0xFA, 0x79, 0xFE, 0xA6, 0xAF, 0xF6,
+    0xAE, 0xA9, 0x29, 0x59, 0xE9, 0x73, 0xE9, 0x73, 0xAE, 0x74, 0xEA, 0x74, 0xEA, 0x73, 0x9F, 0x4A,
+    0x6F, 0xFD, 0x6F, 0xFC, 0xA6, 0x9F, 0xF9, 0x7A, 0xFE, 0x94, 0x39, 0xAA, 0x29, 0xA9, 0x5E, 0x9D,
+    0x97, 0xF9, 0x70, 0x9D, 0x73, 0x97, 0x77, 0x0A, 0xE9, 0x69, 0xFC, 0x95, 0x9D, 0xA7, 0x1D, 0xA7,
+    0x19, 0xD7, 0x2A, 0xD7, 0x2A, 0xDA, 0x9A, 0x96, 0x9F, 0xD7, 0x9A, 0xEA, 0x50, 0x69, 0x93, 0x99,
+    0x79, 0xD0, 0x9D, 0x97, 0x0A, 0xF7, 0x3E, 0x74, 0x9A, 0x77, 0x77, 0x70, 0xFE, 0xA6, 0x9F, 0xFC,
+    0x94, 0xAF, 0xFD, 0x4E, 0x39, 0xE9, 0x3E, 0x49, 0xDA, 0x29, 0xDA, 0x5D, 0xA2, 0xAD, 0x95, 0xD9,
+    0x2E, 0x5A, 0xD2, 0x9D, 0xA4, 0x9E, 0x2A, 0xDA, 0x29, 0xAE, 0x92, 0xFF, 0xF3, 0xFF, 0xE9, 0x29,
+    0xFF, 0xD9, 0x3A, 0xFE, 0xA9, 0x50, 0x72, 0xDA, 0x75, 0xD0, 0x99, 0x72, 0x9D, 0x0D, 0x97, 0x1A,
+    0xCA, 0x9D, 0x72, 0xD9, 0xDA, 0x5A, 0xDA, 0xAD, 0x0D, 0x93, 0x9F, 0xEA, 0x69, 0xDA, 0x9A, 0xE9,
+    0x6D, 0x92, 0xE6, 0x9C, 0xA2, 0x9D, 0xA6, 0xAC, 0xA1, 0x9E, 0x96, 0xAF, 0xF7, 0x9F, 0xF7, 0x09,
+    0xEA, 0xDA, 0x60, 0x4F, 0xEA, 0x79, 0xFF, 0xC9, 0x5A, 0xFF, 0xD5, 0xE4, 0xE9, 0x39, 0xE5, 0xDA,
+    0x3A, 0xD9, 0x5D, 0x90, 0xAF, 0xF2, 0x9D, 0x90, 0xFF, 0xA2, 0xAD, 0x39, 0xDA, 0x49, 0xDA, 0x3A,
+    0xD9, 0x29, 0xF9, 0x3F, 0xFF, 0x4F, 0xFE, 0x49, 0xFF, 0xD9, 0x4A, 0xFE, 0xA9, 0x50, 0x72, 0xDA,
+    0x74, 0xD9, 0x70, 0xAF, 0xEA, 0x6A, 0xAA, 0xEA, 0xA9, 0x71, 0xD7, 0x0A, 0xDA, 0xAD, 0x69, 0xFE,
+    0xA5, 0x9D, 0xA9, 0xAE, 0x95, 0xD9, 0x2E, 0x59, 0xCA, 0x29, 0xDA, 0x5A, 0xCA, 0x19, 0xE9, 0x5A,
+    0xFF, 0x69, 0xFF, 0x79, 0xEA, 0xDA, 0x50, 0x6A, 0xAA, 0xAE, 0x6A, 0xFE, 0x95, 0xAA, 0x99, 0x99,
+    0x99, 0x77, 0x77, 0x77, 0x19, 0xAF, 0xE9, 0x4F, 0xFC, 0x5E, 0xAA, 0x99, 0x95, 0xAD, 0x73, 0xE7,
+    0x3E, 0x99, 0xAA, 0x69, 0xFE, 0x6A, 0xFD, 0xA6, 0xE7, 0x29, 0xDA, 0x72, 0xAE, 0xAA, 0xAA, 0xA5,
+    0xFF, 0xC9, 0x39, 0xFF, 0xC4, 0xAF, 0xFC, 0x40, 0x70, 0x99, 0x99, 0x59, 0xFE, 0x94, 0xFE, 0xA9,
+    0x77, 0x77, 0x77, 0x77, 0x72, 0xAE, 0x96, 0x9E, 0xAD, 0x94, 0x9D, 0xA0, 0x99, 0xCA, 0x4F, 0xFA,
+    0x39, 0xDA, 0xAA, 0xAA, 0x99, 0x3A, 0xD4, 0x94, 0xAF, 0xF5, 0xFE, 0xA6, 0xAF, 0x94, 0x6A, 0xC9,
+    0x19, 0xCA, 0x6F, 0xE9, 0x69, 0xFC, 0x97, 0x19, 0x99, 0x77, 0x77, 0x49, 0xAF, 0xE9, 0x4F, 0xFC,
+    0x5E, 0xAA, 0x99, 0x95, 0xAD, 0x73, 0xE7, 0x3E, 0x99, 0xAA, 0x69, 0xFE, 0x6A, 0xFD, 0xA6, 0xE7,
+    0x29, 0xDA, 0x72, 0xAE, 0xAA, 0xAA, 0xA5, 0xFF, 0xC9, 0x39, 0xFF, 0xC4, 0xAF, 0xFC, 0x40, 0x5A,
+    0xC9, 0x19, 0xC9, 0x5F, 0xE9, 0x59, 0xFC, 0x97, 0x09, 0x99, 0x77, 0x77, 0x77, 0x77, 0xAE, 0x96,
+    0x9E, 0xAD, 0x94, 0x9D, 0xA0, 0x99, 0xCA, 0x4F, 0xFA, 0x39, 0xDA, 0xAA, 0xAA, 0x99, 0x3A, 0xD4,
+    0x94, 0xAF, 0xF5, 0xFE, 0xA6, 0xAF, 0x94, 0x71, 0xDA, 0x71, 0x9D, 0xA7, 0x1E, 0x97, 0x1A, 0xAA,
+    0x77, 0x77, 0x19, 0xAF, 0xE9, 0x3F, 0xFC, 0x4E, 0xAA, 0x99, 0x94, 0xAD, 0x72, 0xE7, 0x2E, 0x99,
+    0xAA, 0x59, 0xFE, 0x5A, 0xFD, 0xA5, 0xE7, 0x19, 0xDA, 0x71, 0xAE, 0xAA, 0xAA, 0xA4, 0xFF, 0xC9,
+    0x29, 0xFF, 0xC3, 0xAF, 0xFC, 0x30, 0x70, 0xDA, 0x79, 0xDA, 0x7E, 0x97, 0xAA, 0xA7, 0x77, 0x77,
+    0x75, 0xAE, 0x94, 0x9E, 0xAD, 0x92, 0x9D, 0xA0, 0x99, 0xCA, 0x2F, 0xFA, 0x19, 0xDA, 0xAA, 0xAA,
+    0x99, 0x1A, 0xD4, 0x92, 0xAF, 0xF3, 0xFE, 0xA4, 0xAF, 0x92, 0x39, 0xAF, 0xE9, 0x3F, 0xFC, 0x4E,
+    0xAA, 0x99, 0x94, 0xAD, 0x72, 0xE7, 0x2E, 0x99, 0xAA, 0x59, 0xFE, 0x5A, 0xFD, 0xA5, 0xE7, 0x19,
+    0xDA, 0x71, 0xAE, 0xAA, 0xAA, 0xA4, 0xFF, 0xC9, 0x29, 0xFF, 0xC3, 0xAF, 0xFC, 0x6D, 0x97, 0x1D,
+    0x73, 0xEA, 0x71, 0x9D, 0x97, 0x75, 0x4A, 0xE9, 0x49, 0xEA, 0xD9, 0x29, 0xDA, 0x09, 0x9C, 0xA2,
+    0xFF, 0xA1, 0x9D, 0xAA, 0xAA, 0xA9, 0x91, 0xAD, 0x49, 0x2A, 0xFF, 0x3F, 0xEA, 0x4A, 0xF9, 0x77,
+    0x2D, 0x70, 0xD9, 0x7A, 0xC9, 0x70, 0xEA, 0x70, 0xDA, 0x77, 0x10, 0x69, 0x93, 0x99, 0x7D, 0xA0,
+    0x9D, 0x97, 0x0F, 0xC7, 0x29, 0xDA, 0x74, 0xAA, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xFE, 0x95, 0xFF,
+    0xC6, 0xEA, 0xA9, 0x99, 0x6A, 0xD7, 0x4E, 0x74, 0xE9, 0x9A, 0xA7, 0x9F, 0xE7, 0xAF, 0xDA, 0x7E,
+    0x73, 0x9D, 0xA7, 0x3A, 0xEA, 0xAA, 0xAA, 0x6F, 0xFC, 0x94, 0x9F, 0xFC, 0x5A, 0xFF, 0xC5, 0x5D,
+    0x29, 0xCA, 0x69, 0xDA, 0xDA, 0x70, 0xAE, 0x97, 0x2D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xE9,
+    0x79, 0xEA, 0xD9, 0x59, 0xDA, 0x09, 0x9C, 0xA5, 0xFF, 0xA4, 0x9D, 0xAA, 0xAA, 0xA9, 0x94, 0xAD,
+    0x49, 0x5A, 0xFF, 0x6F, 0xEA, 0x7A, 0xF9, 0x50, 0x72, 0xD7, 0x69, 0xE7, 0x5F, 0xC9, 0x72, 0xDA,
+    0x1A, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAA, 0xAA, 0xA9, 0x70, 0xAF, 0xF9, 0x6F, 0xFD,
+    0x95, 0xFA, 0x49, 0x5A, 0xE7, 0x5E, 0x97, 0x49, 0xE7, 0x5E, 0xA2, 0x9C, 0xAA, 0x99, 0x4E, 0x92,
+    0xAF, 0xC9, 0x3E, 0x39, 0xAF, 0x92, 0x9E, 0x94, 0xAD, 0x94, 0xFC, 0xAA, 0xAF, 0x5F, 0xFE, 0xA6,
+    0xFF, 0xD9, 0x7A, 0xAF, 0xA9, 0x50, 0x79, 0xC9, 0x73, 0xE9, 0x71, 0xAF, 0xA7, 0x9D, 0x19, 0xD7,
+    0x77, 0x77, 0x72, 0x9A, 0xD9, 0xAD, 0x5A, 0xFE, 0xA4, 0x9D, 0x90, 0xAE, 0x5D, 0x29, 0xE4, 0x9C,
+    0x92, 0xAD, 0xA4, 0xAC, 0x91, 0x9E, 0x5A, 0xFF, 0x59, 0xFE, 0xA6, 0xAF, 0xD7, 0x19, 0x0A, 0xD7,
+    0x2A, 0xD9, 0x5A, 0xDA, 0xEA, 0x6F, 0xE6, 0x9A, 0xFA, 0x70, 0x71, 0xAC, 0x2A, 0xC9, 0x71, 0xFE,
+    0x72, 0xAF, 0xC9, 0x74, 0x99, 0x97, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xAA, 0xAA, 0x97, 0x0A, 0xFF,
+    0x96, 0xFF, 0xD9, 0x5F, 0xA4, 0x95, 0xAE, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xEA, 0x29, 0xCA, 0xA9,
+    0x94, 0xE9, 0x2A, 0xFC, 0x93, 0xE3, 0x9A, 0xF9, 0x29, 0xE9, 0x4A, 0xD9, 0x4F, 0xCA, 0xAA, 0xF5,
+    0xFF, 0xEA, 0x6F, 0xFD, 0x97, 0xAA, 0xFA, 0x95, 0x69, 0xCA, 0x19, 0xCA, 0x7A, 0xFD, 0xA7, 0x0F,
+    0xCA, 0x72, 0x99, 0x97, 0x77, 0x77, 0x09, 0xAD, 0x9A, 0xD6, 0xAF, 0xEA, 0x59, 0xD9, 0x0A, 0xE6,
+    0xD2, 0x9E, 0x59, 0xC9, 0x2A, 0xDA, 0x5A, 0xC9, 0x19, 0xE6, 0xAF, 0xF6, 0x9F, 0xEA, 0x7A, 0xFD,
+    0x72, 0x90, 0xAD, 0x73, 0xAD, 0x96, 0xAD, 0xAE, 0xA7, 0xFE, 0x79, 0xAF, 0xA7, 0x00, 0x74, 0xDA,
+    0x73, 0xAD, 0x97, 0x3E, 0x97, 0x3A, 0xAA, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xAA, 0xAA, 0x96, 0xAF,
+    0xF9, 0x4F, 0xFD, 0x93, 0xFA, 0x49, 0x3A, 0xE7, 0x3E, 0x97, 0x29, 0xE7, 0x3E, 0xA2, 0x9C, 0xAA,
+    0x99, 0x2E, 0x92, 0xAF, 0xC9, 0x1E, 0x39, 0xAF, 0x90, 0x9E, 0x94, 0xAD, 0x92, 0xFC, 0xAA, 0xAF,
+    0x3F, 0xFE, 0xA4, 0xFF, 0xD9, 0x5A, 0xAF, 0xA9, 0x30, 0x71, 0xAD, 0x72, 0xE7, 0x1A, 0xDA, 0x71,
+    0xAA, 0xA9, 0x77, 0x77, 0x19, 0xAD, 0x9A, 0xD4, 0xAF, 0xEA, 0x39, 0xD9, 0x0A, 0xE4, 0xD2, 0x9E,
+    0x39, 0xC9, 0x2A, 0xDA, 0x3A, 0xC9, 0x19, 0xE4, 0xAF, 0xF4, 0x9F, 0xEA, 0x5A, 0xFD, 0x70, 0x90,
+    0xAD, 0x71, 0xAD, 0x94, 0xAD, 0xAE, 0xA5, 0xFE, 0x59, 0xAF, 0xA6, 0x73, 0xEA, 0x73, 0x9E, 0x97,
+    0x3A, 0xE7, 0x4E, 0x97, 0x3A, 0xDA, 0x73, 0x9E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xAA, 0xAA,
+    0x97, 0xAF, 0xF9, 0x5F, 0xFD, 0x94, 0xFA, 0x49, 0x4A, 0xE7, 0x4E, 0x97, 0x39, 0xE7, 0x4E, 0xA2,
+    0x9C, 0xAA, 0x99, 0x3E, 0x92, 0xAF, 0xC9, 0x2E, 0x39, 0xAF, 0x91, 0x9E, 0x94, 0xAD, 0x93, 0xFC,
+    0xAA, 0xAF, 0x4F, 0xFE, 0xA5, 0xFF, 0xD9, 0x6A, 0xAF, 0xA9, 0x40, 0x70, 0xF7, 0x1E, 0xA7, 0x09,
+    0xE7, 0x1E, 0x97, 0x0A, 0xE7, 0x1A, 0xAA, 0x97, 0x75, 0x9A, 0xD9, 0xAD, 0x4A, 0xFE, 0xA3, 0x9D,
+    0x90, 0xAE, 0x4D, 0x29, 0xE3, 0x9C, 0x92, 0xAD, 0xA3, 0xAC, 0x91, 0x9E, 0x4A, 0xFF, 0x49, 0xFE,
+    0xA5, 0xAF, 0xD7, 0x09, 0x0A, 0xD7, 0x1A, 0xD9, 0x4A, 0xDA, 0xEA, 0x5F, 0xE5, 0x9A, 0xFA, 0x60,
+    0x77, 0x70, 0xD9, 0x73, 0x9E, 0x97, 0x2D, 0xAD, 0xA7, 0x0D, 0xA1, 0x9D, 0x77, 0x77, 0x4A, 0xD4,
+    0x9D, 0x93, 0xE4, 0xAD, 0x39, 0xDA, 0x4E, 0x3A, 0xD9, 0x39, 0xE3, 0xE4, 0xAD, 0xA3, 0xE4, 0xE9,
+    0x2A, 0xDA, 0x39, 0xE3, 0xFA, 0xAA, 0xAF, 0x3F, 0xFE, 0xA2, 0x9F, 0xFE, 0x92, 0xAF, 0xFE, 0x3E,
+    0xA3, 0xF2, 0x9E, 0x93, 0xEA, 0x2A, 0xE3, 0x9E, 0x92, 0x4A, 0xC9, 0x70, 0xE9, 0x6F, 0xC9, 0x4A,
+    0xCA, 0x1A, 0xCA, 0x77, 0x75, 0xD9, 0x79, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0x9D, 0x70, 0xEA, 0xE9,
+    0x3F, 0xF2, 0xAE, 0x90, 0x9D, 0x2E, 0x3D, 0x2D, 0xA2, 0x9D, 0x1A, 0xD9, 0x2D, 0xA1, 0xE2, 0x9D,
+    0x90, 0x9E, 0x2E, 0x1A, 0xDA, 0x2E, 0x10, 0x3A, 0xD4, 0x9D, 0x93, 0xE4, 0xAD, 0x39, 0xDA, 0x4E,
+    0x29, 0xAD, 0xA9, 0x99, 0x9A, 0xE9, 0x1F, 0xFF, 0xCA, 0x1F, 0xFF, 0xC9, 0x1A, 0xDA, 0x39, 0xE3,
+    0xFA, 0xAA, 0xAF, 0x3F, 0xFE, 0xA2, 0x9F, 0xFE, 0x92, 0xAF, 0xFE, 0x3E, 0xA3, 0xF2, 0x9E, 0x93,
+    0xEA, 0x2A, 0xE3, 0x9E, 0x92, 0x4D, 0x97, 0x9D, 0x99, 0x93, 0x9F, 0xDA, 0x3A, 0xFA, 0x95, 0x9D,
+    0x70, 0xAD, 0xAE, 0x93, 0xFF, 0x29, 0xE9, 0x09, 0xD2, 0xE3, 0xD2, 0xDA, 0x29, 0xD1, 0xAD, 0x92,
+    0xDA, 0x1E, 0x29, 0xD9, 0x1E, 0x2E, 0x1A, 0xDA, 0x2E, 0x10, 0x4D, 0x90, 0xC9, 0x3A, 0xE9, 0xC4,
+    0xCA, 0x9E, 0x4A, 0x90, 0xAA, 0x77, 0x77, 0x6E, 0x7E, 0x69, 0xD9, 0x6A, 0xD7, 0xE7, 0xDA, 0x69,
+    0xD9, 0x6A, 0xD7, 0xE7, 0xDA, 0x6A, 0xDA, 0x6E, 0x95, 0x9E, 0x69, 0xE6, 0x29, 0xD0, 0xAC, 0x3E,
+    0xAA, 0xC2, 0x9C, 0x9A, 0xD9, 0x3A, 0x1A, 0xA7, 0x77, 0x09, 0xCA, 0x6D, 0x96, 0xD6, 0x9D, 0x6A,
+    0xCA, 0x6D, 0x95, 0x9D, 0x6E, 0x6E, 0x50, 0x69, 0x99, 0x93, 0x9F, 0xE3, 0xFE, 0xA7, 0x77, 0x77,
+    0x74, 0xE7, 0x0E, 0x79, 0xD9, 0x7A, 0xD7, 0x0E, 0x70, 0xDA, 0x79, 0xD9, 0x7A, 0xD7, 0x0E, 0x70,
+    0xDA, 0x7A, 0xDA, 0x7E, 0x96, 0x9E, 0x79, 0xE7, 0x69, 0x99, 0x1A, 0xFE, 0x09, 0xFE, 0xA7, 0x77,
+    0x70, 0x9C, 0xA6, 0xD9, 0x6D, 0x69, 0xD6, 0xAC, 0xA6, 0xD9, 0x59, 0xD6, 0xE6, 0xE5, 0x5E, 0x6E,
+    0x59, 0xD9, 0x5A, 0xD6, 0xE6, 0xDA, 0x59, 0xD9, 0x5A, 0xD6, 0xE6, 0xDA, 0x5A, 0xDA, 0x5E, 0x94,
+    0x9E, 0x5A, 0xE4, 0x9D, 0x95, 0xD7, 0xEA, 0x59, 0xD9, 0x76, 0x7A, 0xA7, 0xAD, 0x7E, 0x6A, 0xE7,
+    0x77, 0x39, 0xCA, 0x7D, 0x97, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x96, 0x9D, 0x7E, 0x7E, 0x6A, 0xD6,
+    0xAC, 0xA7, 0xF9, 0x59, 0xE7, 0x70, 0x6D, 0xA5, 0x9D, 0xA5, 0xE9, 0x5A, 0xAA, 0x77, 0x77, 0x2E,
+    0x6E, 0x59, 0xD9, 0x5A, 0xD6, 0xE6, 0xDA, 0x59, 0xD9, 0x5A, 0xD6, 0xE6, 0xDA, 0x5A, 0xDA, 0x5E,
+    0x94, 0x9E, 0x59, 0xE5, 0x29, 0xCA, 0x2D, 0x92, 0xD2, 0x9D, 0x2A, 0xCA, 0x2D, 0x91, 0x9D, 0x2E,
+    0x2E, 0x10, 0x4D, 0xA5, 0xDA, 0x49, 0xD9, 0x49, 0xDA, 0x4A, 0xD5, 0xE9, 0x4E, 0x5E, 0x5D, 0xA4,
+    0x9D, 0xA4, 0x9D, 0x94, 0xE9, 0x4A, 0xD5, 0xE5, 0xE4, 0x9D, 0xA4, 0x9D, 0xA4, 0xE9, 0x4A, 0xD9,
+    0x4E, 0x5E, 0x49, 0xDA, 0x49, 0xE4, 0xE9, 0x4A, 0xE4, 0xE5, 0xAD, 0xA3, 0x9D, 0xA7, 0x5E, 0x97,
+    0x0A, 0x91, 0xAE, 0x71, 0xFE, 0xA7, 0x09, 0xFE, 0x71, 0xFE, 0x72, 0xAA, 0xEA, 0x77, 0x72, 0x75,
+    0xAA, 0x59, 0xD9, 0x39, 0xD5, 0xE4, 0xE5, 0xE7, 0x49, 0xAA, 0xA7, 0x77, 0x49, 0xCA, 0x5A, 0xCA,
+    0x4D, 0x95, 0xD5, 0xD5, 0x9D, 0x49, 0xD5, 0xAC, 0x94, 0xAC, 0xA5, 0xD5, 0xD9, 0x49, 0xCA, 0x49,
+    0xD5, 0xD9, 0x4E, 0x5D, 0x5E, 0x4A, 0xCA, 0x74, 0x9D, 0x97, 0x3F, 0x73, 0xAE, 0xA7, 0x3A, 0xAA,
+    0x96, 0x77, 0x72, 0x9C, 0xA7, 0x5E, 0xA7, 0x3E, 0xAD, 0x71, 0xAC, 0xA1, 0x9D, 0x97, 0x77, 0x77,
+    0x49, 0xDA, 0x74, 0xE7, 0x5E, 0x74, 0xAD, 0x97, 0x4E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7,
+    0x49, 0xDA, 0x74, 0xE7, 0x5E, 0x74, 0xAD, 0x97, 0x4E, 0x70, 0x92, 0xAD, 0xA7, 0x9F, 0xE7, 0x0F,
+    0xEA, 0x79, 0xFD, 0xA7, 0x29, 0x99, 0x97, 0x20, 0x77, 0x4A, 0xCA, 0x72, 0xEA, 0x70, 0xFD, 0x6A,
+    0xCA, 0x19, 0xD7, 0x77, 0x77, 0x71, 0xD7, 0x2A, 0xD7, 0x2D, 0x97, 0x2D, 0x72, 0x9C, 0xA7, 0x2D,
+    0x97, 0x2D, 0x72, 0x9C, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x09, 0xAD, 0xA7, 0x0F, 0x97, 0x0E, 0xA7,
+    0x76, 0x77, 0x79, 0xEA, 0x71, 0xAE, 0x72, 0xE9, 0x71, 0xAE, 0x72, 0xE9, 0x71, 0x9A, 0xA9, 0x77,
+    0x77, 0x6A, 0xD1, 0xAE, 0x5E, 0x09, 0xE5, 0x9D, 0x90, 0xE6, 0xE0, 0xE9, 0x6D, 0xAE, 0x96, 0xAF,
+    0xC9, 0x7F, 0xCA, 0x79, 0xFA, 0x70, 0xAF, 0xA7, 0x0F, 0xD9, 0x69, 0xFE, 0x95, 0xE9, 0xAF, 0x5E,
+    0x1F, 0xC3, 0xAD, 0xA1, 0xAF, 0xC2, 0x6D, 0x71, 0xAD, 0x71, 0xDA, 0x71, 0xD7, 0x1A, 0xD7, 0x1D,
+    0x90, 0xAA, 0x95, 0xD9, 0xDA, 0x5A, 0xFA, 0x6F, 0x96, 0x9F, 0x7A, 0xFC, 0x6F, 0xE4, 0x9D, 0xA9,
+    0xF3, 0xAD, 0x90, 0xFA, 0x77, 0x77, 0x72, 0xF7, 0x0E, 0xA7, 0x9E, 0x70, 0xE9, 0x7A, 0xE7, 0x09,
+    0x99, 0x70, 0x3C, 0xA0, 0xAC, 0x39, 0xC9, 0xAC, 0x93, 0xAC, 0xAC, 0xA4, 0xEA, 0x49, 0xE5, 0xE9,
+    0x5F, 0x93, 0xAC, 0x9E, 0x3D, 0x09, 0xE1, 0x69, 0x97, 0x9C, 0xA7, 0xD7, 0xD9, 0x77, 0x19, 0xD9,
+    0x6A, 0xD7, 0xE6, 0x9D, 0xA6, 0xAD, 0x7E, 0x69, 0xDA, 0x6A, 0xD9, 0x6E, 0x69, 0xDA, 0x6A, 0xDA,
+    0x19, 0x99, 0x90, 0xFF, 0xC9, 0x9F, 0xFC, 0x0A, 0xFF, 0xC0, 0x7C, 0xA6, 0xD6, 0xAC, 0xA6, 0x99,
+    0x77, 0x77, 0x39, 0xCA, 0x6A, 0xCA, 0x6D, 0x95, 0x9D, 0x6D, 0xA6, 0xD6, 0x9D, 0x6D, 0xA6, 0xD9,
+    0x59, 0xD6, 0xAC, 0xA6, 0xDA, 0x59, 0xF4, 0xAF, 0x40, 0x49, 0xD9, 0x7A, 0xD7, 0x0E, 0x79, 0xDA,
+    0x7A, 0xD7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x79, 0xDA, 0x7A, 0xDA, 0x19, 0x99, 0x91, 0xFF,
+    0xC9, 0x09, 0xFF, 0xC1, 0xAF, 0xFC, 0x77, 0x74, 0x99, 0x97, 0xAE, 0x7E, 0xA7, 0xE7, 0xEA, 0x69,
+    0xE7, 0x99, 0x99, 0x60, 0x69, 0xCA, 0x7A, 0xCA, 0x7D, 0x96, 0x9D, 0x7D, 0xA7, 0xD7, 0x9D, 0x7D,
+    0xA7, 0xD9, 0x69, 0xD7, 0xAC, 0xA7, 0xDA, 0x69, 0xF5, 0xAF, 0x77, 0x77, 0x69, 0xAA, 0xA6, 0xF6,
+    0xE9, 0x5A, 0xDA, 0x59, 0xE6, 0xEA, 0x50, 0x39, 0xD9, 0x7A, 0xD7, 0x0E, 0x29, 0x92, 0x9D, 0xA1,
+    0xAC, 0xA2, 0xAD, 0x2D, 0x92, 0xE1, 0x9D, 0x29, 0xDA, 0x1D, 0xA2, 0xAD, 0x97, 0xE7, 0x9D, 0xA7,
+    0xAD, 0xA1, 0x99, 0x99, 0x1F, 0xFC, 0x90, 0x9F, 0xFC, 0x1A, 0xFF, 0xC1, 0x71, 0x99, 0x71, 0xAC,
+    0xA7, 0x1D, 0x94, 0x9C, 0xA0, 0x9D, 0x5A, 0xCA, 0x0D, 0xA5, 0xD9, 0x70, 0x9D, 0x71, 0xDA, 0x71,
+    0xD7, 0x19, 0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xCA, 0x71, 0xDA, 0x70, 0x9F, 0x7A,
+    0xF7, 0x39, 0xD9, 0x70, 0xAD, 0x71, 0xE1, 0x9D, 0x39, 0xDA, 0x1E, 0x3A, 0xD1, 0x9E, 0x3E, 0x19,
+    0xAA, 0xA2, 0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0xA1, 0x99, 0x99, 0x2F,
+    0xFC, 0x91, 0x9F, 0xFC, 0x2A, 0xFF, 0xC2, 0x39, 0xCA, 0x6A, 0xCA, 0x6D, 0x95, 0x9D, 0x09, 0xAA,
+    0x2D, 0xA0, 0xE2, 0xD9, 0x9D, 0xA1, 0x9D, 0x0E, 0xA1, 0xDA, 0x6D, 0x95, 0x9D, 0x6A, 0xCA, 0x6D,
+    0xA5, 0x9F, 0x4A, 0xF4, 0x77, 0x77, 0x77, 0xDA, 0x77, 0x5D, 0xA7, 0x75, 0xDA, 0x77, 0x5D, 0xA7,
+    0x70, 0x9D, 0x90, 0xDA, 0x77, 0x1A, 0xD9, 0xDA, 0x77, 0x2F, 0xD7, 0x72, 0x9F, 0xC7, 0x73, 0xAF,
+    0x77, 0x4F, 0x77, 0x49, 0xE7, 0x75, 0xE9, 0x77, 0x39, 0xF7, 0x74, 0xFA, 0x77, 0x3F, 0xCA, 0x19,
+    0x99, 0x97, 0x4F, 0xFF, 0x97, 0x3E, 0xAF, 0xFC, 0x73, 0xE9, 0xAF, 0xFC, 0x72, 0xE9, 0x77, 0x4E,
+    0x97, 0x74, 0xE9, 0x77, 0x4C, 0xA9, 0x77, 0x77, 0x77, 0x72, 0x9C, 0xA7, 0x6A, 0xCA, 0x76, 0xD7,
+    0x69, 0xD7, 0x6D, 0xA7, 0x6D, 0x76, 0x9D, 0x76, 0xDA, 0x29, 0x70, 0x99, 0xFD, 0xAA, 0x19, 0xAF,
+    0xF9, 0x70, 0x99, 0x2A, 0xCA, 0x76, 0xDA, 0x75, 0x9F, 0x74, 0xAF, 0x50, 0x73, 0xCA, 0x74, 0xD7,
+    0x4A, 0xC9, 0x74, 0x99, 0x77, 0x77, 0x70, 0x99, 0x94, 0xDA, 0x39, 0xE3, 0x9D, 0x93, 0xAE, 0x92,
+    0xAD, 0x4F, 0xA2, 0xE3, 0x9F, 0xC1, 0x9D, 0x93, 0xAF, 0xC1, 0xAD, 0x4E, 0xAD, 0x1E, 0x39, 0xE9,
+    0xD9, 0x9D, 0x93, 0xEA, 0x9D, 0xAA, 0xD4, 0xE9, 0x0F, 0xD3, 0xAE, 0x1F, 0xC9, 0x3F, 0x1F, 0xC4,
+    0xEA, 0x1A, 0xF3, 0xAE, 0x91, 0x9E, 0xA3, 0x71, 0x99, 0x70, 0xD7, 0x0A, 0xCA, 0x79, 0xD7, 0x77,
+    0x77, 0x0A, 0xCA, 0xEA, 0x4F, 0xEA, 0x29, 0xE9, 0x0A, 0xD2, 0xAD, 0x29, 0xD2, 0xD9, 0x2D, 0xA1,
+    0x9D, 0x3D, 0x91, 0xE2, 0xAD, 0x2E, 0x2E, 0x1A, 0xDA, 0x19, 0xE1, 0x49, 0x99, 0x4D, 0xA3, 0x9E,
+    0x39, 0xD9, 0x3A, 0xE9, 0x2A, 0xD4, 0xFA, 0x2E, 0x39, 0xFC, 0x19, 0xD9, 0x3A, 0xFC, 0x1A, 0xD4,
+    0xEA, 0xD1, 0xE3, 0x9E, 0x9D, 0x99, 0xD9, 0x3E, 0xA9, 0xDA, 0xAD, 0x4E, 0x90, 0xFD, 0x3A, 0xE1,
+    0xFC, 0x93, 0xF1, 0xFC, 0x4E, 0xA1, 0xAF, 0x3A, 0xE9, 0x19, 0xEA, 0x77, 0x7F, 0x72, 0x9E, 0x73,
+    0xAD, 0xA7, 0x29, 0xE7, 0x3E, 0xA7, 0x39, 0x99, 0x72, 0x76, 0xAC, 0xAE, 0xA4, 0xFE, 0xA2, 0x9E,
+    0x90, 0xAD, 0x2A, 0xD2, 0x9D, 0x2D, 0x92, 0xDA, 0x19, 0xD3, 0xD9, 0x1E, 0x2A, 0xD2, 0xE2, 0xE1,
+    0xAD, 0xA1, 0x9E, 0x49, 0x99, 0x97, 0xEA, 0x69, 0xE7, 0xEA, 0x69, 0xE7, 0xE9, 0x79, 0x99, 0x70,
+    0x7A, 0xCA, 0x19, 0xD9, 0x70, 0xEA, 0xD7, 0x3E, 0xA7, 0x49, 0xCA, 0x77, 0x77, 0x77, 0x73, 0x99,
+    0x94, 0xDA, 0x49, 0xE3, 0x9D, 0x94, 0xAE, 0x92, 0xAD, 0x5F, 0xA2, 0xE4, 0x9F, 0xC1, 0x9D, 0x94,
+    0xAF, 0xC1, 0xAD, 0x5E, 0xAD, 0x1E, 0x49, 0xE9, 0xD9, 0x9D, 0x94, 0xEA, 0x9D, 0xAA, 0xD5, 0xE9,
+    0x0F, 0xD4, 0xAE, 0x1F, 0xC9, 0x4F, 0x1F, 0xC5, 0xEA, 0x1A, 0xF4, 0xAE, 0x91, 0x9E, 0xA4, 0x5A,
+    0xC9, 0x2A, 0xC7, 0xDA, 0xAD, 0x70, 0x9E, 0xA7, 0x2D, 0xA7, 0x49, 0x77, 0x77, 0x77, 0x4A, 0xCA,
+    0xEA, 0x7F, 0xEA, 0x59, 0xE9, 0x0A, 0xD5, 0xAD, 0x29, 0xD5, 0xD9, 0x2D, 0xA4, 0x9D, 0x3D, 0x94,
+    0xE2, 0xAD, 0x5E, 0x2E, 0x4A, 0xDA, 0x19, 0xE4, 0x77, 0x71, 0x9D, 0x97, 0x72, 0xDA, 0x77, 0x2E,
+    0x77, 0x2A, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xAC, 0xAE, 0xA7, 0x7F, 0xEA, 0x75,
+    0x9E, 0x90, 0xAD, 0x75, 0xAD, 0x29, 0xD7, 0x5D, 0x92, 0xDA, 0x74, 0x9D, 0x3D, 0x97, 0x4E, 0x2A,
+    0xD7, 0x5E, 0x2E, 0x74, 0xAD, 0xA1, 0x9E, 0x10, 0x49, 0x99, 0x4D, 0xA3, 0x9E, 0x39, 0xD9, 0x3A,
+    0xE9, 0x2A, 0xD4, 0xFA, 0x2E, 0x39, 0xFC, 0x19, 0xD9, 0x3A, 0xFC, 0x1A, 0xD4, 0xEA, 0xD1, 0xE3,
+    0x9E, 0x9D, 0x99, 0xD9, 0x3E, 0xA9, 0xDA, 0xAD, 0x4E, 0x90, 0xFD, 0x3A, 0xE1, 0xFC, 0x93, 0xF1,
+    0xFC, 0x4E, 0xA1, 0xAF, 0x3A, 0xE9, 0x19, 0xEA, 0x72, 0xAE, 0x71, 0xFC, 0xA7, 0x0F, 0xD7, 0x75,
+    0x76, 0xAC, 0xAE, 0xA4, 0xFE, 0xA2, 0x9E, 0x90, 0xAD, 0x2A, 0xD2, 0x9D, 0x2D, 0x92, 0xDA, 0x19,
+    0xD3, 0xD9, 0x1E, 0x2A, 0xD2, 0xE2, 0xE1, 0xAD, 0xA1, 0x9E, 0x7A, 0xD9, 0x5F, 0xC5, 0x9F, 0xA7,
+    0x60, 0x76, 0x97, 0x0A, 0xFE, 0x79, 0xFF, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xEA, 0x97, 0x0F, 0xFA,
+    0x6F, 0x99, 0xAE, 0x94, 0xE9, 0x39, 0xE3, 0xE9, 0x5E, 0x3D, 0xA6, 0xE2, 0xAD, 0x96, 0xDA, 0x2E,
+    0x6A, 0xD9, 0x2E, 0x6E, 0x29, 0xEA, 0x29, 0xAE, 0xA2, 0x9F, 0xFF, 0x93, 0xFF, 0xEA, 0x4A, 0xFF,
+    0xCA, 0x69, 0xAF, 0xCA, 0x77, 0x60, 0x72, 0x95, 0xFE, 0xA3, 0xAF, 0xEA, 0x77, 0x77, 0x73, 0xAE,
+    0x95, 0x9F, 0xDA, 0x39, 0xDA, 0x1A, 0xD3, 0xD9, 0x29, 0xD2, 0x9D, 0x3D, 0xA2, 0xAD, 0x99, 0xAE,
+    0x92, 0x9F, 0xEA, 0x4F, 0xE6, 0xAD, 0xA9, 0x40, 0x70, 0x94, 0x97, 0x1D, 0xAA, 0xAD, 0x71, 0xFD,
+    0xA7, 0x19, 0xF9, 0x77, 0x77, 0x72, 0x9A, 0xEA, 0x97, 0x0F, 0xFA, 0x6F, 0x99, 0xAE, 0x94, 0xE9,
+    0x39, 0xE3, 0xE9, 0x5E, 0x3D, 0xA6, 0xE2, 0xAD, 0x96, 0xDA, 0x2E, 0x6A, 0xD9, 0x2E, 0x6E, 0x29,
+    0xEA, 0x29, 0xAE, 0xA2, 0x9F, 0xFF, 0x93, 0xFF, 0xEA, 0x4A, 0xFF, 0xCA, 0x69, 0xAF, 0xCA, 0x77,
+    0x60, 0x59, 0x73, 0x9D, 0xAA, 0xAD, 0x59, 0xFD, 0x96, 0x9E, 0xA9, 0x77, 0x77, 0x2A, 0xE9, 0x69,
+    0xFD, 0xA4, 0x9D, 0xA1, 0xAD, 0x4D, 0x92, 0x9D, 0x39, 0xD3, 0xDA, 0x3A, 0xD9, 0x9A, 0xE9, 0x39,
+    0xFE, 0xA5, 0xFE, 0x7A, 0xDA, 0x95, 0x7A, 0xD3, 0x9D, 0x96, 0xAD, 0x39, 0xDA, 0x6E, 0x92, 0x9D,
+    0xA7, 0x77, 0x77, 0x69, 0xAE, 0xA9, 0x72, 0xFF, 0xA7, 0x0F, 0x99, 0xAE, 0x96, 0xE9, 0x39, 0xE5,
+    0xE9, 0x5E, 0x5D, 0xA6, 0xE4, 0xAD, 0x96, 0xDA, 0x4E, 0x6A, 0xD9, 0x4E, 0x6E, 0x49, 0xEA, 0x29,
+    0xAE, 0xA4, 0x9F, 0xFF, 0x95, 0xFF, 0xEA, 0x6A, 0xFF, 0xCA, 0x70, 0x9A, 0xFC, 0xA7, 0x77, 0x20,
+    0x4D, 0xA3, 0xAD, 0x4E, 0x3A, 0xD9, 0x3E, 0x3A, 0xDA, 0x77, 0x77, 0x6A, 0xE9, 0x70, 0x9F, 0xDA,
+    0x69, 0xDA, 0x1A, 0xD6, 0xD9, 0x29, 0xD5, 0x9D, 0x3D, 0xA5, 0xAD, 0x99, 0xAE, 0x95, 0x9F, 0xEA,
+    0x7F, 0xE7, 0x1A, 0xDA, 0x97, 0x69, 0xAE, 0xA2, 0x99, 0x99, 0x99, 0x96, 0xAF, 0xFF, 0xE9, 0x5F,
+    0x99, 0xAF, 0xFD, 0x5E, 0x93, 0x9E, 0x72, 0xE9, 0x49, 0xE7, 0x2E, 0x5F, 0x99, 0xA6, 0xAD, 0x95,
+    0xFE, 0x6E, 0x59, 0xFE, 0x6E, 0x5F, 0x71, 0x9E, 0x93, 0x9E, 0xA7, 0x19, 0xFF, 0xFC, 0xAA, 0xAA,
+    0x95, 0xFF, 0xFF, 0xCA, 0x5A, 0xFF, 0xFF, 0xA6, 0x9A, 0xFF, 0xFD, 0x97, 0x77, 0x30, 0x4A, 0xE9,
+    0x1A, 0xDA, 0x94, 0x9F, 0xFD, 0xAD, 0x39, 0xDA, 0x1A, 0xE9, 0x09, 0xAC, 0xA2, 0xDA, 0x29, 0xFF,
+    0xA1, 0x9D, 0x3E, 0xAA, 0xAA, 0xA9, 0x91, 0xAD, 0x99, 0xAF, 0x49, 0x29, 0xFF, 0xFD, 0xA3, 0xFF,
+    0xFD, 0xA4, 0xAD, 0xA9, 0x1A, 0xF9, 0x20, 0x70, 0x9C, 0x97, 0x1D, 0x71, 0xD7, 0x29, 0x97, 0x74,
+    0xFC, 0xA5, 0xAF, 0xE4, 0xD9, 0x2D, 0x93, 0xD3, 0xD3, 0xAD, 0x29, 0xD3, 0xDA, 0x19, 0xDA, 0x3F,
+    0xF3, 0xAF, 0xE4, 0xFF, 0x93, 0xE2, 0xDA, 0x2A, 0xE1, 0x9D, 0xA2, 0xEA, 0x1A, 0xE2, 0xE9, 0x1F,
+    0x1A, 0xE9, 0x1F, 0x76, 0x5A, 0xC9, 0x59, 0xCA, 0x6D, 0x69, 0x99, 0x59, 0xDA, 0xD9, 0x2A, 0xFC,
+    0x92, 0xEA, 0x99, 0x29, 0xD9, 0x5A, 0xD6, 0xDA, 0x5A, 0xD9, 0x5E, 0x94, 0x9E, 0x50, 0x77, 0x4A,
+    0xE9, 0x7E, 0xA7, 0x0E, 0x70, 0xEA, 0x79, 0xE7, 0x09, 0xAA, 0x97, 0x77, 0x71, 0xFC, 0xA5, 0xAF,
+    0xE4, 0xD9, 0x2D, 0x93, 0xD3, 0xD3, 0xAD, 0x29, 0xD3, 0xDA, 0x19, 0xDA, 0x3F, 0xF3, 0xAF, 0xE4,
+    0xFF, 0x93, 0xE2, 0xDA, 0x2A, 0xE1, 0x9D, 0xA2, 0xEA, 0x1A, 0xE2, 0xE9, 0x1F, 0x1A, 0xE9, 0x1F,
+    0x76, 0x59, 0x99, 0x5A, 0xE5, 0xEA, 0x49, 0xE5, 0xE9, 0x4A, 0xE5, 0x99, 0x97, 0x70, 0x9D, 0xAD,
+    0x92, 0xAF, 0xC9, 0x2E, 0xA9, 0x92, 0x9D, 0x95, 0xAD, 0x6D, 0xA5, 0xAD, 0x95, 0xE9, 0x49, 0xE5,
+    0x59, 0x93, 0x99, 0x69, 0xD1, 0xDA, 0x7A, 0xF9, 0x71, 0xE7, 0x39, 0xC7, 0x77, 0x77, 0xFC, 0xA7,
+    0xAF, 0xE6, 0xD9, 0x2D, 0x95, 0xD3, 0xD5, 0xAD, 0x29, 0xD5, 0xDA, 0x19, 0xDA, 0x5F, 0xF5, 0xAF,
+    0xE6, 0xFF, 0x95, 0xE2, 0xDA, 0x4A, 0xE1, 0x9D, 0xA4, 0xEA, 0x1A, 0xE4, 0xE9, 0x1F, 0x3A, 0xE9,
+    0x1F, 0x77, 0x20, 0x2A, 0xA3, 0xAA, 0x39, 0xD9, 0x9D, 0x94, 0xAF, 0x7D, 0xA7, 0x09, 0xA7, 0x73,
+    0x9D, 0xAD, 0x94, 0xAF, 0xC9, 0x4E, 0xA9, 0x94, 0x9D, 0x97, 0xAD, 0x70, 0xDA, 0x7A, 0xD9, 0x7E,
+    0x96, 0x9E, 0x70, 0x72, 0x99, 0x73, 0x9C, 0xA7, 0x3D, 0x73, 0xAC, 0x97, 0x77, 0x29, 0x99, 0x70,
+    0x9F, 0xE5, 0xAF, 0xE5, 0x9E, 0x92, 0x95, 0xAD, 0x73, 0xE7, 0x3F, 0xA9, 0x70, 0xAF, 0xDA, 0x79,
+    0xFE, 0x71, 0x9F, 0x97, 0x2E, 0xA2, 0x9C, 0xA3, 0x9E, 0x91, 0x9F, 0xFE, 0x2F, 0xFD, 0xA4, 0xAF,
+    0xDA, 0x40, 0x70, 0x97, 0x0D, 0x7A, 0xC9, 0x69, 0xD7, 0x70, 0x9F, 0xA3, 0x9D, 0xAA, 0xAC, 0x3A,
+    0xC9, 0x79, 0xDA, 0xA7, 0xAE, 0xA7, 0xE2, 0xEA, 0xF1, 0xFF, 0x91, 0x9A, 0xFA, 0x75, 0x70, 0xD7,
+    0x49, 0xE7, 0x3F, 0xC9, 0x70, 0xDA, 0x1A, 0xCA, 0x77, 0x77, 0x71, 0x99, 0x97, 0x19, 0xFE, 0x6A,
+    0xFE, 0x69, 0xE9, 0x29, 0x6A, 0xD7, 0x4E, 0x74, 0xFA, 0x97, 0x1A, 0xFD, 0xA7, 0x09, 0xFE, 0x72,
+    0x9F, 0x97, 0x3E, 0xA3, 0x9C, 0xA3, 0x9E, 0x92, 0x9F, 0xFE, 0x3F, 0xFD, 0xA5, 0xAF, 0xDA, 0x50,
+    0x77, 0x2A, 0xCA, 0x71, 0xEA, 0x7F, 0xD5, 0xAC, 0xA1, 0x9D, 0x77, 0x19, 0xAE, 0xA5, 0x9D, 0xAA,
+    0xAC, 0x5A, 0xC9, 0x71, 0x9D, 0xAA, 0x71, 0xAE, 0xA7, 0x1E, 0x4E, 0xAF, 0x3F, 0xF9, 0x39, 0xAF,
+    0xA7, 0x71, 0x70, 0x99, 0x97, 0x09, 0xFE, 0x5A, 0xFE, 0x59, 0xE9, 0x29, 0x5A, 0xD7, 0x3E, 0x73,
+    0xFA, 0x97, 0x0A, 0xFD, 0xA7, 0x9F, 0xE7, 0x19, 0xF9, 0x72, 0xEA, 0x3C, 0xA3, 0x9E, 0x92, 0xFF,
+    0xE2, 0xFF, 0xDA, 0x39, 0xAF, 0xDA, 0x7A, 0xC9, 0x73, 0xAD, 0x72, 0xAD, 0xA7, 0x2A, 0xA9, 0x71,
+    0x76, 0x9F, 0xA3, 0x9D, 0xAA, 0xAC, 0x3A, 0xC9, 0x79, 0xDA, 0xA7, 0xAE, 0xA7, 0xE2, 0xEA, 0xF1,
+    0xFF, 0x91, 0xAF, 0xCA, 0x4C, 0xA7, 0xAD, 0xA6, 0xCA, 0xC9, 0x59, 0xDA, 0x60, 0x7A, 0xA2, 0x9A,
+    0xA7, 0x0A, 0xD9, 0xDA, 0x72, 0xF9, 0x73, 0x9D, 0x97, 0x59, 0x97, 0x77, 0x69, 0x99, 0x72, 0x9F,
+    0xE7, 0xAF, 0xE7, 0x9E, 0x92, 0x97, 0xAD, 0x75, 0xE7, 0x5F, 0xA9, 0x72, 0xAF, 0xDA, 0x71, 0x9F,
+    0xE7, 0x39, 0xF9, 0x74, 0xEA, 0x49, 0xCA, 0x39, 0xE9, 0x39, 0xFF, 0xE4, 0xFF, 0xDA, 0x6A, 0xFD,
+    0xA6, 0x4A, 0xC9, 0x2A, 0xA5, 0x9D, 0x9A, 0xD7, 0xAE, 0xA7, 0x1D, 0xA7, 0x39, 0x77, 0x69, 0xFA,
+    0x69, 0xDA, 0xAA, 0xC6, 0xAC, 0x97, 0x29, 0xDA, 0xA7, 0x2A, 0xEA, 0x72, 0xE5, 0xEA, 0xF4, 0xFF,
+    0x94, 0x9A, 0xFA, 0x77, 0x30, 0x0F, 0xFF, 0x09, 0xFF, 0xF0, 0xAF, 0xFE, 0xA5, 0xDA, 0x71, 0xAD,
+    0x97, 0x1E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xE9, 0x71, 0xE7, 0x19, 0xE7, 0x1A, 0xDA, 0x71, 0xE9,
+    0x70, 0x9E, 0x72, 0xAA, 0x72, 0x9D, 0x97, 0x19, 0x9C, 0xA7, 0x1E, 0x97, 0x1A, 0xA9, 0x71, 0x76,
+    0xAC, 0x95, 0x9D, 0x6A, 0xD4, 0xAF, 0xD9, 0x09, 0xFE, 0x92, 0xAD, 0x6D, 0xA6, 0xD6, 0x9D, 0x6E,
+    0xAA, 0x4F, 0xC9, 0x3F, 0xC9, 0x29, 0xC9, 0x6E, 0x59, 0xAD, 0x5A, 0xD9, 0x50, 0x4A, 0x93, 0xA9,
+    0x5D, 0xA0, 0xAD, 0x7F, 0xA7, 0x09, 0xD9, 0x72, 0xA9, 0x77, 0x77, 0x1F, 0xFF, 0x09, 0xFF, 0xF0,
+    0xAF, 0xFE, 0xA5, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xE9, 0x71, 0xE7,
+    0x19, 0xE7, 0x1A, 0xDA, 0x71, 0xE9, 0x70, 0x9E, 0x70, 0x71, 0x9D, 0x71, 0xD9, 0x71, 0xD4, 0xAC,
+    0xA1, 0xAD, 0x39, 0xD2, 0x99, 0x93, 0xAD, 0x7A, 0xFD, 0x93, 0x9F, 0xE9, 0x5A, 0xD7, 0x1D, 0xA7,
+    0x1D, 0x71, 0x9D, 0x71, 0xEA, 0xA7, 0xFC, 0x96, 0xFC, 0x95, 0x0F, 0xFF, 0x09, 0xFF, 0xF0, 0xAF,
+    0xFE, 0xA4, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0xFF, 0x93, 0x9F, 0xF7, 0xE9, 0x71, 0xE7, 0x19,
+    0xE7, 0x1A, 0xDA, 0x71, 0xE9, 0x70, 0x9E, 0x70, 0x77, 0x0A, 0xC9, 0x69, 0xD7, 0xAD, 0x5A, 0xFD,
+    0x91, 0x9F, 0xE9, 0x3A, 0xD4, 0xAF, 0xEA, 0x1F, 0xF9, 0x39, 0xD7, 0xEA, 0xA5, 0xFC, 0x94, 0xFC,
+    0x91, 0x70, 0xAC, 0xA0, 0xCA, 0x70, 0x9E, 0x9C, 0x97, 0x0D, 0x0E, 0x71, 0xAA, 0x09, 0xA9, 0x77,
+    0x77, 0x77, 0x5E, 0xA3, 0xEA, 0x29, 0xE4, 0xE9, 0x2A, 0xE3, 0x9E, 0x3E, 0xA3, 0xAE, 0x3E, 0x93,
+    0xE9, 0x29, 0xE4, 0xE3, 0xAD, 0xA3, 0x9E, 0x3E, 0x93, 0xAD, 0x93, 0xE4, 0xE4, 0xE3, 0xAE, 0x39,
+    0xFF, 0xD9, 0x39, 0xFF, 0xD4, 0x9F, 0xFC, 0x95, 0xAF, 0xE9, 0x77, 0x40, 0x49, 0xCA, 0x0C, 0xA4,
+    0xFC, 0xA3, 0xAC, 0x09, 0xD7, 0x77, 0x72, 0x9D, 0x3D, 0xA0, 0xAC, 0xA3, 0xD9, 0x0A, 0xC9, 0x2A,
+    0xD1, 0xD3, 0xE1, 0xD2, 0x9D, 0xA0, 0x9D, 0x2E, 0x90, 0x9F, 0xF1, 0x9F, 0xF2, 0xAF, 0xDA, 0x10,
+    0x73, 0x99, 0x97, 0x0F, 0xE9, 0x6F, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x3E, 0xA3, 0xEA, 0x29, 0xE4,
+    0xE9, 0x2A, 0xE3, 0x9E, 0x3E, 0xA3, 0xAE, 0x3E, 0x93, 0xE9, 0x29, 0xE4, 0xE3, 0xAD, 0xA3, 0x9E,
+    0x3E, 0x93, 0xAD, 0x93, 0xE4, 0xE4, 0xE3, 0xAE, 0x39, 0xFF, 0xD9, 0x39, 0xFF, 0xD4, 0x9F, 0xFC,
+    0x95, 0xAF, 0xE9, 0x77, 0x40, 0x59, 0x99, 0x99, 0x93, 0xFE, 0xA2, 0xAF, 0xAA, 0xA9, 0x77, 0x77,
+    0x49, 0xD3, 0xDA, 0x1A, 0xCA, 0x3D, 0x91, 0xAC, 0x92, 0xAD, 0x2D, 0x3E, 0x2D, 0x29, 0xDA, 0x19,
+    0xD2, 0xE9, 0x19, 0xFF, 0x29, 0xFF, 0x3A, 0xFD, 0xA2, 0x79, 0xC9, 0x19, 0xCA, 0x7A, 0xFD, 0x97,
+    0x9F, 0xCA, 0x72, 0x99, 0x97, 0x77, 0x77, 0x76, 0xEA, 0x3E, 0xA2, 0x9E, 0x4E, 0x92, 0xAE, 0x39,
+    0xE3, 0xEA, 0x3A, 0xE3, 0xE9, 0x3E, 0x92, 0x9E, 0x4E, 0x3A, 0xDA, 0x39, 0xE3, 0xE9, 0x3A, 0xD9,
+    0x3E, 0x4E, 0x4E, 0x3A, 0xE3, 0x9F, 0xFD, 0x93, 0x9F, 0xFD, 0x49, 0xFF, 0xC9, 0x5A, 0xFE, 0x97,
+    0x74, 0x39, 0xCA, 0x19, 0xAA, 0x49, 0xFD, 0xA5, 0xFC, 0xA7, 0x99, 0x97, 0x77, 0x69, 0xD3, 0xDA,
+    0x2A, 0xCA, 0x3D, 0x92, 0xAC, 0x92, 0xAD, 0x3D, 0x3E, 0x3D, 0x29, 0xDA, 0x29, 0xD2, 0xE9, 0x29,
+    0xFF, 0x39, 0xFF, 0x4A, 0xFD, 0xA3, 0x71, 0xAC, 0xA7, 0x39, 0xCA, 0xC9, 0x72, 0xAE, 0x74, 0xD9,
+    0x77, 0x77, 0x77, 0x77, 0x6E, 0xA3, 0xEA, 0x29, 0xE4, 0xE9, 0x2A, 0xE3, 0x9E, 0x3E, 0xA3, 0xAE,
+    0x3E, 0x93, 0xE9, 0x29, 0xE4, 0xE3, 0xAD, 0xA3, 0x9E, 0x3E, 0x93, 0xAD, 0x93, 0xE4, 0xE4, 0xE3,
+    0xAE, 0x39, 0xFF, 0xD9, 0x39, 0xFF, 0xD4, 0x9F, 0xFC, 0x95, 0xAF, 0xE9, 0x77, 0x40, 0x59, 0xD7,
+    0xCA, 0xCA, 0x59, 0xE9, 0x6D, 0x97, 0x77, 0x73, 0x9D, 0x3D, 0xA0, 0xAC, 0xA3, 0xD9, 0x0A, 0xC9,
+    0x2A, 0xD1, 0xD3, 0xE1, 0xD2, 0x9D, 0xA0, 0x9D, 0x2E, 0x90, 0x9F, 0xF1, 0x9F, 0xF2, 0xAF, 0xDA,
+    0x10, 0x69, 0xD9, 0x3D, 0xA6, 0x9D, 0xA3, 0xE6, 0x9D, 0xA3, 0xE7, 0x77, 0x77, 0x77, 0x7E, 0xA3,
+    0xEA, 0x59, 0xE4, 0xE9, 0x5A, 0xE3, 0x9E, 0x6E, 0xA3, 0xAE, 0x6E, 0x93, 0xE9, 0x59, 0xE4, 0xE6,
+    0xAD, 0xA3, 0x9E, 0x6E, 0x93, 0xAD, 0x96, 0xE4, 0xE7, 0xE3, 0xAE, 0x69, 0xFF, 0xD9, 0x69, 0xFF,
+    0xD7, 0x9F, 0xFC, 0x97, 0x0A, 0xFE, 0x97, 0x77, 0x20, 0x3D, 0xA3, 0xAD, 0x29, 0xE3, 0xE2, 0x9E,
+    0x3E, 0x97, 0x77, 0x70, 0x9D, 0x3D, 0xA4, 0xAC, 0xA3, 0xD9, 0x4A, 0xC9, 0x2A, 0xD5, 0xD3, 0xE5,
+    0xD2, 0x9D, 0xA4, 0x9D, 0x2E, 0x94, 0x9F, 0xF5, 0x9F, 0xF6, 0xAF, 0xDA, 0x50, 0x3E, 0xA3, 0xEA,
+    0x29, 0xE4, 0xE9, 0x2A, 0xE3, 0x9E, 0x3E, 0xA3, 0xAE, 0x3E, 0x93, 0xE9, 0x29, 0xE4, 0xE3, 0xAD,
+    0xA3, 0x9E, 0x3E, 0x93, 0xAD, 0x93, 0xE4, 0xE4, 0xE3, 0xAE, 0x39, 0xFF, 0xD9, 0x39, 0xFF, 0xD4,
+    0x9F, 0xFC, 0x95, 0xAF, 0xE9, 0x72, 0xDA, 0x73, 0x9C, 0xA7, 0x4A, 0xE7, 0x4A, 0xD7, 0x76, 0x09,
+    0xD3, 0xDA, 0x0A, 0xCA, 0x3D, 0x90, 0xD9, 0x2A, 0xD1, 0xD3, 0xE1, 0xD2, 0x9D, 0xA0, 0x9D, 0x19,
+    0xE9, 0x09, 0xFF, 0x19, 0xFF, 0x2A, 0xFD, 0xA5, 0x9D, 0x7D, 0x7A, 0xE7, 0xAD, 0x76, 0x77, 0x73,
+    0xD7, 0x70, 0xAE, 0x76, 0x9D, 0xAD, 0x97, 0x4D, 0x91, 0xAC, 0xA7, 0x77, 0x77, 0x6E, 0x97, 0x2E,
+    0x1E, 0x97, 0x1A, 0xDA, 0x1E, 0x97, 0x09, 0xE2, 0xE9, 0x29, 0x93, 0xEA, 0x2E, 0x29, 0xDA, 0x19,
+    0xE2, 0x9E, 0x19, 0xEA, 0x1E, 0x92, 0x9E, 0x1F, 0xC0, 0x9E, 0x39, 0xE0, 0xFD, 0x0E, 0x93, 0x9E,
+    0xAF, 0xDA, 0xE4, 0xAF, 0xD9, 0xFD, 0x94, 0xAF, 0xD0, 0xFD, 0x5A, 0xFC, 0x1A, 0xF9, 0x5A, 0xF9,
+    0x1A, 0xF6, 0xAF, 0x2A, 0xE9, 0x60, 0x49, 0xC9, 0x73, 0xE9, 0x71, 0xAF, 0xA7, 0x9D, 0x19, 0xD7,
+    0x77, 0x77, 0x71, 0xD9, 0x6A, 0xD1, 0xD9, 0x6D, 0x91, 0xD9, 0x1D, 0x1E, 0x2D, 0x90, 0xE0, 0x9D,
+    0x92, 0xDA, 0xF9, 0xE3, 0xFF, 0xD9, 0x3F, 0xFD, 0x4F, 0xFC, 0x94, 0xEA, 0x0E, 0xA5, 0xE1, 0xE7,
+    0x74, 0x77, 0x0A, 0xC9, 0x71, 0xEA, 0x7F, 0xCA, 0x5A, 0xCA, 0x19, 0xD7, 0x77, 0x77, 0x1E, 0x5E,
+    0x0A, 0xD9, 0x3A, 0xD9, 0x09, 0xDA, 0x29, 0xDA, 0x19, 0xE2, 0xE3, 0xE1, 0xE4, 0xE9, 0xE9, 0x4A,
+    0xFC, 0xA5, 0x9F, 0xC6, 0x9F, 0x70, 0xE9, 0x79, 0xE7, 0x0A, 0xE7, 0x0E, 0xA7, 0x9E, 0x97, 0x77,
+    0x59, 0xCA, 0x73, 0xEA, 0x71, 0xEA, 0xD7, 0xAC, 0xA1, 0x9D, 0x97, 0x77, 0x77, 0x71, 0xDA, 0x3A,
+    0xD4, 0xE2, 0x9D, 0x5A, 0xD2, 0xDA, 0x59, 0xDA, 0x0A, 0xD7, 0xE0, 0xD9, 0x7F, 0xD7, 0x0A, 0xF7,
+    0x19, 0xEA, 0x72, 0xE7, 0x29, 0xD9, 0x71, 0x9E, 0x7A, 0xFC, 0x70, 0xFC, 0x97, 0x0E, 0xA7, 0x10,
+    0x39, 0xD9, 0x0E, 0x4E, 0x1D, 0xA4, 0xE0, 0xAD, 0xA3, 0x9A, 0xAA, 0x0A, 0xAA, 0x97, 0x77, 0x77,
+    0x74, 0xE5, 0xE0, 0xAD, 0x93, 0xAD, 0x90, 0x9D, 0xA2, 0x9D, 0xA1, 0x9E, 0x2E, 0x3E, 0x1E, 0x4E,
+    0x9E, 0x94, 0xAF, 0xCA, 0x59, 0xFC, 0x69, 0xF7, 0x0E, 0x97, 0x9E, 0x70, 0xAE, 0x70, 0xEA, 0x79,
+    0xE9, 0x70, 0x72, 0x99, 0x76, 0xD7, 0x5D, 0x75, 0xAC, 0xA7, 0x77, 0x2F, 0xFE, 0xA4, 0xFF, 0xE9,
+    0x4A, 0xFF, 0xD7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0xA7, 0x1F, 0xCA,
+    0x70, 0x9F, 0xC9, 0x70, 0xAF, 0xDA, 0xAA, 0xA9, 0x4F, 0xFE, 0xA3, 0x9F, 0xFE, 0xA3, 0xAF, 0xFE,
+    0xA3, 0x70, 0xAC, 0x71, 0xAC, 0x97, 0x09, 0xD7, 0x19, 0x97, 0x77, 0x71, 0xFF, 0x4F, 0xF7, 0x9D,
+    0xA7, 0xAD, 0x96, 0x9E, 0x7E, 0xA6, 0x9F, 0x99, 0x94, 0xFF, 0x92, 0xAF, 0xFA, 0x20, 0x72, 0xDA,
+    0x74, 0x9D, 0xA7, 0x4E, 0x97, 0x4A, 0xAA, 0x77, 0x71, 0xFF, 0xEA, 0x4F, 0xFE, 0x94, 0xAF, 0xFD,
+    0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x1A, 0xFA, 0x71, 0xFC, 0xA7, 0x09, 0xFC,
+    0x97, 0x0A, 0xFD, 0xAA, 0xAA, 0x94, 0xFF, 0xEA, 0x39, 0xFF, 0xEA, 0x3A, 0xFF, 0xEA, 0x30, 0x70,
+    0xDA, 0x70, 0x9D, 0xA7, 0x0E, 0x97, 0x0A, 0xAA, 0x77, 0x77, 0xFF, 0x4F, 0xF7, 0x9D, 0xA7, 0xAD,
+    0x96, 0x9E, 0x7E, 0xA6, 0x9F, 0x99, 0x94, 0xFF, 0x92, 0xAF, 0xFA, 0x20, 0x77, 0x70, 0xD9, 0x1A,
+    0xCA, 0x70, 0x9D, 0xAD, 0x97, 0x2A, 0xE7, 0x5D, 0x77, 0x77, 0x73, 0xFF, 0xEA, 0x4F, 0xFE, 0x94,
+    0xAF, 0xFD, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x1A, 0xFA, 0x71, 0xFC, 0xA7,
+    0x09, 0xFC, 0x97, 0x0A, 0xFD, 0xAA, 0xAA, 0x94, 0xFF, 0xEA, 0x39, 0xFF, 0xEA, 0x3A, 0xFF, 0xEA,
+    0x30, 0x77, 0x4D, 0xA1, 0xD9, 0x7F, 0xC9, 0x70, 0x9E, 0x73, 0xD7, 0x77, 0x77, 0x75, 0xFF, 0x6F,
+    0xF7, 0x19, 0xDA, 0x71, 0xAD, 0x97, 0x09, 0xE7, 0x1E, 0xA7, 0x09, 0xF9, 0x99, 0x6F, 0xF9, 0x4A,
+    0xFF, 0xA4, 0x69, 0x7A, 0xF4, 0x9F, 0xC4, 0xE9, 0x6D, 0x96, 0x9D, 0x7A, 0xCA, 0x7D, 0x96, 0x9D,
+    0x96, 0xAD, 0x7E, 0x7D, 0xA6, 0x9D, 0x96, 0xE7, 0x71, 0x77, 0x19, 0x77, 0x2D, 0x69, 0xAE, 0xA9,
+    0x29, 0xCA, 0x5F, 0xFA, 0x0A, 0xD9, 0x4F, 0x99, 0xAE, 0x9A, 0xC9, 0x4E, 0x93, 0x9E, 0x6E, 0x95,
+    0xE6, 0xDA, 0x6E, 0x5A, 0xD9, 0x6D, 0xA5, 0xE6, 0xAD, 0x95, 0xE6, 0xE5, 0x9E, 0xA2, 0x9A, 0xEA,
+    0x59, 0xFF, 0xF9, 0x6F, 0xFE, 0xA7, 0xAF, 0xFC, 0xA7, 0x19, 0xAF, 0xCA, 0x77, 0x74, 0x77, 0x70,
+    0x9C, 0x94, 0xAE, 0x90, 0xAC, 0x92, 0x9F, 0xFC, 0x29, 0xDA, 0x1A, 0xE3, 0xD9, 0x29, 0xD3, 0x9D,
+    0x3D, 0xA3, 0xAD, 0x99, 0xAE, 0x93, 0x9F, 0xEA, 0x5F, 0xE7, 0xAD, 0xA9, 0x50, 0x77, 0x19, 0xFF,
+    0x4A, 0xFF, 0xD2, 0x9F, 0xCA, 0x2D, 0xA1, 0xDA, 0x9D, 0x92, 0xAC, 0xA1, 0xD0, 0xAD, 0x2A, 0xDA,
+    0x1C, 0xA0, 0xFF, 0xC2, 0xA9, 0x9F, 0xF9, 0x4A, 0xFE, 0x95, 0xEA, 0xA9, 0x96, 0x9E, 0x72, 0xAD,
+    0xA7, 0x2E, 0x97, 0x19, 0xE9, 0x71, 0xAE, 0x71, 0x77, 0x5A, 0xD9, 0x71, 0x9E, 0x97, 0x1E, 0x99,
+    0x97, 0x0F, 0xE6, 0x9F, 0xAA, 0xD5, 0xAE, 0x2A, 0xC5, 0xE9, 0x2A, 0xC4, 0x9E, 0x3D, 0x4A, 0xE2,
+    0x9C, 0xA4, 0xFF, 0xC9, 0x4F, 0xFA, 0x4A, 0xFE, 0xA5, 0xE0, 0x99, 0x96, 0xAD, 0x97, 0x2E, 0x72,
+    0xAD, 0xA7, 0x2A, 0xAA, 0x72, 0x77, 0x0F, 0xF3, 0x9F, 0xF4, 0xE7, 0x1A, 0xD9, 0x71, 0xE7, 0x19,
+    0xD9, 0x71, 0xD9, 0x70, 0xAC, 0xA7, 0x9D, 0xA7, 0xAD, 0xA7, 0xAF, 0xEA, 0x3F, 0xF9, 0x3A, 0xAA,
+    0xAA, 0xAA, 0xA3, 0x1F, 0xFF, 0x1F, 0xFF, 0xC0, 0xAF, 0xFF, 0xA1, 0xC3, 0xDA, 0x72, 0xAD, 0x97,
+    0x2E, 0x73, 0xE7, 0x29, 0xDA, 0x72, 0xE9, 0x72, 0xE7, 0x29, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x71,
+    0x9E, 0x70, 0x59, 0xD5, 0xAE, 0x49, 0xEA, 0x4A, 0xD6, 0xD9, 0x59, 0xD6, 0xAD, 0x4A, 0xFD, 0x90,
+    0x9F, 0xE9, 0x2A, 0xD6, 0xDA, 0x6D, 0x69, 0xD6, 0xEA, 0xA4, 0xFC, 0x93, 0xFC, 0x92, 0x0F, 0xFF,
+    0x09, 0xFF, 0xF0, 0xAF, 0xFE, 0xA5, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x19, 0xDA, 0x71,
+    0xE9, 0x71, 0xE7, 0x19, 0xE7, 0x1A, 0xDA, 0x71, 0xE9, 0x70, 0x9F, 0x97, 0x0F, 0xA7, 0x1E, 0x97,
+    0x29, 0x97, 0x77, 0x77, 0x1C, 0xA7, 0x7D, 0x76, 0xAC, 0x93, 0xEA, 0x3F, 0xC3, 0x9E, 0x4E, 0xA4,
+    0xAE, 0x39, 0xE5, 0xEA, 0x3A, 0xE5, 0xE9, 0x3E, 0x94, 0x9E, 0x4E, 0x5A, 0xDA, 0x39, 0xE5, 0xE9,
+    0x3A, 0xD9, 0x5E, 0x4E, 0x6E, 0x3A, 0xE5, 0x9F, 0xFD, 0x95, 0x9F, 0xFD, 0x69, 0xFF, 0xC9, 0x7A,
+    0xFE, 0x97, 0x77, 0x00, 0x72, 0x99, 0x73, 0xD7, 0x29, 0xD1, 0x9D, 0x3F, 0x2A, 0xCA, 0x3E, 0x92,
+    0xAC, 0x92, 0xAD, 0x4D, 0x3E, 0x4D, 0x29, 0xDA, 0x39, 0xD2, 0xE9, 0x39, 0xFF, 0x49, 0xFF, 0x5A,
+    0xFD, 0xA4, 0x0D, 0xA4, 0xDA, 0x39, 0xDA, 0x70, 0x29, 0x2D, 0x1D, 0x90, 0xAC, 0xA1, 0x74, 0xAC,
+    0x95, 0x9E, 0x94, 0xDA, 0xDA, 0x2D, 0xA1, 0x9D, 0x00, 0x1A, 0x90, 0x9A, 0x1E, 0x9A, 0xC0, 0x9C,
+    0x9A, 0xDA, 0x1A, 0x1A, 0x91, 0x49, 0x99, 0x91, 0x9F, 0xE9, 0x0F, 0xDA, 0xA9, 0x79, 0x99, 0x19,
+    0xFF, 0xCA, 0x9E, 0xAA, 0xAA, 0xAA, 0xA9, 0x0A, 0xC9, 0x19, 0xCA, 0x0A, 0xFD, 0x90, 0x9F, 0xC9,
+    0x39, 0x99, 0x20, 0x1A, 0xA9, 0x09, 0xD9, 0x0E, 0x99, 0xE0, 0x71, 0x9D, 0x09, 0xD1, 0xE0, 0xE1,
+    0xE0, 0xE0, 0x9C, 0xA1, 0x9C, 0x1C, 0xA0, 0xAA, 0x50, 0x1D, 0x1C, 0xAC, 0xA0, 0xE9, 0x0A, 0xCA,
+    0x00, 0x2A, 0xCA, 0x39, 0xD2, 0xE3, 0x9D, 0x91, 0xE9, 0x2A, 0xDA, 0x77, 0x0D, 0x91, 0x9D, 0x2D,
+    0xAD, 0xA3, 0x9E, 0x95, 0xD9, 0x75, 0x9D, 0x4D, 0xA3, 0xAD, 0x92, 0x9D, 0xA3, 0xE9, 0x2A, 0xDA,
+    0x76, 0xAE, 0x92, 0xEA, 0x29, 0xE3, 0xE9, 0x29, 0xE3, 0xAA, 0xA9, 0x2A, 0xAA, 0xA1, 0x9E, 0x91,
+    0xAE, 0x2E, 0x2E, 0xA1, 0x9E, 0x20, 0x9A, 0xAA, 0x93, 0xEA, 0x39, 0xE4, 0xE9, 0x39, 0xE4, 0xEA,
+    0x00, 0x1D, 0x09, 0xAD, 0x0E, 0xA1, 0xAC, 0x39, 0x10, 0x0D, 0x3A, 0xDA, 0x19, 0xE2, 0xD3, 0x99,
+    0x10, 0x9A, 0xA9, 0x99, 0x1A, 0xFD, 0x99, 0x99, 0x9A, 0xD4, 0x9D, 0x4A, 0xCA, 0x00, 0x1A, 0xA2,
+    0xAC, 0x19, 0xD0, 0x9D, 0x91, 0xC2, 0x29, 0x1D, 0x0A, 0xC1, 0xD9, 0x1A, 0x40, 0x6C, 0x90, 0x9A,
+    0xCA, 0x09, 0xF1, 0xAD, 0x40, 0x9C, 0xA1, 0x9F, 0x1E, 0x1C, 0xA5, 0x19, 0x2C, 0x0A, 0xDA, 0x0A,
+    0x94, 0x1A, 0xAA, 0xF1, 0xFF, 0x19, 0x99, 0x99, 0x99, 0x10, 0x09, 0xAA, 0x1E, 0x09, 0xE0, 0xAD,
+    0xA0, 0x1D, 0xA0, 0xDA, 0x09, 0xD9, 0x9D, 0x90, 0xAD, 0x9A, 0xD7, 0x10, 0x1D, 0x1C, 0xAC, 0xA0,
+    0xE9, 0x0A, 0xCA, 0x00, 0x29, 0xAA, 0xA9, 0x2A, 0xE3, 0xE9, 0x29, 0xE3, 0xE9, 0x2F, 0x20, 0x29,
+    0x3A, 0xC3, 0xD9, 0x19, 0x9D, 0x1E, 0xA1, 0xAA, 0x91, 0x69, 0xD0, 0x9D, 0x90, 0xD1, 0x9E, 0xA0,
+    0xAD, 0xA4, 0x19, 0x91, 0x9D, 0x1A, 0xD1, 0xDA, 0x09, 0xD9, 0x0A, 0xD1, 0x0A, 0xFC, 0xA0, 0xFD,
+    0x90, 0xD9, 0x9D, 0x09, 0xD0, 0x9D, 0x00, 0x0A, 0xA9, 0x3A, 0xA1, 0x9D, 0xA0, 0xAD, 0x92, 0xAF,
+    0xC5, 0xEA, 0x69, 0xCA, 0x40, 0x29, 0xA9, 0x7E, 0x69, 0xF9, 0x39, 0xDA, 0x9D, 0xA2, 0xDA, 0x2A,
+    0xD0, 0x09, 0xD1, 0xC9, 0x0E, 0xA9, 0xC9, 0xAC, 0x9F, 0x0A, 0xC1, 0xD9, 0x00, 0x09, 0xAA, 0xF0,
+    0x9F, 0xE7, 0x10, 0x09, 0xAA, 0xAE, 0xA0, 0xFE, 0xA9, 0x99, 0x99, 0x99, 0x10, 0x1D, 0xA0, 0xAC,
+    0x1A, 0xE0, 0xD1, 0xD9, 0xE9, 0x1C, 0xA0, 0xAC, 0xA1, 0x0F, 0xF0, 0x9F, 0xF0, 0x99, 0x1A, 0xCA,
+    0x1A, 0xC1, 0xD9, 0x0C, 0xA4, 0x72, 0xD9, 0x0A, 0xD2, 0xDA, 0x09, 0xD9, 0x1A, 0xFD, 0xA1, 0x9F,
+    0xE2, 0x99, 0x99, 0x99, 0x90, 0x09, 0xFC, 0xA0, 0xAF, 0xC9, 0x0D, 0x1D, 0x1D, 0x1D, 0x09, 0xFC,
+    0xA0, 0xAF, 0xC9, 0x00, 0x29, 0x99, 0x92, 0xFC, 0x1A, 0xC9, 0xCA, 0xC1, 0xCA, 0xAC, 0x9C, 0x19,
+    0x50, 0x1A, 0x0A, 0x91, 0xAC, 0x92, 0xD2, 0xC9, 0xAA, 0x00, 0x1A, 0x90, 0x9A, 0x1E, 0x9A, 0xC0,
+    0x9C, 0x9A, 0xDA, 0x1A, 0x1A, 0x91, 0x4C, 0x90, 0x9D, 0x0A, 0xD0, 0xAA, 0x10, 0x6D, 0x6A, 0xC9,
+    0x59, 0xCA, 0x69, 0x97, 0x77, 0x77, 0x75, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA1, 0xAD, 0x9A, 0xD9,
+    0x10, 0x0F, 0xD9, 0x0F, 0xD0, 0xAD, 0x0A, 0xD0, 0xDA, 0x0A, 0xCA, 0x00, 0x29, 0xAA, 0xAE, 0xA1,
+    0x9F, 0xF1, 0x99, 0x99, 0x99, 0x97, 0x6A, 0xFD, 0xA1, 0x9F, 0xEA, 0x73, 0x1D, 0x90, 0xD9, 0x1D,
+    0x1D, 0x1A, 0xD0, 0x9D, 0x1D, 0x90, 0xDA, 0x1D, 0x1D, 0x90, 0x7A, 0xFA, 0x0F, 0xCA, 0x09, 0x9A,
+    0xD9, 0x2A, 0xD3, 0x99, 0x90, 0x71, 0x97, 0x2C, 0x7A, 0xE9, 0xAC, 0x49, 0xF0, 0xD4, 0xAC, 0xAF,
+    0xA4, 0xEA, 0xE6, 0xAC, 0x72, 0xC9, 0x71, 0xCA, 0x71, 0xAC, 0x72, 0xC9, 0x71, 0xCA, 0x71, 0x99,
+    0x77, 0x60, 0x77, 0x74, 0x9C, 0xA7, 0x6D, 0xA7, 0x59, 0xDA, 0x77, 0x77, 0x76, 0x95, 0x99, 0x5A,
+    0xFC, 0x2A, 0xE2, 0x9F, 0xF9, 0x9E, 0xA1, 0x9F, 0x1F, 0xF3, 0xE9, 0x2A, 0xEA, 0x93, 0x9C, 0xA7,
+    0x6D, 0xA7, 0x50, 0x29, 0xAA, 0x91, 0x99, 0x2A, 0xF9, 0x0D, 0x90, 0x9D, 0x99, 0xFC, 0x2A, 0xC1,
+    0xAE, 0x76, 0x9E, 0xA1, 0xCA, 0x2F, 0xC9, 0x9D, 0x1A, 0xD0, 0x9F, 0x92, 0x99, 0x19, 0xAA, 0x92,
+    0x09, 0x95, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2A, 0x59, 0xCA, 0x71,
+    0x0A, 0x2A, 0xA2, 0x90, 0x77, 0xC9, 0x70, 0x9C, 0x90, 0xAC, 0xA9, 0x49, 0xE2, 0xAF, 0xFC, 0x95,
+    0x99, 0x99, 0x99, 0x40, 0x39, 0x99, 0x99, 0x7F, 0xFC, 0xA3, 0xD9, 0x49, 0xAD, 0xA0, 0xAC, 0x71,
+    0xAC, 0x77, 0x77, 0x77, 0x0C, 0xA3, 0xAF, 0xFF, 0xE9, 0x1F, 0xFF, 0xF9, 0x75, 0xCA, 0x77, 0x60,
+    0x70, 0xAD, 0x71, 0x9E, 0x71, 0xF9, 0x7A, 0xF9, 0x69, 0xD0, 0xDA, 0x6D, 0xA0, 0xDA, 0x5A, 0xD1,
+    0xE4, 0x9D, 0xA1, 0xE4, 0xE2, 0xE3, 0xAF, 0xFC, 0x29, 0xFF, 0xD9, 0x1F, 0xFE, 0x90, 0xEA, 0x4E,
+    0xA9, 0xE5, 0xEA, 0x3F, 0xDA, 0x59, 0xFF, 0x4A, 0xD9, 0x19, 0xD9, 0x3E, 0x3D, 0x93, 0xDA, 0x29,
+    0xD3, 0x9D, 0xA9, 0x9A, 0xDA, 0x3A, 0xFE, 0xA4, 0xFF, 0xC9, 0x29, 0xDA, 0x3E, 0x2A, 0xD9, 0x3E,
+    0x2E, 0xAA, 0xAA, 0xEA, 0x2F, 0xFD, 0x91, 0x9F, 0xFC, 0xA2, 0xAF, 0xEA, 0x93, 0x3F, 0xF4, 0xFE,
+    0xA3, 0x9D, 0xAA, 0xAA, 0xA9, 0x3A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD7, 0x1A, 0xD7, 0x1D,
+    0xA7, 0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x09, 0xD9, 0x77, 0x50, 0x70, 0x99, 0x97,
+    0x19, 0xE7, 0x1F, 0x97, 0xFC, 0x96, 0xAD, 0xAD, 0xA5, 0x9D, 0xA0, 0xE5, 0xE1, 0xE4, 0xE2, 0xE9,
+    0x2A, 0xDA, 0x2E, 0x91, 0x9E, 0x3A, 0xDA, 0x1E, 0x4A, 0xE0, 0xAF, 0xFF, 0x0F, 0xFF, 0xA0, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x39, 0xAF, 0xE9, 0x3F, 0xFC, 0x4E, 0xAA, 0x99, 0x94, 0xAD,
+    0x72, 0xE7, 0x2E, 0x99, 0xAA, 0x59, 0xFE, 0x5A, 0xFD, 0xA5, 0xE7, 0x19, 0xDA, 0x71, 0xAE, 0xAA,
+    0xAA, 0xA4, 0xFF, 0xC9, 0x29, 0xFF, 0xC3, 0xAF, 0xFC, 0x30, 0x4F, 0xFE, 0xA4, 0xFF, 0xE9, 0x4A,
+    0xFF, 0xD7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0xA7, 0x1F, 0xCA, 0x70,
+    0x9F, 0xC9, 0x70, 0xAF, 0xDA, 0xAA, 0xA9, 0x4F, 0xFE, 0xA3, 0x9F, 0xFE, 0xA3, 0xAF, 0xFE, 0xA3,
+    0x3A, 0xD4, 0x9D, 0x93, 0xE4, 0xAD, 0x39, 0xDA, 0x4E, 0x3A, 0xD9, 0x39, 0xE3, 0xE4, 0xAD, 0xA3,
+    0xE4, 0xE9, 0x2A, 0xDA, 0x39, 0xE3, 0xFA, 0xAA, 0xAF, 0x3F, 0xFE, 0xA2, 0x9F, 0xFE, 0x92, 0xAF,
+    0xFE, 0x3E, 0xA3, 0xF2, 0x9E, 0x93, 0xEA, 0x2A, 0xE3, 0x9E, 0x92, 0x69, 0xAE, 0xA9, 0x70, 0xFF,
+    0xA6, 0xF9, 0x9A, 0xE9, 0x4E, 0x93, 0x9E, 0x3E, 0x95, 0xE3, 0xDA, 0x9A, 0xAA, 0xAC, 0x0E, 0x2A,
+    0xD9, 0xFD, 0x9D, 0xA2, 0xE0, 0x99, 0x99, 0x1A, 0xD9, 0x2E, 0x6E, 0x29, 0xEA, 0x29, 0xAE, 0xA2,
+    0x9F, 0xFF, 0x93, 0xFF, 0xEA, 0x4A, 0xFF, 0xCA, 0x69, 0xAF, 0xCA, 0x77, 0x60, 0x3E, 0x4E, 0x39,
+    0xD9, 0x3A, 0xD4, 0xE4, 0xDA, 0x39, 0xD9, 0x3A, 0xD4, 0xE4, 0xDA, 0x3A, 0xDA, 0x3E, 0x92, 0x9E,
+    0x39, 0xE3, 0x4A, 0xD1, 0xAE, 0x5E, 0x09, 0xE5, 0x9D, 0x90, 0xE6, 0xE0, 0xE9, 0x6D, 0xAE, 0x96,
+    0xAF, 0xC9, 0x7F, 0xCA, 0x79, 0xFA, 0x70, 0xAF, 0xA7, 0x0F, 0xD9, 0x69, 0xFE, 0x95, 0xE9, 0xAF,
+    0x5E, 0x1F, 0xC3, 0xAD, 0xA1, 0xAF, 0xC2, 0x0A, 0xF7, 0x1A, 0xFC, 0x70, 0xAF, 0xC9, 0x7A, 0xFD,
+    0x7F, 0xEA, 0x6F, 0xAE, 0x6E, 0xA0, 0xF5, 0xEA, 0x09, 0xE9, 0x4E, 0x91, 0xAE, 0x4E, 0x92, 0xEA,
+    0x3E, 0x4E, 0x3E, 0x49, 0xE2, 0xE5, 0xAD, 0x91, 0xDA, 0x6E, 0x00, 0x3A, 0xE5, 0xE9, 0x3F, 0x4F,
+    0x4F, 0x92, 0xAF, 0x3A, 0xFA, 0x2F, 0xA3, 0xFC, 0xA1, 0xFC, 0x93, 0xFD, 0x0A, 0xFC, 0x39, 0xDA,
+    0xE0, 0xFD, 0x3A, 0xD9, 0xFD, 0xAD, 0xA3, 0xE0, 0xFC, 0xAA, 0xDA, 0x29, 0xDA, 0x0F, 0xC0, 0xE9,
+    0x2A, 0xDA, 0x0F, 0x99, 0xE3, 0xE9, 0x0F, 0x0F, 0x29, 0xE1, 0xE9, 0x0E, 0xA2, 0xAE, 0x19, 0x99,
+    0x0A, 0xE9, 0x20, 0x49, 0x99, 0x4D, 0xA3, 0x9E, 0x39, 0xD9, 0x3A, 0xE9, 0x2A, 0xD4, 0xFA, 0x2E,
+    0x39, 0xFC, 0x19, 0xD9, 0x3A, 0xFC, 0x1A, 0xD4, 0xEA, 0xD1, 0xE3, 0x9E, 0x9D, 0x99, 0xD9, 0x3E,
+    0xA9, 0xDA, 0xAD, 0x4E, 0x90, 0xFD, 0x3A, 0xE1, 0xFC, 0x93, 0xF1, 0xFC, 0x4E, 0xA1, 0xAF, 0x3A,
+    0xE9, 0x19, 0xEA, 0x30, 0x77, 0x29, 0xFF, 0xC9, 0x3A, 0xFF, 0xC7, 0x77, 0x77, 0x77, 0x70, 0x9F,
+    0xD7, 0xAF, 0xD7, 0x77, 0x72, 0xAF, 0xFD, 0x92, 0xFF, 0xE3, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2,
+    0x69, 0xAE, 0xA9, 0x70, 0xFF, 0xA6, 0xF9, 0x9A, 0xE9, 0x4E, 0x93, 0x9E, 0x3E, 0x95, 0xE3, 0xDA,
+    0x6E, 0x2A, 0xD9, 0x6D, 0xA2, 0xE6, 0xAD, 0x92, 0xE6, 0xE2, 0x9E, 0xA2, 0x9A, 0xEA, 0x29, 0xFF,
+    0xF9, 0x3F, 0xFE, 0xA4, 0xAF, 0xFC, 0xA6, 0x9A, 0xFC, 0xA7, 0x76, 0x3F, 0xFA, 0x29, 0xFF, 0x92,
+    0xAD, 0x3D, 0x3D, 0xA2, 0xAD, 0x3D, 0x92, 0xDA, 0x29, 0xD3, 0xD9, 0x2A, 0xCA, 0x29, 0xD3, 0xD9,
+    0x2A, 0xD3, 0xD3, 0xD9, 0x29, 0xD3, 0xD3, 0xAC, 0xA2, 0x9D, 0x3D, 0x92, 0xAC, 0xA3, 0xAA, 0x3A,
+    0xA9, 0x20, 0x77, 0x19, 0xFD, 0x6A, 0xFE, 0x5D, 0xA2, 0xDA, 0x39, 0xD9, 0x2A, 0xCA, 0x3A, 0xD2,
+    0xAD, 0xA3, 0xFF, 0xC3, 0x9F, 0xF9, 0x3A, 0xFE, 0x94, 0xEA, 0xA9, 0x95, 0x9E, 0x71, 0xAD, 0xA7,
+    0x1E, 0x97, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0x77, 0x0F, 0xF3, 0x9F, 0xF4, 0xDA, 0x71, 0xAD, 0x97,
+    0x1E, 0x71, 0xAD, 0x97, 0x1D, 0x97, 0x0A, 0xCA, 0x79, 0xDA, 0x7A, 0xD9, 0x7A, 0xFE, 0x93, 0xFF,
+    0x4A, 0xAA, 0xAA, 0xAA, 0xA3, 0x0F, 0xFF, 0x09, 0xFF, 0xF0, 0xAF, 0xFE, 0xA5, 0xDA, 0x71, 0xAD,
+    0x97, 0x1E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xE9, 0x71, 0xE7, 0x19, 0xE7, 0x1A, 0xDA, 0x71, 0xE9,
+    0x70, 0x9E, 0x70, 0xE5, 0xE0, 0xAD, 0x93, 0xAD, 0x90, 0x9D, 0xA2, 0x9D, 0xA1, 0x9E, 0x2E, 0x3E,
+    0x1E, 0x4E, 0x9E, 0x94, 0xAF, 0xCA, 0x59, 0xFC, 0x69, 0xF7, 0x0E, 0x97, 0x9E, 0x70, 0xAE, 0x70,
+    0xEA, 0x79, 0xE9, 0x70, 0x77, 0x76, 0xAD, 0x77, 0x0D, 0xA7, 0x79, 0xDA, 0x74, 0xAF, 0xFA, 0x79,
+    0xFE, 0xAF, 0x5A, 0xE9, 0x9D, 0x90, 0x9E, 0xA3, 0xAE, 0x1A, 0xD2, 0xF2, 0x9E, 0x91, 0xDA, 0x2F,
+    0x2E, 0xA2, 0xD9, 0x2E, 0xA1, 0x9E, 0x91, 0x9D, 0x29, 0xE2, 0xAE, 0x91, 0xE1, 0x9E, 0xA2, 0xAF,
+    0xAA, 0xEA, 0xFC, 0x3A, 0xFF, 0xFD, 0x94, 0xFF, 0xFC, 0x96, 0x9A, 0xFE, 0xA9, 0x73, 0x9D, 0x97,
+    0x7A, 0xD7, 0x70, 0xAC, 0xA7, 0x20, 0x4D, 0xA4, 0x9D, 0x94, 0xE3, 0x9D, 0xA5, 0xAD, 0xA2, 0xDA,
+    0x7E, 0x1E, 0x70, 0xE9, 0xE7, 0x1A, 0xFC, 0x72, 0x9F, 0x97, 0x3E, 0xA7, 0x3F, 0xC7, 0x2F, 0xDA,
+    0x70, 0xEA, 0xF7, 0xEA, 0x0A, 0xE9, 0x49, 0xF2, 0xF3, 0x9F, 0x3F, 0x92, 0x19, 0x99, 0x29, 0xA9,
+    0x0A, 0x92, 0xAD, 0x2D, 0x99, 0xD2, 0xD9, 0x2D, 0x0A, 0xCA, 0x2D, 0x29, 0xCA, 0x0D, 0x91, 0x9D,
+    0x2A, 0xC9, 0xAD, 0x29, 0xD2, 0xDA, 0xD9, 0x29, 0xE9, 0x9F, 0xC4, 0xFF, 0xC5, 0x9F, 0xE9, 0x79,
+    0xAD, 0x97, 0x29, 0xCA, 0x73, 0xD9, 0x73, 0xD7, 0x39, 0xCA, 0x73, 0xAC, 0x97, 0x3A, 0xA7, 0x00,
+    0x7A, 0xEA, 0x71, 0xAF, 0xE7, 0xAD, 0xA9, 0x09, 0xE5, 0xAD, 0xA3, 0xAD, 0x5D, 0xA4, 0x9D, 0x93,
+    0xAD, 0x59, 0xD9, 0x3E, 0x59, 0xD4, 0xD9, 0x5E, 0x39, 0xD9, 0x49, 0xD9, 0x4D, 0x94, 0xE5, 0xDA,
+    0x29, 0xE4, 0xAF, 0xC0, 0x9F, 0xA3, 0xFC, 0xA0, 0xAF, 0xA3, 0xFC, 0x90, 0xFC, 0x97, 0x73, 0x77,
+    0x19, 0xEA, 0xCA, 0x5A, 0xFD, 0xA4, 0x9D, 0x19, 0xD9, 0x4D, 0x3D, 0x4A, 0xC9, 0x3D, 0x4D, 0x29,
+    0xE4, 0xFF, 0xC9, 0x09, 0x1A, 0xFF, 0xE2, 0xAE, 0x9F, 0xCA, 0x71, 0x99, 0x20, 0x77, 0x77, 0x77,
+    0x09, 0xCA, 0x97, 0x0F, 0xCA, 0x6A, 0xFD, 0x95, 0xEA, 0x9E, 0x4A, 0xD2, 0x9D, 0x4D, 0xA2, 0xDA,
+    0x4D, 0x9F, 0xA4, 0xAD, 0x0F, 0xA4, 0xE1, 0x99, 0xD9, 0x3D, 0xA2, 0x9D, 0xA2, 0x9F, 0xA9, 0xE3,
+    0xAF, 0xFC, 0x3F, 0xFC, 0x4D, 0x90, 0x9D, 0xA4, 0x9D, 0x72, 0xAD, 0x72, 0xDA, 0x71, 0xAD, 0x3D,
+    0x9A, 0xD3, 0xD9, 0x9D, 0x91, 0xAD, 0x1D, 0xA1, 0xE1, 0xE0, 0x9D, 0x91, 0xE0, 0xE2, 0xAF, 0xC9,
+    0x29, 0xFC, 0x3A, 0xF4, 0xAE, 0x94, 0xEA, 0x5E, 0x95, 0xE6, 0xE5, 0x9C, 0xAA, 0x50, 0x77, 0x09,
+    0xFD, 0xA4, 0xFF, 0x39, 0xD2, 0x9A, 0xA3, 0x9D, 0xA7, 0x1A, 0xDA, 0x71, 0xAE, 0x7A, 0xFA, 0x49,
+    0xFE, 0x39, 0xEA, 0x0A, 0xDA, 0x2A, 0xD9, 0x2E, 0x2E, 0x29, 0xDA, 0x2E, 0x19, 0xE3, 0xFF, 0xA3,
+    0x9F, 0xDA, 0x59, 0xAD, 0xA9, 0x40, 0x72, 0xF2, 0xCA, 0x1C, 0x91, 0xC9, 0x5A, 0xD3, 0xAC, 0xA9,
+    0x92, 0xCA, 0x09, 0xCA, 0x1F, 0xC9, 0x19, 0xE9, 0x10, 0x76, 0xFE, 0x29, 0xFD, 0xA4, 0xEA, 0x49,
+    0xE6, 0xE6, 0xE6, 0x9D, 0x7A, 0xD7, 0xAD, 0xA9, 0x95, 0xAF, 0xA5, 0x9E, 0xA6, 0x9D, 0x95, 0x9E,
+    0x5A, 0xE9, 0x49, 0xAD, 0x50, 0x75, 0x9D, 0x97, 0xAE, 0xAE, 0x93, 0x9F, 0xE3, 0xEA, 0x1D, 0x92,
+    0xDA, 0x2D, 0x91, 0x9D, 0x3D, 0x91, 0xE2, 0x9D, 0x2D, 0xA2, 0xAD, 0x19, 0xDA, 0x2D, 0xA1, 0xAD,
+    0x91, 0x9D, 0x91, 0xE2, 0xAD, 0x70, 0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x60, 0x49, 0xAD, 0xA5,
+    0xAD, 0xAD, 0xA3, 0xAD, 0x2D, 0x3D, 0x92, 0xD2, 0xAD, 0x3D, 0x2F, 0xFC, 0x19, 0xFF, 0xC1, 0xAD,
+    0x29, 0xDA, 0x1A, 0xD2, 0xAD, 0x2E, 0x90, 0xAE, 0x2F, 0xF9, 0x2A, 0xFE, 0x4F, 0xD5, 0x9A, 0xCA,
+    0x94, 0x39, 0xA9, 0x3D, 0x93, 0xD3, 0x9D, 0x3A, 0xCA, 0x3D, 0x93, 0xD3, 0xAD, 0x3E, 0x29, 0xE9,
+    0x1A, 0xF1, 0xFC, 0x00, 0x29, 0xCA, 0x0D, 0x92, 0xAC, 0x0D, 0xA3, 0xDA, 0xCA, 0x3A, 0xEA, 0x4E,
+    0xA4, 0x9E, 0x94, 0xFC, 0x93, 0xD9, 0xE2, 0xAC, 0xA0, 0xAE, 0x10, 0x9D, 0xA9, 0x71, 0xFC, 0x70,
+    0xFD, 0x72, 0xAD, 0x97, 0x2E, 0x72, 0xAD, 0xA7, 0x1F, 0x97, 0x0F, 0xC7, 0x9F, 0xC9, 0x6A, 0xD9,
+    0x9D, 0x6E, 0x1D, 0xA5, 0xE1, 0x9D, 0x5D, 0xA2, 0xAD, 0x39, 0xD4, 0xD9, 0x39, 0xD3, 0xDA, 0x3A,
+    0xCA, 0x3D, 0x93, 0xD9, 0x2A, 0xD4, 0xD3, 0xE3, 0xAD, 0x29, 0xDA, 0x3E, 0x2E, 0x92, 0x9F, 0xFC,
+    0x3A, 0xFF, 0xC3, 0xDA, 0xFD, 0xA2, 0xAC, 0x97, 0x2D, 0x77, 0x70, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9,
+    0x9D, 0x91, 0xAD, 0x1D, 0xA1, 0xE1, 0xE0, 0x9D, 0x91, 0xE0, 0xE2, 0xAF, 0xCA, 0x29, 0xFC, 0x3A,
+    0xF9, 0x3A, 0xEA, 0x59, 0x99, 0x40, 0x73, 0xFE, 0x2F, 0xDA, 0x3F, 0x93, 0xAF, 0x93, 0xFC, 0x4A,
+    0xF4, 0xDA, 0x94, 0xAD, 0x6F, 0xA4, 0x9F, 0xA6, 0xDA, 0x5A, 0xD9, 0x4F, 0x4A, 0xE7, 0x60, 0x4A,
+    0xE9, 0x49, 0xFD, 0xA2, 0x9D, 0xA1, 0xAD, 0x2D, 0x92, 0x9D, 0x19, 0xD3, 0xDA, 0x1A, 0xD9, 0x9A,
+    0xE9, 0x19, 0xFE, 0xA3, 0xFE, 0x5A, 0xDA, 0x93, 0x1F, 0xFD, 0x91, 0xFF, 0xD3, 0xDA, 0x0A, 0xD5,
+    0xD9, 0x0D, 0x94, 0x9D, 0x09, 0xD5, 0xDA, 0x0A, 0xCA, 0x5D, 0x90, 0xD9, 0x4A, 0xD0, 0xAE, 0xA3,
+    0xDA, 0x09, 0xE4, 0x99, 0x71, 0x71, 0x97, 0x29, 0xFA, 0x79, 0xEA, 0xD9, 0x59, 0xDA, 0x2C, 0xA5,
+    0xE3, 0xCA, 0x49, 0xDA, 0x29, 0xC9, 0x4E, 0x92, 0xD4, 0x9F, 0xAE, 0xA4, 0xFF, 0xC4, 0x9F, 0xF5,
+    0xAD, 0x90, 0xAA, 0x96, 0xE7, 0x2A, 0xD9, 0x72, 0xE7, 0x20, 0x73, 0x9A, 0xD9, 0x2A, 0xFC, 0x90,
+    0x9D, 0x90, 0x9D, 0x0D, 0x95, 0xD6, 0xD6, 0xE5, 0x9E, 0x5E, 0x5D, 0xA4, 0x9D, 0x95, 0x9A, 0x40,
+    0x4A, 0xFF, 0xC2, 0x9F, 0xFD, 0xA1, 0x9D, 0xA1, 0xAD, 0x5D, 0x92, 0x9D, 0x49, 0xD3, 0xDA, 0x4A,
+    0xD9, 0x9A, 0xE9, 0x49, 0xFE, 0xA6, 0xFE, 0x70, 0xAD, 0xA9, 0x60, 0x0F, 0xFC, 0x90, 0xFF, 0xC4,
+    0xDA, 0x69, 0xD7, 0xAC, 0xA7, 0xD9, 0x69, 0xD7, 0xF6, 0xAE, 0x77, 0x1A, 0xC9, 0x09, 0xCA, 0x2D,
+    0x91, 0xD2, 0xD2, 0xD1, 0x9D, 0x2D, 0x1A, 0xCA, 0x2D, 0x1A, 0xCA, 0x1A, 0xD1, 0xEA, 0xAD, 0xA1,
+    0xFE, 0x2F, 0xD9, 0x3F, 0x92, 0x77, 0x72, 0xD7, 0x59, 0xCA, 0x75, 0xAC, 0x97, 0x39, 0xAE, 0xA9,
+    0x70, 0xFF, 0xA5, 0x9F, 0xD9, 0xE9, 0x4E, 0x9A, 0xCA, 0x09, 0xDA, 0x3E, 0x90, 0xAC, 0x91, 0xE2,
+    0x9D, 0xA1, 0xD2, 0xE2, 0xAD, 0x91, 0xD2, 0xDA, 0x2E, 0x19, 0xCA, 0x19, 0xD9, 0x2E, 0x1A, 0xC9,
+    0x1E, 0x29, 0xE9, 0x0D, 0x99, 0xF2, 0x9F, 0xFF, 0x93, 0xFF, 0xEA, 0x4A, 0xFF, 0xCA, 0x69, 0xFD,
+    0xA7, 0x3D, 0x76, 0xD7, 0x59, 0xCA, 0x76, 0x97, 0x10, 0x77, 0x39, 0xD9, 0x4D, 0x93, 0xAE, 0xA2,
+    0xD9, 0x4A, 0xF9, 0x0D, 0xA7, 0x9F, 0xCA, 0x71, 0xFC, 0x72, 0xAE, 0x73, 0xE9, 0x72, 0xFA, 0x71,
+    0xFD, 0x70, 0xE9, 0xE9, 0x6E, 0x90, 0xAF, 0x93, 0xEA, 0x19, 0xF9, 0x2E, 0xA3, 0xAE, 0x20, 0x77,
+    0xCA, 0x70, 0xC9, 0x79, 0xC9, 0x5A, 0xE1, 0xD2, 0xF1, 0xAC, 0x2D, 0xAC, 0x1A, 0xC9, 0x09, 0xDA,
+    0xC1, 0xD1, 0x9C, 0xAD, 0x1D, 0x1A, 0xCA, 0xCA, 0x1D, 0x1D, 0xAC, 0xA0, 0xAD, 0x1F, 0xF9, 0x1A,
+    0xFD, 0xA3, 0xFC, 0xA5, 0xAC, 0x70, 0xAC, 0x70, 0xAC, 0x70, 0xD7, 0x0C, 0xA7, 0x70, 0x77, 0x09,
+    0xDA, 0x2D, 0x92, 0x9D, 0xA3, 0xAC, 0xA2, 0xE4, 0xAC, 0xA1, 0xAD, 0x1D, 0x1A, 0xCA, 0x1D, 0xA1,
+    0xCA, 0x1D, 0x91, 0xD9, 0x0A, 0xC9, 0x0A, 0xD2, 0xDA, 0xAF, 0xDA, 0x2F, 0xFD, 0x4E, 0x9A, 0xDA,
+    0x77, 0x10, 0x70, 0xAD, 0x71, 0x9E, 0x71, 0xF9, 0x7A, 0xF9, 0x69, 0xD0, 0xDA, 0x6D, 0xA0, 0xDA,
+    0x5A, 0xD1, 0xE4, 0x9D, 0xA1, 0xE4, 0xE2, 0xE3, 0xAF, 0xFC, 0x29, 0xFF, 0xD9, 0x1F, 0xFE, 0x90,
+    0xEA, 0x4E, 0xA9, 0xE5, 0xEA, 0x77, 0x09, 0xD7, 0x2E, 0x71, 0x9E, 0x71, 0xAA, 0xAA, 0x70, 0x77,
+    0x09, 0xEA, 0xCA, 0x3A, 0xFD, 0xA2, 0x9D, 0x19, 0xD9, 0x2D, 0x3D, 0x91, 0xAC, 0x93, 0xD2, 0xD2,
+    0x9E, 0x2F, 0xFC, 0x2A, 0xFE, 0xA3, 0xAE, 0x9D, 0x97, 0x77, 0x2A, 0xA7, 0x0A, 0xD9, 0x7E, 0x79,
+    0xE7, 0x72, 0xAC, 0x97, 0x49, 0xC7, 0x39, 0xC9, 0x73, 0xC9, 0x77, 0x77, 0x70, 0xAD, 0x72, 0x9E,
+    0x72, 0xF9, 0x70, 0xAF, 0x97, 0x9D, 0x0D, 0xA7, 0xDA, 0x0D, 0xA6, 0xAD, 0x1E, 0x59, 0xDA, 0x1E,
+    0x5E, 0x2E, 0x4A, 0xFF, 0xC3, 0x9F, 0xFD, 0x92, 0xFF, 0xE9, 0x1E, 0xA4, 0xEA, 0x09, 0xE5, 0xEA,
+    0x00, 0x77, 0x2D, 0x71, 0xC9, 0x7C, 0x97, 0x77, 0x75, 0x9E, 0xAC, 0xA2, 0xAF, 0xDA, 0x19, 0xD1,
+    0x9D, 0x91, 0xD3, 0xD9, 0x0A, 0xC9, 0x3D, 0x1D, 0x29, 0xE1, 0xFF, 0xC1, 0xAF, 0xEA, 0x2A, 0xE9,
+    0xD9, 0x00, 0x75, 0x97, 0x5D, 0x74, 0xAC, 0x97, 0x39, 0xD7, 0x77, 0x77, 0x1A, 0xCA, 0x74, 0xEA,
+    0x72, 0xFD, 0x70, 0xAC, 0xA1, 0x9D, 0x77, 0x72, 0xAD, 0x73, 0x9E, 0x73, 0xF9, 0x71, 0xAF, 0x97,
+    0x09, 0xD0, 0xDA, 0x70, 0xDA, 0x0D, 0xA7, 0xAD, 0x1E, 0x69, 0xDA, 0x1E, 0x6E, 0x2E, 0x5A, 0xFF,
+    0xC4, 0x9F, 0xFD, 0x93, 0xFF, 0xE9, 0x2E, 0xA4, 0xEA, 0x19, 0xE5, 0xEA, 0x10, 0x75, 0x99, 0x76,
+    0xCA, 0x75, 0xD6, 0xD4, 0xAC, 0xA5, 0x9E, 0x74, 0xFC, 0x97, 0x1D, 0xA1, 0xAC, 0xA7, 0x77, 0x77,
+    0x39, 0xEA, 0xCA, 0x70, 0xAF, 0xDA, 0x79, 0xD1, 0x9D, 0x97, 0xD3, 0xD9, 0x6A, 0xC9, 0x3D, 0x7D,
+    0x29, 0xE7, 0xFF, 0xC7, 0xAF, 0xEA, 0x70, 0xAE, 0x9D, 0x96, 0x71, 0xDA, 0x75, 0xDA, 0x74, 0x9E,
+    0x70, 0xAC, 0xA7, 0x4E, 0xA7, 0x2F, 0xD7, 0x0A, 0xCA, 0x19, 0xD7, 0x77, 0x2A, 0xD7, 0x39, 0xE7,
+    0x3F, 0x97, 0x1A, 0xF9, 0x70, 0x9D, 0x0D, 0xA7, 0x0D, 0xA0, 0xDA, 0x7A, 0xD1, 0xE6, 0x9D, 0xA1,
+    0xE6, 0xE2, 0xE5, 0xAF, 0xFC, 0x49, 0xFF, 0xD9, 0x3F, 0xFE, 0x92, 0xEA, 0x4E, 0xA1, 0x9E, 0x5E,
+    0xA1, 0x1E, 0x71, 0xE7, 0x09, 0xE7, 0x75, 0xD7, 0x09, 0xE9, 0x6D, 0xAD, 0xA4, 0xD9, 0x1A, 0xCA,
+    0x77, 0x09, 0xEA, 0xCA, 0x3A, 0xFD, 0xA2, 0x9D, 0x19, 0xD9, 0x2D, 0x3D, 0x91, 0xAC, 0x93, 0xD2,
+    0xD2, 0x9E, 0x2F, 0xFC, 0x2A, 0xFE, 0xA3, 0xAE, 0x9D, 0x91, 0x77, 0x74, 0xD7, 0x59, 0xC7, 0x49,
+    0xC9, 0x77, 0x77, 0x77, 0x70, 0xAC, 0xA7, 0x4E, 0xA7, 0x2F, 0xD7, 0x0A, 0xCA, 0x19, 0xD7, 0x77,
+    0x2A, 0xD7, 0x39, 0xE7, 0x3F, 0x97, 0x1A, 0xF9, 0x70, 0x9D, 0x0D, 0xA7, 0x0D, 0xA0, 0xDA, 0x7A,
+    0xD1, 0xE6, 0x9D, 0xA1, 0xE6, 0xE2, 0xE5, 0xAF, 0xFC, 0x49, 0xFF, 0xD9, 0x3F, 0xFE, 0x92, 0xEA,
+    0x4E, 0xA1, 0x9E, 0x5E, 0xA1, 0x73, 0x99, 0x75, 0xE7, 0x59, 0xC7, 0x4A, 0xCA, 0x69, 0xCA, 0x2C,
+    0x97, 0xE9, 0x72, 0xAF, 0xA7, 0x09, 0xD1, 0x9D, 0x77, 0x77, 0x79, 0xEA, 0xCA, 0x7A, 0xFD, 0xA6,
+    0x9D, 0x19, 0xD9, 0x6D, 0x3D, 0x95, 0xAC, 0x93, 0xD6, 0xD2, 0x9E, 0x6F, 0xFC, 0x6A, 0xFE, 0xA7,
+    0xAE, 0x9D, 0x95, 0x70, 0x9A, 0x1A, 0x97, 0x09, 0xE0, 0xC9, 0x70, 0xAC, 0x9E, 0x71, 0xAA, 0x09,
+    0xA9, 0x77, 0x72, 0x9C, 0xA7, 0x4E, 0xA7, 0x2A, 0xFA, 0x70, 0x9D, 0x19, 0xD7, 0x77, 0x1A, 0xD7,
+    0x39, 0xE7, 0x3F, 0x97, 0x1A, 0xF9, 0x70, 0x9D, 0x0D, 0xA7, 0x0D, 0xA0, 0xDA, 0x7A, 0xD1, 0xE6,
+    0x9D, 0xA1, 0xE6, 0xE2, 0xE5, 0xAF, 0xFC, 0x49, 0xFF, 0xD9, 0x3F, 0xFE, 0x92, 0xEA, 0x4E, 0xA1,
+    0x9E, 0x5E, 0xA1, 0x5D, 0x09, 0xC6, 0xEA, 0xAC, 0x6C, 0x9A, 0xDA, 0x6A, 0x90, 0xAA, 0x77, 0x5D,
+    0x97, 0x09, 0xE9, 0x7D, 0xAD, 0xA5, 0xD9, 0x19, 0xD7, 0x71, 0x9E, 0xAC, 0xA4, 0xAF, 0xDA, 0x39,
+    0xD1, 0x9D, 0x93, 0xD3, 0xD9, 0x2A, 0xC9, 0x3D, 0x3D, 0x29, 0xE3, 0xFF, 0xC3, 0xAF, 0xEA, 0x4A,
+    0xE9, 0xD9, 0x20, 0x77, 0x6A, 0xCA, 0x73, 0xEA, 0x71, 0xFD, 0x7A, 0xCA, 0x19, 0xD7, 0x77, 0x0A,
+    0xD7, 0x29, 0xE7, 0x2F, 0x97, 0x0A, 0xF9, 0x79, 0xD0, 0xDA, 0x7D, 0xA0, 0xDA, 0x6A, 0xD1, 0xE5,
+    0x9D, 0xA1, 0xE5, 0xE2, 0xE4, 0xAF, 0xFC, 0x39, 0xFF, 0xD9, 0x2F, 0xFE, 0x91, 0xEA, 0x4E, 0xA0,
+    0x9E, 0x5E, 0xA7, 0x72, 0x9D, 0x73, 0xE7, 0x29, 0xE7, 0x2A, 0xAA, 0xA7, 0x00, 0x5D, 0x71, 0x9E,
+    0x70, 0xFC, 0x95, 0xDA, 0x1A, 0xCA, 0x77, 0x77, 0x9E, 0xAC, 0xA4, 0xAF, 0xDA, 0x39, 0xD1, 0x9D,
+    0x93, 0xD3, 0xD9, 0x2A, 0xC9, 0x3D, 0x3D, 0x29, 0xE3, 0xFF, 0xC3, 0xAF, 0xEA, 0x4A, 0xE9, 0xD9,
+    0x77, 0x75, 0xAA, 0x71, 0xAD, 0x97, 0x0E, 0x70, 0x9E, 0x70, 0x74, 0x9C, 0x97, 0x49, 0xCA, 0x75,
+    0xD7, 0x59, 0x99, 0x77, 0x74, 0x94, 0x97, 0x1D, 0xAA, 0xAD, 0x97, 0x0F, 0xDA, 0x72, 0xF9, 0x77,
+    0x77, 0x74, 0xAD, 0x74, 0x9E, 0x74, 0xF9, 0x72, 0xAF, 0x97, 0x19, 0xD0, 0xDA, 0x71, 0xDA, 0x0D,
+    0xA7, 0x0A, 0xD1, 0xE7, 0x9D, 0xA1, 0xE7, 0xE2, 0xE6, 0xAF, 0xFC, 0x59, 0xFF, 0xD9, 0x4F, 0xFE,
+    0x93, 0xEA, 0x4E, 0xA2, 0x9E, 0x5E, 0xA2, 0x71, 0x99, 0x73, 0xCA, 0x72, 0xD7, 0x2A, 0xCA, 0x77,
+    0x77, 0x39, 0xCA, 0x2A, 0xA5, 0x9F, 0xDA, 0x6F, 0xCA, 0x70, 0x99, 0x97, 0x77, 0x73, 0x9E, 0xAC,
+    0xA5, 0xAF, 0xDA, 0x49, 0xD1, 0x9D, 0x94, 0xD3, 0xD9, 0x3A, 0xC9, 0x3D, 0x4D, 0x29, 0xE4, 0xFF,
+    0xC4, 0xAF, 0xEA, 0x5A, 0xE9, 0xD9, 0x30, 0x72, 0xDA, 0x75, 0x9D, 0xA7, 0x5A, 0xDA, 0x77, 0x77,
+    0x77, 0x74, 0xDA, 0xAA, 0xD9, 0x70, 0xFD, 0xA7, 0x2F, 0x97, 0x77, 0x77, 0x4A, 0xD7, 0x49, 0xE7,
+    0x4F, 0x97, 0x2A, 0xF9, 0x71, 0x9D, 0x0D, 0xA7, 0x1D, 0xA0, 0xDA, 0x70, 0xAD, 0x1E, 0x79, 0xDA,
+    0x1E, 0x7E, 0x2E, 0x6A, 0xFF, 0xC5, 0x9F, 0xFD, 0x94, 0xFF, 0xE9, 0x3E, 0xA4, 0xEA, 0x29, 0xE5,
+    0xEA, 0x20, 0x6A, 0xD7, 0x3E, 0x73, 0xE7, 0x77, 0x77, 0x70, 0x9C, 0xA1, 0x9D, 0x59, 0xFD, 0xA6,
+    0xFC, 0xA7, 0x09, 0x99, 0x77, 0x77, 0x39, 0xEA, 0xCA, 0x5A, 0xFD, 0xA4, 0x9D, 0x19, 0xD9, 0x4D,
+    0x3D, 0x93, 0xAC, 0x93, 0xD4, 0xD2, 0x9E, 0x4F, 0xFC, 0x4A, 0xFE, 0xA5, 0xAE, 0x9D, 0x93, 0x74,
+    0xCA, 0x77, 0xC9, 0x75, 0xAC, 0x75, 0x9C, 0x77, 0x77, 0x75, 0x94, 0x97, 0x1D, 0xAA, 0xAD, 0x97,
+    0x0F, 0xDA, 0x72, 0xF9, 0x77, 0x77, 0x74, 0xAD, 0x74, 0x9E, 0x74, 0xF9, 0x72, 0xAF, 0x97, 0x19,
+    0xD0, 0xDA, 0x71, 0xDA, 0x0D, 0xA7, 0x0A, 0xD1, 0xE7, 0x9D, 0xA1, 0xE7, 0xE2, 0xE6, 0xAF, 0xFC,
+    0x59, 0xFF, 0xD9, 0x4F, 0xFE, 0x93, 0xEA, 0x4E, 0xA2, 0x9E, 0x5E, 0xA2, 0x71, 0x97, 0x2A, 0xD9,
+    0x72, 0xC9, 0x70, 0xAD, 0x71, 0xC9, 0x77, 0x77, 0x75, 0xAD, 0xAA, 0xDA, 0x4A, 0xFD, 0x6A, 0xEA,
+    0x77, 0x77, 0x9E, 0xAC, 0xA4, 0xAF, 0xDA, 0x39, 0xD1, 0x9D, 0x93, 0xD3, 0xD9, 0x2A, 0xC9, 0x3D,
+    0x3D, 0x29, 0xE3, 0xFF, 0xC3, 0xAF, 0xEA, 0x4A, 0xE9, 0xD9, 0x20, 0x73, 0xA9, 0x09, 0x97, 0x2E,
+    0x0C, 0xA7, 0x1A, 0xC0, 0xE9, 0x71, 0x9A, 0x09, 0xA9, 0x77, 0x77, 0x73, 0x99, 0x39, 0x71, 0xDA,
+    0xAA, 0xD9, 0x70, 0xFD, 0xA7, 0x2F, 0x97, 0x77, 0x77, 0x4A, 0xD7, 0x49, 0xE7, 0x4F, 0x97, 0x2A,
+    0xF9, 0x71, 0x9D, 0x0D, 0xA7, 0x1D, 0xA0, 0xDA, 0x70, 0xAD, 0x1E, 0x79, 0xDA, 0x1E, 0x7E, 0x2E,
+    0x6A, 0xFF, 0xC5, 0x9F, 0xFD, 0x94, 0xFF, 0xE9, 0x3E, 0xA4, 0xEA, 0x29, 0xE5, 0xEA, 0x20, 0x7D,
+    0x90, 0xC9, 0x6A, 0xFC, 0x7C, 0xA0, 0xD9, 0x77, 0x77, 0x77, 0x9C, 0xA1, 0x9A, 0xA5, 0x9F, 0xDA,
+    0x6F, 0xCA, 0x70, 0x99, 0x97, 0x77, 0x73, 0x9E, 0xAC, 0xA5, 0xAF, 0xDA, 0x49, 0xD1, 0x9D, 0x94,
+    0xD3, 0xD9, 0x3A, 0xC9, 0x3D, 0x4D, 0x29, 0xE4, 0xFF, 0xC4, 0xAF, 0xEA, 0x5A, 0xE9, 0xD9, 0x30,
+    0x70, 0x94, 0x97, 0x1D, 0xAA, 0xAD, 0x97, 0x0F, 0xDA, 0x72, 0xF9, 0x77, 0x77, 0x74, 0xAD, 0x74,
+    0x9E, 0x74, 0xF9, 0x72, 0xAF, 0x97, 0x19, 0xD0, 0xDA, 0x71, 0xDA, 0x0D, 0xA7, 0x0A, 0xD1, 0xE7,
+    0x9D, 0xA1, 0xE7, 0xE2, 0xE6, 0xAF, 0xFC, 0x59, 0xFF, 0xD9, 0x4F, 0xFE, 0x93, 0xEA, 0x4E, 0xA2,
+    0x9E, 0x5E, 0xA7, 0x76, 0x9D, 0x75, 0xE7, 0x49, 0xE7, 0x4A, 0xAA, 0xA7, 0x20, 0x59, 0xCA, 0x19,
+    0xAA, 0x69, 0xFD, 0xA7, 0xFC, 0xA7, 0x19, 0x99, 0x77, 0x77, 0x69, 0xEA, 0xCA, 0x6A, 0xFD, 0xA5,
+    0x9D, 0x19, 0xD9, 0x5D, 0x3D, 0x94, 0xAC, 0x93, 0xD5, 0xD2, 0x9E, 0x5F, 0xFC, 0x5A, 0xFE, 0xA6,
+    0xAE, 0x9D, 0x97, 0x77, 0x73, 0xAA, 0x73, 0xAD, 0x97, 0x2E, 0x72, 0x9E, 0x72, 0x49, 0xAF, 0xE9,
+    0x4F, 0xFC, 0x5E, 0xAA, 0x99, 0x95, 0xAD, 0x73, 0xE7, 0x3E, 0x99, 0xAA, 0x69, 0xFE, 0x6A, 0xFD,
+    0xA6, 0xE7, 0x29, 0xDA, 0x72, 0xAE, 0xAA, 0xAA, 0xA5, 0xFF, 0xC9, 0x39, 0xFF, 0xC4, 0xAF, 0xFC,
+    0x77, 0x77, 0x77, 0x2A, 0xD7, 0x3E, 0x72, 0xAD, 0xA7, 0x2A, 0xAA, 0x97, 0x10, 0x5A, 0xE9, 0x59,
+    0xEA, 0xD9, 0x39, 0xDA, 0x09, 0x9C, 0xA3, 0xFF, 0xA2, 0x9D, 0xAA, 0xAA, 0xA9, 0x92, 0xAD, 0x49,
+    0x3A, 0xFF, 0x4F, 0xEA, 0x5A, 0xF9, 0x77, 0x77, 0x73, 0xAD, 0x71, 0xE7, 0x0A, 0xDA, 0x70, 0xAA,
+    0xA9, 0x70, 0x77, 0x69, 0xD7, 0x39, 0xC7, 0x2A, 0xA7, 0x77, 0x77, 0x70, 0x9A, 0xFE, 0x93, 0xFF,
+    0xC4, 0xEA, 0xA9, 0x99, 0x4A, 0xD7, 0x2E, 0x72, 0xE9, 0x9A, 0xA5, 0x9F, 0xE5, 0xAF, 0xDA, 0x5E,
+    0x71, 0x9D, 0xA7, 0x1A, 0xEA, 0xAA, 0xAA, 0x4F, 0xFC, 0x92, 0x9F, 0xFC, 0x3A, 0xFF, 0xC3, 0x79,
+    0xCA, 0x71, 0x9C, 0x70, 0x9C, 0x97, 0x77, 0x77, 0x77, 0x71, 0xAE, 0x94, 0x9E, 0xAD, 0x92, 0x9D,
+    0xA0, 0x99, 0xCA, 0x2F, 0xFA, 0x19, 0xDA, 0xAA, 0xAA, 0x99, 0x1A, 0xD4, 0x92, 0xAF, 0xF3, 0xFE,
+    0xA4, 0xAF, 0x92, 0x79, 0xA1, 0xA7, 0x9E, 0x0C, 0x96, 0xD9, 0xE7, 0xCA, 0x0D, 0x97, 0x77, 0x77,
+    0x69, 0xAF, 0xE9, 0x3F, 0xFC, 0x4E, 0xAA, 0x99, 0x94, 0xAD, 0x72, 0xE7, 0x2E, 0x99, 0xAA, 0x59,
+    0xFE, 0x5A, 0xFD, 0xA5, 0xE7, 0x19, 0xDA, 0x71, 0xAE, 0xAA, 0xAA, 0xA4, 0xFF, 0xC9, 0x29, 0xFF,
+    0xC3, 0xAF, 0xFC, 0x30, 0x6D, 0x90, 0xC9, 0x5A, 0xE9, 0xC9, 0x5C, 0xA9, 0xE6, 0xAA, 0x0A, 0xA7,
+    0x77, 0x77, 0x77, 0x2A, 0xE9, 0x59, 0xEA, 0xD9, 0x39, 0xDA, 0x09, 0x9C, 0xA3, 0xFF, 0xA2, 0x9D,
+    0xAA, 0xAA, 0xA9, 0x92, 0xAD, 0x49, 0x3A, 0xFF, 0x4F, 0xEA, 0x5A, 0xF9, 0x30, 0x76, 0x97, 0x6D,
+    0x75, 0xAC, 0x97, 0xCA, 0x29, 0xD7, 0xAD, 0xA7, 0x39, 0xFC, 0x72, 0xD9, 0x09, 0xD9, 0x77, 0x77,
+    0x71, 0x9A, 0xFE, 0x96, 0xFF, 0xC7, 0xEA, 0xA9, 0x99, 0x7A, 0xD7, 0x5E, 0x75, 0xE9, 0x9A, 0xA7,
+    0x09, 0xFE, 0x70, 0xAF, 0xDA, 0x70, 0xE7, 0x49, 0xDA, 0x74, 0xAE, 0xAA, 0xAA, 0xA7, 0xFF, 0xC9,
+    0x59, 0xFF, 0xC6, 0xAF, 0xFC, 0x60, 0x77, 0x09, 0x59, 0xD7, 0xD5, 0xF5, 0xAC, 0x94, 0xAD, 0xAD,
+    0x39, 0xD4, 0x9D, 0x2A, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xE9, 0x73, 0x9E, 0xAD, 0x97, 0x19,
+    0xDA, 0x09, 0x9C, 0xA7, 0x1F, 0xFA, 0x70, 0x9D, 0xAA, 0xAA, 0xA9, 0x97, 0x0A, 0xD4, 0x97, 0x1A,
+    0xFF, 0x72, 0xFE, 0xA7, 0x3A, 0xF9, 0x71, 0x73, 0xD9, 0x76, 0x9D, 0xA7, 0x0C, 0xA3, 0xAD, 0xA6,
+    0xAD, 0xA7, 0x49, 0xFC, 0x73, 0xD9, 0x09, 0xD9, 0x77, 0x77, 0x74, 0x9A, 0xFE, 0x97, 0xFF, 0xC7,
+    0x0E, 0xAA, 0x99, 0x97, 0x0A, 0xD7, 0x6E, 0x76, 0xE9, 0x9A, 0xA7, 0x19, 0xFE, 0x71, 0xAF, 0xDA,
+    0x71, 0xE7, 0x59, 0xDA, 0x75, 0xAE, 0xAA, 0xAA, 0xA7, 0x0F, 0xFC, 0x96, 0x9F, 0xFC, 0x7A, 0xFF,
+    0xC7, 0x3A, 0xA9, 0x71, 0x9D, 0xA7, 0x1A, 0xDA, 0x70, 0x9D, 0x71, 0xF9, 0x6A, 0xDA, 0xD9, 0x49,
+    0xCA, 0x2A, 0xC9, 0x77, 0x77, 0x74, 0xAE, 0x95, 0x9E, 0xAD, 0x93, 0x9D, 0xA0, 0x99, 0xCA, 0x3F,
+    0xFA, 0x29, 0xDA, 0xAA, 0xAA, 0x99, 0x2A, 0xD4, 0x93, 0xAF, 0xF4, 0xFE, 0xA5, 0xAF, 0x93, 0x75,
+    0xCA, 0x77, 0xC9, 0x75, 0xD7, 0xCA, 0x39, 0xC7, 0xAD, 0xA7, 0x39, 0xFC, 0x72, 0xD9, 0x09, 0xD9,
+    0x77, 0x77, 0x71, 0x9A, 0xFE, 0x96, 0xFF, 0xC7, 0xEA, 0xA9, 0x99, 0x7A, 0xD7, 0x5E, 0x75, 0xE9,
+    0x9A, 0xA7, 0x09, 0xFE, 0x70, 0xAF, 0xDA, 0x70, 0xE7, 0x49, 0xDA, 0x74, 0xAE, 0xAA, 0xAA, 0xA7,
+    0xFF, 0xC9, 0x59, 0xFF, 0xC6, 0xAF, 0xFC, 0x60, 0x74, 0xD9, 0x75, 0xAA, 0xC7, 0x5A, 0xC9, 0x7D,
+    0x29, 0xA7, 0x09, 0xE7, 0x4F, 0xC9, 0x71, 0xDA, 0x1A, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x74, 0xAE,
+    0x97, 0x19, 0xEA, 0xD9, 0x79, 0xDA, 0x09, 0x9C, 0xA7, 0xFF, 0xA6, 0x9D, 0xAA, 0xAA, 0xA9, 0x96,
+    0xAD, 0x49, 0x7A, 0xFF, 0x70, 0xFE, 0xA7, 0x1A, 0xF9, 0x70, 0x69, 0xCA, 0x0A, 0xC7, 0x0E, 0x9C,
+    0xA7, 0xAC, 0x0E, 0x97, 0x9A, 0x09, 0xA9, 0x77, 0x71, 0xD7, 0x3A, 0xE7, 0x1A, 0xDA, 0xD9, 0x69,
+    0xD2, 0xAC, 0xA7, 0x73, 0x9A, 0xFE, 0x94, 0xFF, 0xC5, 0xEA, 0xA9, 0x99, 0x5A, 0xD7, 0x3E, 0x73,
+    0xE9, 0x9A, 0xA6, 0x9F, 0xE6, 0xAF, 0xDA, 0x6E, 0x72, 0x9D, 0xA7, 0x2A, 0xEA, 0xAA, 0xAA, 0x5F,
+    0xFC, 0x93, 0x9F, 0xFC, 0x4A, 0xFF, 0xC4, 0x70, 0x9A, 0x90, 0xCA, 0x70, 0xE0, 0xCA, 0x7A, 0xC0,
+    0xE7, 0x0A, 0xA0, 0x9A, 0x97, 0x74, 0x9D, 0x73, 0xF7, 0x1A, 0xDA, 0xD7, 0x9D, 0x2A, 0xC9, 0x77,
+    0x77, 0x77, 0x4A, 0xE9, 0x79, 0xEA, 0xD9, 0x59, 0xDA, 0x09, 0x9C, 0xA5, 0xFF, 0xA4, 0x9D, 0xAA,
+    0xAA, 0xA9, 0x94, 0xAD, 0x49, 0x5A, 0xFF, 0x6F, 0xEA, 0x7A, 0xF9, 0x50, 0x7C, 0xA7, 0x3A, 0xDA,
+    0x71, 0x9F, 0xC7, 0x0D, 0x90, 0x9D, 0x97, 0x77, 0x73, 0x9A, 0xFE, 0x94, 0xFF, 0xC5, 0xEA, 0xA9,
+    0x99, 0x5A, 0xD7, 0x3E, 0x73, 0xE9, 0x9A, 0xA6, 0x9F, 0xE6, 0xAF, 0xDA, 0x6E, 0x72, 0x9D, 0xA7,
+    0x2A, 0xEA, 0xAA, 0xAA, 0x5F, 0xFC, 0x93, 0x9F, 0xFC, 0x4A, 0xFF, 0xC7, 0x77, 0x77, 0x72, 0xAD,
+    0x73, 0xE7, 0x2A, 0xDA, 0x72, 0xAA, 0xA9, 0x71, 0x77, 0x39, 0xD7, 0x2F, 0x70, 0xAD, 0xAD, 0x69,
+    0xD2, 0xAC, 0x97, 0x77, 0x77, 0x70, 0xAE, 0x96, 0x9E, 0xAD, 0x94, 0x9D, 0xA0, 0x99, 0xCA, 0x4F,
+    0xFA, 0x39, 0xDA, 0xAA, 0xAA, 0x99, 0x3A, 0xD4, 0x94, 0xAF, 0xF5, 0xFE, 0xA6, 0xAF, 0x97, 0x77,
+    0x77, 0x7A, 0xD7, 0x2E, 0x71, 0xAD, 0xA7, 0x1A, 0xAA, 0x97, 0x00, 0x59, 0xCA, 0x79, 0xC6, 0xAC,
+    0x77, 0x77, 0x75, 0xE6, 0xE5, 0x9D, 0x95, 0xAD, 0x6E, 0x6D, 0xA5, 0x9D, 0x95, 0xAD, 0x6E, 0x6D,
+    0xA5, 0xAD, 0xA5, 0xE9, 0x49, 0xE5, 0x9E, 0x50, 0x4A, 0xC9, 0x5A, 0xA4, 0x9C, 0x94, 0xC9, 0x77,
+    0x39, 0xCA, 0x4D, 0x94, 0xD4, 0x9D, 0x4A, 0xCA, 0x4D, 0x93, 0x9D, 0x4E, 0x4E, 0x30, 0x7E, 0x70,
+    0xE7, 0x9D, 0x97, 0xAD, 0x70, 0xE7, 0x0D, 0xA7, 0x9D, 0x97, 0xAD, 0x70, 0xE7, 0x0D, 0xA7, 0xAD,
+    0xA7, 0xE9, 0x69, 0xE7, 0x9E, 0x77, 0x77, 0x71, 0xAA, 0x97, 0x9D, 0xA7, 0xE9, 0x7E, 0x96, 0x7A,
+    0xA7, 0xAD, 0x7E, 0x6A, 0xE7, 0x77, 0x39, 0xCA, 0x7D, 0x97, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x96,
+    0x9D, 0x7E, 0x7E, 0x77, 0x77, 0x7D, 0xA6, 0xAD, 0x96, 0xE9, 0x6A, 0xAA, 0x60, 0x69, 0xAE, 0xA9,
+    0x70, 0xFF, 0xA6, 0xF9, 0x9A, 0xE9, 0x4E, 0x93, 0x9E, 0x3E, 0x95, 0xE3, 0xDA, 0x6E, 0x2A, 0xD9,
+    0x6D, 0xA2, 0xE6, 0xAD, 0x92, 0xE6, 0xE2, 0x9E, 0xA2, 0x9A, 0xEA, 0x29, 0xFF, 0xF9, 0x3F, 0xFE,
+    0xA4, 0xAF, 0xFC, 0xA6, 0x9A, 0xFC, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x39, 0xD9, 0x74, 0xE7, 0x5E,
+    0x74, 0x9A, 0xAA, 0x73, 0x5A, 0xE9, 0x59, 0xFD, 0xA3, 0x9D, 0xA1, 0xAD, 0x3D, 0x92, 0x9D, 0x29,
+    0xD3, 0xDA, 0x2A, 0xD9, 0x9A, 0xE9, 0x29, 0xFE, 0xA4, 0xFE, 0x6A, 0xDA, 0x97, 0x77, 0x77, 0x4D,
+    0xA7, 0x09, 0xDA, 0x70, 0xE9, 0x70, 0xAA, 0xA7, 0x00, 0x72, 0xAC, 0x97, 0x69, 0xA7, 0x59, 0xC9,
+    0x75, 0xC9, 0x77, 0x77, 0x74, 0x9A, 0xEA, 0x97, 0x0F, 0xFA, 0x6F, 0x99, 0xAE, 0x94, 0xE9, 0x39,
+    0xE3, 0xE9, 0x5E, 0x3D, 0xA6, 0xE2, 0xAD, 0x96, 0xDA, 0x2E, 0x6A, 0xD9, 0x2E, 0x6E, 0x29, 0xEA,
+    0x29, 0xAE, 0xA2, 0x9F, 0xFF, 0x93, 0xFF, 0xEA, 0x4A, 0xFF, 0xCA, 0x69, 0xAF, 0xCA, 0x77, 0x60,
+    0x7D, 0x72, 0xA9, 0x70, 0xAC, 0x71, 0xC7, 0x77, 0x7A, 0xE9, 0x49, 0xFD, 0xA2, 0x9D, 0xA1, 0xAD,
+    0x2D, 0x92, 0x9D, 0x19, 0xD3, 0xDA, 0x1A, 0xD9, 0x9A, 0xE9, 0x19, 0xFE, 0xA3, 0xFE, 0x5A, 0xDA,
+    0x93, 0x77, 0x73, 0xAC, 0xA7, 0x70, 0xEA, 0x4A, 0xC7, 0xFD, 0x2A, 0xC9, 0x6A, 0xCA, 0x19, 0xD0,
+    0x9D, 0x77, 0x09, 0x97, 0x19, 0xAE, 0xA9, 0x73, 0xFF, 0xA7, 0x1F, 0x99, 0xAE, 0x97, 0xE9, 0x39,
+    0xE6, 0xE9, 0x5E, 0x6D, 0xA6, 0xE5, 0xAD, 0x96, 0xDA, 0x5E, 0x6A, 0xD9, 0x5E, 0x6E, 0x59, 0xEA,
+    0x29, 0xAE, 0xA5, 0x9F, 0xFF, 0x96, 0xFF, 0xEA, 0x7A, 0xFF, 0xCA, 0x71, 0x9A, 0xFC, 0xA7, 0x77,
+    0x40, 0x77, 0x97, 0x7D, 0x5D, 0x95, 0xD9, 0x49, 0xE9, 0x3A, 0xCA, 0x5D, 0xAD, 0xA7, 0x2D, 0x91,
+    0xAD, 0x77, 0x75, 0xAE, 0x97, 0x29, 0xFD, 0xA7, 0x09, 0xDA, 0x1A, 0xD7, 0x0D, 0x92, 0x9D, 0x79,
+    0xD3, 0xDA, 0x7A, 0xD9, 0x9A, 0xE9, 0x79, 0xFE, 0xA7, 0x1F, 0xE7, 0x3A, 0xDA, 0x97, 0x10, 0x5D,
+    0xA7, 0x59, 0xDA, 0x75, 0xAD, 0xA7, 0x5E, 0x97, 0x3F, 0xCA, 0x71, 0xAC, 0xA1, 0x9D, 0x77, 0x72,
+    0x9A, 0xEA, 0x97, 0x0F, 0xFA, 0x6F, 0x99, 0xAE, 0x94, 0xE9, 0x39, 0xE3, 0xE9, 0x5E, 0x3D, 0xA6,
+    0xE2, 0xAD, 0x96, 0xDA, 0x2E, 0x6A, 0xD9, 0x2E, 0x6E, 0x29, 0xEA, 0x29, 0xAE, 0xA2, 0x9F, 0xFF,
+    0x93, 0xFF, 0xEA, 0x4A, 0xFF, 0xCA, 0x69, 0xAF, 0xCA, 0x77, 0x60, 0x2A, 0xD7, 0x1E, 0x97, 0x0E,
+    0x97, 0xAA, 0x71, 0xE7, 0xFC, 0x94, 0xDA, 0x1A, 0xCA, 0x77, 0x1A, 0xE9, 0x49, 0xFD, 0xA2, 0x9D,
+    0xA1, 0xAD, 0x2D, 0x92, 0x9D, 0x19, 0xD3, 0xDA, 0x1A, 0xD9, 0x9A, 0xE9, 0x19, 0xFE, 0xA3, 0xFE,
+    0x5A, 0xDA, 0x93, 0x74, 0xAC, 0x97, 0x69, 0xA7, 0x59, 0xC9, 0x70, 0xAC, 0xA1, 0xC9, 0x71, 0xEA,
+    0x73, 0xFD, 0x71, 0xAC, 0xA1, 0x9D, 0x77, 0x72, 0x9A, 0xEA, 0x97, 0x0F, 0xFA, 0x6F, 0x99, 0xAE,
+    0x94, 0xE9, 0x39, 0xE3, 0xE9, 0x5E, 0x3D, 0xA6, 0xE2, 0xAD, 0x96, 0xDA, 0x2E, 0x6A, 0xD9, 0x2E,
+    0x6E, 0x29, 0xEA, 0x29, 0xAE, 0xA2, 0x9F, 0xFF, 0x93, 0xFF, 0xEA, 0x4A, 0xFF, 0xCA, 0x69, 0xAF,
+    0xCA, 0x77, 0x60, 0x73, 0xAC, 0xA7, 0x4A, 0xAC, 0x97, 0x4A, 0xC7, 0x4D, 0x96, 0x9C, 0xA2, 0xA7,
+    0x0E, 0xA7, 0x2A, 0xDA, 0xD7, 0x0A, 0xD1, 0x9D, 0x97, 0x77, 0xAE, 0x97, 0x09, 0xFD, 0xA6, 0x9D,
+    0xA1, 0xAD, 0x6D, 0x92, 0x9D, 0x59, 0xD3, 0xDA, 0x5A, 0xD9, 0x9A, 0xE9, 0x59, 0xFE, 0xA7, 0xFE,
+    0x71, 0xAD, 0xA9, 0x70, 0x70, 0x9A, 0x1A, 0x72, 0x9E, 0x9C, 0x97, 0x1D, 0x9E, 0x72, 0xAA, 0x09,
+    0xA9, 0x77, 0x74, 0x9C, 0x97, 0x5E, 0x97, 0x3A, 0xFA, 0x71, 0x9D, 0x19, 0xD7, 0x77, 0x19, 0xAE,
+    0xA9, 0x70, 0xFF, 0xA6, 0xF9, 0x9A, 0xE9, 0x4E, 0x93, 0x9E, 0x3E, 0x95, 0xE3, 0xDA, 0x6E, 0x2A,
+    0xD9, 0x6D, 0xA2, 0xE6, 0xAD, 0x92, 0xE6, 0xE2, 0x9E, 0xA2, 0x9A, 0xEA, 0x29, 0xFF, 0xF9, 0x3F,
+    0xFE, 0xA4, 0xAF, 0xFC, 0xA6, 0x9A, 0xFC, 0xA7, 0x76, 0x59, 0xA1, 0xA6, 0xAD, 0xA9, 0xC6, 0xCA,
+    0xAE, 0x6C, 0x90, 0xD9, 0x77, 0x4A, 0xC7, 0x2E, 0x97, 0xFC, 0x95, 0xAC, 0xA1, 0xAC, 0xA7, 0x72,
+    0xAE, 0x95, 0x9F, 0xDA, 0x39, 0xDA, 0x1A, 0xD3, 0xD9, 0x29, 0xD2, 0x9D, 0x3D, 0xA2, 0xAD, 0x99,
+    0xAE, 0x92, 0x9F, 0xEA, 0x4F, 0xE6, 0xAD, 0xA9, 0x40, 0x77, 0x70, 0xAC, 0xA7, 0x5E, 0xA7, 0x3F,
+    0xD7, 0x1A, 0xCA, 0x19, 0xD7, 0x77, 0x29, 0xAE, 0xA9, 0x70, 0xFF, 0xA6, 0xF9, 0x9A, 0xE9, 0x4E,
+    0x93, 0x9E, 0x3E, 0x95, 0xE3, 0xDA, 0x6E, 0x2A, 0xD9, 0x6D, 0xA2, 0xE6, 0xAD, 0x92, 0xE6, 0xE2,
+    0x9E, 0xA2, 0x9A, 0xEA, 0x29, 0xFF, 0xF9, 0x3F, 0xFE, 0xA4, 0xAF, 0xFC, 0xA6, 0x9A, 0xFC, 0xA7,
+    0x77, 0x77, 0x77, 0x77, 0x39, 0xD9, 0x74, 0xE7, 0x5E, 0x74, 0x9A, 0xAA, 0x73, 0x77, 0x0D, 0x97,
+    0x9E, 0x96, 0xDA, 0xDA, 0x4D, 0x91, 0xAD, 0x77, 0x1A, 0xE9, 0x49, 0xFD, 0xA2, 0x9D, 0xA1, 0xAD,
+    0x2D, 0x92, 0x9D, 0x19, 0xD3, 0xDA, 0x1A, 0xD9, 0x9A, 0xE9, 0x19, 0xFE, 0xA3, 0xFE, 0x5A, 0xDA,
+    0x97, 0x77, 0x77, 0x09, 0xD9, 0x7E, 0x79, 0xE7, 0x9A, 0xAA, 0x70, 0x75, 0x99, 0x77, 0x0A, 0xC7,
+    0x70, 0x9C, 0xA7, 0x70, 0xD7, 0x77, 0x97, 0x72, 0xD6, 0x9A, 0xEA, 0x92, 0x9C, 0xA5, 0xFF, 0xA0,
+    0xAD, 0x94, 0xF9, 0x9A, 0xE9, 0xAC, 0x94, 0xE9, 0x39, 0xE6, 0xE9, 0x5E, 0x6D, 0xA6, 0xE5, 0xAD,
+    0x96, 0xDA, 0x5E, 0x6A, 0xD9, 0x5E, 0x6E, 0x59, 0xEA, 0x29, 0xAE, 0xA5, 0x9F, 0xFF, 0x96, 0xFF,
+    0xEA, 0x7A, 0xFF, 0xCA, 0x71, 0x9A, 0xFC, 0xA7, 0x77, 0x40, 0x70, 0x99, 0x72, 0xAC, 0x72, 0x9C,
+    0xA7, 0x19, 0xD7, 0x77, 0x59, 0xC9, 0x4A, 0xE9, 0x0A, 0xC9, 0x29, 0xFF, 0xC2, 0x9D, 0xA1, 0xAE,
+    0x3D, 0x92, 0x9D, 0x39, 0xD3, 0xDA, 0x3A, 0xD9, 0x9A, 0xE9, 0x39, 0xFE, 0xA5, 0xFE, 0x7A, 0xDA,
+    0x95, 0x72, 0xDA, 0x77, 0x09, 0xDA, 0x77, 0x0A, 0xDA, 0x77, 0x77, 0x71, 0xA9, 0x77, 0x1D, 0x69,
+    0xAE, 0xA9, 0x29, 0xCA, 0x5F, 0xFA, 0x0A, 0xD9, 0x4F, 0x99, 0xAE, 0x9A, 0xC9, 0x4E, 0x93, 0x9E,
+    0x6E, 0x95, 0xE6, 0xDA, 0x6E, 0x5A, 0xD9, 0x6D, 0xA5, 0xE6, 0xAD, 0x95, 0xE6, 0xE5, 0x9E, 0xA2,
+    0x9A, 0xEA, 0x59, 0xFF, 0xF9, 0x6F, 0xFE, 0xA7, 0xAF, 0xFC, 0xA7, 0x19, 0xAF, 0xCA, 0x77, 0x74,
+    0x5D, 0xA7, 0x29, 0xDA, 0x72, 0xAD, 0xA7, 0x77, 0x77, 0x19, 0xC9, 0x4A, 0xE9, 0x0A, 0xC9, 0x29,
+    0xFF, 0xC2, 0x9D, 0xA1, 0xAE, 0x3D, 0x92, 0x9D, 0x39, 0xD3, 0xDA, 0x3A, 0xD9, 0x9A, 0xE9, 0x39,
+    0xFE, 0xA5, 0xFE, 0x7A, 0xDA, 0x95, 0x74, 0xD7, 0x72, 0xAA, 0x77, 0x0A, 0xC7, 0x71, 0xC9, 0x77,
+    0x77, 0x72, 0xD6, 0x9A, 0xEA, 0x92, 0x9C, 0xA5, 0xFF, 0xA0, 0xAD, 0x94, 0xF9, 0x9A, 0xE9, 0xAC,
+    0x94, 0xE9, 0x39, 0xE6, 0xE9, 0x5E, 0x6D, 0xA6, 0xE5, 0xAD, 0x96, 0xDA, 0x5E, 0x6A, 0xD9, 0x5E,
+    0x6E, 0x59, 0xEA, 0x29, 0xAE, 0xA5, 0x9F, 0xFF, 0x96, 0xFF, 0xEA, 0x7A, 0xFF, 0xCA, 0x71, 0x9A,
+    0xFC, 0xA7, 0x77, 0x40, 0x7D, 0x74, 0xA9, 0x72, 0xAC, 0x73, 0xC7, 0x77, 0x59, 0xC9, 0x4A, 0xE9,
+    0x0A, 0xC9, 0x29, 0xFF, 0xC2, 0x9D, 0xA1, 0xAE, 0x3D, 0x92, 0x9D, 0x39, 0xD3, 0xDA, 0x3A, 0xD9,
+    0x9A, 0xE9, 0x39, 0xFE, 0xA5, 0xFE, 0x7A, 0xDA, 0x95, 0x72, 0x9D, 0x0A, 0xC7, 0x5E, 0x9C, 0xA7,
+    0x4A, 0xC0, 0xE9, 0x74, 0x9A, 0x1A, 0xA7, 0x75, 0x97, 0x72, 0xD6, 0x9A, 0xEA, 0x92, 0x9C, 0xA5,
+    0xFF, 0xA0, 0xAD, 0x94, 0xF9, 0x9A, 0xE9, 0xAC, 0x94, 0xE9, 0x39, 0xE6, 0xE9, 0x5E, 0x6D, 0xA6,
+    0xE5, 0xAD, 0x96, 0xDA, 0x5E, 0x6A, 0xD9, 0x5E, 0x6E, 0x59, 0xEA, 0x29, 0xAE, 0xA5, 0x9F, 0xFF,
+    0x96, 0xFF, 0xEA, 0x7A, 0xFF, 0xCA, 0x71, 0x9A, 0xFC, 0xA7, 0x77, 0x40, 0x6A, 0x90, 0x99, 0x7E,
+    0x9D, 0x69, 0xC9, 0xE9, 0x69, 0xA1, 0xAA, 0x77, 0x73, 0x99, 0x73, 0x9C, 0x94, 0xAE, 0x90, 0xAC,
+    0x92, 0x9F, 0xFC, 0x29, 0xDA, 0x1A, 0xE3, 0xD9, 0x29, 0xD3, 0x9D, 0x3D, 0xA3, 0xAD, 0x99, 0xAE,
+    0x93, 0x9F, 0xEA, 0x5F, 0xE7, 0xAD, 0xA9, 0x50, 0x77, 0x19, 0x77, 0x2D, 0x69, 0xAE, 0xA9, 0x29,
+    0xCA, 0x5F, 0xFA, 0x0A, 0xD9, 0x4F, 0x99, 0xAE, 0x9A, 0xC9, 0x4E, 0x93, 0x9E, 0x6E, 0x95, 0xE6,
+    0xDA, 0x6E, 0x5A, 0xD9, 0x6D, 0xA5, 0xE6, 0xAD, 0x95, 0xE6, 0xE5, 0x9E, 0xA2, 0x9A, 0xEA, 0x59,
+    0xFF, 0xF9, 0x6F, 0xFE, 0xA7, 0xAF, 0xFC, 0xA7, 0x19, 0xAF, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x72, 0x9D, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0x9A, 0xAA, 0x76, 0x77, 0x72, 0x9C, 0x95, 0xAE, 0x90,
+    0xAC, 0x93, 0x9F, 0xFC, 0x39, 0xDA, 0x1A, 0xE4, 0xD9, 0x29, 0xD4, 0x9D, 0x3D, 0xA4, 0xAD, 0x99,
+    0xAE, 0x94, 0x9F, 0xEA, 0x6F, 0xE7, 0x0A, 0xDA, 0x97, 0x77, 0x77, 0x74, 0xDA, 0x72, 0x9D, 0xA7,
+    0x2E, 0x97, 0x2A, 0xAA, 0x72, 0x3E, 0xA3, 0xEA, 0x29, 0xE4, 0xE9, 0x2A, 0xE3, 0x9E, 0x3E, 0xA3,
+    0xAE, 0x3E, 0x93, 0xE9, 0x29, 0xE4, 0xE3, 0xAD, 0xA3, 0x9E, 0x3E, 0x93, 0xAD, 0x93, 0xE4, 0xE4,
+    0xE3, 0xAE, 0x39, 0xFF, 0xD9, 0x39, 0xFF, 0xD4, 0x9F, 0xFC, 0x95, 0xAF, 0xE9, 0x77, 0x77, 0x77,
+    0x77, 0x79, 0xD9, 0x73, 0xE7, 0x39, 0xE7, 0x39, 0xAA, 0xA7, 0x10, 0x29, 0xD3, 0xDA, 0x2A, 0xCA,
+    0x3D, 0x92, 0xAC, 0x92, 0xAD, 0x3D, 0x3E, 0x3D, 0x29, 0xDA, 0x29, 0xD2, 0xE9, 0x29, 0xFF, 0x39,
+    0xFF, 0x4A, 0xFD, 0xA7, 0x77, 0x77, 0x76, 0x9D, 0x71, 0xE7, 0x09, 0xE7, 0x0A, 0xAA, 0xA7, 0x00,
+    0x72, 0xCA, 0x75, 0x9C, 0x74, 0x9C, 0x97, 0x77, 0x77, 0x77, 0x76, 0xEA, 0x3E, 0xA2, 0x9E, 0x4E,
+    0x92, 0xAE, 0x39, 0xE3, 0xEA, 0x3A, 0xE3, 0xE9, 0x3E, 0x92, 0x9E, 0x4E, 0x3A, 0xDA, 0x39, 0xE3,
+    0xE9, 0x3A, 0xD9, 0x3E, 0x4E, 0x4E, 0x3A, 0xE3, 0x9F, 0xFD, 0x93, 0x9F, 0xFD, 0x49, 0xFF, 0xC9,
+    0x5A, 0xFE, 0x97, 0x74, 0x6D, 0x70, 0x9C, 0x97, 0xCA, 0x77, 0x77, 0x39, 0xD3, 0xDA, 0x0A, 0xCA,
+    0x3D, 0x90, 0xAC, 0x92, 0xAD, 0x1D, 0x3E, 0x1D, 0x29, 0xDA, 0x09, 0xD2, 0xE9, 0x09, 0xFF, 0x19,
+    0xFF, 0x2A, 0xFD, 0xA1, 0x73, 0x97, 0x7D, 0x76, 0xD9, 0x75, 0xAC, 0xA7, 0x75, 0xC9, 0x77, 0xD7,
+    0x6A, 0xC9, 0x3E, 0xA3, 0xFC, 0x39, 0xE4, 0xEA, 0x4A, 0xE3, 0x9E, 0x5E, 0xA3, 0xAE, 0x5E, 0x93,
+    0xE9, 0x49, 0xE4, 0xE5, 0xAD, 0xA3, 0x9E, 0x5E, 0x93, 0xAD, 0x95, 0xE4, 0xE6, 0xE3, 0xAE, 0x59,
+    0xFF, 0xD9, 0x59, 0xFF, 0xD6, 0x9F, 0xFC, 0x97, 0xAF, 0xE9, 0x77, 0x70, 0x79, 0x97, 0x2D, 0x72,
+    0xAC, 0xA7, 0x19, 0xD2, 0x97, 0x4D, 0x72, 0x9D, 0x19, 0xD3, 0xF9, 0x1A, 0xCA, 0x3E, 0x92, 0xAC,
+    0x92, 0xAD, 0x4D, 0x3E, 0x4D, 0x29, 0xDA, 0x39, 0xD2, 0xE9, 0x39, 0xFF, 0x49, 0xFF, 0x5A, 0xFD,
+    0xA4, 0x79, 0xD9, 0x76, 0xAD, 0x97, 0x6E, 0x97, 0x77, 0x75, 0xCA, 0x77, 0xD7, 0x6A, 0xC9, 0x3E,
+    0xA3, 0xFC, 0x39, 0xE4, 0xEA, 0x4A, 0xE3, 0x9E, 0x5E, 0xA3, 0xAE, 0x5E, 0x93, 0xE9, 0x49, 0xE4,
+    0xE5, 0xAD, 0xA3, 0x9E, 0x5E, 0x93, 0xAD, 0x95, 0xE4, 0xE6, 0xE3, 0xAE, 0x59, 0xFF, 0xD9, 0x59,
+    0xFF, 0xD6, 0x9F, 0xFC, 0x97, 0xAF, 0xE9, 0x77, 0x70, 0x4D, 0x97, 0x29, 0xDA, 0x72, 0xAD, 0xA7,
+    0x6A, 0xA7, 0x3D, 0x72, 0x9C, 0xA1, 0x9D, 0x3F, 0x2A, 0xCA, 0x3E, 0x92, 0xAC, 0x92, 0xAD, 0x4D,
+    0x3E, 0x4D, 0x29, 0xDA, 0x39, 0xD2, 0xE9, 0x39, 0xFF, 0x49, 0xFF, 0x5A, 0xFD, 0xA4, 0x72, 0xCA,
+    0x77, 0x9C, 0x76, 0x9C, 0x97, 0x77, 0x76, 0xD7, 0x7D, 0x76, 0xD9, 0x3E, 0xA3, 0xFC, 0x39, 0xE4,
+    0xEA, 0x4A, 0xE3, 0x9E, 0x5E, 0xA3, 0xAE, 0x5E, 0x93, 0xE9, 0x49, 0xE4, 0xE5, 0xAD, 0xA3, 0x9E,
+    0x5E, 0x93, 0xAD, 0x95, 0xE4, 0xE6, 0xE3, 0xAE, 0x59, 0xFF, 0xD9, 0x59, 0xFF, 0xD6, 0x9F, 0xFC,
+    0x97, 0xAF, 0xE9, 0x77, 0x70, 0x6D, 0x73, 0x9C, 0x97, 0x2C, 0xA7, 0x7A, 0xA7, 0x3D, 0x72, 0x9C,
+    0xA1, 0x9D, 0x3F, 0x2A, 0xCA, 0x3E, 0x92, 0xAC, 0x92, 0xAD, 0x4D, 0x3E, 0x4D, 0x29, 0xDA, 0x39,
+    0xD2, 0xE9, 0x39, 0xFF, 0x49, 0xFF, 0x5A, 0xFD, 0xA4, 0x70, 0xAC, 0xA0, 0xCA, 0x72, 0x9E, 0x9C,
+    0x97, 0x2D, 0x0E, 0x73, 0xAA, 0x09, 0xA9, 0x77, 0x3C, 0xA7, 0x7D, 0x76, 0xAC, 0x93, 0xEA, 0x3F,
+    0xC3, 0x9E, 0x4E, 0xA4, 0xAE, 0x39, 0xE5, 0xEA, 0x3A, 0xE5, 0xE9, 0x3E, 0x94, 0x9E, 0x4E, 0x5A,
+    0xDA, 0x39, 0xE5, 0xE9, 0x3A, 0xD9, 0x5E, 0x4E, 0x6E, 0x3A, 0xE5, 0x9F, 0xFD, 0x95, 0x9F, 0xFD,
+    0x69, 0xFF, 0xC9, 0x7A, 0xFE, 0x97, 0x77, 0x00, 0x49, 0xCA, 0x0C, 0xA7, 0xFC, 0xA6, 0xAC, 0x09,
+    0xD7, 0x69, 0x97, 0x3D, 0x72, 0x9D, 0x19, 0xD3, 0xF9, 0x1A, 0xCA, 0x3E, 0x92, 0xAC, 0x92, 0xAD,
+    0x4D, 0x3E, 0x4D, 0x29, 0xDA, 0x39, 0xD2, 0xE9, 0x39, 0xFF, 0x49, 0xFF, 0x5A, 0xFD, 0xA4, 0x77,
+    0x77, 0x1C, 0xA7, 0x7D, 0x76, 0xAC, 0x93, 0xEA, 0x3F, 0xC3, 0x9E, 0x4E, 0xA4, 0xAE, 0x39, 0xE5,
+    0xEA, 0x3A, 0xE5, 0xE9, 0x3E, 0x94, 0x9E, 0x4E, 0x5A, 0xDA, 0x39, 0xE5, 0xE9, 0x3A, 0xD9, 0x5E,
+    0x4E, 0x6E, 0x3A, 0xE5, 0x9F, 0xFD, 0x95, 0x9F, 0xFD, 0x69, 0xFF, 0xC9, 0x7A, 0xFE, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x71, 0x9D, 0x97, 0x5E, 0x75, 0x9E, 0x75, 0x9A, 0xAA, 0x73, 0x74, 0x99, 0x75,
+    0xD7, 0x49, 0xD3, 0x9D, 0x3F, 0x4A, 0xCA, 0x3E, 0x94, 0xAC, 0x92, 0xAD, 0x6D, 0x3E, 0x6D, 0x29,
+    0xDA, 0x59, 0xD2, 0xE9, 0x59, 0xFF, 0x69, 0xFF, 0x7A, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x75, 0x9D,
+    0x74, 0xE7, 0x39, 0xE7, 0x3A, 0xAA, 0xA7, 0x30, 0x3A, 0xD7, 0x2E, 0x72, 0xE7, 0x77, 0x77, 0x77,
+    0xE5, 0xE0, 0xAD, 0x93, 0xAD, 0x90, 0x9D, 0xA2, 0x9D, 0xA1, 0x9E, 0x2E, 0x3E, 0x1E, 0x4E, 0x9E,
+    0x94, 0xAF, 0xCA, 0x59, 0xFC, 0x69, 0xF7, 0x0E, 0x97, 0x9E, 0x70, 0xAE, 0x70, 0xEA, 0x79, 0xE9,
+    0x70, 0x69, 0xD9, 0x73, 0xAD, 0x97, 0x3A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x1D, 0xA3, 0xAD, 0x4E,
+    0x29, 0xD5, 0xAD, 0x2D, 0xA5, 0x9D, 0xA0, 0xAD, 0x7E, 0x0D, 0x97, 0xFD, 0x70, 0xAF, 0x71, 0x9E,
+    0xA7, 0x2E, 0x72, 0x9D, 0x97, 0x19, 0xE7, 0xAF, 0xC7, 0x0F, 0xC9, 0x70, 0xEA, 0x71, 0x3E, 0x5E,
+    0x4A, 0xD9, 0x3A, 0xD9, 0x49, 0xDA, 0x29, 0xDA, 0x59, 0xE2, 0xE7, 0xE1, 0xE7, 0x0E, 0x9E, 0x97,
+    0x0A, 0xFC, 0xA7, 0x19, 0xFC, 0x72, 0x9F, 0x74, 0xE9, 0x73, 0x9E, 0x74, 0xAE, 0x74, 0xEA, 0x73,
+    0x9E, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6D, 0xA7, 0x49, 0xDA, 0x74, 0xE9, 0x74, 0xAA, 0xA7,
+    0x40, 0x3D, 0xA3, 0xAD, 0x4E, 0x29, 0xD5, 0xAD, 0x2D, 0xA5, 0x9D, 0xA0, 0xAD, 0x7E, 0x0D, 0x97,
+    0xFD, 0x70, 0xAF, 0x71, 0x9E, 0xA7, 0x2E, 0x72, 0x9D, 0x97, 0x19, 0xE7, 0xAF, 0xC7, 0x0F, 0xC9,
+    0xE5, 0xEA, 0x09, 0xDA, 0x72, 0xE9, 0x72, 0xAA, 0xA9, 0x40, 0x77, 0x3A, 0xC9, 0x72, 0xAA, 0x71,
+    0xCA, 0x77, 0x77, 0x77, 0x77, 0x4E, 0x5E, 0x0A, 0xD9, 0x3A, 0xD9, 0x09, 0xDA, 0x29, 0xDA, 0x19,
+    0xE2, 0xE3, 0xE1, 0xE4, 0xE9, 0xE9, 0x4A, 0xFC, 0xA5, 0x9F, 0xC6, 0x9F, 0x70, 0xE9, 0x79, 0xE7,
+    0x0A, 0xE7, 0x0E, 0xA7, 0x9E, 0x97, 0x77, 0x70, 0xAC, 0xA7, 0x4A, 0xC7, 0x3A, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x71, 0xDA, 0x3A, 0xD4, 0xE2, 0x9D, 0x5A, 0xD2, 0xDA, 0x59, 0xDA, 0x0A, 0xD7, 0xE0,
+    0xD9, 0x7F, 0xD7, 0x0A, 0xF7, 0x19, 0xEA, 0x72, 0xE7, 0x29, 0xD9, 0x71, 0x9E, 0x7A, 0xFC, 0x70,
+    0xFC, 0x97, 0x0E, 0xA7, 0x10, 0x5A, 0xA0, 0x9A, 0x6A, 0xD9, 0xAC, 0x6C, 0xAE, 0xA5, 0x9C, 0x90,
+    0xD7, 0x77, 0x77, 0x77, 0x73, 0xE5, 0xE0, 0xAD, 0x93, 0xAD, 0x90, 0x9D, 0xA2, 0x9D, 0xA1, 0x9E,
+    0x2E, 0x3E, 0x1E, 0x4E, 0x9E, 0x94, 0xAF, 0xCA, 0x59, 0xFC, 0x69, 0xF7, 0x0E, 0x97, 0x9E, 0x70,
+    0xAE, 0x70, 0xEA, 0x79, 0xE9, 0x70, 0x70, 0xD0, 0x9C, 0x70, 0xFD, 0x70, 0xCA, 0x0D, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x7D, 0xA3, 0xAD, 0x4E, 0x29, 0xD5, 0xAD, 0x2D, 0xA5, 0x9D, 0xA0, 0xAD, 0x7E,
+    0x0D, 0x97, 0xFD, 0x70, 0xAF, 0x71, 0x9E, 0xA7, 0x2E, 0x72, 0x9D, 0x97, 0x19, 0xE7, 0xAF, 0xC7,
+    0x0F, 0xC9, 0x70, 0xEA, 0x71, 0x0F, 0xF0, 0x9F, 0xF0, 0x0F, 0xF0, 0x9F, 0xF0, 0x0A, 0xFF, 0xF1,
+    0xFF, 0xFA, 0x00, 0x76, 0x9F, 0xFE, 0x1F, 0xFE, 0x91, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0x77,
+    0x39, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0xC1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90,
+    0x77, 0x39, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0xC1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x90, 0x77, 0x9C, 0xA1, 0xAC, 0x93, 0xD9, 0x1D, 0x4D, 0x2D, 0x39, 0xCA, 0x1A, 0xCA, 0x3A, 0xC9,
+    0x1D, 0x4D, 0x2D, 0x39, 0xD1, 0x9C, 0xA3, 0xAC, 0xA1, 0xAC, 0x93, 0xD2, 0xD4, 0xD1, 0x9C, 0xA3,
+    0x9C, 0xA1, 0xAC, 0x93, 0xAC, 0x91, 0xD4, 0xD2, 0xD3, 0x9C, 0xA1, 0xAC, 0xA3, 0xAC, 0x91, 0xD4,
+    0x1A, 0xFF, 0xFA, 0x1F, 0xFF, 0xC7, 0x77, 0x71, 0xAF, 0xFF, 0xA1, 0xFF, 0xFC, 0x90, 0x0A, 0xAA,
+    0x93, 0xF3, 0x9E, 0x4A, 0xDA, 0x4E, 0x93, 0xAE, 0x00, 0x2A, 0xAA, 0xA3, 0xE9, 0x29, 0xE3, 0xE9,
+    0x2A, 0xE2, 0x9E, 0x30, 0x2A, 0xAA, 0x91, 0x9E, 0x91, 0xAD, 0xA2, 0xE2, 0xEA, 0x19, 0xE2, 0x0A,
+    0xAA, 0x93, 0xF3, 0x9E, 0x4A, 0xDA, 0x4E, 0x93, 0xAE, 0x00, 0x0A, 0xAA, 0x90, 0xAA, 0xAA, 0x3F,
+    0x09, 0xE9, 0x29, 0xE1, 0xEA, 0x3A, 0xDA, 0x09, 0xE4, 0xE9, 0x0A, 0xDA, 0x3A, 0xE1, 0xE9, 0x2A,
+    0xAA, 0xA0, 0x9A, 0xAA, 0x92, 0xE9, 0x0F, 0x29, 0xE1, 0xE9, 0x2E, 0x90, 0xAE, 0x2A, 0xE1, 0xE9,
+    0x19, 0xE1, 0xEA, 0x20, 0x2A, 0xAA, 0x91, 0x9E, 0x91, 0xAD, 0xA2, 0xE2, 0xEA, 0x19, 0xE2, 0x0A,
+    0xAA, 0x90, 0xAA, 0xAA, 0x3F, 0x09, 0xE9, 0x29, 0xE1, 0xEA, 0x3E, 0xA1, 0xE4, 0xE1, 0xAD, 0xA3,
+    0xAE, 0x1E, 0x90, 0x77, 0xD9, 0x6D, 0x69, 0xD6, 0xAC, 0xA6, 0xD9, 0x59, 0xD3, 0x9F, 0xEA, 0x0F,
+    0xFA, 0x09, 0x09, 0xD9, 0x99, 0x3A, 0xD6, 0xDA, 0x6D, 0x95, 0x9D, 0x6A, 0xCA, 0x6D, 0x95, 0x9D,
+    0x6A, 0xD6, 0xDA, 0x6D, 0x96, 0xAC, 0x79, 0xA7, 0x09, 0x77, 0x00, 0x79, 0x97, 0x1D, 0x97, 0x9D,
+    0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x79, 0xAD, 0x99, 0x3A, 0xFE, 0xA1, 0x9F, 0xFA, 0x49, 0xD7,
+    0x0A, 0xCA, 0x70, 0xD9, 0x79, 0xD5, 0x9F, 0xEA, 0x2F, 0xFA, 0x49, 0xD9, 0x96, 0xAD, 0x70, 0xDA,
+    0x70, 0xD9, 0x70, 0xD7, 0x1A, 0xA7, 0x29, 0x77, 0x20, 0x5F, 0xFA, 0x49, 0xFF, 0xA4, 0xFF, 0xC9,
+    0x39, 0xFF, 0xC9, 0x3F, 0xFD, 0x39, 0xFF, 0xD3, 0xFF, 0xE3, 0xFF, 0xE2, 0xAF, 0xFD, 0xA2, 0xFF,
+    0xEA, 0x1A, 0xFF, 0xE9, 0x1F, 0xFF, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x69, 0xC9, 0x2E,
+    0xA1, 0xFA, 0x9E, 0xA0, 0x9C, 0x97, 0x00, 0x1A, 0xA1, 0xAD, 0x1E, 0x0A, 0xE0, 0x1A, 0xA1, 0xAD,
+    0x1E, 0x0A, 0xE0, 0x1A, 0xA9, 0x2A, 0xA2, 0x9A, 0xA0, 0xAD, 0x91, 0xAD, 0x2D, 0xA0, 0xE2, 0xE1,
+    0xAD, 0xA9, 0xE1, 0xAE, 0x1E, 0x90, 0x0D, 0x0D, 0x73, 0x9C, 0xA6, 0xAA, 0x3D, 0x6D, 0xA2, 0xD7,
+    0xC9, 0xC1, 0xD9, 0x69, 0xCA, 0xA0, 0xAC, 0xA7, 0x0D, 0x0A, 0xCA, 0x73, 0x9D, 0x73, 0x9D, 0x74,
+    0xD9, 0x73, 0xD9, 0x73, 0xDA, 0x09, 0xA0, 0x9A, 0x94, 0xE1, 0xCA, 0x9A, 0xAA, 0x3A, 0xD1, 0x9A,
+    0xA0, 0xCA, 0x92, 0xAD, 0x3C, 0x90, 0xCA, 0x3A, 0xA9, 0x73, 0x2A, 0xAA, 0xA2, 0x9E, 0x92, 0xAE,
+    0x3E, 0x92, 0xAE, 0x29, 0xE3, 0x2A, 0xAA, 0xA0, 0x9A, 0xAA, 0x29, 0xE9, 0x0F, 0x2A, 0xE1, 0xE9,
+    0x2E, 0x90, 0xAE, 0x2A, 0xE1, 0xE2, 0x9E, 0x1E, 0xA2, 0x76, 0xCA, 0x1D, 0x1A, 0xC1, 0xAC, 0xA1,
+    0xD1, 0xD1, 0xD1, 0xAC, 0xA0, 0x9C, 0xA1, 0xCA, 0x1A, 0xC1, 0x9C, 0x76, 0x5D, 0x2D, 0x91, 0x9C,
+    0xA2, 0xD5, 0x70, 0xD0, 0xAC, 0x91, 0xD0, 0xAC, 0xA1, 0xAC, 0x90, 0xD2, 0xCA, 0x0A, 0xC7, 0x00,
+    0x75, 0xD1, 0xD1, 0xAC, 0x91, 0xD1, 0xD9, 0x0A, 0xCA, 0x1A, 0xC9, 0x0A, 0xCA, 0x1D, 0x2C, 0xA1,
+    0xCA, 0x1A, 0xC7, 0x50, 0x4D, 0x6E, 0xA3, 0xAD, 0xAD, 0xA1, 0xAA, 0xA9, 0x0A, 0xAA, 0x90, 0x73,
+    0x94, 0xD2, 0x9D, 0x91, 0xAD, 0x2A, 0xD3, 0xAD, 0xA3, 0xAD, 0x93, 0xD5, 0x92, 0x79, 0x5C, 0xA4,
+    0x9D, 0x94, 0xDA, 0x4D, 0xA2, 0xAD, 0x91, 0x9D, 0xA3, 0xD4, 0x92, 0x75, 0x9A, 0xA7, 0x72, 0xE7,
+    0x71, 0xAD, 0xA7, 0x2A, 0xE2, 0xEA, 0x9E, 0x7E, 0xA4, 0xAE, 0x70, 0xF3, 0xAE, 0x71, 0x9E, 0xA1,
+    0xF7, 0x3F, 0x9F, 0x71, 0xAD, 0xAF, 0xDA, 0x2D, 0xA4, 0xE0, 0xFC, 0xA2, 0x9D, 0xA3, 0xAD, 0xA0,
+    0xFC, 0x3E, 0x93, 0xAA, 0xAA, 0xFD, 0x92, 0xAA, 0xA6, 0xAF, 0xF7, 0x3A, 0xFA, 0xF9, 0x71, 0xFC,
+    0x1F, 0xC7, 0x9F, 0xA2, 0xAF, 0xA5, 0xAF, 0x94, 0xFC, 0x77, 0x77, 0x29, 0xD7, 0x72, 0xE7, 0x71,
+    0x9E, 0x77, 0x19, 0xAA, 0xA7, 0x20, 0x77, 0x1C, 0x79, 0xCA, 0x6A, 0xC9, 0x6D, 0x69, 0xD6, 0xDA,
+    0x6D, 0x95, 0xAD, 0x6D, 0xA6, 0xD9, 0x59, 0xD7, 0x9C, 0x77, 0x77, 0x74, 0x9E, 0x5E, 0xA4, 0x9E,
+    0xA4, 0xF9, 0x4A, 0xAA, 0xA4, 0x77, 0x39, 0x73, 0xD7, 0x2D, 0x71, 0x9D, 0x70, 0xAF, 0xA4, 0xAF,
+    0xEA, 0x39, 0xF0, 0x9D, 0x59, 0xD1, 0xD5, 0xDA, 0x09, 0xD5, 0xD9, 0x0A, 0xD4, 0x9D, 0x99, 0xD9,
+    0x4A, 0xDA, 0xDA, 0x5F, 0xD6, 0xF9, 0x7E, 0x97, 0x0E, 0x70, 0xAD, 0xA7, 0x09, 0x97, 0x77, 0x73,
+    0xAD, 0x71, 0xE7, 0x0A, 0xE7, 0x0F, 0x79, 0xF7, 0xAF, 0x70, 0x0F, 0xF9, 0x9F, 0xF0, 0x0A, 0xA9,
+    0x19, 0xAA, 0x0A, 0xFD, 0x90, 0x9F, 0xC9, 0x49, 0x30, 0x69, 0x71, 0x99, 0xC0, 0xA6, 0xAF, 0xC7,
+    0xAD, 0xA7, 0xAF, 0xA6, 0xA9, 0xC9, 0xAA, 0x5A, 0xA9, 0xC9, 0x9C, 0x0A, 0x1C, 0xAF, 0xFA, 0x1A,
+    0xE9, 0x0E, 0xA1, 0x9F, 0xFD, 0x90, 0x9A, 0xAA, 0x99, 0x99, 0xC5, 0xA9, 0x70, 0x74, 0xD7, 0x4D,
+    0x74, 0xD9, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0x9D, 0x73, 0x9D, 0x73, 0x9D, 0x74, 0xD9, 0x73,
+    0xDA, 0x73, 0xDA, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x77, 0x73, 0x77, 0x73, 0x9E, 0xA4, 0x9A,
+    0xDA, 0x94, 0x9F, 0xE1, 0x9F, 0xE9, 0x3D, 0xA9, 0x1D, 0xA0, 0xAD, 0x91, 0xAD, 0x39, 0x93, 0xAD,
+    0x19, 0x39, 0xD7, 0x1A, 0xCA, 0x69, 0xD7, 0x1D, 0xA6, 0xAD, 0x70, 0x9D, 0x7D, 0x97, 0x9D, 0xA5,
+    0x9E, 0x6A, 0xEA, 0x49, 0xF6, 0xFA, 0x4A, 0xEA, 0x7E, 0x6E, 0x97, 0x9E, 0x6E, 0x70, 0xE9, 0x5A,
+    0xE7, 0x0A, 0x97, 0xA9, 0x77, 0x77, 0x77, 0x7A, 0xA9, 0x69, 0xAA, 0x70, 0x9D, 0xA6, 0xE7, 0x0A,
+    0xD9, 0x59, 0xDA, 0x70, 0xE9, 0x5E, 0xA7, 0x77, 0x70, 0x9A, 0xDA, 0x69, 0x93, 0x9F, 0xE5, 0xAC,
+    0x3E, 0x91, 0xE4, 0xD4, 0x93, 0x9D, 0x39, 0xD7, 0x1A, 0xD3, 0xDA, 0x71, 0xDA, 0x3D, 0x71, 0x9D,
+    0x92, 0xAD, 0x70, 0x9D, 0xA3, 0xDA, 0x6A, 0xF4, 0xD9, 0x5A, 0xEA, 0x4A, 0xD6, 0xE6, 0xE5, 0x9E,
+    0x7C, 0x95, 0xAD, 0xA7, 0x7A, 0x97, 0x77, 0x77, 0x77, 0x09, 0xAA, 0x6E, 0x95, 0xDA, 0x59, 0xE9,
+    0x4A, 0xDA, 0x5F, 0x5E, 0x95, 0xF7, 0x69, 0xAA, 0xAA, 0x40, 0x77, 0x70, 0xA1, 0x9A, 0xE9, 0x70,
+    0xFF, 0xCA, 0x69, 0xFA, 0x1A, 0xD6, 0xDA, 0xA4, 0xD6, 0xD6, 0xD5, 0x9D, 0x5A, 0xD5, 0xDA, 0x5D,
+    0xA5, 0xD9, 0x4E, 0x5A, 0xD2, 0x9F, 0x6D, 0xA1, 0x9F, 0x7D, 0x91, 0xAD, 0xA7, 0x1C, 0x2E, 0x75,
+    0x9E, 0x75, 0x9A, 0x77, 0x77, 0x75, 0xE1, 0x9A, 0xA7, 0x0A, 0xE1, 0xE7, 0x0F, 0x09, 0xE7, 0x9E,
+    0xA0, 0xAE, 0x79, 0xAA, 0xA9, 0x74, 0x77, 0x77, 0x2A, 0xC7, 0x7A, 0xCA, 0x76, 0x9D, 0x77, 0xD9,
+    0x76, 0x9D, 0x77, 0xD9, 0x7D, 0xA3, 0xAD, 0x79, 0xDA, 0x3D, 0x97, 0xE9, 0x2A, 0xCA, 0x70, 0xAA,
+    0xA3, 0xD7, 0x7D, 0xA7, 0x69, 0xD7, 0x7D, 0xA7, 0x6A, 0xD7, 0x7D, 0x97, 0x6A, 0xD7, 0x7D, 0x99,
+    0xD7, 0x3E, 0x0E, 0x72, 0x9D, 0x99, 0xE7, 0x2E, 0x09, 0xAA, 0xA7, 0x19, 0xD7, 0x7D, 0xA7, 0x6A,
+    0xD7, 0x7D, 0xA7, 0x6A, 0xD7, 0x69, 0xD9, 0x76, 0xCA, 0x77, 0x99, 0x77, 0x00, 0x2A, 0xA2, 0xC0,
+    0xA9, 0x0A, 0xAC, 0xAA, 0x0C, 0xAA, 0xC9, 0x0C, 0x99, 0xC1, 0xEA, 0x19, 0xCA, 0x10, 0x39, 0x92,
+    0x9C, 0x91, 0x9A, 0xC1, 0x9A, 0x9C, 0x1F, 0x92, 0xC9, 0x00, 0x7E, 0xA0, 0x9A, 0x3A, 0xDA, 0x39,
+    0xC1, 0xA0, 0xD0, 0x9E, 0x90, 0x9A, 0xA9, 0x10, 0x19, 0xE0, 0x9C, 0x92, 0xEA, 0x1C, 0xA9, 0xC0,
+    0x9C, 0x09, 0xC1, 0xE9, 0x60, 0x6F, 0x3A, 0xC3, 0xC9, 0x2A, 0xC3, 0xCA, 0x2A, 0xC3, 0x99, 0x20,
+    0x19, 0xAA, 0x2C, 0x0A, 0xA0, 0x9C, 0x0C, 0x91, 0xE0, 0x9C, 0x09, 0xC0, 0x9E, 0xA2, 0x92, 0x1A,
+    0xD1, 0xAA, 0x0A, 0x90, 0xC1, 0xA9, 0x0C, 0x99, 0xC9, 0x0A, 0xE1, 0x99, 0xAA, 0x0A, 0xDA, 0x70,
+    0x76, 0xAC, 0xAE, 0xA4, 0xFE, 0xA2, 0x9E, 0x90, 0xAD, 0x2A, 0xD2, 0x9D, 0x2D, 0x92, 0xDA, 0x19,
+    0xD3, 0xD9, 0x1E, 0x2A, 0xD2, 0xE2, 0xE1, 0xAD, 0xA1, 0x9E, 0x10, 0x19, 0xAA, 0x19, 0xC0, 0xA9,
+    0x0C, 0xAA, 0xA9, 0x0C, 0x9A, 0xC9, 0x9C, 0x0A, 0xC0, 0x9E, 0x91, 0xAC, 0xA1, 0x29, 0xA2, 0x9D,
+    0x3A, 0xA3, 0xC9, 0x29, 0xC2, 0x9A, 0xC9, 0x1F, 0x00, 0x19, 0xE2, 0xA9, 0x0C, 0x94, 0xC9, 0x3D,
+    0x29, 0xD2, 0x9D, 0xA9, 0x1F, 0x90, 0x2E, 0x5A, 0x93, 0x9C, 0x29, 0xDA, 0x4A, 0xC1, 0xAE, 0x91,
+    0x9A, 0xA9, 0x10, 0x3A, 0x3D, 0x2C, 0xAC, 0x1C, 0x9A, 0xA0, 0xAF, 0x29, 0xC9, 0x2A, 0xC1, 0x69,
+    0xE9, 0x0A, 0xA3, 0xC9, 0x3E, 0x93, 0xCA, 0x0A, 0xE1, 0x9A, 0xA2, 0x29, 0xDA, 0x19, 0xA9, 0x3E,
+    0x91, 0x9C, 0x9A, 0xC1, 0xAC, 0x09, 0xC1, 0xAC, 0x9C, 0xA2, 0xDA, 0x10, 0x5A, 0xF3, 0xCA, 0x29,
+    0xC3, 0xCA, 0x29, 0xC9, 0x2D, 0x3A, 0x92, 0x19, 0xAC, 0x2C, 0x0A, 0xA0, 0x9C, 0x0C, 0x91, 0xE1,
+    0xC9, 0x0C, 0x0A, 0xC9, 0xAC, 0x1D, 0xA9, 0x00, 0x1A, 0xD1, 0xAA, 0x0A, 0x90, 0xC1, 0xAA, 0x0C,
+    0x99, 0xC9, 0x0A, 0xE1, 0x99, 0xAA, 0x0A, 0xDA, 0x70, 0x7A, 0xCA, 0x7A, 0xD9, 0x69, 0xD9, 0x69,
+    0xDA, 0x7E, 0x7A, 0xD7, 0x0D, 0x97, 0xE7, 0x9D, 0x97, 0xAD, 0x70, 0xDA, 0x79, 0xD7, 0x0A, 0xD7,
+    0x0E, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xE7, 0x0E, 0x70, 0xAD, 0x70, 0x9D, 0x97, 0x0E,
+    0x70, 0xAD, 0x60, 0x9D, 0x70, 0xE7, 0x0D, 0xA7, 0x9D, 0xA7, 0xAD, 0x70, 0xE7, 0x0D, 0x97, 0xAD,
+    0x70, 0xDA, 0x7A, 0xD7, 0x9D, 0x97, 0xDA, 0x7A, 0xD7, 0xAD, 0x79, 0xD7, 0x9D, 0x79, 0xD7, 0xAD,
+    0x7A, 0xD7, 0xE7, 0xDA, 0x6A, 0xD9, 0x6D, 0xA1, 0x71, 0xAC, 0x0A, 0xC7, 0x2C, 0xA0, 0xCA, 0x71,
+    0xAC, 0x0A, 0xC7, 0x2C, 0xA0, 0xCA, 0x70, 0x9F, 0xCA, 0x69, 0xFE, 0xA5, 0xAF, 0xF5, 0xAF, 0xC0,
+    0xD9, 0x49, 0xFC, 0x99, 0xC9, 0x5E, 0x9D, 0x0D, 0x5A, 0xE9, 0xC9, 0x9C, 0x95, 0xEA, 0xD0, 0xD6,
+    0xFC, 0x99, 0xC9, 0x59, 0xFC, 0x0D, 0x9A, 0x49, 0xFF, 0xD5, 0xFF, 0xCA, 0x5A, 0xFF, 0x96, 0xFF,
+    0x96, 0xCA, 0x0C, 0xA7, 0x1A, 0xC0, 0xAC, 0x72, 0xCA, 0x0C, 0xA7, 0x77, 0x10, 0x77, 0x69, 0xAF,
+    0xA5, 0x9F, 0xEA, 0x4A, 0xFF, 0x4A, 0xEA, 0x92, 0x93, 0x9E, 0x97, 0x1E, 0x97, 0x1A, 0xE1, 0x9A,
+    0xAA, 0xA3, 0xEA, 0x1A, 0xF3, 0xEA, 0x1D, 0x94, 0x9F, 0x09, 0xCA, 0x9A, 0x4F, 0xFD, 0x4F, 0xFC,
+    0xA4, 0x9F, 0xF9, 0x5A, 0xFE, 0x92, 0x77, 0x3A, 0xE9, 0x5A, 0xFD, 0x93, 0x9D, 0x39, 0x92, 0xFF,
+    0x92, 0x9F, 0xF5, 0x9C, 0xA7, 0x9F, 0xF3, 0xAF, 0xEA, 0x59, 0xD7, 0x9A, 0xD9, 0x6F, 0xEA, 0xA3,
+    0xFF, 0xC9, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0x91, 0x69, 0x99, 0x4D, 0xA7, 0x9E, 0x39, 0xD9, 0x7A,
+    0xE9, 0x2A, 0xD7, 0x0F, 0xA2, 0xDA, 0x79, 0xFC, 0x19, 0xD9, 0x7F, 0xD1, 0xAD, 0x49, 0xAA, 0xAF,
+    0xDA, 0xAE, 0xAA, 0xA1, 0xFF, 0xFF, 0xC9, 0x4E, 0xA0, 0xDA, 0xE7, 0x9E, 0x90, 0xFC, 0xA7, 0xAE,
+    0x1F, 0xC9, 0x7F, 0x1F, 0xC7, 0x9E, 0xA1, 0xAF, 0x7A, 0xE9, 0x19, 0xE9, 0x50, 0x77, 0x39, 0xFD,
+    0x70, 0xAF, 0xE5, 0x99, 0xE9, 0x9A, 0xDA, 0x99, 0x1F, 0xFF, 0xD3, 0xAD, 0x29, 0xDA, 0x5F, 0xFC,
+    0x59, 0xFF, 0x95, 0xAF, 0xE9, 0x6E, 0xAA, 0x99, 0x79, 0xE7, 0x3A, 0xDA, 0x73, 0xE9, 0x72, 0x9E,
+    0x97, 0x2A, 0xE7, 0x30, 0x3A, 0xF9, 0x76, 0xFD, 0x76, 0xD1, 0x9C, 0x97, 0x49, 0xCA, 0x19, 0xC9,
+    0x74, 0xAC, 0x91, 0xAC, 0x97, 0x4D, 0x2D, 0x5E, 0xA3, 0xDA, 0xF4, 0xDA, 0xAA, 0x29, 0xFD, 0x5C,
+    0x6A, 0xFD, 0x5D, 0xA9, 0x3E, 0x1D, 0x6A, 0xD9, 0x2D, 0xA0, 0x9D, 0x79, 0xD1, 0xAD, 0x90, 0xAD,
+    0x92, 0x9D, 0xAD, 0xA1, 0xE1, 0xE9, 0x2F, 0xD2, 0xAA, 0xA1, 0xAA, 0xA3, 0x9E, 0xA7, 0x77, 0x1A,
+    0xA6, 0xAA, 0x3D, 0x59, 0xCA, 0x3D, 0x5A, 0xC9, 0x3D, 0x5D, 0x4D, 0x1A, 0xA1, 0xD2, 0x9F, 0xFF,
+    0xCA, 0xAF, 0xFF, 0xC1, 0x9D, 0x9E, 0x0D, 0x49, 0xFD, 0xAC, 0xA4, 0x9F, 0xF5, 0x9E, 0xAA, 0xE5,
+    0x9E, 0x0A, 0xDA, 0x59, 0xDA, 0x0A, 0xD6, 0x9D, 0x90, 0xAD, 0x50, 0x3A, 0x99, 0x74, 0x9F, 0xD3,
+    0x99, 0x3A, 0xFE, 0x2D, 0x3E, 0x2A, 0xC9, 0x09, 0xCA, 0x3D, 0x39, 0xC9, 0x0A, 0xC9, 0x29, 0xC9,
+    0x0A, 0xA0, 0xAC, 0x90, 0xD3, 0xAC, 0x0A, 0xCA, 0x0D, 0x1D, 0x3D, 0x0A, 0xC9, 0x0D, 0x0A, 0xCA,
+    0x3C, 0xA0, 0xD4, 0xD9, 0x29, 0xC9, 0x0D, 0x92, 0x9D, 0x3A, 0xC1, 0xEA, 0x9A, 0xE3, 0xD2, 0xFE,
+    0xA7, 0x19, 0xAA, 0xAD, 0x92, 0x71, 0xAC, 0x71, 0x9A, 0xAD, 0xAA, 0x7F, 0xE7, 0x1A, 0xC9, 0x7A,
+    0xDA, 0xD7, 0xFD, 0xA6, 0xAC, 0x90, 0x9D, 0x96, 0xCA, 0x19, 0xD6, 0x9C, 0x91, 0xDA, 0x69, 0xFD,
+    0x97, 0xFD, 0x71, 0x99, 0x09, 0x96, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0xAF, 0xFC, 0x40, 0x77, 0x4A,
+    0xFA, 0x59, 0xFD, 0xA5, 0xFA, 0xAA, 0x94, 0xAD, 0xA7, 0x9F, 0xE5, 0xFF, 0x95, 0xAD, 0x97, 0x1D,
+    0xA7, 0x09, 0xFE, 0x5F, 0xF9, 0x59, 0xDA, 0x71, 0x9E, 0x97, 0x09, 0xFE, 0x6F, 0xDA, 0x7A, 0xF9,
+    0x77, 0x10, 0x0F, 0xFF, 0x09, 0xFF, 0xF0, 0xAF, 0xFE, 0xA5, 0xDA, 0x9A, 0x7A, 0xFA, 0x6A, 0xFC,
+    0x94, 0x9F, 0xC9, 0x6A, 0xFA, 0x09, 0x7F, 0xCA, 0x69, 0xFC, 0x94, 0x9F, 0xC9, 0x6A, 0xFA, 0x79,
+    0x0E, 0x97, 0x09, 0xE7, 0x00, 0x49, 0xFC, 0xA7, 0x2A, 0xFE, 0x71, 0xDA, 0x09, 0xE9, 0x49, 0xAA,
+    0xAE, 0xAA, 0xFA, 0xAA, 0x93, 0x9D, 0x92, 0xAD, 0x49, 0x99, 0xE9, 0x9A, 0xF9, 0x99, 0x4F, 0xFC,
+    0x79, 0xFF, 0x97, 0xAF, 0xE9, 0x70, 0xEA, 0xA9, 0x97, 0x19, 0xE7, 0x5A, 0xDA, 0x75, 0xE9, 0x74,
+    0x9E, 0x97, 0x4A, 0xE7, 0x40, 0x77, 0x71, 0xAC, 0x97, 0x4D, 0x75, 0xD7, 0x39, 0xAD, 0xAA, 0x96,
+    0xAF, 0xF9, 0x4F, 0xFD, 0x93, 0xFA, 0xD2, 0x93, 0xAE, 0x1D, 0x7E, 0x90, 0x9C, 0xA6, 0x9E, 0x1A,
+    0xC9, 0x6E, 0xA1, 0xEA, 0xA9, 0x92, 0xE9, 0x1F, 0xE9, 0x1E, 0x19, 0xFE, 0x90, 0x9E, 0x90, 0xAC,
+    0xA0, 0xAD, 0x92, 0xFA, 0xDA, 0xAE, 0x3F, 0xFE, 0xA4, 0xFF, 0xD9, 0x5A, 0xFC, 0xA9, 0x71, 0xAC,
+    0x97, 0x4D, 0x75, 0x99, 0x70, 0x77, 0x7A, 0xFC, 0x97, 0x3A, 0xFD, 0x74, 0x91, 0x9D, 0xA7, 0x7D,
+    0xA7, 0xFF, 0xFF, 0x90, 0xAF, 0xFF, 0xEA, 0x77, 0x4F, 0xFF, 0xF9, 0x09, 0xFF, 0xFF, 0x2E, 0x39,
+    0xA9, 0x70, 0xEA, 0xAA, 0xF7, 0x0A, 0xFF, 0xC9, 0x70, 0x9A, 0xFC, 0xA9, 0x77, 0x72, 0x6C, 0xA6,
+    0x9C, 0x94, 0x9A, 0xE9, 0x2A, 0xFC, 0x91, 0x9D, 0xAC, 0xA3, 0xDA, 0xAC, 0x92, 0x9D, 0x0D, 0x3A,
+    0xD0, 0xD3, 0xAF, 0xC3, 0x9F, 0xD3, 0x9F, 0xA4, 0x9C, 0xA7, 0x94, 0x77, 0x1F, 0xFF, 0xC9, 0x77,
+    0x77, 0x0F, 0xFF, 0x29, 0xFF, 0xEA, 0x29, 0x99, 0x99, 0xE9, 0x99, 0x97, 0x9D, 0x97, 0x3E, 0x74,
+    0xE7, 0x39, 0xDA, 0x73, 0xE9, 0x73, 0xE7, 0x3A, 0xE7, 0x3E, 0xA7, 0x29, 0xE7, 0x20, 0x2F, 0xF2,
+    0x9F, 0xF5, 0x9D, 0x5F, 0xF9, 0x2F, 0xF2, 0x9F, 0xC5, 0xFC, 0x6F, 0xC7, 0x09, 0xD9, 0x79, 0xDA,
+    0x7A, 0xDA, 0x7E, 0xA7, 0xEA, 0x40, 0x39, 0xD7, 0xAD, 0x09, 0xA4, 0xFC, 0xA2, 0x9A, 0xFC, 0x91,
+    0x9F, 0xA9, 0xA2, 0xAF, 0xE2, 0x99, 0xFC, 0xA2, 0xFA, 0x90, 0xAC, 0xA9, 0xF1, 0xE2, 0x9D, 0xAE,
+    0x3A, 0xFA, 0x4A, 0xCA, 0x97, 0x70, 0x69, 0x97, 0x29, 0xD7, 0x2A, 0xCA, 0x71, 0xAE, 0xA6, 0x9F,
+    0xDA, 0x5F, 0xF4, 0xAF, 0xAA, 0xD4, 0xDA, 0xAC, 0x9A, 0xCA, 0x4D, 0x0D, 0x0D, 0x93, 0x9D, 0x0D,
+    0x0D, 0x4A, 0xCA, 0x9C, 0xA9, 0xD4, 0xD9, 0xAC, 0x9A, 0xCA, 0x4D, 0x0D, 0x0D, 0x93, 0x9D, 0x9D,
+    0x9D, 0x77, 0x20, 0x77, 0x79, 0xFD, 0x71, 0xAF, 0xE7, 0x0D, 0xA2, 0xDA, 0x69, 0xD9, 0x2A, 0xCA,
+    0x6A, 0xD2, 0xAD, 0xA4, 0x99, 0xFF, 0xC4, 0xFF, 0xE9, 0x4F, 0xFD, 0x95, 0xFC, 0xAA, 0x99, 0x71,
+    0xE7, 0x09, 0xFF, 0xD5, 0xFF, 0xE7, 0x1E, 0x97, 0x3A, 0xE7, 0x10, 0x77, 0x0C, 0xA7, 0x0D, 0x97,
+    0xAC, 0xA7, 0x0D, 0x19, 0xAD, 0x91, 0xEA, 0xFC, 0x90, 0xAF, 0xDA, 0x91, 0x9F, 0x96, 0xAE, 0x70,
+    0xAE, 0x70, 0x9D, 0x97, 0x09, 0xA5, 0x59, 0xA7, 0x0A, 0xDA, 0x59, 0xFC, 0x93, 0xAF, 0xE9, 0x1E,
+    0x9D, 0x9E, 0x0A, 0xCA, 0x09, 0xD1, 0xCA, 0x19, 0x1A, 0xCA, 0x70, 0xD9, 0x70, 0xD7, 0x09, 0xD7,
+    0x0A, 0xCA, 0x77, 0x10, 0x77, 0x09, 0xC9, 0x71, 0xD7, 0x1A, 0xCA, 0x29, 0xDA, 0x91, 0xD9, 0x2F,
+    0xDA, 0xD3, 0x9A, 0xFE, 0x69, 0xAE, 0x96, 0xF6, 0xEA, 0x69, 0xDA, 0x70, 0xA9, 0x30, 0x3D, 0x72,
+    0xAC, 0x97, 0x19, 0xD7, 0x2D, 0x72, 0xD9, 0x5A, 0xC9, 0x0A, 0xCA, 0x09, 0xC9, 0x19, 0xDA, 0x9D,
+    0x9E, 0x3F, 0xF5, 0xAF, 0xC9, 0x69, 0xE9, 0x71, 0xA9, 0x77, 0x00, 0x39, 0xA7, 0xC7, 0xD7, 0xCA,
+    0x5A, 0xC3, 0x93, 0xAC, 0x93, 0x9C, 0xA9, 0xAF, 0xCA, 0x90, 0xD3, 0xFD, 0xA9, 0xAF, 0xE1, 0xFA,
+    0x95, 0x9A, 0xE9, 0x09, 0xDA, 0x71, 0xE2, 0x9D, 0xA7, 0xE5, 0xCA, 0x7D, 0x77, 0x50, 0x76, 0xAA,
+    0x59, 0xE9, 0x3A, 0xFC, 0x91, 0xDA, 0xDA, 0xD0, 0xAC, 0x90, 0xCA, 0x0A, 0xA3, 0x9C, 0x96, 0xAC,
+    0x7D, 0x7C, 0xA7, 0xCA, 0x7D, 0x7A, 0xC5, 0x90, 0x9C, 0x93, 0xAC, 0xA0, 0xCA, 0x0D, 0x1A, 0xFE,
+    0x29, 0xFC, 0x5A, 0xD7, 0x99, 0x20, 0x49, 0xAA, 0xA1, 0x9A, 0xFE, 0x1F, 0xCA, 0x93, 0xFC, 0xA4,
+    0xEA, 0xE9, 0x2A, 0xCA, 0x09, 0xF9, 0x0A, 0xD2, 0x9E, 0x9A, 0xCA, 0x4A, 0xA0, 0x1C, 0xAA, 0x96,
+    0xFE, 0xA9, 0x39, 0xAF, 0xA4, 0xAF, 0xA2, 0xAE, 0xAD, 0xA0, 0x9F, 0x1D, 0x9A, 0xE9, 0x2D, 0x90,
+    0xC9, 0x4D, 0x90, 0x1A, 0x7A, 0xCA, 0x69, 0xD2, 0xAA, 0x2D, 0x91, 0xD2, 0x9D, 0x09, 0xCA, 0x3D,
+    0x9A, 0xC9, 0x39, 0xF5, 0xF2, 0xFD, 0xA1, 0x9F, 0xD9, 0x39, 0xAA, 0xD2, 0x59, 0x97, 0xD9, 0x1A,
+    0x91, 0x9D, 0x2C, 0xA1, 0xD9, 0x2D, 0x09, 0xD3, 0xAC, 0x0D, 0x93, 0x9F, 0x5E, 0x95, 0xFE, 0x2A,
+    0xFD, 0x29, 0xDA, 0x99, 0x10, 0x2A, 0x97, 0x3D, 0x97, 0x19, 0xD7, 0x2D, 0xA7, 0x19, 0xFF, 0xDA,
+    0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0x91, 0x9F, 0xFD, 0xA2, 0x9E,
+    0x73, 0xD7, 0x39, 0xA6, 0x70, 0x97, 0x29, 0xC9, 0xAC, 0x70, 0xAD, 0x0D, 0xA6, 0xF0, 0xEA, 0x4F,
+    0xA9, 0xF9, 0x19, 0xEA, 0xC9, 0xAC, 0x9E, 0x1D, 0xA0, 0xAC, 0x0D, 0x09, 0xD1, 0xA9, 0x1D, 0x0C,
+    0xA1, 0x96, 0xCA, 0xAC, 0x97, 0x0A, 0xC9, 0xD7, 0x1D, 0x0D, 0x71, 0xD9, 0xCA, 0x70, 0x9C, 0x9A,
+    0xC9, 0x71, 0x91, 0x96, 0x71, 0xC7, 0x3D, 0x97, 0x2D, 0xA7, 0x29, 0xD2, 0x9F, 0xFD, 0xA1, 0x9A,
+    0xAA, 0xAA, 0xAA, 0xAE, 0x90, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x09, 0xFF, 0xDA, 0x70, 0xEA, 0x71,
+    0xDA, 0x72, 0x9A, 0x40, 0x39, 0x19, 0x72, 0xCA, 0x9C, 0xA7, 0x1D, 0x0D, 0x71, 0xAC, 0x0D, 0x71,
+    0x9C, 0x9A, 0xC9, 0x71, 0xCA, 0x9C, 0xA5, 0x99, 0x1D, 0x0D, 0x19, 0x2D, 0xA0, 0xAC, 0x0D, 0x1D,
+    0x2E, 0x9C, 0xAA, 0xC9, 0xE9, 0x2F, 0xC9, 0xF9, 0x4A, 0xE0, 0xEA, 0x6A, 0xD9, 0xE7, 0x09, 0xCA,
+    0x9C, 0x73, 0x90, 0x93, 0x2A, 0x97, 0x0C, 0x5D, 0x96, 0xD4, 0x9D, 0x7D, 0xA3, 0xDA, 0x79, 0xD2,
+    0x9F, 0xFF, 0xDA, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE9, 0x0A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xE2, 0x9F, 0xFF, 0xA4, 0x9E, 0x3E, 0x97, 0xD3, 0xD9, 0x70, 0x9A, 0x39, 0xA4, 0x4C, 0xA7, 0x0A,
+    0xE9, 0x5A, 0xFD, 0xA9, 0x1A, 0xD9, 0xFC, 0x90, 0xAE, 0x0C, 0xA0, 0x99, 0x1F, 0x0C, 0xA5, 0xAA,
+    0xC0, 0xCA, 0x69, 0xC0, 0xCA, 0x69, 0xC0, 0xCA, 0x69, 0xC0, 0xCA, 0x4A, 0xCA, 0xC0, 0xCA, 0x4F,
+    0x0C, 0xA5, 0xE0, 0xCA, 0x9C, 0xA3, 0xDA, 0xFC, 0x92, 0x9F, 0xCA, 0x94, 0x9D, 0xA7, 0x09, 0x94,
+    0x77, 0x5D, 0xA7, 0x09, 0xE9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD3, 0x9F, 0x9A, 0xC9,
+    0x29, 0xFF, 0x29, 0xE1, 0xEA, 0x2A, 0xD2, 0xAD, 0x92, 0xDA, 0x2A, 0xD3, 0xDA, 0x1A, 0xD9, 0x3F,
+    0xEA, 0x4A, 0xFC, 0xA6, 0xAE, 0x95, 0x76, 0x99, 0x70, 0x9A, 0xEA, 0xAD, 0x96, 0xFF, 0xCA, 0x6F,
+    0x99, 0xF9, 0x5E, 0x91, 0xAF, 0xA4, 0xE9, 0x1A, 0xD9, 0xE4, 0xDA, 0x1A, 0xD1, 0xE3, 0xAD, 0x90,
+    0xE2, 0xDA, 0x3E, 0x0E, 0x2A, 0xD9, 0x3F, 0xCA, 0x3E, 0x39, 0xFA, 0x19, 0xAE, 0xA3, 0x9F, 0xFF,
+    0x93, 0xAF, 0xFE, 0xA3, 0xAF, 0xFE, 0xA4, 0xD9, 0x9A, 0xFC, 0xA7, 0x97, 0x60, 0x70, 0x99, 0x97,
+    0x19, 0xE7, 0x1F, 0x97, 0xFC, 0x96, 0xAD, 0xAD, 0xA5, 0x9D, 0xA0, 0xE5, 0xE1, 0xE4, 0xE2, 0xE9,
+    0x2A, 0xDA, 0x2E, 0x91, 0x9E, 0x3A, 0xDA, 0x1E, 0x4A, 0xE0, 0xAF, 0xFF, 0x0F, 0xFF, 0xA0, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x76, 0xFF, 0xDA, 0x09, 0xFF, 0xD3, 0xD9, 0x1D, 0xA3, 0x9D,
+    0x19, 0xD9, 0x3A, 0xD1, 0xAD, 0x4D, 0xA1, 0xDA, 0x4D, 0x91, 0xD9, 0x39, 0xD1, 0x9D, 0x4A, 0xD1,
+    0xAD, 0x4D, 0xA1, 0xDA, 0x39, 0xD9, 0x1D, 0x93, 0xAD, 0x19, 0xD4, 0x99, 0x91, 0x99, 0x94, 0x99,
+    0x92, 0x99, 0x49, 0xD1, 0x9D, 0x5D, 0x91, 0xD9, 0x4D, 0xA1, 0xE4, 0xAD, 0x1A, 0xD4, 0x9D, 0x2D,
+    0x94, 0xD9, 0x1D, 0xA4, 0xDA, 0x1A, 0xD4, 0xAD, 0x19, 0xD4, 0x9D, 0x91, 0xD9, 0x4D, 0xA1, 0xDA,
+    0x3F, 0xFD, 0x91, 0xFF, 0xDA, 0x74, 0x77, 0x0F, 0xF3, 0x9F, 0xF4, 0xE7, 0x1A, 0xD9, 0x71, 0xE7,
+    0x19, 0xD9, 0x71, 0xD9, 0x70, 0xAC, 0xA7, 0x9D, 0xA7, 0xAD, 0xA7, 0xAF, 0xEA, 0x3F, 0xF9, 0x3A,
+    0xAA, 0xAA, 0xAA, 0xA3, 0x1A, 0xAA, 0xF1, 0xAF, 0xE9, 0x09, 0x99, 0x99, 0x99, 0x10, 0x71, 0xAA,
+    0xAA, 0xAA, 0x71, 0xFD, 0xA7, 0x09, 0xD9, 0x97, 0x3D, 0x97, 0x4A, 0xD7, 0x5D, 0x97, 0x4E, 0x74,
+    0x9D, 0x97, 0x4E, 0x74, 0xAD, 0x97, 0x0A, 0xC1, 0xE7, 0x1F, 0xD9, 0x71, 0xAF, 0xC7, 0x29, 0xF9,
+    0x73, 0xF7, 0x30, 0x59, 0x49, 0x59, 0xFC, 0x0F, 0x92, 0x9F, 0xFF, 0x2D, 0xA1, 0x9D, 0xA1, 0xD1,
+    0x9D, 0x3C, 0xA2, 0xD1, 0xAC, 0xA2, 0xAC, 0xA1, 0x9D, 0x1A, 0xFF, 0xF9, 0x19, 0xFF, 0xEA, 0x3A,
+    0xEA, 0x0A, 0xEA, 0x74, 0x94, 0x73, 0x9E, 0x97, 0x29, 0xFA, 0x72, 0xDA, 0x19, 0x71, 0xAD, 0x75,
+    0xD9, 0x74, 0xAD, 0x75, 0xDA, 0x74, 0x9D, 0x75, 0xDA, 0x75, 0xD9, 0x74, 0xAD, 0x75, 0xD9, 0x74,
+    0xAD, 0x71, 0x9A, 0x9A, 0xDA, 0x79, 0xFE, 0x71, 0xFD, 0x97, 0x2A, 0xE9, 0x77, 0x72, 0x73, 0xE3,
+    0x9E, 0x3A, 0xE3, 0xEA, 0x77, 0x72, 0xAD, 0x4E, 0x3A, 0xE3, 0xF2, 0x29, 0xAA, 0x91, 0x99, 0x2A,
+    0xF9, 0x0D, 0x90, 0x9D, 0x99, 0xFC, 0x2A, 0xC1, 0xAE, 0x76, 0x9E, 0xA1, 0xCA, 0x2F, 0xC9, 0x9D,
+    0x1A, 0xD0, 0x9F, 0x92, 0x99, 0x19, 0xAA, 0x92, 0x77, 0x74, 0xD7, 0x4D, 0x74, 0xAC, 0x74, 0xAC,
+    0x97, 0x39, 0xFC, 0x94, 0xFF, 0xDA, 0x3F, 0xD9, 0x72, 0x9D, 0x71, 0x9F, 0xFD, 0x39, 0xFF, 0xE4,
+    0x9D, 0xA9, 0x72, 0xDA, 0x73, 0xE7, 0x3A, 0xD7, 0x30, 0x77, 0x7A, 0xC9, 0x72, 0xAE, 0xA7, 0x0A,
+    0xFC, 0x7A, 0xFC, 0x96, 0x9F, 0xC9, 0x70, 0x9F, 0xA7, 0x19, 0xFE, 0xA9, 0x79, 0xAF, 0xFA, 0x70,
+    0x9A, 0xFC, 0x74, 0xAD, 0x94, 0xEA, 0xA9, 0x97, 0x9F, 0xFE, 0x95, 0x99, 0x9A, 0xAF, 0xC7, 0x70,
+    0x77, 0x4A, 0xCA, 0x74, 0xFA, 0x72, 0x9F, 0xCA, 0x72, 0x9F, 0xCA, 0x97, 0x19, 0xFC, 0x97, 0x9A,
+    0xFC, 0x39, 0x9A, 0xFE, 0xAA, 0x3F, 0xDA, 0x96, 0x9D, 0xA9, 0x72, 0x92, 0x99, 0x9A, 0xAD, 0x39,
+    0xFF, 0xE3, 0xFC, 0xAA, 0x99, 0x97, 0x74,
 };
 
 static const EpdGlyph opendyslexic_8_bolditalicGlyphs[] = {
     { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 10, 22, 10, -1, 19, 55, 0 }, // !
-    { 12, 6, 14, 1, 15, 18, 55 }, // "
-    { 21, 15, 22, 0, 13, 79, 73 }, // #
-    { 15, 20, 19, 2, 17, 75, 152 }, // $
-    { 16, 15, 20, 3, 13, 60, 227 }, // %
-    { 14, 15, 17, 2, 14, 53, 287 }, // &
-    { 5, 6, 9, 3, 13, 8, 340 }, // '
-    { 12, 23, 14, 1, 17, 69, 348 }, // (
-    { 11, 23, 7, -5, 17, 64, 417 }, // )
-    { 11, 10, 14, 2, 13, 28, 481 }, // *
-    { 10, 10, 12, 1, 10, 25, 509 }, // +
-    { 7, 6, 7, -1, 3, 11, 534 }, // ,
-    { 10, 2, 12, 1, 6, 5, 545 }, // -
-    { 5, 4, 6, 0, 4, 5, 550 }, // .
-    { 20, 29, 18, -3, 20, 145, 555 }, // /
-    { 12, 14, 14, 1, 13, 42, 700 }, // 0
-    { 10, 13, 12, 0, 13, 33, 742 }, // 1
-    { 13, 13, 14, 0, 13, 43, 775 }, // 2
-    { 13, 13, 14, 0, 13, 43, 818 }, // 3
-    { 11, 14, 14, 1, 13, 39, 861 }, // 4
-    { 12, 15, 13, 0, 14, 45, 900 }, // 5
-    { 12, 13, 14, 1, 13, 39, 945 }, // 6
-    { 10, 13, 14, 3, 13, 33, 984 }, // 7
-    { 13, 14, 14, 0, 13, 46, 1017 }, // 8
-    { 12, 14, 14, 1, 13, 42, 1063 }, // 9
-    { 7, 12, 8, 0, 12, 21, 1105 }, // :
-    { 9, 15, 9, -1, 11, 34, 1126 }, // ;
-    { 15, 11, 14, -2, 11, 42, 1160 }, // <
-    { 11, 7, 12, 0, 8, 20, 1202 }, // =
-    { 15, 11, 16, 0, 11, 42, 1222 }, // >
-    { 13, 21, 16, 2, 19, 69, 1264 }, // ?
-    { 18, 16, 19, 0, 14, 72, 1333 }, // @
-    { 14, 14, 19, 1, 14, 49, 1405 }, // A
-    { 14, 14, 16, 1, 14, 49, 1454 }, // B
-    { 15, 15, 17, 1, 15, 57, 1503 }, // C
-    { 16, 14, 18, 1, 14, 56, 1560 }, // D
-    { 14, 14, 16, 1, 14, 49, 1616 }, // E
-    { 13, 14, 15, 1, 14, 46, 1665 }, // F
-    { 16, 15, 19, 1, 15, 60, 1711 }, // G
-    { 16, 14, 18, 1, 14, 56, 1771 }, // H
-    { 8, 14, 10, 1, 14, 28, 1827 }, // I
-    { 15, 18, 16, 0, 14, 68, 1855 }, // J
-    { 15, 14, 17, 1, 14, 53, 1923 }, // K
-    { 11, 14, 15, 1, 14, 39, 1976 }, // L
-    { 18, 14, 20, 1, 14, 63, 2015 }, // M
-    { 16, 14, 18, 1, 14, 56, 2078 }, // N
-    { 17, 15, 19, 1, 14, 64, 2134 }, // O
-    { 14, 15, 16, 1, 15, 53, 2198 }, // P
-    { 17, 18, 19, 1, 15, 77, 2251 }, // Q
-    { 13, 15, 16, 1, 14, 49, 2328 }, // R
-    { 15, 15, 17, 1, 15, 57, 2377 }, // S
-    { 14, 14, 19, 4, 14, 49, 2434 }, // T
-    { 16, 15, 18, 1, 14, 60, 2483 }, // U
-    { 14, 14, 20, 5, 14, 49, 2543 }, // V
-    { 20, 15, 25, 4, 15, 75, 2592 }, // W
-    { 17, 14, 19, 1, 14, 60, 2667 }, // X
-    { 13, 14, 19, 5, 14, 46, 2727 }, // Y
-    { 17, 14, 19, 1, 14, 60, 2773 }, // Z
-    { 13, 25, 13, -1, 18, 82, 2833 }, // [
-    { 4, 19, 8, 3, 15, 19, 2915 }, // <backslash>
-    { 13, 25, 10, -4, 18, 82, 2934 }, // ]
-    { 10, 5, 13, 2, 16, 13, 3016 }, // ^
-    { 14, 4, 13, -2, 0, 14, 3029 }, // _
-    { 7, 4, 11, 3, 13, 7, 3043 }, // `
-    { 11, 10, 14, 1, 10, 28, 3050 }, // a
-    { 11, 16, 14, 2, 15, 44, 3078 }, // b
-    { 10, 10, 13, 1, 10, 25, 3122 }, // c
-    { 14, 14, 16, 1, 14, 49, 3147 }, // d
-    { 12, 9, 14, 1, 9, 27, 3196 }, // e
-    { 10, 14, 13, 2, 14, 35, 3223 }, // f
-    { 14, 14, 15, 0, 9, 49, 3258 }, // g
-    { 12, 14, 15, 1, 14, 42, 3307 }, // h
-    { 9, 15, 10, 0, 15, 34, 3349 }, // i
-    { 11, 20, 13, 1, 15, 55, 3383 }, // j
-    { 11, 14, 15, 1, 14, 39, 3438 }, // k
-    { 8, 14, 10, 1, 14, 28, 3477 }, // l
-    { 18, 10, 20, 1, 10, 45, 3505 }, // m
-    { 12, 10, 14, 1, 10, 30, 3550 }, // n
-    { 12, 9, 14, 1, 9, 27, 3580 }, // o
-    { 15, 15, 16, -1, 10, 57, 3607 }, // p
-    { 13, 15, 16, 1, 10, 49, 3664 }, // q
-    { 10, 9, 12, 1, 9, 23, 3713 }, // r
-    { 11, 11, 14, 1, 10, 31, 3736 }, // s
-    { 9, 13, 13, 3, 13, 30, 3767 }, // t
-    { 11, 9, 14, 2, 9, 25, 3797 }, // u
-    { 13, 9, 17, 3, 9, 30, 3822 }, // v
-    { 15, 11, 19, 3, 9, 42, 3852 }, // w
-    { 14, 9, 16, 1, 9, 32, 3894 }, // x
-    { 15, 14, 16, 0, 9, 53, 3926 }, // y
-    { 13, 9, 15, 1, 9, 30, 3979 }, // z
-    { 12, 17, 14, 1, 13, 51, 4009 }, // {
-    { 7, 16, 9, 1, 13, 28, 4060 }, // |
-    { 11, 17, 12, -1, 13, 47, 4088 }, // }
-    { 8, 4, 12, 3, 12, 8, 4135 }, // ~
-    { 0, 0, 14, 0, 0, 0, 4143 }, //  
-    { 9, 22, 12, 2, 19, 50, 4143 }, // ¡
-    { 10, 15, 13, 1, 12, 38, 4193 }, // ¢
-    { 13, 15, 14, 0, 14, 49, 4231 }, // £
-    { 12, 10, 14, 1, 11, 30, 4280 }, // ¤
-    { 15, 16, 17, 1, 13, 60, 4310 }, // ¥
-    { 7, 15, 9, 1, 12, 27, 4370 }, // ¦
-    { 14, 14, 15, 0, 13, 49, 4397 }, // §
-    { 9, 4, 13, 3, 14, 9, 4446 }, // ¨
-    { 10, 7, 15, 4, 16, 18, 4455 }, // ©
-    { 6, 6, 12, 5, 13, 9, 4473 }, // ª
-    { 12, 10, 14, 1, 10, 30, 4482 }, // «
-    { 10, 6, 12, 1, 6, 15, 4512 }, // ¬
-    { 10, 2, 12, 1, 6, 5, 4527 }, // ­
-    { 9, 7, 15, 5, 18, 16, 4532 }, // ®
-    { 8, 3, 12, 3, 13, 6, 4548 }, // ¯
-    { 10, 8, 14, 3, 13, 20, 4554 }, // °
-    { 13, 12, 14, 0, 9, 39, 4574 }, // ±
-    { 6, 7, 13, 6, 14, 11, 4613 }, // ²
-    { 6, 7, 13, 6, 14, 11, 4624 }, // ³
-    { 5, 4, 9, 3, 13, 5, 4635 }, // ´
-    { 14, 12, 14, -1, 9, 42, 4640 }, // µ
-    { 13, 15, 15, 1, 12, 49, 4682 }, // ¶
-    { 5, 4, 7, 1, 8, 5, 4731 }, // ·
-    { 6, 6, 6, -1, 1, 9, 4736 }, // ¸
-    { 5, 7, 12, 6, 14, 9, 4745 }, // ¹
-    { 7, 6, 13, 5, 13, 11, 4754 }, // º
-    { 12, 10, 12, -3, 10, 30, 4765 }, // »
-    { 18, 17, 22, 1, 15, 77, 4795 }, // ¼
-    { 19, 17, 22, 1, 15, 81, 4872 }, // ½
-    { 18, 15, 22, 1, 13, 68, 4953 }, // ¾
-    { 12, 21, 12, -1, 12, 63, 5021 }, // ¿
-    { 14, 19, 19, 1, 19, 67, 5084 }, // À
-    { 15, 22, 19, 1, 22, 83, 5151 }, // Á
-    { 15, 20, 19, 1, 20, 75, 5234 }, // Â
-    { 15, 19, 19, 1, 19, 72, 5309 }, // Ã
-    { 16, 20, 19, 1, 20, 80, 5381 }, // Ä
-    { 15, 20, 19, 1, 20, 75, 5461 }, // Å
-    { 23, 15, 25, 1, 14, 87, 5536 }, // Æ
-    { 15, 19, 17, 1, 15, 72, 5623 }, // Ç
-    { 14, 19, 16, 1, 19, 67, 5695 }, // È
-    { 14, 22, 16, 1, 22, 77, 5762 }, // É
-    { 14, 20, 16, 1, 20, 70, 5839 }, // Ê
-    { 15, 20, 17, 1, 20, 75, 5909 }, // Ë
-    { 10, 20, 12, 1, 20, 50, 5984 }, // Ì
-    { 11, 23, 13, 1, 23, 64, 6034 }, // Í
-    { 11, 21, 13, 1, 21, 58, 6098 }, // Î
-    { 12, 21, 14, 1, 21, 63, 6156 }, // Ï
-    { 17, 14, 18, 0, 14, 60, 6219 }, // Ð
-    { 16, 19, 18, 1, 19, 76, 6279 }, // Ñ
-    { 17, 20, 19, 1, 19, 85, 6355 }, // Ò
-    { 17, 23, 19, 1, 22, 98, 6440 }, // Ó
-    { 17, 21, 19, 1, 20, 90, 6538 }, // Ô
-    { 17, 20, 19, 1, 19, 85, 6628 }, // Õ
-    { 17, 21, 19, 1, 20, 90, 6713 }, // Ö
-    { 11, 6, 12, 0, 7, 17, 6803 }, // ×
-    { 34, 30, 28, -7, 22, 255, 6820 }, // Ø
-    { 16, 21, 18, 1, 20, 84, 7075 }, // Ù
-    { 16, 24, 18, 1, 23, 96, 7159 }, // Ú
-    { 16, 22, 18, 1, 21, 88, 7255 }, // Û
-    { 16, 22, 18, 1, 21, 88, 7343 }, // Ü
-    { 13, 24, 19, 5, 24, 78, 7431 }, // Ý
-    { 11, 14, 12, 0, 14, 39, 7509 }, // Þ
-    { 13, 14, 14, 0, 13, 46, 7548 }, // ß
-    { 11, 14, 14, 1, 14, 39, 7594 }, // à
-    { 12, 17, 14, 1, 17, 51, 7633 }, // á
-    { 12, 15, 14, 1, 15, 45, 7684 }, // â
-    { 12, 15, 14, 1, 15, 45, 7729 }, // ã
-    { 13, 15, 15, 1, 15, 49, 7774 }, // ä
-    { 11, 16, 14, 1, 16, 44, 7823 }, // å
-    { 18, 10, 21, 1, 10, 45, 7867 }, // æ
-    { 10, 14, 13, 1, 10, 35, 7912 }, // ç
-    { 12, 16, 14, 1, 16, 48, 7947 }, // è
-    { 13, 19, 15, 1, 19, 62, 7995 }, // é
-    { 13, 17, 15, 1, 17, 56, 8057 }, // ê
-    { 14, 17, 16, 1, 17, 60, 8113 }, // ë
-    { 8, 14, 9, 0, 14, 28, 8173 }, // ì
-    { 9, 17, 10, 0, 17, 39, 8201 }, // í
-    { 10, 15, 10, -1, 15, 38, 8240 }, // î
-    { 10, 14, 11, 0, 14, 35, 8278 }, // ï
-    { 16, 16, 17, 0, 15, 64, 8313 }, // ð
-    { 13, 15, 15, 1, 15, 49, 8377 }, // ñ
-    { 12, 14, 14, 1, 14, 42, 8426 }, // ò
-    { 12, 17, 14, 1, 17, 51, 8468 }, // ó
-    { 12, 15, 14, 1, 15, 45, 8519 }, // ô
-    { 12, 14, 14, 1, 14, 42, 8564 }, // õ
-    { 13, 15, 15, 1, 15, 49, 8606 }, // ö
-    { 13, 12, 17, 3, 12, 39, 8655 }, // ÷
-    { 19, 28, 18, -2, 19, 133, 8694 }, // ø
-    { 11, 14, 14, 2, 14, 39, 8827 }, // ù
-    { 11, 17, 14, 2, 17, 47, 8866 }, // ú
-    { 11, 15, 14, 2, 15, 42, 8913 }, // û
-    { 12, 15, 15, 2, 15, 45, 8955 }, // ü
-    { 15, 24, 16, 0, 19, 90, 9000 }, // ý
-    { 11, 18, 12, 0, 14, 50, 9090 }, // þ
-    { 16, 22, 17, 0, 17, 88, 9140 }, // ÿ
-    { 17, 20, 19, 1, 20, 85, 9228 }, // Ā
-    { 13, 15, 15, 1, 15, 49, 9313 }, // ā
-    { 17, 20, 19, 1, 20, 85, 9362 }, // Ă
-    { 14, 15, 16, 1, 15, 53, 9447 }, // ă
-    { 14, 19, 19, 1, 14, 67, 9500 }, // Ą
-    { 11, 15, 14, 1, 10, 42, 9567 }, // ą
-    { 15, 20, 17, 1, 20, 75, 9609 }, // Ć
-    { 11, 14, 13, 1, 14, 39, 9684 }, // ć
-    { 16, 21, 18, 1, 21, 84, 9723 }, // Ĉ
-    { 13, 15, 15, 1, 15, 49, 9807 }, // ĉ
-    { 15, 20, 17, 1, 20, 75, 9856 }, // Ċ
-    { 11, 14, 13, 1, 14, 39, 9931 }, // ċ
-    { 17, 21, 19, 1, 21, 90, 9970 }, // Č
-    { 14, 15, 16, 1, 15, 53, 10060 }, // č
-    { 16, 21, 18, 1, 21, 84, 10113 }, // Ď
-    { 17, 14, 19, 1, 14, 60, 10197 }, // ď
-    { 17, 14, 18, 0, 14, 60, 10257 }, // Đ
-    { 16, 14, 18, 1, 14, 56, 10317 }, // đ
-    { 15, 20, 17, 1, 20, 75, 10373 }, // Ē
-    { 14, 17, 16, 1, 17, 60, 10448 }, // ē
-    { 15, 20, 17, 1, 20, 75, 10508 }, // Ĕ
-    { 14, 17, 16, 1, 17, 60, 10583 }, // ĕ
-    { 14, 20, 16, 1, 20, 70, 10643 }, // Ė
-    { 12, 17, 14, 1, 17, 51, 10713 }, // ė
-    { 14, 19, 16, 1, 14, 67, 10764 }, // Ę
-    { 12, 16, 14, 1, 9, 48, 10831 }, // ę
-    { 16, 22, 18, 1, 22, 88, 10879 }, // Ě
-    { 15, 18, 17, 1, 18, 68, 10967 }, // ě
-    { 18, 23, 20, 1, 23, 104, 11035 }, // Ĝ
-    { 15, 21, 16, 0, 16, 79, 11139 }, // ĝ
-    { 18, 22, 20, 1, 22, 99, 11218 }, // Ğ
-    { 16, 20, 17, 0, 15, 80, 11317 }, // ğ
-    { 16, 22, 19, 1, 22, 88, 11397 }, // Ġ
-    { 14, 20, 15, 0, 15, 70, 11485 }, // ġ
-    { 17, 25, 19, 1, 25, 107, 11555 }, // Ģ
-    { 14, 21, 15, 0, 16, 74, 11662 }, // ģ
-    { 16, 21, 18, 1, 21, 84, 11736 }, // Ĥ
-    { 12, 20, 15, 1, 20, 60, 11820 }, // ĥ
-    { 16, 14, 18, 1, 14, 56, 11880 }, // Ħ
-    { 12, 14, 15, 1, 14, 42, 11936 }, // ħ
-    { 11, 21, 13, 1, 21, 58, 11978 }, // Ĩ
-    { 10, 15, 11, 0, 15, 38, 12036 }, // ĩ
-    { 12, 21, 14, 1, 21, 63, 12074 }, // Ī
-    { 10, 15, 11, 0, 15, 38, 12137 }, // ī
-    { 10, 19, 10, -1, 14, 48, 12175 }, // Į
-    { 11, 20, 10, -2, 15, 55, 12223 }, // į
-    { 10, 21, 12, 1, 21, 53, 12278 }, // İ
-    { 6, 9, 7, 0, 9, 14, 12331 }, // ı
-    { 18, 21, 26, 4, 14, 95, 12345 }, // Ĳ
-    { 17, 19, 18, 0, 15, 81, 12440 }, // ĳ
-    { 17, 25, 18, 0, 21, 107, 12521 }, // Ĵ
-    { 14, 22, 16, 1, 17, 77, 12628 }, // ĵ
-    { 15, 23, 17, 1, 23, 87, 12705 }, // Ķ
-    { 13, 23, 15, -1, 14, 75, 12792 }, // ķ
-    { 10, 9, 11, -2, 9, 23, 12867 }, // ĸ
-    { 11, 19, 15, 1, 19, 53, 12890 }, // Ĺ
-    { 10, 21, 12, 1, 21, 53, 12943 }, // ĺ
-    { 12, 23, 15, 0, 14, 69, 12996 }, // Ļ
-    { 11, 23, 10, -2, 14, 64, 13065 }, // ļ
-    { 12, 14, 15, 1, 14, 42, 13129 }, // Ľ
-    { 13, 17, 15, 1, 17, 56, 13171 }, // ľ
-    { 13, 14, 15, 1, 14, 46, 13227 }, // Ŀ
-    { 10, 14, 12, 1, 14, 35, 13273 }, // ŀ
-    { 26, 24, 19, -8, 19, 156, 13308 }, // Ł
-    { 18, 14, 13, -6, 14, 63, 13464 }, // ł
-    { 16, 20, 18, 1, 20, 80, 13527 }, // Ń
-    { 12, 16, 14, 1, 16, 48, 13607 }, // ń
-    { 16, 21, 18, 1, 14, 84, 13655 }, // Ņ
-    { 12, 17, 14, 1, 10, 51, 13739 }, // ņ
-    { 17, 21, 19, 1, 21, 90, 13790 }, // Ň
-    { 15, 17, 17, 1, 17, 64, 13880 }, // ň
-    { 23, 17, 14, -10, 17, 98, 13944 }, // ŉ
-    { 16, 18, 18, 1, 14, 72, 14042 }, // Ŋ
-    { 12, 14, 14, 1, 10, 42, 14114 }, // ŋ
-    { 17, 21, 19, 1, 20, 90, 14156 }, // Ō
-    { 13, 15, 15, 1, 15, 49, 14246 }, // ō
-    { 17, 21, 19, 1, 20, 90, 14295 }, // Ŏ
-    { 14, 15, 16, 1, 15, 53, 14385 }, // ŏ
-    { 19, 20, 21, 1, 19, 95, 14438 }, // Ő
-    { 16, 14, 18, 1, 14, 56, 14533 }, // ő
-    { 24, 15, 26, 1, 14, 90, 14589 }, // Œ
-    { 19, 9, 21, 1, 9, 43, 14679 }, // œ
-    { 13, 20, 16, 1, 19, 65, 14722 }, // Ŕ
-    { 10, 13, 12, 1, 13, 33, 14787 }, // ŕ
-    { 13, 24, 16, 1, 23, 78, 14820 }, // Ŗ
-    { 10, 17, 12, 1, 17, 43, 14898 }, // ŗ
-    { 15, 22, 17, 1, 21, 83, 14941 }, // Ř
-    { 12, 15, 14, 1, 15, 45, 15024 }, // ř
-    { 15, 20, 17, 1, 20, 75, 15069 }, // Ś
-    { 11, 15, 14, 1, 14, 42, 15144 }, // ś
-    { 16, 21, 18, 1, 21, 84, 15186 }, // Ŝ
-    { 13, 16, 15, 1, 15, 52, 15270 }, // ŝ
-    { 15, 19, 17, 1, 15, 72, 15322 }, // Ş
-    { 11, 14, 14, 1, 10, 39, 15394 }, // ş
-    { 17, 21, 19, 1, 21, 90, 15433 }, // Š
-    { 14, 16, 16, 1, 15, 56, 15523 }, // š
-    { 14, 19, 19, 4, 14, 67, 15579 }, // Ţ
-    { 10, 17, 13, 2, 13, 43, 15646 }, // ţ
-    { 14, 21, 19, 4, 21, 74, 15689 }, // Ť
-    { 13, 15, 17, 3, 15, 49, 15763 }, // ť
-    { 14, 14, 19, 4, 14, 49, 15812 }, // Ŧ
-    { 11, 13, 13, 1, 13, 36, 15861 }, // ŧ
-    { 16, 22, 18, 1, 21, 88, 15897 }, // Ũ
-    { 11, 15, 14, 2, 15, 42, 15985 }, // ũ
-    { 16, 22, 18, 1, 21, 88, 16027 }, // Ū
-    { 12, 15, 15, 2, 15, 45, 16115 }, // ū
-    { 16, 22, 18, 1, 21, 88, 16160 }, // Ŭ
-    { 13, 15, 16, 2, 15, 49, 16248 }, // ŭ
-    { 16, 23, 18, 1, 22, 92, 16297 }, // Ů
-    { 11, 16, 14, 2, 16, 44, 16389 }, // ů
-    { 19, 21, 21, 1, 20, 100, 16433 }, // Ű
-    { 15, 14, 18, 2, 14, 53, 16533 }, // ű
-    { 16, 19, 18, 1, 14, 76, 16586 }, // Ų
-    { 11, 14, 14, 2, 9, 39, 16662 }, // ų
-    { 20, 21, 25, 4, 21, 105, 16701 }, // Ŵ
-    { 15, 18, 19, 3, 16, 68, 16806 }, // ŵ
-    { 13, 22, 19, 5, 22, 72, 16874 }, // Ŷ
-    { 15, 22, 16, 0, 17, 83, 16946 }, // ŷ
-    { 13, 22, 19, 5, 22, 72, 17029 }, // Ÿ
-    { 17, 19, 19, 1, 19, 81, 17101 }, // Ź
-    { 13, 15, 15, 1, 15, 49, 17182 }, // ź
-    { 17, 19, 19, 1, 19, 81, 17231 }, // Ż
-    { 13, 15, 15, 1, 15, 49, 17312 }, // ż
-    { 17, 21, 19, 1, 21, 90, 17361 }, // Ž
-    { 15, 17, 17, 1, 17, 64, 17451 }, // ž
-    { 11, 15, 13, 1, 14, 42, 17515 }, // ſ
-    { 20, 17, 22, 1, 16, 85, 17557 }, // Ơ
-    { 14, 11, 16, 1, 11, 39, 17642 }, // ơ
-    { 15, 15, 16, 0, 15, 57, 17681 }, // Ƥ
-    { 15, 18, 16, -1, 13, 68, 17738 }, // ƥ
-    { 13, 14, 14, 0, 13, 46, 17806 }, // Ʃ
-    { 15, 14, 19, 3, 14, 53, 17852 }, // Ƭ
-    { 10, 16, 14, 3, 16, 40, 17905 }, // ƭ
-    { 14, 17, 19, 4, 14, 60, 17945 }, // Ʈ
-    { 18, 19, 20, 1, 18, 86, 18005 }, // Ư
-    { 14, 12, 17, 2, 12, 42, 18091 }, // ư
-    { 7, 4, 11, 3, 13, 7, 18133 }, // ̀
-    { 5, 4, 9, 3, 13, 5, 18140 }, // ́
-    { 10, 5, 10, -1, 1, 13, 18145 }, // ̂
-    { 8, 4, 12, 3, 12, 8, 18158 }, // ̃
-    { 10, 3, 14, 3, 12, 8, 18166 }, // ̄
-    { 12, 3, 17, 4, 15, 9, 18174 }, // ̅
-    { 9, 4, 13, 3, 12, 9, 18183 }, // ̆
-    { 5, 4, 9, 3, 14, 5, 18192 }, // ̇
-    { 9, 4, 12, 2, 13, 9, 18197 }, // ̈
-    { 4, 5, 11, 6, 11, 5, 18206 }, // ̉
-    { 5, 4, 9, 3, 13, 5, 18211 }, // ̊
-    { 14, 4, 18, 3, 13, 14, 18216 }, // ̋
-    { 10, 5, 14, 3, 13, 13, 18230 }, // ̌
-    { 14, 4, 9, -6, 13, 14, 18243 }, // ̏
-    { 7, 6, 10, 2, 13, 11, 18257 }, // ̒
-    { 7, 6, 10, 2, 13, 11, 18268 }, // ̓
-    { 8, 6, 5, -4, 13, 12, 18279 }, // ̔
-    { 5, 5, 6, 0, 0, 7, 18291 }, // ̘
-    { 6, 5, 7, 0, 0, 8, 18298 }, // ̙
-    { 8, 5, 13, 4, 14, 10, 18306 }, // ̚
-    { 5, 5, 8, 2, 11, 7, 18316 }, // ̛
-    { 4, 6, 4, -1, 0, 6, 18323 }, // ̜
-    { 5, 6, 7, 1, 4, 8, 18329 }, // ̝
-    { 5, 5, 5, -1, 0, 7, 18337 }, // ̞
-    { 4, 5, 5, 0, -1, 5, 18344 }, // ̟
-    { 10, 3, 10, -1, -2, 8, 18349 }, // ̠
-    { 5, 4, 4, -2, 2, 5, 18357 }, // ̣
-    { 9, 4, 8, -2, -1, 9, 18362 }, // ̤
-    { 5, 4, 9, 3, 13, 5, 18371 }, // ̥
-    { 8, 6, 8, -1, 3, 12, 18376 }, // ̦
-    { 6, 6, 6, -1, 1, 9, 18388 }, // ̧
-    { 5, 7, 6, 0, 2, 9, 18397 }, // ̨
-    { 5, 6, 5, -1, 0, 8, 18406 }, // ̩
-    { 8, 4, 8, -1, 0, 8, 18414 }, // ̪
-    { 11, 5, 11, -1, 1, 14, 18422 }, // ̬
-    { 11, 5, 11, -1, 1, 14, 18436 }, // ̭
-    { 8, 4, 13, 4, 14, 8, 18450 }, // ̰
-    { 9, 3, 14, 4, 14, 7, 18458 }, // ̱
-    { 9, 3, 9, -1, -1, 7, 18465 }, // ̲
-    { 9, 4, 14, 4, 14, 9, 18472 }, // ̴
-    { 10, 2, 12, 1, 6, 5, 18481 }, // ̵
-    { 4, 6, 6, 1, 0, 6, 18486 }, // ̹
-    { 10, 6, 8, -3, 1, 15, 18492 }, // ̺
-    { 8, 6, 8, -1, 1, 12, 18507 }, // ̻
-    { 8, 5, 8, -1, 1, 10, 18519 }, // ̼
-    { 6, 4, 10, 3, 13, 6, 18529 }, // ̽
-    { 8, 4, 12, 3, 12, 8, 18535 }, // ͂
-    { 4, 5, 12, 7, 15, 5, 18543 }, // ̓
-    { 10, 12, 14, 3, 21, 30, 18548 }, // ̈́
-    { 8, 4, 12, 3, 14, 8, 18578 }, // ͆
-    { 11, 7, 10, -2, 0, 20, 18586 }, // ͇
-    { 9, 5, 9, -1, 0, 12, 18606 }, // ͈
-    { 7, 6, 7, -1, 0, 11, 18618 }, // ͉
-    { 13, 14, 16, 2, 18, 46, 18629 }, // ͊
-    { 18, 13, 24, 5, 19, 59, 18675 }, // ͋
-    { 12, 9, 22, 9, 9, 27, 18734 }, // ͌
-    { 9, 19, 11, 1, 6, 43, 18761 }, // ͍
-    { 4, 3, 13, 8, 2, 3, 18804 }, // ͎
-    { 15, 5, 16, 0, 1, 19, 18807 }, // ͜
-    { 15, 5, 19, 3, 14, 19, 18826 }, // ͡
-    { 19, 6, 19, -1, 0, 29, 18845 }, // ͢
-    { 14, 14, 19, 1, 14, 49, 18874 }, // Α
-    { 14, 14, 16, 1, 14, 49, 18923 }, // Β
-    { 13, 15, 14, 0, 13, 49, 18972 }, // Γ
-    { 14, 14, 15, 0, 13, 49, 19021 }, // Δ
-    { 14, 14, 16, 1, 14, 49, 19070 }, // Ε
-    { 17, 14, 19, 1, 14, 60, 19119 }, // Ζ
-    { 16, 14, 18, 1, 14, 56, 19179 }, // Η
-    { 17, 15, 19, 1, 14, 64, 19235 }, // Θ
-    { 8, 14, 10, 1, 14, 28, 19299 }, // Ι
-    { 15, 14, 17, 1, 14, 53, 19327 }, // Κ
-    { 15, 14, 36, 20, 14, 53, 19380 }, // Λ
-    { 18, 14, 20, 1, 14, 63, 19433 }, // Μ
-    { 16, 14, 18, 1, 14, 56, 19496 }, // Ν
-    { 15, 14, 16, 0, 13, 53, 19552 }, // Ξ
-    { 17, 15, 19, 1, 14, 64, 19605 }, // Ο
-    { 13, 13, 14, 0, 12, 43, 19669 }, // Π
-    { 14, 15, 16, 1, 15, 53, 19712 }, // Ρ
-    { 13, 14, 14, 0, 13, 46, 19765 }, // Σ
-    { 14, 14, 19, 4, 14, 49, 19811 }, // Τ
-    { 13, 14, 19, 5, 14, 46, 19860 }, // Υ
-    { 20, 19, 24, 3, 16, 95, 19906 }, // Φ
-    { 17, 14, 19, 1, 14, 60, 20001 }, // Χ
-    { 15, 16, 18, 2, 14, 60, 20061 }, // Ψ
-    { 17, 15, 18, 0, 13, 64, 20121 }, // Ω
-    { 14, 11, 16, 1, 10, 39, 20185 }, // α
-    { 14, 20, 14, -1, 16, 70, 20224 }, // β
-    { 10, 15, 14, 3, 9, 38, 20294 }, // γ
-    { 13, 16, 15, 1, 15, 52, 20332 }, // δ
-    { 8, 9, 10, 1, 9, 18, 20384 }, // ε
-    { 11, 16, 13, 1, 13, 44, 20402 }, // ζ
-    { 12, 17, 14, 1, 11, 51, 20446 }, // η
-    { 12, 14, 14, 1, 13, 42, 20497 }, // θ
-    { 7, 12, 10, 0, 12, 21, 20539 }, // ι
-    { 10, 9, 12, -1, 9, 23, 20560 }, // κ
-    { 14, 14, 14, -13, 14, 49, 20583 }, // λ
-    { 14, 12, 14, -1, 9, 42, 20632 }, // μ
-    { 10, 11, 14, 3, 9, 28, 20674 }, // ν
-    { 10, 16, 13, 2, 13, 40, 20702 }, // ξ
-    { 12, 9, 14, 1, 9, 27, 20742 }, // ο
-    { 13, 10, 15, 1, 9, 33, 20769 }, // π
-    { 15, 14, 15, -1, 10, 53, 20802 }, // ρ
-    { 9, 13, 12, 2, 13, 30, 20855 }, // ς
-    { 15, 9, 17, 1, 9, 34, 20885 }, // σ
-    { 11, 10, 14, 2, 9, 28, 20919 }, // τ
-    { 10, 10, 12, 1, 9, 25, 20947 }, // υ
-    { 17, 22, 19, 1, 18, 94, 20972 }, // φ
-    { 16, 14, 16, -1, 10, 56, 21066 }, // χ
-    { 11, 20, 13, 1, 13, 55, 21122 }, // ψ
-    { 14, 11, 16, 1, 10, 39, 21177 }, // ω
-    { 14, 19, 19, 1, 14, 67, 21216 }, // Ạ
-    { 12, 16, 14, 0, 10, 48, 21283 }, // ạ
-    { 15, 20, 19, 1, 20, 75, 21331 }, // Ả
-    { 11, 16, 14, 1, 16, 44, 21406 }, // ả
-    { 16, 25, 19, 1, 25, 100, 21450 }, // Ấ
-    { 17, 18, 19, 1, 18, 77, 21550 }, // ấ
-    { 16, 22, 19, 1, 22, 88, 21627 }, // Ầ
-    { 12, 18, 14, 1, 18, 54, 21715 }, // ầ
-    { 16, 26, 19, 1, 26, 104, 21769 }, // Ẩ
-    { 16, 19, 18, 1, 19, 76, 21873 }, // ẩ
-    { 16, 24, 19, 1, 24, 96, 21949 }, // Ẫ
-    { 13, 19, 15, 1, 19, 62, 22045 }, // ẫ
-    { 15, 25, 19, 1, 20, 94, 22107 }, // Ậ
-    { 13, 21, 14, 0, 15, 69, 22201 }, // ậ
-    { 17, 25, 19, 1, 25, 107, 22270 }, // Ắ
-    { 14, 21, 16, 1, 21, 74, 22377 }, // ắ
-    { 17, 25, 19, 1, 25, 107, 22451 }, // Ằ
-    { 14, 21, 16, 1, 21, 74, 22558 }, // ằ
-    { 17, 26, 19, 1, 26, 111, 22632 }, // Ẳ
-    { 13, 22, 15, 1, 22, 72, 22743 }, // ẳ
-    { 17, 26, 19, 1, 26, 111, 22815 }, // Ẵ
-    { 14, 21, 16, 1, 21, 74, 22926 }, // ẵ
-    { 17, 25, 19, 1, 20, 107, 23000 }, // Ặ
-    { 15, 21, 16, 0, 15, 79, 23107 }, // ặ
-    { 15, 21, 16, 0, 14, 79, 23186 }, // Ẹ
-    { 13, 16, 14, 0, 9, 52, 23265 }, // ẹ
-    { 14, 21, 16, 1, 21, 74, 23317 }, // Ẻ
-    { 12, 17, 14, 1, 17, 51, 23391 }, // ẻ
-    { 14, 21, 16, 1, 21, 74, 23442 }, // Ẽ
-    { 13, 17, 15, 1, 17, 56, 23516 }, // ẽ
-    { 17, 23, 19, 1, 23, 98, 23572 }, // Ế
-    { 19, 17, 21, 1, 17, 81, 23670 }, // ế
-    { 18, 22, 20, 1, 22, 99, 23751 }, // Ề
-    { 13, 19, 15, 1, 19, 62, 23850 }, // ề
-    { 17, 23, 19, 1, 23, 98, 23912 }, // Ể
-    { 17, 20, 19, 1, 20, 85, 24010 }, // ể
-    { 15, 24, 17, 1, 24, 90, 24095 }, // Ễ
-    { 15, 21, 17, 1, 21, 79, 24185 }, // ễ
-    { 15, 27, 16, 0, 20, 102, 24264 }, // Ệ
-    { 14, 24, 15, 0, 17, 84, 24366 }, // ệ
-    { 10, 21, 12, 1, 21, 53, 24450 }, // Ỉ
-    { 8, 15, 9, 0, 15, 30, 24503 }, // ỉ
-    { 12, 21, 10, -3, 14, 63, 24533 }, // Ị
-    { 11, 22, 10, -2, 15, 61, 24596 }, // ị
-    { 17, 22, 19, 1, 14, 94, 24657 }, // Ọ
-    { 13, 16, 14, 0, 9, 52, 24751 }, // ọ
-    { 17, 21, 19, 1, 20, 90, 24803 }, // Ỏ
-    { 12, 15, 14, 1, 15, 45, 24893 }, // ỏ
-    { 20, 21, 22, 1, 20, 105, 24938 }, // Ố
-    { 18, 16, 20, 1, 16, 72, 25043 }, // ố
-    { 17, 22, 19, 1, 21, 94, 25115 }, // Ồ
-    { 12, 17, 14, 1, 17, 51, 25209 }, // ồ
-    { 17, 23, 19, 1, 22, 98, 25260 }, // Ổ
-    { 16, 18, 18, 1, 18, 72, 25358 }, // ổ
-    { 17, 25, 19, 1, 24, 107, 25430 }, // Ỗ
-    { 13, 19, 15, 1, 19, 62, 25537 }, // ỗ
-    { 17, 28, 19, 1, 20, 119, 25599 }, // Ộ
-    { 12, 22, 14, 1, 15, 66, 25718 }, // ộ
-    { 20, 21, 22, 1, 20, 105, 25784 }, // Ớ
-    { 14, 15, 16, 1, 15, 53, 25889 }, // ớ
-    { 20, 21, 22, 1, 20, 105, 25942 }, // Ờ
-    { 14, 15, 16, 1, 15, 53, 26047 }, // ờ
-    { 20, 21, 22, 1, 20, 105, 26100 }, // Ở
-    { 14, 15, 16, 1, 15, 53, 26205 }, // ở
-    { 20, 21, 22, 1, 20, 105, 26258 }, // Ỡ
-    { 14, 16, 16, 1, 16, 56, 26363 }, // ỡ
-    { 20, 24, 22, 1, 16, 120, 26419 }, // Ợ
-    { 15, 18, 16, 0, 11, 68, 26539 }, // ợ
-    { 16, 22, 18, 1, 14, 88, 26607 }, // Ụ
-    { 13, 17, 14, 0, 9, 56, 26695 }, // ụ
-    { 16, 22, 18, 1, 21, 88, 26751 }, // Ủ
-    { 11, 15, 14, 2, 15, 42, 26839 }, // ủ
-    { 18, 22, 20, 1, 21, 99, 26881 }, // Ứ
-    { 14, 15, 17, 2, 15, 53, 26980 }, // ứ
-    { 18, 22, 20, 1, 21, 99, 27033 }, // Ừ
-    { 14, 15, 17, 2, 15, 53, 27132 }, // ừ
-    { 18, 22, 20, 1, 21, 99, 27185 }, // Ử
-    { 14, 15, 17, 2, 15, 53, 27284 }, // ử
-    { 18, 22, 20, 1, 21, 99, 27337 }, // Ữ
-    { 14, 15, 17, 2, 15, 53, 27436 }, // ữ
-    { 18, 26, 20, 1, 18, 117, 27489 }, // Ự
-    { 16, 20, 17, 0, 12, 80, 27606 }, // ự
-    { 13, 21, 19, 5, 21, 69, 27686 }, // Ỳ
-    { 15, 21, 16, 0, 16, 79, 27755 }, // ỳ
-    { 17, 23, 19, 1, 14, 98, 27834 }, // Ỵ
-    { 15, 16, 16, 0, 9, 60, 27932 }, // ỵ
-    { 13, 23, 19, 5, 23, 75, 27992 }, // Ỷ
-    { 15, 23, 16, 0, 18, 87, 28067 }, // ỷ
-    { 13, 23, 19, 5, 23, 75, 28154 }, // Ỹ
-    { 15, 22, 16, 0, 17, 83, 28229 }, // ỹ
-    { 0, 0, 11, 0, 0, 0, 28312 }, //  
-    { 0, 0, 19, 0, 0, 0, 28312 }, //  
-    { 0, 0, 11, 0, 0, 0, 28312 }, //  
-    { 0, 0, 19, 0, 0, 0, 28312 }, //  
-    { 0, 0, 8, 0, 0, 0, 28312 }, //  
-    { 0, 0, 7, 0, 0, 0, 28312 }, //  
-    { 0, 0, 5, 0, 0, 0, 28312 }, //  
-    { 0, 0, 12, 0, 0, 0, 28312 }, //  
-    { 0, 0, 4, 0, 0, 0, 28312 }, //  
-    { 0, 0, 6, 0, 0, 0, 28312 }, //  
-    { 0, 0, 5, 0, 0, 0, 28312 }, //  
-    { 0, 0, 3, 0, 0, 0, 28312 }, // ​
-    { 0, 0, 1, 0, 0, 0, 28312 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 28312 }, // ‍
-    { 0, 0, 1, 0, 0, 0, 28312 }, // ‎
-    { 0, 0, 1, 0, 0, 0, 28312 }, // ‏
-    { 10, 2, 12, 1, 6, 5, 28312 }, // ‐
-    { 10, 2, 12, 1, 6, 5, 28317 }, // ‑
-    { 15, 2, 15, -1, 6, 8, 28322 }, // ‒
-    { 14, 4, 16, 1, 7, 14, 28330 }, // –
-    { 19, 4, 21, 1, 7, 19, 28344 }, // —
-    { 19, 4, 21, 1, 7, 19, 28363 }, // ―
-    { 12, 16, 14, 1, 13, 48, 28382 }, // ‖
-    { 16, 6, 13, -4, -1, 24, 28430 }, // ‗
-    { 8, 6, 12, 3, 15, 12, 28454 }, // ‘
-    { 8, 6, 12, 3, 15, 12, 28466 }, // ’
-    { 7, 6, 7, -1, 3, 11, 28478 }, // ‚
-    { 8, 6, 12, 3, 15, 12, 28489 }, // ‛
-    { 13, 6, 17, 3, 15, 20, 28501 }, // “
-    { 13, 6, 17, 3, 15, 20, 28521 }, // ”
-    { 7, 6, 7, -1, 3, 11, 28541 }, // „
-    { 13, 6, 17, 3, 15, 20, 28552 }, // ‟
-    { 10, 24, 15, 4, 18, 60, 28572 }, // †
-    { 12, 23, 16, 3, 17, 69, 28632 }, // ‡
-    { 15, 13, 14, -2, 15, 49, 28701 }, // •
-    { 6, 7, 10, 3, 8, 11, 28750 }, // ‣
-    { 5, 4, 10, 3, 4, 5, 28761 }, // ․
-    { 5, 4, 10, 3, 4, 5, 28766 }, // ‥
-    { 16, 4, 17, 0, 4, 16, 28771 }, // …
-    { 3, 2, 9, 3, 6, 2, 28787 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 28789 }, //  
-    { 16, 15, 19, 2, 13, 60, 28789 }, // ‰
-    { 8, 6, 14, 5, 15, 12, 28849 }, // ′
-    { 13, 6, 19, 5, 15, 20, 28861 }, // ″
-    { 13, 6, 12, -2, 14, 20, 28881 }, // ‴
-    { 5, 6, 10, 4, 14, 8, 28901 }, // ‵
-    { 8, 6, 12, 3, 14, 12, 28909 }, // ‶
-    { 13, 6, 14, 0, 14, 20, 28921 }, // ‷
-    { 10, 4, 14, 3, 14, 10, 28941 }, // ‸
-    { 7, 10, 10, 2, 10, 18, 28951 }, // ‹
-    { 7, 10, 7, -2, 10, 18, 28969 }, // ›
-    { 22, 22, 24, 1, 17, 121, 28987 }, // ※
-    { 10, 22, 12, 1, 19, 55, 29108 }, // ‼
-    { 13, 27, 17, 3, 23, 88, 29163 }, // ‽
-    { 10, 2, 14, 3, 14, 5, 29251 }, // ‾
-    { 9, 4, 13, 3, 11, 9, 29256 }, // ‿
-    { 13, 12, 15, 1, 15, 39, 29265 }, // ⁂
-    { 16, 15, 22, 3, 13, 60, 29304 }, // ⁄
-    { 23, 21, 28, 4, 19, 121, 29364 }, // ⁇
-    { 20, 22, 24, 3, 19, 110, 29485 }, // ⁈
-    { 18, 22, 18, -1, 19, 99, 29595 }, // ⁉
-    { 19, 29, 19, -1, 20, 138, 29694 }, // ⁒
-    { 0, 0, 78, 0, 0, 0, 29832 }, //  
-    { 6, 7, 13, 6, 14, 11, 29832 }, // ⁰
-    { 6, 6, 13, 6, 14, 9, 29843 }, // ⁴
-    { 6, 8, 13, 6, 14, 12, 29852 }, // ⁵
-    { 6, 7, 13, 6, 14, 11, 29864 }, // ⁶
-    { 6, 8, 14, 7, 15, 12, 29875 }, // ⁷
-    { 6, 7, 13, 6, 14, 11, 29887 }, // ⁸
-    { 6, 8, 13, 6, 14, 12, 29898 }, // ⁹
-    { 12, 10, 14, 1, 10, 30, 29910 }, // ⁿ
-    { 6, 7, 6, -5, 4, 11, 29940 }, // ₀
-    { 6, 7, 6, -6, 4, 11, 29951 }, // ₁
-    { 7, 7, 6, -6, 4, 13, 29962 }, // ₂
-    { 7, 7, 6, -6, 4, 13, 29975 }, // ₃
-    { 6, 7, 6, -5, 4, 11, 29988 }, // ₄
-    { 6, 8, 6, -5, 5, 12, 29999 }, // ₅
-    { 7, 7, 6, -6, 4, 13, 30011 }, // ₆
-    { 6, 8, 6, -4, 5, 12, 30024 }, // ₇
-    { 6, 7, 6, -5, 4, 11, 30036 }, // ₈
-    { 6, 8, 6, -5, 4, 12, 30047 }, // ₉
-    { 12, 23, 14, 1, 17, 69, 30059 }, // ₍
-    { 11, 23, 7, -5, 17, 64, 30128 }, // ₎
-    { 16, 22, 19, 2, 18, 88, 30192 }, // ₡
-    { 15, 15, 17, 1, 15, 57, 30280 }, // ₢
-    { 13, 14, 14, 0, 13, 46, 30337 }, // ₤
-    { 20, 14, 20, -1, 14, 70, 30383 }, // ₦
-    { 16, 15, 18, 1, 15, 60, 30453 }, // ₧
-    { 21, 15, 22, -1, 14, 79, 30513 }, // ₨
-    { 15, 14, 15, -1, 14, 53, 30592 }, // ₩
-    { 17, 13, 20, 2, 13, 56, 30645 }, // ₪
-    { 15, 14, 15, -1, 13, 53, 30701 }, // ₫
-    { 14, 17, 16, 1, 14, 60, 30754 }, // €
-    { 14, 14, 19, 4, 14, 49, 30814 }, // ₮
-    { 18, 15, 19, 0, 15, 68, 30863 }, // ₱
-    { 16, 22, 19, 1, 19, 88, 30931 }, // ₲
-    { 19, 15, 25, 5, 14, 72, 31019 }, // ₴
-    { 10, 13, 12, 1, 11, 33, 31091 }, // ₵
-    { 16, 16, 21, 4, 16, 64, 31124 }, // ₸
-    { 12, 13, 15, 2, 12, 39, 31188 }, // ₹
-    { 11, 13, 13, 1, 11, 36, 31227 }, // ₺
-    { 14, 15, 17, 2, 14, 53, 31263 }, // ₼
-    { 17, 15, 16, -2, 15, 64, 31316 }, // ₽
-    { 12, 12, 12, -3, 9, 36, 31380 }, // ←
-    { 12, 12, 15, 2, 10, 36, 31416 }, // ↑
-    { 12, 12, 16, 3, 9, 36, 31452 }, // →
-    { 13, 12, 18, 4, 11, 39, 31488 }, // ↓
-    { 19, 10, 19, -1, 8, 48, 31527 }, // ↔
-    { 10, 19, 14, 3, 18, 48, 31575 }, // ↕
-    { 11, 8, 13, -1, 8, 22, 31623 }, // ↖
-    { 11, 8, 14, 2, 8, 22, 31645 }, // ↗
-    { 10, 11, 14, 3, 9, 28, 31667 }, // ↘
-    { 10, 11, 11, -2, 9, 28, 31695 }, // ↙
-    { 14, 11, 16, 0, 10, 39, 31723 }, // ⇐
-    { 15, 14, 19, 3, 13, 53, 31762 }, // ⇑
-    { 14, 11, 17, 2, 10, 39, 31815 }, // ⇒
-    { 15, 14, 22, 6, 13, 53, 31854 }, // ⇓
-    { 18, 11, 19, 0, 10, 50, 31907 }, // ⇔
-    { 12, 17, 17, 4, 9, 51, 31957 }, // ⇕
-    { 13, 16, 15, 1, 15, 52, 32008 }, // ∂
-    { 18, 16, 19, 0, 15, 72, 32060 }, // ∅
-    { 14, 14, 15, 0, 13, 49, 32132 }, // ∆
-    { 13, 14, 16, 2, 13, 46, 32181 }, // ∏
-    { 13, 14, 19, 5, 13, 46, 32227 }, // ∐
-    { 13, 14, 14, 0, 13, 46, 32273 }, // ∑
-    { 10, 3, 12, 1, 6, 8, 32319 }, // −
-    { 17, 15, 20, 2, 14, 64, 32327 }, // √
-    { 16, 10, 18, 1, 11, 40, 32391 }, // ∞
-    { 17, 18, 18, 0, 13, 77, 32431 }, // ∫
-    { 8, 12, 9, 0, 12, 24, 32508 }, // ∶
-    { 12, 9, 24, 9, 9, 27, 32532 }, // ≈
-    { 16, 15, 22, 3, 14, 60, 32559 }, // ≠
-    { 16, 15, 15, -2, 13, 60, 32619 }, // ≤
-    { 16, 14, 17, 0, 12, 56, 32679 }, // ≥
+    { 10, 22, 10, -1, 19, 32, 0 }, // !
+    { 12, 6, 14, 1, 15, 20, 32 }, // "
+    { 21, 15, 22, 0, 13, 59, 52 }, // #
+    { 15, 20, 19, 2, 17, 52, 111 }, // $
+    { 16, 15, 20, 3, 13, 55, 163 }, // %
+    { 14, 15, 17, 2, 14, 42, 218 }, // &
+    { 5, 6, 9, 3, 13, 9, 260 }, // '
+    { 12, 23, 14, 1, 17, 42, 269 }, // (
+    { 11, 23, 7, -5, 17, 37, 311 }, // )
+    { 11, 10, 14, 2, 13, 22, 348 }, // *
+    { 10, 10, 12, 1, 10, 16, 370 }, // +
+    { 7, 6, 7, -1, 3, 11, 386 }, // ,
+    { 10, 2, 12, 1, 6, 4, 397 }, // -
+    { 5, 4, 6, 0, 4, 7, 401 }, // .
+    { 20, 29, 18, -3, 20, 65, 408 }, // /
+    { 12, 14, 14, 1, 13, 41, 473 }, // 0
+    { 10, 13, 12, 0, 13, 22, 514 }, // 1
+    { 13, 13, 14, 0, 13, 27, 536 }, // 2
+    { 13, 13, 14, 0, 13, 32, 563 }, // 3
+    { 11, 14, 14, 1, 13, 32, 595 }, // 4
+    { 12, 15, 13, 0, 14, 32, 627 }, // 5
+    { 12, 13, 14, 1, 13, 35, 659 }, // 6
+    { 10, 13, 14, 3, 13, 19, 694 }, // 7
+    { 13, 14, 14, 0, 13, 39, 713 }, // 8
+    { 12, 14, 14, 1, 13, 35, 752 }, // 9
+    { 7, 12, 8, 0, 12, 16, 787 }, // :
+    { 9, 15, 9, -1, 11, 19, 803 }, // ;
+    { 15, 11, 14, -2, 11, 27, 822 }, // <
+    { 11, 7, 12, 0, 8, 15, 849 }, // =
+    { 15, 11, 16, 0, 11, 28, 864 }, // >
+    { 13, 21, 16, 2, 19, 41, 892 }, // ?
+    { 18, 16, 19, 0, 14, 57, 933 }, // @
+    { 14, 14, 19, 1, 14, 35, 990 }, // A
+    { 14, 14, 16, 1, 14, 42, 1025 }, // B
+    { 15, 15, 17, 1, 15, 35, 1067 }, // C
+    { 16, 14, 18, 1, 14, 42, 1102 }, // D
+    { 14, 14, 16, 1, 14, 36, 1144 }, // E
+    { 13, 14, 15, 1, 14, 33, 1180 }, // F
+    { 16, 15, 19, 1, 15, 46, 1213 }, // G
+    { 16, 14, 18, 1, 14, 43, 1259 }, // H
+    { 8, 14, 10, 1, 14, 21, 1302 }, // I
+    { 15, 18, 16, 0, 14, 39, 1323 }, // J
+    { 15, 14, 17, 1, 14, 37, 1362 }, // K
+    { 11, 14, 15, 1, 14, 28, 1399 }, // L
+    { 18, 14, 20, 1, 14, 56, 1427 }, // M
+    { 16, 14, 18, 1, 14, 49, 1483 }, // N
+    { 17, 15, 19, 1, 14, 43, 1532 }, // O
+    { 14, 15, 16, 1, 15, 37, 1575 }, // P
+    { 17, 18, 19, 1, 15, 52, 1612 }, // Q
+    { 13, 15, 16, 1, 14, 37, 1664 }, // R
+    { 15, 15, 17, 1, 15, 37, 1701 }, // S
+    { 14, 14, 19, 4, 14, 30, 1738 }, // T
+    { 16, 15, 18, 1, 14, 42, 1768 }, // U
+    { 14, 14, 20, 5, 14, 37, 1810 }, // V
+    { 20, 15, 25, 4, 15, 58, 1847 }, // W
+    { 17, 14, 19, 1, 14, 38, 1905 }, // X
+    { 13, 14, 19, 5, 14, 33, 1943 }, // Y
+    { 17, 14, 19, 1, 14, 38, 1976 }, // Z
+    { 13, 25, 13, -1, 18, 49, 2014 }, // [
+    { 4, 19, 8, 3, 15, 23, 2063 }, // <backslash>
+    { 13, 25, 10, -4, 18, 48, 2086 }, // ]
+    { 10, 5, 13, 2, 16, 10, 2134 }, // ^
+    { 14, 4, 13, -2, 0, 12, 2144 }, // _
+    { 7, 4, 11, 3, 13, 6, 2156 }, // `
+    { 11, 10, 14, 1, 10, 26, 2162 }, // a
+    { 11, 16, 14, 2, 15, 35, 2188 }, // b
+    { 10, 10, 13, 1, 10, 20, 2223 }, // c
+    { 14, 14, 16, 1, 14, 38, 2243 }, // d
+    { 12, 9, 14, 1, 9, 26, 2281 }, // e
+    { 10, 14, 13, 2, 14, 23, 2307 }, // f
+    { 14, 14, 15, 0, 9, 39, 2330 }, // g
+    { 12, 14, 15, 1, 14, 34, 2369 }, // h
+    { 9, 15, 10, 0, 15, 20, 2403 }, // i
+    { 11, 20, 13, 1, 15, 31, 2423 }, // j
+    { 11, 14, 15, 1, 14, 28, 2454 }, // k
+    { 8, 14, 10, 1, 14, 23, 2482 }, // l
+    { 18, 10, 20, 1, 10, 41, 2505 }, // m
+    { 12, 10, 14, 1, 10, 27, 2546 }, // n
+    { 12, 9, 14, 1, 9, 25, 2573 }, // o
+    { 15, 15, 16, -1, 10, 38, 2598 }, // p
+    { 13, 15, 16, 1, 10, 37, 2636 }, // q
+    { 10, 9, 12, 1, 9, 19, 2673 }, // r
+    { 11, 11, 14, 1, 10, 21, 2692 }, // s
+    { 9, 13, 13, 3, 13, 22, 2713 }, // t
+    { 11, 9, 14, 2, 9, 25, 2735 }, // u
+    { 13, 9, 17, 3, 9, 22, 2760 }, // v
+    { 15, 11, 19, 3, 9, 31, 2782 }, // w
+    { 14, 9, 16, 1, 9, 23, 2813 }, // x
+    { 15, 14, 16, 0, 9, 34, 2836 }, // y
+    { 13, 9, 15, 1, 9, 18, 2870 }, // z
+    { 12, 17, 14, 1, 13, 30, 2888 }, // {
+    { 7, 16, 9, 1, 13, 25, 2918 }, // |
+    { 11, 17, 12, -1, 13, 30, 2943 }, // }
+    { 8, 4, 12, 3, 12, 12, 2973 }, // ~
+    { 0, 0, 14, 0, 0, 0, 2985 }, //  
+    { 9, 22, 12, 2, 19, 32, 2985 }, // ¡
+    { 10, 15, 13, 1, 12, 32, 3017 }, // ¢
+    { 13, 15, 14, 0, 14, 38, 3049 }, // £
+    { 12, 10, 14, 1, 11, 22, 3087 }, // ¤
+    { 15, 16, 17, 1, 13, 35, 3109 }, // ¥
+    { 7, 15, 9, 1, 12, 20, 3144 }, // ¦
+    { 14, 14, 15, 0, 13, 39, 3164 }, // §
+    { 9, 4, 13, 3, 14, 13, 3203 }, // ¨
+    { 10, 7, 15, 4, 16, 21, 3216 }, // ©
+    { 6, 6, 12, 5, 13, 12, 3237 }, // ª
+    { 12, 10, 14, 1, 10, 28, 3249 }, // «
+    { 10, 6, 12, 1, 6, 15, 3277 }, // ¬
+    { 10, 2, 12, 1, 6, 5, 3292 }, // ­
+    { 9, 7, 15, 5, 18, 20, 3297 }, // ®
+    { 8, 3, 12, 3, 13, 7, 3317 }, // ¯
+    { 10, 8, 14, 3, 13, 19, 3324 }, // °
+    { 13, 12, 14, 0, 9, 23, 3343 }, // ±
+    { 6, 7, 13, 6, 14, 12, 3366 }, // ²
+    { 6, 7, 13, 6, 14, 12, 3378 }, // ³
+    { 5, 4, 9, 3, 13, 6, 3390 }, // ´
+    { 14, 12, 14, -1, 9, 31, 3396 }, // µ
+    { 13, 15, 15, 1, 12, 46, 3427 }, // ¶
+    { 5, 4, 7, 1, 8, 8, 3473 }, // ·
+    { 6, 6, 6, -1, 1, 10, 3481 }, // ¸
+    { 5, 7, 12, 6, 14, 11, 3491 }, // ¹
+    { 7, 6, 13, 5, 13, 11, 3502 }, // º
+    { 12, 10, 12, -3, 10, 27, 3513 }, // »
+    { 18, 17, 22, 1, 15, 55, 3540 }, // ¼
+    { 19, 17, 22, 1, 15, 55, 3595 }, // ½
+    { 18, 15, 22, 1, 13, 54, 3650 }, // ¾
+    { 12, 21, 12, -1, 12, 37, 3704 }, // ¿
+    { 14, 19, 19, 1, 19, 42, 3741 }, // À
+    { 15, 22, 19, 1, 22, 48, 3783 }, // Á
+    { 15, 20, 19, 1, 20, 48, 3831 }, // Â
+    { 15, 19, 19, 1, 19, 50, 3879 }, // Ã
+    { 16, 20, 19, 1, 20, 53, 3929 }, // Ä
+    { 15, 20, 19, 1, 20, 47, 3982 }, // Å
+    { 23, 15, 25, 1, 14, 56, 4029 }, // Æ
+    { 15, 19, 17, 1, 15, 46, 4085 }, // Ç
+    { 14, 19, 16, 1, 19, 44, 4131 }, // È
+    { 14, 22, 16, 1, 22, 47, 4175 }, // É
+    { 14, 20, 16, 1, 20, 48, 4222 }, // Ê
+    { 15, 20, 17, 1, 20, 51, 4270 }, // Ë
+    { 10, 20, 12, 1, 20, 29, 4321 }, // Ì
+    { 11, 23, 13, 1, 23, 31, 4350 }, // Í
+    { 11, 21, 13, 1, 21, 32, 4381 }, // Î
+    { 12, 21, 14, 1, 21, 38, 4413 }, // Ï
+    { 17, 14, 18, 0, 14, 43, 4451 }, // Ð
+    { 16, 19, 18, 1, 19, 62, 4494 }, // Ñ
+    { 17, 20, 19, 1, 19, 50, 4556 }, // Ò
+    { 17, 23, 19, 1, 22, 56, 4606 }, // Ó
+    { 17, 21, 19, 1, 20, 56, 4662 }, // Ô
+    { 17, 20, 19, 1, 19, 59, 4718 }, // Õ
+    { 17, 21, 19, 1, 20, 60, 4777 }, // Ö
+    { 11, 6, 12, 0, 7, 15, 4837 }, // ×
+    { 34, 30, 28, -7, 22, 115, 4852 }, // Ø
+    { 16, 21, 18, 1, 20, 51, 4967 }, // Ù
+    { 16, 24, 18, 1, 23, 55, 5018 }, // Ú
+    { 16, 22, 18, 1, 21, 55, 5073 }, // Û
+    { 16, 22, 18, 1, 21, 58, 5128 }, // Ü
+    { 13, 24, 19, 5, 24, 47, 5186 }, // Ý
+    { 11, 14, 12, 0, 14, 29, 5233 }, // Þ
+    { 13, 14, 14, 0, 13, 41, 5262 }, // ß
+    { 11, 14, 14, 1, 14, 31, 5303 }, // à
+    { 12, 17, 14, 1, 17, 37, 5334 }, // á
+    { 12, 15, 14, 1, 15, 35, 5371 }, // â
+    { 12, 15, 14, 1, 15, 38, 5406 }, // ã
+    { 13, 15, 15, 1, 15, 40, 5444 }, // ä
+    { 11, 16, 14, 1, 16, 37, 5484 }, // å
+    { 18, 10, 21, 1, 10, 38, 5521 }, // æ
+    { 10, 14, 13, 1, 10, 27, 5559 }, // ç
+    { 12, 16, 14, 1, 16, 35, 5586 }, // è
+    { 13, 19, 15, 1, 19, 39, 5621 }, // é
+    { 13, 17, 15, 1, 17, 38, 5660 }, // ê
+    { 14, 17, 16, 1, 17, 42, 5698 }, // ë
+    { 8, 14, 9, 0, 14, 18, 5740 }, // ì
+    { 9, 17, 10, 0, 17, 22, 5758 }, // í
+    { 10, 15, 10, -1, 15, 25, 5780 }, // î
+    { 10, 14, 11, 0, 14, 23, 5805 }, // ï
+    { 16, 16, 17, 0, 15, 39, 5828 }, // ð
+    { 13, 15, 15, 1, 15, 40, 5867 }, // ñ
+    { 12, 14, 14, 1, 14, 32, 5907 }, // ò
+    { 12, 17, 14, 1, 17, 36, 5939 }, // ó
+    { 12, 15, 14, 1, 15, 36, 5975 }, // ô
+    { 12, 14, 14, 1, 14, 38, 6011 }, // õ
+    { 13, 15, 15, 1, 15, 40, 6049 }, // ö
+    { 13, 12, 17, 3, 12, 23, 6089 }, // ÷
+    { 19, 28, 18, -2, 19, 66, 6112 }, // ø
+    { 11, 14, 14, 2, 14, 32, 6178 }, // ù
+    { 11, 17, 14, 2, 17, 34, 6210 }, // ú
+    { 11, 15, 14, 2, 15, 35, 6244 }, // û
+    { 12, 15, 15, 2, 15, 40, 6279 }, // ü
+    { 15, 24, 16, 0, 19, 49, 6319 }, // ý
+    { 11, 18, 12, 0, 14, 39, 6368 }, // þ
+    { 16, 22, 17, 0, 17, 54, 6407 }, // ÿ
+    { 17, 20, 19, 1, 20, 47, 6461 }, // Ā
+    { 13, 15, 15, 1, 15, 40, 6508 }, // ā
+    { 17, 20, 19, 1, 20, 51, 6548 }, // Ă
+    { 14, 15, 16, 1, 15, 38, 6599 }, // ă
+    { 14, 19, 19, 1, 14, 45, 6637 }, // Ą
+    { 11, 15, 14, 1, 10, 33, 6682 }, // ą
+    { 15, 20, 17, 1, 20, 44, 6715 }, // Ć
+    { 11, 14, 13, 1, 14, 26, 6759 }, // ć
+    { 16, 21, 18, 1, 21, 48, 6785 }, // Ĉ
+    { 13, 15, 15, 1, 15, 33, 6833 }, // ĉ
+    { 15, 20, 17, 1, 20, 44, 6866 }, // Ċ
+    { 11, 14, 13, 1, 14, 27, 6910 }, // ċ
+    { 17, 21, 19, 1, 21, 49, 6937 }, // Č
+    { 14, 15, 16, 1, 15, 35, 6986 }, // č
+    { 16, 21, 18, 1, 21, 57, 7021 }, // Ď
+    { 17, 14, 19, 1, 14, 45, 7078 }, // ď
+    { 17, 14, 18, 0, 14, 43, 7123 }, // Đ
+    { 16, 14, 18, 1, 14, 41, 7166 }, // đ
+    { 15, 20, 17, 1, 20, 49, 7207 }, // Ē
+    { 14, 17, 16, 1, 17, 38, 7256 }, // ē
+    { 15, 20, 17, 1, 20, 49, 7294 }, // Ĕ
+    { 14, 17, 16, 1, 17, 40, 7343 }, // ĕ
+    { 14, 20, 16, 1, 20, 47, 7383 }, // Ė
+    { 12, 17, 14, 1, 17, 36, 7430 }, // ė
+    { 14, 19, 16, 1, 14, 44, 7466 }, // Ę
+    { 12, 16, 14, 1, 9, 37, 7510 }, // ę
+    { 16, 22, 18, 1, 22, 52, 7547 }, // Ě
+    { 15, 18, 17, 1, 18, 41, 7599 }, // ě
+    { 18, 23, 20, 1, 23, 62, 7640 }, // Ĝ
+    { 15, 21, 16, 0, 16, 52, 7702 }, // ĝ
+    { 18, 22, 20, 1, 22, 62, 7754 }, // Ğ
+    { 16, 20, 17, 0, 15, 54, 7816 }, // ğ
+    { 16, 22, 19, 1, 22, 59, 7870 }, // Ġ
+    { 14, 20, 15, 0, 15, 50, 7929 }, // ġ
+    { 17, 25, 19, 1, 25, 64, 7979 }, // Ģ
+    { 14, 21, 15, 0, 16, 53, 8043 }, // ģ
+    { 16, 21, 18, 1, 21, 57, 8096 }, // Ĥ
+    { 12, 20, 15, 1, 20, 46, 8153 }, // ĥ
+    { 16, 14, 18, 1, 14, 46, 8199 }, // Ħ
+    { 12, 14, 15, 1, 14, 37, 8245 }, // ħ
+    { 11, 21, 13, 1, 21, 34, 8282 }, // Ĩ
+    { 10, 15, 11, 0, 15, 27, 8316 }, // ĩ
+    { 12, 21, 14, 1, 21, 33, 8343 }, // Ī
+    { 10, 15, 11, 0, 15, 22, 8376 }, // ī
+    { 10, 19, 10, -1, 14, 28, 8398 }, // Į
+    { 11, 20, 10, -2, 15, 28, 8426 }, // į
+    { 10, 21, 12, 1, 21, 30, 8454 }, // İ
+    { 6, 9, 7, 0, 9, 14, 8484 }, // ı
+    { 18, 21, 26, 4, 14, 61, 8498 }, // Ĳ
+    { 17, 19, 18, 0, 15, 50, 8559 }, // ĳ
+    { 17, 25, 18, 0, 21, 55, 8609 }, // Ĵ
+    { 14, 22, 16, 1, 17, 41, 8664 }, // ĵ
+    { 15, 23, 17, 1, 23, 53, 8705 }, // Ķ
+    { 13, 23, 15, -1, 14, 44, 8758 }, // ķ
+    { 10, 9, 11, -2, 9, 21, 8802 }, // ĸ
+    { 11, 19, 15, 1, 19, 35, 8823 }, // Ĺ
+    { 10, 21, 12, 1, 21, 31, 8858 }, // ĺ
+    { 12, 23, 15, 0, 14, 43, 8889 }, // Ļ
+    { 11, 23, 10, -2, 14, 35, 8932 }, // ļ
+    { 12, 14, 15, 1, 14, 37, 8967 }, // Ľ
+    { 13, 17, 15, 1, 17, 37, 9004 }, // ľ
+    { 13, 14, 15, 1, 14, 38, 9041 }, // Ŀ
+    { 10, 14, 12, 1, 14, 29, 9079 }, // ŀ
+    { 26, 24, 19, -8, 19, 69, 9108 }, // Ł
+    { 18, 14, 13, -6, 14, 35, 9177 }, // ł
+    { 16, 20, 18, 1, 20, 59, 9212 }, // Ń
+    { 12, 16, 14, 1, 16, 36, 9271 }, // ń
+    { 16, 21, 18, 1, 14, 62, 9307 }, // Ņ
+    { 12, 17, 14, 1, 10, 39, 9369 }, // ņ
+    { 17, 21, 19, 1, 21, 63, 9408 }, // Ň
+    { 15, 17, 17, 1, 17, 41, 9471 }, // ň
+    { 23, 17, 14, -10, 17, 48, 9512 }, // ŉ
+    { 16, 18, 18, 1, 14, 56, 9560 }, // Ŋ
+    { 12, 14, 14, 1, 10, 33, 9616 }, // ŋ
+    { 17, 21, 19, 1, 20, 53, 9649 }, // Ō
+    { 13, 15, 15, 1, 15, 34, 9702 }, // ō
+    { 17, 21, 19, 1, 20, 57, 9736 }, // Ŏ
+    { 14, 15, 16, 1, 15, 37, 9793 }, // ŏ
+    { 19, 20, 21, 1, 19, 58, 9830 }, // Ő
+    { 16, 14, 18, 1, 14, 37, 9888 }, // ő
+    { 24, 15, 26, 1, 14, 57, 9925 }, // Œ
+    { 19, 9, 21, 1, 9, 41, 9982 }, // œ
+    { 13, 20, 16, 1, 19, 45, 10023 }, // Ŕ
+    { 10, 13, 12, 1, 13, 26, 10068 }, // ŕ
+    { 13, 24, 16, 1, 23, 51, 10094 }, // Ŗ
+    { 10, 17, 12, 1, 17, 31, 10145 }, // ŗ
+    { 15, 22, 17, 1, 21, 51, 10176 }, // Ř
+    { 12, 15, 14, 1, 15, 32, 10227 }, // ř
+    { 15, 20, 17, 1, 20, 47, 10259 }, // Ś
+    { 11, 15, 14, 1, 14, 28, 10306 }, // ś
+    { 16, 21, 18, 1, 21, 50, 10334 }, // Ŝ
+    { 13, 16, 15, 1, 15, 34, 10384 }, // ŝ
+    { 15, 19, 17, 1, 15, 46, 10418 }, // Ş
+    { 11, 14, 14, 1, 10, 29, 10464 }, // ş
+    { 17, 21, 19, 1, 21, 52, 10493 }, // Š
+    { 14, 16, 16, 1, 15, 36, 10545 }, // š
+    { 14, 19, 19, 4, 14, 42, 10581 }, // Ţ
+    { 10, 17, 13, 2, 13, 30, 10623 }, // ţ
+    { 14, 21, 19, 4, 21, 44, 10653 }, // Ť
+    { 13, 15, 17, 3, 15, 33, 10697 }, // ť
+    { 14, 14, 19, 4, 14, 30, 10730 }, // Ŧ
+    { 11, 13, 13, 1, 13, 25, 10760 }, // ŧ
+    { 16, 22, 18, 1, 21, 59, 10785 }, // Ũ
+    { 11, 15, 14, 2, 15, 36, 10844 }, // ũ
+    { 16, 22, 18, 1, 21, 53, 10880 }, // Ū
+    { 12, 15, 15, 2, 15, 36, 10933 }, // ū
+    { 16, 22, 18, 1, 21, 56, 10969 }, // Ŭ
+    { 13, 15, 16, 2, 15, 37, 11025 }, // ŭ
+    { 16, 23, 18, 1, 22, 56, 11062 }, // Ů
+    { 11, 16, 14, 2, 16, 35, 11118 }, // ů
+    { 19, 21, 21, 1, 20, 56, 11153 }, // Ű
+    { 15, 14, 18, 2, 14, 36, 11209 }, // ű
+    { 16, 19, 18, 1, 14, 50, 11245 }, // Ų
+    { 11, 14, 14, 2, 9, 31, 11295 }, // ų
+    { 20, 21, 25, 4, 21, 72, 11326 }, // Ŵ
+    { 15, 18, 19, 3, 16, 43, 11398 }, // ŵ
+    { 13, 22, 19, 5, 22, 46, 11441 }, // Ŷ
+    { 15, 22, 16, 0, 17, 49, 11487 }, // ŷ
+    { 13, 22, 19, 5, 22, 50, 11536 }, // Ÿ
+    { 17, 19, 19, 1, 19, 47, 11586 }, // Ź
+    { 13, 15, 15, 1, 15, 29, 11633 }, // ź
+    { 17, 19, 19, 1, 19, 49, 11662 }, // Ż
+    { 13, 15, 15, 1, 15, 29, 11711 }, // ż
+    { 17, 21, 19, 1, 21, 53, 11740 }, // Ž
+    { 15, 17, 17, 1, 17, 33, 11793 }, // ž
+    { 11, 15, 13, 1, 14, 23, 11826 }, // ſ
+    { 20, 17, 22, 1, 16, 53, 11849 }, // Ơ
+    { 14, 11, 16, 1, 11, 31, 11902 }, // ơ
+    { 15, 15, 16, 0, 15, 43, 11933 }, // Ƥ
+    { 15, 18, 16, -1, 13, 45, 11976 }, // ƥ
+    { 13, 14, 14, 0, 13, 30, 12021 }, // Ʃ
+    { 15, 14, 19, 3, 14, 31, 12051 }, // Ƭ
+    { 10, 16, 14, 3, 16, 28, 12082 }, // ƭ
+    { 14, 17, 19, 4, 14, 36, 12110 }, // Ʈ
+    { 18, 19, 20, 1, 18, 50, 12146 }, // Ư
+    { 14, 12, 17, 2, 12, 30, 12196 }, // ư
+    { 7, 4, 11, 3, 13, 6, 12226 }, // ̀
+    { 5, 4, 9, 3, 13, 6, 12232 }, // ́
+    { 10, 5, 10, -1, 1, 11, 12238 }, // ̂
+    { 8, 4, 12, 3, 12, 12, 12249 }, // ̃
+    { 10, 3, 14, 3, 12, 8, 12261 }, // ̄
+    { 12, 3, 17, 4, 15, 10, 12269 }, // ̅
+    { 9, 4, 13, 3, 12, 12, 12279 }, // ̆
+    { 5, 4, 9, 3, 14, 7, 12291 }, // ̇
+    { 9, 4, 12, 2, 13, 8, 12298 }, // ̈
+    { 4, 5, 11, 6, 11, 7, 12306 }, // ̉
+    { 5, 4, 9, 3, 13, 8, 12313 }, // ̊
+    { 14, 4, 18, 3, 13, 11, 12321 }, // ̋
+    { 10, 5, 14, 3, 13, 10, 12332 }, // ̌
+    { 14, 4, 9, -6, 13, 11, 12342 }, // ̏
+    { 7, 6, 10, 2, 13, 10, 12353 }, // ̒
+    { 7, 6, 10, 2, 13, 11, 12363 }, // ̓
+    { 8, 6, 5, -4, 13, 11, 12374 }, // ̔
+    { 5, 5, 6, 0, 0, 8, 12385 }, // ̘
+    { 6, 5, 7, 0, 0, 8, 12393 }, // ̙
+    { 8, 5, 13, 4, 14, 13, 12401 }, // ̚
+    { 5, 5, 8, 2, 11, 8, 12414 }, // ̛
+    { 4, 6, 4, -1, 0, 7, 12422 }, // ̜
+    { 5, 6, 7, 1, 4, 8, 12429 }, // ̝
+    { 5, 5, 5, -1, 0, 6, 12437 }, // ̞
+    { 4, 5, 5, 0, -1, 6, 12443 }, // ̟
+    { 10, 3, 10, -1, -2, 9, 12449 }, // ̠
+    { 5, 4, 4, -2, 2, 7, 12458 }, // ̣
+    { 9, 4, 8, -2, -1, 11, 12465 }, // ̤
+    { 5, 4, 9, 3, 13, 8, 12476 }, // ̥
+    { 8, 6, 8, -1, 3, 11, 12484 }, // ̦
+    { 6, 6, 6, -1, 1, 10, 12495 }, // ̧
+    { 5, 7, 6, 0, 2, 9, 12505 }, // ̨
+    { 5, 6, 5, -1, 0, 10, 12514 }, // ̩
+    { 8, 4, 8, -1, 0, 11, 12524 }, // ̪
+    { 11, 5, 11, -1, 1, 14, 12535 }, // ̬
+    { 11, 5, 11, -1, 1, 12, 12549 }, // ̭
+    { 8, 4, 13, 4, 14, 12, 12561 }, // ̰
+    { 9, 3, 14, 4, 14, 6, 12573 }, // ̱
+    { 9, 3, 9, -1, -1, 10, 12579 }, // ̲
+    { 9, 4, 14, 4, 14, 12, 12589 }, // ̴
+    { 10, 2, 12, 1, 6, 4, 12601 }, // ̵
+    { 4, 6, 6, 1, 0, 8, 12605 }, // ̹
+    { 10, 6, 8, -3, 1, 16, 12613 }, // ̺
+    { 8, 6, 8, -1, 1, 15, 12629 }, // ̻
+    { 8, 5, 8, -1, 1, 13, 12644 }, // ̼
+    { 6, 4, 10, 3, 13, 9, 12657 }, // ̽
+    { 8, 4, 12, 3, 12, 12, 12666 }, // ͂
+    { 4, 5, 12, 7, 15, 7, 12678 }, // ̓
+    { 10, 12, 14, 3, 21, 20, 12685 }, // ̈́
+    { 8, 4, 12, 3, 14, 11, 12705 }, // ͆
+    { 11, 7, 10, -2, 0, 16, 12716 }, // ͇
+    { 9, 5, 9, -1, 0, 14, 12732 }, // ͈
+    { 7, 6, 7, -1, 0, 11, 12746 }, // ͉
+    { 13, 14, 16, 2, 18, 29, 12757 }, // ͊
+    { 18, 13, 24, 5, 19, 33, 12786 }, // ͋
+    { 12, 9, 22, 9, 9, 29, 12819 }, // ͌
+    { 9, 19, 11, 1, 6, 16, 12848 }, // ͍
+    { 4, 3, 13, 8, 2, 4, 12864 }, // ͎
+    { 15, 5, 16, 0, 1, 16, 12868 }, // ͜
+    { 15, 5, 19, 3, 14, 14, 12884 }, // ͡
+    { 19, 6, 19, -1, 0, 14, 12898 }, // ͢
+    { 14, 14, 19, 1, 14, 35, 12912 }, // Α
+    { 14, 14, 16, 1, 14, 42, 12947 }, // Β
+    { 13, 15, 14, 0, 13, 32, 12989 }, // Γ
+    { 14, 14, 15, 0, 13, 41, 13021 }, // Δ
+    { 14, 14, 16, 1, 14, 36, 13062 }, // Ε
+    { 17, 14, 19, 1, 14, 38, 13098 }, // Ζ
+    { 16, 14, 18, 1, 14, 43, 13136 }, // Η
+    { 17, 15, 19, 1, 14, 50, 13179 }, // Θ
+    { 8, 14, 10, 1, 14, 21, 13229 }, // Ι
+    { 15, 14, 17, 1, 14, 37, 13250 }, // Κ
+    { 15, 14, 36, 20, 14, 36, 13287 }, // Λ
+    { 18, 14, 20, 1, 14, 56, 13323 }, // Μ
+    { 16, 14, 18, 1, 14, 49, 13379 }, // Ν
+    { 15, 14, 16, 0, 13, 28, 13428 }, // Ξ
+    { 17, 15, 19, 1, 14, 43, 13456 }, // Ο
+    { 13, 13, 14, 0, 12, 39, 13499 }, // Π
+    { 14, 15, 16, 1, 15, 37, 13538 }, // Ρ
+    { 13, 14, 14, 0, 13, 30, 13575 }, // Σ
+    { 14, 14, 19, 4, 14, 30, 13605 }, // Τ
+    { 13, 14, 19, 5, 14, 33, 13635 }, // Υ
+    { 20, 19, 24, 3, 16, 66, 13668 }, // Φ
+    { 17, 14, 19, 1, 14, 38, 13734 }, // Χ
+    { 15, 16, 18, 2, 14, 52, 13772 }, // Ψ
+    { 17, 15, 18, 0, 13, 47, 13824 }, // Ω
+    { 14, 11, 16, 1, 10, 30, 13871 }, // α
+    { 14, 20, 14, -1, 16, 49, 13901 }, // β
+    { 10, 15, 14, 3, 9, 32, 13950 }, // γ
+    { 13, 16, 15, 1, 15, 40, 13982 }, // δ
+    { 8, 9, 10, 1, 9, 19, 14022 }, // ε
+    { 11, 16, 13, 1, 13, 28, 14041 }, // ζ
+    { 12, 17, 14, 1, 11, 40, 14069 }, // η
+    { 12, 14, 14, 1, 13, 36, 14109 }, // θ
+    { 7, 12, 10, 0, 12, 19, 14145 }, // ι
+    { 10, 9, 12, -1, 9, 23, 14164 }, // κ
+    { 14, 14, 14, -13, 14, 33, 14187 }, // λ
+    { 14, 12, 14, -1, 9, 31, 14220 }, // μ
+    { 10, 11, 14, 3, 9, 27, 14251 }, // ν
+    { 10, 16, 13, 2, 13, 25, 14278 }, // ξ
+    { 12, 9, 14, 1, 9, 25, 14303 }, // ο
+    { 13, 10, 15, 1, 9, 29, 14328 }, // π
+    { 15, 14, 15, -1, 10, 37, 14357 }, // ρ
+    { 9, 13, 12, 2, 13, 22, 14394 }, // ς
+    { 15, 9, 17, 1, 9, 27, 14416 }, // σ
+    { 11, 10, 14, 2, 9, 16, 14443 }, // τ
+    { 10, 10, 12, 1, 9, 26, 14459 }, // υ
+    { 17, 22, 19, 1, 18, 68, 14485 }, // φ
+    { 16, 14, 16, -1, 10, 38, 14553 }, // χ
+    { 11, 20, 13, 1, 13, 47, 14591 }, // ψ
+    { 14, 11, 16, 1, 10, 36, 14638 }, // ω
+    { 14, 19, 19, 1, 14, 45, 14674 }, // Ạ
+    { 12, 16, 14, 0, 10, 34, 14719 }, // ạ
+    { 15, 20, 19, 1, 20, 48, 14753 }, // Ả
+    { 11, 16, 14, 1, 16, 33, 14801 }, // ả
+    { 16, 25, 19, 1, 25, 59, 14834 }, // Ấ
+    { 17, 18, 19, 1, 18, 45, 14893 }, // ấ
+    { 16, 22, 19, 1, 22, 55, 14938 }, // Ầ
+    { 12, 18, 14, 1, 18, 41, 14993 }, // ầ
+    { 16, 26, 19, 1, 26, 59, 15034 }, // Ẩ
+    { 16, 19, 18, 1, 19, 46, 15093 }, // ẩ
+    { 16, 24, 19, 1, 24, 64, 15139 }, // Ẫ
+    { 13, 19, 15, 1, 19, 48, 15203 }, // ẫ
+    { 15, 25, 19, 1, 20, 58, 15251 }, // Ậ
+    { 13, 21, 14, 0, 15, 45, 15309 }, // ậ
+    { 17, 25, 19, 1, 25, 61, 15354 }, // Ắ
+    { 14, 21, 16, 1, 21, 48, 15415 }, // ắ
+    { 17, 25, 19, 1, 25, 59, 15463 }, // Ằ
+    { 14, 21, 16, 1, 21, 45, 15522 }, // ằ
+    { 17, 26, 19, 1, 26, 61, 15567 }, // Ẳ
+    { 13, 22, 15, 1, 22, 47, 15628 }, // ẳ
+    { 17, 26, 19, 1, 26, 68, 15675 }, // Ẵ
+    { 14, 21, 16, 1, 21, 49, 15743 }, // ẵ
+    { 17, 25, 19, 1, 20, 61, 15792 }, // Ặ
+    { 15, 21, 16, 0, 15, 48, 15853 }, // ặ
+    { 15, 21, 16, 0, 14, 48, 15901 }, // Ẹ
+    { 13, 16, 14, 0, 9, 37, 15949 }, // ẹ
+    { 14, 21, 16, 1, 21, 45, 15986 }, // Ẻ
+    { 12, 17, 14, 1, 17, 36, 16031 }, // ẻ
+    { 14, 21, 16, 1, 21, 49, 16067 }, // Ẽ
+    { 13, 17, 15, 1, 17, 41, 16116 }, // ẽ
+    { 17, 23, 19, 1, 23, 57, 16157 }, // Ế
+    { 19, 17, 21, 1, 17, 49, 16214 }, // ế
+    { 18, 22, 20, 1, 22, 58, 16263 }, // Ề
+    { 13, 19, 15, 1, 19, 46, 16321 }, // ề
+    { 17, 23, 19, 1, 23, 57, 16367 }, // Ể
+    { 17, 20, 19, 1, 20, 50, 16424 }, // ể
+    { 15, 24, 17, 1, 24, 61, 16474 }, // Ễ
+    { 15, 21, 17, 1, 21, 53, 16535 }, // ễ
+    { 15, 27, 16, 0, 20, 60, 16588 }, // Ệ
+    { 14, 24, 15, 0, 17, 51, 16648 }, // ệ
+    { 10, 21, 12, 1, 21, 29, 16699 }, // Ỉ
+    { 8, 15, 9, 0, 15, 22, 16728 }, // ỉ
+    { 12, 21, 10, -3, 14, 33, 16750 }, // Ị
+    { 11, 22, 10, -2, 15, 30, 16783 }, // ị
+    { 17, 22, 19, 1, 14, 55, 16813 }, // Ọ
+    { 13, 16, 14, 0, 9, 37, 16868 }, // ọ
+    { 17, 21, 19, 1, 20, 55, 16905 }, // Ỏ
+    { 12, 15, 14, 1, 15, 33, 16960 }, // ỏ
+    { 20, 21, 22, 1, 20, 64, 16993 }, // Ố
+    { 18, 16, 20, 1, 16, 46, 17057 }, // ố
+    { 17, 22, 19, 1, 21, 60, 17103 }, // Ồ
+    { 12, 17, 14, 1, 17, 40, 17163 }, // ồ
+    { 17, 23, 19, 1, 22, 64, 17203 }, // Ổ
+    { 16, 18, 18, 1, 18, 49, 17267 }, // ổ
+    { 17, 25, 19, 1, 24, 69, 17316 }, // Ỗ
+    { 13, 19, 15, 1, 19, 48, 17385 }, // ỗ
+    { 17, 28, 19, 1, 20, 68, 17433 }, // Ộ
+    { 12, 22, 14, 1, 15, 46, 17501 }, // ộ
+    { 20, 21, 22, 1, 20, 63, 17547 }, // Ớ
+    { 14, 15, 16, 1, 15, 39, 17610 }, // ớ
+    { 20, 21, 22, 1, 20, 63, 17649 }, // Ờ
+    { 14, 15, 16, 1, 15, 38, 17712 }, // ờ
+    { 20, 21, 22, 1, 20, 62, 17750 }, // Ở
+    { 14, 15, 16, 1, 15, 37, 17812 }, // ở
+    { 20, 21, 22, 1, 20, 67, 17849 }, // Ỡ
+    { 14, 16, 16, 1, 16, 44, 17916 }, // ỡ
+    { 20, 24, 22, 1, 16, 66, 17960 }, // Ợ
+    { 15, 18, 16, 0, 11, 43, 18026 }, // ợ
+    { 16, 22, 18, 1, 14, 54, 18069 }, // Ụ
+    { 13, 17, 14, 0, 9, 37, 18123 }, // ụ
+    { 16, 22, 18, 1, 21, 52, 18160 }, // Ủ
+    { 11, 15, 14, 2, 15, 32, 18212 }, // ủ
+    { 18, 22, 20, 1, 21, 56, 18244 }, // Ứ
+    { 14, 15, 17, 2, 15, 37, 18300 }, // ứ
+    { 18, 22, 20, 1, 21, 56, 18337 }, // Ừ
+    { 14, 15, 17, 2, 15, 37, 18393 }, // ừ
+    { 18, 22, 20, 1, 21, 55, 18430 }, // Ử
+    { 14, 15, 17, 2, 15, 36, 18485 }, // ử
+    { 18, 22, 20, 1, 21, 63, 18521 }, // Ữ
+    { 14, 15, 17, 2, 15, 39, 18584 }, // ữ
+    { 18, 26, 20, 1, 18, 62, 18623 }, // Ự
+    { 16, 20, 17, 0, 12, 43, 18685 }, // ự
+    { 13, 21, 19, 5, 21, 41, 18728 }, // Ỳ
+    { 15, 21, 16, 0, 16, 45, 18769 }, // ỳ
+    { 17, 23, 19, 1, 14, 51, 18814 }, // Ỵ
+    { 15, 16, 16, 0, 9, 41, 18865 }, // ỵ
+    { 13, 23, 19, 5, 23, 44, 18906 }, // Ỷ
+    { 15, 23, 16, 0, 18, 47, 18950 }, // ỷ
+    { 13, 23, 19, 5, 23, 49, 18997 }, // Ỹ
+    { 15, 22, 16, 0, 17, 47, 19046 }, // ỹ
+    { 0, 0, 11, 0, 0, 0, 19093 }, //  
+    { 0, 0, 19, 0, 0, 0, 19093 }, //  
+    { 0, 0, 11, 0, 0, 0, 19093 }, //  
+    { 0, 0, 19, 0, 0, 0, 19093 }, //  
+    { 0, 0, 8, 0, 0, 0, 19093 }, //  
+    { 0, 0, 7, 0, 0, 0, 19093 }, //  
+    { 0, 0, 5, 0, 0, 0, 19093 }, //  
+    { 0, 0, 12, 0, 0, 0, 19093 }, //  
+    { 0, 0, 4, 0, 0, 0, 19093 }, //  
+    { 0, 0, 6, 0, 0, 0, 19093 }, //  
+    { 0, 0, 5, 0, 0, 0, 19093 }, //  
+    { 0, 0, 3, 0, 0, 0, 19093 }, // ​
+    { 0, 0, 1, 0, 0, 0, 19093 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 19093 }, // ‍
+    { 0, 0, 1, 0, 0, 0, 19093 }, // ‎
+    { 0, 0, 1, 0, 0, 0, 19093 }, // ‏
+    { 10, 2, 12, 1, 6, 4, 19093 }, // ‐
+    { 10, 2, 12, 1, 6, 4, 19097 }, // ‑
+    { 15, 2, 15, -1, 6, 6, 19101 }, // ‒
+    { 14, 4, 16, 1, 7, 12, 19107 }, // –
+    { 19, 4, 21, 1, 7, 17, 19119 }, // —
+    { 19, 4, 21, 1, 7, 17, 19136 }, // ―
+    { 12, 16, 14, 1, 13, 47, 19153 }, // ‖
+    { 16, 6, 13, -4, -1, 14, 19200 }, // ‗
+    { 8, 6, 12, 3, 15, 11, 19214 }, // ‘
+    { 8, 6, 12, 3, 15, 11, 19225 }, // ’
+    { 7, 6, 7, -1, 3, 11, 19236 }, // ‚
+    { 8, 6, 12, 3, 15, 11, 19247 }, // ‛
+    { 13, 6, 17, 3, 15, 21, 19258 }, // “
+    { 13, 6, 17, 3, 15, 21, 19279 }, // ”
+    { 7, 6, 7, -1, 3, 11, 19300 }, // „
+    { 13, 6, 17, 3, 15, 20, 19311 }, // ‟
+    { 10, 24, 15, 4, 18, 40, 19331 }, // †
+    { 12, 23, 16, 3, 17, 46, 19371 }, // ‡
+    { 15, 13, 14, -2, 15, 36, 19417 }, // •
+    { 6, 7, 10, 3, 8, 10, 19453 }, // ‣
+    { 5, 4, 10, 3, 4, 6, 19463 }, // ․
+    { 5, 4, 10, 3, 4, 6, 19469 }, // ‥
+    { 16, 4, 17, 0, 4, 19, 19475 }, // …
+    { 3, 2, 9, 3, 6, 2, 19494 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 19496 }, //  
+    { 16, 15, 19, 2, 13, 50, 19496 }, // ‰
+    { 8, 6, 14, 5, 15, 11, 19546 }, // ′
+    { 13, 6, 19, 5, 15, 20, 19557 }, // ″
+    { 13, 6, 12, -2, 14, 19, 19577 }, // ‴
+    { 5, 6, 10, 4, 14, 6, 19596 }, // ‵
+    { 8, 6, 12, 3, 14, 14, 19602 }, // ‶
+    { 13, 6, 14, 0, 14, 20, 19616 }, // ‷
+    { 10, 4, 14, 3, 14, 11, 19636 }, // ‸
+    { 7, 10, 10, 2, 10, 14, 19647 }, // ‹
+    { 7, 10, 7, -2, 10, 14, 19661 }, // ›
+    { 22, 22, 24, 1, 17, 75, 19675 }, // ※
+    { 10, 22, 12, 1, 19, 31, 19750 }, // ‼
+    { 13, 27, 17, 3, 23, 53, 19781 }, // ‽
+    { 10, 2, 14, 3, 14, 4, 19834 }, // ‾
+    { 9, 4, 13, 3, 11, 11, 19838 }, // ‿
+    { 13, 12, 15, 1, 15, 36, 19849 }, // ⁂
+    { 16, 15, 22, 3, 13, 30, 19885 }, // ⁄
+    { 23, 21, 28, 4, 19, 76, 19915 }, // ⁇
+    { 20, 22, 24, 3, 19, 67, 19991 }, // ⁈
+    { 18, 22, 18, -1, 19, 60, 20058 }, // ⁉
+    { 19, 29, 19, -1, 20, 71, 20118 }, // ⁒
+    { 0, 0, 78, 0, 0, 0, 20189 }, //  
+    { 6, 7, 13, 6, 14, 17, 20189 }, // ⁰
+    { 6, 6, 13, 6, 14, 12, 20206 }, // ⁴
+    { 6, 8, 13, 6, 14, 14, 20218 }, // ⁵
+    { 6, 7, 13, 6, 14, 13, 20232 }, // ⁶
+    { 6, 8, 14, 7, 15, 11, 20245 }, // ⁷
+    { 6, 7, 13, 6, 14, 15, 20256 }, // ⁸
+    { 6, 8, 13, 6, 14, 17, 20271 }, // ⁹
+    { 12, 10, 14, 1, 10, 27, 20288 }, // ⁿ
+    { 6, 7, 6, -5, 4, 18, 20315 }, // ₀
+    { 6, 7, 6, -6, 4, 12, 20333 }, // ₁
+    { 7, 7, 6, -6, 4, 13, 20345 }, // ₂
+    { 7, 7, 6, -6, 4, 13, 20358 }, // ₃
+    { 6, 7, 6, -5, 4, 12, 20371 }, // ₄
+    { 6, 8, 6, -5, 5, 12, 20383 }, // ₅
+    { 7, 7, 6, -6, 4, 17, 20395 }, // ₆
+    { 6, 8, 6, -4, 5, 11, 20412 }, // ₇
+    { 6, 7, 6, -5, 4, 17, 20423 }, // ₈
+    { 6, 8, 6, -5, 4, 17, 20440 }, // ₉
+    { 12, 23, 14, 1, 17, 42, 20457 }, // ₍
+    { 11, 23, 7, -5, 17, 37, 20499 }, // ₎
+    { 16, 22, 19, 2, 18, 69, 20536 }, // ₡
+    { 15, 15, 17, 1, 15, 41, 20605 }, // ₢
+    { 13, 14, 14, 0, 13, 34, 20646 }, // ₤
+    { 20, 14, 20, -1, 14, 53, 20680 }, // ₦
+    { 16, 15, 18, 1, 15, 39, 20733 }, // ₧
+    { 21, 15, 22, -1, 14, 59, 20772 }, // ₨
+    { 15, 14, 15, -1, 14, 44, 20831 }, // ₩
+    { 17, 13, 20, 2, 13, 58, 20875 }, // ₪
+    { 15, 14, 15, -1, 13, 41, 20933 }, // ₫
+    { 14, 17, 16, 1, 14, 36, 20974 }, // €
+    { 14, 14, 19, 4, 14, 35, 21010 }, // ₮
+    { 18, 15, 19, 0, 15, 48, 21045 }, // ₱
+    { 16, 22, 19, 1, 19, 64, 21093 }, // ₲
+    { 19, 15, 25, 5, 14, 41, 21157 }, // ₴
+    { 10, 13, 12, 1, 11, 29, 21198 }, // ₵
+    { 16, 16, 21, 4, 16, 35, 21227 }, // ₸
+    { 12, 13, 15, 2, 12, 24, 21262 }, // ₹
+    { 11, 13, 13, 1, 11, 32, 21286 }, // ₺
+    { 14, 15, 17, 2, 14, 45, 21318 }, // ₼
+    { 17, 15, 16, -2, 15, 40, 21363 }, // ₽
+    { 12, 12, 12, -3, 9, 27, 21403 }, // ←
+    { 12, 12, 15, 2, 10, 30, 21430 }, // ↑
+    { 12, 12, 16, 3, 9, 26, 21460 }, // →
+    { 13, 12, 18, 4, 11, 29, 21486 }, // ↓
+    { 19, 10, 19, -1, 8, 35, 21515 }, // ↔
+    { 10, 19, 14, 3, 18, 40, 21550 }, // ↕
+    { 11, 8, 13, -1, 8, 23, 21590 }, // ↖
+    { 11, 8, 14, 2, 8, 22, 21613 }, // ↗
+    { 10, 11, 14, 3, 9, 25, 21635 }, // ↘
+    { 10, 11, 11, -2, 9, 25, 21660 }, // ↙
+    { 14, 11, 16, 0, 10, 31, 21685 }, // ⇐
+    { 15, 14, 19, 3, 13, 48, 21716 }, // ⇑
+    { 14, 11, 17, 2, 10, 32, 21764 }, // ⇒
+    { 15, 14, 22, 6, 13, 48, 21796 }, // ⇓
+    { 18, 11, 19, 0, 10, 41, 21844 }, // ⇔
+    { 12, 17, 17, 4, 9, 51, 21885 }, // ⇕
+    { 13, 16, 15, 1, 15, 38, 21936 }, // ∂
+    { 18, 16, 19, 0, 15, 55, 21974 }, // ∅
+    { 14, 14, 15, 0, 13, 41, 22029 }, // ∆
+    { 13, 14, 16, 2, 13, 41, 22070 }, // ∏
+    { 13, 14, 19, 5, 13, 39, 22111 }, // ∐
+    { 13, 14, 14, 0, 13, 30, 22150 }, // ∑
+    { 10, 3, 12, 1, 6, 10, 22180 }, // −
+    { 17, 15, 20, 2, 14, 37, 22190 }, // √
+    { 16, 10, 18, 1, 11, 34, 22227 }, // ∞
+    { 17, 18, 18, 0, 13, 41, 22261 }, // ∫
+    { 8, 12, 9, 0, 12, 13, 22302 }, // ∶
+    { 12, 9, 24, 9, 9, 29, 22315 }, // ≈
+    { 16, 15, 22, 3, 14, 33, 22344 }, // ≠
+    { 16, 15, 15, -2, 13, 39, 22377 }, // ≤
+    { 16, 14, 17, 0, 12, 39, 22416 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_8_bolditalicIntervals[] = {
@@ -2790,4 +2148,5 @@ static const EpdFontData opendyslexic_8_bolditalic = {
     22,
     -9,
     true,
+    true,
 };
@@ -2,2502 +2,2025 @@
  * generated by fontconvert.py
  * name: opendyslexic_8_italic
  * size: 8
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_8_italic 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py opendyslexic_8_italic 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_italicBitmaps[29191] = {
-    0x00, 0x01, 0x00, 0x01, 0xC0, 0x00, 0xB0, 0x00, 0x38, 0x00, 0x1D, 0x00, 0x0B, 0x00, 0x03, 0xC0,
-    0x01, 0xD0, 0x00, 0xB0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0B, 0x40, 0x00, 0x40, 0x01, 0x40, 0x00,
-    0xF4, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0x14, 0x15, 0x0F, 0x4F, 0xC3, 0xE2, 0xF0, 0xF8, 0x7C,
-    0x2F, 0x0F, 0x06, 0x82, 0x90, 0x00, 0x00, 0xD0, 0x34, 0x00, 0x00, 0x07, 0x01, 0xC0, 0x00, 0x00,
-    0x3C, 0x0F, 0x00, 0x00, 0x00, 0xD0, 0x34, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x15, 0xBD, 0x5F,
-    0x55, 0x00, 0x01, 0xD0, 0x74, 0x00, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x0E, 0x00, 0x00,
-    0x57, 0xE5, 0xB9, 0x54, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xB8, 0x1E, 0x00, 0x00, 0x03, 0xC0,
-    0xF0, 0x00, 0x00, 0x1F, 0x03, 0xC0, 0x00, 0x00, 0x54, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-    0x00, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0xC9, 0x00,
-    0x01, 0xFA, 0x34, 0x00, 0x0F, 0x74, 0xC0, 0x00, 0x3F, 0xD7, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0xA3, 0xFF, 0x00, 0x03, 0x4E, 0xFD, 0x01, 0x0C, 0x7F, 0xF0, 0x3F, 0xFF,
-    0xFF, 0x87, 0xFF, 0xFF, 0xF4, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x31, 0xC0, 0x00, 0x00, 0x85, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x34, 0x07, 0xE0, 0x09, 0x02, 0x83, 0x02, 0x80, 0x30,
-    0x30, 0x60, 0x03, 0x06, 0x18, 0x00, 0x3F, 0xC7, 0x00, 0x00, 0x50, 0xF8, 0x00, 0x00, 0x38, 0x70,
-    0x00, 0x0F, 0x03, 0x00, 0x03, 0xE0, 0x60, 0x00, 0xB7, 0x6C, 0x00, 0x2C, 0x2F, 0x40, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xF5, 0x7C, 0x00, 0x1D, 0x03, 0xC0,
-    0x02, 0xC0, 0xB8, 0x00, 0x1E, 0x3E, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xDF,
-    0x00, 0x41, 0xF4, 0x3C, 0x2D, 0x3F, 0x00, 0xF7, 0xC3, 0xE0, 0x07, 0xF0, 0x3F, 0x96, 0xFE, 0x01,
-    0xFF, 0xFE, 0xB0, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0xBC, 0x7C, 0x3C, 0x3E, 0x00,
-    0x03, 0x80, 0x02, 0xC0, 0x01, 0xC0, 0x00, 0xD0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C,
-    0x00, 0x0E, 0x00, 0x07, 0x40, 0x02, 0xC0, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x1D, 0x00, 0x07, 0x00,
-    0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x40, 0x01, 0xD0, 0x00, 0x38, 0x00, 0x0F, 0x00,
-    0x01, 0x40, 0x00, 0x70, 0x00, 0x02, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x34, 0x00, 0x02, 0xC0, 0x00,
-    0x0E, 0x00, 0x00, 0x74, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x00, 0x00,
-    0x70, 0x00, 0x03, 0x40, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38,
-    0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x07, 0x80, 0x00, 0x74, 0x00, 0x05, 0x00, 0x00, 0x10, 0x00,
-    0x18, 0x02, 0xC9, 0x38, 0x2F, 0xE0, 0x02, 0xF4, 0x0B, 0x67, 0xC2, 0x28, 0x00, 0x09, 0x00, 0x00,
-    0x20, 0x00, 0x1C, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x7F, 0xFF, 0x00, 0x70, 0x00, 0x2C, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0xFC, 0x1F, 0x42, 0xF0, 0x3D, 0x06, 0x80, 0x2A, 0xAA, 0x1F,
-    0xFF, 0xC0, 0x0A, 0x1E, 0x3E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xD0,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x34, 0x30, 0x00, 0xD0, 0x28, 0x03, 0xC0, 0x28,
-    0x07, 0x4D, 0x28, 0x0B, 0x1D, 0x38, 0x0F, 0x1C, 0x74, 0x0E, 0x00, 0xF0, 0x1E, 0x01, 0xE0, 0x1F,
-    0x07, 0xD0, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0xED, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x74, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xE0, 0x17,
-    0xE5, 0x7F, 0xFE, 0xBF, 0xFD, 0x00, 0x05, 0x00, 0x01, 0xFF, 0xE0, 0x02, 0x90, 0xB4, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0x74, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0xBE, 0x00,
-    0x0B, 0xF4, 0x00, 0x2F, 0xE5, 0x40, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00,
-    0x90, 0x74, 0x00, 0x00, 0x28, 0x00, 0x00, 0x24, 0x00, 0x00, 0x30, 0x00, 0x16, 0xD0, 0x00, 0xFF,
-    0x40, 0x00, 0x02, 0xC0, 0x00, 0x01, 0xD0, 0x00, 0x02, 0xC0, 0x19, 0x6F, 0x80, 0x3F, 0xFF, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0xF7, 0x00,
-    0x3C, 0xB0, 0x0F, 0x0E, 0x03, 0xD1, 0xE4, 0x7F, 0xFF, 0xC1, 0x57, 0xD4, 0x00, 0x7C, 0x00, 0x0B,
-    0x80, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x1C, 0x00, 0x00, 0xD0, 0x00, 0x03,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x55, 0x7C, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xD0, 0x00, 0x1F, 0x02,
-    0xEB, 0xF4, 0x0F, 0xFF, 0x80, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x1F, 0xFC, 0x00, 0xB4,
-    0x00, 0x01, 0xC0, 0x00, 0x03, 0x40, 0x00, 0x0B, 0xBF, 0xC0, 0x0F, 0xD1, 0xE0, 0x0F, 0x00, 0xF0,
-    0x1D, 0x00, 0xF0, 0x1D, 0x01, 0xE0, 0x1F, 0x0B, 0xC0, 0x0F, 0xFF, 0x40, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xC0, 0x01, 0xE0, 0x00, 0x74, 0x00, 0x3C, 0x00, 0x1D, 0x00, 0x0F, 0x00, 0x0B,
-    0x80, 0x03, 0xC0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0A, 0x90,
-    0x00, 0xB4, 0x28, 0x00, 0xD0, 0x1C, 0x02, 0xC0, 0x2C, 0x02, 0xC0, 0x74, 0x00, 0xFB, 0xE0, 0x00,
-    0xBF, 0x80, 0x07, 0x81, 0xE0, 0x0E, 0x00, 0xF0, 0x2C, 0x00, 0xF0, 0x3D, 0x02, 0xD0, 0x2F, 0xAF,
-    0x80, 0x0B, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x0F, 0x4B, 0x40, 0xB0, 0x0E, 0x03, 0x40, 0x3C, 0x1C,
-    0x00, 0xE0, 0xB0, 0x07, 0x81, 0xD0, 0x7D, 0x03, 0xFF, 0xF0, 0x01, 0xA7, 0xC0, 0x00, 0x1D, 0x01,
-    0x01, 0xF0, 0x2F, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0xF0, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x2F, 0x00, 0xFC, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x03, 0xF0, 0x1F, 0x00, 0xB8, 0x07, 0xC0, 0x15, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x0F,
-    0xE4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x15, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x1B, 0xC0, 0x06, 0xFF, 0x90, 0xBF, 0xF8, 0x00, 0x3E, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x02, 0xEA, 0xF4, 0x02, 0x00, 0x78, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB0, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x2F,
-    0x00, 0x02, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0x51, 0xD0, 0x00, 0x2D, 0x00, 0x0C, 0x00, 0x2C, 0x00,
-    0x02, 0x40, 0x1D, 0x7E, 0x00, 0x90, 0x0E, 0x20, 0xC0, 0x24, 0x07, 0x60, 0x30, 0x0C, 0x03, 0xCC,
-    0x28, 0x0A, 0x00, 0xF3, 0xFE, 0x1F, 0x00, 0x3D, 0x14, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02,
-    0xFD, 0x05, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1E, 0xB0, 0x00, 0x03,
-    0xCB, 0x00, 0x00, 0xB4, 0xB4, 0x00, 0x1E, 0x07, 0x40, 0x03, 0xC0, 0x78, 0x00, 0xB8, 0x07, 0x80,
-    0x1F, 0x00, 0x7C, 0x03, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x1F, 0x40, 0x07, 0xC3, 0xE0, 0x00,
-    0x7D, 0x00, 0xBF, 0xF8, 0x00, 0x3D, 0x57, 0xC0, 0x0E, 0x00, 0x34, 0x07, 0x40, 0x1D, 0x02, 0xC0,
-    0x1F, 0x00, 0xFF, 0xFD, 0x00, 0x3E, 0xAF, 0xC0, 0x1D, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x03, 0xC0,
-    0x07, 0xC1, 0xE0, 0x07, 0xE0, 0xBE, 0xBF, 0xF0, 0x3F, 0xFF, 0xF4, 0x0F, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x0B, 0xFF, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0xBC, 0x02, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xF4, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3C, 0x01, 0xF8, 0x01, 0xD0, 0x01, 0xF0, 0x0B, 0x00,
-    0x03, 0xD0, 0x3C, 0x00, 0x0F, 0x41, 0xE0, 0x00, 0x3D, 0x0B, 0x40, 0x00, 0xF0, 0x3C, 0x00, 0x0B,
-    0xC0, 0xF0, 0x00, 0xBE, 0x07, 0xEA, 0xBF, 0xF0, 0x2F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0,
-    0x03, 0xE9, 0x50, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x0F, 0xFF, 0xC0, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x02, 0xFF,
-    0xFF, 0x00, 0xFE, 0x40, 0x10, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x7F, 0xE2, 0xE0, 0x01, 0x7F, 0x3F, 0x00, 0x03,
-    0x43, 0xF8, 0x01, 0xF4, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xE4, 0x00, 0x00,
-    0x14, 0x00, 0x14, 0x00, 0x78, 0x00, 0x3D, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x7C, 0x00,
-    0xF0, 0x00, 0xB8, 0x02, 0xE0, 0x00, 0xF4, 0x03, 0xD0, 0x01, 0xF0, 0x03, 0xD0, 0x02, 0xF0, 0x07,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0x40, 0x0F, 0xC0, 0x2F,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x1F, 0x80, 0x3E, 0x00, 0x2F, 0x40, 0x00, 0x7C, 0x00, 0xB8, 0x00,
-    0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x0F,
-    0x80, 0x0F, 0x40, 0x1F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x3E,
-    0x40, 0x00, 0x00, 0x1E, 0x07, 0xC0, 0x02, 0xD0, 0xF4, 0x00, 0x3C, 0x3D, 0x00, 0x07, 0x8F, 0x80,
-    0x00, 0xB6, 0xF0, 0x00, 0x0F, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0B, 0xBF, 0x40, 0x00, 0xF1, 0xFC, 0x00, 0x1F, 0x0F, 0xF0, 0x03,
-    0xE0, 0xBF, 0x40, 0x3D, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00,
-    0x2D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
-    0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0xAA, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x0B,
-    0xF4, 0x02, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x0E, 0xFC, 0x0F, 0xBC, 0x02, 0xDF, 0xC2, 0xFB,
-    0x80, 0x3D, 0xBC, 0x7C, 0xF4, 0x03, 0xCB, 0xDF, 0x9F, 0x40, 0x7C, 0x7F, 0xF2, 0xF0, 0x0F, 0x87,
-    0xFD, 0x3F, 0x00, 0xF4, 0x3F, 0x87, 0xE0, 0x1F, 0x43, 0xF0, 0xBE, 0x03, 0xF0, 0x3D, 0x0F, 0xD0,
-    0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x03, 0xC0, 0x03, 0xF0,
-    0x02, 0xE0, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0xBF, 0x40, 0x3C, 0x00, 0x3F, 0xE0, 0x2E, 0x00, 0x1F,
-    0x7C, 0x0F, 0x40, 0x0B, 0x8F, 0x03, 0xC0, 0x03, 0xD3, 0xC2, 0xE0, 0x01, 0xF0, 0xF4, 0xF4, 0x00,
-    0xBC, 0x2E, 0x7C, 0x00, 0x3E, 0x07, 0xEE, 0x00, 0x1F, 0x40, 0xFF, 0x40, 0x0B, 0xC0, 0x3F, 0xC0,
-    0x03, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01,
-    0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00,
-    0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B,
-    0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x03, 0xEA, 0xF8, 0x00, 0x74, 0x03, 0xC0,
-    0x0B, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0x80, 0x1E, 0x01, 0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x3F, 0xFE,
-    0x40, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x3E, 0x42, 0xF0, 0x00, 0xF4, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0x78, 0x07, 0xC0,
-    0x00, 0x3C, 0x0F, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xF0, 0x2D, 0x00,
-    0x01, 0xF0, 0x3E, 0x01, 0x43, 0xD0, 0x3F, 0x47, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0E, 0xAB, 0xC0, 0x07, 0x00, 0xB0, 0x03, 0x80, 0x2C, 0x00,
-    0xD0, 0x1F, 0x00, 0x79, 0x6F, 0x40, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x07, 0xC0, 0xB4, 0x03,
-    0xE0, 0x1E, 0x00, 0xF4, 0x0B, 0x80, 0x7C, 0x03, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0xBE, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x01, 0xF9, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x6F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x94, 0x1B, 0xFC, 0x0B, 0xFF, 0xFF,
-    0xD0, 0xBF, 0xFF, 0xFC, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xF8, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x3E, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0xBC, 0x07, 0xC0, 0x03, 0xE0,
-    0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03, 0xC0, 0x02, 0xE0, 0x1F, 0x00, 0x0F, 0x40, 0xB8,
-    0x00, 0x3C, 0x02, 0xE0, 0x02, 0xE0, 0x0F, 0xD0, 0x2F, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x3C,
-    0x7C, 0x00, 0x0B, 0x87, 0xC0, 0x01, 0xF0, 0x7C, 0x00, 0x3D, 0x03, 0xC0, 0x0B, 0x80, 0x3C, 0x01,
-    0xF0, 0x03, 0xD0, 0x3E, 0x00, 0x3D, 0x0F, 0xC0, 0x03, 0xE1, 0xF4, 0x00, 0x3E, 0x3E, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x03, 0xC2, 0xE0, 0x00, 0x00, 0x2E, 0x0B, 0x80, 0x00, 0x00,
-    0xF0, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0xF8, 0x0F, 0xD0, 0x3C, 0x03, 0xE0, 0xFF, 0x43, 0xE0, 0x0F,
-    0x4B, 0xFE, 0x1F, 0x00, 0x3D, 0x7D, 0xBC, 0xF8, 0x00, 0xFB, 0xE1, 0xFB, 0xC0, 0x03, 0xFF, 0x07,
-    0xFD, 0x00, 0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x03, 0xC0, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x3D,
-    0x03, 0xD0, 0x00, 0x07, 0x83, 0xD0, 0x00, 0x00, 0xF3, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFB, 0xD0, 0x00,
-    0x02, 0xF0, 0xFC, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC,
-    0x00, 0x78, 0x00, 0x2E, 0x3C, 0x00, 0x7C, 0x3D, 0x00, 0xF0, 0x2E, 0x03, 0xD0, 0x2F, 0x0F, 0x40,
-    0x1F, 0x2E, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
-    0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x55, 0x5B, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0xFA, 0xAA, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2D,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x80, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xD0,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x01, 0x0D, 0x34, 0xE2, 0x8A, 0x2C, 0xB2, 0xCB, 0x2D, 0xB5, 0xD6, 0x10, 0x2A, 0x80,
-    0x00, 0x3F, 0xC0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x74, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x03, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2C, 0x00, 0x03, 0xFE,
-    0x00, 0x02, 0xFF, 0x0A, 0x00, 0x7E, 0x03, 0x46, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x7F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xFF, 0x80,
-    0xB8, 0x2E, 0x07, 0x40, 0x74, 0x38, 0x02, 0xC0, 0xC0, 0x0F, 0x07, 0x00, 0xBC, 0x1F, 0xAF, 0xE0,
-    0x3F, 0xFF, 0x80, 0x7F, 0x9D, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2E, 0xFF, 0x03, 0xF9, 0x7C, 0x3E, 0x01, 0xD3, 0xC0, 0x1D, 0x78,
-    0x02, 0xCB, 0x40, 0x78, 0xFE, 0x6F, 0x0F, 0xFF, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x7E, 0x60, 0x3C, 0x00, 0x1D, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00,
-    0x3D, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x1C, 0x00, 0x1B, 0xCB, 0x00, 0x2F, 0xFB, 0x80,
-    0x2D, 0x0B, 0xD0, 0x1D, 0x01, 0xF0, 0x0B, 0x00, 0x78, 0x03, 0x80, 0x2D, 0x00, 0xE0, 0x1F, 0x00,
-    0x3F, 0xBF, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0xBF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40,
-    0x0B, 0x43, 0x40, 0xB0, 0x06, 0x07, 0x9A, 0xFC, 0x2F, 0xFE, 0x90, 0xD0, 0x00, 0x03, 0x80, 0x00,
-    0x0F, 0x90, 0x50, 0x2F, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0x00,
-    0x03, 0x40, 0x01, 0xC0, 0x03, 0xFF, 0x40, 0x7D, 0x40, 0x0E, 0x00, 0x07, 0x40, 0x03, 0xC0, 0x00,
-    0xF0, 0x00, 0x78, 0x00, 0x2D, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x4D, 0x01, 0xFB, 0xFC, 0x03,
-    0x80, 0xFC, 0x07, 0x00, 0xF8, 0x0E, 0x00, 0xF4, 0x0C, 0x00, 0xF0, 0x0C, 0x03, 0xE0, 0x0F, 0xAF,
-    0xD0, 0x0F, 0xFF, 0xC0, 0x02, 0xFB, 0x80, 0x00, 0x0F, 0x40, 0x10, 0x7F, 0x00, 0x7F, 0xFC, 0x00,
-    0x7F, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xD6, 0x90, 0x02, 0xFF, 0xF4, 0x03, 0xF4, 0x78, 0x03, 0xC0,
-    0x38, 0x07, 0x40, 0x34, 0x0F, 0x00, 0x70, 0x0F, 0x00, 0xB0, 0x1E, 0x00, 0xF0, 0x3D, 0x01, 0xE0,
-    0x3C, 0x02, 0xD0, 0x00, 0x24, 0x02, 0xE0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2C, 0x00,
-    0xE0, 0x03, 0x40, 0x1C, 0x00, 0xA0, 0x03, 0x80, 0x1D, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x02, 0xF0, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x1D, 0x00, 0x00, 0xB0, 0x00, 0x03, 0x80, 0x00, 0x0D, 0x00, 0x00, 0x70, 0x00, 0x02, 0xC0, 0x00,
-    0x0D, 0x00, 0x00, 0x30, 0x00, 0x02, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0xB0, 0x00, 0x6F, 0x80, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0xB0, 0x00, 0x0F, 0x00, 0x00,
-    0xD0, 0x00, 0x2C, 0x28, 0x03, 0xCF, 0x00, 0x3B, 0xC0, 0x07, 0xF0, 0x00, 0xFF, 0x00, 0x0E, 0xF8,
-    0x01, 0xD7, 0xD0, 0x3C, 0x3F, 0x03, 0xC1, 0xFC, 0x00, 0x10, 0x01, 0xD0, 0x0B, 0x00, 0x38, 0x01,
-    0xD0, 0x0B, 0x00, 0x38, 0x01, 0xD0, 0x0B, 0x00, 0x3C, 0x01, 0xE0, 0x0B, 0x00, 0x3F, 0xC0, 0xFF,
-    0x00, 0x00, 0xE7, 0xF0, 0x7E, 0x00, 0x3F, 0xAF, 0xBF, 0xD0, 0x2F, 0x03, 0xF0, 0x38, 0x0F, 0x00,
-    0xB4, 0x0D, 0x07, 0x80, 0x3C, 0x03, 0x42, 0xD0, 0x1D, 0x02, 0xC0, 0xF0, 0x0B, 0x00, 0xF0, 0x78,
-    0x03, 0xC0, 0x38, 0x2D, 0x02, 0xD0, 0x2D, 0x0F, 0x00, 0xF0, 0x0F, 0x40, 0x00, 0x01, 0x40, 0x07,
-    0xFF, 0xC0, 0x2F, 0x07, 0x40, 0xF0, 0x1D, 0x07, 0x80, 0x74, 0x2C, 0x03, 0xC0, 0xF0, 0x0F, 0x07,
-    0xC0, 0x78, 0x2E, 0x02, 0xE0, 0xF4, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x0F, 0xAB, 0x40, 0xF0, 0x0E,
-    0x07, 0x00, 0x2C, 0x3C, 0x00, 0xE0, 0xE0, 0x03, 0x83, 0x80, 0x2C, 0x0F, 0xAB, 0xE0, 0x2F, 0xFE,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x14, 0xBD, 0x00, 0x03, 0xFE, 0xB4, 0x00, 0x3F, 0x02, 0x80, 0x03,
-    0xC0, 0x2C, 0x00, 0x78, 0x02, 0x80, 0x0B, 0x40, 0x34, 0x00, 0xF8, 0x07, 0x00, 0x1F, 0xE6, 0xE0,
-    0x02, 0xFF, 0xFC, 0x00, 0x39, 0xFE, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x14, 0x02, 0xFF, 0x7C, 0x0B,
-    0x42, 0xF4, 0x1D, 0x01, 0xF0, 0x2C, 0x02, 0xE0, 0x34, 0x03, 0xD0, 0x34, 0x0B, 0xC0, 0x3D, 0x7F,
-    0x80, 0x2F, 0xFF, 0x40, 0x0B, 0xE7, 0x00, 0x00, 0x0E, 0x10, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0x80,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x36, 0xE0, 0x1F, 0xF8, 0x0F, 0x80, 0x03, 0xC0, 0x01, 0xE0,
-    0x00, 0xF4, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x03, 0x95, 0x00,
-    0x28, 0x00, 0x00, 0xB0, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x3C, 0x01, 0x96, 0xF0,
-    0x2F, 0xFF, 0x80, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0xE0, 0x02, 0xD0, 0x2F, 0xFE,
-    0x03, 0x80, 0x07, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x1D, 0x00, 0x2E, 0x00, 0x3F, 0xE0, 0x3F, 0xE0,
-    0x0E, 0x00, 0xB0, 0x38, 0x03, 0xC0, 0xD0, 0x0E, 0x07, 0x00, 0x74, 0x2C, 0x02, 0xC0, 0xF0, 0x0F,
-    0x03, 0xC0, 0xB8, 0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0x40, 0x7F, 0x6C, 0x00, 0x00, 0x00, 0x02, 0xC0,
-    0x03, 0x8B, 0x00, 0x2C, 0x1D, 0x01, 0xC0, 0x38, 0x0E, 0x00, 0xF0, 0xF0, 0x03, 0xCB, 0x00, 0x0B,
-    0xF4, 0x00, 0x2F, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xCF, 0x00,
-    0x01, 0xE3, 0xC0, 0x80, 0xF0, 0xF0, 0xF8, 0x78, 0x3C, 0xFF, 0x3C, 0x0F, 0xFF, 0xFD, 0x03, 0xFE,
-    0xFF, 0x00, 0xFD, 0x3F, 0x40, 0x3E, 0x0B, 0xC0, 0x00, 0x00, 0x78, 0x0B, 0x00, 0x0F, 0x0B, 0x40,
-    0x02, 0xDB, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xBC, 0x00,
-    0x0B, 0x8F, 0x40, 0x0B, 0x82, 0xF0, 0x0B, 0x80, 0x3D, 0x00, 0x02, 0xC0, 0x0F, 0x00, 0x74, 0x07,
-    0x40, 0x0E, 0x03, 0xC0, 0x03, 0xC1, 0xD0, 0x00, 0xF0, 0xF0, 0x00, 0x2E, 0xB4, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xD0,
-    0x00, 0x7F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x6A,
-    0xBD, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x78,
-    0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0x7C, 0x00, 0x00,
-    0xE0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0xA4,
-    0x00, 0x00, 0x70, 0x02, 0x80, 0x0D, 0x00, 0x30, 0x01, 0x80, 0x0D, 0x00, 0x30, 0x01, 0xC0, 0x0A,
-    0x00, 0x30, 0x00, 0xC0, 0x0A, 0x00, 0x34, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x07, 0x40, 0x02, 0xD0, 0x00, 0x7E, 0x00, 0x1F,
-    0x40, 0x0E, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x02, 0xD0, 0x00, 0xF0, 0x0B, 0xF4, 0x02, 0x90, 0x00,
-    0x1D, 0x08, 0xCC, 0x96, 0x1F, 0x00, 0x00, 0x01, 0x50, 0x0F, 0xC0, 0x3E, 0x00, 0xF4, 0x00, 0x00,
-    0x0B, 0x00, 0x7C, 0x01, 0xE0, 0x0B, 0x40, 0x3C, 0x00, 0xF0, 0x03, 0x80, 0x1D, 0x00, 0xB0, 0x03,
-    0xC0, 0x0E, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0xD0, 0x00, 0x30,
-    0x00, 0xBF, 0x01, 0xFE, 0x80, 0xF3, 0x00, 0x74, 0xC0, 0x3C, 0x60, 0x0E, 0x34, 0x03, 0x8C, 0x00,
-    0xFB, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0x00, 0x30, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x02, 0xE4, 0x2C, 0x00, 0x38, 0x00, 0x00, 0x03, 0x40, 0x00,
-    0x00, 0x34, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x34, 0x00, 0x00, 0x1B, 0xEA, 0x40, 0x03, 0xFF,
-    0xF4, 0x00, 0x03, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0xFA, 0x90, 0x03,
-    0xFF, 0xFF, 0x80, 0x02, 0x00, 0x90, 0xBF, 0xFD, 0x07, 0x47, 0x80, 0xE0, 0x38, 0x0E, 0x0F, 0x02,
-    0xFF, 0xF0, 0xBB, 0xEF, 0x41, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x2D, 0x03,
-    0xC0, 0x03, 0xC7, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xD4, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x50, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x02, 0x80, 0x0D, 0x00, 0x30, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x30, 0x01, 0xC0, 0x0A, 0x00, 0x34, 0x00, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x39, 0x1C, 0x00, 0x06, 0x00, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0x96, 0xF0, 0x01, 0xC0, 0x03, 0x40, 0x2C, 0x00, 0x70, 0x01,
-    0xFE, 0x6F, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xFF, 0xC0,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0A, 0x0F, 0x43, 0xC3, 0xD2, 0xF0, 0x06,
-    0xA0, 0x19, 0x04, 0x28, 0x04, 0x60, 0x08, 0x6D, 0x14, 0x20, 0x90, 0x05, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x83, 0x05, 0x0C, 0x29, 0xE0, 0x7E, 0x40, 0x00, 0x20, 0x01, 0x00, 0xE0, 0x2C, 0x07, 0x40,
-    0xE0, 0x2C, 0x07, 0x40, 0x3D, 0x0B, 0x80, 0x1F, 0x03, 0xD0, 0x07, 0x00, 0xD0, 0x01, 0x00, 0x40,
-    0x2A, 0x54, 0x1F, 0xFF, 0xC0, 0x00, 0xE0, 0x00, 0x74, 0x00, 0x2C, 0x00, 0x2A, 0xAA, 0x1F, 0xFF,
-    0xC0, 0x00, 0x50, 0x07, 0x44, 0x18, 0x81, 0x27, 0x81, 0x18, 0x88, 0x18, 0xA0, 0x06, 0x40, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x79, 0x74, 0x34, 0x0E, 0x2C, 0x03,
-    0x4B, 0x43, 0xC1, 0xFF, 0xD0, 0x2F, 0x80, 0x00, 0x02, 0x00, 0x00, 0x28, 0x00, 0x00, 0xD0, 0x02,
-    0xFF, 0xFC, 0x00, 0x28, 0x00, 0x00, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x60, 0x14, 0x2C, 0x38, 0x3F, 0x80, 0x00, 0x05, 0x00, 0x08, 0x00,
-    0x80, 0xA0, 0x02, 0x40, 0x70, 0xBD, 0x00, 0x07, 0x03, 0x43, 0x80, 0x40, 0x00, 0xE0, 0x0B, 0x00,
-    0x38, 0x03, 0xC0, 0x1D, 0x00, 0xE0, 0x0B, 0x00, 0x74, 0x03, 0xC0, 0x2C, 0x01, 0xF0, 0x0F, 0x00,
-    0xBC, 0x0B, 0x80, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF4, 0x0D, 0x7F, 0x6C, 0x03, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x3F, 0x0A, 0x00, 0xFF, 0x0D, 0x01, 0xFD, 0x0C, 0x01,
-    0xFC, 0x1C, 0x00, 0xFC, 0x28, 0x00, 0xB4, 0x34, 0x00, 0xF0, 0x30, 0x01, 0xF0, 0x70, 0x03, 0xD0,
-    0xA0, 0x07, 0xC0, 0xD0, 0x0F, 0xC0, 0xC0, 0x1F, 0x41, 0xC0, 0x3F, 0x02, 0x80, 0x0F, 0x07, 0xC2,
-    0xA0, 0x00, 0x04, 0x01, 0x50, 0x18, 0xB8, 0x00, 0x0A, 0x05, 0x08, 0x0C, 0x18, 0xFE, 0x00, 0x0A,
-    0x43, 0x4C, 0x50, 0xC9, 0x18, 0x7F, 0x00, 0x00, 0x40, 0x14, 0x01, 0xD0, 0x38, 0x01, 0xE0, 0x2D,
-    0x00, 0xB0, 0x1D, 0x03, 0xD0, 0xB8, 0x2E, 0x07, 0xC0, 0xF0, 0x1C, 0x01, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x05, 0x80, 0x00, 0x40, 0x24, 0x00, 0x24, 0x03, 0x00, 0x0A, 0x00,
-    0x70, 0x01, 0x80, 0x0A, 0x00, 0x70, 0x06, 0xE8, 0x1C, 0x00, 0xFF, 0xC3, 0x02, 0x00, 0x00, 0xD0,
-    0xB0, 0x00, 0x34, 0x2B, 0x00, 0x0E, 0x0A, 0x60, 0x02, 0xC2, 0x8A, 0x00, 0xB0, 0x3F, 0xF4, 0x2C,
-    0x00, 0x1C, 0x02, 0x40, 0x02, 0xC0, 0x02, 0xC0, 0x00, 0x00, 0x1A, 0x00, 0x01, 0x00, 0x24, 0x00,
-    0x24, 0x00, 0xC0, 0x02, 0x80, 0x07, 0x00, 0x1C, 0x00, 0x28, 0x01, 0xC0, 0x06, 0xE8, 0x0E, 0xF8,
-    0x3F, 0xF0, 0xD8, 0x28, 0x00, 0x0D, 0x00, 0xA0, 0x00, 0xE0, 0x03, 0x40, 0x0A, 0x00, 0x3C, 0x00,
-    0xB0, 0x0B, 0xC0, 0x0B, 0x00, 0xF8, 0x00, 0x70, 0x0B, 0xFD, 0x03, 0x40, 0x2A, 0xA0, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x01, 0x80, 0x0D, 0x00, 0xF8, 0x00, 0x90, 0x00, 0x34,
-    0x0A, 0x00, 0x00, 0xC0, 0x60, 0x02, 0xAF, 0x07, 0x00, 0x1F, 0xE0, 0x70, 0x20, 0x00, 0x03, 0x42,
-    0xC0, 0x00, 0x34, 0x2B, 0x00, 0x03, 0x82, 0x98, 0x00, 0x38, 0x28, 0xA0, 0x02, 0xC0, 0xEF, 0xD0,
-    0x2C, 0x00, 0x1C, 0x00, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x0B, 0x80, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x7F,
-    0x00, 0x0B, 0xD0, 0x00, 0xB8, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x40,
-    0x00, 0x1E, 0x00, 0x80, 0x3E, 0xAF, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x3C, 0xB0,
-    0x00, 0x0B, 0x4B, 0x40, 0x01, 0xE0, 0x74, 0x00, 0x3C, 0x07, 0x80, 0x0B, 0x80, 0x78, 0x01, 0xF0,
-    0x07, 0xC0, 0x3F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xC1, 0xF4, 0x00, 0x7C, 0x3E, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7A, 0xC0, 0x00, 0x03, 0xCB,
-    0x00, 0x00, 0x2D, 0x2D, 0x00, 0x01, 0xE0, 0x74, 0x00, 0x0F, 0x01, 0xE0, 0x00, 0xB8, 0x07, 0x80,
-    0x07, 0xC0, 0x1F, 0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x1F, 0x40, 0x07, 0xC0, 0xF8,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xA8, 0x00, 0x00,
-    0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x0F, 0x2C, 0x00, 0x00, 0xB4, 0xB4, 0x00, 0x07, 0x81, 0xD0,
-    0x00, 0x3C, 0x07, 0x80, 0x02, 0xE0, 0x1E, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x7D, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1D, 0x08, 0x00,
-    0x00, 0xC9, 0x60, 0x00, 0x06, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x0F, 0x2C,
-    0x00, 0x00, 0xB4, 0xB4, 0x00, 0x07, 0x81, 0xD0, 0x00, 0x3C, 0x07, 0x80, 0x02, 0xE0, 0x1E, 0x00,
-    0x1F, 0x00, 0x7C, 0x00, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xC0, 0x7D, 0x00, 0x1F, 0x03, 0xE0,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0xA4, 0x68, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x03, 0xCB, 0x00, 0x00, 0x0B, 0x4B, 0x40, 0x00,
-    0x1E, 0x07, 0x40, 0x00, 0x3C, 0x07, 0x80, 0x00, 0xB8, 0x07, 0x80, 0x01, 0xF0, 0x07, 0xC0, 0x03,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x3E, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x02, 0x90, 0x00, 0x00, 0x86, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x1E, 0xB0, 0x00, 0x03, 0xCB, 0x00, 0x00, 0xB4, 0xB4, 0x00, 0x1E, 0x07, 0x40, 0x03, 0xC0, 0x78,
-    0x00, 0xB8, 0x07, 0x80, 0x1F, 0x00, 0x7C, 0x03, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x1F, 0x40,
-    0x07, 0xC3, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x7F, 0xFD, 0x00, 0x00, 0x0F, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x00, 0x0B,
-    0x80, 0x3D, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3D, 0x00, 0x3F, 0xFF, 0xE0, 0x03, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x0B, 0xFF, 0xD0, 0x03, 0xF4, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0xBC, 0x02, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xF4, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40,
-    0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x24, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xE4, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFD, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03,
-    0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xE4, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xFD,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x80, 0xA0, 0x00, 0x3C, 0x2E, 0x00, 0x0B, 0xC3,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x40, 0x00, 0x1D, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x3C, 0x00,
-    0x1F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x80, 0x03,
-    0xD0, 0x01, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x02,
-    0x80, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x3D,
-    0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x34, 0x00, 0x0B, 0xD0, 0x01, 0xC2, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0,
-    0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x01,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xA0, 0x64, 0x07, 0xC3, 0xD0, 0x3F, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00,
-    0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00,
-    0x02, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3C, 0x02, 0xF8,
-    0x01, 0xE0, 0x01, 0xF0, 0x0B, 0x40, 0x03, 0xD0, 0x3C, 0x00, 0x0F, 0x5A, 0xFA, 0x80, 0x3D, 0xFF,
-    0xFE, 0x00, 0xF0, 0x3C, 0x00, 0x0B, 0xC0, 0xF0, 0x00, 0xBE, 0x07, 0xEA, 0xBF, 0xF0, 0x2F, 0xFF,
-    0xFF, 0x40, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x18, 0x00, 0x00,
-    0x1C, 0xC8, 0x00, 0x00, 0x09, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x0F, 0x00,
-    0x0F, 0xC0, 0x07, 0x80, 0x07, 0xF0, 0x03, 0xD0, 0x02, 0xFD, 0x00, 0xF0, 0x00, 0xFF, 0x80, 0xB8,
-    0x00, 0x7D, 0xF0, 0x3D, 0x00, 0x2E, 0x3C, 0x0F, 0x00, 0x0F, 0x4F, 0x0B, 0x80, 0x07, 0xC3, 0xD3,
-    0xD0, 0x02, 0xF0, 0xB9, 0xF0, 0x00, 0xF8, 0x1F, 0xB8, 0x00, 0x7D, 0x03, 0xFD, 0x00, 0x2F, 0x00,
-    0xFF, 0x00, 0x0F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00,
-    0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B,
-    0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D,
-    0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00,
-    0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B,
-    0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D,
-    0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x01, 0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00,
-    0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B,
-    0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D,
-    0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x20, 0x00,
-    0x00, 0xCC, 0x60, 0x00, 0x01, 0xC3, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07,
-    0xC0, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D,
-    0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x64, 0x00, 0x01, 0xE0, 0xF4, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02,
-    0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E,
-    0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F,
-    0xEA, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xF7, 0x40, 0x0F, 0x00, 0x1F, 0xE0, 0x2E, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xAF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x02, 0xFB, 0xC0, 0x00, 0x00, 0x00, 0x2D, 0x02, 0xF1, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0x01, 0xF0, 0x78, 0x00, 0x00, 0x00, 0x07, 0x81, 0xF0, 0x2D, 0x00, 0x00, 0x00, 0x02, 0xD1, 0xF0,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xF4, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x3E, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0xBC,
-    0x07, 0xC0, 0x03, 0xE0, 0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03, 0xC0, 0x02, 0xE0, 0x1F,
-    0x00, 0x0F, 0x40, 0xB8, 0x00, 0x3C, 0x02, 0xE0, 0x02, 0xE0, 0x0F, 0xD0, 0x2F, 0x40, 0x3F, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x0F,
-    0x80, 0x07, 0xC0, 0x3D, 0x00, 0x2F, 0x01, 0xF0, 0x00, 0xF8, 0x0B, 0xC0, 0x03, 0xD0, 0x3E, 0x00,
-    0x1F, 0x00, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x03, 0xD0, 0x2E, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0xB8,
-    0x03, 0xF4, 0x0B, 0xD0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x2F, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2E, 0xC0, 0x00,
-    0x01, 0xC0, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x3F, 0x00, 0x1F, 0x40, 0xF4,
-    0x00, 0xBC, 0x07, 0xC0, 0x03, 0xE0, 0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03, 0xC0, 0x02,
-    0xE0, 0x1F, 0x00, 0x0F, 0x40, 0x78, 0x00, 0x3C, 0x02, 0xE0, 0x02, 0xE0, 0x0F, 0xD0, 0x2F, 0x40,
-    0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0xE0, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0x68, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x3F, 0x00, 0x1F, 0x40, 0xF4, 0x00, 0xBC, 0x07, 0xC0, 0x03,
-    0xE0, 0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03, 0xC0, 0x02, 0xE0, 0x1F, 0x00, 0x0F, 0x40,
-    0x78, 0x00, 0x3C, 0x02, 0xE0, 0x02, 0xE0, 0x0F, 0xD0, 0x2F, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xA0,
-    0x00, 0x01, 0xC0, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x2E, 0x3C, 0x00, 0x7C, 0x3D, 0x00, 0xF0, 0x2E, 0x03,
-    0xD0, 0x2F, 0x0F, 0x40, 0x1F, 0x2E, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xD0, 0x00,
-    0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0xB0, 0xB8, 0x03, 0xC0, 0xB0, 0x0E, 0x00, 0xD0,
-    0x70, 0x0B, 0x02, 0xC1, 0xF4, 0x0F, 0xBF, 0x00, 0x3F, 0x90, 0x01, 0xC0, 0x00, 0x0B, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x00, 0xB4, 0x34, 0x01, 0xC0, 0x18, 0x02, 0x80, 0xB4, 0x03,
-    0x43, 0x40, 0x07, 0x09, 0x00, 0x0B, 0x0A, 0x00, 0x0F, 0x07, 0x40, 0x1E, 0x02, 0xD0, 0x2D, 0x00,
-    0xF0, 0x3C, 0x01, 0xE0, 0x3D, 0xFF, 0xC0, 0xB9, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x03, 0xFF, 0xE0, 0x2E, 0x0B, 0x81, 0xD0, 0x1D,
-    0x0E, 0x00, 0xB0, 0x30, 0x03, 0xC1, 0xC0, 0x2F, 0x07, 0xEB, 0xF8, 0x0F, 0xFF, 0xE0, 0x1F, 0xE7,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x0A, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0xFF, 0xF8, 0x0B, 0x82, 0xE0, 0x74, 0x07, 0x43,
-    0x80, 0x2C, 0x0C, 0x00, 0xF0, 0x70, 0x0B, 0xC1, 0xFA, 0xFE, 0x03, 0xFF, 0xF8, 0x07, 0xF9, 0xD0,
-    0x00, 0x03, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0xFF, 0xF8, 0x02, 0xE0, 0xB8, 0x07, 0x40, 0x74, 0x0E, 0x00, 0xB0, 0x0C, 0x00, 0xF0, 0x1C, 0x02,
-    0xF0, 0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9, 0xD0, 0x00, 0x1F, 0x0C, 0x00, 0x35, 0x58,
-    0x00, 0x30, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xA8, 0x00, 0xE0, 0xB8, 0x03, 0x40, 0x74, 0x0B,
-    0x00, 0xB0, 0x0D, 0x00, 0xF0, 0x1C, 0x02, 0xF0, 0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9,
-    0xD0, 0x00, 0x28, 0x09, 0x00, 0x7C, 0x2D, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0xFF, 0xF8, 0x02, 0xE0, 0xB8, 0x07, 0x40, 0x74, 0x0E, 0x00, 0xB0, 0x0C, 0x00, 0xF0, 0x1C,
-    0x02, 0xF0, 0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x08,
-    0x80, 0x00, 0x52, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xFF, 0x80, 0xB8,
-    0x2E, 0x07, 0x40, 0x74, 0x38, 0x02, 0xC0, 0xC0, 0x0F, 0x07, 0x00, 0xBC, 0x1F, 0xAF, 0xE0, 0x3F,
-    0xFF, 0x80, 0x7F, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0xFF,
-    0xFF, 0xD1, 0xC0, 0x2E, 0x0B, 0xE0, 0x0D, 0x07, 0x40, 0x7D, 0x6B, 0xD0, 0xE0, 0x0B, 0xFF, 0xE8,
-    0x0C, 0x00, 0xF0, 0x00, 0x01, 0xC0, 0x2F, 0x00, 0x00, 0x1F, 0xAF, 0xFD, 0x06, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x07, 0xF9, 0xEB, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x7E, 0x60, 0x3C, 0x00,
-    0x1D, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0xC0,
-    0x08, 0x00, 0x00, 0x80, 0x00, 0x30, 0x00, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0xB4, 0x34, 0x0B,
-    0x00, 0x60, 0x79, 0xAF, 0xC2, 0xFF, 0xE9, 0x0D, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF9, 0x05, 0x02,
-    0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBD,
-    0x00, 0x2D, 0x0D, 0x02, 0xC0, 0x18, 0x1E, 0x6B, 0xF0, 0xBF, 0xFA, 0x43, 0x40, 0x00, 0x0E, 0x00,
-    0x00, 0x3E, 0x41, 0x40, 0xBF, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0D, 0x00, 0x00, 0xBD, 0x00,
-    0x07, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBD, 0x00, 0x2D, 0x0D, 0x02, 0xC0, 0x18,
-    0x1E, 0x6B, 0xF0, 0xBF, 0xFA, 0x43, 0x40, 0x00, 0x0E, 0x00, 0x00, 0x3E, 0x41, 0x40, 0xBF, 0xFD,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x28, 0x19, 0x00, 0x7C, 0x3D, 0x00, 0xF8, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x02, 0xD0, 0xD0, 0x0B, 0x00, 0x60, 0x1E,
-    0x6B, 0xF0, 0x2F, 0xFE, 0x90, 0x34, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3E, 0x41, 0x40, 0x2F, 0xFF,
-    0x40, 0x07, 0xFE, 0x00, 0x06, 0x00, 0x0F, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x38,
-    0x00, 0xD0, 0x07, 0x00, 0x28, 0x00, 0xE0, 0x07, 0x40, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x01, 0x00,
-    0x02, 0x80, 0x01, 0xC0, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xC0, 0x00, 0xA0, 0x00, 0x34, 0x00, 0x1C, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x01, 0xD0, 0x00, 0xF0,
-    0x00, 0x3C, 0x00, 0x00, 0x02, 0x80, 0x00, 0xF8, 0x00, 0xD1, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00,
-    0xE0, 0x00, 0x34, 0x00, 0x1C, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x01, 0xD0, 0x00, 0xF0, 0x00, 0x3C,
-    0x00, 0x00, 0x0F, 0x07, 0x87, 0xC3, 0xE2, 0xA0, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x38, 0x00, 0x0D, 0x00, 0x07, 0x00, 0x02, 0xC0, 0x00, 0xE0, 0x00, 0x74, 0x00, 0x3C, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x6B,
-    0xEA, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x10, 0x34, 0x00, 0x1F, 0xF1, 0xC0, 0x01, 0xE0, 0xAD, 0x00,
-    0x0E, 0x00, 0xF0, 0x00, 0x70, 0x03, 0x80, 0x02, 0xC0, 0x1C, 0x00, 0x0B, 0x86, 0xD0, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xC3, 0x00, 0x03, 0x59, 0x80, 0x00, 0xC3,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x7F, 0xFC, 0x00, 0x2F, 0x07, 0x40, 0x0F, 0x01,
-    0xD0, 0x07, 0x80, 0x74, 0x02, 0xC0, 0x3C, 0x00, 0xF0, 0x0F, 0x00, 0x7C, 0x07, 0x80, 0x2E, 0x02,
-    0xE0, 0x0F, 0x40, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0xFA, 0xB4, 0x0F, 0x00, 0xE0, 0x70, 0x02,
-    0xC3, 0xC0, 0x0E, 0x0E, 0x00, 0x38, 0x38, 0x02, 0xC0, 0xFA, 0xBE, 0x02, 0xFF, 0xE0, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x0D, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x3E, 0xAD, 0x03,
-    0xC0, 0x38, 0x1C, 0x00, 0xB0, 0xF0, 0x03, 0x83, 0x80, 0x0E, 0x0E, 0x00, 0xB0, 0x3E, 0xAF, 0x80,
-    0xBF, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0D, 0x00, 0x00, 0xBD, 0x00, 0x06, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x3E, 0xAD, 0x03, 0xC0, 0x38, 0x1C, 0x00, 0xB0, 0xF0,
-    0x03, 0x83, 0x80, 0x0E, 0x0E, 0x00, 0xB0, 0x3E, 0xAF, 0x80, 0xBF, 0xF8, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x1D, 0x08, 0x00, 0xCC, 0x60, 0x06, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0xFA, 0xB4, 0x0F, 0x00, 0xE0, 0x70, 0x02, 0xC3, 0xC0, 0x0E, 0x0E, 0x00,
-    0x38, 0x38, 0x02, 0xC0, 0xFA, 0xBE, 0x02, 0xFF, 0xE0, 0x02, 0xFD, 0x00, 0x00, 0x28, 0x19, 0x00,
-    0x78, 0x3D, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x03, 0xEA, 0xD0, 0x0F, 0x00, 0xE0, 0x1C, 0x00, 0xB0, 0x3C, 0x00, 0xE0, 0x38, 0x00, 0xE0,
-    0x38, 0x02, 0xC0, 0x3E, 0xAF, 0x80, 0x2F, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0xF4, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x24, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xBF, 0x40,
-    0x00, 0x3C, 0x37, 0xC0, 0x00, 0x70, 0xB2, 0xC0, 0x00, 0xF0, 0xD3, 0xC0, 0x00, 0xE2, 0xC3, 0x80,
-    0x00, 0xD7, 0x4B, 0x00, 0x00, 0xFF, 0xBE, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x38, 0x02, 0xC0, 0xE0, 0x0F, 0x03, 0x40, 0x38, 0x1C, 0x01, 0xD0, 0xB0, 0x0B, 0x03,
-    0xC0, 0x3C, 0x0F, 0x02, 0xE0, 0x3F, 0xFF, 0x80, 0xFF, 0xFD, 0x01, 0xFD, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x28, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xB0, 0x38, 0x03, 0xC0, 0xD0, 0x0E, 0x07, 0x00, 0x74, 0x2C,
-    0x02, 0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0xB8, 0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0x40, 0x7F, 0x6C, 0x00,
-    0x00, 0x34, 0x00, 0x02, 0xF8, 0x00, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xB0, 0x38, 0x03,
-    0xC0, 0xD0, 0x0E, 0x07, 0x00, 0x74, 0x2C, 0x02, 0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0xB8, 0x0F, 0xFF,
-    0xE0, 0x3F, 0xFF, 0x40, 0x7F, 0x6C, 0x00, 0x00, 0xA0, 0x24, 0x07, 0xC2, 0xD0, 0x2F, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0xC0, 0xE0, 0x0F, 0x03, 0x40, 0x38, 0x1C, 0x01, 0xD0,
-    0xB0, 0x0B, 0x03, 0xC0, 0x3C, 0x0F, 0x02, 0xE0, 0x3F, 0xFF, 0x80, 0xFF, 0xFD, 0x01, 0xFD, 0xB0,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
-    0x03, 0xC0, 0x1D, 0x01, 0xD0, 0x03, 0x80, 0xF0, 0x00, 0xF0, 0x74, 0x00, 0x3C, 0x3C, 0x00, 0x0B,
-    0xAD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01,
-    0xF0, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x4F, 0x00,
-    0x1C, 0x0E, 0x00, 0xA0, 0x28, 0x03, 0x40, 0xD0, 0x0C, 0x07, 0x00, 0x70, 0x74, 0x02, 0x8B, 0x80,
-    0x0F, 0xF4, 0x00, 0x34, 0x00, 0x01, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0x34, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0x07, 0x80, 0x07, 0xC2, 0xE0, 0x02, 0xA0, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0xF0, 0x07, 0x40, 0x74, 0x00, 0xE0, 0x3C, 0x00, 0x3C,
-    0x1D, 0x00, 0x0F, 0x0F, 0x00, 0x02, 0xEB, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBD, 0x00, 0x07, 0xFD, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x03, 0xCB, 0x00, 0x00, 0x0B,
-    0x4B, 0x40, 0x00, 0x1E, 0x07, 0x40, 0x00, 0x3C, 0x07, 0x80, 0x00, 0xB8, 0x07, 0x80, 0x01, 0xF0,
-    0x07, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x3E, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x14, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFF,
-    0xF8, 0x02, 0xE0, 0xB8, 0x07, 0x40, 0x74, 0x0E, 0x00, 0xB0, 0x0C, 0x00, 0xF0, 0x1C, 0x02, 0xF0,
-    0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x0C, 0x00, 0x00, 0x3E, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x03, 0xCB, 0x00, 0x00, 0x0B, 0x4B, 0x40, 0x00, 0x1E, 0x07,
-    0x40, 0x00, 0x3C, 0x07, 0x80, 0x00, 0xB8, 0x07, 0x80, 0x01, 0xF0, 0x07, 0xC0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x20, 0x04,
-    0x00, 0x34, 0x1C, 0x00, 0x3F, 0xF0, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0xFF, 0xF8, 0x02, 0xE0, 0xB8, 0x07, 0x40, 0x74, 0x0E, 0x00, 0xB0, 0x0C, 0x00, 0xF0, 0x1C, 0x02,
-    0xF0, 0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1E, 0xB0, 0x00, 0x03, 0xCB, 0x00, 0x00, 0xB4, 0xB4, 0x00,
-    0x1E, 0x07, 0x40, 0x03, 0xC0, 0x78, 0x00, 0xB8, 0x07, 0x80, 0x1F, 0x00, 0x7C, 0x03, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFC, 0x1F, 0x40, 0x07, 0xC3, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x30, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x0F, 0xFF, 0x80, 0xB8, 0x2E, 0x07, 0x40, 0x74, 0x38, 0x02, 0xC0, 0xC0, 0x0F,
-    0x07, 0x00, 0xBC, 0x1F, 0xAF, 0xE0, 0x3F, 0xFF, 0x80, 0x7F, 0xAD, 0x00, 0x02, 0x80, 0x00, 0x0C,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0xBF, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0x80,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFF, 0xEB, 0xC0, 0x2F, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x38,
-    0x00, 0x0B, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7E, 0x60, 0x0F,
-    0x00, 0x01, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0xF8,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0D,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0xFA, 0xF0, 0x02, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFD,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x02,
-    0xEC, 0x00, 0x18, 0x08, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7E, 0x60, 0x03, 0xC0, 0x00, 0x1D,
-    0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFD, 0x00, 0x0B, 0xFF, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0xBC, 0x02, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF4, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x03, 0xC0, 0x01, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x7E, 0x60, 0x3C, 0x00, 0x1D, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0xE0,
-    0x00, 0x3D, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x24, 0x00, 0x01, 0xEC, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0xBF, 0xFD, 0x00, 0x3F, 0x40,
-    0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFF, 0xEB, 0xC0,
-    0x2F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x50, 0x0E, 0x74, 0x00, 0x3C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x7E, 0x60, 0x0F, 0x00, 0x01, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0xD0,
-    0x00, 0x3F, 0xF8, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0A,
-    0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x1F, 0x80, 0x1D,
-    0x00, 0x1F, 0x00, 0xB0, 0x00, 0x3D, 0x03, 0xC0, 0x00, 0xF4, 0x1E, 0x00, 0x03, 0xD0, 0xB4, 0x00,
-    0x0F, 0x03, 0xC0, 0x00, 0xBC, 0x0F, 0x00, 0x0B, 0xE0, 0x7E, 0xAB, 0xFF, 0x02, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x07, 0x08,
-    0x00, 0x00, 0x0B, 0x1C, 0x00, 0x00, 0x0D, 0x2C, 0x00, 0x00, 0x1C, 0x38, 0x00, 0x6F, 0x2C, 0x10,
-    0x02, 0xFF, 0xB8, 0x00, 0x0B, 0x42, 0xF4, 0x00, 0x1D, 0x01, 0xF0, 0x00, 0x2C, 0x01, 0xE0, 0x00,
-    0x38, 0x02, 0xD0, 0x00, 0x38, 0x07, 0xC0, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x0B, 0xF7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x3C, 0x02, 0xF8, 0x01, 0xE0, 0x01, 0xF0, 0x0B, 0x40, 0x03, 0xD0, 0x3C,
-    0x00, 0x0F, 0x5A, 0xFA, 0x80, 0x3D, 0xFF, 0xFE, 0x00, 0xF0, 0x3C, 0x00, 0x0B, 0xC0, 0xF0, 0x00,
-    0xBE, 0x07, 0xEA, 0xBF, 0xF0, 0x2F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x2A, 0xFA, 0x40, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x1C, 0x00, 0x01, 0xBC, 0xB0, 0x00, 0x2F, 0xFB, 0x80, 0x02, 0xD0, 0xBD, 0x00, 0x1D,
-    0x01, 0xF0, 0x00, 0xB0, 0x07, 0x80, 0x03, 0x80, 0x2D, 0x00, 0x0E, 0x01, 0xF0, 0x00, 0x3F, 0xBF,
-    0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0x40, 0x02, 0xD0, 0xD0, 0x0B, 0x00, 0x60, 0x1E, 0x6B, 0xF0, 0x2F, 0xFE, 0x90, 0x34, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x3E, 0x41, 0x40, 0x2F, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x30, 0x0D, 0x00, 0x03, 0xEB, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x20, 0x08, 0x00, 0x74, 0x1C, 0x00, 0x3F, 0xF0,
-    0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x02,
-    0xD0, 0xD0, 0x0B, 0x00, 0x60, 0x1E, 0x6B, 0xF0, 0x2F, 0xFE, 0x90, 0x34, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x3E, 0x41, 0x40, 0x2F, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xE4, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xF4, 0x00, 0xB4, 0x34, 0x0B, 0x00, 0x60, 0x79, 0xAF, 0xC2, 0xFF, 0xE9, 0x0D, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0xF9, 0x05, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x0C, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0x40, 0x0B, 0x43, 0x40, 0xB0, 0x06, 0x07, 0x9A, 0xFC, 0x2F, 0xFE, 0x90, 0xD0, 0x00, 0x03,
-    0x80, 0x00, 0x0F, 0x90, 0x50, 0x2F, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x18, 0x00, 0x01, 0x80, 0x00,
-    0x0C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x24,
-    0x00, 0x01, 0xEC, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x60, 0x24, 0x00, 0xBB, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x02, 0xD0, 0xD0, 0x2C, 0x01, 0x81, 0xE6,
-    0xBF, 0x0B, 0xFF, 0xA4, 0x34, 0x00, 0x00, 0xE0, 0x00, 0x03, 0xE4, 0x14, 0x0B, 0xFF, 0xD0, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0xBF, 0xFF, 0xC0, 0x0F, 0xE4, 0x01, 0x00, 0xBC, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F,
-    0x00, 0x7F, 0xE0, 0xB8, 0x00, 0x5F, 0xC3, 0xF0, 0x00, 0x34, 0x0F, 0xE0, 0x07, 0xD0, 0x2F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xD0, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD3, 0x40, 0x1F, 0xBF,
-    0xC0, 0x0E, 0x03, 0xF0, 0x07, 0x00, 0xF8, 0x03, 0x80, 0x3D, 0x00, 0xC0, 0x0F, 0x00, 0x30, 0x0F,
-    0x80, 0x0F, 0xAF, 0xD0, 0x03, 0xFF, 0xF0, 0x00, 0x2F, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x10, 0x7F,
-    0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x03, 0x00, 0xC0, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xFE, 0x40, 0x10, 0x0B, 0xC0, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01,
-    0xF0, 0x07, 0xFE, 0x0B, 0x80, 0x05, 0xFC, 0x3F, 0x00, 0x03, 0x40, 0xFE, 0x00, 0x7D, 0x02, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x24, 0x01, 0x00, 0x28, 0x1D,
-    0x00, 0x1F, 0xF8, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x4D, 0x01,
-    0xFB, 0xFC, 0x03, 0x80, 0xFC, 0x07, 0x00, 0xF8, 0x0E, 0x00, 0xF4, 0x0C, 0x00, 0xF0, 0x0C, 0x03,
-    0xE0, 0x0F, 0xAF, 0xD0, 0x0F, 0xFF, 0xC0, 0x02, 0xFB, 0x80, 0x00, 0x0F, 0x40, 0x10, 0x7F, 0x00,
-    0x7F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x2F,
-    0xFF, 0xF0, 0x0F, 0xE4, 0x01, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xFE, 0x2E, 0x00, 0x17, 0xF3, 0xF0, 0x00,
-    0x34, 0x3F, 0x80, 0x1F, 0x42, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x40, 0x00,
-    0x00, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x4D, 0x01, 0xFB, 0xFC, 0x03, 0x80, 0xFC, 0x07, 0x00, 0xF8, 0x0E, 0x00, 0xF4, 0x0C, 0x00, 0xF0,
-    0x0C, 0x03, 0xE0, 0x0F, 0xAF, 0xD0, 0x0F, 0xFF, 0xC0, 0x02, 0xFB, 0x80, 0x00, 0x0F, 0x40, 0x10,
-    0x7F, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x02,
-    0xFF, 0xFF, 0x00, 0xFE, 0x40, 0x10, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x7F, 0xE2, 0xE0, 0x01, 0x7F, 0x3F, 0x00,
-    0x03, 0x43, 0xF8, 0x01, 0xF4, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x4D, 0x01, 0xFB, 0xFC, 0x03, 0x80, 0xFC, 0x07, 0x00, 0xF8, 0x0E, 0x00, 0xF4, 0x0C, 0x00, 0xF0,
-    0x0C, 0x03, 0xE0, 0x0F, 0xAF, 0xD0, 0x0F, 0xFF, 0xC0, 0x02, 0xFB, 0x80, 0x00, 0x0F, 0x40, 0x10,
-    0x7F, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x04, 0x00,
-    0x78, 0x00, 0x3D, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0xB8, 0x01,
-    0xE0, 0x00, 0xF4, 0x03, 0xD0, 0x01, 0xF0, 0x03, 0xD0, 0x02, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0x40, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x1F, 0x80, 0x3E, 0x00, 0x2F, 0x40, 0x00, 0x0D, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x70, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0xD6, 0x90, 0x02, 0xFF, 0xF4, 0x03, 0xF4, 0x78, 0x03, 0xC0, 0x38, 0x07, 0x40,
-    0x34, 0x0F, 0x00, 0x70, 0x0F, 0x00, 0xB0, 0x1E, 0x00, 0xF0, 0x3D, 0x01, 0xE0, 0x3C, 0x02, 0xD0,
-    0x00, 0x24, 0x00, 0x18, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x7C,
-    0x01, 0xF0, 0x00, 0xB8, 0x0B, 0xFF, 0xFF, 0xFC, 0x07, 0xEA, 0xAA, 0xF4, 0x03, 0xD0, 0x02, 0xF0,
-    0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x0F, 0xC0,
-    0x2F, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x1F, 0x80, 0x3E, 0x00, 0x2F, 0x40, 0x00, 0x2C, 0x00, 0x00,
-    0x39, 0x50, 0x01, 0xFF, 0xA0, 0x00, 0xB0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xDA, 0x90, 0x02, 0xFF,
-    0xF4, 0x03, 0xF4, 0x78, 0x03, 0xC0, 0x38, 0x0B, 0x40, 0x34, 0x0F, 0x00, 0x70, 0x0F, 0x00, 0xB0,
-    0x1E, 0x00, 0xF0, 0x3D, 0x01, 0xE0, 0x3C, 0x02, 0xD0, 0x00, 0x78, 0x30, 0x0C, 0x96, 0x01, 0x83,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00,
-    0x0F, 0x00, 0x01, 0xF0, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xB8,
-    0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x82,
-    0x02, 0x98, 0xC0, 0xC2, 0xD0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x0D, 0x00,
-    0x03, 0x00, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x1D, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x50, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4,
-    0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0xB0, 0x00, 0x38, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00,
-    0x74, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xB8, 0x00,
-    0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F,
-    0x80, 0x1F, 0x40, 0x2F, 0x40, 0x24, 0x00, 0x60, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x2E, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xB0, 0x00, 0xE0, 0x00, 0xC0, 0x01,
-    0xC0, 0x02, 0x80, 0x03, 0x80, 0x07, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x18, 0x00, 0x30, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x0B, 0x80, 0x03, 0xD0,
-    0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x03, 0x80, 0x34, 0x07, 0x00, 0xA0, 0x0E, 0x01, 0xD0, 0x3C,
-    0x03, 0xC0, 0x00, 0x7C, 0x03, 0xD0, 0x0B, 0x80, 0x3C, 0x00, 0xF4, 0x0B, 0xC0, 0x0F, 0x00, 0xF8,
-    0x01, 0xF0, 0x0F, 0x00, 0x2E, 0x01, 0xF0, 0x03, 0xD0, 0x2E, 0x00, 0x3C, 0x03, 0xD0, 0x07, 0xC0,
-    0x3C, 0x00, 0xB8, 0x0B, 0x80, 0x0F, 0x80, 0xF4, 0x00, 0xF4, 0x0F, 0x00, 0x1F, 0x01, 0xF0, 0x03,
-    0xF0, 0x2D, 0x00, 0x3F, 0x03, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x1E, 0x00, 0xF4, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x70, 0x03, 0x80, 0x00, 0xB0, 0x03, 0x40, 0x00, 0xE0, 0x07, 0x00, 0x01, 0xC0, 0x0A, 0x00, 0x02,
-    0xC0, 0x0E, 0x00, 0x03, 0x80, 0x1D, 0x00, 0x03, 0x40, 0x3C, 0x00, 0x07, 0x00, 0x3C, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xC1, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x3E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xEE,
-    0x00, 0x00, 0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x34, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xB0,
-    0x00, 0x01, 0xBE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x07, 0xC0,
-    0x02, 0xD0, 0xF4, 0x00, 0x3C, 0x3D, 0x00, 0x07, 0x8F, 0x80, 0x00, 0xB6, 0xF0, 0x00, 0x0F, 0x7C,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0B,
-    0xBF, 0x40, 0x00, 0xF1, 0xFC, 0x00, 0x1F, 0x0F, 0xF0, 0x03, 0xE0, 0xBF, 0x40, 0x3D, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0xB0, 0x00, 0x0F, 0x00,
-    0x00, 0xD0, 0x00, 0x2C, 0x28, 0x03, 0xCF, 0x00, 0x3B, 0xC0, 0x07, 0xF0, 0x00, 0xFF, 0x00, 0x0E,
-    0xF8, 0x01, 0xD7, 0xD0, 0x3C, 0x3F, 0x03, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0x3C, 0x00, 0x0F, 0x80, 0x00, 0x50, 0x00, 0x03, 0x0A, 0x07,
-    0x2C, 0x0A, 0xB0, 0x0E, 0xC0, 0x1F, 0x00, 0x3F, 0x40, 0x3B, 0xC0, 0x72, 0xE0, 0xE1, 0xF4, 0x00,
-    0x01, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB4, 0x00,
-    0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7E, 0xAB,
-    0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x80, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0x40, 0x00, 0xB0, 0x00, 0x0E, 0x00, 0x01,
-    0xD0, 0x00, 0x2C, 0x00, 0x03, 0x80, 0x00, 0x74, 0x00, 0x0B, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00,
-    0x02, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80,
-    0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
-    0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0xAA, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07,
-    0xC0, 0x00, 0x29, 0x00, 0x00, 0x00, 0x10, 0x01, 0xD0, 0x0B, 0x00, 0x38, 0x01, 0xD0, 0x0B, 0x00,
-    0x38, 0x01, 0xD0, 0x0B, 0x00, 0x3C, 0x01, 0xE0, 0x0B, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x3F, 0x00, 0xF0, 0x0F, 0x80, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xF0, 0x0C, 0x01, 0xF0, 0x2C, 0x02, 0xD0, 0x34, 0x03,
-    0xC0, 0x20, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0xAA,
-    0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x34, 0x00, 0xD1, 0xC0, 0x0B, 0x0E, 0x00,
-    0x38, 0x24, 0x01, 0xD0, 0x00, 0x0B, 0x00, 0x00, 0x38, 0x00, 0x01, 0xD0, 0x00, 0x0B, 0x00, 0x00,
-    0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xF0, 0x1D, 0x00, 0xF0, 0x3D, 0x02, 0xE0, 0x68,
-    0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F,
-    0xAA, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x00, 0x14, 0x00, 0x07, 0x40, 0x00, 0xB0, 0x00,
-    0x0E, 0x00, 0x01, 0xD1, 0xD0, 0x2C, 0x3D, 0x03, 0x86, 0x80, 0x74, 0x00, 0x0B, 0x00, 0x00, 0xF0,
-    0x00, 0x1E, 0x00, 0x02, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x0F,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0x78, 0xB4, 0x00, 0x00, 0x00, 0x02, 0xDB, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFA, 0xAF,
-    0x00, 0x00, 0x07, 0x8F, 0xFF, 0xFC, 0x00, 0x00, 0x7C, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x74, 0x04, 0x00, 0x05, 0xFA, 0x94, 0x1B, 0xE9, 0xE0, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0xE0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0xB8, 0x00, 0x7F,
-    0x40, 0x3D, 0x00, 0x2F, 0xD0, 0x0F, 0x00, 0x0F, 0xF8, 0x0B, 0x80, 0x07, 0xDF, 0x03, 0xD0, 0x02,
-    0xE3, 0xC1, 0xF0, 0x00, 0xF4, 0xF4, 0xB8, 0x00, 0x7C, 0x3D, 0x3D, 0x00, 0x2F, 0x0B, 0x9F, 0x00,
-    0x0F, 0x81, 0xFB, 0x80, 0x07, 0xD0, 0x3F, 0xD0, 0x02, 0xF0, 0x0F, 0xF0, 0x00, 0xFC, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x28, 0x00, 0x00, 0x70, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0xFF, 0xF0, 0x02, 0xF0, 0x74, 0x03, 0xC0, 0x74, 0x07,
-    0x80, 0x74, 0x0B, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x1F, 0x01, 0xE0, 0x2E, 0x02, 0xE0, 0x3D, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x03, 0xC0, 0x03, 0xF0, 0x02, 0xE0, 0x00, 0xFC,
-    0x00, 0xF4, 0x00, 0xBF, 0x40, 0x3C, 0x00, 0x3F, 0xE0, 0x2E, 0x00, 0x1F, 0x7C, 0x0F, 0x40, 0x0B,
-    0x8F, 0x03, 0xC0, 0x03, 0xD3, 0xC2, 0xE0, 0x01, 0xF0, 0xF4, 0xF4, 0x00, 0xBC, 0x2E, 0x7C, 0x00,
-    0x3E, 0x07, 0xEE, 0x00, 0x1F, 0x40, 0xFF, 0x40, 0x0B, 0xC0, 0x3F, 0xC0, 0x03, 0xF0, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x07, 0xFF,
-    0xC0, 0x2F, 0x07, 0x40, 0xF0, 0x1D, 0x07, 0x80, 0x74, 0x2C, 0x03, 0xC0, 0xF0, 0x0F, 0x07, 0xC0,
-    0x78, 0x2E, 0x02, 0xE0, 0xF4, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x2F,
-    0x00, 0x00, 0xF0, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x1C, 0x74, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0xB8, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x2F, 0xD0,
-    0x0F, 0x00, 0x0F, 0xF8, 0x0B, 0x80, 0x07, 0xDF, 0x03, 0xD0, 0x02, 0xE3, 0xC0, 0xF0, 0x00, 0xF4,
-    0xF0, 0xB8, 0x00, 0x7C, 0x3D, 0x3D, 0x00, 0x2F, 0x0B, 0x9F, 0x00, 0x0F, 0x81, 0xFB, 0x80, 0x07,
-    0xD0, 0x3F, 0xD0, 0x02, 0xF0, 0x0F, 0xF0, 0x00, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x18, 0x05, 0x00,
-    0x0A, 0x74, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x01, 0xFF, 0xF0, 0x02, 0xF0, 0x74, 0x03, 0xC0, 0x74, 0x07, 0x80, 0x74, 0x0B, 0x00, 0xF0,
-    0x0F, 0x00, 0xF0, 0x1F, 0x01, 0xE0, 0x2E, 0x02, 0xE0, 0x3D, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x00, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0xF8, 0x2C, 0x00, 0xE0, 0x1C,
-    0x02, 0xD0, 0x2C, 0x03, 0xC0, 0x3C, 0x07, 0xC0, 0x78, 0x0B, 0x80, 0xB8, 0x0F, 0x40, 0xF4, 0x1F,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x03, 0xC0, 0x03, 0xF0, 0x02, 0xE0, 0x00,
-    0xFC, 0x00, 0xF4, 0x00, 0xBF, 0x40, 0x3C, 0x00, 0x3F, 0xE0, 0x2E, 0x00, 0x1F, 0x7C, 0x0F, 0x40,
-    0x0B, 0x8F, 0x03, 0xC0, 0x03, 0xD3, 0xC2, 0xE0, 0x01, 0xF0, 0xF4, 0xF4, 0x00, 0xBC, 0x2E, 0x7C,
-    0x00, 0x3E, 0x07, 0xEE, 0x00, 0x1F, 0x40, 0xFF, 0x40, 0x0B, 0xC0, 0x3F, 0xC0, 0x03, 0xF0, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x07, 0xFF, 0xC0, 0x2F, 0x07, 0x40, 0xF0, 0x1D, 0x07, 0x80,
-    0x74, 0x2C, 0x03, 0xC0, 0xF0, 0x0F, 0x07, 0xC0, 0x78, 0x2E, 0x02, 0xE0, 0xF4, 0x0F, 0x40, 0x00,
-    0x7C, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x2F,
-    0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B, 0x40,
-    0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D, 0x00,
-    0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFC, 0x00, 0xA5, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x03, 0xEA, 0xD0, 0x0F,
-    0x00, 0xE0, 0x1C, 0x00, 0xB0, 0x3C, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x02, 0xC0, 0x3E, 0xAF,
-    0x80, 0x2F, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x01, 0xC0, 0xA0, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07,
-    0xC0, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D,
-    0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x0C, 0x00, 0x3E, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x03, 0xEA, 0xD0, 0x0F, 0x00, 0xE0,
-    0x1C, 0x00, 0xB0, 0x3C, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x02, 0xC0, 0x3E, 0xAF, 0x80, 0x2F,
-    0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x0B, 0x00, 0x02, 0xD0, 0x0F, 0x00, 0x01, 0x50,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x02,
-    0xFA, 0xBE, 0x00, 0x03, 0xF0, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0xB8, 0x01, 0xF0, 0x00, 0x2F, 0x00,
-    0xB4, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x01, 0xE0, 0x1E, 0x00, 0x00, 0xB4, 0x0B, 0x40, 0x00, 0x3C,
-    0x02, 0xD0, 0x00, 0x2E, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x2F, 0xEA, 0xBF, 0x80, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x38, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xEA, 0xD0, 0x00, 0xF0,
-    0x0E, 0x00, 0x1C, 0x00, 0xB0, 0x03, 0xC0, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x2C, 0x00,
-    0x3E, 0xAF, 0x80, 0x02, 0xFF, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x6B, 0xFF,
-    0xD0, 0x02, 0xFA, 0xBF, 0xFF, 0xFC, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0x80,
-    0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x02, 0xFF,
-    0xF0, 0x01, 0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x2D, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xD0, 0x00, 0x7E,
-    0x00, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE4, 0x1F, 0xD0, 0x03, 0xEA, 0xDF, 0x43, 0x40, 0xF0, 0x0F, 0xC0, 0x18,
-    0x1C, 0x00, 0xBA, 0xBF, 0x83, 0xC0, 0x0F, 0xFE, 0xA4, 0x38, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x2E,
-    0x00, 0x00, 0x3E, 0xAF, 0xF9, 0x05, 0x02, 0xFF, 0xEB, 0xFF, 0xD0, 0x0B, 0xE4, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xEA, 0xBC, 0x00, 0x70, 0x0B, 0x00, 0x38, 0x02,
-    0xC0, 0x0D, 0x01, 0xF0, 0x07, 0x96, 0xF4, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x7C, 0x0B,
-    0x40, 0x3E, 0x01, 0xE0, 0x0F, 0x40, 0xB8, 0x07, 0xC0, 0x3E, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x0B,
-    0xE0, 0x00, 0x03, 0x40, 0x02, 0x80, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x36, 0xE0, 0x1F,
-    0xF8, 0x0F, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0E, 0xAB, 0xC0, 0x07, 0x00, 0xB0, 0x03, 0x80, 0x2C, 0x00, 0xD0,
-    0x1F, 0x00, 0x79, 0x6F, 0x40, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x07, 0xC0, 0xB4, 0x03, 0xE0,
-    0x1E, 0x00, 0xF4, 0x0B, 0x80, 0x7C, 0x03, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6E, 0x00, 0x7F,
-    0xE0, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0xC0, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0xFC,
-    0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x82, 0x80,
-    0x00, 0x2F, 0x40, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0xEA, 0xBC, 0x00, 0x70, 0x0B, 0x00, 0x38, 0x02, 0xC0, 0x0D, 0x01, 0xF0, 0x07, 0x96, 0xF4,
-    0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x7C, 0x0B, 0x40, 0x3E, 0x01, 0xE0, 0x0F, 0x40, 0xB8,
-    0x07, 0xC0, 0x3E, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x0B, 0xE0, 0x05, 0x01, 0x40, 0xA3, 0x40, 0x0F,
-    0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x36, 0xE0, 0x1F, 0xF8, 0x0F, 0x80, 0x03, 0xC0, 0x01, 0xE0,
-    0x00, 0xF4, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x1F, 0x90, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x06, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x09, 0x41, 0xBF, 0xC0, 0xBF, 0xFF,
-    0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x0B, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x39, 0x50, 0x02, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x1B, 0xE0, 0x00, 0x03,
-    0xC0, 0x19, 0x6F, 0x02, 0xFF, 0xF8, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x1E, 0xD0, 0x00, 0x00, 0x30, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x6F,
-    0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0x50, 0x6F, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xD0, 0x2F, 0xFF, 0xFF, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x3E, 0x00, 0x03, 0x46, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0E, 0x54,
-    0x00, 0xA0, 0x00, 0x02, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x06, 0xF8, 0x00, 0x00, 0xF0, 0x06, 0x5B,
-    0xC0, 0xBF, 0xFE, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x01,
-    0xF9, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF,
-    0x00, 0x94, 0x1B, 0xFC, 0x0B, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFC, 0x01, 0xBF, 0xFE, 0x40, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x03, 0x95, 0x00, 0x28, 0x00, 0x00, 0xB0, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xBE, 0x00,
-    0x00, 0x3C, 0x01, 0x96, 0xF0, 0x2F, 0xFF, 0x80, 0x7F, 0xF8, 0x00, 0x08, 0x00, 0x00, 0x64, 0x00,
-    0x00, 0x20, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x42, 0x40, 0x00, 0x03,
-    0xB0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x7E, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x1B, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x25, 0x06, 0xFF, 0x02, 0xFF, 0xFF,
-    0xF4, 0x2F, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x50,
-    0x02, 0xDD, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x39, 0x50, 0x02, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x1B, 0xE0, 0x00, 0x03,
-    0xC0, 0x19, 0x6F, 0x02, 0xFF, 0xF8, 0x07, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8,
-    0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0xE0, 0x02, 0xD0, 0x2F, 0xFE, 0x03,
-    0x80, 0x07, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x1D, 0x00, 0x2E, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x09,
-    0x00, 0x00, 0xC0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xF8, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x0D,
-    0x00, 0xB1, 0xC0, 0x0E, 0x14, 0x02, 0xD0, 0x02, 0xFF, 0xE0, 0x03, 0x80, 0x00, 0x74, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x1D, 0x00, 0x02, 0xE0, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x0A, 0xFE, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x02, 0xD0, 0x0B, 0xFF, 0x80, 0x38, 0x02, 0xBF, 0xA2, 0xFF,
-    0xFC, 0x03, 0x80, 0x01, 0xD0, 0x00, 0xF8, 0x00, 0x3F, 0xE0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xA0,
-    0x80, 0x00, 0x09, 0x53, 0x00, 0x00, 0x30, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x01, 0x40, 0x2F, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x7C, 0x03, 0xD0, 0x02, 0xF0, 0x1F,
-    0x00, 0x0F, 0x80, 0xBC, 0x00, 0x3D, 0x03, 0xE0, 0x01, 0xF0, 0x0F, 0x00, 0x0B, 0x80, 0x7C, 0x00,
-    0x3D, 0x02, 0xE0, 0x00, 0xF0, 0x0B, 0x80, 0x0B, 0x80, 0x3F, 0x40, 0xBD, 0x00, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x30, 0x03,
-    0x25, 0x80, 0x08, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0xC0, 0xE0, 0x0F, 0x03,
-    0x40, 0x38, 0x1C, 0x01, 0xD0, 0xB0, 0x0B, 0x03, 0xC0, 0x3C, 0x0F, 0x02, 0xE0, 0x3F, 0xFF, 0x80,
-    0xFF, 0xFD, 0x01, 0xFD, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x3F, 0x00, 0x1F,
-    0x40, 0xF4, 0x00, 0xBC, 0x07, 0xC0, 0x03, 0xE0, 0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03,
-    0xC0, 0x02, 0xE0, 0x1F, 0x00, 0x0F, 0x40, 0x78, 0x00, 0x3C, 0x02, 0xE0, 0x02, 0xE0, 0x0F, 0xD0,
-    0x2F, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xB0, 0x38,
-    0x03, 0xC0, 0xD0, 0x0E, 0x07, 0x00, 0x74, 0x2C, 0x02, 0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0xB8, 0x0F,
-    0xFF, 0xE0, 0x3F, 0xFF, 0x40, 0x7F, 0x6C, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x0D, 0x07, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x05, 0x00, 0xBC, 0x00, 0x3E, 0x03, 0xE0, 0x01, 0xF0, 0x0F, 0x40, 0x0B, 0xC0, 0x7C, 0x00,
-    0x3E, 0x02, 0xF0, 0x00, 0xF4, 0x0F, 0x80, 0x07, 0xC0, 0x3C, 0x00, 0x2E, 0x01, 0xF0, 0x00, 0xF4,
-    0x0B, 0x80, 0x03, 0xC0, 0x2E, 0x00, 0x2E, 0x00, 0xFD, 0x02, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x03, 0x41,
-    0xC0, 0x0F, 0xFC, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0B, 0x03, 0x80,
-    0x3C, 0x0D, 0x00, 0xE0, 0x70, 0x07, 0x42, 0xC0, 0x2C, 0x0F, 0x00, 0xF0, 0x3C, 0x0B, 0x80, 0xFF,
-    0xFE, 0x03, 0xFF, 0xF4, 0x07, 0xF6, 0xC0, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00,
-    0x02, 0x20, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x3E, 0x03, 0xF0, 0x01, 0xF4, 0x0F, 0x40, 0x0B, 0xC0, 0x7C, 0x00, 0x3E,
-    0x02, 0xF0, 0x00, 0xF4, 0x0F, 0x80, 0x07, 0xC0, 0x3C, 0x00, 0x2E, 0x01, 0xF0, 0x00, 0xF4, 0x07,
-    0x80, 0x03, 0xC0, 0x2E, 0x00, 0x2E, 0x00, 0xFD, 0x02, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFD, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x53, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0B, 0x03, 0x80, 0x3C,
-    0x0D, 0x00, 0xE0, 0x70, 0x07, 0x42, 0xC0, 0x2C, 0x0F, 0x00, 0xF0, 0x3C, 0x0B, 0x80, 0xFF, 0xFE,
-    0x03, 0xFF, 0xF4, 0x07, 0xF6, 0xC0, 0x00, 0x02, 0x40, 0x09, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x28,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0xF8, 0x03, 0xE0, 0x01, 0xF0, 0x03, 0xD0, 0x02, 0xF0, 0x07, 0xC0, 0x03, 0xE0, 0x0B, 0xC0,
-    0x03, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x0F, 0x00, 0x0B, 0x80, 0x1F, 0x00, 0x0F, 0x40, 0x2E, 0x00,
-    0x0F, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x3F, 0x40, 0xBD, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xF4, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x0B, 0x01, 0xE0, 0x0B,
-    0x40, 0x50, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x2C, 0x00, 0xE0, 0x0F,
-    0x00, 0x34, 0x03, 0x80, 0x1C, 0x01, 0xD0, 0x0B, 0x00, 0xB0, 0x03, 0xC0, 0x3C, 0x00, 0xF0, 0x2E,
-    0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xD0, 0x01, 0xFD, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x03, 0xE0, 0x3E, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0xBC, 0x07, 0xC0, 0x03, 0xE0, 0x2F, 0x00,
-    0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03, 0xC0, 0x02, 0xE0, 0x1F, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x3C,
-    0x02, 0xE0, 0x02, 0xE0, 0x0F, 0xD0, 0x2F, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0xB0, 0x38, 0x03, 0xC0, 0xD0, 0x0E, 0x07, 0x00, 0x74, 0x2C, 0x03,
-    0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0xB8, 0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0x40, 0x7F, 0x7C, 0x00, 0x03,
-    0x80, 0x00, 0x28, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x03, 0xC2, 0xE0, 0x00, 0x00, 0x2E, 0x0B, 0x80,
-    0x00, 0x00, 0xF0, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0xF8, 0x0F, 0xD0, 0x3C, 0x03, 0xE0, 0xFF, 0x43,
-    0xE0, 0x0F, 0x4B, 0xFE, 0x1F, 0x00, 0x3D, 0x7D, 0xBC, 0xF8, 0x00, 0xFB, 0xE1, 0xFB, 0xC0, 0x03,
-    0xFF, 0x07, 0xFD, 0x00, 0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0xFC, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0D, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x05, 0x3C, 0x00, 0x03, 0xCF, 0x00, 0x02, 0xD3, 0xC0, 0xC0, 0xF0, 0xF0, 0xF8, 0xB4,
-    0x3C, 0xFF, 0x3C, 0x0F, 0xFF, 0xFD, 0x03, 0xFE, 0xFF, 0x00, 0xFD, 0x3F, 0x40, 0x3E, 0x0B, 0xC0,
-    0x00, 0x00, 0x28, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xD1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x2E, 0x3C, 0x00, 0x7C, 0x3D, 0x00, 0xF0, 0x2E, 0x03, 0xD0, 0x2F, 0x0F, 0x40, 0x1F,
-    0x2E, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80,
-    0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0xBB, 0x00, 0x00, 0x60, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0xF0, 0x07, 0x40, 0x74, 0x00, 0xE0, 0x3C, 0x00, 0x3C, 0x1D, 0x00, 0x0F, 0x0F, 0x00, 0x02, 0xEB,
-    0x40, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xBD, 0x00, 0x07, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x28, 0x00, 0xF0, 0x7C, 0x01, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x2E, 0x3C, 0x00, 0x7C, 0x3D, 0x00, 0xF0, 0x2E, 0x03, 0xD0, 0x2F, 0x0F, 0x40,
-    0x1F, 0x2E, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
-    0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x05, 0x55,
-    0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xAA, 0xA0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x6A, 0xBD, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F,
-    0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x15,
-    0x56, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xFE, 0xAA, 0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x6A, 0xBD, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-    0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x40, 0x10, 0x00, 0x00, 0x28, 0x60, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x05, 0x55, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xAA, 0xA0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x20, 0x08, 0x00, 0x0D, 0xA0, 0x00, 0x07, 0x80, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x6A, 0xBD, 0x00, 0x00, 0xF4, 0x00, 0x03,
-    0xC0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0x40, 0x03, 0x80, 0x02, 0xC0, 0x00, 0xF0,
-    0x00, 0x38, 0x00, 0x1D, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xB4, 0x00, 0x3C, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0xFE, 0x40, 0x0A, 0x00, 0x2F, 0xAB,
-    0xE0, 0x1C, 0x00, 0xFC, 0x01, 0xF4, 0x74, 0x02, 0xF0, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0xBC,
-    0x00, 0x0B, 0x40, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00,
-    0x2D, 0x00, 0x00, 0xF0, 0x00, 0x2D, 0x00, 0x02, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x2F,
-    0xEA, 0xBF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xBF, 0x43, 0x03, 0xEA,
-    0xDD, 0x0F, 0x00, 0xF4, 0x1C, 0x00, 0xB0, 0x3C, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x02, 0xC0,
-    0x3E, 0xAF, 0x80, 0x2F, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x3F, 0xEA, 0xF8,
-    0x0B, 0xF4, 0x03, 0xC0, 0xDF, 0x00, 0x3C, 0x0C, 0xF0, 0x03, 0x80, 0x9E, 0x01, 0xF0, 0x02, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFE, 0x40, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x02, 0xCB, 0xD0, 0x00, 0x3F, 0xEB, 0x40,
-    0x03, 0xF0, 0x28, 0x00, 0x7C, 0x02, 0xC0, 0x0B, 0x80, 0x28, 0x00, 0xF4, 0x03, 0x40, 0x0F, 0x80,
-    0x70, 0x01, 0xFE, 0x6E, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0x9F, 0xE0, 0x00, 0xB4, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8,
-    0x0A, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x24, 0x00, 0x00, 0x30, 0x00, 0x01, 0x80,
-    0x00, 0x28, 0x00, 0x03, 0x80, 0x00, 0x74, 0x00, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x3D, 0x5E, 0x00, 0x01, 0x02, 0xD0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x02, 0xF0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xB4, 0x02,
-    0xFF, 0xE0, 0x0E, 0x00, 0x07, 0x40, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x74, 0x00, 0x2E, 0x00, 0x0F,
-    0xF8, 0x03, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x00, 0x1E, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0x9C, 0x03, 0xF0, 0x01, 0xFF,
-    0x80, 0x3D, 0x00, 0x2F, 0x50, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x0F, 0x80,
-    0x07, 0xC0, 0x00, 0xF0, 0x00, 0xB8, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x01, 0xE0, 0x00, 0xF0, 0x00,
-    0x2E, 0x00, 0x2E, 0x00, 0x03, 0xF4, 0x0B, 0xD0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x0E, 0x00, 0xB6, 0x0E, 0x00, 0xFC, 0x0D, 0x00, 0xF0, 0x1C, 0x01, 0xD0, 0x2C, 0x02, 0xC0,
-    0x3C, 0x03, 0xC0, 0x3C, 0x0B, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x40, 0x1F, 0xDB, 0x00, 0x60,
-    0x0F, 0x00, 0xF0, 0x07, 0x03, 0x43, 0x80, 0x40, 0x03, 0x00, 0x0F, 0xD0, 0x28, 0x28, 0x00, 0x00,
-    0x1D, 0x08, 0xCC, 0x96, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x30, 0x0D, 0x3E, 0xB8, 0x0F, 0xD0, 0x19, 0x3D,
-    0x7C, 0x09, 0x0A, 0x0F, 0x43, 0xC3, 0xD2, 0xF0, 0x64, 0x49, 0x28, 0x10, 0x0A, 0x08, 0x12, 0x24,
-    0xB8, 0x02, 0x40, 0x08, 0x0F, 0x00, 0x3C, 0x3C, 0x00, 0xE0, 0x00, 0x00, 0x34, 0x24, 0x0F, 0xC0,
-    0x0B, 0x00, 0x60, 0x01, 0x40, 0x3C, 0x00, 0xE0, 0x1E, 0x00, 0x78, 0x14, 0x02, 0xF0, 0x0F, 0x40,
-    0x7C, 0x03, 0xE0, 0x03, 0xE0, 0xBC, 0x0F, 0x81, 0xF0, 0x29, 0x00, 0x7D, 0x02, 0xF0, 0x0F, 0x00,
-    0xBC, 0x02, 0x80, 0x00, 0x09, 0x7C, 0x0C, 0x00, 0x00, 0x60, 0x3D, 0x20, 0x00, 0x3F, 0xA8, 0x15,
-    0x7C, 0x00, 0x38, 0x00, 0x34, 0x04, 0x32, 0x64, 0x21, 0x42, 0x00, 0x00, 0x20, 0xB4, 0x19, 0x00,
-    0xE4, 0x29, 0x24, 0x00, 0x08, 0x69, 0x10, 0x00, 0x15, 0x7F, 0xFE, 0x00, 0x00, 0x28, 0x3C, 0xBC,
-    0x0A, 0x06, 0x47, 0xC3, 0xD3, 0xE1, 0xF4, 0x0A, 0x08, 0x12, 0x24, 0xB8, 0x01, 0x40, 0xFC, 0x1F,
-    0x42, 0xF0, 0x3D, 0x06, 0x80, 0x00, 0x04, 0x01, 0x50, 0x18, 0xB8, 0x00, 0x05, 0x0A, 0x03, 0x00,
-    0xB4, 0x00, 0x00, 0x0E, 0x0D, 0x2C, 0x3C, 0x10, 0x3F, 0xE7, 0x09, 0x50, 0x80, 0x60, 0x20, 0xAA,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1E, 0xC0, 0x30, 0x24, 0x1D, 0x08, 0xCC, 0x96,
-    0x1F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1D,
-    0x08, 0xCC, 0x96, 0x1F, 0x00, 0x00, 0x2A, 0xAA, 0x1F, 0xFF, 0xC0, 0x20, 0x12, 0x40, 0x50, 0x86,
-    0x0D, 0x3F, 0xE0, 0x00, 0x2A, 0x92, 0x05, 0x50, 0x8B, 0xFC, 0x1A, 0x52, 0x22, 0x51, 0x50, 0x00,
-    0x00, 0x02, 0x80, 0xD0, 0x8C, 0x1D, 0x08, 0xCC, 0x96, 0x1F, 0x00, 0x00, 0x24, 0x08, 0x20, 0x00,
-    0x00, 0x00, 0x02, 0x40, 0x01, 0xC0, 0x01, 0xD0, 0x00, 0x00, 0x02, 0x42, 0x83, 0xD0, 0xF0, 0xF4,
-    0xBC, 0x7F, 0xDA, 0x0C, 0x40, 0x80, 0x00, 0x05, 0x40, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x01, 0x50, 0x00, 0x2C, 0x1C, 0x38, 0x38, 0x74, 0x34, 0xB0, 0xB0, 0x50, 0x50, 0x15,
-    0x47, 0xFC, 0x03, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x10, 0x1D, 0x28, 0x33,
-    0xA4, 0x62, 0xF0, 0x02, 0x00, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x01, 0xBF, 0x80, 0x1E, 0x0B, 0xC1, 0xE0, 0x7C, 0x1F, 0x00, 0x7F, 0xE0, 0x1D,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x09, 0x0F, 0x0D, 0x1C,
-    0x09, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x20, 0x3C, 0x34, 0xB0, 0x20, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x09, 0x00, 0x20, 0x80,
-    0x00, 0x40, 0x00, 0x00, 0x42, 0x00, 0x00, 0x64, 0x06, 0xAA, 0xA4, 0x00, 0x02, 0xAA, 0xA4, 0x01,
-    0x40, 0x00, 0x28, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1E, 0xB0, 0x00, 0x03, 0xCB, 0x00, 0x00,
-    0xB4, 0xB4, 0x00, 0x1E, 0x07, 0x40, 0x03, 0xC0, 0x78, 0x00, 0xB8, 0x07, 0x80, 0x1F, 0x00, 0x7C,
-    0x03, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x1F, 0x40, 0x07, 0xC3, 0xE0, 0x00, 0x7D, 0x00, 0xBF,
-    0xF8, 0x00, 0x3D, 0x57, 0xC0, 0x0E, 0x00, 0x34, 0x07, 0x40, 0x1D, 0x02, 0xC0, 0x1F, 0x00, 0xFF,
-    0xFD, 0x00, 0x3E, 0xAF, 0xC0, 0x1D, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x03, 0xC0, 0x07, 0xC1, 0xE0,
-    0x07, 0xE0, 0xBE, 0xBF, 0xF0, 0x3F, 0xFF, 0xF4, 0x0F, 0xFF, 0xE4, 0x00, 0x01, 0xAA, 0xA4, 0x0B,
-    0xFF, 0xC0, 0x34, 0x00, 0x00, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x28, 0x00, 0x00, 0xE0, 0x00, 0x03,
-    0x40, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x1D, 0x00, 0x00, 0xB0, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1E, 0xE0,
-    0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x0B, 0x43, 0xD0, 0x07, 0x80, 0xB8, 0x03, 0xC0, 0x1F,
-    0x03, 0xD0, 0x07, 0xC2, 0xE0, 0x00, 0xF1, 0xFA, 0xAA, 0xBD, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x55, 0x5B, 0xF0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0xBF, 0xFA, 0xAA, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x14, 0x00, 0x14, 0x00, 0x78, 0x00, 0x3D, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x7C, 0x00,
-    0xF0, 0x00, 0xB8, 0x02, 0xE0, 0x00, 0xF4, 0x03, 0xD0, 0x01, 0xF0, 0x03, 0xD0, 0x02, 0xF0, 0x07,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0x40, 0x0F, 0xC0, 0x2F,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x1F, 0x80, 0x3E, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xFE, 0x40, 0x00,
-    0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B,
-    0x40, 0x00, 0x78, 0x0F, 0x05, 0xA4, 0x78, 0x1E, 0x3F, 0xE4, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D,
-    0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xB8, 0x00,
-    0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x0F,
-    0x80, 0x0F, 0x40, 0x1F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x1E, 0x07, 0xC0, 0x02, 0xD0, 0xF4,
-    0x00, 0x3C, 0x3D, 0x00, 0x07, 0x8F, 0x80, 0x00, 0xB6, 0xF0, 0x00, 0x0F, 0x7C, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0B, 0xBF, 0x40, 0x00,
-    0xF1, 0xFC, 0x00, 0x1F, 0x0F, 0xF0, 0x03, 0xE0, 0xBF, 0x40, 0x3D, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x0B, 0xCB, 0xC0,
-    0x00, 0xF4, 0xBD, 0x00, 0x2F, 0x07, 0xD0, 0x07, 0xC0, 0x3D, 0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00,
-    0x3E, 0x03, 0xD0, 0x03, 0xE0, 0xB8, 0x00, 0x2E, 0x0F, 0x00, 0x01, 0xF2, 0xD0, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x3F, 0x40, 0x0F,
-    0xD0, 0x0B, 0xF4, 0x02, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x0E, 0xFC, 0x0F, 0xBC, 0x02, 0xDF,
-    0xC2, 0xFB, 0x80, 0x3D, 0xBC, 0x7C, 0xF4, 0x03, 0xCB, 0xDF, 0x9F, 0x40, 0x7C, 0x7F, 0xF2, 0xF0,
-    0x0F, 0x87, 0xFD, 0x3F, 0x00, 0xF4, 0x3F, 0x87, 0xE0, 0x1F, 0x43, 0xF0, 0xBE, 0x03, 0xF0, 0x3D,
-    0x0F, 0xD0, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x03, 0xC0,
-    0x03, 0xF0, 0x02, 0xE0, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0xBF, 0x40, 0x3C, 0x00, 0x3F, 0xE0, 0x2E,
-    0x00, 0x1F, 0x7C, 0x0F, 0x40, 0x0B, 0x8F, 0x03, 0xC0, 0x03, 0xD3, 0xC2, 0xE0, 0x01, 0xF0, 0xF4,
-    0xF4, 0x00, 0xBC, 0x2E, 0x7C, 0x00, 0x3E, 0x07, 0xEE, 0x00, 0x1F, 0x40, 0xFF, 0x40, 0x0B, 0xC0,
-    0x3F, 0xC0, 0x03, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x15, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xE0, 0x00, 0x02,
-    0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07, 0xC0,
-    0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D, 0x00,
-    0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFC, 0x03, 0x80, 0x2C, 0x03, 0x00, 0x38, 0x07, 0x00, 0x34, 0x0A, 0x00, 0x70, 0x0D, 0x00, 0xB0,
-    0x0C, 0x00, 0xD0, 0x1C, 0x00, 0xC0, 0x38, 0x01, 0xC0, 0x34, 0x02, 0x80, 0x70, 0x03, 0x40, 0xB0,
-    0x07, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x03, 0xEA, 0xF8, 0x00, 0x74, 0x03, 0xC0, 0x0B, 0x00, 0x3C,
-    0x00, 0xF0, 0x03, 0x80, 0x1E, 0x01, 0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x3F, 0xFE, 0x40, 0x07, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x0A, 0x00, 0x00, 0x0C, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x24, 0x00, 0x00, 0x30, 0x00, 0x01, 0x80, 0x00, 0x28, 0x00, 0x03, 0x80, 0x00,
-    0x74, 0x00, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xF8, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x78, 0x00, 0x2E, 0x3C,
-    0x00, 0x7C, 0x3D, 0x00, 0xF0, 0x2E, 0x03, 0xD0, 0x2F, 0x0F, 0x40, 0x1F, 0x2E, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00,
-    0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x00, 0x00, 0xFE,
-    0xB1, 0xBF, 0x00, 0x1F, 0xC2, 0xC0, 0xBD, 0x00, 0xF8, 0x0E, 0x00, 0xF8, 0x0F, 0x80, 0x30, 0x03,
-    0xD0, 0x7C, 0x02, 0xC0, 0x1F, 0x02, 0xF0, 0x0E, 0x00, 0xB8, 0x0F, 0x80, 0x34, 0x0B, 0xC0, 0x3F,
-    0x81, 0xC1, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFE,
-    0x40, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x03, 0xC0, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x07, 0x83,
-    0xD0, 0x00, 0x00, 0xF3, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFB, 0xD0, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x02,
-    0xF0, 0x2F, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x07, 0x01, 0x80, 0xD0,
-    0x70, 0x24, 0x0C, 0x0A, 0x03, 0x02, 0xC0, 0xE0, 0x70, 0x38, 0x0E, 0x0A, 0x0F, 0x00, 0xF0, 0xC3,
-    0xE0, 0x0B, 0xEE, 0xF8, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x38, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x01, 0xF4, 0x2D, 0x00, 0x1E, 0x00, 0x2C,
-    0x00, 0xE0, 0x00, 0xB0, 0x0B, 0x00, 0x02, 0xC0, 0x38, 0x00, 0x0B, 0x01, 0xD0, 0x00, 0x3C, 0x07,
-    0x00, 0x02, 0xD0, 0x1D, 0x00, 0x1F, 0x00, 0x38, 0x02, 0xE0, 0x06, 0xF8, 0x3F, 0x90, 0x3F, 0xD0,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x2E, 0x0B, 0x80, 0x07, 0x40, 0x74, 0x00, 0xE0, 0x0B, 0x00, 0x0C, 0x00, 0xF0, 0x01, 0xC0,
-    0x2F, 0x00, 0x1F, 0xAF, 0xE0, 0x00, 0xFF, 0xFE, 0xD0, 0x07, 0xF9, 0xEF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x1F, 0xF4, 0x00,
-    0x78, 0x2C, 0x00, 0xE0, 0x0D, 0x01, 0xD0, 0x0D, 0x02, 0xC0, 0x38, 0x03, 0xCB, 0xD0, 0x03, 0x41,
-    0xB4, 0x07, 0x00, 0x2C, 0x0B, 0x00, 0x3C, 0x0F, 0xE0, 0xB8, 0x0F, 0xFF, 0xF4, 0x1C, 0xBF, 0xE0,
-    0x3C, 0x06, 0x40, 0x38, 0x00, 0x00, 0x74, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0xF3, 0x80, 0x38, 0xF0, 0x1D, 0x2D, 0x0B, 0x07, 0x83, 0x80, 0xF3, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0,
-    0x03, 0xF0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0B, 0x80, 0x02, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0xF0, 0x19, 0x00, 0xE0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0xBF, 0xD0, 0x07, 0xE6, 0xF0, 0x0F, 0x40, 0xB4, 0x1E, 0x00, 0xB4, 0x2D,
-    0x00, 0xF0, 0x2F, 0x47, 0xD0, 0x0F, 0xFF, 0x80, 0x02, 0xF8, 0x00, 0x00, 0xA4, 0x06, 0x48, 0x08,
-    0x00, 0x08, 0x00, 0x07, 0xC0, 0x2C, 0x00, 0x34, 0x34, 0x3E, 0xF0, 0x1F, 0x80, 0x00, 0xBF, 0xF4,
-    0x00, 0x2E, 0x40, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x2C, 0x00, 0x00, 0xD0, 0x00,
-    0x03, 0x40, 0x00, 0x0B, 0x90, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x01, 0xF0,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3A, 0xFD, 0x00, 0xF4, 0x2C, 0x0B,
-    0x40, 0x70, 0x3C, 0x02, 0xC0, 0xD0, 0x0E, 0x0B, 0x40, 0x34, 0x3C, 0x01, 0xD0, 0xF0, 0x0F, 0x07,
-    0x80, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x40, 0x00, 0x34, 0x30, 0x00, 0xD0, 0x28, 0x02, 0xC0, 0x28, 0x03, 0x40, 0x28, 0x0B,
-    0x55, 0x78, 0x0F, 0xFF, 0xF4, 0x0E, 0x00, 0xB0, 0x1E, 0x01, 0xF0, 0x1F, 0x07, 0xD0, 0x1F, 0xFF,
-    0x80, 0x0F, 0xFF, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x90, 0x0C, 0x01, 0xC0, 0x28, 0x03, 0x40, 0x70,
-    0x0B, 0x00, 0xF0, 0x1E, 0x03, 0xE4, 0x3F, 0x80, 0x01, 0x82, 0x40, 0xE3, 0xC0, 0x32, 0xC0, 0x2E,
-    0xC0, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xFC, 0x00, 0xEB, 0x80, 0x74, 0xF4, 0x2C, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3D, 0xE0, 0x00, 0x0F, 0x2D, 0x00,
-    0x07, 0x43, 0xC0, 0x02, 0xC0, 0x74, 0x00, 0xF0, 0x0F, 0x00, 0x34, 0x01, 0xD0, 0x00, 0xE0, 0x0B,
-    0x00, 0x38, 0x03, 0xC0, 0x1D, 0x00, 0xE0, 0x0B, 0x00, 0x74, 0x03, 0xC0, 0x2C, 0x01, 0xF0, 0x0F,
-    0x00, 0xBC, 0x0B, 0x80, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF4, 0x0D, 0x7F, 0x6C, 0x03, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xF3, 0xC0, 0x38, 0xB0, 0x1D, 0x2D, 0x0B, 0x07,
-    0x87, 0x80, 0xF3, 0xC0, 0x3F, 0xD0, 0x0F, 0xF0, 0x03, 0xF0, 0x00, 0x0B, 0xFF, 0x40, 0x2E, 0x40,
-    0x2C, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x00, 0xFD, 0x00, 0x74, 0x00, 0x34, 0x00, 0x1D, 0x00, 0x03,
-    0xF8, 0x00, 0x0B, 0x00, 0x02, 0xC0, 0x02, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x0F, 0xAB, 0x40, 0xF0, 0x0E, 0x07, 0x00, 0x2C, 0x3C, 0x00, 0xE0, 0xE0, 0x03, 0x83, 0x80, 0x2C,
-    0x0F, 0xAB, 0xE0, 0x2F, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x34,
-    0x38, 0x02, 0xC1, 0xC0, 0x0E, 0x0E, 0x00, 0x74, 0x34, 0x02, 0xC2, 0xC0, 0x0E, 0x0F, 0x00, 0x70,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB8, 0x00, 0x02, 0xFB, 0xC0, 0x02, 0xD0, 0x70, 0x00,
-    0xE0, 0x1C, 0x00, 0xF0, 0x07, 0x00, 0x3C, 0x02, 0xC0, 0x2F, 0x00, 0xE0, 0x0F, 0xE5, 0xF0, 0x07,
-    0xFF, 0xF4, 0x03, 0xCB, 0xF4, 0x01, 0xF0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x2D, 0x0C, 0x30, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x70,
-    0x00, 0x3C, 0x00, 0x1D, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0x04, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x0F,
-    0xAB, 0x80, 0x00, 0xF0, 0x0E, 0x00, 0x07, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0xE0, 0x00, 0xE0, 0x03,
-    0x80, 0x03, 0x80, 0x2C, 0x00, 0x0F, 0xAB, 0xE0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x1C, 0x00, 0x0B, 0x00, 0x03, 0x40, 0x02, 0xC0, 0x00, 0xE0,
-    0x00, 0x78, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1C, 0x0A, 0x28, 0x06, 0x34, 0x0A,
-    0x34, 0x0A, 0x30, 0x0D, 0x70, 0x1C, 0x7E, 0xBC, 0x7F, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x06, 0xFE, 0x40,
-    0x00, 0x2F, 0xFB, 0xE0, 0x00, 0xFC, 0x91, 0xF4, 0x02, 0xF0, 0xC0, 0xB8, 0x07, 0xC0, 0xC0, 0xBC,
-    0x0B, 0x41, 0xC0, 0x78, 0x0F, 0x02, 0x80, 0xB8, 0x1E, 0x03, 0x40, 0xB4, 0x2D, 0x03, 0x00, 0xF0,
-    0x2D, 0x03, 0x02, 0xE0, 0x3F, 0x07, 0x0B, 0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0xE4, 0x00, 0xD0, 0x0F, 0xD0, 0x38, 0x00, 0x1F, 0x0E, 0x00, 0x00, 0xB7, 0xC0, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xF6, 0xD0, 0x00,
-    0x3E, 0x1F, 0x00, 0x0F, 0x80, 0xFF, 0x03, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x00, 0x03, 0x00, 0x04, 0x70, 0x01, 0xCA, 0x1C, 0x28, 0xD0, 0xC3, 0x8C, 0x1C, 0x34, 0xC1, 0xC3,
-    0x1C, 0x28, 0x71, 0x83, 0x47, 0xFE, 0xF0, 0x3F, 0xFD, 0x01, 0xFE, 0x40, 0x03, 0x00, 0x00, 0x60,
-    0x00, 0x0A, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x80, 0xB0, 0x00, 0xA0,
-    0x74, 0x00, 0x38, 0x3C, 0x18, 0x0D, 0x1D, 0x09, 0x07, 0x07, 0x43, 0x43, 0xC0, 0xFB, 0xFF, 0xC0,
-    0x1F, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x1E, 0xB0, 0x00, 0x03, 0xCB, 0x00, 0x00, 0xB4, 0xB4, 0x00, 0x1E, 0x07, 0x40,
-    0x03, 0xC0, 0x78, 0x00, 0xB8, 0x07, 0x80, 0x1F, 0x00, 0x7C, 0x03, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF,
-    0xFC, 0x1F, 0x40, 0x07, 0xC3, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x0F, 0xFF, 0x80, 0xB8, 0x2E, 0x07, 0x40, 0x74, 0x38, 0x02, 0xC0, 0xC0, 0x0F, 0x07, 0x00, 0xBC,
-    0x1F, 0xAF, 0xE0, 0x3F, 0xFF, 0x80, 0x7F, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0xBC, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1E, 0xB0, 0x00,
-    0x00, 0xF2, 0xC0, 0x00, 0x0B, 0x4B, 0x40, 0x00, 0x78, 0x1D, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x2E,
-    0x01, 0xE0, 0x01, 0xF0, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFC, 0x07, 0xD0, 0x01,
-    0xF0, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x01, 0x90, 0x00, 0x04, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x80, 0x3E, 0xBE, 0x02, 0xC0, 0x74, 0x1C, 0x01,
-    0xD0, 0xE0, 0x0B, 0x03, 0x00, 0x3C, 0x1C, 0x02, 0xF0, 0x7E, 0xBF, 0x80, 0xFF, 0xFE, 0x01, 0xFE,
-    0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x03, 0xA8, 0x00, 0x00, 0x00, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1E, 0xB0, 0x00,
-    0x00, 0x03, 0xCB, 0x00, 0x00, 0x00, 0xB4, 0xB4, 0x00, 0x00, 0x1E, 0x07, 0x40, 0x00, 0x03, 0xC0,
-    0x78, 0x00, 0x00, 0xB8, 0x07, 0x80, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x2E, 0xC0, 0x00, 0x00,
-    0x18, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFA, 0x80, 0x00, 0x03, 0x82, 0xE0, 0x00,
-    0x03, 0x40, 0x74, 0x00, 0x02, 0xC0, 0x2C, 0x00, 0x00, 0xD0, 0x0F, 0x00, 0x00, 0x70, 0x0B, 0xC0,
-    0x00, 0x1F, 0xAF, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0x9D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7A, 0xC0, 0x00, 0x03, 0xCB, 0x00, 0x00,
-    0x2D, 0x2D, 0x00, 0x01, 0xE0, 0x74, 0x00, 0x0F, 0x01, 0xE0, 0x00, 0xB8, 0x07, 0x80, 0x07, 0xC0,
-    0x1F, 0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x1F, 0x40, 0x07, 0xC0, 0xF8, 0x00, 0x1F,
-    0x40, 0x00, 0x38, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x0C, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0xF8, 0x02, 0xE0, 0xB8, 0x07, 0x40, 0x74, 0x0E,
-    0x00, 0xB0, 0x0C, 0x00, 0xF0, 0x1C, 0x02, 0xF0, 0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9,
-    0xD0, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x3A, 0x80,
-    0x00, 0x00, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x00, 0x3C, 0xB0, 0x00,
-    0x00, 0x0B, 0x4B, 0x40, 0x00, 0x01, 0xE0, 0x74, 0x00, 0x00, 0x3C, 0x07, 0x80, 0x00, 0x0B, 0x80,
-    0x78, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x01,
-    0xF4, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x20, 0x00, 0x0D, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xA0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0xFF, 0xF8, 0x02, 0xE0, 0xB8, 0x07, 0x40, 0x74, 0x0E, 0x00, 0xB0, 0x0C, 0x00, 0xF0,
-    0x1C, 0x02, 0xF0, 0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9, 0xD0, 0x00, 0x00, 0x38, 0x20,
-    0x00, 0x03, 0x65, 0x80, 0x00, 0x1C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x60, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x0F, 0x2C,
-    0x00, 0x00, 0xB4, 0xB4, 0x00, 0x07, 0x81, 0xD0, 0x00, 0x3C, 0x07, 0x80, 0x02, 0xE0, 0x1E, 0x00,
-    0x1F, 0x00, 0x7C, 0x00, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xC0, 0x7D, 0x00, 0x1F, 0x03, 0xE0,
-    0x00, 0x7D, 0x00, 0x00, 0x3C, 0x30, 0x02, 0x58, 0xC0, 0x0C, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x00, 0x01, 0xEC, 0x00, 0x08, 0x09, 0x00, 0x0B, 0xE0, 0x00, 0xFF, 0xF8, 0x0B, 0x82, 0xE0, 0x74,
-    0x07, 0x43, 0x80, 0x2C, 0x0C, 0x00, 0xF0, 0x70, 0x0B, 0xC1, 0xFA, 0xFE, 0x03, 0xFF, 0xF8, 0x07,
-    0xF9, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xA8, 0x00, 0x00, 0x24,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x01, 0xEB, 0x00, 0x00, 0x0F, 0x2C, 0x00, 0x00, 0xB4, 0xB4, 0x00, 0x07, 0x81, 0xD0, 0x00,
-    0x3C, 0x07, 0x80, 0x02, 0xE0, 0x1E, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x7D, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0xBE, 0x00, 0x07, 0x06, 0x00, 0x1B, 0xE1, 0x00, 0xFF, 0xF8, 0x0B, 0x82, 0xE0, 0x74, 0x07, 0x43,
-    0x80, 0x2C, 0x0C, 0x00, 0xF0, 0x70, 0x0B, 0xC1, 0xFA, 0xFE, 0x03, 0xFF, 0xF8, 0x07, 0xF9, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0C, 0x00, 0x00,
-    0x3E, 0xF4, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01,
-    0xEB, 0x00, 0x00, 0x03, 0xCB, 0x00, 0x00, 0x0B, 0x4B, 0x40, 0x00, 0x1E, 0x07, 0x40, 0x00, 0x3C,
-    0x07, 0x80, 0x00, 0xB8, 0x07, 0x80, 0x01, 0xF0, 0x07, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x28, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00,
-    0x34, 0x1C, 0x00, 0x3F, 0xF0, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFF,
-    0xF8, 0x02, 0xE0, 0xB8, 0x07, 0x40, 0x74, 0x0E, 0x00, 0xB0, 0x0C, 0x00, 0xF0, 0x1C, 0x02, 0xF0,
-    0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9, 0xD0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x0C, 0x00, 0x00, 0x3E, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x03, 0xCB, 0x00, 0x00, 0x0B, 0x4B, 0x40, 0x00, 0x1E, 0x07,
-    0x40, 0x00, 0x3C, 0x07, 0x80, 0x00, 0xB8, 0x07, 0x80, 0x01, 0xF0, 0x07, 0xC0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x04, 0x00,
-    0x00, 0x07, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00,
-    0x34, 0x1C, 0x00, 0x3F, 0xF0, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFF,
-    0xF8, 0x02, 0xE0, 0xB8, 0x07, 0x40, 0x74, 0x0E, 0x00, 0xB0, 0x0C, 0x00, 0xF0, 0x1C, 0x02, 0xF0,
-    0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9, 0xD0, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00,
-    0x30, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x0C, 0x00, 0x00, 0x3E, 0xF4, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x03, 0xCB, 0x00, 0x00, 0x0B, 0x4B,
-    0x40, 0x00, 0x1E, 0x07, 0x40, 0x00, 0x3C, 0x07, 0x80, 0x00, 0xB8, 0x07, 0x80, 0x01, 0xF0, 0x07,
-    0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x3E, 0x00, 0x07,
-    0xD0, 0x00, 0x02, 0xF8, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0C, 0x00, 0x7E, 0xF4, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0xF8, 0x02, 0xE0, 0xB8, 0x07, 0x40,
-    0x74, 0x0E, 0x00, 0xB0, 0x0C, 0x00, 0xF0, 0x1C, 0x02, 0xF0, 0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0,
-    0x07, 0xF9, 0xD0, 0x00, 0x00, 0x0A, 0x08, 0x00, 0x00, 0x25, 0x8C, 0x00, 0x00, 0x30, 0xF4, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x70, 0x1C, 0x00,
-    0x00, 0x3E, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x01, 0xEB, 0x00, 0x00, 0x03, 0xCB, 0x00, 0x00, 0x0B, 0x4B, 0x40, 0x00, 0x1E, 0x07, 0x40, 0x00,
-    0x3C, 0x07, 0x80, 0x00, 0xB8, 0x07, 0x80, 0x01, 0xF0, 0x07, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x0A, 0x05, 0x00, 0x19,
-    0x8C, 0x00, 0x30, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x34, 0x1C,
-    0x00, 0x3F, 0xF0, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0xF8, 0x02,
-    0xE0, 0xB8, 0x07, 0x40, 0x74, 0x0E, 0x00, 0xB0, 0x0C, 0x00, 0xF0, 0x1C, 0x02, 0xF0, 0x1F, 0xAF,
-    0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0C, 0x00,
-    0x00, 0x3E, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x01, 0xEB, 0x00, 0x00, 0x03, 0xCB, 0x00, 0x00, 0x0B, 0x4B, 0x40, 0x00, 0x1E, 0x07, 0x40, 0x00,
-    0x3C, 0x07, 0x80, 0x00, 0xB8, 0x07, 0x80, 0x01, 0xF0, 0x07, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x20, 0x04, 0x00, 0x34, 0x1C, 0x00, 0x3F, 0xF0, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0xFF, 0xF8, 0x02, 0xE0, 0xB8, 0x07, 0x40, 0x74, 0x0E, 0x00, 0xB0, 0x0C, 0x00, 0xF0,
-    0x1C, 0x02, 0xF0, 0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x6F,
-    0x40, 0x0B, 0x43, 0x40, 0xB0, 0x06, 0x07, 0x9A, 0xFC, 0x2F, 0xFE, 0x90, 0xD0, 0x00, 0x03, 0x80,
-    0x00, 0x0F, 0x90, 0x50, 0x2F, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x3D, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xE4, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x02,
-    0xA0, 0x00, 0x01, 0xC0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xD0, 0x02, 0xD0, 0xD0, 0x2C, 0x01, 0x81, 0xE6, 0xBF, 0x0B, 0xFF, 0xA4, 0x34,
-    0x00, 0x00, 0xE0, 0x00, 0x03, 0xE4, 0x14, 0x0B, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xF0,
-    0xC0, 0x00, 0x35, 0x8C, 0x00, 0x03, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x1E, 0x0C, 0x00, 0xC9, 0x60, 0x06, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xF4, 0x00, 0xB4, 0x34, 0x0B, 0x00, 0x60, 0x79, 0xAF, 0xC2, 0xFF, 0xE9, 0x0D, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0xF9, 0x05, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0x00, 0x40, 0x03, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFE, 0x40, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xD0, 0x03, 0x80, 0x00, 0xBD, 0x00, 0x40, 0x00, 0x70,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBD, 0x00, 0x00, 0x02,
-    0xD0, 0xD0, 0x00, 0x02, 0xC0, 0x18, 0x00, 0x01, 0xE6, 0xBF, 0x00, 0x00, 0xBF, 0xFA, 0x40, 0x00,
-    0x34, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x03, 0xE4, 0x14, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0x00, 0x40, 0x03,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x40, 0x00, 0x2F, 0x40, 0x01, 0xC2,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x0B, 0x43, 0x40, 0xB0, 0x06, 0x07, 0x9A,
-    0xFC, 0x2F, 0xFE, 0x90, 0xD0, 0x00, 0x03, 0x80, 0x00, 0x0F, 0x90, 0x50, 0x2F, 0xFF, 0x40, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x24, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3F,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xE4, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x69, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x30, 0x00, 0x1C, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xA0,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x02, 0xD0, 0xD0,
-    0x0B, 0x00, 0x60, 0x1E, 0x6B, 0xF0, 0x2F, 0xFE, 0x90, 0x34, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3E,
-    0x41, 0x40, 0x2F, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0xA6, 0x30, 0x00,
-    0x0C, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0xB4,
-    0x00, 0x00, 0xC0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x3C, 0x30, 0x03, 0x55, 0x80, 0x0C,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x01, 0xF8, 0x00, 0x0D, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBD, 0x00, 0x2D, 0x0D, 0x02, 0xC0, 0x18, 0x1E, 0x6B, 0xF0, 0xBF, 0xFA, 0x43,
-    0x40, 0x00, 0x0E, 0x00, 0x00, 0x3E, 0x41, 0x40, 0xBF, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3F, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xE4, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x0B,
-    0xE0, 0x00, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40,
-    0x02, 0xD0, 0xD0, 0x0B, 0x00, 0x60, 0x1E, 0x6B, 0xF0, 0x2F, 0xFE, 0x90, 0x34, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x3E, 0x41, 0x40, 0x2F, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x1C, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0xB8,
-    0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00,
-    0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x69, 0x00, 0x0D, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x02,
-    0x80, 0x03, 0x40, 0x07, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x1D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00,
-    0x1F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03,
-    0xC0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x19, 0x00, 0x0F, 0x40, 0x07, 0xD0, 0x00, 0x00, 0x09, 0x00, 0x2E, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xB0, 0x00, 0xE0, 0x00, 0xD0, 0x01, 0xC0, 0x02, 0x80,
-    0x03, 0x80, 0x07, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x09, 0x00, 0x2D, 0x00, 0x3D, 0x00,
-    0x00, 0x02, 0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8,
-    0x07, 0xC0, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4,
-    0x2D, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80,
-    0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x0F, 0xAB, 0x40, 0xF0, 0x0E, 0x07, 0x00, 0x2C, 0x3C, 0x00, 0xE0, 0xE0, 0x03,
-    0x83, 0x80, 0x2C, 0x0F, 0xAB, 0xE0, 0x2F, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x3C, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00,
-    0x01, 0xC0, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0,
-    0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00,
-    0x00, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA,
-    0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x01, 0xC0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x03, 0xEA, 0xD0, 0x3C, 0x03, 0x81, 0xC0, 0x0B,
-    0x0F, 0x00, 0x38, 0x38, 0x00, 0xE0, 0xE0, 0x0B, 0x03, 0xEA, 0xF8, 0x0B, 0xFF, 0x80, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0x82, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x04, 0x00, 0x2F, 0xAB, 0xE0, 0x28, 0x00,
-    0xFC, 0x01, 0xF4, 0x70, 0x02, 0xF0, 0x00, 0xB8, 0xD0, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0x40,
-    0x00, 0x78, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x2D, 0x00, 0x00,
-    0xF0, 0x00, 0x2D, 0x00, 0x02, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xEA, 0xBF, 0x80,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0xD0,
-    0x01, 0xC0, 0x00, 0xBD, 0x00, 0xE0, 0x00, 0x60, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xEA, 0xD0, 0x00, 0x03, 0xC0, 0x38, 0x00, 0x01,
-    0xC0, 0x0B, 0x00, 0x00, 0xF0, 0x03, 0x80, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0xB0, 0x00,
-    0x03, 0xEA, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07, 0xC0,
-    0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D, 0x00,
-    0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0x40, 0x00, 0x2F, 0x40, 0x01, 0x82, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x0F, 0xAB, 0x40, 0xF0, 0x0E, 0x07, 0x00, 0x2C, 0x3C,
-    0x00, 0xE0, 0xE0, 0x03, 0x83, 0x80, 0x2C, 0x0F, 0xAB, 0xE0, 0x2F, 0xFE, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0x82, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0x00, 0xFC, 0x01,
-    0xF4, 0x00, 0x02, 0xF0, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0x40, 0x00, 0x78,
-    0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00,
-    0x2D, 0x00, 0x02, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xEA, 0xBF, 0x80, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x49, 0x00, 0x00, 0x28, 0x00, 0x00, 0x10, 0x00,
-    0x2C, 0x00, 0x00, 0x3B, 0x40, 0x00, 0xC0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x03, 0xEA, 0xD0, 0x0F, 0x00, 0xE0, 0x1C, 0x00, 0xB0, 0x3C, 0x00, 0xE0,
-    0x38, 0x00, 0xE0, 0x38, 0x02, 0xC0, 0x3E, 0xAF, 0x80, 0x2F, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x01, 0xE0, 0xC0, 0x00, 0x03, 0x25, 0x80, 0x00, 0x06, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07,
-    0xC0, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D,
-    0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x20, 0x03, 0x65, 0x80, 0x1C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x0B, 0xB0, 0x00, 0x60, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0xFA, 0xB4,
-    0x0F, 0x00, 0xE0, 0x70, 0x02, 0xC3, 0xC0, 0x0E, 0x0E, 0x00, 0x38, 0x38, 0x02, 0xC0, 0xFA, 0xBE,
-    0x02, 0xFF, 0xE0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01,
-    0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC,
-    0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00,
-    0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00,
-    0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0xBD, 0x00, 0x06, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x3E, 0xAD, 0x03, 0xC0, 0x38, 0x1C, 0x00, 0xB0, 0xF0,
-    0x03, 0x83, 0x80, 0x0E, 0x0E, 0x00, 0xB0, 0x3E, 0xAF, 0x80, 0xBF, 0xF8, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x34,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x02, 0xFE, 0x40, 0x0A, 0x00, 0x2F, 0xAB, 0xE0, 0x1C, 0x00, 0xFC, 0x01, 0xF4, 0x74, 0x02,
-    0xF0, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0x40, 0x00, 0x78, 0x00, 0x0F, 0x00,
-    0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00, 0x2D, 0x00, 0x02,
-    0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xEA, 0xBF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xBF, 0x43, 0x03, 0xEA, 0xDD, 0x0F, 0x00,
-    0xF4, 0x1C, 0x00, 0xB0, 0x3C, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x02, 0xC0, 0x3E, 0xAF, 0x80,
-    0x2F, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0xFE, 0x40, 0x0A, 0x00, 0x2F, 0xAB, 0xE0, 0x1C, 0x00, 0xFC,
-    0x01, 0xF4, 0x74, 0x02, 0xF0, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0x40, 0x00,
-    0x78, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x2D, 0x00, 0x00, 0xF0,
-    0x00, 0x2D, 0x00, 0x02, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xEA, 0xBF, 0x80, 0x00,
-    0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xBF, 0x43, 0x03, 0xEA, 0xDD, 0x0F, 0x00, 0xF4, 0x1C,
-    0x00, 0xB0, 0x3C, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x02, 0xC0, 0x3E, 0xAF, 0x80, 0x2F, 0xFE,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x02, 0xFE, 0x40, 0x0A, 0x00, 0x2F, 0xAB, 0xE0, 0x1C, 0x00, 0xFC, 0x01, 0xF4,
-    0x74, 0x02, 0xF0, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0x40, 0x00, 0x78, 0x00,
-    0x0F, 0x00, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00, 0x2D,
-    0x00, 0x02, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xEA, 0xBF, 0x80, 0x00, 0x1F, 0xFF,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x70, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xBF, 0x43, 0x03, 0xEA, 0xDD, 0x0F, 0x00, 0xF4,
-    0x1C, 0x00, 0xB0, 0x3C, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x02, 0xC0, 0x3E, 0xAF, 0x80, 0x2F,
-    0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xD1, 0x40, 0x00, 0x00, 0x06, 0x33, 0x00, 0x00,
-    0x00, 0x09, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
-    0xFE, 0x40, 0x0A, 0x00, 0x2F, 0xAB, 0xE0, 0x1C, 0x00, 0xFC, 0x01, 0xF4, 0x74, 0x02, 0xF0, 0x00,
-    0xB8, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0x40, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x00, 0x78,
-    0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00, 0x2D, 0x00, 0x02, 0xE0, 0x00,
-    0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xEA, 0xBF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x08, 0x00, 0x33, 0x24, 0x00, 0x50, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0xBF, 0x43, 0x03, 0xEA, 0xDD, 0x0F, 0x00, 0xF4, 0x1C, 0x00, 0xB0, 0x3C, 0x00, 0xE0, 0x38,
-    0x00, 0xE0, 0x38, 0x02, 0xC0, 0x3E, 0xAF, 0x80, 0x2F, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x02, 0xFE, 0x40, 0x0A, 0x00, 0x2F, 0xAB, 0xE0, 0x1C, 0x00, 0xFC, 0x01,
-    0xF4, 0x74, 0x02, 0xF0, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0x40, 0x00, 0x78,
-    0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00,
-    0x2D, 0x00, 0x02, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xEA, 0xBF, 0x80, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xBF, 0x43, 0x03, 0xEA, 0xDD,
-    0x0F, 0x00, 0xF4, 0x1C, 0x00, 0xB0, 0x3C, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x02, 0xC0, 0x3E,
-    0xAF, 0x80, 0x2F, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x3E,
-    0x00, 0x1F, 0x00, 0xF4, 0x00, 0xBC, 0x07, 0xC0, 0x03, 0xE0, 0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x00,
-    0x7C, 0x03, 0xC0, 0x02, 0xE0, 0x1F, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x3C, 0x02, 0xE0, 0x02, 0xE0,
-    0x0F, 0xD0, 0x2F, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x0E, 0x00, 0xB0, 0x38, 0x03, 0xC0, 0xD0, 0x0E, 0x07, 0x00, 0x74, 0x2C, 0x02, 0xC0,
-    0xF0, 0x0F, 0x03, 0xC0, 0xB8, 0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0x40, 0x7F, 0x6C, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x49,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3E, 0x03, 0xE0, 0x01, 0xF0, 0x0F, 0x40, 0x0B, 0xC0, 0x7C,
-    0x00, 0x3E, 0x02, 0xF0, 0x00, 0xF4, 0x0F, 0x80, 0x07, 0xC0, 0x3C, 0x00, 0x2E, 0x01, 0xF0, 0x00,
-    0xF4, 0x0B, 0x80, 0x03, 0xC0, 0x2E, 0x00, 0x2E, 0x00, 0xFD, 0x02, 0xF4, 0x03, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00,
-    0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0B, 0x03,
-    0x80, 0x3C, 0x0D, 0x00, 0xE0, 0x70, 0x07, 0x42, 0xC0, 0x2C, 0x0F, 0x00, 0xF0, 0x3C, 0x0B, 0x80,
-    0xFF, 0xFE, 0x03, 0xFF, 0xF4, 0x07, 0xF6, 0xC0, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x2F, 0x00, 0x0F, 0x9C, 0x03, 0xF0, 0x01, 0xFF,
-    0x80, 0x3D, 0x00, 0x2F, 0x50, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x0F, 0x80,
-    0x07, 0xC0, 0x00, 0xF0, 0x00, 0xB8, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x01, 0xE0, 0x00, 0xF0, 0x00,
-    0x2E, 0x00, 0x2E, 0x00, 0x03, 0xF4, 0x0B, 0xD0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xC0, 0x00, 0x03, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x0E, 0x00, 0xB6, 0x0E, 0x00, 0xFC, 0x0D, 0x00, 0xF0, 0x1C, 0x01, 0xD0, 0x2C, 0x02, 0xC0, 0x3C,
-    0x03, 0xC0, 0x3C, 0x0B, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x40, 0x1F, 0xDB, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xF9, 0xC0, 0x3F, 0x00,
-    0x1F, 0xF8, 0x03, 0xD0, 0x02, 0xF5, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x03, 0xD0, 0x00,
-    0xF8, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x0B, 0x80, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0x1E, 0x00, 0x0F,
-    0x00, 0x02, 0xE0, 0x02, 0xE0, 0x00, 0x3F, 0x40, 0xBD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0E, 0x00, 0xB6, 0x0E,
-    0x00, 0xFC, 0x0D, 0x00, 0xF0, 0x1C, 0x01, 0xD0, 0x2C, 0x02, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x0B,
-    0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x40, 0x1F, 0xDB, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-    0x01, 0x24, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0x9C, 0x03, 0xF0,
-    0x01, 0xFF, 0x80, 0x3D, 0x00, 0x2F, 0x50, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x3D, 0x00,
-    0x0F, 0x80, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0xB8, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x01, 0xE0, 0x00,
-    0xF0, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x03, 0xF4, 0x0B, 0xD0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80,
-    0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0E,
-    0x00, 0xB6, 0x0E, 0x00, 0xFC, 0x0D, 0x00, 0xF0, 0x1C, 0x01, 0xD0, 0x2C, 0x02, 0xC0, 0x3C, 0x03,
-    0xC0, 0x3C, 0x0B, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x40, 0x1F, 0xDB, 0x00, 0x00, 0x00, 0xA0,
-    0x80, 0x00, 0x00, 0x25, 0x4C, 0x00, 0x00, 0x03, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0xF0, 0x00, 0xF9, 0xC0, 0x3F, 0x00, 0x1F,
-    0xF8, 0x03, 0xD0, 0x02, 0xF5, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x03, 0xD0, 0x00, 0xF8,
-    0x00, 0x7C, 0x00, 0x0F, 0x00, 0x0B, 0x80, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0x1E, 0x00, 0x0F, 0x00,
-    0x02, 0xE0, 0x02, 0xE0, 0x00, 0x3F, 0x40, 0xBD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xF4, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x30, 0x00,
-    0xC9, 0x60, 0x00, 0x83, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0E, 0x00, 0xB6, 0x0E, 0x00,
-    0xFC, 0x0D, 0x00, 0xF0, 0x1C, 0x01, 0xD0, 0x2C, 0x02, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x0B, 0x80,
-    0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x40, 0x1F, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x0F, 0x9C, 0x03, 0xF0, 0x01, 0xFF, 0x80, 0x3D, 0x00, 0x2F, 0x50, 0x07, 0xC0, 0x03, 0xE0, 0x00,
-    0xBC, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0xB8, 0x00, 0x1F, 0x00, 0x0F,
-    0x40, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x03, 0xF4, 0x0B, 0xD0, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0E, 0x00, 0xB6, 0x0E, 0x00, 0xFC, 0x0D,
-    0x00, 0xF0, 0x1C, 0x01, 0xD0, 0x2C, 0x02, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x0B, 0x80, 0x3F, 0xFF,
-    0x80, 0x3F, 0xFF, 0x40, 0x1F, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x2E, 0x3C, 0x00, 0x7C, 0x3D, 0x00, 0xF0, 0x2E, 0x03, 0xD0, 0x2F, 0x0F,
-    0x40, 0x1F, 0x2E, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0xF0, 0x07, 0x40, 0x74, 0x00, 0xE0, 0x3C, 0x00, 0x3C, 0x1D, 0x00, 0x0F, 0x0F, 0x00,
-    0x02, 0xEB, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0xBD, 0x00, 0x07, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x02, 0xE0, 0x3C, 0x00, 0x7C, 0x03, 0xD0, 0x0F, 0x00, 0x2E, 0x03, 0xD0, 0x02,
-    0xF0, 0xF4, 0x00, 0x1F, 0x2E, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x0F, 0x00, 0x74,
-    0x07, 0x40, 0x0E, 0x03, 0xC0, 0x03, 0xC1, 0xD0, 0x00, 0xF0, 0xF0, 0x00, 0x2E, 0xB4, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x0B,
-    0xD0, 0x00, 0x7F, 0xD0, 0x24, 0x2F, 0x80, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0x40, 0x00,
-    0x04, 0x90, 0x00, 0x02, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x2E, 0x3C, 0x00, 0x7C, 0x3D, 0x00, 0xF0, 0x2E, 0x03, 0xD0, 0x2F, 0x0F, 0x40,
-    0x1F, 0x2E, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
-    0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
-    0x13, 0x40, 0x00, 0x02, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x0F, 0x00, 0x74, 0x07, 0x40, 0x0E, 0x03, 0xC0, 0x03,
-    0xC1, 0xD0, 0x00, 0xF0, 0xF0, 0x00, 0x2E, 0xB4, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x20, 0x00, 0x96, 0x30, 0x00, 0xC2, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x2E, 0x3C, 0x00, 0x7C, 0x3D, 0x00,
-    0xF0, 0x2E, 0x03, 0xD0, 0x2F, 0x0F, 0x40, 0x1F, 0x2E, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x02, 0x82, 0x00, 0x03, 0x64, 0xC0, 0x00, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x3C, 0x01, 0xD0, 0x1D, 0x00,
-    0x38, 0x0F, 0x00, 0x0F, 0x07, 0x40, 0x03, 0xC3, 0xC0, 0x00, 0xBA, 0xD0, 0x00, 0x1F, 0xF0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x40, 0x01,
-    0xFF, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x1F, 0xFF, 0xC0, 0x2A,
-    0xAA, 0x1F, 0xFF, 0xC0, 0x1A, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xD0, 0x2A, 0xAA, 0xA8, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA9, 0x5F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0xAA, 0xAA, 0xA9, 0x5F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x18, 0x02, 0x80, 0x90, 0x0D, 0x03, 0x00, 0x30, 0x1C, 0x01, 0x80, 0xA0, 0x0D, 0x03, 0x00, 0x30,
-    0x0C, 0x01, 0xC0, 0xA0, 0x0A, 0x03, 0x40, 0x30, 0x0C, 0x00, 0xC0, 0x60, 0x0A, 0x02, 0x40, 0x34,
-    0x0C, 0x00, 0xC0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x92, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x4A, 0xAA, 0xAA, 0xA0, 0x14, 0x03, 0xE0,
-    0x2F, 0x00, 0xF4, 0x0B, 0xC0, 0x28, 0x0B, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x68, 0x00, 0x01, 0x40,
-    0xFC, 0x1F, 0x42, 0xF0, 0x3D, 0x06, 0x80, 0x14, 0x03, 0xE0, 0x2F, 0x00, 0xF4, 0x0B, 0xC0, 0x28,
-    0x14, 0x14, 0x03, 0xE3, 0xE0, 0x2F, 0x2F, 0x00, 0xF4, 0xF0, 0x0B, 0xCB, 0xC0, 0x28, 0x28, 0x01,
-    0x41, 0x40, 0xBC, 0xFC, 0x0F, 0x8F, 0x41, 0xF1, 0xF0, 0x3D, 0x3D, 0x06, 0x86, 0x80, 0x01, 0x40,
-    0xFC, 0x1F, 0x42, 0xF0, 0x3D, 0x06, 0x80, 0x3E, 0x3E, 0x02, 0xF2, 0xF0, 0x0F, 0x4F, 0x40, 0xBC,
-    0xBC, 0x02, 0x92, 0x90, 0x00, 0x34, 0x00, 0x0D, 0x00, 0x07, 0x00, 0x02, 0xC0, 0x00, 0xD0, 0x00,
-    0x30, 0x00, 0x1D, 0x51, 0xFF, 0xFD, 0x53, 0x80, 0x00, 0xC0, 0x00, 0x70, 0x00, 0x28, 0x00, 0x0D,
-    0x00, 0x03, 0x00, 0x01, 0xC0, 0x00, 0xA0, 0x00, 0x34, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x01, 0x80,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x0D, 0x00, 0x00, 0x30, 0x00, 0x01,
-    0xC0, 0x00, 0x0A, 0x00, 0x00, 0x34, 0x00, 0x00, 0xD5, 0x00, 0xFF, 0xFE, 0x01, 0x38, 0x00, 0x00,
-    0xD0, 0x00, 0x03, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xA0, 0x00, 0x17, 0x94, 0x03, 0xFF, 0xE0, 0x00,
-    0x70, 0x00, 0x02, 0x80, 0x00, 0x0D, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x03, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0xFF, 0xFD, 0x03, 0xFF,
-    0xF4, 0x2F, 0xFF, 0xC0, 0xFF, 0xFF, 0x0B, 0xFF, 0xFC, 0x3F, 0xFF, 0xF2, 0xFF, 0xFF, 0x80, 0x00,
-    0x0D, 0x07, 0xE2, 0xF8, 0xA0, 0x00, 0x00, 0x0A, 0x1E, 0x3E, 0x0A, 0x1E, 0x3E, 0x0A, 0x00, 0xA0,
-    0x18, 0x1E, 0x02, 0xE0, 0x3C, 0x3E, 0x03, 0xD0, 0xBC, 0x25, 0xD0, 0x00, 0x00, 0x00, 0x80, 0x05,
-    0x00, 0x30, 0x02, 0x10, 0x09, 0x00, 0x26, 0x02, 0x80, 0x03, 0x20, 0x70, 0x00, 0x3C, 0x1C, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x02, 0xC5,
-    0x00, 0x00, 0x71, 0x55, 0x40, 0x1D, 0x25, 0x94, 0x03, 0x82, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x68, 0x00, 0x01, 0x41, 0x40, 0xBC, 0xFC, 0x0F, 0x8F, 0x41,
-    0xF1, 0xF0, 0x3D, 0x3D, 0x06, 0x86, 0x80, 0x00, 0x00, 0x00, 0x18, 0x0D, 0x0D, 0x3C, 0x1C, 0x1D,
-    0x34, 0x38, 0x2C, 0x60, 0x30, 0x34, 0x00, 0x00, 0x00, 0x00, 0x30, 0x34, 0x28, 0x0C, 0x00, 0x00,
-    0x00, 0x28, 0x70, 0x3C, 0x74, 0x1C, 0x38, 0x09, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x34,
-    0x28, 0x34, 0x38, 0x2C, 0x28, 0x2C, 0x0C, 0x0C, 0x0C, 0x09, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x2B,
-    0x47, 0x47, 0x40, 0x00, 0x10, 0x1D, 0x0B, 0x03, 0x80, 0x7C, 0x02, 0xE0, 0x0F, 0x00, 0x10, 0x40,
-    0x07, 0x40, 0x0E, 0x00, 0x2C, 0x03, 0xD0, 0xF8, 0x0F, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x3D, 0x00, 0x3C, 0xF8, 0x00, 0x02, 0xF0, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0x80, 0x1F,
-    0x40, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x00, 0x06, 0x7F, 0xFC,
-    0x00, 0x90, 0x00, 0xF5, 0xFE, 0x00, 0x2E, 0x00, 0x1F, 0x6F, 0xD0, 0x03, 0xD0, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x07, 0xF7, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00,
-    0xFE, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0xF0, 0x00, 0x1F, 0xE0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xC0, 0x00, 0xB0,
-    0x00, 0x38, 0x00, 0x1D, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0x01, 0xD0, 0x00, 0xB0, 0x00, 0x3C, 0x00,
-    0x1E, 0x00, 0x0B, 0x40, 0x00, 0x40, 0x01, 0x40, 0x00, 0xF4, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x7F, 0xE0, 0x02, 0xFE, 0xF8, 0x01, 0x1C, 0x3C, 0x00,
-    0x2C, 0x3C, 0x00, 0x38, 0x38, 0x00, 0x78, 0xB4, 0x00, 0xB5, 0xE0, 0x00, 0xFB, 0xC0, 0x00, 0xFF,
-    0x00, 0x01, 0xF8, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2A,
-    0xAA, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x30, 0x09, 0x3E, 0xB8, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x99, 0x80, 0x00, 0x2D, 0x00, 0x00, 0xAA, 0x40, 0x00, 0x20, 0x00, 0x02, 0x00,
-    0x84, 0x66, 0x9A, 0xE4, 0x1F, 0x02, 0xD0, 0xA9, 0xD9, 0x54, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x28, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x03, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x2F, 0xE0, 0x07, 0xEB, 0xE1, 0xFA, 0xFC,
-    0x05, 0x00, 0xF0, 0x40, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00,
-    0x02, 0xD0, 0x00, 0x78, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xD0, 0x01, 0xFC,
-    0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x0B, 0x80, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x02,
-    0xE0, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0x04, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x0B, 0x40, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x00, 0x68, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x0B, 0xAB, 0xD0, 0x10, 0x90, 0x1F, 0x0E, 0x00, 0x00,
-    0xF0, 0xD0, 0x00, 0x0E, 0x1C, 0x00, 0x02, 0xD3, 0xC0, 0x00, 0x78, 0x38, 0x00, 0x1F, 0x07, 0x40,
-    0x0B, 0xC0, 0xF0, 0x07, 0xF0, 0x0F, 0x00, 0xB8, 0x01, 0xE0, 0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x03,
-    0xC0, 0x19, 0x00, 0x14, 0x00, 0x00, 0x05, 0x00, 0x28, 0x01, 0xF0, 0x03, 0xC0, 0x3F, 0x00, 0xBC,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xEB, 0xF0,
-    0x00, 0x08, 0x80, 0x2D, 0x00, 0x0B, 0x00, 0x07, 0x40, 0x03, 0x80, 0x02, 0xD0, 0x01, 0xD0, 0x00,
-    0xF0, 0x00, 0xB0, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0x1D, 0x01, 0xF8, 0x00, 0x0B, 0x03,
-    0xF8, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x01, 0xE0, 0x7C, 0x00, 0x00, 0xB4, 0x2E, 0x00, 0x00, 0x3C,
-    0x0A, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0xA0, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x03,
-    0xF0, 0x3D, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x2D, 0x1C, 0x00, 0x00, 0x0F, 0x0D, 0x00, 0x00, 0x06, 0x8B, 0x00, 0x00, 0x00,
-    0x03, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x2C, 0xB0, 0x00, 0x00, 0x0D, 0x3C, 0x00,
-    0x00, 0x0B, 0x1A, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x88, 0x20, 0x82, 0x48, 0x62, 0x47, 0xF0,
-    0x14, 0x00, 0x00, 0x00, 0x90, 0x64, 0x4C, 0x7F, 0x82, 0x80, 0x0A, 0x81, 0x40, 0x20, 0x02, 0xA4,
-    0x02, 0x4B, 0xE0, 0x00, 0x00, 0x02, 0x80, 0x80, 0x3A, 0x03, 0x18, 0x61, 0x43, 0xE0, 0x00, 0x00,
-    0x2A, 0x40, 0x50, 0x30, 0x28, 0x0C, 0x0B, 0x02, 0x40, 0x01, 0x00, 0x88, 0x14, 0xC1, 0xF0, 0x20,
-    0x8A, 0x28, 0x29, 0x00, 0x01, 0x40, 0x8C, 0x20, 0x83, 0x0C, 0x1E, 0xC0, 0x24, 0x7E, 0x00, 0x00,
-    0x01, 0x40, 0x07, 0xFF, 0xC0, 0x2F, 0x07, 0x40, 0xF0, 0x1D, 0x07, 0x80, 0x74, 0x2C, 0x03, 0xC0,
-    0xF0, 0x0F, 0x07, 0xC0, 0x78, 0x2E, 0x02, 0xE0, 0xF4, 0x0F, 0x40, 0x00, 0x10, 0x00, 0x92, 0x40,
-    0x60, 0x60, 0x32, 0x18, 0x1C, 0xC9, 0x0A, 0x03, 0x02, 0xC3, 0x80, 0xBF, 0xC0, 0x0F, 0x80, 0x00,
-    0x00, 0x02, 0xC0, 0x30, 0x14, 0x08, 0x03, 0x0B, 0xF0, 0x06, 0x80, 0x49, 0x00, 0x90, 0x1C, 0x0B,
-    0x03, 0xD0, 0x7F, 0x40, 0x05, 0x40, 0x05, 0x00, 0x40, 0xB8, 0x00, 0xC1, 0x28, 0x7E, 0x00, 0x00,
-    0x00, 0x1C, 0x05, 0x81, 0x54, 0x3F, 0xC0, 0x30, 0x07, 0x00, 0x0A, 0x80, 0x40, 0x10, 0x01, 0xA4,
-    0x02, 0x47, 0xE0, 0x00, 0x00, 0x01, 0x90, 0x90, 0x2A, 0x43, 0x8C, 0x30, 0xC3, 0x18, 0x2E, 0x00,
-    0x2A, 0x80, 0x18, 0x03, 0x00, 0x70, 0x0D, 0x01, 0xC0, 0x24, 0x00, 0x00, 0x40, 0x82, 0x0C, 0x90,
-    0xF8, 0x30, 0xC3, 0x1C, 0x2E, 0x00, 0x01, 0x40, 0x89, 0x14, 0x62, 0x49, 0x0A, 0xC0, 0x18, 0x3F,
-    0x00, 0x00, 0x03, 0x80, 0x02, 0xC0, 0x01, 0xC0, 0x00, 0xD0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x38,
-    0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x40, 0x02, 0xC0, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x1D, 0x00,
-    0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x40, 0x01, 0xD0, 0x00, 0x38, 0x00,
-    0x0F, 0x00, 0x01, 0x40, 0x00, 0x70, 0x00, 0x02, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x34, 0x00, 0x02,
-    0xC0, 0x00, 0x0E, 0x00, 0x00, 0x74, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x0B,
-    0x00, 0x00, 0x70, 0x00, 0x03, 0x40, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80,
-    0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x07, 0x80, 0x00, 0x74, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0E, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0x1C, 0x38, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x0F, 0xE2, 0xC0, 0x00, 0x3F, 0xC3, 0x40, 0x00,
-    0xFB, 0x8B, 0x00, 0x01, 0xF7, 0x0D, 0x00, 0x03, 0xDE, 0x2C, 0x00, 0x07, 0xDC, 0x34, 0x00, 0x0B,
-    0xF8, 0xB0, 0x00, 0x0F, 0xF0, 0xD0, 0x00, 0x0F, 0xF2, 0xC1, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x0E, 0xFF, 0xF8, 0x00, 0x2C, 0x34, 0x00, 0x00, 0x34,
-    0xB0, 0x00, 0x00, 0xB0, 0xC0, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFD, 0x00, 0x0B, 0xFF, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0xEE, 0x02, 0xF0, 0x0F, 0x90, 0x3F, 0x02,
-    0xC0, 0x03, 0xF8, 0x38, 0x00, 0x3F, 0xFB, 0xFC, 0x02, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF4, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x07,
-    0xFF, 0x40, 0x02, 0xE4, 0x2C, 0x00, 0x38, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0xBE, 0xA8, 0x00,
-    0x1F, 0xFF, 0xC0, 0x00, 0x34, 0x00, 0x00, 0x1B, 0xEA, 0x40, 0x03, 0xFF, 0xF4, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0xFA, 0x90, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x0B, 0x80, 0x03, 0xC0, 0x03, 0xF0, 0x02, 0xE0, 0x01, 0xFD, 0x00, 0xF0,
-    0x00, 0xBF, 0x40, 0x7C, 0x00, 0x3E, 0xE0, 0x2E, 0x00, 0x1F, 0x7C, 0x0F, 0x40, 0x0B, 0x8F, 0x07,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x46, 0xF5, 0xFE, 0xF9, 0x40, 0xFC, 0x2E, 0x7C, 0x00, 0x3E, 0x07,
-    0xEE, 0x00, 0x1F, 0x40, 0xFF, 0x40, 0x0F, 0xC0, 0x3F, 0xC0, 0x03, 0xF0, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0xFA, 0xBE, 0x00, 0x0B, 0x40, 0x3C, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xF0,
-    0x0B, 0x80, 0x07, 0x80, 0x7C, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x24, 0x0D, 0x00, 0x00, 0x00, 0xD0, 0x34, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x00,
-    0x1C, 0x1F, 0x00, 0x1F, 0xC0, 0xBF, 0xF4, 0x01, 0xD5, 0x03, 0xFF, 0x40, 0x09, 0x00, 0x0F, 0xEF,
-    0x00, 0x38, 0x00, 0x78, 0x2C, 0x00, 0xBD, 0x02, 0xD0, 0xB0, 0x00, 0xBD, 0x0F, 0x03, 0xC0, 0x00,
-    0x38, 0x3C, 0x0F, 0x00, 0x66, 0xE1, 0xF0, 0x3C, 0x03, 0xFF, 0x0B, 0x81, 0xF0, 0x0B, 0xF4, 0x00,
-    0x02, 0x80, 0x00, 0xA0, 0x38, 0x00, 0x0D, 0x03, 0x80, 0x01, 0xC0, 0x34, 0x00, 0x28, 0x03, 0x43,
-    0x43, 0x42, 0xFF, 0xFF, 0xFE, 0x2B, 0xEF, 0xEF, 0x80, 0x35, 0xF8, 0xE0, 0x03, 0x6E, 0xCC, 0x00,
-    0x3B, 0xAE, 0xC0, 0x03, 0xF2, 0xF8, 0x00, 0x3F, 0x1F, 0x40, 0x03, 0xD1, 0xF0, 0x00, 0x3C, 0x1F,
-    0x00, 0x03, 0x81, 0xE0, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x40, 0x2F, 0x57,
-    0xC0, 0xB0, 0x0F, 0x00, 0x34, 0x38, 0x03, 0x40, 0x0D, 0x0D, 0x01, 0xC1, 0x83, 0x47, 0x00, 0xB0,
-    0xE1, 0xC2, 0xC0, 0x38, 0x34, 0xB0, 0xE0, 0x0D, 0x0C, 0x00, 0x34, 0x07, 0x07, 0x00, 0x2C, 0x02,
-    0xC0, 0xE0, 0x1F, 0x00, 0xD0, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x6B, 0xD0, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x17, 0xD4, 0x00, 0xBC, 0xD0, 0x00, 0xE7, 0xF0,
-    0x00, 0xA0, 0x3C, 0x00, 0x30, 0x0D, 0x00, 0x28, 0x0B, 0x00, 0x0B, 0x47, 0xC0, 0x01, 0xFF, 0xE0,
-    0x00, 0x2F, 0xA4, 0x00, 0x15, 0x55, 0x40, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0E, 0x10, 0x00, 0xBF,
-    0xFD, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE1, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x2D, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x1B, 0xE4, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x13, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0F, 0xAB, 0xE0, 0x00, 0x07, 0x40, 0x3C, 0x00, 0x2B, 0xEA, 0xAF,
-    0xA8, 0x0A, 0xFA, 0xAB, 0xE9, 0x00, 0x78, 0x07, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF,
-    0x90, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0xD4, 0x00, 0x1F,
-    0xFF, 0xF0, 0x0F, 0xE7, 0x01, 0x02, 0xF0, 0x70, 0x00, 0x7D, 0x0A, 0x00, 0x0B, 0xC0, 0xD0, 0x00,
-    0xF4, 0x0C, 0x00, 0x1F, 0x00, 0xD0, 0x01, 0xF0, 0x1F, 0xFE, 0x2E, 0x02, 0x97, 0xF3, 0xF0, 0x34,
-    0x34, 0x3F, 0x83, 0x1F, 0x42, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x40, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x6A, 0xAA, 0xAA, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xAA, 0xAA, 0xA8, 0x07, 0xF9,
-    0x15, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x02, 0xFC, 0x07,
-    0xFA, 0x03, 0xCC, 0x01, 0xD3, 0x00, 0xF1, 0x80, 0x38, 0x90, 0x0E, 0x30, 0x03, 0xEC, 0x00, 0xFF,
-    0xE0, 0x0B, 0xFC, 0x00, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x2A, 0xAF, 0x6A, 0x40, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x28, 0x00, 0x01, 0xC0, 0x1F, 0xFF, 0xC0, 0x0B,
-    0x00, 0x3F, 0x90, 0x03, 0xF8, 0x00, 0x02, 0xC0, 0x00, 0x2D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x01, 0xC6, 0x40, 0x2F, 0xF0, 0x1F, 0xD0, 0x03,
-    0xB4, 0x50, 0x07, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x02, 0xC0, 0xD0, 0xF0, 0x1E, 0xB8, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xFF, 0xD0,
-    0x03, 0xFE, 0xE0, 0x0B, 0x68, 0xF0, 0x0F, 0x34, 0xA0, 0x0D, 0x30, 0xD0, 0x1C, 0x30, 0xC0, 0x28,
-    0x61, 0xC0, 0x34, 0x92, 0x80, 0x30, 0xC3, 0x40, 0x70, 0xC7, 0x00, 0x00, 0x03, 0xFF, 0x90, 0x00,
-    0x03, 0xEA, 0xF8, 0x00, 0x07, 0x40, 0x3C, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x38, 0x00,
-    0x1E, 0x01, 0xF0, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFE, 0x40, 0x05, 0xBC, 0x00, 0x00, 0x2A,
-    0xFE, 0xA0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03, 0x00, 0x00, 0x34, 0x00, 0x02,
-    0xC0, 0x1D, 0x0D, 0x6F, 0xE0, 0xFF, 0x90, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xFD, 0x00, 0x1E, 0xED, 0x02, 0xC7,
-    0x2C, 0x38, 0x28, 0x38, 0x00, 0xD0, 0x00, 0x07, 0x00, 0x00, 0x28, 0x00, 0x00, 0xD0, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xD0, 0x29, 0x00, 0xC0, 0x6F, 0xE6, 0xC0,
-    0x01, 0xBF, 0x80, 0x00, 0x1F, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x28, 0x00, 0x00, 0x70, 0x00, 0xD0,
-    0xC0, 0xD0, 0xE3, 0x8F, 0x00, 0xBF, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x18, 0x00, 0xC0, 0x66, 0x40, 0x90, 0x2A,
-    0xF9, 0x1B, 0xE7, 0x07, 0xE4, 0x00, 0x01, 0xBC, 0x38, 0x00, 0x00, 0x07, 0x40, 0xE0, 0x00, 0x01,
-    0xD0, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x7F, 0x00, 0xAA, 0xE0, 0xD3, 0x4D, 0x00,
-    0xC0, 0x00, 0x60, 0x00, 0x24, 0x00, 0x0C, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x00, 0x24, 0x00, 0x06,
-    0x00, 0x00, 0xC0, 0x1D, 0x30, 0x90, 0xEA, 0xB0, 0x07, 0xF0, 0x00, 0x30, 0x00, 0x00, 0x6B, 0x07,
-    0xFA, 0x40, 0x7E, 0x00, 0x07, 0x3D, 0x00, 0x70, 0x7D, 0x07, 0x00, 0xBC, 0x30, 0x00, 0x90, 0x07,
-    0x94, 0x00, 0x05, 0xBF, 0xC0, 0x00, 0x7F, 0x00, 0x0B, 0x9C, 0x02, 0xE0, 0x70, 0x7D, 0x01, 0xC2,
-    0x40, 0x07, 0x00, 0x20, 0x00, 0x34, 0x00, 0x2C, 0x09, 0x0D, 0x0C, 0x0B, 0x0C, 0x03, 0x58, 0x02,
-    0xE4, 0x00, 0xF0, 0xFF, 0xF0, 0x05, 0xA0, 0x00, 0x14, 0x00, 0x38, 0x80, 0x70, 0x90, 0xE0, 0x60,
-    0xC0, 0x32, 0x80, 0x37, 0x00, 0x2E, 0x00, 0x1F, 0xFD, 0x0A, 0x50, 0x00, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x2C, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x04, 0x40, 0x00, 0x0D, 0x28, 0x00, 0x1F, 0x0F, 0x40, 0x2D, 0xC3, 0x74, 0x2D, 0x21, 0x8B, 0x2C,
-    0x14, 0x90, 0xD0, 0x08, 0x30, 0x00, 0x03, 0x1C, 0x00, 0x01, 0x8A, 0x00, 0x00, 0x93, 0x00, 0x00,
-    0x30, 0xC0, 0x00, 0x0C, 0x60, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x00, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xD2, 0xFF, 0xFF, 0xC0,
-    0x00, 0x03, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x83, 0x00,
-    0x00, 0x14, 0x90, 0x00, 0x02, 0x18, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x20, 0xC0, 0x0A, 0x06, 0x24,
-    0x24, 0xF0, 0xC6, 0x1D, 0x0B, 0x70, 0xCE, 0x00, 0x7D, 0x3F, 0x00, 0x07, 0x8B, 0x00, 0x00, 0x21,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0xC0, 0x00, 0x2C, 0x00, 0xD0, 0x00,
-    0x07, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x3F, 0xFF, 0xFF, 0xFC, 0x2C, 0x00, 0x00, 0x03, 0xC3, 0x80,
-    0x00, 0x02, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x3C, 0x02, 0xC0, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x07, 0xF4, 0x00, 0x35, 0xFE, 0x03, 0xC5, 0x28, 0x3F,
-    0x14, 0x01, 0xCC, 0x50, 0x00, 0x31, 0x40, 0x00, 0xC5, 0x00, 0x03, 0x14, 0x00, 0x0C, 0x50, 0x07,
-    0x31, 0x40, 0x0F, 0xC5, 0x00, 0x0F, 0x14, 0xA0, 0x0D, 0x7F, 0x80, 0x1F, 0xD0, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0A,
-    0x00, 0x01, 0x03, 0x40, 0x1F, 0xF1, 0xC0, 0x1E, 0x0A, 0xD0, 0x0E, 0x00, 0xF0, 0x07, 0x00, 0x38,
-    0x02, 0xC0, 0x1C, 0x00, 0xB8, 0x6D, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0xA0, 0x00, 0xBE, 0xAF, 0xF0, 0x00, 0xFC, 0x01, 0xF4, 0x00,
-    0xBC, 0x00, 0xFE, 0x00, 0x7C, 0x00, 0xEB, 0xC0, 0x2D, 0x00, 0xE1, 0xE0, 0x0F, 0x00, 0xE0, 0x78,
-    0x07, 0x80, 0xE0, 0x2D, 0x02, 0xD0, 0xE0, 0x0F, 0x00, 0xB4, 0xE0, 0x0B, 0x80, 0x3F, 0xE0, 0x0B,
-    0xD0, 0x0B, 0xFA, 0xAF, 0xE0, 0x02, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xD1, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x1E, 0xE0, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x0B, 0x43, 0xD0, 0x07, 0x80,
-    0xB8, 0x03, 0xC0, 0x1F, 0x03, 0xD0, 0x07, 0xC2, 0xE0, 0x00, 0xF1, 0xFA, 0xAA, 0xBD, 0xBF, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0xB4, 0x2D, 0x00, 0x3C, 0x0B, 0x00, 0x0E, 0x03, 0x80, 0x07,
-    0x40, 0xD0, 0x02, 0xC0, 0x70, 0x00, 0xF0, 0x2C, 0x00, 0x38, 0x0E, 0x00, 0x1D, 0x03, 0x40, 0x0B,
-    0x01, 0xC0, 0x03, 0xC0, 0xB0, 0x00, 0xE0, 0x38, 0x00, 0x24, 0x0A, 0x00, 0x0F, 0x02, 0xC0, 0x02,
-    0xC0, 0x70, 0x00, 0x74, 0x0E, 0x00, 0x0E, 0x03, 0xC0, 0x02, 0xC0, 0xB0, 0x00, 0x70, 0x1D, 0x00,
-    0x0D, 0x03, 0x80, 0x03, 0x80, 0xF0, 0x00, 0xB0, 0x2C, 0x00, 0x2D, 0x07, 0x40, 0x2F, 0xFF, 0xFC,
-    0x02, 0xFF, 0xF8, 0x0A, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x24, 0x00, 0x00, 0x30,
-    0x00, 0x01, 0x80, 0x00, 0x28, 0x00, 0x03, 0x80, 0x00, 0x74, 0x00, 0x07, 0xFF, 0xF0, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x15, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x50, 0xF4,
-    0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x02, 0xFD, 0x1F, 0x80, 0x3E, 0xBD, 0xFB, 0x41, 0xC0, 0x3D, 0x06, 0x0D, 0x00, 0xE0,
-    0x18, 0x30, 0x03, 0x40, 0xD0, 0xD0, 0x7F, 0xAF, 0x03, 0xFF, 0xAF, 0xF0, 0x07, 0xF8, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x41, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x2F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x09, 0x0F, 0x0D,
-    0x1C, 0x09, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x20, 0x3C, 0x34, 0xB0, 0x20, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x24, 0x00, 0x00, 0x09, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x75, 0x00, 0x2F, 0xFF, 0xFC, 0x01, 0x07, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0x38, 0x14, 0x01, 0xFF, 0xFF, 0xD0, 0x02, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xFE,
-    0x40, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x19, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0xFF, 0xE9, 0x50, 0x00, 0x01, 0x6A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x01,
-    0xBF, 0xD0, 0x1B, 0xFF, 0x90, 0x0F, 0xF9, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x5A, 0xFF, 0xE0, 0xBE, 0x95, 0x00, 0x00,
+static const uint8_t opendyslexic_8_italicBitmaps[21564] = {
+    0x69, 0x69, 0xC6, 0xAC, 0x6C, 0xA5, 0x9C, 0x95, 0xAC, 0x6D, 0x59, 0xC9, 0x5A, 0xC6, 0xD5, 0x9C,
+    0xA5, 0xAC, 0x96, 0x95, 0x99, 0x6D, 0x94, 0xAD, 0x94, 0xE4, 0x09, 0x91, 0x99, 0x91, 0xD9, 0x0E,
+    0x1D, 0xA0, 0xAD, 0x1D, 0xA0, 0x9D, 0x1A, 0xD1, 0xD1, 0x9A, 0xA1, 0xAA, 0x90, 0x7C, 0x92, 0xC9,
+    0x72, 0x9C, 0x29, 0xC7, 0x3D, 0x2D, 0x73, 0xC9, 0x2C, 0x96, 0xAF, 0xFF, 0xE2, 0x99, 0x9A, 0xD9,
+    0x99, 0xD9, 0x99, 0x96, 0x9C, 0x91, 0x9C, 0x97, 0x2D, 0x2D, 0x72, 0x9C, 0xA2, 0xCA, 0x79, 0x99,
+    0xDA, 0x99, 0xAC, 0xA9, 0x99, 0x92, 0xAF, 0xFF, 0xDA, 0x5A, 0xCA, 0x19, 0xCA, 0x72, 0xD2, 0xD7,
+    0x29, 0xD2, 0xD7, 0x29, 0x99, 0x29, 0x71, 0x70, 0x90, 0x97, 0x2A, 0xA0, 0xC7, 0x19, 0xFC, 0xA9,
+    0x5F, 0xF9, 0x4F, 0x0A, 0x96, 0x9D, 0xAA, 0x0C, 0x96, 0xD9, 0xC9, 0x0C, 0x7F, 0x99, 0xC7, 0x9F,
+    0xD9, 0x70, 0xAF, 0xD9, 0x6A, 0xA0, 0xFC, 0x6C, 0x90, 0xCA, 0xE9, 0x29, 0x1C, 0x09, 0xFC, 0x2F,
+    0xFE, 0xA0, 0x9F, 0xFE, 0x91, 0x9A, 0xFE, 0xA9, 0x70, 0xC0, 0x9C, 0x72, 0xA0, 0x99, 0x50, 0x73,
+    0x97, 0x3C, 0x92, 0x9D, 0xA3, 0xA9, 0x2A, 0xA1, 0xC2, 0xAA, 0x3C, 0x2C, 0x19, 0xA4, 0xC1, 0x9A,
+    0x09, 0xA5, 0xF0, 0x9C, 0x79, 0x91, 0xDA, 0x71, 0xCA, 0x09, 0xC7, 0xD2, 0xC6, 0xDA, 0x19, 0xA5,
+    0xAC, 0x9C, 0x9A, 0xC5, 0xAC, 0x1A, 0xD9, 0x5A, 0x73, 0x77, 0x29, 0xEA, 0x7D, 0x99, 0x9D, 0x59,
+    0xC9, 0x2D, 0x5A, 0xC2, 0xAC, 0xA5, 0x9C, 0xA0, 0xDA, 0x7A, 0xE9, 0x79, 0xE9, 0x7A, 0xD9, 0xD3,
+    0x91, 0x9D, 0x91, 0xD1, 0xAC, 0x90, 0xE3, 0xD9, 0xD1, 0xDA, 0x39, 0xE2, 0xEA, 0x99, 0xAE, 0xA2,
+    0x9F, 0xEA, 0xAC, 0x39, 0xAE, 0xA9, 0x77, 0x20, 0x99, 0x90, 0xAD, 0x09, 0xD1, 0xD1, 0xDA, 0x6C,
+    0xA5, 0xAC, 0x59, 0xC6, 0xC9, 0x5D, 0x59, 0xC6, 0xCA, 0x59, 0xC6, 0xCA, 0x59, 0xC9, 0x5A, 0xC6,
+    0xCA, 0x6C, 0xA5, 0x9C, 0x95, 0x9C, 0x69, 0xC6, 0x9C, 0x69, 0xC6, 0x9C, 0x95, 0x9C, 0x96, 0xCA,
+    0x6D, 0x69, 0x95, 0x9C, 0x70, 0xAC, 0x70, 0xCA, 0x70, 0xC9, 0x7A, 0xC7, 0x0C, 0xA7, 0x9C, 0x97,
+    0xCA, 0x79, 0xC7, 0x0C, 0xA7, 0xAC, 0x79, 0xC7, 0x0C, 0x97, 0xCA, 0x7C, 0xA7, 0xCA, 0x7C, 0xA7,
+    0xCA, 0x7C, 0xA7, 0xCA, 0x69, 0xCA, 0x69, 0xC9, 0x69, 0x91, 0x49, 0x69, 0xA3, 0xAC, 0x0A, 0x90,
+    0xCA, 0x1A, 0xEA, 0x4A, 0xD9, 0x2A, 0xC9, 0xA9, 0xD1, 0xA0, 0xAA, 0x6A, 0x93, 0x4A, 0x69, 0xC6,
+    0xAC, 0x6C, 0xA2, 0x9F, 0xE3, 0x9C, 0x6A, 0xC6, 0xCA, 0x74, 0x29, 0x92, 0xE1, 0x9D, 0x91, 0xAD,
+    0x2D, 0x91, 0x9A, 0xA2, 0x0A, 0xAA, 0xAA, 0xAA, 0x09, 0xFE, 0x00, 0x1A, 0xA0, 0x9C, 0xA0, 0xDA,
+    0x76, 0xA7, 0x6C, 0x97, 0x5A, 0xC7, 0x6C, 0x97, 0x5A, 0xA7, 0x6C, 0x76, 0xCA, 0x75, 0x9C, 0x76,
+    0xCA, 0x75, 0xAC, 0x76, 0xC9, 0x75, 0xAC, 0x76, 0xC9, 0x75, 0xD7, 0x59, 0xC9, 0x75, 0xCA, 0x75,
+    0x9C, 0x76, 0xCA, 0x75, 0xAC, 0x76, 0xCA, 0x75, 0xD7, 0x59, 0xC9, 0x75, 0xD7, 0x59, 0xC9, 0x75,
+    0xC9, 0x77, 0x76, 0x59, 0xA9, 0x7C, 0x91, 0xC5, 0xC9, 0x2A, 0xA3, 0xD3, 0xAA, 0x29, 0xC9, 0x0C,
+    0x90, 0xAA, 0x2A, 0xC0, 0x9C, 0x90, 0xCA, 0x2D, 0x09, 0xC0, 0x9C, 0x92, 0xCA, 0x3D, 0x29, 0xCA,
+    0x29, 0xCA, 0x29, 0xD1, 0x9D, 0x92, 0x9F, 0xDA, 0x4F, 0xD6, 0xAD, 0xA4, 0x73, 0x9D, 0xA3, 0xCA,
+    0xC9, 0x49, 0xC5, 0xD5, 0xCA, 0x49, 0xC9, 0x4D, 0x5D, 0x49, 0xCA, 0x29, 0x9D, 0xA9, 0x99, 0xFD,
+    0xAA, 0xFD, 0x90, 0x59, 0x96, 0x9F, 0xCA, 0x4A, 0xA9, 0x1A, 0xC9, 0x71, 0xC9, 0x70, 0x9C, 0x97,
+    0x0D, 0x70, 0xD9, 0x69, 0xDA, 0x6A, 0xDA, 0x5A, 0xE9, 0x5A, 0xEA, 0x99, 0x93, 0xFE, 0xA2, 0x9F,
+    0xE9, 0x20, 0x3A, 0xF9, 0x5A, 0x91, 0x9C, 0x97, 0x1A, 0xA7, 0x1A, 0x97, 0x1C, 0x69, 0x9A, 0xC9,
+    0x5F, 0x97, 0x1A, 0xC7, 0x19, 0xC9, 0x70, 0xAC, 0x39, 0xA9, 0x9A, 0xDA, 0x3F, 0xE4, 0xAF, 0x94,
+    0x79, 0x7C, 0xA6, 0xD9, 0x5E, 0x5D, 0x9C, 0x4D, 0x0A, 0xC3, 0xD1, 0xCA, 0x2D, 0x90, 0x9C, 0xA9,
+    0x09, 0xFF, 0x19, 0x99, 0x9D, 0x99, 0x49, 0xD6, 0xAC, 0xA6, 0xDA, 0x20, 0x76, 0xFD, 0x92, 0x9C,
+    0x70, 0xC9, 0x70, 0xC7, 0x09, 0xFA, 0x49, 0x99, 0x99, 0xD7, 0x0A, 0xC9, 0x7A, 0xC9, 0x69, 0xD2,
+    0xAC, 0xAA, 0xE9, 0x2F, 0xDA, 0x3A, 0xEA, 0x93, 0x79, 0x99, 0x59, 0xFC, 0x4A, 0xC9, 0x79, 0xC7,
+    0x1C, 0x97, 0x0A, 0xCA, 0xF4, 0xE9, 0x09, 0xCA, 0x3D, 0x3D, 0x29, 0xC9, 0x3D, 0x29, 0xC9, 0x29,
+    0xCA, 0x29, 0xD1, 0xAD, 0x4F, 0xD9, 0x5A, 0xDA, 0x40, 0x70, 0xAF, 0xE5, 0x9C, 0xA5, 0x9C, 0x95,
+    0xD5, 0x9C, 0x95, 0xD5, 0xAC, 0xA5, 0xD5, 0xAD, 0x5D, 0x94, 0xAD, 0x49, 0xDA, 0x40, 0x5A, 0xAA,
+    0x95, 0xAC, 0x91, 0xAA, 0x4C, 0x92, 0x9C, 0x3A, 0xC3, 0xAC, 0x3A, 0xC2, 0x9C, 0x94, 0xDA, 0xDA,
+    0x5A, 0xEA, 0x49, 0xCA, 0x19, 0xCA, 0x3C, 0xA3, 0xD2, 0xAC, 0x4D, 0x2D, 0x92, 0xAC, 0x92, 0xAD,
+    0xAA, 0xDA, 0x4A, 0xF9, 0x30, 0x39, 0xE9, 0x4D, 0x90, 0xAC, 0x92, 0xAC, 0x3C, 0xA2, 0xC9, 0x3D,
+    0x19, 0xC4, 0xCA, 0x1A, 0xC3, 0x9C, 0xA1, 0x9C, 0x91, 0x9D, 0x92, 0xFE, 0x49, 0xAA, 0x9D, 0x79,
+    0xC9, 0x29, 0x29, 0xD2, 0xAF, 0xD9, 0x2A, 0xFA, 0x40, 0x3D, 0x3A, 0xD3, 0xE7, 0x77, 0x6D, 0x3A,
+    0xD3, 0xE2, 0x3D, 0x92, 0x9D, 0x3E, 0x77, 0x70, 0x99, 0x3E, 0x29, 0xD3, 0xAC, 0xA2, 0x9D, 0x39,
+    0x99, 0x30, 0x79, 0xC7, 0x09, 0xE6, 0x9E, 0x95, 0x9E, 0xA6, 0xEA, 0x70, 0xEA, 0x97, 0x0A, 0xFC,
+    0xA7, 0x09, 0xAF, 0xA7, 0x1A, 0xDA, 0x73, 0x90, 0x73, 0xAF, 0xD9, 0x19, 0x99, 0x77, 0x39, 0x99,
+    0x2A, 0xFD, 0x73, 0x2A, 0xA7, 0x2A, 0xDA, 0x72, 0xEA, 0x71, 0x9E, 0xA7, 0x19, 0xE9, 0x79, 0xAD,
+    0x49, 0xAF, 0xA9, 0x1A, 0xFC, 0xA5, 0xDA, 0x97, 0x74, 0x77, 0x9A, 0xDA, 0x94, 0xAC, 0xAA, 0xAD,
+    0x93, 0xA3, 0x9C, 0xA7, 0x1D, 0x70, 0x9C, 0xA7, 0x0A, 0xC7, 0x09, 0xCA, 0x79, 0xD7, 0xAD, 0x6A,
+    0xDA, 0x7D, 0xA7, 0x0D, 0x70, 0x9D, 0x70, 0x9A, 0x97, 0x74, 0xAA, 0x70, 0x9D, 0x70, 0xE7, 0x77,
+    0x71, 0x9F, 0x97, 0x09, 0xD9, 0x90, 0x9C, 0x96, 0xAC, 0x95, 0xC5, 0xAC, 0x7A, 0x93, 0x9C, 0x99,
+    0xDA, 0x3A, 0x93, 0xCA, 0x0A, 0x1C, 0x3A, 0x92, 0x9C, 0x9A, 0x2C, 0x3C, 0x3D, 0x0C, 0x1A, 0xA2,
+    0xAA, 0x3D, 0x0F, 0xA0, 0x9D, 0x4D, 0x90, 0x99, 0x1D, 0xA5, 0xE7, 0x5A, 0xE9, 0x19, 0x99, 0x7F,
+    0xF9, 0x70, 0xAF, 0xDA, 0x72, 0x99, 0x99, 0x50, 0x70, 0x9D, 0x72, 0xE7, 0x1A, 0xE7, 0x09, 0xCA,
+    0xAC, 0x70, 0xD0, 0xAC, 0x7A, 0xC9, 0x0A, 0xC9, 0x59, 0xCA, 0x19, 0xC9, 0x5D, 0x29, 0xCA, 0x4A,
+    0xCA, 0x29, 0xCA, 0x39, 0xD3, 0x9D, 0x3F, 0xFD, 0x2A, 0xFF, 0xD1, 0x9D, 0x94, 0x9D, 0x1D, 0xA5,
+    0x9D, 0x90, 0x3A, 0xFC, 0xA5, 0xD9, 0x99, 0x9D, 0x4C, 0xA4, 0xC9, 0x29, 0xC9, 0x39, 0xC9, 0x2A,
+    0xC3, 0x9D, 0x3F, 0xE9, 0x4D, 0xAA, 0xAE, 0x39, 0xC9, 0x4D, 0x2D, 0x5D, 0x2D, 0x49, 0xD1, 0x9C,
+    0xA3, 0x9D, 0xA1, 0xAD, 0xAA, 0xFC, 0x2F, 0xFC, 0x92, 0xFE, 0xA9, 0x20, 0x77, 0x59, 0xAE, 0x95,
+    0xAF, 0xD9, 0x4E, 0x97, 0x0D, 0xA7, 0x1D, 0xA7, 0x19, 0xD7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xD7,
+    0x2E, 0x72, 0xEA, 0x71, 0xFD, 0xAA, 0xD3, 0xAF, 0xFA, 0x4F, 0xF9, 0x49, 0xFD, 0xA7, 0x71, 0x77,
+    0x2A, 0xFD, 0xA6, 0xFF, 0xC5, 0xD3, 0x9D, 0xA3, 0x9C, 0x94, 0x9D, 0x3A, 0xC6, 0xD9, 0x2D, 0x6D,
+    0x91, 0x9C, 0xA6, 0xD9, 0x1A, 0xC9, 0x6D, 0x2D, 0x6A, 0xD2, 0xD5, 0xAD, 0xA1, 0x9D, 0xAA, 0xAA,
+    0xFC, 0x2A, 0xFF, 0xD9, 0x2F, 0xFD, 0x4F, 0xE9, 0x50, 0x77, 0x2F, 0xF4, 0xAF, 0xDA, 0x94, 0xD7,
+    0x3D, 0x72, 0x9C, 0xA7, 0x2A, 0xC9, 0x72, 0xFD, 0xA5, 0x9F, 0xD9, 0x5A, 0xCA, 0x72, 0xD7, 0x3D,
+    0x72, 0xAF, 0xF4, 0xFF, 0xC4, 0xFF, 0xC3, 0x77, 0x1F, 0xE9, 0x4D, 0xAA, 0x99, 0x94, 0xAC, 0x97,
+    0x1D, 0x72, 0xD7, 0x1A, 0xFD, 0x5F, 0xE5, 0xD7, 0x19, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD7,
+    0x1D, 0xA7, 0x1D, 0x97, 0x00, 0x79, 0x9A, 0x99, 0x5A, 0xFF, 0x3E, 0xA9, 0x39, 0x2A, 0xD7, 0x19,
+    0xD9, 0x71, 0xAD, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0x9D, 0x39, 0xFA, 0x0A, 0xCA, 0x49, 0x9E, 0x0E,
+    0x6C, 0x91, 0xEA, 0x39, 0xD9, 0x1A, 0xFF, 0xD3, 0xFF, 0xD4, 0xAF, 0xCA, 0x92, 0x49, 0x95, 0x99,
+    0x49, 0xCA, 0x5D, 0x93, 0xAC, 0x95, 0xD4, 0xD5, 0x9D, 0x4D, 0x5A, 0xCA, 0x3A, 0xCA, 0x5D, 0x93,
+    0xD9, 0x49, 0xD4, 0xD9, 0x4A, 0xD3, 0x9F, 0xFD, 0xA3, 0xAF, 0xFD, 0x93, 0xFF, 0xE9, 0x3D, 0x94,
+    0xE3, 0xAD, 0x5E, 0x3E, 0x49, 0xDA, 0x3D, 0xA4, 0xAD, 0x92, 0x39, 0xD4, 0xAC, 0xA4, 0xD9, 0x4D,
+    0x49, 0xD4, 0xAC, 0xA4, 0xD9, 0x4D, 0x49, 0xD4, 0xAC, 0xA4, 0xDA, 0x4D, 0x93, 0x9D, 0x4E, 0x4E,
+    0x30, 0x77, 0x4A, 0xCA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x70, 0xD7, 0x0A, 0xD7,
+    0x0D, 0x97, 0x0D, 0x70, 0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x70, 0x9D, 0x70, 0xDA, 0x7A, 0xD5, 0x9F,
+    0xA5, 0xFA, 0x6D, 0xA9, 0x60, 0x49, 0xCA, 0x19, 0xD5, 0xAC, 0x91, 0xD9, 0x5D, 0x1D, 0x95, 0x9C,
+    0xA0, 0xDA, 0x6A, 0xC9, 0xAD, 0x7D, 0x9D, 0x79, 0xF7, 0x0A, 0xE9, 0x70, 0xF7, 0x09, 0xFC, 0x7A,
+    0xCA, 0xE9, 0x6D, 0x09, 0xE5, 0x9D, 0x1F, 0x4D, 0xA1, 0xAE, 0x93, 0xD9, 0x2F, 0x20, 0x77, 0xD7,
+    0x9C, 0xA7, 0xAC, 0x97, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x70, 0xD7, 0xAC, 0xA7, 0xD9, 0x7D, 0x79,
+    0xDA, 0xAA, 0xAD, 0x1F, 0xFC, 0x1F, 0xFA, 0x00, 0x77, 0x6E, 0x59, 0xDA, 0x4E, 0x94, 0xE9, 0x3A,
+    0xE9, 0x3A, 0xE4, 0xFA, 0x29, 0xF4, 0xCA, 0xE2, 0xDA, 0xD3, 0xAC, 0x9E, 0x1A, 0xDA, 0xCA, 0x3D,
+    0x9A, 0xD0, 0x9D, 0x0D, 0x93, 0xD0, 0xAD, 0x9D, 0xA9, 0xD9, 0x29, 0xD0, 0x9F, 0xC0, 0xAD, 0x3D,
+    0xA0, 0x9F, 0x90, 0xE3, 0xD9, 0x1E, 0xA0, 0x9D, 0xA2, 0x9D, 0x91, 0xE1, 0xAD, 0xA2, 0xE2, 0xD9,
+    0x1E, 0x92, 0xE6, 0x9E, 0x20, 0x77, 0x59, 0xAA, 0x5D, 0x5E, 0x4A, 0xCA, 0x5E, 0x4D, 0x94, 0xAE,
+    0x93, 0xD5, 0xFA, 0x2A, 0xCA, 0x49, 0xD9, 0xD2, 0xD9, 0x4A, 0xCA, 0x0D, 0x2D, 0x5D, 0x90, 0xD1,
+    0xAC, 0xA4, 0x9D, 0x1D, 0x90, 0xD9, 0x4A, 0xD1, 0xAC, 0xA9, 0xD5, 0xDA, 0x19, 0xDA, 0xCA, 0x49,
+    0xD9, 0x2F, 0x94, 0xAD, 0x3F, 0x5E, 0x3F, 0x40, 0x6A, 0xEA, 0x97, 0xAD, 0xAA, 0xAD, 0xA5, 0xE3,
+    0x9D, 0x93, 0xAD, 0x5A, 0xCA, 0x29, 0xD6, 0xAD, 0x2A, 0xC9, 0x69, 0xCA, 0x2D, 0x79, 0xCA, 0x19,
+    0xCA, 0x7A, 0xC9, 0x1A, 0xC9, 0x7D, 0x2A, 0xC9, 0x6A, 0xCA, 0x2E, 0x5A, 0xD9, 0x2A, 0xEA, 0xAA,
+    0xAE, 0xA3, 0x9F, 0xFD, 0x5F, 0xFC, 0x7A, 0xFA, 0x97, 0x75, 0x4F, 0xCA, 0x96, 0xDA, 0xAA, 0xDA,
+    0x49, 0xC9, 0x3D, 0x4A, 0xC4, 0xD4, 0xD4, 0xCA, 0x39, 0xCA, 0x29, 0xD4, 0xAF, 0xE9, 0x4F, 0xDA,
+    0x94, 0x9D, 0x72, 0xAD, 0x72, 0xDA, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xE7, 0x2E, 0x71, 0x79, 0x99,
+    0x97, 0x19, 0xFD, 0x7D, 0xA9, 0x1A, 0xD5, 0xD9, 0x4A, 0xCA, 0x3D, 0x95, 0x9C, 0xA2, 0x9D, 0x7D,
+    0x2D, 0x96, 0x9C, 0xA2, 0xD7, 0x9C, 0xA1, 0x9C, 0xA7, 0xD2, 0xAC, 0x96, 0x9D, 0x2D, 0xA2, 0x99,
+    0x1D, 0x92, 0xE9, 0x09, 0xFD, 0x3A, 0xFF, 0xD5, 0xFF, 0xC7, 0xAF, 0xE7, 0x3A, 0xEA, 0x73, 0xF9,
+    0x77, 0x20, 0x4F, 0xCA, 0x6C, 0xAA, 0xAA, 0xD4, 0x9C, 0x3A, 0xC4, 0xCA, 0x3A, 0xC4, 0xC9, 0x29,
+    0xD3, 0x9C, 0xA9, 0x9A, 0xD9, 0x3F, 0xDA, 0x5F, 0xE4, 0x9D, 0x2A, 0xC9, 0x3D, 0xA2, 0x9C, 0xA3,
+    0xD9, 0x2A, 0xCA, 0x29, 0xD3, 0xDA, 0x2E, 0x29, 0xDA, 0x2E, 0x2A, 0xDA, 0x10, 0x7A, 0xFC, 0x6A,
+    0xFE, 0x59, 0xDA, 0x97, 0x1D, 0x97, 0x3C, 0xA7, 0x39, 0xD9, 0x73, 0xFC, 0x97, 0x1F, 0xDA, 0x71,
+    0x9A, 0xEA, 0x72, 0xAE, 0x72, 0xAE, 0x3A, 0x99, 0x19, 0xAF, 0x2A, 0xFF, 0xD9, 0x1A, 0xFF, 0xD3,
+    0x9A, 0xFD, 0xA9, 0x77, 0x20, 0x0A, 0xFF, 0xE1, 0xFF, 0xEA, 0x59, 0xCA, 0x72, 0xAC, 0x97, 0x2D,
+    0x73, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7,
+    0x2E, 0x70, 0x77, 0x1A, 0xD5, 0xDA, 0x2D, 0xA4, 0x9D, 0x3D, 0x94, 0xAD, 0x29, 0xD5, 0xDA, 0x2A,
+    0xD5, 0xD9, 0x2D, 0xA4, 0x9D, 0x3D, 0x5A, 0xCA, 0x29, 0xD5, 0xD9, 0x2A, 0xCA, 0x5D, 0x3A, 0xCA,
+    0x4A, 0xCA, 0x3E, 0x92, 0xAD, 0x93, 0xFF, 0xD4, 0xFF, 0xC9, 0x5A, 0xFC, 0xA9, 0x77, 0x30, 0x75,
+    0x9C, 0xA7, 0xD0, 0x9D, 0x6A, 0xCA, 0x09, 0xD5, 0x9D, 0x19, 0xD5, 0xD9, 0x2D, 0x4A, 0xCA, 0x3D,
+    0x39, 0xD4, 0xD9, 0x2D, 0xA4, 0xD9, 0x1E, 0x5D, 0xA0, 0x9D, 0x95, 0xDA, 0x0D, 0xA6, 0xFD, 0x7F,
+    0xCA, 0x7F, 0xC7, 0x0F, 0x97, 0x09, 0xCA, 0x73, 0xAC, 0xA0, 0xAC, 0xA7, 0x3D, 0x1A, 0xCA, 0x72,
+    0xAC, 0xA1, 0xAC, 0xA7, 0x2D, 0x2A, 0xCA, 0x3D, 0x3A, 0xCA, 0x2D, 0xA2, 0xE9, 0x2D, 0x3D, 0xA1,
+    0xF9, 0x1D, 0xA3, 0xD9, 0x0A, 0xFA, 0x09, 0xD4, 0xD9, 0x9D, 0x9A, 0xD0, 0xDA, 0x4D, 0xAD, 0xA0,
+    0x9D, 0xAD, 0x5F, 0xC1, 0x9F, 0x95, 0xF9, 0x19, 0xF6, 0xEA, 0x3E, 0x96, 0xE4, 0xE6, 0x77, 0x5A,
+    0xC9, 0x5D, 0x6D, 0x4D, 0x7D, 0x92, 0xD9, 0x79, 0xCA, 0x1D, 0x97, 0x1D, 0x0D, 0x97, 0x2F, 0xA7,
+    0x39, 0xDA, 0x74, 0xAD, 0x97, 0x3A, 0xF7, 0x2A, 0xDA, 0xD9, 0x70, 0xAD, 0x1E, 0x7A, 0xD2, 0xAD,
+    0x6A, 0xD9, 0x29, 0xDA, 0x4A, 0xD9, 0x4E, 0x30, 0x9C, 0xA5, 0xAC, 0xA0, 0xD4, 0x9D, 0x1D, 0x93,
+    0xD2, 0xAC, 0xA2, 0xD9, 0x2A, 0xD1, 0xD9, 0x39, 0xD0, 0xAC, 0xA5, 0xFC, 0x6F, 0x7A, 0xD9, 0x7A,
+    0xD7, 0x0D, 0xA7, 0xAD, 0x97, 0xE7, 0xAE, 0x70, 0x5F, 0xFD, 0xA5, 0xFF, 0xD6, 0x99, 0x99, 0x99,
+    0xAE, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x97, 0x2F, 0x73, 0xF7,
+    0x29, 0xEA, 0x72, 0xAF, 0xCA, 0xAA, 0xAA, 0xA4, 0xFF, 0xF4, 0xFF, 0xF3, 0x7A, 0xAA, 0xA7, 0x9F,
+    0x7A, 0xC9, 0x71, 0xD7, 0x2C, 0xA7, 0x1A, 0xC9, 0x71, 0xD7, 0x2C, 0xA7, 0x1A, 0xC9, 0x71, 0xD7,
+    0x2C, 0xA7, 0x19, 0xC9, 0x71, 0xD7, 0x2C, 0xA7, 0x19, 0xC9, 0x71, 0xD7, 0x2D, 0x71, 0x9C, 0x97,
+    0x1A, 0xC7, 0x2D, 0x71, 0x9C, 0x97, 0x1A, 0xF7, 0xF9, 0x60, 0x29, 0x1C, 0x90, 0xC9, 0x0C, 0xA0,
+    0xAA, 0x0A, 0xA0, 0xAC, 0x0A, 0xC0, 0xAC, 0x0A, 0xC0, 0xAC, 0x9A, 0xC9, 0x9C, 0x99, 0xA0, 0x91,
+    0x0A, 0xAA, 0xA7, 0xF7, 0x19, 0xC9, 0x71, 0xCA, 0x71, 0xD7, 0x19, 0xC9, 0x71, 0xCA, 0x71, 0xD7,
+    0x1A, 0xC9, 0x71, 0xCA, 0x71, 0xD7, 0x1A, 0xC9, 0x71, 0xCA, 0x71, 0xD7, 0x1A, 0xC9, 0x70, 0x9C,
+    0xA7, 0x1D, 0x71, 0xAC, 0x71, 0x9C, 0xA7, 0x1D, 0x71, 0xAC, 0x7F, 0xA6, 0xAF, 0x1A, 0xA3, 0x9D,
+    0xA2, 0xC9, 0x09, 0xA7, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xFD, 0x74, 0x9A, 0x3D, 0x3D,
+    0x00, 0x77, 0xAD, 0xA5, 0xFD, 0xA2, 0xAC, 0xA1, 0xAC, 0xA1, 0x9C, 0x92, 0x9C, 0x91, 0xCA, 0x3A,
+    0xC2, 0xC4, 0xD1, 0x9C, 0x3A, 0xD1, 0x9D, 0xAA, 0xEA, 0x2F, 0xEA, 0x29, 0xEA, 0x9C, 0x90, 0x73,
+    0xAC, 0xA6, 0xD9, 0x6D, 0x7D, 0x69, 0xCA, 0x6A, 0xCA, 0xF2, 0xEA, 0x99, 0xD1, 0xDA, 0x29, 0xC9,
+    0x0D, 0x39, 0xC9, 0x9C, 0xA3, 0xAC, 0x0A, 0xC9, 0x29, 0xCA, 0x0E, 0xA9, 0xAD, 0x1F, 0xE3, 0xFA,
+    0x75, 0x74, 0xAE, 0x29, 0xDA, 0x9A, 0x2D, 0x59, 0xC9, 0x5D, 0x6C, 0xA6, 0xCA, 0x6D, 0x95, 0xFC,
+    0xA3, 0xAF, 0x72, 0x72, 0xC9, 0x71, 0x9C, 0x72, 0xAC, 0x72, 0xC9, 0x71, 0x9C, 0x59, 0xAD, 0x0A,
+    0xC4, 0xAF, 0xAC, 0xA3, 0xAC, 0x91, 0xAD, 0x92, 0x9C, 0x92, 0x9D, 0x3A, 0xC3, 0x9C, 0xA3, 0xCA,
+    0x3A, 0xC9, 0x3C, 0xA2, 0x9D, 0x4E, 0xAF, 0x4F, 0xF5, 0xAE, 0x9C, 0xA7, 0x70, 0x39, 0xAD, 0x94,
+    0xAC, 0x91, 0xC9, 0x2A, 0xC3, 0x9A, 0x19, 0xCA, 0x9A, 0xAE, 0x1A, 0xFC, 0xAA, 0x91, 0xC9, 0x70,
+    0xCA, 0x70, 0xDA, 0x91, 0x99, 0x2A, 0xFD, 0x93, 0x9F, 0xA2, 0x75, 0xE9, 0x3A, 0xC6, 0xC9, 0x59,
+    0xC5, 0xFC, 0x92, 0x9D, 0x99, 0x4C, 0xA5, 0x9C, 0x95, 0xD6, 0xD5, 0x9C, 0xA5, 0xAC, 0x95, 0xD5,
+    0x4A, 0xD9, 0x0C, 0x92, 0x9D, 0xAF, 0x3C, 0xA2, 0xE2, 0x9C, 0x3D, 0xA2, 0xCA, 0x3D, 0x92, 0xC4,
+    0xD3, 0xC3, 0xDA, 0x3D, 0xAA, 0xE9, 0x3F, 0xE5, 0xAD, 0xAC, 0xA7, 0x0D, 0x93, 0x91, 0x9E, 0x39,
+    0xFD, 0x49, 0xFC, 0x70, 0x97, 0x4A, 0xC7, 0x1C, 0xA7, 0x1C, 0x71, 0xAC, 0x71, 0xCA, 0x71, 0xC9,
+    0x9A, 0xA9, 0x4A, 0xFD, 0x93, 0xE9, 0x09, 0xCA, 0x3D, 0x3C, 0xA2, 0x9C, 0x93, 0xC9, 0x2D, 0x39,
+    0xC3, 0xD3, 0xAC, 0x29, 0xCA, 0x3D, 0x2D, 0x92, 0x9C, 0xA2, 0xD3, 0xAC, 0x91, 0x4A, 0x93, 0xAC,
+    0xA3, 0xD9, 0x77, 0x19, 0x4A, 0xC4, 0xCA, 0x4C, 0x93, 0x9C, 0x4A, 0xA4, 0xCA, 0x39, 0xC9, 0x3D,
+    0x4D, 0x30, 0x70, 0xD7, 0xAD, 0x7A, 0xAA, 0x77, 0x75, 0xCA, 0x79, 0xC9, 0x7A, 0xC7, 0x0C, 0xA7,
+    0x0C, 0x97, 0x9C, 0x70, 0xAC, 0x70, 0xC9, 0x70, 0xC7, 0x0A, 0xC7, 0x0C, 0xA7, 0xAC, 0x59, 0xAD,
+    0xA5, 0xEA, 0x77, 0x00, 0x76, 0xC9, 0x6A, 0xC7, 0xD7, 0xC9, 0x6A, 0xC1, 0xAA, 0x3D, 0x0D, 0x4C,
+    0xAD, 0x49, 0xE5, 0xF5, 0xCA, 0xDA, 0x39, 0xC9, 0x9D, 0x92, 0xD1, 0xE2, 0xD1, 0x9E, 0x00, 0x49,
+    0x49, 0xC9, 0x3A, 0xC4, 0xCA, 0x39, 0xC9, 0x3A, 0xC4, 0xCA, 0x39, 0xC9, 0x3A, 0xC4, 0xD3, 0x9C,
+    0xA3, 0xAC, 0x4F, 0x2F, 0x10, 0x3C, 0xA9, 0xE1, 0x9D, 0xA4, 0xEA, 0xAD, 0xAF, 0x92, 0xAD, 0x2E,
+    0x2C, 0xA2, 0xD3, 0xAC, 0x92, 0xC9, 0x19, 0xCA, 0x3D, 0x3C, 0x91, 0xAC, 0x92, 0x9C, 0x92, 0xAC,
+    0x2D, 0x3A, 0xC3, 0xD1, 0x9C, 0xA3, 0xD3, 0xCA, 0x1A, 0xC9, 0x2A, 0xC9, 0x2A, 0xC9, 0x1D, 0x3D,
+    0x3D, 0x90, 0x69, 0x94, 0x9F, 0xD3, 0xAD, 0x19, 0xC9, 0x2D, 0x29, 0xC9, 0x19, 0xCA, 0x29, 0xC9,
+    0x1A, 0xC3, 0xD2, 0xD3, 0xD1, 0x9D, 0x29, 0xCA, 0x1A, 0xCA, 0x2A, 0xCA, 0x1D, 0x92, 0xD9, 0x00,
+    0x3A, 0xE9, 0x4D, 0xAA, 0xAC, 0x92, 0xD3, 0xCA, 0x19, 0xC4, 0xAC, 0x1D, 0x4C, 0xA1, 0xCA, 0x4C,
+    0xA1, 0xCA, 0x3A, 0xC2, 0xDA, 0xAA, 0xDA, 0x2A, 0xFC, 0xA4, 0xAE, 0x93, 0x49, 0x90, 0xAD, 0x96,
+    0xFA, 0xAC, 0x95, 0xE2, 0xAA, 0x5D, 0x3A, 0xC4, 0x9C, 0xA3, 0xAA, 0x4A, 0xC9, 0x3C, 0x94, 0xDA,
+    0x29, 0xC4, 0x9E, 0xA9, 0xAC, 0xA4, 0xAF, 0xE5, 0xCA, 0x9E, 0xA5, 0xAC, 0x97, 0x2D, 0x72, 0xAC,
+    0x97, 0x2D, 0x77, 0x70, 0x49, 0xA9, 0x09, 0x93, 0xAF, 0x9D, 0x2A, 0xC9, 0x1A, 0xD9, 0x19, 0xC9,
+    0x29, 0xD2, 0xAC, 0x3A, 0xCA, 0x2C, 0x93, 0xD9, 0x2C, 0x92, 0xAD, 0x3D, 0x99, 0xEA, 0x3A, 0xFD,
+    0x94, 0xAD, 0xA9, 0xC7, 0x1C, 0xA0, 0x97, 0xEA, 0x69, 0xDA, 0x79, 0x50, 0x74, 0xC9, 0xAC, 0xA2,
+    0x9F, 0xA2, 0xDA, 0x5D, 0x59, 0xCA, 0x5D, 0x95, 0xD5, 0xAD, 0x5E, 0x40, 0x4A, 0xEA, 0x4C, 0xA9,
+    0x99, 0x4A, 0xA7, 0x0A, 0xC7, 0x09, 0xE9, 0x69, 0xAD, 0xA7, 0x0D, 0x39, 0xA9, 0x9A, 0xD2, 0xAF,
+    0xDA, 0x29, 0xFC, 0xA2, 0x73, 0xAC, 0x5C, 0xA4, 0xAC, 0x92, 0xAF, 0xCA, 0x2C, 0xA4, 0x9C, 0x94,
+    0xD5, 0xD4, 0x9C, 0x94, 0xAC, 0xA4, 0xFA, 0x2F, 0xA1, 0x1C, 0xA3, 0xAC, 0x2C, 0xA3, 0xD2, 0xC9,
+    0x3C, 0xA1, 0x9C, 0x39, 0xC9, 0x1A, 0xC3, 0xAC, 0x2D, 0x3D, 0x2D, 0x2A, 0xCA, 0x2F, 0xEA, 0x2F,
+    0xE9, 0x29, 0xE9, 0xAC, 0x20, 0x72, 0xAC, 0x5C, 0xA0, 0xAC, 0x4A, 0xC1, 0x9C, 0x92, 0x9C, 0x3C,
+    0xA2, 0xCA, 0x3D, 0x1D, 0x4D, 0x0A, 0xC5, 0xAE, 0x95, 0xAE, 0x6A, 0xDA, 0x50, 0x74, 0xD7, 0xD0,
+    0xD6, 0x9C, 0xA0, 0xD2, 0xA2, 0xD1, 0xD1, 0xDA, 0x09, 0xCA, 0x1D, 0x0F, 0x0D, 0x2F, 0xFC, 0x92,
+    0xFA, 0xF3, 0xE9, 0x0E, 0x93, 0xDA, 0x1A, 0xD4, 0x39, 0xCA, 0x2A, 0xC5, 0xD1, 0xAC, 0x95, 0xAC,
+    0x9A, 0xC9, 0x69, 0xE9, 0x70, 0xDA, 0x70, 0xAD, 0xA7, 0xAC, 0xAD, 0x6A, 0xCA, 0x0D, 0x94, 0xAC,
+    0xA1, 0xAD, 0x3A, 0xCA, 0x3D, 0x91, 0x2A, 0xC4, 0xD3, 0x9C, 0x92, 0x9C, 0x94, 0xCA, 0x2D, 0x5D,
+    0x19, 0xC9, 0x5D, 0x1D, 0x6A, 0xCA, 0xAC, 0x96, 0x9F, 0x70, 0xEA, 0x70, 0xE7, 0x1D, 0xA7, 0x09,
+    0xD7, 0x0A, 0xD9, 0x59, 0xF9, 0x6A, 0xDA, 0x77, 0x50, 0x39, 0xFD, 0x93, 0x9A, 0xAA, 0xAD, 0x97,
+    0xD9, 0x7D, 0x79, 0xD7, 0xAD, 0x7A, 0xD7, 0xE7, 0xAF, 0xE3, 0xFF, 0x20, 0x76, 0xAE, 0x49, 0xCA,
+    0x6D, 0x69, 0xCA, 0x6A, 0xC9, 0x6D, 0x5E, 0x59, 0xD7, 0x0C, 0xA6, 0x9C, 0xA6, 0xAC, 0x96, 0xD7,
+    0xD7, 0xEA, 0x6A, 0xA9, 0x40, 0x39, 0xC4, 0xAA, 0x4C, 0x94, 0xC4, 0x9A, 0x4C, 0x94, 0xC4, 0x9C,
+    0x4A, 0xA4, 0xC5, 0xC4, 0xAA, 0x4C, 0x94, 0xC7, 0x30, 0x74, 0xAE, 0x6D, 0x95, 0xD6, 0xD5, 0x9C,
+    0x95, 0xAC, 0x95, 0x9D, 0xA4, 0x9D, 0x94, 0xCA, 0x5D, 0x6C, 0xA5, 0xAC, 0x95, 0xD3, 0xAE, 0x93,
+    0xAA, 0x95, 0x09, 0xC9, 0x1A, 0x0C, 0x0C, 0x0A, 0x99, 0xA0, 0x9D, 0x70, 0x29, 0x99, 0x3E, 0x3D,
+    0xA3, 0xD9, 0x72, 0xAC, 0x39, 0xD3, 0x9C, 0xA3, 0xAC, 0x93, 0xD4, 0xD4, 0xCA, 0x39, 0xC9, 0x3A,
+    0xC4, 0xD4, 0xCA, 0x4C, 0x97, 0x20, 0x76, 0x9A, 0x6C, 0x96, 0xC5, 0xAE, 0x29, 0xEA, 0xA2, 0xD0,
+    0xC3, 0x9C, 0x90, 0xC3, 0xD0, 0x9A, 0x3C, 0xA0, 0xC9, 0x3C, 0xA0, 0xC4, 0xDA, 0xC4, 0xFC, 0xA3,
+    0xAF, 0x4C, 0x69, 0x94, 0x77, 0x69, 0x97, 0x09, 0xFC, 0x95, 0xAC, 0xA9, 0x1A, 0xC5, 0xCA, 0x73,
+    0xC9, 0x73, 0xC9, 0x73, 0xC9, 0x73, 0xC9, 0x71, 0x9A, 0xDA, 0xAA, 0x95, 0xFE, 0x97, 0xCA, 0x72,
+    0xAC, 0x97, 0x0A, 0xD9, 0x70, 0xFC, 0xAA, 0xA9, 0x4F, 0xFC, 0xA2, 0x2A, 0x3A, 0x91, 0xAF, 0xD9,
+    0x19, 0xC9, 0x09, 0xCA, 0x2C, 0xA2, 0xCA, 0x2C, 0xA1, 0xD2, 0xAF, 0xD1, 0xAC, 0xAD, 0xAD, 0x91,
+    0x94, 0x91, 0x77, 0xD4, 0xD3, 0xAC, 0x92, 0xD5, 0xD0, 0x9D, 0x6A, 0xF7, 0x0E, 0x71, 0xD9, 0x95,
+    0xFE, 0x7A, 0xCA, 0x71, 0xD9, 0x70, 0x9D, 0x99, 0x5F, 0xE7, 0xD9, 0x71, 0xD7, 0x74, 0x39, 0xC4,
+    0xAA, 0x4C, 0x94, 0xC4, 0x9A, 0x77, 0x70, 0xAA, 0x4C, 0x49, 0xC4, 0xAA, 0x4C, 0x94, 0xC7, 0x30,
+    0x7A, 0xE9, 0x7C, 0xA9, 0x09, 0xC6, 0x9A, 0x73, 0x9C, 0x72, 0xAF, 0xA6, 0xDA, 0x99, 0xAD, 0x49,
+    0xC5, 0xC9, 0x3A, 0xC4, 0x9C, 0x49, 0xEA, 0x9A, 0xD5, 0x9A, 0xFC, 0x71, 0xAD, 0x72, 0xDA, 0x5F,
+    0xE5, 0xFD, 0xA7, 0x73, 0x1A, 0x91, 0xAA, 0x1D, 0x91, 0xD1, 0xD9, 0x0A, 0xD0, 0x19, 0xAA, 0xA2,
+    0x9A, 0x91, 0x91, 0xAA, 0x29, 0x09, 0xA3, 0xA0, 0x9A, 0xC9, 0x09, 0x91, 0xA1, 0xA9, 0x39, 0x93,
+    0x71, 0xAC, 0xA2, 0xA1, 0xC1, 0x99, 0x1C, 0x1A, 0xA9, 0xCA, 0x19, 0xDA, 0x90, 0x4A, 0x49, 0x3C,
+    0xA2, 0xAC, 0x29, 0xC9, 0x2C, 0xA2, 0xAC, 0x29, 0xC9, 0x3D, 0x91, 0xAC, 0xA3, 0x9D, 0x2D, 0x93,
+    0x9C, 0x3C, 0x94, 0x93, 0x92, 0x0A, 0xAA, 0x99, 0x91, 0x9F, 0xE6, 0xCA, 0x59, 0xC9, 0x5A, 0xC1,
+    0x0A, 0xAA, 0xAA, 0xAA, 0x09, 0xFE, 0x00, 0x39, 0x93, 0x9C, 0x90, 0x91, 0x9A, 0x0A, 0x19, 0x0A,
+    0x9C, 0xA1, 0x90, 0x9A, 0x0A, 0x0A, 0x19, 0xA0, 0xAA, 0x39, 0xA9, 0x20, 0x69, 0xFC, 0x70, 0x73,
+    0x9A, 0xD9, 0x29, 0xCA, 0x99, 0xC9, 0x1C, 0x92, 0xCA, 0x0A, 0xC3, 0xC9, 0x0A, 0xC9, 0x1D, 0x19,
+    0xFC, 0x92, 0xAD, 0xA2, 0x6A, 0x70, 0xAA, 0x70, 0xC9, 0x4A, 0xFE, 0x5A, 0xA7, 0x0C, 0x97, 0x09,
+    0x77, 0x0A, 0xFD, 0x75, 0x19, 0xA3, 0x9A, 0x29, 0x91, 0xAC, 0x1C, 0xA1, 0xEA, 0x50, 0x19, 0x95,
+    0xA4, 0xA2, 0xAA, 0x4A, 0x92, 0x9C, 0x1A, 0xD9, 0x10, 0x19, 0xC2, 0xC9, 0x1C, 0xA2, 0x92, 0x3C,
+    0xA3, 0xAC, 0x4C, 0xA3, 0xD3, 0x9C, 0x93, 0xCA, 0x3A, 0xC3, 0x9C, 0x93, 0xD3, 0xAC, 0x39, 0xD3,
+    0xD3, 0xAD, 0x2A, 0xCA, 0x3F, 0xFA, 0x29, 0xFF, 0x92, 0xC9, 0x9E, 0x9A, 0xC3, 0xC7, 0x39, 0x72,
+    0x69, 0x29, 0x4E, 0x1A, 0xA3, 0xF1, 0xC9, 0x29, 0xE9, 0x1C, 0x39, 0xE1, 0x9C, 0x4E, 0x1A, 0xA4,
+    0xAC, 0x91, 0xC9, 0x4D, 0x2C, 0x49, 0xD1, 0x9C, 0x4D, 0x91, 0xAA, 0x39, 0xD2, 0xC9, 0x3E, 0x2C,
+    0x39, 0xD9, 0x19, 0xC3, 0xE2, 0xAA, 0x20, 0x1D, 0x19, 0xD1, 0xAA, 0xA0, 0x59, 0x39, 0x99, 0x29,
+    0xA0, 0xAC, 0xA1, 0x1A, 0xA1, 0x99, 0x1A, 0x2C, 0x19, 0xA0, 0xEA, 0x30, 0x1A, 0xA9, 0x1C, 0x90,
+    0xC0, 0x99, 0x1C, 0x0A, 0x90, 0x9A, 0x09, 0xE7, 0x93, 0x99, 0x39, 0xC9, 0x2C, 0xA3, 0x9C, 0xA2,
+    0xAC, 0x93, 0xAC, 0x29, 0xC9, 0x2D, 0x91, 0xAC, 0xA1, 0xAC, 0xA1, 0x9D, 0x2D, 0x29, 0xC3, 0x94,
+    0x91, 0x77, 0x0D, 0x72, 0x99, 0xA6, 0x93, 0xA9, 0x5A, 0x93, 0xC5, 0xAA, 0x39, 0xC4, 0x9A, 0x4A,
+    0xA3, 0x9C, 0x39, 0xAC, 0xAA, 0x19, 0xC4, 0xFC, 0x1C, 0x2A, 0x7C, 0x91, 0xAC, 0x6C, 0x91, 0xAA,
+    0xC5, 0xCA, 0x1A, 0xA9, 0xA4, 0xAC, 0x1A, 0xA0, 0xAA, 0x3A, 0xC2, 0xFC, 0x91, 0xAC, 0x59, 0xC3,
+    0xA9, 0x5A, 0xC2, 0x2A, 0xC7, 0x39, 0xAA, 0x69, 0x4A, 0x95, 0xA9, 0x4C, 0x5A, 0xA4, 0x9C, 0x49,
+    0xC5, 0xAA, 0x39, 0xC4, 0x9A, 0xCA, 0xA2, 0xCA, 0xDA, 0x1F, 0xC1, 0xC9, 0xA1, 0xAA, 0x6C, 0x93,
+    0xAA, 0x5C, 0xA4, 0xC9, 0x4A, 0xA4, 0xD4, 0xAC, 0x3A, 0xD4, 0xAC, 0x3D, 0xA4, 0x9C, 0x3A, 0xF9,
+    0x2C, 0x93, 0xAA, 0xAA, 0xA2, 0x2E, 0xA7, 0x5A, 0x59, 0x59, 0xA4, 0xC9, 0x3D, 0xA4, 0xA9, 0x6C,
+    0x92, 0xAA, 0x7C, 0x29, 0xA4, 0xAA, 0xAD, 0x19, 0xC4, 0x9E, 0xA1, 0x9C, 0x2A, 0x70, 0xC9, 0x1A,
+    0xC7, 0xC9, 0x1A, 0xAC, 0x6C, 0xA1, 0xAA, 0x9A, 0x5C, 0xA1, 0xAA, 0x0A, 0xA4, 0xAC, 0x2C, 0xAE,
+    0x92, 0xAC, 0x59, 0xC4, 0xA6, 0xD2, 0x69, 0xAA, 0x7A, 0xCA, 0x7D, 0x77, 0x39, 0x97, 0xAC, 0xA7,
+    0xD9, 0x7D, 0x69, 0xE5, 0xAD, 0x95, 0xAC, 0xA6, 0x9C, 0xA7, 0xD7, 0x9C, 0xA7, 0xAC, 0x97, 0x9C,
+    0xA3, 0xA3, 0xDA, 0xAA, 0xD4, 0xAE, 0x97, 0x60, 0x70, 0xA9, 0x73, 0x9C, 0xA7, 0x3A, 0xCA, 0x77,
+    0x77, 0x59, 0xD7, 0x2E, 0x71, 0xAE, 0x70, 0x9C, 0xAA, 0xC7, 0x0D, 0x0A, 0xC7, 0xAC, 0x90, 0xAC,
+    0x95, 0x9C, 0xA1, 0x9C, 0x95, 0xD2, 0x9C, 0xA4, 0xAC, 0xA2, 0x9C, 0xA3, 0x9D, 0x39, 0xD3, 0xFF,
+    0xD2, 0xAF, 0xFD, 0x19, 0xD9, 0x49, 0xD1, 0xDA, 0x59, 0xD9, 0x74, 0xC9, 0x73, 0xAA, 0x73, 0x9C,
+    0x74, 0x97, 0x77, 0x77, 0x77, 0x77, 0x9D, 0x73, 0xE7, 0x2A, 0xE7, 0x19, 0xCA, 0xAC, 0x71, 0xD0,
+    0xAC, 0x70, 0xAC, 0x90, 0xAC, 0x96, 0x9C, 0xA1, 0x9C, 0x96, 0xD2, 0x9C, 0xA5, 0xAC, 0xA2, 0x9C,
+    0xA4, 0x9D, 0x39, 0xD4, 0xFF, 0xD3, 0xAF, 0xFD, 0x29, 0xD9, 0x49, 0xD2, 0xDA, 0x59, 0xD9, 0x00,
+    0x77, 0x79, 0xCA, 0x73, 0xCA, 0xAA, 0x71, 0xA9, 0x19, 0xA7, 0x77, 0x09, 0xD7, 0x3E, 0x72, 0xAE,
+    0x71, 0x9C, 0xAA, 0xC7, 0x1D, 0x0A, 0xC7, 0x0A, 0xC9, 0x0A, 0xC9, 0x69, 0xCA, 0x19, 0xC9, 0x6D,
+    0x29, 0xCA, 0x5A, 0xCA, 0x29, 0xCA, 0x49, 0xD3, 0x9D, 0x4F, 0xFD, 0x3A, 0xFF, 0xD2, 0x9D, 0x94,
+    0x9D, 0x2D, 0xA5, 0x9D, 0x90, 0x70, 0x9C, 0x91, 0xA7, 0x0C, 0x0A, 0x99, 0xA7, 0x9A, 0x1D, 0x77,
+    0x77, 0x79, 0xD7, 0x3E, 0x72, 0xAE, 0x71, 0x9C, 0xAA, 0xC7, 0x1D, 0x0A, 0xC7, 0x0A, 0xC9, 0x0A,
+    0xC9, 0x69, 0xCA, 0x19, 0xC9, 0x6D, 0x29, 0xCA, 0x5A, 0xCA, 0x29, 0xCA, 0x49, 0xD3, 0x9D, 0x4F,
+    0xFD, 0x3A, 0xFF, 0xD2, 0x9D, 0x94, 0x9D, 0x2D, 0xA5, 0x9D, 0x90, 0x70, 0xD1, 0xAC, 0x97, 0xAC,
+    0xA1, 0xD9, 0x7A, 0xA9, 0x09, 0xAA, 0x77, 0x77, 0x71, 0x9D, 0x74, 0xE7, 0x3A, 0xE7, 0x29, 0xCA,
+    0xAC, 0x72, 0xD0, 0xAC, 0x71, 0xAC, 0x90, 0xAC, 0x97, 0x9C, 0xA1, 0x9C, 0x97, 0xD2, 0x9C, 0xA6,
+    0xAC, 0xA2, 0x9C, 0xA5, 0x9D, 0x39, 0xD5, 0xFF, 0xD4, 0xAF, 0xFD, 0x39, 0xD9, 0x49, 0xD3, 0xDA,
+    0x59, 0xD9, 0x10, 0x72, 0xAA, 0x97, 0x1A, 0x09, 0xA7, 0x19, 0xCA, 0x77, 0x77, 0x77, 0x39, 0xD7,
+    0x2E, 0x71, 0xAE, 0x70, 0x9C, 0xAA, 0xC7, 0x0D, 0x0A, 0xC7, 0xAC, 0x90, 0xAC, 0x95, 0x9C, 0xA1,
+    0x9C, 0x95, 0xD2, 0x9C, 0xA4, 0xAC, 0xA2, 0x9C, 0xA3, 0x9D, 0x39, 0xD3, 0xFF, 0xD2, 0xAF, 0xFD,
+    0x19, 0xD9, 0x49, 0xD1, 0xDA, 0x59, 0xD9, 0x77, 0x77, 0x19, 0xFF, 0xD7, 0x3F, 0xFC, 0xA9, 0x72,
+    0xFC, 0x77, 0x0A, 0xC9, 0xDA, 0x77, 0xAC, 0x90, 0xD9, 0x76, 0x9C, 0xA0, 0x9D, 0x77, 0xD1, 0x9F,
+    0xD9, 0x71, 0xD2, 0x9F, 0xD7, 0x1D, 0x92, 0xAC, 0xA7, 0x4A, 0xCA, 0x3D, 0x97, 0x39, 0xFF, 0xC9,
+    0x73, 0xFF, 0xFE, 0xA5, 0xD9, 0x4F, 0xFA, 0x4D, 0xA4, 0x9F, 0xFA, 0x77, 0x72, 0x77, 0x59, 0xAE,
+    0x95, 0xAF, 0xD9, 0x4E, 0x97, 0x0D, 0xA7, 0x1D, 0xA7, 0x19, 0xD7, 0x2D, 0x97, 0x19, 0xD7, 0x2A,
+    0xD7, 0x2E, 0x72, 0xEA, 0x71, 0xFD, 0xAA, 0xD3, 0xAF, 0xFA, 0x4F, 0xF9, 0x5A, 0xFC, 0xA7, 0x09,
+    0x74, 0x99, 0x97, 0x39, 0xA7, 0x19, 0xCA, 0x60, 0x69, 0x97, 0x4C, 0xA7, 0x39, 0xD7, 0x77, 0x73,
+    0xFF, 0x4A, 0xFD, 0xA9, 0x4D, 0x73, 0xD7, 0x29, 0xCA, 0x72, 0xAC, 0x97, 0x2F, 0xDA, 0x59, 0xFD,
+    0x95, 0xAC, 0xA7, 0x2D, 0x73, 0xD7, 0x2A, 0xFF, 0x4F, 0xFC, 0x4F, 0xFC, 0x30, 0x77, 0x70, 0xA9,
+    0x72, 0x9C, 0x72, 0x9C, 0x97, 0x77, 0x77, 0x77, 0x6F, 0xF4, 0xAF, 0xDA, 0x94, 0xD7, 0x3D, 0x72,
+    0x9C, 0xA7, 0x2A, 0xC9, 0x72, 0xFD, 0xA5, 0x9F, 0xD9, 0x5A, 0xCA, 0x72, 0xD7, 0x3D, 0x72, 0xAF,
+    0xF4, 0xFF, 0xC4, 0xFF, 0xC3, 0x7C, 0xA7, 0x29, 0xDA, 0x71, 0xC1, 0x9A, 0x75, 0x95, 0xFF, 0x4A,
+    0xFD, 0xA9, 0x4D, 0x73, 0xD7, 0x29, 0xCA, 0x72, 0xAC, 0x97, 0x2F, 0xDA, 0x59, 0xFD, 0x95, 0xAC,
+    0xA7, 0x2D, 0x73, 0xD7, 0x2A, 0xFF, 0x4F, 0xFC, 0x4F, 0xFC, 0x30, 0x69, 0xA2, 0xAA, 0x6D, 0x1A,
+    0xCA, 0x5A, 0xD1, 0xDA, 0x77, 0x77, 0x0F, 0xF4, 0xAF, 0xDA, 0x94, 0xD7, 0x3D, 0x72, 0x9C, 0xA7,
+    0x2A, 0xC9, 0x72, 0xFD, 0xA5, 0x9F, 0xD9, 0x5A, 0xCA, 0x72, 0xD7, 0x3D, 0x72, 0xAF, 0xF4, 0xFF,
+    0xC4, 0xFF, 0xC3, 0x39, 0x79, 0xC9, 0x6A, 0xC9, 0x77, 0x77, 0x9D, 0x5A, 0xCA, 0x5D, 0x95, 0xD5,
+    0x9D, 0x5A, 0xCA, 0x5D, 0x95, 0xD5, 0x9D, 0x5A, 0xCA, 0x5D, 0xA5, 0xD9, 0x49, 0xD5, 0xE5, 0xE4,
+    0x77, 0x1C, 0x96, 0xAA, 0x69, 0xC7, 0x77, 0x77, 0x77, 0x9D, 0x6A, 0xCA, 0x6D, 0x96, 0xD6, 0x9D,
+    0x6A, 0xCA, 0x6D, 0x96, 0xD6, 0x9D, 0x6A, 0xCA, 0x6D, 0xA6, 0xD9, 0x59, 0xD6, 0xE6, 0xE5, 0x4C,
+    0x96, 0xAD, 0x94, 0x9C, 0x1A, 0xA7, 0x77, 0x09, 0xD6, 0xAC, 0xA6, 0xD9, 0x6D, 0x69, 0xD6, 0xAC,
+    0xA6, 0xD9, 0x6D, 0x69, 0xD6, 0xAC, 0xA6, 0xDA, 0x6D, 0x95, 0x9D, 0x6E, 0x6E, 0x50, 0x3A, 0xA1,
+    0x9A, 0x92, 0x9D, 0x1D, 0x92, 0xE0, 0x9D, 0x97, 0x77, 0x74, 0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD7,
+    0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0xA7, 0xD9, 0x69, 0xD7, 0xE7, 0xE6,
+    0x77, 0x2A, 0xFD, 0xA6, 0xFF, 0xC5, 0xD3, 0xAD, 0xA3, 0x9C, 0xA4, 0x9D, 0x3A, 0xC9, 0x5D, 0x92,
+    0xD6, 0xD9, 0x9A, 0xAD, 0xAA, 0xA3, 0xD9, 0xFE, 0xA3, 0xD2, 0xD6, 0xAD, 0x2D, 0x5A, 0xDA, 0x19,
+    0xDA, 0xAA, 0xAF, 0xC2, 0xAF, 0xFD, 0x92, 0xFF, 0xD4, 0xFE, 0xA5, 0x70, 0xAC, 0x90, 0x9A, 0x71,
+    0x9C, 0x0C, 0x0A, 0x72, 0xA9, 0x09, 0xCA, 0x77, 0x70, 0x9A, 0xA5, 0xD5, 0xE4, 0x9C, 0xA4, 0x9E,
+    0x4D, 0x94, 0xAE, 0x93, 0xD5, 0xFA, 0x2A, 0xCA, 0x49, 0xD9, 0xD2, 0xD9, 0x4A, 0xCA, 0x0D, 0x2D,
+    0x5D, 0x90, 0xD1, 0xAC, 0xA4, 0x9D, 0x1D, 0x90, 0xD9, 0x4A, 0xD1, 0xAC, 0xA9, 0xD5, 0xDA, 0x19,
+    0xDA, 0xCA, 0x49, 0xD9, 0x2F, 0x94, 0xAD, 0x3F, 0x5E, 0x3F, 0x40, 0x77, 0x7A, 0xC7, 0x6D, 0x97,
+    0x69, 0x77, 0x72, 0xAE, 0xA9, 0x7A, 0xDA, 0xAA, 0xDA, 0x5E, 0x39, 0xD9, 0x3A, 0xD5, 0xAC, 0xA2,
+    0x9D, 0x6A, 0xD2, 0xAC, 0x96, 0x9C, 0xA2, 0xD7, 0x9C, 0xA1, 0x9C, 0xA7, 0xAC, 0x91, 0xAC, 0x97,
+    0xD2, 0xAC, 0x96, 0xAC, 0xA2, 0xE5, 0xAD, 0x92, 0xAE, 0xAA, 0xAA, 0xEA, 0x39, 0xFF, 0xD5, 0xFF,
+    0xC7, 0xAF, 0xA9, 0x77, 0x50, 0x77, 0x73, 0xC7, 0x5C, 0xA7, 0x4A, 0xC7, 0x77, 0x77, 0x77, 0x77,
+    0x2A, 0xEA, 0x97, 0xAD, 0xAA, 0xAD, 0xA5, 0xE3, 0x9D, 0x93, 0xAD, 0x5A, 0xCA, 0x29, 0xD6, 0xAD,
+    0x2A, 0xC9, 0x69, 0xCA, 0x2D, 0x79, 0xCA, 0x19, 0xCA, 0x7A, 0xC9, 0x1A, 0xC9, 0x7D, 0x2A, 0xC9,
+    0x6A, 0xCA, 0x2E, 0x5A, 0xD9, 0x2A, 0xEA, 0xAA, 0xAE, 0xA3, 0x9F, 0xFD, 0x5F, 0xFC, 0x7A, 0xFA,
+    0x97, 0x75, 0x70, 0xC9, 0x74, 0xAD, 0x97, 0x29, 0xA1, 0xAA, 0x77, 0x71, 0xAE, 0xA9, 0x7A, 0xDA,
+    0xAA, 0xDA, 0x5E, 0x39, 0xD9, 0x3A, 0xD5, 0xAC, 0xA2, 0x9D, 0x6A, 0xD2, 0xAC, 0x96, 0x9C, 0xA2,
+    0xD7, 0x9C, 0xA1, 0x9C, 0xA7, 0xAC, 0x91, 0xAC, 0x97, 0xD2, 0xAC, 0x96, 0xAC, 0xA2, 0xE5, 0xAD,
+    0x92, 0xAE, 0xAA, 0xAA, 0xEA, 0x39, 0xFF, 0xD5, 0xFF, 0xC7, 0xAF, 0xA9, 0x77, 0x50, 0x79, 0xC9,
+    0x1A, 0x71, 0xC0, 0xC0, 0x9A, 0x70, 0x9C, 0x1D, 0x72, 0x97, 0x77, 0x5A, 0xEA, 0x97, 0xAD, 0xAA,
+    0xAD, 0xA5, 0xE3, 0x9D, 0x93, 0xAD, 0x5A, 0xCA, 0x29, 0xD6, 0xAD, 0x2A, 0xC9, 0x69, 0xCA, 0x2D,
+    0x79, 0xCA, 0x19, 0xCA, 0x7A, 0xC9, 0x1A, 0xC9, 0x7D, 0x2A, 0xC9, 0x6A, 0xCA, 0x2E, 0x5A, 0xD9,
+    0x2A, 0xEA, 0xAA, 0xAE, 0xA3, 0x9F, 0xFD, 0x5F, 0xFC, 0x7A, 0xFA, 0x97, 0x75, 0x7A, 0xA1, 0x9A,
+    0x97, 0x9C, 0xA1, 0xD9, 0x7D, 0xA0, 0x9D, 0x77, 0x77, 0x70, 0xAE, 0xA9, 0x7A, 0xDA, 0xAA, 0xDA,
+    0x5E, 0x39, 0xD9, 0x3A, 0xD5, 0xAC, 0xA2, 0x9D, 0x6A, 0xD2, 0xAC, 0x96, 0x9C, 0xA2, 0xD7, 0x9C,
+    0xA1, 0x9C, 0xA7, 0xAC, 0x91, 0xAC, 0x97, 0xD2, 0xAC, 0x96, 0xAC, 0xA2, 0xE5, 0xAD, 0x92, 0xAE,
+    0xAA, 0xAA, 0xEA, 0x39, 0xFF, 0xD5, 0xFF, 0xC7, 0xAF, 0xA9, 0x77, 0x50, 0x2A, 0x2A, 0x3D, 0x9C,
+    0x94, 0xD4, 0x9E, 0xA2, 0xAC, 0xA0, 0xAC, 0xA0, 0x77, 0x77, 0x77, 0x6D, 0x77, 0x71, 0xD7, 0x77,
+    0x1D, 0x97, 0x77, 0x0D, 0x97, 0x77, 0x0D, 0x97, 0x77, 0x0D, 0x97, 0x72, 0xAF, 0x9D, 0x97, 0x71,
+    0xAD, 0xAA, 0xAE, 0xA7, 0x71, 0xE3, 0xE9, 0x77, 0x0A, 0xD3, 0xAE, 0xA7, 0x79, 0xD3, 0xAD, 0xAD,
+    0x77, 0xAC, 0x92, 0xAD, 0x09, 0xCA, 0x77, 0xD2, 0x9D, 0x19, 0xCA, 0x76, 0x9C, 0xA1, 0x9D, 0x2A,
+    0xC9, 0x76, 0xAC, 0x90, 0x9D, 0x3D, 0x77, 0xAC, 0x99, 0xD9, 0x2A, 0xCA, 0x77, 0xFC, 0x92, 0xAD,
+    0x97, 0x7A, 0xFA, 0xAA, 0xEA, 0x77, 0x09, 0xFF, 0xD7, 0x71, 0xFF, 0xD7, 0x71, 0xDA, 0xAF, 0xA9,
+    0x77, 0x1D, 0xA7, 0x77, 0x0E, 0x77, 0x70, 0xE7, 0x77, 0x0E, 0x77, 0x70, 0xE7, 0x77, 0x0C, 0xA9,
+    0x77, 0x77, 0x77, 0x50, 0x69, 0xC7, 0x5D, 0x97, 0x49, 0xA7, 0x77, 0x74, 0xAD, 0x5D, 0xA2, 0xDA,
+    0x49, 0xD3, 0xD9, 0x4A, 0xD2, 0x9D, 0x5D, 0xA2, 0xAD, 0x5D, 0x92, 0xDA, 0x49, 0xD3, 0xD5, 0xAC,
+    0xA2, 0x9D, 0x5D, 0x92, 0xAC, 0xA5, 0xD3, 0xAC, 0xA4, 0xAC, 0xA3, 0xE9, 0x2A, 0xD9, 0x3F, 0xFD,
+    0x4F, 0xFC, 0x95, 0xAF, 0xCA, 0x97, 0x73, 0x72, 0x9A, 0x73, 0x9C, 0x74, 0xC9, 0x74, 0x97, 0x77,
+    0x77, 0x77, 0x72, 0xAD, 0x5D, 0xA2, 0xDA, 0x49, 0xD3, 0xD9, 0x4A, 0xD2, 0x9D, 0x5D, 0xA2, 0xAD,
+    0x5D, 0x92, 0xDA, 0x49, 0xD3, 0xD5, 0xAC, 0xA2, 0x9D, 0x5D, 0x92, 0xAC, 0xA5, 0xD3, 0xAC, 0xA4,
+    0xAC, 0xA3, 0xE9, 0x2A, 0xD9, 0x3F, 0xFD, 0x4F, 0xFC, 0x95, 0xAF, 0xCA, 0x97, 0x73, 0x77, 0x6D,
+    0x73, 0xAC, 0xAC, 0x71, 0x9C, 0x2A, 0x97, 0x73, 0xAD, 0x5D, 0xA2, 0xE4, 0x9D, 0x92, 0xD9, 0x4A,
+    0xD2, 0x9D, 0x5D, 0xA2, 0xAD, 0x5D, 0x92, 0xDA, 0x49, 0xD3, 0xD5, 0xAC, 0xA2, 0x9D, 0x5D, 0x92,
+    0x9C, 0xA5, 0xD3, 0xAC, 0xA4, 0xAC, 0xA3, 0xE9, 0x2A, 0xD9, 0x3F, 0xFD, 0x4F, 0xFC, 0x95, 0xAF,
+    0xCA, 0x97, 0x73, 0x6A, 0xC2, 0xCA, 0x7D, 0x1A, 0xCA, 0x69, 0xAA, 0x1A, 0xA9, 0x77, 0x77, 0x1A,
+    0xD5, 0xDA, 0x2E, 0x49, 0xD9, 0x2D, 0x94, 0xAD, 0x29, 0xD5, 0xDA, 0x2A, 0xD5, 0xD9, 0x2D, 0xA4,
+    0x9D, 0x3D, 0x5A, 0xCA, 0x29, 0xD5, 0xD9, 0x29, 0xCA, 0x5D, 0x3A, 0xCA, 0x4A, 0xCA, 0x3E, 0x92,
+    0xAD, 0x93, 0xFF, 0xD4, 0xFF, 0xC9, 0x5A, 0xFC, 0xA9, 0x77, 0x30, 0x70, 0x97, 0x1A, 0xA7, 0x09,
+    0xC7, 0x1C, 0x97, 0x77, 0x77, 0x77, 0x69, 0xCA, 0x5A, 0xCA, 0x0D, 0x49, 0xD1, 0xD9, 0x3D, 0x2A,
+    0xCA, 0x2D, 0x92, 0xAD, 0x1D, 0x93, 0x9D, 0x0A, 0xCA, 0x5F, 0xC6, 0xF7, 0xAD, 0x97, 0xAD, 0x70,
+    0xDA, 0x7A, 0xD9, 0x7E, 0x7A, 0xE7, 0x3A, 0xC7, 0x0D, 0x79, 0xF9, 0x4A, 0xC1, 0xAC, 0xA3, 0xD2,
+    0xAC, 0x3C, 0xA3, 0xC9, 0x19, 0xC3, 0xAC, 0x2A, 0xC1, 0x9D, 0x92, 0xDA, 0xE4, 0xEA, 0x94, 0x9C,
+    0x70, 0xAC, 0x70, 0xCA, 0x70, 0x49, 0xAD, 0x95, 0xAC, 0x91, 0xC9, 0x39, 0xC3, 0x9A, 0x3A, 0xA2,
+    0xAC, 0x93, 0xC9, 0x1C, 0x94, 0x9C, 0x1A, 0x95, 0xAC, 0x1A, 0xA5, 0xD1, 0x9C, 0x93, 0x9C, 0xA2,
+    0xAC, 0x92, 0xAC, 0x93, 0xD2, 0xD3, 0x9C, 0xA2, 0xD9, 0xFC, 0x2A, 0xCA, 0x9E, 0xA3, 0x49, 0x97,
+    0x1C, 0xA7, 0x09, 0xCA, 0x77, 0x1A, 0xDA, 0x5F, 0xDA, 0x2A, 0xCA, 0x1A, 0xCA, 0x19, 0xC9, 0x29,
+    0xC9, 0x1C, 0xA3, 0xAC, 0x2C, 0x4D, 0x19, 0xC3, 0xAD, 0x19, 0xDA, 0xAE, 0xA2, 0xFE, 0xA2, 0x9E,
+    0xA9, 0xC9, 0x00, 0x77, 0x3C, 0x97, 0xAA, 0x79, 0xC7, 0x77, 0x77, 0xAD, 0xA5, 0xFD, 0xA2, 0xAC,
+    0xA1, 0xAC, 0xA1, 0x9C, 0x92, 0x9C, 0x91, 0xCA, 0x3A, 0xC2, 0xC4, 0xD1, 0x9C, 0x3A, 0xD1, 0x9D,
+    0xAA, 0xEA, 0x2F, 0xEA, 0x29, 0xEA, 0x9C, 0x90, 0x6C, 0xA7, 0x09, 0xDA, 0x7C, 0x19, 0xA7, 0x71,
+    0xAD, 0xA6, 0xFD, 0xA3, 0xAC, 0xA1, 0xAC, 0xA2, 0x9C, 0x92, 0x9C, 0x92, 0xCA, 0x3A, 0xC3, 0xC4,
+    0xD2, 0x9C, 0x3A, 0xD2, 0x9D, 0xAA, 0xEA, 0x3F, 0xEA, 0x39, 0xEA, 0x9C, 0x91, 0x49, 0xD1, 0xC5,
+    0xC9, 0x99, 0x9A, 0x5C, 0x1D, 0x77, 0x2A, 0xDA, 0xAA, 0x4C, 0xA1, 0xAC, 0xA3, 0xC9, 0x29, 0xC9,
+    0x2A, 0xC3, 0xAC, 0x3C, 0x93, 0xD2, 0x9C, 0x3A, 0xD2, 0x9D, 0xAA, 0xEA, 0x3F, 0xEA, 0x39, 0xEA,
+    0x9C, 0x91, 0x4A, 0xA2, 0xA9, 0x39, 0xD1, 0xAC, 0x93, 0xAD, 0x1D, 0x97, 0x70, 0xAD, 0xA6, 0xFD,
+    0xA3, 0xAC, 0xA1, 0xAC, 0xA2, 0x9C, 0x92, 0x9C, 0x92, 0xCA, 0x3A, 0xC3, 0xC4, 0xD2, 0x9C, 0x3A,
+    0xD2, 0x9D, 0xAA, 0xEA, 0x3F, 0xEA, 0x39, 0xEA, 0x9C, 0x91, 0x79, 0x70, 0xA0, 0xA6, 0x99, 0x0A,
+    0x7C, 0xA7, 0x71, 0xAD, 0xA5, 0xFD, 0xA2, 0xAC, 0xA1, 0xAC, 0xA1, 0x9C, 0x92, 0x9C, 0x91, 0xCA,
+    0x3A, 0xC2, 0xC4, 0xD1, 0x9C, 0x3A, 0xD1, 0x9D, 0xAA, 0xEA, 0x2F, 0xEA, 0x29, 0xEA, 0x9C, 0x90,
+    0x77, 0x6A, 0xDA, 0x2A, 0xDA, 0x5F, 0xFC, 0x90, 0x9C, 0x3A, 0xCA, 0x1A, 0xDA, 0x3C, 0x91, 0x9C,
+    0x92, 0x9D, 0x99, 0xAA, 0xD9, 0x1C, 0xA3, 0xAF, 0xDA, 0xA2, 0xC4, 0xD7, 0x09, 0xC3, 0xAD, 0x70,
+    0x9D, 0xAA, 0xFC, 0x91, 0x9A, 0x3F, 0xFF, 0xD3, 0x9E, 0xA9, 0xCA, 0xAE, 0xA9, 0x10, 0x74, 0xAE,
+    0x29, 0xDA, 0x9A, 0x2D, 0x59, 0xC9, 0x5D, 0x6C, 0xA6, 0xCA, 0x6D, 0x95, 0xFC, 0xA3, 0xAF, 0x4A,
+    0x70, 0xA7, 0xC5, 0xD9, 0x30, 0x49, 0x71, 0xAC, 0x97, 0x0A, 0xC9, 0x77, 0x77, 0x69, 0xAD, 0x94,
+    0xAC, 0x91, 0xC9, 0x2A, 0xC3, 0x9A, 0x19, 0xCA, 0x9A, 0xAE, 0x1A, 0xFC, 0xAA, 0x91, 0xC9, 0x70,
+    0xCA, 0x70, 0xDA, 0x91, 0x99, 0x2A, 0xFD, 0x93, 0x9F, 0xA2, 0x77, 0x3C, 0x70, 0xAA, 0x7A, 0xC7,
+    0x77, 0x77, 0x77, 0x49, 0xAD, 0x94, 0xAC, 0x91, 0xC9, 0x2A, 0xC3, 0x9A, 0x19, 0xCA, 0x9A, 0xAE,
+    0x1A, 0xFC, 0xAA, 0x91, 0xC9, 0x70, 0xCA, 0x70, 0xDA, 0x91, 0x99, 0x2A, 0xFD, 0x93, 0x9F, 0xA2,
+    0x5C, 0x97, 0xAD, 0x95, 0x9C, 0x1A, 0xA7, 0x77, 0x29, 0xAD, 0x94, 0xAC, 0x91, 0xC9, 0x2A, 0xC3,
+    0x9A, 0x19, 0xCA, 0x9A, 0xAE, 0x1A, 0xFC, 0xAA, 0x91, 0xC9, 0x70, 0xCA, 0x70, 0xDA, 0x91, 0x99,
+    0x2A, 0xFD, 0x93, 0x9F, 0xA2, 0x4A, 0xA1, 0x9A, 0x93, 0x9D, 0x1D, 0x93, 0xDA, 0x09, 0xD9, 0x77,
+    0x77, 0x79, 0xAD, 0x95, 0xAC, 0x91, 0xC9, 0x3A, 0xC3, 0x9A, 0x29, 0xCA, 0x9A, 0xAE, 0x2A, 0xFC,
+    0xAA, 0x92, 0xC9, 0x71, 0xCA, 0x71, 0xDA, 0x91, 0x99, 0x3A, 0xFD, 0x94, 0x9F, 0xA3, 0x19, 0xA5,
+    0xD5, 0xAA, 0x77, 0x1A, 0xC4, 0xCA, 0x4C, 0x93, 0x9C, 0x4A, 0xA4, 0xCA, 0x39, 0xC9, 0x3D, 0x4D,
+    0x30, 0x69, 0x6A, 0xA5, 0x9C, 0x6C, 0x97, 0x77, 0x77, 0x09, 0xC6, 0xAA, 0x6C, 0x95, 0x9C, 0x6A,
+    0xC6, 0xCA, 0x59, 0xC9, 0x5D, 0x6D, 0x50, 0x2A, 0xA6, 0xDA, 0x4C, 0x90, 0x9A, 0x75, 0x9C, 0x6C,
+    0xA6, 0xC9, 0x59, 0xC6, 0xAC, 0x6C, 0xA5, 0x9C, 0x95, 0xD6, 0xD5, 0x1D, 0x19, 0xCA, 0x09, 0xD1,
+    0xDA, 0x0A, 0xAA, 0x1A, 0xA9, 0x77, 0x49, 0xC6, 0xCA, 0x6C, 0x95, 0x9C, 0x6A, 0xC6, 0xCA, 0x59,
+    0xC9, 0x5D, 0x6D, 0x50, 0x77, 0x7A, 0xCA, 0x74, 0x9C, 0x71, 0x9A, 0xAD, 0xAA, 0xA6, 0xAF, 0xDA,
+    0x59, 0x2C, 0x95, 0x9F, 0x09, 0xC5, 0x9C, 0xA1, 0xAA, 0xC9, 0x5C, 0xA3, 0xD5, 0x9C, 0x4C, 0xA5,
+    0xAC, 0x39, 0xC6, 0xAC, 0xA0, 0x9A, 0xC9, 0x69, 0xFC, 0xA7, 0x09, 0xE9, 0x70, 0x6D, 0x1C, 0x6C,
+    0x99, 0xA9, 0xA6, 0xC1, 0xD7, 0x75, 0x99, 0x69, 0xFD, 0x5A, 0xD1, 0x9C, 0x94, 0xD2, 0x9C, 0x93,
+    0x9C, 0xA2, 0x9C, 0x93, 0xAC, 0x3D, 0x4D, 0x3D, 0x39, 0xD2, 0x9C, 0xA3, 0xAC, 0xA2, 0xAC, 0xA3,
+    0xD9, 0x2D, 0x92, 0x49, 0x71, 0xAC, 0x97, 0x0A, 0xC9, 0x77, 0x77, 0x6A, 0xE9, 0x4D, 0xAA, 0xAC,
+    0x92, 0xD3, 0xCA, 0x19, 0xC4, 0xAC, 0x1D, 0x4C, 0xA1, 0xCA, 0x4C, 0xA1, 0xCA, 0x3A, 0xC2, 0xDA,
+    0xAA, 0xDA, 0x2A, 0xFC, 0xA4, 0xAE, 0x93, 0x77, 0x3C, 0x70, 0xC9, 0x7A, 0xC7, 0x77, 0x77, 0x77,
+    0x4A, 0xE9, 0x4D, 0xAA, 0xAC, 0x92, 0xD3, 0xCA, 0x19, 0xC4, 0xAC, 0x1D, 0x4C, 0xA1, 0xCA, 0x4C,
+    0xA1, 0xCA, 0x3A, 0xC2, 0xDA, 0xAA, 0xDA, 0x2A, 0xFC, 0xA4, 0xAE, 0x93, 0x5C, 0x97, 0xAD, 0x95,
+    0x9A, 0x1A, 0xA7, 0x77, 0x2A, 0xE9, 0x4D, 0xAA, 0xAC, 0x92, 0xD3, 0xCA, 0x19, 0xC4, 0xAC, 0x1D,
+    0x4C, 0xA1, 0xCA, 0x4C, 0xA1, 0xCA, 0x3A, 0xC2, 0xDA, 0xAA, 0xDA, 0x2A, 0xFC, 0xA4, 0xAE, 0x93,
+    0x49, 0xC9, 0x1A, 0x4C, 0x0C, 0x09, 0xA3, 0x9A, 0x1D, 0x77, 0x77, 0x5A, 0xE9, 0x4D, 0xAA, 0xAC,
+    0x92, 0xD3, 0xCA, 0x19, 0xC4, 0xAC, 0x1D, 0x4C, 0xA1, 0xCA, 0x4C, 0xA1, 0xCA, 0x3A, 0xC2, 0xDA,
+    0xAA, 0xDA, 0x2A, 0xFC, 0xA4, 0xAE, 0x93, 0x4A, 0xA1, 0x9A, 0x93, 0x9C, 0xA1, 0xD9, 0x3D, 0xA0,
+    0x9D, 0x77, 0x77, 0x70, 0xAE, 0x95, 0xDA, 0xAA, 0xC9, 0x3D, 0x3C, 0xA2, 0x9C, 0x4A, 0xC2, 0xD4,
+    0xCA, 0x2C, 0xA4, 0xCA, 0x2C, 0xA3, 0xAC, 0x3D, 0xAA, 0xAD, 0xA3, 0xAF, 0xCA, 0x5A, 0xE9, 0x40,
+    0x49, 0xCA, 0x7D, 0x97, 0xAA, 0x97, 0x74, 0x99, 0x99, 0x0A, 0xFF, 0xA7, 0x6A, 0x97, 0xAC, 0xA7,
+    0xD9, 0x40, 0x76, 0x97, 0x5C, 0x75, 0xAA, 0x75, 0xC7, 0x5C, 0xA7, 0x49, 0xC7, 0x5C, 0xA7, 0x49,
+    0xC7, 0x2A, 0xEA, 0x71, 0xDA, 0xE9, 0x7D, 0x1C, 0x9D, 0x69, 0xC1, 0xAC, 0x0A, 0xC6, 0xD1, 0xC9,
+    0x0D, 0x6C, 0xA0, 0xAC, 0x1C, 0xA6, 0xC9, 0x9C, 0x90, 0xAC, 0x7F, 0xAD, 0xA7, 0xFD, 0xA7, 0x1F,
+    0x97, 0x1A, 0xC7, 0x5C, 0xA7, 0x4A, 0xC7, 0x5C, 0xA7, 0x4D, 0x74, 0x9C, 0x97, 0x4D, 0x74, 0x99,
+    0x77, 0x75, 0x76, 0x9C, 0x97, 0x0A, 0xC9, 0x71, 0x97, 0x7C, 0xA3, 0xAC, 0x2C, 0xA3, 0xD2, 0xC9,
+    0x3C, 0xA1, 0x9C, 0x39, 0xC9, 0x1A, 0xC3, 0xAC, 0x2D, 0x3D, 0x2D, 0x2A, 0xCA, 0x2F, 0xEA, 0x2F,
+    0xE9, 0x29, 0xE9, 0xAC, 0x20, 0x77, 0x2C, 0x97, 0xAA, 0x79, 0xC7, 0x77, 0x77, 0x70, 0xCA, 0x3A,
+    0xC2, 0xCA, 0x3D, 0x2C, 0x93, 0xCA, 0x19, 0xC3, 0x9C, 0x91, 0xAC, 0x3A, 0xC2, 0xD3, 0xD2, 0xD2,
+    0xAC, 0xA2, 0xFE, 0xA2, 0xFE, 0x92, 0x9E, 0x9A, 0xC2, 0x4C, 0x97, 0xAD, 0xA5, 0x9C, 0x19, 0xA7,
+    0x6C, 0xA3, 0xAC, 0x2C, 0xA3, 0xD2, 0xC9, 0x3C, 0xA1, 0x9C, 0x39, 0xC9, 0x1A, 0xC3, 0xAC, 0x2D,
+    0x3D, 0x2D, 0x2A, 0xCA, 0x2F, 0xEA, 0x2F, 0xE9, 0x29, 0xE9, 0xAC, 0x20, 0x3A, 0xA2, 0xA9, 0x29,
+    0xD1, 0xAC, 0x92, 0xAD, 0x1D, 0x97, 0x77, 0xCA, 0x3A, 0xC2, 0xCA, 0x3D, 0x2C, 0x93, 0xCA, 0x19,
+    0xC3, 0x9C, 0x91, 0xAC, 0x3A, 0xC2, 0xD3, 0xD2, 0xD2, 0xAC, 0xA2, 0xFE, 0xA2, 0xFE, 0x92, 0x9E,
+    0x9A, 0xC2, 0x71, 0xAA, 0x71, 0x9C, 0x72, 0xC9, 0x72, 0x97, 0x77, 0x77, 0x77, 0x76, 0xAC, 0x4D,
+    0x39, 0xC9, 0x29, 0xC9, 0x4C, 0xA2, 0xD5, 0xD1, 0x9C, 0x95, 0xD1, 0xD6, 0xAC, 0xAA, 0xC9, 0x69,
+    0xF7, 0x0E, 0xA7, 0x0E, 0x71, 0xDA, 0x70, 0x9D, 0x70, 0xAD, 0x95, 0x9F, 0x96, 0xAD, 0xA7, 0x75,
+    0x77, 0xC7, 0x09, 0xC7, 0x0A, 0xC7, 0x0F, 0x6C, 0x90, 0xD4, 0x9C, 0x2C, 0xA3, 0xAA, 0x2A, 0xA3,
+    0xC9, 0x2C, 0x93, 0xC2, 0x9C, 0x39, 0xC1, 0x9C, 0x93, 0xAA, 0x0A, 0xCA, 0x4F, 0x95, 0xC9, 0x79,
+    0xC7, 0x0A, 0xA7, 0x0C, 0x97, 0x09, 0x70, 0x5D, 0x19, 0xCA, 0x49, 0xD1, 0xAC, 0xA4, 0xAA, 0xA1,
+    0xAA, 0x97, 0x77, 0x77, 0x1A, 0xC4, 0xD3, 0x9C, 0x92, 0x9C, 0x94, 0xCA, 0x2D, 0x5D, 0x19, 0xC9,
+    0x5D, 0x1D, 0x6A, 0xCA, 0xAC, 0x96, 0x9F, 0x70, 0xEA, 0x70, 0xE7, 0x1D, 0xA7, 0x09, 0xD7, 0x0A,
+    0xD9, 0x59, 0xF9, 0x6A, 0xDA, 0x77, 0x50, 0x77, 0x7A, 0xFD, 0x70, 0x99, 0x97, 0x77, 0x77, 0x59,
+    0xD7, 0x4E, 0x73, 0xAE, 0x72, 0x9C, 0xAA, 0xC7, 0x2D, 0x0A, 0xC7, 0x1A, 0xC9, 0x0A, 0xC9, 0x79,
+    0xCA, 0x19, 0xC9, 0x7D, 0x29, 0xCA, 0x6A, 0xCA, 0x29, 0xCA, 0x59, 0xD3, 0x9D, 0x5F, 0xFD, 0x4A,
+    0xFF, 0xD3, 0x9D, 0x94, 0x9D, 0x3D, 0xA5, 0x9D, 0x91, 0x70, 0x99, 0x4A, 0xFD, 0x97, 0x70, 0xAD,
+    0xA6, 0xFD, 0xA3, 0xAC, 0xA1, 0xAC, 0xA2, 0x9C, 0x92, 0x9C, 0x92, 0xCA, 0x3A, 0xC3, 0xC4, 0xD2,
+    0x9C, 0x3A, 0xD2, 0x9D, 0xAA, 0xEA, 0x3F, 0xEA, 0x39, 0xEA, 0x9C, 0x91, 0x77, 0x79, 0xC3, 0xC7,
+    0x1D, 0xAD, 0x97, 0x19, 0xDA, 0x77, 0x77, 0x77, 0x73, 0x9D, 0x74, 0xE7, 0x3A, 0xE7, 0x29, 0xCA,
+    0xAC, 0x72, 0xD0, 0xAC, 0x71, 0xAC, 0x90, 0xAC, 0x97, 0x9C, 0xA1, 0x9C, 0x97, 0xD2, 0x9C, 0xA6,
+    0xAC, 0xA2, 0x9C, 0xA5, 0x9D, 0x39, 0xD5, 0xFF, 0xD4, 0xAF, 0xFD, 0x39, 0xD9, 0x49, 0xD3, 0xDA,
+    0x59, 0xD9, 0x10, 0x4A, 0x39, 0x5C, 0x91, 0x9C, 0x5F, 0xC7, 0x9A, 0x97, 0x73, 0xAD, 0xA6, 0xFD,
+    0xA3, 0xAC, 0xA1, 0xAC, 0xA2, 0x9C, 0x92, 0x9C, 0x92, 0xCA, 0x3A, 0xC3, 0xC4, 0xD2, 0x9C, 0x3A,
+    0xD2, 0x9D, 0xAA, 0xEA, 0x3F, 0xEA, 0x39, 0xEA, 0x9C, 0x91, 0x70, 0x9D, 0x72, 0xE7, 0x1A, 0xE7,
+    0x09, 0xCA, 0xAC, 0x70, 0xD0, 0xAC, 0x7A, 0xC9, 0x0A, 0xC9, 0x59, 0xCA, 0x19, 0xC9, 0x5D, 0x29,
+    0xCA, 0x4A, 0xCA, 0x29, 0xCA, 0x39, 0xD3, 0x9D, 0x3F, 0xFD, 0x2A, 0xFF, 0xD1, 0x9D, 0x94, 0x9D,
+    0x1D, 0xA5, 0x9D, 0x97, 0x1A, 0xA7, 0x2A, 0x97, 0x3C, 0x74, 0xAC, 0xA7, 0x70, 0x77, 0xAD, 0xA5,
+    0xFD, 0xA2, 0xAC, 0xA1, 0xAC, 0xA1, 0x9C, 0x92, 0x9C, 0x91, 0xCA, 0x3A, 0xC2, 0xC4, 0xD1, 0x9C,
+    0x3A, 0xD1, 0x9D, 0xAA, 0xEA, 0x2F, 0xEA, 0x29, 0xEA, 0xAC, 0x96, 0xAA, 0x70, 0xC7, 0x19, 0xCA,
+    0x74, 0x77, 0x70, 0xC9, 0x72, 0xAA, 0x72, 0x9C, 0x77, 0x77, 0x77, 0x77, 0x29, 0xAE, 0x95, 0xAF,
+    0xD9, 0x4E, 0x97, 0x0D, 0xA7, 0x1D, 0xA7, 0x19, 0xD7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2E,
+    0x72, 0xEA, 0x71, 0xFD, 0xAA, 0xD3, 0xAF, 0xFA, 0x4F, 0xF9, 0x49, 0xFD, 0xA7, 0x71, 0x7C, 0x7C,
+    0xA6, 0xAC, 0x79, 0x77, 0x72, 0xAE, 0x39, 0xDA, 0x9A, 0x3D, 0x69, 0xC9, 0x6D, 0x7C, 0xA7, 0xCA,
+    0x7D, 0x96, 0xFC, 0xA4, 0xAF, 0x74, 0x70, 0xAA, 0x74, 0xDA, 0x72, 0xC9, 0x09, 0xA7, 0x77, 0x77,
+    0x76, 0x9A, 0xE9, 0x6A, 0xFD, 0x95, 0xE9, 0x71, 0xDA, 0x72, 0xDA, 0x72, 0x9D, 0x73, 0xD9, 0x72,
+    0x9D, 0x73, 0xAD, 0x73, 0xE7, 0x3E, 0xA7, 0x2F, 0xDA, 0xAD, 0x4A, 0xFF, 0xA5, 0xFF, 0x95, 0x9F,
+    0xDA, 0x77, 0x30, 0x77, 0x0C, 0xA7, 0xAC, 0xAC, 0x59, 0xA2, 0xA7, 0x7A, 0xE4, 0x9D, 0xA9, 0xA4,
+    0xD7, 0x9C, 0x97, 0xD7, 0x0C, 0xA7, 0x0C, 0xA7, 0x0D, 0x97, 0xFC, 0xA5, 0xAF, 0x76, 0x71, 0xA9,
+    0x72, 0xD9, 0x72, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAE, 0x95, 0xAF, 0xD9, 0x4E, 0x97, 0x0D,
+    0xA7, 0x1D, 0xA7, 0x19, 0xD7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2E, 0x72, 0xEA, 0x71, 0xFD,
+    0xAA, 0xD3, 0xAF, 0xFA, 0x4F, 0xF9, 0x49, 0xFD, 0xA7, 0x71, 0x5A, 0xC9, 0x5D, 0x59, 0xAA, 0x77,
+    0x6A, 0xE2, 0x9D, 0xA9, 0xA2, 0xD5, 0x9C, 0x95, 0xD6, 0xCA, 0x6C, 0xA6, 0xD9, 0x5F, 0xCA, 0x3A,
+    0xF7, 0x20, 0x77, 0x4C, 0x2A, 0x97, 0x9C, 0xAC, 0x72, 0xAC, 0x77, 0x77, 0x77, 0x77, 0x39, 0xAE,
+    0x95, 0xAF, 0xD9, 0x4E, 0x97, 0x0D, 0xA7, 0x1D, 0xA7, 0x19, 0xD7, 0x2D, 0x97, 0x19, 0xD7, 0x2A,
+    0xD7, 0x2E, 0x72, 0xEA, 0x71, 0xFD, 0xAA, 0xD3, 0xAF, 0xFA, 0x4F, 0xF9, 0x49, 0xFD, 0xA7, 0x71,
+    0x29, 0x92, 0x99, 0x3C, 0xA9, 0xC9, 0x5D, 0x79, 0x77, 0x73, 0xAE, 0x39, 0xDA, 0x9A, 0x3D, 0x69,
+    0xC9, 0x6D, 0x7C, 0xA7, 0xCA, 0x7D, 0x96, 0xFC, 0xA4, 0xAF, 0x74, 0x77, 0x5A, 0x91, 0xAA, 0x71,
+    0xCA, 0xC9, 0x72, 0x9C, 0x97, 0x77, 0x77, 0x74, 0xAF, 0xDA, 0x6F, 0xFC, 0x5D, 0x39, 0xDA, 0x39,
+    0xC9, 0x49, 0xD3, 0xAC, 0x6D, 0x92, 0xD6, 0xD9, 0x19, 0xCA, 0x6D, 0x91, 0xAC, 0x96, 0xD2, 0xD6,
+    0xAD, 0x2D, 0x5A, 0xDA, 0x19, 0xDA, 0xAA, 0xAF, 0xC2, 0xAF, 0xFD, 0x92, 0xFF, 0xD4, 0xFE, 0x95,
+    0x72, 0xC9, 0x74, 0x9C, 0x1A, 0x72, 0xAC, 0x09, 0xC7, 0x2C, 0x90, 0xAC, 0x71, 0x9C, 0x1C, 0xA4,
+    0x9A, 0xD0, 0xAC, 0x19, 0x4A, 0xFA, 0xCA, 0x6A, 0xC9, 0x1A, 0xD9, 0x59, 0xC9, 0x29, 0xD6, 0xAC,
+    0x39, 0xCA, 0x6C, 0xA3, 0xAC, 0x96, 0xCA, 0x29, 0xD7, 0xEA, 0xF7, 0xFF, 0x70, 0xAE, 0x9C, 0xA7,
+    0x76, 0x77, 0x2A, 0xFD, 0xA6, 0xFF, 0xC5, 0xD3, 0xAD, 0xA3, 0x9C, 0xA4, 0x9D, 0x3A, 0xC9, 0x5D,
+    0x92, 0xD6, 0xD9, 0x9A, 0xAD, 0xAA, 0xA3, 0xD9, 0xFE, 0xA3, 0xD2, 0xD6, 0xAD, 0x2D, 0x5A, 0xDA,
+    0x19, 0xDA, 0xAA, 0xAF, 0xC2, 0xAF, 0xFD, 0x92, 0xFF, 0xD4, 0xFE, 0xA5, 0x72, 0xC9, 0x73, 0x9C,
+    0x71, 0xAA, 0xAD, 0xAA, 0x96, 0xFE, 0x97, 0x09, 0xC7, 0x9A, 0xD0, 0xAC, 0x6A, 0xFA, 0xCA, 0x5A,
+    0xC9, 0x1A, 0xD9, 0x49, 0xC9, 0x29, 0xD5, 0xAC, 0x39, 0xCA, 0x5C, 0xA3, 0xAC, 0x95, 0xCA, 0x29,
+    0xD6, 0xEA, 0xF6, 0xFF, 0x7A, 0xE9, 0xCA, 0x77, 0x40, 0x77, 0x39, 0xFD, 0xA5, 0x99, 0x99, 0x77,
+    0x77, 0x4F, 0xF4, 0xAF, 0xDA, 0x94, 0xD7, 0x3D, 0x72, 0x9C, 0xA7, 0x2A, 0xC9, 0x72, 0xFD, 0xA5,
+    0x9F, 0xD9, 0x5A, 0xCA, 0x72, 0xD7, 0x3D, 0x72, 0xAF, 0xF4, 0xFF, 0xC4, 0xFF, 0xC3, 0x70, 0x99,
+    0x4A, 0xFD, 0x97, 0x77, 0x77, 0x9A, 0xD9, 0x5A, 0xC9, 0x1C, 0x93, 0xAC, 0x39, 0xA2, 0x9C, 0xA9,
+    0xAA, 0xE2, 0xAF, 0xCA, 0xA9, 0x2C, 0x97, 0x1C, 0xA7, 0x1D, 0xA9, 0x19, 0x93, 0xAF, 0xD9, 0x49,
+    0xFA, 0x30, 0x69, 0x74, 0xC3, 0xC9, 0x6D, 0xAA, 0xCA, 0x70, 0xE9, 0x77, 0x77, 0x77, 0x0F, 0xF4,
+    0xAF, 0xDA, 0x94, 0xD7, 0x3D, 0x72, 0x9C, 0xA7, 0x2A, 0xC9, 0x72, 0xFD, 0xA5, 0x9F, 0xD9, 0x5A,
+    0xCA, 0x72, 0xD7, 0x3D, 0x72, 0xAF, 0xF4, 0xFF, 0xC4, 0xFF, 0xC3, 0x4A, 0x3A, 0x49, 0xC9, 0x19,
+    0xC5, 0xFC, 0x79, 0xA9, 0x77, 0x77, 0x72, 0x9A, 0xD9, 0x5A, 0xC9, 0x1C, 0x93, 0xAC, 0x39, 0xA2,
+    0x9C, 0xA9, 0xAA, 0xE2, 0xAF, 0xCA, 0xA9, 0x2C, 0x97, 0x1C, 0xA7, 0x1D, 0xA9, 0x19, 0x93, 0xAF,
+    0xD9, 0x49, 0xFA, 0x30, 0x70, 0x9A, 0x97, 0x2D, 0x97, 0x19, 0xD9, 0x77, 0x77, 0x77, 0x0F, 0xF4,
+    0xAF, 0xDA, 0x94, 0xD7, 0x3D, 0x72, 0x9C, 0xA7, 0x2A, 0xC9, 0x72, 0xFD, 0xA5, 0x9F, 0xD9, 0x5A,
+    0xCA, 0x72, 0xD7, 0x3D, 0x72, 0xAF, 0xF4, 0xFF, 0xC4, 0xFF, 0xC3, 0x6A, 0xC7, 0x0D, 0x79, 0xAA,
+    0x77, 0x77, 0x69, 0xAD, 0x94, 0xAC, 0x91, 0xC9, 0x2A, 0xC3, 0x9A, 0x19, 0xCA, 0x9A, 0xAE, 0x1A,
+    0xFC, 0xAA, 0x91, 0xC9, 0x70, 0xCA, 0x70, 0xDA, 0x91, 0x99, 0x2A, 0xFD, 0x93, 0x9F, 0xA2, 0x77,
+    0x2F, 0xF4, 0xAF, 0xDA, 0x94, 0xD7, 0x3D, 0x72, 0x9C, 0xA7, 0x2A, 0xC9, 0x72, 0xFD, 0xA5, 0x9F,
+    0xD9, 0x5A, 0xCA, 0x72, 0xD7, 0x3D, 0x72, 0xAF, 0xF4, 0xFF, 0xC4, 0xFF, 0xC7, 0xC7, 0x3A, 0x97,
+    0x39, 0xD7, 0x75, 0x39, 0xAD, 0x94, 0xAC, 0x91, 0xC9, 0x2A, 0xC3, 0x9A, 0x19, 0xCA, 0x9A, 0xAE,
+    0x1A, 0xFC, 0xAA, 0x91, 0xC9, 0x70, 0xCA, 0x70, 0xDA, 0x91, 0x99, 0x2A, 0xFD, 0x93, 0x9F, 0xA5,
+    0x9A, 0x79, 0xA7, 0x0C, 0x71, 0xAC, 0xA7, 0x70, 0x77, 0x4C, 0x2A, 0x97, 0x9C, 0xAC, 0x72, 0xAC,
+    0x77, 0x77, 0x77, 0x2F, 0xF4, 0xAF, 0xDA, 0x94, 0xD7, 0x3D, 0x72, 0x9C, 0xA7, 0x2A, 0xC9, 0x72,
+    0xFD, 0xA5, 0x9F, 0xD9, 0x5A, 0xCA, 0x72, 0xD7, 0x3D, 0x72, 0xAF, 0xF4, 0xFF, 0xC4, 0xFF, 0xC3,
+    0x39, 0xA2, 0xA9, 0x4A, 0xCA, 0xC7, 0xCA, 0x77, 0x77, 0x77, 0x29, 0xAD, 0x94, 0xAC, 0x91, 0xC9,
+    0x2A, 0xC3, 0x9A, 0x19, 0xCA, 0x9A, 0xAE, 0x1A, 0xFC, 0xAA, 0x91, 0xC9, 0x70, 0xCA, 0x70, 0xDA,
+    0x91, 0x99, 0x2A, 0xFD, 0x93, 0x9F, 0xA2, 0x71, 0xCA, 0x73, 0x9D, 0xA7, 0x2C, 0x19, 0xA7, 0x77,
+    0x99, 0xA9, 0x96, 0xAF, 0xF4, 0xEA, 0x93, 0x93, 0xAD, 0x72, 0x9D, 0x97, 0x2A, 0xD7, 0x3D, 0x97,
+    0x29, 0xD7, 0x39, 0xD3, 0x9F, 0xA1, 0xAC, 0xA4, 0x99, 0xE1, 0xE6, 0xC9, 0x2E, 0xA3, 0x9D, 0x92,
+    0xAF, 0xFD, 0x4F, 0xFD, 0x5A, 0xFC, 0xA9, 0x30, 0x69, 0xC7, 0x2E, 0x70, 0xC9, 0x1A, 0x97, 0x77,
+    0x7A, 0xD9, 0x0C, 0x93, 0x9D, 0xAF, 0x4C, 0xA2, 0xE3, 0x9C, 0x3D, 0xA3, 0xCA, 0x3D, 0x93, 0xC4,
+    0xD4, 0xC3, 0xDA, 0x4D, 0xAA, 0xE9, 0x4F, 0xE6, 0xAD, 0xAC, 0xA7, 0x1D, 0x94, 0x91, 0x9E, 0x49,
+    0xFD, 0x59, 0xFC, 0x71, 0x97, 0x00, 0x79, 0x75, 0xC3, 0xC7, 0x0D, 0xAA, 0xCA, 0x71, 0xE9, 0x77,
+    0x77, 0x79, 0x9A, 0x99, 0x6A, 0xFF, 0x4E, 0xA9, 0x39, 0x3A, 0xD7, 0x29, 0xD9, 0x72, 0xAD, 0x73,
+    0xD9, 0x72, 0x9D, 0x73, 0x9D, 0x39, 0xFA, 0x1A, 0xCA, 0x49, 0x9E, 0x1E, 0x6C, 0x92, 0xEA, 0x39,
+    0xD9, 0x2A, 0xFF, 0xD4, 0xFF, 0xD5, 0xAF, 0xCA, 0x93, 0x4A, 0x93, 0x94, 0xAA, 0x19, 0xC9, 0x49,
+    0xFA, 0x69, 0xA9, 0x77, 0x77, 0xAD, 0x90, 0xC9, 0x29, 0xDA, 0xF3, 0xCA, 0x2E, 0x29, 0xC3, 0xDA,
+    0x2C, 0xA3, 0xD9, 0x2C, 0x4D, 0x3C, 0x3D, 0xA3, 0xDA, 0xAE, 0x93, 0xFE, 0x5A, 0xDA, 0xCA, 0x70,
+    0xD9, 0x39, 0x19, 0xE3, 0x9F, 0xD4, 0x9F, 0xC7, 0x09, 0x70, 0x71, 0x9A, 0x97, 0x2D, 0x97, 0x19,
+    0xD7, 0x77, 0x75, 0x99, 0xA9, 0x95, 0xAF, 0xF3, 0xEA, 0x93, 0x92, 0xAD, 0x71, 0x9D, 0x97, 0x1A,
+    0xD7, 0x2D, 0x97, 0x19, 0xD7, 0x29, 0xD3, 0x9F, 0xA0, 0xAC, 0xA4, 0x99, 0xE0, 0xE6, 0xC9, 0x1E,
+    0xA3, 0x9D, 0x91, 0xAF, 0xFD, 0x3F, 0xFD, 0x4A, 0xFC, 0xA9, 0x20, 0x7C, 0xA7, 0x0A, 0xCA, 0x70,
+    0xAA, 0x97, 0x77, 0x6A, 0xD9, 0x0C, 0x92, 0x9D, 0xAF, 0x3C, 0xA2, 0xE2, 0x9C, 0x3D, 0xA2, 0xCA,
+    0x3D, 0x92, 0xC4, 0xD3, 0xC3, 0xDA, 0x3D, 0xAA, 0xE9, 0x3F, 0xE5, 0xAD, 0xAC, 0xA7, 0x0D, 0x93,
+    0x91, 0x9E, 0x39, 0xFD, 0x49, 0xFC, 0x70, 0x97, 0x79, 0x9A, 0x99, 0x5A, 0xFF, 0x3E, 0xA9, 0x39,
+    0x2A, 0xD7, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0x9D, 0x39, 0xFA, 0x0A, 0xCA,
+    0x49, 0x9E, 0x0E, 0x6C, 0x91, 0xEA, 0x39, 0xD9, 0x1A, 0xFF, 0xD3, 0xFF, 0xD4, 0xAF, 0xCA, 0x97,
+    0x77, 0x75, 0x99, 0x72, 0x9D, 0x97, 0x1A, 0xD7, 0x2D, 0x97, 0x1A, 0xD7, 0x29, 0x96, 0x7E, 0x70,
+    0xD9, 0x79, 0xD7, 0x0D, 0x97, 0x9A, 0xA7, 0x73, 0xAD, 0x90, 0xC9, 0x29, 0xDA, 0xF3, 0xCA, 0x2E,
+    0x29, 0xC3, 0xDA, 0x2C, 0xA3, 0xD9, 0x2C, 0x4D, 0x3C, 0x3D, 0xA3, 0xDA, 0xAE, 0x93, 0xFE, 0x5A,
+    0xDA, 0xCA, 0x70, 0xD9, 0x39, 0x19, 0xE3, 0x9F, 0xD4, 0x9F, 0xC7, 0x09, 0x70, 0x7A, 0xC7, 0x5E,
+    0x73, 0xC9, 0x09, 0xA7, 0x77, 0x09, 0x96, 0x94, 0x9C, 0xA5, 0xD9, 0x3A, 0xC9, 0x5D, 0x4D, 0x59,
+    0xD4, 0xD5, 0xAC, 0xA3, 0x9C, 0xA5, 0xD9, 0x3D, 0x94, 0x9D, 0x4D, 0x94, 0xAD, 0x39, 0xFF, 0xDA,
+    0x3A, 0xFF, 0xD9, 0x3F, 0xFE, 0x93, 0xD9, 0x4E, 0x3A, 0xD5, 0xE3, 0xE4, 0x9D, 0xA3, 0xDA, 0x4A,
+    0xD9, 0x20, 0x5C, 0x97, 0x0A, 0xD9, 0x69, 0xC1, 0xAA, 0x77, 0x2A, 0xC7, 0x1C, 0xA7, 0x1C, 0x71,
+    0xAC, 0x71, 0xCA, 0x71, 0xC9, 0x9A, 0xA9, 0x4A, 0xFD, 0x93, 0xE9, 0x09, 0xCA, 0x3D, 0x3C, 0xA2,
+    0x9C, 0x93, 0xC9, 0x2D, 0x39, 0xC3, 0xD3, 0xAC, 0x29, 0xCA, 0x3D, 0x2D, 0x92, 0x9C, 0xA2, 0xD3,
+    0xAC, 0x91, 0x4A, 0x95, 0x9A, 0x49, 0xCA, 0x5D, 0x4A, 0xC9, 0x5D, 0x4D, 0x59, 0xD3, 0x9D, 0x5A,
+    0xCA, 0x2A, 0xFF, 0xF2, 0x9D, 0xAA, 0xAA, 0xAA, 0xAD, 0x93, 0xD9, 0x4A, 0xD3, 0x9F, 0xFD, 0xA3,
+    0xAF, 0xFD, 0x93, 0xFF, 0xE3, 0x9D, 0x94, 0xE3, 0xAD, 0x5E, 0x3E, 0x49, 0xDA, 0x3D, 0xA4, 0xAD,
+    0x92, 0x4A, 0xC7, 0x1C, 0xA9, 0x99, 0x49, 0xFA, 0xA5, 0xAC, 0x71, 0xCA, 0x70, 0x9C, 0x9A, 0xAA,
+    0x94, 0xAF, 0xD9, 0x3E, 0x90, 0x9C, 0xA3, 0xD3, 0xCA, 0x2A, 0xC9, 0x3C, 0x92, 0xD3, 0x9C, 0x3D,
+    0x3A, 0xC2, 0x9C, 0xA3, 0xD2, 0xD9, 0x29, 0xCA, 0x2D, 0x3A, 0xC9, 0x10, 0x39, 0xCA, 0x1C, 0x3C,
+    0x0A, 0x99, 0xA2, 0x9A, 0x1D, 0x77, 0x77, 0x29, 0xD6, 0xAC, 0xA6, 0xD9, 0x6D, 0x69, 0xD6, 0xAC,
+    0xA6, 0xD9, 0x6D, 0x69, 0xD6, 0xAC, 0xA6, 0xDA, 0x6D, 0x95, 0x9D, 0x6E, 0x6E, 0x50, 0x2A, 0xA1,
+    0xA2, 0xAA, 0x9A, 0x0C, 0x2C, 0x1A, 0xC9, 0x2A, 0x77, 0x2A, 0x6A, 0xC6, 0xC9, 0x6C, 0x69, 0xC6,
+    0xCA, 0x6C, 0xA5, 0x9C, 0x95, 0xD6, 0xD5, 0x79, 0x93, 0xAF, 0xD9, 0x77, 0x77, 0x49, 0xD7, 0xAC,
+    0xA7, 0xD9, 0x7D, 0x79, 0xD7, 0xAC, 0xA7, 0xD9, 0x7D, 0x79, 0xD7, 0xAC, 0xA7, 0xDA, 0x7D, 0x96,
+    0x9D, 0x7E, 0x7E, 0x60, 0x72, 0xFD, 0xA1, 0x99, 0x97, 0x70, 0x96, 0xAC, 0x6C, 0xA6, 0xC6, 0x9C,
+    0x6C, 0xA6, 0xCA, 0x59, 0xC9, 0x5D, 0x6D, 0x50, 0x4D, 0x94, 0xD4, 0x9D, 0x4A, 0xCA, 0x4D, 0x94,
+    0xD4, 0x9D, 0x4A, 0xCA, 0x4D, 0x94, 0xD4, 0x9D, 0x4A, 0xD4, 0xDA, 0x39, 0xD9, 0x3A, 0xD9, 0x3A,
+    0x94, 0x9A, 0x59, 0xD7, 0x40, 0x5A, 0x94, 0xAC, 0xA4, 0xD9, 0x77, 0x49, 0x5A, 0xC5, 0xCA, 0x5C,
+    0x59, 0xC5, 0xAA, 0x5C, 0xA4, 0x9C, 0x94, 0xD5, 0xD4, 0x9A, 0x5C, 0x6A, 0xCA, 0x73, 0x5A, 0xC6,
+    0xD5, 0x9A, 0xA7, 0x77, 0x79, 0xD5, 0xAC, 0xA5, 0xD9, 0x5D, 0x59, 0xD5, 0xAC, 0xA5, 0xD9, 0x5D,
+    0x59, 0xD5, 0xAC, 0xA5, 0xDA, 0x5D, 0x94, 0x9D, 0x5E, 0x5E, 0x40, 0x70, 0xAC, 0x3C, 0xA3, 0xC9,
+    0x29, 0xC3, 0xAA, 0x3C, 0xA2, 0x9C, 0x92, 0xD3, 0xD2, 0x39, 0xD3, 0xD9, 0x3A, 0xCA, 0x3D, 0x4D,
+    0x92, 0xAD, 0x4D, 0x3D, 0xA3, 0x9D, 0x3D, 0x4A, 0xCA, 0x29, 0xD4, 0xD9, 0x2A, 0xCA, 0x4D, 0x3D,
+    0x93, 0x9D, 0x3D, 0x4A, 0xCA, 0x2A, 0xCA, 0x4D, 0xA2, 0xD9, 0x4D, 0x92, 0xD4, 0x9D, 0x29, 0xD4,
+    0xE2, 0xAC, 0x94, 0xE2, 0xD7, 0x19, 0xDA, 0x7F, 0xC7, 0x0F, 0x97, 0x9D, 0xA7, 0x4A, 0x97, 0x4A,
+    0xCA, 0x59, 0xCA, 0x3D, 0x95, 0xD9, 0x74, 0xAA, 0x97, 0x73, 0x97, 0x5A, 0xC6, 0x9C, 0x4C, 0xA6,
+    0xAC, 0x4C, 0x96, 0xCA, 0x39, 0xC6, 0x9C, 0x4A, 0xA6, 0xAC, 0x4C, 0xA6, 0xCA, 0x39, 0xC9, 0x6C,
+    0x93, 0xD6, 0x9C, 0x4D, 0x6C, 0xA7, 0x5C, 0x97, 0x4D, 0x72, 0xAA, 0xD9, 0x71, 0x9E, 0x97, 0x75,
+    0x70, 0xCA, 0x72, 0x9D, 0xA7, 0x1C, 0x19, 0xA7, 0x77, 0x9A, 0xA7, 0x2D, 0xA7, 0x2D, 0x72, 0x9D,
+    0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x2A,
+    0xC9, 0x72, 0xD7, 0x29, 0xD7, 0x2D, 0x97, 0x1A, 0xD7, 0x9F, 0xA7, 0xFA, 0x70, 0xDA, 0x97, 0x00,
+    0x77, 0x59, 0xC9, 0x72, 0xCA, 0xCA, 0x70, 0xA9, 0x19, 0xA7, 0x76, 0xCA, 0x72, 0x9C, 0x97, 0x2A,
+    0xC7, 0x3C, 0xA7, 0x3C, 0x97, 0x29, 0xC7, 0x3A, 0xC7, 0x3C, 0x97, 0x3C, 0x73, 0xAC, 0x73, 0xCA,
+    0x72, 0xAC, 0x70, 0x9A, 0xDA, 0x70, 0xEA, 0x77, 0x60, 0x49, 0xCA, 0x19, 0xD5, 0xAC, 0x91, 0xD9,
+    0x5D, 0x1D, 0x95, 0x9C, 0xA0, 0xDA, 0x6A, 0xC9, 0xAD, 0x7D, 0x9D, 0x79, 0xF7, 0x0A, 0xE9, 0x70,
+    0xF7, 0x09, 0xFC, 0x7A, 0xCA, 0xE9, 0x6D, 0x09, 0xE5, 0x9D, 0x1F, 0x4D, 0xA1, 0xAE, 0x93, 0xD9,
+    0x2F, 0x77, 0x5A, 0xD7, 0x2D, 0xA7, 0x19, 0xD7, 0x2D, 0xA7, 0x19, 0xAA, 0x70, 0x76, 0xC9, 0x6A,
+    0xC7, 0xD7, 0xC9, 0x6A, 0xC1, 0xAA, 0x3D, 0x0D, 0x4C, 0xAD, 0x49, 0xE5, 0xF5, 0xCA, 0xDA, 0x39,
+    0xC9, 0x9D, 0x92, 0xD1, 0xE2, 0xD1, 0x9E, 0x77, 0x70, 0x99, 0x69, 0xD9, 0x5D, 0xA6, 0xD6, 0xDA,
+    0x69, 0x95, 0x2C, 0x1A, 0xA1, 0x9C, 0x0A, 0xC2, 0xAA, 0xAC, 0x3C, 0xAC, 0x39, 0xD4, 0xE9, 0x3C,
+    0xAD, 0x29, 0xC0, 0xAC, 0xA1, 0xCA, 0x09, 0xD9, 0x00, 0x69, 0xC7, 0x0C, 0x70, 0xCA, 0x70, 0x97,
+    0x73, 0x99, 0x70, 0xD7, 0x9C, 0xA7, 0xAC, 0x97, 0xD7, 0x9D, 0x7A, 0xC9, 0x7D, 0x70, 0xD7, 0xAC,
+    0xA7, 0xD9, 0x7D, 0x79, 0xDA, 0xAA, 0xAD, 0x1F, 0xFC, 0x1F, 0xFA, 0x00, 0x77, 0x1C, 0x7C, 0xA6,
+    0xAC, 0x77, 0x72, 0x97, 0x0C, 0x96, 0xAC, 0x7C, 0xA6, 0x9C, 0x96, 0xAC, 0x7C, 0xA6, 0x9C, 0x96,
+    0xAC, 0x7D, 0x69, 0xCA, 0x6A, 0xC7, 0xF5, 0xF4, 0x77, 0xD7, 0x9C, 0xA7, 0xAC, 0x97, 0xD7, 0x9D,
+    0x7A, 0xCA, 0x7D, 0x70, 0xD7, 0xAC, 0xA7, 0xD9, 0x7D, 0x79, 0xDA, 0xAA, 0xAD, 0x1F, 0xFC, 0x1F,
+    0xFA, 0x77, 0x72, 0xDA, 0x69, 0xD7, 0xDA, 0x69, 0xD7, 0xAA, 0x95, 0x49, 0x49, 0xC9, 0x3A, 0xC4,
+    0xCA, 0x39, 0xC9, 0x3A, 0xC4, 0xCA, 0x39, 0xC9, 0x3A, 0xC4, 0xD3, 0x9C, 0xA3, 0xAC, 0x4F, 0x2F,
+    0x77, 0x19, 0xD9, 0x2E, 0x3D, 0x3D, 0xA3, 0xAA, 0x30, 0x77, 0x0D, 0x70, 0x9C, 0xA7, 0x0A, 0xC9,
+    0x70, 0xD3, 0xC3, 0x9D, 0x2A, 0xC3, 0xAC, 0x92, 0xC9, 0x3D, 0x3A, 0x4D, 0x70, 0xAC, 0xA7, 0x0D,
+    0x97, 0x0D, 0x70, 0x9D, 0xAA, 0xAA, 0xD2, 0xFF, 0xC2, 0xFF, 0xA1, 0x70, 0xC9, 0x4C, 0x90, 0x9C,
+    0x4A, 0xC1, 0xCA, 0x4C, 0xA1, 0xA9, 0x39, 0xC9, 0x7A, 0xC7, 0x0C, 0xA7, 0x9C, 0x97, 0xAC, 0x70,
+    0xD7, 0x9C, 0xA7, 0xAC, 0x70, 0xF6, 0xF5, 0x4D, 0x70, 0x9D, 0x70, 0xAC, 0x97, 0x0D, 0x29, 0xC9,
+    0x3D, 0x2D, 0x92, 0xAC, 0xA1, 0x9A, 0xA3, 0xD7, 0x1D, 0x70, 0x9C, 0xA7, 0x0D, 0x97, 0x0D, 0x70,
+    0x9D, 0xAA, 0xAA, 0xD2, 0xFF, 0xC2, 0xFF, 0xA1, 0x49, 0x96, 0x9C, 0x96, 0xAC, 0x7C, 0xA6, 0x9C,
+    0x90, 0x9C, 0x92, 0xAC, 0x1D, 0x92, 0xCA, 0x09, 0xAA, 0x29, 0xC9, 0x6A, 0xC7, 0xD6, 0x9C, 0xA6,
+    0xAC, 0x7F, 0x5F, 0x40, 0x77, 0x39, 0xA7, 0x73, 0xAC, 0x77, 0x3A, 0xC7, 0x7D, 0x1A, 0xC7, 0x79,
+    0xCA, 0x0A, 0xC9, 0x77, 0xAC, 0x9A, 0xC9, 0x77, 0x0D, 0xAC, 0x97, 0x70, 0x9E, 0x97, 0x71, 0xAD,
+    0x97, 0x72, 0xD9, 0x77, 0x29, 0xD7, 0x72, 0x9D, 0xA7, 0x71, 0x9E, 0x97, 0x70, 0x9F, 0x77, 0x09,
+    0xCA, 0x9D, 0xAA, 0xAA, 0xD7, 0x19, 0xCA, 0x0F, 0xFC, 0x70, 0x9D, 0x1F, 0xFA, 0x79, 0xD7, 0x72,
+    0x9D, 0x77, 0x29, 0xD7, 0x73, 0x97, 0x74, 0x72, 0x97, 0x59, 0xC9, 0x74, 0xAC, 0x75, 0xCA, 0x74,
+    0x9C, 0x97, 0x4A, 0xC7, 0x5C, 0xA7, 0x49, 0xC9, 0x29, 0x69, 0x9D, 0xAA, 0xA9, 0x91, 0x9A, 0xDA,
+    0xA9, 0xCA, 0x74, 0x9C, 0x97, 0x4A, 0xC7, 0x5F, 0x73, 0xF4, 0x73, 0x9A, 0x76, 0xC7, 0x6C, 0xA7,
+    0x69, 0x77, 0x77, 0x39, 0x95, 0xAC, 0xA5, 0xD5, 0xE4, 0xAC, 0xA4, 0x9E, 0x93, 0xD9, 0x4A, 0xE9,
+    0x3D, 0x5F, 0xA2, 0xAC, 0xA4, 0x9D, 0x9D, 0x2D, 0x94, 0xAC, 0xA0, 0xD1, 0x9D, 0x5D, 0x90, 0xD9,
+    0x0A, 0xCA, 0x49, 0xD1, 0xD9, 0x0D, 0x94, 0xAD, 0x1A, 0xCA, 0x9D, 0x5D, 0xA1, 0x9D, 0xAC, 0xA4,
+    0x9D, 0x92, 0xF9, 0x4A, 0xD3, 0xF5, 0xE3, 0xF4, 0x71, 0xC7, 0x1A, 0xA7, 0x09, 0xC7, 0x19, 0x77,
+    0x77, 0x19, 0x95, 0x9F, 0xD4, 0xAD, 0x19, 0xC9, 0x3D, 0x29, 0xC9, 0x29, 0xCA, 0x29, 0xC9, 0x2A,
+    0xC3, 0xD3, 0xD3, 0xD2, 0x9D, 0x29, 0xCA, 0x2A, 0xCA, 0x2A, 0xCA, 0x2D, 0x92, 0xD9, 0x10, 0x77,
+    0x59, 0xAA, 0x5D, 0x5E, 0x4A, 0xCA, 0x5E, 0x4D, 0x94, 0xAE, 0x93, 0xD5, 0xFA, 0x2A, 0xCA, 0x49,
+    0xD9, 0xD2, 0xD9, 0x4A, 0xCA, 0x0D, 0x2D, 0x5D, 0x90, 0xD1, 0xAC, 0xA4, 0x9D, 0x1D, 0x90, 0xD9,
+    0x4A, 0xD1, 0xAC, 0xA9, 0xD5, 0xDA, 0x19, 0xDA, 0xCA, 0x49, 0xD9, 0x2F, 0x94, 0xAD, 0x3F, 0x5E,
+    0x3F, 0x77, 0x72, 0xE7, 0x49, 0xD9, 0x74, 0xAC, 0xA7, 0x5D, 0x75, 0xAA, 0xA7, 0x20, 0x69, 0x94,
+    0x9F, 0xD3, 0xAD, 0x19, 0xC9, 0x2D, 0x29, 0xC9, 0x19, 0xCA, 0x29, 0xC9, 0x1A, 0xC3, 0xD2, 0xD3,
+    0xD1, 0x9D, 0x29, 0xCA, 0x1A, 0xCA, 0x2A, 0xCA, 0x1D, 0x92, 0xD9, 0x76, 0xE6, 0x9D, 0x96, 0xAD,
+    0x7D, 0x7A, 0xAA, 0x60, 0x79, 0x39, 0x72, 0x9C, 0x09, 0xC9, 0x73, 0xAD, 0x76, 0xA7, 0x77, 0x77,
+    0x49, 0xAA, 0x5D, 0x5E, 0x4A, 0xCA, 0x5E, 0x4D, 0x94, 0xAE, 0x93, 0xD5, 0xFA, 0x2A, 0xCA, 0x49,
+    0xD9, 0xD2, 0xD9, 0x4A, 0xCA, 0x0D, 0x2D, 0x5D, 0x90, 0xD1, 0xAC, 0xA4, 0x9D, 0x1D, 0x90, 0xD9,
+    0x4A, 0xD1, 0xAC, 0xA9, 0xD5, 0xDA, 0x19, 0xDA, 0xCA, 0x49, 0xD9, 0x2F, 0x94, 0xAD, 0x3F, 0x5E,
+    0x3F, 0x40, 0x49, 0xA2, 0x99, 0x5A, 0xA9, 0xC9, 0x7D, 0x71, 0x97, 0x77, 0x72, 0x99, 0x59, 0xFD,
+    0x4A, 0xD1, 0x9C, 0x93, 0xD2, 0x9C, 0x92, 0x9C, 0xA2, 0x9C, 0x92, 0xAC, 0x3D, 0x3D, 0x3D, 0x29,
+    0xD2, 0x9C, 0xA2, 0xAC, 0xA2, 0xAC, 0xA2, 0xD9, 0x2D, 0x91, 0x76, 0xCA, 0x70, 0xD7, 0x0D, 0x97,
+    0x77, 0x77, 0x77, 0x79, 0x6A, 0xFC, 0xA4, 0xDA, 0x1A, 0xC4, 0xCA, 0x29, 0xC3, 0xAC, 0x92, 0xAC,
+    0x3D, 0x3D, 0x29, 0xD2, 0x9C, 0xA2, 0xAC, 0xA2, 0xAC, 0xA2, 0xD9, 0x2D, 0x91, 0x9D, 0x3D, 0x10,
+    0x77, 0x59, 0xAA, 0x5D, 0x5E, 0x4A, 0xCA, 0x5E, 0x4D, 0x94, 0xAE, 0x93, 0xD5, 0xFA, 0x2A, 0xCA,
+    0x49, 0xD9, 0xD2, 0xD9, 0x4A, 0xCA, 0x0D, 0x2D, 0x5D, 0x90, 0xD1, 0xAC, 0xA4, 0x9D, 0x1D, 0x90,
+    0xD9, 0x4A, 0xD1, 0xAC, 0xA9, 0xD5, 0xDA, 0x19, 0xDA, 0xCA, 0x49, 0xD9, 0x2F, 0x94, 0xAD, 0x3F,
+    0x5E, 0x3F, 0x74, 0xE9, 0x73, 0xAE, 0x71, 0x9F, 0xA7, 0x2A, 0xA9, 0x71, 0x69, 0x94, 0x9F, 0xD3,
+    0xAD, 0x19, 0xC9, 0x2D, 0x29, 0xC9, 0x19, 0xCA, 0x29, 0xC9, 0x1A, 0xC3, 0xD2, 0xD3, 0xD1, 0x9D,
+    0x29, 0xCA, 0x1A, 0xCA, 0x2A, 0xCA, 0x1D, 0x92, 0xD9, 0x69, 0xD6, 0xAE, 0x5A, 0xE7, 0x50, 0x72,
+    0x99, 0x97, 0x0F, 0xE7, 0x77, 0x77, 0x0A, 0xEA, 0x97, 0xAD, 0xAA, 0xAD, 0xA5, 0xE3, 0x9D, 0x93,
+    0xAD, 0x5A, 0xCA, 0x29, 0xD6, 0xAD, 0x2A, 0xC9, 0x69, 0xCA, 0x2D, 0x79, 0xCA, 0x19, 0xCA, 0x7A,
+    0xC9, 0x1A, 0xC9, 0x7D, 0x2A, 0xC9, 0x6A, 0xCA, 0x2E, 0x5A, 0xD9, 0x2A, 0xEA, 0xAA, 0xAE, 0xA3,
+    0x9F, 0xFD, 0x5F, 0xFC, 0x7A, 0xFA, 0x97, 0x75, 0x39, 0xAA, 0xF4, 0xAA, 0x99, 0x99, 0x97, 0x77,
+    0x77, 0x0A, 0xE9, 0x5D, 0xAA, 0xAC, 0x93, 0xD3, 0xCA, 0x29, 0xC4, 0xAC, 0x2D, 0x4C, 0xA2, 0xCA,
+    0x4C, 0xA2, 0xCA, 0x3A, 0xC3, 0xDA, 0xAA, 0xDA, 0x3A, 0xFC, 0xA5, 0xAE, 0x94, 0x69, 0xA3, 0xA7,
+    0x09, 0xC2, 0xAA, 0x71, 0xFC, 0x73, 0x9A, 0x97, 0x77, 0x77, 0x2A, 0xEA, 0x97, 0xAD, 0xAA, 0xAD,
+    0xA5, 0xE3, 0x9D, 0x93, 0xAD, 0x5A, 0xCA, 0x29, 0xD6, 0xAD, 0x2A, 0xC9, 0x69, 0xCA, 0x2D, 0x79,
+    0xCA, 0x19, 0xCA, 0x7A, 0xC9, 0x1A, 0xC9, 0x7D, 0x2A, 0xC9, 0x6A, 0xCA, 0x2E, 0x5A, 0xD9, 0x2A,
+    0xEA, 0xAA, 0xAE, 0xA3, 0x9F, 0xFD, 0x5F, 0xFC, 0x7A, 0xFA, 0x97, 0x75, 0x77, 0x9C, 0x3C, 0x5D,
+    0xAD, 0x95, 0x9D, 0xA7, 0x77, 0x77, 0x76, 0xAE, 0x95, 0xDA, 0xAA, 0xC9, 0x3D, 0x3C, 0xA2, 0x9C,
+    0x4A, 0xC2, 0xD4, 0xCA, 0x2C, 0xA4, 0xCA, 0x2C, 0xA3, 0xAC, 0x3D, 0xAA, 0xAD, 0xA3, 0xAF, 0xCA,
+    0x5A, 0xE9, 0x40, 0x6A, 0xC4, 0xAC, 0x6A, 0xC9, 0x3D, 0x69, 0x99, 0x39, 0x97, 0x77, 0x77, 0x3A,
+    0xEA, 0x97, 0x0A, 0xDA, 0xAA, 0xDA, 0x6E, 0x39, 0xD9, 0x4A, 0xD5, 0xAC, 0xA3, 0x9D, 0x6A, 0xD3,
+    0xAC, 0x96, 0x9C, 0xA3, 0xD7, 0x9C, 0xA2, 0x9C, 0xA7, 0xAC, 0x92, 0xAC, 0x97, 0xD3, 0xAC, 0x96,
+    0xAC, 0xA3, 0xE5, 0xAD, 0x93, 0xAE, 0xAA, 0xAA, 0xEA, 0x49, 0xFF, 0xD6, 0xFF, 0xC7, 0x0A, 0xFA,
+    0x97, 0x77, 0x77, 0x1D, 0x4C, 0xA3, 0xD4, 0xD7, 0x29, 0x77, 0x77, 0x77, 0x1A, 0xE9, 0x7D, 0xAA,
+    0xAC, 0x95, 0xD3, 0xCA, 0x49, 0xC4, 0xAC, 0x4D, 0x4C, 0xA4, 0xCA, 0x4C, 0xA4, 0xCA, 0x3A, 0xC5,
+    0xDA, 0xAA, 0xDA, 0x5A, 0xFC, 0xA7, 0xAE, 0x96, 0x6A, 0xF9, 0xAA, 0xFD, 0x94, 0xAD, 0xAA, 0xAF,
+    0xFD, 0x4E, 0x39, 0xDA, 0x71, 0xAD, 0x5D, 0xA7, 0x09, 0xD6, 0xE7, 0x0D, 0x96, 0xDA, 0x70, 0xD6,
+    0xAF, 0xD4, 0x9C, 0xA6, 0xFD, 0xA4, 0xAC, 0x96, 0xE7, 0x0A, 0xC9, 0x59, 0xDA, 0x70, 0xE5, 0xAD,
+    0x97, 0x0A, 0xFF, 0xE7, 0x19, 0xFF, 0xFF, 0x5F, 0xFF, 0xF6, 0x9F, 0xAF, 0xFC, 0x30, 0x77, 0x5A,
+    0xDA, 0x91, 0x9E, 0x94, 0xDA, 0xAA, 0xC9, 0xD9, 0x1C, 0x92, 0xD3, 0xE3, 0x9A, 0x19, 0xC4, 0xAC,
+    0xAA, 0xAE, 0xA1, 0xD4, 0xFC, 0xAA, 0xA9, 0x1C, 0xA4, 0xCA, 0x70, 0xCA, 0x3A, 0xCA, 0x70, 0xDA,
+    0xAA, 0xFA, 0x91, 0x99, 0x2A, 0xFC, 0xAA, 0xFD, 0x93, 0xAD, 0xA9, 0x19, 0xFA, 0x20, 0x72, 0x97,
+    0x29, 0xC7, 0x2C, 0x72, 0xCA, 0x77, 0x77, 0x0F, 0xCA, 0x6C, 0xAA, 0xAA, 0xD4, 0x9C, 0x3A, 0xC4,
+    0xCA, 0x3A, 0xC4, 0xC9, 0x29, 0xD3, 0x9C, 0xA9, 0x9A, 0xD9, 0x3F, 0xDA, 0x5F, 0xE4, 0x9D, 0x2A,
+    0xC9, 0x3D, 0xA2, 0x9C, 0xA3, 0xD9, 0x2A, 0xCA, 0x29, 0xD3, 0xDA, 0x2E, 0x29, 0xDA, 0x2E, 0x2A,
+    0xDA, 0x10, 0x6C, 0x95, 0xAA, 0x59, 0xC6, 0x97, 0x7C, 0x9A, 0xCA, 0x29, 0xFA, 0x2D, 0xA5, 0xD5,
+    0x9C, 0xA5, 0xD9, 0x5D, 0x5A, 0xD5, 0xE4, 0x4F, 0xCA, 0x6C, 0xAA, 0xAA, 0xD4, 0x9C, 0x3A, 0xC4,
+    0xCA, 0x3A, 0xC4, 0xC9, 0x29, 0xD3, 0x9C, 0xA9, 0x9A, 0xD9, 0x3F, 0xDA, 0x5F, 0xE4, 0x9D, 0x2A,
+    0xC9, 0x3D, 0xA2, 0x9C, 0xA3, 0xD9, 0x2A, 0xCA, 0x29, 0xD3, 0xDA, 0x2E, 0x29, 0xDA, 0x2E, 0x2A,
+    0xDA, 0x77, 0x77, 0x75, 0xAD, 0x71, 0xDA, 0x70, 0x9D, 0x71, 0xDA, 0x70, 0x9A, 0xA6, 0x76, 0xC9,
+    0xAC, 0xA3, 0x9F, 0xA3, 0xDA, 0x6D, 0x69, 0xCA, 0x6D, 0x96, 0xD6, 0xAD, 0x6E, 0x77, 0x77, 0x76,
+    0x9A, 0xA6, 0xE5, 0x9D, 0x95, 0xE5, 0x9D, 0x60, 0x77, 0x29, 0xA1, 0xAA, 0x7A, 0xD9, 0x71, 0xC9,
+    0x77, 0x77, 0x1F, 0xCA, 0x6C, 0xAA, 0xAA, 0xD4, 0x9C, 0x3A, 0xC4, 0xCA, 0x3A, 0xC4, 0xC9, 0x29,
+    0xD3, 0x9C, 0xA9, 0x9A, 0xD9, 0x3F, 0xDA, 0x5F, 0xE4, 0x9D, 0x2A, 0xC9, 0x3D, 0xA2, 0x9C, 0xA3,
+    0xD9, 0x2A, 0xCA, 0x29, 0xD3, 0xDA, 0x2E, 0x29, 0xDA, 0x2E, 0x2A, 0xDA, 0x10, 0x19, 0x92, 0x99,
+    0x2A, 0xA0, 0xC9, 0x4D, 0x95, 0x99, 0x77, 0xC9, 0xAC, 0xA2, 0x9F, 0xA2, 0xDA, 0x5D, 0x59, 0xCA,
+    0x5D, 0x95, 0xD5, 0xAD, 0x5E, 0x40, 0x73, 0xAA, 0x73, 0x9C, 0x74, 0xC9, 0x74, 0x97, 0x77, 0x77,
+    0x0A, 0xFC, 0x6A, 0xFE, 0x59, 0xDA, 0x97, 0x1D, 0x97, 0x3C, 0xA7, 0x39, 0xD9, 0x73, 0xFC, 0x97,
+    0x1F, 0xDA, 0x71, 0x9A, 0xEA, 0x72, 0xAE, 0x72, 0xAE, 0x3A, 0x99, 0x19, 0xAF, 0x2A, 0xFF, 0xD9,
+    0x1A, 0xFF, 0xD3, 0x9A, 0xFD, 0xA9, 0x77, 0x20, 0x7C, 0x97, 0xAC, 0x79, 0xC7, 0x77, 0x77, 0x0A,
+    0xEA, 0x4C, 0xA9, 0x99, 0x4A, 0xA7, 0x0A, 0xC7, 0x09, 0xE9, 0x69, 0xAD, 0xA7, 0x0D, 0x39, 0xA9,
+    0x9A, 0xD2, 0xAF, 0xDA, 0x29, 0xFC, 0xA2, 0x77, 0x71, 0xAC, 0x74, 0x9C, 0xAC, 0x97, 0x2C, 0x2A,
+    0xA7, 0x77, 0x0A, 0xFC, 0x7A, 0xFE, 0x69, 0xDA, 0x97, 0x2D, 0x97, 0x4C, 0xA7, 0x49, 0xD9, 0x74,
+    0xFC, 0x97, 0x2F, 0xDA, 0x72, 0x9A, 0xEA, 0x73, 0xAE, 0x73, 0xAE, 0x4A, 0x99, 0x19, 0xAF, 0x3A,
+    0xFF, 0xD9, 0x2A, 0xFF, 0xD4, 0x9A, 0xFD, 0xA9, 0x77, 0x40, 0x5A, 0xA7, 0x0D, 0xA6, 0xC9, 0x09,
+    0xA5, 0x93, 0x97, 0x7A, 0xEA, 0x4C, 0xA9, 0x99, 0x4A, 0xA7, 0x0A, 0xC7, 0x09, 0xE9, 0x69, 0xAD,
+    0xA7, 0x0D, 0x39, 0xA9, 0x9A, 0xD2, 0xAF, 0xDA, 0x29, 0xFC, 0xA2, 0x7A, 0xFC, 0x6A, 0xFE, 0x59,
+    0xDA, 0x97, 0x1D, 0x97, 0x3C, 0xA7, 0x39, 0xD9, 0x73, 0xFC, 0x97, 0x1F, 0xDA, 0x71, 0x9A, 0xEA,
+    0x72, 0xAE, 0x72, 0xAE, 0x3A, 0x99, 0x19, 0xAF, 0x2A, 0xFF, 0xD9, 0x1A, 0xFF, 0xD3, 0x9A, 0xFD,
+    0xA9, 0x71, 0x97, 0x5A, 0xA7, 0x5A, 0x73, 0xD9, 0x60, 0x4A, 0xEA, 0x4C, 0xA9, 0x99, 0x4A, 0xA7,
+    0x0A, 0xC7, 0x09, 0xE9, 0x69, 0xAD, 0xA7, 0x0D, 0x39, 0xA9, 0x9A, 0xD2, 0xAF, 0xDA, 0x29, 0xFC,
+    0xA6, 0xA7, 0x09, 0xA9, 0x71, 0xA7, 0xD9, 0x40, 0x77, 0x6C, 0x91, 0xA9, 0x71, 0xCA, 0xC7, 0x3A,
+    0xC7, 0x77, 0x77, 0x77, 0x0A, 0xFC, 0x6A, 0xFE, 0x59, 0xDA, 0x97, 0x1D, 0x97, 0x3C, 0xA7, 0x39,
+    0xD9, 0x73, 0xFC, 0x97, 0x1F, 0xDA, 0x71, 0x9A, 0xEA, 0x72, 0xAE, 0x72, 0xAE, 0x3A, 0x99, 0x19,
+    0xAF, 0x2A, 0xFF, 0xD9, 0x1A, 0xFF, 0xD3, 0x9A, 0xFD, 0xA9, 0x77, 0x20, 0x3A, 0x29, 0x94, 0xAC,
+    0x9C, 0x96, 0xD7, 0x77, 0x77, 0x1A, 0xEA, 0x4C, 0xA9, 0x99, 0x4A, 0xA7, 0x0A, 0xC7, 0x09, 0xE9,
+    0x69, 0xAD, 0xA7, 0x0D, 0x39, 0xA9, 0x9A, 0xD2, 0xAF, 0xDA, 0x29, 0xFC, 0xA2, 0x0A, 0xFF, 0xE1,
+    0xFF, 0xEA, 0x59, 0xCA, 0x72, 0xAC, 0x97, 0x2D, 0x73, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7,
+    0x29, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2E, 0x73, 0x9A, 0x75, 0xA7, 0x2D, 0x97, 0x73,
+    0xAC, 0x5C, 0xA4, 0xAC, 0x92, 0xAF, 0xCA, 0x2C, 0xA4, 0x9C, 0x94, 0xD5, 0xD4, 0x9C, 0x94, 0xAC,
+    0xA4, 0xFA, 0x2F, 0xA3, 0xA9, 0x7C, 0x39, 0xD9, 0x20, 0x77, 0x2C, 0x19, 0xA7, 0x09, 0xDA, 0x72,
+    0xAA, 0x77, 0x77, 0x2A, 0xFF, 0xE1, 0xFF, 0xEA, 0x59, 0xCA, 0x72, 0xAC, 0x97, 0x2D, 0x73, 0xD7,
+    0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2E, 0x70,
+    0x7A, 0xC7, 0xC9, 0x3A, 0xC0, 0x9C, 0x4C, 0xA0, 0x99, 0x3A, 0xC9, 0x4A, 0xFC, 0xA4, 0xCA, 0x69,
+    0xC9, 0x6D, 0x7D, 0x69, 0xC9, 0x6A, 0xCA, 0x6F, 0xA4, 0xFA, 0x30, 0x0A, 0xFF, 0xE1, 0xFF, 0xEA,
+    0x59, 0xCA, 0x72, 0xAC, 0x97, 0x2D, 0x72, 0x9D, 0x70, 0xAA, 0xEA, 0xA5, 0xAF, 0xE7, 0x0D, 0x72,
+    0xAD, 0x72, 0xDA, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xE7, 0x00, 0x75, 0xAC, 0x6C, 0xA5, 0xAC, 0x93,
+    0xAF, 0xCA, 0x3C, 0xA3, 0xAA, 0xEA, 0xA0, 0xAF, 0xE3, 0xCA, 0x59, 0xC9, 0x5D, 0xA5, 0xFA, 0x3F,
+    0xA1, 0x7A, 0xA1, 0xA7, 0x0A, 0x99, 0x90, 0xC7, 0x0C, 0x1D, 0x97, 0x77, 0x73, 0x99, 0x59, 0x93,
+    0xAD, 0x5D, 0xA2, 0xDA, 0x49, 0xD3, 0xD9, 0x4A, 0xD2, 0x9D, 0x5D, 0xA2, 0xAD, 0x5D, 0x92, 0xDA,
+    0x49, 0xD3, 0xD5, 0xAC, 0xA2, 0x9D, 0x5D, 0x92, 0xAC, 0xA5, 0xD3, 0xAC, 0xA4, 0xAC, 0xA3, 0xE9,
+    0x2A, 0xD9, 0x3F, 0xFD, 0x4F, 0xFC, 0x95, 0xAF, 0xCA, 0x97, 0x73, 0x39, 0xCA, 0x1C, 0x4C, 0x0A,
+    0x99, 0xA4, 0xA1, 0xD7, 0x77, 0x1C, 0xA3, 0xAC, 0x2C, 0xA3, 0xD2, 0xC9, 0x3C, 0xA1, 0x9C, 0x39,
+    0xC9, 0x1A, 0xC3, 0xAC, 0x2D, 0x3D, 0x2D, 0x2A, 0xCA, 0x2F, 0xEA, 0x2F, 0xE9, 0x29, 0xE9, 0xAC,
+    0x20, 0x77, 0x5F, 0xDA, 0x69, 0x99, 0x97, 0x77, 0x75, 0xAD, 0x5D, 0xA2, 0xE4, 0x9D, 0x92, 0xD9,
+    0x4A, 0xD2, 0x9D, 0x5D, 0xA2, 0xAD, 0x5D, 0x92, 0xDA, 0x49, 0xD3, 0xD5, 0xAC, 0xA2, 0x9D, 0x5D,
+    0x92, 0x9C, 0xA5, 0xD3, 0xAC, 0xA4, 0xAC, 0xA3, 0xE9, 0x2A, 0xD9, 0x3F, 0xFD, 0x4F, 0xFC, 0x95,
+    0xAF, 0xCA, 0x97, 0x73, 0x79, 0x93, 0xAF, 0xD9, 0x77, 0x7C, 0xA3, 0xAC, 0x2C, 0xA3, 0xD2, 0xC9,
+    0x3C, 0xA1, 0x9C, 0x39, 0xC9, 0x1A, 0xC3, 0xAC, 0x2D, 0x3D, 0x2D, 0x2A, 0xCA, 0x2F, 0xEA, 0x2F,
+    0xE9, 0x29, 0xE9, 0xAC, 0x20, 0x6A, 0x39, 0x97, 0xC9, 0x19, 0xC7, 0x0A, 0xF9, 0x71, 0x9A, 0x97,
+    0x77, 0x75, 0x99, 0x59, 0x93, 0xAD, 0x5D, 0xA2, 0xDA, 0x49, 0xD3, 0xD9, 0x4A, 0xD2, 0x9D, 0x5D,
+    0xA2, 0xAD, 0x5D, 0x92, 0xDA, 0x49, 0xD3, 0xD5, 0xAC, 0xA2, 0x9D, 0x5D, 0x92, 0xAC, 0xA5, 0xD3,
+    0xAC, 0xA4, 0xAC, 0xA3, 0xE9, 0x2A, 0xD9, 0x3F, 0xFD, 0x4F, 0xFC, 0x95, 0xAF, 0xCA, 0x97, 0x73,
+    0x3A, 0x39, 0x4C, 0x91, 0x9C, 0x4F, 0xC6, 0x9A, 0x97, 0x77, 0x2C, 0xA3, 0xAC, 0x2C, 0xA3, 0xD2,
+    0xC9, 0x3C, 0xA1, 0x9C, 0x39, 0xC9, 0x1A, 0xC3, 0xAC, 0x2D, 0x3D, 0x2D, 0x2A, 0xCA, 0x2F, 0xEA,
+    0x2F, 0xE9, 0x29, 0xE9, 0xAC, 0x20, 0x70, 0x9A, 0xA7, 0x3A, 0x09, 0x73, 0xA0, 0xA7, 0x3D, 0x97,
+    0x77, 0x77, 0x72, 0xAD, 0x5D, 0xA2, 0xE4, 0x9D, 0x92, 0xD9, 0x4A, 0xD2, 0x9D, 0x5D, 0xA2, 0xAD,
+    0x5D, 0x92, 0xDA, 0x49, 0xD3, 0xD5, 0xAC, 0xA2, 0x9D, 0x5D, 0x92, 0x9C, 0xA5, 0xD3, 0xAC, 0xA4,
+    0xAC, 0xA3, 0xE9, 0x2A, 0xD9, 0x3F, 0xFD, 0x4F, 0xFC, 0x95, 0xAF, 0xCA, 0x97, 0x73, 0x59, 0xAA,
+    0x69, 0x90, 0xC7, 0xD9, 0x77, 0x77, 0x4C, 0xA3, 0xAC, 0x2C, 0xA3, 0xD2, 0xC9, 0x3C, 0xA1, 0x9C,
+    0x39, 0xC9, 0x1A, 0xC3, 0xAC, 0x2D, 0x3D, 0x2D, 0x2A, 0xCA, 0x2F, 0xEA, 0x2F, 0xE9, 0x29, 0xE9,
+    0xAC, 0x20, 0x6A, 0x94, 0xA9, 0x5D, 0x4D, 0x5A, 0xA4, 0xAA, 0x77, 0x77, 0x77, 0x4A, 0xD5, 0xDA,
+    0x3D, 0xA4, 0x9D, 0x4D, 0x94, 0xAD, 0x39, 0xD5, 0xDA, 0x3A, 0xD5, 0xD9, 0x3D, 0xA4, 0x9D, 0x4D,
+    0x5A, 0xCA, 0x39, 0xD5, 0xD9, 0x3A, 0xCA, 0x5D, 0x4A, 0xCA, 0x4A, 0xCA, 0x4E, 0x92, 0xAD, 0x94,
+    0xFF, 0xD5, 0xFF, 0xC9, 0x6A, 0xFC, 0xA9, 0x77, 0x50, 0x29, 0xC9, 0x3A, 0xC2, 0x9C, 0xA3, 0xAC,
+    0x92, 0x99, 0x39, 0x99, 0x77, 0x75, 0xCA, 0x3A, 0xC4, 0xCA, 0x3D, 0x4C, 0x93, 0xCA, 0x39, 0xC3,
+    0x9C, 0x93, 0xAC, 0x3A, 0xC4, 0xD3, 0xD4, 0xD2, 0xAC, 0xA4, 0xFE, 0xA4, 0xFE, 0x94, 0x9E, 0x9A,
+    0xC4, 0x77, 0x1A, 0xD5, 0xDA, 0x2D, 0xA4, 0x9D, 0x3D, 0x94, 0xAD, 0x29, 0xD5, 0xDA, 0x2A, 0xD5,
+    0xD9, 0x2D, 0xA4, 0x9D, 0x3D, 0x5A, 0xCA, 0x29, 0xD5, 0xD9, 0x2A, 0xCA, 0x5D, 0x3A, 0xCA, 0x4A,
+    0xCA, 0x3E, 0x92, 0xAD, 0x93, 0xFF, 0xD4, 0xFF, 0xC9, 0x5A, 0xFD, 0x97, 0x2C, 0x97, 0x3A, 0x97,
+    0x49, 0xD7, 0x75, 0x1C, 0xA3, 0xAC, 0x2C, 0xA3, 0xD2, 0xC9, 0x3C, 0xA1, 0x9C, 0x39, 0xC9, 0x1A,
+    0xC3, 0xD2, 0xD3, 0xD2, 0xD2, 0xAC, 0xA2, 0xFE, 0xA2, 0xFE, 0x92, 0x9E, 0x9D, 0x7C, 0xA7, 0xAA,
+    0x70, 0xC7, 0x19, 0xCA, 0x76, 0x70, 0xCA, 0x77, 0x9D, 0xA7, 0x6C, 0x19, 0xA7, 0x77, 0x19, 0xCA,
+    0x73, 0xAC, 0xA0, 0xAC, 0xA7, 0x3D, 0x1A, 0xCA, 0x72, 0xAC, 0xA1, 0xAC, 0xA7, 0x2D, 0x2A, 0xCA,
+    0x3D, 0x3A, 0xCA, 0x2D, 0xA2, 0xE9, 0x2D, 0x3D, 0xA1, 0xF9, 0x1D, 0xA3, 0xD9, 0x0A, 0xFA, 0x09,
+    0xD4, 0xD9, 0x9D, 0x9A, 0xD0, 0xDA, 0x4D, 0xAD, 0xA0, 0x9D, 0xAD, 0x5F, 0xC1, 0x9F, 0x95, 0xF9,
+    0x19, 0xF6, 0xEA, 0x3E, 0x96, 0xE4, 0xE6, 0x4A, 0xC7, 0x2E, 0x70, 0xC9, 0x1A, 0x97, 0x79, 0x97,
+    0x99, 0x0D, 0x7D, 0x0D, 0x6A, 0xC9, 0x0D, 0x2C, 0x2D, 0x1D, 0x1D, 0xA0, 0xAC, 0x91, 0xD0, 0xF0,
+    0xD2, 0xFF, 0xC9, 0x2F, 0xAF, 0x3E, 0x90, 0xE9, 0x3D, 0xA1, 0xAD, 0x40, 0x4A, 0xA7, 0x1D, 0xA7,
+    0xC9, 0x09, 0xA7, 0x77, 0x29, 0xCA, 0x5A, 0xCA, 0x0D, 0x49, 0xD1, 0xD9, 0x3D, 0x2A, 0xCA, 0x2D,
+    0x92, 0xAD, 0x1D, 0x93, 0x9D, 0x0A, 0xCA, 0x5F, 0xC6, 0xF7, 0xAD, 0x97, 0xAD, 0x70, 0xDA, 0x7A,
+    0xD9, 0x7E, 0x7A, 0xE7, 0x77, 0x3D, 0x71, 0xAC, 0xAC, 0x79, 0xA2, 0xA9, 0x77, 0x75, 0xAC, 0x4D,
+    0x39, 0xC9, 0x29, 0xC9, 0x4C, 0xA2, 0xD5, 0xD1, 0x9C, 0x95, 0xD1, 0xD6, 0xAC, 0xAA, 0xC9, 0x69,
+    0xF7, 0x0E, 0xA7, 0x0E, 0x71, 0xDA, 0x70, 0x9D, 0x70, 0xAD, 0x95, 0x9F, 0x96, 0xAD, 0xA7, 0x75,
+    0x39, 0xA2, 0xAA, 0x4D, 0x19, 0xD3, 0x9D, 0x1D, 0xA7, 0x77, 0x74, 0x9C, 0xA5, 0xAC, 0xA0, 0xD4,
+    0x9D, 0x1D, 0x93, 0xD2, 0xAC, 0xA2, 0xD9, 0x2A, 0xD1, 0xD9, 0x39, 0xD0, 0xAC, 0xA5, 0xFC, 0x6F,
+    0x7A, 0xD9, 0x7A, 0xD7, 0x0D, 0xA7, 0xAD, 0x97, 0xE7, 0xAE, 0x70, 0x73, 0xAA, 0x75, 0x9C, 0x76,
+    0xC9, 0x76, 0x97, 0x77, 0x77, 0x4F, 0xFD, 0xA5, 0xFF, 0xD6, 0x99, 0x99, 0x99, 0xAE, 0x73, 0x9E,
+    0x73, 0xAD, 0xA7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x97, 0x2F, 0x73, 0xF7, 0x29, 0xEA, 0x72,
+    0xAF, 0xCA, 0xAA, 0xAA, 0xA4, 0xFF, 0xF4, 0xFF, 0xF3, 0x70, 0x9C, 0x71, 0xC7, 0x1C, 0xA7, 0x19,
+    0x77, 0x76, 0x9F, 0xD9, 0x39, 0xAA, 0xAA, 0xD9, 0x7D, 0x97, 0xD7, 0x9D, 0x7A, 0xD7, 0xAD, 0x7E,
+    0x7A, 0xFE, 0x3F, 0xF2, 0x71, 0x9C, 0xA7, 0x5A, 0xCA, 0x75, 0xAA, 0x97, 0x77, 0x77, 0x3F, 0xFD,
+    0xA5, 0xFF, 0xD6, 0x99, 0x99, 0x99, 0xAE, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0xA7, 0x29, 0xE9,
+    0x72, 0xAE, 0x97, 0x2F, 0x73, 0xF7, 0x29, 0xEA, 0x72, 0xAF, 0xCA, 0xAA, 0xAA, 0xA4, 0xFF, 0xF4,
+    0xFF, 0xF3, 0x7D, 0x70, 0xAD, 0x70, 0xAA, 0xA7, 0x77, 0x59, 0xFD, 0x93, 0x9A, 0xAA, 0xAD, 0x97,
+    0xD9, 0x7D, 0x79, 0xD7, 0xAD, 0x7A, 0xD7, 0xE7, 0xAF, 0xE3, 0xFF, 0x20, 0x79, 0x39, 0x72, 0xAA,
+    0x09, 0xA7, 0x4D, 0xA7, 0x59, 0xA7, 0x77, 0x77, 0x5F, 0xFD, 0xA5, 0xFF, 0xD6, 0x99, 0x99, 0x99,
+    0xAE, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x97, 0x2F, 0x73, 0xF7,
+    0x29, 0xEA, 0x72, 0xAF, 0xCA, 0xAA, 0xAA, 0xA4, 0xFF, 0xF4, 0xFF, 0xF3, 0x4A, 0x3A, 0x6C, 0x9A,
+    0xA7, 0x9C, 0xA7, 0x19, 0x77, 0x77, 0x9F, 0xD9, 0x39, 0xAA, 0xAA, 0xD9, 0x7D, 0x97, 0xD7, 0x9D,
+    0x7A, 0xD7, 0xAD, 0x7E, 0x7A, 0xFE, 0x3F, 0xF2, 0x75, 0xAE, 0x39, 0xC9, 0x5C, 0xA5, 0xAC, 0x6D,
+    0x6C, 0xA5, 0x9C, 0x95, 0xAC, 0x6D, 0x59, 0xCA, 0x5A, 0xC9, 0x5D, 0x59, 0xD5, 0x77, 0x19, 0x96,
+    0xAE, 0xA9, 0x4A, 0xA4, 0xAD, 0xAA, 0xAD, 0xA2, 0x9C, 0x4E, 0x39, 0xD9, 0x09, 0xC9, 0x3A, 0xD5,
+    0xAC, 0xA6, 0x9D, 0x6A, 0xD6, 0xAC, 0x96, 0x9C, 0xA6, 0xD7, 0x9C, 0xA5, 0x9C, 0xA7, 0xAC, 0x95,
+    0xAC, 0x97, 0xD6, 0xAC, 0x96, 0xAC, 0xA6, 0xE5, 0xAD, 0x96, 0xAE, 0xAA, 0xAA, 0xEA, 0x79, 0xFF,
+    0xD7, 0x1F, 0xFC, 0x73, 0xAF, 0xA9, 0x77, 0x75, 0x72, 0x93, 0xAE, 0x91, 0xC2, 0xDA, 0xAA, 0xC9,
+    0xC9, 0x1D, 0x3D, 0x91, 0x9C, 0x4A, 0xC2, 0xD4, 0xCA, 0x2C, 0xA4, 0xCA, 0x2C, 0xA3, 0xAC, 0x3D,
+    0xAA, 0xAD, 0xA3, 0xAF, 0xCA, 0x5A, 0xE9, 0x40, 0x3A, 0xFC, 0xA9, 0x4F, 0xAA, 0xAD, 0xA2, 0xAE,
+    0x93, 0xD2, 0xC9, 0xD4, 0xD2, 0xC0, 0xD4, 0xCA, 0x2A, 0x9C, 0xA2, 0x9D, 0x4A, 0xFE, 0x94, 0xFD,
+    0xA9, 0x49, 0xD7, 0x2A, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2E, 0x72, 0xE7, 0x10, 0x69,
+    0x97, 0x2E, 0x72, 0xC9, 0x72, 0xAC, 0x0A, 0xD9, 0x6F, 0xAA, 0xC9, 0x5E, 0x2A, 0xA4, 0x9D, 0x3A,
+    0xC4, 0xAC, 0xA3, 0xAA, 0x4D, 0x93, 0xC9, 0x4D, 0xA2, 0x9C, 0x49, 0xEA, 0x9A, 0xCA, 0x4A, 0xFE,
+    0x5C, 0xA9, 0xEA, 0x5A, 0xC9, 0x72, 0xD7, 0x2A, 0xC9, 0x72, 0xD7, 0x77, 0x00, 0x2A, 0xFD, 0xA2,
+    0xAA, 0x71, 0xC7, 0x19, 0xC7, 0x1A, 0x97, 0x1C, 0x70, 0x9A, 0x7A, 0xA7, 0xCA, 0x69, 0xC9, 0x69,
+    0xFE, 0x2A, 0xFD, 0xA7, 0x50, 0x0A, 0xFF, 0xE1, 0xFF, 0xEA, 0x1D, 0x99, 0x9C, 0xA6, 0x92, 0xAC,
+    0x97, 0x2D, 0x73, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x2D, 0xA7, 0x2D, 0x97,
+    0x19, 0xD7, 0x2E, 0x70, 0x76, 0xAC, 0x94, 0xAD, 0x49, 0xCA, 0x5C, 0xA5, 0xAC, 0x93, 0xAF, 0xCA,
+    0x3C, 0xA5, 0x9C, 0x95, 0xD6, 0xD5, 0x9C, 0x95, 0xAC, 0xA5, 0xFA, 0x3F, 0xA2, 0x0A, 0xFF, 0xE1,
+    0xFF, 0xEA, 0x59, 0xCA, 0x72, 0xAC, 0x97, 0x2D, 0x73, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7,
+    0x29, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xEA, 0x71, 0xAE, 0xA7, 0x1A,
+    0xD9, 0x77, 0x40, 0x77, 0x4A, 0xD5, 0xDA, 0x9C, 0x3E, 0x49, 0xFA, 0x3D, 0x94, 0xAD, 0x99, 0x39,
+    0xD5, 0xDA, 0x5A, 0xD5, 0xD9, 0x5D, 0xA4, 0x9D, 0x6D, 0x5A, 0xCA, 0x59, 0xD5, 0xD9, 0x59, 0xCA,
+    0x5D, 0x6A, 0xCA, 0x4A, 0xCA, 0x6E, 0x92, 0xAD, 0x96, 0xFF, 0xD7, 0xFF, 0xC9, 0x70, 0xAF, 0xCA,
+    0x97, 0x77, 0x10, 0x77, 0x6A, 0x1C, 0xA3, 0xAC, 0x9A, 0x1C, 0xA3, 0xE2, 0xC9, 0x3D, 0x29, 0xC3,
+    0x9C, 0x92, 0xAC, 0x3A, 0xC3, 0xD3, 0xD3, 0xD2, 0xAC, 0xA3, 0xFE, 0xA3, 0xFE, 0x93, 0x9E, 0x9A,
+    0xC3, 0x9A, 0x3D, 0x3D, 0x00, 0x19, 0xC2, 0xC9, 0x1C, 0xA2, 0x92, 0x2C, 0x5E, 0x92, 0xAA, 0x1A,
+    0xA7, 0x00, 0x09, 0xC9, 0x1A, 0x0C, 0x0C, 0x0A, 0x99, 0xA0, 0x9D, 0x70, 0x70, 0xFD, 0xA0, 0x99,
+    0x93, 0x73, 0xFF, 0xC9, 0x72, 0x09, 0x6C, 0x3C, 0x90, 0xDA, 0xAC, 0xA2, 0xE9, 0x10, 0x09, 0xA9,
+    0x0D, 0x99, 0xD0, 0x1A, 0x91, 0xAA, 0x1D, 0x91, 0xD1, 0xD9, 0x0A, 0xD0, 0x9A, 0x90, 0x90, 0xA9,
+    0x0A, 0xA1, 0x91, 0x1A, 0xA1, 0xA1, 0x90, 0xA0, 0xA9, 0x0A, 0xCA, 0x00, 0x2A, 0x94, 0xA2, 0xD4,
+    0xD1, 0xD4, 0xCA, 0x10, 0x70, 0xC9, 0x1A, 0x92, 0xE4, 0xAC, 0x30, 0x9A, 0x49, 0x93, 0xD4, 0xCA,
+    0x29, 0xCA, 0x39, 0xCA, 0x00, 0x09, 0x93, 0xAD, 0x3D, 0x92, 0x9D, 0x3D, 0xA0, 0x2D, 0xA1, 0xAD,
+    0x2D, 0xA1, 0x9D, 0x2A, 0xA9, 0x10, 0x9D, 0x92, 0xAD, 0x3D, 0x3A, 0xD3, 0xAA, 0x00, 0x5A, 0x99,
+    0xD2, 0xC4, 0x39, 0xA2, 0xD9, 0x0A, 0x50, 0x0E, 0xAA, 0xA1, 0x99, 0x99, 0xD5, 0xCA, 0x5C, 0x90,
+    0x19, 0x1C, 0x0A, 0x9A, 0x90, 0x0A, 0x09, 0x91, 0xA0, 0x4A, 0x1A, 0xC9, 0x19, 0xA9, 0x3C, 0xA9,
+    0x1A, 0xA9, 0x0A, 0x90, 0x5A, 0x09, 0xAA, 0x90, 0x91, 0x49, 0x99, 0x9F, 0xDA, 0x70, 0x0A, 0xA1,
+    0xD0, 0xAD, 0x00, 0x1A, 0xA1, 0x9A, 0x90, 0x9D, 0x1D, 0x90, 0xDA, 0x09, 0xD9, 0x1A, 0xA1, 0xA1,
+    0x90, 0xA0, 0xA9, 0x0A, 0xCA, 0x00, 0x29, 0x92, 0xE1, 0x9D, 0x91, 0xAD, 0x2D, 0x91, 0x9A, 0xA2,
+    0x59, 0x39, 0x99, 0x29, 0xA0, 0xAC, 0xA1, 0x19, 0x91, 0xAA, 0x2C, 0x3A, 0xC9, 0x50, 0x1C, 0xA1,
+    0xC9, 0x0A, 0xC1, 0xD1, 0x91, 0x0F, 0xA9, 0xC1, 0xA9, 0x99, 0x1A, 0x00, 0x9A, 0x2A, 0x1A, 0xAA,
+    0xA3, 0xCA, 0x71, 0x71, 0xD4, 0x9C, 0xAC, 0x3C, 0x2A, 0x90, 0x09, 0xC9, 0x1A, 0x0C, 0x0C, 0x0A,
+    0x99, 0xA0, 0x9D, 0x70, 0x69, 0xFC, 0x70, 0x7F, 0xD6, 0x09, 0xC9, 0x1A, 0x0C, 0x0C, 0x0A, 0x99,
+    0xA0, 0x9D, 0x70, 0x0A, 0xAA, 0xAA, 0xAA, 0x09, 0xFE, 0x00, 0x0A, 0x29, 0x0A, 0x90, 0x99, 0x1A,
+    0x09, 0xA1, 0xC9, 0x0F, 0xA5, 0x0A, 0xAA, 0xA9, 0x0A, 0x19, 0x99, 0x91, 0xA0, 0xAF, 0x00, 0x09,
+    0xAA, 0x99, 0x0A, 0x0A, 0x0A, 0x99, 0x09, 0x99, 0x50, 0x6A, 0xA2, 0xC9, 0x1A, 0x0C, 0x00, 0x09,
+    0xC9, 0x1A, 0x0C, 0x0C, 0x0A, 0x99, 0xA0, 0x9D, 0x70, 0x0A, 0x92, 0xA1, 0xA1, 0x76, 0xA9, 0x59,
+    0xC5, 0x9C, 0x97, 0x4A, 0x91, 0xAA, 0x1D, 0x91, 0xD1, 0xD9, 0x0A, 0xD0, 0x9F, 0x9A, 0xA1, 0xC0,
+    0x92, 0xA0, 0x59, 0x99, 0x2A, 0xFD, 0x77, 0x5A, 0xFD, 0x29, 0x99, 0x50, 0x0A, 0xC1, 0x9C, 0x1C,
+    0xA1, 0xCA, 0x09, 0xC9, 0x1C, 0x90, 0xAC, 0x1A, 0xC1, 0x99, 0x19, 0x91, 0x09, 0x99, 0x90, 0x9F,
+    0x3D, 0x3C, 0xA6, 0x69, 0x5A, 0x59, 0x29, 0xC9, 0x0A, 0xA1, 0xC0, 0xCA, 0xA9, 0x09, 0xA0, 0xAD,
+    0x4A, 0x5A, 0x59, 0x97, 0x40, 0x69, 0xC9, 0x74, 0xD7, 0x19, 0xAE, 0xA3, 0x9C, 0xA1, 0xAD, 0x19,
+    0xCA, 0x19, 0xD1, 0x9D, 0x39, 0xFA, 0x29, 0xC9, 0x74, 0xD9, 0x73, 0x76, 0xAD, 0xA2, 0xA9, 0x1D,
+    0x1C, 0x90, 0x9C, 0x2A, 0x92, 0xE9, 0x76, 0xAD, 0x92, 0xA2, 0xD1, 0xC9, 0x0A, 0xC2, 0xA2, 0x9E,
+    0x76, 0x09, 0x96, 0xA7, 0x76, 0xA6, 0xA9, 0x00, 0x0A, 0x1A, 0x30, 0x97, 0x29, 0x1A, 0x79, 0xA9,
+    0x29, 0xAA, 0xAA, 0xAA, 0xA9, 0x20, 0x2A, 0xAA, 0xAA, 0xAA, 0x93, 0x99, 0x7A, 0xA1, 0x97, 0x29,
+    0x77, 0x75, 0xC9, 0x1A, 0xFF, 0xFD, 0xA7, 0x49, 0xA7, 0x73, 0x70, 0x9D, 0x72, 0xE7, 0x1A, 0xE7,
+    0x09, 0xCA, 0xAC, 0x70, 0xD0, 0xAC, 0x7A, 0xC9, 0x0A, 0xC9, 0x59, 0xCA, 0x19, 0xC9, 0x5D, 0x29,
+    0xCA, 0x4A, 0xCA, 0x29, 0xCA, 0x39, 0xD3, 0x9D, 0x3F, 0xFD, 0x2A, 0xFF, 0xD1, 0x9D, 0x94, 0x9D,
+    0x1D, 0xA5, 0x9D, 0x90, 0x3A, 0xFC, 0xA5, 0xD9, 0x99, 0x9D, 0x4C, 0xA4, 0xC9, 0x29, 0xC9, 0x39,
+    0xC9, 0x2A, 0xC3, 0x9D, 0x3F, 0xE9, 0x4D, 0xAA, 0xAE, 0x39, 0xC9, 0x4D, 0x2D, 0x5D, 0x2D, 0x49,
+    0xD1, 0x9C, 0xA3, 0x9D, 0xA1, 0xAD, 0xAA, 0xFC, 0x2F, 0xFC, 0x92, 0xFE, 0xA9, 0x20, 0x29, 0xAA,
+    0xAA, 0xAA, 0x92, 0xAF, 0xD3, 0xC9, 0x70, 0xC7, 0x09, 0xC7, 0x0A, 0xA7, 0x0C, 0xA7, 0x0C, 0x97,
+    0xAC, 0x70, 0xD7, 0x0C, 0xA7, 0x9C, 0x97, 0xAC, 0x70, 0x9A, 0x70, 0x77, 0x4D, 0x97, 0x0A, 0xDA,
+    0x79, 0xCA, 0xCA, 0x7D, 0x0D, 0x6D, 0x1D, 0x5A, 0xC9, 0x1D, 0x93, 0x9C, 0xA2, 0xAC, 0xA3, 0xD3,
+    0x9D, 0x2D, 0x93, 0x9D, 0x1A, 0xCA, 0x5D, 0x09, 0xDA, 0xAA, 0xAA, 0xAA, 0xD9, 0xAF, 0xFE, 0x00,
+    0x77, 0x2F, 0xF4, 0xAF, 0xDA, 0x94, 0xD7, 0x3D, 0x72, 0x9C, 0xA7, 0x2A, 0xC9, 0x72, 0xFD, 0xA5,
+    0x9F, 0xD9, 0x5A, 0xCA, 0x72, 0xD7, 0x3D, 0x72, 0xAF, 0xF4, 0xFF, 0xC4, 0xFF, 0xC3, 0x5F, 0xFD,
+    0xA5, 0xFF, 0xD6, 0x99, 0x99, 0x99, 0xAE, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0xA7, 0x29, 0xE9,
+    0x72, 0xAE, 0x97, 0x2F, 0x73, 0xF7, 0x29, 0xEA, 0x72, 0xAF, 0xCA, 0xAA, 0xAA, 0xA4, 0xFF, 0xF4,
+    0xFF, 0xF3, 0x49, 0x95, 0x99, 0x49, 0xCA, 0x5D, 0x93, 0xAC, 0x95, 0xD4, 0xD5, 0x9D, 0x4D, 0x5A,
+    0xCA, 0x3A, 0xCA, 0x5D, 0x93, 0xD9, 0x49, 0xD4, 0xD9, 0x4A, 0xD3, 0x9F, 0xFD, 0xA3, 0xAF, 0xFD,
+    0x93, 0xFF, 0xE9, 0x3D, 0x94, 0xE3, 0xAD, 0x5E, 0x3E, 0x49, 0xDA, 0x3D, 0xA4, 0xAD, 0x92, 0x6A,
+    0xEA, 0x97, 0xAD, 0xAA, 0xAD, 0xA5, 0xE3, 0x9D, 0x93, 0xAD, 0x5A, 0xCA, 0x29, 0xD6, 0xAD, 0x2A,
+    0xC9, 0x69, 0xCA, 0x2D, 0x19, 0x9A, 0xA9, 0x09, 0xCA, 0x19, 0xCA, 0x0F, 0xA9, 0x0A, 0xC9, 0x1A,
+    0xC9, 0x7D, 0x2A, 0xC9, 0x6A, 0xCA, 0x2E, 0x5A, 0xD9, 0x2A, 0xEA, 0xAA, 0xAE, 0xA3, 0x9F, 0xFD,
+    0x5F, 0xFC, 0x7A, 0xFA, 0x97, 0x75, 0x39, 0xD4, 0xAC, 0xA4, 0xD9, 0x4D, 0x49, 0xD4, 0xAC, 0xA4,
+    0xD9, 0x4D, 0x49, 0xD4, 0xAC, 0xA4, 0xDA, 0x4D, 0x93, 0x9D, 0x4E, 0x4E, 0x30, 0x49, 0xCA, 0x19,
+    0xD5, 0xAC, 0x91, 0xD9, 0x5D, 0x1D, 0x95, 0x9C, 0xA0, 0xDA, 0x6A, 0xC9, 0xAD, 0x7D, 0x9D, 0x79,
+    0xF7, 0x0A, 0xE9, 0x70, 0xF7, 0x09, 0xFC, 0x7A, 0xCA, 0xE9, 0x6D, 0x09, 0xE5, 0x9D, 0x1F, 0x4D,
+    0xA1, 0xAE, 0x93, 0xD9, 0x2F, 0x20, 0x79, 0xF7, 0x0F, 0xC7, 0x9F, 0xC7, 0xFD, 0x6A, 0xD0, 0xAD,
+    0x6D, 0x90, 0xAD, 0x94, 0xAD, 0x19, 0xD9, 0x39, 0xD3, 0xD9, 0x3D, 0xA3, 0xD9, 0x29, 0xD4, 0xDA,
+    0x2D, 0x94, 0xDA, 0x1A, 0xCA, 0x5A, 0xCA, 0x1D, 0x69, 0xD0, 0xAC, 0x96, 0x9D, 0x75, 0x77, 0x6E,
+    0x59, 0xDA, 0x4E, 0x94, 0xE9, 0x3A, 0xE9, 0x3A, 0xE4, 0xFA, 0x29, 0xF4, 0xCA, 0xE2, 0xDA, 0xD3,
+    0xAC, 0x9E, 0x1A, 0xDA, 0xCA, 0x3D, 0x9A, 0xD0, 0x9D, 0x0D, 0x93, 0xD0, 0xAD, 0x9D, 0xA9, 0xD9,
+    0x29, 0xD0, 0x9F, 0xC0, 0xAD, 0x3D, 0xA0, 0x9F, 0x90, 0xE3, 0xD9, 0x1E, 0xA0, 0x9D, 0xA2, 0x9D,
+    0x91, 0xE1, 0xAD, 0xA2, 0xE2, 0xD9, 0x1E, 0x92, 0xE6, 0x9E, 0x20, 0x77, 0x59, 0xAA, 0x5D, 0x5E,
+    0x4A, 0xCA, 0x5E, 0x4D, 0x94, 0xAE, 0x93, 0xD5, 0xFA, 0x2A, 0xCA, 0x49, 0xD9, 0xD2, 0xD9, 0x4A,
+    0xCA, 0x0D, 0x2D, 0x5D, 0x90, 0xD1, 0xAC, 0xA4, 0x9D, 0x1D, 0x90, 0xD9, 0x4A, 0xD1, 0xAC, 0xA9,
+    0xD5, 0xDA, 0x19, 0xDA, 0xCA, 0x49, 0xD9, 0x2F, 0x94, 0xAD, 0x3F, 0x5E, 0x3F, 0x40, 0x3F, 0xFC,
+    0x39, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x0F, 0xCA, 0x69, 0x99, 0x99, 0x77, 0x76, 0xFF,
+    0xCA, 0x1A, 0xFF, 0xCA, 0x10, 0x6A, 0xEA, 0x97, 0xAD, 0xAA, 0xAD, 0xA5, 0xE3, 0x9D, 0x93, 0xAD,
+    0x5A, 0xCA, 0x29, 0xD6, 0xAD, 0x2A, 0xC9, 0x69, 0xCA, 0x2D, 0x79, 0xCA, 0x19, 0xCA, 0x7A, 0xC9,
+    0x1A, 0xC9, 0x7D, 0x2A, 0xC9, 0x6A, 0xCA, 0x2E, 0x5A, 0xD9, 0x2A, 0xEA, 0xAA, 0xAE, 0xA3, 0x9F,
+    0xFD, 0x5F, 0xFC, 0x7A, 0xFA, 0x97, 0x75, 0x2A, 0xFE, 0x3C, 0xA3, 0xAC, 0x3C, 0x4C, 0xA2, 0x9C,
+    0x4C, 0x92, 0xAA, 0x39, 0xC3, 0xC9, 0x3A, 0xC3, 0xC4, 0xC9, 0x29, 0xC4, 0xC3, 0xCA, 0x39, 0xC3,
+    0xC9, 0x3A, 0xA2, 0x9C, 0x4C, 0x92, 0xAC, 0x39, 0xC3, 0x4F, 0xCA, 0x96, 0xDA, 0xAA, 0xDA, 0x49,
+    0xC9, 0x3D, 0x4A, 0xC4, 0xD4, 0xD4, 0xCA, 0x39, 0xCA, 0x29, 0xD4, 0xAF, 0xE9, 0x4F, 0xDA, 0x94,
+    0x9D, 0x72, 0xAD, 0x72, 0xDA, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xE7, 0x2E, 0x71, 0x2A, 0xFD, 0xA2,
+    0xAA, 0x71, 0xC7, 0x19, 0xC7, 0x1A, 0x97, 0x1C, 0x70, 0x9A, 0x7A, 0xA7, 0xCA, 0x69, 0xC9, 0x69,
+    0xFE, 0x2A, 0xFD, 0xA7, 0x50, 0x0A, 0xFF, 0xE1, 0xFF, 0xEA, 0x59, 0xCA, 0x72, 0xAC, 0x97, 0x2D,
+    0x73, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7,
+    0x2E, 0x70, 0x9C, 0xA5, 0xAC, 0xA0, 0xD4, 0x9D, 0x1D, 0x93, 0xD2, 0xAC, 0xA2, 0xD9, 0x2A, 0xD1,
+    0xD9, 0x39, 0xD0, 0xAC, 0xA5, 0xFC, 0x6F, 0x7A, 0xD9, 0x7A, 0xD7, 0x0D, 0xA7, 0xAD, 0x97, 0xE7,
+    0xAE, 0x70, 0x72, 0x97, 0x71, 0xC9, 0x77, 0x9C, 0x77, 0x0A, 0xC7, 0x49, 0xAF, 0xEA, 0x7E, 0xAA,
+    0xC0, 0x9A, 0xE4, 0x9E, 0x1A, 0xC2, 0xAD, 0x93, 0xDA, 0x2C, 0xA3, 0xDA, 0x2D, 0xA3, 0xC4, 0xD9,
+    0x19, 0xD3, 0xAC, 0x39, 0xD2, 0xAD, 0x3C, 0xA3, 0xAC, 0xA2, 0xDA, 0x3C, 0x92, 0xAD, 0x3E, 0xA1,
+    0x9C, 0x19, 0xEA, 0x3F, 0xFF, 0xCA, 0x5F, 0xFE, 0x97, 0xAF, 0xDA, 0x97, 0x4A, 0xC7, 0x70, 0x99,
+    0x72, 0x77, 0x5A, 0xC9, 0x5D, 0x6D, 0x4D, 0x7D, 0x92, 0xD9, 0x79, 0xCA, 0x1D, 0x97, 0x1D, 0x0D,
+    0x97, 0x2F, 0xA7, 0x39, 0xDA, 0x74, 0xAD, 0x97, 0x3A, 0xF7, 0x2A, 0xDA, 0xD9, 0x70, 0xAD, 0x1E,
+    0x7A, 0xD2, 0xAD, 0x6A, 0xD9, 0x29, 0xDA, 0x4A, 0xD9, 0x4E, 0x30, 0x19, 0xC2, 0x9A, 0x2C, 0x91,
+    0x9C, 0x2A, 0x92, 0xC2, 0xAA, 0x2C, 0x2A, 0xC2, 0xCA, 0x19, 0xC2, 0xCA, 0x2C, 0xA1, 0xAA, 0x1D,
+    0x3D, 0x1C, 0x1D, 0xA3, 0xAD, 0xAC, 0xAD, 0xA5, 0xAF, 0xCA, 0x70, 0xCA, 0x73, 0xC7, 0x39, 0xA7,
+    0x3A, 0x97, 0x3C, 0x73, 0x9C, 0x77, 0x60, 0x77, 0x5A, 0xF9, 0x69, 0xD9, 0x1A, 0xC9, 0x49, 0xCA,
+    0x4A, 0xC4, 0xCA, 0x5A, 0xC3, 0xAC, 0x6A, 0xC3, 0xCA, 0x6A, 0xC2, 0x9C, 0x96, 0xD2, 0x9C, 0x6A,
+    0xC9, 0x29, 0xC9, 0x49, 0xD4, 0xCA, 0x3A, 0xCA, 0x39, 0xAD, 0xA1, 0xEA, 0x92, 0xF9, 0x1F, 0xA7,
+    0x70, 0x77, 0x2A, 0xDA, 0x70, 0xFD, 0xA5, 0xAC, 0xA1, 0xAC, 0xA4, 0x9C, 0x92, 0x9C, 0x94, 0xCA,
+    0x3A, 0xC5, 0xC4, 0xD4, 0x9C, 0x3A, 0xD4, 0x9D, 0xAA, 0xEA, 0x5F, 0xEA, 0xC9, 0x39, 0xEA, 0x9C,
+    0xAE, 0x76, 0x77, 0x77, 0x72, 0x99, 0x79, 0xF9, 0x49, 0xCA, 0x1A, 0xC4, 0xCA, 0x3C, 0x92, 0x9C,
+    0x93, 0xC9, 0x2A, 0xC3, 0xCA, 0x3D, 0x0A, 0xD9, 0x4C, 0x91, 0x9A, 0xC9, 0x29, 0xC4, 0xAC, 0x2A,
+    0xC4, 0xD2, 0xEA, 0x1A, 0xCA, 0x2F, 0xF9, 0x19, 0xC0, 0xAF, 0xA2, 0xD2, 0x9A, 0x93, 0xCA, 0x70,
+    0x9C, 0x97, 0x09, 0xA7, 0x10, 0x71, 0xC9, 0x3D, 0x0C, 0xA3, 0xCA, 0x0D, 0x29, 0xC9, 0x0A, 0xC9,
+    0x1A, 0xC1, 0x9C, 0xA1, 0xCA, 0x2D, 0x0D, 0x3F, 0xA3, 0xF4, 0xE5, 0xD9, 0x49, 0xD5, 0xAD, 0x5A,
+    0xCA, 0x5A, 0xC9, 0x40, 0x77, 0x9F, 0xD9, 0x3D, 0x29, 0xA9, 0x3C, 0xA7, 0x19, 0xC9, 0x71, 0xAC,
+    0xA7, 0x1A, 0xCA, 0x6A, 0xF9, 0x39, 0xDA, 0x9A, 0xD3, 0xD9, 0x2A, 0xC9, 0x19, 0xCA, 0x3A, 0xC9,
+    0x1A, 0xC9, 0x3D, 0x2A, 0xD9, 0x09, 0xD9, 0x3F, 0xDA, 0x5A, 0xDA, 0x40, 0x3A, 0xA9, 0x29, 0xA9,
+    0x0A, 0x2A, 0x6A, 0x69, 0xD3, 0xAC, 0x5C, 0x91, 0xC9, 0x1D, 0xAD, 0x29, 0xDA, 0x20, 0x3A, 0xFC,
+    0x95, 0xAC, 0xA9, 0x5A, 0xC9, 0x6D, 0x7D, 0x7A, 0xC7, 0x0C, 0x97, 0x0C, 0x97, 0x0A, 0xCA, 0x97,
+    0x9E, 0x70, 0xD7, 0x9D, 0x69, 0xD6, 0x9D, 0x50, 0x74, 0xD9, 0x70, 0xCA, 0xAE, 0x93, 0xD9, 0x1A,
+    0xC2, 0xAC, 0x92, 0x9C, 0x2D, 0x3A, 0xC2, 0xC9, 0x3C, 0xA1, 0xAC, 0x93, 0xC9, 0x1D, 0x39, 0xC9,
+    0x1D, 0x3D, 0x19, 0xCA, 0x3D, 0x79, 0xCA, 0x7D, 0x97, 0xD7, 0x9D, 0x75, 0x59, 0xA9, 0x7C, 0x91,
+    0xC5, 0xC9, 0x2A, 0xA3, 0xAC, 0x3A, 0xA3, 0xC9, 0x3A, 0xA2, 0xAC, 0x99, 0x99, 0x9C, 0xA2, 0xFF,
+    0x92, 0xCA, 0x3A, 0xC2, 0x9C, 0xA2, 0x9D, 0x29, 0xD1, 0x9D, 0x92, 0x9F, 0xDA, 0x4F, 0xD6, 0xAD,
+    0xA4, 0x3A, 0x93, 0xC3, 0x9C, 0x3A, 0xA3, 0xC9, 0x29, 0xC3, 0xAC, 0x3D, 0x29, 0xCA, 0x2D, 0xA9,
+    0x1E, 0xA0, 0x29, 0xA1, 0xA9, 0x2C, 0xA0, 0xD3, 0xC0, 0xAC, 0x3A, 0xCA, 0xC4, 0xE4, 0x9D, 0xA4,
+    0xAE, 0x4C, 0xAA, 0xCA, 0x29, 0xC9, 0x0D, 0x91, 0xAC, 0x1A, 0xD1, 0x75, 0xE9, 0x70, 0xFC, 0x71,
+    0x9E, 0x72, 0xDA, 0x71, 0x9D, 0x71, 0x9D, 0xA7, 0x0A, 0xE7, 0x0D, 0x9C, 0xA7, 0xD0, 0xAC, 0x95,
+    0x9C, 0x91, 0xD5, 0xAC, 0x29, 0xC9, 0x4D, 0x3D, 0x4C, 0x93, 0x9C, 0x90, 0x3C, 0xA3, 0xAC, 0x4C,
+    0xA3, 0xD3, 0x9C, 0x93, 0xCA, 0x3A, 0xC3, 0x9C, 0x93, 0xD3, 0xAC, 0x39, 0xD3, 0xD3, 0xAD, 0x2A,
+    0xCA, 0x3F, 0xFA, 0x29, 0xFF, 0x92, 0xC9, 0x9E, 0x9A, 0xC3, 0xC7, 0x39, 0x72, 0x71, 0xCA, 0x3D,
+    0x0D, 0x3C, 0xA0, 0xAC, 0x29, 0xC9, 0x0A, 0xC9, 0x1A, 0xC1, 0x9C, 0xA0, 0x9C, 0xA2, 0xD0, 0xD3,
+    0xF9, 0x3F, 0x4E, 0x30, 0x1A, 0xFC, 0x93, 0xAC, 0xA9, 0x3A, 0xC5, 0x9C, 0x69, 0xC7, 0xE9, 0x39,
+    0xC9, 0x5C, 0x95, 0x9C, 0x96, 0xEA, 0x6A, 0xC6, 0xAC, 0x5A, 0xCA, 0x4D, 0xA7, 0x40, 0x3A, 0xE9,
+    0x4D, 0xAA, 0xAC, 0x92, 0xD3, 0xCA, 0x19, 0xC4, 0xAC, 0x1D, 0x4C, 0xA1, 0xCA, 0x4C, 0xA1, 0xCA,
+    0x3A, 0xC2, 0xDA, 0xAA, 0xDA, 0x2A, 0xFC, 0xA4, 0xAE, 0x93, 0x73, 0xAF, 0xFA, 0x2C, 0x91, 0xCA,
+    0x3A, 0xC1, 0x9C, 0x4C, 0xA1, 0xCA, 0x39, 0xC9, 0x1C, 0x93, 0xAC, 0x1A, 0xC4, 0xCA, 0x1D, 0x39,
+    0xC2, 0xE7, 0x50, 0x69, 0xAC, 0xA7, 0xAD, 0xAD, 0x5A, 0xC9, 0x19, 0xC5, 0xCA, 0x29, 0xC4, 0xD3,
+    0x9C, 0x4D, 0x3A, 0xC3, 0xAD, 0x3C, 0xA3, 0xEA, 0x99, 0xD3, 0x9F, 0xE9, 0x3D, 0x0A, 0xE9, 0x39,
+    0xD7, 0x1A, 0xC9, 0x71, 0xD7, 0x29, 0x72, 0x71, 0x9E, 0x91, 0xAC, 0x91, 0xC1, 0xC5, 0xAA, 0x5A,
+    0xA5, 0x9C, 0x6D, 0x59, 0xC9, 0x4A, 0xC9, 0x4D, 0x69, 0x40, 0x3A, 0xFF, 0xCA, 0x2D, 0xAA, 0xAC,
+    0xA6, 0xD3, 0xCA, 0x59, 0xC4, 0xAC, 0x5D, 0x4C, 0xA5, 0xCA, 0x4C, 0xA5, 0xCA, 0x3A, 0xC6, 0xDA,
+    0xAA, 0xDA, 0x6A, 0xFC, 0xA7, 0x0A, 0xE9, 0x70, 0x70, 0xAF, 0xEA, 0x29, 0xC6, 0xAC, 0x6C, 0x95,
+    0xAC, 0x6C, 0xA5, 0x9C, 0xA5, 0x9D, 0xA7, 0x40, 0x19, 0x29, 0x19, 0xC2, 0xAA, 0x0A, 0xA2, 0x9A,
+    0x0C, 0x92, 0xAA, 0x0C, 0x92, 0xAA, 0x0C, 0x3C, 0x99, 0xC2, 0x9C, 0x09, 0xDA, 0xAD, 0x09, 0xFC,
+    0x91, 0xAD, 0xA2, 0x70, 0x99, 0x75, 0xA9, 0x75, 0xC9, 0x75, 0xC7, 0x39, 0xAE, 0xA9, 0x7A, 0xFA,
+    0xDA, 0x5E, 0x0A, 0x90, 0x9D, 0x93, 0xAD, 0x1C, 0x2A, 0xCA, 0x29, 0xD2, 0xC2, 0xAD, 0x2A, 0xC9,
+    0x19, 0xC2, 0x9C, 0xA2, 0xD2, 0xAA, 0x2A, 0xCA, 0x19, 0xCA, 0x2C, 0x92, 0xAC, 0x91, 0xAC, 0x92,
+    0xC3, 0xD2, 0xAC, 0x92, 0xC2, 0xAC, 0xA2, 0xE1, 0x9C, 0x1A, 0xD3, 0xAF, 0xFD, 0xA3, 0x9F, 0xFD,
+    0x5F, 0xFC, 0x7A, 0xFA, 0x97, 0x29, 0xC7, 0x59, 0x97, 0x00, 0x3C, 0xA9, 0x4C, 0x93, 0xE9, 0x2C,
+    0xA5, 0x9D, 0x1C, 0xA7, 0xAC, 0x9D, 0x70, 0x9E, 0x72, 0xD7, 0x2E, 0x71, 0xF7, 0x0D, 0x9A, 0xC9,
+    0x6D, 0xA0, 0x9D, 0x5D, 0xA2, 0xF2, 0xDA, 0x3A, 0xE7, 0x70, 0x4C, 0x70, 0xC5, 0x90, 0x9C, 0x49,
+    0xC0, 0xAA, 0x09, 0xC1, 0xAA, 0x0C, 0x91, 0xC1, 0xCA, 0x0C, 0x19, 0xC1, 0xC9, 0x0C, 0x19, 0xC1,
+    0xC0, 0x9C, 0x1A, 0xA0, 0x9C, 0x09, 0xA1, 0xC9, 0x09, 0xFA, 0xD2, 0xFD, 0x92, 0x9E, 0xA9, 0x5C,
+    0x79, 0xA7, 0xAA, 0x7A, 0x95, 0x77, 0xD4, 0xCA, 0x2A, 0xC5, 0xAA, 0x19, 0xC9, 0x5C, 0xA1, 0xD1,
+    0x9A, 0x2C, 0x90, 0x9C, 0x91, 0xA9, 0x19, 0xC1, 0x9C, 0x91, 0xC9, 0x1D, 0x2D, 0xAF, 0xD3, 0x9D,
+    0xA9, 0xDA, 0x77, 0x00, 0x70, 0x9D, 0x72, 0xE7, 0x1A, 0xE7, 0x09, 0xCA, 0xAC, 0x70, 0xD0, 0xAC,
+    0x7A, 0xC9, 0x0A, 0xC9, 0x59, 0xCA, 0x19, 0xC9, 0x5D, 0x29, 0xCA, 0x4A, 0xCA, 0x29, 0xCA, 0x39,
+    0xD3, 0x9D, 0x3F, 0xFD, 0x2A, 0xFF, 0xD1, 0x9D, 0x94, 0x9D, 0x1D, 0xA5, 0x9D, 0x97, 0x77, 0x70,
+    0xAA, 0x72, 0x9D, 0x72, 0xAD, 0x60, 0x77, 0xAD, 0xA5, 0xFD, 0xA2, 0xAC, 0xA1, 0xAC, 0xA1, 0x9C,
+    0x92, 0x9C, 0x91, 0xCA, 0x3A, 0xC2, 0xC4, 0xD1, 0x9C, 0x3A, 0xD1, 0x9D, 0xAA, 0xEA, 0x2F, 0xEA,
+    0x29, 0xEA, 0x9C, 0x97, 0x77, 0x1D, 0x7A, 0xD7, 0xAA, 0xA5, 0x72, 0xAA, 0xA7, 0x5C, 0x97, 0x3C,
+    0x97, 0x77, 0x77, 0x77, 0x75, 0x9D, 0x73, 0xE7, 0x2A, 0xE7, 0x19, 0xCA, 0xAC, 0x71, 0xD0, 0xAC,
+    0x70, 0xAC, 0x90, 0xAC, 0x96, 0x9C, 0xA1, 0x9C, 0x96, 0xD2, 0x9C, 0xA5, 0xAC, 0xA2, 0x9C, 0xA4,
+    0x9D, 0x39, 0xD4, 0xFF, 0xD3, 0xAF, 0xFD, 0x29, 0xD9, 0x49, 0xD2, 0xDA, 0x59, 0xD9, 0x00, 0x69,
+    0xA9, 0x79, 0x0C, 0x70, 0xCA, 0x70, 0x97, 0x77, 0x4A, 0xDA, 0x9A, 0x3D, 0xAA, 0xDA, 0x2A, 0xC2,
+    0x9C, 0x91, 0x9C, 0x39, 0xC9, 0x1C, 0xA3, 0xAC, 0x2C, 0x4D, 0x19, 0xC3, 0xAD, 0x19, 0xDA, 0xAE,
+    0xA2, 0xFE, 0xA2, 0x9E, 0xA9, 0xC9, 0x00, 0x77, 0x77, 0x09, 0xC7, 0x7C, 0x97, 0x6C, 0xA7, 0x77,
+    0x77, 0x69, 0xCA, 0x76, 0xCA, 0xAA, 0x74, 0xA9, 0x19, 0xA7, 0x77, 0x69, 0xD7, 0x6E, 0x75, 0xAE,
+    0x74, 0x9C, 0xAA, 0xC7, 0x4D, 0x0A, 0xC7, 0x3A, 0xC9, 0x0A, 0xC9, 0x71, 0x9C, 0xA1, 0x9C, 0x97,
+    0x1D, 0x29, 0xCA, 0x70, 0xAC, 0xA2, 0x9C, 0xA7, 0x9D, 0x39, 0xD7, 0xFF, 0xD6, 0xAF, 0xFD, 0x59,
+    0xD9, 0x49, 0xD5, 0xDA, 0x59, 0xD9, 0x30, 0x77, 0x77, 0xC9, 0x75, 0xAC, 0x75, 0x9C, 0x77, 0x77,
+    0x72, 0xCA, 0x75, 0xAC, 0xAC, 0x73, 0x9A, 0x2A, 0x97, 0x77, 0x2A, 0xDA, 0xAA, 0x71, 0xCA, 0x1A,
+    0xCA, 0x70, 0xC9, 0x29, 0xC9, 0x7A, 0xC3, 0xAC, 0x70, 0xC9, 0x3D, 0x79, 0xC3, 0xAD, 0x79, 0xDA,
+    0xAE, 0xA7, 0x0F, 0xEA, 0x70, 0x9E, 0xA9, 0xC9, 0x60, 0x77, 0x79, 0xC9, 0x74, 0xAC, 0x97, 0x39,
+    0x99, 0x72, 0x9C, 0xA7, 0x3C, 0xAA, 0xA7, 0x1A, 0x91, 0x9A, 0x77, 0x70, 0x9D, 0x73, 0xE7, 0x2A,
+    0xE7, 0x19, 0xCA, 0xAC, 0x71, 0xD0, 0xAC, 0x70, 0xAC, 0x90, 0xAC, 0x96, 0x9C, 0xA1, 0x9C, 0x96,
+    0xD2, 0x9C, 0xA5, 0xAC, 0xA2, 0x9C, 0xA4, 0x9D, 0x39, 0xD4, 0xFF, 0xD3, 0xAF, 0xFD, 0x29, 0xD9,
+    0x49, 0xD2, 0xDA, 0x59, 0xD9, 0x00, 0x4C, 0xA7, 0x19, 0xCA, 0x71, 0x9C, 0xA7, 0x09, 0xD9, 0x7C,
+    0x19, 0xA7, 0x71, 0xAD, 0xA6, 0xFD, 0xA3, 0xAC, 0xA1, 0xAC, 0xA2, 0x9C, 0x92, 0x9C, 0x92, 0xCA,
+    0x3A, 0xC3, 0xC4, 0xD2, 0x9C, 0x3A, 0xD2, 0x9D, 0xAA, 0xEA, 0x3F, 0xEA, 0x39, 0xEA, 0x9C, 0x91,
+    0x75, 0xAA, 0xA7, 0x79, 0xC7, 0x69, 0xA7, 0x77, 0x77, 0x69, 0xCA, 0x76, 0xCA, 0xAA, 0x74, 0xA9,
+    0x19, 0xA7, 0x77, 0x69, 0xD7, 0x6E, 0x75, 0xAE, 0x74, 0x9C, 0xAA, 0xC7, 0x4D, 0x0A, 0xC7, 0x3A,
+    0xC9, 0x0A, 0xC9, 0x71, 0x9C, 0xA1, 0x9C, 0x97, 0x1D, 0x29, 0xCA, 0x70, 0xAC, 0xA2, 0x9C, 0xA7,
+    0x9D, 0x39, 0xD7, 0xFF, 0xD6, 0xAF, 0xFD, 0x59, 0xD9, 0x49, 0xD5, 0xDA, 0x59, 0xD9, 0x30, 0x79,
+    0xAA, 0x97, 0x1C, 0x97, 0x0A, 0x7C, 0x97, 0x0E, 0x96, 0xAA, 0x1A, 0xA7, 0x72, 0xAD, 0xA6, 0xFD,
+    0xA3, 0xAC, 0xA1, 0xAC, 0xA2, 0x9C, 0x92, 0x9C, 0x92, 0xCA, 0x3A, 0xC3, 0xC4, 0xD2, 0x9C, 0x3A,
+    0xD2, 0x9D, 0xAA, 0xEA, 0x3F, 0xEA, 0x39, 0xEA, 0x9C, 0x91, 0x70, 0xCA, 0x1A, 0x70, 0xC9, 0xA9,
+    0x9A, 0x79, 0xC1, 0xD7, 0x77, 0x77, 0x0D, 0x73, 0xAC, 0xAC, 0x71, 0x9A, 0x2A, 0x97, 0x77, 0x09,
+    0xD7, 0x3E, 0x72, 0xAE, 0x71, 0x9C, 0xAA, 0xC7, 0x1D, 0x0A, 0xC7, 0x0A, 0xC9, 0x0A, 0xC9, 0x69,
+    0xCA, 0x19, 0xC9, 0x6D, 0x29, 0xCA, 0x5A, 0xCA, 0x29, 0xCA, 0x49, 0xD3, 0x9D, 0x4F, 0xFD, 0x3A,
+    0xFF, 0xD2, 0x9D, 0x94, 0x9D, 0x2D, 0xA5, 0x9D, 0x90, 0x4D, 0x1C, 0x4A, 0x99, 0xA0, 0xC4, 0xC1,
+    0xAC, 0x97, 0x70, 0xAA, 0x79, 0xCA, 0xC6, 0xA2, 0xA9, 0x5A, 0xDA, 0x5F, 0xDA, 0x2A, 0xCA, 0x1A,
+    0xCA, 0x19, 0xC9, 0x29, 0xC9, 0x1C, 0xA3, 0xAC, 0x2C, 0x4D, 0x19, 0xC3, 0xAD, 0x19, 0xDA, 0xAE,
+    0xA2, 0xFE, 0xA2, 0x9E, 0xA9, 0xC9, 0x00, 0x77, 0x79, 0xCA, 0x73, 0xCA, 0xAA, 0x71, 0xA9, 0x19,
+    0xA7, 0x77, 0x09, 0xD7, 0x3E, 0x72, 0xAE, 0x71, 0x9C, 0xAA, 0xC7, 0x1D, 0x0A, 0xC7, 0x0A, 0xC9,
+    0x0A, 0xC9, 0x69, 0xCA, 0x19, 0xC9, 0x6D, 0x29, 0xCA, 0x5A, 0xCA, 0x29, 0xCA, 0x49, 0xD3, 0x9D,
+    0x4F, 0xFD, 0x3A, 0xFF, 0xD2, 0x9D, 0x94, 0x9D, 0x2D, 0xA5, 0x9D, 0x97, 0x77, 0x73, 0xAA, 0x73,
+    0x9D, 0x73, 0xAD, 0x70, 0x5C, 0x97, 0xAD, 0xA5, 0x9C, 0x19, 0xA4, 0x9A, 0xDA, 0x09, 0x3F, 0xDA,
+    0x2A, 0xCA, 0x1A, 0xCA, 0x19, 0xC9, 0x29, 0xC9, 0x1C, 0xA3, 0xAC, 0x2C, 0x4D, 0x19, 0xC3, 0xAD,
+    0x19, 0xDA, 0xAE, 0xA2, 0xFE, 0xA2, 0x9E, 0xA9, 0xC9, 0x77, 0x71, 0xD7, 0xAD, 0x7A, 0xAA, 0x50,
+    0x77, 0x74, 0xC7, 0x5A, 0xA7, 0x4A, 0xC7, 0x77, 0x77, 0x77, 0x29, 0xC3, 0xC7, 0x1D, 0xAD, 0x97,
+    0x19, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x29, 0xD7, 0x4E, 0x73, 0xAE, 0x72, 0x9C, 0xAA, 0xC7, 0x2D,
+    0x0A, 0xC7, 0x1A, 0xC9, 0x0A, 0xC9, 0x79, 0xCA, 0x19, 0xC9, 0x7D, 0x29, 0xCA, 0x6A, 0xCA, 0x29,
+    0xCA, 0x59, 0xD3, 0x9D, 0x5F, 0xFD, 0x4A, 0xFF, 0xD3, 0x9D, 0x94, 0x9D, 0x3D, 0xA5, 0x9D, 0x91,
+    0x70, 0xAA, 0x70, 0x9C, 0x71, 0xC9, 0x71, 0x97, 0x77, 0x7A, 0x39, 0x5C, 0x91, 0x9C, 0x5F, 0xC7,
+    0x9A, 0x97, 0x73, 0xAD, 0xA6, 0xFD, 0xA3, 0xAC, 0xA1, 0xAC, 0xA2, 0x9C, 0x92, 0x9C, 0x92, 0xCA,
+    0x3A, 0xC3, 0xC4, 0xD2, 0x9C, 0x3A, 0xD2, 0x9D, 0xAA, 0xEA, 0x3F, 0xEA, 0x39, 0xEA, 0x9C, 0x91,
+    0x71, 0xCA, 0x76, 0xD7, 0x59, 0x99, 0x77, 0x77, 0x71, 0x9C, 0x3C, 0x71, 0xDA, 0xD9, 0x71, 0x9D,
+    0xA7, 0x77, 0x77, 0x77, 0x39, 0xD7, 0x4E, 0x73, 0xAE, 0x72, 0x9C, 0xAA, 0xC7, 0x2D, 0x0A, 0xC7,
+    0x1A, 0xC9, 0x0A, 0xC9, 0x79, 0xCA, 0x19, 0xC9, 0x7D, 0x29, 0xCA, 0x6A, 0xCA, 0x29, 0xCA, 0x59,
+    0xD3, 0x9D, 0x5F, 0xFD, 0x4A, 0xFF, 0xD3, 0x9D, 0x94, 0x9D, 0x3D, 0xA5, 0x9D, 0x91, 0x59, 0x72,
+    0x9C, 0x97, 0x1A, 0xC9, 0x77, 0x76, 0xA3, 0x95, 0xC9, 0x19, 0xC5, 0xFC, 0x79, 0xA9, 0x77, 0x3A,
+    0xDA, 0x6F, 0xDA, 0x3A, 0xCA, 0x1A, 0xCA, 0x29, 0xC9, 0x29, 0xC9, 0x2C, 0xA3, 0xAC, 0x3C, 0x4D,
+    0x29, 0xC3, 0xAD, 0x29, 0xDA, 0xAE, 0xA3, 0xFE, 0xA3, 0x9E, 0xA9, 0xC9, 0x10, 0x72, 0xAA, 0xA7,
+    0x6C, 0x75, 0xC7, 0x77, 0x77, 0x77, 0x29, 0xC3, 0xC7, 0x1D, 0xAD, 0x97, 0x19, 0xDA, 0x97, 0x77,
+    0x77, 0x77, 0x29, 0xD7, 0x4E, 0x73, 0xAE, 0x72, 0x9C, 0xAA, 0xC7, 0x2D, 0x0A, 0xC7, 0x1A, 0xC9,
+    0x0A, 0xC9, 0x79, 0xCA, 0x19, 0xC9, 0x7D, 0x29, 0xCA, 0x6A, 0xCA, 0x29, 0xCA, 0x59, 0xD3, 0x9D,
+    0x5F, 0xFD, 0x4A, 0xFF, 0xD3, 0x9D, 0x94, 0x9D, 0x3D, 0xA5, 0x9D, 0x91, 0x6A, 0xDA, 0x79, 0x1C,
+    0xA7, 0x0A, 0xC7, 0x0C, 0xA7, 0x19, 0x77, 0x77, 0x72, 0x9C, 0x3C, 0x49, 0xDA, 0xD9, 0x59, 0xDA,
+    0x77, 0x3A, 0xDA, 0x6F, 0xDA, 0x3A, 0xCA, 0x1A, 0xCA, 0x29, 0xC9, 0x29, 0xC9, 0x2C, 0xA3, 0xAC,
+    0x3C, 0x4D, 0x29, 0xC3, 0xAD, 0x29, 0xDA, 0xAE, 0xA3, 0xFE, 0xA3, 0x9E, 0xA9, 0xC9, 0x10, 0x71,
+    0xAA, 0x1A, 0x71, 0xA9, 0x9A, 0x0C, 0x71, 0xC1, 0xD9, 0x71, 0xA7, 0x77, 0x69, 0x39, 0x70, 0x9C,
+    0x29, 0xC7, 0x1D, 0xAD, 0x97, 0x19, 0xDA, 0x77, 0x77, 0x77, 0x73, 0x9D, 0x74, 0xE7, 0x3A, 0xE7,
+    0x29, 0xCA, 0xAC, 0x72, 0xD0, 0xAC, 0x71, 0xAC, 0x90, 0xAC, 0x97, 0x9C, 0xA1, 0x9C, 0x97, 0xD2,
+    0x9C, 0xA6, 0xAC, 0xA2, 0x9C, 0xA5, 0x9D, 0x39, 0xD5, 0xFF, 0xD4, 0xAF, 0xFD, 0x39, 0xD9, 0x49,
+    0xD3, 0xDA, 0x59, 0xD9, 0x10, 0x5A, 0xA1, 0x99, 0x49, 0xA9, 0xA0, 0xC5, 0xC1, 0xAC, 0x97, 0x77,
+    0x5A, 0x3A, 0x5C, 0x91, 0x9C, 0x5F, 0xC7, 0x9A, 0x97, 0x73, 0xAD, 0xA6, 0xFD, 0xA3, 0xAC, 0xA1,
+    0xAC, 0xA2, 0x9C, 0x92, 0x9C, 0x92, 0xCA, 0x3A, 0xC3, 0xC4, 0xD2, 0x9C, 0x3A, 0xD2, 0x9D, 0xAA,
+    0xEA, 0x3F, 0xEA, 0x39, 0xEA, 0x9C, 0x91, 0x77, 0x79, 0xC3, 0xC7, 0x1D, 0xAD, 0x97, 0x19, 0xDA,
+    0x77, 0x77, 0x77, 0x73, 0x9D, 0x74, 0xE7, 0x3A, 0xE7, 0x29, 0xCA, 0xAC, 0x72, 0xD0, 0xAC, 0x71,
+    0xAC, 0x90, 0xAC, 0x97, 0x9C, 0xA1, 0x9C, 0x97, 0xD2, 0x9C, 0xA6, 0xAC, 0xA2, 0x9C, 0xA5, 0x9D,
+    0x39, 0xD5, 0xFF, 0xD4, 0xAF, 0xFD, 0x39, 0xD9, 0x49, 0xD3, 0xDA, 0x59, 0xD9, 0x77, 0x77, 0x6A,
+    0xA7, 0x49, 0xD7, 0x4A, 0xD7, 0x00, 0x4A, 0x39, 0x5C, 0x91, 0x9C, 0x5F, 0xC7, 0x9A, 0x97, 0x73,
+    0xAD, 0xA6, 0xFD, 0xA3, 0xAC, 0xA1, 0xAC, 0xA2, 0x9C, 0x92, 0x9C, 0x92, 0xCA, 0x3A, 0xC3, 0xC4,
+    0xD2, 0x9C, 0x3A, 0xD2, 0x9D, 0xAA, 0xEA, 0x3F, 0xEA, 0x39, 0xEA, 0x9C, 0x97, 0x77, 0x4D, 0x70,
+    0xAD, 0x70, 0xAA, 0xA6, 0x77, 0x2F, 0xF4, 0xAF, 0xDA, 0x94, 0xD7, 0x3D, 0x72, 0x9C, 0xA7, 0x2A,
+    0xC9, 0x72, 0xFD, 0xA5, 0x9F, 0xD9, 0x5A, 0xCA, 0x72, 0xD7, 0x3D, 0x72, 0xAF, 0xF4, 0xFF, 0xC4,
+    0xFF, 0xC7, 0x75, 0xAA, 0x72, 0x9D, 0x72, 0xDA, 0x70, 0x39, 0xAD, 0x94, 0xAC, 0x91, 0xC9, 0x2A,
+    0xC3, 0x9A, 0x19, 0xCA, 0x9A, 0xAE, 0x1A, 0xFC, 0xAA, 0x91, 0xC9, 0x70, 0xCA, 0x70, 0xDA, 0x91,
+    0x99, 0x2A, 0xFD, 0x93, 0x9F, 0xA7, 0x77, 0x29, 0xCA, 0x7D, 0x97, 0xAA, 0x60, 0x70, 0xAA, 0xA7,
+    0x4C, 0x73, 0xC7, 0x77, 0x77, 0x71, 0xFF, 0x4A, 0xFD, 0xA9, 0x4D, 0x73, 0xD7, 0x29, 0xCA, 0x72,
+    0xAC, 0x97, 0x2F, 0xDA, 0x59, 0xFD, 0x95, 0xAC, 0xA7, 0x2D, 0x73, 0xD7, 0x2A, 0xFF, 0x4F, 0xFC,
+    0x4F, 0xFC, 0x30, 0x6A, 0xAA, 0x70, 0x9C, 0x79, 0xA7, 0x77, 0x77, 0x71, 0x9A, 0xD9, 0x4A, 0xC9,
+    0x1C, 0x92, 0xAC, 0x39, 0xA1, 0x9C, 0xA9, 0xAA, 0xE1, 0xAF, 0xCA, 0xA9, 0x1C, 0x97, 0x0C, 0xA7,
+    0x0D, 0xA9, 0x19, 0x92, 0xAF, 0xD9, 0x39, 0xFA, 0x20, 0x7D, 0x1C, 0x7C, 0x99, 0xA0, 0xC7, 0xC1,
+    0xAC, 0x77, 0x77, 0x2F, 0xF4, 0xAF, 0xDA, 0x94, 0xD7, 0x3D, 0x72, 0x9C, 0xA7, 0x2A, 0xC9, 0x72,
+    0xFD, 0xA5, 0x9F, 0xD9, 0x5A, 0xCA, 0x72, 0xD7, 0x3D, 0x72, 0xAF, 0xF4, 0xFF, 0xC4, 0xFF, 0xC3,
+    0x49, 0xCA, 0x1C, 0x4C, 0x0A, 0x99, 0xA3, 0x9A, 0x1D, 0x77, 0x77, 0x59, 0xAD, 0x94, 0xAC, 0x91,
+    0xC9, 0x2A, 0xC3, 0x9A, 0x19, 0xCA, 0x9A, 0xAE, 0x1A, 0xFC, 0xAA, 0x91, 0xC9, 0x70, 0xCA, 0x70,
+    0xDA, 0x91, 0x99, 0x2A, 0xFD, 0x93, 0x9F, 0xA2, 0x77, 0x70, 0xA9, 0x72, 0x9C, 0x72, 0x9C, 0x97,
+    0x77, 0xCA, 0x72, 0x9D, 0xA7, 0x1C, 0x19, 0xA7, 0x59, 0x5F, 0xF4, 0xAF, 0xDA, 0x94, 0xD7, 0x3D,
+    0x72, 0x9C, 0xA7, 0x2A, 0xC9, 0x72, 0xFD, 0xA5, 0x9F, 0xD9, 0x5A, 0xCA, 0x72, 0xD7, 0x3D, 0x72,
+    0xAF, 0xF4, 0xFF, 0xC4, 0xFF, 0xC3, 0x75, 0x9C, 0x76, 0xC7, 0xC9, 0x4C, 0xA6, 0xAD, 0x93, 0x96,
+    0x9C, 0x1A, 0xA7, 0x77, 0x77, 0x49, 0xAD, 0x97, 0x2A, 0xC9, 0x1C, 0x97, 0x0A, 0xC3, 0x9A, 0x79,
+    0xCA, 0x9A, 0xAE, 0x7A, 0xFC, 0xAA, 0x97, 0xC9, 0x76, 0xCA, 0x76, 0xDA, 0x91, 0x99, 0x70, 0xAF,
+    0xD9, 0x71, 0x9F, 0xA7, 0x00, 0x7A, 0xA7, 0x4D, 0x74, 0xAA, 0x71, 0xCA, 0x72, 0x9D, 0xA7, 0x1C,
+    0x19, 0xA7, 0x59, 0x5F, 0xF4, 0xAF, 0xDA, 0x94, 0xD7, 0x3D, 0x72, 0x9C, 0xA7, 0x2A, 0xC9, 0x72,
+    0xFD, 0xA5, 0x9F, 0xD9, 0x5A, 0xCA, 0x72, 0xD7, 0x3D, 0x72, 0xAF, 0xF4, 0xFF, 0xC4, 0xFF, 0xC3,
+    0x39, 0xA7, 0x1D, 0x71, 0xD7, 0x0C, 0x97, 0xAD, 0x95, 0x9C, 0x1A, 0xA7, 0x77, 0x29, 0xAD, 0x94,
+    0xAC, 0x91, 0xC9, 0x2A, 0xC3, 0x9A, 0x19, 0xCA, 0x9A, 0xAE, 0x1A, 0xFC, 0xAA, 0x91, 0xC9, 0x70,
+    0xCA, 0x70, 0xDA, 0x91, 0x99, 0x2A, 0xFD, 0x93, 0x9F, 0xA2, 0x70, 0x9A, 0xA9, 0x73, 0xA9, 0x72,
+    0xC9, 0x77, 0x7C, 0xA7, 0x29, 0xDA, 0x71, 0xC1, 0x9A, 0x75, 0x95, 0xFF, 0x4A, 0xFD, 0xA9, 0x4D,
+    0x73, 0xD7, 0x29, 0xCA, 0x72, 0xAC, 0x97, 0x2F, 0xDA, 0x59, 0xFD, 0x95, 0xAC, 0xA7, 0x2D, 0x73,
+    0xD7, 0x2A, 0xFF, 0x4F, 0xFC, 0x4F, 0xFC, 0x30, 0x79, 0xAA, 0x97, 0x1C, 0x97, 0x0C, 0x69, 0xC7,
+    0x1E, 0x96, 0xAA, 0x1A, 0x97, 0x77, 0x77, 0x19, 0xAD, 0x95, 0xAC, 0x91, 0xC9, 0x3A, 0xC3, 0x9A,
+    0x29, 0xCA, 0x9A, 0xAE, 0x2A, 0xFC, 0xAA, 0x92, 0xC9, 0x71, 0xCA, 0x71, 0xDA, 0x91, 0x99, 0x3A,
+    0xFD, 0x94, 0x9F, 0xA3, 0x6A, 0xA1, 0xA7, 0xAA, 0x9A, 0x0C, 0x7C, 0x1A, 0xC9, 0x77, 0x77, 0x4A,
+    0xC7, 0x3C, 0xAC, 0x97, 0x0C, 0x2A, 0xA7, 0x74, 0xFF, 0x4A, 0xFD, 0xA9, 0x4D, 0x73, 0xD7, 0x29,
+    0xCA, 0x72, 0xAC, 0x97, 0x2F, 0xDA, 0x59, 0xFD, 0x95, 0xAC, 0xA7, 0x2D, 0x73, 0xD7, 0x2A, 0xFF,
+    0x4F, 0xFC, 0x4F, 0xFC, 0x30, 0x4D, 0x1C, 0x4C, 0x99, 0x99, 0xA4, 0xC1, 0xD7, 0x71, 0xAA, 0x79,
+    0xDA, 0x6C, 0x90, 0x9A, 0x77, 0x73, 0x9A, 0xD9, 0x4A, 0xC9, 0x1C, 0x92, 0xAC, 0x39, 0xA1, 0x9C,
+    0xA9, 0xAA, 0xE1, 0xAF, 0xCA, 0xA9, 0x1C, 0x97, 0x0C, 0xA7, 0x0D, 0xA9, 0x19, 0x92, 0xAF, 0xD9,
+    0x39, 0xFA, 0x20, 0x7C, 0xA7, 0x29, 0xDA, 0x71, 0xC1, 0x9A, 0x75, 0x95, 0xFF, 0x4A, 0xFD, 0xA9,
+    0x4D, 0x73, 0xD7, 0x29, 0xCA, 0x72, 0xAC, 0x97, 0x2F, 0xDA, 0x59, 0xFD, 0x95, 0xAC, 0xA7, 0x2D,
+    0x73, 0xD7, 0x2A, 0xFF, 0x4F, 0xFC, 0x4F, 0xFC, 0x77, 0x5A, 0xA7, 0x29, 0xD7, 0x2D, 0xA7, 0x6C,
+    0x97, 0x0A, 0xDA, 0x69, 0xC1, 0x9A, 0x77, 0x77, 0x70, 0x9A, 0xD9, 0x5A, 0xC9, 0x1C, 0x93, 0xAC,
+    0x39, 0xA2, 0x9C, 0xA9, 0xAA, 0xE2, 0xAF, 0xCA, 0xA9, 0x2C, 0x97, 0x1C, 0xA7, 0x1D, 0xA9, 0x19,
+    0x93, 0xAF, 0xD9, 0x49, 0xFA, 0x77, 0x75, 0x9C, 0xA7, 0x0D, 0x97, 0x0A, 0xA7, 0x5A, 0xAA, 0x79,
+    0xC6, 0x9A, 0x77, 0x77, 0x75, 0x9D, 0x6A, 0xCA, 0x6D, 0x96, 0xD6, 0x9D, 0x6A, 0xCA, 0x6D, 0x96,
+    0xD6, 0x9D, 0x6A, 0xCA, 0x6D, 0xA6, 0xD9, 0x59, 0xD6, 0xE6, 0xE5, 0x39, 0xAA, 0x95, 0xC9, 0x4C,
+    0x77, 0x74, 0x9C, 0x5A, 0xA5, 0xC9, 0x49, 0xC5, 0xAC, 0x5C, 0xA4, 0x9C, 0x94, 0xD5, 0xD4, 0x49,
+    0xD5, 0xAC, 0xA5, 0xD9, 0x5D, 0x59, 0xD5, 0xAC, 0xA5, 0xD9, 0x5D, 0x59, 0xD5, 0xAC, 0xA5, 0xDA,
+    0x5D, 0x94, 0x9D, 0x5E, 0x5E, 0x75, 0x9A, 0x95, 0xD9, 0x49, 0xD9, 0x40, 0x5A, 0x94, 0xAC, 0xA4,
+    0xD9, 0x77, 0x49, 0x5A, 0xC5, 0xCA, 0x5C, 0x94, 0x9C, 0x5A, 0xA5, 0xCA, 0x49, 0xC9, 0x4D, 0x5D,
+    0x75, 0xA9, 0x4A, 0xC9, 0x4D, 0x93, 0x6A, 0xEA, 0x97, 0xAD, 0xAA, 0xAD, 0xA5, 0xE3, 0x9D, 0x93,
+    0xAD, 0x5A, 0xCA, 0x29, 0xD6, 0xAD, 0x2A, 0xC9, 0x69, 0xCA, 0x2D, 0x79, 0xCA, 0x19, 0xCA, 0x7A,
+    0xC9, 0x1A, 0xC9, 0x7D, 0x2A, 0xC9, 0x6A, 0xCA, 0x2E, 0x5A, 0xD9, 0x2A, 0xEA, 0xAA, 0xAE, 0xA3,
+    0x9F, 0xFD, 0x5F, 0xFC, 0x7A, 0xFA, 0x97, 0x77, 0x77, 0x19, 0xA7, 0x5D, 0x74, 0x9D, 0x71, 0x3A,
+    0xE9, 0x4D, 0xAA, 0xAC, 0x92, 0xD3, 0xCA, 0x19, 0xC4, 0xAC, 0x1D, 0x4C, 0xA1, 0xCA, 0x4C, 0xA1,
+    0xCA, 0x3A, 0xC2, 0xDA, 0xAA, 0xDA, 0x2A, 0xFC, 0xA4, 0xAE, 0x97, 0x77, 0x3A, 0xA7, 0x0D, 0x7A,
+    0xD6, 0x71, 0xAA, 0xA7, 0x59, 0xC7, 0x49, 0xA7, 0x77, 0x77, 0x77, 0x2A, 0xEA, 0x97, 0xAD, 0xAA,
+    0xAD, 0xA5, 0xE3, 0x9D, 0x93, 0xAD, 0x5A, 0xCA, 0x29, 0xD6, 0xAD, 0x2A, 0xC9, 0x69, 0xCA, 0x2D,
+    0x79, 0xCA, 0x19, 0xCA, 0x7A, 0xC9, 0x1A, 0xC9, 0x7D, 0x2A, 0xC9, 0x6A, 0xCA, 0x2E, 0x5A, 0xD9,
+    0x2A, 0xEA, 0xAA, 0xAE, 0xA3, 0x9F, 0xFD, 0x5F, 0xFC, 0x7A, 0xFA, 0x97, 0x75, 0x6A, 0xAA, 0x70,
+    0x9C, 0x79, 0xA7, 0x77, 0x77, 0x71, 0xAE, 0x94, 0xDA, 0xAA, 0xC9, 0x2D, 0x3C, 0xA1, 0x9C, 0x4A,
+    0xC1, 0xD4, 0xCA, 0x1C, 0xA4, 0xCA, 0x1C, 0xA3, 0xAC, 0x2D, 0xAA, 0xAD, 0xA2, 0xAF, 0xCA, 0x4A,
+    0xE9, 0x30, 0x70, 0xC9, 0x77, 0x0A, 0xD9, 0x76, 0x9A, 0x1A, 0xA7, 0x77, 0x71, 0xAE, 0xA9, 0x49,
+    0x5A, 0xDA, 0xAA, 0xDA, 0x2A, 0xA4, 0xE3, 0x9D, 0x90, 0x9C, 0x4A, 0xD5, 0xAC, 0xA0, 0xC9, 0x39,
+    0xD6, 0xAD, 0x6A, 0xC9, 0x69, 0xCA, 0x6D, 0x79, 0xCA, 0x59, 0xCA, 0x7A, 0xC9, 0x5A, 0xC9, 0x7D,
+    0x6A, 0xC9, 0x6A, 0xCA, 0x6E, 0x5A, 0xD9, 0x6A, 0xEA, 0xAA, 0xAE, 0xA7, 0x9F, 0xFD, 0x71, 0xFF,
+    0xC7, 0x3A, 0xFA, 0x97, 0x77, 0x50, 0x76, 0x97, 0x69, 0xA6, 0xC9, 0x49, 0xC6, 0xAD, 0x93, 0xCA,
+    0x59, 0xA1, 0xAA, 0x77, 0x77, 0x74, 0xAE, 0x97, 0x2D, 0xAA, 0xAC, 0x97, 0x0D, 0x3C, 0xA7, 0x9C,
+    0x4A, 0xC7, 0xD4, 0xCA, 0x7C, 0xA4, 0xCA, 0x7C, 0xA3, 0xAC, 0x70, 0xDA, 0xAA, 0xDA, 0x70, 0xAF,
+    0xCA, 0x72, 0xAE, 0x97, 0x10, 0x6A, 0x76, 0xAC, 0x76, 0xAC, 0x97, 0x77, 0x5C, 0x97, 0x4A, 0xD9,
+    0x72, 0x9A, 0x1A, 0xA7, 0x77, 0x1A, 0xEA, 0x97, 0xAD, 0xAA, 0xAD, 0xA5, 0xE3, 0x9D, 0x93, 0xAD,
+    0x5A, 0xCA, 0x29, 0xD6, 0xAD, 0x2A, 0xC9, 0x69, 0xCA, 0x2D, 0x79, 0xCA, 0x19, 0xCA, 0x7A, 0xC9,
+    0x1A, 0xC9, 0x7D, 0x2A, 0xC9, 0x6A, 0xCA, 0x2E, 0x5A, 0xD9, 0x2A, 0xEA, 0xAA, 0xAE, 0xA3, 0x9F,
+    0xFD, 0x5F, 0xFC, 0x7A, 0xFA, 0x97, 0x75, 0x39, 0x97, 0x1C, 0xA7, 0x09, 0xCA, 0x70, 0xC9, 0x7A,
+    0xD9, 0x59, 0xA1, 0xAA, 0x77, 0x72, 0xAE, 0x94, 0xDA, 0xAA, 0xC9, 0x2D, 0x3C, 0xA1, 0x9C, 0x4A,
+    0xC1, 0xD4, 0xCA, 0x1C, 0xA4, 0xCA, 0x1C, 0xA3, 0xAC, 0x2D, 0xAA, 0xAD, 0xA2, 0xAF, 0xCA, 0x4A,
+    0xE9, 0x30, 0x77, 0xAA, 0xA7, 0x71, 0xAA, 0x77, 0x09, 0x97, 0x2C, 0x97, 0x70, 0xAD, 0x97, 0x69,
+    0xA1, 0xAA, 0x77, 0x77, 0x1A, 0xEA, 0x97, 0x3A, 0xDA, 0xAA, 0xDA, 0x71, 0xE3, 0x9D, 0x97, 0xAD,
+    0x5A, 0xCA, 0x69, 0xD6, 0xAD, 0x6A, 0xC9, 0x69, 0xCA, 0x6D, 0x79, 0xCA, 0x59, 0xCA, 0x7A, 0xC9,
+    0x5A, 0xC9, 0x7D, 0x6A, 0xC9, 0x6A, 0xCA, 0x6E, 0x5A, 0xD9, 0x6A, 0xEA, 0xAA, 0xAE, 0xA7, 0x9F,
+    0xFD, 0x71, 0xFF, 0xC7, 0x3A, 0xFA, 0x97, 0x77, 0x50, 0x79, 0xA9, 0x70, 0x90, 0xA9, 0x70, 0xAA,
+    0x71, 0x96, 0xAC, 0x71, 0xCA, 0xC9, 0x6C, 0x29, 0xA7, 0x77, 0x77, 0x1A, 0xE9, 0x5D, 0xAA, 0xAC,
+    0x93, 0xD3, 0xCA, 0x29, 0xC4, 0xAC, 0x2D, 0x4C, 0xA2, 0xCA, 0x4C, 0xA2, 0xCA, 0x3A, 0xC3, 0xDA,
+    0xAA, 0xDA, 0x3A, 0xFC, 0xA5, 0xAE, 0x94, 0x69, 0xCA, 0x1C, 0x71, 0xC0, 0xA9, 0x9A, 0x70, 0x9A,
+    0x1D, 0x77, 0x73, 0xCA, 0x74, 0x9D, 0xA7, 0x3C, 0x19, 0xA7, 0x77, 0x2A, 0xEA, 0x97, 0xAD, 0xAA,
+    0xAD, 0xA5, 0xE3, 0x9D, 0x93, 0xAD, 0x5A, 0xCA, 0x29, 0xD6, 0xAD, 0x2A, 0xC9, 0x69, 0xCA, 0x2D,
+    0x79, 0xCA, 0x19, 0xCA, 0x7A, 0xC9, 0x1A, 0xC9, 0x7D, 0x2A, 0xC9, 0x6A, 0xCA, 0x2E, 0x5A, 0xD9,
+    0x2A, 0xEA, 0xAA, 0xAE, 0xA3, 0x9F, 0xFD, 0x5F, 0xFC, 0x7A, 0xFA, 0x97, 0x75, 0x4C, 0xA1, 0xA4,
+    0xC9, 0xA9, 0x9A, 0x39, 0xC1, 0xD7, 0x77, 0x4D, 0x7A, 0xCA, 0xC5, 0x9A, 0x2A, 0x97, 0x77, 0x2A,
+    0xE9, 0x4D, 0xAA, 0xAC, 0x92, 0xD3, 0xCA, 0x19, 0xC4, 0xAC, 0x1D, 0x4C, 0xA1, 0xCA, 0x4C, 0xA1,
+    0xCA, 0x3A, 0xC2, 0xDA, 0xAA, 0xDA, 0x2A, 0xFC, 0xA4, 0xAE, 0x93, 0x70, 0xC9, 0x74, 0xAD, 0x97,
+    0x29, 0xA1, 0xAA, 0x77, 0x71, 0xAE, 0xA9, 0x7A, 0xDA, 0xAA, 0xDA, 0x5E, 0x39, 0xD9, 0x3A, 0xD5,
+    0xAC, 0xA2, 0x9D, 0x6A, 0xD2, 0xAC, 0x96, 0x9C, 0xA2, 0xD7, 0x9C, 0xA1, 0x9C, 0xA7, 0xAC, 0x91,
+    0xAC, 0x97, 0xD2, 0xAC, 0x96, 0xAC, 0xA2, 0xE5, 0xAD, 0x92, 0xAE, 0xAA, 0xAA, 0xEA, 0x39, 0xFF,
+    0xD5, 0xFF, 0xC7, 0xAF, 0xA9, 0x77, 0x77, 0x71, 0x9A, 0x75, 0xD7, 0x49, 0xD7, 0x10, 0x5C, 0x97,
+    0xAD, 0x95, 0x9A, 0x1A, 0xA7, 0x77, 0x2A, 0xE9, 0x4D, 0xAA, 0xAC, 0x92, 0xD3, 0xCA, 0x19, 0xC4,
+    0xAC, 0x1D, 0x4C, 0xA1, 0xCA, 0x4C, 0xA1, 0xCA, 0x3A, 0xC2, 0xDA, 0xAA, 0xDA, 0x2A, 0xFC, 0xA4,
+    0xAE, 0x97, 0x77, 0x5D, 0x7A, 0xCA, 0x7A, 0xA9, 0x40, 0x76, 0x97, 0x71, 0xAA, 0x77, 0x09, 0xC7,
+    0x71, 0xC9, 0x77, 0x77, 0x77, 0x76, 0x99, 0x6A, 0xEA, 0x94, 0xAA, 0x4A, 0xDA, 0xAA, 0xDA, 0x29,
+    0xC4, 0xE3, 0x9D, 0x90, 0x9C, 0x93, 0xAD, 0x5A, 0xCA, 0x69, 0xD6, 0xAD, 0x6A, 0xC9, 0x69, 0xCA,
+    0x6D, 0x79, 0xCA, 0x59, 0xCA, 0x7A, 0xC9, 0x5A, 0xC9, 0x7D, 0x6A, 0xC9, 0x6A, 0xCA, 0x6E, 0x5A,
+    0xD9, 0x6A, 0xEA, 0xAA, 0xAE, 0xA7, 0x9F, 0xFD, 0x71, 0xFF, 0xC7, 0x3A, 0xFA, 0x97, 0x77, 0x50,
+    0x70, 0x97, 0x19, 0xC7, 0x1C, 0x71, 0xCA, 0x77, 0x77, 0x77, 0x19, 0x3A, 0xE9, 0x1C, 0x2D, 0xAA,
+    0xAC, 0x9C, 0x91, 0xD3, 0xD9, 0x19, 0xC4, 0xAC, 0x2D, 0x4C, 0xA2, 0xCA, 0x4C, 0xA2, 0xCA, 0x3A,
+    0xC3, 0xDA, 0xAA, 0xDA, 0x3A, 0xFC, 0xA5, 0xAE, 0x94, 0x77, 0x76, 0xAC, 0x77, 0x2D, 0x97, 0x71,
+    0x99, 0x77, 0x77, 0x72, 0x99, 0x6A, 0xEA, 0x94, 0xAA, 0x4A, 0xDA, 0xAA, 0xDA, 0x29, 0xC4, 0xE3,
+    0x9D, 0x90, 0x9C, 0x93, 0xAD, 0x5A, 0xCA, 0x69, 0xD6, 0xAD, 0x6A, 0xC9, 0x69, 0xCA, 0x6D, 0x79,
+    0xCA, 0x59, 0xCA, 0x7A, 0xC9, 0x5A, 0xC9, 0x7D, 0x6A, 0xC9, 0x6A, 0xCA, 0x6E, 0x5A, 0xD9, 0x6A,
+    0xEA, 0xAA, 0xAE, 0xA7, 0x9F, 0xFD, 0x71, 0xFF, 0xC7, 0x3A, 0xFA, 0x97, 0x77, 0x50, 0x49, 0xC9,
+    0x71, 0xAC, 0x97, 0x19, 0xA7, 0x77, 0x75, 0x93, 0xAE, 0x91, 0xC2, 0xDA, 0xAA, 0xC9, 0xC9, 0x1D,
+    0x3D, 0x91, 0x9C, 0x4A, 0xC2, 0xD4, 0xCA, 0x2C, 0xA4, 0xCA, 0x2C, 0xA3, 0xAC, 0x3D, 0xAA, 0xAD,
+    0xA3, 0xAF, 0xCA, 0x5A, 0xE9, 0x40, 0x73, 0x9A, 0xA9, 0x77, 0x1A, 0xA7, 0x70, 0xA9, 0x77, 0x77,
+    0x77, 0x76, 0x99, 0x6A, 0xEA, 0x94, 0xAA, 0x4A, 0xDA, 0xAA, 0xDA, 0x29, 0xC4, 0xE3, 0x9D, 0x90,
+    0x9C, 0x93, 0xAD, 0x5A, 0xCA, 0x69, 0xD6, 0xAD, 0x6A, 0xC9, 0x69, 0xCA, 0x6D, 0x79, 0xCA, 0x59,
+    0xCA, 0x7A, 0xC9, 0x5A, 0xC9, 0x7D, 0x6A, 0xC9, 0x6A, 0xCA, 0x6E, 0x5A, 0xD9, 0x6A, 0xEA, 0xAA,
+    0xAE, 0xA7, 0x9F, 0xFD, 0x71, 0xFF, 0xC7, 0x3A, 0xFA, 0x97, 0x77, 0x50, 0x6A, 0xAA, 0x71, 0x9C,
+    0x70, 0x9A, 0x77, 0x77, 0x77, 0x19, 0x3A, 0xE9, 0x1C, 0x2D, 0xAA, 0xAC, 0x9C, 0x91, 0xD3, 0xD9,
+    0x19, 0xC4, 0xAC, 0x2D, 0x4C, 0xA2, 0xCA, 0x4C, 0xA2, 0xCA, 0x3A, 0xC3, 0xDA, 0xAA, 0xDA, 0x3A,
+    0xFC, 0xA5, 0xAE, 0x94, 0x72, 0xAC, 0x90, 0x99, 0x74, 0x9A, 0x0C, 0x0C, 0x75, 0xA9, 0x09, 0xCA,
+    0x77, 0x77, 0x72, 0x96, 0xAE, 0xA9, 0x4A, 0xA4, 0xAD, 0xAA, 0xAD, 0xA2, 0x9C, 0x4E, 0x39, 0xD9,
+    0x09, 0xC9, 0x3A, 0xD5, 0xAC, 0xA6, 0x9D, 0x6A, 0xD6, 0xAC, 0x96, 0x9C, 0xA6, 0xD7, 0x9C, 0xA5,
+    0x9C, 0xA7, 0xAC, 0x95, 0xAC, 0x97, 0xD6, 0xAC, 0x96, 0xAC, 0xA6, 0xE5, 0xAD, 0x96, 0xAE, 0xAA,
+    0xAA, 0xEA, 0x79, 0xFF, 0xD7, 0x1F, 0xFC, 0x73, 0xAF, 0xA9, 0x77, 0x75, 0x4A, 0xCA, 0x1A, 0x5C,
+    0x0C, 0x0A, 0x94, 0x99, 0x1C, 0xA7, 0x77, 0x74, 0x93, 0xAE, 0x91, 0xC2, 0xDA, 0xAA, 0xC9, 0xC9,
+    0x1D, 0x3D, 0x91, 0x9C, 0x4A, 0xC2, 0xD4, 0xCA, 0x2C, 0xA4, 0xCA, 0x2C, 0xA3, 0xAC, 0x3D, 0xAA,
+    0xAD, 0xA3, 0xAF, 0xCA, 0x5A, 0xE9, 0x40, 0x77, 0x19, 0x96, 0xAE, 0xA9, 0x4A, 0xA4, 0xAD, 0xAA,
+    0xAD, 0xA2, 0x9C, 0x4E, 0x39, 0xD9, 0x09, 0xC9, 0x3A, 0xD5, 0xAC, 0xA6, 0x9D, 0x6A, 0xD6, 0xAC,
+    0x96, 0x9C, 0xA6, 0xD7, 0x9C, 0xA5, 0x9C, 0xA7, 0xAC, 0x95, 0xAC, 0x97, 0xD6, 0xAC, 0x96, 0xAC,
+    0xA6, 0xE5, 0xAD, 0x96, 0xAE, 0xAA, 0xAA, 0xEA, 0x79, 0xFF, 0xD7, 0x1F, 0xFC, 0x73, 0xAF, 0xA9,
+    0x77, 0x77, 0x77, 0x59, 0xA7, 0x71, 0xD7, 0x70, 0x9D, 0x75, 0x72, 0x93, 0xAE, 0x91, 0xC2, 0xDA,
+    0xAA, 0xC9, 0xC9, 0x1D, 0x3D, 0x91, 0x9C, 0x4A, 0xC2, 0xD4, 0xCA, 0x2C, 0xA4, 0xCA, 0x2C, 0xA3,
+    0xAC, 0x3D, 0xAA, 0xAD, 0xA3, 0xAF, 0xCA, 0x5A, 0xE9, 0x77, 0x76, 0xAA, 0x71, 0xD7, 0x0A, 0xD7,
+    0x77, 0x1A, 0xD5, 0xDA, 0x2D, 0xA4, 0x9D, 0x3D, 0x94, 0xAD, 0x29, 0xD5, 0xDA, 0x2A, 0xD5, 0xD9,
+    0x2D, 0xA4, 0x9D, 0x3D, 0x5A, 0xCA, 0x29, 0xD5, 0xD9, 0x2A, 0xCA, 0x5D, 0x3A, 0xCA, 0x4A, 0xCA,
+    0x3E, 0x92, 0xAD, 0x93, 0xFF, 0xD4, 0xFF, 0xC9, 0x5A, 0xFC, 0xA9, 0x77, 0x77, 0x59, 0xCA, 0x73,
+    0xD9, 0x73, 0xAA, 0x71, 0x1C, 0xA3, 0xAC, 0x2C, 0xA3, 0xD2, 0xC9, 0x3C, 0xA1, 0x9C, 0x39, 0xC9,
+    0x1A, 0xC3, 0xAC, 0x2D, 0x3D, 0x2D, 0x2A, 0xCA, 0x2F, 0xEA, 0x2F, 0xE9, 0x29, 0xE9, 0xAC, 0x77,
+    0xAA, 0x79, 0xD7, 0xE6, 0x70, 0x9A, 0x97, 0x39, 0x0A, 0x97, 0x3A, 0xA7, 0x49, 0x77, 0x77, 0x77,
+    0x3A, 0xD5, 0xDA, 0x2D, 0xA4, 0x9D, 0x3D, 0x94, 0xAD, 0x29, 0xD5, 0xDA, 0x2A, 0xD5, 0xD9, 0x2D,
+    0xA4, 0x9D, 0x3D, 0x5A, 0xCA, 0x29, 0xD5, 0xD9, 0x2A, 0xCA, 0x5D, 0x3A, 0xCA, 0x4A, 0xCA, 0x3E,
+    0x92, 0xAD, 0x93, 0xFF, 0xD4, 0xFF, 0xC9, 0x5A, 0xFC, 0xA9, 0x77, 0x30, 0x5A, 0xAA, 0x71, 0xC7,
+    0x0C, 0x77, 0x77, 0x5C, 0xA3, 0xAC, 0x2C, 0xA3, 0xD2, 0xC9, 0x3C, 0xA1, 0x9C, 0x39, 0xC9, 0x1A,
+    0xC3, 0xAC, 0x2D, 0x3D, 0x2D, 0x2A, 0xCA, 0x2F, 0xEA, 0x2F, 0xE9, 0x29, 0xE9, 0xAC, 0x20, 0x72,
+    0xC9, 0x76, 0xAC, 0x76, 0x9C, 0x77, 0x77, 0x77, 0x77, 0x74, 0x93, 0xAD, 0x5D, 0xA9, 0xC3, 0xE4,
+    0x9F, 0xA3, 0xD9, 0x4A, 0xD9, 0x93, 0x9D, 0x5D, 0xA5, 0xAD, 0x5D, 0x95, 0xDA, 0x49, 0xD6, 0xD5,
+    0xAC, 0xA5, 0x9D, 0x5D, 0x95, 0x9C, 0xA5, 0xD6, 0xAC, 0xA4, 0xAC, 0xA6, 0xE9, 0x2A, 0xD9, 0x6F,
+    0xFD, 0x7F, 0xFC, 0x97, 0x0A, 0xFC, 0xA9, 0x77, 0x71, 0x77, 0x3C, 0x71, 0xC9, 0x70, 0xAC, 0x77,
+    0x77, 0x6A, 0x1C, 0xA3, 0xAC, 0x9A, 0x1C, 0xA3, 0xE2, 0xC9, 0x3D, 0x29, 0xC3, 0x9C, 0x92, 0xAC,
+    0x3A, 0xC3, 0xD3, 0xD3, 0xD2, 0xAC, 0xA3, 0xFE, 0xA3, 0xFE, 0x93, 0x9E, 0x9A, 0xC3, 0x77, 0x71,
+    0xD7, 0x70, 0xD7, 0x77, 0x77, 0x77, 0x7A, 0xD5, 0xDA, 0x9C, 0x3E, 0x49, 0xFA, 0x3D, 0x94, 0xAD,
+    0x99, 0x39, 0xD5, 0xDA, 0x5A, 0xD5, 0xD9, 0x5D, 0xA4, 0x9D, 0x6D, 0x5A, 0xCA, 0x59, 0xD5, 0xD9,
+    0x59, 0xCA, 0x5D, 0x6A, 0xCA, 0x4A, 0xCA, 0x6E, 0x92, 0xAD, 0x96, 0xFF, 0xD7, 0xFF, 0xC9, 0x70,
+    0xAF, 0xCA, 0x97, 0x77, 0x10, 0x4A, 0x97, 0x1A, 0xC9, 0x71, 0xAA, 0x97, 0x77, 0x1A, 0x1C, 0xA3,
+    0xAC, 0x9A, 0x1C, 0xA3, 0xE2, 0xC9, 0x3D, 0x29, 0xC3, 0x9C, 0x92, 0xAC, 0x3A, 0xC3, 0xD3, 0xD3,
+    0xD2, 0xAC, 0xA3, 0xFE, 0xA3, 0xFE, 0x93, 0x9E, 0x9A, 0xC3, 0x70, 0x9A, 0x97, 0x69, 0x0A, 0x97,
+    0x6A, 0xA7, 0x79, 0x77, 0x77, 0x77, 0x77, 0xAD, 0x5D, 0xA9, 0xC3, 0xE4, 0x9F, 0xA3, 0xD9, 0x4A,
+    0xD9, 0x93, 0x9D, 0x5D, 0xA5, 0xAD, 0x5D, 0x95, 0xDA, 0x49, 0xD6, 0xD5, 0xAC, 0xA5, 0x9D, 0x5D,
+    0x95, 0x9C, 0xA5, 0xD6, 0xAC, 0xA4, 0xAC, 0xA6, 0xE9, 0x2A, 0xD9, 0x6F, 0xFD, 0x7F, 0xFC, 0x97,
+    0x0A, 0xFC, 0xA9, 0x77, 0x71, 0x5A, 0xAA, 0x72, 0xC7, 0x1C, 0x77, 0x77, 0x6A, 0x1C, 0xA3, 0xAC,
+    0x9A, 0x1C, 0xA3, 0xE2, 0xC9, 0x3D, 0x29, 0xC3, 0x9C, 0x92, 0xAC, 0x3A, 0xC3, 0xD3, 0xD3, 0xD2,
+    0xAC, 0xA3, 0xFE, 0xA3, 0xFE, 0x93, 0x9E, 0x9A, 0xC3, 0x7A, 0xA1, 0xA7, 0x3A, 0x99, 0x90, 0xC7,
+    0x3C, 0x1D, 0x97, 0x77, 0x77, 0x77, 0x09, 0x3A, 0xD5, 0xDA, 0x9C, 0x3E, 0x49, 0xFA, 0x3D, 0x94,
+    0xAD, 0x99, 0x39, 0xD5, 0xDA, 0x5A, 0xD5, 0xD9, 0x5D, 0xA4, 0x9D, 0x6D, 0x5A, 0xCA, 0x59, 0xD5,
+    0xD9, 0x59, 0xCA, 0x5D, 0x6A, 0xCA, 0x4A, 0xCA, 0x6E, 0x92, 0xAD, 0x96, 0xFF, 0xD7, 0xFF, 0xC9,
+    0x70, 0xAF, 0xCA, 0x97, 0x77, 0x10, 0x39, 0xCA, 0x1C, 0x5C, 0x0A, 0x99, 0xA5, 0xA1, 0xD7, 0x77,
+    0x1A, 0x1C, 0xA3, 0xAC, 0x9A, 0x1C, 0xA3, 0xE2, 0xC9, 0x3D, 0x29, 0xC3, 0x9C, 0x92, 0xAC, 0x3A,
+    0xC3, 0xD3, 0xD3, 0xD2, 0xAC, 0xA3, 0xFE, 0xA3, 0xFE, 0x93, 0x9E, 0x9A, 0xC3, 0x77, 0x4A, 0xD5,
+    0xDA, 0x9C, 0x3E, 0x49, 0xFA, 0x3D, 0x94, 0xAD, 0x99, 0x39, 0xD5, 0xDA, 0x5A, 0xD5, 0xD9, 0x5D,
+    0xA4, 0x9D, 0x6D, 0x5A, 0xCA, 0x59, 0xD5, 0xD9, 0x59, 0xCA, 0x5D, 0x6A, 0xCA, 0x4A, 0xCA, 0x6E,
+    0x92, 0xAD, 0x96, 0xFF, 0xD7, 0xFF, 0xC9, 0x70, 0xAF, 0xCA, 0x97, 0x77, 0x77, 0x69, 0xCA, 0x76,
+    0xD9, 0x76, 0xAA, 0x74, 0x77, 0x6A, 0x1C, 0xA3, 0xAC, 0x9A, 0x1C, 0xA3, 0xE2, 0xC9, 0x3D, 0x29,
+    0xC3, 0x9C, 0x92, 0xAC, 0x3A, 0xC3, 0xD3, 0xD3, 0xD2, 0xAC, 0xA3, 0xFE, 0xA3, 0xFE, 0x93, 0x9E,
+    0x9A, 0xC7, 0x71, 0xAA, 0x70, 0x9D, 0x70, 0xE7, 0x39, 0xC9, 0x71, 0xAC, 0x97, 0x19, 0x97, 0x77,
+    0x39, 0xCA, 0x5A, 0xCA, 0x0D, 0x49, 0xD1, 0xD9, 0x3D, 0x2A, 0xCA, 0x2D, 0x92, 0xAD, 0x1D, 0x93,
+    0x9D, 0x0A, 0xCA, 0x5F, 0xC6, 0xF7, 0xAD, 0x97, 0xAD, 0x70, 0xDA, 0x7A, 0xD9, 0x7E, 0x7A, 0xE7,
+    0x59, 0xA7, 0x3D, 0x72, 0x9A, 0xA7, 0x77, 0x77, 0x4A, 0xC4, 0xD3, 0x9C, 0x92, 0x9C, 0x94, 0xCA,
+    0x2D, 0x5D, 0x19, 0xC9, 0x5D, 0x1D, 0x6A, 0xCA, 0xAC, 0x96, 0x9F, 0x70, 0xEA, 0x70, 0xE7, 0x1D,
+    0xA7, 0x09, 0xD7, 0x0A, 0xD9, 0x59, 0xF9, 0x6A, 0xDA, 0x77, 0x50, 0x19, 0xCA, 0x5A, 0xCA, 0x2D,
+    0x49, 0xD3, 0xD9, 0x3D, 0x4A, 0xCA, 0x2D, 0x94, 0xAD, 0x1D, 0x95, 0x9D, 0x0A, 0xCA, 0x7F, 0xC7,
+    0x0F, 0x71, 0xAD, 0x97, 0x1A, 0xD7, 0x2D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x1A, 0xE7, 0x77, 0x77,
+    0x77, 0x70, 0x9A, 0x97, 0x2D, 0x97, 0x19, 0xD9, 0x71, 0x2A, 0xC4, 0xD3, 0x9C, 0x92, 0x9C, 0x94,
+    0xCA, 0x2D, 0x5D, 0x19, 0xC9, 0x5D, 0x1D, 0x6A, 0xCA, 0xAC, 0x96, 0x9F, 0x70, 0xEA, 0x70, 0xE7,
+    0x1D, 0xA7, 0x09, 0xD7, 0x0A, 0xD9, 0x59, 0xF9, 0x2A, 0x91, 0xAD, 0xA3, 0xD9, 0x71, 0xD9, 0x10,
+    0x69, 0x97, 0x09, 0x0A, 0x97, 0x0A, 0xA7, 0x19, 0x77, 0x77, 0x79, 0xCA, 0x5A, 0xCA, 0x0D, 0x49,
+    0xD1, 0xD9, 0x3D, 0x2A, 0xCA, 0x2D, 0x92, 0xAD, 0x1D, 0x93, 0x9D, 0x0A, 0xCA, 0x5F, 0xC6, 0xF7,
+    0xAD, 0x97, 0xAD, 0x70, 0xDA, 0x7A, 0xD9, 0x7E, 0x7A, 0xE7, 0x79, 0xA9, 0x71, 0x90, 0xC9, 0x71,
+    0xAA, 0x72, 0x97, 0x77, 0x77, 0x77, 0x1A, 0xC4, 0xD3, 0x9C, 0x92, 0x9C, 0x94, 0xCA, 0x2D, 0x5D,
+    0x19, 0xC9, 0x5D, 0x1D, 0x6A, 0xCA, 0xAC, 0x96, 0x9F, 0x70, 0xEA, 0x70, 0xE7, 0x1D, 0xA7, 0x09,
+    0xD7, 0x0A, 0xD9, 0x59, 0xF9, 0x6A, 0xDA, 0x77, 0x50, 0x4D, 0x1A, 0x5A, 0x99, 0xA0, 0xC5, 0xC1,
+    0xAC, 0x97, 0x77, 0x75, 0x9C, 0xA5, 0xAC, 0xA0, 0xD4, 0x9D, 0x1D, 0x93, 0xD2, 0xAC, 0xA2, 0xD9,
+    0x2A, 0xD1, 0xD9, 0x39, 0xD0, 0xAC, 0xA5, 0xFC, 0x6F, 0x7A, 0xD9, 0x7A, 0xD7, 0x0D, 0xA7, 0xAD,
+    0x97, 0xE7, 0xAE, 0x70, 0x6A, 0xA1, 0xA6, 0xC9, 0xA9, 0x0C, 0x6C, 0x1D, 0x77, 0x77, 0x77, 0x70,
+    0xAC, 0x4D, 0x39, 0xC9, 0x29, 0xC9, 0x4C, 0xA2, 0xD5, 0xD1, 0x9C, 0x95, 0xD1, 0xD6, 0xAC, 0xAA,
+    0xC9, 0x69, 0xF7, 0x0E, 0xA7, 0x0E, 0x71, 0xDA, 0x70, 0x9D, 0x70, 0xAD, 0x95, 0x9F, 0x96, 0xAD,
+    0xA7, 0x75, 0x0A, 0xAA, 0xAA, 0xAA, 0x09, 0xFE, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0x09, 0xFE, 0x00,
+    0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xE9, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F,
+    0xFD, 0x74, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0xFF, 0xFE, 0xA7, 0x70, 0x0A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0xFF, 0xFE, 0xA7, 0x70, 0x39, 0xC2, 0x9A, 0x3A,
+    0xA2, 0xA9, 0x3C, 0x92, 0xC4, 0xC2, 0x9C, 0x39, 0xA2, 0xAA, 0x3C, 0x92, 0xC4, 0xC3, 0xC3, 0x9C,
+    0x2A, 0xA3, 0xAA, 0x2C, 0x93, 0xC3, 0xC4, 0xC2, 0x9A, 0x3A, 0xA2, 0xA9, 0x3C, 0x92, 0xC4, 0xC2,
+    0x9C, 0x76, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xAF, 0xFE, 0x77, 0x74, 0x9F, 0xFE, 0x90,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x10, 0x09, 0x93, 0xDA, 0x2A, 0xD3, 0xD9, 0x2A, 0xD3, 0xAA,
+    0x00, 0x1A, 0xD2, 0xDA, 0x19, 0xD2, 0xDA, 0x19, 0xAA, 0x20, 0x29, 0x92, 0xE1, 0x9D, 0x91, 0xAD,
+    0x2D, 0x91, 0x9A, 0xA2, 0x09, 0x93, 0xDA, 0x2A, 0xD3, 0xD9, 0x2A, 0xD3, 0xAA, 0x00, 0x09, 0x91,
+    0x99, 0x3D, 0xA0, 0xDA, 0x2A, 0xD0, 0xAD, 0x3D, 0x90, 0xD3, 0xAD, 0x0A, 0xD3, 0xAA, 0x1A, 0xA0,
+    0x29, 0x91, 0x99, 0x2A, 0xD0, 0xE2, 0xDA, 0x0D, 0x91, 0x9D, 0x09, 0xD2, 0xD9, 0x0D, 0x91, 0x9A,
+    0xA0, 0x9A, 0xA2, 0x29, 0x92, 0xE1, 0x9D, 0x91, 0xAD, 0x2D, 0x91, 0x9A, 0xA2, 0x0D, 0xA0, 0xDA,
+    0x2A, 0xD0, 0xAD, 0x3D, 0x90, 0xD9, 0x2A, 0xD0, 0xAD, 0x3A, 0xA9, 0x0A, 0xA9, 0x4C, 0x96, 0xC9,
+    0x59, 0xC6, 0xAC, 0x6C, 0x96, 0xC6, 0x9C, 0x99, 0x90, 0x9F, 0xE9, 0x99, 0x0C, 0xA6, 0xC6, 0x9C,
+    0x6A, 0xA6, 0xC9, 0x6C, 0x69, 0xC6, 0xAA, 0x6C, 0x96, 0xC6, 0x9C, 0x69, 0xA7, 0x97, 0x70, 0x6A,
+    0xA7, 0x0C, 0x97, 0x0C, 0x70, 0x9C, 0x70, 0xAA, 0x70, 0xC9, 0x70, 0xC9, 0x99, 0x3F, 0xEA, 0x29,
+    0x0C, 0xA7, 0x0C, 0x97, 0x0C, 0x70, 0x9C, 0x70, 0xAA, 0x69, 0x9C, 0xA9, 0x93, 0xFD, 0xA5, 0x9C,
+    0x70, 0xAA, 0x70, 0xC9, 0x79, 0xC7, 0x09, 0xC7, 0x1A, 0x77, 0x10, 0x49, 0x99, 0x99, 0x93, 0xFD,
+    0xA2, 0x9F, 0xDA, 0x2F, 0xE9, 0x2F, 0xE9, 0x1A, 0xFE, 0x2F, 0xF1, 0xAF, 0xF1, 0xFF, 0xC0, 0xAF,
+    0xFA, 0x00, 0x5C, 0x91, 0x9D, 0xA0, 0xAD, 0xA0, 0xAA, 0x70, 0x1A, 0xA0, 0x9C, 0xA0, 0xDA, 0x1A,
+    0xA0, 0x9C, 0xA0, 0xDA, 0x1A, 0xA3, 0xAA, 0x29, 0xA1, 0x9C, 0xA2, 0xAC, 0xA2, 0xD1, 0xDA, 0x2D,
+    0x91, 0xAD, 0x00, 0x0A, 0x99, 0xC9, 0x73, 0xA4, 0x99, 0x4C, 0x4A, 0x09, 0x3A, 0x94, 0xA9, 0xA2,
+    0xAA, 0x5C, 0x0A, 0x19, 0xC6, 0xD1, 0x9C, 0x73, 0xC7, 0x3C, 0x97, 0x2C, 0xA7, 0x2A, 0xA7, 0x2A,
+    0xC0, 0x99, 0x79, 0xC0, 0x99, 0x99, 0x99, 0x39, 0xC9, 0x0A, 0x99, 0xA9, 0x93, 0xCA, 0x1A, 0xA0,
+    0xAA, 0x77, 0x10, 0x1A, 0xD2, 0xDA, 0x19, 0xD2, 0xDA, 0x19, 0xAA, 0x20, 0x29, 0x91, 0x99, 0x2A,
+    0xD0, 0xE2, 0xDA, 0x0D, 0x91, 0x9D, 0x09, 0xD2, 0xD9, 0x0D, 0x91, 0x9A, 0xA0, 0x9A, 0xA2, 0x74,
+    0x9A, 0x2C, 0x91, 0xC9, 0x0D, 0x19, 0xC1, 0x9C, 0x90, 0xC9, 0x1C, 0xA1, 0xAC, 0x09, 0xA2, 0xC2,
+    0xC9, 0x74, 0x4C, 0x2C, 0x91, 0xAA, 0x2C, 0x40, 0x70, 0xAA, 0x09, 0xC2, 0xD0, 0x9C, 0x91, 0x9C,
+    0x1C, 0xA2, 0xA9, 0x09, 0xC7, 0x00, 0x74, 0xC2, 0xC9, 0x1A, 0xA1, 0xC9, 0x1C, 0xA1, 0xAC, 0x1A,
+    0xA1, 0xAC, 0x2C, 0x2C, 0x2C, 0x2A, 0x97, 0x30, 0x2A, 0xC3, 0xAA, 0xC9, 0x09, 0xC9, 0x09, 0xC9,
+    0x49, 0x29, 0xC9, 0x1A, 0xC2, 0xCA, 0x29, 0xD3, 0xAC, 0xA3, 0xD4, 0x91, 0x94, 0x9C, 0x94, 0xCA,
+    0x4A, 0xC3, 0xD9, 0x1D, 0xA2, 0xD3, 0x92, 0x76, 0xAA, 0x73, 0xD9, 0x4D, 0x0D, 0xA7, 0xAD, 0x3A,
+    0xF9, 0x71, 0xDA, 0x39, 0xD9, 0x72, 0xE2, 0xE7, 0x49, 0xE9, 0xE7, 0x39, 0xA9, 0xFD, 0x4A, 0x95,
+    0xD9, 0x9E, 0xA4, 0xAC, 0xA4, 0x9D, 0x9A, 0xE9, 0x4D, 0x97, 0xFD, 0x75, 0x9E, 0x9E, 0x97, 0x3A,
+    0xE1, 0xAE, 0x72, 0xF3, 0xEA, 0x70, 0xEA, 0x39, 0xF6, 0x9E, 0xA4, 0xFC, 0xA7, 0x6A, 0xD7, 0x72,
+    0x99, 0x97, 0x00, 0x69, 0x69, 0xC6, 0xAC, 0x6C, 0xA5, 0x9C, 0x95, 0xAC, 0x6D, 0x59, 0xC9, 0x5A,
+    0xC6, 0xD5, 0x9C, 0xA5, 0xAC, 0x96, 0x95, 0x99, 0x6D, 0x94, 0xAD, 0x94, 0xE4, 0x6A, 0x71, 0xAC,
+    0x79, 0xFA, 0x4A, 0xEA, 0xDA, 0x39, 0x09, 0xC1, 0xD5, 0xAC, 0x1D, 0x5C, 0xA1, 0xCA, 0x49, 0xCA,
+    0x0A, 0xC9, 0x4A, 0xC9, 0x9C, 0xA5, 0xDA, 0xD6, 0xF6, 0x9D, 0xA7, 0xAC, 0xA7, 0x0D, 0x97, 0x0D,
+    0x71, 0x97, 0x1A, 0xA7, 0x09, 0xD7, 0x0A, 0xD7, 0x0E, 0x79, 0xE7, 0x0A, 0xAA, 0xAA, 0xAA, 0x09,
+    0xFE, 0x00, 0x70, 0xC3, 0xA9, 0x0D, 0xAA, 0xCA, 0x2E, 0x91, 0x77, 0x1A, 0x70, 0xA9, 0xA9, 0xA7,
+    0xAC, 0x97, 0xAA, 0xAA, 0x97, 0xA7, 0x0A, 0x3A, 0x09, 0x09, 0xA9, 0xAA, 0x9A, 0xAC, 0xA9, 0x19,
+    0xD2, 0xAC, 0x91, 0xAA, 0xA9, 0xC9, 0xA9, 0x99, 0x92, 0xA3, 0x97, 0x70, 0x73, 0x97, 0x3A, 0xA7,
+    0x29, 0xA7, 0x29, 0xC7, 0x29, 0xC7, 0x3C, 0x73, 0xC9, 0x72, 0xC9, 0x72, 0xAA, 0x72, 0xAC, 0x72,
+    0xAC, 0x72, 0x9C, 0x72, 0x9C, 0x97, 0x2C, 0x97, 0x20, 0x77, 0x69, 0xAE, 0x93, 0xAE, 0xA3, 0x9D,
+    0xAA, 0xDA, 0x09, 0xDA, 0xAE, 0x29, 0x93, 0xD1, 0x93, 0xD7, 0x0D, 0x6A, 0xC7, 0x0D, 0x6D, 0x7A,
+    0xC9, 0x59, 0xCA, 0x69, 0xD6, 0xD6, 0x9D, 0x6D, 0x94, 0x9E, 0x5A, 0xD9, 0x49, 0xDA, 0x5E, 0x6A,
+    0xCA, 0x59, 0xD7, 0xD9, 0x5A, 0xCA, 0x7D, 0x6D, 0x97, 0x97, 0x99, 0x77, 0x73, 0xD6, 0xAC, 0x97,
+    0xD6, 0xD9, 0x69, 0xAA, 0x59, 0xAA, 0x70, 0x77, 0x09, 0xAE, 0x96, 0xAC, 0xAA, 0xAD, 0x92, 0x91,
+    0xA9, 0x29, 0xD1, 0xCA, 0x7D, 0x1C, 0x97, 0xCA, 0x09, 0xC7, 0xAC, 0x90, 0xD6, 0x9C, 0xA1, 0xCA,
+    0x59, 0xD1, 0x9C, 0x94, 0xAD, 0x2D, 0x39, 0xE3, 0xD3, 0xAC, 0xA3, 0x9C, 0xA3, 0xD9, 0x3D, 0x93,
+    0xD4, 0xD3, 0x9A, 0x94, 0x99, 0x72, 0x99, 0x4A, 0xA3, 0x9D, 0x4D, 0x3E, 0x3A, 0xD2, 0x9E, 0x30,
+    0x77, 0x72, 0xAE, 0xA7, 0x2D, 0xAA, 0xE7, 0xA0, 0xA3, 0xAC, 0x95, 0xAC, 0x59, 0xC9, 0x5C, 0xA5,
+    0xAC, 0x94, 0x9C, 0x95, 0xD5, 0xAC, 0x5A, 0xC9, 0x5D, 0x4A, 0xCA, 0x59, 0xC9, 0x29, 0xDA, 0x6A,
+    0xC2, 0xEA, 0x7D, 0x2D, 0x97, 0x9C, 0xA1, 0x9D, 0x70, 0xAC, 0x91, 0xAC, 0xA7, 0x0D, 0x2A, 0xA7,
+    0x29, 0x75, 0x99, 0x3A, 0xA7, 0x9D, 0x2A, 0xCA, 0x7E, 0x2D, 0x96, 0x9E, 0x74, 0x76, 0x97, 0x6A,
+    0xA7, 0x6C, 0x76, 0xCA, 0x75, 0x9C, 0x76, 0xCA, 0x71, 0xAC, 0x90, 0x9C, 0x72, 0xD1, 0xC9, 0x71,
+    0x9A, 0xA0, 0xAC, 0x76, 0xC9, 0x75, 0xD7, 0x59, 0xC7, 0x6C, 0xA7, 0x59, 0xC7, 0x6C, 0xA7, 0x5A,
+    0xC0, 0xAC, 0x73, 0xC9, 0x0D, 0x72, 0xAC, 0x09, 0xAA, 0x71, 0x9C, 0x97, 0x5D, 0x75, 0x9C, 0x97,
+    0x5D, 0x75, 0xAC, 0x76, 0xCA, 0x75, 0xAA, 0x77, 0x76, 0x29, 0x3A, 0x0A, 0x1A, 0x1A, 0x1A, 0x90,
+    0xA0, 0x9A, 0x0A, 0x90, 0x9E, 0x29, 0x92, 0x7A, 0x91, 0x9A, 0x90, 0x90, 0xC0, 0x9E, 0xA1, 0xAA,
+    0x00, 0x1A, 0xAA, 0x19, 0x93, 0xA4, 0xAA, 0xA9, 0x3A, 0x90, 0xAD, 0xA7, 0x2A, 0xA2, 0xA3, 0xCA,
+    0xA2, 0xC0, 0x9A, 0x09, 0xA0, 0x99, 0x1D, 0xA7, 0x0A, 0xAA, 0x92, 0x99, 0x2C, 0x2A, 0xA2, 0xC2,
+    0xAC, 0x2A, 0x91, 0x29, 0x3A, 0x0A, 0x19, 0x90, 0xC1, 0x9D, 0x2A, 0x1A, 0x0A, 0xA0, 0xAA, 0x1A,
+    0xA9, 0x10, 0x29, 0x92, 0xA0, 0xC1, 0xA1, 0xA1, 0xC1, 0xC1, 0x9C, 0xAC, 0x3A, 0x90, 0x9D, 0xA1,
+    0x69, 0x94, 0x9F, 0xD3, 0xAD, 0x19, 0xC9, 0x2D, 0x29, 0xC9, 0x19, 0xCA, 0x29, 0xC9, 0x1A, 0xC3,
+    0xD2, 0xD3, 0xD1, 0x9D, 0x29, 0xCA, 0x1A, 0xCA, 0x2A, 0xCA, 0x1D, 0x92, 0xD9, 0x00, 0x49, 0x5A,
+    0x90, 0xA9, 0x29, 0xA1, 0x9A, 0x2C, 0x0A, 0x09, 0xA1, 0x9C, 0x0C, 0x0A, 0x91, 0xAA, 0x2C, 0x2A,
+    0xC1, 0xCA, 0x2A, 0xF4, 0xDA, 0x30, 0x6A, 0xC3, 0xC2, 0x99, 0x2A, 0x3C, 0x1A, 0xE0, 0x19, 0xAA,
+    0x29, 0x0A, 0x93, 0xA9, 0x29, 0xC2, 0xAC, 0x2D, 0x91, 0x9E, 0x90, 0x19, 0x99, 0x49, 0x93, 0x92,
+    0xAC, 0xA4, 0xC1, 0x90, 0xAA, 0x09, 0xDA, 0x10, 0x70, 0x9C, 0x29, 0x9A, 0x19, 0x99, 0x91, 0xF3,
+    0xC3, 0x9C, 0x10, 0x1A, 0xAA, 0x29, 0x39, 0x49, 0xAA, 0x93, 0xA9, 0x09, 0xDA, 0x70, 0x29, 0xA9,
+    0x1A, 0x92, 0xAA, 0xA9, 0x1C, 0xA0, 0xC1, 0xC1, 0xC1, 0xC0, 0x9A, 0x1A, 0xCA, 0x10, 0x0A, 0xAA,
+    0xA3, 0x9A, 0x3C, 0x39, 0xC3, 0xC9, 0x29, 0xC3, 0xA9, 0x20, 0x39, 0x2A, 0x1A, 0x1C, 0x0A, 0x91,
+    0xDA, 0x1C, 0x1C, 0x1C, 0x09, 0xC1, 0xAC, 0xA1, 0x29, 0x92, 0xA0, 0xA9, 0x09, 0x90, 0x9A, 0x0A,
+    0x90, 0xA9, 0x1A, 0xAC, 0x39, 0xA1, 0xE1, 0x6C, 0xA5, 0xAC, 0x59, 0xC6, 0xC9, 0x5D, 0x59, 0xC6,
+    0xCA, 0x59, 0xC6, 0xCA, 0x59, 0xC9, 0x5A, 0xC6, 0xCA, 0x6C, 0xA5, 0x9C, 0x95, 0x9C, 0x69, 0xC6,
+    0x9C, 0x69, 0xC6, 0x9C, 0x95, 0x9C, 0x96, 0xCA, 0x6D, 0x69, 0x95, 0x9C, 0x70, 0xAC, 0x70, 0xCA,
+    0x70, 0xC9, 0x7A, 0xC7, 0x0C, 0xA7, 0x9C, 0x97, 0xCA, 0x79, 0xC7, 0x0C, 0xA7, 0xAC, 0x79, 0xC7,
+    0x0C, 0x97, 0xCA, 0x7C, 0xA7, 0xCA, 0x7C, 0xA7, 0xCA, 0x7C, 0xA7, 0xCA, 0x69, 0xCA, 0x69, 0xC9,
+    0x69, 0x91, 0x77, 0x72, 0xC1, 0xCA, 0x71, 0xCA, 0x09, 0xC7, 0x19, 0xC1, 0xCA, 0x71, 0xFC, 0xA7,
+    0xAF, 0xD9, 0x6E, 0xA0, 0xAC, 0x7F, 0x1C, 0x96, 0xDA, 0xCA, 0x0A, 0xC6, 0x9D, 0x9C, 0x1C, 0x96,
+    0xD9, 0xCA, 0x0A, 0xC6, 0x9D, 0x9C, 0x1C, 0x96, 0xAE, 0xA0, 0xAC, 0x7F, 0x1C, 0x97, 0xF0, 0xAC,
+    0x19, 0x5F, 0xFD, 0x5A, 0xFF, 0xA5, 0xAF, 0xF9, 0x5C, 0xAF, 0xDA, 0x5A, 0xC1, 0xC9, 0x71, 0xC9,
+    0x0A, 0xC7, 0x1A, 0xC1, 0xC7, 0x29, 0x29, 0x72, 0x77, 0x59, 0xAE, 0x95, 0xAF, 0xD9, 0x4E, 0x97,
+    0x0D, 0xA7, 0x1A, 0xCA, 0x71, 0x9D, 0x72, 0xD9, 0x72, 0xD3, 0xCA, 0xCA, 0x2A, 0xD3, 0xDA, 0x92,
+    0xE2, 0xAC, 0x5E, 0xA1, 0xCA, 0x5F, 0xCA, 0xF3, 0xAF, 0xFA, 0x39, 0xFF, 0x94, 0x9F, 0xDA, 0x77,
+    0x10, 0x77, 0x69, 0x97, 0x09, 0xFC, 0x95, 0xAC, 0xA9, 0x1A, 0xC5, 0xCA, 0x73, 0xC9, 0x72, 0xAD,
+    0xAA, 0xAA, 0x59, 0xFE, 0x7C, 0x97, 0x19, 0xAD, 0xAA, 0xA9, 0x5F, 0xE9, 0x7C, 0xA7, 0x2A, 0xC9,
+    0x70, 0xAD, 0x97, 0x0F, 0xCA, 0xAA, 0x94, 0xFF, 0xCA, 0x20, 0x75, 0x99, 0x5A, 0xCA, 0x5D, 0x5E,
+    0x4A, 0xCA, 0x49, 0xE9, 0x3D, 0x5A, 0xE9, 0x29, 0xD5, 0xDA, 0xCA, 0x2A, 0xCA, 0x49, 0xD9, 0xD2,
+    0xD9, 0x4A, 0xCA, 0x0D, 0x19, 0xD3, 0xFF, 0xFE, 0x90, 0x9A, 0xD9, 0x9E, 0xAD, 0xA9, 0x92, 0xE1,
+    0xAC, 0xA9, 0xD5, 0xDA, 0x19, 0xDA, 0xCA, 0x49, 0xD9, 0x2F, 0x94, 0xE3, 0xF5, 0xE3, 0xF4, 0x4F,
+    0xD9, 0x7D, 0xAA, 0xAD, 0xA5, 0xAC, 0x93, 0xD2, 0x9F, 0xFF, 0x39, 0xD3, 0xAC, 0xA4, 0x9C, 0xA2,
+    0x9D, 0x5F, 0xF9, 0x5F, 0xDA, 0x69, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x3D, 0x97, 0x2A, 0xD7, 0x3E,
+    0x73, 0xE7, 0x20, 0x3A, 0xAA, 0x97, 0x59, 0xFC, 0x74, 0xA9, 0x2C, 0x97, 0x3C, 0x92, 0xC9, 0x73,
+    0xC3, 0xC7, 0x39, 0xC1, 0x9D, 0x49, 0xE2, 0xAF, 0xC9, 0x39, 0xC9, 0x99, 0x2F, 0xC9, 0x4A, 0x95,
+    0xEA, 0xD4, 0xCA, 0x49, 0xCA, 0x1A, 0xC4, 0xAD, 0x92, 0xAC, 0x91, 0xAC, 0x5A, 0xD9, 0x1D, 0x2D,
+    0x7C, 0xA1, 0xD2, 0xD3, 0x9A, 0x9A, 0xCA, 0x09, 0xD2, 0xD3, 0xFC, 0x1A, 0xCA, 0x19, 0xD3, 0xAE,
+    0x91, 0x2A, 0xA6, 0xAA, 0x2C, 0xA6, 0xC9, 0x2C, 0xA5, 0x9C, 0x3C, 0x95, 0xAA, 0x3C, 0x91, 0xC9,
+    0x1C, 0x91, 0xAF, 0xFE, 0xA0, 0xAA, 0xDA, 0xEA, 0xDA, 0x3C, 0x99, 0xDA, 0x0C, 0xA4, 0xC9, 0xAC,
+    0xAC, 0x0C, 0x5C, 0xAC, 0xAA, 0xCA, 0xC5, 0xE0, 0xAD, 0xA5, 0xE0, 0x9D, 0x95, 0xD9, 0x09, 0xD6,
+    0xD1, 0x9D, 0x6C, 0xA1, 0x9C, 0xA3, 0x3A, 0x99, 0x74, 0x9F, 0xD9, 0x39, 0x3A, 0xD9, 0x99, 0xD2,
+    0xAC, 0x3D, 0x4C, 0x91, 0xCA, 0x3C, 0x94, 0xC9, 0x1C, 0x92, 0x9C, 0x19, 0xA1, 0xC9, 0x09, 0xC3,
+    0xAC, 0x1C, 0xA0, 0x9C, 0x1A, 0xC3, 0xCA, 0x1C, 0x90, 0xAC, 0x1C, 0xA3, 0xC9, 0x1C, 0x5C, 0x92,
+    0x9C, 0x19, 0xC4, 0xAC, 0x3A, 0xC2, 0xCA, 0x29, 0xD3, 0xC9, 0x2A, 0xFD, 0xA7, 0x29, 0xAA, 0xD9,
+    0x20, 0x70, 0x99, 0x72, 0xC9, 0x7A, 0xFC, 0x69, 0x9D, 0x99, 0x4A, 0xD0, 0xC9, 0x5C, 0xA9, 0xE5,
+    0xAA, 0x2D, 0x5C, 0x3C, 0x94, 0xAA, 0x2A, 0xC5, 0xAC, 0x90, 0x9D, 0x59, 0xFC, 0xA6, 0xAD, 0xAA,
+    0x95, 0x99, 0x99, 0x99, 0x99, 0x4F, 0xF3, 0x77, 0x59, 0x97, 0x9F, 0xCA, 0x49, 0xD9, 0x70, 0xD7,
+    0x2C, 0xA0, 0x95, 0xAF, 0xD9, 0x6D, 0x71, 0x9C, 0xA0, 0x95, 0xFE, 0x96, 0xAC, 0x97, 0x1A, 0xC7,
+    0x2A, 0xD7, 0x1A, 0xFC, 0xA6, 0xAF, 0x97, 0x19, 0x93, 0x0A, 0xFF, 0xE1, 0xFF, 0xEA, 0x59, 0xCA,
+    0x72, 0xAC, 0x97, 0x2F, 0x96, 0x9A, 0xDA, 0x96, 0xAE, 0xA7, 0x09, 0x0F, 0xA7, 0xAE, 0x96, 0x9F,
+    0x70, 0x90, 0xDA, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xE7, 0x00, 0x4F, 0xD9, 0x71, 0xDA, 0xAA, 0xDA,
+    0x79, 0xC9, 0x3D, 0x5A, 0xAD, 0xAA, 0xAA, 0xAD, 0xAA, 0xA2, 0xAA, 0xDA, 0xAA, 0xAA, 0xDA, 0xA9,
+    0x39, 0xCA, 0x29, 0xD7, 0xAF, 0xE9, 0x7F, 0xDA, 0x97, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x75, 0xD9,
+    0x74, 0xAD, 0x75, 0xE7, 0x5E, 0x74, 0x77, 0x7C, 0x73, 0x9A, 0x72, 0x9D, 0x99, 0x59, 0xFF, 0x3E,
+    0xA9, 0xC2, 0x92, 0xAD, 0x19, 0xC5, 0x9D, 0x91, 0xAA, 0x5A, 0xD2, 0xC9, 0x5D, 0x92, 0xC5, 0x9D,
+    0x3C, 0x94, 0x9D, 0x29, 0xFC, 0xA0, 0xAC, 0xA2, 0xAA, 0x99, 0xE0, 0xE2, 0xC9, 0x1C, 0x91, 0xEA,
+    0x1C, 0x09, 0xD9, 0x1A, 0xFF, 0xD3, 0xFF, 0xD4, 0xAF, 0xCA, 0x97, 0x0C, 0x74, 0xC7, 0x74, 0x59,
+    0xFC, 0xA7, 0x3A, 0xFE, 0x76, 0x9A, 0xD7, 0x70, 0xD9, 0x77, 0xAC, 0x77, 0x0D, 0x70, 0xFF, 0xFD,
+    0x92, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x75, 0xAF, 0xFF, 0xD9, 0x19, 0xFA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x29, 0xEA, 0x90, 0x99, 0x9A, 0x79, 0xFF, 0xD9, 0x7A, 0xFF, 0xD7, 0x09,
+    0xAF, 0xDA, 0x97, 0x77, 0x00, 0x76, 0xC7, 0xC5, 0xAE, 0x29, 0xEA, 0xA2, 0xD0, 0xC3, 0x9C, 0x90,
+    0xC3, 0xD0, 0x9A, 0x3C, 0xA0, 0xA9, 0x3C, 0xA0, 0xC4, 0xDA, 0xC4, 0xFC, 0xA3, 0xAF, 0x4A, 0x40,
+    0x2F, 0xFE, 0xA7, 0x77, 0x71, 0xAF, 0xFE, 0x3A, 0xAA, 0xAA, 0xD9, 0xAA, 0xA9, 0x79, 0xCA, 0x74,
+    0xD7, 0x5D, 0x74, 0xAC, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x39, 0xD9, 0x73,
+    0xAD, 0x72, 0x73, 0xAF, 0xE4, 0xAA, 0x79, 0xC3, 0x9F, 0xE4, 0xAC, 0x4E, 0xA9, 0x4E, 0xA7, 0xAC,
+    0x7A, 0xC9, 0x6D, 0x96, 0xD9, 0x59, 0xD9, 0x30, 0x75, 0xC9, 0x69, 0xC0, 0x9A, 0x93, 0xAF, 0x29,
+    0xE9, 0x4C, 0xAC, 0x90, 0x99, 0x39, 0xF3, 0xAE, 0x93, 0xEA, 0x2A, 0xC2, 0xC9, 0x1D, 0x29, 0xCA,
+    0xAC, 0xA3, 0xAD, 0xA7, 0x60, 0x59, 0xA7, 0x1A, 0xA7, 0x09, 0xCA, 0x7F, 0xC9, 0x4F, 0xAC, 0xA3,
+    0xAC, 0x9A, 0xA0, 0xD3, 0xD0, 0xC9, 0x0A, 0xA3, 0xC9, 0x0C, 0x1C, 0x92, 0x9C, 0x1C, 0x1C, 0x3A,
+    0xA0, 0x9A, 0x09, 0xC3, 0xC9, 0x0A, 0x90, 0xAA, 0x3C, 0x1C, 0x1C, 0x92, 0x9C, 0x1C, 0x09, 0xC3,
+    0x6F, 0xCA, 0x97, 0x0D, 0xAA, 0xAD, 0xA6, 0x9C, 0x93, 0xD6, 0xD4, 0xD6, 0xD4, 0xCA, 0x59, 0xCA,
+    0x29, 0xD3, 0xAF, 0xFD, 0x93, 0xFF, 0xCA, 0x94, 0x99, 0xAD, 0x71, 0xAA, 0xAE, 0xAA, 0xA5, 0x9F,
+    0xFC, 0x70, 0x9D, 0x97, 0x3A, 0xD7, 0x4E, 0x74, 0xE7, 0x10, 0x39, 0x97, 0x0C, 0x70, 0xC9, 0x7A,
+    0xC3, 0x9C, 0x91, 0xC9, 0x9A, 0xEA, 0x1F, 0xA9, 0x39, 0xD7, 0x09, 0xD7, 0x1D, 0x71, 0xC7, 0x70,
+    0x59, 0x97, 0xE9, 0x49, 0xCA, 0xCA, 0xC9, 0x2A, 0xC0, 0x9C, 0x0A, 0xC1, 0xCA, 0x1A, 0xA1, 0xCA,
+    0x4C, 0x97, 0x9C, 0x70, 0xAA, 0x70, 0xC9, 0x70, 0xC5, 0x4A, 0x71, 0xAA, 0x71, 0xC9, 0x2A, 0xA9,
+    0x3C, 0x29, 0xAE, 0xA9, 0xAC, 0x59, 0xAE, 0xA7, 0x9D, 0x69, 0xCA, 0x69, 0xCA, 0x7A, 0xA7, 0x60,
+    0x29, 0xC7, 0x1C, 0x71, 0xC9, 0x70, 0xAA, 0x70, 0x9C, 0x5C, 0x91, 0xC2, 0xC9, 0x1C, 0xA0, 0xCA,
+    0x0D, 0x3A, 0xFC, 0x59, 0xE7, 0x0A, 0x92, 0x77, 0x4A, 0x97, 0xC5, 0x9A, 0x70, 0x9A, 0x4C, 0x29,
+    0xA9, 0xA9, 0x2A, 0x92, 0xAA, 0xAD, 0xA9, 0x09, 0xAD, 0xA9, 0xC1, 0x9D, 0xA9, 0x79, 0xAD, 0x1C,
+    0xA7, 0x29, 0xC9, 0x2C, 0xA7, 0x09, 0xC9, 0x4A, 0x70, 0xA3, 0x4A, 0x59, 0xE3, 0xAA, 0xAA, 0xCA,
+    0x1C, 0x90, 0xC9, 0x0C, 0x93, 0xC6, 0x9A, 0x6A, 0x96, 0xC7, 0xA7, 0xC7, 0xA9, 0x69, 0xA7, 0xC3,
+    0x9C, 0x90, 0xC1, 0xA9, 0x1C, 0xAA, 0xAA, 0xC3, 0x9E, 0x6C, 0x20, 0x39, 0xAA, 0xC1, 0x9E, 0xAA,
+    0x92, 0x9D, 0xA5, 0x9C, 0x0D, 0x93, 0x9C, 0x19, 0xD9, 0x19, 0xC3, 0xAD, 0x1C, 0x5A, 0x90, 0x19,
+    0xCA, 0x99, 0x69, 0x9A, 0xF6, 0x9E, 0x5A, 0xCA, 0x9C, 0x3A, 0xCA, 0x19, 0xC1, 0x9D, 0x92, 0x9C,
+    0x1A, 0x94, 0x9C, 0x00, 0x0A, 0x6C, 0x95, 0xAC, 0x2A, 0x91, 0xC9, 0x1C, 0x2A, 0xC1, 0xC3, 0xC9,
+    0x9A, 0x3A, 0xCA, 0x94, 0xD1, 0xFD, 0x39, 0x9A, 0xA1, 0x49, 0x95, 0xCA, 0x0A, 0x29, 0xC1, 0xA9,
+    0x1C, 0xA1, 0x9A, 0x1C, 0x3C, 0x0A, 0xA3, 0xC9, 0xC4, 0xAC, 0xA4, 0x9F, 0xC9, 0x1A, 0xA9, 0x91,
+    0x76, 0xAC, 0x72, 0xC9, 0x71, 0x9C, 0x72, 0xFF, 0xD9, 0x0A, 0xC7, 0x3C, 0xA7, 0x3F, 0xFD, 0x3D,
+    0x73, 0xD7, 0x39, 0x60, 0x59, 0x09, 0x70, 0xC9, 0x0A, 0xA5, 0x9D, 0x1D, 0x93, 0xAC, 0x9C, 0x1C,
+    0x9C, 0x91, 0xAC, 0x90, 0xA0, 0x9A, 0x0A, 0xC0, 0xAC, 0x19, 0x90, 0xA9, 0x1C, 0x93, 0xA1, 0xC7,
+    0x0C, 0x09, 0xC7, 0x9A, 0x0A, 0xA7, 0xA9, 0x0C, 0x70, 0xC1, 0xC7, 0x0C, 0x09, 0xA5, 0x70, 0x97,
+    0x2A, 0xC7, 0x29, 0xC7, 0x3C, 0xA2, 0xFF, 0xD7, 0x3A, 0xC7, 0x1A, 0xC9, 0x0A, 0xFF, 0xC7, 0x1D,
+    0x71, 0xAC, 0x77, 0x10, 0x2A, 0x1A, 0x70, 0xA1, 0xC7, 0x09, 0x90, 0xA9, 0x70, 0xA0, 0x9A, 0x70,
+    0xC1, 0xC7, 0x0A, 0x1C, 0x4A, 0xA1, 0x9A, 0x0A, 0x91, 0xA9, 0x0D, 0x1C, 0x09, 0xA0, 0x9C, 0x91,
+    0xAC, 0x9C, 0x1C, 0x0C, 0xA3, 0x9D, 0x90, 0xE5, 0x9C, 0xA0, 0xAC, 0x70, 0xA0, 0x97, 0x70, 0x74,
+    0x94, 0xAC, 0x7A, 0xC4, 0xC9, 0x79, 0xC3, 0x9C, 0x71, 0xCA, 0x2F, 0xFF, 0xD1, 0xAC, 0x73, 0xD1,
+    0xCA, 0x71, 0xAC, 0x92, 0xFF, 0xF5, 0xD5, 0xD7, 0xD3, 0xAC, 0x71, 0x97, 0x20, 0x3A, 0xA7, 0x9E,
+    0x95, 0xC9, 0x9E, 0xA2, 0xD0, 0x99, 0x0A, 0xA1, 0xE0, 0x99, 0x39, 0xC0, 0xC0, 0x99, 0x6C, 0x09,
+    0x96, 0xC0, 0x99, 0x6C, 0x09, 0x96, 0xC0, 0x99, 0x39, 0xC0, 0xC0, 0x99, 0x4E, 0x09, 0x95, 0xD0,
+    0x99, 0x0A, 0xA3, 0xC9, 0x9E, 0xA3, 0x9E, 0x96, 0xAA, 0x40, 0x77, 0x5A, 0xCA, 0x72, 0xAC, 0x72,
+    0x9C, 0x72, 0xAA, 0x69, 0x2C, 0x93, 0x9F, 0x09, 0xC3, 0x9C, 0xA1, 0xAA, 0xC9, 0x3C, 0xA3, 0xD3,
+    0x9C, 0x4C, 0xA3, 0xAC, 0x39, 0xC4, 0xAC, 0xA0, 0x9A, 0xC9, 0x49, 0xFC, 0xA6, 0x9E, 0x95, 0x77,
+    0x70, 0xAF, 0x90, 0xAA, 0x5A, 0xDA, 0xAA, 0xF5, 0xE3, 0x9D, 0x94, 0xAD, 0x4E, 0xA3, 0x9D, 0x4C,
+    0xAA, 0xD3, 0xAC, 0x93, 0xCA, 0x09, 0xCA, 0x3D, 0x3C, 0xA1, 0x9C, 0xA2, 0x9C, 0xA2, 0xCA, 0x2A,
+    0xC9, 0x2A, 0xC9, 0x1C, 0xA3, 0xD3, 0xAC, 0x90, 0xCA, 0x3A, 0xCA, 0x3F, 0xA3, 0xAD, 0x93, 0xAE,
+    0xAA, 0xAA, 0xEA, 0x4A, 0xFF, 0xD4, 0x9F, 0xFD, 0x49, 0xC9, 0x09, 0xFA, 0x97, 0x76, 0x77, 0x4D,
+    0x97, 0x0A, 0xDA, 0x79, 0xCA, 0xCA, 0x7D, 0x0D, 0x6D, 0x1D, 0x5A, 0xC9, 0x1D, 0x93, 0x9C, 0xA2,
+    0xAC, 0xA3, 0xD3, 0x9D, 0x2D, 0x93, 0x9D, 0x1A, 0xCA, 0x5D, 0x09, 0xDA, 0xAA, 0xAA, 0xAA, 0xD9,
+    0xAF, 0xFE, 0x00, 0x1A, 0xFF, 0xC3, 0xAC, 0x91, 0xAC, 0x94, 0xD2, 0xAC, 0x5C, 0xA2, 0xCA, 0x49,
+    0xC9, 0x2C, 0x94, 0xAC, 0x29, 0xC5, 0xD2, 0xAC, 0x5C, 0xA2, 0xCA, 0x49, 0xC9, 0x2C, 0x94, 0xAC,
+    0x29, 0xC5, 0xD2, 0xAC, 0x5C, 0xA2, 0xCA, 0x40, 0x0A, 0x92, 0xAA, 0x5D, 0x2A, 0xC5, 0xAC, 0x29,
+    0xC5, 0x9C, 0x92, 0xCA, 0x5C, 0xA2, 0xD5, 0xAC, 0x2A, 0xC5, 0x9C, 0x29, 0xC9, 0x5C, 0x92, 0xCA,
+    0x5C, 0xA2, 0xD5, 0xAC, 0x2A, 0xC5, 0xAC, 0x91, 0x9C, 0x93, 0xAF, 0xFC, 0x00, 0x2A, 0xFD, 0xA2,
+    0xAA, 0x71, 0xC7, 0x19, 0xC7, 0x1A, 0x97, 0x1C, 0x70, 0x9A, 0x7A, 0xA7, 0xCA, 0x69, 0xC9, 0x69,
+    0xFE, 0x2A, 0xFD, 0xA7, 0x50, 0x49, 0x99, 0x0F, 0xDA, 0x70, 0x71, 0xFC, 0x97, 0x0A, 0xC7, 0x49,
+    0xC9, 0x74, 0xCA, 0x74, 0xAC, 0x74, 0x9C, 0xA7, 0x4D, 0x74, 0xAC, 0xA7, 0x4D, 0x70, 0x99, 0x1D,
+    0x97, 0x0D, 0x09, 0xD7, 0x1A, 0xF9, 0x71, 0x9F, 0x73, 0xE9, 0x72, 0x2A, 0xE9, 0x09, 0xDA, 0x3D,
+    0xAA, 0xD9, 0xDA, 0xC9, 0x19, 0xC3, 0xD9, 0x19, 0xA1, 0xC9, 0x3C, 0xA2, 0x9A, 0x1C, 0x4C, 0x92,
+    0xC9, 0x1C, 0x91, 0x9E, 0xAA, 0xD2, 0xFC, 0xAA, 0xF3, 0x9E, 0xA1, 0xDA, 0x30, 0x75, 0xAD, 0x97,
+    0x39, 0xCA, 0x76, 0xCA, 0x76, 0xAC, 0x77, 0xCA, 0x76, 0x9C, 0x97, 0x6D, 0x76, 0x9C, 0x97, 0x6A,
+    0xC7, 0x7C, 0xA7, 0x6A, 0xC9, 0x76, 0xD7, 0x69, 0xCA, 0x76, 0xD7, 0x69, 0xCA, 0x72, 0x91, 0x9D,
+    0x71, 0x9F, 0xDA, 0x72, 0xFD, 0x74, 0xAA, 0xA9, 0x73, 0x3D, 0x3A, 0xD3, 0xE7, 0x77, 0x6D, 0x3A,
+    0xD3, 0xE2, 0x76, 0xAD, 0xA2, 0xA9, 0x1D, 0x1C, 0x90, 0x9C, 0x2A, 0x92, 0xE9, 0x76, 0xAD, 0x92,
+    0xA2, 0xD1, 0xC9, 0x0A, 0xC2, 0xA2, 0x9E, 0x76, 0x73, 0x97, 0x3A, 0x97, 0x2A, 0x97, 0x2A, 0xA7,
+    0x29, 0xC9, 0x94, 0xAF, 0xFC, 0x39, 0x19, 0xC7, 0x3C, 0x97, 0x2C, 0xA1, 0x99, 0x39, 0xFF, 0xC9,
+    0x4A, 0xC7, 0x29, 0xC7, 0x29, 0xC9, 0x72, 0xCA, 0x77, 0x70, 0x77, 0x5A, 0xCA, 0x71, 0xAE, 0x70,
+    0xAE, 0x97, 0xAE, 0x97, 0x09, 0xDA, 0x73, 0xFA, 0x97, 0x2A, 0xFC, 0xA9, 0x71, 0x9A, 0xF7, 0x49,
+    0xA9, 0x49, 0x75, 0xFC, 0xAA, 0x99, 0x97, 0x09, 0x9A, 0xAA, 0xD0, 0x77, 0x19, 0xCA, 0x73, 0xAD,
+    0xA7, 0x3A, 0xDA, 0x73, 0xEA, 0x72, 0x9E, 0x69, 0xAF, 0x92, 0x9A, 0xFC, 0xA9, 0x3F, 0xA9, 0x7C,
+    0xA9, 0x77, 0x29, 0x49, 0x9A, 0xAF, 0xCA, 0x1A, 0xDA, 0xA9, 0x99, 0x50,
 };
 
 static const EpdGlyph opendyslexic_8_italicGlyphs[] = {
     { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 9, 17, 10, 0, 17, 39, 0 }, // !
-    { 9, 6, 13, 3, 15, 14, 39 }, // "
-    { 19, 15, 22, 2, 14, 72, 53 }, // #
-    { 15, 18, 18, 1, 16, 68, 125 }, // $
-    { 14, 14, 19, 4, 13, 49, 193 }, // %
-    { 14, 16, 17, 2, 15, 56, 242 }, // &
-    { 4, 5, 8, 3, 13, 5, 298 }, // '
-    { 9, 23, 12, 2, 17, 52, 303 }, // (
-    { 10, 23, 7, -4, 17, 58, 355 }, // )
-    { 9, 8, 13, 3, 13, 18, 413 }, // *
-    { 9, 9, 12, 2, 9, 21, 431 }, // +
-    { 6, 6, 7, 0, 3, 9, 452 }, // ,
-    { 9, 2, 12, 2, 6, 5, 461 }, // -
-    { 4, 3, 5, 0, 3, 3, 466 }, // .
-    { 17, 26, 16, -2, 18, 111, 469 }, // /
-    { 12, 13, 14, 1, 13, 39, 580 }, // 0
-    { 8, 13, 10, 1, 13, 26, 619 }, // 1
-    { 12, 13, 14, 1, 13, 39, 645 }, // 2
-    { 12, 13, 14, 1, 13, 39, 684 }, // 3
-    { 10, 13, 13, 2, 13, 33, 723 }, // 4
-    { 11, 13, 13, 1, 13, 36, 756 }, // 5
-    { 12, 13, 14, 1, 13, 39, 792 }, // 6
-    { 9, 13, 14, 4, 13, 30, 831 }, // 7
-    { 12, 13, 14, 1, 13, 39, 861 }, // 8
-    { 11, 13, 14, 2, 13, 36, 900 }, // 9
-    { 7, 10, 8, 0, 10, 18, 936 }, // :
-    { 7, 12, 8, 0, 9, 21, 954 }, // ;
-    { 13, 10, 13, -1, 10, 33, 975 }, // <
-    { 10, 7, 12, 1, 8, 18, 1008 }, // =
-    { 13, 10, 15, 1, 10, 33, 1026 }, // >
-    { 12, 19, 15, 2, 19, 57, 1059 }, // ?
-    { 17, 16, 20, 2, 15, 68, 1116 }, // @
-    { 14, 14, 17, 0, 14, 49, 1184 }, // A
-    { 13, 14, 14, 0, 14, 46, 1233 }, // B
-    { 14, 17, 16, 1, 16, 60, 1279 }, // C
-    { 15, 15, 16, 0, 15, 57, 1339 }, // D
-    { 14, 15, 15, 0, 15, 53, 1396 }, // E
-    { 13, 15, 14, 0, 15, 49, 1449 }, // F
-    { 14, 15, 17, 1, 15, 53, 1498 }, // G
-    { 16, 15, 17, 0, 15, 60, 1551 }, // H
-    { 8, 15, 9, 0, 15, 30, 1611 }, // I
-    { 12, 19, 12, -1, 15, 57, 1641 }, // J
-    { 14, 15, 15, 0, 15, 53, 1698 }, // K
-    { 11, 15, 13, 0, 15, 42, 1751 }, // L
-    { 18, 15, 19, 0, 15, 68, 1793 }, // M
-    { 17, 15, 18, 0, 15, 64, 1861 }, // N
-    { 16, 16, 18, 1, 15, 64, 1925 }, // O
-    { 14, 15, 15, 0, 15, 53, 1989 }, // P
-    { 16, 18, 18, 1, 15, 72, 2042 }, // Q
-    { 13, 14, 14, 0, 14, 46, 2114 }, // R
-    { 15, 16, 16, 0, 15, 60, 2160 }, // S
-    { 14, 14, 18, 3, 14, 49, 2220 }, // T
-    { 15, 16, 17, 1, 15, 60, 2269 }, // U
-    { 14, 15, 19, 4, 15, 53, 2329 }, // V
-    { 19, 14, 23, 3, 14, 67, 2382 }, // W
-    { 17, 15, 18, 0, 15, 64, 2449 }, // X
-    { 12, 14, 17, 4, 14, 42, 2513 }, // Y
-    { 17, 14, 18, 0, 14, 60, 2555 }, // Z
-    { 13, 23, 13, -1, 18, 75, 2615 }, // [
-    { 3, 16, 8, 4, 13, 12, 2690 }, // <backslash>
-    { 12, 23, 9, -4, 18, 69, 2702 }, // ]
-    { 7, 4, 11, 3, 15, 7, 2771 }, // ^
-    { 12, 3, 13, 0, -1, 9, 2778 }, // _
-    { 5, 3, 10, 4, 13, 4, 2787 }, // `
-    { 11, 11, 13, 0, 11, 31, 2791 }, // a
-    { 10, 16, 13, 2, 15, 40, 2822 }, // b
-    { 9, 12, 11, 1, 11, 27, 2862 }, // c
-    { 13, 16, 15, 1, 15, 52, 2889 }, // d
-    { 11, 10, 13, 1, 10, 28, 2941 }, // e
-    { 9, 14, 11, 1, 14, 32, 2969 }, // f
-    { 12, 15, 13, 0, 10, 45, 3001 }, // g
-    { 12, 15, 13, 0, 15, 45, 3046 }, // h
-    { 7, 15, 8, 0, 15, 27, 3091 }, // i
-    { 11, 20, 13, 1, 15, 55, 3118 }, // j
-    { 10, 14, 13, 0, 14, 35, 3173 }, // k
-    { 7, 14, 8, 0, 14, 25, 3208 }, // l
-    { 17, 10, 18, 0, 10, 43, 3233 }, // m
-    { 11, 10, 12, 0, 10, 28, 3276 }, // n
-    { 11, 10, 13, 1, 10, 28, 3304 }, // o
-    { 14, 15, 14, -1, 10, 53, 3332 }, // p
-    { 12, 14, 15, 1, 10, 42, 3385 }, // q
-    { 9, 10, 10, 0, 10, 23, 3427 }, // r
-    { 11, 10, 12, 0, 10, 28, 3450 }, // s
-    { 8, 13, 11, 2, 13, 26, 3478 }, // t
-    { 11, 10, 13, 1, 10, 28, 3504 }, // u
-    { 11, 10, 15, 3, 10, 28, 3532 }, // v
-    { 13, 10, 17, 3, 10, 33, 3560 }, // w
-    { 13, 10, 14, 0, 10, 33, 3593 }, // x
-    { 13, 15, 14, 0, 10, 49, 3626 }, // y
-    { 12, 10, 13, 0, 10, 30, 3675 }, // z
-    { 10, 16, 13, 2, 13, 40, 3705 }, // {
-    { 7, 15, 8, 0, 12, 27, 3745 }, // |
-    { 9, 16, 11, 0, 13, 36, 3772 }, // }
-    { 7, 4, 11, 3, 13, 7, 3808 }, // ~
-    { 0, 0, 14, 0, 0, 0, 3815 }, //  
-    { 7, 18, 9, 1, 13, 32, 3815 }, // ¡
-    { 9, 16, 11, 1, 14, 36, 3847 }, // ¢
-    { 14, 16, 15, 0, 16, 56, 3883 }, // £
-    { 10, 8, 13, 2, 10, 20, 3939 }, // ¤
-    { 13, 15, 16, 2, 13, 49, 3959 }, // ¥
-    { 7, 15, 8, 0, 12, 27, 4008 }, // ¦
-    { 14, 15, 15, 0, 13, 53, 4035 }, // §
-    { 9, 3, 13, 3, 13, 7, 4088 }, // ¨
-    { 8, 7, 13, 4, 16, 14, 4095 }, // ©
-    { 7, 6, 10, 2, 13, 11, 4109 }, // ª
-    { 12, 8, 14, 1, 8, 24, 4120 }, // «
-    { 9, 5, 12, 2, 6, 12, 4144 }, // ¬
-    { 9, 2, 12, 2, 6, 5, 4156 }, // ­
-    { 8, 7, 13, 4, 18, 14, 4161 }, // ®
-    { 7, 3, 12, 4, 13, 6, 4175 }, // ¯
-    { 9, 8, 12, 2, 14, 18, 4181 }, // °
-    { 11, 10, 12, 0, 9, 28, 4199 }, // ±
-    { 5, 7, 8, 2, 14, 9, 4227 }, // ²
-    { 6, 7, 9, 2, 14, 11, 4236 }, // ³
-    { 5, 4, 9, 3, 13, 5, 4247 }, // ´
-    { 13, 12, 13, -1, 10, 39, 4252 }, // µ
-    { 12, 14, 13, 0, 12, 42, 4291 }, // ¶
-    { 5, 3, 7, 1, 7, 4, 4333 }, // ·
-    { 5, 5, 6, 0, 1, 7, 4337 }, // ¸
-    { 4, 7, 7, 2, 14, 7, 4344 }, // ¹
-    { 6, 6, 10, 3, 12, 9, 4351 }, // º
-    { 11, 8, 11, -2, 8, 22, 4360 }, // »
-    { 14, 16, 19, 4, 15, 56, 4382 }, // ¼
-    { 15, 15, 20, 4, 14, 57, 4438 }, // ½
-    { 15, 15, 19, 3, 14, 57, 4495 }, // ¾
-    { 11, 19, 11, -1, 10, 53, 4552 }, // ¿
-    { 14, 19, 17, 0, 19, 67, 4605 }, // À
-    { 15, 22, 17, 0, 22, 83, 4672 }, // Á
-    { 15, 19, 17, 0, 19, 72, 4755 }, // Â
-    { 15, 19, 17, 0, 19, 72, 4827 }, // Ã
-    { 16, 19, 17, 0, 19, 76, 4899 }, // Ä
-    { 14, 20, 17, 0, 20, 70, 4975 }, // Å
-    { 23, 16, 24, 0, 15, 92, 5045 }, // Æ
-    { 14, 20, 16, 1, 16, 70, 5137 }, // Ç
-    { 14, 19, 15, 0, 19, 67, 5207 }, // È
-    { 14, 22, 15, 0, 22, 77, 5274 }, // É
-    { 14, 18, 15, 0, 18, 63, 5351 }, // Ê
-    { 14, 19, 15, 0, 19, 67, 5414 }, // Ë
-    { 9, 21, 10, 0, 21, 48, 5481 }, // Ì
-    { 10, 24, 11, 0, 24, 60, 5529 }, // Í
-    { 10, 20, 11, 0, 20, 50, 5589 }, // Î
-    { 11, 21, 12, 0, 21, 58, 5639 }, // Ï
-    { 15, 15, 16, 0, 15, 57, 5697 }, // Ð
-    { 17, 18, 18, 0, 18, 77, 5754 }, // Ñ
-    { 16, 21, 18, 1, 20, 84, 5831 }, // Ò
-    { 16, 24, 18, 1, 23, 96, 5915 }, // Ó
-    { 16, 20, 18, 1, 19, 80, 6011 }, // Ô
-    { 16, 21, 18, 1, 20, 84, 6091 }, // Õ
-    { 16, 21, 18, 1, 20, 84, 6175 }, // Ö
-    { 9, 5, 11, 1, 7, 12, 6259 }, // ×
-    { 29, 29, 24, -6, 22, 211, 6271 }, // Ø
-    { 15, 20, 17, 1, 19, 75, 6482 }, // Ù
-    { 15, 23, 17, 1, 22, 87, 6557 }, // Ú
-    { 15, 20, 17, 1, 19, 75, 6644 }, // Û
-    { 15, 20, 17, 1, 19, 75, 6719 }, // Ü
-    { 12, 23, 17, 4, 23, 69, 6794 }, // Ý
-    { 11, 13, 12, 0, 13, 36, 6863 }, // Þ
-    { 12, 13, 14, 1, 13, 39, 6899 }, // ß
-    { 11, 14, 13, 0, 14, 39, 6938 }, // à
-    { 11, 17, 13, 0, 17, 47, 6977 }, // á
-    { 12, 14, 13, 0, 14, 42, 7024 }, // â
-    { 12, 13, 13, 0, 13, 39, 7066 }, // ã
-    { 12, 14, 13, 0, 14, 42, 7105 }, // ä
-    { 11, 15, 13, 0, 15, 42, 7147 }, // å
-    { 18, 11, 20, 0, 11, 50, 7189 }, // æ
-    { 9, 15, 11, 1, 11, 34, 7239 }, // ç
-    { 11, 16, 13, 1, 16, 44, 7273 }, // è
-    { 11, 19, 13, 1, 19, 53, 7317 }, // é
-    { 11, 15, 13, 1, 15, 42, 7370 }, // ê
-    { 12, 16, 14, 1, 16, 48, 7412 }, // ë
-    { 7, 14, 8, 0, 14, 25, 7460 }, // ì
-    { 9, 17, 10, 0, 17, 39, 7485 }, // í
-    { 9, 13, 10, 0, 13, 30, 7524 }, // î
-    { 9, 14, 10, 0, 14, 32, 7554 }, // ï
-    { 15, 14, 17, 1, 14, 53, 7586 }, // ð
-    { 13, 14, 14, 0, 14, 46, 7639 }, // ñ
-    { 11, 16, 13, 1, 16, 44, 7685 }, // ò
-    { 11, 19, 13, 1, 19, 53, 7729 }, // ó
-    { 11, 15, 13, 1, 15, 42, 7782 }, // ô
-    { 11, 16, 13, 1, 16, 44, 7824 }, // õ
-    { 12, 16, 14, 1, 16, 48, 7868 }, // ö
-    { 11, 10, 14, 2, 10, 28, 7916 }, // ÷
-    { 16, 27, 15, -2, 18, 108, 7944 }, // ø
-    { 11, 15, 13, 1, 15, 42, 8052 }, // ù
-    { 11, 18, 13, 1, 18, 50, 8094 }, // ú
-    { 11, 14, 13, 1, 14, 39, 8144 }, // û
-    { 11, 15, 13, 1, 15, 42, 8183 }, // ü
-    { 13, 24, 14, 0, 19, 78, 8225 }, // ý
-    { 11, 18, 12, 0, 14, 50, 8303 }, // þ
-    { 13, 21, 14, 0, 16, 69, 8353 }, // ÿ
-    { 16, 19, 17, 0, 19, 76, 8422 }, // Ā
-    { 12, 13, 13, 0, 13, 39, 8498 }, // ā
-    { 16, 21, 17, 0, 21, 84, 8537 }, // Ă
-    { 12, 15, 13, 0, 15, 45, 8621 }, // ă
-    { 14, 19, 17, 0, 14, 67, 8666 }, // Ą
-    { 11, 15, 13, 0, 11, 42, 8733 }, // ą
-    { 14, 24, 16, 1, 23, 84, 8775 }, // Ć
-    { 10, 17, 12, 1, 16, 43, 8859 }, // ć
-    { 15, 22, 17, 1, 21, 83, 8902 }, // Ĉ
-    { 11, 16, 13, 1, 15, 44, 8985 }, // ĉ
-    { 14, 23, 16, 1, 22, 81, 9029 }, // Ċ
-    { 9, 16, 11, 1, 15, 36, 9110 }, // ċ
-    { 14, 24, 16, 1, 23, 84, 9146 }, // Č
-    { 10, 17, 12, 1, 16, 43, 9230 }, // č
-    { 15, 21, 16, 0, 21, 79, 9273 }, // Ď
-    { 16, 16, 18, 1, 15, 64, 9352 }, // ď
-    { 15, 15, 16, 0, 15, 57, 9416 }, // Đ
-    { 15, 16, 17, 1, 15, 60, 9473 }, // đ
-    { 14, 19, 15, 0, 19, 67, 9533 }, // Ē
-    { 12, 15, 14, 1, 15, 45, 9600 }, // ē
-    { 14, 21, 15, 0, 21, 74, 9645 }, // Ĕ
-    { 12, 17, 14, 1, 17, 51, 9719 }, // ĕ
-    { 14, 20, 15, 0, 20, 70, 9770 }, // Ė
-    { 11, 16, 13, 1, 16, 44, 9840 }, // ė
-    { 14, 19, 15, 0, 15, 67, 9884 }, // Ę
-    { 11, 15, 13, 1, 10, 42, 9951 }, // ę
-    { 14, 21, 15, 0, 21, 74, 9993 }, // Ě
-    { 11, 17, 13, 1, 17, 47, 10067 }, // ě
-    { 15, 19, 17, 1, 19, 72, 10114 }, // Ĝ
-    { 13, 20, 14, 0, 15, 65, 10186 }, // ĝ
-    { 15, 21, 17, 1, 21, 79, 10251 }, // Ğ
-    { 12, 21, 13, 0, 16, 63, 10330 }, // ğ
-    { 14, 20, 17, 1, 20, 70, 10393 }, // Ġ
-    { 12, 20, 13, 0, 15, 60, 10463 }, // ġ
-    { 14, 23, 17, 1, 15, 81, 10523 }, // Ģ
-    { 12, 21, 13, 0, 16, 63, 10604 }, // ģ
-    { 16, 19, 17, 0, 19, 76, 10667 }, // Ĥ
-    { 12, 19, 13, 0, 19, 57, 10743 }, // ĥ
-    { 16, 15, 17, 0, 15, 60, 10800 }, // Ħ
-    { 12, 15, 13, 0, 15, 45, 10860 }, // ħ
-    { 10, 21, 11, 0, 21, 53, 10905 }, // Ĩ
-    { 9, 15, 10, 0, 15, 34, 10958 }, // ĩ
-    { 11, 20, 12, 0, 20, 55, 10992 }, // Ī
-    { 9, 14, 10, 0, 14, 32, 11047 }, // ī
-    { 8, 19, 11, 2, 15, 38, 11079 }, // Į
-    { 8, 19, 8, -1, 15, 38, 11117 }, // į
-    { 9, 21, 10, 0, 21, 48, 11155 }, // İ
-    { 6, 10, 7, 0, 10, 15, 11203 }, // ı
-    { 14, 19, 15, 0, 15, 67, 11218 }, // Ĳ
-    { 16, 20, 17, 0, 15, 80, 11285 }, // ĳ
-    { 14, 23, 14, -1, 19, 81, 11365 }, // Ĵ
-    { 14, 20, 16, 1, 15, 70, 11446 }, // ĵ
-    { 14, 21, 15, 0, 15, 74, 11516 }, // Ķ
-    { 10, 22, 13, 0, 14, 55, 11590 }, // ķ
-    { 8, 9, 9, 0, 9, 18, 11645 }, // ĸ
-    { 11, 20, 13, 0, 20, 55, 11663 }, // Ĺ
-    { 10, 20, 11, 0, 20, 50, 11718 }, // ĺ
-    { 11, 22, 13, 0, 15, 61, 11768 }, // Ļ
-    { 7, 21, 8, 0, 14, 37, 11829 }, // ļ
-    { 12, 15, 13, 0, 15, 45, 11866 }, // Ľ
-    { 11, 14, 12, 0, 14, 39, 11911 }, // ľ
-    { 12, 14, 13, 0, 14, 42, 11950 }, // Ŀ
-    { 10, 14, 11, 0, 14, 35, 11992 }, // ŀ
-    { 23, 21, 16, -8, 17, 121, 12027 }, // Ł
-    { 16, 14, 11, -6, 14, 56, 12148 }, // ł
-    { 17, 20, 18, 0, 20, 85, 12204 }, // Ń
-    { 12, 16, 13, 0, 16, 48, 12289 }, // ń
-    { 17, 21, 18, 0, 15, 90, 12337 }, // Ņ
-    { 11, 16, 12, 0, 10, 44, 12427 }, // ņ
-    { 17, 20, 18, 0, 20, 85, 12471 }, // Ň
-    { 12, 16, 13, 0, 16, 48, 12556 }, // ň
-    { 12, 18, 11, -2, 18, 54, 12604 }, // ŉ
-    { 17, 19, 18, 0, 15, 81, 12658 }, // Ŋ
-    { 11, 14, 12, 0, 10, 39, 12739 }, // ŋ
-    { 16, 20, 18, 1, 19, 80, 12778 }, // Ō
-    { 12, 15, 14, 1, 15, 45, 12858 }, // ō
-    { 16, 22, 18, 1, 21, 88, 12903 }, // Ŏ
-    { 12, 18, 14, 1, 18, 54, 12991 }, // ŏ
-    { 17, 21, 19, 1, 20, 90, 13045 }, // Ő
-    { 14, 17, 16, 1, 17, 60, 13135 }, // ő
-    { 22, 15, 24, 1, 15, 83, 13195 }, // Œ
-    { 18, 11, 20, 1, 11, 50, 13278 }, // œ
-    { 13, 20, 14, 0, 20, 65, 13328 }, // Ŕ
-    { 9, 14, 10, 0, 14, 32, 13393 }, // ŕ
-    { 13, 22, 14, 0, 14, 72, 13425 }, // Ŗ
-    { 10, 19, 10, -1, 10, 48, 13497 }, // ŗ
-    { 13, 20, 14, 0, 20, 65, 13545 }, // Ř
-    { 9, 14, 10, 0, 14, 32, 13610 }, // ř
-    { 15, 22, 16, 0, 21, 83, 13642 }, // Ś
-    { 11, 16, 12, 0, 16, 44, 13725 }, // ś
-    { 16, 21, 17, 0, 20, 84, 13769 }, // Ŝ
-    { 11, 15, 12, 0, 15, 42, 13853 }, // ŝ
-    { 15, 19, 16, 0, 15, 72, 13895 }, // Ş
-    { 11, 14, 12, 0, 10, 39, 13967 }, // ş
-    { 15, 23, 16, 0, 22, 87, 14006 }, // Š
-    { 11, 16, 12, 0, 16, 44, 14093 }, // š
-    { 14, 17, 18, 3, 14, 60, 14137 }, // Ţ
-    { 8, 16, 11, 2, 13, 32, 14197 }, // ţ
-    { 14, 20, 18, 3, 20, 70, 14229 }, // Ť
-    { 10, 14, 13, 2, 14, 35, 14299 }, // ť
-    { 14, 14, 18, 3, 14, 49, 14334 }, // Ŧ
-    { 9, 13, 11, 1, 13, 30, 14383 }, // ŧ
-    { 15, 21, 17, 1, 20, 79, 14413 }, // Ũ
-    { 11, 15, 13, 1, 15, 42, 14492 }, // ũ
-    { 15, 20, 17, 1, 19, 75, 14534 }, // Ū
-    { 11, 14, 13, 1, 14, 39, 14609 }, // ū
-    { 15, 22, 17, 1, 21, 83, 14648 }, // Ŭ
-    { 11, 16, 13, 1, 16, 44, 14731 }, // ŭ
-    { 15, 22, 17, 1, 21, 83, 14775 }, // Ů
-    { 11, 16, 13, 1, 16, 44, 14858 }, // ů
-    { 16, 21, 18, 1, 20, 84, 14902 }, // Ű
-    { 13, 15, 15, 1, 15, 49, 14986 }, // ű
-    { 15, 19, 17, 1, 15, 72, 15035 }, // Ų
-    { 11, 15, 13, 1, 10, 42, 15107 }, // ų
-    { 19, 18, 23, 3, 18, 86, 15149 }, // Ŵ
-    { 13, 14, 17, 3, 14, 46, 15235 }, // ŵ
-    { 12, 19, 17, 4, 19, 57, 15281 }, // Ŷ
-    { 13, 21, 14, 0, 16, 69, 15338 }, // ŷ
-    { 12, 20, 17, 4, 20, 60, 15407 }, // Ÿ
-    { 17, 20, 18, 0, 20, 85, 15467 }, // Ź
-    { 12, 16, 13, 0, 16, 48, 15552 }, // ź
-    { 17, 19, 18, 0, 19, 81, 15600 }, // Ż
-    { 12, 15, 13, 0, 15, 45, 15681 }, // ż
-    { 17, 20, 18, 0, 20, 85, 15726 }, // Ž
-    { 12, 16, 13, 0, 16, 48, 15811 }, // ž
-    { 9, 14, 12, 2, 14, 32, 15859 }, // ſ
-    { 20, 17, 22, 1, 16, 85, 15891 }, // Ơ
-    { 12, 11, 14, 1, 11, 33, 15976 }, // ơ
-    { 14, 15, 15, 0, 15, 53, 16009 }, // Ƥ
-    { 14, 18, 14, -1, 13, 63, 16062 }, // ƥ
-    { 11, 13, 13, 1, 12, 36, 16125 }, // Ʃ
-    { 14, 14, 18, 3, 14, 49, 16161 }, // Ƭ
-    { 9, 15, 12, 2, 15, 34, 16210 }, // ƭ
-    { 14, 18, 18, 3, 14, 63, 16244 }, // Ʈ
-    { 18, 16, 20, 1, 15, 72, 16307 }, // Ư
-    { 12, 12, 14, 1, 12, 36, 16379 }, // ư
-    { 5, 3, 10, 4, 13, 4, 16415 }, // ̀
-    { 5, 4, 9, 3, 13, 5, 16419 }, // ́
-    { 8, 4, 8, -1, 0, 8, 16424 }, // ̂
-    { 7, 4, 11, 3, 13, 7, 16432 }, // ̃
-    { 8, 3, 12, 3, 12, 6, 16439 }, // ̄
-    { 11, 3, 17, 5, 15, 9, 16445 }, // ̅
-    { 8, 4, 12, 3, 13, 8, 16454 }, // ̆
-    { 4, 3, 8, 3, 13, 3, 16462 }, // ̇
-    { 9, 3, 13, 3, 13, 7, 16465 }, // ̈
-    { 4, 4, 8, 3, 11, 4, 16472 }, // ̉
-    { 5, 4, 9, 3, 13, 5, 16476 }, // ̊
-    { 12, 3, 16, 3, 13, 9, 16481 }, // ̋
-    { 8, 4, 12, 3, 13, 8, 16490 }, // ̌
-    { 12, 3, 8, -5, 14, 9, 16498 }, // ̏
-    { 6, 5, 9, 2, 13, 8, 16507 }, // ̒
-    { 6, 5, 9, 2, 12, 8, 16515 }, // ̓
-    { 6, 5, 4, -3, 12, 8, 16523 }, // ̔
-    { 4, 5, 5, 0, 0, 5, 16531 }, // ̘
-    { 4, 5, 6, 1, 0, 5, 16536 }, // ̙
-    { 8, 4, 13, 4, 13, 8, 16541 }, // ̚
-    { 3, 4, 7, 3, 11, 3, 16549 }, // ̛
-    { 3, 3, 4, 0, -1, 3, 16552 }, // ̜
-    { 4, 4, 7, 2, 3, 4, 16555 }, // ̝
-    { 4, 4, 5, 0, 0, 4, 16559 }, // ̞
-    { 4, 4, 5, 0, -1, 4, 16563 }, // ̟
-    { 8, 3, 9, 0, -2, 6, 16567 }, // ̠
-    { 4, 3, 5, 0, 1, 3, 16573 }, // ̣
-    { 9, 3, 9, -1, 0, 7, 16576 }, // ̤
-    { 5, 4, 9, 3, 13, 5, 16583 }, // ̥
-    { 6, 6, 7, 0, 3, 9, 16588 }, // ̦
-    { 5, 5, 6, 0, 1, 7, 16597 }, // ̧
-    { 5, 5, 6, 0, 0, 7, 16604 }, // ̨
-    { 4, 5, 4, -1, -1, 5, 16611 }, // ̩
-    { 6, 3, 7, 0, -1, 5, 16616 }, // ̪
-    { 7, 4, 8, 0, 0, 7, 16621 }, // ̬
-    { 8, 4, 8, -1, 0, 8, 16628 }, // ̭
-    { 7, 4, 11, 3, 13, 7, 16636 }, // ̰
-    { 7, 3, 12, 4, 13, 6, 16643 }, // ̱
-    { 7, 3, 8, 0, -1, 6, 16649 }, // ̲
-    { 7, 4, 11, 3, 13, 7, 16655 }, // ̴
-    { 9, 2, 12, 2, 6, 5, 16662 }, // ̵
-    { 3, 3, 5, 1, -1, 3, 16667 }, // ̹
-    { 6, 4, 6, -1, 0, 6, 16670 }, // ̺
-    { 6, 4, 7, 0, 0, 6, 16676 }, // ̻
-    { 6, 4, 7, 0, 0, 6, 16682 }, // ̼
-    { 5, 4, 9, 3, 13, 5, 16688 }, // ̽
-    { 7, 4, 11, 3, 13, 7, 16693 }, // ͂
-    { 4, 3, 8, 3, 14, 3, 16700 }, // ̓
-    { 9, 8, 13, 3, 18, 18, 16703 }, // ̈́
-    { 6, 3, 11, 4, 13, 5, 16721 }, // ͆
-    { 10, 6, 10, -1, 0, 15, 16726 }, // ͇
-    { 8, 5, 9, 0, 0, 10, 16741 }, // ͈
-    { 6, 5, 7, 0, -1, 8, 16751 }, // ͉
-    { 8, 10, 12, 3, 16, 20, 16759 }, // ͊
-    { 16, 7, 22, 5, 15, 28, 16779 }, // ͋
-    { 12, 9, 16, 3, 9, 27, 16807 }, // ͌
-    { 9, 5, 11, 1, 0, 12, 16834 }, // ͍
-    { 3, 3, 6, 2, 2, 3, 16846 }, // ͎
-    { 14, 3, 16, 1, 0, 11, 16849 }, // ͜
-    { 14, 3, 18, 3, 13, 11, 16860 }, // ͡
-    { 17, 5, 18, 0, -1, 22, 16871 }, // ͢
-    { 14, 14, 17, 0, 14, 49, 16893 }, // Α
-    { 13, 14, 14, 0, 14, 46, 16942 }, // Β
-    { 11, 14, 13, 1, 13, 39, 16988 }, // Γ
-    { 13, 13, 15, 1, 13, 43, 17027 }, // Δ
-    { 14, 15, 15, 0, 15, 53, 17070 }, // Ε
-    { 17, 14, 18, 0, 14, 60, 17123 }, // Ζ
-    { 16, 15, 17, 0, 15, 60, 17183 }, // Η
-    { 16, 16, 18, 1, 15, 64, 17243 }, // Θ
-    { 8, 15, 9, 0, 15, 30, 17307 }, // Ι
-    { 14, 15, 15, 0, 15, 53, 17337 }, // Κ
-    { 14, 15, 17, 0, 15, 53, 17390 }, // Λ
-    { 18, 15, 19, 0, 15, 68, 17443 }, // Μ
-    { 17, 15, 18, 0, 15, 64, 17511 }, // Ν
-    { 13, 12, 15, 1, 12, 39, 17575 }, // Ξ
-    { 16, 16, 18, 1, 15, 64, 17614 }, // Ο
-    { 12, 12, 14, 1, 12, 36, 17678 }, // Π
-    { 14, 15, 15, 0, 15, 53, 17714 }, // Ρ
-    { 11, 13, 13, 1, 12, 36, 17767 }, // Σ
-    { 14, 14, 18, 3, 14, 49, 17803 }, // Τ
-    { 12, 14, 17, 4, 14, 42, 17852 }, // Υ
-    { 19, 18, 22, 2, 16, 86, 17894 }, // Φ
-    { 17, 15, 18, 0, 15, 64, 17980 }, // Χ
-    { 14, 15, 17, 2, 13, 53, 18044 }, // Ψ
-    { 15, 14, 16, 0, 13, 53, 18097 }, // Ω
-    { 14, 12, 16, 0, 11, 42, 18150 }, // α
-    { 12, 20, 13, 0, 16, 60, 18192 }, // β
-    { 9, 15, 13, 3, 10, 34, 18252 }, // γ
-    { 12, 15, 14, 1, 15, 45, 18286 }, // δ
-    { 8, 9, 10, 1, 9, 18, 18331 }, // ε
-    { 11, 14, 13, 1, 12, 39, 18349 }, // ζ
-    { 11, 16, 14, 2, 11, 44, 18388 }, // η
-    { 12, 13, 14, 1, 13, 39, 18432 }, // θ
-    { 6, 11, 9, 0, 11, 17, 18471 }, // ι
-    { 9, 10, 10, 0, 10, 23, 18488 }, // κ
-    { 13, 14, 13, -6, 14, 46, 18511 }, // λ
-    { 13, 12, 13, -1, 10, 39, 18557 }, // μ
-    { 9, 10, 13, 3, 10, 23, 18596 }, // ν
-    { 9, 15, 12, 2, 12, 34, 18619 }, // ξ
-    { 11, 10, 13, 1, 10, 28, 18653 }, // ο
-    { 11, 10, 14, 2, 9, 28, 18681 }, // π
-    { 13, 14, 14, 0, 10, 46, 18709 }, // ρ
-    { 8, 12, 12, 3, 12, 24, 18755 }, // ς
-    { 15, 10, 17, 1, 10, 38, 18779 }, // σ
-    { 9, 10, 13, 3, 9, 23, 18817 }, // τ
-    { 8, 10, 11, 2, 10, 20, 18840 }, // υ
-    { 16, 21, 18, 1, 19, 84, 18860 }, // φ
-    { 14, 13, 15, 0, 9, 46, 18944 }, // χ
-    { 10, 16, 13, 2, 12, 40, 18990 }, // ψ
-    { 13, 10, 15, 1, 9, 33, 19030 }, // ω
-    { 14, 19, 17, 0, 14, 67, 19063 }, // Ạ
-    { 11, 16, 13, 0, 11, 44, 19130 }, // ạ
-    { 15, 21, 17, 0, 21, 79, 19174 }, // Ả
-    { 11, 16, 13, 0, 16, 44, 19253 }, // ả
-    { 18, 24, 19, 0, 24, 108, 19297 }, // Ấ
-    { 17, 19, 18, 0, 19, 81, 19405 }, // ấ
-    { 15, 22, 17, 0, 22, 83, 19486 }, // Ầ
-    { 12, 16, 13, 0, 16, 48, 19569 }, // ầ
-    { 18, 23, 19, 0, 23, 104, 19617 }, // Ẩ
-    { 12, 17, 13, 0, 17, 51, 19721 }, // ẩ
-    { 15, 23, 17, 0, 23, 87, 19772 }, // Ẫ
-    { 11, 17, 13, 0, 17, 47, 19859 }, // ẫ
-    { 15, 24, 17, 0, 19, 90, 19906 }, // Ậ
-    { 11, 18, 13, 0, 13, 50, 19996 }, // ậ
-    { 16, 27, 17, 0, 27, 108, 20046 }, // Ắ
-    { 12, 21, 13, 0, 21, 63, 20154 }, // ắ
-    { 16, 25, 17, 0, 25, 100, 20217 }, // Ằ
-    { 12, 20, 13, 0, 20, 60, 20317 }, // ằ
-    { 16, 26, 17, 0, 26, 104, 20377 }, // Ẳ
-    { 12, 22, 13, 0, 22, 66, 20481 }, // ẳ
-    { 16, 26, 17, 0, 26, 104, 20547 }, // Ẵ
-    { 12, 20, 13, 0, 20, 60, 20651 }, // ẵ
-    { 16, 26, 17, 0, 21, 104, 20711 }, // Ặ
-    { 12, 20, 13, 0, 15, 60, 20815 }, // ặ
-    { 14, 19, 15, 0, 15, 67, 20875 }, // Ẹ
-    { 11, 15, 13, 1, 10, 42, 20942 }, // ẹ
-    { 14, 20, 15, 0, 20, 70, 20984 }, // Ẻ
-    { 11, 17, 13, 1, 17, 47, 21054 }, // ẻ
-    { 14, 19, 15, 0, 19, 67, 21101 }, // Ẽ
-    { 11, 16, 13, 1, 16, 44, 21168 }, // ẽ
-    { 14, 23, 15, 0, 23, 81, 21212 }, // Ế
-    { 17, 17, 19, 1, 17, 73, 21293 }, // ế
-    { 14, 21, 15, 0, 21, 74, 21366 }, // Ề
-    { 11, 18, 13, 1, 18, 50, 21440 }, // ề
-    { 14, 22, 15, 0, 22, 77, 21490 }, // Ể
-    { 12, 19, 14, 1, 19, 57, 21567 }, // ể
-    { 14, 23, 15, 0, 23, 81, 21624 }, // Ễ
-    { 11, 19, 13, 1, 19, 53, 21705 }, // ễ
-    { 14, 22, 15, 0, 18, 77, 21758 }, // Ệ
-    { 12, 21, 14, 1, 16, 63, 21835 }, // ệ
-    { 10, 22, 11, 0, 22, 55, 21898 }, // Ỉ
-    { 8, 15, 9, 0, 15, 30, 21953 }, // ỉ
-    { 9, 19, 9, -1, 15, 43, 21983 }, // Ị
-    { 8, 19, 8, -1, 15, 38, 22026 }, // ị
-    { 16, 20, 18, 1, 15, 80, 22064 }, // Ọ
-    { 11, 15, 13, 1, 10, 42, 22144 }, // ọ
-    { 16, 22, 18, 1, 21, 88, 22186 }, // Ỏ
-    { 11, 17, 13, 1, 17, 47, 22274 }, // ỏ
-    { 20, 20, 22, 1, 19, 100, 22321 }, // Ố
-    { 17, 17, 19, 1, 17, 73, 22421 }, // ố
-    { 16, 24, 18, 1, 23, 96, 22494 }, // Ồ
-    { 11, 18, 13, 1, 18, 50, 22590 }, // ồ
-    { 20, 23, 22, 1, 22, 115, 22640 }, // Ổ
-    { 12, 20, 14, 1, 20, 60, 22755 }, // ổ
-    { 16, 24, 18, 1, 23, 96, 22815 }, // Ỗ
-    { 11, 20, 13, 1, 20, 55, 22911 }, // ỗ
-    { 16, 24, 18, 1, 19, 96, 22966 }, // Ộ
-    { 11, 20, 13, 1, 15, 55, 23062 }, // ộ
-    { 20, 23, 22, 1, 22, 115, 23117 }, // Ớ
-    { 12, 18, 14, 1, 18, 54, 23232 }, // ớ
-    { 20, 22, 22, 1, 21, 110, 23286 }, // Ờ
-    { 12, 16, 14, 1, 16, 48, 23396 }, // ờ
-    { 20, 22, 22, 1, 21, 110, 23444 }, // Ở
-    { 12, 17, 14, 1, 17, 51, 23554 }, // ở
-    { 20, 21, 22, 1, 20, 105, 23605 }, // Ỡ
-    { 12, 16, 14, 1, 16, 48, 23710 }, // ỡ
-    { 20, 21, 22, 1, 16, 105, 23758 }, // Ợ
-    { 12, 16, 14, 1, 11, 48, 23863 }, // ợ
-    { 15, 20, 17, 1, 15, 75, 23911 }, // Ụ
-    { 11, 14, 13, 1, 10, 39, 23986 }, // ụ
-    { 15, 22, 17, 1, 21, 83, 24025 }, // Ủ
-    { 11, 16, 13, 1, 16, 44, 24108 }, // ủ
-    { 18, 22, 20, 1, 21, 99, 24152 }, // Ứ
-    { 12, 17, 14, 1, 17, 51, 24251 }, // ứ
-    { 18, 21, 20, 1, 20, 95, 24302 }, // Ừ
-    { 12, 15, 14, 1, 15, 45, 24397 }, // ừ
-    { 18, 22, 20, 1, 21, 99, 24442 }, // Ử
-    { 12, 16, 14, 1, 16, 48, 24541 }, // ử
-    { 18, 21, 20, 1, 20, 95, 24589 }, // Ữ
-    { 12, 15, 14, 1, 15, 45, 24684 }, // ữ
-    { 18, 20, 20, 1, 15, 90, 24729 }, // Ự
-    { 12, 16, 14, 1, 12, 48, 24819 }, // ự
-    { 12, 19, 17, 4, 19, 57, 24867 }, // Ỳ
-    { 13, 21, 14, 0, 16, 69, 24924 }, // ỳ
-    { 14, 21, 17, 2, 14, 74, 24993 }, // Ỵ
-    { 13, 15, 14, 0, 10, 49, 25067 }, // ỵ
-    { 12, 21, 17, 4, 21, 63, 25116 }, // Ỷ
-    { 13, 23, 14, 0, 18, 75, 25179 }, // ỷ
-    { 12, 20, 17, 4, 20, 60, 25254 }, // Ỹ
-    { 13, 22, 14, 0, 17, 72, 25314 }, // ỹ
-    { 0, 0, 14, 0, 0, 0, 25386 }, //  
-    { 0, 0, 22, 0, 0, 0, 25386 }, //  
-    { 0, 0, 14, 0, 0, 0, 25386 }, //  
-    { 0, 0, 22, 0, 0, 0, 25386 }, //  
-    { 0, 0, 11, 0, 0, 0, 25386 }, //  
-    { 0, 0, 10, 0, 0, 0, 25386 }, //  
-    { 0, 0, 8, 0, 0, 0, 25386 }, //  
-    { 0, 0, 11, 0, 0, 0, 25386 }, //  
-    { 0, 0, 4, 0, 0, 0, 25386 }, //  
-    { 0, 0, 9, 0, 0, 0, 25386 }, //  
-    { 0, 0, 8, 0, 0, 0, 25386 }, //  
-    { 0, 0, 5, 0, 0, 0, 25386 }, // ​
-    { 0, 0, 1, 0, 0, 0, 25386 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 25386 }, // ‍
-    { 0, 0, 1, 0, 0, 0, 25386 }, // ‎
-    { 0, 0, 1, 0, 0, 0, 25386 }, // ‏
-    { 9, 2, 12, 2, 6, 5, 25386 }, // ‐
-    { 9, 2, 12, 2, 6, 5, 25391 }, // ‑
-    { 13, 2, 16, 2, 6, 7, 25396 }, // ‒
-    { 12, 3, 15, 2, 6, 9, 25403 }, // –
-    { 17, 3, 20, 2, 6, 13, 25412 }, // —
-    { 17, 3, 20, 2, 6, 13, 25425 }, // ―
-    { 11, 15, 12, 0, 12, 42, 25438 }, // ‖
-    { 14, 6, 15, 0, -1, 21, 25480 }, // ‗
-    { 6, 6, 10, 3, 15, 9, 25501 }, // ‘
-    { 6, 5, 10, 3, 14, 8, 25510 }, // ’
-    { 6, 6, 7, 0, 3, 9, 25518 }, // ‚
-    { 6, 6, 10, 3, 15, 9, 25527 }, // ‛
-    { 10, 6, 14, 3, 15, 15, 25536 }, // “
-    { 10, 6, 14, 3, 15, 15, 25551 }, // ”
-    { 6, 6, 7, 0, 3, 9, 25566 }, // „
-    { 10, 5, 14, 3, 15, 13, 25575 }, // ‟
-    { 9, 22, 13, 3, 17, 50, 25588 }, // †
-    { 11, 22, 13, 1, 17, 61, 25638 }, // ‡
-    { 11, 10, 12, 0, 12, 28, 25699 }, // •
-    { 5, 6, 8, 2, 8, 8, 25727 }, // ‣
-    { 4, 3, 5, 0, 3, 3, 25735 }, // ․
-    { 4, 3, 5, 0, 3, 3, 25738 }, // ‥
-    { 16, 3, 17, 0, 3, 12, 25741 }, // …
-    { 3, 2, 5, 1, 6, 2, 25753 }, // ‧
-    { 0, 0, 21, 0, 0, 0, 25755 }, //  
-    { 14, 15, 19, 4, 13, 53, 25755 }, // ‰
-    { 6, 5, 10, 3, 14, 8, 25808 }, // ′
-    { 10, 6, 14, 3, 15, 15, 25816 }, // ″
-    { 12, 6, 14, -2, 14, 18, 25831 }, // ‴
-    { 4, 6, 9, 4, 14, 6, 25849 }, // ‵
-    { 8, 6, 12, 3, 14, 12, 25855 }, // ‶
-    { 12, 6, 17, 4, 14, 18, 25867 }, // ‷
-    { 7, 3, 12, 4, 13, 6, 25885 }, // ‸
-    { 6, 8, 9, 2, 8, 12, 25891 }, // ‹
-    { 6, 8, 7, -1, 8, 12, 25903 }, // ›
-    { 22, 17, 23, 0, 15, 94, 25915 }, // ※
-    { 9, 17, 10, 0, 17, 39, 26009 }, // ‼
-    { 12, 21, 16, 3, 20, 63, 26048 }, // ‽
-    { 9, 2, 14, 4, 14, 5, 26111 }, // ‾
-    { 8, 4, 12, 3, 12, 8, 26116 }, // ‿
-    { 12, 12, 16, 3, 16, 36, 26124 }, // ⁂
-    { 14, 14, 19, 4, 13, 49, 26160 }, // ⁄
-    { 20, 19, 25, 4, 19, 95, 26209 }, // ⁇
-    { 14, 19, 19, 4, 19, 67, 26304 }, // ⁈
-    { 17, 20, 18, 0, 19, 85, 26371 }, // ⁉
-    { 17, 26, 17, -1, 18, 111, 26456 }, // ⁒
-    { 0, 0, 80, 0, 0, 0, 26567 }, //  
-    { 6, 7, 9, 2, 14, 11, 26567 }, // ⁰
-    { 5, 6, 8, 2, 14, 8, 26578 }, // ⁴
-    { 6, 7, 9, 2, 14, 11, 26586 }, // ⁵
-    { 6, 7, 9, 2, 14, 11, 26597 }, // ⁶
-    { 5, 7, 9, 3, 14, 9, 26608 }, // ⁷
-    { 6, 7, 9, 2, 14, 11, 26617 }, // ⁸
-    { 6, 7, 9, 2, 14, 11, 26628 }, // ⁹
-    { 11, 10, 12, 0, 10, 28, 26639 }, // ⁿ
-    { 9, 9, 10, 0, 9, 21, 26667 }, // ₀
-    { 5, 7, 5, -1, 4, 9, 26688 }, // ₁
-    { 6, 7, 6, -1, 4, 11, 26697 }, // ₂
-    { 6, 7, 6, -1, 4, 11, 26708 }, // ₃
-    { 6, 7, 6, -1, 4, 11, 26719 }, // ₄
-    { 6, 7, 6, -1, 4, 11, 26730 }, // ₅
-    { 6, 7, 6, -1, 4, 11, 26741 }, // ₆
-    { 6, 7, 7, 0, 4, 11, 26752 }, // ₇
-    { 6, 7, 6, -1, 4, 11, 26763 }, // ₈
-    { 6, 7, 6, -1, 4, 11, 26774 }, // ₉
-    { 9, 23, 12, 2, 17, 52, 26785 }, // ₍
-    { 10, 23, 7, -4, 17, 58, 26837 }, // ₎
-    { 16, 23, 17, 0, 19, 92, 26895 }, // ₡
-    { 14, 17, 16, 1, 16, 60, 26987 }, // ₢
-    { 14, 16, 15, 0, 16, 56, 27047 }, // ₤
-    { 17, 15, 18, 0, 15, 64, 27103 }, // ₦
-    { 15, 15, 16, 0, 15, 57, 27167 }, // ₧
-    { 19, 15, 20, 0, 15, 72, 27224 }, // ₨
-    { 14, 15, 14, -1, 15, 53, 27296 }, // ₩
-    { 17, 13, 20, 2, 13, 56, 27349 }, // ₪
-    { 13, 14, 15, 1, 14, 46, 27405 }, // ₫
-    { 13, 16, 15, 1, 14, 52, 27451 }, // €
-    { 14, 14, 18, 3, 14, 49, 27503 }, // ₮
-    { 17, 15, 18, 0, 15, 64, 27552 }, // ₱
-    { 14, 21, 17, 1, 18, 74, 27616 }, // ₲
-    { 19, 16, 21, 1, 15, 76, 27690 }, // ₴
-    { 9, 14, 11, 1, 13, 32, 27766 }, // ₵
-    { 16, 15, 20, 3, 15, 60, 27798 }, // ₸
-    { 10, 13, 13, 2, 13, 33, 27858 }, // ₹
-    { 10, 13, 13, 2, 12, 33, 27891 }, // ₺
-    { 12, 13, 14, 1, 13, 39, 27924 }, // ₼
-    { 16, 15, 15, -2, 15, 60, 27963 }, // ₽
-    { 11, 11, 13, -2, 8, 31, 28023 }, // ←
-    { 11, 10, 14, 2, 10, 28, 28054 }, // ↑
-    { 11, 11, 16, 4, 8, 31, 28082 }, // →
-    { 11, 10, 17, 5, 10, 28, 28113 }, // ↓
-    { 18, 9, 18, -1, 8, 41, 28141 }, // ↔
-    { 9, 17, 12, 2, 16, 39, 28182 }, // ↕
-    { 10, 7, 11, -2, 7, 18, 28221 }, // ↖
-    { 11, 7, 14, 2, 7, 20, 28239 }, // ↗
-    { 8, 10, 13, 4, 9, 20, 28259 }, // ↘
-    { 8, 10, 11, -1, 9, 20, 28279 }, // ↙
-    { 13, 11, 14, 0, 10, 36, 28299 }, // ⇐
-    { 13, 12, 17, 3, 12, 39, 28335 }, // ⇑
-    { 13, 11, 16, 2, 10, 36, 28374 }, // ⇒
-    { 13, 13, 20, 6, 12, 43, 28410 }, // ⇓
-    { 17, 11, 18, 0, 10, 47, 28453 }, // ⇔
-    { 11, 16, 16, 4, 10, 44, 28500 }, // ⇕
-    { 13, 14, 15, 1, 14, 46, 28544 }, // ∂
-    { 17, 17, 18, 0, 16, 73, 28590 }, // ∅
-    { 13, 13, 15, 1, 13, 43, 28663 }, // ∆
-    { 13, 12, 16, 2, 12, 39, 28706 }, // ∏
-    { 13, 12, 19, 5, 12, 39, 28745 }, // ∐
-    { 11, 13, 13, 1, 12, 36, 28784 }, // ∑
-    { 8, 3, 11, 2, 6, 6, 28820 }, // −
-    { 16, 14, 19, 2, 13, 56, 28826 }, // √
-    { 15, 8, 18, 2, 10, 30, 28882 }, // ∞
-    { 18, 19, 19, 0, 15, 86, 28912 }, // ∫
-    { 7, 10, 8, 0, 10, 18, 28998 }, // ∶
-    { 12, 9, 16, 3, 9, 27, 29016 }, // ≈
-    { 14, 15, 19, 4, 13, 53, 29043 }, // ≠
-    { 15, 13, 15, -1, 12, 49, 29096 }, // ≤
-    { 14, 13, 16, 1, 12, 46, 29145 }, // ≥
+    { 9, 17, 10, 0, 17, 26, 0 }, // !
+    { 9, 6, 13, 3, 15, 19, 26 }, // "
+    { 19, 15, 22, 2, 14, 58, 45 }, // #
+    { 15, 18, 18, 1, 16, 56, 103 }, // $
+    { 14, 14, 19, 4, 13, 42, 159 }, // %
+    { 14, 16, 17, 2, 15, 47, 201 }, // &
+    { 4, 5, 8, 3, 13, 7, 248 }, // '
+    { 9, 23, 12, 2, 17, 36, 255 }, // (
+    { 10, 23, 7, -4, 17, 39, 291 }, // )
+    { 9, 8, 13, 3, 13, 19, 330 }, // *
+    { 9, 9, 12, 2, 9, 13, 349 }, // +
+    { 6, 6, 7, 0, 3, 10, 362 }, // ,
+    { 9, 2, 12, 2, 6, 7, 372 }, // -
+    { 4, 3, 5, 0, 3, 5, 379 }, // .
+    { 17, 26, 16, -2, 18, 51, 384 }, // /
+    { 12, 13, 14, 1, 13, 41, 435 }, // 0
+    { 8, 13, 10, 1, 13, 23, 476 }, // 1
+    { 12, 13, 14, 1, 13, 31, 499 }, // 2
+    { 12, 13, 14, 1, 13, 30, 530 }, // 3
+    { 10, 13, 13, 2, 13, 28, 560 }, // 4
+    { 11, 13, 13, 1, 13, 28, 588 }, // 5
+    { 12, 13, 14, 1, 13, 33, 616 }, // 6
+    { 9, 13, 14, 4, 13, 21, 649 }, // 7
+    { 12, 13, 14, 1, 13, 39, 670 }, // 8
+    { 11, 13, 14, 2, 13, 36, 709 }, // 9
+    { 7, 10, 8, 0, 10, 9, 745 }, // :
+    { 7, 12, 8, 0, 9, 16, 754 }, // ;
+    { 13, 10, 13, -1, 10, 22, 770 }, // <
+    { 10, 7, 12, 1, 8, 11, 792 }, // =
+    { 13, 10, 15, 1, 10, 22, 803 }, // >
+    { 12, 19, 15, 2, 19, 38, 825 }, // ?
+    { 17, 16, 20, 2, 15, 57, 863 }, // @
+    { 14, 14, 17, 0, 14, 42, 920 }, // A
+    { 13, 14, 14, 0, 14, 42, 962 }, // B
+    { 14, 17, 16, 1, 16, 35, 1004 }, // C
+    { 15, 15, 16, 0, 15, 42, 1039 }, // D
+    { 14, 15, 15, 0, 15, 30, 1081 }, // E
+    { 13, 15, 14, 0, 15, 30, 1111 }, // F
+    { 14, 15, 17, 1, 15, 40, 1141 }, // G
+    { 16, 15, 17, 0, 15, 45, 1181 }, // H
+    { 8, 15, 9, 0, 15, 23, 1226 }, // I
+    { 12, 19, 12, -1, 15, 36, 1249 }, // J
+    { 14, 15, 15, 0, 15, 41, 1285 }, // K
+    { 11, 15, 13, 0, 15, 26, 1326 }, // L
+    { 18, 15, 19, 0, 15, 61, 1352 }, // M
+    { 17, 15, 18, 0, 15, 51, 1413 }, // N
+    { 16, 16, 18, 1, 15, 50, 1464 }, // O
+    { 14, 15, 15, 0, 15, 36, 1514 }, // P
+    { 16, 18, 18, 1, 15, 52, 1550 }, // Q
+    { 13, 14, 14, 0, 14, 43, 1602 }, // R
+    { 15, 16, 16, 0, 15, 40, 1645 }, // S
+    { 14, 14, 18, 3, 14, 29, 1685 }, // T
+    { 15, 16, 17, 1, 15, 45, 1714 }, // U
+    { 14, 15, 19, 4, 15, 38, 1759 }, // V
+    { 19, 14, 23, 3, 14, 57, 1797 }, // W
+    { 17, 15, 18, 0, 15, 42, 1854 }, // X
+    { 12, 14, 17, 4, 14, 32, 1896 }, // Y
+    { 17, 14, 18, 0, 14, 36, 1928 }, // Z
+    { 13, 23, 13, -1, 18, 46, 1964 }, // [
+    { 3, 16, 8, 4, 13, 22, 2010 }, // <backslash>
+    { 12, 23, 9, -4, 18, 45, 2032 }, // ]
+    { 7, 4, 11, 3, 15, 7, 2077 }, // ^
+    { 12, 3, 13, 0, -1, 9, 2084 }, // _
+    { 5, 3, 10, 4, 13, 4, 2093 }, // `
+    { 11, 11, 13, 0, 11, 30, 2097 }, // a
+    { 10, 16, 13, 2, 15, 34, 2127 }, // b
+    { 9, 12, 11, 1, 11, 18, 2161 }, // c
+    { 13, 16, 15, 1, 15, 42, 2179 }, // d
+    { 11, 10, 13, 1, 10, 29, 2221 }, // e
+    { 9, 14, 11, 1, 14, 22, 2250 }, // f
+    { 12, 15, 13, 0, 10, 37, 2272 }, // g
+    { 12, 15, 13, 0, 15, 40, 2309 }, // h
+    { 7, 15, 8, 0, 15, 21, 2349 }, // i
+    { 11, 20, 13, 1, 15, 34, 2370 }, // j
+    { 10, 14, 13, 0, 14, 27, 2404 }, // k
+    { 7, 14, 8, 0, 14, 22, 2431 }, // l
+    { 17, 10, 18, 0, 10, 45, 2453 }, // m
+    { 11, 10, 12, 0, 10, 30, 2498 }, // n
+    { 11, 10, 13, 1, 10, 28, 2528 }, // o
+    { 14, 15, 14, -1, 10, 40, 2556 }, // p
+    { 12, 14, 15, 1, 10, 40, 2596 }, // q
+    { 9, 10, 10, 0, 10, 16, 2636 }, // r
+    { 11, 10, 12, 0, 10, 24, 2652 }, // s
+    { 8, 13, 11, 2, 13, 21, 2676 }, // t
+    { 11, 10, 13, 1, 10, 28, 2697 }, // u
+    { 11, 10, 15, 3, 10, 24, 2725 }, // v
+    { 13, 10, 17, 3, 10, 27, 2749 }, // w
+    { 13, 10, 14, 0, 10, 30, 2776 }, // x
+    { 13, 15, 14, 0, 10, 35, 2806 }, // y
+    { 12, 10, 13, 0, 10, 19, 2841 }, // z
+    { 10, 16, 13, 2, 13, 25, 2860 }, // {
+    { 7, 15, 8, 0, 12, 20, 2885 }, // |
+    { 9, 16, 11, 0, 13, 25, 2905 }, // }
+    { 7, 4, 11, 3, 13, 10, 2930 }, // ~
+    { 0, 0, 14, 0, 0, 0, 2940 }, //  
+    { 7, 18, 9, 1, 13, 26, 2940 }, // ¡
+    { 9, 16, 11, 1, 14, 30, 2966 }, // ¢
+    { 14, 16, 15, 0, 16, 39, 2996 }, // £
+    { 10, 8, 13, 2, 10, 23, 3035 }, // ¤
+    { 13, 15, 16, 2, 13, 28, 3058 }, // ¥
+    { 7, 15, 8, 0, 12, 18, 3086 }, // ¦
+    { 14, 15, 15, 0, 13, 36, 3104 }, // §
+    { 9, 3, 13, 3, 13, 9, 3140 }, // ¨
+    { 8, 7, 13, 4, 16, 19, 3149 }, // ©
+    { 7, 6, 10, 2, 13, 13, 3168 }, // ª
+    { 12, 8, 14, 1, 8, 24, 3181 }, // «
+    { 9, 5, 12, 2, 6, 11, 3205 }, // ¬
+    { 9, 2, 12, 2, 6, 7, 3216 }, // ­
+    { 8, 7, 13, 4, 18, 21, 3223 }, // ®
+    { 7, 3, 12, 4, 13, 3, 3244 }, // ¯
+    { 9, 8, 12, 2, 14, 21, 3247 }, // °
+    { 11, 10, 12, 0, 9, 16, 3268 }, // ±
+    { 5, 7, 8, 2, 14, 10, 3284 }, // ²
+    { 6, 7, 9, 2, 14, 11, 3294 }, // ³
+    { 5, 4, 9, 3, 13, 6, 3305 }, // ´
+    { 13, 12, 13, -1, 10, 33, 3311 }, // µ
+    { 12, 14, 13, 0, 12, 39, 3344 }, // ¶
+    { 5, 3, 7, 1, 7, 5, 3383 }, // ·
+    { 5, 5, 6, 0, 1, 7, 3388 }, // ¸
+    { 4, 7, 7, 2, 14, 9, 3395 }, // ¹
+    { 6, 6, 10, 3, 12, 12, 3404 }, // º
+    { 11, 8, 11, -2, 8, 25, 3416 }, // »
+    { 14, 16, 19, 4, 15, 50, 3441 }, // ¼
+    { 15, 15, 20, 4, 14, 50, 3491 }, // ½
+    { 15, 15, 19, 3, 14, 49, 3541 }, // ¾
+    { 11, 19, 11, -1, 10, 34, 3590 }, // ¿
+    { 14, 19, 17, 0, 19, 50, 3624 }, // À
+    { 15, 22, 17, 0, 22, 54, 3674 }, // Á
+    { 15, 19, 17, 0, 19, 53, 3728 }, // Â
+    { 15, 19, 17, 0, 19, 54, 3781 }, // Ã
+    { 16, 19, 17, 0, 19, 56, 3835 }, // Ä
+    { 14, 20, 17, 0, 20, 52, 3891 }, // Å
+    { 23, 16, 24, 0, 15, 54, 3943 }, // Æ
+    { 14, 20, 16, 1, 16, 43, 3997 }, // Ç
+    { 14, 19, 15, 0, 19, 37, 4040 }, // È
+    { 14, 22, 15, 0, 22, 40, 4077 }, // É
+    { 14, 18, 15, 0, 18, 38, 4117 }, // Ê
+    { 14, 19, 15, 0, 19, 40, 4155 }, // Ë
+    { 9, 21, 10, 0, 21, 29, 4195 }, // Ì
+    { 10, 24, 11, 0, 24, 31, 4224 }, // Í
+    { 10, 20, 11, 0, 20, 31, 4255 }, // Î
+    { 11, 21, 12, 0, 21, 34, 4286 }, // Ï
+    { 15, 15, 16, 0, 15, 43, 4320 }, // Ð
+    { 17, 18, 18, 0, 18, 64, 4363 }, // Ñ
+    { 16, 21, 18, 1, 20, 58, 4427 }, // Ò
+    { 16, 24, 18, 1, 23, 61, 4485 }, // Ó
+    { 16, 20, 18, 1, 19, 60, 4546 }, // Ô
+    { 16, 21, 18, 1, 20, 63, 4606 }, // Õ
+    { 16, 21, 18, 1, 20, 63, 4669 }, // Ö
+    { 9, 5, 11, 1, 7, 12, 4732 }, // ×
+    { 29, 29, 24, -6, 22, 108, 4744 }, // Ø
+    { 15, 20, 17, 1, 19, 51, 4852 }, // Ù
+    { 15, 23, 17, 1, 22, 55, 4903 }, // Ú
+    { 15, 20, 17, 1, 19, 53, 4958 }, // Û
+    { 15, 20, 17, 1, 19, 56, 5011 }, // Ü
+    { 12, 23, 17, 4, 23, 43, 5067 }, // Ý
+    { 11, 13, 12, 0, 13, 31, 5110 }, // Þ
+    { 12, 13, 14, 1, 13, 41, 5141 }, // ß
+    { 11, 14, 13, 0, 14, 37, 5182 }, // à
+    { 11, 17, 13, 0, 17, 37, 5219 }, // á
+    { 12, 14, 13, 0, 14, 37, 5256 }, // â
+    { 12, 13, 13, 0, 13, 37, 5293 }, // ã
+    { 12, 14, 13, 0, 14, 40, 5330 }, // ä
+    { 11, 15, 13, 0, 15, 38, 5370 }, // å
+    { 18, 11, 20, 0, 11, 46, 5408 }, // æ
+    { 9, 15, 11, 1, 11, 23, 5454 }, // ç
+    { 11, 16, 13, 1, 16, 37, 5477 }, // è
+    { 11, 19, 13, 1, 19, 38, 5514 }, // é
+    { 11, 15, 13, 1, 15, 37, 5552 }, // ê
+    { 12, 16, 14, 1, 16, 41, 5589 }, // ë
+    { 7, 14, 8, 0, 14, 19, 5630 }, // ì
+    { 9, 17, 10, 0, 17, 22, 5649 }, // í
+    { 9, 13, 10, 0, 13, 20, 5671 }, // î
+    { 9, 14, 10, 0, 14, 25, 5691 }, // ï
+    { 15, 14, 17, 1, 14, 41, 5716 }, // ð
+    { 13, 14, 14, 0, 14, 38, 5757 }, // ñ
+    { 11, 16, 13, 1, 16, 36, 5795 }, // ò
+    { 11, 19, 13, 1, 19, 37, 5831 }, // ó
+    { 11, 15, 13, 1, 15, 36, 5868 }, // ô
+    { 11, 16, 13, 1, 16, 39, 5904 }, // õ
+    { 12, 16, 14, 1, 16, 41, 5943 }, // ö
+    { 11, 10, 14, 2, 10, 18, 5984 }, // ÷
+    { 16, 27, 15, -2, 18, 64, 6002 }, // ø
+    { 11, 15, 13, 1, 15, 35, 6066 }, // ù
+    { 11, 18, 13, 1, 18, 36, 6101 }, // ú
+    { 11, 14, 13, 1, 14, 35, 6137 }, // û
+    { 11, 15, 13, 1, 15, 38, 6172 }, // ü
+    { 13, 24, 14, 0, 19, 46, 6210 }, // ý
+    { 11, 18, 12, 0, 14, 39, 6256 }, // þ
+    { 13, 21, 14, 0, 16, 48, 6295 }, // ÿ
+    { 16, 19, 17, 0, 19, 50, 6343 }, // Ā
+    { 12, 13, 13, 0, 13, 35, 6393 }, // ā
+    { 16, 21, 17, 0, 21, 55, 6428 }, // Ă
+    { 12, 15, 13, 0, 15, 39, 6483 }, // ă
+    { 14, 19, 17, 0, 14, 51, 6522 }, // Ą
+    { 11, 15, 13, 0, 11, 36, 6573 }, // ą
+    { 14, 24, 16, 1, 23, 45, 6609 }, // Ć
+    { 10, 17, 12, 1, 16, 24, 6654 }, // ć
+    { 15, 22, 17, 1, 21, 45, 6678 }, // Ĉ
+    { 11, 16, 13, 1, 15, 27, 6723 }, // ĉ
+    { 14, 23, 16, 1, 22, 44, 6750 }, // Ċ
+    { 9, 16, 11, 1, 15, 24, 6794 }, // ċ
+    { 14, 24, 16, 1, 23, 46, 6818 }, // Č
+    { 10, 17, 12, 1, 16, 27, 6864 }, // č
+    { 15, 21, 16, 0, 21, 53, 6891 }, // Ď
+    { 16, 16, 18, 1, 15, 49, 6944 }, // ď
+    { 15, 15, 16, 0, 15, 43, 6993 }, // Đ
+    { 15, 16, 17, 1, 15, 45, 7036 }, // đ
+    { 14, 19, 15, 0, 19, 37, 7081 }, // Ē
+    { 12, 15, 14, 1, 15, 36, 7118 }, // ē
+    { 14, 21, 15, 0, 21, 41, 7154 }, // Ĕ
+    { 12, 17, 14, 1, 17, 41, 7195 }, // ĕ
+    { 14, 20, 15, 0, 20, 39, 7236 }, // Ė
+    { 11, 16, 13, 1, 16, 36, 7275 }, // ė
+    { 14, 19, 15, 0, 15, 36, 7311 }, // Ę
+    { 11, 15, 13, 1, 10, 37, 7347 }, // ę
+    { 14, 21, 15, 0, 21, 40, 7384 }, // Ě
+    { 11, 17, 13, 1, 17, 39, 7424 }, // ě
+    { 15, 19, 17, 1, 19, 49, 7463 }, // Ĝ
+    { 13, 20, 14, 0, 15, 46, 7512 }, // ĝ
+    { 15, 21, 17, 1, 21, 51, 7558 }, // Ğ
+    { 12, 21, 13, 0, 16, 49, 7609 }, // ğ
+    { 14, 20, 17, 1, 20, 49, 7658 }, // Ġ
+    { 12, 20, 13, 0, 15, 45, 7707 }, // ġ
+    { 14, 23, 17, 1, 15, 54, 7752 }, // Ģ
+    { 12, 21, 13, 0, 16, 47, 7806 }, // ģ
+    { 16, 19, 17, 0, 19, 53, 7853 }, // Ĥ
+    { 12, 19, 13, 0, 19, 48, 7906 }, // ĥ
+    { 16, 15, 17, 0, 15, 47, 7954 }, // Ħ
+    { 12, 15, 13, 0, 15, 43, 8001 }, // ħ
+    { 10, 21, 11, 0, 21, 34, 8044 }, // Ĩ
+    { 9, 15, 10, 0, 15, 25, 8078 }, // ĩ
+    { 11, 20, 12, 0, 20, 29, 8103 }, // Ī
+    { 9, 14, 10, 0, 14, 20, 8132 }, // ī
+    { 8, 19, 11, 2, 15, 29, 8152 }, // Į
+    { 8, 19, 8, -1, 15, 25, 8181 }, // į
+    { 9, 21, 10, 0, 21, 29, 8206 }, // İ
+    { 6, 10, 7, 0, 10, 14, 8235 }, // ı
+    { 14, 19, 15, 0, 15, 52, 8249 }, // Ĳ
+    { 16, 20, 17, 0, 15, 51, 8301 }, // ĳ
+    { 14, 23, 14, -1, 19, 48, 8352 }, // Ĵ
+    { 14, 20, 16, 1, 15, 41, 8400 }, // ĵ
+    { 14, 21, 15, 0, 15, 52, 8441 }, // Ķ
+    { 10, 22, 13, 0, 14, 37, 8493 }, // ķ
+    { 8, 9, 9, 0, 9, 23, 8530 }, // ĸ
+    { 11, 20, 13, 0, 20, 35, 8553 }, // Ĺ
+    { 10, 20, 11, 0, 20, 28, 8588 }, // ĺ
+    { 11, 22, 13, 0, 15, 35, 8616 }, // Ļ
+    { 7, 21, 8, 0, 14, 30, 8651 }, // ļ
+    { 12, 15, 13, 0, 15, 34, 8681 }, // Ľ
+    { 11, 14, 12, 0, 14, 28, 8715 }, // ľ
+    { 12, 14, 13, 0, 14, 33, 8743 }, // Ŀ
+    { 10, 14, 11, 0, 14, 28, 8776 }, // ŀ
+    { 23, 21, 16, -8, 17, 67, 8804 }, // Ł
+    { 16, 14, 11, -6, 14, 35, 8871 }, // ł
+    { 17, 20, 18, 0, 20, 62, 8906 }, // Ń
+    { 12, 16, 13, 0, 16, 39, 8968 }, // ń
+    { 17, 21, 18, 0, 15, 63, 9007 }, // Ņ
+    { 11, 16, 12, 0, 10, 38, 9070 }, // ņ
+    { 17, 20, 18, 0, 20, 62, 9108 }, // Ň
+    { 12, 16, 13, 0, 16, 40, 9170 }, // ň
+    { 12, 18, 11, -2, 18, 38, 9210 }, // ŉ
+    { 17, 19, 18, 0, 15, 60, 9248 }, // Ŋ
+    { 11, 14, 12, 0, 10, 35, 9308 }, // ŋ
+    { 16, 20, 18, 1, 19, 57, 9343 }, // Ō
+    { 12, 15, 14, 1, 15, 37, 9400 }, // ō
+    { 16, 22, 18, 1, 21, 63, 9437 }, // Ŏ
+    { 12, 18, 14, 1, 18, 39, 9500 }, // ŏ
+    { 17, 21, 19, 1, 20, 63, 9539 }, // Ő
+    { 14, 17, 16, 1, 17, 38, 9602 }, // ő
+    { 22, 15, 24, 1, 15, 54, 9640 }, // Œ
+    { 18, 11, 20, 1, 11, 48, 9694 }, // œ
+    { 13, 20, 14, 0, 20, 52, 9742 }, // Ŕ
+    { 9, 14, 10, 0, 14, 21, 9794 }, // ŕ
+    { 13, 22, 14, 0, 14, 55, 9815 }, // Ŗ
+    { 10, 19, 10, -1, 10, 26, 9870 }, // ŗ
+    { 13, 20, 14, 0, 20, 53, 9896 }, // Ř
+    { 9, 14, 10, 0, 14, 25, 9949 }, // ř
+    { 15, 22, 16, 0, 21, 50, 9974 }, // Ś
+    { 11, 16, 12, 0, 16, 31, 10024 }, // ś
+    { 16, 21, 17, 0, 20, 51, 10055 }, // Ŝ
+    { 11, 15, 12, 0, 15, 33, 10106 }, // ŝ
+    { 15, 19, 16, 0, 15, 46, 10139 }, // Ş
+    { 11, 14, 12, 0, 10, 31, 10185 }, // ş
+    { 15, 23, 16, 0, 22, 52, 10216 }, // Š
+    { 11, 16, 12, 0, 16, 33, 10268 }, // š
+    { 14, 17, 18, 3, 14, 34, 10301 }, // Ţ
+    { 8, 16, 11, 2, 13, 26, 10335 }, // ţ
+    { 14, 20, 18, 3, 20, 39, 10361 }, // Ť
+    { 10, 14, 13, 2, 14, 27, 10400 }, // ť
+    { 14, 14, 18, 3, 14, 31, 10427 }, // Ŧ
+    { 9, 13, 11, 1, 13, 23, 10458 }, // ŧ
+    { 15, 21, 17, 1, 20, 58, 10481 }, // Ũ
+    { 11, 15, 13, 1, 15, 38, 10539 }, // ũ
+    { 15, 20, 17, 1, 19, 51, 10577 }, // Ū
+    { 11, 14, 13, 1, 14, 33, 10628 }, // ū
+    { 15, 22, 17, 1, 21, 59, 10661 }, // Ŭ
+    { 11, 16, 13, 1, 16, 38, 10720 }, // ŭ
+    { 15, 22, 17, 1, 21, 56, 10758 }, // Ů
+    { 11, 16, 13, 1, 16, 36, 10814 }, // ů
+    { 16, 21, 18, 1, 20, 55, 10850 }, // Ű
+    { 13, 15, 15, 1, 15, 40, 10905 }, // ű
+    { 15, 19, 17, 1, 15, 50, 10945 }, // Ų
+    { 11, 15, 13, 1, 10, 34, 10995 }, // ų
+    { 19, 18, 23, 3, 18, 66, 11029 }, // Ŵ
+    { 13, 14, 17, 3, 14, 37, 11095 }, // ŵ
+    { 12, 19, 17, 4, 19, 40, 11132 }, // Ŷ
+    { 13, 21, 14, 0, 16, 44, 11172 }, // ŷ
+    { 12, 20, 17, 4, 20, 43, 11216 }, // Ÿ
+    { 17, 20, 18, 0, 20, 46, 11259 }, // Ź
+    { 12, 16, 13, 0, 16, 27, 11305 }, // ź
+    { 17, 19, 18, 0, 19, 46, 11332 }, // Ż
+    { 12, 15, 13, 0, 15, 26, 11378 }, // ż
+    { 17, 20, 18, 0, 20, 48, 11404 }, // Ž
+    { 12, 16, 13, 0, 16, 28, 11452 }, // ž
+    { 9, 14, 12, 2, 14, 21, 11480 }, // ſ
+    { 20, 17, 22, 1, 16, 59, 11501 }, // Ơ
+    { 12, 11, 14, 1, 11, 32, 11560 }, // ơ
+    { 14, 15, 15, 0, 15, 39, 11592 }, // Ƥ
+    { 14, 18, 14, -1, 13, 46, 11631 }, // ƥ
+    { 11, 13, 13, 1, 12, 24, 11677 }, // Ʃ
+    { 14, 14, 18, 3, 14, 31, 11701 }, // Ƭ
+    { 9, 15, 12, 2, 15, 25, 11732 }, // ƭ
+    { 14, 18, 18, 3, 14, 38, 11757 }, // Ʈ
+    { 18, 16, 20, 1, 15, 48, 11795 }, // Ư
+    { 12, 12, 14, 1, 12, 30, 11843 }, // ư
+    { 5, 3, 10, 4, 13, 4, 11873 }, // ̀
+    { 5, 4, 9, 3, 13, 6, 11877 }, // ́
+    { 8, 4, 8, -1, 0, 7, 11883 }, // ̂
+    { 7, 4, 11, 3, 13, 10, 11890 }, // ̃
+    { 8, 3, 12, 3, 12, 5, 11900 }, // ̄
+    { 11, 3, 17, 5, 15, 4, 11905 }, // ̅
+    { 8, 4, 12, 3, 13, 9, 11909 }, // ̆
+    { 4, 3, 8, 3, 13, 5, 11918 }, // ̇
+    { 9, 3, 13, 3, 13, 9, 11923 }, // ̈
+    { 4, 4, 8, 3, 11, 7, 11932 }, // ̉
+    { 5, 4, 9, 3, 13, 9, 11939 }, // ̊
+    { 12, 3, 16, 3, 13, 8, 11948 }, // ̋
+    { 8, 4, 12, 3, 13, 7, 11956 }, // ̌
+    { 12, 3, 8, -5, 14, 10, 11963 }, // ̏
+    { 6, 5, 9, 2, 13, 8, 11973 }, // ̒
+    { 6, 5, 9, 2, 12, 9, 11981 }, // ̓
+    { 6, 5, 4, -3, 12, 8, 11990 }, // ̔
+    { 4, 5, 5, 0, 0, 4, 11998 }, // ̘
+    { 4, 5, 6, 1, 0, 5, 12002 }, // ̙
+    { 8, 4, 13, 4, 13, 9, 12007 }, // ̚
+    { 3, 4, 7, 3, 11, 5, 12016 }, // ̛
+    { 3, 3, 4, 0, -1, 4, 12021 }, // ̜
+    { 4, 4, 7, 2, 3, 5, 12025 }, // ̝
+    { 4, 4, 5, 0, 0, 6, 12030 }, // ̞
+    { 4, 4, 5, 0, -1, 5, 12036 }, // ̟
+    { 8, 3, 9, 0, -2, 5, 12041 }, // ̠
+    { 4, 3, 5, 0, 1, 5, 12046 }, // ̣
+    { 9, 3, 9, -1, 0, 10, 12051 }, // ̤
+    { 5, 4, 9, 3, 13, 9, 12061 }, // ̥
+    { 6, 6, 7, 0, 3, 10, 12070 }, // ̦
+    { 5, 5, 6, 0, 1, 7, 12080 }, // ̧
+    { 5, 5, 6, 0, 0, 7, 12087 }, // ̨
+    { 4, 5, 4, -1, -1, 7, 12094 }, // ̩
+    { 6, 3, 7, 0, -1, 7, 12101 }, // ̪
+    { 7, 4, 8, 0, 0, 7, 12108 }, // ̬
+    { 8, 4, 8, -1, 0, 7, 12115 }, // ̭
+    { 7, 4, 11, 3, 13, 10, 12122 }, // ̰
+    { 7, 3, 12, 4, 13, 3, 12132 }, // ̱
+    { 7, 3, 8, 0, -1, 2, 12135 }, // ̲
+    { 7, 4, 11, 3, 13, 10, 12137 }, // ̴
+    { 9, 2, 12, 2, 6, 7, 12147 }, // ̵
+    { 3, 3, 5, 1, -1, 4, 12154 }, // ̹
+    { 6, 4, 6, -1, 0, 7, 12158 }, // ̺
+    { 6, 4, 7, 0, 0, 10, 12165 }, // ̻
+    { 6, 4, 7, 0, 0, 10, 12175 }, // ̼
+    { 5, 4, 9, 3, 13, 6, 12185 }, // ̽
+    { 7, 4, 11, 3, 13, 10, 12191 }, // ͂
+    { 4, 3, 8, 3, 14, 4, 12201 }, // ̓
+    { 9, 8, 13, 3, 18, 15, 12205 }, // ̈́
+    { 6, 3, 11, 4, 13, 6, 12220 }, // ͆
+    { 10, 6, 10, -1, 0, 10, 12226 }, // ͇
+    { 8, 5, 9, 0, 0, 16, 12236 }, // ͈
+    { 6, 5, 7, 0, -1, 7, 12252 }, // ͉
+    { 8, 10, 12, 3, 16, 18, 12259 }, // ͊
+    { 16, 7, 22, 5, 15, 22, 12277 }, // ͋
+    { 12, 9, 16, 3, 9, 22, 12299 }, // ͌
+    { 9, 5, 11, 1, 0, 7, 12321 }, // ͍
+    { 3, 3, 6, 2, 2, 3, 12328 }, // ͎
+    { 14, 3, 16, 1, 0, 11, 12331 }, // ͜
+    { 14, 3, 18, 3, 13, 10, 12342 }, // ͡
+    { 17, 5, 18, 0, -1, 10, 12352 }, // ͢
+    { 14, 14, 17, 0, 14, 42, 12362 }, // Α
+    { 13, 14, 14, 0, 14, 42, 12404 }, // Β
+    { 11, 14, 13, 1, 13, 29, 12446 }, // Γ
+    { 13, 13, 15, 1, 13, 37, 12475 }, // Δ
+    { 14, 15, 15, 0, 15, 30, 12512 }, // Ε
+    { 17, 14, 18, 0, 14, 36, 12542 }, // Ζ
+    { 16, 15, 17, 0, 15, 45, 12578 }, // Η
+    { 16, 16, 18, 1, 15, 55, 12623 }, // Θ
+    { 8, 15, 9, 0, 15, 23, 12678 }, // Ι
+    { 14, 15, 15, 0, 15, 41, 12701 }, // Κ
+    { 14, 15, 17, 0, 15, 40, 12742 }, // Λ
+    { 18, 15, 19, 0, 15, 61, 12782 }, // Μ
+    { 17, 15, 18, 0, 15, 51, 12843 }, // Ν
+    { 13, 12, 15, 1, 12, 23, 12894 }, // Ξ
+    { 16, 16, 18, 1, 15, 50, 12917 }, // Ο
+    { 12, 12, 14, 1, 12, 34, 12967 }, // Π
+    { 14, 15, 15, 0, 15, 36, 13001 }, // Ρ
+    { 11, 13, 13, 1, 12, 24, 13037 }, // Σ
+    { 14, 14, 18, 3, 14, 29, 13061 }, // Τ
+    { 12, 14, 17, 4, 14, 32, 13090 }, // Υ
+    { 19, 18, 22, 2, 16, 63, 13122 }, // Φ
+    { 17, 15, 18, 0, 15, 42, 13185 }, // Χ
+    { 14, 15, 17, 2, 13, 44, 13227 }, // Ψ
+    { 15, 14, 16, 0, 13, 42, 13271 }, // Ω
+    { 14, 12, 16, 0, 11, 33, 13313 }, // α
+    { 12, 20, 13, 0, 16, 51, 13346 }, // β
+    { 9, 15, 13, 3, 10, 31, 13397 }, // γ
+    { 12, 15, 14, 1, 15, 40, 13428 }, // δ
+    { 8, 9, 10, 1, 9, 18, 13468 }, // ε
+    { 11, 14, 13, 1, 12, 26, 13486 }, // ζ
+    { 11, 16, 14, 2, 11, 36, 13512 }, // η
+    { 12, 13, 14, 1, 13, 37, 13548 }, // θ
+    { 6, 11, 9, 0, 11, 17, 13585 }, // ι
+    { 9, 10, 10, 0, 10, 25, 13602 }, // κ
+    { 13, 14, 13, -6, 14, 33, 13627 }, // λ
+    { 13, 12, 13, -1, 10, 33, 13660 }, // μ
+    { 9, 10, 13, 3, 10, 23, 13693 }, // ν
+    { 9, 15, 12, 2, 12, 26, 13716 }, // ξ
+    { 11, 10, 13, 1, 10, 28, 13742 }, // ο
+    { 11, 10, 14, 2, 9, 25, 13770 }, // π
+    { 13, 14, 14, 0, 10, 36, 13795 }, // ρ
+    { 8, 12, 12, 3, 12, 19, 13831 }, // ς
+    { 15, 10, 17, 1, 10, 30, 13850 }, // σ
+    { 9, 10, 13, 3, 9, 16, 13880 }, // τ
+    { 8, 10, 11, 2, 10, 27, 13896 }, // υ
+    { 16, 21, 18, 1, 19, 71, 13923 }, // φ
+    { 14, 13, 15, 0, 9, 32, 13994 }, // χ
+    { 10, 16, 13, 2, 12, 43, 14026 }, // ψ
+    { 13, 10, 15, 1, 9, 31, 14069 }, // ω
+    { 14, 19, 17, 0, 14, 50, 14100 }, // Ạ
+    { 11, 16, 13, 0, 11, 36, 14150 }, // ạ
+    { 15, 21, 17, 0, 21, 53, 14186 }, // Ả
+    { 11, 16, 13, 0, 16, 40, 14239 }, // ả
+    { 18, 24, 19, 0, 24, 64, 14279 }, // Ấ
+    { 17, 19, 18, 0, 19, 50, 14343 }, // ấ
+    { 15, 22, 17, 0, 22, 61, 14393 }, // Ầ
+    { 12, 16, 13, 0, 16, 42, 14454 }, // ầ
+    { 18, 23, 19, 0, 23, 63, 14496 }, // Ẩ
+    { 12, 17, 13, 0, 17, 43, 14559 }, // ẩ
+    { 15, 23, 17, 0, 23, 63, 14602 }, // Ẫ
+    { 11, 17, 13, 0, 17, 46, 14665 }, // ẫ
+    { 15, 24, 17, 0, 19, 61, 14711 }, // Ậ
+    { 11, 18, 13, 0, 13, 44, 14772 }, // ậ
+    { 16, 27, 17, 0, 27, 64, 14816 }, // Ắ
+    { 12, 21, 13, 0, 21, 48, 14880 }, // ắ
+    { 16, 25, 17, 0, 25, 62, 14928 }, // Ằ
+    { 12, 20, 13, 0, 20, 47, 14990 }, // ằ
+    { 16, 26, 17, 0, 26, 63, 15037 }, // Ẳ
+    { 12, 22, 13, 0, 22, 51, 15100 }, // ẳ
+    { 16, 26, 17, 0, 26, 70, 15151 }, // Ẵ
+    { 12, 20, 13, 0, 20, 50, 15221 }, // ẵ
+    { 16, 26, 17, 0, 21, 63, 15271 }, // Ặ
+    { 12, 20, 13, 0, 15, 46, 15334 }, // ặ
+    { 14, 19, 15, 0, 15, 37, 15380 }, // Ẹ
+    { 11, 15, 13, 1, 10, 36, 15417 }, // ẹ
+    { 14, 20, 15, 0, 20, 38, 15453 }, // Ẻ
+    { 11, 17, 13, 1, 17, 38, 15491 }, // ẻ
+    { 14, 19, 15, 0, 19, 39, 15529 }, // Ẽ
+    { 11, 16, 13, 1, 16, 40, 15568 }, // ẽ
+    { 14, 23, 15, 0, 23, 46, 15608 }, // Ế
+    { 17, 17, 19, 1, 17, 47, 15654 }, // ế
+    { 14, 21, 15, 0, 21, 43, 15701 }, // Ề
+    { 11, 18, 13, 1, 18, 42, 15744 }, // ề
+    { 14, 22, 15, 0, 22, 46, 15786 }, // Ể
+    { 12, 19, 14, 1, 19, 44, 15832 }, // ể
+    { 14, 23, 15, 0, 23, 49, 15876 }, // Ễ
+    { 11, 19, 13, 1, 19, 46, 15925 }, // ễ
+    { 14, 22, 15, 0, 18, 44, 15971 }, // Ệ
+    { 12, 21, 14, 1, 16, 46, 16015 }, // ệ
+    { 10, 22, 11, 0, 22, 30, 16061 }, // Ỉ
+    { 8, 15, 9, 0, 15, 20, 16091 }, // ỉ
+    { 9, 19, 9, -1, 15, 29, 16111 }, // Ị
+    { 8, 19, 8, -1, 15, 26, 16140 }, // ị
+    { 16, 20, 18, 1, 15, 57, 16166 }, // Ọ
+    { 11, 15, 13, 1, 10, 34, 16223 }, // ọ
+    { 16, 22, 18, 1, 21, 60, 16257 }, // Ỏ
+    { 11, 17, 13, 1, 17, 37, 16317 }, // ỏ
+    { 20, 20, 22, 1, 19, 68, 16354 }, // Ố
+    { 17, 17, 19, 1, 17, 47, 16422 }, // ố
+    { 16, 24, 18, 1, 23, 66, 16469 }, // Ồ
+    { 11, 18, 13, 1, 18, 43, 16535 }, // ồ
+    { 20, 23, 22, 1, 22, 71, 16578 }, // Ổ
+    { 12, 20, 14, 1, 20, 46, 16649 }, // ổ
+    { 16, 24, 18, 1, 23, 70, 16695 }, // Ỗ
+    { 11, 20, 13, 1, 20, 46, 16765 }, // ỗ
+    { 16, 24, 18, 1, 19, 67, 16811 }, // Ộ
+    { 11, 20, 13, 1, 15, 43, 16878 }, // ộ
+    { 20, 23, 22, 1, 22, 71, 16921 }, // Ớ
+    { 12, 18, 14, 1, 18, 41, 16992 }, // ớ
+    { 20, 22, 22, 1, 21, 69, 17033 }, // Ờ
+    { 12, 16, 14, 1, 16, 40, 17102 }, // ờ
+    { 20, 22, 22, 1, 21, 70, 17142 }, // Ở
+    { 12, 17, 14, 1, 17, 40, 17212 }, // ở
+    { 20, 21, 22, 1, 20, 72, 17252 }, // Ỡ
+    { 12, 16, 14, 1, 16, 43, 17324 }, // ỡ
+    { 20, 21, 22, 1, 16, 67, 17367 }, // Ợ
+    { 12, 16, 14, 1, 11, 38, 17434 }, // ợ
+    { 15, 20, 17, 1, 15, 52, 17472 }, // Ụ
+    { 11, 14, 13, 1, 10, 32, 17524 }, // ụ
+    { 15, 22, 17, 1, 21, 56, 17556 }, // Ủ
+    { 11, 16, 13, 1, 16, 35, 17612 }, // ủ
+    { 18, 22, 20, 1, 21, 58, 17647 }, // Ứ
+    { 12, 17, 14, 1, 17, 37, 17705 }, // ứ
+    { 18, 21, 20, 1, 20, 55, 17742 }, // Ừ
+    { 12, 15, 14, 1, 15, 37, 17797 }, // ừ
+    { 18, 22, 20, 1, 21, 59, 17834 }, // Ử
+    { 12, 16, 14, 1, 16, 36, 17893 }, // ử
+    { 18, 21, 20, 1, 20, 61, 17929 }, // Ữ
+    { 12, 15, 14, 1, 15, 39, 17990 }, // ữ
+    { 18, 20, 20, 1, 15, 55, 18029 }, // Ự
+    { 12, 16, 14, 1, 12, 36, 18084 }, // ự
+    { 12, 19, 17, 4, 19, 40, 18120 }, // Ỳ
+    { 13, 21, 14, 0, 16, 43, 18160 }, // ỳ
+    { 14, 21, 17, 2, 14, 46, 18203 }, // Ỵ
+    { 13, 15, 14, 0, 10, 39, 18249 }, // ỵ
+    { 12, 21, 17, 4, 21, 42, 18288 }, // Ỷ
+    { 13, 23, 14, 0, 18, 47, 18330 }, // ỷ
+    { 12, 20, 17, 4, 20, 43, 18377 }, // Ỹ
+    { 13, 22, 14, 0, 17, 46, 18420 }, // ỹ
+    { 0, 0, 14, 0, 0, 0, 18466 }, //  
+    { 0, 0, 22, 0, 0, 0, 18466 }, //  
+    { 0, 0, 14, 0, 0, 0, 18466 }, //  
+    { 0, 0, 22, 0, 0, 0, 18466 }, //  
+    { 0, 0, 11, 0, 0, 0, 18466 }, //  
+    { 0, 0, 10, 0, 0, 0, 18466 }, //  
+    { 0, 0, 8, 0, 0, 0, 18466 }, //  
+    { 0, 0, 11, 0, 0, 0, 18466 }, //  
+    { 0, 0, 4, 0, 0, 0, 18466 }, //  
+    { 0, 0, 9, 0, 0, 0, 18466 }, //  
+    { 0, 0, 8, 0, 0, 0, 18466 }, //  
+    { 0, 0, 5, 0, 0, 0, 18466 }, // ​
+    { 0, 0, 1, 0, 0, 0, 18466 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 18466 }, // ‍
+    { 0, 0, 1, 0, 0, 0, 18466 }, // ‎
+    { 0, 0, 1, 0, 0, 0, 18466 }, // ‏
+    { 9, 2, 12, 2, 6, 7, 18466 }, // ‐
+    { 9, 2, 12, 2, 6, 7, 18473 }, // ‑
+    { 13, 2, 16, 2, 6, 9, 18480 }, // ‒
+    { 12, 3, 15, 2, 6, 9, 18489 }, // –
+    { 17, 3, 20, 2, 6, 13, 18498 }, // —
+    { 17, 3, 20, 2, 6, 13, 18511 }, // ―
+    { 11, 15, 12, 0, 12, 38, 18524 }, // ‖
+    { 14, 6, 15, 0, -1, 21, 18562 }, // ‗
+    { 6, 6, 10, 3, 15, 10, 18583 }, // ‘
+    { 6, 5, 10, 3, 14, 9, 18593 }, // ’
+    { 6, 6, 7, 0, 3, 10, 18602 }, // ‚
+    { 6, 6, 10, 3, 15, 10, 18612 }, // ‛
+    { 10, 6, 14, 3, 15, 18, 18622 }, // “
+    { 10, 6, 14, 3, 15, 19, 18640 }, // ”
+    { 6, 6, 7, 0, 3, 10, 18659 }, // „
+    { 10, 5, 14, 3, 15, 16, 18669 }, // ‟
+    { 9, 22, 13, 3, 17, 34, 18685 }, // †
+    { 11, 22, 13, 1, 17, 44, 18719 }, // ‡
+    { 11, 10, 12, 0, 12, 23, 18763 }, // •
+    { 5, 6, 8, 2, 8, 8, 18786 }, // ‣
+    { 4, 3, 5, 0, 3, 5, 18794 }, // ․
+    { 4, 3, 5, 0, 3, 5, 18799 }, // ‥
+    { 16, 3, 17, 0, 3, 15, 18804 }, // …
+    { 3, 2, 5, 1, 6, 3, 18819 }, // ‧
+    { 0, 0, 21, 0, 0, 0, 18822 }, //  
+    { 14, 15, 19, 4, 13, 45, 18822 }, // ‰
+    { 6, 5, 10, 3, 14, 9, 18867 }, // ′
+    { 10, 6, 14, 3, 15, 19, 18876 }, // ″
+    { 12, 6, 14, -2, 14, 19, 18895 }, // ‴
+    { 4, 6, 9, 4, 14, 6, 18914 }, // ‵
+    { 8, 6, 12, 3, 14, 14, 18920 }, // ‶
+    { 12, 6, 17, 4, 14, 18, 18934 }, // ‷
+    { 7, 3, 12, 4, 13, 8, 18952 }, // ‸
+    { 6, 8, 9, 2, 8, 12, 18960 }, // ‹
+    { 6, 8, 7, -1, 8, 11, 18972 }, // ›
+    { 22, 17, 23, 0, 15, 60, 18983 }, // ※
+    { 9, 17, 10, 0, 17, 26, 19043 }, // ‼
+    { 12, 21, 16, 3, 20, 46, 19069 }, // ‽
+    { 9, 2, 14, 4, 14, 7, 19115 }, // ‾
+    { 8, 4, 12, 3, 12, 8, 19122 }, // ‿
+    { 12, 12, 16, 3, 16, 34, 19130 }, // ⁂
+    { 14, 14, 19, 4, 13, 29, 19164 }, // ⁄
+    { 20, 19, 25, 4, 19, 62, 19193 }, // ⁇
+    { 14, 19, 19, 4, 19, 57, 19255 }, // ⁈
+    { 17, 20, 18, 0, 19, 61, 19312 }, // ⁉
+    { 17, 26, 17, -1, 18, 60, 19373 }, // ⁒
+    { 0, 0, 80, 0, 0, 0, 19433 }, //  
+    { 6, 7, 9, 2, 14, 14, 19433 }, // ⁰
+    { 5, 6, 8, 2, 14, 10, 19447 }, // ⁴
+    { 6, 7, 9, 2, 14, 11, 19457 }, // ⁵
+    { 6, 7, 9, 2, 14, 12, 19468 }, // ⁶
+    { 5, 7, 9, 3, 14, 11, 19480 }, // ⁷
+    { 6, 7, 9, 2, 14, 15, 19491 }, // ⁸
+    { 6, 7, 9, 2, 14, 14, 19506 }, // ⁹
+    { 11, 10, 12, 0, 10, 30, 19520 }, // ⁿ
+    { 9, 9, 10, 0, 9, 24, 19550 }, // ₀
+    { 5, 7, 5, -1, 4, 8, 19574 }, // ₁
+    { 6, 7, 6, -1, 4, 13, 19582 }, // ₂
+    { 6, 7, 6, -1, 4, 13, 19595 }, // ₃
+    { 6, 7, 6, -1, 4, 11, 19608 }, // ₄
+    { 6, 7, 6, -1, 4, 11, 19619 }, // ₅
+    { 6, 7, 6, -1, 4, 16, 19630 }, // ₆
+    { 6, 7, 7, 0, 4, 12, 19646 }, // ₇
+    { 6, 7, 6, -1, 4, 14, 19658 }, // ₈
+    { 6, 7, 6, -1, 4, 15, 19672 }, // ₉
+    { 9, 23, 12, 2, 17, 36, 19687 }, // ₍
+    { 10, 23, 7, -4, 17, 39, 19723 }, // ₎
+    { 16, 23, 17, 0, 19, 70, 19762 }, // ₡
+    { 14, 17, 16, 1, 16, 41, 19832 }, // ₢
+    { 14, 16, 15, 0, 16, 41, 19873 }, // ₤
+    { 17, 15, 18, 0, 15, 53, 19914 }, // ₦
+    { 15, 15, 16, 0, 15, 36, 19967 }, // ₧
+    { 19, 15, 20, 0, 15, 62, 20003 }, // ₨
+    { 14, 15, 14, -1, 15, 53, 20065 }, // ₩
+    { 17, 13, 20, 2, 13, 59, 20118 }, // ₪
+    { 13, 14, 15, 1, 14, 38, 20177 }, // ₫
+    { 13, 16, 15, 1, 14, 34, 20215 }, // €
+    { 14, 14, 18, 3, 14, 33, 20249 }, // ₮
+    { 17, 15, 18, 0, 15, 44, 20282 }, // ₱
+    { 14, 21, 17, 1, 18, 57, 20326 }, // ₲
+    { 19, 16, 21, 1, 15, 54, 20383 }, // ₴
+    { 9, 14, 11, 1, 13, 27, 20437 }, // ₵
+    { 16, 15, 20, 3, 15, 34, 20464 }, // ₸
+    { 10, 13, 13, 2, 13, 22, 20498 }, // ₹
+    { 10, 13, 13, 2, 12, 29, 20520 }, // ₺
+    { 12, 13, 14, 1, 13, 43, 20549 }, // ₼
+    { 16, 15, 15, -2, 15, 42, 20592 }, // ₽
+    { 11, 11, 13, -2, 8, 22, 20634 }, // ←
+    { 11, 10, 14, 2, 10, 25, 20656 }, // ↑
+    { 11, 11, 16, 4, 8, 23, 20681 }, // →
+    { 11, 10, 17, 5, 10, 23, 20704 }, // ↓
+    { 18, 9, 18, -1, 8, 35, 20727 }, // ↔
+    { 9, 17, 12, 2, 16, 33, 20762 }, // ↕
+    { 10, 7, 11, -2, 7, 20, 20795 }, // ↖
+    { 11, 7, 14, 2, 7, 21, 20815 }, // ↗
+    { 8, 10, 13, 4, 9, 21, 20836 }, // ↘
+    { 8, 10, 11, -1, 9, 23, 20857 }, // ↙
+    { 13, 11, 14, 0, 10, 20, 20880 }, // ⇐
+    { 13, 12, 17, 3, 12, 42, 20900 }, // ⇑
+    { 13, 11, 16, 2, 10, 22, 20942 }, // ⇒
+    { 13, 13, 20, 6, 12, 43, 20964 }, // ⇓
+    { 17, 11, 18, 0, 10, 30, 21007 }, // ⇔
+    { 11, 16, 16, 4, 10, 45, 21037 }, // ⇕
+    { 13, 14, 15, 1, 14, 37, 21082 }, // ∂
+    { 17, 17, 18, 0, 16, 63, 21119 }, // ∅
+    { 13, 13, 15, 1, 13, 37, 21182 }, // ∆
+    { 13, 12, 16, 2, 12, 37, 21219 }, // ∏
+    { 13, 12, 19, 5, 12, 37, 21256 }, // ∐
+    { 11, 13, 13, 1, 12, 24, 21293 }, // ∑
+    { 8, 3, 11, 2, 6, 5, 21317 }, // −
+    { 16, 14, 19, 2, 13, 33, 21322 }, // √
+    { 15, 8, 18, 2, 10, 34, 21355 }, // ∞
+    { 18, 19, 19, 0, 15, 44, 21389 }, // ∫
+    { 7, 10, 8, 0, 10, 9, 21433 }, // ∶
+    { 12, 9, 16, 3, 9, 22, 21442 }, // ≈
+    { 14, 15, 19, 4, 13, 34, 21464 }, // ≠
+    { 15, 13, 15, -1, 12, 33, 21498 }, // ≤
+    { 14, 13, 16, 1, 12, 33, 21531 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_8_italicIntervals[] = {
@@ -2569,4 +2092,5 @@ static const EpdFontData opendyslexic_8_italic = {
     22,
     -9,
     true,
+    true,
 };
@@ -2,2177 +2,1960 @@
  * generated by fontconvert.py
  * name: opendyslexic_8_regular
  * size: 8
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_8_regular 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py opendyslexic_8_regular 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_regularBitmaps[24000] = {
-    0x01, 0x01, 0xC0, 0xB0, 0x2C, 0x0B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x05,
-    0x01, 0x43, 0xF0, 0xFC, 0x3F, 0x00, 0x14, 0x05, 0x0F, 0x8B, 0xC3, 0xD2, 0xF0, 0xF0, 0xF8, 0x3D,
-    0x3E, 0x0A, 0x0A, 0x40, 0x00, 0x1C, 0x07, 0x00, 0x00, 0x0B, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0xF0,
-    0x00, 0x00, 0xE0, 0x38, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x45, 0x6E, 0x5B, 0x95, 0x40, 0x07, 0x41,
-    0xD0, 0x00, 0x02, 0xD0, 0x74, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x05, 0x7E, 0x5F, 0x95, 0x47, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x03, 0xC0, 0xF0, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0x7C, 0x0F, 0x00, 0x00,
-    0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x3F,
-    0xFF, 0xC0, 0x0F, 0xF8, 0xD0, 0x00, 0xF2, 0x8C, 0x00, 0x0F, 0x28, 0xC0, 0x00, 0xFF, 0x8C, 0x00,
-    0x03, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x28, 0xFF, 0xC0, 0x02, 0x8E, 0xFE, 0x05, 0x28,
-    0xFF, 0xE1, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0x80, 0x00, 0x28, 0xC0, 0x00,
-    0x01, 0x48, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x30, 0x0F, 0x80, 0xA0, 0x30, 0x60, 0xC0, 0x30,
-    0x32, 0x40, 0x30, 0x77, 0x00, 0x2F, 0xDD, 0x00, 0x05, 0x2E, 0xE0, 0x00, 0x3D, 0x1C, 0x00, 0xEC,
-    0x0C, 0x01, 0xCC, 0x0C, 0x03, 0x4A, 0x6C, 0x0B, 0x02, 0xF0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x0F, 0x57, 0x80, 0x01, 0xC0, 0x2C, 0x00, 0x1E, 0x03, 0xC0, 0x00, 0xF5,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xAE, 0x00, 0x02, 0xF0, 0x78, 0x3C,
-    0x3E, 0x01, 0xEB, 0x83, 0xF0, 0x07, 0xF0, 0x2F, 0xD5, 0xFF, 0x00, 0xFF, 0xFF, 0x78, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3E, 0x3D, 0x3C, 0x3C, 0x00, 0xC0, 0x28, 0x03, 0x00, 0xB0,
-    0x0D, 0x01, 0xC0, 0x2C, 0x03, 0x80, 0x34, 0x03, 0x40, 0x74, 0x07, 0x40, 0x34, 0x03, 0x40, 0x38,
-    0x03, 0xC0, 0x2C, 0x01, 0xD0, 0x0F, 0x00, 0xB0, 0x07, 0x80, 0x3C, 0x00, 0x40, 0x34, 0x01, 0xC0,
-    0x0D, 0x00, 0xB0, 0x03, 0x40, 0x38, 0x02, 0xC0, 0x1C, 0x00, 0xD0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
-    0xD0, 0x0D, 0x01, 0xC0, 0x2C, 0x03, 0xC0, 0x38, 0x0B, 0x40, 0xF0, 0x1E, 0x03, 0xC0, 0x14, 0x00,
-    0x00, 0x40, 0x00, 0x60, 0x07, 0x58, 0xB0, 0x7F, 0xD0, 0x07, 0xE0, 0x0B, 0x77, 0xC2, 0x0C, 0x10,
-    0x03, 0x00, 0x00, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xD0, 0xBF, 0xFF, 0x01, 0xC0, 0x01, 0xC0,
-    0x01, 0xC0, 0x00, 0x00, 0x05, 0x07, 0xD1, 0xF0, 0xBC, 0x3E, 0x0A, 0x40, 0x6A, 0xA9, 0xBF, 0xFE,
-    0x18, 0x3D, 0x3E, 0x00, 0x00, 0x80, 0x00, 0x1C, 0x00, 0x02, 0x80, 0x00, 0x34, 0x00, 0x07, 0x00,
-    0x00, 0xB0, 0x00, 0x0E, 0x00, 0x00, 0xD0, 0x00, 0x2C, 0x00, 0x03, 0x80, 0x00, 0x34, 0x00, 0x07,
-    0x00, 0x00, 0xB0, 0x00, 0x0E, 0x00, 0x01, 0xD0, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x34, 0x00,
-    0x0B, 0x00, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0x01, 0xD0, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x03, 0x47, 0x03, 0x80, 0x70, 0xD0, 0x0D, 0x70, 0xC3, 0xAC,
-    0x34, 0xEB, 0x0D, 0x3A, 0xC1, 0x0E, 0x78, 0x07, 0x9F, 0x47, 0xD3, 0xFF, 0xF0, 0x7F, 0xF8, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3B, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-    0x03, 0x80, 0x07, 0x80, 0x07, 0x80, 0x1B, 0x94, 0xBF, 0xFD, 0xBF, 0xFD, 0x01, 0x40, 0x1F, 0xFE,
-    0x06, 0x41, 0xE0, 0x00, 0x2C, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0x02, 0xE0, 0x02, 0xF0, 0x03, 0xF4,
-    0x07, 0xF4, 0x03, 0xF9, 0x51, 0xFF, 0xFC, 0xBF, 0xFF, 0x40, 0x2F, 0xF4, 0x08, 0x07, 0x40, 0x00,
-    0x70, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x5B, 0x40, 0xBF, 0x40, 0x00, 0x7C, 0x00, 0x0B, 0x00, 0x02,
-    0xD2, 0x9A, 0xF1, 0xFF, 0xF4, 0x6F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0B, 0x80, 0x07,
-    0xE0, 0x03, 0xAC, 0x03, 0xCB, 0x02, 0xD2, 0xC1, 0xE0, 0xF4, 0xBF, 0xFF, 0x85, 0x5F, 0x90, 0x03,
-    0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x47, 0x00, 0x01, 0xC0, 0x00, 0x70,
-    0x00, 0x1F, 0xF9, 0x05, 0x56, 0xD0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC7, 0xAB, 0xF1, 0xFF,
-    0xF4, 0x7F, 0xE0, 0x00, 0x00, 0x15, 0x01, 0xFF, 0xC1, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x2E,
-    0xFF, 0x4B, 0xD0, 0xF2, 0xE0, 0x0E, 0x74, 0x03, 0x9D, 0x00, 0xE3, 0xD1, 0xF4, 0x7F, 0xFC, 0x06,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x07, 0x40,
-    0x02, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x01, 0xF4, 0x00,
-    0x02, 0xE4, 0x01, 0xD0, 0xA0, 0x38, 0x03, 0x03, 0x40, 0x34, 0x3C, 0x0B, 0x01, 0xFA, 0xE0, 0x0B,
-    0xFC, 0x03, 0xD0, 0xF4, 0x74, 0x03, 0xCB, 0x40, 0x3C, 0xB8, 0x07, 0xC3, 0xFB, 0xF4, 0x0B, 0xF9,
-    0x00, 0x0B, 0xF4, 0x0B, 0x4B, 0x87, 0x00, 0xF2, 0xC0, 0x1D, 0xB0, 0x07, 0x9C, 0x01, 0xE3, 0x80,
-    0xF8, 0xBF, 0xFE, 0x01, 0xA7, 0x80, 0x00, 0xD1, 0x41, 0xF4, 0xFF, 0xFC, 0x3F, 0xF8, 0x00, 0x2D,
-    0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x3E, 0x3E, 0x0F, 0x07, 0xC2, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x7D, 0x1F, 0x0B, 0xC3, 0xE0, 0xA4, 0x00, 0x00, 0x24, 0x00, 0x02, 0xF4, 0x00, 0x7F,
-    0x40, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBE, 0x40, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x01, 0xBC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x7F, 0xFE, 0x15, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x7F, 0xFE, 0x00, 0x00, 0x24, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0x01, 0xBF, 0xE4, 0x7F, 0xF9, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x3E, 0xBF, 0x02, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00,
-    0x3C, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0x3E, 0x00,
-    0x03, 0xD0, 0x00, 0x3D, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x2D, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x07, 0xD5, 0xB4, 0x00, 0x74, 0x00,
-    0x30, 0x03, 0x40, 0x00, 0x60, 0x2C, 0x2F, 0xC0, 0xC0, 0xE0, 0x83, 0x03, 0x07, 0x45, 0x0C, 0x0C,
-    0x1E, 0x24, 0x70, 0x70, 0x7C, 0x3F, 0xC7, 0x40, 0xF4, 0x11, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x07,
-    0xF4, 0x06, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xCE, 0x00, 0x00, 0xE3, 0xC0, 0x00, 0xB4,
-    0x74, 0x00, 0x3C, 0x0F, 0x00, 0x1E, 0x03, 0xD0, 0x0B, 0x40, 0x78, 0x03, 0xD0, 0x1F, 0x01, 0xFF,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x1F, 0x2F, 0x00, 0x03, 0xE0, 0xFF, 0xF8, 0x03, 0xD5,
-    0xBD, 0x0F, 0x00, 0x38, 0x3C, 0x00, 0xF0, 0xF0, 0x07, 0x83, 0xFF, 0xF8, 0x0F, 0xAB, 0xF8, 0x3C,
-    0x00, 0xB8, 0xF0, 0x00, 0xF3, 0xC0, 0x03, 0xCF, 0x00, 0x2F, 0x3E, 0xAF, 0xFC, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x02, 0xF4, 0x00, 0x07,
-    0xC0, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xFE, 0xBD, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD,
-    0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x03,
-    0xC0, 0x1F, 0xC0, 0xF0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x03, 0xE3, 0xC0, 0x00, 0xBC,
-    0xF0, 0x00, 0x2F, 0x3C, 0x00, 0x0B, 0xCF, 0x00, 0x07, 0xF3, 0xEA, 0xAF, 0xF8, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x47, 0x40,
-    0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0, 0xBF, 0xFC, 0x0B, 0x40, 0x00,
-    0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFF, 0xC3, 0xE9, 0x50, 0xF0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0xFF, 0xD1, 0xFF, 0xF0, 0xB8,
-    0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x05, 0x94, 0x00, 0x2F, 0xFF, 0xF0, 0x0B, 0xE4, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0xE2, 0xE0,
-    0x01, 0x7F, 0x2F, 0x00, 0x03, 0x81, 0xFD, 0x00, 0x7C, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC,
-    0x00, 0xBF, 0xF9, 0x00, 0x10, 0x00, 0x14, 0x78, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C,
-    0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xBC, 0x00, 0x3D, 0xBF, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFC, 0x00, 0x7E, 0xFC, 0x00, 0x3E, 0xFC, 0x00, 0x7E, 0xFC, 0x00,
-    0x7E, 0x00, 0xBC, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0xBC, 0xBC, 0xBD,
-    0x00, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
-    0x03, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x2E, 0x01, 0xF8, 0xBF, 0xC3, 0xFE, 0x0B,
-    0x90, 0x00, 0x2D, 0x0B, 0xC0, 0xB4, 0x3D, 0x03, 0xC2, 0xE0, 0x0F, 0x1F, 0x00, 0x3C, 0xF8, 0x00,
-    0xF7, 0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0xC0, 0x07, 0xEF, 0x80,
-    0x2F, 0x3F, 0x80, 0xB8, 0x3F, 0x82, 0xE0, 0xBF, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0x00,
-    0x03, 0xC0, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0xB8, 0x00,
-    0x2E, 0x00, 0x0B, 0x80, 0x02, 0xD0, 0x00, 0xBE, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x1F, 0x43, 0xF4, 0x00, 0xFD, 0x0F, 0xF0, 0x07, 0xF8, 0x7F, 0xC0, 0x2F,
-    0xE1, 0xEF, 0x80, 0xFB, 0x87, 0xAF, 0x07, 0xEF, 0x1E, 0x7D, 0x3E, 0xBC, 0x7C, 0xFD, 0xF2, 0xF2,
-    0xF2, 0xFF, 0xCB, 0xCB, 0xC3, 0xFE, 0x3F, 0x2F, 0x0B, 0xF0, 0xFC, 0xBC, 0x1F, 0xC3, 0xF7, 0xF0,
-    0x3D, 0x0F, 0xDF, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x19, 0x00, 0x1E, 0x3F, 0x00, 0x1E,
-    0x3F, 0x80, 0x2E, 0x3F, 0xC0, 0x2E, 0x3F, 0xD0, 0x2E, 0x3D, 0xF0, 0x3D, 0x3C, 0xF4, 0x3D, 0x7C,
-    0x7C, 0x3D, 0x7C, 0x3D, 0x3D, 0x7C, 0x1F, 0x3D, 0xBC, 0x0F, 0xBC, 0xBC, 0x07, 0xFC, 0xBC, 0x03,
-    0xFC, 0xFC, 0x01, 0xFC, 0x01, 0xBF, 0x90, 0x02, 0xFA, 0xBE, 0x02, 0xF4, 0x07, 0xF0, 0xF4, 0x00,
-    0x7D, 0x7C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00,
-    0x03, 0xED, 0x00, 0x01, 0xEB, 0xD0, 0x00, 0xF8, 0xFF, 0xAB, 0xFC, 0x2F, 0xFF, 0xFF, 0x02, 0xFF,
-    0xFF, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x07, 0xEA, 0xF4, 0x74, 0x03, 0xC7,
-    0x40, 0x2D, 0x74, 0x02, 0xCB, 0x40, 0x7C, 0xBF, 0xFF, 0x8B, 0xFF, 0xD0, 0xB8, 0x00, 0x0B, 0x80,
-    0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x7D, 0x07, 0xE0, 0x03, 0xC0, 0x03, 0xD0, 0x2E, 0x00, 0x03,
-    0xC0, 0xF0, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x2D, 0x1F, 0x00, 0x00, 0xB4, 0x7C, 0x00, 0x02, 0xD0,
-    0xF0, 0x00, 0x0F, 0x43, 0xD0, 0x14, 0x3C, 0x0F, 0xD1, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0xEA, 0xBC, 0x03, 0x00, 0x74, 0x0C, 0x00, 0xE0, 0x70, 0x07, 0x81,
-    0xE5, 0xBD, 0x07, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0xBC, 0x0F, 0x42, 0xF0, 0x1F, 0x0B, 0xC0, 0x3C,
-    0x2F, 0x00, 0xF4, 0xFC, 0x07, 0xE3, 0xF0, 0x1F, 0xC0, 0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xFC, 0x00,
-    0xF9, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFF, 0xE4, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF4, 0x25, 0x07, 0xFD,
-    0x2F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D,
-    0xFC, 0x00, 0x7D, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8,
-    0x00, 0x3C, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x7C, 0x00,
-    0x0B, 0x83, 0xD0, 0x00, 0xF4, 0x2E, 0x00, 0x1F, 0x01, 0xF0, 0x03, 0xE0, 0x0F, 0x40, 0x7D, 0x00,
-    0xB8, 0x0B, 0xC0, 0x07, 0xC0, 0xF8, 0x00, 0x3D, 0x1F, 0x40, 0x03, 0xF3, 0xF0, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xB4, 0x00, 0x00, 0x02,
-    0xDB, 0x80, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x07, 0xC3, 0xC0, 0x00, 0x00, 0xB8, 0x3D, 0x01,
-    0xF0, 0x0F, 0x42, 0xE0, 0x3F, 0x40, 0xF0, 0x1F, 0x07, 0xFC, 0x1F, 0x00, 0xF0, 0xFF, 0xD2, 0xE0,
-    0x0F, 0x5F, 0x6F, 0x3D, 0x00, 0xFB, 0xF1, 0xF7, 0xC0, 0x0B, 0xFE, 0x0F, 0xFC, 0x00, 0x7F, 0xC0,
-    0xBF, 0x80, 0x03, 0xF8, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00,
-    0x03, 0xC0, 0xF0, 0x02, 0xD0, 0x2E, 0x01, 0xE0, 0x03, 0xD0, 0xF0, 0x00, 0x7C, 0xF4, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0x7E, 0x00, 0x1F,
-    0x8B, 0xD0, 0x0F, 0xC0, 0xFC, 0x0B, 0xD0, 0x1F, 0x87, 0xE0, 0x02, 0xF4, 0xB4, 0x00, 0x3D, 0x3C,
-    0x00, 0x7C, 0x2E, 0x00, 0xF4, 0x0F, 0x01, 0xF0, 0x0B, 0xC3, 0xD0, 0x03, 0xDB, 0xC0, 0x02, 0xFF,
-    0x40, 0x00, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xC0, 0x15, 0x57, 0xF0,
-    0x00, 0x03, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x1A, 0x92, 0xFE, 0x2C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
-    0x3C, 0x03, 0xC0, 0x38, 0x03, 0x80, 0x38, 0x07, 0x80, 0x78, 0x07, 0x40, 0x74, 0x07, 0x40, 0xB4,
-    0x0B, 0x40, 0xB0, 0x0B, 0xFC, 0xBF, 0xC0, 0x00, 0x08, 0x00, 0xA0, 0x07, 0x00, 0x30, 0x03, 0x80,
-    0x1C, 0x00, 0xD0, 0x0E, 0x00, 0xB0, 0x07, 0x40, 0x3C, 0x02, 0xC0, 0x1D, 0x00, 0xC0, 0x04, 0x6A,
-    0x4B, 0xF4, 0x07, 0x80, 0x78, 0x03, 0x80, 0x38, 0x03, 0x80, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
-    0x3C, 0x03, 0xC0, 0x3C, 0x02, 0xC0, 0x2C, 0x02, 0xC0, 0x2D, 0x02, 0xD0, 0x1D, 0x01, 0xD3, 0xFD,
-    0x3F, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0xED, 0x08, 0x09, 0x6A, 0xAA, 0xA6, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0xF0, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0,
-    0xB4, 0x34, 0x07, 0x47, 0x00, 0x38, 0x70, 0x03, 0x87, 0x00, 0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC,
-    0x0B, 0xE6, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x03,
-    0xC0, 0x00, 0x3E, 0xFE, 0x03, 0xF9, 0x7C, 0x3E, 0x01, 0xD3, 0xD0, 0x0E, 0x3C, 0x00, 0xE3, 0xD0,
-    0x1E, 0x2F, 0x9B, 0xC1, 0xFF, 0xF8, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x2F,
-    0x54, 0x3C, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x2F, 0xFC, 0x06,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x0D, 0x00, 0x00, 0xD0, 0x00, 0x0D, 0x00, 0x00, 0xD0,
-    0x2F, 0x4D, 0x0F, 0xFE, 0xD2, 0xC0, 0xBC, 0x34, 0x03, 0xC7, 0x00, 0x3C, 0x70, 0x03, 0xC7, 0x80,
-    0x7C, 0x3F, 0xBF, 0xC1, 0xFF, 0xFC, 0x06, 0xF9, 0xD0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xF4, 0x70,
-    0x28, 0x02, 0x83, 0x9A, 0xFC, 0x7F, 0xEA, 0x87, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF4, 0x18, 0x0F,
-    0xFF, 0xC0, 0x2F, 0xE4, 0x00, 0x00, 0x7F, 0x0E, 0x00, 0xD0, 0x0D, 0x07, 0xFF, 0x2F, 0x50, 0xE0,
-    0x0E, 0x00, 0xE0, 0x0E, 0x01, 0xE0, 0x1F, 0x01, 0xF0, 0x07, 0xE3, 0xC7, 0xFF, 0xF3, 0x81, 0xFD,
-    0xC0, 0x3E, 0x70, 0x0B, 0x9C, 0x02, 0xE7, 0x00, 0xF8, 0xFA, 0xFE, 0x1F, 0xFF, 0x81, 0xF9, 0xD0,
-    0x00, 0xF4, 0x50, 0xBC, 0x3F, 0xFE, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x02, 0xC0, 0x00,
-    0x2C, 0x00, 0x02, 0xC0, 0x00, 0x2C, 0x00, 0x03, 0x8A, 0x80, 0x3F, 0xFF, 0x03, 0xE0, 0x78, 0x3C,
-    0x03, 0x83, 0xC0, 0x2C, 0x38, 0x02, 0xC3, 0x80, 0x2C, 0x7C, 0x03, 0xC7, 0xC0, 0x3C, 0x7C, 0x03,
-    0xC0, 0x28, 0x7C, 0x7C, 0x00, 0x00, 0x10, 0x34, 0x34, 0x34, 0x34, 0x34, 0x38, 0x38, 0x38, 0x7C,
-    0x00, 0xB4, 0x03, 0xD0, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70,
-    0x01, 0xC0, 0x0B, 0x00, 0x2C, 0x00, 0xB0, 0x02, 0xC0, 0x0A, 0x00, 0x38, 0x02, 0xE0, 0xFF, 0x02,
-    0x90, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x03, 0x86,
-    0x40, 0x38, 0xF0, 0x03, 0xBC, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x7B, 0xD0, 0x07, 0x9F, 0x40,
-    0x78, 0xBD, 0x07, 0x82, 0xF8, 0x14, 0x0E, 0x03, 0x80, 0xD0, 0x74, 0x1D, 0x07, 0x01, 0xC0, 0xB0,
-    0x2C, 0x0B, 0x02, 0xC0, 0xBF, 0x2F, 0xD0, 0x1C, 0xBE, 0x0B, 0xD0, 0xBF, 0xBE, 0xFB, 0xC2, 0xF0,
-    0x3F, 0x03, 0x4F, 0x40, 0xB8, 0x0A, 0x3C, 0x01, 0xD0, 0x38, 0xF0, 0x0B, 0x00, 0xF3, 0xC0, 0x3C,
-    0x03, 0xCF, 0x00, 0xF0, 0x0F, 0x7C, 0x03, 0xC0, 0x3D, 0xE0, 0x1E, 0x00, 0xF0, 0x00, 0x10, 0x03,
-    0xFF, 0xD0, 0x3E, 0x0B, 0x03, 0xC0, 0x34, 0x3C, 0x03, 0x83, 0xC0, 0x38, 0x3C, 0x03, 0xC7, 0xC0,
-    0x3C, 0x7C, 0x03, 0xC7, 0xC0, 0x7C, 0x06, 0xF8, 0x01, 0xFA, 0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C,
-    0x70, 0x01, 0xC7, 0x40, 0x1C, 0x38, 0x02, 0xC3, 0xEA, 0xF8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x08,
-    0x2E, 0x00, 0x3B, 0xEB, 0x40, 0xFC, 0x0B, 0x03, 0xD0, 0x1C, 0x0F, 0x00, 0x30, 0x3C, 0x00, 0xD0,
-    0xF8, 0x07, 0x03, 0xF9, 0x7C, 0x0F, 0xFF, 0xD0, 0x79, 0xFE, 0x02, 0xD0, 0x00, 0x0F, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0x0F, 0xFD, 0xD0, 0x2C,
-    0x0B, 0xC0, 0x34, 0x07, 0xC0, 0x70, 0x03, 0xC0, 0x70, 0x07, 0xC0, 0x70, 0x0B, 0xC0, 0x3D, 0x6F,
-    0xC0, 0x1F, 0xFF, 0xC0, 0x07, 0xF6, 0x80, 0x00, 0x03, 0x84, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF4,
-    0x00, 0x01, 0x00, 0x2D, 0xF0, 0xBF, 0xD2, 0xE0, 0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
-    0x40, 0x7D, 0x00, 0x07, 0xFD, 0x07, 0x55, 0x02, 0x80, 0x00, 0xB4, 0x00, 0x0F, 0xE0, 0x00, 0xBF,
-    0x80, 0x00, 0xF0, 0x39, 0x7D, 0x3F, 0xFF, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80,
-    0x07, 0x80, 0x3F, 0xFC, 0x07, 0x40, 0x07, 0x40, 0x07, 0x40, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x80,
-    0x0B, 0xFC, 0x0B, 0xFC, 0x70, 0x03, 0x5C, 0x00, 0xD7, 0x40, 0x79, 0xD0, 0x1E, 0x34, 0x07, 0x8E,
-    0x01, 0xE3, 0xC0, 0xB8, 0xFF, 0xFE, 0x2F, 0xFF, 0x82, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0xD0, 0x01,
-    0xC2, 0xC0, 0x0E, 0x07, 0x80, 0x74, 0x0F, 0x03, 0xC0, 0x1E, 0x1D, 0x00, 0x3C, 0xF0, 0x00, 0x7F,
-    0x80, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x01, 0xE3, 0xC0, 0x00,
-    0xB4, 0xF0, 0x20, 0x3C, 0x2D, 0x2F, 0x0F, 0x07, 0x9F, 0xE7, 0x80, 0xFF, 0xFF, 0xD0, 0x2F, 0xEF,
-    0xF0, 0x07, 0xF2, 0xFC, 0x00, 0xF4, 0x3E, 0x00, 0x0F, 0x01, 0xE0, 0x1E, 0x0F, 0x00, 0x2D, 0xF0,
-    0x00, 0x3F, 0x80, 0x00, 0xBC, 0x00, 0x03, 0xF4, 0x00, 0x3E, 0xF0, 0x02, 0xF2, 0xE0, 0x1F, 0x03,
-    0xD0, 0xF4, 0x0B, 0xC0, 0x34, 0x01, 0xD3, 0xC0, 0x2C, 0x1E, 0x03, 0xC0, 0xF0, 0x38, 0x07, 0x8B,
-    0x40, 0x3C, 0xF0, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00,
-    0x1F, 0x80, 0x3F, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xAA, 0xFC, 0x00,
-    0x0F, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x3F, 0xFF,
-    0x07, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x07, 0x80, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x00, 0x0F,
-    0x00, 0xBD, 0x00, 0xBC, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0B,
-    0xF0, 0x01, 0xA0, 0x77, 0x77, 0x77, 0x66, 0x6A, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x07,
-    0x80, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x02, 0xC0, 0x00, 0xFC, 0x00, 0xBC, 0x01, 0xE0, 0x02,
-    0xD0, 0x02, 0xD0, 0x02, 0xD0, 0x03, 0xD0, 0x3F, 0xC0, 0x2A, 0x00, 0x74, 0x2D, 0x92, 0xC2, 0xD0,
-    0x00, 0x15, 0x0F, 0xC3, 0xF0, 0xB8, 0x00, 0x02, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C,
-    0x0B, 0x02, 0xC0, 0xB0, 0x2C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0xC0,
-    0x0B, 0xF8, 0x2F, 0xE4, 0x3C, 0xC0, 0x74, 0xC0, 0x74, 0xC0, 0x74, 0xC0, 0x78, 0xC0, 0x3E, 0xC0,
-    0x2F, 0xFC, 0x07, 0xFD, 0x01, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x3F, 0xF8,
-    0x03, 0xD0, 0x74, 0x0D, 0x00, 0x00, 0x34, 0x00, 0x00, 0xA0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x40,
-    0x00, 0x6F, 0xA9, 0x01, 0xFF, 0xFC, 0x00, 0x74, 0x00, 0x02, 0xD0, 0x00, 0x7E, 0x00, 0x03, 0xFF,
-    0xA5, 0x0F, 0xFF, 0xFD, 0x24, 0x06, 0x0F, 0xFF, 0xC1, 0xD1, 0xE0, 0xB0, 0x3C, 0x2D, 0x1E, 0x0B,
-    0xFF, 0xC7, 0xEE, 0xB8, 0x40, 0x04, 0x00, 0x00, 0x00, 0xE0, 0x03, 0xC1, 0xE0, 0x3C, 0x02, 0xE3,
-    0xD0, 0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0x90, 0x07, 0xFF, 0xE0, 0x00, 0xF4, 0x00, 0x03,
-    0xD0, 0x00, 0x0F, 0x50, 0x07, 0xFF, 0xE0, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x77, 0x77, 0x70, 0x00, 0x6A, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x03, 0x41, 0x80,
-    0x60, 0x00, 0x07, 0x40, 0x00, 0x3F, 0xD0, 0x0F, 0xEB, 0xC1, 0xC0, 0x0D, 0x1C, 0x01, 0xD0, 0xFF,
-    0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFC, 0x00, 0x0B, 0xC2, 0xFF, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x18, 0x0A, 0x0F, 0x47, 0xC3, 0xE2, 0xF0, 0x0A, 0x80, 0x84, 0x84, 0x80, 0x62, 0x02, 0x4B, 0x54,
-    0x91, 0x80, 0x64, 0x00, 0x00, 0x00, 0xFC, 0x20, 0xC2, 0x0C, 0x35, 0xD1, 0xF9, 0x00, 0x41, 0x01,
-    0xD1, 0xC1, 0xD2, 0xD1, 0xD2, 0xC0, 0x7C, 0xB8, 0x07, 0xCB, 0x80, 0x74, 0xB0, 0x04, 0x04, 0xAA,
-    0x54, 0xBF, 0xFE, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x0F, 0x6A, 0xA9, 0xBF, 0xFE, 0x05, 0x40, 0x95,
-    0x84, 0x44, 0x62, 0xD2, 0x48, 0x94, 0xA2, 0x80, 0x64, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x01, 0xE6, 0xD0, 0xE0, 0x2C, 0x38, 0x0B, 0x0F, 0x03, 0xC1, 0xFF, 0xD0,
-    0x1F, 0xD0, 0x00, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0xBF, 0xFF, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x40,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x18, 0x00, 0xC0, 0x30, 0x28, 0x2C, 0x1F, 0xC0, 0x00, 0x14,
-    0x00, 0x90, 0x04, 0x28, 0x02, 0x44, 0xA3, 0xF0, 0x28, 0xCB, 0x10, 0x3C, 0x00, 0xD3, 0xC0, 0x0D,
-    0x3D, 0x01, 0xE3, 0xD0, 0x1E, 0x3D, 0x01, 0xE3, 0xE0, 0x1E, 0x3F, 0x02, 0xE3, 0xFF, 0xFE, 0x3B,
-    0xFF, 0xE3, 0x2F, 0x8F, 0x30, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x2F, 0x4A, 0x7F, 0x0A, 0xBF,
-    0x0A, 0x7F, 0x0A, 0x3F, 0x0B, 0x0F, 0x0B, 0x1F, 0x07, 0x1F, 0x07, 0x2E, 0x07, 0x3E, 0x07, 0x3E,
-    0x07, 0x7E, 0x07, 0x7D, 0x07, 0x2C, 0x3D, 0x29, 0x00, 0x40, 0x58, 0x08, 0xB4, 0x28, 0x02, 0x00,
-    0x80, 0x20, 0x0C, 0x1F, 0xC0, 0x00, 0x0A, 0x42, 0x48, 0x30, 0x53, 0x09, 0x1F, 0xC0, 0x00, 0x40,
-    0x80, 0x2C, 0x3C, 0x02, 0xD2, 0xC0, 0x1D, 0x2C, 0x0F, 0x5F, 0x0F, 0x5F, 0x07, 0x4B, 0x00, 0x41,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x01, 0x80, 0x03, 0x40,
-    0x06, 0x00, 0x18, 0x00, 0x28, 0x00, 0xC0, 0x00, 0xA0, 0x0A, 0x00, 0x0B, 0xE4, 0x70, 0x00, 0x3F,
-    0xE3, 0x40, 0x80, 0x00, 0x2C, 0x0B, 0x00, 0x00, 0xD0, 0x7C, 0x00, 0x0E, 0x03, 0x30, 0x00, 0x70,
-    0x34, 0xD0, 0x03, 0x80, 0xFF, 0xD0, 0x2C, 0x00, 0x0D, 0x00, 0x90, 0x00, 0x34, 0x1E, 0x00, 0x00,
-    0x00, 0x58, 0x00, 0x00, 0x00, 0x60, 0x00, 0xD0, 0x01, 0x80, 0x07, 0x00, 0x0A, 0x00, 0x30, 0x00,
-    0x28, 0x02, 0x80, 0x02, 0xF9, 0x0D, 0xBD, 0x0F, 0xF8, 0xD5, 0x0D, 0x00, 0x07, 0x00, 0x28, 0x00,
-    0x34, 0x00, 0xE0, 0x02, 0xC0, 0x0B, 0x00, 0x1C, 0x00, 0xB4, 0x00, 0xE0, 0x0F, 0x80, 0x0B, 0x00,
-    0x7F, 0xE0, 0x34, 0x01, 0xAA, 0x40, 0x7F, 0x40, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00,
-    0xD0, 0x07, 0xE0, 0x06, 0x00, 0x01, 0xC0, 0x30, 0x00, 0x03, 0x42, 0x80, 0x06, 0xBC, 0x1C, 0x00,
-    0x2F, 0xD0, 0xD0, 0x20, 0x00, 0x0B, 0x02, 0xC0, 0x00, 0x34, 0x1F, 0x00, 0x03, 0x80, 0xCC, 0x00,
-    0x1C, 0x0D, 0x34, 0x00, 0xE0, 0x3F, 0xF4, 0x0B, 0x00, 0x03, 0x40, 0x24, 0x00, 0x0D, 0x00, 0x00,
-    0xA4, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0F, 0x40, 0x00, 0xF4,
-    0x00, 0x0F, 0x40, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x07,
-    0x40, 0x00, 0x78, 0x00, 0x03, 0xD0, 0x14, 0x1F, 0xAB, 0x80, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xF3, 0x80, 0x00, 0x38, 0xF0, 0x00,
-    0x2D, 0x1D, 0x00, 0x0F, 0x03, 0xC0, 0x07, 0x80, 0xF4, 0x02, 0xD0, 0x1E, 0x00, 0xF4, 0x07, 0xC0,
-    0x7F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x1F, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0xF8, 0x00, 0x03, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF4,
-    0x00, 0x03, 0xCE, 0x00, 0x00, 0xE3, 0xC0, 0x00, 0xB4, 0x74, 0x00, 0x3C, 0x0F, 0x00, 0x1E, 0x03,
-    0xD0, 0x0B, 0x40, 0x78, 0x03, 0xD0, 0x1F, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x7C, 0x00,
-    0x1F, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xB0, 0x00, 0x06,
-    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x3C, 0xE0, 0x00, 0x0E, 0x3C, 0x00, 0x0B, 0x47, 0x40, 0x03, 0xC0, 0xF0, 0x01,
-    0xE0, 0x3D, 0x00, 0xB4, 0x07, 0x80, 0x3D, 0x01, 0xF0, 0x1F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xC7,
-    0xC0, 0x01, 0xF2, 0xF0, 0x00, 0x3E, 0x00, 0xA0, 0x50, 0x00, 0x33, 0x20, 0x00, 0x18, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0xF3, 0x80, 0x00, 0x38, 0xF0, 0x00, 0x2D, 0x1D, 0x00, 0x0F, 0x03, 0xC0, 0x07, 0x80, 0xF4,
-    0x02, 0xD0, 0x1E, 0x00, 0xF4, 0x07, 0xC0, 0x7F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x1F, 0x00, 0x07,
-    0xCB, 0xC0, 0x00, 0xF8, 0x02, 0xD0, 0xF0, 0x00, 0xF4, 0x7C, 0x00, 0x29, 0x1A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xF3,
-    0x80, 0x00, 0x38, 0xF0, 0x00, 0x2D, 0x1D, 0x00, 0x0F, 0x03, 0xC0, 0x07, 0x80, 0xF4, 0x02, 0xD0,
-    0x1E, 0x00, 0xF4, 0x07, 0xC0, 0x7F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x1F, 0x00, 0x07, 0xCB, 0xC0,
-    0x00, 0xF8, 0x00, 0x19, 0x00, 0x00, 0x08, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x3C, 0xE0, 0x00, 0x0E, 0x3C, 0x00, 0x0B, 0x47, 0x40, 0x03, 0xC0, 0xF0, 0x01, 0xE0, 0x3D, 0x00,
-    0xB4, 0x07, 0x80, 0x3D, 0x01, 0xF0, 0x1F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xC7, 0xC0, 0x01, 0xF2,
-    0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
-    0xF9, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0E, 0xBC, 0x00, 0x00, 0x00, 0xB1, 0xF0, 0x00, 0x00,
-    0x07, 0x87, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0xFF, 0x80, 0x01, 0xE0, 0x3F, 0xFE, 0x00, 0x0F, 0x00,
-    0xF4, 0x00, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0xF4, 0x00, 0xFF, 0xFF, 0x8B, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x02, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40,
-    0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x1F, 0xFE, 0xBD, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x00, 0xBF, 0xF9, 0x00,
-    0x02, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x74, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4,
-    0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0, 0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00,
-    0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0x40,
-    0x00, 0x70, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xC7, 0xFF, 0xE4, 0x74, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xBF, 0xFC,
-    0x0B, 0xFF, 0xC0, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFC, 0x00, 0xD0, 0x00, 0x2F, 0x40, 0x09, 0x0D, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0xFF,
-    0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0,
-    0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xC0, 0x0A, 0x06, 0x01, 0xF0, 0xF4, 0x2F, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0,
-    0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xC0, 0x20, 0x02, 0xD0, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x07, 0xC0,
-    0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0xBC, 0x0B, 0xC0, 0xBD,
-    0x04, 0x0C, 0x28, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0xBC, 0xBC, 0xBD, 0x00, 0x00, 0x1C, 0x00, 0xFC, 0x1C, 0x1C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00,
-    0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xD0, 0x2D, 0x0F, 0x0F, 0x47,
-    0xC2, 0x91, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xC0, 0x01, 0xF0,
-    0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0,
-    0x01, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x03, 0xC0, 0x1F, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x03, 0xC0, 0x01,
-    0xF0, 0x03, 0xC0, 0x00, 0xF4, 0x2B, 0xEA, 0x00, 0xB8, 0x3F, 0xFF, 0x00, 0xBC, 0x03, 0xC0, 0x00,
-    0xBC, 0x03, 0xC0, 0x01, 0xFC, 0x03, 0xEA, 0xAF, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0xF4, 0x90, 0x01, 0x8C, 0x80, 0x01, 0x87, 0xC0, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x1E, 0x3F, 0x00, 0x1E, 0x3F, 0x80, 0x2E, 0x3F, 0xC0, 0x2E, 0x3F, 0xE0, 0x2E,
-    0x3D, 0xF0, 0x3D, 0x3C, 0xF4, 0x3D, 0x7C, 0x7C, 0x3D, 0x7C, 0x3D, 0x3D, 0x7C, 0x1F, 0x3D, 0xBC,
-    0x0F, 0xBC, 0xBC, 0x07, 0xFC, 0xBC, 0x03, 0xFC, 0xFC, 0x01, 0xFC, 0x00, 0x90, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x02, 0xFA, 0xBE, 0x02, 0xF4,
-    0x07, 0xF0, 0xF4, 0x00, 0x7D, 0x7C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xF4, 0x00, 0x03, 0xED, 0x00, 0x01, 0xEB, 0xD0, 0x00, 0xF8, 0xFF, 0xAB, 0xFC, 0x2F,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x01, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x0B, 0xEA, 0xF8, 0x0B, 0xD0, 0x1F, 0xC3, 0xD0, 0x01, 0xF5,
-    0xF0, 0x00, 0x3E, 0xB4, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0F,
-    0xB4, 0x00, 0x07, 0xAF, 0x40, 0x03, 0xE3, 0xFE, 0xAF, 0xF0, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFC,
-    0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07, 0xB4,
-    0x00, 0x06, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0xBE, 0xAF, 0x80, 0xBD, 0x01,
-    0xFC, 0x3D, 0x00, 0x1F, 0x5F, 0x00, 0x03, 0xEB, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0xFB, 0x40, 0x00, 0x7A, 0xF4, 0x00, 0x3E, 0x3F, 0xEA, 0xFF, 0x0B, 0xFF,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xC0, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x50, 0x00,
-    0x33, 0x54, 0x00, 0x08, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x02, 0xFA, 0xBE, 0x02,
-    0xF4, 0x07, 0xF0, 0xF4, 0x00, 0x7D, 0x7C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F,
-    0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xED, 0x00, 0x01, 0xEB, 0xD0, 0x00, 0xF8, 0xFF, 0xAB, 0xFC,
-    0x2F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0xF0,
-    0x00, 0xB8, 0x3C, 0x00, 0x2A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x02, 0xFA, 0xBE,
-    0x02, 0xF4, 0x07, 0xF0, 0xF4, 0x00, 0x7D, 0x7C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xED, 0x00, 0x01, 0xEB, 0xD0, 0x00, 0xF8, 0xFF, 0xAB,
-    0xFC, 0x2F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x24, 0x14,
-    0x1E, 0xF0, 0x07, 0xC0, 0x0F, 0xE0, 0x3C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x6F, 0xEF, 0x40, 0x00, 0x00, 0xFE, 0xBF, 0xC0, 0x00, 0x00, 0xFC, 0x03,
-    0xF8, 0x00, 0x00, 0x7C, 0x02, 0xFF, 0x00, 0x00, 0x2E, 0x00, 0xF3, 0xD0, 0x00, 0x0F, 0x00, 0xF4,
-    0xB8, 0x00, 0x03, 0xC0, 0x7C, 0x2E, 0x00, 0x00, 0xF0, 0x3D, 0x07, 0x80, 0x00, 0x3C, 0x2F, 0x01,
-    0xE0, 0x00, 0x0F, 0x0F, 0x00, 0xB4, 0x00, 0x03, 0xFF, 0x80, 0x7D, 0x00, 0x00, 0x7F, 0xEA, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFB, 0xFF, 0x40,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D,
-    0xFC, 0x00, 0x7D, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8,
-    0x00, 0x3C, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00,
-    0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC,
-    0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x78, 0x00, 0x01, 0xDE, 0x00, 0x02, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x7D, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C,
-    0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0x83, 0xC0, 0x0B, 0xC3,
-    0xD0, 0x0A, 0x82, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D,
-    0xFC, 0x00, 0x7D, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8,
-    0x00, 0x3C, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x3D, 0x3C, 0x00, 0x7C, 0x2E, 0x00, 0xF4, 0x0F, 0x01, 0xF0, 0x0B, 0xC3,
-    0xD0, 0x03, 0xDB, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x38, 0x00, 0x0E, 0x40,
-    0x03, 0xFE, 0x00, 0xE1, 0xF0, 0x38, 0x0F, 0x0E, 0x00, 0xD3, 0x80, 0x74, 0xE0, 0xBC, 0x3E, 0xF8,
-    0x0F, 0xE0, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x00, 0x07, 0xE4, 0x02, 0xC0, 0xD0, 0x34,
-    0x03, 0x03, 0x01, 0xB0, 0x30, 0x30, 0x07, 0x46, 0x00, 0x74, 0x70, 0x07, 0x43, 0xD0, 0x74, 0x0B,
-    0x47, 0x40, 0x2C, 0xB4, 0x03, 0xCB, 0xAF, 0xF8, 0xB9, 0xFE, 0x00, 0x04, 0x00, 0x00, 0xB4, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0xFA, 0xF4, 0x3C, 0x0B, 0x43, 0x40, 0x74, 0x70,
-    0x03, 0x87, 0x00, 0x38, 0x70, 0x0B, 0xC3, 0xEB, 0xFC, 0x2F, 0xFF, 0xC0, 0xBE, 0x6C, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0xA0, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0, 0xB4, 0x34, 0x07, 0x47, 0x00, 0x38, 0x70, 0x03, 0x87, 0x00,
-    0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC, 0x0B, 0xE6, 0xC0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x03, 0xF0,
-    0x00, 0xD1, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0, 0xB4, 0x34, 0x07, 0x47,
-    0x00, 0x38, 0x70, 0x03, 0x87, 0x00, 0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC, 0x0B, 0xE6, 0xC0, 0x0B,
-    0x45, 0x00, 0xCC, 0x90, 0x1C, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0xFA, 0xF4, 0x3C, 0x0B,
-    0x43, 0x40, 0x74, 0x70, 0x03, 0x87, 0x00, 0x38, 0x70, 0x0B, 0xC3, 0xEB, 0xFC, 0x2F, 0xFF, 0xC0,
-    0xBE, 0x6C, 0x19, 0x0A, 0x02, 0xE0, 0xF0, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0xFA,
-    0xF4, 0x3C, 0x0B, 0x43, 0x40, 0x74, 0x70, 0x03, 0x87, 0x00, 0x38, 0x70, 0x0B, 0xC3, 0xEB, 0xFC,
-    0x2F, 0xFF, 0xC0, 0xBE, 0x6C, 0x01, 0xA0, 0x00, 0x22, 0x00, 0x02, 0x20, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0, 0xB4, 0x34, 0x07, 0x47, 0x00, 0x38, 0x70, 0x03,
-    0x87, 0x00, 0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC, 0x0B, 0xE6, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF7, 0x1F, 0xE0, 0x0F, 0xAF, 0xF4, 0x28, 0x3C, 0x0B, 0xC0, 0x0C, 0x34, 0x07, 0xDA, 0xFE, 0x70,
-    0x03, 0xFE, 0xA9, 0x70, 0x03, 0x80, 0x00, 0x70, 0x0B, 0xC0, 0x00, 0x3E, 0xBF, 0xF9, 0x05, 0x2F,
-    0xFF, 0xFF, 0xFD, 0x0B, 0xE6, 0xDF, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0x54, 0x3C, 0x00, 0x74,
-    0x00, 0x74, 0x00, 0x74, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x2F, 0xFC, 0x07, 0xFD, 0x00, 0x90, 0x00,
-    0x14, 0x00, 0x14, 0x01, 0xE0, 0x04, 0x00, 0x00, 0x74, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xF4, 0x70, 0x28, 0x02, 0x83, 0x9A, 0xFC, 0x7F, 0xEA,
-    0x87, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF4, 0x18, 0x0F, 0xFF, 0xC0, 0x2F, 0xE4, 0x00, 0x00, 0x00,
-    0x03, 0x40, 0x00, 0x70, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0x47, 0x02, 0x80, 0x28, 0x39, 0xAF, 0xC7, 0xFE, 0xA8,
-    0x70, 0x00, 0x03, 0x80, 0x00, 0x3F, 0x41, 0x80, 0xFF, 0xFC, 0x02, 0xFE, 0x40, 0x00, 0x90, 0x00,
-    0x2F, 0x00, 0x06, 0x1C, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xF4,
-    0x70, 0x28, 0x02, 0x83, 0x9A, 0xFC, 0x7F, 0xEA, 0x87, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF4, 0x18,
-    0x0F, 0xFF, 0xC0, 0x2F, 0xE4, 0x0A, 0x06, 0x01, 0xF0, 0xF4, 0x2F, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xF4, 0x70, 0x28, 0x02, 0x83, 0x9A, 0xFC, 0x7F, 0xEA,
-    0x87, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF4, 0x18, 0x0F, 0xFF, 0xC0, 0x2F, 0xE4, 0x24, 0x01, 0xE0,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x34, 0x03, 0x40, 0x34, 0x03, 0x40, 0x34, 0x03, 0x80, 0x38, 0x03,
-    0x80, 0x7C, 0x00, 0x0D, 0x1C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x34, 0x34, 0x34, 0x38,
-    0x38, 0x38, 0x7C, 0x00, 0x00, 0x0D, 0x00, 0xED, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0xD0, 0x03, 0x40, 0x0D, 0x00, 0x34, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x7C, 0x00, 0x2D, 0x0F,
-    0x0F, 0x87, 0xC2, 0x91, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x0D, 0x00, 0x03, 0x40,
-    0x00, 0xD0, 0x00, 0x34, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xAF, 0xA8, 0x00, 0x3F, 0xFF, 0x00, 0x10,
-    0x30, 0x00, 0xFF, 0x5C, 0x00, 0xF0, 0x7B, 0x00, 0x74, 0x0B, 0x80, 0x2C, 0x01, 0xD0, 0x0B, 0x00,
-    0x70, 0x01, 0xF4, 0x78, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x03, 0xC2, 0x00, 0x63,
-    0x30, 0x05, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0xFF, 0xD0, 0x3E, 0x0B, 0x03, 0xC0, 0x34,
-    0x3C, 0x03, 0x83, 0xC0, 0x38, 0x3C, 0x03, 0xC7, 0xC0, 0x3C, 0x7C, 0x03, 0xC7, 0xC0, 0x7C, 0x04,
-    0x00, 0x00, 0x74, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8,
-    0x01, 0xFA, 0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C, 0x70, 0x01, 0xC7, 0x40, 0x1C, 0x38, 0x02, 0xC3,
-    0xEA, 0xF8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x70, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80,
-    0x1F, 0xAF, 0x03, 0x80, 0x38, 0x34, 0x02, 0xC7, 0x00, 0x1C, 0x74, 0x01, 0xC3, 0x80, 0x2C, 0x3E,
-    0xAF, 0x81, 0xFF, 0xF0, 0x06, 0xF8, 0x00, 0x00, 0xD0, 0x00, 0x2F, 0x00, 0x0A, 0x0C, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x01, 0xFA, 0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C,
-    0x70, 0x01, 0xC7, 0x40, 0x1C, 0x38, 0x02, 0xC3, 0xEA, 0xF8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x07,
-    0x42, 0x00, 0xC9, 0x20, 0x0C, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8,
-    0x01, 0xFA, 0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C, 0x70, 0x01, 0xC7, 0x40, 0x1C, 0x38, 0x02, 0xC3,
-    0xEA, 0xF8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x0A, 0x06, 0x01, 0xF0, 0xF4, 0x2F, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x01, 0xFA, 0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C,
-    0x70, 0x01, 0xC7, 0x40, 0x1C, 0x38, 0x02, 0xC3, 0xEA, 0xF8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x00,
-    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x51, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x2C,
-    0x00, 0x03, 0x80, 0x00, 0x30, 0x00, 0x07, 0x00, 0x00, 0xA0, 0x00, 0x0D, 0x00, 0x01, 0xC0, 0x06,
-    0xFC, 0x01, 0xFB, 0xF0, 0x38, 0x37, 0xC3, 0x4B, 0x2C, 0x70, 0xF1, 0xC7, 0x0E, 0x1C, 0x79, 0xD2,
-    0xC3, 0xFE, 0xB8, 0x1F, 0xFF, 0x00, 0x7F, 0x80, 0x0B, 0x00, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0x01,
-    0xD0, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x74, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x3C, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1C, 0x00, 0xD7, 0x00, 0x35, 0xD0,
-    0x1E, 0x74, 0x07, 0x8D, 0x01, 0xE3, 0x80, 0x78, 0xF0, 0x2E, 0x3F, 0xFF, 0x8B, 0xFF, 0xE0, 0xBE,
-    0x3C, 0x00, 0x10, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x03, 0x5C, 0x00, 0xD7, 0x40, 0x79, 0xD0, 0x1E, 0x34, 0x07, 0x8E, 0x01,
-    0xE3, 0xC0, 0xB8, 0xFF, 0xFE, 0x2F, 0xFF, 0x82, 0xF8, 0xF0, 0x00, 0x80, 0x00, 0xF8, 0x00, 0xD2,
-    0x80, 0x40, 0x10, 0x00, 0x00, 0x1C, 0x00, 0xD7, 0x00, 0x35, 0xD0, 0x1E, 0x74, 0x07, 0x8D, 0x01,
-    0xE3, 0x80, 0x78, 0xF0, 0x2E, 0x3F, 0xFF, 0x8B, 0xFF, 0xE0, 0xBE, 0x3C, 0x18, 0x0A, 0x0F, 0x47,
-    0xC3, 0xE2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xD7, 0x00, 0x35, 0xD0, 0x1E, 0x74, 0x07,
-    0x8D, 0x01, 0xE3, 0x80, 0x78, 0xF0, 0x2E, 0x3F, 0xFF, 0x8B, 0xFF, 0xE0, 0xBE, 0x3C, 0x00, 0x18,
-    0x00, 0x03, 0x40, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x1D, 0x3C, 0x02, 0xC1, 0xE0, 0x3C, 0x0F, 0x03, 0x80, 0x78,
-    0xB4, 0x03, 0xCF, 0x00, 0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x07, 0xE0, 0x00, 0x7D, 0x00, 0x07, 0xC0,
-    0x01, 0xF8, 0x03, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0xB0, 0x00,
-    0xB0, 0x00, 0xBF, 0x40, 0xB1, 0xF0, 0xB0, 0x38, 0xB0, 0x1C, 0xB0, 0x1C, 0xB0, 0x38, 0xB0, 0xB0,
-    0x77, 0xD0, 0x7E, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x0F, 0x07, 0x80, 0xF0,
-    0xB8, 0x1A, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0xD3, 0xC0, 0x2C,
-    0x1E, 0x03, 0xC0, 0xF0, 0x38, 0x07, 0x8B, 0x40, 0x3C, 0xF0, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x00,
-    0x7E, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x3F, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xF3, 0x80, 0x00, 0x38,
-    0xF0, 0x00, 0x2D, 0x1D, 0x00, 0x0F, 0x03, 0xC0, 0x07, 0x80, 0xF4, 0x02, 0xD0, 0x1E, 0x00, 0xF4,
-    0x07, 0xC0, 0x7F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x1F, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0xF8, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x15, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0xFA, 0xF4, 0x3C, 0x0B,
-    0x43, 0x40, 0x74, 0x70, 0x03, 0x87, 0x00, 0x38, 0x70, 0x0B, 0xC3, 0xEB, 0xFC, 0x2F, 0xFF, 0xC0,
-    0xBE, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x90, 0x28, 0x00, 0x1F, 0xAC, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x0F, 0x38, 0x00, 0x03, 0x8F, 0x00, 0x02, 0xD1, 0xD0, 0x00, 0xF0, 0x3C, 0x00,
-    0x78, 0x0F, 0x40, 0x2D, 0x01, 0xE0, 0x0F, 0x40, 0x7C, 0x07, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF1,
-    0xF0, 0x00, 0x7C, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0x80, 0x60, 0x0F, 0xAD, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0xFA, 0xF4, 0x3C, 0x0B, 0x43, 0x40, 0x74,
-    0x70, 0x03, 0x87, 0x00, 0x38, 0x70, 0x0B, 0xC3, 0xEB, 0xFC, 0x2F, 0xFF, 0xC0, 0xBE, 0x6C, 0x00,
-    0x2E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xCE, 0x00, 0x00, 0xE3, 0xC0, 0x00,
-    0xB4, 0x74, 0x00, 0x3C, 0x0F, 0x00, 0x1E, 0x03, 0xD0, 0x0B, 0x40, 0x78, 0x03, 0xD0, 0x1F, 0x01,
-    0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x1F, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0, 0xB4, 0x34, 0x07, 0x47, 0x00, 0x38, 0x70, 0x03, 0x87, 0x00,
-    0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC, 0x0B, 0xE6, 0xC0, 0x00, 0x60, 0x00, 0x09, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x7F,
-    0xFD, 0x02, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xFE, 0xBD, 0x0F,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xA0, 0x00,
-    0xD0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0x54, 0x3C, 0x00, 0x74, 0x00, 0x74,
-    0x00, 0x74, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x2F, 0xFC, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0xD1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x02, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x1F, 0xFE, 0xBD, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x02, 0xD0, 0x0A, 0x74, 0x14, 0x08, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0x54, 0x3C, 0x00, 0x74,
-    0x00, 0x74, 0x00, 0x74, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x2F, 0xFC, 0x06, 0xFD, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x02, 0xF4, 0x00, 0x07, 0xC0, 0x00,
-    0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xFE, 0xBD, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x00, 0xBF,
-    0xF9, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x02, 0xE0, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x2F, 0x54, 0x3C, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x2F, 0xFC,
-    0x06, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xD0, 0x00, 0x3B, 0x40, 0x00, 0x0D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x7F, 0xFD, 0x02, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xFE, 0xBD,
-    0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x14, 0x04, 0x0A, 0x34,
-    0x02, 0xE0, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0x54, 0x3C, 0x00, 0x74, 0x00,
-    0x74, 0x00, 0x74, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x2F, 0xFC, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x81, 0xC0, 0x00, 0x1E, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x3C, 0x01, 0xFC, 0x0F, 0x00,
-    0x0F, 0x83, 0xC0, 0x00, 0xF0, 0xF0, 0x00, 0x3E, 0x3C, 0x00, 0x0B, 0xCF, 0x00, 0x02, 0xF3, 0xC0,
-    0x00, 0xBC, 0xF0, 0x00, 0x7F, 0x3E, 0xAA, 0xFF, 0x8F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x34, 0x50, 0x00, 0x0D, 0x28, 0x00, 0x03, 0x4E,
-    0x00, 0x00, 0xD3, 0x80, 0xBD, 0x34, 0x00, 0xFF, 0xED, 0x00, 0xB0, 0x2F, 0x00, 0x34, 0x03, 0xC0,
-    0x1C, 0x00, 0xF0, 0x07, 0x00, 0x3C, 0x01, 0xE0, 0x1F, 0x00, 0x3F, 0xBF, 0xC0, 0x07, 0xFF, 0xF0,
-    0x00, 0x6F, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x03, 0xC0, 0x1F, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x03, 0xC0, 0x01, 0xF0, 0x03,
-    0xC0, 0x00, 0xF4, 0x2B, 0xEA, 0x00, 0xB8, 0x3F, 0xFF, 0x00, 0xBC, 0x03, 0xC0, 0x00, 0xBC, 0x03,
-    0xC0, 0x01, 0xFC, 0x03, 0xEA, 0xAF, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x34, 0x00, 0x02, 0xAF, 0xA0, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0xD0, 0x00, 0xBD, 0x34, 0x00, 0xFF, 0xED, 0x00, 0xB0, 0x2F, 0x00, 0x34, 0x03, 0xC0,
-    0x1C, 0x00, 0xF0, 0x07, 0x00, 0x3C, 0x01, 0xE0, 0x1F, 0x00, 0x3F, 0xBF, 0xC0, 0x07, 0xFF, 0xF0,
-    0x00, 0x6F, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00,
-    0xB4, 0x00, 0x0B, 0xFF, 0xC0, 0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF,
-    0xFF, 0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x05, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0x47, 0x02, 0x80, 0x28, 0x39, 0xAF, 0xC7, 0xFE, 0xA8,
-    0x70, 0x00, 0x03, 0x80, 0x00, 0x3F, 0x41, 0x80, 0xFF, 0xFC, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x01,
-    0xC0, 0x30, 0x0F, 0xAF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0,
-    0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xC0, 0x0D, 0x03, 0x00, 0xD0, 0x70, 0x07, 0xFC, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0x47, 0x02, 0x80, 0x28, 0x39, 0xAF, 0xC7, 0xFE, 0xA8,
-    0x70, 0x00, 0x03, 0x80, 0x00, 0x3F, 0x41, 0x80, 0xFF, 0xFC, 0x02, 0xFE, 0x40, 0x00, 0xA0, 0x00,
-    0x0F, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC7, 0xFF,
-    0xE4, 0x74, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xBF, 0xFC, 0x0B, 0xFF, 0xC0,
-    0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0xF4, 0x70, 0x28, 0x02, 0x83, 0x9A, 0xFC, 0x7F, 0xEA, 0x87, 0x00, 0x00, 0x38, 0x00, 0x03,
-    0xF4, 0x18, 0x0F, 0xFF, 0xC0, 0x2F, 0xE4, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x47, 0x40,
-    0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0, 0xBF, 0xFC, 0x0B, 0x40, 0x00,
-    0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x18, 0x00, 0x03,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xF4, 0x70, 0x28, 0x02, 0x83, 0x9A,
-    0xFC, 0x7F, 0xEA, 0x87, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF4, 0x14, 0x1F, 0xFF, 0xC0, 0x2F, 0xE4,
-    0x00, 0x60, 0x00, 0x08, 0x00, 0x02, 0x80, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x90, 0xA0, 0x02, 0xB8, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0,
-    0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xC0, 0x09, 0x06, 0x00, 0x3A, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0x47, 0x02, 0x80, 0x28, 0x39, 0xAF, 0xC7, 0xFE, 0xA8,
-    0x70, 0x00, 0x03, 0x80, 0x00, 0x3F, 0x41, 0x80, 0xFF, 0xFC, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0x02, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x59, 0x40, 0x02, 0xFF, 0xFF, 0x00, 0xBE, 0x40, 0x10, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xFE, 0x2E, 0x00,
-    0x17, 0xF2, 0xF0, 0x00, 0x38, 0x1F, 0xD0, 0x07, 0xC0, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0x90, 0x00, 0x90, 0x00, 0x7C, 0x00, 0x71, 0xC0, 0x10, 0x04, 0x00, 0x00, 0x01, 0xF8,
-    0xF1, 0xFF, 0xFC, 0xE0, 0x7F, 0x70, 0x0F, 0x9C, 0x02, 0xE7, 0x00, 0xB9, 0xC0, 0x3E, 0x3E, 0xBF,
-    0x87, 0xFF, 0xE0, 0x7E, 0x74, 0x00, 0x3D, 0x14, 0x2F, 0x0F, 0xFF, 0x82, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0xC0, 0x00, 0x3E, 0xB8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x2F, 0xFF, 0xF0, 0x0B, 0xE4, 0x01, 0x00,
-    0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x3E, 0x00, 0xBF, 0xE2, 0xE0, 0x01, 0x7F, 0x2F, 0x00, 0x03, 0x81, 0xFD, 0x00, 0x7C, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xF9, 0x00, 0x1D, 0x03, 0x03, 0x41, 0xC0, 0xBF,
-    0xC0, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x3C, 0x7F, 0xFF, 0x38, 0x1F, 0xDC, 0x03,
-    0xE7, 0x00, 0xB9, 0xC0, 0x2E, 0x70, 0x0F, 0x8F, 0xAF, 0xE1, 0xFF, 0xF8, 0x1F, 0x9D, 0x00, 0x0F,
-    0x45, 0x0B, 0xC3, 0xFF, 0xE0, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x02,
-    0xFF, 0xFF, 0x00, 0xBE, 0x40, 0x10, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xFE, 0x2E, 0x00, 0x17, 0xF2, 0xF0,
-    0x00, 0x38, 0x1F, 0xD0, 0x07, 0xC0, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0x90,
-    0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xF1, 0xFF, 0xFC,
-    0xE0, 0x7F, 0x70, 0x0F, 0x9C, 0x02, 0xE7, 0x00, 0xB9, 0xC0, 0x3E, 0x3E, 0xBF, 0x87, 0xFF, 0xE0,
-    0x7E, 0x74, 0x00, 0x3D, 0x14, 0x2F, 0x0F, 0xFF, 0x82, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x00, 0x2F, 0xFF, 0xF0, 0x0B, 0xE4, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0xE2, 0xE0, 0x01, 0x7F,
-    0x2F, 0x00, 0x03, 0x81, 0xFD, 0x00, 0x7C, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x00, 0xBF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x0F,
-    0x40, 0x07, 0xC0, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x7E, 0x3C, 0x7F, 0xFF, 0x38, 0x1F, 0xDC, 0x03,
-    0xE7, 0x00, 0xB9, 0xC0, 0x2E, 0x70, 0x0F, 0x8F, 0xAF, 0xE1, 0xFF, 0xF8, 0x1F, 0x9D, 0x00, 0x0F,
-    0x45, 0x0B, 0xC3, 0xFF, 0xE0, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0xAE, 0x00, 0x02, 0x42, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0x78, 0x00, 0x3C, 0xB8,
-    0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xBC, 0x00,
-    0x3D, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFC, 0x00, 0x7E, 0xFC, 0x00, 0x3E,
-    0xFC, 0x00, 0x7E, 0xFC, 0x00, 0x7E, 0x00, 0x40, 0x00, 0x02, 0xC0, 0x00, 0x0A, 0x70, 0x00, 0x24,
-    0x08, 0x00, 0x01, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0,
-    0x00, 0x03, 0x8A, 0x80, 0x03, 0xFF, 0xF0, 0x03, 0xE0, 0x78, 0x03, 0xC0, 0x38, 0x03, 0xC0, 0x2C,
-    0x03, 0x80, 0x2C, 0x03, 0x80, 0x2C, 0x07, 0xC0, 0x3C, 0x07, 0xC0, 0x3C, 0x07, 0xC0, 0x3C, 0x09,
-    0x00, 0x06, 0x01, 0xE0, 0x00, 0xF0, 0x2E, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0xF0, 0x2E, 0x00, 0x0F,
-    0x4B, 0xFF, 0xFF, 0xFC, 0x7F, 0xAA, 0xAF, 0x82, 0xF0, 0x00, 0xF4, 0x2F, 0xFF, 0xFF, 0x42, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0x83, 0xF0, 0x01, 0xF8, 0x3F, 0x00, 0x0F, 0x83, 0xF0, 0x01, 0xF8,
-    0x3F, 0x00, 0x1F, 0x80, 0x01, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x02, 0xC0, 0x00,
-    0x03, 0xC0, 0x00, 0x03, 0x8A, 0x80, 0x03, 0xFF, 0xF0, 0x03, 0xE0, 0x78, 0x03, 0xC0, 0x38, 0x03,
-    0xC0, 0x2C, 0x03, 0x80, 0x2C, 0x03, 0x80, 0x2C, 0x07, 0xC0, 0x3C, 0x07, 0xC0, 0x3C, 0x07, 0xC0,
-    0x3C, 0x2C, 0x00, 0xCC, 0x96, 0x1F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x02, 0xF0, 0x07,
-    0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F,
-    0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xD0, 0x1D, 0x04, 0xC9, 0x63, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x34, 0x00, 0xD0, 0x03, 0x40, 0x0D, 0x00, 0x34, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC1, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2F,
-    0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C,
-    0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x7F, 0xFD, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40,
-    0x03, 0x40, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0xC0, 0x00, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3E, 0x3E, 0x3E, 0x3F, 0x20, 0x60, 0x3D, 0x00, 0x0A, 0x07, 0xC1,
-    0xF0, 0x00, 0x00, 0x01, 0x00, 0xD0, 0x34, 0x0D, 0x03, 0x40, 0xD0, 0x38, 0x0E, 0x03, 0x81, 0xF0,
-    0x90, 0x30, 0x0B, 0x80, 0x00, 0x64, 0xB8, 0xFC, 0x00, 0x00, 0x00, 0x10, 0xBC, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0xBC, 0xBC, 0xBD, 0x00, 0xD3, 0x4D, 0x34, 0xD3, 0x8E,
-    0x39, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xC7, 0xC0, 0x0F, 0x1F, 0x00, 0x7C, 0x7C, 0x01, 0xF1,
-    0xF0, 0x07, 0xC7, 0xC0, 0x1F, 0x1F, 0x00, 0x7C, 0x7C, 0x01, 0xF1, 0xF0, 0x07, 0xC7, 0xC0, 0x2E,
-    0x1F, 0x00, 0xB8, 0xBC, 0x02, 0xE2, 0xF0, 0x0B, 0x8B, 0xD0, 0x3D, 0x00, 0x01, 0xF4, 0x00, 0xFF,
-    0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x28, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xC7, 0xC0, 0x00,
-    0xF0, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x40, 0x00, 0xB0, 0xD0, 0x00,
-    0x2C, 0x34, 0x00, 0x0F, 0x0D, 0x00, 0x03, 0x83, 0x40, 0x00, 0xE0, 0xE0, 0x00, 0x38, 0x38, 0x00,
-    0x0E, 0x0E, 0x00, 0x03, 0x47, 0xC0, 0x00, 0xD0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x0D, 0xA0, 0x20, 0x28,
-    0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
-    0x00, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x07, 0xE0, 0xBF, 0xC0,
-    0xFF, 0x80, 0xB9, 0x00, 0x00, 0x70, 0x00, 0x3E, 0x00, 0x30, 0xA0, 0x10, 0x04, 0x00, 0x10, 0x00,
-    0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x2C, 0x00, 0x0B, 0x00, 0x02, 0xC0, 0x00,
-    0xB0, 0x00, 0x28, 0x00, 0x0E, 0x00, 0x0B, 0x80, 0x3F, 0xC0, 0x0A, 0x40, 0x00, 0x2D, 0x0B, 0xC0,
-    0xB4, 0x3D, 0x03, 0xC2, 0xE0, 0x0F, 0x1F, 0x00, 0x3C, 0xF8, 0x00, 0xF7, 0xC0, 0x03, 0xFD, 0x00,
-    0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0xC0, 0x07, 0xEF, 0x80, 0x2F, 0x3F, 0x80, 0xB8, 0x3F,
-    0x82, 0xE0, 0xBF, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x7C,
-    0x00, 0x02, 0xF0, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
-    0x00, 0x38, 0x00, 0x03, 0x86, 0x40, 0x38, 0xF0, 0x03, 0xBC, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00,
-    0x7B, 0xD0, 0x07, 0x9F, 0x40, 0x78, 0xBD, 0x07, 0x82, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0x0C, 0x34, 0x1C, 0xB0,
-    0x1D, 0xC0, 0x2F, 0x80, 0x2F, 0x00, 0x2F, 0x40, 0x3B, 0xD0, 0x38, 0xF4, 0x38, 0x7D, 0x0C, 0x00,
-    0x0A, 0x00, 0x03, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00,
-    0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02,
-    0xE0, 0x00, 0xB4, 0x00, 0x2F, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0xC0, 0xD0, 0x70,
-    0x00, 0x00, 0x01, 0x40, 0xE0, 0x38, 0x0D, 0x07, 0x41, 0xD0, 0x70, 0x1C, 0x0B, 0x02, 0xC0, 0xB0,
-    0x2C, 0x0B, 0xF2, 0xFD, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E,
-    0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xD0, 0x00, 0xBE,
-    0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x3F, 0x00, 0x0F,
-    0x80, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0x14, 0x0E, 0x03, 0x80, 0xD0, 0x74, 0x1D, 0x07, 0x01, 0xC0,
-    0xB0, 0x2C, 0x0B, 0x02, 0xC0, 0xBF, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0x0F, 0x83, 0xD1, 0xF0, 0x68,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0x78, 0x0B, 0x1E, 0x02, 0x87, 0x80,
-    0xE1, 0xE0, 0x24, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xD0, 0x00, 0xBE, 0xAB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x28, 0x34, 0xE0, 0xC3, 0x87, 0x0D, 0x08, 0x74, 0x01, 0xD0, 0x07, 0x00, 0x1C,
-    0x00, 0xB0, 0x02, 0xC0, 0x0B, 0x00, 0x2C, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x3C, 0x00, 0x0F, 0x00,
-    0x07, 0x80, 0x01, 0xE0, 0x3C, 0x78, 0x0F, 0x1E, 0x02, 0x97, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00,
-    0x2E, 0x00, 0x0B, 0x40, 0x02, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x14, 0x00, 0xE0, 0x03,
-    0x80, 0x0D, 0x00, 0x74, 0x79, 0xD2, 0xE7, 0x0A, 0x9C, 0x00, 0xB0, 0x02, 0xC0, 0x0B, 0x00, 0x2C,
-    0x00, 0xBF, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xF1, 0xD0, 0x00, 0x00, 0xF3, 0x80, 0x00, 0x01, 0xEB,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x3E, 0xFA, 0xAF, 0x00, 0xB3, 0xFF, 0xFF, 0x01, 0xE3, 0xFF, 0xFF, 0x03, 0xC0, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x40, 0x00, 0x1D, 0x00, 0x00,
-    0x74, 0x00, 0x01, 0xDA, 0x00, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0x2E, 0xB0, 0x07, 0x82, 0xC0, 0x00,
-    0x0B, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0x03, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2E, 0x00, 0x1E, 0x3F, 0x00, 0x1E,
-    0x3F, 0x80, 0x2E, 0x3F, 0xC0, 0x2E, 0x3F, 0xE0, 0x2E, 0x3D, 0xF0, 0x3D, 0x3C, 0xF4, 0x3D, 0x7C,
-    0x7C, 0x3D, 0x7C, 0x3D, 0x3D, 0x7C, 0x1F, 0x3D, 0xBC, 0x0F, 0xBC, 0xBC, 0x07, 0xFC, 0xBC, 0x03,
-    0xFC, 0xFC, 0x01, 0xFC, 0x00, 0x0C, 0x00, 0x02, 0x80, 0x00, 0x34, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0xFF, 0xD0, 0x3E, 0x0B, 0x03, 0xC0, 0x34, 0x3C, 0x03, 0x83,
-    0xC0, 0x38, 0x3C, 0x03, 0xC7, 0xC0, 0x3C, 0x7C, 0x03, 0xC7, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x19,
-    0x00, 0x1E, 0x3F, 0x00, 0x1E, 0x3F, 0x80, 0x2E, 0x3F, 0xC0, 0x2E, 0x3F, 0xD0, 0x2E, 0x3D, 0xF0,
-    0x3D, 0x3C, 0xF4, 0x3D, 0x7C, 0x7C, 0x3D, 0x7C, 0x3D, 0x3D, 0x7C, 0x1F, 0x3D, 0xBC, 0x0F, 0xBC,
-    0xBC, 0x07, 0xFC, 0xBC, 0x03, 0xFC, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x10, 0x03, 0xFF, 0xD0,
-    0x3E, 0x0B, 0x03, 0xC0, 0x34, 0x3C, 0x03, 0x83, 0xC0, 0x38, 0x3C, 0x03, 0xC7, 0xC0, 0x3C, 0x7C,
-    0x03, 0xC7, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0,
-    0x00, 0x68, 0x00, 0x01, 0x00, 0x40, 0x00, 0xD2, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x1E, 0x3F, 0x00, 0x1E, 0x3F, 0x80, 0x2E, 0x3F, 0xC0,
-    0x2E, 0x3F, 0xD0, 0x2E, 0x3D, 0xF0, 0x3D, 0x3C, 0xF4, 0x3D, 0x7C, 0x7C, 0x3D, 0x7C, 0x3D, 0x3D,
-    0x7C, 0x1F, 0x3D, 0xBC, 0x0F, 0xBC, 0xBC, 0x07, 0xFC, 0xBC, 0x03, 0xFC, 0xFC, 0x01, 0xFC, 0x05,
-    0x02, 0x00, 0x29, 0xD0, 0x00, 0xB4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x03, 0xFF, 0xD0, 0x3E, 0x0B, 0x03, 0xC0, 0x34, 0x3C, 0x03, 0x83, 0xC0, 0x38, 0x3C, 0x03, 0xC7,
-    0xC0, 0x3C, 0x7C, 0x03, 0xC7, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x07, 0x40, 0x07, 0x80, 0x07, 0xC0,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0E, 0xFF, 0x43, 0xD0, 0xF0,
-    0xF0, 0x1D, 0x78, 0x07, 0x5E, 0x01, 0xE7, 0x80, 0x79, 0xE0, 0x1E, 0xB8, 0x07, 0xAF, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x19, 0x00, 0x1E, 0x3F, 0x00, 0x1E, 0x3F, 0x80, 0x2E, 0x3F, 0xC0, 0x2E, 0x3F,
-    0xD0, 0x2E, 0x3D, 0xF0, 0x3D, 0x3C, 0xF4, 0x3D, 0x7C, 0x7C, 0x3D, 0x7C, 0x3D, 0x3D, 0x7C, 0x1F,
-    0x3D, 0xBC, 0x0F, 0xBC, 0xBC, 0x07, 0xFC, 0xBC, 0x03, 0xFC, 0xFC, 0x02, 0xFC, 0x00, 0x03, 0xF8,
-    0x00, 0x3F, 0xE0, 0x00, 0x14, 0x00, 0x00, 0x10, 0x03, 0xFF, 0xD0, 0x3E, 0x0B, 0x03, 0xC0, 0x34,
-    0x3C, 0x03, 0x83, 0xC0, 0x38, 0x3C, 0x03, 0xC7, 0xC0, 0x3C, 0x7C, 0x03, 0xC7, 0xC0, 0x7C, 0x00,
-    0x07, 0xC0, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x02, 0xFA, 0xBE, 0x02, 0xF4, 0x07, 0xF0,
-    0xF4, 0x00, 0x7D, 0x7C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
-    0xF4, 0x00, 0x03, 0xED, 0x00, 0x01, 0xEB, 0xD0, 0x00, 0xF8, 0xFF, 0xAB, 0xFC, 0x2F, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0x41, 0x95, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x1F, 0xAF, 0x03, 0x80, 0x38, 0x34, 0x02,
-    0xC7, 0x00, 0x1C, 0x74, 0x01, 0xC3, 0x80, 0x2C, 0x3E, 0xAF, 0x81, 0xFF, 0xF0, 0x06, 0xF8, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x60, 0x1C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x2F, 0xAB, 0xE0, 0x2F, 0x40, 0x7F, 0x0F, 0x40, 0x07,
-    0xD7, 0xC0, 0x00, 0xFA, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x3E, 0xD0, 0x00, 0x1E, 0xBD, 0x00, 0x0F, 0x8F, 0xFA, 0xBF, 0xC2, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF,
-    0xF0, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x30, 0x0F, 0xAF, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x01, 0xFA,
-    0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C, 0x70, 0x01, 0xC7, 0x40, 0x1C, 0x38, 0x02, 0xC3, 0xEA, 0xF8,
-    0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x00, 0x50, 0x01, 0x40, 0x2D, 0x00, 0xB0, 0x0B, 0x40, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x0B, 0xEA, 0xF8, 0x02, 0xF4, 0x07,
-    0xF0, 0x3D, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0xF8, 0xB4, 0x00, 0x07, 0xCF, 0x40, 0x00, 0x3C, 0xF0,
-    0x00, 0x03, 0xCF, 0x40, 0x00, 0x3C, 0xB4, 0x00, 0x07, 0x8B, 0xD0, 0x00, 0xF8, 0x3F, 0xEA, 0xFF,
-    0x02, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x03, 0x81, 0xF0, 0x07, 0x80, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x07, 0xEB, 0xC0, 0x03, 0x80, 0x38, 0x00,
-    0xD0, 0x0B, 0x00, 0x70, 0x01, 0xC0, 0x1D, 0x00, 0x70, 0x03, 0x80, 0x2C, 0x00, 0xFA, 0xBE, 0x00,
-    0x1F, 0xFF, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x01, 0xBF, 0xDA, 0xFF, 0xF0, 0x2F, 0xAB, 0xFF, 0xFF,
-    0xC2, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x40, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x02, 0xD0,
-    0x00, 0x3F, 0x00, 0x0F, 0x40, 0x00, 0xFF, 0xF4, 0x3C, 0x00, 0x07, 0xFF, 0xD0, 0xF4, 0x00, 0x1F,
-    0xC0, 0x02, 0xE0, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x01, 0xF8, 0x00, 0x0F, 0xFA, 0xBF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x1B, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBE, 0x03, 0xF8, 0x01, 0xFA, 0xF7, 0x81, 0xC0, 0xE0, 0x0F, 0x80, 0x28,
-    0x34, 0x02, 0xEA, 0xBF, 0x1C, 0x00, 0x7F, 0xAA, 0x47, 0x40, 0x2C, 0x00, 0x00, 0xE0, 0x0B, 0x80,
-    0x00, 0x3E, 0xAB, 0xFD, 0x05, 0x07, 0xFF, 0xDF, 0xFF, 0x80, 0x6F, 0x80, 0xBF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0xC0, 0x00, 0x0B, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x0E, 0xAB, 0xC0, 0x30, 0x07, 0x40, 0xC0, 0x0E, 0x07, 0x00, 0x78, 0x1E, 0x5B, 0xD0, 0x7F,
-    0xFD, 0x01, 0xFF, 0xF8, 0x0B, 0xC0, 0xF4, 0x2F, 0x01, 0xF0, 0xBC, 0x03, 0xC2, 0xF0, 0x0F, 0x4F,
-    0xC0, 0x7E, 0x3F, 0x01, 0xFC, 0x02, 0x40, 0x0C, 0x00, 0xB0, 0x01, 0x00, 0x00, 0x00, 0xB7, 0xC2,
-    0xFF, 0x4B, 0x80, 0x3D, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3D, 0x01, 0xF4, 0x00, 0x3F, 0xF8,
-    0x00, 0xEA, 0xBC, 0x03, 0x00, 0x74, 0x0C, 0x00, 0xE0, 0x70, 0x07, 0x81, 0xE5, 0xBD, 0x07, 0xFF,
-    0xD0, 0x1F, 0xFF, 0x80, 0xBC, 0x0F, 0x42, 0xF0, 0x1F, 0x0B, 0xC0, 0x3C, 0x2F, 0x00, 0xF4, 0xFC,
-    0x07, 0xE3, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1A, 0x00, 0x00, 0x0B, 0x7C, 0x0B, 0xFD, 0x0B,
-    0x80, 0x0F, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x1F, 0x40, 0x1F, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x34, 0x34, 0x00, 0x3B, 0x40, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x0E, 0xAB, 0xC0, 0x30, 0x07, 0x40, 0xC0, 0x0E, 0x07, 0x00, 0x78, 0x1E, 0x5B, 0xD0,
-    0x7F, 0xFD, 0x01, 0xFF, 0xF8, 0x0B, 0xC0, 0xF4, 0x2F, 0x01, 0xF0, 0xBC, 0x03, 0xC2, 0xF0, 0x0F,
-    0x4F, 0xC0, 0x7E, 0x3F, 0x01, 0xFC, 0x20, 0x08, 0x1D, 0x70, 0x07, 0xC0, 0x01, 0x40, 0x00, 0x00,
-    0x0B, 0x7C, 0x0B, 0xFD, 0x0B, 0x80, 0x0F, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x40,
-    0x1F, 0x40, 0x00, 0x0A, 0x00, 0x00, 0x03, 0x40, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0x90, 0x00, 0x07,
-    0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0xBF, 0xFD, 0x00,
-    0x01, 0xBF, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x42, 0x50, 0x7F, 0xD2, 0xFF, 0xFF, 0xF1,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x1C, 0x00, 0x0E,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x75, 0x50, 0x28, 0x00, 0x0B, 0x40,
-    0x00, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0x03, 0x97, 0xD3, 0xFF, 0xF0, 0xBF, 0xF4, 0x00, 0x28,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x28, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xF8, 0x00, 0xBF, 0xFF, 0x00, 0x3E, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x3F, 0xF9, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x0B, 0xF0, 0x00,
-    0x01, 0xFD, 0x09, 0x41, 0xFF, 0x4B, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC0, 0xBF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x78, 0x00, 0x77, 0x80, 0x60, 0x24, 0x00, 0x00, 0x01, 0xFF,
-    0x41, 0xD5, 0x40, 0xA0, 0x00, 0x2D, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x3C, 0x0E, 0x5F,
-    0x4F, 0xFF, 0xC2, 0xFF, 0xD0, 0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xFC, 0x00, 0xF9, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x1B, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF4, 0x25, 0x07, 0xFD, 0x2F, 0xFF, 0xFF, 0x1F,
-    0xFF, 0xFF, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x10, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x02, 0xE0, 0x00, 0x07, 0xFD, 0x07, 0x55, 0x02, 0x80, 0x00, 0xB4, 0x00, 0x0F, 0xE0, 0x00, 0xBF,
-    0x80, 0x00, 0xF0, 0x39, 0x7D, 0x3F, 0xFF, 0x0B, 0xFF, 0x40, 0x08, 0x00, 0x03, 0x40, 0x00, 0x08,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xA0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x0B, 0xFF, 0xF0,
-    0x03, 0xE4, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xFF, 0x90,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xD0, 0x94, 0x1F,
-    0xF4, 0xBF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
-    0x02, 0x8B, 0x00, 0x2F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x75, 0x50,
-    0x28, 0x00, 0x0B, 0x40, 0x00, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0x03, 0x97, 0xD3, 0xFF, 0xF0,
-    0xBF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x00, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x07, 0x80, 0x3F, 0xFC, 0x07,
-    0x40, 0x07, 0x40, 0x07, 0x40, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x80, 0x0B, 0xFC, 0x0B, 0xFC, 0x00,
-    0x90, 0x00, 0x08, 0x00, 0xF8, 0x00, 0x00, 0x40, 0x02, 0x82, 0x40, 0x00, 0xBD, 0x00, 0x00, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3C, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x07, 0x00, 0x0B, 0x02, 0x8B, 0x03, 0x85, 0x07, 0x80, 0x3F, 0xFC, 0x07, 0x40, 0x07,
-    0x40, 0x07, 0x40, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x80, 0x0B, 0xFC, 0x0B, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x0A,
-    0xFE, 0x90, 0x0F, 0xFF, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0E, 0x00, 0x07, 0x80,
-    0x0F, 0xFF, 0x00, 0x74, 0x02, 0xBF, 0xA0, 0xFF, 0xFC, 0x02, 0xD0, 0x00, 0xB4, 0x00, 0x2E, 0x00,
-    0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x01, 0xD0, 0x80, 0x03, 0x35, 0x80, 0x03, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xBC, 0x00, 0x7D,
-    0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8,
-    0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0x09, 0x06, 0x32, 0x01, 0x47, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1C,
-    0x00, 0xD7, 0x00, 0x35, 0xD0, 0x1E, 0x74, 0x07, 0x8D, 0x01, 0xE3, 0x80, 0x78, 0xF0, 0x2E, 0x3F,
-    0xFF, 0x8B, 0xFF, 0xE0, 0xBE, 0x3C, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xB8, 0x00,
-    0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C,
-    0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0x5C, 0x00, 0xD7,
-    0x40, 0x79, 0xD0, 0x1E, 0x34, 0x07, 0x8E, 0x01, 0xE3, 0xC0, 0xB8, 0xFF, 0xFE, 0x2F, 0xFF, 0x82,
-    0xF8, 0xF0, 0x00, 0x40, 0x40, 0x07, 0x01, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0x69, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xBC, 0x00, 0x7D,
-    0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8,
-    0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x38, 0x06, 0x0A, 0x03, 0x40, 0xFF, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x35, 0xC0, 0x0D, 0x74, 0x07, 0x9D, 0x01, 0xE3, 0x40, 0x78, 0xE0, 0x1E, 0x3C,
-    0x0B, 0x8F, 0xFF, 0xE2, 0xFF, 0xF8, 0x2F, 0x8F, 0x00, 0x68, 0x00, 0x00, 0x85, 0x00, 0x00, 0x85,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D,
-    0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8,
-    0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x88, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x35, 0xC0, 0x0D, 0x74, 0x07, 0x9D, 0x01,
-    0xE3, 0x40, 0x78, 0xE0, 0x1E, 0x3C, 0x0B, 0x8F, 0xFF, 0xE2, 0xFF, 0xF8, 0x2F, 0x8F, 0x01, 0x80,
-    0x06, 0x02, 0xD0, 0x0B, 0x42, 0x90, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x07, 0xD3, 0xF0, 0x01, 0xF4, 0xFC, 0x00, 0x7D, 0x2E, 0x00, 0x1F, 0x0B, 0x80,
-    0x07, 0xC2, 0xE0, 0x00, 0xF0, 0xB8, 0x00, 0x3C, 0x2E, 0x00, 0x0F, 0x0B, 0x80, 0x03, 0xC1, 0xF0,
-    0x01, 0xF0, 0x7E, 0x01, 0xFC, 0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x1D, 0x1E, 0x00, 0xB8, 0x14, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1C, 0x00, 0xD0, 0x1C, 0x00, 0xD0, 0x1D, 0x01, 0xE0, 0x1D, 0x01, 0xE0, 0x0D, 0x01,
-    0xE0, 0x0E, 0x01, 0xE0, 0x0F, 0x02, 0xE0, 0x0F, 0xFF, 0xE0, 0x0B, 0xFF, 0xE0, 0x02, 0xF8, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xB8, 0x00, 0x7C, 0xB8,
-    0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0x7C, 0x00,
-    0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0xD0, 0x00, 0x06, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x70, 0x03, 0x5C, 0x00, 0xD7, 0x40, 0x79,
-    0xD0, 0x1E, 0x34, 0x07, 0x8E, 0x01, 0xE3, 0xC0, 0xB8, 0xFF, 0xFE, 0x2F, 0xFF, 0x82, 0xF9, 0xF0,
-    0x00, 0x90, 0x00, 0x60, 0x00, 0x28, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x0A, 0x2C, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x2D, 0xB8, 0x00, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0x00, 0x7C, 0x3C,
-    0x00, 0x00, 0x0B, 0x83, 0xD0, 0x1F, 0x00, 0xF4, 0x2E, 0x03, 0xF4, 0x0F, 0x01, 0xF0, 0x7F, 0xC1,
-    0xF0, 0x0F, 0x0F, 0xFD, 0x2E, 0x00, 0xF5, 0xF6, 0xF3, 0xD0, 0x0F, 0xBF, 0x1F, 0x7C, 0x00, 0xBF,
-    0xE0, 0xFF, 0xC0, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x03, 0xF4, 0x03, 0xF0,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0A, 0x28, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x78, 0xF0, 0x00, 0x2D, 0x3C, 0x08, 0x0F, 0x0B, 0x4B,
-    0xC3, 0xC1, 0xE7, 0xF9, 0xE0, 0x3F, 0xFF, 0xF4, 0x0B, 0xFB, 0xFC, 0x01, 0xFC, 0xBF, 0x00, 0x3D,
-    0x0F, 0x80, 0x00, 0x10, 0x00, 0x00, 0x78, 0x00, 0x01, 0xDA, 0x00, 0x02, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x3D, 0x3C, 0x00, 0x7C, 0x2E, 0x00, 0xF4, 0x0F, 0x01, 0xF0,
-    0x0B, 0xC3, 0xD0, 0x03, 0xDB, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x02, 0xF8, 0x00, 0xA0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x40, 0x1D, 0x3C, 0x02, 0xC1, 0xE0, 0x3C, 0x0F, 0x03, 0x80, 0x78, 0xB4, 0x03, 0xCF, 0x00, 0x1F,
-    0xF0, 0x00, 0xFE, 0x00, 0x07, 0xE0, 0x00, 0x7D, 0x00, 0x07, 0xC0, 0x01, 0xF8, 0x03, 0xFF, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x02, 0x42, 0x80, 0x07, 0xC3, 0xD0, 0x0B, 0xC3, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x3D, 0x3C, 0x00, 0x7C, 0x2E, 0x00, 0xF4,
-    0x0F, 0x01, 0xF0, 0x0B, 0xC3, 0xD0, 0x03, 0xDB, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x40, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFC, 0x01, 0x55, 0x7F, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFA, 0xAA, 0x8F, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFD, 0x00, 0x28, 0x00, 0x03, 0x00, 0x00, 0xB0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0xAA, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x3E, 0x00,
-    0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x3F, 0xFF, 0x07, 0xFF, 0xF8, 0x00, 0x2C, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
-    0xF0, 0x05, 0x55, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEA,
-    0xAA, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF4, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x0A, 0xAF, 0xC0, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x0F,
-    0x80, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x03, 0xFF, 0xF0, 0x7F, 0xFF, 0x80, 0x01, 0x00,
-    0x40, 0x00, 0x34, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFC, 0x01, 0x55, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFA, 0xAA, 0x8F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFD, 0x08,
-    0x02, 0x00, 0x3A, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0xAA, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x02,
-    0xF0, 0x00, 0x3F, 0xFF, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xFD, 0x2C, 0x03, 0x80, 0x34, 0x03, 0x40,
-    0x38, 0x03, 0x80, 0x38, 0x07, 0x80, 0x78, 0x07, 0x80, 0x78, 0x07, 0x80, 0x00, 0x00, 0x00, 0x20,
-    0x1B, 0xFD, 0x07, 0x0B, 0xEA, 0xFC, 0xA2, 0xF4, 0x07, 0xFC, 0x3D, 0x00, 0x1F, 0x47, 0xC0, 0x00,
-    0xF8, 0xB4, 0x00, 0x07, 0xCF, 0x40, 0x00, 0x3C, 0xF0, 0x00, 0x03, 0xCF, 0x40, 0x00, 0x3C, 0xB4,
-    0x00, 0x07, 0x8B, 0xD0, 0x00, 0xF8, 0x3F, 0xEA, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFC,
-    0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1B, 0xE0, 0x81, 0xFA, 0xF7,
-    0x0E, 0x00, 0xF4, 0x34, 0x02, 0xC1, 0xC0, 0x07, 0x07, 0x40, 0x1C, 0x0E, 0x00, 0xB0, 0x3E, 0xAF,
-    0x80, 0x7F, 0xFC, 0x00, 0x6F, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xEA, 0xF4, 0x7F, 0x40, 0x3C,
-    0xA7, 0x40, 0x2D, 0x97, 0x40, 0x2C, 0x5B, 0x40, 0x7C, 0x0B, 0xFF, 0xF8, 0x0B, 0xFF, 0xD0, 0x0B,
-    0x80, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0x01, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x4B, 0x80, 0x0E,
-    0xFA, 0xD0, 0x3F, 0x02, 0xC0, 0xF4, 0x07, 0x03, 0xC0, 0x0C, 0x0F, 0x00, 0x34, 0x3E, 0x01, 0xC0,
-    0xFE, 0x5F, 0x03, 0xFF, 0xF4, 0x1E, 0x7F, 0x80, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x70, 0x00, 0x18, 0x00, 0x0A, 0x00, 0x02, 0x80,
-    0x00, 0x90, 0x00, 0x90, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xBF, 0xFE, 0xBF, 0xFE, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x60, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xF4,
-    0x02, 0xC0, 0x03, 0x80, 0x07, 0x80, 0x3F, 0xFC, 0x07, 0x40, 0x07, 0x40, 0x07, 0x40, 0x0B, 0x40,
-    0x0B, 0x40, 0x0B, 0x80, 0x0B, 0xFC, 0x0B, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3C,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0xFD, 0xFC, 0x00, 0x7D, 0x3F, 0x00,
-    0x1F, 0x4B, 0x80, 0x07, 0xC2, 0xE0, 0x01, 0xF0, 0xB8, 0x00, 0x3C, 0x2E, 0x00, 0x0F, 0x0B, 0x80,
-    0x03, 0xC2, 0xE0, 0x00, 0xF0, 0x7C, 0x00, 0x7C, 0x1F, 0x80, 0x7F, 0x03, 0xFF, 0xFF, 0x80, 0xFF,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xC0, 0x0D, 0xC7, 0x00,
-    0x3E, 0x1D, 0x01, 0xF0, 0x74, 0x07, 0x80, 0xD0, 0x1E, 0x03, 0x80, 0x78, 0x0F, 0x02, 0xE0, 0x3F,
-    0xFF, 0x80, 0xBF, 0xFE, 0x00, 0xBE, 0x3C, 0x00, 0x14, 0x00, 0xF0, 0x02, 0xD0, 0x28, 0xCB, 0x10,
-    0x03, 0x40, 0x3F, 0x03, 0x43, 0x00, 0x00, 0x74, 0x2D, 0x92, 0xC2, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x15, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x73,
-    0xEB, 0x47, 0xF8, 0x00, 0x00, 0x18, 0x3D, 0x3E, 0x18, 0x0A, 0x0F, 0x47, 0xC3, 0xE2, 0xF0, 0x18,
-    0x07, 0x0C, 0x00, 0x28, 0x85, 0x85, 0x7C, 0x00, 0x90, 0x02, 0x40, 0xF0, 0x07, 0x81, 0xE0, 0x07,
-    0x80, 0x00, 0x00, 0xD0, 0xC0, 0xFC, 0x00, 0xD0, 0x14, 0x00, 0x90, 0x03, 0x80, 0x1E, 0x00, 0x2C,
-    0x01, 0xE0, 0x14, 0x0F, 0x83, 0xF0, 0x7C, 0x0F, 0x40, 0x1F, 0x47, 0xC1, 0xF0, 0xF8, 0x29, 0x00,
-    0x3E, 0x0F, 0x82, 0xF0, 0x7C, 0x0A, 0x40, 0x00, 0x3B, 0xC3, 0x00, 0x02, 0x4B, 0xA4, 0x00, 0xBE,
-    0xA4, 0x55, 0xE0, 0x03, 0x80, 0x0A, 0x00, 0x83, 0x24, 0x18, 0x20, 0x00, 0x14, 0xBE, 0xBE, 0x14,
-    0x00, 0x00, 0x14, 0x68, 0x00, 0x00, 0x14, 0x7F, 0xFE, 0x00, 0x00, 0x18, 0x3D, 0x3E, 0x18, 0x0A,
-    0x0F, 0x47, 0xC3, 0xE2, 0xF0, 0x28, 0x85, 0x85, 0x7C, 0x05, 0x07, 0xD1, 0xF0, 0xBC, 0x3E, 0x0A,
-    0x40, 0x00, 0x40, 0x58, 0x08, 0xB4, 0x14, 0x20, 0x90, 0x3D, 0x00, 0x7B, 0xBB, 0x50, 0xBF, 0xC9,
-    0x0C, 0x50, 0x80, 0x20, 0x24, 0x3B, 0x40, 0x78, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x01, 0xED, 0x18,
-    0x09, 0x74, 0x2D, 0x92, 0xC2, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x74, 0x2D, 0x92, 0xC2, 0xD0, 0x00, 0x6A, 0xA9, 0xBF, 0xFE, 0x52, 0x90, 0x50,
-    0x89, 0x0C, 0xBF, 0xC0, 0x00, 0x6A, 0xA0, 0x38, 0x0E, 0xFF, 0x69, 0x48, 0x48, 0x84, 0x80, 0x00,
-    0x00, 0x06, 0x40, 0xC0, 0x88, 0x74, 0x2D, 0x92, 0xC2, 0xD0, 0x00, 0x90, 0xC5, 0x00, 0x00, 0x00,
-    0x00, 0x0C, 0x00, 0x0A, 0x00, 0x03, 0x40, 0x00, 0x00, 0x06, 0x02, 0x83, 0xD1, 0xF0, 0xF8, 0xBC,
-    0xBF, 0xC9, 0x0C, 0x50, 0x80, 0x00, 0x14, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x15,
-    0x00, 0x70, 0x72, 0xC1, 0xCB, 0x0B, 0x2C, 0x2C, 0x50, 0x10, 0x55, 0x2F, 0xF0, 0x3C, 0x0F, 0x00,
-    0x00, 0x00, 0x40, 0x08, 0x01, 0x47, 0x62, 0xDB, 0x2C, 0x7D, 0x09, 0x00, 0xC0, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x80, 0x0A, 0xE8, 0x10, 0xE2, 0xE0, 0xB8, 0x1E, 0x3C, 0x01,
-    0xBF, 0xC0, 0x0B, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0B, 0x80, 0x22, 0xCA,
-    0x07, 0x38, 0x38, 0xA2, 0x40, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x3C, 0x74, 0xB2, 0x40, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x02, 0xC2, 0x40, 0x00, 0x20, 0x80, 0x00, 0x40, 0x00, 0x00,
-    0x42, 0x40, 0x00, 0x24, 0x06, 0xAA, 0xA4, 0x00, 0x06, 0xAA, 0xA4, 0x02, 0x40, 0x00, 0x24, 0x40,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x07, 0xF4, 0x00, 0x03, 0xCE, 0x00, 0x00, 0xE3, 0xC0, 0x00, 0xB4, 0x74, 0x00, 0x3C, 0x0F, 0x00,
-    0x1E, 0x03, 0xD0, 0x0B, 0x40, 0x78, 0x03, 0xD0, 0x1F, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC,
-    0x7C, 0x00, 0x1F, 0x2F, 0x00, 0x03, 0xE0, 0xFF, 0xF8, 0x03, 0xD5, 0xBD, 0x0F, 0x00, 0x38, 0x3C,
-    0x00, 0xF0, 0xF0, 0x07, 0x83, 0xFF, 0xF8, 0x0F, 0xAB, 0xF8, 0x3C, 0x00, 0xB8, 0xF0, 0x00, 0xF3,
-    0xC0, 0x03, 0xCF, 0x00, 0x2F, 0x3E, 0xAF, 0xFC, 0xFF, 0xFF, 0xD3, 0xFF, 0xF9, 0x00, 0x6A, 0xA8,
-    0xBF, 0xFC, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00,
-    0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0xFB, 0x00, 0x01, 0xE7, 0x80, 0x03, 0xC3, 0xC0, 0x07, 0x81, 0xE0, 0x0F,
-    0x40, 0xF0, 0x1F, 0x00, 0xB8, 0x3D, 0x00, 0x3C, 0x7C, 0x00, 0x3E, 0xBE, 0xAA, 0xBF, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00,
-    0xB4, 0x00, 0x0B, 0xFF, 0xC0, 0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF,
-    0xFF, 0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xC0, 0x15, 0x57,
-    0xF0, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0xAA, 0xA8, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xD0, 0x10, 0x00, 0x14, 0x78, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00,
-    0x3C, 0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xBC, 0x00, 0x3D, 0xBF, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFC, 0x00, 0x7E, 0xFC, 0x00, 0x3E, 0xFC, 0x00, 0x7E, 0xFC,
-    0x00, 0x7E, 0x01, 0xBF, 0x90, 0x02, 0xFA, 0xBE, 0x02, 0xF4, 0x07, 0xF0, 0xF4, 0x00, 0x7D, 0x7C,
-    0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFF, 0x45, 0x68, 0x3F, 0xC7, 0xFE, 0x0F, 0xF4, 0x00, 0x03, 0xED,
-    0x00, 0x01, 0xEB, 0xD0, 0x00, 0xF8, 0xFF, 0xAB, 0xFC, 0x2F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00,
-    0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0xBC, 0xBC, 0xBD, 0x2D, 0x0B, 0xC0, 0xB4, 0x3D, 0x03, 0xC2, 0xE0, 0x0F, 0x1F, 0x00,
-    0x3C, 0xF8, 0x00, 0xF7, 0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0xC0,
-    0x07, 0xEF, 0x80, 0x2F, 0x3F, 0x80, 0xB8, 0x3F, 0x82, 0xE0, 0xBF, 0x8F, 0x80, 0xFF, 0x40, 0x00,
-    0xBF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xF3, 0xF0,
-    0x00, 0x3D, 0x1F, 0x40, 0x07, 0xC0, 0xF8, 0x00, 0xBC, 0x0B, 0xC0, 0x0F, 0x40, 0x7D, 0x01, 0xF0,
-    0x03, 0xE0, 0x2E, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0xF4, 0x7C, 0x00, 0x0B, 0x8B, 0x80, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x43, 0xF4, 0x00, 0xFD, 0x0F,
-    0xF0, 0x07, 0xF8, 0x7F, 0xC0, 0x2F, 0xE1, 0xEF, 0x80, 0xFB, 0x87, 0xAF, 0x07, 0xEF, 0x1E, 0x7D,
-    0x3E, 0xBC, 0x7C, 0xFD, 0xF2, 0xF2, 0xF2, 0xFF, 0xCB, 0xCB, 0xC3, 0xFE, 0x3F, 0x2F, 0x0B, 0xF0,
-    0xFC, 0xBC, 0x1F, 0xC3, 0xF7, 0xF0, 0x3D, 0x0F, 0xDF, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x1E, 0x3F, 0x00, 0x1E, 0x3F, 0x80, 0x2E, 0x3F, 0xC0, 0x2E, 0x3F, 0xD0, 0x2E, 0x3D,
-    0xF0, 0x3D, 0x3C, 0xF4, 0x3D, 0x7C, 0x7C, 0x3D, 0x7C, 0x3D, 0x3D, 0x7C, 0x1F, 0x3D, 0xBC, 0x0F,
-    0xBC, 0xBC, 0x07, 0xFC, 0xBC, 0x03, 0xFC, 0xFC, 0x01, 0xFC, 0x3F, 0xFF, 0xF0, 0x55, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x01, 0xBF, 0x90, 0x02, 0xFA,
-    0xBE, 0x02, 0xF4, 0x07, 0xF0, 0xF4, 0x00, 0x7D, 0x7C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xED, 0x00, 0x01, 0xEB, 0xD0, 0x00, 0xF8, 0xFF,
-    0xAB, 0xFC, 0x2F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x2C, 0x01, 0xCB, 0x00, 0x72, 0xC0, 0x1C, 0xB0, 0x07, 0x2C, 0x01, 0xCB, 0x00, 0x72, 0xC0,
-    0x1C, 0xB0, 0x07, 0x2C, 0x01, 0xCB, 0x00, 0x72, 0xC0, 0x1C, 0x3F, 0xF8, 0x07, 0xEA, 0xF4, 0x74,
-    0x03, 0xC7, 0x40, 0x2D, 0x74, 0x02, 0xCB, 0x40, 0x7C, 0xBF, 0xFF, 0x8B, 0xFF, 0xD0, 0xB8, 0x00,
-    0x0B, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00,
-    0xBF, 0xFE, 0x70, 0x00, 0x18, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0x90, 0x00, 0x90, 0x03, 0x80,
-    0x0E, 0x00, 0x38, 0x00, 0xBF, 0xFE, 0xBF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x7D, 0x00, 0xB4, 0x00, 0x3D, 0x3C, 0x00, 0x7C, 0x2E, 0x00, 0xF4, 0x0F, 0x01, 0xF0,
-    0x0B, 0xC3, 0xD0, 0x03, 0xDB, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00,
-    0xBF, 0xFF, 0xD0, 0x01, 0xFD, 0x75, 0xFE, 0x00, 0xFC, 0x0C, 0x0B, 0xE0, 0xBC, 0x03, 0x00, 0xFC,
-    0x3E, 0x01, 0xC0, 0x1F, 0x4F, 0x40, 0x70, 0x03, 0xD3, 0xD0, 0x1C, 0x00, 0xF4, 0xFC, 0x07, 0x00,
-    0xBC, 0x2F, 0xD1, 0xC1, 0xBF, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x80, 0x01, 0xBF,
-    0xFE, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00,
-    0x03, 0xC0, 0xF0, 0x02, 0xD0, 0x2E, 0x01, 0xE0, 0x03, 0xD0, 0xF0, 0x00, 0x7C, 0xF4, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0x7E, 0x00, 0x1F,
-    0x8B, 0xD0, 0x0F, 0xC0, 0xFC, 0x0B, 0xD0, 0x1F, 0x87, 0xE0, 0x02, 0xF4, 0xB0, 0x34, 0x1C, 0xB0,
-    0x34, 0x1C, 0xB0, 0x34, 0x1C, 0x70, 0x30, 0x2C, 0x34, 0x30, 0x38, 0x3C, 0x30, 0xF4, 0x1F, 0xBB,
-    0xF0, 0x07, 0xFF, 0x80, 0x00, 0x34, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x0B,
-    0x81, 0xF4, 0x1D, 0x00, 0x3C, 0x3C, 0x00, 0x1D, 0x38, 0x00, 0x0E, 0x74, 0x00, 0x0F, 0x74, 0x00,
-    0x0F, 0x38, 0x00, 0x0E, 0x3C, 0x00, 0x2D, 0x0E, 0x00, 0xB8, 0x6F, 0xC2, 0xFE, 0xBF, 0xC2, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0x0F, 0xAF, 0x40, 0x3C, 0x0B, 0x40, 0x34,
-    0x07, 0x40, 0x70, 0x03, 0x80, 0x70, 0x03, 0x80, 0x70, 0x0B, 0xC0, 0x3E, 0xBF, 0xC0, 0x2F, 0xFF,
-    0xC4, 0x0B, 0xE6, 0xFC, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x1F, 0xF4, 0x03, 0x82, 0xD0, 0xB0, 0x07, 0x0B, 0x00, 0x70, 0xB0, 0x0E, 0x0B, 0x1F, 0x80,
-    0xB0, 0x5F, 0x0B, 0x00, 0x3C, 0xB0, 0x03, 0xCB, 0xE4, 0x7C, 0xBF, 0xFF, 0xCB, 0x6F, 0xF4, 0xB0,
-    0x19, 0x0B, 0x00, 0x00, 0xB0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x38, 0x38, 0x03,
-    0x82, 0xC0, 0x38, 0x0F, 0x03, 0x80, 0xB4, 0x74, 0x03, 0xCB, 0x00, 0x2E, 0xF0, 0x01, 0xFD, 0x00,
-    0x1F, 0xC0, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x34, 0x16, 0x03, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xF4,
-    0x00, 0xBF, 0xD0, 0x3F, 0x5F, 0x47, 0xC0, 0x3C, 0xB4, 0x03, 0xCB, 0x80, 0x3C, 0x3D, 0x1B, 0xC2,
-    0xFF, 0xF0, 0x06, 0xF8, 0x00, 0x0A, 0x40, 0x82, 0x05, 0x00, 0x08, 0x00, 0x2E, 0x01, 0xC0, 0x0A,
-    0x0B, 0x1E, 0xB8, 0x2F, 0x80, 0x0B, 0xFF, 0x00, 0x1E, 0x40, 0x1D, 0x00, 0x1D, 0x00, 0x0E, 0x00,
-    0x07, 0x40, 0x02, 0xC0, 0x00, 0x74, 0x00, 0x0B, 0xD4, 0x00, 0x7F, 0x80, 0x01, 0xF0, 0x00, 0x78,
-    0x00, 0x3C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x1E, 0xFF, 0x40, 0xF4, 0x2C, 0x1D,
-    0x00, 0xD1, 0xD0, 0x0D, 0x1D, 0x00, 0xD1, 0xD0, 0x0E, 0x2D, 0x00, 0xE2, 0xE0, 0x0E, 0x2E, 0x00,
-    0xE0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0x90, 0x03,
-    0x47, 0x03, 0x80, 0x70, 0xD0, 0x0C, 0x70, 0x03, 0xAD, 0x55, 0xEB, 0xFF, 0xFA, 0xC0, 0x0E, 0xB4,
-    0x07, 0x9F, 0x47, 0xD3, 0xFF, 0xF0, 0x7F, 0xF8, 0x07, 0xF4, 0x00, 0x24, 0x0E, 0x03, 0x80, 0xE0,
-    0x38, 0x0E, 0x03, 0x80, 0xF0, 0x3C, 0x1F, 0x87, 0xF4, 0x24, 0x60, 0x34, 0xE0, 0x32, 0xC0, 0x77,
-    0x40, 0x7F, 0x00, 0x7D, 0x00, 0xBF, 0x00, 0xB7, 0xC0, 0xB2, 0xF0, 0xF0, 0xFC, 0x00, 0x00, 0x1F,
-    0x80, 0x07, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x0B, 0xF4, 0x03,
-    0xEE, 0x02, 0xD3, 0xC0, 0xE0, 0xF0, 0xB0, 0x2C, 0x34, 0x03, 0x6C, 0x00, 0xE0, 0x3C, 0x00, 0xD3,
-    0xC0, 0x0D, 0x3D, 0x01, 0xE3, 0xD0, 0x1E, 0x3D, 0x01, 0xE3, 0xE0, 0x1E, 0x3F, 0x02, 0xE3, 0xFF,
-    0xFE, 0x3B, 0xFF, 0xE3, 0x2F, 0x8F, 0x30, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x38,
-    0x3C, 0x03, 0x81, 0xD0, 0x38, 0x0F, 0x03, 0x80, 0xB4, 0x74, 0x03, 0xCB, 0x00, 0x2F, 0xF0, 0x01,
-    0xFD, 0x00, 0x1F, 0xC0, 0x2F, 0xFD, 0x00, 0x79, 0x00, 0x34, 0x00, 0x28, 0x00, 0x0B, 0x40, 0x00,
-    0xFE, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x07, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00,
-    0x2E, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x01, 0xFA, 0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C,
-    0x70, 0x01, 0xC7, 0x40, 0x1C, 0x38, 0x02, 0xC3, 0xEA, 0xF8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x0E, 0x0F, 0x00, 0xD0, 0xE0, 0x0D, 0x0E, 0x00, 0xD0, 0xD0, 0x1C, 0x0D,
-    0x01, 0xC1, 0xE0, 0x2C, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0xF8, 0x07, 0x81, 0xD0,
-    0xF0, 0x0E, 0x0F, 0x00, 0xF1, 0xF0, 0x0F, 0x1F, 0x00, 0xE2, 0xFD, 0x6D, 0x3F, 0xFF, 0xC3, 0xCF,
-    0xF0, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x78, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x83, 0x43,
-    0x68, 0x00, 0xA0, 0x02, 0x80, 0x03, 0x40, 0x07, 0x80, 0x0B, 0x40, 0x1D, 0x00, 0x74, 0x00, 0x50,
-    0x06, 0xFF, 0xFC, 0x1F, 0xAF, 0x40, 0x38, 0x03, 0x80, 0x34, 0x02, 0xC0, 0x70, 0x01, 0xC0, 0x74,
-    0x01, 0xC0, 0x38, 0x02, 0xC0, 0x3E, 0xAF, 0x80, 0x1F, 0xFF, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xE0, 0x0D, 0x00, 0x03, 0x40, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x2C, 0x00, 0x0B, 0x40,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA0, 0x34, 0xA0, 0x1C, 0x70, 0x0C, 0x70, 0x0C, 0x70,
-    0x0D, 0x74, 0x0D, 0x3E, 0xBC, 0x3F, 0xFC, 0x0F, 0xE0, 0x00, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0x30, 0x00, 0x01, 0xBF, 0x90, 0x02, 0xFF, 0xFE, 0x02, 0xF4, 0xC7, 0xE0,
-    0xF4, 0x30, 0x7C, 0x7C, 0x0C, 0x0F, 0xAD, 0x03, 0x01, 0xFB, 0x40, 0xC0, 0x3F, 0xC0, 0x70, 0x0F,
-    0xB0, 0x1C, 0x03, 0xEE, 0x07, 0x01, 0xE7, 0xD1, 0xC1, 0xF8, 0xFF, 0xFB, 0xFC, 0x2F, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x60, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00,
-    0x70, 0x3F, 0x80, 0xE0, 0x07, 0xD2, 0xC0, 0x00, 0xF7, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0xBD, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xDF, 0x40, 0x0B, 0x87, 0xD0, 0x1F, 0x03, 0xFD, 0x3D,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x90, 0x00, 0x28, 0x02, 0x8A, 0x28, 0xA1, 0x83,
-    0x1C, 0x60, 0xD7, 0x1C, 0x35, 0xC7, 0x0E, 0x74, 0xC3, 0x8F, 0xFB, 0xD2, 0xFF, 0xF0, 0x2F, 0xE0,
-    0x00, 0xC0, 0x00, 0x30, 0x00, 0x0D, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x70, 0x3C,
-    0x00, 0x38, 0x74, 0x00, 0x2C, 0xB0, 0x30, 0x2C, 0xB0, 0x30, 0x2C, 0x70, 0x34, 0x38, 0x3E, 0xFF,
-    0xF4, 0x1F, 0x8B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF4,
-    0x00, 0x03, 0xCE, 0x00, 0x00, 0xE3, 0xC0, 0x00, 0xB4, 0x74, 0x00, 0x3C, 0x0F, 0x00, 0x1E, 0x03,
-    0xD0, 0x0B, 0x40, 0x78, 0x03, 0xD0, 0x1F, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x7C, 0x00,
-    0x1F, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0, 0xB4, 0x34,
-    0x07, 0x47, 0x00, 0x38, 0x70, 0x03, 0x87, 0x00, 0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC, 0x0B, 0xE6,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x02, 0xE0, 0x00, 0x2A, 0x00, 0x00, 0x2A, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0x38,
-    0x00, 0x03, 0x8F, 0x00, 0x02, 0xD1, 0xD0, 0x00, 0xF0, 0x3C, 0x00, 0x78, 0x0F, 0x40, 0x2D, 0x01,
-    0xE0, 0x0F, 0x40, 0x7C, 0x07, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF1, 0xF0, 0x00, 0x7C, 0xBC, 0x00,
-    0x0F, 0x80, 0x01, 0x90, 0x00, 0x12, 0x40, 0x00, 0x20, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF7, 0x00, 0xFA, 0xF4, 0x3C, 0x0B, 0x43, 0x40, 0x74, 0x70, 0x03, 0x87, 0x00, 0x38,
-    0x70, 0x0B, 0xC3, 0xEB, 0xFC, 0x2F, 0xFF, 0xC0, 0xBE, 0x6C, 0x00, 0x01, 0x00, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x07, 0xB0,
-    0x00, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x3C, 0xE0, 0x00, 0x0E, 0x3C, 0x00, 0x0B, 0x47, 0x40, 0x03, 0xC0,
-    0xF0, 0x01, 0xE0, 0x3D, 0x00, 0xB4, 0x07, 0x80, 0x3D, 0x01, 0xF0, 0x1F, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xFF, 0xC7, 0xC0, 0x01, 0xF2, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x03, 0xB0, 0x00, 0xC1, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x70, 0x0F, 0xAF, 0x43, 0xC0, 0xB4, 0x34, 0x07, 0x47, 0x00, 0x38, 0x70, 0x03, 0x87, 0x00, 0xBC,
-    0x3E, 0xBF, 0xC2, 0xFF, 0xFC, 0x0B, 0xE6, 0xC0, 0x60, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0A,
-    0x47, 0x00, 0x00, 0x01, 0xEC, 0x00, 0x00, 0x60, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3C, 0xE0, 0x00, 0x03,
-    0x8F, 0x00, 0x00, 0xB4, 0x74, 0x00, 0x0F, 0x03, 0xC0, 0x01, 0xE0, 0x3D, 0x00, 0x2D, 0x01, 0xE0,
-    0x03, 0xD0, 0x1F, 0x00, 0x7F, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xC1, 0xF0, 0x00, 0x7C, 0x2F, 0x00,
-    0x03, 0xE0, 0x10, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0xD1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x00, 0xFA, 0xF4, 0x03, 0xC0, 0xB4,
-    0x03, 0x40, 0x74, 0x07, 0x00, 0x38, 0x07, 0x00, 0x38, 0x07, 0x00, 0xBC, 0x03, 0xEB, 0xFC, 0x02,
-    0xFF, 0xFC, 0x00, 0xBE, 0x6C, 0x00, 0x2A, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x1E, 0xC0, 0x00, 0x18, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xF3, 0x80, 0x00,
-    0x38, 0xF0, 0x00, 0x2D, 0x1D, 0x00, 0x0F, 0x03, 0xC0, 0x07, 0x80, 0xF4, 0x02, 0xD0, 0x1E, 0x00,
-    0xF4, 0x07, 0xC0, 0x7F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x1F, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0xF8,
-    0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x40, 0x04, 0x00, 0x00, 0xF0, 0x00, 0x36, 0x80, 0x08,
-    0x06, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0xFA, 0xF4, 0x3C, 0x0B, 0x43, 0x40, 0x74, 0x70, 0x03,
-    0x87, 0x00, 0x38, 0x70, 0x0B, 0xC3, 0xEB, 0xFC, 0x2F, 0xFF, 0xC0, 0xBE, 0x6C, 0x00, 0xA0, 0x50,
-    0x00, 0x33, 0x20, 0x00, 0x18, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x0B, 0x78, 0x00, 0x06, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xF0,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0xF3, 0x80, 0x00, 0x38, 0xF0, 0x00, 0x2D, 0x1D, 0x00, 0x0F, 0x03,
-    0xC0, 0x07, 0x80, 0xF4, 0x02, 0xD0, 0x1E, 0x00, 0xF4, 0x07, 0xC0, 0x7F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0x1F, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0xF8, 0x0B, 0x45, 0x00, 0xCC, 0x90, 0x1C, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x1E, 0x00, 0x07, 0x78, 0x00, 0x80, 0x90, 0x03, 0xF7, 0x00, 0xFA,
-    0xF4, 0x3C, 0x0B, 0x43, 0x40, 0x74, 0x70, 0x03, 0x87, 0x00, 0x38, 0x70, 0x0B, 0xC3, 0xEB, 0xFC,
-    0x2F, 0xFF, 0xC0, 0xBE, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xB0, 0x00, 0x06,
-    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x3C, 0xE0, 0x00, 0x0E, 0x3C, 0x00, 0x0B, 0x47, 0x40, 0x03, 0xC0, 0xF0, 0x01,
-    0xE0, 0x3D, 0x00, 0xB4, 0x07, 0x80, 0x3D, 0x01, 0xF0, 0x1F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xC7,
-    0xC0, 0x01, 0xF2, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x03, 0xF0, 0x00, 0xC1,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0, 0xB4, 0x34, 0x07, 0x47, 0x00, 0x38,
-    0x70, 0x03, 0x87, 0x00, 0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC, 0x0B, 0xE6, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x02, 0xE0, 0x00, 0x2A, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x80, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x09, 0x02, 0x80, 0x01, 0xFA, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xF3, 0x80,
-    0x00, 0x38, 0xF0, 0x00, 0x2D, 0x1D, 0x00, 0x0F, 0x03, 0xC0, 0x07, 0x80, 0xF4, 0x02, 0xD0, 0x1E,
-    0x00, 0xF4, 0x07, 0xC0, 0x7F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x1F, 0x00, 0x07, 0xCB, 0xC0, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xA0, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x60, 0x0F, 0xAD, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF7, 0x00, 0xFA, 0xF4, 0x3C, 0x0B, 0x43, 0x40, 0x74, 0x70, 0x03, 0x87, 0x00, 0x38, 0x70, 0x0B,
-    0xC3, 0xEB, 0xFC, 0x2F, 0xFF, 0xC0, 0xBE, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x0A, 0x00, 0x07,
-    0xEB, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xCE, 0x00, 0x00, 0xE3, 0xC0, 0x00,
-    0xB4, 0x74, 0x00, 0x3C, 0x0F, 0x00, 0x1E, 0x03, 0xD0, 0x0B, 0x40, 0x78, 0x03, 0xD0, 0x1F, 0x01,
-    0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x1F, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x02, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x06, 0x00, 0xFA,
-    0xD0, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0, 0xB4,
-    0x34, 0x07, 0x47, 0x00, 0x38, 0x70, 0x03, 0x87, 0x00, 0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC, 0x0B,
-    0xE6, 0xC0, 0x00, 0x19, 0x00, 0x00, 0x04, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x02, 0x80, 0x01, 0xFA, 0xC0, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x03, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xF3, 0x80, 0x00, 0x38, 0xF0, 0x00, 0x2D, 0x1D, 0x00,
-    0x0F, 0x03, 0xC0, 0x07, 0x80, 0xF4, 0x02, 0xD0, 0x1E, 0x00, 0xF4, 0x07, 0xC0, 0x7F, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0x1F, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0xF8, 0x07, 0xF8, 0x00, 0x01, 0xC0, 0x00,
-    0x38, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x06,
-    0x00, 0xFA, 0xD0, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0xFA, 0xF4, 0x3C, 0x0B, 0x43,
-    0x40, 0x74, 0x70, 0x03, 0x87, 0x00, 0x38, 0x70, 0x0B, 0xC3, 0xEB, 0xFC, 0x2F, 0xFF, 0xC0, 0xBE,
-    0x6C, 0x00, 0xA0, 0x40, 0x00, 0x73, 0x20, 0x00, 0x18, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x28, 0x0A, 0x00, 0x07, 0xAB, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07,
-    0xF4, 0x00, 0x03, 0xCE, 0x00, 0x00, 0xE3, 0xC0, 0x00, 0xB4, 0x74, 0x00, 0x3C, 0x0F, 0x00, 0x1E,
-    0x03, 0xD0, 0x0B, 0x40, 0x78, 0x03, 0xD0, 0x1F, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x7C,
-    0x00, 0x1F, 0x2F, 0x00, 0x03, 0xE0, 0x0B, 0x41, 0x00, 0xCC, 0x90, 0x18, 0x3C, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x28, 0x06, 0x00, 0xEA, 0xD0, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0, 0xB4, 0x34, 0x07, 0x47, 0x00, 0x38, 0x70, 0x03,
-    0x87, 0x00, 0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC, 0x0B, 0xE6, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x28, 0x00, 0x1F, 0xAC, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0x38, 0x00, 0x03,
-    0x8F, 0x00, 0x02, 0xD1, 0xD0, 0x00, 0xF0, 0x3C, 0x00, 0x78, 0x0F, 0x40, 0x2D, 0x01, 0xE0, 0x0F,
-    0x40, 0x7C, 0x07, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF1, 0xF0, 0x00, 0x7C, 0xBC, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x60, 0x0F, 0xAD, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF7, 0x00, 0xFA, 0xF4, 0x3C, 0x0B, 0x43, 0x40, 0x74, 0x70, 0x03, 0x87, 0x00, 0x38, 0x70, 0x0B,
-    0xC3, 0xEB, 0xFC, 0x2F, 0xFF, 0xC0, 0xBE, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x2E, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4,
-    0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0, 0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00,
-    0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x1F, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0xF4, 0x70, 0x28, 0x02, 0x83, 0x9A, 0xFC, 0x7F,
-    0xEA, 0x87, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF4, 0x18, 0x0F, 0xFF, 0xC0, 0x2F, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0xA4, 0x00, 0x01, 0xA4, 0x00, 0x02, 0x80,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC7, 0xFF, 0xE4, 0x74,
-    0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xBF, 0xFC, 0x0B, 0xFF, 0xC0, 0xB4, 0x00,
-    0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x01, 0xA4, 0x00,
-    0x01, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x0F, 0x47, 0x02, 0x80, 0x28, 0x39, 0xAF, 0xC7, 0xFE, 0xA8, 0x70, 0x00, 0x03, 0x80, 0x00,
-    0x3F, 0x41, 0x80, 0xFF, 0xFC, 0x02, 0xFE, 0x40, 0x07, 0x82, 0x00, 0xC9, 0x60, 0x0C, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40,
-    0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0, 0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00,
-    0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x07, 0x83, 0x00, 0xCA, 0x20, 0x0C, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xF4, 0x70, 0x28, 0x02, 0x83, 0x9A,
-    0xFC, 0x7F, 0xEA, 0x87, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF4, 0x18, 0x0F, 0xFF, 0xC0, 0x2F, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0xC0, 0x00, 0x2C, 0x00, 0xD0, 0x00, 0x2F, 0x40, 0x09,
-    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4, 0x00,
-    0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0, 0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B,
-    0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x24, 0x02, 0x40, 0xC0,
-    0x2F, 0x0B, 0x01, 0x87, 0x10, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x0F, 0x47, 0x00, 0xA0, 0x0A, 0x03, 0x9A, 0xFC, 0x1F, 0xFA, 0xA0, 0x70, 0x00, 0x00, 0xE0, 0x00,
-    0x03, 0xF4, 0x18, 0x03, 0xFF, 0xF0, 0x02, 0xFE, 0x40, 0x2D, 0x00, 0x00, 0x00, 0xB8, 0x0D, 0x00,
-    0x00, 0x52, 0xF4, 0x00, 0x00, 0x90, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x00, 0x74, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x10,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x07, 0x89, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x61, 0xC0, 0x00, 0x40,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xF4, 0x70, 0x02, 0x80, 0x28,
-    0x03, 0x9A, 0xFC, 0x07, 0xFE, 0xA8, 0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0xF4, 0x18, 0x00,
-    0xFF, 0xFC, 0x00, 0x2F, 0xE4, 0x00, 0x06, 0x90, 0x00, 0x06, 0x00, 0x00, 0x80, 0x0D, 0x00, 0x02,
-    0xF4, 0x00, 0x90, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC7, 0xFF, 0xE4, 0x74, 0x00,
-    0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xBF, 0xFC, 0x0B, 0xFF, 0xC0, 0xB4, 0x00, 0x0B,
-    0x40, 0x00, 0xB4, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0x0A, 0x80, 0x00,
-    0x0C, 0x00, 0x02, 0x00, 0x0B, 0x00, 0x01, 0xF8, 0x00, 0x60, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0x47, 0x02, 0x80, 0x28, 0x39, 0xAF, 0xC7, 0xFE, 0xA8, 0x70,
-    0x00, 0x03, 0x80, 0x00, 0x3F, 0x41, 0x80, 0xFF, 0xFC, 0x02, 0xFE, 0x40, 0x07, 0x42, 0x00, 0xC9,
-    0x20, 0x0C, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0F, 0x00, 0x03, 0x6C, 0x00, 0x80, 0x60,
-    0x00, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4,
-    0x00, 0x0B, 0xFF, 0xC0, 0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x07, 0x83, 0x00, 0xCA, 0x20, 0x0C, 0x2D, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x1F, 0x40, 0x06, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x0F,
-    0x47, 0x02, 0x80, 0x28, 0x39, 0xAF, 0xC7, 0xFE, 0xA8, 0x70, 0x00, 0x03, 0x80, 0x00, 0x3F, 0x41,
-    0x80, 0xFF, 0xFC, 0x02, 0xFE, 0x40, 0x00, 0xD0, 0x00, 0x2F, 0x40, 0x09, 0x0D, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4,
-    0x00, 0x0B, 0xFF, 0xC0, 0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x90, 0x00, 0x1F, 0x00, 0x06, 0x1C, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0xF4, 0x70, 0x28, 0x02, 0x83, 0x9A, 0xFC, 0x7F, 0xEA, 0x87, 0x00, 0x00, 0x38, 0x00,
-    0x03, 0xF4, 0x18, 0x0F, 0xFF, 0xC0, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x0F, 0x40, 0x00, 0xA4, 0x00, 0xA8, 0x0C, 0x20, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0xBC, 0xBC, 0xBD, 0x69, 0x09, 0x14, 0x00, 0x00, 0x00,
-    0x34, 0x34, 0x34, 0x34, 0x34, 0x38, 0x38, 0x38, 0x7C, 0x00, 0xBC, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0xBC, 0xBC, 0xBD, 0x00, 0x24, 0x7C, 0xBC, 0x28, 0x7C, 0x7C, 0x00,
-    0x00, 0x10, 0x34, 0x34, 0x34, 0x34, 0x34, 0x38, 0x38, 0x38, 0x7C, 0x00, 0x64, 0xB8, 0xF8, 0x01,
-    0xBF, 0x90, 0x02, 0xFA, 0xBE, 0x02, 0xF4, 0x07, 0xF0, 0xF4, 0x00, 0x7D, 0x7C, 0x00, 0x0F, 0xAD,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xED, 0x00, 0x01, 0xEB,
-    0xD0, 0x00, 0xF8, 0xFF, 0xAB, 0xFC, 0x2F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x1B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xFC, 0x00,
-    0x06, 0xF8, 0x01, 0xFA, 0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C, 0x70, 0x01, 0xC7, 0x40, 0x1C, 0x38,
-    0x02, 0xC3, 0xEA, 0xF8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x19, 0x00, 0x00, 0x04, 0x90, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x2F, 0xAB, 0xE0,
-    0x2F, 0x40, 0x7F, 0x0F, 0x40, 0x07, 0xD7, 0xC0, 0x00, 0xFA, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3E, 0xD0, 0x00, 0x1E, 0xBD, 0x00, 0x0F, 0x8F, 0xFA, 0xBF,
-    0xC2, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xF0, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4,
-    0x00, 0x02, 0x80, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0x80, 0x1F, 0xAF, 0x03, 0x80, 0x38, 0x34, 0x02, 0xC7, 0x00, 0x1C, 0x74, 0x01, 0xC3, 0x80,
-    0x2C, 0x3E, 0xAF, 0x81, 0xFF, 0xF0, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00,
-    0x00, 0x00, 0x7B, 0x40, 0x00, 0x01, 0x80, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90,
-    0x00, 0x0B, 0xEA, 0xF8, 0x0A, 0x2F, 0x40, 0x7F, 0x0D, 0x3D, 0x00, 0x1F, 0x6C, 0x7C, 0x00, 0x0F,
-    0x80, 0xB4, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x03,
-    0xC0, 0xB4, 0x00, 0x07, 0x80, 0xBD, 0x00, 0x0F, 0x80, 0x3F, 0xEA, 0xFF, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x02, 0x40, 0x60, 0x2F, 0x03, 0x42, 0x87, 0x1C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBE, 0x00, 0x1F, 0xAF, 0x00, 0xE0, 0x0E, 0x03, 0x40, 0x2C, 0x1C, 0x00, 0x70, 0x74, 0x01,
-    0xC0, 0xE0, 0x0B, 0x03, 0xEA, 0xF8, 0x07, 0xFF, 0xC0, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x00, 0x00, 0x0F, 0x07, 0x40, 0x00, 0x01, 0xED, 0x00, 0x00, 0x60, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xAB, 0xE0, 0x0B, 0xD0, 0x1F, 0xC0, 0xF4, 0x00, 0x7D, 0x1F,
-    0x00, 0x03, 0xE2, 0xD0, 0x00, 0x1F, 0x3D, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x0F, 0x3D, 0x00, 0x00,
-    0xF2, 0xD0, 0x00, 0x1E, 0x2F, 0x40, 0x03, 0xE0, 0xFF, 0xAB, 0xFC, 0x0B, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xF0, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07,
-    0x8D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xA0, 0xC0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0x80, 0x01, 0xFA, 0xF0, 0x03, 0x80, 0x38, 0x03, 0x40, 0x2C, 0x07, 0x00, 0x1C,
-    0x07, 0x40, 0x1C, 0x03, 0x80, 0x2C, 0x03, 0xEA, 0xF8, 0x01, 0xFF, 0xF0, 0x00, 0x6F, 0x80, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x02, 0x40, 0x00, 0x01, 0x40, 0x00, 0x74, 0x00, 0x00, 0x7B, 0x40, 0x00,
-    0x60, 0x24, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x0B, 0xEA, 0xF8, 0x0B, 0xD0, 0x1F, 0xC3,
-    0xD0, 0x01, 0xF5, 0xF0, 0x00, 0x3E, 0xB4, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x0F, 0xB4, 0x00, 0x07, 0xAF, 0x40, 0x03, 0xE3, 0xFE, 0xAF, 0xF0, 0xBF, 0xFF, 0xFC,
-    0x0B, 0xFF, 0xFC, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x0C, 0x00,
-    0x02, 0x80, 0x01, 0x10, 0x00, 0xF0, 0x00, 0x3A, 0xC0, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xF8, 0x01, 0xFA, 0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C, 0x70, 0x01, 0xC7,
-    0x40, 0x1C, 0x38, 0x02, 0xC3, 0xEA, 0xF8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x00, 0x74, 0x50, 0x00,
-    0x33, 0x54, 0x00, 0x0C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x07, 0x2C, 0x00, 0x01, 0x00, 0x40, 0x01, 0xBF, 0x90, 0x02, 0xFA, 0xBE, 0x02, 0xF4, 0x07, 0xF0,
-    0xF4, 0x00, 0x7D, 0x7C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
-    0xF4, 0x00, 0x03, 0xED, 0x00, 0x01, 0xEB, 0xD0, 0x00, 0xF8, 0xFF, 0xAB, 0xFC, 0x2F, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0x42, 0x00, 0xC9, 0x20, 0x0C,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0F, 0x00, 0x03, 0x6C, 0x00, 0x80, 0x60, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xF8, 0x01, 0xFA, 0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C, 0x70, 0x01, 0xC7,
-    0x40, 0x1C, 0x38, 0x02, 0xC3, 0xEA, 0xF8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x07, 0xB4, 0x00, 0x06, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00,
-    0xBE, 0xAF, 0x80, 0xBD, 0x01, 0xFC, 0x3D, 0x00, 0x1F, 0x5F, 0x00, 0x03, 0xEB, 0x40, 0x00, 0x7F,
-    0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFB, 0x40, 0x00, 0x7A, 0xF4, 0x00, 0x3E,
-    0x3F, 0xEA, 0xFF, 0x0B, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xC0, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x2F, 0x00, 0x0A, 0x0C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x01,
-    0xFA, 0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C, 0x70, 0x01, 0xC7, 0x40, 0x1C, 0x38, 0x02, 0xC3, 0xEA,
-    0xF8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x1F, 0x00,
-    0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1B, 0xFD, 0x07, 0x0B,
-    0xEA, 0xFC, 0xA2, 0xF4, 0x07, 0xFC, 0x3D, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0xF8, 0xB4, 0x00, 0x07,
-    0xCF, 0x40, 0x00, 0x3C, 0xF0, 0x00, 0x03, 0xCF, 0x40, 0x00, 0x3C, 0xB4, 0x00, 0x07, 0x8B, 0xD0,
-    0x00, 0xF8, 0x3F, 0xEA, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0xF8, 0x20, 0x7E, 0xBD, 0xC3,
-    0x80, 0x3D, 0x0D, 0x00, 0xB0, 0x70, 0x01, 0xC1, 0xD0, 0x07, 0x03, 0x80, 0x2C, 0x0F, 0xAB, 0xE0,
-    0x1F, 0xFF, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0xBF, 0xD0, 0x70, 0xBE,
-    0xAF, 0xCA, 0x2F, 0x40, 0x7F, 0xC3, 0xD0, 0x01, 0xF4, 0x7C, 0x00, 0x0F, 0x8B, 0x40, 0x00, 0x7C,
-    0xF4, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x3C, 0xF4, 0x00, 0x03, 0xCB, 0x40, 0x00, 0x78, 0xBD, 0x00,
-    0x0F, 0x83, 0xFE, 0xAF, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xC0, 0x01, 0xBF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x6F, 0x82, 0x07, 0xEB, 0xDC, 0x38, 0x03, 0xD0, 0xD0, 0x0B, 0x07, 0x00,
-    0x1C, 0x1D, 0x00, 0x70, 0x38, 0x02, 0xC0, 0xFA, 0xBE, 0x01, 0xFF, 0xF0, 0x01, 0xBE, 0x00, 0x00,
-    0x1A, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x01, 0xBF, 0xD0, 0x70, 0xBE, 0xAF, 0xCA, 0x2F, 0x40, 0x7F, 0xC3, 0xD0,
-    0x01, 0xF4, 0x7C, 0x00, 0x0F, 0x8B, 0x40, 0x00, 0x7C, 0xF4, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x3C,
-    0xF4, 0x00, 0x03, 0xCB, 0x40, 0x00, 0x78, 0xBD, 0x00, 0x0F, 0x83, 0xFE, 0xAF, 0xF0, 0x2F, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0xC0, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00,
-    0xA0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0xBE, 0x08, 0x1F, 0xAF, 0x70, 0xE0, 0x0F, 0x43, 0x40, 0x2C, 0x1C, 0x00, 0x70, 0x74, 0x01, 0xC0,
-    0xE0, 0x0B, 0x03, 0xEA, 0xF8, 0x07, 0xFF, 0xC0, 0x06, 0xF8, 0x00, 0x00, 0xB4, 0x60, 0x00, 0x0C,
-    0x95, 0x00, 0x00, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1B, 0xFD, 0x07,
-    0x0B, 0xEA, 0xFC, 0xA2, 0xF4, 0x07, 0xFC, 0x3D, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0xF8, 0xB4, 0x00,
-    0x07, 0xCF, 0x40, 0x00, 0x3C, 0xF0, 0x00, 0x03, 0xCF, 0x40, 0x00, 0x3C, 0xB4, 0x00, 0x07, 0x8B,
-    0xD0, 0x00, 0xF8, 0x3F, 0xEA, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFC, 0x00, 0x1B, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x82, 0x00, 0x32, 0x58, 0x00, 0xC2, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6F, 0x82, 0x07, 0xEB, 0xDC, 0x38, 0x03, 0xD0, 0xD0, 0x0B,
-    0x07, 0x00, 0x1C, 0x1D, 0x00, 0x70, 0x38, 0x02, 0xC0, 0xFA, 0xBE, 0x01, 0xFF, 0xF0, 0x01, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x1B, 0xFD, 0x07, 0x0B, 0xEA, 0xFC, 0xA2, 0xF4, 0x07, 0xFC, 0x3D,
-    0x00, 0x1F, 0x47, 0xC0, 0x00, 0xF8, 0xB4, 0x00, 0x07, 0xCF, 0x40, 0x00, 0x3C, 0xF0, 0x00, 0x03,
-    0xCF, 0x40, 0x00, 0x3C, 0xB4, 0x00, 0x07, 0x8B, 0xD0, 0x00, 0xF8, 0x3F, 0xEA, 0xFF, 0x02, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1B, 0xE0,
-    0x81, 0xFA, 0xF7, 0x0E, 0x00, 0xF4, 0x34, 0x02, 0xC1, 0xC0, 0x07, 0x07, 0x40, 0x1C, 0x0E, 0x00,
-    0xB0, 0x3E, 0xAF, 0x80, 0x7F, 0xFC, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D,
-    0xFC, 0x00, 0x7D, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8,
-    0x00, 0x3C, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xA8, 0x00, 0x70, 0x03, 0x5C, 0x00, 0xD7, 0x40, 0x79, 0xD0, 0x1E, 0x34, 0x07, 0x8E, 0x01,
-    0xE3, 0xC0, 0xB8, 0xFF, 0xFE, 0x2F, 0xFF, 0x82, 0xF8, 0xF0, 0x00, 0x00, 0x06, 0x40, 0x02, 0xE0,
-    0x00, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xFC, 0x00,
-    0x7D, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C,
-    0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x00, 0x35, 0xC0, 0x0D, 0x74, 0x07, 0x9D, 0x01, 0xE3, 0x40, 0x78, 0xE0, 0x1E,
-    0x3C, 0x0B, 0x8F, 0xFF, 0xE2, 0xFF, 0xF8, 0x2F, 0x8F, 0x00, 0x0D, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x2F,
-    0xF0, 0x01, 0xFD, 0xFC, 0x00, 0x7D, 0x3F, 0x00, 0x1F, 0x4B, 0x80, 0x07, 0xC2, 0xE0, 0x01, 0xF0,
-    0xB8, 0x00, 0x3C, 0x2E, 0x00, 0x0F, 0x0B, 0x80, 0x03, 0xC2, 0xE0, 0x00, 0xF0, 0x7C, 0x00, 0x7C,
-    0x1F, 0x80, 0x7F, 0x03, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x1C, 0x00, 0xDC, 0x70, 0x03, 0xE1, 0xD0, 0x1F, 0x07, 0x40, 0x78, 0x0D,
-    0x01, 0xE0, 0x38, 0x07, 0x80, 0xF0, 0x2E, 0x03, 0xFF, 0xF8, 0x0B, 0xFF, 0xE0, 0x0B, 0xE3, 0xC0,
-    0x01, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xF7, 0xF0, 0x01, 0xF4, 0xFC, 0x00, 0x7D, 0x2E, 0x00, 0x1F,
-    0x0B, 0x80, 0x07, 0xC2, 0xE0, 0x00, 0xF0, 0xB8, 0x00, 0x3C, 0x2E, 0x00, 0x0F, 0x0B, 0x80, 0x03,
-    0xC1, 0xF0, 0x01, 0xF0, 0x7E, 0x01, 0xFC, 0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x40, 0x2F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x21, 0xC0, 0x0D, 0xC7, 0x00, 0x3E, 0x1D, 0x01, 0xF0, 0x74, 0x07, 0x80, 0xD0, 0x1E,
-    0x03, 0x80, 0x78, 0x0F, 0x02, 0xE0, 0x3F, 0xFF, 0x80, 0xBF, 0xFE, 0x00, 0xBE, 0x3C, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0xFD, 0xFC, 0x00, 0x7D, 0x3F, 0x00, 0x1F, 0x4B,
-    0x80, 0x07, 0xC2, 0xE0, 0x01, 0xF0, 0xB8, 0x00, 0x3C, 0x2E, 0x00, 0x0F, 0x0B, 0x80, 0x03, 0xC2,
-    0xE0, 0x00, 0xF0, 0x7C, 0x00, 0x7C, 0x1F, 0x80, 0x7F, 0x03, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xD0,
-    0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0xC0, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x00, 0x37, 0x1C, 0x00, 0xF8, 0x74, 0x07, 0xC1,
-    0xD0, 0x1E, 0x03, 0x40, 0x78, 0x0E, 0x01, 0xE0, 0x3C, 0x0B, 0x80, 0xFF, 0xFE, 0x02, 0xFF, 0xF8,
-    0x02, 0xF8, 0xF0, 0x01, 0xD0, 0x80, 0x00, 0xCD, 0x60, 0x00, 0x30, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xF7, 0xF0, 0x01, 0xF4, 0xFC, 0x00, 0x7D,
-    0x2E, 0x00, 0x1F, 0x0B, 0x80, 0x07, 0xC2, 0xE0, 0x00, 0xF0, 0xB8, 0x00, 0x3C, 0x2E, 0x00, 0x0F,
-    0x0B, 0x80, 0x03, 0xC1, 0xF0, 0x01, 0xF0, 0x7E, 0x01, 0xFC, 0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-    0x40, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x09, 0x00, 0x63, 0x20, 0x01, 0x47, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xC0, 0x0D, 0xC7, 0x00, 0x3E, 0x1D, 0x01, 0xF0, 0x74, 0x07,
-    0x80, 0xD0, 0x1E, 0x03, 0x80, 0x78, 0x0F, 0x02, 0xE0, 0x3F, 0xFF, 0x80, 0xBF, 0xFE, 0x00, 0xBE,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0xFD, 0xFC,
-    0x00, 0x7D, 0x3F, 0x00, 0x1F, 0x4B, 0x80, 0x07, 0xC2, 0xE0, 0x01, 0xF0, 0xB8, 0x00, 0x3C, 0x2E,
-    0x00, 0x0F, 0x0B, 0x80, 0x03, 0xC2, 0xE0, 0x00, 0xF0, 0x7C, 0x00, 0x7C, 0x1F, 0x80, 0x7F, 0x03,
-    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x21, 0xC0, 0x0D, 0xC7,
-    0x00, 0x3E, 0x1D, 0x01, 0xF0, 0x74, 0x07, 0x80, 0xD0, 0x1E, 0x03, 0x80, 0x78, 0x0F, 0x02, 0xE0,
-    0x3F, 0xFF, 0x80, 0xBF, 0xFE, 0x00, 0xBE, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x0B, 0x80,
-    0x00, 0x3E, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x3D, 0x3C, 0x00, 0x7C, 0x2E, 0x00, 0xF4, 0x0F, 0x01, 0xF0, 0x0B,
-    0xC3, 0xD0, 0x03, 0xDB, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x05, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0xD3, 0xC0,
-    0x2C, 0x1E, 0x03, 0xC0, 0xF0, 0x38, 0x07, 0x8B, 0x40, 0x3C, 0xF0, 0x01, 0xFF, 0x00, 0x0F, 0xE0,
-    0x00, 0x7E, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x3F, 0xF0, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x3D, 0x3C, 0x00, 0x7C, 0x2E, 0x00, 0xF4, 0x0F, 0x01, 0xF0, 0x0B, 0xC3,
-    0xD0, 0x03, 0xDB, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF8,
-    0x00, 0x34, 0x01, 0xD0, 0x3C, 0x02, 0xC0, 0x1E, 0x03, 0xC0, 0x0F, 0x03, 0x80, 0x07, 0x8B, 0x40,
-    0x03, 0xCF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x7C, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0xF0, 0x28, 0x3F, 0x80, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x14,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x3D, 0x3C, 0x00, 0x7C, 0x2E, 0x00, 0xF4, 0x0F, 0x01, 0xF0, 0x0B,
-    0xC3, 0xD0, 0x03, 0xDB, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0xC0, 0x00, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x34, 0x01, 0xD3, 0xC0, 0x2C, 0x1E, 0x03, 0xC0, 0xF0, 0x38, 0x07, 0x8B, 0x40, 0x3C, 0xF0,
-    0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x3F,
-    0xF0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x80, 0x03, 0x25, 0x80, 0x03, 0x0B, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x3D, 0x3C, 0x00, 0x7C, 0x2E,
-    0x00, 0xF4, 0x0F, 0x01, 0xF0, 0x0B, 0xC3, 0xD0, 0x03, 0xDB, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFF,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x01, 0xFC, 0x00, 0x03, 0x82, 0x00, 0x96, 0x30, 0x09, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x1D, 0x3C, 0x02, 0xC1, 0xE0, 0x3C, 0x0F, 0x03, 0x80, 0x78,
-    0xB4, 0x03, 0xCF, 0x00, 0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x07, 0xE0, 0x00, 0x7D, 0x00, 0x07, 0xC0,
-    0x01, 0xF8, 0x03, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x6A, 0xA9, 0xBF, 0xFE, 0x6A, 0xA9,
-    0xBF, 0xFE, 0x6A, 0xAA, 0xA9, 0xBF, 0xFF, 0xFD, 0x6A, 0xAA, 0xA6, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA,
-    0xAA, 0xA9, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x19, 0xC0, 0x67, 0x01,
-    0x9C, 0x0A, 0x70, 0x29, 0xC0, 0xA6, 0x02, 0x98, 0x0A, 0x60, 0x26, 0x80, 0x9A, 0x02, 0x68, 0x0D,
-    0xA0, 0x36, 0x80, 0xD0, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x1A, 0xAA, 0xAA, 0x80, 0x14, 0x0F, 0xC2, 0xF0, 0x7C, 0x0F,
-    0x42, 0x90, 0x05, 0x07, 0xD1, 0xF0, 0x7C, 0x3E, 0x0A, 0x40, 0x05, 0x07, 0xD1, 0xF0, 0xBC, 0x3E,
-    0x0A, 0x40, 0x14, 0x0F, 0xC2, 0xF0, 0x7C, 0x0F, 0x42, 0x90, 0x14, 0x14, 0x0F, 0xCF, 0x82, 0xF3,
-    0xF0, 0x7C, 0xBC, 0x0F, 0x5F, 0x02, 0x92, 0x90, 0x05, 0x05, 0x07, 0xD7, 0xD1, 0xF1, 0xF0, 0x7C,
-    0xBC, 0x3E, 0x3E, 0x0A, 0x4A, 0x40, 0x05, 0x07, 0xD1, 0xF0, 0xBC, 0x3E, 0x0A, 0x40, 0x3F, 0x3F,
-    0x0B, 0xCB, 0xC1, 0xF1, 0xF0, 0x3D, 0x3D, 0x0A, 0x4A, 0x40, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C,
-    0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x0D, 0x50, 0xFF, 0xFF, 0x15, 0xD0, 0x00, 0x34,
-    0x00, 0x0D, 0x00, 0x03, 0x40, 0x00, 0xD0, 0x00, 0x34, 0x00, 0x0D, 0x00, 0x03, 0x40, 0x00, 0xD0,
-    0x00, 0x34, 0x00, 0x0D, 0x00, 0x02, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x0D,
-    0x00, 0x00, 0xD0, 0x00, 0x0D, 0x00, 0x00, 0xD0, 0x00, 0x0D, 0x00, 0x00, 0xE5, 0x43, 0xFF, 0xFC,
-    0x14, 0xD0, 0x00, 0x0D, 0x00, 0x00, 0xD0, 0x00, 0x0D, 0x00, 0x00, 0xD0, 0x00, 0x5E, 0x50, 0x2F,
-    0xFF, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0A, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x2F, 0xFF, 0x00, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xD0, 0x7F, 0xFF, 0x42, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0xC0, 0x00,
-    0x28, 0x0B, 0xE2, 0xF8, 0xA0, 0x00, 0x00, 0x18, 0x3D, 0x3E, 0x18, 0x3D, 0x3E, 0x18, 0x02, 0x80,
-    0x24, 0xF4, 0x0F, 0x01, 0xE3, 0xE0, 0x3D, 0x0B, 0xC0, 0x62, 0xC0, 0x00, 0x00, 0x50, 0x50, 0x03,
-    0x04, 0x50, 0x28, 0x25, 0x40, 0xC0, 0x59, 0x0A, 0x00, 0xF0, 0x70, 0x00, 0x03, 0x40, 0x00, 0x2C,
-    0x00, 0x00, 0xD0, 0x00, 0x0B, 0x00, 0x00, 0x71, 0x45, 0x03, 0x85, 0x54, 0x1C, 0x25, 0xA0, 0xE0,
-    0xA2, 0x80, 0x00, 0x00, 0x00, 0x05, 0x07, 0xD1, 0xF0, 0x7C, 0x3E, 0x0A, 0x40, 0x05, 0x05, 0x07,
-    0xD7, 0xD1, 0xF1, 0xF0, 0x7C, 0xBC, 0x3E, 0x3E, 0x0A, 0x4A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x38, 0x28, 0x0B, 0x07, 0x43, 0x81, 0xD0, 0xE0, 0xF0, 0x28, 0x18, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x01, 0xD0, 0x2C, 0x03, 0x40, 0x00, 0x00, 0x00, 0x30, 0xA0, 0x3C, 0xB0, 0x1D, 0x3C,
-    0x06, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x81, 0xC0, 0xD0, 0x2D, 0x1D, 0x0F, 0x00, 0xB0,
-    0xB0, 0x34, 0x03, 0x42, 0x41, 0xC0, 0x00, 0x00, 0x00, 0x03, 0x40, 0x37, 0x43, 0x87, 0x40, 0x00,
-    0x41, 0xD1, 0xD1, 0xD0, 0x7C, 0x07, 0xC0, 0x74, 0x04, 0x40, 0x2C, 0x02, 0xD0, 0x1D, 0x0F, 0x4F,
-    0x47, 0x40, 0x40, 0x00, 0x00, 0x60, 0x00, 0x00, 0xBC, 0x0F, 0x41, 0xF0, 0x03, 0xE0, 0xF8, 0x7C,
-    0x00, 0x0F, 0x80, 0x1F, 0x40, 0x00, 0x7E, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x18, 0x0B,
-    0xFF, 0x00, 0x03, 0xD0, 0x3F, 0xC0, 0x78, 0x3E, 0x03, 0xFC, 0x0B, 0x80, 0x00, 0xFF, 0xF0, 0xA8,
-    0x00, 0x2F, 0xAF, 0xC0, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0xBF, 0x40,
-    0x0F, 0xE0, 0x2F, 0xE0, 0xF0, 0x7F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00,
-    0x01, 0x01, 0xC0, 0xB0, 0x2C, 0x0B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x05,
-    0x01, 0x43, 0xF0, 0xFC, 0x3F, 0x00, 0x00, 0x10, 0x00, 0x0B, 0x00, 0x0B, 0xF8, 0x03, 0xEF, 0xF0,
-    0x20, 0xFB, 0x80, 0x0F, 0x3C, 0x00, 0xF3, 0xC0, 0x0F, 0x3C, 0x00, 0xF3, 0x80, 0x0F, 0xF0, 0x00,
-    0xFD, 0x00, 0x2F, 0x80, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x29, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x6A, 0xA9, 0xBF, 0xFE, 0x00,
-    0x02, 0x80, 0x73, 0x9B, 0x47, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x66, 0x90, 0x00, 0x3C,
-    0x00, 0x03, 0x69, 0x00, 0x00, 0x80, 0x00, 0x50, 0x08, 0x5A, 0x66, 0xB8, 0x0F, 0x02, 0xE0, 0xEB,
-    0x62, 0x20, 0x50, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0xC0, 0x00,
-    0x30, 0x00, 0x0A, 0x00, 0x00, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xD0, 0x00, 0x2C, 0x00,
-    0x07, 0x40, 0x00, 0xE0, 0x00, 0x2C, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x07, 0xF9, 0x03, 0xEB, 0xF0, 0xBA, 0xBD, 0x08, 0x02, 0xE2, 0x40, 0x7C, 0x00, 0x03, 0xC0,
-    0x00, 0xB4, 0x00, 0x0F, 0x00, 0x01, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0x00, 0x01, 0xE0, 0x00, 0x3C,
-    0x00, 0x0F, 0x00, 0x02, 0xD0, 0x01, 0xF4, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0xB8,
-    0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x01, 0xF0, 0x00, 0x14, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0x80, 0x01, 0xF0, 0x00,
-    0x2A, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xEB, 0xF0, 0x14, 0x80,
-    0x2E, 0x0E, 0x00, 0x03, 0xC3, 0x80, 0x00, 0xF0, 0xE0, 0x00, 0x3C, 0x38, 0x00, 0x1E, 0x0E, 0x00,
-    0x0F, 0x07, 0x80, 0x1F, 0x41, 0xE0, 0x2F, 0x80, 0x78, 0x0B, 0x80, 0x1E, 0x02, 0xE0, 0x0B, 0x80,
-    0xB8, 0x02, 0xE0, 0x28, 0x00, 0x14, 0x00, 0x00, 0x14, 0x01, 0x90, 0x0F, 0x40, 0xB8, 0x07, 0xD0,
-    0x3E, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xEB, 0xE0, 0x09, 0x80, 0x3D,
-    0x07, 0x00, 0x07, 0x82, 0xC0, 0x00, 0xE0, 0xB0, 0x00, 0x78, 0x2C, 0x00, 0x2C, 0x0F, 0x00, 0x1E,
-    0x03, 0xC0, 0x1F, 0x00, 0xF0, 0x3F, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x03, 0xC0, 0x03, 0xC0, 0xF0,
-    0x00, 0xF0, 0x24, 0x00, 0x04, 0x00, 0x00, 0x05, 0x02, 0x80, 0x0F, 0xC0, 0xF0, 0x03, 0xF0, 0x3D,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0D, 0x00, 0x01, 0xC0, 0x00, 0x28, 0x00, 0x03,
-    0x40, 0x00, 0x70, 0x0B, 0x4B, 0x00, 0xF4, 0xE0, 0x0A, 0x4D, 0x00, 0x01, 0xC0, 0x00, 0x3C, 0x00,
-    0x03, 0x80, 0x00, 0x70, 0x00, 0x0B, 0x00, 0x00, 0xE0, 0x00, 0x1D, 0x78, 0x02, 0xCB, 0xC0, 0x3C,
-    0xA8, 0x03, 0x80, 0x00, 0x74, 0x00, 0x0F, 0x00, 0x00, 0xE0, 0x00, 0x1D, 0x00, 0x02, 0xC0, 0x00,
-    0x34, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x41, 0x45, 0x62, 0x72, 0x8F, 0xC0, 0x40, 0x00, 0x01,
-    0x80, 0xA0, 0x8C, 0x7F, 0x80, 0xC0, 0x2A, 0x08, 0x02, 0x00, 0xA8, 0x02, 0x8F, 0xD0, 0x00, 0x06,
-    0x08, 0x02, 0x91, 0xC6, 0x31, 0x8B, 0xC0, 0x00, 0x2A, 0x40, 0x20, 0x18, 0x0D, 0x03, 0x01, 0xC0,
-    0x60, 0x04, 0x08, 0x53, 0x14, 0x7C, 0x30, 0x9C, 0x71, 0xA0, 0x05, 0x08, 0x95, 0x08, 0xC7, 0x1E,
-    0xC0, 0x63, 0xF0, 0x00, 0x10, 0x03, 0xFF, 0xD0, 0x3E, 0x0B, 0x03, 0xC0, 0x34, 0x3C, 0x03, 0x83,
-    0xC0, 0x38, 0x3C, 0x03, 0xC7, 0xC0, 0x3C, 0x7C, 0x03, 0xC7, 0xC0, 0x7C, 0x01, 0x40, 0x21, 0x82,
-    0x42, 0x0C, 0x85, 0x33, 0x68, 0xC0, 0xA3, 0x87, 0x4B, 0xFC, 0x0B, 0xD0, 0x04, 0x0B, 0x00, 0xC0,
-    0x30, 0x0C, 0x07, 0x07, 0xF4, 0x19, 0x04, 0x90, 0x18, 0x0D, 0x0B, 0x0F, 0x43, 0xF8, 0x15, 0x00,
-    0x50, 0x14, 0x2C, 0x01, 0x84, 0xA3, 0xF0, 0x00, 0x01, 0x80, 0xA0, 0x8C, 0x7F, 0x80, 0xC0, 0x30,
-    0x2A, 0x04, 0x01, 0x00, 0xA8, 0x02, 0x5F, 0xC0, 0x00, 0x06, 0x48, 0x02, 0x91, 0xC6, 0x60, 0xCC,
-    0x61, 0xF0, 0x2A, 0x40, 0x60, 0x24, 0x0D, 0x03, 0x01, 0xC0, 0x60, 0x04, 0x02, 0x14, 0x31, 0x81,
-    0xF0, 0x30, 0xC7, 0x1C, 0x1A, 0x00, 0x05, 0x08, 0x95, 0x08, 0xC7, 0x1E, 0xC0, 0x63, 0xF0, 0x00,
-    0xC0, 0x28, 0x03, 0x00, 0xB0, 0x0D, 0x01, 0xC0, 0x2C, 0x03, 0x80, 0x34, 0x03, 0x40, 0x74, 0x07,
-    0x40, 0x34, 0x03, 0x40, 0x38, 0x03, 0xC0, 0x2C, 0x01, 0xD0, 0x0F, 0x00, 0xB0, 0x07, 0x80, 0x3C,
-    0x00, 0x40, 0x34, 0x01, 0xC0, 0x0D, 0x00, 0xB0, 0x03, 0x40, 0x38, 0x02, 0xC0, 0x1C, 0x00, 0xD0,
-    0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xD0, 0x0D, 0x01, 0xC0, 0x2C, 0x03, 0xC0, 0x38, 0x0B, 0x40, 0xF0,
-    0x1E, 0x03, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0D, 0x00, 0x0B, 0x0C, 0x00, 0x0E,
-    0x2C, 0x00, 0x0F, 0xFD, 0x00, 0xBF, 0xFD, 0x02, 0xFC, 0x70, 0x07, 0xF8, 0xB0, 0x0F, 0x74, 0xE0,
-    0x1F, 0x70, 0xD0, 0x2E, 0xB1, 0xC0, 0x2D, 0xE2, 0xC0, 0x3F, 0xD3, 0x80, 0x3F, 0xC3, 0x40, 0x2F,
-    0xD7, 0x00, 0x1F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x07, 0xFF, 0xFD, 0x0B, 0xBF, 0xF9, 0x0E, 0x2C,
-    0x00, 0x0D, 0x38, 0x00, 0x1C, 0x34, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x7F, 0xFD, 0x02, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x2E, 0x01, 0xEC, 0x2E, 0x01, 0xF8, 0x3F, 0x01, 0xC0, 0x2F, 0xC2, 0xC0, 0x1F, 0xFF,
-    0xFD, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x3F, 0xF8, 0x03, 0xD0, 0x74, 0x0D, 0x00, 0x00, 0x34, 0x00, 0x01, 0xFA, 0xA4,
-    0x0B, 0xFF, 0xE0, 0x03, 0x80, 0x00, 0x6F, 0xA9, 0x01, 0xFF, 0xFC, 0x00, 0x74, 0x00, 0x02, 0xD0,
-    0x00, 0x7E, 0x00, 0x03, 0xFF, 0xA5, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x02, 0xE0, 0x01,
-    0xE0, 0x03, 0xF0, 0x01, 0xE0, 0x03, 0xF8, 0x02, 0xE0, 0x03, 0xFC, 0x02, 0xE0, 0x03, 0xEE, 0x02,
-    0xE0, 0x03, 0xDF, 0x03, 0xD0, 0x07, 0xCB, 0x83, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0x1B, 0xE7, 0xF7,
-    0xE5, 0x0B, 0xC1, 0xF3, 0xD0, 0x0B, 0xC0, 0xFB, 0xC0, 0x0B, 0xC0, 0x7F, 0xC0, 0x0B, 0xC0, 0x3F,
-    0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x03, 0xFF, 0x90, 0x01, 0xFA, 0xBE, 0x00, 0x74, 0x03, 0xC3, 0xFF,
-    0xFF, 0xFD, 0x0B, 0x80, 0x3D, 0x02, 0xD0, 0x1F, 0x00, 0xBF, 0xFF, 0x40, 0x2F, 0xFF, 0x40, 0x0B,
-    0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0x02,
-    0xC0, 0x00, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x30, 0x0D, 0x00, 0x00, 0x0C, 0x0B, 0x00, 0x2F, 0x83,
-    0xFF, 0xC0, 0x2D, 0x40, 0xFF, 0xC0, 0x09, 0x00, 0x3F, 0xB8, 0x02, 0x80, 0x0E, 0x07, 0x00, 0x7E,
-    0x07, 0x81, 0xD0, 0x06, 0xF1, 0xE0, 0x38, 0x00, 0x1D, 0x78, 0x1F, 0x01, 0x9B, 0x5F, 0x07, 0xC0,
-    0xFF, 0xD7, 0xC1, 0xF0, 0x2F, 0xE0, 0x0D, 0x00, 0x03, 0x40, 0xD0, 0x00, 0x30, 0x0E, 0x00, 0x07,
-    0x00, 0xA0, 0x00, 0x70, 0x0B, 0x06, 0x0B, 0x03, 0xFF, 0xFF, 0xFC, 0x2B, 0xAF, 0xEF, 0x80, 0x31,
-    0xF8, 0xD0, 0x03, 0x6E, 0xCC, 0x00, 0x3B, 0x9D, 0xC0, 0x03, 0xF8, 0xFC, 0x00, 0x2F, 0x4F, 0xC0,
-    0x02, 0xF0, 0xF8, 0x00, 0x1F, 0x0B, 0x80, 0x01, 0xE0, 0x74, 0x00, 0x15, 0x00, 0x00, 0x07, 0xFF,
-    0xD0, 0x04, 0x7D, 0x5F, 0x41, 0xC7, 0x40, 0x2C, 0x1C, 0x70, 0x00, 0xC1, 0xC7, 0x06, 0x0D, 0x1C,
-    0x70, 0xB0, 0xD1, 0xC7, 0x07, 0x0D, 0x1C, 0x70, 0x70, 0x01, 0xC7, 0x07, 0x00, 0x1C, 0x70, 0x3D,
-    0x03, 0xC7, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xAF, 0xC0, 0x00, 0x01, 0x40, 0x00, 0x0A, 0x00, 0x03,
-    0xFF, 0x80, 0x05, 0xE4, 0x02, 0xF7, 0x40, 0x2D, 0xBD, 0x00, 0xC0, 0xF4, 0x07, 0x02, 0xD0, 0x2C,
-    0x0B, 0x00, 0x78, 0x7D, 0x00, 0xFF, 0xF4, 0x00, 0xBD, 0x90, 0x55, 0x55, 0x42, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x0B, 0xFF, 0x00, 0x7D, 0x04, 0x02, 0xC0, 0x00, 0x0F, 0x10,
-    0x03, 0xFF, 0xF0, 0x00, 0xE0, 0x00, 0x03, 0x84, 0x01, 0xFF, 0xF8, 0x00, 0x3C, 0x00, 0x00, 0xF0,
-    0x00, 0x02, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x00, 0x54, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3E, 0xC0, 0x00, 0xBF, 0x40, 0x07, 0xFC,
-    0x00, 0x01, 0x3E, 0xC0, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x01, 0x7C, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x07, 0xEB, 0xF4, 0x00, 0x1D, 0x00,
-    0xF0, 0x1A, 0xFE, 0xAB, 0xF8, 0x6B, 0xFA, 0xAF, 0xA0, 0x0B, 0x40, 0xBC, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFD, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x28, 0x00, 0x00, 0x02, 0x80, 0x00, 0x06, 0xFF, 0xE0, 0x03, 0xFF, 0xEB,
-    0x00, 0xFC, 0x28, 0x00, 0x1F, 0x42, 0x80, 0x02, 0xF0, 0x28, 0x00, 0x3E, 0x02, 0x80, 0x03, 0xE0,
-    0x24, 0x00, 0x3E, 0x02, 0xD4, 0x02, 0xE0, 0x2F, 0xFE, 0x2F, 0x02, 0x47, 0xE2, 0xF0, 0x34, 0x38,
-    0x0F, 0xD3, 0x47, 0xC0, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0x90, 0x00, 0x03,
-    0x40, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x10, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xB4, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x9A, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xEB, 0xFE,
-    0xAA, 0xAA, 0x5F, 0xE4, 0x16, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x1B, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x0B, 0xF8, 0x2F, 0xD4, 0x3C, 0xC0, 0x74,
-    0xC0, 0x74, 0xC0, 0x74, 0xC0, 0x78, 0xC0, 0x3E, 0xD0, 0x2F, 0xFC, 0x07, 0xFD, 0x00, 0x80, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0xBD, 0xA9, 0x00, 0x3C,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x02, 0xC0, 0x00, 0xD0, 0xBF, 0xFE, 0x02, 0xC0, 0xBF, 0x40, 0xBF, 0x40, 0x03, 0xC0, 0x01, 0xD0,
-    0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x18, 0x00, 0xFF, 0x80,
-    0x7F, 0x80, 0x0A, 0xF0, 0x80, 0x0F, 0xFC, 0x02, 0xF9, 0x00, 0xBF, 0x02, 0xC0, 0xF0, 0xB4, 0x0F,
-    0xBD, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x02, 0x40, 0x00, 0x0E, 0x00, 0x01,
-    0xFF, 0x80, 0x0F, 0xFF, 0x40, 0x76, 0x8F, 0x02, 0xCA, 0x2C, 0x0B, 0x18, 0x70, 0x28, 0x61, 0xC0,
-    0xA1, 0x87, 0x02, 0x87, 0x1C, 0x0B, 0x1C, 0x70, 0x2C, 0x71, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x07,
-    0xEA, 0xF4, 0x00, 0x74, 0x03, 0xC0, 0x07, 0x40, 0x2D, 0x00, 0x74, 0x02, 0xC0, 0x0B, 0x40, 0x7C,
-    0x1F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xD0, 0x05, 0xF8, 0x00, 0x02, 0xAF, 0xEA, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x74, 0x00, 0x03, 0x80, 0x00, 0x3D, 0x55, 0x51, 0xFF, 0xFF,
-    0xD2, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x07, 0xF0, 0x00, 0x7B, 0xB4, 0x0B, 0x4C, 0x74, 0x74, 0x30, 0x70, 0x00, 0xC0, 0x00,
-    0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x24, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0xE0, 0x15, 0x55, 0xE2, 0xFF, 0xFF, 0xC0, 0x00, 0x1D, 0x00, 0x00,
-    0xD0, 0x00, 0x0E, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00,
-    0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x01, 0xC0, 0xC1, 0xC2, 0xD3, 0x1D, 0x01, 0xEE, 0xD0,
-    0x01, 0xFC, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0xD0, 0x1C, 0x00, 0xD0, 0x02, 0x80,
-    0xA0, 0x00, 0x38, 0x7F, 0xFF, 0xFF, 0x4E, 0x00, 0x02, 0x80, 0xD0, 0x02, 0xC0, 0x0C, 0x01, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xB8, 0x00, 0xEE, 0xC0, 0xD3, 0x1C, 0x10, 0xC1, 0x00,
-    0x30, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x50, 0xC0, 0x0E, 0x31, 0xC0, 0xFE, 0xC0, 0x0B, 0xC0, 0x00,
-    0x40, 0x00, 0x2A, 0xFE, 0x1F, 0x95, 0x07, 0xE0, 0x01, 0xCE, 0x00, 0x60, 0xE0, 0x28, 0x0E, 0x0A,
-    0x00, 0xE0, 0x00, 0x08, 0x3F, 0xA9, 0x01, 0x5B, 0xC0, 0x03, 0xF0, 0x03, 0x8C, 0x03, 0x83, 0x03,
-    0x80, 0xC3, 0x80, 0x35, 0x80, 0x00, 0x10, 0x00, 0x1D, 0x00, 0x41, 0xD0, 0x30, 0x2C, 0x1C, 0x02,
-    0xC7, 0x00, 0x3E, 0x80, 0x03, 0xE0, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x03, 0xCA,
-    0x02, 0xC1, 0xC1, 0xC0, 0x31, 0xD0, 0x0D, 0xD0, 0x03, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x70,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x07, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x11, 0x00, 0x00, 0x38, 0x70, 0x00, 0x3E, 0x1F, 0x00, 0x3D, 0x86, 0xB0, 0x2C, 0x21,
-    0x8B, 0x1C, 0x08, 0x60, 0xA0, 0x02, 0x18, 0x00, 0x00, 0x86, 0x00, 0x00, 0x21, 0x80, 0x00, 0x08,
-    0x60, 0x00, 0x02, 0x18, 0x00, 0x00, 0x86, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0xB0, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x2C, 0xBF, 0xFF, 0xF4,
-    0x00, 0x01, 0xD0, 0x00, 0x03, 0x80, 0x00, 0x01, 0x00, 0x00, 0x21, 0x40, 0x00, 0x08, 0x60, 0x00,
-    0x02, 0x18, 0x00, 0x00, 0x86, 0x00, 0x00, 0x21, 0x80, 0x00, 0x08, 0x60, 0x07, 0x02, 0x18, 0x24,
-    0xF0, 0x86, 0x2D, 0x0F, 0x61, 0x9D, 0x00, 0xF8, 0x7C, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0x84, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x1C, 0x03, 0x80, 0x03, 0x80, 0x1C, 0x00, 0xB0,
-    0x00, 0xB0, 0x2F, 0xFF, 0xFF, 0x87, 0x00, 0x00, 0x0E, 0x38, 0x00, 0x02, 0xC0, 0xFF, 0xFF, 0xF0,
-    0x07, 0x80, 0x1D, 0x00, 0x1C, 0x03, 0x80, 0x00, 0x40, 0x10, 0x00, 0x00, 0x60, 0x00, 0x07, 0xE0,
-    0x00, 0x74, 0xF0, 0x0B, 0xC2, 0xB8, 0x36, 0x08, 0x70, 0x08, 0x20, 0x00, 0x20, 0x80, 0x00, 0x82,
-    0x00, 0x12, 0x08, 0x11, 0xFC, 0x23, 0xD1, 0xF0, 0xF8, 0x00, 0xFB, 0x40, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0x04,
-    0x0C, 0x0F, 0xF5, 0xC3, 0xC1, 0xEC, 0x74, 0x0B, 0x8B, 0x00, 0x74, 0xB0, 0x07, 0x07, 0xD1, 0xE0,
-    0x3F, 0xFC, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0xD0, 0x0B, 0xEA,
-    0xFD, 0xE0, 0x0B, 0xD0, 0x0F, 0xE0, 0x03, 0xD0, 0x01, 0xF4, 0x01, 0xF0, 0x00, 0xFE, 0x00, 0xB4,
-    0x00, 0xE7, 0x80, 0x3D, 0x00, 0xE0, 0xF0, 0x0F, 0x00, 0xE0, 0x3C, 0x03, 0xC0, 0xE0, 0x0F, 0x00,
-    0xB4, 0xE0, 0x07, 0x80, 0x2F, 0xE0, 0x03, 0xE0, 0x03, 0xFE, 0xAF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0xEF, 0xFF, 0xFC, 0x00, 0xE0, 0x6F, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFB, 0x00, 0x01, 0xE7, 0x80, 0x03, 0xC3, 0xC0,
-    0x07, 0x81, 0xE0, 0x0F, 0x40, 0xF0, 0x1F, 0x00, 0xB8, 0x3D, 0x00, 0x3C, 0x7C, 0x00, 0x3E, 0xBE,
-    0xAA, 0xBF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xF1, 0xE0, 0x78, 0x0D, 0x03, 0x80, 0xD0, 0x38, 0x0D,
-    0x03, 0x80, 0xD0, 0x38, 0x0D, 0x03, 0x80, 0xD0, 0x38, 0x0D, 0x03, 0x80, 0xD0, 0x38, 0x0D, 0x03,
-    0x80, 0xD0, 0x38, 0x09, 0x02, 0x40, 0xD0, 0x38, 0x0D, 0x03, 0x80, 0xD0, 0x38, 0x0D, 0x03, 0x80,
-    0xD0, 0x38, 0x0D, 0x03, 0x80, 0xD0, 0x38, 0x0D, 0x03, 0x80, 0xD0, 0x38, 0x1E, 0x07, 0x8B, 0xFF,
-    0xFF, 0xBF, 0xFE, 0x70, 0x00, 0x18, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0x90, 0x00, 0x90, 0x03,
-    0x80, 0x0E, 0x00, 0x38, 0x00, 0xBF, 0xFE, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x7F, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00,
-    0x01, 0x0F, 0x80, 0x00, 0x78, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x0B, 0xE0, 0xBD, 0x0F, 0xAE, 0xBA, 0xC7, 0x00, 0xF4, 0x1A, 0x80, 0x2C, 0x03, 0xA0,
-    0x0B, 0x00, 0xDD, 0x07, 0xFA, 0xE3, 0xFF, 0xAF, 0xF0, 0x2F, 0x82, 0xF4, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x03, 0xD1, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x40,
-    0x00, 0x50, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x2D,
-    0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x3E, 0x3E, 0x0B, 0x80, 0x22, 0xCA, 0x07, 0x38, 0x38,
-    0xA2, 0x40, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x3C, 0x74, 0xB2, 0x40, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x28, 0x00, 0x00, 0xC0, 0x00, 0x1E, 0x51, 0xFF, 0xFF,
-    0xC0, 0x03, 0x40, 0x00, 0x2C, 0x00, 0x01, 0xE1, 0x52, 0xFF, 0xFF, 0xC0, 0x74, 0x00, 0x03, 0x80,
-    0x00, 0x2C, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x01, 0xBE, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x1B, 0xFE, 0x40, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x0B, 0x01, 0x40, 0x00, 0x00, 0xFF, 0xFA,
-    0x50, 0x00, 0x16, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x03, 0x90, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x6F, 0xF0, 0x1B, 0xFF, 0x80, 0x2F,
-    0xE4, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x16, 0xBF, 0xF4, 0x7E, 0x95, 0x00, 0x00,
+static const uint8_t opendyslexic_8_regularBitmaps[20525] = {
+    0x29, 0x29, 0xC2, 0xAC, 0x2A, 0xC2, 0xAC, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x29, 0x92,
+    0x99, 0x1E, 0x1E, 0x1E, 0x00, 0x09, 0x92, 0x99, 0x1D, 0xA0, 0xAD, 0x1D, 0x90, 0xAD, 0x1D, 0x1D,
+    0xA1, 0xD9, 0x0D, 0xA1, 0xAA, 0x1A, 0xA9, 0x00, 0x49, 0xC2, 0x9C, 0x71, 0xAC, 0x2A, 0xC7, 0x1D,
+    0x2D, 0x71, 0xCA, 0x2C, 0xA5, 0xFF, 0xFE, 0x90, 0x99, 0x9A, 0xCA, 0x99, 0xAC, 0xA9, 0x99, 0x94,
+    0x9C, 0x91, 0x9C, 0x97, 0x0A, 0xC9, 0x19, 0xC9, 0x70, 0xAC, 0x91, 0xAC, 0x95, 0x99, 0x9D, 0xA9,
+    0x9D, 0xA9, 0x99, 0x90, 0x9F, 0xFF, 0xE4, 0xD2, 0xD7, 0x09, 0xD2, 0xD7, 0x09, 0xD2, 0xD7, 0x19,
+    0x92, 0x99, 0x50, 0x79, 0x71, 0xAA, 0x0C, 0x70, 0x9F, 0xCA, 0x5F, 0xF4, 0xFA, 0x0C, 0x95, 0xD0,
+    0xAA, 0x0C, 0x6D, 0x0A, 0xA0, 0xC6, 0xFA, 0x0C, 0x7F, 0xDA, 0x96, 0x9F, 0xE6, 0xAA, 0x0F, 0xC5,
+    0xAA, 0x0C, 0xAE, 0xA1, 0x99, 0x0A, 0xA0, 0xFC, 0xA0, 0x9F, 0xFE, 0x90, 0xFF, 0xEA, 0x1A, 0xFF,
+    0xA7, 0xAA, 0x0C, 0x71, 0x99, 0x0A, 0x40, 0x71, 0x97, 0x1C, 0x3D, 0xA2, 0xAA, 0x2C, 0x19, 0xA1,
+    0xC3, 0xC2, 0xC0, 0xA9, 0x3C, 0x19, 0xC9, 0xC4, 0xAE, 0x9C, 0x95, 0x99, 0x0A, 0xCA, 0xCA, 0x6D,
+    0x90, 0x9C, 0x4C, 0xAC, 0x2C, 0x39, 0xC0, 0xC2, 0xC3, 0xC9, 0x0A, 0xA9, 0xAC, 0x2A, 0xC2, 0xAD,
+    0x3A, 0x97, 0x77, 0x0A, 0xEA, 0x7D, 0x99, 0x9C, 0xA5, 0x9C, 0x3A, 0xC5, 0x9C, 0xA2, 0xD6, 0xD9,
+    0x9D, 0x70, 0xF7, 0x09, 0xEA, 0x70, 0xDA, 0xAC, 0xA6, 0xAD, 0x19, 0xCA, 0x1D, 0x1D, 0xA2, 0x9C,
+    0xAA, 0xCA, 0x1E, 0x39, 0xE2, 0xAE, 0x99, 0x9F, 0x3F, 0xF9, 0xCA, 0x39, 0xFA, 0x77, 0x20, 0x09,
+    0x91, 0xDA, 0x0D, 0x90, 0xD1, 0xD0, 0x3C, 0x3A, 0xA3, 0xC3, 0xAC, 0x3C, 0x92, 0x9C, 0x3A, 0xC3,
+    0xCA, 0x3C, 0x93, 0xC9, 0x29, 0xC9, 0x29, 0xC9, 0x3C, 0x93, 0xC9, 0x3C, 0xA3, 0xD3, 0xAC, 0x39,
+    0xC9, 0x3D, 0x3A, 0xC3, 0x9C, 0xA3, 0xD4, 0x90, 0x0C, 0x93, 0x9C, 0x4C, 0x93, 0xAC, 0x4C, 0x93,
+    0xCA, 0x3A, 0xC3, 0x9C, 0x4C, 0x93, 0xCA, 0x3C, 0xA3, 0xCA, 0x3C, 0x93, 0xC9, 0x29, 0xC3, 0xAC,
+    0x3D, 0x3C, 0xA2, 0xAC, 0x92, 0xD2, 0x9C, 0xA2, 0xD3, 0x99, 0x20, 0x39, 0x69, 0xA3, 0x9C, 0x99,
+    0xA0, 0xAC, 0x19, 0xF9, 0x39, 0xDA, 0x3A, 0xC9, 0xC9, 0xD1, 0xA1, 0xC1, 0x94, 0xC3, 0x3A, 0x59,
+    0xC5, 0x9C, 0x59, 0xC9, 0x1A, 0xFE, 0x29, 0xC5, 0x9C, 0x59, 0xC7, 0x20, 0x19, 0x91, 0x9D, 0x90,
+    0x9D, 0x1A, 0xD1, 0xDA, 0x1A, 0xA9, 0x00, 0x9A, 0xAA, 0xAA, 0xA9, 0xAF, 0xDA, 0x09, 0xA1, 0xD9,
+    0x0D, 0xA0, 0x7A, 0x79, 0xC7, 0xAA, 0x7C, 0x96, 0x9C, 0x7A, 0xC7, 0xCA, 0x7C, 0x96, 0xAC, 0x7C,
+    0xA7, 0xC9, 0x69, 0xC7, 0xAC, 0x7C, 0xA6, 0x9C, 0x96, 0xAC, 0x7D, 0x7C, 0x96, 0xAC, 0x7D, 0x7C,
+    0xA6, 0x9C, 0x96, 0xAC, 0x7D, 0x69, 0xC7, 0x71, 0x29, 0xA9, 0x4C, 0x90, 0x9C, 0x2C, 0xA2, 0x9C,
+    0x1C, 0x93, 0xC9, 0x9C, 0x1C, 0x1C, 0xAA, 0xC1, 0xC9, 0x0C, 0xAA, 0xC1, 0xC9, 0x0C, 0xAA, 0xC1,
+    0x91, 0xCA, 0x9C, 0xA2, 0x9C, 0xA9, 0xD9, 0x09, 0xD9, 0x0F, 0xE1, 0x9F, 0xCA, 0x29, 0xE9, 0x10,
+    0x70, 0x9D, 0xA3, 0xCA, 0xCA, 0x5C, 0xA5, 0xCA, 0x5C, 0xA5, 0xCA, 0x5C, 0xA4, 0x9C, 0xA4, 0x9C,
+    0xA3, 0x9A, 0xCA, 0x99, 0x0A, 0xFD, 0x9A, 0xFD, 0x90, 0x29, 0x93, 0x9F, 0xCA, 0x19, 0xA9, 0x19,
+    0xCA, 0x6A, 0xC6, 0xAC, 0x6D, 0x5A, 0xCA, 0x4A, 0xD4, 0xE9, 0x29, 0xE9, 0x3E, 0xA9, 0x99, 0x09,
+    0xFE, 0x0A, 0xFE, 0x90, 0x0A, 0xF9, 0x2A, 0x29, 0xC9, 0x69, 0xC7, 0xC6, 0x9C, 0x39, 0x9A, 0xC9,
+    0x2A, 0xE9, 0x69, 0xD6, 0xAC, 0x6A, 0xC9, 0x0A, 0xA9, 0xAA, 0xD0, 0x9F, 0xD9, 0x09, 0xAE, 0xA9,
+    0x10, 0x75, 0xCA, 0x5A, 0xCA, 0x49, 0xDA, 0x4C, 0xAA, 0xC3, 0xD0, 0xAC, 0x2A, 0xC9, 0x0A, 0xC1,
+    0x9C, 0xA1, 0xD9, 0x0A, 0xFE, 0xA0, 0x99, 0x99, 0xDA, 0x94, 0xD9, 0x5D, 0x95, 0xD9, 0x00, 0x71,
+    0xFD, 0x90, 0x9C, 0x69, 0xC6, 0x9C, 0x69, 0xFA, 0x91, 0x99, 0x99, 0x9A, 0xC9, 0x6D, 0x6D, 0x6D,
+    0x09, 0xCA, 0xAA, 0xE0, 0x9F, 0xD9, 0x09, 0xFA, 0x20, 0x49, 0x99, 0x29, 0xFC, 0x19, 0xCA, 0x5C,
+    0xA5, 0x9C, 0x6A, 0xCA, 0xF9, 0x0A, 0xD9, 0x1D, 0x0A, 0xCA, 0x3C, 0xA9, 0xC9, 0x3C, 0xA9, 0xC9,
+    0x3C, 0xA0, 0xD9, 0x09, 0xD9, 0x09, 0xFD, 0x29, 0xAD, 0xA1, 0x70, 0xAF, 0xE5, 0x9D, 0x6D, 0x6C,
+    0xA5, 0x9C, 0x95, 0xAC, 0x95, 0xD5, 0x9D, 0x5A, 0xD5, 0xDA, 0x5D, 0xA4, 0x9D, 0x91, 0x2A, 0xCA,
+    0x93, 0x9C, 0x91, 0xAA, 0x2C, 0xA3, 0xC2, 0xC9, 0x3C, 0x91, 0xD2, 0xAC, 0x29, 0xDA, 0xAC, 0xA3,
+    0xAF, 0x3D, 0x91, 0xD9, 0x09, 0xC9, 0x3D, 0x0A, 0xC9, 0x3D, 0x0A, 0xCA, 0x29, 0xD1, 0xEA, 0xE9,
+    0x2A, 0xEA, 0x91, 0x1A, 0xE9, 0x2A, 0xC9, 0x0A, 0xCA, 0x09, 0xC3, 0xD0, 0xAC, 0x39, 0xC9, 0xAC,
+    0x39, 0xCA, 0x9C, 0x39, 0xCA, 0x0C, 0xA2, 0xDA, 0x0A, 0xFD, 0xA2, 0x9A, 0xA9, 0xCA, 0x6C, 0x90,
+    0x99, 0x19, 0xD9, 0x0F, 0xE1, 0xFC, 0xA1, 0x0A, 0xC9, 0x0D, 0xA0, 0xDA, 0x77, 0x0A, 0xC9, 0x0D,
+    0xA0, 0xDA, 0x1D, 0x19, 0xD1, 0xAD, 0x77, 0x19, 0x91, 0x9D, 0x90, 0x9D, 0x1A, 0xD1, 0xDA, 0x1A,
+    0xA9, 0x00, 0x70, 0xA9, 0x7A, 0xD9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x6A, 0xDA, 0x97, 0xAF,
+    0xC9, 0x79, 0xFC, 0xA7, 0x9A, 0xD7, 0x29, 0x00, 0x79, 0xFD, 0xA0, 0x99, 0x97, 0x70, 0x99, 0x09,
+    0xFD, 0xA7, 0x0A, 0x97, 0x1E, 0x97, 0x09, 0xAD, 0xA7, 0x1A, 0xDA, 0x71, 0xAE, 0x79, 0xE3, 0x9A,
+    0xFA, 0x90, 0x9F, 0xCA, 0x93, 0xAD, 0xA7, 0x73, 0x73, 0xAE, 0xA3, 0xDA, 0xAE, 0x2A, 0x3A, 0xCA,
+    0x7D, 0x7D, 0x7D, 0x69, 0xCA, 0x6D, 0x59, 0xD9, 0x4A, 0xD9, 0x5D, 0xA6, 0xD9, 0x6D, 0x96, 0xAA,
+    0x77, 0x19, 0xA9, 0x6A, 0xC9, 0x6D, 0xA3, 0x77, 0x4A, 0xEA, 0x79, 0xD9, 0x99, 0xAC, 0x94, 0x9C,
+    0x95, 0xC4, 0xC9, 0x69, 0xA2, 0xAC, 0x1A, 0xE2, 0xC2, 0xCA, 0x1A, 0x1C, 0x2C, 0x19, 0xC9, 0x09,
+    0x91, 0xC2, 0xC1, 0x9C, 0xA0, 0xA9, 0x09, 0xC1, 0x9C, 0x19, 0xD1, 0xF0, 0x9C, 0x92, 0xD9, 0x19,
+    0x09, 0xD9, 0x3E, 0x73, 0x9E, 0x92, 0x9A, 0x59, 0xFF, 0x7A, 0xFD, 0x97, 0x09, 0x99, 0x93, 0x4A,
+    0xCA, 0x71, 0xE7, 0x09, 0xE9, 0x7D, 0x0C, 0xA7, 0xCA, 0x0D, 0x6A, 0xC9, 0x09, 0xC9, 0x5D, 0x2D,
+    0x49, 0xCA, 0x2D, 0x93, 0xAC, 0x92, 0x9C, 0xA3, 0xD9, 0x29, 0xD2, 0x9F, 0xFC, 0x91, 0xFF, 0xE0,
+    0x9D, 0x59, 0xD0, 0xAD, 0x6D, 0xA0, 0xFD, 0xA3, 0xD9, 0x99, 0xAD, 0x91, 0xD4, 0xCA, 0x1D, 0x4D,
+    0x1D, 0x39, 0xCA, 0x1F, 0xEA, 0x2D, 0xAA, 0xAE, 0xA1, 0xD4, 0xAC, 0xA0, 0xD5, 0xD0, 0xD5, 0xD0,
+    0xD4, 0xAD, 0x0D, 0xAA, 0xAF, 0xC0, 0xFF, 0xC9, 0x0F, 0xEA, 0x91, 0x77, 0x1A, 0xF9, 0x39, 0xFD,
+    0x92, 0xAD, 0x96, 0x9D, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xCA, 0x70, 0xAC, 0x97, 0x0A, 0xCA, 0x70,
+    0xE7, 0x0A, 0xE7, 0x9F, 0xCA, 0xAD, 0x91, 0xFF, 0xC9, 0x2F, 0xF9, 0x3A, 0xFC, 0xA9, 0x73, 0x74,
+    0xFE, 0xA4, 0xFF, 0xC3, 0xD3, 0x9E, 0x2D, 0x5D, 0xA1, 0xD6, 0xD1, 0xD6, 0xDA, 0x0D, 0x6A, 0xD0,
+    0xD6, 0xAD, 0x0D, 0x6A, 0xD0, 0xD5, 0x9E, 0x0D, 0xAA, 0xAA, 0xAF, 0xA0, 0xFF, 0xE1, 0xFF, 0xD2,
+    0xFE, 0xA4, 0x71, 0x9F, 0xF0, 0x9F, 0xDA, 0x90, 0x9C, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96,
+    0xAF, 0xD2, 0xAF, 0xD2, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xFF, 0xA0, 0xFF, 0xC0, 0xFF, 0xC0,
+    0x71, 0xFE, 0x1D, 0xAA, 0x99, 0x91, 0xD5, 0x9C, 0xA5, 0x9C, 0xA5, 0x9F, 0xD9, 0x09, 0xFD, 0x1A,
+    0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5D, 0xA5, 0xDA, 0x50, 0x59, 0x9A, 0x99,
+    0x5A, 0xFF, 0x3A, 0xDA, 0x93, 0x93, 0xDA, 0x71, 0xAD, 0x72, 0xAC, 0xA7, 0x2D, 0xA7, 0x2D, 0xA7,
+    0x2D, 0xA3, 0xAF, 0xA0, 0xAC, 0xA4, 0x99, 0xE0, 0xAD, 0x6C, 0xA1, 0x9E, 0x93, 0x9D, 0x2F, 0xFE,
+    0x3F, 0xFD, 0x4A, 0xFC, 0xA9, 0x10, 0x09, 0x69, 0x90, 0x9C, 0xA5, 0xD0, 0xAC, 0xA5, 0xD0, 0xAC,
+    0xA5, 0xD0, 0xAC, 0xA5, 0xD9, 0xAC, 0xA5, 0xD9, 0xAC, 0xA5, 0xD9, 0xAD, 0x5D, 0x9A, 0xFF, 0xD9,
+    0xAF, 0xFD, 0x9A, 0xFF, 0xDA, 0xE4, 0x9D, 0xAE, 0x5D, 0xAE, 0x49, 0xDA, 0xE4, 0x9D, 0xA0, 0x3A,
+    0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0,
+    0xAD, 0x0A, 0xD0, 0xAD, 0x90, 0x72, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+    0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x3A, 0xCA, 0x29, 0xDA, 0x0A, 0xF1, 0xFA, 0x1A, 0xCA, 0x92,
+    0x0A, 0xC9, 0x1A, 0xD2, 0xAC, 0x91, 0xD9, 0x2D, 0x1A, 0xCA, 0x3D, 0x09, 0xD4, 0xD0, 0xDA, 0x4D,
+    0x9D, 0x5F, 0x95, 0xF5, 0x9F, 0x59, 0xFC, 0x49, 0xDA, 0xDA, 0x3A, 0xD0, 0xEA, 0x2A, 0xCA, 0x1E,
+    0xA1, 0xAC, 0xA1, 0xAE, 0xA0, 0xDA, 0x2F, 0x90, 0x71, 0xD6, 0xD5, 0x9C, 0xA5, 0x9C, 0xA5, 0x9C,
+    0xA5, 0x9C, 0xA5, 0x9C, 0xA5, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0x95, 0xAD, 0xAA, 0xAA,
+    0xFF, 0xFF, 0xF0, 0x77, 0xE5, 0x9D, 0x91, 0xE9, 0x4E, 0x91, 0xF3, 0x9E, 0xA0, 0x9F, 0x3A, 0xEA,
+    0x09, 0xCA, 0xDA, 0x2D, 0xAC, 0xA0, 0x9C, 0xAA, 0xD1, 0x9D, 0xAD, 0x09, 0xCA, 0x9D, 0x90, 0xDA,
+    0xAD, 0x09, 0xD0, 0xE9, 0xD0, 0xAD, 0x0A, 0xD0, 0xAF, 0xC0, 0xAD, 0x0A, 0xD1, 0xFA, 0x0E, 0x0A,
+    0xD1, 0xAE, 0x1E, 0x0A, 0xD1, 0x9E, 0x1E, 0x9E, 0x2D, 0x91, 0xE9, 0xE7, 0xE9, 0x74, 0x9A, 0x94,
+    0x9C, 0xA0, 0xE4, 0x9C, 0xA0, 0xEA, 0x3A, 0xCA, 0x0F, 0x3A, 0xCA, 0x0F, 0x92, 0xAC, 0xA0, 0xD9,
+    0xD2, 0xD9, 0x0D, 0x0D, 0x91, 0xD9, 0x9D, 0x09, 0xD1, 0xD9, 0x9D, 0x1D, 0x90, 0xD9, 0x9D, 0x19,
+    0xD0, 0xD9, 0xAD, 0x2D, 0xAD, 0x0A, 0xD2, 0x9F, 0x0A, 0xD3, 0xF0, 0xE3, 0x9E, 0x00, 0x29, 0xAE,
+    0xA9, 0x4A, 0xDA, 0xAA, 0xDA, 0x2A, 0xD9, 0x29, 0xE1, 0xD9, 0x49, 0xD9, 0x9D, 0x6D, 0xAA, 0xC9,
+    0x69, 0xF9, 0x7F, 0x70, 0xF9, 0x7D, 0xAC, 0x96, 0x9C, 0xAA, 0xD9, 0x5D, 0xA0, 0xFA, 0xAA, 0xF1,
+    0xAF, 0xFD, 0x2A, 0xFF, 0x49, 0xAF, 0xA7, 0x70, 0x0F, 0xCA, 0x29, 0xDA, 0xAA, 0xD9, 0x09, 0xC9,
+    0x3D, 0x09, 0xC9, 0x3A, 0xC9, 0x9C, 0x93, 0xAC, 0x0A, 0xC9, 0x29, 0xD0, 0xAF, 0xEA, 0x0A, 0xFD,
+    0x91, 0xAC, 0xA6, 0xAC, 0xA6, 0xDA, 0x6E, 0x6E, 0x6E, 0x6E, 0x60, 0x49, 0x99, 0x97, 0x1F, 0xD9,
+    0x59, 0xD9, 0x19, 0xDA, 0x4D, 0x5D, 0x92, 0xAC, 0xA6, 0xD2, 0xD7, 0xD2, 0xD7, 0xAC, 0x90, 0x9D,
+    0x7A, 0xC9, 0x09, 0xD7, 0xAC, 0x91, 0xD7, 0xD9, 0x1D, 0x92, 0x99, 0x1D, 0x2E, 0x90, 0x9F, 0xD2,
+    0x9F, 0xFD, 0x93, 0xAF, 0xFA, 0x59, 0xAF, 0xDA, 0x72, 0xAE, 0xA7, 0x2F, 0xA7, 0x70, 0x0F, 0xCA,
+    0x4C, 0xAA, 0xAA, 0xD3, 0xC3, 0x9C, 0x92, 0xC4, 0xCA, 0x19, 0xC3, 0x9C, 0xA1, 0x9C, 0xA9, 0x9A,
+    0xD9, 0x19, 0xFD, 0x92, 0x9F, 0xDA, 0x2A, 0xD2, 0xD9, 0x1A, 0xD2, 0x9D, 0x1A, 0xD3, 0xD1, 0xAD,
+    0x3D, 0x90, 0xE2, 0x9D, 0xA0, 0xE2, 0x9E, 0x00, 0x29, 0xAF, 0xA4, 0xAF, 0xE4, 0xDA, 0x97, 0x9D,
+    0x71, 0x9C, 0xA7, 0x19, 0xD9, 0x71, 0xFC, 0xA9, 0x6A, 0xFD, 0x96, 0x9A, 0xFA, 0x70, 0xAE, 0x70,
+    0x9E, 0x91, 0xA9, 0x91, 0x9F, 0x90, 0xAF, 0xFD, 0x09, 0xFF, 0xD2, 0xAF, 0xDA, 0x97, 0x70, 0xFF,
+    0xFF, 0xFE, 0xA4, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x70, 0x9D, 0x70, 0x9D, 0x70,
+    0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x93, 0x73, 0xE4, 0x9D, 0x9E, 0x49, 0xD9, 0xE4, 0x9D,
+    0x9A, 0xCA, 0x49, 0xD0, 0xAC, 0xA4, 0x9D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D,
+    0x0A, 0xCA, 0x5D, 0x09, 0xD4, 0x9D, 0x09, 0xDA, 0x29, 0xE1, 0xFF, 0xCA, 0x1F, 0xFC, 0x92, 0xAF,
+    0xD9, 0x75, 0x75, 0xAC, 0xA7, 0xD0, 0x9D, 0x6A, 0xCA, 0x1D, 0x95, 0xD9, 0x1A, 0xCA, 0x49, 0xD2,
+    0x9D, 0x4D, 0xA3, 0xD9, 0x29, 0xD9, 0x3A, 0xCA, 0x2A, 0xD4, 0x9D, 0x2D, 0xA5, 0xD9, 0x09, 0xD9,
+    0x5E, 0x0E, 0x69, 0xFC, 0xA7, 0xFC, 0x97, 0xFC, 0x70, 0xAE, 0xA4, 0xAC, 0x97, 0x3A, 0xC9, 0xAC,
+    0xA7, 0x3D, 0x09, 0xD7, 0x29, 0xD1, 0xD7, 0x2A, 0xCA, 0x1D, 0x92, 0x9D, 0x3D, 0x91, 0xAC, 0xA2,
+    0xE9, 0x2D, 0x29, 0xD1, 0x9F, 0x19, 0xD3, 0xD1, 0xFC, 0x90, 0xAC, 0xA3, 0xD9, 0x9D, 0x9A, 0xD0,
+    0xD9, 0x3D, 0xAE, 0x09, 0xD9, 0xD4, 0xAF, 0xA1, 0xFC, 0x49, 0xF2, 0xAE, 0xA5, 0xEA, 0x3E, 0x95,
+    0xE9, 0x3E, 0x30, 0x75, 0xAC, 0x6D, 0x2D, 0x4A, 0xC9, 0x2A, 0xCA, 0x29, 0xCA, 0x4D, 0x91, 0xD5,
+    0x9D, 0x0D, 0x96, 0xAE, 0xA7, 0x0E, 0x71, 0xE7, 0x0F, 0xC6, 0xAD, 0x9D, 0xA4, 0x9D, 0xA0, 0xAD,
+    0x93, 0xE2, 0xE2, 0xAD, 0x92, 0x9D, 0xA0, 0x9D, 0xA4, 0xAD, 0x90, 0xAC, 0x95, 0xD9, 0x0D, 0x49,
+    0xD1, 0xAC, 0xA3, 0xD9, 0x2D, 0x29, 0xD3, 0xAD, 0x1D, 0x94, 0xD9, 0xAD, 0x5A, 0xF9, 0x6F, 0x7A,
+    0xD9, 0x7A, 0xD7, 0x0A, 0xD7, 0x0E, 0x70, 0xE7, 0x9E, 0x40, 0x1F, 0xFD, 0x91, 0xFF, 0xD3, 0x99,
+    0x99, 0x99, 0xE7, 0x0E, 0x97, 0xEA, 0x7E, 0xA7, 0xEA, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xCA, 0xAA,
+    0xAA, 0xAA, 0x0F, 0xFF, 0x0F, 0xFF, 0x90, 0x09, 0xAA, 0xA9, 0x0A, 0xEA, 0x0A, 0xC3, 0xD3, 0xD3,
+    0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xCA, 0x3C, 0xA3, 0xCA, 0x29, 0xCA, 0x29, 0xCA, 0x29, 0xC9, 0x29,
+    0xC9, 0x29, 0xC9, 0x2A, 0xC9, 0x2A, 0xC9, 0x2A, 0xC3, 0xAF, 0x0A, 0xF0, 0x5A, 0x4A, 0xA3, 0x9C,
+    0x4C, 0x4C, 0xA3, 0x9C, 0x4C, 0x93, 0xCA, 0x3A, 0xC3, 0x9C, 0x93, 0xD3, 0xAC, 0x39, 0xC9, 0x3C,
+    0x49, 0x00, 0x9A, 0xAA, 0x90, 0xAE, 0x92, 0x9C, 0xA2, 0x9C, 0xA3, 0xCA, 0x3C, 0xA3, 0xCA, 0x3D,
+    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3A, 0xC3, 0xAC, 0x3A, 0xC3, 0xAC, 0x92, 0xAC, 0x92, 0x9C,
+    0x92, 0x9C, 0x90, 0xF9, 0x0F, 0xA0, 0x71, 0xCA, 0x3C, 0xAC, 0x91, 0xA2, 0xA9, 0x9A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x9A, 0xFF, 0xD7, 0x20, 0x09, 0x94, 0xD4, 0xAC, 0x90, 0x74, 0xE9, 0xC3, 0xDA, 0xAD,
+    0x91, 0xD2, 0xAC, 0x91, 0xC9, 0x29, 0xC9, 0x09, 0xC4, 0xCA, 0x09, 0xC4, 0xCA, 0x09, 0xC3, 0xAD,
+    0x1D, 0xAA, 0xF1, 0xAF, 0xE2, 0xAD, 0xA9, 0xAC, 0x00, 0x71, 0x9D, 0x69, 0xD6, 0x9D, 0x7D, 0x7D,
+    0x7D, 0xAE, 0xA2, 0xEA, 0x99, 0xD1, 0xDA, 0x29, 0xC9, 0x0D, 0x93, 0xCA, 0x0D, 0x4C, 0xA0, 0xD9,
+    0x29, 0xCA, 0x0A, 0xDA, 0x9A, 0xD1, 0x9F, 0xDA, 0x2A, 0xF9, 0x73, 0x71, 0x9E, 0xA1, 0xAD, 0x99,
+    0x91, 0xD4, 0x9C, 0x94, 0x9C, 0x94, 0x9C, 0x94, 0x9C, 0xA5, 0xDA, 0x4A, 0xFC, 0x29, 0xAE, 0x97,
+    0x7C, 0x97, 0xC9, 0x7C, 0x97, 0xC9, 0x7C, 0x92, 0xAD, 0x90, 0xC9, 0x1F, 0xCA, 0xC9, 0x0A, 0xC2,
+    0xAD, 0x1C, 0x93, 0xD0, 0x9C, 0x4D, 0x09, 0xC4, 0xD0, 0x9C, 0xA2, 0x9D, 0x1E, 0xAF, 0x19, 0xFE,
+    0x29, 0xAD, 0xA9, 0xC9, 0x71, 0x2A, 0xDA, 0x4D, 0x90, 0x9C, 0x2A, 0xA3, 0xAA, 0x1C, 0xA9, 0xAA,
+    0xE0, 0x9F, 0xAA, 0xAA, 0x09, 0xC7, 0x0C, 0xA7, 0xE9, 0x19, 0xA2, 0xFE, 0x3A, 0xEA, 0x90, 0x79,
+    0xE1, 0xCA, 0x3C, 0x93, 0xC9, 0x19, 0xFC, 0x0A, 0xD9, 0x91, 0xCA, 0x3C, 0xA3, 0xCA, 0x3C, 0xA2,
+    0x9C, 0xA2, 0x9D, 0x29, 0xD1, 0x19, 0xDA, 0x0D, 0x09, 0xFE, 0x0C, 0xA1, 0x9E, 0x9C, 0x3D, 0xA9,
+    0xC3, 0xAC, 0xA9, 0xC3, 0xAC, 0xA9, 0xC3, 0xDA, 0x0D, 0xAA, 0xEA, 0x09, 0xFD, 0xA1, 0x9D, 0xA9,
+    0xC9, 0x5D, 0x90, 0x99, 0x1A, 0xD1, 0xFD, 0xA1, 0xAF, 0xA7, 0x20, 0x09, 0xC7, 0xAC, 0x7A, 0xC7,
+    0xAC, 0x7A, 0xC7, 0xCA, 0x0A, 0xAA, 0x3F, 0xE2, 0xDA, 0x19, 0xCA, 0x1D, 0x3C, 0xA1, 0xD3, 0xAC,
+    0x1C, 0xA3, 0xAC, 0x1C, 0xA3, 0xAC, 0x09, 0xD3, 0xD0, 0x9D, 0x3D, 0x09, 0xD3, 0xD0, 0x0A, 0xA0,
+    0x9D, 0x09, 0xD7, 0x19, 0x2C, 0x91, 0xC9, 0x1C, 0x91, 0xC9, 0x1C, 0x91, 0xCA, 0x1C, 0xA1, 0xCA,
+    0x09, 0xD0, 0x3A, 0xC9, 0x3D, 0x93, 0xAA, 0x97, 0x71, 0x9C, 0x49, 0xC4, 0x9C, 0x49, 0xC4, 0x9C,
+    0x4A, 0xC4, 0xAC, 0x4A, 0xC4, 0xAC, 0x4A, 0xA4, 0xCA, 0x3A, 0xCA, 0x1F, 0x2A, 0xA9, 0x20, 0x72,
+    0xD7, 0xD7, 0xD7, 0xCA, 0x7C, 0xA0, 0x9A, 0x93, 0xCA, 0x0D, 0x4C, 0xAD, 0x5E, 0x95, 0xE9, 0x49,
+    0xCA, 0xD9, 0x39, 0xCA, 0x9D, 0x92, 0x9C, 0xA0, 0xAD, 0x91, 0x9C, 0xA1, 0xAD, 0xA0, 0x09, 0x92,
+    0xCA, 0x2C, 0xA2, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC2, 0x9C, 0x2A, 0xC2, 0xAC, 0x2A, 0xC2,
+    0xAC, 0x2A, 0xE0, 0xAE, 0x90, 0x09, 0xC0, 0xAD, 0xA1, 0xAD, 0x91, 0xAE, 0xAD, 0xAD, 0xAD, 0x1A,
+    0xD2, 0xE2, 0xC9, 0x0D, 0x92, 0xAC, 0xA2, 0xAA, 0x0D, 0x39, 0xC9, 0x2C, 0xA0, 0xD3, 0xAC, 0x3D,
+    0x0D, 0x3D, 0x3D, 0x0D, 0x3D, 0x3D, 0x9D, 0x3D, 0x3D, 0x9C, 0xA2, 0x9C, 0xA3, 0xD0, 0x49, 0x4F,
+    0xD9, 0x2D, 0xA1, 0xAC, 0x2D, 0x3C, 0x91, 0xD3, 0xCA, 0x1D, 0x3C, 0xA1, 0xD3, 0xD0, 0x9D, 0x3D,
+    0x09, 0xD3, 0xD0, 0x9D, 0x29, 0xD0, 0x19, 0xAD, 0xA3, 0x9D, 0xAA, 0xD2, 0xCA, 0x3C, 0xA1, 0xC9,
+    0x3A, 0xC0, 0x9C, 0x49, 0xC0, 0x9C, 0x93, 0x9C, 0x1C, 0xA3, 0xAC, 0x1D, 0xAA, 0xAD, 0xA1, 0x9F,
+    0xD3, 0x9A, 0xDA, 0x20, 0x1A, 0x1A, 0xCA, 0x4C, 0xAD, 0xAA, 0xC9, 0x2E, 0x2A, 0xC2, 0xD9, 0x29,
+    0xC2, 0xD4, 0xC2, 0xD4, 0xC9, 0x1D, 0xA2, 0x9C, 0x2E, 0xA9, 0x9D, 0x2F, 0xE9, 0x19, 0xCA, 0x9E,
+    0xA2, 0xAC, 0x97, 0xD7, 0x0D, 0x70, 0xD7, 0x72, 0x39, 0x91, 0x94, 0xFC, 0x9C, 0x92, 0xAC, 0x2A,
+    0xD3, 0xC9, 0x29, 0xD2, 0x9C, 0x4D, 0x29, 0xC3, 0x9D, 0x29, 0xC3, 0xAD, 0x3D, 0x99, 0xAE, 0x39,
+    0xFE, 0x49, 0xE9, 0xAA, 0x71, 0xCA, 0x09, 0x7F, 0x7E, 0x97, 0x93, 0x0A, 0xC9, 0xD1, 0xAF, 0x90,
+    0xAC, 0xA3, 0xD9, 0x3D, 0x4D, 0x4D, 0x4D, 0x92, 0x9D, 0x92, 0x19, 0xF9, 0x19, 0xC9, 0x99, 0x92,
+    0xAA, 0x6A, 0xC9, 0x6E, 0xA5, 0xAE, 0xA6, 0xD2, 0xCA, 0x99, 0xD9, 0x0F, 0xE1, 0xAF, 0xC9, 0x00,
+    0x72, 0xAA, 0x5C, 0xA4, 0x9C, 0xA3, 0xFD, 0x29, 0xC9, 0x49, 0xC9, 0x49, 0xC9, 0x4A, 0xC9, 0x4A,
+    0xC9, 0x4A, 0xCA, 0x4A, 0xF2, 0xAF, 0x00, 0x9C, 0x4C, 0x99, 0xC4, 0xC9, 0x9C, 0x92, 0x9C, 0xA9,
+    0xC9, 0x29, 0xCA, 0x0C, 0x92, 0x9C, 0xA0, 0xCA, 0x29, 0xCA, 0x0D, 0x2A, 0xCA, 0x0F, 0xEA, 0x0A,
+    0xFD, 0xA1, 0xAD, 0xA0, 0xD0, 0x73, 0xC9, 0x49, 0xC1, 0xAC, 0x4C, 0xA1, 0x9C, 0xA2, 0x9C, 0x92,
+    0xD2, 0xD3, 0x9C, 0xA0, 0x9C, 0x94, 0xD0, 0xD5, 0x9E, 0xA6, 0xE9, 0x6E, 0x30, 0x74, 0x9C, 0xA6,
+    0x9C, 0xA0, 0xD6, 0xAC, 0x90, 0xD2, 0xA2, 0xD1, 0xAC, 0x90, 0xAD, 0x1D, 0x19, 0xCA, 0x9E, 0xA9,
+    0xCA, 0x2F, 0xFC, 0x92, 0xAE, 0xAF, 0x39, 0xE0, 0xAE, 0x4D, 0x91, 0xDA, 0x10, 0x1D, 0x29, 0xCA,
+    0x29, 0xCA, 0x1D, 0x4A, 0xC9, 0xD6, 0xEA, 0x6A, 0xD7, 0xE9, 0x5D, 0xAD, 0x4A, 0xD0, 0xAC, 0xA2,
+    0x9D, 0x2D, 0x91, 0xD9, 0x2A, 0xD0, 0x0C, 0x93, 0x9C, 0x90, 0xD3, 0xAC, 0x19, 0xCA, 0x2D, 0x2D,
+    0x2C, 0xA2, 0x9C, 0xA0, 0xAC, 0x93, 0xD0, 0xD4, 0x9F, 0x5E, 0xA5, 0x9D, 0xA5, 0x9D, 0x95, 0x9D,
+    0x59, 0xDA, 0x3F, 0xC4, 0xEA, 0x76, 0x1F, 0xE2, 0xAA, 0xAA, 0xE6, 0xD6, 0xD9, 0x5D, 0xA5, 0xDA,
+    0x5E, 0x5A, 0xD6, 0xFE, 0x19, 0xFE, 0xA0, 0x72, 0xAE, 0x29, 0xCA, 0x4A, 0xC9, 0x4A, 0xC9, 0x4A,
+    0xC5, 0xD3, 0xAD, 0x93, 0xAD, 0x6C, 0xA5, 0xD5, 0xD5, 0xD5, 0xD5, 0xAE, 0x49, 0xAA, 0x10, 0x9C,
+    0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9A, 0x9A, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x10, 0x7A, 0xE5,
+    0x9C, 0xA5, 0xD5, 0xD5, 0xD5, 0xAC, 0x6E, 0x4A, 0xD3, 0x9C, 0xA4, 0xAC, 0x94, 0xAC, 0x94, 0xAC,
+    0x94, 0xD9, 0x2F, 0x3A, 0xAA, 0x30, 0x9C, 0x91, 0xAC, 0x9A, 0x90, 0xAC, 0x1A, 0xC9, 0x50, 0x09,
+    0x99, 0x1E, 0x1E, 0x1A, 0xCA, 0x7A, 0xC2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xAC, 0x2A, 0xC2,
+    0xAC, 0x2A, 0xC2, 0x9C, 0x50, 0x73, 0xC9, 0x5C, 0x95, 0xC4, 0xAE, 0xA1, 0xAE, 0xA9, 0x1D, 0x0C,
+    0x29, 0xC9, 0x0C, 0x29, 0xC9, 0x0C, 0x29, 0xC9, 0x0C, 0x29, 0xCA, 0x0C, 0x3D, 0xAC, 0x3A, 0xFC,
+    0x29, 0xF9, 0x29, 0xC6, 0xA2, 0x77, 0x99, 0x6F, 0xCA, 0x3D, 0x91, 0x9C, 0x92, 0xC9, 0x70, 0xC9,
+    0x70, 0xAA, 0x70, 0x9C, 0x71, 0xC9, 0x69, 0xAD, 0xAA, 0xA9, 0x29, 0xFE, 0x49, 0xC9, 0x7A, 0xC9,
+    0x59, 0xDA, 0x6F, 0xCA, 0xA9, 0x91, 0xFF, 0xC9, 0x0A, 0x92, 0x9A, 0x1F, 0xE1, 0x9C, 0x90, 0x9C,
+    0xA1, 0xAC, 0x2D, 0x1A, 0xC9, 0x09, 0xCA, 0x1A, 0xFD, 0x09, 0xDA, 0xCA, 0xAC, 0xA0, 0x94, 0x90,
+    0x73, 0xCA, 0x4D, 0x19, 0xCA, 0x2D, 0x3A, 0xCA, 0x0D, 0x94, 0xFA, 0x59, 0xE7, 0xDA, 0x93, 0x9F,
+    0xDA, 0x5D, 0x97, 0xD9, 0x7D, 0x99, 0x39, 0xFD, 0xA5, 0xD9, 0x7D, 0x77, 0x9C, 0x9C, 0x9C, 0x9C,
+    0x9C, 0x59, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x74, 0x9E, 0xA4, 0xC9, 0x19, 0xA2, 0x9A, 0x79,
+    0xC9, 0x7F, 0x93, 0xEA, 0xAD, 0x19, 0xC4, 0xC9, 0x09, 0xC3, 0x9C, 0x91, 0xFE, 0x3A, 0xF9, 0x6E,
+    0x6A, 0xD1, 0xAF, 0xDA, 0x1F, 0xDA, 0x73, 0x09, 0xA2, 0xAA, 0x1D, 0x90, 0x9D, 0x1D, 0xA0, 0xAD,
+    0x00, 0x1A, 0xAA, 0x2A, 0x09, 0x0A, 0x09, 0x0A, 0x29, 0xA0, 0xA2, 0xA9, 0x0A, 0xC9, 0x99, 0x0A,
+    0x90, 0x9A, 0x29, 0xA9, 0x10, 0x7E, 0x1A, 0x1C, 0x1A, 0x1C, 0x1C, 0x99, 0xC9, 0x09, 0xDA, 0x90,
+    0x39, 0x19, 0x29, 0xC9, 0x09, 0xC1, 0x9C, 0x90, 0xAC, 0x90, 0x9C, 0x90, 0xAC, 0x29, 0xD0, 0xAC,
+    0xA2, 0x9D, 0x0A, 0xCA, 0x29, 0xC9, 0x0A, 0xC3, 0x92, 0x90, 0xAA, 0xAA, 0x99, 0x90, 0xAF, 0xDA,
+    0x5C, 0xA5, 0xD5, 0xD0, 0x9A, 0xAA, 0xAA, 0xA9, 0xAF, 0xDA, 0x19, 0x99, 0x2A, 0x99, 0x9A, 0x09,
+    0x09, 0x09, 0x09, 0xA0, 0xAC, 0x90, 0xA9, 0x0A, 0x0A, 0x99, 0x0A, 0xA0, 0xAA, 0x29, 0xA9, 0x10,
+    0x69, 0xFC, 0x70, 0x72, 0x9E, 0x92, 0x9C, 0xA9, 0xAC, 0x91, 0xCA, 0x2A, 0xC1, 0xCA, 0x2A, 0xC1,
+    0xD2, 0xD1, 0x9F, 0xC9, 0x29, 0xE9, 0x10, 0x3A, 0x59, 0xC5, 0x9C, 0x2A, 0xFE, 0x29, 0xC5, 0x9C,
+    0x69, 0x72, 0x9F, 0xDA, 0x70, 0x09, 0xA4, 0xC3, 0xC2, 0xAA, 0x1A, 0xC1, 0x9E, 0x50, 0x09, 0x94,
+    0xA9, 0x39, 0x1A, 0xA3, 0xA9, 0x09, 0x0A, 0xA0, 0xE0, 0x0A, 0xA0, 0xC0, 0xAC, 0x09, 0x10, 0x0D,
+    0x4C, 0x90, 0xD4, 0xC9, 0x0D, 0x92, 0x9C, 0xA0, 0xD9, 0x29, 0xCA, 0x0D, 0x92, 0x9C, 0xA0, 0xDA,
+    0x29, 0xCA, 0x0E, 0x2A, 0xCA, 0x0F, 0xFA, 0x0C, 0xAF, 0xDA, 0x0C, 0x0A, 0xDA, 0x0D, 0x0C, 0x70,
+    0x97, 0x29, 0x29, 0x0A, 0xD9, 0x0A, 0xA9, 0xE1, 0xAA, 0xAE, 0x1A, 0xA9, 0xE1, 0xAA, 0x0E, 0x1A,
+    0xC1, 0xD1, 0xAC, 0x09, 0xD1, 0x9C, 0x09, 0xD1, 0x9C, 0x0A, 0xCA, 0x19, 0xC0, 0xDA, 0x19, 0xC0,
+    0xDA, 0x19, 0xC9, 0xDA, 0x19, 0xC9, 0xD9, 0x19, 0xC0, 0x0A, 0xC1, 0xD9, 0x0A, 0xA9, 0x39, 0x29,
+    0x9A, 0x2A, 0x0A, 0xC9, 0x00, 0x0A, 0xA3, 0xA3, 0xA3, 0xA3, 0xC1, 0x9E, 0x50, 0x1A, 0xA9, 0x1A,
+    0x90, 0xA1, 0xC1, 0x99, 0x0C, 0x1A, 0x90, 0x9E, 0x60, 0x92, 0xA3, 0xAC, 0x1D, 0x3A, 0xC9, 0x0A,
+    0xC3, 0x9C, 0x90, 0xAC, 0x2D, 0x99, 0xD1, 0xD9, 0x9D, 0x19, 0xC9, 0x0A, 0xC3, 0x91, 0x93, 0x77,
+    0x9C, 0xA7, 0x39, 0x9A, 0x74, 0x9A, 0x5C, 0x94, 0x9A, 0x49, 0xA5, 0xAA, 0x4C, 0x6A, 0xA3, 0xAA,
+    0x5A, 0xDA, 0x90, 0x9C, 0x6F, 0xA0, 0xC9, 0x2A, 0x7A, 0xC2, 0xAC, 0x7C, 0x91, 0x9D, 0x6C, 0xA2,
+    0xC0, 0xC5, 0x9C, 0x2C, 0x90, 0xC9, 0x4C, 0xA2, 0xFC, 0x92, 0xAC, 0x6C, 0x93, 0xA9, 0x6C, 0x90,
+    0x09, 0xCA, 0x73, 0x99, 0xA7, 0x49, 0xA5, 0xC9, 0x49, 0xA4, 0x9C, 0x5A, 0xA4, 0xC6, 0xAA, 0x3A,
+    0xA5, 0xAD, 0xA9, 0x1C, 0x9A, 0xD9, 0x1F, 0xA0, 0xC9, 0x99, 0x1C, 0x95, 0x9C, 0x4A, 0xA5, 0xC9,
+    0x4C, 0xA4, 0xAC, 0x4A, 0xC4, 0x9C, 0x4A, 0xC9, 0x4C, 0xA3, 0xDA, 0x4A, 0xC3, 0x9F, 0xA2, 0xC9,
+    0x39, 0xAA, 0xAA, 0x90, 0x9E, 0x97, 0x5A, 0x59, 0x6A, 0x4C, 0x93, 0x9D, 0xA3, 0x9A, 0x69, 0xC3,
+    0xC7, 0x0C, 0x91, 0xAA, 0x49, 0xAA, 0xD1, 0x9C, 0x5A, 0xE9, 0x1C, 0x92, 0xA7, 0xAC, 0x2A, 0xC7,
+    0xC9, 0x19, 0xD6, 0xCA, 0x2C, 0x0C, 0x59, 0xC2, 0xC9, 0x0C, 0x94, 0xCA, 0x2F, 0xC9, 0x2A, 0xC6,
+    0xC9, 0x3A, 0x96, 0xC9, 0x00, 0x3A, 0xA9, 0x6D, 0x96, 0xD7, 0x72, 0x97, 0xD9, 0x6D, 0x96, 0xD9,
+    0x5A, 0xD9, 0x4A, 0xD9, 0x49, 0xCA, 0x6D, 0x7C, 0xA6, 0x9C, 0x96, 0x9C, 0xA7, 0xD9, 0x29, 0x91,
+    0x9D, 0xAA, 0xAC, 0xA2, 0x9A, 0xE9, 0x73, 0x29, 0xA7, 0x3A, 0xC9, 0x72, 0xAC, 0x97, 0x77, 0x73,
+    0xAC, 0xA7, 0x1E, 0x70, 0x9E, 0x97, 0xD0, 0xCA, 0x7C, 0xA0, 0xD6, 0xAC, 0x90, 0x9C, 0x95, 0xD2,
+    0xD4, 0x9C, 0xA2, 0xD9, 0x3A, 0xC9, 0x29, 0xCA, 0x3D, 0x92, 0x9D, 0x29, 0xFF, 0xC9, 0x1F, 0xFE,
+    0x09, 0xD5, 0x9D, 0x0A, 0xD6, 0xDA, 0x6C, 0x72, 0xAA, 0x72, 0xC9, 0x72, 0x97, 0x77, 0x77, 0x77,
+    0x6A, 0xCA, 0x71, 0xE7, 0x09, 0xE9, 0x7D, 0x0C, 0xA7, 0xCA, 0x0D, 0x6A, 0xC9, 0x09, 0xC9, 0x5D,
+    0x2D, 0x49, 0xCA, 0x2D, 0x93, 0xAC, 0x92, 0x9C, 0xA3, 0xD9, 0x29, 0xD2, 0x9F, 0xFC, 0x91, 0xFF,
+    0xE0, 0x9D, 0x59, 0xD0, 0xAD, 0x6D, 0xA0, 0x77, 0x19, 0xC7, 0x19, 0xCA, 0xC7, 0x9A, 0x19, 0xC7,
+    0x77, 0x72, 0xAC, 0xA7, 0x1E, 0x70, 0x9E, 0x97, 0xD0, 0xCA, 0x7C, 0xA0, 0xD6, 0xAC, 0x90, 0x9C,
+    0x95, 0xD2, 0xD4, 0x9C, 0xA2, 0xD9, 0x3A, 0xC9, 0x29, 0xCA, 0x3D, 0x92, 0x9D, 0x29, 0xFF, 0xC9,
+    0x1F, 0xFE, 0x09, 0xD5, 0x9D, 0x0A, 0xD6, 0xDA, 0x3A, 0xA1, 0x99, 0x6C, 0x0C, 0x0A, 0x69, 0xA0,
+    0x9D, 0x77, 0x77, 0x2A, 0xCA, 0x71, 0xE7, 0x09, 0xE9, 0x7D, 0x0C, 0xA7, 0xCA, 0x0D, 0x6A, 0xC9,
+    0x09, 0xC9, 0x5D, 0x2D, 0x49, 0xCA, 0x2D, 0x93, 0xAC, 0x92, 0x9C, 0xA3, 0xD9, 0x29, 0xD2, 0x9F,
+    0xFC, 0x91, 0xFF, 0xE0, 0x9D, 0x59, 0xD0, 0xAD, 0x6D, 0xA0, 0x2A, 0xC9, 0x1D, 0x5D, 0x90, 0x9D,
+    0x5A, 0xA9, 0x09, 0xAA, 0x77, 0x77, 0x1A, 0xCA, 0x71, 0xE7, 0x09, 0xE9, 0x7D, 0x0C, 0xA7, 0xCA,
+    0x0D, 0x6A, 0xC9, 0x09, 0xC9, 0x5D, 0x2D, 0x49, 0xCA, 0x2D, 0x93, 0xAC, 0x92, 0x9C, 0xA3, 0xD9,
+    0x29, 0xD2, 0x9F, 0xFC, 0x91, 0xFF, 0xE0, 0x9D, 0x59, 0xD0, 0xAD, 0x6D, 0xA0, 0x49, 0xA9, 0x71,
+    0xA0, 0xA7, 0x1A, 0xCA, 0x77, 0x77, 0x77, 0x0A, 0xCA, 0x71, 0xE7, 0x09, 0xE9, 0x7D, 0x0C, 0xA7,
+    0xCA, 0x0D, 0x6A, 0xC9, 0x09, 0xC9, 0x5D, 0x2D, 0x49, 0xCA, 0x2D, 0x93, 0xAC, 0x92, 0x9C, 0xA3,
+    0xD9, 0x29, 0xD2, 0x9F, 0xFC, 0x91, 0xFF, 0xE0, 0x9D, 0x59, 0xD0, 0xAD, 0x6D, 0xA0, 0x77, 0x71,
+    0xAF, 0xFC, 0xA7, 0xFF, 0xCA, 0x96, 0xAF, 0x75, 0xCA, 0xAD, 0x74, 0xAC, 0x09, 0xD7, 0x39, 0xCA,
+    0x09, 0xD7, 0x3D, 0x2F, 0xDA, 0x59, 0xCA, 0x2F, 0xDA, 0x5D, 0x3D, 0x97, 0x09, 0xD3, 0xDA, 0x70,
+    0xFF, 0xD7, 0x9F, 0xFF, 0xE9, 0x1D, 0x94, 0xFF, 0xA0, 0xAD, 0x5F, 0xFC, 0x77, 0x30, 0x77, 0x1A,
+    0xF9, 0x39, 0xFD, 0x92, 0xAD, 0x96, 0x9D, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xCA, 0x70, 0xAC, 0x97,
+    0x0A, 0xCA, 0x70, 0xE7, 0x0A, 0xE7, 0x9F, 0xCA, 0xAD, 0x91, 0xFF, 0xC9, 0x2F, 0xF9, 0x3A, 0xFC,
+    0xA9, 0x6A, 0x72, 0xAA, 0xA7, 0x2A, 0x70, 0xCA, 0x20, 0x19, 0x70, 0x9C, 0x97, 0x9C, 0xA7, 0x77,
+    0x9F, 0xF0, 0x9F, 0xDA, 0x90, 0x9C, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAF, 0xD2, 0xAF,
+    0xD2, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xFF, 0xA0, 0xFF, 0xC0, 0xFF, 0xC0, 0x76, 0xC9, 0x69,
+    0xC7, 0xCA, 0x77, 0x77, 0x73, 0x9F, 0xF0, 0x9F, 0xDA, 0x90, 0x9C, 0x96, 0xAC, 0x96, 0xAC, 0x96,
+    0xAC, 0x96, 0xAF, 0xD2, 0xAF, 0xD2, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xFF, 0xA0, 0xFF, 0xC0,
+    0xFF, 0xC0, 0x3C, 0x96, 0xAD, 0x94, 0xA9, 0x1C, 0x97, 0x09, 0x73, 0x9F, 0xF0, 0x9F, 0xDA, 0x90,
+    0x9C, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAF, 0xD2, 0xAF, 0xD2, 0xAC, 0x96, 0xAC, 0x96,
+    0xAC, 0x96, 0xFF, 0xA0, 0xFF, 0xC0, 0xFF, 0xC0, 0x1A, 0xA1, 0x9A, 0x29, 0xD1, 0xD9, 0x1A, 0xD1,
+    0xDA, 0x77, 0x49, 0xFF, 0x09, 0xFD, 0xA9, 0x09, 0xC9, 0x6A, 0xC9, 0x6A, 0xC9, 0x6A, 0xC9, 0x6A,
+    0xFD, 0x2A, 0xFD, 0x2A, 0xC9, 0x6A, 0xC9, 0x6A, 0xC9, 0x6F, 0xFA, 0x0F, 0xFC, 0x0F, 0xFC, 0x00,
+    0x0A, 0x4A, 0xC9, 0x3A, 0xC9, 0x77, 0x4A, 0xD2, 0x9D, 0x29, 0xD2, 0x9D, 0x29, 0xD2, 0x9D, 0x29,
+    0xD2, 0x9D, 0x29, 0xD2, 0x9D, 0x29, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x90, 0x19, 0x2C, 0x1A, 0xA1,
+    0xC9, 0x77, 0x49, 0xCA, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D,
+    0x09, 0xD0, 0x9D, 0x0A, 0xD0, 0xAD, 0x0A, 0xD9, 0x70, 0x9C, 0x4E, 0x19, 0xC1, 0x9C, 0x77, 0x7A,
+    0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3,
+    0xAD, 0x3A, 0xD3, 0xAD, 0x90, 0x0A, 0xC9, 0x1D, 0x1D, 0x90, 0x9D, 0x1A, 0xA9, 0x09, 0xAA, 0x77,
+    0x76, 0xAD, 0x59, 0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x59, 0xD5,
+    0x9D, 0x5A, 0xD5, 0xAD, 0x5A, 0xD9, 0x10, 0x77, 0x2F, 0xEA, 0x7F, 0xFC, 0x6D, 0x39, 0xE5, 0xD5,
+    0xDA, 0x4D, 0x59, 0xD4, 0xD6, 0xD9, 0x1A, 0xAD, 0xAA, 0xA3, 0xAC, 0xA1, 0xFE, 0x3A, 0xD3, 0xD6,
+    0xAD, 0x3D, 0x59, 0xE3, 0xDA, 0xAA, 0xAA, 0xFA, 0x3F, 0xFE, 0x4F, 0xFD, 0x5F, 0xEA, 0x40, 0x3D,
+    0x90, 0xA9, 0x49, 0xA0, 0xC0, 0xA5, 0x9A, 0x09, 0xD7, 0x79, 0xA9, 0x49, 0xCA, 0x0E, 0x49, 0xCA,
+    0x0E, 0xA3, 0xAC, 0xA0, 0xF3, 0xAC, 0xA0, 0xFA, 0x2A, 0xCA, 0x0D, 0x9D, 0x2D, 0x90, 0xD0, 0xD9,
+    0x1D, 0x99, 0xD0, 0x9D, 0x1D, 0x99, 0xD1, 0xD9, 0x0D, 0x99, 0xD1, 0x9D, 0x0D, 0x9A, 0xD2, 0xDA,
+    0xD0, 0xAD, 0x29, 0xF0, 0xAD, 0x3F, 0x0E, 0x39, 0xE0, 0x3A, 0x97, 0x29, 0xCA, 0x72, 0x9A, 0xA7,
+    0x74, 0x9A, 0xEA, 0x94, 0xAD, 0xAA, 0xAD, 0xA2, 0xAD, 0x92, 0x9E, 0x1D, 0x94, 0x9D, 0x99, 0xD6,
+    0xDA, 0xAC, 0x96, 0x9F, 0x97, 0xF7, 0x0F, 0x97, 0xDA, 0xC9, 0x69, 0xCA, 0xAD, 0x95, 0xDA, 0x0F,
+    0xAA, 0xAF, 0x1A, 0xFF, 0xD2, 0xAF, 0xF4, 0x9A, 0xFA, 0x77, 0x6C, 0x72, 0x9C, 0x72, 0xCA, 0x72,
+    0x97, 0x77, 0x77, 0x79, 0xAE, 0xA9, 0x4A, 0xDA, 0xAA, 0xDA, 0x2A, 0xD9, 0x29, 0xE1, 0xD9, 0x49,
+    0xD9, 0x9D, 0x6D, 0xAA, 0xC9, 0x69, 0xF9, 0x7F, 0x70, 0xF9, 0x7D, 0xAC, 0x96, 0x9C, 0xAA, 0xD9,
+    0x5D, 0xA0, 0xFA, 0xAA, 0xF1, 0xAF, 0xFD, 0x2A, 0xFF, 0x49, 0xAF, 0xA7, 0x70, 0x77, 0x19, 0xC9,
+    0x70, 0x9C, 0xAC, 0x96, 0x9A, 0x2A, 0x97, 0x72, 0x9A, 0xEA, 0x94, 0xAD, 0xAA, 0xAD, 0xA2, 0xAD,
+    0x92, 0x9E, 0x1D, 0x94, 0x9D, 0x99, 0xD6, 0xDA, 0xAC, 0x96, 0x9F, 0x97, 0xF7, 0x0F, 0x97, 0xDA,
+    0xC9, 0x69, 0xCA, 0xAD, 0x95, 0xDA, 0x0F, 0xAA, 0xAF, 0x1A, 0xFF, 0xD2, 0xAF, 0xF4, 0x9A, 0xFA,
+    0x77, 0x39, 0xC9, 0x09, 0x96, 0xC0, 0xC9, 0x99, 0x6A, 0x1D, 0x77, 0x39, 0xAE, 0xA9, 0x4A, 0xDA,
+    0xAA, 0xDA, 0x2A, 0xD9, 0x29, 0xE1, 0xD9, 0x49, 0xD9, 0x9D, 0x6D, 0xAA, 0xC9, 0x69, 0xF9, 0x7F,
+    0x70, 0xF9, 0x7D, 0xAC, 0x96, 0x9C, 0xAA, 0xD9, 0x5D, 0xA0, 0xFA, 0xAA, 0xF1, 0xAF, 0xFD, 0x2A,
+    0xFF, 0x49, 0xAF, 0xA7, 0x70, 0x29, 0xC9, 0x1D, 0x5A, 0xCA, 0x1D, 0x5A, 0xAA, 0x1A, 0xA7, 0x72,
+    0x9A, 0xEA, 0x94, 0xAD, 0xAA, 0xAD, 0xA2, 0xAD, 0x92, 0x9E, 0x1D, 0x94, 0x9D, 0x99, 0xD6, 0xDA,
+    0xAC, 0x96, 0x9F, 0x97, 0xF7, 0x0F, 0x97, 0xDA, 0xC9, 0x69, 0xCA, 0xAD, 0x95, 0xDA, 0x0F, 0xAA,
+    0xAF, 0x1A, 0xFF, 0xD2, 0xAF, 0xF4, 0x9A, 0xFA, 0x77, 0x0A, 0x91, 0x99, 0x19, 0xCA, 0xD3, 0x9D,
+    0x4E, 0xA2, 0xD0, 0x9D, 0x00, 0x77, 0x39, 0x77, 0x19, 0xC9, 0x77, 0x1D, 0x77, 0x1A, 0xC7, 0x71,
+    0x9C, 0xA7, 0x71, 0xD7, 0x71, 0xAC, 0x97, 0x71, 0xD7, 0x39, 0xAE, 0xAD, 0x97, 0x2E, 0xAA, 0xF7,
+    0x2E, 0x3E, 0xA7, 0x09, 0xD3, 0xAF, 0x70, 0xAC, 0xA3, 0xD0, 0xD9, 0x7D, 0x3D, 0x90, 0xAC, 0xA7,
+    0xD2, 0x9D, 0x1A, 0xCA, 0x7D, 0x2D, 0x91, 0x9C, 0xA7, 0xD1, 0xAD, 0x29, 0xCA, 0x7D, 0x1D, 0x3A,
+    0xC9, 0x7F, 0xCA, 0x29, 0xD9, 0x79, 0xFA, 0xAA, 0xF7, 0x1F, 0xFD, 0x97, 0x1A, 0xFF, 0xA7, 0x2D,
+    0xAF, 0xC9, 0x72, 0xDA, 0x77, 0x09, 0xD7, 0x71, 0xDA, 0x77, 0x0A, 0xD7, 0x70, 0x9D, 0x97, 0x70,
+    0xDA, 0x77, 0x0A, 0xCA, 0x77, 0x19, 0x77, 0x20, 0x2C, 0xA7, 0x2D, 0x72, 0x9A, 0x77, 0x74, 0xE4,
+    0x9D, 0x9E, 0x49, 0xD9, 0xE4, 0x9D, 0x9A, 0xCA, 0x49, 0xD0, 0xAC, 0xA4, 0x9D, 0x0A, 0xCA, 0x5D,
+    0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x09, 0xD4, 0x9D, 0x09, 0xDA, 0x29, 0xE1,
+    0xFF, 0xCA, 0x1F, 0xFC, 0x92, 0xAF, 0xD9, 0x75, 0x5C, 0x97, 0x09, 0xC7, 0x1C, 0xA7, 0x19, 0x77,
+    0x77, 0x77, 0x5E, 0x49, 0xD9, 0xE4, 0x9D, 0x9E, 0x49, 0xD9, 0xAC, 0xA4, 0x9D, 0x0A, 0xCA, 0x49,
+    0xD0, 0xAC, 0xA5, 0xD0, 0xAC, 0xA5, 0xD0, 0xAC, 0xA5, 0xD0, 0xAC, 0xA5, 0xD0, 0x9D, 0x49, 0xD0,
+    0x9D, 0xA2, 0x9E, 0x1F, 0xFC, 0xA1, 0xFF, 0xC9, 0x2A, 0xFD, 0x97, 0x50, 0x49, 0x71, 0x9C, 0xA7,
+    0x9C, 0x9C, 0xA6, 0xA2, 0x99, 0x77, 0x72, 0xE4, 0x9D, 0x9E, 0x49, 0xD9, 0xE4, 0x9D, 0x9A, 0xCA,
+    0x49, 0xD0, 0xAC, 0xA4, 0x9D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA,
+    0x5D, 0x09, 0xD4, 0x9D, 0x09, 0xDA, 0x29, 0xE1, 0xFF, 0xCA, 0x1F, 0xFC, 0x92, 0xAF, 0xD9, 0x75,
+    0x19, 0xCA, 0x1D, 0x4A, 0xD1, 0xD9, 0x3A, 0xAA, 0x1A, 0xA9, 0x77, 0x71, 0xE4, 0x9D, 0x9E, 0x49,
+    0xD9, 0xE4, 0x9D, 0x9A, 0xCA, 0x49, 0xD0, 0xAC, 0xA4, 0x9D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D,
+    0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x09, 0xD4, 0x9D, 0x09, 0xDA, 0x29, 0xE1, 0xFF, 0xCA, 0x1F,
+    0xFC, 0x92, 0xAF, 0xD9, 0x75, 0x77, 0x1C, 0x97, 0x09, 0xC7, 0x1C, 0xA7, 0x77, 0x77, 0x77, 0x70,
+    0xAC, 0x95, 0xD9, 0x0D, 0x49, 0xD1, 0xAC, 0xA3, 0xD9, 0x2D, 0x29, 0xD3, 0xAD, 0x1D, 0x94, 0xD9,
+    0xAD, 0x5A, 0xF9, 0x6F, 0x7A, 0xD9, 0x7A, 0xD7, 0x0A, 0xD7, 0x0E, 0x70, 0xE7, 0x9E, 0x40, 0x0C,
+    0xA6, 0xCA, 0x95, 0xFA, 0x3C, 0xA0, 0x9D, 0x2C, 0xA2, 0xD1, 0xCA, 0x3C, 0x90, 0xCA, 0x29, 0xC9,
+    0x0C, 0xA1, 0xAD, 0x1D, 0xAD, 0xA2, 0xEA, 0x4C, 0xA6, 0xCA, 0x6C, 0xA5, 0x19, 0xDA, 0x93, 0xAC,
+    0x2C, 0x92, 0xC9, 0x3C, 0x2C, 0x29, 0xAC, 0x2C, 0x2C, 0x39, 0xC9, 0x09, 0xA3, 0x9C, 0x90, 0x9C,
+    0x39, 0xC9, 0x1D, 0x91, 0x9C, 0x92, 0xAC, 0x90, 0x9C, 0x93, 0xAC, 0x0A, 0xC9, 0x3D, 0x0A, 0xCA,
+    0xAF, 0xA0, 0xAC, 0xA9, 0xEA, 0x10, 0x19, 0x70, 0xAC, 0x97, 0xAC, 0xA7, 0x70, 0xE9, 0xC3, 0xDA,
+    0xAD, 0x91, 0xD2, 0xAC, 0x91, 0xC9, 0x29, 0xC9, 0x09, 0xC4, 0xCA, 0x09, 0xC4, 0xCA, 0x09, 0xC3,
+    0xAD, 0x1D, 0xAA, 0xF1, 0xAF, 0xE2, 0xAD, 0xA9, 0xAC, 0x00, 0x76, 0xC7, 0xAA, 0x7C, 0x97, 0x77,
+    0x74, 0xE9, 0xC3, 0xDA, 0xAD, 0x91, 0xD2, 0xAC, 0x91, 0xC9, 0x29, 0xC9, 0x09, 0xC4, 0xCA, 0x09,
+    0xC4, 0xCA, 0x09, 0xC3, 0xAD, 0x1D, 0xAA, 0xF1, 0xAF, 0xE2, 0xAD, 0xA9, 0xAC, 0x00, 0x75, 0xC9,
+    0x6E, 0x5C, 0x90, 0x9C, 0x77, 0xE9, 0xC3, 0xDA, 0xAD, 0x91, 0xD2, 0xAC, 0x91, 0xC9, 0x29, 0xC9,
+    0x09, 0xC4, 0xCA, 0x09, 0xC4, 0xCA, 0x09, 0xC3, 0xAD, 0x1D, 0xAA, 0xF1, 0xAF, 0xE2, 0xAD, 0xA9,
+    0xAC, 0x00, 0x1A, 0xC9, 0x09, 0x93, 0xC0, 0xC0, 0xA9, 0x29, 0xC1, 0xD7, 0x7E, 0x9C, 0x3D, 0xAA,
+    0xD9, 0x1D, 0x2A, 0xC9, 0x1C, 0x92, 0x9C, 0x90, 0x9C, 0x4C, 0xA0, 0x9C, 0x4C, 0xA0, 0x9C, 0x3A,
+    0xD1, 0xDA, 0xAF, 0x1A, 0xFE, 0x2A, 0xDA, 0x9A, 0xC0, 0x09, 0xA9, 0x1A, 0xA2, 0xAC, 0xA1, 0xD2,
+    0xDA, 0x09, 0xD7, 0x6E, 0x9C, 0x3D, 0xAA, 0xD9, 0x1D, 0x2A, 0xC9, 0x1C, 0x92, 0x9C, 0x90, 0x9C,
+    0x4C, 0xA0, 0x9C, 0x4C, 0xA0, 0x9C, 0x3A, 0xD1, 0xDA, 0xAF, 0x1A, 0xFE, 0x2A, 0xDA, 0x9A, 0xC0,
+    0x29, 0xAA, 0x6A, 0x0A, 0x6A, 0x0A, 0x69, 0xCA, 0x77, 0x0E, 0x9C, 0x3D, 0xAA, 0xD9, 0x1D, 0x2A,
+    0xC9, 0x1C, 0x92, 0x9C, 0x90, 0x9C, 0x4C, 0xA0, 0x9C, 0x4C, 0xA0, 0x9C, 0x3A, 0xD1, 0xDA, 0xAF,
+    0x1A, 0xFE, 0x2A, 0xDA, 0x9A, 0xC0, 0x77, 0x2E, 0x9C, 0x09, 0xEA, 0x3D, 0xAA, 0xF9, 0x1A, 0xA1,
+    0xD2, 0xAD, 0x4C, 0x1C, 0x92, 0x9D, 0x9A, 0xAE, 0xA9, 0xC4, 0xFA, 0xAA, 0xA9, 0x9C, 0x4C, 0xA6,
+    0x9C, 0x3A, 0xD7, 0xDA, 0xAF, 0xCA, 0x91, 0x99, 0x0A, 0xFF, 0xFC, 0x91, 0xAD, 0xA9, 0xAC, 0x9F,
+    0xA0, 0x71, 0x9E, 0xA1, 0xAD, 0x99, 0x91, 0xD4, 0x9C, 0x94, 0x9C, 0x94, 0x9C, 0x94, 0x9C, 0xA5,
+    0xDA, 0x4A, 0xFC, 0x29, 0xF9, 0x3A, 0x96, 0x99, 0x59, 0x93, 0x9C, 0xA1, 0x19, 0x70, 0x9C, 0x97,
+    0x9C, 0xA7, 0x77, 0x74, 0xAD, 0xA4, 0xD9, 0x09, 0xC2, 0xAA, 0x3A, 0xA1, 0xCA, 0x9A, 0xAE, 0x09,
+    0xFA, 0xAA, 0xA0, 0x9C, 0x70, 0xCA, 0x7E, 0x91, 0x9A, 0x2F, 0xE3, 0xAE, 0xA9, 0x00, 0x76, 0xC9,
+    0x69, 0xC7, 0xD7, 0x77, 0x77, 0x77, 0x0A, 0xDA, 0x4D, 0x90, 0x9C, 0x2A, 0xA3, 0xAA, 0x1C, 0xA9,
+    0xAA, 0xE0, 0x9F, 0xAA, 0xAA, 0x09, 0xC7, 0x0C, 0xA7, 0xE9, 0x19, 0xA2, 0xFE, 0x3A, 0xEA, 0x90,
+    0x3A, 0x96, 0xAD, 0x59, 0xA0, 0x9C, 0x49, 0x39, 0x77, 0x70, 0xAD, 0xA4, 0xD9, 0x09, 0xC2, 0xAA,
+    0x3A, 0xA1, 0xCA, 0x9A, 0xAE, 0x09, 0xFA, 0xAA, 0xA0, 0x9C, 0x70, 0xCA, 0x7E, 0x91, 0x9A, 0x2F,
+    0xE3, 0xAE, 0xA9, 0x00, 0x1A, 0xA1, 0x9A, 0x29, 0xD1, 0xD9, 0x1A, 0xD1, 0xDA, 0x77, 0x77, 0x1A,
+    0xDA, 0x4D, 0x90, 0x9C, 0x2A, 0xA3, 0xAA, 0x1C, 0xA9, 0xAA, 0xE0, 0x9F, 0xAA, 0xAA, 0x09, 0xC7,
+    0x0C, 0xA7, 0xE9, 0x19, 0xA2, 0xFE, 0x3A, 0xEA, 0x90, 0x0A, 0x93, 0x9C, 0xA3, 0x9C, 0xA7, 0x7C,
+    0x93, 0xC9, 0x3C, 0x93, 0xC9, 0x3C, 0x93, 0xCA, 0x3C, 0xA3, 0xCA, 0x29, 0xD0, 0x5C, 0x90, 0x9C,
+    0x1C, 0xA7, 0x71, 0xC9, 0x1C, 0x91, 0xC9, 0x1C, 0x91, 0xC9, 0x1C, 0xA1, 0xCA, 0x1C, 0xA0, 0x9D,
+    0x00, 0x71, 0xC9, 0x3C, 0xAC, 0x91, 0xC9, 0x1C, 0x97, 0x70, 0xC9, 0x4C, 0x94, 0xC9, 0x4C, 0x94,
+    0xC9, 0x4C, 0xA4, 0xCA, 0x4C, 0xA3, 0x9D, 0x10, 0x0A, 0xC9, 0x1D, 0x1D, 0xA0, 0x9D, 0x1A, 0xA9,
+    0x09, 0xAA, 0x77, 0x6C, 0x96, 0xC9, 0x6C, 0x96, 0xC9, 0x6C, 0x96, 0xCA, 0x6C, 0xA6, 0xCA, 0x59,
+    0xD2, 0x77, 0x2D, 0x97, 0x2A, 0xC7, 0x0A, 0xAD, 0xAA, 0xA5, 0xFE, 0x49, 0x2C, 0x5F, 0x99, 0xC4,
+    0xD1, 0x9C, 0xAC, 0x39, 0xC9, 0x2A, 0xCA, 0x3A, 0xC3, 0x9C, 0x93, 0xAC, 0x39, 0xC4, 0x9D, 0x90,
+    0x9C, 0xA5, 0xFD, 0x7A, 0xDA, 0x95, 0x2D, 0x1A, 0x39, 0xA0, 0xC0, 0xC3, 0x99, 0x09, 0xCA, 0x77,
+    0x09, 0x4F, 0xD9, 0x2D, 0xA1, 0xAC, 0x2D, 0x3C, 0x91, 0xD3, 0xCA, 0x1D, 0x3C, 0xA1, 0xD3, 0xD0,
+    0x9D, 0x3D, 0x09, 0xD3, 0xD0, 0x9D, 0x29, 0xD0, 0x19, 0x70, 0x9C, 0x97, 0x9C, 0xA7, 0x77, 0x73,
+    0x9A, 0xDA, 0x39, 0xDA, 0xAD, 0x2C, 0xA3, 0xCA, 0x1C, 0x93, 0xAC, 0x09, 0xC4, 0x9C, 0x09, 0xC9,
+    0x39, 0xC1, 0xCA, 0x3A, 0xC1, 0xDA, 0xAA, 0xDA, 0x19, 0xFD, 0x39, 0xAD, 0xA2, 0x76, 0xC9, 0x69,
+    0xC7, 0xCA, 0x77, 0x77, 0x77, 0x79, 0xAD, 0xA3, 0x9D, 0xAA, 0xD2, 0xCA, 0x3C, 0xA1, 0xC9, 0x3A,
+    0xC0, 0x9C, 0x49, 0xC0, 0x9C, 0x93, 0x9C, 0x1C, 0xA3, 0xAC, 0x1D, 0xAA, 0xAD, 0xA1, 0x9F, 0xD3,
+    0x9A, 0xDA, 0x20, 0x3C, 0x96, 0xAD, 0x5A, 0xA1, 0xC7, 0x19, 0x77, 0x79, 0xAD, 0xA3, 0x9D, 0xAA,
+    0xD2, 0xCA, 0x3C, 0xA1, 0xC9, 0x3A, 0xC0, 0x9C, 0x49, 0xC0, 0x9C, 0x93, 0x9C, 0x1C, 0xA3, 0xAC,
+    0x1D, 0xAA, 0xAD, 0xA1, 0x9F, 0xD3, 0x9A, 0xDA, 0x20, 0x19, 0xC9, 0x1A, 0x3C, 0x0A, 0x90, 0xA3,
+    0xC1, 0xAC, 0x97, 0x77, 0x71, 0x9A, 0xDA, 0x39, 0xDA, 0xAD, 0x2C, 0xA3, 0xCA, 0x1C, 0x93, 0xAC,
+    0x09, 0xC4, 0x9C, 0x09, 0xC9, 0x39, 0xC1, 0xCA, 0x3A, 0xC1, 0xDA, 0xAA, 0xDA, 0x19, 0xFD, 0x39,
+    0xAD, 0xA2, 0x1A, 0xA1, 0x9A, 0x29, 0xD1, 0xD9, 0x1A, 0xD1, 0xDA, 0x77, 0x77, 0x09, 0xAD, 0xA3,
+    0x9D, 0xAA, 0xD2, 0xCA, 0x3C, 0xA1, 0xC9, 0x3A, 0xC0, 0x9C, 0x49, 0xC0, 0x9C, 0x93, 0x9C, 0x1C,
+    0xA3, 0xAC, 0x1D, 0xAA, 0xAD, 0xA1, 0x9F, 0xD3, 0x9A, 0xDA, 0x20, 0x3D, 0x70, 0xD7, 0x0A, 0xA7,
+    0x75, 0x99, 0x99, 0x09, 0xFF, 0xC7, 0x7A, 0xA7, 0x0D, 0x79, 0xD9, 0x30, 0x7A, 0x7A, 0xC7, 0xCA,
+    0x7C, 0x79, 0xC7, 0xAA, 0x7C, 0x96, 0x9C, 0x49, 0xAE, 0x39, 0xDA, 0xE2, 0xCA, 0x1C, 0x9D, 0x1C,
+    0x90, 0xAC, 0x0A, 0xC0, 0x9C, 0x1D, 0x09, 0xC0, 0x9C, 0x1C, 0xA0, 0x9C, 0x09, 0xCA, 0x9C, 0x90,
+    0xAC, 0x1F, 0xAA, 0xCA, 0x19, 0xFD, 0x39, 0xEA, 0x4A, 0xC7, 0xD7, 0xCA, 0x69, 0xC9, 0x6A, 0xC7,
+    0xD6, 0x9C, 0x96, 0xA9, 0x77, 0x10, 0x72, 0xCA, 0x7D, 0x70, 0x97, 0x39, 0xC4, 0xC9, 0x9C, 0x4C,
+    0x99, 0xC9, 0x29, 0xCA, 0x9C, 0x92, 0x9C, 0xA0, 0xC9, 0x29, 0xCA, 0x0C, 0xA2, 0x9C, 0xA0, 0xD2,
+    0xAC, 0xA0, 0xFE, 0xA0, 0xAF, 0xDA, 0x1A, 0xDA, 0x0D, 0x49, 0x69, 0xC6, 0xCA, 0x59, 0xC7, 0x77,
+    0x77, 0x9C, 0x4C, 0x99, 0xC4, 0xC9, 0x9C, 0x92, 0x9C, 0xA9, 0xC9, 0x29, 0xCA, 0x0C, 0x92, 0x9C,
+    0xA0, 0xCA, 0x29, 0xCA, 0x0D, 0x2A, 0xCA, 0x0F, 0xEA, 0x0A, 0xFD, 0xA1, 0xAD, 0xA0, 0xD0, 0x3A,
+    0x6D, 0xA4, 0xC9, 0x0A, 0xA2, 0x93, 0x97, 0x29, 0xC4, 0xC9, 0x9C, 0x4C, 0x99, 0xC9, 0x29, 0xCA,
+    0x9C, 0x92, 0x9C, 0xA0, 0xC9, 0x29, 0xCA, 0x0C, 0xA2, 0x9C, 0xA0, 0xD2, 0xAC, 0xA0, 0xFE, 0xA0,
+    0xAF, 0xDA, 0x1A, 0xDA, 0x0D, 0x09, 0xA2, 0xAA, 0x1D, 0x90, 0x9D, 0x1D, 0xA0, 0xAD, 0x77, 0x29,
+    0xC4, 0xC9, 0x9C, 0x4C, 0x99, 0xC9, 0x29, 0xCA, 0x9C, 0x92, 0x9C, 0xA0, 0xC9, 0x29, 0xCA, 0x0C,
+    0xA2, 0x9C, 0xA0, 0xD2, 0xAC, 0xA0, 0xFE, 0xA0, 0xAF, 0xDA, 0x1A, 0xDA, 0x0D, 0x49, 0xA7, 0xC9,
+    0x69, 0xC7, 0x77, 0x77, 0x77, 0x70, 0xC9, 0x39, 0xC9, 0x0D, 0x3A, 0xC1, 0x9C, 0xA2, 0xD2, 0xD2,
+    0xCA, 0x29, 0xCA, 0x0A, 0xC9, 0x3D, 0x0D, 0x49, 0xF5, 0xEA, 0x59, 0xDA, 0x59, 0xD9, 0x59, 0xD5,
+    0x9D, 0xA3, 0xFC, 0x4E, 0xA7, 0x60, 0x7A, 0xC5, 0xAC, 0x5A, 0xC5, 0xAE, 0x92, 0xAC, 0x09, 0xD1,
+    0xAC, 0x2C, 0xA0, 0xAC, 0x29, 0xC0, 0xAC, 0x29, 0xC0, 0xAC, 0x2C, 0xA0, 0xAC, 0x1A, 0xC1, 0x9C,
+    0x9D, 0x91, 0x9D, 0xA3, 0x9C, 0x59, 0xC5, 0x9C, 0x59, 0xC5, 0x1D, 0x19, 0xCA, 0x2D, 0x1A, 0xCA,
+    0x19, 0xAA, 0x1A, 0xAA, 0x77, 0x77, 0xC9, 0x39, 0xC9, 0x0D, 0x3A, 0xC1, 0x9C, 0xA2, 0xD2, 0xD2,
+    0xCA, 0x29, 0xCA, 0x0A, 0xC9, 0x3D, 0x0D, 0x49, 0xF5, 0xEA, 0x59, 0xDA, 0x59, 0xD9, 0x59, 0xD5,
+    0x9D, 0xA3, 0xFC, 0x4E, 0xA7, 0x60, 0x77, 0xAF, 0xD5, 0x99, 0x97, 0x77, 0x75, 0xAC, 0xA7, 0x1E,
+    0x70, 0x9E, 0x97, 0xD0, 0xCA, 0x7C, 0xA0, 0xD6, 0xAC, 0x90, 0x9C, 0x95, 0xD2, 0xD4, 0x9C, 0xA2,
+    0xD9, 0x3A, 0xC9, 0x29, 0xCA, 0x3D, 0x92, 0x9D, 0x29, 0xFF, 0xC9, 0x1F, 0xFE, 0x09, 0xD5, 0x9D,
+    0x0A, 0xD6, 0xDA, 0x72, 0xAF, 0xD2, 0x99, 0x99, 0x77, 0x1E, 0x9C, 0x3D, 0xAA, 0xD9, 0x1D, 0x2A,
+    0xC9, 0x1C, 0x92, 0x9C, 0x90, 0x9C, 0x4C, 0xA0, 0x9C, 0x4C, 0xA0, 0x9C, 0x3A, 0xD1, 0xDA, 0xAF,
+    0x1A, 0xFE, 0x2A, 0xDA, 0x9A, 0xC0, 0x77, 0xA9, 0x2A, 0xA5, 0x9D, 0xAA, 0xC7, 0x9E, 0x97, 0x77,
+    0x77, 0x7A, 0xCA, 0x71, 0xE7, 0x09, 0xE9, 0x7D, 0x0C, 0xA7, 0xCA, 0x0D, 0x6A, 0xC9, 0x09, 0xC9,
+    0x5D, 0x2D, 0x49, 0xCA, 0x2D, 0x93, 0xAC, 0x92, 0x9C, 0xA3, 0xD9, 0x29, 0xD2, 0x9F, 0xFC, 0x91,
+    0xFF, 0xE0, 0x9D, 0x59, 0xD0, 0xAD, 0x6D, 0xA0, 0x72, 0xAA, 0x29, 0xA3, 0xDA, 0xAC, 0x93, 0x9E,
+    0x97, 0x77, 0x1E, 0x9C, 0x3D, 0xAA, 0xD9, 0x1D, 0x2A, 0xC9, 0x1C, 0x92, 0x9C, 0x90, 0x9C, 0x4C,
+    0xA0, 0x9C, 0x4C, 0xA0, 0x9C, 0x3A, 0xD1, 0xDA, 0xAF, 0x1A, 0xFE, 0x2A, 0xDA, 0x9A, 0xC0, 0x4A,
+    0xCA, 0x71, 0xE7, 0x09, 0xE9, 0x7D, 0x0C, 0xA7, 0xCA, 0x0D, 0x6A, 0xC9, 0x09, 0xC9, 0x5D, 0x2D,
+    0x49, 0xCA, 0x2D, 0x93, 0xAC, 0x92, 0x9C, 0xA3, 0xD9, 0x29, 0xD2, 0x9F, 0xFC, 0x91, 0xFF, 0xE0,
+    0x9D, 0x59, 0xD0, 0xAD, 0x6D, 0xA7, 0x1C, 0x72, 0xC7, 0x3C, 0x73, 0x9D, 0x75, 0x74, 0xE9, 0xC3,
+    0xDA, 0xAD, 0x91, 0xD2, 0xAC, 0x91, 0xC9, 0x29, 0xC9, 0x09, 0xC4, 0xCA, 0x09, 0xC4, 0xCA, 0x09,
+    0xC3, 0xAD, 0x1D, 0xAA, 0xF1, 0xAF, 0xE2, 0xAD, 0xA9, 0xAC, 0x69, 0xA7, 0xA9, 0x79, 0xD7, 0x20,
+    0x77, 0x2C, 0x71, 0xAC, 0x71, 0xC9, 0x77, 0x77, 0x77, 0x71, 0xAF, 0x93, 0x9F, 0xD9, 0x2A, 0xD9,
+    0x69, 0xD7, 0x0D, 0x97, 0x9D, 0x70, 0xAC, 0xA7, 0x0A, 0xC9, 0x70, 0xAC, 0xA7, 0x0E, 0x70, 0xAE,
+    0x79, 0xFC, 0xAA, 0xD9, 0x1F, 0xFC, 0x92, 0xFF, 0x93, 0xAF, 0xCA, 0x97, 0x30, 0x4C, 0x5A, 0xA5,
+    0xC9, 0x59, 0x77, 0x49, 0xEA, 0x1A, 0xD9, 0x99, 0x1D, 0x49, 0xC9, 0x49, 0xC9, 0x49, 0xC9, 0x49,
+    0xCA, 0x5D, 0xA4, 0xAF, 0xC2, 0x9A, 0xE9, 0x70, 0x5C, 0x97, 0x0E, 0x7C, 0x90, 0x9C, 0x77, 0x77,
+    0x74, 0xAF, 0x93, 0x9F, 0xD9, 0x2A, 0xD9, 0x69, 0xD7, 0x0D, 0x97, 0x9D, 0x70, 0xAC, 0xA7, 0x0A,
+    0xC9, 0x70, 0xAC, 0xA7, 0x0E, 0x70, 0xAE, 0x79, 0xFC, 0xAA, 0xD9, 0x1F, 0xFC, 0x92, 0xFF, 0x93,
+    0xAF, 0xCA, 0x97, 0x30, 0x39, 0x5A, 0xC9, 0x3A, 0xA9, 0xC9, 0x19, 0x92, 0xA7, 0x29, 0xEA, 0x1A,
+    0xD9, 0x99, 0x1D, 0x49, 0xC9, 0x49, 0xC9, 0x49, 0xC9, 0x49, 0xCA, 0x5D, 0xA4, 0xAF, 0xC2, 0x9A,
+    0xE9, 0x70, 0x5A, 0x97, 0x09, 0xD7, 0x0A, 0xD7, 0x77, 0x77, 0x77, 0x1A, 0xF9, 0x39, 0xFD, 0x92,
+    0xAD, 0x96, 0x9D, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xCA, 0x70, 0xAC, 0x97, 0x0A, 0xCA, 0x70, 0xE7,
+    0x0A, 0xE7, 0x9F, 0xCA, 0xAD, 0x91, 0xFF, 0xC9, 0x2F, 0xF9, 0x3A, 0xFC, 0xA9, 0x73, 0x2A, 0xC9,
+    0x4A, 0xCA, 0x4A, 0xAA, 0x77, 0x39, 0xEA, 0x1A, 0xD9, 0x99, 0x1D, 0x49, 0xC9, 0x49, 0xC9, 0x49,
+    0xC9, 0x49, 0xCA, 0x5D, 0xA4, 0xAF, 0xC2, 0x9A, 0xE9, 0x70, 0x77, 0xC9, 0x1C, 0x96, 0xCA, 0xC9,
+    0x70, 0xC9, 0x77, 0x77, 0x77, 0x71, 0xAF, 0x93, 0x9F, 0xD9, 0x2A, 0xD9, 0x69, 0xD7, 0x0D, 0x97,
+    0x9D, 0x70, 0xAC, 0xA7, 0x0A, 0xC9, 0x70, 0xAC, 0xA7, 0x0E, 0x70, 0xAE, 0x79, 0xFC, 0xAA, 0xD9,
+    0x1F, 0xFC, 0x92, 0xFF, 0x93, 0xAF, 0xCA, 0x97, 0x30, 0x09, 0x92, 0x92, 0xAA, 0x0C, 0x93, 0xAC,
+    0xA5, 0xA7, 0x74, 0x9E, 0xA1, 0xAD, 0x99, 0x91, 0xD4, 0x9C, 0x94, 0x9C, 0x94, 0x9C, 0x94, 0x9C,
+    0xA5, 0xDA, 0x4A, 0xFC, 0x29, 0xAE, 0x97, 0x76, 0x9A, 0x19, 0xC7, 0x9C, 0xAC, 0x71, 0xAC, 0x77,
+    0x77, 0x75, 0xFE, 0xA4, 0xFF, 0xC3, 0xD3, 0x9E, 0x2D, 0x5D, 0xA1, 0xD6, 0xD1, 0xD6, 0xDA, 0x0D,
+    0x6A, 0xD0, 0xD6, 0xAD, 0x0D, 0x6A, 0xD0, 0xD5, 0x9E, 0x0D, 0xAA, 0xAA, 0xAF, 0xA0, 0xFF, 0xE1,
+    0xFF, 0xD2, 0xFE, 0xA4, 0x7C, 0x97, 0x2C, 0x90, 0x99, 0x7C, 0x90, 0xAA, 0x7C, 0x90, 0xCA, 0x7C,
+    0x90, 0xCA, 0x2A, 0xD9, 0x0C, 0x94, 0xFC, 0xAC, 0x93, 0xAC, 0x2A, 0xD4, 0xC9, 0x3D, 0x39, 0xC4,
+    0xD3, 0x9C, 0x4D, 0x39, 0xCA, 0x29, 0xD4, 0xEA, 0xF4, 0x9F, 0xE5, 0x9A, 0xDA, 0x9C, 0x97, 0x70,
+    0x77, 0x2F, 0xEA, 0x7F, 0xFC, 0x6D, 0x39, 0xE5, 0xD5, 0xDA, 0x4D, 0x59, 0xD4, 0xD6, 0xD9, 0x1A,
+    0xAD, 0xAA, 0xA3, 0xAC, 0xA1, 0xFE, 0x3A, 0xD3, 0xD6, 0xAD, 0x3D, 0x59, 0xE3, 0xDA, 0xAA, 0xAA,
+    0xFA, 0x3F, 0xFE, 0x4F, 0xFD, 0x5F, 0xEA, 0x40, 0x7C, 0x97, 0x2C, 0x97, 0xAA, 0xAD, 0xAA, 0x5F,
+    0xE7, 0x0C, 0x95, 0xAD, 0x90, 0xC9, 0x4F, 0xCA, 0xC9, 0x3A, 0xC2, 0xAD, 0x4C, 0x93, 0xD3, 0x9C,
+    0x4D, 0x39, 0xC4, 0xD3, 0x9C, 0xA2, 0x9D, 0x4E, 0xAF, 0x49, 0xFE, 0x59, 0xAD, 0xA9, 0xC9, 0x77,
+    0x72, 0x9F, 0xD9, 0x19, 0x99, 0x97, 0x77, 0x09, 0xFF, 0x09, 0xFD, 0xA9, 0x09, 0xC9, 0x6A, 0xC9,
+    0x6A, 0xC9, 0x6A, 0xC9, 0x6A, 0xFD, 0x2A, 0xFD, 0x2A, 0xC9, 0x6A, 0xC9, 0x6A, 0xC9, 0x6F, 0xFA,
+    0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x59, 0x92, 0x9F, 0xD9, 0x77, 0x77, 0x1A, 0xDA, 0x4D, 0x90, 0x9C,
+    0x2A, 0xA3, 0xAA, 0x1C, 0xA9, 0xAA, 0xE0, 0x9F, 0xAA, 0xAA, 0x09, 0xC7, 0x0C, 0xA7, 0xE9, 0x19,
+    0xA2, 0xFE, 0x3A, 0xEA, 0x90, 0x72, 0x9C, 0x3C, 0x3D, 0xAA, 0xD4, 0xAD, 0xA7, 0x77, 0x70, 0x9F,
+    0xF0, 0x9F, 0xDA, 0x90, 0x9C, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAF, 0xD2, 0xAF, 0xD2,
+    0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xFF, 0xA0, 0xFF, 0xC0, 0xFF, 0xC0, 0x1C, 0x92, 0xC3, 0xC9,
+    0x19, 0xC3, 0x9F, 0x6A, 0x97, 0x77, 0x74, 0xAD, 0xA4, 0xD9, 0x09, 0xC2, 0xAA, 0x3A, 0xA1, 0xCA,
+    0x9A, 0xAE, 0x09, 0xFA, 0xAA, 0xA0, 0x9C, 0x70, 0xCA, 0x7E, 0x91, 0x9A, 0x2F, 0xE3, 0xAE, 0xA9,
+    0x00, 0x3A, 0xA7, 0xD6, 0x9D, 0x77, 0x77, 0x19, 0xFF, 0x09, 0xFD, 0xA9, 0x09, 0xC9, 0x6A, 0xC9,
+    0x6A, 0xC9, 0x6A, 0xC9, 0x6A, 0xFD, 0x2A, 0xFD, 0x2A, 0xC9, 0x6A, 0xC9, 0x6A, 0xC9, 0x6F, 0xFA,
+    0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3D, 0x7D, 0x69, 0xAA, 0x77, 0x77, 0x4A, 0xDA, 0x4D, 0x90, 0x9C,
+    0x2A, 0xA3, 0xAA, 0x1C, 0xA9, 0xAA, 0xE0, 0x9F, 0xAA, 0xAA, 0x09, 0xC7, 0x0C, 0xA7, 0xE9, 0x19,
+    0xA2, 0xFE, 0x3A, 0xEA, 0x90, 0x71, 0x9F, 0xF0, 0x9F, 0xDA, 0x90, 0x9C, 0x96, 0xAC, 0x96, 0xAC,
+    0x96, 0xAC, 0x96, 0xAF, 0xD2, 0xAF, 0xD2, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xFF, 0xA0, 0xFF,
+    0xC0, 0xFF, 0xC3, 0x9A, 0x7C, 0x70, 0x9D, 0x75, 0x2A, 0xDA, 0x4D, 0x90, 0x9C, 0x2A, 0xA3, 0xAA,
+    0x1C, 0xA9, 0xAA, 0xE0, 0x9F, 0xAA, 0xAA, 0x09, 0xC7, 0x0C, 0xA7, 0xE9, 0x19, 0x91, 0x9F, 0xE3,
+    0xAE, 0xA9, 0x49, 0xA7, 0xA7, 0xAA, 0x70, 0xAC, 0x97, 0x40, 0x73, 0xA9, 0x1A, 0xA4, 0xAA, 0xCA,
+    0x6C, 0xA7, 0x77, 0x71, 0x9F, 0xF0, 0x9F, 0xDA, 0x90, 0x9C, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAC,
+    0x96, 0xAF, 0xD2, 0xAF, 0xD2, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xFF, 0xA0, 0xFF, 0xC0, 0xFF,
+    0xC0, 0x1A, 0x91, 0x9A, 0x4C, 0xAA, 0xA6, 0xD7, 0x77, 0x77, 0x6A, 0xDA, 0x4D, 0x90, 0x9C, 0x2A,
+    0xA3, 0xAA, 0x1C, 0xA9, 0xAA, 0xE0, 0x9F, 0xAA, 0xAA, 0x09, 0xC7, 0x0C, 0xA7, 0xE9, 0x19, 0xA2,
+    0xFE, 0x3A, 0xEA, 0x90, 0x77, 0x4C, 0xA7, 0x2C, 0xAC, 0xA7, 0x0A, 0x2A, 0xA7, 0x76, 0x99, 0xA9,
+    0x95, 0xAF, 0xF3, 0xAD, 0xA9, 0x39, 0x3D, 0xA7, 0x1A, 0xD7, 0x2A, 0xCA, 0x72, 0xDA, 0x72, 0xDA,
+    0x72, 0xDA, 0x3A, 0xFA, 0x0A, 0xCA, 0x49, 0x9E, 0x0A, 0xD6, 0xCA, 0x19, 0xE9, 0x39, 0xD2, 0xFF,
+    0xE3, 0xFF, 0xD4, 0xAF, 0xCA, 0x91, 0x3A, 0x95, 0x9D, 0x49, 0xC0, 0x9C, 0x39, 0x39, 0x73, 0x9D,
+    0xA0, 0xD0, 0x9F, 0xE0, 0xCA, 0x19, 0xE9, 0xC3, 0xDA, 0x9C, 0x3A, 0xCA, 0x9C, 0x3A, 0xCA, 0x9C,
+    0x3D, 0xA0, 0xDA, 0xAE, 0xA0, 0x9F, 0xDA, 0x19, 0xDA, 0x9C, 0x95, 0xD9, 0x09, 0x91, 0xAD, 0x1F,
+    0xDA, 0x1A, 0xFA, 0x72, 0x71, 0x96, 0x9C, 0x3C, 0x7D, 0xAA, 0xCA, 0x70, 0xAD, 0xA7, 0x77, 0x75,
+    0x99, 0xA9, 0x95, 0xAF, 0xF3, 0xAD, 0xA9, 0x39, 0x3D, 0xA7, 0x1A, 0xD7, 0x2A, 0xCA, 0x72, 0xDA,
+    0x72, 0xDA, 0x72, 0xDA, 0x3A, 0xFA, 0x0A, 0xCA, 0x49, 0x9E, 0x0A, 0xD6, 0xCA, 0x19, 0xE9, 0x39,
+    0xD2, 0xFF, 0xE3, 0xFF, 0xD4, 0xAF, 0xCA, 0x91, 0x09, 0xC9, 0x2C, 0x2C, 0x91, 0x9C, 0x2A, 0xF4,
+    0x9A, 0x97, 0x76, 0x9D, 0xA0, 0xD0, 0x9F, 0xE0, 0xCA, 0x19, 0xE9, 0xC3, 0xDA, 0x9C, 0x3A, 0xCA,
+    0x9C, 0x3A, 0xCA, 0x9C, 0x3D, 0xA0, 0xDA, 0xAE, 0xA0, 0x9F, 0xDA, 0x19, 0xDA, 0x9C, 0x95, 0xD9,
+    0x09, 0x91, 0xAD, 0x1F, 0xDA, 0x1A, 0xFA, 0x72, 0x6A, 0xA7, 0x3D, 0x72, 0x9D, 0x77, 0x77, 0x69,
+    0x9A, 0x99, 0x5A, 0xFF, 0x3A, 0xDA, 0x93, 0x93, 0xDA, 0x71, 0xAD, 0x72, 0xAC, 0xA7, 0x2D, 0xA7,
+    0x2D, 0xA7, 0x2D, 0xA3, 0xAF, 0xA0, 0xAC, 0xA4, 0x99, 0xE0, 0xAD, 0x6C, 0xA1, 0x9E, 0x93, 0x9D,
+    0x2F, 0xFE, 0x3F, 0xFD, 0x4A, 0xFC, 0xA9, 0x10, 0x3D, 0x59, 0xD5, 0x9A, 0xA7, 0x76, 0x9D, 0xA0,
+    0xD0, 0x9F, 0xE0, 0xCA, 0x19, 0xE9, 0xC3, 0xDA, 0x9C, 0x3A, 0xCA, 0x9C, 0x3A, 0xCA, 0x9C, 0x3D,
+    0xA0, 0xDA, 0xAE, 0xA0, 0x9F, 0xDA, 0x19, 0xDA, 0x9C, 0x95, 0xD9, 0x09, 0x91, 0xAD, 0x1F, 0xDA,
+    0x1A, 0xFA, 0x72, 0x59, 0x9A, 0x99, 0x5A, 0xFF, 0x3A, 0xDA, 0x93, 0x93, 0xDA, 0x71, 0xAD, 0x72,
+    0xAC, 0xA7, 0x2D, 0xA7, 0x2D, 0xA7, 0x2D, 0xA3, 0xAF, 0xA0, 0xAC, 0xA4, 0x99, 0xE0, 0xAD, 0x6C,
+    0xA1, 0x9E, 0x93, 0x9D, 0x2F, 0xFE, 0x3F, 0xFD, 0x4A, 0xFC, 0xA9, 0x77, 0x77, 0x49, 0x97, 0x29,
+    0xD9, 0x71, 0x9D, 0x72, 0xAC, 0xA7, 0x2D, 0x94, 0x3E, 0x5D, 0xA5, 0xD9, 0x49, 0xD5, 0xAA, 0xA7,
+    0x59, 0xDA, 0x0D, 0x09, 0xFE, 0x0C, 0xA1, 0x9E, 0x9C, 0x3D, 0xA9, 0xC3, 0xAC, 0xA9, 0xC3, 0xAC,
+    0xA9, 0xC3, 0xDA, 0x0D, 0xAA, 0xEA, 0x09, 0xFD, 0xA1, 0x9D, 0xA9, 0xC9, 0x5D, 0x90, 0x99, 0x1A,
+    0xD1, 0xFD, 0xA1, 0xAF, 0xA7, 0x20, 0x77, 0x0D, 0x70, 0xAA, 0xCA, 0x6A, 0x91, 0xAA, 0x77, 0x96,
+    0x99, 0x09, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x9A, 0xCA, 0x5D,
+    0x9A, 0xCA, 0x5D, 0x9A, 0xD5, 0xD9, 0xAF, 0xFD, 0x9A, 0xFF, 0xD9, 0xAF, 0xFD, 0xAE, 0x49, 0xDA,
+    0xE5, 0xDA, 0xE4, 0x9D, 0xAE, 0x49, 0xDA, 0x39, 0x71, 0xAC, 0x70, 0xAA, 0x9C, 0x6A, 0x92, 0xA7,
+    0x9C, 0x71, 0xAC, 0x71, 0xAC, 0x71, 0xAC, 0x71, 0xAC, 0x71, 0xCA, 0x0A, 0xAA, 0x5F, 0xE4, 0xDA,
+    0x19, 0xCA, 0x3D, 0x3C, 0xA3, 0xD3, 0xAC, 0x3C, 0xA3, 0xAC, 0x3C, 0xA3, 0xAC, 0x29, 0xD3, 0xD2,
+    0x9D, 0x3D, 0x29, 0xD3, 0xD0, 0x1A, 0x95, 0x9A, 0x29, 0xCA, 0x5D, 0x2A, 0xCA, 0x5D, 0x2A, 0xCA,
+    0x5D, 0x2A, 0xCA, 0x5D, 0x90, 0xAF, 0xFF, 0x09, 0xEA, 0xAA, 0xAA, 0xAD, 0xA1, 0xAD, 0x5D, 0x91,
+    0xAF, 0xFD, 0x91, 0xAF, 0xFD, 0x91, 0xAF, 0xFD, 0xA1, 0xE4, 0x9D, 0xA1, 0xE5, 0xDA, 0x1E, 0x49,
+    0xDA, 0x1E, 0x49, 0xDA, 0x00, 0x29, 0xC7, 0x1A, 0xC7, 0xFD, 0x96, 0xAC, 0x71, 0xD7, 0x1C, 0xA0,
+    0xAA, 0xA5, 0xFE, 0x4D, 0xA1, 0x9C, 0xA3, 0xD3, 0xCA, 0x3D, 0x3A, 0xC3, 0xCA, 0x3A, 0xC3, 0xCA,
+    0x3A, 0xC2, 0x9D, 0x3D, 0x29, 0xD3, 0xD2, 0x9D, 0x3D, 0x00, 0x0A, 0xC4, 0xC0, 0xC0, 0xA9, 0x9A,
+    0x09, 0xD1, 0x97, 0x74, 0x99, 0x93, 0xAD, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D,
+    0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x3A, 0xD3, 0xAD, 0x3A, 0xD9, 0x00, 0x09, 0xC9, 0x19, 0x0C,
+    0x0A, 0x99, 0xA0, 0xC1, 0xD1, 0x97, 0x69, 0x94, 0xC9, 0x4C, 0x94, 0xC9, 0x4C, 0x94, 0xC9, 0x4C,
+    0xA4, 0xCA, 0x4C, 0xA3, 0x9D, 0x10, 0x71, 0xAF, 0xD1, 0x99, 0x97, 0x77, 0x29, 0x95, 0xAD, 0x59,
+    0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x5A, 0xD5,
+    0xAD, 0x5A, 0xD9, 0x10, 0x79, 0xFD, 0x99, 0x99, 0x77, 0x96, 0xC9, 0x5C, 0x95, 0xC9, 0x5C, 0x95,
+    0xC9, 0x5C, 0xA5, 0xCA, 0x5C, 0xA4, 0x9D, 0x20, 0x4D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90,
+    0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xE0, 0xA1, 0x9A, 0x2D,
+    0x93, 0x1A, 0xA1, 0x9D, 0x19, 0xD7, 0x49, 0x3C, 0x92, 0xC9, 0x2C, 0x92, 0xC9, 0x2C, 0x92, 0xCA,
+    0x2C, 0xA2, 0xCA, 0x19, 0xD1, 0xA9, 0x2C, 0x3A, 0xCA, 0x50, 0x9A, 0x90, 0xAC, 0xA0, 0xE7, 0x59,
+    0x1A, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09,
+    0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x90, 0x3C, 0x90, 0xC9, 0x0C, 0x90, 0xC9, 0x0C, 0x90, 0xCA, 0x0C,
+    0xA0, 0xCA, 0x9D, 0x72, 0xAD, 0x4D, 0x09, 0xD4, 0xD0, 0x9D, 0x39, 0xD0, 0x9D, 0x39, 0xD0, 0x9D,
+    0x39, 0xD0, 0x9D, 0x39, 0xD0, 0x9D, 0x39, 0xD0, 0x9D, 0x39, 0xD0, 0x9D, 0x39, 0xD0, 0x9D, 0x3A,
+    0xCA, 0x09, 0xD3, 0xAC, 0xA0, 0xAD, 0x3A, 0xCA, 0x0A, 0xD3, 0xAC, 0xA0, 0xAD, 0x92, 0xD9, 0x69,
+    0xD9, 0x4F, 0xC5, 0xFA, 0x5E, 0x92, 0x0A, 0xA7, 0x19, 0xD6, 0xD0, 0x9D, 0x6D, 0x71, 0x9A, 0xA7,
+    0x69, 0x73, 0xC9, 0x6A, 0xC1, 0xC9, 0x6A, 0xC1, 0xC9, 0x6D, 0x1C, 0x96, 0xCA, 0x1C, 0x96, 0xCA,
+    0x1C, 0xA6, 0xCA, 0x1C, 0xA6, 0xCA, 0x1C, 0xA6, 0xC9, 0x09, 0xD6, 0xC9, 0x72, 0xC9, 0x71, 0xAC,
+    0x97, 0xAE, 0x7A, 0xE9, 0x76, 0x72, 0xD4, 0xC9, 0xAA, 0x2A, 0x2A, 0xA4, 0xD9, 0x4D, 0x94, 0xD9,
+    0x4D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x49, 0xD4, 0x9D, 0x49, 0xD4, 0x9D, 0x4A, 0xCA, 0x39, 0xDA,
+    0x1A, 0xF2, 0xFA, 0x2A, 0xCA, 0x93, 0x39, 0xC6, 0xDA, 0x4C, 0x1A, 0xA2, 0x93, 0x95, 0x96, 0x9C,
+    0x69, 0xC6, 0x9C, 0x69, 0xC6, 0xAC, 0x6A, 0xC6, 0xAC, 0x6A, 0xC6, 0xAA, 0x6C, 0xA5, 0xAC, 0xA3,
+    0xF4, 0xAA, 0x94, 0x0A, 0xC9, 0x1A, 0xD2, 0xAC, 0x91, 0xD9, 0x2D, 0x1A, 0xCA, 0x3D, 0x09, 0xD4,
+    0xD0, 0xDA, 0x4D, 0x9D, 0x5F, 0x95, 0xF5, 0x9F, 0x59, 0xFC, 0x49, 0xDA, 0xDA, 0x3A, 0xD0, 0xEA,
+    0x2A, 0xCA, 0x1E, 0xA1, 0xAC, 0xA1, 0xAE, 0xA0, 0xDA, 0x2F, 0x97, 0x5D, 0xA6, 0x9D, 0x96, 0x9D,
+    0x7A, 0xD7, 0xAA, 0x95, 0x72, 0xD7, 0xD7, 0xD7, 0xCA, 0x7C, 0xA0, 0x9A, 0x93, 0xCA, 0x0D, 0x4C,
+    0xAD, 0x5E, 0x95, 0xE9, 0x49, 0xCA, 0xD9, 0x39, 0xCA, 0x9D, 0x92, 0x9C, 0xA0, 0xAD, 0x91, 0x9C,
+    0xA1, 0xAD, 0xA7, 0x77, 0x99, 0x6A, 0xD6, 0xAD, 0x6D, 0xA6, 0xD9, 0x40, 0x1C, 0x1C, 0x91, 0x9C,
+    0x0A, 0xC2, 0x9C, 0x9C, 0x3A, 0xDA, 0x3A, 0xD4, 0xAD, 0x93, 0xCA, 0xD9, 0x2C, 0xA0, 0xD9, 0x1C,
+    0xA0, 0x9D, 0x90, 0x1C, 0x6A, 0xA6, 0xC9, 0x69, 0x77, 0x09, 0x96, 0xD5, 0x9D, 0x59, 0xCA, 0x59,
+    0xCA, 0x59, 0xCA, 0x59, 0xCA, 0x59, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xC9, 0x5A,
+    0xDA, 0xAA, 0xAF, 0xFF, 0xFF, 0x29, 0x29, 0xC2, 0xC9, 0x19, 0xC7, 0x49, 0x92, 0xCA, 0x2C, 0xA2,
+    0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC2, 0x9C, 0x2A, 0xC2, 0xAC, 0x2A, 0xC2, 0xAC, 0x2A, 0xE0,
+    0xAE, 0x90, 0x71, 0xD6, 0xD5, 0x9C, 0xA5, 0x9C, 0xA5, 0x9C, 0xA5, 0x9C, 0xA5, 0x9C, 0xA5, 0xAC,
+    0xA5, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0x95, 0xAD, 0xAA, 0xAA, 0xFF, 0xFF, 0xF7, 0x75, 0x99, 0x5E,
+    0x5D, 0xA5, 0xD9, 0x49, 0xD3, 0x09, 0x92, 0xCA, 0x2C, 0xA2, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19,
+    0xC2, 0x9C, 0x2A, 0xC2, 0xAC, 0x2A, 0xC2, 0xAC, 0x2A, 0xE0, 0xAE, 0x97, 0x2E, 0x1D, 0xA1, 0xD9,
+    0x09, 0xD1, 0x9A, 0xA1, 0x71, 0xD5, 0x9D, 0x59, 0xCA, 0x59, 0xCA, 0x2A, 0xC0, 0x9C, 0xA2, 0xAA,
+    0x09, 0xCA, 0x2C, 0xA0, 0x9C, 0xA2, 0xA9, 0x0A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xC9, 0x5A,
+    0xDA, 0xAA, 0xAF, 0xFF, 0xFF, 0x0A, 0xA1, 0xC9, 0x0C, 0xA1, 0xC1, 0xCA, 0x09, 0xC1, 0xC9, 0x1A,
+    0x09, 0xC9, 0x39, 0xC9, 0x39, 0xC4, 0x9C, 0x4A, 0xC4, 0xAC, 0x4A, 0xC4, 0xAC, 0x4A, 0xE2, 0xAE,
+    0x91, 0x0D, 0x6D, 0x59, 0xCA, 0x59, 0xCA, 0x2D, 0x09, 0xCA, 0x2D, 0x09, 0xCA, 0x2A, 0xA9, 0x9C,
+    0xA5, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0x95, 0xAD, 0xAA, 0xAA, 0xFF, 0xFF, 0xF0, 0x09,
+    0x94, 0xCA, 0x4C, 0xA4, 0xC9, 0x39, 0xC9, 0x09, 0xCA, 0x9C, 0x90, 0xAC, 0xA9, 0xC1, 0xAA, 0xA9,
+    0xC4, 0xAC, 0x4A, 0xC4, 0xAC, 0x4A, 0xC4, 0xAE, 0x2A, 0xE9, 0x10, 0x75, 0xA9, 0x74, 0x9C, 0x75,
+    0xC9, 0x74, 0xAC, 0x71, 0xD0, 0x9C, 0x97, 0x1D, 0x0C, 0xA7, 0x19, 0xCA, 0xAC, 0x72, 0x9E, 0x97,
+    0x29, 0xE7, 0x39, 0xD9, 0x73, 0x9C, 0xA7, 0x4A, 0xCA, 0x73, 0x9D, 0xA7, 0x3E, 0xA7, 0x2A, 0xE9,
+    0x72, 0xDA, 0xDA, 0xAA, 0xAD, 0x3A, 0xC0, 0xFF, 0xC2, 0x9C, 0xA0, 0xFF, 0xC2, 0xD7, 0x4A, 0xC9,
+    0x74, 0xD7, 0x4D, 0x75, 0x97, 0x50, 0x59, 0x97, 0x0C, 0xA7, 0x0C, 0xA7, 0x0C, 0x97, 0x9C, 0x97,
+    0x9C, 0x97, 0x9C, 0x9A, 0xA5, 0xAD, 0x95, 0xAD, 0x5A, 0xCA, 0xAC, 0x39, 0xCA, 0x1A, 0xC7, 0x0A,
+    0xC7, 0x0A, 0xE6, 0xAE, 0x90, 0x6C, 0x71, 0xAA, 0x71, 0xC9, 0x71, 0x97, 0x77, 0x29, 0x1A, 0xCA,
+    0x49, 0xCA, 0x0E, 0x49, 0xCA, 0x0E, 0xA3, 0xAC, 0xA0, 0xF3, 0xAC, 0xA0, 0xFA, 0x2A, 0xCA, 0x0D,
+    0x9D, 0x2D, 0x90, 0xD0, 0xD9, 0x1D, 0x99, 0xD0, 0x9D, 0x1D, 0x99, 0xD1, 0xD9, 0x0D, 0x99, 0xD1,
+    0x9D, 0x0D, 0x9A, 0xD2, 0xDA, 0xD0, 0xAD, 0x29, 0xF0, 0xAD, 0x3F, 0x0E, 0x39, 0xE0, 0x5C, 0x7A,
+    0xA7, 0xC9, 0x79, 0x77, 0x74, 0x94, 0xFD, 0x92, 0xDA, 0x1A, 0xC2, 0xD3, 0xC9, 0x1D, 0x3C, 0xA1,
+    0xD3, 0xCA, 0x1D, 0x3D, 0x09, 0xD3, 0xD0, 0x9D, 0x3D, 0x09, 0xD2, 0x9D, 0x00, 0x74, 0x9A, 0x94,
+    0x9C, 0xA0, 0xE4, 0x9C, 0xA0, 0xEA, 0x3A, 0xCA, 0x0F, 0x3A, 0xCA, 0x0F, 0x92, 0xAC, 0xA0, 0xD9,
+    0xD2, 0xD9, 0x0D, 0x0D, 0x91, 0xD9, 0x9D, 0x09, 0xD1, 0xD9, 0x9D, 0x1D, 0x90, 0xD9, 0x9D, 0x19,
+    0xD0, 0xD9, 0xAD, 0x2D, 0xAD, 0x0A, 0xD2, 0x9F, 0x0A, 0xD3, 0xF0, 0xE3, 0x9E, 0x77, 0x0A, 0xD7,
+    0x0E, 0x70, 0xD9, 0x70, 0xD7, 0x09, 0xAA, 0x50, 0x49, 0x4F, 0xD9, 0x2D, 0xA1, 0xAC, 0x2D, 0x3C,
+    0x91, 0xD3, 0xCA, 0x1D, 0x3C, 0xA1, 0xD3, 0xD0, 0x9D, 0x3D, 0x09, 0xD3, 0xD0, 0x9D, 0x29, 0xD7,
+    0x5A, 0xD6, 0xDA, 0x6D, 0x96, 0xD6, 0x9A, 0xA4, 0x29, 0x39, 0x6C, 0x90, 0xAA, 0x7D, 0xA7, 0x1A,
+    0x77, 0x75, 0x9A, 0x94, 0x9C, 0xA0, 0xE4, 0x9C, 0xA0, 0xEA, 0x3A, 0xCA, 0x0F, 0x3A, 0xCA, 0x0F,
+    0x92, 0xAC, 0xA0, 0xD9, 0xD2, 0xD9, 0x0D, 0x0D, 0x91, 0xD9, 0x9D, 0x09, 0xD1, 0xD9, 0x9D, 0x1D,
+    0x90, 0xD9, 0x9D, 0x19, 0xD0, 0xD9, 0xAD, 0x2D, 0xAD, 0x0A, 0xD2, 0x9F, 0x0A, 0xD3, 0xF0, 0xE3,
+    0x9E, 0x00, 0x19, 0x92, 0xA4, 0xAA, 0x9C, 0x95, 0xAC, 0x97, 0x97, 0x77, 0x49, 0x4F, 0xD9, 0x2D,
+    0xA1, 0xAC, 0x2D, 0x3C, 0x91, 0xD3, 0xCA, 0x1D, 0x3C, 0xA1, 0xD3, 0xD0, 0x9D, 0x3D, 0x09, 0xD3,
+    0xD0, 0x9D, 0x29, 0xD0, 0x75, 0x9C, 0x94, 0x9C, 0xA4, 0x9D, 0x59, 0x77, 0x77, 0x39, 0x93, 0xCA,
+    0xF9, 0x1D, 0x91, 0xD1, 0xD2, 0x9C, 0x99, 0xCA, 0x29, 0xC9, 0x9C, 0xA2, 0x9C, 0xA9, 0xCA, 0x29,
+    0xCA, 0x9C, 0xA2, 0x9C, 0xAA, 0xCA, 0x29, 0xCA, 0xAD, 0x29, 0xD0, 0x74, 0x9A, 0x94, 0x9C, 0xA0,
+    0xE4, 0x9C, 0xA0, 0xEA, 0x3A, 0xCA, 0x0F, 0x3A, 0xCA, 0x0F, 0x92, 0xAC, 0xA0, 0xD9, 0xD2, 0xD9,
+    0x0D, 0x0D, 0x91, 0xD9, 0x9D, 0x09, 0xD1, 0xD9, 0x9D, 0x1D, 0x90, 0xD9, 0x9D, 0x19, 0xD0, 0xD9,
+    0xAD, 0x2D, 0xAD, 0x0A, 0xD2, 0x9F, 0x0A, 0xD3, 0xF0, 0xE3, 0xAE, 0x7E, 0xA5, 0xFA, 0x69, 0x94,
+    0x49, 0x4F, 0xD9, 0x2D, 0xA1, 0xAC, 0x2D, 0x3C, 0x91, 0xD3, 0xCA, 0x1D, 0x3C, 0xA1, 0xD3, 0xD0,
+    0x9D, 0x3D, 0x09, 0xD3, 0xD0, 0x9D, 0x29, 0xD6, 0x9D, 0x5F, 0x49, 0xE9, 0x72, 0x77, 0xAF, 0xD5,
+    0x99, 0x97, 0x76, 0x9A, 0xEA, 0x94, 0xAD, 0xAA, 0xAD, 0xA2, 0xAD, 0x92, 0x9E, 0x1D, 0x94, 0x9D,
+    0x99, 0xD6, 0xDA, 0xAC, 0x96, 0x9F, 0x97, 0xF7, 0x0F, 0x97, 0xDA, 0xC9, 0x69, 0xCA, 0xAD, 0x95,
+    0xDA, 0x0F, 0xAA, 0xAF, 0x1A, 0xFF, 0xD2, 0xAF, 0xF4, 0x9A, 0xFA, 0x77, 0x09, 0xAA, 0xF9, 0x19,
+    0xA9, 0x99, 0x99, 0x77, 0x77, 0x19, 0xAD, 0xA3, 0x9D, 0xAA, 0xD2, 0xCA, 0x3C, 0xA1, 0xC9, 0x3A,
+    0xC0, 0x9C, 0x49, 0xC0, 0x9C, 0x93, 0x9C, 0x1C, 0xA3, 0xAC, 0x1D, 0xAA, 0xAD, 0xA1, 0x9F, 0xD3,
+    0x9A, 0xDA, 0x20, 0x70, 0x95, 0x9A, 0x29, 0xC6, 0xDA, 0xAC, 0x96, 0x9E, 0x97, 0x77, 0x70, 0x9A,
+    0xEA, 0x94, 0xAD, 0xAA, 0xAD, 0xA2, 0xAD, 0x92, 0x9E, 0x1D, 0x94, 0x9D, 0x99, 0xD6, 0xDA, 0xAC,
+    0x96, 0x9F, 0x97, 0xF7, 0x0F, 0x97, 0xDA, 0xC9, 0x69, 0xCA, 0xAD, 0x95, 0xDA, 0x0F, 0xAA, 0xAF,
+    0x1A, 0xFF, 0xD2, 0xAF, 0xF4, 0x9A, 0xFA, 0x77, 0x72, 0x9C, 0x3C, 0x3D, 0xAA, 0xD4, 0xAD, 0xA7,
+    0x77, 0x77, 0x49, 0xAD, 0xA3, 0x9D, 0xAA, 0xD2, 0xCA, 0x3C, 0xA1, 0xC9, 0x3A, 0xC0, 0x9C, 0x49,
+    0xC0, 0x9C, 0x93, 0x9C, 0x1C, 0xA3, 0xAC, 0x1D, 0xAA, 0xAD, 0xA1, 0x9F, 0xD3, 0x9A, 0xDA, 0x20,
+    0x39, 0x94, 0x99, 0x3A, 0xC9, 0x3A, 0xC3, 0xAC, 0x93, 0xD7, 0x77, 0x71, 0x9A, 0xEA, 0x95, 0xAD,
+    0xAA, 0xAD, 0xA3, 0xAD, 0x92, 0x9E, 0x2D, 0x94, 0x9D, 0x90, 0x9D, 0x6D, 0xA0, 0xAC, 0x96, 0x9D,
+    0x0D, 0x97, 0xD0, 0xD7, 0x0D, 0x0D, 0x97, 0xD0, 0xAC, 0x96, 0x9C, 0xA0, 0xAD, 0x95, 0xDA, 0x1F,
+    0xAA, 0xAF, 0x2A, 0xFF, 0xD3, 0xAF, 0xF5, 0x9A, 0xFA, 0x77, 0x10, 0x77, 0xD4, 0xCA, 0x19, 0xD3,
+    0x9C, 0xA2, 0x95, 0x97, 0x77, 0x77, 0x59, 0xAD, 0xA6, 0x9D, 0xAA, 0xD5, 0xCA, 0x3C, 0xA4, 0xC9,
+    0x3A, 0xC3, 0x9C, 0x49, 0xC3, 0x9C, 0x93, 0x9C, 0x4C, 0xA3, 0xAC, 0x4D, 0xAA, 0xAD, 0xA4, 0x9F,
+    0xD6, 0x9A, 0xDA, 0x40, 0x29, 0xAF, 0x9A, 0xAF, 0xD2, 0xAD, 0xAA, 0xAF, 0xFD, 0x1A, 0xD9, 0x3E,
+    0x7D, 0x94, 0x9D, 0x95, 0xAD, 0x6D, 0xA5, 0xAC, 0x96, 0xE5, 0xD9, 0x6F, 0xD9, 0x1D, 0x69, 0xFD,
+    0x91, 0xD9, 0x59, 0xE5, 0xAC, 0xA5, 0x9D, 0xA5, 0xAD, 0x94, 0x9D, 0xA6, 0xFA, 0xAA, 0xF9, 0x6A,
+    0xFF, 0xFF, 0x2A, 0xFF, 0xFE, 0x92, 0x9A, 0xFF, 0xFC, 0x90, 0x77, 0x29, 0xAD, 0xA2, 0xEA, 0x39,
+    0xDA, 0xAD, 0x9C, 0xA1, 0x9C, 0x2C, 0xA3, 0xDA, 0x3A, 0xA1, 0xC9, 0x3A, 0xCA, 0xAA, 0xAE, 0x09,
+    0xC4, 0x9E, 0xAA, 0xAA, 0x90, 0x9C, 0x93, 0xAC, 0x70, 0xCA, 0x3A, 0xCA, 0x7D, 0xAA, 0xAA, 0xF9,
+    0x19, 0x91, 0x9F, 0xD9, 0xFD, 0xA2, 0x9A, 0xDA, 0x2A, 0xEA, 0x90, 0x77, 0xC7, 0x0A, 0xC7, 0x0C,
+    0x97, 0x77, 0x3F, 0xCA, 0x4C, 0xAA, 0xAA, 0xD3, 0xC3, 0x9C, 0x92, 0xC4, 0xCA, 0x19, 0xC3, 0x9C,
+    0xA1, 0x9C, 0xA9, 0x9A, 0xD9, 0x19, 0xFD, 0x92, 0x9F, 0xDA, 0x2A, 0xD2, 0xD9, 0x1A, 0xD2, 0x9D,
+    0x1A, 0xD3, 0xD1, 0xAD, 0x3D, 0x90, 0xE2, 0x9D, 0xA0, 0xE2, 0x9E, 0x00, 0x2A, 0x94, 0xC4, 0xAC,
+    0x49, 0x73, 0xAC, 0x9D, 0x1A, 0xF9, 0x0A, 0xCA, 0x3D, 0x93, 0xD4, 0xD4, 0xD4, 0xD9, 0x29, 0xD9,
+    0x20, 0x0F, 0xCA, 0x4C, 0xAA, 0xAA, 0xD3, 0xC3, 0x9C, 0x92, 0xC4, 0xCA, 0x19, 0xC3, 0x9C, 0xA1,
+    0x9C, 0xA9, 0x9A, 0xD9, 0x19, 0xFD, 0x92, 0x9F, 0xDA, 0x2A, 0xD2, 0xD9, 0x1A, 0xD2, 0x9D, 0x1A,
+    0xD3, 0xD1, 0xAD, 0x3D, 0x90, 0xE2, 0x9D, 0xA0, 0xE2, 0x9E, 0x77, 0x77, 0x4A, 0xD7, 0xE7, 0xDA,
+    0x7D, 0x96, 0x9A, 0xA5, 0x1A, 0xC9, 0xD2, 0xAF, 0x91, 0xAC, 0xA4, 0xD9, 0x4D, 0x5D, 0x5D, 0x5D,
+    0x93, 0x9D, 0x97, 0x77, 0x74, 0xAA, 0x93, 0x9D, 0x93, 0x9D, 0x4A, 0xCA, 0x4D, 0x93, 0x74, 0xC9,
+    0x1C, 0x95, 0xCA, 0xC9, 0x7C, 0x97, 0x77, 0x3F, 0xCA, 0x4C, 0xAA, 0xAA, 0xD3, 0xC3, 0x9C, 0x92,
+    0xC4, 0xCA, 0x19, 0xC3, 0x9C, 0xA1, 0x9C, 0xA9, 0x9A, 0xD9, 0x19, 0xFD, 0x92, 0x9F, 0xDA, 0x2A,
+    0xD2, 0xD9, 0x1A, 0xD2, 0x9D, 0x1A, 0xD3, 0xD1, 0xAD, 0x3D, 0x90, 0xE2, 0x9D, 0xA0, 0xE2, 0x9E,
+    0x00, 0x0A, 0x3A, 0x19, 0xC9, 0x9C, 0x39, 0xD5, 0x99, 0x74, 0xAC, 0x9D, 0x2A, 0xF9, 0x1A, 0xCA,
+    0x4D, 0x94, 0xD5, 0xD5, 0xD5, 0xD9, 0x39, 0xD9, 0x20, 0x5A, 0xA7, 0x2C, 0x97, 0x1A, 0xC7, 0x29,
+    0x77, 0x77, 0x39, 0xAF, 0xA4, 0xAF, 0xE4, 0xDA, 0x97, 0x9D, 0x71, 0x9C, 0xA7, 0x19, 0xD9, 0x71,
+    0xFC, 0xA9, 0x6A, 0xFD, 0x96, 0x9A, 0xFA, 0x70, 0xAE, 0x70, 0x9E, 0x91, 0xA9, 0x91, 0x9F, 0x90,
+    0xAF, 0xFD, 0x09, 0xFF, 0xD2, 0xAF, 0xDA, 0x97, 0x70, 0x4C, 0x69, 0xC6, 0xCA, 0x69, 0x77, 0x79,
+    0xF9, 0x19, 0xC9, 0x99, 0x92, 0xAA, 0x6A, 0xC9, 0x6E, 0xA5, 0xAE, 0xA6, 0xD2, 0xCA, 0x99, 0xD9,
+    0x0F, 0xE1, 0xAF, 0xC9, 0x00, 0x4A, 0xA7, 0x1A, 0xD9, 0x7A, 0xA1, 0xA9, 0x77, 0x77, 0x09, 0xAF,
+    0xA4, 0xAF, 0xE4, 0xDA, 0x97, 0x9D, 0x71, 0x9C, 0xA7, 0x19, 0xD9, 0x71, 0xFC, 0xA9, 0x6A, 0xFD,
+    0x96, 0x9A, 0xFA, 0x70, 0xAE, 0x70, 0x9E, 0x91, 0xA9, 0x91, 0x9F, 0x90, 0xAF, 0xFD, 0x09, 0xFF,
+    0xD2, 0xAF, 0xDA, 0x97, 0x70, 0x39, 0x69, 0xCA, 0x49, 0xC9, 0xCA, 0x29, 0xA2, 0xA9, 0x73, 0x9F,
+    0x91, 0x9C, 0x99, 0x99, 0x2A, 0xA6, 0xAC, 0x96, 0xEA, 0x5A, 0xEA, 0x6D, 0x2C, 0xA9, 0x9D, 0x90,
+    0xFE, 0x1A, 0xFC, 0x90, 0x29, 0xAF, 0xA4, 0xAF, 0xE4, 0xDA, 0x97, 0x9D, 0x71, 0x9C, 0xA7, 0x19,
+    0xD9, 0x71, 0xFC, 0xA9, 0x6A, 0xFD, 0x96, 0x9A, 0xFA, 0x70, 0xAE, 0x70, 0x9E, 0x91, 0xA9, 0x91,
+    0x9F, 0x90, 0xAF, 0xFD, 0x09, 0xFF, 0xD2, 0xAF, 0xDA, 0x97, 0x09, 0x72, 0x99, 0xA7, 0x39, 0x97,
+    0x0A, 0xCA, 0x40, 0x19, 0xF9, 0x19, 0xC9, 0x99, 0x92, 0xAA, 0x6A, 0xC9, 0x6E, 0xA5, 0xAE, 0xA6,
+    0xD2, 0xCA, 0x99, 0xD9, 0x0F, 0xE1, 0xAF, 0xC9, 0x4A, 0x7C, 0x97, 0x0A, 0x5D, 0x91, 0x77, 0xAA,
+    0x1A, 0xA7, 0xAD, 0xA7, 0x1A, 0xC7, 0x77, 0x77, 0x79, 0xAF, 0xA4, 0xAF, 0xE4, 0xDA, 0x97, 0x9D,
+    0x71, 0x9C, 0xA7, 0x19, 0xD9, 0x71, 0xFC, 0xA9, 0x6A, 0xFD, 0x96, 0x9A, 0xFA, 0x70, 0xAE, 0x70,
+    0x9E, 0x91, 0xA9, 0x91, 0x9F, 0x90, 0xAF, 0xFD, 0x09, 0xFF, 0xD2, 0xAF, 0xDA, 0x97, 0x70, 0x19,
+    0x39, 0x2A, 0xA0, 0xAC, 0x4A, 0xD6, 0xA7, 0x77, 0x9F, 0x91, 0x9C, 0x99, 0x99, 0x2A, 0xA6, 0xAC,
+    0x96, 0xEA, 0x5A, 0xEA, 0x6D, 0x2C, 0xA9, 0x9D, 0x90, 0xFE, 0x1A, 0xFC, 0x90, 0xFF, 0xFF, 0xFE,
+    0xA4, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x70,
+    0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x97, 0x1C, 0x97, 0x3C, 0x70, 0xD9, 0x20, 0x72, 0xAA, 0x5C, 0xA4,
+    0x9C, 0xA3, 0xFD, 0x29, 0xC9, 0x49, 0xC9, 0x49, 0xC9, 0x4A, 0xC9, 0x4A, 0xC9, 0x4A, 0xCA, 0x4A,
+    0xF2, 0xAF, 0x4A, 0x97, 0xA4, 0xDA, 0x00, 0x79, 0x5A, 0xA1, 0xA9, 0x6A, 0xD9, 0x70, 0xAA, 0x77,
+    0x74, 0xFF, 0xFF, 0xFE, 0xA4, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x70, 0x9D, 0x70,
+    0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x93, 0x59, 0xC5, 0xAC, 0x2A, 0xA0, 0xAC,
+    0x2C, 0xA0, 0x99, 0x19, 0xCA, 0x3F, 0xD2, 0x9C, 0x94, 0x9C, 0x94, 0x9C, 0x94, 0xAC, 0x94, 0xAC,
+    0x94, 0xAC, 0xA4, 0xAF, 0x2A, 0xF0, 0xFF, 0xFF, 0xFE, 0xA4, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x6A,
+    0xAE, 0xAA, 0x93, 0xFE, 0xA5, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D,
+    0x93, 0x74, 0xAA, 0x6C, 0xA5, 0x9C, 0xA4, 0xFD, 0x39, 0xC9, 0x3A, 0xAE, 0xAA, 0x1F, 0xE3, 0xAC,
+    0x95, 0xAC, 0x95, 0xAC, 0xA5, 0xAF, 0x3A, 0xF0, 0x29, 0xC9, 0x1A, 0x5C, 0x0C, 0x99, 0xA5, 0xC1,
+    0xD7, 0x77, 0x49, 0x69, 0x90, 0xE4, 0x9D, 0x9E, 0x49, 0xD9, 0xAD, 0x49, 0xD9, 0xAC, 0xA4, 0x9D,
+    0x0A, 0xCA, 0x49, 0xD0, 0xAC, 0xA5, 0xD0, 0xAC, 0xA5, 0xD0, 0xAC, 0xA5, 0xD0, 0xAC, 0xA5, 0xD0,
+    0x9D, 0x49, 0xD0, 0x9D, 0xA2, 0x9E, 0x1F, 0xFC, 0xA1, 0xFF, 0xC9, 0x2A, 0xFD, 0x97, 0x50, 0x1D,
+    0x1A, 0x91, 0x9A, 0x0C, 0x0A, 0x29, 0x90, 0x9C, 0xA7, 0x73, 0x9C, 0x4C, 0x99, 0xC4, 0xC9, 0x9C,
+    0x92, 0x9C, 0xA9, 0xC9, 0x29, 0xCA, 0x0C, 0x92, 0x9C, 0xA0, 0xCA, 0x29, 0xCA, 0x0D, 0x2A, 0xCA,
+    0x0F, 0xEA, 0x0A, 0xFD, 0xA1, 0xAD, 0xA0, 0xD0, 0x75, 0x9F, 0xD9, 0x39, 0x99, 0x77, 0x76, 0xE4,
+    0x9D, 0x9E, 0x49, 0xD9, 0xE4, 0x9D, 0x9A, 0xCA, 0x49, 0xD0, 0xAC, 0xA4, 0x9D, 0x0A, 0xCA, 0x5D,
+    0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x09, 0xD4, 0x9D, 0x09, 0xDA, 0x29, 0xE1,
+    0xFF, 0xCA, 0x1F, 0xFC, 0x92, 0xAF, 0xD9, 0x75, 0x49, 0x99, 0x1F, 0xE7, 0x72, 0x9C, 0x4C, 0x99,
+    0xC4, 0xC9, 0x9C, 0x92, 0x9C, 0xA9, 0xC9, 0x29, 0xCA, 0x0C, 0x92, 0x9C, 0xA0, 0xCA, 0x29, 0xCA,
+    0x0D, 0x2A, 0xCA, 0x0F, 0xEA, 0x0A, 0xFD, 0xA1, 0xAD, 0xA0, 0xD0, 0x39, 0x29, 0x49, 0xC2, 0x9C,
+    0x5A, 0xF9, 0x69, 0xAA, 0x97, 0x77, 0x49, 0x95, 0x99, 0x0E, 0x49, 0xD9, 0xE4, 0x9D, 0x9A, 0xD4,
+    0x9D, 0x9A, 0xCA, 0x49, 0xD0, 0xAC, 0xA4, 0x9D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA,
+    0x5D, 0x0A, 0xCA, 0x5D, 0x09, 0xD4, 0x9D, 0x09, 0xDA, 0x29, 0xE1, 0xFF, 0xCA, 0x1F, 0xFC, 0x92,
+    0xAF, 0xD9, 0x75, 0x0C, 0xA2, 0x9A, 0x1A, 0xA2, 0xC9, 0x2F, 0xA4, 0x9A, 0x77, 0x59, 0xC4, 0xC9,
+    0x9C, 0x4C, 0x99, 0xC9, 0x29, 0xCA, 0x9C, 0x92, 0x9C, 0xA0, 0xC9, 0x29, 0xCA, 0x0C, 0xA2, 0x9C,
+    0xA0, 0xD2, 0xAC, 0xA0, 0xFE, 0xA0, 0xAF, 0xDA, 0x1A, 0xDA, 0x0D, 0x39, 0xAA, 0x70, 0xA0, 0x99,
+    0x7A, 0x09, 0x97, 0x9D, 0x77, 0x77, 0x70, 0xE4, 0x9D, 0x9E, 0x49, 0xD9, 0xE4, 0x9D, 0x9A, 0xCA,
+    0x49, 0xD0, 0xAC, 0xA4, 0x9D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA,
+    0x5D, 0x09, 0xD4, 0x9D, 0x09, 0xDA, 0x29, 0xE1, 0xFF, 0xCA, 0x1F, 0xFC, 0x92, 0xAF, 0xD9, 0x75,
+    0x2A, 0xA9, 0x5A, 0x0A, 0x5A, 0xCA, 0x77, 0x75, 0x9C, 0x4C, 0x99, 0xC4, 0xC9, 0x9C, 0x92, 0x9C,
+    0xA9, 0xC9, 0x29, 0xCA, 0x0C, 0x92, 0x9C, 0xA0, 0xCA, 0x29, 0xCA, 0x0D, 0x2A, 0xCA, 0x0F, 0xEA,
+    0x0A, 0xFD, 0xA1, 0xAD, 0xA0, 0xD0, 0x29, 0xA4, 0x9A, 0x2A, 0xC9, 0x3A, 0xC9, 0x1A, 0xA9, 0x3A,
+    0xA7, 0x77, 0x77, 0x1E, 0x49, 0xD9, 0x0E, 0x49, 0xD9, 0x0E, 0x49, 0xD9, 0x0A, 0xCA, 0x49, 0xD1,
+    0xAC, 0xA4, 0x9D, 0x1A, 0xCA, 0x5D, 0x1A, 0xCA, 0x5D, 0x1A, 0xCA, 0x5D, 0x1A, 0xCA, 0x5D, 0x19,
+    0xD4, 0x9D, 0x19, 0xDA, 0x29, 0xE2, 0xFF, 0xCA, 0x2F, 0xFC, 0x93, 0xAF, 0xD9, 0x77, 0x2C, 0xA3,
+    0x9C, 0x90, 0x9C, 0xA3, 0xAC, 0xA1, 0x99, 0x39, 0x99, 0x77, 0x72, 0x9C, 0x4C, 0x92, 0x9C, 0x4C,
+    0x92, 0x9C, 0x92, 0x9C, 0xA2, 0x9C, 0x92, 0x9C, 0xA3, 0xC9, 0x29, 0xCA, 0x3C, 0xA2, 0x9C, 0xA3,
+    0xD2, 0xAC, 0xA3, 0xFE, 0xA3, 0xAF, 0xDA, 0x4A, 0xDA, 0x0D, 0x10, 0x73, 0xE4, 0x9D, 0x9E, 0x49,
+    0xD9, 0xE4, 0x9D, 0x9A, 0xCA, 0x49, 0xD0, 0xAC, 0xA4, 0x9D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D,
+    0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x09, 0xD4, 0x9D, 0x09, 0xDA, 0x29, 0xE1, 0xFF, 0xCA, 0x1F,
+    0xFC, 0x3A, 0xFD, 0x97, 0x9A, 0x71, 0xC9, 0x71, 0x9D, 0x76, 0x9C, 0x4C, 0x99, 0xC4, 0xC9, 0x9C,
+    0x92, 0x9C, 0xA9, 0xC9, 0x29, 0xCA, 0x0C, 0x92, 0x9C, 0xA0, 0xCA, 0x29, 0xCA, 0x0D, 0x2A, 0xCA,
+    0x0F, 0xEA, 0x0A, 0xFD, 0xA1, 0xAD, 0xA9, 0xD5, 0xA9, 0x59, 0xA6, 0xAA, 0x7A, 0xC9, 0x70, 0x7A,
+    0x77, 0xAD, 0x75, 0xAA, 0x0A, 0xC7, 0x49, 0x39, 0x77, 0x7A, 0xC9, 0x73, 0xAC, 0x9A, 0xCA, 0x73,
+    0xD0, 0x9D, 0x72, 0x9D, 0x1D, 0x72, 0xAC, 0xA1, 0xD9, 0x29, 0xD3, 0xD9, 0x1A, 0xCA, 0x2E, 0x92,
+    0xD2, 0x9D, 0x19, 0xF1, 0x9D, 0x3D, 0x1F, 0xC9, 0x0A, 0xCA, 0x3D, 0x99, 0xD9, 0xAD, 0x0D, 0x93,
+    0xDA, 0xE0, 0x9D, 0x9D, 0x4A, 0xFA, 0x1F, 0xC4, 0x9F, 0x2A, 0xEA, 0x5E, 0xA3, 0xE9, 0x5E, 0x93,
+    0xE3, 0x5A, 0x72, 0xAC, 0xA7, 0x0A, 0xA0, 0xAA, 0x69, 0x92, 0x99, 0x77, 0x74, 0x9C, 0xA6, 0x9C,
+    0xA0, 0xD6, 0xAC, 0x90, 0xD2, 0xA2, 0xD1, 0xAC, 0x90, 0xAD, 0x1D, 0x19, 0xCA, 0x9E, 0xA9, 0xCA,
+    0x2F, 0xFC, 0x92, 0xAE, 0xAF, 0x39, 0xE0, 0xAE, 0x4D, 0x91, 0xDA, 0x10, 0x49, 0x71, 0x9C, 0xA7,
+    0x9C, 0x9A, 0xA6, 0xA2, 0x99, 0x77, 0x72, 0xAC, 0x95, 0xD9, 0x0D, 0x49, 0xD1, 0xAC, 0xA3, 0xD9,
+    0x2D, 0x29, 0xD3, 0xAD, 0x1D, 0x94, 0xD9, 0xAD, 0x5A, 0xF9, 0x6F, 0x7A, 0xD9, 0x7A, 0xD7, 0x0A,
+    0xD7, 0x0E, 0x70, 0xE7, 0x9E, 0x40, 0x75, 0xD6, 0xAD, 0xA4, 0xAA, 0x1A, 0xA7, 0x77, 0x70, 0xC9,
+    0x39, 0xC9, 0x0D, 0x3A, 0xC1, 0x9C, 0xA2, 0xD2, 0xD2, 0xCA, 0x29, 0xCA, 0x0A, 0xC9, 0x3D, 0x0D,
+    0x49, 0xF5, 0xEA, 0x59, 0xDA, 0x59, 0xD9, 0x59, 0xD5, 0x9D, 0xA3, 0xFC, 0x4E, 0xA7, 0x60, 0x2A,
+    0x91, 0xAA, 0x49, 0xD1, 0xD9, 0x3A, 0xD1, 0xD9, 0x77, 0x77, 0x5A, 0xC9, 0x5D, 0x90, 0xD4, 0x9D,
+    0x1A, 0xCA, 0x3D, 0x92, 0xD2, 0x9D, 0x3A, 0xD1, 0xD9, 0x4D, 0x9A, 0xD5, 0xAF, 0x96, 0xF7, 0xAD,
+    0x97, 0xAD, 0x70, 0xAD, 0x70, 0xE7, 0x0E, 0x79, 0xE4, 0x59, 0xA7, 0x2C, 0x97, 0x19, 0xC7, 0x39,
+    0x77, 0x77, 0x1F, 0xFD, 0x91, 0xFF, 0xD3, 0x99, 0x99, 0x99, 0xE7, 0x0E, 0x97, 0xEA, 0x7E, 0xA7,
+    0xEA, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xCA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0x0F, 0xFF, 0x90, 0x4A,
+    0xA7, 0xC7, 0xAC, 0x79, 0x77, 0x72, 0xFE, 0x2A, 0xAA, 0xAE, 0x6D, 0x6D, 0x95, 0xDA, 0x5D, 0xA5,
+    0xE5, 0xAD, 0x6F, 0xE1, 0x9F, 0xEA, 0x00, 0x4A, 0xC7, 0x2D, 0x97, 0x1A, 0xA9, 0x77, 0x77, 0x0F,
+    0xFD, 0x91, 0xFF, 0xD3, 0x99, 0x99, 0x99, 0xE7, 0x0E, 0x97, 0xEA, 0x7E, 0xA7, 0xEA, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0xCA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0x0F, 0xFF, 0x90, 0x3D, 0x7D, 0x7A, 0xA7,
+    0x77, 0x1F, 0xE2, 0xAA, 0xAA, 0xE6, 0xD6, 0xD9, 0x5D, 0xA5, 0xDA, 0x5E, 0x5A, 0xD6, 0xFE, 0x19,
+    0xFE, 0xA0, 0x29, 0x39, 0x7C, 0x90, 0xC9, 0x70, 0xD9, 0x71, 0x9A, 0x77, 0x77, 0x1F, 0xFD, 0x91,
+    0xFF, 0xD3, 0x99, 0x99, 0x99, 0xE7, 0x0E, 0x97, 0xEA, 0x7E, 0xA7, 0xEA, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0xCA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0x0F, 0xFF, 0x90, 0x1A, 0x3A, 0x4C, 0xAA, 0xC6, 0xD7,
+    0x77, 0x73, 0xFE, 0x2A, 0xAA, 0xAE, 0x6D, 0x6D, 0x95, 0xDA, 0x5D, 0xA5, 0xE5, 0xAD, 0x6F, 0xE1,
+    0x9F, 0xEA, 0x00, 0x7E, 0x90, 0xAC, 0x3C, 0xA3, 0xC9, 0x3C, 0x93, 0xCA, 0x3C, 0xA3, 0xCA, 0x29,
+    0xCA, 0x29, 0xCA, 0x29, 0xCA, 0x29, 0xCA, 0x29, 0xCA, 0x20, 0x74, 0xA2, 0x9A, 0xF9, 0x19, 0xC1,
+    0xAD, 0xAA, 0xAE, 0x0A, 0xA0, 0xAD, 0x92, 0x9F, 0x1D, 0x94, 0x9D, 0x90, 0x9D, 0x6D, 0xA0, 0xAC,
+    0x96, 0x9D, 0x0D, 0x97, 0xD0, 0xD7, 0x0D, 0x0D, 0x97, 0xD0, 0xAC, 0x96, 0x9C, 0xA0, 0xAD, 0x95,
+    0xDA, 0x1F, 0xAA, 0xAF, 0x2A, 0xFF, 0xD3, 0xAF, 0xF5, 0x9A, 0xFA, 0x77, 0x10, 0x70, 0x92, 0x9A,
+    0xDA, 0x1A, 0x19, 0xDA, 0xAD, 0x9C, 0x1C, 0xA3, 0xD9, 0x1C, 0x93, 0xAC, 0x19, 0xC4, 0x9C, 0x19,
+    0xC9, 0x39, 0xC2, 0xCA, 0x3A, 0xC2, 0xDA, 0xAA, 0xDA, 0x29, 0xFD, 0x49, 0xAD, 0xA3, 0x1F, 0xDA,
+    0x3F, 0xAA, 0xAD, 0x90, 0x9E, 0x93, 0xD0, 0xAA, 0x9C, 0x93, 0xAC, 0x9A, 0x99, 0xC9, 0x3A, 0xC0,
+    0x99, 0xAC, 0x92, 0x9D, 0x2A, 0xFE, 0xA2, 0xAF, 0xD9, 0x3A, 0xCA, 0x70, 0xAC, 0xA7, 0x0D, 0xA7,
+    0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE6, 0x29, 0x97, 0xDA, 0x7C, 0xA7, 0x0C, 0x90, 0xAC, 0xA4, 0xCA,
+    0xDA, 0xAC, 0x92, 0xE2, 0xAC, 0x2D, 0x92, 0x9C, 0x2D, 0x4C, 0x2D, 0x4C, 0x91, 0xDA, 0x29, 0xC2,
+    0xEA, 0x99, 0xD2, 0xFE, 0x91, 0x9C, 0xA9, 0xEA, 0x2A, 0xC9, 0x7D, 0x70, 0xD7, 0x0D, 0x77, 0x20,
+    0xAF, 0xDA, 0x9C, 0x69, 0xA6, 0xAA, 0x6A, 0xA6, 0xA9, 0x5A, 0x94, 0xCA, 0x4C, 0xA4, 0xCA, 0x4A,
+    0xFD, 0xAA, 0xFD, 0xA7, 0xFF, 0xFF, 0xFE, 0xA9, 0xA2, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7,
+    0x1D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x93, 0x73, 0x9C,
+    0x94, 0xD9, 0x3A, 0xC5, 0xCA, 0x49, 0xCA, 0x3F, 0xD2, 0x9C, 0x94, 0x9C, 0x94, 0x9C, 0x94, 0xAC,
+    0x94, 0xAC, 0x94, 0xAC, 0xA4, 0xAF, 0x2A, 0xF0, 0xFF, 0xFF, 0xFE, 0xA4, 0xD7, 0x1D, 0x71, 0xD7,
+    0x1D, 0x71, 0xD7, 0x1D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D,
+    0x97, 0x9E, 0x97, 0xF9, 0x7A, 0xD9, 0x71, 0x92, 0x77, 0x70, 0xA7, 0x2A, 0xF4, 0x9E, 0x9E, 0x49,
+    0xD9, 0x0E, 0x49, 0xD9, 0x0A, 0xCA, 0x49, 0xD1, 0xAC, 0xA4, 0x9D, 0x1A, 0xCA, 0x5D, 0x1A, 0xCA,
+    0x5D, 0x1A, 0xCA, 0x5D, 0x1A, 0xCA, 0x5D, 0x19, 0xD4, 0x9D, 0x19, 0xDA, 0x29, 0xE2, 0xFF, 0xCA,
+    0x2F, 0xFC, 0x93, 0xAF, 0xD9, 0x77, 0x70, 0xA0, 0x9C, 0x4C, 0x9C, 0x09, 0xC4, 0xDA, 0x09, 0xC9,
+    0x29, 0xD1, 0x9C, 0x92, 0x9C, 0xA2, 0xC9, 0x29, 0xCA, 0x2C, 0xA2, 0x9C, 0xA2, 0xD2, 0xAC, 0xA2,
+    0xFE, 0xA2, 0xAF, 0xDA, 0x3A, 0xDA, 0x0D, 0x10, 0x09, 0x94, 0xD4, 0xAC, 0x90, 0x0A, 0xA0, 0xC0,
+    0xAC, 0x09, 0x10, 0x2C, 0x93, 0xE2, 0xC9, 0x1C, 0x70, 0x9C, 0x91, 0xAC, 0x9A, 0x90, 0xAC, 0x1A,
+    0xC9, 0x50, 0x70, 0xFD, 0xA0, 0x99, 0x93, 0x73, 0xFF, 0xC9, 0x72, 0x6A, 0xA2, 0x9C, 0x0D, 0xAA,
+    0xC9, 0x09, 0xEA, 0x70, 0x09, 0xA1, 0xD9, 0x0D, 0xA0, 0x09, 0xA2, 0xAA, 0x1D, 0x90, 0x9D, 0x1D,
+    0xA0, 0xAD, 0x00, 0x09, 0xA2, 0x9C, 0x1C, 0x40, 0x0A, 0xA0, 0xA0, 0x99, 0xA0, 0x99, 0x9D, 0x00,
+    0x3A, 0x94, 0xA9, 0x2D, 0x39, 0xCA, 0x19, 0xCA, 0x39, 0xCA, 0x10, 0x7C, 0x91, 0xC2, 0xE4, 0xC9,
+    0x10, 0x09, 0x94, 0xA9, 0x4C, 0xA3, 0x9C, 0xA4, 0xAC, 0x39, 0xCA, 0x00, 0x09, 0x92, 0xDA, 0x1E,
+    0x19, 0xD2, 0xD9, 0x09, 0xD9, 0x09, 0xD1, 0x9D, 0x1D, 0xA1, 0xAA, 0x90, 0x0D, 0xA1, 0xDA, 0x1A,
+    0xD1, 0x9D, 0x2A, 0xA9, 0x4C, 0xAD, 0x1C, 0x20, 0x2A, 0x90, 0xAC, 0xAA, 0x93, 0xAD, 0xAA, 0xA9,
+    0x09, 0x99, 0x9C, 0xA4, 0xCA, 0x4A, 0xA0, 0x3A, 0x1C, 0x0A, 0x90, 0x09, 0xA1, 0xA0, 0x49, 0x90,
+    0xAD, 0xA0, 0xAD, 0xA0, 0x99, 0x40, 0x49, 0x90, 0x9A, 0xA4, 0x49, 0x90, 0x9F, 0xDA, 0x70, 0x09,
+    0xA1, 0xD9, 0x0D, 0xA0, 0x09, 0xA2, 0xAA, 0x1D, 0x90, 0x9D, 0x1D, 0xA0, 0xAD, 0x00, 0x0A, 0xA0,
+    0xA0, 0x99, 0xA0, 0x99, 0x9D, 0x00, 0x19, 0x91, 0x9D, 0x90, 0x9D, 0x1A, 0xD1, 0xDA, 0x1A, 0xA9,
+    0x00, 0x39, 0x29, 0x9A, 0x2A, 0x0A, 0xC9, 0x00, 0x09, 0x91, 0xA1, 0xA9, 0x2D, 0x93, 0x9C, 0xAC,
+    0xAC, 0xAC, 0x99, 0xAF, 0x0A, 0x91, 0xC0, 0x99, 0x1A, 0x00, 0x0A, 0x2A, 0x91, 0xCA, 0xC9, 0x29,
+    0xCA, 0x70, 0x70, 0x9C, 0x92, 0x9C, 0xAC, 0x90, 0x9A, 0x2A, 0x90, 0x9C, 0x91, 0xAC, 0x9A, 0x90,
+    0xAC, 0x1A, 0xC9, 0x50, 0x69, 0xFC, 0x70, 0x69, 0xFC, 0x96, 0x9C, 0x91, 0xAC, 0x9A, 0x90, 0xAC,
+    0x1A, 0xC9, 0x50, 0x9A, 0xAA, 0xAA, 0xA9, 0xAF, 0xDA, 0x99, 0x0A, 0xA9, 0x99, 0x1A, 0x0A, 0x91,
+    0xC0, 0xAF, 0x60, 0x9A, 0xAA, 0xAA, 0x2C, 0xA2, 0xCA, 0xF0, 0x9A, 0xA9, 0x90, 0xA0, 0x90, 0xA0,
+    0xA0, 0x90, 0xA6, 0x59, 0xA9, 0x2C, 0x2A, 0x0A, 0x00, 0x9C, 0x91, 0xAC, 0x9A, 0x90, 0xAC, 0x1A,
+    0xC9, 0x50, 0xA9, 0x1C, 0x09, 0x90, 0x75, 0xC6, 0xAA, 0x6C, 0x97, 0x49, 0xA2, 0xAA, 0x1D, 0x90,
+    0x9D, 0x1D, 0xA0, 0xAD, 0x00, 0xAF, 0x0A, 0x91, 0xC0, 0x99, 0x1A, 0x00, 0x49, 0x90, 0x9F, 0xDA,
+    0x77, 0x9F, 0xDA, 0x09, 0x99, 0x30, 0x9C, 0x19, 0xC0, 0xAC, 0x19, 0xC0, 0xAC, 0x1A, 0xC0, 0xAC,
+    0x1A, 0xC0, 0x99, 0x29, 0x00, 0x99, 0x99, 0x0A, 0xF2, 0xD2, 0xD4, 0x39, 0x4A, 0x39, 0x90, 0x9C,
+    0x9A, 0x0A, 0xC9, 0xAC, 0x0A, 0xC0, 0x9D, 0x91, 0xA9, 0x3C, 0x4A, 0x70, 0x70, 0xCA, 0x72, 0x9C,
+    0xA4, 0xAA, 0xCA, 0xA1, 0x91, 0xCA, 0x0A, 0xCA, 0x1A, 0xCA, 0x19, 0xCA, 0x0D, 0x39, 0xAF, 0x4A,
+    0xC7, 0x3D, 0x73, 0x99, 0x70, 0x1A, 0xCA, 0x3A, 0x0A, 0xC0, 0xAA, 0x19, 0xC0, 0xCA, 0x1C, 0xA0,
+    0xAA, 0x0A, 0x92, 0xAD, 0x74, 0xE2, 0x9A, 0x0D, 0x09, 0xC9, 0x0A, 0xC0, 0xA9, 0x2A, 0xD9, 0x71,
+    0x71, 0xA9, 0x2A, 0xC1, 0xA9, 0x50, 0x0A, 0x1A, 0x30, 0x97, 0x29, 0x1A, 0x97, 0xA9, 0x29, 0xAA,
+    0xAA, 0xAA, 0xA9, 0x20, 0x19, 0xAA, 0xAA, 0xAA, 0xA9, 0x3A, 0x97, 0xA9, 0x09, 0x72, 0x90, 0x77,
+    0x74, 0x9C, 0x91, 0xAF, 0xFF, 0xDA, 0x74, 0x9C, 0x97, 0x72, 0x4A, 0xCA, 0x71, 0xE7, 0x09, 0xE9,
+    0x7D, 0x0C, 0xA7, 0xCA, 0x0D, 0x6A, 0xC9, 0x09, 0xC9, 0x5D, 0x2D, 0x49, 0xCA, 0x2D, 0x93, 0xAC,
+    0x92, 0x9C, 0xA3, 0xD9, 0x29, 0xD2, 0x9F, 0xFC, 0x91, 0xFF, 0xE0, 0x9D, 0x59, 0xD0, 0xAD, 0x6D,
+    0xA0, 0xFD, 0xA3, 0xD9, 0x99, 0xAD, 0x91, 0xD4, 0xCA, 0x1D, 0x4D, 0x1D, 0x39, 0xCA, 0x1F, 0xEA,
+    0x2D, 0xAA, 0xAE, 0xA1, 0xD4, 0xAC, 0xA0, 0xD5, 0xD0, 0xD5, 0xD0, 0xD4, 0xAD, 0x0D, 0xAA, 0xAF,
+    0xC0, 0xFF, 0xC9, 0x0F, 0xEA, 0x91, 0x9A, 0xAA, 0xAA, 0xA0, 0xAF, 0xD0, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xC5, 0xAC, 0x5A, 0xC5, 0xAC, 0x5A, 0xC5, 0xAC, 0x5A, 0xC5, 0xAC, 0x59, 0xA5, 0x77, 0x0D,
+    0x97, 0x9D, 0xA7, 0xDA, 0xC6, 0x9C, 0xA9, 0xCA, 0x5D, 0x1D, 0x49, 0xCA, 0x19, 0xCA, 0x3D, 0x92,
+    0xD2, 0x9D, 0x3A, 0xCA, 0x1D, 0x94, 0xD0, 0x9D, 0x5D, 0xAA, 0xDA, 0xAA, 0xAA, 0xAE, 0xAF, 0xFE,
+    0x71, 0x9F, 0xF0, 0x9F, 0xDA, 0x90, 0x9C, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAF, 0xD2,
+    0xAF, 0xD2, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xFF, 0xA0, 0xFF, 0xC0, 0xFF, 0xC0, 0x1F, 0xFD,
+    0x91, 0xFF, 0xD3, 0x99, 0x99, 0x99, 0xE7, 0x0E, 0x97, 0xEA, 0x7E, 0xA7, 0xEA, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7F, 0xCA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0x0F, 0xFF, 0x90, 0x09, 0x69, 0x90, 0x9C, 0xA5,
+    0xD0, 0xAC, 0xA5, 0xD0, 0xAC, 0xA5, 0xD0, 0xAC, 0xA5, 0xD9, 0xAC, 0xA5, 0xD9, 0xAC, 0xA5, 0xD9,
+    0xAD, 0x5D, 0x9A, 0xFF, 0xD9, 0xAF, 0xFD, 0x9A, 0xFF, 0xDA, 0xE4, 0x9D, 0xAE, 0x5D, 0xAE, 0x49,
+    0xDA, 0xE4, 0x9D, 0xA0, 0x29, 0xAE, 0xA9, 0x4A, 0xDA, 0xAA, 0xDA, 0x2A, 0xD9, 0x29, 0xE1, 0xD9,
+    0x49, 0xD9, 0x9D, 0x6D, 0xAA, 0xC9, 0x69, 0xF9, 0x09, 0x99, 0xAA, 0x1F, 0x09, 0xFA, 0x1F, 0x97,
+    0xDA, 0xC9, 0x69, 0xCA, 0xAD, 0x95, 0xDA, 0x0F, 0xAA, 0xAF, 0x1A, 0xFF, 0xD2, 0xAF, 0xF4, 0x9A,
+    0xFA, 0x77, 0x3A, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0,
+    0x9D, 0x09, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x90, 0x0A, 0xC9, 0x1A, 0xD2, 0xAC, 0x91, 0xD9, 0x2D,
+    0x1A, 0xCA, 0x3D, 0x09, 0xD4, 0xD0, 0xDA, 0x4D, 0x9D, 0x5F, 0x95, 0xF5, 0x9F, 0x59, 0xFC, 0x49,
+    0xDA, 0xDA, 0x3A, 0xD0, 0xEA, 0x2A, 0xCA, 0x1E, 0xA1, 0xAC, 0xA1, 0xAE, 0xA0, 0xDA, 0x2F, 0x90,
+    0x3A, 0xEA, 0x70, 0xFC, 0x70, 0xFC, 0x96, 0x9F, 0xCA, 0x6E, 0x0E, 0x6D, 0x90, 0x9D, 0x94, 0x9D,
+    0x2D, 0xA4, 0xAD, 0x2A, 0xD4, 0xD9, 0x29, 0xD9, 0x29, 0xD4, 0xDA, 0x2A, 0xCA, 0x49, 0xD2, 0xD9,
+    0x5D, 0x90, 0x9D, 0x6A, 0xCA, 0x0A, 0xCA, 0x7D, 0x76, 0x77, 0xE5, 0x9D, 0x91, 0xE9, 0x4E, 0x91,
+    0xF3, 0x9E, 0xA0, 0x9F, 0x3A, 0xEA, 0x09, 0xCA, 0xDA, 0x2D, 0xAC, 0xA0, 0x9C, 0xAA, 0xD1, 0x9D,
+    0xAD, 0x09, 0xCA, 0x9D, 0x90, 0xDA, 0xAD, 0x09, 0xD0, 0xE9, 0xD0, 0xAD, 0x0A, 0xD0, 0xAF, 0xC0,
+    0xAD, 0x0A, 0xD1, 0xFA, 0x0E, 0x0A, 0xD1, 0xAE, 0x1E, 0x0A, 0xD1, 0x9E, 0x1E, 0x9E, 0x2D, 0x91,
+    0xE9, 0xE7, 0xE9, 0x74, 0x9A, 0x94, 0x9C, 0xA0, 0xE4, 0x9C, 0xA0, 0xEA, 0x3A, 0xCA, 0x0F, 0x3A,
+    0xCA, 0x0F, 0x92, 0xAC, 0xA0, 0xD9, 0xD2, 0xD9, 0x0D, 0x0D, 0x91, 0xD9, 0x9D, 0x09, 0xD1, 0xD9,
+    0x9D, 0x1D, 0x90, 0xD9, 0x9D, 0x19, 0xD0, 0xD9, 0xAD, 0x2D, 0xAD, 0x0A, 0xD2, 0x9F, 0x0A, 0xD3,
+    0xF0, 0xE3, 0x9E, 0x00, 0x0F, 0xFC, 0x19, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x76, 0xAF, 0xC5,
+    0x99, 0x99, 0x97, 0x77, 0x0A, 0xFF, 0xC9, 0xAF, 0xFC, 0x90, 0x29, 0xAE, 0xA9, 0x4A, 0xDA, 0xAA,
+    0xDA, 0x2A, 0xD9, 0x29, 0xE1, 0xD9, 0x49, 0xD9, 0x9D, 0x6D, 0xAA, 0xC9, 0x69, 0xF9, 0x7F, 0x70,
+    0xF9, 0x7D, 0xAC, 0x96, 0x9C, 0xAA, 0xD9, 0x5D, 0xA0, 0xFA, 0xAA, 0xF1, 0xAF, 0xFD, 0x2A, 0xFF,
+    0x49, 0xAF, 0xA7, 0x70, 0xAF, 0xE0, 0xAC, 0x39, 0xC0, 0xAC, 0x39, 0xC0, 0xAC, 0x39, 0xC0, 0xAC,
+    0x39, 0xC0, 0xAC, 0x39, 0xC0, 0xAC, 0x39, 0xC0, 0xAC, 0x39, 0xC0, 0xAC, 0x39, 0xC0, 0xAC, 0x39,
+    0xC0, 0xAC, 0x39, 0xC0, 0xAC, 0x39, 0xC0, 0x0F, 0xCA, 0x29, 0xDA, 0xAA, 0xD9, 0x09, 0xC9, 0x3D,
+    0x09, 0xC9, 0x3A, 0xC9, 0x9C, 0x93, 0xAC, 0x0A, 0xC9, 0x29, 0xD0, 0xAF, 0xEA, 0x0A, 0xFD, 0x91,
+    0xAC, 0xA6, 0xAC, 0xA6, 0xDA, 0x6E, 0x6E, 0x6E, 0x6E, 0x60, 0xAF, 0xDA, 0x9C, 0x69, 0xA6, 0xAA,
+    0x6A, 0xA6, 0xA9, 0x5A, 0x94, 0xCA, 0x4C, 0xA4, 0xCA, 0x4A, 0xFD, 0xAA, 0xFD, 0xA7, 0xFF, 0xFF,
+    0xFE, 0xA4, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D,
+    0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x93, 0xAC, 0x95, 0xD9, 0x0D, 0x49, 0xD1, 0xAC, 0xA3, 0xD9,
+    0x2D, 0x29, 0xD3, 0xAD, 0x1D, 0x94, 0xD9, 0xAD, 0x5A, 0xF9, 0x6F, 0x7A, 0xD9, 0x7A, 0xD7, 0x0A,
+    0xD7, 0x0E, 0x70, 0xE7, 0x9E, 0x40, 0x79, 0x77, 0xC9, 0x76, 0xC9, 0x75, 0x9C, 0x97, 0x2A, 0xFF,
+    0x94, 0x9E, 0x99, 0xC9, 0x9E, 0xA3, 0xE2, 0xC2, 0xAD, 0xA1, 0xAD, 0x3C, 0x3E, 0x1D, 0xA2, 0x9C,
+    0x39, 0xD9, 0x0D, 0x92, 0x9C, 0x4D, 0x90, 0xD9, 0x29, 0xC4, 0xD9, 0x0E, 0x29, 0xC3, 0xAD, 0x1A,
+    0xE9, 0x09, 0xC1, 0x9A, 0xE2, 0xFF, 0xFC, 0x93, 0xFF, 0xEA, 0x59, 0xAF, 0xDA, 0x72, 0xAC, 0x76,
+    0x99, 0x70, 0x75, 0xAC, 0x6D, 0x2D, 0x4A, 0xC9, 0x2A, 0xCA, 0x29, 0xCA, 0x4D, 0x91, 0xD5, 0x9D,
+    0x0D, 0x96, 0xAE, 0xA7, 0x0E, 0x71, 0xE7, 0x0F, 0xC6, 0xAD, 0x9D, 0xA4, 0x9D, 0xA0, 0xAD, 0x93,
+    0xE2, 0xE2, 0xAD, 0x92, 0x9D, 0xA0, 0x9D, 0xA4, 0xAD, 0x90, 0xAC, 0x2C, 0x91, 0x9C, 0x0A, 0xC2,
+    0xC9, 0x19, 0xC0, 0xAC, 0x2C, 0x91, 0x9C, 0x09, 0xC2, 0xC2, 0xAC, 0x1C, 0x91, 0xC2, 0xCA, 0x1D,
+    0x1C, 0x1D, 0x91, 0x9D, 0xAC, 0xAE, 0x39, 0xFC, 0xA7, 0xC9, 0x71, 0xC7, 0x2C, 0x72, 0xC7, 0x2C,
+    0x72, 0xC7, 0x71, 0x76, 0x9F, 0xA4, 0xAC, 0xA1, 0x9D, 0x91, 0x9C, 0x94, 0xD1, 0xD5, 0x9C, 0x90,
+    0xCA, 0x6C, 0xA9, 0xC9, 0x6D, 0x9C, 0x96, 0xD0, 0xCA, 0x6C, 0xA0, 0xD5, 0xAC, 0x91, 0xCA, 0x3A,
+    0xCA, 0x09, 0xAE, 0x1A, 0xEA, 0xAF, 0x1A, 0xF7, 0x30, 0x76, 0xE9, 0xC5, 0xDA, 0xAD, 0x93, 0xD2,
+    0xAC, 0x93, 0xC9, 0x29, 0xC9, 0x29, 0xC4, 0xCA, 0x29, 0xC4, 0xCA, 0x29, 0xC3, 0xAD, 0x3D, 0xAA,
+    0xF3, 0xAF, 0xE0, 0x92, 0xAD, 0xA9, 0xAE, 0x70, 0x99, 0x90, 0x77, 0x77, 0x09, 0x95, 0x9F, 0x93,
+    0xCA, 0x1A, 0xC9, 0x1A, 0xC3, 0x9C, 0x1A, 0xC3, 0x9C, 0x1A, 0xC3, 0xCA, 0x1A, 0xC0, 0x9D, 0xA2,
+    0xAC, 0x19, 0x9D, 0x1A, 0xC4, 0xD0, 0xAC, 0x4D, 0x0A, 0xDA, 0x90, 0x9D, 0x0A, 0xFF, 0x0A, 0xC9,
+    0xAF, 0x90, 0xAC, 0x29, 0xA9, 0x1A, 0xC7, 0xAC, 0x79, 0xA7, 0x71, 0x9C, 0x4C, 0xA1, 0xCA, 0x3C,
+    0xA1, 0xAC, 0x3C, 0xA2, 0xD2, 0xCA, 0x2A, 0xC9, 0x09, 0xC9, 0x3D, 0x0A, 0xC4, 0xAC, 0xAD, 0x49,
+    0xE9, 0x49, 0xE6, 0xD9, 0x6D, 0x96, 0xD9, 0x6A, 0xCA, 0x6A, 0xCA, 0x20, 0x72, 0xAF, 0xD2, 0xC9,
+    0x19, 0x9A, 0x2C, 0xA7, 0x9C, 0xA7, 0x9D, 0x97, 0xD9, 0x4A, 0xF9, 0x2E, 0x99, 0xD9, 0x09, 0xD3,
+    0xD0, 0xAC, 0x93, 0xD0, 0xAC, 0xA3, 0xD1, 0xD9, 0x09, 0xAD, 0x1A, 0xFD, 0x39, 0xAD, 0xA2, 0x1A,
+    0xA9, 0x2A, 0x1A, 0x19, 0x95, 0xA5, 0xAC, 0xA2, 0x9C, 0x4A, 0xA1, 0xAC, 0x09, 0xCA, 0xAC, 0xA1,
+    0xAD, 0xA1, 0x1A, 0xFC, 0x49, 0xCA, 0x93, 0x9C, 0x94, 0x9C, 0x95, 0xCA, 0x59, 0xC9, 0x5A, 0xC6,
+    0x9C, 0x96, 0xAD, 0x99, 0x49, 0xEA, 0x59, 0xD5, 0x9C, 0xA5, 0xD5, 0xDA, 0x10, 0x71, 0xAC, 0xA7,
+    0x9C, 0xAF, 0x92, 0xD9, 0x1A, 0xC1, 0x9C, 0x93, 0xC9, 0x09, 0xC9, 0x3C, 0x90, 0x9C, 0x93, 0xC9,
+    0x09, 0xC9, 0x3C, 0xA0, 0xAC, 0x93, 0xCA, 0x0A, 0xCA, 0x3C, 0xA0, 0xAC, 0xA3, 0xCA, 0x69, 0xCA,
+    0x69, 0xCA, 0x69, 0xD6, 0x9D, 0x71, 0x29, 0xA9, 0x4C, 0x90, 0x9C, 0x2C, 0xA2, 0x9C, 0x1C, 0x93,
+    0xC0, 0x9C, 0x4C, 0xAA, 0xC9, 0x99, 0x99, 0xCA, 0xAF, 0xEA, 0xAC, 0x4C, 0xAA, 0xC9, 0x29, 0xCA,
+    0x9D, 0x90, 0x9D, 0x90, 0xFE, 0x19, 0xFC, 0xA2, 0x9E, 0x91, 0x0A, 0x92, 0xCA, 0x2C, 0xA2, 0xCA,
+    0x2C, 0xA2, 0xCA, 0x2C, 0xA2, 0xD2, 0xD1, 0x9D, 0xA0, 0x9E, 0x90, 0x0A, 0x90, 0x9A, 0x2C, 0x90,
+    0xCA, 0x2C, 0x0A, 0xC2, 0x9C, 0x9C, 0x92, 0x9E, 0x39, 0xD9, 0x3A, 0xE3, 0xAC, 0x9D, 0x2A, 0xC0,
+    0xAD, 0x1D, 0x1E, 0x00, 0x70, 0x9D, 0xA4, 0x9F, 0x95, 0xE6, 0xDA, 0x5E, 0x5E, 0x4A, 0xE9, 0x3D,
+    0xAC, 0xA2, 0xAC, 0x90, 0xD2, 0xCA, 0x1D, 0x1A, 0xC2, 0xAC, 0x1C, 0x93, 0xC9, 0xAC, 0x4C, 0xA0,
+    0x0D, 0x4C, 0x90, 0xD4, 0xC9, 0x0D, 0x92, 0x9C, 0xA0, 0xD9, 0x29, 0xCA, 0x0D, 0x92, 0x9C, 0xA0,
+    0xDA, 0x29, 0xCA, 0x0E, 0x2A, 0xCA, 0x0F, 0xFA, 0x0C, 0xAF, 0xDA, 0x0C, 0x0A, 0xDA, 0x0D, 0x0C,
+    0x70, 0x97, 0x71, 0x9C, 0x4C, 0xA1, 0xD3, 0xCA, 0x19, 0xC9, 0x2C, 0xA2, 0xD2, 0xCA, 0x2A, 0xC9,
+    0x09, 0xC9, 0x3D, 0x0A, 0xC4, 0xAF, 0x49, 0xE9, 0x49, 0xE2, 0x0A, 0xFC, 0x93, 0x9C, 0xA9, 0x4C,
+    0x95, 0xAA, 0x6A, 0xC9, 0x6E, 0xA4, 0xCA, 0x59, 0xC6, 0x9C, 0xA6, 0xAE, 0x7D, 0x6D, 0x5A, 0xCA,
+    0x49, 0xD7, 0x20, 0x19, 0xAD, 0xA3, 0x9D, 0xAA, 0xD2, 0xCA, 0x3C, 0xA1, 0xC9, 0x3A, 0xC0, 0x9C,
+    0x49, 0xC0, 0x9C, 0x93, 0x9C, 0x1C, 0xA3, 0xAC, 0x1D, 0xAA, 0xAD, 0xA1, 0x9F, 0xD3, 0x9A, 0xDA,
+    0x20, 0x71, 0xAF, 0xFA, 0x1C, 0xA1, 0xD3, 0xC9, 0x1C, 0xA3, 0xC9, 0x1C, 0xA3, 0xC9, 0x1C, 0x92,
+    0x9C, 0x2C, 0x92, 0x9C, 0x19, 0xCA, 0x2A, 0xC2, 0xE7, 0x20, 0x39, 0xD9, 0x4A, 0xFA, 0x29, 0xCA,
+    0x19, 0xC9, 0x1D, 0x3C, 0xA1, 0xD3, 0xD0, 0x9D, 0x3D, 0x09, 0xD3, 0xCA, 0x0A, 0xE9, 0x9A, 0xC9,
+    0x0F, 0xF1, 0xD0, 0xF2, 0xD6, 0x9D, 0x69, 0xCA, 0x69, 0x97, 0x79, 0xEA, 0x1C, 0x91, 0xC9, 0xAA,
+    0x4A, 0xA4, 0xAA, 0x5C, 0x94, 0x9C, 0xA4, 0xAC, 0x93, 0x9C, 0x93, 0x9C, 0x94, 0x99, 0x10, 0x19,
+    0xAF, 0xE1, 0x9D, 0xAA, 0xD9, 0x3C, 0xA3, 0xCA, 0x3C, 0x93, 0xAC, 0x29, 0xC4, 0x9C, 0x29, 0xC9,
+    0x39, 0xC3, 0xCA, 0x3A, 0xC3, 0xDA, 0xAA, 0xDA, 0x39, 0xFD, 0x59, 0xAD, 0xA4, 0x70, 0xAF, 0xEA,
+    0x3C, 0x96, 0xC9, 0x59, 0xC6, 0x9C, 0x6A, 0xC6, 0xAC, 0x95, 0xAD, 0x97, 0x20, 0x49, 0x1A, 0xA2,
+    0xC9, 0x0A, 0xA2, 0x9C, 0x09, 0xC3, 0xC0, 0x9C, 0x3C, 0x09, 0xC3, 0xC9, 0x9C, 0x92, 0xC9, 0x0D,
+    0xAA, 0xD1, 0xFD, 0x2E, 0xA1, 0x5A, 0x73, 0xC7, 0x3C, 0x73, 0xC7, 0x09, 0xAE, 0xA9, 0x4A, 0xFE,
+    0xA2, 0xAD, 0x90, 0xC0, 0x9D, 0xA1, 0xD9, 0x1C, 0x19, 0xD0, 0x9D, 0x2C, 0x2D, 0xAA, 0xC9, 0x2C,
+    0x29, 0xDA, 0xC9, 0x2C, 0x3F, 0x29, 0xC3, 0xDA, 0xC2, 0x9C, 0x3D, 0xAC, 0xA1, 0x9C, 0x29, 0xCA,
+    0x9D, 0x90, 0x9C, 0x19, 0xDA, 0x0F, 0xDA, 0xF1, 0xAF, 0xFD, 0x2A, 0xFF, 0x49, 0xAF, 0xA7, 0x9A,
+    0x72, 0x9A, 0x50, 0x0C, 0xA4, 0x9C, 0x2E, 0xA2, 0xCA, 0x39, 0xD9, 0x0A, 0xC6, 0xD9, 0xC9, 0x6A,
+    0xDA, 0x70, 0xD7, 0x0A, 0xD9, 0x69, 0xF6, 0xD9, 0xD9, 0x4A, 0xCA, 0x09, 0xD9, 0x29, 0xD2, 0xF9,
+    0x0D, 0x93, 0xE9, 0x73, 0x29, 0x96, 0xA9, 0x6A, 0xA3, 0xAA, 0x0A, 0xA0, 0xAA, 0x0A, 0xA0, 0x9A,
+    0x1C, 0x09, 0xC0, 0x9A, 0x1C, 0x99, 0xC0, 0x9C, 0x1C, 0x99, 0xC0, 0x9C, 0x1C, 0xA9, 0xC9, 0x0C,
+    0x1C, 0xA0, 0xFA, 0xD9, 0x0A, 0xFD, 0x2A, 0xEA, 0x5C, 0x7C, 0x7C, 0x96, 0xA3, 0x75, 0xC9, 0x39,
+    0xC2, 0xD5, 0xCA, 0x09, 0xC9, 0x5A, 0xC0, 0xAC, 0x2C, 0x2A, 0xC0, 0xAC, 0x2C, 0x2A, 0xC0, 0x9C,
+    0x2C, 0x91, 0xCA, 0x1D, 0xAF, 0xD9, 0x19, 0xDA, 0x0A, 0xD9, 0x75, 0x4A, 0xCA, 0x71, 0xE7, 0x09,
+    0xE9, 0x7D, 0x0C, 0xA7, 0xCA, 0x0D, 0x6A, 0xC9, 0x09, 0xC9, 0x5D, 0x2D, 0x49, 0xCA, 0x2D, 0x93,
+    0xAC, 0x92, 0x9C, 0xA3, 0xD9, 0x29, 0xD2, 0x9F, 0xFC, 0x91, 0xFF, 0xE0, 0x9D, 0x59, 0xD0, 0xAD,
+    0x6D, 0xA7, 0x77, 0x69, 0xA9, 0x71, 0xAC, 0x97, 0x1D, 0xA4, 0x74, 0xE9, 0xC3, 0xDA, 0xAD, 0x91,
+    0xD2, 0xAC, 0x91, 0xC9, 0x29, 0xC9, 0x09, 0xC4, 0xCA, 0x09, 0xC4, 0xCA, 0x09, 0xC3, 0xAD, 0x1D,
+    0xAA, 0xF1, 0xAF, 0xE2, 0xAD, 0xA9, 0xAC, 0x77, 0x7A, 0xC9, 0x6A, 0xCA, 0x6A, 0xAA, 0x30, 0x4A,
+    0xAA, 0x73, 0xA9, 0x71, 0xAA, 0x72, 0x97, 0x77, 0x77, 0x71, 0xAC, 0xA7, 0x1E, 0x70, 0x9E, 0x97,
+    0xD0, 0xCA, 0x7C, 0xA0, 0xD6, 0xAC, 0x90, 0x9C, 0x95, 0xD2, 0xD4, 0x9C, 0xA2, 0xD9, 0x3A, 0xC9,
+    0x29, 0xCA, 0x3D, 0x92, 0x9D, 0x29, 0xFF, 0xC9, 0x1F, 0xFE, 0x09, 0xD5, 0x9D, 0x0A, 0xD6, 0xDA,
+    0x29, 0xA9, 0x69, 0x0A, 0x97, 0xA7, 0x97, 0x77, 0x3E, 0x9C, 0x3D, 0xAA, 0xD9, 0x1D, 0x2A, 0xC9,
+    0x1C, 0x92, 0x9C, 0x90, 0x9C, 0x4C, 0xA0, 0x9C, 0x4C, 0xA0, 0x9C, 0x3A, 0xD1, 0xDA, 0xAF, 0x1A,
+    0xFE, 0x2A, 0xDA, 0x9A, 0xC0, 0x69, 0x72, 0x9C, 0x72, 0xCA, 0x71, 0x9C, 0x97, 0x29, 0x72, 0xAC,
+    0x97, 0x09, 0xCA, 0xC7, 0x9A, 0x2C, 0x77, 0x77, 0x2A, 0xCA, 0x71, 0xE7, 0x09, 0xE9, 0x7D, 0x0C,
+    0xA7, 0xCA, 0x0D, 0x6A, 0xC9, 0x09, 0xC9, 0x5D, 0x2D, 0x49, 0xCA, 0x2D, 0x93, 0xAC, 0x92, 0x9C,
+    0xA3, 0xD9, 0x29, 0xD2, 0x9F, 0xFC, 0x91, 0xFF, 0xE0, 0x9D, 0x59, 0xD0, 0xAD, 0x6D, 0xA0, 0x79,
+    0xC7, 0xCA, 0x69, 0xC7, 0x09, 0x75, 0x9C, 0x96, 0xCA, 0xC5, 0xC1, 0x9C, 0x77, 0xE9, 0xC3, 0xDA,
+    0xAD, 0x91, 0xD2, 0xAC, 0x91, 0xC9, 0x29, 0xC9, 0x09, 0xC4, 0xCA, 0x09, 0xC4, 0xCA, 0x09, 0xC3,
+    0xAD, 0x1D, 0xAA, 0xF1, 0xAF, 0xE2, 0xAD, 0xA9, 0xAC, 0x00, 0x9A, 0x74, 0xAC, 0x97, 0x3A, 0xA9,
+    0x09, 0xC7, 0x29, 0xCA, 0xC7, 0x09, 0xA1, 0x9C, 0x77, 0x77, 0x5A, 0xCA, 0x72, 0xE7, 0x19, 0xE9,
+    0x70, 0xD0, 0xCA, 0x70, 0xCA, 0x0D, 0x7A, 0xC9, 0x09, 0xC9, 0x6D, 0x2D, 0x59, 0xCA, 0x2D, 0x94,
+    0xAC, 0x92, 0x9C, 0xA4, 0xD9, 0x29, 0xD3, 0x9F, 0xFC, 0x92, 0xFF, 0xE1, 0x9D, 0x59, 0xD1, 0xAD,
+    0x6D, 0xA0, 0x09, 0x72, 0xD7, 0x2D, 0x97, 0x4C, 0x97, 0x0E, 0x7C, 0x90, 0x9C, 0x77, 0x3E, 0x9C,
+    0x5D, 0xAA, 0xD9, 0x3D, 0x2A, 0xC9, 0x3C, 0x92, 0x9C, 0x92, 0x9C, 0x4C, 0xA2, 0x9C, 0x4C, 0xA2,
+    0x9C, 0x3A, 0xD3, 0xDA, 0xAF, 0x3A, 0xFE, 0x4A, 0xDA, 0x9A, 0xC0, 0x4A, 0xAA, 0x73, 0xC7, 0x2A,
+    0x97, 0x76, 0xAC, 0x71, 0x9C, 0xAC, 0x79, 0xA1, 0x9C, 0x77, 0x77, 0x2A, 0xCA, 0x71, 0xE7, 0x09,
+    0xE9, 0x7D, 0x0C, 0xA7, 0xCA, 0x0D, 0x6A, 0xC9, 0x09, 0xC9, 0x5D, 0x2D, 0x49, 0xCA, 0x2D, 0x93,
+    0xAC, 0x92, 0x9C, 0xA3, 0xD9, 0x29, 0xD2, 0x9F, 0xFC, 0x91, 0xFF, 0xE0, 0x9D, 0x59, 0xD0, 0xAD,
+    0x6D, 0xA0, 0x59, 0xA7, 0x1C, 0x7C, 0x94, 0x97, 0x0D, 0x6C, 0x9A, 0xA4, 0xA2, 0x9A, 0x76, 0xE9,
+    0xC3, 0xDA, 0xAD, 0x91, 0xD2, 0xAC, 0x91, 0xC9, 0x29, 0xC9, 0x09, 0xC4, 0xCA, 0x09, 0xC4, 0xCA,
+    0x09, 0xC3, 0xAD, 0x1D, 0xAA, 0xF1, 0xAF, 0xE2, 0xAD, 0xA9, 0xAC, 0x00, 0x3A, 0xA1, 0x99, 0x6C,
+    0x0C, 0x0A, 0x69, 0xA0, 0x9D, 0x77, 0x6A, 0x72, 0xAC, 0xA7, 0x0A, 0xC9, 0xCA, 0x69, 0xA2, 0x99,
+    0x77, 0x4A, 0xCA, 0x71, 0xE7, 0x09, 0xE9, 0x7D, 0x0C, 0xA7, 0xCA, 0x0D, 0x6A, 0xC9, 0x09, 0xC9,
+    0x5D, 0x2D, 0x49, 0xCA, 0x2D, 0x93, 0xAC, 0x92, 0x9C, 0xA3, 0xD9, 0x29, 0xD2, 0x9F, 0xFC, 0x91,
+    0xFF, 0xE0, 0x9D, 0x59, 0xD0, 0xAD, 0x6D, 0xA0, 0x1A, 0xC9, 0x09, 0x93, 0xC0, 0xC0, 0xA9, 0x29,
+    0xC1, 0xD7, 0x70, 0x97, 0x9C, 0xA5, 0x9C, 0x9C, 0xA4, 0xA2, 0xA9, 0x4E, 0x9C, 0x3D, 0xAA, 0xD9,
+    0x1D, 0x2A, 0xC9, 0x1C, 0x92, 0x9C, 0x90, 0x9C, 0x4C, 0xA0, 0x9C, 0x4C, 0xA0, 0x9C, 0x3A, 0xD1,
+    0xDA, 0xAF, 0x1A, 0xFE, 0x2A, 0xDA, 0x9A, 0xC0, 0x77, 0x19, 0xC7, 0x19, 0xCA, 0xC7, 0x9A, 0x19,
+    0xC7, 0x77, 0x72, 0xAC, 0xA7, 0x1E, 0x70, 0x9E, 0x97, 0xD0, 0xCA, 0x7C, 0xA0, 0xD6, 0xAC, 0x90,
+    0x9C, 0x95, 0xD2, 0xD4, 0x9C, 0xA2, 0xD9, 0x3A, 0xC9, 0x29, 0xCA, 0x3D, 0x92, 0x9D, 0x29, 0xFF,
+    0xC9, 0x1F, 0xFE, 0x09, 0xD5, 0x9D, 0x0A, 0xD6, 0xDA, 0x77, 0x76, 0x9A, 0x97, 0x1A, 0xC9, 0x71,
+    0xDA, 0x40, 0x74, 0x9C, 0x7E, 0x5C, 0x19, 0xC7, 0x7E, 0x9C, 0x3D, 0xAA, 0xD9, 0x1D, 0x2A, 0xC9,
+    0x1C, 0x92, 0x9C, 0x90, 0x9C, 0x4C, 0xA0, 0x9C, 0x4C, 0xA0, 0x9C, 0x3A, 0xD1, 0xDA, 0xAF, 0x1A,
+    0xFE, 0x2A, 0xDA, 0x9A, 0xC7, 0x77, 0xAC, 0x96, 0xAC, 0xA6, 0xAA, 0xA3, 0x6C, 0x72, 0xAA, 0x72,
+    0xC9, 0x72, 0x97, 0x77, 0x77, 0x7A, 0x92, 0xAA, 0x59, 0xDA, 0xAC, 0x79, 0xE9, 0x77, 0x77, 0x77,
+    0xAC, 0xA7, 0x1E, 0x70, 0x9E, 0x97, 0xD0, 0xCA, 0x7C, 0xA0, 0xD6, 0xAC, 0x90, 0x9C, 0x95, 0xD2,
+    0xD4, 0x9C, 0xA2, 0xD9, 0x3A, 0xC9, 0x29, 0xCA, 0x3D, 0x92, 0x9D, 0x29, 0xFF, 0xC9, 0x1F, 0xFE,
+    0x09, 0xD5, 0x9D, 0x0A, 0xD6, 0xDA, 0x76, 0xC7, 0xAA, 0x7C, 0x97, 0x77, 0x72, 0xAA, 0x29, 0xA3,
+    0xDA, 0xAC, 0x93, 0x9E, 0x97, 0x77, 0x1E, 0x9C, 0x3D, 0xAA, 0xD9, 0x1D, 0x2A, 0xC9, 0x1C, 0x92,
+    0x9C, 0x90, 0x9C, 0x4C, 0xA0, 0x9C, 0x4C, 0xA0, 0x9C, 0x3A, 0xD1, 0xDA, 0xAF, 0x1A, 0xFE, 0x2A,
+    0xDA, 0x9A, 0xC0, 0x77, 0x0A, 0xC7, 0x3A, 0xC9, 0x73, 0x97, 0x77, 0x71, 0xA9, 0x2A, 0xA5, 0x9D,
+    0xAA, 0xC7, 0x9E, 0x97, 0x77, 0x77, 0x7A, 0xCA, 0x71, 0xE7, 0x09, 0xE9, 0x7D, 0x0C, 0xA7, 0xCA,
+    0x0D, 0x6A, 0xC9, 0x09, 0xC9, 0x5D, 0x2D, 0x49, 0xCA, 0x2D, 0x93, 0xAC, 0x92, 0x9C, 0xA3, 0xD9,
+    0x29, 0xD2, 0x9F, 0xFC, 0x91, 0xFF, 0xE0, 0x9D, 0x59, 0xD0, 0xAD, 0x6D, 0xA0, 0x73, 0xAC, 0x70,
+    0xAC, 0x97, 0x09, 0x77, 0x70, 0xAA, 0x29, 0xA3, 0xDA, 0xAC, 0x93, 0x9E, 0x97, 0x77, 0x1E, 0x9C,
+    0x3D, 0xAA, 0xD9, 0x1D, 0x2A, 0xC9, 0x1C, 0x92, 0x9C, 0x90, 0x9C, 0x4C, 0xA0, 0x9C, 0x4C, 0xA0,
+    0x9C, 0x3A, 0xD1, 0xDA, 0xAF, 0x1A, 0xFE, 0x2A, 0xDA, 0x9A, 0xC0, 0x49, 0xA9, 0x71, 0x90, 0xC7,
+    0x29, 0xA7, 0x29, 0x77, 0x77, 0x77, 0xA9, 0x2A, 0xA5, 0x9D, 0xAA, 0xC7, 0x9E, 0x97, 0x77, 0x77,
+    0x7A, 0xCA, 0x71, 0xE7, 0x09, 0xE9, 0x7D, 0x0C, 0xA7, 0xCA, 0x0D, 0x6A, 0xC9, 0x09, 0xC9, 0x5D,
+    0x2D, 0x49, 0xCA, 0x2D, 0x93, 0xAC, 0x92, 0x9C, 0xA3, 0xD9, 0x29, 0xD2, 0x9F, 0xFC, 0x91, 0xFF,
+    0xE0, 0x9D, 0x59, 0xD0, 0xAD, 0x6D, 0xA0, 0x19, 0xEA, 0x79, 0xC7, 0xCA, 0x6C, 0xA7, 0x77, 0x77,
+    0x4A, 0xA2, 0x9A, 0x3D, 0xAA, 0xC9, 0x39, 0xE9, 0x77, 0xE9, 0xC3, 0xDA, 0xAD, 0x91, 0xD2, 0xAC,
+    0x91, 0xC9, 0x29, 0xC9, 0x09, 0xC4, 0xCA, 0x09, 0xC4, 0xCA, 0x09, 0xC3, 0xAD, 0x1D, 0xAA, 0xF1,
+    0xAF, 0xE2, 0xAD, 0xA9, 0xAC, 0x00, 0x3A, 0xA1, 0x96, 0x9C, 0x0C, 0x0A, 0x69, 0xA0, 0x9D, 0x77,
+    0x77, 0x29, 0x71, 0xAA, 0x2A, 0xA5, 0x9C, 0xAA, 0xAC, 0x79, 0xE9, 0x77, 0x77, 0x77, 0xAC, 0xA7,
+    0x1E, 0x70, 0x9E, 0x97, 0xD0, 0xCA, 0x7C, 0xA0, 0xD6, 0xAC, 0x90, 0x9C, 0x95, 0xD2, 0xD4, 0x9C,
+    0xA2, 0xD9, 0x3A, 0xC9, 0x29, 0xCA, 0x3D, 0x92, 0x9D, 0x29, 0xFF, 0xC9, 0x1F, 0xFE, 0x09, 0xD5,
+    0x9D, 0x0A, 0xD6, 0xDA, 0x1A, 0xC9, 0x19, 0x3C, 0x0C, 0x0A, 0x92, 0x9A, 0x1D, 0x49, 0x77, 0x29,
+    0x7A, 0xA2, 0x9A, 0x3C, 0xAA, 0xAC, 0x93, 0x9E, 0x97, 0x77, 0x1E, 0x9C, 0x3D, 0xAA, 0xD9, 0x1D,
+    0x2A, 0xC9, 0x1C, 0x92, 0x9C, 0x90, 0x9C, 0x4C, 0xA0, 0x9C, 0x4C, 0xA0, 0x9C, 0x3A, 0xD1, 0xDA,
+    0xAF, 0x1A, 0xFE, 0x2A, 0xDA, 0x9A, 0xC0, 0x77, 0xA9, 0x2A, 0xA5, 0x9D, 0xAA, 0xC7, 0x9E, 0x97,
+    0x77, 0x77, 0x7A, 0xCA, 0x71, 0xE7, 0x09, 0xE9, 0x7D, 0x0C, 0xA7, 0xCA, 0x0D, 0x6A, 0xC9, 0x09,
+    0xC9, 0x5D, 0x2D, 0x49, 0xCA, 0x2D, 0x93, 0xAC, 0x92, 0x9C, 0xA3, 0xD9, 0x29, 0xD2, 0x9F, 0xFC,
+    0x91, 0xFF, 0xE0, 0x9D, 0x59, 0xD0, 0xAD, 0x6D, 0xA7, 0x77, 0x69, 0xA9, 0x71, 0xAC, 0x97, 0x1D,
+    0xA4, 0x72, 0xAA, 0x29, 0xA3, 0xDA, 0xAC, 0x93, 0x9E, 0x97, 0x77, 0x1E, 0x9C, 0x3D, 0xAA, 0xD9,
+    0x1D, 0x2A, 0xC9, 0x1C, 0x92, 0x9C, 0x90, 0x9C, 0x4C, 0xA0, 0x9C, 0x4C, 0xA0, 0x9C, 0x3A, 0xD1,
+    0xDA, 0xAF, 0x1A, 0xFE, 0x2A, 0xDA, 0x9A, 0xC7, 0x77, 0xAC, 0x96, 0xAC, 0xA6, 0xAA, 0xA3, 0x71,
+    0x9F, 0xF0, 0x9F, 0xDA, 0x90, 0x9C, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAF, 0xD2, 0xAF,
+    0xD2, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xFF, 0xA0, 0xFF, 0xC0, 0xFF, 0xC7, 0x6A, 0xA6, 0x9D,
+    0x69, 0xD3, 0x2A, 0xDA, 0x4D, 0x90, 0x9C, 0x2A, 0xA3, 0xAA, 0x1C, 0xA9, 0xAA, 0xE0, 0x9F, 0xAA,
+    0xAA, 0x09, 0xC7, 0x0C, 0xA7, 0xE9, 0x19, 0xA2, 0xFE, 0x3A, 0xEA, 0x97, 0x77, 0x0D, 0x7D, 0x96,
+    0xAA, 0x92, 0x29, 0xAA, 0x97, 0xAA, 0x69, 0xA7, 0x77, 0x71, 0x9F, 0xF0, 0x9F, 0xDA, 0x90, 0x9C,
+    0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAF, 0xD2, 0xAF, 0xD2, 0xAC, 0x96, 0xAC, 0x96, 0xAC,
+    0x96, 0xFF, 0xA0, 0xFF, 0xC0, 0xFF, 0xC0, 0x29, 0xAA, 0x97, 0x9A, 0x7A, 0x77, 0x77, 0x76, 0xAD,
+    0xA4, 0xD9, 0x09, 0xC2, 0xAA, 0x3A, 0xA1, 0xCA, 0x9A, 0xAE, 0x09, 0xFA, 0xAA, 0xA0, 0x9C, 0x70,
+    0xCA, 0x7E, 0x91, 0x9A, 0x2F, 0xE3, 0xAE, 0xA9, 0x00, 0x19, 0xCA, 0x1A, 0x3C, 0x0A, 0x99, 0xA3,
+    0xC1, 0xAC, 0x97, 0x75, 0x9F, 0xF0, 0x9F, 0xDA, 0x90, 0x9C, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAC,
+    0x96, 0xAF, 0xD2, 0xAF, 0xD2, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xFF, 0xA0, 0xFF, 0xC0, 0xFF,
+    0xC0, 0x19, 0xCA, 0x1C, 0x3C, 0x0A, 0xA0, 0xA3, 0xC1, 0xAC, 0x97, 0x77, 0x72, 0xAD, 0xA4, 0xD9,
+    0x09, 0xC2, 0xAA, 0x3A, 0xA1, 0xCA, 0x9A, 0xAE, 0x09, 0xFA, 0xAA, 0xA0, 0x9C, 0x70, 0xCA, 0x7E,
+    0x91, 0x9A, 0x2F, 0xE3, 0xAE, 0xA9, 0x00, 0x77, 0x1A, 0xA7, 0xC7, 0xAC, 0x4C, 0x96, 0xAD, 0x94,
+    0xA9, 0x1C, 0x97, 0x75, 0x9F, 0xF0, 0x9F, 0xDA, 0x90, 0x9C, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAC,
+    0x96, 0xAF, 0xD2, 0xAF, 0xD2, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xFF, 0xA0, 0xFF, 0xC0, 0xFF,
+    0xC0, 0x70, 0xA9, 0x3A, 0x92, 0xC3, 0xAD, 0x1A, 0xC2, 0x9A, 0x09, 0xC0, 0x93, 0x93, 0x97, 0x77,
+    0x3A, 0xDA, 0x5D, 0x90, 0x9C, 0x3A, 0xA3, 0xAA, 0x2C, 0xA9, 0xAA, 0xE1, 0x9F, 0xAA, 0xAA, 0x19,
+    0xC7, 0x1C, 0xA7, 0x0E, 0x91, 0x9A, 0x3F, 0xE4, 0xAE, 0xA9, 0x10, 0x0A, 0xC9, 0x73, 0xAC, 0xA2,
+    0xC9, 0x79, 0x90, 0xAD, 0x97, 0x0A, 0x91, 0xC9, 0x74, 0x97, 0x73, 0x9F, 0xF4, 0x9F, 0xDA, 0x94,
+    0x9C, 0x97, 0x2A, 0xC9, 0x72, 0xAC, 0x97, 0x2A, 0xC9, 0x72, 0xAF, 0xD6, 0xAF, 0xD6, 0xAC, 0x97,
+    0x2A, 0xC9, 0x72, 0xAC, 0x97, 0x2F, 0xFA, 0x4F, 0xFC, 0x4F, 0xFC, 0x00, 0x09, 0x72, 0x9C, 0x97,
+    0x19, 0xCA, 0x0A, 0x97, 0x0A, 0xD7, 0x9A, 0x09, 0xC6, 0x93, 0x97, 0x77, 0x6A, 0xDA, 0x6D, 0x90,
+    0x9C, 0x4A, 0xA3, 0xAA, 0x3C, 0xA9, 0xAA, 0xE2, 0x9F, 0xAA, 0xAA, 0x29, 0xC7, 0x2C, 0xA7, 0x1E,
+    0x91, 0x9A, 0x4F, 0xE5, 0xAE, 0xA9, 0x00, 0x59, 0xAA, 0x97, 0x9A, 0x7A, 0x4C, 0x96, 0xAD, 0x94,
+    0xA9, 0x1C, 0x97, 0x09, 0x73, 0x9F, 0xF0, 0x9F, 0xDA, 0x90, 0x9C, 0x96, 0xAC, 0x96, 0xAC, 0x96,
+    0xAC, 0x96, 0xAF, 0xD2, 0xAF, 0xD2, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xFF, 0xA0, 0xFF, 0xC0,
+    0xFF, 0xC0, 0x5A, 0xAA, 0x70, 0xC7, 0xA5, 0xAC, 0x69, 0xDA, 0x49, 0xA1, 0xAA, 0x77, 0x77, 0x2A,
+    0xDA, 0x4D, 0x90, 0x9C, 0x2A, 0xA3, 0xAA, 0x1C, 0xA9, 0xAA, 0xE0, 0x9F, 0xAA, 0xAA, 0x09, 0xC7,
+    0x0C, 0xA7, 0xE9, 0x19, 0xA2, 0xFE, 0x3A, 0xEA, 0x90, 0x19, 0xC9, 0x1A, 0x3C, 0x0A, 0x90, 0xA3,
+    0xC1, 0xAC, 0x97, 0x79, 0x97, 0xD6, 0xC9, 0xAC, 0x4A, 0x29, 0xA7, 0x39, 0xFF, 0x09, 0xFD, 0xA9,
+    0x09, 0xC9, 0x6A, 0xC9, 0x6A, 0xC9, 0x6A, 0xC9, 0x6A, 0xFD, 0x2A, 0xFD, 0x2A, 0xC9, 0x6A, 0xC9,
+    0x6A, 0xC9, 0x6F, 0xFA, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x19, 0xCA, 0x1C, 0x3C, 0x0A, 0xA0, 0xA3,
+    0xC1, 0xAC, 0x97, 0x79, 0xA6, 0x9D, 0x94, 0x9A, 0x1A, 0x97, 0x77, 0x0A, 0xDA, 0x4D, 0x90, 0x9C,
+    0x2A, 0xA3, 0xAA, 0x1C, 0xA9, 0xAA, 0xE0, 0x9F, 0xAA, 0xAA, 0x09, 0xC7, 0x0C, 0xA7, 0xE9, 0x19,
+    0xA2, 0xFE, 0x3A, 0xEA, 0x90, 0x3C, 0x96, 0xAD, 0x94, 0xA9, 0x1C, 0x97, 0x09, 0x73, 0x9F, 0xF0,
+    0x9F, 0xDA, 0x90, 0x9C, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAC, 0x96, 0xAF, 0xD2, 0xAF, 0xD2, 0xAC,
+    0x96, 0xAC, 0x96, 0xAC, 0x96, 0xFF, 0xA0, 0xFF, 0xC0, 0xFF, 0xC7, 0x6A, 0xA6, 0x9D, 0x69, 0xD3,
+    0x3A, 0x96, 0x9D, 0x59, 0xA0, 0x9C, 0x49, 0x39, 0x77, 0x70, 0xAD, 0xA4, 0xD9, 0x09, 0xC2, 0xAA,
+    0x3A, 0xA1, 0xCA, 0x9A, 0xAE, 0x09, 0xFA, 0xAA, 0xA0, 0x9C, 0x70, 0xCA, 0x7E, 0x91, 0x9A, 0x2F,
+    0xE3, 0xAE, 0xA9, 0x77, 0x70, 0xD7, 0xD9, 0x6A, 0xA9, 0x20, 0xAA, 0xA2, 0xC1, 0xA7, 0x71, 0xAD,
+    0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x0A,
+    0xD0, 0xAD, 0x0A, 0xD9, 0x9A, 0xA9, 0x1A, 0x90, 0x99, 0x75, 0xC9, 0x1C, 0x91, 0xC9, 0x1C, 0x91,
+    0xC9, 0x1C, 0xA1, 0xCA, 0x1C, 0xA0, 0x9D, 0x00, 0x3A, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0,
+    0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x94, 0xA9, 0x09,
+    0xD0, 0xAD, 0x00, 0x0A, 0xA0, 0x9D, 0x09, 0xD7, 0x19, 0x2C, 0x91, 0xC9, 0x1C, 0x91, 0xC9, 0x1C,
+    0x91, 0xCA, 0x1C, 0xA1, 0xCA, 0x09, 0xD4, 0x9A, 0x90, 0xAC, 0xA0, 0xDA, 0x00, 0x29, 0xAE, 0xA9,
+    0x4A, 0xDA, 0xAA, 0xDA, 0x2A, 0xD9, 0x29, 0xE1, 0xD9, 0x49, 0xD9, 0x9D, 0x6D, 0xAA, 0xC9, 0x69,
+    0xF9, 0x7F, 0x70, 0xF9, 0x7D, 0xAC, 0x96, 0x9C, 0xAA, 0xD9, 0x5D, 0xA0, 0xFA, 0xAA, 0xF1, 0xAF,
+    0xFD, 0x2A, 0xFF, 0x49, 0xAF, 0xA7, 0x77, 0x71, 0x9A, 0x97, 0x1A, 0xCA, 0x71, 0xE4, 0x19, 0xAD,
+    0xA3, 0x9D, 0xAA, 0xD2, 0xCA, 0x3C, 0xA1, 0xC9, 0x3A, 0xC0, 0x9C, 0x49, 0xC0, 0x9C, 0x93, 0x9C,
+    0x1C, 0xA3, 0xAC, 0x1D, 0xAA, 0xAD, 0xA1, 0x9F, 0xD3, 0x9A, 0xDA, 0x77, 0x72, 0xAA, 0x7D, 0x69,
+    0xD3, 0x49, 0xA9, 0x71, 0x90, 0xA9, 0x71, 0x9A, 0x72, 0x97, 0x77, 0x72, 0x9A, 0xEA, 0x94, 0xAD,
+    0xAA, 0xAD, 0xA2, 0xAD, 0x92, 0x9E, 0x1D, 0x94, 0x9D, 0x99, 0xD6, 0xDA, 0xAC, 0x96, 0x9F, 0x97,
+    0xF7, 0x0F, 0x97, 0xDA, 0xC9, 0x69, 0xCA, 0xAD, 0x95, 0xDA, 0x0F, 0xAA, 0xAF, 0x1A, 0xFF, 0xD2,
+    0xAF, 0xF4, 0x9A, 0xFA, 0x77, 0x29, 0xAA, 0x97, 0xAA, 0x69, 0xA7, 0x77, 0x77, 0x59, 0xAD, 0xA3,
+    0x9D, 0xAA, 0xD2, 0xCA, 0x3C, 0xA1, 0xC9, 0x3A, 0xC0, 0x9C, 0x49, 0xC0, 0x9C, 0x93, 0x9C, 0x1C,
+    0xA3, 0xAC, 0x1D, 0xAA, 0xAD, 0xA1, 0x9F, 0xD3, 0x9A, 0xDA, 0x20, 0x77, 0x49, 0xC9, 0x73, 0x9C,
+    0xAC, 0x97, 0x19, 0xA2, 0xA9, 0x77, 0x70, 0x9A, 0xEA, 0x97, 0xAD, 0xAA, 0xAD, 0xA2, 0xAA, 0x0A,
+    0xD9, 0x29, 0xE1, 0xC9, 0x0D, 0x94, 0x9D, 0x9A, 0xC0, 0x9D, 0x6D, 0xA2, 0xAC, 0x96, 0x9D, 0x2D,
+    0x97, 0xD2, 0xD7, 0x0D, 0x2D, 0x97, 0xD2, 0xAC, 0x96, 0x9C, 0xA2, 0xAD, 0x95, 0xDA, 0x3F, 0xAA,
+    0xAF, 0x4A, 0xFF, 0xD5, 0xAF, 0xF7, 0x9A, 0xFA, 0x77, 0x50, 0x71, 0x93, 0xA9, 0x29, 0xA2, 0xAD,
+    0x2C, 0x91, 0xAA, 0x09, 0xC0, 0x9C, 0x79, 0x77, 0x72, 0x9A, 0xDA, 0x49, 0xDA, 0xAD, 0x3C, 0xA3,
+    0xCA, 0x2C, 0x93, 0xAC, 0x19, 0xC4, 0x9C, 0x19, 0xC9, 0x39, 0xC2, 0xCA, 0x3A, 0xC2, 0xDA, 0xAA,
+    0xDA, 0x29, 0xFD, 0x49, 0xAD, 0xA3, 0x76, 0xCA, 0x74, 0xD1, 0x9C, 0x97, 0x19, 0xCA, 0xC9, 0x79,
+    0xA2, 0xA9, 0x77, 0x49, 0xAE, 0xA9, 0x5A, 0xDA, 0xAA, 0xDA, 0x3A, 0xD9, 0x29, 0xE2, 0xD9, 0x49,
+    0xD9, 0x09, 0xD6, 0xDA, 0x0A, 0xC9, 0x69, 0xD0, 0xD9, 0x7D, 0x0D, 0x70, 0xD0, 0xD9, 0x7D, 0x0A,
+    0xC9, 0x69, 0xCA, 0x0A, 0xD9, 0x5D, 0xA1, 0xFA, 0xAA, 0xF2, 0xAF, 0xFD, 0x3A, 0xFF, 0x59, 0xAF,
+    0xA7, 0x70, 0x0A, 0x97, 0x19, 0xCA, 0x71, 0x9C, 0xA0, 0xC9, 0x70, 0xAD, 0x7A, 0xA1, 0xC7, 0x39,
+    0x77, 0x75, 0x9A, 0xDA, 0x59, 0xDA, 0xAD, 0x4C, 0xA3, 0xCA, 0x3C, 0x93, 0xAC, 0x29, 0xC4, 0x9C,
+    0x29, 0xC9, 0x39, 0xC3, 0xCA, 0x3A, 0xC3, 0xDA, 0xAA, 0xDA, 0x39, 0xFD, 0x59, 0xAD, 0xA2, 0x79,
+    0xAA, 0x73, 0xA9, 0x71, 0x99, 0x69, 0xC9, 0x70, 0x9C, 0xAC, 0x96, 0x9A, 0x2A, 0x97, 0x72, 0x9A,
+    0xEA, 0x94, 0xAD, 0xAA, 0xAD, 0xA2, 0xAD, 0x92, 0x9E, 0x1D, 0x94, 0x9D, 0x99, 0xD6, 0xDA, 0xAC,
+    0x96, 0x9F, 0x97, 0xF7, 0x0F, 0x97, 0xDA, 0xC9, 0x69, 0xCA, 0xAD, 0x95, 0xDA, 0x0F, 0xAA, 0xAF,
+    0x1A, 0xFF, 0xD2, 0xAF, 0xF4, 0x9A, 0xFA, 0x77, 0x59, 0xA9, 0x70, 0xC7, 0xAA, 0x59, 0x09, 0x5D,
+    0x6C, 0xAA, 0xC4, 0xA9, 0x19, 0xA7, 0x77, 0x71, 0x9A, 0xDA, 0x39, 0xDA, 0xAD, 0x2C, 0xA3, 0xCA,
+    0x1C, 0x93, 0xAC, 0x09, 0xC4, 0x9C, 0x09, 0xC9, 0x39, 0xC1, 0xCA, 0x3A, 0xC1, 0xDA, 0xAA, 0xDA,
+    0x19, 0xFD, 0x39, 0xAD, 0xA2, 0x39, 0xC9, 0x09, 0x96, 0xC0, 0xC9, 0x99, 0x6C, 0x1D, 0x77, 0x6A,
+    0x72, 0x9D, 0x70, 0x9C, 0x0A, 0xC7, 0x93, 0x95, 0x9A, 0xEA, 0x94, 0xAD, 0xAA, 0xAD, 0xA2, 0xAD,
+    0x92, 0x9E, 0x1D, 0x94, 0x9D, 0x99, 0xD6, 0xDA, 0xAC, 0x96, 0x9F, 0x97, 0xF7, 0x0F, 0x97, 0xDA,
+    0xC9, 0x69, 0xCA, 0xAD, 0x95, 0xDA, 0x0F, 0xAA, 0xAF, 0x1A, 0xFF, 0xD2, 0xAF, 0xF4, 0x9A, 0xFA,
+    0x77, 0x19, 0xC9, 0x1A, 0x3C, 0x0A, 0x90, 0xA3, 0xC1, 0xAC, 0x97, 0x79, 0x97, 0xD6, 0xC9, 0xAC,
+    0x4A, 0x29, 0xA7, 0x77, 0x9A, 0xDA, 0x39, 0xDA, 0xAD, 0x2C, 0xA3, 0xCA, 0x1C, 0x93, 0xAC, 0x09,
+    0xC4, 0x9C, 0x09, 0xC9, 0x39, 0xC1, 0xCA, 0x3A, 0xC1, 0xDA, 0xAA, 0xDA, 0x19, 0xFD, 0x39, 0xAD,
+    0xA2, 0x77, 0x19, 0xC9, 0x70, 0x9C, 0xAC, 0x96, 0x9A, 0x2A, 0x97, 0x72, 0x9A, 0xEA, 0x94, 0xAD,
+    0xAA, 0xAD, 0xA2, 0xAD, 0x92, 0x9E, 0x1D, 0x94, 0x9D, 0x99, 0xD6, 0xDA, 0xAC, 0x96, 0x9F, 0x97,
+    0xF7, 0x0F, 0x97, 0xDA, 0xC9, 0x69, 0xCA, 0xAD, 0x95, 0xDA, 0x0F, 0xAA, 0xAF, 0x1A, 0xFF, 0xD2,
+    0xAF, 0xF4, 0x9A, 0xFA, 0x77, 0x77, 0x19, 0xA9, 0x71, 0xAC, 0xA7, 0x1E, 0x40, 0x3C, 0x96, 0xAD,
+    0x5A, 0xA1, 0xC7, 0x19, 0x77, 0x79, 0xAD, 0xA3, 0x9D, 0xAA, 0xD2, 0xCA, 0x3C, 0xA1, 0xC9, 0x3A,
+    0xC0, 0x9C, 0x49, 0xC0, 0x9C, 0x93, 0x9C, 0x1C, 0xA3, 0xAC, 0x1D, 0xAA, 0xAD, 0xA1, 0x9F, 0xD3,
+    0x9A, 0xDA, 0x77, 0x71, 0x9C, 0xA6, 0x9D, 0x6A, 0xAA, 0x30, 0x77, 0x4C, 0x73, 0x9C, 0x73, 0xCA,
+    0x77, 0x77, 0x76, 0xA2, 0x9A, 0xF9, 0x19, 0xC1, 0xAD, 0xAA, 0xAE, 0x0A, 0xA0, 0xAD, 0x92, 0x9F,
+    0x1D, 0x94, 0x9D, 0x90, 0x9D, 0x6D, 0xA0, 0xAC, 0x96, 0x9D, 0x0D, 0x97, 0xD0, 0xD7, 0x0D, 0x0D,
+    0x97, 0xD0, 0xAC, 0x96, 0x9C, 0xA0, 0xAD, 0x95, 0xDA, 0x1F, 0xAA, 0xAF, 0x2A, 0xFF, 0xD3, 0xAF,
+    0xF5, 0x9A, 0xFA, 0x77, 0x10, 0x77, 0xC9, 0x79, 0xC7, 0x0C, 0xA7, 0x77, 0x77, 0x69, 0x29, 0xAD,
+    0xA1, 0xA1, 0x9D, 0xAA, 0xD9, 0xC1, 0xCA, 0x3D, 0x91, 0xC9, 0x3A, 0xC1, 0x9C, 0x49, 0xC1, 0x9C,
+    0x93, 0x9C, 0x2C, 0xA3, 0xAC, 0x2D, 0xAA, 0xAD, 0xA2, 0x9F, 0xD4, 0x9A, 0xDA, 0x30, 0x77, 0x1A,
+    0xC7, 0x4A, 0xC9, 0x73, 0x99, 0x77, 0x77, 0x0A, 0x29, 0xAF, 0x91, 0x9C, 0x1A, 0xDA, 0xAA, 0xE0,
+    0xAA, 0x0A, 0xD9, 0x29, 0xF1, 0xD9, 0x49, 0xD9, 0x09, 0xD6, 0xDA, 0x0A, 0xC9, 0x69, 0xD0, 0xD9,
+    0x7D, 0x0D, 0x70, 0xD0, 0xD9, 0x7D, 0x0A, 0xC9, 0x69, 0xCA, 0x0A, 0xD9, 0x5D, 0xA1, 0xFA, 0xAA,
+    0xF2, 0xAF, 0xFD, 0x3A, 0xFF, 0x59, 0xAF, 0xA7, 0x71, 0x19, 0xC7, 0x1A, 0xC9, 0x70, 0x99, 0x97,
+    0x77, 0x72, 0x92, 0x9A, 0xDA, 0x1A, 0x19, 0xDA, 0xAD, 0x9C, 0x1C, 0xA3, 0xD9, 0x1C, 0x93, 0xAC,
+    0x19, 0xC4, 0x9C, 0x19, 0xC9, 0x39, 0xC2, 0xCA, 0x3A, 0xC2, 0xDA, 0xAA, 0xDA, 0x29, 0xFD, 0x49,
+    0xAD, 0xA3, 0x49, 0xAA, 0x74, 0xA9, 0x72, 0x99, 0x77, 0x77, 0x76, 0xA2, 0x9A, 0xF9, 0x19, 0xC1,
+    0xAD, 0xAA, 0xAE, 0x0A, 0xA0, 0xAD, 0x92, 0x9F, 0x1D, 0x94, 0x9D, 0x90, 0x9D, 0x6D, 0xA0, 0xAC,
+    0x96, 0x9D, 0x0D, 0x97, 0xD0, 0xD7, 0x0D, 0x0D, 0x97, 0xD0, 0xAC, 0x96, 0x9C, 0xA0, 0xAD, 0x95,
+    0xDA, 0x1F, 0xAA, 0xAF, 0x2A, 0xFF, 0xD3, 0xAF, 0xF5, 0x9A, 0xFA, 0x77, 0x10, 0x29, 0xAA, 0x97,
+    0x0A, 0xA7, 0x9A, 0x77, 0x77, 0x76, 0x92, 0x9A, 0xDA, 0x1A, 0x19, 0xDA, 0xAD, 0x9C, 0x1C, 0xA3,
+    0xD9, 0x1C, 0x93, 0xAC, 0x19, 0xC4, 0x9C, 0x19, 0xC9, 0x39, 0xC2, 0xCA, 0x3A, 0xC2, 0xDA, 0xAA,
+    0xDA, 0x29, 0xFD, 0x49, 0xAD, 0xA3, 0x3A, 0xC9, 0x09, 0xA7, 0xC0, 0xA9, 0x99, 0x7C, 0x1D, 0x77,
+    0x77, 0x92, 0x9A, 0xF9, 0x19, 0xC1, 0xAD, 0xAA, 0xAE, 0x0A, 0xA0, 0xAD, 0x92, 0x9F, 0x1D, 0x94,
+    0x9D, 0x90, 0x9D, 0x6D, 0xA0, 0xAC, 0x96, 0x9D, 0x0D, 0x97, 0xD0, 0xD7, 0x0D, 0x0D, 0x97, 0xD0,
+    0xAC, 0x96, 0x9C, 0xA0, 0xAD, 0x95, 0xDA, 0x1F, 0xAA, 0xAF, 0x2A, 0xFF, 0xD3, 0xAF, 0xF5, 0x9A,
+    0xFA, 0x77, 0x10, 0x19, 0xCA, 0x1A, 0x4C, 0x0A, 0x99, 0xA4, 0xC1, 0xAC, 0x97, 0x77, 0x71, 0x92,
+    0x9A, 0xDA, 0x1A, 0x19, 0xDA, 0xAD, 0x9C, 0x1C, 0xA3, 0xD9, 0x1C, 0x93, 0xAC, 0x19, 0xC4, 0x9C,
+    0x19, 0xC9, 0x39, 0xC2, 0xCA, 0x3A, 0xC2, 0xDA, 0xAA, 0xDA, 0x29, 0xFD, 0x49, 0xAD, 0xA3, 0x74,
+    0xA2, 0x9A, 0xF9, 0x19, 0xC1, 0xAD, 0xAA, 0xAE, 0x0A, 0xA0, 0xAD, 0x92, 0x9F, 0x1D, 0x94, 0x9D,
+    0x90, 0x9D, 0x6D, 0xA0, 0xAC, 0x96, 0x9D, 0x0D, 0x97, 0xD0, 0xD7, 0x0D, 0x0D, 0x97, 0xD0, 0xAC,
+    0x96, 0x9C, 0xA0, 0xAD, 0x95, 0xDA, 0x1F, 0xAA, 0xAF, 0x2A, 0xFF, 0xD3, 0xAF, 0xF5, 0x9A, 0xFA,
+    0x77, 0x77, 0x49, 0xA9, 0x72, 0xAC, 0xA7, 0x2E, 0x50, 0x70, 0x92, 0x9A, 0xDA, 0x1A, 0x19, 0xDA,
+    0xAD, 0x9C, 0x1C, 0xA3, 0xD9, 0x1C, 0x93, 0xAC, 0x19, 0xC4, 0x9C, 0x19, 0xC9, 0x39, 0xC2, 0xCA,
+    0x3A, 0xC2, 0xDA, 0xAA, 0xDA, 0x29, 0xFD, 0x49, 0xAD, 0xA7, 0x77, 0x5A, 0xA7, 0x0D, 0x79, 0xD4,
+    0x73, 0xE4, 0x9D, 0x9E, 0x49, 0xD9, 0xE4, 0x9D, 0x9A, 0xCA, 0x49, 0xD0, 0xAC, 0xA4, 0x9D, 0x0A,
+    0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D, 0x09, 0xD4, 0x9D, 0x09, 0xDA,
+    0x29, 0xE1, 0xFF, 0xCA, 0x1F, 0xFC, 0x92, 0xAF, 0xD9, 0x77, 0x75, 0x9C, 0xA7, 0x09, 0xD7, 0x0A,
+    0xAA, 0x40, 0x9C, 0x4C, 0x99, 0xC4, 0xC9, 0x9C, 0x92, 0x9C, 0xA9, 0xC9, 0x29, 0xCA, 0x0C, 0x92,
+    0x9C, 0xA0, 0xCA, 0x29, 0xCA, 0x0D, 0x2A, 0xCA, 0x0F, 0xEA, 0x0A, 0xFD, 0xA1, 0xAD, 0xA0, 0xD7,
+    0x39, 0xA9, 0x5A, 0xCA, 0x5D, 0xA2, 0x49, 0x97, 0x29, 0xA7, 0x1C, 0x77, 0x77, 0x77, 0x4E, 0x49,
+    0xD9, 0xE4, 0x9D, 0x9E, 0x49, 0xD9, 0xAC, 0xA4, 0x9D, 0x0A, 0xCA, 0x49, 0xD0, 0xAC, 0xA5, 0xD0,
+    0xAC, 0xA5, 0xD0, 0xAC, 0xA5, 0xD0, 0xAC, 0xA5, 0xD0, 0x9D, 0x49, 0xD0, 0x9D, 0xA2, 0x9E, 0x1F,
+    0xFC, 0xA1, 0xFF, 0xC9, 0x2A, 0xFD, 0x97, 0x50, 0x2A, 0xAA, 0x7C, 0x6A, 0x77, 0x76, 0x9C, 0x4C,
+    0x99, 0xC4, 0xC9, 0x9C, 0x92, 0x9C, 0xA9, 0xC9, 0x29, 0xCA, 0x0C, 0x92, 0x9C, 0xA0, 0xCA, 0x29,
+    0xCA, 0x0D, 0x2A, 0xCA, 0x0F, 0xEA, 0x0A, 0xFD, 0xA1, 0xAD, 0xA0, 0xD0, 0x5C, 0x97, 0x19, 0xC7,
+    0x2C, 0xA7, 0x29, 0x77, 0x77, 0xC7, 0x2A, 0xF4, 0x9E, 0x9E, 0x49, 0xD9, 0x0E, 0x49, 0xD9, 0x0A,
+    0xCA, 0x49, 0xD1, 0xAC, 0xA4, 0x9D, 0x1A, 0xCA, 0x5D, 0x1A, 0xCA, 0x5D, 0x1A, 0xCA, 0x5D, 0x1A,
+    0xCA, 0x5D, 0x19, 0xD4, 0x9D, 0x19, 0xDA, 0x29, 0xE2, 0xFF, 0xCA, 0x2F, 0xFC, 0x93, 0xAF, 0xD9,
+    0x77, 0x49, 0x70, 0x9C, 0x70, 0xCA, 0x79, 0xC7, 0x77, 0x74, 0xA0, 0x9C, 0x4C, 0x9C, 0x09, 0xC4,
+    0xDA, 0x09, 0xC9, 0x29, 0xD1, 0x9C, 0x92, 0x9C, 0xA2, 0xC9, 0x29, 0xCA, 0x2C, 0xA2, 0x9C, 0xA2,
+    0xD2, 0xAC, 0xA2, 0xFE, 0xA2, 0xAF, 0xDA, 0x3A, 0xDA, 0x0D, 0x10, 0x29, 0x97, 0x3C, 0xA7, 0x3D,
+    0x77, 0x76, 0xA7, 0x2A, 0xF4, 0x9E, 0x9E, 0x49, 0xD9, 0x0E, 0x49, 0xD9, 0x0A, 0xCA, 0x49, 0xD1,
+    0xAC, 0xA4, 0x9D, 0x1A, 0xCA, 0x5D, 0x1A, 0xCA, 0x5D, 0x1A, 0xCA, 0x5D, 0x1A, 0xCA, 0x5D, 0x19,
+    0xD4, 0x9D, 0x19, 0xDA, 0x29, 0xE2, 0xFF, 0xCA, 0x2F, 0xFC, 0x93, 0xAF, 0xD9, 0x77, 0x1A, 0x97,
+    0x09, 0xCA, 0x71, 0xAA, 0x77, 0x70, 0xA0, 0x9C, 0x4C, 0x9C, 0x09, 0xC4, 0xDA, 0x09, 0xC9, 0x29,
+    0xD1, 0x9C, 0x92, 0x9C, 0xA2, 0xC9, 0x29, 0xCA, 0x2C, 0xA2, 0x9C, 0xA2, 0xD2, 0xAC, 0xA2, 0xFE,
+    0xA2, 0xAF, 0xDA, 0x3A, 0xDA, 0x0D, 0x10, 0x49, 0x97, 0x39, 0xA7, 0x2A, 0x77, 0x77, 0x73, 0xA7,
+    0x2A, 0xF4, 0x9E, 0x9E, 0x49, 0xD9, 0x0E, 0x49, 0xD9, 0x0A, 0xCA, 0x49, 0xD1, 0xAC, 0xA4, 0x9D,
+    0x1A, 0xCA, 0x5D, 0x1A, 0xCA, 0x5D, 0x1A, 0xCA, 0x5D, 0x1A, 0xCA, 0x5D, 0x19, 0xD4, 0x9D, 0x19,
+    0xDA, 0x29, 0xE2, 0xFF, 0xCA, 0x2F, 0xFC, 0x93, 0xAF, 0xD9, 0x77, 0x2A, 0xAA, 0x71, 0xC7, 0x0A,
+    0x77, 0x77, 0x4A, 0x09, 0xC4, 0xC9, 0xC0, 0x9C, 0x4D, 0xA0, 0x9C, 0x92, 0x9D, 0x19, 0xC9, 0x29,
+    0xCA, 0x2C, 0x92, 0x9C, 0xA2, 0xCA, 0x29, 0xCA, 0x2D, 0x2A, 0xCA, 0x2F, 0xEA, 0x2A, 0xFD, 0xA3,
+    0xAD, 0xA0, 0xD1, 0x29, 0xC9, 0x1A, 0x6C, 0x0C, 0x99, 0xA6, 0xC1, 0xD7, 0x77, 0x5C, 0x72, 0xAF,
+    0x49, 0xE9, 0xE4, 0x9D, 0x90, 0xE4, 0x9D, 0x90, 0xAC, 0xA4, 0x9D, 0x1A, 0xCA, 0x49, 0xD1, 0xAC,
+    0xA5, 0xD1, 0xAC, 0xA5, 0xD1, 0xAC, 0xA5, 0xD1, 0xAC, 0xA5, 0xD1, 0x9D, 0x49, 0xD1, 0x9D, 0xA2,
+    0x9E, 0x2F, 0xFC, 0xA2, 0xFF, 0xC9, 0x3A, 0xFD, 0x97, 0x70, 0x1D, 0x1A, 0x93, 0x9A, 0x0C, 0x0A,
+    0x49, 0x90, 0x9C, 0xA7, 0x77, 0xA0, 0x9C, 0x4C, 0x9C, 0x09, 0xC4, 0xDA, 0x09, 0xC9, 0x29, 0xD1,
+    0x9C, 0x92, 0x9C, 0xA2, 0xC9, 0x29, 0xCA, 0x2C, 0xA2, 0x9C, 0xA2, 0xD2, 0xAC, 0xA2, 0xFE, 0xA2,
+    0xAF, 0xDA, 0x3A, 0xDA, 0x0D, 0x10, 0x77, 0x70, 0xA7, 0x2A, 0xF4, 0x9E, 0x9E, 0x49, 0xD9, 0x0E,
+    0x49, 0xD9, 0x0A, 0xCA, 0x49, 0xD1, 0xAC, 0xA4, 0x9D, 0x1A, 0xCA, 0x5D, 0x1A, 0xCA, 0x5D, 0x1A,
+    0xCA, 0x5D, 0x1A, 0xCA, 0x5D, 0x19, 0xD4, 0x9D, 0x19, 0xDA, 0x29, 0xE2, 0xFF, 0xCA, 0x2F, 0xFC,
+    0x93, 0xAF, 0xD9, 0x77, 0x77, 0x09, 0xCA, 0x71, 0x9D, 0x71, 0xAA, 0xA5, 0x70, 0xA0, 0x9C, 0x4C,
+    0x9C, 0x09, 0xC4, 0xDA, 0x09, 0xC9, 0x29, 0xD1, 0x9C, 0x92, 0x9C, 0xA2, 0xC9, 0x29, 0xCA, 0x2C,
+    0xA2, 0x9C, 0xA2, 0xD2, 0xAC, 0xA2, 0xFE, 0xA2, 0xAF, 0xDA, 0x3A, 0xDA, 0x0D, 0x77, 0x9A, 0x97,
+    0xAC, 0xA7, 0xDA, 0x40, 0x2C, 0xA7, 0x2D, 0x72, 0x99, 0x77, 0x74, 0xAC, 0x95, 0xD9, 0x0D, 0x49,
+    0xD1, 0xAC, 0xA3, 0xD9, 0x2D, 0x29, 0xD3, 0xAD, 0x1D, 0x94, 0xD9, 0xAD, 0x5A, 0xF9, 0x6F, 0x7A,
+    0xD9, 0x7A, 0xD7, 0x0A, 0xD7, 0x0E, 0x70, 0xE7, 0x9E, 0x40, 0x19, 0x97, 0x0D, 0x70, 0xAC, 0x97,
+    0x77, 0x71, 0xC9, 0x39, 0xC9, 0x0D, 0x3A, 0xC1, 0x9C, 0xA2, 0xD2, 0xD2, 0xCA, 0x29, 0xCA, 0x0A,
+    0xC9, 0x3D, 0x0D, 0x49, 0xF5, 0xEA, 0x59, 0xDA, 0x59, 0xD9, 0x59, 0xD5, 0x9D, 0xA3, 0xFC, 0x4E,
+    0xA7, 0x60, 0xAC, 0x95, 0xD9, 0x0D, 0x49, 0xD1, 0xAC, 0xA3, 0xD9, 0x2D, 0x29, 0xD3, 0xAD, 0x1D,
+    0x94, 0xD9, 0xAD, 0x5A, 0xF9, 0x6F, 0x7A, 0xD9, 0x7A, 0xD7, 0x0A, 0xD7, 0x0E, 0x70, 0xE7, 0x9E,
+    0x77, 0x77, 0x77, 0x70, 0x9A, 0x71, 0xD9, 0x70, 0xDA, 0x40, 0x0C, 0x93, 0x9C, 0x92, 0xD3, 0xAC,
+    0x39, 0xCA, 0x2D, 0x4D, 0x2C, 0xA4, 0x9C, 0xA0, 0xAC, 0x95, 0xD0, 0xD6, 0x9F, 0x7E, 0xA7, 0x9D,
+    0xA7, 0x9D, 0x97, 0x9D, 0x79, 0xDA, 0x5F, 0xC2, 0xAA, 0x1E, 0xA3, 0xD7, 0x1D, 0x90, 0x49, 0x97,
+    0x29, 0xA7, 0x1C, 0x77, 0x77, 0x77, 0x4A, 0xC9, 0x5D, 0x90, 0xD4, 0x9D, 0x1A, 0xCA, 0x3D, 0x92,
+    0xD2, 0x9D, 0x3A, 0xD1, 0xD9, 0x4D, 0x9A, 0xD5, 0xAF, 0x96, 0xF7, 0xAD, 0x97, 0xAD, 0x70, 0xAD,
+    0x70, 0xE7, 0x0E, 0x79, 0xE4, 0x39, 0xA7, 0x1C, 0x7A, 0x97, 0x97, 0x77, 0x77, 0x4C, 0x93, 0x9C,
+    0x90, 0xD3, 0xAC, 0x19, 0xCA, 0x2D, 0x2D, 0x2C, 0xA2, 0x9C, 0xA0, 0xAC, 0x93, 0xD0, 0xD4, 0x9F,
+    0x5E, 0xA5, 0x9D, 0xA5, 0x9D, 0x95, 0x9D, 0x59, 0xDA, 0x3F, 0xC4, 0xEA, 0x76, 0x29, 0xCA, 0x1A,
+    0x5C, 0x0A, 0x99, 0xA5, 0xC1, 0xAC, 0x77, 0x77, 0x7A, 0xC9, 0x5D, 0x90, 0xD4, 0x9D, 0x1A, 0xCA,
+    0x3D, 0x92, 0xD2, 0x9D, 0x3A, 0xD1, 0xD9, 0x4D, 0x9A, 0xD5, 0xAF, 0x96, 0xF7, 0xAD, 0x97, 0xAD,
+    0x70, 0xAD, 0x70, 0xE7, 0x0E, 0x79, 0xE4, 0x2C, 0xA1, 0xA3, 0xA9, 0x9A, 0x0C, 0x3A, 0x90, 0xAC,
+    0xA7, 0x77, 0x77, 0x2C, 0x93, 0x9C, 0x90, 0xD3, 0xAC, 0x19, 0xCA, 0x2D, 0x2D, 0x2C, 0xA2, 0x9C,
+    0xA0, 0xAC, 0x93, 0xD0, 0xD4, 0x9F, 0x5E, 0xA5, 0x9D, 0xA5, 0x9D, 0x95, 0x9D, 0x59, 0xDA, 0x3F,
+    0xC4, 0xEA, 0x76, 0x9A, 0xAA, 0xAA, 0xA9, 0xAF, 0xDA, 0x9A, 0xAA, 0xAA, 0xA9, 0xAF, 0xDA, 0x9A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFD, 0x90, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xFF, 0xD7,
+    0x20, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0A, 0xFF, 0xFE, 0x97, 0x70, 0x9A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0A, 0xFF, 0xFE, 0x97, 0x70, 0x9C, 0x29, 0xA9, 0xC2, 0x9A,
+    0x9C, 0x29, 0xA9, 0xC2, 0xAA, 0x9C, 0x2A, 0xA9, 0xC2, 0xAA, 0x9A, 0x2A, 0xA9, 0xA2, 0xAA, 0x9A,
+    0x2A, 0x9A, 0xA2, 0xA9, 0xAA, 0x2A, 0x9A, 0xA2, 0xC9, 0xAA, 0x2C, 0x9A, 0xA2, 0xC9, 0x60, 0x9A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0xFF, 0xE7, 0x77, 0x2A, 0xFF, 0xE0, 0x9A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x00, 0x09, 0x92, 0xE1, 0xAD, 0x19, 0xD2, 0xD9, 0x1A, 0xA9, 0x19, 0x91, 0x9D, 0x90,
+    0x9D, 0x19, 0xD1, 0xDA, 0x1A, 0xA9, 0x00, 0x19, 0x91, 0x9D, 0x90, 0x9D, 0x1A, 0xD1, 0xDA, 0x1A,
+    0xA9, 0x00, 0x09, 0x92, 0xE1, 0xAD, 0x19, 0xD2, 0xD9, 0x1A, 0xA9, 0x09, 0x91, 0x99, 0x2E, 0x0D,
+    0xA1, 0xAD, 0x0E, 0x19, 0xD0, 0xAD, 0x2D, 0x99, 0xD2, 0xAA, 0x90, 0xAA, 0x90, 0x19, 0x91, 0x99,
+    0x19, 0xD9, 0x9D, 0x90, 0x9D, 0x09, 0xD1, 0x9D, 0x0A, 0xD1, 0xDA, 0x0D, 0xA1, 0xAA, 0x90, 0xAA,
+    0x90, 0x19, 0x91, 0x9D, 0x90, 0x9D, 0x1A, 0xD1, 0xDA, 0x1A, 0xA9, 0x00, 0x0E, 0x0E, 0x1A, 0xD0,
+    0xAD, 0x19, 0xD0, 0x9D, 0x2D, 0x90, 0xD9, 0x1A, 0xA9, 0x0A, 0xA9, 0x3C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x7C, 0x7C, 0x99, 0x91, 0xFF, 0x09, 0x99, 0xC9, 0x6C, 0x96, 0xC9, 0x6C, 0x96, 0xC9, 0x6C, 0x96,
+    0xC9, 0x6C, 0x96, 0xC9, 0x6C, 0x96, 0xC9, 0x6A, 0x97, 0x97, 0x30, 0x3C, 0x97, 0xC9, 0x7C, 0x97,
+    0xC9, 0x7C, 0x97, 0xC9, 0x7C, 0xA9, 0x99, 0x1F, 0xF1, 0x99, 0x0C, 0x97, 0xC9, 0x7C, 0x97, 0xC9,
+    0x7C, 0x95, 0x99, 0xCA, 0x99, 0x2A, 0xFD, 0x5C, 0xA7, 0xCA, 0x7C, 0xA7, 0xCA, 0x7A, 0xA7, 0x09,
+    0x75, 0x29, 0x99, 0x99, 0x93, 0xAF, 0xD3, 0xFE, 0x3F, 0xE3, 0xFE, 0x91, 0x9F, 0xE9, 0x1A, 0xFE,
+    0xA1, 0xFF, 0xA1, 0xFF, 0xC0, 0x9F, 0xFC, 0x00, 0x4A, 0xA2, 0xAD, 0xA0, 0xAD, 0xA0, 0xAA, 0x70,
+    0x09, 0xA1, 0xD9, 0x0D, 0xA0, 0x09, 0xA1, 0xD9, 0x0D, 0xA0, 0x09, 0xA3, 0xAA, 0x3A, 0x90, 0xD9,
+    0x2D, 0x29, 0xCA, 0x0D, 0xA2, 0xD9, 0x1A, 0xD0, 0x9A, 0x0A, 0xC0, 0x79, 0x91, 0x99, 0x4C, 0x19,
+    0x09, 0x92, 0xAA, 0x1A, 0x99, 0x92, 0xC2, 0x99, 0xA9, 0x1A, 0xA3, 0xD1, 0x9C, 0x70, 0xC9, 0x7A,
+    0xC7, 0x0C, 0x97, 0xAC, 0x79, 0xC0, 0x99, 0x09, 0x92, 0xCA, 0x09, 0x99, 0x99, 0x19, 0xC1, 0xA9,
+    0x9A, 0xA1, 0xCA, 0x1A, 0xA0, 0xAA, 0x73, 0x19, 0x91, 0x9D, 0x90, 0x9D, 0x19, 0xD1, 0xDA, 0x1A,
+    0xA9, 0x00, 0x19, 0x91, 0x99, 0x19, 0xD9, 0x9D, 0x90, 0x9D, 0x09, 0xD1, 0x9D, 0x0A, 0xD1, 0xDA,
+    0x0D, 0xA1, 0xAA, 0x90, 0xAA, 0x90, 0x77, 0x0C, 0x2C, 0xA1, 0xAA, 0x2A, 0xC1, 0x9C, 0x91, 0xCA,
+    0x19, 0xC9, 0x1C, 0xA1, 0xD2, 0xAA, 0x19, 0xA1, 0x9C, 0x77, 0x00, 0x5A, 0xA2, 0x9C, 0x92, 0xAC,
+    0x3C, 0x94, 0x70, 0xC1, 0xAA, 0x2D, 0x0A, 0xC2, 0x9C, 0x90, 0xD2, 0x9A, 0x1C, 0x97, 0x76, 0x9A,
+    0x19, 0xC2, 0xC9, 0x2A, 0xC9, 0x09, 0xC9, 0x1D, 0x3A, 0xC1, 0xAC, 0x2C, 0x93, 0xC9, 0x1A, 0x91,
+    0x9C, 0x76, 0x2C, 0x93, 0xC9, 0xC9, 0x1C, 0xA0, 0x9C, 0x90, 0x39, 0x19, 0xC9, 0x09, 0xC9, 0x09,
+    0xC9, 0x19, 0xD2, 0x9D, 0x29, 0xC9, 0x29, 0x00, 0x93, 0xAC, 0x3A, 0xC9, 0x29, 0xC9, 0x1D, 0x90,
+    0xD9, 0x09, 0xC9, 0x29, 0x20, 0x79, 0xA7, 0x1A, 0xD2, 0xD9, 0x19, 0xD4, 0xDA, 0x1D, 0xA0, 0x9D,
+    0x6D, 0xA3, 0x9D, 0x96, 0x9D, 0xA2, 0xDA, 0x70, 0x9D, 0x90, 0xE5, 0x9A, 0x2A, 0xFC, 0x6D, 0x92,
+    0xF2, 0x9C, 0xA1, 0xDA, 0x2F, 0x2A, 0xCA, 0x6F, 0xD1, 0xAA, 0xA5, 0xAD, 0xAA, 0xE7, 0x0A, 0xE1,
+    0xF6, 0xAE, 0x3E, 0xA4, 0xAE, 0x94, 0xEA, 0x2A, 0xEA, 0x1D, 0x19, 0xEA, 0x79, 0xD7, 0x69, 0xAA,
+    0x70, 0x29, 0x29, 0xC2, 0xAC, 0x2A, 0xC2, 0xAC, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x29,
+    0x92, 0x99, 0x1E, 0x1E, 0x1E, 0x00, 0x49, 0x7A, 0xC5, 0xAE, 0xA3, 0xDA, 0xF2, 0xA1, 0xDA, 0xCA,
+    0x4D, 0x0D, 0x4D, 0x0D, 0x4D, 0x0D, 0x4D, 0x0C, 0xA4, 0xF5, 0xE9, 0x4A, 0xDA, 0x5A, 0xD6, 0xAD,
+    0x6A, 0xD6, 0xAA, 0x97, 0x70, 0xDA, 0x6D, 0xA6, 0xE5, 0x9E, 0x30, 0x9A, 0xAA, 0xAA, 0xA9, 0xAF,
+    0xDA, 0x6A, 0xA2, 0x9C, 0x0C, 0xA9, 0xAC, 0x90, 0x9E, 0x90, 0x76, 0x99, 0x69, 0xA9, 0xAA, 0x96,
+    0xD7, 0xC9, 0xAA, 0x97, 0xA6, 0x99, 0x3A, 0x09, 0x9A, 0xA9, 0xA9, 0xAA, 0xCA, 0x2D, 0x2A, 0xCA,
+    0x1C, 0xAA, 0xC9, 0xA0, 0xA0, 0xA1, 0x99, 0x39, 0x74, 0x77, 0x1A, 0x96, 0x9C, 0x7C, 0x7A, 0xA7,
+    0xC7, 0xCA, 0x69, 0xC7, 0xC9, 0x6A, 0xC6, 0x9C, 0x96, 0xCA, 0x6A, 0xC7, 0xCA, 0x60, 0x77, 0x4A,
+    0xEA, 0x39, 0xEA, 0x92, 0xDA, 0xAE, 0x1A, 0xCA, 0xAA, 0xD9, 0x1A, 0x3A, 0xCA, 0x0A, 0x92, 0x9D,
+    0x7D, 0x6A, 0xC9, 0x6D, 0x69, 0xC9, 0x6D, 0x6A, 0xC6, 0x9C, 0xA6, 0xD6, 0xD6, 0xAC, 0x94, 0x9D,
+    0x94, 0x9D, 0xA4, 0xAD, 0x94, 0x9D, 0xA5, 0xAC, 0xA5, 0x9D, 0x6A, 0xCA, 0x59, 0xD6, 0xAC, 0xA5,
+    0x9D, 0x69, 0x97, 0x97, 0x77, 0x29, 0xC9, 0x6D, 0x6A, 0xCA, 0x59, 0xD6, 0xAA, 0xA5, 0x9A, 0xA3,
+    0x76, 0xAE, 0xA6, 0xDA, 0xAE, 0x29, 0x90, 0xA3, 0xAC, 0xA1, 0xCA, 0x6D, 0x1C, 0xA6, 0xD1, 0xCA,
+    0x6D, 0x1C, 0xA5, 0x9C, 0xA1, 0xCA, 0x5D, 0x19, 0xCA, 0x39, 0xD9, 0x19, 0xCA, 0x2A, 0xDA, 0x29,
+    0xCA, 0x2A, 0xCA, 0x39, 0xCA, 0x2A, 0xCA, 0x3A, 0xCA, 0x2A, 0xCA, 0x3A, 0xCA, 0x2A, 0xA5, 0x99,
+    0x71, 0x99, 0x39, 0xA9, 0x3D, 0x92, 0xAC, 0xA2, 0x9D, 0x92, 0xDA, 0x2A, 0xDA, 0x77, 0x2A, 0xE9,
+    0x59, 0xDA, 0xAD, 0xA3, 0xA9, 0xA3, 0xD9, 0x19, 0xC5, 0x9C, 0xA1, 0xAC, 0x6C, 0xA1, 0xAC, 0x59,
+    0xCA, 0x1A, 0xC5, 0xAC, 0x2D, 0x49, 0xCA, 0x2D, 0x39, 0xD3, 0xD2, 0xE4, 0xD2, 0xD5, 0xD2, 0xD5,
+    0xD2, 0xD5, 0xD2, 0xA9, 0x69, 0x72, 0x99, 0x2A, 0xA4, 0xE2, 0xD4, 0xE2, 0xD9, 0x3E, 0x70, 0x79,
+    0x97, 0xC9, 0x69, 0xC7, 0xAA, 0x7C, 0x96, 0x9C, 0x3A, 0xC9, 0x0A, 0xC3, 0xD9, 0x0C, 0xA3, 0xAA,
+    0x90, 0xC9, 0x69, 0xC7, 0xD7, 0xCA, 0x69, 0xC7, 0xAC, 0x7C, 0xA6, 0x9C, 0x99, 0xCA, 0x3A, 0xC0,
+    0xAD, 0x3D, 0x0A, 0xAA, 0x3C, 0xA6, 0x9C, 0x96, 0xD7, 0xCA, 0x69, 0xC9, 0x6A, 0xC7, 0xC9, 0x77,
+    0x00, 0x19, 0x2A, 0x09, 0x19, 0x90, 0x99, 0x9A, 0x0A, 0x9C, 0x0A, 0xA0, 0xE2, 0x91, 0x69, 0xA2,
+    0xAA, 0x1A, 0x0C, 0x09, 0xEA, 0x2C, 0x00, 0x0A, 0xAA, 0x1A, 0x3A, 0x3A, 0xAA, 0x3A, 0xA0, 0xE9,
+    0x40, 0x19, 0xA1, 0xA3, 0xAA, 0x90, 0x9C, 0x09, 0xA0, 0xC0, 0x9A, 0x0A, 0xD5, 0x0A, 0xAA, 0x93,
+    0xA2, 0x9A, 0x2C, 0x92, 0xC2, 0x9C, 0x29, 0xA0, 0x19, 0x2A, 0x09, 0x90, 0xC0, 0x99, 0x09, 0xD1,
+    0xC1, 0xA9, 0xC0, 0x9C, 0x09, 0xAA, 0x00, 0x19, 0x91, 0xA0, 0xA9, 0x99, 0x1A, 0x0C, 0x09, 0xC0,
+    0x9C, 0xAC, 0x29, 0xA0, 0xE0, 0x49, 0x4F, 0xD9, 0x2D, 0xA1, 0xAC, 0x2D, 0x3C, 0x91, 0xD3, 0xCA,
+    0x1D, 0x3C, 0xA1, 0xD3, 0xD0, 0x9D, 0x3D, 0x09, 0xD3, 0xD0, 0x9D, 0x29, 0xD0, 0x29, 0x93, 0xA0,
+    0x9A, 0x1A, 0x91, 0xA1, 0xC0, 0xA0, 0x99, 0x0C, 0x0C, 0x9A, 0xA0, 0xC2, 0xAA, 0x0C, 0xA0, 0x9C,
+    0x90, 0xAF, 0x2A, 0xD9, 0x00, 0x19, 0x2A, 0xC3, 0xC3, 0xC3, 0xC2, 0x9C, 0x19, 0xE9, 0x09, 0xA9,
+    0x19, 0x0A, 0x92, 0x9A, 0x2C, 0x91, 0xAC, 0x1D, 0x91, 0xEA, 0x09, 0x99, 0x39, 0x92, 0x99, 0x1A,
+    0xC3, 0x9A, 0x09, 0x0A, 0xA0, 0xE0, 0x69, 0xA2, 0xAA, 0x1A, 0x0C, 0x09, 0xEA, 0x2C, 0x3C, 0x00,
+    0x0A, 0xAA, 0x19, 0x39, 0x3A, 0xAA, 0x3A, 0x99, 0xE5, 0x19, 0xA9, 0x0A, 0x3A, 0xA9, 0x09, 0xC0,
+    0x9A, 0x9A, 0x1C, 0x0C, 0x09, 0xA0, 0x9D, 0x00, 0x0A, 0xAA, 0x92, 0x9A, 0x2A, 0x92, 0xC9, 0x2C,
+    0x29, 0xC2, 0x9A, 0x00, 0x19, 0x3A, 0x09, 0x91, 0xC0, 0x9A, 0x19, 0xD2, 0xC1, 0xC0, 0x9C, 0x09,
+    0xC1, 0x9A, 0xA1, 0x19, 0x91, 0xA0, 0xA9, 0x99, 0x1A, 0x0C, 0x09, 0xC0, 0x9C, 0xAC, 0x29, 0xA0,
+    0xE0, 0x3C, 0x3A, 0xA3, 0xC3, 0xAC, 0x3C, 0x92, 0x9C, 0x3A, 0xC3, 0xCA, 0x3C, 0x93, 0xC9, 0x29,
+    0xC9, 0x29, 0xC9, 0x3C, 0x93, 0xC9, 0x3C, 0xA3, 0xD3, 0xAC, 0x39, 0xC9, 0x3D, 0x3A, 0xC3, 0x9C,
+    0xA3, 0xD4, 0x90, 0x0C, 0x93, 0x9C, 0x4C, 0x93, 0xAC, 0x4C, 0x93, 0xCA, 0x3A, 0xC3, 0x9C, 0x4C,
+    0x93, 0xCA, 0x3C, 0xA3, 0xCA, 0x3C, 0x93, 0xC9, 0x29, 0xC3, 0xAC, 0x3D, 0x3C, 0xA2, 0xAC, 0x92,
+    0xD2, 0x9C, 0xA2, 0xD3, 0x99, 0x20, 0x77, 0x19, 0xC1, 0xC9, 0x5A, 0xC1, 0xC6, 0xCA, 0x0A, 0xC6,
+    0xFC, 0x93, 0xAF, 0xD9, 0x2A, 0xE0, 0x9C, 0x39, 0xEA, 0x0A, 0xC3, 0xD9, 0xC9, 0x0C, 0xA2, 0x9D,
+    0x9C, 0x1C, 0x92, 0xAC, 0xAA, 0xC0, 0x9C, 0x3A, 0xC9, 0xCA, 0x0A, 0xC3, 0xF9, 0x0C, 0xA3, 0xF1,
+    0xC9, 0x3A, 0xE9, 0x9C, 0x49, 0xFF, 0xC9, 0x1F, 0xFC, 0x91, 0x9F, 0xF9, 0x1A, 0xCA, 0xFC, 0xA9,
+    0x1C, 0xA0, 0xAC, 0x6C, 0x90, 0xCA, 0x59, 0xC1, 0xC9, 0x69, 0x19, 0x50, 0x77, 0x1A, 0xF9, 0x39,
+    0xFD, 0x92, 0xAD, 0x96, 0x9D, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xCA, 0x70, 0xAC, 0xA2, 0x9C, 0xAC,
+    0x1A, 0xCA, 0x29, 0xDA, 0x1E, 0x29, 0xC3, 0xAE, 0x1A, 0xC3, 0x9F, 0xFC, 0x91, 0xFF, 0xC9, 0x2F,
+    0xF9, 0x3A, 0xFC, 0xA9, 0x73, 0x77, 0x99, 0x6F, 0xCA, 0x3D, 0x91, 0x9C, 0x92, 0xC9, 0x70, 0xC9,
+    0x79, 0xDA, 0xAA, 0xA9, 0x2A, 0xFD, 0xA4, 0xCA, 0x69, 0xAD, 0xAA, 0xA9, 0x29, 0xFE, 0x49, 0xC9,
+    0x7A, 0xC9, 0x59, 0xDA, 0x6F, 0xCA, 0xA9, 0x91, 0xFF, 0xC9, 0x73, 0x95, 0xAC, 0xA4, 0x9C, 0xA4,
+    0xE4, 0x9C, 0xA4, 0xEA, 0x3A, 0xCA, 0x4F, 0x3A, 0xCA, 0x4D, 0xAC, 0xA2, 0xAC, 0xA4, 0xD9, 0xD2,
+    0xD9, 0x39, 0xD0, 0xAC, 0xA1, 0xD9, 0x19, 0xFF, 0xFE, 0x09, 0xAD, 0xA9, 0xE9, 0xDA, 0x99, 0x1A,
+    0xD1, 0x9D, 0x0D, 0x93, 0xAD, 0x2D, 0xAD, 0x4A, 0xD2, 0x9F, 0x4A, 0xD3, 0xF4, 0xE3, 0x9E, 0x20,
+    0x2F, 0xCA, 0x94, 0x9D, 0xAA, 0xAD, 0xA3, 0x9C, 0x93, 0xD1, 0xFF, 0xF9, 0x1A, 0xCA, 0x3D, 0x92,
+    0xAC, 0x92, 0x9D, 0x3A, 0xFE, 0x93, 0xAF, 0xD9, 0x4A, 0xCA, 0x71, 0xAC, 0xA7, 0x1D, 0xA7, 0x1E,
+    0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x09, 0xAA, 0x97, 0x4F, 0xC9, 0x72, 0xC2, 0xAC, 0x72, 0xC3, 0xC7,
+    0x2C, 0x3C, 0x97, 0x1C, 0x2A, 0xC4, 0xAD, 0xA1, 0xFD, 0x3A, 0xC9, 0x92, 0xFC, 0x4A, 0x94, 0xEA,
+    0xCA, 0x3A, 0xA4, 0xCA, 0x19, 0xC3, 0x9D, 0xA1, 0x9C, 0xA1, 0x9C, 0x93, 0x9A, 0xD0, 0x9C, 0xA2,
+    0xCA, 0x59, 0xC9, 0x9C, 0xA1, 0x9D, 0x29, 0xA9, 0xAC, 0x99, 0xD1, 0x9D, 0x2F, 0xC9, 0x9D, 0x19,
+    0xD2, 0xAE, 0xA0, 0x1C, 0x96, 0xC9, 0x2C, 0x96, 0xC3, 0xCA, 0x59, 0xC3, 0xAA, 0x59, 0xC3, 0xAC,
+    0x19, 0xA1, 0xAC, 0x2F, 0xFF, 0x1A, 0xAC, 0xAA, 0xEA, 0xDA, 0x3C, 0x09, 0xDA, 0x0C, 0x94, 0xC9,
+    0xAC, 0xAC, 0x0C, 0x5C, 0xAC, 0xA9, 0xC9, 0xC5, 0xEA, 0x0E, 0x5A, 0xD9, 0x0E, 0x5A, 0xD1, 0xDA,
+    0x59, 0xD1, 0xAC, 0xA5, 0x9C, 0xA1, 0x9C, 0x92, 0x09, 0x99, 0x71, 0x9F, 0xD9, 0x39, 0x09, 0xD9,
+    0x99, 0xD9, 0x19, 0xC0, 0x9C, 0x93, 0xAC, 0x19, 0xC0, 0x9C, 0x5C, 0x19, 0xC0, 0x9C, 0x19, 0xA1,
+    0xC9, 0x09, 0xC0, 0x9C, 0x1A, 0xC1, 0xC9, 0x09, 0xC0, 0x9C, 0x19, 0xC1, 0xC9, 0x09, 0xC0, 0x9C,
+    0x19, 0xC4, 0x9C, 0x09, 0xC1, 0x9C, 0x49, 0xC0, 0x9C, 0x2D, 0x92, 0xD0, 0x9C, 0x3F, 0xE7, 0x9A,
+    0xAE, 0x00, 0x69, 0x97, 0x0A, 0xA6, 0xFC, 0xA4, 0x99, 0xCA, 0x93, 0xAD, 0x9C, 0x93, 0xAC, 0x9A,
+    0xD9, 0x3C, 0x2D, 0x92, 0x9C, 0x2A, 0xC9, 0x2A, 0xC2, 0xAC, 0x39, 0xCA, 0x09, 0xD9, 0x3F, 0xD9,
+    0x4A, 0xD9, 0xA9, 0x19, 0x99, 0x99, 0x99, 0x99, 0x1A, 0xFE, 0xA1, 0x77, 0x9A, 0xAA, 0xA4, 0xAF,
+    0xC3, 0x9D, 0x91, 0x93, 0xAC, 0x70, 0xD0, 0x94, 0xFE, 0x5C, 0xA7, 0x0C, 0xA0, 0x93, 0x9F, 0xDA,
+    0x5D, 0x70, 0xD7, 0x0A, 0xD7, 0x9F, 0xD4, 0x9F, 0xC7, 0x99, 0x90, 0xFF, 0xFF, 0xFE, 0xA4, 0xD7,
+    0x1D, 0x71, 0xDA, 0xC6, 0xAE, 0x94, 0x9F, 0x79, 0x0D, 0xAC, 0x6A, 0xE9, 0x5F, 0x79, 0x9D, 0x70,
+    0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x93, 0x3F, 0xCA, 0x96, 0x9D, 0xAA, 0xE9, 0x59, 0xC9, 0x3D, 0x29,
+    0xAA, 0xEA, 0xAA, 0xAE, 0xA0, 0x9A, 0xAE, 0xAA, 0xAA, 0xDA, 0xA3, 0xAC, 0x92, 0xAD, 0x5A, 0xFE,
+    0x95, 0xAF, 0xD9, 0x6A, 0xCA, 0x73, 0xAC, 0xA7, 0x3D, 0xA7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7,
+    0x00, 0x69, 0x97, 0x3A, 0xA7, 0x3A, 0xA7, 0x09, 0xAF, 0xCA, 0x4F, 0xDA, 0xAC, 0x3E, 0x1A, 0xA5,
+    0x9D, 0x91, 0xAA, 0x5A, 0xD2, 0xAA, 0x5D, 0xA2, 0xAA, 0x5D, 0xA2, 0xA9, 0x5D, 0xA2, 0xAC, 0x99,
+    0x3A, 0xCA, 0x2A, 0xFC, 0xA0, 0xAD, 0x2A, 0x90, 0x9D, 0xA0, 0xAD, 0x2C, 0x91, 0xCA, 0x2E, 0x90,
+    0xC9, 0x09, 0xD2, 0xFF, 0xE3, 0xFF, 0xD4, 0xAF, 0xCA, 0x97, 0x0C, 0x97, 0x3C, 0x97, 0x72, 0x2A,
+    0xFA, 0x97, 0xFE, 0x96, 0x92, 0x9E, 0x74, 0xD9, 0x73, 0xAC, 0x97, 0x3A, 0xC9, 0x2A, 0xFF, 0xFC,
+    0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x76, 0xAF, 0xFF, 0xCA, 0xAF, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x9E, 0xA9, 0x19, 0x9A, 0x4F, 0xFD, 0xA4, 0xFF, 0xD9, 0x49, 0xAF, 0xDA, 0x77, 0x10,
+    0x3C, 0x6C, 0x4A, 0xEA, 0x1A, 0xE9, 0x91, 0xD0, 0xC2, 0x9C, 0x90, 0xC2, 0x9C, 0x90, 0xC2, 0x9C,
+    0x90, 0xC2, 0x9C, 0xA0, 0xC3, 0xDA, 0xC9, 0x2A, 0xFC, 0x29, 0xF9, 0x3A, 0x20, 0xFF, 0xEA, 0x77,
+    0x7F, 0xFF, 0xAA, 0xAA, 0xAD, 0x9A, 0xAA, 0x94, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x09,
+    0xD7, 0x09, 0xD7, 0x09, 0xD7, 0x09, 0xD7, 0x09, 0xD9, 0x30, 0x7A, 0xFD, 0xA2, 0xAC, 0x6C, 0x91,
+    0xAF, 0xDA, 0x2A, 0xC2, 0xAE, 0x92, 0xAE, 0x95, 0xD5, 0x9C, 0x94, 0x9D, 0x49, 0xD4, 0x9D, 0x90,
+    0x73, 0xCA, 0x7C, 0xA0, 0x9A, 0x4F, 0xA2, 0x9E, 0xA4, 0xAA, 0xD1, 0xA4, 0xFC, 0x3A, 0xDA, 0x93,
+    0xAE, 0x2A, 0xC2, 0xD1, 0xAC, 0x92, 0xDA, 0xD9, 0x3D, 0xA9, 0x75, 0x39, 0x97, 0x0A, 0x97, 0x0C,
+    0xA6, 0x9F, 0xA4, 0xFD, 0x92, 0x9C, 0x9A, 0xA0, 0xD2, 0xAC, 0x0A, 0xA0, 0xAC, 0x2A, 0xC0, 0x9A,
+    0x09, 0xC2, 0xAA, 0x09, 0xA0, 0x9C, 0x2A, 0xA0, 0x9A, 0x09, 0xC2, 0xAA, 0x09, 0xC0, 0x9C, 0x2A,
+    0xC0, 0x9C, 0x09, 0xC2, 0xAC, 0x09, 0xC0, 0x9C, 0x10, 0x4F, 0xCA, 0x69, 0xDA, 0xAA, 0xD9, 0x49,
+    0xC9, 0x3D, 0x49, 0xC9, 0x3A, 0xC9, 0x39, 0xC9, 0x3A, 0xC4, 0xAC, 0x92, 0x9D, 0x19, 0xFF, 0xDA,
+    0x19, 0xFF, 0xC9, 0x39, 0x9D, 0xA7, 0xAA, 0xAE, 0xAA, 0xA4, 0xFF, 0xC7, 0xE7, 0x2E, 0x72, 0xE7,
+    0x2E, 0x60, 0x3A, 0x70, 0x9C, 0x79, 0xC9, 0x7C, 0xA7, 0xD9, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xC9,
+    0x0A, 0xC7, 0x1C, 0xA7, 0x1C, 0xA7, 0x1C, 0x77, 0x00, 0x4A, 0x79, 0xE5, 0x9C, 0xAC, 0xAC, 0x92,
+    0xAC, 0x90, 0xC0, 0x9C, 0x90, 0x9C, 0x91, 0xC1, 0x9C, 0x5C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C,
+    0x40, 0x4A, 0x97, 0x0A, 0xC7, 0x1A, 0xC7, 0x1C, 0xA2, 0x99, 0x99, 0x99, 0x9C, 0xA0, 0xAF, 0xFC,
+    0x79, 0xC9, 0x7C, 0x97, 0xCA, 0x7A, 0xA7, 0x60, 0x4C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x49,
+    0xC2, 0xC1, 0x9C, 0x1A, 0xC9, 0x0C, 0x09, 0xC9, 0x29, 0xCA, 0xCA, 0xC9, 0x49, 0xE7, 0x0A, 0x40,
+    0x79, 0x6C, 0x92, 0x9C, 0x4C, 0x94, 0xAA, 0x2A, 0xA6, 0xCA, 0x09, 0xFF, 0xE9, 0x0C, 0xA6, 0xAA,
+    0x2C, 0x94, 0xAC, 0x4C, 0x39, 0xC7, 0x70, 0x39, 0x6A, 0xCA, 0x4C, 0xAC, 0xAC, 0x2C, 0x90, 0xC0,
+    0x9C, 0x19, 0x1C, 0x19, 0x4C, 0x7C, 0x7C, 0x39, 0x91, 0xC4, 0xCA, 0x0C, 0x09, 0xC2, 0xEA, 0xC4,
+    0xAD, 0x69, 0x30, 0x0A, 0xAA, 0xEA, 0x09, 0xDA, 0x99, 0x91, 0x9D, 0xA4, 0x9C, 0x0C, 0xA3, 0x9A,
+    0x1C, 0xA2, 0xAA, 0x2C, 0xA1, 0xAA, 0x3C, 0xA7, 0xA0, 0x0E, 0xAA, 0xA9, 0x29, 0x99, 0xAD, 0x5E,
+    0x4C, 0xA0, 0xC3, 0xCA, 0x1C, 0x2C, 0xA2, 0xC1, 0xCA, 0x3C, 0x99, 0xA6, 0x09, 0x69, 0xC9, 0x39,
+    0x19, 0xC9, 0x2C, 0x2A, 0xC1, 0x9C, 0x3A, 0xC0, 0x9C, 0x4D, 0xAA, 0x5D, 0xA1, 0xFD, 0x97, 0x10,
+    0x69, 0x09, 0x93, 0xD0, 0xAA, 0x2A, 0xC1, 0x9C, 0x19, 0xC3, 0xC0, 0x9C, 0x93, 0xC9, 0xC9, 0x4D,
+    0xA5, 0xFD, 0xA7, 0x10, 0x39, 0x71, 0x9C, 0x71, 0xCA, 0x70, 0xAC, 0x70, 0xAF, 0xFC, 0xA9, 0xC7,
+    0x2C, 0xA7, 0x2F, 0xFC, 0xA1, 0x9C, 0xA7, 0x19, 0xC7, 0x29, 0x60, 0x49, 0x09, 0x70, 0xCA, 0x09,
+    0xC6, 0xDA, 0x09, 0xD4, 0xD9, 0xA0, 0x9A, 0xAC, 0x2A, 0xC1, 0xA0, 0x9A, 0x0A, 0xC0, 0x9C, 0x2A,
+    0x09, 0xA1, 0xAA, 0x4A, 0x09, 0xA7, 0x0A, 0x09, 0xA7, 0x0A, 0x09, 0xA7, 0x0A, 0x09, 0xA7, 0x0A,
+    0x09, 0xA7, 0x0A, 0x09, 0xA3, 0x69, 0x72, 0xCA, 0x71, 0x9C, 0x72, 0xAC, 0x1A, 0xFF, 0xCA, 0x72,
+    0xCA, 0x70, 0xAC, 0x0A, 0xFF, 0xC9, 0x79, 0xC9, 0x70, 0xCA, 0x71, 0x93, 0x4A, 0x09, 0x97, 0x0A,
+    0x09, 0xA7, 0x0A, 0x09, 0xA7, 0x0A, 0x09, 0xA7, 0x0A, 0x09, 0xA7, 0x0A, 0x09, 0xA3, 0x9C, 0x2A,
+    0x09, 0xA1, 0xA9, 0x0D, 0x1A, 0x09, 0xA0, 0xAC, 0x91, 0xD9, 0xA0, 0x9A, 0x9C, 0x93, 0xDA, 0x09,
+    0xD6, 0xCA, 0x09, 0xC7, 0x0A, 0x09, 0x77, 0x10, 0x39, 0x39, 0x69, 0xC3, 0xCA, 0x5C, 0xA3, 0x9C,
+    0x4A, 0xC5, 0xAC, 0x2A, 0xFF, 0xDA, 0x09, 0xC7, 0x1C, 0xA0, 0xCA, 0x7A, 0xC2, 0xFF, 0xD3, 0x9C,
+    0xA3, 0x9C, 0x94, 0x9C, 0x3C, 0xA6, 0x93, 0x93, 0x39, 0xA7, 0x9D, 0xA5, 0x9C, 0x90, 0xD3, 0xAD,
+    0x1A, 0xAC, 0xA1, 0xC9, 0xA1, 0xA0, 0x9C, 0x3A, 0x1A, 0x6A, 0x1A, 0x6A, 0x1A, 0x49, 0x0A, 0x1A,
+    0x19, 0x09, 0xE1, 0xA0, 0xD9, 0x09, 0xD1, 0xDA, 0x4D, 0xAC, 0x96, 0xD9, 0x76, 0x77, 0xD9, 0x7A,
+    0xC7, 0x0C, 0x70, 0xC4, 0x92, 0xC2, 0xF9, 0x9C, 0x1D, 0x19, 0xCA, 0xC0, 0x9C, 0x92, 0xAC, 0xA0,
+    0xAC, 0x39, 0xC9, 0x0A, 0xC3, 0x9C, 0x19, 0xD9, 0x09, 0xCA, 0x2F, 0xD4, 0xAD, 0xA9, 0x20, 0x77,
+    0x59, 0xAE, 0xA9, 0x2C, 0x93, 0xAD, 0xAA, 0xAE, 0x9C, 0xA3, 0xAD, 0x93, 0xEA, 0x4D, 0x94, 0x9D,
+    0x93, 0x9D, 0x5E, 0xA3, 0xAC, 0x94, 0xCA, 0x9C, 0xA3, 0xD9, 0x3C, 0xA1, 0xD3, 0xD3, 0xCA, 0x2D,
+    0x3D, 0x2C, 0xA3, 0xD3, 0xAC, 0x90, 0xCA, 0x39, 0xCA, 0x3A, 0xEA, 0x4D, 0xA4, 0xFA, 0xAA, 0xF5,
+    0xFF, 0xE4, 0xCA, 0xFF, 0xC4, 0xCA, 0x19, 0xAF, 0xA5, 0x97, 0x60, 0x77, 0x0D, 0x97, 0x9D, 0xA7,
+    0xDA, 0xC6, 0x9C, 0xA9, 0xCA, 0x5D, 0x1D, 0x49, 0xCA, 0x19, 0xCA, 0x3D, 0x92, 0xD2, 0x9D, 0x3A,
+    0xCA, 0x1D, 0x94, 0xD0, 0x9D, 0x5D, 0xAA, 0xDA, 0xAA, 0xAA, 0xAE, 0xAF, 0xFE, 0xAF, 0xFC, 0x09,
+    0xCA, 0x19, 0xCA, 0x2C, 0x92, 0xCA, 0x2C, 0x92, 0xCA, 0x2C, 0x92, 0xCA, 0x2C, 0x92, 0xCA, 0x2C,
+    0x92, 0xCA, 0x2C, 0x92, 0xCA, 0x2C, 0x92, 0xCA, 0x2C, 0x92, 0xCA, 0x2C, 0x92, 0xCA, 0x2C, 0x92,
+    0xCA, 0x00, 0x1A, 0x92, 0xA9, 0x2C, 0x92, 0xCA, 0x2C, 0x92, 0xCA, 0x2C, 0x92, 0xCA, 0x2C, 0x92,
+    0xCA, 0x2C, 0x92, 0xCA, 0x2C, 0x92, 0xCA, 0x2C, 0x92, 0xCA, 0x2C, 0x92, 0xCA, 0x2C, 0x92, 0xCA,
+    0x19, 0xCA, 0x19, 0xCA, 0x0A, 0xFF, 0xC0, 0xAF, 0xDA, 0x9C, 0x69, 0xA6, 0xAA, 0x6A, 0xA6, 0xA9,
+    0x5A, 0x94, 0xCA, 0x4C, 0xA4, 0xCA, 0x4A, 0xFD, 0xAA, 0xFD, 0xA7, 0x49, 0x90, 0x9F, 0xDA, 0x70,
+    0x69, 0xFC, 0x7D, 0x73, 0xC9, 0x72, 0xAC, 0x73, 0xD7, 0x29, 0xCA, 0x72, 0xAC, 0x97, 0x2D, 0x72,
+    0x9D, 0x79, 0x1D, 0xA6, 0x9C, 0xA0, 0xD9, 0x7F, 0xC7, 0x09, 0xEA, 0x71, 0xE9, 0x70, 0x1A, 0xDA,
+    0x1A, 0xD9, 0x1D, 0xAA, 0xCA, 0xAC, 0xAA, 0xC0, 0x9C, 0x3D, 0x91, 0x9A, 0xAA, 0x3A, 0xC3, 0xCA,
+    0xA3, 0xAC, 0x3C, 0x9C, 0x91, 0x9E, 0xAA, 0xCA, 0x0F, 0xCA, 0xAF, 0x2A, 0xDA, 0x1A, 0xD9, 0x00,
+    0x71, 0xAD, 0xA7, 0x0D, 0x90, 0x97, 0x9C, 0x97, 0x2A, 0xC7, 0x3D, 0x73, 0xD7, 0x3C, 0xA7, 0x29,
+    0xC9, 0x72, 0x9C, 0x97, 0x2A, 0xC7, 0x3A, 0xC7, 0x3D, 0x73, 0xD7, 0x3C, 0xA7, 0x29, 0xC9, 0x69,
+    0x91, 0xD6, 0xFE, 0x6A, 0xFC, 0x97, 0x0A, 0xAA, 0x96, 0x0A, 0xC9, 0x0D, 0xA0, 0xDA, 0x77, 0x0A,
+    0xC9, 0x0D, 0xA0, 0xDA, 0x1A, 0xCA, 0x3A, 0x0A, 0xC0, 0xAA, 0x19, 0xC0, 0xCA, 0x1C, 0xA0, 0xAA,
+    0x0A, 0x92, 0xAD, 0x74, 0xE2, 0x9A, 0x0D, 0x09, 0xC9, 0x0A, 0xC0, 0xA9, 0x2A, 0xD9, 0x71, 0x70,
+    0x97, 0x0C, 0x70, 0xAA, 0x70, 0xC7, 0x9C, 0xA9, 0x90, 0x9F, 0xFC, 0x5C, 0x97, 0xAC, 0x79, 0xCA,
+    0x09, 0x99, 0x0A, 0xFF, 0xC2, 0x9C, 0x97, 0xCA, 0x7A, 0xC7, 0x0C, 0xA7, 0x72, 0x77, 0x4A, 0xCA,
+    0x69, 0xAD, 0xA5, 0x9E, 0x95, 0x9E, 0x96, 0xAD, 0x97, 0x0A, 0xFA, 0x70, 0x9A, 0xFA, 0x97, 0x9A,
+    0xF7, 0x2A, 0xC2, 0x99, 0x72, 0xFD, 0xAA, 0x99, 0x69, 0x9A, 0xAA, 0xCA, 0x00, 0x76, 0xCA, 0x97,
+    0x19, 0xE9, 0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0x9E, 0x69, 0xAF, 0x29, 0xAF, 0xCA, 0x3A, 0xEA,
+    0x96, 0xAA, 0x97, 0x72, 0x93, 0x99, 0xAA, 0xFC, 0x90, 0x9D, 0xAA, 0x99, 0x94,
 };
 
 static const EpdGlyph opendyslexic_8_regularGlyphs[] = {
     { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 5, 17, 6, 0, 17, 22, 0 }, // !
-    { 9, 6, 10, 0, 15, 14, 22 }, // "
-    { 17, 15, 19, 1, 14, 64, 36 }, // #
-    { 14, 18, 20, 3, 16, 63, 100 }, // $
-    { 12, 14, 17, 3, 13, 42, 163 }, // %
-    { 14, 16, 16, 1, 15, 56, 205 }, // &
-    { 4, 5, 5, 0, 13, 5, 261 }, // '
-    { 6, 23, 8, 1, 17, 35, 266 }, // (
-    { 6, 23, 7, 0, 17, 35, 301 }, // )
-    { 9, 8, 11, 1, 13, 18, 336 }, // *
-    { 8, 9, 10, 1, 9, 18, 354 }, // +
-    { 5, 6, 6, 0, 3, 8, 372 }, // ,
-    { 8, 2, 10, 1, 6, 4, 380 }, // -
-    { 4, 3, 5, 0, 3, 3, 384 }, // .
-    { 10, 26, 11, 0, 18, 65, 387 }, // /
-    { 9, 13, 11, 1, 13, 30, 452 }, // 0
-    { 8, 13, 10, 1, 13, 26, 482 }, // 1
-    { 9, 13, 11, 1, 13, 30, 508 }, // 2
-    { 9, 13, 11, 1, 13, 30, 538 }, // 3
-    { 9, 13, 11, 1, 13, 30, 568 }, // 4
-    { 9, 13, 11, 1, 13, 30, 598 }, // 5
-    { 9, 13, 11, 1, 13, 30, 628 }, // 6
-    { 9, 13, 11, 1, 13, 30, 658 }, // 7
-    { 10, 13, 12, 1, 13, 33, 688 }, // 8
-    { 9, 13, 11, 1, 13, 30, 721 }, // 9
-    { 4, 10, 5, 0, 10, 10, 751 }, // :
-    { 5, 12, 6, 0, 9, 15, 761 }, // ;
-    { 12, 10, 14, 1, 10, 30, 776 }, // <
-    { 8, 7, 10, 1, 8, 14, 806 }, // =
-    { 12, 10, 14, 1, 10, 30, 820 }, // >
-    { 10, 19, 11, 0, 19, 48, 850 }, // ?
-    { 15, 16, 20, 2, 15, 60, 898 }, // @
-    { 13, 14, 19, 3, 14, 46, 958 }, // A
-    { 11, 14, 16, 3, 14, 39, 1004 }, // B
-    { 12, 17, 17, 2, 16, 51, 1043 }, // C
-    { 13, 15, 18, 3, 15, 49, 1094 }, // D
-    { 10, 15, 15, 3, 15, 38, 1143 }, // E
-    { 9, 15, 14, 3, 15, 34, 1181 }, // F
-    { 14, 15, 19, 2, 15, 53, 1215 }, // G
-    { 12, 15, 18, 3, 15, 45, 1268 }, // H
-    { 4, 15, 8, 2, 15, 15, 1313 }, // I
-    { 7, 19, 13, 3, 15, 34, 1328 }, // J
-    { 11, 15, 17, 3, 15, 42, 1362 }, // K
-    { 9, 15, 15, 3, 15, 34, 1404 }, // L
-    { 15, 15, 21, 3, 15, 57, 1438 }, // M
-    { 12, 15, 18, 3, 15, 45, 1495 }, // N
-    { 13, 16, 19, 3, 15, 52, 1540 }, // O
-    { 10, 15, 15, 3, 15, 38, 1592 }, // P
-    { 15, 18, 17, 1, 15, 68, 1630 }, // Q
-    { 11, 14, 16, 3, 14, 39, 1698 }, // R
-    { 13, 16, 19, 3, 15, 52, 1737 }, // S
-    { 12, 14, 18, 3, 14, 42, 1789 }, // T
-    { 12, 16, 18, 3, 15, 48, 1831 }, // U
-    { 14, 15, 19, 3, 15, 53, 1879 }, // V
-    { 18, 14, 24, 3, 14, 63, 1932 }, // W
-    { 13, 15, 19, 3, 15, 49, 1995 }, // X
-    { 12, 14, 18, 3, 14, 42, 2044 }, // Y
-    { 13, 14, 19, 3, 14, 46, 2086 }, // Z
-    { 6, 23, 8, 1, 18, 35, 2132 }, // [
-    { 6, 16, 8, 1, 13, 24, 2167 }, // <backslash>
-    { 6, 23, 8, 1, 18, 35, 2191 }, // ]
-    { 7, 4, 9, 1, 16, 7, 2226 }, // ^
-    { 11, 3, 13, 1, -1, 9, 2233 }, // _
-    { 6, 3, 7, 0, 13, 5, 2242 }, // `
-    { 10, 11, 14, 2, 11, 28, 2247 }, // a
-    { 10, 16, 14, 2, 15, 40, 2275 }, // b
-    { 8, 12, 12, 2, 11, 24, 2315 }, // c
-    { 10, 16, 14, 2, 15, 40, 2339 }, // d
-    { 10, 10, 14, 2, 10, 25, 2379 }, // e
-    { 6, 14, 11, 2, 14, 21, 2404 }, // f
-    { 9, 15, 13, 2, 10, 34, 2425 }, // g
-    { 10, 15, 14, 2, 15, 38, 2459 }, // h
-    { 4, 15, 8, 2, 15, 15, 2497 }, // i
-    { 7, 19, 11, 2, 15, 34, 2512 }, // j
-    { 10, 14, 14, 2, 14, 35, 2546 }, // k
-    { 5, 14, 9, 2, 14, 18, 2581 }, // l
-    { 15, 10, 20, 2, 10, 38, 2599 }, // m
-    { 10, 10, 14, 2, 10, 25, 2637 }, // n
-    { 10, 10, 14, 2, 10, 25, 2662 }, // o
-    { 11, 15, 14, 1, 10, 42, 2687 }, // p
-    { 12, 14, 16, 2, 10, 42, 2729 }, // q
-    { 7, 9, 11, 2, 9, 16, 2771 }, // r
-    { 9, 10, 13, 2, 10, 23, 2787 }, // s
-    { 8, 13, 12, 2, 13, 26, 2810 }, // t
-    { 9, 10, 13, 2, 10, 23, 2836 }, // u
-    { 11, 10, 15, 2, 10, 28, 2859 }, // v
-    { 13, 10, 17, 2, 10, 33, 2887 }, // w
-    { 11, 10, 15, 2, 10, 28, 2920 }, // x
-    { 10, 15, 14, 2, 10, 38, 2948 }, // y
-    { 10, 10, 14, 2, 10, 25, 2986 }, // z
-    { 8, 16, 10, 1, 13, 32, 3011 }, // {
-    { 2, 15, 4, 1, 12, 8, 3043 }, // |
-    { 8, 16, 10, 1, 13, 32, 3051 }, // }
-    { 6, 4, 8, 1, 13, 6, 3083 }, // ~
-    { 0, 0, 14, 0, 0, 0, 3089 }, //  
-    { 5, 18, 6, 0, 13, 23, 3089 }, // ¡
-    { 8, 16, 12, 2, 14, 32, 3112 }, // ¢
-    { 11, 16, 12, 0, 16, 44, 3144 }, // £
-    { 9, 8, 11, 1, 10, 18, 3188 }, // ¤
-    { 11, 15, 13, 1, 13, 42, 3206 }, // ¥
-    { 2, 15, 4, 1, 12, 8, 3248 }, // ¦
-    { 10, 16, 14, 2, 14, 40, 3256 }, // §
-    { 9, 3, 10, 0, 13, 7, 3296 }, // ¨
-    { 7, 7, 9, 1, 16, 13, 3303 }, // ©
-    { 6, 6, 8, 1, 13, 9, 3316 }, // ª
-    { 9, 8, 11, 1, 8, 18, 3325 }, // «
-    { 8, 5, 10, 1, 6, 10, 3343 }, // ¬
-    { 8, 2, 10, 1, 6, 4, 3353 }, // ­
-    { 7, 7, 9, 1, 18, 13, 3357 }, // ®
-    { 7, 3, 9, 1, 13, 6, 3370 }, // ¯
-    { 9, 8, 10, 0, 14, 18, 3376 }, // °
-    { 8, 10, 10, 1, 9, 20, 3394 }, // ±
-    { 5, 7, 6, 0, 14, 9, 3414 }, // ²
-    { 5, 7, 6, 0, 14, 9, 3423 }, // ³
-    { 3, 4, 5, 1, 13, 3, 3432 }, // ´
-    { 10, 12, 13, 1, 10, 30, 3435 }, // µ
-    { 8, 14, 10, 1, 12, 28, 3465 }, // ¶
-    { 4, 3, 5, 0, 7, 3, 3493 }, // ·
-    { 4, 5, 6, 1, 1, 5, 3496 }, // ¸
-    { 5, 7, 6, 0, 14, 9, 3501 }, // ¹
-    { 6, 6, 8, 1, 12, 9, 3510 }, // º
-    { 9, 8, 11, 1, 8, 18, 3519 }, // »
-    { 15, 16, 18, 2, 15, 60, 3537 }, // ¼
-    { 15, 15, 18, 2, 14, 57, 3597 }, // ½
-    { 15, 15, 18, 2, 14, 57, 3654 }, // ¾
-    { 10, 19, 11, 0, 10, 48, 3711 }, // ¿
-    { 13, 19, 19, 3, 19, 62, 3759 }, // À
-    { 13, 22, 19, 3, 22, 72, 3821 }, // Á
-    { 13, 20, 19, 3, 20, 65, 3893 }, // Â
-    { 13, 19, 19, 3, 19, 62, 3958 }, // Ã
-    { 13, 19, 19, 3, 19, 62, 4020 }, // Ä
-    { 13, 20, 19, 3, 20, 65, 4082 }, // Å
-    { 19, 16, 24, 3, 15, 76, 4147 }, // Æ
-    { 12, 20, 17, 2, 16, 60, 4223 }, // Ç
-    { 10, 19, 15, 3, 19, 48, 4283 }, // È
-    { 10, 22, 15, 3, 22, 55, 4331 }, // É
-    { 10, 19, 15, 3, 19, 48, 4386 }, // Ê
-    { 10, 19, 15, 3, 19, 48, 4434 }, // Ë
-    { 6, 20, 8, 0, 20, 30, 4482 }, // Ì
-    { 4, 23, 8, 2, 23, 23, 4512 }, // Í
-    { 7, 21, 8, 0, 21, 37, 4535 }, // Î
-    { 9, 20, 9, -1, 20, 45, 4572 }, // Ï
-    { 16, 15, 18, 0, 15, 60, 4617 }, // Ð
-    { 12, 18, 18, 3, 18, 54, 4677 }, // Ñ
-    { 13, 20, 19, 3, 19, 65, 4731 }, // Ò
-    { 13, 23, 19, 3, 22, 75, 4796 }, // Ó
-    { 13, 21, 19, 3, 20, 69, 4871 }, // Ô
-    { 13, 20, 19, 3, 19, 65, 4940 }, // Õ
-    { 13, 20, 19, 3, 19, 65, 5005 }, // Ö
-    { 8, 5, 10, 1, 7, 10, 5070 }, // ×
-    { 21, 31, 21, -1, 23, 163, 5080 }, // Ø
-    { 12, 20, 18, 3, 19, 60, 5243 }, // Ù
-    { 12, 23, 18, 3, 22, 69, 5303 }, // Ú
-    { 12, 21, 18, 3, 20, 63, 5372 }, // Û
-    { 12, 20, 18, 3, 19, 60, 5435 }, // Ü
-    { 12, 23, 18, 3, 23, 69, 5495 }, // Ý
-    { 9, 13, 10, 0, 13, 30, 5564 }, // Þ
-    { 10, 13, 12, 1, 13, 33, 5594 }, // ß
-    { 10, 14, 14, 2, 14, 35, 5627 }, // à
-    { 10, 17, 14, 2, 17, 43, 5662 }, // á
-    { 10, 15, 14, 2, 15, 38, 5705 }, // â
-    { 10, 14, 14, 2, 14, 35, 5743 }, // ã
-    { 10, 14, 14, 2, 14, 35, 5778 }, // ä
-    { 10, 15, 14, 2, 15, 38, 5813 }, // å
-    { 16, 11, 20, 2, 11, 44, 5851 }, // æ
-    { 8, 15, 12, 2, 11, 30, 5895 }, // ç
-    { 10, 16, 14, 2, 16, 40, 5925 }, // è
-    { 10, 19, 14, 2, 19, 48, 5965 }, // é
-    { 10, 16, 14, 2, 16, 40, 6013 }, // ê
-    { 10, 16, 14, 2, 16, 40, 6053 }, // ë
-    { 6, 14, 8, 0, 14, 21, 6093 }, // ì
-    { 4, 17, 8, 2, 17, 17, 6114 }, // í
-    { 7, 15, 8, 0, 15, 27, 6131 }, // î
-    { 9, 14, 9, -1, 14, 32, 6158 }, // ï
-    { 13, 14, 15, 1, 14, 46, 6190 }, // ð
-    { 10, 14, 14, 2, 14, 35, 6236 }, // ñ
-    { 10, 16, 14, 2, 16, 40, 6271 }, // ò
-    { 10, 19, 14, 2, 19, 48, 6311 }, // ó
-    { 10, 16, 14, 2, 16, 40, 6359 }, // ô
-    { 10, 16, 14, 2, 16, 40, 6399 }, // õ
-    { 10, 16, 14, 2, 16, 40, 6439 }, // ö
-    { 11, 10, 13, 1, 10, 28, 6479 }, // ÷
-    { 10, 27, 14, 2, 18, 68, 6507 }, // ø
-    { 9, 15, 13, 2, 15, 34, 6575 }, // ù
-    { 9, 18, 13, 2, 18, 41, 6609 }, // ú
-    { 9, 15, 13, 2, 15, 34, 6650 }, // û
-    { 9, 15, 13, 2, 15, 34, 6684 }, // ü
-    { 10, 24, 14, 2, 19, 60, 6718 }, // ý
-    { 8, 17, 10, 1, 14, 34, 6778 }, // þ
-    { 10, 21, 14, 2, 16, 53, 6812 }, // ÿ
-    { 13, 19, 19, 3, 19, 62, 6865 }, // Ā
-    { 10, 14, 14, 2, 14, 35, 6927 }, // ā
-    { 13, 21, 19, 3, 21, 69, 6962 }, // Ă
-    { 10, 16, 14, 2, 16, 40, 7031 }, // ă
-    { 13, 19, 19, 3, 14, 62, 7071 }, // Ą
-    { 10, 15, 14, 2, 11, 38, 7133 }, // ą
-    { 12, 24, 17, 2, 23, 72, 7171 }, // Ć
-    { 8, 17, 12, 2, 16, 34, 7243 }, // ć
-    { 12, 22, 17, 2, 21, 66, 7277 }, // Ĉ
-    { 8, 16, 12, 2, 15, 32, 7343 }, // ĉ
-    { 12, 23, 17, 2, 22, 69, 7375 }, // Ċ
-    { 8, 16, 12, 2, 15, 32, 7444 }, // ċ
-    { 12, 24, 17, 2, 23, 72, 7476 }, // Č
-    { 8, 17, 12, 2, 16, 34, 7548 }, // č
-    { 13, 21, 18, 3, 21, 69, 7582 }, // Ď
-    { 13, 16, 16, 2, 15, 52, 7651 }, // ď
-    { 16, 15, 18, 0, 15, 60, 7703 }, // Đ
-    { 13, 16, 16, 2, 15, 52, 7763 }, // đ
-    { 10, 19, 15, 3, 19, 48, 7815 }, // Ē
-    { 10, 15, 14, 2, 15, 38, 7863 }, // ē
-    { 10, 21, 15, 3, 21, 53, 7901 }, // Ĕ
-    { 10, 17, 14, 2, 17, 43, 7954 }, // ĕ
-    { 10, 20, 15, 3, 20, 50, 7997 }, // Ė
-    { 10, 16, 14, 2, 16, 40, 8047 }, // ė
-    { 10, 19, 15, 3, 15, 48, 8087 }, // Ę
-    { 10, 15, 14, 2, 10, 38, 8135 }, // ę
-    { 10, 21, 15, 3, 21, 53, 8173 }, // Ě
-    { 10, 17, 14, 2, 17, 43, 8226 }, // ě
-    { 14, 20, 19, 2, 20, 70, 8269 }, // Ĝ
-    { 9, 20, 13, 2, 15, 45, 8339 }, // ĝ
-    { 14, 21, 19, 2, 21, 74, 8384 }, // Ğ
-    { 9, 21, 13, 2, 16, 48, 8458 }, // ğ
-    { 14, 20, 19, 2, 20, 70, 8506 }, // Ġ
-    { 9, 20, 13, 2, 15, 45, 8576 }, // ġ
-    { 14, 22, 19, 2, 15, 77, 8621 }, // Ģ
-    { 9, 21, 13, 2, 16, 48, 8698 }, // ģ
-    { 12, 20, 18, 3, 20, 60, 8746 }, // Ĥ
-    { 12, 19, 14, 0, 19, 57, 8806 }, // ĥ
-    { 14, 15, 18, 2, 15, 53, 8863 }, // Ħ
-    { 12, 15, 14, 0, 15, 45, 8916 }, // ħ
-    { 7, 21, 8, 0, 21, 37, 8961 }, // Ĩ
-    { 7, 15, 8, 0, 15, 27, 8998 }, // ĩ
-    { 9, 20, 9, -1, 20, 45, 9025 }, // Ī
-    { 8, 14, 9, 0, 14, 28, 9070 }, // ī
-    { 4, 19, 10, 4, 15, 19, 9098 }, // Į
-    { 5, 19, 8, 1, 15, 24, 9117 }, // į
-    { 4, 21, 8, 2, 21, 21, 9141 }, // İ
-    { 3, 10, 8, 2, 10, 8, 9162 }, // ı
-    { 11, 19, 15, 2, 15, 53, 9170 }, // Ĳ
-    { 13, 20, 16, 2, 15, 65, 9223 }, // ĳ
-    { 8, 22, 13, 3, 18, 44, 9288 }, // Ĵ
-    { 9, 18, 12, 2, 14, 41, 9332 }, // ĵ
-    { 11, 21, 17, 3, 15, 58, 9373 }, // Ķ
-    { 10, 21, 14, 2, 14, 53, 9431 }, // ķ
-    { 8, 9, 11, 1, 9, 18, 9484 }, // ĸ
-    { 9, 20, 15, 3, 20, 45, 9502 }, // Ĺ
-    { 5, 20, 9, 2, 20, 25, 9547 }, // ĺ
-    { 9, 22, 15, 3, 15, 50, 9572 }, // Ļ
-    { 5, 21, 9, 2, 14, 27, 9622 }, // ļ
-    { 9, 15, 15, 3, 15, 34, 9649 }, // Ľ
-    { 7, 14, 10, 2, 14, 25, 9683 }, // ľ
-    { 9, 14, 15, 3, 14, 32, 9708 }, // Ŀ
-    { 7, 14, 10, 2, 14, 25, 9740 }, // ŀ
-    { 16, 23, 15, -4, 18, 92, 9765 }, // Ł
-    { 11, 14, 9, -3, 14, 39, 9857 }, // ł
-    { 12, 20, 18, 3, 20, 60, 9896 }, // Ń
-    { 10, 16, 14, 2, 16, 40, 9956 }, // ń
-    { 12, 21, 18, 3, 15, 63, 9996 }, // Ņ
-    { 10, 16, 14, 2, 10, 40, 10059 }, // ņ
-    { 12, 20, 18, 3, 20, 60, 10099 }, // Ň
-    { 10, 16, 14, 2, 16, 40, 10159 }, // ň
-    { 9, 18, 11, 1, 18, 41, 10199 }, // ŉ
-    { 12, 18, 18, 3, 15, 54, 10240 }, // Ŋ
-    { 10, 14, 14, 2, 10, 35, 10294 }, // ŋ
-    { 13, 20, 19, 3, 19, 65, 10329 }, // Ō
-    { 10, 15, 14, 2, 15, 38, 10394 }, // ō
-    { 13, 22, 19, 3, 21, 72, 10432 }, // Ŏ
-    { 10, 18, 14, 2, 18, 45, 10504 }, // ŏ
-    { 14, 21, 19, 3, 20, 74, 10549 }, // Ő
-    { 13, 17, 15, 1, 17, 56, 10623 }, // ő
-    { 19, 15, 23, 3, 15, 72, 10679 }, // Œ
-    { 17, 11, 20, 2, 11, 47, 10751 }, // œ
-    { 11, 20, 16, 3, 20, 55, 10798 }, // Ŕ
-    { 7, 14, 11, 2, 14, 25, 10853 }, // ŕ
-    { 11, 22, 16, 3, 14, 61, 10878 }, // Ŗ
-    { 8, 18, 11, 1, 9, 36, 10939 }, // ŗ
-    { 11, 20, 16, 3, 20, 55, 10975 }, // Ř
-    { 8, 14, 11, 1, 14, 28, 11030 }, // ř
-    { 13, 22, 19, 3, 21, 72, 11058 }, // Ś
-    { 9, 16, 13, 2, 16, 36, 11130 }, // ś
-    { 13, 21, 19, 3, 20, 69, 11166 }, // Ŝ
-    { 9, 15, 13, 2, 15, 34, 11235 }, // ŝ
-    { 13, 19, 19, 3, 15, 62, 11269 }, // Ş
-    { 9, 14, 13, 2, 10, 32, 11331 }, // ş
-    { 13, 23, 19, 3, 22, 75, 11363 }, // Š
-    { 9, 16, 13, 2, 16, 36, 11438 }, // š
-    { 12, 17, 18, 3, 14, 51, 11474 }, // Ţ
-    { 8, 16, 12, 2, 13, 32, 11525 }, // ţ
-    { 12, 20, 18, 3, 20, 60, 11557 }, // Ť
-    { 8, 14, 12, 2, 14, 28, 11617 }, // ť
-    { 12, 14, 18, 3, 14, 42, 11645 }, // Ŧ
-    { 9, 13, 12, 1, 13, 30, 11687 }, // ŧ
-    { 12, 21, 18, 3, 20, 63, 11717 }, // Ũ
-    { 9, 15, 13, 2, 15, 34, 11780 }, // ũ
-    { 12, 20, 18, 3, 19, 60, 11814 }, // Ū
-    { 9, 14, 13, 2, 14, 32, 11874 }, // ū
-    { 12, 22, 18, 3, 21, 66, 11906 }, // Ŭ
-    { 9, 16, 13, 2, 16, 36, 11972 }, // ŭ
-    { 12, 22, 18, 3, 21, 66, 12008 }, // Ů
-    { 9, 16, 13, 2, 16, 36, 12074 }, // ů
-    { 13, 21, 18, 3, 20, 69, 12110 }, // Ű
-    { 12, 15, 14, 1, 15, 45, 12179 }, // ű
-    { 12, 19, 18, 3, 15, 57, 12224 }, // Ų
-    { 9, 15, 13, 2, 10, 34, 12281 }, // ų
-    { 18, 19, 24, 3, 19, 86, 12315 }, // Ŵ
-    { 13, 15, 17, 2, 15, 49, 12401 }, // ŵ
-    { 12, 20, 18, 3, 20, 60, 12450 }, // Ŷ
-    { 10, 22, 14, 2, 17, 55, 12510 }, // ŷ
-    { 12, 20, 18, 3, 20, 60, 12565 }, // Ÿ
-    { 13, 20, 19, 3, 20, 65, 12625 }, // Ź
-    { 10, 16, 14, 2, 16, 40, 12690 }, // ź
-    { 13, 19, 19, 3, 19, 62, 12730 }, // Ż
-    { 10, 15, 14, 2, 15, 38, 12792 }, // ż
-    { 13, 20, 19, 3, 20, 65, 12830 }, // Ž
-    { 10, 16, 14, 2, 16, 40, 12895 }, // ž
-    { 6, 14, 9, 2, 14, 21, 12935 }, // ſ
-    { 14, 17, 19, 3, 16, 60, 12956 }, // Ơ
-    { 11, 11, 14, 2, 11, 31, 13016 }, // ơ
-    { 12, 15, 15, 1, 15, 45, 13047 }, // Ƥ
-    { 11, 18, 14, 1, 13, 50, 13092 }, // ƥ
-    { 8, 13, 10, 1, 12, 26, 13142 }, // Ʃ
-    { 12, 14, 18, 3, 14, 42, 13168 }, // Ƭ
-    { 8, 15, 12, 2, 15, 30, 13210 }, // ƭ
-    { 12, 18, 18, 3, 14, 54, 13240 }, // Ʈ
-    { 13, 18, 18, 3, 17, 59, 13294 }, // Ư
-    { 11, 11, 14, 2, 11, 31, 13353 }, // ư
-    { 6, 3, 7, 0, 13, 5, 13384 }, // ̀
-    { 3, 4, 5, 1, 13, 3, 13389 }, // ́
-    { 7, 4, 9, 1, 0, 7, 13392 }, // ̂
-    { 6, 4, 8, 1, 13, 6, 13399 }, // ̃
-    { 8, 3, 10, 1, 12, 6, 13405 }, // ̄
-    { 11, 3, 13, 1, 15, 9, 13411 }, // ̅
-    { 7, 5, 9, 1, 13, 9, 13420 }, // ̆
-    { 4, 3, 5, 0, 13, 3, 13429 }, // ̇
-    { 9, 3, 10, 0, 13, 7, 13432 }, // ̈
-    { 4, 4, 5, 0, 11, 4, 13439 }, // ̉
-    { 4, 4, 6, 1, 13, 4, 13443 }, // ̊
-    { 13, 3, 14, 0, 13, 10, 13447 }, // ̋
-    { 7, 4, 9, 1, 13, 7, 13457 }, // ̌
-    { 13, 3, 10, -4, 14, 10, 13464 }, // ̏
-    { 5, 5, 6, 0, 13, 7, 13474 }, // ̒
-    { 5, 5, 6, 0, 12, 7, 13481 }, // ̓
-    { 5, 5, 6, 0, 12, 7, 13488 }, // ̔
-    { 3, 5, 5, 1, 0, 4, 13495 }, // ̘
-    { 3, 5, 5, 1, 0, 4, 13499 }, // ̙
-    { 7, 4, 9, 1, 13, 7, 13503 }, // ̚
-    { 3, 4, 5, 1, 11, 3, 13510 }, // ̛
-    { 2, 3, 4, 1, -1, 2, 13513 }, // ̜
-    { 4, 3, 6, 1, 2, 3, 13515 }, // ̝
-    { 4, 3, 6, 1, -1, 3, 13518 }, // ̞
-    { 4, 4, 6, 1, -1, 4, 13521 }, // ̟
-    { 8, 3, 10, 1, -2, 6, 13525 }, // ̠
-    { 4, 3, 5, 0, 1, 3, 13531 }, // ̣
-    { 9, 3, 10, 0, 0, 7, 13534 }, // ̤
-    { 4, 4, 6, 1, 13, 4, 13541 }, // ̥
-    { 5, 6, 6, 0, 3, 8, 13545 }, // ̦
-    { 4, 5, 6, 1, 1, 5, 13553 }, // ̧
-    { 4, 5, 6, 1, 0, 5, 13558 }, // ̨
-    { 2, 5, 4, 1, -1, 3, 13563 }, // ̩
-    { 6, 3, 8, 1, -1, 5, 13566 }, // ̪
-    { 7, 4, 9, 1, 0, 7, 13571 }, // ̬
-    { 7, 4, 9, 1, 0, 7, 13578 }, // ̭
-    { 6, 4, 8, 1, 13, 6, 13585 }, // ̰
-    { 7, 3, 9, 1, 13, 6, 13591 }, // ̱
-    { 7, 3, 9, 1, -1, 6, 13597 }, // ̲
-    { 6, 4, 8, 1, 13, 6, 13603 }, // ̴
-    { 8, 2, 10, 1, 6, 4, 13609 }, // ̵
-    { 2, 3, 4, 1, -1, 2, 13613 }, // ̹
-    { 6, 4, 8, 1, 0, 6, 13615 }, // ̺
-    { 5, 4, 7, 1, 0, 5, 13621 }, // ̻
-    { 6, 4, 8, 1, 0, 6, 13626 }, // ̼
-    { 5, 4, 7, 1, 13, 5, 13632 }, // ̽
-    { 6, 4, 8, 1, 13, 6, 13637 }, // ͂
-    { 3, 3, 5, 1, 14, 3, 13643 }, // ̓
-    { 9, 8, 10, 0, 18, 18, 13646 }, // ̈́
-    { 6, 3, 8, 1, 13, 5, 13664 }, // ͆
-    { 8, 6, 10, 1, 0, 12, 13669 }, // ͇
-    { 7, 5, 9, 1, 0, 9, 13681 }, // ͈
-    { 5, 5, 7, 1, -1, 7, 13690 }, // ͉
-    { 6, 10, 8, 1, 16, 15, 13697 }, // ͊
-    { 14, 8, 15, 0, 15, 28, 13712 }, // ͋
-    { 10, 9, 12, 1, 9, 23, 13740 }, // ͌
-    { 9, 3, 11, 1, -2, 7, 13763 }, // ͍
-    { 3, 3, 5, 1, 2, 3, 13770 }, // ͎
-    { 14, 3, 16, 1, 0, 11, 13773 }, // ͜
-    { 14, 3, 16, 1, 13, 11, 13784 }, // ͡
-    { 17, 5, 19, 1, -1, 22, 13795 }, // ͢
-    { 13, 14, 19, 3, 14, 46, 13817 }, // Α
-    { 11, 14, 16, 3, 14, 39, 13863 }, // Β
-    { 8, 14, 10, 1, 13, 28, 13902 }, // Γ
-    { 12, 13, 14, 1, 13, 39, 13930 }, // Δ
-    { 10, 15, 15, 3, 15, 38, 13969 }, // Ε
-    { 13, 14, 19, 3, 14, 46, 14007 }, // Ζ
-    { 12, 15, 18, 3, 15, 45, 14053 }, // Η
-    { 13, 16, 19, 3, 15, 52, 14098 }, // Θ
-    { 4, 15, 8, 2, 15, 15, 14150 }, // Ι
-    { 11, 15, 17, 3, 15, 42, 14165 }, // Κ
-    { 14, 15, 19, 3, 15, 53, 14207 }, // Λ
-    { 15, 15, 21, 3, 15, 57, 14260 }, // Μ
-    { 12, 15, 18, 3, 15, 45, 14317 }, // Ν
-    { 11, 12, 13, 1, 12, 33, 14362 }, // Ξ
-    { 13, 16, 19, 3, 15, 52, 14395 }, // Ο
-    { 9, 12, 11, 1, 12, 27, 14447 }, // Π
-    { 10, 15, 15, 3, 15, 38, 14474 }, // Ρ
-    { 8, 13, 10, 1, 12, 26, 14512 }, // Σ
-    { 12, 14, 18, 3, 14, 42, 14538 }, // Τ
-    { 12, 14, 18, 3, 14, 42, 14580 }, // Υ
-    { 17, 18, 23, 3, 16, 77, 14622 }, // Φ
-    { 13, 15, 19, 3, 15, 49, 14699 }, // Χ
-    { 12, 15, 14, 1, 13, 45, 14748 }, // Ψ
-    { 12, 14, 14, 1, 13, 42, 14793 }, // Ω
-    { 12, 12, 16, 2, 11, 36, 14835 }, // α
-    { 10, 20, 12, 1, 16, 50, 14871 }, // β
-    { 10, 15, 12, 1, 10, 38, 14921 }, // γ
-    { 10, 15, 12, 1, 15, 38, 14959 }, // δ
-    { 7, 9, 9, 1, 9, 16, 14997 }, // ε
-    { 9, 14, 10, 0, 12, 32, 15013 }, // ζ
-    { 10, 16, 12, 1, 11, 40, 15045 }, // η
-    { 9, 13, 11, 1, 13, 30, 15085 }, // θ
-    { 5, 11, 9, 2, 11, 14, 15115 }, // ι
-    { 8, 10, 12, 2, 10, 20, 15129 }, // κ
-    { 9, 14, 13, 2, 14, 32, 15149 }, // λ
-    { 10, 12, 13, 1, 10, 30, 15181 }, // μ
-    { 10, 10, 12, 1, 10, 25, 15211 }, // ν
-    { 9, 15, 10, 0, 12, 34, 15236 }, // ξ
-    { 10, 10, 14, 2, 10, 25, 15270 }, // ο
-    { 10, 10, 12, 1, 9, 25, 15295 }, // π
-    { 10, 14, 12, 1, 10, 35, 15320 }, // ρ
-    { 7, 12, 9, 1, 12, 21, 15355 }, // ς
-    { 12, 10, 15, 2, 10, 30, 15376 }, // σ
-    { 9, 10, 11, 1, 9, 23, 15406 }, // τ
-    { 8, 10, 10, 1, 10, 20, 15429 }, // υ
-    { 13, 21, 19, 3, 19, 69, 15449 }, // φ
-    { 12, 13, 14, 1, 9, 39, 15518 }, // χ
-    { 9, 16, 11, 1, 12, 36, 15557 }, // ψ
-    { 12, 10, 14, 1, 9, 30, 15593 }, // ω
-    { 13, 19, 19, 3, 14, 62, 15623 }, // Ạ
-    { 10, 16, 14, 2, 11, 40, 15685 }, // ạ
-    { 13, 21, 19, 3, 21, 69, 15725 }, // Ả
-    { 10, 16, 14, 2, 16, 40, 15794 }, // ả
-    { 13, 24, 19, 3, 24, 78, 15834 }, // Ấ
-    { 10, 19, 14, 2, 19, 48, 15912 }, // ấ
-    { 14, 21, 19, 2, 21, 74, 15960 }, // Ầ
-    { 12, 17, 14, 0, 17, 51, 16034 }, // ầ
-    { 13, 23, 19, 3, 23, 75, 16085 }, // Ẩ
-    { 10, 18, 14, 2, 18, 45, 16160 }, // ẩ
-    { 13, 23, 19, 3, 23, 75, 16205 }, // Ẫ
-    { 10, 18, 14, 2, 18, 45, 16280 }, // ẫ
-    { 13, 25, 19, 3, 20, 82, 16325 }, // Ậ
-    { 10, 20, 14, 2, 15, 50, 16407 }, // ậ
-    { 13, 27, 19, 3, 27, 88, 16457 }, // Ắ
-    { 10, 22, 14, 2, 22, 55, 16545 }, // ắ
-    { 13, 26, 19, 3, 26, 85, 16600 }, // Ằ
-    { 10, 21, 14, 2, 21, 53, 16685 }, // ằ
-    { 13, 27, 19, 3, 27, 88, 16738 }, // Ẳ
-    { 10, 22, 14, 2, 22, 55, 16826 }, // ẳ
-    { 13, 26, 19, 3, 26, 85, 16881 }, // Ẵ
-    { 10, 21, 14, 2, 21, 53, 16966 }, // ẵ
-    { 13, 26, 19, 3, 21, 85, 17019 }, // Ặ
-    { 10, 21, 14, 2, 16, 53, 17104 }, // ặ
-    { 10, 19, 15, 3, 15, 48, 17157 }, // Ẹ
-    { 10, 15, 14, 2, 10, 38, 17205 }, // ẹ
-    { 10, 20, 15, 3, 20, 50, 17243 }, // Ẻ
-    { 10, 17, 14, 2, 17, 43, 17293 }, // ẻ
-    { 10, 19, 15, 3, 19, 48, 17336 }, // Ẽ
-    { 10, 16, 14, 2, 16, 40, 17384 }, // ẽ
-    { 10, 23, 15, 3, 23, 58, 17424 }, // Ế
-    { 11, 17, 14, 2, 17, 47, 17482 }, // ế
-    { 14, 20, 15, -1, 20, 70, 17529 }, // Ề
-    { 12, 18, 14, 0, 18, 54, 17599 }, // ề
-    { 10, 22, 15, 3, 22, 55, 17653 }, // Ể
-    { 10, 19, 14, 2, 19, 48, 17708 }, // ể
-    { 10, 23, 15, 3, 23, 58, 17756 }, // Ễ
-    { 10, 19, 14, 2, 19, 48, 17814 }, // ễ
-    { 10, 23, 15, 3, 19, 58, 17862 }, // Ệ
-    { 10, 21, 14, 2, 16, 53, 17920 }, // ệ
-    { 4, 21, 8, 2, 21, 21, 17973 }, // Ỉ
-    { 4, 15, 8, 2, 15, 15, 17994 }, // ỉ
-    { 4, 19, 8, 2, 15, 19, 18009 }, // Ị
-    { 4, 19, 8, 2, 15, 19, 18028 }, // ị
-    { 13, 20, 19, 3, 15, 65, 18047 }, // Ọ
-    { 10, 15, 14, 2, 10, 38, 18112 }, // ọ
-    { 13, 22, 19, 3, 21, 72, 18150 }, // Ỏ
-    { 10, 17, 14, 2, 17, 43, 18222 }, // ỏ
-    { 16, 21, 20, 3, 20, 84, 18265 }, // Ố
-    { 11, 17, 14, 2, 17, 47, 18349 }, // ố
-    { 14, 22, 19, 2, 21, 77, 18396 }, // Ồ
-    { 12, 18, 14, 0, 18, 54, 18473 }, // ồ
-    { 13, 23, 19, 3, 22, 75, 18527 }, // Ổ
-    { 10, 20, 14, 2, 20, 50, 18602 }, // ổ
-    { 13, 24, 19, 3, 23, 78, 18652 }, // Ỗ
-    { 10, 20, 14, 2, 20, 50, 18730 }, // ỗ
-    { 13, 25, 19, 3, 20, 82, 18780 }, // Ộ
-    { 10, 21, 14, 2, 16, 53, 18862 }, // ộ
-    { 14, 23, 19, 3, 22, 81, 18915 }, // Ớ
-    { 11, 18, 14, 2, 18, 50, 18996 }, // ớ
-    { 14, 22, 19, 3, 21, 77, 19046 }, // Ờ
-    { 11, 16, 14, 2, 16, 44, 19123 }, // ờ
-    { 14, 22, 19, 3, 21, 77, 19167 }, // Ở
-    { 11, 17, 14, 2, 17, 47, 19244 }, // ở
-    { 14, 21, 19, 3, 20, 74, 19291 }, // Ỡ
-    { 11, 16, 14, 2, 16, 44, 19365 }, // ỡ
-    { 14, 21, 19, 3, 16, 74, 19409 }, // Ợ
-    { 11, 16, 14, 2, 11, 44, 19483 }, // ợ
-    { 12, 20, 18, 3, 15, 60, 19527 }, // Ụ
-    { 9, 14, 13, 2, 10, 32, 19587 }, // ụ
-    { 12, 22, 18, 3, 21, 66, 19619 }, // Ủ
-    { 9, 16, 13, 2, 16, 36, 19685 }, // ủ
-    { 13, 22, 18, 3, 21, 72, 19721 }, // Ứ
-    { 11, 17, 14, 2, 17, 47, 19793 }, // ứ
-    { 13, 21, 18, 3, 20, 69, 19840 }, // Ừ
-    { 11, 15, 14, 2, 15, 42, 19909 }, // ừ
-    { 13, 22, 18, 3, 21, 72, 19951 }, // Ử
-    { 11, 16, 14, 2, 16, 44, 20023 }, // ử
-    { 13, 21, 18, 3, 20, 69, 20067 }, // Ữ
-    { 11, 15, 14, 2, 15, 42, 20136 }, // ữ
-    { 13, 22, 18, 3, 17, 72, 20178 }, // Ự
-    { 11, 15, 14, 2, 11, 42, 20250 }, // ự
-    { 12, 19, 18, 3, 19, 57, 20292 }, // Ỳ
-    { 10, 21, 14, 2, 16, 53, 20349 }, // ỳ
-    { 12, 21, 18, 3, 14, 63, 20402 }, // Ỵ
-    { 12, 15, 15, 2, 10, 45, 20465 }, // ỵ
-    { 12, 21, 18, 3, 21, 63, 20510 }, // Ỷ
-    { 10, 23, 14, 2, 18, 58, 20573 }, // ỷ
-    { 12, 20, 18, 3, 20, 60, 20631 }, // Ỹ
-    { 10, 22, 14, 2, 17, 55, 20691 }, // ỹ
-    { 0, 0, 14, 0, 0, 0, 20746 }, //  
-    { 0, 0, 22, 0, 0, 0, 20746 }, //  
-    { 0, 0, 14, 0, 0, 0, 20746 }, //  
-    { 0, 0, 22, 0, 0, 0, 20746 }, //  
-    { 0, 0, 11, 0, 0, 0, 20746 }, //  
-    { 0, 0, 10, 0, 0, 0, 20746 }, //  
-    { 0, 0, 8, 0, 0, 0, 20746 }, //  
-    { 0, 0, 11, 0, 0, 0, 20746 }, //  
-    { 0, 0, 4, 0, 0, 0, 20746 }, //  
-    { 0, 0, 9, 0, 0, 0, 20746 }, //  
-    { 0, 0, 8, 0, 0, 0, 20746 }, //  
-    { 0, 0, 5, 0, 0, 0, 20746 }, // ​
-    { 0, 0, 1, 0, 0, 0, 20746 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 20746 }, // ‍
-    { 0, 0, 1, 0, 0, 0, 20746 }, // ‎
-    { 0, 0, 1, 0, 0, 0, 20746 }, // ‏
-    { 8, 2, 10, 1, 6, 4, 20746 }, // ‐
-    { 8, 2, 10, 1, 6, 4, 20750 }, // ‑
-    { 12, 2, 14, 1, 6, 6, 20754 }, // ‒
-    { 11, 3, 13, 1, 6, 9, 20760 }, // –
-    { 17, 3, 19, 1, 6, 13, 20769 }, // —
-    { 17, 3, 19, 1, 6, 13, 20782 }, // ―
-    { 7, 15, 9, 1, 12, 27, 20795 }, // ‖
-    { 13, 6, 15, 1, -1, 20, 20822 }, // ‗
-    { 5, 6, 6, 0, 15, 8, 20842 }, // ‘
-    { 5, 6, 6, 0, 15, 8, 20850 }, // ’
-    { 5, 6, 6, 0, 3, 8, 20858 }, // ‚
-    { 5, 6, 6, 0, 15, 8, 20866 }, // ‛
-    { 9, 6, 10, 0, 15, 14, 20874 }, // “
-    { 9, 6, 10, 0, 15, 14, 20888 }, // ”
-    { 5, 6, 6, 0, 3, 8, 20902 }, // „
-    { 9, 5, 10, 0, 15, 12, 20910 }, // ‟
-    { 9, 22, 10, 0, 17, 50, 20922 }, // †
-    { 10, 22, 11, 0, 17, 55, 20972 }, // ‡
-    { 11, 10, 11, -1, 12, 28, 21027 }, // •
-    { 5, 6, 7, 1, 8, 8, 21055 }, // ‣
-    { 4, 3, 5, 0, 3, 3, 21063 }, // ․
-    { 4, 3, 5, 0, 3, 3, 21066 }, // ‥
-    { 15, 3, 16, 0, 3, 12, 21069 }, // …
-    { 3, 2, 5, 1, 6, 2, 21081 }, // ‧
-    { 0, 0, 21, 0, 0, 0, 21083 }, //  
-    { 11, 15, 18, 4, 13, 42, 21083 }, // ‰
-    { 5, 6, 6, 0, 15, 8, 21125 }, // ′
-    { 9, 6, 10, 0, 15, 14, 21133 }, // ″
-    { 14, 6, 15, 0, 14, 21, 21147 }, // ‴
-    { 5, 6, 6, 0, 14, 8, 21168 }, // ‵
-    { 8, 6, 9, 0, 14, 12, 21176 }, // ‶
-    { 14, 6, 15, 0, 14, 21, 21188 }, // ‷
-    { 7, 3, 9, 1, 13, 6, 21209 }, // ‸
-    { 5, 8, 7, 1, 8, 10, 21215 }, // ‹
-    { 5, 8, 7, 1, 8, 10, 21225 }, // ›
-    { 18, 17, 22, 3, 15, 77, 21235 }, // ※
-    { 5, 17, 6, 0, 17, 22, 21312 }, // ‼
-    { 10, 21, 12, 1, 20, 53, 21334 }, // ‽
-    { 8, 2, 10, 1, 14, 4, 21387 }, // ‾
-    { 7, 4, 9, 1, 12, 7, 21391 }, // ‿
-    { 11, 12, 13, 1, 16, 33, 21398 }, // ⁂
-    { 10, 14, 18, 4, 13, 35, 21431 }, // ⁄
-    { 19, 19, 21, 1, 19, 91, 21466 }, // ⁇
-    { 13, 19, 17, 1, 19, 62, 21557 }, // ⁈
-    { 13, 20, 14, 0, 19, 65, 21619 }, // ⁉
-    { 10, 26, 12, 1, 18, 65, 21684 }, // ⁒
-    { 0, 0, 80, 0, 0, 0, 21749 }, //  
-    { 5, 7, 6, 0, 14, 9, 21749 }, // ⁰
-    { 5, 6, 6, 0, 14, 8, 21758 }, // ⁴
-    { 5, 7, 6, 0, 14, 9, 21766 }, // ⁵
-    { 5, 7, 6, 0, 14, 9, 21775 }, // ⁶
-    { 5, 7, 6, 0, 14, 9, 21784 }, // ⁷
-    { 5, 7, 6, 0, 14, 9, 21793 }, // ⁸
-    { 5, 7, 6, 0, 14, 9, 21802 }, // ⁹
-    { 10, 10, 14, 2, 10, 25, 21811 }, // ⁿ
-    { 7, 9, 8, 0, 9, 16, 21836 }, // ₀
-    { 5, 7, 6, 0, 4, 9, 21852 }, // ₁
-    { 5, 7, 6, 0, 4, 9, 21861 }, // ₂
-    { 5, 7, 6, 0, 4, 9, 21870 }, // ₃
-    { 5, 7, 6, 0, 4, 9, 21879 }, // ₄
-    { 5, 7, 6, 0, 4, 9, 21888 }, // ₅
-    { 5, 7, 6, 0, 4, 9, 21897 }, // ₆
-    { 5, 7, 6, 0, 4, 9, 21906 }, // ₇
-    { 6, 7, 7, 0, 4, 11, 21915 }, // ₈
-    { 5, 7, 6, 0, 4, 9, 21926 }, // ₉
-    { 6, 23, 8, 1, 17, 35, 21935 }, // ₍
-    { 6, 23, 7, 0, 17, 35, 21970 }, // ₎
-    { 12, 23, 17, 2, 19, 69, 22005 }, // ₡
-    { 12, 17, 17, 2, 16, 51, 22074 }, // ₢
-    { 11, 16, 12, 0, 16, 44, 22125 }, // ₤
-    { 16, 15, 18, 1, 15, 60, 22169 }, // ₦
-    { 13, 15, 15, 1, 15, 49, 22229 }, // ₧
-    { 17, 15, 20, 2, 15, 64, 22278 }, // ₨
-    { 14, 15, 15, 0, 15, 53, 22342 }, // ₩
-    { 14, 13, 18, 2, 13, 46, 22395 }, // ₪
-    { 11, 14, 13, 1, 14, 39, 22441 }, // ₫
-    { 11, 16, 13, 1, 14, 44, 22480 }, // €
-    { 12, 14, 18, 3, 14, 42, 22524 }, // ₮
-    { 15, 15, 16, 0, 15, 57, 22566 }, // ₱
-    { 14, 21, 19, 2, 18, 74, 22623 }, // ₲
-    { 15, 16, 17, 1, 15, 60, 22697 }, // ₴
-    { 8, 13, 12, 2, 12, 26, 22757 }, // ₵
-    { 12, 15, 18, 3, 15, 45, 22783 }, // ₸
-    { 8, 13, 10, 1, 13, 26, 22828 }, // ₹
-    { 10, 13, 12, 1, 12, 33, 22854 }, // ₺
-    { 11, 13, 12, 0, 13, 36, 22887 }, // ₼
-    { 14, 15, 15, -1, 15, 53, 22923 }, // ₽
-    { 11, 11, 13, 1, 10, 31, 22976 }, // ←
-    { 11, 10, 13, 1, 10, 28, 23007 }, // ↑
-    { 11, 11, 13, 1, 10, 31, 23035 }, // →
-    { 11, 10, 13, 1, 10, 28, 23066 }, // ↓
-    { 13, 9, 15, 1, 9, 30, 23094 }, // ↔
-    { 9, 13, 11, 1, 14, 30, 23124 }, // ↕
-    { 9, 8, 11, 1, 8, 18, 23154 }, // ↖
-    { 9, 8, 11, 1, 8, 18, 23172 }, // ↗
-    { 9, 9, 11, 1, 9, 21, 23190 }, // ↘
-    { 9, 9, 11, 1, 9, 21, 23211 }, // ↙
-    { 12, 11, 14, 1, 10, 33, 23232 }, // ⇐
-    { 13, 12, 15, 1, 12, 39, 23265 }, // ⇑
-    { 12, 11, 14, 1, 10, 33, 23304 }, // ⇒
-    { 13, 13, 15, 1, 12, 43, 23337 }, // ⇓
-    { 14, 11, 16, 1, 10, 39, 23380 }, // ⇔
-    { 11, 14, 13, 1, 9, 39, 23419 }, // ⇕
-    { 10, 14, 12, 1, 14, 35, 23458 }, // ∂
-    { 17, 17, 19, 1, 16, 73, 23493 }, // ∅
-    { 12, 13, 14, 1, 13, 39, 23566 }, // ∆
-    { 10, 12, 12, 1, 12, 30, 23605 }, // ∏
-    { 10, 12, 12, 1, 12, 30, 23635 }, // ∐
-    { 8, 13, 10, 1, 12, 26, 23665 }, // ∑
-    { 8, 3, 10, 1, 6, 6, 23691 }, // −
-    { 14, 14, 16, 1, 13, 49, 23697 }, // √
-    { 13, 8, 15, 1, 10, 26, 23746 }, // ∞
-    { 14, 19, 15, 0, 15, 67, 23772 }, // ∫
-    { 4, 10, 5, 0, 10, 10, 23839 }, // ∶
-    { 10, 9, 13, 1, 9, 23, 23849 }, // ≈
-    { 11, 15, 18, 4, 13, 42, 23872 }, // ≠
-    { 13, 13, 15, 1, 12, 43, 23914 }, // ≤
-    { 13, 13, 15, 1, 12, 43, 23957 }, // ≥
+    { 5, 17, 6, 0, 17, 21, 0 }, // !
+    { 9, 6, 10, 0, 15, 19, 21 }, // "
+    { 17, 15, 19, 1, 14, 59, 40 }, // #
+    { 14, 18, 20, 3, 16, 52, 99 }, // $
+    { 12, 14, 17, 3, 13, 43, 151 }, // %
+    { 14, 16, 16, 1, 15, 45, 194 }, // &
+    { 4, 5, 5, 0, 13, 7, 239 }, // '
+    { 6, 23, 8, 1, 17, 34, 246 }, // (
+    { 6, 23, 7, 0, 17, 35, 280 }, // )
+    { 9, 8, 11, 1, 13, 19, 315 }, // *
+    { 8, 9, 10, 1, 9, 14, 334 }, // +
+    { 5, 6, 6, 0, 3, 11, 348 }, // ,
+    { 8, 2, 10, 1, 6, 6, 359 }, // -
+    { 4, 3, 5, 0, 3, 5, 365 }, // .
+    { 10, 26, 11, 0, 18, 38, 370 }, // /
+    { 9, 13, 11, 1, 13, 40, 408 }, // 0
+    { 8, 13, 10, 1, 13, 25, 448 }, // 1
+    { 9, 13, 11, 1, 13, 27, 473 }, // 2
+    { 9, 13, 11, 1, 13, 29, 500 }, // 3
+    { 9, 13, 11, 1, 13, 30, 529 }, // 4
+    { 9, 13, 11, 1, 13, 26, 559 }, // 5
+    { 9, 13, 11, 1, 13, 33, 585 }, // 6
+    { 9, 13, 11, 1, 13, 20, 618 }, // 7
+    { 10, 13, 12, 1, 13, 37, 638 }, // 8
+    { 9, 13, 11, 1, 13, 36, 675 }, // 9
+    { 4, 10, 5, 0, 10, 11, 711 }, // :
+    { 5, 12, 6, 0, 9, 16, 722 }, // ;
+    { 12, 10, 14, 1, 10, 22, 738 }, // <
+    { 8, 7, 10, 1, 8, 10, 760 }, // =
+    { 12, 10, 14, 1, 10, 22, 770 }, // >
+    { 10, 19, 11, 0, 19, 31, 792 }, // ?
+    { 15, 16, 20, 2, 15, 56, 823 }, // @
+    { 13, 14, 19, 3, 14, 39, 879 }, // A
+    { 11, 14, 16, 3, 14, 37, 918 }, // B
+    { 12, 17, 17, 2, 16, 36, 955 }, // C
+    { 13, 15, 18, 3, 15, 35, 991 }, // D
+    { 10, 15, 15, 3, 15, 30, 1026 }, // E
+    { 9, 15, 14, 3, 15, 29, 1056 }, // F
+    { 14, 15, 19, 2, 15, 41, 1085 }, // G
+    { 12, 15, 18, 3, 15, 41, 1126 }, // H
+    { 4, 15, 8, 2, 15, 22, 1167 }, // I
+    { 7, 19, 13, 3, 15, 27, 1189 }, // J
+    { 11, 15, 17, 3, 15, 40, 1216 }, // K
+    { 9, 15, 15, 3, 15, 27, 1256 }, // L
+    { 15, 15, 21, 3, 15, 58, 1283 }, // M
+    { 12, 15, 18, 3, 15, 49, 1341 }, // N
+    { 13, 16, 19, 3, 15, 42, 1390 }, // O
+    { 10, 15, 15, 3, 15, 35, 1432 }, // P
+    { 15, 18, 17, 1, 15, 51, 1467 }, // Q
+    { 11, 14, 16, 3, 14, 42, 1518 }, // R
+    { 13, 16, 19, 3, 15, 39, 1560 }, // S
+    { 12, 14, 18, 3, 14, 25, 1599 }, // T
+    { 12, 16, 18, 3, 15, 42, 1624 }, // U
+    { 14, 15, 19, 3, 15, 41, 1666 }, // V
+    { 18, 14, 24, 3, 14, 56, 1707 }, // W
+    { 13, 15, 19, 3, 15, 40, 1763 }, // X
+    { 12, 14, 18, 3, 14, 31, 1803 }, // Y
+    { 13, 14, 19, 3, 14, 29, 1834 }, // Z
+    { 6, 23, 8, 1, 18, 37, 1863 }, // [
+    { 6, 16, 8, 1, 13, 22, 1900 }, // <backslash>
+    { 6, 23, 8, 1, 18, 36, 1922 }, // ]
+    { 7, 4, 9, 1, 16, 7, 1958 }, // ^
+    { 11, 3, 13, 1, -1, 9, 1965 }, // _
+    { 6, 3, 7, 0, 13, 5, 1974 }, // `
+    { 10, 11, 14, 2, 11, 30, 1979 }, // a
+    { 10, 16, 14, 2, 15, 34, 2009 }, // b
+    { 8, 12, 12, 2, 11, 21, 2043 }, // c
+    { 10, 16, 14, 2, 15, 37, 2064 }, // d
+    { 10, 10, 14, 2, 10, 26, 2101 }, // e
+    { 6, 14, 11, 2, 14, 22, 2127 }, // f
+    { 9, 15, 13, 2, 10, 38, 2149 }, // g
+    { 10, 15, 14, 2, 15, 35, 2187 }, // h
+    { 4, 15, 8, 2, 15, 20, 2222 }, // i
+    { 7, 19, 11, 2, 15, 29, 2242 }, // j
+    { 10, 14, 14, 2, 14, 31, 2271 }, // k
+    { 5, 14, 9, 2, 14, 23, 2302 }, // l
+    { 15, 10, 20, 2, 10, 41, 2325 }, // m
+    { 10, 10, 14, 2, 10, 24, 2366 }, // n
+    { 10, 10, 14, 2, 10, 30, 2390 }, // o
+    { 11, 15, 14, 1, 10, 36, 2420 }, // p
+    { 12, 14, 16, 2, 10, 35, 2456 }, // q
+    { 7, 9, 11, 2, 9, 15, 2491 }, // r
+    { 9, 10, 13, 2, 10, 22, 2506 }, // s
+    { 8, 13, 12, 2, 13, 23, 2528 }, // t
+    { 9, 10, 13, 2, 10, 30, 2551 }, // u
+    { 11, 10, 15, 2, 10, 24, 2581 }, // v
+    { 13, 10, 17, 2, 10, 32, 2605 }, // w
+    { 11, 10, 15, 2, 10, 25, 2637 }, // x
+    { 10, 15, 14, 2, 10, 32, 2662 }, // y
+    { 10, 10, 14, 2, 10, 17, 2694 }, // z
+    { 8, 16, 10, 1, 13, 24, 2711 }, // {
+    { 2, 15, 4, 1, 12, 15, 2735 }, // |
+    { 8, 16, 10, 1, 13, 24, 2750 }, // }
+    { 6, 4, 8, 1, 13, 9, 2774 }, // ~
+    { 0, 0, 14, 0, 0, 0, 2783 }, //  
+    { 5, 18, 6, 0, 13, 22, 2783 }, // ¡
+    { 8, 16, 12, 2, 14, 32, 2805 }, // ¢
+    { 11, 16, 12, 0, 16, 35, 2837 }, // £
+    { 9, 8, 11, 1, 10, 24, 2872 }, // ¤
+    { 11, 15, 13, 1, 13, 28, 2896 }, // ¥
+    { 2, 15, 4, 1, 12, 12, 2924 }, // ¦
+    { 10, 16, 14, 2, 14, 31, 2936 }, // §
+    { 9, 3, 10, 0, 13, 10, 2967 }, // ¨
+    { 7, 7, 9, 1, 16, 20, 2977 }, // ©
+    { 6, 6, 8, 1, 13, 11, 2997 }, // ª
+    { 9, 8, 11, 1, 8, 26, 3008 }, // «
+    { 8, 5, 10, 1, 6, 10, 3034 }, // ¬
+    { 8, 2, 10, 1, 6, 6, 3044 }, // ­
+    { 7, 7, 9, 1, 18, 22, 3050 }, // ®
+    { 7, 3, 9, 1, 13, 3, 3072 }, // ¯
+    { 9, 8, 10, 0, 14, 20, 3075 }, // °
+    { 8, 10, 10, 1, 9, 14, 3095 }, // ±
+    { 5, 7, 6, 0, 14, 9, 3109 }, // ²
+    { 5, 7, 6, 0, 14, 11, 3118 }, // ³
+    { 3, 4, 5, 1, 13, 6, 3129 }, // ´
+    { 10, 12, 13, 1, 10, 34, 3135 }, // µ
+    { 8, 14, 10, 1, 12, 40, 3169 }, // ¶
+    { 4, 3, 5, 0, 7, 5, 3209 }, // ·
+    { 4, 5, 6, 1, 1, 7, 3214 }, // ¸
+    { 5, 7, 6, 0, 14, 8, 3221 }, // ¹
+    { 6, 6, 8, 1, 12, 12, 3229 }, // º
+    { 9, 8, 11, 1, 8, 22, 3241 }, // »
+    { 15, 16, 18, 2, 15, 49, 3263 }, // ¼
+    { 15, 15, 18, 2, 14, 52, 3312 }, // ½
+    { 15, 15, 18, 2, 14, 49, 3364 }, // ¾
+    { 10, 19, 11, 0, 10, 34, 3413 }, // ¿
+    { 13, 19, 19, 3, 19, 47, 3447 }, // À
+    { 13, 22, 19, 3, 22, 49, 3494 }, // Á
+    { 13, 20, 19, 3, 20, 49, 3543 }, // Â
+    { 13, 19, 19, 3, 19, 50, 3592 }, // Ã
+    { 13, 19, 19, 3, 19, 51, 3642 }, // Ä
+    { 13, 20, 19, 3, 20, 49, 3693 }, // Å
+    { 19, 16, 24, 3, 15, 48, 3742 }, // Æ
+    { 12, 20, 17, 2, 16, 43, 3790 }, // Ç
+    { 10, 19, 15, 3, 19, 36, 3833 }, // È
+    { 10, 22, 15, 3, 22, 37, 3869 }, // É
+    { 10, 19, 15, 3, 19, 38, 3906 }, // Ê
+    { 10, 19, 15, 3, 19, 40, 3944 }, // Ë
+    { 6, 20, 8, 0, 20, 28, 3984 }, // Ì
+    { 4, 23, 8, 2, 23, 28, 4012 }, // Í
+    { 7, 21, 8, 0, 21, 29, 4040 }, // Î
+    { 9, 20, 9, -1, 20, 34, 4069 }, // Ï
+    { 16, 15, 18, 0, 15, 40, 4103 }, // Ð
+    { 12, 18, 18, 3, 18, 58, 4143 }, // Ñ
+    { 13, 20, 19, 3, 19, 49, 4201 }, // Ò
+    { 13, 23, 19, 3, 22, 51, 4250 }, // Ó
+    { 13, 21, 19, 3, 20, 52, 4301 }, // Ô
+    { 13, 20, 19, 3, 19, 52, 4353 }, // Õ
+    { 13, 20, 19, 3, 19, 52, 4405 }, // Ö
+    { 8, 5, 10, 1, 7, 12, 4457 }, // ×
+    { 21, 31, 21, -1, 23, 99, 4469 }, // Ø
+    { 12, 20, 18, 3, 19, 48, 4568 }, // Ù
+    { 12, 23, 18, 3, 22, 52, 4616 }, // Ú
+    { 12, 21, 18, 3, 20, 52, 4668 }, // Û
+    { 12, 20, 18, 3, 19, 53, 4720 }, // Ü
+    { 12, 23, 18, 3, 23, 42, 4773 }, // Ý
+    { 9, 13, 10, 0, 13, 29, 4815 }, // Þ
+    { 10, 13, 12, 1, 13, 42, 4844 }, // ß
+    { 10, 14, 14, 2, 14, 36, 4886 }, // à
+    { 10, 17, 14, 2, 17, 36, 4922 }, // á
+    { 10, 15, 14, 2, 15, 36, 4958 }, // â
+    { 10, 14, 14, 2, 14, 39, 4994 }, // ã
+    { 10, 14, 14, 2, 14, 39, 5033 }, // ä
+    { 10, 15, 14, 2, 15, 38, 5072 }, // å
+    { 16, 11, 20, 2, 11, 43, 5110 }, // æ
+    { 8, 15, 12, 2, 11, 27, 5153 }, // ç
+    { 10, 16, 14, 2, 16, 34, 5180 }, // è
+    { 10, 19, 14, 2, 19, 34, 5214 }, // é
+    { 10, 16, 14, 2, 16, 36, 5248 }, // ê
+    { 10, 16, 14, 2, 16, 37, 5284 }, // ë
+    { 6, 14, 8, 0, 14, 20, 5321 }, // ì
+    { 4, 17, 8, 2, 17, 20, 5341 }, // í
+    { 7, 15, 8, 0, 15, 23, 5361 }, // î
+    { 9, 14, 9, -1, 14, 25, 5384 }, // ï
+    { 13, 14, 15, 1, 14, 37, 5409 }, // ð
+    { 10, 14, 14, 2, 14, 34, 5446 }, // ñ
+    { 10, 16, 14, 2, 16, 37, 5480 }, // ò
+    { 10, 19, 14, 2, 19, 38, 5517 }, // ó
+    { 10, 16, 14, 2, 16, 38, 5555 }, // ô
+    { 10, 16, 14, 2, 16, 41, 5593 }, // õ
+    { 10, 16, 14, 2, 16, 41, 5634 }, // ö
+    { 11, 10, 13, 1, 10, 17, 5675 }, // ÷
+    { 10, 27, 14, 2, 18, 58, 5692 }, // ø
+    { 9, 15, 13, 2, 15, 35, 5750 }, // ù
+    { 9, 18, 13, 2, 18, 38, 5785 }, // ú
+    { 9, 15, 13, 2, 15, 38, 5823 }, // û
+    { 9, 15, 13, 2, 15, 40, 5861 }, // ü
+    { 10, 24, 14, 2, 19, 41, 5901 }, // ý
+    { 8, 17, 10, 1, 14, 36, 5942 }, // þ
+    { 10, 21, 14, 2, 16, 44, 5978 }, // ÿ
+    { 13, 19, 19, 3, 19, 45, 6022 }, // Ā
+    { 10, 14, 14, 2, 14, 35, 6067 }, // ā
+    { 13, 21, 19, 3, 21, 50, 6102 }, // Ă
+    { 10, 16, 14, 2, 16, 39, 6152 }, // ă
+    { 13, 19, 19, 3, 14, 46, 6191 }, // Ą
+    { 10, 15, 14, 2, 11, 35, 6237 }, // ą
+    { 12, 24, 17, 2, 23, 45, 6272 }, // Ć
+    { 8, 17, 12, 2, 16, 27, 6317 }, // ć
+    { 12, 22, 17, 2, 21, 44, 6344 }, // Ĉ
+    { 8, 16, 12, 2, 15, 30, 6388 }, // ĉ
+    { 12, 23, 17, 2, 22, 44, 6418 }, // Ċ
+    { 8, 16, 12, 2, 15, 28, 6462 }, // ċ
+    { 12, 24, 17, 2, 23, 47, 6490 }, // Č
+    { 8, 17, 12, 2, 16, 30, 6537 }, // č
+    { 13, 21, 18, 3, 21, 45, 6567 }, // Ď
+    { 13, 16, 16, 2, 15, 44, 6612 }, // ď
+    { 16, 15, 18, 0, 15, 40, 6656 }, // Đ
+    { 13, 16, 16, 2, 15, 40, 6696 }, // đ
+    { 10, 19, 15, 3, 19, 37, 6736 }, // Ē
+    { 10, 15, 14, 2, 15, 32, 6773 }, // ē
+    { 10, 21, 15, 3, 21, 39, 6805 }, // Ĕ
+    { 10, 17, 14, 2, 17, 37, 6844 }, // ĕ
+    { 10, 20, 15, 3, 20, 36, 6881 }, // Ė
+    { 10, 16, 14, 2, 16, 32, 6917 }, // ė
+    { 10, 19, 15, 3, 15, 35, 6949 }, // Ę
+    { 10, 15, 14, 2, 10, 34, 6984 }, // ę
+    { 10, 21, 15, 3, 21, 39, 7018 }, // Ě
+    { 10, 17, 14, 2, 17, 35, 7057 }, // ě
+    { 14, 20, 19, 2, 20, 50, 7092 }, // Ĝ
+    { 9, 20, 13, 2, 15, 46, 7142 }, // ĝ
+    { 14, 21, 19, 2, 21, 52, 7188 }, // Ğ
+    { 9, 21, 13, 2, 16, 48, 7240 }, // ğ
+    { 14, 20, 19, 2, 20, 48, 7288 }, // Ġ
+    { 9, 20, 13, 2, 15, 43, 7336 }, // ġ
+    { 14, 22, 19, 2, 15, 53, 7379 }, // Ģ
+    { 9, 21, 13, 2, 16, 46, 7432 }, // ģ
+    { 12, 20, 18, 3, 20, 49, 7478 }, // Ĥ
+    { 12, 19, 14, 0, 19, 46, 7527 }, // ĥ
+    { 14, 15, 18, 2, 15, 48, 7573 }, // Ħ
+    { 12, 15, 14, 0, 15, 37, 7621 }, // ħ
+    { 7, 21, 8, 0, 21, 34, 7658 }, // Ĩ
+    { 7, 15, 8, 0, 15, 26, 7692 }, // ĩ
+    { 9, 20, 9, -1, 20, 30, 7718 }, // Ī
+    { 8, 14, 9, 0, 14, 20, 7748 }, // ī
+    { 4, 19, 10, 4, 15, 25, 7768 }, // Į
+    { 5, 19, 8, 1, 15, 25, 7793 }, // į
+    { 4, 21, 8, 2, 21, 28, 7818 }, // İ
+    { 3, 10, 8, 2, 10, 13, 7846 }, // ı
+    { 11, 19, 15, 2, 15, 51, 7859 }, // Ĳ
+    { 13, 20, 16, 2, 15, 47, 7910 }, // ĳ
+    { 8, 22, 13, 3, 18, 33, 7957 }, // Ĵ
+    { 9, 18, 12, 2, 14, 29, 7990 }, // ĵ
+    { 11, 21, 17, 3, 15, 49, 8019 }, // Ķ
+    { 10, 21, 14, 2, 14, 40, 8068 }, // ķ
+    { 8, 9, 11, 1, 9, 23, 8108 }, // ĸ
+    { 9, 20, 15, 3, 20, 34, 8131 }, // Ĺ
+    { 5, 20, 9, 2, 20, 29, 8165 }, // ĺ
+    { 9, 22, 15, 3, 15, 35, 8194 }, // Ļ
+    { 5, 21, 9, 2, 14, 31, 8229 }, // ļ
+    { 9, 15, 15, 3, 15, 33, 8260 }, // Ľ
+    { 7, 14, 10, 2, 14, 28, 8293 }, // ľ
+    { 9, 14, 15, 3, 14, 30, 8321 }, // Ŀ
+    { 7, 14, 10, 2, 14, 28, 8351 }, // ŀ
+    { 16, 23, 15, -4, 18, 59, 8379 }, // Ł
+    { 11, 14, 9, -3, 14, 31, 8438 }, // ł
+    { 12, 20, 18, 3, 20, 57, 8469 }, // Ń
+    { 10, 16, 14, 2, 16, 31, 8526 }, // ń
+    { 12, 21, 18, 3, 15, 59, 8557 }, // Ņ
+    { 10, 16, 14, 2, 10, 32, 8616 }, // ņ
+    { 12, 20, 18, 3, 20, 58, 8648 }, // Ň
+    { 10, 16, 14, 2, 16, 34, 8706 }, // ň
+    { 9, 18, 11, 1, 18, 39, 8740 }, // ŉ
+    { 12, 18, 18, 3, 15, 53, 8779 }, // Ŋ
+    { 10, 14, 14, 2, 10, 29, 8832 }, // ŋ
+    { 13, 20, 19, 3, 19, 47, 8861 }, // Ō
+    { 10, 15, 14, 2, 15, 39, 8908 }, // ō
+    { 13, 22, 19, 3, 21, 53, 8947 }, // Ŏ
+    { 10, 18, 14, 2, 18, 40, 9000 }, // ŏ
+    { 14, 21, 19, 3, 20, 59, 9040 }, // Ő
+    { 13, 17, 15, 1, 17, 41, 9099 }, // ő
+    { 19, 15, 23, 3, 15, 54, 9140 }, // Œ
+    { 17, 11, 20, 2, 11, 49, 9194 }, // œ
+    { 11, 20, 16, 3, 20, 49, 9243 }, // Ŕ
+    { 7, 14, 11, 2, 14, 21, 9292 }, // ŕ
+    { 11, 22, 16, 3, 14, 51, 9313 }, // Ŗ
+    { 8, 18, 11, 1, 9, 26, 9364 }, // ŗ
+    { 11, 20, 16, 3, 20, 51, 9390 }, // Ř
+    { 8, 14, 11, 1, 14, 24, 9441 }, // ř
+    { 13, 22, 19, 3, 21, 48, 9465 }, // Ś
+    { 9, 16, 13, 2, 16, 28, 9513 }, // ś
+    { 13, 21, 19, 3, 20, 48, 9541 }, // Ŝ
+    { 9, 15, 13, 2, 15, 31, 9589 }, // ŝ
+    { 13, 19, 19, 3, 15, 47, 9620 }, // Ş
+    { 9, 14, 13, 2, 10, 27, 9667 }, // ş
+    { 13, 23, 19, 3, 22, 49, 9694 }, // Š
+    { 9, 16, 13, 2, 16, 30, 9743 }, // š
+    { 12, 17, 18, 3, 14, 31, 9773 }, // Ţ
+    { 8, 16, 12, 2, 13, 27, 9804 }, // ţ
+    { 12, 20, 18, 3, 20, 35, 9831 }, // Ť
+    { 8, 14, 12, 2, 14, 28, 9866 }, // ť
+    { 12, 14, 18, 3, 14, 27, 9894 }, // Ŧ
+    { 9, 13, 12, 1, 13, 23, 9921 }, // ŧ
+    { 12, 21, 18, 3, 20, 55, 9944 }, // Ũ
+    { 9, 15, 13, 2, 15, 41, 9999 }, // ũ
+    { 12, 20, 18, 3, 19, 48, 10040 }, // Ū
+    { 9, 14, 13, 2, 14, 35, 10088 }, // ū
+    { 12, 22, 18, 3, 21, 56, 10123 }, // Ŭ
+    { 9, 16, 13, 2, 16, 40, 10179 }, // ŭ
+    { 12, 22, 18, 3, 21, 53, 10219 }, // Ů
+    { 9, 16, 13, 2, 16, 38, 10272 }, // ů
+    { 13, 21, 18, 3, 20, 56, 10310 }, // Ű
+    { 12, 15, 14, 1, 15, 45, 10366 }, // ű
+    { 12, 19, 18, 3, 15, 47, 10411 }, // Ų
+    { 9, 15, 13, 2, 10, 37, 10458 }, // ų
+    { 18, 19, 24, 3, 19, 66, 10495 }, // Ŵ
+    { 13, 15, 17, 2, 15, 43, 10561 }, // ŵ
+    { 12, 20, 18, 3, 20, 42, 10604 }, // Ŷ
+    { 10, 22, 14, 2, 17, 41, 10646 }, // ŷ
+    { 12, 20, 18, 3, 20, 42, 10687 }, // Ÿ
+    { 13, 20, 19, 3, 20, 38, 10729 }, // Ź
+    { 10, 16, 14, 2, 16, 24, 10767 }, // ź
+    { 13, 19, 19, 3, 19, 37, 10791 }, // Ż
+    { 10, 15, 14, 2, 15, 22, 10828 }, // ż
+    { 13, 20, 19, 3, 20, 40, 10850 }, // Ž
+    { 10, 16, 14, 2, 16, 25, 10890 }, // ž
+    { 6, 14, 9, 2, 14, 23, 10915 }, // ſ
+    { 14, 17, 19, 3, 16, 51, 10938 }, // Ơ
+    { 11, 11, 14, 2, 11, 33, 10989 }, // ơ
+    { 12, 15, 15, 1, 15, 40, 11022 }, // Ƥ
+    { 11, 18, 14, 1, 13, 42, 11062 }, // ƥ
+    { 8, 13, 10, 1, 12, 20, 11104 }, // Ʃ
+    { 12, 14, 18, 3, 14, 26, 11124 }, // Ƭ
+    { 8, 15, 12, 2, 15, 26, 11150 }, // ƭ
+    { 12, 18, 18, 3, 14, 32, 11176 }, // Ʈ
+    { 13, 18, 18, 3, 17, 46, 11208 }, // Ư
+    { 11, 11, 14, 2, 11, 34, 11254 }, // ư
+    { 6, 3, 7, 0, 13, 5, 11288 }, // ̀
+    { 3, 4, 5, 1, 13, 6, 11293 }, // ́
+    { 7, 4, 9, 1, 0, 6, 11299 }, // ̂
+    { 6, 4, 8, 1, 13, 9, 11305 }, // ̃
+    { 8, 3, 10, 1, 12, 5, 11314 }, // ̄
+    { 11, 3, 13, 1, 15, 4, 11319 }, // ̅
+    { 7, 5, 9, 1, 13, 9, 11323 }, // ̆
+    { 4, 3, 5, 0, 13, 5, 11332 }, // ̇
+    { 9, 3, 10, 0, 13, 10, 11337 }, // ̈
+    { 4, 4, 5, 0, 11, 5, 11347 }, // ̉
+    { 4, 4, 6, 1, 13, 8, 11352 }, // ̊
+    { 13, 3, 14, 0, 13, 11, 11360 }, // ̋
+    { 7, 4, 9, 1, 13, 6, 11371 }, // ̌
+    { 13, 3, 10, -4, 14, 11, 11377 }, // ̏
+    { 5, 5, 6, 0, 13, 7, 11388 }, // ̒
+    { 5, 5, 6, 0, 12, 9, 11395 }, // ̓
+    { 5, 5, 6, 0, 12, 8, 11404 }, // ̔
+    { 3, 5, 5, 1, 0, 4, 11412 }, // ̘
+    { 3, 5, 5, 1, 0, 5, 11416 }, // ̙
+    { 7, 4, 9, 1, 13, 10, 11421 }, // ̚
+    { 3, 4, 5, 1, 11, 4, 11431 }, // ̛
+    { 2, 3, 4, 1, -1, 3, 11435 }, // ̜
+    { 4, 3, 6, 1, 2, 4, 11438 }, // ̝
+    { 4, 3, 6, 1, -1, 4, 11442 }, // ̞
+    { 4, 4, 6, 1, -1, 4, 11446 }, // ̟
+    { 8, 3, 10, 1, -2, 5, 11450 }, // ̠
+    { 4, 3, 5, 0, 1, 5, 11455 }, // ̣
+    { 9, 3, 10, 0, 0, 10, 11460 }, // ̤
+    { 4, 4, 6, 1, 13, 8, 11470 }, // ̥
+    { 5, 6, 6, 0, 3, 11, 11478 }, // ̦
+    { 4, 5, 6, 1, 1, 7, 11489 }, // ̧
+    { 4, 5, 6, 1, 0, 6, 11496 }, // ̨
+    { 2, 5, 4, 1, -1, 5, 11502 }, // ̩
+    { 6, 3, 8, 1, -1, 7, 11507 }, // ̪
+    { 7, 4, 9, 1, 0, 8, 11514 }, // ̬
+    { 7, 4, 9, 1, 0, 9, 11522 }, // ̭
+    { 6, 4, 8, 1, 13, 9, 11531 }, // ̰
+    { 7, 3, 9, 1, 13, 3, 11540 }, // ̱
+    { 7, 3, 9, 1, -1, 3, 11543 }, // ̲
+    { 6, 4, 8, 1, 13, 9, 11546 }, // ̴
+    { 8, 2, 10, 1, 6, 6, 11555 }, // ̵
+    { 2, 3, 4, 1, -1, 3, 11561 }, // ̹
+    { 6, 4, 8, 1, 0, 7, 11564 }, // ̺
+    { 5, 4, 7, 1, 0, 7, 11571 }, // ̻
+    { 6, 4, 8, 1, 0, 9, 11578 }, // ̼
+    { 5, 4, 7, 1, 13, 6, 11587 }, // ̽
+    { 6, 4, 8, 1, 13, 9, 11593 }, // ͂
+    { 3, 3, 5, 1, 14, 4, 11602 }, // ̓
+    { 9, 8, 10, 0, 18, 15, 11606 }, // ̈́
+    { 6, 3, 8, 1, 13, 7, 11621 }, // ͆
+    { 8, 6, 10, 1, 0, 10, 11628 }, // ͇
+    { 7, 5, 9, 1, 0, 15, 11638 }, // ͈
+    { 5, 5, 7, 1, -1, 6, 11653 }, // ͉
+    { 6, 10, 8, 1, 16, 17, 11659 }, // ͊
+    { 14, 8, 15, 0, 15, 25, 11676 }, // ͋
+    { 10, 9, 12, 1, 9, 27, 11701 }, // ͌
+    { 9, 3, 11, 1, -2, 6, 11728 }, // ͍
+    { 3, 3, 5, 1, 2, 3, 11734 }, // ͎
+    { 14, 3, 16, 1, 0, 11, 11737 }, // ͜
+    { 14, 3, 16, 1, 13, 11, 11748 }, // ͡
+    { 17, 5, 19, 1, -1, 11, 11759 }, // ͢
+    { 13, 14, 19, 3, 14, 39, 11770 }, // Α
+    { 11, 14, 16, 3, 14, 37, 11809 }, // Β
+    { 8, 14, 10, 1, 13, 24, 11846 }, // Γ
+    { 12, 13, 14, 1, 13, 34, 11870 }, // Δ
+    { 10, 15, 15, 3, 15, 30, 11904 }, // Ε
+    { 13, 14, 19, 3, 14, 29, 11934 }, // Ζ
+    { 12, 15, 18, 3, 15, 41, 11963 }, // Η
+    { 13, 16, 19, 3, 15, 46, 12004 }, // Θ
+    { 4, 15, 8, 2, 15, 22, 12050 }, // Ι
+    { 11, 15, 17, 3, 15, 40, 12072 }, // Κ
+    { 14, 15, 19, 3, 15, 41, 12112 }, // Λ
+    { 15, 15, 21, 3, 15, 58, 12153 }, // Μ
+    { 12, 15, 18, 3, 15, 49, 12211 }, // Ν
+    { 11, 12, 13, 1, 12, 22, 12260 }, // Ξ
+    { 13, 16, 19, 3, 15, 42, 12282 }, // Ο
+    { 9, 12, 11, 1, 12, 35, 12324 }, // Π
+    { 10, 15, 15, 3, 15, 35, 12359 }, // Ρ
+    { 8, 13, 10, 1, 12, 20, 12394 }, // Σ
+    { 12, 14, 18, 3, 14, 25, 12414 }, // Τ
+    { 12, 14, 18, 3, 14, 31, 12439 }, // Υ
+    { 17, 18, 23, 3, 16, 60, 12470 }, // Φ
+    { 13, 15, 19, 3, 15, 40, 12530 }, // Χ
+    { 12, 15, 14, 1, 13, 41, 12570 }, // Ψ
+    { 12, 14, 14, 1, 13, 38, 12611 }, // Ω
+    { 12, 12, 16, 2, 11, 33, 12649 }, // α
+    { 10, 20, 12, 1, 16, 48, 12682 }, // β
+    { 10, 15, 12, 1, 10, 34, 12730 }, // γ
+    { 10, 15, 12, 1, 15, 35, 12764 }, // δ
+    { 7, 9, 9, 1, 9, 19, 12799 }, // ε
+    { 9, 14, 10, 0, 12, 27, 12818 }, // ζ
+    { 10, 16, 12, 1, 11, 41, 12845 }, // η
+    { 9, 13, 11, 1, 13, 36, 12886 }, // θ
+    { 5, 11, 9, 2, 11, 17, 12922 }, // ι
+    { 8, 10, 12, 2, 10, 25, 12939 }, // κ
+    { 9, 14, 13, 2, 14, 28, 12964 }, // λ
+    { 10, 12, 13, 1, 10, 34, 12992 }, // μ
+    { 10, 10, 12, 1, 10, 24, 13026 }, // ν
+    { 9, 15, 10, 0, 12, 25, 13050 }, // ξ
+    { 10, 10, 14, 2, 10, 30, 13075 }, // ο
+    { 10, 10, 12, 1, 9, 25, 13105 }, // π
+    { 10, 14, 12, 1, 10, 32, 13130 }, // ρ
+    { 7, 12, 9, 1, 12, 21, 13162 }, // ς
+    { 12, 10, 15, 2, 10, 30, 13183 }, // σ
+    { 9, 10, 11, 1, 9, 16, 13213 }, // τ
+    { 8, 10, 10, 1, 10, 24, 13229 }, // υ
+    { 13, 21, 19, 3, 19, 62, 13253 }, // φ
+    { 12, 13, 14, 1, 9, 33, 13315 }, // χ
+    { 9, 16, 11, 1, 12, 41, 13348 }, // ψ
+    { 12, 10, 14, 1, 9, 30, 13389 }, // ω
+    { 13, 19, 19, 3, 14, 47, 13419 }, // Ạ
+    { 10, 16, 14, 2, 11, 37, 13466 }, // ạ
+    { 13, 21, 19, 3, 21, 49, 13503 }, // Ả
+    { 10, 16, 14, 2, 16, 37, 13552 }, // ả
+    { 13, 24, 19, 3, 24, 58, 13589 }, // Ấ
+    { 10, 19, 14, 2, 19, 43, 13647 }, // ấ
+    { 14, 21, 19, 2, 21, 56, 13690 }, // Ầ
+    { 12, 17, 14, 0, 17, 41, 13746 }, // ầ
+    { 13, 23, 19, 3, 23, 55, 13787 }, // Ẩ
+    { 10, 18, 14, 2, 18, 42, 13842 }, // ẩ
+    { 13, 23, 19, 3, 23, 60, 13884 }, // Ẫ
+    { 10, 18, 14, 2, 18, 48, 13944 }, // ẫ
+    { 13, 25, 19, 3, 20, 58, 13992 }, // Ậ
+    { 10, 20, 14, 2, 15, 42, 14050 }, // ậ
+    { 13, 27, 19, 3, 27, 58, 14092 }, // Ắ
+    { 10, 22, 14, 2, 22, 45, 14150 }, // ắ
+    { 13, 26, 19, 3, 26, 58, 14195 }, // Ằ
+    { 10, 21, 14, 2, 21, 46, 14253 }, // ằ
+    { 13, 27, 19, 3, 27, 60, 14299 }, // Ẳ
+    { 10, 22, 14, 2, 22, 47, 14359 }, // ẳ
+    { 13, 26, 19, 3, 26, 62, 14406 }, // Ẵ
+    { 10, 21, 14, 2, 21, 51, 14468 }, // ẵ
+    { 13, 26, 19, 3, 21, 58, 14519 }, // Ặ
+    { 10, 21, 14, 2, 16, 46, 14577 }, // ặ
+    { 10, 19, 15, 3, 15, 35, 14623 }, // Ẹ
+    { 10, 15, 14, 2, 10, 32, 14658 }, // ẹ
+    { 10, 20, 15, 3, 20, 37, 14690 }, // Ẻ
+    { 10, 17, 14, 2, 17, 34, 14727 }, // ẻ
+    { 10, 19, 15, 3, 19, 40, 14761 }, // Ẽ
+    { 10, 16, 14, 2, 16, 38, 14801 }, // ẽ
+    { 10, 23, 15, 3, 23, 42, 14839 }, // Ế
+    { 11, 17, 14, 2, 17, 42, 14881 }, // ế
+    { 14, 20, 15, -1, 20, 49, 14923 }, // Ề
+    { 12, 18, 14, 0, 18, 43, 14972 }, // ề
+    { 10, 22, 15, 3, 22, 43, 15015 }, // Ể
+    { 10, 19, 14, 2, 19, 39, 15058 }, // ể
+    { 10, 23, 15, 3, 23, 48, 15097 }, // Ễ
+    { 10, 19, 14, 2, 19, 44, 15145 }, // ễ
+    { 10, 23, 15, 3, 19, 43, 15189 }, // Ệ
+    { 10, 21, 14, 2, 16, 42, 15232 }, // ệ
+    { 4, 21, 8, 2, 21, 26, 15274 }, // Ỉ
+    { 4, 15, 8, 2, 15, 20, 15300 }, // ỉ
+    { 4, 19, 8, 2, 15, 27, 15320 }, // Ị
+    { 4, 19, 8, 2, 15, 26, 15347 }, // ị
+    { 13, 20, 19, 3, 15, 49, 15373 }, // Ọ
+    { 10, 15, 14, 2, 10, 35, 15422 }, // ọ
+    { 13, 22, 19, 3, 21, 52, 15457 }, // Ỏ
+    { 10, 17, 14, 2, 17, 38, 15509 }, // ỏ
+    { 16, 21, 20, 3, 20, 63, 15547 }, // Ố
+    { 11, 17, 14, 2, 17, 44, 15610 }, // ố
+    { 14, 22, 19, 2, 21, 60, 15654 }, // Ồ
+    { 12, 18, 14, 0, 18, 45, 15714 }, // ồ
+    { 13, 23, 19, 3, 22, 57, 15759 }, // Ổ
+    { 10, 20, 14, 2, 20, 45, 15816 }, // ổ
+    { 13, 24, 19, 3, 23, 60, 15861 }, // Ỗ
+    { 10, 20, 14, 2, 20, 48, 15921 }, // ỗ
+    { 13, 25, 19, 3, 20, 60, 15969 }, // Ộ
+    { 10, 21, 14, 2, 16, 45, 16029 }, // ộ
+    { 14, 23, 19, 3, 22, 59, 16074 }, // Ớ
+    { 11, 18, 14, 2, 18, 41, 16133 }, // ớ
+    { 14, 22, 19, 3, 21, 59, 16174 }, // Ờ
+    { 11, 16, 14, 2, 16, 41, 16233 }, // ờ
+    { 14, 22, 19, 3, 21, 59, 16274 }, // Ở
+    { 11, 17, 14, 2, 17, 41, 16333 }, // ở
+    { 14, 21, 19, 3, 20, 61, 16374 }, // Ỡ
+    { 11, 16, 14, 2, 16, 44, 16435 }, // ỡ
+    { 14, 21, 19, 3, 16, 58, 16479 }, // Ợ
+    { 11, 16, 14, 2, 11, 39, 16537 }, // ợ
+    { 12, 20, 18, 3, 15, 50, 16576 }, // Ụ
+    { 9, 14, 13, 2, 10, 36, 16626 }, // ụ
+    { 12, 22, 18, 3, 21, 50, 16662 }, // Ủ
+    { 9, 16, 13, 2, 16, 36, 16712 }, // ủ
+    { 13, 22, 18, 3, 21, 53, 16748 }, // Ứ
+    { 11, 17, 14, 2, 17, 42, 16801 }, // ứ
+    { 13, 21, 18, 3, 20, 51, 16843 }, // Ừ
+    { 11, 15, 14, 2, 15, 41, 16894 }, // ừ
+    { 13, 22, 18, 3, 21, 52, 16935 }, // Ử
+    { 11, 16, 14, 2, 16, 40, 16987 }, // ử
+    { 13, 21, 18, 3, 20, 55, 17027 }, // Ữ
+    { 11, 15, 14, 2, 15, 44, 17082 }, // ữ
+    { 13, 22, 18, 3, 17, 54, 17126 }, // Ự
+    { 11, 15, 14, 2, 11, 40, 17180 }, // ự
+    { 12, 19, 18, 3, 19, 38, 17220 }, // Ỳ
+    { 10, 21, 14, 2, 16, 40, 17258 }, // ỳ
+    { 12, 21, 18, 3, 14, 40, 17298 }, // Ỵ
+    { 12, 15, 15, 2, 10, 36, 17338 }, // ỵ
+    { 12, 21, 18, 3, 21, 39, 17374 }, // Ỷ
+    { 10, 23, 14, 2, 18, 40, 17413 }, // ỷ
+    { 12, 20, 18, 3, 20, 42, 17453 }, // Ỹ
+    { 10, 22, 14, 2, 17, 44, 17495 }, // ỹ
+    { 0, 0, 14, 0, 0, 0, 17539 }, //  
+    { 0, 0, 22, 0, 0, 0, 17539 }, //  
+    { 0, 0, 14, 0, 0, 0, 17539 }, //  
+    { 0, 0, 22, 0, 0, 0, 17539 }, //  
+    { 0, 0, 11, 0, 0, 0, 17539 }, //  
+    { 0, 0, 10, 0, 0, 0, 17539 }, //  
+    { 0, 0, 8, 0, 0, 0, 17539 }, //  
+    { 0, 0, 11, 0, 0, 0, 17539 }, //  
+    { 0, 0, 4, 0, 0, 0, 17539 }, //  
+    { 0, 0, 9, 0, 0, 0, 17539 }, //  
+    { 0, 0, 8, 0, 0, 0, 17539 }, //  
+    { 0, 0, 5, 0, 0, 0, 17539 }, // ​
+    { 0, 0, 1, 0, 0, 0, 17539 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 17539 }, // ‍
+    { 0, 0, 1, 0, 0, 0, 17539 }, // ‎
+    { 0, 0, 1, 0, 0, 0, 17539 }, // ‏
+    { 8, 2, 10, 1, 6, 6, 17539 }, // ‐
+    { 8, 2, 10, 1, 6, 6, 17545 }, // ‑
+    { 12, 2, 14, 1, 6, 9, 17551 }, // ‒
+    { 11, 3, 13, 1, 6, 9, 17560 }, // –
+    { 17, 3, 19, 1, 6, 13, 17569 }, // —
+    { 17, 3, 19, 1, 6, 13, 17582 }, // ―
+    { 7, 15, 9, 1, 12, 36, 17595 }, // ‖
+    { 13, 6, 15, 1, -1, 20, 17631 }, // ‗
+    { 5, 6, 6, 0, 15, 9, 17651 }, // ‘
+    { 5, 6, 6, 0, 15, 11, 17660 }, // ’
+    { 5, 6, 6, 0, 3, 11, 17671 }, // ‚
+    { 5, 6, 6, 0, 15, 9, 17682 }, // ‛
+    { 9, 6, 10, 0, 15, 18, 17691 }, // “
+    { 9, 6, 10, 0, 15, 20, 17709 }, // ”
+    { 5, 6, 6, 0, 3, 11, 17729 }, // „
+    { 9, 5, 10, 0, 15, 15, 17740 }, // ‟
+    { 9, 22, 10, 0, 17, 32, 17755 }, // †
+    { 10, 22, 11, 0, 17, 38, 17787 }, // ‡
+    { 11, 10, 11, -1, 12, 23, 17825 }, // •
+    { 5, 6, 7, 1, 8, 8, 17848 }, // ‣
+    { 4, 3, 5, 0, 3, 5, 17856 }, // ․
+    { 4, 3, 5, 0, 3, 5, 17861 }, // ‥
+    { 15, 3, 16, 0, 3, 14, 17866 }, // …
+    { 3, 2, 5, 1, 6, 3, 17880 }, // ‧
+    { 0, 0, 21, 0, 0, 0, 17883 }, //  
+    { 11, 15, 18, 4, 13, 44, 17883 }, // ‰
+    { 5, 6, 6, 0, 15, 11, 17927 }, // ′
+    { 9, 6, 10, 0, 15, 20, 17938 }, // ″
+    { 14, 6, 15, 0, 14, 21, 17958 }, // ‴
+    { 5, 6, 6, 0, 14, 7, 17979 }, // ‵
+    { 8, 6, 9, 0, 14, 12, 17986 }, // ‶
+    { 14, 6, 15, 0, 14, 20, 17998 }, // ‷
+    { 7, 3, 9, 1, 13, 8, 18018 }, // ‸
+    { 5, 8, 7, 1, 8, 14, 18026 }, // ‹
+    { 5, 8, 7, 1, 8, 13, 18040 }, // ›
+    { 18, 17, 22, 3, 15, 60, 18053 }, // ※
+    { 5, 17, 6, 0, 17, 21, 18113 }, // ‼
+    { 10, 21, 12, 1, 20, 37, 18134 }, // ‽
+    { 8, 2, 10, 1, 14, 6, 18171 }, // ‾
+    { 7, 4, 9, 1, 12, 9, 18177 }, // ‿
+    { 11, 12, 13, 1, 16, 31, 18186 }, // ⁂
+    { 10, 14, 18, 4, 13, 21, 18217 }, // ⁄
+    { 19, 19, 21, 1, 19, 66, 18238 }, // ⁇
+    { 13, 19, 17, 1, 19, 61, 18304 }, // ⁈
+    { 13, 20, 14, 0, 19, 50, 18365 }, // ⁉
+    { 10, 26, 12, 1, 18, 50, 18415 }, // ⁒
+    { 0, 0, 80, 0, 0, 0, 18465 }, //  
+    { 5, 7, 6, 0, 14, 13, 18465 }, // ⁰
+    { 5, 6, 6, 0, 14, 9, 18478 }, // ⁴
+    { 5, 7, 6, 0, 14, 10, 18487 }, // ⁵
+    { 5, 7, 6, 0, 14, 12, 18497 }, // ⁶
+    { 5, 7, 6, 0, 14, 11, 18509 }, // ⁷
+    { 5, 7, 6, 0, 14, 15, 18520 }, // ⁸
+    { 5, 7, 6, 0, 14, 14, 18535 }, // ⁹
+    { 10, 10, 14, 2, 10, 24, 18549 }, // ⁿ
+    { 7, 9, 8, 0, 9, 24, 18573 }, // ₀
+    { 5, 7, 6, 0, 4, 9, 18597 }, // ₁
+    { 5, 7, 6, 0, 4, 12, 18606 }, // ₂
+    { 5, 7, 6, 0, 4, 12, 18618 }, // ₃
+    { 5, 7, 6, 0, 4, 10, 18630 }, // ₄
+    { 5, 7, 6, 0, 4, 9, 18640 }, // ₅
+    { 5, 7, 6, 0, 4, 15, 18649 }, // ₆
+    { 5, 7, 6, 0, 4, 12, 18664 }, // ₇
+    { 6, 7, 7, 0, 4, 15, 18676 }, // ₈
+    { 5, 7, 6, 0, 4, 14, 18691 }, // ₉
+    { 6, 23, 8, 1, 17, 34, 18705 }, // ₍
+    { 6, 23, 7, 0, 17, 35, 18739 }, // ₎
+    { 12, 23, 17, 2, 19, 70, 18774 }, // ₡
+    { 12, 17, 17, 2, 16, 41, 18844 }, // ₢
+    { 11, 16, 12, 0, 16, 37, 18885 }, // ₤
+    { 16, 15, 18, 1, 15, 54, 18922 }, // ₦
+    { 13, 15, 15, 1, 15, 37, 18976 }, // ₧
+    { 17, 15, 20, 2, 15, 62, 19013 }, // ₨
+    { 14, 15, 15, 0, 15, 53, 19075 }, // ₩
+    { 14, 13, 18, 2, 13, 58, 19128 }, // ₪
+    { 11, 14, 13, 1, 14, 41, 19186 }, // ₫
+    { 11, 16, 13, 1, 14, 32, 19227 }, // €
+    { 12, 14, 18, 3, 14, 27, 19259 }, // ₮
+    { 15, 15, 16, 0, 15, 43, 19286 }, // ₱
+    { 14, 21, 19, 2, 18, 62, 19329 }, // ₲
+    { 15, 16, 17, 1, 15, 49, 19391 }, // ₴
+    { 8, 13, 12, 2, 12, 29, 19440 }, // ₵
+    { 12, 15, 18, 3, 15, 29, 19469 }, // ₸
+    { 8, 13, 10, 1, 13, 22, 19498 }, // ₹
+    { 10, 13, 12, 1, 12, 27, 19520 }, // ₺
+    { 11, 13, 12, 0, 13, 46, 19547 }, // ₼
+    { 14, 15, 15, -1, 15, 41, 19593 }, // ₽
+    { 11, 11, 13, 1, 10, 23, 19634 }, // ←
+    { 11, 10, 13, 1, 10, 24, 19657 }, // ↑
+    { 11, 11, 13, 1, 10, 23, 19681 }, // →
+    { 11, 10, 13, 1, 10, 24, 19704 }, // ↓
+    { 13, 9, 15, 1, 9, 23, 19728 }, // ↔
+    { 9, 13, 11, 1, 14, 28, 19751 }, // ↕
+    { 9, 8, 11, 1, 8, 22, 19779 }, // ↖
+    { 9, 8, 11, 1, 8, 19, 19801 }, // ↗
+    { 9, 9, 11, 1, 9, 20, 19820 }, // ↘
+    { 9, 9, 11, 1, 9, 20, 19840 }, // ↙
+    { 12, 11, 14, 1, 10, 23, 19860 }, // ⇐
+    { 13, 12, 15, 1, 12, 42, 19883 }, // ⇑
+    { 12, 11, 14, 1, 10, 23, 19925 }, // ⇒
+    { 13, 13, 15, 1, 12, 44, 19948 }, // ⇓
+    { 14, 11, 16, 1, 10, 32, 19992 }, // ⇔
+    { 11, 14, 13, 1, 9, 37, 20024 }, // ⇕
+    { 10, 14, 12, 1, 14, 34, 20061 }, // ∂
+    { 17, 17, 19, 1, 16, 60, 20095 }, // ∅
+    { 12, 13, 14, 1, 13, 34, 20155 }, // ∆
+    { 10, 12, 12, 1, 12, 37, 20189 }, // ∏
+    { 10, 12, 12, 1, 12, 37, 20226 }, // ∐
+    { 8, 13, 10, 1, 12, 20, 20263 }, // ∑
+    { 8, 3, 10, 1, 6, 5, 20283 }, // −
+    { 14, 14, 16, 1, 13, 30, 20288 }, // √
+    { 13, 8, 15, 1, 10, 34, 20318 }, // ∞
+    { 14, 19, 15, 0, 15, 41, 20352 }, // ∫
+    { 4, 10, 5, 0, 10, 11, 20393 }, // ∶
+    { 10, 9, 13, 1, 9, 27, 20404 }, // ≈
+    { 11, 15, 18, 4, 13, 30, 20431 }, // ≠
+    { 13, 13, 15, 1, 12, 32, 20461 }, // ≤
+    { 13, 13, 15, 1, 12, 32, 20493 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_8_regularIntervals[] = {
@@ -2244,4 +2027,5 @@ static const EpdFontData opendyslexic_8_regular = {
     22,
     -9,
     true,
+    true,
 };
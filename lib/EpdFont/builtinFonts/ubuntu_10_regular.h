@@ -1732,4 +1732,5 @@ static const EpdFontData ubuntu_10_regular = {
     20,
     -4,
     false,
+    false,
 };
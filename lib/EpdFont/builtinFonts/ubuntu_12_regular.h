@@ -2064,4 +2064,5 @@ static const EpdFontData ubuntu_12_regular = {
     24,
     -5,
     false,
+    false,
 };
@@ -21,7 +21,7 @@ for size in ${BOOKERLY_FONT_SIZES[@]}; do
     font_name="bookerly_${size}_$(echo $style | tr '[:upper:]' '[:lower:]')"
     font_path="../builtinFonts/source/Bookerly/Bookerly-${style}.ttf"
     output_path="../builtinFonts/${font_name}.h"
-    $PYTHON fontconvert.py $font_name $size $font_path --2bit > $output_path
+    $PYTHON fontconvert.py $font_name $size $font_path --2bit --rle > $output_path
     echo "Generated $output_path"
   done
 done
@@ -31,7 +31,7 @@ for size in ${NOTOSANS_FONT_SIZES[@]}; do
     font_name="notosans_${size}_$(echo $style | tr '[:upper:]' '[:lower:]')"
     font_path="../builtinFonts/source/NotoSans/NotoSans-${style}.ttf"
     output_path="../builtinFonts/${font_name}.h"
-    $PYTHON fontconvert.py $font_name $size $font_path --2bit > $output_path
+    $PYTHON fontconvert.py $font_name $size $font_path --2bit --rle > $output_path
     echo "Generated $output_path"
   done
 done
@@ -41,7 +41,7 @@ for size in ${OPENDYSLEXIC_FONT_SIZES[@]}; do
     font_name="opendyslexic_${size}_$(echo $style | tr '[:upper:]' '[:lower:]')"
     font_path="../builtinFonts/source/OpenDyslexic/OpenDyslexic-${style}.otf"
     output_path="../builtinFonts/${font_name}.h"
-    $PYTHON fontconvert.py $font_name $size $font_path --2bit > $output_path
+    $PYTHON fontconvert.py $font_name $size $font_path --2bit --rle > $output_path
     echo "Generated $output_path"
   done
 done
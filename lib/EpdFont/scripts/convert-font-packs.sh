@@ -0,0 +1,49 @@
+#!/bin/bash
+
+# Writes the reader fonts as SD card font packs to ../packs. Copy them to /fonts on the SD card for firmware built
+# with OMIT_FONTS, which then leaves them out of flash (see setupDisplayAndFonts in src/main.cpp).
+
+set -e
+
+cd "$(dirname "$0")"
+
+# Use venv if it exists
+if [ -d ".venv" ]; then
+    PYTHON=".venv/bin/python"
+else
+    PYTHON="python"
+fi
+
+mkdir -p ../packs
+
+READER_FONT_STYLES=("Regular" "Italic" "Bold" "BoldItalic")
+BOOKERLY_FONT_SIZES=(12 16 18)
+NOTOSANS_FONT_SIZES=(12 14 16 18)
+OPENDYSLEXIC_FONT_SIZES=(8 10 12 14)
+
+convert() {
+  local family=$1 size=$2 style=$3 font_path=$4
+  local font_name="${family}_${size}_$(echo $style | tr '[:upper:]' '[:lower:]')"
+  local output_path="../packs/${font_name}.epf"
+  $PYTHON fontconvert.py $font_name $size $font_path --2bit --rle --pack > $output_path
+  echo "Generated $output_path"
+}
+
+# Bookerly 14 stays built in as the fallback
+for size in ${BOOKERLY_FONT_SIZES[@]}; do
+  for style in ${READER_FONT_STYLES[@]}; do
+    convert bookerly $size $style "../builtinFonts/source/Bookerly/Bookerly-${style}.ttf"
+  done
+done
+
+for size in ${NOTOSANS_FONT_SIZES[@]}; do
+  for style in ${READER_FONT_STYLES[@]}; do
+    convert notosans $size $style "../builtinFonts/source/NotoSans/NotoSans-${style}.ttf"
+  done
+done
+
+for size in ${OPENDYSLEXIC_FONT_SIZES[@]}; do
+  for style in ${READER_FONT_STYLES[@]}; do
+    convert opendyslexic $size $style "../builtinFonts/source/OpenDyslexic/OpenDyslexic-${style}.otf"
+  done
+done
@@ -4,6 +4,7 @@ import sys
 import re
 import math
 import argparse
+import struct
 from collections import namedtuple
 
 # Originally from https://github.com/vroland/epdiy
@@ -13,8 +14,12 @@ parser.add_argument("name", action="store", help="name of the font.")
 parser.add_argument("size", type=int, help="font size to use.")
 parser.add_argument("fontstack", action="store", nargs='+', help="list of font files, ordered by descending priority.")
 parser.add_argument("--2bit", dest="is2Bit", action="store_true", help="generate 2-bit greyscale bitmap instead of 1-bit black and white.")
+parser.add_argument("--rle", dest="rle", action="store_true", help="run-length encode the 2-bit glyph bitmaps (see EpdGlyphRle.h).")
+parser.add_argument("--pack", dest="pack", action="store_true", help="write a binary font pack for the SD card (see EpdFontPack.h) to stdout instead of a header file.")
 parser.add_argument("--additional-intervals", dest="additional_intervals", action="append", help="Additional code point intervals to export as min,max. This argument can be repeated.")
 args = parser.parse_args()
+if args.rle and not args.is2Bit:
+    parser.error("--rle requires --2bit")
 
 GlyphProps = namedtuple("GlyphProps", ["width", "height", "advance_x", "left", "top", "data_length", "data_offset", "code_point"])
 
@@ -138,6 +143,27 @@ def chunks(l, n):
     for i in range(0, len(l), n):
         yield l[i:i + n]
 
+def rle_encode(values):
+    # One nibble per run over the glyph's 2-bit pixel values, decoded by lib/EpdFont/EpdGlyphRle.h
+    nibbles = []
+    i = 0
+    while i < len(values):
+        v = values[i]
+        limit = 8 if v == 0 else 4 if v == 3 else 1
+        run = 1
+        while run < limit and i + run < len(values) and values[i + run] == v:
+            run += 1
+        if v == 0:
+            nibbles.append(run - 1)
+        elif v == 3:
+            nibbles.append(0xC | (run - 1))
+        else:
+            nibbles.append(0x8 | v)
+        i += run
+    if len(nibbles) % 2 > 0:
+        nibbles.append(0)
+    return [(nibbles[j] << 4) | nibbles[j + 1] for j in range(0, len(nibbles), 2)]
+
 def load_glyph(code_point):
     face_index = 0
     while face_index < len(font_stack):
@@ -202,6 +228,7 @@ for i_start, i_end in intervals:
             # 0-3 white, 4-7 light grey, 8-11 dark grey, 12-15 black
             # Downsample to 2-bit bitmap
             pixels2b = []
+            values2b = []
             px = 0
             pitch = (bitmap.width // 2) + (bitmap.width % 2)
             for y in range(bitmap.rows):
@@ -216,6 +243,7 @@ for i_start, i_end in intervals:
                         px += 2
                     elif bm >= 4:
                         px += 1
+                    values2b.append(px & 0x3)
 
                     if (y * bitmap.width + x) % 4 == 3:
                         pixels2b.append(px)
@@ -262,6 +290,8 @@ for i_start, i_end in intervals:
             # print('')
 
         pixels = pixels2b if is2Bit else pixelsbw
+        if args.rle:
+            pixels = rle_encode(values2b)
 
         # Build output data
         packed = bytes(pixels)
@@ -297,11 +327,28 @@ for index, glyph in enumerate(all_glyphs):
     glyph_data.extend([b for b in packed])
     glyph_props.append(props)
 
+if args.pack:
+    # Layout documented in lib/EpdFont/EpdFontPack.h
+    out = sys.stdout.buffer
+    out.write(struct.pack("<4sBBBBhhIIIHH",
+                          b"EPFP", 1, 1 if is2Bit else 0, norm_ceil(face.size.height), 1 if args.rle else 0,
+                          norm_ceil(face.size.ascender), norm_floor(face.size.descender),
+                          len(intervals), len(glyph_props), len(glyph_data),
+                          max((g.data_length for g in glyph_props), default=0), 0))
+    offset = 0
+    for i_start, i_end in intervals:
+        out.write(struct.pack("<III", i_start, i_end, offset))
+        offset += i_end - i_start + 1
+    for g in glyph_props:
+        out.write(struct.pack("<BBBBhhHI", g.width, g.height, g.advance_x, 0, g.left, g.top, g.data_length, g.data_offset))
+    out.write(bytes(glyph_data))
+    sys.exit(0)
+
 print(f"""/**
  * generated by fontconvert.py
  * name: {font_name}
  * size: {size}
- * mode: {'2-bit' if is2Bit else '1-bit'}
+ * mode: {'2-bit' if is2Bit else '1-bit'}{', run-length encoded' if args.rle else ''}
  * Command used: {' '.join(sys.argv)}
  */
 #pragma once
@@ -334,4 +381,5 @@ print(f"    {norm_ceil(face.size.height)},")
 print(f"    {norm_ceil(face.size.ascender)},")
 print(f"    {norm_floor(face.size.descender)},")
 print(f"    {'true' if is2Bit else 'false'},")
+print(f"    {'true' if args.rle else 'false'},")
 print("};")
@@ -1,8 +1,9 @@
 #include "Epub.h"
 
+#include <ExpatDriver.h>
 #include <FsHelpers.h>
-#include <HardwareSerial.h>
 #include <JpegToBmpConverter.h>
+#include <Logging.h>
 #include <SDCardManager.h>
 #include <ZipFile.h>
 
@@ -11,35 +12,32 @@
 #include "Epub/parsers/TocNavParser.h"
 #include "Epub/parsers/TocNcxParser.h"
 
-bool Epub::findContentOpfFile(std::string *contentOpfFile) const {
+bool Epub::findContentOpfFile(std::string *contentOpfFile,
+                              ExpatDriver &xml) const {
   const auto containerPath = "META-INF/container.xml";
   size_t containerSize;
 
   // Get file size without loading it all into heap
   if (!getItemSize(containerPath, &containerSize)) {
-    Serial.printf("[%lu] [EBP] Could not find or size META-INF/container.xml\n",
-                  millis());
+    LOG_ERR("EBP", "Could not find or size META-INF/container.xml\n");
     return false;
   }
 
   ContainerParser containerParser(containerSize);
 
-  if (!containerParser.setup()) {
+  if (!containerParser.setup(xml)) {
     return false;
   }
 
   // Stream read (reusing your existing stream logic)
   if (!readItemContentsToStream(containerPath, containerParser, 512)) {
-    Serial.printf("[%lu] [EBP] Could not read META-INF/container.xml\n",
-                  millis());
+    LOG_ERR("EBP", "Could not read META-INF/container.xml\n");
     return false;
   }
 
   // Extract the result
   if (containerParser.fullPath.empty()) {
-    Serial.printf(
-        "[%lu] [EBP] Could not find valid rootfile in container.xml\n",
-        millis());
+    LOG_ERR("EBP", "Could not find valid rootfile in container.xml\n");
     return false;
   }
 
@@ -47,34 +45,34 @@ bool Epub::findContentOpfFile(std::string *contentOpfFile) const {
   return true;
 }
 
-bool Epub::parseContentOpf(BookMetadataCache::BookMetadata &bookMetadata) {
+bool Epub::parseContentOpf(BookMetadataCache::BookMetadata &bookMetadata,
+                           ExpatDriver &xml) {
   std::string contentOpfFilePath;
-  if (!findContentOpfFile(&contentOpfFilePath)) {
-    Serial.printf("[%lu] [EBP] Could not find content.opf in zip\n", millis());
+  if (!findContentOpfFile(&contentOpfFilePath, xml)) {
+    LOG_ERR("EBP", "Could not find content.opf in zip\n");
     return false;
   }
 
   contentBasePath =
       contentOpfFilePath.substr(0, contentOpfFilePath.find_last_of('/') + 1);
 
-  Serial.printf("[%lu] [EBP] Parsing content.opf: %s\n", millis(),
-                contentOpfFilePath.c_str());
+  LOG_INF("EBP", "Parsing content.opf: %s\n", contentOpfFilePath.c_str());
 
   size_t contentOpfSize;
   if (!getItemSize(contentOpfFilePath, &contentOpfSize)) {
-    Serial.printf("[%lu] [EBP] Could not get size of content.opf\n", millis());
+    LOG_ERR("EBP", "Could not get size of content.opf\n");
     return false;
   }
 
   ContentOpfParser opfParser(getCachePath(), getBasePath(), contentOpfSize,
                              bookMetadataCache.get());
-  if (!opfParser.setup()) {
-    Serial.printf("[%lu] [EBP] Could not setup content.opf parser\n", millis());
+  if (!opfParser.setup(xml)) {
+    LOG_ERR("EBP", "Could not setup content.opf parser\n");
     return false;
   }
 
   if (!readItemContentsToStream(contentOpfFilePath, opfParser, 1024)) {
-    Serial.printf("[%lu] [EBP] Could not read content.opf\n", millis());
+    LOG_ERR("EBP", "Could not read content.opf\n");
     return false;
   }
 
@@ -93,19 +91,18 @@ bool Epub::parseContentOpf(BookMetadataCache::BookMetadata &bookMetadata) {
     tocNavItem = opfParser.tocNavPath;
   }
 
-  Serial.printf("[%lu] [EBP] Successfully parsed content.opf\n", millis());
+  LOG_INF("EBP", "Successfully parsed content.opf\n");
   return true;
 }
 
-bool Epub::parseTocNcxFile() const {
+bool Epub::parseTocNcxFile(ExpatDriver &xml) const {
   // the ncx file should have been specified in the content.opf file
   if (tocNcxItem.empty()) {
-    Serial.printf("[%lu] [EBP] No ncx file specified\n", millis());
+    LOG_INF("EBP", "No ncx file specified\n");
     return false;
   }
 
-  Serial.printf("[%lu] [EBP] Parsing toc ncx file: %s\n", millis(),
-                tocNcxItem.c_str());
+  LOG_INF("EBP", "Parsing toc ncx file: %s\n", tocNcxItem.c_str());
 
   const auto tmpNcxPath = getCachePath() + "/toc.ncx";
   FsFile tempNcxFile;
@@ -121,52 +118,33 @@ bool Epub::parseTocNcxFile() const {
 
   TocNcxParser ncxParser(contentBasePath, ncxSize, bookMetadataCache.get());
 
-  if (!ncxParser.setup()) {
-    Serial.printf("[%lu] [EBP] Could not setup toc ncx parser\n", millis());
+  if (!ncxParser.setup(xml)) {
+    LOG_ERR("EBP", "Could not setup toc ncx parser\n");
     tempNcxFile.close();
     return false;
   }
 
-  const auto ncxBuffer = static_cast<uint8_t *>(malloc(1024));
-  if (!ncxBuffer) {
-    Serial.printf("[%lu] [EBP] Could not allocate memory for toc ncx parser\n",
-                  millis());
+  if (!xml.parseFile(tempNcxFile)) {
+    LOG_ERR("EBP", "Could not process all toc ncx data\n");
     tempNcxFile.close();
     return false;
   }
 
-  while (tempNcxFile.available()) {
-    const auto readSize = tempNcxFile.read(ncxBuffer, 1024);
-    if (readSize == 0)
-      break;
-    const auto processedSize = ncxParser.write(ncxBuffer, readSize);
-
-    if (processedSize != readSize) {
-      Serial.printf("[%lu] [EBP] Could not process all toc ncx data\n",
-                    millis());
-      free(ncxBuffer);
-      tempNcxFile.close();
-      return false;
-    }
-  }
-
-  free(ncxBuffer);
   tempNcxFile.close();
   SdMan.remove(tmpNcxPath.c_str());
 
-  Serial.printf("[%lu] [EBP] Parsed TOC items\n", millis());
+  LOG_INF("EBP", "Parsed TOC items\n");
   return true;
 }
 
-bool Epub::parseTocNavFile() const {
+bool Epub::parseTocNavFile(ExpatDriver &xml) const {
   // the nav file should have been specified in the content.opf file (EPUB 3)
   if (tocNavItem.empty()) {
-    Serial.printf("[%lu] [EBP] No nav file specified\n", millis());
+    LOG_INF("EBP", "No nav file specified\n");
     return false;
   }
 
-  Serial.printf("[%lu] [EBP] Parsing toc nav file: %s\n", millis(),
-                tocNavItem.c_str());
+  LOG_INF("EBP", "Parsing toc nav file: %s\n", tocNavItem.c_str());
 
   const auto tmpNavPath = getCachePath() + "/toc.nav";
   FsFile tempNavFile;
@@ -187,49 +165,34 @@ bool Epub::parseTocNavFile() const {
       tocNavItem.substr(0, tocNavItem.find_last_of('/') + 1);
   TocNavParser navParser(navContentBasePath, navSize, bookMetadataCache.get());
 
-  if (!navParser.setup()) {
-    Serial.printf("[%lu] [EBP] Could not setup toc nav parser\n", millis());
+  if (!navParser.setup(xml)) {
+    LOG_ERR("EBP", "Could not setup toc nav parser\n");
     return false;
   }
 
-  const auto navBuffer = static_cast<uint8_t *>(malloc(1024));
-  if (!navBuffer) {
-    Serial.printf("[%lu] [EBP] Could not allocate memory for toc nav parser\n",
-                  millis());
+  if (!xml.parseFile(tempNavFile)) {
+    LOG_ERR("EBP", "Could not process all toc nav data\n");
+    tempNavFile.close();
     return false;
   }
 
-  while (tempNavFile.available()) {
-    const auto readSize = tempNavFile.read(navBuffer, 1024);
-    const auto processedSize = navParser.write(navBuffer, readSize);
-
-    if (processedSize != readSize) {
-      Serial.printf("[%lu] [EBP] Could not process all toc nav data\n",
-                    millis());
-      free(navBuffer);
-      tempNavFile.close();
-      return false;
-    }
-  }
-
-  free(navBuffer);
   tempNavFile.close();
   SdMan.remove(tmpNavPath.c_str());
 
-  Serial.printf("[%lu] [EBP] Parsed TOC nav items\n", millis());
+  LOG_INF("EBP", "Parsed TOC nav items\n");
   return true;
 }
 
 // load in the meta data for the epub file
-bool Epub::load(const bool buildIfMissing) {
-  Serial.printf("[%lu] [EBP] Loading ePub: %s\n", millis(), filepath.c_str());
+bool Epub::load(const bool buildIfMissing, ExpatDriver *xmlDriver) {
+  LOG_INF("EBP", "Loading ePub: %s\n", filepath.c_str());
 
   // Initialize spine/TOC cache
   bookMetadataCache.reset(new BookMetadataCache(cachePath));
 
   // Try to load existing cache first
   if (bookMetadataCache->load()) {
-    Serial.printf("[%lu] [EBP] Loaded ePub: %s\n", millis(), filepath.c_str());
+    LOG_INF("EBP", "Loaded ePub: %s\n", filepath.c_str());
     return true;
   }
 
@@ -239,15 +202,18 @@ bool Epub::load(const bool buildIfMissing) {
   }
 
   // Cache doesn't exist or is invalid, build it
-  Serial.printf("[%lu] [EBP] Cache not found, building spine/TOC cache\n",
-                millis());
+  LOG_INF("EBP", "Cache not found, building spine/TOC cache\n");
   setupCacheDir();
 
   const uint32_t indexingStart = millis();
 
+  // container.xml, content.opf and the TOC all go through one parser
+  ExpatDriver localDriver;
+  ExpatDriver &xml = xmlDriver ? *xmlDriver : localDriver;
+
   // Begin building cache - stream entries to disk immediately
   if (!bookMetadataCache->beginWrite()) {
-    Serial.printf("[%lu] [EBP] Could not begin writing cache\n", millis());
+    LOG_ERR("EBP", "Could not begin writing cache\n");
     return false;
   }
 
@@ -255,26 +221,23 @@ bool Epub::load(const bool buildIfMissing) {
   const uint32_t opfStart = millis();
   BookMetadataCache::BookMetadata bookMetadata;
   if (!bookMetadataCache->beginContentOpfPass()) {
-    Serial.printf("[%lu] [EBP] Could not begin writing content.opf pass\n",
-                  millis());
+    LOG_ERR("EBP", "Could not begin writing content.opf pass\n");
     return false;
   }
-  if (!parseContentOpf(bookMetadata)) {
-    Serial.printf("[%lu] [EBP] Could not parse content.opf\n", millis());
+  if (!parseContentOpf(bookMetadata, xml)) {
+    LOG_ERR("EBP", "Could not parse content.opf\n");
     return false;
   }
   if (!bookMetadataCache->endContentOpfPass()) {
-    Serial.printf("[%lu] [EBP] Could not end writing content.opf pass\n",
-                  millis());
+    LOG_ERR("EBP", "Could not end writing content.opf pass\n");
     return false;
   }
-  Serial.printf("[%lu] [EBP] OPF pass completed in %lu ms\n", millis(),
-                millis() - opfStart);
+  LOG_INF("EBP", "OPF pass completed in %lu ms\n", millis() - opfStart);
 
   // TOC Pass - try EPUB 3 nav first, fall back to NCX
   const uint32_t tocStart = millis();
   if (!bookMetadataCache->beginTocPass()) {
-    Serial.printf("[%lu] [EBP] Could not begin writing toc pass\n", millis());
+    LOG_ERR("EBP", "Could not begin writing toc pass\n");
     return false;
   }
 
@@ -282,78 +245,70 @@ bool Epub::load(const bool buildIfMissing) {
 
   // Try EPUB 3 nav document first (preferred)
   if (!tocNavItem.empty()) {
-    Serial.printf("[%lu] [EBP] Attempting to parse EPUB 3 nav document\n",
-                  millis());
-    tocParsed = parseTocNavFile();
+    LOG_INF("EBP", "Attempting to parse EPUB 3 nav document\n");
+    tocParsed = parseTocNavFile(xml);
   }
 
   // Fall back to NCX if nav parsing failed or wasn't available
   if (!tocParsed && !tocNcxItem.empty()) {
-    Serial.printf("[%lu] [EBP] Falling back to NCX TOC\n", millis());
-    tocParsed = parseTocNcxFile();
+    LOG_WRN("EBP", "Falling back to NCX TOC\n");
+    tocParsed = parseTocNcxFile(xml);
   }
 
   if (!tocParsed) {
-    Serial.printf("[%lu] [EBP] Warning: Could not parse any TOC format\n",
-                  millis());
+    LOG_WRN("EBP", "Warning: Could not parse any TOC format\n");
     // Continue anyway - book will work without TOC
   }
 
   if (!bookMetadataCache->endTocPass()) {
-    Serial.printf("[%lu] [EBP] Could not end writing toc pass\n", millis());
+    LOG_ERR("EBP", "Could not end writing toc pass\n");
     return false;
   }
-  Serial.printf("[%lu] [EBP] TOC pass completed in %lu ms\n", millis(),
-                millis() - tocStart);
+  LOG_INF("EBP", "TOC pass completed in %lu ms\n", millis() - tocStart);
 
   // Close the cache files
   if (!bookMetadataCache->endWrite()) {
-    Serial.printf("[%lu] [EBP] Could not end writing cache\n", millis());
+    LOG_ERR("EBP", "Could not end writing cache\n");
     return false;
   }
 
   // Build final book.bin
   const uint32_t buildStart = millis();
   if (!bookMetadataCache->buildBookBin(filepath, bookMetadata)) {
-    Serial.printf("[%lu] [EBP] Could not update mappings and sizes\n",
-                  millis());
+    LOG_ERR("EBP", "Could not update mappings and sizes\n");
     return false;
   }
-  Serial.printf("[%lu] [EBP] buildBookBin completed in %lu ms\n", millis(),
-                millis() - buildStart);
-  Serial.printf("[%lu] [EBP] Total indexing completed in %lu ms\n", millis(),
-                millis() - indexingStart);
+  LOG_INF("EBP", "buildBookBin completed in %lu ms\n", millis() - buildStart);
+  LOG_INF("EBP", "Total indexing completed in %lu ms\n",
+          millis() - indexingStart);
 
   if (!bookMetadataCache->cleanupTmpFiles()) {
-    Serial.printf("[%lu] [EBP] Could not cleanup tmp files - ignoring\n",
-                  millis());
+    LOG_WRN("EBP", "Could not cleanup tmp files - ignoring\n");
   }
 
   // Reload the cache from disk so it's in the correct state
   bookMetadataCache.reset(new BookMetadataCache(cachePath));
   if (!bookMetadataCache->load()) {
-    Serial.printf("[%lu] [EBP] Failed to reload cache after writing\n",
-                  millis());
+    LOG_ERR("EBP", "Failed to reload cache after writing\n");
     return false;
   }
 
-  Serial.printf("[%lu] [EBP] Loaded ePub: %s\n", millis(), filepath.c_str());
+  LOG_INF("EBP", "Loaded ePub: %s\n", filepath.c_str());
   return true;
 }
 
 bool Epub::clearCache() const {
   if (!SdMan.exists(cachePath.c_str())) {
-    Serial.printf("[%lu] [EPB] Cache does not exist, no action needed\n",
-                  millis());
+    LOG_INF("EPB", "Cache does not exist, no action needed\n");
     return true;
   }
 
   if (!SdMan.removeDir(cachePath.c_str())) {
-    Serial.printf("[%lu] [EPB] Failed to clear cache\n", millis());
+    LOG_ERR("EPB", "Failed to clear cache\n");
     return false;
   }
 
-  Serial.printf("[%lu] [EPB] Cache cleared successfully\n", millis());
+  LOG_INF("EPB", "Cache cleared successfully\n");
   return true;
 }
 
@@ -408,21 +363,20 @@ bool Epub::generateCoverBmp(bool cropped) const {
   }
 
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
-    Serial.printf("[%lu] [EBP] Cannot generate cover BMP, cache not loaded\n",
-                  millis());
+    LOG_ERR("EBP", "Cannot generate cover BMP, cache not loaded\n");
     return false;
   }
 
   const auto coverImageHref = bookMetadataCache->coreMetadata.coverItemHref;
   if (coverImageHref.empty()) {
-    Serial.printf("[%lu] [EBP] No known cover image\n", millis());
+    LOG_INF("EBP", "No known cover image\n");
     return false;
   }
 
   if (coverImageHref.substr(coverImageHref.length() - 4) == ".jpg" ||
       coverImageHref.substr(coverImageHref.length() - 5) == ".jpeg") {
-    Serial.printf("[%lu] [EBP] Generating BMP from JPG cover image (%s mode)\n",
-                  millis(), cropped ? "cropped" : "fit");
+    LOG_INF("EBP", "Generating BMP from JPG cover image (%s mode)\n",
+            cropped ? "cropped" : "fit");
     const auto coverJpgTempPath = getCachePath() + "/.cover.jpg";
 
     FsFile coverJpg;
@@ -448,16 +402,14 @@ bool Epub::generateCoverBmp(bool cropped) const {
     SdMan.remove(coverJpgTempPath.c_str());
 
     if (!success) {
-      Serial.printf("[%lu] [EBP] Failed to generate BMP from JPG cover image\n",
-                    millis());
+      LOG_ERR("EBP", "Failed to generate BMP from JPG cover image\n");
       SdMan.remove(getCoverBmpPath(cropped).c_str());
     }
-    Serial.printf(
-        "[%lu] [EBP] Generated BMP from JPG cover image, success: %s\n",
-        millis(), success ? "yes" : "no");
+    LOG_INF("EBP", "Generated BMP from JPG cover image, success: %s\n",
+            success ? "yes" : "no");
     return success;
   } else {
-    Serial.printf("[%lu] [EBP] Cover image is not a JPG, skipping\n", millis());
+    LOG_WRN("EBP", "Cover image is not a JPG, skipping\n");
   }
 
   return false;
@@ -472,21 +424,19 @@ bool Epub::generateThumbBmp() const {
   }
 
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
-    Serial.printf("[%lu] [EBP] Cannot generate thumb BMP, cache not loaded\n",
-                  millis());
+    LOG_ERR("EBP", "Cannot generate thumb BMP, cache not loaded\n");
     return false;
   }
 
   const auto coverImageHref = bookMetadataCache->coreMetadata.coverItemHref;
   if (coverImageHref.empty()) {
-    Serial.printf("[%lu] [EBP] No known cover image for thumbnail\n", millis());
+    LOG_INF("EBP", "No known cover image for thumbnail\n");
     return false;
   }
 
   if (coverImageHref.substr(coverImageHref.length() - 4) == ".jpg" ||
       coverImageHref.substr(coverImageHref.length() - 5) == ".jpeg") {
-    Serial.printf("[%lu] [EBP] Generating thumb BMP from JPG cover image\n",
-                  millis());
+    LOG_INF("EBP", "Generating thumb BMP from JPG cover image\n");
     const auto coverJpgTempPath = getCachePath() + "/.cover.jpg";
 
     FsFile coverJpg;
@@ -517,18 +467,14 @@ bool Epub::generateThumbBmp() const {
     SdMan.remove(coverJpgTempPath.c_str());
 
     if (!success) {
-      Serial.printf(
-          "[%lu] [EBP] Failed to generate thumb BMP from JPG cover image\n",
-          millis());
+      LOG_ERR("EBP", "Failed to generate thumb BMP from JPG cover image\n");
       SdMan.remove(getThumbBmpPath().c_str());
     }
-    Serial.printf(
-        "[%lu] [EBP] Generated thumb BMP from JPG cover image, success: %s\n",
-        millis(), success ? "yes" : "no");
+    LOG_INF("EBP", "Generated thumb BMP from JPG cover image, success: %s\n",
+            success ? "yes" : "no");
     return success;
   } else {
-    Serial.printf("[%lu] [EBP] Cover image is not a JPG, skipping thumbnail\n",
-                  millis());
+    LOG_WRN("EBP", "Cover image is not a JPG, skipping thumbnail\n");
   }
 
   return false;
@@ -538,7 +484,7 @@ uint8_t *Epub::readItemContentsToBytes(const std::string &itemHref,
                                        size_t *size,
                                        const bool trailingNullByte) const {
   if (itemHref.empty()) {
-    Serial.printf("[%lu] [EBP] Failed to read item, empty href\n", millis());
+    LOG_ERR("EBP", "Failed to read item, empty href\n");
     return nullptr;
   }
 
@@ -547,8 +493,7 @@ uint8_t *Epub::readItemContentsToBytes(const std::string &itemHref,
   const auto content =
       ZipFile(filepath).readFileToMemory(path.c_str(), size, trailingNullByte);
   if (!content) {
-    Serial.printf("[%lu] [EBP] Failed to read item %s\n", millis(),
-                  path.c_str());
+    LOG_ERR("EBP", "Failed to read item %s\n", path.c_str());
     return nullptr;
   }
 
@@ -558,7 +503,7 @@ uint8_t *Epub::readItemContentsToBytes(const std::string &itemHref,
 bool Epub::readItemContentsToStream(const std::string &itemHref, Print &out,
                                     const size_t chunkSize) const {
   if (itemHref.empty()) {
-    Serial.printf("[%lu] [EBP] Failed to read item, empty href\n", millis());
+    LOG_ERR("EBP", "Failed to read item, empty href\n");
     return false;
   }
 
@@ -584,14 +529,12 @@ size_t Epub::getCumulativeSpineItemSize(const int spineIndex) const {
 
 BookMetadataCache::SpineEntry Epub::getSpineItem(const int spineIndex) const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
-    Serial.printf("[%lu] [EBP] getSpineItem called but cache not loaded\n",
-                  millis());
+    LOG_INF("EBP", "getSpineItem called but cache not loaded\n");
     return {};
   }
 
   if (spineIndex < 0 || spineIndex >= bookMetadataCache->getSpineCount()) {
-    Serial.printf("[%lu] [EBP] getSpineItem index:%d is out of range\n",
-                  millis(), spineIndex);
+    LOG_INF("EBP", "getSpineItem index:%d is out of range\n", spineIndex);
     return bookMetadataCache->getSpineEntry(0);
   }
 
@@ -600,14 +543,12 @@ BookMetadataCache::SpineEntry Epub::getSpineItem(const int spineIndex) const {
 
 BookMetadataCache::TocEntry Epub::getTocItem(const int tocIndex) const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
-    Serial.printf("[%lu] [EBP] getTocItem called but cache not loaded\n",
-                  millis());
+    LOG_INF("EBP", "getTocItem called but cache not loaded\n");
     return {};
   }
 
   if (tocIndex < 0 || tocIndex >= bookMetadataCache->getTocCount()) {
-    Serial.printf("[%lu] [EBP] getTocItem index:%d is out of range\n", millis(),
-                  tocIndex);
+    LOG_INF("EBP", "getTocItem index:%d is out of range\n", tocIndex);
     return {};
   }
 
@@ -625,23 +566,19 @@ int Epub::getTocItemsCount() const {
 // work out the section index for a toc index
 int Epub::getSpineIndexForTocIndex(const int tocIndex) const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
-    Serial.printf(
-        "[%lu] [EBP] getSpineIndexForTocIndex called but cache not loaded\n",
-        millis());
+    LOG_INF("EBP", "getSpineIndexForTocIndex called but cache not loaded\n");
     return 0;
   }
 
   if (tocIndex < 0 || tocIndex >= bookMetadataCache->getTocCount()) {
-    Serial.printf(
-        "[%lu] [EBP] getSpineIndexForTocIndex: tocIndex %d out of range\n",
-        millis(), tocIndex);
+    LOG_INF("EBP", "getSpineIndexForTocIndex: tocIndex %d out of range\n",
+            tocIndex);
     return 0;
   }
 
   const int spineIndex = bookMetadataCache->getTocEntry(tocIndex).spineIndex;
   if (spineIndex < 0) {
-    Serial.printf("[%lu] [EBP] Section not found for TOC index %d\n", millis(),
-                  tocIndex);
+    LOG_WRN("EBP", "Section not found for TOC index %d\n", tocIndex);
     return 0;
   }
 
@@ -662,17 +599,15 @@ size_t Epub::getBookSize() const {
 
 int Epub::getSpineIndexForTextReference() const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
-    Serial.printf("[%lu] [EBP] getSpineIndexForTextReference called but cache "
-                  "not loaded\n",
-                  millis());
+    LOG_INF("EBP",
+            "getSpineIndexForTextReference called but cache not loaded\n");
     return 0;
   }
-  Serial.printf(
-      "[%lu] [ERS] Core Metadata: cover(%d)=%s, textReference(%d)=%s\n",
-      millis(), bookMetadataCache->coreMetadata.coverItemHref.size(),
-      bookMetadataCache->coreMetadata.coverItemHref.c_str(),
-      bookMetadataCache->coreMetadata.textReferenceHref.size(),
-      bookMetadataCache->coreMetadata.textReferenceHref.c_str());
+  LOG_INF("ERS", "Core Metadata: cover(%zu)=%s, textReference(%zu)=%s\n",
+          bookMetadataCache->coreMetadata.coverItemHref.size(),
+          bookMetadataCache->coreMetadata.coverItemHref.c_str(),
+          bookMetadataCache->coreMetadata.textReferenceHref.size(),
+          bookMetadataCache->coreMetadata.textReferenceHref.c_str());
 
   if (bookMetadataCache->coreMetadata.textReferenceHref.empty()) {
     // there was no textReference in epub, so we return 0 (the first chapter)
@@ -683,14 +618,13 @@ int Epub::getSpineIndexForTextReference() const {
   for (size_t i = 0; i < getSpineItemsCount(); i++) {
     if (getSpineItem(i).href ==
         bookMetadataCache->coreMetadata.textReferenceHref) {
-      Serial.printf(
-          "[%lu] [ERS] Text reference %s found at index %d\n", millis(),
-          bookMetadataCache->coreMetadata.textReferenceHref.c_str(), i);
+      LOG_INF("ERS", "Text reference %s found at index %zu\n",
+              bookMetadataCache->coreMetadata.textReferenceHref.c_str(), i);
       return i;
     }
   }
   // This should not happen, as we checked for empty textReferenceHref earlier
-  Serial.printf("[%lu] [EBP] Section not found for text reference\n", millis());
+  LOG_WRN("EBP", "Section not found for text reference\n");
   return 0;
 }
 
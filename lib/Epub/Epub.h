@@ -1,5 +1,6 @@
 #pragma once
 
+#include <BookCacheKey.h>
 #include <Print.h>
 
 #include <memory>
@@ -9,6 +10,7 @@
 
 #include "Epub/BookMetadataCache.h"
 
+class ExpatDriver;
 class ZipFile;
 
 class Epub {
@@ -20,27 +22,28 @@ class Epub {
   std::string filepath;
   // the base path for items in the EPUB file
   std::string contentBasePath;
-  // Uniq cache key based on filepath
+  // Uniq cache key based on the file content, survives moves and renames
   std::string cachePath;
   // Spine and TOC cache
   std::unique_ptr<BookMetadataCache> bookMetadataCache;
   bool imageLoadingEnabled = true;
 
-  bool findContentOpfFile(std::string *contentOpfFile) const;
-  bool parseContentOpf(BookMetadataCache::BookMetadata &bookMetadata);
-  bool parseTocNcxFile() const;
-  bool parseTocNavFile() const;
+  bool findContentOpfFile(std::string *contentOpfFile, ExpatDriver &xml) const;
+  bool parseContentOpf(BookMetadataCache::BookMetadata &bookMetadata,
+                       ExpatDriver &xml);
+  bool parseTocNcxFile(ExpatDriver &xml) const;
+  bool parseTocNavFile(ExpatDriver &xml) const;
 
 public:
   explicit Epub(std::string filepath, const std::string &cacheDir)
       : filepath(std::move(filepath)) {
-    // create a cache key based on the filepath
-    cachePath = cacheDir + "/epub_" +
-                std::to_string(std::hash<std::string>{}(this->filepath));
+    // create a cache key based on the file content
+    cachePath = BookCacheKey::getCachePath(cacheDir, "epub_", this->filepath);
   }
   ~Epub() = default;
   std::string &getBasePath() { return contentBasePath; }
-  bool load(bool buildIfMissing = true);
+  // xmlDriver lets a caller indexing several books reuse one XML parser
+  bool load(bool buildIfMissing = true, ExpatDriver *xmlDriver = nullptr);
   bool clearCache() const;
   void setupCacheDir() const;
   const std::string &getCachePath() const;
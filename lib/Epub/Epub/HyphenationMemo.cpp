@@ -0,0 +1,54 @@
+#include "HyphenationMemo.h"
+
+#include <algorithm>
+
+namespace {
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+}  // namespace
+
+HyphenationMemo::HyphenationMemo(const size_t capacity) : capacity(std::max<size_t>(capacity, 1)) {
+  // Entries are handed out by pointer, so the storage must never move
+  entries.reserve(this->capacity);
+}
+
+uint64_t HyphenationMemo::hashWord(const std::string& word) {
+  uint64_t hash = FNV_OFFSET_BASIS;
+  for (const char c : word) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+HyphenationMemo::Entry* HyphenationMemo::find(const std::string& word, const EpdFontFamily::Style style) {
+  const uint64_t hash = hashWord(word);
+  for (auto& entry : entries) {
+    if (entry.hash == hash && entry.style == style && entry.word == word) {
+      entry.lastUse = ++useCounter;
+      hits++;
+      return &entry;
+    }
+  }
+  misses++;
+  return nullptr;
+}
+
+HyphenationMemo::Entry& HyphenationMemo::insert(const std::string& word, const EpdFontFamily::Style style) {
+  Entry* entry;
+  if (entries.size() < capacity) {
+    entries.emplace_back();
+    entry = &entries.back();
+  } else {
+    entry = &*std::min_element(entries.begin(), entries.end(),
+                               [](const Entry& a, const Entry& b) { return a.lastUse < b.lastUse; });
+  }
+
+  entry->hash = hashWord(word);
+  entry->lastUse = ++useCounter;
+  entry->word = word;
+  entry->style = style;
+  entry->fallbackOnly = false;
+  entry->candidates.clear();
+  return *entry;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <EpdFontFamily.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Remembers where words can be hyphenated and how wide the resulting pieces are, so a word that overflows a line again
+// later in the chapter skips both the Liang lookup and the glyph measuring. Entries are keyed by the word and its
+// style, a hash of the word only skips most entries before the words are compared. Every other input (font, viewport,
+// hyphenation language) is fixed while a section is built, so a memo must not outlive one Section::createSectionFile
+// run. Holds at most `capacity` words, least recently used go first.
+class HyphenationMemo {
+ public:
+  static constexpr size_t DEFAULT_CAPACITY = 128;
+
+  struct Candidate {
+    uint16_t byteOffset;
+    uint16_t prefixWidth;  // Includes the inserted hyphen when one is required
+    uint16_t remainderWidth;
+    bool requiresInsertedHyphen;
+  };
+
+  struct Entry {
+    uint64_t hash = 0;
+    uint32_t lastUse = 0;
+    std::string word;
+    EpdFontFamily::Style style = EpdFontFamily::REGULAR;
+    // Candidates came from the fallback breaks because the language rules had none, only usable where those are allowed
+    bool fallbackOnly = false;
+    std::vector<Candidate> candidates;
+  };
+
+  explicit HyphenationMemo(size_t capacity = DEFAULT_CAPACITY);
+
+  // Entry for the word, or nullptr if it has to be computed. Counts a hit or a miss.
+  Entry* find(const std::string& word, EpdFontFamily::Style style);
+  // Empty entry for a word that missed, reusing the least recently used one once the memo is full.
+  Entry& insert(const std::string& word, EpdFontFamily::Style style);
+
+  uint32_t getHits() const { return hits; }
+  uint32_t getMisses() const { return misses; }
+  size_t size() const { return entries.size(); }
+
+ private:
+  std::vector<Entry> entries;
+  size_t capacity;
+  uint32_t useCounter = 0;
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+
+  static uint64_t hashWord(const std::string& word);
+};
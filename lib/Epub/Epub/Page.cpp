@@ -1,9 +1,11 @@
 #include "Page.h"
 #include "blocks/ImageBlock.h"
 
-#include <HardwareSerial.h>
+#include <Logging.h>
 #include <Serialization.h>
 
+#include <algorithm>
+
 void PageLine::render(GfxRenderer &renderer, const int fontId,
                       const int xOffset, const int yOffset) {
   block->render(renderer, fontId, xPos + xOffset, yPos + yOffset);
@@ -27,7 +29,7 @@ std::unique_ptr<PageLine> PageLine::deserialize(FsFile &file) {
   return std::unique_ptr<PageLine>(new PageLine(std::move(tb), xPos, yPos));
 }
 
-void PageImage::render(GfxRenderer &renderer, const int fontId,
+void PageImage::render(GfxRenderer &renderer, const int,
                        const int xOffset, const int yOffset) {
   block->render(renderer, xPos + xOffset, yPos + yOffset);
 }
@@ -57,6 +59,12 @@ void Page::render(GfxRenderer &renderer, const int fontId, const int xOffset,
   }
 }
 
+bool Page::hasImages() const {
+  return std::any_of(elements.begin(), elements.end(), [](const auto &el) {
+    return el->getTag() == TAG_PageImage;
+  });
+}
+
 bool Page::serialize(FsFile &file) const {
   const uint16_t count = elements.size();
   serialization::writePod(file, count);
@@ -89,8 +97,7 @@ std::unique_ptr<Page> Page::deserialize(FsFile &file) {
       auto pi = PageImage::deserialize(file);
       page->elements.push_back(std::move(pi));
     } else {
-      Serial.printf("[%lu] [PGE] Deserialization failed: Unknown tag %u\n",
-                    millis(), tag);
+      LOG_ERR("PGE", "Deserialization failed: Unknown tag %u\n", tag);
       return nullptr;
     }
   }
@@ -61,6 +61,8 @@ public:
   std::vector<std::shared_ptr<PageElement>> elements;
   void render(GfxRenderer &renderer, int fontId, int xOffset,
               int yOffset) const;
+  // Image elements read their bitmap from the SD card on every render
+  bool hasImages() const;
   bool serialize(FsFile &file) const;
   static std::unique_ptr<Page> deserialize(FsFile &file);
 };
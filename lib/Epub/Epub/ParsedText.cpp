@@ -12,6 +12,8 @@
 #include "hyphenation/Hyphenator.h"
 
 constexpr int MAX_COST = std::numeric_limits<int>::max();
+// Ending a line with a hyphen costs as much as this many spaces of unused width would
+constexpr int HYPHEN_PENALTY_SPACES = 3;
 
 namespace {
 
@@ -30,9 +32,11 @@ void stripSoftHyphensInPlace(std::string& word) {
 }
 
 // Returns the rendered width for a word while ignoring soft hyphen glyphs and optionally appending a visible hyphen.
+// mayHaveSoftHyphen is false when the paragraph is known to contain none, which skips the scan.
 uint16_t measureWordWidth(const GfxRenderer& renderer, const int fontId, const std::string& word,
-                          const EpdFontFamily::Style style, const bool appendHyphen = false) {
-  const bool hasSoftHyphen = containsSoftHyphen(word);
+                          const EpdFontFamily::Style style, const bool mayHaveSoftHyphen,
+                          const bool appendHyphen = false) {
+  const bool hasSoftHyphen = mayHaveSoftHyphen && containsSoftHyphen(word);
   if (!hasSoftHyphen && !appendHyphen) {
     return renderer.getTextWidth(fontId, word.c_str(), style);
   }
@@ -52,10 +56,20 @@ uint16_t measureWordWidth(const GfxRenderer& renderer, const int fontId, const s
 void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle) {
   if (word.empty()) return;
 
+  softHyphens = softHyphens || containsSoftHyphen(word);
   words.push_back(std::move(word));
   wordStyles.push_back(fontStyle);
 }
 
+void ParsedText::addWord(const char* data, const size_t length, const EpdFontFamily::Style fontStyle,
+                         const bool hasSoftHyphen) {
+  if (length == 0) return;
+
+  softHyphens = softHyphens || hasSoftHyphen;
+  words.emplace_back(data, length);
+  wordStyles.push_back(fontStyle);
+}
+
 // Consumes data to minimize memory usage
 void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fontId, const uint16_t viewportWidth,
                                        const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
@@ -70,13 +84,7 @@ void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fo
   const int pageWidth = viewportWidth;
   const int spaceWidth = renderer.getSpaceWidth(fontId);
   auto wordWidths = calculateWordWidths(renderer, fontId);
-  std::vector<size_t> lineBreakIndices;
-  if (hyphenationEnabled) {
-    // Use greedy layout that can split words mid-loop when a hyphenated prefix fits.
-    lineBreakIndices = computeHyphenatedLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths);
-  } else {
-    lineBreakIndices = computeLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths);
-  }
+  const auto lineBreakIndices = computeLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths);
   const size_t lineCount = includeLastLine ? lineBreakIndices.size() : lineBreakIndices.size() - 1;
 
   for (size_t i = 0; i < lineCount; ++i) {
@@ -94,7 +102,7 @@ std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& rendere
   auto wordStylesIt = wordStyles.begin();
 
   while (wordsIt != words.end()) {
-    wordWidths.push_back(measureWordWidth(renderer, fontId, *wordsIt, *wordStylesIt));
+    wordWidths.push_back(measureWordWidth(renderer, fontId, *wordsIt, *wordStylesIt, softHyphens));
 
     std::advance(wordsIt, 1);
     std::advance(wordStylesIt, 1);
@@ -103,95 +111,191 @@ std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& rendere
   return wordWidths;
 }
 
+// Optimal line breaking over word boundaries and hyphenation points (Knuth-Plass style, without stretch/shrink).
+//
+// Breakpoints are numbered in text order: 0..wordCount are the boundaries in front of each word (wordCount being the
+// end of the paragraph) and wordCount + 1 + i is candidates[i], a hyphenation point inside some word. A forward DP
+// relaxes every line that can start at a breakpoint; a line only ever extends until the first word that no longer
+// fits, so the work is O(n * w) for w breakpoints per line. Hyphenation points of a word are only looked at when that
+// word straddles the end of a line, and are collected into the flat candidate array the first time that happens.
+// The word list is left untouched until the best breaks are known, then split once.
 std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, const int fontId, const int pageWidth,
                                                   const int spaceWidth, std::vector<uint16_t>& wordWidths) {
-  if (words.empty()) {
+  const size_t wordCount = words.size();
+  if (wordCount == 0) {
     return {};
   }
 
-  // Ensure any word that would overflow even as the first entry on a line is split using fallback hyphenation.
-  for (size_t i = 0; i < wordWidths.size(); ++i) {
-    while (wordWidths[i] > pageWidth) {
-      if (!hyphenateWordAtIndex(i, pageWidth, renderer, fontId, wordWidths, /*allowFallbackBreaks=*/true)) {
-        break;
-      }
-    }
+  std::vector<std::string*> wordRefs;
+  wordRefs.reserve(wordCount);
+  for (auto& word : words) {
+    wordRefs.push_back(&word);
   }
+  const std::vector<EpdFontFamily::Style> styles(wordStyles.begin(), wordStyles.end());
+
+  std::vector<HyphenationMemo::Candidate> candidates;
+  std::vector<WordBreaks> wordBreaks(wordCount);
+
+  // Minimum total cost to reach each breakpoint and the breakpoint the last line started at
+  std::vector<int> boundaryCost(wordCount + 1, MAX_COST);
+  std::vector<int32_t> boundaryPrev(wordCount + 1, -1);
+  std::vector<int> candidateCost;
+  std::vector<int32_t> candidatePrev;
+  std::vector<uint32_t> candidateWord;  // Word each candidate belongs to
+  boundaryCost[0] = 0;
+
+  const auto candidateId = [wordCount](const size_t index) { return static_cast<int32_t>(wordCount + 1 + index); };
+  const int hyphenPenalty = HYPHEN_PENALTY_SPACES * spaceWidth * HYPHEN_PENALTY_SPACES * spaceWidth;
+
+  // Width of the part of word w between two hyphenation points (or the word edges when null)
+  const auto pieceWidth = [&](const size_t w, const HyphenationMemo::Candidate* from,
+                              const HyphenationMemo::Candidate* to) -> int {
+    if (!to) {
+      return from ? from->remainderWidth : wordWidths[w];
+    }
+    if (!from) {
+      return to->prefixWidth;
+    }
+    // A word wider than a whole line, rare enough to measure on demand
+    return measureWordWidth(renderer, fontId, wordRefs[w]->substr(from->byteOffset, to->byteOffset - from->byteOffset),
+                            styles[w], softHyphens, to->requiresInsertedHyphen);
+  };
+
+  // Extends lines from breakpoint `startId` and relaxes every breakpoint they can end at
+  const auto relaxFrom = [&](const int32_t startId, const size_t firstWord, const int32_t startCandidate) {
+    const int startCost = startId <= static_cast<int32_t>(wordCount) ? boundaryCost[startId]
+                                                                      : candidateCost[startId - wordCount - 1];
+    if (startCost == MAX_COST) {
+      return;  // Unreachable
+    }
 
-  const size_t totalWordCount = words.size();
-
-  // DP table to store the minimum badness (cost) of lines starting at index i
-  std::vector<int> dp(totalWordCount);
-  // 'ans[i]' stores the index 'j' of the *last word* in the optimal line starting at 'i'
-  std::vector<size_t> ans(totalWordCount);
-
-  // Base Case
-  dp[totalWordCount - 1] = 0;
-  ans[totalWordCount - 1] = totalWordCount - 1;
-
-  for (int i = totalWordCount - 2; i >= 0; --i) {
-    int currlen = -spaceWidth;
-    dp[i] = MAX_COST;
-
-    for (size_t j = i; j < totalWordCount; ++j) {
-      // Current line length: previous width + space + current word width
-      currlen += wordWidths[j] + spaceWidth;
-
-      if (currlen > pageWidth) {
-        break;
+    bool relaxed = false;
+    const auto relax = [&](const int32_t endId, const int lineWidth, const bool hyphenated) {
+      long long lineCost = 0;
+      if (endId != static_cast<int32_t>(wordCount)) {
+        const int remainingSpace = pageWidth - lineWidth;
+        lineCost = static_cast<long long>(remainingSpace) * remainingSpace + (hyphenated ? hyphenPenalty : 0);
       }
+      const long long total = std::min<long long>(startCost + lineCost, MAX_COST - 1);
+      int& endCost =
+          endId <= static_cast<int32_t>(wordCount) ? boundaryCost[endId] : candidateCost[endId - wordCount - 1];
+      int32_t& endPrev =
+          endId <= static_cast<int32_t>(wordCount) ? boundaryPrev[endId] : candidatePrev[endId - wordCount - 1];
+      if (total < endCost) {
+        endCost = static_cast<int>(total);
+        endPrev = startId;
+      }
+      relaxed = true;
+    };
 
-      int cost;
-      if (j == totalWordCount - 1) {
-        cost = 0;  // Last line
-      } else {
-        const int remainingSpace = pageWidth - currlen;
-        // Use long long for the square to prevent overflow
-        const long long cost_ll = static_cast<long long>(remainingSpace) * remainingSpace + dp[j + 1];
-
-        if (cost_ll > MAX_COST) {
-          cost = MAX_COST;
-        } else {
-          cost = static_cast<int>(cost_ll);
-        }
+    int lineWidth = 0;
+    size_t pieces = 0;
+    for (size_t w = firstWord; w < wordCount; ++w) {
+      const HyphenationMemo::Candidate* from =
+          (w == firstWord && startCandidate >= 0) ? &candidates[startCandidate] : nullptr;
+      const int spacing = pieces > 0 ? spaceWidth : 0;
+      const int fullWidth = pieceWidth(w, from, nullptr);
+
+      if (lineWidth + spacing + fullWidth <= pageWidth) {
+        lineWidth += spacing + fullWidth;
+        ++pieces;
+        relax(static_cast<int32_t>(w + 1), lineWidth, false);
+        continue;
       }
 
-      if (cost < dp[i]) {
-        dp[i] = cost;
-        ans[i] = j;  // j is the index of the last word in this optimal line
+      // Word straddles the end of the line. Without hyphenation only words too wide for any line are split, and
+      // fallback breaks are only allowed for a word that starts the line, like the reader always did.
+      const bool firstOnLine = pieces == 0;
+      if (hyphenationScratch && (hyphenationEnabled || (firstOnLine && fullWidth > pageWidth))) {
+        WordBreaks& breaks = wordBreaks[w];
+        if (!breaks.collected) {
+          collectWordBreaks(*wordRefs[w], styles[w], renderer, fontId, candidates, breaks);
+          candidateCost.resize(candidates.size(), MAX_COST);
+          candidatePrev.resize(candidates.size(), -1);
+          candidateWord.resize(candidates.size(), static_cast<uint32_t>(w));
+        }
+        if (!breaks.fallbackOnly || firstOnLine) {
+          for (uint32_t i = breaks.first; i < breaks.first + breaks.count; ++i) {
+            if (from && candidates[i].byteOffset <= from->byteOffset) {
+              continue;
+            }
+            const int width = lineWidth + spacing + pieceWidth(w, from, &candidates[i]);
+            if (width <= pageWidth) {
+              relax(candidateId(i), width, true);
+            }
+          }
+        }
       }
+      break;
     }
 
-    // Handle oversized word: if no valid configuration found, force single-word line
-    // This prevents cascade failure where one oversized word breaks all preceding words
-    if (dp[i] == MAX_COST) {
-      ans[i] = i;  // Just this word on its own line
-      // Inherit cost from next word to allow subsequent words to find valid configurations
-      if (i + 1 < static_cast<int>(totalWordCount)) {
-        dp[i] = dp[i + 1];
-      } else {
-        dp[i] = 0;
+    // Nothing fits: put the first piece on a line of its own, overflowing, and carry on after it
+    if (!relaxed) {
+      const long long total = startCost;
+      int& endCost = boundaryCost[firstWord + 1];
+      if (total < endCost) {
+        endCost = static_cast<int>(total);
+        boundaryPrev[firstWord + 1] = startId;
       }
     }
+  };
+
+  // Lines only run forward, so visiting breakpoints in text order finalizes each one before it is used as a start
+  for (size_t w = 0; w < wordCount; ++w) {
+    relaxFrom(static_cast<int32_t>(w), w, -1);
+    const WordBreaks& breaks = wordBreaks[w];
+    for (uint32_t i = breaks.first; breaks.collected && i < breaks.first + breaks.count; ++i) {
+      relaxFrom(candidateId(i), w, static_cast<int32_t>(i));
+    }
   }
 
-  // Stores the index of the word that starts the next line (last_word_index + 1)
-  std::vector<size_t> lineBreakIndices;
-  size_t currentWordIndex = 0;
-
-  while (currentWordIndex < totalWordCount) {
-    size_t nextBreakIndex = ans[currentWordIndex] + 1;
+  // Walk back from the end of the paragraph to recover the chosen breakpoints
+  std::vector<int32_t> path;
+  for (int32_t id = static_cast<int32_t>(wordCount); id > 0;
+       id = id <= static_cast<int32_t>(wordCount) ? boundaryPrev[id] : candidatePrev[id - wordCount - 1]) {
+    path.push_back(id);
+  }
+  std::reverse(path.begin(), path.end());
 
-    // Safety check: prevent infinite loop if nextBreakIndex doesn't advance
-    if (nextBreakIndex <= currentWordIndex) {
-      // Force advance by at least one word to avoid infinite loop
-      nextBreakIndex = currentWordIndex + 1;
+  // Materialize the lines: whole words move over, words broken at hyphenation points are split into their pieces
+  std::list<std::string> splitWords;
+  std::list<EpdFontFamily::Style> splitStyles;
+  std::vector<uint16_t> splitWidths;
+  std::vector<size_t> lineBreakIndices;
+  lineBreakIndices.reserve(path.size());
+
+  size_t nextWord = 0;
+  const HyphenationMemo::Candidate* carry = nullptr;  // Where the current word was broken on the previous line
+  for (const int32_t endId : path) {
+    const bool endsMidWord = endId > static_cast<int32_t>(wordCount);
+    const HyphenationMemo::Candidate* end = endsMidWord ? &candidates[endId - wordCount - 1] : nullptr;
+    const size_t lastWord = endsMidWord ? candidateWord[endId - wordCount - 1] : static_cast<size_t>(endId) - 1;
+
+    for (size_t w = nextWord; w <= lastWord; ++w) {
+      const HyphenationMemo::Candidate* from = w == nextWord ? carry : nullptr;
+      const HyphenationMemo::Candidate* to = w == lastWord ? end : nullptr;
+      if (!from && !to) {
+        splitWords.push_back(std::move(*wordRefs[w]));
+      } else {
+        const size_t begin = from ? from->byteOffset : 0;
+        std::string piece = to ? wordRefs[w]->substr(begin, to->byteOffset - begin) : wordRefs[w]->substr(begin);
+        if (to && to->requiresInsertedHyphen) {
+          piece.push_back('-');
+        }
+        splitWords.push_back(std::move(piece));
+      }
+      splitStyles.push_back(styles[w]);
+      splitWidths.push_back(static_cast<uint16_t>(pieceWidth(w, from, to)));
     }
 
-    lineBreakIndices.push_back(nextBreakIndex);
-    currentWordIndex = nextBreakIndex;
+    lineBreakIndices.push_back(splitWords.size());
+    nextWord = endsMidWord ? lastWord : lastWord + 1;
+    carry = end;
   }
 
+  words = std::move(splitWords);
+  wordStyles = std::move(splitStyles);
+  wordWidths = std::move(splitWidths);
   return lineBreakIndices;
 }
 
@@ -205,126 +309,56 @@ void ParsedText::applyParagraphIndent() {
   }
 }
 
-// Builds break indices while opportunistically splitting the word that would overflow the current line.
-std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& renderer, const int fontId,
-                                                            const int pageWidth, const int spaceWidth,
-                                                            std::vector<uint16_t>& wordWidths) {
-  std::vector<size_t> lineBreakIndices;
-  size_t currentIndex = 0;
-
-  while (currentIndex < wordWidths.size()) {
-    const size_t lineStart = currentIndex;
-    int lineWidth = 0;
-
-    // Consume as many words as possible for current line, splitting when prefixes fit
-    while (currentIndex < wordWidths.size()) {
-      const bool isFirstWord = currentIndex == lineStart;
-      const int spacing = isFirstWord ? 0 : spaceWidth;
-      const int candidateWidth = spacing + wordWidths[currentIndex];
-
-      // Word fits on current line
-      if (lineWidth + candidateWidth <= pageWidth) {
-        lineWidth += candidateWidth;
-        ++currentIndex;
-        continue;
-      }
-
-      // Word would overflow — try to split based on hyphenation points
-      const int availableWidth = pageWidth - lineWidth - spacing;
-      const bool allowFallbackBreaks = isFirstWord;  // Only for first word on line
-
-      if (availableWidth > 0 &&
-          hyphenateWordAtIndex(currentIndex, availableWidth, renderer, fontId, wordWidths, allowFallbackBreaks)) {
-        // Prefix now fits; append it to this line and move to next line
-        lineWidth += spacing + wordWidths[currentIndex];
-        ++currentIndex;
-        break;
-      }
-
-      // Could not split: force at least one word per line to avoid infinite loop
-      if (currentIndex == lineStart) {
-        lineWidth += candidateWidth;
-        ++currentIndex;
-      }
-      break;
-    }
-
-    lineBreakIndices.push_back(currentIndex);
+// Points to the hyphenation points of a word in the flat candidate array, appending them from the memo or by computing
+// them.
+void ParsedText::collectWordBreaks(const std::string& word, const EpdFontFamily::Style wordStyle,
+                                   const GfxRenderer& renderer, const int fontId,
+                                   std::vector<HyphenationMemo::Candidate>& candidates, WordBreaks& out) {
+  HyphenationMemo::Entry uncached;
+  HyphenationMemo::Entry* entry = hyphenationMemo ? hyphenationMemo->find(word, wordStyle) : nullptr;
+  if (!entry) {
+    entry = hyphenationMemo ? &hyphenationMemo->insert(word, wordStyle) : &uncached;
+    collectHyphenationCandidates(word, wordStyle, renderer, fontId, *entry);
   }
 
-  return lineBreakIndices;
+  out.first = static_cast<uint32_t>(candidates.size());
+  out.count = static_cast<uint16_t>(entry->candidates.size());
+  out.collected = true;
+  out.fallbackOnly = entry->fallbackOnly;
+  candidates.insert(candidates.end(), entry->candidates.begin(), entry->candidates.end());
 }
 
-// Splits words[wordIndex] into prefix (adding a hyphen only when needed) and remainder when a legal breakpoint fits the
-// available width.
-bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availableWidth, const GfxRenderer& renderer,
-                                      const int fontId, std::vector<uint16_t>& wordWidths,
-                                      const bool allowFallbackBreaks) {
-  // Guard against invalid indices or zero available width before attempting to split.
-  if (availableWidth <= 0 || wordIndex >= words.size()) {
-    return false;
-  }
-
-  // Get iterators to target word and style.
-  auto wordIt = words.begin();
-  auto styleIt = wordStyles.begin();
-  std::advance(wordIt, wordIndex);
-  std::advance(styleIt, wordIndex);
-
-  const std::string& word = *wordIt;
-  const auto style = *styleIt;
-
-  // Collect candidate breakpoints (byte offsets and hyphen requirements).
-  auto breakInfos = Hyphenator::breakOffsets(word, allowFallbackBreaks);
-  if (breakInfos.empty()) {
-    return false;
+// Fills entry with every legal breakpoint of the word and the widths of the two pieces it would leave.
+void ParsedText::collectHyphenationCandidates(const std::string& word, const EpdFontFamily::Style wordStyle,
+                                              const GfxRenderer& renderer, const int fontId,
+                                              HyphenationMemo::Entry& entry) {
+  // Language (or explicit) breaks first, fallback breaks only when there are none so the entry serves both callers.
+  size_t breakCount = Hyphenator::breakOffsets(word, false, *hyphenationScratch);
+  entry.fallbackOnly = false;
+  if (breakCount == 0) {
+    breakCount = Hyphenator::breakOffsets(word, true, *hyphenationScratch);
+    entry.fallbackOnly = breakCount > 0;
   }
 
-  size_t chosenOffset = 0;
-  int chosenWidth = -1;
-  bool chosenNeedsHyphen = true;
-
-  // Iterate over each legal breakpoint and retain the widest prefix that still fits.
-  for (const auto& info : breakInfos) {
+  entry.candidates.clear();
+  entry.candidates.reserve(breakCount);
+  std::string piece;
+  piece.reserve(word.size());
+  for (size_t i = 0; i < breakCount; ++i) {
+    const auto& info = hyphenationScratch->breaks[i];
     const size_t offset = info.byteOffset;
     if (offset == 0 || offset >= word.size()) {
       continue;
     }
 
-    const bool needsHyphen = info.requiresInsertedHyphen;
-    const int prefixWidth = measureWordWidth(renderer, fontId, word.substr(0, offset), style, needsHyphen);
-    if (prefixWidth > availableWidth || prefixWidth <= chosenWidth) {
-      continue;  // Skip if too wide or not an improvement
-    }
-
-    chosenWidth = prefixWidth;
-    chosenOffset = offset;
-    chosenNeedsHyphen = needsHyphen;
-  }
-
-  if (chosenWidth < 0) {
-    // No hyphenation point produced a prefix that fits in the remaining space.
-    return false;
+    piece.assign(word, 0, offset);
+    const uint16_t prefixWidth =
+        measureWordWidth(renderer, fontId, piece, wordStyle, softHyphens, info.requiresInsertedHyphen);
+    piece.assign(word, offset, std::string::npos);
+    const uint16_t remainderWidth = measureWordWidth(renderer, fontId, piece, wordStyle, softHyphens);
+    entry.candidates.push_back(
+        {static_cast<uint16_t>(offset), prefixWidth, remainderWidth, info.requiresInsertedHyphen});
   }
-
-  // Split the word at the selected breakpoint and append a hyphen if required.
-  std::string remainder = word.substr(chosenOffset);
-  wordIt->resize(chosenOffset);
-  if (chosenNeedsHyphen) {
-    wordIt->push_back('-');
-  }
-
-  // Insert the remainder word (with matching style) directly after the prefix.
-  auto insertWordIt = std::next(wordIt);
-  auto insertStyleIt = std::next(styleIt);
-  words.insert(insertWordIt, remainder);
-  wordStyles.insert(insertStyleIt, style);
-
-  // Update cached widths to reflect the new prefix/remainder pairing.
-  wordWidths[wordIndex] = static_cast<uint16_t>(chosenWidth);
-  const uint16_t remainderWidth = measureWordWidth(renderer, fontId, remainder, style);
-  wordWidths.insert(wordWidths.begin() + wordIndex + 1, remainderWidth);
-  return true;
 }
 
 void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const int spaceWidth,
@@ -378,9 +412,11 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   std::list<EpdFontFamily::Style> lineWordStyles;
   lineWordStyles.splice(lineWordStyles.begin(), wordStyles, wordStyles.begin(), wordStyleEndIt);
 
-  for (auto& word : lineWords) {
-    if (containsSoftHyphen(word)) {
-      stripSoftHyphensInPlace(word);
+  if (softHyphens) {
+    for (auto& word : lineWords) {
+      if (containsSoftHyphen(word)) {
+        stripSoftHyphensInPlace(word);
+      }
     }
   }
 
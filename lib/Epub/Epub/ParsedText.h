@@ -8,7 +8,9 @@
 #include <string>
 #include <vector>
 
+#include "HyphenationMemo.h"
 #include "blocks/TextBlock.h"
+#include "hyphenation/Hyphenator.h"
 
 class GfxRenderer;
 
@@ -18,14 +20,28 @@ class ParsedText {
   TextBlock::Style style;
   bool extraParagraphSpacing;
   bool hyphenationEnabled;
+  // Shared working memory for splitting words, owned by the chapter parser. Without it words are never split.
+  Hyphenator::Scratch* hyphenationScratch;
+  // Break candidates of words seen earlier in the chapter, owned by the section build. Optional.
+  HyphenationMemo* hyphenationMemo;
+  // Whether any word contains a soft hyphen, lets measuring and line extraction skip scanning for them
+  bool softHyphens = false;
+
+  // Hyphenation points of one word, as a range of the flat candidate array built by computeLineBreaks.
+  struct WordBreaks {
+    uint32_t first = 0;
+    uint16_t count = 0;
+    bool collected = false;
+    bool fallbackOnly = false;
+  };
 
   void applyParagraphIndent();
   std::vector<size_t> computeLineBreaks(const GfxRenderer& renderer, int fontId, int pageWidth, int spaceWidth,
                                         std::vector<uint16_t>& wordWidths);
-  std::vector<size_t> computeHyphenatedLineBreaks(const GfxRenderer& renderer, int fontId, int pageWidth,
-                                                  int spaceWidth, std::vector<uint16_t>& wordWidths);
-  bool hyphenateWordAtIndex(size_t wordIndex, int availableWidth, const GfxRenderer& renderer, int fontId,
-                            std::vector<uint16_t>& wordWidths, bool allowFallbackBreaks);
+  void collectWordBreaks(const std::string& word, EpdFontFamily::Style wordStyle, const GfxRenderer& renderer,
+                         int fontId, std::vector<HyphenationMemo::Candidate>& candidates, WordBreaks& out);
+  void collectHyphenationCandidates(const std::string& word, EpdFontFamily::Style wordStyle,
+                                    const GfxRenderer& renderer, int fontId, HyphenationMemo::Entry& entry);
   void extractLine(size_t breakIndex, int pageWidth, int spaceWidth, const std::vector<uint16_t>& wordWidths,
                    const std::vector<size_t>& lineBreakIndices,
                    const std::function<void(std::shared_ptr<TextBlock>)>& processLine);
@@ -33,11 +49,18 @@ class ParsedText {
 
  public:
   explicit ParsedText(const TextBlock::Style style, const bool extraParagraphSpacing,
-                      const bool hyphenationEnabled = false)
-      : style(style), extraParagraphSpacing(extraParagraphSpacing), hyphenationEnabled(hyphenationEnabled) {}
+                      const bool hyphenationEnabled = false, Hyphenator::Scratch* hyphenationScratch = nullptr,
+                      HyphenationMemo* hyphenationMemo = nullptr)
+      : style(style),
+        extraParagraphSpacing(extraParagraphSpacing),
+        hyphenationEnabled(hyphenationEnabled),
+        hyphenationScratch(hyphenationScratch),
+        hyphenationMemo(hyphenationMemo) {}
   ~ParsedText() = default;
 
   void addWord(std::string word, EpdFontFamily::Style fontStyle);
+  // Adds a word straight from a parser buffer, the caller already knows whether it contains a soft hyphen
+  void addWord(const char* data, size_t length, EpdFontFamily::Style fontStyle, bool hasSoftHyphen);
   void setStyle(const TextBlock::Style style) { this->style = style; }
   TextBlock::Style getStyle() const { return style; }
   size_t size() const { return words.size(); }
@@ -1,14 +1,18 @@
 #include "Section.h"
 
+#include <HeapStats.h>
+#include <Logging.h>
 #include <SDCardManager.h>
 #include <Serialization.h>
+#include <Trace.h>
 
+#include "HyphenationMemo.h"
 #include "Page.h"
 #include "hyphenation/Hyphenator.h"
 #include "parsers/ChapterHtmlSlimParser.h"
 
 namespace {
-constexpr uint8_t SECTION_FILE_VERSION = 10;
+constexpr uint8_t SECTION_FILE_VERSION = 11;
 constexpr uint32_t HEADER_SIZE =
     sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) +
     sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) +
@@ -17,20 +21,17 @@ constexpr uint32_t HEADER_SIZE =
 
 uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
   if (!file) {
-    Serial.printf("[%lu] [SCT] File not open for writing page %d\n", millis(),
-                  pageCount);
+    LOG_ERR("SCT", "File not open for writing page %d\n", pageCount);
     return 0;
   }
 
   const uint32_t position = file.position();
   if (!page->serialize(file)) {
-    Serial.printf("[%lu] [SCT] Failed to serialize page %d\n", millis(),
-                  pageCount);
+    LOG_ERR("SCT", "Failed to serialize page %d\n", pageCount);
     return 0;
   }
-  Serial.printf("[%lu] [SCT] Page %d processed\n", millis(), pageCount);
-
   pageCount++;
+  TRACE_COUNTER("section.pages", pageCount);
   return position;
 }
 
@@ -42,7 +43,7 @@ void Section::writeSectionFileHeader(const int fontId,
                                      const uint16_t viewportHeight,
                                      const bool hyphenationEnabled) {
   if (!file) {
-    Serial.printf("[%lu] [SCT] File not open for writing header\n", millis());
+    LOG_ERR("SCT", "File not open for writing header\n");
     return;
   }
   static_assert(HEADER_SIZE ==
@@ -83,8 +84,7 @@ bool Section::loadSectionFile(const int fontId, const float lineCompression,
     serialization::readPod(file, version);
     if (version != SECTION_FILE_VERSION) {
       file.close();
-      Serial.printf("[%lu] [SCT] Deserialization failed: Unknown version %u\n",
-                    millis(), version);
+      LOG_ERR("SCT", "Deserialization failed: Unknown version %u\n", version);
       clearCache();
       return false;
     }
@@ -110,9 +110,7 @@ bool Section::loadSectionFile(const int fontId, const float lineCompression,
         viewportHeight != fileViewportHeight ||
         hyphenationEnabled != fileHyphenationEnabled) {
       file.close();
-      Serial.printf(
-          "[%lu] [SCT] Deserialization failed: Parameters do not match\n",
-          millis());
+      LOG_ERR("SCT", "Deserialization failed: Parameters do not match\n");
       clearCache();
       return false;
     }
@@ -120,8 +118,7 @@ bool Section::loadSectionFile(const int fontId, const float lineCompression,
 
   serialization::readPod(file, pageCount);
   file.close();
-  Serial.printf("[%lu] [SCT] Deserialization succeeded: %d pages\n", millis(),
-                pageCount);
+  LOG_INF("SCT", "Deserialization succeeded: %d pages\n", pageCount);
   return true;
 }
 
@@ -129,17 +126,16 @@ bool Section::loadSectionFile(const int fontId, const float lineCompression,
 // wrapper for a specific filesystem)
 bool Section::clearCache() const {
   if (!SdMan.exists(filePath.c_str())) {
-    Serial.printf("[%lu] [SCT] Cache does not exist, no action needed\n",
-                  millis());
+    LOG_INF("SCT", "Cache does not exist, no action needed\n");
     return true;
   }
 
   if (!SdMan.remove(filePath.c_str())) {
-    Serial.printf("[%lu] [SCT] Failed to clear cache\n", millis());
+    LOG_ERR("SCT", "Failed to clear cache\n");
     return false;
   }
 
-  Serial.printf("[%lu] [SCT] Cache cleared successfully\n", millis());
+  LOG_INF("SCT", "Cache cleared successfully\n");
   return true;
 }
 
@@ -150,7 +146,10 @@ bool Section::createSectionFile(const int fontId, const float lineCompression,
                                 const uint16_t viewportHeight,
                                 const bool hyphenationEnabled,
                                 const std::function<void()> &progressSetupFn,
-                                const std::function<void(int)> &progressFn) {
+                                const std::function<void(int)> &progressFn,
+                                ExpatDriver *xmlDriver) {
+  TRACE_SCOPE("section.build");
+  heapstats::mark("section", "start");
   constexpr uint32_t MIN_SIZE_FOR_PROGRESS = 50 * 1024; // 50KB
   const auto localPath = epub->getSpineItem(spineIndex).href;
   const auto tmpHtmlPath =
@@ -167,8 +166,7 @@ bool Section::createSectionFile(const int fontId, const float lineCompression,
   uint32_t fileSize = 0;
   for (int attempt = 0; attempt < 3 && !success; attempt++) {
     if (attempt > 0) {
-      Serial.printf("[%lu] [SCT] Retrying stream (attempt %d)...\n", millis(),
-                    attempt + 1);
+      LOG_WRN("SCT", "Retrying stream (attempt %d)...\n", attempt + 1);
       delay(50); // Brief delay before retry
     }
 
@@ -188,21 +186,19 @@ bool Section::createSectionFile(const int fontId, const float lineCompression,
     // If streaming failed, remove the incomplete file immediately
     if (!success && SdMan.exists(tmpHtmlPath.c_str())) {
       SdMan.remove(tmpHtmlPath.c_str());
-      Serial.printf(
-          "[%lu] [SCT] Removed incomplete temp file after failed attempt\n",
-          millis());
+      LOG_WRN("SCT", "Removed incomplete temp file after failed attempt\n");
     }
   }
 
   if (!success) {
-    Serial.printf("[%lu] [SCT] Failed to stream item contents to temp file "
-                  "after retries\n",
-                  millis());
+    LOG_ERR("SCT",
+            "Failed to stream item contents to temp file after retries\n");
     return false;
   }
 
-  Serial.printf("[%lu] [SCT] Streamed temp HTML to %s (%d bytes)\n", millis(),
-                tmpHtmlPath.c_str(), fileSize);
+  LOG_INF("SCT", "Streamed temp HTML to %s (%d bytes)\n", tmpHtmlPath.c_str(),
+          fileSize);
+  heapstats::mark("section", "streamed");
 
   // Only show progress bar for larger chapters where rendering overhead is
   // worth it
@@ -218,6 +214,8 @@ bool Section::createSectionFile(const int fontId, const float lineCompression,
                          hyphenationEnabled);
   std::vector<uint32_t> lut = {};
 
+  // Chapters repeat the same long words, remember how they split for this run
+  HyphenationMemo hyphenationMemo;
   ChapterHtmlSlimParser visitor(
       tmpHtmlPath, localPath, epub.get(), renderer, fontId, lineCompression,
       extraParagraphSpacing, paragraphAlignment, viewportWidth, viewportHeight,
@@ -225,14 +223,16 @@ bool Section::createSectionFile(const int fontId, const float lineCompression,
       [this, &lut](std::unique_ptr<Page> page) {
         lut.emplace_back(this->onPageComplete(std::move(page)));
       },
-      progressFn);
+      progressFn, &hyphenationMemo, xmlDriver);
   Hyphenator::setPreferredLanguage(epub->getLanguage());
   success = visitor.parseAndBuildPages();
+  heapstats::mark("section", "parsed");
+  LOG_INF("SCT", "Hyphenation memo: %u hits, %u misses\n",
+          hyphenationMemo.getHits(), hyphenationMemo.getMisses());
 
   SdMan.remove(tmpHtmlPath.c_str());
   if (!success) {
-    Serial.printf("[%lu] [SCT] Failed to parse XML and build pages\n",
-                  millis());
+    LOG_ERR("SCT", "Failed to parse XML and build pages\n");
     file.close();
     SdMan.remove(filePath.c_str());
     return false;
@@ -250,9 +250,7 @@ bool Section::createSectionFile(const int fontId, const float lineCompression,
   }
 
   if (hasFailedLutRecords) {
-    Serial.printf(
-        "[%lu] [SCT] Failed to write LUT due to invalid page positions\n",
-        millis());
+    LOG_ERR("SCT", "Failed to write LUT due to invalid page positions\n");
     file.close();
     SdMan.remove(filePath.c_str());
     return false;
@@ -263,6 +261,7 @@ bool Section::createSectionFile(const int fontId, const float lineCompression,
   serialization::writePod(file, pageCount);
   serialization::writePod(file, lutOffset);
   file.close();
+  heapstats::mark("section", "done");
   return true;
 }
 
@@ -4,6 +4,7 @@
 
 #include "Epub.h"
 
+class ExpatDriver;
 class Page;
 class GfxRenderer;
 
@@ -34,6 +35,6 @@ class Section {
   bool createSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                          uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled,
                          const std::function<void()>& progressSetupFn = nullptr,
-                         const std::function<void(int)>& progressFn = nullptr);
+                         const std::function<void(int)>& progressFn = nullptr, ExpatDriver* xmlDriver = nullptr);
   std::unique_ptr<Page> loadPageFromSectionFile();
 };
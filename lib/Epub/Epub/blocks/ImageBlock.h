@@ -16,7 +16,7 @@ public:
       : bmpPath(std::move(bmpPath)), width(width), height(height) {}
   ~ImageBlock() override = default;
 
-  void layout(GfxRenderer &renderer) override {}
+  void layout(GfxRenderer &) override {}
   BlockType getType() override { return IMAGE_BLOCK; }
   bool isEmpty() override { return bmpPath.empty(); }
 
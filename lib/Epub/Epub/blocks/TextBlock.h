@@ -32,7 +32,7 @@ class TextBlock final : public Block {
   void setStyle(const Style style) { this->style = style; }
   Style getStyle() const { return style; }
   bool isEmpty() override { return words.empty(); }
-  void layout(GfxRenderer& renderer) override {};
+  void layout(GfxRenderer&) override {};
   // given a renderer works out where to break the words into lines
   void render(const GfxRenderer& renderer, int fontId, int x, int y) const;
   BlockType getType() override { return TEXT_BLOCK; }
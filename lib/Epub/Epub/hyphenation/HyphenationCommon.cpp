@@ -135,36 +135,47 @@ bool isExplicitHyphen(const uint32_t cp) {
 
 bool isSoftHyphen(const uint32_t cp) { return cp == 0x00AD; }
 
-void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps) {
-  if (cps.empty()) {
-    return;
-  }
+namespace {
 
+// Narrows [begin, end) so it excludes trailing footnote references and surrounding punctuation.
+void trimRange(const CodepointInfo* cps, size_t& begin, size_t& end) {
   // Remove trailing footnote references like [12], even if punctuation trails after the closing bracket.
-  if (cps.size() >= 3) {
-    int end = static_cast<int>(cps.size()) - 1;
-    while (end >= 0 && isPunctuation(cps[end].value)) {
-      --end;
+  if (end - begin >= 3) {
+    int last = static_cast<int>(end) - 1;
+    while (last >= static_cast<int>(begin) && isPunctuation(cps[last].value)) {
+      --last;
     }
-    int pos = end;
-    if (pos >= 0 && isAsciiDigit(cps[pos].value)) {
-      while (pos >= 0 && isAsciiDigit(cps[pos].value)) {
+    int pos = last;
+    if (pos >= static_cast<int>(begin) && isAsciiDigit(cps[pos].value)) {
+      while (pos >= static_cast<int>(begin) && isAsciiDigit(cps[pos].value)) {
         --pos;
       }
-      if (pos >= 0 && cps[pos].value == '[' && end - pos > 1) {
-        cps.erase(cps.begin() + pos, cps.end());
+      if (pos >= static_cast<int>(begin) && cps[pos].value == '[' && last - pos > 1) {
+        end = static_cast<size_t>(pos);
       }
     }
   }
 
-  while (!cps.empty() && isPunctuation(cps.front().value)) {
-    cps.erase(cps.begin());
+  while (begin < end && isPunctuation(cps[begin].value)) {
+    ++begin;
   }
-  while (!cps.empty() && isPunctuation(cps.back().value)) {
-    cps.pop_back();
+  while (begin < end && isPunctuation(cps[end - 1].value)) {
+    --end;
   }
 }
 
+}  // namespace
+
+void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps) {
+  size_t begin = 0;
+  size_t end = cps.size();
+  trimRange(cps.data(), begin, end);
+  cps.erase(cps.begin() + end, cps.end());
+  cps.erase(cps.begin(), cps.begin() + begin);
+}
+
+void trimSurroundingPunctuationAndFootnote(CodepointBuffer& cps) { trimRange(cps.items, cps.begin, cps.end); }
+
 std::vector<CodepointInfo> collectCodepoints(const std::string& word) {
   std::vector<CodepointInfo> cps;
   cps.reserve(word.size());
@@ -179,3 +190,23 @@ std::vector<CodepointInfo> collectCodepoints(const std::string& word) {
 
   return cps;
 }
+
+bool collectCodepoints(const std::string& word, CodepointBuffer& out) {
+  out.begin = 0;
+  out.end = 0;
+  if (word.size() > MAX_HYPHENATION_WORD_BYTES) {
+    return false;
+  }
+
+  // Every codepoint takes at least one byte, so the byte length bounds the count. Checking the end pointer as well
+  // keeps a truncated multi-byte sequence from walking past the terminator.
+  const unsigned char* base = reinterpret_cast<const unsigned char*>(word.c_str());
+  const unsigned char* ptr = base;
+  const unsigned char* last = base + word.size();
+  while (ptr < last && *ptr != 0) {
+    const unsigned char* current = ptr;
+    const uint32_t cp = utf8NextCodepoint(&ptr);
+    out.items[out.end++] = {cp, static_cast<size_t>(current - base)};
+  }
+  return true;
+}
@@ -10,6 +10,23 @@ struct CodepointInfo {
   size_t byteOffset;
 };
 
+// Longest word, in UTF-8 bytes, the hyphenation pipeline accepts. All per-word working memory is sized from this. The
+// EPUB parser flushes words at MAX_WORD_SIZE (200 bytes); the rest is headroom for the paragraph indent prepended to
+// the first word of a block.
+constexpr size_t MAX_HYPHENATION_WORD_BYTES = 256;
+
+// Fixed-capacity codepoint list for a single word. Trimming only moves `begin`/`end`, nothing is copied.
+struct CodepointBuffer {
+  CodepointInfo items[MAX_HYPHENATION_WORD_BYTES];
+  size_t begin = 0;
+  size_t end = 0;
+
+  const CodepointInfo* data() const { return items + begin; }
+  size_t size() const { return end - begin; }
+  bool empty() const { return begin == end; }
+  const CodepointInfo& operator[](const size_t i) const { return items[begin + i]; }
+};
+
 uint32_t toLowerLatin(uint32_t cp);
 uint32_t toLowerCyrillic(uint32_t cp);
 
@@ -22,4 +39,7 @@ bool isAsciiDigit(uint32_t cp);
 bool isExplicitHyphen(uint32_t cp);
 bool isSoftHyphen(uint32_t cp);
 void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps);
+void trimSurroundingPunctuationAndFootnote(CodepointBuffer& cps);
 std::vector<CodepointInfo> collectCodepoints(const std::string& word);
+// Returns false (leaving `out` empty) if the word does not fit in the buffer.
+bool collectCodepoints(const std::string& word, CodepointBuffer& out);
@@ -1,8 +1,5 @@
 #include "Hyphenator.h"
 
-#include <vector>
-
-#include "HyphenationCommon.h"
 #include "LanguageRegistry.h"
 
 const LanguageHyphenator* Hyphenator::cachedHyphenator_ = nullptr;
@@ -26,14 +23,10 @@ const LanguageHyphenator* hyphenatorForLanguage(const std::string& langTag) {
   return getLanguageHyphenatorForPrimaryTag(primary);
 }
 
-// Maps a codepoint index back to its byte offset inside the source word.
-size_t byteOffsetForIndex(const std::vector<CodepointInfo>& cps, const size_t index) {
-  return (index < cps.size()) ? cps[index].byteOffset : (cps.empty() ? 0 : cps.back().byteOffset);
-}
-
-// Builds a vector of break information from explicit hyphen markers in the given codepoints.
-std::vector<Hyphenator::BreakInfo> buildExplicitBreakInfos(const std::vector<CodepointInfo>& cps) {
-  std::vector<Hyphenator::BreakInfo> breaks;
+// Collects explicit hyphen markers that are surrounded by letters into scratch.breaks.
+size_t buildExplicitBreakInfos(Hyphenator::Scratch& scratch) {
+  const CodepointBuffer& cps = scratch.cps;
+  size_t found = 0;
 
   // Scan every codepoint looking for explicit/soft hyphen markers that are surrounded by letters.
   for (size_t i = 1; i + 1 < cps.size(); ++i) {
@@ -42,56 +35,48 @@ std::vector<Hyphenator::BreakInfo> buildExplicitBreakInfos(const std::vector<Cod
       continue;
     }
     // Offset points to the next codepoint so rendering starts after the hyphen marker.
-    breaks.push_back({cps[i + 1].byteOffset, isSoftHyphen(cp)});
+    scratch.breaks[found++] = {cps[i + 1].byteOffset, isSoftHyphen(cp)};
   }
 
-  return breaks;
+  return found;
 }
 
 }  // namespace
 
-std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& word, const bool includeFallback) {
-  if (word.empty()) {
-    return {};
-  }
-
+size_t Hyphenator::breakOffsets(const std::string& word, const bool includeFallback, Scratch& scratch) {
   // Convert to codepoints and normalize word boundaries.
-  auto cps = collectCodepoints(word);
-  trimSurroundingPunctuationAndFootnote(cps);
+  if (word.empty() || !collectCodepoints(word, scratch.cps)) {
+    return 0;
+  }
+  trimSurroundingPunctuationAndFootnote(scratch.cps);
   const auto* hyphenator = cachedHyphenator_;
+  const CodepointBuffer& cps = scratch.cps;
 
   // Explicit hyphen markers (soft or hard) take precedence over language breaks.
-  auto explicitBreakInfos = buildExplicitBreakInfos(cps);
-  if (!explicitBreakInfos.empty()) {
-    return explicitBreakInfos;
+  const size_t explicitCount = buildExplicitBreakInfos(scratch);
+  if (explicitCount > 0) {
+    return explicitCount;
   }
 
   // Ask language hyphenator for legal break points.
-  std::vector<size_t> indexes;
+  size_t found = 0;
   if (hyphenator) {
-    indexes = hyphenator->breakIndexes(cps);
+    const size_t indexCount = hyphenator->breakIndexes(cps.data(), cps.size(), scratch.liang);
+    for (size_t i = 0; i < indexCount; ++i) {
+      scratch.breaks[found++] = {cps[scratch.liang.breaks[i]].byteOffset, true};
+    }
   }
 
   // Only add fallback breaks if needed
-  if (includeFallback && indexes.empty()) {
+  if (includeFallback && found == 0) {
     const size_t minPrefix = hyphenator ? hyphenator->minPrefix() : LiangWordConfig::kDefaultMinPrefix;
     const size_t minSuffix = hyphenator ? hyphenator->minSuffix() : LiangWordConfig::kDefaultMinSuffix;
     for (size_t idx = minPrefix; idx + minSuffix <= cps.size(); ++idx) {
-      indexes.push_back(idx);
+      scratch.breaks[found++] = {cps[idx].byteOffset, true};
     }
   }
 
-  if (indexes.empty()) {
-    return {};
-  }
-
-  std::vector<Hyphenator::BreakInfo> breaks;
-  breaks.reserve(indexes.size());
-  for (const size_t idx : indexes) {
-    breaks.push_back({byteOffsetForIndex(cps, idx), true});
-  }
-
-  return breaks;
+  return found;
 }
 
 void Hyphenator::setPreferredLanguage(const std::string& lang) { cachedHyphenator_ = hyphenatorForLanguage(lang); }
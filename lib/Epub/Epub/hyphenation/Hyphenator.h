@@ -2,7 +2,9 @@
 
 #include <cstddef>
 #include <string>
-#include <vector>
+
+#include "HyphenationCommon.h"
+#include "LiangHyphenation.h"
 
 class LanguageHyphenator;
 
@@ -12,9 +14,18 @@ class Hyphenator {
     size_t byteOffset;
     bool requiresInsertedHyphen;
   };
-  // Returns byte offsets where the word may be hyphenated. When includeFallback is true, all positions obeying the
-  // minimum prefix/suffix constraints are returned even if no language-specific rule matches.
-  static std::vector<BreakInfo> breakOffsets(const std::string& word, bool includeFallback);
+  // Working memory for breakOffsets, sized for the longest word the hyphenator accepts. It is several KB, so keep one
+  // on the heap for the duration of a layout pass rather than on a task stack.
+  struct Scratch {
+    CodepointBuffer cps;
+    LiangScratch liang;
+    BreakInfo breaks[MAX_HYPHENATION_WORD_BYTES];
+  };
+
+  // Computes the byte offsets where the word may be hyphenated into scratch.breaks and returns how many there are.
+  // When includeFallback is true, all positions obeying the minimum prefix/suffix constraints are returned even if no
+  // language-specific rule matches. Does not allocate.
+  static size_t breakOffsets(const std::string& word, bool includeFallback, Scratch& scratch);
 
   // Provide a publication-level language hint (e.g. "en", "en-US", "ru") used to select hyphenation rules.
   static void setPreferredLanguage(const std::string& lang);
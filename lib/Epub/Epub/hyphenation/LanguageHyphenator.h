@@ -10,8 +10,12 @@ class LanguageHyphenator {
                      size_t minSuffix = LiangWordConfig::kDefaultMinSuffix)
       : patterns_(patterns), config_(isLetterFn, toLowerFn, minPrefix, minSuffix) {}
 
-  std::vector<size_t> breakIndexes(const std::vector<CodepointInfo>& cps) const {
-    return liangBreakIndexes(cps, patterns_, config_);
+  std::vector<size_t> breakIndexes(const std::vector<CodepointInfo>& cps, LiangScratch& scratch) const {
+    return liangBreakIndexes(cps, patterns_, config_, scratch);
+  }
+
+  size_t breakIndexes(const CodepointInfo* cps, const size_t count, LiangScratch& scratch) const {
+    return liangBreakIndexes(cps, count, patterns_, config_, scratch);
   }
 
   size_t minPrefix() const { return config_.minPrefix; }
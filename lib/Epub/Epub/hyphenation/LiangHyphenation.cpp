@@ -7,7 +7,7 @@
  * Liang hyphenation pipeline overview (Typst-style binary trie variant)
  * --------------------------------------------------------------------
  * 1.  Input normalization (buildAugmentedWord)
- *     - Accepts a vector of CodepointInfo structs emitted by the EPUB text
+ *     - Accepts an array of CodepointInfo structs emitted by the EPUB text
  *       parser. Each codepoint is validated with LiangWordConfig::isLetter so
  *       we abort early on digits, punctuation, etc. If the word is valid we
  *       build an "augmented" byte sequence: leading '.', lowercase UTF-8 bytes
@@ -15,17 +15,21 @@
  *       UTF-8 byte offset for each character and a reverse lookup table that
  *       maps UTF-8 byte indexes back to codepoint indexes. This lets the rest
  *       of the algorithm stay byte-oriented (matching the serialized automaton)
- *       while still emitting hyphen positions in codepoint space.
+ *       while still emitting hyphen positions in codepoint space. All of these
+ *       tables live in the caller's LiangScratch.
  *
  * 2.  Automaton decoding
  *     - SerializedHyphenationPatterns stores a contiguous blob generated from
  *       Typst's binary tries. The first 4 bytes contain the root offset. Each
  *       node packs transitions, variable-stride relative offsets to child
  *       nodes, and an optional pointer into a shared "levels" list. We parse
- *       that layout lazily via decodeState/transition, keeping everything in
- *       flash memory; no heap allocations besides the stack-local AutomatonState
- *       structs. getAutomaton caches parseAutomaton results per blob pointer so
- *       multiple words hitting the same language only pay the cost once.
+ *       that layout lazily via decodeNode/transition, keeping the trie in
+ *       flash memory. getAutomaton caches parseAutomaton results per blob
+ *       pointer, including a byte-indexed table of the root's decoded children,
+ *       so multiple words hitting the same language only pay the cost once.
+ *       Deeper nodes are kept in a small direct-mapped cache in LiangScratch,
+ *       so the hot part of the trie is decoded once per chapter rather than on
+ *       every step.
  *
  * 3.  Pattern application
  *     - We walk the augmented bytes left-to-right. For each starting byte we
@@ -45,160 +49,121 @@
  *       etc.
  *
  * Keeping the entire algorithm small and deterministic is critical on the
- * ESP32-C3: we avoid recursion, dynamic allocations per node, or copying the
+ * ESP32-C3: we avoid recursion, dynamic allocations per word, or copying the
  * trie. All lookups stay within the generated blob, which lives in flash, and
- * the working buffers (augmented bytes/scores) scale with the word length rather
- * than the pattern corpus.
+ * the working buffers (augmented bytes/scores) are fixed-size arrays bounded by
+ * MAX_HYPHENATION_WORD_BYTES rather than the pattern corpus.
  */
 
 namespace {
 
-struct AugmentedWord {
-  std::vector<uint8_t> bytes;
-  std::vector<size_t> charByteOffsets;
-  std::vector<int32_t> byteToCharIndex;
-
-  bool empty() const { return bytes.empty(); }
-  size_t charCount() const { return charByteOffsets.size(); }
-};
-
-// Encode a single Unicode codepoint into UTF-8 and append to the provided buffer.
-size_t encodeUtf8(uint32_t cp, std::vector<uint8_t>& out) {
+// Encode a single Unicode codepoint into UTF-8 at `out`, returning the byte count or 0 if it does not fit.
+size_t encodeUtf8(uint32_t cp, uint8_t* out, const size_t capacity) {
   if (cp <= 0x7Fu) {
-    out.push_back(static_cast<uint8_t>(cp));
+    if (capacity < 1) return 0;
+    out[0] = static_cast<uint8_t>(cp);
     return 1;
   }
   if (cp <= 0x7FFu) {
-    out.push_back(static_cast<uint8_t>(0xC0u | ((cp >> 6) & 0x1Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
+    if (capacity < 2) return 0;
+    out[0] = static_cast<uint8_t>(0xC0u | ((cp >> 6) & 0x1Fu));
+    out[1] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
     return 2;
   }
   if (cp <= 0xFFFFu) {
-    out.push_back(static_cast<uint8_t>(0xE0u | ((cp >> 12) & 0x0Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
+    if (capacity < 3) return 0;
+    out[0] = static_cast<uint8_t>(0xE0u | ((cp >> 12) & 0x0Fu));
+    out[1] = static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu));
+    out[2] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
     return 3;
   }
-  out.push_back(static_cast<uint8_t>(0xF0u | ((cp >> 18) & 0x07u)));
-  out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 12) & 0x3Fu)));
-  out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu)));
-  out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
+  if (capacity < 4) return 0;
+  out[0] = static_cast<uint8_t>(0xF0u | ((cp >> 18) & 0x07u));
+  out[1] = static_cast<uint8_t>(0x80u | ((cp >> 12) & 0x3Fu));
+  out[2] = static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu));
+  out[3] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
   return 4;
 }
 
-// Build the dotted, lowercase UTF-8 representation plus lookup tables.
-AugmentedWord buildAugmentedWord(const std::vector<CodepointInfo>& cps, const LiangWordConfig& config) {
-  AugmentedWord word;
-  if (cps.empty()) {
-    return word;
+// Build the dotted, lowercase UTF-8 representation plus lookup tables inside `scratch`.
+// Returns the augmented byte count, or 0 if the word contains a non-letter or does not fit.
+size_t buildAugmentedWord(const CodepointInfo* cps, const size_t count, const LiangWordConfig& config,
+                          LiangScratch& scratch) {
+  if (count == 0 || count + 2 > LiangScratch::MAX_CHARS) {
+    return 0;
   }
 
-  word.bytes.reserve(cps.size() * 2 + 2);
-  word.charByteOffsets.reserve(cps.size() + 2);
-
-  word.charByteOffsets.push_back(0);
-  word.bytes.push_back('.');
+  size_t byteCount = 0;
+  scratch.charByteOffsets[0] = 0;
+  scratch.bytes[byteCount++] = '.';
 
-  for (const auto& info : cps) {
-    if (!config.isLetter(info.value)) {
-      word.bytes.clear();
-      word.charByteOffsets.clear();
-      word.byteToCharIndex.clear();
-      return word;
+  for (size_t i = 0; i < count; ++i) {
+    if (!config.isLetter(cps[i].value)) {
+      return 0;
     }
-    word.charByteOffsets.push_back(word.bytes.size());
-    encodeUtf8(config.toLower(info.value), word.bytes);
+    scratch.charByteOffsets[i + 1] = static_cast<uint16_t>(byteCount);
+    const size_t written =
+        encodeUtf8(config.toLower(cps[i].value), scratch.bytes + byteCount, LiangScratch::MAX_BYTES - 1 - byteCount);
+    if (written == 0) {
+      return 0;
+    }
+    byteCount += written;
   }
 
-  word.charByteOffsets.push_back(word.bytes.size());
-  word.bytes.push_back('.');
+  scratch.charByteOffsets[count + 1] = static_cast<uint16_t>(byteCount);
+  scratch.bytes[byteCount++] = '.';
 
-  word.byteToCharIndex.assign(word.bytes.size(), -1);
-  for (size_t i = 0; i < word.charByteOffsets.size(); ++i) {
-    const size_t offset = word.charByteOffsets[i];
-    if (offset < word.byteToCharIndex.size()) {
-      word.byteToCharIndex[offset] = static_cast<int32_t>(i);
-    }
+  std::fill(scratch.byteToCharIndex, scratch.byteToCharIndex + byteCount, static_cast<int16_t>(-1));
+  for (size_t i = 0; i < count + 2; ++i) {
+    scratch.byteToCharIndex[scratch.charByteOffsets[i]] = static_cast<int16_t>(i);
   }
-  return word;
+  return byteCount;
 }
 
+using CachedNode = LiangScratch::CachedNode;
+
 // Decoded view of a single trie node pulled straight out of the serialized blob.
 // - transitions: contiguous list of next-byte values
 // - targets: packed relative offsets (1/2/3 bytes) for each transition
 // - levels: optional pointer into the global levels list with packed dist/level pairs
 struct AutomatonState {
-  const uint8_t* data = nullptr;
-  size_t size = 0;
-  size_t addr = 0;
-  uint8_t stride = 1;
-  size_t childCount = 0;
   const uint8_t* transitions = nullptr;
   const uint8_t* targets = nullptr;
   const uint8_t* levels = nullptr;
-  size_t levelsLen = 0;
+  uint32_t addr = 0;
+  uint8_t stride = 1;
+  uint8_t childCount = 0;
+  uint8_t levelsLen = 0;
+  bool isValid = false;
 
-  bool valid() const { return data != nullptr; }
+  bool valid() const { return isValid; }
 };
 
 // Lightweight descriptor for the entire embedded automaton.
 // The blob format is:
 //   [0..3]  - big-endian root offset
 //   [4....] - node heap containing variable-sized headers + transition data
+// Every word restarts at the root once per character, so the root's children are decoded up front and indexed by
+// byte: rootChildSlot[b] is 1 + the index into rootChildren, or 0 when the root has no transition for b.
 struct EmbeddedAutomaton {
   const uint8_t* data = nullptr;
   size_t size = 0;
   uint32_t rootOffset = 0;
+  AutomatonState root;
+  uint8_t rootChildSlot[256] = {};
+  std::vector<AutomatonState> rootChildren;
 
-  bool valid() const { return data != nullptr && size >= 4 && rootOffset < size; }
+  bool valid() const { return data != nullptr && size >= 4 && rootOffset < size && root.valid(); }
 };
 
-// Decode the serialized automaton header and root offset.
-EmbeddedAutomaton parseAutomaton(const SerializedHyphenationPatterns& patterns) {
-  EmbeddedAutomaton automaton;
-  if (!patterns.data || patterns.size < 4) {
-    return automaton;
-  }
-
-  automaton.data = patterns.data;
-  automaton.size = patterns.size;
-  automaton.rootOffset = (static_cast<uint32_t>(patterns.data[0]) << 24) |
-                         (static_cast<uint32_t>(patterns.data[1]) << 16) |
-                         (static_cast<uint32_t>(patterns.data[2]) << 8) | static_cast<uint32_t>(patterns.data[3]);
-  if (automaton.rootOffset >= automaton.size) {
-    automaton.data = nullptr;
-    automaton.size = 0;
-  }
-  return automaton;
-}
-
-// Cache parsed automata per blob pointer to avoid reparsing.
-const EmbeddedAutomaton& getAutomaton(const SerializedHyphenationPatterns& patterns) {
-  struct CacheEntry {
-    const SerializedHyphenationPatterns* key;
-    EmbeddedAutomaton automaton;
-  };
-  static std::vector<CacheEntry> cache;
-
-  for (const auto& entry : cache) {
-    if (entry.key == &patterns) {
-      return entry.automaton;
-    }
-  }
-
-  cache.push_back({&patterns, parseAutomaton(patterns)});
-  return cache.back().automaton;
-}
-
-// Interpret the node located at `addr`, returning transition metadata.
-AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
-  AutomatonState state;
-  if (!automaton.valid() || addr >= automaton.size) {
-    return state;
+// Parse and validate the header of the node located at `addr` into its packed form.
+bool decodeNode(const uint8_t* data, const size_t size, const size_t addr, CachedNode& node) {
+  if (data == nullptr || addr >= size) {
+    return false;
   }
 
-  const uint8_t* base = automaton.data + addr;
-  size_t remaining = automaton.size - addr;
+  const uint8_t* base = data + addr;
+  size_t remaining = size - addr;
   size_t pos = 0;
 
   const uint8_t header = base[pos++];
@@ -214,51 +179,59 @@ AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
   size_t childCount = static_cast<size_t>(header & 0x1Fu);
   if (childCount == 31u) {
     if (pos >= remaining) {
-      return AutomatonState{};
+      return false;
     }
     childCount = base[pos++];
   }
 
-  const uint8_t* levelsPtr = nullptr;
-  size_t levelsLen = 0;
+  uint16_t levels = 0;
   if (hasLevels) {
     if (pos + 1 >= remaining) {
-      return AutomatonState{};
+      return false;
     }
     const uint8_t offsetHi = base[pos++];
     const uint8_t offsetLoLen = base[pos++];
     // The 12-bit offset (hi<<4 | top nibble) points into the blob-level levels list.
     // The bottom nibble stores how many packed entries belong to this node.
     const size_t offset = (static_cast<size_t>(offsetHi) << 4) | (offsetLoLen >> 4);
-    levelsLen = offsetLoLen & 0x0Fu;
-    if (offset + levelsLen > automaton.size) {
-      return AutomatonState{};
+    if (offset + (offsetLoLen & 0x0Fu) > size) {
+      return false;
     }
-    levelsPtr = automaton.data + offset;
+    levels = static_cast<uint16_t>((offsetHi << 8) | offsetLoLen);
   }
 
-  if (pos + childCount > remaining) {
-    return AutomatonState{};
+  if (pos + childCount + childCount * stride > remaining) {
+    return false;
   }
-  const uint8_t* transitions = base + pos;
-  pos += childCount;
 
-  const size_t targetsBytes = childCount * stride;
-  if (pos + targetsBytes > remaining) {
+  node.addr = static_cast<uint32_t>(addr);
+  node.levels = levels;
+  node.layout = static_cast<uint8_t>(pos | (stride << 4));
+  node.childCount = static_cast<uint8_t>(childCount);
+  return true;
+}
+
+// Turn a validated packed node back into pointers into the blob.
+AutomatonState expandNode(const uint8_t* data, const CachedNode& node) {
+  AutomatonState state;
+  state.addr = node.addr;
+  state.stride = node.layout >> 4;
+  state.childCount = node.childCount;
+  state.transitions = data + node.addr + (node.layout & 0x0Fu);
+  state.targets = state.transitions + node.childCount;
+  state.levelsLen = node.levels & 0x0Fu;
+  state.levels = state.levelsLen > 0 ? data + (node.levels >> 4) : nullptr;
+  state.isValid = true;
+  return state;
+}
+
+// Interpret the node located at `addr`, returning transition metadata.
+AutomatonState decodeState(const uint8_t* data, const size_t size, const size_t addr) {
+  CachedNode node;
+  if (!decodeNode(data, size, addr, node)) {
     return AutomatonState{};
   }
-  const uint8_t* targets = base + pos;
-
-  state.data = automaton.data;
-  state.size = automaton.size;
-  state.addr = addr;
-  state.stride = stride;
-  state.childCount = childCount;
-  state.transitions = transitions;
-  state.targets = targets;
-  state.levels = levelsPtr;
-  state.levelsLen = levelsLen;
-  return state;
+  return expandNode(data, node);
 }
 
 // Convert the packed stride-sized delta back into a signed offset.
@@ -274,12 +247,8 @@ int32_t decodeDelta(const uint8_t* buf, uint8_t stride) {
   return unsignedVal - (1 << 23);
 }
 
-// Follow a single byte transition from `state`, decoding the child node on success.
-bool transition(const EmbeddedAutomaton& automaton, const AutomatonState& state, uint8_t letter, AutomatonState& out) {
-  if (!state.valid()) {
-    return false;
-  }
-
+// Find the address of the child reached from `state` via `letter`, or 0 if there is none.
+size_t childAddress(const EmbeddedAutomaton& automaton, const AutomatonState& state, const uint8_t letter) {
   // Children remain sorted by letter in the serialized blob, but the lists are
   // short enough that a linear scan keeps code size down compared to binary search.
   for (size_t idx = 0; idx < state.childCount; ++idx) {
@@ -291,80 +260,151 @@ bool transition(const EmbeddedAutomaton& automaton, const AutomatonState& state,
     // Deltas are relative to the current node's address, allowing us to keep all
     // targets within 24 bits while still referencing further nodes in the blob.
     const int64_t nextAddr = static_cast<int64_t>(state.addr) + delta;
-    if (nextAddr < 0 || static_cast<size_t>(nextAddr) >= automaton.size) {
-      return false;
+    if (nextAddr < 4 || static_cast<size_t>(nextAddr) >= automaton.size) {
+      return 0;
     }
-    out = decodeState(automaton, static_cast<size_t>(nextAddr));
-    return out.valid();
+    return static_cast<size_t>(nextAddr);
   }
-  return false;
+  return 0;
 }
 
-// Converts odd score positions back into codepoint indexes, honoring min prefix/suffix constraints.
-// Each break corresponds to scores[breakIndex + 1] because of the leading '.' sentinel.
-// Convert odd score entries into hyphen positions while honoring prefix/suffix limits.
-std::vector<size_t> collectBreakIndexes(const std::vector<CodepointInfo>& cps, const std::vector<uint8_t>& scores,
-                                        const size_t minPrefix, const size_t minSuffix) {
-  std::vector<size_t> indexes;
-  const size_t cpCount = cps.size();
-  if (cpCount < 2) {
-    return indexes;
+// Decode the serialized automaton header, the root node and the root's child lookup table.
+void parseAutomaton(const SerializedHyphenationPatterns& patterns, EmbeddedAutomaton& automaton) {
+  if (!patterns.data || patterns.size < 4) {
+    return;
+  }
+
+  const uint32_t rootOffset = (static_cast<uint32_t>(patterns.data[0]) << 24) |
+                              (static_cast<uint32_t>(patterns.data[1]) << 16) |
+                              (static_cast<uint32_t>(patterns.data[2]) << 8) | static_cast<uint32_t>(patterns.data[3]);
+  if (rootOffset >= patterns.size) {
+    return;
   }
 
-  for (size_t breakIndex = 1; breakIndex < cpCount; ++breakIndex) {
-    if (breakIndex < minPrefix) {
+  automaton.data = patterns.data;
+  automaton.size = patterns.size;
+  automaton.rootOffset = rootOffset;
+  automaton.root = decodeState(automaton.data, automaton.size, rootOffset);
+  if (!automaton.root.valid()) {
+    return;
+  }
+
+  automaton.rootChildren.reserve(automaton.root.childCount);
+  for (size_t idx = 0; idx < automaton.root.childCount; ++idx) {
+    const uint8_t letter = automaton.root.transitions[idx];
+    if (automaton.rootChildSlot[letter] != 0) {
       continue;
     }
-
-    const size_t suffixCount = cpCount - breakIndex;
-    if (suffixCount < minSuffix) {
+    const AutomatonState child =
+        decodeState(automaton.data, automaton.size, childAddress(automaton, automaton.root, letter));
+    if (!child.valid()) {
       continue;
     }
+    automaton.rootChildren.push_back(child);
+    automaton.rootChildSlot[letter] = static_cast<uint8_t>(automaton.rootChildren.size());
+  }
+}
 
-    const size_t scoreIdx = breakIndex + 1;
-    if (scoreIdx >= scores.size()) {
-      break;
+// Cache parsed automata per blob pointer to avoid reparsing.
+const EmbeddedAutomaton& getAutomaton(const SerializedHyphenationPatterns& patterns) {
+  struct CacheEntry {
+    const SerializedHyphenationPatterns* key;
+    EmbeddedAutomaton automaton;
+  };
+  static std::vector<CacheEntry> cache;
+
+  for (const auto& entry : cache) {
+    if (entry.key == &patterns) {
+      return entry.automaton;
     }
-    if ((scores[scoreIdx] & 1u) == 0) {
-      continue;
+  }
+
+  cache.emplace_back();
+  cache.back().key = &patterns;
+  parseAutomaton(patterns, cache.back().automaton);
+  return cache.back().automaton;
+}
+
+// Follow a single byte transition from `state`. Transitions out of the root go through the precomputed table, deeper
+// ones scan the child list and take the child from the scratch node cache, decoding it only on a miss.
+bool transition(const EmbeddedAutomaton& automaton, const AutomatonState& state, uint8_t letter, AutomatonState& out,
+                LiangScratch& scratch) {
+  if (state.addr == automaton.rootOffset) {
+    const uint8_t slot = automaton.rootChildSlot[letter];
+    if (slot == 0) {
+      return false;
     }
-    indexes.push_back(breakIndex);
+    out = automaton.rootChildren[slot - 1];
+    return true;
   }
 
-  return indexes;
+  const size_t addr = childAddress(automaton, state, letter);
+  if (addr == 0) {
+    return false;
+  }
+  CachedNode& cached = scratch.nodeCache[(addr ^ (addr >> 9)) & (LiangScratch::NODE_CACHE_SIZE - 1)];
+  if (cached.addr != addr && !decodeNode(automaton.data, automaton.size, addr, cached)) {
+    cached.addr = 0;
+    return false;
+  }
+  out = expandNode(automaton.data, cached);
+  return true;
+}
+
+// Converts odd score positions back into codepoint indexes, honoring min prefix/suffix constraints.
+// Each break corresponds to scores[breakIndex + 1] because of the leading '.' sentinel.
+size_t collectBreakIndexes(const size_t cpCount, const size_t minPrefix, const size_t minSuffix,
+                           LiangScratch& scratch) {
+  size_t found = 0;
+  for (size_t breakIndex = std::max<size_t>(1, minPrefix); breakIndex < cpCount; ++breakIndex) {
+    if (cpCount - breakIndex < minSuffix) {
+      break;
+    }
+    if ((scratch.scores[breakIndex + 1] & 1u) != 0) {
+      scratch.breaks[found++] = static_cast<uint16_t>(breakIndex);
+    }
+  }
+  return found;
 }
 
 }  // namespace
 
 // Entry point that runs the full Liang pipeline for a single word.
-std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
-                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config) {
-  const auto augmented = buildAugmentedWord(cps, config);
-  if (augmented.empty()) {
-    return {};
+size_t liangBreakIndexes(const CodepointInfo* cps, const size_t count, const SerializedHyphenationPatterns& patterns,
+                         const LiangWordConfig& config, LiangScratch& scratch) {
+  if (count < 2) {
+    return 0;
+  }
+
+  const size_t byteCount = buildAugmentedWord(cps, count, config, scratch);
+  if (byteCount == 0) {
+    return 0;
   }
 
   const EmbeddedAutomaton& automaton = getAutomaton(patterns);
   if (!automaton.valid()) {
-    return {};
+    return 0;
   }
 
-  const AutomatonState root = decodeState(automaton, automaton.rootOffset);
-  if (!root.valid()) {
-    return {};
+  if (scratch.nodeCacheOwner != &patterns) {
+    for (auto& node : scratch.nodeCache) {
+      node.addr = 0;
+    }
+    scratch.nodeCacheOwner = &patterns;
   }
 
   // Liang scores: one entry per augmented char (leading/trailing dots included).
-  std::vector<uint8_t> scores(augmented.charCount(), 0);
+  const size_t charCount = count + 2;
+  std::fill(scratch.scores, scratch.scores + charCount, static_cast<uint8_t>(0));
 
   // Walk every starting character position and stream bytes through the trie.
-  for (size_t charStart = 0; charStart < augmented.charByteOffsets.size(); ++charStart) {
-    const size_t byteStart = augmented.charByteOffsets[charStart];
-    AutomatonState state = root;
+  for (size_t charStart = 0; charStart < charCount; ++charStart) {
+    const size_t byteStart = scratch.charByteOffsets[charStart];
+    AutomatonState state = automaton.root;
 
-    for (size_t cursor = byteStart; cursor < augmented.bytes.size(); ++cursor) {
+    for (size_t cursor = byteStart; cursor < byteCount; ++cursor) {
       AutomatonState next;
-      if (!transition(automaton, state, augmented.bytes[cursor], next)) {
+      if (!transition(automaton, state, scratch.bytes[cursor], next, scratch)) {
         break;  // No more matches for this prefix.
       }
       state = next;
@@ -379,27 +419,31 @@ std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
 
           offset += dist;
           const size_t splitByte = byteStart + offset;
-          if (splitByte >= augmented.byteToCharIndex.size()) {
+          if (splitByte >= byteCount) {
             continue;
           }
 
-          const int32_t boundary = augmented.byteToCharIndex[splitByte];
+          const int32_t boundary = scratch.byteToCharIndex[splitByte];
           if (boundary < 0) {
             continue;  // Mid-codepoint byte, wait for the next one.
           }
-          if (boundary < 2 || boundary + 2 > static_cast<int32_t>(augmented.charCount())) {
+          if (boundary < 2 || boundary + 2 > static_cast<int32_t>(charCount)) {
             continue;  // Skip splits that land in the leading/trailing sentinels.
           }
 
           const size_t idx = static_cast<size_t>(boundary);
-          if (idx >= scores.size()) {
-            continue;
-          }
-          scores[idx] = std::max(scores[idx], level);
+          scratch.scores[idx] = std::max(scratch.scores[idx], level);
         }
       }
     }
   }
 
-  return collectBreakIndexes(cps, scores, config.minPrefix, config.minSuffix);
+  return collectBreakIndexes(count, config.minPrefix, config.minSuffix, scratch);
+}
+
+std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
+                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config,
+                                      LiangScratch& scratch) {
+  const size_t found = liangBreakIndexes(cps.data(), cps.size(), patterns, config, scratch);
+  return std::vector<size_t>(scratch.breaks, scratch.breaks + found);
 }
@@ -33,6 +33,40 @@ struct LiangWordConfig {
       : isLetter(letterFn), toLower(lowerFn), minPrefix(prefix), minSuffix(suffix) {}
 };
 
-// Shared Liang pattern evaluator used by every language-specific hyphenator.
+// Working memory for one liangBreakIndexes call. Every buffer is sized for the longest word the hyphenator accepts, so
+// evaluating a word never touches the heap. Callers keep one instance alive and reuse it for every word.
+struct LiangScratch {
+  // One entry per augmented character: the word plus the leading/trailing '.' sentinels.
+  static constexpr size_t MAX_CHARS = MAX_HYPHENATION_WORD_BYTES + 2;
+  static constexpr size_t MAX_BYTES = MAX_HYPHENATION_WORD_BYTES + 2;
+
+  uint8_t bytes[MAX_BYTES];
+  uint16_t charByteOffsets[MAX_CHARS];
+  int16_t byteToCharIndex[MAX_BYTES];
+  uint8_t scores[MAX_CHARS];
+  // Output: codepoint indexes a break may be inserted before.
+  uint16_t breaks[MAX_CHARS];
+
+  // Trie nodes below the root that were already decoded, direct-mapped by node address so following a transition is
+  // a table lookup instead of a header decode. Filled on demand and only valid for the patterns in nodeCacheOwner;
+  // switching languages clears it.
+  static constexpr size_t NODE_CACHE_SIZE = 512;
+  struct CachedNode {
+    uint32_t addr;        // 0 = empty slot, no node lives in the blob header
+    uint16_t levels;      // Packed levels offset (12 bits) and length (4 bits), as stored in the node header
+    uint8_t layout;       // Header length in the low nibble, target stride in the high nibble
+    uint8_t childCount;
+  };
+  const SerializedHyphenationPatterns* nodeCacheOwner = nullptr;
+  CachedNode nodeCache[NODE_CACHE_SIZE];
+};
+
+// Shared Liang pattern evaluator used by every language-specific hyphenator. Writes the break indexes to
+// scratch.breaks and returns how many were found. Words longer than MAX_HYPHENATION_WORD_BYTES yield no breaks.
+size_t liangBreakIndexes(const CodepointInfo* cps, size_t count, const SerializedHyphenationPatterns& patterns,
+                         const LiangWordConfig& config, LiangScratch& scratch);
+
+// Convenience wrapper returning the breaks as a vector. LiangScratch is several KB, so it is never put on the stack.
 std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
-                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config);
+                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config,
+                                      LiangScratch& scratch);
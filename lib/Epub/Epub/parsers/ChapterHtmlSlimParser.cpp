@@ -1,10 +1,12 @@
 #include "ChapterHtmlSlimParser.h"
 #include <EpdFontFamily.h>
 
+#include <ExpatDriver.h>
 #include <FsHelpers.h>
 #include <GfxRenderer.h>
-#include <HardwareSerial.h>
+#include <HeapStats.h>
 #include <JpegToBmpConverter.h>
+#include <Logging.h>
 #include <SDCardManager.h>
 #include <ZipFile.h>
 #include <expat.h>
@@ -12,40 +14,34 @@
 #include "../../Epub.h"
 #include "../Page.h"
 #include "../blocks/ImageBlock.h"
+#include "HtmlTags.h"
+#include "TextScan.h"
 #include <Arduino.h>
 
-const char *HEADER_TAGS[] = {"h1", "h2", "h3", "h4", "h5", "h6"};
-constexpr int NUM_HEADER_TAGS = sizeof(HEADER_TAGS) / sizeof(HEADER_TAGS[0]);
-
 // Minimum file size (in bytes) to show progress bar - smaller chapters don't
 // benefit from it
 constexpr size_t MIN_SIZE_FOR_PROGRESS = 50 * 1024; // 50KB
 
-const char *BLOCK_TAGS[] = {"p", "li", "div", "br", "blockquote"};
-constexpr int NUM_BLOCK_TAGS = sizeof(BLOCK_TAGS) / sizeof(BLOCK_TAGS[0]);
-
-const char *BOLD_TAGS[] = {"b", "strong"};
-constexpr int NUM_BOLD_TAGS = sizeof(BOLD_TAGS) / sizeof(BOLD_TAGS[0]);
-
-const char *ITALIC_TAGS[] = {"i", "em"};
-constexpr int NUM_ITALIC_TAGS = sizeof(ITALIC_TAGS) / sizeof(ITALIC_TAGS[0]);
-
-const char *IMAGE_TAGS[] = {"img", "image"};
-constexpr int NUM_IMAGE_TAGS = sizeof(IMAGE_TAGS) / sizeof(IMAGE_TAGS[0]);
-
-const char *SKIP_TAGS[] = {"head"};
-constexpr int NUM_SKIP_TAGS = sizeof(SKIP_TAGS) / sizeof(SKIP_TAGS[0]);
-
 bool isWhitespace(const char c) {
   return c == ' ' || c == '\r' || c == '\n' || c == '\t';
 }
 
-// given the start and end of a tag, check to see if it matches a known tag
-bool matches(const char *tag_name, const char *possible_tags[],
-             const int possible_tag_count) {
-  for (int i = 0; i < possible_tag_count; i++) {
-    if (strcmp(tag_name, possible_tags[i]) == 0) {
-      return true;
+// role="doc-pagebreak" and epub:type="pagebreak" mark print page numbers
+bool isPageBreakMarker(const XML_Char **atts) {
+  if (atts == nullptr) {
+    return false;
+  }
+  for (int i = 0; atts[i]; i += 2) {
+    const char *attr = atts[i];
+    // Nearly every attribute is class/id/href, reject on the first byte
+    if (attr[0] == 'r' && strcmp(attr, "role") == 0) {
+      if (strcmp(atts[i + 1], "doc-pagebreak") == 0) {
+        return true;
+      }
+    } else if (attr[0] == 'e' && strcmp(attr, "epub:type") == 0) {
+      if (strcmp(atts[i + 1], "pagebreak") == 0) {
+        return true;
+      }
     }
   }
   return false;
@@ -63,9 +59,10 @@ void ChapterHtmlSlimParser::flushPartWordBuffer() {
     fontStyle = EpdFontFamily::ITALIC;
   }
   // flush the buffer
-  partWordBuffer[partWordBufferIndex] = '\0';
-  currentTextBlock->addWord(partWordBuffer, fontStyle);
+  currentTextBlock->addWord(partWordBuffer, partWordBufferIndex, fontStyle,
+                            partWordHasSoftHyphen);
   partWordBufferIndex = 0;
+  partWordHasSoftHyphen = false;
 }
 
 // start a new text block if needed
@@ -79,14 +76,17 @@ void ChapterHtmlSlimParser::startNewTextBlock(const TextBlock::Style style) {
 
     makePages();
   }
-  currentTextBlock.reset(
-      new ParsedText(style, extraParagraphSpacing, hyphenationEnabled));
+  currentTextBlock.reset(new ParsedText(style, extraParagraphSpacing,
+                                        hyphenationEnabled,
+                                        hyphenationScratch.get(),
+                                        hyphenationMemo));
 }
 
 void XMLCALL ChapterHtmlSlimParser::startElement(void *userData,
                                                  const XML_Char *name,
                                                  const XML_Char **atts) {
   auto *self = static_cast<ChapterHtmlSlimParser *>(userData);
+  const HtmlTags::TagInfo tag = HtmlTags::classify(name);
 
   // Verbose logging for all tags
   // Serial.printf("[%lu] [EHP] Tag: <%s> (depth: %d, skipUntil: %d)\n",
@@ -100,7 +100,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void *userData,
 
   // Special handling for tables - show placeholder text instead of dropping
   // silently
-  if (strcmp(name, "table") == 0) {
+  if (tag.is(HtmlTags::TABLE)) {
     // Add placeholder text
     self->startNewTextBlock(TextBlock::CENTER_ALIGN);
 
@@ -115,7 +115,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void *userData,
     return;
   }
 
-  if (matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS)) {
+  if (tag.is(HtmlTags::IMAGE)) {
     std::string src;
     std::string alt = "[Image]";
     if (atts != nullptr) {
@@ -135,8 +135,9 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void *userData,
       return;
     }
 
-    // Check if image loading is enabled
-    if (self->epub && !self->epub->isImageLoadingEnabled()) {
+    // Check if image loading is enabled, without a book there is nothing to
+    // extract the image from
+    if (!self->epub || !self->epub->isImageLoadingEnabled()) {
       // Fallback to alt text immediately
       self->startNewTextBlock(TextBlock::CENTER_ALIGN);
       self->italicUntilDepth = std::min(self->italicUntilDepth, self->depth);
@@ -167,16 +168,14 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void *userData,
       SdMan.mkdir(dir.c_str());
     }
 
-    Serial.printf("[%lu] [EHP] Processing image: %s -> %s (Heap: %u)\n",
-                  millis(), src.c_str(), normalizedSrc.c_str(),
-                  ESP.getFreeHeap());
+    LOG_DBG("EHP", "Processing image: %s -> %s (Heap: %u)\n", src.c_str(),
+            normalizedSrc.c_str(), ESP.getFreeHeap());
 
     // Check extension
     std::string ext = normalizedSrc.substr(normalizedSrc.find_last_of('.') + 1);
     std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
     if (ext != "jpg" && ext != "jpeg" && ext != "jpe") {
-      Serial.printf("[%lu] [EHP] WARNING: Unsupported image format: .%s\n",
-                    millis(), ext.c_str());
+      LOG_WRN("EHP", "WARNING: Unsupported image format: .%s\n", ext.c_str());
     }
 
     bool imageReady = SdMan.exists(bmpCachePath.c_str());
@@ -191,38 +190,37 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void *userData,
           if (self->epub->readItemContentsToStream(normalizedSrc, tmpJpg,
                                                    1024)) {
             tmpJpg.close();
+            heapstats::mark("image", "extracted");
             if (SdMan.openFileForRead("EHP", tmpJpgPath, tmpJpg)) {
               imageReady = JpegToBmpConverter::jpegFileToBmpStreamWithSize(
                   tmpJpg, bmpFile, self->viewportWidth, self->viewportHeight);
               if (!imageReady) {
-                Serial.printf("[%lu] [EHP] JPEG conversion failed for %s\n",
-                              millis(), normalizedSrc.c_str());
+                LOG_ERR("EHP", "JPEG conversion failed for %s\n",
+                        normalizedSrc.c_str());
               }
             } else {
-              Serial.printf("[%lu] [EHP] Failed to reopen tmp JPG for read\n",
-                            millis());
+              LOG_ERR("EHP", "Failed to reopen tmp JPG for read\n");
             }
           } else {
-            Serial.printf("[%lu] [EHP] Failed to extract %s from EPUB\n",
-                          millis(), normalizedSrc.c_str());
+            LOG_ERR("EHP", "Failed to extract %s from EPUB\n",
+                    normalizedSrc.c_str());
           }
           tmpJpg.close();
           SdMan.remove(tmpJpgPath.c_str());
         } else {
-          Serial.printf("[%lu] [EHP] Failed to open tmp JPG for write\n",
-                        millis());
+          LOG_ERR("EHP", "Failed to open tmp JPG for write\n");
         }
         bmpFile.close();
       } else {
-        Serial.printf("[%lu] [EHP] Failed to open BMP cache for write: %s\n",
-                      millis(), bmpCachePath.c_str());
+        LOG_ERR("EHP", "Failed to open BMP cache for write: %s\n",
+                bmpCachePath.c_str());
       }
       if (!imageReady) {
         SdMan.remove(bmpCachePath.c_str());
       }
+      heapstats::mark("image", "converted");
     } else {
-      Serial.printf("[%lu] [EHP] Using cached image: %s\n", millis(),
-                    bmpCachePath.c_str());
+      LOG_DBG("EHP", "Using cached image: %s\n", bmpCachePath.c_str());
     }
 
     if (imageReady) {
@@ -252,7 +250,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void *userData,
     return;
   }
 
-  if (matches(name, SKIP_TAGS, NUM_SKIP_TAGS)) {
+  if (tag.is(HtmlTags::SKIP)) {
     // start skip
     self->skipUntilDepth = self->depth;
     self->depth += 1;
@@ -260,28 +258,21 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void *userData,
   }
 
   // Skip blocks with role="doc-pagebreak" and epub:type="pagebreak"
-  if (atts != nullptr) {
-    for (int i = 0; atts[i]; i += 2) {
-      if ((strcmp(atts[i], "role") == 0 &&
-           strcmp(atts[i + 1], "doc-pagebreak") == 0) ||
-          (strcmp(atts[i], "epub:type") == 0 &&
-           strcmp(atts[i + 1], "pagebreak") == 0)) {
-        self->skipUntilDepth = self->depth;
-        self->depth += 1;
-        return;
-      }
-    }
+  if (isPageBreakMarker(atts)) {
+    self->skipUntilDepth = self->depth;
+    self->depth += 1;
+    return;
   }
 
-  if (matches(name, HEADER_TAGS, NUM_HEADER_TAGS)) {
+  if (tag.is(HtmlTags::HEADER)) {
     self->startNewTextBlock(TextBlock::CENTER_ALIGN);
     self->boldUntilDepth = std::min(self->boldUntilDepth, self->depth);
     self->depth += 1;
     return;
   }
 
-  if (matches(name, BLOCK_TAGS, NUM_BLOCK_TAGS)) {
-    if (strcmp(name, "br") == 0) {
+  if (tag.is(HtmlTags::BLOCK)) {
+    if (tag.tag == HtmlTags::Tag::Br) {
       if (self->partWordBufferIndex > 0) {
         // flush word preceding <br/> to currentTextBlock before calling
         // startNewTextBlock
@@ -294,7 +285,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void *userData,
 
     self->startNewTextBlock(
         static_cast<TextBlock::Style>(self->paragraphAlignment));
-    if (strcmp(name, "li") == 0) {
+    if (tag.tag == HtmlTags::Tag::Li) {
       self->currentTextBlock->addWord("\xe2\x80\xa2", EpdFontFamily::REGULAR);
     }
 
@@ -302,13 +293,13 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void *userData,
     return;
   }
 
-  if (matches(name, BOLD_TAGS, NUM_BOLD_TAGS)) {
+  if (tag.is(HtmlTags::BOLD)) {
     self->boldUntilDepth = std::min(self->boldUntilDepth, self->depth);
     self->depth += 1;
     return;
   }
 
-  if (matches(name, ITALIC_TAGS, NUM_ITALIC_TAGS)) {
+  if (tag.is(HtmlTags::ITALIC)) {
     self->italicUntilDepth = std::min(self->italicUntilDepth, self->depth);
     self->depth += 1;
     return;
@@ -328,49 +319,76 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void *userData,
     return;
   }
 
-  for (int i = 0; i < len; i++) {
+  // Work on a local write position, every store into the word buffer would
+  // otherwise force the member to be reloaded
+  char *const buffer = self->partWordBuffer;
+  int index = self->partWordBufferIndex;
+  const auto flush = [self, &index]() {
+    self->partWordBufferIndex = index;
+    self->flushPartWordBuffer();
+    index = 0;
+  };
+  // Appends bytes, cutting the word off whenever the buffer fills up
+  const auto append = [&](const char *data, int length) {
+    while (length > 0) {
+      if (index >= MAX_WORD_SIZE) {
+        flush();
+      }
+      int chunk = std::min(length, MAX_WORD_SIZE - index);
+      length -= chunk;
+      while (chunk-- > 0) {
+        buffer[index++] = *data++;
+      }
+    }
+  };
+
+  int i = 0;
+  while (i < len) {
+    // Copy the run of ordinary bytes up to the next whitespace, BOM or soft
+    // hyphen candidate in one go
+    const int runEnd = TextScan::findSpecialByte(s, i, len);
+    append(s + i, runEnd - i);
+    if (runEnd == len) {
+      break;
+    }
+    i = runEnd;
+
+    const auto c = static_cast<uint8_t>(s[i]);
     if (isWhitespace(s[i])) {
       // Currently looking at whitespace, if there's anything in the
       // partWordBuffer, flush it
-      if (self->partWordBufferIndex > 0) {
-        self->flushPartWordBuffer();
+      if (index > 0) {
+        flush();
       }
       // Skip the whitespace char
+      i++;
       continue;
     }
 
     // Skip Zero Width No-Break Space / BOM (U+FEFF) = 0xEF 0xBB 0xBF
-    const XML_Char FEFF_BYTE_1 = static_cast<XML_Char>(0xEF);
-    const XML_Char FEFF_BYTE_2 = static_cast<XML_Char>(0xBB);
-    const XML_Char FEFF_BYTE_3 = static_cast<XML_Char>(0xBF);
-
-    if (s[i] == FEFF_BYTE_1) {
-      // Check if the next two bytes complete the 3-byte sequence
-      if ((i + 2 < len) && (s[i + 1] == FEFF_BYTE_2) &&
-          (s[i + 2] == FEFF_BYTE_3)) {
-        // Sequence 0xEF 0xBB 0xBF found!
-        i += 2;   // Skip the next two bytes
-        continue; // Move to the next iteration
-      }
+    if (c == 0xEF && i + 2 < len && static_cast<uint8_t>(s[i + 1]) == 0xBB &&
+        static_cast<uint8_t>(s[i + 2]) == 0xBF) {
+      i += 3;
+      continue;
     }
 
-    // If we're about to run out of space, then cut the word off and start a new
-    // one
-    if (self->partWordBufferIndex >= MAX_WORD_SIZE) {
-      self->flushPartWordBuffer();
+    append(s + i, 1);
+    // Soft hyphen (U+00AD) = 0xC2 0xAD, the lead byte may have arrived with
+    // the previous chunk of character data
+    if (c == 0xAD && index >= 2 &&
+        static_cast<uint8_t>(buffer[index - 2]) == 0xC2) {
+      self->partWordHasSoftHyphen = true;
     }
-
-    self->partWordBuffer[self->partWordBufferIndex++] = s[i];
+    i++;
   }
+  self->partWordBufferIndex = index;
 
   // If we have > 750 words buffered up, perform the layout and consume out all
   // but the last line There should be enough here to build out 1-2 full pages
   // and doing this will free up a lot of memory. Spotted when reading
   // Intermezzo, there are some really long text blocks in there.
   if (self->currentTextBlock->size() > 750) {
-    Serial.printf(
-        "[%lu] [EHP] Text block too long, splitting into multiple pages\n",
-        millis());
+    LOG_INF("EHP", "Text block too long, splitting into multiple pages\n");
     self->currentTextBlock->layoutAndExtractLines(
         self->renderer, self->fontId, self->viewportWidth,
         [self](const std::shared_ptr<TextBlock> &textBlock) {
@@ -390,13 +408,8 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void *userData,
     // inline tags like <span>. Currently this also flushes out on closing <b>
     // and <i> tags, but they are line tags so that shouldn't happen, text
     // styling needs to be overhauled to fix it.
-    const bool shouldBreakText = matches(name, BLOCK_TAGS, NUM_BLOCK_TAGS) ||
-                                 matches(name, HEADER_TAGS, NUM_HEADER_TAGS) ||
-                                 matches(name, BOLD_TAGS, NUM_BOLD_TAGS) ||
-                                 matches(name, ITALIC_TAGS, NUM_ITALIC_TAGS) ||
-                                 strcmp(name, "table") == 0 ||
-                                 matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS) ||
-                                 self->depth == 1;
+    const bool shouldBreakText =
+        HtmlTags::classify(name).is(HtmlTags::BREAKS_TEXT) || self->depth == 1;
 
     if (shouldBreakText) {
       self->flushPartWordBuffer();
@@ -422,90 +435,43 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void *userData,
 }
 
 bool ChapterHtmlSlimParser::parseAndBuildPages() {
+  // Overflowing words are split even with hyphenation disabled, so the
+  // scratch is always needed
+  hyphenationScratch.reset(new Hyphenator::Scratch());
   startNewTextBlock((TextBlock::Style)this->paragraphAlignment);
 
-  const XML_Parser parser = XML_ParserCreate(nullptr);
-  int done;
-
-  if (!parser) {
-    Serial.printf("[%lu] [EHP] Couldn't allocate memory for parser\n",
-                  millis());
+  FsFile file;
+  if (!SdMan.openFileForRead("EHP", filepath, file)) {
     return false;
   }
 
-  FsFile file;
-  if (!SdMan.openFileForRead("EHP", filepath, file)) {
-    XML_ParserFree(parser);
+  ExpatDriver localDriver;
+  ExpatDriver &xml = xmlDriver ? *xmlDriver : localDriver;
+  if (!xml.begin("EHP", this, startElement, endElement, characterData)) {
+    file.close();
     return false;
   }
 
-  // Get file size for progress calculation
-  const size_t totalSize = file.size();
-  size_t bytesRead = 0;
+  // Update progress (call every 10% change to avoid too frequent updates)
+  // Only show progress for larger chapters where rendering overhead is worth it
   int lastProgress = -1;
-
-  XML_SetUserData(parser, this);
-  XML_SetElementHandler(parser, startElement, endElement);
-  XML_SetCharacterDataHandler(parser, characterData);
-
-  do {
-    void *const buf = XML_GetBuffer(parser, 1024);
-    if (!buf) {
-      Serial.printf("[%lu] [EHP] Couldn't allocate memory for buffer\n",
-                    millis());
-      XML_StopParser(parser, XML_FALSE); // Stop any pending processing
-      XML_SetElementHandler(parser, nullptr, nullptr); // Clear callbacks
-      XML_SetCharacterDataHandler(parser, nullptr);
-      XML_ParserFree(parser);
-      file.close();
-      return false;
-    }
-
-    const size_t len = file.read(buf, 1024);
-
-    if (len == 0 && file.available() > 0) {
-      Serial.printf("[%lu] [EHP] File read error\n", millis());
-      XML_StopParser(parser, XML_FALSE); // Stop any pending processing
-      XML_SetElementHandler(parser, nullptr, nullptr); // Clear callbacks
-      XML_SetCharacterDataHandler(parser, nullptr);
-      XML_ParserFree(parser);
-      file.close();
-      return false;
-    }
-
-    // Update progress (call every 10% change to avoid too frequent updates)
-    // Only show progress for larger chapters where rendering overhead is worth
-    // it
-    bytesRead += len;
-    if (progressFn && totalSize >= MIN_SIZE_FOR_PROGRESS) {
-      const int progress = static_cast<int>((bytesRead * 100) / totalSize);
-      if (lastProgress / 10 != progress / 10) {
-        lastProgress = progress;
-        progressFn(progress);
-      }
-    }
-
-    done = file.available() == 0;
-
-    if (XML_ParseBuffer(parser, static_cast<int>(len), done) ==
-        XML_STATUS_ERROR) {
-      Serial.printf("[%lu] [EHP] Parse error at line %lu:\n%s\n", millis(),
-                    XML_GetCurrentLineNumber(parser),
-                    XML_ErrorString(XML_GetErrorCode(parser)));
-      XML_StopParser(parser, XML_FALSE); // Stop any pending processing
-      XML_SetElementHandler(parser, nullptr, nullptr); // Clear callbacks
-      XML_SetCharacterDataHandler(parser, nullptr);
-      XML_ParserFree(parser);
-      file.close();
-      return false;
-    }
-  } while (!done);
-
-  XML_StopParser(parser, XML_FALSE); // Stop any pending processing
-  XML_SetElementHandler(parser, nullptr, nullptr); // Clear callbacks
-  XML_SetCharacterDataHandler(parser, nullptr);
-  XML_ParserFree(parser);
+  const bool parsed = xml.parseFile(
+      file, [this, &lastProgress](const size_t bytesRead,
+                                  const size_t totalSize) {
+        if (!progressFn || totalSize < MIN_SIZE_FOR_PROGRESS) {
+          return;
+        }
+        const int progress = static_cast<int>((bytesRead * 100) / totalSize);
+        if (lastProgress / 10 != progress / 10) {
+          lastProgress = progress;
+          progressFn(progress);
+        }
+      });
+  xml.end();
   file.close();
+  if (!parsed) {
+    return false;
+  }
 
   // Process last page if there is still text
   if (currentTextBlock) {
@@ -549,8 +515,7 @@ void ChapterHtmlSlimParser::addImageToPage(std::shared_ptr<ImageBlock> image) {
 
 void ChapterHtmlSlimParser::makePages() {
   if (!currentTextBlock) {
-    Serial.printf("[%lu] [EHP] !! No text block to make pages for !!\n",
-                  millis());
+    LOG_INF("EHP", "!! No text block to make pages for !!\n");
     return;
   }
 
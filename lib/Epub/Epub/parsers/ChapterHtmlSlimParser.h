@@ -12,9 +12,13 @@
 class Page;
 class GfxRenderer;
 class Epub;
+class ExpatDriver;
 class ImageBlock;
 
 #define MAX_WORD_SIZE 200
+// Words reach the hyphenator with the paragraph indent (3 bytes) prepended
+static_assert(MAX_WORD_SIZE + 3 <= MAX_HYPHENATION_WORD_BYTES,
+              "hyphenation scratch buffers must fit the longest word");
 
 class ChapterHtmlSlimParser {
   const std::string &filepath;
@@ -31,7 +35,10 @@ class ChapterHtmlSlimParser {
   // than this leave one char at end for null pointer
   char partWordBuffer[MAX_WORD_SIZE + 1] = {};
   int partWordBufferIndex = 0;
+  bool partWordHasSoftHyphen = false;
   std::unique_ptr<ParsedText> currentTextBlock = nullptr;
+  // Reused by every text block of the chapter so hyphenation never allocates
+  std::unique_ptr<Hyphenator::Scratch> hyphenationScratch = nullptr;
   std::unique_ptr<Page> currentPage = nullptr;
   int16_t currentPageNextY = 0;
   int fontId;
@@ -41,6 +48,10 @@ class ChapterHtmlSlimParser {
   uint16_t viewportWidth;
   uint16_t viewportHeight;
   bool hyphenationEnabled;
+  // Shared across the whole section build, may be null
+  HyphenationMemo *hyphenationMemo;
+  // Reused across the sections of a batch build, a local one is used if null
+  ExpatDriver *xmlDriver;
 
   void startNewTextBlock(TextBlock::Style style);
   void flushPartWordBuffer();
@@ -60,13 +71,17 @@ public:
       const uint8_t paragraphAlignment, const uint16_t viewportWidth,
       const uint16_t viewportHeight, const bool hyphenationEnabled,
       const std::function<void(std::unique_ptr<Page>)> &completePageFn,
-      const std::function<void(int)> &progressFn = nullptr)
+      const std::function<void(int)> &progressFn = nullptr,
+      HyphenationMemo *hyphenationMemo = nullptr,
+      ExpatDriver *xmlDriver = nullptr)
       : filepath(filepath), originalPath(originalPath), epub(epub),
-        renderer(renderer), fontId(fontId), lineCompression(lineCompression),
+        renderer(renderer), completePageFn(completePageFn),
+        progressFn(progressFn), fontId(fontId),
+        lineCompression(lineCompression),
         extraParagraphSpacing(extraParagraphSpacing),
         paragraphAlignment(paragraphAlignment), viewportWidth(viewportWidth),
         viewportHeight(viewportHeight), hyphenationEnabled(hyphenationEnabled),
-        completePageFn(completePageFn), progressFn(progressFn) {}
+        hyphenationMemo(hyphenationMemo), xmlDriver(xmlDriver) {}
   ~ChapterHtmlSlimParser() = default;
   bool parseAndBuildPages();
   void addLineToPage(std::shared_ptr<TextBlock> line);
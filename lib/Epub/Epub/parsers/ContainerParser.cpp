@@ -2,53 +2,32 @@
 
 #include <HardwareSerial.h>
 
-bool ContainerParser::setup() {
-  parser = XML_ParserCreate(nullptr);
-  if (!parser) {
-    Serial.printf("[%lu] [CTR] Couldn't allocate memory for parser\n", millis());
+bool ContainerParser::setup(ExpatDriver& driver) {
+  if (!driver.begin("CTR", this, startElement, endElement)) {
     return false;
   }
-
-  XML_SetUserData(parser, this);
-  XML_SetElementHandler(parser, startElement, endElement);
+  xml = &driver;
   return true;
 }
 
 ContainerParser::~ContainerParser() {
-  if (parser) {
-    XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
-    XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
-    XML_ParserFree(parser);
-    parser = nullptr;
+  if (xml) {
+    xml->end();
+    xml = nullptr;
   }
 }
 
 size_t ContainerParser::write(const uint8_t data) { return write(&data, 1); }
 
 size_t ContainerParser::write(const uint8_t* buffer, const size_t size) {
-  if (!parser) return 0;
-
-  const uint8_t* currentBufferPos = buffer;
-  auto remainingInBuffer = size;
-
-  while (remainingInBuffer > 0) {
-    void* const buf = XML_GetBuffer(parser, 1024);
-    if (!buf) {
-      Serial.printf("[%lu] [CTR] Couldn't allocate buffer\n", millis());
-      return 0;
-    }
-
-    const auto toRead = remainingInBuffer < 1024 ? remainingInBuffer : 1024;
-    memcpy(buf, currentBufferPos, toRead);
-
-    if (XML_ParseBuffer(parser, static_cast<int>(toRead), remainingSize == toRead) == XML_STATUS_ERROR) {
-      Serial.printf("[%lu] [CTR] Parse error: %s\n", millis(), XML_ErrorString(XML_GetErrorCode(parser)));
-      return 0;
-    }
-
-    currentBufferPos += toRead;
-    remainingInBuffer -= toRead;
-    remainingSize -= toRead;
+  if (!xml) return 0;
+
+  const bool isFinal = size >= remainingSize;
+  remainingSize = isFinal ? 0 : remainingSize - size;
+  if (!xml->feed(buffer, size, isFinal)) {
+    xml->end();
+    xml = nullptr;
+    return 0;
   }
   return size;
 }
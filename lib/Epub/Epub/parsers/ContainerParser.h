@@ -1,9 +1,9 @@
 #pragma once
+#include <ExpatDriver.h>
 #include <Print.h>
 
 #include <string>
 
-#include "expat.h"
 
 class ContainerParser final : public Print {
   enum ParserState {
@@ -13,7 +13,7 @@ class ContainerParser final : public Print {
   };
 
   size_t remainingSize;
-  XML_Parser parser = nullptr;
+  ExpatDriver* xml = nullptr;
   ParserState state = START;
 
   static void startElement(void* userData, const XML_Char* name, const XML_Char** atts);
@@ -25,7 +25,7 @@ class ContainerParser final : public Print {
   explicit ContainerParser(const size_t xmlSize) : remainingSize(xmlSize) {}
   ~ContainerParser() override;
 
-  bool setup();
+  bool setup(ExpatDriver& driver);
 
   size_t write(uint8_t) override;
   size_t write(const uint8_t* buffer, size_t size) override;
@@ -1,11 +1,11 @@
 #pragma once
+#include <ExpatDriver.h>
 #include <Print.h>
 
 #include <algorithm>
 #include <vector>
 
 #include "Epub.h"
-#include "expat.h"
 
 class BookMetadataCache;
 
@@ -25,7 +25,7 @@ class ContentOpfParser final : public Print {
   const std::string& cachePath;
   const std::string& baseContentPath;
   size_t remainingSize;
-  XML_Parser parser = nullptr;
+  ExpatDriver* xml = nullptr;
   ParserState state = START;
   BookMetadataCache* cache;
   FsFile tempItemStore;
@@ -70,7 +70,7 @@ class ContentOpfParser final : public Print {
       : cachePath(cachePath), baseContentPath(baseContentPath), remainingSize(xmlSize), cache(cache) {}
   ~ContentOpfParser() override;
 
-  bool setup();
+  bool setup(ExpatDriver& driver);
 
   size_t write(uint8_t) override;
   size_t write(const uint8_t* buffer, size_t size) override;
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Tag interning for the chapter parser. Every element is classified once by a switch on length and first character
+// (one string compare at most) instead of scanning the tag tables with strcmp for each kind of behavior.
+namespace HtmlTags {
+
+enum class Tag : uint8_t {
+  Other,
+  H1,
+  H2,
+  H3,
+  H4,
+  H5,
+  H6,
+  P,
+  Li,
+  Div,
+  Br,
+  Blockquote,
+  B,
+  Strong,
+  I,
+  Em,
+  Img,
+  Image,
+  Head,
+  Table,
+};
+
+// Behavior flags, several may apply to one tag
+constexpr uint8_t HEADER = 1 << 0;
+constexpr uint8_t BLOCK = 1 << 1;
+constexpr uint8_t BOLD = 1 << 2;
+constexpr uint8_t ITALIC = 1 << 3;
+constexpr uint8_t IMAGE = 1 << 4;
+constexpr uint8_t SKIP = 1 << 5;
+constexpr uint8_t TABLE = 1 << 6;
+// Closing the tag ends the word being built (inline tags like <span> do not)
+constexpr uint8_t BREAKS_TEXT = 1 << 7;
+
+struct TagInfo {
+  Tag tag;
+  uint8_t flags;
+
+  constexpr bool is(const uint8_t flag) const { return (flags & flag) != 0; }
+};
+
+namespace detail {
+constexpr bool equals(const char* a, const char* b, const size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    if (a[i] != b[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+constexpr TagInfo tagIf(const char* name, const char* expected, const size_t length, const Tag tag,
+                        const uint8_t flags) {
+  return equals(name, expected, length) ? TagInfo{tag, flags} : TagInfo{Tag::Other, 0};
+}
+}  // namespace detail
+
+// Tag names are matched case-sensitively, XHTML requires lowercase
+constexpr TagInfo classify(const char* name) {
+  size_t length = 0;
+  while (name[length] != '\0') {
+    if (++length > 10) {
+      return {Tag::Other, 0};  // Longer than any known tag
+    }
+  }
+
+  switch (length) {
+    case 1:
+      switch (name[0]) {
+        case 'p':
+          return {Tag::P, BLOCK | BREAKS_TEXT};
+        case 'b':
+          return {Tag::B, BOLD | BREAKS_TEXT};
+        case 'i':
+          return {Tag::I, ITALIC | BREAKS_TEXT};
+        default:
+          return {Tag::Other, 0};
+      }
+    case 2:
+      if (name[0] == 'h' && name[1] >= '1' && name[1] <= '6') {
+        return {static_cast<Tag>(static_cast<uint8_t>(Tag::H1) + (name[1] - '1')), HEADER | BREAKS_TEXT};
+      }
+      switch (name[0]) {
+        case 'l':
+          return detail::tagIf(name, "li", 2, Tag::Li, BLOCK | BREAKS_TEXT);
+        case 'b':
+          return detail::tagIf(name, "br", 2, Tag::Br, BLOCK | BREAKS_TEXT);
+        case 'e':
+          return detail::tagIf(name, "em", 2, Tag::Em, ITALIC | BREAKS_TEXT);
+        default:
+          return {Tag::Other, 0};
+      }
+    case 3:
+      switch (name[0]) {
+        case 'd':
+          return detail::tagIf(name, "div", 3, Tag::Div, BLOCK | BREAKS_TEXT);
+        case 'i':
+          return detail::tagIf(name, "img", 3, Tag::Img, IMAGE | BREAKS_TEXT);
+        default:
+          return {Tag::Other, 0};
+      }
+    case 4:
+      return detail::tagIf(name, "head", 4, Tag::Head, SKIP);
+    case 5:
+      switch (name[0]) {
+        case 'i':
+          return detail::tagIf(name, "image", 5, Tag::Image, IMAGE | BREAKS_TEXT);
+        case 't':
+          return detail::tagIf(name, "table", 5, Tag::Table, TABLE | BREAKS_TEXT);
+        default:
+          return {Tag::Other, 0};
+      }
+    case 6:
+      return detail::tagIf(name, "strong", 6, Tag::Strong, BOLD | BREAKS_TEXT);
+    case 10:
+      return detail::tagIf(name, "blockquote", 10, Tag::Blockquote, BLOCK | BREAKS_TEXT);
+    default:
+      return {Tag::Other, 0};
+  }
+}
+
+static_assert(classify("h3").tag == Tag::H3 && classify("h3").is(HEADER));
+static_assert(classify("h7").tag == Tag::Other && classify("h").tag == Tag::Other);
+static_assert(classify("blockquote").is(BLOCK) && classify("blockquotes").tag == Tag::Other);
+static_assert(classify("strong").is(BOLD) && classify("em").is(ITALIC) && classify("image").is(IMAGE));
+static_assert(classify("span").flags == 0 && classify("P").tag == Tag::Other);
+static_assert(!classify("head").is(BREAKS_TEXT) && classify("table").is(BREAKS_TEXT));
+
+}  // namespace HtmlTags
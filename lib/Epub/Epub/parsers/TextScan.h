@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+// Word-at-a-time scanning of chapter character data. Text is mostly long runs of bytes that need no attention, so the
+// parser looks for the next byte that does four bytes at a time and copies everything before it in one go.
+namespace TextScan {
+
+// Bytes the chapter parser has to look at: anything up to space (covers all whitespace), the BOM lead byte (0xEF) and
+// the second byte of a soft hyphen (0xC2 0xAD)
+inline bool isSpecialByte(const uint8_t c) { return c <= 0x20 || c == 0xEF || c == 0xAD; }
+
+// Whether any of the four bytes of v is special. May report false positives for control characters, never false
+// negatives.
+inline bool hasSpecialByte(const uint32_t v) {
+  constexpr uint32_t ONES = 0x01010101;
+  constexpr uint32_t HIGHS = 0x80808080;
+  const uint32_t lessThanSpace = (v - ONES * 0x21) & ~v & HIGHS;
+  const uint32_t bom = v ^ (ONES * 0xEF);
+  const uint32_t softHyphen = v ^ (ONES * 0xAD);
+  return (lessThanSpace | ((bom - ONES) & ~bom & HIGHS) | ((softHyphen - ONES) & ~softHyphen & HIGHS)) != 0;
+}
+
+// Index of the first special byte in s[from, len), or len
+inline int findSpecialByte(const char* s, int from, const int len) {
+  while (from + 4 <= len) {
+    uint32_t v;
+    memcpy(&v, s + from, sizeof(v));
+    if (hasSpecialByte(v)) {
+      break;
+    }
+    from += 4;
+  }
+  while (from < len && !isSpecialByte(static_cast<uint8_t>(s[from]))) {
+    from++;
+  }
+  return from;
+}
+
+}  // namespace TextScan
@@ -1,6 +1,6 @@
 #pragma once
+#include <ExpatDriver.h>
 #include <Print.h>
-#include <expat.h>
 
 #include <string>
 
@@ -11,7 +11,7 @@ class TocNcxParser final : public Print {
 
   const std::string& baseContentPath;
   size_t remainingSize;
-  XML_Parser parser = nullptr;
+  ExpatDriver* xml = nullptr;
   ParserState state = START;
   BookMetadataCache* cache;
 
@@ -28,7 +28,7 @@ class TocNcxParser final : public Print {
       : baseContentPath(baseContentPath), remainingSize(xmlSize), cache(cache) {}
   ~TocNcxParser() override;
 
-  bool setup();
+  bool setup(ExpatDriver& driver);
 
   size_t write(uint8_t) override;
   size_t write(const uint8_t* buffer, size_t size) override;
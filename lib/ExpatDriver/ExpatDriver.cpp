@@ -0,0 +1,161 @@
+#include "ExpatDriver.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+#include <Trace.h>
+
+namespace {
+// Read sizes to try, largest first. 4KB is 8 SD sectors, the smallest cluster FAT32 cards are formatted with.
+constexpr size_t CHUNK_SIZES[] = {4096, 2048, 1024};
+constexpr size_t MIN_CHUNK_SIZE = 512;
+// XML_CONTEXT_BYTES from platformio.ini, expat keeps this much of the previous chunk in its buffer
+constexpr size_t CONTEXT_BYTES = 1024;
+// Left untouched for the rest of the firmware (display, rendering, WiFi) while a document is parsed
+constexpr size_t HEAP_RESERVE = 16 * 1024;
+}  // namespace
+
+ExpatDriver::~ExpatDriver() { release(); }
+
+size_t ExpatDriver::chooseChunkSize() {
+  // Growing its buffer, expat briefly holds the old and the new one
+  const size_t largestFreeBlock = ESP.getMaxAllocHeap();
+  for (const size_t size : CHUNK_SIZES) {
+    if (largestFreeBlock >= 2 * (size + CONTEXT_BYTES) + HEAP_RESERVE) {
+      return size;
+    }
+  }
+  return MIN_CHUNK_SIZE;
+}
+
+bool ExpatDriver::begin(const char* logTag, void* userData, const XML_StartElementHandler startElement,
+                        const XML_EndElementHandler endElement, const XML_CharacterDataHandler characterData) {
+  this->logTag = logTag;
+  if (!parser) {
+    parser = XML_ParserCreate(nullptr);
+    if (!parser) {
+      LOG_AT_TAG(LOG_LEVEL_ERROR, logTag, "Couldn't allocate memory for parser\n");
+      return false;
+    }
+  } else if (needsReset && !XML_ParserReset(parser, nullptr)) {
+    LOG_AT_TAG(LOG_LEVEL_ERROR, logTag, "Couldn't reset parser\n");
+    release();
+    return false;
+  }
+
+  needsReset = true;
+  failed = false;
+  bytesParsed = 0;
+  elapsedMs = 0;
+  startMs = millis();
+
+  XML_SetUserData(parser, userData);
+  XML_SetElementHandler(parser, startElement, endElement);
+  XML_SetCharacterDataHandler(parser, characterData);
+  return true;
+}
+
+bool ExpatDriver::parseBuffer(const int length, const bool isFinal) {
+  if (XML_ParseBuffer(parser, length, isFinal) == XML_STATUS_ERROR) {
+    LOG_AT_TAG(LOG_LEVEL_ERROR, logTag, "Parse error at line %lu: %s\n", XML_GetCurrentLineNumber(parser),
+               XML_ErrorString(XML_GetErrorCode(parser)));
+    fail();
+    return false;
+  }
+  bytesParsed += length;
+  return true;
+}
+
+bool ExpatDriver::feed(const void* data, const size_t length, const bool isFinal) {
+  if (!parser || failed) {
+    return false;
+  }
+
+  // Data arrives in the caller's chunks already, expat copies only what it cannot tokenize yet
+  if (XML_Parse(parser, static_cast<const char*>(data), static_cast<int>(length), isFinal) == XML_STATUS_ERROR) {
+    LOG_AT_TAG(LOG_LEVEL_ERROR, logTag, "Parse error at line %lu: %s\n", XML_GetCurrentLineNumber(parser),
+               XML_ErrorString(XML_GetErrorCode(parser)));
+    fail();
+    return false;
+  }
+  bytesParsed += length;
+  return true;
+}
+
+bool ExpatDriver::finish() { return feed(nullptr, 0, true); }
+
+bool ExpatDriver::parseFile(FsFile& file, const std::function<void(size_t, size_t)>& onProgress) {
+  if (!parser || failed) {
+    return false;
+  }
+
+  TRACE_SCOPE("xml.parseFile");
+  const size_t totalSize = file.size();
+  const size_t chunkSize = chooseChunkSize();
+  size_t bytesRead = 0;
+  while (true) {
+    void* const buf = XML_GetBuffer(parser, static_cast<int>(chunkSize));
+    if (!buf) {
+      LOG_AT_TAG(LOG_LEVEL_ERROR, logTag, "Couldn't allocate memory for buffer\n");
+      fail();
+      return false;
+    }
+
+    const int len = file.read(buf, chunkSize);
+    if (len < 0 || (len == 0 && file.available() > 0)) {
+      LOG_AT_TAG(LOG_LEVEL_ERROR, logTag, "File read error\n");
+      fail();
+      return false;
+    }
+    bytesRead += len;
+
+    const bool done = file.available() == 0;
+    if (!parseBuffer(len, done)) {
+      return false;
+    }
+    if (onProgress) {
+      onProgress(bytesRead, totalSize);
+    }
+    if (done) {
+      return true;
+    }
+  }
+}
+
+void ExpatDriver::fail() {
+  failed = true;
+  XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
+  XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
+  XML_SetCharacterDataHandler(parser, nullptr);
+}
+
+void ExpatDriver::end() {
+  if (!parser) {
+    return;
+  }
+
+  XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
+  XML_SetCharacterDataHandler(parser, nullptr);
+  XML_SetUserData(parser, nullptr);
+
+  elapsedMs = millis() - startMs;
+  if (bytesParsed > 0) {
+    LOG_AT_TAG(LOG_LEVEL_INFO, logTag, "Parsed %u bytes in %lu ms (%lu B/s)\n", static_cast<unsigned>(bytesParsed),
+               elapsedMs, static_cast<unsigned long>(getBytesPerSecond()));
+  }
+}
+
+void ExpatDriver::release() {
+  if (!parser) {
+    return;
+  }
+  XML_ParserFree(parser);
+  parser = nullptr;
+  needsReset = false;
+}
+
+uint32_t ExpatDriver::getBytesPerSecond() const {
+  if (elapsedMs == 0) {
+    return 0;
+  }
+  return static_cast<uint32_t>(static_cast<uint64_t>(bytesParsed) * 1000 / elapsedMs);
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <SdFat.h>
+#include <expat.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/**
+ * Shared expat setup and feeding for every XML parser in the firmware.
+ *
+ * One driver owns one expat parser. begin() creates it on first use and resets it (XML_ParserReset keeps its buffers
+ * and free lists) on every later use, so a caller parsing several documents in a row, like indexing a book, allocates
+ * it once. Files are read in chunks sized to the free heap, up to 4KB, since SD reads are much cheaper per byte in
+ * larger blocks. Throughput of every document is logged when it ends.
+ *
+ * Parsers fed from a stream (Print::write) use feed(), parsers that own their input file use parseFile().
+ */
+class ExpatDriver {
+ public:
+  ExpatDriver() = default;
+  ~ExpatDriver();
+
+  // Disable copy
+  ExpatDriver(const ExpatDriver&) = delete;
+  ExpatDriver& operator=(const ExpatDriver&) = delete;
+
+  /**
+   * Prepare the parser for a new document and install its callbacks. logTag names the document's parser in the log.
+   * Returns false if the parser could not be allocated.
+   */
+  bool begin(const char* logTag, void* userData, XML_StartElementHandler startElement,
+             XML_EndElementHandler endElement, XML_CharacterDataHandler characterData = nullptr);
+
+  /**
+   * Parse the next piece of a document. Returns false on allocation or parse errors, after which every call fails
+   * until the next begin().
+   */
+  bool feed(const void* data, size_t length, bool isFinal);
+
+  /**
+   * Signal the end of a document fed without isFinal.
+   */
+  bool finish();
+
+  /**
+   * Parse the rest of a file, reporting (bytes read, file size) after every chunk.
+   */
+  bool parseFile(FsFile& file, const std::function<void(size_t, size_t)>& onProgress = nullptr);
+
+  /**
+   * Detach the callbacks and log throughput. The parser stays allocated for the next begin().
+   */
+  void end();
+
+  /**
+   * Free the parser and its buffers, e.g. once a batch of documents is done.
+   */
+  void release();
+
+  bool hasFailed() const { return failed; }
+  XML_Parser get() const { return parser; }
+  uint32_t getBytesPerSecond() const;
+
+  /**
+   * Read size for files: the largest of 4KB, 2KB, 1KB that leaves enough heap, 512 bytes under pressure.
+   */
+  static size_t chooseChunkSize();
+
+ private:
+  XML_Parser parser = nullptr;
+  const char* logTag = "XML";
+  bool failed = false;
+  bool needsReset = false;
+  size_t bytesParsed = 0;
+  unsigned long startMs = 0;
+  unsigned long elapsedMs = 0;
+
+  bool parseBuffer(int length, bool isFinal);
+  void fail();
+};
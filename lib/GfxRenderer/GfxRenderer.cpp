@@ -1,7 +1,14 @@
 #include "GfxRenderer.h"
 
+#include <EpdFontPack.h>
+#include <EpdGlyphRle.h>
+#include <Logging.h>
+#include <Trace.h>
 #include <Utf8.h>
 
+#include <algorithm>
+#include <cstring>
+
 void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) { fontMap.insert({fontId, font}); }
 
 void GfxRenderer::rotateCoordinates(const int x, const int y, int* rotatedX, int* rotatedY) const {
@@ -35,15 +42,95 @@ void GfxRenderer::rotateCoordinates(const int x, const int y, int* rotatedX, int
   }
 }
 
-void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
-  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+GfxRenderer::Rect GfxRenderer::toPanelRect(const Rect& logical) const {
+  if (logical.width <= 0 || logical.height <= 0) {
+    return {0, 0, 0, 0};
+  }
+  // rotateCoordinates has no default case, an invalid orientation leaves them at the origin
+  int x1 = 0, y1 = 0, x2 = 0, y2 = 0;
+  rotateCoordinates(logical.x, logical.y, &x1, &y1);
+  rotateCoordinates(logical.x + logical.width - 1, logical.y + logical.height - 1, &x2, &y2);
+  return {std::min(x1, x2), std::min(y1, y2), std::abs(x2 - x1) + 1, std::abs(y2 - y1) + 1};
+}
 
-  // Early return if no framebuffer is set
-  if (!frameBuffer) {
-    Serial.printf("[%lu] [GFX] !! No framebuffer\n", millis());
+GfxRenderer::Rect GfxRenderer::toLogicalRect(const Rect& panel) const {
+  if (panel.width <= 0 || panel.height <= 0) {
+    return {0, 0, 0, 0};
+  }
+  // Inverse of rotateCoordinates
+  const auto toLogical = [this](const int panelX, const int panelY, int* x, int* y) {
+    switch (orientation) {
+      case Portrait:
+        *x = EInkDisplay::DISPLAY_HEIGHT - 1 - panelY;
+        *y = panelX;
+        break;
+      case LandscapeClockwise:
+        *x = EInkDisplay::DISPLAY_WIDTH - 1 - panelX;
+        *y = EInkDisplay::DISPLAY_HEIGHT - 1 - panelY;
+        break;
+      case PortraitInverted:
+        *x = panelY;
+        *y = EInkDisplay::DISPLAY_WIDTH - 1 - panelX;
+        break;
+      case LandscapeCounterClockwise:
+      default:
+        *x = panelX;
+        *y = panelY;
+        break;
+    }
+  };
+  int x1, y1, x2, y2;
+  toLogical(panel.x, panel.y, &x1, &y1);
+  toLogical(panel.x + panel.width - 1, panel.y + panel.height - 1, &x2, &y2);
+  return {std::min(x1, x2), std::min(y1, y2), std::abs(x2 - x1) + 1, std::abs(y2 - y1) + 1};
+}
+
+void GfxRenderer::markDirty(const int x, const int y, const int width, const int height) const {
+  const Rect panel = toPanelRect({x, y, width, height});
+  markPanelDirty(panel.x, panel.y, panel.width, panel.height);
+}
+
+void GfxRenderer::markPanelDirty(int x, int y, int width, int height) const {
+  // Clip to the panel
+  if (x < 0) {
+    width += x;
+    x = 0;
+  }
+  if (y < 0) {
+    height += y;
+    y = 0;
+  }
+  width = std::min(width, EInkDisplay::DISPLAY_WIDTH - x);
+  height = std::min(height, EInkDisplay::DISPLAY_HEIGHT - y);
+  if (width <= 0 || height <= 0) {
     return;
   }
 
+  if (dirtyRect.width == 0) {
+    dirtyRect = {x, y, width, height};
+    return;
+  }
+  const int right = std::max(dirtyRect.x + dirtyRect.width, x + width);
+  const int bottom = std::max(dirtyRect.y + dirtyRect.height, y + height);
+  dirtyRect.x = std::min(dirtyRect.x, x);
+  dirtyRect.y = std::min(dirtyRect.y, y);
+  dirtyRect.width = right - dirtyRect.x;
+  dirtyRect.height = bottom - dirtyRect.y;
+}
+
+uint8_t* GfxRenderer::frameRow(const int panelY) const {
+  if (backBufferActive) {
+    return bwBufferChunks[panelY / BW_BUFFER_ROWS_PER_CHUNK] +
+           panelY % BW_BUFFER_ROWS_PER_CHUNK * EInkDisplay::DISPLAY_WIDTH_BYTES;
+  }
+  if (frameLent) {
+    waitForDisplay();
+  }
+  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  return frameBuffer ? frameBuffer + panelY * EInkDisplay::DISPLAY_WIDTH_BYTES : nullptr;
+}
+
+void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
   int rotatedX = 0;
   int rotatedY = 0;
   rotateCoordinates(x, y, &rotatedX, &rotatedY);
@@ -51,24 +138,37 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
   // Bounds checking against physical panel dimensions
   if (rotatedX < 0 || rotatedX >= EInkDisplay::DISPLAY_WIDTH || rotatedY < 0 ||
       rotatedY >= EInkDisplay::DISPLAY_HEIGHT) {
-    Serial.printf("[%lu] [GFX] !! Outside range (%d, %d) -> (%d, %d)\n", millis(), x, y, rotatedX, rotatedY);
+    LOG_DBG("GFX", "!! Outside range (%d, %d) -> (%d, %d)\n", x, y, rotatedX, rotatedY);
+    return;
+  }
+
+  // Most pixels land inside the dirty rect already, the rect grows pixel by pixel only at the edge of a draw
+  if (rotatedX < dirtyRect.x || rotatedY < dirtyRect.y || rotatedX >= dirtyRect.x + dirtyRect.width ||
+      rotatedY >= dirtyRect.y + dirtyRect.height) {
+    markPanelDirty(rotatedX, rotatedY, 1, 1);
+  }
+
+  uint8_t* row = frameRow(rotatedY);
+  // Early return if no framebuffer is set
+  if (!row) {
+    LOG_INF("GFX", "!! No framebuffer\n");
     return;
   }
 
   // Calculate byte position and bit position
-  const uint16_t byteIndex = rotatedY * EInkDisplay::DISPLAY_WIDTH_BYTES + (rotatedX / 8);
+  const uint16_t byteIndex = rotatedX / 8;
   const uint8_t bitPosition = 7 - (rotatedX % 8);  // MSB first
 
   if (state) {
-    frameBuffer[byteIndex] &= ~(1 << bitPosition);  // Clear bit
+    row[byteIndex] &= ~(1 << bitPosition);  // Clear bit
   } else {
-    frameBuffer[byteIndex] |= 1 << bitPosition;  // Set bit
+    row[byteIndex] |= 1 << bitPosition;  // Set bit
   }
 }
 
 int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontFamily::Style style) const {
   if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+    LOG_WRN("GFX", "Font %d not found\n", fontId);
     return 0;
   }
 
@@ -94,7 +194,7 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
   }
 
   if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+    LOG_WRN("GFX", "Font %d not found\n", fontId);
     return;
   }
   const auto font = fontMap.at(fontId);
@@ -104,30 +204,41 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
     return;
   }
 
+  // Each glyph's bitmap is drawn before the next one is looked up
+  const EpdFontPack::Lock packLock(font.isPack(style));
   uint32_t cp;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
     renderChar(font, cp, &xpos, &yPos, black, style);
   }
 }
 
-void GfxRenderer::drawLine(int x1, int y1, int x2, int y2, const bool state) const {
-  if (x1 == x2) {
-    if (y2 < y1) {
-      std::swap(y1, y2);
-    }
-    for (int y = y1; y <= y2; y++) {
-      drawPixel(x1, y, state);
+void GfxRenderer::drawLine(int x1, int y1, const int x2, const int y2, const bool state) const {
+  if (x1 == x2 || y1 == y2) {
+    // Axis-aligned lines are one pixel wide rectangles
+    fillRect(std::min(x1, x2), std::min(y1, y2), std::abs(x2 - x1) + 1, std::abs(y2 - y1) + 1, state);
+    return;
+  }
+
+  // Bresenham, error tracks both axes so every octant takes the same loop
+  const int dx = std::abs(x2 - x1);
+  const int dy = -std::abs(y2 - y1);
+  const int stepX = x1 < x2 ? 1 : -1;
+  const int stepY = y1 < y2 ? 1 : -1;
+  int error = dx + dy;
+  while (true) {
+    drawPixel(x1, y1, state);
+    if (x1 == x2 && y1 == y2) {
+      break;
     }
-  } else if (y1 == y2) {
-    if (x2 < x1) {
-      std::swap(x1, x2);
+    const int doubledError = 2 * error;
+    if (doubledError >= dy) {
+      error += dy;
+      x1 += stepX;
     }
-    for (int x = x1; x <= x2; x++) {
-      drawPixel(x, y1, state);
+    if (doubledError <= dx) {
+      error += dx;
+      y1 += stepY;
     }
-  } else {
-    // TODO: Implement
-    Serial.printf("[%lu] [GFX] Line drawing not supported\n", millis());
   }
 }
 
@@ -139,8 +250,105 @@ void GfxRenderer::drawRect(const int x, const int y, const int width, const int
 }
 
 void GfxRenderer::fillRect(const int x, const int y, const int width, const int height, const bool state) const {
-  for (int fillY = y; fillY < y + height; fillY++) {
-    drawLine(x, fillY, x + width - 1, fillY, state);
+  // Every orientation maps a logical rectangle onto a panel rectangle
+  const Rect panel = toPanelRect({x, y, width, height});
+  fillPanelRect(panel.x, panel.y, panel.width, panel.height, state);
+}
+
+GfxRenderer::Rect GfxRenderer::clipToPanel(Rect panel) {
+  if (panel.x < 0) {
+    panel.width += panel.x;
+    panel.x = 0;
+  }
+  if (panel.y < 0) {
+    panel.height += panel.y;
+    panel.y = 0;
+  }
+  panel.width = std::max(0, std::min(panel.width, EInkDisplay::DISPLAY_WIDTH - panel.x));
+  panel.height = std::max(0, std::min(panel.height, EInkDisplay::DISPLAY_HEIGHT - panel.y));
+  return panel;
+}
+
+void GfxRenderer::fillPanelRect(const int panelX, const int panelY, const int panelWidth, const int panelHeight,
+                                const bool state) const {
+  const auto [x, y, width, height] = clipToPanel({panelX, panelY, panelWidth, panelHeight});
+  if (width <= 0 || height <= 0) {
+    return;
+  }
+  markPanelDirty(x, y, width, height);
+
+  // Byte range of a row once, masks for the partial bytes at either end (MSB is the leftmost pixel)
+  const int firstByte = x / 8;
+  const int lastByte = (x + width - 1) / 8;
+  uint8_t firstMask = 0xFF >> (x % 8);
+  const auto lastMask = static_cast<uint8_t>(0xFF << (7 - (x + width - 1) % 8));
+  if (firstByte == lastByte) {
+    firstMask &= lastMask;
+  }
+  // Set bits are white
+  const uint8_t fill = state ? 0x00 : 0xFF;
+
+  for (int row = y; row < y + height; row++) {
+    uint8_t* line = frameRow(row);
+    if (!line) {
+      LOG_INF("GFX", "!! No framebuffer\n");
+      return;
+    }
+    line[firstByte] = (line[firstByte] & ~firstMask) | (fill & firstMask);
+    if (lastByte > firstByte) {
+      memset(line + firstByte + 1, fill, lastByte - firstByte - 1);
+      line[lastByte] = (line[lastByte] & ~lastMask) | (fill & lastMask);
+    }
+  }
+}
+
+bool GfxRenderer::saveRegion(const Rect& logical, std::vector<uint8_t>& out) const {
+  const Rect panel = clipToPanel(toPanelRect(logical));
+  if (panel.width <= 0 || panel.height <= 0) {
+    return false;
+  }
+  const int firstByte = panel.x / 8;
+  const int rowBytes = (panel.x + panel.width - 1) / 8 - firstByte + 1;
+  out.resize(rowBytes * panel.height);
+  for (int i = 0; i < panel.height; i++) {
+    const uint8_t* row = frameRow(panel.y + i);
+    if (!row) {
+      LOG_INF("GFX", "!! No framebuffer in saveRegion\n");
+      return false;
+    }
+    memcpy(out.data() + i * rowBytes, row + firstByte, rowBytes);
+  }
+  return true;
+}
+
+void GfxRenderer::restoreRegion(const Rect& logical, const std::vector<uint8_t>& saved) const {
+  const Rect panel = clipToPanel(toPanelRect(logical));
+  const int firstByte = panel.x / 8;
+  const int lastByte = (panel.x + panel.width - 1) / 8;
+  const int rowBytes = lastByte - firstByte + 1;
+  if (panel.width <= 0 || panel.height <= 0 || saved.size() != static_cast<size_t>(rowBytes * panel.height)) {
+    return;
+  }
+  markPanelDirty(panel.x, panel.y, panel.width, panel.height);
+
+  // Pixels of the partial bytes at either end that lie outside the rect keep their value
+  uint8_t firstMask = 0xFF >> (panel.x % 8);
+  const auto lastMask = static_cast<uint8_t>(0xFF << (7 - (panel.x + panel.width - 1) % 8));
+  if (firstByte == lastByte) {
+    firstMask &= lastMask;
+  }
+  for (int i = 0; i < panel.height; i++) {
+    uint8_t* line = frameRow(panel.y + i);
+    if (!line) {
+      LOG_INF("GFX", "!! No framebuffer in restoreRegion\n");
+      return;
+    }
+    const uint8_t* source = saved.data() + i * rowBytes;
+    line[firstByte] = (line[firstByte] & ~firstMask) | (source[0] & firstMask);
+    if (lastByte > firstByte) {
+      memcpy(line + firstByte + 1, source + 1, rowBytes - 2);
+      line[lastByte] = (line[lastByte] & ~lastMask) | (source[rowBytes - 1] & lastMask);
+    }
   }
 }
 
@@ -163,8 +371,32 @@ void GfxRenderer::drawImage(const uint8_t bitmap[], const int x, const int y, co
     case LandscapeCounterClockwise:
       break;
   }
+  markPanelDirty(rotatedX, rotatedY, width, height);
   // TODO: Rotate bits
-  einkDisplay.drawImage(bitmap, rotatedX, rotatedY, width, height);
+  if (!backBufferActive) {
+    waitForDisplay();
+    einkDisplay.drawImage(bitmap, rotatedX, rotatedY, width, height);
+    return;
+  }
+  // The driver only draws into the frame buffer, the back buffer gets the same bits copied here: 1 bit per pixel, MSB
+  // first, rows padded to whole bytes, set bits are white
+  const int imageWidthBytes = (width + 7) / 8;
+  for (int imageY = 0; imageY < height; imageY++) {
+    const int panelY = rotatedY + imageY;
+    if (panelY < 0 || panelY >= EInkDisplay::DISPLAY_HEIGHT) {
+      continue;
+    }
+    uint8_t* row = frameRow(panelY);
+    for (int imageX = 0; imageX < width; imageX++) {
+      const int panelX = rotatedX + imageX;
+      if (panelX < 0 || panelX >= EInkDisplay::DISPLAY_WIDTH) {
+        continue;
+      }
+      const bool white = bitmap[imageY * imageWidthBytes + imageX / 8] & (0x80 >> (imageX % 8));
+      const uint8_t bit = 0x80 >> (panelX % 8);
+      row[panelX / 8] = white ? row[panelX / 8] | bit : row[panelX / 8] & ~bit;
+    }
+  }
 }
 
 void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, const int maxWidth, const int maxHeight,
@@ -179,8 +411,8 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
   bool isScaled = false;
   int cropPixX = std::floor(bitmap.getWidth() * cropX / 2.0f);
   int cropPixY = std::floor(bitmap.getHeight() * cropY / 2.0f);
-  Serial.printf("[%lu] [GFX] Cropping %dx%d by %dx%d pix, is %s\n", millis(), bitmap.getWidth(), bitmap.getHeight(),
-                cropPixX, cropPixY, bitmap.isTopDown() ? "top-down" : "bottom-up");
+  LOG_DBG("GFX", "Cropping %dx%d by %dx%d pix, is %s\n", bitmap.getWidth(), bitmap.getHeight(), cropPixX, cropPixY,
+          bitmap.isTopDown() ? "top-down" : "bottom-up");
 
   if (maxWidth > 0 && (1.0f - cropX) * bitmap.getWidth() > maxWidth) {
     scale = static_cast<float>(maxWidth) / static_cast<float>((1.0f - cropX) * bitmap.getWidth());
@@ -190,7 +422,7 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
     scale = std::min(scale, static_cast<float>(maxHeight) / static_cast<float>((1.0f - cropY) * bitmap.getHeight()));
     isScaled = true;
   }
-  Serial.printf("[%lu] [GFX] Scaling by %f - %s\n", millis(), scale, isScaled ? "scaled" : "not scaled");
+  LOG_DBG("GFX", "Scaling by %f - %s\n", scale, isScaled ? "scaled" : "not scaled");
 
   // Calculate output row size (2 bits per pixel, packed into bytes)
   // IMPORTANT: Use int, not uint8_t, to avoid overflow for images > 1020 pixels wide
@@ -199,7 +431,7 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
   auto* rowBytes = static_cast<uint8_t*>(malloc(bitmap.getRowBytes()));
 
   if (!outputRow || !rowBytes) {
-    Serial.printf("[%lu] [GFX] !! Failed to allocate BMP row buffers\n", millis());
+    LOG_ERR("GFX", "!! Failed to allocate BMP row buffers\n");
     free(outputRow);
     free(rowBytes);
     return;
@@ -218,7 +450,7 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
     }
 
     if (bitmap.readNextRow(outputRow, rowBytes) != BmpReaderError::Ok) {
-      Serial.printf("[%lu] [GFX] Failed to read row %d from bitmap\n", millis(), bmpY);
+      LOG_ERR("GFX", "Failed to read row %d from bitmap\n", bmpY);
       free(outputRow);
       free(rowBytes);
       return;
@@ -281,7 +513,7 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
   auto* rowBytes = static_cast<uint8_t*>(malloc(bitmap.getRowBytes()));
 
   if (!outputRow || !rowBytes) {
-    Serial.printf("[%lu] [GFX] !! Failed to allocate 1-bit BMP row buffers\n", millis());
+    LOG_ERR("GFX", "!! Failed to allocate 1-bit BMP row buffers\n");
     free(outputRow);
     free(rowBytes);
     return;
@@ -290,7 +522,7 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
   for (int bmpY = 0; bmpY < bitmap.getHeight(); bmpY++) {
     // Read rows sequentially using readNextRow
     if (bitmap.readNextRow(outputRow, rowBytes) != BmpReaderError::Ok) {
-      Serial.printf("[%lu] [GFX] Failed to read row %d from 1-bit bitmap\n", millis(), bmpY);
+      LOG_ERR("GFX", "Failed to read row %d from 1-bit bitmap\n", bmpY);
       free(outputRow);
       free(rowBytes);
       return;
@@ -348,7 +580,7 @@ void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoi
   // Allocate node buffer for scanline algorithm
   auto* nodeX = static_cast<int*>(malloc(numPoints * sizeof(int)));
   if (!nodeX) {
-    Serial.printf("[%lu] [GFX] !! Failed to allocate polygon node buffer\n", millis());
+    LOG_ERR("GFX", "!! Failed to allocate polygon node buffer\n");
     return;
   }
 
@@ -389,47 +621,175 @@ void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoi
       if (startX < 0) startX = 0;
       if (endX >= getScreenWidth()) endX = getScreenWidth() - 1;
 
-      // Draw horizontal line
-      for (int x = startX; x <= endX; x++) {
-        drawPixel(x, scanY, state);
-      }
+      // Draw horizontal span
+      fillRect(startX, scanY, endX - startX + 1, 1, state);
     }
   }
 
   free(nodeX);
 }
 
-void GfxRenderer::clearScreen(const uint8_t color) const { einkDisplay.clearScreen(color); }
+void GfxRenderer::clearScreen(const uint8_t color) const {
+  if (backBufferActive) {
+    for (auto* chunk : bwBufferChunks) {
+      memset(chunk, color, BW_BUFFER_CHUNK_SIZE);
+    }
+  } else {
+    waitForDisplay();
+    einkDisplay.clearScreen(color);
+  }
+  markPanelDirty(0, 0, EInkDisplay::DISPLAY_WIDTH, EInkDisplay::DISPLAY_HEIGHT);
+}
 
 void GfxRenderer::invertScreen() const {
-  uint8_t* buffer = einkDisplay.getFrameBuffer();
-  if (!buffer) {
-    Serial.printf("[%lu] [GFX] !! No framebuffer in invertScreen\n", millis());
-    return;
-  }
-  for (int i = 0; i < EInkDisplay::BUFFER_SIZE; i++) {
-    buffer[i] = ~buffer[i];
+  for (int y = 0; y < EInkDisplay::DISPLAY_HEIGHT; y++) {
+    uint8_t* row = frameRow(y);
+    if (!row) {
+      LOG_INF("GFX", "!! No framebuffer in invertScreen\n");
+      return;
+    }
+    for (int i = 0; i < EInkDisplay::DISPLAY_WIDTH_BYTES; i++) {
+      row[i] = ~row[i];
+    }
   }
+  markPanelDirty(0, 0, EInkDisplay::DISPLAY_WIDTH, EInkDisplay::DISPLAY_HEIGHT);
 }
 
 void GfxRenderer::displayBuffer(const EInkDisplay::RefreshMode refreshMode) const {
+  waitForDisplay();
+  TRACE_SCOPE("display.refresh");
   einkDisplay.displayBuffer(refreshMode);
+  dirtyRect = {0, 0, 0, 0};
+}
+
+GfxRenderer::PresentHandle GfxRenderer::displayBufferAsync(const EInkDisplay::RefreshMode refreshMode) {
+  waitForDisplay();
+  if (!displayTaskHandle) {
+    displayDone = xSemaphoreCreateBinary();
+    if (!displayDone || xTaskCreate(&GfxRenderer::displayTaskTrampoline, "DisplayTask", DISPLAY_TASK_STACK_SIZE,
+                                    this, 1, &displayTaskHandle) != pdPASS) {
+      LOG_ERR("GFX", "!! Failed to start the display task, refreshing synchronously\n");
+      if (displayDone) {
+        vSemaphoreDelete(displayDone);
+        displayDone = nullptr;
+      }
+      displayTaskHandle = nullptr;
+    }
+  }
+
+  PresentHandle handle;
+  handle.renderer = this;
+  handle.sequence = ++startedRefreshes;
+  if (!displayTaskHandle) {
+    displayBuffer(refreshMode);
+    completedRefreshes = handle.sequence;
+    return handle;
+  }
+  asyncRefreshMode = refreshMode;
+  dirtyRect = {0, 0, 0, 0};
+  displayBusy = true;
+  frameLent = true;
+  xTaskNotifyGive(displayTaskHandle);
+  return handle;
+}
+
+void GfxRenderer::waitForDisplay() const {
+  // A give left over from a refresh nobody waited for only costs one more pass
+  while (displayBusy) {
+    TRACE_SCOPE("display.wait");
+    xSemaphoreTake(displayDone, portMAX_DELAY);
+  }
+  frameLent = false;
+}
+
+void GfxRenderer::displayTaskTrampoline(void* param) {
+  auto* self = static_cast<GfxRenderer*>(param);
+  self->displayTaskLoop();
+}
+
+void GfxRenderer::displayTaskLoop() {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    {
+      TRACE_SCOPE("display.refresh");
+      einkDisplay.displayBuffer(asyncRefreshMode);
+    }
+    completedRefreshes = startedRefreshes;
+    displayBusy = false;
+    xSemaphoreGive(displayDone);
+  }
+}
+
+bool GfxRenderer::PresentHandle::isDone() const {
+  return !renderer || renderer->completedRefreshes.load() >= sequence;
+}
+
+void GfxRenderer::PresentHandle::wait() const {
+  if (!isDone()) {
+    renderer->waitForDisplay();
+  }
+}
+
+void GfxRenderer::present(const EInkDisplay::RefreshMode refreshMode) const {
+  if (dirtyRect.width == 0) {
+    return;
+  }
+  // A window still runs the whole waveform, so the union is refreshed as one window rather than region by region.
+  // Slower refresh modes and grayscale frames always go to the whole panel.
+  const int panelArea = EInkDisplay::DISPLAY_WIDTH * EInkDisplay::DISPLAY_HEIGHT;
+  if (refreshMode != EInkDisplay::FAST_REFRESH || renderMode != BW ||
+      dirtyRect.width * dirtyRect.height * 100 > panelArea * WINDOWED_REFRESH_MAX_PERCENT) {
+    displayBuffer(refreshMode);
+    return;
+  }
+  waitForDisplay();
+  displayPanelWindow(dirtyRect);
+  dirtyRect = {0, 0, 0, 0};
+}
+
+void GfxRenderer::displayWindow(const int x, const int y, const int width, const int height) const {
+  waitForDisplay();
+  displayPanelWindow(toPanelRect({x, y, width, height}));
+}
+
+void GfxRenderer::displayPanelWindow(const Rect& panel) const {
+  // The controller addresses RAM columns a byte at a time
+  const int left = std::max(0, panel.x) / 8 * 8;
+  const int right = std::min<int>(EInkDisplay::DISPLAY_WIDTH, (panel.x + panel.width + 7) / 8 * 8);
+  const int top = std::max(0, panel.y);
+  const int bottom = std::min<int>(EInkDisplay::DISPLAY_HEIGHT, panel.y + panel.height);
+  if (right <= left || bottom <= top) {
+    return;
+  }
+  TRACE_SCOPE("display.window");
+  einkDisplay.displayWindow(left, top, right - left, bottom - top);
 }
 
 std::string GfxRenderer::truncatedText(const int fontId, const char* text, const int maxWidth,
                                        const EpdFontFamily::Style style) const {
-  std::string item = text;
-  int itemWidth = getTextWidth(fontId, item.c_str(), style);
-  while (itemWidth > maxWidth && item.length() > 8) {
-    item.replace(item.length() - 5, 5, "...");
-    itemWidth = getTextWidth(fontId, item.c_str(), style);
+  const size_t length = getTruncationLength(fontId, text, maxWidth, style);
+  if (text[length] == '\0') {
+    return text;
+  }
+  return std::string(text, length) + "...";
+}
+
+size_t GfxRenderer::getTruncationLength(const int fontId, const char* text, const int maxWidth,
+                                        const EpdFontFamily::Style style) const {
+  if (fontMap.count(fontId) == 0) {
+    LOG_WRN("GFX", "Font %d not found\n", fontId);
+    return strlen(text);
   }
-  return item;
+  return fontMap.at(fontId).getFittingLength(text, "...", maxWidth, style);
 }
 
 // Note: Internal driver treats screen in command orientation; this library exposes a logical orientation
-int GfxRenderer::getScreenWidth() const {
-  switch (orientation) {
+int GfxRenderer::getScreenWidth() const { return getScreenWidth(orientation); }
+
+int GfxRenderer::getScreenHeight() const { return getScreenHeight(orientation); }
+
+int GfxRenderer::getScreenWidth(const Orientation o) {
+  switch (o) {
     case Portrait:
     case PortraitInverted:
       // 480px wide in portrait logical coordinates
@@ -442,8 +802,8 @@ int GfxRenderer::getScreenWidth() const {
   return EInkDisplay::DISPLAY_HEIGHT;
 }
 
-int GfxRenderer::getScreenHeight() const {
-  switch (orientation) {
+int GfxRenderer::getScreenHeight(const Orientation o) {
+  switch (o) {
     case Portrait:
     case PortraitInverted:
       // 800px tall in portrait logical coordinates
@@ -458,25 +818,41 @@ int GfxRenderer::getScreenHeight() const {
 
 int GfxRenderer::getSpaceWidth(const int fontId) const {
   if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+    LOG_WRN("GFX", "Font %d not found\n", fontId);
     return 0;
   }
 
-  return fontMap.at(fontId).getGlyph(' ', EpdFontFamily::REGULAR)->advanceX;
+  const auto& font = fontMap.at(fontId);
+  const EpdFontPack::Lock packLock(font.isPack());
+  return font.getGlyph(' ', EpdFontFamily::REGULAR)->advanceX;
 }
 
 int GfxRenderer::getFontAscenderSize(const int fontId) const {
   if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+    LOG_WRN("GFX", "Font %d not found\n", fontId);
     return 0;
   }
 
   return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->ascender;
 }
 
+bool GfxRenderer::isPackFont(const int fontId) const {
+  const auto font = fontMap.find(fontId);
+  if (font == fontMap.end()) {
+    return false;
+  }
+  for (const auto style : {EpdFontFamily::REGULAR, EpdFontFamily::BOLD, EpdFontFamily::ITALIC,
+                           EpdFontFamily::BOLD_ITALIC}) {
+    if (font->second.isPack(style)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 int GfxRenderer::getLineHeight(const int fontId) const {
   if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+    LOG_WRN("GFX", "Font %d not found\n", fontId);
     return 0;
   }
 
@@ -564,7 +940,7 @@ void GfxRenderer::drawSideButtonHints(const int fontId, const char* topBtn, cons
 
 int GfxRenderer::getTextHeight(const int fontId) const {
   if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+    LOG_WRN("GFX", "Font %d not found\n", fontId);
     return 0;
   }
   return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->ascender;
@@ -578,7 +954,7 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
   }
 
   if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+    LOG_WRN("GFX", "Font %d not found\n", fontId);
     return;
   }
   const auto font = fontMap.at(fontId);
@@ -594,6 +970,7 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
 
   int yPos = y;  // Current Y position (decreases as we draw characters)
 
+  const EpdFontPack::Lock packLock(font.isPack(style));
   uint32_t cp;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
     const EpdGlyph* glyph = font.getGlyph(cp, style);
@@ -605,15 +982,30 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
     }
 
     const int is2Bit = font.getData(style)->is2Bit;
-    const uint32_t offset = glyph->dataOffset;
     const uint8_t width = glyph->width;
     const uint8_t height = glyph->height;
     const int left = glyph->left;
     const int top = glyph->top;
 
-    const uint8_t* bitmap = &font.getData(style)->bitmap[offset];
-
-    if (bitmap != nullptr) {
+    const uint8_t* bitmap = font.getGlyphBitmap(glyph, style);
+
+    if (bitmap != nullptr && font.getData(style)->isRle) {
+      const int ascender = font.getData(style)->ascender;
+      glyphrle::forEachRun(bitmap, glyph->dataLength, width, height,
+                           [&](const uint8_t value, const int runX, const int runY, const int length) {
+                             const uint8_t bmpVal = 3 - value;
+                             const int screenX = x + (ascender - top + runY);
+                             for (int glyphX = runX; glyphX < runX + length; glyphX++) {
+                               const int screenY = yPos - left - glyphX;
+                               if (renderMode == BW) {
+                                 drawPixel(screenX, screenY, black);
+                               } else if ((renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) ||
+                                          (renderMode == GRAYSCALE_LSB && bmpVal == 1)) {
+                                 drawPixel(screenX, screenY, false);
+                               }
+                             }
+                           });
+    } else if (bitmap != nullptr) {
       for (int glyphY = 0; glyphY < height; glyphY++) {
         for (int glyphX = 0; glyphX < width; glyphX++) {
           const int pixelPosition = glyphY * width + glyphX;
@@ -627,7 +1019,7 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
           if (is2Bit) {
             const uint8_t byte = bitmap[pixelPosition / 4];
             const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
-            const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
+            const uint8_t bmpVal = 3 - ((byte >> bit_index) & 0x3);
 
             if (renderMode == BW && bmpVal < 3) {
               drawPixel(screenX, screenY, black);
@@ -653,17 +1045,35 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
   }
 }
 
-uint8_t* GfxRenderer::getFrameBuffer() const { return einkDisplay.getFrameBuffer(); }
+uint8_t* GfxRenderer::getFrameBuffer() const {
+  // The caller may write anywhere
+  markPanelDirty(0, 0, EInkDisplay::DISPLAY_WIDTH, EInkDisplay::DISPLAY_HEIGHT);
+  waitForDisplay();
+  return einkDisplay.getFrameBuffer();
+}
 
 size_t GfxRenderer::getBufferSize() { return EInkDisplay::BUFFER_SIZE; }
 
-void GfxRenderer::grayscaleRevert() const { einkDisplay.grayscaleRevert(); }
+void GfxRenderer::grayscaleRevert() const {
+  waitForDisplay();
+  einkDisplay.grayscaleRevert();
+}
 
-void GfxRenderer::copyGrayscaleLsbBuffers() const { einkDisplay.copyGrayscaleLsbBuffers(einkDisplay.getFrameBuffer()); }
+void GfxRenderer::copyGrayscaleLsbBuffers() const {
+  waitForDisplay();
+  einkDisplay.copyGrayscaleLsbBuffers(einkDisplay.getFrameBuffer());
+}
 
-void GfxRenderer::copyGrayscaleMsbBuffers() const { einkDisplay.copyGrayscaleMsbBuffers(einkDisplay.getFrameBuffer()); }
+void GfxRenderer::copyGrayscaleMsbBuffers() const {
+  waitForDisplay();
+  einkDisplay.copyGrayscaleMsbBuffers(einkDisplay.getFrameBuffer());
+}
 
-void GfxRenderer::displayGrayBuffer() const { einkDisplay.displayGrayBuffer(); }
+void GfxRenderer::displayGrayBuffer() const {
+  waitForDisplay();
+  TRACE_SCOPE("display.gray");
+  einkDisplay.displayGrayBuffer();
+}
 
 void GfxRenderer::freeBwBufferChunks() {
   for (auto& bwBufferChunk : bwBufferChunks) {
@@ -674,45 +1084,53 @@ void GfxRenderer::freeBwBufferChunks() {
   }
 }
 
-/**
- * This should be called before grayscale buffers are populated.
- * A `restoreBwBuffer` call should always follow the grayscale render if this method was called.
- * Uses chunked allocation to avoid needing 48KB of contiguous memory.
- * Returns true if buffer was stored successfully, false if allocation failed.
- */
-bool GfxRenderer::storeBwBuffer() {
-  const uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
-  if (!frameBuffer) {
-    Serial.printf("[%lu] [GFX] !! No framebuffer in storeBwBuffer\n", millis());
-    return false;
-  }
-
-  // Allocate and copy each chunk
+bool GfxRenderer::allocateBwBufferChunks() {
   for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
     // Check if any chunks are already allocated
     if (bwBufferChunks[i]) {
-      Serial.printf("[%lu] [GFX] !! BW buffer chunk %zu already stored - this is likely a bug, freeing chunk\n",
-                    millis(), i);
+      LOG_INF("GFX", "!! BW buffer chunk %zu already stored - this is likely a bug, freeing chunk\n", i);
       free(bwBufferChunks[i]);
       bwBufferChunks[i] = nullptr;
     }
 
-    const size_t offset = i * BW_BUFFER_CHUNK_SIZE;
     bwBufferChunks[i] = static_cast<uint8_t*>(malloc(BW_BUFFER_CHUNK_SIZE));
 
     if (!bwBufferChunks[i]) {
-      Serial.printf("[%lu] [GFX] !! Failed to allocate BW buffer chunk %zu (%zu bytes)\n", millis(), i,
-                    BW_BUFFER_CHUNK_SIZE);
+      LOG_ERR("GFX", "!! Failed to allocate BW buffer chunk %zu (%zu bytes)\n", i, BW_BUFFER_CHUNK_SIZE);
       // Free previously allocated chunks
       freeBwBufferChunks();
       return false;
     }
+  }
+  return true;
+}
 
-    memcpy(bwBufferChunks[i], frameBuffer + offset, BW_BUFFER_CHUNK_SIZE);
+/**
+ * This should be called before grayscale buffers are populated.
+ * A `restoreBwBuffer` call should always follow the grayscale render if this method was called.
+ * Uses chunked allocation to avoid needing 48KB of contiguous memory.
+ * Returns true if buffer was stored successfully, false if allocation failed.
+ */
+bool GfxRenderer::storeBwBuffer() {
+  // Reading the frame buffer while a refresh transfers it is fine, no need to wait for the display
+  const uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  if (!frameBuffer) {
+    LOG_INF("GFX", "!! No framebuffer in storeBwBuffer\n");
+    return false;
+  }
+  if (backBufferActive) {
+    LOG_ERR("GFX", "!! BW buffer memory is the back buffer, not storing\n");
+    return false;
+  }
+  if (!allocateBwBufferChunks()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+    memcpy(bwBufferChunks[i], frameBuffer + i * BW_BUFFER_CHUNK_SIZE, BW_BUFFER_CHUNK_SIZE);
   }
 
-  Serial.printf("[%lu] [GFX] Stored BW buffer in %zu chunks (%zu bytes each)\n", millis(), BW_BUFFER_NUM_CHUNKS,
-                BW_BUFFER_CHUNK_SIZE);
+  LOG_INF("GFX", "Stored BW buffer in %zu chunks (%zu bytes each)\n", BW_BUFFER_NUM_CHUNKS, BW_BUFFER_CHUNK_SIZE);
   return true;
 }
 
@@ -722,6 +1140,7 @@ bool GfxRenderer::storeBwBuffer() {
  * Uses chunked restoration to match chunked storage.
  */
 void GfxRenderer::restoreBwBuffer() {
+  waitForDisplay();
   // Check if any all chunks are allocated
   bool missingChunks = false;
   for (const auto& bwBufferChunk : bwBufferChunks) {
@@ -738,7 +1157,7 @@ void GfxRenderer::restoreBwBuffer() {
 
   uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
   if (!frameBuffer) {
-    Serial.printf("[%lu] [GFX] !! No framebuffer in restoreBwBuffer\n", millis());
+    LOG_INF("GFX", "!! No framebuffer in restoreBwBuffer\n");
     freeBwBufferChunks();
     return;
   }
@@ -746,7 +1165,7 @@ void GfxRenderer::restoreBwBuffer() {
   for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
     // Check if chunk is missing
     if (!bwBufferChunks[i]) {
-      Serial.printf("[%lu] [GFX] !! BW buffer chunks not stored - this is likely a bug\n", millis());
+      LOG_INF("GFX", "!! BW buffer chunks not stored - this is likely a bug\n");
       freeBwBufferChunks();
       return;
     }
@@ -758,7 +1177,7 @@ void GfxRenderer::restoreBwBuffer() {
   einkDisplay.cleanupGrayscaleBuffers(frameBuffer);
 
   freeBwBufferChunks();
-  Serial.printf("[%lu] [GFX] Restored and freed BW buffer chunks\n", millis());
+  LOG_INF("GFX", "Restored and freed BW buffer chunks\n");
 }
 
 /**
@@ -766,12 +1185,56 @@ void GfxRenderer::restoreBwBuffer() {
  * Use this when BW buffer was re-rendered instead of stored/restored.
  */
 void GfxRenderer::cleanupGrayscaleWithFrameBuffer() const {
+  waitForDisplay();
   uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
   if (frameBuffer) {
     einkDisplay.cleanupGrayscaleBuffers(frameBuffer);
   }
 }
 
+/**
+ * Starts drawing into the BW buffer chunks, initialized with the frame buffer, so the frame buffer stays untouched
+ * while displayBufferAsync() transfers it. The frame buffer is only read here, which a transfer allows.
+ */
+bool GfxRenderer::beginBackBufferRender() {
+  const uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  if (!frameBuffer || backBufferActive || !allocateBwBufferChunks()) {
+    return false;
+  }
+  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+    memcpy(bwBufferChunks[i], frameBuffer + i * BW_BUFFER_CHUNK_SIZE, BW_BUFFER_CHUNK_SIZE);
+  }
+  backBufferActive = true;
+  return true;
+}
+
+/**
+ * Swaps row by row through a row sized buffer, the chunks keep their memory and end up holding the frame that was on
+ * the frame buffer.
+ */
+void GfxRenderer::swapBackBuffer() {
+  if (!backBufferActive) {
+    return;
+  }
+  waitForDisplay();
+  backBufferActive = false;
+  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  if (!frameBuffer) {
+    freeBwBufferChunks();
+    return;
+  }
+
+  uint8_t swapRow[EInkDisplay::DISPLAY_WIDTH_BYTES];
+  for (int y = 0; y < EInkDisplay::DISPLAY_HEIGHT; y++) {
+    uint8_t* front = frameBuffer + y * EInkDisplay::DISPLAY_WIDTH_BYTES;
+    uint8_t* back = bwBufferChunks[y / BW_BUFFER_ROWS_PER_CHUNK] +
+                    y % BW_BUFFER_ROWS_PER_CHUNK * EInkDisplay::DISPLAY_WIDTH_BYTES;
+    memcpy(swapRow, front, sizeof(swapRow));
+    memcpy(front, back, sizeof(swapRow));
+    memcpy(back, swapRow, sizeof(swapRow));
+  }
+}
+
 void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp, int* x, const int* y,
                              const bool pixelState, const EpdFontFamily::Style style) const {
   const EpdGlyph* glyph = fontFamily.getGlyph(cp, style);
@@ -781,20 +1244,36 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
 
   // no glyph?
   if (!glyph) {
-    Serial.printf("[%lu] [GFX] No glyph for codepoint %d\n", millis(), cp);
+    LOG_DBG("GFX", "No glyph for codepoint %d\n", cp);
     return;
   }
 
   const int is2Bit = fontFamily.getData(style)->is2Bit;
-  const uint32_t offset = glyph->dataOffset;
   const uint8_t width = glyph->width;
   const uint8_t height = glyph->height;
   const int left = glyph->left;
 
-  const uint8_t* bitmap = nullptr;
-  bitmap = &fontFamily.getData(style)->bitmap[offset];
-
-  if (bitmap != nullptr) {
+  // Null if a glyph of a font pack could not be read, the cursor still advances
+  const uint8_t* bitmap = fontFamily.getGlyphBitmap(glyph, style);
+
+  if (bitmap != nullptr && fontFamily.getData(style)->isRle) {
+    // Runs are drawn as spans, white runs cost nothing
+    const int glyphLeft = *x + left;
+    const int glyphTop = *y - glyph->top;
+    glyphrle::forEachRun(bitmap, glyph->dataLength, width, height,
+                         [&](const uint8_t value, const int runX, const int runY, const int length) {
+                           // Same mapping as below: 0 -> black, 1 -> dark grey, 2 -> light grey
+                           const uint8_t bmpVal = 3 - value;
+                           const int screenX = glyphLeft + runX;
+                           const int screenY = glyphTop + runY;
+                           if (renderMode == BW) {
+                             drawLine(screenX, screenY, screenX + length - 1, screenY, pixelState);
+                           } else if ((renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) ||
+                                      (renderMode == GRAYSCALE_LSB && bmpVal == 1)) {
+                             drawLine(screenX, screenY, screenX + length - 1, screenY, false);
+                           }
+                         });
+  } else if (bitmap != nullptr) {
     for (int glyphY = 0; glyphY < height; glyphY++) {
       const int screenY = *y - glyph->top + glyphY;
       for (int glyphX = 0; glyphX < width; glyphX++) {
@@ -807,7 +1286,7 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
           // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
           // we swap this to better match the way images and screen think about colors:
           // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
-          const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
+          const uint8_t bmpVal = 3 - ((byte >> bit_index) & 0x3);
 
           if (renderMode == BW && bmpVal < 3) {
             // Black (also paints over the grays in BW mode)
@@ -836,7 +1315,12 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
 }
 
 void GfxRenderer::getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const {
-  switch (orientation) {
+  getOrientedViewableTRBL(orientation, outTop, outRight, outBottom, outLeft);
+}
+
+void GfxRenderer::getOrientedViewableTRBL(const Orientation o, int* outTop, int* outRight, int* outBottom,
+                                          int* outLeft) {
+  switch (o) {
     case Portrait:
       *outTop = VIEWABLE_MARGIN_TOP;
       *outRight = VIEWABLE_MARGIN_RIGHT;
@@ -2,8 +2,13 @@
 
 #include <EInkDisplay.h>
 #include <EpdFontFamily.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
 
+#include <atomic>
 #include <map>
+#include <vector>
 
 #include "Bitmap.h"
 
@@ -19,25 +24,79 @@ class GfxRenderer {
     LandscapeCounterClockwise  // 800x480 logical coordinates, native panel orientation
   };
 
+  // A rectangle in logical or panel coordinates, empty when width or height is 0
+  struct Rect {
+    int x;
+    int y;
+    int width;
+    int height;
+  };
+
+  // Completion handle of displayBufferAsync()
+  class PresentHandle {
+   public:
+    bool isDone() const;
+    void wait() const;
+
+   private:
+    friend class GfxRenderer;
+    const GfxRenderer* renderer = nullptr;
+    uint32_t sequence = 0;
+  };
+
  private:
   static constexpr size_t BW_BUFFER_CHUNK_SIZE = 8000;  // 8KB chunks to allow for non-contiguous memory
   static constexpr size_t BW_BUFFER_NUM_CHUNKS = EInkDisplay::BUFFER_SIZE / BW_BUFFER_CHUNK_SIZE;
   static_assert(BW_BUFFER_CHUNK_SIZE * BW_BUFFER_NUM_CHUNKS == EInkDisplay::BUFFER_SIZE,
                 "BW buffer chunking does not line up with display buffer size");
+  // present() refreshes the whole panel once the dirty rect covers more than this share of it
+  static constexpr int WINDOWED_REFRESH_MAX_PERCENT = 50;
+  static constexpr int BW_BUFFER_ROWS_PER_CHUNK = BW_BUFFER_CHUNK_SIZE / EInkDisplay::DISPLAY_WIDTH_BYTES;
+  static_assert(BW_BUFFER_ROWS_PER_CHUNK * EInkDisplay::DISPLAY_WIDTH_BYTES == BW_BUFFER_CHUNK_SIZE,
+                "BW buffer chunks have to hold whole panel rows to be drawn into");
+  // The display task only waits on the panel, it needs little stack
+  static constexpr uint32_t DISPLAY_TASK_STACK_SIZE = 2048;
 
   EInkDisplay& einkDisplay;
   RenderMode renderMode;
   Orientation orientation;
   uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
+  // Draw calls go to bwBufferChunks instead of the frame buffer, see beginBackBufferRender()
+  bool backBufferActive = false;
   std::map<int, EpdFontFamily> fontMap;
+  // Asynchronous refresh: the display task runs one refresh at a time and gives displayDone after each
+  TaskHandle_t displayTaskHandle = nullptr;
+  SemaphoreHandle_t displayDone = nullptr;
+  EInkDisplay::RefreshMode asyncRefreshMode = EInkDisplay::FAST_REFRESH;
+  mutable std::atomic<bool> displayBusy{false};
+  // Set by displayBufferAsync() and cleared by waitForDisplay(), both on the render task: draw calls test this instead
+  // of displayBusy, which is then loaded once per frame rather than once per pixel
+  mutable bool frameLent = false;
+  uint32_t startedRefreshes = 0;
+  std::atomic<uint32_t> completedRefreshes{0};
+  // Union of everything drawn since the last refresh, in panel coordinates
+  mutable Rect dirtyRect = {0, 0, 0, 0};
+  void markPanelDirty(int x, int y, int width, int height) const;
+  void displayPanelWindow(const Rect& panel) const;
+  // Span fill in panel coordinates, clipped: a memset per row with masks for the partial edge bytes
+  void fillPanelRect(int x, int y, int width, int height, bool state) const;
+  static Rect clipToPanel(Rect panel);
   void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, const int* y, bool pixelState,
                   EpdFontFamily::Style style) const;
+  bool allocateBwBufferChunks();
   void freeBwBufferChunks();
   void rotateCoordinates(int x, int y, int* rotatedX, int* rotatedY) const;
+  // Row of the current draw target, waits for a refresh in progress the first time that is the frame buffer
+  uint8_t* frameRow(int panelY) const;
+  static void displayTaskTrampoline(void* param);
+  [[noreturn]] void displayTaskLoop();
 
  public:
   explicit GfxRenderer(EInkDisplay& einkDisplay) : einkDisplay(einkDisplay), renderMode(BW), orientation(Portrait) {}
-  ~GfxRenderer() { freeBwBufferChunks(); }
+  ~GfxRenderer() {
+    waitForDisplay();
+    freeBwBufferChunks();
+  }
 
   static constexpr int VIEWABLE_MARGIN_TOP = 9;
   static constexpr int VIEWABLE_MARGIN_RIGHT = 3;
@@ -54,12 +113,36 @@ class GfxRenderer {
   // Screen ops
   int getScreenWidth() const;
   int getScreenHeight() const;
+  // Logical dimensions for an arbitrary orientation, without switching the renderer
+  static int getScreenWidth(Orientation o);
+  static int getScreenHeight(Orientation o);
   void displayBuffer(EInkDisplay::RefreshMode refreshMode = EInkDisplay::FAST_REFRESH) const;
-  // EXPERIMENTAL: Windowed update - display only a rectangular region
+  // Refreshes what was drawn since the last refresh: a window around the dirty rect while it covers at most
+  // WINDOWED_REFRESH_MAX_PERCENT of the panel, the whole panel in refreshMode otherwise. Nothing drawn, no refresh.
+  void present(EInkDisplay::RefreshMode refreshMode = EInkDisplay::FAST_REFRESH) const;
+  // Windowed update - display only a rectangular region
   void displayWindow(int x, int y, int width, int height) const;
+  // Starts refreshing the frame on the display task and returns while the SPI transfer and the waveform run. Until it
+  // completes the frame buffer belongs to the refresh: anything writing to it waits first, draw calls between
+  // beginBackBufferRender() and swapBackBuffer() do not. Falls back to displayBuffer() without a display task.
+  // The SD card shares the panel's SPI bus, callers keep off the card until the handle is done.
+  PresentHandle displayBufferAsync(EInkDisplay::RefreshMode refreshMode = EInkDisplay::FAST_REFRESH);
+  void waitForDisplay() const;
   void invertScreen() const;
   void clearScreen(uint8_t color = 0xFF) const;
 
+  // Dirty tracking, every draw call extends the dirty rect and displayBuffer()/present() clear it
+  Rect getDirtyRect() const { return dirtyRect; }  // Panel coordinates
+  Rect toPanelRect(const Rect& logical) const;
+  Rect toLogicalRect(const Rect& panel) const;
+  // For code writing to the frame buffer directly, getFrameBuffer() marks the whole screen
+  void markDirty(int x, int y, int width, int height) const;
+
+  // Copies the pixels of a logical rect out of the draw target, for layers drawn once and put back on later frames.
+  // Valid for restoreRegion() with the same rect and orientation.
+  bool saveRegion(const Rect& logical, std::vector<uint8_t>& out) const;
+  void restoreRegion(const Rect& logical, const std::vector<uint8_t>& saved) const;
+
   // Drawing
   void drawPixel(int x, int y, bool state = true) const;
   void drawLine(int x1, int y1, int x2, int y2, bool state = true) const;
@@ -80,8 +163,15 @@ class GfxRenderer {
   int getSpaceWidth(int fontId) const;
   int getFontAscenderSize(int fontId) const;
   int getLineHeight(int fontId) const;
+  // True when a style of the font pages its glyphs in from an SD font pack
+  bool isPackFont(int fontId) const;
+  // text if it fits in maxWidth, otherwise the longest prefix that fits followed by "..."
   std::string truncatedText(int fontId, const char* text, int maxWidth,
                             EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  // Bytes of text to keep so that they and "..." fit in maxWidth, all of it when text fits as is. One pass over the
+  // glyphs that stops where the text overflows, so long titles cost no more than the part that is shown.
+  size_t getTruncationLength(int fontId, const char* text, int maxWidth,
+                             EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
 
   // UI Components
   void drawButtonHints(int fontId, const char* btn1, const char* btn2, const char* btn3, const char* btn4);
@@ -101,11 +191,18 @@ class GfxRenderer {
   void displayGrayBuffer() const;
   bool storeBwBuffer();    // Returns true if buffer was stored successfully
   void restoreBwBuffer();  // Restore and free the stored buffer
+  // Double buffering in the stored BW buffer's memory: draw calls go to a copy of the current frame, so the next frame
+  // can be drawn while displayBufferAsync() runs. Returns false if the memory is taken or cannot be allocated.
+  bool beginBackBufferRender();
+  // Waits for the display and swaps: the frame buffer gets what was drawn since beginBackBufferRender(), the stored
+  // BW buffer the frame that was on it, as storeBwBuffer() would have left it for restoreBwBuffer()
+  void swapBackBuffer();
   void cleanupGrayscaleWithFrameBuffer() const;
 
   // Low level functions
-  uint8_t* getFrameBuffer() const;
+  uint8_t* getFrameBuffer() const;  // Waits for the display, not for use between beginBackBufferRender() and swap
   static size_t getBufferSize();
   void grayscaleRevert() const;
   void getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const;
+  static void getOrientedViewableTRBL(Orientation o, int* outTop, int* outRight, int* outBottom, int* outLeft);
 };
@@ -0,0 +1,107 @@
+#include "HeapStats.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+#include <freertos/FreeRTOS.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace heapstats {
+namespace {
+// Room for the pipeline stages and the enter/exit/freed marks of the activities a session usually visits (64 bytes
+// each). Every activity of the firmware would take about 100, when the table is full the entry marked least recently
+// makes room.
+constexpr size_t MAX_STAGES = 64;
+
+StageStats stages[MAX_STAGES];
+size_t stageCount = 0;
+uint32_t evicted = 0;
+// Orders the entries by their last mark, millis() can repeat within a burst of marks
+uint32_t markSequence = 0;
+uint32_t lastMarks[MAX_STAGES];
+portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+void copyName(char* dest, const size_t size, const char* src) {
+  strncpy(dest, src, size - 1);
+  dest[size - 1] = '\0';
+}
+
+// Called with the lock held, evicts the least recently marked entry when the table is full
+StageStats& findOrAdd(const char* scope, const char* stage) {
+  for (size_t i = 0; i < stageCount; i++) {
+    if (strncmp(stages[i].scope, scope, sizeof(stages[i].scope) - 1) == 0 &&
+        strncmp(stages[i].stage, stage, sizeof(stages[i].stage) - 1) == 0) {
+      lastMarks[i] = ++markSequence;
+      return stages[i];
+    }
+  }
+  size_t index = stageCount;
+  if (stageCount == MAX_STAGES) {
+    index = std::min_element(lastMarks, lastMarks + MAX_STAGES) - lastMarks;
+    evicted++;
+  } else {
+    stageCount++;
+  }
+  StageStats& entry = stages[index];
+  copyName(entry.scope, sizeof(entry.scope), scope);
+  copyName(entry.stage, sizeof(entry.stage), stage);
+  entry.count = 0;
+  entry.lowestFree = UINT32_MAX;
+  entry.lowestLargestBlock = UINT32_MAX;
+  lastMarks[index] = ++markSequence;
+  return entry;
+}
+}  // namespace
+
+uint8_t Sample::getFragmentationPercent() const {
+  if (freeHeap == 0 || largestBlock >= freeHeap) {
+    return 0;
+  }
+  return static_cast<uint8_t>(100 - static_cast<uint64_t>(largestBlock) * 100 / freeHeap);
+}
+
+Sample sample() {
+  // Not under the lock, the heap functions take the allocator's own lock
+  return {ESP.getFreeHeap(), ESP.getMaxAllocHeap(), ESP.getMinFreeHeap()};
+}
+
+void mark(const char* scope, const char* stage) {
+  const Sample now = sample();
+  const uint32_t nowMs = millis();
+
+  portENTER_CRITICAL(&lock);
+  StageStats& entry = findOrAdd(scope, stage);
+  entry.count++;
+  entry.lastMs = nowMs;
+  entry.last = now;
+  entry.lowestFree = std::min(entry.lowestFree, now.freeHeap);
+  entry.lowestLargestBlock = std::min(entry.lowestLargestBlock, now.largestBlock);
+  portEXIT_CRITICAL(&lock);
+
+  LOG_DBG("HEAP", "%s/%s: free %u, largest %u (%u%% fragmented), min free %u\n", scope, stage, now.freeHeap,
+          now.largestBlock, now.getFragmentationPercent(), now.minFreeHeap);
+}
+
+size_t getStageCount() { return stageCount; }
+
+bool getStage(const size_t index, StageStats& out) {
+  portENTER_CRITICAL(&lock);
+  const bool found = index < stageCount;
+  if (found) {
+    out = stages[index];
+  }
+  portEXIT_CRITICAL(&lock);
+  return found;
+}
+
+uint32_t getEvictedCount() { return evicted; }
+
+void reset() {
+  portENTER_CRITICAL(&lock);
+  stageCount = 0;
+  evicted = 0;
+  portEXIT_CRITICAL(&lock);
+}
+
+}  // namespace heapstats
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Heap telemetry. mark() samples the free heap, the largest free block and the lowest free heap since boot, and keeps
+// the lowest values seen for each (scope, stage) pair, e.g. ("Home", "enter") or ("section", "parse").
+// Allocations on this device fail from fragmentation far more often than from running out, the gap between free heap
+// and largest block is the number to watch. Shown by the heap diagnostics screen and /api/heap.
+namespace heapstats {
+
+struct Sample {
+  uint32_t freeHeap;
+  uint32_t largestBlock;
+  uint32_t minFreeHeap;
+
+  // Share of the free heap a single allocation cannot use, 0-100
+  uint8_t getFragmentationPercent() const;
+};
+
+struct StageStats {
+  char scope[24];
+  char stage[12];
+  uint32_t count;
+  uint32_t lastMs;
+  Sample last;
+  uint32_t lowestFree;
+  uint32_t lowestLargestBlock;
+};
+
+Sample sample();
+// Scope and stage are copied, activity names may be passed
+void mark(const char* scope, const char* stage);
+size_t getStageCount();
+// Copies the stage out, false if the index is out of range
+bool getStage(size_t index, StageStats& out);
+// Pairs evicted to make room once the table filled up, a pair marked again after that starts over
+uint32_t getEvictedCount();
+void reset();
+
+}  // namespace heapstats
@@ -1,6 +1,7 @@
 #include "JpegToBmpConverter.h"
 
-#include <HardwareSerial.h>
+#include <HeapStats.h>
+#include <Logging.h>
 #include <SdFat.h>
 #include <picojpeg.h>
 
@@ -29,6 +30,10 @@ constexpr bool USE_NOISE_DITHERING = false;  // Hash-based noise dithering (good
 constexpr bool USE_PRESCALE = true;     // true: scale image to target size before dithering
 constexpr int TARGET_MAX_WIDTH = 480;   // Max width for cover images (portrait display width)
 constexpr int TARGET_MAX_HEIGHT = 800;  // Max height for cover images (portrait display height)
+// Reduced decode: when the output is at most 1/8 of the source in both axes, decode only the DC coefficient of each
+// 8x8 block (picojpeg "reduce" mode). This skips AC dequantization, IDCT and chroma upsampling entirely, and the block
+// average it yields is exactly what the box filter below would have computed anyway.
+constexpr bool USE_REDUCED_DECODE = true;
 // ============================================================================
 
 inline void write16(Print& out, const uint16_t value) {
@@ -201,34 +206,30 @@ unsigned char JpegToBmpConverter::jpegReadCallback(unsigned char* pBuf, const un
 // Internal implementation with configurable target size and bit depth
 bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bmpOut, int targetWidth, int targetHeight,
                                                      bool oneBit, bool crop) {
-  Serial.printf("[%lu] [JPG] Converting JPEG to %s BMP (target: %dx%d)\n", millis(), oneBit ? "1-bit" : "2-bit",
-                targetWidth, targetHeight);
+  LOG_INF("JPG", "Converting JPEG to %s BMP (target: %dx%d)\n", oneBit ? "1-bit" : "2-bit", targetWidth, targetHeight);
+
+  // Remember where the JPEG starts so we can restart the decoder in reduced mode
+  const size_t jpegStartPos = jpegFile.position();
 
   // Setup context for picojpeg callback
-  JpegReadContext context = {.file = jpegFile, .bufferPos = 0, .bufferFilled = 0};
+  JpegReadContext context = {.file = jpegFile, .buffer = {}, .bufferPos = 0, .bufferFilled = 0};
 
   // Initialize picojpeg decoder
   pjpeg_image_info_t imageInfo;
-  const unsigned char status = pjpeg_decode_init(&imageInfo, jpegReadCallback, &context, 0);
+  unsigned char status = pjpeg_decode_init(&imageInfo, jpegReadCallback, &context, 0);
   if (status != 0) {
-    Serial.printf("[%lu] [JPG] JPEG decode init failed with error code: %d\n", millis(), status);
+    LOG_ERR("JPG", "JPEG decode init failed with error code: %d\n", status);
     return false;
   }
 
-  Serial.printf("[%lu] [JPG] JPEG dimensions: %dx%d, components: %d, MCUs: %dx%d\n", millis(), imageInfo.m_width,
-                imageInfo.m_height, imageInfo.m_comps, imageInfo.m_MCUSPerRow, imageInfo.m_MCUSPerCol);
+  LOG_DBG("JPG", "JPEG dimensions: %dx%d, components: %d, MCUs: %dx%d\n", imageInfo.m_width, imageInfo.m_height,
+          imageInfo.m_comps, imageInfo.m_MCUSPerRow, imageInfo.m_MCUSPerCol);
 
-  // Safety limits to prevent memory issues on ESP32
+  // Safety limits to prevent memory issues on ESP32 (applied to the decoded size, see below)
   constexpr int MAX_IMAGE_WIDTH = 2048;
   constexpr int MAX_IMAGE_HEIGHT = 3072;
   constexpr int MAX_MCU_ROW_BYTES = 65536;
 
-  if (imageInfo.m_width > MAX_IMAGE_WIDTH || imageInfo.m_height > MAX_IMAGE_HEIGHT) {
-    Serial.printf("[%lu] [JPG] Image too large (%dx%d), max supported: %dx%d\n", millis(), imageInfo.m_width,
-                  imageInfo.m_height, MAX_IMAGE_WIDTH, MAX_IMAGE_HEIGHT);
-    return false;
-  }
-
   // Calculate output dimensions (pre-scale to fit display exactly)
   int outWidth = imageInfo.m_width;
   int outHeight = imageInfo.m_height;
@@ -262,8 +263,39 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
     scaleY_fp = (static_cast<uint32_t>(imageInfo.m_height) << 16) / outHeight;
     needsScaling = true;
 
-    Serial.printf("[%lu] [JPG] Pre-scaling %dx%d -> %dx%d (fit to %dx%d)\n", millis(), imageInfo.m_width,
-                  imageInfo.m_height, outWidth, outHeight, targetWidth, targetHeight);
+    LOG_DBG("JPG", "Pre-scaling %dx%d -> %dx%d (fit to %dx%d)\n", imageInfo.m_width, imageInfo.m_height, outWidth,
+            outHeight, targetWidth, targetHeight);
+  }
+
+  // Pick the cheapest decode scale: 1/8 (DC only) if every output pixel still covers at least one full 8x8 block,
+  // otherwise full resolution. decodeShift is log2 of the decode scale divisor.
+  int decodeShift = 0;
+  int srcWidth = imageInfo.m_width;
+  int srcHeight = imageInfo.m_height;
+  if (USE_REDUCED_DECODE && needsScaling && (imageInfo.m_width >> 3) >= outWidth &&
+      (imageInfo.m_height >> 3) >= outHeight) {
+    // picojpeg only takes the reduce flag at init, so rewind and restart the decoder (header parsing is cheap)
+    if (jpegFile.seek(jpegStartPos)) {
+      context.bufferPos = 0;
+      context.bufferFilled = 0;
+      status = pjpeg_decode_init(&imageInfo, jpegReadCallback, &context, 1);
+      if (status != 0) {
+        LOG_ERR("JPG", "JPEG reduced decode init failed with error code: %d\n", status);
+        return false;
+      }
+      decodeShift = 3;
+      srcWidth = (imageInfo.m_width + 7) >> 3;
+      srcHeight = (imageInfo.m_height + 7) >> 3;
+      scaleX_fp = (static_cast<uint32_t>(srcWidth) << 16) / outWidth;
+      scaleY_fp = (static_cast<uint32_t>(srcHeight) << 16) / outHeight;
+      LOG_DBG("JPG", "Using 1/8 reduced decode (%dx%d)\n", srcWidth, srcHeight);
+    }
+  }
+
+  if (srcWidth > MAX_IMAGE_WIDTH || srcHeight > MAX_IMAGE_HEIGHT) {
+    LOG_ERR("JPG", "Image too large (%dx%d), max supported: %dx%d\n", srcWidth, srcHeight, MAX_IMAGE_WIDTH,
+            MAX_IMAGE_HEIGHT);
+    return false;
   }
 
   // Write BMP header with output dimensions
@@ -279,29 +311,31 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
     bytesPerRow = (outWidth * 2 + 31) / 32 * 4;
   }
 
+  // Everything below is allocated per image, this is where fragmentation bites
+  heapstats::mark("jpeg", "allocate");
+
   // Allocate row buffer
   auto* rowBuffer = static_cast<uint8_t*>(malloc(bytesPerRow));
   if (!rowBuffer) {
-    Serial.printf("[%lu] [JPG] Failed to allocate row buffer\n", millis());
+    LOG_ERR("JPG", "Failed to allocate row buffer\n");
     return false;
   }
 
-  // Allocate a buffer for one MCU row worth of grayscale pixels
+  // Allocate a buffer for one MCU row worth of grayscale pixels (at decode scale)
   // This is the minimal memory needed for streaming conversion
-  const int mcuPixelHeight = imageInfo.m_MCUHeight;
-  const int mcuRowPixels = imageInfo.m_width * mcuPixelHeight;
+  const int mcuPixelHeight = imageInfo.m_MCUHeight >> decodeShift;
+  const int mcuRowPixels = srcWidth * mcuPixelHeight;
 
   // Validate MCU row buffer size before allocation
   if (mcuRowPixels > MAX_MCU_ROW_BYTES) {
-    Serial.printf("[%lu] [JPG] MCU row buffer too large (%d bytes), max: %d\n", millis(), mcuRowPixels,
-                  MAX_MCU_ROW_BYTES);
+    LOG_ERR("JPG", "MCU row buffer too large (%d bytes), max: %d\n", mcuRowPixels, MAX_MCU_ROW_BYTES);
     free(rowBuffer);
     return false;
   }
 
   auto* mcuRowBuffer = static_cast<uint8_t*>(malloc(mcuRowPixels));
   if (!mcuRowBuffer) {
-    Serial.printf("[%lu] [JPG] Failed to allocate MCU row buffer (%d bytes)\n", millis(), mcuRowPixels);
+    LOG_ERR("JPG", "Failed to allocate MCU row buffer (%d bytes)\n", mcuRowPixels);
     free(rowBuffer);
     return false;
   }
@@ -336,9 +370,11 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
     rowCount = new uint16_t[outWidth]();
     nextOutY_srcStart = scaleY_fp;  // First boundary is at scaleY_fp (source Y for outY=1)
   }
+  heapstats::mark("jpeg", "decode");
 
   // Process MCUs row-by-row and write to BMP as we go (top-down)
-  const int mcuPixelWidth = imageInfo.m_MCUWidth;
+  const int mcuPixelWidth = imageInfo.m_MCUWidth >> decodeShift;
+  const int blocksPerRow = imageInfo.m_MCUWidth / 8;
 
   for (int mcuY = 0; mcuY < imageInfo.m_MCUSPerCol; mcuY++) {
     // Clear the MCU row buffer
@@ -349,10 +385,9 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
       const unsigned char mcuStatus = pjpeg_decode_mcu();
       if (mcuStatus != 0) {
         if (mcuStatus == PJPG_NO_MORE_BLOCKS) {
-          Serial.printf("[%lu] [JPG] Unexpected end of blocks at MCU (%d, %d)\n", millis(), mcuX, mcuY);
+          LOG_INF("JPG", "Unexpected end of blocks at MCU (%d, %d)\n", mcuX, mcuY);
         } else {
-          Serial.printf("[%lu] [JPG] JPEG decode MCU failed at (%d, %d) with error code: %d\n", millis(), mcuX, mcuY,
-                        mcuStatus);
+          LOG_ERR("JPG", "JPEG decode MCU failed at (%d, %d) with error code: %d\n", mcuX, mcuY, mcuStatus);
         }
         free(mcuRowBuffer);
         free(rowBuffer);
@@ -361,17 +396,19 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
 
       // picojpeg stores MCU data in 8x8 blocks
       // Block layout: H2V2(16x16)=0,64,128,192 H2V1(16x8)=0,64 H1V2(8x16)=0,128
+      // In reduced mode only the first pixel of each block is valid, so map back to full-scale MCU coordinates
       for (int blockY = 0; blockY < mcuPixelHeight; blockY++) {
         for (int blockX = 0; blockX < mcuPixelWidth; blockX++) {
           const int pixelX = mcuX * mcuPixelWidth + blockX;
-          if (pixelX >= imageInfo.m_width) continue;
+          if (pixelX >= srcWidth) continue;
 
           // Calculate proper block offset for picojpeg buffer
-          const int blockCol = blockX / 8;
-          const int blockRow = blockY / 8;
-          const int localX = blockX % 8;
-          const int localY = blockY % 8;
-          const int blocksPerRow = mcuPixelWidth / 8;
+          const int mcuLocalX = blockX << decodeShift;
+          const int mcuLocalY = blockY << decodeShift;
+          const int blockCol = mcuLocalX / 8;
+          const int blockRow = mcuLocalY / 8;
+          const int localX = mcuLocalX % 8;
+          const int localY = mcuLocalY % 8;
           const int blockIndex = blockRow * blocksPerRow + blockCol;
           const int pixelOffset = blockIndex * 64 + localY * 8 + localX;
 
@@ -385,7 +422,7 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
             gray = (r * 25 + g * 50 + b * 25) / 100;
           }
 
-          mcuRowBuffer[blockY * imageInfo.m_width + pixelX] = gray;
+          mcuRowBuffer[blockY * srcWidth + pixelX] = gray;
         }
       }
     }
@@ -394,7 +431,7 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
     const int startRow = mcuY * mcuPixelHeight;
     const int endRow = (mcuY + 1) * mcuPixelHeight;
 
-    for (int y = startRow; y < endRow && y < imageInfo.m_height; y++) {
+    for (int y = startRow; y < endRow && y < srcHeight; y++) {
       const int bufferY = y - startRow;
 
       if (!needsScaling) {
@@ -403,13 +440,13 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
 
         if (USE_8BIT_OUTPUT && !oneBit) {
           for (int x = 0; x < outWidth; x++) {
-            const uint8_t gray = mcuRowBuffer[bufferY * imageInfo.m_width + x];
+            const uint8_t gray = mcuRowBuffer[bufferY * srcWidth + x];
             rowBuffer[x] = adjustPixel(gray);
           }
         } else if (oneBit) {
           // 1-bit output with Atkinson dithering for better quality
           for (int x = 0; x < outWidth; x++) {
-            const uint8_t gray = mcuRowBuffer[bufferY * imageInfo.m_width + x];
+            const uint8_t gray = mcuRowBuffer[bufferY * srcWidth + x];
             const uint8_t bit =
                 atkinson1BitDitherer ? atkinson1BitDitherer->processPixel(gray, x) : quantize1bit(gray, x, y);
             // Pack 1-bit value: MSB first, 8 pixels per byte
@@ -421,7 +458,7 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
         } else {
           // 2-bit output
           for (int x = 0; x < outWidth; x++) {
-            const uint8_t gray = adjustPixel(mcuRowBuffer[bufferY * imageInfo.m_width + x]);
+            const uint8_t gray = adjustPixel(mcuRowBuffer[bufferY * srcWidth + x]);
             uint8_t twoBit;
             if (atkinsonDitherer) {
               twoBit = atkinsonDitherer->processPixel(gray, x);
@@ -444,7 +481,7 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
         // Fixed-point area averaging for exact fit scaling
         // For each output pixel X, accumulate source pixels that map to it
         // srcX range for outX: [outX * scaleX_fp >> 16, (outX+1) * scaleX_fp >> 16)
-        const uint8_t* srcRow = mcuRowBuffer + bufferY * imageInfo.m_width;
+        const uint8_t* srcRow = mcuRowBuffer + bufferY * srcWidth;
 
         for (int outX = 0; outX < outWidth; outX++) {
           // Calculate source X range for this output pixel
@@ -454,13 +491,13 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
           // Accumulate all source pixels in this range
           int sum = 0;
           int count = 0;
-          for (int srcX = srcXStart; srcX < srcXEnd && srcX < imageInfo.m_width; srcX++) {
+          for (int srcX = srcXStart; srcX < srcXEnd && srcX < srcWidth; srcX++) {
             sum += srcRow[srcX];
             count++;
           }
 
           // Handle edge case: if no pixels in range, use nearest
-          if (count == 0 && srcXStart < imageInfo.m_width) {
+          if (count == 0 && srcXStart < srcWidth) {
             sum = srcRow[srcXStart];
             count = 1;
           }
@@ -548,8 +585,9 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
   }
   free(mcuRowBuffer);
   free(rowBuffer);
+  heapstats::mark("jpeg", "done");
 
-  Serial.printf("[%lu] [JPG] Successfully converted JPEG to BMP\n", millis());
+  LOG_INF("JPG", "Successfully converted JPEG to BMP\n");
   return true;
 }
 
@@ -0,0 +1,90 @@
+#pragma once
+#include <Arduino.h>
+#include <HardwareSerial.h>
+
+// Logging facade. LOG_ERR/LOG_WRN/LOG_INF/LOG_DBG print "[millis] [TAG] message" like the rest of the firmware, with
+// two filters in front of the formatting:
+//  - Compile time: messages above LOG_LEVEL, or above the module's entry in LOG_MODULE_LEVELS, are discarded by
+//    `if constexpr` and cost nothing, not even the evaluation of their arguments.
+//  - Run time: nothing is formatted while the sink is disabled, main enables it only when USB is connected.
+//
+// Levels can be set per build environment, e.g. in platformio.ini:
+//   -DLOG_LEVEL=LOG_LEVEL_DEBUG
+//   -DLOG_MODULE_LEVELS='{"EHP", LOG_LEVEL_DEBUG}, {"WEB", LOG_LEVEL_WARN},'
+// Module entries may raise or lower the level of one tag.
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#ifndef LOG_MODULE_LEVELS
+#define LOG_MODULE_LEVELS
+#endif
+
+namespace logging {
+
+struct ModuleLevel {
+  const char* tag;
+  int level;
+};
+
+// Terminated by an entry without a tag so the list may be empty
+constexpr ModuleLevel MODULE_LEVELS[] = {LOG_MODULE_LEVELS{nullptr, LOG_LEVEL_NONE}};
+
+namespace detail {
+constexpr bool tagEquals(const char* a, const char* b) {
+  while (*a != '\0' && *a == *b) {
+    a++;
+    b++;
+  }
+  return *a == *b;
+}
+}  // namespace detail
+
+constexpr int levelFor(const char* tag) {
+  for (const auto& module : MODULE_LEVELS) {
+    if (module.tag != nullptr && detail::tagEquals(module.tag, tag)) {
+      return module.level;
+    }
+  }
+  return LOG_LEVEL;
+}
+
+constexpr bool isCompiledIn(const int level, const char* tag) { return level <= levelFor(tag); }
+
+inline bool sinkEnabled = true;
+
+// Off while nobody can read the output, e.g. no USB host is attached
+inline void setSinkEnabled(const bool enabled) { sinkEnabled = enabled; }
+inline bool isSinkEnabled() { return sinkEnabled; }
+
+}  // namespace logging
+
+#define LOG_AT(level, tag, format, ...)                                    \
+  do {                                                                     \
+    if constexpr (logging::isCompiledIn(level, tag)) {                     \
+      if (logging::isSinkEnabled()) {                                      \
+        Serial.printf("[%lu] [" tag "] " format, millis(), ##__VA_ARGS__); \
+      }                                                                    \
+    }                                                                      \
+  } while (0)
+
+// For tags only known at run time (e.g. passed in by the caller), only LOG_LEVEL applies
+#define LOG_AT_TAG(level, tag, format, ...)                                \
+  do {                                                                     \
+    if constexpr ((level) <= LOG_LEVEL) {                                  \
+      if (logging::isSinkEnabled()) {                                      \
+        Serial.printf("[%lu] [%s] " format, millis(), tag, ##__VA_ARGS__); \
+      }                                                                    \
+    }                                                                      \
+  } while (0)
+
+#define LOG_ERR(tag, format, ...) LOG_AT(LOG_LEVEL_ERROR, tag, format, ##__VA_ARGS__)
+#define LOG_WRN(tag, format, ...) LOG_AT(LOG_LEVEL_WARN, tag, format, ##__VA_ARGS__)
+#define LOG_INF(tag, format, ...) LOG_AT(LOG_LEVEL_INFO, tag, format, ##__VA_ARGS__)
+#define LOG_DBG(tag, format, ...) LOG_AT(LOG_LEVEL_DEBUG, tag, format, ##__VA_ARGS__)
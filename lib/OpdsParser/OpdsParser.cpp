@@ -1,26 +1,14 @@
 #include "OpdsParser.h"
 
-#include <HardwareSerial.h>
-
 #include <cstring>
 
 OpdsParser::OpdsParser() {
-  parser = XML_ParserCreate(nullptr);
-  if (!parser) {
+  if (!xml.begin("OPDS", this, startElement, endElement, characterData)) {
     errorOccured = true;
-    Serial.printf("[%lu] [OPDS] Couldn't allocate memory for parser\n", millis());
   }
 }
 
-OpdsParser::~OpdsParser() {
-  if (parser) {
-    XML_StopParser(parser, XML_FALSE);
-    XML_SetElementHandler(parser, nullptr, nullptr);
-    XML_SetCharacterDataHandler(parser, nullptr);
-    XML_ParserFree(parser);
-    parser = nullptr;
-  }
-}
+OpdsParser::~OpdsParser() { xml.end(); }
 
 size_t OpdsParser::write(uint8_t c) { return write(&c, 1); }
 
@@ -29,48 +17,19 @@ size_t OpdsParser::write(const uint8_t* xmlData, const size_t length) {
     return length;
   }
 
-  XML_SetUserData(parser, this);
-  XML_SetElementHandler(parser, startElement, endElement);
-  XML_SetCharacterDataHandler(parser, characterData);
-
-  // Parse in chunks to avoid large buffer allocations
-  const char* currentPos = reinterpret_cast<const char*>(xmlData);
-  size_t remaining = length;
-  constexpr size_t chunkSize = 1024;
-
-  while (remaining > 0) {
-    void* const buf = XML_GetBuffer(parser, chunkSize);
-    if (!buf) {
-      errorOccured = true;
-      Serial.printf("[%lu] [OPDS] Couldn't allocate memory for buffer\n", millis());
-      XML_ParserFree(parser);
-      parser = nullptr;
-      return length;
-    }
-
-    const size_t toRead = remaining < chunkSize ? remaining : chunkSize;
-    memcpy(buf, currentPos, toRead);
-
-    if (XML_ParseBuffer(parser, static_cast<int>(toRead), 0) == XML_STATUS_ERROR) {
-      errorOccured = true;
-      Serial.printf("[%lu] [OPDS] Parse error at line %lu: %s\n", millis(), XML_GetCurrentLineNumber(parser),
-                    XML_ErrorString(XML_GetErrorCode(parser)));
-      XML_ParserFree(parser);
-      parser = nullptr;
-      return length;
-    }
-
-    currentPos += toRead;
-    remaining -= toRead;
+  // The stream hands over network sized chunks, parse them in place
+  if (!xml.feed(xmlData, length, false)) {
+    errorOccured = true;
   }
   return length;
 }
 
 void OpdsParser::flush() {
-  if (XML_Parse(parser, nullptr, 0, XML_TRUE) != XML_STATUS_OK) {
+  if (errorOccured) {
+    return;
+  }
+  if (!xml.finish()) {
     errorOccured = true;
-    XML_ParserFree(parser);
-    parser = nullptr;
   }
 }
 
@@ -1,6 +1,6 @@
 #pragma once
+#include <ExpatDriver.h>
 #include <Print.h>
-#include <expat.h>
 
 #include <string>
 #include <vector>
@@ -88,7 +88,7 @@ class OpdsParser final : public Print {
   // Helper to find attribute value
   static const char* findAttribute(const XML_Char** atts, const char* name);
 
-  XML_Parser parser = nullptr;
+  ExpatDriver xml;
   std::vector<OpdsEntry> entries;
   OpdsEntry currentEntry;
   std::string currentText;
@@ -0,0 +1,196 @@
+#include "Trace.h"
+
+#if CROSSPOINT_TRACE
+#include <Arduino.h>
+#include <HardwareSerial.h>
+#include <Logging.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace trace {
+namespace {
+constexpr uint8_t TRACE_FILE_VERSION = 1;
+constexpr char TRACE_MAGIC[4] = {'C', 'P', 'T', 'R'};
+constexpr size_t CAPACITY = CROSSPOINT_TRACE_EVENTS;
+static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "CROSSPOINT_TRACE_EVENTS must be a power of two");
+// Tasks beyond this share the last slot
+constexpr uint8_t MAX_TASKS = 8;
+constexpr size_t TASK_NAME_LENGTH = 16;
+
+struct Event {
+  uint32_t timestampUs;
+  const char* name;
+  int32_t value;  // Counters only
+  EventType type;
+  uint8_t task;
+};
+
+struct Task {
+  TaskHandle_t handle;
+  char name[TASK_NAME_LENGTH];
+};
+
+Event events[CAPACITY];
+// Total events recorded, the ring slot is the low bits
+uint32_t recorded = 0;
+Task tasks[MAX_TASKS];
+uint8_t taskCount = 0;
+// Set while the buffer is written out, events arriving meanwhile are dropped
+bool paused = false;
+portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Called with the lock held
+uint8_t taskIndex(const TaskHandle_t handle) {
+  for (uint8_t i = 0; i < taskCount; i++) {
+    if (tasks[i].handle == handle) {
+      return i;
+    }
+  }
+  if (taskCount == MAX_TASKS) {
+    return MAX_TASKS - 1;
+  }
+  // Copied now, the task may be gone by the time the trace is written
+  tasks[taskCount].handle = handle;
+  strncpy(tasks[taskCount].name, pcTaskGetName(handle), TASK_NAME_LENGTH - 1);
+  tasks[taskCount].name[TASK_NAME_LENGTH - 1] = '\0';
+  return taskCount++;
+}
+
+uint32_t firstEvent() { return recorded > CAPACITY ? recorded - CAPACITY : 0; }
+
+void setPaused(const bool value) {
+  portENTER_CRITICAL(&lock);
+  paused = value;
+  portEXIT_CRITICAL(&lock);
+}
+
+char typeLetter(const EventType type) {
+  switch (type) {
+    case EventType::Begin:
+      return 'B';
+    case EventType::End:
+      return 'E';
+    case EventType::Counter:
+      return 'C';
+    case EventType::Instant:
+      return 'I';
+  }
+  return '?';
+}
+}  // namespace
+
+void record(const EventType type, const char* name, const int32_t value) {
+  const uint32_t now = micros();
+  const TaskHandle_t task = xTaskGetCurrentTaskHandle();
+
+  portENTER_CRITICAL(&lock);
+  if (!paused) {
+    Event& event = events[recorded & (CAPACITY - 1)];
+    event.timestampUs = now;
+    event.name = name;
+    event.value = value;
+    event.type = type;
+    event.task = taskIndex(task);
+    recorded++;
+  }
+  portEXIT_CRITICAL(&lock);
+}
+
+bool flushToFile(const char* path) {
+  // Make sure the directory exists
+  SdMan.mkdir("/.crosspoint");
+
+  FsFile file;
+  if (!SdMan.openFileForWrite("TRC", path, file)) {
+    return false;
+  }
+
+  setPaused(true);
+  const uint32_t first = firstEvent();
+  const uint32_t count = recorded - first;
+
+  // Names are interned by pointer, the same literal from two translation units only costs a duplicate entry
+  std::vector<const char*> names;
+  std::vector<uint16_t> nameIndices(count);
+  for (uint32_t i = 0; i < count; i++) {
+    const char* name = events[(first + i) & (CAPACITY - 1)].name;
+    size_t index = 0;
+    while (index < names.size() && names[index] != name) {
+      index++;
+    }
+    if (index == names.size()) {
+      names.push_back(name);
+    }
+    nameIndices[i] = static_cast<uint16_t>(index);
+  }
+
+  file.write(reinterpret_cast<const uint8_t*>(TRACE_MAGIC), sizeof(TRACE_MAGIC));
+  serialization::writePod(file, TRACE_FILE_VERSION);
+  serialization::writePod(file, first);  // Events lost to the ring wrapping around
+  serialization::writePod(file, taskCount);
+  for (uint8_t i = 0; i < taskCount; i++) {
+    serialization::writeString(file, std::string(tasks[i].name));
+  }
+  const auto nameCount = static_cast<uint16_t>(names.size());
+  serialization::writePod(file, nameCount);
+  for (const char* name : names) {
+    serialization::writeString(file, std::string(name));
+  }
+  serialization::writePod(file, count);
+  for (uint32_t i = 0; i < count; i++) {
+    const Event& event = events[(first + i) & (CAPACITY - 1)];
+    serialization::writePod(file, event.timestampUs);
+    serialization::writePod(file, event.value);
+    serialization::writePod(file, nameIndices[i]);
+    serialization::writePod(file, event.task);
+    serialization::writePod(file, static_cast<uint8_t>(event.type));
+  }
+  setPaused(false);
+
+  file.close();
+  LOG_INF("TRC", "Wrote %u events to %s\n", count, path);
+  return true;
+}
+
+void dumpToSerial() {
+  setPaused(true);
+  const uint32_t first = firstEvent();
+  Serial.printf("[%lu] [TRC] %u events (%u dropped)\n", millis(), recorded - first, first);
+  for (uint32_t i = first; i < recorded; i++) {
+    const Event& event = events[i & (CAPACITY - 1)];
+    Serial.printf("[TRC] %10u us %-16s %c %s", event.timestampUs, tasks[event.task].name, typeLetter(event.type),
+                  event.name);
+    if (event.type == EventType::Counter) {
+      Serial.printf(" = %d", event.value);
+    }
+    Serial.printf("\n");
+  }
+  setPaused(false);
+}
+
+void clear() {
+  portENTER_CRITICAL(&lock);
+  recorded = 0;
+  portEXIT_CRITICAL(&lock);
+}
+
+size_t getEventCount() { return recorded - firstEvent(); }
+
+}  // namespace trace
+
+#else
+
+namespace trace {
+bool flushToFile(const char*) { return false; }
+void dumpToSerial() {}
+void clear() {}
+size_t getEventCount() { return 0; }
+}  // namespace trace
+
+#endif
@@ -0,0 +1,70 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Compile-time gated tracing. With CROSSPOINT_TRACE set (the "trace" environment in platformio.ini) scoped spans,
+// counters and instants are recorded with microsecond timestamps into a fixed RAM ring buffer, the newest
+// CROSSPOINT_TRACE_EVENTS events are kept. Without it the macros compile to nothing, arguments are not evaluated.
+//
+// The buffer can be dumped over serial, written to TRACE_FILE and downloaded from /api/trace.
+// scripts/trace_to_chrome.py converts the file for chrome://tracing or Perfetto.
+#ifndef CROSSPOINT_TRACE
+#define CROSSPOINT_TRACE 0
+#endif
+
+#ifndef CROSSPOINT_TRACE_EVENTS
+#define CROSSPOINT_TRACE_EVENTS 512
+#endif
+
+namespace trace {
+
+enum class EventType : uint8_t { Begin = 0, End = 1, Counter = 2, Instant = 3 };
+
+constexpr char TRACE_FILE[] = "/.crosspoint/trace.bin";
+
+constexpr bool isEnabled() { return CROSSPOINT_TRACE != 0; }
+
+#if CROSSPOINT_TRACE
+// Names must outlive the trace, pass string literals
+void record(EventType type, const char* name, int32_t value = 0);
+
+class Scope {
+ public:
+  explicit Scope(const char* name) : name(name) { record(EventType::Begin, name); }
+  ~Scope() { record(EventType::End, name); }
+
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+
+ private:
+  const char* name;
+};
+#endif
+
+// Write the buffered events to the SD card (format in docs/file-formats.md). False if tracing is compiled out.
+bool flushToFile(const char* path = TRACE_FILE);
+// Print the buffered events, oldest first
+void dumpToSerial();
+void clear();
+// Events currently held in the buffer
+size_t getEventCount();
+
+}  // namespace trace
+
+#if CROSSPOINT_TRACE
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(name) const trace::Scope TRACE_CONCAT(traceScope, __LINE__)(name)
+#define TRACE_COUNTER(name, value) trace::record(trace::EventType::Counter, name, static_cast<int32_t>(value))
+#define TRACE_INSTANT(name) trace::record(trace::EventType::Instant, name)
+#else
+#define TRACE_SCOPE(name) \
+  do {                    \
+  } while (0)
+#define TRACE_COUNTER(name, value) \
+  do {                             \
+  } while (0)
+#define TRACE_INSTANT(name) \
+  do {                      \
+  } while (0)
+#endif
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""Convert a `trace.bin` written by lib/Trace into Chrome trace event JSON (chrome://tracing, ui.perfetto.dev)."""
+
+from __future__ import annotations
+
+import argparse
+import json
+import pathlib
+import struct
+import sys
+
+MAGIC = b'CPTR'
+VERSION = 1
+EVENT_PHASES = {0: 'B', 1: 'E', 2: 'C', 3: 'i'}
+
+
+class Reader:
+    def __init__(self, data: bytes) -> None:
+        self.data = data
+        self.offset = 0
+
+    def unpack(self, fmt: str) -> tuple:
+        values = struct.unpack_from('<' + fmt, self.data, self.offset)
+        self.offset += struct.calcsize('<' + fmt)
+        return values
+
+    def string(self) -> str:
+        (length,) = self.unpack('I')
+        value = self.data[self.offset : self.offset + length].decode('utf-8', errors='replace')
+        self.offset += length
+        return value
+
+
+def convert(data: bytes) -> dict:
+    if data[:4] != MAGIC:
+        raise ValueError('not a CrossPoint trace file')
+    reader = Reader(data)
+    reader.offset = 4
+    (version,) = reader.unpack('B')
+    if version != VERSION:
+        raise ValueError(f'unsupported trace version {version}')
+
+    (dropped,) = reader.unpack('I')
+    (task_count,) = reader.unpack('B')
+    tasks = [reader.string() for _ in range(task_count)]
+    (name_count,) = reader.unpack('H')
+    names = [reader.string() for _ in range(name_count)]
+    (event_count,) = reader.unpack('I')
+
+    events = [
+        {'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': tid, 'args': {'name': name}}
+        for tid, name in enumerate(tasks)
+    ]
+    # micros() wraps after ~71 minutes, keep the timeline monotonic across it
+    wraps = 0
+    previous = None
+    for _ in range(event_count):
+        timestamp, value, name_index, task, event_type = reader.unpack('IiHBB')
+        if previous is not None and timestamp < previous and previous - timestamp > 1 << 31:
+            wraps += 1
+        previous = timestamp
+
+        event = {
+            'name': names[name_index],
+            'ph': EVENT_PHASES.get(event_type, 'i'),
+            'ts': timestamp + (wraps << 32),
+            'pid': 1,
+            'tid': task,
+        }
+        if event['ph'] == 'C':
+            event['args'] = {'value': value}
+        elif event['ph'] == 'i':
+            event['s'] = 't'
+        events.append(event)
+
+    return {'traceEvents': events, 'displayTimeUnit': 'ms', 'otherData': {'droppedEvents': dropped}}
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('input', type=pathlib.Path, help='trace.bin from the SD card or /api/trace')
+    parser.add_argument('output', type=pathlib.Path, nargs='?', help='JSON file to write (default: stdout)')
+    args = parser.parse_args()
+
+    try:
+        trace = convert(args.input.read_bytes())
+    except (ValueError, struct.error) as error:
+        print(f'{args.input}: {error}', file=sys.stderr)
+        return 1
+
+    output = json.dumps(trace)
+    if args.output:
+        args.output.write_text(output)
+    else:
+        print(output)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,366 @@
+#include "BookCacheManager.h"
+
+#include <Logging.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include "CrossPointSettings.h"
+
+namespace {
+constexpr uint8_t INDEX_FILE_VERSION = 1;
+constexpr char INDEX_FILE[] = "/.crosspoint/cacheindex.bin";
+// Sanity limit when reading the index back, protects against a corrupt count
+constexpr uint32_t MAX_INDEX_ENTRIES = 10000;
+// Books whose cache directories are never dropped as a whole
+constexpr size_t RECENT_KEEP = 10;
+
+// Cache roots and the directory prefixes books use inside them
+constexpr const char* CACHE_ROOTS[] = {"/.crosspoint", "/cover"};
+constexpr const char* CACHE_PREFIXES[] = {"epub_", "xtc_", "txt_"};
+// Survive trimming: needed to open the book, resume it and show it on the home screen
+constexpr const char* KEEP_FILES[] = {"book.bin", "progress.bin", "thumb.bmp"};
+// Reading positions kept per path, see BookCacheKey::getProgressPath
+constexpr char PROGRESS_PREFIX[] = "progress_";
+
+bool comparePath(const BookCacheManager::Entry& a, const std::string& path) { return a.path < path; }
+
+bool isBookCacheName(const char* name) {
+  return std::any_of(std::begin(CACHE_PREFIXES), std::end(CACHE_PREFIXES),
+                     [name](const char* prefix) { return strncmp(name, prefix, strlen(prefix)) == 0; });
+}
+
+bool isKeptFile(const char* name) {
+  if (strncmp(name, PROGRESS_PREFIX, sizeof(PROGRESS_PREFIX) - 1) == 0) {
+    return true;
+  }
+  return std::any_of(std::begin(KEEP_FILES), std::end(KEEP_FILES),
+                     [name](const char* keep) { return strcmp(name, keep) == 0; });
+}
+}  // namespace
+
+BookCacheManager BookCacheManager::instance;
+
+BookCacheManager::Entry* BookCacheManager::find(const std::string& path) {
+  const auto it = std::lower_bound(entries.begin(), entries.end(), path, comparePath);
+  if (it == entries.end() || it->path != path) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+bool BookCacheManager::isReaderCache(const std::string& path) {
+  // Only the reader cache holds sections and progress, /cover only has grid thumbnails
+  return path.compare(0, strlen(CACHE_ROOTS[0]) + 1, std::string(CACHE_ROOTS[0]) + "/") == 0;
+}
+
+void BookCacheManager::touch(const std::string& cachePath) {
+  Entry* entry = find(cachePath);
+  if (!entry) {
+    Entry newEntry;
+    newEntry.path = cachePath;
+    entries.insert(std::lower_bound(entries.begin(), entries.end(), cachePath, comparePath), std::move(newEntry));
+    entry = find(cachePath);
+  }
+
+  // Reading builds sections again, so the size has to be measured anew
+  entry->lastAccess = ++accessCounter;
+  entry->measured = false;
+  entry->trimmed = false;
+  dirty = true;
+  if (phase == Phase::Idle) {
+    phase = Phase::Measure;
+  }
+}
+
+uint32_t BookCacheManager::directorySize(const std::string& path) {
+  auto dir = SdMan.open(path.c_str());
+  if (!dir || !dir.isDirectory()) {
+    if (dir) dir.close();
+    return 0;
+  }
+
+  uint32_t total = 0;
+  char name[128];
+  while (auto file = dir.openNextFile()) {
+    if (file.isDirectory()) {
+      file.getName(name, sizeof(name));
+      file.close();
+      total += directorySize(path + "/" + name);
+      continue;
+    }
+    total += static_cast<uint32_t>(file.size());
+    file.close();
+  }
+  dir.close();
+  return total;
+}
+
+void BookCacheManager::trimDirectory(const std::string& path) {
+  auto dir = SdMan.open(path.c_str());
+  if (!dir || !dir.isDirectory()) {
+    if (dir) dir.close();
+    return;
+  }
+
+  // Collect first, removing entries while iterating the directory is not safe
+  std::vector<std::pair<std::string, bool>> victims;
+  char name[128];
+  while (auto file = dir.openNextFile()) {
+    file.getName(name, sizeof(name));
+    const bool isDir = file.isDirectory();
+    file.close();
+    if (isDir || !isKeptFile(name)) {
+      victims.emplace_back(path + "/" + name, isDir);
+    }
+  }
+  dir.close();
+
+  for (const auto& victim : victims) {
+    if (victim.second) {
+      SdMan.removeDir(victim.first.c_str());
+    } else {
+      SdMan.remove(victim.first.c_str());
+    }
+  }
+}
+
+void BookCacheManager::discoverStep() {
+  const std::string root = CACHE_ROOTS[discoverRootIndex];
+  const std::string rootPrefix = root + "/";
+
+  std::vector<std::string> found;
+  auto dir = SdMan.open(root.c_str());
+  if (dir && dir.isDirectory()) {
+    char name[128];
+    while (auto file = dir.openNextFile()) {
+      if (file.isDirectory()) {
+        file.getName(name, sizeof(name));
+        if (isBookCacheName(name)) {
+          found.push_back(rootPrefix + name);
+        }
+      }
+      file.close();
+    }
+  }
+  if (dir) dir.close();
+  std::sort(found.begin(), found.end());
+
+  // Drop entries whose directory is gone (e.g. removed by the reader or a cache reset)
+  const size_t before = entries.size();
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [&](const Entry& e) {
+                                 return e.path.compare(0, rootPrefix.size(), rootPrefix) == 0 &&
+                                        e.path.find('/', rootPrefix.size()) == std::string::npos &&
+                                        !std::binary_search(found.begin(), found.end(), e.path);
+                               }),
+                entries.end());
+  if (entries.size() != before) {
+    dirty = true;
+  }
+
+  for (auto& path : found) {
+    if (!find(path)) {
+      Entry entry;
+      entry.path = std::move(path);
+      entries.insert(std::lower_bound(entries.begin(), entries.end(), entry.path, comparePath), std::move(entry));
+      dirty = true;
+    }
+  }
+
+  if (++discoverRootIndex >= std::size(CACHE_ROOTS)) {
+    discoverRootIndex = 0;
+    phase = Phase::Measure;
+  }
+}
+
+void BookCacheManager::measureStep() {
+  const auto it = std::find_if(entries.begin(), entries.end(), [](const Entry& e) { return !e.measured; });
+  if (it == entries.end()) {
+    phase = Phase::Evict;
+    return;
+  }
+
+  it->sizeBytes = directorySize(it->path);
+  it->measured = true;
+  dirty = true;
+}
+
+bool BookCacheManager::isEvictable(const Entry& entry, const bool wholeDirectory) const {
+  if (entry.lastAccess == accessCounter && accessCounter != 0) {
+    // Most recently opened book, possibly open right now
+    return false;
+  }
+  if (!wholeDirectory) {
+    return !entry.trimmed;
+  }
+  if (!isReaderCache(entry.path)) {
+    // Grid thumbnails are tracked by the library catalog, trimming already keeps them small
+    return false;
+  }
+
+  // Keep book.bin and progress of the most recently read books no matter what
+  const auto newer = std::count_if(entries.begin(), entries.end(), [&entry](const Entry& e) {
+    return isReaderCache(e.path) && e.lastAccess > entry.lastAccess;
+  });
+  return static_cast<size_t>(newer) >= RECENT_KEEP;
+}
+
+void BookCacheManager::evictStep() {
+  const uint64_t budget = SETTINGS.getCacheBudgetBytes();
+  const uint64_t total = getTotalSize();
+  if (budget == 0 || total <= budget) {
+    phase = Phase::Idle;
+    saveIfDirty();
+    return;
+  }
+
+  // Least recently used first
+  std::vector<Entry*> order;
+  order.reserve(entries.size());
+  for (auto& entry : entries) {
+    order.push_back(&entry);
+  }
+  std::sort(order.begin(), order.end(), [](const Entry* a, const Entry* b) { return a->lastAccess < b->lastAccess; });
+
+  for (Entry* entry : order) {
+    if (isEvictable(*entry, false)) {
+      LOG_INF("BCM", "Over budget (%lu > %lu KB), trimming %s\n", static_cast<unsigned long>(total / 1024),
+              static_cast<unsigned long>(budget / 1024), entry->path.c_str());
+      trimDirectory(entry->path);
+      entry->trimmed = true;
+      entry->measured = false;
+      dirty = true;
+      phase = Phase::Measure;
+      return;
+    }
+  }
+
+  for (Entry* entry : order) {
+    if (isEvictable(*entry, true)) {
+      LOG_INF("BCM", "Over budget (%lu > %lu KB), dropping %s\n", static_cast<unsigned long>(total / 1024),
+              static_cast<unsigned long>(budget / 1024), entry->path.c_str());
+      SdMan.removeDir(entry->path.c_str());
+      entries.erase(entries.begin() + (entry - entries.data()));
+      dirty = true;
+      return;
+    }
+  }
+
+  LOG_INF("BCM", "Over budget (%lu > %lu KB) but nothing left to evict\n", static_cast<unsigned long>(total / 1024),
+          static_cast<unsigned long>(budget / 1024));
+  phase = Phase::Idle;
+  saveIfDirty();
+}
+
+bool BookCacheManager::step() {
+  switch (phase) {
+    case Phase::Discover:
+      discoverStep();
+      return true;
+    case Phase::Measure:
+      measureStep();
+      return true;
+    case Phase::Evict:
+      evictStep();
+      return true;
+    case Phase::Idle:
+      break;
+  }
+  return false;
+}
+
+void BookCacheManager::runFor(const unsigned long budgetMs) {
+  const unsigned long start = millis();
+  while (millis() - start < budgetMs && step()) {
+  }
+  saveIfDirty();
+}
+
+uint64_t BookCacheManager::getTotalSize() const {
+  uint64_t total = 0;
+  for (const auto& entry : entries) {
+    total += entry.sizeBytes;
+  }
+  return total;
+}
+
+bool BookCacheManager::saveIfDirty() {
+  if (!dirty) {
+    return true;
+  }
+  if (!saveToFile()) {
+    return false;
+  }
+  dirty = false;
+  return true;
+}
+
+bool BookCacheManager::saveToFile() const {
+  // Make sure the directory exists
+  SdMan.mkdir("/.crosspoint");
+
+  FsFile outputFile;
+  if (!SdMan.openFileForWrite("BCM", INDEX_FILE, outputFile)) {
+    return false;
+  }
+
+  serialization::writePod(outputFile, INDEX_FILE_VERSION);
+  serialization::writePod(outputFile, accessCounter);
+  const auto count = static_cast<uint32_t>(entries.size());
+  serialization::writePod(outputFile, count);
+  for (const auto& entry : entries) {
+    serialization::writeString(outputFile, entry.path);
+    serialization::writePod(outputFile, entry.sizeBytes);
+    serialization::writePod(outputFile, entry.lastAccess);
+    serialization::writePod(outputFile, entry.measured);
+    serialization::writePod(outputFile, entry.trimmed);
+  }
+
+  outputFile.close();
+  return true;
+}
+
+bool BookCacheManager::loadFromFile() {
+  FsFile inputFile;
+  if (!SdMan.openFileForRead("BCM", INDEX_FILE, inputFile)) {
+    return false;
+  }
+
+  uint8_t version;
+  serialization::readPod(inputFile, version);
+  if (version != INDEX_FILE_VERSION) {
+    LOG_ERR("BCM", "Deserialization failed: Unknown version %u\n", version);
+    inputFile.close();
+    return false;
+  }
+
+  serialization::readPod(inputFile, accessCounter);
+  uint32_t count;
+  serialization::readPod(inputFile, count);
+  if (count > MAX_INDEX_ENTRIES) {
+    LOG_ERR("BCM", "Deserialization failed: Bad entry count %u\n", count);
+    inputFile.close();
+    return false;
+  }
+
+  entries.clear();
+  entries.reserve(count);
+  for (uint32_t i = 0; i < count; i++) {
+    Entry entry;
+    serialization::readString(inputFile, entry.path);
+    serialization::readPod(inputFile, entry.sizeBytes);
+    serialization::readPod(inputFile, entry.lastAccess);
+    serialization::readPod(inputFile, entry.measured);
+    serialization::readPod(inputFile, entry.trimmed);
+    entries.push_back(std::move(entry));
+  }
+
+  inputFile.close();
+  dirty = false;
+  LOG_INF("BCM", "Cache index loaded (%u entries, %lu KB)\n", count, static_cast<unsigned long>(getTotalSize() / 1024));
+  return true;
+}
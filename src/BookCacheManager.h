@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Keeps the per-book cache directories (book.bin, sections, images, covers) within the size budget from settings.
+// Tracks size and last access of every cache directory and evicts least recently used books in two tiers: first
+// everything that can be rebuilt cheaply is trimmed (sections, images, cover BMPs) while book.bin, reading positions
+// and the home thumbnail stay, then whole directories of books outside the most recent few are dropped.
+// All work happens in small steps driven from idle time, so a single step never blocks for long.
+class BookCacheManager {
+  // Static instance
+  static BookCacheManager instance;
+
+ public:
+  struct Entry {
+    std::string path;  // e.g. "/.crosspoint/epub_0123456789abcdef"
+    uint32_t sizeBytes = 0;
+    uint32_t lastAccess = 0;  // Access sequence number, 0 = never opened since tracking started
+    bool measured = false;
+    bool trimmed = false;
+  };
+
+ private:
+  enum class Phase : uint8_t { Discover, Measure, Evict, Idle };
+
+  std::vector<Entry> entries;  // Sorted by path
+  uint32_t accessCounter = 0;
+  Phase phase = Phase::Discover;
+  size_t discoverRootIndex = 0;
+  bool dirty = false;
+
+  Entry* find(const std::string& path);
+  void discoverStep();
+  void measureStep();
+  void evictStep();
+  bool isEvictable(const Entry& entry, bool wholeDirectory) const;
+  static bool isReaderCache(const std::string& path);
+  static uint32_t directorySize(const std::string& path);
+  static void trimDirectory(const std::string& path);
+
+ public:
+  ~BookCacheManager() = default;
+
+  // Get singleton instance
+  static BookCacheManager& getInstance() { return instance; }
+
+  // Mark a book's cache as just used (call when a book is opened)
+  void touch(const std::string& cachePath);
+
+  // Run one bounded unit of discovery, measuring or eviction. Returns false when there is nothing left to do.
+  bool step();
+
+  // Run steps until done or the time budget is used up
+  void runFor(unsigned long budgetMs);
+
+  uint64_t getTotalSize() const;
+  const std::vector<Entry>& getEntries() const { return entries; }
+
+  bool saveIfDirty();
+  bool saveToFile() const;
+  bool loadFromFile();
+};
+
+// Helper macro to access the book cache manager
+#define BOOK_CACHE BookCacheManager::getInstance()
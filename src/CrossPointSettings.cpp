@@ -1,6 +1,6 @@
 #include "CrossPointSettings.h"
 
-#include <HardwareSerial.h>
+#include <Logging.h>
 #include <SDCardManager.h>
 #include <Serialization.h>
 
@@ -23,7 +23,7 @@ namespace {
 constexpr uint8_t SETTINGS_FILE_VERSION =
     2; // Incremented for weatherCityIndex migration
 // Increment this when adding new persisted settings fields
-constexpr uint8_t SETTINGS_COUNT = 24; // Reduced by 1 (weatherLocation removed)
+constexpr uint8_t SETTINGS_COUNT = 25;
 constexpr char SETTINGS_FILE[] = "/.crosspoint/settings.bin";
 } // namespace
 
@@ -63,10 +63,11 @@ bool CrossPointSettings::saveToFile() const {
   serialization::writePod(outputFile, sleepScreenCoverFilter);
   serialization::writePod(outputFile, weatherCityIndex);
   serialization::writeString(outputFile, std::string(lastWeatherText));
+  serialization::writePod(outputFile, cacheBudget);
   // New fields added at end for backward compatibility
   outputFile.close();
 
-  Serial.printf("[%lu] [CPS] Settings saved to file\n", millis());
+  LOG_INF("CPS", "Settings saved to file\n");
   return true;
 }
 
@@ -79,8 +80,7 @@ bool CrossPointSettings::loadFromFile() {
   uint8_t version;
   serialization::readPod(inputFile, version);
   if (version != SETTINGS_FILE_VERSION) {
-    Serial.printf("[%lu] [CPS] Deserialization failed: Unknown version %u\n",
-                  millis(), version);
+    LOG_ERR("CPS", "Deserialization failed: Unknown version %u\n", version);
     inputFile.close();
     return false;
   }
@@ -197,13 +197,16 @@ bool CrossPointSettings::loadFromFile() {
       strncpy(lastWeatherText, weatherStr.c_str(), sizeof(lastWeatherText) - 1);
       lastWeatherText[sizeof(lastWeatherText) - 1] = '\0';
     }
+    if (++settingsRead >= fileSettingsCount)
+      break;
+    readAndValidate(inputFile, cacheBudget, CACHE_BUDGET_COUNT);
     if (++settingsRead >= fileSettingsCount)
       break;
     // New fields added at end for backward compatibility
   } while (false);
 
   inputFile.close();
-  Serial.printf("[%lu] [CPS] Settings loaded from file\n", millis());
+  LOG_INF("CPS", "Settings loaded from file\n");
   return true;
 }
 
@@ -275,6 +278,23 @@ int CrossPointSettings::getRefreshFrequency() const {
   }
 }
 
+uint64_t CrossPointSettings::getCacheBudgetBytes() const {
+  constexpr uint64_t MB = 1024ULL * 1024;
+  switch (cacheBudget) {
+  case CACHE_100MB:
+    return 100 * MB;
+  case CACHE_250MB:
+    return 250 * MB;
+  case CACHE_500MB:
+  default:
+    return 500 * MB;
+  case CACHE_1GB:
+    return 1024 * MB;
+  case CACHE_UNLIMITED:
+    return 0;
+  }
+}
+
 int CrossPointSettings::getReaderFontId() const {
   switch (fontFamily) {
   case BOOKERLY:
@@ -139,6 +139,16 @@ public:
     HIDE_BATTERY_PERCENTAGE_COUNT
   };
 
+  // Book cache size budget (LRU eviction above this)
+  enum CACHE_BUDGET {
+    CACHE_100MB = 0,
+    CACHE_250MB = 1,
+    CACHE_500MB = 2,
+    CACHE_1GB = 3,
+    CACHE_UNLIMITED = 4,
+    CACHE_BUDGET_COUNT
+  };
+
   // Sleep screen settings
   uint8_t sleepScreen = DARK;
   // Sleep screen cover mode settings
@@ -185,6 +195,8 @@ public:
   char lastWeatherText[64] = "";
   // Image loading setting
   uint8_t loadImages = 1; // Default to On (1)
+  // Book cache size budget (default 500 MB)
+  uint8_t cacheBudget = CACHE_500MB;
 
   ~CrossPointSettings() = default;
 
@@ -202,6 +214,8 @@ public:
   float getReaderLineCompression() const;
   unsigned long getSleepTimeoutMs() const;
   int getRefreshFrequency() const;
+  // 0 means unlimited
+  uint64_t getCacheBudgetBytes() const;
 };
 
 // Helper macro to access settings
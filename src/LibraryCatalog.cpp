@@ -0,0 +1,299 @@
+#include "LibraryCatalog.h"
+
+#include <Epub.h>
+#include <Logging.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+#include <Txt.h>
+#include <Xtc.h>
+
+#include <algorithm>
+
+#include "util/StringUtils.h"
+
+namespace {
+constexpr uint8_t CATALOG_FILE_VERSION = 1;
+constexpr char CATALOG_FILE[] = "/.crosspoint/library.bin";
+// Sanity limit when reading the catalog back, protects against a corrupt count
+constexpr uint32_t MAX_CATALOG_ENTRIES = 10000;
+
+bool comparePath(const LibraryCatalog::Entry& a, const std::string& path) { return a.path < path; }
+
+uint32_t packModifyTime(FsFile& file) {
+  uint16_t date = 0;
+  uint16_t time = 0;
+  file.getModifyDateTime(&date, &time);
+  return static_cast<uint32_t>(date) << 16 | time;
+}
+}  // namespace
+
+LibraryCatalog LibraryCatalog::instance;
+
+LibraryCatalog::Entry* LibraryCatalog::find(const std::string& path) {
+  const auto it = std::lower_bound(entries.begin(), entries.end(), path, comparePath);
+  if (it == entries.end() || it->path != path) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+std::string LibraryCatalog::cacheKeyForPath(const std::string& path) {
+  // Same content-based key the book's own thumbnail cache uses, so existing thumbs are picked up even after a move
+  std::string cachePath;
+  if (StringUtils::checkFileExtension(path, ".xtc") || StringUtils::checkFileExtension(path, ".xtch")) {
+    cachePath = Xtc(path, THUMB_CACHE_DIR).getCachePath();
+  } else if (StringUtils::checkFileExtension(path, ".txt")) {
+    cachePath = Txt(path, THUMB_CACHE_DIR).getCachePath();
+  } else {
+    cachePath = Epub(path, THUMB_CACHE_DIR).getCachePath();
+  }
+  return cachePath.substr(cachePath.find_last_of('/') + 1);
+}
+
+void LibraryCatalog::resetEntry(Entry& entry, const uint32_t size, const uint32_t mtime) {
+  entry.size = size;
+  entry.mtime = mtime;
+
+  // Caches are keyed by content, a touched but identical file keeps everything derived from it
+  std::string cacheKey = cacheKeyForPath(entry.path);
+  if (cacheKey == entry.cacheKey) {
+    return;
+  }
+  entry.cacheKey = std::move(cacheKey);
+  entry.title.clear();
+  entry.author.clear();
+  entry.thumbState = ThumbState::Unknown;
+}
+
+std::string LibraryCatalog::getThumbPath(const Entry& entry) {
+  return std::string(THUMB_CACHE_DIR) + "/" + entry.cacheKey + "/thumb.bmp";
+}
+
+bool LibraryCatalog::isSupportedBook(const std::string& fileName) {
+  return StringUtils::checkFileExtension(fileName, ".epub") || StringUtils::checkFileExtension(fileName, ".xtc") ||
+         StringUtils::checkFileExtension(fileName, ".xtch") || StringUtils::checkFileExtension(fileName, ".txt");
+}
+
+bool LibraryCatalog::isCatalogPath(const std::string& path) {
+  const size_t dirLen = sizeof(BOOKS_DIR) - 1;
+  if (path.size() <= dirLen + 1 || path.compare(0, dirLen, BOOKS_DIR) != 0 || path[dirLen] != '/') {
+    return false;
+  }
+  const std::string fileName = path.substr(dirLen + 1);
+  // Only direct children of the books directory are catalogued
+  return fileName.find('/') == std::string::npos && fileName[0] != '.' && isSupportedBook(fileName);
+}
+
+void LibraryCatalog::refresh() {
+  const unsigned long start = millis();
+
+  if (!SdMan.exists(BOOKS_DIR)) {
+    SdMan.mkdir(BOOKS_DIR);
+  }
+
+  auto root = SdMan.open(BOOKS_DIR);
+  if (!root || !root.isDirectory()) {
+    if (root) root.close();
+    return;
+  }
+
+  std::vector<Entry> updated;
+  updated.reserve(entries.size());
+
+  root.rewindDirectory();
+  char name[500];
+  while (auto file = root.openNextFile()) {
+    if (file.isDirectory()) {
+      file.close();
+      continue;
+    }
+
+    file.getName(name, sizeof(name));
+    const auto size = static_cast<uint32_t>(file.size());
+    const uint32_t mtime = packModifyTime(file);
+    file.close();
+
+    const std::string fileName(name);
+    if (fileName[0] == '.' || !isSupportedBook(fileName)) {
+      continue;
+    }
+
+    std::string path = std::string(BOOKS_DIR) + "/" + fileName;
+    const Entry* existing = find(path);
+    if (existing && existing->size == size && existing->mtime == mtime) {
+      updated.push_back(*existing);
+      continue;
+    }
+
+    Entry entry;
+    if (existing) {
+      entry = *existing;
+      resetEntry(entry, size, mtime);
+    } else {
+      entry.cacheKey = cacheKeyForPath(path);
+      // A moved or renamed book has the same content key, carry its metadata over instead of starting from scratch
+      const auto moved = std::find_if(entries.begin(), entries.end(),
+                                      [&entry](const Entry& e) { return e.cacheKey == entry.cacheKey; });
+      if (moved != entries.end()) {
+        entry = *moved;
+      }
+      entry.path = std::move(path);
+      entry.size = size;
+      entry.mtime = mtime;
+    }
+    updated.push_back(std::move(entry));
+    dirty = true;
+  }
+  root.close();
+
+  // Every existing entry matches at most one listed file, so a size change means something was removed
+  if (updated.size() != entries.size()) {
+    dirty = true;
+  }
+
+  std::sort(updated.begin(), updated.end(), [](const Entry& a, const Entry& b) { return a.path < b.path; });
+  entries = std::move(updated);
+
+  LOG_INF("LIB", "Catalog refreshed: %zu books in %lu ms%s\n", entries.size(), millis() - start,
+          dirty ? " (changed)" : "");
+  saveIfDirty();
+}
+
+void LibraryCatalog::updateBook(const std::string& path) {
+  if (!isCatalogPath(path)) {
+    return;
+  }
+
+  auto file = SdMan.open(path.c_str());
+  if (!file) {
+    removeBook(path);
+    return;
+  }
+  const auto size = static_cast<uint32_t>(file.size());
+  const uint32_t mtime = packModifyTime(file);
+  file.close();
+
+  if (Entry* existing = find(path)) {
+    resetEntry(*existing, size, mtime);
+  } else {
+    Entry entry;
+    entry.path = path;
+    entry.size = size;
+    entry.mtime = mtime;
+    entry.cacheKey = cacheKeyForPath(path);
+    const auto it = std::lower_bound(entries.begin(), entries.end(), path, comparePath);
+    entries.insert(it, std::move(entry));
+  }
+
+  dirty = true;
+  saveIfDirty();
+}
+
+void LibraryCatalog::removeBook(const std::string& path) {
+  const auto it = std::lower_bound(entries.begin(), entries.end(), path, comparePath);
+  if (it == entries.end() || it->path != path) {
+    return;
+  }
+  entries.erase(it);
+  dirty = true;
+  saveIfDirty();
+}
+
+void LibraryCatalog::setThumbState(const std::string& path, const ThumbState state) {
+  Entry* entry = find(path);
+  if (entry && entry->thumbState != state) {
+    entry->thumbState = state;
+    dirty = true;
+  }
+}
+
+void LibraryCatalog::setMetadata(const std::string& path, const std::string& title, const std::string& author) {
+  Entry* entry = find(path);
+  if (entry && (entry->title != title || entry->author != author)) {
+    entry->title = title;
+    entry->author = author;
+    dirty = true;
+  }
+}
+
+bool LibraryCatalog::saveIfDirty() {
+  if (!dirty) {
+    return true;
+  }
+  if (!saveToFile()) {
+    return false;
+  }
+  dirty = false;
+  return true;
+}
+
+bool LibraryCatalog::saveToFile() const {
+  // Make sure the directory exists
+  SdMan.mkdir("/.crosspoint");
+
+  FsFile outputFile;
+  if (!SdMan.openFileForWrite("LIB", CATALOG_FILE, outputFile)) {
+    return false;
+  }
+
+  serialization::writePod(outputFile, CATALOG_FILE_VERSION);
+  const auto count = static_cast<uint32_t>(entries.size());
+  serialization::writePod(outputFile, count);
+
+  for (const auto& entry : entries) {
+    serialization::writeString(outputFile, entry.path);
+    serialization::writePod(outputFile, entry.size);
+    serialization::writePod(outputFile, entry.mtime);
+    serialization::writeString(outputFile, entry.title);
+    serialization::writeString(outputFile, entry.author);
+    serialization::writePod(outputFile, entry.thumbState);
+    serialization::writeString(outputFile, entry.cacheKey);
+  }
+
+  outputFile.close();
+  LOG_INF("LIB", "Catalog saved (%u entries)\n", count);
+  return true;
+}
+
+bool LibraryCatalog::loadFromFile() {
+  FsFile inputFile;
+  if (!SdMan.openFileForRead("LIB", CATALOG_FILE, inputFile)) {
+    return false;
+  }
+
+  uint8_t version;
+  serialization::readPod(inputFile, version);
+  if (version != CATALOG_FILE_VERSION) {
+    LOG_ERR("LIB", "Deserialization failed: Unknown version %u\n", version);
+    inputFile.close();
+    return false;
+  }
+
+  uint32_t count;
+  serialization::readPod(inputFile, count);
+  if (count > MAX_CATALOG_ENTRIES) {
+    LOG_ERR("LIB", "Deserialization failed: Bad entry count %u\n", count);
+    inputFile.close();
+    return false;
+  }
+
+  entries.clear();
+  entries.reserve(count);
+
+  for (uint32_t i = 0; i < count; i++) {
+    Entry entry;
+    serialization::readString(inputFile, entry.path);
+    serialization::readPod(inputFile, entry.size);
+    serialization::readPod(inputFile, entry.mtime);
+    serialization::readString(inputFile, entry.title);
+    serialization::readString(inputFile, entry.author);
+    serialization::readPod(inputFile, entry.thumbState);
+    serialization::readString(inputFile, entry.cacheKey);
+    entries.push_back(std::move(entry));
+  }
+
+  inputFile.close();
+  dirty = false;
+  LOG_INF("LIB", "Catalog loaded (%u entries)\n", count);
+  return true;
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Persistent index of the books directory used by the Books grid.
+// Stores everything the grid needs per book so opening it is a directory listing diff plus one sequential read of
+// the catalog file, instead of constructing an Epub and probing the SD card for every entry.
+class LibraryCatalog {
+  // Static instance
+  static LibraryCatalog instance;
+
+ public:
+  enum class ThumbState : uint8_t { Unknown = 0, Ready = 1, Missing = 2 };
+
+  struct Entry {
+    std::string path;
+    uint32_t size = 0;
+    uint32_t mtime = 0;  // FAT modify date << 16 | FAT modify time
+    std::string title;
+    std::string author;
+    ThumbState thumbState = ThumbState::Unknown;
+    std::string cacheKey;  // Cache directory name, e.g. "epub_1234"
+  };
+
+  static constexpr char BOOKS_DIR[] = "/books";
+  static constexpr char THUMB_CACHE_DIR[] = "/cover";
+
+ private:
+  std::vector<Entry> entries;
+  bool dirty = false;
+
+  Entry* find(const std::string& path);
+  static std::string cacheKeyForPath(const std::string& path);
+  static void resetEntry(Entry& entry, uint32_t size, uint32_t mtime);
+
+ public:
+  ~LibraryCatalog() = default;
+
+  // Get singleton instance
+  static LibraryCatalog& getInstance() { return instance; }
+
+  // Diff the catalog against the books directory listing. Unchanged entries are kept as-is, new or modified files get
+  // fresh entries and removed files are dropped. Saves the catalog if anything changed.
+  void refresh();
+
+  // Incremental updates (e.g. from web uploads/deletes). Paths outside BOOKS_DIR are ignored.
+  void updateBook(const std::string& path);
+  void removeBook(const std::string& path);
+
+  void setThumbState(const std::string& path, ThumbState state);
+  void setMetadata(const std::string& path, const std::string& title, const std::string& author);
+
+  // Path of the 1-bit grid thumbnail for an entry
+  static std::string getThumbPath(const Entry& entry);
+
+  // Entries sorted by file name
+  const std::vector<Entry>& getEntries() const { return entries; }
+
+  static bool isCatalogPath(const std::string& path);
+  static bool isSupportedBook(const std::string& fileName);
+
+  bool saveIfDirty();
+  bool saveToFile() const;
+  bool loadFromFile();
+};
+
+// Helper macro to access the library catalog
+#define LIBRARY_CATALOG LibraryCatalog::getInstance()
@@ -1,6 +1,6 @@
 #include "RecentBooksStore.h"
 
-#include <HardwareSerial.h>
+#include <Logging.h>
 #include <SDCardManager.h>
 #include <Serialization.h>
 
@@ -91,8 +91,7 @@ bool RecentBooksStore::saveToFile() const {
   }
 
   outputFile.close();
-  Serial.printf("[%lu] [RBS] Recent books saved to file (%d entries)\n",
-                millis(), count);
+  LOG_INF("RBS", "Recent books saved to file (%d entries)\n", count);
   return true;
 }
 
@@ -123,8 +122,7 @@ bool RecentBooksStore::loadFromFile() {
   uint8_t version;
   serialization::readPod(inputFile, version);
   if (version != RECENT_BOOKS_FILE_VERSION) {
-    Serial.printf("[%lu] [RBS] Deserialization failed: Unknown version %u\n",
-                  millis(), version);
+    LOG_ERR("RBS", "Deserialization failed: Unknown version %u\n", version);
     inputFile.close();
     return false;
   }
@@ -145,7 +143,6 @@ bool RecentBooksStore::loadFromFile() {
   }
 
   inputFile.close();
-  Serial.printf("[%lu] [RBS] Recent books loaded from file (%d entries)\n",
-                millis(), count);
+  LOG_INF("RBS", "Recent books loaded from file (%d entries)\n", count);
   return true;
 }
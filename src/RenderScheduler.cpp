@@ -0,0 +1,127 @@
+#include "RenderScheduler.h"
+
+#include <Arduino.h>
+#include <HeapStats.h>
+#include <Logging.h>
+
+#include <algorithm>
+
+RenderScheduler RenderScheduler::instance;
+
+void RenderScheduler::begin() {
+  if (taskHandle) {
+    return;
+  }
+  mutex = xSemaphoreCreateRecursiveMutex();
+  // Same priority the per-activity display tasks had, the main loop keeps running while a page renders
+  xTaskCreate(&RenderScheduler::taskTrampoline, "RenderTask", TASK_STACK_SIZE, this, 1, &taskHandle);
+  heapstats::mark("RenderScheduler", "started");
+}
+
+void RenderScheduler::lock() { xSemaphoreTakeRecursive(mutex, portMAX_DELAY); }
+
+void RenderScheduler::unlock() { xSemaphoreGiveRecursive(mutex); }
+
+void RenderScheduler::wake() {
+  if (taskHandle) {
+    xTaskNotifyGive(taskHandle);
+  }
+}
+
+bool RenderScheduler::add(RenderJob* job) {
+  lock();
+  RenderJob** slot = std::find(std::begin(jobs), std::end(jobs), nullptr);
+  const bool added = slot != std::end(jobs);
+  if (added) {
+    *slot = job;
+  } else {
+    LOG_ERR("RND", "More than %u render jobs, not rendering\n", static_cast<unsigned>(MAX_JOBS));
+  }
+  unlock();
+  return added;
+}
+
+void RenderScheduler::remove(const RenderJob* job) {
+  // A render of this job holds the lock, taking it waits for the render to finish
+  lock();
+  std::replace(std::begin(jobs), std::end(jobs), const_cast<RenderJob*>(job), static_cast<RenderJob*>(nullptr));
+  unlock();
+}
+
+void RenderScheduler::taskTrampoline(void* param) {
+  auto* self = static_cast<RenderScheduler*>(param);
+  self->taskLoop();
+}
+
+void RenderScheduler::taskLoop() {
+  TickType_t wait = portMAX_DELAY;
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, wait);
+    wait = renderPending();
+  }
+}
+
+TickType_t RenderScheduler::renderPending() {
+  while (true) {
+    lock();
+    RenderJob* next = nullptr;
+    TickType_t wait = portMAX_DELAY;
+    const uint32_t now = millis();
+    for (RenderJob* job : jobs) {
+      if (!job) {
+        continue;
+      }
+      const auto priority = static_cast<Priority>(job->pending.load());
+      if (priority == Priority::None || (job->canRender && !job->canRender())) {
+        continue;
+      }
+      if (priority == Priority::Input) {
+        next = job;
+        break;
+      }
+      const uint32_t age = now - job->requestedAt.load();
+      if (age >= BACKGROUND_COALESCE_MS) {
+        next = next ? next : job;
+      } else {
+        wait = std::min<TickType_t>(wait, pdMS_TO_TICKS(BACKGROUND_COALESCE_MS - age));
+      }
+    }
+
+    if (!next) {
+      unlock();
+      return wait;
+    }
+    // Cleared before rendering, a request made during the render schedules another one
+    next->pending = static_cast<uint8_t>(Priority::None);
+    next->render();
+    unlock();
+  }
+}
+
+void RenderJob::start() {
+  if (started) {
+    return;
+  }
+  started = RENDER_SCHEDULER.add(this);
+  RENDER_SCHEDULER.wake();
+}
+
+void RenderJob::stop() {
+  if (!started) {
+    return;
+  }
+  RENDER_SCHEDULER.remove(this);
+  started = false;
+  pending = static_cast<uint8_t>(RenderScheduler::Priority::None);
+}
+
+void RenderJob::request(const RenderScheduler::Priority priority) {
+  uint8_t current = pending.load();
+  if (current == static_cast<uint8_t>(RenderScheduler::Priority::None)) {
+    requestedAt = millis();
+  }
+  const auto raised = static_cast<uint8_t>(priority);
+  while (current < raised && !pending.compare_exchange_weak(current, raised)) {
+  }
+  RENDER_SCHEDULER.wake();
+}
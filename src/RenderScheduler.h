@@ -0,0 +1,93 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+class RenderJob;
+
+// One FreeRTOS task renders the screen for every activity. Activities own a RenderJob instead of a display task that
+// polls an update flag: they start it on enter, stop it on exit and request() it whenever their screen changed.
+// The task sleeps on a task notification until a request arrives. Requests made before a job runs coalesce into one
+// render, and input-triggered requests are served first. Background requests (progress, connection status) are held
+// for BACKGROUND_COALESCE_MS so a burst of them costs a single refresh.
+//
+// Renders run under the rendering lock. Activities take it with lock()/unlock() around changes to state their render
+// reads. It is recursive, so a parent activity can hold it while a subactivity starts or stops its job.
+class RenderScheduler {
+  // Static instance
+  static RenderScheduler instance;
+
+ public:
+  enum class Priority : uint8_t { None, Background, Input };
+
+  // Jobs started at the same time: the activity on screen and the parents below it
+  static constexpr size_t MAX_JOBS = 8;
+  static constexpr uint32_t BACKGROUND_COALESCE_MS = 100;
+  // Sized for the deepest render, an EPUB section being indexed
+  static constexpr uint32_t TASK_STACK_SIZE = 8192;
+
+  static RenderScheduler& getInstance() { return instance; }
+
+  // Creates the render task, call once the display is up and before the first activity
+  void begin();
+
+  void lock();
+  void unlock();
+
+  // Wakes the render task to retry requests held back by RenderJob's canRender, e.g. after a subactivity exited
+  void wake();
+
+ private:
+  friend class RenderJob;
+
+  TaskHandle_t taskHandle = nullptr;
+  SemaphoreHandle_t mutex = nullptr;
+  RenderJob* jobs[MAX_JOBS] = {};
+
+  bool add(RenderJob* job);
+  void remove(const RenderJob* job);
+  static void taskTrampoline(void* param);
+  [[noreturn]] void taskLoop();
+  // Runs every request that may render, input ones first. Returns the ticks until the next held back background
+  // request falls due, portMAX_DELAY if there is none.
+  TickType_t renderPending();
+};
+
+// An activity's render callback as scheduled by RenderScheduler
+class RenderJob {
+ public:
+  // render runs on the render task with the rendering lock held. canRender, if set, holds requests back while it
+  // returns false (a subactivity owns the screen), they render on a later wake-up.
+  explicit RenderJob(std::function<void()> render, std::function<bool()> canRender = nullptr)
+      : render(std::move(render)), canRender(std::move(canRender)) {}
+  ~RenderJob() { stop(); }
+
+  RenderJob(const RenderJob&) = delete;
+  RenderJob& operator=(const RenderJob&) = delete;
+
+  // Registers with the scheduler, requests made before start render right away
+  void start();
+  // Unregisters, waiting for a render in progress. Pending requests are dropped.
+  void stop();
+  // Safe from any task. Raises a pending request to the higher priority.
+  void request(RenderScheduler::Priority priority = RenderScheduler::Priority::Input);
+
+ private:
+  friend class RenderScheduler;
+
+  const std::function<void()> render;
+  const std::function<bool()> canRender;
+  std::atomic<uint8_t> pending{static_cast<uint8_t>(RenderScheduler::Priority::None)};
+  // millis() of the first request since the last render
+  std::atomic<uint32_t> requestedAt{0};
+  bool started = false;
+};
+
+// Helper macro to access the render scheduler
+#define RENDER_SCHEDULER RenderScheduler::getInstance()
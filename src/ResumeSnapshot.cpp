@@ -0,0 +1,112 @@
+#include "ResumeSnapshot.h"
+
+#include <Arduino.h>
+#include <GfxRenderer.h>
+#include <Logging.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+
+namespace {
+constexpr uint8_t SNAPSHOT_FILE_VERSION = 1;
+constexpr char SNAPSHOT_FILE[] = "/.crosspoint/resume.bin";
+}  // namespace
+
+ResumeSnapshot ResumeSnapshot::instance;
+
+bool ResumeSnapshot::save(const GfxRenderer& renderer, const std::string& bookPath, const uint16_t spineIndex,
+                          const uint16_t page) const {
+  const uint8_t* frameBuffer = renderer.getFrameBuffer();
+  if (!frameBuffer) {
+    return false;
+  }
+  FsFile outputFile;
+  if (!SdMan.openFileForWrite("RSM", SNAPSHOT_FILE, outputFile)) {
+    return false;
+  }
+
+  const auto frameSize = static_cast<uint32_t>(GfxRenderer::getBufferSize());
+  serialization::writePod(outputFile, SNAPSHOT_FILE_VERSION);
+  serialization::writeString(outputFile, bookPath);
+  serialization::writePod(outputFile, spineIndex);
+  serialization::writePod(outputFile, page);
+  serialization::writePod(outputFile, frameSize);
+  const bool ok = outputFile.write(frameBuffer, frameSize) == frameSize;
+  outputFile.close();
+  if (!ok) {
+    LOG_ERR("RSM", "Failed to write the resume frame\n");
+    SdMan.remove(SNAPSHOT_FILE);
+    return false;
+  }
+  LOG_INF("RSM", "Saved page %u of spine %u for resume\n", page, spineIndex);
+  return true;
+}
+
+bool ResumeSnapshot::restore(GfxRenderer& renderer, const std::string& bookPath) {
+  FsFile inputFile;
+  if (!SdMan.openFileForRead("RSM", SNAPSHOT_FILE, inputFile)) {
+    return false;
+  }
+
+  uint8_t version;
+  std::string path;
+  uint32_t frameSize = 0;
+  serialization::readPod(inputFile, version);
+  if (version == SNAPSHOT_FILE_VERSION) {
+    serialization::readString(inputFile, path);
+    serialization::readPod(inputFile, spineIndex);
+    serialization::readPod(inputFile, page);
+    serialization::readPod(inputFile, frameSize);
+  }
+
+  bool ok = version == SNAPSHOT_FILE_VERSION && path == bookPath && frameSize == GfxRenderer::getBufferSize();
+  if (ok) {
+    // Written over as a whole, the previous contents do not matter
+    uint8_t* frameBuffer = renderer.getFrameBuffer();
+    ok = frameBuffer && inputFile.read(frameBuffer, frameSize) == static_cast<int>(frameSize);
+    if (!ok) {
+      renderer.clearScreen();
+    }
+  }
+  inputFile.close();
+  // Used once, a snapshot that made the boot fail must not be shown again
+  SdMan.remove(SNAPSHOT_FILE);
+  if (!ok) {
+    LOG_INF("RSM", "No resume frame for %s\n", bookPath.c_str());
+    return false;
+  }
+
+  // The sleep screen is on the panel, a half refresh clears it. Opening the book reads the SD card, which shares the
+  // panel's SPI bus, so the refresh is not left running on the display task.
+  renderer.displayBuffer(EInkDisplay::HALF_REFRESH);
+  this->bookPath = bookPath;
+  frameOnScreen = true;
+  frameShownMs = millis();
+  readyMs = 0;
+  firstPageTurnReported = false;
+  LOG_INF("RSM", "Resume frame shown %lu ms after boot\n", frameShownMs);
+  return true;
+}
+
+bool ResumeSnapshot::claimFrame(const std::string& bookPath, const uint16_t spineIndex, const uint16_t page) {
+  const bool matches = frameOnScreen && this->bookPath == bookPath && this->spineIndex == spineIndex &&
+                       this->page == page;
+  frameOnScreen = false;
+  return matches;
+}
+
+void ResumeSnapshot::markReady() {
+  if (firstPageTurnReported || readyMs != 0) {
+    return;
+  }
+  readyMs = millis();
+  LOG_INF("RSM", "Resumed book ready %lu ms after boot\n", readyMs);
+}
+
+void ResumeSnapshot::markPageRendered() {
+  if (firstPageTurnReported || readyMs == 0) {
+    return;
+  }
+  firstPageTurnReported = true;
+  LOG_INF("RSM", "Boot to first page turn: %lu ms (frame shown at %lu ms, book ready at %lu ms)\n", millis(),
+          frameShownMs, readyMs);
+}
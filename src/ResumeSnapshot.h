@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+class GfxRenderer;
+
+// The reader page on screen when the device went to sleep, written to the SD card next to the app state. On the next
+// boot the frame goes straight back on the panel, before the book is opened, and the reader skips rendering the
+// same page again once its section is loaded. The snapshot is used once, restoring it deletes the file.
+class ResumeSnapshot {
+  // Static instance
+  static ResumeSnapshot instance;
+
+  // Position of the restored frame, kept until the reader claims it
+  std::string bookPath;
+  uint16_t spineIndex = 0;
+  uint16_t page = 0;
+  bool frameOnScreen = false;
+  // millis() when the restored frame was sent and when the reader had its section loaded, 0 if not yet
+  unsigned long frameShownMs = 0;
+  unsigned long readyMs = 0;
+  bool firstPageTurnReported = true;
+
+ public:
+  static ResumeSnapshot& getInstance() { return instance; }
+
+  // Writes the frame buffer as the page at spineIndex/page of bookPath
+  bool save(const GfxRenderer& renderer, const std::string& bookPath, uint16_t spineIndex, uint16_t page) const;
+  // Puts a snapshot of bookPath back into the frame buffer and refreshes it. False if there is none.
+  bool restore(GfxRenderer& renderer, const std::string& bookPath);
+  // True once, for the reader of bookPath at the restored position, which then leaves the frame on screen
+  bool claimFrame(const std::string& bookPath, uint16_t spineIndex, uint16_t page);
+  void discardFrame() { frameOnScreen = false; }
+
+  // Boot-to-first-page-turn timing of a resumed book, logged when the first turned page is rendered
+  void markReady();
+  void markPageRendered();
+};
+
+// Helper macro to access the resume snapshot
+#define RESUME_SNAPSHOT ResumeSnapshot::getInstance()
@@ -2,6 +2,7 @@
 
 #include <GfxRenderer.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
 
@@ -10,8 +11,18 @@
 
 void ScreenComponents::drawBattery(const GfxRenderer& renderer, const int left, const int top,
                                    const bool showPercentage) {
+  drawBattery(renderer, left, top, showPercentage, battery.readPercentage());
+}
+
+int ScreenComponents::getBatteryFillStep(const uint16_t percentage) {
+  // 5 of the icon's 15 columns are outline, the +1 is to round up so that we always fill at least one pixel
+  constexpr int fillWidth = 15 - 5;
+  return std::min(percentage * fillWidth / 100 + 1, fillWidth);
+}
+
+void ScreenComponents::drawBattery(const GfxRenderer& renderer, const int left, const int top,
+                                   const bool showPercentage, const uint16_t percentage) {
   // Left aligned battery icon and percentage
-  const uint16_t percentage = battery.readPercentage();
   const auto percentageText = showPercentage ? std::to_string(percentage) + "%" : "";
   renderer.drawText(SMALL_FONT_ID, left + 20, top, percentageText.c_str());
 
@@ -33,13 +44,7 @@ void ScreenComponents::drawBattery(const GfxRenderer& renderer, const int left,
   renderer.drawPixel(x + batteryWidth - 1, y + batteryHeight - 4);
   renderer.drawLine(x + batteryWidth - 0, y + 4, x + batteryWidth - 0, y + batteryHeight - 5);
 
-  // The +1 is to round up, so that we always fill at least one pixel
-  int filledWidth = percentage * (batteryWidth - 5) / 100 + 1;
-  if (filledWidth > batteryWidth - 5) {
-    filledWidth = batteryWidth - 5;  // Ensure we don't overflow
-  }
-
-  renderer.fillRect(x + 2, y + 2, filledWidth, batteryHeight - 4);
+  renderer.fillRect(x + 2, y + 2, getBatteryFillStep(percentage), batteryHeight - 4);
 }
 
 void ScreenComponents::drawBookProgressBar(const GfxRenderer& renderer, const size_t bookProgress) {
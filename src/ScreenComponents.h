@@ -16,6 +16,10 @@ class ScreenComponents {
   static const int BOOK_PROGRESS_BAR_HEIGHT = 4;
 
   static void drawBattery(const GfxRenderer& renderer, int left, int top, bool showPercentage = true);
+  // With a level read by the caller, one that keys a cached drawing
+  static void drawBattery(const GfxRenderer& renderer, int left, int top, bool showPercentage, uint16_t percentage);
+  // Steps of the battery icon's fill, a level within one step draws the same icon
+  static int getBatteryFillStep(uint16_t percentage);
   static void drawBookProgressBar(const GfxRenderer& renderer, size_t bookProgress);
 
   // Draw a horizontal tab bar with underline indicator for selected tab
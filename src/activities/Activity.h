@@ -1,6 +1,7 @@
 #pragma once
 
-#include <HardwareSerial.h>
+#include <HeapStats.h>
+#include <Logging.h>
 
 #include <string>
 #include <utility>
@@ -17,10 +18,21 @@ class Activity {
  public:
   explicit Activity(std::string name, GfxRenderer& renderer, MappedInputManager& mappedInput)
       : name(std::move(name)), renderer(renderer), mappedInput(mappedInput) {}
-  virtual ~Activity() = default;
-  virtual void onEnter() { Serial.printf("[%lu] [ACT] Entering activity: %s\n", millis(), name.c_str()); }
-  virtual void onExit() { Serial.printf("[%lu] [ACT] Exiting activity: %s\n", millis(), name.c_str()); }
+  // Runs after the subclass released its members, heap still missing compared to "enter" was leaked or handed on
+  virtual ~Activity() { heapstats::mark(name.c_str(), "freed"); }
+  virtual void onEnter() {
+    LOG_INF("ACT", "Entering activity: %s\n", name.c_str());
+    heapstats::mark(name.c_str(), "enter");
+  }
+  virtual void onExit() {
+    LOG_INF("ACT", "Exiting activity: %s\n", name.c_str());
+    heapstats::mark(name.c_str(), "exit");
+  }
   virtual void loop() {}
   virtual bool skipLoopDelay() { return false; }
   virtual bool preventAutoSleep() { return false; }
+  // Whether background SD card maintenance (cache eviction) may run while the user is idle in this activity
+  virtual bool allowIdleMaintenance() { return false; }
+  // Called on the activity on screen before the device goes to sleep
+  virtual void onSleep() {}
 };
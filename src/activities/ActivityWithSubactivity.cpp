@@ -1,9 +1,13 @@
 #include "ActivityWithSubactivity.h"
 
+#include "RenderScheduler.h"
+
 void ActivityWithSubactivity::exitActivity() {
   if (subActivity) {
     subActivity->onExit();
     subActivity.reset();
+    // Renders this activity held back while the subactivity was on screen
+    RENDER_SCHEDULER.wake();
   }
 }
 
@@ -18,6 +22,12 @@ void ActivityWithSubactivity::loop() {
   }
 }
 
+void ActivityWithSubactivity::onSleep() {
+  if (subActivity) {
+    subActivity->onSleep();
+  }
+}
+
 void ActivityWithSubactivity::onExit() {
   Activity::onExit();
   exitActivity();
@@ -2,7 +2,9 @@
 
 #include <Epub.h>
 #include <GfxRenderer.h>
+#include <Logging.h>
 #include <SDCardManager.h>
+#include <Serialization.h>
 #include <Txt.h>
 #include <Xtc.h>
 
@@ -12,6 +14,40 @@
 #include "images/CrossLarge.h"
 #include "util/StringUtils.h"
 
+namespace {
+// Composed cover frame, stored in the book's cache dir so it goes with the
+// cover bmp it was drawn from
+constexpr char SLEEP_FRAME_FILE[] = "sleep_frame.bin";
+constexpr uint8_t SLEEP_FRAME_VERSION = 1;
+constexpr uint32_t SLEEP_FRAME_HEADER_SIZE = 9;
+
+// Everything the composed frame depends on besides the cover pixels
+struct SleepFrameKey {
+  uint8_t version;
+  uint8_t coverMode;
+  uint8_t coverFilter;
+  uint8_t orientation;
+  uint32_t coverSize;
+};
+
+SleepFrameKey currentSleepFrameKey(const GfxRenderer &renderer,
+                                   const uint32_t coverSize) {
+  return {SLEEP_FRAME_VERSION, SETTINGS.sleepScreenCoverMode,
+          SETTINGS.sleepScreenCoverFilter,
+          static_cast<uint8_t>(renderer.getOrientation()), coverSize};
+}
+
+uint32_t getFileSize(const std::string &path) {
+  FsFile file;
+  if (!SdMan.openFileForRead("SLP", path, file)) {
+    return 0;
+  }
+  const uint32_t size = file.size();
+  file.close();
+  return size;
+}
+}  // namespace
+
 void SleepActivity::onEnter() {
   Activity::onEnter();
   renderPopup("Đang ngủ...");
@@ -67,15 +103,13 @@ void SleepActivity::renderCustomSleepScreen() const {
       }
 
       if (filename.substr(filename.length() - 4) != ".bmp") {
-        Serial.printf("[%lu] [SLP] Skipping non-.bmp file name: %s\n", millis(),
-                      name);
+        LOG_WRN("SLP", "Skipping non-.bmp file name: %s\n", name);
         file.close();
         continue;
       }
       Bitmap bitmap(file);
       if (bitmap.parseHeaders() != BmpReaderError::Ok) {
-        Serial.printf("[%lu] [SLP] Skipping invalid BMP file: %s\n", millis(),
-                      name);
+        LOG_WRN("SLP", "Skipping invalid BMP file: %s\n", name);
         file.close();
         continue;
       }
@@ -95,8 +129,8 @@ void SleepActivity::renderCustomSleepScreen() const {
       const auto filename = "/sleep/" + files[randomFileIndex];
       FsFile file;
       if (SdMan.openFileForRead("SLP", filename, file)) {
-        Serial.printf("[%lu] [SLP] Randomly loading: /sleep/%s\n", millis(),
-                      files[randomFileIndex].c_str());
+        LOG_INF("SLP", "Randomly loading: /sleep/%s\n",
+                files[randomFileIndex].c_str());
         delay(100);
         Bitmap bitmap(file, true);
         if (bitmap.parseHeaders() == BmpReaderError::Ok) {
@@ -116,7 +150,7 @@ void SleepActivity::renderCustomSleepScreen() const {
   if (SdMan.openFileForRead("SLP", "/sleep.bmp", file)) {
     Bitmap bitmap(file, true);
     if (bitmap.parseHeaders() == BmpReaderError::Ok) {
-      Serial.printf("[%lu] [SLP] Loading: /sleep.bmp\n", millis());
+      LOG_INF("SLP", "Loading: /sleep.bmp\n");
       renderBitmapSleepScreen(bitmap);
       return;
     }
@@ -144,14 +178,16 @@ void SleepActivity::renderDefaultSleepScreen() const {
   renderer.displayBuffer(EInkDisplay::HALF_REFRESH);
 }
 
-void SleepActivity::renderBitmapSleepScreen(const Bitmap &bitmap) const {
+void SleepActivity::renderBitmapSleepScreen(const Bitmap &bitmap,
+                                            const std::string &framePath,
+                                            const uint32_t coverSize) const {
   int x, y;
   const auto pageWidth = renderer.getScreenWidth();
   const auto pageHeight = renderer.getScreenHeight();
   float cropX = 0, cropY = 0;
 
-  Serial.printf("[%lu] [SLP] bitmap %d x %d, screen %d x %d\n", millis(),
-                bitmap.getWidth(), bitmap.getHeight(), pageWidth, pageHeight);
+  LOG_DBG("SLP", "bitmap %d x %d, screen %d x %d\n", bitmap.getWidth(),
+          bitmap.getHeight(), pageWidth, pageHeight);
   if (bitmap.getWidth() > pageWidth || bitmap.getHeight() > pageHeight) {
     // image will scale, make sure placement is right
     float ratio = static_cast<float>(bitmap.getWidth()) /
@@ -159,15 +195,14 @@ void SleepActivity::renderBitmapSleepScreen(const Bitmap &bitmap) const {
     const float screenRatio =
         static_cast<float>(pageWidth) / static_cast<float>(pageHeight);
 
-    Serial.printf("[%lu] [SLP] bitmap ratio: %f, screen ratio: %f\n", millis(),
-                  ratio, screenRatio);
+    LOG_DBG("SLP", "bitmap ratio: %f, screen ratio: %f\n", ratio, screenRatio);
     if (ratio > screenRatio) {
       // image wider than viewport ratio, scaled down image needs to be centered
       // vertically
       if (SETTINGS.sleepScreenCoverMode ==
           CrossPointSettings::SLEEP_SCREEN_COVER_MODE::CROP) {
         cropX = 1.0f - (screenRatio / ratio);
-        Serial.printf("[%lu] [SLP] Cropping bitmap x: %f\n", millis(), cropX);
+        LOG_DBG("SLP", "Cropping bitmap x: %f\n", cropX);
         ratio = (1.0f - cropX) * static_cast<float>(bitmap.getWidth()) /
                 static_cast<float>(bitmap.getHeight());
       }
@@ -175,15 +210,14 @@ void SleepActivity::renderBitmapSleepScreen(const Bitmap &bitmap) const {
       y = std::round((static_cast<float>(pageHeight) -
                       static_cast<float>(pageWidth) / ratio) /
                      2);
-      Serial.printf("[%lu] [SLP] Centering with ratio %f to y=%d\n", millis(),
-                    ratio, y);
+      LOG_DBG("SLP", "Centering with ratio %f to y=%d\n", ratio, y);
     } else {
       // image taller than viewport ratio, scaled down image needs to be
       // centered horizontally
       if (SETTINGS.sleepScreenCoverMode ==
           CrossPointSettings::SLEEP_SCREEN_COVER_MODE::CROP) {
         cropY = 1.0f - (ratio / screenRatio);
-        Serial.printf("[%lu] [SLP] Cropping bitmap y: %f\n", millis(), cropY);
+        LOG_DBG("SLP", "Cropping bitmap y: %f\n", cropY);
         ratio = static_cast<float>(bitmap.getWidth()) /
                 ((1.0f - cropY) * static_cast<float>(bitmap.getHeight()));
       }
@@ -191,8 +225,7 @@ void SleepActivity::renderBitmapSleepScreen(const Bitmap &bitmap) const {
                       static_cast<float>(pageHeight) * ratio) /
                      2);
       y = 0;
-      Serial.printf("[%lu] [SLP] Centering with ratio %f to x=%d\n", millis(),
-                    ratio, x);
+      LOG_DBG("SLP", "Centering with ratio %f to x=%d\n", ratio, x);
     }
   } else {
     // center the image
@@ -200,7 +233,7 @@ void SleepActivity::renderBitmapSleepScreen(const Bitmap &bitmap) const {
     y = (pageHeight - bitmap.getHeight()) / 2;
   }
 
-  Serial.printf("[%lu] [SLP] drawing to %d x %d\n", millis(), x, y);
+  LOG_DBG("SLP", "drawing to %d x %d\n", x, y);
   renderer.clearScreen();
 
   const bool hasGreyscale =
@@ -215,6 +248,27 @@ void SleepActivity::renderBitmapSleepScreen(const Bitmap &bitmap) const {
     renderer.invertScreen();
   }
 
+  // Each composed plane is also written out, the next sleep on this cover
+  // only reads them back. An unfinished file fails the size check there.
+  FsFile frameFile;
+  bool storeFrame = !framePath.empty() &&
+                    SdMan.openFileForWrite("SLP", framePath, frameFile);
+  const auto storePlane = [&] {
+    const auto frameSize = GfxRenderer::getBufferSize();
+    storeFrame = storeFrame && frameFile.write(renderer.getFrameBuffer(),
+                                               frameSize) == frameSize;
+  };
+  if (storeFrame) {
+    const SleepFrameKey key = currentSleepFrameKey(renderer, coverSize);
+    serialization::writePod(frameFile, key.version);
+    serialization::writePod(frameFile, key.coverMode);
+    serialization::writePod(frameFile, key.coverFilter);
+    serialization::writePod(frameFile, key.orientation);
+    serialization::writePod(frameFile, key.coverSize);
+    serialization::writePod(frameFile, static_cast<uint8_t>(hasGreyscale));
+    storePlane();
+  }
+
   renderer.displayBuffer(EInkDisplay::HALF_REFRESH);
 
   if (hasGreyscale) {
@@ -222,17 +276,27 @@ void SleepActivity::renderBitmapSleepScreen(const Bitmap &bitmap) const {
     renderer.clearScreen(0x00);
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
     renderer.drawBitmap(bitmap, x, y, pageWidth, pageHeight, cropX, cropY);
+    storePlane();
     renderer.copyGrayscaleLsbBuffers();
 
     bitmap.rewindToData();
     renderer.clearScreen(0x00);
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
     renderer.drawBitmap(bitmap, x, y, pageWidth, pageHeight, cropX, cropY);
+    storePlane();
     renderer.copyGrayscaleMsbBuffers();
 
     renderer.displayGrayBuffer();
     renderer.setRenderMode(GfxRenderer::BW);
   }
+
+  if (frameFile) {
+    frameFile.close();
+    if (!storeFrame) {
+      LOG_ERR("SLP", "Failed to store sleep frame %s\n", framePath.c_str());
+      SdMan.remove(framePath.c_str());
+    }
+  }
 }
 
 void SleepActivity::renderCoverSleepScreen() const {
@@ -241,21 +305,27 @@ void SleepActivity::renderCoverSleepScreen() const {
   }
 
   std::string coverBmpPath;
+  std::string framePath;
   bool cropped = SETTINGS.sleepScreenCoverMode ==
                  CrossPointSettings::SLEEP_SCREEN_COVER_MODE::CROP;
 
-  // Check if the current book is XTC, TXT, or EPUB
+  // Check if the current book is XTC, TXT, or EPUB. The frame of an earlier
+  // sleep is tried before the book is loaded, it only takes the cache path.
   if (StringUtils::checkFileExtension(APP_STATE.openEpubPath, ".xtc") ||
       StringUtils::checkFileExtension(APP_STATE.openEpubPath, ".xtch")) {
     // Handle XTC file
     Xtc lastXtc(APP_STATE.openEpubPath, "/.crosspoint");
+    framePath = lastXtc.getCachePath() + "/" + SLEEP_FRAME_FILE;
+    if (renderCachedSleepScreen(framePath, lastXtc.getCoverBmpPath())) {
+      return;
+    }
     if (!lastXtc.load()) {
-      Serial.println("[SLP] Failed to load last XTC");
+      LOG_ERR("SLP", "Failed to load last XTC\n");
       return renderDefaultSleepScreen();
     }
 
     if (!lastXtc.generateCoverBmp()) {
-      Serial.println("[SLP] Failed to generate XTC cover bmp");
+      LOG_ERR("SLP", "Failed to generate XTC cover bmp\n");
       return renderDefaultSleepScreen();
     }
 
@@ -263,13 +333,17 @@ void SleepActivity::renderCoverSleepScreen() const {
   } else if (StringUtils::checkFileExtension(APP_STATE.openEpubPath, ".txt")) {
     // Handle TXT file - looks for cover image in the same folder
     Txt lastTxt(APP_STATE.openEpubPath, "/.crosspoint");
+    framePath = lastTxt.getCachePath() + "/" + SLEEP_FRAME_FILE;
+    if (renderCachedSleepScreen(framePath, lastTxt.getCoverBmpPath())) {
+      return;
+    }
     if (!lastTxt.load()) {
-      Serial.println("[SLP] Failed to load last TXT");
+      LOG_ERR("SLP", "Failed to load last TXT\n");
       return renderDefaultSleepScreen();
     }
 
     if (!lastTxt.generateCoverBmp()) {
-      Serial.println("[SLP] No cover image found for TXT file");
+      LOG_INF("SLP", "No cover image found for TXT file\n");
       return renderDefaultSleepScreen();
     }
 
@@ -277,13 +351,17 @@ void SleepActivity::renderCoverSleepScreen() const {
   } else if (StringUtils::checkFileExtension(APP_STATE.openEpubPath, ".epub")) {
     // Handle EPUB file
     Epub lastEpub(APP_STATE.openEpubPath, "/.crosspoint");
+    framePath = lastEpub.getCachePath() + "/" + SLEEP_FRAME_FILE;
+    if (renderCachedSleepScreen(framePath, lastEpub.getCoverBmpPath(cropped))) {
+      return;
+    }
     if (!lastEpub.load()) {
-      Serial.println("[SLP] Failed to load last epub");
+      LOG_ERR("SLP", "Failed to load last epub\n");
       return renderDefaultSleepScreen();
     }
 
     if (!lastEpub.generateCoverBmp(cropped)) {
-      Serial.println("[SLP] Failed to generate cover bmp");
+      LOG_ERR("SLP", "Failed to generate cover bmp\n");
       return renderDefaultSleepScreen();
     }
 
@@ -296,8 +374,8 @@ void SleepActivity::renderCoverSleepScreen() const {
   if (SdMan.openFileForRead("SLP", coverBmpPath, file)) {
     Bitmap bitmap(file);
     if (bitmap.parseHeaders() == BmpReaderError::Ok) {
-      Serial.printf("[SLP] Rendering sleep cover: %s\n", coverBmpPath);
-      renderBitmapSleepScreen(bitmap);
+      LOG_INF("SLP", "Rendering sleep cover: %s\n", coverBmpPath.c_str());
+      renderBitmapSleepScreen(bitmap, framePath, file.size());
       return;
     }
   }
@@ -305,6 +383,60 @@ void SleepActivity::renderCoverSleepScreen() const {
   renderDefaultSleepScreen();
 }
 
+bool SleepActivity::renderCachedSleepScreen(
+    const std::string &framePath, const std::string &coverBmpPath) const {
+  // A changed cover has a different size, or is gone with the book cache
+  const uint32_t coverSize = getFileSize(coverBmpPath);
+  if (coverSize == 0) {
+    return false;
+  }
+
+  FsFile file;
+  if (!SdMan.openFileForRead("SLP", framePath, file)) {
+    return false;
+  }
+  SleepFrameKey key;
+  uint8_t hasGreyscale;
+  serialization::readPod(file, key.version);
+  serialization::readPod(file, key.coverMode);
+  serialization::readPod(file, key.coverFilter);
+  serialization::readPod(file, key.orientation);
+  serialization::readPod(file, key.coverSize);
+  serialization::readPod(file, hasGreyscale);
+  const SleepFrameKey current = currentSleepFrameKey(renderer, coverSize);
+  const auto frameSize = static_cast<int>(GfxRenderer::getBufferSize());
+  const uint32_t planes = hasGreyscale ? 3 : 1;
+  if (key.version != current.version || key.coverMode != current.coverMode ||
+      key.coverFilter != current.coverFilter ||
+      key.orientation != current.orientation ||
+      key.coverSize != current.coverSize ||
+      file.size() != SLEEP_FRAME_HEADER_SIZE + planes * frameSize) {
+    // Composed for other settings or another cover, or never finished
+    file.close();
+    return false;
+  }
+
+  // Sequential reads straight into the frame buffer, the planes go to the
+  // panel as the bitmap passes of renderBitmapSleepScreen would send them
+  LOG_INF("SLP", "Showing stored sleep frame %s\n", framePath.c_str());
+  if (file.read(renderer.getFrameBuffer(), frameSize) != frameSize) {
+    file.close();
+    return false;
+  }
+  renderer.displayBuffer(EInkDisplay::HALF_REFRESH);
+
+  if (hasGreyscale &&
+      file.read(renderer.getFrameBuffer(), frameSize) == frameSize) {
+    renderer.copyGrayscaleLsbBuffers();
+    if (file.read(renderer.getFrameBuffer(), frameSize) == frameSize) {
+      renderer.copyGrayscaleMsbBuffers();
+      renderer.displayGrayBuffer();
+    }
+  }
+  file.close();
+  return true;
+}
+
 void SleepActivity::renderBlankSleepScreen() const {
   renderer.clearScreen();
   renderer.displayBuffer(EInkDisplay::HALF_REFRESH);
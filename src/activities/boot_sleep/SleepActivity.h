@@ -1,4 +1,6 @@
 #pragma once
+#include <string>
+
 #include "../Activity.h"
 
 class Bitmap;
@@ -14,6 +16,9 @@ class SleepActivity final : public Activity {
   void renderDefaultSleepScreen() const;
   void renderCustomSleepScreen() const;
   void renderCoverSleepScreen() const;
-  void renderBitmapSleepScreen(const Bitmap& bitmap) const;
+  // framePath, if set, receives the composed frame for renderCachedSleepScreen, keyed by the cover's file size
+  void renderBitmapSleepScreen(const Bitmap& bitmap, const std::string& framePath = "", uint32_t coverSize = 0) const;
+  // Shows a frame renderBitmapSleepScreen stored for the cover at coverBmpPath, false if there is no valid one
+  bool renderCachedSleepScreen(const std::string& framePath, const std::string& coverBmpPath) const;
   void renderBlankSleepScreen() const;
 };
@@ -1,8 +1,8 @@
 #include "OpdsBookBrowserActivity.h"
 
-#include <Epub.h>
+#include <BookCacheKey.h>
 #include <GfxRenderer.h>
-#include <HardwareSerial.h>
+#include <Logging.h>
 #include <OpdsStream.h>
 #include <WiFi.h>
 
@@ -20,15 +20,9 @@ constexpr int PAGE_ITEMS = 23;
 constexpr int SKIP_PAGE_MS = 700;
 }  // namespace
 
-void OpdsBookBrowserActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<OpdsBookBrowserActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void OpdsBookBrowserActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
   state = BrowserState::CHECK_WIFI;
   entries.clear();
   navigationHistory.clear();
@@ -36,14 +30,9 @@ void OpdsBookBrowserActivity::onEnter() {
   selectorIndex = 0;
   errorMessage.clear();
   statusMessage = "Checking WiFi...";
-  updateRequired = true;
+  renderJob.request();
 
-  xTaskCreate(&OpdsBookBrowserActivity::taskTrampoline, "OpdsBookBrowserTask",
-              4096,               // Stack size (larger for HTTP operations)
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderJob.start();
 
   // Check WiFi and connect if needed, then fetch feed
   checkAndConnectWifi();
@@ -55,13 +44,7 @@ void OpdsBookBrowserActivity::onExit() {
   // Turn off WiFi when exiting
   WiFi.mode(WIFI_OFF);
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderJob.stop();
   entries.clear();
   navigationHistory.clear();
 }
@@ -79,14 +62,14 @@ void OpdsBookBrowserActivity::loop() {
       // Check if WiFi is still connected
       if (WiFi.status() == WL_CONNECTED && WiFi.localIP() != IPAddress(0, 0, 0, 0)) {
         // WiFi connected - just retry fetching the feed
-        Serial.printf("[%lu] [OPDS] Retry: WiFi connected, retrying fetch\n", millis());
+        LOG_WRN("OPDS", "Retry: WiFi connected, retrying fetch\n");
         state = BrowserState::LOADING;
         statusMessage = "Loading...";
-        updateRequired = true;
+        renderJob.request();
         fetchFeed(currentPath);
       } else {
         // WiFi not connected - launch WiFi selection
-        Serial.printf("[%lu] [OPDS] Retry: WiFi not connected, launching selection\n", millis());
+        LOG_WRN("OPDS", "Retry: WiFi not connected, launching selection\n");
         launchWifiSelection();
       }
     } else if (mappedInput.wasReleased(MappedInputManager::Button::Back)) {
@@ -141,27 +124,15 @@ void OpdsBookBrowserActivity::loop() {
       } else {
         selectorIndex = (selectorIndex + entries.size() - 1) % entries.size();
       }
-      updateRequired = true;
+      renderJob.request();
     } else if (nextReleased && !entries.empty()) {
       if (skipPage) {
         selectorIndex = ((selectorIndex / PAGE_ITEMS + 1) * PAGE_ITEMS) % entries.size();
       } else {
         selectorIndex = (selectorIndex + 1) % entries.size();
       }
-      updateRequired = true;
-    }
-  }
-}
-
-void OpdsBookBrowserActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
+      renderJob.request();
     }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
   }
 }
 
@@ -258,12 +229,12 @@ void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
   if (strlen(serverUrl) == 0) {
     state = BrowserState::ERROR;
     errorMessage = "No server URL configured";
-    updateRequired = true;
+    renderJob.request();
     return;
   }
 
   std::string url = UrlUtils::buildUrl(serverUrl, path);
-  Serial.printf("[%lu] [OPDS] Fetching: %s\n", millis(), url.c_str());
+  LOG_INF("OPDS", "Fetching: %s\n", url.c_str());
 
   OpdsParser parser;
 
@@ -272,7 +243,7 @@ void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
     if (!HttpDownloader::fetchUrl(url, stream)) {
       state = BrowserState::ERROR;
       errorMessage = "Failed to fetch feed";
-      updateRequired = true;
+      renderJob.request();
       return;
     }
   }
@@ -280,23 +251,23 @@ void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
   if (!parser) {
     state = BrowserState::ERROR;
     errorMessage = "Failed to parse feed";
-    updateRequired = true;
+    renderJob.request();
     return;
   }
 
   entries = std::move(parser).getEntries();
-  Serial.printf("[%lu] [OPDS] Found %d entries\n", millis(), entries.size());
+  LOG_INF("OPDS", "Found %zu entries\n", entries.size());
   selectorIndex = 0;
 
   if (entries.empty()) {
     state = BrowserState::ERROR;
     errorMessage = "No entries found";
-    updateRequired = true;
+    renderJob.request();
     return;
   }
 
   state = BrowserState::BROWSING;
-  updateRequired = true;
+  renderJob.request();
 }
 
 void OpdsBookBrowserActivity::navigateToEntry(const OpdsEntry& entry) {
@@ -308,7 +279,7 @@ void OpdsBookBrowserActivity::navigateToEntry(const OpdsEntry& entry) {
   statusMessage = "Loading...";
   entries.clear();
   selectorIndex = 0;
-  updateRequired = true;
+  renderJob.request();
 
   fetchFeed(currentPath);
 }
@@ -326,7 +297,7 @@ void OpdsBookBrowserActivity::navigateBack() {
     statusMessage = "Loading...";
     entries.clear();
     selectorIndex = 0;
-    updateRequired = true;
+    renderJob.request();
 
     fetchFeed(currentPath);
   }
@@ -337,7 +308,7 @@ void OpdsBookBrowserActivity::downloadBook(const OpdsEntry& book) {
   statusMessage = book.title;
   downloadProgress = 0;
   downloadTotal = 0;
-  updateRequired = true;
+  renderJob.request();
 
   // Build full download URL
   std::string downloadUrl = UrlUtils::buildUrl(SETTINGS.opdsServerUrl, book.href);
@@ -349,29 +320,27 @@ void OpdsBookBrowserActivity::downloadBook(const OpdsEntry& book) {
   }
   std::string filename = "/" + StringUtils::sanitizeFilename(baseName) + ".epub";
 
-  Serial.printf("[%lu] [OPDS] Downloading: %s -> %s\n", millis(), downloadUrl.c_str(), filename.c_str());
+  LOG_INF("OPDS", "Downloading: %s -> %s\n", downloadUrl.c_str(), filename.c_str());
 
   const auto result =
       HttpDownloader::downloadToFile(downloadUrl, filename, [this](const size_t downloaded, const size_t total) {
         downloadProgress = downloaded;
         downloadTotal = total;
-        updateRequired = true;
+        renderJob.request();
       });
 
   if (result == HttpDownloader::OK) {
-    Serial.printf("[%lu] [OPDS] Download complete: %s\n", millis(), filename.c_str());
+    LOG_INF("OPDS", "Download complete: %s\n", filename.c_str());
 
-    // Invalidate any existing cache for this file to prevent stale metadata issues
-    Epub epub(filename, "/.crosspoint");
-    epub.clearCache();
-    Serial.printf("[%lu] [OPDS] Cleared cache for: %s\n", millis(), filename.c_str());
+    // The file may have been overwritten, its content-based cache key must be recomputed
+    BookCacheKey::forget(filename);
 
     state = BrowserState::BROWSING;
-    updateRequired = true;
+    renderJob.request();
   } else {
     state = BrowserState::ERROR;
     errorMessage = "Download failed";
-    updateRequired = true;
+    renderJob.request();
   }
 }
 
@@ -380,7 +349,7 @@ void OpdsBookBrowserActivity::checkAndConnectWifi() {
   if (WiFi.status() == WL_CONNECTED && WiFi.localIP() != IPAddress(0, 0, 0, 0)) {
     state = BrowserState::LOADING;
     statusMessage = "Loading...";
-    updateRequired = true;
+    renderJob.request();
     fetchFeed(currentPath);
     return;
   }
@@ -391,7 +360,7 @@ void OpdsBookBrowserActivity::checkAndConnectWifi() {
 
 void OpdsBookBrowserActivity::launchWifiSelection() {
   state = BrowserState::WIFI_SELECTION;
-  updateRequired = true;
+  renderJob.request();
 
   enterNewActivity(new WifiSelectionActivity(renderer, mappedInput,
                                              [this](const bool connected) { onWifiSelectionComplete(connected); }));
@@ -401,19 +370,19 @@ void OpdsBookBrowserActivity::onWifiSelectionComplete(const bool connected) {
   exitActivity();
 
   if (connected) {
-    Serial.printf("[%lu] [OPDS] WiFi connected via selection, fetching feed\n", millis());
+    LOG_INF("OPDS", "WiFi connected via selection, fetching feed\n");
     state = BrowserState::LOADING;
     statusMessage = "Loading...";
-    updateRequired = true;
+    renderJob.request();
     fetchFeed(currentPath);
   } else {
-    Serial.printf("[%lu] [OPDS] WiFi selection cancelled/failed\n", millis());
+    LOG_ERR("OPDS", "WiFi selection cancelled/failed\n");
     // Force disconnect to ensure clean state for next retry
     // This prevents stale connection status from interfering
     WiFi.disconnect();
     WiFi.mode(WIFI_OFF);
     state = BrowserState::ERROR;
     errorMessage = "WiFi connection failed";
-    updateRequired = true;
+    renderJob.request();
   }
 }
@@ -1,14 +1,12 @@
 #pragma once
 #include <OpdsParser.h>
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
 
 #include <functional>
 #include <string>
 #include <vector>
 
 #include "../ActivityWithSubactivity.h"
+#include "RenderScheduler.h"
 
 /**
  * Activity for browsing and downloading books from an OPDS server.
@@ -35,9 +33,7 @@ class OpdsBookBrowserActivity final : public ActivityWithSubactivity {
   void loop() override;
 
  private:
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  RenderJob renderJob{[this] { render(); }};
 
   BrowserState state = BrowserState::LOADING;
   std::vector<OpdsEntry> entries;
@@ -51,8 +47,6 @@ class OpdsBookBrowserActivity final : public ActivityWithSubactivity {
 
   const std::function<void()> onGoHome;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
 
   void checkAndConnectWifi();
@@ -20,12 +20,7 @@
 #include "util/StringUtils.h"
 #include <WiFi.h>
 
-void HomeActivity::taskTrampoline(void *param) {
-  auto *self = static_cast<HomeActivity *>(param);
-  self->displayTaskLoop();
-}
-
-int HomeActivity::getMenuItemCount() const {
+ int HomeActivity::getMenuItemCount() const {
   int count = 6; // Main Book, Recent, Books, Files, Transfer, Settings
   if (hasOpdsUrl)
     count++;
@@ -36,8 +31,6 @@ int HomeActivity::getMenuItemCount() const {
 void HomeActivity::onEnter() {
   Activity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
-
   // Load recent books and process top items
   const auto &allRecent = RECENT_BOOKS.getBooks();
   recentBooks.clear();
@@ -141,28 +134,15 @@ void HomeActivity::onEnter() {
   selectorIndex = 0;
 
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&HomeActivity::taskTrampoline, "HomeActivityTask",
-              4096, // Stack size (increased for cover image rendering)
-              this, // Parameters
-              1,    // Priority
-              &displayTaskHandle // Task handle
-  );
+  renderJob.request();
+
+  renderJob.start();
 }
 
 void HomeActivity::onExit() {
   Activity::onExit();
 
-  // Wait until not rendering to delete task to avoid killing mid-instruction to
-  // EPD
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderJob.stop();
 
   // Free the stored cover buffer if any
   freeCoverBuffer();
@@ -287,24 +267,12 @@ void HomeActivity::loop() {
 
   if (nextIndex != selectorIndex) {
     selectorIndex = nextIndex;
-    updateRequired = true;
+    renderJob.request();
   }
 }
 
 // onFactoryReset implementation removed
 
-void HomeActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void HomeActivity::render() {
   const auto pageWidth = renderer.getScreenWidth();
   const auto pageHeight = renderer.getScreenHeight();
@@ -369,15 +337,8 @@ void HomeActivity::render() {
                         dtLabel, false, EpdFontFamily::BOLD);
 
       // Title
-      std::string title = info.book.title;
-      if (renderer.getTextWidth(UI_10_FONT_ID, title.c_str()) > bookW - 20) {
-        while (renderer.getTextWidth(UI_10_FONT_ID, (title + "...").c_str()) >
-                   bookW - 20 &&
-               title.length() > 0) {
-          StringUtils::utf8RemoveLastChar(title);
-        }
-        title += "...";
-      }
+      const std::string title = renderer.truncatedText(
+          UI_10_FONT_ID, info.book.title.c_str(), bookW - 20);
       int tW = renderer.getTextWidth(UI_10_FONT_ID, title.c_str());
       renderer.drawText(UI_10_FONT_ID, bookX + (bookW - tW) / 2, overlayY - 25,
                         title.c_str(), true);
@@ -400,15 +361,8 @@ void HomeActivity::render() {
       if (currentY + 65 > bookY + bookH)
         break;
       const auto &book = recentBooks[i].book;
-      std::string bTitle = book.title;
-      if (renderer.getTextWidth(UI_10_FONT_ID, bTitle.c_str()) > progW - 20) {
-        while (renderer.getTextWidth(UI_10_FONT_ID, (bTitle + "...").c_str()) >
-                   progW - 20 &&
-               bTitle.length() > 0) {
-          StringUtils::utf8RemoveLastChar(bTitle);
-        }
-        bTitle += "...";
-      }
+      const std::string bTitle =
+          renderer.truncatedText(UI_10_FONT_ID, book.title.c_str(), progW - 20);
       renderer.drawText(UI_10_FONT_ID, progX + 10, currentY, bTitle.c_str(),
                         true);
       const int barY = currentY + 28;
@@ -465,54 +419,34 @@ void HomeActivity::render() {
 
     // WiFi menu logic removed
 
+    // Constant elements
+    drawButtonHints();
+    drawStatusIcons(true);
+
+    // Draw MRSLIM branding at bottom left
+    renderer.drawText(UI_12_FONT_ID, 10, pageHeight - 35, "MRSLIM", true,
+                      EpdFontFamily::BOLD);
+
     fullRedrawRequired = false;
+    // The cleared screen lost the selector
+    lastRenderedSelectorIndex = -1;
   }
 
-  // Draw selector logic for selective refresh...
-
-  // Selective Partial Refresh for Selection Box
+  // Only the two selector borders change when the selection moves, present()
+  // refreshes just the window around them
   if (selectorIndex != lastRenderedSelectorIndex) {
+    const int hintsY = pageHeight - 40;
+    bool hintsOverdrawn = false;
     auto drawSelector = [&](int idx, bool state) {
-      const auto pageWidth = renderer.getScreenWidth();
-      const int midX = pageWidth / 2;
-      const int margin = 10;
-      const int yStatusBar = 35;
-      const int topH = 360;
-      const int gridRowH = 160;
-
-      int x, y, w, h;
-      if (idx == 0) { // Main Book
-        x = margin;
-        y = yStatusBar;
-        w = midX - 1.5 * margin;
-        h = topH;
-      } else if (idx == 1) { // Progress List
-        x = midX + 0.5 * margin;
-        y = yStatusBar;
-        w = pageWidth - x - margin;
-        h = topH;
-      } else { // Grid items
-        int gridIdx = idx - 2;
-        int row = (gridIdx / 2) + 1;
-        int col = gridIdx % 2;
-
-        int itemCount = getMenuItemCount() - 2;
-        if (gridIdx == itemCount - 1 && itemCount % 2 != 0) {
-          // Centered last item logic
-          w = midX - 1.5 * margin;
-          x = (pageWidth - w) / 2;
-        } else {
-          x = (col == 0) ? margin : midX + 0.5 * margin;
-          w = (col == 0) ? midX - 1.5 * margin : pageWidth - x - margin;
-        }
-        y = yStatusBar + topH + margin + (row - 1) * gridRowH;
-        h = gridRowH - 12;
-      }
-
+      const GfxRenderer::Rect rect = getSelectorRect(idx);
       // Thick border (3 pixels)
-      renderer.drawRect(x - 1, y - 1, w + 2, h + 2, state);
-      renderer.drawRect(x - 2, y - 2, w + 4, h + 4, state);
-      renderer.drawRect(x - 3, y - 3, w + 6, h + 6, state);
+      renderer.drawRect(rect.x - 1, rect.y - 1, rect.width + 2,
+                        rect.height + 2, state);
+      renderer.drawRect(rect.x - 2, rect.y - 2, rect.width + 4,
+                        rect.height + 4, state);
+      renderer.drawRect(rect.x - 3, rect.y - 3, rect.width + 6,
+                        rect.height + 6, state);
+      hintsOverdrawn = hintsOverdrawn || rect.y + rect.height + 3 > hintsY;
     };
 
     if (lastRenderedSelectorIndex != -1) {
@@ -520,49 +454,119 @@ void HomeActivity::render() {
     }
     drawSelector(selectorIndex, true);
     lastRenderedSelectorIndex = selectorIndex;
-    renderer.displayBuffer(EInkDisplay::FAST_REFRESH);
+    // The bottom grid row reaches into the hints, erasing its border cuts them
+    if (hintsOverdrawn) {
+      drawButtonHints();
+    }
   }
 
-  // Constant elements
+  // Battery and WiFi were drawn with the rest of the screen, a partial update
+  // redraws them when they changed
+  drawStatusIcons(false);
+
+  renderer.present(EInkDisplay::FAST_REFRESH);
+}
+
+GfxRenderer::Rect HomeActivity::getSelectorRect(const int idx) const {
+  const auto pageWidth = renderer.getScreenWidth();
+  const int midX = pageWidth / 2;
+  const int margin = 10;
+  const int yStatusBar = 35;
+  const int topH = 360;
+  const int gridRowH = 160;
+
+  int x, y, w, h;
+  if (idx == 0) { // Main Book
+    x = margin;
+    y = yStatusBar;
+    w = midX - 1.5 * margin;
+    h = topH;
+  } else if (idx == 1) { // Progress List
+    x = midX + 0.5 * margin;
+    y = yStatusBar;
+    w = pageWidth - x - margin;
+    h = topH;
+  } else { // Grid items
+    int gridIdx = idx - 2;
+    int row = (gridIdx / 2) + 1;
+    int col = gridIdx % 2;
+
+    int itemCount = getMenuItemCount() - 2;
+    if (gridIdx == itemCount - 1 && itemCount % 2 != 0) {
+      // Centered last item logic
+      w = midX - 1.5 * margin;
+      x = (pageWidth - w) / 2;
+    } else {
+      x = (col == 0) ? margin : midX + 0.5 * margin;
+      w = (col == 0) ? midX - 1.5 * margin : pageWidth - x - margin;
+    }
+    y = yStatusBar + topH + margin + (row - 1) * gridRowH;
+    h = gridRowH - 12;
+  }
+  return {x, y, w, h};
+}
+
+void HomeActivity::drawButtonHints() {
   const auto hints = mappedInput.mapLabels("", "Chọn", "Trái", "Phải");
   renderer.drawButtonHints(UI_10_FONT_ID, hints.btn1, hints.btn2, hints.btn3,
                            hints.btn4);
+}
 
+void HomeActivity::drawStatusIcons(const bool fullRedraw) {
   const uint16_t percentage = battery.readPercentage();
+  const int bars = getWifiBars();
+  if (!fullRedraw && percentage == lastBatteryPercentage &&
+      bars == lastWifiBars) {
+    return;
+  }
+  lastBatteryPercentage = percentage;
+  lastWifiBars = bars;
+
+  const int pageWidth = renderer.getScreenWidth();
+  if (!fullRedraw) {
+    // Cleared from where the widest percentage would put the WiFi bars, so
+    // nothing of the old icons is left
+    const int statusX = pageWidth - 25 -
+                        renderer.getTextWidth(SMALL_FONT_ID, "100%") - 35;
+    renderer.fillRect(statusX, 10, pageWidth - statusX,
+                      std::max(renderer.getLineHeight(SMALL_FONT_ID), 18),
+                      false);
+  }
+
   const std::string pctStr = std::to_string(percentage) + "%";
-  const int batteryX = renderer.getScreenWidth() - 25 -
-                       renderer.getTextWidth(SMALL_FONT_ID, pctStr.c_str());
+  const int batteryX =
+      pageWidth - 25 - renderer.getTextWidth(SMALL_FONT_ID, pctStr.c_str());
 
   // Draw WiFi signal to the left of battery (leave 35px for bars)
-  drawWifiSignal(batteryX - 35);
-
-  ScreenComponents::drawBattery(renderer, batteryX, 10, true);
+  drawWifiSignal(batteryX - 35, bars);
 
-  // Draw MRSLIM branding at bottom left
-  renderer.drawText(UI_12_FONT_ID, 10, pageHeight - 35, "MRSLIM", true,
-                    EpdFontFamily::BOLD);
+  ScreenComponents::drawBattery(renderer, batteryX, 10, true, percentage);
+}
 
-  renderer.displayBuffer(EInkDisplay::FAST_REFRESH);
+int HomeActivity::getWifiBars() const {
+  if (WiFi.status() != WL_CONNECTED) {
+    return -1;
+  }
+  int32_t rssi = WiFi.RSSI();
+  if (rssi >= -50)
+    return 4;
+  if (rssi >= -60)
+    return 3;
+  if (rssi >= -70)
+    return 2;
+  if (rssi >= -80)
+    return 1;
+  return 0;
 }
 
-void HomeActivity::drawWifiSignal(int xRoot) {
-  if (WiFi.status() == WL_CONNECTED) {
-    int32_t rssi = WiFi.RSSI();
-    int bars = 0;
-    if (rssi >= -50)
-      bars = 4;
-    else if (rssi >= -60)
-      bars = 3;
-    else if (rssi >= -70)
-      bars = 2;
-    else if (rssi >= -80)
-      bars = 1;
-
-    const int yRoot = 10;
-    for (int i = 0; i < 4; i++) {
-      int h = (i + 1) * 4;
-      renderer.fillRect(xRoot + i * 6, yRoot + (16 - h), 4, h, i < bars);
-    }
+void HomeActivity::drawWifiSignal(int xRoot, int bars) {
+  if (bars < 0) {
+    return;
+  }
+  const int yRoot = 10;
+  for (int i = 0; i < 4; i++) {
+    int h = (i + 1) * 4;
+    renderer.fillRect(xRoot + i * 6, yRoot + (16 - h), 4, h, i < bars);
   }
 }
 
@@ -1,7 +1,6 @@
 #pragma once
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
+
+#include <GfxRenderer.h>
 
 #include <functional>
 #include <string>
@@ -10,16 +9,18 @@
 #include "../../MappedInputManager.h"
 #include "../Activity.h"
 #include "RecentBooksStore.h"
+#include "RenderScheduler.h"
 
 class HomeActivity final : public Activity {
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
+  RenderJob renderJob{[this] { render(); }};
   int selectorIndex = 0;
-  bool updateRequired = false;
   bool hasContinueReading = false;
   bool hasOpdsUrl = false;
   mutable int lastRenderedSelectorIndex = -1;
   mutable bool fullRedrawRequired = true;
+  // What the status icons show, -1 bars when WiFi is not connected
+  int lastBatteryPercentage = -1;
+  int lastWifiBars = -1;
   bool isWifiMenuUnlocked = false;
   std::vector<MappedInputManager::Button> inputSequence;
 
@@ -44,14 +45,16 @@ class HomeActivity final : public Activity {
   const std::function<void()> onWifiSettingsOpen;
   const std::function<void()> onWeatherSettingsOpen;
 
-  static void taskTrampoline(void *param);
-  [[noreturn]] void displayTaskLoop();
   void render();
   int getMenuItemCount() const;
   bool storeCoverBuffer();   // Store frame frame buffer for cover image
   bool restoreCoverBuffer(); // Restore frame buffer from stored cover
   void freeCoverBuffer();    // Free the stored cover buffer
-  void drawWifiSignal(int xRoot);
+  GfxRenderer::Rect getSelectorRect(int idx) const;
+  void drawButtonHints();
+  void drawStatusIcons(bool fullRedraw);
+  int getWifiBars() const;
+  void drawWifiSignal(int xRoot, int bars);
   void drawWeatherInfo();
 
 public:
@@ -75,4 +78,5 @@ public:
   void onEnter() override;
   void onExit() override;
   void loop() override;
+  bool allowIdleMaintenance() override { return true; }
 };
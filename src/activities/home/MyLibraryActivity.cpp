@@ -2,10 +2,12 @@
 
 #include <Epub.h> // Include proper header
 #include <GfxRenderer.h>
+#include <Logging.h>
 #include <SDCardManager.h>
 
 #include <algorithm>
 
+#include "LibraryCatalog.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
 #include "ScreenComponents.h"
@@ -173,64 +175,40 @@ void MyLibraryActivity::loadFiles() {
 void MyLibraryActivity::loadBooksFromDir() {
   gridBooks.clear();
 
-  // Create /books and /cover directories if they don't exist
-  if (!SdMan.exists("/books")) {
-    SdMan.mkdir("/books");
-  }
-  if (!SdMan.exists("/cover")) {
-    SdMan.mkdir("/cover");
+  // Create /cover directory if it doesn't exist (/books is handled by the
+  // catalog)
+  if (!SdMan.exists(LibraryCatalog::THUMB_CACHE_DIR)) {
+    SdMan.mkdir(LibraryCatalog::THUMB_CACHE_DIR);
   }
 
-  auto root = SdMan.open("/books");
-  if (!root || !root.isDirectory()) {
-    if (root)
-      root.close();
-    return;
-  }
-
-  root.rewindDirectory();
-  char name[500];
-  while (auto file = root.openNextFile()) {
-    if (file.isDirectory()) {
-      file.close();
-      continue;
+  // Diff the persistent catalog against /books; unchanged books cost nothing
+  LIBRARY_CATALOG.refresh();
+
+  const auto &entries = LIBRARY_CATALOG.getEntries();
+  gridBooks.reserve(entries.size());
+  for (const auto &entry : entries) {
+    BookItem item;
+    item.path = entry.path;
+    // Title from the book's metadata once it was indexed, the file name until
+    // then
+    item.title = entry.title.empty()
+                     ? entry.path.substr(entry.path.find_last_of('/') + 1)
+                     : entry.title;
+    item.coverPath = LibraryCatalog::getThumbPath(entry);
+
+    if (entry.thumbState == LibraryCatalog::ThumbState::Missing) {
+      item.checked = true;
+    } else if (entry.thumbState == LibraryCatalog::ThumbState::Ready) {
+      item.coverChecked = true;
+      item.hasCover = true;
     }
 
-    file.getName(name, sizeof(name));
-    file.close();
-
-    std::string filename(name);
-    if (filename[0] == '.')
-      continue;
-
-    if (StringUtils::checkFileExtension(filename, ".epub") ||
-        StringUtils::checkFileExtension(filename, ".xtc") ||
-        StringUtils::checkFileExtension(filename, ".xtch") ||
-        StringUtils::checkFileExtension(filename, ".txt")) {
-
-      // Create BookItem
-      BookItem item;
-      item.title = filename;
-      item.path = std::string("/books/") + filename;
-
-      // Use thumbnail for grid view
-      Epub tempEpub(item.path, "/cover");
-      item.coverPath = tempEpub.getThumbBmpPath();
-
-      // Persistent check: if .no marker exists, don't try again
-      if (SdMan.exists((item.coverPath + ".no").c_str())) {
-        item.checked = true;
-      } else if (SdMan.exists(item.coverPath.c_str())) {
-        item.coverChecked = true;
-        item.hasCover = true;
-      }
-
-      gridBooks.push_back(item);
-    }
+    gridBooks.push_back(std::move(item));
   }
-  root.close();
 
-  // Sort books alphabetically
+  // Sort books alphabetically by the title shown. Titles the cover task reads
+  // later keep their place until the grid is loaded again, so the selection
+  // does not move under the user.
   std::sort(
       gridBooks.begin(), gridBooks.end(),
       [](const BookItem &a, const BookItem &b) { return a.title < b.title; });
@@ -254,11 +232,6 @@ size_t MyLibraryActivity::findEntry(const std::string &name) const {
   return 0;
 }
 
-void MyLibraryActivity::taskTrampoline(void *param) {
-  auto *self = static_cast<MyLibraryActivity *>(param);
-  self->displayTaskLoop();
-}
-
 void MyLibraryActivity::coverTaskTrampoline(void *param) {
   auto *self = static_cast<MyLibraryActivity *>(param);
   self->coverTaskLoop();
@@ -267,8 +240,6 @@ void MyLibraryActivity::coverTaskTrampoline(void *param) {
 void MyLibraryActivity::onEnter() {
   Activity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
-
   // Load data for both tabs
   // Load data for all tabs
   loadRecentBooks();
@@ -284,14 +255,9 @@ void MyLibraryActivity::onEnter() {
 
   selectorIndex = 0;
   generatingBookIndex = -1;
-  updateRequired = true;
+  renderJob.request();
 
-  xTaskCreate(&MyLibraryActivity::taskTrampoline, "MyLibraryActivityTask",
-              4096, // Stack size (increased for epub metadata loading)
-              this, // Parameters
-              1,    // Priority
-              &displayTaskHandle // Task handle
-  );
+  renderJob.start();
 
   // Create low priority background task for cover generation
   // Stack size needs to be large enough for Epub processing
@@ -305,21 +271,19 @@ void MyLibraryActivity::onEnter() {
 void MyLibraryActivity::onExit() {
   Activity::onExit();
 
-  // Wait until not rendering to delete task to avoid killing mid-instruction to
-  // EPD
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  renderJob.stop();
 
+  // Holding the lock, the cover task is not in the middle of generating a
+  // thumbnail
+  RENDER_SCHEDULER.lock();
   if (coverTaskHandle) {
     vTaskDelete(coverTaskHandle);
     coverTaskHandle = nullptr;
   }
+  RENDER_SCHEDULER.unlock();
 
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  // Persist thumbnail results gathered by the cover task
+  LIBRARY_CATALOG.saveIfDirty();
 
   bookTitles.clear();
   bookPaths.clear();
@@ -339,7 +303,7 @@ void MyLibraryActivity::loop() {
       basepath = "/";
       loadFiles();
       selectorIndex = 0;
-      updateRequired = true;
+      renderJob.request();
     }
     return;
   }
@@ -378,7 +342,7 @@ void MyLibraryActivity::loop() {
               files[selectorIndex].substr(0, files[selectorIndex].length() - 1);
           loadFiles();
           selectorIndex = 0;
-          updateRequired = true;
+          renderJob.request();
         } else {
           // Open file
           onSelectBook(basepath + files[selectorIndex], currentTab);
@@ -404,7 +368,7 @@ void MyLibraryActivity::loop() {
         const std::string dirName = oldPath.substr(pos + 1) + "/";
         selectorIndex = static_cast<int>(findEntry(dirName));
 
-        updateRequired = true;
+        renderJob.request();
       } else {
         // Go home
         onGoHome();
@@ -415,31 +379,33 @@ void MyLibraryActivity::loop() {
 
   // Navigation Logic (Directional Grid)
   if (currentTab == Tab::Books) {
+    bool moved = false;
     if (leftReleased) {
       if (selectorIndex % 2 != 0) {
         selectorIndex--;
-        updateRequired = true;
+        moved = true;
       }
     } else if (rightReleased) {
       if (selectorIndex % 2 == 0 && selectorIndex + 1 < itemCount) {
         selectorIndex++;
-        updateRequired = true;
+        moved = true;
       }
     } else if (upReleased && itemCount > 0) {
       int newIndex = selectorIndex - 2;
       if (newIndex >= 0) {
         selectorIndex = newIndex;
-        updateRequired = true;
+        moved = true;
       }
     } else if (downReleased && itemCount > 0) {
       int newIndex = selectorIndex + 2;
       if (newIndex < itemCount) {
         selectorIndex = newIndex;
-        updateRequired = true;
+        moved = true;
       }
     }
 
-    if (updateRequired) {
+    if (moved) {
+      renderJob.request();
       ensureCoversForPage(getCurrentPage());
       return;
     }
@@ -459,7 +425,7 @@ void MyLibraryActivity::loop() {
       } else {
         selectorIndex = (selectorIndex + itemCount - 1) % itemCount;
       }
-      updateRequired = true;
+      renderJob.request();
     } else if (nextReleased && itemCount > 0) {
       if (skipPage) {
         selectorIndex =
@@ -467,23 +433,11 @@ void MyLibraryActivity::loop() {
       } else {
         selectorIndex = (selectorIndex + 1) % itemCount;
       }
-      updateRequired = true;
+      renderJob.request();
     }
   }
 }
 
-void MyLibraryActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void MyLibraryActivity::coverTaskLoop() {
   while (true) {
     // Wait for a request (notification)
@@ -516,49 +470,50 @@ void MyLibraryActivity::coverTaskLoop() {
       if (SdMan.exists(book.coverPath.c_str())) {
         book.coverChecked = true;
         book.hasCover = true;
+        LIBRARY_CATALOG.setThumbState(book.path,
+                                      LibraryCatalog::ThumbState::Ready);
         continue;
       }
 
       // Found a missing cover. Mark as generating and request update to show
       // "Loading..."
       generatingBookIndex = i;
-      updateRequired = true;
+      renderJob.request(RenderScheduler::Priority::Background);
 
       // Small delay to allow UI to show "Loading..."
       vTaskDelay(100 / portTICK_PERIOD_MS);
 
       // Generate
-      Serial.printf("[CoverGen] Generating for %s\n", book.title.c_str());
+      LOG_INF("CoverGen", "Generating for %s\n", book.title.c_str());
 
       bool success = false;
       // Heavy lifting with mutex lock for SD access safety
-      if (renderingMutex) {
-        xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      RENDER_SCHEDULER.lock();
+      if (StringUtils::checkFileExtension(book.path, ".epub")) {
         Epub epub(book.path, "/cover");
-        if (StringUtils::checkFileExtension(book.path, ".epub")) {
-          if (epub.load(true)) {
-            success = epub.generateThumbBmp();
+        if (epub.load(true)) {
+          success = epub.generateThumbBmp();
+          if (!epub.getTitle().empty()) {
+            LIBRARY_CATALOG.setMetadata(book.path, epub.getTitle(),
+                                        epub.getAuthor());
+            book.title = epub.getTitle();
           }
         }
-
-        if (!success) {
-          // Persistent "No Cover" marker
-          epub.setupCacheDir();
-          FsFile noFile;
-          if (SdMan.openFileForWrite("EPUB", book.coverPath + ".no", noFile)) {
-            noFile.close();
-          }
-        }
-        xSemaphoreGive(renderingMutex);
       }
 
+      // Persistent result (including "No Cover") lives in the catalog
+      LIBRARY_CATALOG.setThumbState(
+          book.path, success ? LibraryCatalog::ThumbState::Ready
+                             : LibraryCatalog::ThumbState::Missing);
+      RENDER_SCHEDULER.unlock();
+
       // Mark as checked regardless of success to prevent re-tries
       book.checked = true;
       book.coverChecked = true;
       book.hasCover = success;
       generatingBookIndex = -1;
       fullRedrawRequired = true;
-      updateRequired = true;
+      renderJob.request(RenderScheduler::Priority::Background);
 
       // Smaller delay between books for better performance
       vTaskDelay(50 / portTICK_PERIOD_MS);
@@ -612,9 +567,10 @@ void MyLibraryActivity::render() const {
     fullRedrawRequired = false;
     lastRenderedPage = currentPage;
     lastRenderedSelectorIndex = selectorIndex;
-    renderer.displayBuffer(EInkDisplay::FAST_REFRESH);
+    renderer.present(EInkDisplay::FAST_REFRESH);
   } else if (selectorIndex != lastRenderedSelectorIndex) {
-    // PARTIAL REDRAW (of buffer highlights)
+    // PARTIAL REDRAW (of buffer highlights), present() refreshes only the
+    // window around the old and new selection
     if (currentTab == Tab::Books) {
       // Books grid partial update
       const int pageItems = 4;
@@ -681,7 +637,7 @@ void MyLibraryActivity::render() const {
     }
 
     lastRenderedSelectorIndex = selectorIndex;
-    renderer.displayBuffer(EInkDisplay::FAST_REFRESH);
+    renderer.present(EInkDisplay::FAST_REFRESH);
   }
 }
 
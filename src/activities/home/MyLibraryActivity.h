@@ -1,6 +1,5 @@
 #pragma once
 #include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
 #include <freertos/task.h>
 
 #include <functional>
@@ -8,6 +7,7 @@
 #include <vector>
 
 #include "../Activity.h"
+#include "RenderScheduler.h"
 
 class MyLibraryActivity final : public Activity {
 public:
@@ -23,16 +23,14 @@ private:
     bool checked = false; // Persistent "no cover" check
   };
 
-  TaskHandle_t displayTaskHandle = nullptr;
+  RenderJob renderJob{[this] { render(); }};
   TaskHandle_t coverTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
 
   volatile int pageToRequest = -1;       // -1 = none
   volatile int generatingBookIndex = -1; // -1 = none
 
   Tab currentTab = Tab::Books;
   int selectorIndex = 0;
-  bool updateRequired = false;
 
   mutable int lastRenderedSelectorIndex = -1;
   mutable int lastRenderedPage = -1;
@@ -67,10 +65,6 @@ private:
   void loadFiles();
   size_t findEntry(const std::string &name) const;
 
-  // Rendering
-  static void taskTrampoline(void *param);
-  [[noreturn]] void displayTaskLoop();
-
   static void coverTaskTrampoline(void *param);
   [[noreturn]] void coverTaskLoop();
 
@@ -2,6 +2,7 @@
 
 #include <ESPmDNS.h>
 #include <GfxRenderer.h>
+#include <Logging.h>
 #include <WiFi.h>
 #include <esp_task_wdt.h>
 
@@ -14,16 +15,10 @@ namespace {
 constexpr const char *HOSTNAME = "crosspoint";
 } // namespace
 
-void CalibreConnectActivity::taskTrampoline(void *param) {
-  auto *self = static_cast<CalibreConnectActivity *>(param);
-  self->displayTaskLoop();
-}
-
 void CalibreConnectActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
-  updateRequired = true;
+  renderJob.request();
   state = CalibreConnectState::WIFI_SELECTION;
   connectedIP.clear();
   connectedSSID.clear();
@@ -35,12 +30,7 @@ void CalibreConnectActivity::onEnter() {
   lastCompleteAt = 0;
   exitRequested = false;
 
-  xTaskCreate(&CalibreConnectActivity::taskTrampoline, "CalibreConnectTask",
-              2048,              // Stack size
-              this,              // Parameters
-              1,                 // Priority
-              &displayTaskHandle // Task handle
-  );
+  renderJob.start();
 
   if (WiFi.status() != WL_CONNECTED) {
     enterNewActivity(new WifiSelectionActivity(
@@ -65,13 +55,7 @@ void CalibreConnectActivity::onExit() {
   WiFi.mode(WIFI_OFF);
   delay(30);
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderJob.stop();
 }
 
 void CalibreConnectActivity::onWifiSelectionComplete(const bool connected) {
@@ -94,12 +78,11 @@ void CalibreConnectActivity::onWifiSelectionComplete(const bool connected) {
 
 void CalibreConnectActivity::startWebServer() {
   state = CalibreConnectState::SERVER_STARTING;
-  updateRequired = true;
+  renderJob.request();
 
   if (MDNS.begin(HOSTNAME)) {
     // mDNS is optional for the Calibre plugin but still helpful for users.
-    Serial.printf("[%lu] [CAL] mDNS started: http://%s.local/\n", millis(),
-                  HOSTNAME);
+    LOG_INF("CAL", "mDNS started: http://%s.local/\n", HOSTNAME);
   }
 
   webServer.reset(new CrossPointWebServer());
@@ -107,10 +90,10 @@ void CalibreConnectActivity::startWebServer() {
 
   if (webServer->isRunning()) {
     state = CalibreConnectState::SERVER_RUNNING;
-    updateRequired = true;
+    renderJob.request();
   } else {
     state = CalibreConnectState::ERROR;
-    updateRequired = true;
+    renderJob.request();
   }
 }
 
@@ -135,8 +118,8 @@ void CalibreConnectActivity::loop() {
     const unsigned long timeSinceLastHandleClient =
         millis() - lastHandleClientTime;
     if (lastHandleClientTime > 0 && timeSinceLastHandleClient > 100) {
-      Serial.printf("[%lu] [CAL] WARNING: %lu ms gap since last handleClient\n",
-                    millis(), timeSinceLastHandleClient);
+      LOG_WRN("CAL", "WARNING: %lu ms gap since last handleClient\n",
+              timeSinceLastHandleClient);
     }
 
     esp_task_wdt_reset();
@@ -184,7 +167,7 @@ void CalibreConnectActivity::loop() {
       changed = true;
     }
     if (changed) {
-      updateRequired = true;
+      renderJob.request();
     }
   }
 
@@ -194,18 +177,6 @@ void CalibreConnectActivity::loop() {
   }
 }
 
-void CalibreConnectActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void CalibreConnectActivity::render() const {
   if (state == CalibreConnectState::SERVER_RUNNING) {
     renderer.clearScreen();
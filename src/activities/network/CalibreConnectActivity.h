@@ -1,12 +1,10 @@
 #pragma once
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
 
 #include <functional>
 #include <memory>
 #include <string>
 
+#include "RenderScheduler.h"
 #include "activities/ActivityWithSubactivity.h"
 #include "network/CrossPointWebServer.h"
 
@@ -17,9 +15,7 @@ enum class CalibreConnectState { WIFI_SELECTION, SERVER_STARTING, SERVER_RUNNING
  * but renders Calibre-specific instructions instead of the web transfer UI.
  */
 class CalibreConnectActivity final : public ActivityWithSubactivity {
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  RenderJob renderJob{[this] { render(); }};
   CalibreConnectState state = CalibreConnectState::WIFI_SELECTION;
   const std::function<void()> onComplete;
 
@@ -34,8 +30,6 @@ class CalibreConnectActivity final : public ActivityWithSubactivity {
   unsigned long lastCompleteAt = 0;
   bool exitRequested = false;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
   void renderServerRunning() const;
 
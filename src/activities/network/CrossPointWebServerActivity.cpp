@@ -3,6 +3,7 @@
 #include <DNSServer.h>
 #include <ESPmDNS.h>
 #include <GfxRenderer.h>
+#include <Logging.h>
 #include <WiFi.h>
 #include <esp_task_wdt.h>
 #include <qrcode.h>
@@ -14,6 +15,7 @@
 #include "WifiSelectionActivity.h"
 #include "activities/network/CalibreConnectActivity.h"
 #include "fontIds.h"
+#include "services/BookIngestService.h"
 
 namespace {
 // AP Mode configuration
@@ -28,18 +30,11 @@ DNSServer *dnsServer = nullptr;
 constexpr uint16_t DNS_PORT = 53;
 } // namespace
 
-void CrossPointWebServerActivity::taskTrampoline(void *param) {
-  auto *self = static_cast<CrossPointWebServerActivity *>(param);
-  self->displayTaskLoop();
-}
-
 void CrossPointWebServerActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
-  Serial.printf("[%lu] [WEBACT] [MEM] Free heap at onEnter: %d bytes\n",
-                millis(), ESP.getFreeHeap());
-
-  renderingMutex = xSemaphoreCreateMutex();
+  LOG_DBG("WEBACT", "[MEM] Free heap at onEnter: %d bytes\n",
+          ESP.getFreeHeap());
 
   // Reset state
   state = WebServerActivityState::MODE_SELECTION;
@@ -48,19 +43,12 @@ void CrossPointWebServerActivity::onEnter() {
   connectedIP.clear();
   connectedSSID.clear();
   lastHandleClientTime = 0;
-  updateRequired = true;
+  renderJob.request();
 
-  xTaskCreate(&CrossPointWebServerActivity::taskTrampoline,
-              "WebServerActivityTask",
-              2048,              // Stack size
-              this,              // Parameters
-              1,                 // Priority
-              &displayTaskHandle // Task handle
-  );
+  renderJob.start();
 
   // Launch network mode selection subactivity
-  Serial.printf("[%lu] [WEBACT] Launching NetworkModeSelectionActivity...\n",
-                millis());
+  LOG_DBG("WEBACT", "Launching NetworkModeSelectionActivity...\n");
   enterNewActivity(new NetworkModeSelectionActivity(
       renderer, mappedInput,
       [this](const NetworkMode mode) { onNetworkModeSelected(mode); },
@@ -71,8 +59,8 @@ void CrossPointWebServerActivity::onEnter() {
 void CrossPointWebServerActivity::onExit() {
   ActivityWithSubactivity::onExit();
 
-  Serial.printf("[%lu] [WEBACT] [MEM] Free heap at onExit start: %d bytes\n",
-                millis(), ESP.getFreeHeap());
+  LOG_DBG("WEBACT", "[MEM] Free heap at onExit start: %d bytes\n",
+          ESP.getFreeHeap());
 
   state = WebServerActivityState::SHUTTING_DOWN;
 
@@ -84,7 +72,7 @@ void CrossPointWebServerActivity::onExit() {
 
   // Stop DNS server if running (AP mode)
   if (dnsServer) {
-    Serial.printf("[%lu] [WEBACT] Stopping DNS server...\n", millis());
+    LOG_DBG("WEBACT", "Stopping DNS server...\n");
     dnsServer->stop();
     delete dnsServer;
     dnsServer = nullptr;
@@ -95,46 +83,28 @@ void CrossPointWebServerActivity::onExit() {
 
   // Disconnect WiFi gracefully
   if (isApMode) {
-    Serial.printf("[%lu] [WEBACT] Stopping WiFi AP...\n", millis());
+    LOG_DBG("WEBACT", "Stopping WiFi AP...\n");
     WiFi.softAPdisconnect(true);
   } else {
-    Serial.printf("[%lu] [WEBACT] Disconnecting WiFi (graceful)...\n",
-                  millis());
+    LOG_DBG("WEBACT", "Disconnecting WiFi (graceful)...\n");
     WiFi.disconnect(
         false); // false = don't erase credentials, send disconnect frame
   }
   delay(30); // Allow disconnect frame to be sent
 
-  Serial.printf("[%lu] [WEBACT] Setting WiFi mode OFF...\n", millis());
+  LOG_DBG("WEBACT", "Setting WiFi mode OFF...\n");
   WiFi.mode(WIFI_OFF);
   delay(30); // Allow WiFi hardware to power down
 
-  Serial.printf(
-      "[%lu] [WEBACT] [MEM] Free heap after WiFi disconnect: %d bytes\n",
-      millis(), ESP.getFreeHeap());
-
-  // Acquire mutex before deleting task
-  Serial.printf(
-      "[%lu] [WEBACT] Acquiring rendering mutex before task deletion...\n",
-      millis());
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-
-  // Delete the display task
-  Serial.printf("[%lu] [WEBACT] Deleting display task...\n", millis());
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-    Serial.printf("[%lu] [WEBACT] Display task deleted\n", millis());
-  }
+  LOG_DBG("WEBACT", "[MEM] Free heap after WiFi disconnect: %d bytes\n",
+          ESP.getFreeHeap());
 
-  // Delete the mutex
-  Serial.printf("[%lu] [WEBACT] Deleting mutex...\n", millis());
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
-  Serial.printf("[%lu] [WEBACT] Mutex deleted\n", millis());
+  // Waits for a render in progress
+  LOG_DBG("WEBACT", "Stopping render job...\n");
+  renderJob.stop();
 
-  Serial.printf("[%lu] [WEBACT] [MEM] Free heap at onExit end: %d bytes\n",
-                millis(), ESP.getFreeHeap());
+  LOG_DBG("WEBACT", "[MEM] Free heap at onExit end: %d bytes\n",
+          ESP.getFreeHeap());
 }
 
 void CrossPointWebServerActivity::onNetworkModeSelected(
@@ -145,8 +115,7 @@ void CrossPointWebServerActivity::onNetworkModeSelected(
   } else if (mode == NetworkMode::CREATE_HOTSPOT) {
     modeName = "Tạo điểm phát sóng";
   }
-  Serial.printf("[%lu] [WEBACT] Network mode selected: %s\n", millis(),
-                modeName);
+  LOG_INF("WEBACT", "Network mode selected: %s\n", modeName);
 
   networkMode = mode;
   isApMode = (mode == NetworkMode::CREATE_HOTSPOT);
@@ -171,28 +140,26 @@ void CrossPointWebServerActivity::onNetworkModeSelected(
 
   if (mode == NetworkMode::JOIN_NETWORK) {
     // STA mode - launch WiFi selection
-    Serial.printf("[%lu] [WEBACT] Turning on WiFi (STA mode)...\n", millis());
+    LOG_INF("WEBACT", "Turning on WiFi (STA mode)...\n");
     WiFi.mode(WIFI_STA);
 
     state = WebServerActivityState::WIFI_SELECTION;
-    Serial.printf("[%lu] [WEBACT] Launching WifiSelectionActivity...\n",
-                  millis());
+    LOG_DBG("WEBACT", "Launching WifiSelectionActivity...\n");
     enterNewActivity(new WifiSelectionActivity(
         renderer, mappedInput,
         [this](const bool connected) { onWifiSelectionComplete(connected); }));
   } else {
     // AP mode - start access point
     state = WebServerActivityState::AP_STARTING;
-    updateRequired = true;
+    renderJob.request();
     startAccessPoint();
   }
 }
 
 void CrossPointWebServerActivity::onWifiSelectionComplete(
     const bool connected) {
-  Serial.printf(
-      "[%lu] [WEBACT] WifiSelectionActivity completed, connected=%d\n",
-      millis(), connected);
+  LOG_INF("WEBACT", "WifiSelectionActivity completed, connected=%d\n",
+          connected);
 
   if (connected) {
     // Get connection info before exiting subactivity
@@ -205,8 +172,7 @@ void CrossPointWebServerActivity::onWifiSelectionComplete(
 
     // Start mDNS for hostname resolution
     if (MDNS.begin(AP_HOSTNAME)) {
-      Serial.printf("[%lu] [WEBACT] mDNS started: http://%s.local/\n", millis(),
-                    AP_HOSTNAME);
+      LOG_INF("WEBACT", "mDNS started: http://%s.local/\n", AP_HOSTNAME);
     }
 
     // Start the web server
@@ -223,9 +189,9 @@ void CrossPointWebServerActivity::onWifiSelectionComplete(
 }
 
 void CrossPointWebServerActivity::startAccessPoint() {
-  Serial.printf("[%lu] [WEBACT] Starting Access Point mode...\n", millis());
-  Serial.printf("[%lu] [WEBACT] [MEM] Free heap before AP start: %d bytes\n",
-                millis(), ESP.getFreeHeap());
+  LOG_INF("WEBACT", "Starting Access Point mode...\n");
+  LOG_DBG("WEBACT", "[MEM] Free heap before AP start: %d bytes\n",
+          ESP.getFreeHeap());
 
   // Configure and start the AP
   WiFi.mode(WIFI_AP);
@@ -243,8 +209,7 @@ void CrossPointWebServerActivity::startAccessPoint() {
   }
 
   if (!apStarted) {
-    Serial.printf("[%lu] [WEBACT] ERROR: Failed to start Access Point!\n",
-                  millis());
+    LOG_ERR("WEBACT", "ERROR: Failed to start Access Point!\n");
     onGoBack();
     return;
   }
@@ -259,16 +224,15 @@ void CrossPointWebServerActivity::startAccessPoint() {
   connectedIP = ipStr;
   connectedSSID = AP_SSID;
 
-  Serial.printf("[%lu] [WEBACT] Access Point started!\n", millis());
-  Serial.printf("[%lu] [WEBACT] SSID: %s\n", millis(), AP_SSID);
-  Serial.printf("[%lu] [WEBACT] IP: %s\n", millis(), connectedIP.c_str());
+  LOG_INF("WEBACT", "Access Point started!\n");
+  LOG_INF("WEBACT", "SSID: %s\n", AP_SSID);
+  LOG_INF("WEBACT", "IP: %s\n", connectedIP.c_str());
 
   // Start mDNS for hostname resolution
   if (MDNS.begin(AP_HOSTNAME)) {
-    Serial.printf("[%lu] [WEBACT] mDNS started: http://%s.local/\n", millis(),
-                  AP_HOSTNAME);
+    LOG_INF("WEBACT", "mDNS started: http://%s.local/\n", AP_HOSTNAME);
   } else {
-    Serial.printf("[%lu] [WEBACT] WARNING: mDNS failed to start\n", millis());
+    LOG_WRN("WEBACT", "WARNING: mDNS failed to start\n");
   }
 
   // Start DNS server for captive portal behavior
@@ -277,18 +241,17 @@ void CrossPointWebServerActivity::startAccessPoint() {
   dnsServer = new DNSServer();
   dnsServer->setErrorReplyCode(DNSReplyCode::NoError);
   dnsServer->start(DNS_PORT, "*", apIP);
-  Serial.printf("[%lu] [WEBACT] DNS server started for captive portal\n",
-                millis());
+  LOG_INF("WEBACT", "DNS server started for captive portal\n");
 
-  Serial.printf("[%lu] [WEBACT] [MEM] Free heap after AP start: %d bytes\n",
-                millis(), ESP.getFreeHeap());
+  LOG_DBG("WEBACT", "[MEM] Free heap after AP start: %d bytes\n",
+          ESP.getFreeHeap());
 
   // Start the web server
   startWebServer();
 }
 
 void CrossPointWebServerActivity::startWebServer() {
-  Serial.printf("[%lu] [WEBACT] Starting web server...\n", millis());
+  LOG_INF("WEBACT", "Starting web server...\n");
 
   // Create the web server instance
   webServer.reset(new CrossPointWebServer());
@@ -296,18 +259,17 @@ void CrossPointWebServerActivity::startWebServer() {
 
   if (webServer->isRunning()) {
     state = WebServerActivityState::SERVER_RUNNING;
-    Serial.printf("[%lu] [WEBACT] Web server started successfully\n", millis());
+    LOG_INF("WEBACT", "Web server started successfully\n");
 
     // Force an immediate render since we're transitioning from a subactivity
     // that had its own rendering task. We need to make sure our display is
     // shown.
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    RENDER_SCHEDULER.lock();
     render();
-    xSemaphoreGive(renderingMutex);
-    Serial.printf("[%lu] [WEBACT] Rendered File Transfer screen\n", millis());
+    RENDER_SCHEDULER.unlock();
+    LOG_INF("WEBACT", "Rendered File Transfer screen\n");
   } else {
-    Serial.printf("[%lu] [WEBACT] ERROR: Failed to start web server!\n",
-                  millis());
+    LOG_ERR("WEBACT", "ERROR: Failed to start web server!\n");
     webServer.reset();
     // Go back on error
     onGoBack();
@@ -316,9 +278,9 @@ void CrossPointWebServerActivity::startWebServer() {
 
 void CrossPointWebServerActivity::stopWebServer() {
   if (webServer && webServer->isRunning()) {
-    Serial.printf("[%lu] [WEBACT] Stopping web server...\n", millis());
+    LOG_DBG("WEBACT", "Stopping web server...\n");
     webServer->stop();
-    Serial.printf("[%lu] [WEBACT] Web server stopped\n", millis());
+    LOG_INF("WEBACT", "Web server stopped\n");
   }
   webServer.reset();
 }
@@ -344,18 +306,16 @@ void CrossPointWebServerActivity::loop() {
         lastWifiCheck = millis();
         const wl_status_t wifiStatus = WiFi.status();
         if (wifiStatus != WL_CONNECTED) {
-          Serial.printf("[%lu] [WEBACT] WiFi disconnected! Status: %d\n",
-                        millis(), wifiStatus);
+          LOG_INF("WEBACT", "WiFi disconnected! Status: %d\n", wifiStatus);
           // Show error and exit gracefully
           state = WebServerActivityState::SHUTTING_DOWN;
-          updateRequired = true;
+          renderJob.request();
           return;
         }
         // Log weak signal warnings
         const int rssi = WiFi.RSSI();
         if (rssi < -75) {
-          Serial.printf("[%lu] [WEBACT] Warning: Weak WiFi signal: %d dBm\n",
-                        millis(), rssi);
+          LOG_WRN("WEBACT", "Warning: Weak WiFi signal: %d dBm\n", rssi);
         }
       }
     }
@@ -367,9 +327,8 @@ void CrossPointWebServerActivity::loop() {
 
       // Log if there's a significant gap between handleClient calls (>100ms)
       if (lastHandleClientTime > 0 && timeSinceLastHandleClient > 100) {
-        Serial.printf(
-            "[%lu] [WEBACT] WARNING: %lu ms gap since last handleClient\n",
-            millis(), timeSinceLastHandleClient);
+        LOG_WRN("WEBACT", "WARNING: %lu ms gap since last handleClient\n",
+                timeSinceLastHandleClient);
       }
 
       // Reset watchdog BEFORE processing - HTTP header parsing can be slow
@@ -395,6 +354,22 @@ void CrossPointWebServerActivity::loop() {
         }
       }
       lastHandleClientTime = millis();
+
+      // Pre-index uploaded books one stage at a time while no transfer is
+      // running, so the first open of a new book is instant. Stages that take
+      // seconds wait until no browser is connected, handleClient would stall
+      // for as long and with it any upload the browser starts meanwhile.
+      if (BOOK_INGEST.hasPendingWork() && BOOK_INGEST.isSettled() &&
+          !webServer->getWsUploadStatus().inProgress) {
+        esp_task_wdt_reset();
+        // Rendering measures fonts and may touch the SD card, keep the ingest
+        // stage out of its way
+        RENDER_SCHEDULER.lock();
+        BOOK_INGEST.processNext(renderer, webServer->hasClients());
+        RENDER_SCHEDULER.unlock();
+        esp_task_wdt_reset();
+        lastHandleClientTime = millis();
+      }
     }
 
     // Handle exit on Back button (also check outside loop)
@@ -405,18 +380,6 @@ void CrossPointWebServerActivity::loop() {
   }
 }
 
-void CrossPointWebServerActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void CrossPointWebServerActivity::render() const {
   // Only render our own UI when server is running
   // Subactivities handle their own rendering
@@ -439,8 +402,7 @@ void drawQRCode(const GfxRenderer &renderer, const int x, const int y,
   // The structure to manage the QR code
   QRCode qrcode;
   uint8_t qrcodeBytes[qrcode_getBufferSize(4)];
-  Serial.printf("[%lu] [WEBACT] QR Code (%lu): %s\n", millis(), data.length(),
-                data.c_str());
+  LOG_INF("WEBACT", "QR Code (%zu): %s\n", data.length(), data.c_str());
 
   qrcode_initText(&qrcode, qrcodeBytes, 4, ECC_LOW, data.c_str());
   const uint8_t px = 6; // pixels per module
@@ -16,41 +16,22 @@ const char *MENU_DESCRIPTIONS[MENU_ITEM_COUNT] = {
 };
 } // namespace
 
-void NetworkModeSelectionActivity::taskTrampoline(void *param) {
-  auto *self = static_cast<NetworkModeSelectionActivity *>(param);
-  self->displayTaskLoop();
-}
-
 void NetworkModeSelectionActivity::onEnter() {
   Activity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
-
   // Reset selection
   selectedIndex = 0;
 
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&NetworkModeSelectionActivity::taskTrampoline, "NetworkModeTask",
-              2048,              // Stack size
-              this,              // Parameters
-              1,                 // Priority
-              &displayTaskHandle // Task handle
-  );
+  renderJob.request();
+
+  renderJob.start();
 }
 
 void NetworkModeSelectionActivity::onExit() {
   Activity::onExit();
 
-  // Wait until not rendering to delete task
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderJob.stop();
 }
 
 void NetworkModeSelectionActivity::loop() {
@@ -82,22 +63,10 @@ void NetworkModeSelectionActivity::loop() {
 
   if (prevPressed) {
     selectedIndex = (selectedIndex + MENU_ITEM_COUNT - 1) % MENU_ITEM_COUNT;
-    updateRequired = true;
+    renderJob.request();
   } else if (nextPressed) {
     selectedIndex = (selectedIndex + 1) % MENU_ITEM_COUNT;
-    updateRequired = true;
-  }
-}
-
-void NetworkModeSelectionActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    renderJob.request();
   }
 }
 
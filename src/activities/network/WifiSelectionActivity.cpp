@@ -1,6 +1,7 @@
 #include "WifiSelectionActivity.h"
 
 #include <GfxRenderer.h>
+#include <Logging.h>
 #include <WiFi.h>
 
 #include <map>
@@ -10,21 +11,14 @@
 #include "activities/util/KeyboardEntryActivity.h"
 #include "fontIds.h"
 
-void WifiSelectionActivity::taskTrampoline(void *param) {
-  auto *self = static_cast<WifiSelectionActivity *>(param);
-  self->displayTaskLoop();
-}
-
 void WifiSelectionActivity::onEnter() {
   Activity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
-
   // Load saved WiFi credentials - SD card operations need lock as we use SPI
   // for both
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  RENDER_SCHEDULER.lock();
   WIFI_STORE.loadFromFile();
-  xSemaphoreGive(renderingMutex);
+  RENDER_SCHEDULER.unlock();
 
   // Reset state
   selectedNetworkIndex = 0;
@@ -47,14 +41,9 @@ void WifiSelectionActivity::onEnter() {
   cachedMacAddress = std::string(macStr);
 
   // Trigger first update to show scanning message
-  updateRequired = true;
+  renderJob.request();
 
-  xTaskCreate(&WifiSelectionActivity::taskTrampoline, "WifiSelectionTask",
-              4096,              // Stack size (larger for WiFi operations)
-              this,              // Parameters
-              1,                 // Priority
-              &displayTaskHandle // Task handle
-  );
+  renderJob.start();
 
   // Start WiFi scan
   startWifiScan();
@@ -63,49 +52,31 @@ void WifiSelectionActivity::onEnter() {
 void WifiSelectionActivity::onExit() {
   Activity::onExit();
 
-  Serial.printf("[%lu] [WIFI] [MEM] Free heap at onExit start: %d bytes\n",
-                millis(), ESP.getFreeHeap());
+  LOG_DBG("WIFI", "[MEM] Free heap at onExit start: %d bytes\n",
+          ESP.getFreeHeap());
 
   // Stop any ongoing WiFi scan
-  Serial.printf("[%lu] [WIFI] Deleting WiFi scan...\n", millis());
+  LOG_DBG("WIFI", "Deleting WiFi scan...\n");
   WiFi.scanDelete();
-  Serial.printf("[%lu] [WIFI] [MEM] Free heap after scanDelete: %d bytes\n",
-                millis(), ESP.getFreeHeap());
+  LOG_DBG("WIFI", "[MEM] Free heap after scanDelete: %d bytes\n",
+          ESP.getFreeHeap());
 
   // Note: We do NOT disconnect WiFi here - the parent activity
   // (CrossPointWebServerActivity) manages WiFi connection state. We just clean
-  // up the scan and task.
-
-  // Acquire mutex before deleting task to ensure task isn't using it
-  // This prevents hangs/crashes if the task holds the mutex when deleted
-  Serial.printf(
-      "[%lu] [WIFI] Acquiring rendering mutex before task deletion...\n",
-      millis());
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-
-  // Delete the display task (we now hold the mutex, so task is blocked if it
-  // needs it)
-  Serial.printf("[%lu] [WIFI] Deleting display task...\n", millis());
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-    Serial.printf("[%lu] [WIFI] Display task deleted\n", millis());
-  }
-
-  // Now safe to delete the mutex since we own it
-  Serial.printf("[%lu] [WIFI] Deleting mutex...\n", millis());
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
-  Serial.printf("[%lu] [WIFI] Mutex deleted\n", millis());
-
-  Serial.printf("[%lu] [WIFI] [MEM] Free heap at onExit end: %d bytes\n",
-                millis(), ESP.getFreeHeap());
+  // up the scan and render job.
+
+  // Waits for a render in progress
+  LOG_DBG("WIFI", "Stopping render job...\n");
+  renderJob.stop();
+
+  LOG_DBG("WIFI", "[MEM] Free heap at onExit end: %d bytes\n",
+          ESP.getFreeHeap());
 }
 
 void WifiSelectionActivity::startWifiScan() {
   state = WifiSelectionState::SCANNING;
   networks.clear();
-  updateRequired = true;
+  renderJob.request();
 
   // Set WiFi mode to station
   WiFi.mode(WIFI_STA);
@@ -126,7 +97,7 @@ void WifiSelectionActivity::processWifiScanResults() {
 
   if (scanResult == WIFI_SCAN_FAILED) {
     state = WifiSelectionState::NETWORK_LIST;
-    updateRequired = true;
+    renderJob.request();
     return;
   }
 
@@ -178,7 +149,7 @@ void WifiSelectionActivity::processWifiScanResults() {
   WiFi.scanDelete();
   state = WifiSelectionState::NETWORK_LIST;
   selectedNetworkIndex = 0;
-  updateRequired = true;
+  renderJob.request();
 }
 
 void WifiSelectionActivity::selectNetwork(const int index) {
@@ -198,8 +169,8 @@ void WifiSelectionActivity::selectNetwork(const int index) {
     // Use saved password - connect directly
     enteredPassword = savedCred->password;
     usedSavedPassword = true;
-    Serial.printf("[%lu] [WiFi] Using saved password for %s, length: %zu\n",
-                  millis(), selectedSSID.c_str(), enteredPassword.size());
+    LOG_INF("WiFi", "Using saved password for %s, length: %zu\n",
+            selectedSSID.c_str(), enteredPassword.size());
     attemptConnection();
     return;
   }
@@ -208,7 +179,7 @@ void WifiSelectionActivity::selectNetwork(const int index) {
     // Show password entry
     state = WifiSelectionState::PASSWORD_ENTRY;
     // Don't allow screen updates while changing activity
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    RENDER_SCHEDULER.lock();
     enterNewActivity(new KeyboardEntryActivity(
         renderer, mappedInput, "Nhập mật khẩu WiFi",
         "",    // No initial text
@@ -221,11 +192,11 @@ void WifiSelectionActivity::selectNetwork(const int index) {
         },
         [this] {
           state = WifiSelectionState::NETWORK_LIST;
-          updateRequired = true;
+          renderJob.request();
           exitActivity();
         }));
-    updateRequired = true;
-    xSemaphoreGive(renderingMutex);
+    renderJob.request();
+    RENDER_SCHEDULER.unlock();
   } else {
     // Connect directly for open networks
     attemptConnection();
@@ -237,7 +208,7 @@ void WifiSelectionActivity::attemptConnection() {
   connectionStartTime = millis();
   connectedIP.clear();
   connectionError.clear();
-  updateRequired = true;
+  renderJob.request();
 
   WiFi.mode(WIFI_STA);
 
@@ -267,12 +238,12 @@ void WifiSelectionActivity::checkConnectionStatus() {
     if (!usedSavedPassword && !enteredPassword.empty()) {
       state = WifiSelectionState::SAVE_PROMPT;
       savePromptSelection = 0; // Default to "Yes"
-      updateRequired = true;
+      renderJob.request();
     } else {
       // Using saved password or open network - complete immediately
-      Serial.printf("[%lu] [WIFI] Connected with saved/open credentials, "
-                    "completing immediately\n",
-                    millis());
+      LOG_INF(
+          "WIFI",
+          "Connected with saved/open credentials, completing immediately\n");
       onComplete(true);
     }
     return;
@@ -284,7 +255,7 @@ void WifiSelectionActivity::checkConnectionStatus() {
       connectionError = "Không tìm thấy mạng";
     }
     state = WifiSelectionState::CONNECTION_FAILED;
-    updateRequired = true;
+    renderJob.request();
     return;
   }
 
@@ -293,7 +264,7 @@ void WifiSelectionActivity::checkConnectionStatus() {
     WiFi.disconnect();
     connectionError = "Hết thời gian kết nối";
     state = WifiSelectionState::CONNECTION_FAILED;
-    updateRequired = true;
+    renderJob.request();
     return;
   }
 }
@@ -328,20 +299,20 @@ void WifiSelectionActivity::loop() {
         mappedInput.wasPressed(MappedInputManager::Button::Left)) {
       if (savePromptSelection > 0) {
         savePromptSelection--;
-        updateRequired = true;
+        renderJob.request();
       }
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
                mappedInput.wasPressed(MappedInputManager::Button::Right)) {
       if (savePromptSelection < 1) {
         savePromptSelection++;
-        updateRequired = true;
+        renderJob.request();
       }
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
       if (savePromptSelection == 0) {
         // User chose "Yes" - save the password
-        xSemaphoreTake(renderingMutex, portMAX_DELAY);
+        RENDER_SCHEDULER.lock();
         WIFI_STORE.addCredential(selectedSSID, enteredPassword);
-        xSemaphoreGive(renderingMutex);
+        RENDER_SCHEDULER.unlock();
       }
       // Complete - parent will start web server
       onComplete(true);
@@ -358,20 +329,20 @@ void WifiSelectionActivity::loop() {
         mappedInput.wasPressed(MappedInputManager::Button::Left)) {
       if (forgetPromptSelection > 0) {
         forgetPromptSelection--;
-        updateRequired = true;
+        renderJob.request();
       }
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
                mappedInput.wasPressed(MappedInputManager::Button::Right)) {
       if (forgetPromptSelection < 1) {
         forgetPromptSelection++;
-        updateRequired = true;
+        renderJob.request();
       }
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
       if (forgetPromptSelection == 1) {
         // User chose "Forget network" - forget the network
-        xSemaphoreTake(renderingMutex, portMAX_DELAY);
+        RENDER_SCHEDULER.lock();
         WIFI_STORE.removeCredential(selectedSSID);
-        xSemaphoreGive(renderingMutex);
+        RENDER_SCHEDULER.unlock();
         // Update the network list to reflect the change
         const auto network = find_if(networks.begin(), networks.end(),
                                      [this](const WifiNetworkInfo &net) {
@@ -383,11 +354,11 @@ void WifiSelectionActivity::loop() {
       }
       // Go back to network list (whether Cancel or Forget network was selected)
       state = WifiSelectionState::NETWORK_LIST;
-      updateRequired = true;
+      renderJob.request();
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
       // Skip forgetting, go back to network list
       state = WifiSelectionState::NETWORK_LIST;
-      updateRequired = true;
+      renderJob.request();
     }
     return;
   }
@@ -412,7 +383,7 @@ void WifiSelectionActivity::loop() {
         // Go back to network list on failure
         state = WifiSelectionState::NETWORK_LIST;
       }
-      updateRequired = true;
+      renderJob.request();
       return;
     }
   }
@@ -440,14 +411,14 @@ void WifiSelectionActivity::loop() {
         mappedInput.wasPressed(MappedInputManager::Button::Left)) {
       if (selectedNetworkIndex > 0) {
         selectedNetworkIndex--;
-        updateRequired = true;
+        renderJob.request();
       }
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
                mappedInput.wasPressed(MappedInputManager::Button::Right)) {
       if (!networks.empty() &&
           selectedNetworkIndex < static_cast<int>(networks.size()) - 1) {
         selectedNetworkIndex++;
-        updateRequired = true;
+        renderJob.request();
       }
     }
   }
@@ -471,31 +442,6 @@ WifiSelectionActivity::getSignalStrengthIndicator(const int32_t rssi) const {
   return "    "; // Very weak
 }
 
-void WifiSelectionActivity::displayTaskLoop() {
-  while (true) {
-    // If a subactivity is active, yield CPU time but don't render
-    if (subActivity) {
-      vTaskDelay(10 / portTICK_PERIOD_MS);
-      continue;
-    }
-
-    // Don't render if we're in PASSWORD_ENTRY state - we're just transitioning
-    // from the keyboard subactivity back to the main activity
-    if (state == WifiSelectionState::PASSWORD_ENTRY) {
-      vTaskDelay(10 / portTICK_PERIOD_MS);
-      continue;
-    }
-
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void WifiSelectionActivity::render() const {
   renderer.clearScreen();
 
@@ -566,11 +512,9 @@ void WifiSelectionActivity::renderNetworkList() const {
         renderer.drawText(UI_10_FONT_ID, 5, networkY, ">");
       }
 
-      // Draw network name (truncate if too long)
-      std::string displayName = network.ssid;
-      if (displayName.length() > 16) {
-        displayName.replace(13, displayName.length() - 13, "...");
-      }
+      // Draw network name, truncated before the signal strength column
+      const std::string displayName = renderer.truncatedText(
+          UI_10_FONT_ID, network.ssid.c_str(), pageWidth - 90 - 20 - 10);
       renderer.drawText(UI_10_FONT_ID, 20, networkY, displayName.c_str());
 
       // Draw signal strength indicator
@@ -1,7 +1,4 @@
 #pragma once
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
 
 #include <cstdint>
 #include <functional>
@@ -9,6 +6,7 @@
 #include <string>
 #include <vector>
 
+#include "RenderScheduler.h"
 #include "activities/ActivityWithSubactivity.h"
 
 // Structure to hold WiFi network information
@@ -43,9 +41,8 @@ enum class WifiSelectionState {
  * The onComplete callback receives true if connected successfully, false if cancelled.
  */
 class WifiSelectionActivity final : public ActivityWithSubactivity {
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  RenderJob renderJob{[this] { render(); },
+                      [this] { return !subActivity && state != WifiSelectionState::PASSWORD_ENTRY; }};
   WifiSelectionState state = WifiSelectionState::SCANNING;
   int selectedNetworkIndex = 0;
   std::vector<WifiNetworkInfo> networks;
@@ -76,8 +73,6 @@ class WifiSelectionActivity final : public ActivityWithSubactivity {
   static constexpr unsigned long CONNECTION_TIMEOUT_MS = 15000;
   unsigned long connectionStartTime = 0;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
   void renderNetworkList() const;
   void renderPasswordEntry() const;
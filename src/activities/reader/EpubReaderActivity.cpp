@@ -1,15 +1,20 @@
 #include "EpubReaderActivity.h"
 
+#include <BookCacheKey.h>
 #include <Epub/Page.h>
 #include <FsHelpers.h>
 #include <GfxRenderer.h>
+#include <Logging.h>
 #include <SDCardManager.h>
+#include <Trace.h>
 
+#include "Battery.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "EpubReaderChapterSelectionActivity.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
+#include "ResumeSnapshot.h"
 #include "ScreenComponents.h"
 #include "fontIds.h"
 
@@ -22,9 +27,44 @@ constexpr int progressBarMarginTop = 1;
 
 } // namespace
 
-void EpubReaderActivity::taskTrampoline(void *param) {
-  auto *self = static_cast<EpubReaderActivity *>(param);
-  self->displayTaskLoop();
+GfxRenderer::Orientation EpubReaderActivity::getReaderOrientation() {
+  switch (SETTINGS.orientation) {
+  case CrossPointSettings::ORIENTATION::LANDSCAPE_CW:
+    return GfxRenderer::Orientation::LandscapeClockwise;
+  case CrossPointSettings::ORIENTATION::INVERTED:
+    return GfxRenderer::Orientation::PortraitInverted;
+  case CrossPointSettings::ORIENTATION::LANDSCAPE_CCW:
+    return GfxRenderer::Orientation::LandscapeCounterClockwise;
+  case CrossPointSettings::ORIENTATION::PORTRAIT:
+  default:
+    return GfxRenderer::Orientation::Portrait;
+  }
+}
+
+void EpubReaderActivity::getContentMargins(
+    const GfxRenderer::Orientation orientation, int *outTop, int *outRight,
+    int *outBottom, int *outLeft) {
+  // Apply screen viewable areas and additional padding
+  GfxRenderer::getOrientedViewableTRBL(orientation, outTop, outRight,
+                                       outBottom, outLeft);
+  *outTop += SETTINGS.screenMargin;
+  *outLeft += SETTINGS.screenMargin;
+  *outRight += SETTINGS.screenMargin;
+  *outBottom += SETTINGS.screenMargin;
+
+  // Add status bar margin
+  if (SETTINGS.statusBar != CrossPointSettings::STATUS_BAR_MODE::NONE) {
+    // Add additional margin for status bar if progress bar is shown
+    const bool showProgressBar =
+        SETTINGS.statusBar ==
+            CrossPointSettings::STATUS_BAR_MODE::FULL_WITH_PROGRESS_BAR ||
+        SETTINGS.statusBar ==
+            CrossPointSettings::STATUS_BAR_MODE::ONLY_PROGRESS_BAR;
+    *outBottom += statusBarMargin - SETTINGS.screenMargin +
+                  (showProgressBar ? (ScreenComponents::BOOK_PROGRESS_BAR_HEIGHT +
+                                      progressBarMarginTop)
+                                   : 0);
+  }
 }
 
 void EpubReaderActivity::onEnter() {
@@ -35,39 +75,23 @@ void EpubReaderActivity::onEnter() {
   }
 
   // Configure screen orientation based on settings
-  switch (SETTINGS.orientation) {
-  case CrossPointSettings::ORIENTATION::PORTRAIT:
-    renderer.setOrientation(GfxRenderer::Orientation::Portrait);
-    break;
-  case CrossPointSettings::ORIENTATION::LANDSCAPE_CW:
-    renderer.setOrientation(GfxRenderer::Orientation::LandscapeClockwise);
-    break;
-  case CrossPointSettings::ORIENTATION::INVERTED:
-    renderer.setOrientation(GfxRenderer::Orientation::PortraitInverted);
-    break;
-  case CrossPointSettings::ORIENTATION::LANDSCAPE_CCW:
-    renderer.setOrientation(
-        GfxRenderer::Orientation::LandscapeCounterClockwise);
-    break;
-  default:
-    break;
-  }
-
-  renderingMutex = xSemaphoreCreateMutex();
+  renderer.setOrientation(getReaderOrientation());
 
   epub->setupCacheDir();
   epub->setImageLoadingEnabled(SETTINGS.loadImages);
 
   FsFile f;
-  if (SdMan.openFileForRead("ERS", epub->getCachePath() + "/progress.bin", f)) {
+  const auto progressPath =
+      BookCacheKey::findProgressPath(epub->getCachePath(), epub->getPath());
+  if (SdMan.openFileForRead("ERS", progressPath, f)) {
     uint8_t data[6];
     int dataSize = f.read(data, 6);
     if (dataSize == 4 || dataSize == 6) {
       currentSpineIndex = data[0] + (data[1] << 8);
       nextPageNumber = data[2] + (data[3] << 8);
       cachedSpineIndex = currentSpineIndex;
-      Serial.printf("[%lu] [ERS] Loaded cache: %d, %d\n", millis(),
-                    currentSpineIndex, nextPageNumber);
+      LOG_INF("ERS", "Loaded cache: %d, %d\n", currentSpineIndex,
+              nextPageNumber);
     }
     if (dataSize == 6) {
       cachedChapterTotalPageCount = data[4] + (data[5] << 8);
@@ -80,9 +104,10 @@ void EpubReaderActivity::onEnter() {
     int textSpineIndex = epub->getSpineIndexForTextReference();
     if (textSpineIndex != 0) {
       currentSpineIndex = textSpineIndex;
-      Serial.printf("[%lu] [ERS] Opened for first time, navigating to text "
-                    "reference at index %d\n",
-                    millis(), textSpineIndex);
+      LOG_INF(
+          "ERS",
+          "Opened for first time, navigating to text reference at index %d\n",
+          textSpineIndex);
     }
   }
 
@@ -92,14 +117,9 @@ void EpubReaderActivity::onEnter() {
   RECENT_BOOKS.addBook(epub->getPath(), epub->getTitle(), epub->getAuthor());
 
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&EpubReaderActivity::taskTrampoline, "EpubReaderActivityTask",
-              8192,              // Stack size
-              this,              // Parameters
-              1,                 // Priority
-              &displayTaskHandle // Task handle
-  );
+  renderJob.request();
+
+  renderJob.start();
 }
 
 void EpubReaderActivity::onExit() {
@@ -108,15 +128,7 @@ void EpubReaderActivity::onExit() {
   // Reset orientation back to portrait for the rest of the UI
   renderer.setOrientation(GfxRenderer::Orientation::Portrait);
 
-  // Wait until not rendering to delete task to avoid killing mid-instruction to
-  // EPD
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderJob.stop();
   section.reset();
   epub.reset();
 }
@@ -131,7 +143,8 @@ void EpubReaderActivity::loop() {
   // Enter chapter selection activity
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
     // Don't start activity transition while rendering
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    RENDER_SCHEDULER.lock();
+    pageOnScreen = false;
     const int currentPage = section ? section->currentPage : 0;
     const int totalPages = section ? section->pageCount : 0;
     exitActivity();
@@ -140,7 +153,7 @@ void EpubReaderActivity::loop() {
         currentSpineIndex, currentPage, totalPages,
         [this] {
           exitActivity();
-          updateRequired = true;
+          renderJob.request();
         },
         [this](const int newSpineIndex) {
           if (currentSpineIndex != newSpineIndex) {
@@ -149,7 +162,7 @@ void EpubReaderActivity::loop() {
             section.reset();
           }
           exitActivity();
-          updateRequired = true;
+          renderJob.request();
         },
         [this](const int newSpineIndex, const int newPage) {
           // Handle sync position
@@ -160,9 +173,9 @@ void EpubReaderActivity::loop() {
             section.reset();
           }
           exitActivity();
-          updateRequired = true;
+          renderJob.request();
         }));
-    xSemaphoreGive(renderingMutex);
+    RENDER_SCHEDULER.unlock();
   }
 
   // Long press BACK (1s+) goes directly to home
@@ -209,7 +222,7 @@ void EpubReaderActivity::loop() {
       currentSpineIndex >= epub->getSpineItemsCount()) {
     currentSpineIndex = epub->getSpineItemsCount() - 1;
     nextPageNumber = UINT16_MAX;
-    updateRequired = true;
+    renderJob.request();
     return;
   }
 
@@ -218,19 +231,21 @@ void EpubReaderActivity::loop() {
 
   if (skipChapter) {
     // We don't want to delete the section mid-render, so grab the semaphore
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    RENDER_SCHEDULER.lock();
     nextPageNumber = 0;
     currentSpineIndex =
         nextTriggered ? currentSpineIndex + 1 : currentSpineIndex - 1;
     section.reset();
-    xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    RENDER_SCHEDULER.unlock();
+    renderJob.request();
     return;
   }
 
-  // No current section, attempt to rerender the book
+  // No current section, attempt to rerender the book. The turn applies once
+  // the section is loaded, e.g. right after a resume.
   if (!section) {
-    updateRequired = true;
+    pendingPageTurns += nextTriggered ? 1 : -1;
+    renderJob.request();
     return;
   }
 
@@ -239,38 +254,37 @@ void EpubReaderActivity::loop() {
       section->currentPage--;
     } else {
       // We don't want to delete the section mid-render, so grab the semaphore
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      RENDER_SCHEDULER.lock();
       nextPageNumber = UINT16_MAX;
       currentSpineIndex--;
       section.reset();
-      xSemaphoreGive(renderingMutex);
+      RENDER_SCHEDULER.unlock();
     }
-    updateRequired = true;
+    renderJob.request();
   } else {
     if (section->currentPage < section->pageCount - 1) {
       section->currentPage++;
     } else {
       // We don't want to delete the section mid-render, so grab the semaphore
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      RENDER_SCHEDULER.lock();
       nextPageNumber = 0;
       currentSpineIndex++;
       section.reset();
-      xSemaphoreGive(renderingMutex);
+      RENDER_SCHEDULER.unlock();
     }
-    updateRequired = true;
+    renderJob.request();
   }
 }
 
-void EpubReaderActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      renderScreen();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+void EpubReaderActivity::onSleep() {
+  // The sleep screen replaces the page, a snapshot lets the next boot put it
+  // back without opening the book first
+  RENDER_SCHEDULER.lock();
+  if (!subActivity && pageOnScreen) {
+    RESUME_SNAPSHOT.save(renderer, epub->getPath(), renderedSpineIndex,
+                         renderedPage);
   }
+  RENDER_SCHEDULER.unlock();
 }
 
 // TODO: Failure handling
@@ -278,6 +292,8 @@ void EpubReaderActivity::renderScreen() {
   if (!epub) {
     return;
   }
+  TRACE_SCOPE("reader.renderScreen");
+  pageOnScreen = false;
 
   // edge case handling for sub-zero spine index
   if (currentSpineIndex < 0) {
@@ -290,6 +306,7 @@ void EpubReaderActivity::renderScreen() {
 
   // Show end of book screen
   if (currentSpineIndex == epub->getSpineItemsCount()) {
+    RESUME_SNAPSHOT.discardFrame();
     renderer.clearScreen();
     renderer.drawCenteredText(UI_12_FONT_ID, 300, "End of book", true,
                               EpdFontFamily::BOLD);
@@ -297,35 +314,16 @@ void EpubReaderActivity::renderScreen() {
     return;
   }
 
-  // Apply screen viewable areas and additional padding
   int orientedMarginTop, orientedMarginRight, orientedMarginBottom,
       orientedMarginLeft;
-  renderer.getOrientedViewableTRBL(&orientedMarginTop, &orientedMarginRight,
-                                   &orientedMarginBottom, &orientedMarginLeft);
-  orientedMarginTop += SETTINGS.screenMargin;
-  orientedMarginLeft += SETTINGS.screenMargin;
-  orientedMarginRight += SETTINGS.screenMargin;
-  orientedMarginBottom += SETTINGS.screenMargin;
-
-  // Add status bar margin
-  if (SETTINGS.statusBar != CrossPointSettings::STATUS_BAR_MODE::NONE) {
-    // Add additional margin for status bar if progress bar is shown
-    const bool showProgressBar =
-        SETTINGS.statusBar ==
-            CrossPointSettings::STATUS_BAR_MODE::FULL_WITH_PROGRESS_BAR ||
-        SETTINGS.statusBar ==
-            CrossPointSettings::STATUS_BAR_MODE::ONLY_PROGRESS_BAR;
-    orientedMarginBottom +=
-        statusBarMargin - SETTINGS.screenMargin +
-        (showProgressBar ? (ScreenComponents::BOOK_PROGRESS_BAR_HEIGHT +
-                            progressBarMarginTop)
-                         : 0);
-  }
+  getContentMargins(renderer.getOrientation(), &orientedMarginTop,
+                    &orientedMarginRight, &orientedMarginBottom,
+                    &orientedMarginLeft);
 
   if (!section) {
     const auto filepath = epub->getSpineItem(currentSpineIndex).href;
-    Serial.printf("[%lu] [ERS] Loading file: %s, index: %d\n", millis(),
-                  filepath.c_str(), currentSpineIndex);
+    LOG_INF("ERS", "Loading file: %s, index: %d\n", filepath.c_str(),
+            currentSpineIndex);
     section = std::unique_ptr<Section>(
         new Section(epub, currentSpineIndex, renderer));
 
@@ -338,7 +336,7 @@ void EpubReaderActivity::renderScreen() {
             SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
             SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment,
             viewportWidth, viewportHeight, SETTINGS.hyphenationEnabled)) {
-      Serial.printf("[%lu] [ERS] Cache not found, building...\n", millis());
+      LOG_INF("ERS", "Cache not found, building...\n");
 
       // Progress bar dimensions
       constexpr int barWidth = 200;
@@ -360,6 +358,7 @@ void EpubReaderActivity::renderScreen() {
           boxY + renderer.getLineHeight(UI_12_FONT_ID) + boxMargin * 2;
 
       // Always show "Indexing..." text first
+      RESUME_SNAPSHOT.discardFrame();
       {
         renderer.fillRect(boxXNoBar, boxY, boxWidthNoBar, boxHeightNoBar,
                           false);
@@ -398,13 +397,12 @@ void EpubReaderActivity::renderScreen() {
               SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment,
               viewportWidth, viewportHeight, SETTINGS.hyphenationEnabled,
               progressSetup, progressCallback)) {
-        Serial.printf("[%lu] [ERS] Failed to persist page data to SD\n",
-                      millis());
+        LOG_ERR("ERS", "Failed to persist page data to SD\n");
         section.reset();
         return;
       }
     } else {
-      Serial.printf("[%lu] [ERS] Cache found, skipping build...\n", millis());
+      LOG_INF("ERS", "Cache found, skipping build...\n");
     }
 
     if (nextPageNumber == UINT16_MAX) {
@@ -429,10 +427,30 @@ void EpubReaderActivity::renderScreen() {
     }
   }
 
+  // Page turns made while the section was loading
+  const int turns = pendingPageTurns.exchange(0);
+  if (turns != 0) {
+    section->currentPage = std::max(
+        0, std::min(section->currentPage + turns, section->pageCount - 1));
+  }
+
+  // The page restored from the resume snapshot at boot is on the panel
+  // already
+  if (RESUME_SNAPSHOT.claimFrame(epub->getPath(), currentSpineIndex,
+                                 section->currentPage)) {
+    LOG_INF("ERS", "Resumed on page %d, not rendering it again\n",
+            section->currentPage);
+    pageOnScreen = true;
+    renderedSpineIndex = currentSpineIndex;
+    renderedPage = section->currentPage;
+    RESUME_SNAPSHOT.markReady();
+    return;
+  }
+
   renderer.clearScreen();
 
   if (section->pageCount == 0) {
-    Serial.printf("[%lu] [ERS] No pages to render\n", millis());
+    LOG_INF("ERS", "No pages to render\n");
     renderer.drawCenteredText(UI_12_FONT_ID, 300, "Empty chapter", true,
                               EpdFontFamily::BOLD);
     renderStatusBar(orientedMarginRight, orientedMarginBottom,
@@ -442,8 +460,8 @@ void EpubReaderActivity::renderScreen() {
   }
 
   if (section->currentPage < 0 || section->currentPage >= section->pageCount) {
-    Serial.printf("[%lu] [ERS] Page out of bounds: %d (max %d)\n", millis(),
-                  section->currentPage, section->pageCount);
+    LOG_INF("ERS", "Page out of bounds: %d (max %d)\n", section->currentPage,
+            section->pageCount);
     renderer.drawCenteredText(UI_12_FONT_ID, 300, "Out of bounds", true,
                               EpdFontFamily::BOLD);
     renderStatusBar(orientedMarginRight, orientedMarginBottom,
@@ -455,23 +473,30 @@ void EpubReaderActivity::renderScreen() {
   {
     auto p = section->loadPageFromSectionFile();
     if (!p) {
-      Serial.printf(
-          "[%lu] [ERS] Failed to load page from SD - clearing section cache\n",
-          millis());
+      LOG_ERR("ERS", "Failed to load page from SD - clearing section cache\n");
       section->clearCache();
       section.reset();
       return renderScreen();
     }
     const auto start = millis();
-    renderContents(std::move(p), orientedMarginTop, orientedMarginRight,
-                   orientedMarginBottom, orientedMarginLeft);
-    Serial.printf("[%lu] [ERS] Rendered page in %dms\n", millis(),
-                  millis() - start);
+    const auto present =
+        renderContents(std::move(p), orientedMarginTop, orientedMarginRight,
+                       orientedMarginBottom, orientedMarginLeft);
+    LOG_DBG("ERS", "Rendered page in %lums\n", millis() - start);
+    // The SD card is on the panel's SPI bus, the progress write waits for
+    // the frame to be sent
+    present.wait();
+    pageOnScreen = true;
+    renderedSpineIndex = currentSpineIndex;
+    renderedPage = section->currentPage;
+    RESUME_SNAPSHOT.markPageRendered();
+    RESUME_SNAPSHOT.markReady();
   }
 
   FsFile f;
-  if (SdMan.openFileForWrite("ERS", epub->getCachePath() + "/progress.bin",
-                             f)) {
+  const auto progressPath =
+      BookCacheKey::getProgressPath(epub->getCachePath(), epub->getPath());
+  if (SdMan.openFileForWrite("ERS", progressPath, f)) {
     uint8_t data[6];
     data[0] = currentSpineIndex & 0xFF;
     data[1] = (currentSpineIndex >> 8) & 0xFF;
@@ -492,54 +517,76 @@ void EpubReaderActivity::renderScreen() {
   }
 }
 
-void EpubReaderActivity::renderContents(std::unique_ptr<Page> page,
-                                        const int orientedMarginTop,
-                                        const int orientedMarginRight,
-                                        const int orientedMarginBottom,
-                                        const int orientedMarginLeft) {
-  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft,
-               orientedMarginTop);
+GfxRenderer::PresentHandle EpubReaderActivity::renderContents(
+    std::unique_ptr<Page> page, const int orientedMarginTop,
+    const int orientedMarginRight, const int orientedMarginBottom,
+    const int orientedMarginLeft) {
+  TRACE_SCOPE("reader.renderContents");
+  TRACE_COUNTER("heap.free", ESP.getFreeHeap());
+  // The status bar goes first, its cached strip is only valid on a cleared
+  // screen
   renderStatusBar(orientedMarginRight, orientedMarginBottom,
                   orientedMarginLeft);
+  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft,
+               orientedMarginTop);
+  // The refresh runs on the display task, the grayscale planes below
+  // overlap with it
+  GfxRenderer::PresentHandle present;
   if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(EInkDisplay::HALF_REFRESH);
+    present = renderer.displayBufferAsync(EInkDisplay::HALF_REFRESH);
     pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
   } else {
-    renderer.displayBuffer();
+    present = renderer.displayBufferAsync();
     pagesUntilFullRefresh--;
   }
 
-  // Save bw buffer to reset buffer state after grayscale data sync
-  renderer.storeBwBuffer();
-
   // grayscale rendering
   // TODO: Only do this if font supports it
-  if (SETTINGS.textAntiAliasing) {
+  if (!SETTINGS.textAntiAliasing) {
+    return present;
+  }
+
+  // Glyphs paged in from a font pack and images come off the SD card, which
+  // shares the SPI bus with the panel: such pages wait for the frame instead
+  const bool readsCard =
+      page->hasImages() || renderer.isPackFont(SETTINGS.getReaderFontId());
+  if (!readsCard && renderer.beginBackBufferRender()) {
+    // Draw the LSB plane into the back buffer while the BW frame is on its
+    // way to the panel, the swap stores the bw buffer as storeBwBuffer would
     renderer.clearScreen(0x00);
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
     page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft,
                  orientedMarginTop);
-    renderer.copyGrayscaleLsbBuffers();
-
-    // Render and copy to MSB buffer
+    renderer.swapBackBuffer();
+  } else {
+    // Save bw buffer to reset buffer state after grayscale data sync
+    renderer.storeBwBuffer();
     renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
     page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft,
                  orientedMarginTop);
-    renderer.copyGrayscaleMsbBuffers();
-
-    // display grayscale part
-    renderer.displayGrayBuffer();
-    renderer.setRenderMode(GfxRenderer::BW);
   }
+  renderer.copyGrayscaleLsbBuffers();
+
+  // Render and copy to MSB buffer
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft,
+               orientedMarginTop);
+  renderer.copyGrayscaleMsbBuffers();
+
+  // display grayscale part
+  renderer.displayGrayBuffer();
+  renderer.setRenderMode(GfxRenderer::BW);
 
   // restore the bw data
   renderer.restoreBwBuffer();
+  return present;
 }
 
 void EpubReaderActivity::renderStatusBar(const int orientedMarginRight,
                                          const int orientedMarginBottom,
-                                         const int orientedMarginLeft) const {
+                                         const int orientedMarginLeft) {
   // determine visible status bar elements
   const bool showProgressPercentage =
       SETTINGS.statusBar == CrossPointSettings::STATUS_BAR_MODE::FULL;
@@ -570,7 +617,6 @@ void EpubReaderActivity::renderStatusBar(const int orientedMarginRight,
   // orientation
   const auto screenHeight = renderer.getScreenHeight();
   const auto textY = screenHeight - orientedMarginBottom - 4;
-  int progressTextWidth = 0;
 
   // Calculate progress in book
   const float sectionChapterProg =
@@ -578,80 +624,106 @@ void EpubReaderActivity::renderStatusBar(const int orientedMarginRight,
   const float bookProgress =
       epub->calculateProgress(currentSpineIndex, sectionChapterProg) * 100;
 
-  if (showProgressText || showProgressPercentage) {
-    // Right aligned text for progress counter
-    char progressStr[32];
-
+  // Right aligned text for progress counter
+  char progressStr[32] = "";
+  if (showProgressPercentage) {
     // Hide percentage when progress bar is shown to reduce clutter
-    if (showProgressPercentage) {
-      snprintf(progressStr, sizeof(progressStr), "%d/%d  %.0f%%",
-               section->currentPage + 1, section->pageCount, bookProgress);
-    } else {
-      snprintf(progressStr, sizeof(progressStr), "%d/%d",
-               section->currentPage + 1, section->pageCount);
-    }
-
-    progressTextWidth = renderer.getTextWidth(SMALL_FONT_ID, progressStr);
-    renderer.drawText(SMALL_FONT_ID,
-                      renderer.getScreenWidth() - orientedMarginRight -
-                          progressTextWidth,
-                      textY, progressStr);
+    snprintf(progressStr, sizeof(progressStr), "%d/%d  %.0f%%",
+             section->currentPage + 1, section->pageCount, bookProgress);
+  } else if (showProgressText) {
+    snprintf(progressStr, sizeof(progressStr), "%d/%d",
+             section->currentPage + 1, section->pageCount);
   }
+  const uint16_t batteryPercentage = showBattery ? battery.readPercentage() : 0;
+
+  StatusBarCache::Content content;
+  content.titleIndex =
+      showChapterTitle ? epub->getTocIndexForSpineIndex(currentSpineIndex) : 0;
+  content.progressText = progressStr;
+  content.progressPercent =
+      showProgressBar ? static_cast<int>(bookProgress) : 0;
+  content.batteryLevel =
+      showBatteryPercentage
+          ? batteryPercentage
+          : ScreenComponents::getBatteryFillStep(batteryPercentage);
+  content.mode = SETTINGS.statusBar;
+  content.showBatteryPercentage = showBatteryPercentage;
+  content.orientation = renderer.getOrientation();
+  content.area = {0, textY, renderer.getScreenWidth(), screenHeight - textY};
+
+  statusBarCache.render(renderer, content, [&] {
+    int progressTextWidth = 0;
+    if (progressStr[0] != '\0') {
+      progressTextWidth = renderer.getTextWidth(SMALL_FONT_ID, progressStr);
+      renderer.drawText(SMALL_FONT_ID,
+                        renderer.getScreenWidth() - orientedMarginRight -
+                            progressTextWidth,
+                        textY, progressStr);
+    }
 
-  if (showProgressBar) {
-    // Draw progress bar at the very bottom of the screen, from edge to edge of
-    // viewable area
-    ScreenComponents::drawBookProgressBar(renderer,
-                                          static_cast<size_t>(bookProgress));
-  }
+    if (showProgressBar) {
+      // Draw progress bar at the very bottom of the screen, from edge to edge
+      // of viewable area
+      ScreenComponents::drawBookProgressBar(renderer, content.progressPercent);
+    }
 
-  if (showBattery) {
-    ScreenComponents::drawBattery(renderer, orientedMarginLeft + 1, textY,
-                                  showBatteryPercentage);
-  }
+    if (showBattery) {
+      ScreenComponents::drawBattery(renderer, orientedMarginLeft + 1, textY,
+                                    showBatteryPercentage, batteryPercentage);
+    }
 
-  if (showChapterTitle) {
-    // Centered chatper title text
-    // Page width minus existing content with 30px padding on each side
-    const int rendererableScreenWidth =
-        renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
+    if (showChapterTitle) {
+      renderChapterTitle(content.titleIndex, textY, progressTextWidth,
+                         showBattery, showBatteryPercentage,
+                         orientedMarginRight, orientedMarginLeft);
+    }
+  });
+}
 
-    const int batterySize = showBattery ? (showBatteryPercentage ? 50 : 20) : 0;
-    const int titleMarginLeft = batterySize + 30;
-    const int titleMarginRight = progressTextWidth + 30;
-
-    // Attempt to center title on the screen, but if title is too wide then
-    // later we will center it within the available space.
-    int titleMarginLeftAdjusted = std::max(titleMarginLeft, titleMarginRight);
-    int availableTitleSpace =
-        rendererableScreenWidth - 2 * titleMarginLeftAdjusted;
-    const int tocIndex = epub->getTocIndexForSpineIndex(currentSpineIndex);
-
-    std::string title;
-    int titleWidth;
-    if (tocIndex == -1) {
-      title = "Unnamed";
-      titleWidth = renderer.getTextWidth(SMALL_FONT_ID, "Unnamed");
-    } else {
-      const auto tocItem = epub->getTocItem(tocIndex);
-      title = tocItem.title;
+void EpubReaderActivity::renderChapterTitle(
+    const int tocIndex, const int textY, const int progressTextWidth,
+    const bool showBattery, const bool showBatteryPercentage,
+    const int orientedMarginRight, const int orientedMarginLeft) const {
+  // Centered chatper title text
+  // Page width minus existing content with 30px padding on each side
+  const int rendererableScreenWidth =
+      renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
+
+  const int batterySize = showBattery ? (showBatteryPercentage ? 50 : 20) : 0;
+  const int titleMarginLeft = batterySize + 30;
+  const int titleMarginRight = progressTextWidth + 30;
+
+  // Attempt to center title on the screen, but if title is too wide then
+  // later we will center it within the available space.
+  int titleMarginLeftAdjusted = std::max(titleMarginLeft, titleMarginRight);
+  int availableTitleSpace =
+      rendererableScreenWidth - 2 * titleMarginLeftAdjusted;
+
+  std::string title;
+  int titleWidth;
+  if (tocIndex == -1) {
+    title = "Unnamed";
+    titleWidth = renderer.getTextWidth(SMALL_FONT_ID, "Unnamed");
+  } else {
+    const auto tocItem = epub->getTocItem(tocIndex);
+    title = tocItem.title;
+    titleWidth = renderer.getTextWidth(SMALL_FONT_ID, title.c_str());
+    if (titleWidth > availableTitleSpace) {
+      // Not enough space to center on the screen, center it within the
+      // remaining space instead
+      availableTitleSpace =
+          rendererableScreenWidth - titleMarginLeft - titleMarginRight;
+      titleMarginLeftAdjusted = titleMarginLeft;
+    }
+    if (titleWidth > availableTitleSpace) {
+      title = renderer.truncatedText(SMALL_FONT_ID, title.c_str(),
+                                     availableTitleSpace);
       titleWidth = renderer.getTextWidth(SMALL_FONT_ID, title.c_str());
-      if (titleWidth > availableTitleSpace) {
-        // Not enough space to center on the screen, center it within the
-        // remaining space instead
-        availableTitleSpace =
-            rendererableScreenWidth - titleMarginLeft - titleMarginRight;
-        titleMarginLeftAdjusted = titleMarginLeft;
-      }
-      while (titleWidth > availableTitleSpace && title.length() > 11) {
-        title.replace(title.length() - 8, 8, "...");
-        titleWidth = renderer.getTextWidth(SMALL_FONT_ID, title.c_str());
-      }
     }
-
-    renderer.drawText(SMALL_FONT_ID,
-                      titleMarginLeftAdjusted + orientedMarginLeft +
-                          (availableTitleSpace - titleWidth) / 2,
-                      textY, title.c_str());
   }
+
+  renderer.drawText(SMALL_FONT_ID,
+                    titleMarginLeftAdjusted + orientedMarginLeft +
+                        (availableTitleSpace - titleWidth) / 2,
+                    textY, title.c_str());
 }
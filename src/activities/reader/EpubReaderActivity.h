@@ -1,32 +1,40 @@
 #pragma once
 #include <Epub.h>
 #include <Epub/Section.h>
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
 
+#include <atomic>
+
+#include "RenderScheduler.h"
+#include "StatusBarCache.h"
 #include "activities/ActivityWithSubactivity.h"
 
 class EpubReaderActivity final : public ActivityWithSubactivity {
   std::shared_ptr<Epub> epub;
   std::unique_ptr<Section> section = nullptr;
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
+  RenderJob renderJob{[this] { renderScreen(); }};
+  StatusBarCache statusBarCache;
   int currentSpineIndex = 0;
   int nextPageNumber = 0;
   int pagesUntilFullRefresh = 0;
   int cachedSpineIndex = 0;
   int cachedChapterTotalPageCount = 0;
-  bool updateRequired = false;
+  // Page turns made while no section was loaded, applied once it is
+  std::atomic<int> pendingPageTurns{0};
+  // Whether the frame buffer holds the page last rendered, for the resume snapshot
+  bool pageOnScreen = false;
+  int renderedSpineIndex = 0;
+  int renderedPage = 0;
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void renderScreen();
-  void renderContents(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
-                      int orientedMarginBottom, int orientedMarginLeft);
-  void renderStatusBar(int orientedMarginRight, int orientedMarginBottom, int orientedMarginLeft) const;
+  // Returns while the page's refresh may still run, see GfxRenderer::displayBufferAsync()
+  GfxRenderer::PresentHandle renderContents(std::unique_ptr<Page> page, int orientedMarginTop,
+                                            int orientedMarginRight, int orientedMarginBottom,
+                                            int orientedMarginLeft);
+  void renderStatusBar(int orientedMarginRight, int orientedMarginBottom, int orientedMarginLeft);
+  void renderChapterTitle(int tocIndex, int textY, int progressTextWidth, bool showBattery, bool showBatteryPercentage,
+                          int orientedMarginRight, int orientedMarginLeft) const;
 
  public:
   explicit EpubReaderActivity(GfxRenderer& renderer, MappedInputManager& mappedInput, std::unique_ptr<Epub> epub,
@@ -38,4 +46,11 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
   void onEnter() override;
   void onExit() override;
   void loop() override;
+  void onSleep() override;
+
+  // Reader layout for the current settings. Shared with background indexing so sections it builds match the
+  // cache key the reader looks up.
+  static GfxRenderer::Orientation getReaderOrientation();
+  static void getContentMargins(GfxRenderer::Orientation orientation, int* outTop, int* outRight, int* outBottom,
+                                int* outLeft);
 };
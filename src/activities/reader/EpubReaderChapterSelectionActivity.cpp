@@ -50,11 +50,6 @@ int EpubReaderChapterSelectionActivity::getPageItems() const {
   return items;
 }
 
-void EpubReaderChapterSelectionActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<EpubReaderChapterSelectionActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void EpubReaderChapterSelectionActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
@@ -62,8 +57,6 @@ void EpubReaderChapterSelectionActivity::onEnter() {
     return;
   }
 
-  renderingMutex = xSemaphoreCreateMutex();
-
   // Account for sync option offset when finding current TOC index
   const int syncOffset = hasSyncOption() ? 1 : 0;
   selectorIndex = epub->getTocIndexForSpineIndex(currentSpineIndex);
@@ -73,44 +66,32 @@ void EpubReaderChapterSelectionActivity::onEnter() {
   selectorIndex += syncOffset;  // Offset for top sync option
 
   // Trigger first update
-  updateRequired = true;
-  xTaskCreate(&EpubReaderChapterSelectionActivity::taskTrampoline, "EpubReaderChapterSelectionActivityTask",
-              4096,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderJob.request();
+  renderJob.start();
 }
 
 void EpubReaderChapterSelectionActivity::onExit() {
   ActivityWithSubactivity::onExit();
 
-  // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderJob.stop();
 }
 
 void EpubReaderChapterSelectionActivity::launchSyncActivity() {
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  RENDER_SCHEDULER.lock();
   exitActivity();
   enterNewActivity(new KOReaderSyncActivity(
       renderer, mappedInput, epub, epubPath, currentSpineIndex, currentPage, totalPagesInSpine,
       [this]() {
         // On cancel
         exitActivity();
-        updateRequired = true;
+        renderJob.request();
       },
       [this](int newSpineIndex, int newPage) {
         // On sync complete
         exitActivity();
         onSyncPosition(newSpineIndex, newPage);
       }));
-  xSemaphoreGive(renderingMutex);
+  RENDER_SCHEDULER.unlock();
 }
 
 void EpubReaderChapterSelectionActivity::loop() {
@@ -151,26 +132,14 @@ void EpubReaderChapterSelectionActivity::loop() {
     } else {
       selectorIndex = (selectorIndex + totalItems - 1) % totalItems;
     }
-    updateRequired = true;
+    renderJob.request();
   } else if (nextReleased) {
     if (skipPage) {
       selectorIndex = ((selectorIndex / pageItems + 1) * pageItems) % totalItems;
     } else {
       selectorIndex = (selectorIndex + 1) % totalItems;
     }
-    updateRequired = true;
-  }
-}
-
-void EpubReaderChapterSelectionActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired && !subActivity) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      renderScreen();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    renderJob.request();
   }
 }
 
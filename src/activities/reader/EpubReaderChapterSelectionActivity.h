@@ -1,23 +1,19 @@
 #pragma once
 #include <Epub.h>
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
 
 #include <memory>
 
 #include "../ActivityWithSubactivity.h"
+#include "RenderScheduler.h"
 
 class EpubReaderChapterSelectionActivity final : public ActivityWithSubactivity {
   std::shared_ptr<Epub> epub;
   std::string epubPath;
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
+  RenderJob renderJob{[this] { renderScreen(); }, [this] { return !subActivity; }};
   int currentSpineIndex = 0;
   int currentPage = 0;
   int totalPagesInSpine = 0;
   int selectorIndex = 0;
-  bool updateRequired = false;
   const std::function<void()> onGoBack;
   const std::function<void(int newSpineIndex)> onSelectSpineIndex;
   const std::function<void(int newSpineIndex, int newPage)> onSyncPosition;
@@ -38,8 +34,6 @@ class EpubReaderChapterSelectionActivity final : public ActivityWithSubactivity
   // Convert item index to TOC index (accounting for top sync option offset)
   int tocIndexFromItemIndex(int itemIndex) const;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void renderScreen();
   void launchSyncActivity();
 
@@ -1,6 +1,7 @@
 #include "KOReaderSyncActivity.h"
 
 #include <GfxRenderer.h>
+#include <Logging.h>
 #include <WiFi.h>
 #include <esp_sntp.h>
 
@@ -31,42 +32,37 @@ void syncTimeWithNTP() {
   }
 
   if (retry < maxRetries) {
-    Serial.printf("[%lu] [KOSync] NTP time synced\n", millis());
+    LOG_INF("KOSync", "NTP time synced\n");
   } else {
-    Serial.printf("[%lu] [KOSync] NTP sync timeout, using fallback\n", millis());
+    LOG_WRN("KOSync", "NTP sync timeout, using fallback\n");
   }
 }
 }  // namespace
 
-void KOReaderSyncActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<KOReaderSyncActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void KOReaderSyncActivity::onWifiSelectionComplete(const bool success) {
   exitActivity();
 
   if (!success) {
-    Serial.printf("[%lu] [KOSync] WiFi connection failed, exiting\n", millis());
+    LOG_ERR("KOSync", "WiFi connection failed, exiting\n");
     onCancel();
     return;
   }
 
-  Serial.printf("[%lu] [KOSync] WiFi connected, starting sync\n", millis());
+  LOG_INF("KOSync", "WiFi connected, starting sync\n");
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  RENDER_SCHEDULER.lock();
   state = SYNCING;
   statusMessage = "Syncing time...";
-  xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  RENDER_SCHEDULER.unlock();
+  renderJob.request();
 
   // Sync time with NTP before making API requests
   syncTimeWithNTP();
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  RENDER_SCHEDULER.lock();
   statusMessage = "Calculating document hash...";
-  xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  RENDER_SCHEDULER.unlock();
+  renderJob.request();
 
   performSync();
 }
@@ -79,20 +75,20 @@ void KOReaderSyncActivity::performSync() {
     documentHash = KOReaderDocumentId::calculate(epubPath);
   }
   if (documentHash.empty()) {
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    RENDER_SCHEDULER.lock();
     state = SYNC_FAILED;
     statusMessage = "Failed to calculate document hash";
-    xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    RENDER_SCHEDULER.unlock();
+    renderJob.request();
     return;
   }
 
-  Serial.printf("[%lu] [KOSync] Document hash: %s\n", millis(), documentHash.c_str());
+  LOG_INF("KOSync", "Document hash: %s\n", documentHash.c_str());
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  RENDER_SCHEDULER.lock();
   statusMessage = "Fetching remote progress...";
-  xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  RENDER_SCHEDULER.unlock();
+  renderJob.request();
   vTaskDelay(10 / portTICK_PERIOD_MS);
 
   // Fetch remote progress
@@ -100,20 +96,20 @@ void KOReaderSyncActivity::performSync() {
 
   if (result == KOReaderSyncClient::NOT_FOUND) {
     // No remote progress - offer to upload
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    RENDER_SCHEDULER.lock();
     state = NO_REMOTE_PROGRESS;
     hasRemoteProgress = false;
-    xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    RENDER_SCHEDULER.unlock();
+    renderJob.request();
     return;
   }
 
   if (result != KOReaderSyncClient::OK) {
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    RENDER_SCHEDULER.lock();
     state = SYNC_FAILED;
     statusMessage = KOReaderSyncClient::errorString(result);
-    xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    RENDER_SCHEDULER.unlock();
+    renderJob.request();
     return;
   }
 
@@ -126,19 +122,19 @@ void KOReaderSyncActivity::performSync() {
   CrossPointPosition localPos = {currentSpineIndex, currentPage, totalPagesInSpine};
   localProgress = ProgressMapper::toKOReader(epub, localPos);
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  RENDER_SCHEDULER.lock();
   state = SHOWING_RESULT;
   selectedOption = 0;  // Default to "Apply"
-  xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  RENDER_SCHEDULER.unlock();
+  renderJob.request();
 }
 
 void KOReaderSyncActivity::performUpload() {
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  RENDER_SCHEDULER.lock();
   state = UPLOADING;
   statusMessage = "Uploading progress...";
-  xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  RENDER_SCHEDULER.unlock();
+  renderJob.request();
   vTaskDelay(10 / portTICK_PERIOD_MS);
 
   // Convert current position to KOReader format
@@ -153,49 +149,42 @@ void KOReaderSyncActivity::performUpload() {
   const auto result = KOReaderSyncClient::updateProgress(progress);
 
   if (result != KOReaderSyncClient::OK) {
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    RENDER_SCHEDULER.lock();
     state = SYNC_FAILED;
     statusMessage = KOReaderSyncClient::errorString(result);
-    xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    RENDER_SCHEDULER.unlock();
+    renderJob.request();
     return;
   }
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  RENDER_SCHEDULER.lock();
   state = UPLOAD_COMPLETE;
-  xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  RENDER_SCHEDULER.unlock();
+  renderJob.request();
 }
 
 void KOReaderSyncActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
-
-  xTaskCreate(&KOReaderSyncActivity::taskTrampoline, "KOSyncTask",
-              4096,               // Stack size (larger for network operations)
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderJob.start();
 
   // Check for credentials first
   if (!KOREADER_STORE.hasCredentials()) {
     state = NO_CREDENTIALS;
-    updateRequired = true;
+    renderJob.request();
     return;
   }
 
   // Turn on WiFi
-  Serial.printf("[%lu] [KOSync] Turning on WiFi...\n", millis());
+  LOG_INF("KOSync", "Turning on WiFi...\n");
   WiFi.mode(WIFI_STA);
 
   // Check if already connected
   if (WiFi.status() == WL_CONNECTED) {
-    Serial.printf("[%lu] [KOSync] Already connected to WiFi\n", millis());
+    LOG_INF("KOSync", "Already connected to WiFi\n");
     state = SYNCING;
     statusMessage = "Syncing time...";
-    updateRequired = true;
+    renderJob.request();
 
     // Perform sync directly (will be handled in loop)
     xTaskCreate(
@@ -203,10 +192,10 @@ void KOReaderSyncActivity::onEnter() {
           auto* self = static_cast<KOReaderSyncActivity*>(param);
           // Sync time first
           syncTimeWithNTP();
-          xSemaphoreTake(self->renderingMutex, portMAX_DELAY);
+          RENDER_SCHEDULER.lock();
           self->statusMessage = "Calculating document hash...";
-          xSemaphoreGive(self->renderingMutex);
-          self->updateRequired = true;
+          RENDER_SCHEDULER.unlock();
+          self->renderJob.request();
           self->performSync();
           vTaskDelete(nullptr);
         },
@@ -215,7 +204,7 @@ void KOReaderSyncActivity::onEnter() {
   }
 
   // Launch WiFi selection subactivity
-  Serial.printf("[%lu] [KOSync] Launching WifiSelectionActivity...\n", millis());
+  LOG_INF("KOSync", "Launching WifiSelectionActivity...\n");
   enterNewActivity(new WifiSelectionActivity(renderer, mappedInput,
                                              [this](const bool connected) { onWifiSelectionComplete(connected); }));
 }
@@ -229,26 +218,7 @@ void KOReaderSyncActivity::onExit() {
   WiFi.mode(WIFI_OFF);
   delay(100);
 
-  // Wait until not rendering to delete task
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
-}
-
-void KOReaderSyncActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
+  renderJob.stop();
 }
 
 void KOReaderSyncActivity::render() {
@@ -392,11 +362,11 @@ void KOReaderSyncActivity::loop() {
     if (mappedInput.wasPressed(MappedInputManager::Button::Up) ||
         mappedInput.wasPressed(MappedInputManager::Button::Left)) {
       selectedOption = (selectedOption + 2) % 3;  // Wrap around
-      updateRequired = true;
+      renderJob.request();
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
                mappedInput.wasPressed(MappedInputManager::Button::Right)) {
       selectedOption = (selectedOption + 1) % 3;
-      updateRequired = true;
+      renderJob.request();
     }
 
     if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
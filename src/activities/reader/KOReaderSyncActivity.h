@@ -1,14 +1,12 @@
 #pragma once
 #include <Epub.h>
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
 
 #include <functional>
 #include <memory>
 
 #include "KOReaderSyncClient.h"
 #include "ProgressMapper.h"
+#include "RenderScheduler.h"
 #include "activities/ActivityWithSubactivity.h"
 
 /**
@@ -66,9 +64,7 @@ class KOReaderSyncActivity final : public ActivityWithSubactivity {
   int currentPage;
   int totalPagesInSpine;
 
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  RenderJob renderJob{[this] { render(); }};
 
   State state = WIFI_SELECTION;
   std::string statusMessage;
@@ -92,7 +88,5 @@ class KOReaderSyncActivity final : public ActivityWithSubactivity {
   void performSync();
   void performUpload();
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render();
 };
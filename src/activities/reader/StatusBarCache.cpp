@@ -0,0 +1,19 @@
+#include "StatusBarCache.h"
+
+bool StatusBarCache::Content::operator==(const Content& other) const {
+  return titleIndex == other.titleIndex && progressText == other.progressText &&
+         progressPercent == other.progressPercent && batteryLevel == other.batteryLevel && mode == other.mode &&
+         showBatteryPercentage == other.showBatteryPercentage && orientation == other.orientation &&
+         area.x == other.area.x && area.y == other.area.y && area.width == other.area.width &&
+         area.height == other.area.height;
+}
+
+void StatusBarCache::render(const GfxRenderer& renderer, const Content& content, const std::function<void()>& draw) {
+  if (valid && content == cached) {
+    renderer.restoreRegion(content.area, strip);
+    return;
+  }
+  draw();
+  cached = content;
+  valid = renderer.saveRegion(content.area, strip);
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <GfxRenderer.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// The reader status bar kept as a strip of frame buffer bits. A page whose status bar shows the same as the last one
+// gets the strip copied in, instead of the title being truncated and the text, battery and progress bar drawn again.
+// There is no invalidation: the cache lives in the reader activity, and the settings the strip depends on beyond
+// Content (margins, status bar fonts) can only change in the settings screen, which is entered after the reader exits.
+class StatusBarCache {
+ public:
+  // Everything the status bar shows, any change draws it again
+  struct Content {
+    int titleIndex = 0;  // TOC entry of the chapter title, 0 for books with one title
+    std::string progressText;
+    int progressPercent = 0;
+    int batteryLevel = 0;  // The percentage while it is shown, the battery icon's fill step otherwise
+    uint8_t mode = 0;      // CrossPointSettings::STATUS_BAR_MODE
+    bool showBatteryPercentage = false;
+    GfxRenderer::Orientation orientation = GfxRenderer::Portrait;
+    // Logical rect of the status bar, nothing else may be drawn in it before render()
+    GfxRenderer::Rect area = {0, 0, 0, 0};
+
+    bool operator==(const Content& other) const;
+  };
+
+  // Copies the cached strip into area if content matches it, otherwise calls draw and caches what it drew
+  void render(const GfxRenderer& renderer, const Content& content, const std::function<void()>& draw);
+
+ private:
+  Content cached;
+  std::vector<uint8_t> strip;
+  bool valid = false;
+};
@@ -1,10 +1,13 @@
 #include "TxtReaderActivity.h"
 
+#include <BookCacheKey.h>
 #include <GfxRenderer.h>
+#include <Logging.h>
 #include <SDCardManager.h>
 #include <Serialization.h>
 #include <Utf8.h>
 
+#include "Battery.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "MappedInputManager.h"
@@ -23,11 +26,6 @@ constexpr uint32_t CACHE_MAGIC = 0x54585449; // "TXTI"
 constexpr uint8_t CACHE_VERSION = 2; // Increment when cache format changes
 } // namespace
 
-void TxtReaderActivity::taskTrampoline(void *param) {
-  auto *self = static_cast<TxtReaderActivity *>(param);
-  self->displayTaskLoop();
-}
-
 void TxtReaderActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
@@ -54,8 +52,6 @@ void TxtReaderActivity::onEnter() {
     break;
   }
 
-  renderingMutex = xSemaphoreCreateMutex();
-
   txt->setupCacheDir();
 
   // Save current txt as last opened file and add to recent books
@@ -64,14 +60,9 @@ void TxtReaderActivity::onEnter() {
   RECENT_BOOKS.addBook(txt->getPath());
 
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&TxtReaderActivity::taskTrampoline, "TxtReaderActivityTask",
-              6144,              // Stack size
-              this,              // Parameters
-              1,                 // Priority
-              &displayTaskHandle // Task handle
-  );
+  renderJob.request();
+
+  renderJob.start();
 }
 
 void TxtReaderActivity::onExit() {
@@ -80,14 +71,7 @@ void TxtReaderActivity::onExit() {
   // Reset orientation back to portrait for the rest of the UI
   renderer.setOrientation(GfxRenderer::Orientation::Portrait);
 
-  // Wait until not rendering to delete task
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderJob.stop();
   pageOffsets.clear();
   currentPageLines.clear();
   txt.reset();
@@ -140,22 +124,10 @@ void TxtReaderActivity::loop() {
 
   if (prevTriggered && currentPage > 0) {
     currentPage--;
-    updateRequired = true;
+    renderJob.request();
   } else if (nextTriggered && currentPage < totalPages - 1) {
     currentPage++;
-    updateRequired = true;
-  }
-}
-
-void TxtReaderActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      renderScreen();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    renderJob.request();
   }
 }
 
@@ -204,8 +176,8 @@ void TxtReaderActivity::initializeReader() {
   if (linesPerPage < 1)
     linesPerPage = 1;
 
-  Serial.printf("[%lu] [TRS] Viewport: %dx%d, lines per page: %d\n", millis(),
-                viewportWidth, viewportHeight, linesPerPage);
+  LOG_DBG("TRS", "Viewport: %dx%d, lines per page: %d\n", viewportWidth,
+          viewportHeight, linesPerPage);
 
   // Try to load cached page index first
   if (!loadPageIndexCache()) {
@@ -229,8 +201,7 @@ void TxtReaderActivity::buildPageIndex() {
   const size_t fileSize = txt->getFileSize();
   int lastProgressPercent = -1;
 
-  Serial.printf("[%lu] [TRS] Building page index for %zu bytes...\n", millis(),
-                fileSize);
+  LOG_INF("TRS", "Building page index for %zu bytes...\n", fileSize);
 
   // Progress bar dimensions (matching EpubReaderActivity style)
   constexpr int barWidth = 200;
@@ -290,8 +261,7 @@ void TxtReaderActivity::buildPageIndex() {
   }
 
   totalPages = pageOffsets.size();
-  Serial.printf("[%lu] [TRS] Built page index: %d pages\n", millis(),
-                totalPages);
+  LOG_INF("TRS", "Built page index: %d pages\n", totalPages);
 }
 
 bool TxtReaderActivity::loadPageAtOffset(size_t offset,
@@ -308,8 +278,7 @@ bool TxtReaderActivity::loadPageAtOffset(size_t offset,
   size_t chunkSize = std::min(CHUNK_SIZE, fileSize - offset);
   auto *buffer = static_cast<uint8_t *>(malloc(chunkSize + 1));
   if (!buffer) {
-    Serial.printf("[%lu] [TRS] Failed to allocate %zu bytes\n", millis(),
-                  chunkSize);
+    LOG_ERR("TRS", "Failed to allocate %zu bytes\n", chunkSize);
     return false;
   }
 
@@ -517,10 +486,11 @@ void TxtReaderActivity::renderPage() {
     }
   };
 
-  // First pass: BW rendering
-  renderLines();
+  // First pass: BW rendering. The status bar goes first, its cached strip is
+  // only valid on a cleared screen
   renderStatusBar(orientedMarginRight, orientedMarginBottom,
                   orientedMarginLeft);
+  renderLines();
 
   if (pagesUntilFullRefresh <= 1) {
     renderer.displayBuffer(EInkDisplay::HALF_REFRESH);
@@ -555,7 +525,7 @@ void TxtReaderActivity::renderPage() {
 
 void TxtReaderActivity::renderStatusBar(const int orientedMarginRight,
                                         const int orientedMarginBottom,
-                                        const int orientedMarginLeft) const {
+                                        const int orientedMarginLeft) {
   const bool showProgressPercentage =
       SETTINGS.statusBar == CrossPointSettings::STATUS_BAR_MODE::FULL;
   const bool showProgressBar =
@@ -583,62 +553,80 @@ void TxtReaderActivity::renderStatusBar(const int orientedMarginRight,
 
   const auto screenHeight = renderer.getScreenHeight();
   const auto textY = screenHeight - orientedMarginBottom - 4;
-  int progressTextWidth = 0;
 
   const float progress =
       totalPages > 0 ? (currentPage + 1) * 100.0f / totalPages : 0;
 
-  if (showProgressText || showProgressPercentage) {
-    char progressStr[32];
-    if (showProgressPercentage) {
-      snprintf(progressStr, sizeof(progressStr), "%d/%d %.0f%%",
-               currentPage + 1, totalPages, progress);
-    } else {
-      snprintf(progressStr, sizeof(progressStr), "%d/%d", currentPage + 1,
-               totalPages);
+  char progressStr[32] = "";
+  if (showProgressPercentage) {
+    snprintf(progressStr, sizeof(progressStr), "%d/%d %.0f%%", currentPage + 1,
+             totalPages, progress);
+  } else if (showProgressText) {
+    snprintf(progressStr, sizeof(progressStr), "%d/%d", currentPage + 1,
+             totalPages);
+  }
+  const uint16_t batteryPercentage = showBattery ? battery.readPercentage() : 0;
+
+  StatusBarCache::Content content;
+  content.progressText = progressStr;
+  content.progressPercent = showProgressBar ? static_cast<int>(progress) : 0;
+  content.batteryLevel =
+      showBatteryPercentage
+          ? batteryPercentage
+          : ScreenComponents::getBatteryFillStep(batteryPercentage);
+  content.mode = SETTINGS.statusBar;
+  content.showBatteryPercentage = showBatteryPercentage;
+  content.orientation = renderer.getOrientation();
+  content.area = {0, textY, renderer.getScreenWidth(), screenHeight - textY};
+
+  statusBarCache.render(renderer, content, [&] {
+    int progressTextWidth = 0;
+    if (progressStr[0] != '\0') {
+      progressTextWidth = renderer.getTextWidth(SMALL_FONT_ID, progressStr);
+      renderer.drawText(SMALL_FONT_ID,
+                        renderer.getScreenWidth() - orientedMarginRight -
+                            progressTextWidth,
+                        textY, progressStr);
     }
 
-    progressTextWidth = renderer.getTextWidth(SMALL_FONT_ID, progressStr);
-    renderer.drawText(SMALL_FONT_ID,
-                      renderer.getScreenWidth() - orientedMarginRight -
-                          progressTextWidth,
-                      textY, progressStr);
-  }
-
-  if (showProgressBar) {
-    // Draw progress bar at the very bottom of the screen, from edge to edge of
-    // viewable area
-    ScreenComponents::drawBookProgressBar(renderer,
-                                          static_cast<size_t>(progress));
-  }
+    if (showProgressBar) {
+      // Draw progress bar at the very bottom of the screen, from edge to edge
+      // of viewable area
+      ScreenComponents::drawBookProgressBar(renderer, content.progressPercent);
+    }
 
-  if (showBattery) {
-    ScreenComponents::drawBattery(renderer, orientedMarginLeft, textY,
-                                  showBatteryPercentage);
-  }
+    if (showBattery) {
+      ScreenComponents::drawBattery(renderer, orientedMarginLeft, textY,
+                                    showBatteryPercentage, batteryPercentage);
+    }
 
-  if (showTitle) {
-    const int titleMarginLeft = 50 + 30 + orientedMarginLeft;
-    const int titleMarginRight = progressTextWidth + 30 + orientedMarginRight;
-    const int availableTextWidth =
-        renderer.getScreenWidth() - titleMarginLeft - titleMarginRight;
+    if (showTitle) {
+      const int titleMarginLeft = 50 + 30 + orientedMarginLeft;
+      const int titleMarginRight =
+          progressTextWidth + 30 + orientedMarginRight;
+      const int availableTextWidth =
+          renderer.getScreenWidth() - titleMarginLeft - titleMarginRight;
+
+      std::string title = txt->getTitle();
+      int titleWidth = renderer.getTextWidth(SMALL_FONT_ID, title.c_str());
+      if (titleWidth > availableTextWidth) {
+        title = renderer.truncatedText(SMALL_FONT_ID, title.c_str(),
+                                       availableTextWidth);
+        titleWidth = renderer.getTextWidth(SMALL_FONT_ID, title.c_str());
+      }
 
-    std::string title = txt->getTitle();
-    int titleWidth = renderer.getTextWidth(SMALL_FONT_ID, title.c_str());
-    while (titleWidth > availableTextWidth && title.length() > 11) {
-      title.replace(title.length() - 8, 8, "...");
-      titleWidth = renderer.getTextWidth(SMALL_FONT_ID, title.c_str());
+      renderer.drawText(SMALL_FONT_ID,
+                        titleMarginLeft + (availableTextWidth - titleWidth) / 2,
+                        textY, title.c_str());
     }
-
-    renderer.drawText(SMALL_FONT_ID,
-                      titleMarginLeft + (availableTextWidth - titleWidth) / 2,
-                      textY, title.c_str());
-  }
+  });
 }
 
 void TxtReaderActivity::saveProgress() const {
   FsFile f;
-  if (SdMan.openFileForWrite("TRS", txt->getCachePath() + "/progress.bin", f)) {
+  const auto progressPath =
+      BookCacheKey::getProgressPath(txt->getCachePath(), txt->getPath());
+  if (SdMan.openFileForWrite("TRS", progressPath, f)) {
     uint8_t data[4];
     data[0] = currentPage & 0xFF;
     data[1] = (currentPage >> 8) & 0xFF;
@@ -657,7 +645,9 @@ void TxtReaderActivity::saveProgress() const {
 
 void TxtReaderActivity::loadProgress() {
   FsFile f;
-  if (SdMan.openFileForRead("TRS", txt->getCachePath() + "/progress.bin", f)) {
+  const auto progressPath =
+      BookCacheKey::findProgressPath(txt->getCachePath(), txt->getPath());
+  if (SdMan.openFileForRead("TRS", progressPath, f)) {
     uint8_t data[4];
     if (f.read(data, 4) == 4) {
       currentPage = data[0] + (data[1] << 8);
@@ -667,8 +657,7 @@ void TxtReaderActivity::loadProgress() {
       if (currentPage < 0) {
         currentPage = 0;
       }
-      Serial.printf("[%lu] [TRS] Loaded progress: page %d/%d\n", millis(),
-                    currentPage, totalPages);
+      LOG_INF("TRS", "Loaded progress: page %d/%d\n", currentPage, totalPages);
     }
     f.close();
   }
@@ -690,7 +679,7 @@ bool TxtReaderActivity::loadPageIndexCache() {
   std::string cachePath = txt->getCachePath() + "/index.bin";
   FsFile f;
   if (!SdMan.openFileForRead("TRS", cachePath, f)) {
-    Serial.printf("[%lu] [TRS] No page index cache found\n", millis());
+    LOG_INF("TRS", "No page index cache found\n");
     return false;
   }
 
@@ -698,7 +687,7 @@ bool TxtReaderActivity::loadPageIndexCache() {
   uint32_t magic;
   serialization::readPod(f, magic);
   if (magic != CACHE_MAGIC) {
-    Serial.printf("[%lu] [TRS] Cache magic mismatch, rebuilding\n", millis());
+    LOG_WRN("TRS", "Cache magic mismatch, rebuilding\n");
     f.close();
     return false;
   }
@@ -706,8 +695,8 @@ bool TxtReaderActivity::loadPageIndexCache() {
   uint8_t version;
   serialization::readPod(f, version);
   if (version != CACHE_VERSION) {
-    Serial.printf("[%lu] [TRS] Cache version mismatch (%d != %d), rebuilding\n",
-                  millis(), version, CACHE_VERSION);
+    LOG_WRN("TRS", "Cache version mismatch (%d != %d), rebuilding\n", version,
+            CACHE_VERSION);
     f.close();
     return false;
   }
@@ -715,8 +704,7 @@ bool TxtReaderActivity::loadPageIndexCache() {
   uint32_t fileSize;
   serialization::readPod(f, fileSize);
   if (fileSize != txt->getFileSize()) {
-    Serial.printf("[%lu] [TRS] Cache file size mismatch, rebuilding\n",
-                  millis());
+    LOG_WRN("TRS", "Cache file size mismatch, rebuilding\n");
     f.close();
     return false;
   }
@@ -724,8 +712,7 @@ bool TxtReaderActivity::loadPageIndexCache() {
   int32_t cachedWidth;
   serialization::readPod(f, cachedWidth);
   if (cachedWidth != viewportWidth) {
-    Serial.printf("[%lu] [TRS] Cache viewport width mismatch, rebuilding\n",
-                  millis());
+    LOG_WRN("TRS", "Cache viewport width mismatch, rebuilding\n");
     f.close();
     return false;
   }
@@ -733,8 +720,7 @@ bool TxtReaderActivity::loadPageIndexCache() {
   int32_t cachedLines;
   serialization::readPod(f, cachedLines);
   if (cachedLines != linesPerPage) {
-    Serial.printf("[%lu] [TRS] Cache lines per page mismatch, rebuilding\n",
-                  millis());
+    LOG_WRN("TRS", "Cache lines per page mismatch, rebuilding\n");
     f.close();
     return false;
   }
@@ -742,8 +728,8 @@ bool TxtReaderActivity::loadPageIndexCache() {
   int32_t fontId;
   serialization::readPod(f, fontId);
   if (fontId != cachedFontId) {
-    Serial.printf("[%lu] [TRS] Cache font ID mismatch (%d != %d), rebuilding\n",
-                  millis(), fontId, cachedFontId);
+    LOG_WRN("TRS", "Cache font ID mismatch (%d != %d), rebuilding\n", fontId,
+            cachedFontId);
     f.close();
     return false;
   }
@@ -751,8 +737,7 @@ bool TxtReaderActivity::loadPageIndexCache() {
   int32_t margin;
   serialization::readPod(f, margin);
   if (margin != cachedScreenMargin) {
-    Serial.printf("[%lu] [TRS] Cache screen margin mismatch, rebuilding\n",
-                  millis());
+    LOG_WRN("TRS", "Cache screen margin mismatch, rebuilding\n");
     f.close();
     return false;
   }
@@ -760,9 +745,7 @@ bool TxtReaderActivity::loadPageIndexCache() {
   uint8_t alignment;
   serialization::readPod(f, alignment);
   if (alignment != cachedParagraphAlignment) {
-    Serial.printf(
-        "[%lu] [TRS] Cache paragraph alignment mismatch, rebuilding\n",
-        millis());
+    LOG_WRN("TRS", "Cache paragraph alignment mismatch, rebuilding\n");
     f.close();
     return false;
   }
@@ -782,8 +765,7 @@ bool TxtReaderActivity::loadPageIndexCache() {
 
   f.close();
   totalPages = pageOffsets.size();
-  Serial.printf("[%lu] [TRS] Loaded page index cache: %d pages\n", millis(),
-                totalPages);
+  LOG_INF("TRS", "Loaded page index cache: %d pages\n", totalPages);
   return true;
 }
 
@@ -791,7 +773,7 @@ void TxtReaderActivity::savePageIndexCache() const {
   std::string cachePath = txt->getCachePath() + "/index.bin";
   FsFile f;
   if (!SdMan.openFileForWrite("TRS", cachePath, f)) {
-    Serial.printf("[%lu] [TRS] Failed to save page index cache\n", millis());
+    LOG_ERR("TRS", "Failed to save page index cache\n");
     return;
   }
 
@@ -812,6 +794,5 @@ void TxtReaderActivity::savePageIndexCache() const {
   }
 
   f.close();
-  Serial.printf("[%lu] [TRS] Saved page index cache: %d pages\n", millis(),
-                totalPages);
+  LOG_INF("TRS", "Saved page index cache: %d pages\n", totalPages);
 }
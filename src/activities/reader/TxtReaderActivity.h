@@ -1,23 +1,21 @@
 #pragma once
 
 #include <Txt.h>
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
 
 #include <vector>
 
 #include "CrossPointSettings.h"
+#include "RenderScheduler.h"
+#include "StatusBarCache.h"
 #include "activities/ActivityWithSubactivity.h"
 
 class TxtReaderActivity final : public ActivityWithSubactivity {
   std::unique_ptr<Txt> txt;
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
+  RenderJob renderJob{[this] { renderScreen(); }};
+  StatusBarCache statusBarCache;
   int currentPage = 0;
   int totalPages = 1;
   int pagesUntilFullRefresh = 0;
-  bool updateRequired = false;
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
 
@@ -33,11 +31,9 @@ class TxtReaderActivity final : public ActivityWithSubactivity {
   int cachedScreenMargin = 0;
   uint8_t cachedParagraphAlignment = CrossPointSettings::LEFT_ALIGN;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void renderScreen();
   void renderPage();
-  void renderStatusBar(int orientedMarginRight, int orientedMarginBottom, int orientedMarginLeft) const;
+  void renderStatusBar(int orientedMarginRight, int orientedMarginBottom, int orientedMarginLeft);
 
   void initializeReader();
   bool loadPageAtOffset(size_t offset, std::vector<std::string>& outLines, size_t& nextOffset);
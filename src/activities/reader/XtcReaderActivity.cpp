@@ -7,8 +7,11 @@
 
 #include "XtcReaderActivity.h"
 
+#include <BookCacheKey.h>
 #include <FsHelpers.h>
 #include <GfxRenderer.h>
+#include <HeapStats.h>
+#include <Logging.h>
 #include <SDCardManager.h>
 
 #include "CrossPointSettings.h"
@@ -23,11 +26,6 @@ constexpr unsigned long skipPageMs = 700;
 constexpr unsigned long goHomeMs = 1000;
 } // namespace
 
-void XtcReaderActivity::taskTrampoline(void *param) {
-  auto *self = static_cast<XtcReaderActivity *>(param);
-  self->displayTaskLoop();
-}
-
 void XtcReaderActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
@@ -35,8 +33,6 @@ void XtcReaderActivity::onEnter() {
     return;
   }
 
-  renderingMutex = xSemaphoreCreateMutex();
-
   xtc->setupCacheDir();
 
   // Load saved progress
@@ -48,27 +44,15 @@ void XtcReaderActivity::onEnter() {
   RECENT_BOOKS.addBook(xtc->getPath(), xtc->getTitle(), xtc->getAuthor());
 
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&XtcReaderActivity::taskTrampoline, "XtcReaderActivityTask",
-              4096, // Stack size (smaller than EPUB since no parsing needed)
-              this, // Parameters
-              1,    // Priority
-              &displayTaskHandle // Task handle
-  );
+  renderJob.request();
+
+  renderJob.start();
 }
 
 void XtcReaderActivity::onExit() {
   ActivityWithSubactivity::onExit();
 
-  // Wait until not rendering to delete task
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderJob.stop();
   xtc.reset();
 }
 
@@ -82,20 +66,20 @@ void XtcReaderActivity::loop() {
   // Enter chapter selection activity
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
     if (xtc && xtc->hasChapters() && !xtc->getChapters().empty()) {
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      RENDER_SCHEDULER.lock();
       exitActivity();
       enterNewActivity(new XtcReaderChapterSelectionActivity(
           this->renderer, this->mappedInput, xtc, currentPage,
           [this] {
             exitActivity();
-            updateRequired = true;
+            renderJob.request();
           },
           [this](const uint32_t newPage) {
             currentPage = newPage;
             exitActivity();
-            updateRequired = true;
+            renderJob.request();
           }));
-      xSemaphoreGive(renderingMutex);
+      RENDER_SCHEDULER.unlock();
     }
   }
 
@@ -141,7 +125,7 @@ void XtcReaderActivity::loop() {
   // Handle end of book
   if (currentPage >= xtc->getPageCount()) {
     currentPage = xtc->getPageCount() - 1;
-    updateRequired = true;
+    renderJob.request();
     return;
   }
 
@@ -155,25 +139,13 @@ void XtcReaderActivity::loop() {
     } else {
       currentPage = 0;
     }
-    updateRequired = true;
+    renderJob.request();
   } else if (nextTriggered) {
     currentPage += skipAmount;
     if (currentPage >= xtc->getPageCount()) {
       currentPage = xtc->getPageCount(); // Allow showing "End of book"
     }
-    updateRequired = true;
-  }
-}
-
-void XtcReaderActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      renderScreen();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    renderJob.request();
   }
 }
 
@@ -214,10 +186,11 @@ void XtcReaderActivity::renderPage() {
   }
 
   // Allocate page buffer
+  heapstats::mark("xtc", "page");
   uint8_t *pageBuffer = static_cast<uint8_t *>(malloc(pageBufferSize));
   if (!pageBuffer) {
-    Serial.printf("[%lu] [XTR] Failed to allocate page buffer (%lu bytes)\n",
-                  millis(), pageBufferSize);
+    LOG_ERR("XTR", "Failed to allocate page buffer (%lu bytes)\n",
+            pageBufferSize);
     renderer.clearScreen();
     renderer.drawCenteredText(UI_12_FONT_ID, 300, "Memory error", true,
                               EpdFontFamily::BOLD);
@@ -228,8 +201,7 @@ void XtcReaderActivity::renderPage() {
   // Load page data
   size_t bytesRead = xtc->loadPage(currentPage, pageBuffer, pageBufferSize);
   if (bytesRead == 0) {
-    Serial.printf("[%lu] [XTR] Failed to load page %lu\n", millis(),
-                  currentPage);
+    LOG_ERR("XTR", "Failed to load page %lu\n", currentPage);
     free(pageBuffer);
     renderer.clearScreen();
     renderer.drawCenteredText(UI_12_FONT_ID, 300, "Page load error", true,
@@ -283,10 +255,10 @@ void XtcReaderActivity::renderPage() {
         pixelCounts[getPixelValue(x, y)]++;
       }
     }
-    Serial.printf("[%lu] [XTR] Pixel distribution: White=%lu, DarkGrey=%lu, "
-                  "LightGrey=%lu, Black=%lu\n",
-                  millis(), pixelCounts[0], pixelCounts[1], pixelCounts[2],
-                  pixelCounts[3]);
+    LOG_DBG("XTR",
+            "Pixel distribution: White=%lu, DarkGrey=%lu, LightGrey=%lu, "
+            "Black=%lu\n", pixelCounts[0], pixelCounts[1], pixelCounts[2],
+            pixelCounts[3]);
 
     // Pass 1: BW buffer - draw all non-white pixels as black
     for (uint16_t y = 0; y < pageHeight; y++) {
@@ -350,8 +322,8 @@ void XtcReaderActivity::renderPage() {
 
     free(pageBuffer);
 
-    Serial.printf("[%lu] [XTR] Rendered page %lu/%lu (2-bit grayscale)\n",
-                  millis(), currentPage + 1, xtc->getPageCount());
+    LOG_DBG("XTR", "Rendered page %lu/%lu (2-bit grayscale)\n", currentPage + 1,
+            xtc->getPageCount());
     return;
   } else {
     // 1-bit mode: 8 pixels per byte, MSB first
@@ -388,13 +360,15 @@ void XtcReaderActivity::renderPage() {
     pagesUntilFullRefresh--;
   }
 
-  Serial.printf("[%lu] [XTR] Rendered page %lu/%lu (%u-bit)\n", millis(),
-                currentPage + 1, xtc->getPageCount(), bitDepth);
+  LOG_DBG("XTR", "Rendered page %lu/%lu (%u-bit)\n", currentPage + 1,
+          xtc->getPageCount(), bitDepth);
 }
 
 void XtcReaderActivity::saveProgress() const {
   FsFile f;
-  if (SdMan.openFileForWrite("XTR", xtc->getCachePath() + "/progress.bin", f)) {
+  const auto progressPath =
+      BookCacheKey::getProgressPath(xtc->getCachePath(), xtc->getPath());
+  if (SdMan.openFileForWrite("XTR", progressPath, f)) {
     uint8_t data[4];
     data[0] = currentPage & 0xFF;
     data[1] = (currentPage >> 8) & 0xFF;
@@ -414,13 +388,14 @@ void XtcReaderActivity::saveProgress() const {
 
 void XtcReaderActivity::loadProgress() {
   FsFile f;
-  if (SdMan.openFileForRead("XTR", xtc->getCachePath() + "/progress.bin", f)) {
+  const auto progressPath =
+      BookCacheKey::findProgressPath(xtc->getCachePath(), xtc->getPath());
+  if (SdMan.openFileForRead("XTR", progressPath, f)) {
     uint8_t data[4];
     if (f.read(data, 4) == 4) {
       currentPage =
           data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24);
-      Serial.printf("[%lu] [XTR] Loaded progress: page %lu\n", millis(),
-                    currentPage);
+      LOG_INF("XTR", "Loaded progress: page %lu\n", currentPage);
 
       // Validate page number
       if (currentPage >= xtc->getPageCount()) {
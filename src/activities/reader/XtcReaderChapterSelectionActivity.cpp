@@ -38,11 +38,6 @@ int XtcReaderChapterSelectionActivity::findChapterIndexForPage(uint32_t page) co
   return 0;
 }
 
-void XtcReaderChapterSelectionActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<XtcReaderChapterSelectionActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void XtcReaderChapterSelectionActivity::onEnter() {
   Activity::onEnter();
 
@@ -50,28 +45,16 @@ void XtcReaderChapterSelectionActivity::onEnter() {
     return;
   }
 
-  renderingMutex = xSemaphoreCreateMutex();
   selectorIndex = findChapterIndexForPage(currentPage);
 
-  updateRequired = true;
-  xTaskCreate(&XtcReaderChapterSelectionActivity::taskTrampoline, "XtcReaderChapterSelectionActivityTask",
-              4096,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderJob.request();
+  renderJob.start();
 }
 
 void XtcReaderChapterSelectionActivity::onExit() {
   Activity::onExit();
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderJob.stop();
 }
 
 void XtcReaderChapterSelectionActivity::loop() {
@@ -100,7 +83,7 @@ void XtcReaderChapterSelectionActivity::loop() {
     } else {
       selectorIndex = (selectorIndex + total - 1) % total;
     }
-    updateRequired = true;
+    renderJob.request();
   } else if (nextReleased) {
     const int total = static_cast<int>(xtc->getChapters().size());
     if (total == 0) {
@@ -111,19 +94,7 @@ void XtcReaderChapterSelectionActivity::loop() {
     } else {
       selectorIndex = (selectorIndex + 1) % total;
     }
-    updateRequired = true;
-  }
-}
-
-void XtcReaderChapterSelectionActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      renderScreen();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    renderJob.request();
   }
 }
 
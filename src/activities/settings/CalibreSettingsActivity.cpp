@@ -14,36 +14,19 @@ constexpr int MENU_ITEMS = 3;
 const char* menuNames[MENU_ITEMS] = {"OPDS Server URL", "Username", "Password"};
 }  // namespace
 
-void CalibreSettingsActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<CalibreSettingsActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void CalibreSettingsActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
   selectedIndex = 0;
-  updateRequired = true;
-
-  xTaskCreate(&CalibreSettingsActivity::taskTrampoline, "CalibreSettingsTask",
-              4096,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderJob.request();
+
+  renderJob.start();
 }
 
 void CalibreSettingsActivity::onExit() {
   ActivityWithSubactivity::onExit();
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderJob.stop();
 }
 
 void CalibreSettingsActivity::loop() {
@@ -65,16 +48,16 @@ void CalibreSettingsActivity::loop() {
   if (mappedInput.wasPressed(MappedInputManager::Button::Up) ||
       mappedInput.wasPressed(MappedInputManager::Button::Left)) {
     selectedIndex = (selectedIndex + MENU_ITEMS - 1) % MENU_ITEMS;
-    updateRequired = true;
+    renderJob.request();
   } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
              mappedInput.wasPressed(MappedInputManager::Button::Right)) {
     selectedIndex = (selectedIndex + 1) % MENU_ITEMS;
-    updateRequired = true;
+    renderJob.request();
   }
 }
 
 void CalibreSettingsActivity::handleSelection() {
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  RENDER_SCHEDULER.lock();
 
   if (selectedIndex == 0) {
     // OPDS Server URL
@@ -88,11 +71,11 @@ void CalibreSettingsActivity::handleSelection() {
           SETTINGS.opdsServerUrl[sizeof(SETTINGS.opdsServerUrl) - 1] = '\0';
           SETTINGS.saveToFile();
           exitActivity();
-          updateRequired = true;
+          renderJob.request();
         },
         [this]() {
           exitActivity();
-          updateRequired = true;
+          renderJob.request();
         }));
   } else if (selectedIndex == 1) {
     // Username
@@ -106,11 +89,11 @@ void CalibreSettingsActivity::handleSelection() {
           SETTINGS.opdsUsername[sizeof(SETTINGS.opdsUsername) - 1] = '\0';
           SETTINGS.saveToFile();
           exitActivity();
-          updateRequired = true;
+          renderJob.request();
         },
         [this]() {
           exitActivity();
-          updateRequired = true;
+          renderJob.request();
         }));
   } else if (selectedIndex == 2) {
     // Password
@@ -124,27 +107,15 @@ void CalibreSettingsActivity::handleSelection() {
           SETTINGS.opdsPassword[sizeof(SETTINGS.opdsPassword) - 1] = '\0';
           SETTINGS.saveToFile();
           exitActivity();
-          updateRequired = true;
+          renderJob.request();
         },
         [this]() {
           exitActivity();
-          updateRequired = true;
+          renderJob.request();
         }));
   }
 
-  xSemaphoreGive(renderingMutex);
-}
-
-void CalibreSettingsActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired && !subActivity) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
+  RENDER_SCHEDULER.unlock();
 }
 
 void CalibreSettingsActivity::render() {
@@ -1,10 +1,8 @@
 #pragma once
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
 
 #include <functional>
 
+#include "RenderScheduler.h"
 #include "activities/ActivityWithSubactivity.h"
 
 /**
@@ -22,15 +20,11 @@ class CalibreSettingsActivity final : public ActivityWithSubactivity {
   void loop() override;
 
  private:
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  RenderJob renderJob{[this] { render(); }, [this] { return !subActivity; }};
 
   int selectedIndex = 0;
   const std::function<void()> onBack;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render();
   void handleSelection();
 };
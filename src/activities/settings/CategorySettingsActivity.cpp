@@ -8,6 +8,8 @@
 #include "CalibreSettingsActivity.h"
 #include "ClearCacheActivity.h"
 #include "CrossPointSettings.h"
+#include "HeapDiagnosticsActivity.h"
+#include "IndexLibraryActivity.h"
 #include "KOReaderSettingsActivity.h"
 #include "MappedInputManager.h"
 #include "OtaUpdateActivity.h"
@@ -15,35 +17,18 @@
 #include "activities/weather/WeatherSelectionActivity.h"
 #include "fontIds.h"
 
-void CategorySettingsActivity::taskTrampoline(void *param) {
-  auto *self = static_cast<CategorySettingsActivity *>(param);
-  self->displayTaskLoop();
-}
-
 void CategorySettingsActivity::onEnter() {
   Activity::onEnter();
-  renderingMutex = xSemaphoreCreateMutex();
-
   selectedSettingIndex = 0;
-  updateRequired = true;
+  renderJob.request();
 
-  xTaskCreate(&CategorySettingsActivity::taskTrampoline,
-              "CategorySettingsActivityTask", 4096, this, 1,
-              &displayTaskHandle);
+  renderJob.start();
 }
 
 void CategorySettingsActivity::onExit() {
   ActivityWithSubactivity::onExit();
 
-  // Wait until not rendering to delete task to avoid killing mid-instruction to
-  // EPD
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderJob.stop();
 }
 
 void CategorySettingsActivity::loop() {
@@ -55,7 +40,7 @@ void CategorySettingsActivity::loop() {
   // Handle actions with early return
   if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
     toggleCurrentSetting();
-    updateRequired = true;
+    renderJob.request();
     return;
   }
 
@@ -71,13 +56,13 @@ void CategorySettingsActivity::loop() {
     selectedSettingIndex = (selectedSettingIndex > 0)
                                ? (selectedSettingIndex - 1)
                                : (settingsCount - 1);
-    updateRequired = true;
+    renderJob.request();
   } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
              mappedInput.wasPressed(MappedInputManager::Button::Right)) {
     selectedSettingIndex = (selectedSettingIndex < settingsCount - 1)
                                ? (selectedSettingIndex + 1)
                                : 0;
-    updateRequired = true;
+    renderJob.request();
   }
 }
 
@@ -106,43 +91,60 @@ void CategorySettingsActivity::toggleCurrentSetting() {
     }
   } else if (setting.type == SettingType::ACTION) {
     if (strcmp(setting.name, "KOReader Sync") == 0) {
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      RENDER_SCHEDULER.lock();
       exitActivity();
       enterNewActivity(
           new KOReaderSettingsActivity(renderer, mappedInput, [this] {
             exitActivity();
-            updateRequired = true;
+            renderJob.request();
           }));
-      xSemaphoreGive(renderingMutex);
+      RENDER_SCHEDULER.unlock();
     } else if (strcmp(setting.name, "OPDS Browser") == 0) {
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      RENDER_SCHEDULER.lock();
       exitActivity();
       enterNewActivity(
           new CalibreSettingsActivity(renderer, mappedInput, [this] {
             exitActivity();
-            updateRequired = true;
+            renderJob.request();
           }));
-      xSemaphoreGive(renderingMutex);
+      RENDER_SCHEDULER.unlock();
     } else if (strcmp(setting.name, "Clear Cache") == 0 ||
                strcmp(setting.name, "Xóa bộ nhớ đệm") == 0 ||
                strcmp(setting.name, "Đặt lại thiết bị") == 0) {
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      RENDER_SCHEDULER.lock();
       exitActivity();
       enterNewActivity(new ClearCacheActivity(renderer, mappedInput, [this] {
         exitActivity();
-        updateRequired = true;
+        renderJob.request();
       }));
-      xSemaphoreGive(renderingMutex);
+      RENDER_SCHEDULER.unlock();
+    } else if (strcmp(setting.name, "Lập chỉ mục thư viện") == 0) {
+      RENDER_SCHEDULER.lock();
+      exitActivity();
+      enterNewActivity(new IndexLibraryActivity(renderer, mappedInput, [this] {
+        exitActivity();
+        renderJob.request();
+      }));
+      RENDER_SCHEDULER.unlock();
+    } else if (strcmp(setting.name, "Chẩn đoán bộ nhớ") == 0) {
+      RENDER_SCHEDULER.lock();
+      exitActivity();
+      enterNewActivity(
+          new HeapDiagnosticsActivity(renderer, mappedInput, [this] {
+            exitActivity();
+            renderJob.request();
+          }));
+      RENDER_SCHEDULER.unlock();
     } else if (strcmp(setting.name, "Check for updates") == 0) {
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      RENDER_SCHEDULER.lock();
       exitActivity();
       enterNewActivity(new OtaUpdateActivity(renderer, mappedInput, [this] {
         exitActivity();
-        updateRequired = true;
+        renderJob.request();
       }));
-      xSemaphoreGive(renderingMutex);
+      RENDER_SCHEDULER.unlock();
     } else if (strcmp(setting.name, "Kết nối WiFi") == 0) {
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      RENDER_SCHEDULER.lock();
       exitActivity();
       // For WiFi, we want to return to this menu after connection
       enterNewActivity(new WifiSelectionActivity(renderer, mappedInput,
@@ -152,18 +154,18 @@ void CategorySettingsActivity::toggleCurrentSetting() {
                                                    // weather on connection we
                                                    // could do it here but
                                                    // simpler to just return.
-                                                   updateRequired = true;
+                                                   renderJob.request();
                                                  }));
-      xSemaphoreGive(renderingMutex);
+      RENDER_SCHEDULER.unlock();
     } else if (strcmp(setting.name, "Vị trí thời tiết") == 0) {
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      RENDER_SCHEDULER.lock();
       exitActivity();
       enterNewActivity(
           new WeatherSelectionActivity(renderer, mappedInput, [this] {
             exitActivity();
-            updateRequired = true;
+            renderJob.request();
           }));
-      xSemaphoreGive(renderingMutex);
+      RENDER_SCHEDULER.unlock();
     }
   } else {
     return;
@@ -172,18 +174,6 @@ void CategorySettingsActivity::toggleCurrentSetting() {
   SETTINGS.saveToFile();
 }
 
-void CategorySettingsActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired && !subActivity) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void CategorySettingsActivity::render() const {
   renderer.clearScreen();
 
@@ -1,12 +1,10 @@
 #pragma once
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
 
 #include <functional>
 #include <string>
 #include <vector>
 
+#include "RenderScheduler.h"
 #include "activities/ActivityWithSubactivity.h"
 
 class CrossPointSettings;
@@ -42,17 +40,13 @@ struct SettingInfo {
 };
 
 class CategorySettingsActivity final : public ActivityWithSubactivity {
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  RenderJob renderJob{[this] { render(); }, [this] { return !subActivity; }};
   int selectedSettingIndex = 0;
   const char* categoryName;
   const SettingInfo* settingsList;
   int settingsCount;
   const std::function<void()> onGoBack;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
   void toggleCurrentSetting();
 
@@ -1,57 +1,26 @@
 #include "ClearCacheActivity.h"
 
 #include <GfxRenderer.h>
-#include <HardwareSerial.h>
+#include <Logging.h>
 #include <SDCardManager.h>
 
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
 #include "fontIds.h"
 
-void ClearCacheActivity::taskTrampoline(void *param) {
-  auto *self = static_cast<ClearCacheActivity *>(param);
-  self->displayTaskLoop();
-}
-
 void ClearCacheActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
   state = WARNING;
-  updateRequired = true;
-
-  xTaskCreate(&ClearCacheActivity::taskTrampoline, "ClearCacheActivityTask",
-              4096,              // Stack size
-              this,              // Parameters
-              1,                 // Priority
-              &displayTaskHandle // Task handle
-  );
+  renderJob.request();
+
+  renderJob.start();
 }
 
 void ClearCacheActivity::onExit() {
   ActivityWithSubactivity::onExit();
 
-  // Wait until not rendering to delete task to avoid killing mid-instruction to
-  // EPD
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
-}
-
-void ClearCacheActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
+  renderJob.stop();
 }
 
 void ClearCacheActivity::render() {
@@ -119,7 +88,7 @@ void ClearCacheActivity::render() {
 }
 
 void ClearCacheActivity::clearCache() {
-  Serial.printf("[%lu] [FACTORY_RESET] Performing full reset...\n", millis());
+  LOG_INF("FACTORY_RESET", "Performing full reset...\n");
 
   char filename[128];
 
@@ -149,28 +118,25 @@ void ClearCacheActivity::clearCache() {
   RECENT_BOOKS.clear();
   RECENT_BOOKS.saveToFile();
 
-  Serial.printf("[%lu] [FACTORY_RESET] Reset complete. Rebooting...\n",
-                millis());
+  LOG_INF("FACTORY_RESET", "Reset complete. Rebooting...\n");
   ESP.restart();
 }
 
 void ClearCacheActivity::loop() {
   if (state == WARNING) {
     if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
-      Serial.printf(
-          "[%lu] [CLEAR_CACHE] User confirmed, starting cache clear\n",
-          millis());
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      LOG_INF("CLEAR_CACHE", "User confirmed, starting cache clear\n");
+      RENDER_SCHEDULER.lock();
       state = CLEARING;
-      xSemaphoreGive(renderingMutex);
-      updateRequired = true;
+      RENDER_SCHEDULER.unlock();
+      renderJob.request();
       vTaskDelay(10 / portTICK_PERIOD_MS);
 
       clearCache();
     }
 
     if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
-      Serial.printf("[%lu] [CLEAR_CACHE] User cancelled\n", millis());
+      LOG_INF("CLEAR_CACHE", "User cancelled\n");
       goBack();
     }
     return;
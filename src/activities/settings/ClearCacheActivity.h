@@ -1,11 +1,8 @@
 #pragma once
 
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
-
 #include <functional>
 
+#include "RenderScheduler.h"
 #include "activities/ActivityWithSubactivity.h"
 
 class ClearCacheActivity final : public ActivityWithSubactivity {
@@ -22,16 +19,12 @@ class ClearCacheActivity final : public ActivityWithSubactivity {
   enum State { WARNING, CLEARING, SUCCESS, FAILED };
 
   State state = WARNING;
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  RenderJob renderJob{[this] { render(); }};
   const std::function<void()> goBack;
 
   int clearedCount = 0;
   int failedCount = 0;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render();
   void clearCache();
 };
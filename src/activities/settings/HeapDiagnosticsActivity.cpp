@@ -0,0 +1,135 @@
+#include "HeapDiagnosticsActivity.h"
+
+#include <GfxRenderer.h>
+#include <HeapStats.h>
+
+#include <string>
+
+#include "MappedInputManager.h"
+#include "fontIds.h"
+
+namespace {
+constexpr int HEADER_HEIGHT = 130;
+constexpr int FOOTER_HEIGHT = 60;
+constexpr int ROW_HEIGHT = 25;
+// Right edges of the number columns
+constexpr int FREE_COLUMN_RIGHT = 120;
+constexpr int BLOCK_COLUMN_RIGHT = 70;
+constexpr int FRAGMENTATION_COLUMN_RIGHT = 20;
+
+std::string toKb(const uint32_t bytes) {
+  return std::to_string(bytes / 1024) + " KB";
+}
+} // namespace
+
+void HeapDiagnosticsActivity::onEnter() {
+  Activity::onEnter();
+
+  page = 0;
+  renderJob.request();
+
+  renderJob.start();
+}
+
+void HeapDiagnosticsActivity::onExit() {
+  Activity::onExit();
+
+  renderJob.stop();
+}
+
+void HeapDiagnosticsActivity::loop() {
+  if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
+    goBack();
+    return;
+  }
+
+  // Confirm takes a fresh reading, the stage table only changes elsewhere
+  if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
+    renderJob.request();
+    return;
+  }
+
+  const int pageCount = getPageCount();
+  if (mappedInput.wasPressed(MappedInputManager::Button::Up) ||
+      mappedInput.wasPressed(MappedInputManager::Button::Left)) {
+    page = page > 0 ? page - 1 : pageCount - 1;
+    renderJob.request();
+  } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
+             mappedInput.wasPressed(MappedInputManager::Button::Right)) {
+    page = page < pageCount - 1 ? page + 1 : 0;
+    renderJob.request();
+  }
+}
+
+int HeapDiagnosticsActivity::getRowsPerPage() const {
+  return (renderer.getScreenHeight() - HEADER_HEIGHT - FOOTER_HEIGHT) /
+         ROW_HEIGHT;
+}
+
+int HeapDiagnosticsActivity::getPageCount() const {
+  const int rows = static_cast<int>(heapstats::getStageCount());
+  const int rowsPerPage = getRowsPerPage();
+  return rows == 0 ? 1 : (rows + rowsPerPage - 1) / rowsPerPage;
+}
+
+void HeapDiagnosticsActivity::render() {
+  const auto pageWidth = renderer.getScreenWidth();
+  const heapstats::Sample now = heapstats::sample();
+
+  renderer.clearScreen();
+  renderer.drawCenteredText(UI_12_FONT_ID, 15, "Chẩn đoán bộ nhớ", true,
+                            EpdFontFamily::BOLD);
+
+  const std::string freeText = "Trống: " + toKb(now.freeHeap) +
+                               ", khối lớn nhất: " + toKb(now.largestBlock);
+  const std::string minText =
+      "Phân mảnh: " + std::to_string(now.getFragmentationPercent()) +
+      "%, thấp nhất: " + toKb(now.minFreeHeap);
+  renderer.drawText(UI_10_FONT_ID, 20, 50, freeText.c_str());
+  renderer.drawText(UI_10_FONT_ID, 20, 75, minText.c_str());
+
+  // Column headers: lowest free heap, lowest largest block, fragmentation at
+  // the last mark
+  const int headerY = HEADER_HEIGHT - ROW_HEIGHT - 5;
+  const auto drawRight = [&](const int right, const int y, const char *text,
+                             const EpdFontFamily::Style style) {
+    renderer.drawText(SMALL_FONT_ID,
+                      pageWidth - right -
+                          renderer.getTextWidth(SMALL_FONT_ID, text, style),
+                      y, text, true, style);
+  };
+  renderer.drawText(SMALL_FONT_ID, 20, headerY, "Giai đoạn", true,
+                    EpdFontFamily::BOLD);
+  drawRight(FREE_COLUMN_RIGHT, headerY, "Trống", EpdFontFamily::BOLD);
+  drawRight(BLOCK_COLUMN_RIGHT, headerY, "Khối", EpdFontFamily::BOLD);
+  drawRight(FRAGMENTATION_COLUMN_RIGHT, headerY, "%", EpdFontFamily::BOLD);
+
+  const int rowsPerPage = getRowsPerPage();
+  const size_t first = static_cast<size_t>(page * rowsPerPage);
+  heapstats::StageStats stage;
+  for (int row = 0;
+       row < rowsPerPage && heapstats::getStage(first + row, stage); row++) {
+    const int y = HEADER_HEIGHT + row * ROW_HEIGHT;
+    const std::string name = std::string(stage.scope) + " / " + stage.stage;
+    renderer.drawText(SMALL_FONT_ID, 20, y,
+                      renderer
+                          .truncatedText(SMALL_FONT_ID, name.c_str(),
+                                         pageWidth - FREE_COLUMN_RIGHT - 100)
+                          .c_str());
+    drawRight(FREE_COLUMN_RIGHT, y,
+              std::to_string(stage.lowestFree / 1024).c_str(),
+              EpdFontFamily::REGULAR);
+    drawRight(BLOCK_COLUMN_RIGHT, y,
+              std::to_string(stage.lowestLargestBlock / 1024).c_str(),
+              EpdFontFamily::REGULAR);
+    drawRight(FRAGMENTATION_COLUMN_RIGHT, y,
+              std::to_string(stage.last.getFragmentationPercent()).c_str(),
+              EpdFontFamily::REGULAR);
+  }
+
+  const auto labels =
+      mappedInput.mapLabels("« Quay lại", "Làm mới", "Trước", "Sau");
+  renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2,
+                           labels.btn3, labels.btn4);
+  renderer.displayBuffer();
+}
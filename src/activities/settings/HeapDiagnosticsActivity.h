@@ -0,0 +1,28 @@
+#pragma once
+
+#include <functional>
+
+#include "RenderScheduler.h"
+#include "activities/Activity.h"
+
+// Shows the heap telemetry collected by lib/HeapStats: the heap right now and, per activity and pipeline stage, the
+// lowest free heap and largest free block seen. Same data as /api/heap.
+class HeapDiagnosticsActivity final : public Activity {
+ public:
+  explicit HeapDiagnosticsActivity(GfxRenderer& renderer, MappedInputManager& mappedInput,
+                                   const std::function<void()>& goBack)
+      : Activity("HeapDiagnostics", renderer, mappedInput), goBack(goBack) {}
+
+  void onEnter() override;
+  void onExit() override;
+  void loop() override;
+
+ private:
+  RenderJob renderJob{[this] { render(); }};
+  int page = 0;
+  const std::function<void()> goBack;
+
+  int getRowsPerPage() const;
+  int getPageCount() const;
+  void render();
+};
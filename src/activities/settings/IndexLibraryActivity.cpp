@@ -0,0 +1,119 @@
+#include "IndexLibraryActivity.h"
+
+#include <GfxRenderer.h>
+#include <Logging.h>
+
+#include "LibraryCatalog.h"
+#include "MappedInputManager.h"
+#include "ScreenComponents.h"
+#include "fontIds.h"
+#include "services/BookIngestService.h"
+
+void IndexLibraryActivity::onEnter() {
+  ActivityWithSubactivity::onEnter();
+
+  // Pick up books copied to the card directly, then queue whatever has not
+  // been indexed yet on top of any pending uploads
+  LIBRARY_CATALOG.refresh();
+  BOOK_INGEST.enqueueUnindexed();
+  totalBooks = static_cast<int>(BOOK_INGEST.getPendingCount());
+  remainingBooks = totalBooks;
+  currentBook = BOOK_INGEST.getCurrentPath();
+  state = totalBooks > 0 ? INDEXING : DONE;
+  renderJob.request();
+
+  renderJob.start();
+}
+
+void IndexLibraryActivity::onExit() {
+  ActivityWithSubactivity::onExit();
+
+  renderJob.stop();
+  LIBRARY_CATALOG.saveIfDirty();
+}
+
+void IndexLibraryActivity::render() {
+  const auto pageWidth = renderer.getScreenWidth();
+  const auto pageHeight = renderer.getScreenHeight();
+
+  renderer.clearScreen();
+  renderer.drawCenteredText(UI_12_FONT_ID, 15, "Lập chỉ mục thư viện", true,
+                            EpdFontFamily::BOLD);
+
+  if (state == INDEXING) {
+    const int done = totalBooks - remainingBooks;
+    const std::string countText =
+        std::to_string(done) + " / " + std::to_string(totalBooks);
+    renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2 - 50,
+                              "Đang lập chỉ mục...", true, EpdFontFamily::BOLD);
+
+    // Show the file name rather than the full path
+    const auto slash = currentBook.find_last_of('/');
+    const std::string name = slash == std::string::npos
+                                 ? currentBook
+                                 : currentBook.substr(slash + 1);
+    renderer.drawCenteredText(
+        UI_10_FONT_ID, pageHeight / 2 - 20,
+        renderer.truncatedText(UI_10_FONT_ID, name.c_str(), pageWidth - 40)
+            .c_str());
+
+    constexpr int barHeight = 16;
+    ScreenComponents::drawProgressBar(renderer, 40, pageHeight / 2 + 10,
+                                      pageWidth - 80, barHeight, done,
+                                      totalBooks);
+    renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2 + 40,
+                              countText.c_str());
+
+    const auto labels = mappedInput.mapLabels("« Dừng", "", "", "");
+    renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2,
+                             labels.btn3, labels.btn4);
+    renderer.displayBuffer();
+    return;
+  }
+
+  if (totalBooks == 0) {
+    renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2 - 10,
+                              "Tất cả sách đã được lập chỉ mục", true,
+                              EpdFontFamily::BOLD);
+  } else {
+    const std::string resultText =
+        std::to_string(totalBooks) + " sách đã được lập chỉ mục";
+    renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2 - 10,
+                              resultText.c_str(), true, EpdFontFamily::BOLD);
+  }
+
+  const auto labels = mappedInput.mapLabels("« Quay lại", "", "", "");
+  renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2,
+                           labels.btn3, labels.btn4);
+  renderer.displayBuffer();
+}
+
+void IndexLibraryActivity::loop() {
+  if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
+    LOG_INF("IDX", "Leaving with %d books pending\n",
+            static_cast<int>(BOOK_INGEST.getPendingCount()));
+    goBack();
+    return;
+  }
+
+  if (state != INDEXING) {
+    return;
+  }
+
+  // Rendering measures fonts and may touch the SD card, keep the ingest stage
+  // out of its way
+  RENDER_SCHEDULER.lock();
+  BOOK_INGEST.processNext(renderer);
+  const int pending = static_cast<int>(BOOK_INGEST.getPendingCount());
+  RENDER_SCHEDULER.unlock();
+
+  // Only redraw when a book finishes, every stage would be too many refreshes
+  if (pending != remainingBooks) {
+    remainingBooks = pending;
+    currentBook = BOOK_INGEST.getCurrentPath();
+    if (pending == 0) {
+      state = DONE;
+    }
+    renderJob.request();
+  }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include "RenderScheduler.h"
+#include "activities/ActivityWithSubactivity.h"
+
+// Runs the book ingest queue in the foreground for books already on the card, so they open without indexing later.
+// Leaving early keeps the remaining queue for the next run.
+class IndexLibraryActivity final : public ActivityWithSubactivity {
+ public:
+  explicit IndexLibraryActivity(GfxRenderer& renderer, MappedInputManager& mappedInput,
+                                const std::function<void()>& goBack)
+      : ActivityWithSubactivity("IndexLibrary", renderer, mappedInput), goBack(goBack) {}
+
+  void onEnter() override;
+  void onExit() override;
+  void loop() override;
+  bool skipLoopDelay() override { return state == INDEXING; }
+  bool preventAutoSleep() override { return state == INDEXING; }
+
+ private:
+  enum State { INDEXING, DONE };
+
+  State state = INDEXING;
+  RenderJob renderJob{[this] { render(); }};
+  const std::function<void()> goBack;
+
+  int totalBooks = 0;
+  int remainingBooks = 0;
+  std::string currentBook;
+
+  void render();
+};
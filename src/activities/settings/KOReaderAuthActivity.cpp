@@ -9,28 +9,23 @@
 #include "activities/network/WifiSelectionActivity.h"
 #include "fontIds.h"
 
-void KOReaderAuthActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<KOReaderAuthActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void KOReaderAuthActivity::onWifiSelectionComplete(const bool success) {
   exitActivity();
 
   if (!success) {
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    RENDER_SCHEDULER.lock();
     state = FAILED;
     errorMessage = "WiFi connection failed";
-    xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    RENDER_SCHEDULER.unlock();
+    renderJob.request();
     return;
   }
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  RENDER_SCHEDULER.lock();
   state = AUTHENTICATING;
   statusMessage = "Authenticating...";
-  xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  RENDER_SCHEDULER.unlock();
+  renderJob.request();
 
   performAuthentication();
 }
@@ -38,7 +33,7 @@ void KOReaderAuthActivity::onWifiSelectionComplete(const bool success) {
 void KOReaderAuthActivity::performAuthentication() {
   const auto result = KOReaderSyncClient::authenticate();
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  RENDER_SCHEDULER.lock();
   if (result == KOReaderSyncClient::OK) {
     state = SUCCESS;
     statusMessage = "Successfully authenticated!";
@@ -46,21 +41,14 @@ void KOReaderAuthActivity::performAuthentication() {
     state = FAILED;
     errorMessage = KOReaderSyncClient::errorString(result);
   }
-  xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  RENDER_SCHEDULER.unlock();
+  renderJob.request();
 }
 
 void KOReaderAuthActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
-
-  xTaskCreate(&KOReaderAuthActivity::taskTrampoline, "KOAuthTask",
-              4096,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderJob.start();
 
   // Turn on WiFi
   WiFi.mode(WIFI_STA);
@@ -69,7 +57,7 @@ void KOReaderAuthActivity::onEnter() {
   if (WiFi.status() == WL_CONNECTED) {
     state = AUTHENTICATING;
     statusMessage = "Authenticating...";
-    updateRequired = true;
+    renderJob.request();
 
     // Perform authentication in a separate task
     xTaskCreate(
@@ -96,25 +84,7 @@ void KOReaderAuthActivity::onExit() {
   WiFi.mode(WIFI_OFF);
   delay(100);
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
-}
-
-void KOReaderAuthActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired && !subActivity) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
+  renderJob.stop();
 }
 
 void KOReaderAuthActivity::render() {
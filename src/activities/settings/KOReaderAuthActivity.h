@@ -1,10 +1,8 @@
 #pragma once
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
 
 #include <functional>
 
+#include "RenderScheduler.h"
 #include "activities/ActivityWithSubactivity.h"
 
 /**
@@ -25,9 +23,7 @@ class KOReaderAuthActivity final : public ActivityWithSubactivity {
  private:
   enum State { WIFI_SELECTION, CONNECTING, AUTHENTICATING, SUCCESS, FAILED };
 
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  RenderJob renderJob{[this] { render(); }, [this] { return !subActivity; }};
 
   State state = WIFI_SELECTION;
   std::string statusMessage;
@@ -38,7 +34,5 @@ class KOReaderAuthActivity final : public ActivityWithSubactivity {
   void onWifiSelectionComplete(bool success);
   void performAuthentication();
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render();
 };
@@ -15,36 +15,19 @@ constexpr int MENU_ITEMS = 5;
 const char* menuNames[MENU_ITEMS] = {"Username", "Password", "Sync Server URL", "Document Matching", "Authenticate"};
 }  // namespace
 
-void KOReaderSettingsActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<KOReaderSettingsActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void KOReaderSettingsActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
   selectedIndex = 0;
-  updateRequired = true;
-
-  xTaskCreate(&KOReaderSettingsActivity::taskTrampoline, "KOReaderSettingsTask",
-              4096,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderJob.request();
+
+  renderJob.start();
 }
 
 void KOReaderSettingsActivity::onExit() {
   ActivityWithSubactivity::onExit();
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderJob.stop();
 }
 
 void KOReaderSettingsActivity::loop() {
@@ -66,16 +49,16 @@ void KOReaderSettingsActivity::loop() {
   if (mappedInput.wasPressed(MappedInputManager::Button::Up) ||
       mappedInput.wasPressed(MappedInputManager::Button::Left)) {
     selectedIndex = (selectedIndex + MENU_ITEMS - 1) % MENU_ITEMS;
-    updateRequired = true;
+    renderJob.request();
   } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
              mappedInput.wasPressed(MappedInputManager::Button::Right)) {
     selectedIndex = (selectedIndex + 1) % MENU_ITEMS;
-    updateRequired = true;
+    renderJob.request();
   }
 }
 
 void KOReaderSettingsActivity::handleSelection() {
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  RENDER_SCHEDULER.lock();
 
   if (selectedIndex == 0) {
     // Username
@@ -88,11 +71,11 @@ void KOReaderSettingsActivity::handleSelection() {
           KOREADER_STORE.setCredentials(username, KOREADER_STORE.getPassword());
           KOREADER_STORE.saveToFile();
           exitActivity();
-          updateRequired = true;
+          renderJob.request();
         },
         [this]() {
           exitActivity();
-          updateRequired = true;
+          renderJob.request();
         }));
   } else if (selectedIndex == 1) {
     // Password
@@ -105,11 +88,11 @@ void KOReaderSettingsActivity::handleSelection() {
           KOREADER_STORE.setCredentials(KOREADER_STORE.getUsername(), password);
           KOREADER_STORE.saveToFile();
           exitActivity();
-          updateRequired = true;
+          renderJob.request();
         },
         [this]() {
           exitActivity();
-          updateRequired = true;
+          renderJob.request();
         }));
   } else if (selectedIndex == 2) {
     // Sync Server URL - prefill with https:// if empty to save typing
@@ -126,11 +109,11 @@ void KOReaderSettingsActivity::handleSelection() {
           KOREADER_STORE.setServerUrl(urlToSave);
           KOREADER_STORE.saveToFile();
           exitActivity();
-          updateRequired = true;
+          renderJob.request();
         },
         [this]() {
           exitActivity();
-          updateRequired = true;
+          renderJob.request();
         }));
   } else if (selectedIndex == 3) {
     // Document Matching - toggle between Filename and Binary
@@ -139,34 +122,22 @@ void KOReaderSettingsActivity::handleSelection() {
         (current == DocumentMatchMethod::FILENAME) ? DocumentMatchMethod::BINARY : DocumentMatchMethod::FILENAME;
     KOREADER_STORE.setMatchMethod(newMethod);
     KOREADER_STORE.saveToFile();
-    updateRequired = true;
+    renderJob.request();
   } else if (selectedIndex == 4) {
     // Authenticate
     if (!KOREADER_STORE.hasCredentials()) {
       // Can't authenticate without credentials - just show message briefly
-      xSemaphoreGive(renderingMutex);
+      RENDER_SCHEDULER.unlock();
       return;
     }
     exitActivity();
     enterNewActivity(new KOReaderAuthActivity(renderer, mappedInput, [this] {
       exitActivity();
-      updateRequired = true;
+      renderJob.request();
     }));
   }
 
-  xSemaphoreGive(renderingMutex);
-}
-
-void KOReaderSettingsActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired && !subActivity) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
+  RENDER_SCHEDULER.unlock();
 }
 
 void KOReaderSettingsActivity::render() {
@@ -1,6 +1,7 @@
 #include "OtaUpdateActivity.h"
 
 #include <GfxRenderer.h>
+#include <Logging.h>
 #include <WiFi.h>
 
 #include "MappedInputManager.h"
@@ -8,70 +9,58 @@
 #include "fontIds.h"
 #include "network/OtaUpdater.h"
 
-void OtaUpdateActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<OtaUpdateActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void OtaUpdateActivity::onWifiSelectionComplete(const bool success) {
   exitActivity();
 
   if (!success) {
-    Serial.printf("[%lu] [OTA] WiFi connection failed, exiting\n", millis());
+    LOG_ERR("OTA", "WiFi connection failed, exiting\n");
     goBack();
     return;
   }
 
-  Serial.printf("[%lu] [OTA] WiFi connected, checking for update\n", millis());
+  LOG_INF("OTA", "WiFi connected, checking for update\n");
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  RENDER_SCHEDULER.lock();
   state = CHECKING_FOR_UPDATE;
-  xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  RENDER_SCHEDULER.unlock();
+  renderJob.request();
   vTaskDelay(10 / portTICK_PERIOD_MS);
   const auto res = updater.checkForUpdate();
   if (res != OtaUpdater::OK) {
-    Serial.printf("[%lu] [OTA] Update check failed: %d\n", millis(), res);
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    LOG_ERR("OTA", "Update check failed: %d\n", res);
+    RENDER_SCHEDULER.lock();
     state = FAILED;
-    xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    RENDER_SCHEDULER.unlock();
+    renderJob.request();
     return;
   }
 
   if (!updater.isUpdateNewer()) {
-    Serial.printf("[%lu] [OTA] No new update available\n", millis());
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    LOG_INF("OTA", "No new update available\n");
+    RENDER_SCHEDULER.lock();
     state = NO_UPDATE;
-    xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    RENDER_SCHEDULER.unlock();
+    renderJob.request();
     return;
   }
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  RENDER_SCHEDULER.lock();
   state = WAITING_CONFIRMATION;
-  xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  RENDER_SCHEDULER.unlock();
+  renderJob.request();
 }
 
 void OtaUpdateActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
-
-  xTaskCreate(&OtaUpdateActivity::taskTrampoline, "OtaUpdateActivityTask",
-              2048,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderJob.start();
 
   // Turn on WiFi immediately
-  Serial.printf("[%lu] [OTA] Turning on WiFi...\n", millis());
+  LOG_INF("OTA", "Turning on WiFi...\n");
   WiFi.mode(WIFI_STA);
 
   // Launch WiFi selection subactivity
-  Serial.printf("[%lu] [OTA] Launching WifiSelectionActivity...\n", millis());
+  LOG_INF("OTA", "Launching WifiSelectionActivity...\n");
   enterNewActivity(new WifiSelectionActivity(renderer, mappedInput,
                                              [this](const bool connected) { onWifiSelectionComplete(connected); }));
 }
@@ -85,26 +74,7 @@ void OtaUpdateActivity::onExit() {
   WiFi.mode(WIFI_OFF);
   delay(100);  // Allow WiFi hardware to fully power down
 
-  // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
-}
-
-void OtaUpdateActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired || updater.getRender()) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
+  renderJob.stop();
 }
 
 void OtaUpdateActivity::render() {
@@ -115,8 +85,7 @@ void OtaUpdateActivity::render() {
 
   float updaterProgress = 0;
   if (state == UPDATE_IN_PROGRESS) {
-    Serial.printf("[%lu] [OTA] Update progress: %d / %d\n", millis(), updater.getProcessedSize(),
-                  updater.getTotalSize());
+    LOG_DBG("OTA", "Update progress: %zu / %zu\n", updater.getProcessedSize(), updater.getTotalSize());
     updaterProgress = static_cast<float>(updater.getProcessedSize()) / static_cast<float>(updater.getTotalSize());
     // Only update every 2% at the most
     if (static_cast<int>(updaterProgress * 50) == lastUpdaterPercentage / 2) {
@@ -189,27 +158,28 @@ void OtaUpdateActivity::loop() {
 
   if (state == WAITING_CONFIRMATION) {
     if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
-      Serial.printf("[%lu] [OTA] New update available, starting download...\n", millis());
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      LOG_INF("OTA", "New update available, starting download...\n");
+      RENDER_SCHEDULER.lock();
       state = UPDATE_IN_PROGRESS;
-      xSemaphoreGive(renderingMutex);
-      updateRequired = true;
+      RENDER_SCHEDULER.unlock();
+      renderJob.request();
       vTaskDelay(10 / portTICK_PERIOD_MS);
-      const auto res = updater.installUpdate();
+      const auto res = updater.installUpdate(
+          [this] { renderJob.request(RenderScheduler::Priority::Background); });
 
       if (res != OtaUpdater::OK) {
-        Serial.printf("[%lu] [OTA] Update failed: %d\n", millis(), res);
-        xSemaphoreTake(renderingMutex, portMAX_DELAY);
+        LOG_ERR("OTA", "Update failed: %d\n", res);
+        RENDER_SCHEDULER.lock();
         state = FAILED;
-        xSemaphoreGive(renderingMutex);
-        updateRequired = true;
+        RENDER_SCHEDULER.unlock();
+        renderJob.request();
         return;
       }
 
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      RENDER_SCHEDULER.lock();
       state = FINISHED;
-      xSemaphoreGive(renderingMutex);
-      updateRequired = true;
+      RENDER_SCHEDULER.unlock();
+      renderJob.request();
     }
 
     if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
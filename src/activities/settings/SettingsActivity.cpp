@@ -64,11 +64,14 @@ const SettingInfo controlsSettings[controlsSettingsCount] = {
     SettingInfo::Enum("Nhấn nút nguồn", &CrossPointSettings::shortPwrBtn,
                       {"Bỏ qua", "Ngủ", "Chuyển trang"})};
 
-constexpr int systemSettingsCount = 5;
+constexpr int systemSettingsCount = 7;
 const SettingInfo systemSettings[systemSettingsCount] = {
     SettingInfo::Enum("Thời gian chờ", &CrossPointSettings::sleepTimeout,
                       {"1 phút", "5 phút", "10 phút", "15 phút", "30 phút"}),
     SettingInfo::Action("Đồng bộ KOReader"), SettingInfo::Action("Duyệt OPDS"),
+    SettingInfo::Enum("Giới hạn bộ đệm", &CrossPointSettings::cacheBudget,
+                      {"100 MB", "250 MB", "500 MB", "1 GB", "Không giới hạn"}),
+    SettingInfo::Action("Lập chỉ mục thư viện"),
     SettingInfo::Action("Đặt lại thiết bị"),
     SettingInfo::Action("Kiểm tra cập nhật")};
 
@@ -77,46 +80,28 @@ const SettingInfo connectivitySettings[connectivitySettingsCount] = {
     SettingInfo::Action("Kết nối WiFi"),
     SettingInfo::Action("Vị trí thời tiết")};
 
-constexpr int advancedSettingsCount = 1;
+constexpr int advancedSettingsCount = 2;
 const SettingInfo advancedSettings[advancedSettingsCount] = {
-    SettingInfo::Toggle("Tải hình ảnh", &CrossPointSettings::loadImages)};
+    SettingInfo::Toggle("Tải hình ảnh", &CrossPointSettings::loadImages),
+    SettingInfo::Action("Chẩn đoán bộ nhớ")};
 } // namespace
 
-void SettingsActivity::taskTrampoline(void *param) {
-  auto *self = static_cast<SettingsActivity *>(param);
-  self->displayTaskLoop();
-}
-
 void SettingsActivity::onEnter() {
   Activity::onEnter();
-  renderingMutex = xSemaphoreCreateMutex();
-
   // Reset selection to first category
   selectedCategoryIndex = 0;
+  fullRedrawRequired = true;
 
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&SettingsActivity::taskTrampoline, "SettingsActivityTask",
-              4096,              // Stack size
-              this,              // Parameters
-              1,                 // Priority
-              &displayTaskHandle // Task handle
-  );
+  renderJob.request();
+
+  renderJob.start();
 }
 
 void SettingsActivity::onExit() {
   ActivityWithSubactivity::onExit();
 
-  // Wait until not rendering to delete task to avoid killing mid-instruction to
-  // EPD
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderJob.stop();
 }
 
 void SettingsActivity::loop() {
@@ -144,14 +129,14 @@ void SettingsActivity::loop() {
     selectedCategoryIndex = (selectedCategoryIndex > 0)
                                 ? (selectedCategoryIndex - 1)
                                 : (categoryCount - 1);
-    updateRequired = true;
+    renderJob.request();
   } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
              mappedInput.wasPressed(MappedInputManager::Button::Right)) {
     // Move selection down (with wrap around)
     selectedCategoryIndex = (selectedCategoryIndex < categoryCount - 1)
                                 ? (selectedCategoryIndex + 1)
                                 : 0;
-    updateRequired = true;
+    renderJob.request();
   }
 }
 
@@ -160,7 +145,7 @@ void SettingsActivity::enterCategory(int categoryIndex) {
     return;
   }
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  RENDER_SCHEDULER.lock();
   exitActivity();
 
   const SettingInfo *settingsList = nullptr;
@@ -196,25 +181,27 @@ void SettingsActivity::enterCategory(int categoryIndex) {
   enterNewActivity(new CategorySettingsActivity(
       renderer, mappedInput, categoryNames[categoryIndex], settingsList,
       settingsCount, [this] {
+        // The category screen covered the whole list
+        fullRedrawRequired = true;
         exitActivity();
-        updateRequired = true;
+        renderJob.request();
       }));
-  xSemaphoreGive(renderingMutex);
+  RENDER_SCHEDULER.unlock();
 }
 
-void SettingsActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired && !subActivity) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
+void SettingsActivity::render() const {
+  if (!fullRedrawRequired) {
+    // Only the previously and the newly selected rows change, present()
+    // refreshes the window around them
+    if (selectedCategoryIndex != lastRenderedCategoryIndex) {
+      renderCategoryRow(lastRenderedCategoryIndex);
+      renderCategoryRow(selectedCategoryIndex);
+      lastRenderedCategoryIndex = selectedCategoryIndex;
     }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    renderer.present();
+    return;
   }
-}
 
-void SettingsActivity::render() const {
   renderer.clearScreen();
 
   const auto pageWidth = renderer.getScreenWidth();
@@ -253,6 +240,17 @@ void SettingsActivity::render() const {
   renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3,
                            labels.btn4);
 
+  fullRedrawRequired = false;
+  lastRenderedCategoryIndex = selectedCategoryIndex;
   // Always use standard refresh for settings screen
-  renderer.displayBuffer();
+  renderer.present();
+}
+
+void SettingsActivity::renderCategoryRow(const int index) const {
+  const int categoryY = 60 + index * 30;
+  const bool selected = index == selectedCategoryIndex;
+  renderer.fillRect(0, categoryY - 2, renderer.getScreenWidth() - 1, 30,
+                    selected);
+  renderer.drawText(UI_10_FONT_ID, 20, categoryY, categoryNames[index],
+                    !selected);
 }
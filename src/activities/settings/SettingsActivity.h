@@ -1,30 +1,27 @@
 #pragma once
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
 
 #include <functional>
 #include <string>
 #include <vector>
 
+#include "RenderScheduler.h"
 #include "activities/ActivityWithSubactivity.h"
 
 class CrossPointSettings;
 struct SettingInfo;
 
 class SettingsActivity final : public ActivityWithSubactivity {
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  RenderJob renderJob{[this] { render(); }, [this] { return !subActivity; }};
   int selectedCategoryIndex = 0; // Currently selected category
+  mutable int lastRenderedCategoryIndex = -1;
+  mutable bool fullRedrawRequired = true;
   const std::function<void()> onGoHome;
 
   static constexpr int categoryCount = 6;
   static const char *categoryNames[categoryCount];
 
-  static void taskTrampoline(void *param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
+  void renderCategoryRow(int index) const;
   void enterCategory(int categoryIndex);
 
 public:
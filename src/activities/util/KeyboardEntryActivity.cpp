@@ -13,50 +13,19 @@ const char* const KeyboardEntryActivity::keyboard[NUM_ROWS] = {
 const char* const KeyboardEntryActivity::keyboardShift[NUM_ROWS] = {"~!@#$%^&*()_+", "QWERTYUIOP{}|", "ASDFGHJKL:\"",
                                                                     "ZXCVBNM<>?", "SPECIAL ROW"};
 
-void KeyboardEntryActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<KeyboardEntryActivity*>(param);
-  self->displayTaskLoop();
-}
-
-void KeyboardEntryActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void KeyboardEntryActivity::onEnter() {
   Activity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
-
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&KeyboardEntryActivity::taskTrampoline, "KeyboardEntryActivity",
-              2048,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderJob.request();
+
+  renderJob.start();
 }
 
 void KeyboardEntryActivity::onExit() {
   Activity::onExit();
 
-  // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderJob.stop();
 }
 
 int KeyboardEntryActivity::getRowLength(const int row) const {
@@ -151,7 +120,7 @@ void KeyboardEntryActivity::loop() {
       const int maxCol = getRowLength(selectedRow) - 1;
       if (selectedCol > maxCol) selectedCol = maxCol;
     }
-    updateRequired = true;
+    renderJob.request();
   }
 
   if (mappedInput.wasPressed(MappedInputManager::Button::Down)) {
@@ -165,7 +134,7 @@ void KeyboardEntryActivity::loop() {
       const int maxCol = getRowLength(selectedRow) - 1;
       if (selectedCol > maxCol) selectedCol = maxCol;
     }
-    updateRequired = true;
+    renderJob.request();
   }
 
   if (mappedInput.wasPressed(MappedInputManager::Button::Left)) {
@@ -187,7 +156,7 @@ void KeyboardEntryActivity::loop() {
         // At done button, move to backspace
         selectedCol = BACKSPACE_COL;
       }
-      updateRequired = true;
+      renderJob.request();
       return;
     }
 
@@ -197,7 +166,7 @@ void KeyboardEntryActivity::loop() {
       // Wrap to end of current row
       selectedCol = maxCol;
     }
-    updateRequired = true;
+    renderJob.request();
   }
 
   if (mappedInput.wasPressed(MappedInputManager::Button::Right)) {
@@ -219,7 +188,7 @@ void KeyboardEntryActivity::loop() {
         // At done button, wrap to beginning of row
         selectedCol = SHIFT_COL;
       }
-      updateRequired = true;
+      renderJob.request();
       return;
     }
 
@@ -229,13 +198,13 @@ void KeyboardEntryActivity::loop() {
       // Wrap to beginning of current row
       selectedCol = 0;
     }
-    updateRequired = true;
+    renderJob.request();
   }
 
   // Selection
   if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
     handleKeyPress();
-    updateRequired = true;
+    renderJob.request();
   }
 
   // Cancel
@@ -243,7 +212,7 @@ void KeyboardEntryActivity::loop() {
     if (onCancel) {
       onCancel();
     }
-    updateRequired = true;
+    renderJob.request();
   }
 }
 
@@ -1,14 +1,12 @@
 #pragma once
 #include <GfxRenderer.h>
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
 
 #include <functional>
 #include <string>
 #include <utility>
 
 #include "../Activity.h"
+#include "RenderScheduler.h"
 
 /**
  * Reusable keyboard entry activity for text input.
@@ -45,8 +43,8 @@ class KeyboardEntryActivity : public Activity {
                                  OnCompleteCallback onComplete = nullptr, OnCancelCallback onCancel = nullptr)
       : Activity("KeyboardEntry", renderer, mappedInput),
         title(std::move(title)),
-        text(std::move(initialText)),
         startY(startY),
+        text(std::move(initialText)),
         maxLength(maxLength),
         isPassword(isPassword),
         onComplete(std::move(onComplete)),
@@ -63,9 +61,7 @@ class KeyboardEntryActivity : public Activity {
   std::string text;
   size_t maxLength;
   bool isPassword;
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  RenderJob renderJob{[this] { render(); }};
 
   // Keyboard state
   int selectedRow = 0;
@@ -89,8 +85,6 @@ class KeyboardEntryActivity : public Activity {
   static constexpr int BACKSPACE_COL = 7;
   static constexpr int DONE_COL = 9;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   char getSelectedChar() const;
   void handleKeyPress();
   int getRowLength(int row) const;
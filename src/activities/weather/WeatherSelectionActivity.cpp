@@ -4,7 +4,7 @@
 #include "../../fontIds.h"
 #include "../../services/WeatherService.h"
 #include <GfxRenderer.h>
-#include <HardwareSerial.h>
+#include <Logging.h>
 
 void WeatherSelectionActivity::onEnter() {
   Activity::onEnter();
@@ -23,8 +23,8 @@ void WeatherSelectionActivity::onEnter() {
   if (scrollOffset < 0)
     scrollOffset = 0;
 
-  Serial.printf("[Weather] Selection activity entered, current: %s\n",
-                WeatherService::getCityName(selectedIndex));
+  LOG_INF("Weather", "Selection activity entered, current: %s\n",
+          WeatherService::getCityName(selectedIndex));
 
   render();
 }
@@ -60,8 +60,8 @@ void WeatherSelectionActivity::loop() {
     SETTINGS.weatherCityIndex = selectedIndex;
     SETTINGS.saveToFile();
 
-    Serial.printf("[Weather] Selected: %s (index %d)\n",
-                  WeatherService::getCityName(selectedIndex), selectedIndex);
+    LOG_INF("Weather", "Selected: %s (index %d)\n",
+            WeatherService::getCityName(selectedIndex), selectedIndex);
 
     // Trigger weather refresh
     WeatherService::getInstance().refresh();
@@ -1,20 +1,27 @@
 #include <Arduino.h>
 #include <EInkDisplay.h>
+#include <EpdFontPack.h>
 #include <Epub.h>
 #include <GfxRenderer.h>
 #include <InputManager.h>
+#include <Logging.h>
 #include <SDCardManager.h>
 #include <SPI.h>
+#include <Trace.h>
 #include <builtinFonts/all.h>
 
 #include <cstring>
 
 #include "Battery.h"
+#include "BookCacheManager.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "KOReaderCredentialStore.h"
+#include "LibraryCatalog.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
+#include "RenderScheduler.h"
+#include "ResumeSnapshot.h"
 #include "activities/boot_sleep/BootActivity.h"
 #include "activities/boot_sleep/SleepActivity.h"
 #include "activities/browser/OpdsBookBrowserActivity.h"
@@ -28,6 +35,7 @@
 #include "activities/util/KeyboardEntryActivity.h"
 #include "activities/weather/WeatherSelectionActivity.h"
 #include "fontIds.h"
+#include "services/BookIngestService.h"
 #include "services/WeatherService.h"
 #include "services/WifiService.h"
 
@@ -44,6 +52,10 @@
 
 #define SD_SPI_MISO 7
 
+// Book cache maintenance: idle time before it starts, time spent before sleep
+constexpr unsigned long IDLE_MAINTENANCE_DELAY_MS = 5000;
+constexpr unsigned long SLEEP_MAINTENANCE_MS = 1500;
+
 EInkDisplay einkDisplay(EPD_SCLK, EPD_MOSI, EPD_CS, EPD_DC, EPD_RST, EPD_BUSY);
 InputManager inputManager;
 MappedInputManager mappedInputManager(inputManager);
@@ -238,13 +250,17 @@ void waitForPowerRelease() {
 
 // Enter deep sleep mode
 void enterDeepSleep() {
+  if (currentActivity) {
+    currentActivity->onSleep();
+  }
   exitActivity();
   enterNewActivity(new SleepActivity(renderer, mappedInputManager));
 
   einkDisplay.deepSleep();
-  Serial.printf("[%lu] [   ] Power button press calibration value: %lu ms\n",
-                millis(), t2 - t1);
-  Serial.printf("[%lu] [   ] Entering deep sleep.\n", millis());
+  // The sleep screen is up, spend a moment keeping the book cache within budget
+  BOOK_CACHE.runFor(SLEEP_MAINTENANCE_MS);
+  LOG_INF("   ", "Power button press calibration value: %lu ms\n", t2 - t1);
+  LOG_INF("   ", "Entering deep sleep.\n");
   esp_deep_sleep_enable_gpio_wakeup(1ULL << InputManager::POWER_BUTTON_PIN,
                                     ESP_GPIO_WAKEUP_GPIO_LOW);
   // Ensure that the power button has been released to avoid immediately turning
@@ -342,11 +358,70 @@ void onGoHome() {
       onGoToBrowser, onGoToWifiSettings, onGoToWeatherSettings));
 }
 
+#ifdef OMIT_FONTS
+// The reader fonts left out of flash are paged in from font packs in /fonts on
+// the SD card (lib/EpdFont/scripts/convert-font-packs.sh). A font without all
+// four packs falls back to the built-in Bookerly 14.
+struct SdReaderFont {
+  int fontId;
+  const char *name;
+};
+
+const SdReaderFont SD_READER_FONTS[] = {
+    {BOOKERLY_12_FONT_ID, "bookerly_12"},
+    {BOOKERLY_16_FONT_ID, "bookerly_16"},
+    {BOOKERLY_18_FONT_ID, "bookerly_18"},
+    {NOTOSANS_12_FONT_ID, "notosans_12"},
+    {NOTOSANS_14_FONT_ID, "notosans_14"},
+    {NOTOSANS_16_FONT_ID, "notosans_16"},
+    {NOTOSANS_18_FONT_ID, "notosans_18"},
+    {OPENDYSLEXIC_8_FONT_ID, "opendyslexic_8"},
+    {OPENDYSLEXIC_10_FONT_ID, "opendyslexic_10"},
+    {OPENDYSLEXIC_12_FONT_ID, "opendyslexic_12"},
+    {OPENDYSLEXIC_14_FONT_ID, "opendyslexic_14"},
+};
+
+// In EpdFontFamily order
+const char *const SD_READER_FONT_STYLES[] = {"regular", "bold", "italic",
+                                             "bolditalic"};
+
+void insertSdReaderFonts() {
+  for (const auto &font : SD_READER_FONTS) {
+    // Only headers are read here, glyph metrics load when the font is used.
+    // Packs live as long as the renderer.
+    EpdFontPack *packs[4] = {};
+    bool complete = true;
+    for (int i = 0; i < 4 && complete; i++) {
+      packs[i] = new EpdFontPack(std::string("/fonts/") + font.name + "_" +
+                                 SD_READER_FONT_STYLES[i] + ".epf");
+      complete = packs[i]->begin();
+    }
+
+    if (!complete) {
+      for (const auto *pack : packs) {
+        delete pack;
+      }
+      LOG_WRN("   ", "Font packs for %s missing, using Bookerly 14\n",
+              font.name);
+      renderer.insertFont(font.fontId, bookerly14FontFamily);
+      continue;
+    }
+    renderer.insertFont(
+        font.fontId,
+        EpdFontFamily(new EpdFont(packs[0]), new EpdFont(packs[1]),
+                      new EpdFont(packs[2]), new EpdFont(packs[3])));
+  }
+}
+#endif // OMIT_FONTS
+
 void setupDisplayAndFonts() {
   einkDisplay.begin();
-  Serial.printf("[%lu] [   ] Display initialized\n", millis());
+  LOG_INF("   ", "Display initialized\n");
+  RENDER_SCHEDULER.begin();
   renderer.insertFont(BOOKERLY_14_FONT_ID, bookerly14FontFamily);
-#ifndef OMIT_FONTS
+#ifdef OMIT_FONTS
+  insertSdReaderFonts();
+#else
   renderer.insertFont(BOOKERLY_12_FONT_ID, bookerly12FontFamily);
   renderer.insertFont(BOOKERLY_16_FONT_ID, bookerly16FontFamily);
   renderer.insertFont(BOOKERLY_18_FONT_ID, bookerly18FontFamily);
@@ -363,7 +438,7 @@ void setupDisplayAndFonts() {
   renderer.insertFont(UI_10_FONT_ID, ui10FontFamily);
   renderer.insertFont(UI_12_FONT_ID, ui12FontFamily);
   renderer.insertFont(SMALL_FONT_ID, smallFontFamily);
-  Serial.printf("[%lu] [   ] Fonts setup\n", millis());
+  LOG_INF("   ", "Fonts setup\n");
 }
 
 bool isUsbConnected() {
@@ -371,6 +446,18 @@ bool isUsbConnected() {
   return digitalRead(UART0_RXD) == HIGH;
 }
 
+// Only start serial (and log) while USB is connected, it can be plugged in or
+// out at any time
+void updateLogSink() {
+  static bool serialStarted = false;
+  const bool usbConnected = isUsbConnected();
+  if (usbConnected && !serialStarted) {
+    Serial.begin(115200);
+    serialStarted = true;
+  }
+  logging::setSinkEnabled(usbConnected);
+}
+
 bool isWakeupByPowerButton() {
   const auto wakeupCause = esp_sleep_get_wakeup_cause();
   const auto resetReason = esp_reset_reason();
@@ -385,10 +472,9 @@ bool isWakeupByPowerButton() {
 void setup() {
   t1 = millis();
 
-  // Only start serial if USB connected
   pinMode(UART0_RXD, INPUT);
-  if (isUsbConnected()) {
-    Serial.begin(115200);
+  updateLogSink();
+  if (logging::isSinkEnabled()) {
     // Wait up to 3 seconds for Serial to be ready to catch early logs
     unsigned long start = millis();
     while (!Serial && (millis() - start) < 3000) {
@@ -406,7 +492,7 @@ void setup() {
   // SD Card Initialization
   // We need 6 open files concurrently when parsing a new chapter
   if (!SdMan.begin()) {
-    Serial.printf("[%lu] [   ] SD card initialization failed\n", millis());
+    LOG_ERR("   ", "SD card initialization failed\n");
     setupDisplayAndFonts();
     exitActivity();
     enterNewActivity(new FullScreenMessageActivity(
@@ -419,24 +505,29 @@ void setup() {
 
   if (isWakeupByPowerButton()) {
     // For normal wakeups, verify power button press duration
-    Serial.printf("[%lu] [   ] Verifying power button press duration\n",
-                  millis());
+    LOG_INF("   ", "Verifying power button press duration\n");
     verifyPowerButtonDuration();
   }
 
   // First serial output only here to avoid timing inconsistencies for power
   // button press duration verification
-  Serial.printf("[%lu] [   ] Starting CrossPoint version " CROSSPOINT_VERSION
-                "\n",
-                millis());
+  LOG_INF("   ", "Starting CrossPoint version " CROSSPOINT_VERSION "\n");
 
   setupDisplayAndFonts();
 
-  exitActivity();
-  enterNewActivity(new BootActivity(renderer, mappedInputManager));
-
+  // A reader page saved at sleep goes straight back on the panel instead of
+  // the boot screen, the reader then opens the book behind it
   APP_STATE.loadFromFile();
+  if (APP_STATE.openEpubPath.empty() ||
+      !RESUME_SNAPSHOT.restore(renderer, APP_STATE.openEpubPath)) {
+    exitActivity();
+    enterNewActivity(new BootActivity(renderer, mappedInputManager));
+  }
+
   RECENT_BOOKS.loadFromFile();
+  LIBRARY_CATALOG.loadFromFile();
+  BOOK_INGEST.loadFromFile();
+  BOOK_CACHE.loadFromFile();
 
   // Initialize WiFi service (but don't auto-connect to prevent boot hang)
   WifiService::getInstance().begin();
@@ -464,14 +555,33 @@ void loop() {
   static unsigned long lastMemPrint = 0;
 
   inputManager.update();
+  updateLogSink();
 
   if (Serial && millis() - lastMemPrint >= 10000) {
-    Serial.printf(
-        "[%lu] [MEM] Free: %d bytes, Total: %d bytes, Min Free: %d bytes\n",
-        millis(), ESP.getFreeHeap(), ESP.getHeapSize(), ESP.getMinFreeHeap());
+    LOG_INF("MEM", "Free: %d bytes, Total: %d bytes, Min Free: %d bytes\n",
+            ESP.getFreeHeap(), ESP.getHeapSize(), ESP.getMinFreeHeap());
     lastMemPrint = millis();
   }
 
+#if CROSSPOINT_TRACE
+  // Trace buffer over the serial console: d dumps, f writes to SD, c clears
+  if (Serial && Serial.available() > 0) {
+    switch (Serial.read()) {
+    case 'd':
+      trace::dumpToSerial();
+      break;
+    case 'f':
+      trace::flushToFile();
+      break;
+    case 'c':
+      trace::clear();
+      break;
+    default:
+      break;
+    }
+  }
+#endif
+
   // Check for any user activity (button press or release) or active background
   // work
   static unsigned long lastActivityTime = millis();
@@ -482,9 +592,8 @@ void loop() {
 
   const unsigned long sleepTimeoutMs = SETTINGS.getSleepTimeoutMs();
   if (millis() - lastActivityTime >= sleepTimeoutMs) {
-    Serial.printf(
-        "[%lu] [SLP] Auto-sleep triggered after %lu ms of inactivity\n",
-        millis(), sleepTimeoutMs);
+    LOG_INF("SLP", "Auto-sleep triggered after %lu ms of inactivity\n",
+            sleepTimeoutMs);
     enterDeepSleep();
     // This should never be hit as `enterDeepSleep` calls esp_deep_sleep_start
     return;
@@ -503,13 +612,19 @@ void loop() {
   }
   const unsigned long activityDuration = millis() - activityStartTime;
 
+  // Incremental cache maintenance once the user has left the device alone for
+  // a bit, one bounded step per loop
+  if (currentActivity && currentActivity->allowIdleMaintenance() &&
+      millis() - lastActivityTime >= IDLE_MAINTENANCE_DELAY_MS) {
+    BOOK_CACHE.step();
+  }
+
   const unsigned long loopDuration = millis() - loopStartTime;
   if (loopDuration > maxLoopDuration) {
     maxLoopDuration = loopDuration;
     if (maxLoopDuration > 50) {
-      Serial.printf(
-          "[%lu] [LOOP] New max loop duration: %lu ms (activity: %lu ms)\n",
-          millis(), maxLoopDuration, activityDuration);
+      LOG_INF("LOOP", "New max loop duration: %lu ms (activity: %lu ms)\n",
+              maxLoopDuration, activityDuration);
     }
   }
 
@@ -1,16 +1,22 @@
 #include "CrossPointWebServer.h"
 
 #include <ArduinoJson.h>
-#include <Epub.h>
+#include <BookCacheKey.h>
+#include <EpdFontPack.h>
 #include <FsHelpers.h>
+#include <HeapStats.h>
+#include <Logging.h>
 #include <SDCardManager.h>
+#include <Trace.h>
 #include <WiFi.h>
 #include <esp_task_wdt.h>
 
 #include <algorithm>
 
+#include "LibraryCatalog.h"
 #include "html/FilesPageHtml.generated.h"
 #include "html/HomePageHtml.generated.h"
+#include "services/BookIngestService.h"
 #include "util/StringUtils.h"
 
 namespace {
@@ -36,13 +42,16 @@ String wsLastCompleteName;
 size_t wsLastCompleteSize = 0;
 unsigned long wsLastCompleteAt = 0;
 
-// Helper function to clear epub cache after upload
-void clearEpubCacheIfNeeded(const String& filePath) {
-  // Only clear cache for .epub files
-  if (StringUtils::checkFileExtension(filePath, ".epub")) {
-    Epub(filePath.c_str(), "/.crosspoint").clearCache();
-    Serial.printf("[%lu] [WEB] Cleared epub cache for: %s\n", millis(), filePath.c_str());
-  }
+// Helper function to run all post-upload bookkeeping for a completed file
+void onUploadComplete(const String& filePath) {
+  // The content may have changed under the same path, so its cache key must be
+  // recomputed. Caches are keyed by content, an overwritten book simply gets
+  // a fresh one and the cache budget reclaims the old one.
+  BookCacheKey::forget(filePath.c_str());
+  // Keep the Books grid catalog in sync without a rescan
+  LIBRARY_CATALOG.updateBook(filePath.c_str());
+  // Build metadata, covers and the first section once uploads settle
+  BOOK_INGEST.enqueue(filePath.c_str());
 }
 }  // namespace
 
@@ -56,7 +65,7 @@ CrossPointWebServer::~CrossPointWebServer() { stop(); }
 
 void CrossPointWebServer::begin() {
   if (running) {
-    Serial.printf("[%lu] [WEB] Web server already running\n", millis());
+    LOG_INF("WEB", "Web server already running\n");
     return;
   }
 
@@ -66,18 +75,17 @@ void CrossPointWebServer::begin() {
   const bool isInApMode = (wifiMode & WIFI_MODE_AP) && (WiFi.softAPgetStationNum() >= 0);  // AP is running
 
   if (!isStaConnected && !isInApMode) {
-    Serial.printf("[%lu] [WEB] Cannot start webserver - no valid network (mode=%d, status=%d)\n", millis(), wifiMode,
-                  WiFi.status());
+    LOG_ERR("WEB", "Cannot start webserver - no valid network (mode=%d, status=%d)\n", wifiMode, WiFi.status());
     return;
   }
 
   // Store AP mode flag for later use (e.g., in handleStatus)
   apMode = isInApMode;
 
-  Serial.printf("[%lu] [WEB] [MEM] Free heap before begin: %d bytes\n", millis(), ESP.getFreeHeap());
-  Serial.printf("[%lu] [WEB] Network mode: %s\n", millis(), apMode ? "AP" : "STA");
+  LOG_DBG("WEB", "[MEM] Free heap before begin: %d bytes\n", ESP.getFreeHeap());
+  LOG_INF("WEB", "Network mode: %s\n", apMode ? "AP" : "STA");
 
-  Serial.printf("[%lu] [WEB] Creating web server on port %d...\n", millis(), port);
+  LOG_INF("WEB", "Creating web server on port %d...\n", port);
   server.reset(new WebServer(port));
 
   // Disable WiFi sleep to improve responsiveness and prevent 'unreachable' errors.
@@ -87,19 +95,21 @@ void CrossPointWebServer::begin() {
   // Note: WebServer class doesn't have setNoDelay() in the standard ESP32 library.
   // We rely on disabling WiFi sleep for responsiveness.
 
-  Serial.printf("[%lu] [WEB] [MEM] Free heap after WebServer allocation: %d bytes\n", millis(), ESP.getFreeHeap());
+  LOG_DBG("WEB", "[MEM] Free heap after WebServer allocation: %d bytes\n", ESP.getFreeHeap());
 
   if (!server) {
-    Serial.printf("[%lu] [WEB] Failed to create WebServer!\n", millis());
+    LOG_ERR("WEB", "Failed to create WebServer!\n");
     return;
   }
 
   // Setup routes
-  Serial.printf("[%lu] [WEB] Setting up routes...\n", millis());
+  LOG_DBG("WEB", "Setting up routes...\n");
   server->on("/", HTTP_GET, [this] { handleRoot(); });
   server->on("/files", HTTP_GET, [this] { handleFileList(); });
 
   server->on("/api/status", HTTP_GET, [this] { handleStatus(); });
+  server->on("/api/trace", HTTP_GET, [this] { handleTrace(); });
+  server->on("/api/heap", HTTP_GET, [this] { handleHeap(); });
   server->on("/api/files", HTTP_GET, [this] { handleFileListData(); });
   server->on("/download", HTTP_GET, [this] { handleDownload(); });
 
@@ -113,43 +123,41 @@ void CrossPointWebServer::begin() {
   server->on("/delete", HTTP_POST, [this] { handleDelete(); });
 
   server->onNotFound([this] { handleNotFound(); });
-  Serial.printf("[%lu] [WEB] [MEM] Free heap after route setup: %d bytes\n", millis(), ESP.getFreeHeap());
+  LOG_DBG("WEB", "[MEM] Free heap after route setup: %d bytes\n", ESP.getFreeHeap());
 
   server->begin();
 
   // Start WebSocket server for fast binary uploads
-  Serial.printf("[%lu] [WEB] Starting WebSocket server on port %d...\n", millis(), wsPort);
+  LOG_INF("WEB", "Starting WebSocket server on port %d...\n", wsPort);
   wsServer.reset(new WebSocketsServer(wsPort));
   wsInstance = const_cast<CrossPointWebServer*>(this);
   wsServer->begin();
   wsServer->onEvent(wsEventCallback);
-  Serial.printf("[%lu] [WEB] WebSocket server started\n", millis());
+  LOG_INF("WEB", "WebSocket server started\n");
 
   udpActive = udp.begin(LOCAL_UDP_PORT);
-  Serial.printf("[%lu] [WEB] Discovery UDP %s on port %d\n", millis(), udpActive ? "enabled" : "failed",
-                LOCAL_UDP_PORT);
+  LOG_INF("WEB", "Discovery UDP %s on port %d\n", udpActive ? "enabled" : "failed", LOCAL_UDP_PORT);
 
   running = true;
 
-  Serial.printf("[%lu] [WEB] Web server started on port %d\n", millis(), port);
+  LOG_INF("WEB", "Web server started on port %d\n", port);
   // Show the correct IP based on network mode
   const String ipAddr = apMode ? WiFi.softAPIP().toString() : WiFi.localIP().toString();
-  Serial.printf("[%lu] [WEB] Access at http://%s/\n", millis(), ipAddr.c_str());
-  Serial.printf("[%lu] [WEB] WebSocket at ws://%s:%d/\n", millis(), ipAddr.c_str(), wsPort);
-  Serial.printf("[%lu] [WEB] [MEM] Free heap after server.begin(): %d bytes\n", millis(), ESP.getFreeHeap());
+  LOG_INF("WEB", "Access at http://%s/\n", ipAddr.c_str());
+  LOG_INF("WEB", "WebSocket at ws://%s:%d/\n", ipAddr.c_str(), wsPort);
+  LOG_DBG("WEB", "[MEM] Free heap after server.begin(): %d bytes\n", ESP.getFreeHeap());
 }
 
 void CrossPointWebServer::stop() {
   if (!running || !server) {
-    Serial.printf("[%lu] [WEB] stop() called but already stopped (running=%d, server=%p)\n", millis(), running,
-                  server.get());
+    LOG_INF("WEB", "stop() called but already stopped (running=%d, server=%p)\n", running, server.get());
     return;
   }
 
-  Serial.printf("[%lu] [WEB] STOP INITIATED - setting running=false first\n", millis());
+  LOG_INF("WEB", "STOP INITIATED - setting running=false first\n");
   running = false;  // Set this FIRST to prevent handleClient from using server
 
-  Serial.printf("[%lu] [WEB] [MEM] Free heap before stop: %d bytes\n", millis(), ESP.getFreeHeap());
+  LOG_DBG("WEB", "[MEM] Free heap before stop: %d bytes\n", ESP.getFreeHeap());
 
   // Close any in-progress WebSocket upload
   if (wsUploadInProgress && wsUploadFile) {
@@ -159,11 +167,11 @@ void CrossPointWebServer::stop() {
 
   // Stop WebSocket server
   if (wsServer) {
-    Serial.printf("[%lu] [WEB] Stopping WebSocket server...\n", millis());
+    LOG_DBG("WEB", "Stopping WebSocket server...\n");
     wsServer->close();
     wsServer.reset();
     wsInstance = nullptr;
-    Serial.printf("[%lu] [WEB] WebSocket server stopped\n", millis());
+    LOG_DBG("WEB", "WebSocket server stopped\n");
   }
 
   if (udpActive) {
@@ -175,18 +183,18 @@ void CrossPointWebServer::stop() {
   delay(20);
 
   server->stop();
-  Serial.printf("[%lu] [WEB] [MEM] Free heap after server->stop(): %d bytes\n", millis(), ESP.getFreeHeap());
+  LOG_DBG("WEB", "[MEM] Free heap after server->stop(): %d bytes\n", ESP.getFreeHeap());
 
   // Brief delay before deletion
   delay(10);
 
   server.reset();
-  Serial.printf("[%lu] [WEB] Web server stopped and deleted\n", millis());
-  Serial.printf("[%lu] [WEB] [MEM] Free heap after delete server: %d bytes\n", millis(), ESP.getFreeHeap());
+  LOG_INF("WEB", "Web server stopped and deleted\n");
+  LOG_DBG("WEB", "[MEM] Free heap after delete server: %d bytes\n", ESP.getFreeHeap());
 
   // Note: Static upload variables (uploadFileName, uploadPath, uploadError) are declared
   // later in the file and will be cleared when they go out of scope or on next upload
-  Serial.printf("[%lu] [WEB] [MEM] Free heap final: %d bytes\n", millis(), ESP.getFreeHeap());
+  LOG_DBG("WEB", "[MEM] Free heap final: %d bytes\n", ESP.getFreeHeap());
 }
 
 void CrossPointWebServer::handleClient() {
@@ -199,13 +207,13 @@ void CrossPointWebServer::handleClient() {
 
   // Double-check server pointer is valid
   if (!server) {
-    Serial.printf("[%lu] [WEB] WARNING: handleClient called with null server!\n", millis());
+    LOG_WRN("WEB", "WARNING: handleClient called with null server!\n");
     return;
   }
 
   // Print debug every 10 seconds to confirm handleClient is being called
   if (millis() - lastDebugPrint > 10000) {
-    Serial.printf("[%lu] [WEB] handleClient active, server running on port %d\n", millis(), port);
+    LOG_DBG("WEB", "handleClient active, server running on port %d\n", port);
     lastDebugPrint = millis();
   }
 
@@ -253,7 +261,7 @@ CrossPointWebServer::WsUploadStatus CrossPointWebServer::getWsUploadStatus() con
 
 void CrossPointWebServer::handleRoot() const {
   server->send(200, "text/html", HomePageHtml);
-  Serial.printf("[%lu] [WEB] Served root page\n", millis());
+  LOG_INF("WEB", "Served root page\n");
 }
 
 void CrossPointWebServer::handleNotFound() const {
@@ -279,20 +287,87 @@ void CrossPointWebServer::handleStatus() const {
   server->send(200, "application/json", json);
 }
 
+void CrossPointWebServer::handleHeap() const {
+  const heapstats::Sample now = heapstats::sample();
+
+  JsonDocument doc;
+  doc["uptime"] = millis() / 1000;
+  doc["freeHeap"] = now.freeHeap;
+  doc["largestBlock"] = now.largestBlock;
+  doc["minFreeHeap"] = now.minFreeHeap;
+  doc["fragmentation"] = now.getFragmentationPercent();
+  doc["evicted"] = heapstats::getEvictedCount();
+
+  JsonArray stages = doc["stages"].to<JsonArray>();
+  heapstats::StageStats stage;
+  for (size_t i = 0; heapstats::getStage(i, stage); i++) {
+    JsonObject entry = stages.add<JsonObject>();
+    entry["scope"] = stage.scope;
+    entry["stage"] = stage.stage;
+    entry["count"] = stage.count;
+    entry["lastMs"] = stage.lastMs;
+    entry["freeHeap"] = stage.last.freeHeap;
+    entry["largestBlock"] = stage.last.largestBlock;
+    entry["minFreeHeap"] = stage.last.minFreeHeap;
+    entry["fragmentation"] = stage.last.getFragmentationPercent();
+    entry["lowestFreeHeap"] = stage.lowestFree;
+    entry["lowestLargestBlock"] = stage.lowestLargestBlock;
+  }
+
+  const EpdFontPack::CacheStats glyphs = EpdFontPack::getCacheStats();
+  JsonObject glyphCache = doc["glyphCache"].to<JsonObject>();
+  glyphCache["hits"] = glyphs.hits;
+  glyphCache["misses"] = glyphs.misses;
+  glyphCache["hitRate"] = glyphs.getHitPercent();
+  glyphCache["readErrors"] = glyphs.readErrors;
+  glyphCache["metricLoads"] = glyphs.metricLoads;
+
+  String json;
+  serializeJson(doc, json);
+  server->send(200, "application/json", json);
+}
+
+void CrossPointWebServer::handleTrace() const {
+  if (!trace::isEnabled()) {
+    server->send(404, "text/plain", "Tracing is not enabled in this build");
+    return;
+  }
+
+  // Snapshot of the ring buffer as it is now, the file doubles as the on-device copy
+  if (!trace::flushToFile()) {
+    server->send(500, "text/plain", "Failed to write trace");
+    return;
+  }
+
+  FsFile file;
+  if (!SdMan.openFileForRead("WEB", trace::TRACE_FILE, file)) {
+    server->send(500, "text/plain", "Failed to open trace");
+    return;
+  }
+
+  server->setContentLength(file.size());
+  server->sendHeader("Content-Disposition", "attachment; filename=\"trace.bin\"");
+  server->send(200, "application/octet-stream", "");
+
+  WiFiClient client = server->client();
+  client.write(file);
+  file.close();
+}
+
 void CrossPointWebServer::scanFiles(const char* path, const std::function<void(FileInfo)>& callback) const {
   FsFile root = SdMan.open(path);
   if (!root) {
-    Serial.printf("[%lu] [WEB] Failed to open directory: %s\n", millis(), path);
+    LOG_ERR("WEB", "Failed to open directory: %s\n", path);
     return;
   }
 
   if (!root.isDirectory()) {
-    Serial.printf("[%lu] [WEB] Not a directory: %s\n", millis(), path);
+    LOG_INF("WEB", "Not a directory: %s\n", path);
     root.close();
     return;
   }
 
-  Serial.printf("[%lu] [WEB] Scanning files in: %s\n", millis(), path);
+  LOG_DBG("WEB", "Scanning files in: %s\n", path);
 
   FsFile file = root.openNextFile();
   char name[500];
@@ -378,7 +453,7 @@ void CrossPointWebServer::handleFileListData() const {
     const size_t written = serializeJson(doc, output, outputSize);
     if (written >= outputSize) {
       // JSON output truncated; skip this entry to avoid sending malformed JSON
-      Serial.printf("[%lu] [WEB] Skipping file entry with oversized JSON for name: %s\n", millis(), info.name.c_str());
+      LOG_WRN("WEB", "Skipping file entry with oversized JSON for name: %s\n", info.name.c_str());
       return;
     }
 
@@ -392,7 +467,7 @@ void CrossPointWebServer::handleFileListData() const {
   server->sendContent("]");
   // End of streamed response, empty chunk to signal client
   server->sendContent("");
-  Serial.printf("[%lu] [WEB] Served file listing page for path: %s\n", millis(), currentPath.c_str());
+  LOG_INF("WEB", "Served file listing page for path: %s\n", currentPath.c_str());
 }
 
 void CrossPointWebServer::handleDownload() const {
@@ -488,8 +563,7 @@ static bool flushUploadBuffer() {
     esp_task_wdt_reset();  // Reset watchdog after SD write
 
     if (written != uploadBufferPos) {
-      Serial.printf("[%lu] [WEB] [UPLOAD] Buffer flush failed: expected %d, wrote %d\n", millis(), uploadBufferPos,
-                    written);
+      LOG_ERR("WEB", "[UPLOAD] Buffer flush failed: expected %zu, wrote %zu\n", uploadBufferPos, written);
       uploadBufferPos = 0;
       return false;
     }
@@ -506,7 +580,7 @@ void CrossPointWebServer::handleUpload() const {
 
   // Safety check: ensure server is still valid
   if (!running || !server) {
-    Serial.printf("[%lu] [WEB] [UPLOAD] ERROR: handleUpload called but server not running!\n", millis());
+    LOG_ERR("WEB", "[UPLOAD] ERROR: handleUpload called but server not running!\n");
     return;
   }
 
@@ -543,8 +617,8 @@ void CrossPointWebServer::handleUpload() const {
       uploadPath = "/";
     }
 
-    Serial.printf("[%lu] [WEB] [UPLOAD] START: %s to path: %s\n", millis(), uploadFileName.c_str(), uploadPath.c_str());
-    Serial.printf("[%lu] [WEB] [UPLOAD] Free heap: %d bytes\n", millis(), ESP.getFreeHeap());
+    LOG_INF("WEB", "[UPLOAD] START: %s to path: %s\n", uploadFileName.c_str(), uploadPath.c_str());
+    LOG_DBG("WEB", "[UPLOAD] Free heap: %d bytes\n", ESP.getFreeHeap());
 
     // Create file path
     String filePath = uploadPath;
@@ -554,7 +628,7 @@ void CrossPointWebServer::handleUpload() const {
     // Check if file already exists - SD operations can be slow
     esp_task_wdt_reset();
     if (SdMan.exists(filePath.c_str())) {
-      Serial.printf("[%lu] [WEB] [UPLOAD] Overwriting existing file: %s\n", millis(), filePath.c_str());
+      LOG_INF("WEB", "[UPLOAD] Overwriting existing file: %s\n", filePath.c_str());
       esp_task_wdt_reset();
       SdMan.remove(filePath.c_str());
     }
@@ -563,12 +637,12 @@ void CrossPointWebServer::handleUpload() const {
     esp_task_wdt_reset();
     if (!SdMan.openFileForWrite("WEB", filePath, uploadFile)) {
       uploadError = "Failed to create file on SD card";
-      Serial.printf("[%lu] [WEB] [UPLOAD] FAILED to create file: %s\n", millis(), filePath.c_str());
+      LOG_ERR("WEB", "[UPLOAD] FAILED to create file: %s\n", filePath.c_str());
       return;
     }
     esp_task_wdt_reset();
 
-    Serial.printf("[%lu] [WEB] [UPLOAD] File created successfully: %s\n", millis(), filePath.c_str());
+    LOG_INF("WEB", "[UPLOAD] File created successfully: %s\n", filePath.c_str());
   } else if (upload.status == UPLOAD_FILE_WRITE) {
     if (uploadFile && uploadError.isEmpty()) {
       // Buffer incoming data and flush when buffer is full
@@ -601,8 +675,8 @@ void CrossPointWebServer::handleUpload() const {
       if (uploadSize - lastLoggedSize >= 102400) {
         const unsigned long elapsed = millis() - uploadStartTime;
         const float kbps = (elapsed > 0) ? (uploadSize / 1024.0) / (elapsed / 1000.0) : 0;
-        Serial.printf("[%lu] [WEB] [UPLOAD] %d bytes (%.1f KB), %.1f KB/s, %d writes\n", millis(), uploadSize,
-                      uploadSize / 1024.0, kbps, writeCount);
+        LOG_DBG("WEB", "[UPLOAD] %zu bytes (%.1f KB), %.1f KB/s, %zu writes\n", uploadSize, uploadSize / 1024.0, kbps,
+                writeCount);
         lastLoggedSize = uploadSize;
       }
     }
@@ -619,16 +693,15 @@ void CrossPointWebServer::handleUpload() const {
         const unsigned long elapsed = millis() - uploadStartTime;
         const float avgKbps = (elapsed > 0) ? (uploadSize / 1024.0) / (elapsed / 1000.0) : 0;
         const float writePercent = (elapsed > 0) ? (totalWriteTime * 100.0 / elapsed) : 0;
-        Serial.printf("[%lu] [WEB] [UPLOAD] Complete: %s (%d bytes in %lu ms, avg %.1f KB/s)\n", millis(),
-                      uploadFileName.c_str(), uploadSize, elapsed, avgKbps);
-        Serial.printf("[%lu] [WEB] [UPLOAD] Diagnostics: %d writes, total write time: %lu ms (%.1f%%)\n", millis(),
-                      writeCount, totalWriteTime, writePercent);
+        LOG_INF("WEB", "[UPLOAD] Complete: %s (%zu bytes in %lu ms, avg %.1f KB/s)\n", uploadFileName.c_str(),
+                uploadSize, elapsed, avgKbps);
+        LOG_INF("WEB", "[UPLOAD] Diagnostics: %zu writes, total write time: %lu ms (%.1f%%)\n", writeCount,
+                totalWriteTime, writePercent);
 
-        // Clear epub cache to prevent stale metadata issues when overwriting files
         String filePath = uploadPath;
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += uploadFileName;
-        clearEpubCacheIfNeeded(filePath);
+        onUploadComplete(filePath);
       }
     }
   } else if (upload.status == UPLOAD_FILE_ABORTED) {
@@ -642,7 +715,7 @@ void CrossPointWebServer::handleUpload() const {
       SdMan.remove(filePath.c_str());
     }
     uploadError = "Upload aborted";
-    Serial.printf("[%lu] [WEB] Upload aborted\n", millis());
+    LOG_WRN("WEB", "Upload aborted\n");
   }
 }
 
@@ -687,7 +760,7 @@ void CrossPointWebServer::handleCreateFolder() const {
   if (!folderPath.endsWith("/")) folderPath += "/";
   folderPath += folderName;
 
-  Serial.printf("[%lu] [WEB] Creating folder: %s\n", millis(), folderPath.c_str());
+  LOG_INF("WEB", "Creating folder: %s\n", folderPath.c_str());
 
   // Check if already exists
   if (SdMan.exists(folderPath.c_str())) {
@@ -697,10 +770,10 @@ void CrossPointWebServer::handleCreateFolder() const {
 
   // Create the folder
   if (SdMan.mkdir(folderPath.c_str())) {
-    Serial.printf("[%lu] [WEB] Folder created successfully: %s\n", millis(), folderPath.c_str());
+    LOG_INF("WEB", "Folder created successfully: %s\n", folderPath.c_str());
     server->send(200, "text/plain", "Folder created: " + folderName);
   } else {
-    Serial.printf("[%lu] [WEB] Failed to create folder: %s\n", millis(), folderPath.c_str());
+    LOG_ERR("WEB", "Failed to create folder: %s\n", folderPath.c_str());
     server->send(500, "text/plain", "Failed to create folder");
   }
 }
@@ -731,7 +804,7 @@ void CrossPointWebServer::handleDelete() const {
 
   // Check if item starts with a dot (hidden/system file)
   if (itemName.startsWith(".")) {
-    Serial.printf("[%lu] [WEB] Delete rejected - hidden/system item: %s\n", millis(), itemPath.c_str());
+    LOG_INF("WEB", "Delete rejected - hidden/system item: %s\n", itemPath.c_str());
     server->send(403, "text/plain", "Cannot delete system files");
     return;
   }
@@ -739,7 +812,7 @@ void CrossPointWebServer::handleDelete() const {
   // Check against explicitly protected items
   for (size_t i = 0; i < HIDDEN_ITEMS_COUNT; i++) {
     if (itemName.equals(HIDDEN_ITEMS[i])) {
-      Serial.printf("[%lu] [WEB] Delete rejected - protected item: %s\n", millis(), itemPath.c_str());
+      LOG_INF("WEB", "Delete rejected - protected item: %s\n", itemPath.c_str());
       server->send(403, "text/plain", "Cannot delete protected items");
       return;
     }
@@ -747,12 +820,12 @@ void CrossPointWebServer::handleDelete() const {
 
   // Check if item exists
   if (!SdMan.exists(itemPath.c_str())) {
-    Serial.printf("[%lu] [WEB] Delete failed - item not found: %s\n", millis(), itemPath.c_str());
+    LOG_ERR("WEB", "Delete failed - item not found: %s\n", itemPath.c_str());
     server->send(404, "text/plain", "Item not found");
     return;
   }
 
-  Serial.printf("[%lu] [WEB] Attempting to delete %s: %s\n", millis(), itemType.c_str(), itemPath.c_str());
+  LOG_INF("WEB", "Attempting to delete %s: %s\n", itemType.c_str(), itemPath.c_str());
 
   bool success = false;
 
@@ -766,7 +839,7 @@ void CrossPointWebServer::handleDelete() const {
         // Folder is not empty
         entry.close();
         dir.close();
-        Serial.printf("[%lu] [WEB] Delete failed - folder not empty: %s\n", millis(), itemPath.c_str());
+        LOG_ERR("WEB", "Delete failed - folder not empty: %s\n", itemPath.c_str());
         server->send(400, "text/plain", "Folder is not empty. Delete contents first.");
         return;
       }
@@ -779,10 +852,15 @@ void CrossPointWebServer::handleDelete() const {
   }
 
   if (success) {
-    Serial.printf("[%lu] [WEB] Successfully deleted: %s\n", millis(), itemPath.c_str());
+    LOG_INF("WEB", "Successfully deleted: %s\n", itemPath.c_str());
+    LIBRARY_CATALOG.removeBook(itemPath.c_str());
+    BOOK_INGEST.remove(itemPath.c_str());
+    // The cache key and caches stay: moving a book here is a delete and a
+    // re-upload, which finds them again by content. The cache budget
+    // reclaims them if the book does not come back.
     server->send(200, "text/plain", "Deleted successfully");
   } else {
-    Serial.printf("[%lu] [WEB] Failed to delete: %s\n", millis(), itemPath.c_str());
+    LOG_ERR("WEB", "Failed to delete: %s\n", itemPath.c_str());
     server->send(500, "text/plain", "Failed to delete item");
   }
 }
@@ -803,7 +881,7 @@ void CrossPointWebServer::wsEventCallback(uint8_t num, WStype_t type, uint8_t* p
 void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
   switch (type) {
     case WStype_DISCONNECTED:
-      Serial.printf("[%lu] [WS] Client %u disconnected\n", millis(), num);
+      LOG_INF("WS", "Client %u disconnected\n", num);
       // Clean up any in-progress upload
       if (wsUploadInProgress && wsUploadFile) {
         wsUploadFile.close();
@@ -812,20 +890,20 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += wsUploadFileName;
         SdMan.remove(filePath.c_str());
-        Serial.printf("[%lu] [WS] Deleted incomplete upload: %s\n", millis(), filePath.c_str());
+        LOG_INF("WS", "Deleted incomplete upload: %s\n", filePath.c_str());
       }
       wsUploadInProgress = false;
       break;
 
     case WStype_CONNECTED: {
-      Serial.printf("[%lu] [WS] Client %u connected\n", millis(), num);
+      LOG_INF("WS", "Client %u connected\n", num);
       break;
     }
 
     case WStype_TEXT: {
       // Parse control messages
       String msg = String((char*)payload);
-      Serial.printf("[%lu] [WS] Text from client %u: %s\n", millis(), num, msg.c_str());
+      LOG_DBG("WS", "Text from client %u: %s\n", num, msg.c_str());
 
       if (msg.startsWith("START:")) {
         // Parse: START:<filename>:<size>:<path>
@@ -850,8 +928,8 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
           if (!filePath.endsWith("/")) filePath += "/";
           filePath += wsUploadFileName;
 
-          Serial.printf("[%lu] [WS] Starting upload: %s (%d bytes) to %s\n", millis(), wsUploadFileName.c_str(),
-                        wsUploadSize, filePath.c_str());
+          LOG_INF("WS", "Starting upload: %s (%zu bytes) to %s\n", wsUploadFileName.c_str(), wsUploadSize,
+                  filePath.c_str());
 
           // Check if file exists and remove it
           esp_task_wdt_reset();
@@ -917,14 +995,13 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         unsigned long elapsed = millis() - wsUploadStartTime;
         float kbps = (elapsed > 0) ? (wsUploadSize / 1024.0) / (elapsed / 1000.0) : 0;
 
-        Serial.printf("[%lu] [WS] Upload complete: %s (%d bytes in %lu ms, %.1f KB/s)\n", millis(),
-                      wsUploadFileName.c_str(), wsUploadSize, elapsed, kbps);
+        LOG_INF("WS", "Upload complete: %s (%zu bytes in %lu ms, %.1f KB/s)\n", wsUploadFileName.c_str(), wsUploadSize,
+                elapsed, kbps);
 
-        // Clear epub cache to prevent stale metadata issues when overwriting files
         String filePath = wsUploadPath;
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += wsUploadFileName;
-        clearEpubCacheIfNeeded(filePath);
+        onUploadComplete(filePath);
 
         wsServer->sendTXT(num, "DONE");
         lastProgressSent = 0;
@@ -45,6 +45,9 @@ class CrossPointWebServer {
 
   WsUploadStatus getWsUploadStatus() const;
 
+  // True while a browser has the file manager open, it may start an upload at any time
+  bool hasClients() const { return wsServer && wsServer->connectedClients() > 0; }
+
   // Get the port number
   uint16_t getPort() const { return port; }
 
@@ -71,6 +74,8 @@ class CrossPointWebServer {
   void handleRoot() const;
   void handleNotFound() const;
   void handleStatus() const;
+  void handleTrace() const;
+  void handleHeap() const;
   void handleFileList() const;
   void handleFileListData() const;
   void handleDownload() const;
@@ -0,0 +1,286 @@
+#include "BookIngestService.h"
+
+#include <Epub.h>
+#include <Epub/Section.h>
+#include <GfxRenderer.h>
+#include <Logging.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+#include <Xtc.h>
+
+#include <algorithm>
+#include <memory>
+
+#include "CrossPointSettings.h"
+#include "LibraryCatalog.h"
+#include "activities/reader/EpubReaderActivity.h"
+#include "util/StringUtils.h"
+
+namespace {
+constexpr uint8_t INGEST_FILE_VERSION = 1;
+constexpr char INGEST_FILE[] = "/.crosspoint/ingest.bin";
+// Sanity limit when reading the queue back, protects against a corrupt count
+constexpr uint32_t MAX_QUEUED_JOBS = 1000;
+
+bool isEpubPath(const std::string& path) { return StringUtils::checkFileExtension(path, ".epub"); }
+
+bool isXtcPath(const std::string& path) {
+  return StringUtils::checkFileExtension(path, ".xtc") || StringUtils::checkFileExtension(path, ".xtch");
+}
+}  // namespace
+
+BookIngestService BookIngestService::instance;
+
+BookIngestService& BookIngestService::getInstance() { return instance; }
+
+bool BookIngestService::isIngestable(const std::string& path) {
+  // TXT books have no metadata or per-book layout worth building ahead of time
+  return isEpubPath(path) || isXtcPath(path);
+}
+
+void BookIngestService::enqueue(const std::string& path) {
+  if (!isIngestable(path)) {
+    return;
+  }
+
+  // A re-uploaded book starts over, its old caches were just invalidated
+  jobs.erase(std::remove_if(jobs.begin(), jobs.end(), [&path](const Job& job) { return job.path == path; }),
+             jobs.end());
+  jobs.push_back({path, Stage::Metadata});
+  lastEnqueueTime = millis();
+  saveToFile();
+  LOG_INF("ING", "Queued %s (%zu pending)\n", path.c_str(), jobs.size());
+}
+
+int BookIngestService::enqueueUnindexed() {
+  int added = 0;
+  for (const auto& entry : LIBRARY_CATALOG.getEntries()) {
+    if (!isIngestable(entry.path)) {
+      continue;
+    }
+    const bool queued =
+        std::any_of(jobs.begin(), jobs.end(), [&entry](const Job& job) { return job.path == entry.path; });
+    if (queued) {
+      continue;
+    }
+
+    // book.bin in the reader cache is the first thing an EPUB open needs, a book without it (or without a known grid
+    // thumbnail) was never indexed. XTC has no such cache, its catalogued title doubles as the marker.
+    bool indexed;
+    if (isEpubPath(entry.path)) {
+      const Epub epub(entry.path, "/.crosspoint");
+      indexed = entry.thumbState != LibraryCatalog::ThumbState::Unknown &&
+                SdMan.exists((epub.getCachePath() + "/book.bin").c_str());
+    } else {
+      indexed = !entry.title.empty();
+    }
+    if (indexed) {
+      continue;
+    }
+
+    jobs.push_back({entry.path, Stage::Metadata});
+    added++;
+  }
+
+  if (added > 0) {
+    saveToFile();
+  }
+  LOG_INF("ING", "%d unindexed books queued\n", added);
+  return added;
+}
+
+void BookIngestService::remove(const std::string& path) {
+  const auto it = std::remove_if(jobs.begin(), jobs.end(), [&path](const Job& job) { return job.path == path; });
+  if (it == jobs.end()) {
+    return;
+  }
+  jobs.erase(it, jobs.end());
+  saveToFile();
+}
+
+const std::string& BookIngestService::getCurrentPath() const {
+  static const std::string empty;
+  return jobs.empty() ? empty : jobs.front().path;
+}
+
+bool BookIngestService::isSettled() const { return millis() - lastEnqueueTime >= SETTLE_MS; }
+
+bool BookIngestService::processNext(GfxRenderer& renderer, const bool lightStagesOnly) {
+  auto it = jobs.begin();
+  if (lightStagesOnly) {
+    it = std::find_if(jobs.begin(), jobs.end(), [](const Job& job) { return !isHeavyStage(job.stage); });
+  }
+  if (it == jobs.end()) {
+    return false;
+  }
+
+  Job& job = *it;
+  const unsigned long start = millis();
+  const bool ok = runStage(renderer, job);
+  LOG_INF("ING", "%s stage %d %s in %lu ms\n", job.path.c_str(), static_cast<int>(job.stage), ok ? "done" : "failed",
+          millis() - start);
+
+  // A failing book is dropped rather than retried, the reader will surface the error when it is opened
+  job.stage = static_cast<Stage>(static_cast<uint8_t>(job.stage) + 1);
+  if (!ok || job.stage == Stage::Done) {
+    jobs.erase(it);
+    LIBRARY_CATALOG.saveIfDirty();
+  }
+  if (jobs.empty()) {
+    xmlDriver.release();
+  }
+  saveToFile();
+  return true;
+}
+
+bool BookIngestService::runStage(GfxRenderer& renderer, const Job& job) {
+  if (!SdMan.exists(job.path.c_str())) {
+    return false;
+  }
+  if (isEpubPath(job.path)) {
+    return runEpubStage(renderer, job);
+  }
+  return runXtcStage(job);
+}
+
+bool BookIngestService::runEpubStage(GfxRenderer& renderer, const Job& job) {
+  switch (job.stage) {
+    case Stage::Metadata: {
+      Epub epub(job.path, "/.crosspoint");
+      if (!epub.load(true, &xmlDriver)) {
+        return false;
+      }
+      LIBRARY_CATALOG.setMetadata(job.path, epub.getTitle(), epub.getAuthor());
+      return true;
+    }
+    case Stage::Covers: {
+      Epub epub(job.path, "/.crosspoint");
+      if (!epub.load(false)) {
+        return false;
+      }
+      const bool cropped = SETTINGS.sleepScreenCoverMode == CrossPointSettings::SLEEP_SCREEN_COVER_MODE::CROP;
+      // Books without a cover are fine, only a broken book.bin is a failure
+      epub.generateCoverBmp(cropped);
+      epub.generateThumbBmp();
+      return true;
+    }
+    case Stage::LibraryThumb: {
+      // The Books grid keeps its thumbnails in a separate cache directory
+      Epub epub(job.path, LibraryCatalog::THUMB_CACHE_DIR);
+      const bool success = epub.load(true, &xmlDriver) && epub.generateThumbBmp();
+      LIBRARY_CATALOG.setThumbState(job.path,
+                                    success ? LibraryCatalog::ThumbState::Ready : LibraryCatalog::ThumbState::Missing);
+      return true;
+    }
+    case Stage::FirstSection: {
+      auto epub = std::make_shared<Epub>(job.path, "/.crosspoint");
+      if (!epub->load(false)) {
+        return false;
+      }
+      epub->setImageLoadingEnabled(SETTINGS.loadImages);
+
+      // Same spine index and viewport the reader picks on first open, so it finds this section file instead of
+      // building its own
+      const int spineIndex = epub->getSpineIndexForTextReference();
+      const auto orientation = EpubReaderActivity::getReaderOrientation();
+      int marginTop, marginRight, marginBottom, marginLeft;
+      EpubReaderActivity::getContentMargins(orientation, &marginTop, &marginRight, &marginBottom, &marginLeft);
+      const uint16_t viewportWidth = GfxRenderer::getScreenWidth(orientation) - marginLeft - marginRight;
+      const uint16_t viewportHeight = GfxRenderer::getScreenHeight(orientation) - marginTop - marginBottom;
+
+      Section section(epub, spineIndex, renderer);
+      if (section.loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                  SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                                  viewportHeight, SETTINGS.hyphenationEnabled)) {
+        return true;
+      }
+      return section.createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                       SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                                       viewportHeight, SETTINGS.hyphenationEnabled, nullptr, nullptr, &xmlDriver);
+    }
+    case Stage::Done:
+      break;
+  }
+  return true;
+}
+
+bool BookIngestService::runXtcStage(const Job& job) {
+  // XTC pages are pre-rendered, only metadata and covers are worth building
+  Xtc xtc(job.path, "/.crosspoint");
+  switch (job.stage) {
+    case Stage::Metadata:
+      if (!xtc.load()) {
+        return false;
+      }
+      LIBRARY_CATALOG.setMetadata(job.path, xtc.getTitle(), xtc.getAuthor());
+      return true;
+    case Stage::Covers:
+      if (!xtc.load()) {
+        return false;
+      }
+      xtc.generateCoverBmp();
+      xtc.generateThumbBmp();
+      return true;
+    default:
+      return true;
+  }
+}
+
+bool BookIngestService::saveToFile() const {
+  // Make sure the directory exists
+  SdMan.mkdir("/.crosspoint");
+
+  FsFile outputFile;
+  if (!SdMan.openFileForWrite("ING", INGEST_FILE, outputFile)) {
+    return false;
+  }
+
+  serialization::writePod(outputFile, INGEST_FILE_VERSION);
+  const auto count = static_cast<uint32_t>(jobs.size());
+  serialization::writePod(outputFile, count);
+  for (const auto& job : jobs) {
+    serialization::writeString(outputFile, job.path);
+    serialization::writePod(outputFile, job.stage);
+  }
+
+  outputFile.close();
+  return true;
+}
+
+bool BookIngestService::loadFromFile() {
+  FsFile inputFile;
+  if (!SdMan.openFileForRead("ING", INGEST_FILE, inputFile)) {
+    return false;
+  }
+
+  uint8_t version;
+  serialization::readPod(inputFile, version);
+  if (version != INGEST_FILE_VERSION) {
+    LOG_ERR("ING", "Deserialization failed: Unknown version %u\n", version);
+    inputFile.close();
+    return false;
+  }
+
+  uint32_t count;
+  serialization::readPod(inputFile, count);
+  if (count > MAX_QUEUED_JOBS) {
+    LOG_ERR("ING", "Deserialization failed: Bad job count %u\n", count);
+    inputFile.close();
+    return false;
+  }
+
+  jobs.clear();
+  jobs.reserve(count);
+  for (uint32_t i = 0; i < count; i++) {
+    Job job;
+    serialization::readString(inputFile, job.path);
+    serialization::readPod(inputFile, job.stage);
+    if (job.stage < Stage::Done) {
+      jobs.push_back(std::move(job));
+    }
+  }
+
+  inputFile.close();
+  LOG_INF("ING", "Queue loaded (%u jobs)\n", count);
+  return true;
+}
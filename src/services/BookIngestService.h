@@ -0,0 +1,77 @@
+#pragma once
+#include <ExpatDriver.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class GfxRenderer;
+
+// Background pre-indexing of books so the first open does not pay for metadata parsing, cover conversion and
+// first-section layout. Jobs are queued after uploads (or on demand for books already on the card) and advanced
+// one stage at a time by whoever owns an idle main loop, so a single call never blocks for a whole book.
+// The queue is persisted, an interrupted job resumes at the stage it was in.
+class BookIngestService {
+ public:
+  static BookIngestService& getInstance();
+
+  // Add a book to the back of the queue, restarting it if it is already queued. Unsupported paths are ignored.
+  void enqueue(const std::string& path);
+
+  // Queue every catalogued book that has not been indexed yet. Returns the number of books added.
+  int enqueueUnindexed();
+
+  // Drop a queued book (e.g. it was deleted)
+  void remove(const std::string& path);
+
+  bool hasPendingWork() const { return !jobs.empty(); }
+  size_t getPendingCount() const { return jobs.size(); }
+  // Path of the book the next processNext() call works on, empty when idle
+  const std::string& getCurrentPath() const;
+
+  // True once nothing was queued for SETTLE_MS, so a burst of uploads is not interleaved with indexing
+  bool isSettled() const;
+
+  // Run a single stage of the job at the front of the queue. Returns false if there was nothing to do.
+  // With lightStagesOnly, stages that block for seconds (cover conversion, section layout) are left queued and the
+  // first book still waiting for its metadata is worked on instead.
+  bool processNext(GfxRenderer& renderer, bool lightStagesOnly = false);
+
+  bool loadFromFile();
+
+ private:
+  BookIngestService() = default;
+  static BookIngestService instance;
+
+  static constexpr unsigned long SETTLE_MS = 3000;
+
+  // Stages run in order, each one is independently bounded in time
+  enum class Stage : uint8_t {
+    Metadata = 0,      // book.bin (spine, TOC, title/author)
+    Covers = 1,        // sleep screen cover and home thumbnail
+    LibraryThumb = 2,  // Books grid thumbnail
+    FirstSection = 3,  // Layout of the first text chapter for the current reader settings
+    Done = 4
+  };
+
+  struct Job {
+    std::string path;
+    Stage stage = Stage::Metadata;
+  };
+
+  std::vector<Job> jobs;
+  unsigned long lastEnqueueTime = 0;
+  // One XML parser for every document of the queue, freed once it drains
+  ExpatDriver xmlDriver;
+
+  static bool isIngestable(const std::string& path);
+  static bool isHeavyStage(Stage stage) { return stage != Stage::Metadata; }
+  bool runStage(GfxRenderer& renderer, const Job& job);
+  bool runEpubStage(GfxRenderer& renderer, const Job& job);
+  static bool runXtcStage(const Job& job);
+  bool saveToFile() const;
+};
+
+// Helper macro to access the ingest service
+#define BOOK_INGEST BookIngestService::getInstance()
@@ -2,7 +2,7 @@
 #include "../CrossPointSettings.h"
 #include <ArduinoJson.h>
 #include <HTTPClient.h>
-#include <HardwareSerial.h>
+#include <Logging.h>
 #include <WiFi.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
@@ -24,7 +24,7 @@ uint8_t WeatherService::getCityCount() { return 63; }
 
 void WeatherService::refresh() {
   if (refreshTaskHandle != nullptr) {
-    Serial.println("[Weather] Refresh already in progress");
+    LOG_INF("Weather", "Refresh already in progress\n");
     return;
   }
 
@@ -34,7 +34,7 @@ void WeatherService::refresh() {
         if (WiFi.status() == WL_CONNECTED) {
           uint8_t cityIndex = SETTINGS.weatherCityIndex;
           if (cityIndex >= 63) {
-            Serial.println("[Weather] Invalid city index");
+            LOG_ERR("Weather", "Invalid city index\n");
             self->refreshTaskHandle = nullptr;
             vTaskDelete(NULL);
             return;
@@ -51,7 +51,7 @@ void WeatherService::refresh() {
               "forecast?latitude=%.2f&longitude=%.2f&current=temperature_2m",
               city.lat, city.lon);
 
-          Serial.printf("[Weather] Fetching from: %s\n", url);
+          LOG_INF("Weather", "Fetching from: %s\n", url);
           http.begin(url);
           http.setTimeout(5000);
           int httpCode = http.GET();
@@ -71,13 +71,13 @@ void WeatherService::refresh() {
                        sizeof(SETTINGS.lastWeatherText), "%.1f°C", temp);
 
               SETTINGS.saveToFile();
-              Serial.printf("[Weather] Updated: %s - %s\n", city.name,
-                            SETTINGS.lastWeatherText);
+              LOG_INF("Weather", "Updated: %s - %s\n", city.name,
+                      SETTINGS.lastWeatherText);
             } else {
-              Serial.printf("[Weather] JSON parse error: %s\n", error.c_str());
+              LOG_ERR("Weather", "JSON parse error: %s\n", error.c_str());
             }
           } else {
-            Serial.printf("[Weather] HTTP error: %d\n", httpCode);
+            LOG_ERR("Weather", "HTTP error: %d\n", httpCode);
           }
           http.end();
         }
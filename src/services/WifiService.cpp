@@ -1,7 +1,7 @@
 #include "WifiService.h"
 #include "../WifiCredentialStore.h"
 #include "WeatherService.h"
-#include <HardwareSerial.h>
+#include <Logging.h>
 #include <WiFi.h>
 
 WifiService WifiService::instance;
@@ -10,19 +10,19 @@ WifiService &WifiService::getInstance() { return instance; }
 
 void WifiService::begin() {
   WiFi.mode(WIFI_STA);
-  Serial.println("[WiFi] Service initialized");
+  LOG_INF("WiFi", "Service initialized\n");
 }
 
 void WifiService::autoConnect() {
   if (autoConnectAttempted) {
-    Serial.println("[WiFi] Auto-connect already attempted");
+    LOG_INF("WiFi", "Auto-connect already attempted\n");
     return;
   }
 
   autoConnectAttempted = true;
 
   if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("[WiFi] Already connected");
+    LOG_INF("WiFi", "Already connected\n");
     return;
   }
 
@@ -32,16 +32,16 @@ void WifiService::autoConnect() {
   const auto &credentials = WIFI_STORE.getCredentials();
 
   if (credentials.empty()) {
-    Serial.println("[WiFi] No saved credentials");
+    LOG_INF("WiFi", "No saved credentials\n");
     return;
   }
 
-  Serial.printf("[WiFi] Attempting auto-connect with %d saved networks\n",
-                credentials.size());
+  LOG_INF("WiFi", "Attempting auto-connect with %zu saved networks\n",
+          credentials.size());
 
   // Try each saved credential
   for (const auto &cred : credentials) {
-    Serial.printf("[WiFi] Trying to connect to: %s\n", cred.ssid.c_str());
+    LOG_INF("WiFi", "Trying to connect to: %s\n", cred.ssid.c_str());
 
     WiFi.begin(cred.ssid.c_str(), cred.password.c_str());
 
@@ -52,19 +52,19 @@ void WifiService::autoConnect() {
     }
 
     if (WiFi.status() == WL_CONNECTED) {
-      Serial.printf("[WiFi] Connected to: %s\n", cred.ssid.c_str());
-      Serial.printf("[WiFi] IP: %s\n", WiFi.localIP().toString().c_str());
+      LOG_INF("WiFi", "Connected to: %s\n", cred.ssid.c_str());
+      LOG_INF("WiFi", "IP: %s\n", WiFi.localIP().toString().c_str());
 
       // Trigger weather refresh after successful connection
       WeatherService::getInstance().refresh();
       return;
     } else {
-      Serial.printf("[WiFi] Failed to connect to: %s\n", cred.ssid.c_str());
+      LOG_ERR("WiFi", "Failed to connect to: %s\n", cred.ssid.c_str());
       WiFi.disconnect();
     }
   }
 
-  Serial.println("[WiFi] Auto-connect failed for all saved networks");
+  LOG_ERR("WiFi", "Auto-connect failed for all saved networks\n");
 }
 
 bool WifiService::isConnected() const { return WiFi.status() == WL_CONNECTED; }
@@ -0,0 +1,264 @@
+#include <EpdFontPack.h>
+#include <GfxRenderer.h>
+#include <Logging.h>
+#include <SDCardManager.h>
+#include <builtinFonts/all.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub.h"
+#include "lib/Epub/Epub/Page.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
+#include "lib/Epub/Epub/parsers/ChapterHtmlSlimParser.h"
+#include "src/fontIds.h"
+
+// Checks the SD card font packs committed in lib/EpdFont/packs, the ones the sd_fonts firmware reads from /fonts.
+// Every pack has to open through EpdFontPack and carry exactly the metrics and bitmaps of the built-in font it
+// replaces. A chapter laid out with the Bookerly 16 packs has to produce the same pages as the built-in family, and
+// once the glyph cache is warm a page may only read a few bitmap pages from the card.
+// Built from the firmware sources with test/host standing in for the Arduino core, SdFat and the display, like
+// test/golden_layout.
+
+namespace {
+constexpr char PACK_DIR[] = "lib/EpdFont/packs";
+constexpr char SCRATCH_DIR[] = "build/font_pack/scratch";
+constexpr char CHAPTER[] = "test/parser_benchmark/resources/sample_chapter.xhtml";
+
+// Registered for the packs, not an id of fontIds.h
+constexpr int PACK_FONT_ID = 1;
+// Average bitmap page reads per page allowed when the chapter is rendered a second time through the packs
+constexpr uint32_t MAX_WARM_PACK_MISSES_PER_PAGE = 8;
+
+// CrossPointSettings defaults and the margins EpubReaderActivity::getContentMargins adds with the full status bar
+constexpr int SCREEN_MARGIN = 5;
+constexpr int STATUS_BAR_MARGIN = 19;
+
+// What convert-font-packs.sh writes, and the built-in font each pack stands in for
+struct PackFont {
+  const char* name;
+  const EpdFontData* data;
+};
+
+const PackFont PACK_FONTS[] = {
+    {"bookerly_12_regular", &bookerly_12_regular},
+    {"bookerly_12_bold", &bookerly_12_bold},
+    {"bookerly_12_italic", &bookerly_12_italic},
+    {"bookerly_12_bolditalic", &bookerly_12_bolditalic},
+    {"bookerly_16_regular", &bookerly_16_regular},
+    {"bookerly_16_bold", &bookerly_16_bold},
+    {"bookerly_16_italic", &bookerly_16_italic},
+    {"bookerly_16_bolditalic", &bookerly_16_bolditalic},
+    {"bookerly_18_regular", &bookerly_18_regular},
+    {"bookerly_18_bold", &bookerly_18_bold},
+    {"bookerly_18_italic", &bookerly_18_italic},
+    {"bookerly_18_bolditalic", &bookerly_18_bolditalic},
+    {"notosans_12_regular", &notosans_12_regular},
+    {"notosans_12_bold", &notosans_12_bold},
+    {"notosans_12_italic", &notosans_12_italic},
+    {"notosans_12_bolditalic", &notosans_12_bolditalic},
+    {"notosans_14_regular", &notosans_14_regular},
+    {"notosans_14_bold", &notosans_14_bold},
+    {"notosans_14_italic", &notosans_14_italic},
+    {"notosans_14_bolditalic", &notosans_14_bolditalic},
+    {"notosans_16_regular", &notosans_16_regular},
+    {"notosans_16_bold", &notosans_16_bold},
+    {"notosans_16_italic", &notosans_16_italic},
+    {"notosans_16_bolditalic", &notosans_16_bolditalic},
+    {"notosans_18_regular", &notosans_18_regular},
+    {"notosans_18_bold", &notosans_18_bold},
+    {"notosans_18_italic", &notosans_18_italic},
+    {"notosans_18_bolditalic", &notosans_18_bolditalic},
+    {"opendyslexic_8_regular", &opendyslexic_8_regular},
+    {"opendyslexic_8_bold", &opendyslexic_8_bold},
+    {"opendyslexic_8_italic", &opendyslexic_8_italic},
+    {"opendyslexic_8_bolditalic", &opendyslexic_8_bolditalic},
+    {"opendyslexic_10_regular", &opendyslexic_10_regular},
+    {"opendyslexic_10_bold", &opendyslexic_10_bold},
+    {"opendyslexic_10_italic", &opendyslexic_10_italic},
+    {"opendyslexic_10_bolditalic", &opendyslexic_10_bolditalic},
+    {"opendyslexic_12_regular", &opendyslexic_12_regular},
+    {"opendyslexic_12_bold", &opendyslexic_12_bold},
+    {"opendyslexic_12_italic", &opendyslexic_12_italic},
+    {"opendyslexic_12_bolditalic", &opendyslexic_12_bolditalic},
+    {"opendyslexic_14_regular", &opendyslexic_14_regular},
+    {"opendyslexic_14_bold", &opendyslexic_14_bold},
+    {"opendyslexic_14_italic", &opendyslexic_14_italic},
+    {"opendyslexic_14_bolditalic", &opendyslexic_14_bolditalic},
+};
+
+EpdFont bookerly16RegularFont(&bookerly_16_regular);
+EpdFont bookerly16BoldFont(&bookerly_16_bold);
+EpdFont bookerly16ItalicFont(&bookerly_16_italic);
+EpdFont bookerly16BoldItalicFont(&bookerly_16_bolditalic);
+
+std::string packPath(const char* name) { return std::string(PACK_DIR) + "/" + name + ".epf"; }
+
+// Line metrics, interval table, glyph metrics and every glyph bitmap of the pack against the built-in font
+bool comparePack(const PackFont& font) {
+  EpdFontPack pack(packPath(font.name));
+  if (!pack.begin()) {
+    std::cout << "PACK     " << font.name << ": does not open" << std::endl;
+    return false;
+  }
+  const EpdFontData& expected = *font.data;
+  const EpdFontData& actual = *pack.getData();
+  if (actual.advanceY != expected.advanceY || actual.ascender != expected.ascender ||
+      actual.descender != expected.descender || actual.is2Bit != expected.is2Bit || actual.isRle != expected.isRle) {
+    std::cout << "PACK     " << font.name << ": line metrics differ" << std::endl;
+    return false;
+  }
+  if (actual.intervalCount != expected.intervalCount ||
+      memcmp(actual.intervals, expected.intervals, expected.intervalCount * sizeof(EpdUnicodeInterval)) != 0) {
+    std::cout << "PACK     " << font.name << ": interval table differs" << std::endl;
+    return false;
+  }
+
+  const EpdUnicodeInterval& last = expected.intervals[expected.intervalCount - 1];
+  const uint32_t glyphCount = last.offset + (last.last - last.first) + 1;
+  for (uint32_t i = 0; i < glyphCount; i++) {
+    const EpdGlyph& want = expected.glyph[i];
+    const EpdGlyph& got = actual.glyph[i];
+    if (got.width != want.width || got.height != want.height || got.advanceX != want.advanceX ||
+        got.left != want.left || got.top != want.top || got.dataLength != want.dataLength ||
+        got.dataOffset != want.dataOffset) {
+      std::cout << "PACK     " << font.name << ": metrics of glyph " << i << " differ" << std::endl;
+      return false;
+    }
+    if (want.dataLength == 0) {
+      continue;
+    }
+    const uint8_t* bitmap = pack.getGlyphBitmap(&got);
+    if (!bitmap || memcmp(bitmap, expected.bitmap + want.dataOffset, want.dataLength) != 0) {
+      std::cout << "PACK     " << font.name << ": bitmap of glyph " << i << " differs" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+uint32_t fnv1a(const uint8_t* data, const size_t size) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// Serialized bytes and framebuffer of each page, hashed together
+bool layoutChapter(GfxRenderer& renderer, const int fontId, std::vector<uint32_t>& pageHashes) {
+  int marginTop, marginRight, marginBottom, marginLeft;
+  GfxRenderer::getOrientedViewableTRBL(GfxRenderer::Portrait, &marginTop, &marginRight, &marginBottom, &marginLeft);
+  marginTop += SCREEN_MARGIN;
+  marginRight += SCREEN_MARGIN;
+  marginLeft += SCREEN_MARGIN;
+  marginBottom += STATUS_BAR_MARGIN;
+  const uint16_t viewportWidth = renderer.getScreenWidth() - marginLeft - marginRight;
+  const uint16_t viewportHeight = renderer.getScreenHeight() - marginTop - marginBottom;
+  // The parser keeps a reference to its path
+  const std::string path = CHAPTER;
+  const std::string pagePath = std::string(SCRATCH_DIR) + "/page.bin";
+
+  pageHashes.clear();
+  bool ok = true;
+  ChapterHtmlSlimParser parser(
+      path, path, nullptr, renderer, fontId, 1.0f, true, 0, viewportWidth, viewportHeight, false,
+      [&](std::unique_ptr<Page> page) {
+        FsFile file;
+        ok = SdMan.openFileForWrite("FPT", pagePath, file) && page->serialize(file) && ok;
+        file.close();
+        std::ifstream in(pagePath, std::ios::binary);
+        const std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+        renderer.clearScreen();
+        page->render(renderer, fontId, marginLeft, marginTop);
+        pageHashes.push_back(fnv1a(bytes.data(), bytes.size()) ^
+                             fnv1a(renderer.getFrameBuffer(), GfxRenderer::getBufferSize()) * 31);
+      });
+  if (!parser.parseAndBuildPages() || !ok || pageHashes.empty()) {
+    std::cerr << "Failed to lay out " << CHAPTER << " with font " << fontId << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Lays the chapter out with built-in Bookerly 16 and then twice through its packs: the pages have to match, and the
+// second pass has to stay within the bitmap read budget
+bool checkPackLayout(GfxRenderer& renderer) {
+  std::vector<std::unique_ptr<EpdFontPack>> packs;
+  std::vector<std::unique_ptr<EpdFont>> fonts;
+  for (const char* name : {"bookerly_16_regular", "bookerly_16_bold", "bookerly_16_italic", "bookerly_16_bolditalic"}) {
+    packs.emplace_back(new EpdFontPack(packPath(name)));
+    if (!packs.back()->begin()) {
+      std::cerr << "Failed to open font pack " << packs.back()->getPath() << std::endl;
+      return false;
+    }
+    fonts.emplace_back(new EpdFont(packs.back().get()));
+  }
+  renderer.insertFont(PACK_FONT_ID, EpdFontFamily(fonts[0].get(), fonts[1].get(), fonts[2].get(), fonts[3].get()));
+
+  std::vector<uint32_t> builtinHashes, packHashes;
+  EpdFontPack::resetCacheStats();
+  if (!layoutChapter(renderer, BOOKERLY_16_FONT_ID, builtinHashes) ||
+      !layoutChapter(renderer, PACK_FONT_ID, packHashes)) {
+    return false;
+  }
+  const EpdFontPack::CacheStats cold = EpdFontPack::getCacheStats();
+  bool ok = packHashes == builtinHashes;
+  if (!ok) {
+    std::cout << "LAYOUT   " << packHashes.size() << " pages through the packs differ from " << builtinHashes.size()
+              << " built-in pages" << std::endl;
+  }
+
+  EpdFontPack::resetCacheStats();
+  layoutChapter(renderer, PACK_FONT_ID, packHashes);
+  const EpdFontPack::CacheStats warm = EpdFontPack::getCacheStats();
+  EpdFontPack::releaseAll();
+
+  std::cout << "Pack layout: " << packHashes.size() << " pages, cold " << cold.misses << " misses ("
+            << static_cast<int>(cold.getHitPercent()) << "% hits), warm " << warm.misses << " misses ("
+            << static_cast<int>(warm.getHitPercent()) << "% hits)" << std::endl;
+  if (warm.misses > MAX_WARM_PACK_MISSES_PER_PAGE * packHashes.size() || warm.readErrors > 0) {
+    std::cout << "LAYOUT   page renders read more than " << MAX_WARM_PACK_MISSES_PER_PAGE
+              << " bitmap pages per page after warm-up" << std::endl;
+    ok = false;
+  }
+  return ok;
+}
+}  // namespace
+
+// The chapter is laid out without a book, every <img> takes the alt text fallback and these are never called
+const std::string& Epub::getCachePath() const { return cachePath; }
+
+bool Epub::readItemContentsToStream(const std::string&, Print&, size_t) const { return false; }
+
+int main() {
+  logging::setSinkEnabled(false);
+  SdMan.mkdir(SCRATCH_DIR);
+
+  int failures = 0;
+  for (const auto& font : PACK_FONTS) {
+    failures += comparePack(font) ? 0 : 1;
+  }
+  EpdFontPack::releaseAll();
+  std::cout << "Packs: " << std::size(PACK_FONTS) << " checked, " << failures << " differ from the built-in fonts"
+            << std::endl;
+
+  EInkDisplay display;
+  GfxRenderer renderer(display);
+  renderer.insertFont(BOOKERLY_16_FONT_ID, EpdFontFamily(&bookerly16RegularFont, &bookerly16BoldFont,
+                                                         &bookerly16ItalicFont, &bookerly16BoldItalicFont));
+  Hyphenator::setPreferredLanguage("en");
+  if (!checkPackLayout(renderer) || failures > 0) {
+    return 1;
+  }
+  std::cout << "All font packs match" << std::endl;
+  return 0;
+}
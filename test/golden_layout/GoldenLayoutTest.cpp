@@ -0,0 +1,397 @@
+#include <GfxRenderer.h>
+#include <Logging.h>
+#include <SDCardManager.h>
+#include <builtinFonts/all.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub.h"
+#include "lib/Epub/Epub/Page.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
+#include "lib/Epub/Epub/parsers/ChapterHtmlSlimParser.h"
+#include "src/fontIds.h"
+
+// Lays out a fixed corpus of chapters through ChapterHtmlSlimParser and ParsedText with every built-in reader font and
+// a spread of reader settings, and hashes each page twice: the bytes Page::serialize writes to the section cache, and
+// the framebuffer after rendering the page the way the reader does.
+// Performance work on the parser, line breaking, fonts or the renderer must leave both hashes alone. When a change is
+// meant to move pixels, rerun with --update and review the golden diff with the change.
+//
+// Usage: GoldenLayoutTest [--update] [--verbose]
+
+namespace {
+constexpr char GOLDEN_FILE[] = "test/golden_layout/golden_hashes.txt";
+constexpr char SCRATCH_DIR[] = "build/golden_layout/scratch";
+
+struct Chapter {
+  const char* name;
+  const char* path;
+  const char* language;
+};
+
+const Chapter CHAPTERS[] = {
+    {"sample", "test/parser_benchmark/resources/sample_chapter.xhtml", "en"},
+    {"formatting", "test/golden_layout/resources/formatting.xhtml", "en"},
+};
+
+// Reader settings that affect layout, mirrors CrossPointSettings
+struct LayoutConfig {
+  std::string name;
+  int fontId;
+  float lineCompression;
+  bool extraParagraphSpacing;
+  uint8_t paragraphAlignment;
+  bool hyphenationEnabled;
+  GfxRenderer::Orientation orientation;
+};
+
+// CrossPointSettings::PARAGRAPH_ALIGNMENT
+constexpr uint8_t JUSTIFIED = 0;
+constexpr uint8_t LEFT_ALIGN = 1;
+constexpr uint8_t CENTER_ALIGN = 2;
+constexpr uint8_t RIGHT_ALIGN = 3;
+
+// CrossPointSettings defaults and the margins EpubReaderActivity::getContentMargins adds with the full status bar
+constexpr int SCREEN_MARGIN = 5;
+constexpr int STATUS_BAR_MARGIN = 19;
+
+EpdFont bookerly12RegularFont(&bookerly_12_regular);
+EpdFont bookerly12BoldFont(&bookerly_12_bold);
+EpdFont bookerly12ItalicFont(&bookerly_12_italic);
+EpdFont bookerly12BoldItalicFont(&bookerly_12_bolditalic);
+EpdFont bookerly14RegularFont(&bookerly_14_regular);
+EpdFont bookerly14BoldFont(&bookerly_14_bold);
+EpdFont bookerly14ItalicFont(&bookerly_14_italic);
+EpdFont bookerly14BoldItalicFont(&bookerly_14_bolditalic);
+EpdFont bookerly16RegularFont(&bookerly_16_regular);
+EpdFont bookerly16BoldFont(&bookerly_16_bold);
+EpdFont bookerly16ItalicFont(&bookerly_16_italic);
+EpdFont bookerly16BoldItalicFont(&bookerly_16_bolditalic);
+EpdFont bookerly18RegularFont(&bookerly_18_regular);
+EpdFont bookerly18BoldFont(&bookerly_18_bold);
+EpdFont bookerly18ItalicFont(&bookerly_18_italic);
+EpdFont bookerly18BoldItalicFont(&bookerly_18_bolditalic);
+EpdFont notosans12RegularFont(&notosans_12_regular);
+EpdFont notosans12BoldFont(&notosans_12_bold);
+EpdFont notosans12ItalicFont(&notosans_12_italic);
+EpdFont notosans12BoldItalicFont(&notosans_12_bolditalic);
+EpdFont notosans14RegularFont(&notosans_14_regular);
+EpdFont notosans14BoldFont(&notosans_14_bold);
+EpdFont notosans14ItalicFont(&notosans_14_italic);
+EpdFont notosans14BoldItalicFont(&notosans_14_bolditalic);
+EpdFont notosans16RegularFont(&notosans_16_regular);
+EpdFont notosans16BoldFont(&notosans_16_bold);
+EpdFont notosans16ItalicFont(&notosans_16_italic);
+EpdFont notosans16BoldItalicFont(&notosans_16_bolditalic);
+EpdFont notosans18RegularFont(&notosans_18_regular);
+EpdFont notosans18BoldFont(&notosans_18_bold);
+EpdFont notosans18ItalicFont(&notosans_18_italic);
+EpdFont notosans18BoldItalicFont(&notosans_18_bolditalic);
+EpdFont opendyslexic8RegularFont(&opendyslexic_8_regular);
+EpdFont opendyslexic8BoldFont(&opendyslexic_8_bold);
+EpdFont opendyslexic8ItalicFont(&opendyslexic_8_italic);
+EpdFont opendyslexic8BoldItalicFont(&opendyslexic_8_bolditalic);
+EpdFont opendyslexic10RegularFont(&opendyslexic_10_regular);
+EpdFont opendyslexic10BoldFont(&opendyslexic_10_bold);
+EpdFont opendyslexic10ItalicFont(&opendyslexic_10_italic);
+EpdFont opendyslexic10BoldItalicFont(&opendyslexic_10_bolditalic);
+EpdFont opendyslexic12RegularFont(&opendyslexic_12_regular);
+EpdFont opendyslexic12BoldFont(&opendyslexic_12_bold);
+EpdFont opendyslexic12ItalicFont(&opendyslexic_12_italic);
+EpdFont opendyslexic12BoldItalicFont(&opendyslexic_12_bolditalic);
+EpdFont opendyslexic14RegularFont(&opendyslexic_14_regular);
+EpdFont opendyslexic14BoldFont(&opendyslexic_14_bold);
+EpdFont opendyslexic14ItalicFont(&opendyslexic_14_italic);
+EpdFont opendyslexic14BoldItalicFont(&opendyslexic_14_bolditalic);
+
+// Same registration as setupDisplayAndFonts in main.cpp
+void insertReaderFonts(GfxRenderer& renderer) {
+  renderer.insertFont(BOOKERLY_12_FONT_ID, EpdFontFamily(&bookerly12RegularFont, &bookerly12BoldFont,
+                                                         &bookerly12ItalicFont, &bookerly12BoldItalicFont));
+  renderer.insertFont(BOOKERLY_14_FONT_ID, EpdFontFamily(&bookerly14RegularFont, &bookerly14BoldFont,
+                                                         &bookerly14ItalicFont, &bookerly14BoldItalicFont));
+  renderer.insertFont(BOOKERLY_16_FONT_ID, EpdFontFamily(&bookerly16RegularFont, &bookerly16BoldFont,
+                                                         &bookerly16ItalicFont, &bookerly16BoldItalicFont));
+  renderer.insertFont(BOOKERLY_18_FONT_ID, EpdFontFamily(&bookerly18RegularFont, &bookerly18BoldFont,
+                                                         &bookerly18ItalicFont, &bookerly18BoldItalicFont));
+  renderer.insertFont(NOTOSANS_12_FONT_ID, EpdFontFamily(&notosans12RegularFont, &notosans12BoldFont,
+                                                         &notosans12ItalicFont, &notosans12BoldItalicFont));
+  renderer.insertFont(NOTOSANS_14_FONT_ID, EpdFontFamily(&notosans14RegularFont, &notosans14BoldFont,
+                                                         &notosans14ItalicFont, &notosans14BoldItalicFont));
+  renderer.insertFont(NOTOSANS_16_FONT_ID, EpdFontFamily(&notosans16RegularFont, &notosans16BoldFont,
+                                                         &notosans16ItalicFont, &notosans16BoldItalicFont));
+  renderer.insertFont(NOTOSANS_18_FONT_ID, EpdFontFamily(&notosans18RegularFont, &notosans18BoldFont,
+                                                         &notosans18ItalicFont, &notosans18BoldItalicFont));
+  renderer.insertFont(OPENDYSLEXIC_8_FONT_ID, EpdFontFamily(&opendyslexic8RegularFont, &opendyslexic8BoldFont,
+                                                            &opendyslexic8ItalicFont, &opendyslexic8BoldItalicFont));
+  renderer.insertFont(OPENDYSLEXIC_10_FONT_ID,
+                      EpdFontFamily(&opendyslexic10RegularFont, &opendyslexic10BoldFont, &opendyslexic10ItalicFont,
+                                    &opendyslexic10BoldItalicFont));
+  renderer.insertFont(OPENDYSLEXIC_12_FONT_ID,
+                      EpdFontFamily(&opendyslexic12RegularFont, &opendyslexic12BoldFont, &opendyslexic12ItalicFont,
+                                    &opendyslexic12BoldItalicFont));
+  renderer.insertFont(OPENDYSLEXIC_14_FONT_ID,
+                      EpdFontFamily(&opendyslexic14RegularFont, &opendyslexic14BoldFont, &opendyslexic14ItalicFont,
+                                    &opendyslexic14BoldItalicFont));
+}
+
+// Every font at its family's normal line spacing, then each layout setting varied on its own from the default
+// reader configuration (Bookerly 14, justified, extra paragraph spacing, no hyphenation, portrait)
+std::vector<LayoutConfig> buildConfigs() {
+  struct Font {
+    const char* name;
+    int fontId;
+    float normalLineCompression;
+  };
+  // Line compression as CrossPointSettings::getReaderLineCompression returns it for NORMAL
+  const Font fonts[] = {
+      {"bookerly_12", BOOKERLY_12_FONT_ID, 1.0f},          {"bookerly_14", BOOKERLY_14_FONT_ID, 1.0f},
+      {"bookerly_16", BOOKERLY_16_FONT_ID, 1.0f},          {"bookerly_18", BOOKERLY_18_FONT_ID, 1.0f},
+      {"notosans_12", NOTOSANS_12_FONT_ID, 0.95f},         {"notosans_14", NOTOSANS_14_FONT_ID, 0.95f},
+      {"notosans_16", NOTOSANS_16_FONT_ID, 0.95f},         {"notosans_18", NOTOSANS_18_FONT_ID, 0.95f},
+      {"opendyslexic_8", OPENDYSLEXIC_8_FONT_ID, 0.95f},   {"opendyslexic_10", OPENDYSLEXIC_10_FONT_ID, 0.95f},
+      {"opendyslexic_12", OPENDYSLEXIC_12_FONT_ID, 0.95f}, {"opendyslexic_14", OPENDYSLEXIC_14_FONT_ID, 0.95f},
+  };
+
+  std::vector<LayoutConfig> configs;
+  for (const auto& font : fonts) {
+    configs.push_back(
+        {font.name, font.fontId, font.normalLineCompression, true, JUSTIFIED, false, GfxRenderer::Portrait});
+  }
+
+  const LayoutConfig base = configs[1];
+  const auto variant = [&](const char* suffix) {
+    LayoutConfig config = base;
+    config.name += suffix;
+    return config;
+  };
+  LayoutConfig config = variant("_tight");
+  config.lineCompression = 0.95f;
+  configs.push_back(config);
+  config = variant("_wide");
+  config.lineCompression = 1.1f;
+  configs.push_back(config);
+  config = variant("_left");
+  config.paragraphAlignment = LEFT_ALIGN;
+  configs.push_back(config);
+  config = variant("_center");
+  config.paragraphAlignment = CENTER_ALIGN;
+  configs.push_back(config);
+  config = variant("_right");
+  config.paragraphAlignment = RIGHT_ALIGN;
+  configs.push_back(config);
+  config = variant("_no_extra_spacing");
+  config.extraParagraphSpacing = false;
+  configs.push_back(config);
+  config = variant("_hyphenated");
+  config.hyphenationEnabled = true;
+  configs.push_back(config);
+  config = variant("_landscape");
+  config.orientation = GfxRenderer::LandscapeClockwise;
+  configs.push_back(config);
+  config = variant("_landscape_hyphenated");
+  config.orientation = GfxRenderer::LandscapeCounterClockwise;
+  config.hyphenationEnabled = true;
+  configs.push_back(config);
+  return configs;
+}
+
+uint32_t fnv1a(const uint8_t* data, const size_t size) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+std::string toHex(const uint32_t value) {
+  char buffer[9];
+  snprintf(buffer, sizeof(buffer), "%08x", value);
+  return buffer;
+}
+
+// Hash of exactly what Section::createSectionFile would store for the page
+uint32_t hashSerializedPage(const Page& page) {
+  const std::string path = std::string(SCRATCH_DIR) + "/page.bin";
+  FsFile file;
+  if (!SdMan.openFileForWrite("GLD", path, file) || !page.serialize(file)) {
+    std::cerr << "Failed to serialize page to " << path << std::endl;
+    return 0;
+  }
+  file.close();
+
+  std::ifstream in(path, std::ios::binary);
+  const std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  return fnv1a(bytes.data(), bytes.size());
+}
+
+// Hash of the black and white frame EpubReaderActivity::renderContents draws before the status bar
+uint32_t hashRenderedPage(GfxRenderer& renderer, const Page& page, const int fontId, const int marginLeft,
+                          const int marginTop) {
+  renderer.clearScreen();
+  page.render(renderer, fontId, marginLeft, marginTop);
+  return fnv1a(renderer.getFrameBuffer(), GfxRenderer::getBufferSize());
+}
+
+// "<config> <chapter> <page>" -> "<serialized hash> <framebuffer hash>"
+using HashTable = std::map<std::string, std::string>;
+
+bool layoutChapter(GfxRenderer& renderer, const LayoutConfig& config, const Chapter& chapter,
+                   HashTable& hashes) {
+  renderer.setOrientation(config.orientation);
+  int marginTop, marginRight, marginBottom, marginLeft;
+  GfxRenderer::getOrientedViewableTRBL(config.orientation, &marginTop, &marginRight, &marginBottom, &marginLeft);
+  marginTop += SCREEN_MARGIN;
+  marginRight += SCREEN_MARGIN;
+  marginLeft += SCREEN_MARGIN;
+  marginBottom += STATUS_BAR_MARGIN;
+  const uint16_t viewportWidth = renderer.getScreenWidth() - marginLeft - marginRight;
+  const uint16_t viewportHeight = renderer.getScreenHeight() - marginTop - marginBottom;
+
+  Hyphenator::setPreferredLanguage(chapter.language);
+
+  const std::string path = chapter.path;
+  int pageIndex = 0;
+  ChapterHtmlSlimParser parser(
+      path, path, nullptr, renderer, config.fontId, config.lineCompression, config.extraParagraphSpacing,
+      config.paragraphAlignment, viewportWidth, viewportHeight, config.hyphenationEnabled,
+      [&](std::unique_ptr<Page> page) {
+        char pageNumber[8];
+        snprintf(pageNumber, sizeof(pageNumber), "%03d", pageIndex++);
+        const std::string key = config.name + " " + chapter.name + " " + pageNumber;
+        hashes[key] = toHex(hashSerializedPage(*page)) + " " +
+                      toHex(hashRenderedPage(renderer, *page, config.fontId, marginLeft, marginTop));
+      });
+  const bool parsed = parser.parseAndBuildPages();
+  if (!parsed || pageIndex == 0) {
+    std::cerr << "Failed to lay out " << chapter.path << " with " << config.name << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool readGoldens(HashTable& goldens) {
+  std::ifstream in(GOLDEN_FILE);
+  if (!in) {
+    return false;
+  }
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream fields(line);
+    std::string config, chapter, page, serialized, framebuffer;
+    fields >> config >> chapter >> page >> serialized >> framebuffer;
+    goldens[config + " " + chapter + " " + page] = serialized + " " + framebuffer;
+  }
+  return true;
+}
+
+bool writeGoldens(const HashTable& hashes) {
+  std::ofstream out(GOLDEN_FILE);
+  if (!out) {
+    return false;
+  }
+  out << "# Generated by test/run_golden_layout.sh --update, do not edit\n";
+  out << "# config chapter page serialized_page_fnv1a framebuffer_fnv1a\n";
+  for (const auto& [key, value] : hashes) {
+    out << key << " " << value << "\n";
+  }
+  return static_cast<bool>(out);
+}
+
+int compareWithGoldens(const HashTable& hashes, const HashTable& goldens, const bool verbose) {
+  int mismatches = 0;
+  for (const auto& [key, value] : hashes) {
+    const auto golden = goldens.find(key);
+    if (golden == goldens.end()) {
+      std::cout << "NEW      " << key << " " << value << std::endl;
+      mismatches++;
+    } else if (golden->second != value) {
+      std::cout << "CHANGED  " << key << " " << golden->second << " -> " << value << std::endl;
+      mismatches++;
+    } else if (verbose) {
+      std::cout << "OK       " << key << " " << value << std::endl;
+    }
+  }
+  for (const auto& [key, value] : goldens) {
+    if (hashes.find(key) == hashes.end()) {
+      std::cout << "MISSING  " << key << " " << value << std::endl;
+      mismatches++;
+    }
+  }
+  return mismatches;
+}
+}  // namespace
+
+// The chapters are laid out without a book, every <img> takes the alt text fallback and these are never called
+const std::string& Epub::getCachePath() const { return cachePath; }
+
+bool Epub::readItemContentsToStream(const std::string&, Print&, size_t) const { return false; }
+
+int main(int argc, char* argv[]) {
+  bool update = false;
+  bool verbose = false;
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (arg == "--update") {
+      update = true;
+    } else if (arg == "--verbose") {
+      verbose = true;
+    } else {
+      std::cerr << "Usage: " << argv[0] << " [--update] [--verbose]" << std::endl;
+      return 2;
+    }
+  }
+
+  // Parser warnings about the deliberately broken bits of the corpus are expected
+  logging::setSinkEnabled(verbose);
+  SdMan.mkdir(SCRATCH_DIR);
+
+  EInkDisplay display;
+  GfxRenderer renderer(display);
+  insertReaderFonts(renderer);
+
+  HashTable hashes;
+  bool ok = true;
+  for (const auto& config : buildConfigs()) {
+    for (const auto& chapter : CHAPTERS) {
+      ok = layoutChapter(renderer, config, chapter, hashes) && ok;
+    }
+  }
+  if (!ok) {
+    return 1;
+  }
+
+  if (update) {
+    if (!writeGoldens(hashes)) {
+      std::cerr << "Failed to write " << GOLDEN_FILE << std::endl;
+      return 1;
+    }
+    std::cout << "Wrote " << hashes.size() << " page hashes to " << GOLDEN_FILE << std::endl;
+    return 0;
+  }
+
+  HashTable goldens;
+  if (!readGoldens(goldens)) {
+    std::cerr << "No goldens at " << GOLDEN_FILE << ", run with --update first" << std::endl;
+    return 1;
+  }
+  const int mismatches = compareWithGoldens(hashes, goldens, verbose);
+  if (mismatches > 0) {
+    std::cout << mismatches << " of " << goldens.size() << " golden pages differ" << std::endl;
+    return 1;
+  }
+  std::cout << "All " << hashes.size() << " pages match the goldens" << std::endl;
+  return 0;
+}
@@ -0,0 +1,31 @@
+#pragma once
+// Host stand-in for the Arduino core, just what the libraries under test use. The ESP32 core header also brings in
+// the C library and a few standard headers the libraries rely on without including them.
+#include <HardwareSerial.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+inline unsigned long millis() {
+  static const auto start = std::chrono::steady_clock::now();
+  return static_cast<unsigned long>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+inline void delay(unsigned long) {}
+
+// The host heap is never the constraint, report plenty so adaptive code takes its normal path
+class EspClass {
+ public:
+  uint32_t getFreeHeap() const { return 200 * 1024; }
+  uint32_t getMaxAllocHeap() const { return 100 * 1024; }
+  uint32_t getMinFreeHeap() const { return 150 * 1024; }
+  uint32_t getHeapSize() const { return 320 * 1024; }
+};
+
+inline EspClass ESP;
@@ -0,0 +1,62 @@
+#pragma once
+// Host stand-in for the panel driver of open-x4-sdk: a framebuffer in RAM, refreshes are only counted. A full refresh
+// keeps a copy of the frame it sent and can be slowed down to stand in for the waveform.
+#include <Arduino.h>
+
+#include <thread>
+
+class EInkDisplay {
+ public:
+  static constexpr uint16_t DISPLAY_WIDTH = 800;
+  static constexpr uint16_t DISPLAY_HEIGHT = 480;
+  static constexpr uint16_t DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
+  static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
+
+  enum RefreshMode { FULL_REFRESH, HALF_REFRESH, FAST_REFRESH };
+
+  uint8_t* getFrameBuffer() { return frameBuffer; }
+  void clearScreen(const uint8_t color = 0xFF) { memset(frameBuffer, color, BUFFER_SIZE); }
+
+  // Same layout as the framebuffer: 1 bit per pixel, MSB first, rows padded to whole bytes, set bits are white
+  void drawImage(const uint8_t* image, const uint16_t x, const uint16_t y, const uint16_t width,
+                 const uint16_t height) {
+    const uint16_t imageWidthBytes = (width + 7) / 8;
+    for (uint16_t row = 0; row < height && y + row < DISPLAY_HEIGHT; row++) {
+      for (uint16_t column = 0; column < width && x + column < DISPLAY_WIDTH; column++) {
+        const bool white = image[row * imageWidthBytes + column / 8] & (0x80 >> (column % 8));
+        const uint32_t index = (y + row) * DISPLAY_WIDTH_BYTES + (x + column) / 8;
+        const uint8_t bit = 0x80 >> ((x + column) % 8);
+        frameBuffer[index] = white ? frameBuffer[index] | bit : frameBuffer[index] & ~bit;
+      }
+    }
+  }
+
+  void displayBuffer(RefreshMode = FAST_REFRESH) {
+    memcpy(displayedFrame, frameBuffer, BUFFER_SIZE);
+    std::this_thread::sleep_for(std::chrono::milliseconds(refreshDelayMs));
+    refreshCount++;
+  }
+  void displayWindow(uint16_t, uint16_t, const uint16_t width, const uint16_t height) {
+    windowRefreshCount++;
+    windowRefreshPixels += width * height;
+  }
+  void copyGrayscaleLsbBuffers(const uint8_t*) {}
+  void copyGrayscaleMsbBuffers(const uint8_t*) {}
+  void displayGrayBuffer() { refreshCount++; }
+  void cleanupGrayscaleBuffers(const uint8_t*) {}
+  void grayscaleRevert() {}
+
+  uint32_t getRefreshCount() const { return refreshCount; }
+  uint32_t getWindowRefreshCount() const { return windowRefreshCount; }
+  uint32_t getWindowRefreshPixels() const { return windowRefreshPixels; }
+  const uint8_t* getDisplayedFrame() const { return displayedFrame; }
+  void setRefreshDelayMs(const uint32_t delayMs) { refreshDelayMs = delayMs; }
+
+ private:
+  uint8_t frameBuffer[BUFFER_SIZE] = {};
+  uint8_t displayedFrame[BUFFER_SIZE] = {};
+  uint32_t refreshDelayMs = 0;
+  uint32_t refreshCount = 0;
+  uint32_t windowRefreshCount = 0;
+  uint32_t windowRefreshPixels = 0;
+};
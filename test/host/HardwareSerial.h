@@ -0,0 +1,24 @@
+#pragma once
+// Host stand-in for the Arduino Serial port, prints to stderr so stdout stays free for results
+#include <Print.h>
+
+#include <cstdarg>
+#include <cstdio>
+
+class HardwareSerial : public Print {
+ public:
+  void begin(unsigned long) {}
+  size_t write(const uint8_t c) override { return fputc(c, stderr) == EOF ? 0 : 1; }
+  size_t write(const uint8_t* buffer, const size_t size) override { return fwrite(buffer, 1, size, stderr); }
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    va_list args;
+    va_start(args, format);
+    const int written = vfprintf(stderr, format, args);
+    va_end(args);
+    return written < 0 ? 0 : static_cast<size_t>(written);
+  }
+  size_t println(const char* text) { return fprintf(stderr, "%s\n", text); }
+  explicit operator bool() const { return true; }
+};
+
+inline HardwareSerial Serial;
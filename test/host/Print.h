@@ -0,0 +1,21 @@
+#pragma once
+// Host stand-in for the Arduino Print interface
+#include <cstddef>
+#include <cstdint>
+
+class Print {
+ public:
+  virtual ~Print() = default;
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+    while (written < size && write(buffer[written])) {
+      written++;
+    }
+    return written;
+  }
+  size_t write(const char* buffer, const size_t size) {
+    return write(reinterpret_cast<const uint8_t*>(buffer), size);
+  }
+  virtual void flush() {}
+};
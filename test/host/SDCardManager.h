@@ -0,0 +1,29 @@
+#pragma once
+// Host stand-in for the SD card manager of open-x4-sdk, backed by the host file system
+#include <SdFat.h>
+#include <sys/stat.h>
+
+#include <cstdio>
+#include <string>
+
+class SDCardManager {
+ public:
+  bool exists(const char* path) const {
+    struct stat info {};
+    return stat(path, &info) == 0;
+  }
+  bool mkdir(const char* path, bool = true) const { return ::mkdir(path, 0755) == 0 || exists(path); }
+  bool remove(const char* path) const { return ::remove(path) == 0; }
+  bool rename(const char* from, const char* to) const { return ::rename(from, to) == 0; }
+
+  bool openFileForRead(const char*, const char* path, FsFile& file) const { return file.open(path, "rb"); }
+  bool openFileForRead(const char* moduleName, const std::string& path, FsFile& file) const {
+    return openFileForRead(moduleName, path.c_str(), file);
+  }
+  bool openFileForWrite(const char*, const char* path, FsFile& file) const { return file.open(path, "wb"); }
+  bool openFileForWrite(const char* moduleName, const std::string& path, FsFile& file) const {
+    return openFileForWrite(moduleName, path.c_str(), file);
+  }
+};
+
+inline SDCardManager SdMan;
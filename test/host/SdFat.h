@@ -0,0 +1,73 @@
+#pragma once
+// Host stand-in for SdFat's FsFile on top of stdio, paths are relative to the working directory
+#include <Print.h>
+
+#include <cstdio>
+
+class FsFile : public Print {
+ public:
+  FsFile() = default;
+  FsFile(const FsFile&) = delete;
+  FsFile& operator=(const FsFile&) = delete;
+  FsFile(FsFile&& other) noexcept : file(other.file) { other.file = nullptr; }
+  FsFile& operator=(FsFile&& other) noexcept {
+    if (this != &other) {
+      close();
+      file = other.file;
+      other.file = nullptr;
+    }
+    return *this;
+  }
+  ~FsFile() override { close(); }
+
+  bool open(const char* path, const char* mode) {
+    close();
+    file = fopen(path, mode);
+    return file != nullptr;
+  }
+  void close() {
+    if (file) {
+      fclose(file);
+      file = nullptr;
+    }
+  }
+  explicit operator bool() const { return file != nullptr; }
+
+  using Print::write;
+  size_t write(const uint8_t c) override { return file && fputc(c, file) != EOF ? 1 : 0; }
+  size_t write(const uint8_t* buffer, const size_t size) override { return file ? fwrite(buffer, 1, size, file) : 0; }
+  void flush() override {
+    if (file) {
+      fflush(file);
+    }
+  }
+
+  int read() { return file ? fgetc(file) : -1; }
+  int read(void* buffer, const size_t size) {
+    return file ? static_cast<int>(fread(buffer, 1, size, file)) : -1;
+  }
+  bool seek(const uint32_t position) { return seekSet(position); }
+  bool seekSet(const uint32_t position) { return file && fseek(file, position, SEEK_SET) == 0; }
+  bool seekCur(const int32_t offset) { return file && fseek(file, offset, SEEK_CUR) == 0; }
+  uint32_t position() const { return file ? static_cast<uint32_t>(ftell(file)) : 0; }
+  uint32_t size() const {
+    if (!file) {
+      return 0;
+    }
+    const long current = ftell(file);
+    fseek(file, 0, SEEK_END);
+    const long end = ftell(file);
+    fseek(file, current, SEEK_SET);
+    return static_cast<uint32_t>(end);
+  }
+  int available() const { return static_cast<int>(size() - position()); }
+  // Modification times are not tracked on the host
+  bool getModifyDateTime(uint16_t* date, uint16_t* time) const {
+    *date = 0;
+    *time = 0;
+    return true;
+  }
+
+ private:
+  FILE* file = nullptr;
+};
@@ -0,0 +1,21 @@
+#pragma once
+// Host stand-in for the FreeRTOS pieces the libraries use, tasks run on std::threads
+#include <cstdint>
+
+using TaskHandle_t = void*;
+using BaseType_t = int;
+using TickType_t = uint32_t;
+
+struct portMUX_TYPE {
+  int unused;
+};
+#define portMUX_INITIALIZER_UNLOCKED {0}
+inline void portENTER_CRITICAL(portMUX_TYPE*) {}
+inline void portEXIT_CRITICAL(portMUX_TYPE*) {}
+
+#define portMAX_DELAY 0xffffffffUL
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) (ms)
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS pdTRUE
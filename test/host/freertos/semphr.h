@@ -0,0 +1,46 @@
+#pragma once
+#include <condition_variable>
+#include <mutex>
+
+#include "FreeRTOS.h"
+
+// Mutexes are no-ops, the libraries take them on one thread. Binary semaphores are real, tasks (see task.h) give them.
+struct HostSemaphore {
+  std::mutex mutex;
+  std::condition_variable given;
+  bool available = false;
+};
+
+using SemaphoreHandle_t = HostSemaphore*;
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return nullptr; }
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return nullptr; }
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return new HostSemaphore(); }
+
+inline BaseType_t xSemaphoreTake(const SemaphoreHandle_t semaphore, TickType_t) {
+  if (!semaphore) {
+    return pdTRUE;
+  }
+  std::unique_lock<std::mutex> lock(semaphore->mutex);
+  semaphore->given.wait(lock, [semaphore] { return semaphore->available; });
+  semaphore->available = false;
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGive(const SemaphoreHandle_t semaphore) {
+  if (!semaphore) {
+    return pdTRUE;
+  }
+  {
+    std::lock_guard<std::mutex> lock(semaphore->mutex);
+    semaphore->available = true;
+  }
+  semaphore->given.notify_one();
+  return pdTRUE;
+}
+
+inline void vSemaphoreDelete(const SemaphoreHandle_t semaphore) { delete semaphore; }
+
+inline BaseType_t xSemaphoreTakeRecursive(const SemaphoreHandle_t semaphore, const TickType_t ticks) {
+  return xSemaphoreTake(semaphore, ticks);
+}
+inline BaseType_t xSemaphoreGiveRecursive(const SemaphoreHandle_t semaphore) { return xSemaphoreGive(semaphore); }
@@ -0,0 +1,50 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "FreeRTOS.h"
+
+inline void vTaskDelay(TickType_t) {}
+
+// Tasks run on detached std::threads, so work handed to a task really overlaps with its caller on the host. Task
+// notifications are a counter behind a condition variable.
+struct HostTask {
+  std::mutex mutex;
+  std::condition_variable notified;
+  uint32_t notifications = 0;
+};
+
+inline thread_local HostTask* currentHostTask = nullptr;
+
+inline BaseType_t xTaskCreate(void (*function)(void*), const char*, uint32_t, void* param, int,
+                              TaskHandle_t* handle) {
+  auto* task = new HostTask();
+  if (handle) {
+    *handle = task;
+  }
+  std::thread([function, param, task] {
+    currentHostTask = task;
+    function(param);
+  }).detach();
+  return pdPASS;
+}
+
+inline void xTaskNotifyGive(TaskHandle_t handle) {
+  auto* task = static_cast<HostTask*>(handle);
+  {
+    std::lock_guard<std::mutex> lock(task->mutex);
+    task->notifications++;
+  }
+  task->notified.notify_one();
+}
+
+inline uint32_t ulTaskNotifyTake(const BaseType_t clearOnExit, TickType_t) {
+  HostTask* task = currentHostTask;
+  std::unique_lock<std::mutex> lock(task->mutex);
+  task->notified.wait(lock, [task] { return task->notifications > 0; });
+  const uint32_t count = task->notifications;
+  task->notifications = clearOnExit ? 0 : count - 1;
+  return count;
+}
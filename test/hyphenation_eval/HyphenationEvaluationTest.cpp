@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cmath>
 #include <fstream>
 #include <functional>
@@ -11,6 +12,7 @@
 #include <vector>
 
 #include "lib/Epub/Epub/hyphenation/HyphenationCommon.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
 #include "lib/Epub/Epub/hyphenation/LanguageHyphenator.h"
 #include "lib/Epub/Epub/hyphenation/LanguageRegistry.h"
 
@@ -128,10 +130,41 @@ std::string positionsToHyphenated(const std::string& word, const std::vector<siz
 }
 
 std::vector<size_t> hyphenateWordWithHyphenator(const std::string& word, const LanguageHyphenator& hyphenator) {
-  auto cps = collectCodepoints(word);
+  static CodepointBuffer cps;
+  static LiangScratch scratch;
+  if (!collectCodepoints(word, cps)) {
+    return {};
+  }
   trimSurroundingPunctuationAndFootnote(cps);
 
-  return hyphenator.breakIndexes(cps);
+  const size_t found = hyphenator.breakIndexes(cps.data(), cps.size(), scratch);
+  return std::vector<size_t>(scratch.breaks, scratch.breaks + found);
+}
+
+// Runs the same entry point the layout code uses (Hyphenator::breakOffsets with fallback breaks) over every test word
+// until at least minDuration has passed, and reports the throughput in words per second.
+double measureWordsPerSecond(const std::vector<TestCase>& testCases, const char* primaryTag) {
+  constexpr auto minDuration = std::chrono::milliseconds(250);
+  static Hyphenator::Scratch scratch;
+  Hyphenator::setPreferredLanguage(primaryTag);
+
+  size_t words = 0;
+  size_t checksum = 0;
+  const auto start = std::chrono::steady_clock::now();
+  auto elapsed = std::chrono::steady_clock::duration::zero();
+  do {
+    for (const auto& testCase : testCases) {
+      checksum += Hyphenator::breakOffsets(testCase.word, true, scratch);
+    }
+    words += testCases.size();
+    elapsed = std::chrono::steady_clock::now() - start;
+  } while (elapsed < minDuration);
+
+  // Keep the optimizer from dropping the loop body
+  if (checksum == static_cast<size_t>(-1)) {
+    std::cerr << checksum << std::endl;
+  }
+  return words / std::chrono::duration<double>(elapsed).count();
 }
 
 std::vector<LanguageConfig> resolveLanguages(const std::string& selection) {
@@ -374,7 +407,8 @@ int main(int argc, char* argv[]) {
 
     if (summaryMode) {
       const double averageF1Percent = testCases.empty() ? 0.0 : (totalF1 / testCases.size() * 100.0);
-      std::cout << lang.cliName << ": " << averageF1Percent << "%" << std::endl;
+      std::cout << lang.cliName << ": " << averageF1Percent << "% ("
+                << static_cast<long>(measureWordsPerSecond(testCases, lang.primaryTag)) << " words/s)" << std::endl;
       continue;
     }
 
@@ -383,6 +417,11 @@ int main(int argc, char* argv[]) {
 
     printResults(lang.cliName, testCases, worstCases, perfectMatches, partialMatches, completeMisses, totalPrecision,
                  totalRecall, totalF1, totalWeighted, totalTP, totalFP, totalFN, hyphenateFunc);
+
+    std::cout << "--- Throughput ---" << std::endl;
+    std::cout << "Hyphenator::breakOffsets: " << static_cast<long>(measureWordsPerSecond(testCases, lang.primaryTag))
+              << " words/s" << std::endl;
+    std::cout << std::endl;
   }
 
   return 0;
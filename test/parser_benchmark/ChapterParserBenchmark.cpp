@@ -0,0 +1,269 @@
+#include <EpdFont.h>
+#include <ExpatDriver.h>
+#include <GfxRenderer.h>
+#include <Logging.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_bolditalic.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <expat.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub.h"
+#include "lib/Epub/Epub/Page.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
+#include "lib/Epub/Epub/parsers/ChapterHtmlSlimParser.h"
+#include "lib/Epub/Epub/parsers/HtmlTags.h"
+#include "src/fontIds.h"
+
+// Measures ChapterHtmlSlimParser::parseAndBuildPages, the code Section::createSectionFile runs, on real XHTML: expat
+// tokenizing, tag classification, word tokenizing of character data and line layout with the default reader font.
+// Built from the firmware sources with test/host standing in for the Arduino core, SdFat and the display, like
+// test/golden_layout.
+// Each chapter is built with hyphenation off and on, once with a new ExpatDriver per build and once with a driver
+// shared between builds the way batch indexing reuses it.
+// Tag classification is also timed on its own over the chapter's tag stream: HtmlTags::classify, which the parser
+// runs once per start and end tag, against the strcmp table scans it replaced.
+
+namespace {
+// CrossPointSettings defaults: Bookerly 14, normal line spacing, extra paragraph spacing, justified
+constexpr float LINE_COMPRESSION = 1.0f;
+constexpr bool EXTRA_PARAGRAPH_SPACING = true;
+constexpr uint8_t JUSTIFIED = 0;
+// Margins EpubReaderActivity::getContentMargins adds with the full status bar
+constexpr int SCREEN_MARGIN = 5;
+constexpr int STATUS_BAR_MARGIN = 19;
+
+EpdFont bookerly14RegularFont(&bookerly_14_regular);
+EpdFont bookerly14BoldFont(&bookerly_14_bold);
+EpdFont bookerly14ItalicFont(&bookerly_14_italic);
+EpdFont bookerly14BoldItalicFont(&bookerly_14_bolditalic);
+
+// Start and end tags in document order, the calls the parser classifies
+struct TagEvent {
+  std::string name;
+  bool start;
+};
+
+bool recordTags(const std::string& document, std::vector<TagEvent>& tags) {
+  const XML_Parser parser = XML_ParserCreate(nullptr);
+  XML_SetUserData(parser, &tags);
+  XML_SetElementHandler(
+      parser,
+      [](void* userData, const XML_Char* name, const XML_Char**) {
+        static_cast<std::vector<TagEvent>*>(userData)->push_back({name, true});
+      },
+      [](void* userData, const XML_Char* name) {
+        static_cast<std::vector<TagEvent>*>(userData)->push_back({name, false});
+      });
+  const bool ok = XML_Parse(parser, document.data(), static_cast<int>(document.size()), XML_TRUE) != XML_STATUS_ERROR;
+  if (!ok) {
+    std::cerr << "Parse error at line " << XML_GetCurrentLineNumber(parser) << ": "
+              << XML_ErrorString(XML_GetErrorCode(parser)) << std::endl;
+  }
+  XML_ParserFree(parser);
+  return ok && !tags.empty();
+}
+
+// The tag tables and checks ChapterHtmlSlimParser ran before HtmlTags, in the order startElement and endElement
+// tried them
+namespace legacy {
+const char* HEADER_TAGS[] = {"h1", "h2", "h3", "h4", "h5", "h6"};
+constexpr int NUM_HEADER_TAGS = sizeof(HEADER_TAGS) / sizeof(HEADER_TAGS[0]);
+const char* BLOCK_TAGS[] = {"p", "li", "div", "br", "blockquote"};
+constexpr int NUM_BLOCK_TAGS = sizeof(BLOCK_TAGS) / sizeof(BLOCK_TAGS[0]);
+const char* BOLD_TAGS[] = {"b", "strong"};
+constexpr int NUM_BOLD_TAGS = sizeof(BOLD_TAGS) / sizeof(BOLD_TAGS[0]);
+const char* ITALIC_TAGS[] = {"i", "em"};
+constexpr int NUM_ITALIC_TAGS = sizeof(ITALIC_TAGS) / sizeof(ITALIC_TAGS[0]);
+const char* IMAGE_TAGS[] = {"img", "image"};
+constexpr int NUM_IMAGE_TAGS = sizeof(IMAGE_TAGS) / sizeof(IMAGE_TAGS[0]);
+const char* SKIP_TAGS[] = {"head"};
+constexpr int NUM_SKIP_TAGS = sizeof(SKIP_TAGS) / sizeof(SKIP_TAGS[0]);
+
+bool matches(const char* tag_name, const char* possible_tags[], const int possible_tag_count) {
+  for (int i = 0; i < possible_tag_count; i++) {
+    if (strcmp(tag_name, possible_tags[i]) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int classifyStart(const char* name) {
+  if (strcmp(name, "table") == 0) return 1;
+  if (matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS)) return 2;
+  if (matches(name, SKIP_TAGS, NUM_SKIP_TAGS)) return 3;
+  if (matches(name, HEADER_TAGS, NUM_HEADER_TAGS)) return 4;
+  if (matches(name, BLOCK_TAGS, NUM_BLOCK_TAGS)) return strcmp(name, "br") == 0 ? 5 : strcmp(name, "li") == 0 ? 6 : 7;
+  if (matches(name, BOLD_TAGS, NUM_BOLD_TAGS)) return 8;
+  if (matches(name, ITALIC_TAGS, NUM_ITALIC_TAGS)) return 9;
+  return 0;
+}
+
+int classifyEnd(const char* name) {
+  return matches(name, BLOCK_TAGS, NUM_BLOCK_TAGS) || matches(name, HEADER_TAGS, NUM_HEADER_TAGS) ||
+         matches(name, BOLD_TAGS, NUM_BOLD_TAGS) || matches(name, ITALIC_TAGS, NUM_ITALIC_TAGS) ||
+         strcmp(name, "table") == 0 || matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS);
+}
+}  // namespace legacy
+
+// The same decisions through HtmlTags, as the shipped parser makes them
+int classifyStart(const char* name) {
+  const HtmlTags::TagInfo tag = HtmlTags::classify(name);
+  if (tag.is(HtmlTags::TABLE)) return 1;
+  if (tag.is(HtmlTags::IMAGE)) return 2;
+  if (tag.is(HtmlTags::SKIP)) return 3;
+  if (tag.is(HtmlTags::HEADER)) return 4;
+  if (tag.is(HtmlTags::BLOCK)) return tag.tag == HtmlTags::Tag::Br ? 5 : tag.tag == HtmlTags::Tag::Li ? 6 : 7;
+  if (tag.is(HtmlTags::BOLD)) return 8;
+  if (tag.is(HtmlTags::ITALIC)) return 9;
+  return 0;
+}
+
+int classifyEnd(const char* name) { return HtmlTags::classify(name).is(HtmlTags::BREAKS_TEXT); }
+
+// Nanoseconds per tag, best of a few runs. The checksum of the decisions shows both sides decided alike.
+template <typename Start, typename End>
+double benchmarkTags(const std::vector<TagEvent>& tags, Start classifyStartTag, End classifyEndTag, size_t& checksum) {
+  constexpr auto minDuration = std::chrono::milliseconds(100);
+  double best = 0.0;
+  for (int run = 0; run < 3; run++) {
+    size_t passes = 0;
+    size_t sum = 0;
+    const auto startTime = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::steady_clock::duration::zero();
+    do {
+      sum = 0;
+      for (const auto& tag : tags) {
+        sum = sum * 31 + (tag.start ? classifyStartTag(tag.name.c_str()) : 16 + classifyEndTag(tag.name.c_str()));
+      }
+      passes++;
+      elapsed = std::chrono::steady_clock::now() - startTime;
+    } while (elapsed < minDuration);
+    checksum = sum;
+
+    const double nanoseconds = std::chrono::duration<double, std::nano>(elapsed).count() / (passes * tags.size());
+    best = run == 0 ? nanoseconds : std::min(best, nanoseconds);
+  }
+  return best;
+}
+
+struct BuildResult {
+  double secondsPerBuild = 0.0;
+  size_t pages = 0;
+};
+
+// Builds the chapter's pages until enough time has passed, best of a few runs since short runs on a shared machine
+// are noisy
+bool benchmarkBuild(GfxRenderer& renderer, const std::string& path, const bool hyphenation, const bool shareDriver,
+                    BuildResult& result) {
+  constexpr auto minDuration = std::chrono::milliseconds(250);
+  // Portrait reader viewport
+  int marginTop, marginRight, marginBottom, marginLeft;
+  GfxRenderer::getOrientedViewableTRBL(GfxRenderer::Portrait, &marginTop, &marginRight, &marginBottom, &marginLeft);
+  const uint16_t viewportWidth = renderer.getScreenWidth() - marginLeft - marginRight - 2 * SCREEN_MARGIN;
+  const uint16_t viewportHeight =
+      renderer.getScreenHeight() - marginTop - marginBottom - SCREEN_MARGIN - STATUS_BAR_MARGIN;
+
+  ExpatDriver sharedDriver;
+  result.secondsPerBuild = 0.0;
+  for (int run = 0; run < 3; run++) {
+    size_t builds = 0;
+    const auto startTime = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::steady_clock::duration::zero();
+    do {
+      size_t pages = 0;
+      ChapterHtmlSlimParser parser(
+          path, path, nullptr, renderer, BOOKERLY_14_FONT_ID, LINE_COMPRESSION, EXTRA_PARAGRAPH_SPACING, JUSTIFIED,
+          viewportWidth, viewportHeight, hyphenation, [&pages](std::unique_ptr<Page>) { pages++; }, nullptr,
+          nullptr, shareDriver ? &sharedDriver : nullptr);
+      if (!parser.parseAndBuildPages() || pages == 0) {
+        std::cerr << "Failed to lay out " << path << std::endl;
+        return false;
+      }
+      result.pages = pages;
+      builds++;
+      elapsed = std::chrono::steady_clock::now() - startTime;
+    } while (elapsed < minDuration);
+
+    const double seconds = std::chrono::duration<double>(elapsed).count() / builds;
+    result.secondsPerBuild = run == 0 ? seconds : std::min(result.secondsPerBuild, seconds);
+  }
+  return true;
+}
+}  // namespace
+
+// The chapters are laid out without a book, every <img> takes the alt text fallback and these are never called
+const std::string& Epub::getCachePath() const { return cachePath; }
+
+bool Epub::readItemContentsToStream(const std::string&, Print&, size_t) const { return false; }
+
+int main(int argc, char* argv[]) {
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; i++) {
+    files.emplace_back(argv[i]);
+  }
+  if (files.empty()) {
+    files.emplace_back("test/parser_benchmark/resources/sample_chapter.xhtml");
+  }
+
+  // Throughput logs of every build would drown the results
+  logging::setSinkEnabled(false);
+  EInkDisplay display;
+  GfxRenderer renderer(display);
+  renderer.insertFont(BOOKERLY_14_FONT_ID, EpdFontFamily(&bookerly14RegularFont, &bookerly14BoldFont,
+                                                         &bookerly14ItalicFont, &bookerly14BoldItalicFont));
+  Hyphenator::setPreferredLanguage("en");
+
+  for (const auto& path : files) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+      std::cerr << "Could not open " << path << std::endl;
+      return 1;
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    const std::string document = buffer.str();
+    std::vector<TagEvent> tags;
+    if (!recordTags(document, tags)) {
+      return 1;
+    }
+    const auto elements =
+        static_cast<size_t>(std::count_if(tags.begin(), tags.end(), [](const TagEvent& tag) { return tag.start; }));
+
+    std::cout << path << " (" << document.size() << " bytes, " << elements << " elements)" << std::endl;
+    size_t tableChecksum = 0;
+    size_t internedChecksum = 0;
+    const double tableNs = benchmarkTags(tags, legacy::classifyStart, legacy::classifyEnd, tableChecksum);
+    const double internedNs = benchmarkTags(tags, classifyStart, classifyEnd, internedChecksum);
+    if (tableChecksum != internedChecksum) {
+      std::cerr << "HtmlTags::classify decides differently from the strcmp tables" << std::endl;
+      return 1;
+    }
+    std::cout << "  tag classification: strcmp tables " << tableNs << " ns/tag, HtmlTags::classify " << internedNs
+              << " ns/tag (" << tableNs / internedNs << "x)" << std::endl;
+    for (const bool hyphenation : {false, true}) {
+      for (const bool shareDriver : {false, true}) {
+        BuildResult result;
+        if (!benchmarkBuild(renderer, path, hyphenation, shareDriver, result)) {
+          return 1;
+        }
+        std::cout << "  hyphenation " << (hyphenation ? "on, " : "off,") << (shareDriver ? " shared" : " new   ")
+                  << " driver: " << result.pages << " pages, " << result.secondsPerBuild * 1e3 << " ms, "
+                  << document.size() / result.secondsPerBuild / (1024.0 * 1024.0) << " MB/s, "
+                  << result.secondsPerBuild * 1e9 / elements << " ns/element" << std::endl;
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,82 @@
+#include <Logging.h>
+
+#include <iostream>
+#include <vector>
+
+#include "RendererTest.h"
+
+// Runs displayBufferAsync against a slowed down panel the way the reader draws its grayscale planes: the frame the
+// panel gets must not see back buffer or direct draws made while it refreshes, and the swap must leave both frames in
+// place.
+
+int main() {
+  logging::setSinkEnabled(false);
+  EInkDisplay display;
+  GfxRenderer renderer(display);
+  renderer_test::insertBookerly14(renderer);
+
+  const auto frame = [&display]() {
+    return std::vector<uint8_t>(display.getFrameBuffer(), display.getFrameBuffer() + EInkDisplay::BUFFER_SIZE);
+  };
+  const auto displayed = [&display]() {
+    return std::vector<uint8_t>(display.getDisplayedFrame(), display.getDisplayedFrame() + EInkDisplay::BUFFER_SIZE);
+  };
+  const auto fail = [](const char* message) {
+    std::cout << "ASYNC    " << message << std::endl;
+    return false;
+  };
+
+  renderer.setOrientation(GfxRenderer::Portrait);
+  renderer.clearScreen();
+  renderer.drawText(BOOKERLY_14_FONT_ID, 40, 100, "Front buffer");
+  renderer.fillRect(40, 300, 200, 50);
+  const std::vector<uint8_t> frameA = frame();
+
+  display.setRefreshDelayMs(50);
+  const uint32_t refreshes = display.getRefreshCount();
+  const GfxRenderer::PresentHandle handle = renderer.displayBufferAsync();
+  if (handle.isDone()) {
+    display.setRefreshDelayMs(0);
+    handle.wait();
+    fail("the refresh finished before displayBufferAsync returned");
+    return 1;
+  }
+
+  bool ok = true;
+  if (!renderer.beginBackBufferRender()) {
+    ok = fail("no back buffer");
+  } else {
+    renderer.clearScreen(0x00);
+    renderer.drawText(BOOKERLY_14_FONT_ID, 40, 100, "Back buffer", false);
+    renderer.fillRect(100, 500, 300, 80, false);
+    if (frame() != frameA) {
+      ok = fail("back buffer draws reached the frame buffer");
+    }
+    renderer.swapBackBuffer();
+    const std::vector<uint8_t> frameB = frame();
+    if (!handle.isDone() || display.getRefreshCount() != refreshes + 1 || displayed() != frameA) {
+      ok = fail("the swap did not wait for the refresh of the front buffer");
+    }
+    renderer.restoreBwBuffer();
+    if (frame() != frameA) {
+      ok = fail("restoreBwBuffer did not bring back the front buffer");
+    }
+
+    // Without a back buffer the first draw waits for the refresh instead
+    renderer.displayBufferAsync();
+    renderer.drawPixel(0, 0, false);
+    if (display.getRefreshCount() != refreshes + 2 || displayed() != frameA) {
+      ok = fail("a pixel drawn during the refresh changed the frame it sent");
+    }
+    renderer.clearScreen(0x00);
+    renderer.drawText(BOOKERLY_14_FONT_ID, 40, 100, "Back buffer", false);
+    renderer.fillRect(100, 500, 300, 80, false);
+    if (frame() != frameB) {
+      ok = fail("the back buffer frame differs from the same draws on the frame buffer");
+    }
+  }
+  display.setRefreshDelayMs(0);
+
+  std::cout << "Async present: " << (ok ? "frames kept apart" : "failed") << std::endl;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,80 @@
+#include <Logging.h>
+
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include "RendererTest.h"
+
+// Draws a few primitives and a line of text in every orientation and checks the dirty rect against the framebuffer:
+// fillRect has to map back to its logical rect, and every changed pixel has to lie inside the dirty rect. present()
+// has to refresh a window for a small change and the whole panel for a cleared screen.
+
+int main() {
+  logging::setSinkEnabled(false);
+  EInkDisplay display;
+  GfxRenderer renderer(display);
+  renderer_test::insertBookerly14(renderer);
+
+  const auto sameRect = [](const GfxRenderer::Rect& a, const GfxRenderer::Rect& b) {
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+  };
+  const auto isBlack = [](const uint8_t* frame, const int x, const int y) {
+    return !(frame[y * EInkDisplay::DISPLAY_WIDTH_BYTES + x / 8] & (0x80 >> (x % 8)));
+  };
+
+  bool ok = true;
+  for (const auto orientation : renderer_test::ORIENTATIONS) {
+    renderer.setOrientation(orientation);
+    renderer.clearScreen();
+    renderer.displayBuffer();
+
+    const GfxRenderer::Rect filled = {37, 61, 120, 45};
+    renderer.fillRect(filled.x, filled.y, filled.width, filled.height);
+    if (!sameRect(renderer.toLogicalRect(renderer.getDirtyRect()), filled)) {
+      std::cout << "DIRTY    orientation " << orientation << ": fillRect does not map back to its logical rect"
+                << std::endl;
+      ok = false;
+    }
+
+    const std::vector<uint8_t> before(display.getFrameBuffer(), display.getFrameBuffer() + EInkDisplay::BUFFER_SIZE);
+    renderer.drawText(BOOKERLY_14_FONT_ID, 200, 150, "Dirty rectangles");
+    renderer.drawRect(60, 300, 80, 30);
+    renderer.drawLine(10, 400, 10, 460);
+    const GfxRenderer::Rect dirty = renderer.getDirtyRect();
+    int outside = 0;
+    for (int y = 0; y < EInkDisplay::DISPLAY_HEIGHT; y++) {
+      for (int x = 0; x < EInkDisplay::DISPLAY_WIDTH; x++) {
+        const bool inside = x >= dirty.x && y >= dirty.y && x < dirty.x + dirty.width && y < dirty.y + dirty.height;
+        if (!inside && isBlack(display.getFrameBuffer(), x, y) != isBlack(before.data(), x, y)) {
+          outside++;
+        }
+      }
+    }
+    if (outside > 0) {
+      std::cout << "DIRTY    orientation " << orientation << ": " << outside << " changed pixels outside the dirty rect"
+                << std::endl;
+      ok = false;
+    }
+
+    const uint32_t refreshes = display.getRefreshCount();
+    const uint32_t windows = display.getWindowRefreshCount();
+    renderer.present();
+    renderer.present();
+    if (display.getWindowRefreshCount() != windows + 1 || display.getRefreshCount() != refreshes) {
+      std::cout << "DIRTY    orientation " << orientation << ": a small change did not refresh a single window"
+                << std::endl;
+      ok = false;
+    }
+    renderer.clearScreen();
+    renderer.present();
+    if (display.getRefreshCount() != refreshes + 1 || renderer.getDirtyRect().width != 0) {
+      std::cout << "DIRTY    orientation " << orientation << ": a cleared screen did not refresh the whole panel"
+                << std::endl;
+      ok = false;
+    }
+  }
+  std::cout << "Dirty tracking: " << std::size(renderer_test::ORIENTATIONS) << " orientations, "
+            << (ok ? "every change covered" : "failed") << std::endl;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <EpdFont.h>
+#include <GfxRenderer.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_bolditalic.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+
+#include "src/fontIds.h"
+
+// Shared by the renderer tests, each one a program of its own built by test/run_renderer_tests.sh
+
+namespace renderer_test {
+inline const GfxRenderer::Orientation ORIENTATIONS[] = {GfxRenderer::Portrait, GfxRenderer::LandscapeClockwise,
+                                                        GfxRenderer::PortraitInverted,
+                                                        GfxRenderer::LandscapeCounterClockwise};
+
+// The default reader font, the one the checks draw text with
+inline void insertBookerly14(GfxRenderer& renderer) {
+  static EpdFont regular(&bookerly_14_regular);
+  static EpdFont bold(&bookerly_14_bold);
+  static EpdFont italic(&bookerly_14_italic);
+  static EpdFont boldItalic(&bookerly_14_bolditalic);
+  renderer.insertFont(BOOKERLY_14_FONT_ID, EpdFontFamily(&regular, &bold, &italic, &boldItalic));
+}
+}  // namespace renderer_test
@@ -0,0 +1,48 @@
+#include <Logging.h>
+
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include "RendererTest.h"
+
+// Saves a strip in every orientation, draws over and around it, and restores it: the strip must come back bit for bit
+// and nothing outside it may change.
+
+int main() {
+  logging::setSinkEnabled(false);
+  EInkDisplay display;
+  GfxRenderer renderer(display);
+  renderer_test::insertBookerly14(renderer);
+
+  const auto frame = [&display]() {
+    return std::vector<uint8_t>(display.getFrameBuffer(), display.getFrameBuffer() + EInkDisplay::BUFFER_SIZE);
+  };
+
+  bool ok = true;
+  for (const auto orientation : renderer_test::ORIENTATIONS) {
+    renderer.setOrientation(orientation);
+    const GfxRenderer::Rect strip = {3, renderer.getScreenHeight() - 29, renderer.getScreenWidth() - 5, 29};
+    renderer.clearScreen();
+    renderer.fillRect(0, strip.y - 4, renderer.getScreenWidth(), 4);
+    renderer.drawRect(0, strip.y, renderer.getScreenWidth(), strip.height);
+    renderer.drawText(BOOKERLY_14_FONT_ID, 10, strip.y, "Chapter title  12/345");
+    const std::vector<uint8_t> expected = frame();
+
+    std::vector<uint8_t> saved;
+    if (!renderer.saveRegion(strip, saved)) {
+      std::cout << "REGION   orientation " << orientation << ": saveRegion failed" << std::endl;
+      ok = false;
+      continue;
+    }
+    renderer.fillRect(strip.x, strip.y, strip.width, strip.height, true);
+    renderer.restoreRegion(strip, saved);
+    if (frame() != expected) {
+      std::cout << "REGION   orientation " << orientation << ": the restored frame differs" << std::endl;
+      ok = false;
+    }
+  }
+  std::cout << "Saved regions: " << std::size(renderer_test::ORIENTATIONS) << " orientations, "
+            << (ok ? "restored" : "failed") << std::endl;
+  return ok ? 0 : 1;
+}
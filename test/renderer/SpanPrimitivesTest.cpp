@@ -0,0 +1,91 @@
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include "RendererTest.h"
+
+// Fills rectangles at every bit alignment, partly off screen and of both colors over a patterned frame, once through
+// fillRect's spans and once pixel by pixel, and draws diagonal lines in all octants. The spans have to match the pixel
+// by pixel fill in every orientation, and each line has to set one pixel per step of its long axis.
+
+int main() {
+  logging::setSinkEnabled(false);
+  EInkDisplay display;
+  GfxRenderer renderer(display);
+
+  uint8_t* frame = display.getFrameBuffer();
+  std::vector<uint8_t> pattern(EInkDisplay::BUFFER_SIZE);
+  for (size_t i = 0; i < pattern.size(); i++) {
+    pattern[i] = static_cast<uint8_t>(i * 37 + (i >> 7));
+  }
+
+  uint32_t seed = 12345;
+  const auto next = [&seed](const int range) {
+    seed = seed * 1103515245u + 12345u;
+    return static_cast<int>((seed >> 8) % range);
+  };
+
+  int mismatches = 0;
+  for (const auto orientation : renderer_test::ORIENTATIONS) {
+    renderer.setOrientation(orientation);
+    const int width = renderer.getScreenWidth();
+    const int height = renderer.getScreenHeight();
+    for (int i = 0; i < 200; i++) {
+      const int x = next(width + 40) - 20;
+      const int y = next(height + 40) - 20;
+      const int w = next(i % 4 == 0 ? 24 : width / 2);
+      const int h = next(i % 4 == 1 ? 3 : height / 4) + 1;
+      const bool state = i % 2 == 0;
+
+      memcpy(frame, pattern.data(), pattern.size());
+      renderer.fillRect(x, y, w, h, state);
+      const std::vector<uint8_t> spans(frame, frame + EInkDisplay::BUFFER_SIZE);
+
+      memcpy(frame, pattern.data(), pattern.size());
+      for (int row = y; row < y + h; row++) {
+        for (int column = x; column < x + w; column++) {
+          if (column >= 0 && row >= 0 && column < width && row < height) {
+            renderer.drawPixel(column, row, state);
+          }
+        }
+      }
+      if (memcmp(spans.data(), frame, spans.size()) != 0) {
+        std::cout << "SPAN     orientation " << orientation << ": fillRect(" << x << ", " << y << ", " << w << ", " << h
+                  << ") differs from a pixel by pixel fill" << std::endl;
+        mismatches++;
+      }
+    }
+
+    // Diagonals through every octant from the middle of the screen: both ends set, one pixel per step of the long axis
+    const int centerX = width / 2;
+    const int centerY = height / 2;
+    const int ends[][2] = {{100, 30},   {30, 100},   {-30, 100}, {-100, 30},
+                           {-100, -30}, {-30, -100}, {30, -100}, {100, -30}};
+    for (const auto& end : ends) {
+      renderer.clearScreen();
+      renderer.drawLine(centerX, centerY, centerX + end[0], centerY + end[1]);
+      int blackPixels = 0;
+      for (size_t i = 0; i < EInkDisplay::BUFFER_SIZE; i++) {
+        blackPixels += __builtin_popcount(static_cast<uint8_t>(~frame[i]));
+      }
+      const auto isSet = [&](const int x, const int y) {
+        const GfxRenderer::Rect panel = renderer.toPanelRect({x, y, 1, 1});
+        return !(frame[panel.y * EInkDisplay::DISPLAY_WIDTH_BYTES + panel.x / 8] & (0x80 >> (panel.x % 8)));
+      };
+      const int expected = std::max(std::abs(end[0]), std::abs(end[1])) + 1;
+      if (blackPixels != expected || !isSet(centerX, centerY) || !isSet(centerX + end[0], centerY + end[1])) {
+        std::cout << "SPAN     orientation " << orientation << ": diagonal to (" << end[0] << ", " << end[1] << ") set "
+                  << blackPixels << " pixels, expected " << expected << std::endl;
+        mismatches++;
+      }
+    }
+  }
+  std::cout << "Span primitives: " << std::size(renderer_test::ORIENTATIONS) << " orientations, " << mismatches
+            << " mismatches" << std::endl;
+  return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,52 @@
+#include <Logging.h>
+
+#include <iostream>
+#include <iterator>
+#include <string>
+
+#include "RendererTest.h"
+
+// getTruncationLength at every width a title can be squeezed to: the kept bytes and "..." must fit, one more character
+// must not, and cuts must not split UTF-8 sequences. truncatedText has to be that prefix with its ellipsis.
+
+int main() {
+  logging::setSinkEnabled(false);
+  EInkDisplay display;
+  GfxRenderer renderer(display);
+  renderer_test::insertBookerly14(renderer);
+
+  const char* const texts[] = {"The Voyage of the Dawn Treader", "Ünïcödé chäptér — “quoted” Ελληνικά", "W", ""};
+  const auto isContinuation = [](const char c) { return (static_cast<uint8_t>(c) & 0xC0) == 0x80; };
+
+  int failures = 0;
+  for (const char* text : texts) {
+    const std::string full = text;
+    const int fullWidth = renderer.getTextWidth(BOOKERLY_14_FONT_ID, text);
+    for (int maxWidth = 0; maxWidth <= fullWidth + 10; maxWidth++) {
+      const size_t length = renderer.getTruncationLength(BOOKERLY_14_FONT_ID, text, maxWidth);
+      const auto widthWithEllipsis = [&](const size_t bytes) {
+        return renderer.getTextWidth(BOOKERLY_14_FONT_ID, (full.substr(0, bytes) + "...").c_str());
+      };
+      size_t nextLength = length + 1;
+      while (nextLength < full.size() && isContinuation(full[nextLength])) {
+        nextLength++;
+      }
+
+      bool ok;
+      if (fullWidth <= maxWidth) {
+        ok = length == full.size();
+      } else {
+        ok = length < full.size() && (length == 0 || widthWithEllipsis(length) <= maxWidth) &&
+             !isContinuation(full[length]) && (nextLength >= full.size() || widthWithEllipsis(nextLength) > maxWidth);
+      }
+      const std::string truncated = renderer.truncatedText(BOOKERLY_14_FONT_ID, text, maxWidth);
+      ok = ok && truncated == (length == full.size() ? full : full.substr(0, length) + "...");
+      if (!ok) {
+        std::cout << "TRUNCATE \"" << text << "\" at " << maxWidth << "px: kept " << length << " bytes" << std::endl;
+        failures++;
+      }
+    }
+  }
+  std::cout << "Text truncation: " << std::size(texts) << " texts, " << failures << " failures" << std::endl;
+  return failures == 0 ? 0 : 1;
+}
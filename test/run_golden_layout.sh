@@ -0,0 +1,81 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/golden_layout"
+BINARY="$BUILD_DIR/GoldenLayoutTest"
+
+mkdir -p "$BUILD_DIR"
+
+# Same expat configuration as the firmware (see platformio.ini)
+EXPAT_FLAGS=(
+  -O2
+  -DXML_GE=0
+  -DXML_CONTEXT_BYTES=1024
+  -I"$ROOT_DIR/lib/expat"
+)
+
+for source in xmlparse xmlrole xmltok; do
+  cc "${EXPAT_FLAGS[@]}" -c "$ROOT_DIR/lib/expat/$source.c" -o "$BUILD_DIR/$source.o"
+done
+cc -O2 -I"$ROOT_DIR/lib/picojpeg" -c "$ROOT_DIR/lib/picojpeg/picojpeg.c" -o "$BUILD_DIR/picojpeg.o"
+
+# The layout and rendering code as the firmware builds it, with test/host standing in for the Arduino core, SdFat,
+# FreeRTOS and the open-x4-sdk display and SD card drivers
+SOURCES=(
+  "$ROOT_DIR/test/golden_layout/GoldenLayoutTest.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/parsers/ChapterHtmlSlimParser.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/ParsedText.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/Page.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/HyphenationMemo.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/blocks/TextBlock.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/blocks/ImageBlock.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/Hyphenator.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp"
+  "$ROOT_DIR/lib/ExpatDriver/ExpatDriver.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontPack.cpp"
+  "$ROOT_DIR/lib/JpegToBmpConverter/JpegToBmpConverter.cpp"
+  "$ROOT_DIR/lib/HeapStats/HeapStats.cpp"
+  "$ROOT_DIR/lib/FsHelpers/FsHelpers.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+)
+
+# All warnings on, the generated font headers name right-to-left code points in comments
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -Wno-bidi-chars
+  -I"$ROOT_DIR"
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/lib"
+  -I"$ROOT_DIR/lib/expat"
+  -I"$ROOT_DIR/lib/picojpeg"
+  -I"$ROOT_DIR/lib/Epub"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/ExpatDriver"
+  -I"$ROOT_DIR/lib/JpegToBmpConverter"
+  -I"$ROOT_DIR/lib/BookCacheKey"
+  -I"$ROOT_DIR/lib/HeapStats"
+  -I"$ROOT_DIR/lib/Logging"
+  -I"$ROOT_DIR/lib/Trace"
+  -I"$ROOT_DIR/lib/Serialization"
+  -I"$ROOT_DIR/lib/FsHelpers"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/ZipFile"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" "$BUILD_DIR"/xmlparse.o "$BUILD_DIR"/xmlrole.o "$BUILD_DIR"/xmltok.o \
+  "$BUILD_DIR"/picojpeg.o -o "$BINARY"
+
+cd "$ROOT_DIR"
+"$BINARY" "$@"
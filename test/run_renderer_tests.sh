@@ -0,0 +1,54 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/renderer"
+
+mkdir -p "$BUILD_DIR"
+
+# GfxRenderer as the firmware builds it, with test/host standing in for the Arduino core, SdFat, FreeRTOS and the
+# open-x4-sdk display driver
+SOURCES=(
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontPack.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+)
+
+# All warnings on, the generated font headers name right-to-left code points in comments
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -Wno-bidi-chars
+  -I"$ROOT_DIR"
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/lib"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/Logging"
+  -I"$ROOT_DIR/lib/Trace"
+  -I"$ROOT_DIR/lib/Serialization"
+  -I"$ROOT_DIR/lib/Utf8"
+)
+
+OBJECTS=()
+for source in "${SOURCES[@]}"; do
+  object="$BUILD_DIR/$(basename "${source%.cpp}").o"
+  c++ "${CXXFLAGS[@]}" -c "$source" -o "$object"
+  OBJECTS+=("$object")
+done
+
+# Every test is a program of its own, all of them run even when one fails
+cd "$ROOT_DIR"
+failed=0
+for test in "$ROOT_DIR"/test/renderer/*Test.cpp; do
+  binary="$BUILD_DIR/$(basename "${test%.cpp}")"
+  c++ "${CXXFLAGS[@]}" "$test" "${OBJECTS[@]}" -o "$binary"
+  "$binary" || failed=1
+done
+exit $failed